@@ -23,8 +23,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <thread>
+#include <vector>
+
 #include "Magnum/Image.h"
+#include "Magnum/ImagePool.h"
+#include "Magnum/JobSystem.h"
+#include "Magnum/PixelConversion.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/ScratchArena.h"
+#include "Magnum/Timeline.h"
 #ifdef MAGNUM_TARGET_GL
 #include "Magnum/GL/PixelFormat.h"
 #include "Magnum/GL/Texture.h"
@@ -33,6 +41,16 @@
 using namespace Magnum;
 using namespace Magnum::Math::Literals;
 
+namespace {
+
+struct MyThreadPool {
+    UnsignedInt threadCount() const { return 0; }
+    void submit(std::function<void()>) {}
+    void wait() {}
+};
+
+}
+
 int main() {
 
 {
@@ -176,4 +194,108 @@ CompressedImage2D image = texture.compressedImage(0, {});
 }
 #endif
 
+{
+/* [ImagePool-usage] */
+ImagePool pool;
+
+for(std::size_t i = 0; i != 100; ++i) {
+    Image2D frame = pool.image<2>(PixelFormat::RGBA8Unorm, {1920, 1080});
+
+    // fill the frame and process it ...
+
+} // the memory goes back to the pool here and is reused in the next iteration
+/* [ImagePool-usage] */
+}
+
+{
+std::vector<Float> values;
+/* [JobSystem-parallelFor] */
+JobSystem jobs{std::thread::hardware_concurrency() - 1};
+
+jobs.parallelFor(0, values.size(), 1024,
+    [&](std::size_t begin, std::size_t end, ScratchArena& scratch) {
+        /* Temporary storage, valid until the function returns */
+        Containers::ArrayView<Float> temporary = scratch.allocate<Float>(end - begin);
+        for(std::size_t i = begin; i != end; ++i)
+            temporary[i - begin] = values[i]*values[i];
+
+        // further processing ...
+    });
+/* [JobSystem-parallelFor] */
+}
+
+{
+JobSystem jobs;
+/* [TaskGraph-usage] */
+TaskGraph graph;
+UnsignedInt load = graph.add([](ScratchArena&) {
+    // load the mesh ...
+});
+UnsignedInt normals = graph.add([](ScratchArena&) {
+    // generate normals ...
+}, {load});
+UnsignedInt bounds = graph.add([](ScratchArena&) {
+    // calculate bounding box ...
+}, {load});
+graph.add([](ScratchArena&) {
+    // upload everything ...
+}, {normals, bounds});
+
+jobs.run(graph);
+/* [TaskGraph-usage] */
+}
+
+{
+/* [ScratchArena-frame] */
+ScratchArena frameArena;
+Timeline timeline;
+timeline.setFrameArena(&frameArena);
+timeline.start();
+
+// in the draw event ...
+
+/* Temporary memory valid until the end of the frame */
+Containers::ArrayView<Float> values = frameArena.allocate<Float>(1024);
+
+// ...
+
+timeline.nextFrame(); // everything allocated in the frame is released
+/* [ScratchArena-frame] */
+static_cast<void>(values);
+}
+
+{
+/* [AbstractJobExecutor-subclassing] */
+struct MyExecutor: AbstractJobExecutor {
+    explicit MyExecutor(MyThreadPool& pool): pool(pool) {}
+
+    UnsignedInt doWorkerCount() const override {
+        return pool.threadCount() + 1;
+    }
+
+    void doExecute(UnsignedInt count, WorkerFunction function, void* state) override {
+        for(UnsignedInt i = 1; i != count; ++i)
+            pool.submit([=]{ function(state, i); });
+        function(state, 0);
+        pool.wait();
+    }
+
+    MyThreadPool& pool;
+};
+/* [AbstractJobExecutor-subclassing] */
+}
+
+{
+Image2D atlas{PixelFormat::RGBA8Unorm, {}, nullptr};
+char glyphData[4];
+Vector2i offset;
+/* [copySubImage] */
+ImageView2D glyph{PixelStorage{}.setAlignment(1),
+    PixelFormat::RGB8Unorm, {13, 17}, glyphData};
+
+/* Expands to RGBA during the copy */
+copySubImage(glyph, Vector2i{}, atlas, offset, glyph.size());
+/* [copySubImage] */
+}
+
 }
@@ -23,9 +23,15 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstddef>
+
 #include "Magnum/Timeline.h"
 #include "Magnum/Math/Quaternion.h"
+#include "Magnum/Animation/Clip.h"
+#include "Magnum/Animation/Compression.h"
 #include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/PlayerGroup.h"
+#include "Magnum/Animation/TrackIndex.h"
 
 using namespace Magnum;
 using namespace Magnum::Math::Literals;
@@ -49,6 +55,88 @@ player.add(scaling, objectScaling)
 /* [Player-usage] */
 }
 
+{
+/* [Player-usage-batch] */
+/* Rotation tracks of all bones, all sampled at the same keyframes */
+const Animation::TrackView<Float, Quaternion> boneRotations[64];
+
+Quaternion rotations[64];
+
+Animation::Player<Float> player;
+player.addBatch(Containers::arrayView(boneRotations),
+                Containers::arrayView(rotations));
+/* [Player-usage-batch] */
+}
+
+{
+/* [Clip-usage] */
+/* Tracks of a walk cycle, for example from Trade::AnimationData */
+const Animation::TrackView<Float, Vector3> hipTranslation;
+const Animation::TrackView<Float, Quaternion> hipRotation;
+
+/* Animated values of a single character */
+struct Character {
+    Vector3 hipTranslation;
+    Quaternion hipRotation;
+};
+
+/* The clip is created just once ... */
+Animation::Clip<Float> walkCycle;
+walkCycle.add(hipTranslation, offsetof(Character, hipTranslation))
+         .add(hipRotation, offsetof(Character, hipRotation));
+
+/* ... and shared by all characters, each player storing only its own state */
+Containers::Array<Character> characters{5000};
+std::vector<Animation::ClipPlayer<Float>> players;
+players.reserve(characters.size());
+for(Character& character: characters)
+    players.emplace_back(walkCycle, &character);
+
+// every frame
+Timeline timeline;
+for(Animation::ClipPlayer<Float>& player: players)
+    player.advance(timeline.previousFrameTime());
+/* [Clip-usage] */
+}
+
+{
+/* [PlayerGroup-usage] */
+const Animation::TrackView<Float, Quaternion> walkCycle;
+
+/* One player per character, the destination data stored next to each other */
+Quaternion rotations[1000];
+Animation::Player<Float> players[1000];
+
+Animation::PlayerGroup<Float> group;
+for(std::size_t i = 0; i != 1000; ++i) {
+    players[i].add(walkCycle, rotations[i])
+              .play(0.0f);
+    group.add(players[i]);
+}
+
+// every frame
+Timeline timeline;
+group.advance(timeline.previousFrameTime());
+/* [PlayerGroup-usage] */
+}
+
+{
+/* [packRotationTrack] */
+Animation::Track<Float, Quaternion> rotation;
+
+/* Drop keyframes that differ from the interpolated value by less than 0.001,
+   then pack the rest into 6 bytes each */
+Animation::Track<Float, Math::Vector3<UnsignedShort>, Quaternion> packed =
+    Animation::packRotationTrack(Animation::TrackView<Float, Quaternion>{
+        Animation::reduceKeyframes(Animation::TrackView<Float, Quaternion>{rotation},
+            0.001f)});
+
+Quaternion objectRotation;
+Animation::Player<Float> player;
+player.add(packed, objectRotation);
+/* [packRotationTrack] */
+}
+
 /* WinRT has warnings-as-errors and fails on the unitialized object var */
 #ifndef CORRADE_TARGET_WINDOWS_RT
 {
@@ -221,6 +309,16 @@ Vector2 position = jump.atStrict(2.2f, hint);   // y = 0.775, hint = 2
 static_cast<void>(position);
 }
 
+{
+/* [TrackIndex-usage] */
+Animation::TrackIndex<Float> index{jump.keys()};
+
+std::size_t hint = index.hint(4.5f);
+Vector2 position = jump.at(4.5f, hint);
+/* [TrackIndex-usage] */
+static_cast<void>(position);
+}
+
 static_cast<void>(position);
 }
 
@@ -36,6 +36,7 @@
 #include "Magnum/GL/PixelFormat.h"
 #include "Magnum/GL/Renderer.h"
 #include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderPass.h"
 #include "Magnum/GL/Shader.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/GL/TextureFormat.h"
@@ -46,7 +47,9 @@
 #include "Magnum/Primitives/Cube.h"
 #include "Magnum/Primitives/Plane.h"
 #include "Magnum/Shaders/Phong.h"
+#include "Magnum/Trade/MapFile.h"
 #include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/VolumeBlob.h"
 
 #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
 #include "Magnum/GL/SampleQuery.h"
@@ -54,6 +57,7 @@
 
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/DebugOutput.h"
+#include "Magnum/GL/DebugOutputQueue.h"
 #ifndef CORRADE_TARGET_ANDROID
 #include "Magnum/GL/OpenGLTester.h"
 #endif
@@ -65,6 +69,7 @@
 #include "Magnum/GL/PrimitiveQuery.h"
 #include "Magnum/GL/TextureArray.h"
 #include "Magnum/GL/TransformFeedback.h"
+#include "Magnum/GL/VolumeBrickCache.h"
 #endif
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
@@ -180,6 +185,19 @@ static_cast<void>(data);
 }
 #endif
 
+{
+/* [opengl-wrapping-state-snapshot] */
+GL::Context& context = GL::Context::current();
+GL::Context::StateSnapshot snapshot = context.saveState();
+context.resetState(GL::Context::State::EnterExternal);
+
+// Third-party UI and video rendering ...
+
+/* Rebind what Magnum had bound instead of forgetting all of it */
+context.restoreState(snapshot);
+/* [opengl-wrapping-state-snapshot] */
+}
+
 #ifndef MAGNUM_TARGET_GLES
 {
 /* [opengl-wrapping-extensions] */
@@ -827,6 +845,23 @@ GL::DebugMessage::insert(GL::DebugMessage::Source::Application,
 /* [DebugOutput-setDefaultCallback] */
 }
 
+{
+/* [DebugOutputQueue-usage] */
+GL::Renderer::enable(GL::Renderer::Feature::DebugOutput);
+
+GL::DebugOutputQueue queue;
+queue.setDeduplicationInterval(5.0f)
+    .setRateLimit(100);
+queue.install();
+queue.start();
+
+// ...
+
+/* Report how much got filtered away */
+Debug{} << queue.suppressedCount() << "repeated messages suppressed";
+/* [DebugOutputQueue-usage] */
+}
+
 {
 /* [DebugMessage-usage] */
 GL::DebugMessage::insert(GL::DebugMessage::Source::Application,
@@ -1235,6 +1270,39 @@ GL::CompressedBufferImage2D image = texture.compressedSubImage(range, {},
 }
 #endif
 
+{
+/* [RenderPass-usage] */
+GL::RenderPass pass{GL::defaultFramebuffer};
+pass.setColorAttachment(0, GL::RenderPassLoadAction::Clear,
+                           GL::RenderPassStoreAction::Store, 0x1f1f1f_rgbf)
+    .setDepthAttachment(GL::RenderPassLoadAction::Clear,
+                        GL::RenderPassStoreAction::DontCare);
+
+// each frame
+pass.begin();
+// draw the scene ...
+pass.end();
+/* [RenderPass-usage] */
+}
+
+#if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
+{
+GL::Framebuffer multisample{NoCreate};
+/* [RenderPass-multisample] */
+GL::RenderPass pass{multisample};
+pass.setColorAttachment(0, GL::RenderPassLoadAction::Clear,
+                           GL::RenderPassStoreAction::DontCare)
+    .setDepthAttachment(GL::RenderPassLoadAction::Clear,
+                        GL::RenderPassStoreAction::DontCare)
+    .setResolveFramebuffer(GL::defaultFramebuffer);
+
+pass.begin();
+// draw the scene ...
+pass.end(); // blits to the default framebuffer, discards the samples
+/* [RenderPass-multisample] */
+}
+#endif
+
 #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
 {
 /* [SampleQuery-usage] */
@@ -1495,4 +1563,28 @@ static_cast<void>(timeElapsed2);
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES2
+{
+Matrix4 transformationProjection;
+Vector3 cameraPosition;
+/* [VolumeBrickCache-usage] */
+Containers::Optional<Containers::Array<char>> file = Trade::mapFile("volume.blob");
+if(!file) Fatal{} << "Can't map volume.blob";
+Containers::Optional<Trade::VolumeBlob> blob = Trade::VolumeBlob::deserialize(*file);
+if(!blob) Fatal{} << "Invalid volume blob";
+
+/* An atlas of 8x8x8 bricks, only a small part of the whole volume */
+GL::VolumeBrickCache cache{GL::TextureFormat::R8, blob->storedBrickSize(),
+    blob->brickCount(), {8, 8, 8}};
+
+// each frame ...
+std::vector<UnsignedInt> visible = GL::VolumeBrickCache::visibleBricks(
+    blob->brickCount(), transformationProjection, cameraPosition);
+cache.update(visible, [](UnsignedInt brick, void* blob) {
+    return static_cast<Trade::VolumeBlob*>(blob)->brick(brick);
+}, &*blob);
+/* [VolumeBrickCache-usage] */
+}
+#endif
+
 }
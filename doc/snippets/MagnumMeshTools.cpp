@@ -29,7 +29,9 @@
 #include "Magnum/MeshTools/CombineIndexedArrays.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/GenerateBarycentrics.h"
 #include "Magnum/MeshTools/GenerateFlatNormals.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
 #include "Magnum/MeshTools/Interleave.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Transform.h"
@@ -100,6 +102,52 @@ std::vector<UnsignedInt> indices = MeshTools::combineIndexedArrays(
 /* [generateFlatNormals-recombine] */
 }
 
+{
+/* [generateSmoothNormalsInto] */
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+    Vector2 textureCoordinates;
+};
+
+std::vector<UnsignedInt> indices;
+std::vector<Vertex> vertices;
+
+MeshTools::generateSmoothNormalsInto(indices,
+    Containers::StridedArrayView<const Vector3>{&vertices[0].position, vertices.size(), sizeof(Vertex)},
+    Containers::StridedArrayView<Vector3>{&vertices[0].normal, vertices.size(), sizeof(Vertex)});
+/* [generateSmoothNormalsInto] */
+}
+
+{
+/* [generateSmoothNormals-crease] */
+std::vector<UnsignedInt> vertexIndices;
+std::vector<Vector3> positions;
+
+std::vector<UnsignedInt> normalIndices;
+std::vector<Vector3> normals;
+std::tie(normalIndices, normals) =
+    MeshTools::generateSmoothNormals(vertexIndices, positions, 30.0_degf);
+
+std::vector<UnsignedInt> indices = MeshTools::combineIndexedArrays(
+    std::make_pair(std::cref(vertexIndices), std::ref(positions)),
+    std::make_pair(std::cref(normalIndices), std::ref(normals)));
+/* [generateSmoothNormals-crease] */
+}
+
+{
+/* [generateBarycentrics] */
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<UnsignedInt> vertexMapping;
+std::vector<Math::Vector3<UnsignedByte>> barycentrics;
+std::tie(indices, vertexMapping, barycentrics) =
+    MeshTools::generateBarycentrics(indices, positions.size());
+positions = MeshTools::duplicate(vertexMapping, positions);
+/* [generateBarycentrics] */
+}
+
 {
 struct MyShader {
     typedef GL::Attribute<0, Vector3> Position;
@@ -128,6 +176,24 @@ auto data = MeshTools::interleave(positions, weights, 2, vertexColors, 1);
 /* [interleave2] */
 }
 
+{
+/* [interleaveInto-mapped] */
+std::vector<Vector3> positions, normals;
+std::vector<Vector2> textureCoordinates;
+
+/* 12 bytes position, 6 + 2 bytes normal, 4 bytes texture coordinates */
+const std::size_t stride = 24;
+GL::Buffer vertexBuffer;
+vertexBuffer.setData({nullptr, positions.size()*stride}, GL::BufferUsage::StaticDraw);
+MeshTools::interleaveInto(
+    vertexBuffer.map(0, positions.size()*stride, GL::Buffer::MapFlag::Write|GL::Buffer::MapFlag::InvalidateBuffer),
+    positions,
+    MeshTools::packAttribute<Math::Vector3<Short>>(normals), 2,
+    MeshTools::packHalfAttribute(textureCoordinates));
+vertexBuffer.unmap();
+/* [interleaveInto-mapped] */
+}
+
 {
 /* [removeDuplicates1] */
 std::vector<UnsignedInt> indices;
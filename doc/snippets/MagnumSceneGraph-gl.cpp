@@ -35,6 +35,7 @@
 #include "Magnum/SceneGraph/AnimableGroup.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/DualQuaternionTransformation.h"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Object.h"
@@ -236,5 +237,29 @@ new RedCubeDrawable{*redCube, &drawables};
     .rotateX(30.0_degf);
 /* [Drawable-usage-instance-multiple-inheritance] */
 
+#ifndef MAGNUM_TARGET_GLES2
+{
+SceneGraph::Scene<SceneGraph::DualQuaternionTransformation> scene;
+std::vector<std::reference_wrapper<SceneGraph::AbstractObject3D>> jointObjects;
+std::vector<DualQuaternion> inverseBindTransformations;
+GL::Mesh mesh;
+/* [Phong-usage-skinning-dual-quaternion] */
+std::vector<DualQuaternion> joints(jointObjects.size());
+scene.transformations({jointObjects.data(), jointObjects.size()},
+                      {joints.data(), joints.size()});
+for(std::size_t i = 0; i != joints.size(); ++i)
+    joints[i] = joints[i]*inverseBindTransformations[i];
+
+GL::Buffer jointBuffer;
+jointBuffer.setData({joints.data(), joints.size()}, GL::BufferUsage::DynamicDraw);
+
+Shaders::Phong shader{Shaders::Phong::Flag::DualQuaternionSkinning, 1,
+    UnsignedInt(joints.size())};
+shader.bindJointBuffer(jointBuffer);
+mesh.draw(shader);
+/* [Phong-usage-skinning-dual-quaternion] */
+}
+#endif
+
 return 0; /* on iOS SDL redefines main to SDL_main and then return is needed */
 }
@@ -25,6 +25,9 @@
 
 #include <algorithm>
 
+#include "Magnum/Timeline.h"
+#include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/Pose.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/Animable.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
@@ -36,6 +39,7 @@
 #include "Magnum/SceneGraph/Drawable.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/TranslationRotationScalingTransformation3D.h"
 
 using namespace Magnum;
 using namespace Magnum::Math::Literals;
@@ -349,4 +353,28 @@ camera.draw(drawableTransformations);
 /* [Drawable-draw-order] */
 }
 
+{
+/* [Pose-usage] */
+typedef SceneGraph::Object<SceneGraph::TranslationRotationScalingTransformation3D> Object3D;
+
+const Animation::TrackView<Float, Quaternion> walkRotations[32];
+const Animation::TrackView<Float, Quaternion> runRotations[32];
+Object3D* bones[32];
+
+/* Each clip writes into its own pose */
+Animation::Pose walk{32}, run{32}, result{32};
+Animation::Player<Float> walkPlayer, runPlayer;
+walkPlayer.addBatch(Containers::arrayView(walkRotations), walk.rotations());
+runPlayer.addBatch(Containers::arrayView(runRotations), run.rotations());
+
+// every frame
+Timeline timeline;
+Float speed{};
+walkPlayer.advance(timeline.previousFrameTime());
+runPlayer.advance(timeline.previousFrameTime());
+Animation::blend(walk, run, speed, result);
+Animation::applyPose<Object3D>(result, bones);
+/* [Pose-usage] */
+}
+
 }
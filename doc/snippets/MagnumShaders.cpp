@@ -23,7 +23,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <cstring>
 #include <numeric>
+#include <vector>
 #include <Corrade/Containers/Array.h>
 
 #include "Magnum/GL/Buffer.h"
@@ -32,10 +35,12 @@
 #include "Magnum/GL/Texture.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/GenerateBarycentrics.h"
 #include "Magnum/Shaders/DistanceFieldVector.h"
 #include "Magnum/Shaders/Flat.h"
 #include "Magnum/Shaders/MeshVisualizer.h"
 #include "Magnum/Shaders/Phong.h"
+#include "Magnum/Shaders/ShaderCache.h"
 #include "Magnum/Shaders/Vector.h"
 #include "Magnum/Shaders/VertexColor.h"
 
@@ -203,6 +208,33 @@ mesh.draw(shader);
 /* [Flat-usage-textured2] */
 }
 
+{
+GL::Mesh mesh;
+Matrix4 projectionMatrix;
+/* [Flat-usage-instancing] */
+struct Instance {
+    Matrix4 transformation;
+    Color3 color;
+};
+Instance instanceData[1000]{
+    // ...
+};
+
+GL::Buffer instances;
+instances.setData(instanceData, GL::BufferUsage::StaticDraw);
+mesh.addVertexBufferInstanced(instances, 1, 0,
+        Shaders::Flat3D::TransformationMatrix{},
+        Shaders::Flat3D::Color3{})
+    .setInstanceCount(Containers::arraySize(instanceData));
+
+Shaders::Flat3D shader{Shaders::Flat3D::Flag::InstancedTransformation|
+                       Shaders::Flat3D::Flag::VertexColor};
+shader.setTransformationProjectionMatrix(projectionMatrix);
+
+mesh.draw(shader);
+/* [Flat-usage-instancing] */
+}
+
 {
 /* [MeshVisualizer-usage-geom1] */
 struct Vertex {
@@ -278,6 +310,50 @@ mesh.addVertexBuffer(vertices, 0, Shaders::MeshVisualizer::Position{});
 /* [MeshVisualizer-usage-no-geom] */
 }
 
+{
+/* [MeshVisualizer-usage-barycentric] */
+std::vector<UnsignedInt> indices{
+    // ...
+};
+std::vector<Vector3> positions{
+    // ...
+};
+
+/* Duplicating only vertices that need a different barycentric coordinate */
+std::vector<UnsignedInt> vertexMapping;
+std::vector<Math::Vector3<UnsignedByte>> barycentrics;
+std::tie(indices, vertexMapping, barycentrics) =
+    MeshTools::generateBarycentrics(indices, positions.size());
+
+GL::Buffer vertices, barycentricBuffer, indexBuffer;
+vertices.setData(MeshTools::duplicate(vertexMapping, positions),
+                 GL::BufferUsage::StaticDraw);
+barycentricBuffer.setData(barycentrics, GL::BufferUsage::StaticDraw);
+indexBuffer.setData(indices, GL::BufferUsage::StaticDraw);
+
+GL::Mesh mesh;
+mesh.setCount(indices.size())
+    .addVertexBuffer(vertices, 0, Shaders::MeshVisualizer::Position{})
+    .addVertexBuffer(barycentricBuffer, 0, Shaders::MeshVisualizer::Barycentric{
+        Shaders::MeshVisualizer::Barycentric::DataType::UnsignedByte,
+        Shaders::MeshVisualizer::Barycentric::DataOption::Normalized})
+    .setIndexBuffer(indexBuffer, 0, MeshIndexType::UnsignedInt);
+/* [MeshVisualizer-usage-barycentric] */
+
+/* [MeshVisualizer-usage-barycentric2] */
+Matrix4 transformationMatrix, projectionMatrix;
+
+Shaders::MeshVisualizer shader{Shaders::MeshVisualizer::Flag::Wireframe|
+                               Shaders::MeshVisualizer::Flag::NoGeometryShader|
+                               Shaders::MeshVisualizer::Flag::BarycentricAttribute};
+shader.setColor(0x2f83cc_rgbf)
+    .setWireframeColor(0xdcdcdc_rgbf)
+    .setTransformationProjectionMatrix(projectionMatrix*transformationMatrix);
+
+mesh.draw(shader);
+/* [MeshVisualizer-usage-barycentric2] */
+}
+
 #if !defined(__GNUC__) || defined(__clang__) || __GNUC__*100 + __GNUC_MINOR__ >= 500
 {
 /* [Phong-usage-colored1] */
@@ -365,6 +441,139 @@ shader.bindTextures(&diffuseAlphaTexture, &diffuseAlphaTexture, nullptr)
 /* [Phong-usage-alpha] */
 }
 
+#ifndef MAGNUM_TARGET_GLES
+{
+GL::Mesh mesh;
+GL::Texture2D diffuseTexture;
+/* [Phong-usage-bindless] */
+UnsignedLong diffuse = diffuseTexture.handle();
+GL::AbstractTexture::makeHandleResident(diffuse);
+
+Shaders::Phong shader{Shaders::Phong::Flag::DiffuseTexture|
+                      Shaders::Phong::Flag::BindlessTextures};
+shader.setDiffuseTextureHandle(diffuse);
+mesh.draw(shader);
+/* [Phong-usage-bindless] */
+}
+#endif
+
+{
+GL::Mesh mesh;
+Matrix4 transformationMatrix, projectionMatrix;
+/* [Phong-usage-instancing] */
+struct Instance {
+    Matrix4 transformation;
+    Matrix3x3 normal;
+    Color3 color;
+};
+Instance instanceData[1000]{
+    // ...
+};
+
+GL::Buffer instances;
+instances.setData(instanceData, GL::BufferUsage::StaticDraw);
+mesh.addVertexBufferInstanced(instances, 1, 0,
+        Shaders::Phong::TransformationMatrix{},
+        Shaders::Phong::NormalMatrix{},
+        Shaders::Phong::Color3{})
+    .setInstanceCount(Containers::arraySize(instanceData));
+
+Shaders::Phong shader{Shaders::Phong::Flag::InstancedTransformation|
+                      Shaders::Phong::Flag::VertexColor};
+shader.setTransformationMatrix(transformationMatrix)
+    .setNormalMatrix(transformationMatrix.rotationScaling())
+    .setProjectionMatrix(projectionMatrix);
+
+mesh.draw(shader);
+/* [Phong-usage-instancing] */
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+{
+std::vector<GL::Mesh> meshes;
+std::vector<Matrix4> transformations;
+Matrix4 projectionMatrix;
+GL::Buffer lights;
+/* [Phong-usage-uniform-buffers] */
+/* Pad each per-draw transformation to the required offset alignment */
+const std::size_t stride = std::max(std::size_t(GL::Buffer::uniformOffsetAlignment()),
+                                    sizeof(Shaders::Phong::TransformationUniform));
+Containers::Array<char> data{Containers::ValueInit, stride*meshes.size()};
+for(std::size_t i = 0; i != meshes.size(); ++i) {
+    Shaders::Phong::TransformationUniform transformation;
+    transformation.transformationMatrix = transformations[i];
+    transformation.setNormalMatrix(transformations[i].rotationScaling());
+    std::memcpy(data + i*stride, &transformation, sizeof(transformation));
+}
+
+Shaders::Phong::ProjectionUniform projection{projectionMatrix};
+Shaders::Phong::MaterialUniform material;
+GL::Buffer projectionBuffer, transformationBuffer, materialBuffer;
+projectionBuffer.setData(Containers::arrayView(&projection, 1), GL::BufferUsage::StaticDraw);
+transformationBuffer.setData(data, GL::BufferUsage::DynamicDraw);
+materialBuffer.setData(Containers::arrayView(&material, 1), GL::BufferUsage::StaticDraw);
+
+Shaders::Phong shader{Shaders::Phong::Flag::UniformBuffers};
+shader.bindProjectionBuffer(projectionBuffer)
+    .bindMaterialBuffer(materialBuffer)
+    .bindLightBuffer(lights);
+
+for(std::size_t i = 0; i != meshes.size(); ++i) {
+    shader.bindTransformationBuffer(transformationBuffer, i*stride,
+        sizeof(Shaders::Phong::TransformationUniform));
+    meshes[i].draw(shader);
+}
+/* [Phong-usage-uniform-buffers] */
+}
+
+{
+GL::Buffer vertices;
+std::vector<Matrix4> jointMatrices;
+/* [Phong-usage-skinning] */
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+    Vector4ui jointIds;
+    Vector4 weights;
+};
+
+GL::Mesh mesh;
+mesh.addVertexBuffer(vertices, 0,
+    Shaders::Phong::Position{},
+    Shaders::Phong::Normal{},
+    Shaders::Phong::JointIds{},
+    Shaders::Phong::Weights{});
+
+GL::Buffer joints;
+joints.setData(jointMatrices, GL::BufferUsage::DynamicDraw);
+
+Shaders::Phong shader{Shaders::Phong::Flag::Skinning, 1, UnsignedInt(jointMatrices.size())};
+shader.bindJointBuffer(joints);
+
+mesh.draw(shader);
+/* [Phong-usage-skinning] */
+}
+#endif
+
+{
+GL::Mesh mesh;
+GL::Texture2D diffuseTexture;
+Matrix4 transformationMatrix, projectionMatrix;
+/* [ShaderCache-usage] */
+Shaders::ShaderCache shaders;
+
+// ...
+
+/* Compiled only the first time, returns the same instance afterwards */
+Shaders::Phong& shader = shaders.phong(Shaders::Phong::Flag::DiffuseTexture, 2);
+shader.bindDiffuseTexture(diffuseTexture)
+    .setTransformationMatrix(transformationMatrix)
+    .setNormalMatrix(transformationMatrix.rotationScaling())
+    .setProjectionMatrix(projectionMatrix);
+mesh.draw(shader);
+/* [ShaderCache-usage] */
+}
+
 #if !defined(__GNUC__) || defined(__clang__) || __GNUC__*100 + __GNUC_MINOR__ >= 500
 {
 /* [Vector-usage1] */
@@ -97,4 +97,30 @@ renderer.mesh().draw(shader);
 /* [Renderer-usage2] */
 }
 
+{
+Matrix3 projectionMatrix;
+std::unique_ptr<Text::AbstractFont> font;
+Text::GlyphCache cache{Vector2i{512}};
+struct Label {
+    std::string text;
+    Vector2 position;
+    Color4 color;
+};
+std::vector<Label> labels;
+/* [BatchRenderer-usage] */
+Text::BatchRenderer2D renderer{*font, cache, 0.15f, Text::Alignment::LineCenter};
+
+/* Lay out all labels and upload them in one go */
+for(const Label& label: labels)
+    renderer.add(label.text, Matrix3::translation(label.position), label.color);
+renderer.update();
+
+/* Draw all of them with a single draw call */
+Shaders::Vector2D shader{Shaders::Vector2D::Flag::VertexColor};
+shader.setTransformationProjectionMatrix(projectionMatrix)
+    .bindVectorTexture(cache.texture());
+renderer.mesh().draw(shader);
+/* [BatchRenderer-usage] */
+}
+
 }
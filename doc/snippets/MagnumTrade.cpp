@@ -23,22 +23,31 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstdio>
 #include <unordered_map>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Animation/Player.h"
 #include "Magnum/MeshTools/Transform.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
 #include "Magnum/Trade/ObjectData2D.h"
 #include "Magnum/Trade/ObjectData3D.h"
 #include "Magnum/Trade/PhongMaterialData.h"
+#include "Magnum/Trade/VolumeBlob.h"
 #ifdef MAGNUM_TARGET_GL
 #include "Magnum/GL/Texture.h"
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/BufferImage.h"
+#endif
 #endif
 
 using namespace Magnum;
@@ -109,6 +118,31 @@ if(data && data->type() == Trade::MaterialType::Phong) {
 static_cast<void>(shininess);
 }
 
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+std::unique_ptr<Trade::AbstractImporter> importer;
+GL::Texture2D texture;
+/* [AbstractImporter-image2DInto] */
+GL::Buffer pixels;
+Containers::Optional<Trade::ImageData2D> image = importer->image2DInto(0,
+    [](std::size_t size, void* userData) {
+        GL::Buffer& pixels = *static_cast<GL::Buffer*>(userData);
+        pixels.setData({nullptr, size}, GL::BufferUsage::StaticDraw);
+        return pixels.map(0, size, GL::Buffer::MapFlag::Write|
+                                   GL::Buffer::MapFlag::InvalidateBuffer);
+    }, &pixels);
+pixels.unmap();
+if(!image) Fatal{} << "Importing the image failed";
+
+/* The image data now live in the buffer, upload from there */
+std::size_t dataSize = image->data().size();
+GL::BufferImage2D bufferImage{image->storage(), image->format(), image->size(),
+    std::move(pixels), dataSize};
+texture.setSubImage(0, {}, bufferImage);
+/* [AbstractImporter-image2DInto] */
+}
+#endif
+
 {
 std::unique_ptr<Trade::AbstractImporter> importer;
 /* [AbstractImporter-setFileCallback] */
@@ -142,6 +176,39 @@ importer->setFileCallback([](const std::string& filename,
 /* [AbstractImporter-setFileCallback-template] */
 }
 
+{
+std::unique_ptr<Trade::AbstractImageConverter> converter;
+ImageView2D image{PixelFormat::RGBA8Unorm, {}, nullptr};
+/* [AbstractImageConverter-exportToSink] */
+std::FILE* file = std::fopen("screenshot.tga", "wb");
+bool written = converter->exportToSink(image,
+    [](Containers::ArrayView<const char> data, void* file) {
+        return std::fwrite(data.data(), 1, data.size(),
+            static_cast<std::FILE*>(file)) == data.size();
+    }, file);
+std::fclose(file);
+/* [AbstractImageConverter-exportToSink] */
+static_cast<void>(written);
+}
+
+{
+Containers::Array<char> raw;
+/* [VolumeBlob-usage] */
+/* A 512x512x512 volume split into 32x32x32 bricks with a one-voxel border */
+ImageView3D volume{PixelFormat::R8Unorm, {512, 512, 512}, raw};
+Containers::Array<char> data = Trade::VolumeBlob::serialize(volume, {32, 32, 32}, 1);
+
+// ...
+
+Containers::Optional<Trade::VolumeBlob> blob = Trade::VolumeBlob::deserialize(data);
+if(!blob) Fatal{} << "Invalid volume blob";
+
+/* A 34x34x34 image of the brick at the volume center */
+ImageView3D brick = blob->brick(blob->brickCount()/2);
+/* [VolumeBlob-usage] */
+static_cast<void>(brick);
+}
+
 {
 UnsignedInt id{};
 std::unique_ptr<Trade::AbstractImporter> importer;
@@ -197,6 +264,23 @@ else
 }
 #endif
 
+{
+std::unique_ptr<Trade::AbstractImporter> importer;
+/* [MeshData-usage] */
+Containers::Optional<Trade::MeshData> data = importer->mesh(0);
+if(!data) Fatal{} << "Can't import the mesh";
+
+/* Direct access to the vertex data in whatever format they are stored in */
+Containers::StridedArrayView<const Vector3> positions =
+    data->attribute<Vector3>(Trade::MeshAttribute::Position);
+
+/* Converted to floats regardless of the storage format */
+std::vector<Vector3> normals = data->normalsAsArray();
+/* [MeshData-usage] */
+static_cast<void>(positions);
+static_cast<void>(normals);
+}
+
 {
 Trade::MeshData2D& foo();
 Trade::MeshData2D& data = foo();
@@ -84,6 +84,8 @@
 #  GlxContext                   - GLX context
 #  WglContext                   - WGL context
 #  OpenGLTester                 - OpenGLTester class
+#  DdsImageConverter            - DDS image converter plugin
+#  DdsImporter                  - DDS importer plugin
 #  MagnumFont                   - Magnum bitmap font plugin
 #  MagnumFontConverter          - Magnum bitmap font converter plugin
 #  ObjImporter                  - OBJ importer plugin
@@ -129,6 +131,10 @@
 #  MAGNUM_BUILD_STATIC          - Defined if compiled as static libraries
 #  MAGNUM_BUILD_MULTITHREADED   - Defined if compiled in a way that allows
 #   having multiple thread-local Magnum contexts
+#  MAGNUM_BUILD_INSTRUMENTATION - Defined if compiled with instrumentation
+#   points in library hot paths
+#  MAGNUM_BUILD_MATH_SIMD       - Defined if compiled with SIMD
+#   specializations of hot Math operations
 #  MAGNUM_TARGET_GL             - Defined if compiled with OpenGL interop
 #  MAGNUM_TARGET_GLES           - Defined if compiled for OpenGL ES
 #  MAGNUM_TARGET_GLES2          - Defined if compiled for OpenGL ES 2.0
@@ -259,6 +265,8 @@ set(_magnumFlags
     BUILD_DEPRECATED
     BUILD_STATIC
     BUILD_MULTITHREADED
+    BUILD_INSTRUMENTATION
+    BUILD_MATH_SIMD
     TARGET_GL
     TARGET_GLES
     TARGET_GLES2
@@ -335,6 +343,12 @@ if(NOT TARGET Magnum::Magnum)
     # Dependent libraries
     set_property(TARGET Magnum::Magnum APPEND PROPERTY INTERFACE_LINK_LIBRARIES
          Corrade::Utility)
+    # Animation::PlayerGroup uses threads
+    if(NOT CORRADE_TARGET_EMSCRIPTEN)
+        find_package(Threads REQUIRED)
+        set_property(TARGET Magnum::Magnum APPEND PROPERTY
+            INTERFACE_LINK_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+    endif()
 else()
     set(MAGNUM_LIBRARY Magnum::Magnum)
 endif()
@@ -354,8 +368,8 @@ if(MAGNUM_BUILD_DEPRECATED)
 endif()
 set(_MAGNUM_PLUGIN_COMPONENT_LIST
     AnyAudioImporter AnyImageConverter AnyImageImporter AnySceneImporter
-    MagnumFont MagnumFontConverter ObjImporter TgaImageConverter TgaImporter
-    WavAudioImporter)
+    DdsImageConverter DdsImporter MagnumFont MagnumFontConverter ObjImporter
+    TgaImageConverter TgaImporter WavAudioImporter)
 set(_MAGNUM_EXECUTABLE_COMPONENT_LIST
     distancefieldconverter fontconverter imageconverter gl-info al-info)
 
@@ -408,6 +422,10 @@ elseif(CORRADE_TARGET_WINDOWS)
 endif()
 
 set(_MAGNUM_Primitives_DEPENDENCIES Trade)
+if(MAGNUM_TARGET_GL)
+    # MeshCache compiles the generated meshes to GL
+    list(APPEND _MAGNUM_Primitives_DEPENDENCIES MeshTools GL)
+endif()
 set(_MAGNUM_SceneGraph_DEPENDENCIES )
 set(_MAGNUM_Shaders_DEPENDENCIES GL)
 if(MAGNUM_BUILD_DEPRECATED)
@@ -808,8 +826,19 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
                 INTERFACE_INCLUDE_DIRECTORIES ${OPENAL_INCLUDE_DIR})
             set_property(TARGET Magnum::${_component} APPEND PROPERTY
                 INTERFACE_LINK_LIBRARIES ${OPENAL_LIBRARY} Corrade::PluginManager)
+            if(NOT CORRADE_TARGET_EMSCRIPTEN)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+            endif()
 
-        # No special setup for DebugTools library
+        # DebugTools library
+        elseif(_component STREQUAL DebugTools)
+            if(NOT CORRADE_TARGET_EMSCRIPTEN)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+            endif()
 
         # GL library
         elseif(_component STREQUAL GL)
@@ -850,6 +879,11 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # MeshTools library
         elseif(_component STREQUAL MeshTools)
             set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES CompressIndices.h)
+            if(NOT CORRADE_TARGET_EMSCRIPTEN)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+            endif()
 
         # OpenGLTester library
         elseif(_component STREQUAL OpenGLTester)
@@ -859,7 +893,14 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         elseif(_component STREQUAL Primitives)
             set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES Cube.h)
 
-        # No special setup for SceneGraph library
+        # SceneGraph library
+        elseif(_component STREQUAL SceneGraph)
+            if(NOT CORRADE_TARGET_EMSCRIPTEN)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+            endif()
+
         # No special setup for Shaders library
         # No special setup for Shapes library
 
@@ -889,6 +930,8 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # No special setup for AnyImageConverter plugin
         # No special setup for AnyImageImporter plugin
         # No special setup for AnySceneImporter plugin
+        # No special setup for DdsImageConverter plugin
+        # No special setup for DdsImporter plugin
         # No special setup for MagnumFont plugin
         # No special setup for MagnumFontConverter plugin
         # No special setup for ObjImporter plugin
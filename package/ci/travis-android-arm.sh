@@ -60,6 +60,8 @@ cmake .. \
     -DWITH_ANYIMAGECONVERTER=ON \
     -DWITH_ANYIMAGEIMPORTER=ON \
     -DWITH_ANYSCENEIMPORTER=ON \
+    -DWITH_DDSIMAGECONVERTER=ON \
+    -DWITH_DDSIMPORTER=ON \
     -DWITH_MAGNUMFONT=ON \
     -DWITH_MAGNUMFONTCONVERTER=ON \
     -DWITH_OBJIMPORTER=ON \
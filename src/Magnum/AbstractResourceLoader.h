@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::AbstractResourceLoader
  */
 
+#include <atomic>
 #include <string>
 
 #include "Magnum/ResourceManager.h"
@@ -58,7 +59,8 @@ loading progress (which is then available through functions @ref requestedCount(
 
 In your @ref doLoad() implementation, after your resources are loaded, call
 @ref set() to pass them to @ref ResourceManager or call @ref setNotFound() to
-indicate that the resource was not found.
+indicate that the resource was not found. See
+@ref AbstractResourceLoader-async for calling these from other threads.
 
 You can also implement @ref doName() to provide meaningful names for resource
 keys.
@@ -99,6 +101,37 @@ manager->setLoader(&loader);
 Resource<Mesh> myMesh = manager->get<Mesh>("my-mesh");
 @endcode
 
+@section AbstractResourceLoader-async Asynchronous loading
+
+The @ref set() and @ref setNotFound() functions can be called from any thread.
+The data are not put into the manager directly, instead they're published to
+a lock-free list of pending updates, which the manager applies in the order
+they were published on the next access from the thread owning it --- either
+through the manager itself or when a @ref Resource that isn't
+@ref ResourceState::Final checks for updates. Until then the resource stays in
+the @ref ResourceState::Loading state. When nothing is pending, the check adds
+only a single atomic load to the access.
+
+@code{.cpp}
+class AsyncMeshResourceLoader: public AbstractResourceLoader<Mesh> {
+    void doLoad(ResourceKey key) override {
+        _workers.push_back(std::thread{[this, key]() {
+            // Load the mesh...
+
+            set(key, mesh, ResourceDataState::Final, ResourcePolicy::Resident);
+        }});
+    }
+
+    std::vector<std::thread> _workers;
+};
+@endcode
+
+Everything else, including @ref load() and all @ref ResourceManager and
+@ref Resource functions, still has to be called from the thread owning the
+manager. The loader is expected to wait for its threads to finish before it's
+destroyed. Updates that were published but not yet applied when the manager is
+destroyed are deleted together with it.
+
 @todoc How about working with resources of different data types (i.e. mesh
     buffers), should that be allowed?
 */
@@ -159,14 +192,15 @@ template<class T> class AbstractResourceLoader {
          * Also increments count of loaded resources. Parameter @p state must
          * be either @ref ResourceDataState::Mutable or
          * @ref ResourceDataState::Final. See @ref ResourceManager::set() for
-         * more information.
+         * more information. Can be called from any thread, see
+         * @ref AbstractResourceLoader-async for more information.
          * @see @ref loadedCount()
          */
-        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy);
+        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0);
 
         /** @overload */
-        template<class U> void set(ResourceKey key, U&& data, ResourceDataState state, ResourcePolicy policy) {
-            set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy);
+        template<class U> void set(ResourceKey key, U&& data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0) {
+            set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy, size);
         }
 
         /**
@@ -188,7 +222,9 @@ template<class T> class AbstractResourceLoader {
          * @brief Mark resource as not found
          *
          * Also increments count of not found resources. See also
-         * @ref ResourceManager::set() for more information.
+         * @ref ResourceManager::set() for more information. Can be called
+         * from any thread, see @ref AbstractResourceLoader-async for more
+         * information.
          * @see @ref notFoundCount()
          */
         void setNotFound(ResourceKey key);
@@ -218,8 +254,8 @@ template<class T> class AbstractResourceLoader {
         #endif
 
         Implementation::ResourceManagerData<T>* manager;
-        std::size_t _requestedCount,
-            _loadedCount,
+        std::size_t _requestedCount;
+        std::atomic<std::size_t> _loadedCount,
             _notFoundCount;
 };
 
@@ -232,22 +268,22 @@ template<class T> std::string AbstractResourceLoader<T>::doName(ResourceKey) con
 template<class T> void AbstractResourceLoader<T>::load(ResourceKey key) {
     ++_requestedCount;
     /** @todo What policy for loading resources? */
-    manager->set(key, nullptr, ResourceDataState::Loading, ResourcePolicy::Resident);
+    manager->set(key, nullptr, ResourceDataState::Loading, ResourcePolicy::Resident, 0);
 
     doLoad(key);
 }
 
-template<class T> void AbstractResourceLoader<T>::set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy) {
+template<class T> void AbstractResourceLoader<T>::set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, const std::size_t size) {
     CORRADE_ASSERT(state == ResourceDataState::Mutable || state == ResourceDataState::Final,
         "AbstractResourceLoader::set(): state must be either Mutable or Final", );
     ++_loadedCount;
-    manager->set(key, data, state, policy);
+    manager->publish(key, data, state, policy, size);
 }
 
 template<class T> inline void AbstractResourceLoader<T>::setNotFound(ResourceKey key) {
     ++_notFoundCount;
     /** @todo What policy for notfound resources? */
-    manager->set(key, nullptr, ResourceDataState::NotFound, ResourcePolicy::Resident);
+    manager->publish(key, nullptr, ResourceDataState::NotFound, ResourcePolicy::Resident, 0);
 }
 
 }
@@ -0,0 +1,349 @@
+#ifndef Magnum_AbstractStreamingResourceLoader_h
+#define Magnum_AbstractStreamingResourceLoader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::AbstractStreamingResourceLoader
+ */
+
+#include <mutex>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/AbstractResourceLoader.h"
+
+namespace Magnum {
+
+/**
+@brief Base for progressive resource loaders
+
+Loads resources in multiple levels of increasing quality --- for example
+texture mip levels from the smallest one or mesh LODs from the coarsest one
+--- on worker threads and uploads them on the thread owning the
+@ref ResourceManager with a per-frame byte budget. Resources with higher
+priority are loaded and uploaded first.
+
+@section AbstractStreamingResourceLoader-usage Usage and subclassing
+
+The @p T template parameter is the resource type stored in the manager, @p U
+is the type of loaded data waiting for an upload, such as
+@ref Trade::ImageData2D. Subclassing is done by implementing
+@ref doLevelCount(), @ref doLoadLevel(), @ref doDataSize() and
+@ref doUpload(). Then, similarly to @ref AbstractResourceLoader, the loader is
+added to the manager using @ref ResourceManager::setLoader() and each
+@ref ResourceManager::get() of a resource that's not loaded yet queues its
+first level for loading.
+
+@code{.cpp}
+class TextureStreamer: public AbstractStreamingResourceLoader<GL::Texture2D, Trade::ImageData2D> {
+    UnsignedInt doLevelCount(ResourceKey key) override {
+        // Return mip level count of the texture or 0 if it doesn't exist
+    }
+
+    Trade::ImageData2D doLoadLevel(ResourceKey key, UnsignedInt level) override {
+        // Decode levels 0 to level of the texture, smallest first...
+    }
+
+    std::size_t doDataSize(const Trade::ImageData2D& image) override {
+        return image.data().size();
+    }
+
+    GL::Texture2D* doUpload(ResourceKey key, UnsignedInt level, Trade::ImageData2D& image) override {
+        // Create a texture from all levels decoded so far...
+    }
+};
+@endcode
+
+Every frame, the application updates priority of resources that are still
+streaming using @ref setPriority(), for example based on their
+@ref SceneGraph::Camera::projectedSize(), and calls @ref upload() with the
+amount of data it's willing to upload in the frame. Worker threads call
+@ref loadNext() to load the next level of the resource with the highest
+priority.
+
+@code{.cpp}
+// On the main thread, each frame
+for(Object3D* object: texturedObjects)
+    streamer.setPriority(object->textureKey(), camera.projectedSize(
+        camera.cameraMatrix().transformPoint(object->absoluteTransformation().translation()),
+        object->radius()));
+streamer.upload(4*1024*1024);
+
+// On each worker thread
+while(!exiting) if(!streamer.loadNext()) waitForWork();
+@endcode
+
+Each uploaded level replaces the previous one in the manager, all levels
+except the last are set as @ref ResourceDataState::Mutable so @ref Resource
+instances pick up the update. The last level is set as
+@ref ResourceDataState::Final. The resources are set with the policy passed
+to the constructor, by default @ref ResourcePolicy::Budgeted with the size
+returned by @ref doDataSize(), so together with
+@ref ResourceManager::setBudget() the resources that are not used anymore are
+unloaded once the memory runs out. Unloaded resources are streamed again when
+requested again.
+
+@section AbstractStreamingResourceLoader-threads Thread safety
+
+The @ref loadNext() function can be called from any number of threads at the
+same time, @ref doLoadLevel() is called from the calling thread without any
+lock held. All other functions, including @ref doLevelCount(),
+@ref doDataSize() and @ref doUpload(), are called from the thread owning the
+manager. The loader is expected to wait for the worker threads to finish
+before it's destroyed.
+*/
+template<class T, class U> class AbstractStreamingResourceLoader: public AbstractResourceLoader<T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param policy    Policy with which the loaded resources are set
+         *      to the manager
+         */
+        explicit AbstractStreamingResourceLoader(ResourcePolicy policy = ResourcePolicy::Budgeted): _policy{policy} {}
+
+        /**
+         * @brief Count of resources that are still streaming
+         *
+         * Resources that were requested but don't have their last level
+         * uploaded yet.
+         */
+        std::size_t streamingCount() const;
+
+        /**
+         * @brief Priority of given resource
+         *
+         * Returns @cpp 0.0f @ce if the resource is not streaming.
+         */
+        Float priority(ResourceKey key) const;
+
+        /**
+         * @brief Set priority of given resource
+         *
+         * Resources with higher priority are loaded and uploaded first, the
+         * initial priority is @cpp 0.0f @ce. Ignored if the resource is not
+         * streaming.
+         * @see @ref streamingCount()
+         */
+        void setPriority(ResourceKey key, Float priority);
+
+        /**
+         * @brief Load next level of the resource with the highest priority
+         *
+         * Picks the resource with the highest priority that doesn't have a
+         * level being loaded or waiting for upload and calls
+         * @ref doLoadLevel() for its next level. Returns @cpp false @ce if
+         * there's nothing to load. Can be called from any thread.
+         */
+        bool loadNext();
+
+        /**
+         * @brief Upload loaded levels
+         * @param byteBudget    Max amount of bytes to upload
+         * @return Amount of bytes uploaded
+         *
+         * Uploads loaded levels in order of their resource priority using
+         * @ref doUpload() while their total size returned by
+         * @ref doDataSize() fits into @p byteBudget and sets them to the
+         * manager. If the highest-priority level alone is larger than
+         * @p byteBudget, it's uploaded anyway so large levels don't get
+         * stuck forever.
+         */
+        std::size_t upload(std::size_t byteBudget);
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    private:
+    #else
+    protected:
+    #endif
+        /**
+         * @brief Level count of given resource
+         *
+         * Returns @cpp 0 @ce if the resource doesn't exist, it's then marked
+         * as not found. Called from the thread owning the manager.
+         */
+        virtual UnsignedInt doLevelCount(ResourceKey key) = 0;
+
+        /**
+         * @brief Load given level of a resource
+         *
+         * Level @cpp 0 @ce is the one with the lowest quality, the levels are
+         * loaded in order. Called from a thread calling @ref loadNext().
+         */
+        virtual U doLoadLevel(ResourceKey key, UnsignedInt level) = 0;
+
+        /**
+         * @brief Size of loaded data
+         *
+         * Used for the @ref upload() byte budget and passed to
+         * @ref ResourceManager::set(). Called from the thread owning the
+         * manager.
+         */
+        virtual std::size_t doDataSize(const U& data) = 0;
+
+        /**
+         * @brief Upload loaded data
+         *
+         * Returns the resource created from @p data. Called from the thread
+         * owning the manager.
+         */
+        virtual T* doUpload(ResourceKey key, UnsignedInt level, U& data) = 0;
+
+    private:
+        struct Request {
+            Request(): priority{}, level{}, levelCount{}, busy{} {}
+
+            Containers::Optional<U> data;
+            Float priority;
+            UnsignedInt level, levelCount;
+            /* Next level is being loaded or waits for an upload */
+            bool busy;
+        };
+
+        void doLoad(ResourceKey key) override final;
+
+        ResourcePolicy _policy;
+        mutable std::mutex _mutex;
+        Implementation::ResourceTable<Request> _requests;
+};
+
+template<class T, class U> std::size_t AbstractStreamingResourceLoader<T, U>::streamingCount() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _requests.size();
+}
+
+template<class T, class U> Float AbstractStreamingResourceLoader<T, U>::priority(const ResourceKey key) const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    const Request* const request = _requests.find(key);
+    return request ? request->priority : 0.0f;
+}
+
+template<class T, class U> void AbstractStreamingResourceLoader<T, U>::setPriority(const ResourceKey key, const Float priority) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if(Request* const request = _requests.find(key))
+        request->priority = priority;
+}
+
+template<class T, class U> void AbstractStreamingResourceLoader<T, U>::doLoad(const ResourceKey key) {
+    /* The resource got unloaded during streaming and is requested again,
+       continue with the level where it ended */
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if(_requests.find(key)) return;
+    }
+
+    const UnsignedInt levelCount = doLevelCount(key);
+    if(!levelCount) {
+        this->setNotFound(key);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    _requests[key].levelCount = levelCount;
+}
+
+template<class T, class U> bool AbstractStreamingResourceLoader<T, U>::loadNext() {
+    ResourceKey key;
+    UnsignedInt level;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        const Request* next = nullptr;
+        _requests.forEach([&key, &next](const ResourceKey requestKey, const Request& request) {
+            if(request.busy || (next && next->priority >= request.priority))
+                return;
+            key = requestKey;
+            next = &request;
+        });
+        if(!next) return false;
+
+        Request& request = *_requests.find(key);
+        request.busy = true;
+        level = request.level;
+    }
+
+    U data = doLoadLevel(key, level);
+
+    /* The table might have been rehashed in the meantime, find the request
+       again. As it's busy, it couldn't have been removed. */
+    std::lock_guard<std::mutex> lock{_mutex};
+    _requests.find(key)->data = std::move(data);
+    return true;
+}
+
+template<class T, class U> std::size_t AbstractStreamingResourceLoader<T, U>::upload(const std::size_t byteBudget) {
+    struct Upload {
+        ResourceKey key;
+        Float priority;
+        UnsignedInt level, levelCount;
+    };
+
+    /* Gather all loaded levels, highest priority first */
+    std::vector<Upload> uploads;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _requests.forEach([&uploads](const ResourceKey key, const Request& request) {
+            if(request.data)
+                uploads.push_back({key, request.priority, request.level, request.levelCount});
+        });
+    }
+    std::sort(uploads.begin(), uploads.end(), [](const Upload& a, const Upload& b) {
+        return a.priority > b.priority;
+    });
+
+    std::size_t uploaded = 0;
+    for(const Upload& upload: uploads) {
+        /* Take the data out and upload them without the lock held. The
+           request stays busy so other threads won't touch it. */
+        Containers::Optional<U> data;
+        std::size_t size;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            Request& request = *_requests.find(upload.key);
+            size = doDataSize(*request.data);
+            if(uploaded && uploaded + size > byteBudget) break;
+            data = std::move(request.data);
+            request.data = Containers::NullOpt;
+        }
+        uploaded += size;
+
+        T* const resource = doUpload(upload.key, upload.level, *data);
+        const bool last = upload.level + 1 == upload.levelCount;
+        this->set(upload.key, resource, last ? ResourceDataState::Final : ResourceDataState::Mutable, _policy, size);
+
+        std::lock_guard<std::mutex> lock{_mutex};
+        if(last) {
+            _requests.erase(upload.key);
+        } else {
+            Request& request = *_requests.find(upload.key);
+            request.busy = false;
+            ++request.level;
+        }
+    }
+
+    return uploaded;
+}
+
+}
+
+#endif
@@ -43,11 +43,16 @@ template<class V> using ResultOf = typename Implementation::ResultTraits<V>::Typ
 enum class Interpolation: UnsignedByte;
 enum class Extrapolation: UnsignedByte;
 
+template<class K> class Clip;
+template<class T, class K = T> class ClipPlayer;
+
 template<class T, class K = T> class Player;
+template<class T, class K = T> class PlayerGroup;
 
 template<class K, class V, class R = ResultOf<V>> class Track;
 template<class K> class TrackViewStorage;
 template<class K, class V, class R = ResultOf<V>> class TrackView;
+template<class K> class TrackIndex;
 
 }}
 
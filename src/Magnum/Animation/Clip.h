@@ -0,0 +1,328 @@
+#ifndef Magnum_Animation_Clip_h
+#define Magnum_Animation_Clip_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::Clip, @ref Magnum::Animation::ClipPlayer
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Animation/Player.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Shared animation clip
+
+Similar to @ref Player, but instead of binding the tracks to concrete
+destination locations, each track is bound to an offset relative to an output
+base pointer that's supplied later by a @ref ClipPlayer. A single clip can be
+then shared by any number of lightweight @ref ClipPlayer instances, each storing
+only its playback state, output pointer and keyframe hints. With many
+instances playing the same animation, the memory use then scales with the
+instance count and not with instance count times clip size, as would be the
+case with a @ref Player for each instance:
+
+@snippet MagnumAnimation.cpp Clip-usage
+
+Similarly to @ref Player, only the @ref TrackView instances are stored, the
+key and value data have to stay in scope for the whole lifetime of the clip.
+The clip has to stay in scope and unmodified for the whole lifetime of all
+@ref ClipPlayer instances referencing it --- @ref add() can be called only
+before the players are advanced for the first time.
+@experimental
+*/
+template<class K> class Clip {
+    public:
+        /** @brief Key type */
+        typedef K KeyType;
+
+        /** @brief Constructor */
+        explicit Clip();
+
+        /** @brief Copying is not allowed */
+        Clip(const Clip<K>&) = delete;
+
+        /** @brief Move constructor */
+        Clip(Clip<K>&&);
+
+        ~Clip();
+
+        /** @brief Copying is not allowed */
+        Clip<K>& operator=(const Clip<K>&) = delete;
+
+        /** @brief Move assignment */
+        Clip<K>& operator=(Clip<K>&&);
+
+        /**
+         * @brief Duration
+         *
+         * Combined duration of all added tracks. If no tracks are added,
+         * returns default-constructed value.
+         */
+        Math::Range1D<K> duration() const { return _duration; }
+
+        /**
+         * @brief Whether the clip is empty
+         *
+         * @see @ref size(), @ref add()
+         */
+        bool isEmpty() const { return _tracks.empty(); }
+
+        /**
+         * @brief Count of tracks in the clip
+         *
+         * @see @ref isEmpty(), @ref add()
+         */
+        std::size_t size() const { return _tracks.size(); }
+
+        /**
+         * @brief Track at given position
+         *
+         * Due to the type-erased nature of the clip implementation, it's not
+         * possible to know the exact track type.
+         */
+        const TrackViewStorage<K>& track(std::size_t i) const;
+
+        /**
+         * @brief Output offset of a track at given position
+         *
+         * @see @ref add()
+         */
+        std::size_t outputOffset(std::size_t i) const;
+
+        /**
+         * @brief Add a track with a result offset
+         *
+         * During each call to @ref ClipPlayer::advance(), as long as the
+         * animation is playing, the interpolated value is stored at
+         * @p outputOffset bytes from @ref ClipPlayer::output(). For a
+         * structure holding the animated values of one instance the offset
+         * is usually calculated with @cpp offsetof() @ce.
+         */
+        template<class V, class R> Clip<K>& add(const TrackView<K, V, R>& track, std::size_t outputOffset);
+
+        /** @overload
+         *
+         * Note that track ownership is *not* transferred to the @ref Clip
+         * and you have to ensure that it's kept in scope for the whole
+         * lifetime of the @ref Clip instance.
+         */
+        #ifndef CORRADE_MSVC2017_COMPATIBILITY
+        template<class V, class R> Clip<K>& add(const Track<K, V, R>& track, std::size_t outputOffset) {
+            return add(TrackView<K, V, R>{track}, outputOffset);
+        }
+        #else
+        /* See Player::add() for why this is needed */
+        template<class Track> Clip<K>& add(const Track& track, std::size_t outputOffset) {
+            return add<typename Track::ValueType, typename Track::ResultType>(static_cast<const TrackView<K, typename Track::ValueType, typename Track::ResultType>&>(track), outputOffset);
+        }
+        #endif
+
+    private:
+        template<class, class> friend class ClipPlayer;
+
+        struct Track;
+
+        Clip<K>& addInternal(const TrackViewStorage<K>& track, void(*advancer)(const TrackViewStorage<K>&, K, std::size_t&, void*), std::size_t outputOffset);
+
+        std::vector<Track> _tracks;
+        Math::Range1D<K> _duration;
+};
+
+/**
+@brief Player of a shared animation clip
+
+Plays a @ref Clip, writing the interpolated values to locations relative to
+@ref output(). Has the same playback semantics as @ref Player, but doesn't
+store any tracks, only a reference to the clip, the output pointer and one
+keyframe hint for each track. See @ref Clip for more information.
+@experimental
+*/
+template<class T, class K
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = T
+    #endif
+> class ClipPlayer {
+    public:
+        /** @brief Time type */
+        typedef T TimeType;
+
+        /** @brief Key type */
+        typedef K KeyType;
+
+        /**
+         * @brief Scaler function type
+         *
+         * Same as @ref Player::Scaler.
+         */
+        typedef typename Player<T, K>::Scaler Scaler;
+
+        /**
+         * @brief Constructor
+         * @param clip      Clip to play
+         * @param output    Output base pointer
+         *
+         * The @p clip is expected to stay in scope for the whole lifetime
+         * of the player.
+         */
+        explicit ClipPlayer(const Clip<K>& clip, void* output);
+
+        /**
+         * @brief Construct with a custom scaler function
+         * @param clip      Clip to play
+         * @param output    Output base pointer
+         * @param scaler    Scaler function
+         */
+        explicit ClipPlayer(const Clip<K>& clip, void* output, Scaler scaler);
+
+        /** @brief Copying is not allowed */
+        ClipPlayer(const ClipPlayer<T, K>&) = delete;
+
+        /** @brief Move constructor */
+        ClipPlayer(ClipPlayer<T, K>&&);
+
+        ~ClipPlayer();
+
+        /** @brief Copying is not allowed */
+        ClipPlayer<T, K>& operator=(const ClipPlayer<T, K>&) = delete;
+
+        /** @brief Move assignment */
+        ClipPlayer<T, K>& operator=(ClipPlayer<T, K>&&);
+
+        /** @brief Clip */
+        const Clip<K>& clip() const { return *_clip; }
+
+        /** @brief Output base pointer */
+        void* output() const { return _output; }
+
+        /**
+         * @brief Set output base pointer
+         *
+         * Can be changed at any time, for example when the instance data get
+         * reallocated.
+         */
+        ClipPlayer<T, K>& setOutput(void* output) {
+            _output = output;
+            return *this;
+        }
+
+        /** @brief Time-to-key scaler */
+        Scaler scaler() const { return _scaler; }
+
+        /** @brief Play count */
+        UnsignedInt playCount() const { return _playCount; }
+
+        /**
+         * @brief Set play count
+         *
+         * See @ref Player::setPlayCount() for more information.
+         */
+        ClipPlayer<T, K>& setPlayCount(UnsignedInt count) {
+            _playCount = count;
+            return *this;
+        }
+
+        /**
+         * @brief State
+         *
+         * The player is @ref State::Stopped by default.
+         */
+        State state() const { return _state; }
+
+        /**
+         * @brief Elapsed animation iteration and keyframe
+         *
+         * See @ref Player::elapsed() for more information.
+         */
+        std::pair<UnsignedInt, K> elapsed(T time) const;
+
+        /**
+         * @brief Play
+         *
+         * See @ref Player::play() for more information.
+         */
+        ClipPlayer<T, K>& play(T startTime);
+
+        /**
+         * @brief Pause
+         *
+         * See @ref Player::pause() for more information.
+         */
+        ClipPlayer<T, K>& pause(T pauseTime);
+
+        /**
+         * @brief Stop
+         *
+         * See @ref Player::stop() for more information.
+         */
+        ClipPlayer<T, K>& stop();
+
+        /**
+         * @brief Set state
+         *
+         * See @ref Player::setState() for more information.
+         */
+        ClipPlayer<T, K>& setState(State state, T time);
+
+        /**
+         * @brief Advance the animation
+         *
+         * As long as @ref state() is @ref State::Playing, goes through all
+         * tracks of the clip and updates the locations relative to
+         * @ref output(). See @ref Player::advance() for a detailed
+         * description of the behavior.
+         */
+        ClipPlayer<T, K>& advance(T time);
+
+    private:
+        const Clip<K>* _clip;
+        void* _output;
+        Containers::Array<std::size_t> _hints;
+        UnsignedInt _playCount{1};
+        State _state{State::Stopped};
+        T _startTime{}, _stopPauseTime{};
+        Scaler _scaler;
+};
+
+template<class K> template<class V, class R> Clip<K>& Clip<K>::add(const TrackView<K, V, R>& track, const std::size_t outputOffset) {
+    return addInternal(track,
+        [](const TrackViewStorage<K>& track, K key, std::size_t& hint, void* destination) {
+            *static_cast<R*>(destination) = static_cast<const TrackView<K, V, R>&>(track).at(key, hint);
+        }, outputOffset);
+}
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_EXPORT Clip<Float>;
+extern template class MAGNUM_EXPORT ClipPlayer<Float, Float>;
+extern template class MAGNUM_EXPORT ClipPlayer<std::chrono::nanoseconds, Float>;
+#endif
+
+}}
+
+#endif
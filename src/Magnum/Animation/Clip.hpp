@@ -0,0 +1,168 @@
+#ifndef Magnum_Animation_Clip_hpp
+#define Magnum_Animation_Clip_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Clip.h
+ */
+
+#include "Clip.h"
+
+#include "Magnum/Animation/Player.hpp"
+
+namespace Magnum { namespace Animation {
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<class K> struct Clip<K>::Track {
+    /*implicit*/ Track(const TrackViewStorage<K>& track, void(*advancer)(const TrackViewStorage<K>&, K, std::size_t&, void*), std::size_t outputOffset) noexcept: track{track}, advancer{advancer}, outputOffset{outputOffset} {}
+
+    TrackViewStorage<K> track;
+    void(*advancer)(const TrackViewStorage<K>&, K, std::size_t&, void*);
+    std::size_t outputOffset;
+};
+#endif
+
+template<class K> Clip<K>::Clip() = default;
+
+template<class K> Clip<K>::Clip(Clip<K>&&) = default;
+
+template<class K> Clip<K>::~Clip() = default;
+
+template<class K> Clip<K>& Clip<K>::operator=(Clip<K>&&) = default;
+
+template<class K> const TrackViewStorage<K>& Clip<K>::track(std::size_t i) const {
+    CORRADE_ASSERT(i < _tracks.size(),
+        /* Returning track 0 so we can test this w/ MSVC debug iterators */
+        "Animation::Clip::track(): index out of range", _tracks[0].track);
+    return _tracks[i].track;
+}
+
+template<class K> std::size_t Clip<K>::outputOffset(std::size_t i) const {
+    CORRADE_ASSERT(i < _tracks.size(),
+        "Animation::Clip::outputOffset(): index out of range", {});
+    return _tracks[i].outputOffset;
+}
+
+template<class K> Clip<K>& Clip<K>::addInternal(const TrackViewStorage<K>& track, void(*const advancer)(const TrackViewStorage<K>&, K, std::size_t&, void*), const std::size_t outputOffset) {
+    if(_tracks.empty())
+        _duration = track.duration();
+    else
+        _duration = Math::join(track.duration(), _duration);
+    _tracks.emplace_back(track, advancer, outputOffset);
+    return *this;
+}
+
+template<class T, class K> ClipPlayer<T, K>::ClipPlayer(const Clip<K>& clip, void* const output): ClipPlayer<T, K>{clip, output, Implementation::DefaultScaler<T, K>::scale} {}
+
+template<class T, class K> ClipPlayer<T, K>::ClipPlayer(const Clip<K>& clip, void* const output, const Scaler scaler): _clip{&clip}, _output{output}, _hints{Containers::ValueInit, clip.size()}, _scaler{scaler} {}
+
+template<class T, class K> ClipPlayer<T, K>::ClipPlayer(ClipPlayer<T, K>&&) = default;
+
+template<class T, class K> ClipPlayer<T, K>::~ClipPlayer() = default;
+
+template<class T, class K> ClipPlayer<T, K>& ClipPlayer<T, K>::operator=(ClipPlayer<T, K>&&) = default;
+
+template<class T, class K> ClipPlayer<T, K>& ClipPlayer<T, K>::play(T startTime) {
+    /* Same as Player::play() */
+    if(_state == State::Paused) {
+        _startTime = startTime - _startTime;
+        _state = State::Playing;
+        return *this;
+    }
+
+    _state = State::Playing;
+    _startTime = startTime;
+    return *this;
+}
+
+template<class T, class K> ClipPlayer<T, K>& ClipPlayer<T, K>::pause(T pauseTime) {
+    if(_state != State::Playing) return *this;
+
+    _state = State::Paused;
+    _stopPauseTime = pauseTime;
+    return *this;
+}
+
+template<class T, class K> ClipPlayer<T, K>& ClipPlayer<T, K>::stop() {
+    _state = State::Stopped;
+    /* Anything, just not a default-constructed value */
+    _stopPauseTime = T{1};
+    return *this;
+}
+
+template<class T, class K> ClipPlayer<T, K>& ClipPlayer<T, K>::setState(State state, T time) {
+    switch(state) {
+        case State::Playing: return play(time);
+        case State::Paused: return pause(time);
+        case State::Stopped: return stop();
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+template<class T, class K> std::pair<UnsignedInt, K> ClipPlayer<T, K>::elapsed(const T time) const {
+    /* Same as Player::elapsed(), just with the duration taken from the
+       clip */
+    T startTime = _startTime;
+    T pauseTime = _stopPauseTime;
+    State state = _state;
+    const K duration = _clip->duration().size()[0];
+    const Containers::Optional<std::pair<UnsignedInt, K>> elapsed = Implementation::playerElapsed(duration, _playCount, _scaler, time, startTime, pauseTime, state);
+    if(elapsed) return *elapsed;
+
+    if(_state == State::Paused && duration)
+        return _scaler(_startTime, duration);
+
+    if(_state == State::Stopped && _startTime != T{}) {
+        CORRADE_INTERNAL_ASSERT(_playCount);
+        return {_playCount - 1, duration};
+    }
+
+    return {0, K{}};
+}
+
+template<class T, class K> ClipPlayer<T, K>& ClipPlayer<T, K>::advance(const T time) {
+    Containers::Optional<std::pair<UnsignedInt, K>> elapsed = Implementation::playerElapsed(_clip->duration().size()[0], _playCount, _scaler, time, _startTime, _stopPauseTime, _state);
+    if(!elapsed) return *this;
+
+    /* The clip is not supposed to change after the players were created, but
+       in case it did, don't access the hints out of bounds */
+    if(_hints.size() != _clip->_tracks.size())
+        _hints = Containers::Array<std::size_t>{Containers::ValueInit, _clip->_tracks.size()};
+
+    const K key = _clip->duration().min()[0] + elapsed->second;
+    char* const output = static_cast<char*>(_output);
+    for(std::size_t i = 0; i != _hints.size(); ++i) {
+        const typename Clip<K>::Track& t = _clip->_tracks[i];
+        t.advancer(t.track, key, _hints[i], output + t.outputOffset);
+    }
+
+    return *this;
+}
+
+}}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Compression.h"
+
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Packing.h"
+
+namespace Magnum { namespace Animation {
+
+namespace {
+    /* The three smallest components of a normalized quaternion are in range
+       [-1/sqrt(2), 1/sqrt(2)], mapped to 15 bits */
+    constexpr Float ComponentRange = 0.70710678118654752440f;
+    constexpr UnsignedShort ComponentMax = 0x7fff;
+}
+
+Math::Vector3<UnsignedShort> packQuaternion(const Quaternion& value) {
+    CORRADE_ASSERT(value.isNormalized(),
+        "Animation::packQuaternion():" << value << "is not normalized", {});
+
+    const Vector4 components{value.vector(), value.scalar()};
+
+    /* Find the largest component and flip the whole quaternion so it's
+       positive, as q and -q represent the same rotation */
+    std::size_t largest = 0;
+    for(std::size_t i = 1; i != 4; ++i)
+        if(std::abs(components[i]) > std::abs(components[largest])) largest = i;
+    const Float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+    Math::Vector3<UnsignedShort> out;
+    for(std::size_t i = 0, j = 0; i != 4; ++i) {
+        if(i == largest) continue;
+        const Float normalized = Math::clamp((sign*components[i]/ComponentRange + 1.0f)*0.5f, 0.0f, 1.0f);
+        out[j++] = UnsignedShort(normalized*ComponentMax + 0.5f);
+    }
+
+    /* Index of the largest component goes into the top bits of the first
+       two values */
+    out[0] |= UnsignedShort((largest & 0x1) << 15);
+    out[1] |= UnsignedShort((largest & 0x2) << 14);
+    return out;
+}
+
+Quaternion unpackQuaternion(const Math::Vector3<UnsignedShort>& value) {
+    const std::size_t largest = (value[0] >> 15)|((value[1] >> 15) << 1);
+
+    Vector4 components;
+    Float sum = 0.0f;
+    for(std::size_t i = 0, j = 0; i != 4; ++i) {
+        if(i == largest) continue;
+        const Float component = (Float(value[j++] & ComponentMax)/ComponentMax*2.0f - 1.0f)*ComponentRange;
+        components[i] = component;
+        sum += component*component;
+    }
+    components[largest] = std::sqrt(Math::max(1.0f - sum, 0.0f));
+
+    /* Renormalize to cancel out the quantization error */
+    return Quaternion{components.xyz(), components.w()}.normalized();
+}
+
+Quaternion slerpPackedQuaternion(const Math::Vector3<UnsignedShort>& a, const Math::Vector3<UnsignedShort>& b, const Float t) {
+    return Math::slerpShortestPath(unpackQuaternion(a), unpackQuaternion(b), t);
+}
+
+Vector3 lerpPackedHalf(const Math::Vector3<UnsignedShort>& a, const Math::Vector3<UnsignedShort>& b, const Float t) {
+    return Math::lerp(Vector3{Math::unpackHalf(a)}, Vector3{Math::unpackHalf(b)}, t);
+}
+
+}}
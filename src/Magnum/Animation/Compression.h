@@ -0,0 +1,199 @@
+#ifndef Magnum_Animation_Compression_h
+#define Magnum_Animation_Compression_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Animation::reduceKeyframes(), @ref Magnum::Animation::packQuaternion(), @ref Magnum::Animation::unpackQuaternion(), @ref Magnum::Animation::slerpPackedQuaternion(), @ref Magnum::Animation::lerpPackedHalf(), @ref Magnum::Animation::packRotationTrack(), @ref Magnum::Animation::packHalfTrack()
+ */
+
+#include <type_traits>
+#include <vector>
+
+#include "Magnum/Animation/Track.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Animation {
+
+namespace Implementation {
+    template<class T> inline typename std::enable_if<std::is_floating_point<T>::value, T>::type keyframeError(T a, T b) {
+        return std::abs(a - b);
+    }
+    template<std::size_t size, class T> inline T keyframeError(const Math::Vector<size, T>& a, const Math::Vector<size, T>& b) {
+        return (a - b).length();
+    }
+    /* A quaternion and its negation represent the same rotation */
+    template<class T> inline T keyframeError(const Math::Quaternion<T>& a, const Math::Quaternion<T>& b) {
+        return Math::min((a - b).length(), (a + b).length());
+    }
+}
+
+/**
+@brief Remove keyframes that can be reconstructed by interpolation
+@param track        Track to reduce
+@param maxError     Max allowed error
+@return Track with the redundant keyframes removed
+
+Goes through the keyframes and removes every keyframe that can be calculated
+from its neighboring kept keyframes using the track interpolator with an error
+not larger than @p maxError. The first and the last keyframe is always kept.
+The error is calculated as absolute difference for scalars, as distance for
+vectors and as distance on a four-dimensional unit sphere for quaternions,
+taking into account that a negated quaternion represents the same rotation.
+The interpolation and extrapolation behavior of the original track is
+preserved.
+
+Only tracks where the result type is the same as value type are supported, as
+removing keyframes from for example @ref Math::CubicHermite splines would
+change meaning of the tangents. The operation is @f$ \mathcal{O}(n^2) @f$ in
+the worst case of long runs of removable keyframes.
+@see @ref packRotationTrack(), @ref packHalfTrack()
+@experimental
+*/
+template<class K, class V, class R> Track<K, V, R> reduceKeyframes(const TrackView<K, V, R>& track, Float maxError);
+
+/**
+@brief Pack a quaternion into 48 bits
+Uses the "smallest three" encoding --- the component with the largest
+absolute value is left out and reconstructed on unpacking from the fact that
+the quaternion is normalized. The quaternion is negated if needed so the
+left-out component is positive. The remaining three components, which are
+all in range @f$ [-\frac{1}{\sqrt{2}}, \frac{1}{\sqrt{2}}] @f$, are stored in
+15 bits each, index of the left-out component in two of the remaining three
+bits.
+Expects that the quaternion is normalized.
+@see @ref unpackQuaternion(), @ref slerpPackedQuaternion()
+@experimental
+*/
+MAGNUM_EXPORT Math::Vector3<UnsignedShort> packQuaternion(const Quaternion& value);
+
+/**
+@brief Unpack a quaternion packed with @ref packQuaternion()
+The result is always normalized.
+@experimental
+*/
+MAGNUM_EXPORT Quaternion unpackQuaternion(const Math::Vector3<UnsignedShort>& value);
+
+/**
+@brief Spherical linear interpolation of packed quaternions
+Unpacks both values using @ref unpackQuaternion() and interpolates them using
+@ref Math::slerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T),
+as @ref packQuaternion() doesn't preserve the hemisphere of consecutive
+keyframes. Meant to be used as an interpolator for tracks created with
+@ref packRotationTrack().
+@experimental
+*/
+MAGNUM_EXPORT Quaternion slerpPackedQuaternion(const Math::Vector3<UnsignedShort>& a, const Math::Vector3<UnsignedShort>& b, Float t);
+
+/**
+@brief Linear interpolation of half-float vectors
+Unpacks both values using @ref Math::unpackHalf() and interpolates them using
+@ref Math::lerp(). Meant to be used as an interpolator for tracks created with
+@ref packHalfTrack().
+@experimental
+*/
+MAGNUM_EXPORT Vector3 lerpPackedHalf(const Math::Vector3<UnsignedShort>& a, const Math::Vector3<UnsignedShort>& b, Float t);
+
+/**
+@brief Pack a rotation track
+Packs all values using @ref packQuaternion(), reducing the size of each value
+from 16 to 6 bytes. The resulting track interpolates using
+@ref slerpPackedQuaternion() regardless of the original interpolation and
+gives out unpacked @ref Magnum::Quaternion "Quaternion" values, so it can be
+used in @ref Player the same way as the original track:
+
+@snippet MagnumAnimation.cpp packRotationTrack
+
+Extrapolation behavior of the original track is preserved. Expects that all
+values are normalized. For best results call @ref reduceKeyframes() on the
+original track first.
+@experimental
+*/
+template<class K> Track<K, Math::Vector3<UnsignedShort>, Quaternion> packRotationTrack(const TrackView<K, Quaternion, Quaternion>& track);
+
+/**
+@brief Pack a translation or scaling track to half-floats
+Packs all values using @ref Math::packHalf(), reducing the size of each value
+from 12 to 6 bytes. The resulting track interpolates using
+@ref lerpPackedHalf() regardless of the original interpolation and gives out
+unpacked @ref Magnum::Vector3 "Vector3" values. Extrapolation behavior of the
+original track is preserved. Unlike normalized integers, half-floats don't
+need a per-track value range stored alongside the track, with precision
+relative to the magnitude of given value.
+@experimental
+*/
+template<class K> Track<K, Math::Vector3<UnsignedShort>, Vector3> packHalfTrack(const TrackView<K, Vector3, Vector3>& track);
+
+template<class K, class V, class R> Track<K, V, R> reduceKeyframes(const TrackView<K, V, R>& track, const Float maxError) {
+    static_assert(std::is_same<V, R>::value, "keyframe reduction is supported only for tracks with the same value and result type");
+
+    const Containers::StridedArrayView<const K> keys = track.keys();
+    const Containers::StridedArrayView<const V> values = track.values();
+    const typename TrackView<K, V, R>::Interpolator interpolator = track.interpolator();
+
+    std::vector<std::pair<K, V>> out;
+    if(keys.size()) out.emplace_back(keys[0], values[0]);
+
+    /* Extend the range from the last kept keyframe as long as all keyframes
+       inside it can be reconstructed, once that's not possible anymore, keep
+       the keyframe right before the range end */
+    std::size_t start = 0;
+    for(std::size_t end = 2; end < keys.size(); ++end) {
+        for(std::size_t i = start + 1; i != end; ++i) {
+            const R reconstructed = interpolator(values[start], values[end], Math::lerpInverted(Float(keys[start]), Float(keys[end]), Float(keys[i])));
+            if(Implementation::keyframeError(reconstructed, values[i]) <= maxError)
+                continue;
+
+            start = end - 1;
+            out.emplace_back(keys[start], values[start]);
+            break;
+        }
+    }
+
+    if(keys.size() > 1) out.emplace_back(keys[keys.size() - 1], values[keys.size() - 1]);
+
+    Containers::Array<std::pair<K, V>> data{out.size()};
+    for(std::size_t i = 0; i != out.size(); ++i) data[i] = out[i];
+    return Track<K, V, R>{std::move(data), track.interpolation(), interpolator, track.before(), track.after()};
+}
+
+template<class K> Track<K, Math::Vector3<UnsignedShort>, Quaternion> packRotationTrack(const TrackView<K, Quaternion, Quaternion>& track) {
+    Containers::Array<std::pair<K, Math::Vector3<UnsignedShort>>> data{track.size()};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {track.keys()[i], packQuaternion(track.values()[i])};
+    return Track<K, Math::Vector3<UnsignedShort>, Quaternion>{std::move(data), slerpPackedQuaternion, track.before(), track.after()};
+}
+
+template<class K> Track<K, Math::Vector3<UnsignedShort>, Vector3> packHalfTrack(const TrackView<K, Vector3, Vector3>& track) {
+    Containers::Array<std::pair<K, Math::Vector3<UnsignedShort>>> data{track.size()};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {track.keys()[i], Math::packHalf(track.values()[i])};
+    return Track<K, Math::Vector3<UnsignedShort>, Vector3>{std::move(data), lerpPackedHalf, track.before(), track.after()};
+}
+
+}}
+
+#endif
@@ -295,26 +295,23 @@ template<class T> struct MAGNUM_EXPORT TypeTraits<Math::CubicHermite<T>, T> {
     static Interpolator interpolator(Interpolation interpolation);
 };
 
-}
-
-/* Needs to be defined later so it can pick up the TypeTraits definitions */
-template<class V, class R> auto interpolatorFor(Interpolation interpolation) -> R(*)(const V&, const V&, Float) {
-    return Implementation::TypeTraits<V, R>::interpolator(interpolation);
-}
-
-template<class K, class V, class R> R interpolate(const Containers::StridedArrayView<const K>& keys, const Containers::StridedArrayView<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), K frame, std::size_t& hint) {
-    CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolate(): keys and values don't have the same size", {});
-
+/* Finds the keyframe pair around given frame and the interpolation factor
+   between them, shared between interpolate() and batched track evaluation in
+   Player. Returns false if a default-constructed value should be returned
+   instead. */
+template<class K> bool interpolationFactor(const Containers::StridedArrayView<const K>& keys, const Extrapolation before, const Extrapolation after, K frame, std::size_t& hint, std::size_t& first, std::size_t& second, Float& factor) {
     /* No data, return default-constructed value */
-    if(!keys.size()) return {};
+    if(!keys.size()) return false;
 
     /* Only one frame, return it verbatim (or default-constructed, if desired) */
     if(keys.size() == 1) {
         if((frame < keys[0] && before == Extrapolation::DefaultConstructed) ||
            (frame > keys[0] && after == Extrapolation::DefaultConstructed))
-            return {};
+            return false;
 
-        return interpolator(values[0], values[0], 0.0f);
+        first = second = 0;
+        factor = 0.0f;
+        return true;
     }
 
     /* Rewind from the beginning if hint is too late */
@@ -327,15 +324,35 @@ template<class K, class V, class R> R interpolate(const Containers::StridedArray
     /* Special extrapolation outside of range. Usual extrapolation is handled
        below. */
     if(frame < keys[hint]) {
-        if(before == Extrapolation::DefaultConstructed) return {};
+        if(before == Extrapolation::DefaultConstructed) return false;
         if(before == Extrapolation::Constant) frame = keys[hint];
     } else if(frame >= keys[hint + 1]) {
-        if(after == Extrapolation::DefaultConstructed) return {};
+        if(after == Extrapolation::DefaultConstructed) return false;
         if(after == Extrapolation::Constant) frame = keys[hint + 1];
     }
 
-    return interpolator(values[hint], values[hint + 1],
-        Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)));
+    first = hint;
+    second = hint + 1;
+    factor = Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame));
+    return true;
+}
+
+}
+
+/* Needs to be defined later so it can pick up the TypeTraits definitions */
+template<class V, class R> auto interpolatorFor(Interpolation interpolation) -> R(*)(const V&, const V&, Float) {
+    return Implementation::TypeTraits<V, R>::interpolator(interpolation);
+}
+
+template<class K, class V, class R> R interpolate(const Containers::StridedArrayView<const K>& keys, const Containers::StridedArrayView<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), K frame, std::size_t& hint) {
+    CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolate(): keys and values don't have the same size", {});
+
+    std::size_t first, second;
+    Float factor;
+    if(!Implementation::interpolationFactor(keys, before, after, frame, hint, first, second, factor))
+        return {};
+
+    return interpolator(values[first], values[second], factor);
 }
 
 template<class K, class V, class R> R interpolateStrict(const Containers::StridedArrayView<const K>& keys, const Containers::StridedArrayView<const V>& values, R(*const interpolator)(const V&, const V&, Float), const K frame, std::size_t& hint) {
@@ -31,6 +31,7 @@
 
 #include <chrono>
 #include <vector>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Animation/Track.h"
 #include "Magnum/Math/Range.h"
@@ -118,6 +119,26 @@ interpolated value changes, which is useful for triggering other events. See
 @ref addRawCallback() that allows for greater control and further performance
 optimizations. See its documentation for a usage example code snippet.
 
+@subsection Animation-Player-setup-batch Batched tracks
+
+When animating a large amount of values that share the same keyframes, for
+example rotations of all bones in a skeleton, it's possible to add them
+using @ref addBatch(). All tracks in the batch are then evaluated at once ---
+the keyframe lookup is done only once for the whole batch and the results are
+written into a contiguous destination array in a tight loop, instead of
+doing a separate keyframe lookup and an indirect call for every track:
+
+@snippet MagnumAnimation.cpp Player-usage-batch
+
+@subsection Animation-Player-setup-shared Sharing tracks between many instances
+
+The player stores the @ref TrackView and destination for every added track,
+so having thousands of players for instances of the same animation duplicates
+this data for every instance. In this case it's better to create a single
+@ref Clip containing the tracks bound to offsets relative to some base
+pointer and play it using lightweight @ref ClipPlayer instances instead, which
+store only the playback state and the base pointer.
+
 The animation is implicitly played only once, use @ref setPlayCount() to set a
 number of repeats or make it repeat indefinitely. By default, the
 @ref duration() of an animation is calculated implicitly from all added tracks.
@@ -586,6 +607,29 @@ template<class T, class K
         }
         #endif
 
+        /**
+         * @brief Add a batch of tracks sharing the same keyframes
+         * @param tracks        Tracks to add
+         * @param destination   Destination array, one item for each track
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p tracks is not empty, @p destination has the same
+         * size as @p tracks and that all tracks have the same keyframes,
+         * interpolator function and extrapolation behavior. During each call
+         * to @ref advance(), as long as the animation is playing, the keyframe
+         * lookup is done just once for the whole batch and then the values of
+         * all tracks are interpolated into consecutive items of
+         * @p destination. See @ref Animation-Player-setup-batch for more
+         * information.
+         *
+         * The batch counts as a single track in @ref size() and
+         * @ref track() returns the first track of the batch. Similarly to
+         * @ref add(), only the @ref TrackView instances are stored, the key
+         * and value data have to stay in scope for the whole lifetime of the
+         * @ref Player instance. The @p tracks array itself is copied.
+         */
+        template<class V, class R> Player<T, K>& addBatch(Containers::ArrayView<const TrackView<K, V, R>> tracks, Containers::ArrayView<R> destination);
+
         /**
          * @brief State
          *
@@ -668,8 +712,9 @@ template<class T, class K
          * @brief Advance the animation
          *
          * As long as @ref state() is @ref State::Playing, goes through all
-         * tracks added with @ref add(), @ref addWithCallback() or
-         * @ref addWithCallbackOnChange() in order they were added and updates
+         * tracks added with @ref add(), @ref addWithCallback(),
+         * @ref addWithCallbackOnChange() or @ref addBatch() in order they
+         * were added and updates
          * the destination locations and/or fires the callbacks with
          * interpolation results.
          *
@@ -704,6 +749,7 @@ template<class T, class K
         struct Track;
 
         Player<T, K>& addInternal(const TrackViewStorage<K>& track, void (*advancer)(const TrackViewStorage<K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData);
+        Player<T, K>& addBatchInternal(Containers::Array<TrackViewStorage<K>>&& batch, void (*advancer)(const TrackViewStorage<K>&, K, std::size_t&, void*, void(*)(), void*), void* destination);
 
         Containers::Optional<std::pair<UnsignedInt, K>> elapsedInternal(T time, T& updatedStartTime, T& updatedPauseTime, State& updatedState) const;
 
@@ -722,6 +768,56 @@ template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>
         }, &destination, nullptr, nullptr);
 }
 
+template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>::addBatch(const Containers::ArrayView<const TrackView<K, V, R>> tracks, const Containers::ArrayView<R> destination) {
+    CORRADE_ASSERT(!tracks.empty(),
+        "Animation::Player::addBatch(): expected at least one track", *this);
+    CORRADE_ASSERT(destination.size() == tracks.size(),
+        "Animation::Player::addBatch(): expected" << tracks.size() << "destination items but got" << destination.size(), *this);
+
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    const Containers::StridedArrayView<const K> keys = tracks[0].keys();
+    #endif
+    Containers::Array<TrackViewStorage<K>> batch{tracks.size()};
+    for(std::size_t i = 0; i != tracks.size(); ++i) {
+        const TrackView<K, V, R>& track = tracks[i];
+        #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+        /* Tracks coming from the same file usually share the key data, so
+           compare the values only if the views are different */
+        bool sameKeys = track.keys().size() == keys.size();
+        if(sameKeys && (track.keys().data() != keys.data() || track.keys().stride() != keys.stride())) {
+            for(std::size_t j = 0; j != keys.size(); ++j) {
+                if(track.keys()[j] == keys[j]) continue;
+                sameKeys = false;
+                break;
+            }
+        }
+        CORRADE_ASSERT(sameKeys,
+            "Animation::Player::addBatch(): track" << i << "has different keyframes than the first track", *this);
+        CORRADE_ASSERT(track.interpolator() == tracks[0].interpolator() && track.before() == tracks[0].before() && track.after() == tracks[0].after(),
+            "Animation::Player::addBatch(): track" << i << "has different interpolation or extrapolation than the first track", *this);
+        #endif
+        batch[i] = track;
+    }
+
+    return addBatchInternal(std::move(batch),
+        [](const TrackViewStorage<K>& track, K key, std::size_t& hint, void* destination, void(*)(), void* batch) {
+            std::size_t first, second;
+            Float factor;
+            R* out = static_cast<R*>(destination);
+            const Containers::Array<TrackViewStorage<K>>& tracks = *static_cast<const Containers::Array<TrackViewStorage<K>>*>(batch);
+            if(!Implementation::interpolationFactor(track.keys(), track.before(), track.after(), key, hint, first, second, factor)) {
+                for(std::size_t i = 0; i != tracks.size(); ++i) out[i] = R{};
+                return;
+            }
+
+            const typename TrackView<K, V, R>::Interpolator interpolator = static_cast<const TrackView<K, V, R>&>(track).interpolator();
+            for(const TrackViewStorage<K>& t: tracks) {
+                const Containers::StridedArrayView<const V> values = static_cast<const TrackView<K, V, R>&>(t).values();
+                *out++ = interpolator(values[first], values[second], factor);
+            }
+        }, destination.data());
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template<class T, class K> template<class V, class R, class Callback> Player<T, K>& Player<T, K>::addWithCallback(const TrackView<K, V, R>& track, Callback callback, void* userData) {
     auto callbackPtr = static_cast<void(*)(const K&, const R&, void*)>(callback);
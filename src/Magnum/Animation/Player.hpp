@@ -61,12 +61,19 @@ template<class T, class K> struct Player<T, K>::Track  {
        COME ON  ¯\_(ツ)_/¯ */
     /*implicit*/ Track(const TrackViewStorage<K>& track, void (*advancer)(const TrackViewStorage<K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData, std::size_t hint) noexcept: track{track}, advancer{advancer}, destination{destination}, userCallback{userCallback}, userCallbackData{userCallbackData}, hint{hint} {}
 
+    /*implicit*/ Track(Containers::Array<TrackViewStorage<K>>&& batch, void (*advancer)(const TrackViewStorage<K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, std::size_t hint) noexcept: track{batch[0]}, advancer{advancer}, destination{destination}, userCallback{}, userCallbackData{}, hint{hint}, batch{std::move(batch)} {}
+
     TrackViewStorage<K> track;
     void (*advancer)(const TrackViewStorage<K>&, K, std::size_t&, void*, void(*)(), void*);
     void* destination;
     void(*userCallback)();
     void* userCallbackData;
     std::size_t hint;
+
+    /* Non-empty only for tracks added with addBatch(), passed to the advancer
+       instead of userCallbackData. Can't be referenced directly from
+       userCallbackData as the vector can reallocate. */
+    Containers::Array<TrackViewStorage<K>> batch;
 };
 #endif
 
@@ -104,6 +111,15 @@ template<class T, class K> Player<T, K>& Player<T, K>::addInternal(const TrackVi
     return *this;
 }
 
+template<class T, class K> Player<T, K>& Player<T, K>::addBatchInternal(Containers::Array<TrackViewStorage<K>>&& batch, void(*const advancer)(const TrackViewStorage<K>&, K, std::size_t&, void*, void(*)(), void*), void* const destination) {
+    if(_tracks.empty() && _duration == Math::Range1D<K>{})
+        _duration = batch[0].duration();
+    else
+        _duration = Math::join(batch[0].duration(), _duration);
+    _tracks.emplace_back(std::move(batch), advancer, destination, 0);
+    return *this;
+}
+
 template<class T, class K> Player<T, K>& Player<T, K>::play(T startTime) {
     /* In case we were paused, move start time backwards by the duration that
        was already played back */
@@ -243,7 +259,7 @@ template<class T, class K> Player<T, K>& Player<T, K>::advance(const T time) {
 
     /* Advance all tracks. Properly handle durations that don't start at 0. */
     for(Track& t: _tracks)
-        t.advancer(t.track, _duration.min()[0] + elapsed->second, t.hint, t.destination, t.userCallback, t.userCallbackData);
+        t.advancer(t.track, _duration.min()[0] + elapsed->second, t.hint, t.destination, t.userCallback, t.batch.empty() ? t.userCallbackData : &t.batch);
 
     return *this;
 }
@@ -0,0 +1,191 @@
+#ifndef Magnum_Animation_PlayerGroup_h
+#define Magnum_Animation_PlayerGroup_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::PlayerGroup
+ */
+
+#include "Magnum/Animation/Player.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Group of animation players
+
+Advances many independent @ref Player instances at once, optionally
+distributing the work over multiple threads. The group doesn't own the players,
+it only references them --- it's the user responsibility to keep the players
+alive for as long as they are in the group.
+
+@snippet MagnumAnimation.cpp PlayerGroup-usage
+
+@section Animation-PlayerGroup-multithreading Multithreaded advance
+
+Using @ref setThreadCount(), the players are split into contiguous ranges that
+are picked up by worker threads of @ref globalJobExecutor() in a first-come,
+first-serve manner, so threads finishing early continue with remaining work
+instead of waiting. No threads are spawned by the advance itself.
+Because neighboring players always end up in the same range, storing the
+destination values of consecutive players next to each other means threads
+write to disjoint memory areas, touching the same cache line only at range
+boundaries.
+
+@code{.cpp}
+group.setThreadCount(std::thread::hardware_concurrency());
+@endcode
+
+The players are independent of each other, so no synchronization is done
+between them. The callbacks passed to @ref Player::addWithCallback() and
+@ref Player::addWithCallbackOnChange() are however called from the worker
+threads in that case and have to be thread-safe if they access any shared
+state. If the group has less than @ref ParallelAdvanceThreshold players, the
+job executor is not used at all, as the overhead would outweigh the gains.
+Multithreaded advance is not available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where @ref setThreadCount() is
+ignored.
+
+@section Animation-PlayerGroup-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into the @ref Animation
+library. For other specializations you have to use the @ref PlayerGroup.hpp
+implementation file to avoid linker errors. See also
+@ref compilation-speedup-hpp for more information.
+
+-   @ref PlayerGroup "PlayerGroup<Float, Float>"
+-   @ref PlayerGroup "PlayerGroup<std::chrono::nanoseconds, Float>"
+
+@see @ref SceneGraph::AnimableGroup::setThreadCount()
+@experimental
+*/
+template<class T, class K
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = T
+    #endif
+> class PlayerGroup {
+    public:
+        enum: std::size_t {
+            /**
+             * Minimal player count for which multithreaded advance is done.
+             * See @ref Animation-PlayerGroup-multithreading for more
+             * information.
+             */
+            ParallelAdvanceThreshold = 64,
+
+            /**
+             * Task count per thread. The tasks are assigned to threads
+             * dynamically, having more tasks than threads makes the work
+             * distribution more even if some players have more tracks than
+             * others.
+             */
+            ParallelTasksPerThread = 4
+        };
+
+        /** @brief Constructor */
+        explicit PlayerGroup() = default;
+
+        /** @brief Whether the group is empty */
+        bool isEmpty() const { return _players.empty(); }
+
+        /** @brief Count of players in the group */
+        std::size_t size() const { return _players.size(); }
+
+        /** @brief Player at given index */
+        Player<T, K>& operator[](std::size_t index) { return *_players[index]; }
+
+        /** @overload */
+        const Player<T, K>& operator[](std::size_t index) const { return *_players[index]; }
+
+        /**
+         * @brief Add a player to the group
+         * @return Reference to self (for method chaining)
+         *
+         * The player is appended at the end. Expects that the player is not
+         * already in the group.
+         */
+        PlayerGroup<T, K>& add(Player<T, K>& player);
+
+        /**
+         * @brief Remove a player from the group
+         * @return Reference to self (for method chaining)
+         *
+         * Order of the remaining players is preserved. Expects that the
+         * player is in the group.
+         */
+        PlayerGroup<T, K>& remove(Player<T, K>& player);
+
+        /**
+         * @brief Remove all players from the group
+         * @return Reference to self (for method chaining)
+         */
+        PlayerGroup<T, K>& clear();
+
+        /**
+         * @brief Thread count used for advancing
+         *
+         * Default is @cpp 1 @ce, meaning the players are advanced only on
+         * the calling thread.
+         */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count used for advancing
+         * @return Reference to self (for method chaining)
+         *
+         * The calling thread is counted as well, so setting the count to
+         * @cpp 4 @ce will use up to three additional workers of
+         * @ref globalJobExecutor() during @ref advance(). Value of @cpp 0 @ce
+         * is treated the same as @cpp 1 @ce. See
+         * @ref Animation-PlayerGroup-multithreading for more information.
+         */
+        PlayerGroup<T, K>& setThreadCount(UnsignedInt count);
+
+        /**
+         * @brief Advance all players
+         * @return Reference to self (for method chaining)
+         *
+         * Calls @ref Player::advance() with @p time on all players in the
+         * group, in the order they were added if multithreaded advance is not
+         * enabled. See @ref Animation-PlayerGroup-multithreading for more
+         * information.
+         */
+        PlayerGroup<T, K>& advance(T time);
+
+    private:
+        void advanceRange(std::size_t begin, std::size_t end, T time);
+
+        std::vector<Player<T, K>*> _players;
+        UnsignedInt _threadCount{1};
+};
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_EXPORT PlayerGroup<Float, Float>;
+extern template class MAGNUM_EXPORT PlayerGroup<std::chrono::nanoseconds, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef Magnum_Animation_PlayerGroup_hpp
+#define Magnum_Animation_PlayerGroup_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref PlayerGroup.h
+ */
+
+#include "PlayerGroup.h"
+
+#include <algorithm>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Animation {
+
+template<class T, class K> PlayerGroup<T, K>& PlayerGroup<T, K>::add(Player<T, K>& player) {
+    CORRADE_ASSERT(std::find(_players.begin(), _players.end(), &player) == _players.end(),
+        "Animation::PlayerGroup::add(): player is already in the group", *this);
+    _players.push_back(&player);
+    return *this;
+}
+
+template<class T, class K> PlayerGroup<T, K>& PlayerGroup<T, K>::remove(Player<T, K>& player) {
+    auto found = std::find(_players.begin(), _players.end(), &player);
+    CORRADE_ASSERT(found != _players.end(),
+        "Animation::PlayerGroup::remove(): player is not in the group", *this);
+    _players.erase(found);
+    return *this;
+}
+
+template<class T, class K> PlayerGroup<T, K>& PlayerGroup<T, K>::clear() {
+    _players.clear();
+    return *this;
+}
+
+template<class T, class K> PlayerGroup<T, K>& PlayerGroup<T, K>::setThreadCount(const UnsignedInt count) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _threadCount = Math::max(count, 1u);
+    #else
+    static_cast<void>(count);
+    #endif
+    return *this;
+}
+
+template<class T, class K> void PlayerGroup<T, K>::advanceRange(const std::size_t begin, const std::size_t end, const T time) {
+    for(std::size_t i = begin; i != end; ++i)
+        _players[i]->advance(time);
+}
+
+template<class T, class K> PlayerGroup<T, K>& PlayerGroup<T, K>::advance(const T time) {
+    const std::size_t count = _players.size();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Multithreaded advance on the global job executor. The players are
+       split into contiguous ranges so each thread writes to destinations of
+       neighboring players only. The players don't share any state, so
+       there's no synchronization needed except for picking up the next
+       task. */
+    if(_threadCount > 1 && count >= ParallelAdvanceThreshold) {
+        const std::size_t taskCount = Math::min(std::size_t(_threadCount)*ParallelTasksPerThread, count);
+        Magnum::Implementation::parallelFor(_threadCount, taskCount, [this, taskCount, count, time](const std::size_t task) {
+            advanceRange(task*count/taskCount, (task + 1)*count/taskCount, time);
+        });
+    } else
+    #endif
+    {
+        advanceRange(0, count, time);
+    }
+
+    return *this;
+}
+
+}}
+
+#endif
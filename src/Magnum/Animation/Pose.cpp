@@ -0,0 +1,89 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Pose.h"
+
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Animation {
+
+Pose::Pose(const std::size_t size): _translations{size}, _rotations{size}, _scalings{Containers::DirectInit, size, 1.0f} {}
+
+void blend(const Pose& a, const Pose& b, const Float factor, Pose& destination) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == destination.size(),
+        "Animation::blend(): expected poses of the same size but got" << a.size() << Debug::nospace << "," << b.size() << "and" << destination.size(), );
+
+    /* Each array processed separately so the loops stay linear over
+       contiguous memory */
+    const std::size_t size = a.size();
+    const Containers::ArrayView<Vector3> translations = destination.translations();
+    const Containers::ArrayView<Quaternion> rotations = destination.rotations();
+    const Containers::ArrayView<Vector3> scalings = destination.scalings();
+    for(std::size_t i = 0; i != size; ++i)
+        translations[i] = Math::lerp(a.translations()[i], b.translations()[i], factor);
+    for(std::size_t i = 0; i != size; ++i)
+        rotations[i] = Math::lerpShortestPath(a.rotations()[i], b.rotations()[i], factor);
+    for(std::size_t i = 0; i != size; ++i)
+        scalings[i] = Math::lerp(a.scalings()[i], b.scalings()[i], factor);
+}
+
+void blendMasked(const Pose& a, const Pose& b, const Containers::ArrayView<const Float> factors, Pose& destination) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == destination.size(),
+        "Animation::blendMasked(): expected poses of the same size but got" << a.size() << Debug::nospace << "," << b.size() << "and" << destination.size(), );
+    CORRADE_ASSERT(factors.size() == a.size(),
+        "Animation::blendMasked(): expected" << a.size() << "factors but got" << factors.size(), );
+
+    const std::size_t size = a.size();
+    const Containers::ArrayView<Vector3> translations = destination.translations();
+    const Containers::ArrayView<Quaternion> rotations = destination.rotations();
+    const Containers::ArrayView<Vector3> scalings = destination.scalings();
+    for(std::size_t i = 0; i != size; ++i)
+        translations[i] = Math::lerp(a.translations()[i], b.translations()[i], factors[i]);
+    for(std::size_t i = 0; i != size; ++i)
+        rotations[i] = Math::lerpShortestPath(a.rotations()[i], b.rotations()[i], factors[i]);
+    for(std::size_t i = 0; i != size; ++i)
+        scalings[i] = Math::lerp(a.scalings()[i], b.scalings()[i], factors[i]);
+}
+
+void blendAdditive(const Pose& base, const Pose& additive, const Float factor, Pose& destination) {
+    CORRADE_ASSERT(base.size() == additive.size() && base.size() == destination.size(),
+        "Animation::blendAdditive(): expected poses of the same size but got" << base.size() << Debug::nospace << "," << additive.size() << "and" << destination.size(), );
+
+    const std::size_t size = base.size();
+    const Containers::ArrayView<Vector3> translations = destination.translations();
+    const Containers::ArrayView<Quaternion> rotations = destination.rotations();
+    const Containers::ArrayView<Vector3> scalings = destination.scalings();
+    for(std::size_t i = 0; i != size; ++i)
+        translations[i] = base.translations()[i] + additive.translations()[i]*factor;
+    for(std::size_t i = 0; i != size; ++i)
+        rotations[i] = Math::lerpShortestPath(Quaternion{}, additive.rotations()[i], factor)*base.rotations()[i];
+    for(std::size_t i = 0; i != size; ++i)
+        scalings[i] = base.scalings()[i]*Math::lerp(Vector3{1.0f}, additive.scalings()[i], factor);
+}
+
+}}
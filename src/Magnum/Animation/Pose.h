@@ -0,0 +1,175 @@
+#ifndef Magnum_Animation_Pose_h
+#define Magnum_Animation_Pose_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::Pose, function @ref Magnum::Animation::blend(), @ref Magnum::Animation::blendAdditive(), @ref Magnum::Animation::blendMasked(), @ref Magnum::Animation::applyPose()
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Skeleton pose
+
+Stores translation, rotation and scaling of a fixed count of bones in three
+separate contiguous arrays. The arrays can be used as destinations for
+@ref Player tracks, either one track per bone using @ref Player::add() or all
+bones at once using @ref Player::addBatch(), so evaluating a clip doesn't
+scatter the writes over the scene. Multiple poses can be then combined using
+@ref blend(), @ref blendAdditive() or @ref blendMasked() and the final pose
+applied to scene objects in a single pass using @ref applyPose().
+
+@snippet MagnumSceneGraph.cpp Pose-usage
+
+All operations work on each of the arrays in a single linear pass over
+contiguous memory, which lets the compiler vectorize them.
+@experimental
+*/
+class MAGNUM_EXPORT Pose {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty pose with no bones.
+         */
+        explicit Pose() = default;
+
+        /**
+         * @brief Constructor
+         * @param size      Bone count
+         *
+         * All translations are set to zero vectors, rotations to identity
+         * quaternions and scalings to @cpp 1.0f @ce.
+         */
+        explicit Pose(std::size_t size);
+
+        /** @brief Bone count */
+        std::size_t size() const { return _translations.size(); }
+
+        /** @brief Bone translations */
+        Containers::ArrayView<Vector3> translations() { return _translations; }
+        Containers::ArrayView<const Vector3> translations() const { return _translations; } /**< @overload */
+
+        /** @brief Bone rotations */
+        Containers::ArrayView<Quaternion> rotations() { return _rotations; }
+        Containers::ArrayView<const Quaternion> rotations() const { return _rotations; } /**< @overload */
+
+        /** @brief Bone scalings */
+        Containers::ArrayView<Vector3> scalings() { return _scalings; }
+        Containers::ArrayView<const Vector3> scalings() const { return _scalings; } /**< @overload */
+
+    private:
+        Containers::Array<Vector3> _translations;
+        Containers::Array<Quaternion> _rotations;
+        Containers::Array<Vector3> _scalings;
+};
+
+/**
+@brief Blend two poses
+@param a            First pose
+@param b            Second pose
+@param factor       Blend factor in range @f$ [0; 1] @f$
+@param destination  Where to put the result
+
+Translations and scalings are linearly interpolated, rotations interpolated
+using @ref Math::lerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T),
+which is cheaper than spherical interpolation and precise enough for blending
+between similar poses. Expects that all three poses have the same size. The
+@p destination can be the same as @p a or @p b.
+@see @ref blendMasked(), @ref blendAdditive()
+@experimental
+*/
+MAGNUM_EXPORT void blend(const Pose& a, const Pose& b, Float factor, Pose& destination);
+
+/**
+@brief Blend two poses with a per-bone factor
+@param a            First pose
+@param b            Second pose
+@param factors      Blend factor for each bone
+@param destination  Where to put the result
+
+Same as @ref blend(), but with a separate factor for each bone. Setting the
+factor to @cpp 0.0f @ce for some bones and @cpp 1.0f @ce for others can be
+used for example to apply a different clip to the upper body only. Expects
+that all three poses have the same size as @p factors.
+@experimental
+*/
+MAGNUM_EXPORT void blendMasked(const Pose& a, const Pose& b, Containers::ArrayView<const Float> factors, Pose& destination);
+
+/**
+@brief Apply an additive pose
+@param base         Base pose
+@param additive     Additive pose, relative to the rest pose
+@param factor       Factor the additive pose is applied with
+@param destination  Where to put the result
+
+Translations of @p additive are multiplied by @p factor and added to
+@p base, rotations are interpolated from identity by @p factor and multiplied
+with @p base from the left, and scalings are interpolated from
+@cpp 1.0f @ce by @p factor and multiplied with @p base. Expects that all
+three poses have the same size. The @p destination can be the same as
+@p base or @p additive.
+@see @ref blend()
+@experimental
+*/
+MAGNUM_EXPORT void blendAdditive(const Pose& base, const Pose& additive, Float factor, Pose& destination);
+
+/**
+@brief Apply a pose to scene objects
+@param pose         Pose to apply
+@param objects      Objects to apply the pose to
+
+Calls @cpp setTranslation() @ce, @cpp setRotation() @ce and
+@cpp setScaling() @ce on each object with given bone transformation, which
+makes it usable for example with
+@ref SceneGraph::TranslationRotationScalingTransformation3D. Expects that
+@p objects has the same size as @p pose.
+@experimental
+*/
+template<class Object> void applyPose(const Pose& pose, Containers::ArrayView<Object* const> objects) {
+    CORRADE_ASSERT(objects.size() == pose.size(),
+        "Animation::applyPose(): expected" << pose.size() << "objects but got" << objects.size(), );
+    const Containers::ArrayView<const Vector3> translations = pose.translations();
+    const Containers::ArrayView<const Quaternion> rotations = pose.rotations();
+    const Containers::ArrayView<const Vector3> scalings = pose.scalings();
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        objects[i]->setTranslation(translations[i])
+            .setRotation(rotations[i])
+            .setScaling(scalings[i]);
+}
+
+}}
+
+#endif
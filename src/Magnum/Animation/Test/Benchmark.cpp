@@ -49,6 +49,8 @@ struct Benchmark: TestSuite::Tester {
     void playerAdvanceCallback();
     void playerAdvanceRawCallback();
     void playerAdvanceRawCallbackDirectInterpolator();
+    void playerAdvanceManyTracks();
+    void playerAdvanceBatch();
 
     Containers::Array<Float> _keys;
     Containers::Array<Int> _values;
@@ -60,7 +62,7 @@ struct Benchmark: TestSuite::Tester {
 };
 
 namespace {
-    enum: std::size_t { DataSize = 2000 };
+    enum: std::size_t { DataSize = 2000, TrackCount = 100 };
 }
 
 Benchmark::Benchmark() {
@@ -80,7 +82,9 @@ Benchmark::Benchmark() {
                    &Benchmark::playerAdvance,
                    &Benchmark::playerAdvanceCallback,
                    &Benchmark::playerAdvanceRawCallback,
-                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator}, 10);
+                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator,
+                   &Benchmark::playerAdvanceManyTracks,
+                   &Benchmark::playerAdvanceBatch}, 10);
 
     _keys = Containers::Array<Float>{DataSize};
     _values = Containers::Array<Int>{Containers::DirectInit, DataSize, 1};
@@ -260,6 +264,31 @@ void Benchmark::playerAdvanceRawCallbackDirectInterpolator() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::playerAdvanceManyTracks() {
+    Int result[TrackCount]{};
+    Player<Float> player;
+    for(Int& i: result) player.add(_track, i);
+    player.play({});
+    CORRADE_BENCHMARK(25) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            player.advance(i);
+    }
+    CORRADE_COMPARE(result[TrackCount - 1], 1);
+}
+
+void Benchmark::playerAdvanceBatch() {
+    Int result[TrackCount]{};
+    Containers::Array<TrackView<Float, Int>> tracks{Containers::DirectInit, TrackCount, _track};
+    Player<Float> player;
+    player.addBatch(Containers::ArrayView<const TrackView<Float, Int>>{tracks}, Containers::arrayView(result))
+        .play({});
+    CORRADE_BENCHMARK(25) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            player.advance(i);
+    }
+    CORRADE_COMPARE(result[TrackCount - 1], 1);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Animation::Test::Benchmark)
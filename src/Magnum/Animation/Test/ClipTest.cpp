@@ -0,0 +1,417 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Animation/Clip.h"
+
+namespace Magnum { namespace Animation { namespace Test {
+
+struct ClipTest: TestSuite::Tester {
+    explicit ClipTest();
+
+    void constructEmpty();
+    void construct();
+    void constructCopy();
+    void constructMove();
+
+    void trackInvalidIndex();
+    void outputOffsetInvalidIndex();
+
+    void playerConstruct();
+    void playerConstructChrono();
+    void playerConstructCopy();
+    void playerConstructMove();
+
+    void playerAdvance();
+    void playerAdvanceMultipleInstances();
+    void playerAdvancePauseResume();
+    void playerAdvanceStop();
+    void playerAdvancePlayCount();
+    void playerAdvanceZeroDuration();
+    void playerAdvanceClipChanged();
+
+    void playerSetOutput();
+    void playerSetState();
+};
+
+ClipTest::ClipTest() {
+    addTests({&ClipTest::constructEmpty,
+              &ClipTest::construct,
+              &ClipTest::constructCopy,
+              &ClipTest::constructMove,
+
+              &ClipTest::trackInvalidIndex,
+              &ClipTest::outputOffsetInvalidIndex,
+
+              &ClipTest::playerConstruct,
+              &ClipTest::playerConstructChrono,
+              &ClipTest::playerConstructCopy,
+              &ClipTest::playerConstructMove,
+
+              &ClipTest::playerAdvance,
+              &ClipTest::playerAdvanceMultipleInstances,
+              &ClipTest::playerAdvancePauseResume,
+              &ClipTest::playerAdvanceStop,
+              &ClipTest::playerAdvancePlayCount,
+              &ClipTest::playerAdvanceZeroDuration,
+              &ClipTest::playerAdvanceClipChanged,
+
+              &ClipTest::playerSetOutput,
+              &ClipTest::playerSetState});
+}
+
+namespace {
+    const Animation::Track<Float, Float> Track{{
+        {1.0f, 1.5f},
+        {2.5f, 3.0f},
+        {3.0f, 5.0f},
+        {4.0f, 2.0f}
+    }, Math::lerp};
+
+    const Animation::Track<Float, Int> Track2{{
+        {0.5f, 42},
+        {3.0f, 1337},
+        {3.5f, -17}
+    }, Math::select};
+
+    struct Instance {
+        Float value;
+        Int value2;
+    };
+}
+
+void ClipTest::constructEmpty() {
+    Clip<Float> clip;
+    CORRADE_COMPARE(clip.duration(), Range1D{});
+    CORRADE_VERIFY(clip.isEmpty());
+    CORRADE_COMPARE(clip.size(), 0);
+}
+
+void ClipTest::construct() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value))
+        .add(Track2, offsetof(Instance, value2));
+    CORRADE_COMPARE(clip.duration(), (Range1D{0.5f, 4.0f}));
+    CORRADE_VERIFY(!clip.isEmpty());
+    CORRADE_COMPARE(clip.size(), 2);
+    CORRADE_COMPARE(clip.track(0).keys().data(), Track.keys().data());
+    CORRADE_COMPARE(clip.track(1).keys().data(), Track2.keys().data());
+    CORRADE_COMPARE(clip.outputOffset(0), 0);
+    CORRADE_COMPARE(clip.outputOffset(1), 4);
+}
+
+void ClipTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<Clip<Float>, const Clip<Float>&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<Clip<Float>, const Clip<Float>&>{}));
+}
+
+void ClipTest::constructMove() {
+    Clip<Float> a;
+    a.add(Track, offsetof(Instance, value));
+
+    Clip<Float> b{std::move(a)};
+    CORRADE_COMPARE(b.duration(), (Range1D{1.0f, 4.0f}));
+    CORRADE_COMPARE(b.size(), 1);
+
+    Clip<Float> c;
+    c.add(Track2, offsetof(Instance, value2));
+    c = std::move(b);
+    CORRADE_COMPARE(c.duration(), (Range1D{1.0f, 4.0f}));
+    CORRADE_COMPARE(c.size(), 1);
+}
+
+void ClipTest::trackInvalidIndex() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Clip<Float> clip;
+    /* Adding at least one track so the return in the graceful assert can
+       return the first value and not trigger MSVC debug iterator abort */
+    clip.add(TrackView<Float, Float>{}, 0);
+
+    clip.track(1);
+
+    CORRADE_COMPARE(out.str(), "Animation::Clip::track(): index out of range\n");
+}
+
+void ClipTest::outputOffsetInvalidIndex() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Clip<Float> clip;
+    clip.outputOffset(0);
+
+    CORRADE_COMPARE(out.str(), "Animation::Clip::outputOffset(): index out of range\n");
+}
+
+void ClipTest::playerConstruct() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value));
+
+    Instance instance;
+    ClipPlayer<Float> player{clip, &instance};
+    CORRADE_COMPARE(&player.clip(), &clip);
+    CORRADE_COMPARE(player.output(), &instance);
+    CORRADE_VERIFY(player.scaler());
+    CORRADE_COMPARE(player.playCount(), 1);
+    CORRADE_COMPARE(player.state(), State::Stopped);
+}
+
+void ClipTest::playerConstructChrono() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value));
+
+    Instance instance{-1.0f, -1};
+    ClipPlayer<std::chrono::nanoseconds, Float> player{clip, &instance};
+    CORRADE_VERIFY(player.scaler());
+    CORRADE_COMPARE(player.state(), State::Stopped);
+
+    player.play(std::chrono::seconds{2})
+        .advance(std::chrono::milliseconds{3750});
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE(instance.value, 4.0f);
+}
+
+void ClipTest::playerConstructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<ClipPlayer<Float>, const ClipPlayer<Float>&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<ClipPlayer<Float>, const ClipPlayer<Float>&>{}));
+}
+
+void ClipTest::playerConstructMove() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value));
+
+    Instance instance{-1.0f, -1};
+    ClipPlayer<Float> a{clip, &instance};
+    a.setPlayCount(37);
+
+    ClipPlayer<Float> b{std::move(a)};
+    CORRADE_COMPARE(&b.clip(), &clip);
+    CORRADE_COMPARE(b.output(), &instance);
+    CORRADE_COMPARE(b.playCount(), 37);
+
+    Clip<Float> clip2;
+    Instance instance2;
+    ClipPlayer<Float> c{clip2, &instance2};
+    c = std::move(b);
+    CORRADE_COMPARE(&c.clip(), &clip);
+    CORRADE_COMPARE(c.output(), &instance);
+    CORRADE_COMPARE(c.playCount(), 37);
+
+    c.play(2.0f)
+        .advance(3.75f);
+    CORRADE_COMPARE(instance.value, 4.0f);
+}
+
+void ClipTest::playerAdvance() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value))
+        .add(Track2, offsetof(Instance, value2));
+
+    Instance instance{-1.0f, -1};
+    ClipPlayer<Float> player{clip, &instance};
+
+    /* Not playing, nothing is updated */
+    player.advance(1.0f);
+    CORRADE_COMPARE(instance.value, -1.0f);
+    CORRADE_COMPARE(instance.value2, -1);
+
+    player.play(2.0f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE(player.elapsed(4.25f), std::make_pair(0, 2.25f));
+    CORRADE_COMPARE(instance.value, -1.0f);
+
+    /* The duration starts at 0.5, so this is at 2.75 */
+    player.advance(4.25f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE(instance.value, 4.0f);
+    CORRADE_COMPARE(instance.value2, 42);
+}
+
+void ClipTest::playerAdvanceMultipleInstances() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value))
+        .add(Track2, offsetof(Instance, value2));
+
+    /* Each player writes to its own instance, at its own time */
+    Instance instances[2]{{-1.0f, -1}, {-1.0f, -1}};
+    ClipPlayer<Float> a{clip, &instances[0]};
+    ClipPlayer<Float> b{clip, &instances[1]};
+    a.play(2.0f);
+    b.play(1.0f);
+
+    a.advance(4.25f);
+    b.advance(4.25f);
+    CORRADE_COMPARE(instances[0].value, 4.0f);
+    CORRADE_COMPARE(instances[0].value2, 42);
+    CORRADE_COMPARE(instances[1].value, 2.75f);
+    CORRADE_COMPARE(instances[1].value2, -17);
+}
+
+void ClipTest::playerAdvancePauseResume() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value));
+
+    Instance instance{-1.0f, -1};
+    ClipPlayer<Float> player{clip, &instance};
+    player.play(22.0f)
+        .advance(23.75f);
+    CORRADE_COMPARE(instance.value, 4.0f);
+
+    /* Pausing should not update anything */
+    instance.value = -1.0f;
+    player.pause(24.0f);
+    CORRADE_COMPARE(player.state(), State::Paused);
+    CORRADE_COMPARE(player.elapsed(24.0f), std::make_pair(0, 2.0f));
+    CORRADE_COMPARE(instance.value, -1.0f);
+
+    /* But advance() after should, with time of the pause */
+    player.advance(24.5f);
+    CORRADE_COMPARE(player.state(), State::Paused);
+    CORRADE_COMPARE(instance.value, 5.0f);
+
+    /* Advancing further should do nothing */
+    instance.value = -1.0f;
+    player.advance(50.0f);
+    CORRADE_COMPARE(instance.value, -1.0f);
+
+    /* Resuming continues from where it was paused */
+    player.play(100.0f)
+        .advance(100.5f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE(player.elapsed(100.5f), std::make_pair(0, 2.5f));
+    CORRADE_COMPARE(instance.value, 3.5f);
+}
+
+void ClipTest::playerAdvanceStop() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value));
+
+    Instance instance{-1.0f, -1};
+    ClipPlayer<Float> player{clip, &instance};
+    player.play(2.0f)
+        .advance(3.75f);
+    CORRADE_COMPARE(instance.value, 4.0f);
+
+    /* Stopping parks the animation at the beginning on next advance */
+    player.stop();
+    CORRADE_COMPARE(player.state(), State::Stopped);
+    player.advance(4.0f);
+    CORRADE_COMPARE(player.state(), State::Stopped);
+    CORRADE_COMPARE(player.elapsed(4.0f), std::make_pair(0, 0.0f));
+    CORRADE_COMPARE(instance.value, 1.5f);
+}
+
+void ClipTest::playerAdvancePlayCount() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value));
+
+    Instance instance{-1.0f, -1};
+    ClipPlayer<Float> player{clip, &instance};
+    player.setPlayCount(2)
+        .play(2.0f);
+
+    /* Second iteration */
+    player.advance(6.75f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE(player.elapsed(6.75f), std::make_pair(1, 1.75f));
+    CORRADE_COMPARE(instance.value, 4.0f);
+
+    /* Past the end, parks at the duration end */
+    player.advance(10.0f);
+    CORRADE_COMPARE(player.state(), State::Stopped);
+    CORRADE_COMPARE(player.elapsed(10.0f), std::make_pair(1, 3.0f));
+    CORRADE_COMPARE(instance.value, 2.0f);
+}
+
+void ClipTest::playerAdvanceZeroDuration() {
+    const std::pair<Float, Float> data[]{{1.0f, 1.5f}};
+    Clip<Float> clip;
+    clip.add(TrackView<Float, Float>{data, Math::lerp}, offsetof(Instance, value));
+    CORRADE_COMPARE(clip.duration(), (Range1D{1.0f, 1.0f}));
+
+    Instance instance{-1.0f, -1};
+    ClipPlayer<Float> player{clip, &instance};
+    player.play(2.0f)
+        .advance(3.0f);
+    CORRADE_COMPARE(player.state(), State::Stopped);
+    CORRADE_COMPARE(instance.value, 1.5f);
+}
+
+void ClipTest::playerAdvanceClipChanged() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value));
+
+    Instance instance{-1.0f, -1};
+    ClipPlayer<Float> player{clip, &instance};
+
+    /* Adding a track after the player was created shouldn't cause any
+       out-of-bounds access */
+    clip.add(Track2, offsetof(Instance, value2));
+    player.play(2.0f)
+        .advance(4.25f);
+    CORRADE_COMPARE(instance.value, 4.0f);
+    CORRADE_COMPARE(instance.value2, 42);
+}
+
+void ClipTest::playerSetOutput() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value));
+
+    Instance instances[2]{{-1.0f, -1}, {-1.0f, -1}};
+    ClipPlayer<Float> player{clip, &instances[0]};
+    player.play(2.0f)
+        .advance(3.75f);
+    CORRADE_COMPARE(instances[0].value, 4.0f);
+    CORRADE_COMPARE(instances[1].value, -1.0f);
+
+    player.setOutput(&instances[1])
+        .advance(3.75f);
+    CORRADE_COMPARE(player.output(), &instances[1]);
+    CORRADE_COMPARE(instances[1].value, 4.0f);
+}
+
+void ClipTest::playerSetState() {
+    Clip<Float> clip;
+    clip.add(Track, offsetof(Instance, value));
+
+    Instance instance{-1.0f, -1};
+    ClipPlayer<Float> player{clip, &instance};
+    player.setState(State::Playing, 2.0f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+
+    player.setState(State::Paused, 2.5f);
+    CORRADE_COMPARE(player.state(), State::Paused);
+
+    player.setState(State::Stopped, {});
+    CORRADE_COMPARE(player.state(), State::Stopped);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::ClipTest)
@@ -0,0 +1,251 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Animation/Compression.h"
+
+namespace Magnum { namespace Animation { namespace Test {
+
+struct CompressionTest: TestSuite::Tester {
+    explicit CompressionTest();
+
+    void reduceKeyframes();
+    void reduceKeyframesTolerance();
+    void reduceKeyframesQuaternion();
+    void reduceKeyframesEmpty();
+    void reduceKeyframesSingle();
+
+    void packQuaternion();
+    void packQuaternionNegated();
+    void packQuaternionNotNormalized();
+    void slerpPackedQuaternion();
+    void lerpPackedHalf();
+
+    void packRotationTrack();
+    void packHalfTrack();
+};
+
+using namespace Math::Literals;
+
+namespace {
+    const struct {
+        const char* name;
+        Quaternion value;
+    } PackQuaternionData[]{
+        {"identity", Quaternion{}},
+        {"largest X", Quaternion::rotation(165.0_degf, Vector3{0.8f, 0.2f, 0.1f}.normalized())},
+        {"largest Y", Quaternion::rotation(170.0_degf, Vector3{-0.1f, 0.9f, 0.3f}.normalized())},
+        {"largest Z", Quaternion::rotation(-150.0_degf, Vector3{0.3f, 0.1f, 0.8f}.normalized())},
+        {"two equal components", Quaternion::rotation(90.0_degf, Vector3::xAxis())}
+    };
+}
+
+CompressionTest::CompressionTest() {
+    addTests({&CompressionTest::reduceKeyframes,
+              &CompressionTest::reduceKeyframesTolerance,
+              &CompressionTest::reduceKeyframesQuaternion,
+              &CompressionTest::reduceKeyframesEmpty,
+              &CompressionTest::reduceKeyframesSingle});
+
+    addInstancedTests({&CompressionTest::packQuaternion},
+        Containers::arraySize(PackQuaternionData));
+
+    addTests({&CompressionTest::packQuaternionNegated,
+              &CompressionTest::packQuaternionNotNormalized,
+              &CompressionTest::slerpPackedQuaternion,
+              &CompressionTest::lerpPackedHalf,
+
+              &CompressionTest::packRotationTrack,
+              &CompressionTest::packHalfTrack});
+}
+
+void CompressionTest::reduceKeyframes() {
+    /* Keyframes 1, 2 and 4 are exactly on a line between their neighbors */
+    const Track<Float, Vector2> track{{
+        {0.0f, {0.0f, 0.0f}},
+        {1.0f, {1.0f, 2.0f}},
+        {2.0f, {2.0f, 4.0f}},
+        {3.0f, {3.0f, 6.0f}},
+        {4.0f, {3.0f, 5.0f}},
+        {5.0f, {3.0f, 4.0f}}
+    }, Math::lerp, Extrapolation::Extrapolated, Extrapolation::DefaultConstructed};
+
+    const Track<Float, Vector2> reduced = Animation::reduceKeyframes(TrackView<Float, Vector2>{track}, 0.0f);
+    CORRADE_COMPARE(reduced.size(), 3);
+    CORRADE_COMPARE(reduced.keys()[0], 0.0f);
+    CORRADE_COMPARE(reduced.values()[0], (Vector2{0.0f, 0.0f}));
+    CORRADE_COMPARE(reduced.keys()[1], 3.0f);
+    CORRADE_COMPARE(reduced.values()[1], (Vector2{3.0f, 6.0f}));
+    CORRADE_COMPARE(reduced.keys()[2], 5.0f);
+    CORRADE_COMPARE(reduced.values()[2], (Vector2{3.0f, 4.0f}));
+    CORRADE_COMPARE(reduced.interpolator(), track.interpolator());
+    CORRADE_COMPARE(reduced.interpolation(), track.interpolation());
+    CORRADE_COMPARE(reduced.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(reduced.after(), Extrapolation::DefaultConstructed);
+
+    /* Removed keyframes are reconstructed */
+    for(Float key: {1.0f, 2.0f, 4.0f})
+        CORRADE_COMPARE(reduced.at(key), track.at(key));
+}
+
+void CompressionTest::reduceKeyframesTolerance() {
+    const Track<Float, Float> track{{
+        {0.0f, 0.0f},
+        {1.0f, 1.05f},
+        {2.0f, 2.0f},
+        {3.0f, 3.5f},
+        {4.0f, 4.0f}
+    }, Math::lerp};
+
+    /* Keyframe 1 is off by 0.05, keyframe 3 by 0.5 */
+    const Track<Float, Float> reduced = Animation::reduceKeyframes(TrackView<Float, Float>{track}, 0.1f);
+    CORRADE_COMPARE(reduced.size(), 4);
+    CORRADE_COMPARE(reduced.keys()[0], 0.0f);
+    CORRADE_COMPARE(reduced.keys()[1], 2.0f);
+    CORRADE_COMPARE(reduced.keys()[2], 3.0f);
+    CORRADE_COMPARE(reduced.keys()[3], 4.0f);
+
+    /* With a large enough tolerance only the ends are kept */
+    CORRADE_COMPARE(Animation::reduceKeyframes(TrackView<Float, Float>{track}, 1.0f).size(), 2);
+}
+
+void CompressionTest::reduceKeyframesQuaternion() {
+    /* Middle keyframe is on the slerp path between the neighbors, but
+       negated -- it should be treated as the same rotation */
+    const Quaternion a = Quaternion::rotation(0.0_degf, Vector3::zAxis());
+    const Quaternion b = Quaternion::rotation(45.0_degf, Vector3::zAxis());
+    const Quaternion c = Quaternion::rotation(90.0_degf, Vector3::zAxis());
+    const Track<Float, Quaternion> track{{
+        {0.0f, a},
+        {1.0f, -b},
+        {2.0f, c}
+    }, Math::slerp};
+
+    const Track<Float, Quaternion> reduced = Animation::reduceKeyframes(TrackView<Float, Quaternion>{track}, 1.0e-5f);
+    CORRADE_COMPARE(reduced.size(), 2);
+    CORRADE_COMPARE(reduced.at(1.0f), b);
+}
+
+void CompressionTest::reduceKeyframesEmpty() {
+    const Track<Float, Float> reduced = Animation::reduceKeyframes(TrackView<Float, Float>{}, 0.0f);
+    CORRADE_COMPARE(reduced.size(), 0);
+}
+
+void CompressionTest::reduceKeyframesSingle() {
+    const Track<Float, Float> track{{
+        {1.0f, 3.0f}
+    }, Math::lerp};
+
+    const Track<Float, Float> reduced = Animation::reduceKeyframes(TrackView<Float, Float>{track}, 0.0f);
+    CORRADE_COMPARE(reduced.size(), 1);
+    CORRADE_COMPARE(reduced.keys()[0], 1.0f);
+    CORRADE_COMPARE(reduced.values()[0], 3.0f);
+}
+
+void CompressionTest::packQuaternion() {
+    auto&& data = PackQuaternionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Quaternion unpacked = unpackQuaternion(Animation::packQuaternion(data.value));
+    CORRADE_VERIFY(unpacked.isNormalized());
+
+    /* 15 bits per component, the rotation can be negated */
+    const Float error = Math::min((unpacked - data.value).length(), (unpacked + data.value).length());
+    CORRADE_COMPARE_AS(error, 1.0e-4f, TestSuite::Compare::Less);
+}
+
+void CompressionTest::packQuaternionNegated() {
+    const Quaternion a = Quaternion::rotation(35.0_degf, Vector3{1.0f, 2.0f, 3.0f}.normalized());
+    CORRADE_COMPARE(Animation::packQuaternion(-a), Animation::packQuaternion(a));
+}
+
+void CompressionTest::packQuaternionNotNormalized() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Animation::packQuaternion(Quaternion{{1.0f, 2.0f, 3.0f}, 4.0f});
+    CORRADE_COMPARE(out.str(), "Animation::packQuaternion(): Quaternion({1, 2, 3}, 4) is not normalized\n");
+}
+
+void CompressionTest::slerpPackedQuaternion() {
+    const Quaternion a = Quaternion::rotation(10.0_degf, Vector3::xAxis());
+    const Quaternion b = Quaternion::rotation(70.0_degf, Vector3::xAxis());
+
+    /* The second is negated by the packing, which should not cause the
+       interpolation to go the long way around */
+    const Quaternion expected = Quaternion::rotation(40.0_degf, Vector3::xAxis());
+    const Quaternion result = Animation::slerpPackedQuaternion(Animation::packQuaternion(a), Animation::packQuaternion(-b), 0.5f);
+    const Float error = Math::min((result - expected).length(), (result + expected).length());
+    CORRADE_COMPARE_AS(error, 1.0e-4f, TestSuite::Compare::Less);
+}
+
+void CompressionTest::lerpPackedHalf() {
+    CORRADE_COMPARE(Animation::lerpPackedHalf(
+        Math::packHalf(Vector3{1.0f, -2.0f, 0.5f}),
+        Math::packHalf(Vector3{3.0f, 2.0f, 0.25f}), 0.5f),
+        (Vector3{2.0f, 0.0f, 0.375f}));
+}
+
+void CompressionTest::packRotationTrack() {
+    const Track<Float, Quaternion> track{{
+        {0.0f, Quaternion::rotation(0.0_degf, Vector3::yAxis())},
+        {1.0f, Quaternion::rotation(60.0_degf, Vector3::yAxis())},
+        {2.0f, Quaternion::rotation(180.0_degf, Vector3::yAxis())}
+    }, Math::slerp, Extrapolation::Constant, Extrapolation::DefaultConstructed};
+
+    const Track<Float, Math::Vector3<UnsignedShort>, Quaternion> packed = Animation::packRotationTrack(TrackView<Float, Quaternion>{track});
+    CORRADE_COMPARE(packed.size(), 3);
+    CORRADE_COMPARE(packed.keys()[2], 2.0f);
+    CORRADE_COMPARE(packed.before(), Extrapolation::Constant);
+    CORRADE_COMPARE(packed.after(), Extrapolation::DefaultConstructed);
+
+    for(Float key: {0.0f, 0.5f, 1.25f, 1.75f}) {
+        const Quaternion expected = track.at(key);
+        const Quaternion result = packed.at(key);
+        const Float error = Math::min((result - expected).length(), (result + expected).length());
+        CORRADE_COMPARE_AS(error, 1.0e-4f, TestSuite::Compare::Less);
+    }
+}
+
+void CompressionTest::packHalfTrack() {
+    const Track<Float, Vector3> track{{
+        {0.0f, {1.0f, 2.0f, 3.0f}},
+        {2.0f, {-1.0f, 0.5f, 4.0f}}
+    }, Math::lerp, Extrapolation::Extrapolated};
+
+    const Track<Float, Math::Vector3<UnsignedShort>, Vector3> packed = Animation::packHalfTrack(TrackView<Float, Vector3>{track});
+    CORRADE_COMPARE(packed.size(), 2);
+    CORRADE_COMPARE(packed.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(packed.after(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(packed.at(1.0f), (Vector3{0.0f, 1.25f, 3.5f}));
+    CORRADE_COMPARE(packed.at(4.0f), (Vector3{-3.0f, -1.0f, 5.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::CompressionTest)
@@ -0,0 +1,257 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/TrackIndex.h"
+#include "Magnum/Math/DualQuaternion.h"
+
+namespace Magnum { namespace Animation { namespace Test {
+
+/* Unlike Benchmark.cpp, which measures overhead of the sampling functions on
+   tiny tracks that always stay in cache, this measures evaluation of data
+   sized like a crowd of animated characters: 10k tracks with 1k keys each,
+   mixing value types and interpolations, taking several hundred megabytes
+   of memory in total */
+struct LargeBenchmark: TestSuite::Tester {
+    explicit LargeBenchmark();
+
+    void atVector3();
+    void atQuaternion();
+    void atDualQuaternion();
+    void atVector3RandomSeek();
+    void atVector3RandomSeekIndex();
+
+    void playerAdvance();
+    void playerAdvanceColdCache();
+    void playerAdvanceRandomSeek();
+
+    void flushCache();
+
+    std::vector<Track<Float, Vector3>> _translations;
+    std::vector<Track<Float, Quaternion>> _rotations;
+    std::vector<Track<Float, DualQuaternion>> _transformations;
+    std::vector<TrackIndex<Float>> _translationIndices;
+
+    Containers::Array<Vector3> _translationResults;
+    Containers::Array<Quaternion> _rotationResults;
+    Containers::Array<DualQuaternion> _transformationResults;
+
+    Player<Float> _player;
+    Float _time{};
+
+    Containers::Array<char> _cacheFlush;
+    std::mt19937 _random;
+};
+
+namespace {
+    enum: std::size_t {
+        TrackCount = 10000,
+        KeyCount = 1000,
+
+        /* Has to be larger than the LLC to evict all previous data */
+        CacheFlushSize = 64*1024*1024
+    };
+
+    constexpr Float FrameDuration = 1.0f/60.0f;
+}
+
+LargeBenchmark::LargeBenchmark():
+    _translationResults{TrackCount*2/5},
+    _rotationResults{TrackCount*2/5},
+    _transformationResults{TrackCount/5},
+    _cacheFlush{Containers::ValueInit, CacheFlushSize},
+    /* Fixed seed so the runs are comparable */
+    _random{42}
+{
+    addBenchmarks({&LargeBenchmark::atVector3,
+                   &LargeBenchmark::atQuaternion,
+                   &LargeBenchmark::atDualQuaternion,
+                   &LargeBenchmark::atVector3RandomSeek,
+                   &LargeBenchmark::atVector3RandomSeekIndex,
+
+                   &LargeBenchmark::playerAdvance}, 10);
+
+    /* Each iteration flushes the cache or seeks to a random position outside
+       of the measured block */
+    addBenchmarks({&LargeBenchmark::playerAdvanceColdCache,
+                   &LargeBenchmark::playerAdvanceRandomSeek}, 100);
+
+    std::uniform_real_distribution<Float> unit{0.0f, 1.0f};
+    std::uniform_real_distribution<Float> position{-10.0f, 10.0f};
+    auto randomVector = [&]() {
+        return Vector3{position(_random), position(_random), position(_random)};
+    };
+    auto randomRotation = [&]() {
+        return Quaternion::rotation(Deg(unit(_random)*360.0f), randomVector().normalized());
+    };
+
+    /* Keys sampled at roughly 30 FPS with jitter, so the tracks don't all
+       have their keys at the same time */
+    auto keys = [&](Containers::ArrayView<Float> out) {
+        for(std::size_t i = 0; i != out.size(); ++i)
+            out[i] = (Float(i) + unit(_random)*0.5f)/30.0f;
+    };
+
+    /* Two fifths of the tracks are translations and scalings, alternating
+       between linear and constant interpolation, two fifths rotations, again
+       alternating, and one fifth dual quaternion transformations */
+    Float keyData[KeyCount];
+    _translations.reserve(_translationResults.size());
+    for(std::size_t i = 0; i != _translationResults.size(); ++i) {
+        keys(keyData);
+        Containers::Array<std::pair<Float, Vector3>> data{KeyCount};
+        for(std::size_t j = 0; j != KeyCount; ++j)
+            data[j] = {keyData[j], randomVector()};
+        _translations.emplace_back(std::move(data), i % 2 ? Interpolation::Constant : Interpolation::Linear, Extrapolation::Constant);
+        _player.add(_translations.back(), _translationResults[i]);
+        _translationIndices.emplace_back(_translations.back().keys());
+    }
+
+    _rotations.reserve(_rotationResults.size());
+    for(std::size_t i = 0; i != _rotationResults.size(); ++i) {
+        keys(keyData);
+        Containers::Array<std::pair<Float, Quaternion>> data{KeyCount};
+        for(std::size_t j = 0; j != KeyCount; ++j)
+            data[j] = {keyData[j], randomRotation()};
+        _rotations.emplace_back(std::move(data), i % 2 ? Interpolation::Constant : Interpolation::Linear, Extrapolation::Constant);
+        _player.add(_rotations.back(), _rotationResults[i]);
+    }
+
+    _transformations.reserve(_transformationResults.size());
+    for(std::size_t i = 0; i != _transformationResults.size(); ++i) {
+        keys(keyData);
+        Containers::Array<std::pair<Float, DualQuaternion>> data{KeyCount};
+        for(std::size_t j = 0; j != KeyCount; ++j)
+            data[j] = {keyData[j], DualQuaternion::translation(randomVector())*DualQuaternion{randomRotation()}};
+        _transformations.emplace_back(std::move(data), Interpolation::Linear, Extrapolation::Constant);
+        _player.add(_transformations.back(), _transformationResults[i]);
+    }
+
+    _player.setPlayCount(0)
+        .play(0.0f);
+}
+
+void LargeBenchmark::flushCache() {
+    for(std::size_t i = 0; i < _cacheFlush.size(); i += 64)
+        ++_cacheFlush[i];
+}
+
+void LargeBenchmark::atVector3() {
+    std::size_t hints[TrackCount*2/5]{};
+    Vector3 result;
+    CORRADE_BENCHMARK(10) {
+        _time += FrameDuration;
+        for(std::size_t i = 0; i != _translations.size(); ++i)
+            result += _translations[i].at(_time, hints[i]);
+    }
+    CORRADE_VERIFY(result != Vector3{});
+}
+
+void LargeBenchmark::atQuaternion() {
+    std::size_t hints[TrackCount*2/5]{};
+    Quaternion result;
+    CORRADE_BENCHMARK(10) {
+        _time += FrameDuration;
+        for(std::size_t i = 0; i != _rotations.size(); ++i)
+            result = result*_rotations[i].at(_time, hints[i]);
+    }
+    CORRADE_VERIFY(result != Quaternion{});
+}
+
+void LargeBenchmark::atDualQuaternion() {
+    std::size_t hints[TrackCount/5]{};
+    DualQuaternion result;
+    CORRADE_BENCHMARK(10) {
+        _time += FrameDuration;
+        for(std::size_t i = 0; i != _transformations.size(); ++i)
+            result = result*_transformations[i].at(_time, hints[i]);
+    }
+    CORRADE_VERIFY(result != DualQuaternion{});
+}
+
+void LargeBenchmark::atVector3RandomSeek() {
+    /* Each track is evaluated at a different random time, so the hint from
+       the previous iteration is useless */
+    std::uniform_real_distribution<Float> time{0.0f, KeyCount/30.0f};
+    std::size_t hints[TrackCount*2/5]{};
+    Vector3 result;
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != _translations.size(); ++i)
+            result += _translations[i].at(time(_random), hints[i]);
+    }
+    CORRADE_VERIFY(result != Vector3{});
+}
+
+void LargeBenchmark::atVector3RandomSeekIndex() {
+    std::uniform_real_distribution<Float> time{0.0f, KeyCount/30.0f};
+    Vector3 result;
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != _translations.size(); ++i) {
+            const Float frame = time(_random);
+            std::size_t hint = _translationIndices[i].hint(frame);
+            result += _translations[i].at(frame, hint);
+        }
+    }
+    CORRADE_VERIFY(result != Vector3{});
+}
+
+void LargeBenchmark::playerAdvance() {
+    CORRADE_BENCHMARK(10) {
+        _time += FrameDuration;
+        _player.advance(_time);
+    }
+    CORRADE_VERIFY(_rotationResults[0].isNormalized());
+}
+
+void LargeBenchmark::playerAdvanceColdCache() {
+    /* Twice the cache size worth of writes to make sure nothing of the
+       animation data stays */
+    flushCache();
+    flushCache();
+
+    CORRADE_BENCHMARK(1) {
+        _time += FrameDuration;
+        _player.advance(_time);
+    }
+    CORRADE_VERIFY(_rotationResults[0].isNormalized());
+}
+
+void LargeBenchmark::playerAdvanceRandomSeek() {
+    /* The stored hints are useless after a seek, the player has to fall back
+       to a binary search */
+    _time += std::uniform_real_distribution<Float>{0.0f, KeyCount/30.0f}(_random);
+
+    CORRADE_BENCHMARK(1)
+        _player.advance(_time);
+    CORRADE_VERIFY(_rotationResults[0].isNormalized());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::LargeBenchmark)
@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Animation/PlayerGroup.h"
+
+namespace Magnum { namespace Animation { namespace Test {
+
+struct PlayerGroupTest: TestSuite::Tester {
+    explicit PlayerGroupTest();
+
+    void construct();
+    void addRemove();
+    void addDuplicate();
+    void removeNotFound();
+    void clear();
+    void setThreadCount();
+
+    void advance();
+    void advanceBelowThreshold();
+    void advanceMultithreaded();
+};
+
+PlayerGroupTest::PlayerGroupTest() {
+    addTests({&PlayerGroupTest::construct,
+              &PlayerGroupTest::addRemove,
+              &PlayerGroupTest::addDuplicate,
+              &PlayerGroupTest::removeNotFound,
+              &PlayerGroupTest::clear,
+              &PlayerGroupTest::setThreadCount,
+
+              &PlayerGroupTest::advance,
+              &PlayerGroupTest::advanceBelowThreshold,
+              &PlayerGroupTest::advanceMultithreaded});
+}
+
+namespace {
+    const Animation::Track<Float, Float> Track{{
+        {1.0f, 1.5f},
+        {2.5f, 3.0f},
+        {3.0f, 5.0f},
+        {4.0f, 2.0f}
+    }, Math::lerp};
+}
+
+void PlayerGroupTest::construct() {
+    PlayerGroup<Float> group;
+    CORRADE_VERIFY(group.isEmpty());
+    CORRADE_COMPARE(group.size(), 0);
+    CORRADE_COMPARE(group.threadCount(), 1);
+}
+
+void PlayerGroupTest::addRemove() {
+    Player<Float> a, b, c;
+
+    PlayerGroup<Float> group;
+    group.add(a)
+        .add(b)
+        .add(c);
+    CORRADE_VERIFY(!group.isEmpty());
+    CORRADE_COMPARE(group.size(), 3);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &b);
+    CORRADE_COMPARE(&group[2], &c);
+
+    /* Order of the remaining players is preserved */
+    group.remove(a);
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(&group[0], &b);
+    CORRADE_COMPARE(&group[1], &c);
+}
+
+void PlayerGroupTest::addDuplicate() {
+    Player<Float> a;
+
+    PlayerGroup<Float> group;
+    group.add(a);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    group.add(a);
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_COMPARE(out.str(), "Animation::PlayerGroup::add(): player is already in the group\n");
+}
+
+void PlayerGroupTest::removeNotFound() {
+    Player<Float> a, b;
+
+    PlayerGroup<Float> group;
+    group.add(a);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    group.remove(b);
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_COMPARE(out.str(), "Animation::PlayerGroup::remove(): player is not in the group\n");
+}
+
+void PlayerGroupTest::clear() {
+    Player<Float> a, b;
+
+    PlayerGroup<Float> group;
+    group.add(a)
+        .add(b)
+        .clear();
+    CORRADE_VERIFY(group.isEmpty());
+}
+
+void PlayerGroupTest::setThreadCount() {
+    PlayerGroup<Float> group;
+    group.setThreadCount(0);
+    CORRADE_COMPARE(group.threadCount(), 1);
+
+    group.setThreadCount(4);
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_COMPARE(group.threadCount(), 4);
+    #else
+    CORRADE_COMPARE(group.threadCount(), 1);
+    #endif
+}
+
+void PlayerGroupTest::advance() {
+    Float a = -1.0f, b = -1.0f, c = -1.0f;
+    Player<Float> playerA, playerB, playerC;
+    playerA.add(Track, a)
+        .play(0.0f);
+    playerB.add(Track, b)
+        .play(1.0f);
+    /* Not playing, so the value stays untouched */
+    playerC.add(Track, c);
+
+    PlayerGroup<Float> group;
+    group.add(playerA)
+        .add(playerB)
+        .add(playerC)
+        .advance(1.75f);
+    CORRADE_COMPARE(a, 4.0f);
+    CORRADE_COMPARE(b, 2.25f);
+    CORRADE_COMPARE(c, -1.0f);
+}
+
+void PlayerGroupTest::advanceBelowThreshold() {
+    /* Enabling threads for a small group does the same as the serial case */
+    Float values[PlayerGroup<Float>::ParallelAdvanceThreshold - 1];
+    Player<Float> players[PlayerGroup<Float>::ParallelAdvanceThreshold - 1];
+
+    PlayerGroup<Float> group;
+    group.setThreadCount(4);
+    for(std::size_t i = 0; i != Containers::arraySize(players); ++i) {
+        values[i] = -1.0f;
+        players[i].add(Track, values[i])
+            .play(-Float(i%2));
+        group.add(players[i]);
+    }
+
+    group.advance(0.75f);
+    for(std::size_t i = 0; i != Containers::arraySize(players); ++i) {
+        CORRADE_COMPARE(values[i], i%2 ? 4.0f : 2.25f);
+    }
+}
+
+void PlayerGroupTest::advanceMultithreaded() {
+    /* Not a multiple of thread and task count to test uneven distribution */
+    Float values[PlayerGroup<Float>::ParallelAdvanceThreshold*3 + 7];
+    Player<Float> players[PlayerGroup<Float>::ParallelAdvanceThreshold*3 + 7];
+
+    PlayerGroup<Float> group;
+    group.setThreadCount(3);
+    for(std::size_t i = 0; i != Containers::arraySize(players); ++i) {
+        values[i] = -1.0f;
+        players[i].add(Track, values[i])
+            .play(-Float(i%2));
+        group.add(players[i]);
+    }
+
+    group.advance(0.75f);
+    for(std::size_t i = 0; i != Containers::arraySize(players); ++i) {
+        CORRADE_COMPARE(values[i], i%2 ? 4.0f : 2.25f);
+    }
+
+    /* Half of the players gets stopped by itself, writing the final value */
+    group.advance(2.5f);
+    for(std::size_t i = 0; i != Containers::arraySize(players); ++i) {
+        CORRADE_COMPARE(players[i].state(), i%2 ? State::Stopped : State::Playing);
+        CORRADE_COMPARE(values[i], i%2 ? 2.0f : 3.5f);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::PlayerGroupTest)
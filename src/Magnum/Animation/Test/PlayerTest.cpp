@@ -67,6 +67,9 @@ struct PlayerTest: TestSuite::Tester {
     void addWithCallbackOnChange();
     void addWithCallbackOnChangeTemplate();
     void addRawCallback();
+    void addBatch();
+    void addBatchDefaultConstructed();
+    void addBatchInvalid();
 
     void runFor100YearsFloat();
     void runFor100YearsChrono();
@@ -135,7 +138,10 @@ PlayerTest::PlayerTest() {
               &PlayerTest::addWithCallbackTemplate,
               &PlayerTest::addWithCallbackOnChange,
               &PlayerTest::addWithCallbackOnChangeTemplate,
-              &PlayerTest::addRawCallback});
+              &PlayerTest::addRawCallback,
+              &PlayerTest::addBatch,
+              &PlayerTest::addBatchDefaultConstructed,
+              &PlayerTest::addBatchInvalid});
 
     addInstancedTests({
         &PlayerTest::runFor100YearsFloat,
@@ -932,6 +938,103 @@ void PlayerTest::addRawCallback() {
     CORRADE_COMPARE(data, std::vector<Int>{0});
 }
 
+void PlayerTest::addBatch() {
+    /* Separate key data with the same values as in Track, should be accepted
+       as well */
+    const Float keys[]{1.0f, 2.5f, 3.0f, 4.0f};
+    const Float values[]{3.0f, 6.0f, 10.0f, 4.0f};
+    const TrackView<Float, Float> tracks[]{
+        TrackView<Float, Float>{Track},
+        TrackView<Float, Float>{Containers::arrayView(keys), Containers::arrayView(values), Math::lerp}
+    };
+
+    Float result[]{-1.0f, -1.0f};
+    Player<Float> player;
+    player.addBatch(Containers::arrayView(tracks), Containers::arrayView(result))
+        .play(2.0f);
+
+    CORRADE_COMPARE(player.size(), 1);
+    CORRADE_COMPARE(player.duration().size(), 3.0f);
+    CORRADE_COMPARE(player.track(0).keys().data(), Track.keys().data());
+    CORRADE_COMPARE(result[0], -1.0f);
+    CORRADE_COMPARE(result[1], -1.0f);
+
+    /* 1.75 secs in */
+    player.advance(3.75f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE(result[0], 4.0f);
+    CORRADE_COMPARE(result[1], 8.0f);
+
+    /* Same as with individual tracks */
+    Float value0 = -1.0f, value1 = -1.0f;
+    Player<Float> individual;
+    individual.add(tracks[0], value0)
+        .add(tracks[1], value1)
+        .play(2.0f)
+        .advance(3.75f);
+    CORRADE_COMPARE(result[0], value0);
+    CORRADE_COMPARE(result[1], value1);
+}
+
+void PlayerTest::addBatchDefaultConstructed() {
+    const Float keys[]{1.0f, 2.5f};
+    const Float values[]{1.5f, 3.0f};
+    const Float values2[]{3.0f, 6.0f};
+    const TrackView<Float, Float> tracks[]{
+        {Containers::arrayView(keys), Containers::arrayView(values), Math::lerp, Extrapolation::DefaultConstructed},
+        {Containers::arrayView(keys), Containers::arrayView(values2), Math::lerp, Extrapolation::DefaultConstructed}
+    };
+
+    Float result[]{-1.0f, -1.0f};
+    Player<Float> player;
+    player.addBatch(Containers::arrayView(tracks), Containers::arrayView(result))
+        .setDuration({0.0f, 2.5f})
+        .play(0.0f);
+
+    /* Before the first keyframe */
+    player.advance(0.5f);
+    CORRADE_COMPARE(result[0], 0.0f);
+    CORRADE_COMPARE(result[1], 0.0f);
+
+    player.advance(1.75f);
+    CORRADE_COMPARE(result[0], 2.25f);
+    CORRADE_COMPARE(result[1], 4.5f);
+}
+
+void PlayerTest::addBatchInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Float keys[]{1.0f, 2.5f, 3.5f, 4.0f};
+    const Float values[]{3.0f, 6.0f, 10.0f, 4.0f};
+    const TrackView<Float, Float> different[]{
+        TrackView<Float, Float>{Track},
+        TrackView<Float, Float>{Containers::arrayView(keys), Containers::arrayView(values), Math::lerp}
+    };
+    const TrackView<Float, Float> differentInterpolation[]{
+        TrackView<Float, Float>{Track},
+        TrackView<Float, Float>{Track.keys(), Track.values(), Math::select}
+    };
+    const TrackView<Float, Float> differentExtrapolation[]{
+        TrackView<Float, Float>{Track},
+        TrackView<Float, Float>{Track.keys(), Track.values(), Math::lerp, Extrapolation::Constant}
+    };
+
+    Float result[2];
+    Player<Float> player;
+    player.addBatch(Containers::ArrayView<const TrackView<Float, Float>>{}, Containers::ArrayView<Float>{});
+    player.addBatch(Containers::arrayView(different), Containers::arrayView(result, 1));
+    player.addBatch(Containers::arrayView(different), Containers::arrayView(result));
+    player.addBatch(Containers::arrayView(differentInterpolation), Containers::arrayView(result));
+    player.addBatch(Containers::arrayView(differentExtrapolation), Containers::arrayView(result));
+    CORRADE_COMPARE(out.str(),
+        "Animation::Player::addBatch(): expected at least one track\n"
+        "Animation::Player::addBatch(): expected 2 destination items but got 1\n"
+        "Animation::Player::addBatch(): track 1 has different keyframes than the first track\n"
+        "Animation::Player::addBatch(): track 1 has different interpolation or extrapolation than the first track\n"
+        "Animation::Player::addBatch(): track 1 has different interpolation or extrapolation than the first track\n");
+}
+
 void PlayerTest::runFor100YearsFloat() {
     auto&& data = RunFor100YearsData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
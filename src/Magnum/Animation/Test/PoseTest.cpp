@@ -0,0 +1,238 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Animation/Pose.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Animation { namespace Test {
+
+struct PoseTest: TestSuite::Tester {
+    explicit PoseTest();
+
+    void construct();
+    void constructDefault();
+
+    void blend();
+    void blendInPlace();
+    void blendMasked();
+    void blendAdditive();
+    void blendInvalid();
+
+    void applyPose();
+    void applyPoseInvalid();
+};
+
+PoseTest::PoseTest() {
+    addTests({&PoseTest::construct,
+              &PoseTest::constructDefault,
+
+              &PoseTest::blend,
+              &PoseTest::blendInPlace,
+              &PoseTest::blendMasked,
+              &PoseTest::blendAdditive,
+              &PoseTest::blendInvalid,
+
+              &PoseTest::applyPose,
+              &PoseTest::applyPoseInvalid});
+}
+
+using namespace Math::Literals;
+
+void PoseTest::construct() {
+    Pose pose{3};
+    CORRADE_COMPARE(pose.size(), 3);
+    CORRADE_COMPARE(pose.translations().size(), 3);
+    CORRADE_COMPARE(pose.rotations().size(), 3);
+    CORRADE_COMPARE(pose.scalings().size(), 3);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_COMPARE(pose.translations()[i], Vector3{});
+        CORRADE_COMPARE(pose.rotations()[i], Quaternion{});
+        CORRADE_COMPARE(pose.scalings()[i], Vector3{1.0f});
+    }
+}
+
+void PoseTest::constructDefault() {
+    Pose pose;
+    CORRADE_COMPARE(pose.size(), 0);
+    CORRADE_VERIFY(pose.translations().empty());
+}
+
+namespace {
+    Pose makePose(const Vector3& translation, const Quaternion& rotation, const Vector3& scaling) {
+        Pose pose{2};
+        pose.translations()[1] = translation;
+        pose.rotations()[1] = rotation;
+        pose.scalings()[1] = scaling;
+        return pose;
+    }
+}
+
+void PoseTest::blend() {
+    Pose a = makePose({2.0f, 0.0f, 0.0f}, Quaternion::rotation(0.0_degf, Vector3::xAxis()), Vector3{2.0f});
+    Pose b = makePose({4.0f, 2.0f, 0.0f}, Quaternion::rotation(90.0_degf, Vector3::xAxis()), Vector3{4.0f});
+    Pose out{2};
+
+    Animation::blend(a, b, 0.5f, out);
+
+    /* Identical bones stay the same */
+    CORRADE_COMPARE(out.translations()[0], Vector3{});
+    CORRADE_COMPARE(out.rotations()[0], Quaternion{});
+    CORRADE_COMPARE(out.scalings()[0], Vector3{1.0f});
+
+    CORRADE_COMPARE(out.translations()[1], (Vector3{3.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(out.rotations()[1], Quaternion::rotation(45.0_degf, Vector3::xAxis()));
+    CORRADE_COMPARE(out.scalings()[1], Vector3{3.0f});
+}
+
+void PoseTest::blendInPlace() {
+    Pose a = makePose({2.0f, 0.0f, 0.0f}, Quaternion{}, Vector3{2.0f});
+    Pose b = makePose({4.0f, 2.0f, 0.0f}, Quaternion{}, Vector3{4.0f});
+
+    Animation::blend(a, b, 0.25f, a);
+    CORRADE_COMPARE(a.translations()[1], (Vector3{2.5f, 0.5f, 0.0f}));
+    CORRADE_COMPARE(a.scalings()[1], Vector3{2.5f});
+}
+
+void PoseTest::blendMasked() {
+    Pose a{3};
+    Pose b{3};
+    for(std::size_t i = 0; i != 3; ++i) {
+        b.translations()[i] = {4.0f, 0.0f, 0.0f};
+        b.rotations()[i] = Quaternion::rotation(90.0_degf, Vector3::yAxis());
+        b.scalings()[i] = Vector3{3.0f};
+    }
+    Pose out{3};
+
+    const Float factors[]{0.0f, 0.5f, 1.0f};
+    Animation::blendMasked(a, b, factors, out);
+
+    CORRADE_COMPARE(out.translations()[0], Vector3{});
+    CORRADE_COMPARE(out.rotations()[0], Quaternion{});
+    CORRADE_COMPARE(out.scalings()[0], Vector3{1.0f});
+
+    CORRADE_COMPARE(out.translations()[1], (Vector3{2.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(out.rotations()[1], Quaternion::rotation(45.0_degf, Vector3::yAxis()));
+    CORRADE_COMPARE(out.scalings()[1], Vector3{2.0f});
+
+    CORRADE_COMPARE(out.translations()[2], (Vector3{4.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(out.rotations()[2], Quaternion::rotation(90.0_degf, Vector3::yAxis()));
+    CORRADE_COMPARE(out.scalings()[2], Vector3{3.0f});
+}
+
+void PoseTest::blendAdditive() {
+    Pose base = makePose({1.0f, 2.0f, 3.0f}, Quaternion::rotation(30.0_degf, Vector3::zAxis()), Vector3{2.0f});
+    Pose additive = makePose({2.0f, 0.0f, -2.0f}, Quaternion::rotation(90.0_degf, Vector3::zAxis()), Vector3{3.0f});
+    Pose out{2};
+
+    Animation::blendAdditive(base, additive, 0.5f, out);
+
+    /* Rest pose added to rest pose is again a rest pose */
+    CORRADE_COMPARE(out.translations()[0], Vector3{});
+    CORRADE_COMPARE(out.rotations()[0], Quaternion{});
+    CORRADE_COMPARE(out.scalings()[0], Vector3{1.0f});
+
+    CORRADE_COMPARE(out.translations()[1], (Vector3{2.0f, 2.0f, 2.0f}));
+    CORRADE_COMPARE(out.rotations()[1], Quaternion::rotation(75.0_degf, Vector3::zAxis()));
+    CORRADE_COMPARE(out.scalings()[1], Vector3{4.0f});
+
+    /* Full factor applies the whole additive pose */
+    Animation::blendAdditive(base, additive, 1.0f, out);
+    CORRADE_COMPARE(out.translations()[1], (Vector3{3.0f, 2.0f, 1.0f}));
+    CORRADE_COMPARE(out.rotations()[1], Quaternion::rotation(120.0_degf, Vector3::zAxis()));
+    CORRADE_COMPARE(out.scalings()[1], Vector3{6.0f});
+}
+
+void PoseTest::blendInvalid() {
+    Pose a{2};
+    Pose b{3};
+    Pose out{2};
+    const Float factors[3]{};
+
+    std::ostringstream out_;
+    Error redirectError{&out_};
+    Animation::blend(a, b, 0.5f, out);
+    Animation::blendAdditive(a, b, 0.5f, out);
+    Animation::blendMasked(a, b, factors, out);
+    Animation::blendMasked(a, a, factors, out);
+    CORRADE_COMPARE(out_.str(),
+        "Animation::blend(): expected poses of the same size but got 2, 3 and 2\n"
+        "Animation::blendAdditive(): expected poses of the same size but got 2, 3 and 2\n"
+        "Animation::blendMasked(): expected poses of the same size but got 2, 3 and 2\n"
+        "Animation::blendMasked(): expected 2 factors but got 3\n");
+}
+
+namespace {
+    struct Object {
+        Object& setTranslation(const Vector3& value) {
+            translation = value;
+            return *this;
+        }
+        Object& setRotation(const Quaternion& value) {
+            rotation = value;
+            return *this;
+        }
+        Object& setScaling(const Vector3& value) {
+            scaling = value;
+            return *this;
+        }
+
+        Vector3 translation;
+        Quaternion rotation;
+        Vector3 scaling;
+    };
+}
+
+void PoseTest::applyPose() {
+    Pose pose = makePose({1.0f, 2.0f, 3.0f}, Quaternion::rotation(30.0_degf, Vector3::zAxis()), Vector3{2.0f});
+
+    Object a, b;
+    Object* const objects[]{&a, &b};
+    Animation::applyPose<Object>(pose, objects);
+
+    CORRADE_COMPARE(a.translation, Vector3{});
+    CORRADE_COMPARE(a.rotation, Quaternion{});
+    CORRADE_COMPARE(a.scaling, Vector3{1.0f});
+    CORRADE_COMPARE(b.translation, (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(b.rotation, Quaternion::rotation(30.0_degf, Vector3::zAxis()));
+    CORRADE_COMPARE(b.scaling, Vector3{2.0f});
+}
+
+void PoseTest::applyPoseInvalid() {
+    Pose pose{2};
+    Object a;
+    Object* const objects[]{&a};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Animation::applyPose<Object>(pose, objects);
+    CORRADE_COMPARE(out.str(), "Animation::applyPose(): expected 2 objects but got 1\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::PoseTest)
@@ -0,0 +1,169 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Animation/Track.h"
+#include "Magnum/Animation/TrackIndex.h"
+#include "Magnum/Math/Constants.h"
+
+namespace Magnum { namespace Animation { namespace Test {
+
+struct TrackIndexTest: TestSuite::Tester {
+    explicit TrackIndexTest();
+
+    void constructDefault();
+    void construct();
+    void constructDefaultBucketCount();
+    void constructTooFewKeys();
+    void constructZeroDuration();
+
+    void hint();
+    void hintUneven();
+    void hintOutOfRange();
+    void hintIntegerKeys();
+
+    void at();
+};
+
+TrackIndexTest::TrackIndexTest() {
+    addTests({&TrackIndexTest::constructDefault,
+              &TrackIndexTest::construct,
+              &TrackIndexTest::constructDefaultBucketCount,
+              &TrackIndexTest::constructTooFewKeys,
+              &TrackIndexTest::constructZeroDuration,
+
+              &TrackIndexTest::hint,
+              &TrackIndexTest::hintUneven,
+              &TrackIndexTest::hintOutOfRange,
+              &TrackIndexTest::hintIntegerKeys,
+
+              &TrackIndexTest::at});
+}
+
+namespace {
+    const Float Keys[]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+
+    /* Most of the keys are crammed at the beginning */
+    const Float UnevenKeys[]{0.0f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 8.0f};
+}
+
+void TrackIndexTest::constructDefault() {
+    TrackIndex<Float> index;
+    CORRADE_COMPARE(index.bucketCount(), 0);
+    CORRADE_COMPARE(index.hint(3.5f), 0);
+}
+
+void TrackIndexTest::construct() {
+    TrackIndex<Float> index{Containers::arrayView(Keys), 8};
+    CORRADE_COMPARE(index.bucketCount(), 8);
+}
+
+void TrackIndexTest::constructDefaultBucketCount() {
+    TrackIndex<Float> index{Containers::arrayView(Keys)};
+    CORRADE_COMPARE(index.bucketCount(), 5);
+}
+
+void TrackIndexTest::constructTooFewKeys() {
+    TrackIndex<Float> index{Containers::arrayView(Keys).prefix(1)};
+    CORRADE_COMPARE(index.bucketCount(), 0);
+    CORRADE_COMPARE(index.hint(3.5f), 0);
+}
+
+void TrackIndexTest::constructZeroDuration() {
+    const Float keys[]{2.0f, 2.0f, 2.0f};
+    TrackIndex<Float> index{Containers::arrayView(keys)};
+    CORRADE_COMPARE(index.bucketCount(), 3);
+    CORRADE_COMPARE(index.hint(1.0f), 0);
+    CORRADE_COMPARE(index.hint(2.0f), 0);
+    CORRADE_COMPARE(index.hint(3.0f), 0);
+}
+
+void TrackIndexTest::hint() {
+    TrackIndex<Float> index{Containers::arrayView(Keys), 8};
+
+    /* The hint is the last key that's fully before the bucket */
+    CORRADE_COMPARE(index.hint(0.0f), 0);
+    CORRADE_COMPARE(index.hint(0.4f), 0);
+    CORRADE_COMPARE(index.hint(1.2f), 0);
+    CORRADE_COMPARE(index.hint(1.6f), 1);
+    CORRADE_COMPARE(index.hint(2.7f), 2);
+    CORRADE_COMPARE(index.hint(3.9f), 3);
+    CORRADE_COMPARE(index.hint(4.0f), 3);
+}
+
+void TrackIndexTest::hintUneven() {
+    TrackIndex<Float> index{Containers::arrayView(UnevenKeys)};
+
+    /* All dense keys are in the first bucket, where the search goes from the
+       beginning */
+    CORRADE_COMPARE(index.hint(0.35f), 0);
+    CORRADE_COMPARE(index.hint(1.5f), 5);
+    CORRADE_COMPARE(index.hint(7.9f), 5);
+
+    /* More buckets help */
+    TrackIndex<Float> finer{Containers::arrayView(UnevenKeys), 64};
+    CORRADE_COMPARE(finer.hint(0.35f), 2);
+}
+
+void TrackIndexTest::hintOutOfRange() {
+    TrackIndex<Float> index{Containers::arrayView(Keys)};
+    CORRADE_COMPARE(index.hint(-100.0f), 0);
+    CORRADE_COMPARE(index.hint(100.0f), 3);
+    CORRADE_COMPARE(index.hint(Constants::nan()), 0);
+}
+
+void TrackIndexTest::hintIntegerKeys() {
+    const Int keys[]{-10, 0, 10, 20, 30};
+    TrackIndex<Int> index{Containers::arrayView(keys)};
+    CORRADE_COMPARE(index.hint(-10), 0);
+    CORRADE_COMPARE(index.hint(15), 2);
+    CORRADE_COMPARE(index.hint(25), 3);
+}
+
+void TrackIndexTest::at() {
+    const std::pair<Float, Float> data[]{
+        {0.0f, 3.0f},
+        {1.0f, 1.0f},
+        {2.5f, 2.5f},
+        {3.0f, 0.0f},
+        {5.0f, 1.0f},
+        {6.0f, 4.0f}
+    };
+    const TrackView<Float, Float> track{data, Math::lerp, Extrapolation::Extrapolated};
+    TrackIndex<Float> index{track.keys()};
+
+    /* Results should be the same as without a hint, in any order */
+    for(Float frame: {5.5f, 0.5f, 2.75f, -1.0f, 7.0f, 1.75f, 3.5f}) {
+        std::size_t hint = index.hint(frame);
+        CORRADE_COMPARE(track.at(frame, hint), track.at(frame));
+        std::size_t strictHint = index.hint(frame);
+        CORRADE_COMPARE(track.atStrict(frame, strictHint), track.at(frame));
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::TrackIndexTest)
@@ -82,6 +82,11 @@ remember last used keyframe index and pass it in the next iteration as a hint:
 
 @snippet MagnumAnimation.cpp Track-performance-hint
 
+The hint is useful only if the frames are passed in an increasing order. For
+random access into long tracks, such as when seeking or when many players
+share one track at different time offsets, use a @ref TrackIndex to calculate
+a good hint for any frame in constant time.
+
 @subsection Animation-Track-performance-strict Strict interpolation
 
 While it's possible to have different @ref Extrapolation modes for frames
@@ -0,0 +1,145 @@
+#ifndef Magnum_Animation_TrackIndex_h
+#define Magnum_Animation_TrackIndex_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::TrackIndex
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Animation/Animation.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Keyframe search acceleration index
+
+The keyframe search in @ref Track::at() and @ref TrackView::at() is linear
+from the passed hint, which is fast for continuous playback but degrades to
+@f$ \mathcal{O}(n) @f$ when seeking to an arbitrary position or when many
+players share one track with random time offsets. The index splits the track
+duration into buckets of uniform length and remembers the last keyframe
+before each of them, so a good hint for any frame can be calculated in
+constant time:
+
+@snippet MagnumAnimation.cpp TrackIndex-usage
+
+With the default bucket count equal to the keyframe count and keys that are
+sampled at a roughly uniform rate, the search then goes over at most a few
+keyframes, regardless of the track length. Keys that are distributed very
+unevenly may need more buckets to achieve the same. The index stores one
+@cpp std::size_t @ce per bucket and doesn't reference the keys after
+construction, however it has to be rebuilt if the keys change.
+@see @ref Animation-Track-performance-hint
+@experimental
+*/
+template<class K> class TrackIndex {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty index, for which @ref hint() always returns
+         * @cpp 0 @ce.
+         */
+        explicit TrackIndex() noexcept: _begin{}, _scale{} {}
+
+        /**
+         * @brief Constructor
+         * @param keys          Keyframe keys, expected to be sorted
+         * @param bucketCount   Bucket count
+         *
+         * If @p keys have less than two items or @p bucketCount is zero,
+         * the index is empty.
+         */
+        explicit TrackIndex(const Containers::StridedArrayView<const K>& keys, std::size_t bucketCount);
+
+        /**
+         * @brief Construct with a bucket count equal to the keyframe count
+         *
+         * Equivalent to calling @ref TrackIndex(const Containers::StridedArrayView<const K>&, std::size_t)
+         * with @p bucketCount set to @cpp keys.size() @ce.
+         */
+        explicit TrackIndex(const Containers::StridedArrayView<const K>& keys): TrackIndex{keys, keys.size()} {}
+
+        /** @brief Bucket count */
+        std::size_t bucketCount() const { return _buckets.size(); }
+
+        /**
+         * @brief Keyframe search hint for given frame
+         *
+         * Returns index of a keyframe that's not after @p frame, which can
+         * be passed directly to @ref Track::at(K, std::size_t&) const,
+         * @ref Track::atStrict(K, std::size_t&) const or the
+         * @ref TrackView equivalents. Frames before the first key return
+         * @cpp 0 @ce.
+         */
+        std::size_t hint(K frame) const;
+
+    private:
+        std::size_t bucket(K frame) const;
+
+        Float _begin, _scale;
+        Containers::Array<std::size_t> _buckets;
+};
+
+template<class K> TrackIndex<K>::TrackIndex(const Containers::StridedArrayView<const K>& keys, const std::size_t bucketCount): TrackIndex{} {
+    if(keys.size() < 2 || !bucketCount) return;
+
+    _begin = Float(keys[0]);
+    const Float duration = Float(keys[keys.size() - 1]) - _begin;
+    _scale = duration > 0.0f ? Float(bucketCount)/duration : 0.0f;
+    _buckets = Containers::Array<std::size_t>{Containers::ValueInit, bucketCount};
+
+    /* For each bucket remember the last key that falls into one of the
+       previous buckets. The mapping is monotonic, so such a key is always
+       before any frame that maps into given bucket, even with rounding
+       errors. */
+    std::size_t key = 0;
+    for(std::size_t i = 0; i != bucketCount; ++i) {
+        while(key + 1 < keys.size() && bucket(keys[key + 1]) < i) ++key;
+        _buckets[i] = key;
+    }
+}
+
+template<class K> inline std::size_t TrackIndex<K>::bucket(const K frame) const {
+    const Float position = (Float(frame) - _begin)*_scale;
+    /* Also catches NaNs */
+    if(!(position > 0.0f)) return 0;
+    if(position >= Float(_buckets.size())) return _buckets.size() - 1;
+    return std::size_t(position);
+}
+
+template<class K> inline std::size_t TrackIndex<K>::hint(const K frame) const {
+    if(_buckets.empty()) return 0;
+    return _buckets[bucket(frame)];
+}
+
+}}
+
+#endif
@@ -25,6 +25,7 @@
 
 #include "AbstractImporter.h"
 
+#include <algorithm>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Directory.h>
@@ -36,7 +37,7 @@
 namespace Magnum { namespace Audio {
 
 std::string AbstractImporter::pluginInterface() {
-    return "cz.mosra.magnum.Audio.AbstractImporter/0.1";
+    return "cz.mosra.magnum.Audio.AbstractImporter/0.2";
 }
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
@@ -112,4 +113,30 @@ Containers::Array<char> AbstractImporter::data() {
     return doData();
 }
 
+Containers::ArrayView<const char> AbstractImporter::dataView() {
+    CORRADE_ASSERT(features() & Feature::DataView,
+        "Audio::AbstractImporter::dataView(): feature not supported", {});
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::dataView(): no file opened", {});
+    return doDataView();
+}
+
+Containers::ArrayView<const char> AbstractImporter::doDataView() {
+    CORRADE_ASSERT(false, "Audio::AbstractImporter::dataView(): feature advertised but not implemented", {});
+    return {};
+}
+
+std::size_t AbstractImporter::readData(const std::size_t offset, const Containers::ArrayView<char> destination) {
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::readData(): no file opened", {});
+    return doReadData(offset, destination);
+}
+
+std::size_t AbstractImporter::doReadData(const std::size_t offset, const Containers::ArrayView<char> destination) {
+    const Containers::Array<char> data = doData();
+    if(offset >= data.size()) return 0;
+
+    const std::size_t size = std::min(destination.size(), data.size() - offset);
+    std::copy_n(data + offset, size, destination.begin());
+    return size;
+}
+
 }}
@@ -48,6 +48,11 @@ importer plugins.
 Plugin implements function @ref doFeatures(), @ref doIsOpened(), one of or both
 @ref doOpenData() and @ref doOpenFile() functions, function @ref doClose() and
 data access functions @ref doFormat(), @ref doFrequency() and @ref doData().
+Importers that are able to decode the data incrementally should implement
+also @ref doReadData() to make @ref StreamingSource work without having the
+whole decoded sound in memory. Importers that keep the samples in memory in
+the final form can advertise @ref Feature::DataView and implement
+@ref doDataView() to give access to them without a copy.
 
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
@@ -57,6 +62,8 @@ checked by the implementation:
     is any file opened.
 -   Function @ref doOpenData() is called only if @ref Feature::OpenData is
     supported.
+-   Function @ref doDataView() is called only if @ref Feature::DataView is
+    supported.
 -   All `do*()` implementations working on opened file are called only if
     there is any file opened.
 
@@ -74,7 +81,13 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         enum class Feature: UnsignedByte {
             /** Opening files from raw data using @ref openData() */
-            OpenData = 1 << 0
+            OpenData = 1 << 0,
+
+            /**
+             * Accessing the sample data without a copy using
+             * @ref dataView()
+             */
+            DataView = 1 << 1
         };
 
         /**
@@ -88,7 +101,7 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * @brief Plugin interface
          *
          * @code{.cpp}
-         * "cz.mosra.magnum.Audio.AbstractImporter/0.1"
+         * "cz.mosra.magnum.Audio.AbstractImporter/0.2"
          * @endcode
          */
         static std::string pluginInterface();
@@ -156,9 +169,41 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Sample frequency */
         UnsignedInt frequency() const;
 
-        /** @brief Sample data */
+        /**
+         * @brief Sample data
+         *
+         * Returns the whole decoded sample data. For incremental access use
+         * @ref readData() instead, for access without a copy use
+         * @ref dataView().
+         */
         Containers::Array<char> data();
 
+        /**
+         * @brief View on the sample data
+         *
+         * Returns the same data as @ref data(), but without copying them.
+         * Available only if @ref Feature::DataView is supported. The view is
+         * valid only until the file is closed or another file is opened.
+         * @see @ref features()
+         */
+        Containers::ArrayView<const char> dataView();
+
+        /**
+         * @brief Read a chunk of sample data
+         * @param offset        Offset in bytes from the beginning of the
+         *      decoded sample data
+         * @param destination   Where to put the data
+         *
+         * Copies at most @cpp destination.size() @ce bytes of decoded sample
+         * data starting at @p offset to @p destination and returns the
+         * number of bytes copied. A value smaller than
+         * @cpp destination.size() @ce means the end of the data was reached.
+         * The @p offset and @p destination size should be a multiple of the
+         * sample frame size for given @ref format().
+         * @see @ref StreamingSource
+         */
+        std::size_t readData(std::size_t offset, Containers::ArrayView<char> destination);
+
         /*@}*/
 
     #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -194,6 +239,18 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
 
         /** @brief Implementation for @ref data() */
         virtual Containers::Array<char> doData() = 0;
+
+        /** @brief Implementation for @ref dataView() */
+        virtual Containers::ArrayView<const char> doDataView();
+
+        /**
+         * @brief Implementation for @ref readData()
+         *
+         * Default implementation calls @ref doData() and copies the requested
+         * part of it, which means the whole data are decoded on every call.
+         * Reimplement it to provide efficient incremental access.
+         */
+        virtual std::size_t doReadData(std::size_t offset, Containers::ArrayView<char> destination);
 };
 
 }}
@@ -45,6 +45,8 @@ enum class BufferFormat: ALenum;
 class Buffer;
 class Context;
 class Source;
+class StreamingSource;
+class VoicePool;
 /* Renderer used only statically */
 
 template<UnsignedInt> class Playable;
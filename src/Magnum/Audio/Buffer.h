@@ -102,7 +102,52 @@ class Buffer {
             return *this;
         }
 
+        /**
+         * @brief Sample frequency
+         *
+         * @see @fn_al_keyword{GetBufferi} with @def_al{FREQUENCY}
+         */
+        Int frequency() const { return parameter(AL_FREQUENCY); }
+
+        /**
+         * @brief Data size in bytes
+         *
+         * @see @fn_al_keyword{GetBufferi} with @def_al{SIZE}
+         */
+        Int size() const { return parameter(AL_SIZE); }
+
+        /**
+         * @brief Channel count
+         *
+         * @see @fn_al_keyword{GetBufferi} with @def_al{CHANNELS}
+         */
+        Int channels() const { return parameter(AL_CHANNELS); }
+
+        /**
+         * @brief Bits per sample
+         *
+         * @see @fn_al_keyword{GetBufferi} with @def_al{BITS}
+         */
+        Int bits() const { return parameter(AL_BITS); }
+
+        /**
+         * @brief Duration in seconds
+         *
+         * Calculated from @ref size(), @ref channels(), @ref bits() and
+         * @ref frequency(). Returns @cpp 0.0f @ce for a buffer without data.
+         */
+        Float duration() const {
+            const Int bytesPerSecond = channels()*bits()/8*frequency();
+            return bytesPerSecond ? Float(size())/bytesPerSecond : 0.0f;
+        }
+
     private:
+        Int parameter(ALenum parameter) const {
+            ALint value;
+            alGetBufferi(_id, parameter, &value);
+            return value;
+        }
+
         ALuint _id;
 };
 
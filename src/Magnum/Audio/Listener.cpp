@@ -30,6 +30,7 @@
 #include "Magnum/Audio/PlayableGroup.h"
 #include "Magnum/Audio/Renderer.h"
 #include "Magnum/Math/Matrix3.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
 
 namespace Magnum { namespace Audio {
 
@@ -82,19 +83,21 @@ template<UnsignedInt dimensions> void Listener<dimensions>::update(std::initiali
         Renderer::setListenerGain(_gain);
     }
 
-    /* Add all objects of the Playables in the PlayableGroups to a vector to
-       later setClean() */
-    std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> objects;
-
-    objects.push_back(this->object());
+    /* Add all dirty objects of the Playables in the PlayableGroups to a
+       vector to later setClean(). Objects that didn't change since last time
+       don't need to be touched at all. */
+    _dirtyObjects.clear();
+    if(this->object().isDirty()) _dirtyObjects.push_back(this->object());
     for(PlayableGroup<dimensions>& group: groups) {
         for(std::size_t i = 0; i != group.size(); ++i) {
-            objects.push_back(group[i].object());
+            if(group[i].object().isDirty())
+                _dirtyObjects.push_back(group[i].object());
         }
     }
 
     /* Use the more performant way to set multiple objects clean */
-    SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
+    if(!_dirtyObjects.empty())
+        SceneGraph::AbstractObject<dimensions, Float>::setClean(_dirtyObjects);
 }
 
 template<UnsignedInt dimensions> Listener<dimensions>& Listener<dimensions>::setGain(const Float gain) {
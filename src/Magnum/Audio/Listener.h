@@ -30,6 +30,9 @@
  * @brief Class @ref Magnum::Audio::Listener, @ref Magnum::Audio::Listener2D, @ref Magnum::Audio::Listener3D
  */
 
+#include <functional>
+#include <vector>
+
 #include "Magnum/Audio/Audio.h"
 #include "Magnum/Audio/visibility.h"
 #include "Magnum/Math/Matrix4.h"
@@ -114,8 +117,11 @@ template<UnsignedInt dimensions> class Listener: public SceneGraph::AbstractFeat
          *
          * Makes this instance the active listener and calls
          * @ref SceneGraph::AbstractObject::setClean() on its parent object and
-         * all objects of the @ref Playable "Playables" in the group to reflect
-         * transformation changes to spatial audio behavior. Also updates
+         * all dirty objects of the @ref Playable "Playables" in the group to
+         * reflect transformation changes to spatial audio behavior. The dirty
+         * objects are cleaned all at once, so transformations of their common
+         * parents are computed only once, and only sources whose position or
+         * direction actually changed are updated. Also updates
          * listener-related configuration for @ref Renderer (position,
          * orientation, gain).
          */
@@ -141,6 +147,8 @@ template<UnsignedInt dimensions> class Listener: public SceneGraph::AbstractFeat
 
         Matrix4 _soundTransformation;
         Float _gain;
+        /* Reused across update() calls to avoid reallocations */
+        std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> _dirtyObjects;
 };
 
 /**
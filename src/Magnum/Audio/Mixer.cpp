@@ -0,0 +1,286 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "VoicePool.h"
+
+#include "Mixer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Constants.h"
+
+namespace Magnum { namespace Audio {
+
+namespace {
+
+/* Converts given count of samples starting at given sample to floats */
+void convert(const BufferFormat format, const Containers::ArrayView<const char> data, const std::size_t offset, const std::size_t count, Float* const out) {
+    switch(format) {
+        case BufferFormat::Mono8:
+        case BufferFormat::Stereo8: {
+            const UnsignedByte* in = reinterpret_cast<const UnsignedByte*>(data.data()) + offset;
+            for(std::size_t i = 0; i != count; ++i)
+                out[i] = (Float(in[i]) - 128.0f)*(1.0f/128.0f);
+        } return;
+        case BufferFormat::Mono16:
+        case BufferFormat::Stereo16: {
+            const Short* in = reinterpret_cast<const Short*>(data.data()) + offset;
+            for(std::size_t i = 0; i != count; ++i)
+                out[i] = Float(in[i])*(1.0f/32768.0f);
+        } return;
+        case BufferFormat::MonoFloat:
+        case BufferFormat::StereoFloat: {
+            const Float* in = reinterpret_cast<const Float*>(data.data()) + offset;
+            std::copy_n(in, count, out);
+        } return;
+        default: CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+}
+
+}
+
+Mixer::Mixer(const UnsignedInt frequency, const UnsignedInt threadCount): _frequency{frequency}, _threadCount{threadCount} {
+    CORRADE_ASSERT(threadCount, "Audio::Mixer: expected non-zero thread count", );
+}
+
+Mixer::Mixer(Mixer&&) noexcept = default;
+
+Mixer::~Mixer() = default;
+
+Mixer& Mixer::operator=(Mixer&&) noexcept = default;
+
+Mixer& Mixer::setMasterGain(const Float gain) {
+    _masterGain = gain;
+    return *this;
+}
+
+bool Mixer::isValid(const UnsignedInt id) const {
+    return id < _voices.size() && _voices[id].channelCount;
+}
+
+UnsignedInt Mixer::addVoice(const BufferFormat format, const Containers::ArrayView<const void> data) {
+    UnsignedInt channelCount{}, sampleSize{1};
+    switch(format) {
+        case BufferFormat::Mono8: channelCount = 1; sampleSize = 1; break;
+        case BufferFormat::Stereo8: channelCount = 2; sampleSize = 1; break;
+        case BufferFormat::Mono16: channelCount = 1; sampleSize = 2; break;
+        case BufferFormat::Stereo16: channelCount = 2; sampleSize = 2; break;
+        case BufferFormat::MonoFloat: channelCount = 1; sampleSize = 4; break;
+        case BufferFormat::StereoFloat: channelCount = 2; sampleSize = 4; break;
+        default: CORRADE_ASSERT(false, "Audio::Mixer::addVoice(): unsupported format" << format, {});
+    }
+
+    UnsignedInt id;
+    if(!_freeVoices.empty()) {
+        id = _freeVoices.back();
+        _freeVoices.pop_back();
+    } else {
+        id = _voices.size();
+        _voices.emplace_back();
+    }
+
+    const Containers::ArrayView<const char> bytes{static_cast<const char*>(data.data()), data.size()};
+    _voices[id] = Voice{bytes, format, channelCount, data.size()/(channelCount*sampleSize), 0, 1.0f, 0.0f, nullptr, nullptr, false, false};
+    return id;
+}
+
+void Mixer::removeVoice(const UnsignedInt id) {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::removeVoice(): invalid voice ID" << id, );
+    _voices[id].channelCount = 0;
+    _voices[id].playing = false;
+    _freeVoices.push_back(id);
+}
+
+Float Mixer::gain(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::gain(): invalid voice ID" << id, {});
+    return _voices[id].gain;
+}
+
+Mixer& Mixer::setGain(const UnsignedInt id, const Float gain) {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::setGain(): invalid voice ID" << id, *this);
+    _voices[id].gain = gain;
+    return *this;
+}
+
+Float Mixer::pan(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::pan(): invalid voice ID" << id, {});
+    return _voices[id].pan;
+}
+
+Mixer& Mixer::setPan(const UnsignedInt id, const Float pan) {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::setPan(): invalid voice ID" << id, *this);
+    CORRADE_ASSERT(pan >= -1.0f && pan <= 1.0f,
+        "Audio::Mixer::setPan(): expected pan in range [-1, 1], got" << pan, *this);
+    _voices[id].pan = pan;
+    return *this;
+}
+
+bool Mixer::isLooping(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::isLooping(): invalid voice ID" << id, {});
+    return _voices[id].looping;
+}
+
+Mixer& Mixer::setLooping(const UnsignedInt id, const bool loop) {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::setLooping(): invalid voice ID" << id, *this);
+    _voices[id].looping = loop;
+    return *this;
+}
+
+Mixer& Mixer::setFilter(const UnsignedInt id, const Filter filter, void* const state) {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::setFilter(): invalid voice ID" << id, *this);
+    _voices[id].filter = filter;
+    _voices[id].filterState = state;
+    return *this;
+}
+
+Mixer& Mixer::play(const UnsignedInt id) {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::play(): invalid voice ID" << id, *this);
+    _voices[id].playing = true;
+    _voices[id].offset = 0;
+    return *this;
+}
+
+Mixer& Mixer::stop(const UnsignedInt id) {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::stop(): invalid voice ID" << id, *this);
+    _voices[id].playing = false;
+    _voices[id].offset = 0;
+    return *this;
+}
+
+bool Mixer::isPlaying(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::isPlaying(): invalid voice ID" << id, {});
+    return _voices[id].playing;
+}
+
+std::size_t Mixer::offset(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::Mixer::offset(): invalid voice ID" << id, {});
+    return _voices[id].offset;
+}
+
+void Mixer::mixVoice(Voice& voice, const Containers::ArrayView<Float> output) {
+    const UnsignedInt channelCount = voice.channelCount;
+
+    /* Mono voices are panned with constant power, stereo voices get the
+       opposite channel attenuated */
+    Float left, right;
+    if(channelCount == 1) {
+        const Float angle = (voice.pan + 1.0f)*Constants::pi()*0.25f;
+        left = voice.gain*std::cos(angle);
+        right = voice.gain*std::sin(angle);
+    } else {
+        left = voice.gain*std::min(1.0f, 1.0f - voice.pan);
+        right = voice.gain*std::min(1.0f, 1.0f + voice.pan);
+    }
+
+    Float samples[2*BlockSize];
+    const std::size_t frameCount = output.size()/2;
+    for(std::size_t frame = 0; frame < frameCount && voice.playing; frame += BlockSize) {
+        const std::size_t count = std::min(std::size_t(BlockSize), frameCount - frame);
+
+        /* Convert the samples, wrapping around the end if looping */
+        std::size_t filled = 0;
+        while(filled != count) {
+            if(voice.offset == voice.frameCount) {
+                if(!voice.looping || !voice.frameCount) break;
+                voice.offset = 0;
+            }
+
+            const std::size_t n = std::min(count - filled, voice.frameCount - voice.offset);
+            convert(voice.format, voice.data, voice.offset*channelCount, n*channelCount, samples + filled*channelCount);
+            filled += n;
+            voice.offset += n;
+        }
+
+        /* Non-looping voice reached its end */
+        if(!voice.looping && voice.offset == voice.frameCount) {
+            voice.playing = false;
+            voice.offset = 0;
+        }
+
+        if(!filled) break;
+
+        if(voice.filter)
+            voice.filter({samples, filled*channelCount}, channelCount, voice.filterState);
+
+        Float* const out = output + frame*2;
+        if(channelCount == 1) for(std::size_t i = 0; i != filled; ++i) {
+            out[2*i] += samples[i]*left;
+            out[2*i + 1] += samples[i]*right;
+        } else for(std::size_t i = 0; i != filled; ++i) {
+            out[2*i] += samples[2*i]*left;
+            out[2*i + 1] += samples[2*i + 1]*right;
+        }
+    }
+}
+
+void Mixer::mix(const Containers::ArrayView<Float> output) {
+    CORRADE_ASSERT(output.size() % 2 == 0,
+        "Audio::Mixer::mix(): expected output size to be a multiple of two, got" << output.size(), );
+
+    _playing.clear();
+    for(UnsignedInt i = 0; i != _voices.size(); ++i)
+        if(_voices[i].channelCount && _voices[i].playing) _playing.push_back(i);
+
+    std::fill(output.begin(), output.end(), 0.0f);
+
+    /* Single group is mixed directly into the output on the calling
+       thread */
+    const std::size_t groupCount = std::min(std::size_t(_threadCount), _playing.size());
+    if(groupCount <= 1) {
+        for(const UnsignedInt id: _playing) mixVoice(_voices[id], output);
+
+    /* Otherwise the first group is mixed into the output and the others into
+       their own accumulators, which are summed afterwards */
+    } else {
+        if(_accumulators.size() < (groupCount - 1)*output.size())
+            _accumulators = Containers::Array<Float>{Containers::NoInit, (groupCount - 1)*output.size()};
+
+        Magnum::Implementation::parallelFor(groupCount, groupCount, [this, output, groupCount](const std::size_t group) {
+            Containers::ArrayView<Float> accumulator = output;
+            if(group) {
+                accumulator = _accumulators.slice((group - 1)*output.size(), group*output.size());
+                std::fill(accumulator.begin(), accumulator.end(), 0.0f);
+            }
+
+            for(std::size_t i = group; i < _playing.size(); i += groupCount)
+                mixVoice(_voices[_playing[i]], accumulator);
+        });
+
+        for(std::size_t group = 1; group != groupCount; ++group) {
+            const Float* const accumulator = _accumulators + (group - 1)*output.size();
+            for(std::size_t i = 0; i != output.size(); ++i)
+                output[i] += accumulator[i];
+        }
+    }
+
+    if(_masterGain != 1.0f) for(Float& sample: output)
+        sample *= _masterGain;
+}
+
+}}
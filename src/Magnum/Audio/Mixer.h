@@ -0,0 +1,278 @@
+#ifndef Magnum_Audio_Mixer_h
+#define Magnum_Audio_Mixer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::Mixer
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Audio/BufferFormat.h"
+#include "Magnum/Audio/visibility.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Software mixer
+
+Mixes a large number of voices on the CPU into a single interleaved stereo
+@ref BufferFormat::StereoFloat stream, which is then played through a single
+OpenAL source. Useful when the voices need custom processing such as
+occlusion filters or reverb zones that OpenAL doesn't provide, or when there's
+so many of them that the OpenAL mixer thread becomes the bottleneck.
+
+@code{.cpp}
+Audio::Mixer mixer{44100, 4};
+
+UnsignedInt rain = mixer.addVoice(Audio::BufferFormat::Mono16, rainData);
+mixer.setGain(rain, 0.5f)
+    .setLooping(rain, true)
+    .play(rain);
+
+// whenever the output source has a processed buffer
+Float block[2*1024];
+mixer.mix(block);
+buffer.setData(Audio::BufferFormat::StereoFloat, block, mixer.frequency());
+source.queueBuffers({buffer});
+@endcode
+
+@section Audio-Mixer-processing Processing
+
+The output is produced in blocks of @ref BlockSize frames. For every block,
+samples of each playing voice are converted to floats, passed to the voice
+filter set using @ref setFilter(), if any, and then added to the output with
+the voice gain and pan applied. The per-sample loops work on contiguous
+fixed-size float blocks so they can be vectorized by the compiler.
+
+With @ref threadCount() larger than @cpp 1 @ce, the playing voices are split
+into groups mixed on separate threads into separate accumulation buffers,
+which are then summed together on the calling thread. The filters are thus
+called from multiple threads, but a single voice is always processed by one
+thread during one @ref mix() call. On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten"
+everything is mixed on the calling thread.
+
+The voice sample data are not copied and have to stay in scope for the whole
+voice lifetime. The mixer isn't thread-safe --- voice properties must not be
+changed while @ref mix() is running. Only voices in @ref BufferFormat::Mono8,
+@ref BufferFormat::Stereo8, @ref BufferFormat::Mono16,
+@ref BufferFormat::Stereo16, @ref BufferFormat::MonoFloat and
+@ref BufferFormat::StereoFloat are supported and the voice data are expected
+to have the same frequency as the mixer, no resampling is done.
+@see @ref VoicePool, @ref Source::queueBuffers()
+*/
+class MAGNUM_AUDIO_EXPORT Mixer {
+    public:
+        /** @brief Count of frames processed at once */
+        enum: std::size_t { BlockSize = 256 };
+
+        /**
+         * @brief Voice filter
+         *
+         * Called with samples of one block of the voice, converted to floats.
+         * The samples are interleaved if the voice has two channels, the
+         * channel count is passed in the second parameter. The filter can
+         * modify the samples in place. The last parameter is the state
+         * passed to @ref setFilter().
+         */
+        typedef void(*Filter)(Containers::ArrayView<Float>, UnsignedInt, void*);
+
+        /**
+         * @brief Constructor
+         * @param frequency     Output frequency
+         * @param threadCount   Thread count used for mixing, including the
+         *      calling thread
+         *
+         * The @p threadCount value is expected to be non-zero.
+         */
+        explicit Mixer(UnsignedInt frequency, UnsignedInt threadCount = 1);
+
+        /** @brief Copying is not allowed */
+        Mixer(const Mixer&) = delete;
+
+        /** @brief Move constructor */
+        Mixer(Mixer&&) noexcept;
+
+        ~Mixer();
+
+        /** @brief Copying is not allowed */
+        Mixer& operator=(const Mixer&) = delete;
+
+        /** @brief Move assignment */
+        Mixer& operator=(Mixer&&) noexcept;
+
+        /** @brief Output frequency */
+        UnsignedInt frequency() const { return _frequency; }
+
+        /** @brief Thread count used for mixing */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Count of voices
+         *
+         * Count of voices added using @ref addVoice() and not removed using
+         * @ref removeVoice().
+         */
+        std::size_t voiceCount() const { return _voices.size() - _freeVoices.size(); }
+
+        /** @brief Master gain */
+        Float masterGain() const { return _masterGain; }
+
+        /**
+         * @brief Set master gain
+         * @return Reference to self (for method chaining)
+         *
+         * Applied to the whole output. Default is @cpp 1.0f @ce.
+         */
+        Mixer& setMasterGain(Float gain);
+
+        /**
+         * @brief Add a voice
+         * @param format    Sample format
+         * @param data      Sample data. Expected to be kept in scope for the
+         *      whole voice lifetime.
+         *
+         * Returns ID of the voice. The voice is initially stopped, with gain
+         * of @cpp 1.0f @ce, centered, not looping and without any filter.
+         * Removed voice IDs may get reused.
+         */
+        UnsignedInt addVoice(BufferFormat format, Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Remove a voice
+         *
+         * Stops the voice and frees its ID.
+         */
+        void removeVoice(UnsignedInt id);
+
+        /** @brief Voice gain */
+        Float gain(UnsignedInt id) const;
+
+        /**
+         * @brief Set voice gain
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp 1.0f @ce.
+         */
+        Mixer& setGain(UnsignedInt id, Float gain);
+
+        /** @brief Voice pan */
+        Float pan(UnsignedInt id) const;
+
+        /**
+         * @brief Set voice pan
+         * @return Reference to self (for method chaining)
+         *
+         * Expected to be in range @f$ [-1, 1] @f$, where @cpp -1.0f @ce is
+         * fully left and @cpp 1.0f @ce fully right. Mono voices are panned
+         * with constant power, stereo voices have the opposite channel
+         * attenuated. Default is @cpp 0.0f @ce.
+         */
+        Mixer& setPan(UnsignedInt id, Float pan);
+
+        /** @brief Whether the voice is looping */
+        bool isLooping(UnsignedInt id) const;
+
+        /**
+         * @brief Set voice looping
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp false @ce.
+         */
+        Mixer& setLooping(UnsignedInt id, bool loop);
+
+        /**
+         * @brief Set voice filter
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Audio-Mixer-processing for more information. Pass
+         * @cpp nullptr @ce to remove the filter. Default is no filter.
+         */
+        Mixer& setFilter(UnsignedInt id, Filter filter, void* state = nullptr);
+
+        /**
+         * @brief Play the voice from the beginning
+         * @return Reference to self (for method chaining)
+         */
+        Mixer& play(UnsignedInt id);
+
+        /**
+         * @brief Stop the voice
+         * @return Reference to self (for method chaining)
+         */
+        Mixer& stop(UnsignedInt id);
+
+        /**
+         * @brief Whether the voice is playing
+         *
+         * A non-looping voice stops playing after reaching its end.
+         */
+        bool isPlaying(UnsignedInt id) const;
+
+        /** @brief Playback offset in frames */
+        std::size_t offset(UnsignedInt id) const;
+
+        /**
+         * @brief Mix the playing voices
+         * @param output    Interleaved stereo output
+         *
+         * Overwrites @p output with the next @cpp output.size()/2 @ce frames
+         * of all playing voices and advances them. The output size is
+         * expected to be a multiple of two. See @ref Audio-Mixer-processing
+         * for more information.
+         */
+        void mix(Containers::ArrayView<Float> output);
+
+    private:
+        struct Voice {
+            Containers::ArrayView<const char> data;
+            BufferFormat format;
+            UnsignedInt channelCount;
+            std::size_t frameCount, offset;
+            Float gain, pan;
+            Filter filter;
+            void* filterState;
+            bool looping, playing;
+        };
+
+        MAGNUM_AUDIO_LOCAL bool isValid(UnsignedInt id) const;
+        MAGNUM_AUDIO_LOCAL void mixVoice(Voice& voice, Containers::ArrayView<Float> output);
+
+        UnsignedInt _frequency, _threadCount;
+        Float _masterGain{1.0f};
+        std::vector<Voice> _voices;
+        std::vector<UnsignedInt> _freeVoices;
+        /* Reused across mix() calls to avoid reallocations */
+        std::vector<UnsignedInt> _playing;
+        Containers::Array<Float> _accumulators;
+};
+
+}}
+
+#endif
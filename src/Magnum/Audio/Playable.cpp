@@ -49,8 +49,20 @@ template<UnsignedInt dimensions> void Playable<dimensions>::clean(const MatrixTy
     if(playables())
         position = playables()->soundTransformation().transformVector(position);
 
-    _source.setPosition(position);
-    _source.setDirection(Vector3::pad(absoluteTransformationMatrix.rotation()*_direction));
+    if(position != _sourcePosition) {
+        _source.setPosition(position);
+        _sourcePosition = position;
+    }
+
+    /* Extracting the rotation involves normalization, skip it for
+       omnidirectional sources */
+    if(_direction != VectorTypeFor<dimensions, Float>{}) {
+        const Vector3 direction = Vector3::pad(absoluteTransformationMatrix.rotation()*_direction);
+        if(direction != _sourceDirection) {
+            _source.setDirection(direction);
+            _sourceDirection = direction;
+        }
+    }
 
     /** @todo velocity */
 }
@@ -54,7 +54,10 @@ updated from a currently active @ref Listener using @ref Listener::update():
 Note that @ref Source::setPosition(), @ref Source::setDirection() and
 @ref Source::setGain() called on @ref source() will be overwritten on next call
 to @ref Listener::update() / @ref PlayableGroup::setGain() / @ref setGain() and
-you have to use other means to update them:
+you have to use other means to update them. In particular, the position and
+direction are passed to OpenAL only if they differ from the values set during
+previous update, so the scene can have a large amount of static playables
+without any per-frame cost.
 
 -   Transformation of the source is inherited from the scene. If you want to
     transform it, transform the @ref SceneGraph::Object the playable is
@@ -138,6 +141,8 @@ template<UnsignedInt dimensions> class Playable: public SceneGraph::AbstractGrou
 
         VectorTypeFor<dimensions, Float> _direction;
         Float _gain;
+        /* Values last passed to the source, to avoid redundant AL calls */
+        Vector3 _sourcePosition, _sourceDirection;
         Source _source;
 };
 
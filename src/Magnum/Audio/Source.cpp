@@ -40,6 +40,44 @@ Source& Source::setBuffer(Buffer* buffer) {
 
 namespace {
 
+Containers::Array<ALuint> bufferIds(const std::initializer_list<std::reference_wrapper<Buffer>>& buffers) {
+    Containers::Array<ALuint> ids(buffers.size());
+    for(auto it = buffers.begin(); it != buffers.end(); ++it)
+        ids[it-buffers.begin()] = it->get().id();
+    return ids;
+}
+
+Containers::Array<ALuint> bufferIds(const std::vector<std::reference_wrapper<Buffer>>& buffers) {
+    Containers::Array<ALuint> ids(buffers.size());
+    for(auto it = buffers.begin(); it != buffers.end(); ++it)
+        ids[it-buffers.begin()] = it->get().id();
+    return ids;
+}
+
+}
+
+Source& Source::queueBuffers(std::initializer_list<std::reference_wrapper<Buffer>> buffers) {
+    const auto ids = bufferIds(buffers);
+    alSourceQueueBuffers(_id, ids.size(), ids);
+    return *this;
+}
+
+Source& Source::queueBuffers(const std::vector<std::reference_wrapper<Buffer>>& buffers) {
+    const auto ids = bufferIds(buffers);
+    alSourceQueueBuffers(_id, ids.size(), ids);
+    return *this;
+}
+
+Source& Source::unqueueBuffers(const Int count) {
+    /* The IDs of unqueued buffers are not needed, as they are always the
+       oldest ones */
+    Containers::Array<ALuint> ids(count);
+    alSourceUnqueueBuffers(_id, count, ids);
+    return *this;
+}
+
+namespace {
+
 Containers::Array<ALuint> sourceIds(const std::initializer_list<std::reference_wrapper<Source>>& sources) {
     Containers::Array<ALuint> ids(sources.size());
     for(auto it = sources.begin(); it != sources.end(); ++it)
@@ -45,8 +45,10 @@ namespace Magnum { namespace Audio {
 /**
 @brief Source
 
-Manages positional audio source.
-@todo Expose convenient API for buffer queuing
+Manages positional audio source. Sound can be either played from a single
+buffer attached using @ref setBuffer() or streamed from a queue of buffers
+using @ref queueBuffers() and @ref unqueueBuffers(). See @ref StreamingSource
+for a class that manages the buffer queue automatically.
 */
 class MAGNUM_AUDIO_EXPORT Source {
     public:
@@ -507,6 +509,54 @@ class MAGNUM_AUDIO_EXPORT Source {
          */
         Source& setBuffer(Buffer* buffer);
 
+        /**
+         * @brief Queue buffers
+         * @return Reference to self (for method chaining)
+         *
+         * Appends the buffers to the end of the buffer queue and changes
+         * source type to @ref Type::Streaming. The buffers must be already
+         * filled with data and all buffers in the queue must have the same
+         * format.
+         * @see @ref unqueueBuffers(), @ref buffersQueued(),
+         *      @fn_al_keyword{SourceQueueBuffers}
+         */
+        Source& queueBuffers(std::initializer_list<std::reference_wrapper<Buffer>> buffers);
+
+        /** @overload */
+        Source& queueBuffers(const std::vector<std::reference_wrapper<Buffer>>& buffers);
+
+        /**
+         * @brief Unqueue processed buffers
+         * @param count         Count of buffers to unqueue
+         * @return Reference to self (for method chaining)
+         *
+         * Removes @p count buffers from the front of the buffer queue, i.e.
+         * in the same order as they were queued. The count can't be larger
+         * than @ref buffersProcessed(), after the source is stopped all
+         * queued buffers are processed.
+         * @see @ref queueBuffers(), @fn_al_keyword{SourceUnqueueBuffers}
+         */
+        Source& unqueueBuffers(Int count);
+
+        /**
+         * @brief Count of queued buffers
+         *
+         * Including the processed ones.
+         * @see @ref buffersProcessed(), @fn_al_keyword{GetSourcei} with
+         *      @def_al{BUFFERS_QUEUED}
+         */
+        Int buffersQueued() const;
+
+        /**
+         * @brief Count of processed buffers
+         *
+         * Count of queued buffers that were already played and can be
+         * unqueued using @ref unqueueBuffers().
+         * @see @ref buffersQueued(), @fn_al_keyword{GetSourcei} with
+         *      @def_al{BUFFERS_PROCESSED}
+         */
+        Int buffersProcessed() const;
+
         /*@}*/
 
         /** @{ @name State management */
@@ -730,6 +780,18 @@ inline bool Source::isLooping() const {
     return looping;
 }
 
+inline Int Source::buffersQueued() const {
+    ALint count;
+    alGetSourcei(_id, AL_BUFFERS_QUEUED, &count);
+    return count;
+}
+
+inline Int Source::buffersProcessed() const {
+    ALint count;
+    alGetSourcei(_id, AL_BUFFERS_PROCESSED, &count);
+    return count;
+}
+
 inline Float Source::offsetInSeconds() const {
     Float offset;
     alGetSourcef(_id, AL_SEC_OFFSET, &offset);
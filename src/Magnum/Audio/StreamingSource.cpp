@@ -0,0 +1,340 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StreamingSource.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "Magnum/Audio/AbstractImporter.h"
+
+namespace Magnum { namespace Audio {
+
+namespace {
+
+std::size_t frameSize(const BufferFormat format) {
+    switch(format) {
+        case BufferFormat::Mono8:
+        case BufferFormat::MonoALaw:
+        case BufferFormat::MonoMuLaw:
+            return 1;
+        case BufferFormat::Mono16:
+        case BufferFormat::Stereo8:
+        case BufferFormat::StereoALaw:
+        case BufferFormat::StereoMuLaw:
+        case BufferFormat::Rear8:
+            return 2;
+        case BufferFormat::Stereo16:
+        case BufferFormat::MonoFloat:
+        case BufferFormat::Quad8:
+        case BufferFormat::Rear16:
+            return 4;
+        case BufferFormat::Surround51Channel8:
+            return 6;
+        case BufferFormat::Surround61Channel8:
+            return 7;
+        case BufferFormat::StereoFloat:
+        case BufferFormat::MonoDouble:
+        case BufferFormat::Quad16:
+        case BufferFormat::Rear32:
+        case BufferFormat::Surround71Channel8:
+            return 8;
+        case BufferFormat::Surround51Channel16:
+            return 12;
+        case BufferFormat::Surround61Channel16:
+            return 14;
+        case BufferFormat::StereoDouble:
+        case BufferFormat::Quad32:
+        case BufferFormat::Surround71Channel16:
+            return 16;
+        case BufferFormat::Surround51Channel32:
+            return 24;
+        case BufferFormat::Surround61Channel32:
+            return 28;
+        case BufferFormat::Surround71Channel32:
+            return 32;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
+/* Ring of decoded chunks. Chunks in [first, first + filled) are ready to be
+   uploaded and are touched only by the main thread, the chunk right after
+   them is the one being decoded. */
+struct StreamingSource::Decoder {
+    explicit Decoder(AbstractImporter& importer, std::size_t bufferSize, std::size_t bufferCount): importer(importer), bufferSize{bufferSize}, data{Containers::NoInit, bufferSize*bufferCount}, sizes{Containers::ValueInit, bufferCount} {}
+
+    /* Decodes as much as fits into given chunk, wrapping around if looping.
+       Returns the decoded size, which is less than the chunk size only at the
+       end of the data. */
+    std::size_t decode(std::size_t& offset, bool looping, std::size_t chunk);
+
+    /* Commits a chunk decoded from given generation */
+    void commit(UnsignedInt generation, std::size_t offset, std::size_t size);
+
+    bool canDecode() const { return !ended && filled != sizes.size(); }
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void run();
+    #endif
+
+    AbstractImporter& importer;
+    const std::size_t bufferSize;
+    Containers::Array<char> data;
+    Containers::Array<std::size_t> sizes;
+    std::size_t first{}, filled{}, offset{};
+    /* Incremented on rewind so chunks decoded from the previous position get
+       discarded */
+    UnsignedInt generation{};
+    bool looping{}, ended{};
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    bool quit{};
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::thread thread;
+    #endif
+};
+
+std::size_t StreamingSource::Decoder::decode(std::size_t& offset, const bool looping, const std::size_t chunk) {
+    const Containers::ArrayView<char> out = data.slice(chunk*bufferSize, (chunk + 1)*bufferSize);
+    std::size_t size = 0;
+    while(size != bufferSize) {
+        const std::size_t read = importer.readData(offset, out.suffix(size));
+        offset += read;
+        size += read;
+        if(read) continue;
+
+        /* End of the data. Stop also if there's nothing to read from the
+           beginning to avoid looping forever on empty data. */
+        if(!looping || !offset) break;
+        offset = 0;
+    }
+
+    return size;
+}
+
+void StreamingSource::Decoder::commit(const UnsignedInt generation, const std::size_t offset, const std::size_t size) {
+    if(generation != this->generation) return;
+
+    this->offset = offset;
+    if(size) {
+        sizes[(first + filled) % sizes.size()] = size;
+        ++filled;
+    }
+    if(size != bufferSize) ended = true;
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void StreamingSource::Decoder::run() {
+    std::unique_lock<std::mutex> lock{mutex};
+    for(;;) {
+        condition.wait(lock, [this]() { return quit || canDecode(); });
+        if(quit) return;
+
+        /* Decode without holding the lock so the main thread can upload the
+           already decoded chunks meanwhile */
+        const std::size_t chunk = (first + filled) % sizes.size();
+        const UnsignedInt generation = this->generation;
+        std::size_t offset = this->offset;
+        const bool looping = this->looping;
+        lock.unlock();
+        const std::size_t size = decode(offset, looping, chunk);
+        lock.lock();
+
+        commit(generation, offset, size);
+    }
+}
+#endif
+
+StreamingSource::StreamingSource(AbstractImporter& importer, std::size_t bufferSize, const UnsignedInt bufferCount): _buffers{bufferCount} {
+    CORRADE_ASSERT(importer.isOpened(),
+        "Audio::StreamingSource: no file opened", );
+
+    _format = importer.format();
+    _frequency = importer.frequency();
+    _bufferSize = bufferSize/frameSize(_format)*frameSize(_format);
+    CORRADE_ASSERT(_bufferSize && bufferCount,
+        "Audio::StreamingSource: expected non-zero buffer count and buffer size of at least one sample frame but got" << bufferCount << "and" << bufferSize, );
+
+    _decoder.reset(new Decoder{importer, _bufferSize, bufferCount});
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _decoder->thread = std::thread{&Decoder::run, _decoder.get()};
+    #endif
+}
+
+StreamingSource::~StreamingSource() {
+    if(!_decoder) return;
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {
+        std::lock_guard<std::mutex> lock{_decoder->mutex};
+        _decoder->quit = true;
+    }
+    _decoder->condition.notify_one();
+    _decoder->thread.join();
+    #endif
+
+    /* Detach all buffers so they can be deleted */
+    _source.stop();
+    _source.setBuffer(nullptr);
+}
+
+bool StreamingSource::isLooping() const {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::lock_guard<std::mutex> lock{_decoder->mutex};
+    #endif
+    return _decoder->looping;
+}
+
+StreamingSource& StreamingSource::setLooping(const bool loop) {
+    {
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        std::lock_guard<std::mutex> lock{_decoder->mutex};
+        #endif
+        /* If the end was already reached, continue from the beginning */
+        if(loop && _decoder->ended) _decoder->ended = false;
+        _decoder->looping = loop;
+    }
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _decoder->condition.notify_one();
+    #endif
+    return *this;
+}
+
+StreamingSource& StreamingSource::play() {
+    /* Rewind if all data were already played */
+    update();
+    if(_finished) stop();
+
+    _playing = true;
+    return update();
+}
+
+StreamingSource& StreamingSource::pause() {
+    _playing = false;
+    _source.pause();
+    return *this;
+}
+
+StreamingSource& StreamingSource::stop() {
+    _playing = false;
+
+    /* After stopping all queued buffers are processed */
+    _source.stop();
+    _source.unqueueBuffers(_queuedCount);
+    _queuedFirst = _queuedCount = 0;
+    _finished = false;
+
+    {
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        std::lock_guard<std::mutex> lock{_decoder->mutex};
+        #endif
+        ++_decoder->generation;
+        _decoder->first = _decoder->filled = _decoder->offset = 0;
+        _decoder->ended = false;
+    }
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _decoder->condition.notify_one();
+    #endif
+    return *this;
+}
+
+StreamingSource& StreamingSource::update() {
+    Decoder& d = *_decoder;
+
+    /* Reclaim the buffers that were already played */
+    if(const Int processed = _source.buffersProcessed()) {
+        _source.unqueueBuffers(processed);
+        _queuedFirst = (_queuedFirst + processed) % _buffers.size();
+        _queuedCount -= processed;
+    }
+
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    /* No threads, decode everything that fits right here */
+    while(d.canDecode()) {
+        std::size_t offset = d.offset;
+        const std::size_t size = d.decode(offset, d.looping, (d.first + d.filled) % d.sizes.size());
+        d.commit(d.generation, offset, size);
+    }
+    #endif
+
+    /* Take the decoded chunks. The decoder doesn't touch them until they're
+       released, so the upload can be done without holding the lock. */
+    std::size_t first, filled;
+    bool ended;
+    {
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        std::lock_guard<std::mutex> lock{d.mutex};
+        #endif
+        first = d.first;
+        filled = std::min(d.filled, _buffers.size() - _queuedCount);
+        ended = d.ended && filled == d.filled;
+    }
+
+    for(std::size_t i = 0; i != filled; ++i) {
+        const std::size_t chunk = (first + i) % d.sizes.size();
+        Buffer& buffer = _buffers[(_queuedFirst + _queuedCount) % _buffers.size()];
+        buffer.setData(_format, d.data.slice(chunk*_bufferSize, chunk*_bufferSize + d.sizes[chunk]), _frequency);
+        _source.queueBuffers({buffer});
+        ++_queuedCount;
+    }
+
+    /* Release the uploaded chunks for decoding */
+    if(filled) {
+        {
+            #ifndef CORRADE_TARGET_EMSCRIPTEN
+            std::lock_guard<std::mutex> lock{d.mutex};
+            #endif
+            d.first = (d.first + filled) % d.sizes.size();
+            d.filled -= filled;
+        }
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        d.condition.notify_one();
+        #endif
+    }
+
+    /* Start the playback or restart it if the source ran out of data before
+       the next chunk was decoded. If there's nothing more to play, it's
+       finished. */
+    _finished = ended && !_queuedCount;
+    if(_playing) {
+        if(_finished) _playing = false;
+        else if(_queuedCount && _source.state() != Source::State::Playing)
+            _source.play();
+    }
+
+    return *this;
+}
+
+}}
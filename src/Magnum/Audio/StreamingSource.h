@@ -0,0 +1,214 @@
+#ifndef Magnum_Audio_StreamingSource_h
+#define Magnum_Audio_StreamingSource_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::StreamingSource
+ */
+
+#include <memory>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/BufferFormat.h"
+#include "Magnum/Audio/Source.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Streaming source
+
+Plays sound from an @ref AbstractImporter without having the whole decoded
+data in memory. The data are decoded in chunks of @ref bufferSize() bytes
+using @ref AbstractImporter::readData() on a background thread and uploaded
+to a small ring of @ref bufferCount() buffers, which are queued to the
+underlying @ref Source and reused as soon as they are played. The memory
+needed is thus only about twice the @ref bufferSize() times the
+@ref bufferCount(), independently of the sound length.
+
+@code{.cpp}
+std::unique_ptr<Audio::AbstractImporter> importer = manager.instantiate("AnyAudioImporter");
+importer->openFile("music.ogg");
+
+Audio::StreamingSource music{*importer};
+music.setLooping(true)
+    .play();
+
+// in the main loop
+music.update();
+@endcode
+
+The @ref update() function needs to be called regularly from the thread that
+has the OpenAL context current --- it's the only place where the buffers are
+unqueued, filled and queued again. With the default buffer size and count,
+calling it at least every hundred milliseconds is enough to not cause any
+audible gaps for 44.1 kHz stereo sound. If the source runs out of queued
+buffers anyway, it's restarted as soon as new data are available.
+
+The importer is accessed from the background thread for the whole lifetime of
+the instance, so it needs to stay opened and mustn't be used from elsewhere
+meanwhile. Looping is handled by the streaming source itself, don't use
+@ref Source::setLooping() or @ref Source::setBuffer() on the underlying
+@ref source(). On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the data are
+decoded synchronously in @ref update() instead of on a background thread.
+@see @ref Source::queueBuffers(), @ref Source::unqueueBuffers()
+*/
+class MAGNUM_AUDIO_EXPORT StreamingSource {
+    public:
+        /**
+         * @brief Constructor
+         * @param importer      Importer with an opened file
+         * @param bufferSize    Size of a single buffer in bytes
+         * @param bufferCount   Count of buffers in the ring
+         *
+         * The buffer size is rounded down to a whole number of sample
+         * frames. The importer is expected to have a file opened and both
+         * the rounded buffer size and buffer count are expected to be
+         * non-zero. Starts decoding the first chunks right away.
+         */
+        explicit StreamingSource(AbstractImporter& importer, std::size_t bufferSize = 65536, UnsignedInt bufferCount = 4);
+
+        /** @brief Copying is not allowed */
+        StreamingSource(const StreamingSource&) = delete;
+
+        /** @brief Moving is not allowed */
+        StreamingSource(StreamingSource&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops the playback and waits for the background decoding to
+         * finish.
+         */
+        ~StreamingSource();
+
+        /** @brief Copying is not allowed */
+        StreamingSource& operator=(const StreamingSource&) = delete;
+
+        /** @brief Moving is not allowed */
+        StreamingSource& operator=(StreamingSource&&) = delete;
+
+        /**
+         * @brief Underlying source
+         *
+         * Use it for setting position, gain and other source properties.
+         */
+        Source& source() { return _source; }
+        const Source& source() const { return _source; } /**< @overload */
+
+        /** @brief Sample format */
+        BufferFormat format() const { return _format; }
+
+        /** @brief Sample frequency */
+        UnsignedInt frequency() const { return _frequency; }
+
+        /** @brief Size of a single buffer in bytes */
+        std::size_t bufferSize() const { return _bufferSize; }
+
+        /** @brief Count of buffers in the ring */
+        UnsignedInt bufferCount() const { return UnsignedInt(_buffers.size()); }
+
+        /** @brief Whether the stream is looping */
+        bool isLooping() const;
+
+        /**
+         * @brief Set whether the stream is looping
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, the decoding continues from the beginning after the
+         * end of the data is reached. Default is @cpp false @ce.
+         */
+        StreamingSource& setLooping(bool loop);
+
+        /**
+         * @brief Whether the stream is playing
+         *
+         * Returns @cpp true @ce after calling @ref play() until the stream
+         * is paused, stopped or all data were played, including the case
+         * when the @ref source() temporarily ran out of decoded data.
+         */
+        bool isPlaying() const { return _playing; }
+
+        /**
+         * @brief Play
+         * @return Reference to self (for method chaining)
+         *
+         * The playback starts as soon as the first chunk is decoded. If the
+         * stream was paused, resumes the playback, if it was stopped or all
+         * data were played, starts from the beginning.
+         * @see @ref pause(), @ref stop()
+         */
+        StreamingSource& play();
+
+        /**
+         * @brief Pause
+         * @return Reference to self (for method chaining)
+         *
+         * The background decoding continues until all buffers are filled.
+         * @see @ref play(), @ref stop()
+         */
+        StreamingSource& pause();
+
+        /**
+         * @brief Stop
+         * @return Reference to self (for method chaining)
+         *
+         * Stops the playback, discards all decoded data and rewinds the
+         * stream to the beginning.
+         * @see @ref play(), @ref pause()
+         */
+        StreamingSource& stop();
+
+        /**
+         * @brief Update the buffer queue
+         * @return Reference to self (for method chaining)
+         *
+         * Unqueues buffers that were already played, fills them with newly
+         * decoded data and queues them again. Needs to be called regularly,
+         * see @ref StreamingSource "class documentation" for more
+         * information.
+         */
+        StreamingSource& update();
+
+    private:
+        struct Decoder;
+
+        /* Declared before the source so the buffers outlive it */
+        Containers::Array<Buffer> _buffers;
+        Source _source;
+        std::unique_ptr<Decoder> _decoder;
+        BufferFormat _format;
+        UnsignedInt _frequency;
+        std::size_t _bufferSize;
+        /* Ring of buffers queued to the source, the processed ones are always
+           at the front */
+        std::size_t _queuedFirst{}, _queuedCount{};
+        bool _playing{}, _finished{};
+};
+
+}}
+
+#endif
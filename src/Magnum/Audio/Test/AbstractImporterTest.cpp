@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <string>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
@@ -37,10 +38,14 @@ struct AbstractImporterTest: TestSuite::Tester {
     explicit AbstractImporterTest();
 
     void openFile();
+    void readData();
+    void dataView();
 };
 
 AbstractImporterTest::AbstractImporterTest() {
-    addTests({&AbstractImporterTest::openFile});
+    addTests({&AbstractImporterTest::openFile,
+              &AbstractImporterTest::readData,
+              &AbstractImporterTest::dataView});
 }
 
 void AbstractImporterTest::openFile() {
@@ -71,6 +76,54 @@ void AbstractImporterTest::openFile() {
     CORRADE_VERIFY(importer.isOpened());
 }
 
+void AbstractImporterTest::readData() {
+    class Importer: public Audio::AbstractImporter {
+        private:
+            Features doFeatures() const override { return {}; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            BufferFormat doFormat() const override { return {}; }
+            UnsignedInt doFrequency() const override { return {}; }
+            Corrade::Containers::Array<char> doData() override {
+                return Containers::Array<char>{Containers::InPlaceInit, {
+                    'a', 'b', 'c', 'd', 'e', 'f', 'g'}};
+            }
+    };
+
+    /* Default doReadData() should slice the output of doData() */
+    Importer importer;
+    char data[4];
+    CORRADE_COMPARE(importer.readData(1, data), 4);
+    CORRADE_COMPARE(std::string(data, 4), "bcde");
+    CORRADE_COMPARE(importer.readData(5, data), 2);
+    CORRADE_COMPARE(std::string(data, 2), "fg");
+    CORRADE_COMPARE(importer.readData(7, data), 0);
+}
+
+void AbstractImporterTest::dataView() {
+    class Importer: public Audio::AbstractImporter {
+        private:
+            Features doFeatures() const override { return Feature::DataView; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            BufferFormat doFormat() const override { return {}; }
+            UnsignedInt doFrequency() const override { return {}; }
+            Corrade::Containers::Array<char> doData() override { return nullptr; }
+            Containers::ArrayView<const char> doDataView() override {
+                return {data, 7};
+            }
+
+            const char data[7]{'a', 'b', 'c', 'd', 'e', 'f', 'g'};
+    };
+
+    Importer importer;
+    const Containers::ArrayView<const char> view = importer.dataView();
+    CORRADE_COMPARE(view.size(), 7);
+    CORRADE_COMPARE(std::string(view, view.size()), "abcdefg");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::AbstractImporterTest)
@@ -26,6 +26,7 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/BufferFormat.h"
 #include "Magnum/Audio/Context.h"
 
 namespace Magnum { namespace Audio { namespace Test {
@@ -34,12 +35,14 @@ struct BufferALTest: TestSuite::Tester {
     explicit BufferALTest();
 
     void construct();
+    void properties();
 
     Context _context;
 };
 
 BufferALTest::BufferALTest() {
-    addTests({&BufferALTest::construct});
+    addTests({&BufferALTest::construct,
+              &BufferALTest::properties});
 }
 
 void BufferALTest::construct() {
@@ -47,6 +50,18 @@ void BufferALTest::construct() {
     CORRADE_VERIFY(buf.id() != 0);
 }
 
+void BufferALTest::properties() {
+    const char data[8000]{};
+    Buffer buf;
+    buf.setData(BufferFormat::Stereo16, data, 1000);
+
+    CORRADE_COMPARE(buf.frequency(), 1000);
+    CORRADE_COMPARE(buf.size(), 8000);
+    CORRADE_COMPARE(buf.channels(), 2);
+    CORRADE_COMPARE(buf.bits(), 16);
+    CORRADE_COMPARE(buf.duration(), 2.0f);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::BufferALTest)
@@ -0,0 +1,271 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Audio/Mixer.h"
+
+namespace Magnum { namespace Audio { namespace Test {
+
+struct MixerTest: TestSuite::Tester {
+    explicit MixerTest();
+
+    void construct();
+    void addRemoveVoice();
+
+    void mixMono();
+    void mixStereo();
+    void mixFormats();
+    void mixEnd();
+    void mixLooping();
+    void mixFilter();
+    void mixMasterGain();
+    void mixMultithreaded();
+};
+
+MixerTest::MixerTest() {
+    addTests({&MixerTest::construct,
+              &MixerTest::addRemoveVoice,
+
+              &MixerTest::mixMono,
+              &MixerTest::mixStereo,
+              &MixerTest::mixFormats,
+              &MixerTest::mixEnd,
+              &MixerTest::mixLooping,
+              &MixerTest::mixFilter,
+              &MixerTest::mixMasterGain,
+              &MixerTest::mixMultithreaded});
+}
+
+void MixerTest::construct() {
+    Mixer mixer{44100, 3};
+    CORRADE_COMPARE(mixer.frequency(), 44100);
+    CORRADE_COMPARE(mixer.threadCount(), 3);
+    CORRADE_COMPARE(mixer.voiceCount(), 0);
+    CORRADE_COMPARE(mixer.masterGain(), 1.0f);
+}
+
+void MixerTest::addRemoveVoice() {
+    const Float data[4]{};
+
+    Mixer mixer{44100};
+    UnsignedInt a = mixer.addVoice(BufferFormat::MonoFloat, data);
+    UnsignedInt b = mixer.addVoice(BufferFormat::StereoFloat, data);
+    CORRADE_COMPARE(a, 0);
+    CORRADE_COMPARE(b, 1);
+    CORRADE_COMPARE(mixer.voiceCount(), 2);
+    CORRADE_COMPARE(mixer.gain(a), 1.0f);
+    CORRADE_COMPARE(mixer.pan(a), 0.0f);
+    CORRADE_VERIFY(!mixer.isLooping(a));
+    CORRADE_VERIFY(!mixer.isPlaying(a));
+    CORRADE_COMPARE(mixer.offset(a), 0);
+
+    mixer.removeVoice(a);
+    CORRADE_COMPARE(mixer.voiceCount(), 1);
+
+    /* The ID gets reused */
+    CORRADE_COMPARE(mixer.addVoice(BufferFormat::Mono16, data), 0);
+    CORRADE_COMPARE(mixer.voiceCount(), 2);
+}
+
+void MixerTest::mixMono() {
+    const Float data[]{1.0f, 0.5f, -0.5f, -1.0f};
+
+    Mixer mixer{44100};
+    UnsignedInt left = mixer.addVoice(BufferFormat::MonoFloat, data);
+    UnsignedInt center = mixer.addVoice(BufferFormat::MonoFloat, data);
+    mixer.setPan(left, -1.0f)
+        .setGain(left, 0.5f)
+        .play(left)
+        .play(center);
+
+    Float output[8];
+    mixer.mix(output);
+
+    /* Center is panned with constant power */
+    const Float c = std::sqrt(0.5f);
+    CORRADE_COMPARE(output[0], 0.5f + c);
+    CORRADE_COMPARE(output[1], c);
+    CORRADE_COMPARE(output[2], 0.25f + 0.5f*c);
+    CORRADE_COMPARE(output[3], 0.5f*c);
+    CORRADE_COMPARE(output[6], -0.5f - c);
+    CORRADE_COMPARE(output[7], -c);
+}
+
+void MixerTest::mixStereo() {
+    const Float data[]{1.0f, 0.5f, -0.5f, -1.0f};
+
+    Mixer mixer{44100};
+    UnsignedInt voice = mixer.addVoice(BufferFormat::StereoFloat, data);
+    mixer.setPan(voice, 0.5f)
+        .play(voice);
+
+    Float output[4];
+    mixer.mix(output);
+
+    /* The left channel is attenuated, the right one untouched */
+    CORRADE_COMPARE(output[0], 0.5f);
+    CORRADE_COMPARE(output[1], 0.5f);
+    CORRADE_COMPARE(output[2], -0.25f);
+    CORRADE_COMPARE(output[3], -1.0f);
+}
+
+void MixerTest::mixFormats() {
+    const UnsignedByte data8[]{255, 128, 0, 64};
+    const Short data16[]{16384, -32768};
+
+    Mixer mixer{44100};
+    UnsignedInt a = mixer.addVoice(BufferFormat::Stereo8, data8);
+    UnsignedInt b = mixer.addVoice(BufferFormat::Stereo16, data16);
+    mixer.play(a)
+        .play(b);
+
+    Float output[4];
+    mixer.mix(output);
+
+    CORRADE_COMPARE(output[0], 127.0f/128.0f + 0.5f);
+    CORRADE_COMPARE(output[1], -1.0f);
+    CORRADE_COMPARE(output[2], -1.0f);
+    CORRADE_COMPARE(output[3], -0.5f);
+}
+
+void MixerTest::mixEnd() {
+    const Float data[]{1.0f, 1.0f, 1.0f};
+
+    Mixer mixer{44100};
+    UnsignedInt voice = mixer.addVoice(BufferFormat::StereoFloat, data);
+    mixer.play(voice);
+
+    /* Only the first frame is complete, the rest is silence */
+    Float output[6];
+    mixer.mix(output);
+    CORRADE_COMPARE(output[0], 1.0f);
+    CORRADE_COMPARE(output[1], 1.0f);
+    CORRADE_COMPARE(output[2], 0.0f);
+    CORRADE_COMPARE(output[5], 0.0f);
+
+    CORRADE_VERIFY(!mixer.isPlaying(voice));
+    CORRADE_COMPARE(mixer.offset(voice), 0);
+}
+
+void MixerTest::mixLooping() {
+    const Float data[]{1.0f, 1.0f, 0.5f, 0.5f};
+
+    Mixer mixer{44100};
+    UnsignedInt voice = mixer.addVoice(BufferFormat::StereoFloat, data);
+    mixer.setLooping(voice, true)
+        .play(voice);
+
+    Float output[6];
+    mixer.mix(output);
+    CORRADE_COMPARE(output[0], 1.0f);
+    CORRADE_COMPARE(output[2], 0.5f);
+    CORRADE_COMPARE(output[4], 1.0f);
+    CORRADE_VERIFY(mixer.isPlaying(voice));
+    CORRADE_COMPARE(mixer.offset(voice), 1);
+
+    mixer.mix(output);
+    CORRADE_COMPARE(output[0], 0.5f);
+    CORRADE_COMPARE(output[2], 1.0f);
+    CORRADE_COMPARE(output[4], 0.5f);
+}
+
+void MixerTest::mixFilter() {
+    const Float data[]{1.0f, 0.5f, 0.25f};
+
+    Mixer mixer{44100};
+    UnsignedInt voice = mixer.addVoice(BufferFormat::MonoFloat, data);
+
+    struct State {
+        Int called;
+        std::size_t size;
+        UnsignedInt channelCount;
+    } state{};
+    mixer.setFilter(voice, [](Containers::ArrayView<Float> samples, UnsignedInt channelCount, void* state) {
+        State& s = *static_cast<State*>(state);
+        ++s.called;
+        s.size = samples.size();
+        s.channelCount = channelCount;
+        /* Invert the signal */
+        for(Float& sample: samples) sample = -sample;
+    }, &state)
+        .setPan(voice, 1.0f)
+        .play(voice);
+
+    Float output[6];
+    mixer.mix(output);
+    CORRADE_COMPARE(state.called, 1);
+    CORRADE_COMPARE(state.size, 3);
+    CORRADE_COMPARE(state.channelCount, 1);
+    CORRADE_COMPARE(output[1], -1.0f);
+    CORRADE_COMPARE(output[3], -0.5f);
+    CORRADE_COMPARE(output[5], -0.25f);
+}
+
+void MixerTest::mixMasterGain() {
+    const Float data[]{1.0f, 0.5f};
+
+    Mixer mixer{44100};
+    UnsignedInt voice = mixer.addVoice(BufferFormat::StereoFloat, data);
+    mixer.setMasterGain(0.5f)
+        .play(voice);
+
+    Float output[2];
+    mixer.mix(output);
+    CORRADE_COMPARE(output[0], 0.5f);
+    CORRADE_COMPARE(output[1], 0.25f);
+}
+
+void MixerTest::mixMultithreaded() {
+    /* Longer than a single block to test also the block splitting */
+    Containers::Array<Float> data{Containers::NoInit, 1000};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Float(i % 17)/17.0f - 0.5f;
+
+    Mixer single{44100};
+    Mixer multi{44100, 4};
+    for(Mixer* mixer: {&single, &multi}) for(Int i = 0; i != 7; ++i) {
+        UnsignedInt voice = mixer->addVoice(i % 2 ? BufferFormat::StereoFloat : BufferFormat::MonoFloat, data);
+        mixer->setGain(voice, 0.1f*i)
+            .setPan(voice, i/7.0f - 0.5f)
+            .setLooping(voice, i % 3)
+            .play(voice);
+    }
+
+    Containers::Array<Float> expected{Containers::NoInit, 1200};
+    Containers::Array<Float> actual{Containers::NoInit, 1200};
+    for(Int i = 0; i != 2; ++i) {
+        single.mix(expected);
+        multi.mix(actual);
+        for(std::size_t j = 0; j != expected.size(); ++j)
+            CORRADE_COMPARE(actual[j], expected[j]);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::MixerTest)
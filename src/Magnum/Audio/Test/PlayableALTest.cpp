@@ -42,6 +42,8 @@ struct PlayableALTest: TestSuite::Tester {
     explicit PlayableALTest();
 
     void feature();
+    void featureDirectional();
+    void featureUnchanged();
     void group();
 
     Context _context;
@@ -49,6 +51,8 @@ struct PlayableALTest: TestSuite::Tester {
 
 PlayableALTest::PlayableALTest() {
     addTests({&PlayableALTest::feature,
+              &PlayableALTest::featureDirectional,
+              &PlayableALTest::featureUnchanged,
               &PlayableALTest::group});
 }
 
@@ -65,6 +69,39 @@ void PlayableALTest::feature() {
     CORRADE_COMPARE(playable.source().position(), offset);
 }
 
+void PlayableALTest::featureDirectional() {
+    Scene3D scene;
+    Object3D object{&scene};
+    Playable3D playable{object, Vector3::zAxis()};
+
+    object.rotateY(Deg(90.0f));
+    object.setClean();
+
+    CORRADE_COMPARE(playable.source().direction(), Vector3::xAxis());
+}
+
+void PlayableALTest::featureUnchanged() {
+    Scene3D scene;
+    Object3D object{&scene};
+    Playable3D playable{object};
+
+    object.translate({1.0f, 2.0f, 3.0f});
+    object.setClean();
+    CORRADE_COMPARE(playable.source().position(), (Vector3{1.0f, 2.0f, 3.0f}));
+
+    /* Position set directly on the source isn't overwritten if the object
+       transformation didn't change */
+    playable.source().setPosition({5.0f, 6.0f, 7.0f});
+    object.setDirty();
+    object.setClean();
+    CORRADE_COMPARE(playable.source().position(), (Vector3{5.0f, 6.0f, 7.0f}));
+
+    /* But it is if it changed */
+    object.translate({1.0f, 0.0f, 0.0f});
+    object.setClean();
+    CORRADE_COMPARE(playable.source().position(), (Vector3{2.0f, 2.0f, 3.0f}));
+}
+
 void PlayableALTest::group() {
     Scene3D scene;
     Object3D object{&scene};
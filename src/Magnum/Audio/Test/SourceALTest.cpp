@@ -25,6 +25,8 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/BufferFormat.h"
 #include "Magnum/Audio/Context.h"
 #include "Magnum/Audio/Source.h"
 
@@ -47,6 +49,8 @@ struct SourceALTest: TestSuite::Tester {
     void coneAnglesAndGain();
     void rolloffFactor();
 
+    void queueBuffers();
+
     Context _context;
 };
 
@@ -63,7 +67,9 @@ SourceALTest::SourceALTest() {
               &SourceALTest::maxGain,
               &SourceALTest::minGain,
               &SourceALTest::coneAnglesAndGain,
-              &SourceALTest::rolloffFactor});
+              &SourceALTest::rolloffFactor,
+
+              &SourceALTest::queueBuffers});
 }
 
 void SourceALTest::construct() {
@@ -168,6 +174,30 @@ void SourceALTest::rolloffFactor() {
     CORRADE_COMPARE(source.rolloffFactor(), fact);
 }
 
+void SourceALTest::queueBuffers() {
+    const char data[16]{};
+    Buffer a, b, c;
+    a.setData(BufferFormat::Mono8, data, 22050);
+    b.setData(BufferFormat::Mono8, data, 22050);
+    c.setData(BufferFormat::Mono8, data, 22050);
+
+    Source source;
+    source.queueBuffers({a, b})
+        .queueBuffers({c});
+    CORRADE_VERIFY(source.type() == Source::Type::Streaming);
+    CORRADE_COMPARE(source.buffersQueued(), 3);
+    CORRADE_COMPARE(source.buffersProcessed(), 0);
+
+    /* After stopping all buffers are processed */
+    source.play();
+    source.stop();
+    CORRADE_COMPARE(source.buffersProcessed(), 3);
+
+    source.unqueueBuffers(2);
+    CORRADE_COMPARE(source.buffersQueued(), 1);
+    CORRADE_COMPARE(source.buffersProcessed(), 1);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::SourceALTest)
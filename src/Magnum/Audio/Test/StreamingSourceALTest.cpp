@@ -0,0 +1,197 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/Context.h"
+#include "Magnum/Audio/StreamingSource.h"
+
+namespace Magnum { namespace Audio { namespace Test {
+
+struct StreamingSourceALTest: TestSuite::Tester {
+    explicit StreamingSourceALTest();
+
+    void construct();
+    void constructNotOpened();
+    void constructZeroBufferSize();
+
+    void update();
+    void updateLooping();
+    void play();
+    void stop();
+
+    Context _context;
+};
+
+StreamingSourceALTest::StreamingSourceALTest() {
+    addTests({&StreamingSourceALTest::construct,
+              &StreamingSourceALTest::constructNotOpened,
+              &StreamingSourceALTest::constructZeroBufferSize,
+
+              &StreamingSourceALTest::update,
+              &StreamingSourceALTest::updateLooping,
+              &StreamingSourceALTest::play,
+              &StreamingSourceALTest::stop});
+}
+
+namespace {
+
+/* Importer producing given amount of 16-bit mono data, with readData()
+   implemented directly */
+class Importer: public AbstractImporter {
+    public:
+        explicit Importer(std::size_t size, bool opened = true): _size{size}, _opened{opened} {}
+
+    private:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return BufferFormat::Mono16; }
+        UnsignedInt doFrequency() const override { return 22050; }
+        Containers::Array<char> doData() override {
+            Containers::Array<char> data{_size};
+            for(std::size_t i = 0; i != _size; ++i) data[i] = char(i);
+            return data;
+        }
+
+        std::size_t doReadData(const std::size_t offset, const Containers::ArrayView<char> destination) override {
+            std::size_t i = 0;
+            for(; i != destination.size() && offset + i < _size; ++i)
+                destination[i] = char(offset + i);
+            return i;
+        }
+
+        std::size_t _size;
+        bool _opened;
+};
+
+/* The decoding is done on a background thread, so wait until the expected
+   count of buffers gets queued */
+bool updateUntilQueued(StreamingSource& source, Int count) {
+    for(std::size_t i = 0; i != 1000; ++i) {
+        source.update();
+        if(source.source().buffersQueued() == count) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    return false;
+}
+
+}
+
+void StreamingSourceALTest::construct() {
+    Importer importer{1000};
+    StreamingSource source{importer, 101, 3};
+    CORRADE_COMPARE(source.format(), BufferFormat::Mono16);
+    CORRADE_COMPARE(source.frequency(), 22050);
+    /* Rounded down to whole sample frames */
+    CORRADE_COMPARE(source.bufferSize(), 100);
+    CORRADE_COMPARE(source.bufferCount(), 3);
+    CORRADE_VERIFY(!source.isLooping());
+    CORRADE_VERIFY(!source.isPlaying());
+    CORRADE_COMPARE(source.source().buffersQueued(), 0);
+}
+
+void StreamingSourceALTest::constructNotOpened() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Importer importer{1000, false};
+    StreamingSource source{importer};
+    CORRADE_COMPARE(out.str(), "Audio::StreamingSource: no file opened\n");
+}
+
+void StreamingSourceALTest::constructZeroBufferSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Importer importer{1000};
+    StreamingSource source{importer, 1, 4};
+    CORRADE_COMPARE(out.str(), "Audio::StreamingSource: expected non-zero buffer count and buffer size of at least one sample frame but got 4 and 1\n");
+}
+
+void StreamingSourceALTest::update() {
+    /* 250 bytes is two full buffers and one half-filled */
+    Importer importer{250};
+    StreamingSource source{importer, 100, 4};
+
+    /* Even without playing, the decoded data are queued */
+    CORRADE_VERIFY(updateUntilQueued(source, 3));
+
+    /* No more data after the end */
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    source.update();
+    CORRADE_COMPARE(source.source().buffersQueued(), 3);
+}
+
+void StreamingSourceALTest::updateLooping() {
+    Importer importer{250};
+    StreamingSource source{importer, 100, 4};
+    source.setLooping(true);
+    CORRADE_VERIFY(source.isLooping());
+
+    /* The data wrap around, so all buffers get filled */
+    CORRADE_VERIFY(updateUntilQueued(source, 4));
+}
+
+void StreamingSourceALTest::play() {
+    Importer importer{100000};
+    StreamingSource source{importer, 1000, 4};
+    source.play();
+    CORRADE_VERIFY(source.isPlaying());
+
+    CORRADE_VERIFY(updateUntilQueued(source, 4));
+    CORRADE_COMPARE(source.source().state(), Source::State::Playing);
+
+    source.pause();
+    CORRADE_VERIFY(!source.isPlaying());
+    CORRADE_COMPARE(source.source().state(), Source::State::Paused);
+}
+
+void StreamingSourceALTest::stop() {
+    Importer importer{100000};
+    StreamingSource source{importer, 1000, 4};
+    source.play();
+    CORRADE_VERIFY(updateUntilQueued(source, 4));
+
+    /* Stopping unqueues everything and rewinds the stream */
+    source.stop();
+    CORRADE_VERIFY(!source.isPlaying());
+    CORRADE_COMPARE(source.source().state(), Source::State::Stopped);
+    CORRADE_COMPARE(source.source().buffersQueued(), 0);
+
+    /* The decoding starts again from the beginning */
+    CORRADE_VERIFY(updateUntilQueued(source, 4));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::StreamingSourceALTest)
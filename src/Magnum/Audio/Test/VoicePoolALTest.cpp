@@ -0,0 +1,216 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/BufferFormat.h"
+#include "Magnum/Audio/Context.h"
+#include "Magnum/Audio/VoicePool.h"
+
+namespace Magnum { namespace Audio { namespace Test {
+
+struct VoicePoolALTest: TestSuite::Tester {
+    explicit VoicePoolALTest();
+
+    void construct();
+    void addRemove();
+    void properties();
+    void invalidId();
+
+    void play();
+    void virtualizeByDistance();
+    void virtualizeByPriority();
+    void virtualFinish();
+    void virtualLooping();
+
+    Context _context;
+    Buffer _buffer;
+};
+
+VoicePoolALTest::VoicePoolALTest() {
+    addTests({&VoicePoolALTest::construct,
+              &VoicePoolALTest::addRemove,
+              &VoicePoolALTest::properties,
+              &VoicePoolALTest::invalidId,
+
+              &VoicePoolALTest::play,
+              &VoicePoolALTest::virtualizeByDistance,
+              &VoicePoolALTest::virtualizeByPriority,
+              &VoicePoolALTest::virtualFinish,
+              &VoicePoolALTest::virtualLooping});
+
+    /* One second of silence */
+    const char data[8000]{};
+    _buffer.setData(BufferFormat::Mono8, data, 8000);
+}
+
+void VoicePoolALTest::construct() {
+    VoicePool pool{4};
+    CORRADE_COMPARE(pool.sourceCount(), 4);
+    CORRADE_COMPARE(pool.voiceCount(), 0);
+    CORRADE_COMPARE(pool.referenceDistance(), 1.0f);
+    CORRADE_COMPARE(pool.rolloffFactor(), 1.0f);
+}
+
+void VoicePoolALTest::addRemove() {
+    VoicePool pool{4};
+    const UnsignedInt a = pool.addVoice(_buffer);
+    const UnsignedInt b = pool.addVoice(_buffer);
+    CORRADE_COMPARE(pool.voiceCount(), 2);
+    CORRADE_VERIFY(a != b);
+
+    /* The ID gets reused */
+    pool.removeVoice(a);
+    CORRADE_COMPARE(pool.voiceCount(), 1);
+    CORRADE_COMPARE(pool.addVoice(_buffer), a);
+}
+
+void VoicePoolALTest::properties() {
+    VoicePool pool{4};
+    const UnsignedInt id = pool.addVoice(_buffer);
+    CORRADE_COMPARE(pool.position(id), Vector3{});
+    CORRADE_COMPARE(pool.gain(id), 1.0f);
+    CORRADE_COMPARE(pool.priority(id), 0);
+    CORRADE_VERIFY(!pool.isLooping(id));
+    CORRADE_VERIFY(!pool.isPlaying(id));
+    CORRADE_VERIFY(!pool.isVirtual(id));
+
+    pool.setPosition(id, {1.0f, 2.0f, 3.0f})
+        .setGain(id, 0.5f)
+        .setPriority(id, 3)
+        .setLooping(id, true);
+    CORRADE_COMPARE(pool.position(id), (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(pool.gain(id), 0.5f);
+    CORRADE_COMPARE(pool.priority(id), 3);
+    CORRADE_VERIFY(pool.isLooping(id));
+}
+
+void VoicePoolALTest::invalidId() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    VoicePool pool{4};
+    const UnsignedInt id = pool.addVoice(_buffer);
+    pool.removeVoice(id);
+    pool.position(id);
+    pool.play(7);
+    CORRADE_COMPARE(out.str(),
+        "Audio::VoicePool::position(): invalid voice ID 0\n"
+        "Audio::VoicePool::play(): invalid voice ID 7\n");
+}
+
+void VoicePoolALTest::play() {
+    VoicePool pool{4};
+    const UnsignedInt id = pool.addVoice(_buffer);
+    pool.play(id);
+
+    /* Virtual until the next update */
+    CORRADE_VERIFY(pool.isPlaying(id));
+    CORRADE_VERIFY(pool.isVirtual(id));
+
+    pool.update({}, 0.0f);
+    CORRADE_VERIFY(pool.isPlaying(id));
+    CORRADE_VERIFY(!pool.isVirtual(id));
+
+    pool.stop(id);
+    CORRADE_VERIFY(!pool.isPlaying(id));
+    CORRADE_VERIFY(!pool.isVirtual(id));
+}
+
+void VoicePoolALTest::virtualizeByDistance() {
+    VoicePool pool{1};
+    const UnsignedInt farVoice = pool.addVoice(_buffer);
+    const UnsignedInt nearVoice = pool.addVoice(_buffer);
+    pool.setPosition(farVoice, {100.0f, 0.0f, 0.0f})
+        .setPosition(nearVoice, {2.0f, 0.0f, 0.0f})
+        .play(farVoice)
+        .play(nearVoice);
+
+    pool.update({}, 0.0f);
+    CORRADE_VERIFY(pool.isVirtual(farVoice));
+    CORRADE_VERIFY(!pool.isVirtual(nearVoice));
+
+    /* Moving the listener swaps them */
+    pool.update({100.0f, 0.0f, 0.0f}, 0.0f);
+    CORRADE_VERIFY(!pool.isVirtual(farVoice));
+    CORRADE_VERIFY(pool.isVirtual(nearVoice));
+}
+
+void VoicePoolALTest::virtualizeByPriority() {
+    VoicePool pool{1};
+    const UnsignedInt quiet = pool.addVoice(_buffer);
+    const UnsignedInt loud = pool.addVoice(_buffer);
+    pool.setGain(quiet, 0.1f)
+        .setPriority(quiet, 1)
+        .play(quiet)
+        .play(loud);
+
+    /* Priority wins over audibility */
+    pool.update({}, 0.0f);
+    CORRADE_VERIFY(!pool.isVirtual(quiet));
+    CORRADE_VERIFY(pool.isVirtual(loud));
+}
+
+void VoicePoolALTest::virtualFinish() {
+    VoicePool pool{1};
+    const UnsignedInt real = pool.addVoice(_buffer);
+    const UnsignedInt id = pool.addVoice(_buffer);
+    pool.setPriority(real, 1)
+        .play(real)
+        .play(id);
+
+    /* The virtual voice keeps its playback time */
+    pool.update({}, 0.25f);
+    CORRADE_VERIFY(pool.isVirtual(id));
+    CORRADE_COMPARE(pool.playbackTime(id), 0.25f);
+    pool.update({}, 0.5f);
+    CORRADE_COMPARE(pool.playbackTime(id), 0.75f);
+
+    /* And stops after reaching the end */
+    pool.update({}, 0.5f);
+    CORRADE_VERIFY(!pool.isPlaying(id));
+}
+
+void VoicePoolALTest::virtualLooping() {
+    VoicePool pool{1};
+    const UnsignedInt real = pool.addVoice(_buffer);
+    const UnsignedInt id = pool.addVoice(_buffer);
+    pool.setPriority(real, 1)
+        .setLooping(id, true)
+        .play(real)
+        .play(id);
+
+    /* Looping voice wraps around */
+    pool.update({}, 0.75f);
+    pool.update({}, 0.5f);
+    CORRADE_VERIFY(pool.isPlaying(id));
+    CORRADE_COMPARE(pool.playbackTime(id), 0.25f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::VoicePoolALTest)
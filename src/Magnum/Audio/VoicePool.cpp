@@ -0,0 +1,261 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "VoicePool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Audio/Buffer.h"
+
+namespace Magnum { namespace Audio {
+
+VoicePool::VoicePool(const UnsignedInt sourceCount): _sources{sourceCount} {
+    /* Reversed so the sources get used from the first one */
+    _freeSources.reserve(sourceCount);
+    for(UnsignedInt i = sourceCount; i != 0; --i)
+        _freeSources.push_back(i - 1);
+}
+
+VoicePool::VoicePool(VoicePool&&) = default;
+
+VoicePool::~VoicePool() = default;
+
+VoicePool& VoicePool::operator=(VoicePool&&) = default;
+
+VoicePool& VoicePool::setReferenceDistance(const Float distance) {
+    _referenceDistance = distance;
+    for(Source& source: _sources) source.setReferenceDistance(distance);
+    return *this;
+}
+
+VoicePool& VoicePool::setRolloffFactor(const Float factor) {
+    _rolloffFactor = factor;
+    for(Source& source: _sources) source.setRolloffFactor(factor);
+    return *this;
+}
+
+bool VoicePool::isValid(const UnsignedInt id) const {
+    return id < _voices.size() && _voices[id].buffer;
+}
+
+UnsignedInt VoicePool::addVoice(Buffer& buffer) {
+    UnsignedInt id;
+    if(!_freeVoices.empty()) {
+        id = _freeVoices.back();
+        _freeVoices.pop_back();
+    } else {
+        id = _voices.size();
+        _voices.emplace_back();
+    }
+
+    _voices[id] = Voice{&buffer, {}, 1.0f, buffer.duration(), 0.0f, 0, -1, false, false, 0.0f};
+    return id;
+}
+
+void VoicePool::removeVoice(const UnsignedInt id) {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::removeVoice(): invalid voice ID" << id, );
+    release(_voices[id]);
+    _voices[id].buffer = nullptr;
+    _freeVoices.push_back(id);
+}
+
+Vector3 VoicePool::position(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::position(): invalid voice ID" << id, {});
+    return _voices[id].position;
+}
+
+VoicePool& VoicePool::setPosition(const UnsignedInt id, const Vector3& position) {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::setPosition(): invalid voice ID" << id, *this);
+    Voice& voice = _voices[id];
+    voice.position = position;
+    if(voice.source != -1) _sources[voice.source].setPosition(position);
+    return *this;
+}
+
+Float VoicePool::gain(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::gain(): invalid voice ID" << id, {});
+    return _voices[id].gain;
+}
+
+VoicePool& VoicePool::setGain(const UnsignedInt id, const Float gain) {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::setGain(): invalid voice ID" << id, *this);
+    Voice& voice = _voices[id];
+    voice.gain = gain;
+    if(voice.source != -1) _sources[voice.source].setGain(gain);
+    return *this;
+}
+
+Int VoicePool::priority(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::priority(): invalid voice ID" << id, {});
+    return _voices[id].priority;
+}
+
+VoicePool& VoicePool::setPriority(const UnsignedInt id, const Int priority) {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::setPriority(): invalid voice ID" << id, *this);
+    _voices[id].priority = priority;
+    return *this;
+}
+
+bool VoicePool::isLooping(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::isLooping(): invalid voice ID" << id, {});
+    return _voices[id].looping;
+}
+
+VoicePool& VoicePool::setLooping(const UnsignedInt id, const bool loop) {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::setLooping(): invalid voice ID" << id, *this);
+    Voice& voice = _voices[id];
+    voice.looping = loop;
+    if(voice.source != -1) _sources[voice.source].setLooping(loop);
+    return *this;
+}
+
+VoicePool& VoicePool::play(const UnsignedInt id) {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::play(): invalid voice ID" << id, *this);
+    Voice& voice = _voices[id];
+    voice.playing = true;
+    voice.time = 0.0f;
+    if(voice.source != -1) {
+        Source& source = _sources[voice.source];
+        source.rewind();
+        source.play();
+    }
+    return *this;
+}
+
+VoicePool& VoicePool::stop(const UnsignedInt id) {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::stop(): invalid voice ID" << id, *this);
+    Voice& voice = _voices[id];
+    voice.playing = false;
+    voice.time = 0.0f;
+    release(voice);
+    return *this;
+}
+
+bool VoicePool::isPlaying(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::isPlaying(): invalid voice ID" << id, {});
+    return _voices[id].playing;
+}
+
+bool VoicePool::isVirtual(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::isVirtual(): invalid voice ID" << id, {});
+    return _voices[id].playing && _voices[id].source == -1;
+}
+
+Float VoicePool::playbackTime(const UnsignedInt id) const {
+    CORRADE_ASSERT(isValid(id), "Audio::VoicePool::playbackTime(): invalid voice ID" << id, {});
+    const Voice& voice = _voices[id];
+    return voice.source != -1 ? _sources[voice.source].offsetInSeconds() : voice.time;
+}
+
+void VoicePool::bind(Voice& voice, const UnsignedInt source) {
+    Source& s = _sources[source];
+    s.setBuffer(voice.buffer)
+        .setPosition(voice.position)
+        .setGain(voice.gain)
+        .setLooping(voice.looping)
+        .setOffsetInSeconds(voice.time);
+    s.play();
+    voice.source = source;
+}
+
+void VoicePool::release(Voice& voice) {
+    if(voice.source == -1) return;
+
+    Source& source = _sources[voice.source];
+    source.stop();
+    source.setBuffer(nullptr);
+    _freeSources.push_back(voice.source);
+    voice.source = -1;
+}
+
+void VoicePool::update(const Vector3& listenerPosition, const Float timeDelta) {
+    /* Advance the playing voices and calculate their audibility */
+    _playing.clear();
+    for(UnsignedInt i = 0; i != _voices.size(); ++i) {
+        Voice& voice = _voices[i];
+        if(!voice.buffer || !voice.playing) continue;
+
+        /* Real voices are advanced by OpenAL, virtual voices need to be done
+           manually */
+        if(voice.source != -1) {
+            if(_sources[voice.source].state() == Source::State::Stopped) {
+                voice.playing = false;
+                release(voice);
+                continue;
+            }
+        } else {
+            voice.time += timeDelta;
+            if(voice.time >= voice.duration) {
+                if(!voice.looping || voice.duration <= 0.0f) {
+                    voice.playing = false;
+                    continue;
+                }
+                voice.time = std::fmod(voice.time, voice.duration);
+            }
+        }
+
+        /* Same as AL_INVERSE_DISTANCE_CLAMPED */
+        const Float distance = std::max((voice.position - listenerPosition).length(), _referenceDistance);
+        const Float denominator = _referenceDistance + _rolloffFactor*(distance - _referenceDistance);
+        voice.audibility = voice.gain*(denominator > 0.0f ? _referenceDistance/denominator : 1.0f);
+        _playing.push_back(i);
+    }
+
+    /* Order by priority, then by audibility. On a tie prefer voices that are
+       already real to avoid needless switching. */
+    const std::size_t realCount = std::min(_playing.size(), _sources.size());
+    std::partial_sort(_playing.begin(), _playing.begin() + realCount, _playing.end(), [this](const UnsignedInt a, const UnsignedInt b) {
+        const Voice& va = _voices[a];
+        const Voice& vb = _voices[b];
+        if(va.priority != vb.priority) return va.priority > vb.priority;
+        if(va.audibility != vb.audibility) return va.audibility > vb.audibility;
+        return va.source != -1 && vb.source == -1;
+    });
+
+    /* Virtualize the less audible voices first to have their sources
+       available, remembering where they were */
+    for(std::size_t i = realCount; i != _playing.size(); ++i) {
+        Voice& voice = _voices[_playing[i]];
+        if(voice.source == -1) continue;
+
+        voice.time = _sources[voice.source].offsetInSeconds();
+        release(voice);
+    }
+
+    /* Bind sources to the most audible voices that don't have them yet */
+    for(std::size_t i = 0; i != realCount; ++i) {
+        Voice& voice = _voices[_playing[i]];
+        if(voice.source != -1) continue;
+
+        CORRADE_INTERNAL_ASSERT(!_freeSources.empty());
+        const UnsignedInt source = _freeSources.back();
+        _freeSources.pop_back();
+        bind(voice, source);
+    }
+}
+
+}}
@@ -0,0 +1,283 @@
+#ifndef Magnum_Audio_VoicePool_h
+#define Magnum_Audio_VoicePool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::VoicePool
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Audio/Source.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Pool of virtualized voices
+
+OpenAL implementations support only a limited amount of sources and each
+@ref Source instance holds one for its whole lifetime. The voice pool instead
+manages a large number of lightweight logical voices and binds a fixed set of
+@ref sourceCount() real sources only to the most audible ones. The remaining
+voices are *virtual* --- they play silently, with only their playback time
+being advanced, and when they become audible enough, they continue from the
+right position on a real source.
+
+@code{.cpp}
+Audio::VoicePool pool{32};
+
+UnsignedInt footsteps = pool.addVoice(footstepsBuffer);
+pool.setPosition(footsteps, {3.0f, 0.0f, -1.0f})
+    .setLooping(footsteps, true)
+    .play(footsteps);
+
+// every frame
+pool.update(listenerPosition, timeDelta);
+@endcode
+
+@section Audio-VoicePool-audibility Audibility
+
+On every @ref update() the playing voices are ordered by priority set using
+@ref setPriority() and voices with the same priority by their audibility,
+which is the voice gain multiplied by distance attenuation relative to the
+listener position. The attenuation estimate follows the default
+@ref Renderer::DistanceModel::InverseClamped model with reference distance and
+rolloff factor set using @ref setReferenceDistance() and
+@ref setRolloffFactor(). The first @ref sourceCount() voices get a real
+source, the others are virtual.
+
+Voice properties are passed to the real source immediately, becoming real or
+virtual happens only during @ref update(). A voice becomes real at the earliest
+in the first @ref update() after @ref play() was called.
+@see @ref Listener, @ref Playable
+*/
+class MAGNUM_AUDIO_EXPORT VoicePool {
+    public:
+        /**
+         * @brief Constructor
+         * @param sourceCount   Count of real sources
+         *
+         * Creates @p sourceCount OpenAL sources.
+         */
+        explicit VoicePool(UnsignedInt sourceCount);
+
+        /** @brief Copying is not allowed */
+        VoicePool(const VoicePool&) = delete;
+
+        /** @brief Move constructor */
+        VoicePool(VoicePool&&);
+
+        ~VoicePool();
+
+        /** @brief Copying is not allowed */
+        VoicePool& operator=(const VoicePool&) = delete;
+
+        /** @brief Move assignment */
+        VoicePool& operator=(VoicePool&&);
+
+        /** @brief Count of real sources */
+        UnsignedInt sourceCount() const { return UnsignedInt(_sources.size()); }
+
+        /**
+         * @brief Count of voices
+         *
+         * Count of voices added using @ref addVoice() and not removed using
+         * @ref removeVoice().
+         */
+        std::size_t voiceCount() const { return _voices.size() - _freeVoices.size(); }
+
+        /** @brief Reference distance used for audibility estimation */
+        Float referenceDistance() const { return _referenceDistance; }
+
+        /**
+         * @brief Set reference distance used for audibility estimation
+         * @return Reference to self (for method chaining)
+         *
+         * Also passed to all real sources. Default is @cpp 1.0f @ce.
+         * @see @ref Source::setReferenceDistance()
+         */
+        VoicePool& setReferenceDistance(Float distance);
+
+        /** @brief Rolloff factor used for audibility estimation */
+        Float rolloffFactor() const { return _rolloffFactor; }
+
+        /**
+         * @brief Set rolloff factor used for audibility estimation
+         * @return Reference to self (for method chaining)
+         *
+         * Also passed to all real sources. Default is @cpp 1.0f @ce.
+         * @see @ref Source::setRolloffFactor()
+         */
+        VoicePool& setRolloffFactor(Float factor);
+
+        /**
+         * @brief Add a voice
+         * @param buffer    Buffer to play. Expected to be filled with data
+         *      and kept in scope for the whole voice lifetime.
+         *
+         * Returns ID of the voice. The voice is initially stopped, at origin,
+         * with gain of @cpp 1.0f @ce, priority @cpp 0 @ce and not looping.
+         * Removed voice IDs may get reused.
+         */
+        UnsignedInt addVoice(Buffer& buffer);
+
+        /**
+         * @brief Remove a voice
+         *
+         * Stops the voice and frees its ID.
+         */
+        void removeVoice(UnsignedInt id);
+
+        /** @brief Voice position */
+        Vector3 position(UnsignedInt id) const;
+
+        /**
+         * @brief Set voice position
+         * @return Reference to self (for method chaining)
+         *
+         * Default is zero vector.
+         * @see @ref Source::setPosition()
+         */
+        VoicePool& setPosition(UnsignedInt id, const Vector3& position);
+
+        /** @brief Voice gain */
+        Float gain(UnsignedInt id) const;
+
+        /**
+         * @brief Set voice gain
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp 1.0f @ce.
+         * @see @ref Source::setGain()
+         */
+        VoicePool& setGain(UnsignedInt id, Float gain);
+
+        /** @brief Voice priority */
+        Int priority(UnsignedInt id) const;
+
+        /**
+         * @brief Set voice priority
+         * @return Reference to self (for method chaining)
+         *
+         * Voices with higher priority get a real source before voices with
+         * lower priority, regardless of their audibility. Default is
+         * @cpp 0 @ce.
+         */
+        VoicePool& setPriority(UnsignedInt id, Int priority);
+
+        /** @brief Whether the voice is looping */
+        bool isLooping(UnsignedInt id) const;
+
+        /**
+         * @brief Set voice looping
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp false @ce.
+         * @see @ref Source::setLooping()
+         */
+        VoicePool& setLooping(UnsignedInt id, bool loop);
+
+        /**
+         * @brief Play the voice from the beginning
+         * @return Reference to self (for method chaining)
+         */
+        VoicePool& play(UnsignedInt id);
+
+        /**
+         * @brief Stop the voice
+         * @return Reference to self (for method chaining)
+         *
+         * Releases the real source, if any.
+         */
+        VoicePool& stop(UnsignedInt id);
+
+        /**
+         * @brief Whether the voice is playing
+         *
+         * Returns @cpp true @ce also for virtual voices. A non-looping voice
+         * stops playing after reaching its end.
+         */
+        bool isPlaying(UnsignedInt id) const;
+
+        /**
+         * @brief Whether the voice is virtual
+         *
+         * Returns @cpp true @ce if the voice is playing, but doesn't have a
+         * real source.
+         */
+        bool isVirtual(UnsignedInt id) const;
+
+        /**
+         * @brief Playback time in seconds
+         *
+         * @see @ref Source::offsetInSeconds()
+         */
+        Float playbackTime(UnsignedInt id) const;
+
+        /**
+         * @brief Update the voices
+         * @param listenerPosition  Listener position
+         * @param timeDelta         Time elapsed since previous update, in
+         *      seconds
+         *
+         * Advances playback time of virtual voices, finishes voices that
+         * reached their end and assigns real sources to the most audible
+         * playing voices. See @ref Audio-VoicePool-audibility for more
+         * information.
+         */
+        void update(const Vector3& listenerPosition, Float timeDelta);
+
+    private:
+        struct Voice {
+            Buffer* buffer;
+            Vector3 position;
+            Float gain, duration, time;
+            Int priority;
+            /* Index into _sources or -1 if virtual / stopped */
+            Int source;
+            bool looping, playing;
+            /* Used by update() */
+            Float audibility;
+        };
+
+        MAGNUM_AUDIO_LOCAL bool isValid(UnsignedInt id) const;
+        MAGNUM_AUDIO_LOCAL void bind(Voice& voice, UnsignedInt source);
+        MAGNUM_AUDIO_LOCAL void release(Voice& voice);
+
+        Containers::Array<Source> _sources;
+        std::vector<UnsignedInt> _freeSources;
+        std::vector<Voice> _voices;
+        std::vector<UnsignedInt> _freeVoices;
+        Float _referenceDistance{1.0f}, _rolloffFactor{1.0f};
+        /* Reused across update() calls to avoid reallocations */
+        std::vector<UnsignedInt> _playing;
+};
+
+}}
+
+#endif
@@ -47,7 +47,9 @@ namespace Implementation {
 @brief Buffer subdata
 
 Emulates @ref GL::Buffer::subData() call on platforms that don't support it
-(such as OpenGL ES) by using @ref GL::Buffer::map().
+(such as OpenGL ES) by using @ref GL::Buffer::map(). The call waits for all
+GPU work writing to the buffer to finish, see @ref DeferredReadback for a
+variant that doesn't stall.
 
 @note This function is available only if Magnum is compiled with
     @ref MAGNUM_TARGET_GL "TARGET_GL" enabled (done by default). See
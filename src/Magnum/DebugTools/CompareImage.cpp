@@ -25,12 +25,15 @@
 
 #include "CompareImage.h"
 
+#include <atomic>
 #include <map>
 #include <sstream>
 #include <vector>
+#include <Corrade/Containers/EnumSet.hpp>
 
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Algorithms/KahanSum.h"
@@ -43,9 +46,30 @@ template<std::size_t size, class T> Math::Vector<size, T> pixelAt(const char* co
     return reinterpret_cast<const Math::Vector<size, T>*>(pixels + stride*pos.y())[pos.x()];
 }
 
-template<std::size_t size, class T> Float calculateImageDelta(const ImageView2D& actual, const ImageView2D& expected, std::vector<Float>& output) {
-    CORRADE_INTERNAL_ASSERT(output.size() == std::size_t(expected.size().product()));
+/* Calculates deltas of a single row. Both rows are accessed linearly and
+   with the channel count known at compile time, so the compiler can unroll
+   and vectorize the inner loop. Returns max of the deltas. */
+template<std::size_t size, class T> Float calculateRowDelta(const char* const actualRow, const char* const expectedRow, const std::size_t width, Float* const output) {
+    const T* const actualData = reinterpret_cast<const T*>(actualRow);
+    const T* const expectedData = reinterpret_cast<const T*>(expectedRow);
 
+    Float max{};
+    for(std::size_t x = 0; x != width; ++x) {
+        Float value{};
+        for(std::size_t i = 0; i != size; ++i)
+            value += Math::abs(Float(actualData[x*size + i]) - Float(expectedData[x*size + i]));
+        value /= size;
+        output[x] = value;
+        max = Math::max(max, value);
+    }
+
+    return max;
+}
+
+/* Calculates max and mean delta, optionally saving the per-pixel deltas into
+   output. Returns false if the calculation was stopped at a row with max
+   delta above earlyOutThreshold, in which case mean is not calculated. */
+template<std::size_t size, class T> bool calculateImageDelta(const ImageView2D& actual, const ImageView2D& expected, Float* const output, const Float earlyOutThreshold, const UnsignedInt threadCount, Float& max, Float& mean) {
     /* Precalculate parameters for pixel access */
     Math::Vector2<std::size_t> dataOffset, dataSize;
 
@@ -57,42 +81,58 @@ template<std::size_t size, class T> Float calculateImageDelta(const ImageView2D&
     const char* const expectedPixels = expected.data() + dataOffset.sum();
     const std::size_t expectedStride = dataSize.x();
 
-    /* Calculate deltas and maximal value of them */
-    Float max{};
-    for(std::int_fast32_t y = 0; y != expected.size().y(); ++y) {
-        for(std::int_fast32_t x = 0; x != expected.size().x(); ++x) {
-            Math::Vector<size, Float> actualPixel{pixelAt<size, T>(actualPixels, actualStride, {Int(x), Int(y)})};
-            Math::Vector<size, Float> expectedPixel{pixelAt<size, T>(expectedPixels, expectedStride, {Int(x), Int(y)})};
-
-            const Float value = (Math::abs(actualPixel - expectedPixel)).sum()/size;
-            output[y*expected.size().x() + x] = value;
-            max = Math::max(max, value);
+    const std::size_t width = expected.size().x();
+    const std::size_t height = expected.size().y();
+
+    /* Max and sum is calculated for each row separately and reduced only at
+       the end, so the result is the same regardless of the thread count */
+    std::vector<Float> rowMax(height), rowSum(height);
+    std::atomic<bool> aboveThreshold{false};
+
+    /* Distribute blocks of rows among the threads. If the deltas are not
+       needed, each block reuses a single row of scratch memory instead of
+       allocating the whole delta image. */
+    constexpr std::size_t RowsPerTask = 16;
+    Magnum::Implementation::parallelFor(threadCount, (height + RowsPerTask - 1)/RowsPerTask, [&](const std::size_t task) {
+        std::vector<Float> scratch;
+        if(!output) scratch.resize(width);
+
+        const std::size_t end = Math::min(height, (task + 1)*RowsPerTask);
+        for(std::size_t y = task*RowsPerTask; y != end; ++y) {
+            if(aboveThreshold) return;
+
+            Float* const row = output ? output + y*width : scratch.data();
+            rowMax[y] = calculateRowDelta<size, T>(actualPixels + y*actualStride, expectedPixels + y*expectedStride, width, row);
+            rowSum[y] = Math::Algorithms::kahanSum(row, row + width);
+
+            if(rowMax[y] > earlyOutThreshold) aboveThreshold = true;
         }
-    }
+    });
 
-    return max;
-}
+    /* Rows that were not processed due to the early out have zero max, so
+       they don't affect the result */
+    max = {};
+    for(const Float value: rowMax) max = Math::max(max, value);
+    if(aboveThreshold) return false;
 
+    /* Calculate mean delta. Do it the special way so we don't lose
+       precision -- that would result in having false negatives! */
+    mean = Math::Algorithms::kahanSum(rowSum.begin(), rowSum.end())/(width*height);
+    return true;
 }
 
-std::tuple<std::vector<Float>, Float, Float> calculateImageDelta(const ImageView2D& actual, const ImageView2D& expected) {
-    /* Calculate a delta image */
-    std::vector<Float> delta(expected.size().product());
+typedef bool(*CalculateImageDeltaFunction)(const ImageView2D&, const ImageView2D&, Float*, Float, UnsignedInt, Float&, Float&);
 
-    CORRADE_ASSERT(!isPixelFormatImplementationSpecific(expected.format()),
+CalculateImageDeltaFunction calculateImageDeltaFunction(const PixelFormat format) {
+    CORRADE_ASSERT(!isPixelFormatImplementationSpecific(format),
         "DebugTools::CompareImage: can't compare implementation-specific pixel formats", {});
 
-    Float max{Constants::nan()};
-    switch(expected.format()) {
+    switch(format) {
         #define _c(format, size, T)                                         \
-            case PixelFormat::format:                                       \
-                max = calculateImageDelta<size, T>(actual, expected, delta); \
-                break;
+            case PixelFormat::format: return calculateImageDelta<size, T>;
         #define _d(first, second, size, T)                                  \
             case PixelFormat::first:                                        \
-            case PixelFormat::second:                                       \
-                max = calculateImageDelta<size, T>(actual, expected, delta); \
-                break;
+            case PixelFormat::second: return calculateImageDelta<size, T>;
         _d(R8Unorm, R8UI, 1, UnsignedByte)
         _d(RG8Unorm, RG8UI, 2, UnsignedByte)
         _d(RGB8Unorm, RGB8UI, 3, UnsignedByte)
@@ -187,16 +227,33 @@ std::tuple<std::vector<Float>, Float, Float> calculateImageDelta(const ImageView
         #endif
     }
 
-    CORRADE_ASSERT(max == max,
-        "DebugTools::CompareImage: unknown format" << expected.format(), {});
+    CORRADE_ASSERT(false,
+        "DebugTools::CompareImage: unknown format" << format, {});
+    return {}; /* LCOV_EXCL_LINE */
+}
 
-    /* Calculate mean delta. Do it the special way so we don't lose
-       precision -- that would result in having false negatives! */
-    const Float mean = Math::Algorithms::kahanSum(delta.begin(), delta.end())/delta.size();
+}
 
+std::tuple<std::vector<Float>, Float, Float> calculateImageDelta(const ImageView2D& actual, const ImageView2D& expected, const UnsignedInt threadCount) {
+    const CalculateImageDeltaFunction calculate = calculateImageDeltaFunction(expected.format());
+    if(!calculate) return {};
+
+    /* Calculate a delta image */
+    std::vector<Float> delta(expected.size().product());
+    Float max, mean;
+    calculate(actual, expected, delta.data(), Constants::inf(), threadCount, max, mean);
     return std::make_tuple(delta, max, mean);
 }
 
+std::tuple<Float, Float, bool> calculateImageMaxMean(const ImageView2D& actual, const ImageView2D& expected, const Float earlyOutThreshold, const UnsignedInt threadCount) {
+    const CalculateImageDeltaFunction calculate = calculateImageDeltaFunction(expected.format());
+    if(!calculate) return {};
+
+    Float max, mean{Constants::nan()};
+    const bool complete = calculate(actual, expected, nullptr, earlyOutThreshold, threadCount, max, mean);
+    return std::make_tuple(max, mean, complete);
+}
+
 namespace {
     /* Done by printing an white to black gradient using one of the online
        ASCII converters. Yes, I'm lazy. Another one could be " .,:;ox%#@". */
@@ -403,7 +460,26 @@ void printPixelDeltas(Debug& out, const std::vector<Float>& delta, const ImageVi
     }
 }
 
-}}}
+}
+
+Debug& operator<<(Debug& debug, const CompareImageFlag value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case CompareImageFlag::value: return debug << "DebugTools::CompareImageFlag::" #value;
+        _c(MaxThresholdEarlyOut)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "DebugTools::CompareImageFlag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const CompareImageFlags value) {
+    return Containers::enumSetDebugOutput(debug, value, "DebugTools::CompareImageFlags{}", {
+        CompareImageFlag::MaxThresholdEarlyOut});
+}
+
+}}
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
 /* If Doxygen sees this, all @ref Corrade::TestSuite links break (prolly
@@ -412,7 +488,7 @@ namespace Corrade { namespace TestSuite {
 
 using namespace Magnum;
 
-Comparator<DebugTools::CompareImage>::Comparator(Float maxThreshold, Float meanThreshold): _maxThreshold{maxThreshold}, _meanThreshold{meanThreshold}, _max{}, _mean{} {
+Comparator<DebugTools::CompareImage>::Comparator(Float maxThreshold, Float meanThreshold, DebugTools::CompareImageFlags flags, UnsignedInt threadCount): _maxThreshold{maxThreshold}, _meanThreshold{meanThreshold}, _flags{flags}, _threadCount{threadCount}, _max{}, _mean{} {
     CORRADE_ASSERT(meanThreshold <= maxThreshold,
         "DebugTools::CompareImage: maxThreshold can't be smaller than meanThreshold", );
 }
@@ -431,11 +507,16 @@ bool Comparator<DebugTools::CompareImage>::operator()(const ImageView2D& actual,
         return false;
     }
 
-    std::vector<Float> delta;
-    std::tie(delta, _max, _mean) = DebugTools::Implementation::calculateImageDelta(actual, expected);
+    /* Calculate just max and mean first, without allocating the delta
+       image. In case the early out is enabled, this stops already after the
+       first row with max delta above the threshold. */
+    bool complete;
+    std::tie(_max, _mean, complete) = DebugTools::Implementation::calculateImageMaxMean(actual, expected, _flags & DebugTools::CompareImageFlag::MaxThresholdEarlyOut ? _maxThreshold : Constants::inf(), _threadCount);
 
     /* If both values are not above threshold, success */
-    if(_max > _maxThreshold && _mean > _meanThreshold)
+    if(!complete)
+        _state = State::AboveMaxThresholdEarlyOut;
+    else if(_max > _maxThreshold && _mean > _meanThreshold)
         _state = State::AboveThresholds;
     else if(_max > _maxThreshold)
         _state = State::AboveMaxThreshold;
@@ -443,8 +524,10 @@ bool Comparator<DebugTools::CompareImage>::operator()(const ImageView2D& actual,
         _state = State::AboveMeanThreshold;
     else return true;
 
-    /* Otherwise save the deltas and fail */
-    _delta = std::move(delta);
+    /* Otherwise calculate the deltas for the diagnostic and fail. Not done
+       with the early out, as there it's only the pass/fail that matters. */
+    if(_state != State::AboveMaxThresholdEarlyOut)
+        _delta = std::get<0>(DebugTools::Implementation::calculateImageDelta(actual, expected, _threadCount));
     return false;
 }
 
@@ -467,7 +550,12 @@ void Comparator<DebugTools::CompareImage>::printErrorMessage(Debug& out, const s
                 << "but at most" << _maxThreshold
                 << "expected. Mean delta" << _mean << "is below threshold"
                 << _meanThreshold << Debug::nospace << ".";
-        else if(_state == State::AboveMeanThreshold)
+        else if(_state == State::AboveMaxThresholdEarlyOut) {
+            out << "max delta above threshold, actual at least" << _max
+                << "but at most" << _maxThreshold << "expected. Mean delta "
+                   "and delta image not calculated due to early out.";
+            return;
+        } else if(_state == State::AboveMeanThreshold)
             out << "mean delta above threshold, actual" << _mean
                 << "but at most" << _meanThreshold
                 << "expected. Max delta" << _max << "is below threshold"
@@ -26,10 +26,11 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::DebugTools::CompareImage
+ * @brief Class @ref Magnum::DebugTools::CompareImage, enum @ref Magnum::DebugTools::CompareImageFlag, enum set @ref Magnum::DebugTools::CompareImageFlags
  */
 
 #include <vector>
+#include <Corrade/Containers/EnumSet.h>
 #include <Corrade/TestSuite/Comparator.h>
 
 #include "Magnum/Magnum.h"
@@ -40,13 +41,49 @@
 namespace Magnum { namespace DebugTools {
 
 namespace Implementation {
-    MAGNUM_DEBUGTOOLS_EXPORT std::tuple<std::vector<Float>, Float, Float> calculateImageDelta(const ImageView2D& actual, const ImageView2D& expected);
+    MAGNUM_DEBUGTOOLS_EXPORT std::tuple<std::vector<Float>, Float, Float> calculateImageDelta(const ImageView2D& actual, const ImageView2D& expected, UnsignedInt threadCount = 1);
+
+    /* Calculates just max and mean without the delta image. If the last
+       value is false, the calculation stopped early at a max delta above
+       earlyOutThreshold and the mean is NaN. */
+    MAGNUM_DEBUGTOOLS_EXPORT std::tuple<Float, Float, bool> calculateImageMaxMean(const ImageView2D& actual, const ImageView2D& expected, Float earlyOutThreshold, UnsignedInt threadCount = 1);
 
     MAGNUM_DEBUGTOOLS_EXPORT void printDeltaImage(Debug& out, const std::vector<Float>& delta, const Vector2i& size, Float max, Float maxThreshold, Float meanThreshold);
 
     MAGNUM_DEBUGTOOLS_EXPORT void printPixelDeltas(Debug& out, const std::vector<Float>& delta, const ImageView2D& actual, const ImageView2D& expected, Float maxThreshold, Float meanThreshold, std::size_t maxCount);
 }
 
+/**
+@brief Image comparison flag
+
+@see @ref CompareImageFlags, @ref CompareImage
+*/
+enum class CompareImageFlag: UnsignedByte {
+    /**
+     * Stop the comparison as soon as a pixel with delta above the max
+     * threshold is found. Useful when only the pass/fail result matters, for
+     * example when comparing large images in bulk. Neither the mean delta
+     * nor the delta image is calculated in that case, so the diagnostic
+     * output on failure contains only the max delta found so far.
+     */
+    MaxThresholdEarlyOut = 1 << 0
+};
+
+/** @debugoperatorenum{CompareImageFlag} */
+MAGNUM_DEBUGTOOLS_EXPORT Debug& operator<<(Debug& debug, CompareImageFlag value);
+
+/**
+@brief Image comparison flags
+
+@see @ref CompareImage
+*/
+typedef Containers::EnumSet<CompareImageFlag> CompareImageFlags;
+
+CORRADE_ENUMSET_OPERATORS(CompareImageFlags)
+
+/** @debugoperatorenum{CompareImageFlags} */
+MAGNUM_DEBUGTOOLS_EXPORT Debug& operator<<(Debug& debug, CompareImageFlags value);
+
 class CompareImage;
 
 }}
@@ -58,7 +95,7 @@ namespace Corrade { namespace TestSuite {
 
 template<> class MAGNUM_DEBUGTOOLS_EXPORT Comparator<Magnum::DebugTools::CompareImage> {
     public:
-        explicit Comparator(Magnum::Float maxThreshold, Magnum::Float meanThreshold);
+        explicit Comparator(Magnum::Float maxThreshold, Magnum::Float meanThreshold, Magnum::DebugTools::CompareImageFlags flags = {}, Magnum::UnsignedInt threadCount = 1);
 
         /*implicit*/ Comparator(): Comparator{0.0f, 0.0f} {}
 
@@ -72,10 +109,13 @@ template<> class MAGNUM_DEBUGTOOLS_EXPORT Comparator<Magnum::DebugTools::Compare
             DifferentFormat,
             AboveThresholds,
             AboveMeanThreshold,
-            AboveMaxThreshold
+            AboveMaxThreshold,
+            AboveMaxThresholdEarlyOut
         };
 
         Magnum::Float _maxThreshold, _meanThreshold;
+        Magnum::DebugTools::CompareImageFlags _flags;
+        Magnum::UnsignedInt _threadCount;
 
         State _state{};
         const Magnum::ImageView2D *_actualImage, *_expectedImage;
@@ -130,7 +170,7 @@ is channel count), with max and mean delta being taken over the whole picture. @
 
 @f]
 
-The two parameters passed to the @ref CompareImage(Float, Float) "CompareImage(Float, Float)"
+The first two parameters passed to the @ref CompareImage(Float, Float, CompareImageFlags, UnsignedInt) "CompareImage()"
 constructor are max and mean delta threshold. If the calculated values are
 above these threshold, the comparison fails. In case of comparison failure the
 diagnostic output contains calculated max/meanvalues, delta image visualization
@@ -140,6 +180,27 @@ printed as characters of different perceived brightness. Blocks with delta over
 the max threshold are colored red, blocks with delta over the mean threshold
 are colored yellow. The delta list contains X,Y pixel position (with origin at
 bottom left), actual and expected pixel value and calculated delta.
+
+@section DebugTools-CompareImage-performance Performance
+
+The deltas are calculated on whole rows at a time, which the compiler can
+vectorize, and the rows can be distributed among multiple threads by passing
+a thread count to the @ref CompareImage(Float, Float, CompareImageFlags, UnsignedInt)
+constructor. The result doesn't depend on the thread count. Multithreaded
+comparison is not available on @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten",
+where the thread count is ignored.
+
+If the comparison passes, only max and mean delta is calculated, without
+keeping the delta image in memory --- the delta image is recalculated only for
+the diagnostic output on failure. If only the pass/fail result matters, pass
+@ref CompareImageFlag::MaxThresholdEarlyOut to the constructor to stop the
+comparison already at the first pixel above the max threshold:
+
+@code{.cpp}
+CORRADE_COMPARE_WITH(actual, expected, (DebugTools::CompareImage{
+    1.5f, 0.01f, DebugTools::CompareImageFlag::MaxThresholdEarlyOut,
+    std::thread::hardware_concurrency()}));
+@endcode
 */
 class CompareImage {
     public:
@@ -149,8 +210,12 @@ class CompareImage {
          *      this value, this comparison fails
          * @param meanThreshold Mean threshold. If mean delta over all pixels
          *      is above this value, the comparison fails
+         * @param flags         Flags
+         * @param threadCount   Thread count used for the comparison,
+         *      including the calling thread. Value of @cpp 0 @ce is treated
+         *      the same as @cpp 1 @ce.
          */
-        explicit CompareImage(Float maxThreshold, Float meanThreshold): _c{maxThreshold, meanThreshold} {}
+        explicit CompareImage(Float maxThreshold, Float meanThreshold, CompareImageFlags flags = {}, UnsignedInt threadCount = 1): _c{maxThreshold, meanThreshold, flags, threadCount} {}
 
         /**
          * @brief Implicit constructor
@@ -0,0 +1,104 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CompareTexture.h"
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/DebugTools/TextureDelta.h"
+#include "Magnum/DebugTools/TextureImage.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Range.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+namespace Corrade { namespace TestSuite {
+
+using namespace Magnum;
+
+namespace {
+
+GL::TextureFormat textureFormatFor(const PixelFormat format) {
+    switch(format) {
+        #define _c(format) case PixelFormat::format ## Unorm: return GL::TextureFormat::format;
+        _c(R8)
+        _c(RG8)
+        _c(RGB8)
+        _c(RGBA8)
+        #undef _c
+        #define _c(format) case PixelFormat::format: return GL::TextureFormat::format;
+        _c(R32F)
+        _c(RG32F)
+        _c(RGB32F)
+        _c(RGBA32F)
+        #undef _c
+        default: break;
+    }
+
+    CORRADE_ASSERT(false,
+        "DebugTools::CompareTexture: unsupported format" << format, {});
+    return {}; /* LCOV_EXCL_LINE */
+}
+
+}
+
+Comparator<DebugTools::CompareTexture>::Comparator(Float maxThreshold, Float meanThreshold): _maxThreshold{maxThreshold}, _meanThreshold{meanThreshold}, _imageComparator{maxThreshold, meanThreshold}, _actualImage{PixelFormat::RGBA8Unorm} {}
+
+bool Comparator<DebugTools::CompareTexture>::operator()(const GL::Texture2D& actual, const ImageView2D& expected) {
+    /* The texture is only read from, but all GL operations are non-const */
+    GL::Texture2D& texture = const_cast<GL::Texture2D&>(actual);
+
+    /* If the size doesn't match, let the image comparator print the
+       diagnostic */
+    #ifndef MAGNUM_TARGET_GLES
+    const Vector2i size = texture.imageSize(0);
+    if(size == expected.size())
+    #else
+    const Vector2i size = expected.size();
+    #endif
+    {
+        GL::Texture2D expectedTexture;
+        expectedTexture.setMinificationFilter(GL::SamplerFilter::Nearest)
+            .setMagnificationFilter(GL::SamplerFilter::Nearest)
+            .setStorage(1, textureFormatFor(expected.format()), expected.size())
+            .setSubImage(0, {}, expected);
+
+        Float max, mean;
+        std::tie(max, mean) = DebugTools::textureDelta(texture, expectedTexture, expected.size(), expected.format());
+        if(max <= _maxThreshold && mean <= _meanThreshold) return true;
+    }
+
+    /* Otherwise read the texture back and compare on the CPU to get an
+       accurate diagnostic */
+    _actualImage = DebugTools::textureSubImage(texture, 0, {{}, size}, Image2D{expected.format()});
+    return _imageComparator(_actualImage, expected);
+}
+
+void Comparator<DebugTools::CompareTexture>::printErrorMessage(Debug& out, const std::string& actual, const std::string& expected) const {
+    _imageComparator.printErrorMessage(out, actual, expected);
+}
+
+}}
+#endif
@@ -0,0 +1,148 @@
+#ifndef Magnum_DebugTools_CompareTexture_h
+#define Magnum_DebugTools_CompareTexture_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+/** @file
+ * @brief Class @ref Magnum::DebugTools::CompareTexture
+ */
+#endif
+
+#include "Magnum/Image.h"
+#include "Magnum/DebugTools/CompareImage.h"
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+namespace Magnum { namespace DebugTools {
+
+class CompareTexture;
+
+}}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/* If Doxygen sees this, all @ref Corrade::TestSuite links break (prolly
+   because the namespace is undocumented in this project) */
+namespace Corrade { namespace TestSuite {
+
+template<> class MAGNUM_DEBUGTOOLS_EXPORT Comparator<Magnum::DebugTools::CompareTexture> {
+    public:
+        explicit Comparator(Magnum::Float maxThreshold, Magnum::Float meanThreshold);
+
+        /*implicit*/ Comparator(): Comparator{0.0f, 0.0f} {}
+
+        bool operator()(const Magnum::GL::Texture2D& actual, const Magnum::ImageView2D& expected);
+
+        void printErrorMessage(Utility::Debug& out, const std::string& actual, const std::string& expected) const;
+
+    private:
+        Magnum::Float _maxThreshold, _meanThreshold;
+
+        /* Used for the diagnostic in case the GPU comparison fails */
+        Comparator<Magnum::DebugTools::CompareImage> _imageComparator;
+        Magnum::Image2D _actualImage;
+};
+
+}}
+#endif
+
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Texture comparator
+
+Similar to @ref CompareImage, but compares contents of a @ref GL::Texture2D
+to an expected image on the GPU, without having to read the texture back
+first. To be used with @ref Corrade::TestSuite, for example in a test derived
+from @ref GL::OpenGLTester:
+
+@code{.cpp}
+GL::Texture2D color;
+color.setStorage(1, GL::TextureFormat::RGBA8, {128, 128});
+GL::Framebuffer framebuffer{{{}, {128, 128}}};
+framebuffer.attachTexture(GL::Framebuffer::ColorAttachment{0}, color, 0);
+
+// render something ...
+
+CORRADE_COMPARE_WITH(color, expected, (DebugTools::CompareTexture{1.5f, 0.01f}));
+@endcode
+
+The expected image is uploaded to a temporary texture and both are compared
+using @ref textureDelta(), with the same meaning of the max and mean threshold
+as in @ref CompareImage. Only the max and mean values are read back, so a
+passing comparison doesn't need any synchronous texture readback. If the
+comparison fails, the texture is read back using @ref textureSubImage() and
+compared again on the CPU using @ref CompareImage, so the diagnostic output is
+the same, including the delta image visualization.
+
+The comparison is done on mip level @cpp 0 @ce of the texture. The format of
+the expected image is used for both, with the same restrictions as in
+@ref textureDelta(). On desktop OpenGL, the texture size is checked against
+the expected image size first, on OpenGL ES the texture is expected to have
+at least the size of the expected image.
+
+@requires_gl30 Extension @gl_extension{ARB,framebuffer_object} and
+    @gl_extension{ARB,texture_rg}
+@requires_gles30 Not available in OpenGL ES 2.0 or WebGL 1.0.
+@requires_es_extension Extension @gl_extension{EXT,color_buffer_float}
+@requires_webgl_extension Extension @webgl_extension{EXT,color_buffer_float}
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" enabled (done by default). See
+    @ref building-features for more information.
+*/
+class CompareTexture {
+    public:
+        /**
+         * @brief Constructor
+         * @param maxThreshold  Max threshold. If any pixel has delta above
+         *      this value, this comparison fails
+         * @param meanThreshold Mean threshold. If mean delta over all pixels
+         *      is above this value, the comparison fails
+         */
+        explicit CompareTexture(Float maxThreshold, Float meanThreshold): _c{maxThreshold, meanThreshold} {}
+
+        /**
+         * @brief Implicit constructor
+         *
+         * Equivalent to calling the above with zero values.
+         */
+        explicit CompareTexture(): CompareTexture{0.0f, 0.0f} {}
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        TestSuite::Comparator<CompareTexture>& comparator() {
+            return _c;
+        }
+        #endif
+
+    private:
+        TestSuite::Comparator<CompareTexture> _c;
+};
+
+}}
+#else
+#error this header is available only in the OpenGL build and not available in the OpenGL ES 2.0 and WebGL 1.0 build
+#endif
+
+#endif
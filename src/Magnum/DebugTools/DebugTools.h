@@ -37,15 +37,32 @@ namespace Magnum { namespace DebugTools {
 class Profiler;
 
 #ifdef MAGNUM_TARGET_GL
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class DeferredReadback;
+class FrameCapture;
+#endif
+
 template<UnsignedInt> class ForceRenderer;
 typedef ForceRenderer<2> ForceRenderer2D;
 typedef ForceRenderer<3> ForceRenderer3D;
 class ForceRendererOptions;
+template<UnsignedInt> class ForceRendererBatch;
+typedef ForceRendererBatch<2> ForceRendererBatch2D;
+typedef ForceRendererBatch<3> ForceRendererBatch3D;
+template<UnsignedInt> class BatchedForceRenderer;
+typedef BatchedForceRenderer<2> BatchedForceRenderer2D;
+typedef BatchedForceRenderer<3> BatchedForceRenderer3D;
 
 template<UnsignedInt> class ObjectRenderer;
 typedef ObjectRenderer<2> ObjectRenderer2D;
 typedef ObjectRenderer<3> ObjectRenderer3D;
 class ObjectRendererOptions;
+template<UnsignedInt> class ObjectRendererBatch;
+typedef ObjectRendererBatch<2> ObjectRendererBatch2D;
+typedef ObjectRendererBatch<3> ObjectRendererBatch3D;
+template<UnsignedInt> class BatchedObjectRenderer;
+typedef BatchedObjectRenderer<2> BatchedObjectRenderer2D;
+typedef BatchedObjectRenderer<3> BatchedObjectRenderer3D;
 
 class ResourceManager;
 
@@ -0,0 +1,132 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DeferredReadback.h"
+
+#include "Magnum/PixelStorage.h"
+#include "Magnum/DebugTools/BufferData.h"
+#include "Magnum/DebugTools/TextureImage.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace DebugTools {
+
+DeferredReadback::DeferredReadback(const UnsignedInt frameCount): _first{}, _pending{} {
+    CORRADE_ASSERT(frameCount,
+        "DebugTools::DeferredReadback: expected non-zero frame count", );
+    _slots.resize(frameCount);
+}
+
+DeferredReadback::DeferredReadback(NoCreateT) noexcept: _first{}, _pending{} {}
+
+DeferredReadback::DeferredReadback(DeferredReadback&& other) noexcept: _first{other._first}, _pending{other._pending}, _slots{std::move(other._slots)} {
+    other._first = other._pending = 0;
+    other._slots.clear();
+}
+
+DeferredReadback::~DeferredReadback() = default;
+
+DeferredReadback& DeferredReadback::operator=(DeferredReadback&& other) noexcept {
+    using std::swap;
+    swap(_first, other._first);
+    swap(_pending, other._pending);
+    swap(_slots, other._slots);
+    return *this;
+}
+
+DeferredReadback::Slot* DeferredReadback::reserve() {
+    if(_pending == _slots.size()) return nullptr;
+
+    Slot& slot = _slots[(_first + _pending) % _slots.size()];
+    ++_pending;
+    return &slot;
+}
+
+bool DeferredReadback::read(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(size,
+        "DebugTools::DeferredReadback::read(): expected non-zero size", false);
+
+    Slot* const slot = reserve();
+    if(!slot) return false;
+
+    /* Grow the staging buffer only if needed */
+    if(!slot->buffer.id()) {
+        slot->buffer = GL::Buffer{GL::Buffer::TargetHint::CopyWrite};
+        slot->capacity = 0;
+    }
+    if(slot->capacity < std::size_t(size)) {
+        slot->buffer.setData({nullptr, std::size_t(size)}, GL::BufferUsage::StreamRead);
+        slot->capacity = size;
+    }
+
+    GL::Buffer::copy(buffer, slot->buffer, offset, 0, size);
+    slot->size = size;
+    slot->isImage = false;
+    slot->fence.insert();
+    return true;
+}
+
+bool DeferredReadback::read(GL::Buffer& buffer) {
+    return read(buffer, 0, buffer.size());
+}
+
+bool DeferredReadback::read(GL::Texture2D& texture, const Int level, const Range2Di& range, const GL::PixelFormat format, const GL::PixelType type) {
+    Slot* const slot = reserve();
+    if(!slot) return false;
+
+    /* The image buffer gets reallocated only if it's too small for the
+       range, recreate it only if the format changes */
+    if(!slot->image.buffer().id() || slot->image.format() != format || slot->image.type() != type)
+        slot->image = GL::BufferImage2D{format, type};
+
+    textureSubImage(texture, level, range, slot->image, GL::BufferUsage::StreamRead);
+    slot->size = Magnum::Implementation::imageDataSize(slot->image);
+    slot->isImage = true;
+    slot->fence.insert();
+    return true;
+}
+
+bool DeferredReadback::read(GL::Texture2D& texture, const Int level, const Range2Di& range, const Magnum::PixelFormat format) {
+    return read(texture, level, range, GL::pixelFormat(format), GL::pixelType(format));
+}
+
+bool DeferredReadback::isReady() const {
+    return _pending && _slots[_first].fence.isSignaled();
+}
+
+Containers::Optional<Containers::Array<char>> DeferredReadback::data() {
+    if(!isReady()) return Containers::NullOpt;
+
+    /* The copy is finished, so mapping the buffer doesn't stall */
+    Slot& slot = _slots[_first];
+    Containers::Array<char> out = bufferSubData<char>(slot.isImage ? slot.image.buffer() : slot.buffer, 0, slot.size);
+
+    slot.fence = GL::Fence{NoCreate};
+    _first = (_first + 1) % _slots.size();
+    --_pending;
+    return Containers::Optional<Containers::Array<char>>{std::move(out)};
+}
+
+}}
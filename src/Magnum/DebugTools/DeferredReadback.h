@@ -0,0 +1,221 @@
+#ifndef Magnum_DebugTools_DeferredReadback_h
+#define Magnum_DebugTools_DeferredReadback_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::DebugTools::DeferredReadback
+ */
+#endif
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/DebugTools/visibility.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/BufferImage.h"
+#include "Magnum/GL/Fence.h"
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Deferred buffer and texture readback
+
+Unlike @ref bufferSubData() and @ref textureSubImage() to client memory, which
+wait for the GPU to finish all work before the data can be read, this class
+only queues a GPU-side copy of the data into a staging buffer and places a
+fence after it. The data are then retrieved using @ref data() once the fence
+signals, usually a few frames later, without stalling the pipeline.
+
+@section DebugTools-DeferredReadback-usage Usage
+
+@code{.cpp}
+DebugTools::DeferredReadback readback;
+
+// each frame
+readback.read(particleBuffer);
+
+// ...
+
+while(Containers::Optional<Containers::Array<char>> data = readback.data())
+    inspect(Containers::arrayCast<const Vector4>(*data));
+@endcode
+
+The readbacks are retrieved in the same order as they were queued. There's a
+ring of @ref frameCount() staging buffers and if all of them are still
+waiting to be retrieved, @ref read() returns @cpp false @ce and nothing is
+queued. The staging buffers are reused and grow only if a larger read is
+queued into them, so once the sizes settle there are no allocations.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" enabled (done by default). See
+    @ref building-features for more information.
+
+@requires_gl32 Extension @gl_extension{ARB,sync}
+@requires_gl31 Extension @gl_extension{ARB,copy_buffer}
+@requires_gles30 Sync objects are not available in OpenGL ES 2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT DeferredReadback {
+    public:
+        /**
+         * @brief Constructor
+         * @param frameCount    Count of staging buffers in the ring
+         *
+         * Expects that @p frameCount is non-zero. The staging buffers are
+         * created lazily on first use.
+         * @see @ref DeferredReadback(NoCreateT)
+         */
+        explicit DeferredReadback(UnsignedInt frameCount = 3);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL objects
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit DeferredReadback(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        DeferredReadback(const DeferredReadback&) = delete;
+
+        /** @brief Move constructor */
+        DeferredReadback(DeferredReadback&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Readbacks that weren't retrieved are discarded.
+         */
+        ~DeferredReadback();
+
+        /** @brief Copying is not allowed */
+        DeferredReadback& operator=(const DeferredReadback&) = delete;
+
+        /** @brief Move assignment */
+        DeferredReadback& operator=(DeferredReadback&&) noexcept;
+
+        /** @brief Count of staging buffers in the ring */
+        UnsignedInt frameCount() const { return UnsignedInt(_slots.size()); }
+
+        /** @brief Count of readbacks that weren't retrieved yet */
+        UnsignedInt pendingCount() const { return _pending; }
+
+        /**
+         * @brief Queue a buffer subdata readback
+         * @param buffer    Buffer to read from
+         * @param offset    Offset in the buffer
+         * @param size      Data size in bytes
+         * @return @cpp false @ce if all staging buffers are pending,
+         *      @cpp true @ce otherwise
+         *
+         * Expects that @p size is non-zero. Copies the data to a staging
+         * buffer using @ref GL::Buffer::copy() and places a fence after it.
+         * The @p buffer is not referenced after this call.
+         */
+        bool read(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Queue a whole buffer readback
+         *
+         * Equivalent to calling @ref read(GL::Buffer&, GLintptr, GLsizeiptr)
+         * with the whole size of @p buffer.
+         */
+        bool read(GL::Buffer& buffer);
+
+        /**
+         * @brief Queue a texture subimage readback
+         * @param texture   Texture to read from
+         * @param level     Mip level
+         * @param range     Range to read
+         * @param format    Format of the pixel data
+         * @param type      Data type of the pixel data
+         * @return @cpp false @ce if all staging buffers are pending,
+         *      @cpp true @ce otherwise
+         *
+         * Reads the data to a staging buffer using
+         * @ref textureSubImage(GL::Texture2D&, Int, const Range2Di&, GL::BufferImage2D&, GL::BufferUsage)
+         * and places a fence after it. The data returned by @ref data() are
+         * laid out with default @ref PixelStorage, i.e. with rows aligned to
+         * four bytes.
+         */
+        bool read(GL::Texture2D& texture, Int level, const Range2Di& range, GL::PixelFormat format, GL::PixelType type);
+
+        /**
+         * @brief Queue a texture subimage readback
+         *
+         * Equivalent to calling @ref read(GL::Texture2D&, Int, const Range2Di&, GL::PixelFormat, GL::PixelType)
+         * with a GL-specific format and type corresponding to given generic
+         * @p format.
+         * @see @ref GL::pixelFormat(), @ref GL::pixelType()
+         */
+        bool read(GL::Texture2D& texture, Int level, const Range2Di& range, Magnum::PixelFormat format);
+
+        /**
+         * @brief Whether the oldest pending readback is finished
+         *
+         * Doesn't block. Returns @cpp false @ce also if there's no pending
+         * readback. Note that the fence signals only after the commands are
+         * flushed, which usually happens on buffer swap at the latest.
+         * @see @ref GL::Fence::isSignaled()
+         */
+        bool isReady() const;
+
+        /**
+         * @brief Retrieve the oldest finished readback
+         *
+         * If @ref isReady() is @cpp true @ce, maps the staging buffer,
+         * copies the data out and frees the staging buffer for another
+         * @ref read(). Otherwise returns @ref Containers::NullOpt without
+         * blocking.
+         */
+        Containers::Optional<Containers::Array<char>> data();
+
+    private:
+        struct Slot {
+            GL::Buffer buffer{NoCreate};
+            GL::BufferImage2D image{NoCreate};
+            GL::Fence fence{NoCreate};
+            std::size_t capacity{}, size{};
+            bool isImage{};
+        };
+
+        Slot* reserve();
+
+        UnsignedInt _first, _pending;
+        std::vector<Slot> _slots;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
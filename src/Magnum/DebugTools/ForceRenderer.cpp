@@ -41,6 +41,10 @@ template<UnsignedInt dimensions> ResourceKey shaderKey();
 template<> inline ResourceKey shaderKey<2>() { return ResourceKey("FlatShader2D"); }
 template<> inline ResourceKey shaderKey<3>() { return ResourceKey("FlatShader3D"); }
 
+template<UnsignedInt dimensions> ResourceKey instancedShaderKey();
+template<> inline ResourceKey instancedShaderKey<2>() { return ResourceKey("FlatShader2DInstanced"); }
+template<> inline ResourceKey instancedShaderKey<3>() { return ResourceKey("FlatShader3DInstanced"); }
+
 constexpr std::array<Vector2, 4> positions{{
     {0.0f,  0.0f},
     {1.0f,  0.0f},
@@ -54,6 +58,20 @@ constexpr std::array<UnsignedByte, 6> indices{{
     1, 3
 }};
 
+/* Creates the vertex and index buffers shared by ForceRenderer and
+   ForceRendererBatch if they are not in the manager yet */
+void createBuffers(Resource<GL::Buffer>& vertexBuffer, Resource<GL::Buffer>& indexBuffer) {
+    if(vertexBuffer && indexBuffer) return;
+
+    GL::Buffer* vertices = new GL::Buffer{GL::Buffer::TargetHint::Array};
+    vertices->setData(positions, GL::BufferUsage::StaticDraw);
+    ResourceManager::instance().set(vertexBuffer.key(), vertices, ResourceDataState::Final, ResourcePolicy::Manual);
+
+    GL::Buffer* indexData = new GL::Buffer{GL::Buffer::TargetHint::ElementArray};
+    indexData->setData(indices, GL::BufferUsage::StaticDraw);
+    ResourceManager::instance().set(indexBuffer.key(), indexData, ResourceDataState::Final, ResourcePolicy::Manual);
+}
+
 }
 
 template<UnsignedInt dimensions> ForceRenderer<dimensions>::ForceRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, const VectorTypeFor<dimensions, Float>& forcePosition, const VectorTypeFor<dimensions, Float>& force, ResourceKey options, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(object, drawables), _forcePosition(forcePosition), _force(force), _options(ResourceManager::instance().get<ForceRendererOptions>(options)) {
@@ -68,21 +86,14 @@ template<UnsignedInt dimensions> ForceRenderer<dimensions>::ForceRenderer(SceneG
     if(_mesh) return;
 
     /* Create the mesh */
-    GL::Buffer* vertexBuffer = new GL::Buffer{GL::Buffer::TargetHint::Array};
-    GL::Buffer* indexBuffer = new GL::Buffer{GL::Buffer::TargetHint::ElementArray};
-
-    _vertexBuffer->setData(positions, GL::BufferUsage::StaticDraw);
-    ResourceManager::instance().set(_vertexBuffer.key(), vertexBuffer, ResourceDataState::Final, ResourcePolicy::Manual);
-
-    _indexBuffer->setData(indices, GL::BufferUsage::StaticDraw);
-    ResourceManager::instance().set(_indexBuffer.key(), indexBuffer, ResourceDataState::Final, ResourcePolicy::Manual);
+    createBuffers(_vertexBuffer, _indexBuffer);
 
     GL::Mesh* mesh = new GL::Mesh;
     mesh->setPrimitive(GL::MeshPrimitive::Lines)
         .setCount(indices.size())
-        .addVertexBuffer(*vertexBuffer, 0,
+        .addVertexBuffer(*_vertexBuffer, 0,
             typename Shaders::Flat<dimensions>::Position(Shaders::Flat<dimensions>::Position::Components::Two))
-        .setIndexBuffer(*indexBuffer, 0, GL::MeshIndexType::UnsignedByte, 0, positions.size());
+        .setIndexBuffer(*_indexBuffer, 0, GL::MeshIndexType::UnsignedByte, 0, positions.size());
     ResourceManager::instance().set(_mesh.key(), mesh, ResourceDataState::Final, ResourcePolicy::Manual);
 }
 
@@ -95,7 +106,55 @@ template<UnsignedInt dimensions> void ForceRenderer<dimensions>::draw(const Matr
     _mesh->draw(*_shader);
 }
 
+template<UnsignedInt dimensions> ForceRendererBatch<dimensions>::ForceRendererBatch(ResourceKey options): _options{ResourceManager::instance().get<ForceRendererOptions>(options)}, _instanceBuffer{GL::Buffer::TargetHint::Array} {
+    /* Shader */
+    _shader = ResourceManager::instance().get<GL::AbstractShaderProgram, Shaders::Flat<dimensions>>(instancedShaderKey<dimensions>());
+    if(!_shader) ResourceManager::instance().set<GL::AbstractShaderProgram>(_shader.key(), new Shaders::Flat<dimensions>{Shaders::Flat<dimensions>::Flag::InstancedTransformation});
+
+    /* Vertex and index buffers are shared with ForceRenderer, the mesh is not
+       as each batch has its own instance buffer */
+    _vertexBuffer = ResourceManager::instance().get<GL::Buffer>("force-vertices");
+    _indexBuffer = ResourceManager::instance().get<GL::Buffer>("force-indices");
+    createBuffers(_vertexBuffer, _indexBuffer);
+
+    _mesh.setPrimitive(GL::MeshPrimitive::Lines)
+        .setCount(indices.size())
+        .addVertexBuffer(*_vertexBuffer, 0,
+            typename Shaders::Flat<dimensions>::Position(Shaders::Flat<dimensions>::Position::Components::Two))
+        .addVertexBufferInstanced(_instanceBuffer, 1, 0,
+            typename Shaders::Flat<dimensions>::TransformationMatrix{})
+        .setIndexBuffer(*_indexBuffer, 0, GL::MeshIndexType::UnsignedByte, 0, positions.size());
+}
+
+/* To avoid deleting pointers to incomplete type on destruction of Resource members */
+template<UnsignedInt dimensions> ForceRendererBatch<dimensions>::~ForceRendererBatch() = default;
+
+template<UnsignedInt dimensions> void ForceRendererBatch<dimensions>::add(const MatrixTypeFor<dimensions, Float>& transformationMatrix, const VectorTypeFor<dimensions, Float>& forcePosition, const VectorTypeFor<dimensions, Float>& force) {
+    _instances.push_back(Implementation::forceRendererTransformation<dimensions>(transformationMatrix.transformPoint(forcePosition), force)*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->scale()}));
+}
+
+template<UnsignedInt dimensions> void ForceRendererBatch<dimensions>::draw(SceneGraph::Camera<dimensions, Float>& camera) {
+    if(_instances.empty()) return;
+
+    _instanceBuffer.setData(_instances, GL::BufferUsage::StreamDraw);
+    _mesh.setInstanceCount(Int(_instances.size()));
+    _shader->setTransformationProjectionMatrix(camera.projectionMatrix())
+        .setColor(_options->color());
+    _mesh.draw(*_shader);
+    _instances.clear();
+}
+
+template<UnsignedInt dimensions> BatchedForceRenderer<dimensions>::BatchedForceRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, const VectorTypeFor<dimensions, Float>& forcePosition, const VectorTypeFor<dimensions, Float>& force, ForceRendererBatch<dimensions>& batch, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(object, drawables), _forcePosition(forcePosition), _force(force), _batch(batch) {}
+
+template<UnsignedInt dimensions> void BatchedForceRenderer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>&) {
+    _batch.add(transformationMatrix, _forcePosition, _force);
+}
+
 template class ForceRenderer<2>;
 template class ForceRenderer<3>;
+template class ForceRendererBatch<2>;
+template class ForceRendererBatch<3>;
+template class BatchedForceRenderer<2>;
+template class BatchedForceRenderer<3>;
 
 }}
@@ -27,12 +27,16 @@
 
 #ifdef MAGNUM_TARGET_GL
 /** @file
- * @brief Class @ref Magnum::DebugTools::ForceRenderer, @ref Magnum::DebugTools::ForceRendererOptions, typedef @ref Magnum::DebugTools::ForceRenderer2D, @ref Magnum::DebugTools::ForceRenderer3D
+ * @brief Class @ref Magnum::DebugTools::ForceRenderer, @ref Magnum::DebugTools::ForceRendererOptions, @ref Magnum::DebugTools::ForceRendererBatch, @ref Magnum::DebugTools::BatchedForceRenderer, typedef @ref Magnum::DebugTools::ForceRenderer2D, @ref Magnum::DebugTools::ForceRenderer3D, @ref Magnum::DebugTools::ForceRendererBatch2D, @ref Magnum::DebugTools::ForceRendererBatch3D, @ref Magnum::DebugTools::BatchedForceRenderer2D, @ref Magnum::DebugTools::BatchedForceRenderer3D
  */
 #endif
 
+#include <vector>
+
 #include "Magnum/Resource.h"
+#include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/GL.h"
+#include "Magnum/GL/Mesh.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/SceneGraph/Drawable.h"
 #include "Magnum/Shaders/Shaders.h"
@@ -112,7 +116,8 @@ new DebugTools::ForceRenderer2D(object, {0.3f, 1.5f, -0.7f}, &force, "my", debug
     @ref MAGNUM_TARGET_GL "TARGET_GL" and `WITH_SCENEGRAPH` enabled (done by
     default). See @ref building-features for more information.
 
-@see @ref ForceRenderer2D, @ref ForceRenderer3D, @ref ForceRendererOptions
+@see @ref ForceRenderer2D, @ref ForceRenderer3D, @ref ForceRendererOptions,
+    @ref BatchedForceRenderer
 */
 template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ForceRenderer: public SceneGraph::Drawable<dimensions, Float> {
     public:
@@ -158,6 +163,155 @@ typedef ForceRenderer<2> ForceRenderer2D;
 /** @brief Three-dimensional force renderer */
 typedef ForceRenderer<3> ForceRenderer3D;
 
+/**
+@brief Force renderer batch
+
+Collects arrows of all @ref BatchedForceRenderer instances drawn in a frame
+and renders them with a single instanced draw call using
+@ref Shaders::Flat with @ref Shaders::Flat::Flag::InstancedTransformation
+enabled. Unlike @ref ForceRenderer, where each force is a separate draw call,
+the cost of visualizing forces of a whole physics scene is then mostly just
+the upload of the per-instance transformations. The arrow vertex and index
+buffers are shared with @ref ForceRenderer through
+@ref DebugTools::ResourceManager.
+
+@section DebugTools-ForceRendererBatch-usage Basic usage
+
+Draw the renderer group first, which adds the instances to the batch, and then
+draw the batch itself:
+
+@code{.cpp}
+DebugTools::ForceRendererBatch3D batch{"my"};
+
+// Create batched debug renderers for given forces, use "my" options for all
+for(std::size_t i = 0; i != bodies.size(); ++i)
+    new DebugTools::BatchedForceRenderer3D{*bodies[i], {}, forces[i], batch, &debugDrawables};
+
+// Each frame
+camera.draw(debugDrawables);
+batch.draw(camera);
+@endcode
+
+@requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+@requires_gles30 Extension @gl_extension{ANGLE,instanced_arrays},
+    @gl_extension{EXT,instanced_arrays} or
+    @gl_extension{NV,instanced_arrays} in OpenGL ES 2.0.
+@requires_webgl20 Extension @webgl_extension{ANGLE,instanced_arrays} in WebGL
+    1.0.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" and `WITH_SCENEGRAPH` enabled (done by
+    default). See @ref building-features for more information.
+
+@see @ref ForceRendererBatch2D, @ref ForceRendererBatch3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ForceRendererBatch {
+    public:
+        /**
+         * @brief Constructor
+         * @param options   Options resource key, shared by all instances in
+         *      the batch. See @ref DebugTools-ForceRenderer-usage "ForceRenderer documentation"
+         *      for more information.
+         */
+        explicit ForceRendererBatch(ResourceKey options = ResourceKey());
+
+        /** @brief Copying is not allowed */
+        ForceRendererBatch(const ForceRendererBatch<dimensions>&) = delete;
+
+        ~ForceRendererBatch();
+
+        /** @brief Copying is not allowed */
+        ForceRendererBatch<dimensions>& operator=(const ForceRendererBatch<dimensions>&) = delete;
+
+        /** @brief Count of instances added since last @ref draw() */
+        std::size_t size() const { return _instances.size(); }
+
+        /**
+         * @brief Add an instance
+         * @param transformationMatrix  Object transformation relative to
+         *      camera
+         * @param forcePosition Where to render the force, relative to object
+         * @param force         Force vector
+         *
+         * Called from @ref BatchedForceRenderer, but can be used also
+         * directly.
+         */
+        void add(const MatrixTypeFor<dimensions, Float>& transformationMatrix, const VectorTypeFor<dimensions, Float>& forcePosition, const VectorTypeFor<dimensions, Float>& force);
+
+        /**
+         * @brief Draw all instances
+         *
+         * Uploads the instances added since last call and renders them with a
+         * single draw call, then clears the list. Does nothing if there are
+         * no instances.
+         */
+        void draw(SceneGraph::Camera<dimensions, Float>& camera);
+
+    private:
+        Resource<ForceRendererOptions> _options;
+        Resource<GL::AbstractShaderProgram, Shaders::Flat<dimensions>> _shader;
+        Resource<GL::Buffer> _vertexBuffer, _indexBuffer;
+        GL::Buffer _instanceBuffer;
+        GL::Mesh _mesh;
+        std::vector<MatrixTypeFor<dimensions, Float>> _instances;
+};
+
+/** @brief Two-dimensional force renderer batch */
+typedef ForceRendererBatch<2> ForceRendererBatch2D;
+
+/** @brief Three-dimensional force renderer batch */
+typedef ForceRendererBatch<3> ForceRendererBatch3D;
+
+/**
+@brief Batched force renderer
+
+Equivalent to @ref ForceRenderer, but instead of drawing the arrow itself it
+adds it to a @ref ForceRendererBatch. See
+@ref DebugTools-ForceRendererBatch-usage "its documentation" for more
+information.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" and `WITH_SCENEGRAPH` enabled (done by
+    default). See @ref building-features for more information.
+
+@see @ref BatchedForceRenderer2D, @ref BatchedForceRenderer3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT BatchedForceRenderer: public SceneGraph::Drawable<dimensions, Float> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object        Object for which to create debug renderer
+         * @param forcePosition Where to render the force, relative to object
+         * @param force         Force vector
+         * @param batch         Batch to add the instance to
+         * @param drawables     Drawable group
+         *
+         * The renderer is automatically added to object's features, @p force
+         * and @p batch are saved as references and thus they must be
+         * available for the whole lifetime of the renderer.
+         */
+        explicit BatchedForceRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, const VectorTypeFor<dimensions, Float>& forcePosition, const VectorTypeFor<dimensions, Float>& force, ForceRendererBatch<dimensions>& batch, SceneGraph::DrawableGroup<dimensions, Float>* drawables = nullptr);
+
+        /**
+         * You have to pass reference to existing force instance, as the
+         * renderer uses the current value when rendering.
+         */
+        BatchedForceRenderer(SceneGraph::AbstractObject<dimensions, Float>&, const VectorTypeFor<dimensions, Float>&, VectorTypeFor<dimensions, Float>&&, ForceRendererBatch<dimensions>&, SceneGraph::DrawableGroup<dimensions, Float>* = nullptr) = delete;
+
+    private:
+        void draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) override;
+
+        const VectorTypeFor<dimensions, Float> _forcePosition;
+        const VectorTypeFor<dimensions, Float>& _force;
+        ForceRendererBatch<dimensions>& _batch;
+};
+
+/** @brief Two-dimensional batched force renderer */
+typedef BatchedForceRenderer<2> BatchedForceRenderer2D;
+
+/** @brief Three-dimensional batched force renderer */
+typedef BatchedForceRenderer<3> BatchedForceRenderer3D;
+
 }}
 #else
 #error this header is available only in the OpenGL build
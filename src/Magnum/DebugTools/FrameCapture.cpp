@@ -0,0 +1,295 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FrameCapture.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/FramebufferReader.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/GL/Version.h"
+#include "Magnum/Math/Range.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+static void importDebugToolsResources() {
+    CORRADE_RESOURCE_INITIALIZE(MagnumDebugTools_RESOURCES)
+}
+#endif
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+class FrameCaptureShader: public GL::AbstractShaderProgram {
+    public:
+        explicit FrameCaptureShader(FrameCapture::Format format, const Vector2i& size);
+
+        FrameCaptureShader& bindSourceTexture(GL::Texture2D& texture) {
+            texture.bind(SourceTextureUnit);
+            return *this;
+        }
+
+    private:
+        enum: Int { SourceTextureUnit = 0 };
+};
+
+FrameCaptureShader::FrameCaptureShader(const FrameCapture::Format format, const Vector2i& size) {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumDebugTools"))
+        importDebugToolsResources();
+    #endif
+    Utility::Resource rs{"MagnumDebugTools"};
+
+    #ifndef MAGNUM_TARGET_GLES
+    const GL::Version version = GL::Version::GL300;
+    #else
+    const GL::Version version = GL::Version::GLES300;
+    #endif
+
+    /* The vertex shader is the same full-screen triangle as used for float
+       texture readback on ES */
+    GL::Shader vert{version, GL::Shader::Type::Vertex};
+    GL::Shader frag{version, GL::Shader::Type::Fragment};
+    vert.addSource(rs.get("TextureImage.vert"));
+    frag.addSource(format == FrameCapture::Format::NV12 ? "#define NV12\n" : "")
+        .addSource(rs.get("FrameCapture.frag"));
+
+    CORRADE_INTERNAL_ASSERT(GL::Shader::compile({vert, frag}));
+    attachShaders({vert, frag});
+
+    CORRADE_INTERNAL_ASSERT(link());
+
+    setUniform(uniformLocation("frameSize"), size);
+    setUniform(uniformLocation("sourceTexture"), SourceTextureUnit);
+}
+
+}
+
+struct FrameCapture::State {
+    explicit State(const Vector2i& size, Format format, Consumer&& consumer, UnsignedInt frameCount, UnsignedInt queueSize);
+
+    void consume();
+    void retrieve();
+
+    Vector2i size;
+    Format format;
+    UnsignedInt queueSize;
+    std::size_t frameDataSize;
+
+    /* GPU side. The conversion target is RGBA8 for both formats, for NV12
+       each pixel contains four consecutive bytes of the output, which is
+       both four times less fragments to process and a pixel format that's
+       guaranteed to be readable on ES */
+    Vector2i targetSize;
+    FrameCaptureShader shader;
+    GL::Texture2D target;
+    GL::Framebuffer framebuffer;
+    GL::Mesh mesh;
+    GL::FramebufferReader reader;
+    UnsignedLong capturedCount{}, retrievedCount{};
+
+    /* Encoder thread side. Everything below is guarded by the mutex. */
+    Consumer consumer;
+    std::mutex mutex;
+    std::condition_variable frameQueued, frameConsumed;
+    std::vector<Containers::Array<char>> freeFrames;
+    std::deque<std::pair<Containers::Array<char>, UnsignedLong>> queued;
+    UnsignedLong consumedCount{};
+    bool consuming{}, quit{};
+    std::thread thread;
+};
+
+FrameCapture::State::State(const Vector2i& size, const Format format, Consumer&& consumer, const UnsignedInt frameCount, const UnsignedInt queueSize): size{size}, format{format}, queueSize{queueSize}, frameDataSize{format == Format::NV12 ? std::size_t(size.product())*3/2 : std::size_t(size.product())*4}, targetSize{format == Format::NV12 ? Vector2i{size.x()/4, size.y() + size.y()/2} : size}, shader{format, size}, framebuffer{{{}, targetSize}}, reader{frameCount}, consumer{std::move(consumer)} {
+    target.setMinificationFilter(GL::SamplerFilter::Nearest)
+        .setMagnificationFilter(GL::SamplerFilter::Nearest)
+        .setWrapping(GL::SamplerWrapping::ClampToEdge)
+        .setStorage(1, GL::TextureFormat::RGBA8, targetSize);
+    framebuffer.attachTexture(GL::Framebuffer::ColorAttachment(0), target, 0);
+
+    /* The positions are generated from gl_VertexID, so there's no buffer */
+    mesh.setPrimitive(GL::MeshPrimitive::Triangles)
+        .setCount(3);
+
+    freeFrames.reserve(queueSize);
+    for(UnsignedInt i = 0; i != queueSize; ++i)
+        freeFrames.emplace_back(Containers::NoInit, frameDataSize);
+}
+
+void FrameCapture::State::consume() {
+    std::unique_lock<std::mutex> lock{mutex};
+    for(;;) {
+        frameQueued.wait(lock, [this]{ return quit || !queued.empty(); });
+        if(queued.empty()) return;
+
+        std::pair<Containers::Array<char>, UnsignedLong> frame = std::move(queued.front());
+        queued.pop_front();
+        consuming = true;
+
+        /* Don't hold the lock while the consumer works so the rendering
+           thread can queue more frames in the meantime */
+        lock.unlock();
+        consumer(frame.first, frame.second);
+        lock.lock();
+
+        freeFrames.push_back(std::move(frame.first));
+        consuming = false;
+        ++consumedCount;
+        frameConsumed.notify_all();
+    }
+}
+
+/* Copies the oldest readback into a free queue buffer and hands it over to
+   the encoder thread. Waits for a free queue buffer if there's none and for
+   the readback to finish. */
+void FrameCapture::State::retrieve() {
+    Containers::Array<char> data;
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        frameConsumed.wait(lock, [this]{ return !freeFrames.empty(); });
+        data = std::move(freeFrames.back());
+        freeFrames.pop_back();
+    }
+
+    const ImageView2D image = reader.map();
+    CORRADE_INTERNAL_ASSERT(image.data().size() >= frameDataSize);
+    std::memcpy(data.data(), image.data().data(), frameDataSize);
+    reader.unmap();
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        queued.emplace_back(std::move(data), retrievedCount++);
+    }
+    frameQueued.notify_one();
+}
+
+FrameCapture::FrameCapture(const Vector2i& size, const Format format, Consumer consumer, const UnsignedInt frameCount, const UnsignedInt queueSize) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::framebuffer_object);
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    #endif
+
+    CORRADE_ASSERT(size.product(),
+        "DebugTools::FrameCapture: expected non-empty size but got" << size, );
+    CORRADE_ASSERT(frameCount && queueSize,
+        "DebugTools::FrameCapture: expected non-zero frame count and queue size but got" << frameCount << "and" << queueSize, );
+    CORRADE_ASSERT(format != Format::NV12 || (size.x() % 4 == 0 && size.y() % 2 == 0),
+        "DebugTools::FrameCapture: expected NV12 frame width divisible by four and height by two but got" << size, );
+
+    _state.reset(new State{size, format, std::move(consumer), frameCount, queueSize});
+    State& state = *_state;
+    state.thread = std::thread{[&state]{ state.consume(); }};
+}
+
+FrameCapture::FrameCapture(NoCreateT) noexcept {}
+
+FrameCapture::FrameCapture(FrameCapture&&) noexcept = default;
+
+FrameCapture::~FrameCapture() {
+    if(!_state) return;
+
+    flush();
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->quit = true;
+    }
+    _state->frameQueued.notify_one();
+    _state->thread.join();
+}
+
+FrameCapture& FrameCapture::operator=(FrameCapture&& other) noexcept {
+    std::swap(_state, other._state);
+    return *this;
+}
+
+Vector2i FrameCapture::size() const { return _state ? _state->size : Vector2i{}; }
+
+FrameCapture::Format FrameCapture::format() const { return _state ? _state->format : Format{}; }
+
+std::size_t FrameCapture::frameDataSize() const { return _state ? _state->frameDataSize : 0; }
+
+UnsignedInt FrameCapture::frameCount() const { return _state ? _state->reader.frameCount() : 0; }
+
+UnsignedInt FrameCapture::queueSize() const { return _state ? _state->queueSize : 0; }
+
+UnsignedLong FrameCapture::capturedCount() const { return _state ? _state->capturedCount : 0; }
+
+UnsignedLong FrameCapture::consumedCount() const {
+    if(!_state) return 0;
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->consumedCount;
+}
+
+void FrameCapture::capture(GL::Texture2D& texture) {
+    CORRADE_ASSERT(_state,
+        "DebugTools::FrameCapture::capture(): the capture is moved-out or not created", );
+    State& state = *_state;
+
+    /* All readback buffers are in flight, wait for the oldest */
+    if(state.reader.pendingCount() == state.reader.frameCount())
+        state.retrieve();
+
+    state.framebuffer.bind();
+    state.shader.bindSourceTexture(texture);
+    state.mesh.draw(state.shader);
+    state.reader.read(state.framebuffer, {{}, state.targetSize}, Magnum::PixelFormat::RGBA8Unorm);
+    ++state.capturedCount;
+
+    /* Hand over everything that's already finished, without blocking */
+    while(state.reader.isReady())
+        state.retrieve();
+}
+
+void FrameCapture::flush() {
+    CORRADE_ASSERT(_state,
+        "DebugTools::FrameCapture::flush(): the capture is moved-out or not created", );
+    State& state = *_state;
+
+    while(state.reader.pendingCount())
+        state.retrieve();
+
+    std::unique_lock<std::mutex> lock{state.mutex};
+    state.frameConsumed.wait(lock, [&state]{ return state.queued.empty() && !state.consuming; });
+}
+
+}}
@@ -0,0 +1,80 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+uniform highp ivec2 frameSize;
+uniform lowp sampler2D sourceTexture;
+
+out lowp vec4 fragmentColor;
+
+#ifdef NV12
+/* BT.709 luma coefficients, the Cb and Cr scales are 2*(1 - Kb) and
+   2*(1 - Kr) */
+const highp vec3 lumaWeights = vec3(0.2126, 0.7152, 0.0722);
+const highp vec2 chromaScale = vec2(1.8556, 1.5748);
+
+highp float luma(highp vec3 color) {
+    return dot(color, lumaWeights);
+}
+
+highp vec2 chroma(highp ivec2 coordinates) {
+    /* Average of a 2x2 block */
+    highp vec3 color = 0.25*(
+        texelFetch(sourceTexture, coordinates, 0).rgb +
+        texelFetch(sourceTexture, coordinates + ivec2(1, 0), 0).rgb +
+        texelFetch(sourceTexture, coordinates + ivec2(0, 1), 0).rgb +
+        texelFetch(sourceTexture, coordinates + ivec2(1, 1), 0).rgb);
+    return (color.br - vec2(luma(color)))/chromaScale;
+}
+#endif
+
+void main() {
+    highp ivec2 coordinates = ivec2(gl_FragCoord.xy);
+
+    /* The readback returns rows bottom to top while the output is expected
+       top to bottom, so the rows get flipped here */
+    #ifdef NV12
+    /* Each output pixel contains four consecutive bytes of the NV12 data.
+       First frameSize.y rows are the luma plane, the remaining frameSize.y/2
+       rows are the interleaved chroma plane */
+    highp int x = coordinates.x*4;
+    if(coordinates.y < frameSize.y) {
+        highp int y = frameSize.y - 1 - coordinates.y;
+        highp vec4 value = vec4(
+            luma(texelFetch(sourceTexture, ivec2(x + 0, y), 0).rgb),
+            luma(texelFetch(sourceTexture, ivec2(x + 1, y), 0).rgb),
+            luma(texelFetch(sourceTexture, ivec2(x + 2, y), 0).rgb),
+            luma(texelFetch(sourceTexture, ivec2(x + 3, y), 0).rgb));
+        fragmentColor = (vec4(16.0) + 219.0*value)/255.0;
+    } else {
+        highp int y = frameSize.y - 2 - 2*(coordinates.y - frameSize.y);
+        highp vec4 value = vec4(
+            chroma(ivec2(x + 0, y)),
+            chroma(ivec2(x + 2, y)));
+        fragmentColor = (vec4(128.0) + 224.0*value)/255.0;
+    }
+    #else
+    fragmentColor = texelFetch(sourceTexture, ivec2(coordinates.x, frameSize.y - 1 - coordinates.y), 0);
+    #endif
+}
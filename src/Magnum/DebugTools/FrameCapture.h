@@ -0,0 +1,260 @@
+#ifndef Magnum_DebugTools_FrameCapture_h
+#define Magnum_DebugTools_FrameCapture_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::DebugTools::FrameCapture
+ */
+#endif
+
+#include <functional>
+#include <memory>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/DebugTools/visibility.h"
+#include "Magnum/GL/GL.h"
+#include "Magnum/Math/Vector2.h"
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Video frame capture
+
+Captures rendered frames for video encoding without stalling the rendering
+thread. Each captured texture is converted to the output @ref Format on the
+GPU using a full-screen triangle pass, read asynchronously through a ring of
+pixel pack buffers using @ref GL::FramebufferReader and, once the readback
+finishes, copied into a queue that's processed by a dedicated encoder thread.
+
+@section DebugTools-FrameCapture-usage Usage
+
+Pass the frame size, output format and a consumer function to the
+constructor. The consumer gets called on the encoder thread with tightly
+packed frame data and the frame index, in the order the frames were
+captured:
+
+@code{.cpp}
+DebugTools::FrameCapture capture{{1920, 1080},
+    DebugTools::FrameCapture::Format::NV12,
+    [&encoder](Containers::ArrayView<const char> data, UnsignedLong frame) {
+        encoder.encode(data, frame);
+    }};
+
+// each frame, after rendering the scene into colorTexture
+capture.capture(colorTexture);
+
+// at the end
+capture.flush();
+@endcode
+
+The data are ordered top to bottom, as video encoders expect them, unlike
+OpenGL which has the origin in the bottom left corner. For @ref Format::NV12
+the data contain a full-resolution plane of luma bytes followed by a
+half-resolution plane of interleaved Cb and Cr bytes, which can be passed to
+hardware encoders as-is.
+
+@section DebugTools-FrameCapture-latency Latency and backpressure
+
+The readback of a captured frame is retrieved by one of the subsequent
+@ref capture() calls, once its fence signals. Only if all @ref frameCount()
+pixel pack buffers are still pending, @ref capture() waits for the oldest one
+to finish. The retrieved frames are copied into one of @ref queueSize()
+preallocated buffers which are then reused, so there are no allocations after
+construction. If the encoder doesn't keep up and all queue buffers are
+waiting for it, @ref capture() blocks until one is processed, so no frames
+are ever dropped.
+
+@section DebugTools-FrameCapture-state Rendering state
+
+The conversion pass renders into an internal framebuffer, which stays bound
+after @ref capture() returns, so rebind the framebuffer you render to
+afterwards. Blending should be disabled during the @ref capture() call. The
+texture is expected to contain gamma-encoded colors, i.e. to not be in an
+sRGB format which would get decoded to linear on fetch.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" enabled (done by default). See
+    @ref building-features for more information.
+
+@requires_gl30 Extension @gl_extension{ARB,framebuffer_object}
+@requires_gl32 Extension @gl_extension{ARB,sync}
+@requires_gles30 Sync objects are not available in OpenGL ES 2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT FrameCapture {
+    public:
+        /**
+         * @brief Output format
+         *
+         * @see @ref format(), @ref frameDataSize()
+         */
+        enum class Format: UnsignedByte {
+            /**
+             * Four bytes per pixel, red, green, blue and alpha, unchanged
+             * from the input texture.
+             */
+            RGBA8Unorm,
+
+            /**
+             * Planar 4:2:0 YUV with interleaved chroma, BT.709 coefficients
+             * and limited range. A full-resolution plane of luma bytes in
+             * range @f$ [16, 235] @f$ is followed by a half-resolution plane
+             * of interleaved Cb and Cr bytes in range @f$ [16, 240] @f$, each
+             * Cb and Cr pair being an average of a 2x2 block of pixels. Takes
+             * 1.5 bytes per pixel.
+             */
+            NV12
+        };
+
+        /**
+         * @brief Frame consumer
+         *
+         * Called on the encoder thread with tightly packed frame data of
+         * @ref frameDataSize() bytes and index of the frame, counted from
+         * zero. The data are valid only for the duration of the call.
+         */
+        typedef std::function<void(Containers::ArrayView<const char>, UnsignedLong)> Consumer;
+
+        /**
+         * @brief Constructor
+         * @param size          Frame size
+         * @param format        Output format
+         * @param consumer      Frame consumer
+         * @param frameCount    Count of pixel pack buffers in the readback
+         *      ring
+         * @param queueSize     Count of frames that can wait for the
+         *      consumer
+         *
+         * Expects that @p size is non-zero, @p frameCount and @p queueSize
+         * are non-zero and for @ref Format::NV12 that the width is divisible
+         * by four and the height by two. Allocates the GPU resources and
+         * queue buffers and starts the encoder thread.
+         */
+        explicit FrameCapture(const Vector2i& size, Format format, Consumer consumer, UnsignedInt frameCount = 3, UnsignedInt queueSize = 4);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL objects
+         *
+         * The constructed instance is equivalent to moved-from state and no
+         * encoder thread is started. Useful in cases where you will overwrite
+         * the instance later anyway. Move another object over it to make it
+         * useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit FrameCapture(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        FrameCapture(const FrameCapture&) = delete;
+
+        /** @brief Move constructor */
+        FrameCapture(FrameCapture&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref flush() and stops the encoder thread, so all captured
+         * frames are passed to the consumer before the destructor returns.
+         */
+        ~FrameCapture();
+
+        /** @brief Copying is not allowed */
+        FrameCapture& operator=(const FrameCapture&) = delete;
+
+        /** @brief Move assignment */
+        FrameCapture& operator=(FrameCapture&&) noexcept;
+
+        /** @brief Frame size */
+        Vector2i size() const;
+
+        /** @brief Output format */
+        Format format() const;
+
+        /**
+         * @brief Size of output frame data in bytes
+         *
+         * Four bytes per pixel for @ref Format::RGBA8Unorm, 1.5 bytes per
+         * pixel for @ref Format::NV12.
+         */
+        std::size_t frameDataSize() const;
+
+        /** @brief Count of pixel pack buffers in the readback ring */
+        UnsignedInt frameCount() const;
+
+        /** @brief Count of frames that can wait for the consumer */
+        UnsignedInt queueSize() const;
+
+        /**
+         * @brief Count of captured frames
+         *
+         * Count of @ref capture() calls since construction.
+         */
+        UnsignedLong capturedCount() const;
+
+        /**
+         * @brief Count of consumed frames
+         *
+         * Count of frames for which the consumer returned. Is equal to
+         * @ref capturedCount() after @ref flush().
+         */
+        UnsignedLong consumedCount() const;
+
+        /**
+         * @brief Capture a frame
+         *
+         * Converts @p texture to the output format and queues its readback,
+         * then passes all finished readbacks to the encoder thread. Expects
+         * that @p texture is at least @ref size() large, only the bottom
+         * left @ref size() portion is captured. Blocks only if all pixel pack
+         * buffers or all queue buffers are in use, see
+         * @ref DebugTools-FrameCapture-latency for details.
+         */
+        void capture(GL::Texture2D& texture);
+
+        /**
+         * @brief Flush the captured frames
+         *
+         * Waits until all pending readbacks finish, passes them to the
+         * encoder thread and waits until the consumer processes all of them.
+         */
+        void flush();
+
+    private:
+        struct State;
+
+        std::unique_ptr<State> _state;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
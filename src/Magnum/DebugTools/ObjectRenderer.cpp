@@ -32,6 +32,7 @@
 #include "Magnum/MeshTools/Interleave.h"
 #include "Magnum/Primitives/Axis.h"
 #include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/Shaders/Flat.h"
 #include "Magnum/Shaders/VertexColor.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
@@ -44,6 +45,7 @@ template<UnsignedInt> struct Renderer;
 
 template<> struct Renderer<2> {
     static ResourceKey shader() { return {"VertexColorShader2D"}; }
+    static ResourceKey instancedShader() { return {"FlatShader2DVertexColorInstanced"}; }
     static ResourceKey vertexBuffer() { return {"object2d-vertices"}; }
     static ResourceKey indexBuffer() { return {"object2d-indices"}; }
     static ResourceKey mesh() { return {"object2d"}; }
@@ -52,12 +54,31 @@ template<> struct Renderer<2> {
 
 template<> struct Renderer<3> {
     static ResourceKey shader() { return {"VertexColorShader3D"}; }
+    static ResourceKey instancedShader() { return {"FlatShader3DVertexColorInstanced"}; }
     static ResourceKey vertexBuffer() { return {"object3d-vertices"}; }
     static ResourceKey indexBuffer() { return {"object3d-indices"}; }
     static ResourceKey mesh() { return {"object3d"}; }
     static Trade::MeshData3D meshData() { return Primitives::axis3D(); }
 };
 
+/* Creates the vertex and index buffers shared by ObjectRenderer and
+   ObjectRendererBatch if they are not in the manager yet, returns the index
+   count */
+template<UnsignedInt dimensions> UnsignedInt createBuffers(Resource<GL::Buffer>& vertexBuffer, Resource<GL::Buffer>& indexBuffer) {
+    auto data = Renderer<dimensions>::meshData();
+    if(vertexBuffer && indexBuffer) return data.indices().size();
+
+    GL::Buffer* vertices = new GL::Buffer{GL::Buffer::TargetHint::Array};
+    vertices->setData(MeshTools::interleave(data.positions(0), data.colors(0)), GL::BufferUsage::StaticDraw);
+    ResourceManager::instance().set(vertexBuffer.key(), vertices, ResourceDataState::Final, ResourcePolicy::Manual);
+
+    GL::Buffer* indices = new GL::Buffer{GL::Buffer::TargetHint::ElementArray};
+    indices->setData(MeshTools::compressIndicesAs<UnsignedByte>(data.indices()), GL::BufferUsage::StaticDraw);
+    ResourceManager::instance().set(indexBuffer.key(), indices, ResourceDataState::Final, ResourcePolicy::Manual);
+
+    return data.indices().size();
+}
+
 }
 
 /* Doxygen gets confused when using {} to initialize parent object */
@@ -73,24 +94,14 @@ template<UnsignedInt dimensions> ObjectRenderer<dimensions>::ObjectRenderer(Scen
     if(_mesh) return;
 
     /* Create the mesh */
-    GL::Buffer* vertexBuffer = new GL::Buffer{GL::Buffer::TargetHint::Array};
-    GL::Buffer* indexBuffer = new GL::Buffer{GL::Buffer::TargetHint::ElementArray};
     GL::Mesh* mesh = new GL::Mesh;
-
-    auto data = Renderer<dimensions>::meshData();
-
-    vertexBuffer->setData(MeshTools::interleave(data.positions(0), data.colors(0)), GL::BufferUsage::StaticDraw);
-    ResourceManager::instance().set(_vertexBuffer.key(), vertexBuffer, ResourceDataState::Final, ResourcePolicy::Manual);
-
-    indexBuffer->setData(MeshTools::compressIndicesAs<UnsignedByte>(data.indices()), GL::BufferUsage::StaticDraw);
-    ResourceManager::instance().set(_indexBuffer.key(), indexBuffer, ResourceDataState::Final, ResourcePolicy::Manual);
-
+    const UnsignedInt indexCount = createBuffers<dimensions>(_vertexBuffer, _indexBuffer);
     mesh->setPrimitive(GL::MeshPrimitive::Lines)
-        .setCount(data.indices().size())
-        .addVertexBuffer(*vertexBuffer, 0,
+        .setCount(indexCount)
+        .addVertexBuffer(*_vertexBuffer, 0,
             typename Shaders::VertexColor<dimensions>::Position(),
             typename Shaders::VertexColor<dimensions>::Color4{})
-        .setIndexBuffer(*indexBuffer, 0, GL::MeshIndexType::UnsignedByte, 0, data.positions(0).size());
+        .setIndexBuffer(*_indexBuffer, 0, GL::MeshIndexType::UnsignedByte);
     ResourceManager::instance().set<GL::Mesh>(_mesh.key(), mesh, ResourceDataState::Final, ResourcePolicy::Manual);
 }
 
@@ -102,7 +113,55 @@ template<UnsignedInt dimensions> void ObjectRenderer<dimensions>::draw(const Mat
     _mesh->draw(*_shader);
 }
 
+template<UnsignedInt dimensions> ObjectRendererBatch<dimensions>::ObjectRendererBatch(ResourceKey options): _options{ResourceManager::instance().get<ObjectRendererOptions>(options)}, _instanceBuffer{GL::Buffer::TargetHint::Array} {
+    /* Shader */
+    _shader = ResourceManager::instance().get<GL::AbstractShaderProgram, Shaders::Flat<dimensions>>(Renderer<dimensions>::instancedShader());
+    if(!_shader) ResourceManager::instance().set<GL::AbstractShaderProgram>(_shader.key(), new Shaders::Flat<dimensions>{Shaders::Flat<dimensions>::Flag::VertexColor|Shaders::Flat<dimensions>::Flag::InstancedTransformation});
+
+    /* Vertex and index buffers are shared with ObjectRenderer, the mesh is
+       not as each batch has its own instance buffer */
+    _vertexBuffer = ResourceManager::instance().get<GL::Buffer>(Renderer<dimensions>::vertexBuffer());
+    _indexBuffer = ResourceManager::instance().get<GL::Buffer>(Renderer<dimensions>::indexBuffer());
+    const UnsignedInt indexCount = createBuffers<dimensions>(_vertexBuffer, _indexBuffer);
+
+    _mesh.setPrimitive(GL::MeshPrimitive::Lines)
+        .setCount(indexCount)
+        .addVertexBuffer(*_vertexBuffer, 0,
+            typename Shaders::Flat<dimensions>::Position(),
+            typename Shaders::Flat<dimensions>::Color4{})
+        .addVertexBufferInstanced(_instanceBuffer, 1, 0,
+            typename Shaders::Flat<dimensions>::TransformationMatrix{})
+        .setIndexBuffer(*_indexBuffer, 0, GL::MeshIndexType::UnsignedByte);
+}
+
+/* To avoid deleting pointers to incomplete type on destruction of Resource members */
+template<UnsignedInt dimensions> ObjectRendererBatch<dimensions>::~ObjectRendererBatch() = default;
+
+template<UnsignedInt dimensions> void ObjectRendererBatch<dimensions>::add(const MatrixTypeFor<dimensions, Float>& transformationMatrix) {
+    _instances.push_back(transformationMatrix*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->size()}));
+}
+
+template<UnsignedInt dimensions> void ObjectRendererBatch<dimensions>::draw(SceneGraph::Camera<dimensions, Float>& camera) {
+    if(_instances.empty()) return;
+
+    _instanceBuffer.setData(_instances, GL::BufferUsage::StreamDraw);
+    _mesh.setInstanceCount(Int(_instances.size()));
+    _shader->setTransformationProjectionMatrix(camera.projectionMatrix());
+    _mesh.draw(*_shader);
+    _instances.clear();
+}
+
+template<UnsignedInt dimensions> BatchedObjectRenderer<dimensions>::BatchedObjectRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, ObjectRendererBatch<dimensions>& batch, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(object, drawables), _batch(batch) {}
+
+template<UnsignedInt dimensions> void BatchedObjectRenderer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>&) {
+    _batch.add(transformationMatrix);
+}
+
 template class ObjectRenderer<2>;
 template class ObjectRenderer<3>;
+template class ObjectRendererBatch<2>;
+template class ObjectRendererBatch<3>;
+template class BatchedObjectRenderer<2>;
+template class BatchedObjectRenderer<3>;
 
 }}
@@ -27,13 +27,17 @@
 
 #ifdef MAGNUM_TARGET_GL
 /** @file
- * @brief Class @ref Magnum::DebugTools::ObjectRenderer, @ref Magnum::DebugTools::ObjectRendererOptions, typedef @ref Magnum::DebugTools::ObjectRenderer2D, @ref Magnum::DebugTools::ObjectRenderer3D
+ * @brief Class @ref Magnum::DebugTools::ObjectRenderer, @ref Magnum::DebugTools::ObjectRendererOptions, @ref Magnum::DebugTools::ObjectRendererBatch, @ref Magnum::DebugTools::BatchedObjectRenderer, typedef @ref Magnum::DebugTools::ObjectRenderer2D, @ref Magnum::DebugTools::ObjectRenderer3D, @ref Magnum::DebugTools::ObjectRendererBatch2D, @ref Magnum::DebugTools::ObjectRendererBatch3D, @ref Magnum::DebugTools::BatchedObjectRenderer2D, @ref Magnum::DebugTools::BatchedObjectRenderer3D
  */
 #endif
 
+#include <vector>
+
 #include "Magnum/Resource.h"
 #include "Magnum/DebugTools/visibility.h"
+#include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/GL.h"
+#include "Magnum/GL/Mesh.h"
 #include "Magnum/SceneGraph/Drawable.h"
 #include "Magnum/Shaders/Shaders.h"
 
@@ -94,7 +98,8 @@ new DebugTools::ObjectRenderer2D(object, "my", debugDrawables);
     @ref MAGNUM_TARGET_GL "TARGET_GL" and `WITH_SCENEGRAPH` enabled (done by
     default). See @ref building-features for more information.
 
-@see @ref ObjectRenderer2D, @ref ObjectRenderer3D, @ref ObjectRendererOptions
+@see @ref ObjectRenderer2D, @ref ObjectRenderer3D, @ref ObjectRendererOptions,
+    @ref BatchedObjectRenderer
 */
 template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ObjectRenderer: public SceneGraph::Drawable<dimensions, Float> {
     public:
@@ -127,6 +132,142 @@ typedef ObjectRenderer<2> ObjectRenderer2D;
 /** @brief Three-dimensional object renderer */
 typedef ObjectRenderer<3> ObjectRenderer3D;
 
+/**
+@brief Object renderer batch
+
+Collects axes of all @ref BatchedObjectRenderer instances drawn in a frame
+and renders them with a single instanced draw call using
+@ref Shaders::Flat with @ref Shaders::Flat::Flag::InstancedTransformation
+enabled. Unlike @ref ObjectRenderer, where each object is a separate draw
+call, the cost of visualizing many objects is then mostly just the upload of
+the per-instance transformations. The vertex and index buffers are shared with
+@ref ObjectRenderer through @ref DebugTools::ResourceManager.
+
+@section DebugTools-ObjectRendererBatch-usage Basic usage
+
+Draw the renderer group first, which adds the instances to the batch, and then
+draw the batch itself:
+
+@code{.cpp}
+DebugTools::ObjectRendererBatch3D batch{"my"};
+
+// Create batched debug renderers for given objects, use "my" options for all
+for(Object3D* object: objects)
+    new DebugTools::BatchedObjectRenderer3D{*object, batch, &debugDrawables};
+
+// Each frame
+camera.draw(debugDrawables);
+batch.draw(camera);
+@endcode
+
+@requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+@requires_gles30 Extension @gl_extension{ANGLE,instanced_arrays},
+    @gl_extension{EXT,instanced_arrays} or
+    @gl_extension{NV,instanced_arrays} in OpenGL ES 2.0.
+@requires_webgl20 Extension @webgl_extension{ANGLE,instanced_arrays} in WebGL
+    1.0.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" and `WITH_SCENEGRAPH` enabled (done by
+    default). See @ref building-features for more information.
+
+@see @ref ObjectRendererBatch2D, @ref ObjectRendererBatch3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ObjectRendererBatch {
+    public:
+        /**
+         * @brief Constructor
+         * @param options   Options resource key, shared by all instances in
+         *      the batch. See @ref DebugTools-ObjectRenderer-usage "ObjectRenderer documentation"
+         *      for more information.
+         */
+        explicit ObjectRendererBatch(ResourceKey options = ResourceKey());
+
+        /** @brief Copying is not allowed */
+        ObjectRendererBatch(const ObjectRendererBatch<dimensions>&) = delete;
+
+        ~ObjectRendererBatch();
+
+        /** @brief Copying is not allowed */
+        ObjectRendererBatch<dimensions>& operator=(const ObjectRendererBatch<dimensions>&) = delete;
+
+        /** @brief Count of instances added since last @ref draw() */
+        std::size_t size() const { return _instances.size(); }
+
+        /**
+         * @brief Add an instance
+         * @param transformationMatrix  Object transformation relative to
+         *      camera
+         *
+         * Called from @ref BatchedObjectRenderer, but can be used also
+         * directly.
+         */
+        void add(const MatrixTypeFor<dimensions, Float>& transformationMatrix);
+
+        /**
+         * @brief Draw all instances
+         *
+         * Uploads the instances added since last call and renders them with a
+         * single draw call, then clears the list. Does nothing if there are
+         * no instances.
+         */
+        void draw(SceneGraph::Camera<dimensions, Float>& camera);
+
+    private:
+        Resource<ObjectRendererOptions> _options;
+        Resource<GL::AbstractShaderProgram, Shaders::Flat<dimensions>> _shader;
+        Resource<GL::Buffer> _vertexBuffer, _indexBuffer;
+        GL::Buffer _instanceBuffer;
+        GL::Mesh _mesh;
+        std::vector<MatrixTypeFor<dimensions, Float>> _instances;
+};
+
+/** @brief Two-dimensional object renderer batch */
+typedef ObjectRendererBatch<2> ObjectRendererBatch2D;
+
+/** @brief Three-dimensional object renderer batch */
+typedef ObjectRendererBatch<3> ObjectRendererBatch3D;
+
+/**
+@brief Batched object renderer
+
+Equivalent to @ref ObjectRenderer, but instead of drawing the axes itself it
+adds them to an @ref ObjectRendererBatch. See
+@ref DebugTools-ObjectRendererBatch-usage "its documentation" for more
+information.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" and `WITH_SCENEGRAPH` enabled (done by
+    default). See @ref building-features for more information.
+
+@see @ref BatchedObjectRenderer2D, @ref BatchedObjectRenderer3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT BatchedObjectRenderer: public SceneGraph::Drawable<dimensions, Float> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object for which to create debug renderer
+         * @param batch     Batch to add the instance to
+         * @param drawables Drawable group
+         *
+         * The renderer is automatically added to object's features, @p batch
+         * is saved as a reference and thus it must be available for the
+         * whole lifetime of the renderer.
+         */
+        explicit BatchedObjectRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, ObjectRendererBatch<dimensions>& batch, SceneGraph::DrawableGroup<dimensions, Float>* drawables = nullptr);
+
+    private:
+        void draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) override;
+
+        ObjectRendererBatch<dimensions>& _batch;
+};
+
+/** @brief Two-dimensional batched object renderer */
+typedef BatchedObjectRenderer<2> BatchedObjectRenderer2D;
+
+/** @brief Three-dimensional batched object renderer */
+typedef BatchedObjectRenderer<3> BatchedObjectRenderer3D;
+
 }}
 #else
 #error this header is available only in the OpenGL build
@@ -26,16 +26,78 @@
 #include "Profiler.h"
 
 #include <algorithm>
+#include <iomanip>
+#include <mutex>
 #include <numeric>
+#include <sstream>
+#include <thread>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Directory.h>
 
 #include "Magnum/Magnum.h"
 
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/GL/PrimitiveQuery.h"
+#include "Magnum/GL/SampleQuery.h"
+#include "Magnum/GL/TimeQuery.h"
+#endif
+
 using namespace std::chrono;
 
 namespace Magnum { namespace DebugTools {
 
+struct Profiler::TraceState {
+    /* Scopes can end on any thread, so everything here is guarded */
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    std::vector<std::thread::id> threads;
+    std::size_t frame{};
+    TraceCallback callback{};
+    void* userData{};
+};
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+const std::size_t Profiler::GpuLatency;
+
+struct Profiler::GpuState {
+    struct Record {
+        Section section;
+        GL::TimeQuery time{NoCreate};
+        #ifndef MAGNUM_TARGET_GLES2
+        GL::PrimitiveQuery primitives{NoCreate};
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        GL::SampleQuery samples{NoCreate};
+        #endif
+    };
+
+    struct Frame {
+        /* Records are kept between frames so the queries can be reused,
+           only the first `used` are valid in the current frame */
+        std::vector<Record> records;
+        std::size_t used{};
+        bool submitted{};
+    };
+
+    Frame frames[GpuLatency];
+    std::size_t current{};
+    bool running{};
+};
+#endif
+
+Profiler::Profiler(): _enabled(false), _measureDuration(60), _currentFrame(0), _frameCount(0), _sections{"Other"}, _currentSection(otherSection), _traceEnabled{}
+    #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+    , _gpuFrameCount{}
+    #endif
+    {}
+
+Profiler::Profiler(Profiler&&) noexcept = default;
+
+Profiler::~Profiler() = default;
+
+Profiler& Profiler::operator=(Profiler&&) noexcept = default;
+
 Profiler::Section Profiler::addSection(const std::string& name) {
     CORRADE_ASSERT(!_enabled, "Profiler: cannot add section when profiling is enabled", 0);
     _sections.push_back(name);
@@ -47,15 +109,275 @@ void Profiler::setMeasureDuration(std::size_t frames) {
     _measureDuration = frames;
 }
 
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+void Profiler::setGpuQueries(const GpuQueries queries) {
+    CORRADE_ASSERT(!_enabled, "Profiler: cannot set GPU queries when profiling is enabled", );
+    _gpuQueries = queries;
+
+    /* Recreate the query pool on next enable() so it contains only the
+       queries that are needed */
+    _gpu = nullptr;
+}
+
+std::chrono::nanoseconds Profiler::gpuDuration(const Section section) const {
+    CORRADE_ASSERT(section < _sections.size(), "Profiler::gpuDuration(): unknown section", {});
+    if(!_gpuFrameCount || section >= _gpuTotalData.size()) return {};
+    return std::chrono::nanoseconds(_gpuTotalData[section].time/_gpuFrameCount);
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+UnsignedLong Profiler::primitivesGenerated(const Section section) const {
+    CORRADE_ASSERT(section < _sections.size(), "Profiler::primitivesGenerated(): unknown section", {});
+    if(!_gpuFrameCount || section >= _gpuTotalData.size()) return {};
+    return _gpuTotalData[section].primitives/_gpuFrameCount;
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+UnsignedLong Profiler::samplesPassed(const Section section) const {
+    CORRADE_ASSERT(section < _sections.size(), "Profiler::samplesPassed(): unknown section", {});
+    if(!_gpuFrameCount || section >= _gpuTotalData.size()) return {};
+    return _gpuTotalData[section].samples/_gpuFrameCount;
+}
+#endif
+
+void Profiler::gpuBegin(const Section section) {
+    GpuState::Frame& frame = _gpu->frames[_gpu->current];
+    if(frame.used == frame.records.size()) {
+        frame.records.emplace_back();
+        GpuState::Record& record = frame.records.back();
+        if(_gpuQueries & GpuQuery::TimeElapsed)
+            record.time = GL::TimeQuery{GL::TimeQuery::Target::TimeElapsed};
+        #ifndef MAGNUM_TARGET_GLES2
+        if(_gpuQueries & GpuQuery::PrimitivesGenerated)
+            record.primitives = GL::PrimitiveQuery{GL::PrimitiveQuery::Target::PrimitivesGenerated};
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        if(_gpuQueries & GpuQuery::SamplesPassed)
+            record.samples = GL::SampleQuery{GL::SampleQuery::Target::SamplesPassed};
+        #endif
+    }
+
+    GpuState::Record& record = frame.records[frame.used++];
+    record.section = section;
+    if(_gpuQueries & GpuQuery::TimeElapsed) record.time.begin();
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_gpuQueries & GpuQuery::PrimitivesGenerated) record.primitives.begin();
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    if(_gpuQueries & GpuQuery::SamplesPassed) record.samples.begin();
+    #endif
+
+    _gpu->running = true;
+}
+
+void Profiler::gpuEnd() {
+    if(!_gpu->running) return;
+
+    GpuState::Frame& frame = _gpu->frames[_gpu->current];
+    GpuState::Record& record = frame.records[frame.used - 1];
+    if(_gpuQueries & GpuQuery::TimeElapsed) record.time.end();
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_gpuQueries & GpuQuery::PrimitivesGenerated) record.primitives.end();
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    if(_gpuQueries & GpuQuery::SamplesPassed) record.samples.end();
+    #endif
+
+    _gpu->running = false;
+}
+
+void Profiler::gpuCollect() {
+    /* End queries of current frame and continue the running section in the
+       next one so each frame has its own set of queries */
+    const bool running = _gpu->running;
+    gpuEnd();
+    _gpu->frames[_gpu->current].submitted = true;
+    _gpu->current = (_gpu->current + 1) % GpuLatency;
+
+    /* The next frame was submitted GpuLatency frames ago. Take its results
+       only if all are available already, never wait for them. */
+    GpuState::Frame& frame = _gpu->frames[_gpu->current];
+    bool available = frame.submitted;
+    for(std::size_t i = 0; available && i != frame.used; ++i) {
+        GpuState::Record& record = frame.records[i];
+        if((_gpuQueries & GpuQuery::TimeElapsed) && !record.time.resultAvailable())
+            available = false;
+        #ifndef MAGNUM_TARGET_GLES2
+        else if((_gpuQueries & GpuQuery::PrimitivesGenerated) && !record.primitives.resultAvailable())
+            available = false;
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        else if((_gpuQueries & GpuQuery::SamplesPassed) && !record.samples.resultAvailable())
+            available = false;
+        #endif
+    }
+
+    if(available) for(std::size_t i = 0; i != frame.used; ++i) {
+        GpuState::Record& record = frame.records[i];
+        GpuData& data = _gpuFrameData[_currentFrame*_sections.size()+record.section];
+        if(_gpuQueries & GpuQuery::TimeElapsed)
+            data.time += record.time.result<UnsignedLong>();
+        #ifndef MAGNUM_TARGET_GLES2
+        if(_gpuQueries & GpuQuery::PrimitivesGenerated)
+            data.primitives += record.primitives.result<UnsignedInt>();
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        if(_gpuQueries & GpuQuery::SamplesPassed)
+            data.samples += record.samples.result<UnsignedInt>();
+        #endif
+    }
+    _gpuFrameAvailable[_currentFrame] = available;
+
+    frame.used = 0;
+    frame.submitted = false;
+    if(running) gpuBegin(_currentSection);
+}
+#endif
+
+void Profiler::setTraceEnabled(const bool enabled) {
+    _traceEnabled = enabled;
+    if(enabled && !_trace) _trace.reset(new TraceState);
+}
+
+void Profiler::setTraceCallback(const TraceCallback callback, void* const userData) {
+    if(!_trace) _trace.reset(new TraceState);
+    std::lock_guard<std::mutex> lock{_trace->mutex};
+    _trace->callback = callback;
+    _trace->userData = userData;
+}
+
+std::vector<Profiler::TraceEvent> Profiler::traceEvents() const {
+    if(!_trace) return {};
+    std::lock_guard<std::mutex> lock{_trace->mutex};
+    return _trace->events;
+}
+
+void Profiler::clearTrace() {
+    if(!_trace) return;
+    std::lock_guard<std::mutex> lock{_trace->mutex};
+    _trace->events.clear();
+}
+
+namespace {
+
+void writeJsonString(std::ostream& out, const std::string& string) {
+    out << '"';
+    for(const char c: string) {
+        if(c == '"' || c == '\\') out << '\\' << c;
+        else if(c == '\n') out << "\\n";
+        else if(c == '\t') out << "\\t";
+        else if(UnsignedByte(c) < 0x20)
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << Int(c) << std::dec << std::setfill(' ');
+        else out << c;
+    }
+    out << '"';
+}
+
+}
+
+std::string Profiler::chromeTrace() const {
+    const std::vector<TraceEvent> events = traceEvents();
+
+    /* Timestamps and durations are in microseconds */
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "{\"traceEvents\":[";
+    for(std::size_t i = 0; i != events.size(); ++i) {
+        const TraceEvent& event = events[i];
+        if(i) out << ',';
+        out << "\n{\"name\":";
+        writeJsonString(out, event.name);
+        out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread
+            << ",\"ts\":" << event.begin.count()/1000.0
+            << ",\"dur\":" << event.duration.count()/1000.0
+            << ",\"args\":{\"frame\":" << event.frame << "}}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return out.str();
+}
+
+bool Profiler::saveChromeTrace(const std::string& filename) const {
+    const std::string trace = chromeTrace();
+    if(!Utility::Directory::write(filename, Containers::ArrayView<const void>{trace.data(), trace.size()})) {
+        Error() << "Profiler::saveChromeTrace(): cannot write to file" << filename;
+        return false;
+    }
+
+    return true;
+}
+
+void Profiler::trace(const std::string& name, const high_resolution_clock::time_point begin, const high_resolution_clock::time_point end) {
+    if(!_trace) return;
+
+    std::lock_guard<std::mutex> lock{_trace->mutex};
+    if(!_traceEnabled && !_trace->callback) return;
+
+    /* Thread index in order of first appearance */
+    const std::thread::id id = std::this_thread::get_id();
+    const auto found = std::find(_trace->threads.begin(), _trace->threads.end(), id);
+    const UnsignedInt thread = found - _trace->threads.begin();
+    if(found == _trace->threads.end()) _trace->threads.push_back(id);
+
+    TraceEvent event{name, thread, _trace->frame,
+        duration_cast<nanoseconds>(begin - _traceStart),
+        duration_cast<nanoseconds>(end - begin)};
+    if(_trace->callback) _trace->callback(event, _trace->userData);
+    if(_traceEnabled) _trace->events.push_back(std::move(event));
+}
+
+Profiler::Scope::Scope(Profiler& profiler, std::string name): _profiler(profiler), _name{std::move(name)} {
+    if(_profiler._enabled && _profiler._trace) _begin = high_resolution_clock::now();
+}
+
+Profiler::Scope::~Scope() {
+    if(_begin != high_resolution_clock::time_point())
+        _profiler.trace(_name, _begin, high_resolution_clock::now());
+}
+
 void Profiler::enable() {
     _enabled = true;
     _frameData.assign(_measureDuration*_sections.size(), high_resolution_clock::duration::zero());
     _totalData.assign(_sections.size(), high_resolution_clock::duration::zero());
     _frameCount = 0;
+
+    _traceStart = high_resolution_clock::now();
+    if(_trace) {
+        std::lock_guard<std::mutex> lock{_trace->mutex};
+        _trace->events.clear();
+        _trace->frame = 0;
+    }
+
+    #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_gpuQueries) {
+        if(!_gpu) _gpu.reset(new GpuState);
+        else {
+            gpuEnd();
+            for(GpuState::Frame& frame: _gpu->frames) {
+                frame.used = 0;
+                frame.submitted = false;
+            }
+        }
+
+        _gpuFrameData.assign(_measureDuration*_sections.size(), GpuData{});
+        _gpuTotalData.assign(_sections.size(), GpuData{});
+        _gpuFrameAvailable.assign(_measureDuration, false);
+        _gpuFrameCount = 0;
+
+        /* If the profiler is already running, continue the current section
+           on the GPU as well */
+        if(_previousTime != high_resolution_clock::time_point())
+            gpuBegin(_currentSection);
+    }
+    #endif
 }
 
 void Profiler::disable() {
     _enabled = false;
+
+    #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_gpu) gpuEnd();
+    #endif
 }
 
 void Profiler::start(Section section) {
@@ -65,6 +387,13 @@ void Profiler::start(Section section) {
     save();
 
     _currentSection = section;
+
+    #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_gpu) {
+        gpuEnd();
+        gpuBegin(section);
+    }
+    #endif
 }
 
 void Profiler::stop() {
@@ -73,14 +402,20 @@ void Profiler::stop() {
     save();
 
     _previousTime = high_resolution_clock::time_point();
+
+    #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_gpu) gpuEnd();
+    #endif
 }
 
 void Profiler::save() {
     auto now = high_resolution_clock::now();
 
     /* If the profiler is already running, add time to given section */
-    if(_previousTime != high_resolution_clock::time_point())
+    if(_previousTime != high_resolution_clock::time_point()) {
         _frameData[_currentFrame*_sections.size()+_currentSection] += now-_previousTime;
+        trace(_sections[_currentSection], _previousTime, now);
+    }
 
     /* Set current time as previous for next section */
     _previousTime = now;
@@ -102,9 +437,44 @@ void Profiler::nextFrame() {
         _frameData[nextFrame*_sections.size()+i] = high_resolution_clock::duration::zero();
     }
 
+    /* Do the same for GPU results that arrived in this frame */
+    #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_gpu) {
+        gpuCollect();
+
+        if(_gpuFrameAvailable[_currentFrame]) {
+            for(std::size_t i = 0; i != _sections.size(); ++i) {
+                const GpuData& data = _gpuFrameData[_currentFrame*_sections.size()+i];
+                _gpuTotalData[i].time += data.time;
+                _gpuTotalData[i].primitives += data.primitives;
+                _gpuTotalData[i].samples += data.samples;
+            }
+            ++_gpuFrameCount;
+        }
+
+        if(_gpuFrameAvailable[nextFrame]) {
+            for(std::size_t i = 0; i != _sections.size(); ++i) {
+                const GpuData& data = _gpuFrameData[nextFrame*_sections.size()+i];
+                _gpuTotalData[i].time -= data.time;
+                _gpuTotalData[i].primitives -= data.primitives;
+                _gpuTotalData[i].samples -= data.samples;
+            }
+            --_gpuFrameCount;
+        }
+        for(std::size_t i = 0; i != _sections.size(); ++i)
+            _gpuFrameData[nextFrame*_sections.size()+i] = GpuData{};
+        _gpuFrameAvailable[nextFrame] = false;
+    }
+    #endif
+
     /* Advance to next frame */
     _currentFrame = nextFrame;
 
+    if(_trace) {
+        std::lock_guard<std::mutex> lock{_trace->mutex};
+        ++_trace->frame;
+    }
+
     if(_frameCount < _measureDuration) ++_frameCount;
 }
 
@@ -117,8 +487,31 @@ void Profiler::printStatistics() {
     std::sort(totalSorted.begin(), totalSorted.end(), [this](std::size_t i, std::size_t j){return _totalData[i] > _totalData[j];});
 
     Debug() << "Statistics for last" << _measureDuration << "frames:";
-    for(std::size_t i = 0; i != _sections.size(); ++i)
-        Debug() << " " << _sections[totalSorted[i]] << duration_cast<microseconds>(_totalData[totalSorted[i]]).count()/_frameCount << u8"µs";
+    for(std::size_t i = 0; i != _sections.size(); ++i) {
+        Debug d;
+        d << " " << _sections[totalSorted[i]] << duration_cast<microseconds>(_totalData[totalSorted[i]]).count()/_frameCount << u8"µs";
+
+        #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+        if(!_gpu) continue;
+        d << "CPU";
+        if(!_gpuFrameCount) {
+            d << "(no GPU results yet)";
+            continue;
+        }
+
+        const GpuData& data = _gpuTotalData[totalSorted[i]];
+        if(_gpuQueries & GpuQuery::TimeElapsed)
+            d << Debug::nospace << "," << data.time/1000/_gpuFrameCount << u8"µs GPU";
+        #ifndef MAGNUM_TARGET_GLES2
+        if(_gpuQueries & GpuQuery::PrimitivesGenerated)
+            d << Debug::nospace << "," << data.primitives/_gpuFrameCount << "primitives";
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        if(_gpuQueries & GpuQuery::SamplesPassed)
+            d << Debug::nospace << "," << data.samples/_gpuFrameCount << "samples";
+        #endif
+        #endif
+    }
 }
 
 }}
@@ -31,8 +31,10 @@
 
 #include <chrono>
 #include <initializer_list>
+#include <memory>
 #include <string>
 #include <vector>
+#include <Corrade/Containers/EnumSet.h>
 
 #include "Magnum/Types.h"
 #include "Magnum/DebugTools/visibility.h"
@@ -98,6 +100,65 @@ It's possible to start profiler only for certain parts of the code and then
 stop it again using @ref stop(), if you are not interested in profiling the
 rest.
 
+@section DebugTools-Profiler-gpu GPU queries
+
+The CPU time doesn't say much about how long the GPU took to execute the
+commands issued in given section. Use @ref setGpuQueries() to measure also GPU
+time and primitive and sample counts of each section using
+@ref GL::TimeQuery, @ref GL::PrimitiveQuery and @ref GL::SampleQuery:
+
+@code{.cpp}
+p.setGpuQueries(DebugTools::Profiler::GpuQuery::TimeElapsed|
+                DebugTools::Profiler::GpuQuery::SamplesPassed);
+p.enable();
+@endcode
+
+The queries are begun and ended together with the sections and kept in a pool
+for @ref GpuLatency frames. Results of a frame are retrieved
+@cpp GpuLatency - 1 @ce calls to @ref nextFrame() later and only if they're
+already available, so the profiling never stalls the pipeline --- if the GPU is
+lagging even more behind, given frame is not included in the GPU statistics.
+The results are then averaged over @ref gpuFrameCount() frames and printed by
+@ref printStatistics() next to the CPU times, or available through
+@ref gpuDuration(), @ref primitivesGenerated() and @ref samplesPassed(). Each
+query type is available only where the corresponding @ref GL::TimeQuery,
+@ref GL::PrimitiveQuery or @ref GL::SampleQuery target is, see
+@ref GpuQuery for details.
+
+@section DebugTools-Profiler-trace Tracing
+
+Besides the averages, the profiler can record each section and each nested
+scope of each frame as a separate event for later analysis. Enable that using
+@ref setTraceEnabled(), mark additional scopes using the @ref Scope RAII guard
+and export the result as a Chrome Trace Event JSON that can be opened in
+@cb{.sh} chrome://tracing @ce or processed by other tools:
+
+@code{.cpp}
+p.setTraceEnabled(true);
+p.enable();
+
+void MyApplication::drawEvent() {
+    p.start(sections.physics);
+    {
+        DebugTools::Profiler::Scope s{p, "Collision detection"};
+        // ...
+    }
+
+    // ...
+    p.nextFrame();
+}
+
+// Save all events recorded since enable()
+p.saveChromeTrace("trace.json");
+@endcode
+
+The scopes can be used from any thread, each event records index of the thread
+it was recorded on in @ref TraceEvent::thread. Recorded events can be also
+accessed directly using @ref traceEvents() or streamed live to an external
+profiler using @ref setTraceCallback(), in which case they don't need to be
+stored at all. The callback is called with an internal lock held, so it
+shouldn't call back into the profiler.
+
 @todo Some unit testing
 @todo More time intervals
 */
@@ -117,7 +178,116 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
          */
         static const Section otherSection = 0;
 
-        explicit Profiler(): _enabled(false), _measureDuration(60), _currentFrame(0), _frameCount(0), _sections{"Other"}, _currentSection(otherSection) {}
+        /**
+         * @brief Trace event
+         *
+         * @see @ref DebugTools-Profiler-trace, @ref traceEvents(),
+         *      @ref setTraceCallback()
+         */
+        struct TraceEvent {
+            /** @brief Section or scope name */
+            std::string name;
+
+            /** @brief Thread index, in order of first appearance */
+            UnsignedInt thread;
+
+            /** @brief Frame index, counted from @ref enable() */
+            std::size_t frame;
+
+            /** @brief Begin time, relative to @ref enable() */
+            std::chrono::nanoseconds begin;
+
+            /** @brief Duration */
+            std::chrono::nanoseconds duration;
+        };
+
+        /**
+         * @brief Trace callback
+         *
+         * @see @ref setTraceCallback()
+         */
+        typedef void(*TraceCallback)(const TraceEvent&, void*);
+
+        class Scope;
+
+        #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief GPU query
+         *
+         * @see @ref GpuQueries, @ref setGpuQueries()
+         * @requires_gl Available only if Magnum is built with OpenGL
+         *      support. Not available in WebGL.
+         */
+        enum class GpuQuery: UnsignedByte {
+            /**
+             * GPU time spent in each section, using
+             * @ref GL::TimeQuery::Target::TimeElapsed.
+             * @requires_gl33 Extension @gl_extension{ARB,timer_query}
+             * @requires_es_extension Extension
+             *      @gl_extension{EXT,disjoint_timer_query}
+             * @see @ref gpuDuration()
+             */
+            TimeElapsed = 1 << 0,
+
+            #ifndef MAGNUM_TARGET_GLES2
+            /**
+             * Count of primitives generated in each section, using
+             * @ref GL::PrimitiveQuery::Target::PrimitivesGenerated.
+             * @requires_gl30 Extension @gl_extension{EXT,transform_feedback}
+             * @requires_gles32 Extension @gl_extension{ANDROID,extension_pack_es31a} /
+             *      @gl_extension{EXT,geometry_shader}
+             * @requires_gles30 Not defined in OpenGL ES 2.0.
+             * @see @ref primitivesGenerated()
+             */
+            PrimitivesGenerated = 1 << 1,
+            #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Count of samples passed in each section, using
+             * @ref GL::SampleQuery::Target::SamplesPassed.
+             * @requires_gl Only boolean occlusion queries are available in
+             *      OpenGL ES.
+             * @see @ref samplesPassed()
+             */
+            SamplesPassed = 1 << 2
+            #endif
+        };
+
+        /**
+         * @brief GPU queries
+         *
+         * @see @ref setGpuQueries()
+         * @requires_gl Available only if Magnum is built with OpenGL
+         *      support. Not available in WebGL.
+         */
+        typedef Containers::EnumSet<GpuQuery> GpuQueries;
+
+        /**
+         * @brief Count of frames of GPU queries kept in flight
+         *
+         * See @ref DebugTools-Profiler-gpu for more information.
+         * @requires_gl Available only if Magnum is built with OpenGL
+         *      support. Not available in WebGL.
+         */
+        static const std::size_t GpuLatency = 3;
+        #endif
+
+        explicit Profiler();
+
+        /** @brief Copying is not allowed */
+        Profiler(const Profiler&) = delete;
+
+        /** @brief Move constructor */
+        Profiler(Profiler&&) noexcept;
+
+        ~Profiler();
+
+        /** @brief Copying is not allowed */
+        Profiler& operator=(const Profiler&) = delete;
+
+        /** @brief Move assignment */
+        Profiler& operator=(Profiler&&) noexcept;
 
         /**
          * @brief Set measure duration
@@ -136,6 +306,78 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
          */
         Section addSection(const std::string& name);
 
+        #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief GPU queries
+         *
+         * @requires_gl Available only if Magnum is built with OpenGL
+         *      support. Not available in WebGL.
+         */
+        GpuQueries gpuQueries() const { return _gpuQueries; }
+
+        /**
+         * @brief Set GPU queries
+         *
+         * Default is no queries, meaning only CPU time is measured. The
+         * queries are created on first use, a GL context has to be active
+         * for all subsequent calls to @ref start(), @ref stop() and
+         * @ref nextFrame() then. See @ref DebugTools-Profiler-gpu for more
+         * information.
+         * @attention This function cannot be called if profiling is enabled.
+         * @requires_gl Available only if Magnum is built with OpenGL
+         *      support. Not available in WebGL.
+         */
+        void setGpuQueries(GpuQueries queries);
+
+        /**
+         * @brief Count of frames with GPU query results
+         *
+         * Always less than the measure duration set with
+         * @ref setMeasureDuration().
+         * @requires_gl Available only if Magnum is built with OpenGL
+         *      support. Not available in WebGL.
+         */
+        std::size_t gpuFrameCount() const { return _gpuFrameCount; }
+
+        /**
+         * @brief Average GPU time spent in given section
+         *
+         * Averaged over @ref gpuFrameCount() frames. Returns zero if
+         * @ref GpuQuery::TimeElapsed is not enabled or there are no results
+         * yet.
+         * @requires_gl Available only if Magnum is built with OpenGL
+         *      support. Not available in WebGL.
+         */
+        std::chrono::nanoseconds gpuDuration(Section section) const;
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Average count of primitives generated in given section
+         *
+         * Averaged over @ref gpuFrameCount() frames. Returns zero if
+         * @ref GpuQuery::PrimitivesGenerated is not enabled or there are no
+         * results yet.
+         * @requires_gl Available only if Magnum is built with OpenGL
+         *      support. Not available in WebGL.
+         * @requires_gles30 Not defined in OpenGL ES 2.0.
+         */
+        UnsignedLong primitivesGenerated(Section section) const;
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Average count of samples passed in given section
+         *
+         * Averaged over @ref gpuFrameCount() frames. Returns zero if
+         * @ref GpuQuery::SamplesPassed is not enabled or there are no results
+         * yet.
+         * @requires_gl Available only if Magnum is built with OpenGL
+         *      support. Not available in WebGL.
+         */
+        UnsignedLong samplesPassed(Section section) const;
+        #endif
+        #endif
+
         /**
          * @brief Whether profiling is enabled
          *
@@ -147,7 +389,7 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
         /**
          * @brief Enable profiling
          *
-         * Clears already mesaured data.
+         * Clears already mesaured data, including pending GPU queries.
          * @see @ref disable(), @ref isEnabled()
          */
         void enable();
@@ -195,13 +437,88 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
         /**
          * @brief Print statistics
          *
-         * Prints statistics about previous frame ordered by duration.
+         * Prints statistics about previous frame ordered by duration. If
+         * GPU queries are enabled, their averaged results are printed next to
+         * the CPU time of each section.
          * @note Does nothing if profiling is disabled.
          */
         void printStatistics();
 
+        /**
+         * @brief Whether tracing is enabled
+         *
+         * @see @ref setTraceEnabled()
+         */
+        bool isTraceEnabled() const { return _traceEnabled; }
+
+        /**
+         * @brief Enable or disable tracing
+         *
+         * If enabled, each section and each @ref Scope is recorded as a
+         * separate event while profiling is enabled. Disabled by default. See
+         * @ref DebugTools-Profiler-trace for more information.
+         * @see @ref traceEvents(), @ref chromeTrace()
+         */
+        void setTraceEnabled(bool enabled);
+
+        /**
+         * @brief Set trace callback
+         *
+         * The @p callback is called with each recorded event and @p userData
+         * while profiling is enabled, independently of whether the events are
+         * stored with @ref setTraceEnabled(). Pass @cpp nullptr @ce to reset
+         * the callback.
+         */
+        void setTraceCallback(TraceCallback callback, void* userData = nullptr);
+
+        /**
+         * @brief Recorded trace events
+         *
+         * Events recorded since last @ref enable() or @ref clearTrace(), in
+         * order in which they ended.
+         */
+        std::vector<TraceEvent> traceEvents() const;
+
+        /**
+         * @brief Clear recorded trace events
+         *
+         * Doesn't reset time and frame counters, unlike @ref enable().
+         */
+        void clearTrace();
+
+        /**
+         * @brief Recorded trace events as a Chrome Trace Event JSON
+         *
+         * Each event is written as a complete event with frame index in its
+         * arguments.
+         * @see @ref saveChromeTrace()
+         */
+        std::string chromeTrace() const;
+
+        /**
+         * @brief Save recorded trace events as a Chrome Trace Event JSON
+         *
+         * Returns @cpp false @ce if the file can't be written.
+         * @see @ref chromeTrace()
+         */
+        bool saveChromeTrace(const std::string& filename) const;
+
     private:
+        struct TraceState;
+        #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+        struct GpuState;
+        struct GpuData {
+            UnsignedLong time, primitives, samples;
+        };
+        #endif
+
         void save();
+        void trace(const std::string& name, std::chrono::high_resolution_clock::time_point begin, std::chrono::high_resolution_clock::time_point end);
+        #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+        void gpuBegin(Section section);
+        void gpuEnd();
+        void gpuCollect();
+        #endif
 
         bool _enabled;
         std::size_t _measureDuration, _currentFrame, _frameCount;
@@ -210,8 +527,61 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
         std::vector<std::chrono::high_resolution_clock::duration> _totalData;
         std::chrono::high_resolution_clock::time_point _previousTime;
         Section _currentSection;
+
+        bool _traceEnabled;
+        std::chrono::high_resolution_clock::time_point _traceStart;
+        std::unique_ptr<TraceState> _trace;
+
+        #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+        GpuQueries _gpuQueries;
+        std::size_t _gpuFrameCount;
+        std::vector<GpuData> _gpuFrameData;
+        std::vector<GpuData> _gpuTotalData;
+        /* Whether given frame in the window has GPU results */
+        std::vector<bool> _gpuFrameAvailable;
+        std::unique_ptr<GpuState> _gpu;
+        #endif
+};
+
+/**
+@brief Profiler scope
+
+Records time spent between construction and destruction as a trace event on
+the calling thread. Scopes can be nested. Does nothing if profiling or tracing
+is not enabled. See @ref DebugTools-Profiler-trace for more information.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT Profiler::Scope {
+    public:
+        /**
+         * @brief Constructor
+         * @param profiler  Profiler to record to
+         * @param name      Scope name
+         */
+        explicit Scope(Profiler& profiler, std::string name);
+
+        /** @brief Copying is not allowed */
+        Scope(const Scope&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Records the event.
+         */
+        ~Scope();
+
+        /** @brief Copying is not allowed */
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Profiler& _profiler;
+        std::string _name;
+        std::chrono::high_resolution_clock::time_point _begin;
 };
 
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+CORRADE_ENUMSET_OPERATORS(Profiler::GpuQueries)
+#endif
+
 }}
 
 #endif
@@ -48,6 +48,9 @@ struct CompareImageTest: TestSuite::Tester {
 
     void calculateDelta();
     void calculateDeltaStorage();
+    void calculateDeltaMultithreaded();
+    void calculateMaxMean();
+    void calculateMaxMeanEarlyOut();
 
     void deltaImage();
     void deltaImageScaling();
@@ -62,6 +65,11 @@ struct CompareImageTest: TestSuite::Tester {
     void compareAboveThresholds();
     void compareAboveMaxThreshold();
     void compareAboveMeanThreshold();
+    void compareAboveMaxThresholdEarlyOut();
+    void compareBelowMaxThresholdEarlyOut();
+
+    void debugFlag();
+    void debugFlags();
 };
 
 CompareImageTest::CompareImageTest() {
@@ -74,6 +82,9 @@ CompareImageTest::CompareImageTest() {
 
               &CompareImageTest::calculateDelta,
               &CompareImageTest::calculateDeltaStorage,
+              &CompareImageTest::calculateDeltaMultithreaded,
+              &CompareImageTest::calculateMaxMean,
+              &CompareImageTest::calculateMaxMeanEarlyOut,
 
               &CompareImageTest::deltaImage,
               &CompareImageTest::deltaImageScaling,
@@ -87,7 +98,12 @@ CompareImageTest::CompareImageTest() {
               &CompareImageTest::compareSameZeroThreshold,
               &CompareImageTest::compareAboveThresholds,
               &CompareImageTest::compareAboveMaxThreshold,
-              &CompareImageTest::compareAboveMeanThreshold});
+              &CompareImageTest::compareAboveMeanThreshold,
+              &CompareImageTest::compareAboveMaxThresholdEarlyOut,
+              &CompareImageTest::compareBelowMaxThresholdEarlyOut,
+
+              &CompareImageTest::debugFlag,
+              &CompareImageTest::debugFlags});
 }
 
 namespace {
@@ -199,6 +215,49 @@ void CompareImageTest::calculateDeltaStorage() {
     CORRADE_COMPARE(mean, 18.5f);
 }
 
+void CompareImageTest::calculateDeltaMultithreaded() {
+    /* Enough rows to be split into multiple tasks, with a non-trivial stride */
+    UnsignedByte actualData[4*7*37];
+    UnsignedByte expectedData[4*7*37];
+    for(std::size_t i = 0; i != sizeof(actualData); ++i) {
+        actualData[i] = UnsignedByte(i*7);
+        expectedData[i] = UnsignedByte(i*13 + i/5);
+    }
+
+    const ImageView2D actual{PixelFormat::RGB8Unorm, {7, 37}, actualData};
+    const ImageView2D expected{PixelFormat::RGB8Unorm, {7, 37}, expectedData};
+
+    std::vector<Float> delta, deltaMultithreaded;
+    Float max, mean, maxMultithreaded, meanMultithreaded;
+    std::tie(delta, max, mean) = Implementation::calculateImageDelta(actual, expected);
+    std::tie(deltaMultithreaded, maxMultithreaded, meanMultithreaded) = Implementation::calculateImageDelta(actual, expected, 4);
+
+    CORRADE_COMPARE(delta.size(), 7*37);
+    CORRADE_COMPARE_AS(deltaMultithreaded, delta, TestSuite::Compare::Container);
+    CORRADE_COMPARE(maxMultithreaded, max);
+    CORRADE_COMPARE(meanMultithreaded, mean);
+}
+
+void CompareImageTest::calculateMaxMean() {
+    Float max, mean;
+    bool complete;
+    std::tie(max, mean, complete) = Implementation::calculateImageMaxMean(ActualRed, ExpectedRed, Constants::inf());
+
+    CORRADE_VERIFY(complete);
+    CORRADE_COMPARE(max, 1.0f);
+    CORRADE_COMPARE(mean, 0.208889f);
+}
+
+void CompareImageTest::calculateMaxMeanEarlyOut() {
+    Float max, mean;
+    bool complete;
+    std::tie(max, mean, complete) = Implementation::calculateImageMaxMean(ActualRed, ExpectedRed, 0.5f);
+
+    CORRADE_VERIFY(!complete);
+    CORRADE_COMPARE(max, 1.0f);
+    CORRADE_VERIFY(mean != mean);
+}
+
 void CompareImageTest::deltaImage() {
     std::ostringstream out;
     Debug d{&out, Debug::Flag::DisableColors};
@@ -399,6 +458,42 @@ void CompareImageTest::compareAboveMeanThreshold() {
         "          [1,0] #5647ec, expected #5610ed (Δ = 18.6667)\n");
 }
 
+void CompareImageTest::compareAboveMaxThresholdEarlyOut() {
+    std::stringstream out;
+
+    {
+        TestSuite::Comparator<CompareImage> compare{30.0f, 20.0f, CompareImageFlag::MaxThresholdEarlyOut};
+        CORRADE_VERIFY(!compare(ActualRgb, ExpectedRgb));
+        Debug d{&out, Debug::Flag::DisableColors};
+        compare.printErrorMessage(d, "a", "b");
+    }
+
+    CORRADE_COMPARE(out.str(),
+        "Images a and b have max delta above threshold, actual at least 39 but at most 30 expected. Mean delta and delta image not calculated due to early out.\n");
+}
+
+void CompareImageTest::compareBelowMaxThresholdEarlyOut() {
+    /* The early out doesn't affect the mean threshold check */
+    TestSuite::Comparator<CompareImage> compare{40.0f, 18.0f, CompareImageFlag::MaxThresholdEarlyOut, 2};
+    CORRADE_VERIFY(!compare(ActualRgb, ExpectedRgb));
+
+    CORRADE_VERIFY((TestSuite::Comparator<CompareImage>{40.0f, 20.0f, CompareImageFlag::MaxThresholdEarlyOut, 2}(ActualRgb, ExpectedRgb)));
+}
+
+void CompareImageTest::debugFlag() {
+    std::ostringstream out;
+
+    Debug{&out} << CompareImageFlag::MaxThresholdEarlyOut << CompareImageFlag(0xf0);
+    CORRADE_COMPARE(out.str(), "DebugTools::CompareImageFlag::MaxThresholdEarlyOut DebugTools::CompareImageFlag(0xf0)\n");
+}
+
+void CompareImageTest::debugFlags() {
+    std::ostringstream out;
+
+    Debug{&out} << CompareImageFlags{CompareImageFlag::MaxThresholdEarlyOut} << CompareImageFlags{};
+    CORRADE_COMPARE(out.str(), "DebugTools::CompareImageFlag::MaxThresholdEarlyOut DebugTools::CompareImageFlags{}\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::DebugTools::Test::CompareImageTest)
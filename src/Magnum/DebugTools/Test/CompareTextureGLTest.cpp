@@ -0,0 +1,233 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/DebugTools/CompareTexture.h"
+#include "Magnum/DebugTools/TextureDelta.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct CompareTextureGLTest: GL::OpenGLTester {
+    explicit CompareTextureGLTest();
+
+    void delta();
+    void deltaFloat();
+    void deltaImage();
+
+    void compareSame();
+    void compareAboveThresholds();
+    #ifndef MAGNUM_TARGET_GLES
+    void compareDifferentSize();
+    #endif
+};
+
+CompareTextureGLTest::CompareTextureGLTest() {
+    addTests({&CompareTextureGLTest::delta,
+              &CompareTextureGLTest::deltaFloat,
+              &CompareTextureGLTest::deltaImage,
+
+              &CompareTextureGLTest::compareSame,
+              &CompareTextureGLTest::compareAboveThresholds,
+              #ifndef MAGNUM_TARGET_GLES
+              &CompareTextureGLTest::compareDifferentSize,
+              #endif
+              });
+}
+
+namespace {
+    constexpr UnsignedByte ActualRgbaData[] = {
+        0x56, 0xf8, 0x3a, 0xff, 0x56, 0x47, 0xec, 0xff,
+        0x23, 0x57, 0x10, 0xff, 0xab, 0xcd, 0x85, 0xff
+    };
+
+    constexpr UnsignedByte ExpectedRgbaData[] = {
+        0x55, 0xf8, 0x3a, 0xff, 0x56, 0x10, 0xed, 0xff,
+        0x23, 0x27, 0x10, 0xff, 0xab, 0xcd, 0xfa, 0xff
+    };
+
+    const ImageView2D ActualRgba{PixelFormat::RGBA8Unorm, {2, 2}, ActualRgbaData};
+    const ImageView2D ExpectedRgba{PixelFormat::RGBA8Unorm, {2, 2}, ExpectedRgbaData};
+
+    /* Odd size to test the reduction of the last rows / columns */
+    constexpr Float ActualRedData[] = {
+         0.3f, 1.0f, 0.9f,
+         0.9f, 0.6f, 0.2f,
+        -0.1f, 1.0f, 0.0f
+    };
+
+    constexpr Float ExpectedRedData[] = {
+        0.65f, 1.0f, 0.6f,
+        0.91f, 0.6f, 0.1f,
+        0.02f, 0.0f, 0.0f
+    };
+
+    constexpr Float DeltaRedData[] = {
+        0.35f, 0.0f, 0.3f,
+        0.01f, 0.0f, 0.1f,
+        0.12f, 1.0f, 0.0f
+    };
+
+    const ImageView2D ActualRed{PixelFormat::R32F, {3, 3}, ActualRedData};
+    const ImageView2D ExpectedRed{PixelFormat::R32F, {3, 3}, ExpectedRedData};
+
+    GL::Texture2D texture(const ImageView2D& image, GL::TextureFormat format) {
+        GL::Texture2D texture;
+        texture.setMinificationFilter(GL::SamplerFilter::Nearest)
+            .setMagnificationFilter(GL::SamplerFilter::Nearest)
+            .setStorage(1, format, image.size())
+            .setSubImage(0, {}, image);
+        return texture;
+    }
+}
+
+void CompareTextureGLTest::delta() {
+    #ifdef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::color_buffer_float>())
+        CORRADE_SKIP(GL::Extensions::EXT::color_buffer_float::string() + std::string(" is not available."));
+    #endif
+
+    GL::Texture2D actual = texture(ActualRgba, GL::TextureFormat::RGBA8);
+    GL::Texture2D expected = texture(ExpectedRgba, GL::TextureFormat::RGBA8);
+
+    Float max, mean;
+    std::tie(max, mean) = textureDelta(actual, expected, {2, 2}, PixelFormat::RGBA8Unorm);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Same as CompareImage would calculate */
+    CORRADE_COMPARE(max, 117.0f/4.0f);
+    CORRADE_COMPARE(mean, (1.0f + 56.0f + 48.0f + 117.0f)/16.0f);
+}
+
+void CompareTextureGLTest::deltaFloat() {
+    #ifdef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::color_buffer_float>())
+        CORRADE_SKIP(GL::Extensions::EXT::color_buffer_float::string() + std::string(" is not available."));
+    #endif
+
+    GL::Texture2D actual = texture(ActualRed, GL::TextureFormat::R32F);
+    GL::Texture2D expected = texture(ExpectedRed, GL::TextureFormat::R32F);
+
+    Float max, mean;
+    std::tie(max, mean) = textureDelta(actual, expected, {3, 3}, PixelFormat::R32F);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(max, 1.0f);
+    CORRADE_COMPARE(mean, 0.208889f);
+}
+
+void CompareTextureGLTest::deltaImage() {
+    #ifdef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::color_buffer_float>())
+        CORRADE_SKIP(GL::Extensions::EXT::color_buffer_float::string() + std::string(" is not available."));
+    #endif
+
+    GL::Texture2D actual = texture(ActualRed, GL::TextureFormat::R32F);
+    GL::Texture2D expected = texture(ExpectedRed, GL::TextureFormat::R32F);
+
+    Image2D delta{PixelFormat::RGBA8Unorm};
+    Float max, mean;
+    std::tie(max, mean) = textureDelta(actual, expected, {3, 3}, PixelFormat::R32F, delta);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(max, 1.0f);
+    CORRADE_COMPARE(mean, 0.208889f);
+    CORRADE_COMPARE(delta.format(), PixelFormat::R32F);
+    CORRADE_COMPARE(delta.size(), (Vector2i{3, 3}));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(delta.data()),
+        Containers::arrayView(DeltaRedData), TestSuite::Compare::Container);
+}
+
+void CompareTextureGLTest::compareSame() {
+    #ifdef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::color_buffer_float>())
+        CORRADE_SKIP(GL::Extensions::EXT::color_buffer_float::string() + std::string(" is not available."));
+    #endif
+
+    GL::Texture2D actual = texture(ExpectedRgba, GL::TextureFormat::RGBA8);
+
+    CORRADE_VERIFY((TestSuite::Comparator<CompareTexture>{0.0f, 0.0f}(actual, ExpectedRgba)));
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void CompareTextureGLTest::compareAboveThresholds() {
+    #ifdef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::color_buffer_float>())
+        CORRADE_SKIP(GL::Extensions::EXT::color_buffer_float::string() + std::string(" is not available."));
+    #endif
+
+    GL::Texture2D actual = texture(ActualRgba, GL::TextureFormat::RGBA8);
+
+    std::stringstream out;
+    {
+        TestSuite::Comparator<CompareTexture> compare{20.0f, 10.0f};
+        CORRADE_VERIFY(!compare(actual, ExpectedRgba));
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        Debug d{&out, Debug::Flag::DisableColors};
+        compare.printErrorMessage(d, "a", "b");
+    }
+
+    /* The diagnostic is the same as when comparing the images on the CPU */
+    std::stringstream expected;
+    {
+        TestSuite::Comparator<CompareImage> compare{20.0f, 10.0f};
+        CORRADE_VERIFY(!compare(ActualRgba, ExpectedRgba));
+        Debug d{&expected, Debug::Flag::DisableColors};
+        compare.printErrorMessage(d, "a", "b");
+    }
+
+    CORRADE_COMPARE(out.str(), expected.str());
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void CompareTextureGLTest::compareDifferentSize() {
+    GL::Texture2D actual = texture(ActualRed, GL::TextureFormat::R32F);
+    const ImageView2D expected{PixelFormat::R32F, {2, 3}, ExpectedRedData};
+
+    std::stringstream out;
+    {
+        TestSuite::Comparator<CompareTexture> compare;
+        CORRADE_VERIFY(!compare(actual, expected));
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        Debug d{&out, Debug::Flag::DisableColors};
+        compare.printErrorMessage(d, "a", "b");
+    }
+
+    CORRADE_COMPARE(out.str(), "Images a and b have different size, actual Vector(3, 3) but Vector(2, 3) expected.\n");
+}
+#endif
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::CompareTextureGLTest)
@@ -0,0 +1,161 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/DebugTools/DeferredReadback.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderer.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct DeferredReadbackGLTest: Magnum::GL::OpenGLTester {
+    explicit DeferredReadbackGLTest();
+
+    void construct();
+    void constructNoCreate();
+    void constructMove();
+
+    void read();
+    void readSubData();
+    void readFull();
+};
+
+DeferredReadbackGLTest::DeferredReadbackGLTest() {
+    addTests({&DeferredReadbackGLTest::construct,
+              &DeferredReadbackGLTest::constructNoCreate,
+              &DeferredReadbackGLTest::constructMove,
+
+              &DeferredReadbackGLTest::read,
+              &DeferredReadbackGLTest::readSubData,
+              &DeferredReadbackGLTest::readFull});
+}
+
+namespace {
+    constexpr Int Data[] = {2, 7, 5, 13, 25};
+}
+
+void DeferredReadbackGLTest::construct() {
+    DeferredReadback readback{4};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(readback.frameCount(), 4);
+    CORRADE_COMPARE(readback.pendingCount(), 0);
+    CORRADE_VERIFY(!readback.isReady());
+    CORRADE_VERIFY(!readback.data());
+}
+
+void DeferredReadbackGLTest::constructNoCreate() {
+    DeferredReadback readback{NoCreate};
+    CORRADE_COMPARE(readback.frameCount(), 0);
+    CORRADE_VERIFY(!readback.isReady());
+}
+
+void DeferredReadbackGLTest::constructMove() {
+    GL::Buffer buffer;
+    buffer.setData(Data, GL::BufferUsage::StaticDraw);
+
+    DeferredReadback a{2};
+    CORRADE_VERIFY(a.read(buffer));
+
+    DeferredReadback b{std::move(a)};
+    CORRADE_COMPARE(a.frameCount(), 0);
+    CORRADE_COMPARE(b.frameCount(), 2);
+    CORRADE_COMPARE(b.pendingCount(), 1);
+
+    DeferredReadback c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(c.frameCount(), 2);
+    CORRADE_COMPARE(c.pendingCount(), 1);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void DeferredReadbackGLTest::read() {
+    GL::Buffer buffer;
+    buffer.setData(Data, GL::BufferUsage::StaticDraw);
+
+    DeferredReadback readback;
+    CORRADE_VERIFY(readback.read(buffer));
+    CORRADE_COMPARE(readback.pendingCount(), 1);
+
+    GL::Renderer::finish();
+    CORRADE_VERIFY(readback.isReady());
+
+    Containers::Optional<Containers::Array<char>> data = readback.data();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Int>(*data), Containers::arrayView(Data),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(readback.pendingCount(), 0);
+    CORRADE_VERIFY(!readback.data());
+}
+
+void DeferredReadbackGLTest::readSubData() {
+    GL::Buffer buffer;
+    buffer.setData(Data, GL::BufferUsage::StaticDraw);
+
+    DeferredReadback readback;
+    CORRADE_VERIFY(readback.read(buffer, 4, 12));
+    GL::Renderer::finish();
+
+    Containers::Optional<Containers::Array<char>> data = readback.data();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Int>(*data), Containers::arrayView(Data).slice(1, 4),
+        TestSuite::Compare::Container);
+}
+
+void DeferredReadbackGLTest::readFull() {
+    GL::Buffer buffer;
+    buffer.setData(Data, GL::BufferUsage::StaticDraw);
+
+    DeferredReadback readback{2};
+    CORRADE_VERIFY(readback.read(buffer, 0, 4));
+    CORRADE_VERIFY(readback.read(buffer, 16, 4));
+
+    /* All staging buffers are pending, nothing is queued */
+    CORRADE_VERIFY(!readback.read(buffer));
+    CORRADE_COMPARE(readback.pendingCount(), 2);
+
+    /* The readbacks are retrieved in order and free the staging buffer again */
+    GL::Renderer::finish();
+    Containers::Optional<Containers::Array<char>> first = readback.data();
+    CORRADE_VERIFY(first);
+    CORRADE_COMPARE(Containers::arrayCast<const Int>(*first)[0], 2);
+    CORRADE_VERIFY(readback.read(buffer, 8, 4));
+
+    GL::Renderer::finish();
+    Containers::Optional<Containers::Array<char>> second = readback.data();
+    Containers::Optional<Containers::Array<char>> third = readback.data();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(second);
+    CORRADE_VERIFY(third);
+    CORRADE_COMPARE(Containers::arrayCast<const Int>(*second)[0], 25);
+    CORRADE_COMPARE(Containers::arrayCast<const Int>(*third)[0], 5);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::DeferredReadbackGLTest)
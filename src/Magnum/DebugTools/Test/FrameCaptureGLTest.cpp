@@ -0,0 +1,196 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <mutex>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/DebugTools/FrameCapture.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Color.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct FrameCaptureGLTest: Magnum::GL::OpenGLTester {
+    explicit FrameCaptureGLTest();
+
+    void construct();
+    void constructNoCreate();
+    void constructMove();
+
+    void captureRGBA8();
+    void captureNV12();
+    void captureOrder();
+};
+
+FrameCaptureGLTest::FrameCaptureGLTest() {
+    addTests({&FrameCaptureGLTest::construct,
+              &FrameCaptureGLTest::constructNoCreate,
+              &FrameCaptureGLTest::constructMove,
+
+              &FrameCaptureGLTest::captureRGBA8,
+              &FrameCaptureGLTest::captureNV12,
+              &FrameCaptureGLTest::captureOrder});
+}
+
+namespace {
+    /* Bottom row first, as OpenGL has it */
+    constexpr Color4ub Data[]{
+        {0x00, 0x00, 0x00, 0xff}, {0x00, 0x00, 0x00, 0xff},
+        {0x00, 0x00, 0x00, 0xff}, {0x00, 0x00, 0x00, 0xff},
+        {0xff, 0xff, 0xff, 0xff}, {0xff, 0xff, 0xff, 0xff},
+        {0xff, 0x00, 0x00, 0xff}, {0xff, 0x00, 0x00, 0xff}
+    };
+
+    GL::Texture2D texture() {
+        GL::Texture2D texture;
+        texture.setMinificationFilter(GL::SamplerFilter::Nearest)
+            .setMagnificationFilter(GL::SamplerFilter::Nearest)
+            .setStorage(1, GL::TextureFormat::RGBA8, {4, 2})
+            .setSubImage(0, {}, ImageView2D{PixelFormat::RGBA8Unorm, {4, 2}, Data});
+        return texture;
+    }
+
+    struct Frames {
+        std::mutex mutex;
+        std::vector<std::vector<UnsignedByte>> data;
+        std::vector<UnsignedLong> indices;
+    };
+
+    FrameCapture::Consumer collect(Frames& frames) {
+        return [&frames](Containers::ArrayView<const char> data, UnsignedLong frame) {
+            std::lock_guard<std::mutex> lock{frames.mutex};
+            frames.data.emplace_back(reinterpret_cast<const UnsignedByte*>(data.begin()), reinterpret_cast<const UnsignedByte*>(data.end()));
+            frames.indices.push_back(frame);
+        };
+    }
+}
+
+void FrameCaptureGLTest::construct() {
+    FrameCapture capture{{1920, 1080}, FrameCapture::Format::NV12, [](Containers::ArrayView<const char>, UnsignedLong) {}, 2, 5};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(capture.size(), (Vector2i{1920, 1080}));
+    CORRADE_COMPARE(capture.format(), FrameCapture::Format::NV12);
+    CORRADE_COMPARE(capture.frameDataSize(), 1920*1080*3/2);
+    CORRADE_COMPARE(capture.frameCount(), 2);
+    CORRADE_COMPARE(capture.queueSize(), 5);
+    CORRADE_COMPARE(capture.capturedCount(), 0);
+    CORRADE_COMPARE(capture.consumedCount(), 0);
+}
+
+void FrameCaptureGLTest::constructNoCreate() {
+    FrameCapture capture{NoCreate};
+    CORRADE_COMPARE(capture.size(), Vector2i{});
+    CORRADE_COMPARE(capture.frameDataSize(), 0);
+    CORRADE_COMPARE(capture.frameCount(), 0);
+}
+
+void FrameCaptureGLTest::constructMove() {
+    Frames frames;
+    GL::Texture2D input = texture();
+
+    FrameCapture a{{4, 2}, FrameCapture::Format::RGBA8Unorm, collect(frames)};
+    a.capture(input);
+
+    FrameCapture b{std::move(a)};
+    CORRADE_COMPARE(a.frameCount(), 0);
+    CORRADE_COMPARE(b.frameCount(), 3);
+    CORRADE_COMPARE(b.capturedCount(), 1);
+
+    FrameCapture c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(c.frameCount(), 3);
+    CORRADE_COMPARE(c.capturedCount(), 1);
+
+    c.flush();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(c.consumedCount(), 1);
+    CORRADE_COMPARE(frames.data.size(), 1);
+}
+
+void FrameCaptureGLTest::captureRGBA8() {
+    Frames frames;
+    GL::Texture2D input = texture();
+
+    FrameCapture capture{{4, 2}, FrameCapture::Format::RGBA8Unorm, collect(frames)};
+    capture.capture(input);
+    capture.flush();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Top row first */
+    CORRADE_COMPARE(frames.data.size(), 1);
+    CORRADE_COMPARE_AS(frames.data[0], (std::vector<UnsignedByte>{
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+        0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+        0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff
+    }), TestSuite::Compare::Container);
+}
+
+void FrameCaptureGLTest::captureNV12() {
+    Frames frames;
+    GL::Texture2D input = texture();
+
+    FrameCapture capture{{4, 2}, FrameCapture::Format::NV12, collect(frames)};
+    capture.capture(input);
+    capture.flush();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Luma of white is 235, black 16 and red 16 + 219*0.2126. The chroma of
+       the left 2x2 block is neutral, the right block is half red. */
+    CORRADE_COMPARE(frames.data.size(), 1);
+    CORRADE_COMPARE_AS(frames.data[0], (std::vector<UnsignedByte>{
+        235, 235, 63, 63,
+        16, 16, 16, 16,
+        128, 128, 115, 184
+    }), TestSuite::Compare::Container);
+}
+
+void FrameCaptureGLTest::captureOrder() {
+    Frames frames;
+    GL::Texture2D input = texture();
+
+    /* Fewer buffers than frames so both the readback ring and the queue
+       have to wait */
+    FrameCapture capture{{4, 2}, FrameCapture::Format::RGBA8Unorm, collect(frames), 2, 1};
+    for(std::size_t i = 0; i != 5; ++i) capture.capture(input);
+    CORRADE_COMPARE(capture.capturedCount(), 5);
+
+    capture.flush();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(capture.consumedCount(), 5);
+    CORRADE_COMPARE_AS(frames.indices, (std::vector<UnsignedLong>{0, 1, 2, 3, 4}),
+        TestSuite::Compare::Container);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::FrameCaptureGLTest)
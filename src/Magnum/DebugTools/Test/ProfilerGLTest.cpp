@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Magnum/DebugTools/Profiler.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/DefaultFramebuffer.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderer.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct ProfilerGLTest: GL::OpenGLTester {
+    explicit ProfilerGLTest();
+
+    void noGpuQueries();
+    void timeElapsed();
+    #ifndef MAGNUM_TARGET_GLES
+    void samplesPassed();
+    #endif
+};
+
+ProfilerGLTest::ProfilerGLTest() {
+    addTests({&ProfilerGLTest::noGpuQueries,
+              &ProfilerGLTest::timeElapsed,
+              #ifndef MAGNUM_TARGET_GLES
+              &ProfilerGLTest::samplesPassed
+              #endif
+              });
+}
+
+void ProfilerGLTest::noGpuQueries() {
+    Profiler p;
+    Profiler::Section section = p.addSection("Clear");
+    CORRADE_VERIFY(!p.gpuQueries());
+
+    p.enable();
+    for(std::size_t i = 0; i != 5; ++i) {
+        p.start(section);
+        GL::defaultFramebuffer.clear(GL::FramebufferClear::Color);
+        p.stop();
+        p.nextFrame();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(p.gpuFrameCount(), 0);
+    CORRADE_COMPARE(p.gpuDuration(section).count(), 0);
+}
+
+void ProfilerGLTest::timeElapsed() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::timer_query>())
+        CORRADE_SKIP(GL::Extensions::ARB::timer_query::string() + std::string(" is not available."));
+    #else
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::disjoint_timer_query>())
+        CORRADE_SKIP(GL::Extensions::EXT::disjoint_timer_query::string() + std::string(" is not available."));
+    #endif
+
+    Profiler p;
+    Profiler::Section section = p.addSection("Clear");
+    p.setMeasureDuration(4);
+    p.setGpuQueries(Profiler::GpuQuery::TimeElapsed);
+    p.enable();
+
+    /* No results are retrieved until the latency passes */
+    for(std::size_t i = 0; i != Profiler::GpuLatency - 1; ++i) {
+        p.start(section);
+        GL::defaultFramebuffer.clear(GL::FramebufferClear::Color);
+        p.start();
+        p.nextFrame();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(p.gpuFrameCount(), 0);
+
+    /* Make sure the results are available, then the next frame collects
+       them */
+    GL::Renderer::finish();
+    p.nextFrame();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(p.gpuFrameCount(), 1);
+
+    /* The window is limited by measure duration */
+    for(std::size_t i = 0; i != 10; ++i) {
+        p.start(section);
+        GL::defaultFramebuffer.clear(GL::FramebufferClear::Color);
+        p.start();
+        GL::Renderer::finish();
+        p.nextFrame();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(p.gpuFrameCount(), 3);
+
+    std::ostringstream out;
+    {
+        Debug redirectOutput{&out};
+        p.printStatistics();
+    }
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(out.str().find(u8"µs GPU") != std::string::npos);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void ProfilerGLTest::samplesPassed() {
+    Profiler p;
+    Profiler::Section section = p.addSection("Clear");
+    p.setMeasureDuration(4);
+    p.setGpuQueries(Profiler::GpuQuery::SamplesPassed);
+    p.enable();
+
+    /* Clearing doesn't pass any samples through the fragment shader */
+    for(std::size_t i = 0; i != Profiler::GpuLatency + 1; ++i) {
+        p.start(section);
+        GL::defaultFramebuffer.clear(GL::FramebufferClear::Color);
+        p.stop();
+        GL::Renderer::finish();
+        p.nextFrame();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(p.gpuFrameCount(), 2);
+    CORRADE_COMPARE(p.samplesPassed(section), 0);
+    CORRADE_COMPARE(p.gpuDuration(section).count(), 0);
+}
+#endif
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::ProfilerGLTest)
@@ -0,0 +1,237 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/DebugTools/Profiler.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct ProfilerTest: TestSuite::Tester {
+    explicit ProfilerTest();
+
+    void traceSections();
+    void traceScope();
+    void traceScopeNotEnabled();
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void traceThreads();
+    #endif
+    void traceCallback();
+    void traceClear();
+    void chromeTrace();
+};
+
+ProfilerTest::ProfilerTest() {
+    addTests({&ProfilerTest::traceSections,
+              &ProfilerTest::traceScope,
+              &ProfilerTest::traceScopeNotEnabled,
+              #ifndef CORRADE_TARGET_EMSCRIPTEN
+              &ProfilerTest::traceThreads,
+              #endif
+              &ProfilerTest::traceCallback,
+              &ProfilerTest::traceClear,
+              &ProfilerTest::chromeTrace});
+}
+
+void ProfilerTest::traceSections() {
+    Profiler p;
+    Profiler::Section a = p.addSection("A");
+    Profiler::Section b = p.addSection("B");
+    CORRADE_VERIFY(!p.isTraceEnabled());
+    p.setTraceEnabled(true);
+    CORRADE_VERIFY(p.isTraceEnabled());
+    p.enable();
+
+    for(std::size_t i = 0; i != 2; ++i) {
+        p.start(a);
+        p.start(b);
+        p.start();
+        p.nextFrame();
+    }
+    p.stop();
+
+    /* The "other" section is running across frame boundaries, so it's
+       attributed to the frame in which it ended */
+    std::vector<Profiler::TraceEvent> events = p.traceEvents();
+    CORRADE_COMPARE(events.size(), 6);
+    CORRADE_COMPARE(events[0].name, "A");
+    CORRADE_COMPARE(events[0].frame, 0);
+    CORRADE_COMPARE(events[1].name, "B");
+    CORRADE_COMPARE(events[1].frame, 0);
+    CORRADE_COMPARE(events[2].name, "Other");
+    CORRADE_COMPARE(events[2].frame, 1);
+    CORRADE_COMPARE(events[3].name, "A");
+    CORRADE_COMPARE(events[3].frame, 1);
+    CORRADE_COMPARE(events[5].name, "Other");
+    CORRADE_COMPARE(events[5].frame, 2);
+
+    for(std::size_t i = 0; i != events.size(); ++i) {
+        CORRADE_COMPARE(events[i].thread, 0);
+        CORRADE_VERIFY(events[i].begin.count() >= 0);
+        if(i) CORRADE_COMPARE(events[i].begin, events[i - 1].begin + events[i - 1].duration);
+    }
+}
+
+void ProfilerTest::traceScope() {
+    Profiler p;
+    p.setTraceEnabled(true);
+    p.enable();
+
+    {
+        Profiler::Scope outer{p, "Outer"};
+        {
+            Profiler::Scope inner{p, "Inner"};
+        }
+    }
+
+    /* Events are ordered by their end */
+    std::vector<Profiler::TraceEvent> events = p.traceEvents();
+    CORRADE_COMPARE(events.size(), 2);
+    CORRADE_COMPARE(events[0].name, "Inner");
+    CORRADE_COMPARE(events[1].name, "Outer");
+    CORRADE_VERIFY(events[1].begin <= events[0].begin);
+    CORRADE_VERIFY(events[1].begin + events[1].duration >= events[0].begin + events[0].duration);
+}
+
+void ProfilerTest::traceScopeNotEnabled() {
+    Profiler p;
+    p.setTraceEnabled(true);
+
+    {
+        Profiler::Scope scope{p, "Scope"};
+    }
+    CORRADE_VERIFY(p.traceEvents().empty());
+
+    /* Tracing not enabled */
+    Profiler q;
+    q.enable();
+    {
+        Profiler::Scope scope{q, "Scope"};
+    }
+    CORRADE_VERIFY(q.traceEvents().empty());
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void ProfilerTest::traceThreads() {
+    Profiler p;
+    p.setTraceEnabled(true);
+    p.enable();
+
+    {
+        Profiler::Scope scope{p, "Main"};
+    }
+    std::thread{[&p]() {
+        Profiler::Scope scope{p, "Worker"};
+    }}.join();
+    {
+        Profiler::Scope scope{p, "Main again"};
+    }
+
+    std::vector<Profiler::TraceEvent> events = p.traceEvents();
+    CORRADE_COMPARE(events.size(), 3);
+    CORRADE_COMPARE(events[0].thread, 0);
+    CORRADE_COMPARE(events[1].name, "Worker");
+    CORRADE_COMPARE(events[1].thread, 1);
+    CORRADE_COMPARE(events[2].thread, 0);
+}
+#endif
+
+void ProfilerTest::traceCallback() {
+    Profiler p;
+    std::vector<std::string> names;
+    p.setTraceCallback([](const Profiler::TraceEvent& event, void* userData) {
+        static_cast<std::vector<std::string>*>(userData)->push_back(event.name);
+    }, &names);
+    p.enable();
+
+    {
+        Profiler::Scope scope{p, "Scope"};
+    }
+    p.start();
+    p.stop();
+
+    /* The events are only streamed, not stored */
+    CORRADE_COMPARE(names, (std::vector<std::string>{"Scope", "Other"}));
+    CORRADE_VERIFY(p.traceEvents().empty());
+
+    /* Resetting the callback */
+    p.setTraceCallback(nullptr);
+    {
+        Profiler::Scope scope{p, "Scope"};
+    }
+    CORRADE_COMPARE(names.size(), 2);
+}
+
+void ProfilerTest::traceClear() {
+    Profiler p;
+    p.setTraceEnabled(true);
+    p.enable();
+
+    {
+        Profiler::Scope scope{p, "Scope"};
+    }
+    p.nextFrame();
+    CORRADE_COMPARE(p.traceEvents().size(), 1);
+
+    /* The frame counter is kept */
+    p.clearTrace();
+    CORRADE_VERIFY(p.traceEvents().empty());
+    {
+        Profiler::Scope scope{p, "Scope"};
+    }
+    CORRADE_COMPARE(p.traceEvents().size(), 1);
+    CORRADE_COMPARE(p.traceEvents()[0].frame, 1);
+
+    /* Enabling again resets everything */
+    p.enable();
+    CORRADE_VERIFY(p.traceEvents().empty());
+    {
+        Profiler::Scope scope{p, "Scope"};
+    }
+    CORRADE_COMPARE(p.traceEvents()[0].frame, 0);
+}
+
+void ProfilerTest::chromeTrace() {
+    Profiler p;
+    p.setTraceEnabled(true);
+    CORRADE_COMPARE(p.chromeTrace(), "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    p.enable();
+    {
+        Profiler::Scope scope{p, "Quoted \"name\"\\\n"};
+    }
+
+    const std::string trace = p.chromeTrace();
+    CORRADE_VERIFY(trace.find("{\"name\":\"Quoted \\\"name\\\"\\\\\\n\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":") != std::string::npos);
+    CORRADE_VERIFY(trace.find(",\"args\":{\"frame\":0}}\n],\"displayTimeUnit\":\"ms\"}\n") != std::string::npos);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::ProfilerTest)
@@ -0,0 +1,253 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TextureDelta.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/GL/Version.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector4.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+static void importDebugToolsResources() {
+    CORRADE_RESOURCE_INITIALIZE(MagnumDebugTools_RESOURCES)
+}
+#endif
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+class TextureDeltaShader: public GL::AbstractShaderProgram {
+    public:
+        explicit TextureDeltaShader(bool delta);
+
+        TextureDeltaShader& setChannelScale(const Vector4& scale) {
+            setUniform(channelScaleUniform, scale);
+            return *this;
+        }
+
+        TextureDeltaShader& setDestinationSize(const Vector2i& size) {
+            setUniform(destinationSizeUniform, size);
+            return *this;
+        }
+
+        TextureDeltaShader& bindTextures(GL::Texture2D& actual, GL::Texture2D& expected) {
+            actual.bind(ActualTextureUnit);
+            expected.bind(ExpectedTextureUnit);
+            return *this;
+        }
+
+        TextureDeltaShader& bindSourceTexture(GL::Texture2D& texture) {
+            texture.bind(SourceTextureUnit);
+            return *this;
+        }
+
+    private:
+        enum: Int {
+            ActualTextureUnit = 0,
+            ExpectedTextureUnit = 1,
+            SourceTextureUnit = 0
+        };
+
+        Int channelScaleUniform{-1},
+            destinationSizeUniform{-1};
+};
+
+TextureDeltaShader::TextureDeltaShader(const bool delta) {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumDebugTools"))
+        importDebugToolsResources();
+    #endif
+    Utility::Resource rs{"MagnumDebugTools"};
+
+    #ifndef MAGNUM_TARGET_GLES
+    const GL::Version version = GL::Version::GL300;
+    #else
+    const GL::Version version = GL::Version::GLES300;
+    #endif
+
+    /* The vertex shader is the same full-screen triangle as used for float
+       texture readback on ES */
+    GL::Shader vert{version, GL::Shader::Type::Vertex};
+    GL::Shader frag{version, GL::Shader::Type::Fragment};
+    vert.addSource(rs.get("TextureImage.vert"));
+    frag.addSource(delta ? "#define DELTA\n" : "")
+        .addSource(rs.get("TextureDelta.frag"));
+
+    CORRADE_INTERNAL_ASSERT(GL::Shader::compile({vert, frag}));
+    attachShaders({vert, frag});
+
+    CORRADE_INTERNAL_ASSERT(link());
+
+    if(delta) {
+        channelScaleUniform = uniformLocation("channelScale");
+        setUniform(uniformLocation("actualTexture"), ActualTextureUnit);
+        setUniform(uniformLocation("expectedTexture"), ExpectedTextureUnit);
+    } else {
+        destinationSizeUniform = uniformLocation("destinationSize");
+        setUniform(uniformLocation("sourceTexture"), SourceTextureUnit);
+    }
+}
+
+/* RG float readback is not guaranteed in ES, only RGBA, so read four
+   components there and pick the first two */
+Containers::Array<Vector2> readMaxSum(GL::Framebuffer& framebuffer, const Vector2i& size) {
+    Containers::Array<Vector2> out{Containers::NoInit, std::size_t(size.product())};
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image = framebuffer.read({{}, size}, {PixelFormat::RG32F});
+    const Vector2* const in = image.data<Vector2>();
+    for(std::size_t i = 0; i != out.size(); ++i) out[i] = in[i];
+    #else
+    Image2D image = framebuffer.read({{}, size}, {PixelFormat::RGBA32F});
+    const Vector4* const in = image.data<Vector4>();
+    for(std::size_t i = 0; i != out.size(); ++i) out[i] = in[i].xy();
+    #endif
+    return out;
+}
+
+std::pair<Float, Float> textureDeltaInternal(GL::Texture2D& actual, GL::Texture2D& expected, const Vector2i& size, const PixelFormat format, Image2D* const delta) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::framebuffer_object);
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    #endif
+
+    CORRADE_ASSERT(size.product(),
+        "DebugTools::textureDelta(): expected non-empty size but got" << size, {});
+
+    /* Scale the normalized values back to the range CompareImage operates
+       on, divide by the channel count and mask out the channels that are
+       not present */
+    Vector4 channelScale;
+    switch(format) {
+        #define _c(format, scale)                                           \
+            case PixelFormat::format: channelScale = scale; break;
+        _c(R8Unorm, (Vector4{255.0f, 0.0f, 0.0f, 0.0f}))
+        _c(RG8Unorm, (Vector4{255.0f, 255.0f, 0.0f, 0.0f}/2.0f))
+        _c(RGB8Unorm, (Vector4{255.0f, 255.0f, 255.0f, 0.0f}/3.0f))
+        _c(RGBA8Unorm, (Vector4{255.0f}/4.0f))
+        _c(R32F, (Vector4{1.0f, 0.0f, 0.0f, 0.0f}))
+        _c(RG32F, (Vector4{1.0f, 1.0f, 0.0f, 0.0f}/2.0f))
+        _c(RGB32F, (Vector4{1.0f, 1.0f, 1.0f, 0.0f}/3.0f))
+        _c(RGBA32F, (Vector4{1.0f}/4.0f))
+        #undef _c
+        default: CORRADE_ASSERT(false,
+            "DebugTools::textureDelta(): unsupported format" << format, {});
+    }
+
+    /** @todo Disable blending and then enable it back (if was previously) */
+
+    TextureDeltaShader deltaShader{true};
+    TextureDeltaShader reduceShader{false};
+
+    /* The positions are generated from gl_VertexID, so there's no buffer */
+    GL::Mesh mesh;
+    mesh.setPrimitive(GL::MeshPrimitive::Triangles)
+        .setCount(3);
+
+    /* Level 0 contains the per-pixel delta in both channels, each following
+       level contains max and sum of the covered pixels of the previous
+       level, down to a single pixel */
+    const Int levelCount = Math::log2(UnsignedInt(size.max())) + 1;
+    GL::Texture2D pyramid;
+    pyramid.setMinificationFilter(GL::SamplerFilter::Nearest, GL::SamplerMipmap::Nearest)
+        .setMagnificationFilter(GL::SamplerFilter::Nearest)
+        .setWrapping(GL::SamplerWrapping::ClampToEdge)
+        .setStorage(levelCount, GL::TextureFormat::RG32F, size);
+
+    Vector2 maxSum;
+    for(Int level = 0; level != levelCount; ++level) {
+        const Vector2i levelSize = Math::max(size >> level, Vector2i{1});
+
+        GL::Framebuffer framebuffer{{{}, levelSize}};
+        framebuffer.attachTexture(GL::Framebuffer::ColorAttachment(0), pyramid, level);
+        framebuffer.bind();
+
+        const GL::Framebuffer::Status status = framebuffer.checkStatus(GL::FramebufferTarget::Draw);
+        if(status != GL::Framebuffer::Status::Complete) {
+            Error() << "DebugTools::textureDelta(): cannot render to an RG32F texture, unexpected framebuffer status"
+                    << status;
+            return {Constants::nan(), Constants::nan()};
+        }
+
+        if(level == 0) {
+            deltaShader.setChannelScale(channelScale)
+                .bindTextures(actual, expected);
+            mesh.draw(deltaShader);
+
+            if(delta) {
+                const Containers::Array<Vector2> deltas = readMaxSum(framebuffer, size);
+                Containers::Array<char> data{Containers::NoInit, deltas.size()*sizeof(Float)};
+                Float* const out = reinterpret_cast<Float*>(data.data());
+                for(std::size_t i = 0; i != deltas.size(); ++i)
+                    out[i] = deltas[i].x();
+                *delta = Image2D{PixelFormat::R32F, size, std::move(data)};
+            }
+
+        } else {
+            /* Restrict sampling to the previous level so it doesn't form a
+               feedback loop with the level being rendered to */
+            pyramid.setBaseLevel(level - 1)
+                .setMaxLevel(level - 1);
+            reduceShader.setDestinationSize(levelSize)
+                .bindSourceTexture(pyramid);
+            mesh.draw(reduceShader);
+        }
+
+        /* The last level is a single pixel with the final max and sum */
+        if(level == levelCount - 1)
+            maxSum = readMaxSum(framebuffer, Vector2i{1})[0];
+    }
+
+    return {maxSum.x(), maxSum.y()/size.product()};
+}
+
+}
+
+std::pair<Float, Float> textureDelta(GL::Texture2D& actual, GL::Texture2D& expected, const Vector2i& size, const PixelFormat format) {
+    return textureDeltaInternal(actual, expected, size, format, nullptr);
+}
+
+std::pair<Float, Float> textureDelta(GL::Texture2D& actual, GL::Texture2D& expected, const Vector2i& size, const PixelFormat format, Image2D& delta) {
+    return textureDeltaInternal(actual, expected, size, format, &delta);
+}
+
+}}
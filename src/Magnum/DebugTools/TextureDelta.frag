@@ -0,0 +1,68 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef DELTA
+uniform highp sampler2D actualTexture;
+uniform highp sampler2D expectedTexture;
+
+/* Per-channel scale, already divided by the channel count and zero for
+   channels not present in the compared format */
+uniform highp vec4 channelScale;
+#else
+uniform highp ivec2 destinationSize;
+uniform highp sampler2D sourceTexture;
+#endif
+
+out highp vec2 maxSum;
+
+void main() {
+    highp ivec2 coordinates = ivec2(gl_FragCoord.xy);
+
+    #ifdef DELTA
+    /* Max and sum of a single pixel is the pixel delta itself */
+    highp float delta = dot(abs(texelFetch(actualTexture, coordinates, 0) -
+        texelFetch(expectedTexture, coordinates, 0)), channelScale);
+    maxSum = vec2(delta);
+    #else
+    /* Source pixels covered by the destination pixel. Usually a 2x2 block,
+       for odd source sizes the last row / column gets three pixels. Each
+       source pixel is covered by exactly one destination pixel so the sum is
+       not affected. The sampled level is the base level, set by the
+       caller. */
+    highp ivec2 sourceSize = textureSize(sourceTexture, 0);
+    highp ivec2 begin = coordinates*sourceSize/destinationSize;
+    highp ivec2 end = (coordinates + ivec2(1))*sourceSize/destinationSize;
+
+    highp vec2 value = vec2(0.0);
+    for(highp int y = begin.y; y < end.y; ++y) {
+        for(highp int x = begin.x; x < end.x; ++x) {
+            highp vec2 texel = texelFetch(sourceTexture, ivec2(x, y), 0).rg;
+            value = vec2(max(value.x, texel.x), value.y + texel.y);
+        }
+    }
+
+    maxSum = value;
+    #endif
+}
@@ -0,0 +1,100 @@
+#ifndef Magnum_DebugTools_TextureDelta_h
+#define Magnum_DebugTools_TextureDelta_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+/** @file
+ * @brief Function @ref Magnum::DebugTools::textureDelta()
+ */
+#endif
+
+#include <utility>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/DebugTools/visibility.h"
+#include "Magnum/GL/GL.h"
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Calculate max and mean delta of two textures on the GPU
+@param actual       Actual texture
+@param expected     Expected texture
+@param size         Size of the compared area, starting at origin of mip
+    level @cpp 0 @ce of both textures
+@param format       Pixel format the texture values are interpreted as
+@return Max and mean delta
+
+Calculates the per-pixel delta the same way as @ref CompareImage, but on the
+GPU, and then reduces it to max and mean value using a chain of fragment
+shader passes. Only the final two values are read back, which avoids the
+synchronous readback of the whole texture needed for a comparison on the CPU.
+On exit, only the binding of the framebuffer and textures is changed.
+
+The textures are sampled as normalized floating-point values, so for
+@ref PixelFormat::R8Unorm, @ref PixelFormat::RG8Unorm,
+@ref PixelFormat::RGB8Unorm and @ref PixelFormat::RGBA8Unorm the deltas are
+scaled back to the @f$ [0, 255] @f$ range in order to give the same values
+as @ref CompareImage. @ref PixelFormat::R32F, @ref PixelFormat::RG32F,
+@ref PixelFormat::RGB32F and @ref PixelFormat::RGBA32F are used as-is. Other
+formats are not supported. The reduction is calculated in 32-bit floats with
+pairwise summation, so the mean can differ slightly from the value calculated
+by @ref CompareImage.
+
+@requires_gl30 Extension @gl_extension{ARB,framebuffer_object} and
+    @gl_extension{ARB,texture_rg}
+@requires_gles30 Not available in OpenGL ES 2.0 or WebGL 1.0.
+@requires_es_extension Extension @gl_extension{EXT,color_buffer_float} for
+    rendering to the @ref GL::TextureFormat::RG32F intermediate textures
+@requires_webgl_extension Extension @webgl_extension{EXT,color_buffer_float}
+    for rendering to the @ref GL::TextureFormat::RG32F intermediate textures
+
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" enabled (done by default). See
+    @ref building-features for more information.
+*/
+MAGNUM_DEBUGTOOLS_EXPORT std::pair<Float, Float> textureDelta(GL::Texture2D& actual, GL::Texture2D& expected, const Vector2i& size, PixelFormat format);
+
+/**
+@brief Calculate max and mean delta of two textures on the GPU and read back the delta image
+
+Same as @ref textureDelta(GL::Texture2D&, GL::Texture2D&, const Vector2i&, PixelFormat),
+but additionally reads back the per-pixel deltas into @p delta, resizing it
+to @p size and changing its format to @ref PixelFormat::R32F.
+
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" enabled (done by default). See
+    @ref building-features for more information.
+*/
+MAGNUM_DEBUGTOOLS_EXPORT std::pair<Float, Float> textureDelta(GL::Texture2D& actual, GL::Texture2D& expected, const Vector2i& size, PixelFormat format, Image2D& delta);
+
+}}
+#else
+#error this header is available only in the OpenGL build and not available in the OpenGL ES 2.0 and WebGL 1.0 build
+#endif
+
+#endif
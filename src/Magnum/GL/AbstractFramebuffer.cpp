@@ -129,11 +129,16 @@ void AbstractFramebuffer::bindInternal(FramebufferTarget target) {
 
 #ifdef MAGNUM_TARGET_GLES2
 void AbstractFramebuffer::bindImplementationSingle(FramebufferTarget) {
-    Implementation::FramebufferState& state = *Context::current().state().framebuffer;
+    Context& context = Context::current();
+    Implementation::FramebufferState& state = *context.state().framebuffer;
     CORRADE_INTERNAL_ASSERT(state.readBinding == state.drawBinding);
-    if(state.readBinding == _id) return;
+    if(state.readBinding == _id) {
+        ++context.statisticsInternal().elidedBindCount;
+        return;
+    }
 
     state.readBinding = state.drawBinding = _id;
+    ++context.statisticsInternal().bindCount;
 
     /* Binding the framebuffer finally creates it */
     _flags |= ObjectFlag::Created;
@@ -145,16 +150,25 @@ void AbstractFramebuffer::bindImplementationSingle(FramebufferTarget) {
 inline
 #endif
 void AbstractFramebuffer::bindImplementationDefault(FramebufferTarget target) {
-    Implementation::FramebufferState& state = *Context::current().state().framebuffer;
+    Context& context = Context::current();
+    Implementation::FramebufferState& state = *context.state().framebuffer;
 
     if(target == FramebufferTarget::Read) {
-        if(state.readBinding == _id) return;
+        if(state.readBinding == _id) {
+            ++context.statisticsInternal().elidedBindCount;
+            return;
+        }
         state.readBinding = _id;
     } else if(target == FramebufferTarget::Draw) {
-        if(state.drawBinding == _id) return;
+        if(state.drawBinding == _id) {
+            ++context.statisticsInternal().elidedBindCount;
+            return;
+        }
         state.drawBinding = _id;
     } else CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
+    ++context.statisticsInternal().bindCount;
+
     /* Binding the framebuffer finally creates it */
     _flags |= ObjectFlag::Created;
     glBindFramebuffer(GLenum(target), _id);
@@ -172,12 +186,16 @@ FramebufferTarget AbstractFramebuffer::bindInternal() {
 
 #ifdef MAGNUM_TARGET_GLES2
 FramebufferTarget AbstractFramebuffer::bindImplementationSingle() {
-    Implementation::FramebufferState& state = *Context::current().state().framebuffer;
+    Context& context = Context::current();
+    Implementation::FramebufferState& state = *context.state().framebuffer;
     CORRADE_INTERNAL_ASSERT(state.readBinding == state.drawBinding);
 
     /* Bind the framebuffer, if not already */
-    if(state.readBinding != _id) {
+    if(state.readBinding == _id)
+        ++context.statisticsInternal().elidedBindCount;
+    else {
         state.readBinding = state.drawBinding = _id;
+        ++context.statisticsInternal().bindCount;
 
         /* Binding the framebuffer finally creates it */
         _flags |= ObjectFlag::Created;
@@ -196,16 +214,22 @@ FramebufferTarget AbstractFramebuffer::bindImplementationSingle() {
 inline
 #endif
 FramebufferTarget AbstractFramebuffer::bindImplementationDefault() {
-    Implementation::FramebufferState& state = *Context::current().state().framebuffer;
+    Context& context = Context::current();
+    Implementation::FramebufferState& state = *context.state().framebuffer;
 
     /* Return target to which the framebuffer is already bound */
-    if(state.readBinding == _id)
+    if(state.readBinding == _id) {
+        ++context.statisticsInternal().elidedBindCount;
         return FramebufferTarget::Read;
-    if(state.drawBinding == _id)
+    }
+    if(state.drawBinding == _id) {
+        ++context.statisticsInternal().elidedBindCount;
         return FramebufferTarget::Draw;
+    }
 
     /* Or bind it, if not already */
     state.readBinding = _id;
+    ++context.statisticsInternal().bindCount;
 
     /* Binding the framebuffer finally creates it */
     _flags |= ObjectFlag::Created;
@@ -284,7 +284,8 @@ class MAGNUM_GL_EXPORT AbstractFramebuffer {
          * To improve performance you can also use
          * @ref DefaultFramebuffer::invalidate() / @ref Framebuffer::invalidate()
          * instead of clearing given buffer if you will not use it anymore or
-         * fully overwrite it later.
+         * fully overwrite it later. The @ref RenderPass class can take care
+         * of both.
          * @see @ref Renderer::setClearColor(), @ref Renderer::setClearDepth(),
          *      @ref Renderer::setClearStencil(), @fn_gl{BindFramebuffer},
          *      @fn_gl_keyword{Clear}
@@ -382,7 +383,9 @@ class MAGNUM_GL_EXPORT AbstractFramebuffer {
          *
          * See @ref read(const Range2Di&, Image2D&) for more information. The
          * storage is not reallocated if it is large enough to contain the new
-         * data, which means that @p usage might get ignored.
+         * data, which means that @p usage might get ignored. The function
+         * doesn't wait for the data to arrive, see @ref FramebufferReader for
+         * a fence-guarded way to consume them later without stalling.
          * @requires_gles30 Pixel buffer objects are not available in OpenGL ES
          *      2.0.
          * @requires_webgl20 Pixel buffer objects are not available in WebGL
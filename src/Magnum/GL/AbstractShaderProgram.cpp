@@ -27,9 +27,13 @@
 
 #include <Corrade/Containers/Array.h>
 
+#include "Magnum/GL/AbstractTexture.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Shader.h"
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/GL/ProgramBinaryCache.h"
+#endif
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -331,17 +335,57 @@ std::pair<bool, std::string> AbstractShaderProgram::validate() {
     return {success, std::move(message)};
 }
 
+bool AbstractShaderProgram::isLinkFinished() {
+    return (this->*Context::current().state().shaderProgram->isLinkFinishedImplementation)();
+}
+
+bool AbstractShaderProgram::isLinkFinishedImplementationNoOp() { return true; }
+
+#ifndef MAGNUM_TARGET_WEBGL
+bool AbstractShaderProgram::isLinkFinishedImplementationKHR() {
+    GLint finished;
+    glGetProgramiv(_id, GL_COMPLETION_STATUS_KHR, &finished);
+    return finished == GL_TRUE;
+}
+#endif
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+std::pair<GLenum, Containers::Array<char>> AbstractShaderProgram::binary() {
+    GLint size{};
+    glGetProgramiv(_id, GL_PROGRAM_BINARY_LENGTH, &size);
+
+    GLenum format{};
+    Containers::Array<char> data{std::size_t(size)};
+    if(size) glGetProgramBinary(_id, size, nullptr, &format, data);
+
+    return {format, std::move(data)};
+}
+
+bool AbstractShaderProgram::setBinary(const GLenum format, const Containers::ArrayView<const void> data) {
+    glProgramBinary(_id, format, data, data.size());
+
+    GLint success;
+    glGetProgramiv(_id, GL_LINK_STATUS, &success);
+    return success;
+}
+#endif
+
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
 void AbstractShaderProgram::dispatchCompute(const Vector3ui& workgroupCount) {
     use();
+    AbstractTexture::flushDeferredBindings();
     glDispatchCompute(workgroupCount.x(), workgroupCount.y(), workgroupCount.z());
 }
 #endif
 
 void AbstractShaderProgram::use() {
     /* Use only if the program isn't already in use */
-    GLuint& current = Context::current().state().shaderProgram->current;
-    if(current != _id) glUseProgram(current = _id);
+    Context& context = Context::current();
+    GLuint& current = context.state().shaderProgram->current;
+    if(current != _id) {
+        ++context.statisticsInternal().bindCount;
+        glUseProgram(current = _id);
+    } else ++context.statisticsInternal().elidedBindCount;
 }
 
 void AbstractShaderProgram::attachShader(Shader& shader) {
@@ -395,10 +439,17 @@ void AbstractShaderProgram::transformFeedbackVaryingsImplementationDanglingWorka
 #endif
 
 bool AbstractShaderProgram::link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
-    bool allSuccess = true;
+    submitLink(shaders);
+    return checkLink(shaders);
+}
 
+void AbstractShaderProgram::submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
     /* Invoke (possibly parallel) linking on all shaders */
     for(AbstractShaderProgram& shader: shaders) glLinkProgram(shader._id);
+}
+
+bool AbstractShaderProgram::checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
+    bool allSuccess = true;
 
     /* After linking phase, check status of all shaders */
     Int i = 1;
@@ -437,6 +488,32 @@ bool AbstractShaderProgram::link(std::initializer_list<std::reference_wrapper<Ab
     return allSuccess;
 }
 
+bool AbstractShaderProgram::loadCachedBinary(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    ProgramBinaryCache* const cache = ProgramBinaryCache::current();
+    if(!cache || !ProgramBinaryCache::isSupported()) return false;
+
+    if(cache->load(*this, cache->key(shaders))) return true;
+
+    /* Not in the cache, make sure the binary can be saved after linking */
+    setRetrievableBinary(true);
+    #else
+    static_cast<void>(shaders);
+    #endif
+    return false;
+}
+
+void AbstractShaderProgram::saveCachedBinary(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    ProgramBinaryCache* const cache = ProgramBinaryCache::current();
+    if(!cache || !ProgramBinaryCache::isSupported()) return;
+
+    cache->save(*this, cache->key(shaders));
+    #else
+    static_cast<void>(shaders);
+    #endif
+}
+
 Int AbstractShaderProgram::uniformLocationInternal(const Containers::ArrayView<const char> name) {
     const GLint location = glGetUniformLocation(_id, name);
     if(location == -1)
@@ -1101,6 +1178,10 @@ void AbstractShaderProgram::uniformImplementationSSO(const GLint location, const
 void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, const GLsizei count, const Math::RectangularMatrix<4, 3, GLdouble>* const values) {
     glProgramUniformMatrix4x3dvEXT(_id, location, count, GL_FALSE, values[0].data());
 }
+
+void AbstractShaderProgram::setUniformHandle(const Int location, const Containers::ArrayView<const UnsignedLong> handles) {
+    glProgramUniformHandleui64vARB(_id, location, handles.size(), handles);
+}
 #endif
 
 }}
@@ -32,6 +32,9 @@
 #include <functional>
 #include <string>
 #include <Corrade/Containers/ArrayView.h>
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <Corrade/Containers/Array.h>
+#endif
 
 #include "Magnum/Tags.h"
 #include "Magnum/GL/AbstractObject.h"
@@ -425,6 +428,9 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
     #ifndef MAGNUM_TARGET_GLES2
     friend TransformFeedback;
     #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    friend ProgramBinaryCache;
+    #endif
     friend Implementation::ShaderProgramState;
 
     public:
@@ -728,6 +734,41 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         std::pair<bool, std::string> validate();
 
+        /**
+         * @brief Whether linking has finished
+         *
+         * Returns @cpp true @ce if the driver finished linking the program
+         * submitted using @ref submitLink(), in which case @ref checkLink()
+         * doesn't block. Note that the result says nothing about the link
+         * success. If @gl_extension{KHR,parallel_shader_compile} is not
+         * available, always returns @cpp true @ce, the linking is then
+         * finished on the call to @ref checkLink().
+         * @see @ref Shader::isCompileFinished(),
+         *      @ref Shader::setMaxCompilerThreads(),
+         *      @fn_gl_keyword{GetProgram} with @def_gl{COMPLETION_STATUS_KHR}
+         */
+        bool isLinkFinished();
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Program binary
+         *
+         * Returns binary format and binary representation of the linked
+         * program, which can be later passed to @ref setBinary() to avoid
+         * compiling and linking the program again. Enable
+         * @ref setRetrievableBinary() before linking to make sure the driver
+         * keeps the binary around. If the driver doesn't provide any binary
+         * representation, the returned array is empty.
+         * @see @ref ProgramBinaryCache, @fn_gl_keyword{GetProgram} with
+         *      @def_gl{PROGRAM_BINARY_LENGTH}, @fn_gl_keyword{GetProgramBinary}
+         * @requires_gl41 Extension @gl_extension{ARB,get_program_binary}
+         * @requires_gles30 Not supported in OpenGL ES 2.0.
+         * @requires_gles Binary program representations are not supported in
+         *      WebGL.
+         */
+        std::pair<GLenum, Containers::Array<char>> binary();
+        #endif
+
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
         /**
          * @brief Dispatch compute
@@ -759,6 +800,36 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         static bool link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
 
+        /**
+         * @brief Submit multiple shaders for linking
+         *
+         * Submits the shaders for linking without waiting for the result.
+         * Together with @ref isLinkFinished() and
+         * @ref checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>)
+         * this allows the linking to happen in the background. Calling
+         * @ref link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>)
+         * is equivalent to calling this function followed by
+         * @ref checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>).
+         * See also @ref Shader::submitCompile() for the compilation part.
+         * @see @fn_gl_keyword{LinkProgram}
+         */
+        static void submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
+
+        /**
+         * @brief Check link status of multiple shaders
+         *
+         * Expects that the shaders were submitted for linking using
+         * @ref submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>).
+         * Returns @cpp false @ce if linking of any shader failed, @cpp true @ce
+         * if everything succeeded. Linker message (if any) is printed to error
+         * output. If the linking is not finished yet, the function blocks
+         * until it is.
+         * @see @ref isLinkFinished(), @fn_gl_keyword{GetProgram} with
+         *      @def_gl{LINK_STATUS} and @def_gl{INFO_LOG_LENGTH},
+         *      @fn_gl_keyword{GetProgramInfoLog}
+         */
+        static bool checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
+
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
         /**
          * @brief Allow retrieving program binary
@@ -774,8 +845,63 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
         void setRetrievableBinary(bool enabled) {
             glProgramParameteri(_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, enabled ? GL_TRUE : GL_FALSE);
         }
+
+        /**
+         * @brief Load program binary
+         * @param format    Binary format returned from @ref binary()
+         * @param data      Binary data returned from @ref binary()
+         *
+         * Replaces the program with a binary retrieved earlier using
+         * @ref binary(). Returns @cpp false @ce if the driver rejected the
+         * binary (for example because it was produced by a different driver
+         * version), in which case the program needs to be compiled and linked
+         * again. No message is printed in that case. Uniform values are reset
+         * to their defaults, attribute and uniform locations are the same as
+         * when the binary was retrieved.
+         * @see @ref ProgramBinaryCache, @fn_gl_keyword{ProgramBinary},
+         *      @fn_gl_keyword{GetProgram} with @def_gl{LINK_STATUS}
+         * @requires_gl41 Extension @gl_extension{ARB,get_program_binary}
+         * @requires_gles30 Not supported in OpenGL ES 2.0.
+         * @requires_gles Binary program representations are not supported in
+         *      WebGL.
+         */
+        bool setBinary(GLenum format, Containers::ArrayView<const void> data);
         #endif
 
+        /**
+         * @brief Load the program from current binary cache
+         *
+         * If there's a @ref ProgramBinaryCache::current() "current program binary cache"
+         * and it contains a binary matching given @p shaders, loads the
+         * program from it and returns @cpp true @ce. In that case the shaders
+         * don't need to be compiled, attached or linked. Otherwise returns
+         * @cpp false @ce and, if a cache is current, enables
+         * @ref setRetrievableBinary() so the binary can be stored using
+         * @ref saveCachedBinary() after linking. Always returns
+         * @cpp false @ce on OpenGL ES 2.0 and WebGL. The intended usage is
+         * the following:
+         *
+         * @code{.cpp}
+         * if(!loadCachedBinary({vert, frag})) {
+         *     CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+         *     attachShaders({vert, frag});
+         *     CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+         *     saveCachedBinary({vert, frag});
+         * }
+         * @endcode
+         */
+        bool loadCachedBinary(std::initializer_list<std::reference_wrapper<Shader>> shaders);
+
+        /**
+         * @brief Save linked program to current binary cache
+         *
+         * If there's a @ref ProgramBinaryCache::current() "current program binary cache",
+         * saves binary of the linked program to it, keyed on given
+         * @p shaders. Does nothing on OpenGL ES 2.0 and WebGL. See
+         * @ref loadCachedBinary() for more information.
+         */
+        void saveCachedBinary(std::initializer_list<std::reference_wrapper<Shader>> shaders);
+
         #ifndef MAGNUM_TARGET_WEBGL
         /**
          * @brief Allow the program to be bound to individual pipeline stages
@@ -936,6 +1062,22 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         bool link() { return link({*this}); }
 
+        /**
+         * @brief Submit the shader for linking
+         *
+         * Submits single shader. See @ref submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>)
+         * for more information.
+         */
+        void submitLink() { submitLink({*this}); }
+
+        /**
+         * @brief Check link status of the shader
+         *
+         * Checks single shader. See @ref checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>)
+         * for more information.
+         */
+        bool checkLink() { return checkLink({*this}); }
+
         /**
          * @brief Get uniform location
          * @param name          Uniform name
@@ -1108,6 +1250,40 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
         void setUniform(Int location, Containers::ArrayView<const Math::RectangularMatrix<4, 3, Double>> values); /**< @overload */
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set bindless texture handle uniform
+         * @param location      Uniform location
+         * @param handle        Texture handle
+         *
+         * Convenience alternative for setting one value, see
+         * @ref setUniformHandle(Int, Containers::ArrayView<const UnsignedLong>)
+         * for more information.
+         */
+        void setUniformHandle(Int location, UnsignedLong handle) {
+            setUniformHandle(location, {&handle, 1});
+        }
+
+        /**
+         * @brief Set bindless texture handle uniforms
+         * @param location      Uniform location
+         * @param handles       Texture handles
+         *
+         * Sets sampler uniforms to handles returned from
+         * @ref AbstractTexture::handle(). The handles need to be made
+         * resident using @ref AbstractTexture::makeHandleResident() before
+         * drawing with the program. Unlike with @ref setUniform(), the shader
+         * is never marked for use, as the extension provides only the
+         * @fn_gl_extension{ProgramUniformHandle,ARB,bindless_texture} API.
+         * @see @ref uniformLocation(),
+         *      @fn_gl_extension_keyword{ProgramUniformHandle,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        void setUniformHandle(Int location, Containers::ArrayView<const UnsignedLong> handles);
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES2
         /**
          * @brief Set uniform block binding
@@ -1149,6 +1325,11 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
 
         void use();
 
+        bool MAGNUM_GL_LOCAL isLinkFinishedImplementationNoOp();
+        #ifndef MAGNUM_TARGET_WEBGL
+        bool MAGNUM_GL_LOCAL isLinkFinishedImplementationKHR();
+        #endif
+
         /*
             Currently, there are four supported ways to call glProgramUniform():
 
@@ -25,10 +25,12 @@
 
 #include "AbstractTexture.h"
 
+#include <algorithm>
 #include <Corrade/Containers/Array.h>
 
 #include "Magnum/Array.h"
 #include "Magnum/Image.h"
+#include "Magnum/Instrumentation.h"
 #ifndef MAGNUM_TARGET_GLES2
 #include "Magnum/GL/BufferImage.h"
 #endif
@@ -39,6 +41,7 @@
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
+#include "Magnum/GL/Implementation/formatDataSize.h"
 #include "Magnum/GL/Implementation/RendererState.h"
 #include "Magnum/GL/Implementation/State.h"
 #include "Magnum/GL/Implementation/TextureState.h"
@@ -113,13 +116,18 @@ Int AbstractTexture::maxIntegerSamples() {
 #endif
 
 void AbstractTexture::unbind(const Int textureUnit) {
-    Implementation::TextureState& textureState = *Context::current().state().texture;
+    Context& context = Context::current();
+    Implementation::TextureState& textureState = *context.state().texture;
 
     /* If given texture unit is already unbound, nothing to do */
-    if(textureState.bindings[textureUnit].second == 0) return;
+    if(textureState.bindings[textureUnit].second == 0) {
+        ++context.statisticsInternal().elidedBindCount;
+        return;
+    }
 
     /* Unbind the texture, reset state tracker */
-    Context::current().state().texture->unbindImplementation(textureUnit);
+    ++context.statisticsInternal().bindCount;
+    textureState.unbindImplementation(textureUnit);
     /* libstdc++ since GCC 6.3 can't handle just = {} (ambiguous overload of
        operator=) */
     textureState.bindings[textureUnit] = std::pair<GLenum, GLuint>{};
@@ -174,7 +182,8 @@ void AbstractTexture::bindImplementationFallback(const GLint firstTextureUnit, c
 #ifndef MAGNUM_TARGET_GLES
 /** @todoc const Containers::ArrayView makes Doxygen grumpy */
 void AbstractTexture::bindImplementationMulti(const GLint firstTextureUnit, Containers::ArrayView<AbstractTexture* const> textures) {
-    Implementation::TextureState& textureState = *Context::current().state().texture;
+    Context& context = Context::current();
+    Implementation::TextureState& textureState = *context.state().texture;
 
     /* Create array of IDs and also update bindings in state tracker */
     /** @todo VLAs */
@@ -195,7 +204,10 @@ void AbstractTexture::bindImplementationMulti(const GLint firstTextureUnit, Cont
     }
 
     /* Avoid doing the binding if there is nothing different */
-    if(different) glBindTextures(firstTextureUnit, textures.size(), ids);
+    if(different) {
+        ++context.statisticsInternal().bindCount;
+        glBindTextures(firstTextureUnit, textures.size(), ids);
+    } else ++context.statisticsInternal().elidedBindCount;
 }
 #endif
 
@@ -214,6 +226,29 @@ Int AbstractTexture::compressedBlockDataSizeImplementationBitsWorkaround(const G
     /* NVidia (358.16) reports the value in bits instead of bytes */
     return compressedBlockDataSizeImplementationDefault(target, format)/8;
 }
+
+Int AbstractTexture::sparsePageSizeCount(const GLenum target, const TextureFormat format) {
+    GLint value = 0;
+    glGetInternalformativ(target, GLenum(format), GL_NUM_VIRTUAL_PAGE_SIZES_ARB, 1, &value);
+    return value;
+}
+
+Vector3i AbstractTexture::sparsePageSize(const GLenum target, const TextureFormat format, const Int index) {
+    const Int count = sparsePageSizeCount(target, format);
+    CORRADE_ASSERT(index < count,
+        "GL::AbstractTexture::sparsePageSize(): index" << index << "out of range for" << count << "page sizes", {});
+
+    /* The queries return values for all page sizes at once */
+    Containers::Array<GLint> values{std::size_t(count)};
+    Vector3i size{Math::NoInit};
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_X_ARB, count, values);
+    size.x() = values[index];
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_Y_ARB, count, values);
+    size.y() = values[index];
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_Z_ARB, count, values);
+    size.z() = values[index];
+    return size;
+}
 #endif
 
 AbstractTexture::AbstractTexture(GLenum target): _target{target}, _flags{ObjectFlag::DeleteOnDestruction} {
@@ -233,8 +268,15 @@ void AbstractTexture::createImplementationDSA() {
 #endif
 
 AbstractTexture::~AbstractTexture() {
-    /* Moved out or not deleting on destruction, nothing to do */
-    if(!_id || !(_flags & ObjectFlag::DeleteOnDestruction)) return;
+    /* Moved out, nothing to do */
+    if(!_id) return;
+
+    /* Remove from memory usage accounting even if the object itself isn't
+       deleted, as nothing would track it anymore */
+    if(_memoryUsage) setStorageMemoryUsageInternal(0);
+
+    /* Not deleting on destruction, nothing else to do */
+    if(!(_flags & ObjectFlag::DeleteOnDestruction)) return;
 
     /* Remove all bindings */
     for(auto& binding: Context::current().state().texture->bindings) {
@@ -244,6 +286,11 @@ AbstractTexture::~AbstractTexture() {
         if(binding.second == _id) binding = std::pair<GLenum, GLuint>{};
     }
 
+    /* Remove all deferred bindings */
+    for(auto& binding: Context::current().state().texture->deferredBindings) {
+        if(binding.second == _id) binding = std::pair<GLenum, GLuint>{};
+    }
+
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
     /* Remove all image bindings */
     for(auto& binding: Context::current().state().texture->imageBindings) {
@@ -276,10 +323,37 @@ std::string AbstractTexture::label() {
 AbstractTexture& AbstractTexture::setLabelInternal(const Containers::ArrayView<const char> label) {
     createIfNotAlready();
     Context::current().state().debug->labelImplementation(GL_TEXTURE, _id, label);
+
+    /* Move the memory usage to the category given by the label */
+    Context& context = Context::current();
+    const UnsignedInt category = context.memoryUsageCategoryInternal(label);
+    context.updateMemoryUsageInternal(&Context::MemoryUsage::textureSize, _memoryCategory, _memoryUsage, category, _memoryUsage);
     return *this;
 }
 #endif
 
+void AbstractTexture::setStorageMemoryUsageInternal(const std::size_t size) {
+    _levelMemoryUsage = nullptr;
+    Context::current().updateMemoryUsageInternal(&Context::MemoryUsage::textureSize, _memoryCategory, _memoryUsage, _memoryCategory, size);
+}
+
+void AbstractTexture::setLevelMemoryUsageInternal(const std::size_t index, const std::size_t size) {
+    /* Grow the per-level size array if needed. If the texture had immutable
+       storage before, it's overwritten with the new level, so its size gets
+       replaced too. */
+    std::size_t usage = _memoryUsage;
+    if(_levelMemoryUsage.empty()) usage = 0;
+    if(index >= _levelMemoryUsage.size()) {
+        Containers::Array<std::size_t> levelMemoryUsage{Containers::ValueInit, std::max(index + 1, _levelMemoryUsage.size()*2)};
+        std::copy(_levelMemoryUsage.begin(), _levelMemoryUsage.end(), levelMemoryUsage.begin());
+        _levelMemoryUsage = std::move(levelMemoryUsage);
+    }
+
+    usage = usage - _levelMemoryUsage[index] + size;
+    _levelMemoryUsage[index] = size;
+    Context::current().updateMemoryUsageInternal(&Context::MemoryUsage::textureSize, _memoryCategory, _memoryUsage, _memoryCategory, usage);
+}
+
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
 void AbstractTexture::unbindImage(const Int imageUnit) {
     Implementation::TextureState& textureState = *Context::current().state().texture;
@@ -337,16 +411,133 @@ void AbstractTexture::bindImageInternal(const Int imageUnit, const Int level, co
 #endif
 
 void AbstractTexture::bind(Int textureUnit) {
-    Implementation::TextureState& textureState = *Context::current().state().texture;
+    Context& context = Context::current();
+    Implementation::TextureState& textureState = *context.state().texture;
 
     /* If already bound in given texture unit, nothing to do */
-    if(textureState.bindings[textureUnit].second == _id) return;
+    if(textureState.bindings[textureUnit].second == _id) {
+        ++context.statisticsInternal().elidedBindCount;
+        return;
+    }
 
     /* Update state tracker, bind the texture to the unit */
+    ++context.statisticsInternal().bindCount;
     textureState.bindings[textureUnit] = {_target, _id};
     (this->*textureState.bindImplementation)(textureUnit);
 }
 
+void AbstractTexture::bindDeferred(const Int textureUnit) {
+    /* glBindTextures() needs the texture to be created */
+    createIfNotAlready();
+
+    Implementation::TextureState& textureState = *Context::current().state().texture;
+    textureState.deferredBindings[textureUnit] = {_target, _id};
+
+    /* Extend the range of touched units */
+    if(textureState.deferredFirst == textureState.deferredEnd) {
+        textureState.deferredFirst = textureUnit;
+        textureState.deferredEnd = textureUnit + 1;
+    } else {
+        if(textureUnit < textureState.deferredFirst)
+            textureState.deferredFirst = textureUnit;
+        if(textureUnit >= textureState.deferredEnd)
+            textureState.deferredEnd = textureUnit + 1;
+    }
+}
+
+void AbstractTexture::flushDeferredBindings() {
+    Context& context = Context::current();
+    Implementation::TextureState& textureState = *context.state().texture;
+
+    /* Nothing deferred, nothing to do */
+    if(textureState.deferredFirst == textureState.deferredEnd) return;
+
+    /* Find the range of units that actually need to be changed */
+    GLint first = textureState.deferredEnd, end = textureState.deferredFirst;
+    for(GLint i = textureState.deferredFirst; i != textureState.deferredEnd; ++i) {
+        const std::pair<GLenum, GLuint>& deferred = textureState.deferredBindings[i];
+        if(!deferred.first) continue;
+
+        if(textureState.bindings[i].second == deferred.second) {
+            ++context.statisticsInternal().elidedBindCount;
+            continue;
+        }
+
+        if(i < first) first = i;
+        end = i + 1;
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(first < end && context.isExtensionSupported<Extensions::ARB::multi_bind>()) {
+        /* Units in between that weren't deferred are rebound to what they
+           have already, unless their state is unknown, in which case the
+           range is split there */
+        /** @todo VLAs */
+        Containers::Array<GLuint> ids{std::size_t(end - first)};
+        GLint runFirst = first;
+        for(GLint i = first; i != end; ++i) {
+            std::pair<GLenum, GLuint>& binding = textureState.bindings[i];
+            const std::pair<GLenum, GLuint>& deferred = textureState.deferredBindings[i];
+            if(deferred.first) binding = deferred;
+            else if(binding.second == Implementation::State::DisengagedBinding) {
+                if(i != runFirst) {
+                    ++context.statisticsInternal().bindCount;
+                    glBindTextures(runFirst, i - runFirst, ids + (runFirst - first));
+                }
+                runFirst = i + 1;
+                continue;
+            }
+
+            ids[i - first] = binding.second;
+        }
+
+        if(end != runFirst) {
+            ++context.statisticsInternal().bindCount;
+            glBindTextures(runFirst, end - runFirst, ids + (runFirst - first));
+        }
+    } else
+    #endif
+    {
+        for(GLint i = first; i < end; ++i) {
+            const std::pair<GLenum, GLuint>& deferred = textureState.deferredBindings[i];
+            if(!deferred.first || textureState.bindings[i].second == deferred.second)
+                continue;
+
+            /* Activate given texture unit if not already active, update state
+               tracker */
+            if(textureState.currentTextureUnit != i)
+                glActiveTexture(GL_TEXTURE0 + (textureState.currentTextureUnit = i));
+
+            textureState.bindings[i] = deferred;
+            ++context.statisticsInternal().bindCount;
+            glBindTexture(deferred.first, deferred.second);
+        }
+    }
+
+    /* Clear the deferred bindings for next time */
+    std::fill(textureState.deferredBindings + textureState.deferredFirst, textureState.deferredBindings + textureState.deferredEnd, std::pair<GLenum, GLuint>{});
+    textureState.deferredFirst = textureState.deferredEnd = 0;
+}
+
+#ifndef MAGNUM_TARGET_GLES
+UnsignedLong AbstractTexture::handle() {
+    createIfNotAlready();
+    return glGetTextureHandleARB(_id);
+}
+
+void AbstractTexture::makeHandleResident(const UnsignedLong handle) {
+    glMakeTextureHandleResidentARB(handle);
+}
+
+void AbstractTexture::makeHandleNonResident(const UnsignedLong handle) {
+    glMakeTextureHandleNonResidentARB(handle);
+}
+
+bool AbstractTexture::isHandleResident(const UnsignedLong handle) {
+    return glIsTextureHandleResidentARB(handle);
+}
+#endif
+
 void AbstractTexture::bindImplementationDefault(GLint textureUnit) {
     Implementation::TextureState& textureState = *Context::current().state().texture;
 
@@ -521,11 +712,14 @@ void AbstractTexture::bindInternal() {
        functions need to have the texture bound in *currently active* unit,
        so we would need to call glActiveTexture() afterwards anyway. */
 
-    Implementation::TextureState& textureState = *Context::current().state().texture;
+    Context& context = Context::current();
+    Implementation::TextureState& textureState = *context.state().texture;
 
     /* If the texture is already bound in current unit, nothing to do */
-    if(textureState.bindings[textureState.currentTextureUnit].second == _id)
+    if(textureState.bindings[textureState.currentTextureUnit].second == _id) {
+        ++context.statisticsInternal().elidedBindCount;
         return;
+    }
 
     /* Set internal unit as active if not already, update state tracker */
     CORRADE_INTERNAL_ASSERT(textureState.maxTextureUnits > 1);
@@ -534,8 +728,12 @@ void AbstractTexture::bindInternal() {
         glActiveTexture(GL_TEXTURE0 + (textureState.currentTextureUnit = internalTextureUnit));
 
     /* Bind the texture to internal unit if not already, update state tracker */
-    if(textureState.bindings[internalTextureUnit].second == _id) return;
+    if(textureState.bindings[internalTextureUnit].second == _id) {
+        ++context.statisticsInternal().elidedBindCount;
+        return;
+    }
     textureState.bindings[internalTextureUnit] = {_target, _id};
+    ++context.statisticsInternal().bindCount;
 
     /* Binding the texture finally creates it */
     _flags |= ObjectFlag::Created;
@@ -1065,6 +1263,27 @@ PixelType pixelTypeForInternalFormat(const TextureFormat internalFormat) {
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void AbstractTexture::setSparse(const Int pageSizeIndex) {
+    (this->*Context::current().state().texture->parameteriImplementation)(GL_TEXTURE_SPARSE_ARB, GL_TRUE);
+    (this->*Context::current().state().texture->parameteriImplementation)(GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, pageSizeIndex);
+}
+
+Int AbstractTexture::sparseLevelCount() {
+    /* There's no DSA variant of the query in the extension */
+    bindInternal();
+    GLint value = 0;
+    glGetTexParameteriv(_target, GL_NUM_SPARSE_LEVELS_ARB, &value);
+    return value;
+}
+
+void AbstractTexture::commitPages(const GLint level, const Vector3i& offset, const Vector3i& size, const bool commit) {
+    /** @todo use glTexturePageCommitmentEXT() with EXT_direct_state_access */
+    bindInternal();
+    glTexPageCommitmentARB(_target, level, offset.x(), offset.y(), offset.z(), size.x(), size.y(), size.z(), commit);
+}
+#endif
+
 void AbstractTexture::parameterImplementationDefault(GLenum parameter, GLint value) {
     bindInternal();
     glTexParameteri(_target, parameter, value);
@@ -1967,42 +2186,59 @@ Vector3i AbstractTexture::DataHelper<3>::imageSize(AbstractTexture& texture, con
 #ifndef MAGNUM_TARGET_GLES
 void AbstractTexture::DataHelper<1>::setStorage(AbstractTexture& texture, const GLsizei levels, const TextureFormat internalFormat, const Math::Vector< 1, GLsizei >& size) {
     (texture.*Context::current().state().texture->storage1DImplementation)(levels, internalFormat, size);
+    texture.setStorageMemoryUsageInternal(Implementation::textureStorageDataSize(texture._target, levels, internalFormat, {size[0], 1, 1}));
 }
 #endif
 
 void AbstractTexture::DataHelper<2>::setStorage(AbstractTexture& texture, const GLsizei levels, const TextureFormat internalFormat, const Vector2i& size) {
     (texture.*Context::current().state().texture->storage2DImplementation)(levels, internalFormat, size);
+    texture.setStorageMemoryUsageInternal(Implementation::textureStorageDataSize(texture._target, levels, internalFormat, {size, 1}));
 }
 
 #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
 void AbstractTexture::DataHelper<3>::setStorage(AbstractTexture& texture, const GLsizei levels, const TextureFormat internalFormat, const Vector3i& size) {
     (texture.*Context::current().state().texture->storage3DImplementation)(levels, internalFormat, size);
+    texture.setStorageMemoryUsageInternal(Implementation::textureStorageDataSize(texture._target, levels, internalFormat, size));
 }
 #endif
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
 void AbstractTexture::DataHelper<2>::setStorageMultisample(AbstractTexture& texture, const GLsizei samples, const TextureFormat internalFormat, const Vector2i& size, const GLboolean fixedSampleLocations) {
     (texture.*Context::current().state().texture->storage2DMultisampleImplementation)(samples, internalFormat, size, fixedSampleLocations);
+    texture.setStorageMemoryUsageInternal(Implementation::textureFormatDataSize(internalFormat, {size, 1})*samples);
 }
 
 void AbstractTexture::DataHelper<3>::setStorageMultisample(AbstractTexture& texture, const GLsizei samples, const TextureFormat internalFormat, const Vector3i& size, const GLboolean fixedSampleLocations) {
     (texture.*Context::current().state().texture->storage3DMultisampleImplementation)(samples, internalFormat, size, fixedSampleLocations);
+    texture.setStorageMemoryUsageInternal(Implementation::textureFormatDataSize(internalFormat, size)*samples);
 }
 #endif
 
+namespace {
+    /* Cube map faces are specified separately, so each has its own slot */
+    std::size_t levelMemoryIndex(const GLenum textureTarget, const GLenum target, const GLint level) {
+        return textureTarget == GL_TEXTURE_CUBE_MAP ?
+            level*6 + (target - GL_TEXTURE_CUBE_MAP_POSITIVE_X) : level;
+    }
+}
+
 #ifndef MAGNUM_TARGET_GLES
 void AbstractTexture::DataHelper<1>::setImage(AbstractTexture& texture, const GLint level, const TextureFormat internalFormat, const ImageView1D& image) {
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     texture.bindInternal();
     glTexImage1D(texture._target, level, GLint(internalFormat), image.size()[0], 0, GLenum(pixelFormat(image.format())), GLenum(pixelType(image.format(), image.formatExtra())), image.data());
+    texture.setLevelMemoryUsageInternal(level, Implementation::textureFormatDataSize(internalFormat, {image.size()[0], 1, 1}));
 }
 
 void AbstractTexture::DataHelper<1>::setCompressedImage(AbstractTexture& texture, const GLint level, const CompressedImageView1D& image) {
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     texture.bindInternal();
     glCompressedTexImage1D(texture._target, level, GLenum(image.format()), image.size()[0], 0, Magnum::Implementation::occupiedCompressedImageDataSize(image, image.data().size()), image.data());
+    texture.setLevelMemoryUsageInternal(level, image.data().size());
 }
 
 void AbstractTexture::DataHelper<1>::setImage(AbstractTexture& texture, const GLint level, const TextureFormat internalFormat, BufferImage1D& image) {
@@ -2010,6 +2246,7 @@ void AbstractTexture::DataHelper<1>::setImage(AbstractTexture& texture, const GL
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
     texture.bindInternal();
     glTexImage1D(texture._target, level, GLint(internalFormat), image.size()[0], 0, GLenum(image.format()), GLenum(image.type()), nullptr);
+    texture.setLevelMemoryUsageInternal(level, Implementation::textureFormatDataSize(internalFormat, {image.size()[0], 1, 1}));
 }
 
 void AbstractTexture::DataHelper<1>::setCompressedImage(AbstractTexture& texture, const GLint level, CompressedBufferImage1D& image) {
@@ -2017,17 +2254,21 @@ void AbstractTexture::DataHelper<1>::setCompressedImage(AbstractTexture& texture
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
     texture.bindInternal();
     glCompressedTexImage1D(texture._target, level, GLenum(image.format()), image.size()[0], 0, Magnum::Implementation::occupiedCompressedImageDataSize(image, image.dataSize()), nullptr);
+    texture.setLevelMemoryUsageInternal(level, image.dataSize());
 }
 
 void AbstractTexture::DataHelper<1>::setSubImage(AbstractTexture& texture, const GLint level, const Math::Vector<1, GLint>& offset, const ImageView1D& image) {
+    MAGNUM_INSTRUMENTATION_SCOPE("GL::Texture::setSubImage()");
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     (texture.*Context::current().state().texture->subImage1DImplementation)(level, offset, image.size(), pixelFormat(image.format()), pixelType(image.format(), image.formatExtra()), image.data());
 }
 
 void AbstractTexture::DataHelper<1>::setCompressedSubImage(AbstractTexture& texture, const GLint level, const Math::Vector<1, GLint>& offset, const CompressedImageView1D& image) {
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     (texture.*Context::current().state().texture->compressedSubImage1DImplementation)(level, offset, image.size(), compressedPixelFormat(image.format()), image.data(), Magnum::Implementation::occupiedCompressedImageDataSize(image, image.data().size()));
 }
 
@@ -2049,11 +2290,13 @@ void AbstractTexture::DataHelper<2>::setImage(AbstractTexture& texture, const GL
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     (texture.*Context::current().state().texture->image2DImplementation)(target, level, internalFormat, image.size(), pixelFormat(image.format()), pixelType(image.format(), image.formatExtra()), image.data()
         #ifdef MAGNUM_TARGET_GLES2
         + Magnum::Implementation::pixelStorageSkipOffset(image)
         #endif
         , image.storage());
+    texture.setLevelMemoryUsageInternal(levelMemoryIndex(texture._target, target, level), Implementation::textureFormatDataSize(internalFormat, {image.size(), 1}));
 }
 
 void AbstractTexture::DataHelper<2>::setCompressedImage(AbstractTexture& texture, const GLenum target, const GLint level, const CompressedImageView2D& image) {
@@ -2061,8 +2304,10 @@ void AbstractTexture::DataHelper<2>::setCompressedImage(AbstractTexture& texture
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     texture.bindInternal();
     glCompressedTexImage2D(target, level, GLenum(compressedPixelFormat(image.format())), image.size().x(), image.size().y(), 0, Magnum::Implementation::occupiedCompressedImageDataSize(image, image.data().size()), image.data());
+    texture.setLevelMemoryUsageInternal(levelMemoryIndex(texture._target, target, level), image.data().size());
 }
 
 #ifndef MAGNUM_TARGET_GLES2
@@ -2071,6 +2316,7 @@ void AbstractTexture::DataHelper<2>::setImage(AbstractTexture& texture, const GL
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
     texture.bindInternal();
     glTexImage2D(target, level, GLint(internalFormat), image.size().x(), image.size().y(), 0, GLenum(image.format()), GLenum(image.type()), nullptr);
+    texture.setLevelMemoryUsageInternal(levelMemoryIndex(texture._target, target, level), Implementation::textureFormatDataSize(internalFormat, {image.size(), 1}));
 }
 
 void AbstractTexture::DataHelper<2>::setCompressedImage(AbstractTexture& texture, const GLenum target, const GLint level, CompressedBufferImage2D& image) {
@@ -2078,14 +2324,17 @@ void AbstractTexture::DataHelper<2>::setCompressedImage(AbstractTexture& texture
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
     texture.bindInternal();
     glCompressedTexImage2D(target, level, GLenum(image.format()), image.size().x(), image.size().y(), 0, Magnum::Implementation::occupiedCompressedImageDataSize(image, image.dataSize()), nullptr);
+    texture.setLevelMemoryUsageInternal(levelMemoryIndex(texture._target, target, level), image.dataSize());
 }
 #endif
 
 void AbstractTexture::DataHelper<2>::setSubImage(AbstractTexture& texture, const GLint level, const Vector2i& offset, const ImageView2D& image) {
+    MAGNUM_INSTRUMENTATION_SCOPE("GL::Texture::setSubImage()");
     #ifndef MAGNUM_TARGET_GLES2
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     (texture.*Context::current().state().texture->subImage2DImplementation)(level, offset, image.size(), pixelFormat(image.format()), pixelType(image.format(), image.formatExtra()), image.data()
         #ifdef MAGNUM_TARGET_GLES2
         + Magnum::Implementation::pixelStorageSkipOffset(image)
@@ -2098,6 +2347,7 @@ void AbstractTexture::DataHelper<2>::setCompressedSubImage(AbstractTexture& text
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     (texture.*Context::current().state().texture->compressedSubImage2DImplementation)(level, offset, image.size(), compressedPixelFormat(image.format()), image.data(), Magnum::Implementation::occupiedCompressedImageDataSize(image, image.data().size()));
 }
 
@@ -2121,11 +2371,13 @@ void AbstractTexture::DataHelper<3>::setImage(AbstractTexture& texture, const GL
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     (texture.*Context::current().state().texture->image3DImplementation)(level, internalFormat, image.size(), pixelFormat(image.format()), pixelType(image.format(), image.formatExtra()), image.data()
         #ifdef MAGNUM_TARGET_GLES2
         + Magnum::Implementation::pixelStorageSkipOffset(image)
         #endif
         , image.storage());
+    texture.setLevelMemoryUsageInternal(level, Implementation::textureFormatDataSize(internalFormat, image.size()));
 }
 
 void AbstractTexture::DataHelper<3>::setCompressedImage(AbstractTexture& texture, const GLint level, const CompressedImageView3D& image) {
@@ -2133,12 +2385,14 @@ void AbstractTexture::DataHelper<3>::setCompressedImage(AbstractTexture& texture
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     texture.bindInternal();
     #ifndef MAGNUM_TARGET_GLES2
     glCompressedTexImage3D(texture._target, level, GLenum(compressedPixelFormat(image.format())), image.size().x(), image.size().y(), image.size().z(), 0, Magnum::Implementation::occupiedCompressedImageDataSize(image, image.data().size()), image.data());
     #else
     glCompressedTexImage3DOES(texture._target, level, GLenum(compressedPixelFormat(image.format())), image.size().x(), image.size().y(), image.size().z(), 0, Magnum::Implementation::occupiedCompressedImageDataSize(image, image.data().size()), image.data());
     #endif
+    texture.setLevelMemoryUsageInternal(level, image.data().size());
 }
 #endif
 
@@ -2148,6 +2402,7 @@ void AbstractTexture::DataHelper<3>::setImage(AbstractTexture& texture, const GL
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
     texture.bindInternal();
     glTexImage3D(texture._target, level, GLint(internalFormat), image.size().x(), image.size().y(), image.size().z(), 0, GLenum(image.format()), GLenum(image.type()), nullptr);
+    texture.setLevelMemoryUsageInternal(level, Implementation::textureFormatDataSize(internalFormat, image.size()));
 }
 
 void AbstractTexture::DataHelper<3>::setCompressedImage(AbstractTexture& texture, const GLint level, CompressedBufferImage3D& image) {
@@ -2155,15 +2410,18 @@ void AbstractTexture::DataHelper<3>::setCompressedImage(AbstractTexture& texture
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
     texture.bindInternal();
     glCompressedTexImage3D(texture._target, level, GLenum(image.format()), image.size().x(), image.size().y(), image.size().z(), 0, Magnum::Implementation::occupiedCompressedImageDataSize(image, image.dataSize()), nullptr);
+    texture.setLevelMemoryUsageInternal(level, image.dataSize());
 }
 #endif
 
 #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
 void AbstractTexture::DataHelper<3>::setSubImage(AbstractTexture& texture, const GLint level, const Vector3i& offset, const ImageView3D& image) {
+    MAGNUM_INSTRUMENTATION_SCOPE("GL::Texture::setSubImage()");
     #ifndef MAGNUM_TARGET_GLES2
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     (texture.*Context::current().state().texture->subImage3DImplementation)(level, offset, image.size(), pixelFormat(image.format()), pixelType(image.format(), image.formatExtra()), image.data()
         #ifdef MAGNUM_TARGET_GLES2
         + Magnum::Implementation::pixelStorageSkipOffset(image)
@@ -2176,6 +2434,7 @@ void AbstractTexture::DataHelper<3>::setCompressedSubImage(AbstractTexture& text
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
     Context::current().state().renderer->applyPixelStorageUnpack(image.storage());
+    Context::current().statisticsInternal().textureUploadSize += image.data().size();
     (texture.*Context::current().state().texture->compressedSubImage3DImplementation)(level, offset, image.size(), compressedPixelFormat(image.format()), image.data(), Magnum::Implementation::occupiedCompressedImageDataSize(image, image.data().size()));
 }
 #endif
@@ -29,7 +29,7 @@
  * @brief Class @ref Magnum::GL::AbstractTexture
  */
 
-#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Tags.h"
@@ -359,6 +359,26 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
          */
         GLuint release();
 
+        /**
+         * @brief Estimated GPU memory usage
+         *
+         * Sum of sizes of all levels allocated with @ref Texture::setStorage() "setStorage()",
+         * @ref Texture::setImage() "setImage()" or
+         * @ref Texture::setCompressedImage() "setCompressedImage()" of
+         * given texture type, @cpp 0 @ce if nothing was allocated yet. The
+         * driver is not queried, so the value is only an estimate --- sizes
+         * of uncompressed levels are calculated from the internal format,
+         * counting three-component formats as padded to four components,
+         * and compressed formats in whole blocks. Sizes of images passed to
+         * @ref Texture::setCompressedImage() "setCompressedImage()" are used
+         * as-is. Respecifying a level with @ref Texture::setImage() "setImage()"
+         * replaces its previous size. The value is summed in
+         * @ref Context::memoryUsage() and can be also used as a resource size
+         * for @ref ResourceManager-budget "ResourceManager memory budgets".
+         * @see @ref Buffer::memoryUsage(), @ref Renderbuffer::memoryUsage()
+         */
+        std::size_t memoryUsage() const { return _memoryUsage; }
+
         #ifndef MAGNUM_TARGET_WEBGL
         /**
          * @brief Texture label
@@ -383,7 +403,9 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
          * Default is empty string. If OpenGL 4.3 / OpenGL ES 3.2 is not
          * supported and neither @gl_extension{KHR,debug} (covered also by
          * @gl_extension{ANDROID,extension_pack_es31a}) nor @gl_extension{EXT,debug_label}
-         * desktop or ES extension is available, this function does nothing.
+         * desktop or ES extension is available, this function does nothing,
+         * but the label is still used as a category for
+         * @ref Context::memoryUsage(const std::string&) const.
          * @see @ref maxLabelLength(), @fn_gl_keyword{ObjectLabel} or
          *      @fn_gl_extension_keyword{LabelObject,EXT,debug_label} with
          *      @def_gl{TEXTURE}
@@ -418,6 +440,94 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
          */
         void bind(Int textureUnit);
 
+        /**
+         * @brief Bind texture to given texture unit before the next draw
+         *
+         * Unlike @ref bind(Int) the binding is only recorded and is issued
+         * together with all other deferred bindings by
+         * @ref flushDeferredBindings(), which is called automatically by
+         * @ref Mesh::draw(), @ref MeshView::draw() and related functions.
+         * Repeated deferred bindings to the same unit override each other
+         * and bindings of textures already bound in given unit are skipped.
+         * If @gl_extension{ARB,multi_bind} (part of OpenGL 4.4) is available,
+         * all changed units are bound with a single call.
+         * @see @ref bind(Int, std::initializer_list<AbstractTexture*>)
+         */
+        void bindDeferred(Int textureUnit);
+
+        /**
+         * @brief Flush deferred texture bindings
+         *
+         * Issues all bindings recorded with @ref bindDeferred() since the
+         * last flush, skipping units that already have the texture bound.
+         * If @gl_extension{ARB,multi_bind} (part of OpenGL 4.4) is available,
+         * continuous ranges of units with known state are bound using a
+         * single @fn_gl_keyword{BindTextures} call, otherwise each texture
+         * is bound using @fn_gl_keyword{ActiveTexture} and
+         * @fn_gl_keyword{BindTexture}. Called automatically before each draw
+         * and compute dispatch, you need to call this function explicitly
+         * only when the textures are used from third-party OpenGL code.
+         */
+        static void flushDeferredBindings();
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Bindless texture handle
+         *
+         * Returns a 64-bit handle that can be passed to a shader using
+         * @ref AbstractShaderProgram::setUniformHandle() or stored in a
+         * uniform or shader storage buffer, removing the need to bind the
+         * texture to a texture unit. The texture has to be complete and after
+         * the first call its parameters and storage can't be changed anymore.
+         * The handle needs to be made resident using @ref makeHandleResident()
+         * before it can be accessed by a shader.
+         * @see @fn_gl_extension_keyword{GetTextureHandle,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        UnsignedLong handle();
+
+        /**
+         * @brief Make a bindless texture handle resident
+         *
+         * Makes the texture accessible to shaders through given handle
+         * returned from @ref handle(). Make the handle non-resident again
+         * using @ref makeHandleNonResident() once it's no longer needed, as
+         * the count of resident textures may be limited.
+         * @see @ref isHandleResident(),
+         *      @fn_gl_extension_keyword{MakeTextureHandleResident,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        static void makeHandleResident(UnsignedLong handle);
+
+        /**
+         * @brief Make a bindless texture handle non-resident
+         *
+         * @see @ref makeHandleResident(), @ref isHandleResident(),
+         *      @fn_gl_extension_keyword{MakeTextureHandleNonResident,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        static void makeHandleNonResident(UnsignedLong handle);
+
+        /**
+         * @brief Whether a bindless texture handle is resident
+         *
+         * The result is *not* cached, repeated queries will result in
+         * repeated OpenGL calls.
+         * @see @ref makeHandleResident(), @ref makeHandleNonResident(),
+         *      @fn_gl_extension_keyword{IsTextureHandleResident,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        static bool isHandleResident(UnsignedLong handle);
+        #endif
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #else
@@ -427,6 +537,8 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
 
         #ifndef MAGNUM_TARGET_GLES
         static Int compressedBlockDataSize(GLenum target, TextureFormat format);
+        static Int sparsePageSizeCount(GLenum target, TextureFormat format);
+        static Vector3i sparsePageSize(GLenum target, TextureFormat format, Int index);
         #endif
 
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
@@ -443,6 +555,12 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
 
         void MAGNUM_GL_LOCAL createIfNotAlready();
 
+        /* Replaces the size of all levels */
+        void setStorageMemoryUsageInternal(std::size_t size);
+        /* Replaces the size of a single level, index includes the cube map
+           face */
+        void MAGNUM_GL_LOCAL setLevelMemoryUsageInternal(std::size_t index, std::size_t size);
+
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
         void bindImageInternal(Int imageUnit, Int level, bool layered, Int layer, ImageAccess access, ImageFormat format);
         #endif
@@ -497,6 +615,12 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
         void invalidateImage(Int level);
         void generateMipmap();
 
+        #ifndef MAGNUM_TARGET_GLES
+        void setSparse(Int pageSizeIndex);
+        Int sparseLevelCount();
+        void commitPages(GLint level, const Vector3i& offset, const Vector3i& size, bool commit);
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         template<UnsignedInt dimensions> void image(GLint level, Image<dimensions>& image);
         template<UnsignedInt dimensions> void image(GLint level, BufferImage<dimensions>& image, BufferUsage usage);
@@ -718,6 +842,11 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
 
         GLuint _id;
         ObjectFlags _flags;
+        UnsignedInt _memoryCategory{};
+        std::size_t _memoryUsage{};
+        /* Sizes of levels specified with setImage(), empty for immutable
+           storage */
+        Containers::Array<std::size_t> _levelMemoryUsage;
 };
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -823,8 +952,10 @@ template<> struct MAGNUM_GL_EXPORT AbstractTexture::DataHelper<3> {
 };
 #endif
 
-inline AbstractTexture::AbstractTexture(AbstractTexture&& other) noexcept: _target{other._target}, _id{other._id}, _flags{other._flags} {
+inline AbstractTexture::AbstractTexture(AbstractTexture&& other) noexcept: _target{other._target}, _id{other._id}, _flags{other._flags}, _memoryCategory{other._memoryCategory}, _memoryUsage{other._memoryUsage}, _levelMemoryUsage{std::move(other._levelMemoryUsage)} {
     other._id = 0;
+    other._memoryCategory = 0;
+    other._memoryUsage = 0;
 }
 
 inline AbstractTexture& AbstractTexture::operator=(AbstractTexture&& other) noexcept {
@@ -832,10 +963,15 @@ inline AbstractTexture& AbstractTexture::operator=(AbstractTexture&& other) noex
     swap(_target, other._target);
     swap(_id, other._id);
     swap(_flags, other._flags);
+    swap(_memoryCategory, other._memoryCategory);
+    swap(_memoryUsage, other._memoryUsage);
+    swap(_levelMemoryUsage, other._levelMemoryUsage);
     return *this;
 }
 
 inline GLuint AbstractTexture::release() {
+    /* The released object is not tracked anymore */
+    if(_memoryUsage) setStorageMemoryUsageInternal(0);
     const GLuint id = _id;
     _id = 0;
     return id;
@@ -28,6 +28,7 @@
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Instrumentation.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Implementation/State.h"
@@ -174,8 +175,15 @@ void Buffer::createImplementationDSA() {
 #endif
 
 Buffer::~Buffer() {
-    /* Moved out or not deleting on destruction, nothing to do */
-    if(!_id || !(_flags & ObjectFlag::DeleteOnDestruction)) return;
+    /* Moved out, nothing to do */
+    if(!_id) return;
+
+    /* Remove from memory usage accounting even if the object itself isn't
+       deleted, as nothing would track it anymore */
+    if(_memoryUsage) setMemoryUsageInternal(0);
+
+    /* Not deleting on destruction, nothing else to do */
+    if(!(_flags & ObjectFlag::DeleteOnDestruction)) return;
 
     GLuint* bindings = Context::current().state().buffer->bindings;
 
@@ -183,6 +191,14 @@ Buffer::~Buffer() {
     for(std::size_t i = 1; i != Implementation::BufferState::TargetCount; ++i)
         if(bindings[i] == _id) bindings[i] = 0;
 
+    /* Deleting the buffer detaches it from vertex attributes, force them to
+       be respecified on next draw in case the ID gets reused */
+    for(Implementation::MeshState::VertexAttribute& attribute: Context::current().state().mesh->vertexAttributes)
+        if(attribute.buffer == _id) attribute.buffer = 0;
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    ++Context::current().state().mesh->layoutBindingGeneration;
+    #endif
+
     glDeleteBuffers(1, &_id);
 }
 
@@ -215,34 +231,55 @@ Buffer& Buffer::setLabelInternal(const Containers::ArrayView<const char> label)
     #else
     Context::current().state().debug->labelImplementation(GL_BUFFER_KHR, _id, label);
     #endif
+
+    /* Move the memory usage to the category given by the label */
+    Context& context = Context::current();
+    const UnsignedInt category = context.memoryUsageCategoryInternal(label);
+    context.updateMemoryUsageInternal(&Context::MemoryUsage::bufferSize, _memoryCategory, _memoryUsage, category, _memoryUsage);
     return *this;
 }
 #endif
 
+void Buffer::setMemoryUsageInternal(const std::size_t size) {
+    Context::current().updateMemoryUsageInternal(&Context::MemoryUsage::bufferSize, _memoryCategory, _memoryUsage, _memoryCategory, size);
+}
+
 void Buffer::bindInternal(const TargetHint target, Buffer* const buffer) {
     const GLuint id = buffer ? buffer->_id : 0;
-    GLuint& bound = Context::current().state().buffer->bindings[Implementation::BufferState::indexForTarget(target)];
+    Context& context = Context::current();
+    GLuint& bound = context.state().buffer->bindings[Implementation::BufferState::indexForTarget(target)];
 
     /* Already bound, nothing to do */
-    if(bound == id) return;
+    if(bound == id) {
+        ++context.statisticsInternal().elidedBindCount;
+        return;
+    }
 
     /* Bind the buffer otherwise, which will also finally create it */
     bound = id;
+    ++context.statisticsInternal().bindCount;
     if(buffer) buffer->_flags |= ObjectFlag::Created;
     glBindBuffer(GLenum(target), id);
 }
 
 auto Buffer::bindSomewhereInternal(const TargetHint hint) -> TargetHint {
-    GLuint* bindings = Context::current().state().buffer->bindings;
+    Context& context = Context::current();
+    GLuint* bindings = context.state().buffer->bindings;
     GLuint& hintBinding = bindings[Implementation::BufferState::indexForTarget(hint)];
 
     /* Shortcut - if already bound to hint, return */
-    if(hintBinding == _id) return hint;
+    if(hintBinding == _id) {
+        ++context.statisticsInternal().elidedBindCount;
+        return hint;
+    }
 
     /* Return first target in which the buffer is bound */
     /** @todo wtf there is one more? */
-    for(std::size_t i = 1; i != Implementation::BufferState::TargetCount; ++i)
-        if(bindings[i] == _id) return Implementation::BufferState::targetForIndex[i-1];
+    for(std::size_t i = 1; i != Implementation::BufferState::TargetCount; ++i) {
+        if(bindings[i] != _id) continue;
+        ++context.statisticsInternal().elidedBindCount;
+        return Implementation::BufferState::targetForIndex[i-1];
+    }
 
     /* Sorry, this is ugly because GL is also ugly. Blame GL, not me.
 
@@ -251,15 +288,16 @@ auto Buffer::bindSomewhereInternal(const TargetHint hint) -> TargetHint {
        prevent accidental modification of that VAO. See
        Test::MeshGLTest::unbindVAOwhenSettingIndexBufferData() for details. */
     if(hint == TargetHint::ElementArray) {
-        auto& currentVAO = Context::current().state().mesh->currentVAO;
+        auto& currentVAO = context.state().mesh->currentVAO;
         /* It can be also State::DisengagedBinding, in which case we unbind as
            well to be sure */
         if(currentVAO != 0)
-            Context::current().state().mesh->bindVAOImplementation(0);
+            context.state().mesh->bindVAOImplementation(0);
     }
 
     /* Bind the buffer to hint target otherwise */
     hintBinding = _id;
+    ++context.statisticsInternal().bindCount;
     _flags |= ObjectFlag::Created;
     glBindBuffer(GLenum(hint), _id);
     return hint;
@@ -294,12 +332,28 @@ Containers::Array<char> Buffer::data() {
 #endif
 
 Buffer& Buffer::setData(const Containers::ArrayView<const void> data, const BufferUsage usage) {
-    (this->*Context::current().state().buffer->dataImplementation)(data.size(), data, usage);
+    MAGNUM_INSTRUMENTATION_SCOPE("GL::Buffer::setData()");
+    Context& context = Context::current();
+    context.statisticsInternal().bufferUploadSize += data.size();
+    (this->*context.state().buffer->dataImplementation)(data.size(), data, usage);
+    context.updateMemoryUsageInternal(&Context::MemoryUsage::bufferSize, _memoryCategory, _memoryUsage, _memoryCategory, data.size());
+    return *this;
+}
+
+#ifndef MAGNUM_TARGET_GLES
+Buffer& Buffer::setStorage(const Containers::ArrayView<const void> data, const StorageFlags flags) {
+    Context& context = Context::current();
+    context.statisticsInternal().bufferUploadSize += data.size();
+    (this->*context.state().buffer->storageImplementation)(data.size(), data, flags);
+    context.updateMemoryUsageInternal(&Context::MemoryUsage::bufferSize, _memoryCategory, _memoryUsage, _memoryCategory, data.size());
     return *this;
 }
+#endif
 
 Buffer& Buffer::setSubData(const GLintptr offset, const Containers::ArrayView<const void> data) {
-    (this->*Context::current().state().buffer->subDataImplementation)(offset, data.size(), data);
+    Context& context = Context::current();
+    context.statisticsInternal().bufferUploadSize += data.size();
+    (this->*context.state().buffer->subDataImplementation)(offset, data.size(), data);
     return *this;
 }
 
@@ -464,6 +518,21 @@ void Buffer::dataImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, Buffe
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void Buffer::storageImplementationDefault(GLsizeiptr size, const GLvoid* data, StorageFlags flags) {
+    glBufferStorage(GLenum(bindSomewhereInternal(_targetHint)), size, data, GLbitfield(flags));
+}
+
+void Buffer::storageImplementationDSA(const GLsizeiptr size, const GLvoid* const data, const StorageFlags flags) {
+    glNamedBufferStorage(_id, size, data, GLbitfield(flags));
+}
+
+void Buffer::storageImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, StorageFlags flags) {
+    _flags |= ObjectFlag::Created;
+    glNamedBufferStorageEXT(_id, size, data, GLbitfield(flags));
+}
+#endif
+
 void Buffer::subDataImplementationDefault(GLintptr offset, GLsizeiptr size, const GLvoid* data) {
     glBufferSubData(GLenum(bindSomewhereInternal(_targetHint)), offset, size, data);
 }
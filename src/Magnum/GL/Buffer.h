@@ -497,9 +497,33 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
              * before mapping.
              */
             #ifndef MAGNUM_TARGET_GLES2
-            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT
+            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT,
             #else
-            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT_EXT
+            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT_EXT,
+            #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * The buffer may stay mapped while it's used by the GPU, for
+             * example as a source for texture uploads. The buffer storage has
+             * to be created using @ref setStorage() with
+             * @ref StorageFlag::MapPersistent.
+             * @requires_gl44 Extension @gl_extension{ARB,buffer_storage}
+             * @requires_gl Persistent buffer mapping is not available in
+             *      OpenGL ES and WebGL.
+             */
+            Persistent = GL_MAP_PERSISTENT_BIT,
+
+            /**
+             * Writes to a persistent mapping are visible to the GPU without
+             * an explicit @ref flushMappedRange() or a memory barrier. The
+             * buffer storage has to be created using @ref setStorage() with
+             * @ref StorageFlag::MapCoherent.
+             * @requires_gl44 Extension @gl_extension{ARB,buffer_storage}
+             * @requires_gl Persistent buffer mapping is not available in
+             *      OpenGL ES and WebGL.
+             */
+            Coherent = GL_MAP_COHERENT_BIT,
             #endif
         };
 
@@ -515,6 +539,51 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
         typedef Containers::EnumSet<MapFlag> MapFlags;
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Buffer storage flag
+         *
+         * @see @ref StorageFlags, @ref setStorage()
+         * @m_enum_values_as_keywords
+         * @requires_gl44 Extension @gl_extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL
+         *      ES and WebGL.
+         */
+        enum class StorageFlag: GLbitfield {
+            /** Allow the buffer to be mapped for reading. */
+            MapRead = GL_MAP_READ_BIT,
+
+            /** Allow the buffer to be mapped for writing. */
+            MapWrite = GL_MAP_WRITE_BIT,
+
+            /**
+             * Allow the buffer to be mapped with @ref MapFlag::Persistent.
+             */
+            MapPersistent = GL_MAP_PERSISTENT_BIT,
+
+            /** Allow the buffer to be mapped with @ref MapFlag::Coherent. */
+            MapCoherent = GL_MAP_COHERENT_BIT,
+
+            /**
+             * Allow the contents to be updated using @ref setSubData().
+             */
+            DynamicStorage = GL_DYNAMIC_STORAGE_BIT,
+
+            /** Prefer the storage to be allocated in client memory. */
+            ClientStorage = GL_CLIENT_STORAGE_BIT
+        };
+
+        /**
+         * @brief Buffer storage flags
+         *
+         * @see @ref setStorage()
+         * @requires_gl44 Extension @gl_extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL
+         *      ES and WebGL.
+         */
+        typedef Containers::EnumSet<StorageFlag> StorageFlags;
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         /**
          * @brief Minimal supported mapping alignment
@@ -845,7 +914,9 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
          * Default is empty string. If OpenGL 4.3 / OpenGL ES 3.2 is not
          * supported and neither @gl_extension{KHR,debug} (covered also by
          * @gl_extension{ANDROID,extension_pack_es31a}) nor @gl_extension{EXT,debug_label}
-         * desktop or ES extension is available, this function does nothing.
+         * desktop or ES extension is available, this function does nothing,
+         * but the label is still used as a category for
+         * @ref Context::memoryUsage(const std::string&) const.
          * @see @ref maxLabelLength(), @fn_gl_keyword{ObjectLabel} with
          *      @def_gl{BUFFER} or @fn_gl_extension_keyword{LabelObject,EXT,debug_label}
          *      with @def_gl{BUFFER_OBJECT_EXT}
@@ -948,6 +1019,17 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
          */
         Int size();
 
+        /**
+         * @brief GPU memory usage
+         *
+         * Size of the data store allocated by the last @ref setData() or
+         * @ref setStorage() call, @cpp 0 @ce if no data store was allocated
+         * yet. Unlike @ref size() it doesn't query the driver. The value is
+         * summed in @ref Context::memoryUsage() and can be also used as a
+         * resource size for @ref ResourceManager-budget "ResourceManager memory budgets".
+         */
+        std::size_t memoryUsage() const { return _memoryUsage; }
+
         #ifndef MAGNUM_TARGET_GLES
         /**
          * @brief Buffer data
@@ -1034,6 +1116,33 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set immutable buffer storage
+         * @param data      Data or @cpp nullptr @ce paired with a size to
+         *      allocate uninitialized storage
+         * @param flags     Storage flags
+         * @return Reference to self (for method chaining)
+         *
+         * Unlike @ref setData(), the size and the flags can't be changed
+         * afterwards. Storage created with @ref StorageFlag::MapPersistent
+         * can stay mapped while the buffer is used by the GPU, see
+         * @ref MapFlag::Persistent. If neither
+         * @gl_extension{ARB,direct_state_access} (part of OpenGL 4.5) nor
+         * @gl_extension{EXT,direct_state_access} desktop extension is
+         * available, the buffer is bound to hinted target before the
+         * operation (if not already).
+         * @see @ref setTargetHint(),
+         *      @fn_gl2_keyword{NamedBufferStorage,BufferStorage},
+         *      @fn_gl_extension_keyword{NamedBufferStorage,EXT,direct_state_access},
+         *      eventually @fn_gl{BindBuffer} and @fn_gl_keyword{BufferStorage}
+         * @requires_gl44 Extension @gl_extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL
+         *      ES and WebGL.
+         */
+        Buffer& setStorage(Containers::ArrayView<const void> data, StorageFlags flags);
+        #endif
+
         /**
          * @brief Set buffer subdata
          * @param offset    Byte offset in the buffer
@@ -1262,6 +1371,8 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
         Buffer& setLabelInternal(Containers::ArrayView<const char> label);
         #endif
 
+        void setMemoryUsageInternal(std::size_t size);
+
         #if !defined(MAGNUM_TARGET_GLES) && defined(MAGNUM_BUILD_DEPRECATED)
         CORRADE_DEPRECATED("used only by deprecated subData<T>()") void subDataInternal(GLintptr offset, GLsizeiptr size, GLvoid* data);
         #endif
@@ -1284,6 +1395,12 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
         void MAGNUM_GL_LOCAL dataImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, BufferUsage usage);
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_GL_LOCAL storageImplementationDefault(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        void MAGNUM_GL_LOCAL storageImplementationDSA(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        void MAGNUM_GL_LOCAL storageImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        #endif
+
         void MAGNUM_GL_LOCAL subDataImplementationDefault(GLintptr offset, GLsizeiptr size, const GLvoid* data);
         #ifndef MAGNUM_TARGET_GLES
         void MAGNUM_GL_LOCAL subDataImplementationDSA(GLintptr offset, GLsizeiptr size, const GLvoid* data);
@@ -1329,12 +1446,18 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
         GLuint _id;
         TargetHint _targetHint;
         ObjectFlags _flags;
+        UnsignedInt _memoryCategory{};
+        std::size_t _memoryUsage{};
 };
 
 #ifndef MAGNUM_TARGET_WEBGL
 CORRADE_ENUMSET_OPERATORS(Buffer::MapFlags)
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+CORRADE_ENUMSET_OPERATORS(Buffer::StorageFlags)
+#endif
+
 /** @debugoperatorclassenum{Buffer,Buffer::TargetHint} */
 MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, Buffer::TargetHint value);
 
@@ -1345,8 +1468,10 @@ MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, Buffer::Target value);
 
 inline Buffer::Buffer(NoCreateT) noexcept: _id{0}, _targetHint{TargetHint::Array}, _flags{ObjectFlag::DeleteOnDestruction} {}
 
-inline Buffer::Buffer(Buffer&& other) noexcept: _id{other._id}, _targetHint{other._targetHint}, _flags{other._flags} {
+inline Buffer::Buffer(Buffer&& other) noexcept: _id{other._id}, _targetHint{other._targetHint}, _flags{other._flags}, _memoryCategory{other._memoryCategory}, _memoryUsage{other._memoryUsage} {
     other._id = 0;
+    other._memoryCategory = 0;
+    other._memoryUsage = 0;
 }
 
 inline Buffer& Buffer::operator=(Buffer&& other) noexcept {
@@ -1354,10 +1479,14 @@ inline Buffer& Buffer::operator=(Buffer&& other) noexcept {
     swap(_id, other._id);
     swap(_targetHint, other._targetHint);
     swap(_flags, other._flags);
+    swap(_memoryCategory, other._memoryCategory);
+    swap(_memoryUsage, other._memoryUsage);
     return *this;
 }
 
 inline GLuint Buffer::release() {
+    /* The released object is not tracked anymore */
+    if(_memoryUsage) setMemoryUsageInternal(0);
     const GLuint id = _id;
     _id = 0;
     return id;
@@ -0,0 +1,211 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BufferAllocator.h"
+
+#include <algorithm>
+#include <iterator>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace GL {
+
+BufferAllocator::Block::Block(Buffer&& buffer, const std::size_t size): buffer{std::move(buffer)}, size{size} {}
+
+BufferAllocator::BufferAllocator(const std::size_t blockSize, const Buffer::TargetHint targetHint, const BufferUsage usage): _blockSize{blockSize}, _targetHint{targetHint}, _usage{usage} {
+    CORRADE_ASSERT(blockSize,
+        "GL::BufferAllocator: expected non-zero block size", );
+}
+
+BufferAllocator::BufferAllocator(NoCreateT) noexcept: _blockSize{}, _targetHint{Buffer::TargetHint::Array}, _usage{BufferUsage::StaticDraw} {}
+
+BufferAllocator::BufferAllocator(BufferAllocator&& other) noexcept: _blockSize{other._blockSize}, _targetHint{other._targetHint}, _usage{other._usage}, _blocks{std::move(other._blocks)} {
+    other._blockSize = 0;
+}
+
+BufferAllocator::~BufferAllocator() = default;
+
+BufferAllocator& BufferAllocator::operator=(BufferAllocator&& other) noexcept {
+    using std::swap;
+    swap(_blockSize, other._blockSize);
+    swap(_targetHint, other._targetHint);
+    swap(_usage, other._usage);
+    swap(_blocks, other._blocks);
+    return *this;
+}
+
+Buffer& BufferAllocator::buffer(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _blocks.size(),
+        "GL::BufferAllocator::buffer(): index" << id << "out of range for" << _blocks.size() << "buffers", _blocks[id].buffer);
+    return _blocks[id].buffer;
+}
+
+void BufferAllocator::insertFree(Block& block, const std::size_t offset, const std::size_t size) {
+    block.freeByOffset.emplace(offset, size);
+    block.freeBySize.emplace(size, offset);
+}
+
+void BufferAllocator::eraseFree(Block& block, const std::map<std::size_t, std::size_t>::iterator it) {
+    auto range = block.freeBySize.equal_range(it->second);
+    for(auto i = range.first; i != range.second; ++i) if(i->second == it->first) {
+        block.freeBySize.erase(i);
+        break;
+    }
+    block.freeByOffset.erase(it);
+}
+
+auto BufferAllocator::allocateInternal(const std::size_t size, const std::size_t alignment, const std::size_t maxBlock, const std::size_t maxOffset) -> Allocation {
+    for(std::size_t i = 0; i != std::min(maxBlock + 1, _blocks.size()); ++i) {
+        Block& block = _blocks[i];
+        const std::size_t end = i == maxBlock ? maxOffset : block.size;
+
+        /* Free ranges are sorted by size, so the first that fits is the best
+           fit. Only the alignment padding can make a range unusable. */
+        for(auto it = block.freeBySize.lower_bound(size); it != block.freeBySize.end(); ++it) {
+            const std::size_t rangeOffset = it->second;
+            const std::size_t rangeEnd = rangeOffset + it->first;
+            const std::size_t offset = (rangeOffset + alignment - 1)/alignment*alignment;
+            if(offset + size > rangeEnd || offset + size > end) continue;
+
+            eraseFree(block, block.freeByOffset.find(rangeOffset));
+            if(offset != rangeOffset)
+                insertFree(block, rangeOffset, offset - rangeOffset);
+            if(offset + size != rangeEnd)
+                insertFree(block, offset + size, rangeEnd - offset - size);
+
+            block.used.emplace(offset, std::make_pair(size, alignment));
+            return Allocation{UnsignedInt(i), GLintptr(offset), GLsizeiptr(size)};
+        }
+    }
+
+    return {};
+}
+
+auto BufferAllocator::allocate(const std::size_t size, const std::size_t alignment) -> Allocation {
+    CORRADE_ASSERT(alignment,
+        "GL::BufferAllocator::allocate(): expected non-zero alignment", {});
+    CORRADE_ASSERT(_blockSize,
+        "GL::BufferAllocator::allocate(): the allocator is moved-out or not created", {});
+
+    if(!size) return {};
+
+    if(Allocation allocation = allocateInternal(size, alignment, _blocks.size() - 1, ~std::size_t{}))
+        return allocation;
+
+    /* Not enough space anywhere, create a new block. Offset 0 satisfies any
+       alignment, so the block doesn't need to be larger than the data. */
+    const std::size_t blockSize = std::max(_blockSize, size);
+    Buffer buffer{_targetHint};
+    buffer.setData({nullptr, blockSize}, _usage);
+    _blocks.emplace_back(std::move(buffer), blockSize);
+    insertFree(_blocks.back(), 0, blockSize);
+
+    Allocation allocation = allocateInternal(size, alignment, _blocks.size() - 1, ~std::size_t{});
+    CORRADE_INTERNAL_ASSERT(allocation.buffer == _blocks.size() - 1);
+    return allocation;
+}
+
+auto BufferAllocator::upload(const Containers::ArrayView<const void> data, const std::size_t alignment) -> Allocation {
+    const Allocation allocation = allocate(data.size(), alignment);
+    if(allocation) _blocks[allocation.buffer].buffer.setSubData(allocation.offset, data);
+    return allocation;
+}
+
+void BufferAllocator::deallocate(const Allocation& allocation) {
+    if(!allocation) return;
+
+    CORRADE_ASSERT(allocation.buffer < _blocks.size(),
+        "GL::BufferAllocator::deallocate(): buffer index" << allocation.buffer << "out of range for" << _blocks.size() << "buffers", );
+    Block& block = _blocks[allocation.buffer];
+    auto found = block.used.find(allocation.offset);
+    CORRADE_ASSERT(found != block.used.end() && found->second.first == std::size_t(allocation.size),
+        "GL::BufferAllocator::deallocate(): no allocation of" << allocation.size << "bytes at offset" << allocation.offset << "in buffer" << allocation.buffer, );
+    block.used.erase(found);
+
+    /* Merge with free neighbors */
+    std::size_t offset = allocation.offset;
+    std::size_t size = allocation.size;
+    auto next = block.freeByOffset.lower_bound(offset);
+    if(next != block.freeByOffset.begin()) {
+        auto prev = std::prev(next);
+        if(prev->first + prev->second == offset) {
+            offset = prev->first;
+            size += prev->second;
+            eraseFree(block, prev);
+        }
+    }
+    if(next != block.freeByOffset.end() && next->first == allocation.offset + std::size_t(allocation.size)) {
+        size += next->second;
+        eraseFree(block, next);
+    }
+
+    insertFree(block, offset, size);
+}
+
+auto BufferAllocator::statistics() const -> Statistics {
+    Statistics out{};
+    out.bufferCount = _blocks.size();
+    for(const Block& block: _blocks) {
+        out.allocationCount += block.used.size();
+        out.capacity += block.size;
+        for(const auto& used: block.used) out.usedSize += used.second.first;
+        out.freeRangeCount += block.freeByOffset.size();
+        if(!block.freeBySize.empty())
+            out.largestFreeRange = std::max(out.largestFreeRange, block.freeBySize.rbegin()->first);
+    }
+    return out;
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+std::vector<BufferAllocator::Relocation> BufferAllocator::defragment() {
+    std::vector<Relocation> relocations;
+
+    for(std::size_t i = _blocks.size(); i != 0; --i) {
+        /* Collect the allocations first, as the map gets modified by the
+           moves */
+        std::vector<Allocation> allocations;
+        allocations.reserve(_blocks[i - 1].used.size());
+        for(const auto& used: _blocks[i - 1].used)
+            allocations.push_back(Allocation{UnsignedInt(i - 1), GLintptr(used.first), GLsizeiptr(used.second.first)});
+
+        for(auto it = allocations.rbegin(); it != allocations.rend(); ++it) {
+            const std::size_t alignment = _blocks[i - 1].used.at(it->offset).second;
+
+            /* Allocate the new place first so it can't overlap the original,
+               which glCopyBufferSubData() doesn't allow */
+            const Allocation to = allocateInternal(it->size, alignment, i - 1, it->offset);
+            if(!to) continue;
+
+            Buffer::copy(_blocks[i - 1].buffer, _blocks[to.buffer].buffer, it->offset, to.offset, it->size);
+            deallocate(*it);
+            relocations.push_back(Relocation{*it, to});
+        }
+    }
+
+    return relocations;
+}
+#endif
+
+}}
@@ -0,0 +1,299 @@
+#ifndef Magnum_GL_BufferAllocator_h
+#define Magnum_GL_BufferAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::GL::BufferAllocator
+ */
+
+#include <map>
+#include <vector>
+
+#include "Magnum/GL/Buffer.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Sub-allocator for placing data of many meshes in a few buffers
+
+Instead of creating a separate @ref Buffer for vertex and index data of each
+small mesh, allocates fixed-size blocks of buffer memory and places the data
+of many meshes in them. With thousands of small meshes this saves both the
+buffer object overhead in the driver and buffer binding changes when
+drawing, especially in combination with @ref MeshLayout.
+
+@section GL-BufferAllocator-usage Usage
+
+Each @ref allocate() returns an @ref Allocation describing the buffer index
+and offset in it, @ref upload() additionally copies given data there. The
+buffer is then retrieved using @ref buffer() and passed to the mesh together
+with the offset:
+
+@code{.cpp}
+GL::BufferAllocator allocator{4*1024*1024};
+
+GL::BufferAllocator::Allocation vertices = allocator.upload(vertexData);
+GL::BufferAllocator::Allocation indices = allocator.upload(indexData);
+
+mesh.addVertexBuffer(allocator.buffer(vertices.buffer), vertices.offset,
+        Shaders::Phong::Position{}, Shaders::Phong::Normal{})
+    .setIndexBuffer(allocator.buffer(indices.buffer), indices.offset,
+        MeshIndexType::UnsignedShort)
+    .setCount(indexCount);
+
+// ...
+
+allocator.deallocate(vertices);
+allocator.deallocate(indices);
+@endcode
+
+Note that on @ref MAGNUM_TARGET_WEBGL "WebGL" a buffer can't be used for both
+vertex and index data, use a separate allocator with
+@ref Buffer::TargetHint::ElementArray for indices there.
+
+@section GL-BufferAllocator-allocation Allocation strategy
+
+Free ranges in each buffer are kept sorted by size and the smallest one that
+fits the aligned allocation is picked, preferring buffers that were created
+earlier. Freed ranges are merged with their free neighbors, so freeing all
+allocations in a buffer makes the whole buffer available again. If no buffer
+has enough space, a new one of @ref blockSize() bytes is created --- or larger,
+if the allocation alone is larger than that.
+
+Allocating and freeing differently sized data over a long time may leave the
+buffers fragmented, see @ref statistics() for a way to detect it. Calling
+@ref defragment() then moves the allocations towards the front, returning
+the list of changed offsets so the meshes can be updated.
+*/
+class MAGNUM_GL_EXPORT BufferAllocator {
+    public:
+        /**
+         * @brief Allocation
+         *
+         * @see @ref allocate(), @ref upload()
+         */
+        struct Allocation {
+            /** @brief Buffer index, to be passed to @ref buffer() */
+            UnsignedInt buffer;
+
+            /** @brief Offset in the buffer in bytes */
+            GLintptr offset;
+
+            /** @brief Size in bytes */
+            GLsizeiptr size;
+
+            /**
+             * @brief Whether the allocation is valid
+             *
+             * Returns @cpp false @ce for a default-constructed instance or
+             * for a failed zero-sized allocation.
+             */
+            explicit operator bool() const { return size; }
+        };
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Relocation done by @ref defragment()
+         */
+        struct Relocation {
+            /** @brief Original allocation */
+            Allocation from;
+
+            /** @brief Allocation the data were moved to */
+            Allocation to;
+        };
+        #endif
+
+        /**
+         * @brief Allocator statistics
+         *
+         * @see @ref statistics()
+         */
+        struct Statistics {
+            /** @brief Count of buffers */
+            UnsignedInt bufferCount;
+
+            /** @brief Count of live allocations */
+            std::size_t allocationCount;
+
+            /** @brief Total size of all buffers in bytes */
+            std::size_t capacity;
+
+            /** @brief Total size of live allocations in bytes */
+            std::size_t usedSize;
+
+            /**
+             * @brief Count of free ranges
+             *
+             * A high count compared to @ref bufferCount indicates a
+             * fragmented allocator.
+             */
+            std::size_t freeRangeCount;
+
+            /**
+             * @brief Size of the largest free range in bytes
+             *
+             * Allocations larger than this cause a new buffer to be created.
+             */
+            std::size_t largestFreeRange;
+        };
+
+        /**
+         * @brief Constructor
+         * @param blockSize     Size of each buffer in bytes
+         * @param targetHint    Target hint for the buffers
+         * @param usage         Usage of the buffers
+         *
+         * Expects that @p blockSize is non-zero. No buffers are created
+         * until the first allocation.
+         * @see @ref BufferAllocator(NoCreateT), @ref Buffer::setTargetHint()
+         */
+        explicit BufferAllocator(std::size_t blockSize, Buffer::TargetHint targetHint = Buffer::TargetHint::Array, BufferUsage usage = BufferUsage::StaticDraw);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL objects
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * @see @ref BufferAllocator(std::size_t, Buffer::TargetHint, BufferUsage)
+         */
+        explicit BufferAllocator(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        BufferAllocator(const BufferAllocator&) = delete;
+
+        /** @brief Move constructor */
+        BufferAllocator(BufferAllocator&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all buffers. Meshes referencing them have to be destroyed
+         * before.
+         */
+        ~BufferAllocator();
+
+        /** @brief Copying is not allowed */
+        BufferAllocator& operator=(const BufferAllocator&) = delete;
+
+        /** @brief Move assignment */
+        BufferAllocator& operator=(BufferAllocator&& other) noexcept;
+
+        /** @brief Size of each buffer in bytes */
+        std::size_t blockSize() const { return _blockSize; }
+
+        /** @brief Count of buffers */
+        UnsignedInt bufferCount() const { return _blocks.size(); }
+
+        /**
+         * @brief Buffer
+         *
+         * Expects that @p id is smaller than @ref bufferCount().
+         */
+        Buffer& buffer(UnsignedInt id);
+
+        /**
+         * @brief Allocate memory
+         * @param size          Size in bytes
+         * @param alignment     Alignment of the offset in the buffer
+         *
+         * Expects that @p alignment is non-zero. Creates a new buffer if
+         * none of the existing has enough space, see
+         * @ref GL-BufferAllocator-allocation for details. Zero-sized
+         * allocations return an invalid @ref Allocation.
+         */
+        Allocation allocate(std::size_t size, std::size_t alignment = 4);
+
+        /**
+         * @brief Allocate memory and upload data to it
+         *
+         * Calls @ref allocate() and then @ref Buffer::setSubData() on the
+         * result.
+         */
+        Allocation upload(Containers::ArrayView<const void> data, std::size_t alignment = 4);
+
+        /**
+         * @brief Free an allocation
+         *
+         * Expects that @p allocation was returned by @ref allocate() or
+         * @ref upload() and wasn't freed yet. Invalid allocations are
+         * ignored.
+         */
+        void deallocate(const Allocation& allocation);
+
+        /** @brief Allocator statistics */
+        Statistics statistics() const;
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Defragment the buffers
+         * @return List of moved allocations
+         *
+         * Goes through live allocations from the end and moves each to the
+         * best fitting free range that lies before it, copying the data with
+         * @ref Buffer::copy(). All allocations in the returned list are
+         * invalidated and the meshes using them have to be updated with the
+         * new offsets. Buffers are not deleted, as that would change indices
+         * of the ones after.
+         * @requires_gl31 Extension @gl_extension{ARB,copy_buffer}
+         * @requires_gles30 Buffer copying is not available in OpenGL ES 2.0.
+         * @requires_webgl20 Buffer copying is not available in WebGL 1.0.
+         */
+        std::vector<Relocation> defragment();
+        #endif
+
+    private:
+        struct Block {
+            explicit Block(Buffer&& buffer, std::size_t size);
+
+            Buffer buffer;
+            std::size_t size;
+            /* Free ranges, offset -> size and size -> offset */
+            std::map<std::size_t, std::size_t> freeByOffset;
+            std::multimap<std::size_t, std::size_t> freeBySize;
+            /* Live allocations, offset -> (size, alignment) */
+            std::map<std::size_t, std::pair<std::size_t, std::size_t>> used;
+        };
+
+        /* Tries to allocate in blocks up to and including maxBlock, in
+           maxBlock ending at maxOffset at most */
+        MAGNUM_GL_LOCAL Allocation allocateInternal(std::size_t size, std::size_t alignment, std::size_t maxBlock, std::size_t maxOffset);
+        MAGNUM_GL_LOCAL static void insertFree(Block& block, std::size_t offset, std::size_t size);
+        MAGNUM_GL_LOCAL static void eraseFree(Block& block, std::map<std::size_t, std::size_t>::iterator it);
+
+        std::size_t _blockSize;
+        Buffer::TargetHint _targetHint;
+        BufferUsage _usage;
+        std::vector<Block> _blocks;
+};
+
+}}
+
+#endif
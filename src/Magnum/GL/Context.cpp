@@ -25,12 +25,13 @@
 
 #include "Context.h"
 
-#ifndef MAGNUM_TARGET_GLES
-#include <algorithm> /* std::find in isCoreProfileImplementationNV() */
-#endif
+#include <algorithm>
+#include <cstring>
 #include <iostream> /* for initialization log redirection */
 #include <string>
-#include <unordered_map>
+#ifdef MAGNUM_BUILD_MULTITHREADED
+#include <mutex>
+#endif
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Debug.h>
@@ -95,7 +96,8 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(KHR,texture_compression_astc_ldr),
         _extension(KHR,texture_compression_astc_hdr),
         _extension(KHR,blend_equation_advanced),
-        _extension(KHR,blend_equation_advanced_coherent)};
+        _extension(KHR,blend_equation_advanced_coherent),
+        _extension(KHR,parallel_shader_compile)};
     static const std::vector<Extension> extensions300{
         _extension(ARB,map_buffer_range),
         _extension(ARB,color_buffer_float),
@@ -292,6 +294,7 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(KHR,blend_equation_advanced_coherent),
         _extension(KHR,context_flush_control),
         _extension(KHR,no_error),
+        _extension(KHR,parallel_shader_compile),
         _extension(NV,read_buffer_front),
         _extension(NV,read_depth),
         _extension(NV,read_stencil),
@@ -440,6 +443,48 @@ namespace {
     #endif
     #endif
     Context* currentContext = nullptr;
+
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    /* GL function pointers are process-wide. Reloading them while another
+       thread calls through them is a data race, so they're loaded only by
+       the first live context and never again until all contexts using them
+       are destroyed. The counter is incremented by each context that went
+       through tryCreate() and decremented on its destruction. */
+    std::mutex functionLoaderMutex;
+    void(*loadedFunctionLoader)() = nullptr;
+    std::size_t functionLoaderUserCount = 0;
+    #endif
+
+    /* Extension string that's not necessarily null-terminated, used for
+       looking up extensions directly in the memory returned by glGetString()
+       without allocating a copy */
+    struct ExtensionString {
+        const char* data;
+        std::size_t size;
+    };
+
+    bool operator<(const Extension& a, const ExtensionString& b) {
+        const int result = std::strncmp(a.string(), b.data, b.size);
+        /* If the prefix matches, a is less only if it's shorter than b, which
+           can't happen as b has no null byte in the first b.size chars */
+        return result < 0;
+    }
+
+    bool operator<(const ExtensionString& a, const Extension& b) {
+        const int result = std::strncmp(a.data, b.string(), a.size);
+        /* If the prefix matches, a is less if b is longer */
+        return result < 0 || (result == 0 && b.string()[a.size] != '\0');
+    }
+
+    bool extensionStringLess(const Extension& a, const Extension& b) {
+        return std::strcmp(a.string(), b.string()) < 0;
+    }
+
+    /* Binary search in a list sorted with extensionStringLess() */
+    const Extension* findExtension(const std::vector<Extension>& sorted, const ExtensionString string) {
+        const auto found = std::equal_range(sorted.begin(), sorted.end(), string);
+        return found.first == found.second ? nullptr : &*found.first;
+    }
 }
 
 bool Context::hasCurrent() { return currentContext; }
@@ -449,6 +494,10 @@ Context& Context::current() {
     return *currentContext;
 }
 
+void Context::makeCurrent(Context* const context) {
+    currentContext = context;
+}
+
 Context::Context(NoCreateT, Int argc, const char** argv, void functionLoader()): Context{NoCreate, Utility::Arguments{"magnum"}, argc, argv, functionLoader} {}
 
 Context::Context(NoCreateT, Utility::Arguments& args, Int argc, const char** argv, void functionLoader()): _functionLoader{functionLoader}, _version{Version::None} {
@@ -483,15 +532,27 @@ Context::Context(Context&& other): _version{other._version},
     _extensionStatus{other._extensionStatus},
     _supportedExtensions{std::move(other._supportedExtensions)},
     _state{other._state},
-    _detectedDrivers{std::move(other._detectedDrivers)}
+    _statistics{other._statistics},
+    _memoryUsage{other._memoryUsage},
+    _memoryUsageCategories{std::move(other._memoryUsageCategories)},
+    _detectedDrivers{std::move(other._detectedDrivers)},
+    _usesFunctionLoader{other._usesFunctionLoader}
 {
     other._state = nullptr;
+    other._usesFunctionLoader = false;
     if(currentContext == &other) currentContext = this;
 }
 
 Context::~Context() {
     delete _state;
 
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    if(_usesFunctionLoader) {
+        std::lock_guard<std::mutex> lock{functionLoaderMutex};
+        --functionLoaderUserCount;
+    }
+    #endif
+
     if(currentContext == this) currentContext = nullptr;
 }
 
@@ -504,8 +565,24 @@ bool Context::tryCreate() {
     CORRADE_ASSERT(_version == Version::None,
         "Platform::Context::tryCreate(): context already created", false);
 
-    /* Load GL function pointers */
-    if(_functionLoader) _functionLoader();
+    /* Load GL function pointers. With multiple threads each having its own
+       context, only the first live context loads them, see above. There's
+       just one set of pointers, so if a context uses a different loader than
+       the one that's live, the only safe option is reusing them. */
+    if(_functionLoader) {
+        #ifdef MAGNUM_BUILD_MULTITHREADED
+        std::lock_guard<std::mutex> lock{functionLoaderMutex};
+        if(!functionLoaderUserCount) {
+            _functionLoader();
+            loadedFunctionLoader = _functionLoader;
+        } else if(loadedFunctionLoader != _functionLoader)
+            Warning{} << "GL::Context: function pointers already loaded by another live context with a different loader, reusing them";
+        ++functionLoaderUserCount;
+        _usesFunctionLoader = true;
+        #else
+        _functionLoader();
+        #endif
+    }
 
     /* Initialize to something predictable to avoid crashes on improperly
        created contexts */
@@ -651,21 +728,55 @@ bool Context::tryCreate() {
 
     /* List of extensions from future versions (extensions from current and
        previous versions should be supported automatically, so we don't need
-       to check for them) */
-    std::unordered_map<std::string, Extension> futureExtensions;
-    for(std::size_t i = future; i != versions.size(); ++i)
-        for(const Extension& extension: Extension::extensions(versions[i]))
-            futureExtensions.emplace(extension.string(), extension);
-
-    /* Check for presence of future and vendor extensions */
-    const std::vector<std::string> extensions = extensionStrings();
-    for(const std::string& extension: extensions) {
-        const auto found = futureExtensions.find(extension);
-        if(found != futureExtensions.end()) {
-            _supportedExtensions.push_back(found->second);
-            _extensionStatus.set(found->second.index());
+       to check for them), sorted for a binary search */
+    std::vector<Extension> futureExtensions;
+    for(std::size_t i = future; i != versions.size(); ++i) {
+        const std::vector<Extension>& extensions = Extension::extensions(versions[i]);
+        futureExtensions.insert(futureExtensions.end(), extensions.begin(), extensions.end());
+    }
+    std::sort(futureExtensions.begin(), futureExtensions.end(), extensionStringLess);
+
+    /* Check for presence of future and vendor extensions. The strings are
+       matched directly in the driver-provided memory to avoid allocating a
+       std::string for each of (potentially hundreds of) them. */
+    const auto addExtension = [&](const ExtensionString string) {
+        if(const Extension* found = findExtension(futureExtensions, string)) {
+            _supportedExtensions.push_back(*found);
+            _extensionStatus.set(found->index());
+        }
+    };
+    #ifndef MAGNUM_TARGET_GLES2
+    GLint extensionCount = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    #ifndef MAGNUM_TARGET_GLES3
+    if(extensionCount || isVersionSupported(Version::GL300))
+    #endif
+    {
+        for(GLint i = 0; i != extensionCount; ++i) {
+            const char* const extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+            if(extension) addExtension({extension, std::strlen(extension)});
+        }
+    }
+    #ifndef MAGNUM_TARGET_GLES3
+    else
+    #endif
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES3
+    /* OpenGL 2.1 / OpenGL ES 2.0 doesn't have glGetStringi(), go through the
+       space-separated list instead */
+    {
+        /* Don't crash when glGetString() returns nullptr (i.e. don't trust the
+           old implementations) */
+        const char* e = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+        if(e) while(*e) {
+            const std::size_t size = std::strcspn(e, " ");
+            if(size) addExtension({e, size});
+            e += size;
+            while(*e == ' ') ++e;
         }
     }
+    #endif
 
     /* Reset minimal required version to Version::None for whole array */
     for(auto& i: _extensionRequiredVersion) i = Version::None;
@@ -695,20 +806,22 @@ bool Context::tryCreate() {
     if(!_disabledExtensions.empty()) {
         Debug{output} << "Disabling extensions:";
 
-        /* Put remaining extensions into the hashmap for faster lookup */
-        std::unordered_map<std::string, Extension> allExtensions{std::move(futureExtensions)};
-        for(std::size_t i = 0; i != future; ++i)
-            for(const Extension& extension: Extension::extensions(versions[i]))
-                allExtensions.emplace(extension.string(), extension);
+        /* Put remaining extensions into the sorted list for faster lookup */
+        std::vector<Extension> allExtensions{std::move(futureExtensions)};
+        for(std::size_t i = 0; i != future; ++i) {
+            const std::vector<Extension>& extensions = Extension::extensions(versions[i]);
+            allExtensions.insert(allExtensions.end(), extensions.begin(), extensions.end());
+        }
+        std::sort(allExtensions.begin(), allExtensions.end(), extensionStringLess);
 
         /* Disable extensions that are known and supported and print a message
            for each */
         for(auto&& extension: _disabledExtensions) {
-            auto found = allExtensions.find(extension);
+            const Extension* found = findExtension(allExtensions, {extension.data(), extension.size()});
             /** @todo Error message here? I should not clutter the output at this point */
-            if(found == allExtensions.end()) continue;
+            if(!found) continue;
 
-            _extensionRequiredVersion[found->second.index()] = Version::None;
+            _extensionRequiredVersion[found->index()] = Version::None;
             Debug{output} << "   " << extension;
         }
     }
@@ -858,17 +971,20 @@ void Context::resetState(const States states) {
         _state->buffer->reset();
     if(states & State::Framebuffers)
         _state->framebuffer->reset();
-    if(states & State::Meshes)
-        _state->mesh->reset();
+    /* Unbinding VAO first, as with no VAOs it disables vertex attributes
+       known to the state tracker, which Meshes reset forgets */
     if(states & State::MeshVao)
         _state->mesh->bindVAOImplementation(0);
+    if(states & State::Meshes)
+        _state->mesh->reset();
 
     if(states & State::PixelStorage) {
         _state->renderer->unpackPixelStorage.reset();
         _state->renderer->packPixelStorage.reset();
     }
 
-    /* Nothing to reset for renderer yet */
+    if(states & State::Renderer)
+        _state->renderer->renderStateUnknown = Implementation::RendererState::RenderStateAll;
 
     if(states & State::Shaders) {
         /* Nothing to reset for shaders */
@@ -883,6 +999,212 @@ void Context::resetState(const States states) {
     #endif
 }
 
+Context::StateSnapshot::StateSnapshot() noexcept: _readFramebufferBinding{Implementation::State::DisengagedBinding}, _drawFramebufferBinding{Implementation::State::DisengagedBinding}, _viewport{0, 0, -1, -1}, _program{Implementation::State::DisengagedBinding}
+    #ifndef MAGNUM_TARGET_GLES2
+    , _transformFeedbackBinding{Implementation::State::DisengagedBinding}
+    #endif
+{
+    std::fill_n(_bufferBindings, std::size_t{BufferBindingCount}, Implementation::State::DisengagedBinding);
+}
+
+auto Context::saveState() const -> StateSnapshot {
+    static_assert(std::size_t(Implementation::BufferState::TargetCount) <= std::size_t(StateSnapshot::BufferBindingCount),
+        "buffer binding storage in Context::StateSnapshot too small");
+
+    StateSnapshot snapshot;
+
+    const Implementation::BufferState& bufferState = *_state->buffer;
+    std::copy_n(bufferState.bindings, std::size_t{Implementation::BufferState::TargetCount}, snapshot._bufferBindings);
+
+    const Implementation::FramebufferState& framebufferState = *_state->framebuffer;
+    snapshot._readFramebufferBinding = framebufferState.readBinding;
+    snapshot._drawFramebufferBinding = framebufferState.drawBinding;
+    snapshot._viewport[0] = framebufferState.viewport.left();
+    snapshot._viewport[1] = framebufferState.viewport.bottom();
+    snapshot._viewport[2] = framebufferState.viewport.right();
+    snapshot._viewport[3] = framebufferState.viewport.top();
+
+    snapshot._program = _state->shaderProgram->current;
+    #ifndef MAGNUM_TARGET_GLES2
+    snapshot._transformFeedbackBinding = _state->transformFeedback->binding;
+    #endif
+
+    const Implementation::TextureState& textureState = *_state->texture;
+    snapshot._textureBindings.assign(textureState.bindings.begin(), textureState.bindings.end());
+
+    return snapshot;
+}
+
+namespace {
+
+/* Whether a binding captured in a snapshot can be re-applied. Unknown and
+   empty bindings don't need to be (and the latter would only hide that the
+   external code left something else bound), bindings that Magnum changed
+   since the snapshot was taken are not known to the driver anymore. */
+inline bool restorableBinding(const GLuint captured, const GLuint current) {
+    return captured != Implementation::State::DisengagedBinding && captured && captured == current;
+}
+
+}
+
+void Context::restoreState(const StateSnapshot& snapshot, const States states) {
+    /* The VAO binding is not captured, as it's reset when entering the
+       external code and the next draw binds the VAO it needs anyway */
+    if(states & State::MeshVao)
+        _state->mesh->bindVAOImplementation(0);
+
+    if(states & State::Meshes) {
+        /* Without VAOs the attribute setup is global state that the external
+           code could have changed, forget it. Unlike in resetState(), buffers
+           attached to MeshLayout binding points are kept, as these are a
+           part of the VAO state. */
+        Implementation::MeshState& state = *_state->mesh;
+        state.currentVAO = Implementation::State::DisengagedBinding;
+        state.vertexAttributes.clear();
+    }
+
+    if(states & State::Buffers) {
+        GLuint* const bindings = _state->buffer->bindings;
+        for(std::size_t i = 1; i != Implementation::BufferState::TargetCount; ++i) {
+            const Buffer::TargetHint target = Implementation::BufferState::targetForIndex[i - 1];
+
+            /* Element array binding is a part of the VAO state, binding it
+               here would modify the VAO */
+            if(target == Buffer::TargetHint::ElementArray || !restorableBinding(snapshot._bufferBindings[i], bindings[i])) {
+                bindings[i] = Implementation::State::DisengagedBinding;
+                continue;
+            }
+
+            glBindBuffer(GLenum(target), bindings[i]);
+            ++_statistics.bindCount;
+        }
+    }
+
+    if(states & State::Framebuffers) {
+        Implementation::FramebufferState& state = *_state->framebuffer;
+        #ifndef MAGNUM_TARGET_GLES2
+        if(restorableBinding(snapshot._readFramebufferBinding, state.readBinding)) {
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, state.readBinding);
+            ++_statistics.bindCount;
+        } else state.readBinding = Implementation::State::DisengagedBinding;
+        if(restorableBinding(snapshot._drawFramebufferBinding, state.drawBinding)) {
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, state.drawBinding);
+            ++_statistics.bindCount;
+        } else state.drawBinding = Implementation::State::DisengagedBinding;
+        #else
+        /* Read and draw bindings are tracked together if there are no
+           separate targets, restore just the combined one */
+        if(snapshot._readFramebufferBinding == snapshot._drawFramebufferBinding && state.readBinding == state.drawBinding && restorableBinding(snapshot._drawFramebufferBinding, state.drawBinding)) {
+            glBindFramebuffer(GL_FRAMEBUFFER, state.drawBinding);
+            ++_statistics.bindCount;
+        } else state.readBinding = state.drawBinding = Implementation::State::DisengagedBinding;
+        #endif
+
+        /* Renderbuffer binding is not captured, as Magnum binds it only
+           temporarily for storage setup */
+        state.renderbufferBinding = Implementation::State::DisengagedBinding;
+
+        /* The captured viewport is what Magnum set last, the external code
+           most probably changed it */
+        const Range2Di viewport{{snapshot._viewport[0], snapshot._viewport[1]}, {snapshot._viewport[2], snapshot._viewport[3]}};
+        if(viewport != Implementation::FramebufferState::DisengagedViewport && viewport == state.viewport)
+            glViewport(viewport.left(), viewport.bottom(), viewport.sizeX(), viewport.sizeY());
+        else state.viewport = Implementation::FramebufferState::DisengagedViewport;
+    }
+
+    if(states & State::PixelStorage) {
+        _state->renderer->unpackPixelStorage.reset();
+        _state->renderer->packPixelStorage.reset();
+    }
+
+    if(states & State::Renderer)
+        _state->renderer->renderStateUnknown = Implementation::RendererState::RenderStateAll;
+
+    if(states & State::Shaders) {
+        Implementation::ShaderProgramState& state = *_state->shaderProgram;
+        if(restorableBinding(snapshot._program, state.current)) {
+            glUseProgram(state.current);
+            ++_statistics.bindCount;
+        } else state.current = Implementation::State::DisengagedBinding;
+    }
+
+    if(states & State::Textures) {
+        Implementation::TextureState& state = *_state->texture;
+        /* A snapshot that was default-constructed or taken on a different
+           context has no usable texture bindings */
+        const bool hasBindings = snapshot._textureBindings.size() == state.bindings.size();
+        /* The external code most probably changed the active texture unit */
+        state.currentTextureUnit = -1;
+        for(std::size_t i = 0; i != state.bindings.size(); ++i) {
+            std::pair<GLenum, GLuint>& binding = state.bindings[i];
+            if(!hasBindings || !binding.first || snapshot._textureBindings[i] != binding || !restorableBinding(snapshot._textureBindings[i].second, binding.second)) {
+                binding = {{}, Implementation::State::DisengagedBinding};
+                continue;
+            }
+
+            if(state.currentTextureUnit != GLint(i))
+                glActiveTexture(GL_TEXTURE0 + (state.currentTextureUnit = GLint(i)));
+            glBindTexture(binding.first, binding.second);
+            ++_statistics.bindCount;
+        }
+
+        /* Image bindings are not captured */
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        std::fill_n(state.imageBindings.begin(), state.imageBindings.size(), std::tuple<GLuint, GLint, GLboolean, GLint, GLenum>{Implementation::State::DisengagedBinding, 0, false, 0, 0});
+        #endif
+    }
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(states & State::TransformFeedback) {
+        Implementation::TransformFeedbackState& state = *_state->transformFeedback;
+        if(restorableBinding(snapshot._transformFeedbackBinding, state.binding)) {
+            glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, state.binding);
+            ++_statistics.bindCount;
+        } else state.binding = Implementation::State::DisengagedBinding;
+    }
+    #endif
+}
+
+Context::MemoryUsage Context::memoryUsage(const std::string& category) const {
+    for(const std::pair<std::string, MemoryUsage>& i: _memoryUsageCategories)
+        if(i.first == category) return i.second;
+    return MemoryUsage{};
+}
+
+std::vector<std::string> Context::memoryUsageCategories() const {
+    std::vector<std::string> out;
+    out.reserve(_memoryUsageCategories.size());
+    for(const std::pair<std::string, MemoryUsage>& i: _memoryUsageCategories)
+        out.push_back(i.first);
+    return out;
+}
+
+UnsignedInt Context::memoryUsageCategoryInternal(const Containers::ArrayView<const char> label) {
+    /* The category is the part of the label before first slash */
+    const char* const end = std::find(label.begin(), label.end(), '/');
+    if(end == label.begin()) return 0;
+
+    /* There's usually just a handful of categories, so a linear search is
+       fine */
+    const std::size_t size = end - label.begin();
+    for(std::size_t i = 0; i != _memoryUsageCategories.size(); ++i) {
+        const std::string& name = _memoryUsageCategories[i].first;
+        if(name.size() == size && std::memcmp(name.data(), label.data(), size) == 0)
+            return i + 1;
+    }
+
+    _memoryUsageCategories.emplace_back(std::string{label.data(), size}, MemoryUsage{});
+    return _memoryUsageCategories.size();
+}
+
+void Context::updateMemoryUsageInternal(std::uint64_t MemoryUsage::*const type, UnsignedInt& category, std::size_t& size, const UnsignedInt newCategory, const std::size_t newSize) {
+    _memoryUsage.*type = _memoryUsage.*type - size + newSize;
+    if(category) _memoryUsageCategories[category - 1].second.*type -= size;
+    if(newCategory) _memoryUsageCategories[newCategory - 1].second.*type += newSize;
+    category = newCategory;
+    size = newSize;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 #ifndef MAGNUM_TARGET_WEBGL
 Debug& operator<<(Debug& debug, const Context::Flag value) {
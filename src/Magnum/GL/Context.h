@@ -33,6 +33,7 @@
 #include <array>
 #include <bitset>
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/EnumSet.h>
 #include <Corrade/Containers/Optional.h>
 
@@ -224,13 +225,22 @@ class MAGNUM_GL_EXPORT Context {
              * Similar issue can happen the other way. Calling @ref resetState()
              * with @ref State::MeshVao included unbounds any currently bound
              * VAO to fix such case.
+             *
+             * If VAOs are not available, Magnum instead keeps vertex
+             * attributes enabled after a draw so consecutive meshes sharing
+             * the same buffers and layouts don't need to specify them again.
+             * In that case this disables all vertex attributes that Magnum
+             * enabled.
              */
             MeshVao = 1 << 3,
 
             /** Reset tracked pixel storage-related state */
             PixelStorage = 1 << 4,
 
-            /** Reset tracked renderer-related state */
+            /**
+             * Reset tracked renderer-related state, so the next
+             * @ref RenderState::apply() sets everything again
+             */
             Renderer = 1 << 5,
 
             /** Reset tracked shader-related bindings */
@@ -271,6 +281,42 @@ class MAGNUM_GL_EXPORT Context {
          */
         typedef Containers::EnumSet<State> States;
 
+        /**
+         * @brief Snapshot of the tracked state
+         *
+         * Captures object bindings known to the internal state tracker.
+         * Created with @ref saveState() and re-applied with
+         * @ref restoreState(), the contents are not accessible otherwise.
+         */
+        class StateSnapshot {
+            public:
+                /**
+                 * @brief Default constructor
+                 *
+                 * Creates an empty snapshot, restoring it behaves the same as
+                 * @ref resetState().
+                 */
+                explicit StateSnapshot() noexcept;
+
+            private:
+                friend Context;
+
+                enum: std::size_t {
+                    /* Greater or equal to Implementation::BufferState::TargetCount,
+                       checked in Context.cpp */
+                    BufferBindingCount = 14
+                };
+
+                GLuint _bufferBindings[BufferBindingCount];
+                GLuint _readFramebufferBinding, _drawFramebufferBinding;
+                Int _viewport[4];
+                GLuint _program;
+                #ifndef MAGNUM_TARGET_GLES2
+                GLuint _transformFeedbackBinding;
+                #endif
+                std::vector<std::pair<GLenum, GLuint>> _textureBindings;
+        };
+
         /**
          * @brief Detected driver
          *
@@ -369,10 +415,26 @@ class MAGNUM_GL_EXPORT Context {
          * Expect that there is current context. If Magnum is built with
          * @ref MAGNUM_BUILD_MULTITHREADED, current context is thread-local
          * instead of global (the default).
-         * @see @ref hasCurrent()
+         * @see @ref hasCurrent(), @ref makeCurrent()
          */
         static Context& current();
 
+        /**
+         * @brief Make a context current
+         *
+         * Makes @p context current for all Magnum calls. Meant to be used
+         * when switching between more than one Magnum context on a single
+         * thread --- the underlying OpenGL context has to be made current
+         * in a platform-specific way first, for example using
+         * @ref Platform::WindowlessEglContext::makeCurrent(). Passing
+         * @cpp nullptr @ce makes no context current, which is needed before
+         * creating another context on the same thread. If Magnum is built
+         * with @ref MAGNUM_BUILD_MULTITHREADED, current context is
+         * thread-local instead of global (the default).
+         * @see @ref hasCurrent()
+         */
+        static void makeCurrent(Context* context);
+
         /** @brief Copying is not allowed */
         Context(const Context&) = delete;
 
@@ -614,6 +676,187 @@ class MAGNUM_GL_EXPORT Context {
          */
         void resetState(States states = ~States{});
 
+        /**
+         * @brief Save tracked state
+         *
+         * Captures the buffer, framebuffer, shader program, texture and
+         * transform feedback bindings known to the internal state tracker,
+         * together with the current viewport. Doesn't make any OpenGL calls.
+         * Pass the returned snapshot to @ref restoreState() after the
+         * third-party code finished. See @ref opengl-state-tracking for an
+         * example.
+         */
+        StateSnapshot saveState() const;
+
+        /**
+         * @brief Restore tracked state
+         *
+         * Meant to be called instead of @ref resetState() when exiting a
+         * section with third-party GL code that was entered with
+         * @ref saveState(). For each category in @p states, bindings captured
+         * in @p snapshot are bound again and written back to the state
+         * tracker, so Magnum code executed afterwards doesn't need to rebind
+         * the objects it used before. Only bindings of actual objects are
+         * re-applied --- bindings that were unknown or had no object bound
+         * in @p snapshot, as well as bindings that Magnum itself changed
+         * since the snapshot was taken (for example by deleting the bound
+         * object), are reset as if @ref resetState() was called for them.
+         *
+         * Compared to @ref resetState() with @ref State::ExitExternal,
+         * which makes Magnum bind everything again on next use and forget
+         * vertex buffers attached to @ref MeshLayout binding points, this
+         * issues at most one bind per captured object and the tracked
+         * bindings stay valid afterwards. State that isn't captured --- VAO
+         * binding, vertex attribute setup if VAOs are not available, pixel
+         * storage, renderer state and image bindings --- is reset the same
+         * way as with @ref resetState(). Re-applied bindings are counted in
+         * @ref Statistics::bindCount.
+         *
+         * Expects that the third-party code didn't delete any of the
+         * captured objects. @ref State::EnterExternal still needs to be
+         * reset using @ref resetState() before entering the section.
+         */
+        void restoreState(const StateSnapshot& snapshot, States states = ~States{});
+
+        /**
+         * @brief Call statistics
+         *
+         * Counters gathered by the internal state tracker, useful for
+         * enforcing performance budgets. The values are accumulated until
+         * @ref resetStatistics() is called, so for per-frame values call it
+         * at the start of every frame. Calling @ref resetState() doesn't
+         * affect the statistics. The counters are @ref std::uint64_t
+         * because the @ref Magnum::UnsignedLong "UnsignedLong" typedef is
+         * not available on WebGL.
+         */
+        struct Statistics {
+            /**
+             * @brief Object bindings issued to the driver
+             *
+             * Buffer, texture, framebuffer, VAO and shader program bindings
+             * that resulted in an actual OpenGL call. If VAOs are not
+             * available, vertex attribute setups are counted here as well.
+             */
+            std::uint64_t bindCount;
+
+            /**
+             * @brief Redundant object bindings elided
+             *
+             * Bindings that were skipped because the state tracker knew the
+             * object was already bound.
+             */
+            std::uint64_t elidedBindCount;
+
+            /**
+             * @brief Bytes uploaded to buffers
+             *
+             * Sum of data sizes passed to @ref Buffer::setData(),
+             * @ref Buffer::setSubData() and, on desktop GL,
+             * @ref Buffer::setStorage().
+             */
+            std::uint64_t bufferUploadSize;
+
+            /**
+             * @brief Bytes uploaded to textures
+             *
+             * Sum of client memory image data sizes passed to image and
+             * subimage upload functions of all texture types. Uploads from
+             * pixel buffers are not included.
+             */
+            std::uint64_t textureUploadSize;
+
+            /**
+             * @brief Draw calls
+             *
+             * Count of draw calls issued by @ref Mesh::draw(),
+             * @ref MeshView::draw() and related functions. A multi-draw
+             * counts as a single call.
+             */
+            std::uint64_t drawCount;
+        };
+
+        /**
+         * @brief Call statistics
+         *
+         * @see @ref resetStatistics()
+         */
+        const Statistics& statistics() const { return _statistics; }
+
+        /**
+         * @brief Reset call statistics
+         *
+         * Sets all counters in @ref statistics() to zero.
+         */
+        void resetStatistics() { _statistics = Statistics{}; }
+
+        /**
+         * @brief GPU memory usage
+         *
+         * Sums of @ref Buffer::memoryUsage(),
+         * @ref AbstractTexture::memoryUsage() and
+         * @ref Renderbuffer::memoryUsage() of all live objects. Unlike
+         * @ref Statistics, the values are not accumulated but go down again
+         * when the objects are destroyed. Memory of @ref Mesh and
+         * @ref BufferTexture instances is accounted through the buffers
+         * they use. The sizes are @ref std::uint64_t because the
+         * @ref Magnum::UnsignedLong "UnsignedLong" typedef is not available
+         * on WebGL.
+         * @see @ref memoryUsage(const std::string&) const
+         */
+        struct MemoryUsage {
+            /** @brief Bytes allocated by buffers */
+            std::uint64_t bufferSize;
+
+            /**
+             * @brief Estimated bytes allocated by textures
+             *
+             * See @ref AbstractTexture::memoryUsage() for details about how
+             * the value is estimated.
+             */
+            std::uint64_t textureSize;
+
+            /**
+             * @brief Estimated bytes allocated by renderbuffers
+             *
+             * See @ref Renderbuffer::memoryUsage() for details about how the
+             * value is estimated.
+             */
+            std::uint64_t renderbufferSize;
+        };
+
+        /**
+         * @brief GPU memory usage of all objects
+         *
+         * @see @ref memoryUsageCategories()
+         */
+        const MemoryUsage& memoryUsage() const { return _memoryUsage; }
+
+        /**
+         * @brief GPU memory usage of objects in given category
+         *
+         * Objects are assigned to a category through their debug label ---
+         * the part of the label before the first `/`, or the whole label if
+         * it contains no `/`. For example, a texture labelled
+         * @cpp "terrain/diffuse" @ce and a buffer labelled @cpp "terrain" @ce
+         * both count into the @cpp "terrain" @ce category. Objects without a
+         * label don't belong to any category. Returns zeros if there's no
+         * such category.
+         * @see @ref Buffer::setLabel(), @ref AbstractTexture::setLabel(),
+         *      @ref Renderbuffer::setLabel()
+         * @note Object labels are not available in WebGL, so all objects
+         *      are uncategorized there.
+         */
+        MemoryUsage memoryUsage(const std::string& category) const;
+
+        /**
+         * @brief Memory usage categories
+         *
+         * Categories that were used by any object labelled so far, in order
+         * they were first encountered.
+         * @see @ref memoryUsage(const std::string&) const
+         */
+        std::vector<std::string> memoryUsageCategories() const;
+
         /**
          * @brief Detect driver
          *
@@ -629,6 +872,15 @@ class MAGNUM_GL_EXPORT Context {
     #endif
         bool isDriverWorkaroundDisabled(const std::string& workaround);
         Implementation::State& state() { return *_state; }
+        Statistics& statisticsInternal() { return _statistics; }
+
+        /* Returns an ID of memory usage category for given object label,
+           adding a new one if not there yet. Returns 0 for empty labels. */
+        UnsignedInt memoryUsageCategoryInternal(Containers::ArrayView<const char> label);
+
+        /* Replaces a previous object size and category with new ones in
+           the aggregate memory usage and writes the new values back */
+        void updateMemoryUsageInternal(std::uint64_t MemoryUsage::*type, UnsignedInt& category, std::size_t& size, UnsignedInt newCategory, std::size_t newSize);
 
         /* This function is called from MeshState constructor, which means the
            state() pointer is not ready yet so we have to pass it directly */
@@ -666,7 +918,10 @@ class MAGNUM_GL_EXPORT Context {
         std::bitset<Implementation::ExtensionCount> _extensionStatus;
         std::vector<Extension> _supportedExtensions;
 
-        Implementation::State* _state;
+        Implementation::State* _state{};
+        Statistics _statistics{};
+        MemoryUsage _memoryUsage{};
+        std::vector<std::pair<std::string, MemoryUsage>> _memoryUsageCategories;
 
         Containers::Optional<DetectedDrivers> _detectedDrivers;
 
@@ -674,6 +929,7 @@ class MAGNUM_GL_EXPORT Context {
         std::vector<std::pair<std::string, bool>> _driverWorkarounds;
         std::vector<std::string> _disabledExtensions;
         bool _displayInitializationLog;
+        bool _usesFunctionLoader{};
 };
 
 #ifndef MAGNUM_TARGET_WEBGL
@@ -30,6 +30,7 @@
 #include <Corrade/Utility/Debug.h>
 
 #include "Magnum/GL/Context.h"
+#include "Magnum/GL/DebugOutputQueue.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Implementation/State.h"
 #include "Magnum/GL/Implementation/DebugState.h"
@@ -38,15 +39,29 @@ namespace Magnum { namespace GL {
 
 namespace {
 
+/* The user param is the debug state and not the user-supplied pointer, as
+   without synchronous output the driver can call this from a different
+   thread, where Context::current() isn't available */
 void
 #ifdef CORRADE_TARGET_WINDOWS
 APIENTRY
 #endif
 callbackWrapper(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam) {
-    Context::current().state().debug->messageCallback(DebugOutput::Source(source), DebugOutput::Type(type), id, DebugOutput::Severity(severity), std::string{message, std::size_t(length)}, userParam);
+    const Implementation::DebugState& state = *static_cast<const Implementation::DebugState*>(userParam);
+
+    /* The queue doesn't need the message as a std::string, avoid an
+       allocation */
+    if(state.messageQueue)
+        state.messageQueue->push(DebugOutput::Source(source), DebugOutput::Type(type), id, DebugOutput::Severity(severity), {message, std::size_t(length)});
+    else if(state.messageCallback)
+        state.messageCallback(DebugOutput::Source(source), DebugOutput::Type(type), id, DebugOutput::Severity(severity), std::string{message, std::size_t(length)}, state.messageUserParam);
+}
+
 }
 
-void defaultCallback(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const std::string& string, const void*) {
+namespace Implementation {
+
+void defaultDebugCallback(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const std::string& string, const void*) {
     Debug output;
     output << "Debug output:";
 
@@ -143,7 +158,7 @@ void DebugOutput::setCallback(const Callback callback, const void* userParam) {
 }
 
 void DebugOutput::setDefaultCallback() {
-    setCallback(defaultCallback, nullptr);
+    setCallback(Implementation::defaultDebugCallback, nullptr);
 }
 
 void DebugOutput::setEnabledInternal(const GLenum source, const GLenum type, const GLenum severity, const std::initializer_list<UnsignedInt> ids, const bool enabled) {
@@ -168,32 +183,34 @@ void DebugOutput::callbackImplementationNoOp(Callback, const void*) {}
 
 #ifndef MAGNUM_TARGET_GLES2
 void DebugOutput::callbackImplementationKhrDesktopES32(const Callback callback, const void* userParam) {
-    /* Replace the callback */
-    const Callback original = Context::current().state().debug->messageCallback;
-    Context::current().state().debug->messageCallback = callback;
-
-    /* Adding callback */
-    if(!original && callback)
-        glDebugMessageCallback(callbackWrapper, userParam);
-
-    /* Deleting callback */
-    else if(original && !callback)
+    Implementation::DebugState& state = *Context::current().state().debug;
+
+    /* Replace the callback. The queue is set directly by
+       DebugOutputQueue::install() and uninstall() before calling this, so
+       the previous state can't be used to decide whether anything changed.
+       Registering the same wrapper again is harmless. */
+    state.messageCallback = callback;
+    state.messageUserParam = userParam;
+    if(state.messageCallback || state.messageQueue)
+        glDebugMessageCallback(callbackWrapper, &state);
+    else
         glDebugMessageCallback(nullptr, nullptr);
 }
 #endif
 
 #ifdef MAGNUM_TARGET_GLES
 void DebugOutput::callbackImplementationKhrES(const Callback callback, const void* userParam) {
-    /* Replace the callback */
-    const Callback original = Context::current().state().debug->messageCallback;
-    Context::current().state().debug->messageCallback = callback;
-
-    /* Adding callback */
-    if(!original && callback)
-        glDebugMessageCallbackKHR(callbackWrapper, userParam);
-
-    /* Deleting callback */
-    else if(original && !callback)
+    Implementation::DebugState& state = *Context::current().state().debug;
+
+    /* Replace the callback. The queue is set directly by
+       DebugOutputQueue::install() and uninstall() before calling this, so
+       the previous state can't be used to decide whether anything changed.
+       Registering the same wrapper again is harmless. */
+    state.messageCallback = callback;
+    state.messageUserParam = userParam;
+    if(state.messageCallback || state.messageQueue)
+        glDebugMessageCallbackKHR(callbackWrapper, &state);
+    else
         glDebugMessageCallbackKHR(nullptr, nullptr);
 }
 #endif
@@ -86,6 +86,11 @@ Debug output: application marker (1337): Rendering transparent mesh
 Debug output: application debug group leave (42): Scene rendering
 @endcode
 
+If the driver produces a lot of messages, printing them directly from the
+callback can slow the application down considerably. Use
+@ref DebugOutputQueue in that case, which processes the messages on a worker
+thread and filters out repeated ones.
+
 If only @gl_extension{EXT,debug_marker} or @gl_extension{GREMEDY,string_marker} are
 supported, only user-inserted messages and debug groups are supported and they
 can be seen only through graphics debugger.
@@ -0,0 +1,333 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DebugOutputQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Implementation/State.h"
+#include "Magnum/GL/Implementation/DebugState.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace GL {
+
+namespace {
+
+struct Message {
+    DebugOutput::Source source;
+    DebugOutput::Type type;
+    UnsignedInt id;
+    DebugOutput::Severity severity;
+    std::size_t length;
+    char text[DebugOutputQueue::maxMessageLength()];
+};
+
+/* Bounded MPMC queue cell as described by Dmitry Vyukov. The sequence tells
+   whether the cell is free for given producer position or filled for given
+   consumer position. */
+struct Cell {
+    std::atomic<std::size_t> sequence;
+    Message message;
+};
+
+/* Source and type are GL enums with nonzero lower 16 bits, so a zero key can
+   mark an unused slot */
+struct DeduplicationSlot {
+    std::atomic<UnsignedLong> key;
+    /* Nanoseconds of the last let-through message, zero if none yet */
+    std::atomic<Long> time;
+};
+
+enum: std::size_t { DeduplicationSlotCount = 256 };
+
+Long now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
+
+struct DebugOutputQueue::State {
+    explicit State(const std::size_t capacity): cells{Containers::ValueInit, capacity}, mask{capacity - 1}, enqueuePosition{0}, dequeuePosition{0}, deduplicationInterval{1000000000ll}, receivedCount{0}, deliveredCount{0}, suppressedCount{0}, rateLimitedCount{0}, overflowCount{0}, callback{}, userParam{}, rateLimit{0}, tokens{0.0}, tokenTime{0}, stopRequested{false} {
+        for(std::size_t i = 0; i != capacity; ++i)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        for(DeduplicationSlot& slot: deduplication) {
+            slot.key.store(0, std::memory_order_relaxed);
+            slot.time.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /* Accessed from the producer threads */
+    Containers::Array<Cell> cells;
+    const std::size_t mask;
+    std::atomic<std::size_t> enqueuePosition, dequeuePosition;
+    DeduplicationSlot deduplication[DeduplicationSlotCount];
+    std::atomic<Long> deduplicationInterval;
+    std::atomic<std::size_t> receivedCount, deliveredCount, suppressedCount, rateLimitedCount, overflowCount;
+
+    /* Accessed only with processMutex locked */
+    std::mutex processMutex;
+    DebugOutput::Callback callback;
+    const void* userParam;
+    UnsignedInt rateLimit;
+    Double tokens;
+    Long tokenTime;
+    /* Reused so the callback doesn't allocate for each message */
+    std::string string;
+
+    /* Worker */
+    std::thread worker;
+    std::mutex workerMutex;
+    std::condition_variable workerCondition;
+    bool stopRequested;
+};
+
+DebugOutputQueue::DebugOutputQueue(const std::size_t capacity) {
+    CORRADE_ASSERT(capacity >= 2 && !(capacity & (capacity - 1)),
+        "GL::DebugOutputQueue: expected capacity to be a power of two and at least 2 but got" << capacity, );
+    _state.reset(new State{capacity});
+}
+
+DebugOutputQueue::~DebugOutputQueue() {
+    /* The state is null only if the constructor assertion fired */
+    if(!_state) return;
+    stop();
+    uninstall();
+}
+
+std::size_t DebugOutputQueue::capacity() const { return _state->mask + 1; }
+
+DebugOutputQueue& DebugOutputQueue::setCallback(const DebugOutput::Callback callback, const void* const userParam) {
+    std::lock_guard<std::mutex> lock{_state->processMutex};
+    _state->callback = callback;
+    _state->userParam = userParam;
+    return *this;
+}
+
+DebugOutputQueue& DebugOutputQueue::setDeduplicationInterval(const Float seconds) {
+    _state->deduplicationInterval.store(Long(Double(seconds)*1.0e9), std::memory_order_relaxed);
+    return *this;
+}
+
+DebugOutputQueue& DebugOutputQueue::setRateLimit(const UnsignedInt messagesPerSecond) {
+    std::lock_guard<std::mutex> lock{_state->processMutex};
+    _state->rateLimit = messagesPerSecond;
+    /* Start with a full bucket */
+    _state->tokens = messagesPerSecond;
+    _state->tokenTime = now();
+    return *this;
+}
+
+void DebugOutputQueue::install() {
+    Implementation::DebugState& state = *Context::current().state().debug;
+    CORRADE_ASSERT(!state.messageQueue || state.messageQueue == this,
+        "GL::DebugOutputQueue::install(): another queue is already installed", );
+
+    /* The callback implementation registers the wrapper if there's either a
+       queue or a callback */
+    state.messageQueue = this;
+    state.callbackImplementation(state.messageCallback, state.messageUserParam);
+}
+
+void DebugOutputQueue::uninstall() {
+    if(!isInstalled()) return;
+
+    Implementation::DebugState& state = *Context::current().state().debug;
+    state.messageQueue = nullptr;
+    state.callbackImplementation(state.messageCallback, state.messageUserParam);
+}
+
+bool DebugOutputQueue::isInstalled() const {
+    return Context::hasCurrent() && Context::current().state().debug->messageQueue == this;
+}
+
+void DebugOutputQueue::start() {
+    State& state = *_state;
+    CORRADE_ASSERT(!state.worker.joinable(),
+        "GL::DebugOutputQueue::start(): the worker is already running", );
+
+    state.stopRequested = false;
+    state.worker = std::thread{[this, &state]() {
+        std::unique_lock<std::mutex> lock{state.workerMutex};
+        while(!state.stopRequested) {
+            lock.unlock();
+            process();
+            lock.lock();
+            state.workerCondition.wait_for(lock, std::chrono::milliseconds{10}, [&state]() { return state.stopRequested; });
+        }
+    }};
+}
+
+void DebugOutputQueue::stop() {
+    State& state = *_state;
+    if(!state.worker.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock{state.workerMutex};
+        state.stopRequested = true;
+    }
+    state.workerCondition.notify_one();
+    state.worker.join();
+
+    /* Deliver whatever came in since the last iteration */
+    process();
+}
+
+bool DebugOutputQueue::isRunning() const { return _state->worker.joinable(); }
+
+void DebugOutputQueue::push(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const Containers::ArrayView<const char> message) {
+    State& state = *_state;
+    state.receivedCount.fetch_add(1, std::memory_order_relaxed);
+
+    /* Drop the message if the same one was let through recently. If the
+       table is full, the message is let through. */
+    const Long interval = state.deduplicationInterval.load(std::memory_order_relaxed);
+    if(interval > 0) {
+        const UnsignedLong key = (UnsignedLong(id) << 32)|
+            (UnsignedLong(UnsignedInt(source) & 0xffff) << 16)|
+            (UnsignedLong(UnsignedInt(type) & 0xffff));
+        const std::size_t start = std::size_t((key*11400714819323198485ull) >> 56);
+        for(std::size_t i = 0; i != DeduplicationSlotCount; ++i) {
+            DeduplicationSlot& slot = state.deduplication[(start + i) % DeduplicationSlotCount];
+            UnsignedLong slotKey = slot.key.load(std::memory_order_acquire);
+            if(!slotKey && slot.key.compare_exchange_strong(slotKey, key, std::memory_order_acq_rel))
+                slotKey = key;
+            if(slotKey != key) continue;
+
+            /* If the time got updated by another thread meanwhile, check
+               again against the new value */
+            const Long time = now();
+            Long last = slot.time.load(std::memory_order_acquire);
+            do {
+                if(last && time - last < interval) {
+                    state.suppressedCount.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            } while(!slot.time.compare_exchange_weak(last, time, std::memory_order_acq_rel));
+            break;
+        }
+    }
+
+    /* Reserve a cell */
+    Cell* cell;
+    std::size_t position = state.enqueuePosition.load(std::memory_order_relaxed);
+    for(;;) {
+        cell = &state.cells[position & state.mask];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const std::ptrdiff_t difference = std::ptrdiff_t(sequence) - std::ptrdiff_t(position);
+        if(difference == 0) {
+            if(state.enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        } else if(difference < 0) {
+            state.overflowCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else position = state.enqueuePosition.load(std::memory_order_relaxed);
+    }
+
+    /* Fill it and publish it to the consumer */
+    Message& out = cell->message;
+    out.source = source;
+    out.type = type;
+    out.id = id;
+    out.severity = severity;
+    out.length = Math::min(message.size(), maxMessageLength());
+    if(out.length) std::memcpy(out.text, message.data(), out.length);
+    cell->sequence.store(position + 1, std::memory_order_release);
+}
+
+std::size_t DebugOutputQueue::process() {
+    State& state = *_state;
+    std::lock_guard<std::mutex> lock{state.processMutex};
+
+    const DebugOutput::Callback callback = state.callback ? state.callback : Implementation::defaultDebugCallback;
+    std::size_t delivered = 0;
+    for(;;) {
+        /* Only one consumer at a time thanks to the mutex, so no CAS needed
+           for the position */
+        const std::size_t position = state.dequeuePosition.load(std::memory_order_relaxed);
+        Cell& cell = state.cells[position & state.mask];
+        if(cell.sequence.load(std::memory_order_acquire) != position + 1) break;
+
+        const Message& message = cell.message;
+        bool limited = false;
+        if(state.rateLimit) {
+            const Long time = now();
+            state.tokens = Math::min(Double(state.rateLimit), state.tokens + (time - state.tokenTime)*1.0e-9*state.rateLimit);
+            state.tokenTime = time;
+            if(state.tokens < 1.0) limited = true;
+            else state.tokens -= 1.0;
+        }
+
+        if(limited) state.rateLimitedCount.fetch_add(1, std::memory_order_relaxed);
+        else state.string.assign(message.text, message.length);
+
+        /* Release the cell before calling the callback so producers don't
+           wait on it. The values needed are copied out first. */
+        const DebugOutput::Source source = message.source;
+        const DebugOutput::Type type = message.type;
+        const UnsignedInt id = message.id;
+        const DebugOutput::Severity severity = message.severity;
+        state.dequeuePosition.store(position + 1, std::memory_order_relaxed);
+        cell.sequence.store(position + state.mask + 1, std::memory_order_release);
+
+        if(limited) continue;
+
+        callback(source, type, id, severity, state.string, state.userParam);
+        ++delivered;
+    }
+
+    state.deliveredCount.fetch_add(delivered, std::memory_order_relaxed);
+    return delivered;
+}
+
+std::size_t DebugOutputQueue::receivedCount() const {
+    return _state->receivedCount.load(std::memory_order_relaxed);
+}
+
+std::size_t DebugOutputQueue::deliveredCount() const {
+    return _state->deliveredCount.load(std::memory_order_relaxed);
+}
+
+std::size_t DebugOutputQueue::suppressedCount() const {
+    return _state->suppressedCount.load(std::memory_order_relaxed);
+}
+
+std::size_t DebugOutputQueue::rateLimitedCount() const {
+    return _state->rateLimitedCount.load(std::memory_order_relaxed);
+}
+
+std::size_t DebugOutputQueue::overflowCount() const {
+    return _state->overflowCount.load(std::memory_order_relaxed);
+}
+
+}}
@@ -0,0 +1,259 @@
+#ifndef Magnum_GL_DebugOutputQueue_h
+#define Magnum_GL_DebugOutputQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_WEBGL
+/** @file
+ * @brief Class @ref Magnum::GL::DebugOutputQueue
+ */
+#endif
+
+#include <memory>
+
+#include "Magnum/GL/DebugOutput.h"
+
+#ifndef MAGNUM_TARGET_WEBGL
+namespace Magnum { namespace GL {
+
+/**
+@brief Asynchronous debug output queue
+
+With a debug context, especially performance notes can come in such amounts
+that printing them right from the driver callback set up by
+@ref DebugOutput::setCallback() considerably slows down the application.
+This class instead copies each message into a fixed-size lock-free buffer and
+passes them to the callback later, either from a worker thread or from an
+explicit @ref process() call, skipping repeated messages and limiting the
+message rate.
+
+@section GL-DebugOutputQueue-usage Usage
+
+Create the queue, optionally configure it, @ref install() it in place of the
+@ref DebugOutput callback and either @ref start() the worker thread or call
+@ref process() periodically, for example once per frame. Without any
+@ref setCallback() the messages are printed in the same format as with
+@ref DebugOutput::setDefaultCallback().
+
+@snippet MagnumGL.cpp DebugOutputQueue-usage
+
+@section GL-DebugOutputQueue-filtering Deduplication and rate limiting
+
+Messages with the same @ref DebugOutput::Source, @ref DebugOutput::Type and
+ID are passed to the callback at most once in an interval set with
+@ref setDeduplicationInterval(), the repeated ones are only counted in
+@ref suppressedCount(). These are dropped already when received, so they
+don't take space in the buffer. Messages that were let through are then
+passed to the callback at a rate no larger than @ref setRateLimit(), the
+messages over the limit are counted in @ref rateLimitedCount(). If the
+buffer gets full because the messages aren't processed fast enough, newly
+received messages are dropped and counted in @ref overflowCount().
+
+Messages longer than @ref maxMessageLength() are truncated.
+
+@section GL-DebugOutputQueue-threads Thread safety
+
+@ref push() is lock-free and can be called from any thread, which means
+@ref Renderer::Feature::DebugOutputSynchronous doesn't need to be enabled,
+as the driver can report messages from its own threads. The callback is
+called from the thread that calls @ref process(), which is the worker thread
+after @ref start(). @ref install() and @ref uninstall() need the GL context
+to be current.
+
+@requires_gles Debug output is not available in WebGL.
+*/
+class MAGNUM_GL_EXPORT DebugOutputQueue {
+    public:
+        /**
+         * @brief Max length of a queued message
+         *
+         * Longer messages are truncated.
+         */
+        static constexpr std::size_t maxMessageLength() { return 511; }
+
+        /**
+         * @brief Constructor
+         * @param capacity  Max count of messages waiting to be processed
+         *
+         * Expects that @p capacity is a power of two. The queue is not
+         * installed and the worker thread is not started.
+         */
+        explicit DebugOutputQueue(std::size_t capacity = 256);
+
+        /** @brief Copying is not allowed */
+        DebugOutputQueue(const DebugOutputQueue&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * The queue address is referenced from the GL context state and the
+         * worker thread.
+         */
+        DebugOutputQueue(DebugOutputQueue&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops the worker thread, if running, and uninstalls the queue, if
+         * installed and the GL context is still current. Messages still
+         * waiting in the queue are passed to the callback.
+         */
+        ~DebugOutputQueue();
+
+        /** @brief Copying is not allowed */
+        DebugOutputQueue& operator=(const DebugOutputQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        DebugOutputQueue& operator=(DebugOutputQueue&&) = delete;
+
+        /** @brief Max count of messages waiting to be processed */
+        std::size_t capacity() const;
+
+        /**
+         * @brief Set the callback
+         * @return Reference to self (for method chaining)
+         *
+         * The @p callback is called from @ref process() for each message
+         * that passed deduplication and rate limiting. If set to
+         * @cpp nullptr @ce, the messages are printed in the same format as
+         * with @ref DebugOutput::setDefaultCallback(). Initial value is
+         * @cpp nullptr @ce.
+         */
+        DebugOutputQueue& setCallback(DebugOutput::Callback callback, const void* userParam = nullptr);
+
+        /**
+         * @brief Set the deduplication interval
+         * @return Reference to self (for method chaining)
+         *
+         * Messages with the same source, type and ID are let through at most
+         * once in @p seconds. Set to @cpp 0.0f @ce to disable
+         * deduplication. Initial value is @cpp 1.0f @ce.
+         */
+        DebugOutputQueue& setDeduplicationInterval(Float seconds);
+
+        /**
+         * @brief Set the rate limit
+         * @return Reference to self (for method chaining)
+         *
+         * At most @p messagesPerSecond messages are passed to the callback
+         * each second, with short bursts of the same size allowed. Set to
+         * @cpp 0 @ce to disable rate limiting. Initial value is @cpp 0 @ce.
+         */
+        DebugOutputQueue& setRateLimit(UnsignedInt messagesPerSecond);
+
+        /**
+         * @brief Install the queue
+         *
+         * Makes the current GL context send all debug messages to
+         * @ref push() instead of the callback set with
+         * @ref DebugOutput::setCallback(). Expects that no other queue is
+         * installed. If @gl_extension{KHR,debug} is not available, the
+         * queue doesn't receive any messages.
+         */
+        void install();
+
+        /**
+         * @brief Uninstall the queue
+         *
+         * Makes the current GL context send debug messages to the callback
+         * set with @ref DebugOutput::setCallback() again, if any. Messages
+         * still waiting in the queue are not affected. Does nothing if the
+         * queue is not installed.
+         */
+        void uninstall();
+
+        /**
+         * @brief Whether the queue is installed
+         *
+         * Returns @cpp false @ce if there's no current GL context.
+         */
+        bool isInstalled() const;
+
+        /**
+         * @brief Start the worker thread
+         *
+         * The worker calls @ref process() roughly every ten milliseconds.
+         * Expects that the worker is not already running.
+         * @see @ref stop()
+         */
+        void start();
+
+        /**
+         * @brief Stop the worker thread
+         *
+         * Waits until the worker exits and then calls @ref process() once
+         * more so no messages are left behind. Does nothing if the worker
+         * is not running.
+         */
+        void stop();
+
+        /** @brief Whether the worker thread is running */
+        bool isRunning() const;
+
+        /**
+         * @brief Queue a message
+         *
+         * Called by the driver once the queue is @ref install() "installed",
+         * but can be called directly as well. Lock-free and doesn't
+         * allocate. See @ref GL-DebugOutputQueue-filtering for details.
+         */
+        void push(DebugOutput::Source source, DebugOutput::Type type, UnsignedInt id, DebugOutput::Severity severity, Containers::ArrayView<const char> message);
+
+        /**
+         * @brief Process queued messages
+         * @return Count of messages passed to the callback
+         *
+         * Passes all queued messages to the callback, subject to rate
+         * limiting. Can be called also while the worker thread is running,
+         * the calls are serialized.
+         */
+        std::size_t process();
+
+        /** @brief Count of all received messages */
+        std::size_t receivedCount() const;
+
+        /** @brief Count of messages passed to the callback */
+        std::size_t deliveredCount() const;
+
+        /** @brief Count of messages dropped as repeated */
+        std::size_t suppressedCount() const;
+
+        /** @brief Count of messages dropped because of the rate limit */
+        std::size_t rateLimitedCount() const;
+
+        /** @brief Count of messages dropped because the queue was full */
+        std::size_t overflowCount() const;
+
+    private:
+        struct State;
+        std::unique_ptr<State> _state;
+};
+
+}}
+#else
+#error this header is not available in WebGL build
+#endif
+
+#endif
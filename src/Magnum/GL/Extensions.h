@@ -248,10 +248,11 @@ namespace AMD {
     _extension(166,KHR,blend_equation_advanced,         GL210,  None) // #174
     _extension(167,KHR,blend_equation_advanced_coherent, GL210, None) // #174
     _extension(168,KHR,no_error,                        GL210,  None) // #175
+    _extension(169,KHR,parallel_shader_compile,         GL210,  None) // #192
 } namespace NV {
-    _extension(169,NV,primitive_restart,                GL210, GL310) // #285
-    _extension(170,NV,depth_buffer_float,               GL210, GL300) // #334
-    _extension(171,NV,conditional_render,               GL210, GL300) // #346
+    _extension(170,NV,primitive_restart,                GL210, GL310) // #285
+    _extension(171,NV,depth_buffer_float,               GL210, GL300) // #334
+    _extension(172,NV,conditional_render,               GL210, GL300) // #346
     /* NV_draw_texture not supported */                               // #430
 }
 /* IMPORTANT: if this line is > 329 (73 + size), don't forget to update array size in Context.h */
@@ -398,6 +399,7 @@ namespace ANDROID {
     _extension( 76,KHR,robust_buffer_access_behavior, GLES200, GLES320) // #189
     _extension( 77,KHR,context_flush_control,       GLES200,    None) // #191
     _extension( 78,KHR,no_error,                    GLES200,    None) // #243
+    _extension( 79,KHR,parallel_shader_compile,     GLES200,    None) // #288
 } namespace NV {
     #ifdef MAGNUM_TARGET_GLES2
     _extension( 80,NV,draw_buffers,                 GLES200, GLES300) // #91
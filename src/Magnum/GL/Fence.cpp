@@ -0,0 +1,110 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Fence.h"
+
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Implementation/ContextState.h"
+#include "Magnum/GL/Implementation/State.h"
+
+namespace Magnum { namespace GL {
+
+std::int64_t Fence::maxServerWaitTimeout() {
+    std::int64_t& value = Context::current().state().context->maxServerWaitTimeout;
+
+    /* Get the value, if not already cached */
+    if(value == 0) {
+        GLint64 timeout;
+        glGetInteger64v(GL_MAX_SERVER_WAIT_TIMEOUT, &timeout);
+        value = timeout;
+    }
+
+    return value;
+}
+
+Fence::Fence(): _id{glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)}, _flags{ObjectFlag::DeleteOnDestruction} {}
+
+Fence::~Fence() {
+    /* Moved out or not deleting on destruction, nothing to do */
+    if(!_id || !(_flags & ObjectFlag::DeleteOnDestruction)) return;
+
+    glDeleteSync(_id);
+}
+
+Fence& Fence::operator=(Fence&& other) noexcept {
+    using std::swap;
+    swap(_id, other._id);
+    swap(_flags, other._flags);
+    return *this;
+}
+
+GLsync Fence::release() {
+    const GLsync id = _id;
+    _id = {};
+    return id;
+}
+
+Fence& Fence::insert() {
+    if(_id && (_flags & ObjectFlag::DeleteOnDestruction)) glDeleteSync(_id);
+    _id = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    _flags |= ObjectFlag::DeleteOnDestruction;
+    return *this;
+}
+
+bool Fence::isSignaled() const {
+    if(!_id) return false;
+
+    GLint status;
+    glGetSynciv(_id, GL_SYNC_STATUS, 1, nullptr, &status);
+    return status == GL_SIGNALED;
+}
+
+Fence::WaitResult Fence::clientWait(const std::uint64_t timeout, const ClientWaitFlags flags) {
+    return WaitResult(glClientWaitSync(_id, GLbitfield(flags), timeout));
+}
+
+Fence& Fence::serverWait() {
+    glWaitSync(_id, 0, GL_TIMEOUT_IGNORED);
+    return *this;
+}
+
+Debug& operator<<(Debug& debug, Fence::WaitResult value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case Fence::WaitResult::value: return debug << "GL::Fence::WaitResult::" #value;
+        _c(AlreadySignaled)
+        _c(TimeoutExpired)
+        _c(ConditionSatisfied)
+        _c(WaitFailed)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "GL::Fence::WaitResult(" << Debug::nospace << reinterpret_cast<void*>(GLenum(value)) << Debug::nospace << ")";
+}
+
+}}
@@ -0,0 +1,261 @@
+#ifndef Magnum_GL_Fence_h
+#define Magnum_GL_Fence_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::GL::Fence
+ */
+#endif
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Tags.h"
+#include "Magnum/GL/AbstractObject.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace GL {
+
+/**
+@brief Fence sync object
+
+Signals once all OpenGL commands issued before it are complete. Useful for
+overlapping CPU and GPU work without calling @fn_gl{Finish} --- for example
+to know when an asynchronous readback is done or when a region of a
+persistently mapped buffer can be written again:
+
+@code{.cpp}
+GL::Fence fence;
+
+// ... other work ...
+
+if(fence.clientWait(1000000) == GL::Fence::WaitResult::TimeoutExpired) {
+    // still not done after a millisecond
+}
+@endcode
+
+The fence is inserted into the command stream on construction, use
+@ref insert() to insert it again. See @ref TextureUploader and @ref RingBuffer
+for higher-level functionality built on top.
+
+@requires_gl32 Extension @gl_extension{ARB,sync}
+@requires_gles30 Sync objects are not available in OpenGL ES 2.0.
+@requires_webgl20 Sync objects are not available in WebGL 1.0.
+*/
+class MAGNUM_GL_EXPORT Fence {
+    public:
+        /**
+         * @brief Client wait flag
+         *
+         * @see @ref ClientWaitFlags, @ref clientWait()
+         * @m_enum_values_as_keywords
+         */
+        enum class ClientWaitFlag: GLbitfield {
+            /**
+             * Flush the command queue before waiting so the fence is
+             * guaranteed to be signaled eventually.
+             */
+            FlushCommands = GL_SYNC_FLUSH_COMMANDS_BIT
+        };
+
+        /**
+         * @brief Client wait flags
+         *
+         * @see @ref clientWait()
+         */
+        typedef Containers::EnumSet<ClientWaitFlag> ClientWaitFlags;
+
+        /**
+         * @brief Wait result
+         *
+         * @see @ref clientWait()
+         * @m_enum_values_as_keywords
+         */
+        enum class WaitResult: GLenum {
+            /** The fence was already signaled when the wait started */
+            AlreadySignaled = GL_ALREADY_SIGNALED,
+
+            /** The timeout expired before the fence got signaled */
+            TimeoutExpired = GL_TIMEOUT_EXPIRED,
+
+            /** The fence got signaled before the timeout expired */
+            ConditionSatisfied = GL_CONDITION_SATISFIED,
+
+            /** An error occured */
+            WaitFailed = GL_WAIT_FAILED
+        };
+
+        /**
+         * @brief Max server wait timeout
+         *
+         * The result is cached, repeated queries don't result in repeated
+         * OpenGL calls. Returned as @ref std::int64_t because the
+         * @ref Magnum::Long "Long" typedef is not available on WebGL.
+         * @see @ref serverWait(), @fn_gl{Get} with
+         *      @def_gl_keyword{MAX_SERVER_WAIT_TIMEOUT}
+         */
+        static std::int64_t maxServerWaitTimeout();
+
+        /**
+         * @brief Wrap existing OpenGL sync object
+         * @param id            OpenGL sync object
+         * @param flags         Object creation flags
+         *
+         * The @p id is expected to be of an existing OpenGL sync object.
+         * Unlike fence created using constructor, the OpenGL object is by
+         * default not deleted on destruction, use @p flags for different
+         * behavior.
+         * @see @ref release()
+         */
+        static Fence wrap(GLsync id, ObjectFlags flags = {}) {
+            return Fence{id, flags};
+        }
+
+        /**
+         * @brief Constructor
+         *
+         * Creates new OpenGL sync object and inserts it into the command
+         * stream.
+         * @see @ref Fence(NoCreateT), @ref wrap(), @fn_gl_keyword{FenceSync}
+         *      with @def_gl{SYNC_GPU_COMMANDS_COMPLETE}
+         */
+        explicit Fence();
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * @see @ref Fence(), @ref wrap()
+         */
+        explicit Fence(NoCreateT) noexcept: _id{}, _flags{ObjectFlag::DeleteOnDestruction} {}
+
+        /** @brief Copying is not allowed */
+        Fence(const Fence&) = delete;
+
+        /** @brief Move constructor */
+        Fence(Fence&& other) noexcept: _id{other._id}, _flags{other._flags} {
+            other._id = {};
+        }
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes associated OpenGL sync object.
+         * @see @ref wrap(), @ref release(), @fn_gl_keyword{DeleteSync}
+         */
+        ~Fence();
+
+        /** @brief Copying is not allowed */
+        Fence& operator=(const Fence&) = delete;
+
+        /** @brief Move assignment */
+        Fence& operator=(Fence&& other) noexcept;
+
+        /** @brief OpenGL sync object */
+        GLsync id() const { return _id; }
+
+        /**
+         * @brief Release OpenGL object
+         *
+         * Releases ownership of OpenGL sync object and returns it. The
+         * instance is then equivalent to moved-from state.
+         * @see @ref wrap()
+         */
+        GLsync release();
+
+        /**
+         * @brief Insert the fence again
+         * @return Reference to self (for method chaining)
+         *
+         * Deletes the current sync object, if any, and inserts a new one at
+         * the current position in the command stream.
+         * @see @fn_gl_keyword{DeleteSync}, @fn_gl_keyword{FenceSync}
+         */
+        Fence& insert();
+
+        /**
+         * @brief Whether the fence is signaled
+         *
+         * Doesn't block. Returns @cpp false @ce for a moved-from or
+         * @ref Fence(NoCreateT) "NoCreate"'d instance.
+         * @see @ref clientWait(), @fn_gl_keyword{GetSync} with
+         *      @def_gl{SYNC_STATUS}
+         */
+        bool isSignaled() const;
+
+        /**
+         * @brief Wait for the fence on the client side
+         * @param timeout   Timeout in nanoseconds
+         * @param flags     Wait flags
+         *
+         * Blocks until the fence is signaled or the @p timeout expires.
+         * Passing @cpp 0 @ce for the timeout only checks the current state,
+         * similarly to @ref isSignaled(). Unless the command queue was
+         * flushed after inserting the fence, @ref ClientWaitFlag::FlushCommands
+         * should be specified to ensure the wait terminates. The timeout
+         * is @ref std::uint64_t because the
+         * @ref Magnum::UnsignedLong "UnsignedLong" typedef is not available
+         * on WebGL.
+         * @see @fn_gl_keyword{ClientWaitSync}
+         * @requires_webgl20 In WebGL the timeout has to be @cpp 0 @ce.
+         */
+        WaitResult clientWait(std::uint64_t timeout, ClientWaitFlags flags = ClientWaitFlag::FlushCommands);
+
+        /**
+         * @brief Wait for the fence on the server side
+         * @return Reference to self (for method chaining)
+         *
+         * Doesn't block the client, only makes the GPU wait with executing
+         * any further commands until the fence is signaled. Useful for
+         * synchronization between shared contexts. The wait is limited by
+         * @ref maxServerWaitTimeout().
+         * @see @fn_gl_keyword{WaitSync} with @def_gl{TIMEOUT_IGNORED}
+         */
+        Fence& serverWait();
+
+    private:
+        explicit Fence(GLsync id, ObjectFlags flags) noexcept: _id{id}, _flags{flags} {}
+
+        GLsync _id;
+        ObjectFlags _flags;
+};
+
+CORRADE_ENUMSET_OPERATORS(Fence::ClientWaitFlags)
+
+/** @debugoperatorclassenum{Fence,Fence::WaitResult} */
+MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, Fence::WaitResult value);
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
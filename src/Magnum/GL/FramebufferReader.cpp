@@ -0,0 +1,120 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FramebufferReader.h"
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/AbstractFramebuffer.h"
+#include "Magnum/GL/PixelFormat.h"
+
+namespace Magnum { namespace GL {
+
+FramebufferReader::FramebufferReader(const UnsignedInt frameCount): _first{}, _pending{}, _mapped{} {
+    CORRADE_ASSERT(frameCount,
+        "GL::FramebufferReader: expected non-zero frame count", );
+
+    _slots.resize(frameCount);
+    for(Slot& slot: _slots)
+        slot.image = BufferImage2D{PixelFormat::RGBA, PixelType::UnsignedByte};
+}
+
+FramebufferReader::FramebufferReader(NoCreateT) noexcept: _first{}, _pending{}, _mapped{} {}
+
+FramebufferReader::FramebufferReader(FramebufferReader&& other) noexcept: _slots{std::move(other._slots)}, _first{other._first}, _pending{other._pending}, _mapped{other._mapped} {
+    other._slots.clear();
+    other._first = other._pending = 0;
+    other._mapped = false;
+}
+
+FramebufferReader::~FramebufferReader() = default;
+
+FramebufferReader& FramebufferReader::operator=(FramebufferReader&& other) noexcept {
+    using std::swap;
+    swap(_slots, other._slots);
+    swap(_first, other._first);
+    swap(_pending, other._pending);
+    swap(_mapped, other._mapped);
+    return *this;
+}
+
+void FramebufferReader::read(AbstractFramebuffer& framebuffer, const Range2Di& rectangle, const PixelStorage& storage, const PixelFormat format, const PixelType type) {
+    CORRADE_ASSERT(_pending < _slots.size(),
+        "GL::FramebufferReader::read(): no free buffer, unmap() the oldest readback first", );
+
+    Slot& slot = _slots[(_first + _pending) % _slots.size()];
+
+    /* Keep the current storage, AbstractFramebuffer::read() enlarges it if
+       needed */
+    slot.image.setData(storage, format, type, {}, nullptr, BufferUsage::StreamRead);
+    framebuffer.read(rectangle, slot.image, BufferUsage::StreamRead);
+    slot.fence.insert();
+    ++_pending;
+}
+
+void FramebufferReader::read(AbstractFramebuffer& framebuffer, const Range2Di& rectangle, const PixelStorage& storage, const Magnum::PixelFormat format) {
+    read(framebuffer, rectangle, storage, pixelFormat(format), pixelType(format));
+}
+
+bool FramebufferReader::isReady() {
+    if(!_pending) return false;
+
+    /* Zero timeout only checks the state. Flush the queue so the fence
+       is guaranteed to signal eventually even if nothing else does. */
+    const Fence::WaitResult result = _slots[_first].fence.clientWait(0);
+    return result == Fence::WaitResult::AlreadySignaled ||
+           result == Fence::WaitResult::ConditionSatisfied;
+}
+
+ImageView2D FramebufferReader::map() {
+    CORRADE_ASSERT(_pending && !_mapped,
+        "GL::FramebufferReader::map(): no readback pending or the oldest is already mapped", (ImageView2D{Magnum::PixelFormat::RGBA8Unorm, {}}));
+
+    Slot& slot = _slots[_first];
+
+    /* Flush the command queue on the first try so the fence is guaranteed to
+       signal eventually, then just keep waiting */
+    Fence::ClientWaitFlags flags = Fence::ClientWaitFlag::FlushCommands;
+    while(slot.fence.clientWait(1000000000ull, flags) == Fence::WaitResult::TimeoutExpired)
+        flags = {};
+
+    const Containers::ArrayView<char> data = slot.image.buffer().map(0, slot.image.dataSize(), Buffer::MapFlag::Read);
+    _mapped = true;
+    return ImageView2D{slot.image.storage(), slot.image.format(), slot.image.type(), slot.image.size(), data};
+}
+
+void FramebufferReader::unmap() {
+    CORRADE_ASSERT(_mapped,
+        "GL::FramebufferReader::unmap(): no readback mapped", );
+
+    Slot& slot = _slots[_first];
+    slot.image.buffer().unmap();
+    slot.fence = Fence{NoCreate};
+
+    _first = (_first + 1) % _slots.size();
+    --_pending;
+    _mapped = false;
+}
+
+}}
@@ -0,0 +1,235 @@
+#ifndef Magnum_GL_FramebufferReader_h
+#define Magnum_GL_FramebufferReader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::GL::FramebufferReader
+ */
+#endif
+
+#include <vector>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelStorage.h"
+#include "Magnum/GL/BufferImage.h"
+#include "Magnum/GL/Fence.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace GL {
+
+/**
+@brief Asynchronous framebuffer reader
+
+Keeps a ring of pixel pack buffers and reads framebuffer contents into them
+without stalling the pipeline. Compared to
+@ref AbstractFramebuffer::read(const Range2Di&, Image2D&), which has to wait
+until all rendering to the framebuffer is done and the data are copied to
+client memory, @ref read() only queues the copy on the GPU and places a fence
+after it. The result is mapped a few frames later when the GPU is done with
+it, so the CPU and GPU work can overlap --- useful for example when streaming
+rendered frames to a video encoder.
+
+@section GL-FramebufferReader-usage Usage
+
+Each call to @ref read() occupies one buffer in the ring. Once a readback
+finishes, the oldest one can be mapped using @ref map(), which returns a view
+on the pixel data that stays valid until @ref unmap() is called. The results
+are always returned in the order in which the reads were issued.
+
+@code{.cpp}
+GL::FramebufferReader reader{3};
+
+// each frame, after drawing
+reader.read(GL::defaultFramebuffer, GL::defaultFramebuffer.viewport(),
+    GL::PixelFormat::RGBA, GL::PixelType::UnsignedByte);
+if(reader.isReady() || reader.pendingCount() == reader.frameCount()) {
+    ImageView2D image = reader.map();
+    encoder.encode(image);
+    reader.unmap();
+}
+@endcode
+
+The @ref isReady() check doesn't block, while @ref map() waits for the oldest
+readback to finish if the GPU didn't get to it yet. With @ref frameCount()
+buffers in the ring the result of a particular frame is usually available
+@cpp frameCount() - 1 @ce frames later. Calling @ref read() when all buffers
+are occupied is not allowed, so make sure to consume the results at least at
+the rate they are produced.
+@see @ref TextureUploader
+@requires_gles30 Pixel buffer objects are not available in OpenGL ES 2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_GL_EXPORT FramebufferReader {
+    public:
+        /**
+         * @brief Constructor
+         * @param frameCount    Count of buffers in the ring
+         *
+         * Expects that @p frameCount is non-zero. Creates @p frameCount
+         * buffers, their storage is allocated on first use.
+         * @see @ref FramebufferReader(NoCreateT)
+         */
+        explicit FramebufferReader(UnsignedInt frameCount = 3);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL objects
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * @see @ref FramebufferReader(UnsignedInt)
+         */
+        explicit FramebufferReader(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        FramebufferReader(const FramebufferReader&) = delete;
+
+        /** @brief Move constructor */
+        FramebufferReader(FramebufferReader&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Pending readbacks are discarded.
+         */
+        ~FramebufferReader();
+
+        /** @brief Copying is not allowed */
+        FramebufferReader& operator=(const FramebufferReader&) = delete;
+
+        /** @brief Move assignment */
+        FramebufferReader& operator=(FramebufferReader&&) noexcept;
+
+        /** @brief Count of buffers in the ring */
+        UnsignedInt frameCount() const { return UnsignedInt(_slots.size()); }
+
+        /**
+         * @brief Count of pending readbacks
+         *
+         * Readbacks issued with @ref read() that weren't consumed with
+         * @ref unmap() yet, including the currently mapped one.
+         */
+        UnsignedInt pendingCount() const { return _pending; }
+
+        /**
+         * @brief Read block of pixels from framebuffer
+         * @param framebuffer   Framebuffer to read from
+         * @param rectangle     Framebuffer rectangle to read
+         * @param storage       Storage of pixel data
+         * @param format        Format of pixel data
+         * @param type          Data type of pixel data
+         *
+         * Expects that there's a free buffer in the ring, i.e.
+         * @ref pendingCount() is less than @ref frameCount(). Reads the
+         * pixels into the next free buffer using the same operation as
+         * @ref AbstractFramebuffer::read(const Range2Di&, BufferImage2D&, BufferUsage)
+         * and places a fence after it. Doesn't wait for the operation to
+         * finish. The buffer storage is reallocated only if it's not large
+         * enough to contain the data.
+         * @see @fn_gl_keyword{FenceSync}
+         */
+        void read(AbstractFramebuffer& framebuffer, const Range2Di& rectangle, const PixelStorage& storage, PixelFormat format, PixelType type);
+
+        /** @overload
+         *
+         * Equivalent to the above with default-constructed
+         * @ref PixelStorage.
+         */
+        void read(AbstractFramebuffer& framebuffer, const Range2Di& rectangle, PixelFormat format, PixelType type) {
+            read(framebuffer, rectangle, {}, format, type);
+        }
+
+        /**
+         * @brief Read block of pixels from framebuffer
+         *
+         * Equivalent to calling @ref read(AbstractFramebuffer&, const Range2Di&, const PixelStorage&, PixelFormat, PixelType)
+         * with a GL-specific format and type corresponding to given generic
+         * @p format.
+         * @see @ref pixelFormat(), @ref pixelType()
+         */
+        void read(AbstractFramebuffer& framebuffer, const Range2Di& rectangle, const PixelStorage& storage, Magnum::PixelFormat format);
+
+        /** @overload
+         *
+         * Equivalent to the above with default-constructed
+         * @ref PixelStorage.
+         */
+        void read(AbstractFramebuffer& framebuffer, const Range2Di& rectangle, Magnum::PixelFormat format) {
+            read(framebuffer, rectangle, {}, format);
+        }
+
+        /**
+         * @brief Whether the oldest pending readback is finished
+         *
+         * Doesn't block. Returns @cpp false @ce if there's no pending
+         * readback.
+         * @see @ref map(), @fn_gl_keyword{ClientWaitSync}
+         */
+        bool isReady();
+
+        /**
+         * @brief Map the oldest pending readback
+         *
+         * Expects that @ref pendingCount() is non-zero and the readback isn't
+         * already mapped. Waits until the readback is finished and maps the
+         * buffer for reading. The returned view has the storage, format,
+         * type and size passed to @ref read() and is valid until
+         * @ref unmap() is called.
+         * @see @ref isReady(), @fn_gl_keyword{ClientWaitSync},
+         *      @ref Buffer::map(GLintptr, GLsizeiptr, MapFlags)
+         */
+        ImageView2D map();
+
+        /**
+         * @brief Unmap the oldest pending readback
+         *
+         * Expects that the readback was mapped using @ref map(). The buffer
+         * is then made available to subsequent @ref read() calls.
+         * @see @ref Buffer::unmap()
+         */
+        void unmap();
+
+    private:
+        struct Slot {
+            BufferImage2D image{NoCreate};
+            Fence fence{NoCreate};
+        };
+
+        std::vector<Slot> _slots;
+        UnsignedInt _first, _pending;
+        bool _mapped;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
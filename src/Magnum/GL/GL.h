@@ -53,6 +53,7 @@ template<UnsignedInt, class> class Attribute;
 
 enum class BufferUsage: GLenum;
 class Buffer;
+class BufferAllocator;
 
 #ifndef MAGNUM_TARGET_GLES2
 template<UnsignedInt> class BufferImage;
@@ -84,7 +85,13 @@ class CubeMapTextureArray;
 /* DimensionTraits forward declaration is not needed */
 
 class Extension;
+#ifndef MAGNUM_TARGET_GLES2
+class Fence;
+#endif
 class Framebuffer;
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class FramebufferReader;
+#endif
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
 enum class ImageFormat: GLenum;
@@ -95,6 +102,9 @@ enum class MeshPrimitive: GLenum;
 enum class MeshIndexType: GLenum;
 
 class Mesh;
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class MeshLayout;
+#endif
 class MeshView;
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
@@ -111,6 +121,9 @@ enum class CompressedPixelFormat: GLenum;
 /* ObjectFlag, ObjectFlags are used only in conjunction with *::wrap() function */
 
 class PrimitiveQuery;
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class ProgramBinaryCache;
+#endif
 class SampleQuery;
 class TimeQuery;
 
@@ -121,6 +134,13 @@ class RectangleTexture;
 class Renderbuffer;
 enum class RenderbufferFormat: GLenum;
 
+enum class RenderPassLoadAction: UnsignedByte;
+enum class RenderPassStoreAction: UnsignedByte;
+class RenderPass;
+class RenderState;
+
+class RingBuffer;
+
 enum class SamplerFilter: GLint;
 enum class SamplerMipmap: GLint;
 enum class SamplerWrapping: GLint;
@@ -150,11 +170,19 @@ typedef TextureArray<2> Texture2DArray;
 
 enum class TextureFormat: GLenum;
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class TextureUploader;
+#endif
+
 #ifndef MAGNUM_TARGET_GLES2
 class TransformFeedback;
 #endif
 
 enum class Version: Int;
+
+#ifndef MAGNUM_TARGET_GLES2
+class VolumeBrickCache;
+#endif
 #endif
 
 }}
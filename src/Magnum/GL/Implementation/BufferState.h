@@ -59,6 +59,9 @@ struct BufferState {
     void(Buffer::*getSubDataImplementation)(GLintptr, GLsizeiptr, GLvoid*);
     #endif
     void(Buffer::*dataImplementation)(GLsizeiptr, const GLvoid*, BufferUsage);
+    #ifndef MAGNUM_TARGET_GLES
+    void(Buffer::*storageImplementation)(GLsizeiptr, const GLvoid*, Buffer::StorageFlags);
+    #endif
     void(Buffer::*subDataImplementation)(GLintptr, GLsizeiptr, const GLvoid*);
     void(Buffer::*invalidateImplementation)();
     void(Buffer::*invalidateSubImplementation)(GLintptr, GLsizeiptr);
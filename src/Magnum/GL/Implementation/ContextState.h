@@ -51,6 +51,11 @@ struct ContextState {
 
     bool (Context::*isCoreProfileImplementation)();
     #endif
+
+    /* Limits */
+    #ifndef MAGNUM_TARGET_GLES2
+    std::int64_t maxServerWaitTimeout{};
+    #endif
 };
 
 }}}
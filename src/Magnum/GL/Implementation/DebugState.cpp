@@ -36,7 +36,9 @@ DebugState::DebugState(Context& context, std::vector<std::string>& extensions):
     maxLoggedMessages{0},
     maxMessageLength{0},
     maxStackDepth{0},
-    messageCallback(nullptr)
+    messageCallback(nullptr),
+    messageUserParam(nullptr),
+    messageQueue(nullptr)
 {
     #ifndef MAGNUM_TARGET_GLES2
     #ifndef MAGNUM_TARGET_GLES
@@ -35,7 +35,15 @@
 #error this header is not available in WebGL build
 #endif
 
-namespace Magnum { namespace GL { namespace Implementation {
+namespace Magnum { namespace GL {
+
+class DebugOutputQueue;
+
+namespace Implementation {
+
+/* The same as used by DebugOutput::setDefaultCallback(), used also by
+   DebugOutputQueue */
+void defaultDebugCallback(DebugOutput::Source source, DebugOutput::Type type, UnsignedInt id, DebugOutput::Severity severity, const std::string& string, const void*);
 
 struct DebugState {
     explicit DebugState(Context& context, std::vector<std::string>& extensions);
@@ -51,6 +59,9 @@ struct DebugState {
 
     GLint maxLabelLength, maxLoggedMessages, maxMessageLength, maxStackDepth;
     DebugOutput::Callback messageCallback;
+    const void* messageUserParam;
+    /* If set, messages go here instead of to the callback */
+    DebugOutputQueue* messageQueue;
 };
 
 }}}
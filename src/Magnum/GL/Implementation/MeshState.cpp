@@ -189,6 +189,10 @@ MeshState::~MeshState() {
 
 void MeshState::reset() {
     currentVAO = State::DisengagedBinding;
+    vertexAttributes.clear();
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    ++layoutBindingGeneration;
+    #endif
 }
 
 }}}
@@ -59,7 +59,7 @@ struct MeshState {
     #endif
 
     #ifdef MAGNUM_TARGET_GLES
-    void(*multiDrawImplementation)(std::initializer_list<std::reference_wrapper<MeshView>>);
+    void(*multiDrawImplementation)(Containers::ArrayView<const std::reference_wrapper<MeshView>>);
     #endif
 
     void(*bindVAOImplementation)(GLuint);
@@ -69,6 +69,34 @@ struct MeshState {
     #endif
 
     GLuint currentVAO;
+
+    /* Shadow of the vertex attribute state used if VAOs are not available,
+       allowing to skip redundant glVertexAttribPointer() and
+       glEnableVertexAttribArray() calls between consecutive meshes sharing
+       buffers and layouts. Indexed by attribute location, grown on demand.
+       Zero buffer ID means the attribute pointer state is unknown. */
+    struct VertexAttribute {
+        GLuint buffer;
+        GLint size;
+        GLenum type;
+        DynamicAttribute::Kind kind;
+        GLintptr offset;
+        GLsizei stride;
+        GLuint divisor;
+        bool enabled;
+        /* Generation of the last bind that used this attribute, attributes
+           with an older generation get disabled */
+        UnsignedInt generation;
+    };
+    std::vector<VertexAttribute> vertexAttributes;
+    UnsignedInt vertexAttributeGeneration{};
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Incremented every time buffers attached to MeshLayout binding points
+       can't be trusted anymore -- on buffer deletion, as the ID can get
+       reused while the layouts still reference the orphaned buffer, and on
+       state reset */
+    UnsignedInt layoutBindingGeneration{};
+    #endif
     #ifndef MAGNUM_TARGET_GLES2
     #ifndef MAGNUM_TARGET_WEBGL
     GLint64 maxElementIndex;
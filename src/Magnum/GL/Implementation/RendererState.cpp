@@ -31,10 +31,11 @@
 
 namespace Magnum { namespace GL { namespace Implementation {
 
-RendererState::RendererState(Context& context, std::vector<std::string>& extensions)
+RendererState::RendererState(Context& context, std::vector<std::string>& extensions):
     #ifndef MAGNUM_TARGET_WEBGL
-    : resetNotificationStrategy()
+    resetNotificationStrategy(),
     #endif
+    renderStateUnknown{RenderStateAll}
 {
     /* Float depth clear value implementation */
     #ifndef MAGNUM_TARGET_GLES
@@ -86,6 +87,24 @@ RendererState::RendererState(Context& context, std::vector<std::string>& extensi
     #endif
 }
 
+void RendererState::invalidateRenderState(const Renderer::Feature feature) {
+    switch(feature) {
+        case Renderer::Feature::Blending:
+            renderStateUnknown |= RenderStateBlending;
+            return;
+        case Renderer::Feature::DepthTest:
+            renderStateUnknown |= RenderStateDepthTest;
+            return;
+        case Renderer::Feature::FaceCulling:
+            renderStateUnknown |= RenderStateFaceCulling;
+            return;
+        case Renderer::Feature::StencilTest:
+            renderStateUnknown |= RenderStateStencilTest;
+            return;
+        default: return;
+    }
+}
+
 RendererState::PixelStorage::PixelStorage():
     alignment{4}
     #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/RenderState.h"
 #include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace GL { namespace Implementation {
@@ -70,6 +71,33 @@ struct RendererState {
 
     PixelStorage packPixelStorage, unpackPixelStorage;
 
+    /* Parts of the render state, used for marking them as unknown */
+    enum: UnsignedShort {
+        RenderStateBlending = 1 << 0,
+        RenderStateBlendEquation = 1 << 1,
+        RenderStateBlendFunction = 1 << 2,
+        RenderStateDepthTest = 1 << 3,
+        RenderStateDepthFunction = 1 << 4,
+        RenderStateDepthMask = 1 << 5,
+        RenderStateFaceCulling = 1 << 6,
+        RenderStateFaceCullingMode = 1 << 7,
+        RenderStateStencilTest = 1 << 8,
+        RenderStateStencilFunction = 1 << 9,
+        RenderStateStencilOperation = 1 << 10,
+        RenderStateStencilMask = 1 << 11,
+        RenderStateColorMask = 1 << 12,
+        RenderStateAll = (1 << 13) - 1
+    };
+
+    /* Last state applied with RenderState::apply(). Parts in
+       renderStateUnknown were changed directly through Renderer or reset
+       and get applied unconditionally next time. */
+    RenderState renderState;
+    UnsignedShort renderStateUnknown;
+
+    /* Used by Renderer::enable() and Renderer::disable() */
+    void invalidateRenderState(Renderer::Feature feature);
+
     /* Bool parameter is ugly, but this is implementation detail of internal
        API so who cares */
     void applyPixelStorageInternal(const Magnum::PixelStorage& storage, bool unpack);
@@ -33,7 +33,11 @@
 
 namespace Magnum { namespace GL { namespace Implementation {
 
-ShaderProgramState::ShaderProgramState(Context& context, std::vector<std::string>& extensions): current(0), maxVertexAttributes(0)
+ShaderProgramState::ShaderProgramState(Context& context, std::vector<std::string>& extensions): current(0),
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        binaryCache(nullptr),
+        #endif
+        maxVertexAttributes(0)
         #ifndef MAGNUM_TARGET_GLES2
         #ifndef MAGNUM_TARGET_WEBGL
         , maxAtomicCounterBufferSize(0), maxComputeSharedMemorySize(0), maxComputeWorkGroupInvocations(0), maxImageUnits(0), maxCombinedShaderOutputResources(0), maxUniformLocations(0)
@@ -47,6 +51,16 @@ ShaderProgramState::ShaderProgramState(Context& context, std::vector<std::string
         , maxImageSamples(0)
         #endif
 {
+    /* The extension is added to the list in ShaderState already */
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(context.isExtensionSupported<Extensions::KHR::parallel_shader_compile>())
+        isLinkFinishedImplementation = &AbstractShaderProgram::isLinkFinishedImplementationKHR;
+    else
+    #endif
+    {
+        isLinkFinishedImplementation = &AbstractShaderProgram::isLinkFinishedImplementationNoOp;
+    }
+
     #ifndef MAGNUM_TARGET_GLES2
     #ifdef CORRADE_TARGET_WINDOWS
     if((context.detectedDriver() & Context::DetectedDriver::NVidia) &&
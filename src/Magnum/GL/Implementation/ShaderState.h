@@ -52,6 +52,7 @@ struct ShaderState {
     };
 
     void(Shader::*addSourceImplementation)(std::string);
+    bool(Shader::*isCompileFinishedImplementation)();
 
     GLint maxVertexOutputComponents,
         maxFragmentInputComponents;
@@ -151,6 +151,11 @@ struct TextureState {
     #endif
 
     Containers::Array<std::pair<GLenum, GLuint>> bindings;
+    /* Bindings deferred by AbstractTexture::bindDeferred() until the next
+       draw, target of zero means nothing is deferred for given unit. The
+       range is the span of units touched since the last flush. */
+    Containers::Array<std::pair<GLenum, GLuint>> deferredBindings;
+    GLint deferredFirst{}, deferredEnd{};
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
     /* Texture object ID, level, layered, layer, access */
     Containers::Array<std::tuple<GLuint, GLint, GLboolean, GLint, GLenum>> imageBindings;
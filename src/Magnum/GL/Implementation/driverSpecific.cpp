@@ -24,6 +24,8 @@
 */
 
 #include <algorithm>
+#include <cstring>
+#include <iterator>
 
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
@@ -32,8 +34,10 @@
 namespace Magnum { namespace GL {
 
 namespace {
-    /* Search the code for the following strings to see where they are implemented. */
-    std::vector<std::string> KnownWorkarounds{
+    /* Search the code for the following strings to see where they are
+       implemented. A plain array to avoid allocating all the strings on
+       startup. */
+    const char* const KnownWorkarounds[]{
         /* [workarounds] */
         #if !defined(MAGNUM_TARGET_GLES) && !defined(CORRADE_TARGET_APPLE)
         /* Creating core context with specific version on AMD and NV
@@ -153,33 +157,45 @@ auto Context::detectedDriver() -> DetectedDrivers {
 
     _detectedDrivers = DetectedDrivers{};
 
-    const std::string renderer = rendererString();
-    const std::string vendor = vendorString();
-    const std::string version = versionString();
+    /* Matching directly in the driver-provided memory instead of making
+       std::string copies. The strings shouldn't be null for a valid context,
+       but don't trust the drivers. */
+    const auto glString = [](const GLenum name) -> const char* {
+        const char* const string = reinterpret_cast<const char*>(glGetString(name));
+        return string ? string : "";
+    };
+    const char* const renderer = glString(GL_RENDERER);
+    const char* const vendor = glString(GL_VENDOR);
+    const char* const version = glString(GL_VERSION);
+    #if defined(CORRADE_TARGET_APPLE) || defined(MAGNUM_TARGET_WEBGL)
+    static_cast<void>(renderer);
+    static_cast<void>(vendor);
+    static_cast<void>(version);
+    #endif
 
     /* Apple has its own drivers */
     #if !defined(CORRADE_TARGET_APPLE) && !defined(MAGNUM_TARGET_WEBGL)
     /* AMD binary desktop drivers */
-    if(vendor.find("ATI Technologies Inc.") != std::string::npos)
+    if(std::strstr(vendor, "ATI Technologies Inc."))
         return *_detectedDrivers |= DetectedDriver::Amd;
 
     #ifdef CORRADE_TARGET_WINDOWS
     /* Intel Windows drivers */
-    if(vendor.find("Intel") != std::string::npos)
+    if(std::strstr(vendor, "Intel"))
         return *_detectedDrivers |= DetectedDriver::IntelWindows;
     #endif
 
     /* Mesa drivers */
-    if(version.find("Mesa") != std::string::npos) {
+    if(std::strstr(version, "Mesa")) {
         *_detectedDrivers |= DetectedDriver::Mesa;
 
-        if(renderer.find("SVGA3D") != std::string::npos)
+        if(std::strstr(renderer, "SVGA3D"))
             *_detectedDrivers |= DetectedDriver::Svga3D;
 
         return *_detectedDrivers;
     }
 
-    if(vendor.find("NVIDIA Corporation") != std::string::npos)
+    if(std::strstr(vendor, "NVIDIA Corporation"))
         return *_detectedDrivers |= DetectedDriver::NVidia;
     #endif
 
@@ -192,7 +208,7 @@ auto Context::detectedDriver() -> DetectedDrivers {
     {
         Range1Di range;
         glGetIntegerv(GL_ALIASED_LINE_WIDTH_RANGE, range.data());
-        if(range.min() == 1 && range.max() == 1 && vendor != "Internet Explorer")
+        if(range.min() == 1 && range.max() == 1 && std::strcmp(vendor, "Internet Explorer") != 0)
             return *_detectedDrivers |= DetectedDriver::Angle;
     }
     #endif
@@ -202,7 +218,7 @@ auto Context::detectedDriver() -> DetectedDrivers {
 
 void Context::disableDriverWorkaround(const std::string& workaround) {
     /* Ignore unknown workarounds */
-    if(std::find(KnownWorkarounds.begin(), KnownWorkarounds.end(), workaround) == KnownWorkarounds.end()) {
+    if(std::find(std::begin(KnownWorkarounds), std::end(KnownWorkarounds), workaround) == std::end(KnownWorkarounds)) {
         Warning() << "Unknown workaround" << workaround;
         return;
     }
@@ -210,7 +226,7 @@ void Context::disableDriverWorkaround(const std::string& workaround) {
 }
 
 bool Context::isDriverWorkaroundDisabled(const std::string& workaround) {
-    CORRADE_INTERNAL_ASSERT(std::find(KnownWorkarounds.begin(), KnownWorkarounds.end(), workaround) != KnownWorkarounds.end());
+    CORRADE_INTERNAL_ASSERT(std::find(std::begin(KnownWorkarounds), std::end(KnownWorkarounds), workaround) != std::end(KnownWorkarounds));
 
     /* If the workaround was already asked for or disabled, return its state,
        otherwise add it to the list as used one */
@@ -0,0 +1,334 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "formatDataSize.h"
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/GL/TextureFormat.h"
+
+namespace Magnum { namespace GL { namespace Implementation {
+
+namespace {
+
+struct FormatBlock {
+    UnsignedByte width, height, size;
+};
+
+FormatBlock textureFormatBlock(const TextureFormat format) {
+    switch(format) {
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        case TextureFormat::Red:
+        case TextureFormat::R8:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case TextureFormat::R8Snorm:
+        case TextureFormat::R8UI:
+        case TextureFormat::R8I:
+        #endif
+        #ifdef MAGNUM_TARGET_GLES2
+        case TextureFormat::Luminance:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        case TextureFormat::R3B3G2:
+        case TextureFormat::RGBA2:
+        #endif
+        #ifndef MAGNUM_TARGET_WEBGL
+        case TextureFormat::StencilIndex8:
+        #endif
+            return {1, 1, 1};
+
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        case TextureFormat::RG:
+        case TextureFormat::RG8:
+        case TextureFormat::DepthComponent16:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case TextureFormat::RG8Snorm:
+        case TextureFormat::RG8UI:
+        case TextureFormat::RG8I:
+        case TextureFormat::R16UI:
+        case TextureFormat::R16I:
+        case TextureFormat::R16F:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        case TextureFormat::R16:
+        case TextureFormat::R16Snorm:
+        case TextureFormat::RGB4:
+        case TextureFormat::RGB5:
+        #endif
+        #ifdef MAGNUM_TARGET_GLES2
+        case TextureFormat::LuminanceAlpha:
+        #endif
+        case TextureFormat::RGB565:
+        case TextureFormat::RGBA4:
+        case TextureFormat::RGB5A1:
+            return {1, 1, 2};
+
+        #ifndef MAGNUM_TARGET_GLES
+        case TextureFormat::RGB16:
+        case TextureFormat::RGBA16:
+        case TextureFormat::RGB16Snorm:
+        case TextureFormat::RGBA16Snorm:
+        case TextureFormat::RGB12:
+        case TextureFormat::RGBA12:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case TextureFormat::RGB16UI:
+        case TextureFormat::RGBA16UI:
+        case TextureFormat::RGB16I:
+        case TextureFormat::RGBA16I:
+        case TextureFormat::RG32UI:
+        case TextureFormat::RG32I:
+        case TextureFormat::RGB16F:
+        case TextureFormat::RGBA16F:
+        case TextureFormat::RG32F:
+        case TextureFormat::Depth32FStencil8:
+        #endif
+            return {1, 1, 8};
+
+        #ifndef MAGNUM_TARGET_GLES2
+        case TextureFormat::RGB32UI:
+        case TextureFormat::RGB32I:
+        case TextureFormat::RGB32F:
+            return {1, 1, 12};
+
+        case TextureFormat::RGBA32UI:
+        case TextureFormat::RGBA32I:
+        case TextureFormat::RGBA32F:
+            return {1, 1, 16};
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        case TextureFormat::CompressedRedRgtc1:
+        case TextureFormat::CompressedSignedRedRgtc1:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case TextureFormat::CompressedRGB8Etc2:
+        case TextureFormat::CompressedSRGB8Etc2:
+        case TextureFormat::CompressedRGB8PunchthroughAlpha1Etc2:
+        case TextureFormat::CompressedSRGB8PunchthroughAlpha1Etc2:
+        case TextureFormat::CompressedR11Eac:
+        case TextureFormat::CompressedSignedR11Eac:
+        #endif
+        case TextureFormat::CompressedRGBS3tcDxt1:
+        case TextureFormat::CompressedRGBAS3tcDxt1:
+            return {4, 4, 8};
+
+        #ifndef MAGNUM_TARGET_GLES
+        case TextureFormat::CompressedRed:
+        case TextureFormat::CompressedRG:
+        case TextureFormat::CompressedRGB:
+        case TextureFormat::CompressedRGBA:
+        case TextureFormat::CompressedRGRgtc2:
+        case TextureFormat::CompressedSignedRGRgtc2:
+        case TextureFormat::CompressedRGBBptcUnsignedFloat:
+        case TextureFormat::CompressedRGBBptcSignedFloat:
+        case TextureFormat::CompressedRGBABptcUnorm:
+        case TextureFormat::CompressedSRGBAlphaBptcUnorm:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case TextureFormat::CompressedRGBA8Etc2Eac:
+        case TextureFormat::CompressedSRGB8Alpha8Etc2Eac:
+        case TextureFormat::CompressedRG11Eac:
+        case TextureFormat::CompressedSignedRG11Eac:
+        #endif
+        case TextureFormat::CompressedRGBAS3tcDxt3:
+        case TextureFormat::CompressedRGBAS3tcDxt5:
+        #ifndef MAGNUM_TARGET_WEBGL
+        case TextureFormat::CompressedRGBAAstc4x4:
+        case TextureFormat::CompressedSRGB8Alpha8Astc4x4:
+        #endif
+            return {4, 4, 16};
+
+        #ifndef MAGNUM_TARGET_WEBGL
+        case TextureFormat::CompressedRGBAAstc5x4:
+        case TextureFormat::CompressedSRGB8Alpha8Astc5x4:
+            return {5, 4, 16};
+        case TextureFormat::CompressedRGBAAstc5x5:
+        case TextureFormat::CompressedSRGB8Alpha8Astc5x5:
+            return {5, 5, 16};
+        case TextureFormat::CompressedRGBAAstc6x5:
+        case TextureFormat::CompressedSRGB8Alpha8Astc6x5:
+            return {6, 5, 16};
+        case TextureFormat::CompressedRGBAAstc6x6:
+        case TextureFormat::CompressedSRGB8Alpha8Astc6x6:
+            return {6, 6, 16};
+        case TextureFormat::CompressedRGBAAstc8x5:
+        case TextureFormat::CompressedSRGB8Alpha8Astc8x5:
+            return {8, 5, 16};
+        case TextureFormat::CompressedRGBAAstc8x6:
+        case TextureFormat::CompressedSRGB8Alpha8Astc8x6:
+            return {8, 6, 16};
+        case TextureFormat::CompressedRGBAAstc8x8:
+        case TextureFormat::CompressedSRGB8Alpha8Astc8x8:
+            return {8, 8, 16};
+        case TextureFormat::CompressedRGBAAstc10x5:
+        case TextureFormat::CompressedSRGB8Alpha8Astc10x5:
+            return {10, 5, 16};
+        case TextureFormat::CompressedRGBAAstc10x6:
+        case TextureFormat::CompressedSRGB8Alpha8Astc10x6:
+            return {10, 6, 16};
+        case TextureFormat::CompressedRGBAAstc10x8:
+        case TextureFormat::CompressedSRGB8Alpha8Astc10x8:
+            return {10, 8, 16};
+        case TextureFormat::CompressedRGBAAstc10x10:
+        case TextureFormat::CompressedSRGB8Alpha8Astc10x10:
+            return {10, 10, 16};
+        case TextureFormat::CompressedRGBAAstc12x10:
+        case TextureFormat::CompressedSRGB8Alpha8Astc12x10:
+            return {12, 10, 16};
+        case TextureFormat::CompressedRGBAAstc12x12:
+        case TextureFormat::CompressedSRGB8Alpha8Astc12x12:
+            return {12, 12, 16};
+        #endif
+
+        /* Everything else is either four bytes per pixel or gets padded to
+           that by most drivers */
+        default: return {1, 1, 4};
+    }
+}
+
+}
+
+std::size_t textureFormatDataSize(const TextureFormat format, const Vector3i& size) {
+    const FormatBlock block = textureFormatBlock(format);
+    return std::size_t((size.x() + block.width - 1)/block.width)*
+        std::size_t((size.y() + block.height - 1)/block.height)*
+        std::size_t(size.z())*block.size;
+}
+
+std::size_t renderbufferFormatDataSize(const RenderbufferFormat format, const Vector2i& size) {
+    std::size_t pixelSize;
+    switch(format) {
+        #ifndef MAGNUM_TARGET_GLES
+        case RenderbufferFormat::Red:
+        case RenderbufferFormat::StencilIndex:
+        #endif
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        case RenderbufferFormat::R8:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case RenderbufferFormat::R8UI:
+        case RenderbufferFormat::R8I:
+        #endif
+        #ifndef MAGNUM_TARGET_WEBGL
+        case RenderbufferFormat::StencilIndex1:
+        case RenderbufferFormat::StencilIndex4:
+        #endif
+        case RenderbufferFormat::StencilIndex8:
+            pixelSize = 1;
+            break;
+
+        #ifndef MAGNUM_TARGET_GLES
+        case RenderbufferFormat::RG:
+        case RenderbufferFormat::R16:
+        case RenderbufferFormat::StencilIndex16:
+        #endif
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        case RenderbufferFormat::RG8:
+        case RenderbufferFormat::R16F:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case RenderbufferFormat::RG8UI:
+        case RenderbufferFormat::RG8I:
+        case RenderbufferFormat::R16UI:
+        case RenderbufferFormat::R16I:
+        #endif
+        case RenderbufferFormat::RGB5A1:
+        case RenderbufferFormat::RGBA4:
+        case RenderbufferFormat::RGB565:
+        case RenderbufferFormat::DepthComponent16:
+            pixelSize = 2;
+            break;
+
+        #ifndef MAGNUM_TARGET_GLES
+        case RenderbufferFormat::RGB16:
+        case RenderbufferFormat::RGBA16:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case RenderbufferFormat::RGBA16UI:
+        case RenderbufferFormat::RGBA16I:
+        case RenderbufferFormat::RG32UI:
+        case RenderbufferFormat::RG32I:
+        case RenderbufferFormat::RG32F:
+        case RenderbufferFormat::Depth32FStencil8:
+        #endif
+        case RenderbufferFormat::RGBA16F:
+            pixelSize = 8;
+            break;
+
+        #ifndef MAGNUM_TARGET_GLES2
+        case RenderbufferFormat::RGBA32UI:
+        case RenderbufferFormat::RGBA32I:
+        #endif
+        #if !defined(MAGNUM_TARGET_GLES2) || defined(MAGNUM_TARGET_WEBGL)
+        case RenderbufferFormat::RGBA32F:
+        #endif
+            pixelSize = 16;
+            break;
+
+        /* Everything else is either four bytes per pixel or gets padded to
+           that by most drivers */
+        default: pixelSize = 4;
+    }
+
+    return std::size_t(size.product())*pixelSize;
+}
+
+std::size_t textureStorageDataSize(const GLenum target, const GLsizei levels, const TextureFormat format, const Vector3i& size) {
+    /* Array layers don't get smaller with increasing level */
+    Vector3i mipmapped{1, 1, 1};
+    switch(target) {
+        #ifndef MAGNUM_TARGET_GLES
+        case GL_TEXTURE_1D_ARRAY:
+            mipmapped = {1, 0, 0};
+            break;
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case GL_TEXTURE_2D_ARRAY:
+        #ifndef MAGNUM_TARGET_WEBGL
+        case GL_TEXTURE_CUBE_MAP_ARRAY:
+        #endif
+            mipmapped = {1, 1, 0};
+            break;
+        #endif
+        default: break;
+    }
+
+    std::size_t dataSize = 0;
+    for(GLsizei level = 0; level != levels; ++level) {
+        const Vector3i levelSize = Math::max(size*(Vector3i{1} - mipmapped) + (size*mipmapped >> level), Vector3i{1});
+        dataSize += textureFormatDataSize(format, levelSize);
+    }
+
+    /* Storage of cube maps allocates all six faces at once */
+    if(target == GL_TEXTURE_CUBE_MAP) dataSize *= 6;
+
+    return dataSize;
+}
+
+}}}
@@ -0,0 +1,51 @@
+#ifndef Magnum_GL_Implementation_formatDataSize_h
+#define Magnum_GL_Implementation_formatDataSize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/GL/GL.h"
+#include "Magnum/GL/OpenGL.h"
+
+namespace Magnum { namespace GL { namespace Implementation {
+
+/* Estimated GPU memory size of an image in given format. The driver-side
+   padding and alignment isn't known, so three-component 8- and 16-bit
+   formats are counted as if padded to four components, unsized and unknown
+   formats as four bytes per pixel and generic compressed formats as 4x4
+   blocks of 16 bytes. Compressed formats are counted in whole blocks. */
+std::size_t textureFormatDataSize(TextureFormat format, const Vector3i& size);
+std::size_t renderbufferFormatDataSize(RenderbufferFormat format, const Vector2i& size);
+
+/* Estimated size of immutable storage of given target with all levels,
+   halving only the dimensions that get mipmapped for given target and
+   counting all six faces of cube maps */
+std::size_t textureStorageDataSize(GLenum target, GLsizei levels, TextureFormat format, const Vector3i& size);
+
+}}}
+
+#endif
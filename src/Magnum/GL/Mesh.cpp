@@ -28,11 +28,16 @@
 #include <vector>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Instrumentation.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/AbstractTexture.h"
 #include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/GL/MeshLayout.h"
+#endif
 #ifndef MAGNUM_TARGET_GLES
 #include "Magnum/GL/TransformFeedback.h"
 #endif
@@ -211,6 +216,14 @@ Mesh::Mesh(const MeshPrimitive primitive): _primitive{primitive}, _flags{ObjectF
     (this->*Context::current().state().mesh->createImplementation)(true);
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+Mesh::Mesh(MeshLayout& layout, const MeshPrimitive primitive): _id{0}, _primitive{primitive}, _flags{ObjectFlag::DeleteOnDestruction}, _layout{&layout} {
+    /* There's no own VAO to create, only the (always empty) attribute storage
+       so the rest of the implementation doesn't need to special-case it */
+    (this->*Context::current().state().mesh->createImplementation)(false);
+}
+#endif
+
 Mesh::Mesh(NoCreateT) noexcept: _id{0}, _primitive{MeshPrimitive::Triangles}, _flags{ObjectFlag::DeleteOnDestruction} {}
 
 Mesh::~Mesh() {
@@ -234,6 +247,9 @@ Mesh::Mesh(Mesh&& other) noexcept: _id(other._id), _primitive(other._primitive),
     _indexStart(other._indexStart), _indexEnd(other._indexEnd),
     #endif
     _indexOffset(other._indexOffset), _indexType(other._indexType), _indexBuffer{std::move(other._indexBuffer)}
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _layout{other._layout}, _layoutVertexBuffers{std::move(other._layoutVertexBuffers)}
+    #endif
 {
     if(_constructed || other._constructed)
         (this->*Context::current().state().mesh->moveConstructImplementation)(std::move(other));
@@ -259,6 +275,10 @@ Mesh& Mesh::operator=(Mesh&& other) noexcept {
     swap(_indexOffset, other._indexOffset);
     swap(_indexType, other._indexType);
     swap(_indexBuffer, other._indexBuffer);
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    swap(_layout, other._layout);
+    swap(_layoutVertexBuffers, other._layoutVertexBuffers);
+    #endif
 
     if(_constructed || other._constructed)
         (this->*Context::current().state().mesh->moveAssignImplementation)(std::move(other));
@@ -350,7 +370,14 @@ Mesh& Mesh::setIndexBuffer(Buffer&& buffer, GLintptr offset, MeshIndexType type,
     static_cast<void>(start);
     static_cast<void>(end);
     #endif
-    (this->*Context::current().state().mesh->bindIndexBufferImplementation)(_indexBuffer);
+
+    /* Meshes with a shared layout attach the index buffer only when drawn */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(!_layout)
+    #endif
+    {
+        (this->*Context::current().state().mesh->bindIndexBufferImplementation)(_indexBuffer);
+    }
     return *this;
 }
 
@@ -359,7 +386,29 @@ Mesh& Mesh::setIndexBuffer(Buffer& buffer, const GLintptr offset, const MeshInde
     return *this;
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+Mesh& Mesh::setVertexBuffer(const UnsignedInt binding, Buffer&& buffer, const GLintptr offset) {
+    CORRADE_ASSERT(_layout,
+        "GL::Mesh::setVertexBuffer(): the mesh wasn't created from a layout", *this);
+    CORRADE_ASSERT(_layout->hasBinding(binding),
+        "GL::Mesh::setVertexBuffer(): binding" << binding << "not present in the layout", *this);
+    CORRADE_ASSERT(buffer.id(),
+        "GL::Mesh::setVertexBuffer(): empty or moved-out Buffer instance was passed", *this);
+
+    if(_layoutVertexBuffers.size() <= binding)
+        _layoutVertexBuffers.resize(binding + 1);
+    _layoutVertexBuffers[binding].buffer = std::move(buffer);
+    _layoutVertexBuffers[binding].offset = offset;
+    return *this;
+}
+
+Mesh& Mesh::setVertexBuffer(const UnsignedInt binding, Buffer& buffer, const GLintptr offset) {
+    return setVertexBuffer(binding, Buffer::wrap(buffer.id(), buffer.targetHint()), offset);
+}
+#endif
+
 Mesh& Mesh::draw(AbstractShaderProgram& shader) {
+    MAGNUM_INSTRUMENTATION_SCOPE("GL::Mesh::draw()");
     CORRADE_ASSERT(_countSet, "GL::Mesh::draw(): setCount() was never called, probably a mistake?", *this);
 
     /* Nothing to draw, exit without touching any state */
@@ -386,9 +435,13 @@ void Mesh::drawInternal(Int count, Int baseVertex, Int instanceCount, GLintptr i
 void Mesh::drawInternal(Int count, Int baseVertex, Int instanceCount, GLintptr indexOffset)
 #endif
 {
-    const Implementation::MeshState& state = *Context::current().state().mesh;
+    Context& context = Context::current();
+    const Implementation::MeshState& state = *context.state().mesh;
+    ++context.statisticsInternal().drawCount;
+
+    AbstractTexture::flushDeferredBindings();
 
-    (this->*state.bindImplementation)();
+    bindInternal();
 
     /* Non-instanced mesh */
     if(instanceCount == 1) {
@@ -493,9 +546,13 @@ void Mesh::drawInternal(Int count, Int baseVertex, Int instanceCount, GLintptr i
 
 #ifndef MAGNUM_TARGET_GLES
 void Mesh::drawInternal(TransformFeedback& xfb, const UnsignedInt stream, const Int instanceCount) {
-    const Implementation::MeshState& state = *Context::current().state().mesh;
+    Context& context = Context::current();
+    const Implementation::MeshState& state = *context.state().mesh;
+    ++context.statisticsInternal().drawCount;
+
+    AbstractTexture::flushDeferredBindings();
 
-    (this->*state.bindImplementation)();
+    bindInternal();
 
     /* Default stream */
     if(stream == 0) {
@@ -525,9 +582,34 @@ Mesh& Mesh::draw(AbstractShaderProgram& shader, TransformFeedback& xfb, Unsigned
     drawInternal(xfb, stream, _instanceCount);
     return *this;
 }
-#endif
 
-void Mesh::bindVAOImplementationDefault(GLuint) {}
+Mesh& Mesh::drawIndirect(AbstractShaderProgram& shader, Buffer& buffer, const GLintptr offset, const UnsignedInt drawCount, const UnsignedInt stride) {
+    /* Nothing to draw, exit without touching any state */
+    if(!drawCount) return *this;
+
+    shader.use();
+
+    Context& context = Context::current();
+    const Implementation::MeshState& state = *context.state().mesh;
+    ++context.statisticsInternal().drawCount;
+
+    AbstractTexture::flushDeferredBindings();
+
+    bindInternal();
+    buffer.bindInternal(Buffer::TargetHint::DrawIndirect);
+
+    /* Non-indexed mesh */
+    if(!_indexBuffer.id())
+        glMultiDrawArraysIndirect(GLenum(_primitive), reinterpret_cast<GLvoid*>(offset), drawCount, stride);
+
+    /* Indexed mesh */
+    else
+        glMultiDrawElementsIndirect(GLenum(_primitive), GLenum(_indexType), reinterpret_cast<GLvoid*>(offset), drawCount, stride);
+
+    (this->*state.unbindImplementation)();
+    return *this;
+}
+#endif
 
 void Mesh::bindVAOImplementationVAO(const GLuint id) {
     #ifndef MAGNUM_TARGET_GLES2
@@ -539,12 +621,14 @@ void Mesh::bindVAOImplementationVAO(const GLuint id) {
 }
 
 void Mesh::bindVAO() {
-    GLuint& current = Context::current().state().mesh->currentVAO;
+    Context& context = Context::current();
+    GLuint& current = context.state().mesh->currentVAO;
     if(current != _id) {
         /* Binding the VAO finally creates it */
         _flags |= ObjectFlag::Created;
+        ++context.statisticsInternal().bindCount;
         bindVAOImplementationVAO(_id);
-    }
+    } else ++context.statisticsInternal().elidedBindCount;
 }
 
 void Mesh::createImplementationDefault(bool) {
@@ -652,6 +736,10 @@ void Mesh::attributePointerInternal(const Buffer& buffer, const GLuint location,
 void Mesh::attributePointerInternal(AttributeLayout&& attribute) {
     CORRADE_ASSERT(attribute.buffer.id(),
         "GL::Mesh::addVertexBuffer(): empty or moved-out Buffer instance was passed", );
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    CORRADE_ASSERT(!_layout,
+        "GL::Mesh::addVertexBuffer(): can't be used on a mesh created from a layout, use setVertexBuffer() instead", );
+    #endif
     (this->*Context::current().state().mesh->attributePointerImplementation)(std::move(attribute));
 }
 
@@ -723,6 +811,77 @@ void Mesh::vertexAttribPointer(AttributeLayout& attribute) {
     }
 }
 
+void Mesh::vertexAttribPointerCached(AttributeLayout& attribute) {
+    Context& context = Context::current();
+    Implementation::MeshState& state = *context.state().mesh;
+    if(attribute.location >= state.vertexAttributes.size())
+        state.vertexAttributes.resize(attribute.location + 1);
+    Implementation::MeshState::VertexAttribute& current = state.vertexAttributes[attribute.location];
+    current.generation = state.vertexAttributeGeneration;
+
+    /* Everything is the same as in the previous draw, nothing to do */
+    if(current.enabled &&
+       current.buffer == attribute.buffer.id() &&
+       current.size == attribute.size &&
+       current.type == attribute.type &&
+       current.kind == attribute.kind &&
+       current.offset == attribute.offset &&
+       current.stride == attribute.stride &&
+       current.divisor == attribute.divisor)
+    {
+        ++context.statisticsInternal().elidedBindCount;
+        return;
+    }
+
+    ++context.statisticsInternal().bindCount;
+
+    if(!current.enabled) {
+        glEnableVertexAttribArray(attribute.location);
+        current.enabled = true;
+    }
+
+    /* The divisor is set only if different, handling also the reset back to
+       zero after an instanced draw */
+    if(current.divisor != attribute.divisor) {
+        #ifndef MAGNUM_TARGET_GLES2
+        glVertexAttribDivisor(attribute.location, attribute.divisor);
+        #else
+        (this->*state.vertexAttribDivisorImplementation)(attribute.location, attribute.divisor);
+        #endif
+        current.divisor = attribute.divisor;
+    }
+
+    if(current.buffer != attribute.buffer.id() ||
+       current.size != attribute.size ||
+       current.type != attribute.type ||
+       current.kind != attribute.kind ||
+       current.offset != attribute.offset ||
+       current.stride != attribute.stride)
+    {
+        attribute.buffer.bindInternal(Buffer::TargetHint::Array);
+
+        #ifndef MAGNUM_TARGET_GLES2
+        if(attribute.kind == DynamicAttribute::Kind::Integral)
+            glVertexAttribIPointer(attribute.location, attribute.size, attribute.type, attribute.stride, reinterpret_cast<const GLvoid*>(attribute.offset));
+        #ifndef MAGNUM_TARGET_GLES
+        else if(attribute.kind == DynamicAttribute::Kind::Long)
+            glVertexAttribLPointer(attribute.location, attribute.size, attribute.type, attribute.stride, reinterpret_cast<const GLvoid*>(attribute.offset));
+        #endif
+        else
+        #endif
+        {
+            glVertexAttribPointer(attribute.location, attribute.size, attribute.type, attribute.kind == DynamicAttribute::Kind::GenericNormalized, attribute.stride, reinterpret_cast<const GLvoid*>(attribute.offset));
+        }
+
+        current.buffer = attribute.buffer.id();
+        current.size = attribute.size;
+        current.type = attribute.type;
+        current.kind = attribute.kind;
+        current.offset = attribute.offset;
+        current.stride = attribute.stride;
+    }
+}
+
 #ifndef MAGNUM_TARGET_GLES
 void Mesh::vertexAttribDivisorImplementationVAO(const GLuint index, const GLuint divisor) {
     bindVAO();
@@ -776,10 +935,82 @@ void Mesh::bindIndexBufferImplementationVAO(Buffer& buffer) {
     buffer.bindInternal(Buffer::TargetHint::ElementArray);
 }
 
+void Mesh::bindInternal() {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_layout) {
+        bindLayout();
+        return;
+    }
+    #endif
+
+    (this->*Context::current().state().mesh->bindImplementation)();
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void Mesh::bindLayout() {
+    Context& context = Context::current();
+    const Implementation::MeshState& state = *context.state().mesh;
+    MeshLayout& layout = *_layout;
+
+    layout.bindVAO();
+
+    /* Forget the buffers attached last time if any of them could have been
+       deleted since */
+    if(layout._bindingGeneration != state.layoutBindingGeneration) {
+        for(MeshLayout::Binding& binding: layout._bindings)
+            binding.boundBuffer = 0;
+        layout._boundIndexBuffer = 0;
+        layout._bindingGeneration = state.layoutBindingGeneration;
+    }
+
+    /* Attach only buffers that differ from the previously drawn mesh */
+    for(std::size_t i = 0; i != _layoutVertexBuffers.size(); ++i) {
+        const LayoutVertexBuffer& vertexBuffer = _layoutVertexBuffers[i];
+        if(!vertexBuffer.buffer.id()) continue;
+
+        MeshLayout::Binding& binding = layout._bindings[i];
+        if(binding.boundBuffer == vertexBuffer.buffer.id() && binding.boundOffset == vertexBuffer.offset) {
+            ++context.statisticsInternal().elidedBindCount;
+            continue;
+        }
+
+        ++context.statisticsInternal().bindCount;
+        glBindVertexBuffer(i, vertexBuffer.buffer.id(), vertexBuffer.offset, binding.stride);
+        binding.boundBuffer = vertexBuffer.buffer.id();
+        binding.boundOffset = vertexBuffer.offset;
+    }
+
+    /* Index buffer binding is a VAO state as well. Non-indexed meshes don't
+       care about whatever is attached there. */
+    if(_indexBuffer.id() && layout._boundIndexBuffer != _indexBuffer.id()) {
+        /* Reset ElementArray binding to force explicit glBindBuffer call, the
+           tracked value corresponds to some other VAO */
+        context.state().buffer->bindings[Implementation::BufferState::indexForTarget(Buffer::TargetHint::ElementArray)] = 0;
+
+        _indexBuffer.bindInternal(Buffer::TargetHint::ElementArray);
+        layout._boundIndexBuffer = _indexBuffer.id();
+    }
+}
+#endif
+
 void Mesh::bindImplementationDefault() {
-    /* Specify vertex attributes */
+    Implementation::MeshState& state = *Context::current().state().mesh;
+    ++state.vertexAttributeGeneration;
+
+    /* Specify vertex attributes, skipping those that are already set up the
+       same way from the previous draw */
     for(AttributeLayout& attribute: *reinterpret_cast<std::vector<AttributeLayout>*>(&_attributes))
-        vertexAttribPointer(attribute);
+        vertexAttribPointerCached(attribute);
+
+    /* Disable attributes left enabled by previous draws that this mesh
+       doesn't use */
+    for(std::size_t i = 0; i != state.vertexAttributes.size(); ++i) {
+        Implementation::MeshState::VertexAttribute& attribute = state.vertexAttributes[i];
+        if(!attribute.enabled || attribute.generation == state.vertexAttributeGeneration) continue;
+
+        glDisableVertexAttribArray(i);
+        attribute.enabled = false;
+    }
 
     /* Bind index buffer, if the mesh is indexed */
     if(_indexBuffer.id()) _indexBuffer.bindInternal(Buffer::TargetHint::ElementArray);
@@ -790,20 +1021,38 @@ void Mesh::bindImplementationVAO() {
 }
 
 void Mesh::unbindImplementationDefault() {
+    /* The attributes are kept enabled so the next draw can reuse them, the
+       ones not needed are disabled in bindImplementationDefault() and all of
+       them in bindVAOImplementationDefault(). Only reset the divisors back so
+       they don't affect anything drawn later, that's rare enough to not be
+       worth caching. */
+    Implementation::MeshState& state = *Context::current().state().mesh;
     for(const AttributeLayout& attribute: *reinterpret_cast<std::vector<AttributeLayout>*>(&_attributes)) {
-        glDisableVertexAttribArray(attribute.location);
+        if(!attribute.divisor) continue;
 
-        /* Reset also the divisor back so it doesn't affect  */
-        if(attribute.divisor) {
-            #ifndef MAGNUM_TARGET_GLES2
-            glVertexAttribDivisor(attribute.location, 0);
-            #else
-            (this->*Context::current().state().mesh->vertexAttribDivisorImplementation)(attribute.location, 0);
-            #endif
-        }
+        #ifndef MAGNUM_TARGET_GLES2
+        glVertexAttribDivisor(attribute.location, 0);
+        #else
+        (this->*state.vertexAttribDivisorImplementation)(attribute.location, 0);
+        #endif
+        state.vertexAttributes[attribute.location].divisor = 0;
     }
 }
 
+void Mesh::bindVAOImplementationDefault(GLuint) {
+    /* There are no VAOs to unbind, but make sure the cached enabled
+       attributes don't leak into external code */
+    Implementation::MeshState& state = *Context::current().state().mesh;
+    for(std::size_t i = 0; i != state.vertexAttributes.size(); ++i) {
+        if(!state.vertexAttributes[i].enabled) continue;
+
+        glDisableVertexAttribArray(i);
+        state.vertexAttributes[i].enabled = false;
+    }
+
+    state.currentVAO = 0;
+}
+
 void Mesh::unbindImplementationVAO() {}
 
 #ifdef MAGNUM_TARGET_GLES2
@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::GL::Mesh, enum @ref Magnum::GL::MeshPrimitive, @ref Magnum::GL::MeshIndexType, function @ref Magnum::GL::meshPrimitive(), @ref Magnum::GL::meshIndexType()
  */
 
+#include <vector>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Utility/ConfigurationValue.h>
 
@@ -171,6 +172,43 @@ enum class MeshIndexType: GLenum {
 */
 MAGNUM_GL_EXPORT MeshIndexType meshIndexType(Magnum::MeshIndexType);
 
+#ifndef MAGNUM_TARGET_GLES
+/**
+@brief Indirect draw command for non-indexed meshes
+
+Layout matches the `DrawArraysIndirectCommand` structure expected by
+@fn_gl_keyword{MultiDrawArraysIndirect}. Fill a @ref Buffer with these and
+pass it to @ref Mesh::drawIndirect().
+@see @ref DrawElementsIndirectCommand
+@requires_gl43 Extension @gl_extension{ARB,multi_draw_indirect}
+@requires_gl Indirect drawing is not available in OpenGL ES or WebGL.
+*/
+struct DrawArraysIndirectCommand {
+    UnsignedInt count;          /**< Vertex count */
+    UnsignedInt instanceCount;  /**< Instance count */
+    UnsignedInt first;          /**< First vertex */
+    UnsignedInt baseInstance;   /**< Base instance */
+};
+
+/**
+@brief Indirect draw command for indexed meshes
+
+Layout matches the `DrawElementsIndirectCommand` structure expected by
+@fn_gl_keyword{MultiDrawElementsIndirect}. Fill a @ref Buffer with these and
+pass it to @ref Mesh::drawIndirect().
+@see @ref DrawArraysIndirectCommand
+@requires_gl43 Extension @gl_extension{ARB,multi_draw_indirect}
+@requires_gl Indirect drawing is not available in OpenGL ES or WebGL.
+*/
+struct DrawElementsIndirectCommand {
+    UnsignedInt count;          /**< Index count */
+    UnsignedInt instanceCount;  /**< Instance count */
+    UnsignedInt firstIndex;     /**< First index in the index buffer */
+    Int baseVertex;             /**< Base vertex */
+    UnsignedInt baseInstance;   /**< Base instance */
+};
+#endif
+
 namespace Implementation { struct MeshState; }
 
 /**
@@ -280,6 +318,14 @@ and @fn_gl_keyword{UseProgram}. Mesh limits and implementation-defined values
 (such as @ref maxElementIndex()) are cached, so repeated queries don't result
 in repeated @fn_gl{Get} calls.
 
+If VAOs are not available, the engine keeps a shadow copy of the vertex
+attribute state and leaves the attributes enabled after each draw. Consecutive
+draws of meshes sharing the same buffers and attribute layouts then skip the
+@fn_gl{EnableVertexAttribArray}, @fn_gl{BindBuffer} and
+@fn_gl{VertexAttribPointer} calls. Attributes not used by a mesh are disabled
+before it's drawn, and all of them with @ref Context::resetState() when
+entering a section with external OpenGL code.
+
 If @gl_extension{EXT,direct_state_access} desktop extension and VAOs are
 available, DSA functions are used for specifying attribute locations to avoid
 unnecessary calls to @fn_gl{BindBuffer} and @fn_gl{BindVertexArray}. See
@@ -288,9 +334,19 @@ documentation of @ref addVertexBuffer() for more information.
 If index range is specified in @ref setIndexBuffer(), range-based version of
 drawing commands are used on desktop OpenGL and OpenGL ES 3.0. See also
 @ref draw() for more information.
+
+If @gl_extension{ARB,vertex_attrib_binding} (part of OpenGL 4.3) or OpenGL ES
+3.1 is available, meshes with the same vertex format can share a single
+@ref MeshLayout instead of each having its own VAO. Drawing them then only
+switches the vertex and index buffers that differ from the previous draw via
+@fn_gl_keyword{BindVertexBuffer}, without rebinding the VAO or respecifying any
+vertex attributes.
  */
 class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
     friend MeshView;
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    friend MeshLayout;
+    #endif
     friend Implementation::MeshState;
 
     public:
@@ -402,6 +458,29 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
         /** @overload */
         explicit Mesh(Magnum::MeshPrimitive primitive): Mesh{meshPrimitive(primitive)} {}
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Construct a mesh using a shared layout
+         * @param layout        Mesh layout
+         * @param primitive     Primitive type
+         *
+         * No vertex array object is created, the one from @p layout is used
+         * for drawing instead and vertex buffers are supplied using
+         * @ref setVertexBuffer(). The @ref addVertexBuffer() family of
+         * functions can't be used on such mesh. The layout is expected to
+         * stay alive for the whole mesh lifetime.
+         * @see @ref GL-MeshLayout-usage
+         * @requires_gl43 Extension @gl_extension{ARB,vertex_attrib_binding}
+         * @requires_gles31 Vertex attribute binding is not available in
+         *      OpenGL ES 3.0 and older.
+         * @requires_gles Vertex attribute binding is not available in WebGL.
+         */
+        explicit Mesh(MeshLayout& layout, MeshPrimitive primitive = MeshPrimitive::Triangles);
+
+        /** @overload */
+        explicit Mesh(MeshLayout& layout, Magnum::MeshPrimitive primitive): Mesh{layout, meshPrimitive(primitive)} {}
+        #endif
+
         /**
          * @brief Construct without creating the underlying OpenGL object
          *
@@ -826,6 +905,51 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
             return *this;
         }
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Mesh layout
+         *
+         * Returns @cpp nullptr @ce if the mesh wasn't created from a
+         * @ref MeshLayout.
+         * @requires_gl43 Extension @gl_extension{ARB,vertex_attrib_binding}
+         * @requires_gles31 Vertex attribute binding is not available in
+         *      OpenGL ES 3.0 and older.
+         * @requires_gles Vertex attribute binding is not available in WebGL.
+         */
+        MeshLayout* layout() const { return _layout; }
+
+        /**
+         * @brief Set a vertex buffer for given layout binding
+         * @param binding   Binding index
+         * @param buffer    Buffer
+         * @param offset    Offset of the first vertex in the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the mesh was created from a @ref MeshLayout and
+         * @p binding is present in it. Stride is taken from the layout. The
+         * buffer is attached to the shared vertex array only when drawing and
+         * only if it differs from what was attached there for the previously
+         * drawn mesh. Calling this function again for the same binding
+         * replaces the previous buffer.
+         * @see @ref Mesh(MeshLayout&, MeshPrimitive),
+         *      @ref MeshLayout::hasBinding(), @fn_gl_keyword{BindVertexBuffer}
+         * @requires_gl43 Extension @gl_extension{ARB,vertex_attrib_binding}
+         * @requires_gles31 Vertex attribute binding is not available in
+         *      OpenGL ES 3.0 and older.
+         * @requires_gles Vertex attribute binding is not available in WebGL.
+         */
+        Mesh& setVertexBuffer(UnsignedInt binding, Buffer& buffer, GLintptr offset);
+
+        /**
+         * @brief Set a vertex buffer for given layout binding with ownership transfer
+         *
+         * Unlike @ref setVertexBuffer(UnsignedInt, Buffer&, GLintptr) this
+         * function takes ownership of @p buffer. See
+         * @ref GL-Mesh-buffer-ownership for more information.
+         */
+        Mesh& setVertexBuffer(UnsignedInt binding, Buffer&& buffer, GLintptr offset);
+        #endif
+
         /**
          * @brief Set index buffer
          * @param buffer        Index buffer
@@ -926,7 +1050,7 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
          * @see @ref setCount(), @ref setInstanceCount(),
          *      @ref draw(AbstractShaderProgram&, TransformFeedback&, UnsignedInt),
          *      @ref MeshView::draw(AbstractShaderProgram&),
-         *      @ref MeshView::draw(AbstractShaderProgram&, std::initializer_list<std::reference_wrapper<MeshView>>),
+         *      @ref MeshView::draw(AbstractShaderProgram&, Containers::ArrayView<const std::reference_wrapper<MeshView>>),
          *      @fn_gl_keyword{UseProgram}, @fn_gl_keyword{EnableVertexAttribArray},
          *      @fn_gl{BindBuffer}, @fn_gl_keyword{VertexAttribPointer},
          *      @fn_gl_keyword{DisableVertexAttribArray} or @fn_gl_keyword{BindVertexArray},
@@ -991,6 +1115,48 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
         Mesh& draw(AbstractShaderProgram&& shader, TransformFeedback& xfb, UnsignedInt stream = 0) {
             return draw(shader, xfb, stream);
         } /**< @overload */
+
+        /**
+         * @brief Draw the mesh with parameters coming from a buffer
+         * @param shader    Shader to use for drawing
+         * @param buffer    Buffer with draw commands
+         * @param offset    Offset of the first command in @p buffer
+         * @param drawCount Count of commands to execute
+         * @param stride    Stride between commands. If @cpp 0 @ce, the
+         *      commands are assumed to be tightly packed.
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the @p shader is compatible with this mesh and is
+         * fully set up. The @p buffer is expected to contain
+         * @ref DrawArraysIndirectCommand structures if the mesh is not
+         * indexed and @ref DrawElementsIndirectCommand structures otherwise.
+         * Everything set by @ref setCount(), @ref setInstanceCount(),
+         * @ref setBaseInstance() and @ref setBaseVertex() is ignored and
+         * taken from the commands instead. The offset passed to
+         * @ref setIndexBuffer() is ignored as well, the
+         * @ref DrawElementsIndirectCommand::firstIndex is counted from the
+         * start of the index buffer. If @p drawCount is @cpp 0 @ce, the
+         * function is a no-op. If @gl_extension{ARB,vertex_array_object}
+         * (part of OpenGL 3.0) is available, the associated vertex array
+         * object is bound instead of setting up the mesh from scratch.
+         *
+         * As the commands are sourced from GPU memory, they can be generated
+         * by a compute shader or streamed from the CPU every frame for
+         * example using @ref RingBuffer.
+         * @see @ref draw(AbstractShaderProgram&),
+         *      @ref MeshView::draw(AbstractShaderProgram&, Containers::ArrayView<const std::reference_wrapper<MeshView>>),
+         *      @fn_gl_keyword{UseProgram}, @fn_gl_keyword{EnableVertexAttribArray},
+         *      @fn_gl{BindBuffer}, @fn_gl_keyword{VertexAttribPointer},
+         *      @fn_gl_keyword{DisableVertexAttribArray} or @fn_gl_keyword{BindVertexArray},
+         *      @fn_gl_keyword{MultiDrawArraysIndirect}/@fn_gl_keyword{MultiDrawElementsIndirect}
+         * @requires_gl43 Extension @gl_extension{ARB,multi_draw_indirect}
+         * @requires_gl Indirect drawing is not available in OpenGL ES or
+         *      WebGL.
+         */
+        Mesh& drawIndirect(AbstractShaderProgram& shader, Buffer& buffer, GLintptr offset = 0, UnsignedInt drawCount = 1, UnsignedInt stride = 0);
+        Mesh& drawIndirect(AbstractShaderProgram&& shader, Buffer& buffer, GLintptr offset = 0, UnsignedInt drawCount = 1, UnsignedInt stride = 0) {
+            return drawIndirect(shader, buffer, offset, drawCount, stride);
+        } /**< @overload */
         #endif
 
     private:
@@ -1106,6 +1272,7 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
         void MAGNUM_GL_LOCAL attributePointerImplementationDSAEXT(AttributeLayout&& attribute);
         #endif
         void MAGNUM_GL_LOCAL vertexAttribPointer(AttributeLayout& attribute);
+        void MAGNUM_GL_LOCAL vertexAttribPointerCached(AttributeLayout& attribute);
 
         #ifndef MAGNUM_TARGET_GLES
         void MAGNUM_GL_LOCAL vertexAttribDivisorImplementationVAO(GLuint index, GLuint divisor);
@@ -1125,6 +1292,11 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
         void MAGNUM_GL_LOCAL bindIndexBufferImplementationDefault(Buffer&);
         void MAGNUM_GL_LOCAL bindIndexBufferImplementationVAO(Buffer& buffer);
 
+        /* Dispatches either to bindLayout() or to bindImplementation */
+        void MAGNUM_GL_LOCAL bindInternal();
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        void MAGNUM_GL_LOCAL bindLayout();
+        #endif
         void MAGNUM_GL_LOCAL bindImplementationDefault();
         void MAGNUM_GL_LOCAL bindImplementationVAO();
 
@@ -1170,6 +1342,17 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
            or std::vector<Buffer> (in case of VAOs). 4 pointers should be one
            pointer more than enough. */
         struct { std::intptr_t data[4]; } _attributes;
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /* Shared layout and vertex buffers for its bindings, indexed by the
+           binding index. Buffers not set for a binding have a zero ID. */
+        struct LayoutVertexBuffer {
+            Buffer buffer{NoCreate};
+            GLintptr offset{};
+        };
+        MeshLayout* _layout{};
+        std::vector<LayoutVertexBuffer> _layoutVertexBuffers;
+        #endif
 };
 
 /** @debugoperatorenum{MeshPrimitive} */
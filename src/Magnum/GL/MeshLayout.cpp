@@ -0,0 +1,140 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshLayout.h"
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/Implementation/MeshState.h"
+#include "Magnum/GL/Implementation/State.h"
+
+namespace Magnum { namespace GL {
+
+MeshLayout::MeshLayout(): _flags{ObjectFlag::DeleteOnDestruction} {
+    #ifndef MAGNUM_TARGET_GLES
+    /* Meshes using the fallback without VAOs would modify the layout VAO if
+       it's left bound, so require both */
+    CORRADE_ASSERT(Context::current().isExtensionSupported<Extensions::ARB::vertex_attrib_binding>() && Context::current().isExtensionSupported<Extensions::ARB::vertex_array_object>(),
+        "GL::MeshLayout:" << Extensions::ARB::vertex_attrib_binding::string() << "and" << Extensions::ARB::vertex_array_object::string() << "are required", );
+    #else
+    CORRADE_ASSERT(Context::current().isVersionSupported(Version::GLES310),
+        "GL::MeshLayout: OpenGL ES 3.1 is not supported", );
+    #endif
+
+    glGenVertexArrays(1, &_id);
+    CORRADE_INTERNAL_ASSERT(_id != Implementation::State::DisengagedBinding);
+}
+
+MeshLayout::MeshLayout(NoCreateT) noexcept: _id{0}, _flags{ObjectFlag::DeleteOnDestruction} {}
+
+MeshLayout::MeshLayout(MeshLayout&& other) noexcept: _id{other._id}, _flags{other._flags}, _boundIndexBuffer{other._boundIndexBuffer}, _bindingGeneration{other._bindingGeneration}, _bindings{std::move(other._bindings)} {
+    other._id = 0;
+}
+
+MeshLayout::~MeshLayout() {
+    /* Moved out or not deleting on destruction, nothing to do */
+    if(!_id || !(_flags & ObjectFlag::DeleteOnDestruction)) return;
+
+    /* Remove current vao from the state */
+    GLuint& current = Context::current().state().mesh->currentVAO;
+    if(current == _id) current = 0;
+
+    glDeleteVertexArrays(1, &_id);
+}
+
+MeshLayout& MeshLayout::operator=(MeshLayout&& other) noexcept {
+    using std::swap;
+    swap(_id, other._id);
+    swap(_flags, other._flags);
+    swap(_boundIndexBuffer, other._boundIndexBuffer);
+    swap(_bindingGeneration, other._bindingGeneration);
+    swap(_bindings, other._bindings);
+    return *this;
+}
+
+void MeshLayout::bindVAO() {
+    Context& context = Context::current();
+    GLuint& current = context.state().mesh->currentVAO;
+    if(current != _id) {
+        /* Binding the VAO finally creates it */
+        _flags |= ObjectFlag::Created;
+        ++context.statisticsInternal().bindCount;
+        Mesh::bindVAOImplementationVAO(_id);
+    } else ++context.statisticsInternal().elidedBindCount;
+}
+
+MeshLayout& MeshLayout::addBinding(const UnsignedInt binding, const GLsizei stride, const UnsignedInt divisor) {
+    CORRADE_ASSERT(!hasBinding(binding),
+        "GL::MeshLayout::addBinding(): binding" << binding << "already added", *this);
+
+    if(_bindings.size() <= binding) _bindings.resize(binding + 1);
+    _bindings[binding].stride = stride;
+    _bindings[binding].added = true;
+
+    if(divisor) {
+        bindVAO();
+        glVertexBindingDivisor(binding, divisor);
+    }
+
+    return *this;
+}
+
+GLsizei MeshLayout::bindingStride(const UnsignedInt binding) const {
+    CORRADE_ASSERT(hasBinding(binding),
+        "GL::MeshLayout::bindingStride(): binding" << binding << "not present in the layout", {});
+    return _bindings[binding].stride;
+}
+
+MeshLayout& MeshLayout::addAttribute(const UnsignedInt binding, const GLuint relativeOffset, const DynamicAttribute& attribute) {
+    attributeFormatInternal(binding,
+        attribute.location(),
+        GLint(attribute.components()),
+        GLenum(attribute.dataType()),
+        attribute.kind(),
+        relativeOffset);
+    return *this;
+}
+
+void MeshLayout::attributeFormatInternal(const UnsignedInt binding, const GLuint location, const GLint size, const GLenum type, const DynamicAttribute::Kind kind, const GLuint relativeOffset) {
+    CORRADE_ASSERT(hasBinding(binding),
+        "GL::MeshLayout::addAttribute(): binding" << binding << "not present in the layout", );
+
+    bindVAO();
+    glEnableVertexAttribArray(location);
+
+    if(kind == DynamicAttribute::Kind::Integral)
+        glVertexAttribIFormat(location, size, type, relativeOffset);
+    #ifndef MAGNUM_TARGET_GLES
+    else if(kind == DynamicAttribute::Kind::Long)
+        glVertexAttribLFormat(location, size, type, relativeOffset);
+    #endif
+    else
+        glVertexAttribFormat(location, size, type, kind == DynamicAttribute::Kind::GenericNormalized, relativeOffset);
+
+    glVertexAttribBinding(location, binding);
+}
+
+}}
@@ -0,0 +1,299 @@
+#ifndef Magnum_GL_MeshLayout_h
+#define Magnum_GL_MeshLayout_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::GL::MeshLayout
+ */
+#endif
+
+#include <vector>
+
+#include "Magnum/Tags.h"
+#include "Magnum/GL/AbstractObject.h"
+#include "Magnum/GL/Attribute.h"
+#include "Magnum/GL/GL.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace GL {
+
+/**
+@brief Mesh layout
+
+Vertex attribute formats together with their assignment to vertex buffer
+binding points, stored in a vertex array object that can be shared among any
+number of @ref Mesh instances with the same vertex format. Unlike
+@ref Mesh::addVertexBuffer(), which bakes the buffer, offset and format
+together, the layout contains only the format and each mesh then supplies just
+the buffers using @ref Mesh::setVertexBuffer(). Drawing a mesh binds the shared
+vertex array and switches only the vertex buffer bindings that differ from
+the mesh drawn last.
+
+@section GL-MeshLayout-usage Usage
+
+Similarly to @ref Mesh::addVertexBuffer(), each binding point is described by
+@ref Attribute "attribute definitions" and gaps between them, from which the
+relative attribute offsets and the binding stride are calculated:
+
+@code{.cpp}
+GL::MeshLayout layout;
+layout.addVertexBinding(0, Shaders::Phong::Position{}, Shaders::Phong::Normal{});
+
+GL::Buffer vertices;
+GL::Mesh mesh{layout};
+mesh.setVertexBuffer(0, vertices, 0)
+    .setCount(vertexCount);
+@endcode
+
+Alternatively, bindings and attributes can be added one by one using
+@ref addBinding() and @ref addAttribute(), for example when the format is
+known only at runtime.
+
+The layout has to stay alive for as long as any mesh referencing it. Mesh
+properties such as @ref Mesh::addVertexBuffer() or @ref Mesh::id() are not
+meaningful for meshes created from a layout, as they don't have their own
+vertex array object.
+
+@section GL-MeshLayout-performance-optimizations Performance optimizations
+
+The layout remembers the buffers attached to its binding points and to its
+index buffer binding, so drawing meshes that share the same buffers and
+differ only in index or vertex ranges results in just the draw calls. The
+remembered state is discarded when any @ref Buffer gets destroyed or when
+@ref Context::resetState() is called with @ref Context::State::Meshes. See
+also @ref Context::Statistics::bindCount.
+
+@requires_gl43 Extension @gl_extension{ARB,vertex_attrib_binding}
+@requires_gles31 Vertex attribute binding is not available in OpenGL ES 3.0
+    and older.
+@requires_gles Vertex attribute binding is not available in WebGL.
+*/
+class MAGNUM_GL_EXPORT MeshLayout: public AbstractObject {
+    friend Mesh;
+
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Creates new OpenGL vertex array object.
+         * @see @ref MeshLayout(NoCreateT), @fn_gl_keyword{GenVertexArrays}
+         */
+        explicit MeshLayout();
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         * @see @ref MeshLayout()
+         */
+        explicit MeshLayout(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        MeshLayout(const MeshLayout&) = delete;
+
+        /** @brief Move constructor */
+        MeshLayout(MeshLayout&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes associated OpenGL vertex array object.
+         * @see @fn_gl_keyword{DeleteVertexArrays}
+         */
+        ~MeshLayout();
+
+        /** @brief Copying is not allowed */
+        MeshLayout& operator=(const MeshLayout&) = delete;
+
+        /** @brief Move assignment */
+        MeshLayout& operator=(MeshLayout&& other) noexcept;
+
+        /** @brief OpenGL vertex array ID */
+        GLuint id() const { return _id; }
+
+        /**
+         * @brief Add a vertex buffer binding
+         * @param binding   Binding index
+         * @param stride    Distance between consecutive vertices or
+         *      instances in bytes
+         * @param divisor   Instance divisor. Use @cpp 0 @ce for per-vertex
+         *      data.
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the binding wasn't added yet.
+         * @see @fn_gl_keyword{BindVertexArray},
+         *      @fn_gl_keyword{VertexBindingDivisor}
+         */
+        MeshLayout& addBinding(UnsignedInt binding, GLsizei stride, UnsignedInt divisor = 0);
+
+        /**
+         * @brief Add a vertex attribute
+         * @param binding       Binding the attribute is sourced from
+         * @param relativeOffset Offset of the attribute relative to the start
+         *      of a vertex
+         * @param attribute     Attribute
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p binding was added already.
+         * @see @fn_gl_keyword{BindVertexArray},
+         *      @fn_gl_keyword{EnableVertexAttribArray},
+         *      @fn_gl_keyword{VertexAttribFormat},
+         *      @fn_gl_keyword{VertexAttribBinding}
+         */
+        MeshLayout& addAttribute(UnsignedInt binding, GLuint relativeOffset, const DynamicAttribute& attribute);
+
+        /**
+         * @brief Add a binding with (interleaved) vertex attributes
+         * @return Reference to self (for method chaining)
+         *
+         * The attribute list is combination of
+         * @ref Attribute "attribute definitions" and gaps between them, in
+         * the same way as in @ref Mesh::addVertexBuffer(). The binding stride
+         * is calculated from the attribute sizes and gaps.
+         * @see @ref addVertexBindingInstanced(), @ref addBinding(),
+         *      @ref addAttribute()
+         */
+        template<class ...T> MeshLayout& addVertexBinding(UnsignedInt binding, const T&... attributes) {
+            return addVertexBindingInstanced(binding, 0, attributes...);
+        }
+
+        /**
+         * @brief Add an instanced binding with (interleaved) vertex attributes
+         * @return Reference to self (for method chaining)
+         *
+         * Similar to the above function, the @p divisor parameter specifies
+         * number of instances that will pass until new data are fetched from
+         * the buffer. Setting it to @cpp 0 @ce is equivalent to calling
+         * @ref addVertexBinding().
+         */
+        template<class ...T> MeshLayout& addVertexBindingInstanced(UnsignedInt binding, UnsignedInt divisor, const T&... attributes) {
+            addBinding(binding, strideOfInterleaved(attributes...), divisor);
+            addVertexBindingInternal(binding, 0, attributes...);
+            return *this;
+        }
+
+        /**
+         * @brief Whether the layout has given binding
+         *
+         * @see @ref addBinding()
+         */
+        bool hasBinding(UnsignedInt binding) const {
+            return binding < _bindings.size() && _bindings[binding].added;
+        }
+
+        /**
+         * @brief Binding stride
+         *
+         * Expects that the binding is present in the layout.
+         * @see @ref hasBinding()
+         */
+        GLsizei bindingStride(UnsignedInt binding) const;
+
+    private:
+        struct Binding {
+            GLsizei stride{};
+            bool added{};
+            /* Buffer and offset currently attached to the binding point */
+            GLuint boundBuffer{};
+            GLintptr boundOffset{};
+        };
+
+        /* Computing stride of interleaved vertex attributes */
+        template<UnsignedInt location, class T, class ...U> static GLsizei strideOfInterleaved(const Attribute<location, T>& attribute, const U&... attributes) {
+            return attribute.vectorSize()*Attribute<location, T>::VectorCount + strideOfInterleaved(attributes...);
+        }
+        template<class ...T> static GLsizei strideOfInterleaved(GLintptr gap, const T&... attributes) {
+            return gap + strideOfInterleaved(attributes...);
+        }
+        static GLsizei strideOfInterleaved() { return 0; }
+
+        /* Adding interleaved vertex attributes */
+        template<UnsignedInt location, class T, class ...U> void addVertexBindingInternal(UnsignedInt binding, GLuint relativeOffset, const Attribute<location, T>& attribute, const U&... attributes) {
+            addVertexAttribute(binding, attribute, relativeOffset);
+
+            /* Add size of this attribute to offset for next attribute */
+            addVertexBindingInternal(binding, relativeOffset + attribute.vectorSize()*Attribute<location, T>::VectorCount, attributes...);
+        }
+        template<class ...T> void addVertexBindingInternal(UnsignedInt binding, GLuint relativeOffset, GLintptr gap, const T&... attributes) {
+            /* Add the gap to offset for next attribute */
+            addVertexBindingInternal(binding, relativeOffset + gap, attributes...);
+        }
+        void addVertexBindingInternal(UnsignedInt, GLuint) {}
+
+        template<UnsignedInt location, class T> void addVertexAttribute(UnsignedInt binding, const Attribute<location, T>& attribute, typename std::enable_if<std::is_same<typename Implementation::Attribute<T>::ScalarType, Float>::value, GLuint>::type relativeOffset) {
+            for(UnsignedInt i = 0; i != Attribute<location, T>::VectorCount; ++i)
+                attributeFormatInternal(binding,
+                    location+i,
+                    GLint(attribute.components()),
+                    GLenum(attribute.dataType()),
+                    attribute.dataOptions() & Attribute<location, T>::DataOption::Normalized ? DynamicAttribute::Kind::GenericNormalized : DynamicAttribute::Kind::Generic,
+                    relativeOffset + i*attribute.vectorSize());
+        }
+
+        template<UnsignedInt location, class T> void addVertexAttribute(UnsignedInt binding, const Attribute<location, T>& attribute, typename std::enable_if<std::is_integral<typename Implementation::Attribute<T>::ScalarType>::value, GLuint>::type relativeOffset) {
+            attributeFormatInternal(binding,
+                location,
+                GLint(attribute.components()),
+                GLenum(attribute.dataType()),
+                DynamicAttribute::Kind::Integral,
+                relativeOffset);
+        }
+
+        #ifndef MAGNUM_TARGET_GLES
+        template<UnsignedInt location, class T> void addVertexAttribute(UnsignedInt binding, const Attribute<location, T>& attribute, typename std::enable_if<std::is_same<typename Implementation::Attribute<T>::ScalarType, Double>::value, GLuint>::type relativeOffset) {
+            for(UnsignedInt i = 0; i != Attribute<location, T>::VectorCount; ++i)
+                attributeFormatInternal(binding,
+                    location+i,
+                    GLint(attribute.components()),
+                    GLenum(attribute.dataType()),
+                    DynamicAttribute::Kind::Long,
+                    relativeOffset + i*attribute.vectorSize());
+        }
+        #endif
+
+        void attributeFormatInternal(UnsignedInt binding, GLuint location, GLint size, GLenum type, DynamicAttribute::Kind kind, GLuint relativeOffset);
+
+        void MAGNUM_GL_LOCAL bindVAO();
+
+        GLuint _id;
+        ObjectFlags _flags;
+        /* Index buffer currently attached to the vertex array */
+        GLuint _boundIndexBuffer{};
+        /* Value of MeshState::layoutBindingGeneration at which the bound
+           buffers above and in _bindings were last known to be valid */
+        UnsignedInt _bindingGeneration{};
+        std::vector<Binding> _bindings;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
@@ -29,6 +29,7 @@
 #include <Corrade/Utility/Assert.h>
 
 #include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/AbstractTexture.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Mesh.h"
 #include "Magnum/GL/Implementation/State.h"
@@ -36,14 +37,13 @@
 
 namespace Magnum { namespace GL {
 
-void MeshView::draw(AbstractShaderProgram& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
-    /* Why std::initializer_list doesn't have empty()? */
-    if(!meshes.size()) return;
+void MeshView::draw(AbstractShaderProgram& shader, Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes) {
+    if(meshes.empty()) return;
 
     shader.use();
 
     #ifndef CORRADE_NO_ASSERT
-    const Mesh* original = &meshes.begin()->get()._original.get();
+    const Mesh* original = &meshes[0].get()._original.get();
     for(MeshView& mesh: meshes)
         CORRADE_ASSERT(&mesh._original.get() == original, "GL::MeshView::draw(): all meshes must be views of the same original mesh", );
     #endif
@@ -56,12 +56,16 @@ void MeshView::draw(AbstractShaderProgram& shader, std::initializer_list<std::re
 }
 
 #ifndef MAGNUM_TARGET_WEBGL
-void MeshView::multiDrawImplementationDefault(std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+void MeshView::multiDrawImplementationDefault(Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes) {
     CORRADE_INTERNAL_ASSERT(meshes.size());
 
-    const Implementation::MeshState& state = *Context::current().state().mesh;
+    Context& context = Context::current();
+    const Implementation::MeshState& state = *context.state().mesh;
+    ++context.statisticsInternal().drawCount;
 
-    Mesh& original = meshes.begin()->get()._original;
+    AbstractTexture::flushDeferredBindings();
+
+    Mesh& original = meshes[0].get()._original;
     Containers::Array<GLsizei> count{meshes.size()};
     Containers::Array<GLvoid*> indices{meshes.size()};
     Containers::Array<GLint> baseVertex{meshes.size()};
@@ -89,7 +93,7 @@ void MeshView::multiDrawImplementationDefault(std::initializer_list<std::referen
         ++i;
     }
 
-    (original.*state.bindImplementation)();
+    original.bindInternal();
 
     /* Non-indexed meshes */
     if(!original._indexBuffer.id()) {
@@ -123,7 +127,7 @@ void MeshView::multiDrawImplementationDefault(std::initializer_list<std::referen
 #endif
 
 #ifdef MAGNUM_TARGET_GLES
-void MeshView::multiDrawImplementationFallback(std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+void MeshView::multiDrawImplementationFallback(Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes) {
     for(MeshView& mesh: meshes) {
         /* Nothing to draw in this mesh */
         if(!mesh._count) continue;
@@ -31,6 +31,7 @@
 
 #include <functional>
 #include <initializer_list>
+#include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/GL/GL.h"
 #include "Magnum/GL/OpenGL.h"
@@ -88,13 +89,23 @@ class MAGNUM_GL_EXPORT MeshView {
          * @requires_gl Specifying base vertex for indexed meshes is not
          *      available in OpenGL ES or WebGL.
          */
-        static void draw(AbstractShaderProgram& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes);
+        static void draw(AbstractShaderProgram& shader, Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes);
 
         /** @overload */
-        static void draw(AbstractShaderProgram&& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+        static void draw(AbstractShaderProgram&& shader, Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes) {
             draw(shader, meshes);
         }
 
+        /** @overload */
+        static void draw(AbstractShaderProgram& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+            draw(shader, Containers::arrayView(meshes.begin(), meshes.size()));
+        }
+
+        /** @overload */
+        static void draw(AbstractShaderProgram&& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+            draw(shader, Containers::arrayView(meshes.begin(), meshes.size()));
+        }
+
         /**
          * @brief Constructor
          * @param original  Original, already configured mesh
@@ -238,7 +249,7 @@ class MAGNUM_GL_EXPORT MeshView {
          * @return Reference to self (for method chaining)
          *
          * See @ref Mesh::draw(AbstractShaderProgram&) for more information.
-         * @see @ref draw(AbstractShaderProgram&, std::initializer_list<std::reference_wrapper<MeshView>>),
+         * @see @ref draw(AbstractShaderProgram&, Containers::ArrayView<const std::reference_wrapper<MeshView>>),
          *      @ref draw(AbstractShaderProgram&, TransformFeedback&, UnsignedInt)
          * @requires_gl32 Extension @gl_extension{ARB,draw_elements_base_vertex}
          *      if the mesh is indexed and @ref baseVertex() is not `0`.
@@ -286,9 +297,9 @@ class MAGNUM_GL_EXPORT MeshView {
 
     private:
         #ifndef MAGNUM_TARGET_WEBGL
-        static MAGNUM_GL_LOCAL void multiDrawImplementationDefault(std::initializer_list<std::reference_wrapper<MeshView>> meshes);
+        static MAGNUM_GL_LOCAL void multiDrawImplementationDefault(Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes);
         #endif
-        static MAGNUM_GL_LOCAL void multiDrawImplementationFallback(std::initializer_list<std::reference_wrapper<MeshView>> meshes);
+        static MAGNUM_GL_LOCAL void multiDrawImplementationFallback(Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes);
 
         std::reference_wrapper<Mesh> _original;
 
@@ -0,0 +1,118 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ProgramBinaryCache.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Sha1.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Implementation/ShaderProgramState.h"
+#include "Magnum/GL/Implementation/State.h"
+
+namespace Magnum { namespace GL {
+
+bool ProgramBinaryCache::isSupported() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::get_program_binary>())
+        return false;
+    #endif
+
+    GLint formatCount{};
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    return formatCount;
+}
+
+ProgramBinaryCache* ProgramBinaryCache::current() {
+    return Context::current().state().shaderProgram->binaryCache;
+}
+
+void ProgramBinaryCache::setCurrent(ProgramBinaryCache* const cache) {
+    Context::current().state().shaderProgram->binaryCache = cache;
+}
+
+ProgramBinaryCache::ProgramBinaryCache(std::string directory): _directory{std::move(directory)} {}
+
+ProgramBinaryCache::~ProgramBinaryCache() {
+    /* Don't leave a dangling pointer behind. The context might be already
+       gone at this point, in which case there's nothing to reset. */
+    if(Context::hasCurrent() && current() == this) setCurrent(nullptr);
+}
+
+std::string ProgramBinaryCache::key(std::initializer_list<std::reference_wrapper<Shader>> shaders) const {
+    Context& context = Context::current();
+
+    /* Separate the strings with zero bytes so e.g. moving a character from
+       one source to another doesn't result in the same hash */
+    Utility::Sha1 sha1;
+    sha1 << context.vendorString() << std::string(1, '\0')
+         << context.rendererString() << std::string(1, '\0')
+         << context.versionString() << std::string(1, '\0');
+    for(Shader& shader: shaders) {
+        const UnsignedInt type = UnsignedInt(shader.type());
+        sha1 << std::string{reinterpret_cast<const char*>(&type), sizeof(type)};
+        for(const std::string& source: shader.sources())
+            sha1 << source << std::string(1, '\0');
+    }
+
+    return sha1.digest().hexString();
+}
+
+bool ProgramBinaryCache::load(AbstractShaderProgram& program, const std::string& key) {
+    if(!isSupported()) return false;
+
+    const std::string filename = Utility::Directory::join(_directory, key + ".bin");
+    if(!Utility::Directory::fileExists(filename)) return false;
+
+    /* The file consists of the binary format followed by the binary itself */
+    const Containers::Array<char> data = Utility::Directory::read(filename);
+    if(data.size() <= sizeof(UnsignedInt)) return false;
+
+    UnsignedInt format;
+    std::memcpy(&format, data, sizeof(UnsignedInt));
+    return program.setBinary(format, data.suffix(sizeof(UnsignedInt)));
+}
+
+bool ProgramBinaryCache::save(AbstractShaderProgram& program, const std::string& key) {
+    if(!isSupported()) return false;
+
+    const std::pair<GLenum, Containers::Array<char>> binary = program.binary();
+    if(binary.second.empty()) return false;
+
+    Containers::Array<char> data{sizeof(UnsignedInt) + binary.second.size()};
+    const UnsignedInt format = binary.first;
+    std::memcpy(data, &format, sizeof(UnsignedInt));
+    std::memcpy(data + sizeof(UnsignedInt), binary.second, binary.second.size());
+
+    if(!Utility::Directory::mkpath(_directory)) return false;
+    return Utility::Directory::write(Utility::Directory::join(_directory, key + ".bin"), data);
+}
+
+}}
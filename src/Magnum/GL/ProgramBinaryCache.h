@@ -0,0 +1,190 @@
+#ifndef Magnum_GL_ProgramBinaryCache_h
+#define Magnum_GL_ProgramBinaryCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::GL::ProgramBinaryCache
+ */
+#endif
+
+#include <functional>
+#include <initializer_list>
+#include <string>
+
+#include "Magnum/GL/GL.h"
+#include "Magnum/GL/visibility.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace GL {
+
+/**
+@brief On-disk cache of shader program binaries
+
+Compiling and linking shaders can take a significant amount of time,
+especially on mobile drivers or on the first run with a cold driver cache.
+This class stores binaries of linked programs in a directory and loads them
+on subsequent runs instead of compiling the sources again. Binaries are keyed
+on a hash of all shader sources (including all @cpp #define @ce statements
+and the @cpp #version @ce directive) together with the
+@ref Context::vendorString() "driver vendor", @ref Context::rendererString() "renderer"
+and @ref Context::versionString() "version string", so a driver update
+automatically invalidates the cache. If the driver rejects a binary anyway,
+the program is compiled and linked from sources again and the cache entry is
+overwritten.
+
+@section GL-ProgramBinaryCache-usage Usage
+
+Create the cache with a writable directory and make it current. All builtin
+shaders in the @ref Shaders namespace then use it transparently:
+
+@code{.cpp}
+GL::ProgramBinaryCache cache{Utility::Directory::join(
+    Utility::Directory::configurationDir("MyApp"), "shaders")};
+GL::ProgramBinaryCache::setCurrent(&cache);
+
+Shaders::Phong shader; // compiled on first run, loaded from cache afterwards
+@endcode
+
+Custom shaders can make use of the current cache through
+@ref AbstractShaderProgram::loadCachedBinary() and
+@ref AbstractShaderProgram::saveCachedBinary(), or the cache can be used
+directly through @ref key(), @ref load() and @ref save().
+
+The cache is per-context. It's not copyable or movable and it's expected to
+outlive all shader creation that uses it. If it's the current cache when
+destroyed, the current cache is reset to @cpp nullptr @ce.
+
+@see @ref AbstractShaderProgram::binary(),
+    @ref AbstractShaderProgram::setBinary()
+@requires_gl41 Extension @gl_extension{ARB,get_program_binary}
+@requires_gles30 Not supported in OpenGL ES 2.0.
+@requires_gles Binary program representations are not supported in WebGL.
+*/
+class MAGNUM_GL_EXPORT ProgramBinaryCache {
+    public:
+        /**
+         * @brief Whether program binaries are supported
+         *
+         * Returns @cpp true @ce if @gl_extension{ARB,get_program_binary} (part
+         * of OpenGL 4.1) is supported and the driver advertises at least one
+         * binary format, @cpp false @ce otherwise. Always @cpp true @ce on
+         * OpenGL ES 3.0+, as long as at least one format is advertised.
+         * @see @fn_gl{Get} with @def_gl_keyword{NUM_PROGRAM_BINARY_FORMATS}
+         */
+        static bool isSupported();
+
+        /**
+         * @brief Current cache
+         *
+         * Cache used by the builtin shaders, @cpp nullptr @ce if not set.
+         * @see @ref setCurrent()
+         */
+        static ProgramBinaryCache* current();
+
+        /**
+         * @brief Set current cache
+         *
+         * Pass @cpp nullptr @ce to disable the caching.
+         */
+        static void setCurrent(ProgramBinaryCache* cache);
+
+        /**
+         * @brief Constructor
+         * @param directory Directory to store the binaries in
+         *
+         * The directory is created on first @ref save(), if it doesn't exist
+         * already.
+         */
+        explicit ProgramBinaryCache(std::string directory);
+
+        /** @brief Copying is not allowed */
+        ProgramBinaryCache(const ProgramBinaryCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ProgramBinaryCache(ProgramBinaryCache&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * If this cache is @ref current(), resets current cache to
+         * @cpp nullptr @ce.
+         */
+        ~ProgramBinaryCache();
+
+        /** @brief Copying is not allowed */
+        ProgramBinaryCache& operator=(const ProgramBinaryCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ProgramBinaryCache& operator=(ProgramBinaryCache&&) = delete;
+
+        /** @brief Cache directory */
+        std::string directory() const { return _directory; }
+
+        /**
+         * @brief Cache key for given shaders
+         *
+         * Returns a hexadecimal SHA-1 hash of the driver vendor, renderer and
+         * version strings of @ref Context::current() together with the type
+         * and sources of all @p shaders, in order. The shaders don't need to
+         * be compiled.
+         */
+        std::string key(std::initializer_list<std::reference_wrapper<Shader>> shaders) const;
+
+        /**
+         * @brief Load program from cache
+         *
+         * Returns @cpp false @ce if there's no binary for given @p key, if
+         * program binaries are not @ref isSupported() "supported" or if the
+         * driver rejected the binary, @cpp true @ce if the program was loaded
+         * and doesn't need to be linked.
+         * @see @ref AbstractShaderProgram::setBinary()
+         */
+        bool load(AbstractShaderProgram& program, const std::string& key);
+
+        /**
+         * @brief Save program to cache
+         *
+         * Expects that the @p program is linked. For the binary to be
+         * available, @ref AbstractShaderProgram::setRetrievableBinary() should
+         * be enabled before linking. Returns @cpp false @ce if program
+         * binaries are not @ref isSupported() "supported", if the driver
+         * doesn't provide any binary for the program or if the file can't be
+         * written, @cpp true @ce otherwise.
+         * @see @ref AbstractShaderProgram::binary()
+         */
+        bool save(AbstractShaderProgram& program, const std::string& key);
+
+    private:
+        std::string _directory;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
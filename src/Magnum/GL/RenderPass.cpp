@@ -0,0 +1,218 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RenderPass.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/DefaultFramebuffer.h"
+#include "Magnum/GL/Framebuffer.h"
+#ifdef MAGNUM_TARGET_GLES2
+#include "Magnum/GL/Renderer.h"
+#endif
+#include "Magnum/GL/Implementation/State.h"
+#include "Magnum/GL/Implementation/FramebufferState.h"
+
+namespace Magnum { namespace GL {
+
+RenderPass::RenderPass(AbstractFramebuffer& framebuffer, const bool isDefault): _framebuffer(framebuffer), _isDefault{isDefault} {}
+
+RenderPass::RenderPass(Framebuffer& framebuffer): RenderPass{framebuffer, false} {}
+
+RenderPass::RenderPass(DefaultFramebuffer& framebuffer): RenderPass{framebuffer, true} {}
+
+RenderPass& RenderPass::setColorAttachment(const UnsignedInt id, const RenderPassLoadAction load, const RenderPassStoreAction store, const Color4& clearColor) {
+    CORRADE_ASSERT(!_isDefault || id == 0,
+        "GL::RenderPass::setColorAttachment(): only attachment 0 is available on the default framebuffer, got" << id, *this);
+
+    if(id >= _colors.size()) _colors.resize(id + 1);
+    _colors[id].load = load;
+    _colors[id].store = store;
+    _colors[id].clearColor = clearColor;
+    return *this;
+}
+
+RenderPass& RenderPass::setDepthAttachment(const RenderPassLoadAction load, const RenderPassStoreAction store, const Float clearDepth) {
+    _depth.load = load;
+    _depth.store = store;
+    _clearDepth = clearDepth;
+    return *this;
+}
+
+RenderPass& RenderPass::setStencilAttachment(const RenderPassLoadAction load, const RenderPassStoreAction store, const Int clearStencil) {
+    _stencil.load = load;
+    _stencil.store = store;
+    _clearStencil = clearStencil;
+    return *this;
+}
+
+RenderPassLoadAction RenderPass::colorLoadAction(const UnsignedInt id) const {
+    return id < _colors.size() ? _colors[id].load : RenderPassLoadAction::Load;
+}
+
+RenderPassStoreAction RenderPass::colorStoreAction(const UnsignedInt id) const {
+    return id < _colors.size() ? _colors[id].store : RenderPassStoreAction::Store;
+}
+
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+RenderPass& RenderPass::setResolveFramebuffer(AbstractFramebuffer& destination, const FramebufferBlitMask mask) {
+    _resolve = &destination;
+    _resolveMask = mask;
+    return *this;
+}
+#endif
+
+RenderPass& RenderPass::begin() {
+    CORRADE_ASSERT(!_active,
+        "GL::RenderPass::begin(): the pass is already active", *this);
+
+    _active = true;
+    _framebuffer.bind();
+
+    /* Invalidate first so the driver knows it doesn't need to load anything,
+       then clear */
+    invalidate(true);
+
+    #ifndef MAGNUM_TARGET_GLES2
+    for(std::size_t i = 0; i != _colors.size(); ++i) {
+        if(_colors[i].load != RenderPassLoadAction::Clear) continue;
+        if(_isDefault)
+            static_cast<DefaultFramebuffer&>(_framebuffer).clearColor(_colors[i].clearColor);
+        else
+            static_cast<Framebuffer&>(_framebuffer).clearColor(Int(i), _colors[i].clearColor);
+    }
+
+    const bool clearDepth = _depth.load == RenderPassLoadAction::Clear;
+    const bool clearStencil = _stencil.load == RenderPassLoadAction::Clear;
+    if(clearDepth && clearStencil)
+        _framebuffer.clearDepthStencil(_clearDepth, _clearStencil);
+    else if(clearDepth)
+        _framebuffer.clearDepth(_clearDepth);
+    else if(clearStencil)
+        _framebuffer.clearStencil(_clearStencil);
+    #else
+    /* No direct clearing on ES2, go through the global clear values. All
+       color attachments get the value of the first one that's cleared. */
+    FramebufferClearMask mask;
+    for(const ColorAttachment& color: _colors) {
+        if(color.load != RenderPassLoadAction::Clear) continue;
+        if(!(mask & FramebufferClear::Color))
+            Renderer::setClearColor(color.clearColor);
+        mask |= FramebufferClear::Color;
+    }
+    if(_depth.load == RenderPassLoadAction::Clear) {
+        Renderer::setClearDepth(_clearDepth);
+        mask |= FramebufferClear::Depth;
+    }
+    if(_stencil.load == RenderPassLoadAction::Clear) {
+        Renderer::setClearStencil(_clearStencil);
+        mask |= FramebufferClear::Stencil;
+    }
+    if(mask) _framebuffer.clear(mask);
+    #endif
+
+    return *this;
+}
+
+RenderPass& RenderPass::end() {
+    CORRADE_ASSERT(_active,
+        "GL::RenderPass::end(): the pass is not active", *this);
+
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    if(_resolve) {
+        const Range2Di rectangle = _framebuffer.viewport();
+        AbstractFramebuffer::blit(_framebuffer, *_resolve, rectangle, rectangle, _resolveMask, FramebufferBlitFilter::Nearest);
+    }
+    #endif
+
+    invalidate(false);
+
+    _active = false;
+    return *this;
+}
+
+GLenum RenderPass::colorAttachmentEnum(const UnsignedInt id) const {
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    if(_isDefault) return GLenum(DefaultFramebuffer::InvalidationAttachment::Color);
+    #endif
+    return GLenum(Framebuffer::ColorAttachment{id});
+}
+
+void RenderPass::invalidate(const bool atBegin) {
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    /** @todo C++14: use VLA to avoid heap allocation */
+    Containers::Array<GLenum> attachments{_colors.size() + 2};
+    std::size_t count = 0;
+    auto discarded = [atBegin](const Attachment& attachment) {
+        return atBegin ?
+            attachment.load == RenderPassLoadAction::DontCare :
+            attachment.store == RenderPassStoreAction::DontCare;
+    };
+
+    for(std::size_t i = 0; i != _colors.size(); ++i)
+        if(discarded(_colors[i])) attachments[count++] = colorAttachmentEnum(i);
+    if(discarded(_depth)) attachments[count++] = _isDefault ?
+        GLenum(DefaultFramebuffer::InvalidationAttachment::Depth) :
+        GLenum(Framebuffer::InvalidationAttachment::Depth);
+    if(discarded(_stencil)) attachments[count++] = _isDefault ?
+        GLenum(DefaultFramebuffer::InvalidationAttachment::Stencil) :
+        GLenum(Framebuffer::InvalidationAttachment::Stencil);
+
+    if(count) (_framebuffer.*Context::current().state().framebuffer->invalidateImplementation)(count, attachments);
+    #else
+    static_cast<void>(atBegin);
+    #endif
+}
+
+Debug& operator<<(Debug& debug, const RenderPassLoadAction value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case RenderPassLoadAction::value: return debug << "GL::RenderPassLoadAction::" #value;
+        _c(Load)
+        _c(Clear)
+        _c(DontCare)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "GL::RenderPassLoadAction(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const RenderPassStoreAction value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case RenderPassStoreAction::value: return debug << "GL::RenderPassStoreAction::" #value;
+        _c(Store)
+        _c(DontCare)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "GL::RenderPassStoreAction(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+}}
@@ -0,0 +1,306 @@
+#ifndef Magnum_GL_RenderPass_h
+#define Magnum_GL_RenderPass_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::GL::RenderPass, enum @ref Magnum::GL::RenderPassLoadAction, @ref Magnum::GL::RenderPassStoreAction
+ */
+
+#include <vector>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/GL/AbstractFramebuffer.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Render pass load action
+
+Specifies what happens with contents of given attachment at the beginning of
+a render pass.
+@see @ref RenderPass, @ref RenderPassStoreAction
+*/
+enum class RenderPassLoadAction: UnsignedByte {
+    /**
+     * Previous contents of the attachment are preserved. On tile-based GPUs
+     * this means the contents have to be read from memory to the tile memory
+     * first.
+     */
+    Load,
+
+    /** The attachment is cleared to a specified value. */
+    Clear,
+
+    /**
+     * Previous contents of the attachment are not needed and the attachment
+     * is invalidated. Use if all pixels of the attachment are overwritten
+     * during the pass anyway.
+     */
+    DontCare
+};
+
+/**
+@brief Render pass store action
+
+Specifies what happens with contents of given attachment at the end of a
+render pass.
+@see @ref RenderPass, @ref RenderPassLoadAction
+*/
+enum class RenderPassStoreAction: UnsignedByte {
+    /** Contents of the attachment are written to memory. */
+    Store,
+
+    /**
+     * Contents of the attachment are not needed after the pass and the
+     * attachment is invalidated, so tile-based GPUs don't need to write them
+     * to memory at all. Useful for depth and stencil buffers or for
+     * multisample attachments that are resolved at the end of the pass.
+     */
+    DontCare
+};
+
+/** @debugoperatorenum{RenderPassLoadAction} */
+MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, RenderPassLoadAction value);
+
+/** @debugoperatorenum{RenderPassStoreAction} */
+MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, RenderPassStoreAction value);
+
+/**
+@brief Render pass
+
+Structures the use of @ref AbstractFramebuffer::clear() "clear()" and
+@ref Framebuffer::invalidate() "invalidate()" around rendering to a
+framebuffer. Tile-based GPUs, common on mobile and embedded platforms, render
+into a small on-chip memory and have to load the previous framebuffer
+contents from memory at the beginning and write them back at the end. A
+missing clear or invalidation makes the driver do both of these for every
+attachment, which wastes a lot of memory bandwidth. The render pass declares
+a load and a store action for each attachment upfront and emits the
+corresponding GL calls at the right points.
+
+@section GL-RenderPass-usage Usage
+
+Declare what should happen with each attachment, then surround the drawing
+with @ref begin() and @ref end(). In the following example the color buffer
+is cleared at the beginning and stored, while the depth buffer is again
+cleared, but then discarded at the end:
+
+@snippet MagnumGL.cpp RenderPass-usage
+
+At @ref begin() the framebuffer is bound for drawing, attachments with
+@ref RenderPassLoadAction::DontCare are invalidated and attachments with
+@ref RenderPassLoadAction::Clear are cleared to values specified in
+@ref setColorAttachment(), @ref setDepthAttachment() and
+@ref setStencilAttachment(). At @ref end() attachments with
+@ref RenderPassStoreAction::DontCare are invalidated. Attachments with
+@ref RenderPassLoadAction::Load and @ref RenderPassStoreAction::Store are not
+touched at all, which is also the default for attachments that weren't
+declared.
+
+@section GL-RenderPass-multisample Multisample resolve
+
+With @ref setResolveFramebuffer() the multisample framebuffer is blitted to
+a single-sample framebuffer at @ref end(), right before the invalidation. If
+the multisample attachments have @ref RenderPassStoreAction::DontCare, their
+contents are never written to memory --- the resolved values are the only
+output of the pass:
+
+@snippet MagnumGL.cpp RenderPass-multisample
+
+@section GL-RenderPass-limitations Limitations
+
+On OpenGL ES 2.0 the clearing is done using @ref Renderer::setClearColor(),
+@ref Renderer::setClearDepth(), @ref Renderer::setClearStencil() and
+@ref AbstractFramebuffer::clear(), which means the clear values are global
+state and all color attachments are cleared to the same value. On WebGL 1.0
+the invalidation is not available and so the pass only clears the
+attachments. If the invalidation extensions are not available, it silently
+does nothing, same as in @ref Framebuffer::invalidate().
+
+Color attachments are identified by their index, which is expected to be
+mapped to a draw buffer of the same index using @ref Framebuffer::mapForDraw()
+(the default mapping for the first attachment). For the default framebuffer
+only the index @cpp 0 @ce is allowed.
+*/
+class MAGNUM_GL_EXPORT RenderPass {
+    public:
+        /**
+         * @brief Constructor
+         * @param framebuffer   Framebuffer to render to
+         *
+         * All attachments default to @ref RenderPassLoadAction::Load and
+         * @ref RenderPassStoreAction::Store. The framebuffer is expected to
+         * stay alive for the whole lifetime of the pass.
+         */
+        explicit RenderPass(Framebuffer& framebuffer);
+
+        /** @overload */
+        explicit RenderPass(DefaultFramebuffer& framebuffer);
+
+        /** @brief Framebuffer to render to */
+        AbstractFramebuffer& framebuffer() { return _framebuffer; }
+
+        /**
+         * @brief Set color attachment actions
+         * @param id        Color attachment index
+         * @param load      Load action
+         * @param store     Store action
+         * @param clearColor Color to clear with if @p load is
+         *      @ref RenderPassLoadAction::Clear
+         * @return Reference to self (for method chaining)
+         *
+         * For the default framebuffer expects that @p id is @cpp 0 @ce.
+         */
+        RenderPass& setColorAttachment(UnsignedInt id, RenderPassLoadAction load, RenderPassStoreAction store, const Color4& clearColor = {});
+
+        /**
+         * @brief Set depth attachment actions
+         * @param load      Load action
+         * @param store     Store action
+         * @param clearDepth Depth to clear with if @p load is
+         *      @ref RenderPassLoadAction::Clear
+         * @return Reference to self (for method chaining)
+         */
+        RenderPass& setDepthAttachment(RenderPassLoadAction load, RenderPassStoreAction store, Float clearDepth = 1.0f);
+
+        /**
+         * @brief Set stencil attachment actions
+         * @param load      Load action
+         * @param store     Store action
+         * @param clearStencil Stencil value to clear with if @p load is
+         *      @ref RenderPassLoadAction::Clear
+         * @return Reference to self (for method chaining)
+         */
+        RenderPass& setStencilAttachment(RenderPassLoadAction load, RenderPassStoreAction store, Int clearStencil = 0);
+
+        /** @brief Color attachment load action */
+        RenderPassLoadAction colorLoadAction(UnsignedInt id) const;
+
+        /** @brief Color attachment store action */
+        RenderPassStoreAction colorStoreAction(UnsignedInt id) const;
+
+        /** @brief Depth attachment load action */
+        RenderPassLoadAction depthLoadAction() const { return _depth.load; }
+
+        /** @brief Depth attachment store action */
+        RenderPassStoreAction depthStoreAction() const { return _depth.store; }
+
+        /** @brief Stencil attachment load action */
+        RenderPassLoadAction stencilLoadAction() const { return _stencil.load; }
+
+        /** @brief Stencil attachment store action */
+        RenderPassStoreAction stencilStoreAction() const { return _stencil.store; }
+
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        /**
+         * @brief Set multisample resolve framebuffer
+         * @param destination   Framebuffer to resolve to
+         * @param mask          Which buffers to resolve
+         * @return Reference to self (for method chaining)
+         *
+         * At @ref end() the whole @ref AbstractFramebuffer::viewport() of the
+         * pass framebuffer is blitted to the same rectangle of
+         * @p destination using @ref AbstractFramebuffer::blit(), before the
+         * attachments are invalidated. The @p destination is expected to stay
+         * alive for the whole lifetime of the pass.
+         * @requires_gles30 Extension @gl_extension{ANGLE,framebuffer_blit} or
+         *      @gl_extension{NV,framebuffer_blit} in OpenGL ES 2.0.
+         * @requires_webgl20 Framebuffer blit is not available in WebGL 1.0.
+         */
+        RenderPass& setResolveFramebuffer(AbstractFramebuffer& destination, FramebufferBlitMask mask = FramebufferBlit::Color);
+
+        /**
+         * @brief Multisample resolve framebuffer
+         *
+         * Returns @cpp nullptr @ce if no resolve framebuffer was set.
+         * @requires_gles30 Extension @gl_extension{ANGLE,framebuffer_blit} or
+         *      @gl_extension{NV,framebuffer_blit} in OpenGL ES 2.0.
+         * @requires_webgl20 Framebuffer blit is not available in WebGL 1.0.
+         */
+        AbstractFramebuffer* resolveFramebuffer() const { return _resolve; }
+        #endif
+
+        /** @brief Whether the pass is between @ref begin() and @ref end() */
+        bool isActive() const { return _active; }
+
+        /**
+         * @brief Begin the pass
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the pass is not already active. Binds the framebuffer
+         * for drawing, invalidates attachments with
+         * @ref RenderPassLoadAction::DontCare and clears attachments with
+         * @ref RenderPassLoadAction::Clear.
+         * @see @ref AbstractFramebuffer::bind(),
+         *      @ref Framebuffer::invalidate(), @ref Framebuffer::clearColor(),
+         *      @ref AbstractFramebuffer::clearDepth(),
+         *      @ref AbstractFramebuffer::clearStencil()
+         */
+        RenderPass& begin();
+
+        /**
+         * @brief End the pass
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the pass is active. Resolves the framebuffer if
+         * @ref setResolveFramebuffer() was called and then invalidates
+         * attachments with @ref RenderPassStoreAction::DontCare.
+         * @see @ref AbstractFramebuffer::blit(),
+         *      @ref Framebuffer::invalidate()
+         */
+        RenderPass& end();
+
+    private:
+        struct Attachment {
+            RenderPassLoadAction load{RenderPassLoadAction::Load};
+            RenderPassStoreAction store{RenderPassStoreAction::Store};
+        };
+
+        struct ColorAttachment: Attachment {
+            Color4 clearColor;
+        };
+
+        explicit RenderPass(AbstractFramebuffer& framebuffer, bool isDefault);
+
+        GLenum MAGNUM_GL_LOCAL colorAttachmentEnum(UnsignedInt id) const;
+        void MAGNUM_GL_LOCAL invalidate(bool atBegin);
+
+        AbstractFramebuffer& _framebuffer;
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        AbstractFramebuffer* _resolve{};
+        FramebufferBlitMask _resolveMask;
+        #endif
+        std::vector<ColorAttachment> _colors;
+        Attachment _depth, _stencil;
+        Float _clearDepth{1.0f};
+        Int _clearStencil{};
+        bool _isDefault, _active{};
+};
+
+}}
+
+#endif
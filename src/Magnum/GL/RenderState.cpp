@@ -0,0 +1,130 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RenderState.h"
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Implementation/State.h"
+#include "Magnum/GL/Implementation/RendererState.h"
+
+namespace Magnum { namespace GL {
+
+namespace {
+
+inline void setFeature(const GLenum feature, const bool enabled) {
+    enabled ? glEnable(feature) : glDisable(feature);
+}
+
+}
+
+RenderState::RenderState():
+    _blendEquationRgb{Renderer::BlendEquation::Add},
+    _blendEquationAlpha{Renderer::BlendEquation::Add},
+    _blendSourceRgb{Renderer::BlendFunction::One},
+    _blendDestinationRgb{Renderer::BlendFunction::Zero},
+    _blendSourceAlpha{Renderer::BlendFunction::One},
+    _blendDestinationAlpha{Renderer::BlendFunction::Zero},
+    _depthFunction{Renderer::DepthFunction::Less},
+    _faceCullingMode{Renderer::PolygonFacing::Back},
+    _stencilFunction{Renderer::StencilFunction::Always},
+    _stencilFail{Renderer::StencilOperation::Keep},
+    _stencilDepthFail{Renderer::StencilOperation::Keep},
+    _stencilDepthPass{Renderer::StencilOperation::Keep},
+    _stencilReferenceValue{0}, _stencilFunctionMask{~0u}, _stencilMask{~0u},
+    _colorMask{UnsignedByte(0xf)}, _blending{false}, _depthTest{false}, _depthMask{true},
+    _faceCulling{false}, _stencilTest{false} {}
+
+bool RenderState::operator==(const RenderState& other) const {
+    return _blendEquationRgb == other._blendEquationRgb &&
+        _blendEquationAlpha == other._blendEquationAlpha &&
+        _blendSourceRgb == other._blendSourceRgb &&
+        _blendDestinationRgb == other._blendDestinationRgb &&
+        _blendSourceAlpha == other._blendSourceAlpha &&
+        _blendDestinationAlpha == other._blendDestinationAlpha &&
+        _depthFunction == other._depthFunction &&
+        _faceCullingMode == other._faceCullingMode &&
+        _stencilFunction == other._stencilFunction &&
+        _stencilFail == other._stencilFail &&
+        _stencilDepthFail == other._stencilDepthFail &&
+        _stencilDepthPass == other._stencilDepthPass &&
+        _stencilReferenceValue == other._stencilReferenceValue &&
+        _stencilFunctionMask == other._stencilFunctionMask &&
+        _stencilMask == other._stencilMask &&
+        _colorMask == other._colorMask &&
+        _blending == other._blending &&
+        _depthTest == other._depthTest &&
+        _depthMask == other._depthMask &&
+        _faceCulling == other._faceCulling &&
+        _stencilTest == other._stencilTest;
+}
+
+void RenderState::apply() const {
+    typedef Implementation::RendererState State;
+    State& state = *Context::current().state().renderer;
+    RenderState& current = state.renderState;
+    const UnsignedShort unknown = state.renderStateUnknown;
+
+    if((unknown & State::RenderStateBlending) || current._blending != _blending)
+        setFeature(GL_BLEND, _blending);
+    if((unknown & State::RenderStateBlendEquation) || current._blendEquationRgb != _blendEquationRgb || current._blendEquationAlpha != _blendEquationAlpha) {
+        if(_blendEquationRgb == _blendEquationAlpha)
+            glBlendEquation(GLenum(_blendEquationRgb));
+        else glBlendEquationSeparate(GLenum(_blendEquationRgb), GLenum(_blendEquationAlpha));
+    }
+    if((unknown & State::RenderStateBlendFunction) || current._blendSourceRgb != _blendSourceRgb || current._blendDestinationRgb != _blendDestinationRgb || current._blendSourceAlpha != _blendSourceAlpha || current._blendDestinationAlpha != _blendDestinationAlpha) {
+        if(_blendSourceRgb == _blendSourceAlpha && _blendDestinationRgb == _blendDestinationAlpha)
+            glBlendFunc(GLenum(_blendSourceRgb), GLenum(_blendDestinationRgb));
+        else glBlendFuncSeparate(GLenum(_blendSourceRgb), GLenum(_blendDestinationRgb), GLenum(_blendSourceAlpha), GLenum(_blendDestinationAlpha));
+    }
+
+    if((unknown & State::RenderStateDepthTest) || current._depthTest != _depthTest)
+        setFeature(GL_DEPTH_TEST, _depthTest);
+    if((unknown & State::RenderStateDepthFunction) || current._depthFunction != _depthFunction)
+        glDepthFunc(GLenum(_depthFunction));
+    if((unknown & State::RenderStateDepthMask) || current._depthMask != _depthMask)
+        glDepthMask(_depthMask);
+
+    if((unknown & State::RenderStateFaceCulling) || current._faceCulling != _faceCulling)
+        setFeature(GL_CULL_FACE, _faceCulling);
+    if((unknown & State::RenderStateFaceCullingMode) || current._faceCullingMode != _faceCullingMode)
+        glCullFace(GLenum(_faceCullingMode));
+
+    if((unknown & State::RenderStateStencilTest) || current._stencilTest != _stencilTest)
+        setFeature(GL_STENCIL_TEST, _stencilTest);
+    if((unknown & State::RenderStateStencilFunction) || current._stencilFunction != _stencilFunction || current._stencilReferenceValue != _stencilReferenceValue || current._stencilFunctionMask != _stencilFunctionMask)
+        glStencilFunc(GLenum(_stencilFunction), _stencilReferenceValue, _stencilFunctionMask);
+    if((unknown & State::RenderStateStencilOperation) || current._stencilFail != _stencilFail || current._stencilDepthFail != _stencilDepthFail || current._stencilDepthPass != _stencilDepthPass)
+        glStencilOp(GLenum(_stencilFail), GLenum(_stencilDepthFail), GLenum(_stencilDepthPass));
+    if((unknown & State::RenderStateStencilMask) || current._stencilMask != _stencilMask)
+        glStencilMask(_stencilMask);
+
+    if((unknown & State::RenderStateColorMask) || current._colorMask != _colorMask)
+        glColorMask(_colorMask[0], _colorMask[1], _colorMask[2], _colorMask[3]);
+
+    current = *this;
+    state.renderStateUnknown = 0;
+}
+
+}}
@@ -0,0 +1,377 @@
+#ifndef Magnum_GL_RenderState_h
+#define Magnum_GL_RenderState_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::GL::RenderState
+ */
+
+#include "Magnum/Math/BoolVector.h"
+#include "Magnum/GL/Renderer.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Render state block
+
+Collects blending, depth test, face culling, stencil test and write mask
+state into a single value. Each of the @ref Renderer functions such as
+@ref Renderer::enable(), @ref Renderer::setBlendFunction() or
+@ref Renderer::setDepthFunction() results in a GL call even if the state
+doesn't change, which adds up when each drawable sets its own state. The
+@ref apply() function instead compares the block to the last applied state
+and emits GL calls only for the parts that differ.
+
+@section GL-RenderState-usage Usage
+
+Create a state for each kind of drawable upfront and apply it before the
+draw:
+
+@code{.cpp}
+GL::RenderState transparent;
+transparent.setBlending(true)
+    .setBlendFunction(GL::Renderer::BlendFunction::One,
+                      GL::Renderer::BlendFunction::OneMinusSourceAlpha)
+    .setDepthTest(true)
+    .setDepthMask(false);
+
+// for each drawable
+transparent.apply();
+mesh.draw(shader);
+@endcode
+
+Default-constructed state matches the initial GL state, so applying it
+resets everything the block covers to defaults.
+
+@section GL-RenderState-tracking State tracking
+
+The last applied state is remembered per context. The tracked state is not
+aware of changes done directly through the @ref Renderer functions, so those
+mark the affected parts as unknown and the next @ref apply() sets them
+again. On the other hand, changes done by third-party GL code are not visible
+to Magnum at all --- call @ref Context::resetState() with
+@ref Context::State::Renderer after to make the next @ref apply() set
+everything again. The same is done implicitly for the first @ref apply()
+call in a context.
+
+Per-face stencil state and blend state for particular draw buffers are not
+covered by the block, use the @ref Renderer functions directly for those.
+*/
+class MAGNUM_GL_EXPORT RenderState {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * All fields are set to the initial GL state --- blending, depth
+         * test, face culling and stencil test are disabled, all writes are
+         * allowed and the functions are set to the initial values listed in
+         * the documentation of particular setters.
+         */
+        explicit RenderState();
+
+        /** @brief Whether blending is enabled */
+        bool isBlendingEnabled() const { return _blending; }
+
+        /**
+         * @brief Enable or disable blending
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp false @ce.
+         * @see @ref Renderer::Feature::Blending
+         */
+        RenderState& setBlending(bool enabled) {
+            _blending = enabled;
+            return *this;
+        }
+
+        /** @brief RGB blend equation */
+        Renderer::BlendEquation blendEquationRgb() const { return _blendEquationRgb; }
+
+        /** @brief Alpha blend equation */
+        Renderer::BlendEquation blendEquationAlpha() const { return _blendEquationAlpha; }
+
+        /**
+         * @brief Set blend equation
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Renderer::BlendEquation::Add for both.
+         * @see @ref Renderer::setBlendEquation()
+         */
+        RenderState& setBlendEquation(Renderer::BlendEquation rgb, Renderer::BlendEquation alpha) {
+            _blendEquationRgb = rgb;
+            _blendEquationAlpha = alpha;
+            return *this;
+        }
+
+        /** @overload */
+        RenderState& setBlendEquation(Renderer::BlendEquation equation) {
+            return setBlendEquation(equation, equation);
+        }
+
+        /** @brief RGB blend source factor */
+        Renderer::BlendFunction blendSourceRgb() const { return _blendSourceRgb; }
+
+        /** @brief RGB blend destination factor */
+        Renderer::BlendFunction blendDestinationRgb() const { return _blendDestinationRgb; }
+
+        /** @brief Alpha blend source factor */
+        Renderer::BlendFunction blendSourceAlpha() const { return _blendSourceAlpha; }
+
+        /** @brief Alpha blend destination factor */
+        Renderer::BlendFunction blendDestinationAlpha() const { return _blendDestinationAlpha; }
+
+        /**
+         * @brief Set blend function
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Renderer::BlendFunction::One for the source and
+         * @ref Renderer::BlendFunction::Zero for the destination factors.
+         * @see @ref Renderer::setBlendFunction()
+         */
+        RenderState& setBlendFunction(Renderer::BlendFunction sourceRgb, Renderer::BlendFunction destinationRgb, Renderer::BlendFunction sourceAlpha, Renderer::BlendFunction destinationAlpha) {
+            _blendSourceRgb = sourceRgb;
+            _blendDestinationRgb = destinationRgb;
+            _blendSourceAlpha = sourceAlpha;
+            _blendDestinationAlpha = destinationAlpha;
+            return *this;
+        }
+
+        /** @overload */
+        RenderState& setBlendFunction(Renderer::BlendFunction source, Renderer::BlendFunction destination) {
+            return setBlendFunction(source, destination, source, destination);
+        }
+
+        /** @brief Whether depth test is enabled */
+        bool isDepthTestEnabled() const { return _depthTest; }
+
+        /**
+         * @brief Enable or disable depth test
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp false @ce.
+         * @see @ref Renderer::Feature::DepthTest
+         */
+        RenderState& setDepthTest(bool enabled) {
+            _depthTest = enabled;
+            return *this;
+        }
+
+        /** @brief Depth function */
+        Renderer::DepthFunction depthFunction() const { return _depthFunction; }
+
+        /**
+         * @brief Set depth function
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Renderer::DepthFunction::Less.
+         * @see @ref Renderer::setDepthFunction()
+         */
+        RenderState& setDepthFunction(Renderer::DepthFunction function) {
+            _depthFunction = function;
+            return *this;
+        }
+
+        /** @brief Whether depth writes are allowed */
+        bool depthMask() const { return _depthMask; }
+
+        /**
+         * @brief Mask depth writes
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp true @ce.
+         * @see @ref Renderer::setDepthMask()
+         */
+        RenderState& setDepthMask(bool allow) {
+            _depthMask = allow;
+            return *this;
+        }
+
+        /** @brief Whether face culling is enabled */
+        bool isFaceCullingEnabled() const { return _faceCulling; }
+
+        /**
+         * @brief Enable or disable face culling
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp false @ce.
+         * @see @ref Renderer::Feature::FaceCulling
+         */
+        RenderState& setFaceCulling(bool enabled) {
+            _faceCulling = enabled;
+            return *this;
+        }
+
+        /** @brief Face culling mode */
+        Renderer::PolygonFacing faceCullingMode() const { return _faceCullingMode; }
+
+        /**
+         * @brief Set face culling mode
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Renderer::PolygonFacing::Back.
+         * @see @ref Renderer::setFaceCullingMode()
+         */
+        RenderState& setFaceCullingMode(Renderer::PolygonFacing mode) {
+            _faceCullingMode = mode;
+            return *this;
+        }
+
+        /** @brief Whether stencil test is enabled */
+        bool isStencilTestEnabled() const { return _stencilTest; }
+
+        /**
+         * @brief Enable or disable stencil test
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp false @ce.
+         * @see @ref Renderer::Feature::StencilTest
+         */
+        RenderState& setStencilTest(bool enabled) {
+            _stencilTest = enabled;
+            return *this;
+        }
+
+        /** @brief Stencil function */
+        Renderer::StencilFunction stencilFunction() const { return _stencilFunction; }
+
+        /** @brief Stencil reference value */
+        Int stencilReferenceValue() const { return _stencilReferenceValue; }
+
+        /** @brief Stencil function mask */
+        UnsignedInt stencilFunctionMask() const { return _stencilFunctionMask; }
+
+        /**
+         * @brief Set stencil function
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Renderer::StencilFunction::Always, reference value
+         * @cpp 0 @ce and mask with all @cpp 1 @ce s. Applies to both polygon
+         * facings.
+         * @see @ref Renderer::setStencilFunction(Renderer::StencilFunction, Int, UnsignedInt)
+         */
+        RenderState& setStencilFunction(Renderer::StencilFunction function, Int referenceValue, UnsignedInt mask) {
+            _stencilFunction = function;
+            _stencilReferenceValue = referenceValue;
+            _stencilFunctionMask = mask;
+            return *this;
+        }
+
+        /** @brief Action when stencil test fails */
+        Renderer::StencilOperation stencilFail() const { return _stencilFail; }
+
+        /** @brief Action when stencil test passes, but depth test fails */
+        Renderer::StencilOperation stencilDepthFail() const { return _stencilDepthFail; }
+
+        /** @brief Action when both stencil and depth test pass */
+        Renderer::StencilOperation stencilDepthPass() const { return _stencilDepthPass; }
+
+        /**
+         * @brief Set stencil operation
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Renderer::StencilOperation::Keep for all. Applies
+         * to both polygon facings.
+         * @see @ref Renderer::setStencilOperation(Renderer::StencilOperation, Renderer::StencilOperation, Renderer::StencilOperation)
+         */
+        RenderState& setStencilOperation(Renderer::StencilOperation stencilFail, Renderer::StencilOperation depthFail, Renderer::StencilOperation depthPass) {
+            _stencilFail = stencilFail;
+            _stencilDepthFail = depthFail;
+            _stencilDepthPass = depthPass;
+            return *this;
+        }
+
+        /** @brief Stencil write mask */
+        UnsignedInt stencilMask() const { return _stencilMask; }
+
+        /**
+         * @brief Mask stencil writes
+         * @return Reference to self (for method chaining)
+         *
+         * Default is all @cpp 1 @ce s. Applies to both polygon facings.
+         * @see @ref Renderer::setStencilMask(UnsignedInt)
+         */
+        RenderState& setStencilMask(UnsignedInt allowBits) {
+            _stencilMask = allowBits;
+            return *this;
+        }
+
+        /** @brief Color write mask */
+        Math::BoolVector<4> colorMask() const { return _colorMask; }
+
+        /**
+         * @brief Mask color writes
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp true @ce for all channels.
+         * @see @ref Renderer::setColorMask()
+         */
+        RenderState& setColorMask(bool allowRed, bool allowGreen, bool allowBlue, bool allowAlpha) {
+            _colorMask = Math::BoolVector<4>{UnsignedByte((allowRed ? 1 : 0)|(allowGreen ? 2 : 0)|(allowBlue ? 4 : 0)|(allowAlpha ? 8 : 0))};
+            return *this;
+        }
+
+        /** @brief Equality comparison */
+        bool operator==(const RenderState& other) const;
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const RenderState& other) const {
+            return !operator==(other);
+        }
+
+        /**
+         * @brief Apply the state
+         *
+         * Compares the state to the last applied state in current context
+         * and emits GL calls only for the parts that differ or that were
+         * changed through the @ref Renderer functions in the meantime. See
+         * @ref GL-RenderState-tracking for more information.
+         * @see @fn_gl_keyword{Enable}, @fn_gl_keyword{Disable},
+         *      @fn_gl_keyword{BlendEquationSeparate},
+         *      @fn_gl_keyword{BlendFuncSeparate}, @fn_gl_keyword{DepthFunc},
+         *      @fn_gl_keyword{DepthMask}, @fn_gl_keyword{CullFace},
+         *      @fn_gl_keyword{StencilFunc}, @fn_gl_keyword{StencilOp},
+         *      @fn_gl_keyword{StencilMask}, @fn_gl_keyword{ColorMask}
+         */
+        void apply() const;
+
+    private:
+        Renderer::BlendEquation _blendEquationRgb, _blendEquationAlpha;
+        Renderer::BlendFunction _blendSourceRgb, _blendDestinationRgb,
+            _blendSourceAlpha, _blendDestinationAlpha;
+        Renderer::DepthFunction _depthFunction;
+        Renderer::PolygonFacing _faceCullingMode;
+        Renderer::StencilFunction _stencilFunction;
+        Renderer::StencilOperation _stencilFail, _stencilDepthFail,
+            _stencilDepthPass;
+        Int _stencilReferenceValue;
+        UnsignedInt _stencilFunctionMask, _stencilMask;
+        Math::BoolVector<4> _colorMask;
+        bool _blending, _depthTest, _depthMask, _faceCulling, _stencilTest;
+};
+
+}}
+
+#endif
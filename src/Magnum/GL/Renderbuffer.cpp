@@ -31,6 +31,7 @@
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
+#include "Magnum/GL/Implementation/formatDataSize.h"
 #include "Magnum/GL/Implementation/FramebufferState.h"
 #include "Magnum/GL/Implementation/State.h"
 
@@ -85,7 +86,14 @@ void Renderbuffer::createImplementationDSA() {
 
 Renderbuffer::~Renderbuffer() {
     /* Moved out, nothing to do */
-    if(!_id || !(_flags & ObjectFlag::DeleteOnDestruction)) return;
+    if(!_id) return;
+
+    /* Remove from memory usage accounting even if the object itself isn't
+       deleted, as nothing would track it anymore */
+    if(_memoryUsage) setMemoryUsageInternal(0);
+
+    /* Not deleting on destruction, nothing else to do */
+    if(!(_flags & ObjectFlag::DeleteOnDestruction)) return;
 
     /* If bound, remove itself from state */
     GLuint& binding = Context::current().state().framebuffer->renderbufferBinding;
@@ -114,17 +122,28 @@ std::string Renderbuffer::label() {
 Renderbuffer& Renderbuffer::setLabelInternal(const Containers::ArrayView<const char> label) {
     createIfNotAlready();
     Context::current().state().debug->labelImplementation(GL_RENDERBUFFER, _id, label);
+
+    /* Move the memory usage to the category given by the label */
+    Context& context = Context::current();
+    const UnsignedInt category = context.memoryUsageCategoryInternal(label);
+    context.updateMemoryUsageInternal(&Context::MemoryUsage::renderbufferSize, _memoryCategory, _memoryUsage, category, _memoryUsage);
     return *this;
 }
 #endif
 
+void Renderbuffer::setMemoryUsageInternal(const std::size_t size) {
+    Context::current().updateMemoryUsageInternal(&Context::MemoryUsage::renderbufferSize, _memoryCategory, _memoryUsage, _memoryCategory, size);
+}
+
 void Renderbuffer::setStorage(const RenderbufferFormat internalFormat, const Vector2i& size) {
     (this->*Context::current().state().framebuffer->renderbufferStorageImplementation)(internalFormat, size);
+    setMemoryUsageInternal(Implementation::renderbufferFormatDataSize(internalFormat, size));
 }
 
 #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
 void Renderbuffer::setStorageMultisample(const Int samples, const RenderbufferFormat internalFormat, const Vector2i& size) {
     (this->*Context::current().state().framebuffer->renderbufferStorageMultisampleImplementation)(samples, internalFormat, size);
+    setMemoryUsageInternal(Implementation::renderbufferFormatDataSize(internalFormat, size)*(samples ? samples : 1));
 }
 #endif
 
@@ -167,6 +167,19 @@ class MAGNUM_GL_EXPORT Renderbuffer: public AbstractObject {
         /* MinGW complains loudly if the declaration doesn't also have inline */
         inline GLuint release();
 
+        /**
+         * @brief Estimated GPU memory usage
+         *
+         * Size of the storage allocated by the last @ref setStorage() or
+         * @ref setStorageMultisample() call, @cpp 0 @ce if no storage was
+         * allocated yet. The driver is not queried, so the value is only an
+         * estimate calculated from the internal format and sample count,
+         * counting three-component formats as padded to four components.
+         * The value is summed in @ref Context::memoryUsage().
+         * @see @ref Buffer::memoryUsage(), @ref AbstractTexture::memoryUsage()
+         */
+        std::size_t memoryUsage() const { return _memoryUsage; }
+
         #ifndef MAGNUM_TARGET_WEBGL
         /**
          * @brief Renderbuffer label
@@ -191,7 +204,9 @@ class MAGNUM_GL_EXPORT Renderbuffer: public AbstractObject {
          * Default is empty string. If OpenGL 4.3 / OpenGL ES 3.2 is not
          * supported and neither @gl_extension{KHR,debug} (covered also by
          * @gl_extension{ANDROID,extension_pack_es31a}) nor @gl_extension{EXT,debug_label}
-         * desktop or ES extension is available, this function does nothing.
+         * desktop or ES extension is available, this function does nothing,
+         * but the label is still used as a category for
+         * @ref Context::memoryUsage(const std::string&) const.
          * @see @ref maxLabelLength(), @fn_gl_keyword{ObjectLabel} or
          *      @fn_gl_extension_keyword{LabelObject,EXT,debug_label} with
          *      @def_gl{RENDERBUFFER}
@@ -262,6 +277,8 @@ class MAGNUM_GL_EXPORT Renderbuffer: public AbstractObject {
         Renderbuffer& setLabelInternal(Containers::ArrayView<const char> label);
         #endif
 
+        void setMemoryUsageInternal(std::size_t size);
+
         void MAGNUM_GL_LOCAL storageImplementationDefault(RenderbufferFormat internalFormat, const Vector2i& size);
         #ifndef MAGNUM_TARGET_GLES
         void MAGNUM_GL_LOCAL storageImplementationDSA(RenderbufferFormat internalFormat, const Vector2i& size);
@@ -283,20 +300,28 @@ class MAGNUM_GL_EXPORT Renderbuffer: public AbstractObject {
 
         GLuint _id;
         ObjectFlags _flags;
+        UnsignedInt _memoryCategory{};
+        std::size_t _memoryUsage{};
 };
 
-inline Renderbuffer::Renderbuffer(Renderbuffer&& other) noexcept: _id{other._id}, _flags{other._flags} {
+inline Renderbuffer::Renderbuffer(Renderbuffer&& other) noexcept: _id{other._id}, _flags{other._flags}, _memoryCategory{other._memoryCategory}, _memoryUsage{other._memoryUsage} {
     other._id = 0;
+    other._memoryCategory = 0;
+    other._memoryUsage = 0;
 }
 
 inline Renderbuffer& Renderbuffer::operator=(Renderbuffer&& other) noexcept {
     using std::swap;
     swap(_id, other._id);
     swap(_flags, other._flags);
+    swap(_memoryCategory, other._memoryCategory);
+    swap(_memoryUsage, other._memoryUsage);
     return *this;
 }
 
 inline GLuint Renderbuffer::release() {
+    /* The released object is not tracked anymore */
+    if(_memoryUsage) setMemoryUsageInternal(0);
     const GLuint id = _id;
     _id = 0;
     return id;
@@ -37,10 +37,12 @@ namespace Magnum { namespace GL {
 
 void Renderer::enable(const Feature feature) {
     glEnable(GLenum(feature));
+    Context::current().state().renderer->invalidateRenderState(feature);
 }
 
 void Renderer::disable(const Feature feature) {
     glDisable(GLenum(feature));
+    Context::current().state().renderer->invalidateRenderState(feature);
 }
 
 void Renderer::setFeature(const Feature feature, const bool enabled) {
@@ -75,6 +77,7 @@ void Renderer::setFrontFace(const FrontFace mode) {
 
 void Renderer::setFaceCullingMode(const PolygonFacing mode) {
     glCullFace(GLenum(mode));
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateFaceCullingMode;
 }
 
 #ifndef MAGNUM_TARGET_GLES
@@ -114,54 +117,67 @@ void Renderer::setScissor(const Range2Di& rectangle) {
 
 void Renderer::setStencilFunction(const PolygonFacing facing, const StencilFunction function, const Int referenceValue, const UnsignedInt mask) {
     glStencilFuncSeparate(GLenum(facing), GLenum(function), referenceValue, mask);
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateStencilFunction;
 }
 
 void Renderer::setStencilFunction(const StencilFunction function, const Int referenceValue, const UnsignedInt mask) {
     glStencilFunc(GLenum(function), referenceValue, mask);
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateStencilFunction;
 }
 
 void Renderer::setStencilOperation(const PolygonFacing facing, const StencilOperation stencilFail, const StencilOperation depthFail, const StencilOperation depthPass) {
     glStencilOpSeparate(GLenum(facing), GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass));
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateStencilOperation;
 }
 
 void Renderer::setStencilOperation(const StencilOperation stencilFail, const StencilOperation depthFail, const StencilOperation depthPass) {
     glStencilOp(GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass));
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateStencilOperation;
 }
 
 void Renderer::setDepthFunction(const DepthFunction function) {
     glDepthFunc(GLenum(function));
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateDepthFunction;
 }
 
 void Renderer::setColorMask(const GLboolean allowRed, const GLboolean allowGreen, const GLboolean allowBlue, const GLboolean allowAlpha) {
     glColorMask(allowRed, allowGreen, allowBlue, allowAlpha);
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateColorMask;
 }
 
 void Renderer::setDepthMask(const GLboolean allow) {
     glDepthMask(allow);
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateDepthMask;
 }
 
 void Renderer::setStencilMask(const PolygonFacing facing, const UnsignedInt allowBits) {
     glStencilMaskSeparate(GLenum(facing), allowBits);
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateStencilMask;
 }
 
 void Renderer::setStencilMask(const UnsignedInt allowBits) {
     glStencilMask(allowBits);
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateStencilMask;
 }
 
 void Renderer::setBlendEquation(const BlendEquation equation) {
     glBlendEquation(GLenum(equation));
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateBlendEquation;
 }
 
 void Renderer::setBlendEquation(const BlendEquation rgb, const BlendEquation alpha) {
     glBlendEquationSeparate(GLenum(rgb), GLenum(alpha));
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateBlendEquation;
 }
 
 void Renderer::setBlendFunction(const BlendFunction source, const BlendFunction destination) {
     glBlendFunc(GLenum(source), GLenum(destination));
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateBlendFunction;
 }
 
 void Renderer::setBlendFunction(const BlendFunction sourceRgb, const BlendFunction destinationRgb, const BlendFunction sourceAlpha, const BlendFunction destinationAlpha) {
     glBlendFuncSeparate(GLenum(sourceRgb), GLenum(destinationRgb), GLenum(sourceAlpha), GLenum(destinationAlpha));
+    Context::current().state().renderer->renderStateUnknown |= Implementation::RendererState::RenderStateBlendFunction;
 }
 
 void Renderer::setBlendColor(const Color4& color) {
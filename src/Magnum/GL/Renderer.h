@@ -43,6 +43,10 @@ namespace Implementation { struct RendererState; }
 /** @nosubgrouping
 @brief Global renderer configuration.
 
+Each function results in a GL call. For setting blending, depth, face culling,
+stencil and write mask state for many drawables, @ref RenderState emits only
+the calls for state that actually changed.
+
 @todo @gl_extension{ARB,viewport_array}
 @todo `GL_POINT_SIZE_GRANULARITY`, `GL_POINT_SIZE_RANGE` (?)
 @todo `GL_STEREO`, `GL_DOUBLEBUFFER` (?)
@@ -1347,7 +1351,7 @@ class MAGNUM_GL_EXPORT Renderer {
              *      3.0 and older.
              * @requires_gles Shader storage is not available in WebGL.
              */
-            ShaderStorage = GL_ATOMIC_COUNTER_BARRIER_BIT
+            ShaderStorage = GL_SHADER_STORAGE_BARRIER_BIT
         };
 
         /**
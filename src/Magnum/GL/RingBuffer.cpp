@@ -0,0 +1,138 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RingBuffer.h"
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+
+namespace Magnum { namespace GL {
+
+RingBuffer::RingBuffer(const std::size_t frameSize, const UnsignedInt frameCount, const Buffer::TargetHint targetHint): _buffer{targetHint}, _frameSize{frameSize}, _used{}, _flushed{}, _frameCount{frameCount}, _current{}, _persistent{} {
+    CORRADE_ASSERT(frameSize && frameCount,
+        "GL::RingBuffer: expected non-zero frame size and count", );
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>()) {
+        _persistent = true;
+        _buffer.setStorage({nullptr, frameSize*frameCount}, Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent|Buffer::StorageFlag::MapCoherent);
+        _mapped = _buffer.map(0, frameSize*frameCount, Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::Coherent);
+        _fences.reserve(frameCount);
+        for(UnsignedInt i = 0; i != frameCount; ++i)
+            _fences.emplace_back(NoCreate);
+    } else
+    #endif
+    {
+        _buffer.setData({nullptr, frameSize*frameCount}, BufferUsage::DynamicDraw);
+        _staging = Containers::Array<char>{frameSize};
+    }
+}
+
+RingBuffer::RingBuffer(NoCreateT) noexcept: _buffer{NoCreate}, _frameSize{}, _used{}, _flushed{}, _frameCount{}, _current{}, _persistent{} {}
+
+RingBuffer::RingBuffer(RingBuffer&& other) noexcept: _buffer{std::move(other._buffer)}, _frameSize{other._frameSize}, _used{other._used}, _flushed{other._flushed}, _frameCount{other._frameCount}, _current{other._current}, _persistent{other._persistent}, _mapped{other._mapped}, _staging{std::move(other._staging)}
+    #ifndef MAGNUM_TARGET_GLES
+    , _fences{std::move(other._fences)}
+    #endif
+{
+    other._frameSize = other._used = other._flushed = 0;
+    other._frameCount = other._current = 0;
+    other._persistent = false;
+    other._mapped = nullptr;
+}
+
+RingBuffer::~RingBuffer() = default;
+
+RingBuffer& RingBuffer::operator=(RingBuffer&& other) noexcept {
+    using std::swap;
+    swap(_buffer, other._buffer);
+    swap(_frameSize, other._frameSize);
+    swap(_used, other._used);
+    swap(_flushed, other._flushed);
+    swap(_frameCount, other._frameCount);
+    swap(_current, other._current);
+    swap(_persistent, other._persistent);
+    swap(_mapped, other._mapped);
+    swap(_staging, other._staging);
+    #ifndef MAGNUM_TARGET_GLES
+    swap(_fences, other._fences);
+    #endif
+    return *this;
+}
+
+std::pair<GLintptr, Containers::ArrayView<char>> RingBuffer::allocate(const std::size_t size, const std::size_t alignment) {
+    CORRADE_ASSERT(alignment, "GL::RingBuffer::allocate(): expected non-zero alignment", {});
+
+    /* Align the absolute offset in the buffer, as that's what gets passed to
+       the GL */
+    const std::size_t frameOffset = _current*_frameSize;
+    const std::size_t offset = (frameOffset + _used + alignment - 1)/alignment*alignment - frameOffset;
+    if(!size || offset > _frameSize || size > _frameSize - offset) return {};
+
+    _used = offset + size;
+    if(_persistent)
+        return {GLintptr(frameOffset + offset), _mapped.slice(frameOffset + offset, frameOffset + offset + size)};
+    return {GLintptr(frameOffset + offset), _staging.slice(offset, offset + size)};
+}
+
+RingBuffer& RingBuffer::flush() {
+    /* With coherent persistent mapping the writes are visible to the GPU
+       already */
+    if(_persistent || _flushed == _used) return *this;
+
+    _buffer.setSubData(_current*_frameSize + _flushed, _staging.slice(_flushed, _used));
+    _flushed = _used;
+    return *this;
+}
+
+void RingBuffer::endFrame() {
+    /* Moved-out or NoCreate'd instance, nothing to do */
+    if(!_frameCount) return;
+
+    flush();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(_persistent) _fences[_current].insert();
+    #endif
+
+    _current = (_current + 1) % _frameCount;
+    _used = _flushed = 0;
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* Wait until the GPU is done with the next frame part. Flush the command
+       queue on the first try so the fence is guaranteed to signal
+       eventually, then just keep waiting. */
+    if(_persistent && _fences[_current].id()) {
+        Fence& fence = _fences[_current];
+        Fence::ClientWaitFlags flags = Fence::ClientWaitFlag::FlushCommands;
+        while(fence.clientWait(1000000000ull, flags) == Fence::WaitResult::TimeoutExpired)
+            flags = {};
+
+        fence = Fence{NoCreate};
+    }
+    #endif
+}
+
+}}
@@ -0,0 +1,221 @@
+#ifndef Magnum_GL_RingBuffer_h
+#define Magnum_GL_RingBuffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::GL::RingBuffer
+ */
+
+#include <utility>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/GL/Buffer.h"
+#ifndef MAGNUM_TARGET_GLES
+#include <vector>
+
+#include "Magnum/GL/Fence.h"
+#endif
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Ring buffer for per-frame dynamic data
+
+Allocates buffer storage for @ref frameCount() frames once and hands out
+aligned sub-allocations from the part belonging to the current frame. Useful
+for data that change every frame, such as dynamic text, particles or UI
+vertices and uniforms, which would otherwise need @ref Buffer::setData() each
+frame, causing reallocations in the driver.
+
+@section GL-RingBuffer-usage Usage
+
+Each @ref allocate() returns an offset into @ref buffer() together with a view
+on the memory to write to. After writing all data and before drawing
+from them call @ref flush(), at the end of the frame call @ref endFrame() to
+advance to the part belonging to the next frame:
+
+@code{.cpp}
+GL::RingBuffer ring{1024*1024};
+mesh.addVertexBuffer(ring.buffer(), 0, Position{}, TextureCoordinates{});
+
+GLintptr offset;
+Containers::ArrayView<char> data;
+std::tie(offset, data) = ring.allocate(vertexCount*sizeof(Vertex));
+if(data) {
+    fillVertices(Containers::arrayCast<Vertex>(data));
+    ring.flush();
+
+    mesh.setBaseVertex(offset/sizeof(Vertex))
+        .setCount(vertexCount)
+        .draw(shader);
+}
+
+// ...
+
+ring.endFrame();
+@endcode
+
+If there's not enough space left in the current frame, an empty view is
+returned. Offsets used for binding uniform buffer ranges have to be aligned
+to @ref Buffer::uniformOffsetAlignment(), pass it as the second argument to
+@ref allocate() in that case.
+
+@section GL-RingBuffer-performance Performance optimizations
+
+If @gl_extension{ARB,buffer_storage} (part of OpenGL 4.4) is available, the
+storage is allocated using @ref Buffer::setStorage() and stays persistently
+mapped using @ref Buffer::MapFlag::Persistent and @ref Buffer::MapFlag::Coherent
+for the whole lifetime of the ring, so the returned memory is written directly
+and @ref flush() does nothing. Each @ref endFrame() places a fence and the
+part of a frame is reused only after its fence signals, so the CPU waits only
+if the GPU is more than @ref frameCount() frames behind.
+
+Otherwise the data are written into a client-side staging memory and
+@ref flush() copies the part written since last flush using
+@ref Buffer::setSubData(). As the updated range is not used by the GPU at
+that point, the driver doesn't need to reallocate the storage.
+@see @ref isPersistent(), @ref TextureUploader
+*/
+class MAGNUM_GL_EXPORT RingBuffer {
+    public:
+        /**
+         * @brief Constructor
+         * @param frameSize     Size of the part for each frame in bytes
+         * @param frameCount    Count of frames in the ring
+         * @param targetHint    Target hint for the buffer
+         *
+         * Expects that both @p frameSize and @p frameCount are non-zero.
+         * Allocates a buffer of @cpp frameSize*frameCount @ce bytes.
+         * @see @ref RingBuffer(NoCreateT), @ref Buffer::setTargetHint()
+         */
+        explicit RingBuffer(std::size_t frameSize, UnsignedInt frameCount = 3, Buffer::TargetHint targetHint = Buffer::TargetHint::Array);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * @see @ref RingBuffer(std::size_t, UnsignedInt, Buffer::TargetHint)
+         */
+        explicit RingBuffer(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        RingBuffer(const RingBuffer&) = delete;
+
+        /** @brief Move constructor */
+        RingBuffer(RingBuffer&& other) noexcept;
+
+        /** @brief Destructor */
+        ~RingBuffer();
+
+        /** @brief Copying is not allowed */
+        RingBuffer& operator=(const RingBuffer&) = delete;
+
+        /** @brief Move assignment */
+        RingBuffer& operator=(RingBuffer&& other) noexcept;
+
+        /** @brief Underlying buffer */
+        Buffer& buffer() { return _buffer; }
+
+        /** @brief Size of the part for each frame in bytes */
+        std::size_t frameSize() const { return _frameSize; }
+
+        /** @brief Count of frames in the ring */
+        UnsignedInt frameCount() const { return _frameCount; }
+
+        /**
+         * @brief Whether the buffer is persistently mapped
+         *
+         * Returns @cpp true @ce if @gl_extension{ARB,buffer_storage} is
+         * available, @cpp false @ce otherwise. See
+         * @ref GL-RingBuffer-performance for more information.
+         */
+        bool isPersistent() const { return _persistent; }
+
+        /** @brief Offset of the current frame part in the buffer */
+        GLintptr frameOffset() const { return GLintptr(_current*_frameSize); }
+
+        /**
+         * @brief Space remaining in the current frame
+         *
+         * Doesn't include alignment padding of subsequent allocations.
+         */
+        std::size_t remaining() const { return _frameSize - _used; }
+
+        /**
+         * @brief Allocate memory in the current frame
+         * @param size          Size in bytes
+         * @param alignment     Alignment of the offset in the buffer
+         * @return Offset in @ref buffer() and a view on the memory to write
+         *      to. If there's not enough space left in the current frame,
+         *      returns @cpp 0 @ce and an empty view.
+         *
+         * Expects that @p alignment is non-zero. The memory has to be
+         * written before the next @ref flush() and the returned memory is
+         * write-only.
+         */
+        std::pair<GLintptr, Containers::ArrayView<char>> allocate(std::size_t size, std::size_t alignment = 4);
+
+        /**
+         * @brief Make written data visible to the GPU
+         * @return Reference to self (for method chaining)
+         *
+         * Has to be called after writing to the allocated memory and before
+         * the data are used by the GPU. If the buffer is persistently mapped,
+         * this function does nothing, otherwise the memory allocated since
+         * the last flush is uploaded using @ref Buffer::setSubData().
+         */
+        RingBuffer& flush();
+
+        /**
+         * @brief End the frame
+         *
+         * Calls @ref flush(), places a fence after the commands using the
+         * current frame part and advances to the next one, waiting for its
+         * fence if the GPU didn't consume it yet.
+         * @see @fn_gl_keyword{FenceSync}, @fn_gl_keyword{ClientWaitSync}
+         */
+        void endFrame();
+
+    private:
+        Buffer _buffer;
+        std::size_t _frameSize, _used, _flushed;
+        UnsignedInt _frameCount, _current;
+        bool _persistent;
+        Containers::ArrayView<char> _mapped;
+        Containers::Array<char> _staging;
+        #ifndef MAGNUM_TARGET_GLES
+        std::vector<Fence> _fences;
+        #endif
+};
+
+}}
+
+#endif
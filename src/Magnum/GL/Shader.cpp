@@ -747,13 +747,16 @@ Shader& Shader::addFile(const std::string& filename) {
 }
 
 bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
-    bool allSuccess = true;
+    submitCompile(shaders);
+    return checkCompile(shaders);
+}
 
+void Shader::submitCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
     /* Allocate large enough array for source pointers and sizes (to avoid
        reallocating it for each of them) */
     std::size_t maxSourceCount = 0;
     for(Shader& shader: shaders) {
-        CORRADE_ASSERT(shader._sources.size() > 1, "GL::Shader::compile(): no files added", false);
+        CORRADE_ASSERT(shader._sources.size() > 1, "GL::Shader::submitCompile(): no files added", );
         maxSourceCount = std::max(shader._sources.size(), maxSourceCount);
     }
     /** @todo ArrayTuple/VLAs */
@@ -772,6 +775,10 @@ bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shade
 
     /* Invoke (possibly parallel) compilation on all shaders */
     for(Shader& shader: shaders) glCompileShader(shader._id);
+}
+
+bool Shader::checkCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
+    bool allSuccess = true;
 
     /* After compilation phase, check status of all shaders */
     Int i = 1;
@@ -810,6 +817,27 @@ bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shade
     return allSuccess;
 }
 
+#ifndef MAGNUM_TARGET_WEBGL
+void Shader::setMaxCompilerThreads(const UnsignedInt count) {
+    if(Context::current().isExtensionSupported<Extensions::KHR::parallel_shader_compile>())
+        glMaxShaderCompilerThreadsKHR(count);
+}
+#endif
+
+bool Shader::isCompileFinished() {
+    return (this->*Context::current().state().shader->isCompileFinishedImplementation)();
+}
+
+bool Shader::isCompileFinishedImplementationNoOp() { return true; }
+
+#ifndef MAGNUM_TARGET_WEBGL
+bool Shader::isCompileFinishedImplementationKHR() {
+    GLint finished;
+    glGetShaderiv(_id, GL_COMPLETION_STATUS_KHR, &finished);
+    return finished == GL_TRUE;
+}
+#endif
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 Debug& operator<<(Debug& debug, const Shader::Type value) {
     switch(value) {
@@ -500,6 +500,65 @@ class MAGNUM_GL_EXPORT Shader: public AbstractObject {
          */
         static bool compile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
 
+        /**
+         * @brief Submit multiple shaders for compilation
+         *
+         * Uploads sources of all @p shaders and submits them for compilation,
+         * without waiting for the result. Together with
+         * @ref isCompileFinished() and @ref checkCompile(std::initializer_list<std::reference_wrapper<Shader>>)
+         * this allows the compilation to happen in the background, for
+         * example while a loading screen is being rendered:
+         *
+         * @code{.cpp}
+         * GL::Shader::submitCompile({vert, frag});
+         *
+         * // ... render frames until both vert.isCompileFinished() and
+         * // frag.isCompileFinished() return true
+         *
+         * CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::checkCompile({vert, frag}));
+         * @endcode
+         *
+         * Calling @ref compile(std::initializer_list<std::reference_wrapper<Shader>>)
+         * is equivalent to calling this function followed by
+         * @ref checkCompile(std::initializer_list<std::reference_wrapper<Shader>>).
+         * @see @ref setMaxCompilerThreads(), @fn_gl_keyword{ShaderSource},
+         *      @fn_gl_keyword{CompileShader}
+         */
+        static void submitCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
+
+        /**
+         * @brief Check compilation status of multiple shaders
+         *
+         * Expects that the shaders were submitted for compilation using
+         * @ref submitCompile(std::initializer_list<std::reference_wrapper<Shader>>).
+         * Returns @cpp false @ce if compilation of any shader failed,
+         * @cpp true @ce if everything succeeded. Compiler messages (if any)
+         * are printed to error output. If the compilation is not finished
+         * yet, the function blocks until it is.
+         * @see @ref isCompileFinished(), @fn_gl_keyword{GetShader} with
+         *      @def_gl{COMPILE_STATUS} and @def_gl{INFO_LOG_LENGTH},
+         *      @fn_gl_keyword{GetShaderInfoLog}
+         */
+        static bool checkCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
+
+        #ifndef MAGNUM_TARGET_WEBGL
+        /**
+         * @brief Set max count of threads used for shader compilation
+         *
+         * Value of @cpp 0 @ce disables the parallel compilation, value of
+         * @cpp 0xffffffffu @ce lets the driver decide the thread count. If
+         * @gl_extension{KHR,parallel_shader_compile} is not available, the
+         * function does nothing. This is a global setting affecting all
+         * shaders and programs in the context.
+         * @see @ref isCompileFinished(),
+         *      @ref AbstractShaderProgram::isLinkFinished(),
+         *      @fn_gl_extension_keyword{MaxShaderCompilerThreads,KHR,parallel_shader_compile}
+         * @requires_gles Parallel shader compilation is not available in
+         *      WebGL.
+         */
+        static void setMaxCompilerThreads(UnsignedInt count);
+        #endif
+
         /**
          * @brief Constructor
          * @param version   Target version
@@ -616,10 +675,47 @@ class MAGNUM_GL_EXPORT Shader: public AbstractObject {
          */
         bool compile() { return compile({*this}); }
 
+        /**
+         * @brief Submit shader for compilation
+         *
+         * Submits single shader. See
+         * @ref submitCompile(std::initializer_list<std::reference_wrapper<Shader>>)
+         * for more information.
+         */
+        void submitCompile() { submitCompile({*this}); }
+
+        /**
+         * @brief Whether compilation has finished
+         *
+         * Returns @cpp true @ce if the driver finished compiling the shader
+         * submitted using @ref submitCompile(), in which case
+         * @ref checkCompile() doesn't block. Note that the result says
+         * nothing about the compilation success. If
+         * @gl_extension{KHR,parallel_shader_compile} is not available,
+         * always returns @cpp true @ce, the compilation is then finished on
+         * the call to @ref checkCompile().
+         * @see @fn_gl_keyword{GetShader} with @def_gl{COMPLETION_STATUS_KHR}
+         */
+        bool isCompileFinished();
+
+        /**
+         * @brief Check shader compilation status
+         *
+         * Checks single shader. See
+         * @ref checkCompile(std::initializer_list<std::reference_wrapper<Shader>>)
+         * for more information.
+         */
+        bool checkCompile() { return checkCompile({*this}); }
+
     private:
         Shader& setLabelInternal(Containers::ArrayView<const char> label);
 
         void MAGNUM_GL_LOCAL addSourceImplementationDefault(std::string source);
+
+        bool MAGNUM_GL_LOCAL isCompileFinishedImplementationNoOp();
+        #ifndef MAGNUM_TARGET_WEBGL
+        bool MAGNUM_GL_LOCAL isCompileFinishedImplementationKHR();
+        #endif
         #if defined(CORRADE_TARGET_EMSCRIPTEN) && defined(__EMSCRIPTEN_PTHREADS__)
         void MAGNUM_GL_LOCAL addSourceImplementationEmscriptenPthread(std::string source);
         #endif
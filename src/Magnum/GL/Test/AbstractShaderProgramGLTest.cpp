@@ -62,6 +62,7 @@ struct AbstractShaderProgramGLTest: OpenGLTester {
     #endif
 
     void linkFailure();
+    void linkAsync();
     void uniformNotFound();
 
     void uniform();
@@ -99,6 +100,7 @@ AbstractShaderProgramGLTest::AbstractShaderProgramGLTest() {
               #endif
 
               &AbstractShaderProgramGLTest::linkFailure,
+              &AbstractShaderProgramGLTest::linkAsync,
               &AbstractShaderProgramGLTest::uniformNotFound,
 
               &AbstractShaderProgramGLTest::uniform,
@@ -188,6 +190,8 @@ namespace {
         using AbstractShaderProgram::bindFragmentDataLocation;
         #endif
         using AbstractShaderProgram::link;
+        using AbstractShaderProgram::submitLink;
+        using AbstractShaderProgram::checkLink;
         using AbstractShaderProgram::uniformLocation;
         #ifndef MAGNUM_TARGET_GLES2
         using AbstractShaderProgram::uniformBlockIndex;
@@ -388,6 +392,55 @@ void AbstractShaderProgramGLTest::linkFailure() {
     CORRADE_VERIFY(!program.link());
 }
 
+void AbstractShaderProgramGLTest::linkAsync() {
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(!Context::current().isExtensionSupported<Extensions::KHR::parallel_shader_compile>())
+        Debug() << Extensions::KHR::parallel_shader_compile::string() << "not supported, linking will be blocking";
+    #endif
+
+    Utility::Resource rs("AbstractShaderProgramGLTest");
+
+    Shader vert(
+        #ifndef MAGNUM_TARGET_GLES
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        #else
+        Version::GLES200
+        #endif
+        , Shader::Type::Vertex);
+    vert.addSource(rs.get("MyShader.vert"));
+
+    Shader frag(
+        #ifndef MAGNUM_TARGET_GLES
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        #else
+        Version::GLES200
+        #endif
+        , Shader::Type::Fragment);
+    frag.addSource(rs.get("MyShader.frag"));
+
+    Shader::submitCompile({vert, frag});
+    while(!vert.isCompileFinished() || !frag.isCompileFinished()) {}
+    CORRADE_VERIFY(Shader::checkCompile({vert, frag}));
+
+    MyPublicShader program;
+    program.attachShaders({vert, frag});
+    program.bindAttributeLocation(0, "position");
+    program.submitLink();
+    while(!program.isLinkFinished()) {}
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(program.checkLink());
+    CORRADE_VERIFY(program.uniformLocation("matrix") >= 0);
+}
+
 void AbstractShaderProgramGLTest::uniformNotFound() {
     MyPublicShader program;
 
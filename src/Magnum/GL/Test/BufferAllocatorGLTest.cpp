@@ -0,0 +1,265 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/GL/BufferAllocator.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct BufferAllocatorGLTest: OpenGLTester {
+    explicit BufferAllocatorGLTest();
+
+    void construct();
+    void constructMove();
+
+    void allocate();
+    void allocateAligned();
+    void allocateLargerThanBlock();
+    void deallocateMerge();
+    void upload();
+    #ifndef MAGNUM_TARGET_GLES2
+    void defragment();
+    #endif
+};
+
+BufferAllocatorGLTest::BufferAllocatorGLTest() {
+    addTests({&BufferAllocatorGLTest::construct,
+              &BufferAllocatorGLTest::constructMove,
+
+              &BufferAllocatorGLTest::allocate,
+              &BufferAllocatorGLTest::allocateAligned,
+              &BufferAllocatorGLTest::allocateLargerThanBlock,
+              &BufferAllocatorGLTest::deallocateMerge,
+              &BufferAllocatorGLTest::upload,
+              #ifndef MAGNUM_TARGET_GLES2
+              &BufferAllocatorGLTest::defragment
+              #endif
+              });
+}
+
+void BufferAllocatorGLTest::construct() {
+    {
+        BufferAllocator allocator{64, Buffer::TargetHint::ElementArray};
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_COMPARE(allocator.blockSize(), 64);
+        CORRADE_COMPARE(allocator.bufferCount(), 0);
+
+        allocator.allocate(16);
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        CORRADE_COMPARE(allocator.bufferCount(), 1);
+        CORRADE_VERIFY(allocator.buffer(0).id() > 0);
+        CORRADE_COMPARE(allocator.buffer(0).targetHint(), Buffer::TargetHint::ElementArray);
+        CORRADE_COMPARE(allocator.buffer(0).size(), 64);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void BufferAllocatorGLTest::constructMove() {
+    BufferAllocator a{64};
+    a.allocate(16);
+    const Int id = a.buffer(0).id();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    BufferAllocator b{std::move(a)};
+    CORRADE_COMPARE(a.blockSize(), 0);
+    CORRADE_COMPARE(a.bufferCount(), 0);
+    CORRADE_COMPARE(b.blockSize(), 64);
+    CORRADE_COMPARE(b.bufferCount(), 1);
+    CORRADE_COMPARE(b.buffer(0).id(), id);
+
+    BufferAllocator c{32};
+    c = std::move(b);
+    CORRADE_COMPARE(b.blockSize(), 32);
+    CORRADE_COMPARE(b.bufferCount(), 0);
+    CORRADE_COMPARE(c.blockSize(), 64);
+    CORRADE_COMPARE(c.buffer(0).id(), id);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void BufferAllocatorGLTest::allocate() {
+    BufferAllocator allocator{64};
+
+    BufferAllocator::Allocation a = allocator.allocate(24);
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a.buffer, 0);
+    CORRADE_COMPARE(a.offset, 0);
+    CORRADE_COMPARE(a.size, 24);
+
+    BufferAllocator::Allocation b = allocator.allocate(32);
+    CORRADE_COMPARE(b.buffer, 0);
+    CORRADE_COMPARE(b.offset, 24);
+
+    /* Doesn't fit into the remaining 8 bytes, goes to a new buffer */
+    BufferAllocator::Allocation c = allocator.allocate(12);
+    CORRADE_COMPARE(c.buffer, 1);
+    CORRADE_COMPARE(c.offset, 0);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* But this one does */
+    BufferAllocator::Allocation d = allocator.allocate(8);
+    CORRADE_COMPARE(d.buffer, 0);
+    CORRADE_COMPARE(d.offset, 56);
+
+    /* Zero-sized allocation is invalid */
+    CORRADE_VERIFY(!allocator.allocate(0));
+
+    BufferAllocator::Statistics statistics = allocator.statistics();
+    CORRADE_COMPARE(statistics.bufferCount, 2);
+    CORRADE_COMPARE(statistics.allocationCount, 4);
+    CORRADE_COMPARE(statistics.capacity, 128);
+    CORRADE_COMPARE(statistics.usedSize, 76);
+    CORRADE_COMPARE(statistics.freeRangeCount, 1);
+    CORRADE_COMPARE(statistics.largestFreeRange, 52);
+}
+
+void BufferAllocatorGLTest::allocateAligned() {
+    BufferAllocator allocator{256};
+
+    allocator.allocate(3);
+    BufferAllocator::Allocation a = allocator.allocate(16, 64);
+    CORRADE_COMPARE(a.offset, 64);
+
+    /* The padding before is reused for a smaller allocation */
+    BufferAllocator::Allocation b = allocator.allocate(8, 4);
+    CORRADE_COMPARE(b.buffer, 0);
+    CORRADE_COMPARE(b.offset, 4);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void BufferAllocatorGLTest::allocateLargerThanBlock() {
+    BufferAllocator allocator{64};
+
+    BufferAllocator::Allocation a = allocator.allocate(100);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(a.buffer, 0);
+    CORRADE_COMPARE(a.offset, 0);
+    CORRADE_COMPARE(allocator.buffer(0).size(), 100);
+    CORRADE_COMPARE(allocator.statistics().capacity, 100);
+}
+
+void BufferAllocatorGLTest::deallocateMerge() {
+    BufferAllocator allocator{64};
+
+    BufferAllocator::Allocation a = allocator.allocate(16);
+    BufferAllocator::Allocation b = allocator.allocate(16);
+    BufferAllocator::Allocation c = allocator.allocate(16);
+    CORRADE_COMPARE(allocator.statistics().freeRangeCount, 1);
+
+    allocator.deallocate(a);
+    allocator.deallocate(c);
+    CORRADE_COMPARE(allocator.statistics().freeRangeCount, 2);
+
+    /* Freeing the middle one merges everything back */
+    allocator.deallocate(b);
+    BufferAllocator::Statistics statistics = allocator.statistics();
+    CORRADE_COMPARE(statistics.allocationCount, 0);
+    CORRADE_COMPARE(statistics.usedSize, 0);
+    CORRADE_COMPARE(statistics.freeRangeCount, 1);
+    CORRADE_COMPARE(statistics.largestFreeRange, 64);
+
+    /* The whole buffer can be allocated again */
+    BufferAllocator::Allocation d = allocator.allocate(64);
+    CORRADE_COMPARE(d.buffer, 0);
+    CORRADE_COMPARE(allocator.bufferCount(), 1);
+}
+
+void BufferAllocatorGLTest::upload() {
+    BufferAllocator allocator{64};
+    allocator.allocate(4);
+
+    const Int data[]{2, 7, -1, 5};
+    BufferAllocator::Allocation a = allocator.upload(data);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(a.offset, 4);
+    CORRADE_COMPARE(a.size, 16);
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    auto contents = allocator.buffer(0).subData(4, 16);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(Containers::arrayCast<Int>(contents),
+        Containers::arrayView(data),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void BufferAllocatorGLTest::defragment() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::copy_buffer>())
+        CORRADE_SKIP(Extensions::ARB::copy_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    BufferAllocator allocator{64};
+
+    const Int first[]{1, 2, 3, 4};
+    const Int second[]{5, 6, 7, 8};
+    const Int third[]{9, 10, 11, 12};
+    BufferAllocator::Allocation a = allocator.upload(first);
+    BufferAllocator::Allocation b = allocator.upload(second);
+    BufferAllocator::Allocation c = allocator.upload(third);
+    allocator.deallocate(a);
+    allocator.deallocate(b);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(allocator.statistics().freeRangeCount, 2);
+
+    std::vector<BufferAllocator::Relocation> relocations = allocator.defragment();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(relocations.size(), 1);
+    CORRADE_COMPARE(relocations[0].from.offset, c.offset);
+    CORRADE_COMPARE(relocations[0].to.buffer, 0);
+    CORRADE_COMPARE(relocations[0].to.offset, 0);
+    CORRADE_COMPARE(relocations[0].to.size, 16);
+
+    BufferAllocator::Statistics statistics = allocator.statistics();
+    CORRADE_COMPARE(statistics.allocationCount, 1);
+    CORRADE_COMPARE(statistics.freeRangeCount, 1);
+    CORRADE_COMPARE(statistics.largestFreeRange, 48);
+
+    /* Nothing more to do */
+    CORRADE_VERIFY(allocator.defragment().empty());
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    auto contents = allocator.buffer(0).subData(0, 16);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(Containers::arrayCast<Int>(contents),
+        Containers::arrayView(third),
+        TestSuite::Compare::Container);
+    #endif
+}
+#endif
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::BufferAllocatorGLTest)
@@ -0,0 +1,106 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/GL/BufferAllocator.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct BufferAllocatorTest: TestSuite::Tester {
+    explicit BufferAllocatorTest();
+
+    void constructNoCreate();
+    void constructCopy();
+
+    void allocateNoCreate();
+    void allocateZeroAlignment();
+    void deallocateInvalid();
+};
+
+BufferAllocatorTest::BufferAllocatorTest() {
+    addTests({&BufferAllocatorTest::constructNoCreate,
+              &BufferAllocatorTest::constructCopy,
+
+              &BufferAllocatorTest::allocateNoCreate,
+              &BufferAllocatorTest::allocateZeroAlignment,
+              &BufferAllocatorTest::deallocateInvalid});
+}
+
+void BufferAllocatorTest::constructNoCreate() {
+    {
+        BufferAllocator allocator{NoCreate};
+        CORRADE_COMPARE(allocator.blockSize(), 0);
+        CORRADE_COMPARE(allocator.bufferCount(), 0);
+
+        BufferAllocator::Statistics statistics = allocator.statistics();
+        CORRADE_COMPARE(statistics.bufferCount, 0);
+        CORRADE_COMPARE(statistics.capacity, 0);
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void BufferAllocatorTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<BufferAllocator, const BufferAllocator&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<BufferAllocator, const BufferAllocator&>{}));
+}
+
+void BufferAllocatorTest::allocateNoCreate() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    BufferAllocator allocator{NoCreate};
+    CORRADE_VERIFY(!allocator.allocate(16));
+    CORRADE_COMPARE(out.str(), "GL::BufferAllocator::allocate(): the allocator is moved-out or not created\n");
+}
+
+void BufferAllocatorTest::allocateZeroAlignment() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    BufferAllocator allocator{NoCreate};
+    allocator.allocate(16, 0);
+    CORRADE_COMPARE(out.str(), "GL::BufferAllocator::allocate(): expected non-zero alignment\n");
+}
+
+void BufferAllocatorTest::deallocateInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    BufferAllocator allocator{NoCreate};
+
+    /* Invalid allocations are ignored */
+    allocator.deallocate({});
+    CORRADE_COMPARE(out.str(), "");
+
+    allocator.deallocate({1, 16, 32});
+    CORRADE_COMPARE(out.str(), "GL::BufferAllocator::deallocate(): buffer index 1 out of range for 0 buffers\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::BufferAllocatorTest)
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <Corrade/Containers/Array.h>
@@ -52,15 +53,26 @@ struct BufferGLTest: OpenGLTester {
     #endif
 
     void data();
+    #ifndef MAGNUM_TARGET_GLES
+    void storage();
+    #endif
     #ifndef MAGNUM_TARGET_WEBGL
     void map();
     void mapRange();
     void mapRangeExplicitFlush();
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    void mapPersistent();
+    #endif
     #ifndef MAGNUM_TARGET_GLES2
     void copy();
     #endif
     void invalidate();
+
+    void memoryUsage();
+    #ifndef MAGNUM_TARGET_WEBGL
+    void memoryUsageCategory();
+    #endif
 };
 
 BufferGLTest::BufferGLTest() {
@@ -78,15 +90,27 @@ BufferGLTest::BufferGLTest() {
               #endif
 
               &BufferGLTest::data,
+              #ifndef MAGNUM_TARGET_GLES
+              &BufferGLTest::storage,
+              #endif
               #ifndef MAGNUM_TARGET_WEBGL
               &BufferGLTest::map,
               &BufferGLTest::mapRange,
               &BufferGLTest::mapRangeExplicitFlush,
               #endif
+              #ifndef MAGNUM_TARGET_GLES
+              &BufferGLTest::mapPersistent,
+              #endif
               #ifndef MAGNUM_TARGET_GLES2
               &BufferGLTest::copy,
               #endif
-              &BufferGLTest::invalidate});
+              &BufferGLTest::invalidate,
+
+              &BufferGLTest::memoryUsage,
+              #ifndef MAGNUM_TARGET_WEBGL
+              &BufferGLTest::memoryUsageCategory
+              #endif
+              });
 }
 
 void BufferGLTest::construct() {
@@ -265,6 +289,28 @@ void BufferGLTest::data() {
     #endif
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void BufferGLTest::storage() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>())
+        CORRADE_SKIP(Extensions::ARB::buffer_storage::string() + std::string(" is not supported"));
+
+    constexpr Int data[] = {2, 7, 5, 13, 25};
+    Buffer buffer;
+    buffer.setStorage(data, Buffer::StorageFlag::DynamicStorage);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(buffer.size(), 5*4);
+
+    constexpr Int subData[] = {125, 3, 15};
+    buffer.setSubData(4, {subData, 3});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    constexpr Int expected[] = {2, 125, 3, 15, 25};
+    CORRADE_COMPARE_AS(Containers::arrayCast<Int>(buffer.data()),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+#endif
+
 #ifndef MAGNUM_TARGET_WEBGL
 void BufferGLTest::map() {
     #ifdef MAGNUM_TARGET_GLES
@@ -375,6 +421,32 @@ void BufferGLTest::mapRangeExplicitFlush() {
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void BufferGLTest::mapPersistent() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>())
+        CORRADE_SKIP(Extensions::ARB::buffer_storage::string() + std::string(" is not supported"));
+
+    constexpr char data[] = {2, 7, 5, 13, 25};
+    Buffer buffer;
+    buffer.setStorage(data, Buffer::StorageFlag::MapRead|Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent|Buffer::StorageFlag::MapCoherent);
+
+    Containers::ArrayView<char> contents = buffer.map(0, 5, Buffer::MapFlag::Read|Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::Coherent);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(contents);
+    CORRADE_COMPARE(contents[3], 13);
+    contents[4] = 107;
+
+    /* The buffer can be read while still mapped */
+    Containers::Array<char> changedContents = buffer.data();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(changedContents.size(), 5);
+    CORRADE_COMPARE(changedContents[4], 107);
+
+    CORRADE_VERIFY(buffer.unmap());
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+#endif
+
 #ifndef MAGNUM_TARGET_GLES2
 void BufferGLTest::copy() {
     Buffer buffer1;
@@ -410,6 +482,68 @@ void BufferGLTest::invalidate() {
     MAGNUM_VERIFY_NO_GL_ERROR();
 }
 
+void BufferGLTest::memoryUsage() {
+    const std::uint64_t usage = Context::current().memoryUsage().bufferSize;
+
+    {
+        Buffer buffer;
+        CORRADE_COMPARE(buffer.memoryUsage(), 0);
+
+        constexpr Int data[] = {2, 7, 5, 13, 25};
+        buffer.setData({data, 5}, BufferUsage::StaticDraw);
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        CORRADE_COMPARE(buffer.memoryUsage(), 5*4);
+        CORRADE_COMPARE(Context::current().memoryUsage().bufferSize, usage + 5*4);
+
+        /* Reallocation replaces the previous size, updating the data doesn't
+           change anything */
+        buffer.setData({nullptr, 8}, BufferUsage::StaticDraw);
+        buffer.setSubData(0, {data, 2});
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        CORRADE_COMPARE(buffer.memoryUsage(), 8);
+        CORRADE_COMPARE(Context::current().memoryUsage().bufferSize, usage + 8);
+
+        /* Moving transfers the size */
+        Buffer moved{std::move(buffer)};
+        CORRADE_COMPARE(buffer.memoryUsage(), 0);
+        CORRADE_COMPARE(moved.memoryUsage(), 8);
+        CORRADE_COMPARE(Context::current().memoryUsage().bufferSize, usage + 8);
+    }
+
+    /* Destruction removes the size again */
+    CORRADE_COMPARE(Context::current().memoryUsage().bufferSize, usage);
+}
+
+#ifndef MAGNUM_TARGET_WEBGL
+void BufferGLTest::memoryUsageCategory() {
+    /* The categories are assigned even if the labels themselves are not
+       supported by the driver, so not skipping anything here */
+    {
+        Buffer a, b, c;
+        a.setLabel("BufferGLTest/vertices")
+         .setData({nullptr, 16}, BufferUsage::StaticDraw);
+        b.setData({nullptr, 8}, BufferUsage::StaticDraw)
+         .setLabel("BufferGLTest");
+        c.setData({nullptr, 4}, BufferUsage::StaticDraw);
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_COMPARE(Context::current().memoryUsage("BufferGLTest").bufferSize, 24);
+        CORRADE_COMPARE(Context::current().memoryUsage("nonexistent").bufferSize, 0);
+
+        const std::vector<std::string> categories = Context::current().memoryUsageCategories();
+        CORRADE_VERIFY(std::find(categories.begin(), categories.end(), "BufferGLTest") != categories.end());
+
+        /* Relabeling moves the usage to another category */
+        b.setLabel("BufferGLTest2/indices");
+        CORRADE_COMPARE(Context::current().memoryUsage("BufferGLTest").bufferSize, 16);
+        CORRADE_COMPARE(Context::current().memoryUsage("BufferGLTest2").bufferSize, 8);
+    }
+
+    CORRADE_COMPARE(Context::current().memoryUsage("BufferGLTest").bufferSize, 0);
+    CORRADE_COMPARE(Context::current().memoryUsage("BufferGLTest2").bufferSize, 0);
+}
+#endif
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::GL::Test::BufferGLTest)
@@ -25,9 +25,15 @@
 
 #include <algorithm>
 
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Platform/GLContext.h"
 
 namespace Magnum { namespace GL { namespace Test {
 
@@ -41,6 +47,13 @@ struct ContextGLTest: OpenGLTester {
     void supportedVersion();
     void isExtensionSupported();
     void isExtensionDisabled();
+
+    void statistics();
+
+    void saveRestoreState();
+    void restoreStateDeleted();
+
+    void multipleLiveContexts();
 };
 
 ContextGLTest::ContextGLTest() {
@@ -50,9 +63,22 @@ ContextGLTest::ContextGLTest() {
               #endif
               &ContextGLTest::supportedVersion,
               &ContextGLTest::isExtensionSupported,
-              &ContextGLTest::isExtensionDisabled});
+              &ContextGLTest::isExtensionDisabled,
+
+              &ContextGLTest::statistics,
+
+              &ContextGLTest::saveRestoreState,
+              &ContextGLTest::restoreStateDeleted,
+
+              &ContextGLTest::multipleLiveContexts});
 }
 
+#if defined(MAGNUM_BUILD_MULTITHREADED) && defined(glGenBuffers)
+namespace {
+    void APIENTRY sentinelGenBuffers(GLsizei, GLuint*) {}
+}
+#endif
+
 void ContextGLTest::isVersionSupported() {
     const Version v = Context::current().version();
     CORRADE_VERIFY(Context::current().isVersionSupported(v));
@@ -127,6 +153,145 @@ void ContextGLTest::isExtensionDisabled() {
     #endif
 }
 
+void ContextGLTest::statistics() {
+    Context::current().resetStatistics();
+    CORRADE_COMPARE(Context::current().statistics().bindCount, 0);
+    CORRADE_COMPARE(Context::current().statistics().elidedBindCount, 0);
+    CORRADE_COMPARE(Context::current().statistics().bufferUploadSize, 0);
+    CORRADE_COMPARE(Context::current().statistics().textureUploadSize, 0);
+    CORRADE_COMPARE(Context::current().statistics().drawCount, 0);
+
+    constexpr char data[16]{};
+
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::StaticDraw);
+    buffer.setSubData(4, Containers::arrayView(data, 8));
+    CORRADE_COMPARE(Context::current().statistics().bufferUploadSize, 24);
+
+    Texture2D texture;
+    texture.setImage(0,
+        #ifndef MAGNUM_TARGET_GLES2
+        TextureFormat::RGBA8,
+        #else
+        TextureFormat::RGBA,
+        #endif
+        ImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, data});
+    CORRADE_COMPARE(Context::current().statistics().textureUploadSize, 16);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* The second bind is redundant and gets elided */
+    texture.bind(0);
+    const std::uint64_t bindCount = Context::current().statistics().bindCount;
+    const std::uint64_t elidedBindCount = Context::current().statistics().elidedBindCount;
+    CORRADE_VERIFY(bindCount > 0);
+    texture.bind(0);
+    CORRADE_COMPARE(Context::current().statistics().bindCount, bindCount);
+    CORRADE_COMPARE(Context::current().statistics().elidedBindCount, elidedBindCount + 1);
+
+    Context::current().resetStatistics();
+    CORRADE_COMPARE(Context::current().statistics().bindCount, 0);
+    CORRADE_COMPARE(Context::current().statistics().bufferUploadSize, 0);
+}
+
+void ContextGLTest::saveRestoreState() {
+    Texture2D texture;
+    texture.setStorage(1,
+        #ifndef MAGNUM_TARGET_GLES2
+        TextureFormat::RGBA8,
+        #else
+        TextureFormat::RGBA,
+        #endif
+        {2, 2});
+    texture.bind(0);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const Context::StateSnapshot snapshot = Context::current().saveState();
+    Context::current().resetState(Context::State::EnterExternal);
+
+    {
+        /* External code binding something else */
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    Context::current().resetStatistics();
+    Context::current().restoreState(snapshot);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* The texture got bound again */
+    const std::uint64_t bindCount = Context::current().statistics().bindCount;
+    CORRADE_VERIFY(bindCount >= 1);
+    GLint binding;
+    glActiveTexture(GL_TEXTURE0);
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &binding);
+    CORRADE_COMPARE(binding, texture.id());
+
+    /* And the tracker knows about it, so binding it again is redundant */
+    texture.bind(0);
+    CORRADE_COMPARE(Context::current().statistics().bindCount, bindCount);
+    CORRADE_COMPARE(Context::current().statistics().elidedBindCount, 1);
+}
+
+void ContextGLTest::restoreStateDeleted() {
+    Context::StateSnapshot snapshot;
+    {
+        Texture2D texture;
+        texture.setStorage(1,
+            #ifndef MAGNUM_TARGET_GLES2
+            TextureFormat::RGBA8,
+            #else
+            TextureFormat::RGBA,
+            #endif
+            {2, 2});
+        texture.bind(0);
+
+        snapshot = Context::current().saveState();
+    }
+
+    /* The texture was deleted by Magnum after taking the snapshot, so it
+       shouldn't be bound again */
+    Context::current().resetStatistics();
+    Context::current().restoreState(snapshot, Context::State::Textures);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(Context::current().statistics().bindCount, 0);
+
+    GLint binding;
+    glActiveTexture(GL_TEXTURE0);
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &binding);
+    CORRADE_COMPARE(binding, 0);
+}
+
+void ContextGLTest::multipleLiveContexts() {
+    /* Without flextGL there are no function pointers to load */
+    #if !defined(MAGNUM_BUILD_MULTITHREADED) || !defined(glGenBuffers)
+    CORRADE_SKIP("Function pointers are shared between contexts only with MAGNUM_BUILD_MULTITHREADED and flextGL.");
+    #else
+    Context& current = Context::current();
+
+    /* Replace a function pointer that isn't called during context creation to
+       detect whether the second context reloads them */
+    const auto genBuffers = glGenBuffers;
+    glGenBuffers = sentinelGenBuffers;
+
+    {
+        /* Second context on the same GL context while the first is live */
+        Platform::GLContext second;
+        CORRADE_COMPARE(second.version(), current.version());
+        CORRADE_VERIFY(glGenBuffers == sentinelGenBuffers);
+    }
+
+    glGenBuffers = genBuffers;
+    Context::makeCurrent(&current);
+
+    /* The first context is still usable after the second got destroyed */
+    Buffer buffer;
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(buffer.id());
+    #endif
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::GL::Test::ContextGLTest)
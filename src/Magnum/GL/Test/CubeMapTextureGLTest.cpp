@@ -612,6 +612,8 @@ void CubeMapTextureGLTest::storage() {
         Vector2i(32));
 
     MAGNUM_VERIFY_NO_GL_ERROR();
+    /* All six faces are allocated at once */
+    CORRADE_COMPARE(texture.memoryUsage(), (32*32 + 16*16 + 8*8 + 4*4 + 2*2)*4*6);
 
     #ifndef MAGNUM_TARGET_GLES2
     #ifdef MAGNUM_TARGET_GLES
@@ -0,0 +1,255 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/GL/DebugOutputQueue.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct DebugOutputQueueTest: TestSuite::Tester {
+    explicit DebugOutputQueueTest();
+
+    void construct();
+    void constructInvalidCapacity();
+
+    void process();
+    void processDefaultCallback();
+    void truncate();
+    void deduplicate();
+    void deduplicateDisabled();
+    void overflow();
+    void rateLimit();
+    void worker();
+};
+
+DebugOutputQueueTest::DebugOutputQueueTest() {
+    addTests({&DebugOutputQueueTest::construct,
+              &DebugOutputQueueTest::constructInvalidCapacity,
+
+              &DebugOutputQueueTest::process,
+              &DebugOutputQueueTest::processDefaultCallback,
+              &DebugOutputQueueTest::truncate,
+              &DebugOutputQueueTest::deduplicate,
+              &DebugOutputQueueTest::deduplicateDisabled,
+              &DebugOutputQueueTest::overflow,
+              &DebugOutputQueueTest::rateLimit,
+              &DebugOutputQueueTest::worker});
+}
+
+namespace {
+
+struct Received {
+    DebugOutput::Source source;
+    UnsignedInt id;
+    std::string message;
+};
+
+void capture(const DebugOutput::Source source, DebugOutput::Type, const UnsignedInt id, DebugOutput::Severity, const std::string& message, const void* userParam) {
+    static_cast<std::vector<Received>*>(const_cast<void*>(userParam))->push_back({source, id, message});
+}
+
+void push(DebugOutputQueue& queue, const UnsignedInt id, const char* message = "hello") {
+    queue.push(DebugOutput::Source::Api, DebugOutput::Type::Performance, id, DebugOutput::Severity::Low, {message, std::strlen(message)});
+}
+
+}
+
+void DebugOutputQueueTest::construct() {
+    DebugOutputQueue queue{16};
+    CORRADE_COMPARE(queue.capacity(), 16);
+    CORRADE_VERIFY(!queue.isInstalled());
+    CORRADE_VERIFY(!queue.isRunning());
+    CORRADE_COMPARE(queue.receivedCount(), 0);
+    CORRADE_COMPARE(queue.deliveredCount(), 0);
+    CORRADE_COMPARE(queue.suppressedCount(), 0);
+    CORRADE_COMPARE(queue.rateLimitedCount(), 0);
+    CORRADE_COMPARE(queue.overflowCount(), 0);
+}
+
+void DebugOutputQueueTest::constructInvalidCapacity() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    DebugOutputQueue{12};
+    DebugOutputQueue{1};
+    CORRADE_COMPARE(out.str(),
+        "GL::DebugOutputQueue: expected capacity to be a power of two and at least 2 but got 12\n"
+        "GL::DebugOutputQueue: expected capacity to be a power of two and at least 2 but got 1\n");
+}
+
+void DebugOutputQueueTest::process() {
+    std::vector<Received> received;
+    DebugOutputQueue queue;
+    queue.setCallback(capture, &received);
+
+    push(queue, 1, "first");
+    queue.push(DebugOutput::Source::ShaderCompiler, DebugOutput::Type::Error, 2, DebugOutput::Severity::High, {"second", 6});
+    CORRADE_COMPARE(queue.receivedCount(), 2);
+
+    /* Nothing is delivered until processed */
+    CORRADE_VERIFY(received.empty());
+
+    CORRADE_COMPARE(queue.process(), 2);
+    CORRADE_COMPARE(queue.deliveredCount(), 2);
+    CORRADE_COMPARE(received.size(), 2);
+    CORRADE_COMPARE(received[0].source, DebugOutput::Source::Api);
+    CORRADE_COMPARE(received[0].id, 1);
+    CORRADE_COMPARE(received[0].message, "first");
+    CORRADE_COMPARE(received[1].source, DebugOutput::Source::ShaderCompiler);
+    CORRADE_COMPARE(received[1].id, 2);
+    CORRADE_COMPARE(received[1].message, "second");
+
+    /* The queue is empty now */
+    CORRADE_COMPARE(queue.process(), 0);
+    CORRADE_COMPARE(received.size(), 2);
+}
+
+void DebugOutputQueueTest::processDefaultCallback() {
+    DebugOutputQueue queue;
+    queue.push(DebugOutput::Source::Api, DebugOutput::Type::Performance, 42, DebugOutput::Severity::High, {"hello", 5});
+
+    std::ostringstream out;
+    {
+        Debug redirectOutput{&out};
+        CORRADE_COMPARE(queue.process(), 1);
+    }
+    CORRADE_COMPARE(out.str(), "Debug output: high severity API performance note (42): hello\n");
+}
+
+void DebugOutputQueueTest::truncate() {
+    std::vector<Received> received;
+    DebugOutputQueue queue;
+    queue.setCallback(capture, &received);
+
+    const std::string message(DebugOutputQueue::maxMessageLength() + 10, 'a');
+    push(queue, 1, message.data());
+    CORRADE_COMPARE(queue.process(), 1);
+    CORRADE_COMPARE(received.size(), 1);
+    CORRADE_COMPARE(received[0].message, message.substr(0, DebugOutputQueue::maxMessageLength()));
+}
+
+void DebugOutputQueueTest::deduplicate() {
+    std::vector<Received> received;
+    DebugOutputQueue queue;
+    queue.setCallback(capture, &received)
+        .setDeduplicationInterval(60.0f);
+
+    push(queue, 1);
+    push(queue, 1);
+    push(queue, 2);
+    push(queue, 1);
+    CORRADE_COMPARE(queue.receivedCount(), 4);
+    CORRADE_COMPARE(queue.suppressedCount(), 2);
+
+    CORRADE_COMPARE(queue.process(), 2);
+    CORRADE_COMPARE(received.size(), 2);
+    CORRADE_COMPARE(received[0].id, 1);
+    CORRADE_COMPARE(received[1].id, 2);
+
+    /* Same ID from a different source is a different message */
+    queue.push(DebugOutput::Source::Application, DebugOutput::Type::Performance, 1, DebugOutput::Severity::Low, {"hello", 5});
+    CORRADE_COMPARE(queue.suppressedCount(), 2);
+    CORRADE_COMPARE(queue.process(), 1);
+}
+
+void DebugOutputQueueTest::deduplicateDisabled() {
+    std::vector<Received> received;
+    DebugOutputQueue queue;
+    queue.setCallback(capture, &received)
+        .setDeduplicationInterval(0.0f);
+
+    push(queue, 1);
+    push(queue, 1);
+    push(queue, 1);
+    CORRADE_COMPARE(queue.suppressedCount(), 0);
+    CORRADE_COMPARE(queue.process(), 3);
+}
+
+void DebugOutputQueueTest::overflow() {
+    std::vector<Received> received;
+    DebugOutputQueue queue{4};
+    queue.setCallback(capture, &received)
+        .setDeduplicationInterval(0.0f);
+
+    for(UnsignedInt i = 0; i != 6; ++i) push(queue, i);
+    CORRADE_COMPARE(queue.receivedCount(), 6);
+    CORRADE_COMPARE(queue.overflowCount(), 2);
+
+    /* The oldest messages are kept */
+    CORRADE_COMPARE(queue.process(), 4);
+    CORRADE_COMPARE(received.size(), 4);
+    CORRADE_COMPARE(received[0].id, 0);
+    CORRADE_COMPARE(received[3].id, 3);
+
+    /* After processing there's space again, wrapping around */
+    for(UnsignedInt i = 0; i != 3; ++i) push(queue, 10 + i);
+    CORRADE_COMPARE(queue.overflowCount(), 2);
+    CORRADE_COMPARE(queue.process(), 3);
+    CORRADE_COMPARE(received.size(), 7);
+    CORRADE_COMPARE(received[6].id, 12);
+}
+
+void DebugOutputQueueTest::rateLimit() {
+    std::vector<Received> received;
+    DebugOutputQueue queue;
+    queue.setCallback(capture, &received)
+        .setRateLimit(3);
+
+    /* Distinct IDs so deduplication doesn't kick in. Refilling the bucket
+       takes a third of a second, so the test won't be fast enough to get
+       another message through. */
+    for(UnsignedInt i = 0; i != 5; ++i) push(queue, i);
+    CORRADE_COMPARE(queue.process(), 3);
+    CORRADE_COMPARE(queue.deliveredCount(), 3);
+    CORRADE_COMPARE(queue.rateLimitedCount(), 2);
+    CORRADE_COMPARE(received.size(), 3);
+    CORRADE_COMPARE(received[2].id, 2);
+}
+
+void DebugOutputQueueTest::worker() {
+    std::vector<Received> received;
+    DebugOutputQueue queue;
+    queue.setCallback(capture, &received)
+        .setDeduplicationInterval(0.0f);
+
+    queue.start();
+    CORRADE_VERIFY(queue.isRunning());
+    for(UnsignedInt i = 0; i != 100; ++i) push(queue, i);
+
+    /* Stopping delivers everything that's left */
+    queue.stop();
+    CORRADE_VERIFY(!queue.isRunning());
+    CORRADE_COMPARE(queue.deliveredCount(), 100);
+    CORRADE_COMPARE(received.size(), 100);
+    CORRADE_COMPARE(received[99].id, 99);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::DebugOutputQueueTest)
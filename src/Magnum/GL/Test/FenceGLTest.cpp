@@ -0,0 +1,195 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Fence.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderer.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct FenceGLTest: OpenGLTester {
+    explicit FenceGLTest();
+
+    void construct();
+    void constructMove();
+    void wrap();
+
+    void insert();
+    void clientWait();
+    void serverWait();
+    void maxServerWaitTimeout();
+};
+
+FenceGLTest::FenceGLTest() {
+    addTests({&FenceGLTest::construct,
+              &FenceGLTest::constructMove,
+              &FenceGLTest::wrap,
+
+              &FenceGLTest::insert,
+              &FenceGLTest::clientWait,
+              &FenceGLTest::serverWait,
+              &FenceGLTest::maxServerWaitTimeout});
+}
+
+void FenceGLTest::construct() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sync>())
+        CORRADE_SKIP(Extensions::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    {
+        Fence fence;
+
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        CORRADE_VERIFY(fence.id());
+        CORRADE_VERIFY(glIsSync(fence.id()));
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void FenceGLTest::constructMove() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sync>())
+        CORRADE_SKIP(Extensions::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    Fence a;
+    const GLsync id = a.id();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(id);
+
+    Fence b{std::move(a)};
+
+    CORRADE_VERIFY(!a.id());
+    CORRADE_COMPARE(b.id(), id);
+
+    Fence c;
+    const GLsync cId = c.id();
+    c = std::move(b);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(cId);
+    CORRADE_COMPARE(b.id(), cId);
+    CORRADE_COMPARE(c.id(), id);
+}
+
+void FenceGLTest::wrap() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sync>())
+        CORRADE_SKIP(Extensions::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    GLsync id = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    /* Releasing won't delete anything */
+    {
+        auto fence = Fence::wrap(id, ObjectFlag::DeleteOnDestruction);
+        CORRADE_COMPARE(fence.release(), id);
+    }
+
+    /* ...so we can wrap it again */
+    Fence::wrap(id);
+    CORRADE_VERIFY(glIsSync(id));
+    glDeleteSync(id);
+}
+
+void FenceGLTest::insert() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sync>())
+        CORRADE_SKIP(Extensions::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    Fence fence{NoCreate};
+    fence.insert();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(fence.id());
+    CORRADE_VERIFY(glIsSync(fence.id()));
+
+    /* Inserting again replaces the previous sync */
+    fence.insert();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(fence.id());
+    CORRADE_VERIFY(glIsSync(fence.id()));
+}
+
+void FenceGLTest::clientWait() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sync>())
+        CORRADE_SKIP(Extensions::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    Fence fence;
+    Renderer::finish();
+
+    /* After everything is finished the fence has to be signaled */
+    CORRADE_VERIFY(fence.isSignaled());
+    CORRADE_COMPARE(fence.clientWait(0), Fence::WaitResult::AlreadySignaled);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Waiting on a new fence succeeds one way or another */
+    fence.insert();
+    const Fence::WaitResult result = fence.clientWait(1000000000ull);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(result == Fence::WaitResult::AlreadySignaled ||
+                   result == Fence::WaitResult::ConditionSatisfied);
+    CORRADE_VERIFY(fence.isSignaled());
+}
+
+void FenceGLTest::serverWait() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sync>())
+        CORRADE_SKIP(Extensions::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    Fence fence;
+    fence.serverWait();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Renderer::finish();
+    CORRADE_VERIFY(fence.isSignaled());
+}
+
+void FenceGLTest::maxServerWaitTimeout() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sync>())
+        CORRADE_SKIP(Extensions::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    const Long value = Fence::maxServerWaitTimeout();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(value > 0);
+
+    /* The value is cached */
+    CORRADE_COMPARE(Fence::maxServerWaitTimeout(), value);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::FenceGLTest)
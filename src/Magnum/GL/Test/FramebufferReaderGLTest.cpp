@@ -0,0 +1,153 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/ImageView.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/FramebufferReader.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/Math/Color.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct FramebufferReaderGLTest: OpenGLTester {
+    explicit FramebufferReaderGLTest();
+
+    void construct();
+    void constructMove();
+
+    void read();
+    void ringWrapAround();
+};
+
+FramebufferReaderGLTest::FramebufferReaderGLTest() {
+    addTests({&FramebufferReaderGLTest::construct,
+              &FramebufferReaderGLTest::constructMove,
+
+              &FramebufferReaderGLTest::read,
+              &FramebufferReaderGLTest::ringWrapAround});
+}
+
+void FramebufferReaderGLTest::construct() {
+    {
+        FramebufferReader reader{2};
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_COMPARE(reader.frameCount(), 2);
+        CORRADE_COMPARE(reader.pendingCount(), 0);
+        CORRADE_VERIFY(!reader.isReady());
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void FramebufferReaderGLTest::constructMove() {
+    FramebufferReader a{2};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    FramebufferReader b{std::move(a)};
+    CORRADE_COMPARE(a.frameCount(), 0);
+    CORRADE_COMPARE(b.frameCount(), 2);
+
+    FramebufferReader c{3};
+    c = std::move(b);
+    CORRADE_COMPARE(b.frameCount(), 3);
+    CORRADE_COMPARE(c.frameCount(), 2);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void FramebufferReaderGLTest::read() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{32});
+    Framebuffer framebuffer{{{}, Vector2i{32}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color);
+
+    Renderer::setClearColor(Math::unpack<Color4>(Color4ub{128, 64, 32, 17}));
+    framebuffer.clear(FramebufferClear::Color);
+
+    FramebufferReader reader;
+    reader.read(framebuffer, Range2Di::fromSize({8, 4}, {4, 2}), Magnum::PixelFormat::RGBA8Unorm);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(reader.pendingCount(), 1);
+
+    ImageView2D image = reader.map();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(reader.isReady());
+    CORRADE_COMPARE(image.size(), (Vector2i{4, 2}));
+    CORRADE_COMPARE(image.data().size(), 4*2*4);
+    CORRADE_COMPARE(Containers::arrayCast<const Color4ub>(image.data())[5], (Color4ub{128, 64, 32, 17}));
+
+    reader.unmap();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(reader.pendingCount(), 0);
+    CORRADE_VERIFY(!reader.isReady());
+}
+
+void FramebufferReaderGLTest::ringWrapAround() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{4});
+    Framebuffer framebuffer{{{}, Vector2i{4}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color);
+
+    /* More frames than there's buffers in the ring, each with a different
+       color. Results are consumed only once the ring is full, so they come
+       one frame behind. */
+    FramebufferReader reader{2};
+    for(UnsignedByte i = 0; i != 5; ++i) {
+        Renderer::setClearColor(Math::unpack<Color4>(Color4ub{UnsignedByte(i*10), 0, 0, 255}));
+        framebuffer.clear(FramebufferClear::Color);
+        reader.read(framebuffer, {{}, Vector2i{4}}, PixelFormat::RGBA, PixelType::UnsignedByte);
+
+        if(reader.pendingCount() == reader.frameCount()) {
+            ImageView2D image = reader.map();
+            CORRADE_COMPARE(Containers::arrayCast<const Color4ub>(image.data())[0], (Color4ub{UnsignedByte((i - 1)*10), 0, 0, 255}));
+            reader.unmap();
+        }
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(reader.pendingCount(), 1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::FramebufferReaderGLTest)
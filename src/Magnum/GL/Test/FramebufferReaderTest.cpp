@@ -0,0 +1,65 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/GL/FramebufferReader.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct FramebufferReaderTest: TestSuite::Tester {
+    explicit FramebufferReaderTest();
+
+    void constructNoCreate();
+    void constructCopy();
+};
+
+FramebufferReaderTest::FramebufferReaderTest() {
+    addTests({&FramebufferReaderTest::constructNoCreate,
+              &FramebufferReaderTest::constructCopy});
+}
+
+void FramebufferReaderTest::constructNoCreate() {
+    {
+        FramebufferReader reader{NoCreate};
+        CORRADE_COMPARE(reader.frameCount(), 0);
+        CORRADE_COMPARE(reader.pendingCount(), 0);
+
+        /* No GL calls should be done */
+        CORRADE_VERIFY(!reader.isReady());
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void FramebufferReaderTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<FramebufferReader, const FramebufferReader&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<FramebufferReader, const FramebufferReader&>{}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::FramebufferReaderTest)
@@ -0,0 +1,253 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Version.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector2.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+/* Measures CPU-side overhead of draw calls and of the state tracker. Meant
+   to be run repeatedly against the same driver to catch driver overhead
+   regressions, ideally with MAGNUM_TARGET_HEADLESS for reproducibility on CI
+   machines without a display. Each benchmark is registered twice, once
+   measuring wall time and once GPU time. */
+struct MeshGLBenchmark: OpenGLTester {
+    explicit MeshGLBenchmark();
+
+    void drawSameMesh();
+    void drawAlternatingMeshes();
+    void drawAlternatingShaders();
+    void drawIndexed();
+
+    void bindFramebufferRedundant();
+    void bindFramebufferAlternating();
+
+    private:
+        Renderbuffer _color{NoCreate};
+        Framebuffer _framebuffer{NoCreate}, _otherFramebuffer{NoCreate};
+        Buffer _vertices{NoCreate}, _indices{NoCreate};
+        Mesh _mesh{NoCreate}, _otherMesh{NoCreate}, _indexedMesh{NoCreate};
+};
+
+namespace {
+    enum: std::size_t { DrawCount = 1000 };
+
+    struct PassthroughShader: AbstractShaderProgram {
+        typedef Attribute<0, Vector2> Position;
+
+        explicit PassthroughShader(const char* color);
+    };
+
+    PassthroughShader::PassthroughShader(const char* color) {
+        #ifndef MAGNUM_TARGET_GLES
+        Shader vert(
+            #ifndef CORRADE_TARGET_APPLE
+            Version::GL210
+            #else
+            Version::GL310
+            #endif
+            , Shader::Type::Vertex);
+        Shader frag(
+            #ifndef CORRADE_TARGET_APPLE
+            Version::GL210
+            #else
+            Version::GL310
+            #endif
+            , Shader::Type::Fragment);
+        #elif defined(MAGNUM_TARGET_GLES2)
+        Shader vert(Version::GLES200, Shader::Type::Vertex);
+        Shader frag(Version::GLES200, Shader::Type::Fragment);
+        #else
+        Shader vert(Version::GLES300, Shader::Type::Vertex);
+        Shader frag(Version::GLES300, Shader::Type::Fragment);
+        #endif
+
+        vert.addSource(
+            "#if defined(GL_ES) || __VERSION__ == 120\n"
+            "#define in attribute\n"
+            "#endif\n"
+            "in highp vec2 position;\n"
+            "void main() {\n"
+            "    gl_Position = vec4(position, 0.0, 1.0);\n"
+            "}\n");
+        frag.addSource(std::string{
+            "#if !defined(GL_ES) && __VERSION__ == 120\n"
+            "#define lowp\n"
+            "#endif\n"
+            "#if defined(GL_ES) || __VERSION__ == 120\n"
+            "#define result gl_FragColor\n"
+            "#endif\n"
+            "#if !defined(GL_ES) && __VERSION__ >= 130\n"
+            "out lowp vec4 result;\n"
+            "#endif\n"
+            "void main() { result = "} + color + "; }\n");
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+        attachShaders({vert, frag});
+        bindAttributeLocation(Position::Location, "position");
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    }
+
+    /* A small triangle in the corner, so the cost is dominated by draw call
+       submission and not by rasterization */
+    constexpr Vector2 Vertices[]{
+        {-1.0f, -1.0f}, {-0.9f, -1.0f}, {-1.0f, -0.9f}
+    };
+
+    constexpr UnsignedShort Indices[]{0, 1, 2};
+}
+
+MeshGLBenchmark::MeshGLBenchmark() {
+    for(auto type: {
+        BenchmarkType::Default,
+        #ifndef MAGNUM_TARGET_WEBGL
+        BenchmarkType::GpuTime
+        #endif
+    }) {
+        addBenchmarks({&MeshGLBenchmark::drawSameMesh,
+                       &MeshGLBenchmark::drawAlternatingMeshes,
+                       &MeshGLBenchmark::drawAlternatingShaders,
+                       &MeshGLBenchmark::drawIndexed,
+
+                       &MeshGLBenchmark::bindFramebufferRedundant,
+                       &MeshGLBenchmark::bindFramebufferAlternating}, 10, type);
+    }
+
+    _color = Renderbuffer{};
+    #ifndef MAGNUM_TARGET_GLES2
+    _color.setStorage(RenderbufferFormat::RGBA8, Vector2i{64});
+    #else
+    _color.setStorage(RenderbufferFormat::RGBA4, Vector2i{64});
+    #endif
+    _framebuffer = Framebuffer{{{}, Vector2i{64}}};
+    _framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, _color);
+    _otherFramebuffer = Framebuffer{{{}, Vector2i{64}}};
+    _otherFramebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, _color);
+
+    _vertices = Buffer{};
+    _vertices.setData(Vertices, BufferUsage::StaticDraw);
+    _indices = Buffer{};
+    _indices.setData(Indices, BufferUsage::StaticDraw);
+
+    _mesh = Mesh{};
+    _mesh.setCount(3)
+        .addVertexBuffer(_vertices, 0, PassthroughShader::Position{});
+    _otherMesh = Mesh{};
+    _otherMesh.setCount(3)
+        .addVertexBuffer(_vertices, 0, PassthroughShader::Position{});
+    _indexedMesh = Mesh{};
+    _indexedMesh.setCount(3)
+        .addVertexBuffer(_vertices, 0, PassthroughShader::Position{})
+        .setIndexBuffer(_indices, 0, MeshIndexType::UnsignedShort);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void MeshGLBenchmark::drawSameMesh() {
+    PassthroughShader shader{"vec4(1.0)"};
+    _framebuffer.bind();
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != DrawCount; ++i)
+            _mesh.draw(shader);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void MeshGLBenchmark::drawAlternatingMeshes() {
+    PassthroughShader shader{"vec4(1.0)"};
+    _framebuffer.bind();
+
+    /* Each draw has to rebind the VAO (or respecify the attributes, if VAOs
+       are not available) */
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != DrawCount/2; ++i) {
+            _mesh.draw(shader);
+            _otherMesh.draw(shader);
+        }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void MeshGLBenchmark::drawAlternatingShaders() {
+    PassthroughShader shader{"vec4(1.0)"};
+    PassthroughShader otherShader{"vec4(0.5)"};
+    _framebuffer.bind();
+
+    /* Each draw has to switch the program */
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != DrawCount/2; ++i) {
+            _mesh.draw(shader);
+            _mesh.draw(otherShader);
+        }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void MeshGLBenchmark::drawIndexed() {
+    PassthroughShader shader{"vec4(1.0)"};
+    _framebuffer.bind();
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != DrawCount; ++i)
+            _indexedMesh.draw(shader);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void MeshGLBenchmark::bindFramebufferRedundant() {
+    /* The state tracker should make all but the first call a no-op */
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != DrawCount; ++i)
+            _framebuffer.bind();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void MeshGLBenchmark::bindFramebufferAlternating() {
+    /* Baseline for the above, each call results in a GL call */
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != DrawCount/2; ++i) {
+            _framebuffer.bind();
+            _otherFramebuffer.bind();
+        }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::MeshGLBenchmark)
@@ -24,6 +24,7 @@
 */
 
 #include <sstream>
+#include <vector>
 
 #include "Magnum/Image.h"
 #include "Magnum/Mesh.h"
@@ -33,6 +34,9 @@
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Framebuffer.h"
 #include "Magnum/GL/Mesh.h"
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/GL/MeshLayout.h"
+#endif
 #include "Magnum/GL/MeshView.h"
 #include "Magnum/GL/OpenGLTester.h"
 #include "Magnum/GL/PixelFormat.h"
@@ -153,12 +157,22 @@ struct MeshGLTest: OpenGLTester {
     void addVertexBufferInstancedDouble();
     #endif
     void resetDivisorAfterInstancedDraw();
+    void reuseAttributesWithoutVAO();
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void layoutSharedBetweenMeshes();
+    #endif
 
     void multiDraw();
     void multiDrawIndexed();
     #ifndef MAGNUM_TARGET_GLES
     void multiDrawBaseVertex();
     #endif
+    void multiDrawArrayView();
+
+    #ifndef MAGNUM_TARGET_GLES
+    void drawIndirect();
+    void drawIndirectIndexed();
+    #endif
 };
 
 MeshGLTest::MeshGLTest() {
@@ -274,11 +288,21 @@ MeshGLTest::MeshGLTest() {
               &MeshGLTest::addVertexBufferInstancedDouble,
               #endif
               &MeshGLTest::resetDivisorAfterInstancedDraw,
+              &MeshGLTest::reuseAttributesWithoutVAO,
+              #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+              &MeshGLTest::layoutSharedBetweenMeshes,
+              #endif
 
               &MeshGLTest::multiDraw,
               &MeshGLTest::multiDrawIndexed,
               #ifndef MAGNUM_TARGET_GLES
-              &MeshGLTest::multiDrawBaseVertex
+              &MeshGLTest::multiDrawBaseVertex,
+              #endif
+              &MeshGLTest::multiDrawArrayView,
+
+              #ifndef MAGNUM_TARGET_GLES
+              &MeshGLTest::drawIndirect,
+              &MeshGLTest::drawIndirectIndexed
               #endif
               });
 }
@@ -2603,9 +2627,148 @@ void MeshGLTest::resetDivisorAfterInstancedDraw() {
     }
 }
 
+void MeshGLTest::reuseAttributesWithoutVAO() {
+    /* VAOs encapsulate the state, so there's nothing to reuse */
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current().isExtensionSupported<Extensions::ARB::vertex_array_object>())
+        CORRADE_SKIP(Extensions::ARB::vertex_array_object::string() + std::string(" is enabled, can't test."));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(Context::current().isExtensionSupported<Extensions::OES::vertex_array_object>())
+        CORRADE_SKIP(Extensions::OES::vertex_array_object::string() + std::string(" is enabled, can't test."));
+    #else
+    CORRADE_SKIP("VAOs are always available on OpenGL ES 3.0, can't test.");
+    #endif
+
+    typedef Attribute<0, Float> Attribute;
+
+    const Float data[]{
+        Math::unpack<Float, UnsignedByte>(96),
+        Math::unpack<Float, UnsignedByte>(48)
+    };
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::StaticDraw);
+
+    Renderbuffer renderbuffer;
+    renderbuffer.setStorage(
+        #ifndef MAGNUM_TARGET_GLES2
+        RenderbufferFormat::RGBA8,
+        #else
+        RenderbufferFormat::RGBA4,
+        #endif
+        Vector2i(1));
+    Framebuffer framebuffer{{{}, Vector2i(1)}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), renderbuffer)
+                .bind();
+
+    FloatShader shader{"float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"};
+
+    /* Two meshes with the same buffer and layout, a third one with a
+       different offset */
+    Mesh a, b, c;
+    a.addVertexBuffer(buffer, 0, Attribute{})
+        .setPrimitive(MeshPrimitive::Points)
+        .setCount(1);
+    b.addVertexBuffer(buffer, 0, Attribute{})
+        .setPrimitive(MeshPrimitive::Points)
+        .setCount(1);
+    c.addVertexBuffer(buffer, 4, Attribute{})
+        .setPrimitive(MeshPrimitive::Points)
+        .setCount(1);
+
+    a.draw(shader);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(framebuffer.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte}).data<UnsignedByte>()[0], 96);
+
+    /* The attribute setup is elided for the second mesh */
+    Context::current().resetStatistics();
+    b.draw(shader);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(Context::current().statistics().bindCount, 0);
+    CORRADE_VERIFY(Context::current().statistics().elidedBindCount > 0);
+    CORRADE_COMPARE(framebuffer.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte}).data<UnsignedByte>()[0], 96);
+
+    /* But not for the third */
+    Context::current().resetStatistics();
+    c.draw(shader);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(Context::current().statistics().bindCount > 0);
+    CORRADE_COMPARE(framebuffer.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte}).data<UnsignedByte>()[0], 48);
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void MeshGLTest::layoutSharedBetweenMeshes() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::vertex_attrib_binding>())
+        CORRADE_SKIP(Extensions::ARB::vertex_attrib_binding::string() + std::string(" is not supported."));
+    if(!Context::current().isExtensionSupported<Extensions::ARB::vertex_array_object>())
+        CORRADE_SKIP(Extensions::ARB::vertex_array_object::string() + std::string(" is not supported."));
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    typedef Attribute<0, Float> Attribute;
+
+    const Float data[]{
+        Math::unpack<Float, UnsignedByte>(96),
+        Math::unpack<Float, UnsignedByte>(48)
+    };
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::StaticDraw);
+
+    Renderbuffer renderbuffer;
+    renderbuffer.setStorage(RenderbufferFormat::RGBA8, Vector2i(1));
+    Framebuffer framebuffer{{{}, Vector2i(1)}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), renderbuffer)
+                .bind();
+
+    FloatShader shader{"float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"};
+
+    MeshLayout layout;
+    layout.addVertexBinding(0, Attribute{});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(layout.hasBinding(0));
+    CORRADE_VERIFY(!layout.hasBinding(1));
+    CORRADE_COMPARE(layout.bindingStride(0), 4);
+
+    /* Two meshes with the same buffer, a third one with a different offset */
+    Mesh a{layout, MeshPrimitive::Points}, b{layout, MeshPrimitive::Points},
+        c{layout, MeshPrimitive::Points};
+    a.setVertexBuffer(0, buffer, 0)
+        .setCount(1);
+    b.setVertexBuffer(0, buffer, 0)
+        .setCount(1);
+    c.setVertexBuffer(0, buffer, 4)
+        .setCount(1);
+    CORRADE_COMPARE(a.layout(), &layout);
+
+    a.draw(shader);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(framebuffer.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte}).data<UnsignedByte>()[0], 96);
+
+    /* Neither the VAO nor the buffer binding changes for the second mesh */
+    Context::current().resetStatistics();
+    b.draw(shader);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(Context::current().statistics().bindCount, 0);
+    CORRADE_VERIFY(Context::current().statistics().elidedBindCount > 0);
+    CORRADE_COMPARE(framebuffer.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte}).data<UnsignedByte>()[0], 96);
+
+    /* The third mesh switches just the buffer binding */
+    Context::current().resetStatistics();
+    c.draw(shader);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(Context::current().statistics().bindCount, 1);
+    CORRADE_COMPARE(framebuffer.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte}).data<UnsignedByte>()[0], 48);
+}
+#endif
+
 namespace {
     struct MultiChecker {
-        MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh);
+        MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh, bool arrayView = false);
+        #ifndef MAGNUM_TARGET_GLES
+        MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh, Buffer& commands, UnsignedInt drawCount);
+        #endif
 
         template<class T> T get(PixelFormat format, PixelType type);
 
@@ -2615,7 +2778,7 @@ namespace {
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
-MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh): framebuffer({{}, Vector2i(1)}) {
+MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh, const bool arrayView): framebuffer({{}, Vector2i(1)}) {
     renderbuffer.setStorage(
         #ifndef MAGNUM_TARGET_GLES2
         RenderbufferFormat::RGBA8,
@@ -2645,8 +2808,24 @@ MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh): framebuf
          .setIndexRange(1);
     } else c.setBaseVertex(1);
 
-    MeshView::draw(shader, {a, b, c});
+    /* Test also the variant with view count known only at runtime */
+    if(arrayView) {
+        std::vector<std::reference_wrapper<MeshView>> views{a, b, c};
+        MeshView::draw(shader, Containers::arrayView(views.data(), views.size()));
+    } else MeshView::draw(shader, {a, b, c});
+}
+
+#ifndef MAGNUM_TARGET_GLES
+MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh, Buffer& commands, const UnsignedInt drawCount): framebuffer({{}, Vector2i(1)}) {
+    renderbuffer.setStorage(RenderbufferFormat::RGBA8, Vector2i(1));
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), renderbuffer);
+
+    framebuffer.bind();
+    mesh.setPrimitive(MeshPrimitive::Points);
+
+    mesh.drawIndirect(shader, commands, 0, drawCount);
 }
+#endif
 
 template<class T> T MultiChecker::get(PixelFormat format, PixelType type) {
     return framebuffer.read({{}, Vector2i{1}}, {format, type}).data<T>()[0];
@@ -2730,6 +2909,97 @@ void MeshGLTest::multiDrawBaseVertex() {
 }
 #endif
 
+void MeshGLTest::multiDrawArrayView() {
+    #if defined(MAGNUM_TARGET_GLES) && !defined(MAGNUM_TARGET_WEBGL)
+    if(!Context::current().isExtensionSupported<Extensions::EXT::multi_draw_arrays>())
+        Debug() << Extensions::EXT::multi_draw_arrays::string() << "not supported, using fallback implementation";
+    #endif
+
+    typedef Attribute<0, Float> Attribute;
+
+    const Float data[] = { 0.0f, -0.7f, Math::unpack<Float, UnsignedByte>(96) };
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.addVertexBuffer(buffer, 4, Attribute());
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const auto value = MultiChecker(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"),
+        mesh, true).get<UnsignedByte>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(value, 96);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void MeshGLTest::drawIndirect() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::multi_draw_indirect>())
+        CORRADE_SKIP(Extensions::ARB::multi_draw_indirect::string() + std::string(" is not available."));
+
+    typedef Attribute<0, Float> Attribute;
+
+    const Float data[] = { 0.0f, -0.7f, Math::unpack<Float, UnsignedByte>(96) };
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.addVertexBuffer(buffer, 4, Attribute());
+
+    /* Zero count to test skipping, then the same as in multiDraw() */
+    constexpr DrawArraysIndirectCommand commandData[] = {
+        {0, 1, 0, 0},
+        {1, 1, 0, 0},
+        {1, 1, 1, 0}
+    };
+    Buffer commands{Buffer::TargetHint::DrawIndirect};
+    commands.setData(commandData, BufferUsage::StaticDraw);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const auto value = MultiChecker(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"),
+        mesh, commands, 3).get<UnsignedByte>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(value, 96);
+}
+
+void MeshGLTest::drawIndirectIndexed() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::multi_draw_indirect>())
+        CORRADE_SKIP(Extensions::ARB::multi_draw_indirect::string() + std::string(" is not available."));
+
+    Buffer vertices;
+    vertices.setData(indexedVertexData, BufferUsage::StaticDraw);
+
+    constexpr UnsignedShort indexData[] = { 2, 1, 0 };
+    Buffer indices{Buffer::TargetHint::ElementArray};
+    indices.setData(indexData, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.addVertexBuffer(vertices, 1*4,  MultipleShader::Position(),
+                         MultipleShader::Normal(), MultipleShader::TextureCoordinates())
+        .setIndexBuffer(indices, 2, MeshIndexType::UnsignedShort);
+
+    /* The index buffer offset is ignored for indirect draws, so the first
+       index is counted from the buffer start */
+    constexpr DrawElementsIndirectCommand commandData[] = {
+        {0, 1, 1, 0, 0},
+        {1, 1, 1, 0, 0},
+        {1, 1, 2, 0, 0}
+    };
+    Buffer commands{Buffer::TargetHint::DrawIndirect};
+    commands.setData(commandData, BufferUsage::StaticDraw);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const auto value = MultiChecker(MultipleShader{}, mesh, commands, 3).get<Color4ub>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(value, indexedResult);
+}
+#endif
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::GL::Test::MeshGLTest)
@@ -0,0 +1,268 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/ProgramBinaryCache.h"
+#include "Magnum/GL/Shader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct ProgramBinaryCacheGLTest: OpenGLTester {
+    explicit ProgramBinaryCacheGLTest();
+
+    void binary();
+    void setBinaryInvalid();
+
+    void key();
+    void setCurrent();
+
+    void saveLoad();
+    void loadNotFound();
+    void loadCachedBinary();
+};
+
+ProgramBinaryCacheGLTest::ProgramBinaryCacheGLTest() {
+    addTests({&ProgramBinaryCacheGLTest::binary,
+              &ProgramBinaryCacheGLTest::setBinaryInvalid,
+
+              &ProgramBinaryCacheGLTest::key,
+              &ProgramBinaryCacheGLTest::setCurrent,
+
+              &ProgramBinaryCacheGLTest::saveLoad,
+              &ProgramBinaryCacheGLTest::loadNotFound,
+              &ProgramBinaryCacheGLTest::loadCachedBinary});
+}
+
+namespace {
+    struct MyPublicShader: AbstractShaderProgram {
+        using AbstractShaderProgram::attachShaders;
+        using AbstractShaderProgram::bindAttributeLocation;
+        using AbstractShaderProgram::link;
+        using AbstractShaderProgram::setRetrievableBinary;
+        using AbstractShaderProgram::setBinary;
+        using AbstractShaderProgram::loadCachedBinary;
+        using AbstractShaderProgram::saveCachedBinary;
+        using AbstractShaderProgram::uniformLocation;
+    };
+
+    constexpr const char VertexSource[] =
+        "#if !defined(GL_ES) && __VERSION__ == 120\n"
+        "#define mediump\n"
+        "#define in attribute\n"
+        "#endif\n"
+        "in mediump vec4 position;\n"
+        "uniform mediump mat4 matrix;\n"
+        "void main() {\n"
+        "    gl_Position = matrix*position;\n"
+        "}\n";
+
+    constexpr const char FragmentSource[] =
+        "#if !defined(GL_ES) && __VERSION__ == 120\n"
+        "#define lowp\n"
+        "#define fragColor gl_FragColor\n"
+        "#else\n"
+        "out lowp vec4 fragColor;\n"
+        "#endif\n"
+        "uniform lowp vec4 color;\n"
+        "void main() {\n"
+        "    fragColor = color;\n"
+        "}\n";
+
+    Shader createShader(Shader::Type type, const char* source, const char* define = "") {
+        Shader shader{
+            #ifndef MAGNUM_TARGET_GLES
+            #ifndef CORRADE_TARGET_APPLE
+            Version::GL210
+            #else
+            Version::GL310
+            #endif
+            #else
+            Version::GLES300
+            #endif
+            , type};
+        shader.addSource(define)
+            .addSource(source);
+        return shader;
+    }
+
+    /* Compiles the shaders and links the program, returns false on failure */
+    bool compileAndLink(MyPublicShader& program, Shader& vert, Shader& frag) {
+        if(!Shader::compile({vert, frag})) return false;
+
+        program.attachShaders({vert, frag});
+        program.bindAttributeLocation(0, "position");
+        return program.link();
+    }
+}
+
+void ProgramBinaryCacheGLTest::binary() {
+    if(!ProgramBinaryCache::isSupported())
+        CORRADE_SKIP("Program binaries are not supported.");
+
+    Shader vert = createShader(Shader::Type::Vertex, VertexSource);
+    Shader frag = createShader(Shader::Type::Fragment, FragmentSource);
+
+    MyPublicShader program;
+    program.setRetrievableBinary(true);
+    CORRADE_VERIFY(compileAndLink(program, vert, frag));
+
+    const std::pair<GLenum, Containers::Array<char>> binary = program.binary();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(!binary.second.empty());
+
+    MyPublicShader loaded;
+    CORRADE_VERIFY(loaded.setBinary(binary.first, binary.second));
+    const Int matrixUniform = loaded.uniformLocation("matrix");
+    const Int colorUniform = loaded.uniformLocation("color");
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(matrixUniform >= 0);
+    CORRADE_VERIFY(colorUniform >= 0);
+    CORRADE_VERIFY(loaded.validate().first);
+}
+
+void ProgramBinaryCacheGLTest::setBinaryInvalid() {
+    if(!ProgramBinaryCache::isSupported())
+        CORRADE_SKIP("Program binaries are not supported.");
+
+    Shader vert = createShader(Shader::Type::Vertex, VertexSource);
+    Shader frag = createShader(Shader::Type::Fragment, FragmentSource);
+
+    /* Get a valid binary format first */
+    MyPublicShader program;
+    program.setRetrievableBinary(true);
+    CORRADE_VERIFY(compileAndLink(program, vert, frag));
+    const GLenum format = program.binary().first;
+
+    const char data[] = "this is definitely not a program binary";
+    MyPublicShader loaded;
+    CORRADE_VERIFY(!loaded.setBinary(format, Containers::arrayView(data)));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ProgramBinaryCacheGLTest::key() {
+    Shader vert = createShader(Shader::Type::Vertex, VertexSource);
+    Shader frag = createShader(Shader::Type::Fragment, FragmentSource);
+    Shader vertDefine = createShader(Shader::Type::Vertex, VertexSource, "#define FOO\n");
+
+    ProgramBinaryCache cache{GL_TEST_OUTPUT_DIR};
+    const std::string a = cache.key({vert, frag});
+
+    CORRADE_COMPARE(a.size(), 40);
+    CORRADE_COMPARE(cache.key({vert, frag}), a);
+    CORRADE_VERIFY(cache.key({frag, vert}) != a);
+    CORRADE_VERIFY(cache.key({vertDefine, frag}) != a);
+}
+
+void ProgramBinaryCacheGLTest::setCurrent() {
+    CORRADE_VERIFY(!ProgramBinaryCache::current());
+
+    {
+        ProgramBinaryCache cache{GL_TEST_OUTPUT_DIR};
+        ProgramBinaryCache::setCurrent(&cache);
+        CORRADE_COMPARE(ProgramBinaryCache::current(), &cache);
+    }
+
+    /* Destructor resets the current cache */
+    CORRADE_VERIFY(!ProgramBinaryCache::current());
+}
+
+void ProgramBinaryCacheGLTest::saveLoad() {
+    if(!ProgramBinaryCache::isSupported())
+        CORRADE_SKIP("Program binaries are not supported.");
+
+    ProgramBinaryCache cache{Utility::Directory::join(GL_TEST_OUTPUT_DIR, "ProgramBinaryCacheGLTestFiles")};
+    CORRADE_COMPARE(cache.directory(), Utility::Directory::join(GL_TEST_OUTPUT_DIR, "ProgramBinaryCacheGLTestFiles"));
+
+    Shader vert = createShader(Shader::Type::Vertex, VertexSource);
+    Shader frag = createShader(Shader::Type::Fragment, FragmentSource);
+    const std::string key = cache.key({vert, frag});
+
+    MyPublicShader program;
+    program.setRetrievableBinary(true);
+    CORRADE_VERIFY(compileAndLink(program, vert, frag));
+    CORRADE_VERIFY(cache.save(program, key));
+    CORRADE_VERIFY(Utility::Directory::fileExists(Utility::Directory::join(cache.directory(), key + ".bin")));
+
+    MyPublicShader loaded;
+    CORRADE_VERIFY(cache.load(loaded, key));
+    const Int matrixUniform = loaded.uniformLocation("matrix");
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(matrixUniform >= 0);
+}
+
+void ProgramBinaryCacheGLTest::loadNotFound() {
+    ProgramBinaryCache cache{Utility::Directory::join(GL_TEST_OUTPUT_DIR, "ProgramBinaryCacheGLTestFiles")};
+
+    MyPublicShader program;
+    CORRADE_VERIFY(!cache.load(program, "nonexistent"));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ProgramBinaryCacheGLTest::loadCachedBinary() {
+    if(!ProgramBinaryCache::isSupported())
+        CORRADE_SKIP("Program binaries are not supported.");
+
+    ProgramBinaryCache cache{Utility::Directory::join(GL_TEST_OUTPUT_DIR, "ProgramBinaryCacheGLTestFiles")};
+    ProgramBinaryCache::setCurrent(&cache);
+
+    /* Make the sources unique so the cache is empty on the first run */
+    Shader vert = createShader(Shader::Type::Vertex, VertexSource, "#define LOAD_CACHED_BINARY\n");
+    Shader frag = createShader(Shader::Type::Fragment, FragmentSource);
+    Utility::Directory::rm(Utility::Directory::join(cache.directory(), cache.key({vert, frag}) + ".bin"));
+
+    MyPublicShader program;
+    CORRADE_VERIFY(!program.loadCachedBinary({vert, frag}));
+    CORRADE_VERIFY(compileAndLink(program, vert, frag));
+    program.saveCachedBinary({vert, frag});
+
+    /* The shaders don't need to be compiled for the second time */
+    Shader vert2 = createShader(Shader::Type::Vertex, VertexSource, "#define LOAD_CACHED_BINARY\n");
+    Shader frag2 = createShader(Shader::Type::Fragment, FragmentSource);
+    MyPublicShader loaded;
+    CORRADE_VERIFY(loaded.loadCachedBinary({vert2, frag2}));
+
+    ProgramBinaryCache::setCurrent(nullptr);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(loaded.uniformLocation("color") >= 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::ProgramBinaryCacheGLTest)
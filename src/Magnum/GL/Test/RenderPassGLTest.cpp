@@ -0,0 +1,184 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Image.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/GL/RenderPass.h"
+#include "Magnum/Math/Color.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+using namespace Math::Literals;
+
+struct RenderPassGLTest: OpenGLTester {
+    explicit RenderPassGLTest();
+
+    void clear();
+    void invalidate();
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    void resolve();
+    #endif
+};
+
+RenderPassGLTest::RenderPassGLTest() {
+    addTests({&RenderPassGLTest::clear,
+              &RenderPassGLTest::invalidate,
+              #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+              &RenderPassGLTest::resolve
+              #endif
+              });
+}
+
+void RenderPassGLTest::clear() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer color, depth;
+    #ifndef MAGNUM_TARGET_GLES2
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{16});
+    #else
+    color.setStorage(RenderbufferFormat::RGBA4, Vector2i{16});
+    #endif
+    depth.setStorage(RenderbufferFormat::DepthComponent16, Vector2i{16});
+
+    Framebuffer framebuffer{{{}, Vector2i{16}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color)
+               .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, depth);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(framebuffer.checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+
+    RenderPass pass{framebuffer};
+    pass.setColorAttachment(0, RenderPassLoadAction::Clear, RenderPassStoreAction::Store, 0xff336699_rgbaf)
+        .setDepthAttachment(RenderPassLoadAction::Clear, RenderPassStoreAction::DontCare);
+
+    pass.begin();
+    CORRADE_VERIFY(pass.isActive());
+    pass.end();
+    CORRADE_VERIFY(!pass.isActive());
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Image2D image = framebuffer.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    /* The color is chosen so it's representable exactly in RGBA4 */
+    CORRADE_COMPARE(image.data<Color4ub>()[0], 0xff336699_rgba);
+}
+
+void RenderPassGLTest::invalidate() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer color, depth;
+    #ifndef MAGNUM_TARGET_GLES2
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{16});
+    #else
+    color.setStorage(RenderbufferFormat::RGBA4, Vector2i{16});
+    #endif
+    depth.setStorage(RenderbufferFormat::DepthComponent16, Vector2i{16});
+
+    Framebuffer framebuffer{{{}, Vector2i{16}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color)
+               .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, depth);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(framebuffer.checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+
+    /* Everything discarded, the invalidation shouldn't produce any errors
+       (or be a no-op if not supported) */
+    RenderPass pass{framebuffer};
+    pass.setColorAttachment(0, RenderPassLoadAction::DontCare, RenderPassStoreAction::DontCare)
+        .setDepthAttachment(RenderPassLoadAction::DontCare, RenderPassStoreAction::DontCare)
+        .begin()
+        .end();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+void RenderPassGLTest::resolve() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::NV::framebuffer_blit>() &&
+       !Context::current().isExtensionSupported<Extensions::ANGLE::framebuffer_blit>())
+        CORRADE_SKIP("Required extension is not available.");
+    #endif
+
+    Renderbuffer multisampleColor, multisampleDepth, color;
+    #ifndef MAGNUM_TARGET_GLES2
+    multisampleColor.setStorageMultisample(4, RenderbufferFormat::RGBA8, Vector2i{16});
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{16});
+    #else
+    multisampleColor.setStorage(RenderbufferFormat::RGBA4, Vector2i{16});
+    color.setStorage(RenderbufferFormat::RGBA4, Vector2i{16});
+    #endif
+    #ifndef MAGNUM_TARGET_GLES2
+    multisampleDepth.setStorageMultisample(4, RenderbufferFormat::DepthComponent16, Vector2i{16});
+    #else
+    multisampleDepth.setStorage(RenderbufferFormat::DepthComponent16, Vector2i{16});
+    #endif
+
+    Framebuffer multisample{{{}, Vector2i{16}}}, resolved{{{}, Vector2i{16}}};
+    multisample.attachRenderbuffer(Framebuffer::ColorAttachment{0}, multisampleColor)
+               .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, multisampleDepth);
+    resolved.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(multisample.checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+    CORRADE_COMPARE(resolved.checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+
+    /* The multisample contents are thrown away after resolving */
+    RenderPass pass{multisample};
+    pass.setColorAttachment(0, RenderPassLoadAction::Clear, RenderPassStoreAction::DontCare, 0xff336699_rgbaf)
+        .setDepthAttachment(RenderPassLoadAction::Clear, RenderPassStoreAction::DontCare)
+        .setResolveFramebuffer(resolved)
+        .begin()
+        .end();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Image2D image = resolved.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(image.data<Color4ub>()[0], 0xff336699_rgba);
+}
+#endif
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::RenderPassGLTest)
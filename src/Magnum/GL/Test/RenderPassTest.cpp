@@ -0,0 +1,134 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/GL/DefaultFramebuffer.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/RenderPass.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct RenderPassTest: TestSuite::Tester {
+    explicit RenderPassTest();
+
+    void construct();
+    void setActions();
+    void setColorAttachmentDefaultFramebuffer();
+    void endNotActive();
+
+    void debugLoadAction();
+    void debugStoreAction();
+};
+
+RenderPassTest::RenderPassTest() {
+    addTests({&RenderPassTest::construct,
+              &RenderPassTest::setActions,
+              &RenderPassTest::setColorAttachmentDefaultFramebuffer,
+              &RenderPassTest::endNotActive,
+
+              &RenderPassTest::debugLoadAction,
+              &RenderPassTest::debugStoreAction});
+}
+
+void RenderPassTest::construct() {
+    Framebuffer framebuffer{NoCreate};
+    RenderPass pass{framebuffer};
+
+    /* No GL calls should be done */
+    CORRADE_COMPARE(&pass.framebuffer(), &framebuffer);
+    CORRADE_VERIFY(!pass.isActive());
+    CORRADE_COMPARE(pass.colorLoadAction(0), RenderPassLoadAction::Load);
+    CORRADE_COMPARE(pass.colorStoreAction(0), RenderPassStoreAction::Store);
+    CORRADE_COMPARE(pass.depthLoadAction(), RenderPassLoadAction::Load);
+    CORRADE_COMPARE(pass.depthStoreAction(), RenderPassStoreAction::Store);
+    CORRADE_COMPARE(pass.stencilLoadAction(), RenderPassLoadAction::Load);
+    CORRADE_COMPARE(pass.stencilStoreAction(), RenderPassStoreAction::Store);
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    CORRADE_VERIFY(!pass.resolveFramebuffer());
+    #endif
+}
+
+void RenderPassTest::setActions() {
+    Framebuffer framebuffer{NoCreate};
+    Framebuffer resolve{NoCreate};
+    RenderPass pass{framebuffer};
+    pass.setColorAttachment(2, RenderPassLoadAction::Clear, RenderPassStoreAction::DontCare)
+        .setDepthAttachment(RenderPassLoadAction::Clear, RenderPassStoreAction::DontCare)
+        .setStencilAttachment(RenderPassLoadAction::DontCare, RenderPassStoreAction::Store);
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    pass.setResolveFramebuffer(resolve);
+    #endif
+
+    /* Attachments in between are left at defaults */
+    CORRADE_COMPARE(pass.colorLoadAction(1), RenderPassLoadAction::Load);
+    CORRADE_COMPARE(pass.colorStoreAction(1), RenderPassStoreAction::Store);
+    CORRADE_COMPARE(pass.colorLoadAction(2), RenderPassLoadAction::Clear);
+    CORRADE_COMPARE(pass.colorStoreAction(2), RenderPassStoreAction::DontCare);
+    CORRADE_COMPARE(pass.colorLoadAction(3), RenderPassLoadAction::Load);
+    CORRADE_COMPARE(pass.depthLoadAction(), RenderPassLoadAction::Clear);
+    CORRADE_COMPARE(pass.depthStoreAction(), RenderPassStoreAction::DontCare);
+    CORRADE_COMPARE(pass.stencilLoadAction(), RenderPassLoadAction::DontCare);
+    CORRADE_COMPARE(pass.stencilStoreAction(), RenderPassStoreAction::Store);
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    CORRADE_COMPARE(pass.resolveFramebuffer(), &resolve);
+    #endif
+}
+
+void RenderPassTest::setColorAttachmentDefaultFramebuffer() {
+    RenderPass pass{defaultFramebuffer};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pass.setColorAttachment(1, RenderPassLoadAction::Clear, RenderPassStoreAction::Store);
+    CORRADE_COMPARE(out.str(), "GL::RenderPass::setColorAttachment(): only attachment 0 is available on the default framebuffer, got 1\n");
+}
+
+void RenderPassTest::endNotActive() {
+    Framebuffer framebuffer{NoCreate};
+    RenderPass pass{framebuffer};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pass.end();
+    CORRADE_COMPARE(out.str(), "GL::RenderPass::end(): the pass is not active\n");
+}
+
+void RenderPassTest::debugLoadAction() {
+    std::ostringstream out;
+    Debug{&out} << RenderPassLoadAction::DontCare << RenderPassLoadAction(0xfe);
+    CORRADE_COMPARE(out.str(), "GL::RenderPassLoadAction::DontCare GL::RenderPassLoadAction(0xfe)\n");
+}
+
+void RenderPassTest::debugStoreAction() {
+    std::ostringstream out;
+    Debug{&out} << RenderPassStoreAction::DontCare << RenderPassStoreAction(0xfe);
+    CORRADE_COMPARE(out.str(), "GL::RenderPassStoreAction::DontCare GL::RenderPassStoreAction(0xfe)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::RenderPassTest)
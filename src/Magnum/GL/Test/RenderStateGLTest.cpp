@@ -0,0 +1,172 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/RenderState.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct RenderStateGLTest: OpenGLTester {
+    explicit RenderStateGLTest();
+
+    void apply();
+    void applyDefaults();
+    void rendererChangesState();
+    void resetState();
+};
+
+RenderStateGLTest::RenderStateGLTest() {
+    addTests({&RenderStateGLTest::apply,
+              &RenderStateGLTest::applyDefaults,
+              &RenderStateGLTest::rendererChangesState,
+              &RenderStateGLTest::resetState});
+}
+
+namespace {
+
+/* Queried directly from GL to verify what actually got applied */
+GLint integer(GLenum parameter) {
+    GLint value;
+    glGetIntegerv(parameter, &value);
+    return value;
+}
+
+RenderState transparent() {
+    RenderState state;
+    state.setBlending(true)
+        .setBlendEquation(Renderer::BlendEquation::Subtract, Renderer::BlendEquation::Add)
+        .setBlendFunction(Renderer::BlendFunction::SourceAlpha, Renderer::BlendFunction::OneMinusSourceAlpha, Renderer::BlendFunction::One, Renderer::BlendFunction::Zero)
+        .setDepthTest(true)
+        .setDepthFunction(Renderer::DepthFunction::LessOrEqual)
+        .setDepthMask(false)
+        .setFaceCulling(true)
+        .setFaceCullingMode(Renderer::PolygonFacing::Front)
+        .setStencilTest(true)
+        .setStencilFunction(Renderer::StencilFunction::Equal, 3, 0x0f)
+        .setStencilOperation(Renderer::StencilOperation::Zero, Renderer::StencilOperation::Replace, Renderer::StencilOperation::Invert)
+        .setStencilMask(0xf0)
+        .setColorMask(true, false, true, false);
+    return state;
+}
+
+}
+
+void RenderStateGLTest::apply() {
+    transparent().apply();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_VERIFY(glIsEnabled(GL_BLEND));
+    CORRADE_COMPARE(integer(GL_BLEND_EQUATION_RGB), GL_FUNC_SUBTRACT);
+    CORRADE_COMPARE(integer(GL_BLEND_EQUATION_ALPHA), GL_FUNC_ADD);
+    CORRADE_COMPARE(integer(GL_BLEND_SRC_RGB), GL_SRC_ALPHA);
+    CORRADE_COMPARE(integer(GL_BLEND_DST_RGB), GL_ONE_MINUS_SRC_ALPHA);
+    CORRADE_COMPARE(integer(GL_BLEND_SRC_ALPHA), GL_ONE);
+    CORRADE_COMPARE(integer(GL_BLEND_DST_ALPHA), GL_ZERO);
+    CORRADE_VERIFY(glIsEnabled(GL_DEPTH_TEST));
+    CORRADE_COMPARE(integer(GL_DEPTH_FUNC), GL_LEQUAL);
+    CORRADE_COMPARE(integer(GL_DEPTH_WRITEMASK), GL_FALSE);
+    CORRADE_VERIFY(glIsEnabled(GL_CULL_FACE));
+    CORRADE_COMPARE(integer(GL_CULL_FACE_MODE), GL_FRONT);
+    CORRADE_VERIFY(glIsEnabled(GL_STENCIL_TEST));
+    CORRADE_COMPARE(integer(GL_STENCIL_FUNC), GL_EQUAL);
+    CORRADE_COMPARE(integer(GL_STENCIL_REF), 3);
+    CORRADE_COMPARE(integer(GL_STENCIL_VALUE_MASK), 0x0f);
+    CORRADE_COMPARE(integer(GL_STENCIL_FAIL), GL_ZERO);
+    CORRADE_COMPARE(integer(GL_STENCIL_PASS_DEPTH_FAIL), GL_REPLACE);
+    CORRADE_COMPARE(integer(GL_STENCIL_PASS_DEPTH_PASS), GL_INVERT);
+    CORRADE_COMPARE(integer(GL_STENCIL_WRITEMASK), 0xf0);
+
+    GLboolean colorMask[4];
+    glGetBooleanv(GL_COLOR_WRITEMASK, colorMask);
+    CORRADE_VERIFY(colorMask[0]);
+    CORRADE_VERIFY(!colorMask[1]);
+    CORRADE_VERIFY(colorMask[2]);
+    CORRADE_VERIFY(!colorMask[3]);
+
+    RenderState{}.apply();
+}
+
+void RenderStateGLTest::applyDefaults() {
+    transparent().apply();
+    RenderState{}.apply();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_VERIFY(!glIsEnabled(GL_BLEND));
+    CORRADE_COMPARE(integer(GL_BLEND_EQUATION_RGB), GL_FUNC_ADD);
+    CORRADE_COMPARE(integer(GL_BLEND_SRC_RGB), GL_ONE);
+    CORRADE_COMPARE(integer(GL_BLEND_DST_RGB), GL_ZERO);
+    CORRADE_VERIFY(!glIsEnabled(GL_DEPTH_TEST));
+    CORRADE_COMPARE(integer(GL_DEPTH_FUNC), GL_LESS);
+    CORRADE_COMPARE(integer(GL_DEPTH_WRITEMASK), GL_TRUE);
+    CORRADE_VERIFY(!glIsEnabled(GL_CULL_FACE));
+    CORRADE_COMPARE(integer(GL_CULL_FACE_MODE), GL_BACK);
+    CORRADE_VERIFY(!glIsEnabled(GL_STENCIL_TEST));
+    CORRADE_COMPARE(integer(GL_STENCIL_FUNC), GL_ALWAYS);
+    CORRADE_COMPARE(integer(GL_STENCIL_FAIL), GL_KEEP);
+}
+
+void RenderStateGLTest::rendererChangesState() {
+    const RenderState state = transparent();
+    state.apply();
+
+    /* Changing the state directly through Renderer marks the tracked state
+       as unknown, so applying the same block again restores it */
+    Renderer::disable(Renderer::Feature::Blending);
+    Renderer::setDepthFunction(Renderer::DepthFunction::Always);
+    Renderer::setStencilMask(0x01);
+    state.apply();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(glIsEnabled(GL_BLEND));
+    CORRADE_COMPARE(integer(GL_DEPTH_FUNC), GL_LEQUAL);
+    CORRADE_COMPARE(integer(GL_STENCIL_WRITEMASK), 0xf0);
+
+    RenderState{}.apply();
+}
+
+void RenderStateGLTest::resetState() {
+    const RenderState state = transparent();
+    state.apply();
+
+    /* Simulating third-party code, invisible to the state tracker */
+    glDisable(GL_DEPTH_TEST);
+    glCullFace(GL_BACK);
+
+    Context::current().resetState(Context::State::Renderer);
+    state.apply();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(glIsEnabled(GL_DEPTH_TEST));
+    CORRADE_COMPARE(integer(GL_CULL_FACE_MODE), GL_FRONT);
+
+    RenderState{}.apply();
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::RenderStateGLTest)
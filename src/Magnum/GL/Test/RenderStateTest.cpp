@@ -0,0 +1,131 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/GL/RenderState.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct RenderStateTest: TestSuite::Tester {
+    explicit RenderStateTest();
+
+    void construct();
+    void setters();
+    void compare();
+};
+
+RenderStateTest::RenderStateTest() {
+    addTests({&RenderStateTest::construct,
+              &RenderStateTest::setters,
+              &RenderStateTest::compare});
+}
+
+void RenderStateTest::construct() {
+    const RenderState state;
+    CORRADE_VERIFY(!state.isBlendingEnabled());
+    CORRADE_VERIFY(state.blendEquationRgb() == Renderer::BlendEquation::Add);
+    CORRADE_VERIFY(state.blendEquationAlpha() == Renderer::BlendEquation::Add);
+    CORRADE_VERIFY(state.blendSourceRgb() == Renderer::BlendFunction::One);
+    CORRADE_VERIFY(state.blendDestinationRgb() == Renderer::BlendFunction::Zero);
+    CORRADE_VERIFY(state.blendSourceAlpha() == Renderer::BlendFunction::One);
+    CORRADE_VERIFY(state.blendDestinationAlpha() == Renderer::BlendFunction::Zero);
+    CORRADE_VERIFY(!state.isDepthTestEnabled());
+    CORRADE_VERIFY(state.depthFunction() == Renderer::DepthFunction::Less);
+    CORRADE_VERIFY(state.depthMask());
+    CORRADE_VERIFY(!state.isFaceCullingEnabled());
+    CORRADE_VERIFY(state.faceCullingMode() == Renderer::PolygonFacing::Back);
+    CORRADE_VERIFY(!state.isStencilTestEnabled());
+    CORRADE_VERIFY(state.stencilFunction() == Renderer::StencilFunction::Always);
+    CORRADE_COMPARE(state.stencilReferenceValue(), 0);
+    CORRADE_COMPARE(state.stencilFunctionMask(), ~0u);
+    CORRADE_VERIFY(state.stencilFail() == Renderer::StencilOperation::Keep);
+    CORRADE_VERIFY(state.stencilDepthFail() == Renderer::StencilOperation::Keep);
+    CORRADE_VERIFY(state.stencilDepthPass() == Renderer::StencilOperation::Keep);
+    CORRADE_COMPARE(state.stencilMask(), ~0u);
+    CORRADE_COMPARE(state.colorMask(), Math::BoolVector<4>{0xf});
+}
+
+void RenderStateTest::setters() {
+    RenderState state;
+    state.setBlending(true)
+        .setBlendEquation(Renderer::BlendEquation::Subtract, Renderer::BlendEquation::Add)
+        .setBlendFunction(Renderer::BlendFunction::SourceAlpha, Renderer::BlendFunction::OneMinusSourceAlpha)
+        .setDepthTest(true)
+        .setDepthFunction(Renderer::DepthFunction::LessOrEqual)
+        .setDepthMask(false)
+        .setFaceCulling(true)
+        .setFaceCullingMode(Renderer::PolygonFacing::Front)
+        .setStencilTest(true)
+        .setStencilFunction(Renderer::StencilFunction::Equal, 3, 0x0f)
+        .setStencilOperation(Renderer::StencilOperation::Zero, Renderer::StencilOperation::Replace, Renderer::StencilOperation::Invert)
+        .setStencilMask(0xf0)
+        .setColorMask(true, false, true, false);
+
+    CORRADE_VERIFY(state.isBlendingEnabled());
+    CORRADE_VERIFY(state.blendEquationRgb() == Renderer::BlendEquation::Subtract);
+    CORRADE_VERIFY(state.blendEquationAlpha() == Renderer::BlendEquation::Add);
+    CORRADE_VERIFY(state.blendSourceRgb() == Renderer::BlendFunction::SourceAlpha);
+    CORRADE_VERIFY(state.blendDestinationRgb() == Renderer::BlendFunction::OneMinusSourceAlpha);
+    CORRADE_VERIFY(state.blendSourceAlpha() == Renderer::BlendFunction::SourceAlpha);
+    CORRADE_VERIFY(state.blendDestinationAlpha() == Renderer::BlendFunction::OneMinusSourceAlpha);
+    CORRADE_VERIFY(state.isDepthTestEnabled());
+    CORRADE_VERIFY(state.depthFunction() == Renderer::DepthFunction::LessOrEqual);
+    CORRADE_VERIFY(!state.depthMask());
+    CORRADE_VERIFY(state.isFaceCullingEnabled());
+    CORRADE_VERIFY(state.faceCullingMode() == Renderer::PolygonFacing::Front);
+    CORRADE_VERIFY(state.isStencilTestEnabled());
+    CORRADE_VERIFY(state.stencilFunction() == Renderer::StencilFunction::Equal);
+    CORRADE_COMPARE(state.stencilReferenceValue(), 3);
+    CORRADE_COMPARE(state.stencilFunctionMask(), 0x0f);
+    CORRADE_VERIFY(state.stencilFail() == Renderer::StencilOperation::Zero);
+    CORRADE_VERIFY(state.stencilDepthFail() == Renderer::StencilOperation::Replace);
+    CORRADE_VERIFY(state.stencilDepthPass() == Renderer::StencilOperation::Invert);
+    CORRADE_COMPARE(state.stencilMask(), 0xf0);
+    CORRADE_COMPARE(state.colorMask(), Math::BoolVector<4>{0x5});
+
+    /* Single-value overloads set both */
+    state.setBlendEquation(Renderer::BlendEquation::Subtract);
+    CORRADE_VERIFY(state.blendEquationAlpha() == Renderer::BlendEquation::Subtract);
+}
+
+void RenderStateTest::compare() {
+    RenderState a, b;
+    CORRADE_VERIFY(a == b);
+    CORRADE_VERIFY(!(a != b));
+
+    b.setStencilFunction(Renderer::StencilFunction::Always, 0, 0xff);
+    CORRADE_VERIFY(a != b);
+
+    a.setStencilFunction(Renderer::StencilFunction::Always, 0, 0xff);
+    CORRADE_VERIFY(a == b);
+
+    a.setColorMask(true, true, true, false);
+    CORRADE_VERIFY(a != b);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::RenderStateTest)
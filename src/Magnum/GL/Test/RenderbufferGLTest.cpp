@@ -28,6 +28,7 @@
 #include "Magnum/GL/OpenGLTester.h"
 #include "Magnum/GL/Renderbuffer.h"
 #include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector2.h"
 
 namespace Magnum { namespace GL { namespace Test {
@@ -166,6 +167,11 @@ void RenderbufferGLTest::setStorage() {
     #endif
 
     MAGNUM_VERIFY_NO_GL_ERROR();
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(renderbuffer.memoryUsage(), 128*128*4);
+    #else
+    CORRADE_COMPARE(renderbuffer.memoryUsage(), 128*128*2);
+    #endif
 }
 
 #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
@@ -188,6 +194,11 @@ void RenderbufferGLTest::setStorageMultisample() {
     #endif
 
     MAGNUM_VERIFY_NO_GL_ERROR();
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(renderbuffer.memoryUsage(), std::size_t(128*128*4*Math::max(Renderbuffer::maxSamples(), 1)));
+    #else
+    CORRADE_COMPARE(renderbuffer.memoryUsage(), std::size_t(128*128*2*Math::max(Renderbuffer::maxSamples(), 1)));
+    #endif
 }
 #endif
 
@@ -0,0 +1,193 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/RingBuffer.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct RingBufferGLTest: OpenGLTester {
+    explicit RingBufferGLTest();
+
+    void construct();
+    void constructMove();
+
+    void allocate();
+    void allocateAligned();
+    void allocateNotEnoughSpace();
+    void wrapAround();
+};
+
+RingBufferGLTest::RingBufferGLTest() {
+    addTests({&RingBufferGLTest::construct,
+              &RingBufferGLTest::constructMove,
+
+              &RingBufferGLTest::allocate,
+              &RingBufferGLTest::allocateAligned,
+              &RingBufferGLTest::allocateNotEnoughSpace,
+              &RingBufferGLTest::wrapAround});
+}
+
+void RingBufferGLTest::construct() {
+    {
+        RingBuffer ring{64, 2, Buffer::TargetHint::Uniform};
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_VERIFY(ring.buffer().id() > 0);
+        CORRADE_COMPARE(ring.buffer().targetHint(), Buffer::TargetHint::Uniform);
+        CORRADE_COMPARE(ring.buffer().size(), 128);
+        CORRADE_COMPARE(ring.frameSize(), 64);
+        CORRADE_COMPARE(ring.frameCount(), 2);
+        CORRADE_COMPARE(ring.frameOffset(), 0);
+        CORRADE_COMPARE(ring.remaining(), 64);
+        #ifndef MAGNUM_TARGET_GLES
+        CORRADE_COMPARE(ring.isPersistent(), Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>());
+        #else
+        CORRADE_VERIFY(!ring.isPersistent());
+        #endif
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void RingBufferGLTest::constructMove() {
+    RingBuffer a{64, 2};
+    const Int id = a.buffer().id();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    RingBuffer b{std::move(a)};
+    CORRADE_COMPARE(a.buffer().id(), 0);
+    CORRADE_COMPARE(a.frameCount(), 0);
+    CORRADE_COMPARE(b.buffer().id(), id);
+    CORRADE_COMPARE(b.frameSize(), 64);
+
+    RingBuffer c{32, 3};
+    const Int cId = c.buffer().id();
+    c = std::move(b);
+    CORRADE_COMPARE(b.buffer().id(), cId);
+    CORRADE_COMPARE(b.frameSize(), 32);
+    CORRADE_COMPARE(c.buffer().id(), id);
+    CORRADE_COMPARE(c.frameCount(), 2);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void RingBufferGLTest::allocate() {
+    RingBuffer ring{64, 2};
+
+    GLintptr offset;
+    Containers::ArrayView<char> data;
+    std::tie(offset, data) = ring.allocate(8);
+    CORRADE_COMPARE(offset, 0);
+    CORRADE_COMPARE(data.size(), 8);
+    for(std::size_t i = 0; i != 8; ++i) data[i] = char(i + 1);
+
+    std::tie(offset, data) = ring.allocate(3);
+    CORRADE_COMPARE(offset, 8);
+    CORRADE_COMPARE(data.size(), 3);
+    for(std::size_t i = 0; i != 3; ++i) data[i] = char(i + 9);
+    CORRADE_COMPARE(ring.remaining(), 64 - 11);
+
+    ring.flush();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr char expected[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    CORRADE_COMPARE_AS(ring.buffer().subData(0, 11),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void RingBufferGLTest::allocateAligned() {
+    RingBuffer ring{64, 2};
+
+    CORRADE_COMPARE(ring.allocate(3).first, 0);
+    CORRADE_COMPARE(ring.allocate(4).first, 4);
+    CORRADE_COMPARE(ring.allocate(1, 16).first, 16);
+
+    /* Alignment doesn't need to be a power of two */
+    CORRADE_COMPARE(ring.allocate(1, 12).first, 24);
+
+    /* Offsets are aligned in the whole buffer, not just the frame */
+    ring.endFrame();
+    CORRADE_COMPARE(ring.frameOffset(), 64);
+    CORRADE_COMPARE(ring.allocate(1).first, 64);
+    CORRADE_COMPARE(ring.allocate(1, 48).first, 96);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void RingBufferGLTest::allocateNotEnoughSpace() {
+    RingBuffer ring{16, 2};
+
+    CORRADE_VERIFY(ring.allocate(12).second);
+    CORRADE_VERIFY(!ring.allocate(8).second);
+    /* Padding for alignment doesn't fit either */
+    CORRADE_VERIFY(!ring.allocate(1, 16).second);
+    CORRADE_VERIFY(ring.allocate(4).second);
+    CORRADE_COMPARE(ring.remaining(), 0);
+
+    /* A new frame has the whole space again */
+    ring.endFrame();
+    CORRADE_VERIFY(ring.allocate(16).second);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void RingBufferGLTest::wrapAround() {
+    /* More frames than there's parts in the ring, the last ones reuse the
+       first parts, which has to wait for the GPU */
+    RingBuffer ring{4, 2};
+    for(Int i = 0; i != 5; ++i) {
+        GLintptr offset;
+        Containers::ArrayView<char> data;
+        std::tie(offset, data) = ring.allocate(4);
+        CORRADE_COMPARE(offset, (i % 2)*4);
+        for(std::size_t j = 0; j != 4; ++j) data[j] = char(i*4 + j);
+        ring.endFrame();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr char expected[] = {16, 17, 18, 19, 12, 13, 14, 15};
+    CORRADE_COMPARE_AS(ring.buffer().data(),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::RingBufferGLTest)
@@ -0,0 +1,91 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/GL/RingBuffer.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct RingBufferTest: TestSuite::Tester {
+    explicit RingBufferTest();
+
+    void constructNoCreate();
+    void constructCopy();
+
+    void allocateNoCreate();
+    void allocateZeroAlignment();
+};
+
+RingBufferTest::RingBufferTest() {
+    addTests({&RingBufferTest::constructNoCreate,
+              &RingBufferTest::constructCopy,
+
+              &RingBufferTest::allocateNoCreate,
+              &RingBufferTest::allocateZeroAlignment});
+}
+
+void RingBufferTest::constructNoCreate() {
+    {
+        RingBuffer ring{NoCreate};
+        CORRADE_COMPARE(ring.buffer().id(), 0);
+        CORRADE_COMPARE(ring.frameSize(), 0);
+        CORRADE_COMPARE(ring.frameCount(), 0);
+
+        /* No GL calls should be done */
+        ring.flush();
+        ring.endFrame();
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void RingBufferTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<RingBuffer, const RingBuffer&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<RingBuffer, const RingBuffer&>{}));
+}
+
+void RingBufferTest::allocateNoCreate() {
+    RingBuffer ring{NoCreate};
+
+    auto allocation = ring.allocate(16);
+    CORRADE_COMPARE(allocation.first, 0);
+    CORRADE_VERIFY(!allocation.second);
+}
+
+void RingBufferTest::allocateZeroAlignment() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    RingBuffer ring{NoCreate};
+    ring.allocate(16, 0);
+    CORRADE_COMPARE(out.str(), "GL::RingBuffer::allocate(): expected non-zero alignment\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::RingBufferTest)
@@ -51,6 +51,7 @@ struct ShaderGLTest: OpenGLTester {
     void compile();
     void compileUtf8();
     void compileNoVersion();
+    void compileAsync();
 };
 
 ShaderGLTest::ShaderGLTest() {
@@ -67,7 +68,8 @@ ShaderGLTest::ShaderGLTest() {
               &ShaderGLTest::addFile,
               &ShaderGLTest::compile,
               &ShaderGLTest::compileUtf8,
-              &ShaderGLTest::compileNoVersion});
+              &ShaderGLTest::compileNoVersion,
+              &ShaderGLTest::compileAsync});
 }
 
 void ShaderGLTest::construct() {
@@ -298,6 +300,43 @@ void ShaderGLTest::compileNoVersion() {
     CORRADE_VERIFY(shader.compile());
 }
 
+void ShaderGLTest::compileAsync() {
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Version v =
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        ;
+    #else
+    constexpr Version v = Version::GLES200;
+    #endif
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(!Context::current().isExtensionSupported<Extensions::KHR::parallel_shader_compile>())
+        Debug() << Extensions::KHR::parallel_shader_compile::string() << "not supported, compilation will be blocking";
+
+    Shader::setMaxCompilerThreads(2);
+    #endif
+
+    Shader shader(v, Shader::Type::Fragment);
+    shader.addSource("void main() {}\n");
+    Shader shader2(v, Shader::Type::Fragment);
+    shader2.addSource("[fu] bleh error #:! stuff\n");
+
+    Shader::submitCompile({shader, shader2});
+    while(!shader.isCompileFinished() || !shader2.isCompileFinished()) {}
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(shader.checkCompile());
+
+    {
+        Error redirectError{nullptr};
+        CORRADE_VERIFY(!shader2.checkCompile());
+    }
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::GL::Test::ShaderGLTest)
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 
 #include "Magnum/Image.h"
@@ -78,6 +79,12 @@ struct TextureGLTest: OpenGLTester {
     void bindImage3D();
     #endif
 
+    void bindDeferred2D();
+
+    #ifndef MAGNUM_TARGET_GLES
+    void bindlessHandle2D();
+    #endif
+
     #ifndef MAGNUM_TARGET_GLES
     template<class T> void sampling1D();
     #endif
@@ -132,6 +139,9 @@ struct TextureGLTest: OpenGLTester {
     #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
     void storage3D();
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    void sparseStorage2D();
+    #endif
 
     #ifndef MAGNUM_TARGET_GLES
     void image1D();
@@ -462,6 +472,12 @@ TextureGLTest::TextureGLTest() {
         &TextureGLTest::bindImage3D,
         #endif
 
+        &TextureGLTest::bindDeferred2D,
+
+        #ifndef MAGNUM_TARGET_GLES
+        &TextureGLTest::bindlessHandle2D,
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         &TextureGLTest::sampling1D<GenericSampler>,
         &TextureGLTest::sampling1D<GLSampler>,
@@ -517,7 +533,10 @@ TextureGLTest::TextureGLTest() {
         #endif
         &TextureGLTest::storage2D,
         #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
-        &TextureGLTest::storage3D
+        &TextureGLTest::storage3D,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        &TextureGLTest::sparseStorage2D
         #endif
         });
 
@@ -882,6 +901,57 @@ void TextureGLTest::bindImage3D() {
 }
 #endif
 
+void TextureGLTest::bindDeferred2D() {
+    Texture2D a, b;
+    a.bindDeferred(3);
+    b.bindDeferred(5);
+    /* This overrides the previous one */
+    a.bindDeferred(5);
+    AbstractTexture::flushDeferredBindings();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Both units have the texture already bound, so nothing is done */
+    Context::current().resetStatistics();
+    a.bindDeferred(3);
+    a.bindDeferred(5);
+    AbstractTexture::flushDeferredBindings();
+    CORRADE_COMPARE(Context::current().statistics().bindCount, 0);
+    CORRADE_COMPARE(Context::current().statistics().elidedBindCount, 2);
+
+    /* Flushing with nothing deferred is a no-op */
+    AbstractTexture::flushDeferredBindings();
+    CORRADE_COMPARE(Context::current().statistics().elidedBindCount, 2);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void TextureGLTest::bindlessHandle2D() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::ARB::bindless_texture::string() + std::string(" is not supported."));
+
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{32});
+
+    const UnsignedLong handle = texture.handle();
+    CORRADE_VERIFY(handle);
+    CORRADE_VERIFY(!AbstractTexture::isHandleResident(handle));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    AbstractTexture::makeHandleResident(handle);
+    CORRADE_VERIFY(AbstractTexture::isHandleResident(handle));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    AbstractTexture::makeHandleNonResident(handle);
+    CORRADE_VERIFY(!AbstractTexture::isHandleResident(handle));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+#endif
+
 #ifndef MAGNUM_TARGET_GLES
 template<class T> void TextureGLTest::sampling1D() {
     setTestCaseName(std::is_same<T, GenericSampler>::value ?
@@ -1246,6 +1316,7 @@ void TextureGLTest::storage2D() {
         Vector2i(32));
 
     MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(texture.memoryUsage(), (32*32 + 16*16 + 8*8 + 4*4 + 2*2)*4);
 
     #ifndef MAGNUM_TARGET_GLES2
     #ifdef MAGNUM_TARGET_GLES
@@ -1294,6 +1365,34 @@ void TextureGLTest::storage3D() {
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void TextureGLTest::sparseStorage2D() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::ARB::sparse_texture::string() + std::string(" is not supported."));
+    if(!Texture2D::sparsePageSizeCount(TextureFormat::RGBA8))
+        CORRADE_SKIP("RGBA8 can't be used for sparse textures.");
+
+    const Vector2i pageSize = Texture2D::sparsePageSize(TextureFormat::RGBA8);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(pageSize.product());
+
+    Texture2D texture;
+    texture.setSparseStorage(1, TextureFormat::RGBA8, pageSize*Vector2i{4, 2});
+    CORRADE_COMPARE(texture.sparseLevelCount(), 1);
+
+    /* Commit a single page and upload data to it */
+    Containers::Array<char> data{Containers::ValueInit, std::size_t(pageSize.product()*4)};
+    texture.commitPages(0, pageSize*Vector2i{1, 1}, pageSize)
+        .setSubImage(0, pageSize*Vector2i{1, 1}, ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, pageSize, data});
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    texture.decommitPages(0, pageSize*Vector2i{1, 1}, pageSize);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+#endif
+
 namespace {
 
 }
@@ -1500,6 +1599,10 @@ void TextureGLTest::image2D() {
 
     MAGNUM_VERIFY_NO_GL_ERROR();
 
+    /* The size is estimated from the internal format, pixel storage doesn't
+       affect it */
+    CORRADE_COMPARE(texture.memoryUsage(), 2*2*4);
+
     /** @todo How to test this on ES? */
     #ifndef MAGNUM_TARGET_GLES
     Image2D image = texture.image(0, {PixelStorage2DData[testCaseInstanceId()].storage,
@@ -0,0 +1,205 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/GL/TextureUploader.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct TextureUploaderGLTest: OpenGLTester {
+    explicit TextureUploaderGLTest();
+
+    void construct();
+    void constructMove();
+
+    void setSubImage();
+    void setSubImageNotEnoughSpace();
+    void setCompressedSubImage();
+    void ringWrapAround();
+};
+
+TextureUploaderGLTest::TextureUploaderGLTest() {
+    addTests({&TextureUploaderGLTest::construct,
+              &TextureUploaderGLTest::constructMove,
+
+              &TextureUploaderGLTest::setSubImage,
+              &TextureUploaderGLTest::setSubImageNotEnoughSpace,
+              &TextureUploaderGLTest::setCompressedSubImage,
+              &TextureUploaderGLTest::ringWrapAround});
+}
+
+namespace {
+    constexpr UnsignedByte Data[]{
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+    };
+}
+
+void TextureUploaderGLTest::construct() {
+    {
+        TextureUploader uploader{1024, 2};
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_COMPARE(uploader.frameSize(), 1024);
+        CORRADE_COMPARE(uploader.frameCount(), 2);
+        CORRADE_COMPARE(uploader.remaining(), 1024);
+        #ifndef MAGNUM_TARGET_GLES
+        CORRADE_COMPARE(uploader.isPersistent(), Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>());
+        #else
+        CORRADE_VERIFY(!uploader.isPersistent());
+        #endif
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void TextureUploaderGLTest::constructMove() {
+    TextureUploader a{1024, 2};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    TextureUploader b{std::move(a)};
+    CORRADE_COMPARE(a.frameCount(), 0);
+    CORRADE_COMPARE(b.frameSize(), 1024);
+    CORRADE_COMPARE(b.frameCount(), 2);
+
+    TextureUploader c{512, 3};
+    c = std::move(b);
+    CORRADE_COMPARE(b.frameSize(), 512);
+    CORRADE_COMPARE(b.frameCount(), 3);
+    CORRADE_COMPARE(c.frameSize(), 1024);
+    CORRADE_COMPARE(c.frameCount(), 2);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void TextureUploaderGLTest::setSubImage() {
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{2});
+
+    TextureUploader uploader{1024};
+    Containers::ArrayView<char> data = uploader.setSubImage(texture, 0, {},
+        PixelStorage{}, PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i{2});
+    CORRADE_COMPARE(data.size(), sizeof(Data));
+    CORRADE_COMPARE(uploader.remaining(), 1024 - sizeof(Data));
+    std::copy(Data, Data + sizeof(Data), data.begin());
+
+    uploader.endFrame();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(uploader.remaining(), 1024);
+
+    /** @todo How to test this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image = texture.image(0, {PixelFormat::RGBA, PixelType::UnsignedByte});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(Containers::arrayCast<UnsignedByte>(image.data()),
+        Containers::arrayView(Data),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void TextureUploaderGLTest::setSubImageNotEnoughSpace() {
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{4});
+
+    TextureUploader uploader{24};
+    CORRADE_VERIFY(uploader.setSubImage(texture, 0, {}, Magnum::PixelFormat::RGBA8Unorm, Vector2i{2}));
+
+    /* The next reservation is aligned to 16 bytes, so even a single pixel
+       doesn't fit anymore */
+    CORRADE_VERIFY(!uploader.setSubImage(texture, 0, {}, Magnum::PixelFormat::RGBA8Unorm, Vector2i{1}));
+
+    uploader.endFrame();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* A new frame has the whole space again */
+    CORRADE_VERIFY(uploader.setSubImage(texture, 0, {}, Magnum::PixelFormat::RGBA8Unorm, Vector2i{1}));
+}
+
+void TextureUploaderGLTest::setCompressedSubImage() {
+    if(!Context::current().isExtensionSupported<Extensions::EXT::texture_compression_s3tc>())
+        CORRADE_SKIP(Extensions::EXT::texture_compression_s3tc::string() + std::string(" is not supported."));
+
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::CompressedRGBAS3tcDxt3, Vector2i{4});
+
+    TextureUploader uploader{1024};
+    Containers::ArrayView<char> data = uploader.setCompressedSubImage(texture, 0, {}, CompressedPixelFormat::RGBAS3tcDxt3, Vector2i{4}, sizeof(Data));
+    CORRADE_COMPARE(data.size(), sizeof(Data));
+    std::copy(Data, Data + sizeof(Data), data.begin());
+
+    uploader.endFrame();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to test this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    CompressedImage2D image = texture.compressedImage(0, {});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(Containers::arrayCast<UnsignedByte>(image.data()),
+        Containers::arrayView(Data),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void TextureUploaderGLTest::ringWrapAround() {
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{2, 5});
+
+    /* More frames than there's buffers in the ring, each going to a different
+       row. The last frame reuses the first buffer, which has to wait for the
+       first upload to finish. */
+    TextureUploader uploader{64, 2};
+    for(Int i = 0; i != 5; ++i) {
+        Containers::ArrayView<char> data = uploader.setSubImage(texture, 0, {0, i}, PixelStorage{}, PixelFormat::RGBA, PixelType::UnsignedByte, {2, 1});
+        CORRADE_COMPARE(data.size(), 8);
+        for(std::size_t j = 0; j != 8; ++j) data[j] = char(i*8 + j);
+        uploader.endFrame();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to test this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image = texture.image(0, {PixelFormat::RGBA, PixelType::UnsignedByte});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    Containers::ArrayView<const UnsignedByte> pixels = Containers::arrayCast<const UnsignedByte>(image.data());
+    CORRADE_COMPARE(pixels.size(), 40);
+    for(std::size_t i = 0; i != 40; ++i) CORRADE_COMPARE(pixels[i], i);
+    #endif
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::TextureUploaderGLTest)
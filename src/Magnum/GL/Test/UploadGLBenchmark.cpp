@@ -0,0 +1,184 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Vector2.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+/* Compares the various buffer and texture upload paths. As with
+   MeshGLBenchmark, each benchmark is registered for both wall time and GPU
+   time measurement. */
+struct UploadGLBenchmark: OpenGLTester {
+    explicit UploadGLBenchmark();
+
+    void bufferSetData();
+    void bufferSetSubData();
+    void bufferSetSubDataInvalidate();
+    #ifndef MAGNUM_TARGET_WEBGL
+    void bufferMapRange();
+    #endif
+
+    void textureSetImage();
+    void textureSetSubImage();
+
+    private:
+        Containers::Array<char> _data;
+};
+
+namespace {
+    enum: std::size_t { BufferSize = 1024*1024 };
+
+    /* Same byte size as the buffer */
+    constexpr Vector2i TextureSize{512, 512};
+}
+
+UploadGLBenchmark::UploadGLBenchmark(): _data{Containers::ValueInit, BufferSize} {
+    for(auto type: {
+        BenchmarkType::Default,
+        #ifndef MAGNUM_TARGET_WEBGL
+        BenchmarkType::GpuTime
+        #endif
+    }) {
+        addBenchmarks({&UploadGLBenchmark::bufferSetData,
+                       &UploadGLBenchmark::bufferSetSubData,
+                       &UploadGLBenchmark::bufferSetSubDataInvalidate,
+                       #ifndef MAGNUM_TARGET_WEBGL
+                       &UploadGLBenchmark::bufferMapRange,
+                       #endif
+
+                       &UploadGLBenchmark::textureSetImage,
+                       &UploadGLBenchmark::textureSetSubImage}, 10, type);
+    }
+
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        _data[i] = char(i*37);
+}
+
+void UploadGLBenchmark::bufferSetData() {
+    Buffer buffer;
+
+    /* Reallocates the storage every time */
+    CORRADE_BENCHMARK(10)
+        buffer.setData(_data, BufferUsage::StreamDraw);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void UploadGLBenchmark::bufferSetSubData() {
+    Buffer buffer;
+    buffer.setData({nullptr, BufferSize}, BufferUsage::StreamDraw);
+
+    CORRADE_BENCHMARK(10)
+        buffer.setSubData(0, _data);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void UploadGLBenchmark::bufferSetSubDataInvalidate() {
+    Buffer buffer;
+    buffer.setData({nullptr, BufferSize}, BufferUsage::StreamDraw);
+
+    /* Invalidation should allow the driver to avoid waiting for the previous
+       upload. It's a no-op if ARB_invalidate_subdata is not available. */
+    CORRADE_BENCHMARK(10) {
+        buffer.invalidateData();
+        buffer.setSubData(0, _data);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+#ifndef MAGNUM_TARGET_WEBGL
+void UploadGLBenchmark::bufferMapRange() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    Buffer buffer;
+    buffer.setData({nullptr, BufferSize}, BufferUsage::StreamDraw);
+
+    CORRADE_BENCHMARK(10) {
+        Containers::ArrayView<char> mapped = buffer.map(0, BufferSize, Buffer::MapFlag::Write|Buffer::MapFlag::InvalidateBuffer);
+        std::memcpy(mapped.data(), _data.data(), BufferSize);
+        buffer.unmap();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+#endif
+
+void UploadGLBenchmark::textureSetImage() {
+    Texture2D texture;
+    ImageView2D image{PixelFormat::RGBA, PixelType::UnsignedByte, TextureSize, _data};
+
+    /* Respecifies the whole texture every time */
+    CORRADE_BENCHMARK(10)
+        texture.setImage(0,
+            #ifndef MAGNUM_TARGET_GLES2
+            TextureFormat::RGBA8,
+            #else
+            TextureFormat::RGBA,
+            #endif
+            image);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void UploadGLBenchmark::textureSetSubImage() {
+    Texture2D texture;
+    texture.setStorage(1,
+        #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
+        TextureFormat::RGBA8,
+        #else
+        TextureFormat::RGBA,
+        #endif
+        TextureSize);
+    ImageView2D image{PixelFormat::RGBA, PixelType::UnsignedByte, TextureSize, _data};
+
+    CORRADE_BENCHMARK(10)
+        texture.setSubImage(0, {}, image);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::UploadGLBenchmark)
@@ -0,0 +1,206 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/GL/VolumeBrickCache.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct VolumeBrickCacheGLTest: OpenGLTester {
+    explicit VolumeBrickCacheGLTest();
+
+    void construct();
+    void constructMove();
+
+    void update();
+    void updateEviction();
+    void updateMaxUploads();
+};
+
+VolumeBrickCacheGLTest::VolumeBrickCacheGLTest() {
+    addTests({&VolumeBrickCacheGLTest::construct,
+              &VolumeBrickCacheGLTest::constructMove,
+
+              &VolumeBrickCacheGLTest::update,
+              &VolumeBrickCacheGLTest::updateEviction,
+              &VolumeBrickCacheGLTest::updateMaxUploads});
+}
+
+namespace {
+    /* Three 2x2x2 bricks, each filled with its ID plus one */
+    constexpr char BrickData[3][8]{
+        {1, 1, 1, 1, 1, 1, 1, 1},
+        {2, 2, 2, 2, 2, 2, 2, 2},
+        {3, 3, 3, 3, 3, 3, 3, 3}
+    };
+
+    ImageView3D fetchBrick(const UnsignedInt brick, void* const userData) {
+        ++*static_cast<UnsignedInt*>(userData);
+        return ImageView3D{PixelStorage{}.setAlignment(1),
+            Magnum::PixelFormat::R8Unorm, {2, 2, 2}, BrickData[brick]};
+    }
+}
+
+void VolumeBrickCacheGLTest::construct() {
+    {
+        VolumeBrickCache cache{TextureFormat::R8, {2, 2, 2}, {3, 1, 1}, {2, 1, 1}};
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_VERIFY(cache.atlas().id() > 0);
+        CORRADE_VERIFY(cache.indirection().id() > 0);
+        CORRADE_COMPARE(cache.brickSize(), (Vector3i{2, 2, 2}));
+        CORRADE_COMPARE(cache.brickCount(), (Vector3i{3, 1, 1}));
+        CORRADE_COMPARE(cache.slotCount(), (Vector3i{2, 1, 1}));
+        CORRADE_COMPARE(cache.maxUploadsPerFrame(), 16);
+        CORRADE_COMPARE(cache.residentCount(), 0);
+        CORRADE_VERIFY(!cache.isResident(2));
+
+        #ifndef MAGNUM_TARGET_GLES
+        CORRADE_COMPARE(cache.atlas().imageSize(0), (Vector3i{4, 2, 2}));
+        CORRADE_COMPARE(cache.indirection().imageSize(0), (Vector3i{3, 1, 1}));
+        #endif
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void VolumeBrickCacheGLTest::constructMove() {
+    VolumeBrickCache a{TextureFormat::R8, {2, 2, 2}, {3, 1, 1}, {2, 1, 1}};
+    const Int id = a.atlas().id();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    VolumeBrickCache b{std::move(a)};
+    CORRADE_COMPARE(a.atlas().id(), 0);
+    CORRADE_COMPARE(b.atlas().id(), id);
+    CORRADE_COMPARE(b.brickCount(), (Vector3i{3, 1, 1}));
+
+    VolumeBrickCache c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(b.atlas().id(), 0);
+    CORRADE_COMPARE(c.atlas().id(), id);
+    CORRADE_COMPARE(c.slotCount(), (Vector3i{2, 1, 1}));
+}
+
+void VolumeBrickCacheGLTest::update() {
+    VolumeBrickCache cache{TextureFormat::R8, {2, 2, 2}, {3, 1, 1}, {2, 1, 1}};
+
+    /* Only two slots, so the third brick doesn't fit */
+    UnsignedInt fetchCount = 0;
+    const UnsignedInt visible[]{1, 0, 2};
+    CORRADE_COMPARE(cache.update(visible, fetchBrick, &fetchCount), 2);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(fetchCount, 2);
+    CORRADE_COMPARE(cache.residentCount(), 2);
+    CORRADE_VERIFY(cache.isResident(0));
+    CORRADE_VERIFY(cache.isResident(1));
+    CORRADE_VERIFY(!cache.isResident(2));
+
+    /* Nothing to do the second time */
+    CORRADE_COMPARE(cache.update(visible, fetchBrick, &fetchCount), 0);
+    CORRADE_COMPARE(fetchCount, 2);
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* Brick 1 went to the first slot, brick 0 to the second */
+    Image3D atlas = cache.atlas().image(0, {PixelStorage{}.setAlignment(1), Magnum::PixelFormat::R8Unorm});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    const char expectedAtlas[]{
+        2, 2, 1, 1, 2, 2, 1, 1,
+        2, 2, 1, 1, 2, 2, 1, 1
+    };
+    CORRADE_COMPARE_AS(Containers::arrayCast<const char>(atlas.data()),
+        Containers::arrayView(expectedAtlas),
+        TestSuite::Compare::Container);
+
+    Image3D indirection = cache.indirection().image(0, {Magnum::PixelFormat::RGBA8UI});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    const Math::Vector4<UnsignedByte> expectedIndirection[]{
+        {1, 0, 0, 1}, {0, 0, 0, 1}, {0, 0, 0, 0}
+    };
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Math::Vector4<UnsignedByte>>(indirection.data()),
+        Containers::arrayView(expectedIndirection),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void VolumeBrickCacheGLTest::updateEviction() {
+    VolumeBrickCache cache{TextureFormat::R8, {2, 2, 2}, {3, 1, 1}, {2, 1, 1}};
+
+    UnsignedInt fetchCount = 0;
+    const UnsignedInt visible1[]{0, 1};
+    CORRADE_COMPARE(cache.update(visible1, fetchBrick, &fetchCount), 2);
+
+    /* Brick 1 is still visible, so brick 0 is evicted */
+    const UnsignedInt visible2[]{2, 1};
+    CORRADE_COMPARE(cache.update(visible2, fetchBrick, &fetchCount), 1);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(fetchCount, 3);
+    CORRADE_COMPARE(cache.residentCount(), 2);
+    CORRADE_VERIFY(!cache.isResident(0));
+    CORRADE_VERIFY(cache.isResident(1));
+    CORRADE_VERIFY(cache.isResident(2));
+
+    #ifndef MAGNUM_TARGET_GLES
+    Image3D indirection = cache.indirection().image(0, {Magnum::PixelFormat::RGBA8UI});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    const Math::Vector4<UnsignedByte> expectedIndirection[]{
+        {0, 0, 0, 0}, {1, 0, 0, 1}, {0, 0, 0, 1}
+    };
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Math::Vector4<UnsignedByte>>(indirection.data()),
+        Containers::arrayView(expectedIndirection),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void VolumeBrickCacheGLTest::updateMaxUploads() {
+    VolumeBrickCache cache{TextureFormat::R8, {2, 2, 2}, {3, 1, 1}, {3, 1, 1}};
+    cache.setMaxUploadsPerFrame(2);
+
+    UnsignedInt fetchCount = 0;
+    const UnsignedInt visible[]{2, 0, 1};
+    CORRADE_COMPARE(cache.update(visible, fetchBrick, &fetchCount), 2);
+    CORRADE_VERIFY(cache.isResident(2));
+    CORRADE_VERIFY(cache.isResident(0));
+    CORRADE_VERIFY(!cache.isResident(1));
+
+    /* The rest gets uploaded in the next frame */
+    CORRADE_COMPARE(cache.update(visible, fetchBrick, &fetchCount), 1);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(fetchCount, 3);
+    CORRADE_COMPARE(cache.residentCount(), 3);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::VolumeBrickCacheGLTest)
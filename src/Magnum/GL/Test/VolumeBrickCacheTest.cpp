@@ -0,0 +1,119 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/GL/VolumeBrickCache.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace GL { namespace Test {
+
+struct VolumeBrickCacheTest: TestSuite::Tester {
+    explicit VolumeBrickCacheTest();
+
+    void constructNoCreate();
+    void constructCopy();
+    void constructInvalidSize();
+    void constructTooManySlots();
+
+    void visibleBricks();
+    void visibleBricksOrder();
+};
+
+VolumeBrickCacheTest::VolumeBrickCacheTest() {
+    addTests({&VolumeBrickCacheTest::constructNoCreate,
+              &VolumeBrickCacheTest::constructCopy,
+              &VolumeBrickCacheTest::constructInvalidSize,
+              &VolumeBrickCacheTest::constructTooManySlots,
+
+              &VolumeBrickCacheTest::visibleBricks,
+              &VolumeBrickCacheTest::visibleBricksOrder});
+}
+
+void VolumeBrickCacheTest::constructNoCreate() {
+    {
+        VolumeBrickCache cache{NoCreate};
+        CORRADE_COMPARE(cache.atlas().id(), 0);
+        CORRADE_COMPARE(cache.indirection().id(), 0);
+        CORRADE_COMPARE(cache.brickCount(), Vector3i{});
+        CORRADE_COMPARE(cache.residentCount(), 0);
+
+        /* No GL calls should be done */
+        cache.update(nullptr, [](UnsignedInt, void*) {
+            return ImageView3D{PixelFormat::R8Unorm, {}, nullptr};
+        });
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void VolumeBrickCacheTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<VolumeBrickCache, const VolumeBrickCache&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<VolumeBrickCache, const VolumeBrickCache&>{}));
+}
+
+void VolumeBrickCacheTest::constructInvalidSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    VolumeBrickCache{TextureFormat::R8, {16, 16, 16}, {4, 0, 4}, {2, 2, 2}};
+    CORRADE_COMPARE(out.str(), "GL::VolumeBrickCache: expected positive sizes, got Vector(16, 16, 16), Vector(4, 0, 4) and Vector(2, 2, 2)\n");
+}
+
+void VolumeBrickCacheTest::constructTooManySlots() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    VolumeBrickCache{TextureFormat::R8, {2, 2, 2}, {4, 4, 4}, {1, 257, 1}};
+    CORRADE_COMPARE(out.str(), "GL::VolumeBrickCache: expected at most 256 slots in each dimension, got Vector(1, 257, 1)\n");
+}
+
+void VolumeBrickCacheTest::visibleBricks() {
+    /* Orthographic projection looking down at the X/Y plane of the volume,
+       covering only the left half */
+    const Matrix4 transformationProjection =
+        Matrix4::orthographicProjection({0.8f, 1.0f}, 0.1f, 10.0f)*
+        Matrix4::translation({0.0f, -0.5f, -5.0f});
+    CORRADE_COMPARE_AS(VolumeBrickCache::visibleBricks({4, 2, 1}, transformationProjection, {0.0f, 0.5f, 5.0f}),
+        (std::vector<UnsignedInt>{0, 4, 1, 5}),
+        TestSuite::Compare::Container);
+}
+
+void VolumeBrickCacheTest::visibleBricksOrder() {
+    /* Everything visible, camera in front of the last brick on Z */
+    const Matrix4 transformationProjection =
+        Matrix4::orthographicProjection({10.0f, 10.0f}, 0.1f, 100.0f)*
+        Matrix4::translation({-0.5f, -0.5f, -10.0f});
+    CORRADE_COMPARE_AS(VolumeBrickCache::visibleBricks({1, 1, 3}, transformationProjection, {0.5f, 0.5f, 10.0f}),
+        (std::vector<UnsignedInt>{2, 1, 0}),
+        TestSuite::Compare::Container);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::VolumeBrickCacheTest)
@@ -24,3 +24,4 @@
 */
 
 #define SHADERGLTEST_FILES_DIR "${SHADERGLTEST_FILES_DIR}"
+#define GL_TEST_OUTPUT_DIR "${GL_TEST_OUTPUT_DIR}"
@@ -146,6 +146,52 @@ template<UnsignedInt dimensions> class Texture: public AbstractTexture {
         static Int compressedBlockDataSize(TextureFormat format) {
             return AbstractTexture::compressedBlockDataSize(Implementation::textureTarget<dimensions>(), format);
         }
+
+        /**
+         * @brief Count of sparse page sizes
+         *
+         * Returns count of virtual page sizes supported for sparse textures
+         * of given @p format, @cpp 0 @ce if the format can't be used for
+         * sparse textures. Available only on 2D and 3D textures.
+         * @see @ref sparsePageSize(), @ref setSparseStorage(),
+         *      @fn_gl_keyword{GetInternalformat} with
+         *      @def_gl_extension{NUM_VIRTUAL_PAGE_SIZES,ARB,sparse_texture}
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        static Int sparsePageSizeCount(TextureFormat format);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        static Int sparsePageSizeCount(TextureFormat format) {
+            return AbstractTexture::sparsePageSizeCount(Implementation::textureTarget<dimensions>(), format);
+        }
+        #endif
+
+        /**
+         * @brief Sparse page size
+         * @param format    Texture format
+         * @param index     Page size index
+         *
+         * Returns size of a virtual page (in pixels) for sparse textures of
+         * given @p format. The @p index is expected to be less than
+         * @ref sparsePageSizeCount(). Available only on 2D and 3D textures.
+         * @see @ref setSparseStorage(), @ref commitPages(),
+         *      @fn_gl_keyword{GetInternalformat} with
+         *      @def_gl_extension{VIRTUAL_PAGE_SIZE_X,ARB,sparse_texture},
+         *      @def_gl_extension{VIRTUAL_PAGE_SIZE_Y,ARB,sparse_texture},
+         *      @def_gl_extension{VIRTUAL_PAGE_SIZE_Z,ARB,sparse_texture}
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        static VectorTypeFor<dimensions, Int> sparsePageSize(TextureFormat format, Int index = 0);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        static VectorTypeFor<dimensions, Int> sparsePageSize(TextureFormat format, Int index = 0) {
+            return VectorTypeFor<dimensions, Int>::pad(AbstractTexture::sparsePageSize(Implementation::textureTarget<dimensions>(), format, index));
+        }
+        #endif
         #endif
 
         /**
@@ -757,6 +803,60 @@ template<UnsignedInt dimensions> class Texture: public AbstractTexture {
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set sparse storage
+         * @param levels            Mip level count
+         * @param internalFormat    Internal format
+         * @param size              Size of largest mip level
+         * @param pageSizeIndex     Index of virtual page size to use, see
+         *      @ref sparsePageSize()
+         * @return Reference to self (for method chaining)
+         *
+         * Like @ref setStorage(), but only the virtual address space is
+         * allocated. No physical memory is used until it's committed
+         * using @ref commitPages(). The @p size is expected to be a multiple
+         * of the page size, or it has to be less than a single page.
+         * Available only on 2D and 3D textures.
+         * @see @ref sparseLevelCount(), @fn_gl_keyword{TexParameter} with
+         *      @def_gl_extension{TEXTURE_SPARSE,ARB,sparse_texture} and
+         *      @def_gl_extension{VIRTUAL_PAGE_SIZE_INDEX,ARB,sparse_texture}, then @ref setStorage()
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        Texture<dimensions>& setSparseStorage(Int levels, TextureFormat internalFormat, const VectorTypeFor<dimensions, Int>& size, Int pageSizeIndex = 0);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        Texture<dimensions>& setSparseStorage(Int levels, TextureFormat internalFormat, const VectorTypeFor<dimensions, Int>& size, Int pageSizeIndex = 0) {
+            AbstractTexture::setSparse(pageSizeIndex);
+            DataHelper<dimensions>::setStorage(*this, levels, internalFormat, size);
+            return *this;
+        }
+        #endif
+
+        /**
+         * @brief Count of sparse levels
+         *
+         * Levels with index greater or equal to this value are smaller than
+         * a single page and form a mip tail that's committed and decommitted
+         * all at once. Expects that @ref setSparseStorage() was called. The
+         * texture is bound before the operation (if not already).
+         * Available only on 2D and 3D textures.
+         * @see @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl_keyword{GetTexParameter} with
+         *      @def_gl_extension{NUM_SPARSE_LEVELS,ARB,sparse_texture}
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        Int sparseLevelCount();
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        Int sparseLevelCount() { return AbstractTexture::sparseLevelCount(); }
+        #endif
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES2
         /**
          * @brief Image size in given mip level
@@ -1352,6 +1452,65 @@ template<UnsignedInt dimensions> class Texture: public AbstractTexture {
             DataHelper<dimensions>::invalidateSubImage(*this, level, offset, size);
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Commit sparse texture pages
+         * @param level             Mip level
+         * @param offset            Offset into the texture
+         * @param size              Size of the committed region
+         * @return Reference to self (for method chaining)
+         *
+         * Allocates physical memory for all pages in given region of a
+         * texture created with @ref setSparseStorage(). The @p offset and
+         * @p size are expected to be multiples of @ref sparsePageSize(),
+         * unless the region extends to the edge of the level. Committing
+         * any level at or above @ref sparseLevelCount() commits the whole
+         * mip tail. Contents of newly committed pages are undefined, upload
+         * them using @ref setSubImage().
+         *
+         * OpenGL doesn't provide a way to query which pages are committed,
+         * the application is expected to track them itself, for example
+         * together with the data it streams into them. The texture is bound
+         * before the operation (if not already). Available only on 2D and 3D
+         * textures.
+         * @see @ref decommitPages(), @fn_gl{ActiveTexture},
+         *      @fn_gl{BindTexture} and @fn_gl_extension_keyword{TexPageCommitment,ARB,sparse_texture}
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        Texture<dimensions>& commitPages(Int level, const VectorTypeFor<dimensions, Int>& offset, const VectorTypeFor<dimensions, Int>& size);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        Texture<dimensions>& commitPages(Int level, const VectorTypeFor<dimensions, Int>& offset, const VectorTypeFor<dimensions, Int>& size) {
+            AbstractTexture::commitPages(level, Vector3i::pad(offset), Vector3i::pad(size, 1), true);
+            return *this;
+        }
+        #endif
+
+        /**
+         * @brief Decommit sparse texture pages
+         * @return Reference to self (for method chaining)
+         *
+         * Releases physical memory of all pages in given region, the
+         * requirements are the same as for @ref commitPages(). Available only
+         * on 2D and 3D textures.
+         * @see @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl_extension_keyword{TexPageCommitment,ARB,sparse_texture}
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        Texture<dimensions>& decommitPages(Int level, const VectorTypeFor<dimensions, Int>& offset, const VectorTypeFor<dimensions, Int>& size);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        Texture<dimensions>& decommitPages(Int level, const VectorTypeFor<dimensions, Int>& offset, const VectorTypeFor<dimensions, Int>& size) {
+            AbstractTexture::commitPages(level, Vector3i::pad(offset), Vector3i::pad(size, 1), false);
+            return *this;
+        }
+        #endif
+        #endif
+
         /* Overloads to remove WTF-factor from method chaining order */
         #if !defined(DOXYGEN_GENERATING_OUTPUT) && !defined(MAGNUM_TARGET_WEBGL)
         Texture<dimensions>& setLabel(const std::string& label) {
@@ -130,6 +130,41 @@ template<UnsignedInt dimensions> class TextureArray: public AbstractTexture {
         static Int compressedBlockDataSize(TextureFormat format) {
             return AbstractTexture::compressedBlockDataSize(Implementation::textureArrayTarget<dimensions>(), format);
         }
+
+        /**
+         * @brief @copybrief Texture::sparsePageSizeCount()
+         *
+         * See @ref Texture::sparsePageSizeCount() for more information.
+         * Available only on 2D texture arrays.
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        static Int sparsePageSizeCount(TextureFormat format);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        static Int sparsePageSizeCount(TextureFormat format) {
+            return AbstractTexture::sparsePageSizeCount(Implementation::textureArrayTarget<dimensions>(), format);
+        }
+        #endif
+
+        /**
+         * @brief @copybrief Texture::sparsePageSize()
+         *
+         * See @ref Texture::sparsePageSize() for more information. The last
+         * component is page size in layers. Available only on 2D texture
+         * arrays.
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        static VectorTypeFor<dimensions+1, Int> sparsePageSize(TextureFormat format, Int index = 0);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        static VectorTypeFor<dimensions+1, Int> sparsePageSize(TextureFormat format, Int index = 0) {
+            return AbstractTexture::sparsePageSize(Implementation::textureArrayTarget<dimensions>(), format, index);
+        }
+        #endif
         #endif
 
         /**
@@ -486,6 +521,43 @@ template<UnsignedInt dimensions> class TextureArray: public AbstractTexture {
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief @copybrief Texture::setSparseStorage()
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setSparseStorage() for more information.
+         * Available only on 2D texture arrays.
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        TextureArray<dimensions>& setSparseStorage(Int levels, TextureFormat internalFormat, const VectorTypeFor<dimensions+1, Int>& size, Int pageSizeIndex = 0);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        TextureArray<dimensions>& setSparseStorage(Int levels, TextureFormat internalFormat, const VectorTypeFor<dimensions+1, Int>& size, Int pageSizeIndex = 0) {
+            AbstractTexture::setSparse(pageSizeIndex);
+            DataHelper<dimensions+1>::setStorage(*this, levels, internalFormat, size);
+            return *this;
+        }
+        #endif
+
+        /**
+         * @brief @copybrief Texture::sparseLevelCount()
+         *
+         * See @ref Texture::sparseLevelCount() for more information.
+         * Available only on 2D texture arrays.
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        Int sparseLevelCount();
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        Int sparseLevelCount() { return AbstractTexture::sparseLevelCount(); }
+        #endif
+        #endif
+
         #ifndef MAGNUM_TARGET_WEBGL
         /**
          * @brief @copybrief Texture::imageSize()
@@ -878,6 +950,46 @@ template<UnsignedInt dimensions> class TextureArray: public AbstractTexture {
             DataHelper<dimensions+1>::invalidateSubImage(*this, level, offset, size);
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief @copybrief Texture::commitPages()
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::commitPages() for more information. Available
+         * only on 2D texture arrays.
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        TextureArray<dimensions>& commitPages(Int level, const VectorTypeFor<dimensions+1, Int>& offset, const VectorTypeFor<dimensions+1, Int>& size);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        TextureArray<dimensions>& commitPages(Int level, const VectorTypeFor<dimensions+1, Int>& offset, const VectorTypeFor<dimensions+1, Int>& size) {
+            AbstractTexture::commitPages(level, offset, size, true);
+            return *this;
+        }
+        #endif
+
+        /**
+         * @brief @copybrief Texture::decommitPages()
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::decommitPages() for more information. Available
+         * only on 2D texture arrays.
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        TextureArray<dimensions>& decommitPages(Int level, const VectorTypeFor<dimensions+1, Int>& offset, const VectorTypeFor<dimensions+1, Int>& size);
+        #else
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        TextureArray<dimensions>& decommitPages(Int level, const VectorTypeFor<dimensions+1, Int>& offset, const VectorTypeFor<dimensions+1, Int>& size) {
+            AbstractTexture::commitPages(level, offset, size, false);
+            return *this;
+        }
+        #endif
+        #endif
+
         /* Overloads to remove WTF-factor from method chaining order */
         #if !defined(DOXYGEN_GENERATING_OUTPUT) && !defined(MAGNUM_TARGET_WEBGL)
         TextureArray<dimensions>& setLabel(const std::string& label) {
@@ -0,0 +1,189 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TextureUploader.h"
+
+#include <tuple>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/Implementation/RendererState.h"
+#include "Magnum/GL/Implementation/State.h"
+#include "Magnum/GL/Implementation/TextureState.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace GL {
+
+TextureUploader::TextureUploader(const std::size_t frameSize, const UnsignedInt frameCount): _frameSize{frameSize}, _used{}, _current{}, _persistent{} {
+    CORRADE_ASSERT(frameSize && frameCount,
+        "GL::TextureUploader: expected non-zero frame size and count", );
+
+    #ifndef MAGNUM_TARGET_GLES
+    _persistent = Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>();
+    #endif
+
+    _slots.resize(frameCount);
+    for(Slot& slot: _slots) {
+        slot.buffer = Buffer{Buffer::TargetHint::PixelUnpack};
+
+        #ifndef MAGNUM_TARGET_GLES
+        if(_persistent) {
+            slot.buffer.setStorage({nullptr, frameSize}, Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent|Buffer::StorageFlag::MapCoherent);
+            slot.data = slot.buffer.map(0, frameSize, Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::Coherent);
+        } else
+        #endif
+        {
+            slot.buffer.setData({nullptr, frameSize}, BufferUsage::StreamDraw);
+        }
+    }
+
+    mapCurrent();
+}
+
+TextureUploader::TextureUploader(NoCreateT) noexcept: _frameSize{}, _used{}, _current{}, _persistent{} {}
+
+TextureUploader::TextureUploader(TextureUploader&& other) noexcept: _frameSize{other._frameSize}, _used{other._used}, _current{other._current}, _persistent{other._persistent}, _slots{std::move(other._slots)}, _uploads{std::move(other._uploads)} {
+    other._frameSize = other._used = 0;
+    other._current = 0;
+    other._slots.clear();
+    other._uploads.clear();
+}
+
+TextureUploader::~TextureUploader() = default;
+
+TextureUploader& TextureUploader::operator=(TextureUploader&& other) noexcept {
+    using std::swap;
+    swap(_frameSize, other._frameSize);
+    swap(_used, other._used);
+    swap(_current, other._current);
+    swap(_persistent, other._persistent);
+    swap(_slots, other._slots);
+    swap(_uploads, other._uploads);
+    return *this;
+}
+
+void TextureUploader::mapCurrent() {
+    if(_persistent) return;
+
+    Slot& slot = _slots[_current];
+    slot.data = slot.buffer.map(0, _frameSize, Buffer::MapFlag::Write|Buffer::MapFlag::InvalidateBuffer);
+}
+
+void TextureUploader::waitCurrent() {
+    Slot& slot = _slots[_current];
+    if(!slot.fence.id()) return;
+
+    /* Flush the command queue on the first try so the fence is guaranteed to
+       signal eventually, then just keep waiting */
+    Fence::ClientWaitFlags flags = Fence::ClientWaitFlag::FlushCommands;
+    while(slot.fence.clientWait(1000000000ull, flags) == Fence::WaitResult::TimeoutExpired)
+        flags = {};
+
+    slot.fence = Fence{NoCreate};
+}
+
+Containers::ArrayView<char> TextureUploader::reserve(const std::size_t size) {
+    /* Align the offset so the data are usable with any pixel type */
+    const std::size_t offset = (_used + 15) & ~std::size_t{15};
+    if(!size || offset > _frameSize || size > _frameSize - offset) return {};
+
+    _used = offset + size;
+    return _slots[_current].data.slice(offset, offset + size);
+}
+
+Containers::ArrayView<char> TextureUploader::setSubImage(Texture2D& texture, const Int level, const Vector2i& offset, const PixelStorage& storage, const PixelFormat format, const PixelType type, const Vector2i& size) {
+    Math::Vector3<std::size_t> dataOffset, dataSize;
+    std::tie(dataOffset, dataSize) = storage.dataProperties(pixelSize(format, type), Vector3i::pad(size, 1));
+
+    const Containers::ArrayView<char> data = reserve(dataOffset.sum() + dataSize.product());
+    if(!data) return {};
+
+    _uploads.push_back({&texture, level, offset, size, storage, format, type, CompressedPixelFormat{}, false, std::size_t(data.data() - _slots[_current].data.data()), data.size()});
+    return data;
+}
+
+Containers::ArrayView<char> TextureUploader::setSubImage(Texture2D& texture, const Int level, const Vector2i& offset, const PixelStorage& storage, const Magnum::PixelFormat format, const Vector2i& size) {
+    return setSubImage(texture, level, offset, storage, pixelFormat(format), pixelType(format), size);
+}
+
+Containers::ArrayView<char> TextureUploader::setCompressedSubImage(Texture2D& texture, const Int level, const Vector2i& offset, const CompressedPixelFormat format, const Vector2i& size, const std::size_t dataSize) {
+    const Containers::ArrayView<char> data = reserve(dataSize);
+    if(!data) return {};
+
+    _uploads.push_back({&texture, level, offset, size, PixelStorage{}, PixelFormat{}, PixelType{}, format, true, std::size_t(data.data() - _slots[_current].data.data()), data.size()});
+    return data;
+}
+
+Containers::ArrayView<char> TextureUploader::setCompressedSubImage(Texture2D& texture, const Int level, const Vector2i& offset, const Magnum::CompressedPixelFormat format, const Vector2i& size, const std::size_t dataSize) {
+    return setCompressedSubImage(texture, level, offset, compressedPixelFormat(format), size, dataSize);
+}
+
+void TextureUploader::endFrame() {
+    /* Moved-out or NoCreate'd instance, nothing to do */
+    if(_slots.empty()) return;
+
+    Slot& slot = _slots[_current];
+    if(!_persistent) {
+        slot.buffer.unmap();
+        slot.data = {};
+    }
+
+    if(!_uploads.empty()) {
+        Implementation::State& state = Context::current().state();
+        slot.buffer.bindInternal(Buffer::TargetHint::PixelUnpack);
+
+        for(const Upload& upload: _uploads) {
+            /* The data pointer is an offset into the bound buffer */
+            const GLvoid* const data = reinterpret_cast<const GLvoid*>(upload.dataOffset);
+            if(upload.compressed) {
+                state.renderer->applyPixelStorageUnpack(CompressedPixelStorage{});
+                (upload.texture->*state.texture->compressedSubImage2DImplementation)(upload.level, upload.offset, upload.size, upload.compressedFormat, data, upload.dataSize);
+            } else {
+                state.renderer->applyPixelStorageUnpack(upload.storage);
+                (upload.texture->*state.texture->subImage2DImplementation)(upload.level, upload.offset, upload.size, upload.format, upload.type, data, upload.storage);
+            }
+        }
+
+        _uploads.clear();
+    }
+
+    /* Fence the uploads so the buffer isn't overwritten while the GPU still
+       reads from it. Without persistent mapping the driver takes care of
+       that when the buffer gets orphaned. */
+    #ifndef MAGNUM_TARGET_GLES
+    if(_persistent) {
+        slot.fence.insert();
+    }
+    #endif
+
+    _current = (_current + 1) % _slots.size();
+    _used = 0;
+    waitCurrent();
+    mapCurrent();
+}
+
+}}
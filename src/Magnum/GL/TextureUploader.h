@@ -0,0 +1,273 @@
+#ifndef Magnum_GL_TextureUploader_h
+#define Magnum_GL_TextureUploader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::GL::TextureUploader
+ */
+#endif
+
+#include <vector>
+
+#include "Magnum/PixelStorage.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Fence.h"
+#include "Magnum/Math/Vector2.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace GL {
+
+/**
+@brief Streaming texture uploader
+
+Keeps a ring of pixel unpack buffers, one for each frame in flight, and uploads
+texture data from them. Compared to @ref Texture::setSubImage() from client
+memory, the data are written directly into memory visible to the GPU and the
+upload itself doesn't need to wait for the copy to finish, so the draw loop
+isn't stalled even for large images.
+
+@section GL-TextureUploader-usage Usage
+
+Each call to @ref setSubImage() or @ref setCompressedSubImage() reserves a
+part of the current frame buffer and returns a view on it. The memory can be
+then filled from any thread, for example directly by an image decoder. The
+actual uploads are issued at once in @ref endFrame(), which then advances to
+the next buffer in the ring. All data have to be written before that and the
+textures have to stay alive until then.
+
+@code{.cpp}
+GL::TextureUploader uploader{16*1024*1024};
+
+Containers::ArrayView<char> data = uploader.setSubImage(texture, 0, {},
+    PixelStorage{}, GL::PixelFormat::RGBA, GL::PixelType::UnsignedByte, size);
+if(data) decoder.decodeInto(data);
+
+// ...
+
+uploader.endFrame();
+@endcode
+
+If there's not enough space left in the current frame, an empty view is
+returned and nothing is queued. Repeat the request in the next frame or make
+the frame size larger.
+
+@section GL-TextureUploader-performance Performance optimizations
+
+If @gl_extension{ARB,buffer_storage} (part of OpenGL 4.4) is available, the
+buffers are created using @ref Buffer::setStorage() and stay persistently
+mapped using @ref Buffer::MapFlag::Persistent and @ref Buffer::MapFlag::Coherent
+for the whole lifetime of the uploader. Each @ref endFrame() then places a
+fence after the uploads and a buffer is reused only after its fence signals,
+so the CPU waits only if the GPU is more than @ref frameCount() frames behind.
+Otherwise the buffers are mapped with @ref Buffer::MapFlag::InvalidateBuffer
+at the beginning of each frame and unmapped in @ref endFrame() before the
+uploads are issued, letting the driver orphan the previous storage.
+@see @ref isPersistent()
+@requires_gles30 Pixel buffer objects are not available in OpenGL ES 2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_GL_EXPORT TextureUploader {
+    public:
+        /**
+         * @brief Constructor
+         * @param frameSize     Size of the buffer for each frame in bytes
+         * @param frameCount    Count of buffers in the ring
+         *
+         * Expects that both @p frameSize and @p frameCount are non-zero.
+         * Creates @p frameCount buffers and maps the first one.
+         * @see @ref TextureUploader(NoCreateT)
+         */
+        explicit TextureUploader(std::size_t frameSize, UnsignedInt frameCount = 3);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL objects
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * @see @ref TextureUploader(std::size_t, UnsignedInt)
+         */
+        explicit TextureUploader(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        TextureUploader(const TextureUploader&) = delete;
+
+        /** @brief Move constructor */
+        TextureUploader(TextureUploader&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Uploads queued since last @ref endFrame() are discarded.
+         */
+        ~TextureUploader();
+
+        /** @brief Copying is not allowed */
+        TextureUploader& operator=(const TextureUploader&) = delete;
+
+        /** @brief Move assignment */
+        TextureUploader& operator=(TextureUploader&&) noexcept;
+
+        /** @brief Size of the buffer for each frame in bytes */
+        std::size_t frameSize() const { return _frameSize; }
+
+        /** @brief Count of buffers in the ring */
+        UnsignedInt frameCount() const { return UnsignedInt(_slots.size()); }
+
+        /**
+         * @brief Whether the buffers are persistently mapped
+         *
+         * Returns @cpp true @ce if @gl_extension{ARB,buffer_storage} is
+         * available, @cpp false @ce otherwise. See
+         * @ref GL-TextureUploader-performance for more information.
+         */
+        bool isPersistent() const { return _persistent; }
+
+        /**
+         * @brief Space remaining in the current frame
+         *
+         * Doesn't include alignment padding of subsequent reservations.
+         */
+        std::size_t remaining() const { return _frameSize - _used; }
+
+        /**
+         * @brief Reserve memory for a texture subimage upload
+         * @param texture       Texture to upload to
+         * @param level         Mip level
+         * @param offset        Offset where to put the data in the texture
+         * @param storage       Storage of pixel data
+         * @param format        Format of pixel data
+         * @param type          Data type of pixel data
+         * @param size          Image size
+         * @return View on the reserved memory or an empty view if there's
+         *      not enough space left in the current frame
+         *
+         * The returned memory is laid out according to @p storage, @p format
+         * and @p type and has to be filled before the next @ref endFrame(),
+         * which then uploads it using the same operation as
+         * @ref Texture::setSubImage(Int, const VectorTypeFor<dimensions, Int>&, BufferImage<dimensions>&).
+         * The returned memory is write-only.
+         */
+        Containers::ArrayView<char> setSubImage(Texture2D& texture, Int level, const Vector2i& offset, const PixelStorage& storage, PixelFormat format, PixelType type, const Vector2i& size);
+
+        /**
+         * @brief Reserve memory for a texture subimage upload
+         *
+         * Equivalent to calling @ref setSubImage(Texture2D&, Int, const Vector2i&, const PixelStorage&, PixelFormat, PixelType, const Vector2i&)
+         * with a GL-specific format and type corresponding to given generic
+         * @p format.
+         * @see @ref pixelFormat(), @ref pixelType()
+         */
+        Containers::ArrayView<char> setSubImage(Texture2D& texture, Int level, const Vector2i& offset, const PixelStorage& storage, Magnum::PixelFormat format, const Vector2i& size);
+
+        /** @overload
+         *
+         * Equivalent to the above with default-constructed
+         * @ref PixelStorage.
+         */
+        Containers::ArrayView<char> setSubImage(Texture2D& texture, Int level, const Vector2i& offset, Magnum::PixelFormat format, const Vector2i& size) {
+            return setSubImage(texture, level, offset, {}, format, size);
+        }
+
+        /**
+         * @brief Reserve memory for a compressed texture subimage upload
+         * @param texture       Texture to upload to
+         * @param level         Mip level
+         * @param offset        Offset where to put the data in the texture
+         * @param format        Compressed format of the data
+         * @param size          Image size
+         * @param dataSize      Size of the compressed data in bytes
+         * @return View on the reserved memory or an empty view if there's
+         *      not enough space left in the current frame
+         *
+         * The returned memory has to be filled before the next
+         * @ref endFrame(), which then uploads it using the same operation as
+         * @ref Texture::setCompressedSubImage(Int, const VectorTypeFor<dimensions, Int>&, CompressedBufferImage<dimensions>&).
+         * The returned memory is write-only.
+         */
+        Containers::ArrayView<char> setCompressedSubImage(Texture2D& texture, Int level, const Vector2i& offset, CompressedPixelFormat format, const Vector2i& size, std::size_t dataSize);
+
+        /** @overload
+         *
+         * Converts the generic @p format using
+         * @ref compressedPixelFormat().
+         */
+        Containers::ArrayView<char> setCompressedSubImage(Texture2D& texture, Int level, const Vector2i& offset, Magnum::CompressedPixelFormat format, const Vector2i& size, std::size_t dataSize);
+
+        /**
+         * @brief End the frame
+         *
+         * Issues all uploads queued in this frame, places a fence after them
+         * and advances to the next buffer in the ring, waiting for its fence
+         * if the GPU didn't consume it yet. If the buffers are not
+         * persistently mapped, the current buffer is unmapped before the
+         * uploads and the next one is mapped afterwards. Textures passed to
+         * @ref setSubImage() and @ref setCompressedSubImage() are not
+         * referenced after this call.
+         * @see @fn_gl_keyword{FenceSync}, @fn_gl_keyword{ClientWaitSync}
+         */
+        void endFrame();
+
+    private:
+        struct Slot {
+            Buffer buffer{NoCreate};
+            Containers::ArrayView<char> data;
+            Fence fence{NoCreate};
+        };
+
+        struct Upload {
+            Texture2D* texture;
+            Int level;
+            Vector2i offset, size;
+            PixelStorage storage;
+            PixelFormat format;
+            PixelType type;
+            CompressedPixelFormat compressedFormat;
+            bool compressed;
+            std::size_t dataOffset, dataSize;
+        };
+
+        void MAGNUM_GL_LOCAL mapCurrent();
+        void MAGNUM_GL_LOCAL waitCurrent();
+        Containers::ArrayView<char> MAGNUM_GL_LOCAL reserve(std::size_t size);
+
+        std::size_t _frameSize, _used;
+        UnsignedInt _current;
+        bool _persistent;
+        std::vector<Slot> _slots;
+        std::vector<Upload> _uploads;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
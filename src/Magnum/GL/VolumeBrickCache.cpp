@@ -0,0 +1,175 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "VolumeBrickCache.h"
+
+#include <algorithm>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace GL {
+
+namespace {
+    constexpr UnsignedInt NoBrick = ~UnsignedInt{};
+    constexpr UnsignedInt NoSlot = ~UnsignedInt{};
+}
+
+std::vector<UnsignedInt> VolumeBrickCache::visibleBricks(const Vector3i& brickCount, const Matrix4& transformationProjection, const Vector3& cameraPosition) {
+    const Frustum frustum = Frustum::fromMatrix(transformationProjection);
+    const Vector3 brickSize = 1.0f/Vector3{brickCount};
+
+    /* Collect bricks intersecting the frustum together with their squared
+       distance from the camera */
+    std::vector<std::pair<Float, UnsignedInt>> visible;
+    UnsignedInt id = 0;
+    for(Int z = 0; z != brickCount.z(); ++z)
+    for(Int y = 0; y != brickCount.y(); ++y)
+    for(Int x = 0; x != brickCount.x(); ++x, ++id) {
+        const Vector3 min = Vector3{Vector3i{x, y, z}}*brickSize;
+        const Range3D range{min, min + brickSize};
+        if(Math::Intersection::rangeFrustum(range, frustum))
+            visible.emplace_back((range.center() - cameraPosition).dot(), id);
+    }
+
+    std::sort(visible.begin(), visible.end());
+
+    std::vector<UnsignedInt> out;
+    out.reserve(visible.size());
+    for(const std::pair<Float, UnsignedInt>& brick: visible)
+        out.push_back(brick.second);
+    return out;
+}
+
+VolumeBrickCache::VolumeBrickCache(const TextureFormat format, const Vector3i& brickSize, const Vector3i& brickCount, const Vector3i& slotCount): _brickSize{brickSize}, _brickCount{brickCount}, _slotCount{slotCount}, _atlas{NoCreate}, _indirection{NoCreate} {
+    CORRADE_ASSERT(brickSize.min() > 0 && brickCount.min() > 0 && slotCount.min() > 0,
+        "GL::VolumeBrickCache: expected positive sizes, got" << brickSize << Debug::nospace << "," << brickCount << "and" << slotCount, );
+    CORRADE_ASSERT(slotCount.max() <= 256,
+        "GL::VolumeBrickCache: expected at most 256 slots in each dimension, got" << slotCount, );
+
+    _slots.resize(slotCount.product(), Slot{NoBrick, 0});
+    _brickSlots.resize(brickCount.product(), NoSlot);
+    _table.resize(brickCount.product());
+
+    _atlas = Texture3D{};
+    _atlas.setMinificationFilter(SamplerFilter::Linear)
+        .setMagnificationFilter(SamplerFilter::Linear)
+        .setWrapping(SamplerWrapping::ClampToEdge)
+        .setStorage(1, format, slotCount*brickSize);
+
+    /* Integer textures can't be filtered */
+    _indirection = Texture3D{};
+    _indirection.setMinificationFilter(SamplerFilter::Nearest)
+        .setMagnificationFilter(SamplerFilter::Nearest)
+        .setWrapping(SamplerWrapping::ClampToEdge)
+        .setStorage(1, TextureFormat::RGBA8UI, brickCount)
+        .setSubImage(0, {}, ImageView3D{Magnum::PixelFormat::RGBA8UI, brickCount,
+            {_table.data(), _table.size()*sizeof(Math::Vector4<UnsignedByte>)}});
+}
+
+VolumeBrickCache::VolumeBrickCache(NoCreateT) noexcept: _atlas{NoCreate}, _indirection{NoCreate} {}
+
+VolumeBrickCache::VolumeBrickCache(VolumeBrickCache&&) noexcept = default;
+
+VolumeBrickCache::~VolumeBrickCache() = default;
+
+VolumeBrickCache& VolumeBrickCache::operator=(VolumeBrickCache&&) noexcept = default;
+
+bool VolumeBrickCache::isResident(const UnsignedInt brick) const {
+    CORRADE_ASSERT(brick < _brickSlots.size(),
+        "GL::VolumeBrickCache::isResident(): brick" << brick << "out of range for" << _brickSlots.size() << "bricks", {});
+    return _brickSlots[brick] != NoSlot;
+}
+
+Vector3i VolumeBrickCache::slotCoordinates(const UnsignedInt slot) const {
+    return {Int(slot%_slotCount.x()),
+            Int(slot/_slotCount.x()%_slotCount.y()),
+            Int(slot/(_slotCount.x()*_slotCount.y()))};
+}
+
+UnsignedInt VolumeBrickCache::update(const Containers::ArrayView<const UnsignedInt> visibleBricks, ImageView3D(*const fetch)(UnsignedInt, void*), void* const userData) {
+    CORRADE_ASSERT(fetch,
+        "GL::VolumeBrickCache::update(): fetch callback can't be null", {});
+
+    /* Mark all visible resident bricks as used first, so they don't get
+       evicted by uploads of other visible bricks in this frame. Free slots
+       have the last use set to zero, so they're picked first. */
+    ++_frame;
+    for(const UnsignedInt brick: visibleBricks) {
+        CORRADE_ASSERT(brick < _brickSlots.size(),
+            "GL::VolumeBrickCache::update(): brick" << brick << "out of range for" << _brickSlots.size() << "bricks", {});
+        if(_brickSlots[brick] != NoSlot)
+            _slots[_brickSlots[brick]].lastUsed = _frame;
+    }
+
+    UnsignedInt uploaded = 0;
+    bool dirty = false;
+    for(const UnsignedInt brick: visibleBricks) {
+        if(uploaded == _maxUploadsPerFrame) break;
+        if(_brickSlots[brick] != NoSlot) continue;
+
+        /* Find the least recently used slot. If even that one is used in
+           this frame, the cache is full. */
+        UnsignedInt slot = 0;
+        for(UnsignedInt i = 1; i != _slots.size(); ++i)
+            if(_slots[i].lastUsed < _slots[slot].lastUsed) slot = i;
+        if(_slots[slot].lastUsed == _frame) break;
+
+        /* Evict the previous brick */
+        if(_slots[slot].brick != NoBrick) {
+            _brickSlots[_slots[slot].brick] = NoSlot;
+            _table[_slots[slot].brick] = Math::Vector4<UnsignedByte>{};
+            --_residentCount;
+        }
+
+        const ImageView3D image = fetch(brick, userData);
+        CORRADE_ASSERT(image.size() == _brickSize,
+            "GL::VolumeBrickCache::update(): expected brick" << brick << "to have a size of" << _brickSize << "but got" << image.size(), {});
+        const Vector3i coordinates = slotCoordinates(slot);
+        _atlas.setSubImage(0, coordinates*_brickSize, image);
+
+        _slots[slot] = Slot{brick, _frame};
+        _brickSlots[brick] = slot;
+        _table[brick] = Math::Vector4<UnsignedByte>{Math::Vector3<UnsignedByte>{coordinates}, 1};
+        ++_residentCount;
+        ++uploaded;
+        dirty = true;
+    }
+
+    /* The table is small compared to the bricks, upload it whole */
+    if(dirty) _indirection.setSubImage(0, {}, ImageView3D{Magnum::PixelFormat::RGBA8UI, _brickCount,
+        {_table.data(), _table.size()*sizeof(Math::Vector4<UnsignedByte>)}});
+
+    return uploaded;
+}
+
+}}
@@ -0,0 +1,231 @@
+#ifndef Magnum_GL_VolumeBrickCache_h
+#define Magnum_GL_VolumeBrickCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::GL::VolumeBrickCache
+ */
+#endif
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/Math/Vector4.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace GL {
+
+/**
+@brief Cache of volume bricks in a texture atlas
+
+Keeps a fixed-size subset of bricks of a large bricked volume (such as a
+@ref Trade::VolumeBlob) resident in a 3D texture atlas, together with a brick
+indirection table that tells the shader where to find each brick. This makes it
+possible to render volumes that are larger than available video memory ---
+only the bricks that are currently visible need to be resident.
+
+@section GL-VolumeBrickCache-usage Usage
+
+The cache is created with the brick size including the border, the count of
+bricks in the whole volume and the count of slots in the atlas in each
+dimension. Every frame, @ref update() is called with the list of visible
+bricks, ordered from the most important one, for example from front to back
+as returned by @ref visibleBricks(). Bricks that are not resident yet are
+fetched through a callback and uploaded to free slots, or to slots of bricks
+that were not visible for the longest time, up to
+@ref maxUploadsPerFrame() bricks per frame:
+
+@snippet MagnumGL.cpp VolumeBrickCache-usage
+
+@section GL-VolumeBrickCache-shader Shader access
+
+The @ref atlas() texture has a size of @ref slotCount() times
+@ref brickSize() and uses linear filtering. The @ref indirection() texture
+has a size of @ref brickCount() with one @ref TextureFormat::RGBA8UI texel for
+each brick, with nearest filtering. For a resident brick the first three
+components contain coordinates of its slot in the atlas and the fourth
+component is @cpp 1 @ce, for a brick that's not resident all components are
+zero. A shader sampling a volume-space position @f$ \boldsymbol{p} \in [0, 1]^3 @f$
+first fetches the brick entry at @f$ \boldsymbol{p} @f$ from the indirection
+texture, skips the brick (or samples a lower-resolution fallback) if it's not
+resident and otherwise samples the atlas at the slot offset plus the position
+inside the brick, shifted by the brick border.
+@requires_gl30 Extension @gl_extension{EXT,texture_integer}
+@requires_gles30 Integer textures and 3D textures are not available in
+    OpenGL ES 2.0.
+@requires_webgl20 Integer textures and 3D textures are not available in
+    WebGL 1.0.
+*/
+class MAGNUM_GL_EXPORT VolumeBrickCache {
+    public:
+        /**
+         * @brief Compute visible bricks
+         * @param brickCount    Brick count in each dimension
+         * @param transformationProjection  Transformation and projection
+         *      matrix of the volume
+         * @param cameraPosition    Camera position in volume space
+         *
+         * Assumes the volume occupies a unit cube @f$ [0, 1]^3 @f$ in its
+         * local space. Returns IDs of bricks intersecting the view frustum
+         * ordered from the closest to the farthest one relative to
+         * @p cameraPosition, with the IDs calculated in the same way as
+         * @ref Trade::VolumeBlob::brickId().
+         * @see @ref Math::Frustum::fromMatrix(),
+         *      @ref Math::Intersection::rangeFrustum()
+         */
+        static std::vector<UnsignedInt> visibleBricks(const Vector3i& brickCount, const Matrix4& transformationProjection, const Vector3& cameraPosition);
+
+        /**
+         * @brief Constructor
+         * @param format        Internal texture format of the atlas
+         * @param brickSize     Brick size including the border
+         * @param brickCount    Brick count in the whole volume in each
+         *      dimension
+         * @param slotCount     Count of slots in the atlas in each dimension
+         *
+         * Expects that all sizes are positive and that @p slotCount is at
+         * most @cpp 256 @ce in each dimension, so the slot coordinates fit
+         * into the indirection table. Allocates both textures, initially no
+         * brick is resident.
+         * @see @ref VolumeBrickCache(NoCreateT)
+         */
+        explicit VolumeBrickCache(TextureFormat format, const Vector3i& brickSize, const Vector3i& brickCount, const Vector3i& slotCount);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL objects
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit VolumeBrickCache(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        VolumeBrickCache(const VolumeBrickCache&) = delete;
+
+        /** @brief Move constructor */
+        VolumeBrickCache(VolumeBrickCache&&) noexcept;
+
+        ~VolumeBrickCache();
+
+        /** @brief Copying is not allowed */
+        VolumeBrickCache& operator=(const VolumeBrickCache&) = delete;
+
+        /** @brief Move assignment */
+        VolumeBrickCache& operator=(VolumeBrickCache&&) noexcept;
+
+        /** @brief Brick size including the border */
+        Vector3i brickSize() const { return _brickSize; }
+
+        /** @brief Brick count in the whole volume in each dimension */
+        Vector3i brickCount() const { return _brickCount; }
+
+        /** @brief Count of slots in the atlas in each dimension */
+        Vector3i slotCount() const { return _slotCount; }
+
+        /** @brief Atlas texture */
+        Texture3D& atlas() { return _atlas; }
+
+        /** @brief Brick indirection texture */
+        Texture3D& indirection() { return _indirection; }
+
+        /** @brief Count of resident bricks */
+        UnsignedInt residentCount() const { return _residentCount; }
+
+        /**
+         * @brief Whether given brick is resident
+         *
+         * Expects that @p brick is less than @ref brickCount()
+         * @cpp .product() @ce.
+         */
+        bool isResident(UnsignedInt brick) const;
+
+        /**
+         * @brief Max count of brick uploads in a single frame
+         *
+         * Default is @cpp 16 @ce.
+         */
+        UnsignedInt maxUploadsPerFrame() const { return _maxUploadsPerFrame; }
+
+        /**
+         * @brief Set max count of brick uploads in a single frame
+         * @return Reference to self (for method chaining)
+         *
+         * Limits the time spent in @ref update(), bricks that didn't fit
+         * into the limit are uploaded in subsequent frames.
+         */
+        VolumeBrickCache& setMaxUploadsPerFrame(UnsignedInt count) {
+            _maxUploadsPerFrame = count;
+            return *this;
+        }
+
+        /**
+         * @brief Update the cache
+         * @param visibleBricks Visible brick IDs, ordered from the most
+         *      important one
+         * @param fetch         Function returning data of given brick
+         * @param userData      User data passed to @p fetch
+         * @return Count of uploaded bricks
+         *
+         * Marks resident bricks from @p visibleBricks as used in this frame
+         * and then, in order, uploads bricks that are not resident yet,
+         * until @ref maxUploadsPerFrame() is reached or there are no slots
+         * left that weren't used in this frame. A slot is taken either from
+         * free slots or from the brick that was used least recently. The
+         * image returned from @p fetch is expected to have a size of
+         * @ref brickSize(), its contents are uploaded to the atlas before
+         * @p fetch is called again. If any brick was uploaded or evicted,
+         * the indirection table is uploaded at the end.
+         */
+        UnsignedInt update(Containers::ArrayView<const UnsignedInt> visibleBricks, ImageView3D(*fetch)(UnsignedInt, void*), void* userData = nullptr);
+
+    private:
+        struct Slot {
+            UnsignedInt brick;
+            UnsignedInt lastUsed;
+        };
+
+        Vector3i MAGNUM_GL_LOCAL slotCoordinates(UnsignedInt slot) const;
+
+        Vector3i _brickSize, _brickCount, _slotCount;
+        UnsignedInt _maxUploadsPerFrame{16}, _residentCount{}, _frame{};
+        Texture3D _atlas, _indirection;
+        std::vector<Slot> _slots;
+        std::vector<UnsignedInt> _brickSlots;
+        std::vector<Math::Vector4<UnsignedByte>> _table;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
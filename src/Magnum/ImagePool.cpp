@@ -0,0 +1,207 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImagePool.h"
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "Magnum/PixelFormat.h"
+
+namespace Magnum {
+
+namespace Implementation {
+
+struct ImagePoolState {
+    /* Buckets for 2^MinBucket bytes and up */
+    enum: std::size_t {
+        MinBucket = 12,
+        BucketCount = sizeof(std::size_t)*8 - MinBucket
+    };
+
+    std::mutex mutex;
+    std::vector<char*> buckets[BucketCount];
+    std::size_t maxCachedSize,
+        cachedCount{},
+        cachedSize{},
+        usedCount{};
+    /* Set when the pool is destroyed while allocations are still in use, the
+       last released allocation then deletes the state */
+    bool orphaned{};
+};
+
+}
+
+namespace {
+
+using Implementation::ImagePoolState;
+
+/* Placed in front of each allocation so the (stateless) array deleter can
+   find where the memory belongs. Padded to keep the data maximally
+   aligned. */
+struct Header {
+    ImagePoolState* state;
+    std::size_t bucket;
+};
+
+constexpr std::size_t HeaderSize = (sizeof(Header) + alignof(std::max_align_t) - 1)/alignof(std::max_align_t)*alignof(std::max_align_t);
+
+std::size_t bucketFor(const std::size_t size) {
+    std::size_t bucket = ImagePoolState::MinBucket;
+    while((std::size_t{1} << bucket) < size) ++bucket;
+    return bucket - ImagePoolState::MinBucket;
+}
+
+constexpr std::size_t bucketSize(const std::size_t bucket) {
+    return std::size_t{1} << (bucket + ImagePoolState::MinBucket);
+}
+
+/* Expects the mutex to be locked */
+void trimTo(ImagePoolState& state, const std::size_t size) {
+    /* Free the largest allocations first */
+    for(std::size_t i = ImagePoolState::BucketCount; i != 0 && state.cachedSize > size; --i) {
+        std::vector<char*>& bucket = state.buckets[i - 1];
+        while(!bucket.empty() && state.cachedSize > size) {
+            delete[] bucket.back();
+            bucket.pop_back();
+            state.cachedSize -= bucketSize(i - 1);
+            --state.cachedCount;
+        }
+    }
+}
+
+void deleter(char* const data, std::size_t) {
+    char* const memory = data - HeaderSize;
+    const Header& header = *reinterpret_cast<const Header*>(memory);
+    ImagePoolState& state = *header.state;
+    const std::size_t bucket = header.bucket;
+
+    bool deleteState = false;
+    {
+        std::lock_guard<std::mutex> lock{state.mutex};
+        --state.usedCount;
+
+        if(state.orphaned) {
+            delete[] memory;
+            deleteState = !state.usedCount;
+        } else if(state.cachedSize + bucketSize(bucket) <= state.maxCachedSize) {
+            state.buckets[bucket].push_back(memory);
+            state.cachedSize += bucketSize(bucket);
+            ++state.cachedCount;
+        } else delete[] memory;
+    }
+
+    if(deleteState) delete &state;
+}
+
+}
+
+ImagePool::ImagePool(const std::size_t maxCachedSize): _state{new ImagePoolState} {
+    _state->maxCachedSize = maxCachedSize;
+}
+
+ImagePool::~ImagePool() {
+    bool deleteState;
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        trimTo(*_state, 0);
+        _state->orphaned = true;
+        deleteState = !_state->usedCount;
+    }
+
+    if(deleteState) delete _state;
+}
+
+std::size_t ImagePool::maxCachedSize() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->maxCachedSize;
+}
+
+ImagePool& ImagePool::setMaxCachedSize(const std::size_t size) {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    _state->maxCachedSize = size;
+    trimTo(*_state, size);
+    return *this;
+}
+
+std::size_t ImagePool::cachedCount() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->cachedCount;
+}
+
+std::size_t ImagePool::cachedSize() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->cachedSize;
+}
+
+std::size_t ImagePool::usedCount() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->usedCount;
+}
+
+void ImagePool::clear() {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    trimTo(*_state, 0);
+}
+
+Containers::Array<char> ImagePool::allocate(const std::size_t size) {
+    if(!size) return nullptr;
+
+    const std::size_t bucket = bucketFor(size);
+    char* memory = nullptr;
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        std::vector<char*>& cached = _state->buckets[bucket];
+        if(!cached.empty()) {
+            memory = cached.back();
+            cached.pop_back();
+            _state->cachedSize -= bucketSize(bucket);
+            --_state->cachedCount;
+        }
+        ++_state->usedCount;
+    }
+
+    /* Nothing cached, allocate a new one outside of the lock */
+    if(!memory) {
+        memory = new char[HeaderSize + bucketSize(bucket)];
+        new(memory) Header{_state, bucket};
+    }
+
+    return Containers::Array<char>{memory + HeaderSize, size, deleter};
+}
+
+template<UnsignedInt dimensions> Image<dimensions> ImagePool::image(const PixelStorage storage, const PixelFormat format, const VectorTypeFor<dimensions, Int>& size) {
+    /* Calculate the size the same way as the Image constructor checks it */
+    const Image<dimensions> empty{storage, format};
+    return Image<dimensions>{storage, format, size, allocate(Implementation::imageDataSizeFor(empty, size))};
+}
+
+template Image1D ImagePool::image<1>(PixelStorage, PixelFormat, const Math::Vector<1, Int>&);
+template Image2D ImagePool::image<2>(PixelStorage, PixelFormat, const Vector2i&);
+template Image3D ImagePool::image<3>(PixelStorage, PixelFormat, const Vector3i&);
+
+}
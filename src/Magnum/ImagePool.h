@@ -0,0 +1,190 @@
+#ifndef Magnum_ImagePool_h
+#define Magnum_ImagePool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::ImagePool
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Image.h"
+
+namespace Magnum {
+
+namespace Implementation { struct ImagePoolState; }
+
+/**
+@brief Pool of reusable image memory
+
+Every @ref Image owns its data through a @ref Corrade::Containers::Array, so
+each decoded, converted or read back image results in a separate heap
+allocation, which for large images often means fresh pages from the system.
+When images of similar sizes are created repeatedly --- for example a
+framebuffer readback every frame or a batch conversion of a directory of
+textures --- the pool keeps the memory of released images and hands it out
+again instead of going to the allocator.
+
+@section ImagePool-usage Usage
+
+Allocate an image using @ref image() and use it as usual. Once the image (or
+its data released with @ref Image::release()) is destroyed, the memory goes
+back to the pool and the next allocation of a similar size reuses it:
+
+@snippet Magnum.cpp ImagePool-usage
+
+Because the memory is returned through a custom deleter of the
+@ref Corrade::Containers::Array, the images can be passed to any API that
+takes @ref Image by value or by reference. Functions that reuse existing
+image memory if it's large enough, such as
+@ref GL::AbstractFramebuffer::read(const Range2Di&, Image2D&), keep the pool
+deleter as well. Raw memory for custom image types can be allocated with
+@ref allocate().
+
+@section ImagePool-buckets Size buckets
+
+Allocations are rounded up to the next power of two (but at least 4 kB) and
+cached in a separate bucket for each size. An allocation is thus at most
+twice as large as requested and released memory can be reused for any
+request that falls into the same bucket. The total amount of cached memory
+can be limited with @ref setMaxCachedSize(), memory released over the limit
+is freed right away. Call @ref clear() to free all cached memory.
+
+@section ImagePool-lifetime Lifetime and thread safety
+
+The pool can be destroyed while allocations made from it are still alive,
+these are then freed directly when released. Allocations can be made and
+released from multiple threads at the same time, the pool internally
+protects its state with a mutex.
+*/
+class MAGNUM_EXPORT ImagePool {
+    public:
+        /**
+         * @brief Constructor
+         * @param maxCachedSize     Max total size of cached memory in bytes
+         *
+         * @see @ref setMaxCachedSize()
+         */
+        explicit ImagePool(std::size_t maxCachedSize = ~std::size_t{});
+
+        /** @brief Copying is not allowed */
+        ImagePool(const ImagePool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ImagePool(ImagePool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all cached memory. Allocations that are still alive stay
+         * valid and are freed when released.
+         */
+        ~ImagePool();
+
+        /** @brief Copying is not allowed */
+        ImagePool& operator=(const ImagePool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ImagePool& operator=(ImagePool&&) = delete;
+
+        /** @brief Max total size of cached memory in bytes */
+        std::size_t maxCachedSize() const;
+
+        /**
+         * @brief Set max total size of cached memory
+         * @return Reference to self (for method chaining)
+         *
+         * Memory that's released when the limit is reached is freed
+         * right away. If the currently cached size is over the limit,
+         * largest cached allocations are freed until it fits. Default is
+         * unlimited.
+         */
+        ImagePool& setMaxCachedSize(std::size_t size);
+
+        /** @brief Count of cached allocations ready for reuse */
+        std::size_t cachedCount() const;
+
+        /**
+         * @brief Total size of cached allocations ready for reuse
+         *
+         * In bytes, including the rounding to bucket size.
+         */
+        std::size_t cachedSize() const;
+
+        /**
+         * @brief Count of allocations that are currently in use
+         *
+         * Allocations made by @ref allocate() or @ref image() that weren't
+         * released yet.
+         */
+        std::size_t usedCount() const;
+
+        /**
+         * @brief Free all cached memory
+         *
+         * Allocations that are in use are not affected.
+         */
+        void clear();
+
+        /**
+         * @brief Allocate memory
+         *
+         * Returns an array of exactly @p size bytes that has its memory
+         * returned to the pool on destruction. The contents are not
+         * initialized. If @p size is zero, returns an empty array without
+         * involving the pool at all.
+         */
+        Containers::Array<char> allocate(std::size_t size);
+
+        /**
+         * @brief Allocate an image
+         * @param storage       Storage of pixel data
+         * @param format        Format of pixel data
+         * @param size          Image size
+         *
+         * Allocates memory for the image using @ref allocate(), with the
+         * size calculated from @p storage, @p format and @p size. The pixel
+         * data are not initialized.
+         */
+        template<UnsignedInt dimensions> Image<dimensions> image(PixelStorage storage, PixelFormat format, const VectorTypeFor<dimensions, Int>& size);
+
+        /** @overload
+         *
+         * Equivalent to the above with default-constructed
+         * @ref PixelStorage.
+         */
+        template<UnsignedInt dimensions> Image<dimensions> image(PixelFormat format, const VectorTypeFor<dimensions, Int>& size) {
+            return image<dimensions>({}, format, size);
+        }
+
+    private:
+        Implementation::ImagePoolState* _state;
+};
+
+}
+
+#endif
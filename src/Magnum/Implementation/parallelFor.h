@@ -0,0 +1,93 @@
+#ifndef Magnum_Implementation_parallelFor_h
+#define Magnum_Implementation_parallelFor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "Magnum/JobSystem.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Calls the function for all tasks, distributed among at most given count of
+   workers of globalJobExecutor(), including the calling thread. The tasks are
+   picked up in a first-come, first-serve manner. If there's just one task or
+   one thread, everything is run on the calling thread without touching the
+   executor. */
+template<class F> void parallelFor(const UnsignedInt threadCount, const std::size_t taskCount, const F& function) {
+    if(threadCount > 1 && taskCount > 1) {
+        AbstractJobExecutor& executor = globalJobExecutor();
+        UnsignedInt workerCount = executor.workerCount();
+        if(workerCount > threadCount) workerCount = threadCount;
+        if(workerCount > taskCount) workerCount = taskCount;
+
+        if(workerCount > 1) {
+            struct State {
+                const F& function;
+                std::atomic<std::size_t> nextTask;
+                std::size_t taskCount;
+            } state{function, {0}, taskCount};
+            executor.execute(workerCount, [](void* data, UnsignedInt) {
+                State& state = *static_cast<State*>(data);
+                for(std::size_t task; (task = state.nextTask++) < state.taskCount; )
+                    state.function(task);
+            }, &state);
+            return;
+        }
+    }
+
+    for(std::size_t task = 0; task != taskCount; ++task)
+        function(task);
+}
+
+/* Count of independent accumulators used by the strided reductions in
+   Math::Algorithms. Eight is enough to hide the latency of a dependent add
+   and to fill a whole AVX register with floats. */
+enum: std::size_t { ReductionLanes = 8 };
+
+/* Size of a chunk processed by a single task. The chunking doesn't depend on
+   the thread count so the results are bit-exact regardless of how many
+   threads were used. */
+enum: std::size_t { ReductionChunkSize = 65536 };
+
+/* Calls function(begin, end) for consecutive chunks of the [0, size) range,
+   distributed using parallelFor() above, and returns the partial results in
+   chunk order */
+template<class T, class F> std::vector<T> parallelReduce(const UnsignedInt threadCount, const std::size_t size, const F& function) {
+    const std::size_t chunkCount = (size + ReductionChunkSize - 1)/ReductionChunkSize;
+    std::vector<T> partials(chunkCount);
+    parallelFor(threadCount, chunkCount, [&](const std::size_t chunk) {
+        const std::size_t begin = chunk*ReductionChunkSize;
+        const std::size_t end = begin + ReductionChunkSize < size ? begin + ReductionChunkSize : size;
+        partials[chunk] = function(begin, end);
+    });
+    return partials;
+}
+
+}}
+
+#endif
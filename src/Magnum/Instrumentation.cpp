@@ -0,0 +1,129 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Instrumentation.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace Instrumentation {
+
+namespace {
+
+/* Single-producer single-consumer ring. Only the owning thread advances the
+   head, only consume() advances the tail. */
+struct Ring {
+    Event events[RingSize];
+    std::atomic<std::size_t> head{0}, tail{0};
+};
+
+/* Rings of all threads that ever recorded anything. The mutex is taken only
+   when a thread records its first event and in consume(). */
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Ring>> rings;
+};
+
+Registry& registry() {
+    static Registry registry;
+    return registry;
+}
+
+std::atomic<bool> enabled{false};
+std::atomic<UnsignedLong> dropped{0};
+
+#if !defined(CORRADE_GCC47_COMPATIBILITY) && !defined(CORRADE_TARGET_APPLE)
+thread_local
+#else
+__thread
+#endif
+Ring* currentRing = nullptr;
+
+Ring& ring() {
+    if(!currentRing) {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock{r.mutex};
+        r.rings.emplace_back(new Ring);
+        currentRing = r.rings.back().get();
+    }
+
+    return *currentRing;
+}
+
+UnsignedLong now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+}
+
+bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+void setEnabled(const bool enabled_) {
+    enabled.store(enabled_, std::memory_order_relaxed);
+}
+
+std::size_t consume(void(*const callback)(const Event&, UnsignedInt, void*), void* const userData) {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock{r.mutex};
+
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != r.rings.size(); ++i) {
+        Ring& ring = *r.rings[i];
+        const std::size_t head = ring.head.load(std::memory_order_acquire);
+        std::size_t tail = ring.tail.load(std::memory_order_relaxed);
+        for(; tail != head; ++tail, ++count)
+            callback(ring.events[tail % RingSize], i, userData);
+
+        /* Release the slots for the producer */
+        ring.tail.store(tail, std::memory_order_release);
+    }
+
+    return count;
+}
+
+UnsignedLong droppedCount() { return dropped.load(std::memory_order_relaxed); }
+
+Scope::Scope(const char* const name) noexcept: _name{name}, _begin{enabled.load(std::memory_order_relaxed) ? now() : 0} {}
+
+Scope::~Scope() {
+    if(!_begin) return;
+
+    Ring& r = ring();
+    const std::size_t head = r.head.load(std::memory_order_relaxed);
+    if(head - r.tail.load(std::memory_order_acquire) == RingSize) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    r.events[head % RingSize] = Event{_name, _begin, now()};
+    r.head.store(head + 1, std::memory_order_release);
+}
+
+}}
@@ -0,0 +1,203 @@
+#ifndef Magnum_Instrumentation_h
+#define Magnum_Instrumentation_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Magnum::Instrumentation, macro @ref MAGNUM_INSTRUMENTATION_SCOPE()
+ */
+
+#include <cstddef>
+
+#include "Magnum/Types.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Instrumentation of library hot paths
+
+If Magnum is built with @ref MAGNUM_BUILD_INSTRUMENTATION enabled, selected
+hot paths inside the libraries are marked with @ref MAGNUM_INSTRUMENTATION_SCOPE()
+and record how long they took. Currently instrumented are
+@ref GL::Mesh::draw(), @ref GL::Buffer::setData(), texture subimage uploads,
+@ref Trade::AbstractImporter::mesh3D(), @ref Text::AbstractRenderer::render()
+and @ref SceneGraph::Object::setClean(). The macro can be used in application
+code as well. Without @ref MAGNUM_BUILD_INSTRUMENTATION the macro expands to
+nothing, so the instrumentation has no cost.
+
+@section Instrumentation-usage Usage
+
+Even if the instrumentation is compiled in, nothing is recorded until
+@ref setEnabled() is called. Each thread then records into its own ring
+buffer, without any locking. The events are retrieved with @ref consume(),
+which can be called from any thread, for example once per frame together with
+@ref DebugTools::Profiler::nextFrame():
+
+@code{.cpp}
+Instrumentation::setEnabled(true);
+
+// ...
+
+Instrumentation::consume([](const Instrumentation::Event& event, UnsignedInt thread, void*) {
+    Debug{} << event.name << "on thread" << thread << "took"
+        << (event.end - event.begin)/1000 << "µs";
+});
+@endcode
+
+If a thread records more than @ref RingSize events before they get consumed,
+the new events are dropped and counted in @ref droppedCount().
+*/
+namespace Instrumentation {
+
+/**
+@brief Count of events each thread can record before they get consumed
+
+@see @ref consume(), @ref droppedCount()
+*/
+enum: std::size_t { RingSize = 4096 };
+
+/**
+@brief Instrumentation event
+
+@see @ref consume()
+*/
+struct Event {
+    /**
+     * @brief Scope name
+     *
+     * Points to the string passed to @ref MAGNUM_INSTRUMENTATION_SCOPE() or
+     * @ref Scope::Scope(), which is expected to be a string literal or
+     * otherwise have a static lifetime.
+     */
+    const char* name;
+
+    /**
+     * @brief Begin time
+     *
+     * In nanoseconds of @ref std::chrono::high_resolution_clock time since
+     * its epoch.
+     */
+    UnsignedLong begin;
+
+    /**
+     * @brief End time
+     *
+     * In nanoseconds of @ref std::chrono::high_resolution_clock time since
+     * its epoch.
+     */
+    UnsignedLong end;
+};
+
+/**
+@brief Whether recording is enabled
+
+@see @ref setEnabled()
+*/
+MAGNUM_EXPORT bool isEnabled();
+
+/**
+@brief Enable or disable recording
+
+Disabled by default. The scopes check the state on construction, so the ones
+that are active while enabling or disabling the recording are not affected.
+Has no effect on the library itself if it's not built with
+@ref MAGNUM_BUILD_INSTRUMENTATION.
+*/
+MAGNUM_EXPORT void setEnabled(bool enabled);
+
+/**
+@brief Consume recorded events
+
+Calls @p callback for each event recorded since the last call, together with
+index of the thread that recorded it (in order in which the threads recorded
+their first event) and @p userData. Events of each thread are passed in order
+in which they ended. Returns count of consumed events. Only one thread can
+consume at a time, concurrent calls are serialized.
+*/
+MAGNUM_EXPORT std::size_t consume(void(*callback)(const Event&, UnsignedInt, void*), void* userData = nullptr);
+
+/**
+@brief Count of dropped events
+
+Total count of events that were dropped because the ring buffer of the
+recording thread was full.
+@see @ref RingSize
+*/
+MAGNUM_EXPORT UnsignedLong droppedCount();
+
+/**
+@brief Instrumentation scope
+
+Records time spent between construction and destruction, if recording is
+enabled. Usually used through @ref MAGNUM_INSTRUMENTATION_SCOPE(), which
+compiles to nothing if @ref MAGNUM_BUILD_INSTRUMENTATION is not defined.
+*/
+class MAGNUM_EXPORT Scope {
+    public:
+        /**
+         * @brief Constructor
+         * @param name      Scope name. Expected to have a static lifetime.
+         */
+        explicit Scope(const char* name) noexcept;
+
+        /** @brief Copying is not allowed */
+        Scope(const Scope&) = delete;
+
+        /** @brief Destructor */
+        ~Scope();
+
+        /** @brief Copying is not allowed */
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* _name;
+        UnsignedLong _begin;
+};
+
+}
+
+}
+
+/** @hideinitializer
+@brief Instrument current scope
+@param name     Scope name, expected to be a string literal
+
+If @ref MAGNUM_BUILD_INSTRUMENTATION is defined, creates a
+@ref Magnum::Instrumentation::Scope "Instrumentation::Scope" that lasts until
+the end of current scope. Otherwise expands to nothing.
+*/
+#ifdef MAGNUM_BUILD_INSTRUMENTATION
+#define MAGNUM_INSTRUMENTATION_SCOPE(name) \
+    _MAGNUM_INSTRUMENTATION_SCOPE_IMPLEMENTATION(name, __LINE__)
+#define _MAGNUM_INSTRUMENTATION_SCOPE_IMPLEMENTATION(name, line) \
+    _MAGNUM_INSTRUMENTATION_SCOPE_IMPLEMENTATION2(name, line)
+#define _MAGNUM_INSTRUMENTATION_SCOPE_IMPLEMENTATION2(name, line) \
+    const Magnum::Instrumentation::Scope _magnumInstrumentationScope ## line{name}
+#else
+#define MAGNUM_INSTRUMENTATION_SCOPE(name) do {} while(0)
+#endif
+
+#endif
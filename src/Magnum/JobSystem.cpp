@@ -0,0 +1,591 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JobSystem.h"
+
+#include <atomic>
+#include <cstdint>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace Magnum {
+
+AbstractJobExecutor::AbstractJobExecutor() = default;
+
+AbstractJobExecutor::~AbstractJobExecutor() = default;
+
+UnsignedInt AbstractJobExecutor::workerCount() const {
+    const UnsignedInt count = doWorkerCount();
+    return count ? count : 1;
+}
+
+void AbstractJobExecutor::execute(const UnsignedInt count, const WorkerFunction function, void* const state) {
+    CORRADE_ASSERT(count && count <= workerCount(),
+        "AbstractJobExecutor::execute(): expected 1 to" << workerCount() << "workers but got" << count, );
+    doExecute(count, function, state);
+}
+
+namespace Implementation {
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+/* One call to execute(), lives on the stack of the calling thread */
+struct ThreadPoolJobBatch {
+    AbstractJobExecutor::WorkerFunction function;
+    void* state;
+    UnsignedInt count;
+
+    /* Protected by the mutex */
+    UnsignedInt next, unfinished;
+};
+#endif
+
+struct ThreadPoolJobExecutorState {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake, done;
+
+    /* Protected by the mutex. Batches that still have workers not picked up
+       by anybody, in the order the calls came. */
+    std::deque<ThreadPoolJobBatch*> batches;
+    bool quit{};
+    #endif
+};
+
+}
+
+namespace {
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+/* Expects the mutex to be locked, unlocks it while running the worker */
+void runThreadPoolWorker(Implementation::ThreadPoolJobExecutorState& state, Implementation::ThreadPoolJobBatch& batch, std::unique_lock<std::mutex>& lock) {
+    const UnsignedInt worker = batch.next++;
+    if(batch.next == batch.count)
+        state.batches.erase(std::find(state.batches.begin(), state.batches.end(), &batch));
+
+    lock.unlock();
+    batch.function(batch.state, worker);
+    lock.lock();
+
+    if(!--batch.unfinished) state.done.notify_all();
+}
+
+void threadPoolThread(Implementation::ThreadPoolJobExecutorState& state) {
+    std::unique_lock<std::mutex> lock{state.mutex};
+    for(;;) {
+        state.wake.wait(lock, [&]{ return state.quit || !state.batches.empty(); });
+        if(state.quit) return;
+        runThreadPoolWorker(state, *state.batches.front(), lock);
+    }
+}
+#endif
+
+}
+
+ThreadPoolJobExecutor::ThreadPoolJobExecutor(const UnsignedInt threadCount): _state{new Implementation::ThreadPoolJobExecutorState} {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _state->threads.reserve(threadCount);
+    for(UnsignedInt i = 0; i != threadCount; ++i)
+        _state->threads.emplace_back(threadPoolThread, std::ref(*_state));
+    #else
+    static_cast<void>(threadCount);
+    #endif
+}
+
+ThreadPoolJobExecutor::~ThreadPoolJobExecutor() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->quit = true;
+    }
+    _state->wake.notify_all();
+    for(std::thread& thread: _state->threads) thread.join();
+    #endif
+}
+
+UnsignedInt ThreadPoolJobExecutor::doWorkerCount() const {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    return _state->threads.size() + 1;
+    #else
+    return 1;
+    #endif
+}
+
+void ThreadPoolJobExecutor::doExecute(const UnsignedInt count, const WorkerFunction function, void* const state) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(count > 1) {
+        Implementation::ThreadPoolJobBatch batch{function, state, count, 1, count - 1};
+        {
+            std::lock_guard<std::mutex> lock{_state->mutex};
+            _state->batches.push_back(&batch);
+        }
+        _state->wake.notify_all();
+
+        /* The calling thread is the first worker */
+        function(state, 0);
+
+        /* Run workers that no thread got to yet instead of waiting for them,
+           which also makes nested calls from inside a worker finish when all
+           threads are busy. Then wait for the ones running elsewhere. */
+        std::unique_lock<std::mutex> lock{_state->mutex};
+        while(batch.next != batch.count)
+            runThreadPoolWorker(*_state, batch, lock);
+        _state->done.wait(lock, [&]{ return !batch.unfinished; });
+        return;
+    }
+    #endif
+
+    for(UnsignedInt i = 0; i != count; ++i) function(state, i);
+}
+
+namespace {
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+std::atomic<AbstractJobExecutor*> globalExecutor{};
+#else
+AbstractJobExecutor* globalExecutor{};
+#endif
+
+}
+
+AbstractJobExecutor& globalJobExecutor() {
+    if(AbstractJobExecutor* const executor = globalExecutor)
+        return *executor;
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    const UnsignedInt hardwareConcurrency = std::thread::hardware_concurrency();
+    static ThreadPoolJobExecutor defaultExecutor{hardwareConcurrency ? hardwareConcurrency - 1 : 0};
+    #else
+    static ThreadPoolJobExecutor defaultExecutor{0};
+    #endif
+    return defaultExecutor;
+}
+
+void setGlobalJobExecutor(AbstractJobExecutor* const executor) {
+    globalExecutor = executor;
+}
+
+TaskGraph::TaskGraph() = default;
+
+TaskGraph::TaskGraph(TaskGraph&&) noexcept = default;
+
+TaskGraph::~TaskGraph() = default;
+
+TaskGraph& TaskGraph::operator=(TaskGraph&&) noexcept = default;
+
+UnsignedInt TaskGraph::add(Function function, const Containers::ArrayView<const UnsignedInt> dependencies) {
+    const UnsignedInt id = _tasks.size();
+    for(const UnsignedInt dependency: dependencies) {
+        CORRADE_ASSERT(dependency < id,
+            "TaskGraph::add(): dependency" << dependency << "out of range for" << id << "tasks", {});
+        _tasks[dependency].successors.push_back(id);
+    }
+
+    _tasks.push_back(Task{std::move(function), UnsignedInt(dependencies.size()), {}});
+    return id;
+}
+
+UnsignedInt TaskGraph::add(Function function, const std::initializer_list<UnsignedInt> dependencies) {
+    return add(std::move(function), Containers::ArrayView<const UnsignedInt>{dependencies.begin(), dependencies.size()});
+}
+
+void TaskGraph::clear() {
+    _tasks.clear();
+}
+
+namespace Implementation {
+
+/* Fixed-capacity lock-free work-stealing deque (Chase and Lev, with memory
+   orderings from Lê et al., Correct and Efficient Work-Stealing for Weak
+   Memory Models). The owning worker pushes and pops at the bottom, other
+   workers steal from the top. Items are chunk or task indices. */
+struct JobDeque {
+    void reset(const std::size_t capacity) {
+        if(!items || capacity > mask + 1) {
+            std::size_t size = 1;
+            while(size < capacity) size <<= 1;
+            items.reset(new std::atomic<std::size_t>[size]);
+            mask = size - 1;
+        }
+        top.store(0, std::memory_order_relaxed);
+        bottom.store(0, std::memory_order_relaxed);
+    }
+
+    void push(const std::size_t item) {
+        const std::ptrdiff_t b = bottom.load(std::memory_order_relaxed);
+        items[b & mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    bool pop(std::size_t& item) {
+        const std::ptrdiff_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::ptrdiff_t t = top.load(std::memory_order_relaxed);
+
+        /* Empty */
+        if(t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        item = items[b & mask].load(std::memory_order_relaxed);
+
+        /* Last item, race against thieves for it */
+        if(t == b) {
+            const bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+
+        return true;
+    }
+
+    enum class Steal { Empty, Lost, Success };
+
+    /* Lost means another thread took the item first, there can be more */
+    Steal steal(std::size_t& item) {
+        std::ptrdiff_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::ptrdiff_t b = bottom.load(std::memory_order_acquire);
+        if(t >= b) return Steal::Empty;
+
+        item = items[t & mask].load(std::memory_order_relaxed);
+        return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed) ? Steal::Success : Steal::Lost;
+    }
+
+    std::unique_ptr<std::atomic<std::size_t>[]> items;
+    std::size_t mask{};
+    std::atomic<std::ptrdiff_t> top{}, bottom{};
+};
+
+/* Queues and scratch memory of a single parallelFor() or run() call, reused
+   by later calls. Each concurrent or nested call takes its own. */
+struct JobContext {
+    std::vector<ScratchArena> scratch;
+
+    /* unique_ptr because atomics are not movable */
+    std::vector<std::unique_ptr<JobDeque>> deques;
+    std::unique_ptr<std::atomic<UnsignedInt>[]> pending;
+    std::size_t pendingCapacity{};
+};
+
+struct JobSystemState {
+    std::unique_ptr<ThreadPoolJobExecutor> ownedExecutor;
+    AbstractJobExecutor* executor;
+    UnsignedInt workerCount;
+
+    /* All contexts ever created, the first one backs scratch(). Contexts not
+       used by any call are in the free list, protected by the mutex. */
+    std::vector<std::unique_ptr<JobContext>> contexts;
+    std::vector<JobContext*> freeContexts;
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::mutex mutex;
+    #endif
+};
+
+}
+
+/* Needs access to private TaskGraph::Task and JobSystem::ChunkFunction */
+struct JobSystem::Worker {
+    struct Run {
+        Implementation::JobContext* context;
+        UnsignedInt workerCount;
+
+        /* For parallelFor() */
+        ChunkFunction chunkFunction;
+        void* chunkState;
+        std::size_t begin, end, chunkSize;
+
+        /* For run(). Workers that find no task sleep on the condition until
+           the epoch changes, which happens after each batch of newly ready
+           tasks is pushed, or until all tasks are done. */
+        TaskGraph::Task* tasks;
+        std::atomic<std::size_t> remaining;
+        std::atomic<std::uint64_t> epoch;
+        std::atomic<UnsignedInt> parked;
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        std::mutex mutex;
+        std::condition_variable wake;
+        #endif
+    };
+
+    /* Take from own queue first, then try to steal from the others. Returns
+       false only if all queues were seen empty. */
+    static bool take(Run& run, const UnsignedInt worker, std::size_t& item) {
+        if(run.context->deques[worker]->pop(item)) return true;
+
+        for(;;) {
+            bool lost = false;
+            for(UnsignedInt i = 1; i != run.workerCount; ++i) {
+                const Implementation::JobDeque::Steal result = run.context->deques[(worker + i) % run.workerCount]->steal(item);
+                if(result == Implementation::JobDeque::Steal::Success)
+                    return true;
+                if(result == Implementation::JobDeque::Steal::Lost)
+                    lost = true;
+            }
+            if(!lost) return false;
+        }
+    }
+
+    static void run(void* data, const UnsignedInt worker) {
+        Run& run = *static_cast<Run*>(data);
+        if(run.tasks) runTasks(run, worker);
+        else runChunks(run, worker);
+    }
+
+    /* No chunks get added once the run started, so the worker is done once
+       all queues are empty. The chunks that are still being processed
+       elsewhere are waited for by the executor. */
+    static void runChunks(Run& run, const UnsignedInt worker) {
+        ScratchArena& scratch = run.context->scratch[worker];
+        std::size_t item;
+        while(take(run, worker, item)) {
+            const std::size_t begin = run.begin + item*run.chunkSize;
+            const std::size_t end = run.end - begin > run.chunkSize ? begin + run.chunkSize : run.end;
+            run.chunkFunction(run.chunkState, begin, end, scratch);
+            scratch.reset();
+        }
+    }
+
+    static void runTasks(Run& run, const UnsignedInt worker) {
+        Implementation::JobDeque& deque = *run.context->deques[worker];
+        ScratchArena& scratch = run.context->scratch[worker];
+
+        while(run.remaining.load(std::memory_order_acquire)) {
+            /* Has to be read before looking into the queues, so tasks pushed
+               after the lookup aren't missed when going to sleep */
+            const std::uint64_t epoch = run.epoch.load(std::memory_order_seq_cst);
+
+            std::size_t item;
+            if(!take(run, worker, item)) {
+                /* With workers executed sequentially the queues are never
+                   empty while tasks remain, so this is reached only with
+                   actual threads */
+                #ifndef CORRADE_TARGET_EMSCRIPTEN
+                std::unique_lock<std::mutex> lock{run.mutex};
+                run.parked.fetch_add(1, std::memory_order_seq_cst);
+                run.wake.wait(lock, [&]{
+                    return run.epoch.load(std::memory_order_seq_cst) != epoch || !run.remaining.load(std::memory_order_acquire);
+                });
+                run.parked.fetch_sub(1, std::memory_order_relaxed);
+                #endif
+                continue;
+            }
+
+            TaskGraph::Task& task = run.tasks[item];
+            task.function(scratch);
+            scratch.reset();
+
+            /* Schedule successors that have all their dependencies done.
+               Pushed in reverse so the lowest ID is run next. */
+            bool pushed = false;
+            for(auto it = task.successors.rbegin(); it != task.successors.rend(); ++it) {
+                if(run.context->pending[*it].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    deque.push(*it);
+                    pushed = true;
+                }
+            }
+
+            /* Wake sleeping workers if there's new work for them or if
+               everything is done */
+            const bool done = run.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1;
+            if(pushed) run.epoch.fetch_add(1, std::memory_order_seq_cst);
+            if(done || (pushed && run.parked.load(std::memory_order_seq_cst))) {
+                #ifndef CORRADE_TARGET_EMSCRIPTEN
+                {
+                    std::lock_guard<std::mutex> lock{run.mutex};
+                }
+                run.wake.notify_all();
+                #endif
+            }
+        }
+    }
+};
+
+JobSystem::JobSystem(const UnsignedInt threadCount): _state{new Implementation::JobSystemState} {
+    _state->ownedExecutor.reset(new ThreadPoolJobExecutor{threadCount});
+    _state->executor = _state->ownedExecutor.get();
+    initialize();
+}
+
+JobSystem::JobSystem(AbstractJobExecutor& executor): _state{new Implementation::JobSystemState} {
+    _state->executor = &executor;
+    initialize();
+}
+
+JobSystem::JobSystem(JobSystem&&) noexcept = default;
+
+JobSystem::~JobSystem() = default;
+
+JobSystem& JobSystem::operator=(JobSystem&&) noexcept = default;
+
+void JobSystem::initialize() {
+    _state->workerCount = _state->executor->workerCount();
+    _state->freeContexts.push_back(&acquireContext());
+}
+
+Implementation::JobContext& JobSystem::acquireContext() {
+    {
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        #endif
+        if(!_state->freeContexts.empty()) {
+            Implementation::JobContext& context = *_state->freeContexts.back();
+            _state->freeContexts.pop_back();
+            return context;
+        }
+    }
+
+    /* Allocate outside of the lock, only the list itself needs it */
+    std::unique_ptr<Implementation::JobContext> context{new Implementation::JobContext};
+    context->scratch.resize(_state->workerCount);
+    context->deques.reserve(_state->workerCount);
+    for(UnsignedInt i = 0; i != _state->workerCount; ++i)
+        context->deques.emplace_back(new Implementation::JobDeque);
+
+    Implementation::JobContext& out = *context;
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    #endif
+    _state->contexts.push_back(std::move(context));
+    return out;
+}
+
+void JobSystem::releaseContext(Implementation::JobContext& context) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    #endif
+    _state->freeContexts.push_back(&context);
+}
+
+AbstractJobExecutor& JobSystem::executor() { return *_state->executor; }
+
+UnsignedInt JobSystem::workerCount() const { return _state->workerCount; }
+
+ScratchArena& JobSystem::scratch(const UnsignedInt worker) {
+    std::vector<ScratchArena>& scratch = _state->contexts[0]->scratch;
+    CORRADE_ASSERT(worker < scratch.size(),
+        "JobSystem::scratch(): worker" << worker << "out of range for" << scratch.size() << "workers", scratch[0]);
+    return scratch[worker];
+}
+
+void JobSystem::parallelForInternal(const std::size_t begin, const std::size_t end, const std::size_t chunkSize, const ChunkFunction function, void* const state) {
+    CORRADE_ASSERT(chunkSize,
+        "JobSystem::parallelFor(): expected non-zero chunk size", );
+
+    if(begin >= end) return;
+    const std::size_t chunkCount = (end - begin + chunkSize - 1)/chunkSize;
+    const UnsignedInt workerCount = chunkCount < _state->workerCount ? chunkCount : _state->workerCount;
+    Implementation::JobContext& context = acquireContext();
+
+    /* Just one worker, go serially */
+    if(workerCount == 1) {
+        ScratchArena& scratch = context.scratch[0];
+        for(std::size_t i = begin; i < end; i += chunkSize) {
+            function(state, i, end - i > chunkSize ? i + chunkSize : end, scratch);
+            scratch.reset();
+        }
+        releaseContext(context);
+        return;
+    }
+
+    /* Give each worker a contiguous share of chunks, pushed in reverse so the
+       owner pops them from first to last and thieves take from the end */
+    const std::size_t share = (chunkCount + workerCount - 1)/workerCount;
+    for(UnsignedInt worker = 0; worker != workerCount; ++worker) {
+        Implementation::JobDeque& deque = *context.deques[worker];
+        deque.reset(share);
+        const std::size_t shareBegin = worker*share;
+        const std::size_t shareEnd = shareBegin + share < chunkCount ? shareBegin + share : chunkCount;
+        for(std::size_t i = shareEnd; i > shareBegin; --i) deque.push(i - 1);
+    }
+
+    Worker::Run run{};
+    run.context = &context;
+    run.workerCount = workerCount;
+    run.chunkFunction = function;
+    run.chunkState = state;
+    run.begin = begin;
+    run.end = end;
+    run.chunkSize = chunkSize;
+    _state->executor->execute(workerCount, Worker::run, &run);
+    releaseContext(context);
+}
+
+void JobSystem::run(TaskGraph& graph) {
+    if(graph._tasks.empty()) return;
+    const std::size_t taskCount = graph._tasks.size();
+    const UnsignedInt workerCount = taskCount < _state->workerCount ? taskCount : _state->workerCount;
+    Implementation::JobContext& context = acquireContext();
+
+    /* Just one worker, go serially. Dependencies always have lower IDs, so
+       the task order is valid. */
+    if(workerCount == 1) {
+        ScratchArena& scratch = context.scratch[0];
+        for(TaskGraph::Task& task: graph._tasks) {
+            task.function(scratch);
+            scratch.reset();
+        }
+        releaseContext(context);
+        return;
+    }
+
+    if(context.pendingCapacity < taskCount) {
+        context.pending.reset(new std::atomic<UnsignedInt>[taskCount]);
+        context.pendingCapacity = taskCount;
+    }
+
+    /* Every task can end up in any queue, so each needs the full capacity */
+    for(UnsignedInt worker = 0; worker != workerCount; ++worker)
+        context.deques[worker]->reset(taskCount);
+
+    /* Distribute tasks without dependencies among the workers */
+    UnsignedInt rootCount = 0;
+    for(std::size_t i = taskCount; i != 0; --i) {
+        const UnsignedInt dependencyCount = graph._tasks[i - 1].dependencyCount;
+        context.pending[i - 1].store(dependencyCount, std::memory_order_relaxed);
+        if(!dependencyCount) context.deques[rootCount++ % workerCount]->push(i - 1);
+    }
+
+    Worker::Run run{};
+    run.context = &context;
+    run.workerCount = workerCount;
+    run.tasks = graph._tasks.data();
+    run.remaining.store(taskCount, std::memory_order_relaxed);
+    _state->executor->execute(workerCount, Worker::run, &run);
+    releaseContext(context);
+}
+
+}
@@ -0,0 +1,417 @@
+#ifndef Magnum_JobSystem_h
+#define Magnum_JobSystem_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::JobSystem, @ref Magnum::AbstractJobExecutor, @ref Magnum::ThreadPoolJobExecutor, @ref Magnum::TaskGraph, function @ref Magnum::globalJobExecutor(), @ref Magnum::setGlobalJobExecutor()
+ */
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/ScratchArena.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+namespace Implementation {
+    struct JobContext;
+    struct JobSystemState;
+    struct ThreadPoolJobExecutorState;
+}
+
+/**
+@brief Base for job executors
+
+Runs worker functions of a @ref JobSystem on actual threads. Subclass it to
+route the work of a @ref JobSystem onto an application-specific thread pool,
+use @ref ThreadPoolJobExecutor for a default implementation.
+
+The executor doesn't need to know anything about the jobs themselves, it only
+runs a given count of worker functions and waits for them to finish. The
+workers pick jobs from each other using lock-free work stealing, so it's not
+an error if some workers start late or if the executor runs some of them
+sequentially --- the other workers take over their jobs in the meantime. The
+only requirements are that each worker function is called exactly once and
+that @ref execute() returns only after all of them returned.
+
+@section AbstractJobExecutor-subclassing Subclassing
+
+The subclass needs to implement @ref doWorkerCount() and @ref doExecute(),
+for example forwarding to an existing thread pool:
+
+@snippet Magnum.cpp AbstractJobExecutor-subclassing
+*/
+class MAGNUM_EXPORT AbstractJobExecutor {
+    public:
+        /**
+         * @brief Worker function
+         *
+         * The first parameter is the opaque state passed to @ref execute(),
+         * the second is the worker index.
+         */
+        typedef void(*WorkerFunction)(void*, UnsignedInt);
+
+        explicit AbstractJobExecutor();
+
+        virtual ~AbstractJobExecutor();
+
+        /**
+         * @brief Max count of concurrently running workers
+         *
+         * Including the calling thread. Always at least @cpp 1 @ce.
+         */
+        UnsignedInt workerCount() const;
+
+        /**
+         * @brief Execute worker functions
+         * @param count     Worker count, expected to be at least
+         *      @cpp 1 @ce and not larger than @ref workerCount()
+         * @param function  Worker function
+         * @param state     Opaque state passed to the worker function
+         *
+         * Calls @p function for each worker index in range
+         * @cpp [0, count) @ce exactly once and returns after all calls
+         * returned.
+         */
+        void execute(UnsignedInt count, WorkerFunction function, void* state);
+
+    private:
+        /** @brief Implementation for @ref workerCount() */
+        virtual UnsignedInt doWorkerCount() const = 0;
+
+        /**
+         * @brief Implementation for @ref execute()
+         *
+         * The @p count is guaranteed to be in range @cpp [1, workerCount()] @ce.
+         * The calling thread is free to run some of the workers itself.
+         */
+        virtual void doExecute(UnsignedInt count, WorkerFunction function, void* state) = 0;
+};
+
+/**
+@brief Thread pool job executor
+
+Default @ref AbstractJobExecutor implementation owning a fixed count of
+threads, which sleep while there's no work. The calling thread runs the first
+worker, so the executor has one more worker than threads. With zero threads
+everything runs on the calling thread.
+
+Calls to @ref execute() from multiple threads at once, or from inside a worker
+function, are queued and served by the threads in the order they came. The
+calling thread doesn't wait idle for the pool to get to its call --- after
+running the first worker it runs all workers that weren't picked up by any
+thread yet, so a nested call finishes even if all threads are busy.
+
+Threads are not available on @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", the
+thread count is ignored there and everything runs on the calling thread.
+*/
+class MAGNUM_EXPORT ThreadPoolJobExecutor: public AbstractJobExecutor {
+    public:
+        /**
+         * @brief Constructor
+         * @param threadCount   Count of threads to create, not including the
+         *      calling thread
+         */
+        explicit ThreadPoolJobExecutor(UnsignedInt threadCount);
+
+        /** @brief Copying is not allowed */
+        ThreadPoolJobExecutor(const ThreadPoolJobExecutor&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPoolJobExecutor(ThreadPoolJobExecutor&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops and joins all threads.
+         */
+        ~ThreadPoolJobExecutor();
+
+        /** @brief Copying is not allowed */
+        ThreadPoolJobExecutor& operator=(const ThreadPoolJobExecutor&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPoolJobExecutor& operator=(ThreadPoolJobExecutor&&) = delete;
+
+    private:
+        MAGNUM_LOCAL UnsignedInt doWorkerCount() const override;
+        MAGNUM_LOCAL void doExecute(UnsignedInt count, WorkerFunction function, void* state) override;
+
+        std::unique_ptr<Implementation::ThreadPoolJobExecutorState> _state;
+};
+
+/**
+@brief Task graph
+
+Set of tasks with dependencies between them, executed with
+@ref JobSystem::run(TaskGraph&). A task is run only after all its
+dependencies finished, independent tasks may run in parallel. Tasks can only
+depend on tasks that were added before them, so the graph can't contain
+cycles.
+
+@snippet Magnum.cpp TaskGraph-usage
+
+The graph can be run any number of times, each run executes all tasks once.
+*/
+class MAGNUM_EXPORT TaskGraph {
+    public:
+        /**
+         * @brief Task function
+         *
+         * Gets the scratch arena of the worker running the task.
+         */
+        typedef std::function<void(ScratchArena&)> Function;
+
+        explicit TaskGraph();
+
+        /** @brief Copying is not allowed */
+        TaskGraph(const TaskGraph&) = delete;
+
+        /** @brief Move constructor */
+        TaskGraph(TaskGraph&&) noexcept;
+
+        ~TaskGraph();
+
+        /** @brief Copying is not allowed */
+        TaskGraph& operator=(const TaskGraph&) = delete;
+
+        /** @brief Move assignment */
+        TaskGraph& operator=(TaskGraph&&) noexcept;
+
+        /** @brief Task count */
+        std::size_t size() const { return _tasks.size(); }
+
+        /**
+         * @brief Add a task
+         * @param function      Task function
+         * @param dependencies  Tasks that have to finish before this one
+         *
+         * Returns ID of the task, which can be used as a dependency of tasks
+         * added later. Expects that all @p dependencies are IDs of already
+         * added tasks.
+         */
+        UnsignedInt add(Function function, Containers::ArrayView<const UnsignedInt> dependencies);
+
+        /** @overload */
+        UnsignedInt add(Function function, std::initializer_list<UnsignedInt> dependencies = {});
+
+        /**
+         * @brief Clear the graph
+         *
+         * Removes all tasks.
+         */
+        void clear();
+
+    private:
+        friend class JobSystem;
+
+        struct Task {
+            Function function;
+            UnsignedInt dependencyCount;
+            std::vector<UnsignedInt> successors;
+        };
+
+        std::vector<Task> _tasks;
+};
+
+/**
+@brief Job system
+
+Lightweight scheduler distributing work among a fixed set of workers. Each
+worker has its own lock-free double-ended queue of jobs, takes jobs from its
+bottom and, once it's empty, steals jobs from the top of queues of other
+workers. This keeps related jobs on the same worker while the load stays
+balanced.
+
+The workers themselves are run by an @ref AbstractJobExecutor. By default the
+job system creates a @ref ThreadPoolJobExecutor with given thread count, but
+it can also use an existing executor that routes the work onto an
+application-specific thread pool.
+
+@section JobSystem-parallel-for Parallel for
+
+@ref parallelFor() splits a range into chunks of given size and calls the
+function on each chunk on any of the workers:
+
+@snippet Magnum.cpp JobSystem-parallelFor
+
+The chunk boundaries depend only on the range and the chunk size, not on the
+worker count, so algorithms that produce a partial result for each chunk and
+combine them in chunk order afterwards give the same result independently of
+how many threads there are.
+
+@section JobSystem-determinism Zero threads
+
+With zero threads (the default) there's just one worker and everything is run
+directly on the calling thread in a fixed order --- chunks of
+@ref parallelFor() from the first to the last and tasks of a @ref TaskGraph
+in the order they were added. This is useful for deterministic builds,
+debugging and platforms without threads.
+
+@section JobSystem-concurrency Concurrent and nested calls
+
+@ref parallelFor() and @ref run() can be called from multiple threads at
+once and from inside a job. Each call gets its own set of queues and scratch
+arenas and is distributed among the workers of the @ref executor() like any
+other, so the calls don't serialize on each other. Idle workers sleep until
+new jobs arrive or until all jobs of the call are done.
+
+@section JobSystem-scratch Scratch memory
+
+Each worker has its own @ref ScratchArena, which is passed to the job
+functions and reset after each job. Use it for temporary allocations inside
+the job to avoid going to the heap allocator from many threads at once.
+*/
+class MAGNUM_EXPORT JobSystem {
+    public:
+        /**
+         * @brief Construct with a default thread pool
+         * @param threadCount   Count of threads to create, not including the
+         *      calling thread
+         *
+         * Creates a @ref ThreadPoolJobExecutor with @p threadCount threads.
+         * Pass @cpp std::thread::hardware_concurrency() - 1 @ce to use all
+         * cores.
+         */
+        explicit JobSystem(UnsignedInt threadCount = 0);
+
+        /**
+         * @brief Construct with an existing executor
+         *
+         * The @p executor is expected to stay alive for the whole lifetime
+         * of the job system.
+         */
+        explicit JobSystem(AbstractJobExecutor& executor);
+
+        /** @brief Copying is not allowed */
+        JobSystem(const JobSystem&) = delete;
+
+        /** @brief Move constructor */
+        JobSystem(JobSystem&&) noexcept;
+
+        ~JobSystem();
+
+        /** @brief Copying is not allowed */
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /** @brief Move assignment */
+        JobSystem& operator=(JobSystem&&) noexcept;
+
+        /** @brief Executor */
+        AbstractJobExecutor& executor();
+
+        /**
+         * @brief Worker count
+         *
+         * Value of @ref AbstractJobExecutor::workerCount() of
+         * @ref executor() at the time the job system was constructed.
+         */
+        UnsignedInt workerCount() const;
+
+        /**
+         * @brief Scratch arena of given worker
+         *
+         * Expects that @p worker is less than @ref workerCount(). The arenas
+         * shouldn't be accessed while jobs are running, except for the one
+         * passed to the job function. Concurrent and nested calls may use
+         * different arenas than the ones returned from here.
+         */
+        ScratchArena& scratch(UnsignedInt worker);
+
+        /**
+         * @brief Run a function over a range in parallel
+         * @param begin     Range begin
+         * @param end       Range end
+         * @param chunkSize Chunk size, expected to be non-zero
+         * @param function  Function to run on each chunk
+         *
+         * Splits the @cpp [begin, end) @ce range into chunks of
+         * @p chunkSize items (the last chunk can be smaller) and calls
+         * @p function with @cpp (chunkBegin, chunkEnd, scratch) @ce for each,
+         * where @cpp scratch @ce is the @ref ScratchArena of the worker
+         * running the chunk. Each worker starts with a contiguous share of
+         * the chunks, going from the first to the last, and steals chunks
+         * from the end of shares of other workers once it's done. Returns
+         * after all chunks are processed.
+         */
+        template<class F> void parallelFor(std::size_t begin, std::size_t end, std::size_t chunkSize, const F& function) {
+            const auto call = [](void* state, std::size_t begin, std::size_t end, ScratchArena& scratch) {
+                (*static_cast<const F*>(state))(begin, end, scratch);
+            };
+            parallelForInternal(begin, end, chunkSize, call, const_cast<F*>(&function));
+        }
+
+        /**
+         * @brief Run a task graph
+         *
+         * Runs all tasks of @p graph, each once all its dependencies
+         * finished, and returns after all tasks are done.
+         */
+        void run(TaskGraph& graph);
+
+    private:
+        struct Worker;
+        typedef void(*ChunkFunction)(void*, std::size_t, std::size_t, ScratchArena&);
+
+        MAGNUM_LOCAL void initialize();
+        MAGNUM_LOCAL Implementation::JobContext& acquireContext();
+        MAGNUM_LOCAL void releaseContext(Implementation::JobContext& context);
+
+        void parallelForInternal(std::size_t begin, std::size_t end, std::size_t chunkSize, ChunkFunction function, void* state);
+
+        std::unique_ptr<Implementation::JobSystemState> _state;
+};
+
+/**
+@brief Global job executor
+
+Executor used by algorithms in Magnum that run in parallel, such as
+@ref MeshTools::generateSmoothNormals() or @ref TextureTools::distanceField()
+on the CPU. Unless set with @ref setGlobalJobExecutor(), it's a
+@ref ThreadPoolJobExecutor with @cpp std::thread::hardware_concurrency() - 1 @ce
+threads, created on first use. The thread count passed to the algorithms
+limits how many of its workers are used for a particular call.
+*/
+MAGNUM_EXPORT AbstractJobExecutor& globalJobExecutor();
+
+/**
+@brief Set the global job executor
+
+Makes @ref globalJobExecutor() return @p executor, pass @cpp nullptr @ce to
+go back to the default thread pool. The @p executor is expected to stay alive
+until it's replaced and shouldn't be replaced while any algorithm is using
+it.
+*/
+MAGNUM_EXPORT void setGlobalJobExecutor(AbstractJobExecutor* executor);
+
+}
+
+#endif
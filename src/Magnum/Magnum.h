@@ -100,6 +100,27 @@ Magnum contexts. Enabled by default.
 #define MAGNUM_BUILD_MULTITHREADED
 #undef MAGNUM_BUILD_MULTITHREADED
 
+/**
+@brief Build with instrumentation
+
+Defined if the library is built with instrumentation points in its hot paths
+enabled. Disabled by default.
+@see @ref MAGNUM_INSTRUMENTATION_SCOPE(), @ref building, @ref cmake
+*/
+#define MAGNUM_BUILD_INSTRUMENTATION
+#undef MAGNUM_BUILD_INSTRUMENTATION
+
+/**
+@brief Build with SIMD math specializations
+
+Defined if the library is built with SSE2 / NEON / WebAssembly SIMD
+specializations of @ref Math::Matrix4 and @ref Math::Quaternion hot operations
+for @ref Magnum::Float "Float". Disabled by default.
+@see @ref building, @ref cmake
+*/
+#define MAGNUM_BUILD_MATH_SIMD
+#undef MAGNUM_BUILD_MATH_SIMD
+
 /**
 @brief OpenGL interoperability
 
@@ -326,6 +347,31 @@ Equivalent to GLSL @glsl ivec4 @ce.
 */
 typedef Math::Vector4<Int> Vector4i;
 
+/**
+@brief Two-component half-float vector
+
+Storage-only type, there's no arithmetic on half-floats. Use
+@ref Math::packHalf() / @ref Math::unpackHalf() or the batch
+@ref Math::packHalfInto() / @ref Math::unpackHalfInto() to convert from and
+to @ref Vector2. Suitable for compact texture coordinate vertex attributes,
+see @ref Trade::MeshBlobAttributeType::HalfFloat.
+*/
+typedef Math::Vector2<Half> Vector2h;
+
+/**
+@brief Three-component half-float vector
+
+Storage-only type, see @ref Vector2h for more information.
+*/
+typedef Math::Vector3<Half> Vector3h;
+
+/**
+@brief Four-component half-float vector
+
+Storage-only type, see @ref Vector2h for more information.
+*/
+typedef Math::Vector4<Half> Vector4h;
+
 /** @brief Three-component (RGB) float color */
 typedef Math::Color3<Float> Color3;
 
@@ -759,6 +805,7 @@ enum class SamplerFilter: UnsignedInt;
 enum class SamplerMipmap: UnsignedInt;
 enum class SamplerWrapping: UnsignedInt;
 
+class ScratchArena;
 class Timeline;
 
 #if defined(MAGNUM_BUILD_DEPRECATED) && defined(MAGNUM_TARGET_GL)
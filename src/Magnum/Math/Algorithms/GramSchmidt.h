@@ -29,6 +29,9 @@
  * @brief Function @ref Magnum::Math::Algorithms::gramSchmidtOrthogonalizeInPlace(), @ref Magnum::Math::Algorithms::gramSchmidtOrthogonalize(), @ref Magnum::Math::Algorithms::gramSchmidtOrthonormalizeInPlace(), @ref Magnum::Math::Algorithms::gramSchmidtOrthonormalize()
  */
 
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/RectangularMatrix.h"
 
 namespace Magnum { namespace Math { namespace Algorithms {
@@ -118,6 +121,69 @@ template<std::size_t cols, std::size_t rows, class T> RectangularMatrix<cols, ro
     return matrix;
 }
 
+namespace Implementation {
+
+/* Modified Gram-Schmidt orthonormalization of a block of eight matrices in a
+   structure-of-arrays layout, used by the batch variants of
+   gramSchmidtOrthonormalizeInPlace() and qr() */
+template<std::size_t cols, std::size_t rows, class T> void gramSchmidtOrthonormalizeBlock(T(&a)[cols][rows][8]) {
+    for(std::size_t i = 0; i != cols; ++i) {
+        T length[8]{};
+        for(std::size_t row = 0; row != rows; ++row)
+            for(std::size_t l = 0; l != 8; ++l)
+                length[l] += a[i][row][l]*a[i][row][l];
+        for(std::size_t l = 0; l != 8; ++l)
+            length[l] = T(1)/std::sqrt(length[l]);
+        for(std::size_t row = 0; row != rows; ++row)
+            for(std::size_t l = 0; l != 8; ++l)
+                a[i][row][l] *= length[l];
+
+        for(std::size_t j = i+1; j != cols; ++j) {
+            T dot[8]{};
+            for(std::size_t row = 0; row != rows; ++row)
+                for(std::size_t l = 0; l != 8; ++l)
+                    dot[l] += a[j][row][l]*a[i][row][l];
+            for(std::size_t row = 0; row != rows; ++row)
+                for(std::size_t l = 0; l != 8; ++l)
+                    a[j][row][l] -= dot[l]*a[i][row][l];
+        }
+    }
+}
+
+}
+
+/**
+@brief In-place Gram-Schmidt orthonormalization of a batch of matrices
+@param[in,out] matrices Matrices to perform orthonormalization on
+
+Batch variant of @ref gramSchmidtOrthonormalizeInPlace(RectangularMatrix<cols, rows, T>&).
+The matrices are processed in blocks of eight, transposed to a
+structure-of-arrays layout first so the compiler can vectorize the
+normalization and projection over the whole block.
+*/
+template<std::size_t cols, std::size_t rows, class T> void gramSchmidtOrthonormalizeInPlace(const Corrade::Containers::StridedArrayView<RectangularMatrix<cols, rows, T>>& matrices) {
+    static_assert(cols <= rows, "Unsupported matrix aspect ratio");
+    for(std::size_t offset = 0; offset < matrices.size(); offset += 8) {
+        const std::size_t count = Math::min(matrices.size() - offset, std::size_t(8));
+
+        /* Transpose the block, unused lanes are identity */
+        T a[cols][rows][8];
+        for(std::size_t col = 0; col != cols; ++col)
+            for(std::size_t row = 0; row != rows; ++row)
+                for(std::size_t l = 0; l != 8; ++l)
+                    a[col][row][l] = l < count ? matrices[offset + l][col][row] : T(col == row);
+
+        Implementation::gramSchmidtOrthonormalizeBlock(a);
+
+        for(std::size_t l = 0; l != count; ++l) {
+            RectangularMatrix<cols, rows, T>& out = matrices[offset + l];
+            for(std::size_t col = 0; col != cols; ++col)
+                for(std::size_t row = 0; row != rows; ++row)
+                    out[col][row] = a[col][row][l];
+        }
+    }
+}
+
 }}}
 
 #endif
@@ -29,7 +29,13 @@
  * @brief Function @ref Magnum::Math::Algorithms::kahanSum()
  */
 
+#include <cmath>
+#include <type_traits>
 #include <utility>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/Implementation/parallelFor.h"
 
 namespace Magnum { namespace Math { namespace Algorithms {
 
@@ -71,6 +77,89 @@ template<class Iterator, class T = typename std::decay<decltype(*std::declval<It
     return sum;
 }
 
+namespace Implementation {
+
+/* Neumaier's variant of Kahan summation, handling also the case where the
+   added value is larger than the running sum. Written with a select instead
+   of a branch so the lane loops below can be vectorized. Integers are exact
+   so they don't need any compensation. */
+template<class T> inline typename std::enable_if<std::is_floating_point<T>::value>::type neumaierAdd(T& sum, T& compensation, const T value) {
+    const T t = sum + value;
+    compensation += std::abs(sum) >= std::abs(value) ? (sum - t) + value : (value - t) + sum;
+    sum = t;
+}
+
+template<class T> inline typename std::enable_if<!std::is_floating_point<T>::value>::type neumaierAdd(T& sum, T&, const T value) {
+    sum += value;
+}
+
+template<class T> std::pair<T, T> kahanSumChunk(const Corrade::Containers::StridedArrayView<const T>& values, const std::size_t begin, const std::size_t end) {
+    T sums[Magnum::Implementation::ReductionLanes]{};
+    T compensations[Magnum::Implementation::ReductionLanes]{};
+
+    std::size_t i = begin;
+    constexpr std::size_t lanes = Magnum::Implementation::ReductionLanes;
+
+    /* Contiguous data, accumulate directly from a pointer */
+    if(std::size_t(values.stride()) == sizeof(T)) {
+        const T* const data = &values[0];
+        for(; i + lanes <= end; i += lanes)
+            for(std::size_t j = 0; j != lanes; ++j)
+                neumaierAdd(sums[j], compensations[j], data[i + j]);
+    } else {
+        for(; i + lanes <= end; i += lanes)
+            for(std::size_t j = 0; j != lanes; ++j)
+                neumaierAdd(sums[j], compensations[j], values[i + j]);
+    }
+
+    /* Remaining items continue to go to separate lanes */
+    for(std::size_t j = 0; i != end; ++i, ++j)
+        neumaierAdd(sums[j], compensations[j], values[i]);
+
+    /* Combine the lanes */
+    T sum = sums[0], compensation = compensations[0];
+    for(std::size_t j = 1; j != lanes; ++j) {
+        neumaierAdd(sum, compensation, sums[j]);
+        compensation += compensations[j];
+    }
+
+    return {sum, compensation};
+}
+
+}
+
+/**
+@brief Kahan summation algorithm on a strided array
+@param values       Values to sum
+@param threadCount  Count of threads to distribute the work to, including the
+    calling one. Values @cpp 0 @ce and @cpp 1 @ce mean the calculation is
+    done on the calling thread only.
+
+Compared to @ref kahanSum(Iterator, Iterator, T, T*), uses the
+[Neumaier variant](https://en.wikipedia.org/wiki/Kahan_summation_algorithm#Further_enhancements)
+of the algorithm, which stays precise also when the added value is larger
+than the running sum. The values are distributed in a round-robin fashion to
+eight independent accumulators to hide operation latency and allow the
+compiler to vectorize the loop, and the accumulators are combined at the end.
+Large inputs are processed in fixed-size chunks, optionally in parallel on
+multiple threads. Since the chunking doesn't depend on @p threadCount, the
+result is the same regardless of how many threads were used. If @p values
+are empty, returns @cpp T(0) @ce.
+*/
+template<class T> T kahanSum(const Corrade::Containers::StridedArrayView<const T>& values, UnsignedInt threadCount = 1) {
+    const std::vector<std::pair<T, T>> partials = Magnum::Implementation::parallelReduce<std::pair<T, T>>(threadCount, values.size(), [&values](std::size_t begin, std::size_t end) {
+        return Implementation::kahanSumChunk(values, begin, end);
+    });
+
+    T sum(0), compensation(0);
+    for(const std::pair<T, T>& partial: partials) {
+        Implementation::neumaierAdd(sum, compensation, partial.first);
+        compensation += partial.second;
+    }
+
+    return sum + compensation;
+}
+
 }}}
 
 #endif
@@ -0,0 +1,306 @@
+#ifndef Magnum_Math_Algorithms_KdTree_h
+#define Magnum_Math_Algorithms_KdTree_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::Algorithms::KdTree
+ */
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+/**
+@brief K-d tree
+@tparam T   Point type, a @ref Math::Vector or any of its subclasses
+
+Spatial index over a set of points for range, radius and nearest neighbor
+queries. The points are copied into a single contiguous array together with
+their original indices and reordered so each node of the tree is a
+contiguous range of it, with the splitting point in the middle. The tree is
+thus implicit and doesn't need any extra nodes or pointers, only the split
+axis is stored for each node. Each node is split along the widest axis of
+its bounds, ranges of at most @ref LeafSize points are not split further.
+
+All queries return indices into the original point array. Order of the
+results of @ref pointsInRange() and @ref pointsInRadius() is unspecified,
+@ref nearest() returns the points sorted by distance.
+
+@code{.cpp}
+Containers::StridedArrayView<const Vector3> points = …;
+Math::Algorithms::KdTree<Vector3> tree{points, std::thread::hardware_concurrency()};
+
+std::vector<UnsignedInt> closest = tree.nearest(cursor, 4);
+std::vector<UnsignedInt> neighbors = tree.pointsInRadius(points[17], 0.5f);
+@endcode
+
+The tree is a good choice mainly for nearest neighbor queries and for data
+with large differences in density, see @ref MortonTree for a variant that is
+faster to build and better for range queries over evenly distributed points.
+*/
+template<class T> class KdTree {
+    public:
+        /** @brief Underlying scalar type */
+        typedef typename T::Type Type;
+
+        /** @brief Range type */
+        typedef Range<T::Size, typename T::Type> RangeType;
+
+        /** @brief Max count of points in a leaf node */
+        enum: std::size_t { LeafSize = 8 };
+
+        /**
+         * @brief Constructor
+         * @param points        Points to index
+         * @param threadCount   Count of threads to distribute the build to,
+         *      including the calling one. Values @cpp 0 @ce and @cpp 1 @ce
+         *      mean the build is done on the calling thread only.
+         *
+         * The result is the same regardless of @p threadCount.
+         *
+         * @note On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the
+         *      @p threadCount is ignored and the build is always done on the
+         *      calling thread.
+         */
+        explicit KdTree(const Corrade::Containers::StridedArrayView<const T>& points, UnsignedInt threadCount = 1);
+
+        /** @brief Count of indexed points */
+        std::size_t size() const { return _items.size(); }
+
+        /**
+         * @brief Points in given range
+         *
+         * Returns indices of all points that are inside @p range, including
+         * points on its boundary.
+         */
+        std::vector<UnsignedInt> pointsInRange(const RangeType& range) const;
+
+        /**
+         * @brief Points in given radius
+         *
+         * Returns indices of all points that have a distance from @p center
+         * less than or equal to @p radius.
+         */
+        std::vector<UnsignedInt> pointsInRadius(const T& center, Type radius) const;
+
+        /**
+         * @brief Nearest points
+         *
+         * Returns indices of at most @p count points closest to @p point,
+         * sorted by distance. Points with the same distance are sorted by
+         * their index.
+         */
+        std::vector<UnsignedInt> nearest(const T& point, std::size_t count) const;
+
+    private:
+        struct Item {
+            T point;
+            UnsignedInt index;
+        };
+
+        std::size_t split(std::size_t begin, std::size_t end);
+        void build(std::size_t begin, std::size_t end);
+        void pointsInRange(std::size_t begin, std::size_t end, const RangeType& range, std::vector<UnsignedInt>& out) const;
+        void pointsInRadius(std::size_t begin, std::size_t end, const T& center, Type radius, std::vector<UnsignedInt>& out) const;
+        void nearest(std::size_t begin, std::size_t end, const T& point, std::size_t count, std::vector<std::pair<Type, UnsignedInt>>& heap) const;
+
+        std::vector<Item> _items;
+        /* Split axis for each node, stored at the position of its splitting
+           point */
+        std::vector<UnsignedByte> _axes;
+};
+
+template<class T> KdTree<T>::KdTree(const Corrade::Containers::StridedArrayView<const T>& points, const UnsignedInt threadCount): _items(points.size()), _axes(points.size()) {
+    for(std::size_t i = 0; i != points.size(); ++i)
+        _items[i] = Item{points[i], UnsignedInt(i)};
+
+    /* Split the top levels on the calling thread until there's enough
+       independent subtrees to keep all threads busy, then build the subtrees
+       in parallel. Each node is split the same way in both cases, so the
+       result doesn't depend on the thread count. */
+    std::vector<std::pair<std::size_t, std::size_t>> subtrees{{0, _items.size()}};
+    if(threadCount > 1) {
+        const std::size_t targetCount = std::size_t(threadCount)*4;
+        for(std::size_t i = 0; i != subtrees.size() && subtrees.size() - i < targetCount; ++i) {
+            const std::size_t begin = subtrees[i].first, end = subtrees[i].second;
+            const std::size_t mid = split(begin, end);
+            if(mid == end) continue;
+            subtrees.push_back({begin, mid});
+            subtrees.push_back({mid + 1, end});
+            subtrees[i] = {begin, begin};
+        }
+    }
+
+    Magnum::Implementation::parallelFor(threadCount, subtrees.size(), [this, &subtrees](const std::size_t i) {
+        build(subtrees[i].first, subtrees[i].second);
+    });
+}
+
+template<class T> std::size_t KdTree<T>::split(const std::size_t begin, const std::size_t end) {
+    if(end - begin <= LeafSize) return end;
+
+    /* Split along the widest axis of the node bounds */
+    T min = _items[begin].point, max = min;
+    for(std::size_t i = begin + 1; i != end; ++i) {
+        min = Math::min(min, _items[i].point);
+        max = Math::max(max, _items[i].point);
+    }
+    const T extent = max - min;
+    UnsignedByte axis = 0;
+    for(std::size_t i = 1; i != T::Size; ++i)
+        if(extent[i] > extent[axis]) axis = UnsignedByte(i);
+
+    const std::size_t mid = begin + (end - begin)/2;
+    std::nth_element(_items.begin() + begin, _items.begin() + mid, _items.begin() + end, [axis](const Item& a, const Item& b) {
+        return a.point[axis] < b.point[axis];
+    });
+    _axes[mid] = axis;
+    return mid;
+}
+
+template<class T> void KdTree<T>::build(const std::size_t begin, const std::size_t end) {
+    const std::size_t mid = split(begin, end);
+    if(mid == end) return;
+    build(begin, mid);
+    build(mid + 1, end);
+}
+
+template<class T> std::vector<UnsignedInt> KdTree<T>::pointsInRange(const RangeType& range) const {
+    std::vector<UnsignedInt> out;
+    pointsInRange(0, _items.size(), range, out);
+    return out;
+}
+
+template<class T> void KdTree<T>::pointsInRange(const std::size_t begin, const std::size_t end, const RangeType& range, std::vector<UnsignedInt>& out) const {
+    if(end - begin <= LeafSize) {
+        for(std::size_t i = begin; i != end; ++i)
+            if((_items[i].point >= range.min()).all() && (_items[i].point <= range.max()).all())
+                out.push_back(_items[i].index);
+        return;
+    }
+
+    const std::size_t mid = begin + (end - begin)/2;
+    const UnsignedByte axis = _axes[mid];
+    const Item& item = _items[mid];
+    if(range.min()[axis] <= item.point[axis])
+        pointsInRange(begin, mid, range, out);
+    if((item.point >= range.min()).all() && (item.point <= range.max()).all())
+        out.push_back(item.index);
+    if(range.max()[axis] >= item.point[axis])
+        pointsInRange(mid + 1, end, range, out);
+}
+
+template<class T> std::vector<UnsignedInt> KdTree<T>::pointsInRadius(const T& center, const Type radius) const {
+    std::vector<UnsignedInt> out;
+    pointsInRadius(0, _items.size(), center, radius, out);
+    return out;
+}
+
+template<class T> void KdTree<T>::pointsInRadius(const std::size_t begin, const std::size_t end, const T& center, const Type radius, std::vector<UnsignedInt>& out) const {
+    const Type radiusSquared = radius*radius;
+    if(end - begin <= LeafSize) {
+        for(std::size_t i = begin; i != end; ++i)
+            if((_items[i].point - center).dot() <= radiusSquared)
+                out.push_back(_items[i].index);
+        return;
+    }
+
+    const std::size_t mid = begin + (end - begin)/2;
+    const UnsignedByte axis = _axes[mid];
+    const Item& item = _items[mid];
+    if(center[axis] - radius <= item.point[axis])
+        pointsInRadius(begin, mid, center, radius, out);
+    if((item.point - center).dot() <= radiusSquared)
+        out.push_back(item.index);
+    if(center[axis] + radius >= item.point[axis])
+        pointsInRadius(mid + 1, end, center, radius, out);
+}
+
+template<class T> std::vector<UnsignedInt> KdTree<T>::nearest(const T& point, const std::size_t count) const {
+    /* Max-heap of squared distances and original indices, the farthest of
+       the candidates is on top */
+    std::vector<std::pair<Type, UnsignedInt>> heap;
+    if(count) {
+        heap.reserve(count);
+        nearest(0, _items.size(), point, count, heap);
+    }
+
+    std::sort(heap.begin(), heap.end());
+    std::vector<UnsignedInt> out;
+    out.reserve(heap.size());
+    for(const std::pair<Type, UnsignedInt>& candidate: heap)
+        out.push_back(candidate.second);
+    return out;
+}
+
+template<class T> void KdTree<T>::nearest(const std::size_t begin, const std::size_t end, const T& point, const std::size_t count, std::vector<std::pair<Type, UnsignedInt>>& heap) const {
+    auto consider = [&point, count, &heap](const Item& item) {
+        const std::pair<Type, UnsignedInt> candidate{(item.point - point).dot(), item.index};
+        if(heap.size() < count) {
+            heap.push_back(candidate);
+            std::push_heap(heap.begin(), heap.end());
+        } else if(candidate < heap.front()) {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = candidate;
+            std::push_heap(heap.begin(), heap.end());
+        }
+    };
+
+    if(end - begin <= LeafSize) {
+        for(std::size_t i = begin; i != end; ++i) consider(_items[i]);
+        return;
+    }
+
+    const std::size_t mid = begin + (end - begin)/2;
+    const UnsignedByte axis = _axes[mid];
+    const Item& item = _items[mid];
+    consider(item);
+
+    /* Descend into the side containing the point first, the other side only
+       if it can contain anything closer than the current candidates */
+    const Type difference = point[axis] - item.point[axis];
+    if(difference < Type(0)) {
+        nearest(begin, mid, point, count, heap);
+        if(heap.size() < count || difference*difference <= heap.front().first)
+            nearest(mid + 1, end, point, count, heap);
+    } else {
+        nearest(mid + 1, end, point, count, heap);
+        if(heap.size() < count || difference*difference <= heap.front().first)
+            nearest(begin, mid, point, count, heap);
+    }
+}
+
+}}}
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef Magnum_Math_Algorithms_MinMax_h
+#define Magnum_Math_Algorithms_MinMax_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::min(), @ref Magnum::Math::Algorithms::max(), @ref Magnum::Math::Algorithms::minmax()
+ */
+
+#include <utility>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace Implementation {
+
+/* Min / max / minmax accumulators, each lane is independent so the loops can
+   be vectorized. Unlike Math::Implementation::minmax() the minmax variant
+   doesn't use an else branch. */
+template<class T> struct MinReduction {
+    typedef T Result;
+    static void init(T& lane, const T& value) { lane = value; }
+    static void add(T& lane, const T& value) { lane = Math::min(value, lane); }
+    static void combine(T& result, const T& lane) { add(result, lane); }
+};
+
+template<class T> struct MaxReduction {
+    typedef T Result;
+    static void init(T& lane, const T& value) { lane = value; }
+    static void add(T& lane, const T& value) { lane = Math::max(value, lane); }
+    static void combine(T& result, const T& lane) { add(result, lane); }
+};
+
+template<class T> struct MinmaxReduction {
+    typedef std::pair<T, T> Result;
+    static void init(Result& lane, const T& value) { lane = {value, value}; }
+    static void add(Result& lane, const T& value) {
+        lane.first = Math::min(value, lane.first);
+        lane.second = Math::max(value, lane.second);
+    }
+    static void combine(Result& result, const Result& lane) {
+        result.first = Math::min(lane.first, result.first);
+        result.second = Math::max(lane.second, result.second);
+    }
+};
+
+template<class Reduction, class T> typename Reduction::Result reduceChunk(const Corrade::Containers::StridedArrayView<const T>& values, const std::size_t begin, const std::size_t end) {
+    constexpr std::size_t lanes = Magnum::Implementation::ReductionLanes;
+    typename Reduction::Result accumulators[lanes];
+    for(std::size_t j = 0; j != lanes; ++j)
+        Reduction::init(accumulators[j], values[begin]);
+
+    std::size_t i = begin;
+
+    /* Contiguous data, accumulate directly from a pointer */
+    if(std::size_t(values.stride()) == sizeof(T)) {
+        const T* const data = &values[0];
+        for(; i + lanes <= end; i += lanes)
+            for(std::size_t j = 0; j != lanes; ++j)
+                Reduction::add(accumulators[j], data[i + j]);
+    } else {
+        for(; i + lanes <= end; i += lanes)
+            for(std::size_t j = 0; j != lanes; ++j)
+                Reduction::add(accumulators[j], values[i + j]);
+    }
+
+    for(; i != end; ++i)
+        Reduction::add(accumulators[0], values[i]);
+
+    for(std::size_t j = 1; j != lanes; ++j)
+        Reduction::combine(accumulators[0], accumulators[j]);
+    return accumulators[0];
+}
+
+template<class Reduction, class T> typename Reduction::Result reduce(const Corrade::Containers::StridedArrayView<const T>& values, const UnsignedInt threadCount) {
+    if(values.empty()) return {};
+
+    const std::vector<typename Reduction::Result> partials = Magnum::Implementation::parallelReduce<typename Reduction::Result>(threadCount, values.size(), [&values](std::size_t begin, std::size_t end) {
+        return reduceChunk<Reduction>(values, begin, end);
+    });
+
+    typename Reduction::Result result = partials[0];
+    for(std::size_t i = 1; i != partials.size(); ++i)
+        Reduction::combine(result, partials[i]);
+    return result;
+}
+
+}
+
+/**
+@brief Minimum of a strided array
+@param values       Values to search
+@param threadCount  Count of threads to distribute the work to, including the
+    calling one. Values @cpp 0 @ce and @cpp 1 @ce mean the calculation is
+    done on the calling thread only.
+
+Equivalent to @ref Math::min(Corrade::Containers::ArrayView<const T>), but
+operating on a strided view, using eight independent accumulators to allow
+the compiler to vectorize the loop and optionally processing large inputs in
+parallel on multiple threads. Works on scalars as well as vectors, in which
+case the minimum is calculated component-wise. If @p values are empty,
+returns default-constructed value. The result is unspecified if the input
+contains *NaN*s.
+@see @ref max(), @ref minmax(), @ref kahanSum()
+*/
+template<class T> T min(const Corrade::Containers::StridedArrayView<const T>& values, UnsignedInt threadCount = 1) {
+    return Implementation::reduce<Implementation::MinReduction<T>>(values, threadCount);
+}
+
+/**
+@brief Maximum of a strided array
+
+Equivalent to @ref Math::max(Corrade::Containers::ArrayView<const T>). See
+@ref min() for more information.
+@see @ref minmax(), @ref kahanSum()
+*/
+template<class T> T max(const Corrade::Containers::StridedArrayView<const T>& values, UnsignedInt threadCount = 1) {
+    return Implementation::reduce<Implementation::MaxReduction<T>>(values, threadCount);
+}
+
+/**
+@brief Minimum and maximum of a strided array
+
+Equivalent to @ref Math::minmax(Corrade::Containers::ArrayView<const T>),
+doing both reductions in a single pass. Useful for calculating bounding boxes
+of large point sets together with
+@ref Range::Range(const std::pair<VectorType, VectorType>&). See @ref min()
+for more information.
+@see @ref max(), @ref kahanSum()
+*/
+template<class T> std::pair<T, T> minmax(const Corrade::Containers::StridedArrayView<const T>& values, UnsignedInt threadCount = 1) {
+    return Implementation::reduce<Implementation::MinmaxReduction<T>>(values, threadCount);
+}
+
+}}}
+
+#endif
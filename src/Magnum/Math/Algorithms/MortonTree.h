@@ -0,0 +1,443 @@
+#ifndef Magnum_Math_Algorithms_MortonTree_h
+#define Magnum_Math_Algorithms_MortonTree_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::Algorithms::MortonTree, alias @ref Magnum::Math::Algorithms::MortonQuadtree, @ref Magnum::Math::Algorithms::MortonOctree
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <queue>
+#include <utility>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Algorithms/MinMax.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace Implementation {
+
+template<std::size_t dimensions> struct MortonCode;
+
+/* Spreads the lowest 32 bits so there's one zero bit between each */
+template<> struct MortonCode<2> {
+    static std::uint64_t spread(std::uint64_t x) {
+        x &= 0xffffffffull;
+        x = (x | x << 16) & 0x0000ffff0000ffffull;
+        x = (x | x << 8) & 0x00ff00ff00ff00ffull;
+        x = (x | x << 4) & 0x0f0f0f0f0f0f0f0full;
+        x = (x | x << 2) & 0x3333333333333333ull;
+        x = (x | x << 1) & 0x5555555555555555ull;
+        return x;
+    }
+};
+
+/* Spreads the lowest 21 bits so there's two zero bits between each */
+template<> struct MortonCode<3> {
+    static std::uint64_t spread(std::uint64_t x) {
+        x &= 0x1fffffull;
+        x = (x | x << 32) & 0x001f00000000ffffull;
+        x = (x | x << 16) & 0x001f0000ff0000ffull;
+        x = (x | x << 8) & 0x100f00f00f00f00full;
+        x = (x | x << 4) & 0x10c30c30c30c30c3ull;
+        x = (x | x << 2) & 0x1249249249249249ull;
+        return x;
+    }
+};
+
+}
+
+/**
+@brief Linear quadtree or octree
+@tparam T   Point type, a two- or three-component @ref Math::Vector or any of
+    its subclasses
+
+Spatial index over a set of points for range, radius and nearest neighbor
+queries. The points are quantized to a grid of @f$ 2^{21} @f$ cells in each
+dimension spanning their bounds, the quantized coordinates are interleaved
+into a Morton (Z-order) code and the points are sorted by it. A node of the
+tree is then a range of points sharing the same code prefix, so the tree
+doesn't need to be stored explicitly --- child nodes are found by a binary
+search in the sorted codes. Nodes with at most @ref LeafSize points are not
+subdivided further.
+
+Apart from being less memory-hungry than a pointer-based tree, sorting by the
+Morton code keeps points that are close in space also close in memory and the
+build is a parallel sort, which makes it faster to build than @ref KdTree.
+The tree doesn't adapt to the point distribution however, so for data with
+large differences in density the @ref KdTree may perform better.
+
+All queries return indices into the original point array. Order of the
+results of @ref pointsInRange() and @ref pointsInRadius() is unspecified,
+@ref nearest() returns the points sorted by distance.
+
+@code{.cpp}
+Containers::StridedArrayView<const Vector3> points = …;
+Math::Algorithms::MortonOctree<Float> tree{points, std::thread::hardware_concurrency()};
+
+std::vector<UnsignedInt> visible = tree.pointsInRange(selection);
+@endcode
+
+@see @ref MortonQuadtree, @ref MortonOctree
+*/
+template<class T> class MortonTree {
+    static_assert(T::Size == 2 || T::Size == 3, "only two- and three-dimensional trees are supported");
+
+    public:
+        /** @brief Underlying scalar type */
+        typedef typename T::Type Type;
+
+        /** @brief Range type */
+        typedef Range<T::Size, typename T::Type> RangeType;
+
+        /** @brief Quantized coordinates type */
+        typedef Vector<T::Size, UnsignedInt> CoordinatesType;
+
+        enum: UnsignedInt {
+            /** Count of bits per quantized coordinate and max tree depth */
+            Bits = 21
+        };
+
+        /** @brief Max count of points in a leaf node */
+        enum: std::size_t { LeafSize = 16 };
+
+        /**
+         * @brief Morton code for given quantized coordinates
+         *
+         * Lowest @ref Bits bits of each coordinate are interleaved, with
+         * the X coordinate in the lowest bit.
+         */
+        static std::uint64_t mortonCode(const CoordinatesType& coordinates) {
+            std::uint64_t code = 0;
+            for(std::size_t i = 0; i != T::Size; ++i)
+                code |= Implementation::MortonCode<T::Size>::spread(coordinates[i]) << i;
+            return code;
+        }
+
+        /**
+         * @brief Constructor
+         * @param points        Points to index
+         * @param threadCount   Count of threads to distribute the build to,
+         *      including the calling one. Values @cpp 0 @ce and @cpp 1 @ce
+         *      mean the build is done on the calling thread only.
+         *
+         * The result is the same regardless of @p threadCount.
+         *
+         * @note On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the
+         *      @p threadCount is ignored and the build is always done on the
+         *      calling thread.
+         */
+        explicit MortonTree(const Corrade::Containers::StridedArrayView<const T>& points, UnsignedInt threadCount = 1);
+
+        /** @brief Count of indexed points */
+        std::size_t size() const { return _codes.size(); }
+
+        /**
+         * @brief Bounds of all points
+         *
+         * Both minimum and maximum are inclusive.
+         */
+        RangeType bounds() const { return _bounds; }
+
+        /**
+         * @brief Sorted Morton codes
+         *
+         * Codes of all points in ascending order.
+         * @see @ref indices(), @ref mortonCode()
+         */
+        Corrade::Containers::ArrayView<const std::uint64_t> codes() const {
+            return {_codes.data(), _codes.size()};
+        }
+
+        /**
+         * @brief Point indices in Morton order
+         *
+         * Indices into the original point array corresponding to
+         * @ref codes(). Iterating the points in this order has generally
+         * better cache locality than iterating them in the original order.
+         */
+        Corrade::Containers::ArrayView<const UnsignedInt> indices() const {
+            return {_indices.data(), _indices.size()};
+        }
+
+        /**
+         * @brief Points in given range
+         *
+         * Returns indices of all points that are inside @p range, including
+         * points on its boundary.
+         */
+        std::vector<UnsignedInt> pointsInRange(const RangeType& range) const;
+
+        /**
+         * @brief Points in given radius
+         *
+         * Returns indices of all points that have a distance from @p center
+         * less than or equal to @p radius.
+         */
+        std::vector<UnsignedInt> pointsInRadius(const T& center, Type radius) const;
+
+        /**
+         * @brief Nearest points
+         *
+         * Returns indices of at most @p count points closest to @p point,
+         * sorted by distance. Points with the same distance are sorted by
+         * their index.
+         */
+        std::vector<UnsignedInt> nearest(const T& point, std::size_t count) const;
+
+    private:
+        struct Node {
+            UnsignedInt level;
+            CoordinatesType cell;
+            std::uint64_t code;
+            std::size_t begin, end;
+        };
+
+        /* Bounds of a node, inflated by one cell on each side to account for
+           quantization errors */
+        RangeType nodeBounds(const Node& node) const;
+        template<class F> void forEachChild(const Node& node, const F& function) const;
+        template<class Classify, class Test> void query(const Node& node, const Classify& classify, const Test& test, std::vector<UnsignedInt>& out) const;
+
+        RangeType _bounds;
+        T _cellSize;
+        std::vector<std::uint64_t> _codes;
+        std::vector<UnsignedInt> _indices;
+        /* Points in Morton order */
+        std::vector<T> _points;
+};
+
+/**
+@brief Linear quadtree
+
+Convenience alternative to @cpp MortonTree<Vector2<T>> @ce. See
+@ref MortonTree for more information.
+@see @ref MortonOctree
+*/
+template<class T> using MortonQuadtree = MortonTree<Vector2<T>>;
+
+/**
+@brief Linear octree
+
+Convenience alternative to @cpp MortonTree<Vector3<T>> @ce. See
+@ref MortonTree for more information.
+@see @ref MortonQuadtree
+*/
+template<class T> using MortonOctree = MortonTree<Vector3<T>>;
+
+template<class T> MortonTree<T>::MortonTree(const Corrade::Containers::StridedArrayView<const T>& points, const UnsignedInt threadCount): _bounds{minmax(points, threadCount)}, _cellSize{}, _codes(points.size()), _indices(points.size()), _points(points.size()) {
+    const Type maxCoordinate((1u << Bits) - 1);
+    const T extent = _bounds.size();
+    T scale;
+    for(std::size_t i = 0; i != T::Size; ++i) {
+        scale[i] = extent[i] > Type(0) ? maxCoordinate/extent[i] : Type(0);
+        _cellSize[i] = extent[i]/maxCoordinate;
+    }
+
+    /* Calculate the codes and sort them in one chunk per thread, then merge
+       the sorted chunks pairwise. The (code, index) pairs are unique, so the
+       order doesn't depend on the thread count. */
+    const std::size_t size = points.size();
+    const std::size_t chunkCount = threadCount > 1 ? threadCount : 1;
+    std::vector<std::pair<std::uint64_t, UnsignedInt>> items(size);
+    auto chunkBegin = [size, chunkCount](const std::size_t chunk) {
+        return chunk*size/chunkCount;
+    };
+    Magnum::Implementation::parallelFor(threadCount, chunkCount, [&](const std::size_t chunk) {
+        const std::size_t begin = chunkBegin(chunk), end = chunkBegin(chunk + 1);
+        for(std::size_t i = begin; i != end; ++i) {
+            const T scaled = Math::clamp((points[i] - _bounds.min())*scale, Type(0), maxCoordinate);
+            items[i] = {mortonCode(CoordinatesType{scaled}), UnsignedInt(i)};
+        }
+        std::sort(items.begin() + begin, items.begin() + end);
+    });
+    for(std::size_t width = 1; width < chunkCount; width *= 2) {
+        Magnum::Implementation::parallelFor(threadCount, (chunkCount + 2*width - 1)/(2*width), [&](const std::size_t i) {
+            const std::size_t first = i*2*width;
+            const std::size_t middle = std::min(first + width, chunkCount);
+            const std::size_t last = std::min(first + 2*width, chunkCount);
+            std::inplace_merge(items.begin() + chunkBegin(first), items.begin() + chunkBegin(middle), items.begin() + chunkBegin(last));
+        });
+    }
+
+    Magnum::Implementation::parallelFor(threadCount, chunkCount, [&](const std::size_t chunk) {
+        for(std::size_t i = chunkBegin(chunk), end = chunkBegin(chunk + 1); i != end; ++i) {
+            _codes[i] = items[i].first;
+            _indices[i] = items[i].second;
+            _points[i] = points[items[i].second];
+        }
+    });
+}
+
+template<class T> auto MortonTree<T>::nodeBounds(const Node& node) const -> RangeType {
+    const CoordinatesType side{1u << (Bits - node.level)};
+    return {_bounds.min() + (T{node.cell} - T{Type(1)})*_cellSize,
+            _bounds.min() + (T{node.cell + side} + T{Type(1)})*_cellSize};
+}
+
+template<class T> template<class F> void MortonTree<T>::forEachChild(const Node& node, const F& function) const {
+    const UnsignedInt level = node.level + 1;
+    const UnsignedInt shift = T::Size*(Bits - level);
+    const UnsignedInt half = 1u << (Bits - level);
+    constexpr UnsignedInt childCount = 1 << T::Size;
+
+    /* Children are consecutive subranges of the parent range, each sharing
+       one more digit of the code prefix */
+    std::size_t begin = node.begin;
+    for(UnsignedInt i = 0; i != childCount; ++i) {
+        const std::uint64_t code = node.code + (std::uint64_t(i) << shift);
+        const std::size_t end = i + 1 == childCount ? node.end :
+            std::lower_bound(_codes.begin() + begin, _codes.begin() + node.end, code + (std::uint64_t(1) << shift)) - _codes.begin();
+        if(begin == end) continue;
+
+        CoordinatesType cell = node.cell;
+        for(std::size_t j = 0; j != T::Size; ++j)
+            if(i & (1 << j)) cell[j] += half;
+        function(Node{level, cell, code, begin, end});
+        begin = end;
+    }
+}
+
+template<class T> template<class Classify, class Test> void MortonTree<T>::query(const Node& node, const Classify& classify, const Test& test, std::vector<UnsignedInt>& out) const {
+    /* 0 means the node is fully outside, 2 fully inside */
+    const Int classification = classify(nodeBounds(node));
+    if(classification == 0) return;
+
+    if(classification == 2) {
+        out.insert(out.end(), _indices.begin() + node.begin, _indices.begin() + node.end);
+        return;
+    }
+
+    if(node.end - node.begin <= LeafSize || node.level == Bits) {
+        for(std::size_t i = node.begin; i != node.end; ++i)
+            if(test(_points[i])) out.push_back(_indices[i]);
+        return;
+    }
+
+    forEachChild(node, [this, &classify, &test, &out](const Node& child) {
+        query(child, classify, test, out);
+    });
+}
+
+template<class T> std::vector<UnsignedInt> MortonTree<T>::pointsInRange(const RangeType& range) const {
+    std::vector<UnsignedInt> out;
+    if(_codes.empty()) return out;
+
+    query(Node{0, {}, 0, 0, _codes.size()}, [&range](const RangeType& bounds) {
+        if((bounds.max() < range.min()).any() || (bounds.min() > range.max()).any())
+            return 0;
+        if((bounds.min() >= range.min()).all() && (bounds.max() <= range.max()).all())
+            return 2;
+        return 1;
+    }, [&range](const T& point) {
+        return (point >= range.min()).all() && (point <= range.max()).all();
+    }, out);
+    return out;
+}
+
+template<class T> std::vector<UnsignedInt> MortonTree<T>::pointsInRadius(const T& center, const Type radius) const {
+    std::vector<UnsignedInt> out;
+    if(_codes.empty()) return out;
+
+    const Type radiusSquared = radius*radius;
+    query(Node{0, {}, 0, 0, _codes.size()}, [&center, radiusSquared](const RangeType& bounds) {
+        if((center - Math::clamp(center, bounds.min(), bounds.max())).dot() > radiusSquared)
+            return 0;
+        if(Math::max(Math::abs(center - bounds.min()), Math::abs(center - bounds.max())).dot() <= radiusSquared)
+            return 2;
+        return 1;
+    }, [&center, radiusSquared](const T& point) {
+        return (point - center).dot() <= radiusSquared;
+    }, out);
+    return out;
+}
+
+template<class T> std::vector<UnsignedInt> MortonTree<T>::nearest(const T& point, const std::size_t count) const {
+    /* Max-heap of squared distances and original indices, the farthest of
+       the candidates is on top */
+    std::vector<std::pair<Type, UnsignedInt>> candidates;
+
+    if(count && !_codes.empty()) {
+        candidates.reserve(count);
+
+        /* Best-first traversal, nodes closest to the point are visited
+           first */
+        typedef std::pair<Type, Node> QueuedNode;
+        auto compare = [](const QueuedNode& a, const QueuedNode& b) {
+            return a.first > b.first;
+        };
+        std::priority_queue<QueuedNode, std::vector<QueuedNode>, decltype(compare)> queue{compare};
+        queue.push({Type(0), Node{0, {}, 0, 0, _codes.size()}});
+
+        while(!queue.empty()) {
+            const QueuedNode top = queue.top();
+            queue.pop();
+            if(candidates.size() == count && top.first > candidates.front().first)
+                break;
+
+            const Node& node = top.second;
+            if(node.end - node.begin <= LeafSize || node.level == Bits) {
+                for(std::size_t i = node.begin; i != node.end; ++i) {
+                    const std::pair<Type, UnsignedInt> candidate{(_points[i] - point).dot(), _indices[i]};
+                    if(candidates.size() < count) {
+                        candidates.push_back(candidate);
+                        std::push_heap(candidates.begin(), candidates.end());
+                    } else if(candidate < candidates.front()) {
+                        std::pop_heap(candidates.begin(), candidates.end());
+                        candidates.back() = candidate;
+                        std::push_heap(candidates.begin(), candidates.end());
+                    }
+                }
+                continue;
+            }
+
+            forEachChild(node, [this, &point, count, &candidates, &queue](const Node& child) {
+                const RangeType bounds = nodeBounds(child);
+                const Type distance = (point - Math::clamp(point, bounds.min(), bounds.max())).dot();
+                if(candidates.size() < count || distance <= candidates.front().first)
+                    queue.push({distance, child});
+            });
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    std::vector<UnsignedInt> out;
+    out.reserve(candidates.size());
+    for(const std::pair<Type, UnsignedInt>& candidate: candidates)
+        out.push_back(candidate.second);
+    return out;
+}
+
+}}}
+
+#endif
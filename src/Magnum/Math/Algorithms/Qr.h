@@ -29,6 +29,10 @@
  * @brief Function @ref Magnum::Math::Algorithms::qr()
  */
 
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Matrix.h"
 #include "Magnum/Math/Algorithms/GramSchmidt.h"
 
 namespace Magnum { namespace Math { namespace Algorithms {
@@ -72,6 +76,56 @@ template<std::size_t size, class T> std::pair<Matrix<size, T>, Matrix<size, T>>
     return {q, r};
 }
 
+/**
+@brief QR decomposition of a batch of matrices
+@param matrices     Matrices to decompose
+@param[out] q       Where to put the @f$ \boldsymbol{Q} @f$ matrices
+@param[out] r       Where to put the @f$ \boldsymbol{R} @f$ matrices
+
+Batch variant of @ref qr(const Matrix<size, T>&). Both @p q and @p r are
+expected to have the same size as @p matrices. The matrices are processed in
+blocks of eight, transposed to a structure-of-arrays layout first so the
+compiler can vectorize the Gram-Schmidt process over the whole block.
+*/
+template<std::size_t size, class T> void qr(const Corrade::Containers::StridedArrayView<const Matrix<size, T>>& matrices, const Corrade::Containers::StridedArrayView<Matrix<size, T>>& q, const Corrade::Containers::StridedArrayView<Matrix<size, T>>& r) {
+    CORRADE_ASSERT(q.size() == matrices.size() && r.size() == matrices.size(),
+        "Math::Algorithms::qr(): expected the outputs to have" << matrices.size() << "elements but got" << q.size() << "and" << r.size(), );
+
+    for(std::size_t offset = 0; offset < matrices.size(); offset += 8) {
+        const std::size_t count = Math::min(matrices.size() - offset, std::size_t(8));
+
+        /* Transpose the block, unused lanes are identity */
+        T a[size][size][8];
+        T e[size][size][8];
+        for(std::size_t col = 0; col != size; ++col)
+            for(std::size_t row = 0; row != size; ++row)
+                for(std::size_t l = 0; l != 8; ++l)
+                    e[col][row][l] = a[col][row][l] = l < count ? matrices[offset + l][col][row] : T(col == row);
+
+        Implementation::gramSchmidtOrthonormalizeBlock(e);
+
+        /* R is upper triangular with dot products of Q columns and input
+           columns */
+        T d[size][size][8]{};
+        for(std::size_t k = 0; k != size; ++k)
+            for(std::size_t j = 0; j <= k; ++j)
+                for(std::size_t row = 0; row != size; ++row)
+                    for(std::size_t l = 0; l != 8; ++l)
+                        d[k][j][l] += e[j][row][l]*a[k][row][l];
+
+        for(std::size_t l = 0; l != count; ++l) {
+            Matrix<size, T>& outQ = q[offset + l];
+            Matrix<size, T>& outR = r[offset + l];
+            for(std::size_t col = 0; col != size; ++col) {
+                for(std::size_t row = 0; row != size; ++row) {
+                    outQ[col][row] = e[col][row][l];
+                    outR[col][row] = d[col][row][l];
+                }
+            }
+        }
+    }
+}
+
 }}}
 
 #endif
@@ -30,6 +30,9 @@
  */
 
 #include <tuple>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
 
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix.h"
@@ -319,6 +322,141 @@ template<std::size_t cols, std::size_t rows, class T> std::tuple<RectangularMatr
     return std::make_tuple(m, q, v);
 }
 
+namespace Implementation {
+
+/* One-sided Jacobi (Hestenes) SVD of a block of eight matrices in a
+   structure-of-arrays layout. Unlike Golub-Reinsch used by the scalar svd(),
+   every sweep is a fixed sequence of plane rotations with no data-dependent
+   control flow besides per-lane selects, so it vectorizes well. On output
+   the columns of `a` are the columns of U scaled by the singular values and
+   `v` contains V. */
+template<std::size_t cols, std::size_t rows, class T> void svdBlock(T(&a)[cols][rows][8], T(&v)[cols][cols][8]) {
+    /* Enough for convergence in practice, Jacobi converges quadratically */
+    constexpr std::size_t MaxSweeps = 30;
+
+    for(std::size_t col = 0; col != cols; ++col)
+        for(std::size_t row = 0; row != cols; ++row)
+            for(std::size_t l = 0; l != 8; ++l)
+                v[col][row][l] = T(col == row);
+
+    for(std::size_t sweep = 0; sweep != MaxSweeps; ++sweep) {
+        bool rotated = false;
+
+        for(std::size_t p = 0; p != cols; ++p) {
+            for(std::size_t q = p + 1; q != cols; ++q) {
+                T alpha[8]{}, beta[8]{}, gamma[8]{};
+                for(std::size_t row = 0; row != rows; ++row) {
+                    for(std::size_t l = 0; l != 8; ++l) {
+                        alpha[l] += a[p][row][l]*a[p][row][l];
+                        beta[l] += a[q][row][l]*a[q][row][l];
+                        gamma[l] += a[p][row][l]*a[q][row][l];
+                    }
+                }
+
+                /* Lanes where the columns are already orthogonal get an
+                   identity rotation */
+                T c[8], s[8];
+                for(std::size_t l = 0; l != 8; ++l) {
+                    const bool rotate = std::abs(gamma[l]) > TypeTraits<T>::epsilon()*std::sqrt(alpha[l]*beta[l]);
+                    rotated = rotated || rotate;
+                    const T zeta = (beta[l] - alpha[l])/(T(2)*(rotate ? gamma[l] : T(1)));
+                    const T t = (zeta >= T(0) ? T(1) : T(-1))/(std::abs(zeta) + std::sqrt(T(1) + zeta*zeta));
+                    c[l] = rotate ? T(1)/std::sqrt(T(1) + t*t) : T(1);
+                    s[l] = rotate ? c[l]*t : T(0);
+                }
+
+                for(std::size_t row = 0; row != rows; ++row) {
+                    for(std::size_t l = 0; l != 8; ++l) {
+                        const T ap = a[p][row][l], aq = a[q][row][l];
+                        a[p][row][l] = c[l]*ap - s[l]*aq;
+                        a[q][row][l] = s[l]*ap + c[l]*aq;
+                    }
+                }
+                for(std::size_t row = 0; row != cols; ++row) {
+                    for(std::size_t l = 0; l != 8; ++l) {
+                        const T vp = v[p][row][l], vq = v[q][row][l];
+                        v[p][row][l] = c[l]*vp - s[l]*vq;
+                        v[q][row][l] = s[l]*vp + c[l]*vq;
+                    }
+                }
+            }
+        }
+
+        if(!rotated) break;
+    }
+}
+
+}
+
+/**
+@brief Singular Value Decomposition of a batch of matrices
+@param matrices     Matrices to decompose
+@param[out] u       Where to put first @p cols column vectors of
+    @f$ \boldsymbol{U} @f$
+@param[out] w       Where to put diagonals of @f$ \boldsymbol{\Sigma} @f$
+@param[out] v       Where to put non-transposed @f$ \boldsymbol{V} @f$
+
+Batch variant of @ref svd(RectangularMatrix<cols, rows, T>). All outputs are
+expected to have the same size as @p matrices. The matrices are processed in
+blocks of eight, transposed to a structure-of-arrays layout so the compiler
+can vectorize the whole block. Instead of the branchy Golub-Reinsch algorithm
+used by the scalar variant, this uses the one-sided Jacobi method, the
+factorization is thus equally valid, but the singular values are not
+guaranteed to be in the same order and the singular vectors can differ in
+sign. Singular vectors corresponding to zero singular values are set to zero.
+*/
+template<std::size_t cols, std::size_t rows, class T> void svd(const Corrade::Containers::StridedArrayView<const RectangularMatrix<cols, rows, T>>& matrices, const Corrade::Containers::StridedArrayView<RectangularMatrix<cols, rows, T>>& u, const Corrade::Containers::StridedArrayView<Vector<cols, T>>& w, const Corrade::Containers::StridedArrayView<Matrix<cols, T>>& v) {
+    static_assert(rows >= cols, "Unsupported matrix aspect ratio");
+    CORRADE_ASSERT(u.size() == matrices.size() && w.size() == matrices.size() && v.size() == matrices.size(),
+        "Math::Algorithms::svd(): expected the outputs to have" << matrices.size() << "elements but got" << u.size() << Corrade::Utility::Debug::nospace << "," << w.size() << "and" << v.size(), );
+
+    for(std::size_t offset = 0; offset < matrices.size(); offset += 8) {
+        const std::size_t count = Math::min(matrices.size() - offset, std::size_t(8));
+
+        /* Transpose the block, unused lanes are identity */
+        T a[cols][rows][8];
+        T vb[cols][cols][8];
+        for(std::size_t col = 0; col != cols; ++col)
+            for(std::size_t row = 0; row != rows; ++row)
+                for(std::size_t l = 0; l != 8; ++l)
+                    a[col][row][l] = l < count ? matrices[offset + l][col][row] : T(col == row);
+
+        Implementation::svdBlock(a, vb);
+
+        /* Singular values are lengths of the columns, U is the columns
+           normalized */
+        T wb[cols][8]{};
+        for(std::size_t col = 0; col != cols; ++col) {
+            for(std::size_t row = 0; row != rows; ++row)
+                for(std::size_t l = 0; l != 8; ++l)
+                    wb[col][l] += a[col][row][l]*a[col][row][l];
+
+            T inv[8];
+            for(std::size_t l = 0; l != 8; ++l) {
+                wb[col][l] = std::sqrt(wb[col][l]);
+                inv[l] = wb[col][l] > T(0) ? T(1)/wb[col][l] : T(0);
+            }
+
+            for(std::size_t row = 0; row != rows; ++row)
+                for(std::size_t l = 0; l != 8; ++l)
+                    a[col][row][l] *= inv[l];
+        }
+
+        for(std::size_t l = 0; l != count; ++l) {
+            RectangularMatrix<cols, rows, T>& outU = u[offset + l];
+            Vector<cols, T>& outW = w[offset + l];
+            Matrix<cols, T>& outV = v[offset + l];
+            for(std::size_t col = 0; col != cols; ++col) {
+                outW[col] = wb[col][l];
+                for(std::size_t row = 0; row != rows; ++row)
+                    outU[col][row] = a[col][row][l];
+                for(std::size_t row = 0; row != cols; ++row)
+                    outV[col][row] = vb[col][row][l];
+            }
+        }
+    }
+}
+
 }}}
 
 #endif
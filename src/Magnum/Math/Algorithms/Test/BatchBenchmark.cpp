@@ -0,0 +1,176 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <tuple>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Algorithms/GaussJordan.h"
+#include "Magnum/Math/Algorithms/GramSchmidt.h"
+#include "Magnum/Math/Algorithms/Qr.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+typedef Math::Matrix<3, Float> Matrix3x3;
+typedef Math::Matrix<4, Float> Matrix4x4;
+typedef Math::Vector<3, Float> Vector3;
+
+struct BatchBenchmark: Corrade::TestSuite::Tester {
+    explicit BatchBenchmark();
+
+    void gaussJordanInverted();
+    void gaussJordanInvertedBatch();
+
+    void gramSchmidtOrthonormalize();
+    void gramSchmidtOrthonormalizeBatch();
+
+    void qr();
+    void qrBatch();
+
+    void svd();
+    void svdBatch();
+
+    std::vector<Matrix3x3> _matrices3;
+    std::vector<Matrix4x4> _matrices4;
+    std::vector<Matrix3x3> _out3a, _out3b;
+    std::vector<Matrix4x4> _out4;
+    std::vector<Vector3> _outVector3;
+};
+
+BatchBenchmark::BatchBenchmark() {
+    addBenchmarks({&BatchBenchmark::gaussJordanInverted,
+                   &BatchBenchmark::gaussJordanInvertedBatch,
+
+                   &BatchBenchmark::gramSchmidtOrthonormalize,
+                   &BatchBenchmark::gramSchmidtOrthonormalizeBatch,
+
+                   &BatchBenchmark::qr,
+                   &BatchBenchmark::qrBatch,
+
+                   &BatchBenchmark::svd,
+                   &BatchBenchmark::svdBatch}, 10);
+
+    /* Generate random data for the benchmarks. Diagonally dominant so all
+       matrices are invertible. */
+    std::random_device rnd;
+    std::mt19937 g(rnd());
+    std::uniform_real_distribution<float> d(-1.0f, 1.0f);
+
+    _matrices3.reserve(512);
+    _matrices4.reserve(512);
+    for(int i = 0; i < 512; ++i) {
+        Matrix3x3 a{Math::IdentityInit, 4.0f};
+        for(std::size_t col = 0; col != 3; ++col)
+            for(std::size_t row = 0; row != 3; ++row)
+                a[col][row] += d(g);
+        _matrices3.push_back(a);
+
+        Matrix4x4 b{Math::IdentityInit, 4.0f};
+        for(std::size_t col = 0; col != 4; ++col)
+            for(std::size_t row = 0; row != 4; ++row)
+                b[col][row] += d(g);
+        _matrices4.push_back(b);
+    }
+
+    _out3a.resize(512);
+    _out3b.resize(512);
+    _out4.resize(512);
+    _outVector3.resize(512);
+}
+
+void BatchBenchmark::gaussJordanInverted() {
+    volatile Float b = 0.0f;
+    CORRADE_BENCHMARK(50) {
+        for(std::size_t i = 0; i != _matrices4.size(); ++i)
+            _out4[i] = Algorithms::gaussJordanInverted(_matrices4[i]);
+        b = b + _out4[0][0][0];
+    }
+}
+
+void BatchBenchmark::gaussJordanInvertedBatch() {
+    volatile Float b = 0.0f;
+    CORRADE_BENCHMARK(50) {
+        Algorithms::gaussJordanInverted<4, Float>({_matrices4.data(), _matrices4.size(), sizeof(Matrix4x4)}, {_out4.data(), _out4.size(), sizeof(Matrix4x4)});
+        b = b + _out4[0][0][0];
+    }
+}
+
+void BatchBenchmark::gramSchmidtOrthonormalize() {
+    volatile Float b = 0.0f;
+    CORRADE_BENCHMARK(50) {
+        for(std::size_t i = 0; i != _matrices3.size(); ++i)
+            _out3a[i] = Algorithms::gramSchmidtOrthonormalize(_matrices3[i]);
+        b = b + _out3a[0][0][0];
+    }
+}
+
+void BatchBenchmark::gramSchmidtOrthonormalizeBatch() {
+    volatile Float b = 0.0f;
+    CORRADE_BENCHMARK(50) {
+        _out3a = _matrices3;
+        Algorithms::gramSchmidtOrthonormalizeInPlace<3, 3, Float>({_out3a.data(), _out3a.size(), sizeof(Matrix3x3)});
+        b = b + _out3a[0][0][0];
+    }
+}
+
+void BatchBenchmark::qr() {
+    volatile Float b = 0.0f;
+    CORRADE_BENCHMARK(50) {
+        for(std::size_t i = 0; i != _matrices3.size(); ++i)
+            std::tie(_out3a[i], _out3b[i]) = Algorithms::qr(_matrices3[i]);
+        b = b + _out3b[0][0][0];
+    }
+}
+
+void BatchBenchmark::qrBatch() {
+    volatile Float b = 0.0f;
+    CORRADE_BENCHMARK(50) {
+        Algorithms::qr<3, Float>({_matrices3.data(), _matrices3.size(), sizeof(Matrix3x3)}, {_out3a.data(), _out3a.size(), sizeof(Matrix3x3)}, {_out3b.data(), _out3b.size(), sizeof(Matrix3x3)});
+        b = b + _out3b[0][0][0];
+    }
+}
+
+void BatchBenchmark::svd() {
+    volatile Float b = 0.0f;
+    CORRADE_BENCHMARK(50) {
+        for(std::size_t i = 0; i != _matrices3.size(); ++i)
+            std::tie(_out3a[i], _outVector3[i], _out3b[i]) = Algorithms::svd(RectangularMatrix<3, 3, Float>{_matrices3[i]});
+        b = b + _outVector3[0][0];
+    }
+}
+
+void BatchBenchmark::svdBatch() {
+    volatile Float b = 0.0f;
+    CORRADE_BENCHMARK(50) {
+        Algorithms::svd<3, 3, Float>({_matrices3.data(), _matrices3.size(), sizeof(Matrix3x3)}, {_out3a.data(), _out3a.size(), sizeof(Matrix3x3)}, {_outVector3.data(), _outVector3.size(), sizeof(Vector3)}, {_out3b.data(), _out3b.size(), sizeof(Matrix3x3)});
+        b = b + _outVector3[0][0];
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::BatchBenchmark)
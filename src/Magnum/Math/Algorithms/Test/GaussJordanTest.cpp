@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Algorithms/GaussJordan.h"
@@ -35,6 +36,9 @@ struct GaussJordanTest: Corrade::TestSuite::Tester {
     void test();
     void singular();
     void inverted();
+    void invertedBatch();
+    void invertedBatchSingular();
+    void invertedBatchWrongSize();
 };
 
 typedef Matrix<4, Float> Matrix4x4;
@@ -43,7 +47,10 @@ typedef Vector<4, Float> Vector4;
 GaussJordanTest::GaussJordanTest() {
     addTests({&GaussJordanTest::test,
               &GaussJordanTest::singular,
-              &GaussJordanTest::inverted});
+              &GaussJordanTest::inverted,
+              &GaussJordanTest::invertedBatch,
+              &GaussJordanTest::invertedBatchSingular,
+              &GaussJordanTest::invertedBatchWrongSize});
 }
 
 void GaussJordanTest::test() {
@@ -92,6 +99,57 @@ void GaussJordanTest::inverted() {
     CORRADE_COMPARE(inverse*m, Matrix4x4{});
 }
 
+void GaussJordanTest::invertedBatch() {
+    const Matrix4x4 m{Vector4{3.0f,  5.0f, 8.0f, 4.0f},
+                      Vector4{4.0f,  4.0f, 7.0f, 3.0f},
+                      Vector4{7.0f, -1.0f, 8.0f, 0.0f},
+                      Vector4{9.0f,  4.0f, 5.0f, 9.0f}};
+
+    /* More than one block, with a partially filled last one and different
+       pivots in each lane */
+    Matrix4x4 matrices[11];
+    for(std::size_t i = 0; i != 11; ++i) {
+        matrices[i] = m;
+        matrices[i][i % 4][(i + 1) % 4] += Float(i);
+    }
+
+    Matrix4x4 inverted[11];
+    CORRADE_VERIFY((gaussJordanInverted<4, Float>(matrices, inverted)));
+    for(std::size_t i = 0; i != 11; ++i) {
+        CORRADE_COMPARE(inverted[i], gaussJordanInverted(matrices[i]));
+    }
+}
+
+void GaussJordanTest::invertedBatchSingular() {
+    const Matrix4x4 m{Vector4{3.0f,  5.0f, 8.0f, 4.0f},
+                      Vector4{4.0f,  4.0f, 7.0f, 3.0f},
+                      Vector4{7.0f, -1.0f, 8.0f, 0.0f},
+                      Vector4{9.0f,  4.0f, 5.0f, 9.0f}};
+    const Matrix4x4 singular{Vector4{1.0f, 2.0f,  3.0f,  4.0f},
+                             Vector4{2.0f, 3.0f, -7.0f, 11.0f},
+                             Vector4{2.0f, 4.0f,  6.0f,  8.0f},
+                             Vector4{1.0f, 2.0f,  7.0f, 40.0f}};
+
+    Matrix4x4 matrices[]{m, m, singular, m};
+    Matrix4x4 inverted[4];
+    CORRADE_VERIFY(!(gaussJordanInverted<4, Float>(matrices, inverted)));
+
+    /* The regular matrices are not affected */
+    CORRADE_COMPARE(inverted[0], gaussJordanInverted(m));
+    CORRADE_COMPARE(inverted[1], gaussJordanInverted(m));
+    CORRADE_COMPARE(inverted[3], gaussJordanInverted(m));
+}
+
+void GaussJordanTest::invertedBatchWrongSize() {
+    Matrix4x4 matrices[3];
+    Matrix4x4 inverted[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    gaussJordanInverted<4, Float>(matrices, inverted);
+    CORRADE_COMPARE(out.str(), "Math::Algorithms::gaussJordanInverted(): expected the output to have 3 elements but got 2\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::GaussJordanTest)
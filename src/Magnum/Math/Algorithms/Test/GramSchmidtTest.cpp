@@ -34,6 +34,7 @@ struct GramSchmidtTest: Corrade::TestSuite::Tester {
 
     void orthogonalize();
     void orthonormalize();
+    void orthonormalizeBatch();
 };
 
 typedef RectangularMatrix<3, 3, Float> Matrix3x3;
@@ -41,7 +42,8 @@ typedef Vector<3, Float> Vector3;
 
 GramSchmidtTest::GramSchmidtTest() {
     addTests({&GramSchmidtTest::orthogonalize,
-              &GramSchmidtTest::orthonormalize});
+              &GramSchmidtTest::orthonormalize,
+              &GramSchmidtTest::orthonormalizeBatch});
 }
 
 void GramSchmidtTest::orthogonalize() {
@@ -95,6 +97,29 @@ void GramSchmidtTest::orthonormalize() {
     CORRADE_COMPARE(orthonormalized, expected);
 }
 
+void GramSchmidtTest::orthonormalizeBatch() {
+    const Matrix3x3 m(Vector3(3.0f,  5.0f, 8.0f),
+                      Vector3(4.0f,  4.0f, 7.0f),
+                      Vector3(7.0f, -1.0f, 8.0f));
+
+    /* More than one block, with a partially filled last one */
+    Matrix3x3 matrices[10];
+    for(std::size_t i = 0; i != 10; ++i) {
+        matrices[i] = m;
+        matrices[i][i % 3] *= Float(i + 1);
+        matrices[i][(i + 1) % 3][i % 3] -= Float(i);
+    }
+
+    Matrix3x3 expected[10];
+    for(std::size_t i = 0; i != 10; ++i)
+        expected[i] = Algorithms::gramSchmidtOrthonormalize(matrices[i]);
+
+    Algorithms::gramSchmidtOrthonormalizeInPlace<3, 3, Float>(matrices);
+    for(std::size_t i = 0; i != 10; ++i) {
+        CORRADE_COMPARE(matrices[i], expected[i]);
+    }
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::GramSchmidtTest)
@@ -24,6 +24,7 @@
 */
 
 #include <numeric>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Magnum.h"
@@ -37,19 +38,31 @@ struct KahanSumTest: TestSuite::Tester {
     void floats();
     void integers();
     void iterative();
+    void strided();
+    void stridedNeumaier();
+    void stridedIntegers();
+    void stridedMultithreaded();
+    void stridedEmpty();
 
     void accumulate100k();
     void kahan100k();
+    void kahanStrided100k();
 
 };
 
 KahanSumTest::KahanSumTest() {
     addTests({&KahanSumTest::floats,
               &KahanSumTest::integers,
-              &KahanSumTest::iterative});
+              &KahanSumTest::iterative,
+              &KahanSumTest::strided,
+              &KahanSumTest::stridedNeumaier,
+              &KahanSumTest::stridedIntegers,
+              &KahanSumTest::stridedMultithreaded,
+              &KahanSumTest::stridedEmpty});
 
     addBenchmarks({&KahanSumTest::accumulate100k,
-                   &KahanSumTest::kahan100k}, 50);
+                   &KahanSumTest::kahan100k,
+                   &KahanSumTest::kahanStrided100k}, 50);
 }
 
 namespace {
@@ -143,6 +156,63 @@ void KahanSumTest::iterative() {
     }
 }
 
+void KahanSumTest::strided() {
+    /* Every second value is a garbage one that should be skipped */
+    std::vector<Float> data(2*1000000, 1.0e8f);
+    for(std::size_t i = 0; i < data.size(); i += 2) data[i] = 0.1f;
+
+    const Containers::StridedArrayView<const Float> view{data.data(), data.size()/2, 2*sizeof(Float)};
+    CORRADE_COMPARE(kahanSum(view), 100000.0f);
+
+    Float sum{};
+    for(std::size_t i = 0; i != view.size(); ++i) sum += view[i];
+    CORRADE_VERIFY(sum != 100000.0f);
+}
+
+void KahanSumTest::stridedNeumaier() {
+    /* Plain Kahan summation returns 0 for this, as the compensation gets lost
+       when adding a value larger than the running sum */
+    const Float data[]{1.0f, 1.0e30f, 1.0f, -1.0e30f};
+    CORRADE_COMPARE(kahanSum(Containers::StridedArrayView<const Float>{data, 4, sizeof(Float)}), 2.0f);
+
+    /* Same with each value going to the same lane */
+    std::vector<Float> spread(32);
+    spread[0] = 1.0f;
+    spread[8] = 1.0e30f;
+    spread[16] = 1.0f;
+    spread[24] = -1.0e30f;
+    CORRADE_COMPARE(kahanSum(Containers::StridedArrayView<const Float>{spread.data(), spread.size(), sizeof(Float)}), 2.0f);
+}
+
+void KahanSumTest::stridedIntegers() {
+    std::vector<Int> data(100001, 3);
+    data[0] = -3;
+    CORRADE_COMPARE(kahanSum(Containers::StridedArrayView<const Int>{data.data(), data.size(), sizeof(Int)}), 299997);
+}
+
+void KahanSumTest::stridedMultithreaded() {
+    std::vector<Float> data(1000003);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = 0.1f + (i % 7)*0.3f;
+
+    Double expected{};
+    for(Float i: data) expected += i;
+
+    const Containers::StridedArrayView<const Float> view{data.data(), data.size(), sizeof(Float)};
+    const Float single = kahanSum(view);
+    CORRADE_COMPARE(single, Float(expected));
+
+    /* The chunking doesn't depend on thread count, so the result is bit-exact
+       for any thread count */
+    CORRADE_VERIFY(kahanSum(view, 3) == single);
+    CORRADE_VERIFY(kahanSum(view, 8) == single);
+}
+
+void KahanSumTest::stridedEmpty() {
+    CORRADE_COMPARE(kahanSum(Containers::StridedArrayView<const Float>{}), 0.0f);
+    CORRADE_COMPARE(kahanSum(Containers::StridedArrayView<const Float>{}, 4), 0.0f);
+}
+
 void KahanSumTest::accumulate100k() {
     std::vector<Float> data(100000, 1.0f);
 
@@ -165,6 +235,17 @@ void KahanSumTest::kahan100k() {
     CORRADE_COMPARE(Float(a), 100000.0f);
 }
 
+void KahanSumTest::kahanStrided100k() {
+    std::vector<Float> data(100000, 1.0f);
+
+    volatile Float a; /* to avoid optimizing the loop out */
+    CORRADE_BENCHMARK(10) {
+        a = kahanSum(Containers::StridedArrayView<const Float>{data.data(), data.size(), sizeof(Float)});
+    }
+
+    CORRADE_COMPARE(Float(a), 100000.0f);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::KahanSumTest)
@@ -0,0 +1,220 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Algorithms/KdTree.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct KdTreeTest: Corrade::TestSuite::Tester {
+    explicit KdTreeTest();
+
+    void empty();
+    void range();
+    void radius();
+    void nearest();
+    void nearestMoreThanSize();
+    void duplicates();
+    void strided();
+    void multithreaded();
+};
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Range3D<Float> Range3D;
+
+KdTreeTest::KdTreeTest() {
+    addTests({&KdTreeTest::empty,
+              &KdTreeTest::range,
+              &KdTreeTest::radius,
+              &KdTreeTest::nearest,
+              &KdTreeTest::nearestMoreThanSize,
+              &KdTreeTest::duplicates,
+              &KdTreeTest::strided,
+              &KdTreeTest::multithreaded});
+}
+
+namespace {
+
+/* Deterministic pseudo-random points in the [-1, 1] cube, clustered a bit
+   around the origin so the tree isn't uniform */
+std::vector<Vector3> points(const std::size_t count) {
+    std::vector<Vector3> out;
+    out.reserve(count);
+    UnsignedInt state = 1234567;
+    auto random = [&state]() {
+        state = state*1664525u + 1013904223u;
+        return Float(state >> 8)/Float(1 << 24)*2.0f - 1.0f;
+    };
+    for(std::size_t i = 0; i != count; ++i) {
+        const Vector3 point{random(), random(), random()};
+        out.push_back(i % 3 ? point : point*0.1f);
+    }
+    return out;
+}
+
+std::vector<UnsignedInt> sorted(std::vector<UnsignedInt> indices) {
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+std::vector<UnsignedInt> bruteForceRange(const std::vector<Vector3>& points, const Range3D& range) {
+    std::vector<UnsignedInt> out;
+    for(std::size_t i = 0; i != points.size(); ++i)
+        if((points[i] >= range.min()).all() && (points[i] <= range.max()).all())
+            out.push_back(i);
+    return out;
+}
+
+std::vector<UnsignedInt> bruteForceRadius(const std::vector<Vector3>& points, const Vector3& center, Float radius) {
+    std::vector<UnsignedInt> out;
+    for(std::size_t i = 0; i != points.size(); ++i)
+        if((points[i] - center).dot() <= radius*radius)
+            out.push_back(i);
+    return out;
+}
+
+std::vector<UnsignedInt> bruteForceNearest(const std::vector<Vector3>& points, const Vector3& point, std::size_t count) {
+    std::vector<std::pair<Float, UnsignedInt>> distances;
+    for(std::size_t i = 0; i != points.size(); ++i)
+        distances.push_back({(points[i] - point).dot(), UnsignedInt(i)});
+    std::sort(distances.begin(), distances.end());
+
+    std::vector<UnsignedInt> out;
+    for(std::size_t i = 0; i != std::min(count, distances.size()); ++i)
+        out.push_back(distances[i].second);
+    return out;
+}
+
+Corrade::Containers::StridedArrayView<const Vector3> view(const std::vector<Vector3>& points) {
+    return {points.data(), points.size(), sizeof(Vector3)};
+}
+
+}
+
+void KdTreeTest::empty() {
+    KdTree<Vector3> tree{Corrade::Containers::StridedArrayView<const Vector3>{}};
+    CORRADE_COMPARE(tree.size(), 0);
+    CORRADE_VERIFY(tree.pointsInRange({Vector3{-1.0f}, Vector3{1.0f}}).empty());
+    CORRADE_VERIFY(tree.pointsInRadius({}, 1.0f).empty());
+    CORRADE_VERIFY(tree.nearest({}, 3).empty());
+}
+
+void KdTreeTest::range() {
+    const std::vector<Vector3> data = points(5000);
+    KdTree<Vector3> tree{view(data)};
+    CORRADE_COMPARE(tree.size(), 5000);
+
+    for(const Range3D& range: {
+        Range3D{{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}},
+        Range3D{{-0.05f, -0.02f, -0.1f}, {0.01f, 0.1f, 0.03f}},
+        Range3D{{0.9f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}},
+        Range3D{{2.0f, 2.0f, 2.0f}, {3.0f, 3.0f, 3.0f}}
+    }) {
+        CORRADE_COMPARE(sorted(tree.pointsInRange(range)), bruteForceRange(data, range));
+    }
+
+    /* Boundary is inclusive */
+    CORRADE_COMPARE(tree.pointsInRange({data[17], data[17]}), std::vector<UnsignedInt>{17});
+}
+
+void KdTreeTest::radius() {
+    const std::vector<Vector3> data = points(5000);
+    KdTree<Vector3> tree{view(data)};
+
+    CORRADE_COMPARE(sorted(tree.pointsInRadius({}, 0.05f)), bruteForceRadius(data, {}, 0.05f));
+    CORRADE_COMPARE(sorted(tree.pointsInRadius(data[42], 0.3f)), bruteForceRadius(data, data[42], 0.3f));
+    CORRADE_COMPARE(sorted(tree.pointsInRadius({1.0f, 1.0f, 1.0f}, 0.5f)), bruteForceRadius(data, {1.0f, 1.0f, 1.0f}, 0.5f));
+    CORRADE_COMPARE(tree.pointsInRadius(data[17], 0.0f), std::vector<UnsignedInt>{17});
+}
+
+void KdTreeTest::nearest() {
+    const std::vector<Vector3> data = points(5000);
+    KdTree<Vector3> tree{view(data)};
+
+    CORRADE_COMPARE(tree.nearest({}, 1), bruteForceNearest(data, {}, 1));
+    CORRADE_COMPARE(tree.nearest({}, 16), bruteForceNearest(data, {}, 16));
+    CORRADE_COMPARE(tree.nearest(data[42], 5), bruteForceNearest(data, data[42], 5));
+    CORRADE_COMPARE(tree.nearest({3.0f, -2.0f, 0.5f}, 100), bruteForceNearest(data, {3.0f, -2.0f, 0.5f}, 100));
+    CORRADE_VERIFY(tree.nearest({}, 0).empty());
+
+    /* The point itself is the closest */
+    CORRADE_COMPARE(tree.nearest(data[42], 1), std::vector<UnsignedInt>{42});
+}
+
+void KdTreeTest::nearestMoreThanSize() {
+    const std::vector<Vector3> data = points(20);
+    KdTree<Vector3> tree{view(data)};
+
+    CORRADE_COMPARE(tree.nearest({}, 50), bruteForceNearest(data, {}, 50));
+    CORRADE_COMPARE(tree.nearest({}, 50).size(), 20);
+}
+
+void KdTreeTest::duplicates() {
+    /* A lot of points on the same position shouldn't cause any issues, ties
+       in nearest() are sorted by index */
+    std::vector<Vector3> data = points(100);
+    data.insert(data.end(), 200, Vector3{0.25f});
+    KdTree<Vector3> tree{view(data)};
+
+    CORRADE_COMPARE(sorted(tree.pointsInRadius(Vector3{0.25f}, 0.0f)), bruteForceRadius(data, Vector3{0.25f}, 0.0f));
+    CORRADE_COMPARE(tree.nearest(Vector3{0.25f}, 10), bruteForceNearest(data, Vector3{0.25f}, 10));
+    CORRADE_COMPARE(tree.nearest(Vector3{0.25f}, 10).front(), 100);
+}
+
+void KdTreeTest::strided() {
+    struct Vertex {
+        Vector3 position;
+        UnsignedInt id;
+    };
+    const std::vector<Vector3> data = points(300);
+    std::vector<Vertex> vertices;
+    for(std::size_t i = 0; i != data.size(); ++i)
+        vertices.push_back({data[i], UnsignedInt(i)});
+
+    KdTree<Vector3> tree{{&vertices[0].position, vertices.size(), sizeof(Vertex)}};
+    CORRADE_COMPARE(tree.size(), 300);
+    CORRADE_COMPARE(tree.nearest({}, 8), bruteForceNearest(data, {}, 8));
+}
+
+void KdTreeTest::multithreaded() {
+    const std::vector<Vector3> data = points(20000);
+    KdTree<Vector3> single{view(data)};
+    KdTree<Vector3> multi{view(data), 4};
+
+    /* The tree is built the same regardless of thread count, so even the
+       order of range query results should match */
+    const Range3D range{{-0.3f, -0.2f, -0.5f}, {0.4f, 0.1f, 0.2f}};
+    CORRADE_COMPARE(multi.pointsInRange(range), single.pointsInRange(range));
+    CORRADE_COMPARE(sorted(multi.pointsInRange(range)), bruteForceRange(data, range));
+    CORRADE_COMPARE(multi.nearest(data[1000], 12), bruteForceNearest(data, data[1000], 12));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::KdTreeTest)
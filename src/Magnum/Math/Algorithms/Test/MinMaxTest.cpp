@@ -0,0 +1,152 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Algorithms/MinMax.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct MinMaxTest: Corrade::TestSuite::Tester {
+    explicit MinMaxTest();
+
+    void scalar();
+    void vector();
+    void strided();
+    void multithreaded();
+    void empty();
+
+    void minmaxNaive1M();
+    void minmax1M();
+};
+
+typedef Math::Vector3<Float> Vector3;
+
+MinMaxTest::MinMaxTest() {
+    addTests({&MinMaxTest::scalar,
+              &MinMaxTest::vector,
+              &MinMaxTest::strided,
+              &MinMaxTest::multithreaded,
+              &MinMaxTest::empty});
+
+    addBenchmarks({&MinMaxTest::minmaxNaive1M,
+                   &MinMaxTest::minmax1M}, 50);
+}
+
+void MinMaxTest::scalar() {
+    /* More than one block of lanes, with the extremes in the remainder */
+    const Float data[]{5.0f, 3.0f, 2.0f, 7.0f, 4.0f, 6.0f, 1.5f, 3.5f,
+                       2.5f, 6.5f, -1.0f, 8.0f};
+    const Containers::StridedArrayView<const Float> view{data, 12, sizeof(Float)};
+
+    CORRADE_COMPARE(min(view), -1.0f);
+    CORRADE_COMPARE(max(view), 8.0f);
+    CORRADE_COMPARE(minmax(view), std::make_pair(-1.0f, 8.0f));
+
+    /* Should give the same results as the ArrayView variants */
+    CORRADE_COMPARE(min(view), Math::min(data));
+    CORRADE_COMPARE(max(view), Math::max(data));
+    CORRADE_COMPARE(minmax(view), Math::minmax(data));
+}
+
+void MinMaxTest::vector() {
+    const Vector3 data[]{
+        {1.0f, -2.0f, 3.0f},
+        {-4.0f, 5.0f, 0.5f},
+        {2.0f, 1.0f, -6.0f}
+    };
+    const Containers::StridedArrayView<const Vector3> view{data, 3, sizeof(Vector3)};
+
+    CORRADE_COMPARE(min(view), (Vector3{-4.0f, -2.0f, -6.0f}));
+    CORRADE_COMPARE(max(view), (Vector3{2.0f, 5.0f, 3.0f}));
+    CORRADE_COMPARE(minmax(view), std::make_pair(Vector3{-4.0f, -2.0f, -6.0f}, Vector3{2.0f, 5.0f, 3.0f}));
+}
+
+void MinMaxTest::strided() {
+    /* Only the X coordinates */
+    const Vector3 data[]{
+        {1.0f, -20.0f, 30.0f},
+        {-4.0f, 50.0f, 0.5f},
+        {2.0f, 10.0f, -60.0f}
+    };
+    const Containers::StridedArrayView<const Float> view{data[0].data(), 3, sizeof(Vector3)};
+
+    CORRADE_COMPARE(min(view), -4.0f);
+    CORRADE_COMPARE(max(view), 2.0f);
+    CORRADE_COMPARE(minmax(view), std::make_pair(-4.0f, 2.0f));
+}
+
+void MinMaxTest::multithreaded() {
+    /* Spanning multiple chunks, extremes in the middle and in the last one */
+    std::vector<Float> data(1000003);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Float(i % 1000);
+    data[345678] = -5.0f;
+    data[1000001] = 2000.0f;
+
+    const Containers::StridedArrayView<const Float> view{data.data(), data.size(), sizeof(Float)};
+    CORRADE_COMPARE(min(view), -5.0f);
+    CORRADE_COMPARE(max(view), 2000.0f);
+    CORRADE_COMPARE(minmax(view), std::make_pair(-5.0f, 2000.0f));
+    CORRADE_COMPARE(min(view, 4), -5.0f);
+    CORRADE_COMPARE(max(view, 4), 2000.0f);
+    CORRADE_COMPARE(minmax(view, 4), std::make_pair(-5.0f, 2000.0f));
+}
+
+void MinMaxTest::empty() {
+    CORRADE_COMPARE(min(Containers::StridedArrayView<const Float>{}), 0.0f);
+    CORRADE_COMPARE(max(Containers::StridedArrayView<const Float>{}, 4), 0.0f);
+    CORRADE_COMPARE(minmax(Containers::StridedArrayView<const Vector3>{}), std::make_pair(Vector3{}, Vector3{}));
+}
+
+void MinMaxTest::minmaxNaive1M() {
+    std::vector<Float> data(1000000);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Float(i % 1337);
+
+    std::pair<Float, Float> out;
+    CORRADE_BENCHMARK(5)
+        out = Math::minmax(Containers::ArrayView<const Float>{data.data(), data.size()});
+
+    CORRADE_COMPARE(out, std::make_pair(0.0f, 1336.0f));
+}
+
+void MinMaxTest::minmax1M() {
+    std::vector<Float> data(1000000);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Float(i % 1337);
+
+    std::pair<Float, Float> out;
+    CORRADE_BENCHMARK(5)
+        out = minmax(Containers::StridedArrayView<const Float>{data.data(), data.size(), sizeof(Float)});
+
+    CORRADE_COMPARE(out, std::make_pair(0.0f, 1336.0f));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::MinMaxTest)
@@ -0,0 +1,271 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Algorithms/MortonTree.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct MortonTreeTest: Corrade::TestSuite::Tester {
+    explicit MortonTreeTest();
+
+    void mortonCode2D();
+    void mortonCode3D();
+
+    void empty();
+    void construct();
+    void range();
+    void radius();
+    void nearest();
+    void duplicates();
+    void flat();
+    void quadtree();
+    void multithreaded();
+};
+
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector2<UnsignedInt> Vector2ui;
+typedef Math::Vector3<UnsignedInt> Vector3ui;
+typedef Math::Range2D<Float> Range2D;
+typedef Math::Range3D<Float> Range3D;
+
+MortonTreeTest::MortonTreeTest() {
+    addTests({&MortonTreeTest::mortonCode2D,
+              &MortonTreeTest::mortonCode3D,
+
+              &MortonTreeTest::empty,
+              &MortonTreeTest::construct,
+              &MortonTreeTest::range,
+              &MortonTreeTest::radius,
+              &MortonTreeTest::nearest,
+              &MortonTreeTest::duplicates,
+              &MortonTreeTest::flat,
+              &MortonTreeTest::quadtree,
+              &MortonTreeTest::multithreaded});
+}
+
+namespace {
+
+/* Deterministic pseudo-random points in the [-1, 1] cube, clustered a bit
+   around the origin so the tree isn't uniform */
+template<class T> std::vector<T> points(const std::size_t count) {
+    std::vector<T> out;
+    out.reserve(count);
+    UnsignedInt state = 1234567;
+    for(std::size_t i = 0; i != count; ++i) {
+        T point;
+        for(std::size_t j = 0; j != T::Size; ++j) {
+            state = state*1664525u + 1013904223u;
+            point[j] = Float(state >> 8)/Float(1 << 24)*2.0f - 1.0f;
+        }
+        out.push_back(i % 3 ? point : point*0.1f);
+    }
+    return out;
+}
+
+std::vector<UnsignedInt> sorted(std::vector<UnsignedInt> indices) {
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+template<class T> std::vector<UnsignedInt> bruteForceRange(const std::vector<T>& points, const Range<T::Size, Float>& range) {
+    std::vector<UnsignedInt> out;
+    for(std::size_t i = 0; i != points.size(); ++i)
+        if((points[i] >= range.min()).all() && (points[i] <= range.max()).all())
+            out.push_back(i);
+    return out;
+}
+
+template<class T> std::vector<UnsignedInt> bruteForceRadius(const std::vector<T>& points, const T& center, Float radius) {
+    std::vector<UnsignedInt> out;
+    for(std::size_t i = 0; i != points.size(); ++i)
+        if((points[i] - center).dot() <= radius*radius)
+            out.push_back(i);
+    return out;
+}
+
+template<class T> std::vector<UnsignedInt> bruteForceNearest(const std::vector<T>& points, const T& point, std::size_t count) {
+    std::vector<std::pair<Float, UnsignedInt>> distances;
+    for(std::size_t i = 0; i != points.size(); ++i)
+        distances.push_back({(points[i] - point).dot(), UnsignedInt(i)});
+    std::sort(distances.begin(), distances.end());
+
+    std::vector<UnsignedInt> out;
+    for(std::size_t i = 0; i != std::min(count, distances.size()); ++i)
+        out.push_back(distances[i].second);
+    return out;
+}
+
+template<class T> Corrade::Containers::StridedArrayView<const T> view(const std::vector<T>& points) {
+    return {points.data(), points.size(), sizeof(T)};
+}
+
+}
+
+void MortonTreeTest::mortonCode2D() {
+    CORRADE_COMPARE(MortonQuadtree<Float>::mortonCode({1, 0}), 1);
+    CORRADE_COMPARE(MortonQuadtree<Float>::mortonCode({0, 1}), 2);
+    CORRADE_COMPARE(MortonQuadtree<Float>::mortonCode({3, 1}), 7);
+    CORRADE_COMPARE(MortonQuadtree<Float>::mortonCode({4, 0}), 16);
+    CORRADE_COMPARE(MortonQuadtree<Float>::mortonCode(Vector2ui{0x1fffff}), 0x3ffffffffffull);
+}
+
+void MortonTreeTest::mortonCode3D() {
+    CORRADE_COMPARE(MortonOctree<Float>::mortonCode({1, 0, 0}), 1);
+    CORRADE_COMPARE(MortonOctree<Float>::mortonCode({0, 1, 0}), 2);
+    CORRADE_COMPARE(MortonOctree<Float>::mortonCode({0, 0, 1}), 4);
+    CORRADE_COMPARE(MortonOctree<Float>::mortonCode({3, 0, 0}), 9);
+    CORRADE_COMPARE(MortonOctree<Float>::mortonCode({0, 2, 1}), 20);
+    CORRADE_COMPARE(MortonOctree<Float>::mortonCode(Vector3ui{0x1fffff}), 0x7fffffffffffffffull);
+}
+
+void MortonTreeTest::empty() {
+    MortonOctree<Float> tree{Corrade::Containers::StridedArrayView<const Vector3>{}};
+    CORRADE_COMPARE(tree.size(), 0);
+    CORRADE_VERIFY(tree.codes().empty());
+    CORRADE_VERIFY(tree.pointsInRange({Vector3{-1.0f}, Vector3{1.0f}}).empty());
+    CORRADE_VERIFY(tree.pointsInRadius({}, 1.0f).empty());
+    CORRADE_VERIFY(tree.nearest({}, 3).empty());
+}
+
+void MortonTreeTest::construct() {
+    const Vector3 data[]{
+        {1.0f, 1.0f, 1.0f},
+        {-1.0f, 0.0f, 0.5f},
+        {-1.0f, -1.0f, -1.0f},
+        {0.0f, 3.0f, 0.0f}
+    };
+    MortonOctree<Float> tree{Corrade::Containers::StridedArrayView<const Vector3>{data, 4, sizeof(Vector3)}};
+    CORRADE_COMPARE(tree.size(), 4);
+    CORRADE_COMPARE(tree.bounds(), (Range3D{{-1.0f, -1.0f, -1.0f}, {1.0f, 3.0f, 1.0f}}));
+
+    /* The minimum corner has the lowest code, the point with maximal X and Z
+       the highest */
+    CORRADE_COMPARE(tree.codes().front(), 0);
+    CORRADE_COMPARE(tree.indices().front(), 2);
+    CORRADE_COMPARE(tree.indices().back(), 0);
+    CORRADE_VERIFY(std::is_sorted(tree.codes().begin(), tree.codes().end()));
+}
+
+void MortonTreeTest::range() {
+    const std::vector<Vector3> data = points<Vector3>(5000);
+    MortonOctree<Float> tree{view(data)};
+    CORRADE_COMPARE(tree.size(), 5000);
+
+    for(const Range3D& range: {
+        Range3D{{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}},
+        Range3D{{-0.05f, -0.02f, -0.1f}, {0.01f, 0.1f, 0.03f}},
+        Range3D{{0.9f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}},
+        Range3D{{-2.0f, -2.0f, -2.0f}, {2.0f, 2.0f, 2.0f}},
+        Range3D{{2.0f, 2.0f, 2.0f}, {3.0f, 3.0f, 3.0f}}
+    }) {
+        CORRADE_COMPARE(sorted(tree.pointsInRange(range)), bruteForceRange(data, range));
+    }
+
+    /* Boundary is inclusive */
+    CORRADE_COMPARE(tree.pointsInRange({data[17], data[17]}), std::vector<UnsignedInt>{17});
+}
+
+void MortonTreeTest::radius() {
+    const std::vector<Vector3> data = points<Vector3>(5000);
+    MortonOctree<Float> tree{view(data)};
+
+    CORRADE_COMPARE(sorted(tree.pointsInRadius({}, 0.05f)), bruteForceRadius(data, {}, 0.05f));
+    CORRADE_COMPARE(sorted(tree.pointsInRadius(data[42], 0.3f)), bruteForceRadius(data, data[42], 0.3f));
+    CORRADE_COMPARE(sorted(tree.pointsInRadius({1.0f, 1.0f, 1.0f}, 0.5f)), bruteForceRadius(data, {1.0f, 1.0f, 1.0f}, 0.5f));
+    CORRADE_COMPARE(sorted(tree.pointsInRadius({}, 10.0f)).size(), 5000);
+    CORRADE_COMPARE(tree.pointsInRadius(data[17], 0.0f), std::vector<UnsignedInt>{17});
+}
+
+void MortonTreeTest::nearest() {
+    const std::vector<Vector3> data = points<Vector3>(5000);
+    MortonOctree<Float> tree{view(data)};
+
+    CORRADE_COMPARE(tree.nearest({}, 1), bruteForceNearest(data, {}, 1));
+    CORRADE_COMPARE(tree.nearest({}, 16), bruteForceNearest(data, {}, 16));
+    CORRADE_COMPARE(tree.nearest(data[42], 5), bruteForceNearest(data, data[42], 5));
+    CORRADE_COMPARE(tree.nearest({3.0f, -2.0f, 0.5f}, 100), bruteForceNearest(data, {3.0f, -2.0f, 0.5f}, 100));
+    CORRADE_COMPARE(tree.nearest({}, 6000).size(), 5000);
+    CORRADE_VERIFY(tree.nearest({}, 0).empty());
+}
+
+void MortonTreeTest::duplicates() {
+    /* More identical points than fit into a leaf, which makes the traversal
+       go down to the last level */
+    std::vector<Vector3> data = points<Vector3>(100);
+    data.insert(data.end(), 200, Vector3{0.25f});
+    MortonOctree<Float> tree{view(data)};
+
+    CORRADE_COMPARE(sorted(tree.pointsInRadius(Vector3{0.25f}, 0.0f)), bruteForceRadius(data, Vector3{0.25f}, 0.0f));
+    CORRADE_COMPARE(tree.nearest(Vector3{0.25f}, 10), bruteForceNearest(data, Vector3{0.25f}, 10));
+    CORRADE_COMPARE(tree.nearest(Vector3{0.25f}, 10).front(), 100);
+}
+
+void MortonTreeTest::flat() {
+    /* All points in a plane, the tree should handle zero extent in one
+       dimension */
+    std::vector<Vector3> data = points<Vector3>(1000);
+    for(Vector3& point: data) point.z() = 0.5f;
+    MortonOctree<Float> tree{view(data)};
+
+    const Range3D range{{-0.2f, -0.3f, 0.0f}, {0.4f, 0.1f, 1.0f}};
+    CORRADE_COMPARE(sorted(tree.pointsInRange(range)), bruteForceRange(data, range));
+    CORRADE_COMPARE(tree.nearest({0.1f, 0.2f, 0.0f}, 7), bruteForceNearest(data, {0.1f, 0.2f, 0.0f}, 7));
+}
+
+void MortonTreeTest::quadtree() {
+    const std::vector<Vector2> data = points<Vector2>(3000);
+    MortonQuadtree<Float> tree{view(data)};
+
+    const Range2D range{{-0.3f, -0.05f}, {0.02f, 0.6f}};
+    CORRADE_COMPARE(sorted(tree.pointsInRange(range)), bruteForceRange(data, range));
+    CORRADE_COMPARE(sorted(tree.pointsInRadius(data[5], 0.2f)), bruteForceRadius(data, data[5], 0.2f));
+    CORRADE_COMPARE(tree.nearest({0.5f, -0.5f}, 9), bruteForceNearest(data, {0.5f, -0.5f}, 9));
+}
+
+void MortonTreeTest::multithreaded() {
+    const std::vector<Vector3> data = points<Vector3>(20000);
+    MortonOctree<Float> single{view(data)};
+    MortonOctree<Float> multi{view(data), 4};
+
+    /* The order is the same regardless of thread count */
+    CORRADE_COMPARE(multi.size(), single.size());
+    CORRADE_VERIFY(std::equal(multi.codes().begin(), multi.codes().end(), single.codes().begin()));
+    CORRADE_VERIFY(std::equal(multi.indices().begin(), multi.indices().end(), single.indices().begin()));
+
+    const Range3D range{{-0.3f, -0.2f, -0.5f}, {0.4f, 0.1f, 0.2f}};
+    CORRADE_COMPARE(multi.pointsInRange(range), single.pointsInRange(range));
+    CORRADE_COMPARE(sorted(multi.pointsInRange(range)), bruteForceRange(data, range));
+    CORRADE_COMPARE(multi.nearest(data[1000], 12), bruteForceNearest(data, data[1000], 12));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::MortonTreeTest)
@@ -37,6 +37,7 @@ struct QrTest: Corrade::TestSuite::Tester {
 
     void test();
     void decomposeRotationShear();
+    void batch();
 };
 
 using namespace Math::Literals;
@@ -47,7 +48,8 @@ typedef Matrix4<Float> Matrix4;
 
 QrTest::QrTest() {
     addTests({&QrTest::test,
-              &QrTest::decomposeRotationShear});
+              &QrTest::decomposeRotationShear,
+              &QrTest::batch});
 }
 
 void QrTest::test() {
@@ -84,6 +86,25 @@ void QrTest::decomposeRotationShear() {
     CORRADE_COMPARE(r4.rotationShear(), Matrix4::shearingXZ(0.274077f, 0.0f).rotationShear());
 }
 
+void QrTest::batch() {
+    /* More than one block, with a partially filled last one */
+    Matrix3x3 matrices[9];
+    for(std::size_t i = 0; i != 9; ++i)
+        matrices[i] = (Matrix4::scaling({1.5f, 2.0f + Float(i), 1.0f})*Matrix4::rotationZ(Deg<Float>(10.0f*Float(i)))).rotationScaling();
+    matrices[0] = Matrix3x3{Vector3{  0.0f,   3.0f,   4.0f},
+                            Vector3{-20.0f,  27.0f,  11.0f},
+                            Vector3{-14.0f,  -4.0f,  -2.0f}};
+
+    Matrix3x3 q[9], r[9];
+    Algorithms::qr<3, Float>(matrices, q, r);
+    for(std::size_t i = 0; i != 9; ++i) {
+        Matrix3x3 qExpected, rExpected;
+        std::tie(qExpected, rExpected) = Algorithms::qr(matrices[i]);
+        CORRADE_COMPARE(q[i], qExpected);
+        CORRADE_COMPARE(r[i], rExpected);
+    }
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::QrTest)
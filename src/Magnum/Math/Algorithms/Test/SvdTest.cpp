@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Matrix4.h"
@@ -35,6 +36,7 @@ struct SvdTest: Corrade::TestSuite::Tester {
 
     template<class T> void test();
     void decomposeRotationShear();
+    template<class T> void batch();
 };
 
 template<class T> using Matrix5x8 = RectangularMatrix<5, 8, T>;
@@ -46,7 +48,9 @@ template<class T> using Vector5 = Vector<5, T>;
 SvdTest::SvdTest() {
     addTests({&SvdTest::test<Float>,
               &SvdTest::test<Double>,
-              &SvdTest::decomposeRotationShear});
+              &SvdTest::decomposeRotationShear,
+              &SvdTest::batch<Float>,
+              &SvdTest::batch<Double>});
 }
 
 template<class T> void SvdTest::test() {
@@ -116,6 +120,49 @@ void SvdTest::decomposeRotationShear() {
     CORRADE_COMPARE(Matrix4::from(u*v.transposed(), {}), Matrix4::rotationZ(35.0_degf));
 }
 
+template<class T> void SvdTest::batch() {
+    setTestCaseName(std::is_same<T, Double>::value ? "batch<Double>" : "batch<Float>");
+
+    constexpr const Matrix5x8<T> a{
+        Vector8<T>{T{22}, T{14}, T{ -1}, T{-3}, T{ 9}, T{ 9}, T{ 2}, T{ 4}},
+        Vector8<T>{T{10}, T{ 7}, T{ 13}, T{-2}, T{ 8}, T{ 1}, T{-6}, T{ 5}},
+        Vector8<T>{T{ 2}, T{10}, T{ -1}, T{13}, T{ 1}, T{-7}, T{ 6}, T{ 0}},
+        Vector8<T>{T{ 3}, T{ 0}, T{-11}, T{-2}, T{-2}, T{ 5}, T{ 5}, T{-2}},
+        Vector8<T>{T{ 7}, T{ 8}, T{  3}, T{ 4}, T{ 4}, T{-1}, T{ 1}, T{ 2}}};
+
+    /* More than one block, with a partially filled last one. The first
+       matrix is rank-deficient, the others get a different diagonal. */
+    Matrix5x8<T> matrices[10];
+    for(std::size_t i = 0; i != 10; ++i) {
+        matrices[i] = a;
+        matrices[i][i % 5][i % 8] += T(i);
+    }
+
+    Matrix5x8<T> u[10];
+    Vector5<T> w[10];
+    Matrix5<T> v[10];
+    Algorithms::svd<5, 8, T>(matrices, u, w, v);
+
+    for(std::size_t i = 0; i != 10; ++i) {
+
+        /* Test composition */
+        Matrix8<T> u2{u[i][0], u[i][1], u[i][2], u[i][3], u[i][4], Vector8<T>{}, Vector8<T>{}, Vector8<T>{}};
+        Matrix5x8<T> w2 = Matrix5x8<T>::fromDiagonal(w[i]);
+        CORRADE_COMPARE(u2*w2*v[i].transposed(), matrices[i]);
+
+        /* Test that V is unitary */
+        CORRADE_COMPARE(v[i]*v[i].transposed(), Matrix5<T>{IdentityInit});
+
+        /* The singular values are the same as from the scalar variant, up to
+           ordering */
+        Vector5<T> wExpected = std::get<1>(Algorithms::svd(matrices[i]));
+        std::sort(wExpected.data(), wExpected.data() + 5);
+        Vector5<T> wSorted = w[i];
+        std::sort(wSorted.data(), wSorted.data() + 5);
+        CORRADE_COMPARE(wSorted, wExpected);
+    }
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::SvdTest)
@@ -0,0 +1,170 @@
+#ifndef Magnum_Math_ArcLength_h
+#define Magnum_Math_ArcLength_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2016 Ashwin Ravichandran <ashwinravichandran24@gmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::arcLengthsInto(), @ref Magnum::Math::arcLengthParameter(), @ref Magnum::Math::arcLengthParametersInto()
+ */
+
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Bezier.h"
+#include "Magnum/Math/CubicHermite.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Fill an arc-length table of a Bézier curve
+@param bezier       Bézier curve
+@param[out] lengths Where to put the cumulative lengths. Expected to have at
+    least two items.
+
+Samples the curve at @cpp lengths.size() @ce uniformly distributed
+interpolation factors @f$ \frac{i}{n - 1} @f$ and writes length of the
+polyline connecting the samples up to @f$ i @f$-th sample to @cpp lengths[i] @ce,
+the first item being always zero. The samples are evaluated with
+@ref Bezier::valueInto() directly into a temporary on the stack in blocks,
+the only storage needed is the one supplied by the caller, so the table can
+be built once and reused for @ref arcLengthParameter() lookups without any
+allocation.
+
+Precision depends on the sample count, the chord lengths always
+underestimate the real arc length.
+*/
+template<UnsignedInt order, UnsignedInt dimensions, class T> void arcLengthsInto(const Bezier<order, dimensions, T>& bezier, const Corrade::Containers::StridedArrayView<T>& lengths) {
+    CORRADE_ASSERT(lengths.size() >= 2,
+        "Math::arcLengthsInto(): expected at least two items, got" << lengths.size(), );
+
+    const Float step = 1.0f/Float(lengths.size() - 1);
+    Vector<dimensions, T> previous = bezier[0];
+    lengths[0] = T(0);
+    for(std::size_t offset = 1; offset < lengths.size(); offset += 8) {
+        const std::size_t count = lengths.size() - offset < 8 ? lengths.size() - offset : 8;
+        Float factors[8];
+        Vector<dimensions, T> points[8];
+        for(std::size_t k = 0; k != count; ++k)
+            factors[k] = (offset + k)*step;
+        bezier.valueInto(Corrade::Containers::StridedArrayView<const Float>{factors, count, sizeof(Float)}, Corrade::Containers::StridedArrayView<Vector<dimensions, T>>{points, count, sizeof(Vector<dimensions, T>)});
+
+        for(std::size_t k = 0; k != count; ++k) {
+            lengths[offset + k] = lengths[offset + k - 1] + (points[k] - previous).length();
+            previous = points[k];
+        }
+    }
+}
+
+/**
+@brief Fill an arc-length table of a cubic Hermite spline segment
+@param a            First spline point
+@param b            Second spline point
+@param[out] lengths Where to put the cumulative lengths. Expected to have at
+    least two items.
+
+Same as @ref arcLengthsInto(const Bezier<order, dimensions, T>&, const Corrade::Containers::StridedArrayView<T>&),
+but samples the segment using
+@ref splerpInto(const CubicHermite<T>&, const CubicHermite<T>&, const Corrade::Containers::StridedArrayView<const U>&, const Corrade::Containers::StridedArrayView<T>&).
+Only vector splines are supported.
+*/
+template<class T> void arcLengthsInto(const CubicHermite<T>& a, const CubicHermite<T>& b, const Corrade::Containers::StridedArrayView<typename T::Type>& lengths) {
+    typedef typename T::Type Type;
+    CORRADE_ASSERT(lengths.size() >= 2,
+        "Math::arcLengthsInto(): expected at least two items, got" << lengths.size(), );
+
+    const Type step = Type(1)/Type(lengths.size() - 1);
+    T previous = a.point();
+    lengths[0] = Type(0);
+    for(std::size_t offset = 1; offset < lengths.size(); offset += 8) {
+        const std::size_t count = lengths.size() - offset < 8 ? lengths.size() - offset : 8;
+        Type phases[8];
+        T points[8];
+        for(std::size_t k = 0; k != count; ++k)
+            phases[k] = (offset + k)*step;
+        splerpInto(a, b, Corrade::Containers::StridedArrayView<const Type>{phases, count, sizeof(Type)}, Corrade::Containers::StridedArrayView<T>{points, count, sizeof(T)});
+
+        for(std::size_t k = 0; k != count; ++k) {
+            lengths[offset + k] = lengths[offset + k - 1] + (points[k] - previous).length();
+            previous = points[k];
+        }
+    }
+}
+
+/**
+@brief Interpolation factor corresponding to given distance along a curve
+@param lengths      Arc-length table filled by @ref arcLengthsInto()
+@param distance     Distance along the curve
+
+Finds the table segment containing @p distance using a binary search and
+linearly interpolates the factor inside it, giving a parameter that can be
+passed to @ref Bezier::value() or @ref splerp() to move along the curve with
+constant speed. Distances outside of the curve are clamped, so the result is
+always in the @f$ [0, 1] @f$ range. Expects that the table has at least two
+items.
+@see @ref arcLengthParametersInto()
+*/
+template<class T> T arcLengthParameter(const Corrade::Containers::StridedArrayView<const T>& lengths, T distance) {
+    CORRADE_ASSERT(lengths.size() >= 2,
+        "Math::arcLengthParameter(): expected at least two items, got" << lengths.size(), {});
+
+    const std::size_t last = lengths.size() - 1;
+    if(distance <= lengths[0]) return T(0);
+    if(distance >= lengths[last]) return T(1);
+
+    /* Find the first item that's not less than the distance. Since the
+       distance is inside (lengths[0], lengths[last]), it's always in
+       [1, last]. */
+    std::size_t min = 1, max = last;
+    while(min < max) {
+        const std::size_t mid = min + (max - min)/2;
+        if(lengths[mid] < distance) min = mid + 1;
+        else max = mid;
+    }
+
+    const T segment = lengths[min] - lengths[min - 1];
+    const T fraction = segment == T(0) ? T(0) : (distance - lengths[min - 1])/segment;
+    return (T(min - 1) + fraction)/T(last);
+}
+
+/**
+@brief Interpolation factors corresponding to a batch of distances along a curve
+@param lengths      Arc-length table filled by @ref arcLengthsInto()
+@param distances    Distances along the curve
+@param[out] out     Where to put the factors, expected to have the same size
+    as @p distances
+
+Batch variant of @ref arcLengthParameter(), giving the same results.
+*/
+template<class T> void arcLengthParametersInto(const Corrade::Containers::StridedArrayView<const T>& lengths, const Corrade::Containers::StridedArrayView<const T>& distances, const Corrade::Containers::StridedArrayView<T>& out) {
+    CORRADE_ASSERT(distances.size() == out.size(),
+        "Math::arcLengthParametersInto(): expected the same count of distances and output factors, got" << distances.size() << "and" << out.size(), );
+
+    for(std::size_t i = 0; i != distances.size(); ++i)
+        out[i] = arcLengthParameter(lengths, distances[i]);
+}
+
+}}
+
+#endif
@@ -31,6 +31,7 @@
  */
 
 #include <array>
+#include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Math/Vector.h"
 
@@ -166,12 +167,33 @@ template<UnsignedInt order, UnsignedInt dimensions, class T> class Bezier {
          *
          * Returns point on the curve for given interpolation factor. Uses
          * the [De Casteljau's algorithm](https://en.wikipedia.org/wiki/De_Casteljau%27s_algorithm).
-         * @see @ref subdivide()
+         * @see @ref valueInto(), @ref subdivide()
          */
         Vector<dimensions, T> value(Float t) const {
-            return calculateIntermediatePoints(t)[0][order];
+            /* Unlike subdivide(), only the last intermediate point is needed,
+               so the points can be combined in place */
+            Vector<dimensions, T> points[order + 1];
+            for(std::size_t i = 0; i <= order; ++i)
+                points[i] = _data[i];
+            for(std::size_t r = 1; r <= order; ++r)
+                for(std::size_t i = 0; i <= order - r; ++i)
+                    points[i] = (1 - t)*points[i] + t*points[i + 1];
+            return points[0];
         }
 
+        /**
+         * @brief Interpolate the curve at a batch of positions
+         * @param t         Interpolation factors
+         * @param[out] out  Where to put the points, expected to have the
+         *      same size as @p t
+         *
+         * Batch variant of @ref value(), giving the same results. The
+         * factors are processed in blocks of eight, with the control points
+         * transposed to a structure-of-arrays layout so the compiler can
+         * vectorize the De Casteljau steps for the whole block at once.
+         */
+        void valueInto(const Corrade::Containers::StridedArrayView<const Float>& t, const Corrade::Containers::StridedArrayView<Vector<dimensions, T>>& out) const;
+
         /**
          * @brief Subdivide the curve at given position
          *
@@ -214,6 +236,37 @@ template<UnsignedInt order, UnsignedInt dimensions, class T> class Bezier {
         Vector<dimensions, T> _data[order + 1];
 };
 
+template<UnsignedInt order, UnsignedInt dimensions, class T> void Bezier<order, dimensions, T>::valueInto(const Corrade::Containers::StridedArrayView<const Float>& t, const Corrade::Containers::StridedArrayView<Vector<dimensions, T>>& out) const {
+    CORRADE_ASSERT(t.size() == out.size(),
+        "Math::Bezier::valueInto(): expected the same count of factors and output points, got" << t.size() << "and" << out.size(), );
+
+    for(std::size_t offset = 0; offset < t.size(); offset += 8) {
+        const std::size_t count = t.size() - offset < 8 ? t.size() - offset : 8;
+
+        /* Transpose the control points, replicating each for all factors in
+           the block. The unused factors are zero, which keeps the unused
+           lanes finite. */
+        Float factors[8]{};
+        for(std::size_t k = 0; k != count; ++k) factors[k] = t[offset + k];
+        T points[order + 1][dimensions][8];
+        for(std::size_t i = 0; i <= order; ++i)
+            for(std::size_t j = 0; j != dimensions; ++j)
+                for(std::size_t k = 0; k != 8; ++k)
+                    points[i][j][k] = _data[i][j];
+
+        /* Same operations as in value(), so the results are the same */
+        for(std::size_t r = 1; r <= order; ++r)
+            for(std::size_t i = 0; i <= order - r; ++i)
+                for(std::size_t j = 0; j != dimensions; ++j)
+                    for(std::size_t k = 0; k != 8; ++k)
+                        points[i][j][k] = (1 - factors[k])*points[i][j][k] + factors[k]*points[i + 1][j][k];
+
+        for(std::size_t k = 0; k != count; ++k)
+            for(std::size_t j = 0; j != dimensions; ++j)
+                out[offset + k][j] = points[0][j][k];
+    }
+}
+
 /**
 @brief Quadratic Bézier curve
 
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Math::CubicHermite, alias @ref Magnum::Math::CubicHermite2D, @ref Magnum::Math::CubicHermite3D, function @ref Magnum::Math::select(), @ref Magnum::Math::lerp(), @ref Magnum::Math::splerp()
  */
 
+#include <Corrade/Containers/StridedArrayView.h>
+
 #include "Magnum/Math/Complex.h"
 #include "Magnum/Math/Quaternion.h"
 
@@ -461,6 +463,49 @@ template<class T, class U> T splerp(const CubicHermite<T>& a, const CubicHermite
         (t*t*t - t*t)*b.inTangent();
 }
 
+/** @relatesalso CubicHermite
+@brief Spline interpolation of two cubic Hermite points at a batch of phases
+@param a        First spline point
+@param b        Second spline point
+@param t        Interpolation phases
+@param[out] out Where to put the interpolated values, expected to have the
+    same size as @p t
+
+Batch variant of @ref splerp(const CubicHermite<T>&, const CubicHermite<T>&, U),
+giving the same results. The four basis weights are calculated for blocks of
+eight phases at a time so the compiler can vectorize the polynomial evaluation,
+and only then combined with the segment points and tangents. As with the
+single-value variant there's no normalization step, so this isn't suitable for
+complex number or quaternion splines.
+*/
+template<class T, class U> void splerpInto(const CubicHermite<T>& a, const CubicHermite<T>& b, const Corrade::Containers::StridedArrayView<const U>& t, const Corrade::Containers::StridedArrayView<T>& out) {
+    CORRADE_ASSERT(t.size() == out.size(),
+        "Math::splerpInto(): expected the same count of phases and output values, got" << t.size() << "and" << out.size(), );
+
+    for(std::size_t offset = 0; offset < t.size(); offset += 8) {
+        const std::size_t count = t.size() - offset < 8 ? t.size() - offset : 8;
+
+        U phases[8]{};
+        for(std::size_t k = 0; k != count; ++k) phases[k] = t[offset + k];
+
+        /* Same expressions as in splerp(), so the results are the same */
+        U weights[4][8];
+        for(std::size_t k = 0; k != 8; ++k) {
+            const U tk = phases[k];
+            weights[0][k] = U(2)*tk*tk*tk - U(3)*tk*tk + U(1);
+            weights[1][k] = tk*tk*tk - U(2)*tk*tk + tk;
+            weights[2][k] = U(-2)*tk*tk*tk + U(3)*tk*tk;
+            weights[3][k] = tk*tk*tk - tk*tk;
+        }
+
+        for(std::size_t k = 0; k != count; ++k)
+            out[offset + k] = weights[0][k]*a.point() +
+                weights[1][k]*a.outTangent() +
+                weights[2][k]*b.point() +
+                weights[3][k]*b.inTangent();
+    }
+}
+
 /** @relatesalso CubicHermite
 @brief Spline interpolation of two cubic Hermite complex numbers
 
@@ -0,0 +1,126 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Fast.h"
+
+#include <tuple>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace Math { namespace Fast {
+
+void rsqrtInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::Fast::rsqrtInto(): expected the same count of source and destination items, got" << src.size() << "and" << dst.size(), );
+    if(src.empty()) return;
+
+    /* Contiguous data, process everything in a single flat loop */
+    if(std::size_t(src.stride()) == sizeof(Float) && std::size_t(dst.stride()) == sizeof(Float)) {
+        const Float* in = &src[0];
+        Float* out = &dst[0];
+        for(std::size_t i = 0; i != src.size(); ++i)
+            out[i] = rsqrt(in[i]);
+        return;
+    }
+
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = rsqrt(src[i]);
+}
+
+void sincosInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<Float>& sinDst, const Corrade::Containers::StridedArrayView<Float>& cosDst) {
+    CORRADE_ASSERT(src.size() == sinDst.size() && src.size() == cosDst.size(),
+        "Math::Fast::sincosInto(): expected the same count of source and destination items, got" << src.size() << Corrade::Utility::Debug::nospace << "," << sinDst.size() << "and" << cosDst.size(), );
+    if(src.empty()) return;
+
+    /* Contiguous data, process everything in a single flat loop */
+    if(std::size_t(src.stride()) == sizeof(Float) && std::size_t(sinDst.stride()) == sizeof(Float) && std::size_t(cosDst.stride()) == sizeof(Float)) {
+        const Float* in = &src[0];
+        Float* outSin = &sinDst[0];
+        Float* outCos = &cosDst[0];
+        for(std::size_t i = 0; i != src.size(); ++i)
+            std::tie(outSin[i], outCos[i]) = sincos(Rad<Float>(in[i]));
+        return;
+    }
+
+    for(std::size_t i = 0; i != src.size(); ++i)
+        std::tie(sinDst[i], cosDst[i]) = sincos(Rad<Float>(src[i]));
+}
+
+void expInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::Fast::expInto(): expected the same count of source and destination items, got" << src.size() << "and" << dst.size(), );
+    if(src.empty()) return;
+
+    /* Contiguous data, process everything in a single flat loop */
+    if(std::size_t(src.stride()) == sizeof(Float) && std::size_t(dst.stride()) == sizeof(Float)) {
+        const Float* in = &src[0];
+        Float* out = &dst[0];
+        for(std::size_t i = 0; i != src.size(); ++i)
+            out[i] = exp(in[i]);
+        return;
+    }
+
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = exp(src[i]);
+}
+
+void logInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::Fast::logInto(): expected the same count of source and destination items, got" << src.size() << "and" << dst.size(), );
+    if(src.empty()) return;
+
+    /* Contiguous data, process everything in a single flat loop */
+    if(std::size_t(src.stride()) == sizeof(Float) && std::size_t(dst.stride()) == sizeof(Float)) {
+        const Float* in = &src[0];
+        Float* out = &dst[0];
+        for(std::size_t i = 0; i != src.size(); ++i)
+            out[i] = log(in[i]);
+        return;
+    }
+
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = log(src[i]);
+}
+
+void atan2Into(const Corrade::Containers::StridedArrayView<const Float>& y, const Corrade::Containers::StridedArrayView<const Float>& x, const Corrade::Containers::StridedArrayView<Float>& dst) {
+    CORRADE_ASSERT(y.size() == x.size() && y.size() == dst.size(),
+        "Math::Fast::atan2Into(): expected the same count of source and destination items, got" << y.size() << Corrade::Utility::Debug::nospace << "," << x.size() << "and" << dst.size(), );
+    if(y.empty()) return;
+
+    /* Contiguous data, process everything in a single flat loop */
+    if(std::size_t(y.stride()) == sizeof(Float) && std::size_t(x.stride()) == sizeof(Float) && std::size_t(dst.stride()) == sizeof(Float)) {
+        const Float* inY = &y[0];
+        const Float* inX = &x[0];
+        Float* out = &dst[0];
+        for(std::size_t i = 0; i != y.size(); ++i)
+            out[i] = Float(atan2(inY[i], inX[i]));
+        return;
+    }
+
+    for(std::size_t i = 0; i != y.size(); ++i)
+        dst[i] = Float(atan2(y[i], x[i]));
+}
+
+}}}
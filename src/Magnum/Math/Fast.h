@@ -0,0 +1,279 @@
+#ifndef Magnum_Math_Fast_h
+#define Magnum_Math_Fast_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Magnum::Math::Fast
+ */
+
+#include <utility>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Vector.h"
+
+namespace Magnum { namespace Math { namespace Fast {
+
+namespace Implementation {
+    union FloatBits {
+        UnsignedInt u;
+        Float f;
+    };
+
+    /* Branchless rounding to nearest integer, vectorizes better than
+       std::round() */
+    inline Int round(Float value) {
+        return Int(value + (value >= 0.0f ? 0.5f : -0.5f));
+    }
+}
+
+/**
+@brief Fast approximate inverse square root
+
+Uses the well-known bit trick followed by one Newton-Raphson iteration. The
+maximal relative error compared to @ref Math::sqrtInverted() is
+@f$ 1.8 \cdot 10^{-3} @f$ for positive normal inputs, the result is undefined
+for zero, negative, denormal and non-finite inputs.
+@see @ref normalized(), @ref rsqrtInto()
+*/
+inline Float rsqrt(Float value) {
+    Implementation::FloatBits bits;
+    bits.f = value;
+    bits.u = 0x5f375a86 - (bits.u >> 1);
+    return bits.f*(1.5f - 0.5f*value*bits.f*bits.f);
+}
+
+/** @overload */
+template<std::size_t size> inline Vector<size, Float> rsqrt(const Vector<size, Float>& value) {
+    Vector<size, Float> out{NoInit};
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = rsqrt(value[i]);
+    return out;
+}
+
+/**
+@brief Fast approximate vector normalization
+
+Same as @ref Vector::normalized(), but using @ref rsqrt(). The maximal error
+of the resulting vector length is thus @f$ 1.8 \cdot 10^{-3} @f$. The result
+is undefined for zero vectors.
+*/
+template<std::size_t size> inline Vector<size, Float> normalized(const Vector<size, Float>& vector) {
+    return vector*rsqrt(vector.dot());
+}
+
+/**
+@brief Fast approximate sine and cosine
+
+The angle is reduced to @f$ [-\frac{\pi}{4}, \frac{\pi}{4}] @f$ and then
+approximated with a polynomial, without any branches. The maximal absolute
+error compared to @ref Math::sincos() is @f$ 4 \cdot 10^{-6} @f$ for angles
+in range @f$ [-1000, 1000] @f$, the precision degrades with larger angles.
+@see @ref sincosInto()
+*/
+inline std::pair<Float, Float> sincos(Rad<Float> angle) {
+    /* Cody-Waite reduction with pi/2 split into two parts */
+    const Float x = Float(angle);
+    const Int n = Implementation::round(x*0.636619772f);
+    const Float r = (x - Float(n)*1.5703125f) - Float(n)*4.83826794897e-4f;
+    const Float r2 = r*r;
+
+    /* Taylor polynomials are within the bounds on the reduced range */
+    const Float s = r + r*r2*(-0.166666667f + r2*(8.33333333e-3f + r2*-1.98412698e-4f));
+    const Float c = 1.0f + r2*(-0.5f + r2*(4.16666667e-2f + r2*-1.38888889e-3f));
+
+    /* Pick a quadrant */
+    const Float sine = n & 1 ? c : s;
+    const Float cosine = n & 1 ? s : c;
+    return {n & 2 ? -sine : sine, (n + 1) & 2 ? -cosine : cosine};
+}
+
+/** @overload */
+inline std::pair<Float, Float> sincos(Deg<Float> angle) {
+    return sincos(Rad<Float>(angle));
+}
+
+/**
+@overload
+
+Components of @p angle are expected to be in radians.
+*/
+template<std::size_t size> inline std::pair<Vector<size, Float>, Vector<size, Float>> sincos(const Vector<size, Float>& angle) {
+    Vector<size, Float> sine{NoInit}, cosine{NoInit};
+    for(std::size_t i = 0; i != size; ++i) {
+        const std::pair<Float, Float> sincosI = sincos(Rad<Float>(angle[i]));
+        sine[i] = sincosI.first;
+        cosine[i] = sincosI.second;
+    }
+    return {sine, cosine};
+}
+
+/**
+@brief Fast approximate natural exponential
+
+Splits the exponent into an integral power of two that's put directly into
+exponent bits and a fractional part approximated with a polynomial. The
+maximal relative error compared to @ref Math::exp() is
+@f$ 3 \cdot 10^{-7} @f$. Inputs are clamped to @f$ [-87, 88] @f$ to avoid
+overflow into infinity or underflow into denormals.
+@see @ref expInto()
+*/
+inline Float exp(Float exponent) {
+    const Float x = exponent < -87.0f ? -87.0f : (exponent > 88.0f ? 88.0f : exponent);
+    const Int n = Implementation::round(x*1.44269504f);
+    /* Remainder in [-ln(2)/2, ln(2)/2], with ln(2) split into two parts for
+       precision */
+    const Float f = (x - Float(n)*0.693145752f) - Float(n)*1.42860677e-6f;
+    const Float p = 1.0f + f*(1.0f + f*(0.5f + f*(0.166666667f + f*(4.16666667e-2f + f*(8.33333333e-3f + f*1.38888889e-3f)))));
+
+    Implementation::FloatBits scale;
+    scale.u = UnsignedInt(n + 127) << 23;
+    return p*scale.f;
+}
+
+/** @overload */
+template<std::size_t size> inline Vector<size, Float> exp(const Vector<size, Float>& exponent) {
+    Vector<size, Float> out{NoInit};
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = exp(exponent[i]);
+    return out;
+}
+
+/**
+@brief Fast approximate natural logarithm
+
+Extracts the exponent bits and approximates logarithm of the mantissa using a
+series. Compared to @ref Math::log(), the maximal absolute error for results
+in range @f$ [-1, 1] @f$ and the maximal relative error otherwise is
+@f$ 2 \cdot 10^{-7} @f$ for positive normal inputs. The result is undefined
+for zero, negative, denormal and non-finite inputs.
+@see @ref logInto()
+*/
+inline Float log(Float number) {
+    Implementation::FloatBits bits;
+    bits.f = number;
+    Int e = Int((bits.u >> 23) & 0xff) - 127;
+    bits.u = (bits.u & 0x7fffff) | 0x3f800000;
+
+    /* Get the mantissa to [sqrt(0.5), sqrt(2)) */
+    const bool large = bits.f > 1.41421356f;
+    const Float m = large ? bits.f*0.5f : bits.f;
+    e += large ? 1 : 0;
+
+    /* log(m) = 2 atanh((m - 1)/(m + 1)) */
+    const Float s = (m - 1.0f)/(m + 1.0f);
+    const Float s2 = s*s;
+    return Float(e)*0.693145752f + (Float(e)*1.42860677e-6f + 2.0f*s*(1.0f + s2*(0.333333333f + s2*(0.2f + s2*0.142857143f))));
+}
+
+/** @overload */
+template<std::size_t size> inline Vector<size, Float> log(const Vector<size, Float>& number) {
+    Vector<size, Float> out{NoInit};
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = log(number[i]);
+    return out;
+}
+
+/**
+@brief Fast approximate arc tangent of two values
+
+Uses a polynomial approximation from *Abramowitz, M.; Stegun, I. (1964).
+"Handbook of Mathematical Functions", formula 4.4.47*. The maximal absolute
+error compared to @ref std::atan2() is @f$ 1.2 \cdot 10^{-5} @f$. Returns zero
+if both @p y and @p x are zero.
+@see @ref atan2Into()
+*/
+inline Rad<Float> atan2(Float y, Float x) {
+    const Float absX = x < 0.0f ? -x : x;
+    const Float absY = y < 0.0f ? -y : y;
+    const Float max = absX > absY ? absX : absY;
+    const Float min = absX > absY ? absY : absX;
+    const Float a = min/(max > 0.0f ? max : 1.0f);
+    const Float s = a*a;
+    Float r = a*(0.9998660f + s*(-0.3302995f + s*(0.1801410f + s*(-0.0851330f + s*0.0208351f))));
+
+    r = absY > absX ? 1.57079633f - r : r;
+    r = x < 0.0f ? 3.14159265f - r : r;
+    return Rad<Float>{y < 0.0f ? -r : r};
+}
+
+/**
+@brief Fast approximate inverse square root of an array of values
+@param[in]  src     Source values
+@param[out] dst     Destination values
+
+Batch variant of @ref rsqrt(). Expects that @p src and @p dst have the same
+size, the views can be the same. If both views are contiguous, the operation is
+done in a single flat loop that the compiler is able to vectorize.
+*/
+MAGNUM_EXPORT void rsqrtInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<Float>& dst);
+
+/**
+@brief Fast approximate sine and cosine of an array of values
+@param[in]  src     Source angles in radians
+@param[out] sinDst  Destination sine values
+@param[out] cosDst  Destination cosine values
+
+Batch variant of @ref sincos(), with the same requirements and behavior as
+@ref rsqrtInto().
+*/
+MAGNUM_EXPORT void sincosInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<Float>& sinDst, const Corrade::Containers::StridedArrayView<Float>& cosDst);
+
+/**
+@brief Fast approximate natural exponential of an array of values
+@param[in]  src     Source values
+@param[out] dst     Destination values
+
+Batch variant of @ref exp(), with the same requirements and behavior as
+@ref rsqrtInto().
+*/
+MAGNUM_EXPORT void expInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<Float>& dst);
+
+/**
+@brief Fast approximate natural logarithm of an array of values
+@param[in]  src     Source values
+@param[out] dst     Destination values
+
+Batch variant of @ref log(), with the same requirements and behavior as
+@ref rsqrtInto().
+*/
+MAGNUM_EXPORT void logInto(const Corrade::Containers::StridedArrayView<const Float>& src, const Corrade::Containers::StridedArrayView<Float>& dst);
+
+/**
+@brief Fast approximate arc tangent of an array of value pairs
+@param[in]  y       Source Y values
+@param[in]  x       Source X values
+@param[out] dst     Destination angles in radians
+
+Batch variant of @ref atan2(), with the same requirements and behavior as
+@ref rsqrtInto().
+*/
+MAGNUM_EXPORT void atan2Into(const Corrade::Containers::StridedArrayView<const Float>& y, const Corrade::Containers::StridedArrayView<const Float>& x, const Corrade::Containers::StridedArrayView<Float>& dst);
+
+}}}
+
+#endif
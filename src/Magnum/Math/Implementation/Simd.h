@@ -0,0 +1,123 @@
+#ifndef Magnum_Math_Implementation_Simd_h
+#define Magnum_Math_Implementation_Simd_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Thin wrappers over SSE2 / NEON / WebAssembly SIMD intrinsics used by the
+   Matrix4 and Quaternion specializations enabled with MAGNUM_BUILD_MATH_SIMD.
+   Only the handful of operations needed there. Three-component vectors are
+   stored with the last lane set to zero. */
+
+#include "Magnum/Types.h"
+
+#ifdef MAGNUM_BUILD_MATH_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define _MAGNUM_MATH_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define _MAGNUM_MATH_SIMD_NEON
+#include <arm_neon.h>
+/* Emscripten with -msimd128 */
+#elif defined(__wasm_simd128__)
+#define _MAGNUM_MATH_SIMD_WASM
+#include <wasm_simd128.h>
+#endif
+#endif
+
+#if defined(_MAGNUM_MATH_SIMD_SSE2) || defined(_MAGNUM_MATH_SIMD_NEON) || defined(_MAGNUM_MATH_SIMD_WASM)
+#define _MAGNUM_MATH_SIMD
+
+namespace Magnum { namespace Math { namespace Implementation {
+
+#ifdef _MAGNUM_MATH_SIMD_SSE2
+typedef __m128 Simd4f;
+
+inline Simd4f simdLoad(const Float* data) { return _mm_loadu_ps(data); }
+inline Simd4f simdLoad3(const Float* data) { return _mm_setr_ps(data[0], data[1], data[2], 0.0f); }
+inline void simdStore(Float* data, Simd4f a) { _mm_storeu_ps(data, a); }
+inline Simd4f simdSplat(Float value) { return _mm_set1_ps(value); }
+inline Simd4f simdAdd(Simd4f a, Simd4f b) { return _mm_add_ps(a, b); }
+inline Simd4f simdSub(Simd4f a, Simd4f b) { return _mm_sub_ps(a, b); }
+inline Simd4f simdMul(Simd4f a, Simd4f b) { return _mm_mul_ps(a, b); }
+inline Simd4f simdMulAdd(Simd4f a, Simd4f b, Simd4f c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+inline Simd4f simdYzxw(Simd4f a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1)); }
+inline Float simdDot(Simd4f a, Simd4f b) {
+    const __m128 m = _mm_mul_ps(a, b);
+    const __m128 s = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehl_ps(s, s)));
+}
+#elif defined(_MAGNUM_MATH_SIMD_NEON)
+typedef float32x4_t Simd4f;
+
+inline Simd4f simdLoad(const Float* data) { return vld1q_f32(data); }
+inline Simd4f simdLoad3(const Float* data) {
+    return vcombine_f32(vld1_f32(data), vset_lane_f32(data[2], vdup_n_f32(0.0f), 0));
+}
+inline void simdStore(Float* data, Simd4f a) { vst1q_f32(data, a); }
+inline Simd4f simdSplat(Float value) { return vdupq_n_f32(value); }
+inline Simd4f simdAdd(Simd4f a, Simd4f b) { return vaddq_f32(a, b); }
+inline Simd4f simdSub(Simd4f a, Simd4f b) { return vsubq_f32(a, b); }
+inline Simd4f simdMul(Simd4f a, Simd4f b) { return vmulq_f32(a, b); }
+inline Simd4f simdMulAdd(Simd4f a, Simd4f b, Simd4f c) { return vmlaq_f32(c, a, b); }
+inline Simd4f simdYzxw(Simd4f a) {
+    const float32x2_t xy = vget_low_f32(a);
+    const float32x2_t zw = vget_high_f32(a);
+    return vcombine_f32(vext_f32(xy, zw, 1), vset_lane_f32(vget_lane_f32(xy, 0), zw, 0));
+}
+inline Float simdDot(Simd4f a, Simd4f b) {
+    const float32x4_t m = vmulq_f32(a, b);
+    const float32x2_t s = vadd_f32(vget_low_f32(m), vget_high_f32(m));
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+}
+#elif defined(_MAGNUM_MATH_SIMD_WASM)
+typedef v128_t Simd4f;
+
+inline Simd4f simdLoad(const Float* data) { return wasm_v128_load(data); }
+inline Simd4f simdLoad3(const Float* data) { return wasm_f32x4_make(data[0], data[1], data[2], 0.0f); }
+inline void simdStore(Float* data, Simd4f a) { wasm_v128_store(data, a); }
+inline Simd4f simdSplat(Float value) { return wasm_f32x4_splat(value); }
+inline Simd4f simdAdd(Simd4f a, Simd4f b) { return wasm_f32x4_add(a, b); }
+inline Simd4f simdSub(Simd4f a, Simd4f b) { return wasm_f32x4_sub(a, b); }
+inline Simd4f simdMul(Simd4f a, Simd4f b) { return wasm_f32x4_mul(a, b); }
+/* There's no fused multiply-add in the base SIMD128 instruction set */
+inline Simd4f simdMulAdd(Simd4f a, Simd4f b, Simd4f c) { return wasm_f32x4_add(wasm_f32x4_mul(a, b), c); }
+inline Simd4f simdYzxw(Simd4f a) { return wasm_i32x4_shuffle(a, a, 1, 2, 0, 3); }
+inline Float simdDot(Simd4f a, Simd4f b) {
+    const v128_t m = wasm_f32x4_mul(a, b);
+    const v128_t s = wasm_f32x4_add(m, wasm_i32x4_shuffle(m, m, 1, 0, 3, 2));
+    return wasm_f32x4_extract_lane(wasm_f32x4_add(s, wasm_i32x4_shuffle(s, s, 2, 3, 0, 1)), 0);
+}
+#endif
+
+/* The last lane is always zero */
+inline Simd4f simdCross(Simd4f a, Simd4f b) {
+    return simdYzxw(simdSub(simdMul(a, simdYzxw(b)), simdMul(simdYzxw(a), b)));
+}
+
+}}}
+
+#endif
+
+#endif
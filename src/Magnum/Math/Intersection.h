@@ -30,6 +30,11 @@
  * @brief Namespace @ref Magnum::Math::Intersection
  */
 
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
 #include "Magnum/Math/Distance.h"
 #include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Range.h"
@@ -210,10 +215,60 @@ template<class T> bool aabbFrustum(const Vector3<T>& aabbCenter, const Vector3<T
 
 Checks for each plane of the frustum whether the sphere is behind the plane
 (the points distance larger than the sphere's radius) using
-@ref Distance::pointPlaneScaled().
+@ref Distance::pointPlaneScaled(). The planes don't need to be normalized, so
+the function can be used directly on a frustum created with
+@ref Frustum::fromMatrix().
 */
 template<class T> bool sphereFrustum(const Vector3<T>& sphereCenter, T sphereRadius, const Frustum<T>& frustum);
 
+/**
+@brief Intersection of a batch of ranges and a frustum
+@param ranges       Ranges
+@param frustum      Frustum planes with normals pointing outwards
+@param[out] visible Bit mask of results, expected to have at least
+    @cpp (ranges.size() + 7)/8 @ce bytes
+
+Batch variant of @ref rangeFrustum(const Range3D<T>&, const Frustum<T>&). Bit
+@cpp i % 8 @ce of byte @cpp i / 8 @ce of @p visible is set if the @p i-th
+range intersects the frustum, unused bits in the last byte are cleared. The
+input is processed in blocks of eight, which are transposed to a
+structure-of-arrays layout first so the compiler can vectorize the
+per-plane tests. Testing of a block stops once all its volumes are outside
+of some plane.
+@see @ref aabbFrustum(const Corrade::Containers::StridedArrayView<const Vector3<T>>&, const Corrade::Containers::StridedArrayView<const Vector3<T>>&, const Frustum<T>&, const Corrade::Containers::ArrayView<UnsignedByte>&)
+*/
+template<class T> void rangeFrustum(const Corrade::Containers::StridedArrayView<const Range3D<T>>& ranges, const Frustum<T>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& visible);
+
+/**
+@brief Intersection of a batch of axis-aligned boxes and a frustum
+@param aabbCenters  Box centers
+@param aabbExtents  (Half-)extents of the boxes, expected to have the same
+    size as @p aabbCenters
+@param frustum      Frustum planes with normals pointing outwards
+@param[out] visible Bit mask of results, expected to have at least
+    @cpp (aabbCenters.size() + 7)/8 @ce bytes
+
+Batch variant of @ref aabbFrustum(const Vector3<T>&, const Vector3<T>&, const Frustum<T>&),
+see @ref rangeFrustum(const Corrade::Containers::StridedArrayView<const Range3D<T>>&, const Frustum<T>&, const Corrade::Containers::ArrayView<UnsignedByte>&)
+for details about the output and the implementation.
+*/
+template<class T> void aabbFrustum(const Corrade::Containers::StridedArrayView<const Vector3<T>>& aabbCenters, const Corrade::Containers::StridedArrayView<const Vector3<T>>& aabbExtents, const Frustum<T>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& visible);
+
+/**
+@brief Intersection of a batch of spheres and a frustum
+@param sphereCenters Sphere centers
+@param sphereRadii  Sphere radii, expected to have the same size as
+    @p sphereCenters
+@param frustum      Frustum planes with normals pointing outwards
+@param[out] visible Bit mask of results, expected to have at least
+    @cpp (sphereCenters.size() + 7)/8 @ce bytes
+
+Batch variant of @ref sphereFrustum(const Vector3<T>&, T, const Frustum<T>&),
+see @ref rangeFrustum(const Corrade::Containers::StridedArrayView<const Range3D<T>>&, const Frustum<T>&, const Corrade::Containers::ArrayView<UnsignedByte>&)
+for details about the output and the implementation.
+*/
+template<class T> void sphereFrustum(const Corrade::Containers::StridedArrayView<const Vector3<T>>& sphereCenters, const Corrade::Containers::StridedArrayView<const T>& sphereRadii, const Frustum<T>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& visible);
+
 /**
 @brief Intersection of a point and a cone
 @param point        The point
@@ -475,14 +530,127 @@ template<class T> bool sphereFrustum(const Vector3<T>& sphereCenter, const T sph
 
     for(const Vector4<T>& plane: frustum.planes()) {
         /* The sphere is in front of one of the frustum planes (normals point
-           outwards) */
-        if(Distance::pointPlaneScaled<T>(sphereCenter, plane) < -radiusSq)
+           outwards). The scaled distance is multiplied by the plane normal
+           length, so compare squares to avoid normalizing the plane. */
+        const T distance = Distance::pointPlaneScaled<T>(sphereCenter, plane);
+        if(distance < T(0) && distance*distance > radiusSq*plane.xyz().dot())
             return false;
     }
 
     return true;
 }
 
+namespace Implementation {
+
+/* Tests a block of up to eight boxes in a structure-of-arrays layout. The
+   loops have a fixed size so the compiler can unroll and vectorize them. */
+template<class T> UnsignedByte aabbFrustumBlock(const T(&center)[3][8], const T(&extents)[3][8], const std::size_t count, const Frustum<T>& frustum) {
+    UnsignedByte mask = UnsignedByte(0xff >> (8 - count));
+    for(const Vector4<T>& plane: frustum.planes()) {
+        const Vector3<T> absPlaneNormal = Math::abs(plane.xyz());
+
+        UnsignedByte outside = 0;
+        for(std::size_t i = 0; i != 8; ++i) {
+            const T d = center[0][i]*plane.x() + center[1][i]*plane.y() + center[2][i]*plane.z();
+            const T r = extents[0][i]*absPlaneNormal.x() + extents[1][i]*absPlaneNormal.y() + extents[2][i]*absPlaneNormal.z();
+            outside |= UnsignedByte(d + r < -plane.w()) << i;
+        }
+
+        /* Stop once everything in the block is outside */
+        mask &= ~outside;
+        if(!mask) break;
+    }
+
+    return mask;
+}
+
+}
+
+template<class T> void rangeFrustum(const Corrade::Containers::StridedArrayView<const Range3D<T>>& ranges, const Frustum<T>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& visible) {
+    CORRADE_ASSERT(visible.size() >= (ranges.size() + 7)/8,
+        "Math::Intersection::rangeFrustum(): expected at least" << (ranges.size() + 7)/8 << "bytes for" << ranges.size() << "results but got" << visible.size(), );
+
+    for(std::size_t offset = 0; offset < ranges.size(); offset += 8) {
+        const std::size_t count = Math::min(ranges.size() - offset, std::size_t(8));
+
+        /* Transpose the block, converting to center/extents on the way */
+        T center[3][8]{};
+        T extents[3][8]{};
+        for(std::size_t i = 0; i != count; ++i) {
+            const Range3D<T>& range = ranges[offset + i];
+            for(std::size_t j = 0; j != 3; ++j) {
+                center[j][i] = (range.min()[j] + range.max()[j])*T(0.5);
+                extents[j][i] = (range.max()[j] - range.min()[j])*T(0.5);
+            }
+        }
+
+        visible[offset/8] = Implementation::aabbFrustumBlock(center, extents, count, frustum);
+    }
+}
+
+template<class T> void aabbFrustum(const Corrade::Containers::StridedArrayView<const Vector3<T>>& aabbCenters, const Corrade::Containers::StridedArrayView<const Vector3<T>>& aabbExtents, const Frustum<T>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& visible) {
+    CORRADE_ASSERT(aabbCenters.size() == aabbExtents.size(),
+        "Math::Intersection::aabbFrustum(): expected the same count of centers and extents, got" << aabbCenters.size() << "and" << aabbExtents.size(), );
+    CORRADE_ASSERT(visible.size() >= (aabbCenters.size() + 7)/8,
+        "Math::Intersection::aabbFrustum(): expected at least" << (aabbCenters.size() + 7)/8 << "bytes for" << aabbCenters.size() << "results but got" << visible.size(), );
+
+    for(std::size_t offset = 0; offset < aabbCenters.size(); offset += 8) {
+        const std::size_t count = Math::min(aabbCenters.size() - offset, std::size_t(8));
+
+        /* Transpose the block */
+        T center[3][8]{};
+        T extents[3][8]{};
+        for(std::size_t i = 0; i != count; ++i) {
+            const Vector3<T>& c = aabbCenters[offset + i];
+            const Vector3<T>& e = aabbExtents[offset + i];
+            for(std::size_t j = 0; j != 3; ++j) {
+                center[j][i] = c[j];
+                extents[j][i] = e[j];
+            }
+        }
+
+        visible[offset/8] = Implementation::aabbFrustumBlock(center, extents, count, frustum);
+    }
+}
+
+template<class T> void sphereFrustum(const Corrade::Containers::StridedArrayView<const Vector3<T>>& sphereCenters, const Corrade::Containers::StridedArrayView<const T>& sphereRadii, const Frustum<T>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& visible) {
+    CORRADE_ASSERT(sphereCenters.size() == sphereRadii.size(),
+        "Math::Intersection::sphereFrustum(): expected the same count of centers and radii, got" << sphereCenters.size() << "and" << sphereRadii.size(), );
+    CORRADE_ASSERT(visible.size() >= (sphereCenters.size() + 7)/8,
+        "Math::Intersection::sphereFrustum(): expected at least" << (sphereCenters.size() + 7)/8 << "bytes for" << sphereCenters.size() << "results but got" << visible.size(), );
+
+    for(std::size_t offset = 0; offset < sphereCenters.size(); offset += 8) {
+        const std::size_t count = Math::min(sphereCenters.size() - offset, std::size_t(8));
+
+        /* Transpose the block */
+        T center[3][8]{};
+        T radiusSq[8]{};
+        for(std::size_t i = 0; i != count; ++i) {
+            const Vector3<T>& c = sphereCenters[offset + i];
+            for(std::size_t j = 0; j != 3; ++j) center[j][i] = c[j];
+            radiusSq[i] = sphereRadii[offset + i]*sphereRadii[offset + i];
+        }
+
+        /* Same as the scalar variant, comparing squares to avoid normalizing
+           the planes */
+        UnsignedByte mask = UnsignedByte(0xff >> (8 - count));
+        for(const Vector4<T>& plane: frustum.planes()) {
+            const T normalLengthSq = plane.xyz().dot();
+
+            UnsignedByte outside = 0;
+            for(std::size_t i = 0; i != 8; ++i) {
+                const T d = center[0][i]*plane.x() + center[1][i]*plane.y() + center[2][i]*plane.z() + plane.w();
+                outside |= UnsignedByte(d < T(0) && d*d > radiusSq[i]*normalLengthSq) << i;
+            }
+
+            mask &= ~outside;
+            if(!mask) break;
+        }
+
+        visible[offset/8] = mask;
+    }
+}
+
 
 template<class T> bool pointCone(const Vector3<T>& point, const Vector3<T>& coneOrigin, const Vector3<T>& coneNormal, const Rad<T> coneAngle) {
     const T tanAngleSqPlusOne = Math::pow<2>(Math::tan(coneAngle*T(0.5))) + T(1);
@@ -101,4 +101,70 @@ UnsignedShort packHalf(const Float value) {
     return h;
 }
 
+namespace Implementation {
+
+/* Branchless variants of the above, producing the same results. All special
+   cases are calculated and then selected using bit masks, which the compiler
+   is able to turn into vector compares and blends. */
+
+void unpackHalfInto(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    constexpr const FloatBits Magic{113 << 23};
+    constexpr const UnsignedInt ShiftedExp = 0x7c00 << 13;
+
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt h = src[i];
+
+        FloatBits o;
+        o.u = (h & 0x7fff) << 13;
+        const UnsignedInt exp = ShiftedExp & o.u;
+        o.u += (127 - 15) << 23;
+
+        /* Inf/NaN */
+        const UnsignedInt infNan = o.u + ((128 - 16) << 23);
+        const UnsignedInt isInfNan = -UnsignedInt(exp == ShiftedExp);
+
+        /* Zero/Denormal */
+        FloatBits denormal;
+        denormal.u = o.u + (1 << 23);
+        denormal.f -= Magic.f;
+        const UnsignedInt isDenormal = -UnsignedInt(exp == 0);
+
+        o.u = (infNan & isInfNan)|(denormal.u & isDenormal)|(o.u & ~(isInfNan|isDenormal));
+        o.u |= (h & 0x8000) << 16;
+        dst[i] = o.f;
+    }
+}
+
+void packHalfInto(const Float* const src, UnsignedShort* const dst, const std::size_t count) {
+    constexpr const FloatBits FloatInfinity{255 << 23};
+    constexpr const FloatBits HalfInfinity{31 << 23};
+    constexpr const FloatBits Magic{15 << 23};
+    constexpr const UnsignedInt SignMask = 0x80000000u;
+    constexpr const UnsignedInt RoundMask = ~0xfffu;
+
+    for(std::size_t i = 0; i != count; ++i) {
+        FloatBits f;
+        f.f = src[i];
+
+        const UnsignedInt sign = f.u & SignMask;
+        f.u ^= sign;
+
+        /* Inf or NaN: NaN->qNaN and Inf->Inf */
+        const UnsignedInt infNan = 0x7c00|(0x0200 & -UnsignedInt(f.u > FloatInfinity.u));
+        const UnsignedInt isInfNan = -UnsignedInt(f.u >= FloatInfinity.u);
+
+        /* (De)normalized number or zero, clamped to infinity if overflowed */
+        FloatBits n;
+        n.u = f.u & RoundMask;
+        n.f *= Magic.f;
+        n.u -= RoundMask;
+        n.u = n.u < HalfInfinity.u ? n.u : HalfInfinity.u;
+
+        const UnsignedInt h = (infNan & isInfNan)|((n.u >> 13) & ~isInfNan);
+        dst[i] = UnsignedShort(h|(sign >> 16));
+    }
+}
+
+}
+
 }}
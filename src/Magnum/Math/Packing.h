@@ -26,9 +26,13 @@
 */
 
 /** @file
- * @brief Functions @ref Magnum::Math::pack(), @ref Magnum::Math::unpack(), @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf()
+ * @brief Functions @ref Magnum::Math::pack(), @ref Magnum::Math::unpack(), @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf(), @ref Magnum::Math::packInto(), @ref Magnum::Math::unpackInto(), @ref Magnum::Math::packHalfInto(), @ref Magnum::Math::unpackHalfInto()
  */
 
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
 #include "Magnum/Math/Functions.h"
 
 namespace Magnum { namespace Math {
@@ -39,6 +43,28 @@ template<class T, UnsignedInt bits = sizeof(T)*8> inline constexpr T bitMax() {
     return T(typename std::make_unsigned<T>::type(~T{}) >> (sizeof(T)*8 - (std::is_signed<T>::value ? bits - 1 : bits)));
 }
 
+/* Underlying component type and component count of a scalar or a vector type,
+   used by the batch packing functions */
+template<class T, class = void> struct PackingTraits {
+    typedef T Type;
+    enum: std::size_t { Size = 1 };
+};
+template<class T> struct PackingTraits<T, typename std::enable_if<!std::is_arithmetic<T>::value>::type> {
+    typedef typename T::Type Type;
+    enum: std::size_t { Size = T::Size };
+};
+template<> struct PackingTraits<Half> {
+    typedef Half Type;
+    enum: std::size_t { Size = 1 };
+};
+
+/* Half-float storage can be either raw UnsignedShort or the Half type, both
+   have the same layout */
+template<class T> struct IsHalfStorage: std::integral_constant<bool, std::is_same<T, UnsignedShort>::value || std::is_same<T, Half>::value> {};
+
+MAGNUM_EXPORT void packHalfInto(const Float* src, UnsignedShort* dst, std::size_t count);
+MAGNUM_EXPORT void unpackHalfInto(const UnsignedShort* src, Float* dst, std::size_t count);
+
 }
 
 #ifdef DOXYGEN_GENERATING_OUTPUT
@@ -189,6 +215,39 @@ template<class Integral, UnsignedInt bits, std::size_t size, class FloatingPoint
 }
 #endif
 
+/**
+@brief Unpack an array of integral values into a floating-point representation
+@param[in]  src     Source integral values
+@param[out] dst     Destination floating-point values
+
+Batch variant of @ref unpack(), converting whole attribute arrays in one call.
+Both the source and destination can be either scalars or vectors, their
+component count has to be the same. Expects that @p src and @p dst have the
+same size. If both views are contiguous, the conversion is done in a single
+flat loop over all components that the compiler is able to vectorize,
+otherwise each item is converted separately. Example usage:
+
+@code{.cpp}
+Containers::StridedArrayView<const Vector3ub> colors{...};
+std::vector<Vector3> out(colors.size());
+Math::unpackInto(colors, Containers::StridedArrayView<Vector3>{out.data(), out.size(), sizeof(Vector3)});
+@endcode
+
+@see @ref packInto(), @ref unpackHalfInto()
+*/
+template<class FloatingPoint, class Integral> void unpackInto(const Corrade::Containers::StridedArrayView<const Integral>& src, const Corrade::Containers::StridedArrayView<FloatingPoint>& dst);
+
+/**
+@brief Pack an array of floating-point values into integers
+@param[in]  src     Source floating-point values
+@param[out] dst     Destination integral values
+
+Batch variant of @ref pack(), with the same requirements and behavior as
+@ref unpackInto().
+@see @ref packHalfInto()
+*/
+template<class Integral, class FloatingPoint> void packInto(const Corrade::Containers::StridedArrayView<const FloatingPoint>& src, const Corrade::Containers::StridedArrayView<Integral>& dst);
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /** @brief @copybrief pack()
  * @deprecated Use @ref pack() instead.
@@ -241,6 +300,146 @@ template<std::size_t size> Vector<size, Float> unpackHalf(const Vector<size, Uns
     return out;
 }
 
+/**
+@brief Pack an array of 32-bit float values into 16-bit half-float representation
+@param[in]  src     Source float values
+@param[out] dst     Destination half-float values
+
+Batch variant of @ref packHalf(Float), giving the same results. Both the source
+and destination can be either scalars or vectors, their component count has to
+be the same. Expects that @p src and @p dst have the same size. If both views
+are contiguous, the conversion is done using a branchless variant of the
+algorithm that the compiler is able to vectorize, otherwise each item is
+converted separately.
+
+The destination components can be either @ref Magnum::UnsignedShort "UnsignedShort"
+or @ref Half, so it's possible to convert directly to e.g. half-float vertex
+normals:
+
+@code{.cpp}
+Containers::StridedArrayView<const Vector3> normals;
+Containers::Array<Vector3h> out{normals.size()};
+Math::packHalfInto(normals, Containers::StridedArrayView<Vector3h>{out.data(), out.size(), sizeof(Vector3h)});
+@endcode
+
+@see @ref unpackHalfInto(), @ref packInto()
+*/
+template<class T, class U> void packHalfInto(const Corrade::Containers::StridedArrayView<const T>& src, const Corrade::Containers::StridedArrayView<U>& dst);
+
+/**
+@brief Unpack an array of 16-bit half-float values into 32-bit float representation
+@param[in]  src     Source half-float values
+@param[out] dst     Destination float values
+
+Batch variant of @ref unpackHalf(UnsignedShort), with the same requirements
+and behavior as @ref packHalfInto(). The source components can be either
+@ref Magnum::UnsignedShort "UnsignedShort" or @ref Half.
+@see @ref unpackInto()
+*/
+template<class T, class U> void unpackHalfInto(const Corrade::Containers::StridedArrayView<const T>& src, const Corrade::Containers::StridedArrayView<U>& dst);
+
+template<class FloatingPoint, class Integral> void unpackInto(const Corrade::Containers::StridedArrayView<const Integral>& src, const Corrade::Containers::StridedArrayView<FloatingPoint>& dst) {
+    typedef Implementation::PackingTraits<Integral> In;
+    typedef Implementation::PackingTraits<FloatingPoint> Out;
+    static_assert(std::size_t(In::Size) == std::size_t(Out::Size),
+        "destination type should have the same component count as source type");
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackInto(): expected the same count of source and destination items, got" << src.size() << "and" << dst.size(), );
+    if(src.empty()) return;
+
+    /* Contiguous data, convert everything in a single flat loop */
+    if(std::size_t(src.stride()) == sizeof(Integral) && std::size_t(dst.stride()) == sizeof(FloatingPoint)) {
+        const auto* in = reinterpret_cast<const typename In::Type*>(&src[0]);
+        auto* out = reinterpret_cast<typename Out::Type*>(&dst[0]);
+        const std::size_t count = src.size()*In::Size;
+        for(std::size_t i = 0; i != count; ++i)
+            out[i] = unpack<typename Out::Type>(in[i]);
+        return;
+    }
+
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        const auto* in = reinterpret_cast<const typename In::Type*>(&src[i]);
+        auto* out = reinterpret_cast<typename Out::Type*>(&dst[i]);
+        for(std::size_t j = 0; j != In::Size; ++j)
+            out[j] = unpack<typename Out::Type>(in[j]);
+    }
+}
+
+template<class Integral, class FloatingPoint> void packInto(const Corrade::Containers::StridedArrayView<const FloatingPoint>& src, const Corrade::Containers::StridedArrayView<Integral>& dst) {
+    typedef Implementation::PackingTraits<FloatingPoint> In;
+    typedef Implementation::PackingTraits<Integral> Out;
+    static_assert(std::size_t(In::Size) == std::size_t(Out::Size),
+        "destination type should have the same component count as source type");
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::packInto(): expected the same count of source and destination items, got" << src.size() << "and" << dst.size(), );
+    if(src.empty()) return;
+
+    /* Contiguous data, convert everything in a single flat loop */
+    if(std::size_t(src.stride()) == sizeof(FloatingPoint) && std::size_t(dst.stride()) == sizeof(Integral)) {
+        const auto* in = reinterpret_cast<const typename In::Type*>(&src[0]);
+        auto* out = reinterpret_cast<typename Out::Type*>(&dst[0]);
+        const std::size_t count = src.size()*In::Size;
+        for(std::size_t i = 0; i != count; ++i)
+            out[i] = pack<typename Out::Type>(in[i]);
+        return;
+    }
+
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        const auto* in = reinterpret_cast<const typename In::Type*>(&src[i]);
+        auto* out = reinterpret_cast<typename Out::Type*>(&dst[i]);
+        for(std::size_t j = 0; j != In::Size; ++j)
+            out[j] = pack<typename Out::Type>(in[j]);
+    }
+}
+
+template<class T, class U> void packHalfInto(const Corrade::Containers::StridedArrayView<const T>& src, const Corrade::Containers::StridedArrayView<U>& dst) {
+    typedef Implementation::PackingTraits<T> In;
+    typedef Implementation::PackingTraits<U> Out;
+    static_assert(std::is_same<typename In::Type, Float>::value && Implementation::IsHalfStorage<typename Out::Type>::value,
+        "half packing must be done from Float to UnsignedShort or Half components");
+    static_assert(std::size_t(In::Size) == std::size_t(Out::Size),
+        "destination type should have the same component count as source type");
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::packHalfInto(): expected the same count of source and destination items, got" << src.size() << "and" << dst.size(), );
+    if(src.empty()) return;
+
+    if(std::size_t(src.stride()) == sizeof(T) && std::size_t(dst.stride()) == sizeof(U)) {
+        Implementation::packHalfInto(reinterpret_cast<const Float*>(&src[0]), reinterpret_cast<UnsignedShort*>(&dst[0]), src.size()*In::Size);
+        return;
+    }
+
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        const auto* in = reinterpret_cast<const Float*>(&src[i]);
+        auto* out = reinterpret_cast<UnsignedShort*>(&dst[i]);
+        for(std::size_t j = 0; j != In::Size; ++j)
+            out[j] = packHalf(in[j]);
+    }
+}
+
+template<class T, class U> void unpackHalfInto(const Corrade::Containers::StridedArrayView<const T>& src, const Corrade::Containers::StridedArrayView<U>& dst) {
+    typedef Implementation::PackingTraits<T> In;
+    typedef Implementation::PackingTraits<U> Out;
+    static_assert(Implementation::IsHalfStorage<typename In::Type>::value && std::is_same<typename Out::Type, Float>::value,
+        "half unpacking must be done from UnsignedShort or Half to Float components");
+    static_assert(std::size_t(In::Size) == std::size_t(Out::Size),
+        "destination type should have the same component count as source type");
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackHalfInto(): expected the same count of source and destination items, got" << src.size() << "and" << dst.size(), );
+    if(src.empty()) return;
+
+    if(std::size_t(src.stride()) == sizeof(T) && std::size_t(dst.stride()) == sizeof(U)) {
+        Implementation::unpackHalfInto(reinterpret_cast<const UnsignedShort*>(&src[0]), reinterpret_cast<Float*>(&dst[0]), src.size()*In::Size);
+        return;
+    }
+
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        const auto* in = reinterpret_cast<const UnsignedShort*>(&src[i]);
+        auto* out = reinterpret_cast<Float*>(&dst[i]);
+        for(std::size_t j = 0; j != In::Size; ++j)
+            out[j] = unpackHalf(in[j]);
+    }
+}
+
 }}
 
 #endif
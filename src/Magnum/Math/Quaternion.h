@@ -60,6 +60,14 @@ namespace Implementation {
     template<class T> inline T angle(const Quaternion<T>& normalizedA, const Quaternion<T>& normalizedB) {
         return std::acos(dot(normalizedA, normalizedB));
     }
+
+    /* Used in slerp() and slerpShortestPath(), specialized for floats if
+       MAGNUM_BUILD_MATH_SIMD is enabled */
+    template<class T> struct QuaternionWeightedSum {
+        Quaternion<T> operator()(const Quaternion<T>& a, T weightA, const Quaternion<T>& b, T weightB) const {
+            return weightA*a + weightB*b;
+        }
+    };
 }
 
 /** @relatesalso Quaternion
@@ -172,7 +180,8 @@ template<class T> inline Quaternion<T> slerp(const Quaternion<T>& normalizedA, c
         return normalizedA;
 
     const T a = std::acos(cosHalfAngle);
-    return (std::sin((T(1) - t)*a)*normalizedA + std::sin(t*a)*normalizedB)/std::sin(a);
+    const T sinA = std::sin(a);
+    return Implementation::QuaternionWeightedSum<T>{}(normalizedA, std::sin((T(1) - t)*a)/sinA, normalizedB, std::sin(t*a)/sinA);
 }
 
 /** @relatesalso Quaternion
@@ -217,10 +226,12 @@ template<class T> inline Quaternion<T> slerpShortestPath(const Quaternion<T>& no
     if(std::abs(cosHalfAngle) >= T(1) - TypeTraits<T>::epsilon())
         return normalizedA;
 
-    const Quaternion<T> shortestNormalizedA = cosHalfAngle < 0 ? -normalizedA : normalizedA;
-
+    /* Negating the first quaternion for the shortest path is folded into
+       its weight */
     const T a = std::acos(std::abs(cosHalfAngle));
-    return (std::sin((T(1) - t)*a)*shortestNormalizedA + std::sin(t*a)*normalizedB)/std::sin(a);
+    const T sinA = std::sin(a);
+    const T weightA = std::sin((T(1) - t)*a)/sinA;
+    return Implementation::QuaternionWeightedSum<T>{}(normalizedA, cosHalfAngle < 0 ? -weightA : weightA, normalizedB, std::sin(t*a)/sinA);
 }
 
 /**
@@ -714,6 +725,33 @@ template<class T> inline Quaternion<T> Quaternion<T>::operator*(const Quaternion
             _scalar*other._scalar - Math::dot(_vector, other._vector)};
 }
 
+#ifdef _MAGNUM_MATH_SIMD
+template<> inline Quaternion<Float> Quaternion<Float>::operator*(const Quaternion<Float>& other) const {
+    const Implementation::Simd4f a = Implementation::simdLoad3(_vector.data());
+    const Implementation::Simd4f b = Implementation::simdLoad3(other._vector.data());
+
+    Float vector[4];
+    Implementation::simdStore(vector, Implementation::simdAdd(
+        Implementation::simdMulAdd(Implementation::simdSplat(_scalar), b, Implementation::simdMul(Implementation::simdSplat(other._scalar), a)),
+        Implementation::simdCross(a, b)));
+    return {{vector[0], vector[1], vector[2]},
+            _scalar*other._scalar - Implementation::simdDot(a, b)};
+}
+
+namespace Implementation {
+
+template<> struct QuaternionWeightedSum<Float> {
+    Quaternion<Float> operator()(const Quaternion<Float>& a, Float weightA, const Quaternion<Float>& b, Float weightB) const {
+        Float vector[4];
+        simdStore(vector, simdMulAdd(simdLoad3(a.vector().data()), simdSplat(weightA), simdMul(simdLoad3(b.vector().data()), simdSplat(weightB))));
+        return {{vector[0], vector[1], vector[2]},
+                weightA*a.scalar() + weightB*b.scalar()};
+    }
+};
+
+}
+#endif
+
 template<class T> inline Quaternion<T> Quaternion<T>::invertedNormalized() const {
     CORRADE_ASSERT(isNormalized(), "Math::Quaternion::invertedNormalized(): quaternion must be normalized", {});
     return conjugated();
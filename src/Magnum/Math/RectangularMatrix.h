@@ -30,6 +30,7 @@
  */
 
 #include "Magnum/Math/Vector.h"
+#include "Magnum/Math/Implementation/Simd.h"
 
 namespace Magnum { namespace Math {
 
@@ -731,15 +732,49 @@ template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<c
     return out;
 }
 
-template<std::size_t cols, std::size_t rows, class T> template<std::size_t size> inline RectangularMatrix<size, rows, T> RectangularMatrix<cols, rows, T>::operator*(const RectangularMatrix<size, cols, T>& other) const {
-    RectangularMatrix<size, rows, T> out{ZeroInit};
+namespace Implementation {
 
-    for(std::size_t col = 0; col != size; ++col)
-        for(std::size_t row = 0; row != rows; ++row)
-            for(std::size_t pos = 0; pos != cols; ++pos)
-                out[col][row] += _data[pos][row]*other._data[col][pos];
+template<std::size_t cols, std::size_t rows, std::size_t size, class T> struct MatrixMultiplication {
+    RectangularMatrix<size, rows, T> operator()(const RectangularMatrix<cols, rows, T>& a, const RectangularMatrix<size, cols, T>& b) const {
+        RectangularMatrix<size, rows, T> out{ZeroInit};
 
-    return out;
+        for(std::size_t col = 0; col != size; ++col)
+            for(std::size_t row = 0; row != rows; ++row)
+                for(std::size_t pos = 0; pos != cols; ++pos)
+                    out[col][row] += a[pos][row]*b[col][pos];
+
+        return out;
+    }
+};
+
+#ifdef _MAGNUM_MATH_SIMD
+/* Four-by-four float matrix times a matrix or a vector, each output column
+   is a linear combination of the four input columns */
+template<std::size_t size> struct MatrixMultiplication<4, 4, size, Float> {
+    RectangularMatrix<size, 4, Float> operator()(const RectangularMatrix<4, 4, Float>& a, const RectangularMatrix<size, 4, Float>& b) const {
+        const Simd4f a0 = simdLoad(a[0].data());
+        const Simd4f a1 = simdLoad(a[1].data());
+        const Simd4f a2 = simdLoad(a[2].data());
+        const Simd4f a3 = simdLoad(a[3].data());
+
+        RectangularMatrix<size, 4, Float> out{NoInit};
+        for(std::size_t col = 0; col != size; ++col) {
+            Simd4f c = simdMul(a0, simdSplat(b[col][0]));
+            c = simdMulAdd(a1, simdSplat(b[col][1]), c);
+            c = simdMulAdd(a2, simdSplat(b[col][2]), c);
+            c = simdMulAdd(a3, simdSplat(b[col][3]), c);
+            simdStore(out[col].data(), c);
+        }
+
+        return out;
+    }
+};
+#endif
+
+}
+
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t size> inline RectangularMatrix<size, rows, T> RectangularMatrix<cols, rows, T>::operator*(const RectangularMatrix<size, cols, T>& other) const {
+    return Implementation::MatrixMultiplication<cols, rows, size, T>{}(*this, other);
 }
 
 template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<rows, cols, T> RectangularMatrix<cols, rows, T>::transposed() const {
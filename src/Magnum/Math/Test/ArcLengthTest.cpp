@@ -0,0 +1,207 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2016 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/ArcLength.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct ArcLengthTest: Corrade::TestSuite::Tester {
+    explicit ArcLengthTest();
+
+    void lengthsBezierLinear();
+    void lengthsBezierCubic();
+    void lengthsCubicHermite();
+    void lengthsTooSmall();
+
+    void parameter();
+    void parameterZeroLengthSegment();
+    void parameterTooSmall();
+    void parametersInto();
+    void parametersIntoInvalidSize();
+    void constantSpeed();
+};
+
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Bezier<1, 2, Float> LinearBezier2D;
+typedef Math::CubicBezier2D<Float> CubicBezier2D;
+typedef Math::CubicHermite2D<Float> CubicHermite2D;
+typedef Math::Constants<Float> Constants;
+
+ArcLengthTest::ArcLengthTest() {
+    addTests({&ArcLengthTest::lengthsBezierLinear,
+              &ArcLengthTest::lengthsBezierCubic,
+              &ArcLengthTest::lengthsCubicHermite,
+              &ArcLengthTest::lengthsTooSmall,
+
+              &ArcLengthTest::parameter,
+              &ArcLengthTest::parameterZeroLengthSegment,
+              &ArcLengthTest::parameterTooSmall,
+              &ArcLengthTest::parametersInto,
+              &ArcLengthTest::parametersIntoInvalidSize,
+              &ArcLengthTest::constantSpeed});
+}
+
+void ArcLengthTest::lengthsBezierLinear() {
+    LinearBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{3.0f, 4.0f}};
+
+    Float lengths[5];
+    arcLengthsInto(bezier, Corrade::Containers::StridedArrayView<Float>{lengths, 5, sizeof(Float)});
+    CORRADE_COMPARE(lengths[0], 0.0f);
+    CORRADE_COMPARE(lengths[1], 1.25f);
+    CORRADE_COMPARE(lengths[2], 2.5f);
+    CORRADE_COMPARE(lengths[3], 3.75f);
+    CORRADE_COMPARE(lengths[4], 5.0f);
+}
+
+void ArcLengthTest::lengthsBezierCubic() {
+    /* Common approximation of a unit quarter-circle, more than one block of
+       eight samples */
+    const Float k = 0.5522847498f;
+    CubicBezier2D bezier{Vector2{1.0f, 0.0f}, Vector2{1.0f, k}, Vector2{k, 1.0f}, Vector2{0.0f, 1.0f}};
+
+    Float lengths[257];
+    arcLengthsInto(bezier, Corrade::Containers::StridedArrayView<Float>{lengths, 257, sizeof(Float)});
+    CORRADE_COMPARE(lengths[0], 0.0f);
+    for(std::size_t i = 1; i != 257; ++i)
+        CORRADE_VERIFY(lengths[i] > lengths[i - 1]);
+
+    /* Symmetric curve, so half the length is in the middle */
+    CORRADE_VERIFY(std::abs(lengths[128] - lengths[256]*0.5f) < 1.0e-5f);
+    CORRADE_VERIFY(std::abs(lengths[256] - Constants::piHalf()) < 1.0e-3f);
+}
+
+void ArcLengthTest::lengthsCubicHermite() {
+    /* Tangents equal to the chord make the segment a uniform line */
+    CubicHermite2D a{Vector2{}, Vector2{0.0f, 0.0f}, Vector2{0.0f, 6.0f}};
+    CubicHermite2D b{Vector2{0.0f, 6.0f}, Vector2{0.0f, 6.0f}, Vector2{}};
+
+    Float lengths[13];
+    arcLengthsInto(a, b, Corrade::Containers::StridedArrayView<Float>{lengths, 13, sizeof(Float)});
+    for(std::size_t i = 0; i != 13; ++i)
+        CORRADE_COMPARE(lengths[i], i*0.5f);
+}
+
+void ArcLengthTest::lengthsTooSmall() {
+    LinearBezier2D bezier;
+    CubicHermite2D a, b;
+    Float lengths[1];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    arcLengthsInto(bezier, Corrade::Containers::StridedArrayView<Float>{lengths, 1, sizeof(Float)});
+    arcLengthsInto(a, b, Corrade::Containers::StridedArrayView<Float>{lengths, 1, sizeof(Float)});
+    CORRADE_COMPARE(out.str(),
+        "Math::arcLengthsInto(): expected at least two items, got 1\n"
+        "Math::arcLengthsInto(): expected at least two items, got 1\n");
+}
+
+void ArcLengthTest::parameter() {
+    const Float lengths[]{0.0f, 1.0f, 3.0f, 6.0f};
+    Corrade::Containers::StridedArrayView<const Float> view{lengths, 4, sizeof(Float)};
+
+    CORRADE_COMPARE(arcLengthParameter(view, 0.0f), 0.0f);
+    CORRADE_COMPARE(arcLengthParameter(view, 1.0f), 1.0f/3.0f);
+    CORRADE_COMPARE(arcLengthParameter(view, 2.0f), 0.5f);
+    CORRADE_COMPARE(arcLengthParameter(view, 4.5f), 2.5f/3.0f);
+    CORRADE_COMPARE(arcLengthParameter(view, 6.0f), 1.0f);
+
+    /* Clamped */
+    CORRADE_COMPARE(arcLengthParameter(view, -1.0f), 0.0f);
+    CORRADE_COMPARE(arcLengthParameter(view, 10.0f), 1.0f);
+}
+
+void ArcLengthTest::parameterZeroLengthSegment() {
+    /* A stationary part of the curve shouldn't result in a division by
+       zero */
+    const Float lengths[]{0.0f, 2.0f, 2.0f, 4.0f};
+    Corrade::Containers::StridedArrayView<const Float> view{lengths, 4, sizeof(Float)};
+
+    CORRADE_COMPARE(arcLengthParameter(view, 2.0f), 1.0f/3.0f);
+    CORRADE_COMPARE(arcLengthParameter(view, 3.0f), 2.5f/3.0f);
+}
+
+void ArcLengthTest::parameterTooSmall() {
+    const Float lengths[]{0.0f};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    arcLengthParameter(Corrade::Containers::StridedArrayView<const Float>{lengths, 1, sizeof(Float)}, 0.5f);
+    CORRADE_COMPARE(out.str(), "Math::arcLengthParameter(): expected at least two items, got 1\n");
+}
+
+void ArcLengthTest::parametersInto() {
+    const Float lengths[]{0.0f, 1.0f, 3.0f, 6.0f};
+    const Float distances[]{-1.0f, 2.0f, 4.5f, 7.0f};
+    Float out[4];
+    arcLengthParametersInto(
+        Corrade::Containers::StridedArrayView<const Float>{lengths, 4, sizeof(Float)},
+        Corrade::Containers::StridedArrayView<const Float>{distances, 4, sizeof(Float)},
+        Corrade::Containers::StridedArrayView<Float>{out, 4, sizeof(Float)});
+
+    CORRADE_COMPARE(out[0], 0.0f);
+    CORRADE_COMPARE(out[1], 0.5f);
+    CORRADE_COMPARE(out[2], 2.5f/3.0f);
+    CORRADE_COMPARE(out[3], 1.0f);
+}
+
+void ArcLengthTest::parametersIntoInvalidSize() {
+    const Float lengths[]{0.0f, 1.0f};
+    const Float distances[3]{};
+    Float factors[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    arcLengthParametersInto(
+        Corrade::Containers::StridedArrayView<const Float>{lengths, 2, sizeof(Float)},
+        Corrade::Containers::StridedArrayView<const Float>{distances, 3, sizeof(Float)},
+        Corrade::Containers::StridedArrayView<Float>{factors, 2, sizeof(Float)});
+    CORRADE_COMPARE(out.str(), "Math::arcLengthParametersInto(): expected the same count of distances and output factors, got 3 and 2\n");
+}
+
+void ArcLengthTest::constantSpeed() {
+    /* Control points bunched at the start, so uniform factors move slowly
+       there and fast near the end */
+    CubicBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{0.1f, 0.0f}, Vector2{0.2f, 0.0f}, Vector2{10.0f, 0.0f}};
+
+    Float lengths[129];
+    arcLengthsInto(bezier, Corrade::Containers::StridedArrayView<Float>{lengths, 129, sizeof(Float)});
+    Corrade::Containers::StridedArrayView<const Float> view{lengths, 129, sizeof(Float)};
+
+    /* Points at equal distances should be equally spaced along the curve */
+    for(Float distance: {1.0f, 2.5f, 5.0f, 9.0f}) {
+        const Float t = arcLengthParameter(view, distance);
+        CORRADE_VERIFY(std::abs(bezier.value(t).x() - distance) < 1.0e-2f);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::ArcLengthTest)
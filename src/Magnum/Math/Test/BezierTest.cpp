@@ -84,6 +84,9 @@ struct BezierTest: Corrade::TestSuite::Tester {
     void subdivideLinear();
     void subdivideQuadratic();
     void subdivideCubic();
+    void valueInto();
+    void valueIntoStrided();
+    void valueIntoInvalidSize();
 
     void debug();
     void configuration();
@@ -108,6 +111,9 @@ BezierTest::BezierTest() {
               &BezierTest::subdivideLinear,
               &BezierTest::subdivideQuadratic,
               &BezierTest::subdivideCubic,
+              &BezierTest::valueInto,
+              &BezierTest::valueIntoStrided,
+              &BezierTest::valueIntoInvalidSize,
 
               &BezierTest::debug,
               &BezierTest::configuration});
@@ -304,6 +310,49 @@ void BezierTest::subdivideCubic() {
     CORRADE_COMPARE(right, (CubicBezier2D{Vector2{7.10938f, 6.57812f}, Vector2{13.4375f, 8.6875f}, Vector2{16.25f, -2.0f}, Vector2{5.0f, -20.0f}}));
 }
 
+void BezierTest::valueInto() {
+    CubicBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}, Vector2{5.0f, -20.0f}};
+
+    /* More than one block of eight to test the remainder handling as well */
+    Float t[11];
+    for(std::size_t i = 0; i != 11; ++i) t[i] = i*0.1f;
+    Vector2 out[11];
+    bezier.valueInto(Corrade::Containers::StridedArrayView<const Float>{t, 11, sizeof(Float)}, Corrade::Containers::StridedArrayView<Vector2>{out, 11, sizeof(Vector2)});
+
+    for(std::size_t i = 0; i != 11; ++i)
+        CORRADE_COMPARE(out[i], bezier.value(t[i]));
+    CORRADE_COMPARE(out[2], (Vector2{5.8f, 5.984f}));
+    CORRADE_COMPARE(out[5], (Vector2{11.875f, 4.625f}));
+    CORRADE_COMPARE(out[10], (Vector2{5.0f, -20.0f}));
+}
+
+void BezierTest::valueIntoStrided() {
+    QuadraticBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}};
+
+    struct {
+        Float t;
+        Vector2 point;
+    } data[3]{{0.0f, {}}, {0.2f, {}}, {0.5f, {}}};
+    bezier.valueInto(
+        Corrade::Containers::StridedArrayView<const Float>{&data[0].t, 3, sizeof(data[0])},
+        Corrade::Containers::StridedArrayView<Vector2>{&data[0].point, 3, sizeof(data[0])});
+
+    CORRADE_COMPARE(data[0].point, (Vector2{0.0f, 0.0f}));
+    CORRADE_COMPARE(data[1].point, (Vector2{4.0f, 4.96f}));
+    CORRADE_COMPARE(data[2].point, (Vector2{10.0f, 8.5f}));
+}
+
+void BezierTest::valueIntoInvalidSize() {
+    CubicBezier2D bezier;
+    Float t[3]{};
+    Vector2 points[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    bezier.valueInto(Corrade::Containers::StridedArrayView<const Float>{t, 3, sizeof(Float)}, Corrade::Containers::StridedArrayView<Vector2>{points, 2, sizeof(Vector2)});
+    CORRADE_COMPARE(out.str(), "Math::Bezier::valueInto(): expected the same count of factors and output points, got 3 and 2\n");
+}
+
 void BezierTest::debug() {
     std::ostringstream out;
     Debug(&out) << CubicBezier2D{Vector2{0.0f, 1.0f}, Vector2{1.5f, -0.3f}, Vector2{2.1f, 0.5f}, Vector2{0.0f, 2.0f}};
@@ -107,6 +107,9 @@ struct CubicHermiteTest: Corrade::TestSuite::Tester {
     void splerpScalar();
     void splerpVector();
     void splerpVectorFromBezier();
+    void splerpIntoScalar();
+    void splerpIntoVector();
+    void splerpIntoInvalidSize();
     void splerpComplex();
     void splerpComplexNotNormalized();
     void splerpQuaternion();
@@ -190,6 +193,9 @@ CubicHermiteTest::CubicHermiteTest() {
               &CubicHermiteTest::splerpScalar,
               &CubicHermiteTest::splerpVector,
               &CubicHermiteTest::splerpVectorFromBezier,
+              &CubicHermiteTest::splerpIntoScalar,
+              &CubicHermiteTest::splerpIntoVector,
+              &CubicHermiteTest::splerpIntoInvalidSize,
               &CubicHermiteTest::splerpComplex,
               &CubicHermiteTest::splerpComplexNotNormalized,
               &CubicHermiteTest::splerpQuaternion,
@@ -1041,6 +1047,49 @@ void CubicHermiteTest::splerpVectorFromBezier() {
     CORRADE_COMPARE(Math::splerp(a, b, 1.0f), (Vector2{5.0f, -20.0f}));
 }
 
+void CubicHermiteTest::splerpIntoScalar() {
+    CubicHermite1D a{2.0f, 3.0f, -1.0f};
+    CubicHermite1D b{5.0f, -2.0f, 1.5f};
+
+    Float t[3]{0.0f, 0.35f, 1.0f};
+    Float out[3];
+    Math::splerpInto(a, b, Corrade::Containers::StridedArrayView<const Float>{t, 3, sizeof(Float)}, Corrade::Containers::StridedArrayView<Float>{out, 3, sizeof(Float)});
+
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(out[i], Math::splerp(a, b, t[i]));
+}
+
+void CubicHermiteTest::splerpIntoVector() {
+    CubicHermite2D a{{2.0f, 1.5f}, {3.0f, 0.1f}, {-1.0f, 0.0f}};
+    CubicHermite2D b{{5.0f, 0.3f}, {-2.0f, 1.1f}, {1.5f, 0.3f}};
+
+    /* More than one block of eight to test the remainder handling as well */
+    Float t[13];
+    for(std::size_t i = 0; i != 13; ++i) t[i] = i/12.0f;
+    t[4] = 0.35f;
+    t[9] = 0.8f;
+    Vector2 out[13];
+    Math::splerpInto(a, b, Corrade::Containers::StridedArrayView<const Float>{t, 13, sizeof(Float)}, Corrade::Containers::StridedArrayView<Vector2>{out, 13, sizeof(Vector2)});
+
+    for(std::size_t i = 0; i != 13; ++i)
+        CORRADE_COMPARE(out[i], Math::splerp(a, b, t[i]));
+    CORRADE_COMPARE(out[0], a.point());
+    CORRADE_COMPARE(out[4], (Vector2{1.04525f, 0.357862f}));
+    CORRADE_COMPARE(out[9], (Vector2{-2.152f, 0.9576f}));
+    CORRADE_COMPARE(out[12], b.point());
+}
+
+void CubicHermiteTest::splerpIntoInvalidSize() {
+    CubicHermite2D a, b;
+    Float t[2]{};
+    Vector2 points[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Math::splerpInto(a, b, Corrade::Containers::StridedArrayView<const Float>{t, 2, sizeof(Float)}, Corrade::Containers::StridedArrayView<Vector2>{points, 3, sizeof(Vector2)});
+    CORRADE_COMPARE(out.str(), "Math::splerpInto(): expected the same count of phases and output values, got 2 and 3\n");
+}
+
 void CubicHermiteTest::splerpComplex() {
     CubicHermiteComplex a{{2.0f, 1.5f}, {0.999445f, 0.0333148f}, {-1.0f, 0.0f}};
     CubicHermiteComplex b{{5.0f, 0.3f}, {-0.876216f, 0.481919f}, {1.5f, 0.3f}};
@@ -0,0 +1,154 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Fast.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+namespace {
+    constexpr std::size_t Size = 4096;
+}
+
+/* Compares the Math::Fast batch functions with a plain loop over the
+   corresponding standard library function */
+struct FastBenchmark: Corrade::TestSuite::Tester {
+    explicit FastBenchmark();
+
+    void rsqrtStd();
+    void rsqrtFast();
+    void sincosStd();
+    void sincosFast();
+    void expStd();
+    void expFast();
+    void logStd();
+    void logFast();
+    void atan2Std();
+    void atan2Fast();
+
+    private:
+        Float _a[Size], _b[Size], _c[Size], _d[Size];
+};
+
+FastBenchmark::FastBenchmark() {
+    addBenchmarks({&FastBenchmark::rsqrtStd,
+                   &FastBenchmark::rsqrtFast,
+                   &FastBenchmark::sincosStd,
+                   &FastBenchmark::sincosFast,
+                   &FastBenchmark::expStd,
+                   &FastBenchmark::expFast,
+                   &FastBenchmark::logStd,
+                   &FastBenchmark::logFast,
+                   &FastBenchmark::atan2Std,
+                   &FastBenchmark::atan2Fast}, 100);
+
+    for(std::size_t i = 0; i != Size; ++i) {
+        _a[i] = 0.01f + i*0.01f;
+        _b[i] = 1.0f - i*0.0005f;
+    }
+}
+
+void FastBenchmark::rsqrtStd() {
+    CORRADE_BENCHMARK(10)
+        for(std::size_t i = 0; i != Size; ++i)
+            _c[i] = 1.0f/std::sqrt(_a[i]);
+
+    CORRADE_VERIFY(_c[Size - 1] > 0.0f);
+}
+
+void FastBenchmark::rsqrtFast() {
+    CORRADE_BENCHMARK(10)
+        Fast::rsqrtInto({_a, Size, sizeof(Float)}, {_c, Size, sizeof(Float)});
+
+    CORRADE_VERIFY(_c[Size - 1] > 0.0f);
+}
+
+void FastBenchmark::sincosStd() {
+    CORRADE_BENCHMARK(10)
+        for(std::size_t i = 0; i != Size; ++i) {
+            _c[i] = std::sin(_a[i]);
+            _d[i] = std::cos(_a[i]);
+        }
+
+    CORRADE_VERIFY(_c[Size - 1] != _d[Size - 1]);
+}
+
+void FastBenchmark::sincosFast() {
+    CORRADE_BENCHMARK(10)
+        Fast::sincosInto({_a, Size, sizeof(Float)}, {_c, Size, sizeof(Float)}, {_d, Size, sizeof(Float)});
+
+    CORRADE_VERIFY(_c[Size - 1] != _d[Size - 1]);
+}
+
+void FastBenchmark::expStd() {
+    CORRADE_BENCHMARK(10)
+        for(std::size_t i = 0; i != Size; ++i)
+            _c[i] = std::exp(_b[i]);
+
+    CORRADE_VERIFY(_c[Size - 1] > 0.0f);
+}
+
+void FastBenchmark::expFast() {
+    CORRADE_BENCHMARK(10)
+        Fast::expInto({_b, Size, sizeof(Float)}, {_c, Size, sizeof(Float)});
+
+    CORRADE_VERIFY(_c[Size - 1] > 0.0f);
+}
+
+void FastBenchmark::logStd() {
+    CORRADE_BENCHMARK(10)
+        for(std::size_t i = 0; i != Size; ++i)
+            _c[i] = std::log(_a[i]);
+
+    CORRADE_VERIFY(_c[Size - 1] > 0.0f);
+}
+
+void FastBenchmark::logFast() {
+    CORRADE_BENCHMARK(10)
+        Fast::logInto({_a, Size, sizeof(Float)}, {_c, Size, sizeof(Float)});
+
+    CORRADE_VERIFY(_c[Size - 1] > 0.0f);
+}
+
+void FastBenchmark::atan2Std() {
+    CORRADE_BENCHMARK(10)
+        for(std::size_t i = 0; i != Size; ++i)
+            _c[i] = std::atan2(_b[i], _a[i]);
+
+    CORRADE_VERIFY(_c[Size - 1] < 0.0f);
+}
+
+void FastBenchmark::atan2Fast() {
+    CORRADE_BENCHMARK(10)
+        Fast::atan2Into({_b, Size, sizeof(Float)}, {_a, Size, sizeof(Float)}, {_c, Size, sizeof(Float)});
+
+    CORRADE_VERIFY(_c[Size - 1] < 0.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FastBenchmark)
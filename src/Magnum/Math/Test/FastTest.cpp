@@ -0,0 +1,240 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Fast.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct FastTest: Corrade::TestSuite::Tester {
+    explicit FastTest();
+
+    void rsqrt();
+    void normalized();
+    void sincos();
+    void exp();
+    void log();
+    void atan2();
+
+    void rsqrtInto();
+    void rsqrtIntoStrided();
+    void sincosInto();
+    void expLogInto();
+    void atan2Into();
+    void intoInvalidSize();
+};
+
+typedef Math::Vector<3, Float> Vector3;
+typedef Math::Vector<4, Float> Vector4;
+typedef Math::Rad<Float> Rad;
+
+FastTest::FastTest() {
+    addTests({&FastTest::rsqrt,
+              &FastTest::normalized,
+              &FastTest::sincos,
+              &FastTest::exp,
+              &FastTest::log,
+              &FastTest::atan2,
+
+              &FastTest::rsqrtInto,
+              &FastTest::rsqrtIntoStrided,
+              &FastTest::sincosInto,
+              &FastTest::expLogInto,
+              &FastTest::atan2Into,
+              &FastTest::intoInvalidSize});
+}
+
+void FastTest::rsqrt() {
+    /* Check the documented relative error bound over a wide range */
+    Float maxError = 0.0f;
+    for(Float v = 1.0e-30f; v < 1.0e30f; v *= 1.001f)
+        maxError = Math::max(maxError, std::abs(Fast::rsqrt(v)*std::sqrt(v) - 1.0f));
+    CORRADE_VERIFY(maxError < 1.8e-3f);
+
+    const Vector3 out = Fast::rsqrt(Vector3{0.25f, 4.0f, 16.0f});
+    CORRADE_VERIFY(std::abs(out[0] - 2.0f) < 2.0f*1.8e-3f);
+    CORRADE_VERIFY(std::abs(out[1] - 0.5f) < 0.5f*1.8e-3f);
+    CORRADE_VERIFY(std::abs(out[2] - 0.25f) < 0.25f*1.8e-3f);
+}
+
+void FastTest::normalized() {
+    const Vector3 a = Fast::normalized(Vector3{1.0f, -2.0f, 7.5f});
+    const Vector3 b = Vector3{1.0f, -2.0f, 7.5f}.normalized();
+    CORRADE_VERIFY(std::abs(a.length() - 1.0f) < 1.8e-3f);
+    CORRADE_VERIFY(std::abs(Math::dot(a.normalized(), b) - 1.0f) < 1.0e-6f);
+}
+
+void FastTest::sincos() {
+    Float maxError = 0.0f;
+    for(Float v = -1000.0f; v < 1000.0f; v += 0.0137f) {
+        const std::pair<Float, Float> out = Fast::sincos(Rad{v});
+        maxError = Math::max(maxError, Math::max(
+            Float(std::abs(out.first - std::sin(Double(v)))),
+            Float(std::abs(out.second - std::cos(Double(v))))));
+    }
+    CORRADE_VERIFY(maxError < 4.0e-6f);
+
+    /* All quadrants, exactly */
+    CORRADE_COMPARE(Fast::sincos(Rad{0.0f}).first, 0.0f);
+    CORRADE_COMPARE(Fast::sincos(Rad{0.0f}).second, 1.0f);
+    CORRADE_COMPARE(Fast::sincos(Deg<Float>{90.0f}).first, 1.0f);
+    CORRADE_COMPARE(Fast::sincos(Deg<Float>{90.0f}).second, 0.0f);
+    CORRADE_COMPARE(Fast::sincos(Deg<Float>{180.0f}).first, 0.0f);
+    CORRADE_COMPARE(Fast::sincos(Deg<Float>{180.0f}).second, -1.0f);
+    CORRADE_COMPARE(Fast::sincos(Deg<Float>{-90.0f}).first, -1.0f);
+    CORRADE_COMPARE(Fast::sincos(Deg<Float>{-90.0f}).second, 0.0f);
+
+    const Vector4 angles{0.0f, 1.0f, -2.0f, 3.0f};
+    const std::pair<Vector4, Vector4> out = Fast::sincos(angles);
+    for(std::size_t i = 0; i != 4; ++i) {
+        const std::pair<Float, Float> expected = Fast::sincos(Rad{angles[i]});
+        CORRADE_COMPARE(out.first[i], expected.first);
+        CORRADE_COMPARE(out.second[i], expected.second);
+    }
+}
+
+void FastTest::exp() {
+    Float maxError = 0.0f;
+    for(Float v = -87.0f; v < 88.0f; v += 0.00113f)
+        maxError = Math::max(maxError, Float(std::abs(Fast::exp(v)/std::exp(Double(v)) - 1.0)));
+    CORRADE_VERIFY(maxError < 3.0e-7f);
+
+    CORRADE_COMPARE(Fast::exp(0.0f), 1.0f);
+    CORRADE_COMPARE(Fast::exp(1.0f), Constants<Float>::e());
+
+    /* Clamped to avoid infinity and denormals */
+    CORRADE_COMPARE(Fast::exp(1000.0f), Fast::exp(88.0f));
+    CORRADE_COMPARE(Fast::exp(-1000.0f), Fast::exp(-87.0f));
+
+    CORRADE_COMPARE(Fast::exp(Vector3{0.0f, 1.0f, -1.0f}), (Vector3{1.0f, Constants<Float>::e(), 1.0f/Constants<Float>::e()}));
+}
+
+void FastTest::log() {
+    Float maxError = 0.0f;
+    for(Float v = 1.0e-37f; v < 1.0e38f; v *= 1.00071f) {
+        const Double expected = std::log(Double(v));
+        maxError = Math::max(maxError, Float(std::abs(Fast::log(v) - expected)/Math::max(1.0, std::abs(expected))));
+    }
+    CORRADE_VERIFY(maxError < 2.0e-7f);
+
+    CORRADE_COMPARE(Fast::log(1.0f), 0.0f);
+    CORRADE_COMPARE(Fast::log(Constants<Float>::e()), 1.0f);
+    CORRADE_COMPARE(Fast::log(Vector3{1.0f, 2.0f, 0.5f}), (Vector3{0.0f, 0.693147f, -0.693147f}));
+}
+
+void FastTest::atan2() {
+    Float maxError = 0.0f;
+    for(Float a = -3.14f; a < 3.14f; a += 0.0013f) {
+        const Float y = 7.5f*std::sin(a);
+        const Float x = 7.5f*std::cos(a);
+        maxError = Math::max(maxError, Float(std::abs(Float(Fast::atan2(y, x)) - std::atan2(Double(y), Double(x)))));
+    }
+    CORRADE_VERIFY(maxError < 1.2e-5f);
+
+    /* Axes, exactly */
+    CORRADE_COMPARE(Float(Fast::atan2(0.0f, 1.0f)), 0.0f);
+    CORRADE_COMPARE(Float(Fast::atan2(1.0f, 0.0f)), Constants<Float>::piHalf());
+    CORRADE_COMPARE(Float(Fast::atan2(0.0f, -1.0f)), Constants<Float>::pi());
+    CORRADE_COMPARE(Float(Fast::atan2(-1.0f, 0.0f)), -Constants<Float>::piHalf());
+
+    /* Degenerate */
+    CORRADE_COMPARE(Float(Fast::atan2(0.0f, 0.0f)), 0.0f);
+}
+
+void FastTest::rsqrtInto() {
+    const Float src[]{0.25f, 4.0f, 16.0f, 100.0f, 1.0f};
+    Float dst[5];
+    Fast::rsqrtInto({src, 5, sizeof(Float)}, {dst, 5, sizeof(Float)});
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(dst[i], Fast::rsqrt(src[i]));
+}
+
+void FastTest::rsqrtIntoStrided() {
+    const Vector4 src[]{{0.25f, 1.0f, 1.0f, 1.0f},
+                        {4.0f, 1.0f, 1.0f, 1.0f},
+                        {16.0f, 1.0f, 1.0f, 1.0f}};
+    Vector4 dst[3]{};
+    Fast::rsqrtInto({src[0].data(), 3, sizeof(Vector4)}, {dst[0].data() + 2, 3, sizeof(Vector4)});
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_COMPARE(dst[i][2], Fast::rsqrt(src[i][0]));
+        CORRADE_COMPARE(dst[i][0], 0.0f);
+    }
+}
+
+void FastTest::sincosInto() {
+    const Float src[]{0.0f, 1.0f, -2.0f, 3.0f, 1000.0f};
+    Float sinDst[5], cosDst[5];
+    Fast::sincosInto({src, 5, sizeof(Float)}, {sinDst, 5, sizeof(Float)}, {cosDst, 5, sizeof(Float)});
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_COMPARE(sinDst[i], Fast::sincos(Rad{src[i]}).first);
+        CORRADE_COMPARE(cosDst[i], Fast::sincos(Rad{src[i]}).second);
+    }
+}
+
+void FastTest::expLogInto() {
+    const Float src[]{0.5f, 1.0f, 2.0f, 30.0f, 0.001f};
+    Float exp[5], log[5];
+    Fast::expInto({src, 5, sizeof(Float)}, {exp, 5, sizeof(Float)});
+    Fast::logInto({src, 5, sizeof(Float)}, {log, 5, sizeof(Float)});
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_COMPARE(exp[i], Fast::exp(src[i]));
+        CORRADE_COMPARE(log[i], Fast::log(src[i]));
+    }
+}
+
+void FastTest::atan2Into() {
+    const Float y[]{0.0f, 1.0f, -2.0f, 3.0f};
+    const Float x[]{1.0f, 0.0f, -1.0f, 3.0f};
+    Float dst[4];
+    Fast::atan2Into({y, 4, sizeof(Float)}, {x, 4, sizeof(Float)}, {dst, 4, sizeof(Float)});
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(dst[i], Float(Fast::atan2(y[i], x[i])));
+}
+
+void FastTest::intoInvalidSize() {
+    Float a[2]{};
+    Float b[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Fast::rsqrtInto({a, 2, sizeof(Float)}, {b, 3, sizeof(Float)});
+    Fast::sincosInto({a, 2, sizeof(Float)}, {a, 2, sizeof(Float)}, {b, 3, sizeof(Float)});
+    Fast::expInto({a, 2, sizeof(Float)}, {b, 3, sizeof(Float)});
+    Fast::logInto({a, 2, sizeof(Float)}, {b, 3, sizeof(Float)});
+    Fast::atan2Into({a, 2, sizeof(Float)}, {b, 3, sizeof(Float)}, {a, 2, sizeof(Float)});
+    CORRADE_COMPARE(out.str(),
+        "Math::Fast::rsqrtInto(): expected the same count of source and destination items, got 2 and 3\n"
+        "Math::Fast::sincosInto(): expected the same count of source and destination items, got 2, 2 and 3\n"
+        "Math::Fast::expInto(): expected the same count of source and destination items, got 2 and 3\n"
+        "Math::Fast::logInto(): expected the same count of source and destination items, got 2 and 3\n"
+        "Math::Fast::atan2Into(): expected the same count of source and destination items, got 2, 3 and 2\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FastTest)
@@ -23,7 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Half.h"
@@ -37,6 +39,11 @@ struct HalfTest: Corrade::TestSuite::Tester {
     void unpack();
     void pack();
     void repack();
+    void packInto();
+    void unpackInto();
+    void packIntoStrided();
+    void packIntoHalfVector();
+    void packIntoInvalidSize();
 
     void unpack1k();
     void unpack1kNaive();
@@ -44,12 +51,15 @@ struct HalfTest: Corrade::TestSuite::Tester {
     void pack1k();
     void pack1kNaive();
     void pack1kTable();
+    void unpack1kBatch();
+    void pack1kBatch();
 
     void constructDefault();
     void constructValue();
     void constructData();
     void constructNoInit();
     void constructCopy();
+    void constructVector();
 
     void compare();
     void compareNaN();
@@ -85,19 +95,28 @@ HalfTest::HalfTest() {
 
     addRepeatedTests({&HalfTest::repack}, 65536);
 
+    addTests({&HalfTest::packInto,
+              &HalfTest::unpackInto,
+              &HalfTest::packIntoStrided,
+              &HalfTest::packIntoHalfVector,
+              &HalfTest::packIntoInvalidSize});
+
     addBenchmarks({
         &HalfTest::unpack1k,
         &HalfTest::unpack1kNaive,
         &HalfTest::unpack1kTable,
         &HalfTest::pack1k,
         &HalfTest::pack1kNaive,
-        &HalfTest::pack1kTable}, 100);
+        &HalfTest::pack1kTable,
+        &HalfTest::unpack1kBatch,
+        &HalfTest::pack1kBatch}, 100);
 
     addTests({&HalfTest::constructDefault,
               &HalfTest::constructValue,
               &HalfTest::constructData,
               &HalfTest::constructNoInit,
               &HalfTest::constructCopy,
+              &HalfTest::constructVector,
 
               &HalfTest::compare});
 
@@ -438,6 +457,121 @@ void HalfTest::repack() {
     }
 }
 
+void HalfTest::packInto() {
+    /* Every half value including NaNs and denormals, plus a few values that
+       don't roundtrip, overflow or need rounding */
+    std::vector<Float> data(65536 + 6);
+    for(std::size_t i = 0; i != 65536; ++i)
+        data[i] = Math::unpackHalf(UnsignedShort(i));
+    data[65536] = 1.0e-10f;
+    data[65537] = -1.0e10f;
+    data[65538] = 65520.0f;
+    data[65539] = 3.14159f;
+    data[65540] = Constants::nan();
+    data[65541] = -Constants::inf();
+
+    /* The batch version has to give bit-exact results to the scalar one */
+    std::vector<UnsignedShort> out(data.size());
+    Math::packHalfInto(Containers::StridedArrayView<const Float>{data.data(), data.size(), sizeof(Float)},
+        Containers::StridedArrayView<UnsignedShort>{out.data(), out.size(), sizeof(UnsignedShort)});
+    std::size_t mismatchCount = 0;
+    for(std::size_t i = 0; i != data.size(); ++i)
+        if(out[i] != Math::packHalf(data[i])) ++mismatchCount;
+    CORRADE_COMPARE(mismatchCount, 0);
+
+    /* Vector */
+    const Math::Vector3<Float> vector{0.0f, 3.0f, 1.0f};
+    Math::Vector3<UnsignedShort> outVector;
+    Math::packHalfInto(Containers::StridedArrayView<const Math::Vector3<Float>>{&vector, 1, sizeof(vector)},
+        Containers::StridedArrayView<Math::Vector3<UnsignedShort>>{&outVector, 1, sizeof(outVector)});
+    CORRADE_COMPARE(outVector, (Math::Vector3<UnsignedShort>{0x0000, 0x4200, 0x3c00}));
+}
+
+void HalfTest::unpackInto() {
+    std::vector<UnsignedShort> data(65536);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = UnsignedShort(i);
+
+    /* The batch version has to give bit-exact results to the scalar one */
+    std::vector<Float> out(data.size());
+    Math::unpackHalfInto(Containers::StridedArrayView<const UnsignedShort>{data.data(), data.size(), sizeof(UnsignedShort)},
+        Containers::StridedArrayView<Float>{out.data(), out.size(), sizeof(Float)});
+    std::size_t mismatchCount = 0;
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        const Float expected = Math::unpackHalf(data[i]);
+        if(std::memcmp(&out[i], &expected, sizeof(Float)) != 0) ++mismatchCount;
+    }
+    CORRADE_COMPARE(mismatchCount, 0);
+}
+
+void HalfTest::packIntoStrided() {
+    struct Vertex {
+        Math::Vector3<Float> position;
+        Math::Vector2<UnsignedShort> textureCoordinates;
+    } vertices[]{
+        {{}, {}},
+        {{}, {}},
+        {{}, {}}
+    };
+    const Math::Vector2<Float> textureCoordinates[]{
+        {0.0f, 1.0f}, {0.5f, -2.0f}, {Constants::inf(), 3.0f}};
+
+    Math::packHalfInto(Containers::StridedArrayView<const Math::Vector2<Float>>{textureCoordinates, 3, sizeof(Math::Vector2<Float>)},
+        Containers::StridedArrayView<Math::Vector2<UnsignedShort>>{&vertices[0].textureCoordinates, 3, sizeof(Vertex)});
+    CORRADE_COMPARE(vertices[0].textureCoordinates, (Math::Vector2<UnsignedShort>{0x0000, 0x3c00}));
+    CORRADE_COMPARE(vertices[1].textureCoordinates, (Math::Vector2<UnsignedShort>{0x3800, 0xc000}));
+    CORRADE_COMPARE(vertices[2].textureCoordinates, (Math::Vector2<UnsignedShort>{0x7c00, 0x4200}));
+
+    Math::Vector2<Float> out[3];
+    Math::unpackHalfInto(Containers::StridedArrayView<const Math::Vector2<UnsignedShort>>{&vertices[0].textureCoordinates, 3, sizeof(Vertex)},
+        Containers::StridedArrayView<Math::Vector2<Float>>{out, 3, sizeof(Math::Vector2<Float>)});
+    CORRADE_COMPARE(out[0], textureCoordinates[0]);
+    CORRADE_COMPARE(out[1], textureCoordinates[1]);
+    CORRADE_COMPARE(out[2], textureCoordinates[2]);
+}
+
+void HalfTest::packIntoHalfVector() {
+    const Math::Vector3<Float> normals[]{
+        {0.0f, 1.0f, 0.0f}, {0.5f, -2.0f, Constants::inf()}};
+
+    /* Packing into Half components instead of raw UnsignedShort */
+    Math::Vector3<Half> packed[2];
+    Math::packHalfInto(Containers::StridedArrayView<const Math::Vector3<Float>>{normals, 2, sizeof(Math::Vector3<Float>)},
+        Containers::StridedArrayView<Math::Vector3<Half>>{packed, 2, sizeof(Math::Vector3<Half>)});
+    CORRADE_COMPARE(packed[0], (Math::Vector3<Half>{Half{UnsignedShort(0x0000)}, Half{UnsignedShort(0x3c00)}, Half{UnsignedShort(0x0000)}}));
+    CORRADE_COMPARE(packed[1], (Math::Vector3<Half>{Half{UnsignedShort(0x3800)}, Half{UnsignedShort(0xc000)}, Half{UnsignedShort(0x7c00)}}));
+
+    Math::Vector3<Float> out[2];
+    Math::unpackHalfInto(Containers::StridedArrayView<const Math::Vector3<Half>>{packed, 2, sizeof(Math::Vector3<Half>)},
+        Containers::StridedArrayView<Math::Vector3<Float>>{out, 2, sizeof(Math::Vector3<Float>)});
+    CORRADE_COMPARE(out[0], normals[0]);
+    CORRADE_COMPARE(out[1], normals[1]);
+
+    /* Scalar Half */
+    const Float data[]{3.5f, -1.0f};
+    Half packedScalar[2];
+    Math::packHalfInto(Containers::StridedArrayView<const Float>{data, 2, sizeof(Float)},
+        Containers::StridedArrayView<Half>{packedScalar, 2, sizeof(Half)});
+    CORRADE_COMPARE(packedScalar[0], Half{3.5f});
+    CORRADE_COMPARE(packedScalar[1], Half{-1.0f});
+}
+
+void HalfTest::packIntoInvalidSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Float data[3]{};
+    UnsignedShort packed[2];
+    Float unpacked[3];
+    Math::packHalfInto(Containers::StridedArrayView<const Float>{data, 3, sizeof(Float)},
+        Containers::StridedArrayView<UnsignedShort>{packed, 2, sizeof(UnsignedShort)});
+    Math::unpackHalfInto(Containers::StridedArrayView<const UnsignedShort>{packed, 2, sizeof(UnsignedShort)},
+        Containers::StridedArrayView<Float>{unpacked, 3, sizeof(Float)});
+    CORRADE_COMPARE(out.str(),
+        "Math::packHalfInto(): expected the same count of source and destination items, got 3 and 2\n"
+        "Math::unpackHalfInto(): expected the same count of source and destination items, got 2 and 3\n");
+}
+
 void HalfTest::pack1k() {
     UnsignedInt out = 0;
     CORRADE_BENCHMARK(100)
@@ -498,6 +632,34 @@ void HalfTest::unpack1kTable() {
     CORRADE_VERIFY(out);
 }
 
+void HalfTest::unpack1kBatch() {
+    UnsignedShort in[1000];
+    for(std::uint_fast16_t i = 0; i != 1000; ++i)
+        in[i] = i*65;
+
+    Float out[1000];
+    CORRADE_BENCHMARK(100)
+        Math::unpackHalfInto(Containers::StridedArrayView<const UnsignedShort>{in, 1000, sizeof(UnsignedShort)},
+            Containers::StridedArrayView<Float>{out, 1000, sizeof(Float)});
+
+    /* To avoid optimizing things out */
+    CORRADE_VERIFY(out[999]);
+}
+
+void HalfTest::pack1kBatch() {
+    Float in[1000];
+    for(std::uint_fast16_t i = 0; i != 1000; ++i)
+        in[i] = Float(i)*65;
+
+    UnsignedShort out[1000];
+    CORRADE_BENCHMARK(100)
+        Math::packHalfInto(Containers::StridedArrayView<const Float>{in, 1000, sizeof(Float)},
+            Containers::StridedArrayView<UnsignedShort>{out, 1000, sizeof(UnsignedShort)});
+
+    /* To avoid optimizing things out */
+    CORRADE_VERIFY(out[999]);
+}
+
 void HalfTest::constructDefault() {
     constexpr Half a;
     CORRADE_COMPARE(Float(a), 0.0f);
@@ -562,6 +724,18 @@ void HalfTest::constructCopy() {
     CORRADE_VERIFY(std::is_nothrow_copy_assignable<Half>::value);
 }
 
+void HalfTest::constructVector() {
+    /* Half vectors are storage-only, but converting from and to float
+       vectors works through the explicit Half conversions */
+    const Math::Vector3<Half> a{Math::Vector3<Float>{3.5f, -1.0f, 0.0f}};
+    CORRADE_COMPARE(a, (Math::Vector3<Half>{Half{UnsignedShort(0x4300)}, Half{UnsignedShort(0xbc00)}, Half{UnsignedShort(0x0000)}}));
+    CORRADE_COMPARE(Math::Vector3<Float>{a}, (Math::Vector3<Float>{3.5f, -1.0f, 0.0f}));
+    CORRADE_COMPARE(sizeof(Math::Vector3<Half>), 6);
+
+    /* Implicit conversion is not allowed */
+    CORRADE_VERIFY(!(std::is_convertible<Math::Vector3<Float>, Math::Vector3<Half>>::value));
+}
+
 void HalfTest::compare() {
     constexpr Half a{UnsignedShort(0x4300)};
     constexpr Half b{UnsignedShort(0x4301)};
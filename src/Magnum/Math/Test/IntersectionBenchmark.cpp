@@ -103,10 +103,12 @@ struct IntersectionBenchmark: Corrade::TestSuite::Tester {
 
     void rangeFrustumNaive();
     void rangeFrustum();
+    void rangeFrustumBatch();
 
     void rangeCone();
 
     void sphereFrustum();
+    void sphereFrustumBatch();
 
     void sphereConeNaive();
     void sphereCone();
@@ -118,15 +120,18 @@ struct IntersectionBenchmark: Corrade::TestSuite::Tester {
 
     std::vector<Range3D> _boxes;
     std::vector<Vector4> _spheres;
+    std::vector<UnsignedByte> _visible;
 };
 
 IntersectionBenchmark::IntersectionBenchmark() {
     addBenchmarks({&IntersectionBenchmark::rangeFrustumNaive,
                    &IntersectionBenchmark::rangeFrustum,
+                   &IntersectionBenchmark::rangeFrustumBatch,
 
                    &IntersectionBenchmark::rangeCone,
 
                    &IntersectionBenchmark::sphereFrustum,
+                   &IntersectionBenchmark::sphereFrustumBatch,
 
                    &IntersectionBenchmark::sphereConeNaive,
                    &IntersectionBenchmark::sphereCone,
@@ -154,6 +159,7 @@ IntersectionBenchmark::IntersectionBenchmark() {
         _boxes.emplace_back(center - extents, center + extents);
         _spheres.emplace_back(center, extents.length());
     }
+    _visible.resize(512/8);
 }
 
 void IntersectionBenchmark::rangeFrustumNaive() {
@@ -170,6 +176,14 @@ void IntersectionBenchmark::rangeFrustum() {
     }
 }
 
+void IntersectionBenchmark::rangeFrustumBatch() {
+    volatile UnsignedByte b = 0;
+    CORRADE_BENCHMARK(50) {
+        Intersection::rangeFrustum<Float>({_boxes.data(), _boxes.size(), sizeof(Range3D)}, _frustum, {_visible.data(), _visible.size()});
+        b = b ^ _visible[0];
+    }
+}
+
 void IntersectionBenchmark::rangeCone() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) {
@@ -188,6 +202,17 @@ void IntersectionBenchmark::sphereFrustum() {
     }
 }
 
+void IntersectionBenchmark::sphereFrustumBatch() {
+    volatile UnsignedByte b = 0;
+    CORRADE_BENCHMARK(50) {
+        Intersection::sphereFrustum<Float>(
+            {&_spheres[0].xyz(), _spheres.size(), sizeof(Vector4)},
+            {&_spheres[0].w(), _spheres.size(), sizeof(Vector4)},
+            _frustum, {_visible.data(), _visible.size()});
+        b = b ^ _visible[0];
+    }
+}
+
 void IntersectionBenchmark::sphereConeNaive() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) for(auto& sphere: _spheres) {
@@ -43,6 +43,10 @@ struct IntersectionTest: Corrade::TestSuite::Tester {
     void rangeFrustum();
     void aabbFrustum();
     void sphereFrustum();
+    void rangeFrustumBatch();
+    void aabbFrustumBatch();
+    void sphereFrustumBatch();
+    void frustumBatchInvalidSize();
 
     void pointCone();
     void pointDoubleCone();
@@ -72,6 +76,10 @@ IntersectionTest::IntersectionTest() {
               &IntersectionTest::rangeFrustum,
               &IntersectionTest::aabbFrustum,
               &IntersectionTest::sphereFrustum,
+              &IntersectionTest::rangeFrustumBatch,
+              &IntersectionTest::aabbFrustumBatch,
+              &IntersectionTest::sphereFrustumBatch,
+              &IntersectionTest::frustumBatchInvalidSize,
 
               &IntersectionTest::pointCone,
               &IntersectionTest::pointDoubleCone,
@@ -215,6 +223,123 @@ void IntersectionTest::sphereFrustum() {
     CORRADE_VERIFY(Intersection::sphereFrustum({5.5f, 5.5f, 5.5f}, 1.5f,  frustum));
     /* Sphere outside */
     CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, 100.0f}, 0.5f, frustum));
+    /* Sphere outside, closer than radius squared */
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, -2.0f}, 1.5f, frustum));
+
+    /* Non-normalized planes give the same result */
+    const Frustum scaled{
+        {4.0f, 0.0f, 0.0f, 0.0f},
+        {-4.0f, 0.0f, 0.0f, 40.0f},
+        {0.0f, 0.5f, 0.0f, 0.0f},
+        {0.0f, -0.5f, 0.0f, 5.0f},
+        {0.0f, 0.0f, 2.0f, 0.0f},
+        {0.0f, 0.0f, -2.0f, 20.0f}};
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.0f, 0.0f, -1.0f}, 1.5f, scaled));
+    CORRADE_VERIFY(Intersection::sphereFrustum({5.5f, 5.5f, 5.5f}, 1.5f,  scaled));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, -2.0f}, 1.5f, scaled));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, -2.0f, 0.0f}, 1.5f, scaled));
+}
+
+namespace {
+    /* Axis-aligned box, 21 volumes in total so the last block is not full */
+    const Frustum BatchFrustum{
+        {1.0f, 0.0f, 0.0f, 0.0f},
+        {-1.0f, 0.0f, 0.0f, 10.0f},
+        {0.0f, 1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f, 10.0f},
+        {0.0f, 0.0f, 2.0f, 0.0f},
+        {0.0f, 0.0f, -2.0f, 20.0f}};
+
+    Vector3 batchCenter(Int i) {
+        return {i*1.0f - 5.0f, (i % 3)*6.0f - 2.0f, (i % 5)*4.0f - 3.0f};
+    }
+
+    Vector3 batchExtents(Int i) {
+        return {0.5f + (i % 2), 1.0f + (i % 4)*0.5f, 0.75f};
+    }
+
+    bool bit(const std::vector<UnsignedByte>& mask, std::size_t i) {
+        return mask[i/8] & (1 << i % 8);
+    }
+}
+
+void IntersectionTest::rangeFrustumBatch() {
+    std::vector<Range3D> ranges;
+    for(Int i = 0; i != 21; ++i)
+        ranges.push_back(Range3D::fromCenter(batchCenter(i), batchExtents(i)));
+
+    std::vector<UnsignedByte> visible(3, 0xaa);
+    Intersection::rangeFrustum<Float>({ranges.data(), ranges.size(), sizeof(Range3D)}, BatchFrustum, {visible.data(), visible.size()});
+
+    std::size_t visibleCount = 0;
+    for(std::size_t i = 0; i != ranges.size(); ++i) {
+        CORRADE_COMPARE(bit(visible, i), Intersection::rangeFrustum(ranges[i], BatchFrustum));
+        if(bit(visible, i)) ++visibleCount;
+    }
+
+    /* Make sure both cases are tested */
+    CORRADE_VERIFY(visibleCount > 0 && visibleCount < ranges.size());
+
+    /* Unused bits are cleared */
+    CORRADE_COMPARE(visible[2] & 0xe0, 0);
+}
+
+void IntersectionTest::aabbFrustumBatch() {
+    std::vector<std::pair<Vector3, Vector3>> boxes;
+    for(Int i = 0; i != 21; ++i)
+        boxes.emplace_back(batchCenter(i), batchExtents(i));
+
+    /* Interleaved data to test the strides */
+    std::vector<UnsignedByte> visible(3);
+    Intersection::aabbFrustum<Float>(
+        {&boxes[0].first, boxes.size(), sizeof(std::pair<Vector3, Vector3>)},
+        {&boxes[0].second, boxes.size(), sizeof(std::pair<Vector3, Vector3>)},
+        BatchFrustum, {visible.data(), visible.size()});
+
+    std::size_t visibleCount = 0;
+    for(std::size_t i = 0; i != boxes.size(); ++i) {
+        CORRADE_COMPARE(bit(visible, i), Intersection::aabbFrustum(boxes[i].first, boxes[i].second, BatchFrustum));
+        if(bit(visible, i)) ++visibleCount;
+    }
+
+    CORRADE_VERIFY(visibleCount > 0 && visibleCount < boxes.size());
+}
+
+void IntersectionTest::sphereFrustumBatch() {
+    std::vector<Vector4> spheres;
+    for(Int i = 0; i != 21; ++i)
+        spheres.emplace_back(batchCenter(i), batchExtents(i).y());
+
+    std::vector<UnsignedByte> visible(3);
+    Intersection::sphereFrustum<Float>(
+        {&spheres[0].xyz(), spheres.size(), sizeof(Vector4)},
+        {&spheres[0].w(), spheres.size(), sizeof(Vector4)},
+        BatchFrustum, {visible.data(), visible.size()});
+
+    std::size_t visibleCount = 0;
+    for(std::size_t i = 0; i != spheres.size(); ++i) {
+        CORRADE_COMPARE(bit(visible, i), Intersection::sphereFrustum(spheres[i].xyz(), spheres[i].w(), BatchFrustum));
+        if(bit(visible, i)) ++visibleCount;
+    }
+
+    CORRADE_VERIFY(visibleCount > 0 && visibleCount < spheres.size());
+}
+
+void IntersectionTest::frustumBatchInvalidSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Vector3 centers[9]{};
+    const Vector3 extents[8]{};
+    const Float radii[8]{};
+    UnsignedByte visible[2]{};
+    Intersection::aabbFrustum<Float>({centers, 9, sizeof(Vector3)}, {extents, 8, sizeof(Vector3)}, BatchFrustum, visible);
+    Intersection::aabbFrustum<Float>({centers, 9, sizeof(Vector3)}, {centers, 9, sizeof(Vector3)}, BatchFrustum, {visible, 1});
+    Intersection::sphereFrustum<Float>({centers, 9, sizeof(Vector3)}, {radii, 8, sizeof(Float)}, BatchFrustum, visible);
+    CORRADE_COMPARE(out.str(),
+        "Math::Intersection::aabbFrustum(): expected the same count of centers and extents, got 9 and 8\n"
+        "Math::Intersection::aabbFrustum(): expected at least 2 bytes for 9 results but got 1\n"
+        "Math::Intersection::sphereFrustum(): expected the same count of centers and radii, got 9 and 8\n");
 }
 
 void IntersectionTest::pointCone() {
@@ -24,6 +24,7 @@
 */
 
 #include <limits>
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Packing.h"
@@ -44,6 +45,12 @@ struct PackingTest: Corrade::TestSuite::Tester {
     void reunpackSinged();
     void unpackTypeDeduction();
 
+    void unpackInto();
+    void unpackIntoStrided();
+    void packInto();
+    void packIntoStrided();
+    void packIntoInvalidSize();
+
     /* Half (un)pack functions are tested and benchmarked in HalfTest.cpp,
        because there's involved comparison and benchmarks to ground truth */
 };
@@ -61,7 +68,13 @@ PackingTest::PackingTest() {
               &PackingTest::packSigned,
               &PackingTest::reunpackUnsinged,
               &PackingTest::reunpackSinged,
-              &PackingTest::unpackTypeDeduction});
+              &PackingTest::unpackTypeDeduction,
+
+              &PackingTest::unpackInto,
+              &PackingTest::unpackIntoStrided,
+              &PackingTest::packInto,
+              &PackingTest::packIntoStrided,
+              &PackingTest::packIntoInvalidSize});
 }
 
 void PackingTest::bitMax() {
@@ -279,6 +292,93 @@ void PackingTest::unpackTypeDeduction() {
     CORRADE_COMPARE((Math::unpack<Float, Byte>('\x7F')), 1.0f);
 }
 
+void PackingTest::unpackInto() {
+    const UnsignedByte data[]{0, 51, 255, 127};
+    Float out[4];
+    Math::unpackInto(Containers::StridedArrayView<const UnsignedByte>{data, 4, sizeof(UnsignedByte)},
+        Containers::StridedArrayView<Float>{out, 4, sizeof(Float)});
+    CORRADE_COMPARE(out[0], 0.0f);
+    CORRADE_COMPARE(out[1], 0.2f);
+    CORRADE_COMPARE(out[2], 1.0f);
+    CORRADE_COMPARE(out[3], Math::unpack<Float>(UnsignedByte(127)));
+
+    const Vector3b vectors[]{{-128, 0, 127}, {1, -127, 64}};
+    Vector3 outVectors[2];
+    Math::unpackInto(Containers::StridedArrayView<const Vector3b>{vectors, 2, sizeof(Vector3b)},
+        Containers::StridedArrayView<Vector3>{outVectors, 2, sizeof(Vector3)});
+    CORRADE_COMPARE(outVectors[0], Math::unpack<Vector3>(vectors[0]));
+    CORRADE_COMPARE(outVectors[1], Math::unpack<Vector3>(vectors[1]));
+    CORRADE_COMPARE(outVectors[0], (Vector3{-1.0f, 0.0f, 1.0f}));
+}
+
+void PackingTest::unpackIntoStrided() {
+    struct Vertex {
+        Vector3 position;
+        Vector3ub color;
+    } vertices[]{
+        {{}, {0, 255, 51}},
+        {{}, {255, 0, 127}},
+        {{}, {102, 204, 0}}
+    };
+
+    Vector3 out[3];
+    Math::unpackInto(Containers::StridedArrayView<const Vector3ub>{&vertices[0].color, 3, sizeof(Vertex)},
+        Containers::StridedArrayView<Vector3>{out, 3, sizeof(Vector3)});
+    CORRADE_COMPARE(out[0], (Vector3{0.0f, 1.0f, 0.2f}));
+    CORRADE_COMPARE(out[1], Math::unpack<Vector3>(vertices[1].color));
+    CORRADE_COMPARE(out[2], (Vector3{0.4f, 0.8f, 0.0f}));
+}
+
+void PackingTest::packInto() {
+    const Float data[]{0.0f, 0.2f, 1.0f, -1.0f, 0.5f};
+    Short out[5];
+    Math::packInto(Containers::StridedArrayView<const Float>{data, 5, sizeof(Float)},
+        Containers::StridedArrayView<Short>{out, 5, sizeof(Short)});
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(out[i], Math::pack<Short>(data[i]));
+
+    const Vector3 vectors[]{{0.0f, 1.0f, 0.2f}, {0.4f, 0.8f, 0.0f}};
+    Vector3ub outVectors[2];
+    Math::packInto(Containers::StridedArrayView<const Vector3>{vectors, 2, sizeof(Vector3)},
+        Containers::StridedArrayView<Vector3ub>{outVectors, 2, sizeof(Vector3ub)});
+    CORRADE_COMPARE(outVectors[0], Math::pack<Vector3ub>(vectors[0]));
+    CORRADE_COMPARE(outVectors[1], Math::pack<Vector3ub>(vectors[1]));
+}
+
+void PackingTest::packIntoStrided() {
+    const Vector3 data[]{{0.0f, 1.0f, 0.2f}, {0.4f, 0.8f, 0.0f}, {1.0f, 1.0f, 1.0f}};
+    struct Vertex {
+        Vector3ub color;
+        UnsignedByte padding;
+    } vertices[3]{};
+
+    Math::packInto(Containers::StridedArrayView<const Vector3>{data, 3, sizeof(Vector3)},
+        Containers::StridedArrayView<Vector3ub>{&vertices[0].color, 3, sizeof(Vertex)});
+    CORRADE_COMPARE(vertices[0].color, Math::pack<Vector3ub>(data[0]));
+    CORRADE_COMPARE(vertices[1].color, Math::pack<Vector3ub>(data[1]));
+    CORRADE_COMPARE(vertices[2].color, (Vector3ub{255, 255, 255}));
+
+    /* Padding is untouched */
+    CORRADE_COMPARE(vertices[0].padding, 0);
+    CORRADE_COMPARE(vertices[2].padding, 0);
+}
+
+void PackingTest::packIntoInvalidSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Float data[3]{};
+    UnsignedByte packed[2];
+    Float unpacked[2];
+    Math::packInto(Containers::StridedArrayView<const Float>{data, 3, sizeof(Float)},
+        Containers::StridedArrayView<UnsignedByte>{packed, 2, sizeof(UnsignedByte)});
+    Math::unpackInto(Containers::StridedArrayView<const UnsignedByte>{packed, 2, sizeof(UnsignedByte)},
+        Containers::StridedArrayView<Float>{unpacked, 1, sizeof(Float)});
+    CORRADE_COMPARE(out.str(),
+        "Math::packInto(): expected the same count of source and destination items, got 3 and 2\n"
+        "Math::unpackInto(): expected the same count of source and destination items, got 2 and 1\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::PackingTest)
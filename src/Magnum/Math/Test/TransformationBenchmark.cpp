@@ -0,0 +1,101 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#define CORRADE_NO_ASSERT
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+/* Covers the operations that get specialized with MAGNUM_BUILD_MATH_SIMD,
+   compare builds with and without the option enabled */
+struct TransformationBenchmark: Corrade::TestSuite::Tester {
+    explicit TransformationBenchmark();
+
+    void matrix4Multiply();
+    void matrix4Inverted();
+    void matrix4TransformPoint();
+    void quaternionMultiply();
+};
+
+using namespace Math::Literals;
+
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::Vector3<Float> Vector3;
+
+TransformationBenchmark::TransformationBenchmark() {
+    addBenchmarks({&TransformationBenchmark::matrix4Multiply,
+                   &TransformationBenchmark::matrix4Inverted,
+                   &TransformationBenchmark::matrix4TransformPoint,
+                   &TransformationBenchmark::quaternionMultiply}, 100);
+}
+
+void TransformationBenchmark::matrix4Multiply() {
+    const Matrix4 a = Matrix4::rotationZ(0.01_degf)*Matrix4::scaling(Vector3{1.00001f});
+    Matrix4 c = Matrix4::translation({1.0f, 2.0f, 3.0f});
+    CORRADE_BENCHMARK(10000) {
+        c = a*c;
+    }
+
+    CORRADE_VERIFY(c != Matrix4{});
+}
+
+void TransformationBenchmark::matrix4Inverted() {
+    Matrix4 a = Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationZ(35.0_degf)*Matrix4::scaling({1.5f, 2.0f, 1.0f});
+    CORRADE_BENCHMARK(10000) {
+        a = a.inverted();
+    }
+
+    CORRADE_VERIFY(a != Matrix4{});
+}
+
+void TransformationBenchmark::matrix4TransformPoint() {
+    const Matrix4 a = Matrix4::perspectiveProjection(35.0_degf, 1.333f, 0.01f, 100.0f)*Matrix4::translation(Vector3::zAxis(-10.0f));
+    Vector3 c;
+    Vector3 p{1.0f, 2.0f, 3.0f};
+    CORRADE_BENCHMARK(10000) {
+        c += a.transformPoint(p);
+        p.x() += 0.0001f;
+    }
+
+    CORRADE_VERIFY(c != Vector3{});
+}
+
+void TransformationBenchmark::quaternionMultiply() {
+    const Quaternion a = Quaternion::rotation(0.01_degf, Vector3::zAxis());
+    Quaternion c = Quaternion::rotation(35.0_degf, Vector3::xAxis());
+    CORRADE_BENCHMARK(10000) {
+        c = a*c;
+    }
+
+    CORRADE_VERIFY(c != Quaternion{});
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::TransformationBenchmark)
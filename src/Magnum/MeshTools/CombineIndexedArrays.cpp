@@ -25,12 +25,10 @@
 
 #include "CombineIndexedArrays.h"
 
-#include <cstring>
-#include <unordered_map>
 #include <Corrade/Utility/Assert.h>
-#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -85,70 +83,32 @@ std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::ve
 
 }
 
-namespace {
-
-class IndexHash {
-    public:
-        explicit IndexHash(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
-
-        std::size_t operator()(UnsignedInt key) const {
-            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(indices.data()+key*stride), sizeof(UnsignedInt)*stride).byteArray());
-        }
-
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
-};
-
-class IndexEqual {
-    public:
-        explicit IndexEqual(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
-
-        bool operator()(UnsignedInt a, UnsignedInt b) const {
-            return std::memcmp(indices.data()+a*stride, indices.data()+b*stride, sizeof(UnsignedInt)*stride) == 0;
-        }
-
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
-};
-
-}
-
-std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, const UnsignedInt stride) {
+std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, const UnsignedInt stride, const UnsignedInt threadCount) {
     CORRADE_ASSERT(stride != 0, "MeshTools::combineIndexArrays(): stride can't be zero", {});
     CORRADE_ASSERT(interleavedArrays.size() % stride == 0, "MeshTools::combineIndexArrays(): array size is not divisible by stride", {});
 
-    /* Hash map with index combinations, containing just indices into
-       interleavedArrays vector, hashing and comparison is done using IndexHash
-       and IndexEqual functors. Reserving more buckets than necessary (i.e. as
-       if each combination was unique). */
-    std::unordered_map<UnsignedInt, UnsignedInt, IndexHash, IndexEqual> indexCombinations(
-        interleavedArrays.size()/stride,
-        IndexHash(interleavedArrays, stride),
-        IndexEqual(interleavedArrays, stride));
-
     /* Make the index combinations unique. Original indices into original
        `interleavedArrays` array were 0, 1, 2, 3, ..., `combinedIndices`
        contains new ones into new (shorter) `newInterleavedArrays` array. */
-    std::vector<UnsignedInt> combinedIndices;
-    combinedIndices.reserve(interleavedArrays.size()/stride);
+    const std::size_t count = interleavedArrays.size()/stride;
+    std::vector<UnsignedInt> combinedIndices(count);
+    const std::size_t uniqueCount = count ? Implementation::removeDuplicatesInto(
+        reinterpret_cast<const char*>(interleavedArrays.data()), count,
+        sizeof(UnsignedInt)*stride, sizeof(UnsignedInt)*stride,
+        combinedIndices.data(), threadCount) : 0;
+
+    /* Copy the unique combinations to new interleaved arrays. New indices of
+       unique combinations are increasing in order of first occurrence. */
     std::vector<UnsignedInt> newInterleavedArrays;
-    for(std::size_t oldIndex = 0, end = interleavedArrays.size()/stride; oldIndex != end; ++oldIndex) {
-        /* Try to insert new index combination to the map */
-        const auto result = indexCombinations.emplace(oldIndex, indexCombinations.size());
-
-        /* Add the (either new or already existing) index to resulting index array */
-        combinedIndices.push_back(result.first->second);
-
-        /* If this is new combination, copy it to new interleaved arrays */
-        if(result.second) newInterleavedArrays.insert(newInterleavedArrays.end(),
+    newInterleavedArrays.reserve(uniqueCount*stride);
+    for(std::size_t oldIndex = 0; oldIndex != count; ++oldIndex) {
+        if(combinedIndices[oldIndex] != newInterleavedArrays.size()/stride) continue;
+        newInterleavedArrays.insert(newInterleavedArrays.end(),
             interleavedArrays.begin()+oldIndex*stride,
             interleavedArrays.begin()+(oldIndex+1)*stride);
     }
 
-    CORRADE_INTERNAL_ASSERT(combinedIndices.size() == interleavedArrays.size()/stride &&
-                            newInterleavedArrays.size() <= interleavedArrays.size());
+    CORRADE_INTERNAL_ASSERT(newInterleavedArrays.size() == uniqueCount*stride);
 
     return {std::move(combinedIndices), std::move(newInterleavedArrays)};
 }
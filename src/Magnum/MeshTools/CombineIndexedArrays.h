@@ -81,7 +81,7 @@ which can be then indexed with the combined index array:
 Again, first triangle in the mesh will have positions `a c f` and normals
 `B D E`.
 
-This function calls @ref combineIndexArrays(const std::vector<UnsignedInt>&, UnsignedInt)
+This function calls @ref combineIndexArrays(const std::vector<UnsignedInt>&, UnsignedInt, UnsignedInt)
 internally. See also @ref combineIndexedArrays() which does the vertex data
 reordering automatically.
 */
@@ -113,9 +113,15 @@ And second pair value is the cleaned up interleaved array:
 
     0 1 2 3 5 4 0 4 1 6 3 1 2 1
 
+The unique combinations are found using an open-addressing hash table in a
+single pass. For huge meshes the operation can be distributed over multiple
+threads of @ref globalJobExecutor() by setting @p threadCount to a value larger
+than @cpp 1 @ce, with the output being the same as with single-threaded
+operation. See @ref removeDuplicatesInPlace() for more information.
+
 @see @ref combineIndexedArrays()
 */
-MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, UnsignedInt stride);
+MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, UnsignedInt stride, UnsignedInt threadCount = 1);
 
 namespace Implementation {
 
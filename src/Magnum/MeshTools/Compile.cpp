@@ -25,12 +25,21 @@
 
 #include "Compile.h"
 
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
 #include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Mesh.h"
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/GL/MeshView.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Packing.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Transform.h"
+#include "Magnum/Trade/MeshBlob.h"
+#include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
 
@@ -122,69 +131,164 @@ std::tuple<GL::Mesh, std::unique_ptr<GL::Buffer>, std::unique_ptr<GL::Buffer>> c
 #endif
 
 GL::Mesh compile(const Trade::MeshData3D& meshData) {
+    return compile(meshData, {}).first;
+}
+
+namespace {
+
+/* Signed normalized 2.10.10.10, the W component is left at zero */
+UnsignedInt packNormal2101010(const Vector3& normal) {
+    UnsignedInt out = 0;
+    for(std::size_t i = 0; i != 3; ++i)
+        out |= (UnsignedInt(Int(Math::round(Math::clamp(normal[i], -1.0f, 1.0f)*511.0f))) & 0x3ff) << i*10;
+    return out;
+}
+
+}
+
+std::pair<GL::Mesh, Matrix4> compile(const Trade::MeshData3D& meshData, const CompileFlags flags) {
     GL::Mesh mesh;
     mesh.setPrimitive(meshData.primitive());
 
+    const std::vector<Vector3>& positions = meshData.positions(0);
+
+    /* Decide about attribute sizes. Quantized positions and normals on ES2
+       have only three components, but they're padded to four to keep all
+       attributes four-byte aligned. */
+    const UnsignedInt positionSize = flags & CompileFlag::QuantizePositions ?
+        4*sizeof(UnsignedShort) : sizeof(Shaders::Generic3D::Position::Type);
+    UnsignedInt normalSize = 0;
+    if(meshData.hasNormals()) normalSize = flags & CompileFlag::QuantizeNormals ?
+        #ifndef MAGNUM_TARGET_GLES2
+        sizeof(UnsignedInt)
+        #else
+        4*sizeof(Short)
+        #endif
+        : sizeof(Shaders::Generic3D::Normal::Type);
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    const bool quantizeTextureCoords = !!(flags & CompileFlag::QuantizeTextureCoordinates);
+    #else
+    const bool quantizeTextureCoords = false;
+    #endif
+    UnsignedInt textureCoordsSize = 0;
+    if(meshData.hasTextureCoords2D()) textureCoordsSize = quantizeTextureCoords ?
+        2*sizeof(UnsignedShort) : sizeof(Shaders::Generic3D::TextureCoordinates::Type);
+    const UnsignedInt colorsSize = meshData.hasColors() ?
+        sizeof(Shaders::Generic3D::Color4::Type) : 0;
+
     /* Decide about stride and offsets */
-    UnsignedInt stride = sizeof(Shaders::Generic3D::Position::Type);
-    const UnsignedInt normalOffset = sizeof(Shaders::Generic3D::Position::Type);
-    UnsignedInt textureCoordsOffset = sizeof(Shaders::Generic3D::Position::Type);
-    UnsignedInt colorsOffset = sizeof(Shaders::Generic3D::Position::Type);
-    if(meshData.hasNormals()) {
-        stride += sizeof(Shaders::Generic3D::Normal::Type);
-        textureCoordsOffset += sizeof(Shaders::Generic3D::Normal::Type);
-        colorsOffset += sizeof(Shaders::Generic3D::Normal::Type);
-    }
-    if(meshData.hasTextureCoords2D()) {
-        stride += sizeof(Shaders::Generic3D::TextureCoordinates::Type);
-        colorsOffset += sizeof(Shaders::Generic3D::Normal::Type);
-    }
-    if(meshData.hasColors())
-        stride += sizeof(Shaders::Generic3D::Color4::Type);
+    const UnsignedInt normalOffset = positionSize;
+    const UnsignedInt textureCoordsOffset = normalOffset + normalSize;
+    const UnsignedInt colorsOffset = textureCoordsOffset + textureCoordsSize;
+    const UnsignedInt stride = colorsOffset + colorsSize;
 
     /* Create vertex buffer */
     GL::Buffer vertexBuffer{GL::Buffer::TargetHint::Array};
     GL::Buffer vertexBufferRef = GL::Buffer::wrap(vertexBuffer.id(), GL::Buffer::TargetHint::Array);
-
-    /* Interleave positions and put them in with ownership transfer, use the
-       ref for the rest */
-    Containers::Array<char> data = MeshTools::interleave(
-        meshData.positions(0),
-        stride - sizeof(Shaders::Generic3D::Position::Type));
-    mesh.addVertexBuffer(std::move(vertexBuffer), 0,
-        Shaders::Generic3D::Position(),
-        stride - sizeof(Shaders::Generic3D::Position::Type));
+    Containers::Array<char> data{Containers::ValueInit, stride*positions.size()};
+
+    /* Put positions in with ownership transfer, use the ref for the rest */
+    Matrix4 positionTransformation;
+    if(flags & CompileFlag::QuantizePositions) {
+        /* Quantize inside the bounding box, flat dimensions stay at zero */
+        Vector3 min{Constants::inf()}, max{-Constants::inf()};
+        for(const Vector3& position: positions) {
+            min = Math::min(min, position);
+            max = Math::max(max, position);
+        }
+        Vector3 size = max - min;
+        for(std::size_t i = 0; i != 3; ++i) if(!(size[i] > 0.0f)) size[i] = 1.0f;
+        if(positions.empty()) min = {};
+        positionTransformation = Matrix4::translation(min)*Matrix4::scaling(size);
+
+        for(std::size_t i = 0; i != positions.size(); ++i) {
+            const Math::Vector3<UnsignedShort> packed = Math::pack<Math::Vector3<UnsignedShort>>((positions[i] - min)/size);
+            std::memcpy(data.data() + i*stride, packed.data(), sizeof(packed));
+        }
+        mesh.addVertexBuffer(std::move(vertexBuffer), 0,
+            Shaders::Generic3D::Position{
+                Shaders::Generic3D::Position::DataType::UnsignedShort,
+                Shaders::Generic3D::Position::DataOption::Normalized},
+            stride - sizeof(Math::Vector3<UnsignedShort>));
+    } else {
+        for(std::size_t i = 0; i != positions.size(); ++i)
+            std::memcpy(data.data() + i*stride, positions[i].data(), sizeof(Vector3));
+        mesh.addVertexBuffer(std::move(vertexBuffer), 0,
+            Shaders::Generic3D::Position(),
+            stride - sizeof(Shaders::Generic3D::Position::Type));
+    }
 
     /* Add also normals, if present */
     if(meshData.hasNormals()) {
-        MeshTools::interleaveInto(data,
-            normalOffset,
-            meshData.normals(0),
-            stride - normalOffset - sizeof(Shaders::Generic3D::Normal::Type));
-        mesh.addVertexBuffer(vertexBufferRef, 0,
-            normalOffset,
-            Shaders::Generic3D::Normal(),
-            stride - normalOffset - sizeof(Shaders::Generic3D::Normal::Type));
+        const std::vector<Vector3>& normals = meshData.normals(0);
+        if(flags & CompileFlag::QuantizeNormals) {
+            #ifndef MAGNUM_TARGET_GLES2
+            for(std::size_t i = 0; i != normals.size(); ++i) {
+                const UnsignedInt packed = packNormal2101010(normals[i]);
+                std::memcpy(data.data() + i*stride + normalOffset, &packed, sizeof(packed));
+            }
+            /* The packed type needs four components, which is not possible
+               with the three-component Shaders::Generic3D::Normal. The W
+               component is dropped by the shader. */
+            mesh.addVertexBuffer(vertexBufferRef, normalOffset, stride,
+                GL::DynamicAttribute{
+                    GL::DynamicAttribute::Kind::GenericNormalized,
+                    Shaders::Generic3D::Normal::Location,
+                    GL::DynamicAttribute::Components::Four,
+                    GL::DynamicAttribute::DataType::Int2101010Rev});
+            #else
+            for(std::size_t i = 0; i != normals.size(); ++i) {
+                const Math::Vector3<Short> packed = Math::pack<Math::Vector3<Short>>(normals[i]);
+                std::memcpy(data.data() + i*stride + normalOffset, packed.data(), sizeof(packed));
+            }
+            mesh.addVertexBuffer(vertexBufferRef, 0,
+                normalOffset,
+                Shaders::Generic3D::Normal{
+                    Shaders::Generic3D::Normal::DataType::Short,
+                    Shaders::Generic3D::Normal::DataOption::Normalized},
+                stride - normalOffset - sizeof(Math::Vector3<Short>));
+            #endif
+        } else {
+            for(std::size_t i = 0; i != normals.size(); ++i)
+                std::memcpy(data.data() + i*stride + normalOffset, normals[i].data(), sizeof(Vector3));
+            mesh.addVertexBuffer(vertexBufferRef, 0,
+                normalOffset,
+                Shaders::Generic3D::Normal(),
+                stride - normalOffset - sizeof(Shaders::Generic3D::Normal::Type));
+        }
     }
 
     /* Add also texture coordinates, if present */
     if(meshData.hasTextureCoords2D()) {
-        MeshTools::interleaveInto(data,
-            textureCoordsOffset,
-            meshData.textureCoords2D(0),
-            stride - textureCoordsOffset - sizeof(Shaders::Generic3D::TextureCoordinates::Type));
-        mesh.addVertexBuffer(vertexBufferRef, 0,
-            textureCoordsOffset,
-            Shaders::Generic3D::TextureCoordinates(),
-            stride - textureCoordsOffset - sizeof(Shaders::Generic3D::TextureCoordinates::Type));
+        const std::vector<Vector2>& textureCoords = meshData.textureCoords2D(0);
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        if(quantizeTextureCoords) {
+            for(std::size_t i = 0; i != textureCoords.size(); ++i) {
+                const Math::Vector2<UnsignedShort> packed = Math::packHalf(textureCoords[i]);
+                std::memcpy(data.data() + i*stride + textureCoordsOffset, packed.data(), sizeof(packed));
+            }
+            mesh.addVertexBuffer(vertexBufferRef, 0,
+                textureCoordsOffset,
+                Shaders::Generic3D::TextureCoordinates{
+                    Shaders::Generic3D::TextureCoordinates::DataType::HalfFloat},
+                stride - textureCoordsOffset - sizeof(Math::Vector2<UnsignedShort>));
+        } else
+        #endif
+        {
+            for(std::size_t i = 0; i != textureCoords.size(); ++i)
+                std::memcpy(data.data() + i*stride + textureCoordsOffset, textureCoords[i].data(), sizeof(Vector2));
+            mesh.addVertexBuffer(vertexBufferRef, 0,
+                textureCoordsOffset,
+                Shaders::Generic3D::TextureCoordinates(),
+                stride - textureCoordsOffset - sizeof(Shaders::Generic3D::TextureCoordinates::Type));
+        }
     }
 
     /* Add also colors, if present */
     if(meshData.hasColors()) {
-        MeshTools::interleaveInto(data,
-            colorsOffset,
-            meshData.colors(0),
-            stride - colorsOffset - sizeof(Shaders::Generic3D::Color4::Type));
+        const std::vector<Color4>& colors = meshData.colors(0);
+        for(std::size_t i = 0; i != colors.size(); ++i)
+            std::memcpy(data.data() + i*stride + colorsOffset, colors[i].data(), sizeof(Color4));
         mesh.addVertexBuffer(vertexBufferRef, 0,
             colorsOffset,
             Shaders::Generic3D::Color4(),
@@ -207,11 +311,308 @@ GL::Mesh compile(const Trade::MeshData3D& meshData) {
             .setIndexBuffer(std::move(indexBuffer), 0, indexType, indexStart, indexEnd);
 
     /* Else set vertex count */
-    } else mesh.setCount(meshData.positions(0).size());
+    } else mesh.setCount(positions.size());
+
+    return {std::move(mesh), positionTransformation};
+}
+
+namespace {
+
+/* Returns false if the type is not supported on this target */
+bool attributeDataType(const Trade::MeshBlobAttributeType type, GL::DynamicAttribute::DataType& out) {
+    switch(type) {
+        #define _c(type_) case Trade::MeshBlobAttributeType::type_: out = GL::DynamicAttribute::DataType::type_; return true;
+        _c(UnsignedByte)
+        _c(Byte)
+        _c(UnsignedShort)
+        _c(Short)
+        _c(UnsignedInt)
+        _c(Int)
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        _c(HalfFloat)
+        #endif
+        _c(Float)
+        #ifndef MAGNUM_TARGET_GLES2
+        _c(Int2101010Rev)
+        #endif
+        #undef _c
+        default: return false;
+    }
+}
+
+}
+
+GL::Mesh compile(const Trade::MeshBlob& blob) {
+    GL::Mesh mesh;
+    mesh.setPrimitive(blob.primitive());
+
+    /* Upload the vertex data as-is, put them in with ownership transfer for
+       the first attribute, use the ref for the rest */
+    GL::Buffer vertexBuffer{GL::Buffer::TargetHint::Array};
+    GL::Buffer vertexBufferRef = GL::Buffer::wrap(vertexBuffer.id(), GL::Buffer::TargetHint::Array);
+    vertexBuffer.setData(blob.vertexData(), GL::BufferUsage::StaticDraw);
+
+    for(std::size_t i = 0; i != blob.attributes().size(); ++i) {
+        const Trade::MeshBlobAttribute& attribute = blob.attributes()[i];
+
+        GL::DynamicAttribute::DataType type{};
+        if(!attributeDataType(attribute.type, type)) {
+            CORRADE_ASSERT(false,
+                "MeshTools::compile():" << attribute.type << "is not supported on this target", mesh);
+        }
+
+        const GL::DynamicAttribute dynamicAttribute{
+            attribute.normalized ? GL::DynamicAttribute::Kind::GenericNormalized : GL::DynamicAttribute::Kind::Generic,
+            attribute.location,
+            GL::DynamicAttribute::Components(attribute.components),
+            type};
+        if(i == 0) mesh.addVertexBuffer(std::move(vertexBuffer), attribute.offset, blob.stride(), dynamicAttribute);
+        else mesh.addVertexBuffer(vertexBufferRef, attribute.offset, blob.stride(), dynamicAttribute);
+    }
+
+    /* If indexed, upload the index data and configure indexed mesh */
+    if(blob.isIndexed()) {
+        GL::Buffer indexBuffer{GL::Buffer::TargetHint::ElementArray};
+        indexBuffer.setData(blob.indexData(), GL::BufferUsage::StaticDraw);
+        mesh.setCount(blob.indexCount())
+            .setIndexBuffer(std::move(indexBuffer), 0, blob.indexType(), blob.indexStart(), blob.indexEnd());
+
+    /* Else set vertex count */
+    } else mesh.setCount(blob.vertexCount());
+
+    return mesh;
+}
+
+GL::Mesh compile(const Trade::MeshData& meshData) {
+    GL::Mesh mesh;
+    mesh.setPrimitive(meshData.primitive());
+
+    /* Upload the vertex data as-is, put them in with ownership transfer for
+       the first bound attribute, use the ref for the rest */
+    GL::Buffer vertexBuffer{GL::Buffer::TargetHint::Array};
+    GL::Buffer vertexBufferRef = GL::Buffer::wrap(vertexBuffer.id(), GL::Buffer::TargetHint::Array);
+    vertexBuffer.setData(meshData.vertexData(), GL::BufferUsage::StaticDraw);
+
+    bool vertexBufferOwned = true;
+    bool bound[Int(Trade::MeshAttribute::Weights) + 1]{};
+    for(const Trade::MeshAttributeData& attribute: meshData.attributes()) {
+        /* Only the first attribute of each name has a generic location */
+        if(bound[Int(attribute.name)]) continue;
+
+        GL::DynamicAttribute::Kind kind = attribute.normalized ?
+            GL::DynamicAttribute::Kind::GenericNormalized :
+            GL::DynamicAttribute::Kind::Generic;
+        UnsignedInt location{};
+        switch(attribute.name) {
+            case Trade::MeshAttribute::Position:
+                location = Shaders::Generic3D::Position::Location;
+                break;
+            case Trade::MeshAttribute::Normal:
+                location = Shaders::Generic3D::Normal::Location;
+                break;
+            case Trade::MeshAttribute::TextureCoordinates:
+                location = Shaders::Generic3D::TextureCoordinates::Location;
+                break;
+            case Trade::MeshAttribute::Color:
+                location = Shaders::Generic3D::Color4::Location;
+                break;
+            case Trade::MeshAttribute::JointIds:
+                #ifndef MAGNUM_TARGET_GLES2
+                location = Shaders::Generic3D::JointIds::Location;
+                kind = GL::DynamicAttribute::Kind::Integral;
+                break;
+                #else
+                /* Integer attributes are not available on ES2, skip */
+                continue;
+                #endif
+            case Trade::MeshAttribute::Weights:
+                location = Shaders::Generic3D::Weights::Location;
+                break;
+        }
+
+        GL::DynamicAttribute::DataType type{};
+        if(!attributeDataType(attribute.type, type)) {
+            CORRADE_ASSERT(false,
+                "MeshTools::compile():" << attribute.type << "is not supported on this target", mesh);
+        }
+
+        const GL::DynamicAttribute dynamicAttribute{kind, location,
+            GL::DynamicAttribute::Components(attribute.components), type};
+        if(vertexBufferOwned) mesh.addVertexBuffer(std::move(vertexBuffer), attribute.offset, attribute.stride, dynamicAttribute);
+        else mesh.addVertexBuffer(vertexBufferRef, attribute.offset, attribute.stride, dynamicAttribute);
+        vertexBufferOwned = false;
+        bound[Int(attribute.name)] = true;
+    }
+
+    /* If indexed, upload the index data and configure indexed mesh */
+    if(meshData.isIndexed()) {
+        GL::Buffer indexBuffer{GL::Buffer::TargetHint::ElementArray};
+        indexBuffer.setData(meshData.indexData(), GL::BufferUsage::StaticDraw);
+        mesh.setCount(meshData.indexCount())
+            .setIndexBuffer(std::move(indexBuffer), 0, meshData.indexType());
+
+    /* Else set vertex count */
+    } else mesh.setCount(meshData.vertexCount());
 
     return mesh;
 }
 
+std::vector<GL::MeshView> compileIndicesWithBaseVertex(GL::Mesh& mesh, const std::vector<UnsignedInt>& indices) {
+    UnsignedInt primitiveSize{};
+    switch(mesh.primitive()) {
+        case GL::MeshPrimitive::Points: primitiveSize = 1; break;
+        case GL::MeshPrimitive::Lines: primitiveSize = 2; break;
+        case GL::MeshPrimitive::Triangles: primitiveSize = 3; break;
+        default: CORRADE_ASSERT(false,
+            "MeshTools::compileIndicesWithBaseVertex(): expected points, lines or triangles, got" << mesh.primitive(), {});
+    }
+
+    Containers::Array<UnsignedShort> indexData;
+    std::vector<CompressedIndexRange> ranges;
+    std::tie(indexData, ranges) = MeshTools::compressIndicesWithBaseVertex(indices, primitiveSize);
+
+    GL::Buffer indexBuffer{GL::Buffer::TargetHint::ElementArray};
+    indexBuffer.setData(indexData, GL::BufferUsage::StaticDraw);
+    mesh.setCount(0)
+        .setIndexBuffer(std::move(indexBuffer), 0, MeshIndexType::UnsignedShort);
+
+    std::vector<GL::MeshView> views;
+    views.reserve(ranges.size());
+    for(const CompressedIndexRange& range: ranges) {
+        views.emplace_back(mesh);
+        views.back().setCount(range.indexCount)
+            .setBaseVertex(range.baseVertex)
+            .setIndexRange(range.indexOffset, 0, range.indexEnd);
+    }
+
+    return views;
+}
+
+std::vector<GL::MeshView> compileBatch(GL::Mesh& mesh, const Containers::ArrayView<const std::reference_wrapper<const Trade::MeshData3D>> meshes, const Containers::ArrayView<const Matrix4> transformations) {
+    CORRADE_ASSERT(!meshes.empty(),
+        "MeshTools::compileBatch(): no meshes passed", {});
+    CORRADE_ASSERT(meshes.size() == transformations.size(),
+        "MeshTools::compileBatch(): expected" << meshes.size() << "transformations but got" << transformations.size(), {});
+
+    const Trade::MeshData3D& first = meshes[0];
+    std::size_t vertexCount = 0;
+    std::size_t indexCount = 0;
+    for(const Trade::MeshData3D& meshData: meshes) {
+        CORRADE_ASSERT(meshData.primitive() == first.primitive() &&
+            meshData.isIndexed() == first.isIndexed() &&
+            meshData.hasNormals() == first.hasNormals() &&
+            meshData.hasTextureCoords2D() == first.hasTextureCoords2D() &&
+            meshData.hasColors() == first.hasColors(),
+            "MeshTools::compileBatch(): expected all meshes to have the same primitive and attributes", {});
+        vertexCount += meshData.positions(0).size();
+        if(meshData.isIndexed()) indexCount += meshData.indices().size();
+    }
+
+    /* Same layout as in non-quantized compile() */
+    const UnsignedInt normalOffset = sizeof(Shaders::Generic3D::Position::Type);
+    const UnsignedInt textureCoordsOffset = normalOffset + (first.hasNormals() ?
+        sizeof(Shaders::Generic3D::Normal::Type) : 0);
+    const UnsignedInt colorsOffset = textureCoordsOffset + (first.hasTextureCoords2D() ?
+        sizeof(Shaders::Generic3D::TextureCoordinates::Type) : 0);
+    const UnsignedInt stride = colorsOffset + (first.hasColors() ?
+        sizeof(Shaders::Generic3D::Color4::Type) : 0);
+
+    /* Copy the data of each mesh after each other and transform them in place
+       in the interleaved array */
+    Containers::Array<char> data{Containers::NoInit, stride*vertexCount};
+    std::vector<UnsignedInt> indices;
+    indices.reserve(indexCount);
+    std::vector<std::size_t> vertexOffsets(meshes.size() + 1);
+    std::vector<std::size_t> indexOffsets(meshes.size() + 1);
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const Trade::MeshData3D& meshData = meshes[i];
+        const std::vector<Vector3>& positions = meshData.positions(0);
+        const std::size_t vertexOffset = vertexOffsets[i];
+        char* const vertexData = data.data() + vertexOffset*stride;
+
+        for(std::size_t j = 0; j != positions.size(); ++j)
+            std::memcpy(vertexData + j*stride, positions[j].data(), sizeof(Vector3));
+        transformPointsInPlace(transformations[i], Containers::StridedArrayView<Vector3>{reinterpret_cast<Vector3*>(vertexData), positions.size(), stride});
+
+        if(meshData.hasNormals()) {
+            const std::vector<Vector3>& normals = meshData.normals(0);
+            for(std::size_t j = 0; j != normals.size(); ++j)
+                std::memcpy(vertexData + j*stride + normalOffset, normals[j].data(), sizeof(Vector3));
+            transformNormalsInPlace(transformations[i], Containers::StridedArrayView<Vector3>{reinterpret_cast<Vector3*>(vertexData + normalOffset), normals.size(), stride});
+        }
+
+        if(meshData.hasTextureCoords2D()) {
+            const std::vector<Vector2>& textureCoords = meshData.textureCoords2D(0);
+            for(std::size_t j = 0; j != textureCoords.size(); ++j)
+                std::memcpy(vertexData + j*stride + textureCoordsOffset, textureCoords[j].data(), sizeof(Vector2));
+        }
+
+        if(meshData.hasColors()) {
+            const std::vector<Color4>& colors = meshData.colors(0);
+            for(std::size_t j = 0; j != colors.size(); ++j)
+                std::memcpy(vertexData + j*stride + colorsOffset, colors[j].data(), sizeof(Color4));
+        }
+
+        if(meshData.isIndexed()) for(const UnsignedInt index: meshData.indices())
+            indices.push_back(vertexOffset + index);
+
+        vertexOffsets[i + 1] = vertexOffset + positions.size();
+        indexOffsets[i + 1] = indices.size();
+    }
+
+    mesh = GL::Mesh{first.primitive()};
+
+    /* Put positions in with ownership transfer, use the ref for the rest */
+    GL::Buffer vertexBuffer{GL::Buffer::TargetHint::Array};
+    GL::Buffer vertexBufferRef = GL::Buffer::wrap(vertexBuffer.id(), GL::Buffer::TargetHint::Array);
+    vertexBufferRef.setData(data, GL::BufferUsage::StaticDraw);
+    mesh.addVertexBuffer(std::move(vertexBuffer), 0,
+        Shaders::Generic3D::Position(),
+        stride - sizeof(Shaders::Generic3D::Position::Type));
+    if(first.hasNormals()) mesh.addVertexBuffer(vertexBufferRef, 0,
+        normalOffset,
+        Shaders::Generic3D::Normal(),
+        stride - normalOffset - sizeof(Shaders::Generic3D::Normal::Type));
+    if(first.hasTextureCoords2D()) mesh.addVertexBuffer(vertexBufferRef, 0,
+        textureCoordsOffset,
+        Shaders::Generic3D::TextureCoordinates(),
+        stride - textureCoordsOffset - sizeof(Shaders::Generic3D::TextureCoordinates::Type));
+    if(first.hasColors()) mesh.addVertexBuffer(vertexBufferRef, 0,
+        colorsOffset,
+        Shaders::Generic3D::Color4(),
+        stride - colorsOffset - sizeof(Shaders::Generic3D::Color4::Type));
+
+    /* If indexed, fill index buffer and configure indexed mesh */
+    if(first.isIndexed()) {
+        Containers::Array<char> indexData;
+        MeshIndexType indexType;
+        UnsignedInt indexStart, indexEnd;
+        std::tie(indexData, indexType, indexStart, indexEnd) = MeshTools::compressIndices(indices);
+
+        GL::Buffer indexBuffer{GL::Buffer::TargetHint::ElementArray};
+        indexBuffer.setData(indexData, GL::BufferUsage::StaticDraw);
+        mesh.setCount(indices.size())
+            .setIndexBuffer(std::move(indexBuffer), 0, indexType, indexStart, indexEnd);
+
+    /* Else set vertex count */
+    } else mesh.setCount(vertexCount);
+
+    /* The views need the index buffer to be already set */
+    std::vector<GL::MeshView> views;
+    views.reserve(meshes.size());
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        views.emplace_back(mesh);
+        if(first.isIndexed()) views.back()
+            .setCount(indexOffsets[i + 1] - indexOffsets[i])
+            .setIndexRange(indexOffsets[i], vertexOffsets[i], Math::max(vertexOffsets[i + 1], vertexOffsets[i] + 1) - 1);
+        else views.back()
+            .setCount(vertexOffsets[i + 1] - vertexOffsets[i])
+            .setBaseVertex(vertexOffsets[i]);
+    }
+
+    return views;
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 std::tuple<GL::Mesh, std::unique_ptr<GL::Buffer>, std::unique_ptr<GL::Buffer>> compile(const Trade::MeshData3D& meshData, GL::BufferUsage) {
     return std::make_tuple(compile(meshData),
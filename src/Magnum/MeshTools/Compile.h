@@ -26,13 +26,22 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compile()
+ * @brief Function @ref Magnum::MeshTools::compile(), @ref Magnum::MeshTools::compileIndicesWithBaseVertex(), @ref Magnum::MeshTools::compileBatch(), enum @ref Magnum::MeshTools::CompileFlag, enum set @ref Magnum::MeshTools::CompileFlags
  */
 
 #include "Magnum/configure.h"
 
 #ifdef MAGNUM_TARGET_GL
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
 #include "Magnum/GL/GL.h"
+#include "Magnum/GL/MeshView.h"
 #include "Magnum/Trade/Trade.h"
 #include "Magnum/MeshTools/visibility.h"
 
@@ -78,6 +87,45 @@ MAGNUM_MESHTOOLS_EXPORT GL::Mesh compile(const Trade::MeshData2D& meshData);
 CORRADE_DEPRECATED("use compile(const Trade::MeshData2D&) instead") MAGNUM_MESHTOOLS_EXPORT std::tuple<GL::Mesh, std::unique_ptr<GL::Buffer>, std::unique_ptr<GL::Buffer>> compile(const Trade::MeshData2D& meshData, GL::BufferUsage usage);
 #endif
 
+/**
+@brief Mesh compilation flag
+
+@see @ref CompileFlags, @ref compile(const Trade::MeshData3D&, CompileFlags)
+*/
+enum class CompileFlag: UnsignedByte {
+    /**
+     * Quantize positions to normalized 16-bit unsigned integers inside the
+     * mesh bounding box. The shader then has to apply the returned
+     * dequantization transformation.
+     */
+    QuantizePositions = 1 << 0,
+
+    /**
+     * Quantize normals to a signed normalized 2.10.10.10 packed format. On
+     * OpenGL ES 2.0 and WebGL 1.0, where packed attributes are not available,
+     * normalized 16-bit signed integers are used instead.
+     */
+    QuantizeNormals = 1 << 1,
+
+    /**
+     * Convert texture coordinates to half floats. On WebGL 1.0, where half
+     * float attributes are not available, this flag has no effect.
+     * @requires_gl30 Extension @gl_extension{ARB,half_float_vertex}
+     * @requires_gles30 Extension @gl_extension{OES,vertex_half_float} in
+     *      OpenGL ES 2.0
+     */
+    QuantizeTextureCoordinates = 1 << 2
+};
+
+/**
+@brief Mesh compilation flags
+
+@see @ref compile(const Trade::MeshData3D&, CompileFlags)
+*/
+typedef Containers::EnumSet<CompileFlag> CompileFlags;
+
+CORRADE_ENUMSET_OPERATORS(CompileFlags)
+
 /**
 @brief Compile 3D mesh data
 
@@ -105,6 +153,141 @@ greater flexibility.
 */
 MAGNUM_MESHTOOLS_EXPORT GL::Mesh compile(const Trade::MeshData3D& meshData);
 
+/**
+@brief Compile 3D mesh data with quantized attributes
+@return Compiled mesh and a transformation that has to be applied to the
+    positions to get them back to the original space
+
+Like @ref compile(const Trade::MeshData3D&), but with attributes selected by
+@p flags stored in a smaller type. With all flags enabled the vertex size is
+reduced from 32 bytes to 16 bytes for a mesh with positions, normals and
+texture coordinates, at a cost of some precision. All attributes are padded to
+four-byte boundaries. The attributes are still bound to the same
+@ref Shaders::Generic3D locations as floating-point vectors, the conversion
+is done by the vertex fetch hardware.
+
+If @ref CompileFlag::QuantizePositions is set, the returned transformation
+translates and scales the @f$ [0, 1]^3 @f$ cube to the bounding box of the
+original positions and has to be applied before the object transformation,
+otherwise it's an identity.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::pair<GL::Mesh, Matrix4> compile(const Trade::MeshData3D& meshData, CompileFlags flags);
+
+/**
+@brief Compile a mesh blob
+
+Uploads vertex and index data of @p blob to GPU buffers owned by the mesh as-is,
+without any processing, and configures the attributes according to
+@ref Trade::MeshBlob::attributes(). Integer attributes are converted to
+floating-point vectors, either normalized or not based on
+@ref Trade::MeshBlobAttribute::normalized. Both buffers are created with
+@ref GL::BufferUsage::StaticDraw.
+
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+
+@requires_gl30 Extension @gl_extension{ARB,half_float_vertex} for
+    @ref Trade::MeshBlobAttributeType::HalfFloat
+@requires_gl33 Extension @gl_extension{ARB,vertex_type_2_10_10_10_rev} for
+    @ref Trade::MeshBlobAttributeType::Int2101010Rev
+@requires_gles30 Extension @gl_extension{OES,vertex_half_float} for
+    @ref Trade::MeshBlobAttributeType::HalfFloat in OpenGL ES 2.0.
+    @ref Trade::MeshBlobAttributeType::Int2101010Rev is not available in
+    OpenGL ES 2.0.
+@requires_webgl20 @ref Trade::MeshBlobAttributeType::HalfFloat and
+    @ref Trade::MeshBlobAttributeType::Int2101010Rev are not available in
+    WebGL 1.0.
+*/
+MAGNUM_MESHTOOLS_EXPORT GL::Mesh compile(const Trade::MeshBlob& blob);
+
+/**
+@brief Compile a mesh data
+
+Uploads vertex and index data of @p meshData to GPU buffers owned by the mesh
+as-is, without any processing or conversion, so for example half-float
+texture coordinates, normals or colors stay at half size also on the GPU.
+The first attribute of each @ref Trade::MeshAttribute is bound to the
+corresponding @ref Shaders::Generic attribute location, other attributes are
+ignored. Integer attributes are converted to floating-point vectors, either
+normalized or not based on @ref Trade::MeshAttributeData::normalized, except
+for @ref Trade::MeshAttribute::JointIds, which are bound as integer
+attributes and are ignored on OpenGL ES 2.0 and WebGL 1.0. Both buffers are created with @ref GL::BufferUsage::StaticDraw.
+
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+
+@requires_gl30 Extension @gl_extension{ARB,half_float_vertex} for
+    @ref Trade::MeshBlobAttributeType::HalfFloat
+@requires_gl33 Extension @gl_extension{ARB,vertex_type_2_10_10_10_rev} for
+    @ref Trade::MeshBlobAttributeType::Int2101010Rev
+@requires_gles30 Extension @gl_extension{OES,vertex_half_float} for
+    @ref Trade::MeshBlobAttributeType::HalfFloat in OpenGL ES 2.0.
+    @ref Trade::MeshBlobAttributeType::Int2101010Rev is not available in
+    OpenGL ES 2.0.
+@requires_webgl20 @ref Trade::MeshBlobAttributeType::HalfFloat and
+    @ref Trade::MeshBlobAttributeType::Int2101010Rev are not available in
+    WebGL 1.0.
+*/
+MAGNUM_MESHTOOLS_EXPORT GL::Mesh compile(const Trade::MeshData& meshData);
+
+/**
+@brief Compile 16-bit index buffer with base vertex ranges
+@param mesh     Mesh with vertex buffers already set up
+@param indices  Index array
+@return Views for all ranges in the index buffer
+
+Compresses @p indices using @ref compressIndicesWithBaseVertex(), uploads
+them to an index buffer owned by @p mesh and returns a view of @p mesh for
+each range, with base vertex and index range set. The primitive size is taken
+from @ref GL::Mesh::primitive(), which is expected to be one of
+@ref GL::MeshPrimitive::Points, @ref GL::MeshPrimitive::Lines or
+@ref GL::MeshPrimitive::Triangles. The mesh count is set to @cpp 0 @ce, draw
+the returned views instead, for example using
+@ref GL::MeshView::draw(AbstractShaderProgram&, std::initializer_list<std::reference_wrapper<MeshView>>).
+
+This allows meshes with more than 65536 vertices to still use 16-bit indices,
+halving index memory and bandwidth compared to @ref compile().
+
+@requires_gl32 Extension @gl_extension{ARB,draw_elements_base_vertex}
+@requires_gles32 Base vertex cannot be specified for indexed meshes in OpenGL
+    ES 3.1 or WebGL.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<GL::MeshView> compileIndicesWithBaseVertex(GL::Mesh& mesh, const std::vector<UnsignedInt>& indices);
+
+/**
+@brief Compile a batch of static 3D meshes into a single mesh
+@param mesh             Mesh to compile into
+@param meshes           Meshes to compile
+@param transformations  Transformation of each mesh
+@return Views for all meshes in the batch
+
+Transforms positions and normals of each mesh in @p meshes with the
+corresponding transformation using @ref transformPointsInPlace(const Matrix4&, Containers::StridedArrayView<Vector3>)
+and @ref transformNormalsInPlace(), concatenates all of them into a single
+interleaved vertex buffer and a single index buffer and replaces contents of
+@p mesh with them. The vertex layout and attribute bindings are the same as
+with @ref compile(const Trade::MeshData3D&). Returns one view of @p mesh for
+each mesh in @p meshes, so instead of thousands of separate meshes and vertex
+array switches, static level geometry can be drawn from a single mesh, for
+example by passing all views that share a material to
+@ref GL::MeshView::draw(AbstractShaderProgram&, Containers::ArrayView<const std::reference_wrapper<MeshView>>).
+The @p mesh itself is configured to draw the whole batch.
+
+Index buffer of the batch is rebased to absolute vertex positions and then
+compressed to the smallest type that can hold all indices, so base vertex
+support is not needed. Expects that @p meshes is not empty and has the same
+size as @p transformations and that all meshes have the same primitive, all or
+none of them are indexed and they have the same set of attributes.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<GL::MeshView> compileBatch(GL::Mesh& mesh, Containers::ArrayView<const std::reference_wrapper<const Trade::MeshData3D>> meshes, Containers::ArrayView<const Matrix4> transformations);
+
+/** @overload */
+inline std::vector<GL::MeshView> compileBatch(GL::Mesh& mesh, std::initializer_list<std::reference_wrapper<const Trade::MeshData3D>> meshes, std::initializer_list<Matrix4> transformations) {
+    return compileBatch(mesh, Containers::arrayView(meshes.begin(), meshes.size()), Containers::arrayView(transformations.begin(), transformations.size()));
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /** @brief @copybrief compile(const Trade::MeshData3D&)
  * @deprecated Use @ref compile(const Trade::MeshData3D&) instead. The @p usage
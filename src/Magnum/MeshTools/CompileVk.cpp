@@ -0,0 +1,136 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CompileVk.h"
+
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/MeshTools/CompressIndices.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Vk/Buffer.h"
+#include "Magnum/Vk/Mesh.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Same as in Shaders::Generic, which can't be used here as it's GL-specific */
+enum: UnsignedInt {
+    PositionLocation = 0,
+    TextureCoordinatesLocation = 1,
+    NormalLocation = 2,
+    ColorLocation = 3
+};
+
+template<class T> void interleaveInto(char* const data, const UnsignedInt stride, const UnsignedInt offset, const std::vector<T>& attribute) {
+    for(std::size_t i = 0; i != attribute.size(); ++i)
+        std::memcpy(data + i*stride + offset, &attribute[i], sizeof(T));
+}
+
+template<class T> Vk::Buffer indexBuffer(const std::vector<UnsignedInt>& indices, Vk::Device& device, Vk::MemoryAllocator& allocator) {
+    const Containers::Array<T> data = compressIndicesAs<T>(indices);
+    Vk::Buffer buffer{device, Vk::BufferCreateInfo{Vk::BufferUsage::IndexBuffer,
+        data.size()*sizeof(T)}, allocator, Vk::MemoryFlag::HostVisible};
+    buffer.setData(data);
+    return buffer;
+}
+
+template<class T> Vk::Mesh compileInternal(const T& meshData, const std::vector<Vector3>* const normals, Vk::Device& device, Vk::MemoryAllocator& allocator) {
+    typedef typename std::decay<decltype(meshData.positions(0).front())>::type PositionType;
+    const std::vector<PositionType>& positions = meshData.positions(0);
+
+    /* Decide about stride and offsets */
+    const UnsignedInt normalOffset = sizeof(PositionType);
+    const UnsignedInt textureCoordsOffset = normalOffset +
+        (normals ? sizeof(Vector3) : 0);
+    const UnsignedInt colorsOffset = textureCoordsOffset +
+        (meshData.hasTextureCoords2D() ? sizeof(Vector2) : 0);
+    const UnsignedInt stride = colorsOffset +
+        (meshData.hasColors() ? sizeof(Color4) : 0);
+
+    Vk::MeshLayout layout{meshData.primitive()};
+    layout.addBinding(0, stride)
+        .addAttribute(PositionLocation, 0, PositionType::Size == 2 ?
+            VK_FORMAT_R32G32_SFLOAT : VK_FORMAT_R32G32B32_SFLOAT, 0);
+    if(normals) layout.addAttribute(NormalLocation, 0,
+        VK_FORMAT_R32G32B32_SFLOAT, normalOffset);
+    if(meshData.hasTextureCoords2D()) layout.addAttribute(
+        TextureCoordinatesLocation, 0, VK_FORMAT_R32G32_SFLOAT,
+        textureCoordsOffset);
+    if(meshData.hasColors()) layout.addAttribute(ColorLocation, 0,
+        VK_FORMAT_R32G32B32A32_SFLOAT, colorsOffset);
+    Vk::Mesh mesh{layout};
+
+    /* Interleave the vertex data directly into the mapped memory */
+    Vk::Buffer vertexBuffer{device, Vk::BufferCreateInfo{
+        Vk::BufferUsage::VertexBuffer, std::max<UnsignedLong>(stride*positions.size(), 1)},
+        allocator, Vk::MemoryFlag::HostVisible};
+    char* const data = vertexBuffer.data();
+    interleaveInto(data, stride, 0, positions);
+    if(normals)
+        interleaveInto(data, stride, normalOffset, *normals);
+    if(meshData.hasTextureCoords2D())
+        interleaveInto(data, stride, textureCoordsOffset, meshData.textureCoords2D(0));
+    if(meshData.hasColors())
+        interleaveInto(data, stride, colorsOffset, meshData.colors(0));
+    vertexBuffer.flush();
+    mesh.addVertexBuffer(0, std::move(vertexBuffer));
+
+    if(!meshData.isIndexed()) {
+        mesh.setCount(positions.size());
+        return mesh;
+    }
+
+    /* Vulkan doesn't support 8-bit indices without an extension, so use
+       16-bit ones if possible and 32-bit otherwise */
+    const std::vector<UnsignedInt>& indices = meshData.indices();
+    if(*std::max_element(indices.begin(), indices.end()) <= 0xffff)
+        mesh.setIndexBuffer(indexBuffer<UnsignedShort>(indices, device, allocator),
+            0, MeshIndexType::UnsignedShort);
+    else
+        mesh.setIndexBuffer(indexBuffer<UnsignedInt>(indices, device, allocator),
+            0, MeshIndexType::UnsignedInt);
+    mesh.setCount(indices.size());
+    return mesh;
+}
+
+}
+
+Vk::Mesh compile(const Trade::MeshData2D& meshData, Vk::Device& device, Vk::MemoryAllocator& allocator) {
+    return compileInternal(meshData, nullptr, device, allocator);
+}
+
+Vk::Mesh compile(const Trade::MeshData3D& meshData, Vk::Device& device, Vk::MemoryAllocator& allocator) {
+    return compileInternal(meshData, meshData.hasNormals() ?
+        &meshData.normals(0) : nullptr, device, allocator);
+}
+
+}}
@@ -0,0 +1,87 @@
+#ifndef Magnum_MeshTools_CompileVk_h
+#define Magnum_MeshTools_CompileVk_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::compile(const Trade::MeshData3D&, Vk::Device&, Vk::MemoryAllocator&)
+ */
+
+#include "Magnum/configure.h"
+
+#ifdef MAGNUM_TARGET_VK
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Compile 2D mesh data for Vulkan
+@param meshData     Mesh data
+@param device       Device to create the buffers on
+@param allocator    Allocator to allocate buffer memory from
+
+Vulkan counterpart to @ref compile(const Trade::MeshData2D&). Interleaves
+positions and, if present, the first set of texture coordinates and colors
+into a single vertex buffer at binding @cpp 0 @ce. Attribute locations are
+the same as in @ref Shaders::Generic, i.e. position at @cpp 0 @ce, texture
+coordinates at @cpp 1 @ce and color at @cpp 3 @ce, all as 32-bit floats.
+If the mesh is indexed, the indices are compressed to 16-bit or 32-bit type
+and put into a separate index buffer. Both buffers are owned by the returned
+mesh, use @ref Vk::Mesh::layout() to create a compatible pipeline.
+
+The buffers are allocated from @ref Vk::MemoryFlag::HostVisible memory and
+filled directly. Copying them to device-local memory using
+@ref Vk::CommandBuffer::copyBuffer() is left to the user. Expects that the
+mesh primitive is supported, see @ref Vk::hasVkPrimitiveTopology().
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_VK enabled (done by default if the Vk library is
+    built). See @ref building-features for more information.
+*/
+MAGNUM_MESHTOOLS_EXPORT Vk::Mesh compile(const Trade::MeshData2D& meshData, Vk::Device& device, Vk::MemoryAllocator& allocator);
+
+/**
+@brief Compile 3D mesh data for Vulkan
+@param meshData     Mesh data
+@param device       Device to create the buffers on
+@param allocator    Allocator to allocate buffer memory from
+
+Like @ref compile(const Trade::MeshData2D&, Vk::Device&, Vk::MemoryAllocator&),
+but additionally interleaves the first set of normals at location
+@cpp 2 @ce, same as @ref Shaders::Generic::Normal.
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_VK enabled (done by default if the Vk library is
+    built). See @ref building-features for more information.
+*/
+MAGNUM_MESHTOOLS_EXPORT Vk::Mesh compile(const Trade::MeshData3D& meshData, Vk::Device& device, Vk::MemoryAllocator& allocator);
+
+}}
+#else
+#error this header is available only in the Vulkan build
+#endif
+
+#endif
@@ -27,6 +27,7 @@
 
 #include <cstring>
 #include <algorithm>
+#include <limits>
 #include <Corrade/Containers/Array.h>
 
 #include "Magnum/Math/Functions.h"
@@ -91,4 +92,60 @@ template Containers::Array<UnsignedByte> compressIndicesAs(const std::vector<Uns
 template Containers::Array<UnsignedShort> compressIndicesAs(const std::vector<UnsignedInt>& indices);
 template Containers::Array<UnsignedInt> compressIndicesAs(const std::vector<UnsignedInt>& indices);
 
+template<class T> void compressIndicesInto(const Containers::StridedArrayView<const UnsignedInt>& indices, const Containers::StridedArrayView<T>& out) {
+    CORRADE_ASSERT(out.size() == indices.size(),
+        "MeshTools::compressIndicesInto(): bad output size, expected" << indices.size() << "but got" << out.size(), );
+
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt index = indices[i];
+        CORRADE_ASSERT(index <= std::numeric_limits<T>::max(), "MeshTools::compressIndicesInto(): type too small to represent value" << index, );
+        out[i] = T(index);
+    }
+}
+
+template void compressIndicesInto(const Containers::StridedArrayView<const UnsignedInt>&, const Containers::StridedArrayView<UnsignedByte>&);
+template void compressIndicesInto(const Containers::StridedArrayView<const UnsignedInt>&, const Containers::StridedArrayView<UnsignedShort>&);
+template void compressIndicesInto(const Containers::StridedArrayView<const UnsignedInt>&, const Containers::StridedArrayView<UnsignedInt>&);
+
+std::pair<Containers::Array<UnsignedShort>, std::vector<CompressedIndexRange>> compressIndicesWithBaseVertex(const std::vector<UnsignedInt>& indices, const UnsignedInt primitiveSize) {
+    CORRADE_ASSERT(primitiveSize >= 1 && primitiveSize <= 3,
+        "MeshTools::compressIndicesWithBaseVertex(): expected primitive size to be 1, 2 or 3, got" << primitiveSize, {});
+    CORRADE_ASSERT(!(indices.size()%primitiveSize),
+        "MeshTools::compressIndicesWithBaseVertex(): index count" << indices.size() << "is not divisible by" << primitiveSize, {});
+
+    Containers::Array<UnsignedShort> out(indices.size());
+    std::vector<CompressedIndexRange> ranges;
+
+    /* Greedily extend the current range as long as all its indices fit into
+       16 bits relative to its minimum */
+    constexpr UnsignedInt MaxRange = std::numeric_limits<UnsignedShort>::max();
+    std::size_t rangeBegin = 0;
+    UnsignedInt rangeMin = ~UnsignedInt{}, rangeMax = 0;
+    auto flush = [&](const std::size_t end) {
+        ranges.push_back({UnsignedInt(rangeBegin), UnsignedInt(end - rangeBegin), rangeMin, rangeMax - rangeMin});
+        for(std::size_t i = rangeBegin; i != end; ++i)
+            out[i] = UnsignedShort(indices[i] - rangeMin);
+    };
+    for(std::size_t i = 0; i != indices.size(); i += primitiveSize) {
+        const auto minmax = std::minmax_element(indices.begin() + i, indices.begin() + i + primitiveSize);
+        CORRADE_ASSERT(*minmax.second - *minmax.first <= MaxRange,
+            "MeshTools::compressIndicesWithBaseVertex(): primitive" << i/primitiveSize << "spans more than 65536 vertices", {});
+
+        const UnsignedInt min = Math::min(rangeMin, *minmax.first);
+        const UnsignedInt max = Math::max(rangeMax, *minmax.second);
+        if(i != rangeBegin && max - min > MaxRange) {
+            flush(i);
+            rangeBegin = i;
+            rangeMin = *minmax.first;
+            rangeMax = *minmax.second;
+        } else {
+            rangeMin = min;
+            rangeMax = max;
+        }
+    }
+    if(rangeBegin != indices.size()) flush(indices.size());
+
+    return {std::move(out), std::move(ranges)};
+}
+
 }}
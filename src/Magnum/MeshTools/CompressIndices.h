@@ -26,11 +26,13 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compressIndices()
+ * @brief Struct @ref Magnum::MeshTools::CompressedIndexRange, function @ref Magnum::MeshTools::compressIndices(), @ref Magnum::MeshTools::compressIndicesAs(), @ref Magnum::MeshTools::compressIndicesInto(), @ref Magnum::MeshTools::compressIndicesWithBaseVertex()
  */
 
 #include <tuple>
+#include <utility>
 #include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshTools/visibility.h"
@@ -67,7 +69,7 @@ Example usage:
 
 @snippet MagnumMeshTools.cpp compressIndicesAs
 
-@see @ref compressIndices()
+@see @ref compressIndices(), @ref compressIndicesInto()
 */
 template<class T> MAGNUM_MESHTOOLS_EXPORT Containers::Array<T> compressIndicesAs(const std::vector<UnsignedInt>& indices);
 
@@ -77,6 +79,72 @@ extern template MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedShort> compres
 extern template MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> compressIndicesAs<UnsignedInt>(const std::vector<UnsignedInt>& indices);
 #endif
 
+/**
+@brief Compress vertex indices as given type into existing buffer
+@param[in]  indices Index array
+@param[out] out     Where to put the compressed indices
+
+Same as @ref compressIndicesAs(), but operates on strided views and writes
+the output into a caller-provided buffer, for example directly into a mapped
+index buffer. Expects that @p out has the same size as @p indices and all
+values are representable with given type.
+*/
+template<class T> MAGNUM_MESHTOOLS_EXPORT void compressIndicesInto(const Containers::StridedArrayView<const UnsignedInt>& indices, const Containers::StridedArrayView<T>& out);
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template MAGNUM_MESHTOOLS_EXPORT void compressIndicesInto<UnsignedByte>(const Containers::StridedArrayView<const UnsignedInt>&, const Containers::StridedArrayView<UnsignedByte>&);
+extern template MAGNUM_MESHTOOLS_EXPORT void compressIndicesInto<UnsignedShort>(const Containers::StridedArrayView<const UnsignedInt>&, const Containers::StridedArrayView<UnsignedShort>&);
+extern template MAGNUM_MESHTOOLS_EXPORT void compressIndicesInto<UnsignedInt>(const Containers::StridedArrayView<const UnsignedInt>&, const Containers::StridedArrayView<UnsignedInt>&);
+#endif
+
+/**
+@brief Range of indices compressed relative to a base vertex
+
+@see @ref compressIndicesWithBaseVertex()
+*/
+struct CompressedIndexRange {
+    /** @brief Offset of the first index in the compressed index array */
+    UnsignedInt indexOffset;
+
+    /** @brief Index count */
+    UnsignedInt indexCount;
+
+    /**
+     * @brief Base vertex
+     *
+     * Value that was subtracted from all indices in the range. The smallest
+     * index in the range is always @cpp 0 @ce.
+     */
+    UnsignedInt baseVertex;
+
+    /** @brief Largest index in the range, relative to @ref baseVertex */
+    UnsignedInt indexEnd;
+};
+
+/**
+@brief Compress vertex indices to 16 bits with base vertex
+@param indices          Index array
+@param primitiveSize    Primitive size, @cpp 3 @ce for triangles,
+    @cpp 2 @ce for lines and @cpp 1 @ce for points
+@return Compressed index array and a list of ranges
+
+Unlike @ref compressIndices(), which falls back to 32-bit indices for the
+whole mesh once it has more than 65536 vertices, this function splits the
+index array into consecutive ranges with each spanning at most 65536 vertices.
+Indices in each range are stored relative to the smallest index in it, which
+is then meant to be passed to @ref GL::MeshView::setBaseVertex(). Primitives
+are never split between two ranges. See
+@ref compileIndicesWithBaseVertex() for a function that creates the index
+buffer and mesh views directly.
+
+The count of produced ranges depends on vertex locality of the index array,
+run @ref optimizeVertexFetch() beforehand to reorder the vertices in the order
+of their first use. Expects that the index count is divisible by
+@p primitiveSize and that each primitive on its own spans at most 65536
+vertices.
+*/
+std::pair<Containers::Array<UnsignedShort>, std::vector<CompressedIndexRange>> MAGNUM_MESHTOOLS_EXPORT compressIndicesWithBaseVertex(const std::vector<UnsignedInt>& indices, UnsignedInt primitiveSize = 3);
+
 }}
 
 #endif
@@ -26,11 +26,13 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::duplicate()
+ * @brief Function @ref Magnum::MeshTools::duplicate(), @ref Magnum::MeshTools::duplicateInto()
  */
 
 #include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
 
 #include "Magnum/Types.h"
 
@@ -41,7 +43,8 @@ namespace Magnum { namespace MeshTools {
 
 Converts indexed array to non-indexed, for example data `{a, b, c, d}` with
 index array `{1, 1, 0, 3, 2, 2}` will be converted to `{b, b, a, d, c, c}`.
-@see @ref removeDuplicates(), @ref combineIndexedArrays()
+@see @ref duplicateInto(), @ref removeDuplicates(),
+    @ref combineIndexedArrays()
 */
 template<class T> std::vector<T> duplicate(const std::vector<UnsignedInt>& indices, const std::vector<T>& data) {
     std::vector<T> out;
@@ -53,6 +56,28 @@ template<class T> std::vector<T> duplicate(const std::vector<UnsignedInt>& indic
     return out;
 }
 
+/**
+@brief Duplicate data using index array into existing buffer
+@param[in]  indices Index array
+@param[in]  data    Input data
+@param[out] out     Where to store the output
+
+Same as @ref duplicate(), but operates on strided views and writes the output
+into a caller-provided buffer, for example directly into interleaved vertex
+data or mapped GPU memory. Expects that @p out has the same size as
+@p indices and all indices are in range for @p data.
+*/
+template<class T> void duplicateInto(const Containers::StridedArrayView<const UnsignedInt>& indices, const Containers::StridedArrayView<const T>& data, const Containers::StridedArrayView<T>& out) {
+    CORRADE_ASSERT(out.size() == indices.size(),
+        "MeshTools::duplicateInto(): bad output size, expected" << indices.size() << "but got" << out.size(), );
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt index = indices[i];
+        CORRADE_ASSERT(index < data.size(),
+            "MeshTools::duplicateInto(): index" << index << "out of bounds for" << data.size() << "elements", );
+        out[i] = data[index];
+    }
+}
+
 }}
 
 #endif
@@ -32,14 +32,24 @@ namespace Magnum { namespace MeshTools {
 void flipFaceWinding(std::vector<UnsignedInt>& indices) {
     CORRADE_ASSERT(!(indices.size()%3), "MeshTools::flipNormals(): index count is not divisible by 3!", );
 
+    flipFaceWindingInPlace(Containers::StridedArrayView<UnsignedInt>{indices.data(), indices.size(), sizeof(UnsignedInt)});
+}
+
+void flipNormals(std::vector<Vector3>& normals) {
+    flipNormalsInPlace(Containers::StridedArrayView<Vector3>{normals.data(), normals.size(), sizeof(Vector3)});
+}
+
+void flipFaceWindingInPlace(const Containers::StridedArrayView<UnsignedInt>& indices) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::flipFaceWindingInPlace(): index count is not divisible by 3!", );
+
     using std::swap;
     for(std::size_t i = 0; i != indices.size(); i += 3)
         swap(indices[i+1], indices[i+2]);
 }
 
-void flipNormals(std::vector<Vector3>& normals) {
-    for(Vector3& normal: normals)
-        normal = -normal;
+void flipNormalsInPlace(const Containers::StridedArrayView<Vector3>& normals) {
+    for(std::size_t i = 0; i != normals.size(); ++i)
+        normals[i] = -normals[i];
 }
 
 }}
@@ -26,10 +26,11 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::flipFaceWinding(), @ref Magnum::MeshTools::flipNormals()
+ * @brief Function @ref Magnum::MeshTools::flipFaceWinding(), @ref Magnum::MeshTools::flipNormals(), @ref Magnum::MeshTools::flipFaceWindingInPlace(), @ref Magnum::MeshTools::flipNormalsInPlace()
  */
 
 #include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/MeshTools/visibility.h"
@@ -45,6 +46,8 @@ but flips only face winding.
 
 @attention The function requires the mesh to have triangle faces, thus index
     count must be divisible by 3.
+
+@see @ref flipFaceWindingInPlace()
 */
 void MAGNUM_MESHTOOLS_EXPORT flipFaceWinding(std::vector<UnsignedInt>& indices);
 
@@ -54,6 +57,8 @@ void MAGNUM_MESHTOOLS_EXPORT flipFaceWinding(std::vector<UnsignedInt>& indices);
 
 The same as @ref flipNormals(std::vector<UnsignedInt>&, std::vector<Vector3>&),
 but flips only normals, not face winding.
+
+@see @ref flipNormalsInPlace()
 */
 void MAGNUM_MESHTOOLS_EXPORT flipNormals(std::vector<Vector3>& normals);
 
@@ -74,6 +79,43 @@ inline void flipNormals(std::vector<UnsignedInt>& indices, std::vector<Vector3>&
     flipNormals(normals);
 }
 
+/**
+@brief Flip face winding in-place
+@param[in,out] indices  Index array to operate on
+
+Same as @ref flipFaceWinding(), but operates on a strided view, so it can be
+used for example on memory-mapped or interleaved data without copying.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+void MAGNUM_MESHTOOLS_EXPORT flipFaceWindingInPlace(const Containers::StridedArrayView<UnsignedInt>& indices);
+
+/**
+@brief Flip mesh normals in-place
+@param[in,out] normals  Normal array to operate on
+
+Same as @ref flipNormals(std::vector<Vector3>&), but operates on a strided
+view, so it can be used for example directly on interleaved vertex data.
+*/
+void MAGNUM_MESHTOOLS_EXPORT flipNormalsInPlace(const Containers::StridedArrayView<Vector3>& normals);
+
+/**
+@brief Flip mesh normals and face winding in-place
+@param[in,out] indices  Index array to operate on
+@param[in,out] normals  Normal array to operate on
+
+Same as @ref flipNormals(std::vector<UnsignedInt>&, std::vector<Vector3>&),
+but operates on strided views.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+inline void flipNormalsInPlace(const Containers::StridedArrayView<UnsignedInt>& indices, const Containers::StridedArrayView<Vector3>& normals) {
+    flipFaceWindingInPlace(indices);
+    flipNormalsInPlace(normals);
+}
+
 }}
 
 #endif
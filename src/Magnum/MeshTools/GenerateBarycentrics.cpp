@@ -0,0 +1,113 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateBarycentrics.h"
+
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace MeshTools {
+
+std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>, std::vector<Math::Vector3<UnsignedByte>>> generateBarycentrics(const std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateBarycentrics(): index count is not divisible by 3", {});
+
+    /* Corner assigned to each output vertex, 0xff for vertices not referenced
+       by any triangle yet. For every original vertex and every corner there's
+       also index of the output vertex that has given corner, ~0 if there's no
+       such vertex yet. */
+    std::vector<UnsignedByte> corners(vertexCount, 0xff);
+    std::vector<UnsignedInt> copies(std::size_t(vertexCount)*3, ~UnsignedInt{});
+
+    std::vector<UnsignedInt> outIndices(indices.size());
+    std::vector<UnsignedInt> mapping(vertexCount);
+    for(UnsignedInt i = 0; i != vertexCount; ++i) mapping[i] = i;
+
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        UnsignedInt triangle[3];
+        for(std::size_t j = 0; j != 3; ++j) {
+            triangle[j] = indices[i + j];
+            CORRADE_ASSERT(triangle[j] < vertexCount,
+                "MeshTools::generateBarycentrics(): index" << triangle[j] << "out of bounds for" << vertexCount << "vertices", {});
+        }
+
+        /* Keep corners of vertices that already have one assigned, unless
+           they clash with each other */
+        UnsignedByte assigned[3]{0xff, 0xff, 0xff};
+        UnsignedByte used = 0;
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedByte corner = corners[triangle[j]];
+            if(corner != 0xff && !(used & (1 << corner))) {
+                assigned[j] = corner;
+                used |= 1 << corner;
+            }
+        }
+
+        /* For the rest pick a free corner, preferring ones for which a copy
+           of the vertex already exists */
+        for(std::size_t j = 0; j != 3; ++j) {
+            if(assigned[j] != 0xff) continue;
+
+            UnsignedByte corner = 0xff;
+            for(UnsignedByte c = 0; c != 3; ++c) {
+                if(used & (1 << c)) continue;
+                if(corner == 0xff) corner = c;
+                if(copies[triangle[j]*3 + c] != ~UnsignedInt{}) {
+                    corner = c;
+                    break;
+                }
+            }
+
+            assigned[j] = corner;
+            used |= 1 << corner;
+        }
+
+        /* Assign the corners, duplicating the vertex if it already has a
+           different one */
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt vertex = triangle[j];
+            UnsignedInt& copy = copies[vertex*3 + assigned[j]];
+            if(copy == ~UnsignedInt{}) {
+                if(corners[vertex] == 0xff) {
+                    corners[vertex] = assigned[j];
+                    copy = vertex;
+                } else {
+                    copy = mapping.size();
+                    mapping.push_back(vertex);
+                    corners.push_back(assigned[j]);
+                }
+            }
+
+            outIndices[i + j] = copy;
+        }
+    }
+
+    std::vector<Math::Vector3<UnsignedByte>> barycentrics(mapping.size());
+    for(std::size_t i = 0; i != barycentrics.size(); ++i)
+        barycentrics[i][corners[i] == 0xff ? 0 : corners[i]] = 255;
+
+    return std::make_tuple(std::move(outIndices), std::move(mapping), std::move(barycentrics));
+}
+
+}}
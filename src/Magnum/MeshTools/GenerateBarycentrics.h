@@ -0,0 +1,77 @@
+#ifndef Magnum_MeshTools_GenerateBarycentrics_h
+#define Magnum_MeshTools_GenerateBarycentrics_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateBarycentrics()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate barycentric coordinates for an indexed mesh
+@param indices      Array of triangle face indices
+@param vertexCount  Vertex count
+@return New index array, vertex mapping and barycentric coordinates
+
+Assigns each vertex one of the @cpp {1, 0, 0} @ce, @cpp {0, 1, 0} @ce or
+@cpp {0, 0, 1} @ce barycentric coordinates so all three corners of every
+triangle get a different one. That's needed for wireframe rendering using
+@ref Shaders::MeshVisualizer::Flag::BarycentricAttribute. The corners are
+assigned greedily, a vertex is duplicated only if it's shared by triangles
+that need it to have different coordinates. The mesh thus stays indexed and
+in typical cases grows only by a small fraction of the vertex count, instead
+of becoming three times the index count large with @ref duplicate().
+
+The second returned value is an array of original vertex indices, one for
+each vertex of the new mesh, out of which the first @p vertexCount are the
+original vertices in the same order. Use it together with @ref duplicate() to
+make the other vertex attributes match. The first returned value is a new
+index array referencing the new vertices, with the same size and triangle
+order as @p indices. The barycentric coordinates are stored in
+@ref Magnum::UnsignedByte "UnsignedByte" components with either
+@cpp 0 @ce or @cpp 255 @ce value, meant to be uploaded as a normalized
+attribute:
+
+@snippet MagnumMeshTools.cpp generateBarycentrics
+
+Vertices not referenced by @p indices get @cpp {255, 0, 0} @ce.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>, std::vector<Math::Vector3<UnsignedByte>>> MAGNUM_MESHTOOLS_EXPORT generateBarycentrics(const std::vector<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+}}
+
+#endif
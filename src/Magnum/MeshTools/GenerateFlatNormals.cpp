@@ -55,4 +55,34 @@ std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(c
     return std::make_tuple(std::move(normalIndices), std::move(normals));
 }
 
+void generateFlatNormalsInto(const Containers::StridedArrayView<const Vector3>& positions, const Containers::StridedArrayView<Vector3>& normals) {
+    CORRADE_ASSERT(!(positions.size()%3), "MeshTools::generateFlatNormalsInto(): position count is not divisible by 3", );
+    CORRADE_ASSERT(normals.size() == positions.size(),
+        "MeshTools::generateFlatNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
+
+    for(std::size_t i = 0; i != positions.size(); i += 3) {
+        const Vector3 normal = Math::cross(positions[i+2]-positions[i+1],
+                                           positions[i]-positions[i+1]).normalized();
+        normals[i] = normals[i+1] = normals[i+2] = normal;
+    }
+}
+
+void generateFlatNormalsInto(const Containers::StridedArrayView<const UnsignedInt>& indices, const Containers::StridedArrayView<const Vector3>& positions, const Containers::StridedArrayView<Vector3>& normals) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateFlatNormalsInto(): index count is not divisible by 3", );
+    CORRADE_ASSERT(normals.size() == indices.size(),
+        "MeshTools::generateFlatNormalsInto(): bad output size, expected" << indices.size() << "but got" << normals.size(), );
+
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+        for(std::size_t j = 0; j != 3; ++j)
+            CORRADE_ASSERT(indices[i+j] < positions.size(),
+                "MeshTools::generateFlatNormalsInto(): index" << indices[i+j] << "out of bounds for" << positions.size() << "elements", );
+        #endif
+
+        const Vector3 normal = Math::cross(positions[indices[i+2]]-positions[indices[i+1]],
+                                           positions[indices[i]]-positions[indices[i+1]]).normalized();
+        normals[i] = normals[i+1] = normals[i+2] = normal;
+    }
+}
+
 }}
@@ -26,11 +26,12 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::generateFlatNormals()
+ * @brief Function @ref Magnum::MeshTools::generateFlatNormals(), @ref Magnum::MeshTools::generateFlatNormalsInto()
  */
 
 #include <tuple>
 #include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/MeshTools/visibility.h"
@@ -56,9 +57,38 @@ order to have a single index array for both vertices and normals:
 
 @attention The function requires the mesh to have triangle faces, thus index
     count must be divisible by 3.
+
+@see @ref generateFlatNormalsInto()
 */
 std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions);
 
+/**
+@brief Generate flat normals for a non-indexed mesh into existing buffer
+@param[in]  positions   Triangle vertex positions
+@param[out] normals     Where to put the generated normals
+
+All vertices in each triangle face get the same normal vector, assuming
+counterclockwise winding. Unlike @ref generateFlatNormals() no allocation is
+done and duplicates are not removed, so the output can be written directly for
+example into interleaved vertex data. Expects that @p normals has the same size
+as @p positions and the size is divisible by 3.
+*/
+void MAGNUM_MESHTOOLS_EXPORT generateFlatNormalsInto(const Containers::StridedArrayView<const Vector3>& positions, const Containers::StridedArrayView<Vector3>& normals);
+
+/**
+@brief Generate flat normals for an indexed mesh into existing buffer
+@param[in]  indices     Triangle face indices
+@param[in]  positions   Vertex positions
+@param[out] normals     Where to put the generated normals
+
+Like above, but the positions are indexed. The output contains a normal for
+each index, so it should be combined with positions duplicated using
+@ref duplicateInto(). Expects that @p normals has the same size as
+@p indices, the size is divisible by 3 and all indices are in range for
+@p positions.
+*/
+void MAGNUM_MESHTOOLS_EXPORT generateFlatNormalsInto(const Containers::StridedArrayView<const UnsignedInt>& indices, const Containers::StridedArrayView<const Vector3>& positions, const Containers::StridedArrayView<Vector3>& normals);
+
 }}
 
 #endif
@@ -0,0 +1,188 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateMeshlets.h"
+
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+void calculateBounds(Meshlet& meshlet, const std::vector<UnsignedInt>& meshletVertices, const std::vector<UnsignedByte>& meshletTriangles, const std::vector<Vector3>& positions) {
+    const UnsignedInt* const vertices = meshletVertices.data() + meshlet.vertexOffset;
+    const UnsignedByte* const triangles = meshletTriangles.data() + meshlet.triangleOffset*3;
+
+    /* Bounding sphere around center of the bounding box */
+    Vector3 min = positions[vertices[0]], max = min;
+    for(std::size_t i = 1; i != meshlet.vertexCount; ++i) {
+        min = Math::min(min, positions[vertices[i]]);
+        max = Math::max(max, positions[vertices[i]]);
+    }
+    meshlet.center = (min + max)*0.5f;
+    Float radiusSquared = 0.0f;
+    for(std::size_t i = 0; i != meshlet.vertexCount; ++i)
+        radiusSquared = Math::max(radiusSquared, (positions[vertices[i]] - meshlet.center).dot());
+    meshlet.radius = std::sqrt(radiusSquared);
+
+    /* Normal cone axis is the average of unit triangle normals (assuming
+       counterclockwise winding), degenerate triangles are skipped */
+    Vector3 axis;
+    for(std::size_t i = 0; i != meshlet.triangleCount; ++i) {
+        const Vector3& a = positions[vertices[triangles[i*3]]];
+        const Vector3 normal = Math::cross(positions[vertices[triangles[i*3 + 1]]] - a, positions[vertices[triangles[i*3 + 2]]] - a);
+        const Float length = normal.length();
+        if(length != 0.0f) axis += normal/length;
+    }
+
+    /* All triangles degenerate or cancelling each other out */
+    const Float axisLength = axis.length();
+    if(axisLength == 0.0f) {
+        meshlet.coneAxis = {};
+        meshlet.coneCutoff = 1.0f;
+        return;
+    }
+    meshlet.coneAxis = axis/axisLength;
+
+    /* Cone angle is given by the normal farthest from the axis */
+    Float minDot = 1.0f;
+    for(std::size_t i = 0; i != meshlet.triangleCount; ++i) {
+        const Vector3& a = positions[vertices[triangles[i*3]]];
+        const Vector3 normal = Math::cross(positions[vertices[triangles[i*3 + 1]]] - a, positions[vertices[triangles[i*3 + 2]]] - a);
+        const Float length = normal.length();
+        if(length != 0.0f) minDot = Math::min(minDot, Math::dot(normal/length, meshlet.coneAxis));
+    }
+
+    /* If the cone is wider than a hemisphere, the meshlet is never back-facing */
+    meshlet.coneCutoff = minDot <= 0.0f ? 1.0f : std::sqrt(1.0f - minDot*minDot);
+}
+
+}
+
+std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>> generateMeshlets(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateMeshlets(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(maxVertexCount >= 3 && maxVertexCount <= 256,
+        "MeshTools::generateMeshlets(): expected max vertex count to be in range [3, 256], got" << maxVertexCount, {});
+    CORRADE_ASSERT(maxTriangleCount, "MeshTools::generateMeshlets(): expected non-zero max triangle count", {});
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(),
+            "MeshTools::generateMeshlets(): index" << index << "out of bounds for" << positions.size() << "vertices", {});
+    #endif
+
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> meshletVertices;
+    std::vector<UnsignedByte> meshletTriangles;
+    meshletTriangles.reserve(indices.size());
+    const std::size_t triangleCount = indices.size()/3;
+
+    /* Neighboring triangles for each vertex. The Tipsify helper takes a
+       mutable index array, so give it a copy instead of the caller's
+       const data. */
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    {
+        std::vector<UnsignedInt> indicesCopy{indices};
+        Implementation::Tipsify{indicesCopy, UnsignedInt(positions.size())}.buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+    }
+
+    /* Local index of each vertex in current meshlet, per-triangle emitted
+       flag */
+    std::vector<UnsignedInt> localIndex(positions.size(), ~UnsignedInt{});
+    std::vector<bool> emitted(triangleCount);
+    auto newVertexCount = [&indices, &localIndex](const std::size_t triangle) {
+        return UnsignedInt(localIndex[indices[triangle*3]] == ~UnsignedInt{}) +
+               UnsignedInt(localIndex[indices[triangle*3 + 1]] == ~UnsignedInt{}) +
+               UnsignedInt(localIndex[indices[triangle*3 + 2]] == ~UnsignedInt{});
+    };
+
+    Meshlet meshlet{};
+    auto finishMeshlet = [&]() {
+        for(std::size_t i = 0; i != meshlet.vertexCount; ++i)
+            localIndex[meshletVertices[meshlet.vertexOffset + i]] = ~UnsignedInt{};
+        calculateBounds(meshlet, meshletVertices, meshletTriangles, positions);
+        meshlets.push_back(meshlet);
+
+        meshlet = Meshlet{};
+        meshlet.vertexOffset = meshletVertices.size();
+        meshlet.triangleOffset = meshletTriangles.size()/3;
+    };
+
+    /* The cursor is used for finding a next triangle when none is adjacent to
+       current meshlet */
+    std::size_t cursor = 0;
+    for(;;) {
+        /* Find a neighboring triangle that adds the least new vertices */
+        std::size_t best = triangleCount;
+        UnsignedInt bestNewVertexCount = 4;
+        for(std::size_t i = 0; i != meshlet.vertexCount && bestNewVertexCount; ++i) {
+            const UnsignedInt vertex = meshletVertices[meshlet.vertexOffset + i];
+            for(UnsignedInt j = neighborOffset[vertex]; j != neighborOffset[vertex + 1]; ++j) {
+                const UnsignedInt triangle = neighbors[j];
+                if(emitted[triangle]) continue;
+
+                const UnsignedInt count = newVertexCount(triangle);
+                if(count < bestNewVertexCount) {
+                    best = triangle;
+                    bestNewVertexCount = count;
+                    if(!count) break;
+                }
+            }
+        }
+
+        /* Dead end, take the next triangle that wasn't emitted yet */
+        if(best == triangleCount) {
+            while(cursor != triangleCount && emitted[cursor]) ++cursor;
+            if(cursor == triangleCount) break;
+            best = cursor;
+            bestNewVertexCount = newVertexCount(best);
+        }
+
+        /* Start a new meshlet if the triangle doesn't fit */
+        if(meshlet.vertexCount + bestNewVertexCount > maxVertexCount || meshlet.triangleCount == maxTriangleCount)
+            finishMeshlet();
+
+        /* Add the triangle */
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt vertex = indices[best*3 + i];
+            if(localIndex[vertex] == ~UnsignedInt{}) {
+                localIndex[vertex] = meshlet.vertexCount++;
+                meshletVertices.push_back(vertex);
+            }
+            meshletTriangles.push_back(localIndex[vertex]);
+        }
+        ++meshlet.triangleCount;
+        emitted[best] = true;
+    }
+
+    if(meshlet.triangleCount) finishMeshlet();
+
+    return std::make_tuple(std::move(meshlets), std::move(meshletVertices), std::move(meshletTriangles));
+}
+
+}}
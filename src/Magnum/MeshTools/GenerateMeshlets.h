@@ -0,0 +1,128 @@
+#ifndef Magnum_MeshTools_GenerateMeshlets_h
+#define Magnum_MeshTools_GenerateMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::Meshlet, function @ref Magnum::MeshTools::generateMeshlets()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+
+Range of vertices and triangles of a meshlet together with its bounds. See
+@ref generateMeshlets() for more information.
+*/
+struct Meshlet {
+    /**
+     * @brief Vertex offset
+     *
+     * Offset of the first meshlet vertex in the vertex array.
+     */
+    UnsignedInt vertexOffset;
+
+    /** @brief Vertex count */
+    UnsignedInt vertexCount;
+
+    /**
+     * @brief Triangle offset
+     *
+     * Offset of the first meshlet triangle in the triangle array, in
+     * triangles (i.e., three local indices per triangle).
+     */
+    UnsignedInt triangleOffset;
+
+    /** @brief Triangle count */
+    UnsignedInt triangleCount;
+
+    /** @brief Bounding sphere center */
+    Vector3 center;
+
+    /** @brief Bounding sphere radius */
+    Float radius;
+
+    /**
+     * @brief Normal cone axis
+     *
+     * Normalized average direction of triangle normals.
+     */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Normal cone cutoff
+     *
+     * Sine of the normal cone half-angle, or @cpp 1.0f @ce if the triangles
+     * are facing in too different directions for the meshlet to be ever
+     * back-face culled.
+     */
+    Float coneCutoff;
+};
+
+/**
+@brief Split a mesh into meshlets
+@param indices          Array of triangle face indices
+@param positions        Array of vertex positions
+@param maxVertexCount   Max vertex count in a meshlet
+@param maxTriangleCount Max triangle count in a meshlet
+@return Meshlets, meshlet vertices and meshlet triangles
+
+Splits the mesh into clusters of at most @p maxVertexCount vertices and
+@p maxTriangleCount triangles, suitable for cluster culling on the GPU. The
+meshlets are built greedily using vertex-triangle adjacency, same as in
+@ref tipsify(), preferring triangles that add the least new vertices.
+
+The second returned value is an array of original vertex indices, the range
+@cpp [vertexOffset, vertexOffset + vertexCount) @ce belongs to given meshlet.
+The third value contains triangles as triples of meshlet-local indices into the
+meshlet vertex range, compressed to @ref Magnum::UnsignedByte "UnsignedByte",
+so at most 256 vertices per meshlet are allowed. Triangle winding is
+preserved.
+
+Each meshlet has a bounding sphere and a normal cone. A meshlet can be culled
+if it's entirely back-facing when viewed from camera position @f$ \boldsymbol{c} @f$,
+which is conservatively tested as follows, with @f$ \boldsymbol{s} @f$ being
+the sphere center, @f$ r @f$ the sphere radius, @f$ \boldsymbol{a} @f$ the
+cone axis and @f$ t @f$ the cone cutoff: @f[
+    (\boldsymbol{s} - \boldsymbol{c}) \cdot \boldsymbol{a} \ge t |\boldsymbol{s} - \boldsymbol{c}| + r
+@f]
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. Vertex count is expected to be in range
+    @f$ [3, 256] @f$ and triangle count larger than zero.
+*/
+std::tuple<std::vector<Meshlet>, std::vector<UnsignedInt>, std::vector<UnsignedByte>> MAGNUM_MESHTOOLS_EXPORT generateMeshlets(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 126);
+
+}}
+
+#endif
@@ -0,0 +1,157 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateSmoothNormals.h"
+
+#include <cmath>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Implementation/vertexCorners.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Area-weighted (i.e., unnormalized) face normals and angles of each face
+   corner. Faces are independent, so they're processed in parallel chunks. */
+void faceNormalsAndCornerAngles(const Containers::StridedArrayView<const UnsignedInt>& indices, const Containers::StridedArrayView<const Vector3>& positions, std::vector<Vector3>& faceNormals, std::vector<Float>& cornerAngles, const UnsignedInt threadCount) {
+    const std::size_t faceCount = indices.size()/3;
+    faceNormals.resize(faceCount);
+    cornerAngles.resize(indices.size());
+
+    Magnum::Implementation::parallelFor(threadCount, Implementation::parallelChunkCount(faceCount), [&](const std::size_t chunk) {
+        const std::size_t end = Math::min((chunk + 1)*Implementation::ParallelChunkSize, faceCount);
+        for(std::size_t face = chunk*Implementation::ParallelChunkSize; face != end; ++face) {
+            const Vector3& a = positions[indices[face*3 + 0]];
+            const Vector3& b = positions[indices[face*3 + 1]];
+            const Vector3& c = positions[indices[face*3 + 2]];
+
+            /* Same winding as in generateFlatNormals() */
+            faceNormals[face] = Math::cross(c - b, a - b);
+            cornerAngles[face*3 + 0] = Implementation::cornerAngle(b - a, c - a);
+            cornerAngles[face*3 + 1] = Implementation::cornerAngle(c - b, a - b);
+            cornerAngles[face*3 + 2] = Implementation::cornerAngle(a - c, b - c);
+        }
+    });
+}
+
+}
+
+void generateSmoothNormalsInto(const Containers::StridedArrayView<const UnsignedInt>& indices, const Containers::StridedArrayView<const Vector3>& positions, const Containers::StridedArrayView<Vector3>& normals, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateSmoothNormalsInto(): index count is not divisible by 3", );
+    CORRADE_ASSERT(normals.size() == positions.size(),
+        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < positions.size(),
+            "MeshTools::generateSmoothNormalsInto(): index" << indices[i] << "out of bounds for" << positions.size() << "elements", );
+    #endif
+
+    std::vector<Vector3> faceNormals;
+    std::vector<Float> cornerAngles;
+    faceNormalsAndCornerAngles(indices, positions, faceNormals, cornerAngles, threadCount);
+
+    /* Gather the contributions for each vertex. Done per vertex and not by
+       scattering per face so the vertex chunks can be processed in parallel
+       without any synchronization and the summation order (and thus the
+       result) doesn't depend on the thread count. */
+    const Implementation::VertexCorners corners = Implementation::vertexCorners(indices, positions.size());
+    Magnum::Implementation::parallelFor(threadCount, Implementation::parallelChunkCount(positions.size()), [&](const std::size_t chunk) {
+        const std::size_t end = Math::min((chunk + 1)*Implementation::ParallelChunkSize, positions.size());
+        for(std::size_t vertex = chunk*Implementation::ParallelChunkSize; vertex != end; ++vertex) {
+            Vector3 normal;
+            for(UnsignedInt i = corners.offsets[vertex]; i != corners.offsets[vertex + 1]; ++i) {
+                const UnsignedInt corner = corners.corners[i];
+                normal += faceNormals[corner/3]*cornerAngles[corner];
+            }
+            normals[vertex] = Implementation::normalizedOrZero(normal);
+        }
+    });
+}
+
+std::vector<Vector3> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt threadCount) {
+    std::vector<Vector3> normals(positions.size());
+    generateSmoothNormalsInto(
+        Containers::arrayView(indices.data(), indices.size()),
+        Containers::arrayView(positions.data(), positions.size()),
+        Containers::arrayView(normals.data(), normals.size()), threadCount);
+    return normals;
+}
+
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const Rad creaseAngle, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateSmoothNormals(): index count is not divisible by 3", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < positions.size(),
+            "MeshTools::generateSmoothNormals(): index" << indices[i] << "out of bounds for" << positions.size() << "elements", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
+    #endif
+
+    const Containers::ArrayView<const UnsignedInt> indexView{indices.data(), indices.size()};
+    std::vector<Vector3> faceNormals;
+    std::vector<Float> cornerAngles;
+    faceNormalsAndCornerAngles(indexView, Containers::arrayView(positions.data(), positions.size()), faceNormals, cornerAngles, threadCount);
+
+    /* Unit face normals for the crease test */
+    std::vector<Vector3> faceDirections(faceNormals.size());
+    for(std::size_t i = 0; i != faceNormals.size(); ++i)
+        faceDirections[i] = Implementation::normalizedOrZero(faceNormals[i]);
+    const Float creaseCos = std::cos(Float(creaseAngle));
+
+    /* Each corner gets a sum of all faces around its vertex that are within
+       the crease angle from its own face. The face itself is always included
+       so even degenerate faces, which don't pass the test with anything,
+       get the same normal as with no crease angle. This is quadratic in the
+       vertex valence, but that's usually small. */
+    const Implementation::VertexCorners corners = Implementation::vertexCorners(indexView, positions.size());
+    std::vector<Vector3> normals(indices.size());
+    Magnum::Implementation::parallelFor(threadCount, Implementation::parallelChunkCount(positions.size()), [&](const std::size_t chunk) {
+        const std::size_t end = Math::min((chunk + 1)*Implementation::ParallelChunkSize, positions.size());
+        for(std::size_t vertex = chunk*Implementation::ParallelChunkSize; vertex != end; ++vertex) {
+            for(UnsignedInt i = corners.offsets[vertex]; i != corners.offsets[vertex + 1]; ++i) {
+                const UnsignedInt corner = corners.corners[i];
+                const Vector3& direction = faceDirections[corner/3];
+                Vector3 normal;
+                for(UnsignedInt j = corners.offsets[vertex]; j != corners.offsets[vertex + 1]; ++j) {
+                    const UnsignedInt other = corners.corners[j];
+                    if(other == corner || Math::dot(direction, faceDirections[other/3]) >= creaseCos)
+                        normal += faceNormals[other/3]*cornerAngles[other];
+                }
+                normals[corner] = Implementation::normalizedOrZero(normal);
+            }
+        }
+    });
+
+    /* Remove duplicate normals, which gives the normal indices directly as
+       there's one normal per corner, and return */
+    std::vector<UnsignedInt> normalIndices = MeshTools::removeDuplicates(normals);
+    return std::make_tuple(std::move(normalIndices), std::move(normals));
+}
+
+}}
@@ -0,0 +1,112 @@
+#ifndef Magnum_MeshTools_GenerateSmoothNormals_h
+#define Magnum_MeshTools_GenerateSmoothNormals_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateSmoothNormals(), @ref Magnum::MeshTools::generateSmoothNormalsInto()
+ */
+
+#include <tuple>
+#include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate smooth normals into existing buffer
+@param[in]  indices     Triangle face indices
+@param[in]  positions   Vertex positions
+@param[out] normals     Where to put the generated normals
+@param[in]  threadCount Thread count used for the operation, including the
+    calling thread
+
+Unlike @ref generateFlatNormalsInto(), the mesh keeps its original indexing and
+each vertex gets an average of normals of all faces sharing it, assuming
+counterclockwise winding. Each face normal is weighted by the face area and
+the angle of the face at given vertex, so the result doesn't depend on how the
+surface around the vertex is triangulated. Vertices that are duplicated in the
+input, for example because of different texture coordinates, are not merged;
+vertices that aren't referenced by any face or are referenced only by
+degenerate faces get a zero vector. Expects that @p normals has the same size
+as @p positions, the index count is divisible by 3 and all indices are in
+range for @p positions.
+
+@snippet MagnumMeshTools.cpp generateSmoothNormalsInto
+
+For huge meshes the operation can be distributed over multiple threads by
+setting @p threadCount to a value larger than @cpp 1 @ce. The faces and
+vertices are then processed in independent chunks and the output is the same
+as with the single-threaded operation. Multithreaded operation is not
+available on @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where
+@p threadCount is ignored.
+@see @ref generateTangentsInto()
+*/
+void MAGNUM_MESHTOOLS_EXPORT generateSmoothNormalsInto(const Containers::StridedArrayView<const UnsignedInt>& indices, const Containers::StridedArrayView<const Vector3>& positions, const Containers::StridedArrayView<Vector3>& normals, UnsignedInt threadCount = 1);
+
+/**
+@brief Generate smooth normals
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param threadCount  Thread count used for the operation, including the
+    calling thread
+@return Normal for each vertex
+
+Allocates the output and calls @ref generateSmoothNormalsInto().
+*/
+std::vector<Vector3> MAGNUM_MESHTOOLS_EXPORT generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt threadCount = 1);
+
+/**
+@brief Generate smooth normals with a crease angle
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param creaseAngle  Maximal angle between faces that are smoothed together
+@param threadCount  Thread count used for the operation, including the
+    calling thread
+@return Normal indices and vectors
+
+Like @ref generateSmoothNormals(const std::vector<UnsignedInt>&, const std::vector<Vector3>&, UnsignedInt),
+but for each face at given vertex only faces whose normals differ by at most
+@p creaseAngle contribute, so hard edges stay hard. A vertex on a hard edge
+then needs a different normal for faces on each side of the edge, so a normal
+index array is returned together with the unique normals, in the same way as
+with @ref generateFlatNormals(). Recombine it with the position indices using
+@ref combineIndexedArrays() --- only vertices on hard edges get duplicated,
+which is, unlike with flat normals, usually just a small fraction of the
+mesh:
+
+@snippet MagnumMeshTools.cpp generateSmoothNormals-crease
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, Rad creaseAngle, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
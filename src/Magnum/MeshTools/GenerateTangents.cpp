@@ -0,0 +1,121 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateTangents.h"
+
+#include <cmath>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/Implementation/vertexCorners.h"
+
+namespace Magnum { namespace MeshTools {
+
+void generateTangentsInto(const Containers::StridedArrayView<const UnsignedInt>& indices, const Containers::StridedArrayView<const Vector3>& positions, const Containers::StridedArrayView<const Vector3>& normals, const Containers::StridedArrayView<const Vector2>& textureCoordinates, const Containers::StridedArrayView<Vector4>& tangents, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateTangentsInto(): index count is not divisible by 3", );
+    CORRADE_ASSERT(normals.size() == positions.size() && textureCoordinates.size() == positions.size(),
+        "MeshTools::generateTangentsInto(): expected" << positions.size() << "normals and texture coordinates but got" << normals.size() << "and" << textureCoordinates.size(), );
+    CORRADE_ASSERT(tangents.size() == positions.size(),
+        "MeshTools::generateTangentsInto(): bad output size, expected" << positions.size() << "but got" << tangents.size(), );
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < positions.size(),
+            "MeshTools::generateTangentsInto(): index" << indices[i] << "out of bounds for" << positions.size() << "elements", );
+    #endif
+
+    /* Unit tangent and bitangent of each face, derived from the texture
+       coordinate gradients. The direction is what matters, the size of the
+       face in UV space shouldn't affect the contribution so the vectors are
+       normalized and later weighted only by the corner angle. */
+    const std::size_t faceCount = indices.size()/3;
+    std::vector<Vector3> faceTangents(faceCount), faceBitangents(faceCount);
+    std::vector<Float> cornerAngles(indices.size());
+    Magnum::Implementation::parallelFor(threadCount, Implementation::parallelChunkCount(faceCount), [&](const std::size_t chunk) {
+        const std::size_t end = Math::min((chunk + 1)*Implementation::ParallelChunkSize, faceCount);
+        for(std::size_t face = chunk*Implementation::ParallelChunkSize; face != end; ++face) {
+            const UnsignedInt a = indices[face*3 + 0];
+            const UnsignedInt b = indices[face*3 + 1];
+            const UnsignedInt c = indices[face*3 + 2];
+
+            const Vector3 e1 = positions[b] - positions[a];
+            const Vector3 e2 = positions[c] - positions[a];
+            const Vector2 t1 = textureCoordinates[b] - textureCoordinates[a];
+            const Vector2 t2 = textureCoordinates[c] - textureCoordinates[a];
+
+            /* The sign of the UV-space area tells the handedness, its
+               magnitude is irrelevant as the result gets normalized. If it's
+               zero, the face has degenerate texture coordinates and doesn't
+               contribute. */
+            const Float area = Math::cross(t1, t2);
+            if(area == 0.0f) continue;
+            const Float sign = area < 0.0f ? -1.0f : 1.0f;
+            faceTangents[face] = Implementation::normalizedOrZero((e1*t2.y() - e2*t1.y())*sign);
+            faceBitangents[face] = Implementation::normalizedOrZero((e2*t1.x() - e1*t2.x())*sign);
+
+            cornerAngles[face*3 + 0] = Implementation::cornerAngle(e1, e2);
+            cornerAngles[face*3 + 1] = Implementation::cornerAngle(positions[c] - positions[b], -e1);
+            cornerAngles[face*3 + 2] = Implementation::cornerAngle(-e2, positions[b] - positions[c]);
+        }
+    });
+
+    /* Gather per vertex, same as in generateSmoothNormalsInto() */
+    const Implementation::VertexCorners corners = Implementation::vertexCorners(indices, positions.size());
+    Magnum::Implementation::parallelFor(threadCount, Implementation::parallelChunkCount(positions.size()), [&](const std::size_t chunk) {
+        const std::size_t end = Math::min((chunk + 1)*Implementation::ParallelChunkSize, positions.size());
+        for(std::size_t vertex = chunk*Implementation::ParallelChunkSize; vertex != end; ++vertex) {
+            Vector3 tangent, bitangent;
+            for(UnsignedInt i = corners.offsets[vertex]; i != corners.offsets[vertex + 1]; ++i) {
+                const UnsignedInt corner = corners.corners[i];
+                tangent += faceTangents[corner/3]*cornerAngles[corner];
+                bitangent += faceBitangents[corner/3]*cornerAngles[corner];
+            }
+
+            /* Gram-Schmidt orthogonalization against the normal. If there's
+               nothing left (no contributing faces or the tangent is parallel
+               to the normal), pick any vector perpendicular to the normal. */
+            const Vector3& normal = normals[vertex];
+            Vector3 orthogonal = Implementation::normalizedOrZero(tangent - normal*Math::dot(normal, tangent));
+            if(orthogonal.isZero()) orthogonal = Implementation::normalizedOrZero(std::abs(normal.x()) < 0.9f ?
+                Math::cross(normal, Vector3::xAxis()) : Math::cross(normal, Vector3::yAxis()));
+
+            tangents[vertex] = {orthogonal, Math::dot(Math::cross(normal, orthogonal), bitangent) < 0.0f ? -1.0f : 1.0f};
+        }
+    });
+}
+
+std::vector<Vector4> generateTangents(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const std::vector<Vector2>& textureCoordinates, const UnsignedInt threadCount) {
+    std::vector<Vector4> tangents(positions.size());
+    generateTangentsInto(
+        Containers::arrayView(indices.data(), indices.size()),
+        Containers::arrayView(positions.data(), positions.size()),
+        Containers::arrayView(normals.data(), normals.size()),
+        Containers::arrayView(textureCoordinates.data(), textureCoordinates.size()),
+        Containers::arrayView(tangents.data(), tangents.size()), threadCount);
+    return tangents;
+}
+
+}}
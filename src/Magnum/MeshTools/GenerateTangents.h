@@ -0,0 +1,93 @@
+#ifndef Magnum_MeshTools_GenerateTangents_h
+#define Magnum_MeshTools_GenerateTangents_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateTangents(), @ref Magnum::MeshTools::generateTangentsInto()
+ */
+
+#include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate tangents into existing buffer
+@param[in]  indices     Triangle face indices
+@param[in]  positions   Vertex positions
+@param[in]  normals     Vertex normals
+@param[in]  textureCoordinates Vertex texture coordinates
+@param[out] tangents    Where to put the generated tangents
+@param[in]  threadCount Thread count used for the operation, including the
+    calling thread
+
+Calculates a per-vertex tangent space for normal mapping, keeping the original
+mesh indexing. The tangent and bitangent directions of each face are derived
+from its texture coordinate gradients, averaged over all faces sharing the
+vertex with weights given by the face angle at the vertex, and
+orthogonalized against the vertex normal. The XYZ components of the output
+contain the tangent, the W component is @cpp 1.0f @ce or @cpp -1.0f @ce
+depending on handedness of the texture space, so the bitangent can be
+reconstructed as @glsl cross(normal, tangent.xyz)*tangent.w @ce. That's the
+same convention as used by the
+[MikkTSpace](http://www.mikktspace.com/) algorithm and glTF. Faces with degenerate texture
+coordinates don't contribute; a vertex that has no contributing faces gets an
+arbitrary tangent perpendicular to its normal.
+
+Expects that @p normals, @p textureCoordinates and @p tangents have
+the same size as @p positions, the index count is divisible by 3 and all
+indices are in range for @p positions. The normals are expected to be
+normalized, such as the output of @ref generateSmoothNormalsInto().
+
+Vertices that share a position and normal but have different texture
+coordinates (i.e., are on a UV seam) are not merged, so the tangent space
+is discontinuous there, which matches how the texture itself is
+discontinuous. Multithreading works the same way as in
+@ref generateSmoothNormalsInto() and gives the same output as the
+single-threaded operation.
+*/
+void MAGNUM_MESHTOOLS_EXPORT generateTangentsInto(const Containers::StridedArrayView<const UnsignedInt>& indices, const Containers::StridedArrayView<const Vector3>& positions, const Containers::StridedArrayView<const Vector3>& normals, const Containers::StridedArrayView<const Vector2>& textureCoordinates, const Containers::StridedArrayView<Vector4>& tangents, UnsignedInt threadCount = 1);
+
+/**
+@brief Generate tangents
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param normals      Array of vertex normals
+@param textureCoordinates Array of vertex texture coordinates
+@param threadCount  Thread count used for the operation, including the
+    calling thread
+@return Tangent for each vertex
+
+Allocates the output and calls @ref generateTangentsInto().
+*/
+std::vector<Vector4> MAGNUM_MESHTOOLS_EXPORT generateTangents(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const std::vector<Vector2>& textureCoordinates, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
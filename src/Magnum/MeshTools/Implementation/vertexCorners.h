@@ -0,0 +1,80 @@
+#ifndef Magnum_MeshTools_Implementation_vertexCorners_h
+#define Magnum_MeshTools_Implementation_vertexCorners_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools { namespace Implementation {
+
+/* Triangle corners grouped by the vertex they reference. Corners of vertex i
+   are corners[offsets[i]] to corners[offsets[i + 1]], in increasing order.
+   Built with a counting sort, so it's a linear operation. */
+struct VertexCorners {
+    std::vector<UnsignedInt> offsets, corners;
+};
+
+inline VertexCorners vertexCorners(const Containers::StridedArrayView<const UnsignedInt>& indices, const std::size_t vertexCount) {
+    VertexCorners out;
+    out.offsets.assign(vertexCount + 1, 0);
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        ++out.offsets[indices[i] + 1];
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        out.offsets[i + 1] += out.offsets[i];
+
+    std::vector<UnsignedInt> next{out.offsets.begin(), out.offsets.end() - 1};
+    out.corners.resize(indices.size());
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        out.corners[next[indices[i]]++] = i;
+
+    return out;
+}
+
+/* Angle between two edges of a triangle, not requiring them to be
+   normalized. Zero for degenerate edges. */
+inline Float cornerAngle(const Vector3& a, const Vector3& b) {
+    return std::atan2(Math::cross(a, b).length(), Math::dot(a, b));
+}
+
+/* Normalized vector or zero if it has zero length */
+inline Vector3 normalizedOrZero(const Vector3& vector) {
+    const Float length = vector.length();
+    return length > 0.0f ? vector/length : Vector3{};
+}
+
+/* Tasks the work is split into if multithreading is enabled */
+constexpr std::size_t ParallelChunkSize = 16384;
+
+inline std::size_t parallelChunkCount(const std::size_t count) {
+    return (count + ParallelChunkSize - 1)/ParallelChunkSize;
+}
+
+}}}
+
+#endif
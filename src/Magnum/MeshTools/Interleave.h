@@ -26,19 +26,70 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::interleave(), @ref Magnum::MeshTools::interleaveInto()
+ * @brief Class @ref Magnum::MeshTools::ConvertedAttribute, function @ref Magnum::MeshTools::interleave(), @ref Magnum::MeshTools::interleaveInto(), @ref Magnum::MeshTools::convertAttribute(), @ref Magnum::MeshTools::packAttribute(), @ref Magnum::MeshTools::packHalfAttribute()
  */
 
 #include <cstring>
+#include <vector>
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Assert.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Packing.h"
 
 namespace Magnum { namespace MeshTools {
 
+/**
+@brief Attribute converted during interleaving
+
+Wraps a strided view on source attribute data together with a conversion
+function that's applied to each element while it's being written by
+@ref interleave() or @ref interleaveInto(), so the conversion doesn't need a
+separate pass and a temporary allocation. The @ref value_type is the return
+type of the function. Created using @ref convertAttribute(),
+@ref packAttribute() or @ref packHalfAttribute(), you don't need to use this
+class directly.
+*/
+template<class T, class F> class ConvertedAttribute {
+    public:
+        /** @brief Converted type */
+        typedef typename std::decay<decltype(std::declval<const F&>()(std::declval<const T&>()))>::type value_type;
+
+        /** @brief Constructor */
+        explicit ConvertedAttribute(const Containers::StridedArrayView<const T>& data, const F& function): _data{data}, _function(function) {}
+
+        /** @brief Source data */
+        Containers::StridedArrayView<const T> data() const { return _data; }
+
+        /** @brief Attribute count */
+        std::size_t size() const { return _data.size(); }
+
+        /** @brief Converted value at given position */
+        value_type operator[](std::size_t i) const { return _function(_data[i]); }
+
+    private:
+        Containers::StridedArrayView<const T> _data;
+        F _function;
+};
+
 namespace Implementation {
 
+template<class Integral> struct PackAttribute {
+    template<class T> Integral operator()(const T& value) const {
+        return Math::pack<Integral>(value);
+    }
+};
+
+struct PackHalfAttribute {
+    UnsignedShort operator()(Float value) const {
+        return Math::packHalf(value);
+    }
+    template<std::size_t size> Math::Vector<size, UnsignedShort> operator()(const Math::Vector<size, Float>& value) const {
+        return Math::packHalf(value);
+    }
+};
+
 /* Attribute count, skipping gaps. If the attributes are just gaps, returns
    ~std::size_t{0}. It must be in the structure to have proper overload
    resolution (the functions would otherwise need to be de-inlined to break
@@ -73,6 +124,9 @@ struct Stride {
     template<class T, class ...U> typename std::enable_if<!std::is_convertible<T, std::size_t>::value, std::size_t>::type operator()(const T&, const U&... next) const {
         return sizeof(typename T::value_type) + Stride{}(next...);
     }
+    template<class T, class ...U> std::size_t operator()(const Containers::StridedArrayView<T>&, const U&... next) const {
+        return sizeof(T) + Stride{}(next...);
+    }
     template<class... T> std::size_t operator()(std::size_t gap, const T&... next) const {
         return gap + Stride{}(next...);
     }
@@ -88,6 +142,25 @@ template<class T> typename std::enable_if<!std::is_convertible<T, std::size_t>::
     return sizeof(typename T::value_type);
 }
 
+/* Copy data from a strided view to the buffer */
+template<class T> std::size_t writeOneInterleaved(std::size_t stride, char* startingOffset, const Containers::StridedArrayView<T>& attributeList) {
+    for(std::size_t i = 0; i != attributeList.size(); ++i)
+        std::memcpy(startingOffset + i*stride, &attributeList[i], sizeof(T));
+
+    return sizeof(T);
+}
+
+/* Convert data and copy them to the buffer */
+template<class T, class F> std::size_t writeOneInterleaved(std::size_t stride, char* startingOffset, const ConvertedAttribute<T, F>& attributeList) {
+    typedef typename ConvertedAttribute<T, F>::value_type Type;
+    for(std::size_t i = 0; i != attributeList.size(); ++i) {
+        const Type value = attributeList[i];
+        std::memcpy(startingOffset + i*stride, &value, sizeof(Type));
+    }
+
+    return sizeof(Type);
+}
+
 /* Skip gap */
 constexpr std::size_t writeOneInterleaved(std::size_t, char*, std::size_t gap) { return gap; }
 
@@ -122,7 +195,11 @@ would be 21 bytes, causing possible performance loss.
 @note The only requirements to attribute array type is that it must have
     typedef `T::value_type`, forward iterator (to be used with range-based
     for) and function `size()` returning count of elements. In most cases it
-    will be @ref std::vector or @ref std::array.
+    will be @ref std::vector or @ref std::array. Besides that, attributes can
+    be also passed as @ref Corrade::Containers::StridedArrayView, for example
+    to take them directly from other interleaved or memory-mapped data
+    without copying, or as @ref ConvertedAttribute to convert them to a
+    different type on the fly.
 
 @see @ref interleaveInto()
 */
@@ -149,7 +226,16 @@ template<class T, class ...U> Containers::Array<char> interleave(const T& first,
 Unlike @ref interleave() this function interleaves the data into existing
 buffer and leaves gaps untouched instead of zero-initializing them. This
 function can thus be used for interleaving data depending on runtime
-parameters.
+parameters or for writing directly to mapped GPU memory or a memory arena,
+without any intermediate allocation. Attributes can be passed as
+@ref Corrade::Containers::StridedArrayView or @ref ConvertedAttribute as
+well, same as with @ref interleave().
+
+Together with @ref packAttribute() or @ref packHalfAttribute(), the attribute
+data can be converted to a smaller vertex format in the same pass that writes
+them into the mapped memory, without an intermediate copy:
+
+@snippet MagnumMeshTools.cpp interleaveInto-mapped
 
 @attention Similarly to @ref interleave(), this function expects that all
     arrays have the same size. The passed buffer must also be large enough to
@@ -167,6 +253,63 @@ template<class T, class ...U> void interleaveInto(Containers::ArrayView<char> bu
     Implementation::writeInterleaved(stride, buffer.begin(), first, next...);
 }
 
+/**
+@brief Convert an attribute during interleaving
+@param data         Source attribute data
+@param function     Function converting each element
+
+The @p function is called with each element of @p data while it's being
+written by @ref interleave() or @ref interleaveInto() and its return value is
+written instead. The function is expected to be a pure conversion, returning
+a trivially copyable type --- it's not guaranteed to be called in any
+particular order.
+@see @ref packAttribute(), @ref packHalfAttribute()
+*/
+template<class T, class F> inline ConvertedAttribute<T, F> convertAttribute(const Containers::StridedArrayView<const T>& data, F function) {
+    return ConvertedAttribute<T, F>{data, function};
+}
+
+/** @overload */
+template<class T, class F> inline ConvertedAttribute<T, F> convertAttribute(const std::vector<T>& data, F function) {
+    return ConvertedAttribute<T, F>{Containers::arrayView(data.data(), data.size()), function};
+}
+
+/**
+@brief Pack an attribute to an integral type during interleaving
+
+Converts each element using @ref Math::pack() to an integral type, for
+example normals to @ref Math::Vector3 "Math::Vector3<Short>" or colors to
+@ref Magnum::Color4ub "Color4ub", while interleaving.
+@see @ref convertAttribute(), @ref packHalfAttribute()
+*/
+template<class Integral, class T> inline ConvertedAttribute<T, Implementation::PackAttribute<Integral>> packAttribute(const Containers::StridedArrayView<const T>& data) {
+    return ConvertedAttribute<T, Implementation::PackAttribute<Integral>>{data, {}};
+}
+
+/** @overload */
+template<class Integral, class T> inline ConvertedAttribute<T, Implementation::PackAttribute<Integral>> packAttribute(const std::vector<T>& data) {
+    return ConvertedAttribute<T, Implementation::PackAttribute<Integral>>{Containers::arrayView(data.data(), data.size()), {}};
+}
+
+/**
+@brief Pack an attribute to half-floats during interleaving
+
+Converts each @ref Magnum::Float "Float" or floating-point vector element
+using @ref Math::packHalf() to the corresponding @ref Magnum::UnsignedShort "UnsignedShort"
+representation while interleaving. Note that for example a three-component
+vector becomes six bytes large, you may want to add a two-byte gap after it
+to keep the vertex four-byte aligned.
+@see @ref convertAttribute(), @ref packAttribute()
+*/
+template<class T> inline ConvertedAttribute<T, Implementation::PackHalfAttribute> packHalfAttribute(const Containers::StridedArrayView<const T>& data) {
+    return ConvertedAttribute<T, Implementation::PackHalfAttribute>{data, {}};
+}
+
+/** @overload */
+template<class T> inline ConvertedAttribute<T, Implementation::PackHalfAttribute> packHalfAttribute(const std::vector<T>& data) {
+    return ConvertedAttribute<T, Implementation::PackHalfAttribute>{Containers::arrayView(data.data(), data.size()), {}};
+}
+
 }}
 
 #endif
@@ -0,0 +1,309 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Optimize.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+Float forsythVertexScore(const Int cachePosition, const UnsignedInt liveTriangleCount, const std::size_t cacheSize) {
+    /* No triangles left to draw with this vertex */
+    if(!liveTriangleCount) return -1.0f;
+
+    /* Vertices of the last triangle get a fixed score so they aren't reused
+       too eagerly, otherwise the score decays with position in the cache */
+    Float score = 0.0f;
+    if(cachePosition >= 0) {
+        if(cachePosition < 3) score = 0.75f;
+        else score = std::pow(1.0f - Float(cachePosition - 3)/Float(cacheSize - 3), 1.5f);
+    }
+
+    /* Boost vertices with only a few triangles left so they are finished
+       quickly instead of being transformed again later */
+    return score + 2.0f/std::sqrt(Float(liveTriangleCount));
+}
+
+}
+
+VertexCacheStatistics analyzeVertexCache(const std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::analyzeVertexCache(): index count is not divisible by 3", {});
+
+    /* Global time and per-vertex FIFO caching timestamps, same as in
+       tipsify() */
+    UnsignedInt time = cacheSize + 1;
+    std::vector<UnsignedInt> timestamp(vertexCount);
+    std::vector<bool> referenced(vertexCount);
+
+    UnsignedInt transformedVertexCount = 0;
+    UnsignedInt referencedVertexCount = 0;
+    for(const UnsignedInt index: indices) {
+        CORRADE_ASSERT(index < vertexCount,
+            "MeshTools::analyzeVertexCache(): index" << index << "out of bounds for" << vertexCount << "vertices", {});
+
+        if(!referenced[index]) {
+            referenced[index] = true;
+            ++referencedVertexCount;
+        }
+
+        /* Not in cache, transform and insert */
+        if(time - timestamp[index] > cacheSize) {
+            timestamp[index] = time++;
+            ++transformedVertexCount;
+        }
+    }
+
+    VertexCacheStatistics statistics;
+    statistics.transformedVertexCount = transformedVertexCount;
+    statistics.averageCacheMissRatio = indices.empty() ? 0.0f : Float(transformedVertexCount)/Float(indices.size()/3);
+    statistics.averageTransformToVertexRatio = referencedVertexCount ? Float(transformedVertexCount)/Float(referencedVertexCount) : 0.0f;
+    return statistics;
+}
+
+void optimizeVertexCache(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::optimizeVertexCache(): index count is not divisible by 3", );
+    CORRADE_ASSERT(cacheSize > 3, "MeshTools::optimizeVertexCache(): expected cache size larger than 3, got" << cacheSize, );
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Neighboring triangles for each vertex, per-vertex live triangle count */
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::Tipsify{indices, vertexCount}.buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+
+    /* Initial vertex and triangle scores, nothing is in the cache yet */
+    std::vector<Float> vertexScore(vertexCount);
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        vertexScore[i] = forsythVertexScore(-1, liveTriangleCount[i], cacheSize);
+    std::vector<Float> triangleScore(triangleCount);
+    for(std::size_t i = 0; i != triangleCount; ++i)
+        triangleScore[i] = vertexScore[indices[i*3]] + vertexScore[indices[i*3 + 1]] + vertexScore[indices[i*3 + 2]];
+
+    /* Per-triangle emitted flag, output index buffer */
+    std::vector<bool> emitted(triangleCount);
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+
+    /* LRU cache, with space for vertices that get pushed out of it after
+       adding a triangle */
+    std::vector<UnsignedInt> cache, newCache;
+    cache.reserve(cacheSize + 3);
+    newCache.reserve(cacheSize + 3);
+
+    /* Start with the best triangle. If no triangle touches the cache, the
+       next one that wasn't emitted yet is taken, the cursor makes that
+       linear. */
+    std::size_t best = std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin();
+    std::size_t cursor = 0;
+    while(best != triangleCount) {
+        emitted[best] = true;
+
+        /* Emit the triangle and put its vertices to the front of the cache */
+        const UnsignedInt* const triangle = indices.data() + best*3;
+        newCache.clear();
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = triangle[i];
+            outputIndices.push_back(v);
+            --liveTriangleCount[v];
+            if(std::find(newCache.begin(), newCache.end(), v) == newCache.end())
+                newCache.push_back(v);
+        }
+        for(const UnsignedInt v: cache)
+            if(v != triangle[0] && v != triangle[1] && v != triangle[2])
+                newCache.push_back(v);
+
+        using std::swap;
+        swap(cache, newCache);
+
+        /* Update scores of vertices in the cache, including the ones that
+           were just pushed out of it */
+        for(std::size_t i = 0; i != cache.size(); ++i) {
+            const UnsignedInt v = cache[i];
+            vertexScore[v] = forsythVertexScore(i < cacheSize ? Int(i) : -1, liveTriangleCount[v], cacheSize);
+        }
+
+        /* Update scores of triangles using these vertices and pick the best
+           one. All live triangles have a positive score. */
+        best = triangleCount;
+        Float bestScore = 0.0f;
+        for(const UnsignedInt v: cache) {
+            for(UnsignedInt i = neighborOffset[v]; i != neighborOffset[v + 1]; ++i) {
+                const UnsignedInt t = neighbors[i];
+                if(emitted[t]) continue;
+
+                triangleScore[t] = vertexScore[indices[t*3]] + vertexScore[indices[t*3 + 1]] + vertexScore[indices[t*3 + 2]];
+                if(triangleScore[t] > bestScore) {
+                    bestScore = triangleScore[t];
+                    best = t;
+                }
+            }
+        }
+
+        if(cache.size() > cacheSize) cache.resize(cacheSize);
+
+        /* Dead end, take the next triangle that wasn't emitted yet */
+        if(best == triangleCount) {
+            while(cursor != triangleCount && emitted[cursor]) ++cursor;
+            best = cursor;
+        }
+    }
+
+    /* Swap original index buffer with optimized */
+    using std::swap;
+    swap(indices, outputIndices);
+}
+
+void optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::optimizeOverdraw(): index count is not divisible by 3", );
+    CORRADE_ASSERT(threshold >= 1.0f, "MeshTools::optimizeOverdraw(): expected threshold to be at least 1, got" << threshold, );
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Simulate FIFO vertex cache to get cache misses of each triangle */
+    UnsignedInt time = cacheSize + 1;
+    std::vector<UnsignedInt> timestamp(positions.size());
+    std::vector<UnsignedByte> misses(triangleCount);
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt v = indices[i];
+        CORRADE_ASSERT(v < positions.size(),
+            "MeshTools::optimizeOverdraw(): index" << v << "out of bounds for" << positions.size() << "vertices", );
+        if(time - timestamp[v] > cacheSize) {
+            timestamp[v] = time++;
+            ++misses[i/3];
+        }
+    }
+
+    /* Split the mesh into clusters. Hard boundaries are where the cache was
+       flushed, that is all vertices of the triangle missed. Inside these,
+       split also at triangles with at least two misses, if the cache miss
+       ratio of the cluster so far doesn't exceed the threshold. */
+    std::vector<std::size_t> clusterOffsets;
+    for(std::size_t start = 0; start != triangleCount; ) {
+        std::size_t end = start + 1;
+        UnsignedInt totalMisses = misses[start];
+        while(end != triangleCount && misses[end] != 3)
+            totalMisses += misses[end++];
+
+        const Float maxRatio = threshold*Float(totalMisses)/Float(end - start);
+        clusterOffsets.push_back(start);
+        UnsignedInt clusterMisses = misses[start];
+        for(std::size_t i = start + 1, clusterStart = start; i != end; ++i) {
+            if(misses[i] >= 2 && Float(clusterMisses)/Float(i - clusterStart) <= maxRatio) {
+                clusterOffsets.push_back(i);
+                clusterStart = i;
+                clusterMisses = 0;
+            }
+            clusterMisses += misses[i];
+        }
+
+        start = end;
+    }
+    clusterOffsets.push_back(triangleCount);
+
+    /* Area-weighted centroid and normal of every cluster and of the whole
+       mesh */
+    const std::size_t clusterCount = clusterOffsets.size() - 1;
+    std::vector<Vector3> clusterCentroids(clusterCount);
+    std::vector<Vector3> clusterNormals(clusterCount);
+    Vector3 meshCentroid;
+    Float meshArea = 0.0f;
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        Vector3 centroid;
+        Vector3 normal;
+        Float area = 0.0f;
+        for(std::size_t t = clusterOffsets[i]; t != clusterOffsets[i + 1]; ++t) {
+            const Vector3& a = positions[indices[t*3]];
+            const Vector3& b = positions[indices[t*3 + 1]];
+            const Vector3& c = positions[indices[t*3 + 2]];
+            const Vector3 cross = Math::cross(b - a, c - a);
+            const Float triangleArea = cross.length()*0.5f;
+            centroid += (a + b + c)*(triangleArea/3.0f);
+            normal += cross;
+            area += triangleArea;
+        }
+
+        meshCentroid += centroid;
+        meshArea += area;
+        clusterCentroids[i] = area == 0.0f ? centroid : centroid/area;
+        clusterNormals[i] = normal;
+    }
+    if(meshArea != 0.0f) meshCentroid /= meshArea;
+
+    /* Clusters facing outwards from the center go first */
+    std::vector<Float> clusterSortKey(clusterCount);
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        const Float normalLength = clusterNormals[i].length();
+        clusterSortKey[i] = normalLength == 0.0f ? 0.0f :
+            Math::dot(clusterCentroids[i] - meshCentroid, clusterNormals[i]/normalLength);
+    }
+    std::vector<UnsignedInt> clusterOrder(clusterCount);
+    for(std::size_t i = 0; i != clusterCount; ++i) clusterOrder[i] = i;
+    std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&clusterSortKey](UnsignedInt a, UnsignedInt b) {
+        return clusterSortKey[a] > clusterSortKey[b];
+    });
+
+    /* Put the clusters together in the new order */
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+    for(const UnsignedInt cluster: clusterOrder)
+        outputIndices.insert(outputIndices.end(),
+            indices.begin() + clusterOffsets[cluster]*3,
+            indices.begin() + clusterOffsets[cluster + 1]*3);
+
+    /* Swap original index buffer with optimized */
+    using std::swap;
+    swap(indices, outputIndices);
+}
+
+std::vector<UnsignedInt> optimizeVertexFetch(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount) {
+    /* New index of each vertex, original index of each new vertex */
+    std::vector<UnsignedInt> newIndex(vertexCount, ~UnsignedInt{});
+    std::vector<UnsignedInt> remapping;
+    remapping.reserve(vertexCount);
+
+    for(UnsignedInt& index: indices) {
+        CORRADE_ASSERT(index < vertexCount,
+            "MeshTools::optimizeVertexFetch(): index" << index << "out of bounds for" << vertexCount << "vertices", {});
+        if(newIndex[index] == ~UnsignedInt{}) {
+            newIndex[index] = remapping.size();
+            remapping.push_back(index);
+        }
+
+        index = newIndex[index];
+    }
+
+    return remapping;
+}
+
+}}
@@ -0,0 +1,164 @@
+#ifndef Magnum_MeshTools_Optimize_h
+#define Magnum_MeshTools_Optimize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::VertexCacheStatistics, function @ref Magnum::MeshTools::analyzeVertexCache(), @ref Magnum::MeshTools::optimizeVertexCache(), @ref Magnum::MeshTools::optimizeOverdraw(), @ref Magnum::MeshTools::optimizeVertexFetch()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Vertex cache statistics
+
+@see @ref analyzeVertexCache()
+*/
+struct VertexCacheStatistics {
+    /**
+     * @brief Transformed vertex count
+     *
+     * Count of vertex shader invocations, i.e. post-transform cache misses.
+     */
+    UnsignedInt transformedVertexCount;
+
+    /**
+     * @brief Average cache miss ratio
+     *
+     * Transformed vertex count divided by triangle count. The value is in
+     * range @f$ [0.5, 3] @f$ for usual meshes, the lower the better.
+     */
+    Float averageCacheMissRatio;
+
+    /**
+     * @brief Average transform to vertex ratio
+     *
+     * Transformed vertex count divided by count of referenced vertices. The
+     * ideal value is @cpp 1.0f @ce, meaning each vertex is transformed only
+     * once. Unlike @ref averageCacheMissRatio, the value doesn't depend on
+     * mesh topology, so it's better for comparing results across meshes.
+     */
+    Float averageTransformToVertexRatio;
+};
+
+/**
+@brief Analyze post-transform vertex cache efficiency
+@param indices      Index array
+@param vertexCount  Vertex count
+@param cacheSize    Post-transform vertex cache size
+
+Simulates a FIFO post-transform vertex cache of given size and counts the
+misses. Useful for measuring the effect of @ref tipsify(),
+@ref optimizeVertexCache() or @ref optimizeOverdraw() on given mesh.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+VertexCacheStatistics MAGNUM_MESHTOOLS_EXPORT analyzeVertexCache(const std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+@brief Optimize the mesh for post-transform vertex cache
+@param[in,out] indices  Index array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Post-transform vertex cache size
+
+Rearranges the index array for better usage of post-transform vertex cache.
+Compared to @ref tipsify() it gives lower cache miss ratio in exchange for
+being slower. Algorithm used: *Tom Forsyth --- Linear-Speed Vertex Cache
+Optimisation, 2006, https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html*.
+The cache is simulated as LRU, which makes the result work well also for
+hardware with unknown or differently sized cache. Triangle order inside the
+mesh changes, but the winding of each triangle is preserved.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. Cache size is expected to be larger than
+    @cpp 3 @ce.
+
+@see @ref optimizeOverdraw(), @ref optimizeVertexFetch(),
+    @ref analyzeVertexCache()
+*/
+void MAGNUM_MESHTOOLS_EXPORT optimizeVertexCache(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize = 32);
+
+/**
+@brief Optimize the mesh for reduced overdraw
+@param[in,out] indices  Index array to operate on
+@param[in] positions    Vertex positions
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in] threshold    Allowed cache miss ratio degradation
+
+Expects that the index array is already optimized for post-transform vertex
+cache using @ref optimizeVertexCache() or @ref tipsify(). The index array is
+split into clusters at places where the cache is flushed and, as long as the
+cache miss ratio of the cluster doesn't exceed @p threshold multiple of the
+original, also in other places. The clusters are then sorted so the ones that
+are facing outwards from the mesh center are drawn first, making it likely
+that they occlude the rest of the mesh. Algorithm used: *Pedro V. Sander,
+Diego Nehab, and Joshua Barczak --- Fast Triangle Reordering for Vertex
+Locality and Reduced Overdraw, SIGGRAPH 2007,
+http://gfx.cs.princeton.edu/pubs/Sander_2007_%3ETR/index.php*.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. The threshold is expected to be at least
+    @cpp 1.0f @ce.
+
+@see @ref optimizeVertexFetch(), @ref analyzeVertexCache()
+*/
+void MAGNUM_MESHTOOLS_EXPORT optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t cacheSize = 32, Float threshold = 1.05f);
+
+/**
+@brief Optimize the mesh for vertex fetch
+@param[in,out] indices  Index array to operate on
+@param[in] vertexCount  Vertex count
+@return Vertex remapping
+
+Renumbers the vertices in order in which they are first referenced by the
+index array, so the vertex data are fetched sequentially when drawing. The
+last step in the pipeline, should be done after @ref optimizeVertexCache()
+and @ref optimizeOverdraw(). The returned array contains the original index
+for every new vertex, vertices that aren't referenced by the index array are
+not present in it. Use @ref duplicate() to reorder the vertex data with it:
+
+@code{.cpp}
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+std::vector<Vector3> normals;
+
+MeshTools::optimizeVertexCache(indices, positions.size());
+MeshTools::optimizeOverdraw(indices, positions);
+std::vector<UnsignedInt> remapping = MeshTools::optimizeVertexFetch(indices, positions.size());
+positions = MeshTools::duplicate(remapping, positions);
+normals = MeshTools::duplicate(remapping, normals);
+@endcode
+*/
+std::vector<UnsignedInt> MAGNUM_MESHTOOLS_EXPORT optimizeVertexFetch(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+}}
+
+#endif
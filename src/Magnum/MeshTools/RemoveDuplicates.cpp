@@ -0,0 +1,213 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RemoveDuplicates.h"
+
+#include <cstdint>
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Below this item count the data are always processed on the calling
+   thread, as the overhead of hashing and sharding would outweigh the gains */
+constexpr std::size_t ParallelThreshold = 65536;
+
+/* Task count per thread. The tasks are assigned to threads dynamically,
+   having more tasks than threads makes the work better balanced. */
+constexpr std::size_t ParallelTasksPerThread = 4;
+
+/* Word-wise multiply-xorshift hash with a splitmix64 finalizer, so also
+   differences in the upper bytes of each word end up in the lower bits
+   that are used for indexing the table */
+std::uint64_t hashItem(const char* const data, const std::size_t size) {
+    std::uint64_t hash = 0xcbf29ce484222325ull ^ size;
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        hash = (hash ^ word)*0x9e3779b97f4a7c15ull;
+        hash ^= hash >> 32;
+    }
+    for(; i != size; ++i)
+        hash = (hash ^ UnsignedByte(data[i]))*0x100000001b3ull;
+
+    hash = (hash ^ (hash >> 30))*0xbf58476d1ce4e5b9ull;
+    hash = (hash ^ (hash >> 27))*0x94d049bb133111ebull;
+    return hash ^ (hash >> 31);
+}
+
+/* Power-of-two table size with load factor at most 0.5, keeping the linear
+   probe sequences short */
+std::size_t tableSizeFor(const std::size_t count) {
+    std::size_t size = 1;
+    while(size < count*2) size <<= 1;
+    return size;
+}
+
+}
+
+namespace Implementation {
+
+std::size_t removeDuplicatesInto(const char* const data, const std::size_t count, const std::ptrdiff_t stride, const std::size_t itemSize, UnsignedInt* const indices, const UnsignedInt threadCount) {
+    /* Single open-addressing table with original index of the first
+       occurrence of each unique item, new indices are assigned in order of
+       first occurrence */
+    if(threadCount <= 1 || count < ParallelThreshold) {
+        const std::size_t tableMask = tableSizeFor(count) - 1;
+        std::vector<UnsignedInt> table(tableMask + 1, ~UnsignedInt{});
+
+        std::size_t uniqueCount = 0;
+        for(std::size_t i = 0; i != count; ++i) {
+            const char* const item = data + i*stride;
+            for(std::size_t bucket = hashItem(item, itemSize) & tableMask; ; bucket = (bucket + 1) & tableMask) {
+                const UnsignedInt first = table[bucket];
+
+                /* Not found, the item is unique */
+                if(first == ~UnsignedInt{}) {
+                    table[bucket] = i;
+                    indices[i] = uniqueCount++;
+                    break;
+                }
+
+                /* Found a duplicate */
+                if(std::memcmp(data + first*stride, item, itemSize) == 0) {
+                    indices[i] = indices[first];
+                    break;
+                }
+            }
+        }
+
+        return uniqueCount;
+    }
+
+    /* Split the items into contiguous chunks and the hash space into shards
+       addressed by the top bits of the hash, at least two of both as there's
+       at least two threads. Equal items always end up in the same shard, so
+       each shard can be deduplicated independently. */
+    const std::size_t taskCount = std::size_t(threadCount)*ParallelTasksPerThread;
+    const std::size_t chunkSize = (count + taskCount - 1)/taskCount;
+    std::size_t shardBits = 1;
+    while((std::size_t{1} << shardBits) < taskCount) ++shardBits;
+    const std::size_t shardCount = std::size_t{1} << shardBits;
+
+    /* Hash all items and count them per chunk and shard */
+    std::vector<std::uint64_t> hashes(count);
+    std::vector<std::size_t> offsets(taskCount*shardCount);
+    Magnum::Implementation::parallelFor(threadCount, taskCount, [&](const std::size_t chunk) {
+        std::size_t* const chunkOffsets = offsets.data() + chunk*shardCount;
+        for(std::size_t i = chunk*chunkSize, end = Math::min(i + chunkSize, count); i < end; ++i) {
+            hashes[i] = hashItem(data + i*stride, itemSize);
+            ++chunkOffsets[hashes[i] >> (64 - shardBits)];
+        }
+    });
+
+    /* Turn the counts into offsets. Items of each shard are stored
+       contiguously and, because chunks are processed in order, sorted by
+       their original index. */
+    std::vector<std::size_t> shardOffsets(shardCount + 1);
+    std::size_t offset = 0;
+    for(std::size_t shard = 0; shard != shardCount; ++shard) {
+        shardOffsets[shard] = offset;
+        for(std::size_t chunk = 0; chunk != taskCount; ++chunk) {
+            const std::size_t chunkCount = offsets[chunk*shardCount + shard];
+            offsets[chunk*shardCount + shard] = offset;
+            offset += chunkCount;
+        }
+    }
+    shardOffsets[shardCount] = offset;
+
+    /* Distribute the items into the shards */
+    std::vector<UnsignedInt> shardItems(count);
+    Magnum::Implementation::parallelFor(threadCount, taskCount, [&](const std::size_t chunk) {
+        std::size_t* const chunkOffsets = offsets.data() + chunk*shardCount;
+        for(std::size_t i = chunk*chunkSize, end = Math::min(i + chunkSize, count); i < end; ++i)
+            shardItems[chunkOffsets[hashes[i] >> (64 - shardBits)]++] = i;
+    });
+
+    /* Find the first occurrence of each item inside the shards */
+    Magnum::Implementation::parallelFor(threadCount, shardCount, [&](const std::size_t shard) {
+        const std::size_t begin = shardOffsets[shard], end = shardOffsets[shard + 1];
+        const std::size_t tableMask = tableSizeFor(end - begin) - 1;
+        std::vector<UnsignedInt> table(tableMask + 1, ~UnsignedInt{});
+
+        for(std::size_t j = begin; j != end; ++j) {
+            const UnsignedInt i = shardItems[j];
+            const char* const item = data + i*stride;
+            for(std::size_t bucket = hashes[i] & tableMask; ; bucket = (bucket + 1) & tableMask) {
+                const UnsignedInt first = table[bucket];
+                if(first == ~UnsignedInt{}) {
+                    table[bucket] = indices[i] = i;
+                    break;
+                }
+
+                if(hashes[first] == hashes[i] && std::memcmp(data + first*stride, item, itemSize) == 0) {
+                    indices[i] = first;
+                    break;
+                }
+            }
+        }
+    });
+
+    /* Assign new indices in order of first occurrence, which makes the
+       output the same as with the serial version. The first occurrence is
+       always before, so its new index is already known. */
+    std::size_t uniqueCount = 0;
+    for(std::size_t i = 0; i != count; ++i)
+        indices[i] = indices[i] == i ? uniqueCount++ : indices[indices[i]];
+
+    return uniqueCount;
+}
+
+}
+
+std::pair<std::vector<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView<char>& data, const std::size_t itemSize, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(itemSize, "MeshTools::removeDuplicatesInPlace(): expected non-zero item size", {});
+    CORRADE_ASSERT(data.size() <= 1 || std::size_t(data.stride()) >= itemSize,
+        "MeshTools::removeDuplicatesInPlace(): expected stride to be at least" << itemSize << "bytes, got" << data.stride(), {});
+
+    std::vector<UnsignedInt> indices(data.size());
+    if(data.empty()) return {std::move(indices), 0};
+
+    const std::size_t uniqueCount = Implementation::removeDuplicatesInto(&data[0], data.size(), data.stride(), itemSize, indices.data(), threadCount);
+
+    /* Move the unique items to their new (earlier) position. New indices of
+       unique items are increasing, so the items that weren't moved yet are
+       never overwritten. */
+    for(std::size_t i = 0, next = 0; i != data.size(); ++i) {
+        if(indices[i] != next) continue;
+        if(next != i) std::memcpy(&data[next], &data[i], itemSize);
+        ++next;
+    }
+
+    return {std::move(indices), uniqueCount};
+}
+
+}}
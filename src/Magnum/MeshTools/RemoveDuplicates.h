@@ -26,17 +26,22 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::removeDuplicates()
+ * @brief Function @ref Magnum::MeshTools::removeDuplicates(), @ref Magnum::MeshTools::removeDuplicatesInPlace()
  */
 
 #include <limits>
 #include <numeric>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Algorithms/MinMax.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -47,6 +52,10 @@ namespace Implementation {
                 return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(&data), sizeof(data)).byteArray());
             }
     };
+
+    /* Fills new index of each item, returns unique item count. Data are
+       not modified. Also used by combineIndexArrays(). */
+    MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const char* data, std::size_t count, std::ptrdiff_t stride, std::size_t itemSize, UnsignedInt* indices, UnsignedInt threadCount);
 }
 
 /**
@@ -60,7 +69,8 @@ Removes duplicate data from the array by collapsing them into buckets of size
 @p epsilon. First vector in given bucket is used, other ones are thrown away,
 no interpolation is done. Note that this function is meant to be used for
 floating-point data (or generally with non-zero @p epsilon), for discrete data
-the usual sorting method is much more efficient.
+use @ref removeDuplicatesInPlace(), which does a single pass using exact
+comparison.
 
 If you want to remove duplicate data from already indexed array, first remove
 duplicates as if the array wasn't indexed at all and then use @ref duplicate()
@@ -74,14 +84,13 @@ to combine the resulting index arrays to single index array and reorder the
 data accordingly:
 
 @snippet MagnumMeshTools.cpp removeDuplicates2
+
+@see @ref removeDuplicatesInPlace()
 */
 template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon = Math::TypeTraits<typename Vector::Type>::epsilon()) {
     /* Get bounds */
-    Vector min = data[0], max = data[0];
-    for(const auto& v: data) {
-        min = Math::min(v, min);
-        max = Math::max(v, max);
-    }
+    Vector min, max;
+    std::tie(min, max) = Math::Algorithms::minmax(Containers::StridedArrayView<const Vector>{data.data(), data.size(), sizeof(Vector)});
 
     /* Make epsilon so large that std::size_t can index all vectors inside the
        bounds. */
@@ -140,6 +149,67 @@ template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vec
     return resultIndices;
 }
 
+/**
+@brief Remove exact duplicate items from type-erased data in-place
+@param[in,out] data Input data
+@param[in] itemSize Size of each item in bytes
+@param[in] threadCount Max thread count used for the operation, including
+    the calling thread
+@return Index array and unique item count
+
+Each item is @p itemSize bytes starting at the beginning of each element of
+@p data. Unlike @ref removeDuplicates(), the items are compared bitwise, which
+makes it possible to deduplicate whole vertices of arbitrary layout directly in
+interleaved vertex data, as opposed to deduplicating each attribute separately.
+The items are looked up in an open-addressing hash table, so the operation is
+done in a single @f$ \mathcal{O}(n) @f$ pass over the data.
+
+First occurrence of each item is kept, unique items are moved to the front of
+@p data in order of their first occurrence and the rest is left in an
+unspecified state. The first value of the returned pair is an index array
+mapping each original item to its new position, the second value is count of
+unique items:
+
+@code{.cpp}
+char* vertexData;
+std::size_t vertexCount, vertexSize;
+
+std::vector<UnsignedInt> indices;
+std::size_t uniqueVertexCount;
+std::tie(indices, uniqueVertexCount) = MeshTools::removeDuplicatesInPlace(
+    Containers::StridedArrayView<char>{vertexData, vertexCount, vertexSize},
+    vertexSize);
+@endcode
+
+Because the comparison is bitwise, floating-point @cpp -0.0f @ce and
+@cpp 0.0f @ce are considered different and padding bytes inside the items, if
+any, have to be initialized. Expects that @p itemSize is not zero and not
+larger than stride of @p data.
+
+For huge meshes the operation can be distributed over multiple threads by
+setting @p threadCount to a value larger than @cpp 1 @ce. The items are then
+hashed in parallel and distributed into shards by the top bits of their hash,
+each shard being deduplicated independently. The output is the same as with
+the single-threaded operation. The work runs on @ref globalJobExecutor() and
+@p threadCount limits how many of its workers are used, no threads are
+created by the operation itself. If there's less than 65536 items, the
+operation is done on the calling thread only, as the overhead would outweigh
+the gains. Multithreaded operation is not available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where @p threadCount is
+ignored.
+*/
+std::pair<std::vector<UnsignedInt>, std::size_t> MAGNUM_MESHTOOLS_EXPORT removeDuplicatesInPlace(const Containers::StridedArrayView<char>& data, std::size_t itemSize, UnsignedInt threadCount = 1);
+
+/**
+@brief Remove exact duplicate items from typed data in-place
+
+Equivalent to calling @ref removeDuplicatesInPlace(const Containers::StridedArrayView<char>&, std::size_t, UnsignedInt)
+with @p data casted to a view of bytes and @cpp sizeof(T) @ce as item size.
+*/
+template<class T> std::pair<std::vector<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView<T>& data, UnsignedInt threadCount = 1) {
+    return removeDuplicatesInPlace(Containers::StridedArrayView<char>{reinterpret_cast<char*>(data.data()), data.size(), data.stride()}, sizeof(T), threadCount);
+}
+
 }}
 
 #endif
@@ -0,0 +1,385 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <queue>
+#include <tuple>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Penalty for moving boundary vertices away from the boundary, relative to
+   the face quadrics */
+constexpr Double BoundaryWeight = 10.0;
+
+/* Symmetric 4x4 matrix (in doubles for precision) and accumulated face area
+   to express the error as a squared distance */
+struct Quadric {
+    Double a00, a01, a02, a03, a11, a12, a13, a22, a23, a33, weight;
+};
+
+/* Quadric of a plane with unit normal n and distance d from origin */
+Quadric planeQuadric(const Vector3d& n, const Double d, const Double weight) {
+    return {
+        weight*n.x()*n.x(), weight*n.x()*n.y(), weight*n.x()*n.z(), weight*n.x()*d,
+        weight*n.y()*n.y(), weight*n.y()*n.z(), weight*n.y()*d,
+        weight*n.z()*n.z(), weight*n.z()*d,
+        weight*d*d, 0.0
+    };
+}
+
+Quadric& operator+=(Quadric& a, const Quadric& b) {
+    a.a00 += b.a00; a.a01 += b.a01; a.a02 += b.a02; a.a03 += b.a03;
+    a.a11 += b.a11; a.a12 += b.a12; a.a13 += b.a13;
+    a.a22 += b.a22; a.a23 += b.a23;
+    a.a33 += b.a33;
+    a.weight += b.weight;
+    return a;
+}
+
+/* Squared distance-like error of moving both vertices of given quadrics to
+   position p */
+Double evaluate(const Quadric& a, const Quadric& b, const Vector3& position) {
+    const Double x = position.x(), y = position.y(), z = position.z();
+    const Double a00 = a.a00 + b.a00, a01 = a.a01 + b.a01, a02 = a.a02 + b.a02, a03 = a.a03 + b.a03,
+        a11 = a.a11 + b.a11, a12 = a.a12 + b.a12, a13 = a.a13 + b.a13,
+        a22 = a.a22 + b.a22, a23 = a.a23 + b.a23, a33 = a.a33 + b.a33;
+    const Double weight = a.weight + b.weight;
+    const Double error =
+        x*(a00*x + 2.0*(a01*y + a02*z + a03)) +
+        y*(a11*y + 2.0*(a12*z + a13)) +
+        z*(a22*z + 2.0*a23) + a33;
+    return weight != 0.0 ? Math::max(error/weight, 0.0) : 0.0;
+}
+
+enum class VertexKind: UnsignedByte {
+    /* Can be collapsed onto any neighbor */
+    Interior,
+    /* Can be collapsed only onto a boundary neighbor along a boundary edge */
+    Boundary,
+    /* Shares position with other vertices, never collapsed */
+    Locked
+};
+
+struct Collapse {
+    Double error;
+    UnsignedInt from, to;
+
+    bool operator<(const Collapse& other) const {
+        /* Reversed for std::priority_queue to pop the smallest error first */
+        return error > other.error;
+    }
+};
+
+class Simplifier {
+    public:
+        explicit Simplifier(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions);
+
+        std::size_t triangleCount() const { return _triangleCount; }
+
+        Float error() const { return Float(std::sqrt(_errorSquared)); }
+
+        std::vector<UnsignedInt> indices() const;
+
+        /* Collapses edges until at most targetTriangleCount triangles is left
+           or the next collapse would exceed targetError */
+        void collapse(std::size_t targetTriangleCount, Float targetError);
+
+    private:
+        void pushCollapse(UnsignedInt from, UnsignedInt to) {
+            if(_kinds[from] == VertexKind::Locked) return;
+            _queue.push({evaluate(_quadrics[from], _quadrics[to], _positions[to]), from, to});
+        }
+
+        /* Count of live triangles around `from` that contain `to` (or a
+           vertex with the same position) */
+        UnsignedInt edgeTriangleCount(UnsignedInt from, UnsignedInt to) const;
+
+        bool isValid(UnsignedInt from, UnsignedInt to) const;
+
+        const std::vector<Vector3>& _positions;
+        std::vector<UnsignedInt> _indices, _canonical;
+        std::vector<bool> _liveTriangles, _liveVertices;
+        std::vector<std::vector<UnsignedInt>> _vertexTriangles;
+        std::vector<Quadric> _quadrics;
+        std::vector<VertexKind> _kinds;
+        std::priority_queue<Collapse> _queue;
+        std::size_t _triangleCount;
+        Double _errorSquared{};
+};
+
+Simplifier::Simplifier(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions): _positions(positions), _indices(indices), _canonical(positions.size()), _liveTriangles(indices.size()/3, true), _liveVertices(positions.size(), true), _vertexTriangles(positions.size()), _quadrics(positions.size(), Quadric{}), _kinds(positions.size(), VertexKind::Interior), _triangleCount{indices.size()/3} {
+    /* Map each vertex to the first vertex with the same position, lock all
+       vertices that share a position */
+    {
+        std::vector<UnsignedInt> order(positions.size());
+        for(std::size_t i = 0; i != order.size(); ++i) order[i] = i;
+        auto less = [&positions](UnsignedInt a, UnsignedInt b) {
+            return std::make_tuple(positions[a].x(), positions[a].y(), positions[a].z()) <
+                   std::make_tuple(positions[b].x(), positions[b].y(), positions[b].z());
+        };
+        std::stable_sort(order.begin(), order.end(), less);
+        for(std::size_t i = 0; i != order.size(); ) {
+            std::size_t end = i + 1;
+            while(end != order.size() && positions[order[end]] == positions[order[i]]) ++end;
+            for(std::size_t j = i; j != end; ++j) {
+                _canonical[order[j]] = order[i];
+                if(end - i > 1) _kinds[order[j]] = VertexKind::Locked;
+            }
+            i = end;
+        }
+    }
+
+    /* Edges between canonical vertices, those with a single triangle are on
+       a boundary */
+    std::vector<std::uint64_t> edges;
+    edges.reserve(indices.size());
+    auto edgeKey = [this](UnsignedInt a, UnsignedInt b) {
+        a = _canonical[a];
+        b = _canonical[b];
+        return std::uint64_t(Math::min(a, b)) << 32 | Math::max(a, b);
+    };
+    for(std::size_t i = 0; i != indices.size(); i += 3)
+        for(std::size_t j = 0; j != 3; ++j)
+            edges.push_back(edgeKey(indices[i + j], indices[i + (j + 1)%3]));
+    std::sort(edges.begin(), edges.end());
+
+    /* Face quadrics weighted by area, boundary quadrics perpendicular to the
+       face along boundary edges */
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        for(std::size_t j = 0; j != 3; ++j)
+            _vertexTriangles[indices[i + j]].push_back(i/3);
+
+        const Vector3d a{positions[indices[i]]},
+            b{positions[indices[i + 1]]},
+            c{positions[indices[i + 2]]};
+        const Vector3d cross = Math::cross(b - a, c - a);
+        const Double length = cross.length();
+        if(length == 0.0) continue;
+        const Vector3d normal = cross/length;
+
+        Quadric face = planeQuadric(normal, -Math::dot(normal, a), length*0.5);
+        face.weight = length*0.5;
+        for(std::size_t j = 0; j != 3; ++j)
+            _quadrics[indices[i + j]] += face;
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt from = indices[i + j], to = indices[i + (j + 1)%3];
+            const std::uint64_t key = edgeKey(from, to);
+            if(std::upper_bound(edges.begin(), edges.end(), key) - std::lower_bound(edges.begin(), edges.end(), key) != 1)
+                continue;
+
+            const Vector3d p{positions[from]}, edge = Vector3d{positions[to]} - p;
+            const Vector3d edgeNormal = Math::cross(edge, normal).normalized();
+            const Quadric boundary = planeQuadric(edgeNormal, -Math::dot(edgeNormal, p), edge.dot()*BoundaryWeight);
+            for(const UnsignedInt vertex: {from, to}) {
+                _quadrics[vertex] += boundary;
+                if(_kinds[vertex] == VertexKind::Interior)
+                    _kinds[vertex] = VertexKind::Boundary;
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i != indices.size(); i += 3)
+        for(std::size_t j = 0; j != 3; ++j) {
+            pushCollapse(indices[i + j], indices[i + (j + 1)%3]);
+            pushCollapse(indices[i + (j + 1)%3], indices[i + j]);
+        }
+}
+
+std::vector<UnsignedInt> Simplifier::indices() const {
+    std::vector<UnsignedInt> out;
+    out.reserve(_triangleCount*3);
+    for(std::size_t i = 0; i != _liveTriangles.size(); ++i)
+        if(_liveTriangles[i]) out.insert(out.end(), _indices.begin() + i*3, _indices.begin() + i*3 + 3);
+    return out;
+}
+
+UnsignedInt Simplifier::edgeTriangleCount(const UnsignedInt from, const UnsignedInt to) const {
+    UnsignedInt count = 0;
+    for(const UnsignedInt triangle: _vertexTriangles[from]) {
+        if(!_liveTriangles[triangle]) continue;
+        for(std::size_t i = 0; i != 3; ++i) if(_canonical[_indices[triangle*3 + i]] == _canonical[to]) {
+            ++count;
+            break;
+        }
+    }
+    return count;
+}
+
+bool Simplifier::isValid(const UnsignedInt from, const UnsignedInt to) const {
+    /* The edge has to still exist */
+    const UnsignedInt edgeCount = edgeTriangleCount(from, to);
+    if(!edgeCount) return false;
+
+    /* Boundary vertices can move only along the boundary */
+    if(_kinds[from] == VertexKind::Boundary && (_kinds[to] == VertexKind::Interior || edgeCount != 1))
+        return false;
+
+    /* Triangles that are not removed by the collapse can't flip */
+    for(const UnsignedInt triangle: _vertexTriangles[from]) {
+        if(!_liveTriangles[triangle]) continue;
+
+        const UnsignedInt* const indices = _indices.data() + triangle*3;
+        if(_canonical[indices[0]] == _canonical[to] ||
+           _canonical[indices[1]] == _canonical[to] ||
+           _canonical[indices[2]] == _canonical[to]) continue;
+
+        Vector3 a = _positions[indices[0]], b = _positions[indices[1]], c = _positions[indices[2]];
+        const Vector3 normal = Math::cross(b - a, c - a);
+        if(normal.isZero()) continue;
+        if(indices[0] == from) a = _positions[to];
+        else if(indices[1] == from) b = _positions[to];
+        else c = _positions[to];
+        if(Math::dot(Math::cross(b - a, c - a), normal) <= 0.0f) return false;
+    }
+
+    return true;
+}
+
+void Simplifier::collapse(const std::size_t targetTriangleCount, const Float targetError) {
+    const Double targetErrorSquared = Double(targetError)*Double(targetError);
+
+    while(_triangleCount > targetTriangleCount && !_queue.empty()) {
+        const Collapse collapse = _queue.top();
+        if(!_liveVertices[collapse.from] || !_liveVertices[collapse.to]) {
+            _queue.pop();
+            continue;
+        }
+
+        /* The quadrics changed since the collapse was queued, requeue it with
+           the up-to-date error */
+        const Double error = evaluate(_quadrics[collapse.from], _quadrics[collapse.to], _positions[collapse.to]);
+        if(error != collapse.error) {
+            _queue.pop();
+            _queue.push({error, collapse.from, collapse.to});
+            continue;
+        }
+
+        /* Smallest possible error is too large, leave the collapse in the
+           queue for a potential next call with larger target error */
+        if(error > targetErrorSquared) break;
+
+        _queue.pop();
+        if(!isValid(collapse.from, collapse.to)) continue;
+
+        /* Remove triangles sharing the edge, move the rest to the target
+           vertex */
+        std::vector<UnsignedInt>& toTriangles = _vertexTriangles[collapse.to];
+        for(const UnsignedInt triangle: _vertexTriangles[collapse.from]) {
+            if(!_liveTriangles[triangle]) continue;
+
+            UnsignedInt* const indices = _indices.data() + triangle*3;
+            if(_canonical[indices[0]] == _canonical[collapse.to] ||
+               _canonical[indices[1]] == _canonical[collapse.to] ||
+               _canonical[indices[2]] == _canonical[collapse.to]) {
+                _liveTriangles[triangle] = false;
+                --_triangleCount;
+                continue;
+            }
+
+            for(std::size_t i = 0; i != 3; ++i)
+                if(indices[i] == collapse.from) indices[i] = collapse.to;
+            toTriangles.push_back(triangle);
+        }
+        toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(), [this](UnsignedInt triangle) {
+            return !_liveTriangles[triangle];
+        }), toTriangles.end());
+        std::vector<UnsignedInt>{}.swap(_vertexTriangles[collapse.from]);
+
+        _quadrics[collapse.to] += _quadrics[collapse.from];
+        _liveVertices[collapse.from] = false;
+        _errorSquared = Math::max(_errorSquared, error);
+
+        /* Errors of all edges around the target vertex changed */
+        for(const UnsignedInt triangle: toTriangles)
+            for(std::size_t i = 0; i != 3; ++i) {
+                const UnsignedInt vertex = _indices[triangle*3 + i];
+                if(vertex == collapse.to) continue;
+                pushCollapse(vertex, collapse.to);
+                pushCollapse(collapse.to, vertex);
+            }
+    }
+}
+
+}
+
+std::pair<std::vector<UnsignedInt>, Float> simplify(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::simplify(): index count is not divisible by 3", {});
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(),
+            "MeshTools::simplify(): index" << index << "out of bounds for" << positions.size() << "vertices", {});
+    #endif
+
+    Simplifier simplifier{indices, positions};
+    simplifier.collapse(targetIndexCount/3, targetError);
+    return {simplifier.indices(), simplifier.error()};
+}
+
+std::vector<std::pair<std::vector<UnsignedInt>, Float>> generateLods(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt lodCount, const Float ratio, const Float targetError) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateLods(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(ratio > 0.0f && ratio < 1.0f,
+        "MeshTools::generateLods(): expected ratio to be in range (0, 1), got" << ratio, {});
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(),
+            "MeshTools::generateLods(): index" << index << "out of bounds for" << positions.size() << "vertices", {});
+    #endif
+
+    std::vector<std::pair<std::vector<UnsignedInt>, Float>> lods;
+    if(!lodCount) return lods;
+    lods.emplace_back(indices, 0.0f);
+
+    /* All levels are produced by a single pass, so the quadrics always
+       measure the error relative to the original mesh */
+    Simplifier simplifier{indices, positions};
+    while(lods.size() < lodCount) {
+        const std::size_t previousTriangleCount = simplifier.triangleCount();
+        const std::size_t targetTriangleCount = std::size_t(previousTriangleCount*ratio);
+        simplifier.collapse(targetTriangleCount, targetError);
+
+        /* No progress, further levels would be the same */
+        if(simplifier.triangleCount() == previousTriangleCount) break;
+
+        lods.emplace_back(simplifier.indices(), simplifier.error());
+
+        /* The target wasn't reached, next level won't be any better */
+        if(simplifier.triangleCount() > targetTriangleCount) break;
+    }
+
+    return lods;
+}
+
+}}
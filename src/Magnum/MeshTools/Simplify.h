@@ -0,0 +1,98 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::generateLods()
+ */
+
+#include <utility>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Simplify a mesh
+@param indices          Array of triangle face indices
+@param positions        Array of vertex positions
+@param targetIndexCount Target index count
+@param targetError      Max allowed error
+@return Simplified indices and the error they have relative to the original
+    mesh
+
+Iteratively collapses edges with the smallest quadric error metric until the
+index count is at most @p targetIndexCount or the next collapse would produce
+error larger than @p targetError. The error is expressed as a distance in the
+same units as @p positions. Each vertex is collapsed onto one of its
+neighbors, so the returned indices reference the original vertex array and it
+can be shared between simplified versions of the mesh. Use
+@ref optimizeVertexFetch() afterwards if you need a compact vertex array.
+
+Vertices on open mesh boundaries are collapsed only along the boundary. Vertices
+that share a position with other vertices (for example on texture or normal
+seams) are never collapsed in order to prevent cracks, which may limit how far
+can be the mesh simplified. Collapses that would flip triangle orientation are
+rejected as well.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+
+@see @ref generateLods()
+*/
+std::pair<std::vector<UnsignedInt>, Float> MAGNUM_MESHTOOLS_EXPORT simplify(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t targetIndexCount, Float targetError = Constants::inf());
+
+/**
+@brief Generate a chain of mesh LODs
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param lodCount     Max count of produced levels, including the original
+@param ratio        Index count ratio between two consecutive levels
+@param targetError  Max allowed error
+@return Index arrays of all levels together with their error relative to the
+    original mesh
+
+The first level is the original @p indices with zero error, each following
+level has at most @p ratio times the index count of the previous level. The
+levels are produced by a single continuous @ref simplify() pass, so the
+errors are monotonically increasing and all levels share the original vertex
+array. The chain can be shorter than @p lodCount if the mesh can't be
+simplified further or @p targetError would be exceeded. The errors can be then
+used for selecting the level to draw, for example using
+@ref SceneGraph::Camera::lodFor().
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. The @p ratio is expected to be in range
+    @f$ (0, 1) @f$.
+*/
+std::vector<std::pair<std::vector<UnsignedInt>, Float>> MAGNUM_MESHTOOLS_EXPORT generateLods(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt lodCount, Float ratio = 0.5f, Float targetError = Constants::inf());
+
+}}
+
+#endif
@@ -0,0 +1,143 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Subdivide.h"
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace MeshTools { namespace Implementation {
+
+namespace {
+
+/* Faces or vertices processed by a single task if multithreading is
+   enabled */
+constexpr std::size_t ChunkSize = 16384;
+
+}
+
+void subdivideParallelFor(const UnsignedInt threadCount, const std::size_t count, void(*const function)(void*, std::size_t, std::size_t), void* const state) {
+    Magnum::Implementation::parallelFor(threadCount, (count + ChunkSize - 1)/ChunkSize, [&](const std::size_t chunk) {
+        function(state, chunk*ChunkSize, Math::min((chunk + 1)*ChunkSize, count));
+    });
+}
+
+std::size_t subdivideSharedIndices(std::vector<UnsignedInt>& indices, const std::size_t vertexCount, std::vector<UnsignedInt>& edgeVertices, const UnsignedInt threadCount) {
+    const std::size_t indexCount = indices.size();
+    const std::size_t faceCount = indexCount/3;
+
+    /* Edge starting at given corner, in the same direction as the face */
+    const auto edge = [&indices](const std::size_t corner) {
+        const std::size_t face = corner - corner%3;
+        return std::make_pair(indices[corner], indices[face + (corner + 1)%3]);
+    };
+
+    /* Group corners by the lower vertex of their edge using a counting sort.
+       The corners stay in increasing order inside each group. */
+    std::vector<UnsignedInt> offsets(vertexCount + 1, 0);
+    for(std::size_t i = 0; i != indexCount; ++i) {
+        const std::pair<UnsignedInt, UnsignedInt> e = edge(i);
+        ++offsets[Math::min(e.first, e.second) + 1];
+    }
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        offsets[i + 1] += offsets[i];
+    std::vector<UnsignedInt> corners(indexCount);
+    {
+        std::vector<UnsignedInt> next{offsets.begin(), offsets.end() - 1};
+        for(std::size_t i = 0; i != indexCount; ++i) {
+            const std::pair<UnsignedInt, UnsignedInt> e = edge(i);
+            corners[next[Math::min(e.first, e.second)]++] = i;
+        }
+    }
+
+    /* For each corner find the first corner sharing the same edge, which
+       "owns" the edge. The groups are small, so a linear search is faster
+       than anything else. Groups are independent, so this is done in
+       parallel. */
+    std::vector<UnsignedInt> owners(indexCount);
+    Magnum::Implementation::parallelFor(threadCount, (vertexCount + ChunkSize - 1)/ChunkSize, [&](const std::size_t chunk) {
+        const std::size_t end = Math::min((chunk + 1)*ChunkSize, vertexCount);
+        for(std::size_t vertex = chunk*ChunkSize; vertex != end; ++vertex) {
+            for(UnsignedInt i = offsets[vertex]; i != offsets[vertex + 1]; ++i) {
+                const std::pair<UnsignedInt, UnsignedInt> e = edge(corners[i]);
+                const UnsignedInt other = Math::max(e.first, e.second);
+                UnsignedInt owner = corners[i];
+                for(UnsignedInt j = offsets[vertex]; j != i; ++j) {
+                    const std::pair<UnsignedInt, UnsignedInt> f = edge(corners[j]);
+                    if(Math::max(f.first, f.second) == other) {
+                        owner = owners[corners[j]];
+                        break;
+                    }
+                }
+                owners[corners[i]] = owner;
+            }
+        }
+    });
+
+    /* Number the edges in order of their first occurrence, which is the same
+       order in which subdivide() would add the new vertices if it didn't
+       duplicate them. That's a cheap serial pass. */
+    std::vector<UnsignedInt> midpoints(indexCount);
+    edgeVertices.clear();
+    for(std::size_t i = 0; i != indexCount; ++i) {
+        if(owners[i] != i) continue;
+        const std::pair<UnsignedInt, UnsignedInt> e = edge(i);
+        midpoints[i] = vertexCount + edgeVertices.size()/2;
+        edgeVertices.push_back(e.first);
+        edgeVertices.push_back(e.second);
+    }
+
+    /* Write the new faces, in the same layout as subdivide(). The output
+       size is known upfront so each face can be processed independently. */
+    indices.resize(indexCount*4);
+    Magnum::Implementation::parallelFor(threadCount, (faceCount + ChunkSize - 1)/ChunkSize, [&](const std::size_t chunk) {
+        const std::size_t end = Math::min((chunk + 1)*ChunkSize, faceCount);
+        for(std::size_t face = chunk*ChunkSize; face != end; ++face) {
+            const std::size_t i = face*3;
+            const UnsignedInt newVertices[]{
+                midpoints[owners[i + 0]],
+                midpoints[owners[i + 1]],
+                midpoints[owners[i + 2]]
+            };
+
+            const std::size_t out = indexCount + i*3;
+            indices[out + 0] = indices[i];
+            indices[out + 1] = newVertices[0];
+            indices[out + 2] = newVertices[2];
+            indices[out + 3] = newVertices[0];
+            indices[out + 4] = indices[i + 1];
+            indices[out + 5] = newVertices[1];
+            indices[out + 6] = newVertices[2];
+            indices[out + 7] = newVertices[1];
+            indices[out + 8] = indices[i + 2];
+            for(std::size_t j = 0; j != 3; ++j)
+                indices[i + j] = newVertices[j];
+        }
+    });
+
+    return edgeVertices.size()/2;
+}
+
+}}}
@@ -26,16 +26,31 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::subdivide()
+ * @brief Function @ref Magnum::MeshTools::subdivide(), @ref Magnum::MeshTools::subdivideInPlace(), @ref Magnum::MeshTools::subdivideShared()
  */
 
 #include <vector>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
 
+/* Calls the function on consecutive ranges of [0, count), distributed
+   among given count of threads. Type-erased so the threading machinery
+   doesn't need to be in a header. */
+MAGNUM_MESHTOOLS_EXPORT void subdivideParallelFor(UnsignedInt threadCount, std::size_t count, void(*function)(void*, std::size_t, std::size_t), void* state);
+
+/* Replaces indices with subdivided ones, with midpoint of each unique edge
+   referenced as vertexCount + edge ID. Fills two vertex indices per edge
+   into edgeVertices and returns edge count. */
+MAGNUM_MESHTOOLS_EXPORT std::size_t subdivideSharedIndices(std::vector<UnsignedInt>& indices, std::size_t vertexCount, std::vector<UnsignedInt>& edgeVertices, UnsignedInt threadCount);
+
 template<class Vertex, class Interpolator> class Subdivide {
     public:
         Subdivide(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices): indices(indices), vertices(vertices) {}
@@ -71,11 +86,132 @@ template<class Vertex, class Interpolator> class Subdivide {
 
 Goes through all triangle faces and subdivides them into four new. Removing
 duplicate vertices in the mesh is up to user.
+@see @ref subdivideInPlace(), @ref subdivideShared()
 */
 template<class Vertex, class Interpolator> inline void subdivide(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, Interpolator interpolator) {
     Implementation::Subdivide<Vertex, Interpolator>(indices, vertices)(interpolator);
 }
 
+/**
+@brief Subdivide the mesh in-place
+@tparam Vertex          Vertex data type
+@tparam Interpolator    See `interpolator` function parameter
+@param[in,out] indices  Index array to operate on
+@param[in,out] vertices Vertex array to operate on
+@param interpolator     Functor or function pointer which interpolates
+    two adjacent vertices: `Vertex interpolator(Vertex a, Vertex b)`
+
+Same as @ref subdivide(), but operates on caller-provided memory, so no
+allocation is done. The first quarter of @p indices is expected to contain the
+original indices, the rest is filled with the new ones. The last
+@cpp indices.size()/4 @ce items of @p vertices are filled with the new
+vertices, the items before are the original vertices. The output is the same
+as with @ref subdivide(). Expects that index count is divisible by 12 and
+@p vertices has enough space for the new vertices.
+*/
+template<class Vertex, class Interpolator> void subdivideInPlace(const Containers::StridedArrayView<UnsignedInt>& indices, const Containers::StridedArrayView<Vertex>& vertices, Interpolator interpolator) {
+    CORRADE_ASSERT(!(indices.size()%12), "MeshTools::subdivideInPlace(): index count is not divisible by 12!", );
+
+    const std::size_t indexCount = indices.size()/4;
+    CORRADE_ASSERT(vertices.size() >= indexCount, "MeshTools::subdivideInPlace(): can't fit" << indexCount << "new vertices into" << vertices.size() << "vertices", );
+    const std::size_t vertexOffset = vertices.size() - indexCount;
+
+    /* Subdivide each face to four new, in the same order as subdivide() */
+    for(std::size_t i = 0; i != indexCount; i += 3) {
+        /* Interpolate each side */
+        UnsignedInt newVertices[3];
+        for(int j = 0; j != 3; ++j) {
+            newVertices[j] = vertexOffset + i + j;
+            vertices[newVertices[j]] = interpolator(vertices[indices[i+j]], vertices[indices[i+(j+1)%3]]);
+        }
+
+        /* Add three new faces and update the original, see subdivide() for
+           a visualization */
+        const std::size_t face = indexCount + i*3;
+        indices[face + 0] = indices[i];
+        indices[face + 1] = newVertices[0];
+        indices[face + 2] = newVertices[2];
+        indices[face + 3] = newVertices[0];
+        indices[face + 4] = indices[i+1];
+        indices[face + 5] = newVertices[1];
+        indices[face + 6] = newVertices[2];
+        indices[face + 7] = newVertices[1];
+        indices[face + 8] = indices[i+2];
+        for(std::size_t j = 0; j != 3; ++j)
+            indices[i+j] = newVertices[j];
+    }
+}
+
+/**
+@brief Subdivide the mesh, sharing the new vertices
+@tparam Vertex          Vertex data type
+@tparam Interpolator    See `interpolator` function parameter
+@param[in,out] indices  Index array to operate on
+@param[in,out] vertices Vertex array to operate on
+@param interpolator     Functor or function pointer which interpolates
+    two adjacent vertices: `Vertex interpolator(Vertex a, Vertex b)`
+@param iterations       Count of subdivision iterations
+@param threadCount      Thread count used for the operation, including the
+    calling thread
+
+Same as calling @ref subdivide() @p iterations times and removing duplicate
+vertices after each step, but the duplicates are never created --- faces
+sharing an edge share also its midpoint. The output is the same as with
+@ref removeDuplicates() applied after each @ref subdivide() step on a mesh
+without duplicate vertices, including the vertex order, but without any
+allocation beyond the final size and without the hashing and comparison
+of the vertex data.
+
+For huge meshes the operation can be distributed over multiple threads by
+setting @p threadCount to a value larger than @cpp 1 @ce. The faces are then
+processed in independent chunks and the @p interpolator gets called from
+multiple threads at once, so it has to be thread-safe. The output is the
+same as with the single-threaded operation. Multithreaded operation is not
+available on @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where
+@p threadCount is ignored.
+
+Expects that the index count is divisible by 3 and all indices are in range
+for @p vertices. The `Vertex` type is expected to be default-constructible.
+*/
+template<class Vertex, class Interpolator> void subdivideShared(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, Interpolator interpolator, UnsignedInt iterations = 1, UnsignedInt threadCount = 1) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::subdivideShared(): index count is not divisible by 3", );
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < vertices.size(),
+            "MeshTools::subdivideShared(): index" << indices[i] << "out of bounds for" << vertices.size() << "vertices", );
+    #endif
+
+    /* Each iteration quadruples the index count, reserve the final size.
+       The vertex count isn't known upfront for meshes with boundaries, so
+       only the approximate size for a closed mesh is reserved. */
+    indices.reserve(indices.size() << 2*iterations);
+    vertices.reserve(vertices.size() + ((indices.size() << 2*iterations) - indices.size())/6);
+
+    struct State {
+        std::vector<Vertex>& vertices;
+        const std::vector<UnsignedInt>& edgeVertices;
+        Interpolator& interpolator;
+        std::size_t offset;
+    };
+
+    std::vector<UnsignedInt> edgeVertices;
+    for(UnsignedInt i = 0; i != iterations; ++i) {
+        const std::size_t vertexCount = vertices.size();
+        const std::size_t edgeCount = Implementation::subdivideSharedIndices(indices, vertexCount, edgeVertices, threadCount);
+
+        /* Interpolate the midpoint of each unique edge */
+        vertices.resize(vertexCount + edgeCount);
+        State state{vertices, edgeVertices, interpolator, vertexCount};
+        Implementation::subdivideParallelFor(threadCount, edgeCount, [](void* data, std::size_t begin, std::size_t end) {
+            State& state = *static_cast<State*>(data);
+            for(std::size_t edge = begin; edge != end; ++edge)
+                state.vertices[state.offset + edge] = state.interpolator(
+                    state.vertices[state.edgeVertices[edge*2 + 0]],
+                    state.vertices[state.edgeVertices[edge*2 + 1]]);
+        }, &state);
+    }
+}
+
 namespace Implementation {
 
 template<class Vertex, class Interpolator> void Subdivide<Vertex, Interpolator>::operator()(Interpolator interpolator) {
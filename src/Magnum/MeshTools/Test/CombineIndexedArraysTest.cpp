@@ -38,12 +38,14 @@ struct CombineIndexedArraysTest: TestSuite::Tester {
     void wrongIndexCount();
     void indexArrays();
     void indexedArrays();
+    void interleavedArraysMultithreaded();
 };
 
 CombineIndexedArraysTest::CombineIndexedArraysTest() {
     addTests({&CombineIndexedArraysTest::wrongIndexCount,
               &CombineIndexedArraysTest::indexArrays,
-              &CombineIndexedArraysTest::indexedArrays});
+              &CombineIndexedArraysTest::indexedArrays,
+              &CombineIndexedArraysTest::interleavedArraysMultithreaded});
 }
 
 void CombineIndexedArraysTest::wrongIndexCount() {
@@ -87,6 +89,28 @@ void CombineIndexedArraysTest::indexedArrays() {
     CORRADE_COMPARE(array3, (std::vector<UnsignedInt>{6, 7}));
 }
 
+void CombineIndexedArraysTest::interleavedArraysMultithreaded() {
+    /* Enough combinations to go over the multithreading threshold, with many
+       duplicates */
+    std::vector<UnsignedInt> interleavedArrays;
+    for(UnsignedInt i = 0; i != 100000; ++i) {
+        interleavedArrays.push_back(i % 1000);
+        interleavedArrays.push_back((i*7) % 300);
+    }
+
+    std::vector<UnsignedInt> expectedIndices, expectedArrays;
+    std::tie(expectedIndices, expectedArrays) = MeshTools::combineIndexArrays(interleavedArrays, 2);
+
+    std::vector<UnsignedInt> indices, arrays;
+    std::tie(indices, arrays) = MeshTools::combineIndexArrays(interleavedArrays, 2, 4);
+
+    /* The output is the same as in the serial case */
+    CORRADE_COMPARE(indices.size(), 100000);
+    CORRADE_COMPARE(arrays.size(), 3000*2);
+    CORRADE_VERIFY(indices == expectedIndices);
+    CORRADE_VERIFY(arrays == expectedArrays);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CombineIndexedArraysTest)
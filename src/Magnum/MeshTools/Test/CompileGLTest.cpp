@@ -0,0 +1,228 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <cstring>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/MeshTools/Compile.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct CompileGLTest: GL::OpenGLTester {
+    explicit CompileGLTest();
+
+    void quantized();
+    void quantizedNoFlags();
+};
+
+CompileGLTest::CompileGLTest() {
+    addTests({&CompileGLTest::quantized,
+              &CompileGLTest::quantizedNoFlags});
+}
+
+namespace {
+
+/* Vertex attribute state of given mesh, queried from its VAO */
+struct AttributeLayout {
+    GLint buffer, size, type, normalized, stride;
+    std::size_t offset;
+};
+
+AttributeLayout attributeLayout(GL::Mesh& mesh, const UnsignedInt location) {
+    GL::Context::current().resetState(GL::Context::State::EnterExternal);
+    glBindVertexArray(mesh.id());
+
+    AttributeLayout out;
+    glGetVertexAttribiv(location, GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING, &out.buffer);
+    glGetVertexAttribiv(location, GL_VERTEX_ATTRIB_ARRAY_SIZE, &out.size);
+    glGetVertexAttribiv(location, GL_VERTEX_ATTRIB_ARRAY_TYPE, &out.type);
+    glGetVertexAttribiv(location, GL_VERTEX_ATTRIB_ARRAY_NORMALIZED, &out.normalized);
+    glGetVertexAttribiv(location, GL_VERTEX_ATTRIB_ARRAY_STRIDE, &out.stride);
+    GLvoid* pointer;
+    glGetVertexAttribPointerv(location, GL_VERTEX_ATTRIB_ARRAY_POINTER, &pointer);
+    out.offset = reinterpret_cast<std::size_t>(pointer);
+
+    glBindVertexArray(0);
+    GL::Context::current().resetState(GL::Context::State::ExitExternal);
+    return out;
+}
+
+/* Signed normalized 2.10.10.10, sign-extending each ten-bit component */
+Vector4 unpackNormal2101010(const UnsignedInt packed) {
+    Vector4 out;
+    for(std::size_t i = 0; i != 3; ++i)
+        out[i] = Float(Int(packed << (22 - i*10)) >> 22)/511.0f;
+    out[3] = Float(Int(packed) >> 30);
+    return out;
+}
+
+}
+
+void CompileGLTest::quantized() {
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::vertex_array_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::vertex_array_object::string() + std::string(" is not supported."));
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::half_float_vertex>())
+        CORRADE_SKIP(GL::Extensions::ARB::half_float_vertex::string() + std::string(" is not supported."));
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::vertex_type_2_10_10_10_rev>())
+        CORRADE_SKIP(GL::Extensions::ARB::vertex_type_2_10_10_10_rev::string() + std::string(" is not supported."));
+
+    /* The Y coordinate is flat, so it's not scaled */
+    const Trade::MeshData3D data{MeshPrimitive::Triangles, {},
+        {{{-1.0f, 2.0f, 0.5f}, {3.0f, 2.0f, -1.5f}, {1.0f, 2.0f, -0.5f}}},
+        {{{0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}}},
+        {{{0.5f, 0.25f}, {1.0f, 0.0f}, {0.0f, 1.0f}}},
+        {}};
+
+    GL::Mesh mesh{NoCreate};
+    Matrix4 transformation;
+    std::tie(mesh, transformation) = compile(data, CompileFlag::QuantizePositions|CompileFlag::QuantizeNormals|CompileFlag::QuantizeTextureCoordinates);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(mesh.count(), 3);
+    CORRADE_COMPARE(transformation,
+        Matrix4::translation({-1.0f, 2.0f, -1.5f})*
+        Matrix4::scaling({4.0f, 1.0f, 2.0f}));
+
+    /* Four-byte-aligned 16-bit positions, packed normals and half-float
+       texture coordinates, all in a single buffer */
+    const AttributeLayout positions = attributeLayout(mesh, Shaders::Generic3D::Position::Location);
+    const AttributeLayout normals = attributeLayout(mesh, Shaders::Generic3D::Normal::Location);
+    const AttributeLayout textureCoords = attributeLayout(mesh, Shaders::Generic3D::TextureCoordinates::Location);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_VERIFY(positions.buffer);
+    CORRADE_COMPARE(positions.size, 3);
+    CORRADE_COMPARE(positions.type, GL_UNSIGNED_SHORT);
+    CORRADE_VERIFY(positions.normalized);
+    CORRADE_COMPARE(positions.stride, 16);
+    CORRADE_COMPARE(positions.offset, 0);
+
+    /* The packed format can't have just three components */
+    CORRADE_COMPARE(normals.buffer, positions.buffer);
+    CORRADE_COMPARE(normals.size, 4);
+    CORRADE_COMPARE(normals.type, GL_INT_2_10_10_10_REV);
+    CORRADE_VERIFY(normals.normalized);
+    CORRADE_COMPARE(normals.stride, 16);
+    CORRADE_COMPARE(normals.offset, 8);
+
+    CORRADE_COMPARE(textureCoords.buffer, positions.buffer);
+    CORRADE_COMPARE(textureCoords.size, 2);
+    CORRADE_COMPARE(textureCoords.type, GL_HALF_FLOAT);
+    CORRADE_VERIFY(!textureCoords.normalized);
+    CORRADE_COMPARE(textureCoords.stride, 16);
+    CORRADE_COMPARE(textureCoords.offset, 12);
+
+    /* Decode the uploaded data */
+    GL::Buffer buffer = GL::Buffer::wrap(positions.buffer);
+    const Containers::Array<char> vertices = buffer.data();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(vertices.size(), 3*16);
+
+    const Math::Vector3<UnsignedShort> expectedPositions[]{
+        {0, 0, 65535},
+        {65535, 0, 0},
+        {32768, 0, 32768}
+    };
+    for(std::size_t i = 0; i != 3; ++i) {
+        Math::Vector3<UnsignedShort> position;
+        std::memcpy(position.data(), vertices + i*16, sizeof(position));
+        CORRADE_COMPARE(position, expectedPositions[i]);
+
+        /* Dequantizing gives back the original position, within the
+           precision of the format */
+        const Vector3 dequantized = transformation.transformPoint(Math::unpack<Vector3>(position));
+        CORRADE_VERIFY((Math::abs(dequantized - data.positions(0)[i]) < Vector3{1.0e-4f}).all());
+
+        UnsignedInt normal;
+        std::memcpy(&normal, vertices + i*16 + 8, sizeof(normal));
+        CORRADE_COMPARE(unpackNormal2101010(normal), Vector4{data.normals(0)[i], 0.0f});
+
+        Math::Vector2<UnsignedShort> textureCoordinates;
+        std::memcpy(textureCoordinates.data(), vertices + i*16 + 12, sizeof(textureCoordinates));
+        CORRADE_COMPARE(Vector2{Math::unpackHalf(textureCoordinates)}, data.textureCoords2D(0)[i]);
+    }
+}
+
+void CompileGLTest::quantizedNoFlags() {
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::vertex_array_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::vertex_array_object::string() + std::string(" is not supported."));
+
+    const Trade::MeshData3D data{MeshPrimitive::Triangles, {},
+        {{{-1.0f, 2.0f, 0.5f}, {3.0f, 2.0f, -1.5f}}},
+        {{{0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}}},
+        {{{0.5f, 0.25f}, {1.0f, 0.0f}}},
+        {}};
+
+    GL::Mesh mesh{NoCreate};
+    Matrix4 transformation;
+    std::tie(mesh, transformation) = compile(data, {});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(transformation, Matrix4{});
+
+    const AttributeLayout positions = attributeLayout(mesh, Shaders::Generic3D::Position::Location);
+    const AttributeLayout normals = attributeLayout(mesh, Shaders::Generic3D::Normal::Location);
+    const AttributeLayout textureCoords = attributeLayout(mesh, Shaders::Generic3D::TextureCoordinates::Location);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(positions.size, 3);
+    CORRADE_COMPARE(positions.type, GL_FLOAT);
+    CORRADE_COMPARE(positions.stride, 32);
+    CORRADE_COMPARE(positions.offset, 0);
+    CORRADE_COMPARE(normals.size, 3);
+    CORRADE_COMPARE(normals.type, GL_FLOAT);
+    CORRADE_COMPARE(normals.offset, 12);
+    CORRADE_COMPARE(textureCoords.size, 2);
+    CORRADE_COMPARE(textureCoords.type, GL_FLOAT);
+    CORRADE_COMPARE(textureCoords.offset, 24);
+
+    GL::Buffer buffer = GL::Buffer::wrap(positions.buffer);
+    const Containers::Array<char> vertices = buffer.data();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(vertices.size(), 2*32);
+
+    for(std::size_t i = 0; i != 2; ++i) {
+        Vector3 position, normal;
+        Vector2 textureCoordinates;
+        std::memcpy(position.data(), vertices + i*32, sizeof(position));
+        std::memcpy(normal.data(), vertices + i*32 + 12, sizeof(normal));
+        std::memcpy(textureCoordinates.data(), vertices + i*32 + 24, sizeof(textureCoordinates));
+        CORRADE_COMPARE(position, data.positions(0)[i]);
+        CORRADE_COMPARE(normal, data.normals(0)[i]);
+        CORRADE_COMPARE(textureCoordinates, data.textureCoords2D(0)[i]);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompileGLTest)
@@ -41,6 +41,11 @@ struct CompressIndicesTest: TestSuite::Tester {
     void compressInt();
 
     void compressAsShort();
+    void compressIntoShort();
+
+    void compressWithBaseVertex();
+    void compressWithBaseVertexSingleRange();
+    void compressWithBaseVertexInvalid();
 };
 
 CompressIndicesTest::CompressIndicesTest() {
@@ -48,7 +53,12 @@ CompressIndicesTest::CompressIndicesTest() {
               &CompressIndicesTest::compressShort,
               &CompressIndicesTest::compressInt,
 
-              &CompressIndicesTest::compressAsShort});
+              &CompressIndicesTest::compressAsShort,
+              &CompressIndicesTest::compressIntoShort,
+
+              &CompressIndicesTest::compressWithBaseVertex,
+              &CompressIndicesTest::compressWithBaseVertexSingleRange,
+              &CompressIndicesTest::compressWithBaseVertexInvalid});
 }
 
 void CompressIndicesTest::compressChar() {
@@ -125,6 +135,85 @@ void CompressIndicesTest::compressAsShort() {
     CORRADE_COMPARE(out.str(), "MeshTools::compressIndicesAs(): type too small to represent value 65536\n");
 }
 
+void CompressIndicesTest::compressIntoShort() {
+    const UnsignedInt indices[]{123, 456, 65536};
+    UnsignedShort out[2];
+    MeshTools::compressIndicesInto(
+        Containers::StridedArrayView<const UnsignedInt>{indices, 2, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<UnsignedShort>{out, 2, sizeof(UnsignedShort)});
+    CORRADE_COMPARE(out[0], 123);
+    CORRADE_COMPARE(out[1], 456);
+
+    std::ostringstream o;
+    Error redirectError{&o};
+    MeshTools::compressIndicesInto(
+        Containers::StridedArrayView<const UnsignedInt>{indices, 3, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<UnsignedShort>{out, 2, sizeof(UnsignedShort)});
+    MeshTools::compressIndicesInto(
+        Containers::StridedArrayView<const UnsignedInt>{indices + 1, 2, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<UnsignedShort>{out, 2, sizeof(UnsignedShort)});
+    CORRADE_COMPARE(o.str(),
+        "MeshTools::compressIndicesInto(): bad output size, expected 3 but got 2\n"
+        "MeshTools::compressIndicesInto(): type too small to represent value 65536\n");
+}
+
+void CompressIndicesTest::compressWithBaseVertex() {
+    Containers::Array<UnsignedShort> data;
+    std::vector<CompressedIndexRange> ranges;
+    std::tie(data, ranges) = MeshTools::compressIndicesWithBaseVertex({
+        0, 2, 1,
+        70002, 70000, 70001,
+        3, 5, 4
+    });
+
+    /* The last triangle doesn't fit to the second range anymore */
+    CORRADE_COMPARE(ranges.size(), 3);
+    CORRADE_COMPARE(ranges[0].indexOffset, 0);
+    CORRADE_COMPARE(ranges[0].indexCount, 3);
+    CORRADE_COMPARE(ranges[0].baseVertex, 0);
+    CORRADE_COMPARE(ranges[0].indexEnd, 2);
+    CORRADE_COMPARE(ranges[1].indexOffset, 3);
+    CORRADE_COMPARE(ranges[1].indexCount, 3);
+    CORRADE_COMPARE(ranges[1].baseVertex, 70000);
+    CORRADE_COMPARE(ranges[1].indexEnd, 2);
+    CORRADE_COMPARE(ranges[2].indexOffset, 6);
+    CORRADE_COMPARE(ranges[2].indexCount, 3);
+    CORRADE_COMPARE(ranges[2].baseVertex, 3);
+    CORRADE_COMPARE(ranges[2].indexEnd, 2);
+
+    CORRADE_COMPARE(std::vector<UnsignedShort>(data.begin(), data.end()),
+        (std::vector<UnsignedShort>{0, 2, 1, 2, 0, 1, 0, 2, 1}));
+}
+
+void CompressIndicesTest::compressWithBaseVertexSingleRange() {
+    /* All indices fit into 16 bits relative to the minimum */
+    Containers::Array<UnsignedShort> data;
+    std::vector<CompressedIndexRange> ranges;
+    std::tie(data, ranges) = MeshTools::compressIndicesWithBaseVertex({
+        100000, 165535, 100001, 100002
+    }, 2);
+
+    CORRADE_COMPARE(ranges.size(), 1);
+    CORRADE_COMPARE(ranges[0].indexOffset, 0);
+    CORRADE_COMPARE(ranges[0].indexCount, 4);
+    CORRADE_COMPARE(ranges[0].baseVertex, 100000);
+    CORRADE_COMPARE(ranges[0].indexEnd, 65535);
+    CORRADE_COMPARE(std::vector<UnsignedShort>(data.begin(), data.end()),
+        (std::vector<UnsignedShort>{0, 65535, 1, 2}));
+}
+
+void CompressIndicesTest::compressWithBaseVertexInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::compressIndicesWithBaseVertex({0, 1, 2, 3}, 4);
+    MeshTools::compressIndicesWithBaseVertex({0, 1, 2, 3});
+    MeshTools::compressIndicesWithBaseVertex({0, 1, 2, 0, 65536, 1});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::compressIndicesWithBaseVertex(): expected primitive size to be 1, 2 or 3, got 4\n"
+        "MeshTools::compressIndicesWithBaseVertex(): index count 4 is not divisible by 3\n"
+        "MeshTools::compressIndicesWithBaseVertex(): primitive 1 spans more than 65536 vertices\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompressIndicesTest)
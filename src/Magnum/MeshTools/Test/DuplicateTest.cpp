@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Magnum.h"
@@ -34,10 +35,14 @@ struct DuplicateTest: TestSuite::Tester {
     explicit DuplicateTest();
 
     void duplicate();
+    void duplicateInto();
+    void duplicateIntoInvalid();
 };
 
 DuplicateTest::DuplicateTest() {
-    addTests({&DuplicateTest::duplicate});
+    addTests({&DuplicateTest::duplicate,
+              &DuplicateTest::duplicateInto,
+              &DuplicateTest::duplicateIntoInvalid});
 }
 
 void DuplicateTest::duplicate() {
@@ -45,6 +50,41 @@ void DuplicateTest::duplicate() {
                     (std::vector<Int>{35, 35, -7, -18, 12, 12}));
 }
 
+void DuplicateTest::duplicateInto() {
+    const UnsignedInt indices[]{1, 1, 0, 3, 2, 2};
+    const Int data[]{-7, 35, 12, -18};
+
+    /* Output interleaved with some other data, which should stay untouched */
+    Int out[12]{};
+    MeshTools::duplicateInto(
+        Containers::StridedArrayView<const UnsignedInt>{indices, 6, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<const Int>{data, 4, sizeof(Int)},
+        Containers::StridedArrayView<Int>{out + 1, 6, 2*sizeof(Int)});
+
+    CORRADE_COMPARE(std::vector<Int>(out, out + 12),
+        (std::vector<Int>{0, 35, 0, 35, 0, -7, 0, -18, 0, 12, 0, 12}));
+}
+
+void DuplicateTest::duplicateIntoInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const UnsignedInt indices[]{1, 4};
+    const Int data[]{-7, 35, 12, -18};
+    Int output[3];
+    MeshTools::duplicateInto(
+        Containers::StridedArrayView<const UnsignedInt>{indices, 2, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<const Int>{data, 4, sizeof(Int)},
+        Containers::StridedArrayView<Int>{output, 3, sizeof(Int)});
+    MeshTools::duplicateInto(
+        Containers::StridedArrayView<const UnsignedInt>{indices, 2, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<const Int>{data, 4, sizeof(Int)},
+        Containers::StridedArrayView<Int>{output, 2, sizeof(Int)});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::duplicateInto(): bad output size, expected 2 but got 3\n"
+        "MeshTools::duplicateInto(): index 4 out of bounds for 4 elements\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::DuplicateTest)
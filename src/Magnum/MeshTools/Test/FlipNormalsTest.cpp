@@ -37,12 +37,16 @@ struct FlipNormalsTest: TestSuite::Tester {
     void wrongIndexCount();
     void flipFaceWinding();
     void flipNormals();
+    void flipFaceWindingInPlace();
+    void flipNormalsInPlace();
 };
 
 FlipNormalsTest::FlipNormalsTest() {
     addTests({&FlipNormalsTest::wrongIndexCount,
               &FlipNormalsTest::flipFaceWinding,
-              &FlipNormalsTest::flipNormals});
+              &FlipNormalsTest::flipNormals,
+              &FlipNormalsTest::flipFaceWindingInPlace,
+              &FlipNormalsTest::flipNormalsInPlace});
 }
 
 void FlipNormalsTest::wrongIndexCount() {
@@ -75,6 +79,41 @@ void FlipNormalsTest::flipNormals() {
                                                    -Vector3::zAxis()}));
 }
 
+void FlipNormalsTest::flipFaceWindingInPlace() {
+    UnsignedInt indices[]{0, 1, 2,
+                          3, 4, 5};
+    MeshTools::flipFaceWindingInPlace(Containers::StridedArrayView<UnsignedInt>{indices, 6, sizeof(UnsignedInt)});
+
+    CORRADE_COMPARE(indices[0], 0);
+    CORRADE_COMPARE(indices[1], 2);
+    CORRADE_COMPARE(indices[2], 1);
+    CORRADE_COMPARE(indices[3], 3);
+    CORRADE_COMPARE(indices[4], 5);
+    CORRADE_COMPARE(indices[5], 4);
+
+    std::stringstream ss;
+    Error redirectError{&ss};
+    MeshTools::flipFaceWindingInPlace(Containers::StridedArrayView<UnsignedInt>{indices, 2, sizeof(UnsignedInt)});
+    CORRADE_COMPARE(ss.str(), "MeshTools::flipFaceWindingInPlace(): index count is not divisible by 3!\n");
+}
+
+void FlipNormalsTest::flipNormalsInPlace() {
+    /* Normals interleaved with positions, which should stay untouched */
+    Vector3 data[]{
+        Vector3{1.0f}, Vector3::xAxis(),
+        Vector3{2.0f}, Vector3::yAxis(),
+        Vector3{3.0f}, Vector3::zAxis()
+    };
+    MeshTools::flipNormalsInPlace(Containers::StridedArrayView<Vector3>{data + 1, 3, 2*sizeof(Vector3)});
+
+    CORRADE_COMPARE(data[0], Vector3{1.0f});
+    CORRADE_COMPARE(data[1], -Vector3::xAxis());
+    CORRADE_COMPARE(data[2], Vector3{2.0f});
+    CORRADE_COMPARE(data[3], -Vector3::yAxis());
+    CORRADE_COMPARE(data[4], Vector3{3.0f});
+    CORRADE_COMPARE(data[5], -Vector3::zAxis());
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::FlipNormalsTest)
@@ -0,0 +1,156 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateBarycentrics.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateBarycentricsTest: TestSuite::Tester {
+    explicit GenerateBarycentricsTest();
+
+    void quad();
+    void conflict();
+    void unreferenced();
+    void empty();
+    void invalid();
+};
+
+typedef Math::Vector3<UnsignedByte> Vector3ub;
+
+GenerateBarycentricsTest::GenerateBarycentricsTest() {
+    addTests({&GenerateBarycentricsTest::quad,
+              &GenerateBarycentricsTest::conflict,
+              &GenerateBarycentricsTest::unreferenced,
+              &GenerateBarycentricsTest::empty,
+              &GenerateBarycentricsTest::invalid});
+}
+
+void GenerateBarycentricsTest::quad() {
+    /* Two triangles sharing an edge can be colored without duplicating
+       anything */
+    std::vector<UnsignedInt> indices;
+    std::vector<UnsignedInt> mapping;
+    std::vector<Vector3ub> barycentrics;
+    std::tie(indices, mapping, barycentrics) = MeshTools::generateBarycentrics({
+        0, 1, 2,
+        2, 1, 3}, 4);
+
+    CORRADE_COMPARE_AS(indices, (std::vector<UnsignedInt>{
+        0, 1, 2,
+        2, 1, 3}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mapping, (std::vector<UnsignedInt>{
+        0, 1, 2, 3}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(barycentrics, (std::vector<Vector3ub>{
+        {255, 0, 0},
+        {0, 255, 0},
+        {0, 0, 255},
+        {255, 0, 0}}), TestSuite::Compare::Container);
+}
+
+void GenerateBarycentricsTest::conflict() {
+    /* A fan of five triangles around vertex 0 has an odd-length outer
+       cycle, so it can't be colored with three colors and one vertex
+       needs to be duplicated */
+    std::vector<UnsignedInt> indices;
+    std::vector<UnsignedInt> mapping;
+    std::vector<Vector3ub> barycentrics;
+    std::tie(indices, mapping, barycentrics) = MeshTools::generateBarycentrics({
+        0, 1, 2,
+        0, 2, 3,
+        0, 3, 4,
+        0, 4, 5,
+        0, 5, 1}, 6);
+
+    CORRADE_COMPARE_AS(indices, (std::vector<UnsignedInt>{
+        0, 1, 2,
+        0, 2, 3,
+        0, 3, 4,
+        0, 4, 5,
+        0, 5, 6}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mapping, (std::vector<UnsignedInt>{
+        0, 1, 2, 3, 4, 5, 1}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(barycentrics, (std::vector<Vector3ub>{
+        {255, 0, 0},
+        {0, 255, 0},
+        {0, 0, 255},
+        {0, 255, 0},
+        {0, 0, 255},
+        {0, 255, 0},
+        {0, 0, 255}}), TestSuite::Compare::Container);
+
+    /* Every triangle has all three corners different */
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        CORRADE_COMPARE(barycentrics[indices[i]] + barycentrics[indices[i + 1]] + barycentrics[indices[i + 2]], Vector3ub{255});
+    }
+}
+
+void GenerateBarycentricsTest::unreferenced() {
+    std::vector<UnsignedInt> indices;
+    std::vector<UnsignedInt> mapping;
+    std::vector<Vector3ub> barycentrics;
+    std::tie(indices, mapping, barycentrics) = MeshTools::generateBarycentrics({
+        3, 2, 1}, 5);
+
+    CORRADE_COMPARE_AS(mapping, (std::vector<UnsignedInt>{
+        0, 1, 2, 3, 4}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(barycentrics, (std::vector<Vector3ub>{
+        {255, 0, 0},
+        {0, 0, 255},
+        {0, 255, 0},
+        {255, 0, 0},
+        {255, 0, 0}}), TestSuite::Compare::Container);
+}
+
+void GenerateBarycentricsTest::empty() {
+    std::vector<UnsignedInt> indices;
+    std::vector<UnsignedInt> mapping;
+    std::vector<Vector3ub> barycentrics;
+    std::tie(indices, mapping, barycentrics) = MeshTools::generateBarycentrics({}, 0);
+
+    CORRADE_VERIFY(indices.empty());
+    CORRADE_VERIFY(mapping.empty());
+    CORRADE_VERIFY(barycentrics.empty());
+}
+
+void GenerateBarycentricsTest::invalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshTools::generateBarycentrics({0, 1, 2, 2, 1}, 3);
+    MeshTools::generateBarycentrics({0, 1, 3}, 3);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::generateBarycentrics(): index count is not divisible by 3\n"
+        "MeshTools::generateBarycentrics(): index 3 out of bounds for 3 vertices\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateBarycentricsTest)
@@ -36,11 +36,17 @@ struct GenerateFlatNormalsTest: TestSuite::Tester {
 
     void wrongIndexCount();
     void generate();
+    void generateInto();
+    void generateIntoIndexed();
+    void generateIntoInvalid();
 };
 
 GenerateFlatNormalsTest::GenerateFlatNormalsTest() {
     addTests({&GenerateFlatNormalsTest::wrongIndexCount,
-              &GenerateFlatNormalsTest::generate});
+              &GenerateFlatNormalsTest::generate,
+              &GenerateFlatNormalsTest::generateInto,
+              &GenerateFlatNormalsTest::generateIntoIndexed,
+              &GenerateFlatNormalsTest::generateIntoInvalid});
 }
 
 void GenerateFlatNormalsTest::wrongIndexCount() {
@@ -81,6 +87,78 @@ void GenerateFlatNormalsTest::generate() {
     }));
 }
 
+void GenerateFlatNormalsTest::generateInto() {
+    /* Same as above, but non-indexed */
+    const Vector3 positions[]{
+        {-1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f}
+    };
+    Vector3 normals[6];
+    MeshTools::generateFlatNormalsInto(
+        Containers::StridedArrayView<const Vector3>{positions, 6, sizeof(Vector3)},
+        Containers::StridedArrayView<Vector3>{normals, 6, sizeof(Vector3)});
+
+    CORRADE_COMPARE(normals[0], Vector3::zAxis());
+    CORRADE_COMPARE(normals[1], Vector3::zAxis());
+    CORRADE_COMPARE(normals[2], Vector3::zAxis());
+    CORRADE_COMPARE(normals[3], -Vector3::zAxis());
+    CORRADE_COMPARE(normals[4], -Vector3::zAxis());
+    CORRADE_COMPARE(normals[5], -Vector3::zAxis());
+}
+
+void GenerateFlatNormalsTest::generateIntoIndexed() {
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        1, 2, 3
+    };
+    const Vector3 positions[]{
+        {-1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f}
+    };
+    Vector3 normals[6];
+    MeshTools::generateFlatNormalsInto(
+        Containers::StridedArrayView<const UnsignedInt>{indices, 6, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<const Vector3>{positions, 4, sizeof(Vector3)},
+        Containers::StridedArrayView<Vector3>{normals, 6, sizeof(Vector3)});
+
+    CORRADE_COMPARE(normals[0], Vector3::zAxis());
+    CORRADE_COMPARE(normals[1], Vector3::zAxis());
+    CORRADE_COMPARE(normals[2], Vector3::zAxis());
+    CORRADE_COMPARE(normals[3], -Vector3::zAxis());
+    CORRADE_COMPARE(normals[4], -Vector3::zAxis());
+    CORRADE_COMPARE(normals[5], -Vector3::zAxis());
+}
+
+void GenerateFlatNormalsTest::generateIntoInvalid() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+
+    const UnsignedInt indices[]{0, 1, 4};
+    const Vector3 positions[4];
+    Vector3 normals[4];
+    MeshTools::generateFlatNormalsInto(
+        Containers::StridedArrayView<const Vector3>{positions, 4, sizeof(Vector3)},
+        Containers::StridedArrayView<Vector3>{normals, 4, sizeof(Vector3)});
+    MeshTools::generateFlatNormalsInto(
+        Containers::StridedArrayView<const Vector3>{positions, 3, sizeof(Vector3)},
+        Containers::StridedArrayView<Vector3>{normals, 4, sizeof(Vector3)});
+    MeshTools::generateFlatNormalsInto(
+        Containers::StridedArrayView<const UnsignedInt>{indices, 3, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<const Vector3>{positions, 4, sizeof(Vector3)},
+        Containers::StridedArrayView<Vector3>{normals, 3, sizeof(Vector3)});
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::generateFlatNormalsInto(): position count is not divisible by 3\n"
+        "MeshTools::generateFlatNormalsInto(): bad output size, expected 3 but got 4\n"
+        "MeshTools::generateFlatNormalsInto(): index 4 out of bounds for 4 elements\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateFlatNormalsTest)
@@ -0,0 +1,221 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateMeshlets.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateMeshletsTest: TestSuite::Tester {
+    explicit GenerateMeshletsTest();
+
+    void quad();
+    void grid();
+    void empty();
+    void cone();
+    void coneOpposite();
+    void invalid();
+};
+
+namespace {
+    /* Triangles rotated to have the smallest index first (which preserves
+       winding) and sorted, for comparing that the triangle set is preserved */
+    std::vector<UnsignedInt> sortedTriangles(const std::vector<UnsignedInt>& indices) {
+        std::vector<std::vector<UnsignedInt>> triangles;
+        for(std::size_t i = 0; i != indices.size(); i += 3) {
+            std::vector<UnsignedInt> triangle{indices.begin() + i, indices.begin() + i + 3};
+            std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+            triangles.push_back(std::move(triangle));
+        }
+        std::sort(triangles.begin(), triangles.end());
+
+        std::vector<UnsignedInt> out;
+        for(const std::vector<UnsignedInt>& triangle: triangles)
+            out.insert(out.end(), triangle.begin(), triangle.end());
+        return out;
+    }
+}
+
+GenerateMeshletsTest::GenerateMeshletsTest() {
+    addTests({&GenerateMeshletsTest::quad,
+              &GenerateMeshletsTest::grid,
+              &GenerateMeshletsTest::empty,
+              &GenerateMeshletsTest::cone,
+              &GenerateMeshletsTest::coneOpposite,
+              &GenerateMeshletsTest::invalid});
+}
+
+void GenerateMeshletsTest::quad() {
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> triangles;
+    std::tie(meshlets, vertices, triangles) = MeshTools::generateMeshlets({
+        1, 2, 3,
+        3, 2, 4
+    }, {
+        {}, {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}
+    });
+
+    CORRADE_COMPARE(meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets[0].vertexOffset, 0);
+    CORRADE_COMPARE(meshlets[0].vertexCount, 4);
+    CORRADE_COMPARE(meshlets[0].triangleOffset, 0);
+    CORRADE_COMPARE(meshlets[0].triangleCount, 2);
+    CORRADE_COMPARE(meshlets[0].center, (Vector3{0.5f, 0.5f, 0.0f}));
+    CORRADE_COMPARE(meshlets[0].radius, 0.707107f);
+    CORRADE_COMPARE(meshlets[0].coneAxis, Vector3::zAxis());
+    CORRADE_COMPARE(meshlets[0].coneCutoff, 0.0f);
+
+    CORRADE_COMPARE(vertices, (std::vector<UnsignedInt>{1, 2, 3, 4}));
+    CORRADE_COMPARE(triangles, (std::vector<UnsignedByte>{
+        0, 1, 2,
+        2, 1, 3
+    }));
+}
+
+void GenerateMeshletsTest::grid() {
+    /* 10x10 quads */
+    std::vector<Vector3> positions;
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y <= 10; ++y)
+        for(UnsignedInt x = 0; x <= 10; ++x)
+            positions.emplace_back(Float(x), Float(y), 0.0f);
+    for(UnsignedInt y = 0; y != 10; ++y) for(UnsignedInt x = 0; x != 10; ++x) {
+        const UnsignedInt i = y*11 + x;
+        indices.insert(indices.end(), {i, i + 1, i + 12, i, i + 12, i + 11});
+    }
+
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> triangles;
+    std::tie(meshlets, vertices, triangles) = MeshTools::generateMeshlets(indices, positions, 16, 20);
+
+    /* At least 200 triangles / 20 */
+    CORRADE_VERIFY(meshlets.size() >= 10);
+
+    std::vector<UnsignedInt> reconstructed;
+    UnsignedInt vertexOffset = 0, triangleOffset = 0;
+    for(const Meshlet& meshlet: meshlets) {
+
+        /* Meshlets are tightly packed and within limits */
+        CORRADE_COMPARE(meshlet.vertexOffset, vertexOffset);
+        CORRADE_COMPARE(meshlet.triangleOffset, triangleOffset);
+        CORRADE_VERIFY(meshlet.vertexCount <= 16);
+        CORRADE_VERIFY(meshlet.triangleCount <= 20);
+        vertexOffset += meshlet.vertexCount;
+        triangleOffset += meshlet.triangleCount;
+
+        for(std::size_t i = 0; i != meshlet.triangleCount*3; ++i) {
+            const UnsignedByte local = triangles[meshlet.triangleOffset*3 + i];
+            CORRADE_VERIFY(local < meshlet.vertexCount);
+            reconstructed.push_back(vertices[meshlet.vertexOffset + local]);
+        }
+
+        /* The bounding sphere contains all vertices, the flat grid is
+           facing +Z */
+        for(std::size_t i = 0; i != meshlet.vertexCount; ++i)
+            CORRADE_VERIFY((positions[vertices[meshlet.vertexOffset + i]] - meshlet.center).length() <= meshlet.radius + 1.0e-5f);
+        CORRADE_COMPARE(meshlet.coneAxis, Vector3::zAxis());
+        CORRADE_COMPARE(meshlet.coneCutoff, 0.0f);
+    }
+
+    CORRADE_COMPARE(vertexOffset, vertices.size());
+    CORRADE_COMPARE(triangleOffset*3, triangles.size());
+
+    /* Each triangle is present exactly once, with the same winding */
+    CORRADE_COMPARE_AS(sortedTriangles(reconstructed), sortedTriangles(indices),
+        TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::empty() {
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> vertices;
+    std::vector<UnsignedByte> triangles;
+    std::tie(meshlets, vertices, triangles) = MeshTools::generateMeshlets({}, {});
+
+    CORRADE_VERIFY(meshlets.empty());
+    CORRADE_VERIFY(vertices.empty());
+    CORRADE_VERIFY(triangles.empty());
+}
+
+void GenerateMeshletsTest::cone() {
+    /* Two triangles facing +Z and +X */
+    const std::vector<Meshlet> meshlets = std::get<0>(MeshTools::generateMeshlets({
+        0, 1, 2,
+        0, 2, 3
+    }, {
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}
+    }));
+
+    CORRADE_COMPARE(meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets[0].center, Vector3{0.5f});
+    CORRADE_COMPARE(meshlets[0].radius, 0.866025f);
+    CORRADE_COMPARE(meshlets[0].coneAxis, (Vector3{1.0f, 0.0f, 1.0f}.normalized()));
+    CORRADE_COMPARE(meshlets[0].coneCutoff, 0.707107f);
+}
+
+void GenerateMeshletsTest::coneOpposite() {
+    /* Two triangles facing opposite directions, the meshlet can't be ever
+       culled */
+    const std::vector<Meshlet> meshlets = std::get<0>(MeshTools::generateMeshlets({
+        0, 1, 2,
+        0, 2, 1
+    }, {
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}
+    }));
+
+    CORRADE_COMPARE(meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets[0].coneCutoff, 1.0f);
+}
+
+void GenerateMeshletsTest::invalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const std::vector<Vector3> positions(3);
+    MeshTools::generateMeshlets({0, 1, 2, 2, 1}, positions);
+    MeshTools::generateMeshlets({0, 1, 2}, positions, 2);
+    MeshTools::generateMeshlets({0, 1, 2}, positions, 257);
+    MeshTools::generateMeshlets({0, 1, 2}, positions, 64, 0);
+    MeshTools::generateMeshlets({0, 1, 3}, positions);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::generateMeshlets(): index count is not divisible by 3\n"
+        "MeshTools::generateMeshlets(): expected max vertex count to be in range [3, 256], got 2\n"
+        "MeshTools::generateMeshlets(): expected max vertex count to be in range [3, 256], got 257\n"
+        "MeshTools::generateMeshlets(): expected non-zero max triangle count\n"
+        "MeshTools::generateMeshlets(): index 3 out of bounds for 3 vertices\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateMeshletsTest)
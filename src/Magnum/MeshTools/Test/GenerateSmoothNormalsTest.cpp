@@ -0,0 +1,234 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateSmoothNormalsTest: TestSuite::Tester {
+    explicit GenerateSmoothNormalsTest();
+
+    void generate();
+    void generateTriangulationIndependent();
+    void generateUnreferenced();
+    void generateInto();
+    void generateIntoInvalid();
+    void generateMultithreaded();
+
+    void crease();
+    void creaseWrongIndexCount();
+};
+
+using namespace Math::Literals;
+
+GenerateSmoothNormalsTest::GenerateSmoothNormalsTest() {
+    addTests({&GenerateSmoothNormalsTest::generate,
+              &GenerateSmoothNormalsTest::generateTriangulationIndependent,
+              &GenerateSmoothNormalsTest::generateUnreferenced,
+              &GenerateSmoothNormalsTest::generateInto,
+              &GenerateSmoothNormalsTest::generateIntoInvalid,
+              &GenerateSmoothNormalsTest::generateMultithreaded,
+
+              &GenerateSmoothNormalsTest::crease,
+              &GenerateSmoothNormalsTest::creaseWrongIndexCount});
+}
+
+/* Two faces sharing the 0-1 edge, one in the XY plane facing +Z, the other
+   in the XZ plane facing +Y */
+const std::vector<UnsignedInt> FoldIndices{
+    0, 1, 2,
+    0, 3, 1
+};
+const std::vector<Vector3> FoldPositions{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, 1.0f}
+};
+
+void GenerateSmoothNormalsTest::generate() {
+    CORRADE_COMPARE(MeshTools::generateSmoothNormals(FoldIndices, FoldPositions), (std::vector<Vector3>{
+        Vector3{0.0f, 1.0f, 1.0f}.normalized(),
+        Vector3{0.0f, 1.0f, 1.0f}.normalized(),
+        Vector3::zAxis(),
+        Vector3::yAxis()
+    }));
+}
+
+void GenerateSmoothNormalsTest::generateTriangulationIndependent() {
+    /* Corner of a cube, with the face in the XY plane split into two
+       triangles. Thanks to the angle weighting the split face doesn't
+       contribute more than the other two. */
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals({
+        0, 1, 4,
+        0, 4, 2,
+        0, 2, 3,
+        0, 3, 1
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 1.0f, 0.0f}
+    });
+
+    CORRADE_COMPARE(normals.size(), 5);
+    CORRADE_COMPARE(normals[0], Vector3{1.0f}.normalized());
+    CORRADE_COMPARE(normals[4], Vector3::zAxis());
+}
+
+void GenerateSmoothNormalsTest::generateUnreferenced() {
+    /* The second face is degenerate, vertex 3 is not referenced at all and
+       vertex 4 only by the degenerate face */
+    CORRADE_COMPARE(MeshTools::generateSmoothNormals({
+        0, 1, 2,
+        0, 1, 4
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {5.0f, 5.0f, 5.0f},
+        {2.0f, 0.0f, 0.0f}
+    }), (std::vector<Vector3>{
+        Vector3::zAxis(),
+        Vector3::zAxis(),
+        Vector3::zAxis(),
+        {},
+        {}
+    }));
+}
+
+void GenerateSmoothNormalsTest::generateInto() {
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+    } vertices[4];
+    for(std::size_t i = 0; i != 4; ++i)
+        vertices[i].position = FoldPositions[i];
+
+    const UnsignedInt indices[]{0, 1, 2, 0, 3, 1};
+    MeshTools::generateSmoothNormalsInto(indices,
+        Containers::StridedArrayView<const Vector3>{&vertices[0].position, 4, sizeof(Vertex)},
+        Containers::StridedArrayView<Vector3>{&vertices[0].normal, 4, sizeof(Vertex)});
+    CORRADE_COMPARE(vertices[0].normal, Vector3(0.0f, 1.0f, 1.0f).normalized());
+    CORRADE_COMPARE(vertices[1].normal, Vector3(0.0f, 1.0f, 1.0f).normalized());
+    CORRADE_COMPARE(vertices[2].normal, Vector3::zAxis());
+    CORRADE_COMPARE(vertices[3].normal, Vector3::yAxis());
+}
+
+void GenerateSmoothNormalsTest::generateIntoInvalid() {
+    std::stringstream out;
+    Error redirectError{&out};
+
+    const UnsignedInt indices[]{0, 1, 2, 0, 1, 2};
+    const UnsignedInt indicesWrongCount[]{0, 1, 2, 0, 3};
+    const UnsignedInt indicesOutOfBounds[]{0, 1, 4};
+    const Vector3 positions[4]{};
+    Vector3 normals[5];
+    MeshTools::generateSmoothNormalsInto(indicesWrongCount, positions, Containers::StridedArrayView<Vector3>{normals, 4, sizeof(Vector3)});
+    MeshTools::generateSmoothNormalsInto(indices, positions, normals);
+    MeshTools::generateSmoothNormalsInto(indicesOutOfBounds, positions, Containers::StridedArrayView<Vector3>{normals, 4, sizeof(Vector3)});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::generateSmoothNormalsInto(): index count is not divisible by 3\n"
+        "MeshTools::generateSmoothNormalsInto(): bad output size, expected 4 but got 5\n"
+        "MeshTools::generateSmoothNormalsInto(): index 4 out of bounds for 4 elements\n");
+}
+
+void GenerateSmoothNormalsTest::generateMultithreaded() {
+    /* A bumpy grid large enough to be split into several chunks */
+    constexpr UnsignedInt Size = 256;
+    std::vector<Vector3> positions;
+    positions.reserve(Size*Size);
+    for(UnsignedInt y = 0; y != Size; ++y)
+        for(UnsignedInt x = 0; x != Size; ++x)
+            positions.emplace_back(Float(x), Float(y), Float((x*7 + y*13)%5));
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != Size - 1; ++y) {
+        for(UnsignedInt x = 0; x != Size - 1; ++x) {
+            const UnsignedInt i = y*Size + x;
+            indices.insert(indices.end(), {i, i + 1, i + Size + 1, i, i + Size + 1, i + Size});
+        }
+    }
+
+    const std::vector<Vector3> serial = MeshTools::generateSmoothNormals(indices, positions);
+    const std::vector<Vector3> threaded = MeshTools::generateSmoothNormals(indices, positions, 4);
+
+    /* Should be bitwise equal, the summation order doesn't depend on the
+       thread count */
+    CORRADE_COMPARE(threaded.size(), serial.size());
+    CORRADE_VERIFY(std::equal(serial.begin(), serial.end(), threaded.begin(), [](const Vector3& a, const Vector3& b) {
+        return a.x() == b.x() && a.y() == b.y() && a.z() == b.z();
+    }));
+}
+
+void GenerateSmoothNormalsTest::crease() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> normals;
+
+    /* The faces are at 90°, so with a 30° crease angle they're not
+       smoothed together and each face has a single normal */
+    std::tie(indices, normals) = MeshTools::generateSmoothNormals(FoldIndices, FoldPositions, Rad(30.0_degf));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 0, 0,
+        1, 1, 1
+    }));
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        Vector3::zAxis(),
+        Vector3::yAxis()
+    }));
+
+    /* With a 100° crease angle the shared edge is smooth */
+    std::tie(indices, normals) = MeshTools::generateSmoothNormals(FoldIndices, FoldPositions, Rad(100.0_degf));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 0, 1,
+        0, 2, 0
+    }));
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        Vector3{0.0f, 1.0f, 1.0f}.normalized(),
+        Vector3::zAxis(),
+        Vector3::yAxis()
+    }));
+}
+
+void GenerateSmoothNormalsTest::creaseWrongIndexCount() {
+    std::stringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> normals;
+    std::tie(indices, normals) = MeshTools::generateSmoothNormals({0, 1}, {}, Rad(30.0_degf));
+    CORRADE_COMPARE(indices.size(), 0);
+    CORRADE_COMPARE(normals.size(), 0);
+    CORRADE_COMPARE(out.str(), "MeshTools::generateSmoothNormals(): index count is not divisible by 3\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateSmoothNormalsTest)
@@ -0,0 +1,190 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/GenerateTangents.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateTangentsTest: TestSuite::Tester {
+    explicit GenerateTangentsTest();
+
+    void generate();
+    void generateMirrored();
+    void generateDegenerateTextureCoordinates();
+    void generateOrthogonalized();
+    void generateInto();
+    void generateIntoInvalid();
+    void generateMultithreaded();
+};
+
+GenerateTangentsTest::GenerateTangentsTest() {
+    addTests({&GenerateTangentsTest::generate,
+              &GenerateTangentsTest::generateMirrored,
+              &GenerateTangentsTest::generateDegenerateTextureCoordinates,
+              &GenerateTangentsTest::generateOrthogonalized,
+              &GenerateTangentsTest::generateInto,
+              &GenerateTangentsTest::generateIntoInvalid,
+              &GenerateTangentsTest::generateMultithreaded});
+}
+
+/* A quad in the XY plane made of two triangles */
+const std::vector<UnsignedInt> QuadIndices{
+    0, 1, 2,
+    0, 2, 3
+};
+const std::vector<Vector3> QuadPositions{
+    {-1.0f, -1.0f, 0.0f},
+    { 1.0f, -1.0f, 0.0f},
+    { 1.0f,  1.0f, 0.0f},
+    {-1.0f,  1.0f, 0.0f}
+};
+const std::vector<Vector3> QuadNormals{4, Vector3::zAxis()};
+
+void GenerateTangentsTest::generate() {
+    CORRADE_COMPARE(MeshTools::generateTangents(QuadIndices, QuadPositions, QuadNormals, {
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 1.0f}
+    }), (std::vector<Vector4>{4, {1.0f, 0.0f, 0.0f, 1.0f}}));
+}
+
+void GenerateTangentsTest::generateMirrored() {
+    /* The U coordinate goes the other way, so the tangent points in -X and
+       the bitangent is not cross(normal, tangent) anymore */
+    CORRADE_COMPARE(MeshTools::generateTangents(QuadIndices, QuadPositions, QuadNormals, {
+        {1.0f, 0.0f},
+        {0.0f, 0.0f},
+        {0.0f, 1.0f},
+        {1.0f, 1.0f}
+    }), (std::vector<Vector4>{4, {-1.0f, 0.0f, 0.0f, -1.0f}}));
+}
+
+void GenerateTangentsTest::generateDegenerateTextureCoordinates() {
+    /* All texture coordinates the same, there's no tangent direction so an
+       arbitrary one perpendicular to the normal is picked */
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(QuadIndices, QuadPositions, QuadNormals, std::vector<Vector2>(4, Vector2{0.5f}));
+    CORRADE_COMPARE(tangents, (std::vector<Vector4>{4, {0.0f, 1.0f, 0.0f, 1.0f}}));
+}
+
+void GenerateTangentsTest::generateOrthogonalized() {
+    /* Normals tilted around the Y axis, the tangent has to follow */
+    const Vector3 normal = Vector3{1.0f, 0.0f, 1.0f}.normalized();
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(QuadIndices, QuadPositions, std::vector<Vector3>(4, normal), {
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 1.0f}
+    });
+    CORRADE_COMPARE(tangents.size(), 4);
+    for(const Vector4& tangent: tangents) {
+        CORRADE_COMPARE(tangent.xyz(), Vector3(1.0f, 0.0f, -1.0f).normalized());
+        CORRADE_COMPARE(tangent.w(), 1.0f);
+    }
+}
+
+void GenerateTangentsTest::generateInto() {
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        Vector2 textureCoordinates;
+        Vector4 tangent;
+    } vertices[]{
+        {{-1.0f, -1.0f, 0.0f}, Vector3::zAxis(), {0.0f, 0.0f}, {}},
+        {{ 1.0f, -1.0f, 0.0f}, Vector3::zAxis(), {0.0f, 1.0f}, {}},
+        {{ 1.0f,  1.0f, 0.0f}, Vector3::zAxis(), {1.0f, 1.0f}, {}},
+        {{-1.0f,  1.0f, 0.0f}, Vector3::zAxis(), {1.0f, 0.0f}, {}}
+    };
+
+    /* Texture rotated by 90°, tangent goes along +Y */
+    const UnsignedInt indices[]{0, 1, 2, 0, 2, 3};
+    MeshTools::generateTangentsInto(indices,
+        Containers::StridedArrayView<const Vector3>{&vertices[0].position, 4, sizeof(Vertex)},
+        Containers::StridedArrayView<const Vector3>{&vertices[0].normal, 4, sizeof(Vertex)},
+        Containers::StridedArrayView<const Vector2>{&vertices[0].textureCoordinates, 4, sizeof(Vertex)},
+        Containers::StridedArrayView<Vector4>{&vertices[0].tangent, 4, sizeof(Vertex)});
+    for(const Vertex& vertex: vertices)
+        CORRADE_COMPARE(vertex.tangent, Vector4(0.0f, 1.0f, 0.0f, -1.0f));
+}
+
+void GenerateTangentsTest::generateIntoInvalid() {
+    std::stringstream out;
+    Error redirectError{&out};
+
+    const UnsignedInt indices[]{0, 1, 2, 0, 1, 2};
+    const UnsignedInt indicesWrongCount[]{0, 1, 2, 0, 3};
+    const UnsignedInt indicesOutOfBounds[]{0, 1, 4};
+    const Vector3 positions[4]{};
+    const Vector3 normals[4]{};
+    const Vector2 textureCoordinates[4]{};
+    Vector4 tangents[5];
+    MeshTools::generateTangentsInto(indicesWrongCount, positions, normals, textureCoordinates, Containers::StridedArrayView<Vector4>{tangents, 4, sizeof(Vector4)});
+    MeshTools::generateTangentsInto(indices, positions, normals, Containers::StridedArrayView<const Vector2>{textureCoordinates, 3, sizeof(Vector2)}, Containers::StridedArrayView<Vector4>{tangents, 4, sizeof(Vector4)});
+    MeshTools::generateTangentsInto(indices, positions, normals, textureCoordinates, tangents);
+    MeshTools::generateTangentsInto(indicesOutOfBounds, positions, normals, textureCoordinates, Containers::StridedArrayView<Vector4>{tangents, 4, sizeof(Vector4)});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::generateTangentsInto(): index count is not divisible by 3\n"
+        "MeshTools::generateTangentsInto(): expected 4 normals and texture coordinates but got 4 and 3\n"
+        "MeshTools::generateTangentsInto(): bad output size, expected 4 but got 5\n"
+        "MeshTools::generateTangentsInto(): index 4 out of bounds for 4 elements\n");
+}
+
+void GenerateTangentsTest::generateMultithreaded() {
+    /* A wavy grid large enough to be split into several chunks, with
+       texture coordinates mirrored in one half */
+    constexpr UnsignedInt Size = 256;
+    std::vector<Vector3> positions, normals;
+    std::vector<Vector2> textureCoordinates;
+    for(UnsignedInt y = 0; y != Size; ++y) {
+        for(UnsignedInt x = 0; x != Size; ++x) {
+            positions.emplace_back(Float(x), Float(y), Float((x*7 + y*13)%5));
+            normals.push_back(Vector3{Float(x%3) - 1.0f, Float(y%3) - 1.0f, 2.0f}.normalized());
+            textureCoordinates.emplace_back(Float(x < Size/2 ? x : Size - x), Float(y));
+        }
+    }
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != Size - 1; ++y) {
+        for(UnsignedInt x = 0; x != Size - 1; ++x) {
+            const UnsignedInt i = y*Size + x;
+            indices.insert(indices.end(), {i, i + 1, i + Size + 1, i, i + Size + 1, i + Size});
+        }
+    }
+
+    const std::vector<Vector4> serial = MeshTools::generateTangents(indices, positions, normals, textureCoordinates);
+    const std::vector<Vector4> threaded = MeshTools::generateTangents(indices, positions, normals, textureCoordinates, 4);
+
+    CORRADE_COMPARE(threaded.size(), serial.size());
+    CORRADE_VERIFY(std::equal(serial.begin(), serial.end(), threaded.begin(), [](const Vector4& a, const Vector4& b) {
+        return a.x() == b.x() && a.y() == b.y() && a.z() == b.z() && a.w() == b.w();
+    }));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateTangentsTest)
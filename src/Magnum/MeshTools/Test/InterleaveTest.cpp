@@ -23,11 +23,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Endianness.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/Interleave.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
@@ -43,6 +45,9 @@ struct InterleaveTest: Corrade::TestSuite::Tester {
     void writeGaps();
 
     void interleaveInto();
+    void interleaveIntoStrided();
+    void interleaveIntoConverted();
+    void interleaveConvertedCustom();
 };
 
 InterleaveTest::InterleaveTest() {
@@ -53,7 +58,10 @@ InterleaveTest::InterleaveTest() {
               &InterleaveTest::write,
               &InterleaveTest::writeGaps,
 
-              &InterleaveTest::interleaveInto});
+              &InterleaveTest::interleaveInto,
+              &InterleaveTest::interleaveIntoStrided,
+              &InterleaveTest::interleaveIntoConverted,
+              &InterleaveTest::interleaveConvertedCustom});
 }
 
 void InterleaveTest::attributeCount() {
@@ -157,6 +165,85 @@ void InterleaveTest::interleaveInto() {
     }
 }
 
+void InterleaveTest::interleaveIntoStrided() {
+    /* Taking every other value from an array of pairs */
+    const std::pair<Int, Short> input[]{{4, 0}, {5, 1}, {6, 2}, {7, 3}};
+    Containers::Array<char> data{Containers::InPlaceInit, {
+        0x11, 0x33, 0x55, 0x77, 0x11, 0x33, 0x55, 0x77,
+        0x11, 0x33, 0x55, 0x77, 0x11, 0x33, 0x55, 0x77,
+        0x11, 0x33, 0x55, 0x77, 0x11, 0x33, 0x55, 0x77,
+        0x11, 0x33, 0x55, 0x77, 0x11, 0x33, 0x55, 0x77}};
+
+    CORRADE_COMPARE((Implementation::Stride{}(2,
+        Containers::StridedArrayView<const Int>{&input[0].first, 4, sizeof(std::pair<Int, Short>)}, 2)), std::size_t(8));
+
+    MeshTools::interleaveInto(data, 2,
+        Containers::StridedArrayView<const Int>{&input[0].first, 4, sizeof(std::pair<Int, Short>)}, 2);
+
+    if(!Utility::Endianness::isBigEndian()) {
+        /*  _______gap, int___________________, _______gap */
+        CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()), (std::vector<char>{
+            0x11, 0x33, 0x04, 0x00, 0x00, 0x00, 0x55, 0x77,
+            0x11, 0x33, 0x05, 0x00, 0x00, 0x00, 0x55, 0x77,
+            0x11, 0x33, 0x06, 0x00, 0x00, 0x00, 0x55, 0x77,
+            0x11, 0x33, 0x07, 0x00, 0x00, 0x00, 0x55, 0x77
+        }));
+    } else {
+        /*  _______gap, ___________________int, _______gap */
+        CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()), (std::vector<char>{
+            0x11, 0x33, 0x00, 0x00, 0x00, 0x04, 0x55, 0x77,
+            0x11, 0x33, 0x00, 0x00, 0x00, 0x05, 0x55, 0x77,
+            0x11, 0x33, 0x00, 0x00, 0x00, 0x06, 0x55, 0x77,
+            0x11, 0x33, 0x00, 0x00, 0x00, 0x07, 0x55, 0x77
+        }));
+    }
+}
+
+void InterleaveTest::interleaveIntoConverted() {
+    const std::vector<Vector3> normals{{1.0f, 0.0f, -1.0f}, {0.0f, 0.5f, 0.0f}};
+    const std::vector<Float> weights{1.0f, -2.0f};
+    char data[2*12];
+    std::memset(data, 0x55, sizeof(data));
+
+    CORRADE_COMPARE((Implementation::Stride{}(MeshTools::packAttribute<Math::Vector3<Short>>(normals), 2,
+        MeshTools::packHalfAttribute(weights), 2)), std::size_t(12));
+
+    MeshTools::interleaveInto(data, MeshTools::packAttribute<Math::Vector3<Short>>(normals), 2,
+        MeshTools::packHalfAttribute(weights), 2);
+
+    struct Vertex {
+        Math::Vector3<Short> normal;
+        UnsignedShort gap1;
+        UnsignedShort weight;
+        UnsignedShort gap2;
+    } vertices[2];
+    std::memcpy(vertices, data, sizeof(data));
+    CORRADE_COMPARE(vertices[0].normal, (Math::Vector3<Short>{32767, 0, -32767}));
+    CORRADE_COMPARE(vertices[1].normal, (Math::Vector3<Short>{0, 16383, 0}));
+    CORRADE_COMPARE(vertices[0].weight, 0x3c00);
+    CORRADE_COMPARE(vertices[1].weight, 0xc000);
+
+    /* Gaps are left untouched */
+    CORRADE_COMPARE(vertices[0].gap1, 0x5555);
+    CORRADE_COMPARE(vertices[1].gap2, 0x5555);
+}
+
+UnsignedByte doubled(const Int& value) { return UnsignedByte(value*2); }
+
+void InterleaveTest::interleaveConvertedCustom() {
+    /* Taking every other value from an array of pairs, converting it to a
+       smaller type */
+    const std::pair<Int, Short> input[]{{4, 0}, {5, 1}, {6, 2}};
+    Containers::Array<char> data = MeshTools::interleave(
+        MeshTools::convertAttribute(Containers::StridedArrayView<const Int>{&input[0].first, 3, sizeof(std::pair<Int, Short>)}, doubled), 1);
+
+    CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()), (std::vector<char>{
+        0x08, 0x00,
+        0x0a, 0x00,
+        0x0c, 0x00
+    }));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::InterleaveTest)
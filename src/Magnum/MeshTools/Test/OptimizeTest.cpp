@@ -0,0 +1,233 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Optimize.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct OptimizeTest: TestSuite::Tester {
+    explicit OptimizeTest();
+
+    void analyzeVertexCache();
+    void analyzeVertexCacheInvalidIndex();
+
+    void optimizeVertexCache();
+    void optimizeVertexCacheEmpty();
+    void optimizeVertexCacheInvalidSize();
+
+    void optimizeOverdraw();
+    void optimizeOverdrawInvalidThreshold();
+
+    void optimizeVertexFetch();
+};
+
+namespace {
+    /* Same mesh as in TipsifyTest */
+    const std::vector<UnsignedInt> Indices{
+        4, 1, 0,
+        10, 9, 13,
+        6, 3, 2,
+        9, 5, 4,
+        12, 9, 8,
+        11, 7, 6,
+
+        14, 15, 11,
+        2, 1, 5,
+        10, 6, 5,
+        10, 5, 9,
+        13, 14, 10,
+        1, 4, 5,
+
+        7, 3, 6,
+        6, 2, 5,
+        9, 4, 8,
+        6, 10, 11,
+        13, 9, 12,
+        14, 11, 10,
+
+        16, 17, 18
+    };
+
+    constexpr std::size_t VertexCount = 19;
+
+    /* Triangles with their vertices sorted, for comparing that the
+       triangle set is preserved */
+    std::vector<UnsignedInt> sortedTriangles(const std::vector<UnsignedInt>& indices) {
+        std::vector<UnsignedInt> sorted = indices;
+        for(std::size_t i = 0; i != sorted.size(); i += 3)
+            std::sort(sorted.begin() + i, sorted.begin() + i + 3);
+
+        std::vector<std::size_t> order(sorted.size()/3);
+        for(std::size_t i = 0; i != order.size(); ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [&sorted](std::size_t a, std::size_t b) {
+            return std::lexicographical_compare(
+                sorted.begin() + a*3, sorted.begin() + a*3 + 3,
+                sorted.begin() + b*3, sorted.begin() + b*3 + 3);
+        });
+
+        std::vector<UnsignedInt> out;
+        for(const std::size_t i: order)
+            out.insert(out.end(), sorted.begin() + i*3, sorted.begin() + i*3 + 3);
+        return out;
+    }
+}
+
+OptimizeTest::OptimizeTest() {
+    addTests({&OptimizeTest::analyzeVertexCache,
+              &OptimizeTest::analyzeVertexCacheInvalidIndex,
+
+              &OptimizeTest::optimizeVertexCache,
+              &OptimizeTest::optimizeVertexCacheEmpty,
+              &OptimizeTest::optimizeVertexCacheInvalidSize,
+
+              &OptimizeTest::optimizeOverdraw,
+              &OptimizeTest::optimizeOverdrawInvalidThreshold,
+
+              &OptimizeTest::optimizeVertexFetch});
+}
+
+void OptimizeTest::analyzeVertexCache() {
+    /* Vertex 0 gets pushed out by vertex 3, vertex 4 is not referenced */
+    const VertexCacheStatistics statistics = MeshTools::analyzeVertexCache({
+        0, 1, 2,
+        2, 1, 3,
+        3, 1, 0
+    }, 5, 3);
+
+    CORRADE_COMPARE(statistics.transformedVertexCount, 5);
+    CORRADE_COMPARE(statistics.averageCacheMissRatio, 5.0f/3.0f);
+    CORRADE_COMPARE(statistics.averageTransformToVertexRatio, 5.0f/4.0f);
+}
+
+void OptimizeTest::analyzeVertexCacheInvalidIndex() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshTools::analyzeVertexCache({0, 1, 2, 2, 1}, 3, 16);
+    MeshTools::analyzeVertexCache({0, 1, 3}, 3, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::analyzeVertexCache(): index count is not divisible by 3\n"
+        "MeshTools::analyzeVertexCache(): index 3 out of bounds for 3 vertices\n");
+}
+
+void OptimizeTest::optimizeVertexCache() {
+    std::vector<UnsignedInt> indices = Indices;
+    MeshTools::optimizeVertexCache(indices, VertexCount, 4);
+
+    /* Same triangles, only in different order */
+    CORRADE_COMPARE_AS(sortedTriangles(indices), sortedTriangles(Indices),
+        TestSuite::Compare::Container);
+
+    /* The original has 52 cache misses */
+    const VertexCacheStatistics statistics = MeshTools::analyzeVertexCache(indices, VertexCount, 4);
+    CORRADE_COMPARE(statistics.transformedVertexCount, 26);
+    CORRADE_COMPARE(statistics.averageCacheMissRatio, 26.0f/19.0f);
+}
+
+void OptimizeTest::optimizeVertexCacheEmpty() {
+    std::vector<UnsignedInt> indices;
+    MeshTools::optimizeVertexCache(indices, 0);
+    CORRADE_VERIFY(indices.empty());
+}
+
+void OptimizeTest::optimizeVertexCacheInvalidSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices{0, 1, 2, 2, 1};
+    MeshTools::optimizeVertexCache(indices, 3);
+    indices.push_back(0);
+    MeshTools::optimizeVertexCache(indices, 3, 3);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeVertexCache(): index count is not divisible by 3\n"
+        "MeshTools::optimizeVertexCache(): expected cache size larger than 3, got 3\n");
+}
+
+void OptimizeTest::optimizeOverdraw() {
+    /* Two quads with the same normal, one closer to the viewer than the
+       other, each one a separate cluster as there's no vertex sharing in
+       between them */
+    const std::vector<Vector3> positions{
+        {0.0f, 0.0f, -1.0f}, {1.0f, 0.0f, -1.0f},
+        {0.0f, 1.0f, -1.0f}, {1.0f, 1.0f, -1.0f},
+
+        {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f}
+    };
+    std::vector<UnsignedInt> indices{
+        0, 1, 2,
+        2, 1, 3,
+
+        4, 5, 6,
+        6, 5, 7
+    };
+    MeshTools::optimizeOverdraw(indices, positions, 16);
+
+    /* The quad in front of the center along the normal goes first, order
+       inside clusters is preserved */
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        4, 5, 6,
+        6, 5, 7,
+
+        0, 1, 2,
+        2, 1, 3
+    }));
+}
+
+void OptimizeTest::optimizeOverdrawInvalidThreshold() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices{0, 1, 2};
+    MeshTools::optimizeOverdraw(indices, {{}, {}, {}}, 16, 0.5f);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeOverdraw(): expected threshold to be at least 1, got 0.5\n");
+}
+
+void OptimizeTest::optimizeVertexFetch() {
+    /* Vertex 2 is not referenced */
+    std::vector<UnsignedInt> indices{
+        3, 1, 4,
+        4, 1, 0
+    };
+    const std::vector<UnsignedInt> remapping = MeshTools::optimizeVertexFetch(indices, 5);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 2,
+        2, 1, 3
+    }));
+    CORRADE_COMPARE(remapping, (std::vector<UnsignedInt>{3, 1, 4, 0}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeTest)
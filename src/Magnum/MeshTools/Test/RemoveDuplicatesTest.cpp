@@ -23,9 +23,11 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+#include <tuple>
 #include <Corrade/TestSuite/Tester.h>
 
-#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
@@ -34,10 +36,24 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     explicit RemoveDuplicatesTest();
 
     void removeDuplicates();
+
+    void removeDuplicatesInPlace();
+    void removeDuplicatesInPlaceErased();
+    void removeDuplicatesInPlaceEmpty();
+    void removeDuplicatesInPlaceMany();
+    void removeDuplicatesInPlaceMultithreaded();
+    void removeDuplicatesInPlaceInvalidSize();
 };
 
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
-    addTests({&RemoveDuplicatesTest::removeDuplicates});
+    addTests({&RemoveDuplicatesTest::removeDuplicates,
+
+              &RemoveDuplicatesTest::removeDuplicatesInPlace,
+              &RemoveDuplicatesTest::removeDuplicatesInPlaceErased,
+              &RemoveDuplicatesTest::removeDuplicatesInPlaceEmpty,
+              &RemoveDuplicatesTest::removeDuplicatesInPlaceMany,
+              &RemoveDuplicatesTest::removeDuplicatesInPlaceMultithreaded,
+              &RemoveDuplicatesTest::removeDuplicatesInPlaceInvalidSize});
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -59,6 +75,123 @@ void RemoveDuplicatesTest::removeDuplicates() {
     }));
 }
 
+void RemoveDuplicatesTest::removeDuplicatesInPlace() {
+    /* Exact comparison, nearby values are not merged */
+    std::vector<Vector2i> data{
+        {1, 0},
+        {2, 1},
+        {1, 0},
+        {1, 1},
+        {2, 1},
+        {1, 0}
+    };
+
+    std::vector<UnsignedInt> indices;
+    std::size_t count;
+    std::tie(indices, count) = MeshTools::removeDuplicatesInPlace(Containers::StridedArrayView<Vector2i>{data.data(), data.size(), sizeof(Vector2i)});
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 0, 2, 1, 0}));
+    CORRADE_COMPARE(count, 3);
+
+    data.resize(count);
+    CORRADE_COMPARE(data, (std::vector<Vector2i>{
+        {1, 0},
+        {2, 1},
+        {1, 1}
+    }));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesInPlaceErased() {
+    /* Only position and normal are compared, the trailing ID is ignored and
+       not touched */
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        Int id;
+    } data[]{
+        {{1.0f, 2.0f, 3.0f}, { 1.0f, 0.0f, 0.0f}, 0},
+        {{1.0f, 2.0f, 3.0f}, {-1.0f, 0.0f, 0.0f}, 1},
+        {{1.0f, 2.0f, 3.0f}, { 1.0f, 0.0f, 0.0f}, 2},
+        {{3.0f, 2.0f, 1.0f}, {-1.0f, 0.0f, 0.0f}, 3},
+        {{1.0f, 2.0f, 3.0f}, {-1.0f, 0.0f, 0.0f}, 4}
+    };
+
+    std::vector<UnsignedInt> indices;
+    std::size_t count;
+    std::tie(indices, count) = MeshTools::removeDuplicatesInPlace(Containers::StridedArrayView<char>{reinterpret_cast<char*>(data), 5, sizeof(Vertex)}, sizeof(Vector3)*2);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 0, 2, 1}));
+    CORRADE_COMPARE(count, 3);
+
+    CORRADE_COMPARE(data[0].position, (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(data[0].normal, (Vector3{1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(data[1].position, (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(data[1].normal, (Vector3{-1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(data[2].position, (Vector3{3.0f, 2.0f, 1.0f}));
+    CORRADE_COMPARE(data[2].normal, (Vector3{-1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(data[2].id, 2);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesInPlaceEmpty() {
+    std::vector<UnsignedInt> indices;
+    std::size_t count;
+    std::tie(indices, count) = MeshTools::removeDuplicatesInPlace(Containers::StridedArrayView<Vector2i>{});
+    CORRADE_VERIFY(indices.empty());
+    CORRADE_COMPARE(count, 0);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesInPlaceMany() {
+    /* Enough items to cause collisions in the table, each unique value
+       repeated three times */
+    std::vector<Vector3i> data;
+    for(Int i = 0; i != 3; ++i)
+        for(Int j = 0; j != 1000; ++j)
+            data.emplace_back(j % 10, j/10, 0);
+
+    std::vector<UnsignedInt> indices;
+    std::size_t count;
+    std::tie(indices, count) = MeshTools::removeDuplicatesInPlace(Containers::StridedArrayView<Vector3i>{data.data(), data.size(), sizeof(Vector3i)});
+    CORRADE_COMPARE(count, 1000);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        CORRADE_COMPARE(indices[i], UnsignedInt(i % 1000));
+    for(Int j = 0; j != 1000; ++j)
+        CORRADE_COMPARE(data[j], (Vector3i{j % 10, j/10, 0}));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesInPlaceMultithreaded() {
+    /* Enough items to go over the multithreading threshold */
+    std::vector<Vector3i> data;
+    for(Int i = 0; i != 100000; ++i)
+        data.emplace_back(i % 17, (i*13) % 1000, 0);
+    std::vector<Vector3i> expected = data;
+
+    std::vector<UnsignedInt> expectedIndices;
+    std::size_t expectedCount;
+    std::tie(expectedIndices, expectedCount) = MeshTools::removeDuplicatesInPlace(Containers::StridedArrayView<Vector3i>{expected.data(), expected.size(), sizeof(Vector3i)});
+    CORRADE_COMPARE(expectedCount, 17000);
+
+    std::vector<UnsignedInt> indices;
+    std::size_t count;
+    std::tie(indices, count) = MeshTools::removeDuplicatesInPlace(Containers::StridedArrayView<Vector3i>{data.data(), data.size(), sizeof(Vector3i)}, 4);
+
+    /* The output is the same as in the serial case */
+    CORRADE_COMPARE(count, expectedCount);
+    CORRADE_VERIFY(indices == expectedIndices);
+    data.resize(count);
+    expected.resize(count);
+    CORRADE_VERIFY(data == expected);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesInPlaceInvalidSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[8]{};
+    MeshTools::removeDuplicatesInPlace(Containers::StridedArrayView<char>{data, 2, 4}, 0);
+    MeshTools::removeDuplicatesInPlace(Containers::StridedArrayView<char>{data, 2, 4}, 5);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::removeDuplicatesInPlace(): expected non-zero item size\n"
+        "MeshTools::removeDuplicatesInPlace(): expected stride to be at least 5 bytes, got 4\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
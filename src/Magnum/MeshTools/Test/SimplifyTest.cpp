@@ -0,0 +1,174 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    void flat();
+    void seam();
+    void targetError();
+    void invalid();
+
+    void lods();
+    void lodsInvalid();
+};
+
+namespace {
+    /* 4x4 quads on the XY plane */
+    std::vector<Vector3> gridPositions() {
+        std::vector<Vector3> positions;
+        for(UnsignedInt y = 0; y <= 4; ++y)
+            for(UnsignedInt x = 0; x <= 4; ++x)
+                positions.emplace_back(Float(x), Float(y), 0.0f);
+        return positions;
+    }
+
+    std::vector<UnsignedInt> gridIndices() {
+        std::vector<UnsignedInt> indices;
+        for(UnsignedInt y = 0; y != 4; ++y) for(UnsignedInt x = 0; x != 4; ++x) {
+            const UnsignedInt i = y*5 + x;
+            indices.insert(indices.end(), {i, i + 1, i + 6, i, i + 6, i + 5});
+        }
+        return indices;
+    }
+}
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::flat,
+              &SimplifyTest::seam,
+              &SimplifyTest::targetError,
+              &SimplifyTest::invalid,
+
+              &SimplifyTest::lods,
+              &SimplifyTest::lodsInvalid});
+}
+
+void SimplifyTest::flat() {
+    /* The grid is collapsed to just two triangles between the corners,
+       without any error */
+    std::pair<std::vector<UnsignedInt>, Float> simplified = MeshTools::simplify(gridIndices(), gridPositions(), 6);
+    CORRADE_COMPARE(simplified.first, (std::vector<UnsignedInt>{
+        0, 4, 24,
+        0, 24, 20
+    }));
+    CORRADE_COMPARE(simplified.second, 0.0f);
+}
+
+void SimplifyTest::seam() {
+    /* Center vertex duplicated for the bottom half of the grid. It can't be
+       collapsed, otherwise there would be a crack. */
+    std::vector<Vector3> positions = gridPositions();
+    positions.push_back(positions[12]);
+    std::vector<UnsignedInt> indices = gridIndices();
+    for(std::size_t i = 0; i != indices.size()/2; ++i)
+        if(indices[i] == 12) indices[i] = 25;
+
+    std::pair<std::vector<UnsignedInt>, Float> simplified = MeshTools::simplify(indices, positions, 6);
+    CORRADE_COMPARE(simplified.first, (std::vector<UnsignedInt>{
+        0, 4, 25,
+        0, 12, 20,
+        12, 24, 20,
+        12, 4, 24
+    }));
+    CORRADE_COMPARE(simplified.second, 0.0f);
+}
+
+void SimplifyTest::targetError() {
+    /* Bump in the middle, collapsing it is not possible without an error */
+    std::vector<Vector3> positions = gridPositions();
+    positions[12].z() = 1.0f;
+
+    std::pair<std::vector<UnsignedInt>, Float> simplified = MeshTools::simplify(gridIndices(), positions, 0, 0.1f);
+    CORRADE_COMPARE(simplified.first.size(), 16*3);
+    CORRADE_COMPARE(simplified.second, 0.0f);
+
+    simplified = MeshTools::simplify(gridIndices(), positions, 0, 0.5f);
+    CORRADE_COMPARE(simplified.first.size(), 4*3);
+    CORRADE_COMPARE(simplified.second, 0.369836f);
+}
+
+void SimplifyTest::invalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const std::vector<Vector3> positions(3);
+    MeshTools::simplify({0, 1, 2, 2, 1}, positions, 0);
+    MeshTools::simplify({0, 1, 3}, positions, 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplify(): index count is not divisible by 3\n"
+        "MeshTools::simplify(): index 3 out of bounds for 3 vertices\n");
+}
+
+void SimplifyTest::lods() {
+    std::vector<Vector3> positions = gridPositions();
+    positions[12].z() = 1.0f;
+
+    const std::vector<UnsignedInt> indices = gridIndices();
+    std::vector<std::pair<std::vector<UnsignedInt>, Float>> lods = MeshTools::generateLods(indices, positions, 4);
+    CORRADE_COMPARE(lods.size(), 4);
+
+    /* First level is the original, each next has at most half the triangles
+       and larger error */
+    CORRADE_COMPARE(lods[0].first, indices);
+    CORRADE_COMPARE(lods[0].second, 0.0f);
+    for(std::size_t i = 1; i != lods.size(); ++i) {
+        CORRADE_VERIFY(lods[i].first.size() <= lods[i - 1].first.size()/2);
+        CORRADE_VERIFY(lods[i].second >= lods[i - 1].second);
+    }
+    CORRADE_COMPARE(lods[3].first.size(), 4*3);
+    CORRADE_COMPARE(lods[3].second, 0.369836f);
+
+    /* The chain ends early if the error would be too large */
+    lods = MeshTools::generateLods(indices, positions, 10, 0.5f, 0.1f);
+    CORRADE_COMPARE(lods.size(), 2);
+    CORRADE_COMPARE(lods[1].first.size(), 16*3);
+}
+
+void SimplifyTest::lodsInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const std::vector<Vector3> positions(3);
+    MeshTools::generateLods({0, 1, 2, 2, 1}, positions, 2);
+    MeshTools::generateLods({0, 1, 2}, positions, 2, 1.0f);
+    MeshTools::generateLods({0, 1, 3}, positions, 2);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::generateLods(): index count is not divisible by 3\n"
+        "MeshTools::generateLods(): expected ratio to be in range (0, 1), got 1\n"
+        "MeshTools::generateLods(): index 3 out of bounds for 3 vertices\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
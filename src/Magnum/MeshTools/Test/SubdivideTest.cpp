@@ -26,6 +26,8 @@
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Subdivide.h"
 
@@ -36,6 +38,13 @@ struct SubdivideTest: TestSuite::Tester {
 
     void wrongIndexCount();
     void subdivide();
+    void subdivideInPlace();
+    void subdivideInPlaceInvalid();
+
+    void subdivideShared();
+    void subdivideSharedIterations();
+    void subdivideSharedMultithreaded();
+    void subdivideSharedInvalid();
 };
 
 namespace {
@@ -44,11 +53,20 @@ typedef Math::Vector<1, Int> Vector1;
 
 inline Vector1 interpolator(Vector1 a, Vector1 b) { return (a[0]+b[0])/2; }
 
+inline Vector2 interpolator2(const Vector2& a, const Vector2& b) { return (a+b)*0.5f; }
+
 }
 
 SubdivideTest::SubdivideTest() {
     addTests({&SubdivideTest::wrongIndexCount,
-              &SubdivideTest::subdivide});
+              &SubdivideTest::subdivide,
+              &SubdivideTest::subdivideInPlace,
+              &SubdivideTest::subdivideInPlaceInvalid,
+
+              &SubdivideTest::subdivideShared,
+              &SubdivideTest::subdivideSharedIterations,
+              &SubdivideTest::subdivideSharedMultithreaded,
+              &SubdivideTest::subdivideSharedInvalid});
 }
 
 void SubdivideTest::wrongIndexCount() {
@@ -72,6 +90,108 @@ void SubdivideTest::subdivide() {
     CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 7, 8, 9, 0, 4, 6, 4, 1, 5, 6, 5, 2, 1, 7, 9, 7, 2, 8, 9, 8, 3}));
 }
 
+void SubdivideTest::subdivideInPlace() {
+    /* Same as above, with space for the new data preallocated */
+    Vector1 positions[]{0, 2, 6, 8, {}, {}, {}, {}, {}, {}};
+    UnsignedInt indices[24]{0, 1, 2, 1, 2, 3};
+    MeshTools::subdivideInPlace(
+        Containers::StridedArrayView<UnsignedInt>{indices, 24, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<Vector1>{positions, 10, sizeof(Vector1)},
+        interpolator);
+
+    CORRADE_VERIFY(std::vector<Vector1>(positions, positions + 10) == (std::vector<Vector1>{0, 2, 6, 8, 1, 4, 3, 4, 7, 5}));
+    CORRADE_COMPARE(std::vector<UnsignedInt>(indices, indices + 24), (std::vector<UnsignedInt>{4, 5, 6, 7, 8, 9, 0, 4, 6, 4, 1, 5, 6, 5, 2, 1, 7, 9, 7, 2, 8, 9, 8, 3}));
+}
+
+void SubdivideTest::subdivideInPlaceInvalid() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+
+    Vector1 positions[5];
+    UnsignedInt indices[24]{};
+    MeshTools::subdivideInPlace(
+        Containers::StridedArrayView<UnsignedInt>{indices, 18, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<Vector1>{positions, 5, sizeof(Vector1)},
+        interpolator);
+    MeshTools::subdivideInPlace(
+        Containers::StridedArrayView<UnsignedInt>{indices, 24, sizeof(UnsignedInt)},
+        Containers::StridedArrayView<Vector1>{positions, 5, sizeof(Vector1)},
+        interpolator);
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::subdivideInPlace(): index count is not divisible by 12!\n"
+        "MeshTools::subdivideInPlace(): can't fit 6 new vertices into 5 vertices\n");
+}
+
+void SubdivideTest::subdivideShared() {
+    /* Same as subdivide() but the midpoint of the shared 1-2 edge, 4, is
+       there only once */
+    std::vector<Vector1> positions{0, 2, 6, 8};
+    std::vector<UnsignedInt> indices{0, 1, 2, 1, 2, 3};
+    MeshTools::subdivideShared(indices, positions, interpolator);
+
+    CORRADE_VERIFY(positions == (std::vector<Vector1>{0, 2, 6, 8, 1, 4, 3, 7, 5}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 5, 7, 8, 0, 4, 6, 4, 1, 5, 6, 5, 2, 1, 5, 8, 5, 2, 7, 8, 7, 3}));
+}
+
+void SubdivideTest::subdivideSharedIterations() {
+    /* A quad, in the plane so all midpoints are unique. The output should be
+       the same as repeated subdivide() with duplicate removal. */
+    std::vector<Vector2> positions{{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+    std::vector<UnsignedInt> indices{0, 1, 2, 0, 2, 3};
+
+    std::vector<Vector2> expectedPositions = positions;
+    std::vector<UnsignedInt> expectedIndices = indices;
+    for(std::size_t i = 0; i != 3; ++i) {
+        MeshTools::subdivide(expectedIndices, expectedPositions, interpolator2);
+        expectedIndices = MeshTools::duplicate(expectedIndices, MeshTools::removeDuplicates(expectedPositions));
+    }
+
+    MeshTools::subdivideShared(indices, positions, interpolator2, 3);
+    CORRADE_COMPARE(positions.size(), 81);
+    CORRADE_COMPARE(positions, expectedPositions);
+    CORRADE_COMPARE(indices, expectedIndices);
+}
+
+void SubdivideTest::subdivideSharedMultithreaded() {
+    /* A grid large enough to be split into several chunks */
+    constexpr UnsignedInt Size = 128;
+    std::vector<Vector2> positions;
+    for(UnsignedInt y = 0; y != Size; ++y)
+        for(UnsignedInt x = 0; x != Size; ++x)
+            positions.emplace_back(Float(x), Float(y));
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != Size - 1; ++y) {
+        for(UnsignedInt x = 0; x != Size - 1; ++x) {
+            const UnsignedInt i = y*Size + x;
+            indices.insert(indices.end(), {i, i + 1, i + Size + 1, i, i + Size + 1, i + Size});
+        }
+    }
+
+    std::vector<Vector2> threadedPositions = positions;
+    std::vector<UnsignedInt> threadedIndices = indices;
+    MeshTools::subdivideShared(indices, positions, interpolator2, 2);
+    MeshTools::subdivideShared(threadedIndices, threadedPositions, interpolator2, 2, 4);
+
+    /* V - E + F = 1 for a planar mesh without holes */
+    CORRADE_COMPARE(positions.size(), (4*(Size - 1) + 1)*(4*(Size - 1) + 1));
+    CORRADE_COMPARE(threadedPositions, positions);
+    CORRADE_COMPARE(threadedIndices, indices);
+}
+
+void SubdivideTest::subdivideSharedInvalid() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+
+    std::vector<Vector1> positions{0, 2, 6};
+    std::vector<UnsignedInt> indices{0, 1};
+    std::vector<UnsignedInt> indicesOutOfBounds{0, 1, 3};
+    MeshTools::subdivideShared(indices, positions, interpolator);
+    MeshTools::subdivideShared(indicesOutOfBounds, positions, interpolator);
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::subdivideShared(): index count is not divisible by 3\n"
+        "MeshTools::subdivideShared(): index 3 out of bounds for 3 vertices\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SubdivideTest)
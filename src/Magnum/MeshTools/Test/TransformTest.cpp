@@ -24,9 +24,11 @@
 */
 
 #include <array>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/Magnum.h"
 #include "Magnum/MeshTools/Transform.h"
 
@@ -40,6 +42,13 @@ struct TransformTest: TestSuite::Tester {
 
     void transformPoints2D();
     void transformPoints3D();
+
+    void transformVectorsStrided2D();
+    void transformVectorsStrided3D();
+    void transformNormalsStrided();
+    void transformPointsStrided2D();
+    void transformPointsStrided3D();
+    void transformPointsStridedManyItems();
 };
 
 TransformTest::TransformTest() {
@@ -47,7 +56,14 @@ TransformTest::TransformTest() {
               &TransformTest::transformVectors3D,
 
               &TransformTest::transformPoints2D,
-              &TransformTest::transformPoints3D});
+              &TransformTest::transformPoints3D,
+
+              &TransformTest::transformVectorsStrided2D,
+              &TransformTest::transformVectorsStrided3D,
+              &TransformTest::transformNormalsStrided,
+              &TransformTest::transformPointsStrided2D,
+              &TransformTest::transformPointsStrided3D,
+              &TransformTest::transformPointsStridedManyItems});
 }
 
 constexpr static std::array<Vector2, 2> points2D{{
@@ -116,6 +132,87 @@ void TransformTest::transformPoints3D() {
     CORRADE_COMPARE(quaternion, points3DRotatedTranslated);
 }
 
+namespace {
+    template<class T> struct Vertex {
+        T position;
+        Float padding;
+    };
+
+    template<class T> std::array<Vertex<T>, 2> interleave(const std::array<T, 2>& data) {
+        return {{{data[0], 1337.0f}, {data[1], 1337.0f}}};
+    }
+
+    template<class T> Containers::StridedArrayView<T> positions(std::array<Vertex<T>, 2>& data) {
+        return {&data[0].position, data.size(), sizeof(Vertex<T>)};
+    }
+}
+
+void TransformTest::transformVectorsStrided2D() {
+    auto data = interleave(points2D);
+    MeshTools::transformVectorsInPlace(Matrix3::translation(Vector2::yAxis(-1.0f))*Matrix3::rotation(Deg(90.0f)), positions(data));
+
+    CORRADE_COMPARE(data[0].position, points2DRotated[0]);
+    CORRADE_COMPARE(data[1].position, points2DRotated[1]);
+    CORRADE_COMPARE(data[0].padding, 1337.0f);
+    CORRADE_COMPARE(data[1].padding, 1337.0f);
+}
+
+void TransformTest::transformVectorsStrided3D() {
+    auto data = interleave(points3D);
+    MeshTools::transformVectorsInPlace(Matrix4::translation(Vector3::yAxis(-1.0f))*Matrix4::rotationZ(Deg(90.0f)), positions(data));
+
+    CORRADE_COMPARE(data[0].position, points3DRotated[0]);
+    CORRADE_COMPARE(data[1].position, points3DRotated[1]);
+    CORRADE_COMPARE(data[0].padding, 1337.0f);
+    CORRADE_COMPARE(data[1].padding, 1337.0f);
+}
+
+void TransformTest::transformNormalsStrided() {
+    /* Normal of a 45° slope, the zero vector should stay untouched */
+    std::array<Vertex<Vector3>, 2> data{{
+        {Vector3{1.0f, 1.0f, 0.0f}.normalized(), 1337.0f},
+        {{}, 1337.0f}
+    }};
+
+    /* After scaling the slope is 2:1 in X, so the normal is 1:2 */
+    MeshTools::transformNormalsInPlace(Matrix4::translation({5.0f, 3.0f, 1.0f})*Matrix4::scaling({2.0f, 1.0f, 1.0f}), positions(data));
+    CORRADE_COMPARE(data[0].position, (Vector3{1.0f, 2.0f, 0.0f}.normalized()));
+    CORRADE_COMPARE(data[1].position, Vector3{});
+    CORRADE_COMPARE(data[0].padding, 1337.0f);
+}
+
+void TransformTest::transformPointsStrided2D() {
+    auto data = interleave(points2D);
+    MeshTools::transformPointsInPlace(Matrix3::translation(Vector2::yAxis(-1.0f))*Matrix3::rotation(Deg(90.0f)), positions(data));
+
+    CORRADE_COMPARE(data[0].position, points2DRotatedTranslated[0]);
+    CORRADE_COMPARE(data[1].position, points2DRotatedTranslated[1]);
+    CORRADE_COMPARE(data[0].padding, 1337.0f);
+    CORRADE_COMPARE(data[1].padding, 1337.0f);
+}
+
+void TransformTest::transformPointsStrided3D() {
+    auto data = interleave(points3D);
+    MeshTools::transformPointsInPlace(Matrix4::translation(Vector3::yAxis(-1.0f))*Matrix4::rotationZ(Deg(90.0f)), positions(data));
+
+    CORRADE_COMPARE(data[0].position, points3DRotatedTranslated[0]);
+    CORRADE_COMPARE(data[1].position, points3DRotatedTranslated[1]);
+    CORRADE_COMPARE(data[0].padding, 1337.0f);
+    CORRADE_COMPARE(data[1].padding, 1337.0f);
+}
+
+void TransformTest::transformPointsStridedManyItems() {
+    /* More than one block, with the last one not full */
+    std::vector<Vector3> points;
+    for(std::size_t i = 0; i != 37; ++i)
+        points.emplace_back(Float(i), -Float(i)*0.5f, 3.0f);
+
+    const Matrix4 transformation = Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationX(Deg(35.0f))*Matrix4::scaling({2.0f, 0.5f, 1.0f});
+    std::vector<Vector3> expected = MeshTools::transformPoints(transformation, points);
+    MeshTools::transformPointsInPlace(transformation, Containers::StridedArrayView<Vector3>{points.data(), points.size(), sizeof(Vector3)});
+    CORRADE_COMPARE(points, expected);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformTest)
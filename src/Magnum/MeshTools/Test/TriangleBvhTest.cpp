@@ -0,0 +1,300 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/TriangleBvh.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct TriangleBvhTest: TestSuite::Tester {
+    explicit TriangleBvhTest();
+
+    void empty();
+    void closestHit();
+    void closestHitMaxDistance();
+    void anyHit();
+    void grid();
+    void gridMultithreaded();
+    void closestHits();
+    void anyHits();
+
+    void invalidIndexCount();
+    void batchInvalidSize();
+};
+
+namespace {
+    /* Quads in the XY plane, triangle 2*(y*size + x) is in the lower right
+       half of quad (x, y) and 2*(y*size + x) + 1 in the upper left */
+    void grid(const UnsignedInt size, std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+        for(UnsignedInt y = 0; y <= size; ++y)
+            for(UnsignedInt x = 0; x <= size; ++x)
+                positions.emplace_back(Float(x), Float(y), 0.0f);
+        for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+            const UnsignedInt i = y*(size + 1) + x;
+            indices.insert(indices.end(), {i, i + 1, i + size + 2, i, i + size + 2, i + size + 1});
+        }
+    }
+
+    /* Two quads above each other, the upper one is listed second */
+    const std::vector<UnsignedInt> StackedIndices{
+        0, 1, 2, 0, 2, 3,
+        4, 5, 6, 4, 6, 7
+    };
+    const std::vector<Vector3> StackedPositions{
+        {-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f}, {-1.0f, 1.0f, 0.0f},
+        {-1.0f, -1.0f, 2.0f}, {1.0f, -1.0f, 2.0f},
+        {1.0f, 1.0f, 2.0f}, {-1.0f, 1.0f, 2.0f}
+    };
+}
+
+TriangleBvhTest::TriangleBvhTest() {
+    addTests({&TriangleBvhTest::empty,
+              &TriangleBvhTest::closestHit,
+              &TriangleBvhTest::closestHitMaxDistance,
+              &TriangleBvhTest::anyHit,
+              &TriangleBvhTest::grid,
+              &TriangleBvhTest::gridMultithreaded,
+              &TriangleBvhTest::closestHits,
+              &TriangleBvhTest::anyHits,
+
+              &TriangleBvhTest::invalidIndexCount,
+              &TriangleBvhTest::batchInvalidSize});
+}
+
+void TriangleBvhTest::empty() {
+    TriangleBvh bvh{{}, {}};
+    CORRADE_COMPARE(bvh.triangleCount(), 0);
+    CORRADE_COMPARE(bvh.nodeCount(), 0);
+    CORRADE_COMPARE(bvh.depth(), 0);
+    CORRADE_COMPARE(bvh.bounds(), Range3D{});
+    CORRADE_VERIFY(!bvh.closestHit({}, Vector3::zAxis()));
+    CORRADE_VERIFY(!bvh.anyHit({}, Vector3::zAxis()));
+}
+
+void TriangleBvhTest::closestHit() {
+    TriangleBvh bvh{StackedIndices, StackedPositions};
+    CORRADE_COMPARE(bvh.triangleCount(), 4);
+    /* Fits into a single leaf */
+    CORRADE_COMPARE(bvh.nodeCount(), 1);
+    CORRADE_COMPARE(bvh.depth(), 1);
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{{-1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 2.0f}}));
+
+    /* From above */
+    TriangleBvh::Hit hit = bvh.closestHit({0.5f, -0.5f, 5.0f}, {0.0f, 0.0f, -0.5f});
+    CORRADE_VERIFY(hit);
+    CORRADE_COMPARE(hit.triangle, 2);
+    CORRADE_COMPARE(hit.distance, 6.0f);
+    CORRADE_COMPARE(hit.barycentric, (Vector2{0.5f, 0.25f}));
+
+    /* From below, hitting the other side */
+    hit = bvh.closestHit({-0.5f, 0.5f, -1.0f}, Vector3::zAxis());
+    CORRADE_VERIFY(hit);
+    CORRADE_COMPARE(hit.triangle, 1);
+    CORRADE_COMPARE(hit.distance, 1.0f);
+
+    /* From inside */
+    hit = bvh.closestHit({-0.5f, 0.5f, 1.5f}, {0.0f, 0.0f, -1.0f});
+    CORRADE_COMPARE(hit.triangle, 1);
+    CORRADE_COMPARE(hit.distance, 1.5f);
+
+    /* Miss */
+    hit = bvh.closestHit({2.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f});
+    CORRADE_VERIFY(!hit);
+    CORRADE_COMPARE(hit.triangle, 0xffffffffu);
+    CORRADE_COMPARE(hit.distance, Constants::inf());
+
+    /* Pointing away */
+    CORRADE_VERIFY(!bvh.closestHit({0.0f, 0.0f, 3.0f}, Vector3::zAxis()));
+}
+
+void TriangleBvhTest::closestHitMaxDistance() {
+    TriangleBvh bvh{StackedIndices, StackedPositions};
+
+    /* The upper quad is at distance 1, the lower at 3 */
+    CORRADE_VERIFY(!bvh.closestHit({0.5f, -0.5f, 3.0f}, {0.0f, 0.0f, -1.0f}, 1.0f));
+    CORRADE_COMPARE(bvh.closestHit({0.5f, -0.5f, 3.0f}, {0.0f, 0.0f, -1.0f}, 1.1f).triangle, 2);
+
+    /* Rays starting right between the quads */
+    CORRADE_VERIFY(!bvh.closestHit({0.5f, -0.5f, 1.0f}, {0.0f, 0.0f, -1.0f}, 0.5f));
+    CORRADE_COMPARE(bvh.closestHit({0.5f, -0.5f, 1.0f}, {0.0f, 0.0f, -1.0f}, 2.0f).triangle, 0);
+}
+
+void TriangleBvhTest::anyHit() {
+    TriangleBvh bvh{StackedIndices, StackedPositions};
+
+    CORRADE_VERIFY(bvh.anyHit({0.5f, -0.5f, 3.0f}, {0.0f, 0.0f, -1.0f}));
+    CORRADE_VERIFY(bvh.anyHit({0.5f, -0.5f, 3.0f}, {0.0f, 0.0f, -1.0f}, 1.1f));
+    CORRADE_VERIFY(!bvh.anyHit({0.5f, -0.5f, 3.0f}, {0.0f, 0.0f, -1.0f}, 1.0f));
+    CORRADE_VERIFY(!bvh.anyHit({2.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}));
+}
+
+void TriangleBvhTest::grid() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    Test::grid(50, indices, positions);
+
+    TriangleBvh bvh{indices, positions};
+    CORRADE_COMPARE(bvh.triangleCount(), 5000);
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{{}, {50.0f, 50.0f, 0.0f}}));
+    CORRADE_VERIFY(bvh.nodeCount() > 5000/4);
+    /* Nodes are split in half at most, so each inner node has two children
+       and leafs have at most four triangles */
+    CORRADE_COMPARE(bvh.nodeCount() % 2, 1);
+    CORRADE_VERIFY(bvh.depth() >= 11);
+    CORRADE_VERIFY(bvh.depth() <= 64);
+
+    for(UnsignedInt y = 0; y < 50; y += 7) for(UnsignedInt x = 0; x < 50; x += 3) {
+        TriangleBvh::Hit hit = bvh.closestHit({x + 0.75f, y + 0.25f, 2.0f}, {0.0f, 0.0f, -1.0f});
+        CORRADE_COMPARE(hit.triangle, 2*(y*50 + x));
+        CORRADE_COMPARE(hit.distance, 2.0f);
+        CORRADE_COMPARE(hit.barycentric, (Vector2{0.5f, 0.25f}));
+
+        /* Slanted from below */
+        hit = bvh.closestHit({x + 0.25f - 1.0f, y + 0.75f - 2.0f, -1.0f}, {1.0f, 2.0f, 1.0f});
+        CORRADE_COMPARE(hit.triangle, 2*(y*50 + x) + 1);
+        CORRADE_COMPARE(hit.distance, 1.0f);
+    }
+
+    /* Parallel to the grid */
+    CORRADE_VERIFY(!bvh.closestHit({-1.0f, 0.5f, 0.0f}, Vector3::xAxis()));
+}
+
+void TriangleBvhTest::gridMultithreaded() {
+    /* Large enough to be built on multiple threads */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    Test::grid(200, indices, positions);
+
+    TriangleBvh single{indices, positions};
+    TriangleBvh multi{indices, positions, 4};
+    CORRADE_COMPARE(multi.triangleCount(), 80000);
+    CORRADE_COMPARE(multi.nodeCount(), single.nodeCount());
+    CORRADE_COMPARE(multi.depth(), single.depth());
+    CORRADE_COMPARE(multi.bounds(), (Range3D{{}, {200.0f, 200.0f, 0.0f}}));
+
+    for(UnsignedInt y = 0; y < 200; y += 13) for(UnsignedInt x = 0; x < 200; x += 11) {
+        const TriangleBvh::Hit hit = multi.closestHit({x + 0.25f, y + 0.75f, 1.0f}, {0.0f, 0.0f, -1.0f});
+        CORRADE_COMPARE(hit.triangle, 2*(y*200 + x) + 1);
+        CORRADE_COMPARE(hit.distance, 1.0f);
+    }
+}
+
+void TriangleBvhTest::closestHits() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    Test::grid(20, indices, positions);
+    TriangleBvh bvh{indices, positions};
+
+    /* 21 rays to have an incomplete packet at the end, every third misses */
+    std::vector<Vector3> origins;
+    std::vector<Vector3> directions;
+    for(UnsignedInt i = 0; i != 21; ++i) {
+        origins.emplace_back(i + 0.5f, (i*7 % 20) + 0.25f, i % 3 == 2 ? -1.0f : 3.0f);
+        directions.emplace_back(0.1f, 0.0f, -1.0f);
+    }
+
+    std::vector<TriangleBvh::Hit> hits(21);
+    const Containers::StridedArrayView<const Vector3> originView{origins.data(), origins.size(), sizeof(Vector3)};
+    const Containers::StridedArrayView<const Vector3> directionView{directions.data(), directions.size(), sizeof(Vector3)};
+    bvh.closestHits(originView, directionView, {hits.data(), hits.size()});
+    for(UnsignedInt i = 0; i != 21; ++i) {
+        const TriangleBvh::Hit expected = bvh.closestHit(origins[i], directions[i]);
+        CORRADE_COMPARE(bool(hits[i]), i % 3 != 2);
+        CORRADE_COMPARE(hits[i].triangle, expected.triangle);
+        CORRADE_COMPARE(hits[i].distance, expected.distance);
+        CORRADE_COMPARE(hits[i].barycentric, expected.barycentric);
+    }
+
+    /* Max distance */
+    bvh.closestHits(originView, directionView, {hits.data(), hits.size()}, 2.5f);
+    for(UnsignedInt i = 0; i != 21; ++i) {
+        CORRADE_VERIFY(!hits[i]);
+    }
+}
+
+void TriangleBvhTest::anyHits() {
+    TriangleBvh bvh{StackedIndices, StackedPositions};
+
+    /* Every other ray misses, last is in an incomplete packet */
+    std::vector<Vector3> origins;
+    std::vector<Vector3> directions;
+    for(UnsignedInt i = 0; i != 11; ++i) {
+        origins.emplace_back(-0.95f + i*0.1f, i % 2 ? 5.0f : 0.0f, 5.0f);
+        directions.emplace_back(0.0f, 0.0f, -1.0f);
+    }
+
+    const Containers::StridedArrayView<const Vector3> originView{origins.data(), origins.size(), sizeof(Vector3)};
+    const Containers::StridedArrayView<const Vector3> directionView{directions.data(), directions.size(), sizeof(Vector3)};
+    UnsignedByte hits[]{0xff, 0xff, 0xff};
+    bvh.anyHits(originView, directionView, hits);
+    CORRADE_COMPARE(hits[0], 0x55);
+    CORRADE_COMPARE(hits[1], 0x05);
+    /* Untouched */
+    CORRADE_COMPARE(hits[2], 0xff);
+
+    /* Max distance */
+    bvh.anyHits(originView, directionView, hits, 3.0f);
+    CORRADE_COMPARE(hits[0], 0x00);
+    CORRADE_COMPARE(hits[1], 0x00);
+}
+
+void TriangleBvhTest::invalidIndexCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    TriangleBvh bvh{{0, 1}, {{}, {}}};
+    CORRADE_COMPARE(bvh.nodeCount(), 0);
+    CORRADE_COMPARE(out.str(), "MeshTools::TriangleBvh: index count is not divisible by 3\n");
+}
+
+void TriangleBvhTest::batchInvalidSize() {
+    TriangleBvh bvh{StackedIndices, StackedPositions};
+    const Vector3 data[3];
+    const Containers::StridedArrayView<const Vector3> origins{data, 3, sizeof(Vector3)};
+    const Containers::StridedArrayView<const Vector3> directions{data, 2, sizeof(Vector3)};
+    TriangleBvh::Hit hits[2];
+    UnsignedByte mask[1];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    bvh.closestHits(origins, directions, hits);
+    bvh.closestHits(origins, origins, hits);
+    bvh.anyHits(origins, directions, mask);
+    bvh.anyHits(origins, origins, nullptr);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::TriangleBvh::closestHits(): expected the same count of origins and directions, got 3 and 2\n"
+        "MeshTools::TriangleBvh::closestHits(): expected 3 hits but got 2\n"
+        "MeshTools::TriangleBvh::anyHits(): expected the same count of origins and directions, got 3 and 2\n"
+        "MeshTools::TriangleBvh::anyHits(): expected at least 1 bytes for 3 results but got 0\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TriangleBvhTest)
@@ -0,0 +1,119 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Transform.h"
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Count of items transposed to SoA at once. The calculation is always done on
+   the whole block so it has a fixed trip count, the unused tail of the last
+   block contains leftovers from the previous one. */
+constexpr std::size_t BlockSize = 16;
+
+/* Columns of the linear part followed by the translation, which is zero for
+   vectors */
+template<std::size_t dimensions, class VectorType> void transformInPlace(const Float(&matrix)[dimensions + 1][dimensions], const Containers::StridedArrayView<VectorType>& data, const bool normalize) {
+    Float in[dimensions][BlockSize]{};
+    Float out[dimensions][BlockSize];
+
+    for(std::size_t offset = 0; offset < data.size(); offset += BlockSize) {
+        const std::size_t count = Math::min(data.size() - offset, BlockSize);
+
+        for(std::size_t i = 0; i != count; ++i) {
+            const VectorType& vector = data[offset + i];
+            for(std::size_t j = 0; j != dimensions; ++j)
+                in[j][i] = vector[j];
+        }
+
+        for(std::size_t j = 0; j != dimensions; ++j) {
+            for(std::size_t i = 0; i != BlockSize; ++i)
+                out[j][i] = matrix[dimensions][j];
+            for(std::size_t k = 0; k != dimensions; ++k)
+                for(std::size_t i = 0; i != BlockSize; ++i)
+                    out[j][i] += matrix[k][j]*in[k][i];
+        }
+
+        if(normalize) for(std::size_t i = 0; i != BlockSize; ++i) {
+            Float lengthSquared = 0.0f;
+            for(std::size_t j = 0; j != dimensions; ++j)
+                lengthSquared += out[j][i]*out[j][i];
+            const Float scale = lengthSquared == 0.0f ? 1.0f : 1.0f/std::sqrt(lengthSquared);
+            for(std::size_t j = 0; j != dimensions; ++j)
+                out[j][i] *= scale;
+        }
+
+        for(std::size_t i = 0; i != count; ++i) {
+            VectorType& vector = data[offset + i];
+            for(std::size_t j = 0; j != dimensions; ++j)
+                vector[j] = out[j][i];
+        }
+    }
+}
+
+void transformInPlace(const Matrix4& matrix, const Containers::StridedArrayView<Vector3>& data, const bool translate, const bool normalize) {
+    Float columns[4][3];
+    for(std::size_t i = 0; i != 4; ++i)
+        for(std::size_t j = 0; j != 3; ++j)
+            columns[i][j] = i == 3 && !translate ? 0.0f : matrix[i][j];
+    transformInPlace<3>(columns, data, normalize);
+}
+
+void transformInPlace(const Matrix3& matrix, const Containers::StridedArrayView<Vector2>& data, const bool translate) {
+    Float columns[3][2];
+    for(std::size_t i = 0; i != 3; ++i)
+        for(std::size_t j = 0; j != 2; ++j)
+            columns[i][j] = i == 2 && !translate ? 0.0f : matrix[i][j];
+    transformInPlace<2>(columns, data, false);
+}
+
+}
+
+void transformVectorsInPlace(const Matrix4& matrix, const Containers::StridedArrayView<Vector3> vectors) {
+    transformInPlace(matrix, vectors, false, false);
+}
+
+void transformVectorsInPlace(const Matrix3& matrix, const Containers::StridedArrayView<Vector2> vectors) {
+    transformInPlace(matrix, vectors, false);
+}
+
+void transformNormalsInPlace(const Matrix4& matrix, const Containers::StridedArrayView<Vector3> normals) {
+    transformInPlace(Matrix4::from(matrix.rotationScaling().inverted().transposed(), {}), normals, false, true);
+}
+
+void transformPointsInPlace(const Matrix4& matrix, const Containers::StridedArrayView<Vector3> points) {
+    transformInPlace(matrix, points, true, false);
+}
+
+void transformPointsInPlace(const Matrix3& matrix, const Containers::StridedArrayView<Vector2> points) {
+    transformInPlace(matrix, points, true);
+}
+
+}}
@@ -26,11 +26,15 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::transformVectorsInPlace(), @ref Magnum::MeshTools::transformVectors(), @ref Magnum::MeshTools::transformPointsInPlace(), @ref Magnum::MeshTools::transformPoints()
+ * @brief Function @ref Magnum::MeshTools::transformVectorsInPlace(), @ref Magnum::MeshTools::transformVectors(), @ref Magnum::MeshTools::transformPointsInPlace(), @ref Magnum::MeshTools::transformPoints(), @ref Magnum::MeshTools::transformNormalsInPlace()
  */
 
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
 #include "Magnum/Math/DualQuaternion.h"
 #include "Magnum/Math/DualComplex.h"
+#include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -74,6 +78,32 @@ template<class T, class U> void transformVectorsInPlace(const Math::Quaternion<T
     for(auto& vector: vectors) vector = normalizedQuaternion.transformVectorNormalized(vector);
 }
 
+/**
+@brief Transform a strided array of vectors in-place using given matrix
+
+Equivalent to @ref transformVectorsInPlace(const Math::Matrix4<T>&, U&), but
+operating on a strided view, so for example tangents can be transformed
+directly inside an interleaved vertex buffer. The data are processed in blocks
+that are transposed to a structure-of-arrays layout first, which allows the
+compiler to vectorize the actual calculation. Note that the vectors are not
+renormalized afterwards, use @ref transformNormalsInPlace() for normals.
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const Matrix4& matrix, Containers::StridedArrayView<Vector3> vectors);
+
+/** @overload */
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const Matrix3& matrix, Containers::StridedArrayView<Vector2> vectors);
+
+/**
+@brief Transform a strided array of normals in-place using given matrix
+
+Transforms the normals with the inverse transpose of the rotation and scaling
+part of @p matrix and renormalizes them, so the normals stay perpendicular to
+the surface even with non-uniform scaling. Zero vectors are left unchanged.
+Uses the same block-wise processing as
+@ref transformVectorsInPlace(const Matrix4&, Containers::StridedArrayView<Vector3>).
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformNormalsInPlace(const Matrix4& matrix, Containers::StridedArrayView<Vector3> normals);
+
 /**
 @brief Transform vectors using given transformation
 
@@ -125,6 +155,20 @@ template<class T, class U> void transformPointsInPlace(const Math::DualQuaternio
     for(auto& point: points) point = normalizedDualQuaternion.transformPointNormalized(point);
 }
 
+/**
+@brief Transform a strided array of points in-place using given matrix
+
+Equivalent to @ref transformPointsInPlace(const Math::Matrix4<T>&, U&), but
+operating on a strided view, so for example positions can be transformed
+directly inside an interleaved vertex buffer. The data are processed in blocks
+that are transposed to a structure-of-arrays layout first, which allows the
+compiler to vectorize the actual calculation.
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const Matrix4& matrix, Containers::StridedArrayView<Vector3> points);
+
+/** @overload */
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const Matrix3& matrix, Containers::StridedArrayView<Vector2> points);
+
 /**
 @brief Transform points using given transformation
 
@@ -0,0 +1,600 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TriangleBvh.h"
+
+#include <algorithm>
+#include <numeric>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+typedef Implementation::TriangleBvhNode Node;
+typedef Implementation::TriangleBvhTriangle Triangle;
+
+/* Below this triangle count the hierarchy is always built on the calling
+   thread, as the overhead would outweigh the gains */
+constexpr std::size_t ParallelThreshold = 65536;
+
+/* Triangle count processed by a single task when calculating the triangle
+   bounds */
+constexpr std::size_t ChunkSize = 16384;
+
+/* Max triangle count in a leaf and count of bins in which the surface area
+   heuristic is evaluated */
+constexpr UnsignedInt MaxLeafSize = 4;
+constexpr UnsignedInt BinCount = 16;
+
+/* Subtrees rooted at this depth are built in parallel. It doesn't depend on
+   the thread count, so the hierarchy is always the same. */
+constexpr UnsignedInt TaskDepth = 6;
+
+/* From this depth on the nodes are split in the median, so the tree depth is
+   at most MedianSplitDepth + log2(triangle count) and the traversal stack can
+   have a fixed size */
+constexpr UnsignedInt MedianSplitDepth = 30;
+constexpr UnsignedInt MaxDepth = 64;
+
+Float halfArea(const Vector3& min, const Vector3& max) {
+    const Vector3 size = max - min;
+    return size.x()*size.y() + size.y()*size.z() + size.z()*size.x();
+}
+
+/* Subtree deferred to be built in parallel */
+struct Task {
+    UnsignedInt node, begin, end;
+};
+
+struct Builder {
+    /* Splits given range of triangles, returns the split position or end if
+       the range should be a leaf */
+    UnsignedInt split(UnsignedInt begin, UnsignedInt end, UnsignedInt depth, Range3D& nodeBounds) const;
+
+    /* Builds a subtree into given node. If tasks are not null, subtrees at
+       TaskDepth are not built but recorded for later. Returns the max depth
+       of built nodes. */
+    UnsignedInt build(std::vector<Node>& nodes, std::vector<Task>* tasks, UnsignedInt root, UnsignedInt begin, UnsignedInt end, UnsignedInt depth) const;
+
+    const Range3D* triangleBounds;
+    const Vector3* centroids;
+    UnsignedInt* order;
+};
+
+UnsignedInt Builder::split(const UnsignedInt begin, const UnsignedInt end, const UnsignedInt depth, Range3D& nodeBounds) const {
+    Vector3 min = triangleBounds[order[begin]].min();
+    Vector3 max = triangleBounds[order[begin]].max();
+    Vector3 centroidMin = centroids[order[begin]];
+    Vector3 centroidMax = centroidMin;
+    for(UnsignedInt i = begin + 1; i != end; ++i) {
+        const UnsignedInt triangle = order[i];
+        min = Math::min(min, triangleBounds[triangle].min());
+        max = Math::max(max, triangleBounds[triangle].max());
+        centroidMin = Math::min(centroidMin, centroids[triangle]);
+        centroidMax = Math::max(centroidMax, centroids[triangle]);
+    }
+    nodeBounds = {min, max};
+
+    const UnsignedInt count = end - begin;
+    if(count <= MaxLeafSize) return end;
+
+    /* Split along the axis with the largest centroid extent. If all
+       centroids are the same, split arbitrarily in half. */
+    const Vector3 extent = centroidMax - centroidMin;
+    const std::size_t axis = extent.x() >= extent.y() ?
+        (extent.x() >= extent.z() ? 0 : 2) : (extent.y() >= extent.z() ? 1 : 2);
+    if(extent[axis] == 0.0f) return begin + count/2;
+
+    const auto medianSplit = [&]() {
+        const UnsignedInt mid = begin + count/2;
+        std::nth_element(order + begin, order + mid, order + end, [&](const UnsignedInt a, const UnsignedInt b) {
+            return centroids[a][axis] < centroids[b][axis];
+        });
+        return mid;
+    };
+    if(depth >= MedianSplitDepth) return medianSplit();
+
+    /* Put the triangles into bins by their centroid */
+    const Float scale = BinCount/extent[axis];
+    const auto bin = [&](const UnsignedInt triangle) {
+        return Math::min(UnsignedInt((centroids[triangle][axis] - centroidMin[axis])*scale), BinCount - 1);
+    };
+    Vector3 binMin[BinCount];
+    Vector3 binMax[BinCount];
+    UnsignedInt binCount[BinCount]{};
+    for(UnsignedInt i = begin; i != end; ++i) {
+        const UnsignedInt triangle = order[i];
+        const UnsignedInt b = bin(triangle);
+        if(binCount[b]) {
+            binMin[b] = Math::min(binMin[b], triangleBounds[triangle].min());
+            binMax[b] = Math::max(binMax[b], triangleBounds[triangle].max());
+        } else {
+            binMin[b] = triangleBounds[triangle].min();
+            binMax[b] = triangleBounds[triangle].max();
+        }
+        ++binCount[b];
+    }
+
+    /* Sweep from the right to get cost of the right side for a split after
+       each bin */
+    Float rightCost[BinCount - 1];
+    UnsignedInt rightCount[BinCount - 1];
+    {
+        Vector3 sideMin, sideMax;
+        UnsignedInt sideCount = 0;
+        for(UnsignedInt i = BinCount - 1; i != 0; --i) {
+            if(binCount[i]) {
+                sideMin = sideCount ? Math::min(sideMin, binMin[i]) : binMin[i];
+                sideMax = sideCount ? Math::max(sideMax, binMax[i]) : binMax[i];
+                sideCount += binCount[i];
+            }
+            rightCount[i - 1] = sideCount;
+            rightCost[i - 1] = sideCount ? sideCount*halfArea(sideMin, sideMax) : 0.0f;
+        }
+    }
+
+    /* Sweep from the left and pick the cheapest split with both sides
+       non-empty */
+    UnsignedInt best = BinCount;
+    {
+        Float bestCost = Constants::inf();
+        Vector3 sideMin, sideMax;
+        UnsignedInt sideCount = 0;
+        for(UnsignedInt i = 0; i != BinCount - 1; ++i) {
+            if(binCount[i]) {
+                sideMin = sideCount ? Math::min(sideMin, binMin[i]) : binMin[i];
+                sideMax = sideCount ? Math::max(sideMax, binMax[i]) : binMax[i];
+                sideCount += binCount[i];
+            }
+            if(!sideCount || !rightCount[i]) continue;
+
+            const Float cost = sideCount*halfArea(sideMin, sideMax) + rightCost[i];
+            if(cost < bestCost) {
+                bestCost = cost;
+                best = i;
+            }
+        }
+    }
+    if(best == BinCount) return medianSplit();
+
+    return UnsignedInt(std::partition(order + begin, order + end, [&](const UnsignedInt triangle) {
+        return bin(triangle) <= best;
+    }) - order);
+}
+
+UnsignedInt Builder::build(std::vector<Node>& nodes, std::vector<Task>* const tasks, const UnsignedInt root, const UnsignedInt begin, const UnsignedInt end, const UnsignedInt depth) const {
+    struct Entry {
+        UnsignedInt node, begin, end, depth;
+    };
+
+    /* Explicit stack, as the tree can get too deep for recursion */
+    std::vector<Entry> stack{Entry{root, begin, end, depth}};
+    UnsignedInt maxDepth = depth;
+    while(!stack.empty()) {
+        const Entry entry = stack.back();
+        stack.pop_back();
+
+        if(tasks && entry.depth == TaskDepth) {
+            tasks->push_back({entry.node, entry.begin, entry.end});
+            continue;
+        }
+
+        maxDepth = Math::max(maxDepth, entry.depth);
+
+        Range3D nodeBounds;
+        const UnsignedInt mid = split(entry.begin, entry.end, entry.depth, nodeBounds);
+        nodes[entry.node].bounds = nodeBounds;
+
+        if(mid == entry.end) {
+            nodes[entry.node].offset = entry.begin;
+            nodes[entry.node].count = entry.end - entry.begin;
+            continue;
+        }
+
+        /* Visiting the left child first, so it's also laid out first */
+        const UnsignedInt child = nodes.size();
+        nodes[entry.node].offset = child;
+        nodes[entry.node].count = 0;
+        nodes.resize(child + 2);
+        stack.push_back({child + 1, mid, entry.end, entry.depth + 1});
+        stack.push_back({child, entry.begin, mid, entry.depth + 1});
+    }
+
+    return maxDepth;
+}
+
+/* Slab test, returns the distance where the ray enters the box or infinity
+   if it misses the box */
+inline Float intersectNode(const Range3D& bounds, const Vector3& origin, const Vector3& inverseDirection, const Float maxDistance) {
+    Float entry = 0.0f;
+    Float exit = maxDistance;
+    for(std::size_t i = 0; i != 3; ++i) {
+        const Float a = (bounds.min()[i] - origin[i])*inverseDirection[i];
+        const Float b = (bounds.max()[i] - origin[i])*inverseDirection[i];
+        entry = Math::max(entry, Math::min(a, b));
+        exit = Math::min(exit, Math::max(a, b));
+    }
+
+    return entry <= exit ? entry : Constants::inf();
+}
+
+/* Möller-Trumbore intersection, from both sides. Returns true if the hit is
+   in [0, maxDistance). */
+inline bool intersectTriangle(const Triangle& triangle, const Vector3& origin, const Vector3& direction, const Float maxDistance, Float& distance, Vector2& barycentric) {
+    const Vector3 p = Math::cross(direction, triangle.edge2);
+    const Float determinant = Math::dot(triangle.edge1, p);
+    if(determinant == 0.0f) return false;
+
+    const Float inverseDeterminant = 1.0f/determinant;
+    const Vector3 s = origin - triangle.a;
+    const Float u = Math::dot(s, p)*inverseDeterminant;
+    if(u < 0.0f || u > 1.0f) return false;
+
+    const Vector3 q = Math::cross(s, triangle.edge1);
+    const Float v = Math::dot(direction, q)*inverseDeterminant;
+    if(v < 0.0f || u + v > 1.0f) return false;
+
+    const Float t = Math::dot(triangle.edge2, q)*inverseDeterminant;
+    if(t < 0.0f || t >= maxDistance) return false;
+
+    distance = t;
+    barycentric = {u, v};
+    return true;
+}
+
+template<bool any> bool traverse(const std::vector<Node>& nodes, const std::vector<Triangle>& triangles, const Vector3& origin, const Vector3& direction, Float maxDistance, TriangleBvh::Hit& hit) {
+    const Vector3 inverseDirection = 1.0f/direction;
+    if(nodes.empty() || intersectNode(nodes[0].bounds, origin, inverseDirection, maxDistance) == Constants::inf())
+        return false;
+
+    /* Nodes left to visit together with the distance where the ray enters
+       them. Each inner node on the path adds at most one, so the depth is
+       enough. */
+    UnsignedInt stack[MaxDepth];
+    Float stackDistances[MaxDepth];
+    std::size_t stackSize = 0;
+
+    bool found = false;
+    for(UnsignedInt current = 0; ; ) {
+        const Node& node = nodes[current];
+        if(node.count) {
+            for(UnsignedInt i = node.offset, end = node.offset + node.count; i != end; ++i) {
+                if(!intersectTriangle(triangles[i], origin, direction, maxDistance, hit.distance, hit.barycentric))
+                    continue;
+
+                hit.triangle = triangles[i].id;
+                if(any) return true;
+                maxDistance = hit.distance;
+                found = true;
+            }
+
+        /* Continue to the nearer child, remember the other for later */
+        } else {
+            const Float first = intersectNode(nodes[node.offset].bounds, origin, inverseDirection, maxDistance);
+            const Float second = intersectNode(nodes[node.offset + 1].bounds, origin, inverseDirection, maxDistance);
+            if(first != Constants::inf() && second != Constants::inf()) {
+                const bool secondNearer = second < first;
+                stack[stackSize] = node.offset + !secondNearer;
+                stackDistances[stackSize] = secondNearer ? first : second;
+                ++stackSize;
+                current = node.offset + secondNearer;
+                continue;
+            }
+            if(first != Constants::inf()) {
+                current = node.offset;
+                continue;
+            }
+            if(second != Constants::inf()) {
+                current = node.offset + 1;
+                continue;
+            }
+        }
+
+        /* Take the next node that can still contain a closer hit */
+        do {
+            if(!stackSize) return found;
+            --stackSize;
+        } while(stackDistances[stackSize] >= maxDistance);
+        current = stack[stackSize];
+    }
+}
+
+/* Packet of eight rays in a structure-of-arrays layout. Unused rays and rays
+   that already have a hit in an any-hit query have a negative max distance,
+   so no node or triangle test can pass for them. */
+struct Packet {
+    Float origin[3][8];
+    Float direction[3][8];
+    Float inverseDirection[3][8];
+    Float maxDistance[8];
+    Float u[8], v[8];
+    UnsignedInt triangle[8];
+};
+
+void fillPacket(Packet& packet, const Containers::StridedArrayView<const Vector3>& origins, const Containers::StridedArrayView<const Vector3>& directions, const std::size_t offset, const std::size_t count, const Float maxDistance) {
+    for(std::size_t i = 0; i != 8; ++i) {
+        const bool used = i < count;
+        const Vector3 origin = used ? origins[offset + i] : Vector3{};
+        const Vector3 direction = used ? directions[offset + i] : Vector3{};
+        for(std::size_t j = 0; j != 3; ++j) {
+            packet.origin[j][i] = origin[j];
+            packet.direction[j][i] = direction[j];
+            packet.inverseDirection[j][i] = used ? 1.0f/direction[j] : 0.0f;
+        }
+        packet.maxDistance[i] = used ? maxDistance : -1.0f;
+        packet.u[i] = packet.v[i] = 0.0f;
+        packet.triangle[i] = ~UnsignedInt{};
+    }
+}
+
+/* Same as the scalar variant, returns the smallest entry distance of all
+   rays. The axes are written out so the loop over rays has no dependencies
+   between iterations and can be vectorized. */
+inline Float intersectNode(const Range3D& bounds, const Packet& packet) {
+    const Vector3& min = bounds.min();
+    const Vector3& max = bounds.max();
+    Float distances[8];
+    for(std::size_t i = 0; i != 8; ++i) {
+        const Float ax = (min.x() - packet.origin[0][i])*packet.inverseDirection[0][i];
+        const Float bx = (max.x() - packet.origin[0][i])*packet.inverseDirection[0][i];
+        const Float ay = (min.y() - packet.origin[1][i])*packet.inverseDirection[1][i];
+        const Float by = (max.y() - packet.origin[1][i])*packet.inverseDirection[1][i];
+        const Float az = (min.z() - packet.origin[2][i])*packet.inverseDirection[2][i];
+        const Float bz = (max.z() - packet.origin[2][i])*packet.inverseDirection[2][i];
+        const Float entry = Math::max(Math::max(Math::max(0.0f, Math::min(ax, bx)), Math::min(ay, by)), Math::min(az, bz));
+        const Float exit = Math::min(Math::min(Math::min(packet.maxDistance[i], Math::max(ax, bx)), Math::max(ay, by)), Math::max(az, bz));
+        distances[i] = entry <= exit ? entry : Constants::inf();
+    }
+
+    Float nearest = distances[0];
+    for(std::size_t i = 1; i != 8; ++i)
+        nearest = Math::min(nearest, distances[i]);
+    return nearest;
+}
+
+/* Same as the scalar variant, with the operations written out so the loop
+   has no branches and can be vectorized */
+template<bool any> inline void intersectTriangle(const Triangle& triangle, Packet& packet) {
+    /* Copies so the compiler doesn't need to care about aliasing */
+    const Vector3 a = triangle.a;
+    const Vector3 e1 = triangle.edge1;
+    const Vector3 e2 = triangle.edge2;
+    const UnsignedInt id = triangle.id;
+    for(std::size_t i = 0; i != 8; ++i) {
+        const Float dx = packet.direction[0][i];
+        const Float dy = packet.direction[1][i];
+        const Float dz = packet.direction[2][i];
+        const Float px = dy*e2.z() - e2.y()*dz;
+        const Float py = dz*e2.x() - e2.z()*dx;
+        const Float pz = dx*e2.y() - e2.x()*dy;
+        const Float determinant = e1.x()*px + e1.y()*py + e1.z()*pz;
+        const Float inverseDeterminant = 1.0f/determinant;
+
+        const Float sx = packet.origin[0][i] - a.x();
+        const Float sy = packet.origin[1][i] - a.y();
+        const Float sz = packet.origin[2][i] - a.z();
+        const Float u = (sx*px + sy*py + sz*pz)*inverseDeterminant;
+
+        const Float qx = sy*e1.z() - e1.y()*sz;
+        const Float qy = sz*e1.x() - e1.z()*sx;
+        const Float qz = sx*e1.y() - e1.x()*sy;
+        const Float v = (dx*qx + dy*qy + dz*qz)*inverseDeterminant;
+        const Float t = (e2.x()*qx + e2.y()*qy + e2.z()*qz)*inverseDeterminant;
+
+        /* Not short-circuiting to avoid branches */
+        const bool hit = (determinant != 0.0f) & (u >= 0.0f) & (u <= 1.0f) &
+            (v >= 0.0f) & (u + v <= 1.0f) & (t >= 0.0f) & (t < packet.maxDistance[i]);
+        packet.maxDistance[i] = hit ? (any ? -1.0f : t) : packet.maxDistance[i];
+        packet.u[i] = hit ? u : packet.u[i];
+        packet.v[i] = hit ? v : packet.v[i];
+        packet.triangle[i] = hit ? id : packet.triangle[i];
+    }
+}
+
+template<bool any> void traverse(const std::vector<Node>& nodes, const std::vector<Triangle>& triangles, Packet& packet) {
+    if(nodes.empty() || intersectNode(nodes[0].bounds, packet) == Constants::inf())
+        return;
+
+    /* Same as the scalar variant, except that the nodes are tested again when
+       taken from the stack, as the distances differ for each ray */
+    UnsignedInt stack[MaxDepth];
+    std::size_t stackSize = 0;
+    for(UnsignedInt current = 0; ; ) {
+        const Node& node = nodes[current];
+        if(node.count) {
+            for(UnsignedInt i = node.offset, end = node.offset + node.count; i != end; ++i)
+                intersectTriangle<any>(triangles[i], packet);
+
+            /* Stop if all rays already have a hit */
+            if(any) {
+                bool done = true;
+                for(std::size_t i = 0; i != 8; ++i)
+                    done = done && packet.maxDistance[i] < 0.0f;
+                if(done) return;
+            }
+
+        } else {
+            const Float first = intersectNode(nodes[node.offset].bounds, packet);
+            const Float second = intersectNode(nodes[node.offset + 1].bounds, packet);
+            if(first != Constants::inf() && second != Constants::inf()) {
+                const bool secondNearer = second < first;
+                stack[stackSize++] = node.offset + !secondNearer;
+                current = node.offset + secondNearer;
+                continue;
+            }
+            if(first != Constants::inf()) {
+                current = node.offset;
+                continue;
+            }
+            if(second != Constants::inf()) {
+                current = node.offset + 1;
+                continue;
+            }
+        }
+
+        do {
+            if(!stackSize) return;
+            current = stack[--stackSize];
+        } while(intersectNode(nodes[current].bounds, packet) == Constants::inf());
+    }
+}
+
+}
+
+TriangleBvh::TriangleBvh(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::TriangleBvh: index count is not divisible by 3", );
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    const UnsignedInt buildThreadCount = triangleCount < ParallelThreshold ? 1 : threadCount;
+    const std::size_t chunkCount = (triangleCount + ChunkSize - 1)/ChunkSize;
+
+    /* Calculate bounds and centroids of all triangles */
+    std::vector<Range3D> triangleBounds(triangleCount);
+    std::vector<Vector3> centroids(triangleCount);
+    Magnum::Implementation::parallelFor(buildThreadCount, chunkCount, [&](const std::size_t chunk) {
+        for(std::size_t i = chunk*ChunkSize, end = Math::min(i + ChunkSize, triangleCount); i < end; ++i) {
+            const Vector3& a = positions[indices[i*3]];
+            const Vector3& b = positions[indices[i*3 + 1]];
+            const Vector3& c = positions[indices[i*3 + 2]];
+            triangleBounds[i] = {Math::min(Math::min(a, b), c), Math::max(Math::max(a, b), c)};
+            centroids[i] = (a + b + c)/3.0f;
+        }
+    });
+
+    /* Build the top levels, deferring the subtrees below */
+    std::vector<UnsignedInt> order(triangleCount);
+    std::iota(order.begin(), order.end(), 0);
+    const Builder builder{triangleBounds.data(), centroids.data(), order.data()};
+    std::vector<Task> tasks;
+    _nodes.resize(1);
+    UnsignedInt maxDepth = builder.build(_nodes, &tasks, 0, 0, triangleCount, 0);
+
+    /* Build the subtrees in parallel, each into a separate array with the
+       subtree root at the front. Each task operates on a disjoint range of
+       the triangle order. */
+    std::vector<std::vector<Node>> subtrees(tasks.size());
+    std::vector<UnsignedInt> subtreeDepths(tasks.size());
+    Magnum::Implementation::parallelFor(buildThreadCount, tasks.size(), [&](const std::size_t i) {
+        subtrees[i].resize(1);
+        subtreeDepths[i] = builder.build(subtrees[i], nullptr, 0, tasks[i].begin, tasks[i].end, TaskDepth);
+    });
+
+    /* Append the subtrees in order, with the root replacing the placeholder
+       node and child offsets adjusted */
+    std::size_t nodeCount = _nodes.size();
+    for(const std::vector<Node>& subtree: subtrees)
+        nodeCount += subtree.size() - 1;
+    _nodes.reserve(nodeCount);
+    for(std::size_t i = 0; i != tasks.size(); ++i) {
+        const UnsignedInt base = _nodes.size() - 1;
+        for(std::size_t j = 0; j != subtrees[i].size(); ++j) {
+            Node node = subtrees[i][j];
+            if(!node.count) node.offset += base;
+            if(j) _nodes.push_back(node);
+            else _nodes[tasks[i].node] = node;
+        }
+        maxDepth = Math::max(maxDepth, subtreeDepths[i]);
+    }
+    _depth = maxDepth + 1;
+
+    /* Copy the triangles in the leaf order */
+    _triangles.resize(triangleCount);
+    Magnum::Implementation::parallelFor(buildThreadCount, chunkCount, [&](const std::size_t chunk) {
+        for(std::size_t i = chunk*ChunkSize, end = Math::min(i + ChunkSize, triangleCount); i < end; ++i) {
+            const UnsignedInt id = order[i];
+            const Vector3& a = positions[indices[id*3]];
+            _triangles[i] = {a,
+                positions[indices[id*3 + 1]] - a,
+                positions[indices[id*3 + 2]] - a,
+                id};
+        }
+    });
+}
+
+TriangleBvh::Hit TriangleBvh::closestHit(const Vector3& origin, const Vector3& direction, const Float maxDistance) const {
+    Hit hit;
+    traverse<false>(_nodes, _triangles, origin, direction, maxDistance, hit);
+    return hit;
+}
+
+bool TriangleBvh::anyHit(const Vector3& origin, const Vector3& direction, const Float maxDistance) const {
+    Hit hit;
+    return traverse<true>(_nodes, _triangles, origin, direction, maxDistance, hit);
+}
+
+void TriangleBvh::closestHits(const Containers::StridedArrayView<const Vector3>& origins, const Containers::StridedArrayView<const Vector3>& directions, const Containers::ArrayView<Hit>& hits, const Float maxDistance) const {
+    CORRADE_ASSERT(origins.size() == directions.size(),
+        "MeshTools::TriangleBvh::closestHits(): expected the same count of origins and directions, got" << origins.size() << "and" << directions.size(), );
+    CORRADE_ASSERT(hits.size() == origins.size(),
+        "MeshTools::TriangleBvh::closestHits(): expected" << origins.size() << "hits but got" << hits.size(), );
+
+    Packet packet;
+    for(std::size_t offset = 0; offset < origins.size(); offset += 8) {
+        const std::size_t count = Math::min(origins.size() - offset, std::size_t(8));
+        fillPacket(packet, origins, directions, offset, count, maxDistance);
+        traverse<false>(_nodes, _triangles, packet);
+
+        for(std::size_t i = 0; i != count; ++i) {
+            Hit& hit = hits[offset + i];
+            hit = Hit{};
+            if(packet.triangle[i] == ~UnsignedInt{}) continue;
+
+            hit.distance = packet.maxDistance[i];
+            hit.triangle = packet.triangle[i];
+            hit.barycentric = {packet.u[i], packet.v[i]};
+        }
+    }
+}
+
+void TriangleBvh::anyHits(const Containers::StridedArrayView<const Vector3>& origins, const Containers::StridedArrayView<const Vector3>& directions, const Containers::ArrayView<UnsignedByte>& hits, const Float maxDistance) const {
+    CORRADE_ASSERT(origins.size() == directions.size(),
+        "MeshTools::TriangleBvh::anyHits(): expected the same count of origins and directions, got" << origins.size() << "and" << directions.size(), );
+    CORRADE_ASSERT(hits.size() >= (origins.size() + 7)/8,
+        "MeshTools::TriangleBvh::anyHits(): expected at least" << (origins.size() + 7)/8 << "bytes for" << origins.size() << "results but got" << hits.size(), );
+
+    Packet packet;
+    for(std::size_t offset = 0; offset < origins.size(); offset += 8) {
+        const std::size_t count = Math::min(origins.size() - offset, std::size_t(8));
+        fillPacket(packet, origins, directions, offset, count, maxDistance);
+        traverse<true>(_nodes, _triangles, packet);
+
+        UnsignedByte mask = 0;
+        for(std::size_t i = 0; i != count; ++i)
+            mask |= UnsignedByte(packet.triangle[i] != ~UnsignedInt{}) << i;
+        hits[offset/8] = mask;
+    }
+}
+
+}}
@@ -0,0 +1,244 @@
+#ifndef Magnum_MeshTools_TriangleBvh_h
+#define Magnum_MeshTools_TriangleBvh_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::MeshTools::TriangleBvh
+ */
+
+#include <vector>
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation {
+    struct TriangleBvhNode {
+        Range3D bounds;
+        /* Index of the first child for inner nodes, the other child is right
+           after; index of the first triangle for leaf nodes */
+        UnsignedInt offset;
+        /* Triangle count for leaf nodes, 0 for inner nodes */
+        UnsignedInt count;
+    };
+
+    struct TriangleBvhTriangle {
+        Vector3 a, edge1, edge2;
+        UnsignedInt id;
+    };
+}
+
+/**
+@brief Bounding volume hierarchy of a triangle mesh
+
+Accelerates ray queries against a triangle mesh, such as mouse picking or
+line-of-sight tests. The hierarchy is built from an indexed triangle mesh,
+for example from @ref Trade::MeshData3D::positions() and
+@ref Trade::MeshData3D::indices():
+
+@code{.cpp}
+Trade::MeshData3D data = *importer.mesh3D(0);
+MeshTools::TriangleBvh bvh{data.indices(), data.positions(0)};
+
+MeshTools::TriangleBvh::Hit hit = bvh.closestHit(cameraPosition, rayDirection);
+if(hit) Debug{} << "Clicked on triangle" << hit.triangle;
+@endcode
+
+The triangles are copied into the hierarchy, so the original data don't need
+to be kept around. Triangles are tested from both sides, rays are given by
+origin and direction and hit distances are expressed in multiples of the
+direction length, same as in @ref Math::Intersection::planeLine().
+
+@section MeshTools-TriangleBvh-build Building
+
+Nodes are split using a binned surface area heuristic, with at most four
+triangles in a leaf. At large depths the heuristic is replaced with a median
+split to keep the tree depth bounded. For huge meshes the build can be
+distributed over multiple threads by setting @p threadCount in the constructor
+to a value larger than @cpp 1 @ce --- the top levels are built on the calling
+thread and the remaining subtrees are then built in parallel. The resulting
+hierarchy is the same regardless of thread count. If there's less than 65536
+triangles, the build is done on the calling thread only, as the overhead would
+outweigh the gains. Multithreaded build is not available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where @p threadCount is ignored.
+
+@section MeshTools-TriangleBvh-batch Batch queries
+
+The @ref closestHits() and @ref anyHits() functions process the rays in
+packets of eight, which are transposed to a structure-of-arrays layout so the
+compiler can vectorize the node and triangle tests. A packet traverses the
+hierarchy together, which is most efficient if the rays are coherent, such as
+rays going through neighboring pixels. For incoherent rays, querying each ray
+separately may be faster. Hit distances are the same as when querying each ray
+separately, only when a ray hits an edge shared by two triangles, the reported
+triangle may differ.
+*/
+class MAGNUM_MESHTOOLS_EXPORT TriangleBvh {
+    public:
+        /**
+         * @brief Ray hit
+         *
+         * @see @ref closestHit(), @ref closestHits()
+         */
+        struct Hit {
+            /**
+             * @brief Hit distance
+             *
+             * In multiples of the ray direction length.
+             * @ref Constants::inf() if there's no hit.
+             */
+            Float distance{Constants::inf()};
+
+            /**
+             * @brief Hit triangle
+             *
+             * Index of the hit triangle in the original index array, divided
+             * by three. @cpp 0xffffffffu @ce if there's no hit.
+             */
+            UnsignedInt triangle{~UnsignedInt{}};
+
+            /**
+             * @brief Barycentric coordinates of the hit
+             *
+             * Weights of the second and third triangle vertex, the weight of
+             * the first vertex is @cpp 1.0f - barycentric.sum() @ce.
+             */
+            Vector2 barycentric;
+
+            /** @brief Whether there is a hit */
+            explicit operator bool() const { return triangle != ~UnsignedInt{}; }
+        };
+
+        /**
+         * @brief Constructor
+         * @param indices       Array of triangle face indices
+         * @param positions     Array of vertex positions
+         * @param threadCount   Thread count used for the build, including
+         *      the calling thread
+         *
+         * Expects that @p indices size is divisible by @cpp 3 @ce. See
+         * @ref MeshTools-TriangleBvh-build for more information.
+         */
+        explicit TriangleBvh(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt threadCount = 1);
+
+        /** @brief Triangle count */
+        std::size_t triangleCount() const { return _triangles.size(); }
+
+        /**
+         * @brief Node count
+         *
+         * Including leaf nodes. @cpp 0 @ce for an empty mesh.
+         */
+        std::size_t nodeCount() const { return _nodes.size(); }
+
+        /**
+         * @brief Tree depth
+         *
+         * Count of nodes on the longest path from the root to a leaf.
+         * @cpp 0 @ce for an empty mesh.
+         */
+        UnsignedInt depth() const { return _depth; }
+
+        /**
+         * @brief Mesh bounds
+         *
+         * Default-constructed range for an empty mesh.
+         */
+        Range3D bounds() const {
+            return _nodes.empty() ? Range3D{} : _nodes.front().bounds;
+        }
+
+        /**
+         * @brief Closest hit along a ray
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param maxDistance   Max hit distance, in multiples of
+         *      @p direction length
+         *
+         * Returns the hit with the smallest distance in the range
+         * @f$ [0, maxDistance) @f$ or a @ref Hit evaluating to
+         * @cpp false @ce if there's no such hit.
+         * @see @ref closestHits()
+         */
+        Hit closestHit(const Vector3& origin, const Vector3& direction, Float maxDistance = Constants::inf()) const;
+
+        /**
+         * @brief Whether a ray hits anything
+         *
+         * Same as @ref closestHit(), but stops on the first hit found, which
+         * is sufficient for line-of-sight and shadow queries.
+         * @see @ref anyHits()
+         */
+        bool anyHit(const Vector3& origin, const Vector3& direction, Float maxDistance = Constants::inf()) const;
+
+        /**
+         * @brief Closest hits for a batch of rays
+         * @param origins       Ray origins
+         * @param directions    Ray directions, expected to have the same
+         *      size as @p origins
+         * @param[out] hits     Hits, expected to have the same size as
+         *      @p origins
+         * @param maxDistance   Max hit distance, in multiples of direction
+         *      length
+         *
+         * Batch variant of @ref closestHit(), see
+         * @ref MeshTools-TriangleBvh-batch for more information.
+         */
+        void closestHits(const Containers::StridedArrayView<const Vector3>& origins, const Containers::StridedArrayView<const Vector3>& directions, const Containers::ArrayView<Hit>& hits, Float maxDistance = Constants::inf()) const;
+
+        /**
+         * @brief Whether a batch of rays hits anything
+         * @param origins       Ray origins
+         * @param directions    Ray directions, expected to have the same
+         *      size as @p origins
+         * @param[out] hits     Bit mask of results, expected to have at least
+         *      @cpp (origins.size() + 7)/8 @ce bytes
+         * @param maxDistance   Max hit distance, in multiples of direction
+         *      length
+         *
+         * Batch variant of @ref anyHit(). Bit @cpp i % 8 @ce of byte
+         * @cpp i / 8 @ce of @p hits is set if the @p i-th ray hits anything,
+         * unused bits in the last byte are cleared, same as in the batch
+         * variant of @ref Math::Intersection::rangeFrustum(). See
+         * @ref MeshTools-TriangleBvh-batch for more information.
+         */
+        void anyHits(const Containers::StridedArrayView<const Vector3>& origins, const Containers::StridedArrayView<const Vector3>& directions, const Containers::ArrayView<UnsignedByte>& hits, Float maxDistance = Constants::inf()) const;
+
+    private:
+        std::vector<Implementation::TriangleBvhNode> _nodes;
+        std::vector<Implementation::TriangleBvhTriangle> _triangles;
+        UnsignedInt _depth{};
+};
+
+}}
+
+#endif
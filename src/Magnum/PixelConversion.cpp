@@ -0,0 +1,485 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PixelConversion.h"
+
+#include <cstring>
+#include <tuple>
+#include <utility>
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/PixelStorage.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAGNUM_PIXELCONVERSION_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef __SSSE3__
+#define MAGNUM_PIXELCONVERSION_SSSE3
+#include <tmmintrin.h>
+#endif
+/* Emscripten with -msimd128, has both the shifts and the byte shuffles */
+#ifdef __wasm_simd128__
+#define MAGNUM_PIXELCONVERSION_WASM_SIMD
+#include <wasm_simd128.h>
+#endif
+
+namespace Magnum {
+
+namespace {
+
+/* Calls given function on each row of the image, passing the row data view
+   cast to given pixel type */
+template<class Pixel, class F> void forEachRow(const PixelStorage& storage, const Vector3i& size, const Containers::ArrayView<char> data, F f) {
+    Math::Vector3<std::size_t> offset, dataSize;
+    std::tie(offset, dataSize) = storage.dataProperties(sizeof(Pixel), size);
+
+    for(std::int_fast32_t z = 0; z != size.z(); ++z) {
+        for(std::int_fast32_t y = 0; y != size.y(); ++y) {
+            char* const row = data + offset.sum() + (z*dataSize.y() + y)*dataSize.x();
+            CORRADE_INTERNAL_ASSERT(row + size.x()*sizeof(Pixel) <= data.end());
+            f(Containers::ArrayView<Pixel>{reinterpret_cast<Pixel*>(row), std::size_t(size.x())});
+        }
+    }
+}
+
+/* Same as forEachRow(), but iterating over rows of two images of the same
+   size at once */
+template<class Src, class Dst, class F> void forEachRow(const PixelStorage& srcStorage, const Containers::ArrayView<const char> srcData, const PixelStorage& dstStorage, const Containers::ArrayView<char> dstData, const Vector3i& size, F f) {
+    Math::Vector3<std::size_t> srcOffset, srcDataSize, dstOffset, dstDataSize;
+    std::tie(srcOffset, srcDataSize) = srcStorage.dataProperties(sizeof(Src), size);
+    std::tie(dstOffset, dstDataSize) = dstStorage.dataProperties(sizeof(Dst), size);
+
+    for(std::int_fast32_t z = 0; z != size.z(); ++z) {
+        for(std::int_fast32_t y = 0; y != size.y(); ++y) {
+            const char* const srcRow = srcData + srcOffset.sum() + (z*srcDataSize.y() + y)*srcDataSize.x();
+            char* const dstRow = dstData + dstOffset.sum() + (z*dstDataSize.y() + y)*dstDataSize.x();
+            CORRADE_INTERNAL_ASSERT(srcRow + size.x()*sizeof(Src) <= srcData.end());
+            CORRADE_INTERNAL_ASSERT(dstRow + size.x()*sizeof(Dst) <= dstData.end());
+            f(Containers::ArrayView<const Src>{reinterpret_cast<const Src*>(srcRow), std::size_t(size.x())},
+              Containers::ArrayView<Dst>{reinterpret_cast<Dst*>(dstRow), std::size_t(size.x())});
+        }
+    }
+}
+
+/* 256-entry table for unpacking sRGB to linear. Calculated using the scalar
+   Color3::fromSrgb() so the results are bit-exact with it. */
+const Float* srgbToLinearTable() {
+    static const struct Table {
+        Table() {
+            for(std::size_t i = 0; i != 256; ++i)
+                data[i] = Color3::fromSrgb(Color3ub{UnsignedByte(i)}).r();
+        }
+
+        Float data[256];
+    } table;
+    return table.data;
+}
+
+/* The derivative of the sRGB curve is largest near zero, where one step of
+   a 4096-entry table corresponds to less than half of an 8-bit sRGB step, so
+   the nearest table entry is off by at most one */
+constexpr std::size_t LinearToSrgbTableSize = 4096;
+
+/* Unlike Color3::toSrgb<UnsignedByte>(), which truncates, this rounds to
+   nearest so 8-bit sRGB values survive a round trip through linear RGB */
+inline UnsignedByte linearToSrgbScalar(const Float value) {
+    return UnsignedByte(Color3{value}.toSrgb().r()*255.0f + 0.5f);
+}
+
+inline UnsignedInt floatBits(const Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, sizeof(Float));
+    return bits;
+}
+
+inline Float floatFromBits(const UnsignedInt bits) {
+    Float value;
+    std::memcpy(&value, &bits, sizeof(Float));
+    return value;
+}
+
+struct LinearToSrgbTable {
+    /* Scalar result for the nearest table entry */
+    UnsignedByte candidates[LinearToSrgbTableSize];
+    /* Smallest linear value that the scalar path converts to given sRGB
+       value, with a sentinel at both ends */
+    Float thresholds[257];
+};
+
+const LinearToSrgbTable& linearToSrgbTable() {
+    static const struct Table: LinearToSrgbTable {
+        Table() {
+            for(std::size_t i = 0; i != LinearToSrgbTableSize; ++i)
+                candidates[i] = linearToSrgbScalar(Float(i)/(LinearToSrgbTableSize - 1));
+
+            /* Positive floats are ordered the same as their bit patterns, so
+               the thresholds can be found with a bisection on the bits */
+            thresholds[0] = 0.0f;
+            for(UnsignedInt k = 1; k != 256; ++k) {
+                UnsignedInt lo = floatBits(0.0f), hi = floatBits(1.0f);
+                while(hi - lo > 1) {
+                    const UnsignedInt mid = lo + (hi - lo)/2;
+                    if(linearToSrgbScalar(floatFromBits(mid)) >= k) hi = mid;
+                    else lo = mid;
+                }
+                thresholds[k] = floatFromBits(hi);
+            }
+            thresholds[256] = 2.0f;
+        }
+    } table;
+    return table;
+}
+
+inline UnsignedByte packClamped(const Float value) {
+    return UnsignedByte(Math::clamp(value, 0.0f, 1.0f)*255.0f + 0.5f);
+}
+
+inline UnsignedByte linearToSrgbClamped(const LinearToSrgbTable& table, const Float value) {
+    const Float clamped = Math::clamp(value, 0.0f, 1.0f);
+    std::size_t out = table.candidates[std::size_t(clamped*(LinearToSrgbTableSize - 1) + 0.5f)];
+    if(clamped >= table.thresholds[out + 1]) ++out;
+    else if(clamped < table.thresholds[out]) --out;
+    return UnsignedByte(out);
+}
+
+/* Exact rounded division by 255 for the product of two bytes */
+inline UnsignedByte multiplyNormalized(const UnsignedInt a, const UnsignedInt b) {
+    const UnsignedInt t = a*b + 128;
+    return UnsignedByte((t + (t >> 8)) >> 8);
+}
+
+/* Row conversion functions for copyImage() */
+typedef void(*CopyRowFunction)(const char*, char*, std::size_t);
+
+void copyRow(const char* const src, char* const dst, const std::size_t size) {
+    std::memcpy(dst, src, size);
+}
+
+template<UnsignedByte alpha> void copyRowRgbToRgba(const char* const src, char* const dst, const std::size_t count) {
+    Magnum::rgbToRgba({reinterpret_cast<const Color3ub*>(src), count}, {reinterpret_cast<Color4ub*>(dst), count}, alpha);
+}
+
+void copyRowRgbaToRgb(const char* const src, char* const dst, const std::size_t count) {
+    Magnum::rgbaToRgb({reinterpret_cast<const Color4ub*>(src), count}, {reinterpret_cast<Color3ub*>(dst), count});
+}
+
+template<std::size_t srcChannels, std::size_t dstChannels> void copyRowUnpack(const char* const src, char* const dst, std::size_t count) {
+    const UnsignedByte* in = reinterpret_cast<const UnsignedByte*>(src);
+    Float* out = reinterpret_cast<Float*>(dst);
+    for(; count; --count, in += srcChannels, out += dstChannels) {
+        out[0] = Math::unpack<Float>(in[0]);
+        out[1] = Math::unpack<Float>(in[1]);
+        out[2] = Math::unpack<Float>(in[2]);
+        if(dstChannels == 4)
+            out[dstChannels - 1] = srcChannels == 4 ? Math::unpack<Float>(in[srcChannels - 1]) : 1.0f;
+    }
+}
+
+template<std::size_t srcChannels, std::size_t dstChannels> void copyRowPack(const char* const src, char* const dst, std::size_t count) {
+    const Float* in = reinterpret_cast<const Float*>(src);
+    UnsignedByte* out = reinterpret_cast<UnsignedByte*>(dst);
+    for(; count; --count, in += srcChannels, out += dstChannels) {
+        out[0] = Math::pack<UnsignedByte>(Math::clamp(in[0], 0.0f, 1.0f));
+        out[1] = Math::pack<UnsignedByte>(Math::clamp(in[1], 0.0f, 1.0f));
+        out[2] = Math::pack<UnsignedByte>(Math::clamp(in[2], 0.0f, 1.0f));
+        if(dstChannels == 4)
+            out[dstChannels - 1] = srcChannels == 4 ? Math::pack<UnsignedByte>(Math::clamp(in[srcChannels - 1], 0.0f, 1.0f)) : 255;
+    }
+}
+
+/* Returns nullptr if the conversion is not supported. The memcpy variant
+   takes byte count instead of pixel count, which is signalled by the second
+   value. */
+std::pair<CopyRowFunction, bool> copyRowFunction(const Implementation::ImageCopyProperties& src, const Implementation::ImageCopyProperties& dst) {
+    if(src.format == dst.format && src.formatExtra == dst.formatExtra && src.pixelSize == dst.pixelSize)
+        return {copyRow, true};
+
+    /* Implementation-specific formats can't be converted */
+    if(isPixelFormatImplementationSpecific(src.format) || isPixelFormatImplementationSpecific(dst.format))
+        return {};
+
+    #define _c(srcFormat, dstFormat, function)                              \
+        if(src.format == PixelFormat::srcFormat && dst.format == PixelFormat::dstFormat) \
+            return {function, false};
+    _c(RGB8Unorm, RGBA8Unorm, copyRowRgbToRgba<255>)
+    _c(RGBA8Unorm, RGB8Unorm, copyRowRgbaToRgb)
+    _c(RGB8UI, RGBA8UI, copyRowRgbToRgba<1>)
+    _c(RGBA8UI, RGB8UI, copyRowRgbaToRgb)
+    _c(RGB8Unorm, RGB32F, (copyRowUnpack<3, 3>))
+    _c(RGB8Unorm, RGBA32F, (copyRowUnpack<3, 4>))
+    _c(RGBA8Unorm, RGB32F, (copyRowUnpack<4, 3>))
+    _c(RGBA8Unorm, RGBA32F, (copyRowUnpack<4, 4>))
+    _c(RGB32F, RGB8Unorm, (copyRowPack<3, 3>))
+    _c(RGB32F, RGBA8Unorm, (copyRowPack<3, 4>))
+    _c(RGBA32F, RGB8Unorm, (copyRowPack<4, 3>))
+    _c(RGBA32F, RGBA8Unorm, (copyRowPack<4, 4>))
+    #undef _c
+
+    return {};
+}
+
+}
+
+void swapRedBlue(const Containers::ArrayView<Color3ub> pixels) {
+    char* data = reinterpret_cast<char*>(pixels.data());
+    std::size_t size = pixels.size()*3;
+
+    /* Process five pixels at a time, the sixteenth byte is kept in place and
+       processed again in the next iteration */
+    #ifdef MAGNUM_PIXELCONVERSION_SSSE3
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+    for(; size >= 16; data += 15, size -= 15) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_shuffle_epi8(in, shuffle));
+    }
+    #elif defined(MAGNUM_PIXELCONVERSION_WASM_SIMD)
+    for(; size >= 16; data += 15, size -= 15) {
+        const v128_t in = wasm_v128_load(data);
+        wasm_v128_store(data, wasm_i8x16_shuffle(in, in, 2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15));
+    }
+    #endif
+
+    for(; size; data += 3, size -= 3) std::swap(data[0], data[2]);
+}
+
+void swapRedBlue(const Containers::ArrayView<Color4ub> pixels) {
+    char* data = reinterpret_cast<char*>(pixels.data());
+    std::size_t size = pixels.size()*4;
+
+    /* Rotate each 32-bit pixel by 16 bits, keeping only red and blue, and
+       merge back with green and alpha. Four pixels at a time. */
+    #ifdef MAGNUM_PIXELCONVERSION_SSE2
+    const __m128i redBlueMask = _mm_set1_epi32(0x00ff00ff);
+    for(; size >= 16; data += 16, size -= 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const __m128i redBlue = _mm_and_si128(in, redBlueMask);
+        const __m128i greenAlpha = _mm_andnot_si128(redBlueMask, in);
+        const __m128i blueRed = _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_or_si128(blueRed, greenAlpha));
+    }
+    #elif defined(MAGNUM_PIXELCONVERSION_WASM_SIMD)
+    /* A byte shuffle is a single instruction here, no need for the masks */
+    for(; size >= 16; data += 16, size -= 16) {
+        const v128_t in = wasm_v128_load(data);
+        wasm_v128_store(data, wasm_i8x16_shuffle(in, in, 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15));
+    }
+    #endif
+
+    for(; size; data += 4, size -= 4) std::swap(data[0], data[2]);
+}
+
+void rgbToRgba(const Containers::ArrayView<const Color3ub> src, const Containers::ArrayView<Color4ub> dst, const UnsignedByte alpha) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "rgbToRgba(): expected" << src.size() << "destination pixels but got" << dst.size(), );
+
+    const char* in = reinterpret_cast<const char*>(src.data());
+    char* out = reinterpret_cast<char*>(dst.data());
+    std::size_t count = src.size();
+
+    /* Expand four pixels at a time, the loads are 16 bytes so the last four
+       bytes need to be still inside the source */
+    #ifdef MAGNUM_PIXELCONVERSION_SSSE3
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alphaMask = _mm_set1_epi32(Int(UnsignedInt(alpha) << 24));
+    for(; count >= 6; in += 12, out += 16, count -= 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_or_si128(_mm_shuffle_epi8(pixels, shuffle), alphaMask));
+    }
+    #elif defined(MAGNUM_PIXELCONVERSION_WASM_SIMD)
+    /* Lanes 16+ of the shuffle pick from the second operand, which is the
+       alpha splatted to all bytes */
+    const v128_t alphaValue = wasm_i8x16_splat(Byte(alpha));
+    for(; count >= 6; in += 12, out += 16, count -= 4) {
+        const v128_t pixels = wasm_v128_load(in);
+        wasm_v128_store(out, wasm_i8x16_shuffle(pixels, alphaValue, 0, 1, 2, 16, 3, 4, 5, 16, 6, 7, 8, 16, 9, 10, 11, 16));
+    }
+    #endif
+
+    for(; count; in += 3, out += 4, --count) {
+        out[0] = in[0];
+        out[1] = in[1];
+        out[2] = in[2];
+        out[3] = char(alpha);
+    }
+}
+
+void rgbaToRgb(const Containers::ArrayView<const Color4ub> src, const Containers::ArrayView<Color3ub> dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "rgbaToRgb(): expected" << src.size() << "destination pixels but got" << dst.size(), );
+
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = src[i].rgb();
+}
+
+void srgbToLinear(const Containers::StridedArrayView<const Color3ub>& src, const Containers::StridedArrayView<Color3>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "srgbToLinear(): expected" << src.size() << "destination pixels but got" << dst.size(), );
+
+    const Float* const table = srgbToLinearTable();
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = {table[src[i].r()], table[src[i].g()], table[src[i].b()]};
+}
+
+void srgbAlphaToLinear(const Containers::StridedArrayView<const Color4ub>& src, const Containers::StridedArrayView<Color4>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "srgbAlphaToLinear(): expected" << src.size() << "destination pixels but got" << dst.size(), );
+
+    const Float* const table = srgbToLinearTable();
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = {table[src[i].r()], table[src[i].g()], table[src[i].b()], src[i].a()/255.0f};
+}
+
+void linearToSrgb(const Containers::StridedArrayView<const Color3>& src, const Containers::StridedArrayView<Color3ub>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "linearToSrgb(): expected" << src.size() << "destination pixels but got" << dst.size(), );
+
+    const LinearToSrgbTable& table = linearToSrgbTable();
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = {linearToSrgbClamped(table, src[i].r()),
+                  linearToSrgbClamped(table, src[i].g()),
+                  linearToSrgbClamped(table, src[i].b())};
+}
+
+void linearToSrgbAlpha(const Containers::StridedArrayView<const Color4>& src, const Containers::StridedArrayView<Color4ub>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "linearToSrgbAlpha(): expected" << src.size() << "destination pixels but got" << dst.size(), );
+
+    const LinearToSrgbTable& table = linearToSrgbTable();
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = {linearToSrgbClamped(table, src[i].r()),
+                  linearToSrgbClamped(table, src[i].g()),
+                  linearToSrgbClamped(table, src[i].b()),
+                  packClamped(src[i].a())};
+}
+
+void premultiplyAlpha(const Containers::ArrayView<Color4ub> pixels) {
+    for(Color4ub& pixel: pixels) {
+        const UnsignedInt alpha = pixel.a();
+        pixel.r() = multiplyNormalized(pixel.r(), alpha);
+        pixel.g() = multiplyNormalized(pixel.g(), alpha);
+        pixel.b() = multiplyNormalized(pixel.b(), alpha);
+    }
+}
+
+Debug& operator<<(Debug& debug, const ImageCopyFlag value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case ImageCopyFlag::value: return debug << "ImageCopyFlag::" #value;
+        _c(FlipY)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "ImageCopyFlag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const ImageCopyFlags value) {
+    return Containers::enumSetDebugOutput(debug, value, "ImageCopyFlags{}", {
+        ImageCopyFlag::FlipY});
+}
+
+namespace Implementation {
+
+void copyImage(const ImageCopyProperties& src, const Containers::ArrayView<const char> srcData, const Vector3i& srcOffset, const ImageCopyProperties& dst, const Containers::ArrayView<char> dstData, const Vector3i& dstOffset, const Vector3i& size, const ImageCopyFlags flags) {
+    CORRADE_ASSERT((srcOffset >= Vector3i{}).all() && (srcOffset + size <= src.size).all(),
+        "copyImage(): source area" << srcOffset << "with size" << size << "out of bounds for an image of size" << src.size, );
+    CORRADE_ASSERT((dstOffset >= Vector3i{}).all() && (dstOffset + size <= dst.size).all(),
+        "copyImage(): destination area" << dstOffset << "with size" << size << "out of bounds for an image of size" << dst.size, );
+
+    CopyRowFunction function;
+    bool bytes;
+    std::tie(function, bytes) = copyRowFunction(src, dst);
+    CORRADE_ASSERT(function,
+        "copyImage(): can't convert" << src.format << "to" << dst.format, );
+
+    if(!size.product()) return;
+
+    /* Row strides are given by the whole image size, not just the area */
+    Math::Vector3<std::size_t> srcDataOffset, srcDataSize, dstDataOffset, dstDataSize;
+    std::tie(srcDataOffset, srcDataSize) = src.storage.dataProperties(src.pixelSize, src.size);
+    std::tie(dstDataOffset, dstDataSize) = dst.storage.dataProperties(dst.pixelSize, dst.size);
+
+    const std::size_t count = bytes ? size.x()*src.pixelSize : size.x();
+    const bool flipY = !!(flags & ImageCopyFlag::FlipY);
+    for(std::int_fast32_t z = 0; z != size.z(); ++z) {
+        for(std::int_fast32_t y = 0; y != size.y(); ++y) {
+            const std::size_t srcY = srcOffset.y() + (flipY ? size.y() - y - 1 : y);
+            const char* const srcRow = srcData + srcDataOffset.sum() + ((srcOffset.z() + z)*srcDataSize.y() + srcY)*srcDataSize.x() + srcOffset.x()*src.pixelSize;
+            char* const dstRow = dstData + dstDataOffset.sum() + ((dstOffset.z() + z)*dstDataSize.y() + dstOffset.y() + y)*dstDataSize.x() + dstOffset.x()*dst.pixelSize;
+            CORRADE_ASSERT(srcRow + size.x()*src.pixelSize <= srcData.end(),
+                "copyImage(): source data too small for an image of size" << src.size, );
+            CORRADE_ASSERT(dstRow + size.x()*dst.pixelSize <= dstData.end(),
+                "copyImage(): destination data too small for an image of size" << dst.size, );
+            function(srcRow, dstRow, count);
+        }
+    }
+}
+
+void swapRedBlue(const PixelStorage& storage, const std::size_t pixelSize, const Vector3i& size, const Containers::ArrayView<char> data) {
+    if(pixelSize == 3)
+        forEachRow<Color3ub>(storage, size, data, [](Containers::ArrayView<Color3ub> row) { Magnum::swapRedBlue(row); });
+    else if(pixelSize == 4)
+        forEachRow<Color4ub>(storage, size, data, [](Containers::ArrayView<Color4ub> row) { Magnum::swapRedBlue(row); });
+    else CORRADE_ASSERT(false,
+        "swapImageRedBlue(): expected a three- or four-byte pixel format but got" << pixelSize << "bytes", );
+}
+
+void premultiplyAlpha(const PixelStorage& storage, const std::size_t pixelSize, const Vector3i& size, const Containers::ArrayView<char> data) {
+    CORRADE_ASSERT(pixelSize == 4,
+        "premultiplyImageAlpha(): expected a four-byte pixel format but got" << pixelSize << "bytes", );
+    forEachRow<Color4ub>(storage, size, data, [](Containers::ArrayView<Color4ub> row) { Magnum::premultiplyAlpha(row); });
+}
+
+void srgbToLinear(const PixelStorage& srcStorage, const std::size_t srcPixelSize, const Vector3i& srcSize, const Containers::ArrayView<const char> srcData, const PixelStorage& dstStorage, const std::size_t dstPixelSize, const Vector3i& dstSize, const Containers::ArrayView<char> dstData) {
+    CORRADE_ASSERT(srcSize == dstSize,
+        "srgbImageToLinear(): expected destination image size" << srcSize << "but got" << dstSize, );
+    if(srcPixelSize == 3 && dstPixelSize == 12)
+        forEachRow<Color3ub, Color3>(srcStorage, srcData, dstStorage, dstData, srcSize, [](Containers::ArrayView<const Color3ub> src, Containers::ArrayView<Color3> dst) { Magnum::srgbToLinear(src, dst); });
+    else if(srcPixelSize == 4 && dstPixelSize == 16)
+        forEachRow<Color4ub, Color4>(srcStorage, srcData, dstStorage, dstData, srcSize, [](Containers::ArrayView<const Color4ub> src, Containers::ArrayView<Color4> dst) { Magnum::srgbAlphaToLinear(src, dst); });
+    else CORRADE_ASSERT(false,
+        "srgbImageToLinear(): expected three or four one-byte source channels and three or four float destination channels, respectively, but got" << srcPixelSize << "and" << dstPixelSize << "byte pixels", );
+}
+
+void linearToSrgb(const PixelStorage& srcStorage, const std::size_t srcPixelSize, const Vector3i& srcSize, const Containers::ArrayView<const char> srcData, const PixelStorage& dstStorage, const std::size_t dstPixelSize, const Vector3i& dstSize, const Containers::ArrayView<char> dstData) {
+    CORRADE_ASSERT(srcSize == dstSize,
+        "linearImageToSrgb(): expected destination image size" << srcSize << "but got" << dstSize, );
+    if(srcPixelSize == 12 && dstPixelSize == 3)
+        forEachRow<Color3, Color3ub>(srcStorage, srcData, dstStorage, dstData, srcSize, [](Containers::ArrayView<const Color3> src, Containers::ArrayView<Color3ub> dst) { Magnum::linearToSrgb(src, dst); });
+    else if(srcPixelSize == 16 && dstPixelSize == 4)
+        forEachRow<Color4, Color4ub>(srcStorage, srcData, dstStorage, dstData, srcSize, [](Containers::ArrayView<const Color4> src, Containers::ArrayView<Color4ub> dst) { Magnum::linearToSrgbAlpha(src, dst); });
+    else CORRADE_ASSERT(false,
+        "linearImageToSrgb(): expected three or four float source channels and three or four one-byte destination channels, respectively, but got" << srcPixelSize << "and" << dstPixelSize << "byte pixels", );
+}
+
+}
+
+}
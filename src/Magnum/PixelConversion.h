@@ -0,0 +1,305 @@
+#ifndef Magnum_PixelConversion_h
+#define Magnum_PixelConversion_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::swapRedBlue(), @ref Magnum::swapImageRedBlue(), @ref Magnum::rgbToRgba(), @ref Magnum::rgbaToRgb(), @ref Magnum::srgbToLinear(), @ref Magnum::srgbAlphaToLinear(), @ref Magnum::linearToSrgb(), @ref Magnum::linearToSrgbAlpha(), @ref Magnum::srgbImageToLinear(), @ref Magnum::linearImageToSrgb(), @ref Magnum::premultiplyAlpha(), @ref Magnum::premultiplyImageAlpha(), @ref Magnum::copyImage(), @ref Magnum::copySubImage(), enum @ref Magnum::ImageCopyFlag, enum set @ref Magnum::ImageCopyFlags
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/PixelStorage.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Image copy flag
+
+@see @ref ImageCopyFlags, @ref copyImage(), @ref copySubImage()
+*/
+enum class ImageCopyFlag: UnsignedByte {
+    /**
+     * Flip the image vertically, i.e. copy the first source row to the last
+     * destination row and so on. Useful for example for converting between
+     * the bottom-up row order used by OpenGL readbacks and the top-down
+     * order of most image file formats.
+     */
+    FlipY = 1 << 0
+};
+
+/** @debugoperatorenum{ImageCopyFlag} */
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, ImageCopyFlag value);
+
+/**
+@brief Image copy flags
+
+@see @ref copyImage(), @ref copySubImage()
+*/
+typedef Containers::EnumSet<ImageCopyFlag> ImageCopyFlags;
+
+CORRADE_ENUMSET_OPERATORS(ImageCopyFlags)
+
+/** @debugoperatorenum{ImageCopyFlags} */
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, ImageCopyFlags value);
+
+namespace Implementation {
+    struct ImageCopyProperties {
+        PixelStorage storage;
+        PixelFormat format;
+        UnsignedInt formatExtra;
+        std::size_t pixelSize;
+        Vector3i size;
+    };
+
+    template<class T> ImageCopyProperties imageCopyProperties(const T& image) {
+        return {image.storage(), image.format(), image.formatExtra(), image.pixelSize(), Vector3i::pad(image.size(), 1)};
+    }
+
+    MAGNUM_EXPORT void copyImage(const ImageCopyProperties& src, Containers::ArrayView<const char> srcData, const Vector3i& srcOffset, const ImageCopyProperties& dst, Containers::ArrayView<char> dstData, const Vector3i& dstOffset, const Vector3i& size, ImageCopyFlags flags);
+
+    MAGNUM_EXPORT void swapRedBlue(const PixelStorage& storage, std::size_t pixelSize, const Vector3i& size, Containers::ArrayView<char> data);
+    MAGNUM_EXPORT void premultiplyAlpha(const PixelStorage& storage, std::size_t pixelSize, const Vector3i& size, Containers::ArrayView<char> data);
+    MAGNUM_EXPORT void srgbToLinear(const PixelStorage& srcStorage, std::size_t srcPixelSize, const Vector3i& srcSize, Containers::ArrayView<const char> srcData, const PixelStorage& dstStorage, std::size_t dstPixelSize, const Vector3i& dstSize, Containers::ArrayView<char> dstData);
+    MAGNUM_EXPORT void linearToSrgb(const PixelStorage& srcStorage, std::size_t srcPixelSize, const Vector3i& srcSize, Containers::ArrayView<const char> srcData, const PixelStorage& dstStorage, std::size_t dstPixelSize, const Vector3i& dstSize, Containers::ArrayView<char> dstData);
+}
+
+/**
+@brief Swap red and blue channels of three-channel pixels in-place
+
+Converts BGR to RGB and vice versa. Uses SSSE3 or WebAssembly SIMD if the
+library is compiled with it enabled, otherwise processes the pixels one by
+one.
+@see @ref swapImageRedBlue()
+*/
+MAGNUM_EXPORT void swapRedBlue(Containers::ArrayView<Color3ub> pixels);
+
+/**
+@brief Swap red and blue channels of four-channel pixels in-place
+
+Converts BGRA to RGBA and vice versa, alpha is kept untouched. Uses SSE2 or
+WebAssembly SIMD if the library is compiled with it enabled, otherwise
+processes the pixels one by one.
+@see @ref swapImageRedBlue()
+*/
+MAGNUM_EXPORT void swapRedBlue(Containers::ArrayView<Color4ub> pixels);
+
+/**
+@brief Swap red and blue channels of an image in-place
+
+Accepts @ref Image, @ref Trade::ImageData or any other image class providing
+mutable data access. The image is expected to have three or four one-byte
+channels, with red and blue being the first and third one. Row and image
+padding given by image @ref PixelStorage is respected.
+*/
+template<class T> void swapImageRedBlue(T& image) {
+    Implementation::swapRedBlue(image.storage(), image.pixelSize(), Vector3i::pad(image.size(), 1), image.data());
+}
+
+/**
+@brief Expand RGB pixels to RGBA
+@param src      Source pixels
+@param dst      Destination pixels
+@param alpha    Alpha value to fill
+
+Expects that both views have the same size. Uses SSSE3 or WebAssembly SIMD
+if the library is compiled with it enabled, otherwise processes the pixels one
+by one.
+*/
+MAGNUM_EXPORT void rgbToRgba(Containers::ArrayView<const Color3ub> src, Containers::ArrayView<Color4ub> dst, UnsignedByte alpha = 255);
+
+/**
+@brief Drop alpha from RGBA pixels
+@param src      Source pixels
+@param dst      Destination pixels
+
+Expects that both views have the same size.
+*/
+MAGNUM_EXPORT void rgbaToRgb(Containers::ArrayView<const Color4ub> src, Containers::ArrayView<Color3ub> dst);
+
+/**
+@brief Convert sRGB pixels to linear RGB
+@param src      Source pixels in sRGB
+@param dst      Destination pixels in linear RGB
+
+Expects that both views have the same size. Uses a lookup table, the result is
+bit-exact with calling @ref Color3::fromSrgb() on each unpacked pixel. The
+views can be strided, for example to convert the color attribute of
+interleaved vertex data.
+@see @ref srgbAlphaToLinear(), @ref srgbImageToLinear()
+*/
+MAGNUM_EXPORT void srgbToLinear(const Containers::StridedArrayView<const Color3ub>& src, const Containers::StridedArrayView<Color3>& dst);
+
+/**
+@brief Convert sRGB + alpha pixels to linear RGBA
+@param src      Source pixels in sRGB and linear alpha
+@param dst      Destination pixels in linear RGBA
+
+Similar to @ref srgbToLinear(), the alpha channel is only unpacked to a
+@f$ [0, 1] @f$ range.
+*/
+MAGNUM_EXPORT void srgbAlphaToLinear(const Containers::StridedArrayView<const Color4ub>& src, const Containers::StridedArrayView<Color4>& dst);
+
+/**
+@brief Convert linear RGB pixels to sRGB
+@param src      Source pixels in linear RGB
+@param dst      Destination pixels in sRGB
+
+Expects that both views have the same size. Values outside of the
+@f$ [0, 1] @f$ range are clamped. Uses a lookup table with a correction step
+against a table of rounding thresholds, the result is bit-exact with calling
+@ref Color3::toSrgb() on each clamped pixel and rounding the result to
+nearest. The views can be strided.
+@see @ref linearToSrgbAlpha(), @ref linearImageToSrgb()
+*/
+MAGNUM_EXPORT void linearToSrgb(const Containers::StridedArrayView<const Color3>& src, const Containers::StridedArrayView<Color3ub>& dst);
+
+/**
+@brief Convert linear RGBA pixels to sRGB + alpha
+@param src      Source pixels in linear RGBA
+@param dst      Destination pixels in sRGB and linear alpha
+
+Similar to @ref linearToSrgb(), the alpha channel is only packed from a
+@f$ [0, 1] @f$ range.
+*/
+MAGNUM_EXPORT void linearToSrgbAlpha(const Containers::StridedArrayView<const Color4>& src, const Containers::StridedArrayView<Color4ub>& dst);
+
+/**
+@brief Convert an sRGB image to linear RGB
+@param src      Source image in sRGB
+@param dst      Destination image in linear RGB
+
+Accepts @ref ImageView, @ref Image, @ref Trade::ImageData or any other image
+class as a source and @ref Image, @ref Trade::ImageData or any other image
+class providing mutable data access as a destination. Expects that both images
+have the same size and that the source has three or four one-byte channels
+and the destination three or four @ref Magnum::Float "Float" channels,
+respectively. The conversion is done using @ref srgbToLinear() or
+@ref srgbAlphaToLinear() on each row. Row and image padding given by image
+@ref PixelStorage of both images is respected.
+@see @ref linearImageToSrgb()
+*/
+template<class T, class U> void srgbImageToLinear(const T& src, U& dst) {
+    Implementation::srgbToLinear(src.storage(), src.pixelSize(), Vector3i::pad(src.size(), 1), src.data(), dst.storage(), dst.pixelSize(), Vector3i::pad(dst.size(), 1), dst.data());
+}
+
+/**
+@brief Convert a linear RGB image to sRGB
+@param src      Source image in linear RGB
+@param dst      Destination image in sRGB
+
+Inverse of @ref srgbImageToLinear(), with the same image requirements but the
+channel types swapped. The conversion is done using @ref linearToSrgb() or
+@ref linearToSrgbAlpha() on each row.
+*/
+template<class T, class U> void linearImageToSrgb(const T& src, U& dst) {
+    Implementation::linearToSrgb(src.storage(), src.pixelSize(), Vector3i::pad(src.size(), 1), src.data(), dst.storage(), dst.pixelSize(), Vector3i::pad(dst.size(), 1), dst.data());
+}
+
+/**
+@brief Premultiply alpha in-place
+
+Multiplies the red, green and blue channels with alpha, rounding to nearest.
+The operation is done on the values as they are, i.e. it's not gamma-correct
+for sRGB pixels.
+@see @ref premultiplyImageAlpha()
+*/
+MAGNUM_EXPORT void premultiplyAlpha(Containers::ArrayView<Color4ub> pixels);
+
+/**
+@brief Premultiply alpha of an image in-place
+
+Accepts @ref Image, @ref Trade::ImageData or any other image class providing
+mutable data access. The image is expected to have four one-byte channels,
+with alpha being the last one. Row and image padding given by image
+@ref PixelStorage is respected.
+*/
+template<class T> void premultiplyImageAlpha(T& image) {
+    Implementation::premultiplyAlpha(image.storage(), image.pixelSize(), Vector3i::pad(image.size(), 1), image.data());
+}
+
+/**
+@brief Copy an image
+@param src      Source image
+@param dst      Destination image
+@param flags    Flags
+
+Accepts @ref ImageView, @ref Image, @ref Trade::ImageData or any other image
+class as a source and @ref Image, @ref Trade::ImageData or any other image
+class providing mutable data access as a destination. Expects that both images have the same size. Equivalent to
+calling @ref copySubImage() with zero offsets and the whole image size.
+*/
+template<class T, class U> void copyImage(const T& src, U& dst, ImageCopyFlags flags = {}) {
+    Implementation::copyImage(Implementation::imageCopyProperties(src), src.data(), {}, Implementation::imageCopyProperties(dst), dst.data(), {}, Vector3i::pad(src.size(), 1), flags);
+}
+
+/**
+@brief Copy a part of an image
+@param src          Source image
+@param srcOffset    Offset in the source image
+@param dst          Destination image
+@param dstOffset    Offset in the destination image
+@param size         Size of the copied area
+@param flags        Flags
+
+Accepts the same image types as @ref copyImage(). Expects that the area is
+contained in both images. Row length, skip and alignment given by
+@ref PixelStorage of both images is respected, so it's possible for example
+to copy a tightly packed image into a four-byte aligned sub-rectangle of a
+texture atlas:
+
+@snippet Magnum.cpp copySubImage
+
+With @ref ImageCopyFlag::FlipY the area is flipped vertically. If both images
+have the same format, each row is copied using @ref std::memcpy(). Otherwise
+the following conversions are supported, using the vectorized functions
+from this header where possible:
+
+-   @ref PixelFormat::RGB8Unorm to @ref PixelFormat::RGBA8Unorm with alpha
+    set to @cpp 255 @ce using @ref rgbToRgba() and back using
+    @ref rgbaToRgb()
+-   @ref PixelFormat::RGB8UI to @ref PixelFormat::RGBA8UI with alpha set to
+    @cpp 1 @ce and back
+-   @ref PixelFormat::RGB8Unorm / @ref PixelFormat::RGBA8Unorm to
+    @ref PixelFormat::RGB32F / @ref PixelFormat::RGBA32F using
+    @ref Math::unpack() and back using @ref Math::pack(), clamping the values
+    to the @f$ [0, 1] @f$ range. Missing alpha is set to the maximum, extra
+    alpha is dropped.
+
+Implementation-specific pixel formats can be only copied to the same format
+with the same extra format value.
+*/
+template<class T, class U, std::size_t dimensions> void copySubImage(const T& src, const Math::Vector<dimensions, Int>& srcOffset, U& dst, const Math::Vector<dimensions, Int>& dstOffset, const Math::Vector<dimensions, Int>& size, ImageCopyFlags flags = {}) {
+    Implementation::copyImage(Implementation::imageCopyProperties(src), src.data(), Vector3i::pad(srcOffset), Implementation::imageCopyProperties(dst), dst.data(), Vector3i::pad(dstOffset), Vector3i::pad(size, 1), flags);
+}
+
+}
+
+#endif
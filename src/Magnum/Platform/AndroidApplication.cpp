@@ -25,11 +25,13 @@
 
 #include "AndroidApplication.h"
 
+#include <cstring>
 #include <Corrade/Utility/AndroidLogStreamBuffer.h>
 #include <Corrade/Utility/Debug.h>
 #include <android_native_app_glue.h>
 
 #include "Magnum/GL/Version.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Platform/GLContext.h"
 
 #include "Implementation/Egl.h"
@@ -66,7 +68,7 @@ AndroidApplication::AndroidApplication(const Arguments& arguments, const Configu
     create(configuration, glConfiguration);
 }
 
-AndroidApplication::AndroidApplication(const Arguments& arguments, NoCreateT): _state{arguments}, _context{new GLContext{NoCreate, 0, nullptr}} {
+AndroidApplication::AndroidApplication(const Arguments& arguments, NoCreateT): _state{arguments}, _swapBuffersWithDamageImplementation{}, _context{new GLContext{NoCreate, 0, nullptr}} {
     /* Redirect debug output to Android log */
     _logOutput.reset(new LogOutput);
 }
@@ -111,7 +113,7 @@ bool AndroidApplication::tryCreate(const Configuration& configuration, const GLC
 
     /* Choose config */
     const EGLint configAttributes[] = {
-        EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
+        EGL_SURFACE_TYPE, EGL_WINDOW_BIT|(glConfiguration.isSwapBehaviorPreserved() ? EGL_SWAP_BEHAVIOR_PRESERVED_BIT : 0),
         EGL_RED_SIZE, glConfiguration.colorBufferSize().r(),
         EGL_GREEN_SIZE, glConfiguration.colorBufferSize().g(),
         EGL_BLUE_SIZE, glConfiguration.colorBufferSize().b(),
@@ -142,6 +144,17 @@ bool AndroidApplication::tryCreate(const Configuration& configuration, const GLC
                 << Implementation::eglErrorString(eglGetError());
         return false;
     }
+    if(glConfiguration.isSwapBehaviorPreserved() && !eglSurfaceAttrib(_display, _surface, EGL_SWAP_BEHAVIOR, EGL_BUFFER_PRESERVED)) {
+        Error() << "Platform::AndroidApplication::tryCreate(): cannot preserve EGL surface contents:"
+                << Implementation::eglErrorString(eglGetError());
+        return false;
+    }
+
+    /* Swap with damage, if available */
+    const char* const extensions = eglQueryString(_display, EGL_EXTENSIONS);
+    _swapBuffersWithDamageImplementation = extensions && std::strstr(extensions, "EGL_KHR_swap_buffers_with_damage") ?
+        reinterpret_cast<EGLBoolean(EGLAPIENTRY*)(EGLDisplay, EGLSurface, EGLint*, EGLint)>(eglGetProcAddress("eglSwapBuffersWithDamageKHR")) : nullptr;
+
     const EGLint contextAttributes[] = {
         #ifdef MAGNUM_TARGET_GLES2
         EGL_CONTEXT_CLIENT_VERSION, 2,
@@ -174,6 +187,17 @@ void AndroidApplication::swapBuffers() {
     eglSwapBuffers(_display, _surface);
 }
 
+void AndroidApplication::swapBuffers(const Range2Di& damage) {
+    if(!_swapBuffersWithDamageImplementation) {
+        eglSwapBuffers(_display, _surface);
+        return;
+    }
+
+    /* The rectangle is bottom-left-based, same as in GL */
+    EGLint rectangle[]{damage.left(), damage.bottom(), damage.sizeX(), damage.sizeY()};
+    _swapBuffersWithDamageImplementation(_display, _surface, rectangle, 1);
+}
+
 void AndroidApplication::viewportEvent(ViewportEvent& event) {
     #ifdef MAGNUM_BUILD_DEPRECATED
     CORRADE_IGNORE_DEPRECATED_PUSH
@@ -258,7 +282,7 @@ std::int32_t AndroidApplication::inputEvent(android_app* state, AInputEvent* eve
 }
 
 AndroidApplication::GLConfiguration::GLConfiguration():
-    _colorBufferSize{8, 8, 8, 0}, _depthBufferSize{24}, _stencilBufferSize{0} {}
+    _colorBufferSize{8, 8, 8, 0}, _depthBufferSize{24}, _stencilBufferSize{0}, _swapBehaviorPreserved{false} {}
 
 void AndroidApplication::exec(android_app* state, std::unique_ptr<AndroidApplication>(*instancer)(const Arguments&)) {
     state->onAppCmd = commandEvent;
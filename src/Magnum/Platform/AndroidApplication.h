@@ -314,9 +314,26 @@ class AndroidApplication {
          * @brief Swap buffers
          *
          * Paints currently rendered framebuffer on screen.
+         * @see @ref swapBuffers(const Range2Di&)
          */
         void swapBuffers();
 
+        /**
+         * @brief Swap buffers with damage
+         *
+         * Same as @ref swapBuffers(), but additionally tells the compositor
+         * that only @p damage changed since the previous frame, which can
+         * save power and memory bandwidth. The rectangle is in pixels, with
+         * origin in the bottom left corner. Uses
+         * @m_class{m-doc-external} [EGL_KHR_swap_buffers_with_damage](https://www.khronos.org/registry/EGL/extensions/KHR/EGL_KHR_swap_buffers_with_damage.txt)
+         * if available, otherwise equivalent to @ref swapBuffers(). In order
+         * to render only the damaged area, the framebuffer contents need to
+         * be preserved between frames, see
+         * @ref GLConfiguration::setSwapBehaviorPreserved() and
+         * @ref SceneGraph::BasicDamageTracker2D for more information.
+         */
+        void swapBuffers(const Range2Di& damage);
+
         /** @copydoc Sdl2Application::redraw() */
         void redraw() { _flags |= Flag::Redraw; }
 
@@ -387,6 +404,7 @@ class AndroidApplication {
         EGLDisplay _display;
         EGLSurface _surface;
         EGLContext _glContext;
+        EGLBoolean(EGLAPIENTRY *_swapBuffersWithDamageImplementation)(EGLDisplay, EGLSurface, EGLint*, EGLint);
 
         std::unique_ptr<Platform::GLContext> _context;
         std::unique_ptr<LogOutput> _logOutput;
@@ -459,9 +477,28 @@ class AndroidApplication::GLConfiguration {
             return *this;
         }
 
+        /** @brief Whether framebuffer contents are preserved after swap */
+        bool isSwapBehaviorPreserved() const { return _swapBehaviorPreserved; }
+
+        /**
+         * @brief Preserve framebuffer contents after swap
+         *
+         * By default, contents of the framebuffer are undefined after
+         * @ref swapBuffers(). If enabled, the contents are preserved, which
+         * allows redrawing only the changed parts of the screen. Default is
+         * @cpp false @ce.
+         * @see @ref swapBuffers(const Range2Di&),
+         *      @ref SceneGraph::BasicDamageTracker2D
+         */
+        GLConfiguration& setSwapBehaviorPreserved(bool preserved) {
+            _swapBehaviorPreserved = preserved;
+            return *this;
+        }
+
     private:
         Vector4i _colorBufferSize;
         Int _depthBufferSize, _stencilBufferSize;
+        bool _swapBehaviorPreserved;
 };
 
 /**
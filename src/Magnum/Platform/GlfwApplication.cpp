@@ -524,6 +524,45 @@ void GlfwApplication::setupCallbacks() {
     });
 }
 
+#ifdef MAGNUM_TARGET_GL
+GlfwApplication::SharedGLContext GlfwApplication::createSharedGLContext() {
+    CORRADE_ASSERT(_window, "Platform::GlfwApplication::createSharedGLContext(): no window opened", SharedGLContext{NoCreate});
+
+    /* The remaining window hints are still the ones the main window was
+       created with, so the context is compatible with it */
+    glfwWindowHint(GLFW_VISIBLE, false);
+    GLFWwindow* const window = glfwCreateWindow(1, 1, "", nullptr, _window);
+    if(!window) {
+        Error() << "Platform::GlfwApplication::createSharedGLContext(): cannot create a window with shared OpenGL context";
+        return SharedGLContext{NoCreate};
+    }
+
+    return SharedGLContext{window};
+}
+
+GlfwApplication::SharedGLContext::SharedGLContext(SharedGLContext&& other) noexcept: _window{other._window} {
+    other._window = {};
+}
+
+GlfwApplication::SharedGLContext::~SharedGLContext() {
+    if(_window) glfwDestroyWindow(_window);
+}
+
+GlfwApplication::SharedGLContext& GlfwApplication::SharedGLContext::operator=(SharedGLContext&& other) noexcept {
+    using std::swap;
+    swap(other._window, _window);
+    return *this;
+}
+
+void GlfwApplication::SharedGLContext::makeCurrent() {
+    glfwMakeContextCurrent(_window);
+}
+
+void GlfwApplication::SharedGLContext::release() {
+    glfwMakeContextCurrent(nullptr);
+}
+#endif
+
 GlfwApplication::~GlfwApplication() {
     glfwDestroyWindow(_window);
     glfwTerminate();
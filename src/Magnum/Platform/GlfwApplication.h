@@ -140,6 +140,7 @@ class GlfwApplication {
         class Configuration;
         #ifdef MAGNUM_TARGET_GL
         class GLConfiguration;
+        class SharedGLContext;
         #endif
         class ViewportEvent;
         class InputEvent;
@@ -241,6 +242,25 @@ class GlfwApplication {
          */
         GLFWwindow* window() { return _window; }
 
+        #ifdef MAGNUM_TARGET_GL
+        /**
+         * @brief Create a shared OpenGL context
+         *
+         * Creates a hidden window with an OpenGL context sharing objects with
+         * the main one, meant to be made current on a loader thread for
+         * uploading data off the render thread. Expects that the main window
+         * is already created. Prints error message and returns a
+         * @ref SharedGLContext::isCreated() "non-created" instance on failure.
+         * Has to be called from the main thread. See @ref SharedGLContext for
+         * more information.
+         *
+         * @note This function is available only if Magnum is compiled with
+         *      @ref MAGNUM_TARGET_GL enabled (done by default). See
+         *      @ref building-features for more information.
+         */
+        SharedGLContext createSharedGLContext();
+        #endif
+
     protected:
         /* Nobody will need to have (and delete) GlfwApplication*, thus this is
            faster than public pure virtual destructor */
@@ -741,6 +761,70 @@ class GlfwApplication::GLConfiguration {
 };
 
 CORRADE_ENUMSET_OPERATORS(GlfwApplication::GLConfiguration::Flags)
+
+/**
+@brief Shared OpenGL context
+
+OpenGL context sharing objects with the main application context, created
+using @ref GlfwApplication::createSharedGLContext(). Make it current on a
+loader thread using @ref makeCurrent() and create a @ref Platform::GLContext
+instance there, after which buffer and texture data can be uploaded off the
+render thread. Hand the finished objects over to the main thread together
+with a @ref GL::Fence, see @ref platform-shared-contexts for an example.
+
+The context is owned by a hidden window, which has to be destroyed on the
+main thread before the application. Using the context on another thread
+requires Magnum to be built with @ref MAGNUM_BUILD_MULTITHREADED.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+*/
+class GlfwApplication::SharedGLContext {
+    public:
+        /**
+         * @brief Construct without creating the context
+         *
+         * Move a instance with created context over to make it usable.
+         */
+        explicit SharedGLContext(NoCreateT) noexcept {}
+
+        /** @brief Copying is not allowed */
+        SharedGLContext(const SharedGLContext&) = delete;
+
+        /** @brief Move constructor */
+        SharedGLContext(SharedGLContext&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys the hidden window and the context, if any. It's expected
+         * to not be current on any thread, see @ref release().
+         */
+        ~SharedGLContext();
+
+        /** @brief Copying is not allowed */
+        SharedGLContext& operator=(const SharedGLContext&) = delete;
+
+        /** @brief Move assignment */
+        SharedGLContext& operator=(SharedGLContext&& other) noexcept;
+
+        /** @brief Whether the context is created */
+        bool isCreated() const { return _window; }
+
+        /** @brief Make the context current on the calling thread */
+        void makeCurrent();
+
+        /** @brief Release the context from the calling thread */
+        void release();
+
+    private:
+        friend GlfwApplication;
+
+        explicit SharedGLContext(GLFWwindow* window) noexcept: _window{window} {}
+
+        GLFWwindow* _window{};
+};
 #endif
 
 namespace Implementation {
@@ -0,0 +1,120 @@
+#ifndef Magnum_Platform_Implementation_FramePacer_h
+#define Magnum_Platform_Implementation_FramePacer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace Platform { namespace Implementation {
+
+/* Frame pacing shared by the application main loops. Predicts CPU time of
+   the next frame from a moving average of previous frames and delays the
+   frame start (and thus input sampling) so the frame gets presented just
+   before the target period elapses. */
+struct FramePacer {
+    typedef std::chrono::steady_clock Clock;
+
+    /* Sleep is only as precise as the OS scheduler, which is a millisecond
+       or worse, so sleep only until shortly before the target and spin for
+       the rest */
+    static void waitUntil(const Clock::time_point target) {
+        constexpr std::chrono::milliseconds spin{2};
+        const Clock::time_point now = Clock::now();
+        if(target - now > spin)
+            std::this_thread::sleep_for(target - now - spin);
+        while(Clock::now() < target) std::this_thread::yield();
+    }
+
+    explicit FramePacer(const Clock::duration period, const Clock::duration margin): period{period}, margin{margin} {}
+
+    /* Average duration plus two mean deviations, so occasional slower frames
+       don't miss the present */
+    Clock::duration predictedFrameDuration() const {
+        return Clock::duration{Clock::duration::rep(averageFrameDuration + 2.0*frameDurationDeviation)};
+    }
+
+    /* Called at the start of a frame that's going to be drawn */
+    void startFrame() {
+        if(period != Clock::duration::zero() && presented)
+            waitUntil(lastPresent + period - predictedFrameDuration() - margin);
+        frameStart = Clock::now();
+    }
+
+    /* Called right before the buffer swap */
+    void beforePresent() {
+        /* Buffer swap outside of a frame, nothing to measure */
+        if(frameStart == Clock::time_point{}) return;
+
+        const Double duration = (Clock::now() - frameStart).count();
+        if(!measuredFrameCount++) {
+            averageFrameDuration = duration;
+            return;
+        }
+
+        frameDurationDeviation += (std::abs(duration - averageFrameDuration) - frameDurationDeviation)*0.125;
+        averageFrameDuration += (duration - averageFrameDuration)*0.125;
+    }
+
+    /* Called right after the buffer swap */
+    void afterPresent() {
+        const Clock::time_point now = Clock::now();
+        if(presented) {
+            const Double interval = (now - lastPresent).count();
+            ++presentCount;
+            intervalSum += interval;
+            intervalSquaredSum += interval*interval;
+            if(period != Clock::duration::zero())
+                maxDeviation = std::max(maxDeviation, std::abs(interval - period.count()));
+        }
+
+        lastPresent = now;
+        presented = true;
+    }
+
+    void resetStatistics() {
+        presentCount = 0;
+        intervalSum = intervalSquaredSum = maxDeviation = 0.0;
+    }
+
+    Clock::duration period, margin;
+    Clock::time_point frameStart, lastPresent;
+    bool presented{};
+
+    /* In clock ticks */
+    UnsignedInt measuredFrameCount{};
+    Double averageFrameDuration{}, frameDurationDeviation{};
+
+    UnsignedInt presentCount{};
+    Double intervalSum{}, intervalSquaredSum{}, maxDeviation{};
+};
+
+}}}
+
+#endif
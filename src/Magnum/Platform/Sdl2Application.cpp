@@ -27,6 +27,7 @@
 
 #include <cstring>
 #ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <cmath>
 #include <tuple>
 #else
 #include <emscripten/emscripten.h>
@@ -35,6 +36,9 @@
 #include "Magnum/Math/Range.h"
 #include "Magnum/Platform/ScreenedApplication.hpp"
 #include "Magnum/Platform/Implementation/dpiScaling.hpp"
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include "Magnum/Platform/Implementation/FramePacer.h"
+#endif
 
 #ifdef MAGNUM_TARGET_GL
 #include "Magnum/GL/Version.h"
@@ -60,6 +64,132 @@ Sdl2Application::InputEvent::Modifiers fixedModifiers(Uint16 mod) {
     return modifiers;
 }
 
+#if defined(CORRADE_TARGET_EMSCRIPTEN) && defined(__EMSCRIPTEN_PTHREADS__)
+/* Translation of DOM events proxied to a worker thread, mirroring what SDL
+   does for these on the main thread */
+template<class T> Sdl2Application::InputEvent::Modifiers domModifiers(const T& event) {
+    Sdl2Application::InputEvent::Modifiers modifiers;
+    if(event.shiftKey) modifiers |= Sdl2Application::InputEvent::Modifier::Shift;
+    if(event.ctrlKey) modifiers |= Sdl2Application::InputEvent::Modifier::Ctrl;
+    if(event.altKey) modifiers |= Sdl2Application::InputEvent::Modifier::Alt;
+    if(event.metaKey) modifiers |= Sdl2Application::InputEvent::Modifier::Super;
+    return modifiers;
+}
+
+Sdl2Application::MouseEvent::Button domMouseButton(const unsigned short button) {
+    switch(button) {
+        case 0: return Sdl2Application::MouseEvent::Button::Left;
+        case 1: return Sdl2Application::MouseEvent::Button::Middle;
+        case 2: return Sdl2Application::MouseEvent::Button::Right;
+        case 3: return Sdl2Application::MouseEvent::Button::X1;
+        case 4: return Sdl2Application::MouseEvent::Button::X2;
+    }
+
+    return Sdl2Application::MouseEvent::Button(button + 1);
+}
+
+Sdl2Application::MouseMoveEvent::Buttons domMouseButtons(const unsigned short buttons) {
+    /* DOM has right and middle button swapped compared to SDL */
+    Sdl2Application::MouseMoveEvent::Buttons out;
+    if(buttons & (1 << 0)) out |= Sdl2Application::MouseMoveEvent::Button::Left;
+    if(buttons & (1 << 1)) out |= Sdl2Application::MouseMoveEvent::Button::Right;
+    if(buttons & (1 << 2)) out |= Sdl2Application::MouseMoveEvent::Button::Middle;
+    if(buttons & (1 << 3)) out |= Sdl2Application::MouseMoveEvent::Button::X1;
+    if(buttons & (1 << 4)) out |= Sdl2Application::MouseMoveEvent::Button::X2;
+    return out;
+}
+
+Sdl2Application::KeyEvent::Key domKey(const EmscriptenKeyboardEvent& event) {
+    typedef Sdl2Application::KeyEvent::Key Key;
+
+    /* Keypad keys are distinguishable only by the physical key code */
+    if(std::strncmp(event.code, "Numpad", 6) == 0) {
+        const char* const name = event.code + 6;
+        constexpr Key numbers[]{Key::NumZero, Key::NumOne, Key::NumTwo,
+            Key::NumThree, Key::NumFour, Key::NumFive, Key::NumSix,
+            Key::NumSeven, Key::NumEight, Key::NumNine};
+        if(name[0] >= '0' && name[0] <= '9' && !name[1])
+            return numbers[name[0] - '0'];
+
+        constexpr struct {
+            const char* name;
+            Key key;
+        } keypad[]{
+            {"Decimal", Key::NumDecimal},
+            {"Divide", Key::NumDivide},
+            {"Multiply", Key::NumMultiply},
+            {"Subtract", Key::NumSubtract},
+            {"Add", Key::NumAdd},
+            {"Enter", Key::NumEnter},
+            {"Equal", Key::NumEqual}
+        };
+        for(const auto& key: keypad)
+            if(std::strcmp(name, key.name) == 0) return key.key;
+    }
+
+    /* Printable ASCII characters map directly to SDL keycodes, letters are
+       lowercase there */
+    const char c = event.key[0];
+    if(c >= ' ' && c < 127 && !event.key[1])
+        return Key(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+
+    /* Left and right modifiers share the same key name */
+    const bool right = event.location == DOM_KEY_LOCATION_RIGHT;
+    if(std::strcmp(event.key, "Shift") == 0)
+        return right ? Key::RightShift : Key::LeftShift;
+    if(std::strcmp(event.key, "Control") == 0)
+        return right ? Key::RightCtrl : Key::LeftCtrl;
+    if(std::strcmp(event.key, "Alt") == 0)
+        return right ? Key::RightAlt : Key::LeftAlt;
+    if(std::strcmp(event.key, "Meta") == 0)
+        return right ? Key::RightSuper : Key::LeftSuper;
+
+    constexpr struct {
+        const char* name;
+        Key key;
+    } named[]{
+        {"AltGraph", Key::AltGr},
+        {"Enter", Key::Enter},
+        {"Escape", Key::Esc},
+        {"ArrowUp", Key::Up},
+        {"ArrowDown", Key::Down},
+        {"ArrowLeft", Key::Left},
+        {"ArrowRight", Key::Right},
+        {"Home", Key::Home},
+        {"End", Key::End},
+        {"PageUp", Key::PageUp},
+        {"PageDown", Key::PageDown},
+        {"Backspace", Key::Backspace},
+        {"Insert", Key::Insert},
+        {"Delete", Key::Delete},
+        {"Tab", Key::Tab},
+        {"F1", Key::F1},
+        {"F2", Key::F2},
+        {"F3", Key::F3},
+        {"F4", Key::F4},
+        {"F5", Key::F5},
+        {"F6", Key::F6},
+        {"F7", Key::F7},
+        {"F8", Key::F8},
+        {"F9", Key::F9},
+        {"F10", Key::F10},
+        {"F11", Key::F11},
+        {"F12", Key::F12}
+    };
+    for(const auto& key: named)
+        if(std::strcmp(event.key, key.name) == 0) return key.key;
+
+    return Key::Unknown;
+}
+
+/* Named DOM keys such as "Enter" are ASCII words, printable keys are a
+   single (possibly multi-byte) UTF-8 character */
+bool isDomKeyPrintable(const char* const key) {
+    const unsigned char c = key[0];
+    return c >= 0x80 || (c >= ' ' && c < 127 && !key[1]);
+}
+#endif
+
 }
 
 Sdl2Application::Sdl2Application(const Arguments& arguments): Sdl2Application{arguments, Configuration{}} {}
@@ -77,6 +207,7 @@ Sdl2Application::Sdl2Application(const Arguments& arguments, const Configuration
 Sdl2Application::Sdl2Application(const Arguments& arguments, NoCreateT):
     #ifndef CORRADE_TARGET_EMSCRIPTEN
     _minimalLoopPeriod{0},
+    _framePacer{new Implementation::FramePacer{{}, {}}},
     #endif
     #ifdef MAGNUM_TARGET_GL
     _glContext{nullptr},
@@ -90,6 +221,14 @@ Sdl2Application::Sdl2Application(const Arguments& arguments, NoCreateT):
     args.parse(arguments.argc, arguments.argv);
     #endif
 
+    #if defined(CORRADE_TARGET_EMSCRIPTEN) && defined(__EMSCRIPTEN_PTHREADS__)
+    /* SDL in Emscripten accesses DOM already during initialization, which
+       isn't possible from a worker. Everything is done through the HTML5 API
+       directly in that case. */
+    if(!emscripten_is_main_browser_thread())
+        _flags |= Flag::Offscreen;
+    else
+    #endif
     if(SDL_Init(SDL_INIT_VIDEO) < 0) {
         Error() << "Cannot initialize SDL.";
         std::exit(1);
@@ -247,6 +386,13 @@ bool Sdl2Application::tryCreate(const Configuration& configuration) {
         return false;
     }
     #else
+    #ifdef __EMSCRIPTEN_PTHREADS__
+    if(_flags & Flag::Offscreen) {
+        Error() << "Platform::Sdl2Application::tryCreate(): contextless application can't run in a worker";
+        return false;
+    }
+    #endif
+
     /* Emscripten-specific initialization */
     if(!(_glContext = SDL_SetVideoMode(scaledWindowSize.x(), scaledWindowSize.y(), 24, SDL_OPENGL|SDL_HWSURFACE|SDL_DOUBLEBUF))) {
         Error() << "Platform::Sdl2Application::tryCreate(): cannot create window:" << SDL_GetError();
@@ -456,7 +602,12 @@ bool Sdl2Application::tryCreate(const Configuration& configuration, const GLConf
     /** @todo don't hardcode "module" here, make it configurable from outside */
     {
         Vector2d canvasSize;
-        emscripten_get_element_css_size("module", &canvasSize.x(), &canvasSize.y());
+        emscripten_get_element_css_size(
+            #ifdef __EMSCRIPTEN_PTHREADS__
+            /* Old-style ID lookup doesn't work from a worker */
+            _flags & Flag::Offscreen ? canvasTarget() :
+            #endif
+            "module", &canvasSize.x(), &canvasSize.y());
         _lastKnownCanvasSize = Vector2i{canvasSize};
     }
 
@@ -482,6 +633,38 @@ bool Sdl2Application::tryCreate(const Configuration& configuration, const GLConf
         flags |= SDL_RESIZABLE;
     }
 
+    #ifdef __EMSCRIPTEN_PTHREADS__
+    /* In a worker, create a WebGL context on the transferred OffscreenCanvas
+       directly, SDL can't do that */
+    if(_flags & Flag::Offscreen) {
+        emscripten_set_canvas_element_size(canvasTarget(), scaledWindowSize.x(), scaledWindowSize.y());
+
+        EmscriptenWebGLContextAttributes attributes;
+        emscripten_webgl_init_context_attributes(&attributes);
+        attributes.alpha = glConfiguration.colorBufferSize().a() > 0;
+        attributes.depth = glConfiguration.depthBufferSize() > 0;
+        attributes.stencil = glConfiguration.stencilBufferSize() > 0;
+        attributes.antialias = glConfiguration.sampleCount() > 1;
+        #ifdef MAGNUM_TARGET_GLES2
+        attributes.majorVersion = 1;
+        #else
+        attributes.majorVersion = 2;
+        #endif
+        /* Frames are committed explicitly in swapBuffers() and the GL calls
+           should never be proxied back to the main thread */
+        attributes.explicitSwapControl = true;
+        attributes.proxyContextToMainThread = EMSCRIPTEN_WEBGL_CONTEXT_PROXY_DISALLOW;
+
+        const EMSCRIPTEN_WEBGL_CONTEXT_HANDLE context = emscripten_webgl_create_context(canvasTarget(), &attributes);
+        if(context <= 0 || emscripten_webgl_make_context_current(context) != EMSCRIPTEN_RESULT_SUCCESS) {
+            Error() << "Platform::Sdl2Application::tryCreate(): cannot create context in a worker:" << Int(context);
+            if(context > 0) emscripten_webgl_destroy_context(context);
+            return false;
+        }
+
+        _offscreenContext = std::intptr_t(context);
+    } else
+    #endif
     if(!(_glContext = SDL_SetVideoMode(scaledWindowSize.x(), scaledWindowSize.y(), 24, flags))) {
         Error() << "Platform::Sdl2Application::tryCreate(): cannot create context:" << SDL_GetError();
         return false;
@@ -495,6 +678,12 @@ bool Sdl2Application::tryCreate(const Configuration& configuration, const GLConf
         SDL_DestroyWindow(_window);
         _window = nullptr;
         #else
+        #ifdef __EMSCRIPTEN_PTHREADS__
+        if(_offscreenContext) {
+            emscripten_webgl_destroy_context(EMSCRIPTEN_WEBGL_CONTEXT_HANDLE(_offscreenContext));
+            _offscreenContext = {};
+        } else
+        #endif
         SDL_FreeSurface(_glContext);
         #endif
         return false;
@@ -504,6 +693,10 @@ bool Sdl2Application::tryCreate(const Configuration& configuration, const GLConf
     /* Show the window once we are sure that everything is okay */
     if(!(configuration.windowFlags() & Configuration::WindowFlag::Hidden))
         SDL_ShowWindow(_window);
+    #elif defined(__EMSCRIPTEN_PTHREADS__)
+    /* SDL isn't delivering any input in a worker, get it proxied from the
+       main thread instead */
+    if(_flags & Flag::Offscreen) setupOffscreenInput();
     #endif
 
     /* Return true if the initialization succeeds */
@@ -517,8 +710,12 @@ Vector2i Sdl2Application::windowSize() const {
     CORRADE_ASSERT(_window, "Platform::Sdl2Application::windowSize(): no window opened", {});
     SDL_GetWindowSize(_window, &size.x(), &size.y());
     #else
+    #ifdef __EMSCRIPTEN_PTHREADS__
+    CORRADE_ASSERT(_glContext || _offscreenContext, "Platform::Sdl2Application::windowSize(): no window opened", {});
+    #else
     CORRADE_ASSERT(_glContext, "Platform::Sdl2Application::windowSize(): no window opened", {});
-    emscripten_get_canvas_element_size(nullptr, &size.x(), &size.y());
+    #endif
+    emscripten_get_canvas_element_size(canvasTarget(), &size.x(), &size.y());
     #endif
     return size;
 }
@@ -529,8 +726,12 @@ Vector2i Sdl2Application::framebufferSize() const {
     CORRADE_ASSERT(_window, "Platform::Sdl2Application::framebufferSize(): no window opened", {});
     SDL_GL_GetDrawableSize(_window, &size.x(), &size.y());
     #else
+    #ifdef __EMSCRIPTEN_PTHREADS__
+    CORRADE_ASSERT(_glContext || _offscreenContext, "Platform::Sdl2Application::framebufferSize(): no window opened", {});
+    #else
     CORRADE_ASSERT(_glContext, "Platform::Sdl2Application::framebufferSize(): no window opened", {});
-    emscripten_get_canvas_element_size(nullptr, &size.x(), &size.y());
+    #endif
+    emscripten_get_canvas_element_size(canvasTarget(), &size.x(), &size.y());
     #endif
     return size;
 }
@@ -539,19 +740,142 @@ Vector2i Sdl2Application::framebufferSize() const {
 void Sdl2Application::setContainerCssClass(const std::string& cssClass) {
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wdollar-in-identifier-extension"
+    #ifndef __EMSCRIPTEN_PTHREADS__
     EM_ASM_({document.getElementById('container').className = Pointer_stringify($0, $1);}, cssClass.data(), cssClass.size());
+    #else
+    /* There's no DOM in a worker, execute on the main thread */
+    MAIN_THREAD_EM_ASM({document.getElementById('container').className = Pointer_stringify($0, $1);}, cssClass.data(), cssClass.size());
+    #endif
     #pragma GCC diagnostic pop
 }
+
+const char* Sdl2Application::canvasTarget() const {
+    /* Null means Module.canvas, which isn't available in a worker */
+    #ifdef __EMSCRIPTEN_PTHREADS__
+    if(_flags & Flag::Offscreen) return "#module";
+    #endif
+    return nullptr;
+}
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+void Sdl2Application::setupOffscreenInput() {
+    /* The callbacks are registered on the main thread, which then queues the
+       events to be executed on this thread in between main loop iterations */
+    const auto mouseEvent = [](const int eventType, const EmscriptenMouseEvent* const event, void* const userData) -> EM_BOOL {
+        Sdl2Application& app = *static_cast<Sdl2Application*>(userData);
+        /* Target coordinates are in CSS pixels, canvas size isn't */
+        const Vector2i position{Vector2{Float(event->targetX), Float(event->targetY)}*app._dpiScaling};
+
+        if(eventType == EMSCRIPTEN_EVENT_MOUSEMOVE) {
+            MouseMoveEvent e{position, {Int(event->movementX), Int(event->movementY)}, domMouseButtons(event->buttons)};
+            e._modifiers = domModifiers(*event);
+            e._modifiersLoaded = true;
+            app.mouseMoveEvent(e);
+        } else {
+            MouseEvent e{domMouseButton(event->button), position};
+            e._modifiers = domModifiers(*event);
+            e._modifiersLoaded = true;
+            eventType == EMSCRIPTEN_EVENT_MOUSEDOWN ? app.mousePressEvent(e) : app.mouseReleaseEvent(e);
+        }
+        return true;
+    };
+
+    const auto wheelEvent = [](int, const EmscriptenWheelEvent* const event, void* const userData) -> EM_BOOL {
+        Sdl2Application& app = *static_cast<Sdl2Application*>(userData);
+
+        /* Same scaling as SDL does, DOM has Y going down */
+        Vector2 offset{-Float(event->deltaX), -Float(event->deltaY)};
+        switch(event->deltaMode) {
+            case DOM_DELTA_PIXEL: offset /= 100.0f; break;
+            case DOM_DELTA_LINE: offset /= 3.0f; break;
+            case DOM_DELTA_PAGE: offset *= 80.0f; break;
+        }
+
+        MouseScrollEvent e{offset};
+        e._position = Vector2i{Vector2{Float(event->mouse.targetX), Float(event->mouse.targetY)}*app._dpiScaling};
+        e._positionLoaded = true;
+        e._modifiers = domModifiers(event->mouse);
+        e._modifiersLoaded = true;
+        app.mouseScrollEvent(e);
+        return true;
+    };
+
+    const auto keyEvent = [](const int eventType, const EmscriptenKeyboardEvent* const event, void* const userData) -> EM_BOOL {
+        Sdl2Application& app = *static_cast<Sdl2Application*>(userData);
+        const InputEvent::Modifiers modifiers = domModifiers(*event);
+
+        KeyEvent e{domKey(*event), modifiers, !!event->repeat};
+        if(eventType == EMSCRIPTEN_EVENT_KEYUP) {
+            app.keyReleaseEvent(e);
+            return true;
+        }
+
+        app.keyPressEvent(e);
+
+        /* There's no IME in a worker, so generate text input from key presses
+           that aren't shortcuts */
+        if((app._flags & Flag::TextInputActive) && isDomKeyPrintable(event->key) && !(modifiers & (InputEvent::Modifier::Ctrl|InputEvent::Modifier::Super))) {
+            TextInputEvent te{{event->key, std::strlen(event->key)}};
+            app.textInputEvent(te);
+        }
+        return true;
+    };
+
+    const char* const canvas = canvasTarget();
+    emscripten_set_mousedown_callback_on_thread(canvas, this, false, mouseEvent, EM_CALLBACK_THREAD_CONTEXT_CALLING_THREAD);
+    emscripten_set_mouseup_callback_on_thread(canvas, this, false, mouseEvent, EM_CALLBACK_THREAD_CONTEXT_CALLING_THREAD);
+    emscripten_set_mousemove_callback_on_thread(canvas, this, false, mouseEvent, EM_CALLBACK_THREAD_CONTEXT_CALLING_THREAD);
+    emscripten_set_wheel_callback_on_thread(canvas, this, false, wheelEvent, EM_CALLBACK_THREAD_CONTEXT_CALLING_THREAD);
+    /* Canvas doesn't get keyboard focus by default, listen on the window */
+    emscripten_set_keydown_callback_on_thread(EMSCRIPTEN_EVENT_TARGET_WINDOW, this, false, keyEvent, EM_CALLBACK_THREAD_CONTEXT_CALLING_THREAD);
+    emscripten_set_keyup_callback_on_thread(EMSCRIPTEN_EVENT_TARGET_WINDOW, this, false, keyEvent, EM_CALLBACK_THREAD_CONTEXT_CALLING_THREAD);
+}
+#endif
 #endif
 
 void Sdl2Application::swapBuffers() {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _framePacer->beforePresent();
     SDL_GL_SwapWindow(_window);
+    _framePacer->afterPresent();
     #else
+    #ifdef __EMSCRIPTEN_PTHREADS__
+    if(_offscreenContext) emscripten_webgl_commit_frame();
+    else
+    #endif
     SDL_Flip(_glContext);
     #endif
 }
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void Sdl2Application::setFramePacing(const Float period, const Float margin) {
+    typedef std::chrono::duration<Float> Seconds;
+    _framePacer->period = std::chrono::duration_cast<Implementation::FramePacer::Clock::duration>(Seconds{period});
+    _framePacer->margin = std::chrono::duration_cast<Implementation::FramePacer::Clock::duration>(Seconds{margin});
+}
+
+auto Sdl2Application::framePacingStatistics() const -> FramePacingStatistics {
+    /* Clock ticks to seconds */
+    constexpr Double tick = Double(Implementation::FramePacer::Clock::period::num)/Implementation::FramePacer::Clock::period::den;
+
+    const Implementation::FramePacer& pacer = *_framePacer;
+    FramePacingStatistics out{};
+    out.presentCount = pacer.presentCount;
+    if(pacer.presentCount) {
+        const Double average = pacer.intervalSum/pacer.presentCount;
+        out.averagePresentInterval = Float(average*tick);
+        out.presentJitter = Float(std::sqrt(std::max(0.0, pacer.intervalSquaredSum/pacer.presentCount - average*average))*tick);
+        out.maxPresentDeviation = Float(pacer.maxDeviation*tick);
+    }
+    out.predictedFrameDuration = Float(pacer.predictedFrameDuration().count()*tick);
+    return out;
+}
+
+void Sdl2Application::resetFramePacingStatistics() {
+    _framePacer->resetStatistics();
+}
+#endif
+
 Int Sdl2Application::swapInterval() const {
     return SDL_GL_GetSwapInterval();
 }
@@ -573,6 +897,58 @@ bool Sdl2Application::setSwapInterval(const Int interval) {
     return true;
 }
 
+#if defined(MAGNUM_TARGET_GL) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+Sdl2Application::SharedGLContext Sdl2Application::createSharedGLContext() {
+    CORRADE_ASSERT(_glContext, "Platform::Sdl2Application::createSharedGLContext(): no context created", SharedGLContext{NoCreate});
+
+    /* The new context shares objects with whatever is current, so make sure
+       it's the main one. SDL_GL_CreateContext() makes the new context
+       current, switch back afterwards. */
+    SDL_GL_MakeCurrent(_window, _glContext);
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+    SDL_GLContext glContext = SDL_GL_CreateContext(_window);
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+    SDL_GL_MakeCurrent(_window, _glContext);
+
+    if(!glContext) {
+        Error() << "Platform::Sdl2Application::createSharedGLContext(): cannot create context:" << SDL_GetError();
+        return SharedGLContext{NoCreate};
+    }
+
+    return SharedGLContext{_window, glContext};
+}
+
+Sdl2Application::SharedGLContext::SharedGLContext(SharedGLContext&& other) noexcept: _window{other._window}, _glContext{other._glContext} {
+    other._window = {};
+    other._glContext = {};
+}
+
+Sdl2Application::SharedGLContext::~SharedGLContext() {
+    if(_glContext) SDL_GL_DeleteContext(_glContext);
+}
+
+Sdl2Application::SharedGLContext& Sdl2Application::SharedGLContext::operator=(SharedGLContext&& other) noexcept {
+    using std::swap;
+    swap(other._window, _window);
+    swap(other._glContext, _glContext);
+    return *this;
+}
+
+bool Sdl2Application::SharedGLContext::makeCurrent() {
+    if(SDL_GL_MakeCurrent(_window, _glContext) == 0) return true;
+
+    Error() << "Platform::Sdl2Application::SharedGLContext::makeCurrent(): cannot make context current:" << SDL_GetError();
+    return false;
+}
+
+bool Sdl2Application::SharedGLContext::release() {
+    if(SDL_GL_MakeCurrent(_window, nullptr) == 0) return true;
+
+    Error() << "Platform::Sdl2Application::SharedGLContext::release(): cannot release context:" << SDL_GetError();
+    return false;
+}
+#endif
+
 Sdl2Application::~Sdl2Application() {
     #ifdef MAGNUM_TARGET_GL
     _context.reset();
@@ -580,12 +956,20 @@ Sdl2Application::~Sdl2Application() {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
     SDL_GL_DeleteContext(_glContext);
     #else
+    #ifdef __EMSCRIPTEN_PTHREADS__
+    if(_offscreenContext)
+        emscripten_webgl_destroy_context(EMSCRIPTEN_WEBGL_CONTEXT_HANDLE(_offscreenContext));
+    else
+    #endif
     SDL_FreeSurface(_glContext);
     #endif
     #endif
 
     #ifndef CORRADE_TARGET_EMSCRIPTEN
     SDL_DestroyWindow(_window);
+    #elif defined(__EMSCRIPTEN_PTHREADS__)
+    /* SDL wasn't initialized in a worker */
+    if(_flags & Flag::Offscreen) return;
     #endif
     SDL_Quit();
 }
@@ -611,6 +995,11 @@ void Sdl2Application::exit() {
 
 void Sdl2Application::mainLoopIteration() {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* If a redraw is scheduled and frame pacing is enabled, wait before
+       processing any events so the input is sampled as late as possible */
+    const bool framePacing = _framePacer->period != Implementation::FramePacer::Clock::duration::zero();
+    if(framePacing && (_flags & Flag::Redraw)) _framePacer->startFrame();
+
     const UnsignedInt timeBefore = _minimalLoopPeriod ? SDL_GetTicks() : 0;
     #endif
 
@@ -622,12 +1011,17 @@ void Sdl2Application::mainLoopIteration() {
     if(_flags & Flag::Resizable) {
         /** @todo don't hardcode "module" here, make it configurable from outside */
         Vector2d canvasSize;
-        emscripten_get_element_css_size("module", &canvasSize.x(), &canvasSize.y());
+        emscripten_get_element_css_size(
+            #ifdef __EMSCRIPTEN_PTHREADS__
+            /* Old-style ID lookup doesn't work from a worker */
+            _flags & Flag::Offscreen ? canvasTarget() :
+            #endif
+            "module", &canvasSize.x(), &canvasSize.y());
         const Vector2i canvasSizei{canvasSize};
         if(canvasSizei != _lastKnownCanvasSize) {
             _lastKnownCanvasSize = canvasSizei;
             const Vector2i size = _dpiScaling*canvasSizei;
-            emscripten_set_canvas_element_size(nullptr, size.x(), size.y());
+            emscripten_set_canvas_element_size(canvasTarget(), size.x(), size.y());
             ViewportEvent e{size, size, _dpiScaling};
             viewportEvent(e);
             _flags |= Flag::Redraw;
@@ -636,6 +1030,11 @@ void Sdl2Application::mainLoopIteration() {
     #endif
 
     SDL_Event event;
+    #if defined(CORRADE_TARGET_EMSCRIPTEN) && defined(__EMSCRIPTEN_PTHREADS__)
+    /* In a worker the events are delivered through callbacks registered in
+       setupOffscreenInput() instead */
+    if(!(_flags & Flag::Offscreen))
+    #endif
     while(SDL_PollEvent(&event)) {
         switch(event.type) {
             case SDL_WINDOWEVENT:
@@ -734,12 +1133,23 @@ void Sdl2Application::mainLoopIteration() {
 
     /* Draw event */
     if(_flags & Flag::Redraw) {
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        /* Without frame pacing or if the redraw was requested only by the
+           events processed above the frame duration is measured from here,
+           there's no point in waiting as the input was already sampled */
+        if(_framePacer->frameStart == Implementation::FramePacer::Clock::time_point{})
+            _framePacer->frameStart = Implementation::FramePacer::Clock::now();
+        #endif
+
         _flags &= ~Flag::Redraw;
         drawEvent();
 
         #ifndef CORRADE_TARGET_EMSCRIPTEN
+        /* Frame pacing does the waiting on its own */
+        _framePacer->frameStart = {};
+
         /* If VSync is not enabled, delay to prevent CPU hogging (if set) */
-        if(!(_flags & Flag::VSyncEnabled) && _minimalLoopPeriod) {
+        if(!framePacing && !(_flags & Flag::VSyncEnabled) && _minimalLoopPeriod) {
             const UnsignedInt loopTime = SDL_GetTicks() - timeBefore;
             if(loopTime < _minimalLoopPeriod)
                 SDL_Delay(_minimalLoopPeriod - loopTime);
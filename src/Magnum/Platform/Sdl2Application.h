@@ -58,6 +58,9 @@ namespace Magnum { namespace Platform {
 
 namespace Implementation {
     enum class Sdl2DpiScalingPolicy: UnsignedByte;
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    struct FramePacer;
+    #endif
 }
 
 /** @nosubgrouping
@@ -254,6 +257,29 @@ If you enable @ref Configuration::WindowFlag::Resizable, the canvas will be
 resized when size of the canvas changes and you get @ref viewportEvent(). If
 the flag is not enabled, no canvas resizing is performed.
 
+@subsection Platform-Sdl2Application-usage-emscripten-worker Rendering from a Web Worker
+
+By default the application runs and renders on the browser main thread,
+competing with JavaScript and layout of the page. If Magnum is built with
+Emscripten pthreads support, the application can instead run on a worker
+thread and render into an
+[OffscreenCanvas](https://developer.mozilla.org/en-US/docs/Web/API/OffscreenCanvas)
+transferred from the @cb{.html} <canvas id="module"> @ce element. Link the
+application with the following flags to have @cpp main() @ce executed on a
+worker thread and the canvas transferred to it:
+
+@code{.sh}
+-s USE_PTHREADS=1 -s PROXY_TO_PTHREAD=1 -s OFFSCREENCANVAS_SUPPORT=1 -s OFFSCREENCANVASES_TO_PTHREAD="#module"
+@endcode
+
+The application detects that it's not running on the browser main thread and
+creates a WebGL context on the transferred canvas directly instead of going
+through SDL, which isn't able to work off the main thread. Mouse, scroll and
+keyboard events are received on the main thread and proxied to the worker,
+where they're delivered to the usual event handlers. Text input events are
+generated from key presses and thus don't support IME composition. You can
+check whether the application runs in this mode using @ref isOffscreen().
+
 @section Platform-Sdl2Application-dpi DPI awareness
 
 On displays that match the platform default DPI (96 or 72),
@@ -351,6 +377,9 @@ class Sdl2Application {
         class Configuration;
         #ifdef MAGNUM_TARGET_GL
         class GLConfiguration;
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        class SharedGLContext;
+        #endif
         #endif
         class ViewportEvent;
         class InputEvent;
@@ -625,6 +654,26 @@ class Sdl2Application {
          */
         Vector2 dpiScaling(const Configuration& configuration) const;
 
+        #if defined(MAGNUM_TARGET_GL) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+        /**
+         * @brief Create a shared OpenGL context
+         *
+         * Creates a new OpenGL context sharing objects with the main one,
+         * meant to be made current on a loader thread for uploading data
+         * off the render thread. Expects that the main context is already
+         * created. Prints error message and returns a
+         * @ref SharedGLContext::isCreated() "non-created" instance on failure.
+         * Has to be called from the main thread. See @ref SharedGLContext for
+         * more information.
+         *
+         * @note This function is available only if Magnum is compiled with
+         *      @ref MAGNUM_TARGET_GL enabled (done by default). See
+         *      @ref building-features for more information. Not available in
+         *      @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         */
+        SharedGLContext createSharedGLContext();
+        #endif
+
         #if defined(CORRADE_TARGET_EMSCRIPTEN) || defined(DOXYGEN_GENERATING_OUTPUT)
         /**
          * @brief Set container CSS class
@@ -674,11 +723,89 @@ class Sdl2Application {
          * (i.e. looping at maximum frequency).
          * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten",
          *      the browser is managing the frequency instead.
-         * @see @ref setSwapInterval()
+         * @see @ref setSwapInterval(), @ref setFramePacing()
          */
         void setMinimalLoopPeriod(UnsignedInt milliseconds) {
             _minimalLoopPeriod = milliseconds;
         }
+
+        /**
+         * @brief Frame pacing statistics
+         *
+         * @see @ref framePacingStatistics()
+         */
+        struct FramePacingStatistics {
+            /** @brief Count of measured present-to-present intervals */
+            UnsignedInt presentCount;
+
+            /** @brief Average present-to-present interval in seconds */
+            Float averagePresentInterval;
+
+            /**
+             * @brief Present jitter in seconds
+             *
+             * Standard deviation of the present-to-present intervals.
+             */
+            Float presentJitter;
+
+            /**
+             * @brief Max present deviation in seconds
+             *
+             * Largest absolute difference between a present-to-present
+             * interval and the period set in @ref setFramePacing().
+             */
+            Float maxPresentDeviation;
+
+            /**
+             * @brief Predicted frame duration in seconds
+             *
+             * CPU time between the start of a frame and its
+             * @ref swapBuffers() call the pacer currently expects.
+             */
+            Float predictedFrameDuration;
+        };
+
+        /**
+         * @brief Set frame pacing
+         * @param period    Target present-to-present period in seconds
+         * @param margin    Safety margin in seconds
+         *
+         * When enabled, the main loop predicts how long the next frame takes
+         * from a moving average of previous frame durations and, if a redraw
+         * is requested, delays processing input events and calling
+         * @ref drawEvent() so @ref swapBuffers() happens just before @p period
+         * elapses since the previous present. This reduces the latency
+         * between input sampling and the frame being shown. The wait sleeps
+         * for the bulk of the time and spins only for the last two
+         * milliseconds to avoid scheduler imprecision. Pass @cpp 0.0f @ce to
+         * disable frame pacing, which is the default.
+         *
+         * When enabled, @ref setMinimalLoopPeriod() has no effect for
+         * iterations that redraw. Usually you want to set @p period to the
+         * display refresh period with VSync disabled, or slightly below it
+         * with VSync enabled.
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten",
+         *      the browser is managing the frequency instead.
+         * @see @ref setSwapInterval(), @ref framePacingStatistics()
+         */
+        void setFramePacing(Float period, Float margin = 0.001f);
+
+        /**
+         * @brief Frame pacing statistics
+         *
+         * Present intervals are measured also if frame pacing isn't enabled
+         * via @ref setFramePacing(); @ref FramePacingStatistics::maxPresentDeviation
+         * is calculated only with frame pacing enabled.
+         * @see @ref resetFramePacingStatistics()
+         */
+        FramePacingStatistics framePacingStatistics() const;
+
+        /**
+         * @brief Reset frame pacing statistics
+         *
+         * Useful e.g. for measuring each second separately.
+         */
+        void resetFramePacingStatistics();
         #endif
 
         /**
@@ -911,13 +1038,21 @@ class Sdl2Application {
             #endif
             #ifdef CORRADE_TARGET_EMSCRIPTEN
             TextInputActive = 1 << 4,
-            Resizable = 1 << 5
+            Resizable = 1 << 5,
+            Offscreen = 1 << 6
             #endif
         };
 
         typedef Containers::EnumSet<Flag> Flags;
         CORRADE_ENUMSET_FRIEND_OPERATORS(Flags)
 
+        #ifdef CORRADE_TARGET_EMSCRIPTEN
+        const char* canvasTarget() const;
+        #ifdef __EMSCRIPTEN_PTHREADS__
+        void setupOffscreenInput();
+        #endif
+        #endif
+
         /* These are saved from command-line arguments */
         bool _verboseLog{};
         Implementation::Sdl2DpiScalingPolicy _commandLineDpiScalingPolicy{};
@@ -928,8 +1063,14 @@ class Sdl2Application {
         #ifndef CORRADE_TARGET_EMSCRIPTEN
         SDL_Window* _window{};
         UnsignedInt _minimalLoopPeriod;
+        std::unique_ptr<Implementation::FramePacer> _framePacer;
         #else
         Vector2i _lastKnownCanvasSize;
+        #ifdef __EMSCRIPTEN_PTHREADS__
+        /* EMSCRIPTEN_WEBGL_CONTEXT_HANDLE, which is either int or intptr_t
+           depending on Emscripten version */
+        std::intptr_t _offscreenContext{};
+        #endif
         #endif
 
         #ifdef MAGNUM_TARGET_GL
@@ -1150,6 +1291,82 @@ class Sdl2Application::GLConfiguration {
 
 #ifndef CORRADE_TARGET_EMSCRIPTEN
 CORRADE_ENUMSET_OPERATORS(Sdl2Application::GLConfiguration::Flags)
+
+/**
+@brief Shared OpenGL context
+
+OpenGL context sharing objects with the main application context, created
+using @ref Sdl2Application::createSharedGLContext(). Make it current on a
+loader thread using @ref makeCurrent() and create a @ref Platform::GLContext
+instance there, after which buffer and texture data can be uploaded off the
+render thread. Hand the finished objects over to the main thread together
+with a @ref GL::Fence, see @ref platform-shared-contexts for an example.
+
+The context is created for the application window, so it has to be
+destroyed before the application. Using the context on another thread
+requires Magnum to be built with @ref MAGNUM_BUILD_MULTITHREADED.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information. Not available in
+    @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+*/
+class Sdl2Application::SharedGLContext {
+    public:
+        /**
+         * @brief Construct without creating the context
+         *
+         * Move a instance with created context over to make it usable.
+         */
+        explicit SharedGLContext(NoCreateT) noexcept {}
+
+        /** @brief Copying is not allowed */
+        SharedGLContext(const SharedGLContext&) = delete;
+
+        /** @brief Move constructor */
+        SharedGLContext(SharedGLContext&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys the context, if any. It's expected to not be current on
+         * any thread, see @ref release().
+         */
+        ~SharedGLContext();
+
+        /** @brief Copying is not allowed */
+        SharedGLContext& operator=(const SharedGLContext&) = delete;
+
+        /** @brief Move assignment */
+        SharedGLContext& operator=(SharedGLContext&& other) noexcept;
+
+        /** @brief Whether the context is created */
+        bool isCreated() const { return _glContext; }
+
+        /**
+         * @brief Make the context current on the calling thread
+         *
+         * Prints error message and returns @cpp false @ce on failure,
+         * otherwise returns @cpp true @ce.
+         */
+        bool makeCurrent();
+
+        /**
+         * @brief Release the context from the calling thread
+         *
+         * Prints error message and returns @cpp false @ce on failure,
+         * otherwise returns @cpp true @ce.
+         */
+        bool release();
+
+    private:
+        friend Sdl2Application;
+
+        explicit SharedGLContext(SDL_Window* window, SDL_GLContext glContext) noexcept: _window{window}, _glContext{glContext} {}
+
+        SDL_Window* _window{};
+        SDL_GLContext _glContext{};
+};
 #endif
 #endif
 
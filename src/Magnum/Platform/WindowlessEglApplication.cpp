@@ -25,9 +25,19 @@
 
 #include "WindowlessEglApplication.h"
 
+#include <map>
+#include <mutex>
+#include <vector>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 
+#if defined(MAGNUM_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <thread>
+#endif
+
 #include "Magnum/GL/Version.h"
 #include "Magnum/Platform/GLContext.h"
 
@@ -35,13 +45,93 @@
 
 namespace Magnum { namespace Platform {
 
+namespace {
+
+/* All contexts on the same device get the same EGLDisplay and eglTerminate()
+   destroys all resources on it, so the display is initialized on first use
+   and terminated only after the last context using it is gone */
+std::mutex displayMutex;
+std::map<EGLDisplay, std::size_t> displayReferences;
+
+bool initializeDisplay(EGLDisplay display) {
+    std::lock_guard<std::mutex> lock{displayMutex};
+    std::size_t& references = displayReferences[display];
+    if(!references && !eglInitialize(display, nullptr, nullptr)) {
+        displayReferences.erase(display);
+        return false;
+    }
+
+    ++references;
+    return true;
+}
+
+void terminateDisplay(EGLDisplay display) {
+    std::lock_guard<std::mutex> lock{displayMutex};
+    auto found = displayReferences.find(display);
+    CORRADE_INTERNAL_ASSERT(found != displayReferences.end());
+    if(--found->second) return;
+
+    eglTerminate(display);
+    displayReferences.erase(found);
+}
+
+#if !defined(MAGNUM_TARGET_WEBGL) && defined(EGL_EXT_device_enumeration) && defined(EGL_EXT_platform_device)
+/* Returns all available devices, empty if the extensions are not supported */
+std::vector<EGLDeviceEXT> queryDevices() {
+    auto eglQueryDevices = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+    EGLint count;
+    if(!eglQueryDevices || !eglQueryDevices(0, nullptr, &count))
+        return {};
+
+    std::vector<EGLDeviceEXT> devices(count);
+    eglQueryDevices(count, devices.data(), &count);
+    devices.resize(count);
+    return devices;
+}
+#endif
+
+}
+
+#ifndef MAGNUM_TARGET_WEBGL
+UnsignedInt WindowlessEglContext::deviceCount() {
+    #if defined(EGL_EXT_device_enumeration) && defined(EGL_EXT_platform_device)
+    return queryDevices().size();
+    #else
+    return 0;
+    #endif
+}
+#endif
+
 WindowlessEglContext::WindowlessEglContext(const Configuration& configuration, GLContext*) {
+    /* Get the display, either the default one or for given device */
+    EGLDisplay display = EGL_NO_DISPLAY;
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(configuration.device() != ~UnsignedInt{}) {
+        #if defined(EGL_EXT_device_enumeration) && defined(EGL_EXT_platform_device)
+        const std::vector<EGLDeviceEXT> devices = queryDevices();
+        auto eglGetPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if(configuration.device() >= devices.size() || !eglGetPlatformDisplay) {
+            Error() << "Platform::WindowlessEglApplication::tryCreateContext(): requested EGL device" << configuration.device() << "but only" << devices.size() << "found";
+            return;
+        }
+
+        display = eglGetPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[configuration.device()], nullptr);
+        #else
+        Error() << "Platform::WindowlessEglApplication::tryCreateContext(): EGL device selection is not supported by the EGL headers";
+        return;
+        #endif
+    } else
+    #endif
+    {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
     /* Initialize */
-    _display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
-    if(!eglInitialize(_display, nullptr, nullptr)) {
+    if(!initializeDisplay(display)) {
         Error() << "Platform::WindowlessEglApplication::tryCreateContext(): cannot initialize EGL:" << Implementation::eglErrorString(eglGetError());
         return;
     }
+    _display = display;
 
     const EGLenum api =
         #ifndef MAGNUM_TARGET_GLES
@@ -121,7 +211,7 @@ WindowlessEglContext::WindowlessEglContext(WindowlessEglContext&& other): _displ
 
 WindowlessEglContext::~WindowlessEglContext() {
     if(_context) eglDestroyContext(_display, _context);
-    if(_display) eglTerminate(_display);
+    if(_display) terminateDisplay(_display);
 }
 
 WindowlessEglContext& WindowlessEglContext::operator=(WindowlessEglContext && other) {
@@ -139,6 +229,14 @@ bool WindowlessEglContext::makeCurrent() {
     return false;
 }
 
+bool WindowlessEglContext::release() {
+    if(eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT))
+        return true;
+
+    Error() << "Platform::WindowlessEglContext::release(): cannot release current context:" << Implementation::eglErrorString(eglGetError());
+    return false;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 WindowlessEglApplication::WindowlessEglApplication(const Arguments& arguments): WindowlessEglApplication{arguments, Configuration{}} {}
 #endif
@@ -168,4 +266,125 @@ bool WindowlessEglApplication::tryCreateContext(const Configuration& configurati
 
 WindowlessEglApplication::~WindowlessEglApplication() = default;
 
+#if defined(MAGNUM_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+struct WindowlessEglContextPool::Worker {
+    explicit Worker(const WindowlessEglContext::Configuration& configuration): context{configuration} {}
+
+    WindowlessEglContext context;
+    std::thread thread;
+};
+
+struct WindowlessEglContextPool::State {
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobsDone;
+    std::deque<std::function<void(std::size_t)>> jobs;
+    std::size_t runningJobCount{};
+    bool stopping{};
+
+    void work(std::size_t id);
+};
+
+void WindowlessEglContextPool::State::work(const std::size_t id) {
+    for(;;) {
+        std::function<void(std::size_t)> job;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            jobAvailable.wait(lock, [&]() { return stopping || !jobs.empty(); });
+
+            /* Pending jobs are finished before stopping */
+            if(jobs.empty()) return;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+            ++runningJobCount;
+        }
+
+        job(id);
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            if(!--runningJobCount && jobs.empty()) jobsDone.notify_all();
+        }
+    }
+}
+
+WindowlessEglContextPool::WindowlessEglContextPool(const std::vector<WindowlessEglContext::Configuration>& configurations, const Int argc, const char** const argv): _state{new State} {
+    _state->workers.reserve(configurations.size());
+    for(const WindowlessEglContext::Configuration& configuration: configurations) {
+        std::unique_ptr<Worker> worker{new Worker{configuration}};
+        if(!worker->context.isCreated()) continue;
+
+        /* Create the Magnum contexts one after another, as context creation
+           is not thread-safe everywhere */
+        State& state = *_state;
+        WindowlessEglContext& glContext = worker->context;
+        const std::size_t id = state.workers.size();
+        std::promise<bool> created;
+        worker->thread = std::thread{[&state, &glContext, &created, id, argc, argv]() {
+            if(!glContext.makeCurrent()) {
+                created.set_value(false);
+                return;
+            }
+
+            {
+                GLContext context{NoCreate, argc, argv};
+                if(!context.tryCreate()) {
+                    glContext.release();
+                    created.set_value(false);
+                    return;
+                }
+
+                created.set_value(true);
+                state.work(id);
+            }
+
+            /* The EGL context is destroyed from the main thread, release it
+               here */
+            glContext.release();
+        }};
+        if(!created.get_future().get()) {
+            worker->thread.join();
+            continue;
+        }
+
+        state.workers.push_back(std::move(worker));
+    }
+}
+
+WindowlessEglContextPool::~WindowlessEglContextPool() {
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->stopping = true;
+    }
+    _state->jobAvailable.notify_all();
+
+    for(std::unique_ptr<Worker>& worker: _state->workers)
+        worker->thread.join();
+}
+
+std::size_t WindowlessEglContextPool::workerCount() const {
+    return _state->workers.size();
+}
+
+void WindowlessEglContextPool::submit(std::function<void(std::size_t)> job) {
+    CORRADE_ASSERT(!_state->workers.empty(),
+        "Platform::WindowlessEglContextPool::submit(): no workers available", );
+
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->jobs.push_back(std::move(job));
+    }
+    _state->jobAvailable.notify_one();
+}
+
+void WindowlessEglContextPool::wait() {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    _state->jobsDone.wait(lock, [&]() {
+        return _state->jobs.empty() && !_state->runningJobCount;
+    });
+}
+#endif
+
 }}
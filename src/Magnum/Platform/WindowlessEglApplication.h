@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Platform::WindowlessEglApplication, @ref Magnum::Platform::WindowlessEglContext, macro @ref MAGNUM_WINDOWLESSEGLAPPLICATION_MAIN()
+ * @brief Class @ref Magnum::Platform::WindowlessEglApplication, @ref Magnum::Platform::WindowlessEglContext, @ref Magnum::Platform::WindowlessEglContextPool, macro @ref MAGNUM_WINDOWLESSEGLAPPLICATION_MAIN()
  */
 
 #include <memory>
@@ -44,6 +44,11 @@
 #include "Magnum/Tags.h"
 #include "Magnum/Platform/Platform.h"
 
+#if defined(MAGNUM_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <functional>
+#include <vector>
+#endif
+
 namespace Magnum { namespace Platform {
 
 /**
@@ -57,11 +62,32 @@ Meant to be used when there is a need to manage (multiple) GL contexts
 manually. See @ref platform-windowless-contexts for more information. If no
 other application header is included, this class is also aliased to
 @cpp Platform::WindowlessGLContext @ce.
+
+@section Platform-WindowlessEglContext-devices Multiple devices
+
+On systems with more than one GPU, the context can be created on a particular
+EGL device using @ref Configuration::setDevice(), with the device count
+available through @ref deviceCount(). Contexts on the same device share the
+EGL display, which is terminated only after the last context using it is
+destroyed. See @ref WindowlessEglContextPool for a way to distribute rendering
+across multiple contexts and threads.
 */
 class WindowlessEglContext {
     public:
         class Configuration;
 
+        #ifndef MAGNUM_TARGET_WEBGL
+        /**
+         * @brief Count of available EGL devices
+         *
+         * Uses the @m_class{m-doc-external} [EGL_EXT_device_enumeration](https://www.khronos.org/registry/EGL/extensions/EXT/EGL_EXT_device_enumeration.txt)
+         * extension. Returns @cpp 0 @ce if the extension is not available.
+         * @see @ref Configuration::setDevice()
+         * @requires_gles Device enumeration is not available in WebGL.
+         */
+        static UnsignedInt deviceCount();
+        #endif
+
         /**
          * @brief Constructor
          * @param configuration Context configuration
@@ -112,6 +138,16 @@ class WindowlessEglContext {
          */
         bool makeCurrent();
 
+        /**
+         * @brief Release current context
+         *
+         * Makes no context current on the calling thread, allowing the
+         * context to be made current on another thread. Prints error message
+         * and returns @cpp false @ce on failure, otherwise returns
+         * @cpp true @ce.
+         */
+        bool release();
+
     private:
         EGLDisplay _display{};
         EGLContext _context{};
@@ -172,14 +208,148 @@ class WindowlessEglContext::Configuration {
             _flags = flags;
             return *this;
         }
+
+        /**
+         * @brief Device ID
+         *
+         * @requires_gles Device selection is not available in WebGL.
+         */
+        UnsignedInt device() const { return _device; }
+
+        /**
+         * @brief Set device ID
+         * @return Reference to self (for method chaining)
+         *
+         * The @p id is expected to be less than
+         * @ref WindowlessEglContext::deviceCount(). The device is then
+         * selected using the @m_class{m-doc-external} [EGL_EXT_platform_device](https://www.khronos.org/registry/EGL/extensions/EXT/EGL_EXT_platform_device.txt)
+         * extension. Default is @cpp ~UnsignedInt{} @ce, which uses the
+         * default EGL display.
+         * @requires_gles Device selection is not available in WebGL.
+         */
+        Configuration& setDevice(UnsignedInt id) {
+            _device = id;
+            return *this;
+        }
         #endif
 
     private:
         #ifndef MAGNUM_TARGET_WEBGL
         Flags _flags;
+        UnsignedInt _device{~UnsignedInt{}};
         #endif
 };
 
+#if defined(MAGNUM_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+/**
+@brief Pool of windowless EGL contexts
+
+Creates one @ref WindowlessEglContext for each passed configuration, each of
+them having a dedicated worker thread with the context and a corresponding
+@ref GLContext current, and dispatches submitted jobs to whichever worker is
+free. Useful for batch rendering such as thumbnail generation on a server,
+where a single context on a single thread doesn't make use of all available
+GPUs and cores. For example, four contexts on each available device:
+
+@code{.cpp}
+std::vector<Platform::WindowlessEglContext::Configuration> configurations;
+for(UnsignedInt i = 0; i != Platform::WindowlessEglContext::deviceCount(); ++i)
+    for(UnsignedInt j = 0; j != 4; ++j)
+        configurations.push_back(Platform::WindowlessEglContext::Configuration{}
+            .setDevice(i));
+
+Platform::WindowlessEglContextPool pool{configurations};
+for(const std::string& asset: assets) pool.submit([&asset](std::size_t) {
+    // render a thumbnail of asset using GL::Context::current()
+});
+pool.wait();
+@endcode
+
+Each job gets called with index of the worker it runs on, which can be used
+to access per-worker resources such as framebuffers or shaders. Because
+@ref GL::Context::current() is thread-local, all Magnum GL state tracking is
+done separately for each worker, but OpenGL objects can't be shared between
+workers.
+
+The EGL contexts are created on the thread that constructs the pool and the
+@ref GLContext instances are created one after another, as context creation
+is not thread-safe on all platforms. Since OpenGL function pointers are
+global, all devices are expected to be driven by the same driver. Workers for
+which the context creation fails are skipped with an error message printed,
+see @ref workerCount().
+
+This class is available only if Magnum is built with
+@ref MAGNUM_BUILD_MULTITHREADED.
+*/
+class WindowlessEglContextPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param configurations    Configuration of each context
+         * @param argc              Count of command-line arguments passed to
+         *      each @ref GLContext
+         * @param argv              Command-line arguments passed to each
+         *      @ref GLContext
+         *
+         * Creates the contexts and starts the worker threads, waiting until
+         * all of them are ready.
+         */
+        explicit WindowlessEglContextPool(const std::vector<WindowlessEglContext::Configuration>& configurations, Int argc = 0, const char** argv = nullptr);
+
+        /** @brief Copying is not allowed */
+        WindowlessEglContextPool(const WindowlessEglContextPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        WindowlessEglContextPool(WindowlessEglContextPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Finishes all pending jobs, destroys the contexts and stops the
+         * worker threads.
+         */
+        ~WindowlessEglContextPool();
+
+        /** @brief Copying is not allowed */
+        WindowlessEglContextPool& operator=(const WindowlessEglContextPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        WindowlessEglContextPool& operator=(WindowlessEglContextPool&&) = delete;
+
+        /**
+         * @brief Worker count
+         *
+         * Count of workers that succeeded in creating their context. Can be
+         * less than count of configurations passed to the constructor.
+         */
+        std::size_t workerCount() const;
+
+        /**
+         * @brief Submit a job
+         *
+         * The @p job is called on the first free worker with index of the
+         * worker as a parameter. Jobs are started in the order they were
+         * submitted. Expects that there is at least one worker.
+         * @see @ref wait()
+         */
+        void submit(std::function<void(std::size_t)> job);
+
+        /**
+         * @brief Wait for all submitted jobs to finish
+         *
+         * Blocks the calling thread until the job queue is empty and no
+         * worker is running a job.
+         */
+        void wait();
+
+    private:
+        struct Worker;
+        struct State;
+
+        std::unique_ptr<State> _state;
+};
+#endif
+
 /**
 @brief Windowless EGL application
 
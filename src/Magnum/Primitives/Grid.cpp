@@ -26,50 +26,86 @@
 #include "Grid.h"
 
 #include "Magnum/Mesh.h"
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Trade/MeshData3D.h"
 
 namespace Magnum { namespace Primitives {
 
-Trade::MeshData3D grid3DSolid(const Vector2i& subdivisions, const GridFlags flags) {
+UnsignedInt grid3DSolidVertexCount(const Vector2i& subdivisions) {
+    return (subdivisions + Vector2i{2}).product();
+}
+
+UnsignedInt grid3DSolidIndexCount(const Vector2i& subdivisions) {
+    return (subdivisions + Vector2i{1}).product()*6;
+}
+
+void grid3DSolidInto(const Vector2i& subdivisions, const Containers::StridedArrayView<Vector3> positions, const Containers::StridedArrayView<Vector3> normals, const Containers::StridedArrayView<Vector2> textureCoordinates, const Containers::ArrayView<UnsignedInt> indices, const UnsignedInt threadCount) {
     const Vector2i vertexCount = subdivisions + Vector2i{2};
     const Vector2i faceCount = subdivisions + Vector2i{1};
 
-    std::vector<Vector3> positions;
-    positions.reserve(vertexCount.product());
-    for(Int y = 0; y != vertexCount.y(); ++y)
-        for(Int x = 0; x != vertexCount.x(); ++x)
-            positions.emplace_back((Vector2(x, y)/Vector2(faceCount))*2.0f - Vector2{1.0f}, 0.0f);
+    CORRADE_ASSERT(positions.size() == std::size_t(vertexCount.product()),
+        "Primitives::grid3DSolidInto(): expected" << vertexCount.product() << "positions but got" << positions.size(), );
+    CORRADE_ASSERT(!normals.size() || normals.size() == positions.size(),
+        "Primitives::grid3DSolidInto(): expected" << positions.size() << "or no normals but got" << normals.size(), );
+    CORRADE_ASSERT(!textureCoordinates.size() || textureCoordinates.size() == positions.size(),
+        "Primitives::grid3DSolidInto(): expected" << positions.size() << "or no texture coordinates but got" << textureCoordinates.size(), );
+    CORRADE_ASSERT(indices.size() == std::size_t(faceCount.product()*6),
+        "Primitives::grid3DSolidInto(): expected" << faceCount.product()*6 << "indices but got" << indices.size(), );
+
+    /* Each task fills one row of vertices and, except for the last one, one
+       row of faces above it. The rows don't overlap, so no synchronization is
+       needed. */
+    Magnum::Implementation::parallelFor(threadCount, vertexCount.y(), [&](const std::size_t task) {
+        const Int y = Int(task);
+        for(Int x = 0; x != vertexCount.x(); ++x) {
+            const std::size_t i = y*vertexCount.x() + x;
+            /* Not reading the position back, as the output can be a
+               write-only mapped buffer */
+            const Vector2 position = (Vector2(x, y)/Vector2(faceCount))*2.0f - Vector2{1.0f};
+            positions[i] = {position, 0.0f};
+            if(normals.size()) normals[i] = Vector3::zAxis(1.0f);
+            if(textureCoordinates.size())
+                textureCoordinates[i] = position*0.5f + Vector2{0.5f};
+        }
+
+        if(y == faceCount.y()) return;
 
-    std::vector<UnsignedInt> indices;
-    indices.reserve(faceCount.product()*6);
-    for(Int y = 0; y != faceCount.y(); ++y) {
         for(Int x = 0; x != faceCount.x(); ++x) {
             /* 2--1 5
                | / /|
                |/ / |
                0 3--4 */
-            indices.insert(indices.end(), {
-                UnsignedInt(y*vertexCount.x() + x),
-                UnsignedInt((y + 1)*vertexCount.x() + x + 1),
-                UnsignedInt((y + 1)*vertexCount.x() + x + 0),
-                UnsignedInt(y*vertexCount.x() + x),
-                UnsignedInt(y*vertexCount.x() + x + 1),
-                UnsignedInt((y + 1)*vertexCount.x() + x + 1)});
+            UnsignedInt* const face = indices.data() + (y*faceCount.x() + x)*6;
+            face[0] = UnsignedInt(y*vertexCount.x() + x);
+            face[1] = UnsignedInt((y + 1)*vertexCount.x() + x + 1);
+            face[2] = UnsignedInt((y + 1)*vertexCount.x() + x + 0);
+            face[3] = UnsignedInt(y*vertexCount.x() + x);
+            face[4] = UnsignedInt(y*vertexCount.x() + x + 1);
+            face[5] = UnsignedInt((y + 1)*vertexCount.x() + x + 1);
         }
-    }
+    });
+}
+
+Trade::MeshData3D grid3DSolid(const Vector2i& subdivisions, const GridFlags flags) {
+    std::vector<Vector3> positions(grid3DSolidVertexCount(subdivisions));
+    std::vector<UnsignedInt> indices(grid3DSolidIndexCount(subdivisions));
 
     std::vector<std::vector<Vector3>> normals;
     if(flags & GridFlag::GenerateNormals)
-        normals.emplace_back(positions.size(), Vector3::zAxis(1.0f));
+        normals.emplace_back(positions.size());
 
     std::vector<std::vector<Vector2>> textureCoordinates;
-    if(flags & GridFlag::GenerateTextureCoords) {
-        textureCoordinates.emplace_back();
-        textureCoordinates[0].reserve(positions.size());
-        for(std::size_t i = 0; i != positions.size(); ++i)
-            textureCoordinates[0].emplace_back(positions[i].xy()*0.5f + Vector2{0.5f});
-    }
+    if(flags & GridFlag::GenerateTextureCoords)
+        textureCoordinates.emplace_back(positions.size());
+
+    grid3DSolidInto(subdivisions,
+        {positions.data(), positions.size(), sizeof(Vector3)},
+        normals.empty() ? Containers::StridedArrayView<Vector3>{} :
+            Containers::StridedArrayView<Vector3>{normals[0].data(), normals[0].size(), sizeof(Vector3)},
+        textureCoordinates.empty() ? Containers::StridedArrayView<Vector2>{} :
+            Containers::StridedArrayView<Vector2>{textureCoordinates[0].data(), textureCoordinates[0].size(), sizeof(Vector2)},
+        {indices.data(), indices.size()});
 
     return Trade::MeshData3D{MeshPrimitive::Triangles, std::move(indices), {std::move(positions)}, std::move(normals), std::move(textureCoordinates), {}, nullptr};
 }
@@ -26,10 +26,11 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::Primitives::grid3DSolid(), @ref Magnum::Primitives::grid3DWireframe()
+ * @brief Function @ref Magnum::Primitives::grid3DSolid(), @ref Magnum::Primitives::grid3DSolidInto(), @ref Magnum::Primitives::grid3DSolidVertexCount(), @ref Magnum::Primitives::grid3DSolidIndexCount(), @ref Magnum::Primitives::grid3DWireframe()
  */
 
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Math.h"
@@ -76,10 +77,69 @@ each direction. Specifying @cpp {0, 0} @ce will make the result an (indexed)
 equivalent to @ref planeSolid(); @cpp {5, 3} @ce will make the grid have 6
 cells horizontally and 4 vertically. In particular, this is different from the
 `subdivisions` parameter in @ref icosphereSolid().
-@see @ref grid3DWireframe()
+@see @ref grid3DWireframe(), @ref grid3DSolidInto()
 */
 MAGNUM_PRIMITIVES_EXPORT Trade::MeshData3D grid3DSolid(const Vector2i& subdivisions, GridFlags flags = GridFlag::GenerateNormals);
 
+/**
+@brief Vertex count of a 3D solid grid
+
+Count of vertices generated by @ref grid3DSolid() and expected by
+@ref grid3DSolidInto() for given @p subdivisions.
+@see @ref grid3DSolidIndexCount()
+*/
+MAGNUM_PRIMITIVES_EXPORT UnsignedInt grid3DSolidVertexCount(const Vector2i& subdivisions);
+
+/**
+@brief Index count of a 3D solid grid
+
+Count of indices generated by @ref grid3DSolid() and expected by
+@ref grid3DSolidInto() for given @p subdivisions.
+@see @ref grid3DSolidVertexCount()
+*/
+MAGNUM_PRIMITIVES_EXPORT UnsignedInt grid3DSolidIndexCount(const Vector2i& subdivisions);
+
+/**
+@brief 3D solid grid into existing storage
+@param subdivisions         Number of subdivisions
+@param positions            Where to put vertex positions
+@param normals              Where to put vertex normals
+@param textureCoordinates   Where to put texture coordinates
+@param indices              Where to put the indices
+@param threadCount          Thread count to use for the generation,
+    including the calling thread. Value of @cpp 0 @ce is treated the same as
+    @cpp 1 @ce.
+
+Same as @ref grid3DSolid(), but instead of allocating a new
+@ref Trade::MeshData3D the data are written directly into given views, which
+can point into an interleaved vertex array or a memory-mapped GPU buffer,
+avoiding an additional copy of meshes with millions of vertices. The
+@p positions view is expected to have @ref grid3DSolidVertexCount() items,
+@p normals and @p textureCoordinates either the same size or be empty, in
+which case the attribute is not generated. The @p indices view is expected to
+have @ref grid3DSolidIndexCount() items. The output is exactly the same as
+with @ref grid3DSolid(), regardless of @p threadCount.
+
+@code{.cpp}
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+};
+
+const Vector2i subdivisions{4095, 4095};
+Containers::Array<Vertex> vertices{Primitives::grid3DSolidVertexCount(subdivisions)};
+Containers::Array<UnsignedInt> indices{Primitives::grid3DSolidIndexCount(subdivisions)};
+Primitives::grid3DSolidInto(subdivisions,
+    {&vertices[0].position, vertices.size(), sizeof(Vertex)},
+    {&vertices[0].normal, vertices.size(), sizeof(Vertex)},
+    {}, indices, std::thread::hardware_concurrency());
+@endcode
+
+@note On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the @p threadCount is
+    ignored and the operation is always done on the calling thread.
+*/
+MAGNUM_PRIMITIVES_EXPORT void grid3DSolidInto(const Vector2i& subdivisions, Containers::StridedArrayView<Vector3> positions, Containers::StridedArrayView<Vector3> normals, Containers::StridedArrayView<Vector2> textureCoordinates, Containers::ArrayView<UnsignedInt> indices, UnsignedInt threadCount = 1);
+
 /**
 @brief 3D wireframe grid
 
@@ -25,65 +25,262 @@
 
 #include "Icosphere.h"
 
+#include <iterator>
+#include <unordered_map>
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Mesh.h"
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Math/Color.h"
-#include "Magnum/MeshTools/Duplicate.h"
-#include "Magnum/MeshTools/RemoveDuplicates.h"
-#include "Magnum/MeshTools/Subdivide.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Trade/MeshData3D.h"
 
 namespace Magnum { namespace Primitives {
 
+namespace {
+
+constexpr UnsignedInt BaseIndices[]{
+    1, 2, 6,
+    1, 7, 2,
+    3, 4, 5,
+    4, 3, 8,
+    6, 5, 11,
+    5, 6, 10,
+    9, 10, 2,
+    10, 9, 3,
+    7, 8, 9,
+    8, 7, 0,
+    11, 0, 1,
+    0, 11, 4,
+    6, 2, 10,
+    1, 6, 11,
+    3, 5, 10,
+    5, 4, 11,
+    2, 7, 9,
+    7, 1, 0,
+    3, 9, 8,
+    4, 8, 0
+};
+
+constexpr Vector3 BasePositions[]{
+    {0.0f, -0.525731f, 0.850651f},
+    {0.850651f, 0.0f, 0.525731f},
+    {0.850651f, 0.0f, -0.525731f},
+    {-0.850651f, 0.0f, -0.525731f},
+    {-0.850651f, 0.0f, 0.525731f},
+    {-0.525731f, 0.850651f, 0.0f},
+    {0.525731f, 0.850651f, 0.0f},
+    {0.525731f, -0.850651f, 0.0f},
+    {-0.525731f, -0.850651f, 0.0f},
+    {0.0f, -0.525731f, -0.850651f},
+    {0.0f, 0.525731f, -0.850651f},
+    {0.0f, 0.525731f, 0.850651f}
+};
+
+constexpr std::size_t BaseFaceCount = 20;
+constexpr std::size_t BaseVertexCount = 12;
+constexpr std::size_t BaseEdgeCount = 30;
+
+}
+
 Trade::MeshData3D icosphereSolid(const UnsignedInt subdivisions) {
-    std::vector<UnsignedInt> indices{
-        1, 2, 6,
-        1, 7, 2,
-        3, 4, 5,
-        4, 3, 8,
-        6, 5, 11,
-        5, 6, 10,
-        9, 10, 2,
-        10, 9, 3,
-        7, 8, 9,
-        8, 7, 0,
-        11, 0, 1,
-        0, 11, 4,
-        6, 2, 10,
-        1, 6, 11,
-        3, 5, 10,
-        5, 4, 11,
-        2, 7, 9,
-        7, 1, 0,
-        3, 9, 8,
-        4, 8, 0
-    };
-
-    std::vector<Vector3> positions{
-        {0.0f, -0.525731f, 0.850651f},
-        {0.850651f, 0.0f, 0.525731f},
-        {0.850651f, 0.0f, -0.525731f},
-        {-0.850651f, 0.0f, -0.525731f},
-        {-0.850651f, 0.0f, 0.525731f},
-        {-0.525731f, 0.850651f, 0.0f},
-        {0.525731f, 0.850651f, 0.0f},
-        {0.525731f, -0.850651f, 0.0f},
-        {-0.525731f, -0.850651f, 0.0f},
-        {0.0f, -0.525731f, -0.850651f},
-        {0.0f, 0.525731f, -0.850651f},
-        {0.0f, 0.525731f, 0.850651f}
-    };
-
-    for(std::size_t i = 0; i != subdivisions; ++i)
-        MeshTools::subdivide(indices, positions, [](const Vector3& a, const Vector3& b) {
-            return (a+b).normalized();
-        });
-
-    indices = MeshTools::duplicate(indices, MeshTools::removeDuplicates(positions));
+    std::vector<UnsignedInt> indices(std::begin(BaseIndices), std::end(BaseIndices));
+    std::vector<Vector3> positions(std::begin(BasePositions), std::end(BasePositions));
+
+    /* Each subdivision quadruples the face count, with V - E + F = 2 the
+       vertex count is then F/2 + 2 */
+    const std::size_t faceCount = std::size_t{20} << 2*subdivisions;
+    indices.reserve(faceCount*3);
+    positions.reserve(faceCount/2 + 2);
+
+    /* Subdivide in the same order as MeshTools::subdivide() does, but look up
+       midpoints of already subdivided edges instead of adding them again. The
+       output is the same as subdividing and removing duplicates afterwards,
+       without having to create and then discard the duplicates. */
+    std::unordered_map<UnsignedLong, UnsignedInt> midpoints;
+    for(std::size_t i = 0; i != subdivisions; ++i) {
+        midpoints.clear();
+        midpoints.reserve(indices.size()/2);
+
+        const std::size_t indexCount = indices.size();
+        for(std::size_t j = 0; j != indexCount; j += 3) {
+            UnsignedInt newVertices[3];
+            for(std::size_t k = 0; k != 3; ++k) {
+                const UnsignedInt a = indices[j + k];
+                const UnsignedInt b = indices[j + (k + 1)%3];
+                const UnsignedLong edge = a < b ?
+                    UnsignedLong(a) << 32 | b : UnsignedLong(b) << 32 | a;
+                const auto found = midpoints.emplace(edge, UnsignedInt(positions.size()));
+                if(found.second)
+                    positions.push_back((positions[a] + positions[b]).normalized());
+                newVertices[k] = found.first->second;
+            }
+
+            indices.insert(indices.end(), {
+                indices[j], newVertices[0], newVertices[2],
+                newVertices[0], indices[j + 1], newVertices[1],
+                newVertices[2], newVertices[1], indices[j + 2]});
+            for(std::size_t k = 0; k != 3; ++k)
+                indices[j + k] = newVertices[k];
+        }
+    }
 
     std::vector<Vector3> normals(positions);
     return Trade::MeshData3D{MeshPrimitive::Triangles, std::move(indices), {std::move(positions)}, {std::move(normals)}, {}, {}, nullptr};
 }
 
+UnsignedInt icosphereSolidVertexCount(const UnsignedInt subdivisions) {
+    /* 10n² + 2, where n is the count of segments on each icosahedron edge */
+    return 10*(1u << 2*subdivisions) + 2;
+}
+
+UnsignedInt icosphereSolidIndexCount(const UnsignedInt subdivisions) {
+    return UnsignedInt(BaseFaceCount*3)*(1u << 2*subdivisions);
+}
+
+void icosphereSolidInto(const UnsignedInt subdivisions, const Containers::StridedArrayView<Vector3> positions, const Containers::StridedArrayView<Vector3> normals, const Containers::ArrayView<UnsignedInt> indices, const UnsignedInt threadCount) {
+    const UnsignedInt vertexCount = icosphereSolidVertexCount(subdivisions);
+    const UnsignedInt indexCount = icosphereSolidIndexCount(subdivisions);
+    CORRADE_ASSERT(positions.size() == vertexCount,
+        "Primitives::icosphereSolidInto(): expected" << vertexCount << "positions but got" << positions.size(), );
+    CORRADE_ASSERT(!normals.size() || normals.size() == positions.size(),
+        "Primitives::icosphereSolidInto(): expected" << positions.size() << "or no normals but got" << normals.size(), );
+    CORRADE_ASSERT(indices.size() == indexCount,
+        "Primitives::icosphereSolidInto(): expected" << indexCount << "indices but got" << indices.size(), );
+
+    /* Each icosahedron face is a triangular grid with n segments on each
+       edge, a grid point (a, b) has barycentric coordinates (n - a - b, a, b)
+       with respect to the face corners */
+    const Int n = 1 << subdivisions;
+    const std::size_t faceTriangleCount = std::size_t(n)*n;
+
+    /* Enumerate unique icosahedron edges and remember which face is the
+       first to reference each corner and edge. Only that face writes the
+       shared vertices, so the threads never write to the same location. */
+    UnsignedInt edges[BaseEdgeCount][2];
+    UnsignedInt edgeOwners[BaseEdgeCount];
+    UnsignedInt cornerOwners[BaseVertexCount];
+    UnsignedInt faceEdges[BaseFaceCount][3];
+    std::size_t edgeCount = 0;
+    for(UnsignedInt& owner: cornerOwners) owner = ~UnsignedInt{};
+    for(UnsignedInt f = 0; f != BaseFaceCount; ++f) {
+        const UnsignedInt* const c = BaseIndices + f*3;
+        for(std::size_t i = 0; i != 3; ++i)
+            if(cornerOwners[c[i]] == ~UnsignedInt{}) cornerOwners[c[i]] = f;
+
+        /* The grid edges are, in order, b = 0, a = 0 and a + b = n */
+        const UnsignedInt faceEdgeCorners[3][2]{{c[0], c[1]}, {c[0], c[2]}, {c[1], c[2]}};
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt u = Math::min(faceEdgeCorners[i][0], faceEdgeCorners[i][1]);
+            const UnsignedInt v = Math::max(faceEdgeCorners[i][0], faceEdgeCorners[i][1]);
+            std::size_t e = 0;
+            while(e != edgeCount && (edges[e][0] != u || edges[e][1] != v)) ++e;
+            if(e == edgeCount) {
+                CORRADE_INTERNAL_ASSERT(edgeCount != BaseEdgeCount);
+                edges[e][0] = u;
+                edges[e][1] = v;
+                edgeOwners[e] = f;
+                ++edgeCount;
+            }
+            faceEdges[f][i] = e;
+        }
+    }
+
+    /* Global vertex order is the 12 corners, then n - 1 vertices for each
+       edge going from the lower to the higher corner index and then vertices
+       inside each face, row by row */
+    const std::size_t edgeVerticesOffset = BaseVertexCount;
+    const std::size_t interiorVerticesOffset = edgeVerticesOffset + BaseEdgeCount*(n - 1);
+    const std::size_t faceInteriorCount = std::size_t(n - 1)*(n - 2)/2;
+
+    Magnum::Implementation::parallelFor(threadCount, BaseFaceCount, [&](const std::size_t f) {
+        const UnsignedInt* const c = BaseIndices + f*3;
+
+        /* Row b of the grid has n + 1 - b points */
+        auto local = [n](const Int a, const Int b) {
+            return std::size_t(b)*(n + 1) - std::size_t(b)*(b - 1)/2 + a;
+        };
+        auto edgeVertex = [&](const std::size_t faceEdge, const Int t) {
+            const UnsignedInt e = faceEdges[f][faceEdge];
+            const bool forward = edges[e][0] == c[faceEdge == 2 ? 1 : 0];
+            return UnsignedInt(edgeVerticesOffset + e*(n - 1) + (forward ? t : n - t) - 1);
+        };
+        auto global = [&](const Int a, const Int b) {
+            if(a == 0 && b == 0) return c[0];
+            if(a == n) return c[1];
+            if(b == n) return c[2];
+            if(b == 0) return edgeVertex(0, a);
+            if(a == 0) return edgeVertex(1, b);
+            if(a + b == n) return edgeVertex(2, b);
+            return UnsignedInt(interiorVerticesOffset + f*faceInteriorCount +
+                std::size_t(b - 1)*(n - 1) - std::size_t(b - 1)*b/2 + a - 1);
+        };
+
+        /* Refine the grid in the same way as the recursive subdivision in
+           icosphereSolid() does -- each new point is the normalized midpoint
+           of the two points on the coarser level that it's between. That
+           makes the positions bit-exact with the recursive variant. */
+        Containers::Array<Vector3> grid{Containers::NoInit, local(0, n) + 1};
+        grid[local(0, 0)] = BasePositions[c[0]];
+        grid[local(n, 0)] = BasePositions[c[1]];
+        grid[local(0, n)] = BasePositions[c[2]];
+        for(Int s = n/2; s >= 1; s /= 2) {
+            for(Int b = 0; b <= n; b += s) {
+                for(Int a = 0; a <= n - b; a += s) {
+                    const bool aOdd = (a/s) & 1;
+                    const bool bOdd = (b/s) & 1;
+                    if(!aOdd && !bOdd) continue;
+
+                    std::size_t p, q;
+                    if(aOdd && bOdd) {
+                        p = local(a - s, b + s);
+                        q = local(a + s, b - s);
+                    } else if(aOdd) {
+                        p = local(a - s, b);
+                        q = local(a + s, b);
+                    } else {
+                        p = local(a, b - s);
+                        q = local(a, b + s);
+                    }
+                    grid[local(a, b)] = (grid[p] + grid[q]).normalized();
+                }
+            }
+        }
+
+        /* Write the vertices this face is responsible for */
+        for(Int b = 0; b <= n; ++b) {
+            for(Int a = 0; a <= n - b; ++a) {
+                const bool isCorner = (a == 0 && b == 0) || a == n || b == n;
+                if(isCorner) {
+                    if(cornerOwners[global(a, b)] != f) continue;
+                } else if(b == 0 || a == 0 || a + b == n) {
+                    const std::size_t faceEdge = b == 0 ? 0 : a == 0 ? 1 : 2;
+                    if(edgeOwners[faceEdges[f][faceEdge]] != f) continue;
+                }
+
+                const UnsignedInt i = global(a, b);
+                positions[i] = grid[local(a, b)];
+                if(normals.size()) normals[i] = grid[local(a, b)];
+            }
+        }
+
+        /* Triangles pointing the same way as the face and the ones between
+           them, each with the same winding as the face */
+        UnsignedInt* out = indices.data() + f*faceTriangleCount*3;
+        for(Int b = 0; b != n; ++b) {
+            for(Int a = 0; a != n - b; ++a) {
+                *out++ = global(a, b);
+                *out++ = global(a + 1, b);
+                *out++ = global(a, b + 1);
+                if(a + b == n - 1) continue;
+                *out++ = global(a + 1, b);
+                *out++ = global(a + 1, b + 1);
+                *out++ = global(a, b + 1);
+            }
+        }
+    });
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /* LCOV_EXCL_START */
 Trade::MeshData3D Icosphere::solid(const UnsignedInt subdivisions) {
@@ -26,9 +26,12 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::Primitives::icosphereSolid()
+ * @brief Function @ref Magnum::Primitives::icosphereSolid(), @ref Magnum::Primitives::icosphereSolidInto(), @ref Magnum::Primitives::icosphereSolidVertexCount(), @ref Magnum::Primitives::icosphereSolidIndexCount()
  */
 
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
 #include "Magnum/Primitives/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -53,10 +56,58 @@ icosphere with 20 faces, saying @cpp 1 @ce will result in an icosphere with 80
 faces (each triangle subdivided into four smaller), saying @cpp 2 @ce will
 result in 320 faces and so on. In particular, this is different from the
 `subdivisions` parameter in @ref grid3DSolid() or @ref grid3DWireframe().
-@see @ref uvSphereSolid(), @ref uvSphereWireframe()
+@see @ref uvSphereSolid(), @ref uvSphereWireframe(), @ref icosphereSolidInto()
 */
 MAGNUM_PRIMITIVES_EXPORT Trade::MeshData3D icosphereSolid(UnsignedInt subdivisions);
 
+/**
+@brief Vertex count of a solid 3D icosphere
+
+Count of vertices generated by @ref icosphereSolid() and expected by
+@ref icosphereSolidInto() for given @p subdivisions.
+@see @ref icosphereSolidIndexCount()
+*/
+MAGNUM_PRIMITIVES_EXPORT UnsignedInt icosphereSolidVertexCount(UnsignedInt subdivisions);
+
+/**
+@brief Index count of a solid 3D icosphere
+
+Count of indices generated by @ref icosphereSolid() and expected by
+@ref icosphereSolidInto() for given @p subdivisions.
+@see @ref icosphereSolidVertexCount()
+*/
+MAGNUM_PRIMITIVES_EXPORT UnsignedInt icosphereSolidIndexCount(UnsignedInt subdivisions);
+
+/**
+@brief Solid 3D icosphere into existing storage
+@param subdivisions     Number of subdivisions
+@param positions        Where to put vertex positions
+@param normals          Where to put vertex normals
+@param indices          Where to put the indices
+@param threadCount      Thread count to use for the generation, including the
+    calling thread. Value of @cpp 0 @ce is treated the same as @cpp 1 @ce.
+
+Same as @ref icosphereSolid(), but instead of allocating a new
+@ref Trade::MeshData3D the data are written directly into given views, which
+can point into an interleaved vertex array or a memory-mapped GPU buffer. The
+@p positions view is expected to have @ref icosphereSolidVertexCount() items,
+@p normals either the same size or be empty, in which case normals are not
+generated. The @p indices view is expected to have
+@ref icosphereSolidIndexCount() items.
+
+Instead of subdividing the whole mesh recursively, each of the 20 icosahedron
+faces is subdivided independently, so the faces can be generated in parallel
+on up to 20 threads without any lookup of already subdivided edges. The
+resulting positions and triangles are exactly the same as with
+@ref icosphereSolid(), but the vertices are in a different order --- first
+the 12 icosahedron corners, then vertices on the icosahedron edges and then
+vertices inside each face. See @ref grid3DSolidInto() for an usage example.
+
+@note On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the @p threadCount is
+    ignored and the operation is always done on the calling thread.
+*/
+MAGNUM_PRIMITIVES_EXPORT void icosphereSolidInto(UnsignedInt subdivisions, Containers::StridedArrayView<Vector3> positions, Containers::StridedArrayView<Vector3> normals, Containers::ArrayView<UnsignedInt> indices, UnsignedInt threadCount = 1);
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
 @brief 3D icosphere
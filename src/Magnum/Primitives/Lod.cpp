@@ -0,0 +1,116 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Lod.h"
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Primitives/Circle.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Primitives {
+
+namespace {
+
+/* The first level is taken verbatim so invalid input gets caught by the
+   generator itself instead of being silently clamped */
+UnsignedInt levelResolution(const UnsignedInt value, const UnsignedInt level, const UnsignedInt min) {
+    if(!level) return value;
+    return Math::max(level < 32 ? value >> level : 0, min);
+}
+
+}
+
+std::vector<Trade::MeshData3D> capsule3DSolidLods(const UnsignedInt levelCount, const UnsignedInt hemisphereRings, const UnsignedInt cylinderRings, const UnsignedInt segments, const Float halfLength, const CapsuleTextureCoords textureCoords) {
+    CORRADE_ASSERT(levelCount, "Primitives::capsule3DSolidLods(): expected at least one level", {});
+
+    std::vector<Trade::MeshData3D> levels;
+    levels.reserve(levelCount);
+    for(UnsignedInt i = 0; i != levelCount; ++i)
+        levels.push_back(capsule3DSolid(levelResolution(hemisphereRings, i, 1), levelResolution(cylinderRings, i, 1), levelResolution(segments, i, 3), halfLength, textureCoords));
+    return levels;
+}
+
+std::vector<Trade::MeshData3D> circle3DSolidLods(const UnsignedInt levelCount, const UnsignedInt segments) {
+    CORRADE_ASSERT(levelCount, "Primitives::circle3DSolidLods(): expected at least one level", {});
+
+    std::vector<Trade::MeshData3D> levels;
+    levels.reserve(levelCount);
+    for(UnsignedInt i = 0; i != levelCount; ++i)
+        levels.push_back(circle3DSolid(levelResolution(segments, i, 3)));
+    return levels;
+}
+
+std::vector<Trade::MeshData3D> coneSolidLods(const UnsignedInt levelCount, const UnsignedInt rings, const UnsignedInt segments, const Float halfLength, const ConeFlags flags) {
+    CORRADE_ASSERT(levelCount, "Primitives::coneSolidLods(): expected at least one level", {});
+
+    std::vector<Trade::MeshData3D> levels;
+    levels.reserve(levelCount);
+    for(UnsignedInt i = 0; i != levelCount; ++i)
+        levels.push_back(coneSolid(levelResolution(rings, i, 1), levelResolution(segments, i, 3), halfLength, flags));
+    return levels;
+}
+
+std::vector<Trade::MeshData3D> cylinderSolidLods(const UnsignedInt levelCount, const UnsignedInt rings, const UnsignedInt segments, const Float halfLength, const CylinderFlags flags) {
+    CORRADE_ASSERT(levelCount, "Primitives::cylinderSolidLods(): expected at least one level", {});
+
+    std::vector<Trade::MeshData3D> levels;
+    levels.reserve(levelCount);
+    for(UnsignedInt i = 0; i != levelCount; ++i)
+        levels.push_back(cylinderSolid(levelResolution(rings, i, 1), levelResolution(segments, i, 3), halfLength, flags));
+    return levels;
+}
+
+std::vector<Trade::MeshData3D> uvSphereSolidLods(const UnsignedInt levelCount, const UnsignedInt rings, const UnsignedInt segments, const UVSphereTextureCoords textureCoords) {
+    CORRADE_ASSERT(levelCount, "Primitives::uvSphereSolidLods(): expected at least one level", {});
+
+    std::vector<Trade::MeshData3D> levels;
+    levels.reserve(levelCount);
+    for(UnsignedInt i = 0; i != levelCount; ++i)
+        levels.push_back(uvSphereSolid(levelResolution(rings, i, 2), levelResolution(segments, i, 3), textureCoords));
+    return levels;
+}
+
+UnsignedInt lodLevel(const Float screenSize, const Float detailSize, const UnsignedInt levelCount) {
+    CORRADE_ASSERT(levelCount, "Primitives::lodLevel(): expected at least one level", {});
+
+    if(screenSize >= detailSize) return 0;
+    if(screenSize <= 0.0f) return levelCount - 1;
+
+    /* Compare against thresholds instead of calculating the log, exact for
+       powers of two */
+    UnsignedInt level = 0;
+    Float threshold = detailSize*0.5f;
+    while(level + 1 != levelCount && screenSize <= threshold) {
+        ++level;
+        threshold *= 0.5f;
+    }
+    return level;
+}
+
+}}
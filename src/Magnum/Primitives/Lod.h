@@ -0,0 +1,141 @@
+#ifndef Magnum_Primitives_Lod_h
+#define Magnum_Primitives_Lod_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Primitives::capsule3DSolidLods(), @ref Magnum::Primitives::circle3DSolidLods(), @ref Magnum::Primitives::coneSolidLods(), @ref Magnum::Primitives::cylinderSolidLods(), @ref Magnum::Primitives::uvSphereSolidLods(), @ref Magnum::Primitives::lodLevel()
+ */
+
+#include <vector>
+
+#include "Magnum/Primitives/Capsule.h"
+#include "Magnum/Primitives/Cone.h"
+#include "Magnum/Primitives/Cylinder.h"
+#include "Magnum/Primitives/UVSphere.h"
+#include "Magnum/Primitives/visibility.h"
+
+namespace Magnum { namespace Primitives {
+
+/**
+@brief Level-of-detail chain of a solid 3D capsule
+@param levelCount       Level count. Expected to be at least @cpp 1 @ce.
+@param hemisphereRings  Number of (face) rings for each hemisphere in the
+    first level
+@param cylinderRings    Number of (face) rings for cylinder in the first
+    level
+@param segments         Number of (face) segments in the first level
+@param halfLength       Half the length of cylinder part
+@param textureCoords    Whether to generate texture coordinates
+
+The first level is equivalent to
+@ref capsule3DSolid(UnsignedInt, UnsignedInt, UnsignedInt, Float, CapsuleTextureCoords "capsule3DSolid()"
+with the same parameters, each next level has the ring and segment counts
+halved, clamped to the minimal values accepted by @ref capsule3DSolid(). All
+levels have the same primitive and attributes, so they can be packed into a
+single mesh using @ref MeshTools::compileBatch() and drawn using a
+@ref GL::MeshView for each level, picked for example using @ref lodLevel().
+See also @ref MeshCache::capsule3DSolidLods() for a cached variant.
+*/
+MAGNUM_PRIMITIVES_EXPORT std::vector<Trade::MeshData3D> capsule3DSolidLods(UnsignedInt levelCount, UnsignedInt hemisphereRings, UnsignedInt cylinderRings, UnsignedInt segments, Float halfLength, CapsuleTextureCoords textureCoords = CapsuleTextureCoords::DontGenerate);
+
+/**
+@brief Level-of-detail chain of a solid 3D circle
+@param levelCount       Level count. Expected to be at least @cpp 1 @ce.
+@param segments         Number of segments in the first level
+
+The first level is equivalent to @ref circle3DSolid() with the same
+parameters, each next level has the segment count halved, clamped to
+@cpp 3 @ce. See @ref capsule3DSolidLods() for more information.
+*/
+MAGNUM_PRIMITIVES_EXPORT std::vector<Trade::MeshData3D> circle3DSolidLods(UnsignedInt levelCount, UnsignedInt segments);
+
+/**
+@brief Level-of-detail chain of a solid 3D cone
+@param levelCount       Level count. Expected to be at least @cpp 1 @ce.
+@param rings            Number of (face) rings in the first level
+@param segments         Number of (face) segments in the first level
+@param halfLength       Half the cone length
+@param flags            Flags
+
+The first level is equivalent to @ref coneSolid() with the same parameters,
+each next level has the ring and segment counts halved, clamped to the
+minimal values accepted by @ref coneSolid(). See @ref capsule3DSolidLods()
+for more information.
+*/
+MAGNUM_PRIMITIVES_EXPORT std::vector<Trade::MeshData3D> coneSolidLods(UnsignedInt levelCount, UnsignedInt rings, UnsignedInt segments, Float halfLength, ConeFlags flags = {});
+
+/**
+@brief Level-of-detail chain of a solid 3D cylinder
+@param levelCount       Level count. Expected to be at least @cpp 1 @ce.
+@param rings            Number of (face) rings in the first level
+@param segments         Number of (face) segments in the first level
+@param halfLength       Half the cylinder length
+@param flags            Flags
+
+The first level is equivalent to @ref cylinderSolid() with the same
+parameters, each next level has the ring and segment counts halved, clamped
+to the minimal values accepted by @ref cylinderSolid(). See
+@ref capsule3DSolidLods() for more information.
+*/
+MAGNUM_PRIMITIVES_EXPORT std::vector<Trade::MeshData3D> cylinderSolidLods(UnsignedInt levelCount, UnsignedInt rings, UnsignedInt segments, Float halfLength, CylinderFlags flags = {});
+
+/**
+@brief Level-of-detail chain of a solid 3D UV sphere
+@param levelCount       Level count. Expected to be at least @cpp 1 @ce.
+@param rings            Number of (face) rings in the first level
+@param segments         Number of (face) segments in the first level
+@param textureCoords    Whether to generate texture coordinates
+
+The first level is equivalent to @ref uvSphereSolid() with the same
+parameters, each next level has the ring and segment counts halved, clamped
+to the minimal values accepted by @ref uvSphereSolid(). See
+@ref capsule3DSolidLods() for more information.
+*/
+MAGNUM_PRIMITIVES_EXPORT std::vector<Trade::MeshData3D> uvSphereSolidLods(UnsignedInt levelCount, UnsignedInt rings, UnsignedInt segments, UVSphereTextureCoords textureCoords = UVSphereTextureCoords::DontGenerate);
+
+/**
+@brief Pick a level of detail for given screen size
+@param screenSize       Projected size of the object on the screen, for
+    example its diameter in pixels
+@param detailSize       Projected size at which the first level should be
+    used
+@param levelCount       Level count. Expected to be at least @cpp 1 @ce.
+
+Since each level returned from the `*Lods()` functions has the segment count
+halved, returns the level that keeps the on-screen length of a segment
+closest to the one at @p detailSize, that is
+@f[
+    \operatorname{clamp}(\lfloor \log_2 \frac{d}{s} \rfloor, 0, n - 1)
+@f]
+
+Sizes larger than @p detailSize and non-positive @p screenSize result in the
+first and last level, respectively.
+*/
+MAGNUM_PRIMITIVES_EXPORT UnsignedInt lodLevel(Float screenSize, Float detailSize, UnsignedInt levelCount);
+
+}}
+
+#endif
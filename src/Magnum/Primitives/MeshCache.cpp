@@ -0,0 +1,228 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshCache.h"
+
+#include <map>
+#include <tuple>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/MeshView.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Compile.h"
+#include "Magnum/Primitives/Circle.h"
+#include "Magnum/Primitives/Cube.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Primitives/Lod.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Primitives {
+
+namespace {
+
+struct LodChain {
+    GL::Mesh mesh;
+    std::vector<GL::MeshView> views;
+};
+
+}
+
+struct MeshCache::State {
+    std::map<std::tuple<UnsignedInt, UnsignedInt, UnsignedInt, Float, UnsignedByte>, std::unique_ptr<GL::Mesh>> capsule3DSolid;
+    std::map<std::tuple<UnsignedInt, UnsignedInt, UnsignedInt, UnsignedInt, Float, UnsignedByte>, std::unique_ptr<LodChain>> capsule3DSolidLods;
+    std::map<std::tuple<UnsignedInt, UnsignedInt, UnsignedInt, Float>, std::unique_ptr<GL::Mesh>> capsule3DWireframe;
+    std::map<std::tuple<UnsignedInt, UnsignedInt>, std::unique_ptr<LodChain>> circle3DSolidLods;
+    std::map<std::tuple<UnsignedInt, UnsignedInt, Float, Int>, std::unique_ptr<GL::Mesh>> coneSolid;
+    std::map<std::tuple<UnsignedInt, UnsignedInt, UnsignedInt, Float, Int>, std::unique_ptr<LodChain>> coneSolidLods;
+    std::map<std::tuple<UnsignedInt, Float>, std::unique_ptr<GL::Mesh>> coneWireframe;
+    std::unique_ptr<GL::Mesh> cubeSolid;
+    std::unique_ptr<GL::Mesh> cubeWireframe;
+    std::map<std::tuple<UnsignedInt, UnsignedInt, Float, Int>, std::unique_ptr<GL::Mesh>> cylinderSolid;
+    std::map<std::tuple<UnsignedInt, UnsignedInt, UnsignedInt, Float, Int>, std::unique_ptr<LodChain>> cylinderSolidLods;
+    std::map<std::tuple<UnsignedInt, UnsignedInt, Float>, std::unique_ptr<GL::Mesh>> cylinderWireframe;
+    std::map<UnsignedInt, std::unique_ptr<GL::Mesh>> icosphereSolid;
+    std::map<std::tuple<UnsignedInt, UnsignedInt, UnsignedByte>, std::unique_ptr<GL::Mesh>> uvSphereSolid;
+    std::map<std::tuple<UnsignedInt, UnsignedInt, UnsignedInt, UnsignedByte>, std::unique_ptr<LodChain>> uvSphereSolidLods;
+    std::map<std::tuple<UnsignedInt, UnsignedInt>, std::unique_ptr<GL::Mesh>> uvSphereWireframe;
+};
+
+namespace {
+
+template<class T> GL::Mesh& cached(std::unique_ptr<GL::Mesh>& mesh, T generator) {
+    if(!mesh) mesh.reset(new GL::Mesh{MeshTools::compile(generator())});
+    return *mesh;
+}
+
+template<class T> std::vector<GL::MeshView>& cachedLods(std::unique_ptr<LodChain>& chain, T generator) {
+    if(!chain) {
+        const std::vector<Trade::MeshData3D> levels = generator();
+        std::vector<std::reference_wrapper<const Trade::MeshData3D>> references{levels.begin(), levels.end()};
+        /* Default-constructed matrices are identity */
+        const std::vector<Matrix4> transformations(levels.size());
+
+        chain.reset(new LodChain);
+        chain->views = MeshTools::compileBatch(chain->mesh,
+            Containers::arrayView(references.data(), references.size()),
+            Containers::arrayView(transformations.data(), transformations.size()));
+    }
+    return chain->views;
+}
+
+}
+
+MeshCache::MeshCache(): _state{new State} {}
+
+MeshCache::MeshCache(MeshCache&&) noexcept = default;
+
+MeshCache::~MeshCache() = default;
+
+MeshCache& MeshCache::operator=(MeshCache&&) noexcept = default;
+
+std::size_t MeshCache::count() const {
+    return _state->capsule3DSolid.size() + _state->capsule3DSolidLods.size() +
+        _state->capsule3DWireframe.size() + _state->circle3DSolidLods.size() +
+        _state->coneSolid.size() + _state->coneSolidLods.size() +
+        _state->coneWireframe.size() +
+        (_state->cubeSolid ? 1 : 0) + (_state->cubeWireframe ? 1 : 0) +
+        _state->cylinderSolid.size() + _state->cylinderSolidLods.size() +
+        _state->cylinderWireframe.size() + _state->icosphereSolid.size() +
+        _state->uvSphereSolid.size() + _state->uvSphereSolidLods.size() +
+        _state->uvSphereWireframe.size();
+}
+
+GL::Mesh& MeshCache::capsule3DSolid(const UnsignedInt hemisphereRings, const UnsignedInt cylinderRings, const UnsignedInt segments, const Float halfLength, const CapsuleTextureCoords textureCoords) {
+    return cached(_state->capsule3DSolid[std::make_tuple(hemisphereRings, cylinderRings, segments, halfLength, UnsignedByte(textureCoords))], [&]() {
+        return Primitives::capsule3DSolid(hemisphereRings, cylinderRings, segments, halfLength, textureCoords);
+    });
+}
+
+std::vector<GL::MeshView>& MeshCache::capsule3DSolidLods(const UnsignedInt levelCount, const UnsignedInt hemisphereRings, const UnsignedInt cylinderRings, const UnsignedInt segments, const Float halfLength, const CapsuleTextureCoords textureCoords) {
+    return cachedLods(_state->capsule3DSolidLods[std::make_tuple(levelCount, hemisphereRings, cylinderRings, segments, halfLength, UnsignedByte(textureCoords))], [&]() {
+        return Primitives::capsule3DSolidLods(levelCount, hemisphereRings, cylinderRings, segments, halfLength, textureCoords);
+    });
+}
+
+GL::Mesh& MeshCache::capsule3DWireframe(const UnsignedInt hemisphereRings, const UnsignedInt cylinderRings, const UnsignedInt segments, const Float halfLength) {
+    return cached(_state->capsule3DWireframe[std::make_tuple(hemisphereRings, cylinderRings, segments, halfLength)], [&]() {
+        return Primitives::capsule3DWireframe(hemisphereRings, cylinderRings, segments, halfLength);
+    });
+}
+
+std::vector<GL::MeshView>& MeshCache::circle3DSolidLods(const UnsignedInt levelCount, const UnsignedInt segments) {
+    return cachedLods(_state->circle3DSolidLods[std::make_tuple(levelCount, segments)], [&]() {
+        return Primitives::circle3DSolidLods(levelCount, segments);
+    });
+}
+
+GL::Mesh& MeshCache::coneSolid(const UnsignedInt rings, const UnsignedInt segments, const Float halfLength, const ConeFlags flags) {
+    return cached(_state->coneSolid[std::make_tuple(rings, segments, halfLength, Int(flags))], [&]() {
+        return Primitives::coneSolid(rings, segments, halfLength, flags);
+    });
+}
+
+std::vector<GL::MeshView>& MeshCache::coneSolidLods(const UnsignedInt levelCount, const UnsignedInt rings, const UnsignedInt segments, const Float halfLength, const ConeFlags flags) {
+    return cachedLods(_state->coneSolidLods[std::make_tuple(levelCount, rings, segments, halfLength, Int(flags))], [&]() {
+        return Primitives::coneSolidLods(levelCount, rings, segments, halfLength, flags);
+    });
+}
+
+GL::Mesh& MeshCache::coneWireframe(const UnsignedInt segments, const Float halfLength) {
+    return cached(_state->coneWireframe[std::make_tuple(segments, halfLength)], [&]() {
+        return Primitives::coneWireframe(segments, halfLength);
+    });
+}
+
+GL::Mesh& MeshCache::cubeSolid() {
+    return cached(_state->cubeSolid, Primitives::cubeSolid);
+}
+
+GL::Mesh& MeshCache::cubeWireframe() {
+    return cached(_state->cubeWireframe, Primitives::cubeWireframe);
+}
+
+GL::Mesh& MeshCache::cylinderSolid(const UnsignedInt rings, const UnsignedInt segments, const Float halfLength, const CylinderFlags flags) {
+    return cached(_state->cylinderSolid[std::make_tuple(rings, segments, halfLength, Int(flags))], [&]() {
+        return Primitives::cylinderSolid(rings, segments, halfLength, flags);
+    });
+}
+
+std::vector<GL::MeshView>& MeshCache::cylinderSolidLods(const UnsignedInt levelCount, const UnsignedInt rings, const UnsignedInt segments, const Float halfLength, const CylinderFlags flags) {
+    return cachedLods(_state->cylinderSolidLods[std::make_tuple(levelCount, rings, segments, halfLength, Int(flags))], [&]() {
+        return Primitives::cylinderSolidLods(levelCount, rings, segments, halfLength, flags);
+    });
+}
+
+GL::Mesh& MeshCache::cylinderWireframe(const UnsignedInt rings, const UnsignedInt segments, const Float halfLength) {
+    return cached(_state->cylinderWireframe[std::make_tuple(rings, segments, halfLength)], [&]() {
+        return Primitives::cylinderWireframe(rings, segments, halfLength);
+    });
+}
+
+GL::Mesh& MeshCache::icosphereSolid(const UnsignedInt subdivisions) {
+    return cached(_state->icosphereSolid[subdivisions], [&]() {
+        return Primitives::icosphereSolid(subdivisions);
+    });
+}
+
+GL::Mesh& MeshCache::uvSphereSolid(const UnsignedInt rings, const UnsignedInt segments, const UVSphereTextureCoords textureCoords) {
+    return cached(_state->uvSphereSolid[std::make_tuple(rings, segments, UnsignedByte(textureCoords))], [&]() {
+        return Primitives::uvSphereSolid(rings, segments, textureCoords);
+    });
+}
+
+std::vector<GL::MeshView>& MeshCache::uvSphereSolidLods(const UnsignedInt levelCount, const UnsignedInt rings, const UnsignedInt segments, const UVSphereTextureCoords textureCoords) {
+    return cachedLods(_state->uvSphereSolidLods[std::make_tuple(levelCount, rings, segments, UnsignedByte(textureCoords))], [&]() {
+        return Primitives::uvSphereSolidLods(levelCount, rings, segments, textureCoords);
+    });
+}
+
+GL::Mesh& MeshCache::uvSphereWireframe(const UnsignedInt rings, const UnsignedInt segments) {
+    return cached(_state->uvSphereWireframe[std::make_tuple(rings, segments)], [&]() {
+        return Primitives::uvSphereWireframe(rings, segments);
+    });
+}
+
+void MeshCache::clear() {
+    _state->capsule3DSolid.clear();
+    _state->capsule3DSolidLods.clear();
+    _state->capsule3DWireframe.clear();
+    _state->circle3DSolidLods.clear();
+    _state->coneSolid.clear();
+    _state->coneSolidLods.clear();
+    _state->coneWireframe.clear();
+    _state->cubeSolid = nullptr;
+    _state->cubeWireframe = nullptr;
+    _state->cylinderSolid.clear();
+    _state->cylinderSolidLods.clear();
+    _state->cylinderWireframe.clear();
+    _state->icosphereSolid.clear();
+    _state->uvSphereSolid.clear();
+    _state->uvSphereSolidLods.clear();
+    _state->uvSphereWireframe.clear();
+}
+
+}}
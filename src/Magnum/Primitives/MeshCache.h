@@ -0,0 +1,259 @@
+#ifndef Magnum_Primitives_MeshCache_h
+#define Magnum_Primitives_MeshCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Primitives::MeshCache
+ */
+
+#include "Magnum/configure.h"
+
+#ifdef MAGNUM_TARGET_GL
+#include <memory>
+#include <vector>
+
+#include "Magnum/GL/GL.h"
+#include "Magnum/Primitives/Capsule.h"
+#include "Magnum/Primitives/Cone.h"
+#include "Magnum/Primitives/Cylinder.h"
+#include "Magnum/Primitives/UVSphere.h"
+#include "Magnum/Primitives/visibility.h"
+
+namespace Magnum { namespace Primitives {
+
+/**
+@brief Compiled primitive mesh cache
+
+Generates and compiles each requested combination of primitive parameters
+just once using @ref MeshTools::compile() and then hands out references to
+the resulting @ref GL::Mesh. The references stay valid until @ref clear() is
+called or the cache is destroyed. Useful when a large number of debug or
+proxy objects is drawn using the same few primitives --- instead of
+regenerating and uploading the data for each of them, they all share a
+single mesh.
+
+The `*Lods()` getters additionally pack a whole level-of-detail chain into a
+single mesh and return a @ref GL::MeshView for each level, which can be then
+picked based on the projected size using @ref lodLevel():
+
+@code{.cpp}
+Primitives::MeshCache cache;
+std::vector<GL::MeshView>& sphere = cache.uvSphereSolidLods(4, 32, 64);
+
+// For each object, based on its projected diameter in pixels
+sphere[Primitives::lodLevel(diameter, 256.0f, sphere.size())].draw(shader);
+@endcode
+
+Floating-point parameters such as the half-length of
+@ref Primitives::cylinderSolid() are compared exactly, so meshes generated
+with values differing only slightly are cached separately.
+
+This class is available only if Magnum is compiled with
+@ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+for more information.
+
+@section Primitives-MeshCache-context Relation to the OpenGL context
+
+The cached meshes are OpenGL objects, so there should be one cache for each
+@ref GL::Context and it has to be destroyed while the context is still
+alive. The cache doesn't make any OpenGL calls on its own, so it can be
+constructed before any context exists.
+*/
+class MAGNUM_PRIMITIVES_EXPORT MeshCache {
+    public:
+        /** @brief Constructor */
+        explicit MeshCache();
+
+        /** @brief Copying is not allowed */
+        MeshCache(const MeshCache&) = delete;
+
+        /** @brief Move constructor */
+        MeshCache(MeshCache&&) noexcept;
+
+        ~MeshCache();
+
+        /** @brief Copying is not allowed */
+        MeshCache& operator=(const MeshCache&) = delete;
+
+        /** @brief Move assignment */
+        MeshCache& operator=(MeshCache&&) noexcept;
+
+        /** @brief Count of cached meshes */
+        std::size_t count() const;
+
+        /**
+         * @brief Solid 3D capsule
+         *
+         * Compiles the mesh on first use with given parameters.
+         * @see @ref Primitives::capsule3DSolid()
+         */
+        GL::Mesh& capsule3DSolid(UnsignedInt hemisphereRings, UnsignedInt cylinderRings, UnsignedInt segments, Float halfLength, CapsuleTextureCoords textureCoords = CapsuleTextureCoords::DontGenerate);
+
+        /**
+         * @brief Level-of-detail chain of a solid 3D capsule
+         *
+         * Generates the levels on first use with given parameters, compiles
+         * them into a single mesh using @ref MeshTools::compileBatch() and
+         * returns a view for each level.
+         * @see @ref Primitives::capsule3DSolidLods(), @ref lodLevel()
+         */
+        std::vector<GL::MeshView>& capsule3DSolidLods(UnsignedInt levelCount, UnsignedInt hemisphereRings, UnsignedInt cylinderRings, UnsignedInt segments, Float halfLength, CapsuleTextureCoords textureCoords = CapsuleTextureCoords::DontGenerate);
+
+        /**
+         * @brief Wireframe 3D capsule
+         *
+         * Compiles the mesh on first use with given parameters.
+         * @see @ref Primitives::capsule3DWireframe()
+         */
+        GL::Mesh& capsule3DWireframe(UnsignedInt hemisphereRings, UnsignedInt cylinderRings, UnsignedInt segments, Float halfLength);
+
+        /**
+         * @brief Level-of-detail chain of a solid 3D circle
+         *
+         * Generates the levels on first use with given parameters. See
+         * @ref capsule3DSolidLods() for more information.
+         * @see @ref Primitives::circle3DSolidLods()
+         */
+        std::vector<GL::MeshView>& circle3DSolidLods(UnsignedInt levelCount, UnsignedInt segments);
+
+        /**
+         * @brief Solid 3D cone
+         *
+         * Compiles the mesh on first use with given parameters.
+         * @see @ref Primitives::coneSolid()
+         */
+        GL::Mesh& coneSolid(UnsignedInt rings, UnsignedInt segments, Float halfLength, ConeFlags flags = {});
+
+        /**
+         * @brief Level-of-detail chain of a solid 3D cone
+         *
+         * Generates the levels on first use with given parameters. See
+         * @ref capsule3DSolidLods() for more information.
+         * @see @ref Primitives::coneSolidLods()
+         */
+        std::vector<GL::MeshView>& coneSolidLods(UnsignedInt levelCount, UnsignedInt rings, UnsignedInt segments, Float halfLength, ConeFlags flags = {});
+
+        /**
+         * @brief Wireframe 3D cone
+         *
+         * Compiles the mesh on first use with given parameters.
+         * @see @ref Primitives::coneWireframe()
+         */
+        GL::Mesh& coneWireframe(UnsignedInt segments, Float halfLength);
+
+        /**
+         * @brief Solid 3D cube
+         *
+         * Compiles the mesh on first use.
+         * @see @ref Primitives::cubeSolid()
+         */
+        GL::Mesh& cubeSolid();
+
+        /**
+         * @brief Wireframe 3D cube
+         *
+         * Compiles the mesh on first use.
+         * @see @ref Primitives::cubeWireframe()
+         */
+        GL::Mesh& cubeWireframe();
+
+        /**
+         * @brief Solid 3D cylinder
+         *
+         * Compiles the mesh on first use with given parameters.
+         * @see @ref Primitives::cylinderSolid()
+         */
+        GL::Mesh& cylinderSolid(UnsignedInt rings, UnsignedInt segments, Float halfLength, CylinderFlags flags = {});
+
+        /**
+         * @brief Level-of-detail chain of a solid 3D cylinder
+         *
+         * Generates the levels on first use with given parameters. See
+         * @ref capsule3DSolidLods() for more information.
+         * @see @ref Primitives::cylinderSolidLods()
+         */
+        std::vector<GL::MeshView>& cylinderSolidLods(UnsignedInt levelCount, UnsignedInt rings, UnsignedInt segments, Float halfLength, CylinderFlags flags = {});
+
+        /**
+         * @brief Wireframe 3D cylinder
+         *
+         * Compiles the mesh on first use with given parameters.
+         * @see @ref Primitives::cylinderWireframe()
+         */
+        GL::Mesh& cylinderWireframe(UnsignedInt rings, UnsignedInt segments, Float halfLength);
+
+        /**
+         * @brief Solid 3D icosphere
+         *
+         * Compiles the mesh on first use with given @p subdivisions.
+         * @see @ref Primitives::icosphereSolid()
+         */
+        GL::Mesh& icosphereSolid(UnsignedInt subdivisions);
+
+        /**
+         * @brief Solid 3D UV sphere
+         *
+         * Compiles the mesh on first use with given parameters.
+         * @see @ref Primitives::uvSphereSolid()
+         */
+        GL::Mesh& uvSphereSolid(UnsignedInt rings, UnsignedInt segments, UVSphereTextureCoords textureCoords = UVSphereTextureCoords::DontGenerate);
+
+        /**
+         * @brief Level-of-detail chain of a solid 3D UV sphere
+         *
+         * Generates the levels on first use with given parameters. See
+         * @ref capsule3DSolidLods() for more information.
+         * @see @ref Primitives::uvSphereSolidLods()
+         */
+        std::vector<GL::MeshView>& uvSphereSolidLods(UnsignedInt levelCount, UnsignedInt rings, UnsignedInt segments, UVSphereTextureCoords textureCoords = UVSphereTextureCoords::DontGenerate);
+
+        /**
+         * @brief Wireframe 3D UV sphere
+         *
+         * Compiles the mesh on first use with given parameters.
+         * @see @ref Primitives::uvSphereWireframe()
+         */
+        GL::Mesh& uvSphereWireframe(UnsignedInt rings, UnsignedInt segments);
+
+        /**
+         * @brief Clear the cache
+         *
+         * Destroys all cached meshes, invalidating all references returned
+         * from this instance.
+         */
+        void clear();
+
+    private:
+        struct State;
+        std::unique_ptr<State> _state;
+};
+
+}}
+#else
+#error this header is available only in the OpenGL build
+#endif
+
+#endif
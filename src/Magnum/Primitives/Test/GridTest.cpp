@@ -37,12 +37,16 @@ struct GridTest: TestSuite::Tester {
 
     void solid3DWithoutAnything();
     void solid3DWithNormalsAndTextureCoords();
+    void solid3DInto();
+    void solid3DIntoInterleavedThreaded();
     void wireframe3D();
 };
 
 GridTest::GridTest() {
     addTests({&GridTest::solid3DWithoutAnything,
               &GridTest::solid3DWithNormalsAndTextureCoords,
+              &GridTest::solid3DInto,
+              &GridTest::solid3DIntoInterleavedThreaded,
               &GridTest::wireframe3D});
 }
 
@@ -285,6 +289,54 @@ void GridTest::solid3DWithNormalsAndTextureCoords() {
     }), TestSuite::Compare::Container);
 }
 
+void GridTest::solid3DInto() {
+    Trade::MeshData3D grid = grid3DSolid({5, 3}, GridFlag::GenerateNormals|GridFlag::GenerateTextureCoords);
+    CORRADE_COMPARE(grid3DSolidVertexCount({5, 3}), grid.positions(0).size());
+    CORRADE_COMPARE(grid3DSolidIndexCount({5, 3}), grid.indices().size());
+
+    std::vector<Vector3> positions(grid3DSolidVertexCount({5, 3}));
+    std::vector<Vector2> textureCoordinates(positions.size());
+    std::vector<UnsignedInt> indices(grid3DSolidIndexCount({5, 3}));
+
+    /* Normals are not generated if the view is empty */
+    grid3DSolidInto({5, 3},
+        {positions.data(), positions.size(), sizeof(Vector3)}, {},
+        {textureCoordinates.data(), textureCoordinates.size(), sizeof(Vector2)},
+        {indices.data(), indices.size()});
+    CORRADE_COMPARE_AS(positions, grid.positions(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(textureCoordinates, grid.textureCoords2D(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(indices, grid.indices(), TestSuite::Compare::Container);
+}
+
+void GridTest::solid3DIntoInterleavedThreaded() {
+    Trade::MeshData3D grid = grid3DSolid({63, 17}, GridFlag::GenerateNormals|GridFlag::GenerateTextureCoords);
+
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        Vector2 textureCoordinates;
+    };
+    std::vector<Vertex> vertices(grid3DSolidVertexCount({63, 17}));
+    std::vector<UnsignedInt> indices(grid3DSolidIndexCount({63, 17}));
+    grid3DSolidInto({63, 17},
+        {&vertices[0].position, vertices.size(), sizeof(Vertex)},
+        {&vertices[0].normal, vertices.size(), sizeof(Vertex)},
+        {&vertices[0].textureCoordinates, vertices.size(), sizeof(Vertex)},
+        {indices.data(), indices.size()}, 4);
+
+    std::vector<Vector3> positions, normals;
+    std::vector<Vector2> textureCoordinates;
+    for(const Vertex& vertex: vertices) {
+        positions.push_back(vertex.position);
+        normals.push_back(vertex.normal);
+        textureCoordinates.push_back(vertex.textureCoordinates);
+    }
+    CORRADE_COMPARE_AS(positions, grid.positions(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(normals, grid.normals(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(textureCoordinates, grid.textureCoords2D(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(indices, grid.indices(), TestSuite::Compare::Container);
+}
+
 void GridTest::wireframe3D() {
     Trade::MeshData3D grid = grid3DWireframe({5, 3});
 
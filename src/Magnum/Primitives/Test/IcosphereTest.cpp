@@ -23,9 +23,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <array>
+#include <tuple>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Subdivide.h"
 #include "Magnum/Primitives/Icosphere.h"
 #include "Magnum/Trade/MeshData3D.h"
 
@@ -35,10 +42,42 @@ struct IcosphereTest: TestSuite::Tester {
     explicit IcosphereTest();
 
     void count();
+    void subdivideRemoveDuplicates();
+    void into();
 };
 
 IcosphereTest::IcosphereTest() {
-    addTests({&IcosphereTest::count});
+    addTests({&IcosphereTest::count,
+              &IcosphereTest::subdivideRemoveDuplicates,
+              &IcosphereTest::into});
+}
+
+namespace {
+
+/* Lexicographic comparison to be able to compare meshes that have the same
+   vertices and triangles in a different order. Bit-exact, as it's expected
+   that the positions are exactly the same. */
+bool less(const Vector3& a, const Vector3& b) {
+    return std::make_tuple(a.x(), a.y(), a.z()) < std::make_tuple(b.x(), b.y(), b.z());
+}
+
+typedef std::array<Vector3, 3> Triangle;
+
+std::vector<Triangle> sortedTriangles(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions) {
+    std::vector<Triangle> triangles;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        /* Rotate the lowest vertex first to preserve the winding */
+        Triangle triangle{{positions[indices[i]], positions[indices[i + 1]], positions[indices[i + 2]]}};
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end(), less), triangle.end());
+        triangles.push_back(triangle);
+    }
+
+    std::sort(triangles.begin(), triangles.end(), [](const Triangle& a, const Triangle& b) {
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), less);
+    });
+    return triangles;
+}
+
 }
 
 void IcosphereTest::count() {
@@ -52,6 +91,52 @@ void IcosphereTest::count() {
     CORRADE_COMPARE(data.normals(0).size(), 162);
 }
 
+void IcosphereTest::subdivideRemoveDuplicates() {
+    /* The generator should produce exactly the same output as subdividing the
+       base icosahedron and removing duplicates afterwards */
+    Trade::MeshData3D base = Primitives::icosphereSolid(0);
+    for(UnsignedInt subdivisions: {1, 2, 4}) {
+        std::vector<UnsignedInt> indices = base.indices();
+        std::vector<Vector3> positions = base.positions(0);
+        for(std::size_t i = 0; i != subdivisions; ++i)
+            MeshTools::subdivide(indices, positions, [](const Vector3& a, const Vector3& b) {
+                return (a+b).normalized();
+            });
+        indices = MeshTools::duplicate(indices, MeshTools::removeDuplicates(positions));
+
+        Trade::MeshData3D data = Primitives::icosphereSolid(subdivisions);
+        CORRADE_COMPARE_AS(data.indices(), indices, TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(data.positions(0), positions, TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(data.normals(0), positions, TestSuite::Compare::Container);
+    }
+}
+
+void IcosphereTest::into() {
+    for(UnsignedInt subdivisions: {0, 1, 2, 4}) {
+        Trade::MeshData3D data = Primitives::icosphereSolid(subdivisions);
+        CORRADE_COMPARE(icosphereSolidVertexCount(subdivisions), data.positions(0).size());
+        CORRADE_COMPARE(icosphereSolidIndexCount(subdivisions), data.indices().size());
+
+        std::vector<Vector3> positions(icosphereSolidVertexCount(subdivisions));
+        std::vector<Vector3> normals(positions.size());
+        std::vector<UnsignedInt> indices(icosphereSolidIndexCount(subdivisions));
+        icosphereSolidInto(subdivisions,
+            {positions.data(), positions.size(), sizeof(Vector3)},
+            {normals.data(), normals.size(), sizeof(Vector3)},
+            {indices.data(), indices.size()}, 4);
+        CORRADE_COMPARE_AS(normals, positions, TestSuite::Compare::Container);
+
+        /* The vertex order is different, but the vertices and triangles
+           should be exactly the same */
+        std::vector<Vector3> expectedPositions = data.positions(0);
+        std::vector<Vector3> actualPositions = positions;
+        std::sort(expectedPositions.begin(), expectedPositions.end(), less);
+        std::sort(actualPositions.begin(), actualPositions.end(), less);
+        CORRADE_COMPARE_AS(actualPositions, expectedPositions, TestSuite::Compare::Container);
+        CORRADE_VERIFY(sortedTriangles(indices, positions) == sortedTriangles(data.indices(), data.positions(0)));
+    }
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Primitives::Test::IcosphereTest)
@@ -0,0 +1,159 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Primitives/Circle.h"
+#include "Magnum/Primitives/Lod.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Primitives { namespace Test {
+
+struct LodTest: TestSuite::Tester {
+    explicit LodTest();
+
+    void capsule3DSolid();
+    void circle3DSolid();
+    void coneSolid();
+    void cylinderSolid();
+    void uvSphereSolid();
+    void noLevels();
+
+    void level();
+    void levelSingle();
+};
+
+LodTest::LodTest() {
+    addTests({&LodTest::capsule3DSolid,
+              &LodTest::circle3DSolid,
+              &LodTest::coneSolid,
+              &LodTest::cylinderSolid,
+              &LodTest::uvSphereSolid,
+              &LodTest::noLevels,
+
+              &LodTest::level,
+              &LodTest::levelSingle});
+}
+
+void LodTest::capsule3DSolid() {
+    std::vector<Trade::MeshData3D> lods = capsule3DSolidLods(3, 4, 2, 16, 0.75f, CapsuleTextureCoords::Generate);
+    CORRADE_COMPARE(lods.size(), 3);
+
+    /* First level is the same as generating directly */
+    Trade::MeshData3D capsule = Primitives::capsule3DSolid(4, 2, 16, 0.75f, CapsuleTextureCoords::Generate);
+    CORRADE_COMPARE_AS(lods[0].positions(0), capsule.positions(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(lods[0].indices(), capsule.indices(), TestSuite::Compare::Container);
+
+    /* Ring count clamped to 1, segments halved */
+    Trade::MeshData3D last = Primitives::capsule3DSolid(1, 1, 4, 0.75f, CapsuleTextureCoords::Generate);
+    CORRADE_COMPARE_AS(lods[2].positions(0), last.positions(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(lods[2].indices(), last.indices(), TestSuite::Compare::Container);
+    CORRADE_VERIFY(lods[2].hasTextureCoords2D());
+}
+
+void LodTest::circle3DSolid() {
+    std::vector<Trade::MeshData3D> lods = circle3DSolidLods(4, 12);
+    CORRADE_COMPARE(lods.size(), 4);
+
+    /* Segment count is clamped to 3 */
+    CORRADE_COMPARE(lods[0].positions(0).size(), Primitives::circle3DSolid(12).positions(0).size());
+    CORRADE_COMPARE(lods[1].positions(0).size(), Primitives::circle3DSolid(6).positions(0).size());
+    CORRADE_COMPARE(lods[2].positions(0).size(), Primitives::circle3DSolid(3).positions(0).size());
+    CORRADE_COMPARE(lods[3].positions(0).size(), Primitives::circle3DSolid(3).positions(0).size());
+    for(const Trade::MeshData3D& level: lods)
+        CORRADE_COMPARE(level.primitive(), MeshPrimitive::TriangleFan);
+}
+
+void LodTest::coneSolid() {
+    std::vector<Trade::MeshData3D> lods = coneSolidLods(2, 4, 8, 1.5f, ConeFlag::CapEnd);
+    CORRADE_COMPARE(lods.size(), 2);
+
+    Trade::MeshData3D cone = Primitives::coneSolid(2, 4, 1.5f, ConeFlag::CapEnd);
+    CORRADE_COMPARE_AS(lods[1].positions(0), cone.positions(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(lods[1].indices(), cone.indices(), TestSuite::Compare::Container);
+}
+
+void LodTest::cylinderSolid() {
+    std::vector<Trade::MeshData3D> lods = cylinderSolidLods(3, 2, 32, 1.0f, CylinderFlag::CapEnds);
+    CORRADE_COMPARE(lods.size(), 3);
+
+    /* Each level has less vertices than the previous */
+    CORRADE_VERIFY(lods[1].positions(0).size() < lods[0].positions(0).size());
+    CORRADE_VERIFY(lods[2].positions(0).size() < lods[1].positions(0).size());
+
+    Trade::MeshData3D cylinder = Primitives::cylinderSolid(1, 8, 1.0f, CylinderFlag::CapEnds);
+    CORRADE_COMPARE_AS(lods[2].positions(0), cylinder.positions(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(lods[2].normals(0), cylinder.normals(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(lods[2].indices(), cylinder.indices(), TestSuite::Compare::Container);
+}
+
+void LodTest::uvSphereSolid() {
+    std::vector<Trade::MeshData3D> lods = uvSphereSolidLods(4, 16, 32);
+    CORRADE_COMPARE(lods.size(), 4);
+
+    /* Rings are halved down to 2 */
+    Trade::MeshData3D sphere = Primitives::uvSphereSolid(2, 4);
+    CORRADE_COMPARE_AS(lods[3].positions(0), sphere.positions(0), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(lods[3].indices(), sphere.indices(), TestSuite::Compare::Container);
+    CORRADE_COMPARE(lods[1].positions(0).size(), Primitives::uvSphereSolid(8, 16).positions(0).size());
+}
+
+void LodTest::noLevels() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    uvSphereSolidLods(0, 16, 32);
+    CORRADE_COMPARE(out.str(), "Primitives::uvSphereSolidLods(): expected at least one level\n");
+}
+
+void LodTest::level() {
+    CORRADE_COMPARE(lodLevel(512.0f, 256.0f, 4), 0);
+    CORRADE_COMPARE(lodLevel(256.0f, 256.0f, 4), 0);
+    CORRADE_COMPARE(lodLevel(129.0f, 256.0f, 4), 0);
+    CORRADE_COMPARE(lodLevel(128.0f, 256.0f, 4), 1);
+    CORRADE_COMPARE(lodLevel(100.0f, 256.0f, 4), 1);
+    CORRADE_COMPARE(lodLevel(64.0f, 256.0f, 4), 2);
+    CORRADE_COMPARE(lodLevel(32.0f, 256.0f, 4), 3);
+
+    /* Clamped to the last level */
+    CORRADE_COMPARE(lodLevel(1.0f, 256.0f, 4), 3);
+    CORRADE_COMPARE(lodLevel(0.0f, 256.0f, 4), 3);
+    CORRADE_COMPARE(lodLevel(-1.0f, 256.0f, 4), 3);
+}
+
+void LodTest::levelSingle() {
+    CORRADE_COMPARE(lodLevel(512.0f, 256.0f, 1), 0);
+    CORRADE_COMPARE(lodLevel(1.0f, 256.0f, 1), 0);
+    CORRADE_COMPARE(lodLevel(0.0f, 256.0f, 1), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Primitives::Test::LodTest)
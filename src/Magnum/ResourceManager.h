@@ -29,7 +29,9 @@
  * @brief Class @ref Magnum::ResourceManager, @ref Magnum::ResourceDataState, @ref Magnum::ResourcePolicy
  */
 
-#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <vector>
 
 #include "Magnum/Resource.h"
 
@@ -85,13 +87,85 @@ enum class ResourcePolicy: UnsignedByte {
     Manual,
 
     /** The resource will be unloaded when last reference to it is gone. */
-    ReferenceCounted
+    ReferenceCounted,
+
+    /**
+     * The resource will be unloaded if nothing references it and the memory
+     * budget set with @ref ResourceManager::setBudget() is exceeded, least
+     * recently used resources first. Accessing it again with
+     * @ref ResourceManager::get() will then ask the loader to load it again.
+     * See @ref ResourceManager-budget for more information.
+     */
+    Budgeted
 };
 
 template<class> class AbstractResourceLoader;
 
 namespace Implementation {
 
+/* Open-addressing hash table with linear probing and the values stored
+   inline. The resource key is already a hash, it's only multiplied to spread
+   keys created from sequential integers over the whole table. Erased values
+   are replaced with tombstones so erasing doesn't move other values. */
+template<class T> class ResourceTable {
+    public:
+        explicit ResourceTable(): _size{}, _used{}, _shift{} {}
+
+        std::size_t size() const { return _size; }
+
+        T* find(ResourceKey key) {
+            const std::size_t i = slot(key);
+            return i == NotFound ? nullptr : &_slots[i].value;
+        }
+
+        const T* find(ResourceKey key) const {
+            const std::size_t i = slot(key);
+            return i == NotFound ? nullptr : &_slots[i].value;
+        }
+
+        /* Inserts a default-constructed value if not already present */
+        T& operator[](ResourceKey key);
+
+        void erase(ResourceKey key);
+
+        template<class F> void forEach(F f) const {
+            for(const Slot& slot: _slots)
+                if(slot.state == SlotState::Used) f(slot.key, slot.value);
+        }
+
+        void clear() {
+            _slots.clear();
+            _size = _used = _shift = 0;
+        }
+
+    private:
+        enum class SlotState: UnsignedByte { Empty, Used, Erased };
+
+        struct Slot {
+            Slot(): state{SlotState::Empty} {}
+
+            ResourceKey key;
+            T value;
+            SlotState state;
+        };
+
+        enum: std::size_t { NotFound = ~std::size_t{} };
+
+        std::size_t index(ResourceKey key) const {
+            constexpr std::size_t Multiplier = sizeof(std::size_t) == 8 ?
+                std::size_t(11400714819323198485ull) : std::size_t(2654435769u);
+            return (std::hash<ResourceKey>{}(key)*Multiplier) >> _shift;
+        }
+
+        std::size_t slot(ResourceKey key) const;
+        void rehash(std::size_t capacity);
+
+        std::vector<Slot> _slots;
+        std::size_t _size,  /* used slots */
+            _used,          /* used slots and tombstones */
+            _shift;
+};
+
 /** @todo Print either resource key or name string based on loader capabilities */
 
 template<class T> class ResourceManagerData {
@@ -107,9 +181,15 @@ template<class T> class ResourceManagerData {
         ResourceManagerData<T>& operator=(const ResourceManagerData<T>&) = delete;
         ResourceManagerData<T>& operator=(ResourceManagerData<T>&&) = delete;
 
-        std::size_t lastChange() const { return _lastChange; }
+        std::size_t lastChange() const {
+            applyPending();
+            return _lastChange;
+        }
 
-        std::size_t count() const { return _data.size(); }
+        std::size_t count() const {
+            applyPending();
+            return _data.size();
+        }
 
         std::size_t referenceCount(ResourceKey key) const;
 
@@ -117,7 +197,16 @@ template<class T> class ResourceManagerData {
 
         template<class U> Resource<T, U> get(ResourceKey key);
 
-        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy);
+        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size);
+
+        std::size_t budget() const { return _budget; }
+
+        void setBudget(std::size_t budget);
+
+        std::size_t memoryUsage() const {
+            applyPending();
+            return _memoryUsage;
+        }
 
         T* fallback() { return _fallback; }
         const T* fallback() const { return _fallback; }
@@ -126,7 +215,11 @@ template<class T> class ResourceManagerData {
 
         void free();
 
-        void clear() { _data.clear(); }
+        void clear() {
+            applyPending();
+            _data.clear();
+            _memoryUsage = 0;
+        }
 
         AbstractResourceLoader<T>* loader() { return _loader; }
         const AbstractResourceLoader<T>* loader() const { return _loader; }
@@ -136,10 +229,30 @@ template<class T> class ResourceManagerData {
         void setLoader(AbstractResourceLoader<T>* loader);
 
     protected:
-        ResourceManagerData(): _fallback(nullptr), _loader(nullptr), _lastChange(0) {}
+        ResourceManagerData(): _fallback(nullptr), _loader(nullptr), _lastChange(0), _budget(~std::size_t{}), _memoryUsage(0), _lastUse(0), _pending(nullptr) {}
 
     private:
         struct Data;
+        struct Pending;
+
+        /* Thread-safe, the update is applied on the next access from the
+           manager thread */
+        void publish(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size);
+
+        /* Called from everything that accesses the data, the common case of
+           nothing being published is a single atomic load */
+        void applyPending() const {
+            if(_pending.load(std::memory_order_relaxed))
+                const_cast<ResourceManagerData<T>&>(*this).applyPendingInternal();
+        }
+
+        void applyPendingInternal();
+
+        void setInternal(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size);
+
+        /* Unloads least recently used budgeted resources until the memory
+           usage fits into the budget */
+        void evict();
 
         const Data& data(ResourceKey key) { return _data[key]; }
 
@@ -149,10 +262,12 @@ template<class T> class ResourceManagerData {
 
         void decrementReferenceCount(ResourceKey key);
 
-        std::unordered_map<ResourceKey, Data> _data;
+        ResourceTable<Data> _data;
         T* _fallback;
         AbstractResourceLoader<T>* _loader;
         std::size_t _lastChange;
+        std::size_t _budget, _memoryUsage, _lastUse;
+        std::atomic<Pending*> _pending;
 };
 
 /* Helper class for defining which real types are in the type pack */
@@ -256,6 +371,37 @@ Basic usage is:
 </li>
 </ul>
 
+@section ResourceManager-budget Memory budget
+
+Each resource can report its size in bytes when passed to @ref set(). The
+sizes of all resources of given type are summed in @ref memoryUsage() and
+when the usage exceeds a budget set with @ref setBudget(), resources with
+@ref ResourcePolicy::Budgeted that are not referenced by any @ref Resource
+instance are unloaded, the ones that were used least recently first. A
+resource counts as used when it's set and when its last reference goes away.
+Resources with other policies count towards the usage, but are never unloaded
+automatically.
+
+@code{.cpp}
+manager.setBudget<Texture2D>(512*1024*1024);
+
+Texture2D* texture = new Texture2D;
+// ...
+manager.set(key, texture, ResourceDataState::Final, ResourcePolicy::Budgeted,
+    texture->memoryUsage());
+@endcode
+
+For GPU resources, @ref GL::Buffer::memoryUsage(),
+@ref GL::AbstractTexture::memoryUsage() and
+@ref GL::Renderbuffer::memoryUsage() give their allocated size without
+querying the driver. Aggregates over all live objects are available through
+@ref GL::Context::memoryUsage().
+
+When an unloaded resource is requested again using @ref get(), it's loaded
+again by the loader set using @ref setLoader(), if any. The budget is not
+a hard limit --- if all resources are referenced, the usage can stay above the
+budget until some of them are released.
+
 @see @ref AbstractResourceLoader
 */
 /* Due to too much work involved with explicit template instantiation (all
@@ -335,19 +481,21 @@ template<class... Types> class ResourceManager: private Implementation::Resource
          * Resources with @ref ResourcePolicy::ReferenceCounted are added with
          * zero reference count. It means that all reference counted resources
          * which were only loaded but not used will stay loaded and you need to
-         * explicitly call @ref free() to delete them.
+         * explicitly call @ref free() to delete them. The @p size is counted
+         * towards @ref memoryUsage(), see @ref ResourceManager-budget for more
+         * information.
          * @attention Subsequent updates are not possible if resource state is
          *      already @ref ResourceState::Final.
          * @see @ref referenceCount(), @ref state()
          */
-        template<class T> ResourceManager<Types...>& set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy) {
-            this->Implementation::ResourceManagerData<T>::set(key, data, state, policy);
+        template<class T> ResourceManager<Types...>& set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0) {
+            this->Implementation::ResourceManagerData<T>::set(key, data, state, policy, size);
             return *this;
         }
 
         /** @overload */
-        template<class U> ResourceManager<Types...>& set(ResourceKey key, U&& data, ResourceDataState state, ResourcePolicy policy) {
-            return set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy);
+        template<class U> ResourceManager<Types...>& set(ResourceKey key, U&& data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0) {
+            return set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy, size);
         }
 
         /**
@@ -366,6 +514,40 @@ template<class... Types> class ResourceManager: private Implementation::Resource
             return set(key, new typename std::decay<U>::type(std::forward<U>(data)));
         }
 
+        /**
+         * @brief Memory budget for given type of resources
+         *
+         * Default is unlimited.
+         * @see @ref memoryUsage()
+         */
+        template<class T> std::size_t budget() const {
+            return this->Implementation::ResourceManagerData<T>::budget();
+        }
+
+        /**
+         * @brief Set memory budget for given type of resources
+         * @return Reference to self (for method chaining)
+         *
+         * If @ref memoryUsage() is over the budget, unreferenced resources
+         * with @ref ResourcePolicy::Budgeted are unloaded immediately. See
+         * @ref ResourceManager-budget for more information.
+         */
+        template<class T> ResourceManager<Types...>& setBudget(std::size_t bytes) {
+            this->Implementation::ResourceManagerData<T>::setBudget(bytes);
+            return *this;
+        }
+
+        /**
+         * @brief Memory usage of given type of resources
+         *
+         * Sum of sizes passed to @ref set() for all currently present
+         * resources of given type, regardless of their policy.
+         * @see @ref budget()
+         */
+        template<class T> std::size_t memoryUsage() const {
+            return this->Implementation::ResourceManagerData<T>::memoryUsage();
+        }
+
         /** @brief Fallback for not found resources */
         template<class T> T* fallback() {
             return this->Implementation::ResourceManagerData<T>::fallback();
@@ -489,70 +671,222 @@ template<class T> void safeDelete(T* data) {
     delete data;
 }
 
+template<class T> struct ResourceManagerData<T>::Pending {
+    Pending* next;
+    ResourceKey key;
+    T* data;
+    ResourceDataState state;
+    ResourcePolicy policy;
+    std::size_t size;
+};
+
 template<class T> ResourceManagerData<T>::~ResourceManagerData() {
     /* Loaders are already deleted via freeLoaders() from ResourceManager */
     safeDelete(_fallback);
+
+    /* Delete updates that were published but never applied */
+    for(Pending* pending = _pending.exchange(nullptr, std::memory_order_acquire); pending; ) {
+        Pending* const next = pending->next;
+        safeDelete(pending->data);
+        delete pending;
+        pending = next;
+    }
+}
+
+template<class T> std::size_t ResourceTable<T>::slot(const ResourceKey key) const {
+    if(_slots.empty()) return NotFound;
+
+    /* There's always at least one empty slot, so this terminates */
+    const std::size_t mask = _slots.size() - 1;
+    for(std::size_t i = index(key); ; i = (i + 1) & mask) {
+        const Slot& slot = _slots[i];
+        if(slot.state == SlotState::Empty) return NotFound;
+        if(slot.state == SlotState::Used && slot.key == key) return i;
+    }
+}
+
+template<class T> T& ResourceTable<T>::operator[](const ResourceKey key) {
+    if(T* const found = find(key)) return *found;
+
+    /* Keep at most three quarters of the slots used including tombstones,
+       otherwise rehash, growing if it's not just the tombstones */
+    if((_used + 1)*4 > _slots.size()*3) {
+        std::size_t capacity = 16;
+        while((_size + 1)*2 > capacity) capacity *= 2;
+        rehash(capacity);
+    }
+
+    /* The key is not there, so it can reuse the first tombstone */
+    const std::size_t mask = _slots.size() - 1;
+    std::size_t i = index(key);
+    while(_slots[i].state == SlotState::Used) i = (i + 1) & mask;
+
+    Slot& slot = _slots[i];
+    if(slot.state == SlotState::Empty) ++_used;
+    slot.key = key;
+    slot.state = SlotState::Used;
+    ++_size;
+    return slot.value;
+}
+
+template<class T> void ResourceTable<T>::erase(const ResourceKey key) {
+    const std::size_t i = slot(key);
+    if(i == NotFound) return;
+
+    /* Destroy the value by swapping it with a temporary */
+    _slots[i].value = T{};
+    _slots[i].state = SlotState::Erased;
+    --_size;
+}
+
+template<class T> void ResourceTable<T>::rehash(const std::size_t capacity) {
+    std::vector<Slot> slots(capacity);
+    std::swap(slots, _slots);
+    _used = _size;
+    _shift = sizeof(std::size_t)*8;
+    for(std::size_t i = capacity; i > 1; i >>= 1) --_shift;
+
+    const std::size_t mask = capacity - 1;
+    for(Slot& slot: slots) {
+        if(slot.state != SlotState::Used) continue;
+
+        std::size_t i = index(slot.key);
+        while(_slots[i].state == SlotState::Used) i = (i + 1) & mask;
+        _slots[i].key = slot.key;
+        _slots[i].value = std::move(slot.value);
+        _slots[i].state = SlotState::Used;
+    }
 }
 
 template<class T> std::size_t ResourceManagerData<T>::referenceCount(const ResourceKey key) const {
-    auto it = _data.find(key);
-    if(it == _data.end()) return 0;
-    return it->second.referenceCount;
+    applyPending();
+    const Data* const found = _data.find(key);
+    if(!found) return 0;
+    return found->referenceCount;
 }
 
 template<class T> ResourceState ResourceManagerData<T>::state(const ResourceKey key) const {
-    const auto it = _data.find(key);
+    applyPending();
+    const Data* const found = _data.find(key);
 
     /* Resource not loaded */
-    if(it == _data.end() || !it->second.data) {
+    if(!found || !found->data) {
         /* Fallback found, add *Fallback to state */
         if(_fallback) {
-            if(it != _data.end() && it->second.state == ResourceDataState::Loading)
+            if(found && found->state == ResourceDataState::Loading)
                 return ResourceState::LoadingFallback;
-            else if(it != _data.end() && it->second.state == ResourceDataState::NotFound)
+            else if(found && found->state == ResourceDataState::NotFound)
                 return ResourceState::NotFoundFallback;
             else return ResourceState::NotLoadedFallback;
         }
 
         /* Fallback not found, loading didn't start yet */
-        if(it == _data.end() || (it->second.state != ResourceDataState::Loading && it->second.state != ResourceDataState::NotFound))
+        if(!found || (found->state != ResourceDataState::Loading && found->state != ResourceDataState::NotFound))
             return ResourceState::NotLoaded;
     }
 
     /* Loading / NotFound without fallback, Mutable / Final */
-    return static_cast<ResourceState>(it->second.state);
+    return static_cast<ResourceState>(found->state);
 }
 
 template<class T> template<class U> Resource<T, U> ResourceManagerData<T>::get(ResourceKey key) {
+    applyPending();
+
     /* Ask loader for the data, if they aren't there yet */
-    if(_loader && _data.find(key) == _data.end())
+    if(_loader && !_data.find(key))
         _loader->load(key);
 
     return Resource<T, U>(this, key);
 }
 
-template<class T> void ResourceManagerData<T>::set(const ResourceKey key, T* const data, const ResourceDataState state, const ResourcePolicy policy) {
-    auto it = _data.find(key);
+template<class T> void ResourceManagerData<T>::set(const ResourceKey key, T* const data, const ResourceDataState state, const ResourcePolicy policy, const std::size_t size) {
+    /* Apply everything published so far first so the updates are not
+       reordered */
+    applyPending();
+    setInternal(key, data, state, policy, size);
+}
+
+template<class T> void ResourceManagerData<T>::publish(const ResourceKey key, T* const data, const ResourceDataState state, const ResourcePolicy policy, const std::size_t size) {
+    /* Push to the front of the list of pending updates */
+    Pending* const pending = new Pending{_pending.load(std::memory_order_relaxed), key, data, state, policy, size};
+    while(!_pending.compare_exchange_weak(pending->next, pending, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<class T> void ResourceManagerData<T>::applyPendingInternal() {
+    /* Take the whole list and reverse it to have the updates in the order
+       they were published */
+    Pending* reversed = nullptr;
+    for(Pending* pending = _pending.exchange(nullptr, std::memory_order_acquire); pending; ) {
+        Pending* const next = pending->next;
+        pending->next = reversed;
+        reversed = pending;
+        pending = next;
+    }
+
+    while(reversed) {
+        Pending* const next = reversed->next;
+        setInternal(reversed->key, reversed->data, reversed->state, reversed->policy, reversed->size);
+        delete reversed;
+        reversed = next;
+    }
+}
+
+template<class T> void ResourceManagerData<T>::setInternal(const ResourceKey key, T* const data, const ResourceDataState state, const ResourcePolicy policy, const std::size_t size) {
+    Data* found = _data.find(key);
 
     /* NotFound / Loading state shouldn't have any data */
     CORRADE_ASSERT((data == nullptr) == (state == ResourceDataState::NotFound || state == ResourceDataState::Loading),
         "ResourceManager::set(): data should be null if and only if state is NotFound or Loading", );
 
     /* Cannot change resource with already final state */
-    CORRADE_ASSERT(it == _data.end() || it->second.state != ResourceDataState::Final,
+    CORRADE_ASSERT(!found || found->state != ResourceDataState::Final,
         "ResourceManager::set(): cannot change already final resource" << key, );
 
     /* Insert the resource, if not already there */
-    if(it == _data.end())
-        it = _data.emplace(key, Data()).first;
+    if(!found)
+        found = &_data[key];
 
     /* Otherwise delete previous data */
-    else safeDelete(it->second.data);
+    else {
+        safeDelete(found->data);
+        _memoryUsage -= found->size;
+    }
 
-    it->second.data = data;
-    it->second.state = state;
-    it->second.policy = policy;
+    found->data = data;
+    found->state = state;
+    found->policy = policy;
+    found->size = size;
+    found->lastUse = ++_lastUse;
+    _memoryUsage += size;
     ++_lastChange;
+
+    evict();
+}
+
+template<class T> void ResourceManagerData<T>::setBudget(const std::size_t budget) {
+    applyPending();
+    _budget = budget;
+    evict();
+}
+
+template<class T> void ResourceManagerData<T>::evict() {
+    if(_memoryUsage <= _budget) return;
+
+    /* Gather all resources that can be unloaded, least recently used first */
+    std::vector<std::pair<std::size_t, ResourceKey>> candidates;
+    _data.forEach([&candidates](const ResourceKey key, const Data& data) {
+        if(data.policy == ResourcePolicy::Budgeted && !data.referenceCount && data.size)
+            candidates.emplace_back(data.lastUse, key);
+    });
+    std::sort(candidates.begin(), candidates.end(), [](const std::pair<std::size_t, ResourceKey>& a, const std::pair<std::size_t, ResourceKey>& b) {
+        return a.first < b.first;
+    });
+
+    for(const std::pair<std::size_t, ResourceKey>& candidate: candidates) {
+        if(_memoryUsage <= _budget) break;
+        _memoryUsage -= _data.find(candidate.second)->size;
+        _data.erase(candidate.second);
+    }
 }
 
 template<class T> void ResourceManagerData<T>::setFallback(T* const data) {
@@ -561,11 +895,17 @@ template<class T> void ResourceManagerData<T>::setFallback(T* const data) {
 }
 
 template<class T> void ResourceManagerData<T>::free() {
+    applyPending();
+
     /* Delete all non-referenced non-resident resources */
-    for(auto it = _data.begin(); it != _data.end(); ) {
-        if(it->second.policy != ResourcePolicy::Resident && !it->second.referenceCount)
-            it = _data.erase(it);
-        else ++it;
+    std::vector<ResourceKey> unused;
+    _data.forEach([&unused](const ResourceKey key, const Data& data) {
+        if(data.policy != ResourcePolicy::Resident && !data.referenceCount)
+            unused.push_back(key);
+    });
+    for(const ResourceKey key: unused) {
+        _memoryUsage -= _data.find(key)->size;
+        _data.erase(key);
     }
 }
 
@@ -585,20 +925,30 @@ template<class T> void ResourceManagerData<T>::freeLoader() {
 }
 
 template<class T> void ResourceManagerData<T>::decrementReferenceCount(ResourceKey key) {
-    auto it = _data.find(key);
-    CORRADE_INTERNAL_ASSERT(it != _data.end());
+    Data* const found = _data.find(key);
+    CORRADE_INTERNAL_ASSERT(found);
+
+    if(--found->referenceCount) return;
 
     /* Free the resource if it is reference counted */
-    if(--it->second.referenceCount == 0 && it->second.policy == ResourcePolicy::ReferenceCounted)
-        _data.erase(it);
+    if(found->policy == ResourcePolicy::ReferenceCounted) {
+        _memoryUsage -= found->size;
+        _data.erase(key);
+
+    /* Remember when it was used for the last time, unload it if over
+       budget */
+    } else if(found->policy == ResourcePolicy::Budgeted) {
+        found->lastUse = ++_lastUse;
+        evict();
+    }
 }
 
 template<class T> struct ResourceManagerData<T>::Data {
-    Data(): data(nullptr), state(ResourceDataState::Mutable), policy(ResourcePolicy::Manual), referenceCount(0) {}
+    Data(): data(nullptr), state(ResourceDataState::Mutable), policy(ResourcePolicy::Manual), referenceCount(0), size(0), lastUse(0) {}
 
     Data(const Data&) = delete;
 
-    Data(Data&& other): data(other.data), state(other.state), policy(other.policy), referenceCount(other.referenceCount) {
+    Data(Data&& other): data(other.data), state(other.state), policy(other.policy), referenceCount(other.referenceCount), size(other.size), lastUse(other.lastUse) {
         other.data = nullptr;
         other.referenceCount = 0;
     }
@@ -606,12 +956,24 @@ template<class T> struct ResourceManagerData<T>::Data {
     ~Data();
 
     Data& operator=(const Data&) = delete;
-    Data& operator=(Data&&) = delete;
+
+    /* Swaps the contents, used by the table to move the data around and to
+       destroy them by swapping with a temporary */
+    Data& operator=(Data&& other) {
+        std::swap(data, other.data);
+        std::swap(state, other.state);
+        std::swap(policy, other.policy);
+        std::swap(referenceCount, other.referenceCount);
+        std::swap(size, other.size);
+        std::swap(lastUse, other.lastUse);
+        return *this;
+    }
 
     T* data;
     ResourceDataState state;
     ResourcePolicy policy;
     std::size_t referenceCount;
+    std::size_t size, lastUse;
 };
 
 template<class T> inline ResourceManagerData<T>::Data::~Data() {
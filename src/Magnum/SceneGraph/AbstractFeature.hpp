@@ -35,9 +35,13 @@ namespace Magnum { namespace SceneGraph {
 
 template<UnsignedInt dimensions, class T> AbstractFeature<dimensions, T>::AbstractFeature(AbstractObject<dimensions, T>& object) {
     object.Containers::template LinkedList<AbstractFeature<dimensions, T>>::insert(this);
+    object.doAddFeatures(1);
 }
 
-template<UnsignedInt dimensions, class T> AbstractFeature<dimensions, T>::~AbstractFeature() = default;
+template<UnsignedInt dimensions, class T> AbstractFeature<dimensions, T>::~AbstractFeature() {
+    /* If the object is being destroyed, this is a no-op */
+    object().doAddFeatures(-1);
+}
 
 template<UnsignedInt dimensions, class T> void AbstractFeature<dimensions, T>::markDirty() {}
 
@@ -31,6 +31,7 @@
 
 #include <functional>
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/LinkedList.h>
 
 #include "Magnum/DimensionTraits.h"
@@ -165,6 +166,39 @@ template<UnsignedInt dimensions, class T> class AbstractObject
             return doTransformationMatrices(objects, initialTransformationMatrix);
         }
 
+        /**
+         * @brief Transformation matrices of given set of objects relative to this object into existing storage
+         *
+         * Same as @ref transformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>&, const MatrixType&) const,
+         * but puts the result into @p transformationMatrices, replacing its
+         * previous contents. Together with scratch memory kept inside the
+         * @ref Scene, repeated calls with the same or a smaller set of
+         * objects don't do any heap allocation. Because of that, calls on the
+         * same scene can't be done concurrently, see
+         * @ref SceneGraph-Scene-concurrency.
+         * @warning This function cannot check if all objects are of the same
+         *      @ref Object type, use typesafe @ref Object::transformationMatrices()
+         *      when possible.
+         */
+        void transformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix = MatrixType()) const {
+            doTransformationMatrices(objects, transformationMatrices, initialTransformationMatrix);
+        }
+
+        /**
+         * @brief Transformation matrices of given set of objects relative to this object into a view
+         *
+         * Same as @ref transformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>&, std::vector<MatrixType>&, const MatrixType&) const,
+         * but takes the objects and puts the result into plain views, so
+         * both can be allocated for example from a @ref ScratchArena.
+         * Expects that both views have the same size.
+         * @warning This function cannot check if all objects are of the same
+         *      @ref Object type, use typesafe @ref Object::transformationMatrices()
+         *      when possible.
+         */
+        void transformationMatrices(Containers::ArrayView<const std::reference_wrapper<AbstractObject<dimensions, T>>> objects, Containers::ArrayView<MatrixType> transformationMatrices, const MatrixType& initialTransformationMatrix = MatrixType()) const {
+            doTransformationMatrices(objects, transformationMatrices, initialTransformationMatrix);
+        }
+
         /*@}*/
 
         /**
@@ -191,7 +225,9 @@ template<UnsignedInt dimensions, class T> class AbstractObject
          *
          * Returns @cpp true @ce if transformation of the object or any parent
          * has changed since last call to @ref setClean(), @cpp false @ce
-         * otherwise. All objects are dirty by default.
+         * otherwise. All objects are dirty by default. The dirty state is
+         * resolved lazily by going through all parents, once the object is
+         * found dirty, the state is cached until it's cleaned again.
          * @see @ref scenegraph-features-caching
          */
         bool isDirty() const { return doIsDirty(); }
@@ -199,10 +235,11 @@ template<UnsignedInt dimensions, class T> class AbstractObject
         /**
          * @brief Set object absolute transformation as dirty
          *
-         * Calls @ref AbstractFeature::markDirty() on all object features and
-         * recursively calls @ref setDirty() on every child object which is not
-         * already dirty. If the object is already marked as dirty, the
-         * function does nothing.
+         * Marks the transformation as changed and calls
+         * @ref AbstractFeature::markDirty() on all object features and on
+         * features of all children. Subtrees without any features or that
+         * were already notified since last clean are not visited, their
+         * dirty state is resolved lazily in @ref isDirty().
          * @see @ref scenegraph-features-caching, @ref setClean(),
          *      @ref isDirty()
          */
@@ -242,11 +279,16 @@ template<UnsignedInt dimensions, class T> class AbstractObject
         virtual MatrixType doTransformationMatrix() const = 0;
         virtual MatrixType doAbsoluteTransformationMatrix() const = 0;
         virtual std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix) const = 0;
+        virtual void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const = 0;
+        virtual void doTransformationMatrices(Containers::ArrayView<const std::reference_wrapper<AbstractObject<dimensions, T>>> objects, Containers::ArrayView<MatrixType> transformationMatrices, const MatrixType& initialTransformationMatrix) const = 0;
 
         virtual bool doIsDirty() const = 0;
         virtual void doSetDirty() = 0;
         virtual void doSetClean() = 0;
         virtual void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) = 0;
+
+        /* Called by features when they are added or removed */
+        virtual void doAddFeatures(Int count) = 0;
 };
 
 /**
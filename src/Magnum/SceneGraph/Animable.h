@@ -100,11 +100,14 @@ use @ref Timeline for that, see its documentation for more information.
 
 @section SceneGraph-Animable-multiple-groups Using multiple animable groups to improve performance
 
-@ref AnimableGroup is optimized for case when no animation is running --- it
-just puts itself to rest and waits until some animation changes its state to
-@ref AnimationState::Running again. If you put animations which are not
-pernamently running into separate group, they will not be traversed every time
-the @ref AnimableGroup::step() gets called, saving precious frame time.
+@ref AnimableGroup keeps track of animables that are running or have a pending
+state change and @ref AnimableGroup::step() visits only those. Stopped and
+paused animables are put to sleep and cost nothing until their state is
+changed with @ref setState() again, so a group with thousands of mostly idle
+animations costs only as much as the few that are actually running. For
+groups with many running animations it's possible to distribute the animation
+steps over multiple threads, see @ref SceneGraph-AnimableGroup-multithreading
+for more information.
 
 @section SceneGraph-Animable-explicit-specializations Explicit template specializations
 
@@ -201,6 +204,29 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
             return *this;
         }
 
+        /**
+         * @brief Whether the animation step can be executed concurrently
+         *
+         * @see @ref AnimableGroup::setThreadCount()
+         */
+        bool isConcurrent() const { return _concurrent; }
+
+        /**
+         * @brief Set whether the animation step can be executed concurrently
+         * @return Reference to self (for method chaining)
+         *
+         * Declares that @ref animationStep() doesn't modify any state shared
+         * with other animables and thus can be called from a worker thread in
+         * parallel with steps of other animables. Has effect only if
+         * @ref AnimableGroup::setThreadCount() is set to more than one
+         * thread, see @ref SceneGraph-AnimableGroup-multithreading for more
+         * information. Default is @cpp false @ce.
+         */
+        Animable<dimensions, T>& setConcurrent(bool concurrent) {
+            _concurrent = concurrent;
+            return *this;
+        }
+
         /**
          * @brief Group containing this animable
          *
@@ -301,6 +327,11 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
         bool _repeated;
         UnsignedShort _repeatCount;
         UnsignedShort _repeats;
+        bool _concurrent;
+        /* Group in whose list of awake animables this animable is, if any,
+           and position in that list */
+        AnimableGroup<dimensions, T>* _awakeIn;
+        std::size_t _awakeIndex;
 };
 
 /**
@@ -29,20 +29,29 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Animable.h and @ref AnimableGroup.h
  */
 
+#include <algorithm>
+#include <vector>
+
 #include "Magnum/Timeline.h"
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
 #include "Magnum/SceneGraph/Animable.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>{object, group}, _duration{0.0f}, _startTime{Constants::inf()}, _pauseTime{-Constants::inf()}, _previousState{AnimationState::Stopped}, _currentState{AnimationState::Stopped}, _repeated{false}, _repeatCount{0}, _repeats{0} {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>{object, group}, _duration{0.0f}, _startTime{Constants::inf()}, _pauseTime{-Constants::inf()}, _previousState{AnimationState::Stopped}, _currentState{AnimationState::Stopped}, _repeated{false}, _repeatCount{0}, _repeats{0}, _concurrent{false}, _awakeIn{nullptr}, _awakeIndex{0} {}
 
 template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {
     /* Update count of running animations when deleting an animable that's
-       currently running */
-    if(animables() && _currentState == AnimationState::Running)
+       currently running. The count is updated only in step(), so what
+       matters is the state it saw last time. */
+    if(animables() && _previousState == AnimationState::Running)
         --animables()->_runningCount;
+
+    /* Remove itself from the list of awake animables */
+    if(_awakeIn) _awakeIn->removeAwake(*this);
 }
 
 template<UnsignedInt dimensions, class T> Animable<dimensions, T>& Animable<dimensions, T>::setState(AnimationState state) {
@@ -52,9 +61,19 @@ template<UnsignedInt dimensions, class T> Animable<dimensions, T>& Animable<dime
     if(_previousState == AnimationState::Stopped && state == AnimationState::Paused)
         return *this;
 
-    /* Wake up the group in case no animations are running */
-    animables()->wakeUp = true;
     _currentState = state;
+
+    /* Wake up so the group processes the state change in next step(). If
+       still in the list of a group this animable was in before, remove it
+       from there. */
+    AnimableGroup<dimensions, T>* const group = animables();
+    if(group && _awakeIn != group) {
+        if(_awakeIn) _awakeIn->removeAwake(*this);
+        _awakeIndex = group->_awake.size();
+        group->_awake.push_back(this);
+        _awakeIn = group;
+    }
+
     return *this;
 }
 
@@ -66,12 +85,57 @@ template<UnsignedInt dimensions, class T> const AnimableGroup<dimensions, T>* An
     return static_cast<const AnimableGroup<dimensions, T>*>(AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>::group());
 }
 
-template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta) {
-    if(!_runningCount && !wakeUp) return;
-    wakeUp = false;
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>::~AnimableGroup() {
+    for(Animable<dimensions, T>* animable: _awake)
+        if(animable && animable->_awakeIn == this) animable->_awakeIn = nullptr;
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::removeAwake(Animable<dimensions, T>& animable) {
+    CORRADE_INTERNAL_ASSERT(animable._awakeIn == this && _awake[animable._awakeIndex] == &animable);
+    animable._awakeIn = nullptr;
+
+    /* The list is being iterated and compacted in step(), leave a hole there
+       that gets dropped at the end of it */
+    if(_stepping) {
+        _awake[animable._awakeIndex] = nullptr;
+        return;
+    }
+
+    /* Otherwise move the last animable in place of the removed one */
+    Animable<dimensions, T>* const last = _awake.back();
+    _awake[animable._awakeIndex] = last;
+    last->_awakeIndex = animable._awakeIndex;
+    _awake.pop_back();
+}
 
-    for(std::size_t i = 0; i != AnimableGroup<dimensions, T>::size(); ++i) {
-        Animable<dimensions, T>& animable = (*this)[i];
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta) {
+    /* All animables are sleeping, nothing to do */
+    if(_awake.empty()) return;
+
+    /* If multithreaded step is enabled, the steps of concurrent animables are
+       only gathered here and executed after all state changes are processed */
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    const bool parallel = _threadCount > 1 && _awake.size() >= ParallelStepThreshold;
+    std::vector<std::pair<Animable<dimensions, T>*, Float>> running;
+    #endif
+
+    /* Go only through the awake animables. The ones that are still running
+       after this step are moved to the front of the list, the others are put
+       to sleep and removed from the list afterwards. The callbacks can wake
+       up other animables, which appends them to the list, so the size has to
+       be queried in every iteration. Animables destroyed or moved to other
+       lists by the callbacks leave a hole in the list. */
+    _stepping = true;
+    std::size_t keep = 0;
+    for(std::size_t i = 0; i != _awake.size(); ++i) {
+        if(!_awake[i]) continue;
+        Animable<dimensions, T>& animable = *_awake[i];
+
+        /* The animable was moved to another group meanwhile, drop it */
+        if(animable.animables() != this) {
+            if(animable._awakeIn == this) animable._awakeIn = nullptr;
+            continue;
+        }
 
         /* The animation was stopped recently, just decrease count of running
            animations if the animation was running before */
@@ -79,6 +143,7 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             if(animable._previousState == AnimationState::Running)
                 --_runningCount;
             animable._previousState = AnimationState::Stopped;
+            animable._awakeIn = nullptr;
             animable.animationStopped();
             continue;
 
@@ -87,12 +152,14 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             animable._previousState = AnimationState::Paused;
             animable._pauseTime = time;
             --_runningCount;
+            animable._awakeIn = nullptr;
             animable.animationPaused();
             continue;
 
-        /* Skip the rest for not running animations */
+        /* Put not running animations to sleep */
         } else if(animable._currentState != AnimationState::Running) {
             CORRADE_INTERNAL_ASSERT(animable._previousState == animable._currentState);
+            animable._awakeIn = nullptr;
             continue;
 
         /* The animation was started recently, set start time to previous frame
@@ -121,6 +188,7 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
                 animable._previousState = AnimationState::Stopped;
                 animable._currentState = AnimationState::Stopped;
                 --_runningCount;
+                animable._awakeIn = nullptr;
                 animable.animationStopped();
                 continue;
             }
@@ -135,10 +203,47 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             "SceneGraph::AnimableGroup::step(): animation was started in future - probably wrong time passed", );
         CORRADE_ASSERT(delta >= 0.0f,
             "SceneGraph::AnimableGroup::step(): negative delta passed", );
+        std::swap(_awake[keep], _awake[i]);
+        animable._awakeIndex = keep++;
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        if(parallel && animable._concurrent) {
+            running.emplace_back(&animable, time - animable._startTime);
+            continue;
+        }
+        #endif
         animable.animationStep(time - animable._startTime, delta);
     }
 
+    /* Drop the sleeping animables and holes left by the callbacks in the kept
+       part of the list */
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != keep; ++i) {
+        if(!_awake[i]) continue;
+        _awake[i]->_awakeIndex = count;
+        _awake[count++] = _awake[i];
+    }
+    _awake.resize(count);
+    _stepping = false;
     CORRADE_INTERNAL_ASSERT((_runningCount <= AnimableGroup<dimensions, T>::size()));
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Multithreaded step on the global job executor, each task steps a
+       contiguous range of running animables */
+    if(parallel) {
+        const std::size_t count = running.size();
+        if(count < ParallelStepThreshold) {
+            for(const std::pair<Animable<dimensions, T>*, Float>& animable: running)
+                animable.first->animationStep(animable.second, delta);
+            return;
+        }
+
+        const std::size_t taskCount = Math::min(std::size_t(_threadCount)*ParallelTasksPerThread, count);
+        Magnum::Implementation::parallelFor(_threadCount, taskCount, [&running, taskCount, count, delta](const std::size_t task) {
+            for(std::size_t i = task*count/taskCount, end = (task + 1)*count/taskCount; i != end; ++i)
+                running[i].first->animationStep(running[i].second, delta);
+        });
+    }
+    #endif
 }
 
 }}
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::AnimableGroup, alias @ref Magnum::SceneGraph::BasicAnimableGroup2D, @ref Magnum::SceneGraph::BasicAnimableGroup3D, typedef @ref Magnum::SceneGraph::AnimableGroup2D, @ref Magnum::SceneGraph::AnimableGroup3D
  */
 
+#include <vector>
+
 #include "Magnum/SceneGraph/Animable.h"
 #include "Magnum/SceneGraph/FeatureGroup.h"
 #include "Magnum/SceneGraph/visibility.h"
@@ -39,6 +41,36 @@ namespace Magnum { namespace SceneGraph {
 @brief Group of animables
 
 See @ref Animable for more information.
+
+@section SceneGraph-AnimableGroup-multithreading Multithreaded step
+
+Using @ref setThreadCount(), the @ref Animable::animationStep() calls inside
+@ref step() can be distributed over worker threads of
+@ref globalJobExecutor(), no threads are spawned by the step itself. Only
+animables that declare themselves safe for that using
+@ref Animable::setConcurrent() are stepped on worker threads, the others are
+stepped on the calling thread as usual. The state changes and all other
+callbacks such as @ref Animable::animationStarted() are also processed on the
+calling thread, only the running concurrent animables are then split into
+contiguous ranges that are picked up by worker threads in a first-come,
+first-serve manner. This is useful for example with each animable advancing
+its own @ref Animation::Player, similarly to what @ref Animation::PlayerGroup
+does.
+
+@code{.cpp}
+animables.setThreadCount(std::thread::hardware_concurrency());
+for(Animable3D* animable: independentAnimables)
+    animable->setConcurrent(true);
+@endcode
+
+The @ref Animable::animationStep() implementations of concurrent animables
+have to be thread-safe, i.e. not modify any state shared with other animables.
+If less than @ref ParallelStepThreshold concurrent animables are running, the
+job executor is not used at all, as the overhead would outweigh the gains.
+Multithreaded step is not available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where @ref setThreadCount() is
+ignored.
+
 @see @ref scenegraph, @ref BasicAnimableGroup2D, @ref BasicAnimableGroup3D,
     @ref AnimableGroup2D, @ref AnimableGroup3D
 */
@@ -46,10 +78,29 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
     friend Animable<dimensions, T>;
 
     public:
+        enum: std::size_t {
+            /**
+             * Minimal running animable count for which multithreaded step is
+             * done. See @ref SceneGraph-AnimableGroup-multithreading for more
+             * information.
+             */
+            ParallelStepThreshold = 64,
+
+            /**
+             * Task count per thread. The tasks are assigned to threads
+             * dynamically, having more tasks than threads makes the work
+             * distribution more even if some animables are more expensive to
+             * step than others.
+             */
+            ParallelTasksPerThread = 4
+        };
+
         /**
          * @brief Constructor
          */
-        explicit AnimableGroup(): _runningCount(0), wakeUp(false) {}
+        explicit AnimableGroup(): _runningCount(0), _threadCount(1), _stepping(false) {}
+
+        ~AnimableGroup();
 
         /**
          * @brief Count of running animations
@@ -63,14 +114,47 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
          * @param time      Absolute time (e.g. @ref Timeline::previousFrameTime())
          * @param delta     Time delta for current frame (e.g. @ref Timeline::previousFrameDuration())
          *
-         * If there are no running animations the function does nothing.
+         * Visits only animables that are running or have their state changed
+         * since the last call, if there are none the function does nothing.
          * @see @ref runningCount()
          */
         void step(Float time, Float delta);
 
+        /**
+         * @brief Thread count used for animation step
+         *
+         * Default is @cpp 1 @ce, meaning all animations are stepped only on
+         * the calling thread.
+         */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count used for animation step
+         * @return Reference to self (for method chaining)
+         *
+         * The calling thread is counted as well. Value of @cpp 0 @ce is
+         * treated the same as @cpp 1 @ce. See
+         * @ref SceneGraph-AnimableGroup-multithreading for more information.
+         */
+        AnimableGroup<dimensions, T>& setThreadCount(UnsignedInt count) {
+            #ifndef CORRADE_TARGET_EMSCRIPTEN
+            _threadCount = count ? count : 1;
+            #else
+            static_cast<void>(count);
+            #endif
+            return *this;
+        }
+
     private:
+        /* Removes an animable from the list of awake animables in O(1) */
+        void removeAwake(Animable<dimensions, T>& animable);
+
         std::size_t _runningCount;
-        bool wakeUp;
+        UnsignedInt _threadCount;
+        /* Set while step() iterates the list of awake animables */
+        bool _stepping;
+        /* Animables that are running or have a pending state change */
+        std::vector<Animable<dimensions, T>*> _awake;
 };
 
 /**
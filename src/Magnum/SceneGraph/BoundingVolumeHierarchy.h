@@ -0,0 +1,310 @@
+#ifndef Magnum_SceneGraph_BoundingVolumeHierarchy_h
+#define Magnum_SceneGraph_BoundingVolumeHierarchy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BoundingVolumeHierarchy, alias @ref Magnum::SceneGraph::BasicBoundingVolumeHierarchy2D, @ref Magnum::SceneGraph::BasicBoundingVolumeHierarchy3D, typedef @ref Magnum::SceneGraph::BoundingVolumeHierarchy2D, @ref Magnum::SceneGraph::BoundingVolumeHierarchy3D
+ */
+
+#include <functional>
+#include <vector>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Bounding volume hierarchy of drawables
+
+Accelerates frustum culling of large @ref DrawableGroup "drawable groups",
+making its cost logarithmic in the number of drawables instead of linear. The
+hierarchy is built from bounding volumes of all drawables in the group (see
+@ref SceneGraph-Drawable-culling) transformed to world space and is then
+drawn using @ref Camera::draw(BoundingVolumeHierarchy<dimensions, T>&):
+
+@code{.cpp}
+SceneGraph::DrawableGroup3D drawables;
+// add drawables with bounding volumes to the group...
+
+SceneGraph::BoundingVolumeHierarchy3D hierarchy{drawables};
+hierarchy.build();
+
+// every frame
+camera.draw(hierarchy);
+@endcode
+
+@section SceneGraph-BoundingVolumeHierarchy-refit Incremental updates
+
+The hierarchy doesn't need to be rebuilt when objects move. The hierarchy
+attaches an internal feature to the object of each drawable, which gets
+notified when the object is marked dirty through @ref Object::setDirty(), so
+it works independently of what the drawables do in their own
+@ref AbstractFeature::markDirty() and @ref AbstractFeature::clean(). The next
+call to @ref refit() (which is done implicitly when drawing) recalculates
+world-space bounding volumes only of the drawables that changed and propagates
+them up the tree. The cost of a refit is
+thus proportional to the count of moved drawables, not to the size of the
+whole hierarchy. Changing the bounding volume of a drawable that's part of the
+hierarchy using @ref Drawable::setBoundingSphere() or
+@ref Drawable::setBoundingBox() is handled the same way.
+
+The tree topology is kept during refits, so if drawables move far away from
+their original position the culling efficiency slowly degrades. Call
+@ref build() again in that case. A full rebuild is done implicitly by
+@ref refit() after drawables are added to the group or removed from it
+(including their destruction) and after bounding volume of some drawable
+changes from or to @ref DrawableBoundingVolume::None, so these operations are
+more expensive than just moving the objects.
+
+Drawables without any bounding volume are kept outside of the tree and are
+always drawn. The draw order follows the tree layout and is otherwise
+unspecified.
+
+@section SceneGraph-BoundingVolumeHierarchy-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref BoundingVolumeHierarchy.hpp implementation file to
+avoid linker errors. See also @ref compilation-speedup-hpp for more
+information.
+
+-   @ref BoundingVolumeHierarchy2D
+-   @ref BoundingVolumeHierarchy3D
+
+@see @ref scenegraph, @ref BasicBoundingVolumeHierarchy2D,
+    @ref BasicBoundingVolumeHierarchy3D
+*/
+template<UnsignedInt dimensions, class T> class BoundingVolumeHierarchy {
+    public:
+        enum: UnsignedInt {
+            /**
+             * Max count of drawables in a leaf node of the tree
+             */
+            LeafSize = 4
+        };
+
+        /**
+         * @brief Constructor
+         * @param drawables     Drawable group to build the hierarchy from
+         *
+         * The hierarchy is initially empty, call @ref build() to populate
+         * it.
+         */
+        explicit BoundingVolumeHierarchy(DrawableGroup<dimensions, T>& drawables);
+
+        /** @brief Copying is not allowed */
+        BoundingVolumeHierarchy(const BoundingVolumeHierarchy<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        BoundingVolumeHierarchy(BoundingVolumeHierarchy<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Detaches all drawables from the hierarchy.
+         */
+        ~BoundingVolumeHierarchy();
+
+        /** @brief Copying is not allowed */
+        BoundingVolumeHierarchy<dimensions, T>& operator=(const BoundingVolumeHierarchy<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        BoundingVolumeHierarchy<dimensions, T>& operator=(BoundingVolumeHierarchy<dimensions, T>&&) = delete;
+
+        /** @brief Drawable group */
+        DrawableGroup<dimensions, T>& drawables() { return _drawables; }
+        const DrawableGroup<dimensions, T>& drawables() const { return _drawables; } /**< @overload */
+
+        /**
+         * @brief Count of drawables in the hierarchy
+         *
+         * Includes also drawables without a bounding volume, which are kept
+         * outside of the tree.
+         */
+        std::size_t size() const { return _items.size(); }
+
+        /** @brief Count of tree nodes */
+        std::size_t nodeCount() const { return _nodes.size(); }
+
+        /**
+         * @brief Count of drawables waiting for a refit
+         *
+         * @see @ref refit()
+         */
+        std::size_t dirtyCount() const { return _dirty.size(); }
+
+        /**
+         * @brief World-space bounds of the whole tree
+         *
+         * Returns a default-constructed range if there are no drawables with
+         * a bounding volume. Valid only if @ref dirtyCount() is @cpp 0 @ce.
+         */
+        RangeTypeFor<dimensions, T> bounds() const {
+            return _nodes.empty() ? RangeTypeFor<dimensions, T>{} : _nodes[0].box;
+        }
+
+        /**
+         * @brief Build the hierarchy
+         *
+         * Discards the previous contents and builds the tree from scratch
+         * from all drawables currently in @ref drawables(). All drawables in
+         * the group are expected to be part of the same scene. Attaches an
+         * internal feature with @ref CachedTransformation::Absolute enabled
+         * to objects of all drawables, so the hierarchy gets notified about
+         * their transformation changes. Called implicitly from @ref refit()
+         * if the hierarchy is out of date.
+         */
+        void build();
+
+        /**
+         * @brief Refit the hierarchy
+         *
+         * Cleans objects of drawables that were marked dirty since the last
+         * call, recalculates their world-space bounding volumes and
+         * propagates the changes up the tree. If drawables were added to or
+         * removed from @ref drawables() since the last @ref build() or a
+         * bounding volume of some drawable changed from or to
+         * @ref DrawableBoundingVolume::None, calls @ref build() instead.
+         * Otherwise does nothing if @ref dirtyCount() is @cpp 0 @ce. Called
+         * implicitly from @ref drawableTransformations(). See
+         * @ref SceneGraph-BoundingVolumeHierarchy-refit for more information.
+         */
+        void refit();
+
+        /**
+         * @brief Transformations of visible drawables
+         *
+         * Calls @ref refit(), traverses the tree and fills @p out with
+         * drawables whose bounding volume intersects view frustum of
+         * @p camera, together with their transformations relative to
+         * @p camera. Drawables without a bounding volume are always
+         * included. Existing capacity of @p out is reused. The result can be
+         * further sorted and passed to
+         * @ref Camera::draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&).
+         */
+        void drawableTransformations(Camera<dimensions, T>& camera, std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& out);
+
+    private:
+        #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        friend Drawable<dimensions, T>;
+        friend Camera<dimensions, T>;
+        #endif
+
+        /* Object::transformations() is limited to 65k objects including
+           their parents */
+        enum: std::size_t { ObjectBatchSize = 16384 };
+
+        /* Attached to objects of all drawables in the hierarchy, defined in
+           the *.hpp */
+        class Feature;
+
+        struct Item {
+            /* Null if the drawable or the feature was destroyed */
+            Drawable<dimensions, T>* drawable;
+            Feature* feature;
+            MatrixTypeFor<dimensions, T> absoluteTransformation;
+            RangeTypeFor<dimensions, T> box;
+            UnsignedInt node;
+            bool dirty;
+        };
+
+        /* Leaf nodes reference count items starting at first, inner nodes
+           have count set to zero and their two children at first and
+           first + 1 */
+        struct Node {
+            RangeTypeFor<dimensions, T> box;
+            Int parent;
+            UnsignedInt first;
+            UnsignedInt count;
+        };
+
+        void markDirty(UnsignedInt item);
+        bool isStale() const;
+        void detach();
+        RangeTypeFor<dimensions, T> nodeBox(const Node& node) const;
+
+        DrawableGroup<dimensions, T>& _drawables;
+        std::vector<Item> _items;
+        std::size_t _boundedCount;
+        std::vector<Node> _nodes;
+        std::vector<UnsignedInt> _dirty;
+        std::size_t _modificationCount;
+
+        /* Scratch memory reused between calls */
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _objectScratch;
+        std::vector<UnsignedInt> _nodeStack;
+        std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> _drawableTransformations;
+};
+
+/**
+@brief Bounding volume hierarchy for two-dimensional scenes
+
+Convenience alternative to @cpp BoundingVolumeHierarchy<2, T> @ce. See
+@ref BoundingVolumeHierarchy for more information.
+@see @ref BoundingVolumeHierarchy2D, @ref BasicBoundingVolumeHierarchy3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicBoundingVolumeHierarchy2D = BoundingVolumeHierarchy<2, T>;
+#endif
+
+/**
+@brief Bounding volume hierarchy for two-dimensional float scenes
+
+@see @ref BoundingVolumeHierarchy3D
+*/
+typedef BasicBoundingVolumeHierarchy2D<Float> BoundingVolumeHierarchy2D;
+
+/**
+@brief Bounding volume hierarchy for three-dimensional scenes
+
+Convenience alternative to @cpp BoundingVolumeHierarchy<3, T> @ce. See
+@ref BoundingVolumeHierarchy for more information.
+@see @ref BoundingVolumeHierarchy3D, @ref BasicBoundingVolumeHierarchy2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicBoundingVolumeHierarchy3D = BoundingVolumeHierarchy<3, T>;
+#endif
+
+/**
+@brief Bounding volume hierarchy for three-dimensional float scenes
+
+@see @ref BoundingVolumeHierarchy2D
+*/
+typedef BasicBoundingVolumeHierarchy3D<Float> BoundingVolumeHierarchy3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BoundingVolumeHierarchy<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT BoundingVolumeHierarchy<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,316 @@
+#ifndef Magnum_SceneGraph_BoundingVolumeHierarchy_hpp
+#define Magnum_SceneGraph_BoundingVolumeHierarchy_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref BoundingVolumeHierarchy.h
+ */
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/BoundingVolumeHierarchy.h"
+#include "Magnum/SceneGraph/Camera.hpp"
+
+namespace Magnum { namespace SceneGraph {
+
+/* Using a separate feature instead of Drawable::markDirty() and
+   Drawable::clean(), so the hierarchy doesn't depend on drawable subclasses
+   calling the base implementation when overriding these */
+template<UnsignedInt dimensions, class T> class BoundingVolumeHierarchy<dimensions, T>::Feature: public AbstractFeature<dimensions, T> {
+    public:
+        explicit Feature(AbstractObject<dimensions, T>& object, BoundingVolumeHierarchy<dimensions, T>& hierarchy, UnsignedInt item): AbstractFeature<dimensions, T>{object}, _hierarchy(hierarchy), _item{item} {
+            this->setCachedTransformations(CachedTransformation::Absolute);
+        }
+
+        ~Feature() {
+            _hierarchy._items[_item].feature = nullptr;
+        }
+
+        void setItem(UnsignedInt item) { _item = item; }
+
+    private:
+        void markDirty() override {
+            _hierarchy.markDirty(_item);
+        }
+
+        void clean(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) override {
+            _hierarchy._items[_item].absoluteTransformation = absoluteTransformationMatrix;
+        }
+
+        BoundingVolumeHierarchy<dimensions, T>& _hierarchy;
+        UnsignedInt _item;
+};
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>::BoundingVolumeHierarchy(DrawableGroup<dimensions, T>& drawables): _drawables(drawables), _boundedCount{}, _modificationCount{drawables._modificationCount} {}
+
+template<UnsignedInt dimensions, class T> BoundingVolumeHierarchy<dimensions, T>::~BoundingVolumeHierarchy() {
+    detach();
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::detach() {
+    for(Item& item: _items) {
+        if(item.drawable) item.drawable->_hierarchy = nullptr;
+
+        /* The feature resets the pointer in its destructor */
+        delete item.feature;
+    }
+
+    _items.clear();
+    _nodes.clear();
+    _dirty.clear();
+    _boundedCount = 0;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::markDirty(const UnsignedInt item) {
+    if(_items[item].dirty) return;
+
+    _items[item].dirty = true;
+    _dirty.push_back(item);
+}
+
+template<UnsignedInt dimensions, class T> bool BoundingVolumeHierarchy<dimensions, T>::isStale() const {
+    /* Drawables were added to the group or removed from it */
+    if(_modificationCount != _drawables._modificationCount) return true;
+
+    /* Some drawable got a bounding volume or lost it, so it has to be moved
+       into or out of the tree. Changing a bounding volume marks the item
+       dirty, so checking just these is enough. */
+    for(const UnsignedInt i: _dirty) {
+        const Item& item = _items[i];
+        if(item.drawable && (i < _boundedCount) != (item.drawable->boundingVolume() != DrawableBoundingVolume::None))
+            return true;
+    }
+
+    return false;
+}
+
+template<UnsignedInt dimensions, class T> RangeTypeFor<dimensions, T> BoundingVolumeHierarchy<dimensions, T>::nodeBox(const Node& node) const {
+    /* Inner node, union of the two children */
+    if(!node.count) {
+        const RangeTypeFor<dimensions, T>& a = _nodes[node.first].box;
+        const RangeTypeFor<dimensions, T>& b = _nodes[node.first + 1].box;
+        return {Math::min(a.min(), b.min()), Math::max(a.max(), b.max())};
+    }
+
+    /* Leaf node, union of all items */
+    RangeTypeFor<dimensions, T> box = _items[node.first].box;
+    for(std::size_t i = node.first + 1; i != node.first + node.count; ++i)
+        box = {Math::min(box.min(), _items[i].box.min()),
+               Math::max(box.max(), _items[i].box.max())};
+    return box;
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::build() {
+    detach();
+    _modificationCount = _drawables._modificationCount;
+    if(!_drawables.size()) return;
+
+    /* Drawables with a bounding volume go first, the rest is kept after them
+       outside of the tree */
+    for(std::size_t i = 0; i != _drawables.size(); ++i)
+        if(_drawables[i].boundingVolume() != DrawableBoundingVolume::None)
+            _items.push_back({&_drawables[i], nullptr, {}, {}, 0, false});
+    _boundedCount = _items.size();
+    for(std::size_t i = 0; i != _drawables.size(); ++i)
+        if(_drawables[i].boundingVolume() == DrawableBoundingVolume::None)
+            _items.push_back({&_drawables[i], nullptr, {}, {}, 0, false});
+
+    /* Attach the drawables and add a feature to their objects so the
+       hierarchy gets notified about object changes */
+    for(std::size_t i = 0; i != _items.size(); ++i) {
+        Drawable<dimensions, T>& drawable = *_items[i].drawable;
+        drawable._hierarchy = this;
+        drawable._hierarchyItem = i;
+        _items[i].feature = new Feature{drawable.object(), *this, UnsignedInt(i)};
+    }
+
+    /* Calculate absolute transformations of all drawables and clean the
+       objects so further changes get propagated through the features. Object::transformations() can handle only a
+       limited number of objects at once, so do that in batches. */
+    AbstractObject<dimensions, T>* scene = _items.front().drawable->object().scene();
+    CORRADE_ASSERT(scene, "SceneGraph::BoundingVolumeHierarchy::build(): the drawables are not part of any scene", );
+    std::vector<MatrixTypeFor<dimensions, T>> transformations;
+    for(std::size_t offset = 0; offset < _items.size(); offset += ObjectBatchSize) {
+        const std::size_t end = std::min(offset + ObjectBatchSize, _items.size());
+        _objectScratch.clear();
+        for(std::size_t i = offset; i != end; ++i)
+            _objectScratch.push_back(_items[i].drawable->object());
+        scene->transformationMatrices(_objectScratch, transformations);
+        for(std::size_t i = offset; i != end; ++i)
+            _items[i].absoluteTransformation = transformations[i - offset];
+        AbstractObject<dimensions, T>::setClean(_objectScratch);
+    }
+
+    for(std::size_t i = 0; i != _boundedCount; ++i)
+        _items[i].box = Implementation::transformedBoundingBox<dimensions, T>(_items[i].absoluteTransformation, _items[i].drawable->boundingBox());
+
+    /* Build the tree top-down, splitting each node at the median of item
+       centers along its longest axis */
+    if(_boundedCount) {
+        _nodes.push_back({{}, -1, 0, UnsignedInt(_boundedCount)});
+        _nodeStack.clear();
+        _nodeStack.push_back(0);
+        while(!_nodeStack.empty()) {
+            const UnsignedInt id = _nodeStack.back();
+            _nodeStack.pop_back();
+
+            _nodes[id].box = nodeBox(_nodes[id]);
+            const UnsignedInt first = _nodes[id].first;
+            const UnsignedInt count = _nodes[id].count;
+
+            /* Small enough, make it a leaf */
+            if(count <= LeafSize) {
+                for(std::size_t i = first; i != first + count; ++i)
+                    _items[i].node = id;
+                continue;
+            }
+
+            /* Find the longest axis of item centers */
+            VectorTypeFor<dimensions, T> min = _items[first].box.center();
+            VectorTypeFor<dimensions, T> max = min;
+            for(std::size_t i = first + 1; i != first + count; ++i) {
+                const VectorTypeFor<dimensions, T> center = _items[i].box.center();
+                min = Math::min(min, center);
+                max = Math::max(max, center);
+            }
+            const VectorTypeFor<dimensions, T> size = max - min;
+            std::size_t axis = 0;
+            for(std::size_t i = 1; i != dimensions; ++i)
+                if(size[i] > size[axis]) axis = i;
+
+            /* Partition the items at the median */
+            const UnsignedInt half = count/2;
+            std::nth_element(_items.begin() + first, _items.begin() + first + half, _items.begin() + first + count, [axis](const Item& a, const Item& b) {
+                return a.box.min()[axis] + a.box.max()[axis] < b.box.min()[axis] + b.box.max()[axis];
+            });
+
+            /* Make it an inner node with two children */
+            const UnsignedInt children = _nodes.size();
+            _nodes[id].first = children;
+            _nodes[id].count = 0;
+            _nodes.push_back({{}, Int(id), first, half});
+            _nodes.push_back({{}, Int(id), first + half, count - half});
+            _nodeStack.push_back(children + 1);
+            _nodeStack.push_back(children);
+        }
+    }
+
+    /* The items got reordered, update their indices in the drawables and
+       features */
+    for(std::size_t i = 0; i != _items.size(); ++i) {
+        _items[i].drawable->_hierarchyItem = i;
+        _items[i].feature->setItem(i);
+    }
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::refit() {
+    /* The tree doesn't match the group anymore, rebuild it from scratch */
+    if(isStale()) {
+        build();
+        return;
+    }
+
+    if(_dirty.empty()) return;
+
+    /* Clean all dirty objects in batches, the features save the new absolute
+       transformations */
+    for(std::size_t offset = 0; offset < _dirty.size(); offset += ObjectBatchSize) {
+        const std::size_t end = std::min(offset + ObjectBatchSize, _dirty.size());
+        _objectScratch.clear();
+        for(std::size_t i = offset; i != end; ++i)
+            if(_items[_dirty[i]].drawable)
+                _objectScratch.push_back(_items[_dirty[i]].drawable->object());
+        AbstractObject<dimensions, T>::setClean(_objectScratch);
+    }
+
+    for(const UnsignedInt i: _dirty) {
+        Item& item = _items[i];
+        item.dirty = false;
+
+        /* Destroyed drawables and drawables outside of the tree don't have
+           any box to update */
+        if(!item.drawable || i >= _boundedCount) continue;
+
+        item.box = Implementation::transformedBoundingBox<dimensions, T>(item.absoluteTransformation, item.drawable->boundingBox());
+
+        /* Propagate the change up the tree, stopping once a node box doesn't
+           change */
+        Int id = item.node;
+        do {
+            const RangeTypeFor<dimensions, T> box = nodeBox(_nodes[id]);
+            if(box == _nodes[id].box) break;
+            _nodes[id].box = box;
+            id = _nodes[id].parent;
+        } while(id != -1);
+    }
+
+    _dirty.clear();
+}
+
+template<UnsignedInt dimensions, class T> void BoundingVolumeHierarchy<dimensions, T>::drawableTransformations(Camera<dimensions, T>& camera, std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& out) {
+    out.clear();
+    refit();
+
+    /* Test world-space boxes against the frustum given by the combined
+       projection and camera matrix */
+    const MatrixTypeFor<dimensions, T> cameraMatrix = camera.cameraMatrix();
+    const Implementation::DrawableCulling<dimensions, T> culling{camera.projectionMatrix()*cameraMatrix};
+
+    if(!_nodes.empty()) {
+        _nodeStack.clear();
+        _nodeStack.push_back(0);
+        while(!_nodeStack.empty()) {
+            const Node& node = _nodes[_nodeStack.back()];
+            _nodeStack.pop_back();
+
+            if(!culling.isBoxVisible(node.box)) continue;
+
+            if(!node.count) {
+                _nodeStack.push_back(node.first + 1);
+                _nodeStack.push_back(node.first);
+                continue;
+            }
+
+            for(std::size_t i = node.first; i != node.first + node.count; ++i) {
+                const Item& item = _items[i];
+                if(!item.drawable || (node.count != 1 && !culling.isBoxVisible(item.box)))
+                    continue;
+                out.emplace_back(*item.drawable, cameraMatrix*item.absoluteTransformation);
+            }
+        }
+    }
+
+    /* Drawables without a bounding volume are always visible */
+    for(std::size_t i = _boundedCount; i != _items.size(); ++i)
+        if(_items[i].drawable)
+            out.emplace_back(*_items[i].drawable, cameraMatrix*_items[i].absoluteTransformation);
+}
+
+}}
+
+#endif
@@ -26,9 +26,15 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::SceneGraph::Camera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
+ * @brief Class @ref Magnum::SceneGraph::Camera, @ref Magnum::SceneGraph::DrawableTransformations, @ref Magnum::SceneGraph::RigidDrawableTransformations, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
  */
 
+#include <initializer_list>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Math/DualComplex.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/AbstractFeature.h"
@@ -54,8 +60,161 @@ enum class AspectRatioPolicy: UnsignedByte {
 
 namespace Implementation {
     template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRatioFix(AspectRatioPolicy aspectRatioPolicy, const Math::Vector2<T>& projectionScale, const Vector2i& viewport);
+
+    /* Culling volume of one view for multi-view rendering. In 2D the clip
+       box is tested using the matrix directly, in 3D the frustum planes are
+       extracted upfront so it's not done for each draw. */
+    template<UnsignedInt, class> struct ViewCullingVolume;
+    template<class T> struct ViewCullingVolume<2, T> {
+        typedef Math::Matrix3<T> Type;
+        static Type from(const Math::Matrix3<T>& matrix) { return matrix; }
+    };
+    template<class T> struct ViewCullingVolume<3, T> {
+        typedef Math::Frustum<T> Type;
+        static Type from(const Math::Matrix4<T>& matrix) {
+            return Math::Frustum<T>::fromMatrix(matrix);
+        }
+    };
 }
 
+/**
+@brief Reusable storage for drawable transformations
+
+Caller-owned storage for
+@ref Camera::draw(DrawableGroup<dimensions, T>&, DrawableTransformations<dimensions, T>&)
+and @ref Camera::drawableTransformations(DrawableGroup<dimensions, T>&, DrawableTransformations<dimensions, T>&).
+The memory is reused between calls, so once the storage is large enough for
+given group, drawing doesn't do any heap allocation. Keep one instance
+alive for the whole application lifetime, for example next to the camera:
+
+@code{.cpp}
+SceneGraph::DrawableTransformations3D transformations;
+
+// ...
+
+camera.draw(drawables, transformations);
+@endcode
+
+@see @ref DrawableTransformations2D, @ref DrawableTransformations3D
+*/
+template<UnsignedInt dimensions, class T> class DrawableTransformations {
+    public:
+        /** @brief Constructor */
+        explicit DrawableTransformations() = default;
+
+        /**
+         * @brief Reserve memory for given drawable count
+         *
+         * Useful to avoid the initial allocations on first draw.
+         */
+        void reserve(std::size_t size) {
+            _objects.reserve(size);
+            _transformations.reserve(size);
+            _visible.reserve(size);
+        }
+
+        /** @brief Count of drawables processed in last call */
+        std::size_t size() const { return _transformations.size(); }
+
+        /**
+         * @brief Transformations calculated in last call
+         *
+         * In the same order as drawables in the group, relative to the
+         * camera.
+         */
+        Containers::ArrayView<const MatrixTypeFor<dimensions, T>> transformations() const {
+            return {_transformations.data(), _transformations.size()};
+        }
+
+    private:
+        friend Camera<dimensions, T>;
+
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _objects;
+        std::vector<MatrixTypeFor<dimensions, T>> _transformations;
+        std::vector<UnsignedInt> _visible;
+};
+
+/**
+@brief Drawable transformation storage for two-dimensional float scenes
+
+@see @ref DrawableTransformations3D
+*/
+typedef DrawableTransformations<2, Float> DrawableTransformations2D;
+
+/**
+@brief Drawable transformation storage for three-dimensional float scenes
+
+@see @ref DrawableTransformations2D
+*/
+typedef DrawableTransformations<3, Float> DrawableTransformations3D;
+
+/**
+@brief Reusable storage for rigid drawable transformations
+
+Caller-owned storage for @ref Camera::drawRigid(), equivalent to
+@ref DrawableTransformations. The transformations are stored as dual
+quaternions in 3D and dual complex numbers in 2D. See
+@ref SceneGraph-Camera-rigid for more information.
+@see @ref RigidDrawableTransformations2D,
+    @ref RigidDrawableTransformations3D
+*/
+template<UnsignedInt dimensions, class T> class RigidDrawableTransformations {
+    public:
+        /**
+         * @brief Rigid transformation type
+         *
+         * @ref Magnum::Math::DualComplex "Math::DualComplex" in 2D,
+         * @ref Magnum::Math::DualQuaternion "Math::DualQuaternion" in 3D.
+         */
+        typedef typename Implementation::RigidTransformationTypeFor<dimensions, T>::Type TransformationType;
+
+        /** @brief Constructor */
+        explicit RigidDrawableTransformations() = default;
+
+        /**
+         * @brief Reserve memory for given drawable count
+         *
+         * Useful to avoid the initial allocations on first draw.
+         */
+        void reserve(std::size_t size) {
+            _objects.reserve(size);
+            _transformations.reserve(size);
+        }
+
+        /** @brief Count of drawables processed in last call */
+        std::size_t size() const { return _transformations.size(); }
+
+        /**
+         * @brief Transformations calculated in last call
+         *
+         * In the same order as drawables in the group, relative to the
+         * camera.
+         */
+        Containers::ArrayView<const TransformationType> transformations() const {
+            return {_transformations.data(), _transformations.size()};
+        }
+
+    private:
+        friend Camera<dimensions, T>;
+
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _objects;
+        std::vector<TransformationType> _transformations;
+};
+
+/**
+@brief Rigid drawable transformation storage for two-dimensional float scenes
+
+@see @ref RigidDrawableTransformations3D
+*/
+typedef RigidDrawableTransformations<2, Float> RigidDrawableTransformations2D;
+
+/**
+@brief Rigid drawable transformation storage for three-dimensional float scenes
+
+@see @ref RigidDrawableTransformations2D
+*/
+typedef RigidDrawableTransformations<3, Float> RigidDrawableTransformations3D;
+
 /**
 @brief Camera
 
@@ -71,6 +230,91 @@ Common setup example for 3D scenes:
 
 @snippet MagnumSceneGraph.cpp Camera-3D
 
+@section SceneGraph-Camera-depth-prepass Depth pre-pass
+
+To avoid shading fragments that get later overwritten, opaque geometry can be
+drawn in two passes. First, @ref drawDepth() sorts the drawables into a
+@ref DrawList and calls @ref Drawable::drawDepth() on each, which is expected
+to draw the mesh with a depth-only shader such as
+@ref Shaders::Phong::Flag::DepthOnly. Then @ref drawPrepared() calls
+@ref Drawable::draw() in the same order, without calculating the
+transformations or culling again. The scene graph doesn't touch any GPU state,
+switching the depth test to pass only fragments with equal depth in the
+shading pass is up to the application:
+
+@code{.cpp}
+camera.drawDepth(opaqueDrawables, opaque);
+
+GL::Renderer::setDepthFunction(GL::Renderer::DepthFunction::Equal);
+GL::Renderer::setDepthMask(false);
+camera.drawPrepared(opaqueDrawables, opaque);
+
+GL::Renderer::setDepthFunction(GL::Renderer::DepthFunction::Less);
+GL::Renderer::setDepthMask(true);
+camera.draw(transparentDrawables, transparent);
+@endcode
+
+@section SceneGraph-Camera-rigid Rigid transformations
+
+With @ref draw() the absolute transformation of every drawable gets converted
+to a matrix, even if the transformation implementation stores it in a more
+compact form. If the scene uses @ref DualQuaternionTransformation (or
+@ref DualComplexTransformation in 2D), @ref drawRigid() keeps the
+transformations as dual quaternions (or dual complex numbers) all the way
+from the hierarchy concatenation to @ref Drawable::drawRigid(), which then
+gets 8 floats instead of a 4x4 matrix. The transformation implementation has
+to be specified explicitly and both the camera and the drawables are expected
+to be attached to objects of that type:
+
+@code{.cpp}
+typedef SceneGraph::Object<SceneGraph::DualQuaternionTransformation> Object3D;
+
+SceneGraph::RigidDrawableTransformations3D transformations;
+
+// each frame
+camera.drawRigid<SceneGraph::DualQuaternionTransformation>(drawables, transformations);
+@endcode
+
+Drawables that don't override @ref Drawable::drawRigid() get the
+transformation converted to a matrix and passed to @ref Drawable::draw(), so
+both kinds can be mixed in a single group.
+
+@section SceneGraph-Camera-multiview Multi-view rendering
+
+Stereo rendering, cube map shadows or cascaded shadow maps draw the same
+scene from several views that share a common origin. Instead of drawing the
+scene once for each view with a separate camera, set the per-view matrices
+using @ref setViewProjectionMatrices(). Each of them maps from the space
+relative to the camera object to the clip space of one view, for example an
+eye offset combined with the eye projection. With @ref frustumCulling()
+enabled, a drawable is then drawn if it's visible in at least one of the
+views and the transformations are calculated only once. It's up to the
+drawable to render all views in a single draw call, for example by passing
+@ref viewProjectionMatrices() to a geometry shader that replicates the
+geometry into layers of a layered framebuffer, such as
+@ref Shaders::ShadowDepth::Flag::LayeredCascades:
+
+@code{.cpp}
+camera.setViewProjectionMatrices({
+    Matrix4::perspectiveProjection(35.0_degf, 1.0f, 0.01f, 100.0f)*
+        Matrix4::translation(Vector3::xAxis(+0.032f)),
+    Matrix4::perspectiveProjection(35.0_degf, 1.0f, 0.01f, 100.0f)*
+        Matrix4::translation(Vector3::xAxis(-0.032f))});
+
+// ...
+
+void draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) override {
+    _shader.setTransformationMatrix(transformationMatrix)
+        .setShadowMatrices(camera.viewProjectionMatrices());
+    _mesh.draw(_shader);
+}
+@endcode
+
+The @ref projectionMatrix() is still used by @ref projectedSize(),
+@ref lodFor() and for culling of @ref BoundingVolumeHierarchy nodes in
+@ref draw(BoundingVolumeHierarchy<dimensions, T>&), so it should be set to a
+projection that encloses all views.
+
 @section SceneGraph-Camera-explicit-specializations Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -149,6 +393,37 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         Camera<dimensions, T>& setProjectionMatrix(const MatrixTypeFor<dimensions, T>& matrix);
 
+        /**
+         * @brief View projection matrices
+         *
+         * Empty by default, in which case the scene is drawn for a single
+         * view given by @ref projectionMatrix(). See
+         * @ref SceneGraph-Camera-multiview for more information.
+         * @see @ref setViewProjectionMatrices()
+         */
+        Containers::ArrayView<const MatrixTypeFor<dimensions, T>> viewProjectionMatrices() const {
+            return {_viewProjectionMatrices.data(), _viewProjectionMatrices.size()};
+        }
+
+        /**
+         * @brief Set view projection matrices for multi-view rendering
+         * @return Reference to self (for method chaining)
+         *
+         * Each matrix transforms from the space relative to the camera object
+         * to the clip space of one view. If non-empty, @ref isVisible() and
+         * frustum culling in all draw functions test against the union of
+         * all views instead of @ref projectionMatrix(). The matrices are not
+         * affected by @ref aspectRatioPolicy(). Pass an empty view to go
+         * back to single-view rendering. See @ref SceneGraph-Camera-multiview
+         * for more information.
+         */
+        Camera<dimensions, T>& setViewProjectionMatrices(Containers::ArrayView<const MatrixTypeFor<dimensions, T>> matrices);
+
+        /** @overload */
+        Camera<dimensions, T>& setViewProjectionMatrices(std::initializer_list<MatrixTypeFor<dimensions, T>> matrices) {
+            return setViewProjectionMatrices({matrices.begin(), matrices.size()});
+        }
+
         /**
          * @brief Size of (near) XY plane in current projection
          *
@@ -186,24 +461,202 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         void setViewport(const Vector2i& size);
 
+        /**
+         * @brief Whether frustum culling is enabled
+         *
+         * @see @ref setFrustumCulling()
+         */
+        bool frustumCulling() const { return _frustumCulling; }
+
+        /**
+         * @brief Enable or disable frustum culling
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, @ref draw(DrawableGroup<dimensions, T>&) and
+         * @ref draw(DrawableGroup<dimensions, T>&, DrawableTransformations<dimensions, T>&)
+         * skip drawables which have a bounding volume set and it lies
+         * completely outside of the view frustum given by
+         * @ref projectionMatrix() or outside of all frustums given by
+         * @ref viewProjectionMatrices(), if set. The
+         * @ref drawableTransformations(DrawableGroup<dimensions, T>&) list
+         * then contains only the visible drawables as well. Drawables without
+         * a bounding volume are always drawn. Disabled by default. See
+         * @ref SceneGraph-Drawable-culling for more information.
+         */
+        Camera<dimensions, T>& setFrustumCulling(bool enabled) {
+            _frustumCulling = enabled;
+            return *this;
+        }
+
+        /**
+         * @brief Whether given drawable is visible
+         * @param drawable              Drawable to test
+         * @param transformationMatrix  Object transformation relative to
+         *      camera
+         *
+         * Returns @cpp true @ce if the drawable has no bounding volume or the
+         * bounding volume, transformed with @p transformationMatrix,
+         * intersects the frustum given by @ref projectionMatrix() or, if
+         * @ref viewProjectionMatrices() are set, at least one of the view
+         * frustums. The result doesn't depend on @ref frustumCulling(). The test is conservative,
+         * i.e. it may report some drawables as visible even though they
+         * aren't.
+         */
+        bool isVisible(const Drawable<dimensions, T>& drawable, const MatrixTypeFor<dimensions, T>& transformationMatrix) const;
+
+        /**
+         * @brief Projected size in pixels
+         * @param position  Position relative to camera
+         * @param size      Size at given position
+         *
+         * Returns size of a line segment of length @p size at @p position
+         * perpendicular to the view direction after projecting it with
+         * @ref projectionMatrix() and converting to pixels based on
+         * vertical @ref viewport() size. For orthographic projections the
+         * result doesn't depend on @p position. If @p position is in the
+         * camera plane or behind the camera, returns infinity.
+         * @see @ref lodFor()
+         */
+        T projectedSize(const VectorTypeFor<dimensions, T>& position, T size) const;
+
+        /**
+         * @brief Level of detail for given drawable
+         * @param drawable              Drawable to select the level for
+         * @param transformationMatrix  Object transformation relative to
+         *      camera
+         * @param errors                Errors of all levels in space local
+         *      to the object, expected to be monotonically increasing
+         * @param maxPixelError         Max allowed error in pixels
+         *
+         * Returns index of the coarsest level whose error, projected with
+         * @ref projectedSize() at center of the drawable bounding volume (or
+         * at object origin if the drawable doesn't have any), is not larger
+         * than @p maxPixelError. The errors are scaled by the largest axis
+         * scaling of @p transformationMatrix. Returns @cpp 0 @ce if no level
+         * fits or @p errors are empty. Errors produced by
+         * @ref MeshTools::generateLods() can be used directly, for large
+         * objects that span a big depth range it's better to split them into
+         * multiple drawables, as the error is evaluated at a single point.
+         */
+        std::size_t lodFor(const Drawable<dimensions, T>& drawable, const MatrixTypeFor<dimensions, T>& transformationMatrix, Containers::ArrayView<const T> errors, T maxPixelError) const;
+
         /**
          * @brief Drawable transformations
          *
          * Returns calculated transformations for given group of drawables.
-         * Useful in combination with @ref draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&)
+         * If @ref frustumCulling() is enabled, only drawables for which
+         * @ref isVisible() returns @cpp true @ce are included. Useful in
+         * combination with @ref draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&)
          * to provide custom draw order. See @ref SceneGraph-Drawable-draw-order
          * for more information.
          */
         std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> drawableTransformations(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Drawable transformations into existing storage
+         *
+         * Calculates transformations for given group of drawables and puts
+         * them into @p storage, in the same order as the drawables are in the
+         * group. Unlike @ref drawableTransformations(DrawableGroup<dimensions, T>&),
+         * this function doesn't allocate if @p storage is already large
+         * enough. Frustum culling is not applied here, so the
+         * transformations always correspond to drawables in the group.
+         * @see @ref DrawableTransformations::transformations()
+         */
+        void drawableTransformations(DrawableGroup<dimensions, T>& group, DrawableTransformations<dimensions, T>& storage);
+
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
-         * @see @ref draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&)
+         * Draws given group of drawables. If @ref ScratchArena::current() is
+         * set, the temporary object and transformation lists are allocated
+         * from it, otherwise from the heap.
+         * @see @ref draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&),
+         *      @ref Timeline::setFrameArena()
          */
         void draw(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Draw using existing storage
+         *
+         * Same as @ref draw(DrawableGroup<dimensions, T>&), but uses
+         * @p storage for all temporary data, so once the storage is large
+         * enough, drawing doesn't do any heap allocation. See
+         * @ref DrawableTransformations for more information.
+         */
+        void draw(DrawableGroup<dimensions, T>& group, DrawableTransformations<dimensions, T>& storage);
+
+        /**
+         * @brief Draw in parallel chunks
+         * @param group         Group to draw
+         * @param storage       Storage for temporary data
+         * @param chunkCount    Count of chunks to split the drawables into
+         * @param threadCount   Max count of threads to draw on, including
+         *      the calling thread
+         *
+         * Same as @ref draw(DrawableGroup<dimensions, T>&, DrawableTransformations<dimensions, T>&),
+         * but splits the visible drawables into @p chunkCount contiguous
+         * chunks and calls @ref Drawable::drawChunk() instead of
+         * @ref Drawable::draw(), distributing the chunks over at most
+         * @p threadCount worker threads of @ref globalJobExecutor(). No
+         * threads are spawned by the draw itself. Chunks may be empty if
+         * there's less drawables than chunks. Value of @cpp 0 @ce for
+         * @p threadCount is treated the same as @cpp 1 @ce. The function
+         * returns after all chunks are drawn. See
+         * @ref SceneGraph-Drawable-multithreading for more information.
+         */
+        void draw(DrawableGroup<dimensions, T>& group, DrawableTransformations<dimensions, T>& storage, UnsignedInt chunkCount, UnsignedInt threadCount);
+
+        /**
+         * @brief Draw with rigid transformations
+         * @tparam Transformation   Transformation implementation of the scene
+         *
+         * Same as @ref draw(DrawableGroup<dimensions, T>&, DrawableTransformations<dimensions, T>&),
+         * but the transformations are calculated as dual quaternions (dual
+         * complex numbers in 2D) without converting them to matrices and
+         * @ref Drawable::drawRigid() is called instead of
+         * @ref Drawable::draw(). Expects that the camera and all drawables
+         * in the group are attached to objects using @p Transformation,
+         * which has to be @ref DualQuaternionTransformation in 3D or
+         * @ref DualComplexTransformation in 2D. Frustum culling is applied
+         * the same way as in @ref draw(). See @ref SceneGraph-Camera-rigid
+         * for more information.
+         */
+        template<class Transformation> void drawRigid(DrawableGroup<dimensions, T>& group, RigidDrawableTransformations<dimensions, T>& storage);
+
+        /**
+         * @brief Draw in sorted order
+         *
+         * Same as @ref draw(DrawableGroup<dimensions, T>&, DrawableTransformations<dimensions, T>&),
+         * but draws the drawables in order given by @ref DrawList::order().
+         * See @ref DrawList for more information.
+         */
+        void draw(DrawableGroup<dimensions, T>& group, DrawList<dimensions, T>& list);
+
+        /**
+         * @brief Draw depth in sorted order
+         *
+         * Same as @ref draw(DrawableGroup<dimensions, T>&, DrawList<dimensions, T>&),
+         * but calls @ref Drawable::drawDepth() instead of
+         * @ref Drawable::draw(). Call @ref drawPrepared() with the same
+         * @p group and @p list afterwards to draw the shading pass. See
+         * @ref SceneGraph-Camera-depth-prepass for more information.
+         */
+        void drawDepth(DrawableGroup<dimensions, T>& group, DrawList<dimensions, T>& list);
+
+        /**
+         * @brief Draw a previously prepared list
+         *
+         * Calls @ref Drawable::draw() on drawables in @p list in the order
+         * and with transformations calculated by the last call to
+         * @ref drawDepth() or
+         * @ref draw(DrawableGroup<dimensions, T>&, DrawList<dimensions, T>&),
+         * without calculating them again. Expects that @p group wasn't
+         * changed since. See @ref SceneGraph-Camera-depth-prepass for more
+         * information.
+         */
+        void drawPrepared(DrawableGroup<dimensions, T>& group, DrawList<dimensions, T>& list);
+
         /**
          * @brief Draw given drawables with transformations
          *
@@ -213,6 +666,18 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         void draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& drawableTransformations);
 
+        /**
+         * @brief Draw visible drawables from a bounding volume hierarchy
+         *
+         * Refits the hierarchy and draws only the drawables that intersect
+         * the view frustum, independently of @ref frustumCulling(). Once
+         * the internal storage of @p hierarchy is large enough, drawing
+         * doesn't do any heap allocation. See @ref BoundingVolumeHierarchy
+         * for more information.
+         * @see @ref BoundingVolumeHierarchy::drawableTransformations()
+         */
+        void draw(BoundingVolumeHierarchy<dimensions, T>& hierarchy);
+
     private:
         /** Recalculates camera matrix */
         void cleanInverted(const MatrixTypeFor<dimensions, T>& invertedAbsoluteTransformationMatrix) override {
@@ -221,13 +686,28 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
 
         void fixAspectRatio();
 
+        /* Calculates transformations and sorted items of given list */
+        void prepareDrawList(DrawableGroup<dimensions, T>& group, DrawList<dimensions, T>& list);
+
+        Containers::ArrayView<const typename Implementation::ViewCullingVolume<dimensions, T>::Type> viewCulling() const {
+            return {_viewCulling.data(), _viewCulling.size()};
+        }
+
         MatrixTypeFor<dimensions, T> _rawProjectionMatrix;
         AspectRatioPolicy _aspectRatioPolicy;
 
         MatrixTypeFor<dimensions, T> _projectionMatrix;
+        /* Culling volume of _projectionMatrix, updated together with it so
+           the frustum isn't extracted again for each isVisible() call. It's
+           relative to the camera, so it doesn't depend on _cameraMatrix. */
+        typename Implementation::ViewCullingVolume<dimensions, T>::Type _projectionCulling;
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
+        std::vector<MatrixTypeFor<dimensions, T>> _viewProjectionMatrices;
+        std::vector<typename Implementation::ViewCullingVolume<dimensions, T>::Type> _viewCulling;
+
         Vector2i _viewport;
+        bool _frustumCulling;
 };
 
 /**
@@ -29,9 +29,20 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Camera.h
  */
 
+#include <new>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ScratchArena.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/SceneGraph/BoundingVolumeHierarchy.h"
+#include "Magnum/SceneGraph/DrawList.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/Scene.h"
 
 namespace Magnum { namespace SceneGraph {
 
@@ -53,16 +64,130 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
         Math::Vector2<T>(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
 }
 
+template<UnsignedInt dimensions, class T> struct DrawableCulling;
+
+/* In 2D there's no frustum, the box is transformed to clip space and tested
+   against the [-1; 1] square. With multiple views it's enough if it's visible
+   in any of them. */
+template<class T> struct DrawableCulling<2, T> {
+    explicit DrawableCulling(const Math::Matrix3<T>& projectionMatrix, Containers::ArrayView<const Math::Matrix3<T>> viewMatrices = {}): matrix{projectionMatrix}, viewMatrices{viewMatrices} {}
+
+    /* Box in the space before projection */
+    bool isBoxVisible(const Math::Range2D<T>& box) const {
+        if(viewMatrices.empty())
+            return isClipBoxVisible(transformedBoundingBox<2, T>(matrix, box));
+
+        for(const Math::Matrix3<T>& viewMatrix: viewMatrices)
+            if(isClipBoxVisible(transformedBoundingBox<2, T>(viewMatrix, box)))
+                return true;
+        return false;
+    }
+
+    bool isVisible(const Drawable<2, T>& drawable, const Math::Matrix3<T>& transformationMatrix) const {
+        if(drawable.boundingVolume() == DrawableBoundingVolume::None)
+            return true;
+
+        if(viewMatrices.empty())
+            return isClipBoxVisible(transformedBoundingBox<2, T>(matrix*transformationMatrix, drawable.boundingBox()));
+
+        for(const Math::Matrix3<T>& viewMatrix: viewMatrices)
+            if(isClipBoxVisible(transformedBoundingBox<2, T>(viewMatrix*transformationMatrix, drawable.boundingBox())))
+                return true;
+        return false;
+    }
+
+    bool isVisible(const Drawable<2, T>& drawable, const Math::DualComplex<T>& transformation) const {
+        if(drawable.boundingVolume() == DrawableBoundingVolume::None)
+            return true;
+
+        return isVisible(drawable, transformation.toMatrix());
+    }
+
+    static bool isClipBoxVisible(const Math::Range2D<T>& box) {
+        return (box.min() <= Math::Vector2<T>{T(1)}).all() &&
+               (box.max() >= Math::Vector2<T>{T(-1)}).all();
+    }
+
+    Math::Matrix3<T> matrix;
+    Containers::ArrayView<const Math::Matrix3<T>> viewMatrices;
+};
+
+/* In 3D the volume is tested against frustum planes extracted from the
+   projection matrix. The planes are not normalized, but neither of the
+   intersection functions needs that. With multiple views the frustums are
+   extracted already in Camera::setViewProjectionMatrices(), the camera
+   passes its own frustum extracted once the projection changes. */
+template<class T> struct DrawableCulling<3, T> {
+    explicit DrawableCulling(const Math::Matrix4<T>& projectionMatrix, Containers::ArrayView<const Math::Frustum<T>> viewFrustums = {}): frustum{Math::Frustum<T>::fromMatrix(projectionMatrix)}, viewFrustums{viewFrustums} {}
+
+    explicit DrawableCulling(const Math::Frustum<T>& frustum, Containers::ArrayView<const Math::Frustum<T>> viewFrustums = {}): frustum{frustum}, viewFrustums{viewFrustums} {}
+
+    /* Box in the space before projection */
+    bool isBoxVisible(const Math::Range3D<T>& box) const {
+        const Math::Vector3<T> center = box.center();
+        const Math::Vector3<T> extents = box.size()*T(0.5);
+        if(viewFrustums.empty())
+            return Math::Intersection::aabbFrustum(center, extents, frustum);
+
+        for(const Math::Frustum<T>& viewFrustum: viewFrustums)
+            if(Math::Intersection::aabbFrustum(center, extents, viewFrustum))
+                return true;
+        return false;
+    }
+
+    bool isSphereVisible(const Math::Vector3<T>& center, const T radius) const {
+        if(viewFrustums.empty())
+            return Math::Intersection::sphereFrustum(center, radius, frustum);
+
+        for(const Math::Frustum<T>& viewFrustum: viewFrustums)
+            if(Math::Intersection::sphereFrustum(center, radius, viewFrustum))
+                return true;
+        return false;
+    }
+
+    bool isVisible(const Drawable<3, T>& drawable, const Math::Matrix4<T>& transformationMatrix) const {
+        if(drawable.boundingVolume() == DrawableBoundingVolume::None)
+            return true;
+
+        /* Scale the radius by the largest axis scaling to stay conservative
+           for non-uniformly scaled objects */
+        if(drawable.boundingVolume() == DrawableBoundingVolume::Sphere)
+            return isSphereVisible(
+                transformationMatrix.transformPoint(drawable.boundingSphereCenter()),
+                drawable.boundingSphereRadius()*std::sqrt(transformationMatrix.scalingSquared().max()));
+
+        return isBoxVisible(transformedBoundingBox<3, T>(transformationMatrix, drawable.boundingBox()));
+    }
+
+    /* Rigid transformation doesn't scale, so the sphere radius can be used
+       directly. Boxes need the rotation matrix anyway. */
+    bool isVisible(const Drawable<3, T>& drawable, const Math::DualQuaternion<T>& transformation) const {
+        if(drawable.boundingVolume() == DrawableBoundingVolume::None)
+            return true;
+
+        if(drawable.boundingVolume() == DrawableBoundingVolume::Sphere)
+            return isSphereVisible(
+                transformation.transformPointNormalized(drawable.boundingSphereCenter()),
+                drawable.boundingSphereRadius());
+
+        return isVisible(drawable, transformation.toMatrix());
+    }
+
+    Math::Frustum<T> frustum;
+    Containers::ArrayView<const Math::Frustum<T>> viewFrustums;
+};
 }
 
-template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
+template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved), _frustumCulling{false} {
     AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::InvertedAbsolute);
+    _projectionCulling = Implementation::ViewCullingVolume<dimensions, T>::from(_projectionMatrix);
 }
 
 template<UnsignedInt dimensions, class T> Camera<dimensions, T>::~Camera() = default;
 
 template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::fixAspectRatio() {
     _projectionMatrix = Implementation::aspectRatioFix<dimensions, T>(_aspectRatioPolicy, {Math::abs(_rawProjectionMatrix[0].x()), Math::abs(_rawProjectionMatrix[1].y())}, _viewport)*_rawProjectionMatrix;
+    _projectionCulling = Implementation::ViewCullingVolume<dimensions, T>::from(_projectionMatrix);
 }
 
 template<UnsignedInt dimensions, class T> Camera<dimensions, T>& Camera<dimensions, T>::setAspectRatioPolicy(AspectRatioPolicy policy) {
@@ -77,11 +202,47 @@ template<UnsignedInt dimensions, class T> Camera<dimensions, T>& Camera<dimensio
     return *this;
 }
 
+template<UnsignedInt dimensions, class T> Camera<dimensions, T>& Camera<dimensions, T>::setViewProjectionMatrices(const Containers::ArrayView<const MatrixTypeFor<dimensions, T>> matrices) {
+    _viewProjectionMatrices.assign(matrices.begin(), matrices.end());
+    _viewCulling.clear();
+    _viewCulling.reserve(matrices.size());
+    for(const MatrixTypeFor<dimensions, T>& matrix: matrices)
+        _viewCulling.push_back(Implementation::ViewCullingVolume<dimensions, T>::from(matrix));
+    return *this;
+}
+
 template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::setViewport(const Vector2i& size) {
     _viewport = size;
     fixAspectRatio();
 }
 
+template<UnsignedInt dimensions, class T> bool Camera<dimensions, T>::isVisible(const Drawable<dimensions, T>& drawable, const MatrixTypeFor<dimensions, T>& transformationMatrix) const {
+    return Implementation::DrawableCulling<dimensions, T>{_projectionCulling, viewCulling()}.isVisible(drawable, transformationMatrix);
+}
+
+template<UnsignedInt dimensions, class T> T Camera<dimensions, T>::projectedSize(const VectorTypeFor<dimensions, T>& position, const T size) const {
+    /* W coordinate of the projected position, i.e. distance from the camera
+       for perspective projection and 1 for orthographic */
+    T w = _projectionMatrix[dimensions][dimensions];
+    for(std::size_t i = 0; i != dimensions; ++i)
+        w += _projectionMatrix[i][dimensions]*position[i];
+    if(w <= T(0)) return Math::Constants<T>::inf();
+
+    return size*Math::abs(_projectionMatrix[1].y())*T(_viewport.y())/(T(2)*w);
+}
+
+template<UnsignedInt dimensions, class T> std::size_t Camera<dimensions, T>::lodFor(const Drawable<dimensions, T>& drawable, const MatrixTypeFor<dimensions, T>& transformationMatrix, const Containers::ArrayView<const T> errors, const T maxPixelError) const {
+    const VectorTypeFor<dimensions, T> center = drawable.boundingVolume() == DrawableBoundingVolume::None ?
+        VectorTypeFor<dimensions, T>{} : drawable.boundingSphereCenter();
+    const T pixelsPerUnit = projectedSize(transformationMatrix.transformPoint(center),
+        std::sqrt(transformationMatrix.scalingSquared().max()));
+
+    std::size_t lod = 0;
+    for(std::size_t i = 1; i < errors.size() && errors[i]*pixelsPerUnit <= maxPixelError; ++i)
+        lod = i;
+    return lod;
+}
+
 template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> Camera<dimensions, T>::drawableTransformations(DrawableGroup<dimensions, T>& group) {
     AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
     CORRADE_ASSERT(scene, "Camera::draw(): cannot draw when camera is not part of any scene", {});
@@ -98,32 +259,190 @@ template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_w
         scene->transformationMatrices(objects, _cameraMatrix);
 
     /* Combine drawable references and transformation matrices */
+    const Implementation::DrawableCulling<dimensions, T> culling{_projectionCulling, viewCulling()};
     std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> combined;
     combined.reserve(group.size());
-    for(std::size_t i = 0; i != group.size(); ++i)
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        if(_frustumCulling && !culling.isVisible(group[i], transformations[i]))
+            continue;
         combined.emplace_back(group[i], transformations[i]);
+    }
 
     return combined;
 }
 
-template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawableTransformations(DrawableGroup<dimensions, T>& group, DrawableTransformations<dimensions, T>& storage) {
+    storage._transformations.clear();
+
     AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
     CORRADE_ASSERT(scene, "Camera::draw(): cannot draw when camera is not part of any scene", );
 
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
+    /* Compute transformations of all objects in the group relative to the
+       camera, reusing the storage memory */
+    storage._objects.clear();
     for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+        storage._objects.push_back(group[i].object());
+    scene->transformationMatrices(storage._objects, storage._transformations, _cameraMatrix);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
+    AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
+    CORRADE_ASSERT(scene, "Camera::draw(): cannot draw when camera is not part of any scene", );
+
+    /* Compute camera matrix */
+    AbstractFeature<dimensions, T>::object().setClean();
+
+    /* Compute transformations of all objects in the group relative to the
+       camera. If there's a current scratch arena, take the temporaries from
+       it, otherwise from the heap. */
+    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objectStorage;
+    std::vector<MatrixTypeFor<dimensions, T>> transformationStorage;
+    Containers::ArrayView<MatrixTypeFor<dimensions, T>> transformations;
+    if(ScratchArena* const arena = ScratchArena::current()) {
+        const Containers::ArrayView<std::reference_wrapper<AbstractObject<dimensions, T>>> objects = arena->allocate<std::reference_wrapper<AbstractObject<dimensions, T>>>(group.size());
+        for(std::size_t i = 0; i != group.size(); ++i)
+            new(&objects[i]) std::reference_wrapper<AbstractObject<dimensions, T>>{group[i].object()};
+        transformations = arena->allocate<MatrixTypeFor<dimensions, T>>(group.size());
+        scene->transformationMatrices(objects, transformations, _cameraMatrix);
+    } else {
+        objectStorage.reserve(group.size());
+        for(std::size_t i = 0; i != group.size(); ++i)
+            objectStorage.push_back(group[i].object());
+        transformationStorage = scene->transformationMatrices(objectStorage, _cameraMatrix);
+        transformations = {transformationStorage.data(), transformationStorage.size()};
+    }
 
     /* Perform the drawing */
-    for(std::size_t i = 0; i != transformations.size(); ++i)
+    const Implementation::DrawableCulling<dimensions, T> culling{_projectionCulling, viewCulling()};
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        if(_frustumCulling && !culling.isVisible(group[i], transformations[i]))
+            continue;
         group[i].draw(transformations[i], *this);
+    }
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group, DrawableTransformations<dimensions, T>& storage) {
+    drawableTransformations(group, storage);
+
+    /* Perform the drawing */
+    const Implementation::DrawableCulling<dimensions, T> culling{_projectionCulling, viewCulling()};
+    for(std::size_t i = 0; i != storage._transformations.size(); ++i) {
+        if(_frustumCulling && !culling.isVisible(group[i], storage._transformations[i]))
+            continue;
+        group[i].draw(storage._transformations[i], *this);
+    }
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group, DrawableTransformations<dimensions, T>& storage, const UnsignedInt chunkCount, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(chunkCount, "Camera::draw(): expected non-zero chunk count", );
+
+    drawableTransformations(group, storage);
+
+    /* Gather the visible drawables first so the chunks are balanced */
+    const Implementation::DrawableCulling<dimensions, T> culling{_projectionCulling, viewCulling()};
+    storage._visible.clear();
+    for(std::size_t i = 0; i != storage._transformations.size(); ++i) {
+        if(_frustumCulling && !culling.isVisible(group[i], storage._transformations[i]))
+            continue;
+        storage._visible.push_back(UnsignedInt(i));
+    }
+
+    /* Each task draws one contiguous chunk of the visible drawables */
+    const std::size_t count = storage._visible.size();
+    auto drawChunk = [this, &group, &storage, chunkCount, count](const UnsignedInt chunk) {
+        for(std::size_t i = chunk*count/chunkCount, end = (chunk + 1)*count/chunkCount; i != end; ++i) {
+            const UnsignedInt index = storage._visible[i];
+            group[index].drawChunk(storage._transformations[index], *this, chunk);
+        }
+    };
+
+    Magnum::Implementation::parallelFor(threadCount, chunkCount, [&drawChunk](const std::size_t chunk) {
+        drawChunk(UnsignedInt(chunk));
+    });
+}
+
+template<UnsignedInt dimensions, class T> template<class Transformation> void Camera<dimensions, T>::drawRigid(DrawableGroup<dimensions, T>& group, RigidDrawableTransformations<dimensions, T>& storage) {
+    static_assert(std::is_same<typename Transformation::DataType, typename RigidDrawableTransformations<dimensions, T>::TransformationType>::value,
+        "the transformation has to be stored as a dual quaternion or a dual complex number");
+
+    storage._transformations.clear();
+
+    /** @todo Ensure this doesn't crash, somehow */
+    const Object<Transformation>& object = static_cast<const Object<Transformation>&>(AbstractFeature<dimensions, T>::object());
+    const Scene<Transformation>* scene = object.scene();
+    CORRADE_ASSERT(scene, "Camera::drawRigid(): cannot draw when camera is not part of any scene", );
+
+    /* Compute transformations of all objects in the group relative to the
+       camera, reusing the storage memory. The camera is rigid as well, so
+       its inverse is just a conjugate. */
+    storage._objects.clear();
+    for(std::size_t i = 0; i != group.size(); ++i)
+        storage._objects.push_back(group[i].object());
+    storage._transformations.resize(group.size());
+    scene->transformations(
+        {storage._objects.data(), storage._objects.size()},
+        {storage._transformations.data(), storage._transformations.size()},
+        object.absoluteTransformation().invertedNormalized());
+
+    /* Perform the drawing */
+    const Implementation::DrawableCulling<dimensions, T> culling{_projectionCulling, viewCulling()};
+    for(std::size_t i = 0; i != storage._transformations.size(); ++i) {
+        if(_frustumCulling && !culling.isVisible(group[i], storage._transformations[i]))
+            continue;
+        group[i].drawRigid(storage._transformations[i], *this);
+    }
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::prepareDrawList(DrawableGroup<dimensions, T>& group, DrawList<dimensions, T>& list) {
+    drawableTransformations(group, list._transformations);
+    const std::vector<MatrixTypeFor<dimensions, T>>& transformations = list._transformations._transformations;
+
+    /* Calculate sort keys of all visible drawables */
+    const Implementation::DrawableCulling<dimensions, T> culling{_projectionCulling, viewCulling()};
+    list._items.clear();
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        if(_frustumCulling && !culling.isVisible(group[i], transformations[i]))
+            continue;
+
+        std::uint64_t key = 0;
+        if(list._order == DrawOrder::State)
+            key = std::uint64_t(group[i].stateKey()) << 32 | Implementation::drawableDepth(group[i], transformations[i]);
+        else if(list._order == DrawOrder::BackToFront)
+            key = std::uint64_t(~Implementation::drawableDepth(group[i], transformations[i])) << 32 | group[i].stateKey();
+
+        list._items.push_back({key, UnsignedInt(i)});
+    }
+
+    if(list._order == DrawOrder::Unsorted) return;
+
+    if(list._temporalCoherence)
+        Implementation::coherentSort(list._items, list._ranks, transformations.size(), list._scratch);
+    else Implementation::radixSort(list._items, list._scratch);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group, DrawList<dimensions, T>& list) {
+    prepareDrawList(group, list);
+    drawPrepared(group, list);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawDepth(DrawableGroup<dimensions, T>& group, DrawList<dimensions, T>& list) {
+    prepareDrawList(group, list);
+
+    const std::vector<MatrixTypeFor<dimensions, T>>& transformations = list._transformations._transformations;
+    for(const Implementation::DrawListItem& item: list._items)
+        group[item.index].drawDepth(transformations[item.index], *this);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawPrepared(DrawableGroup<dimensions, T>& group, DrawList<dimensions, T>& list) {
+    const std::vector<MatrixTypeFor<dimensions, T>>& transformations = list._transformations._transformations;
+    CORRADE_ASSERT(transformations.size() == group.size(),
+        "SceneGraph::Camera::drawPrepared(): the list was prepared for" << transformations.size() << "drawables but the group has" << group.size(), );
+
+    for(const Implementation::DrawListItem& item: list._items)
+        group[item.index].draw(transformations[item.index], *this);
 }
 
 template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& drawableTransformations) {
@@ -131,6 +450,11 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(const
         drawableTransformation.first.get().draw(drawableTransformation.second, *this);
 }
 
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(BoundingVolumeHierarchy<dimensions, T>& hierarchy) {
+    hierarchy.drawableTransformations(*this, hierarchy._drawableTransformations);
+    draw(hierarchy._drawableTransformations);
+}
+
 }}
 
 #endif
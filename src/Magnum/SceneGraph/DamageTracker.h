@@ -0,0 +1,216 @@
+#ifndef Magnum_SceneGraph_DamageTracker_h
+#define Magnum_SceneGraph_DamageTracker_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicDamageTracker2D, typedef @ref Magnum::SceneGraph::DamageTracker2D
+ */
+
+#include <vector>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Damage tracker for two-dimensional scenes
+
+Tracks screen-space rectangles covered by drawables in a group, allowing 2D
+UIs to redraw only the parts of the screen that changed since the previous
+frame instead of the whole framebuffer.
+
+@section SceneGraph-DamageTracker-usage Usage
+
+Every frame, call @ref update() with the camera and the drawable group. It
+calculates the pixel rectangle of each drawable from its bounding box (see
+@ref SceneGraph-Drawable-culling), camera-relative transformation,
+@ref Camera::projectionMatrix() and @ref Camera::viewport() and returns
+a union of the old and new rectangles of all drawables that were added,
+removed, moved or whose bounding volume changed. If the returned rectangle is
+empty, nothing needs to be redrawn. Otherwise restrict rendering to it using
+a scissor test and call @ref draw(), which draws only the drawables that
+intersect the damaged area:
+
+@code{.cpp}
+SceneGraph::DamageTracker2D damageTracker;
+
+// each frame
+Range2Di damage = damageTracker.update(camera, drawables);
+if(damage.size().isZero()) return;
+
+GL::Renderer::enable(GL::Renderer::Feature::ScissorTest);
+GL::Renderer::setScissor(damage);
+GL::defaultFramebuffer.clear(GL::FramebufferClear::Color);
+damageTracker.draw(camera, drawables);
+GL::Renderer::disable(GL::Renderer::Feature::ScissorTest);
+
+swapBuffers();
+@endcode
+
+The scene graph itself doesn't touch any GPU state, so setting up the scissor
+is up to the application. The clear is affected by the scissor test as well,
+so only the damaged area is cleared.
+
+@section SceneGraph-DamageTracker-content Content changes
+
+The tracker can't know when the drawable contents change without any change
+in its transformation or bounding volume --- for example when a label text is
+updated. Call @ref addDamage(Drawable<2, T>&) in that case, or
+@ref addDamage(const Range2Di&) to damage an arbitrary rectangle. Drawables
+without a bounding volume cover the whole viewport, so a change in their
+transformation damages everything. Changes in @ref Camera::viewport() or
+@ref Camera::projectionMatrix() damage the whole viewport as well; use
+@ref damageAll() to redraw everything explicitly, for example after the
+framebuffer contents got lost.
+
+Drawables are matched to the previous frame by their position in the group.
+Removing a drawable from the middle of the group thus conservatively damages
+all drawables after it.
+
+@section SceneGraph-DamageTracker-preserve Preserving framebuffer contents
+
+Drawing only the damaged part requires the rest of the framebuffer to stay
+untouched since the previous frame. This is always the case when rendering
+into a @ref GL::Framebuffer that gets blitted to the screen. With the default
+framebuffer, the contents of the back buffer after a swap are undefined unless
+the windowing system is asked to preserve them --- with @ref Platform::AndroidApplication
+enable @ref Platform::AndroidApplication::GLConfiguration::setSwapBehaviorPreserved()
+and pass the damaged rectangle to @ref Platform::AndroidApplication::swapBuffers(const Range2Di&),
+which additionally tells the compositor which part of the window changed
+using @m_class{m-doc-external} [EGL_KHR_swap_buffers_with_damage](https://www.khronos.org/registry/EGL/extensions/KHR/EGL_KHR_swap_buffers_with_damage.txt)
+if available.
+
+Once the internal storage is large enough for given group, neither
+@ref update() nor @ref draw() does any heap allocation.
+@see @ref DamageTracker2D
+*/
+template<class T> class BasicDamageTracker2D {
+    public:
+        /** @brief Constructor */
+        explicit BasicDamageTracker2D(): _drawnCount{}, _damageAll{true} {}
+
+        /**
+         * @brief Damaged rectangle calculated in last @ref update() call
+         *
+         * In pixels, with origin in the bottom left corner of the viewport.
+         * Zero-size if nothing was damaged.
+         */
+        Range2Di damage() const { return _damage; }
+
+        /** @brief Count of drawables drawn in last @ref draw() call */
+        std::size_t drawnCount() const { return _drawnCount; }
+
+        /**
+         * @brief Damage given rectangle
+         * @return Reference to self (for method chaining)
+         *
+         * The @p rectangle is in pixels, with origin in the bottom left
+         * corner of the viewport. It gets included in the result of next
+         * @ref update() call.
+         */
+        BasicDamageTracker2D<T>& addDamage(const Range2Di& rectangle);
+
+        /**
+         * @brief Damage given drawable
+         * @return Reference to self (for method chaining)
+         *
+         * Marks the rectangle covered by @p drawable in the previous and the
+         * current frame as damaged in next @ref update() call. Use when the
+         * drawable contents change without any change in its transformation
+         * or bounding volume.
+         */
+        BasicDamageTracker2D<T>& addDamage(Drawable<2, T>& drawable);
+
+        /**
+         * @brief Damage the whole viewport
+         * @return Reference to self (for method chaining)
+         *
+         * Next @ref update() call returns the whole viewport. Done implicitly
+         * on the first @ref update().
+         */
+        BasicDamageTracker2D<T>& damageAll() {
+            _damageAll = true;
+            return *this;
+        }
+
+        /**
+         * @brief Update the damage
+         * @return Damaged rectangle in pixels
+         *
+         * Calculates the rectangles of all drawables in @p group and returns
+         * the union of the changed ones, clamped to @ref Camera::viewport().
+         * The result is also available through @ref damage(). The damage
+         * added using @ref addDamage() or @ref damageAll() is reset after.
+         * See @ref SceneGraph-DamageTracker-usage for more information.
+         */
+        Range2Di update(Camera<2, T>& camera, DrawableGroup<2, T>& group);
+
+        /**
+         * @brief Draw damaged drawables
+         *
+         * Calls @ref Drawable::draw() on drawables in @p group that intersect
+         * the @ref damage() calculated by the last @ref update() call, with
+         * transformations calculated by it. Does nothing if the damage is
+         * empty. Expects that @p group wasn't changed since the last
+         * @ref update() call.
+         */
+        void draw(Camera<2, T>& camera, DrawableGroup<2, T>& group);
+
+    private:
+        struct Item {
+            Drawable<2, T>* drawable;
+            Range2Di rectangle;
+            Math::Matrix3<T> transformation;
+        };
+
+        Range2Di _damage, _addedDamage;
+        DrawableTransformations<2, T> _transformations;
+        std::vector<Item> _items;
+        std::vector<Drawable<2, T>*> _damagedDrawables;
+        Math::Matrix3<T> _projectionMatrix;
+        Vector2i _viewport;
+        std::size_t _drawnCount;
+        bool _damageAll;
+};
+
+/**
+@brief Damage tracker for two-dimensional float scenes
+
+@see @ref BasicDamageTracker2D
+*/
+typedef BasicDamageTracker2D<Float> DamageTracker2D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicDamageTracker2D<Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef Magnum_SceneGraph_DamageTracker_hpp
+#define Magnum_SceneGraph_DamageTracker_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref DamageTracker.h
+ */
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/Camera.hpp"
+#include "Magnum/SceneGraph/DamageTracker.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+/* Pixel rectangle covered by a box transformed with given matrix, clamped to
+   the viewport. Zero-size if outside of it. */
+template<class T> Range2Di damageRectangle(const Math::Matrix3<T>& matrix, const Math::Range2D<T>& box, const Vector2i& viewport) {
+    const Math::Range2D<T> clipBox = transformedBoundingBox<2, T>(matrix, box);
+    const Math::Vector2<T> halfViewport = Math::Vector2<T>{viewport}*T(0.5);
+    const Range2Di rectangle = Math::intersect(Range2Di{
+        Vector2i{Math::floor((clipBox.min() + Math::Vector2<T>{T(1)})*halfViewport)},
+        Vector2i{Math::ceil((clipBox.max() + Math::Vector2<T>{T(1)})*halfViewport)}},
+        Range2Di{{}, viewport});
+
+    /* Math::join() treats only ranges with min equal to max as empty */
+    return (rectangle.max() > rectangle.min()).all() ? rectangle : Range2Di{};
+}
+
+}
+
+template<class T> BasicDamageTracker2D<T>& BasicDamageTracker2D<T>::addDamage(const Range2Di& rectangle) {
+    if((rectangle.max() > rectangle.min()).all())
+        _addedDamage = Math::join(_addedDamage, rectangle);
+    return *this;
+}
+
+template<class T> BasicDamageTracker2D<T>& BasicDamageTracker2D<T>::addDamage(Drawable<2, T>& drawable) {
+    _damagedDrawables.push_back(&drawable);
+    return *this;
+}
+
+template<class T> Range2Di BasicDamageTracker2D<T>::update(Camera<2, T>& camera, DrawableGroup<2, T>& group) {
+    camera.drawableTransformations(group, _transformations);
+    const Containers::ArrayView<const Math::Matrix3<T>> transformations = _transformations.transformations();
+
+    const Vector2i viewport = camera.viewport();
+    const Math::Matrix3<T> projectionMatrix = camera.projectionMatrix();
+    const Range2Di viewportRectangle{{}, viewport};
+    if(viewport != _viewport || projectionMatrix != _projectionMatrix) {
+        _viewport = viewport;
+        _projectionMatrix = projectionMatrix;
+        _damageAll = true;
+    }
+
+    Range2Di damage = _addedDamage;
+
+    /* Drawables that were removed from the end of the group damage their
+       previous rectangle */
+    for(std::size_t i = group.size(); i < _items.size(); ++i)
+        damage = Math::join(damage, _items[i].rectangle);
+    _items.resize(group.size(), Item{nullptr, {}, {}});
+
+    /* Sorted so the lookup is logarithmic */
+    std::sort(_damagedDrawables.begin(), _damagedDrawables.end());
+
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        Drawable<2, T>& drawable = group[i];
+        const Range2Di rectangle = drawable.boundingVolume() == DrawableBoundingVolume::None ? viewportRectangle :
+            Implementation::damageRectangle<T>(projectionMatrix*transformations[i], drawable.boundingBox(), viewport);
+
+        /* A drawable that's new at this position, moved, changed its bounding
+           volume or was explicitly damaged damages both its old and new
+           rectangle */
+        Item& item = _items[i];
+        if(item.drawable != &drawable || item.transformation != transformations[i] || item.rectangle != rectangle || std::binary_search(_damagedDrawables.begin(), _damagedDrawables.end(), &drawable))
+            damage = Math::join(damage, Math::join(item.rectangle, rectangle));
+
+        item.drawable = &drawable;
+        item.rectangle = rectangle;
+        item.transformation = transformations[i];
+    }
+
+    if(_damageAll) damage = viewportRectangle;
+    else damage = Math::intersect(damage, viewportRectangle);
+
+    _damage = damage;
+    _addedDamage = {};
+    _damagedDrawables.clear();
+    _damageAll = false;
+    return damage;
+}
+
+template<class T> void BasicDamageTracker2D<T>::draw(Camera<2, T>& camera, DrawableGroup<2, T>& group) {
+    CORRADE_ASSERT(_items.size() == group.size(),
+        "SceneGraph::DamageTracker::draw(): the damage was calculated for" << _items.size() << "drawables but the group has" << group.size(), );
+
+    _drawnCount = 0;
+    if(!(_damage.max() > _damage.min()).all()) return;
+
+    const Containers::ArrayView<const Math::Matrix3<T>> transformations = _transformations.transformations();
+    for(std::size_t i = 0; i != _items.size(); ++i) {
+        if(!Math::intersects(_items[i].rectangle, _damage)) continue;
+
+        group[i].draw(transformations[i], camera);
+        ++_drawnCount;
+    }
+}
+
+}}
+
+#endif
@@ -0,0 +1,148 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DrawList.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace SceneGraph {
+
+Debug& operator<<(Debug& debug, DrawOrder value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case DrawOrder::value: return debug << "SceneGraph::DrawOrder::" #value;
+        _c(Unsorted)
+        _c(State)
+        _c(BackToFront)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "SceneGraph::DrawOrder(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+namespace Implementation {
+
+void radixSort(std::vector<DrawListItem>& items, std::vector<DrawListItem>& scratch) {
+    const std::size_t size = items.size();
+    if(size < 2) return;
+
+    /* Calculate histograms for all eight digits in a single pass */
+    std::size_t histograms[8][256]{};
+    for(const DrawListItem& item: items)
+        for(std::size_t digit = 0; digit != 8; ++digit)
+            ++histograms[digit][(item.key >> digit*8) & 0xff];
+
+    scratch.resize(size);
+    for(std::size_t digit = 0; digit != 8; ++digit) {
+        std::size_t* const histogram = histograms[digit];
+
+        /* All keys have the same value of this digit, nothing to do. This is
+           very common for the upper bits of the state key. */
+        if(histogram[(items[0].key >> digit*8) & 0xff] == size) continue;
+
+        /* Convert counts to offsets */
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != 256; ++i) {
+            const std::size_t count = histogram[i];
+            histogram[i] = offset;
+            offset += count;
+        }
+
+        for(const DrawListItem& item: items)
+            scratch[histogram[(item.key >> digit*8) & 0xff]++] = item;
+
+        /* Swapping keeps the capacity of both */
+        std::swap(items, scratch);
+    }
+}
+
+bool coherentSort(std::vector<DrawListItem>& items, std::vector<UnsignedInt>& ranks, const std::size_t drawableCount, std::vector<DrawListItem>& scratch) {
+    constexpr UnsignedInt NotDrawn = ~UnsignedInt{};
+    const std::size_t size = items.size();
+
+    /* The group changed since the last call, the ranks are useless */
+    bool coherent = ranks.size() == drawableCount;
+    if(coherent) {
+        /* Put the items that were drawn last time to their previous
+           position, leaving holes after drawables that got culled. Newly
+           visible items are compacted to the front, in the order of the
+           group. */
+        scratch.assign(drawableCount, DrawListItem{0, NotDrawn});
+        std::size_t newCount = 0;
+        for(std::size_t i = 0; i != size; ++i) {
+            const UnsignedInt rank = ranks[items[i].index];
+            if(rank == NotDrawn) items[newCount++] = items[i];
+            else scratch[rank] = items[i];
+        }
+
+        /* Move the new items to the end, put the previous ones before */
+        std::copy_backward(items.begin(), items.begin() + newCount, items.end());
+        std::size_t out = 0;
+        for(const DrawListItem& item: scratch)
+            if(item.index != NotDrawn) items[out++] = item;
+
+        /* Insertion sort, giving up if it gets worse than the radix sort.
+           Equal keys are never swapped, so they keep the previous order. */
+        std::size_t budget = 4*size;
+        for(std::size_t i = 1; i < size && coherent; ++i) {
+            const DrawListItem item = items[i];
+            std::size_t j = i;
+            for(; j && items[j - 1].key > item.key; --j) {
+                if(!budget--) {
+                    coherent = false;
+                    break;
+                }
+                items[j] = items[j - 1];
+            }
+            items[j] = item;
+        }
+    }
+
+    if(!coherent) radixSort(items, scratch);
+
+    /* Remember the order for the next call */
+    ranks.assign(drawableCount, NotDrawn);
+    for(std::size_t i = 0; i != size; ++i)
+        ranks[items[i].index] = UnsignedInt(i);
+
+    return coherent;
+}
+
+UnsignedInt sortableDepth(const Float depth) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &depth, sizeof(Float));
+
+    /* Negative floats have reversed order, flip all bits of those. For
+       positive floats flip the sign bit so they end up after all negative. */
+    return bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+}
+
+}
+
+}}
@@ -0,0 +1,277 @@
+#ifndef Magnum_SceneGraph_DrawList_h
+#define Magnum_SceneGraph_DrawList_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::DrawList, enum @ref Magnum::SceneGraph::DrawOrder, function @ref Magnum::SceneGraph::drawStateKey(), typedef @ref Magnum::SceneGraph::DrawList2D, @ref Magnum::SceneGraph::DrawList3D
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Draw order
+
+@see @ref DrawList::setOrder()
+*/
+enum class DrawOrder: UnsignedByte {
+    /** Drawables are drawn in the order they are in the group */
+    Unsorted,
+
+    /**
+     * Drawables are sorted by @ref Drawable::stateKey() first and then front
+     * to back, to minimize state changes and overdraw. Suitable for opaque
+     * geometry. This is the default.
+     */
+    State,
+
+    /**
+     * Drawables are sorted back to front first and then by
+     * @ref Drawable::stateKey(). Suitable for transparent geometry.
+     */
+    BackToFront
+};
+
+/** @debugoperatorenum{DrawOrder} */
+MAGNUM_SCENEGRAPH_EXPORT Debug& operator<<(Debug& debug, DrawOrder value);
+
+/**
+@brief Compose a drawable state key
+@param shader       Shader ID
+@param material     Material ID
+@param mesh         Mesh ID
+
+Puts the lower 8 bits of @p shader to the upper 8 bits of the result,
+followed by the lower 12 bits of @p material and the lower 12 bits of
+@p mesh, so sorting by the key groups the drawables first by shader, then by
+material and then by mesh. If your application needs a different
+distribution of bits, compose the key manually.
+@see @ref Drawable::setStateKey()
+*/
+constexpr UnsignedInt drawStateKey(UnsignedInt shader, UnsignedInt material, UnsignedInt mesh) {
+    return (shader & 0xff) << 24 | (material & 0xfff) << 12 | (mesh & 0xfff);
+}
+
+namespace Implementation {
+    struct DrawListItem {
+        std::uint64_t key;
+        UnsignedInt index;
+    };
+
+    /* Stable LSD radix sort of the items by key, scratch is used as
+       temporary storage */
+    MAGNUM_SCENEGRAPH_EXPORT void radixSort(std::vector<DrawListItem>& items, std::vector<DrawListItem>& scratch);
+
+    /* Puts the items into the order from the previous call given by ranks
+       (newly visible items go last) and fixes it with an insertion sort,
+       falling back to the radix sort if too many items moved. The ranks
+       are then updated for the next call. Returns false if the ranks were
+       not usable or the fallback was taken. */
+    MAGNUM_SCENEGRAPH_EXPORT bool coherentSort(std::vector<DrawListItem>& items, std::vector<UnsignedInt>& ranks, std::size_t drawableCount, std::vector<DrawListItem>& scratch);
+
+    /* Maps a float to an unsigned integer with the same ordering */
+    MAGNUM_SCENEGRAPH_EXPORT UnsignedInt sortableDepth(Float depth);
+
+    /* There's no depth in 2D */
+    template<class T> inline UnsignedInt drawableDepth(const Drawable<2, T>&, const Math::Matrix3<T>&) {
+        return 0;
+    }
+
+    /* Distance along the view direction, taken from center of the bounding
+       volume if there's any */
+    template<class T> inline UnsignedInt drawableDepth(const Drawable<3, T>& drawable, const Math::Matrix4<T>& transformationMatrix) {
+        return sortableDepth(Float(drawable.boundingVolume() == DrawableBoundingVolume::None ?
+            -transformationMatrix.translation().z() :
+            -transformationMatrix.transformPoint(drawable.boundingBox().center()).z()));
+    }
+}
+
+/**
+@brief Sorted draw list
+
+Caller-owned storage for
+@ref Camera::draw(DrawableGroup<dimensions, T>&, DrawList<dimensions, T>&),
+which draws the group in an order given by @ref order() instead of the order
+in which the drawables were added. With the default @ref DrawOrder::State,
+drawables having the same @ref Drawable::stateKey() are drawn consecutively,
+so if the key identifies the shader, material and mesh used by the drawable,
+the @ref Drawable::draw() implementations need to switch GPU state much less
+often. Drawables with the same state are then drawn front to back to reduce
+overdraw.
+
+@code{.cpp}
+SceneGraph::DrawList3D opaque;
+SceneGraph::DrawList3D transparent{SceneGraph::DrawOrder::BackToFront};
+
+for(CustomDrawable* drawable: drawables)
+    drawable->setStateKey(SceneGraph::drawStateKey(
+        drawable->shaderId(), drawable->materialId(), drawable->meshId()));
+
+// ...
+
+camera.draw(opaqueDrawables, opaque);
+camera.draw(transparentDrawables, transparent);
+@endcode
+
+Sorting keys are 64-bit, composed of the 32-bit state key and depth of the
+drawable relative to the camera, and are sorted using a radix sort, so the
+cost is linear in the drawable count. The storage is reused between calls,
+so once it's large enough for given group, drawing doesn't do any heap
+allocation. If @ref Camera::frustumCulling() is enabled, culled drawables are
+not included in the list.
+
+In 2D there's no depth and drawables with the same state key are drawn in the
+order they are in the group.
+
+@section SceneGraph-DrawList-coherence Temporal coherence
+
+The order usually changes only a little between frames, especially with
+@ref DrawOrder::BackToFront used for transparent geometry, where the order
+has to be correct every frame. With @ref setTemporalCoherence() enabled the
+drawables are first put into the order from the previous call, which is then
+fixed with an insertion sort that's linear for nearly sorted input. If too
+many drawables changed their position, for example after a camera cut,
+the list falls back to the radix sort. Drawables with equal keys are in this
+case drawn in the order from the previous call instead of the order in the
+group, which avoids flickering of overlapping transparent drawables at the
+same depth.
+
+@code{.cpp}
+SceneGraph::DrawList3D transparent{SceneGraph::DrawOrder::BackToFront};
+transparent.setTemporalCoherence(true);
+
+// each frame
+camera.draw(transparentDrawables, transparent);
+@endcode
+
+See @ref Shaders-Phong-usage-transparency for order-independent transparency,
+which doesn't need any sorting.
+@see @ref DrawList2D, @ref DrawList3D
+*/
+template<UnsignedInt dimensions, class T> class DrawList {
+    public:
+        /**
+         * @brief Constructor
+         * @param order     Draw order
+         */
+        explicit DrawList(DrawOrder order = DrawOrder::State): _order{order}, _temporalCoherence{false} {}
+
+        /** @brief Draw order */
+        DrawOrder order() const { return _order; }
+
+        /**
+         * @brief Set draw order
+         * @return Reference to self (for method chaining)
+         */
+        DrawList<dimensions, T>& setOrder(DrawOrder order) {
+            _order = order;
+            return *this;
+        }
+
+        /** @brief Whether the order from the previous call is reused */
+        bool temporalCoherence() const { return _temporalCoherence; }
+
+        /**
+         * @brief Reuse the order from the previous call
+         * @return Reference to self (for method chaining)
+         *
+         * Disabled by default. Has no effect with @ref DrawOrder::Unsorted.
+         * The order from the previous call is used only if the group has the
+         * same drawable count. See @ref SceneGraph-DrawList-coherence for
+         * more information.
+         */
+        DrawList<dimensions, T>& setTemporalCoherence(bool enabled) {
+            _temporalCoherence = enabled;
+            return *this;
+        }
+
+        /**
+         * @brief Reserve memory for given drawable count
+         *
+         * Useful to avoid the initial allocations on first draw.
+         */
+        void reserve(std::size_t size) {
+            _transformations.reserve(size);
+            _items.reserve(size);
+            _scratch.reserve(size);
+            if(_temporalCoherence) _ranks.reserve(size);
+        }
+
+        /** @brief Count of drawables drawn in last call */
+        std::size_t size() const { return _items.size(); }
+
+        /**
+         * @brief Index of a drawn drawable in the group
+         *
+         * Returns index of @p i-th drawable drawn in last call.
+         */
+        UnsignedInt drawableIndex(std::size_t i) const {
+            return _items[i].index;
+        }
+
+        /**
+         * @brief Drawable transformations calculated in last call
+         *
+         * In the same order as drawables in the group, including drawables
+         * that were culled.
+         */
+        Containers::ArrayView<const MatrixTypeFor<dimensions, T>> transformations() const {
+            return _transformations.transformations();
+        }
+
+    private:
+        friend Camera<dimensions, T>;
+
+        DrawableTransformations<dimensions, T> _transformations;
+        std::vector<Implementation::DrawListItem> _items, _scratch;
+        std::vector<UnsignedInt> _ranks;
+        DrawOrder _order;
+        bool _temporalCoherence;
+};
+
+/**
+@brief Sorted draw list for two-dimensional float scenes
+
+@see @ref DrawList3D
+*/
+typedef DrawList<2, Float> DrawList2D;
+
+/**
+@brief Sorted draw list for three-dimensional float scenes
+
+@see @ref DrawList2D
+*/
+typedef DrawList<3, Float> DrawList3D;
+
+}}
+
+#endif
@@ -26,13 +26,41 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
+ * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, enum @ref Magnum::SceneGraph::DrawableBoundingVolume, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/DualComplex.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 
 namespace Magnum { namespace SceneGraph {
 
+/**
+@brief Drawable bounding volume
+
+@see @ref Drawable::boundingVolume(), @ref Camera::setFrustumCulling()
+*/
+enum class DrawableBoundingVolume: UnsignedByte {
+    None,   /**< No bounding volume, the drawable is never culled (default) */
+    Sphere, /**< Bounding sphere (circle in 2D) */
+    Box     /**< Bounding box (rectangle in 2D) */
+};
+
+namespace Implementation {
+    /* Axis-aligned box enclosing given box transformed with given matrix */
+    template<UnsignedInt dimensions, class T> RangeTypeFor<dimensions, T> transformedBoundingBox(const MatrixTypeFor<dimensions, T>& matrix, const RangeTypeFor<dimensions, T>& box) {
+        const auto rotationScaling = matrix.rotationScaling();
+        const VectorTypeFor<dimensions, T> halfSize = box.size()*T(0.5);
+        VectorTypeFor<dimensions, T> extents;
+        for(std::size_t i = 0; i != dimensions; ++i)
+            extents += Math::abs(rotationScaling[i])*halfSize[i];
+        return RangeTypeFor<dimensions, T>::fromCenter(matrix.transformPoint(box.center()), extents);
+    }
+}
+
 /**
 @brief Drawable
 
@@ -122,6 +150,50 @@ predicate on the drawable transformation list:
 
 @snippet MagnumSceneGraph.cpp Drawable-draw-order
 
+If the reason for custom draw order is to minimize GPU state changes or
+overdraw, use @ref DrawList together with @ref setStateKey() instead, which
+sorts the drawables without allocating a new list every frame.
+
+@section SceneGraph-Drawable-culling Frustum culling
+
+If the drawable has a bounding volume set using @ref setBoundingSphere() or
+@ref setBoundingBox() and frustum culling is enabled on the camera using
+@ref Camera::setFrustumCulling(), drawables whose bounding volume lies
+completely outside of the camera frustum are not drawn. The bounding volume is
+specified in space local to the object the drawable is attached to and is
+transformed together with the object, so it needs to be set only once.
+
+@code{.cpp}
+drawable->setBoundingSphere({}, 1.0f);
+camera.setFrustumCulling(true);
+camera.draw(drawables);
+@endcode
+
+For large groups with mostly static drawables, a
+@ref BoundingVolumeHierarchy can be built on top of the group to make the
+culling cost logarithmic instead of linear.
+
+@section SceneGraph-Drawable-multithreading Drawing on multiple threads
+
+With APIs that allow recording commands from multiple threads, such as
+Vulkan, the drawables can be drawn in parallel using
+@ref Camera::draw(DrawableGroup<dimensions, T>&, DrawableTransformations<dimensions, T>&, UnsignedInt, UnsignedInt).
+The transformations are calculated and the drawables culled on the calling
+thread first, the visible drawables are then split into contiguous chunks
+that are picked up by worker threads of @ref globalJobExecutor() in a
+first-come, first-serve manner.
+Instead of @ref draw(), @ref drawChunk() is called, getting index of the
+chunk as an additional parameter, which can be used to select a command
+buffer to record into. Drawables in a single chunk are drawn on the same
+thread in the order they are in the group; see @ref Vk::ParallelCommandBuffers
+for a complete example.
+
+The @ref drawChunk() implementations have to be thread-safe in regards to
+each other. The default implementation of @ref drawChunk() calls @ref draw(),
+so drawables that are not written with parallel drawing in mind keep working
+when drawn on a single thread. On Emscripten the drawing is always done on
+the calling thread.
+
 @section SceneGraph-Drawable-explicit-specializations Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -147,6 +219,14 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          */
         explicit Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables = nullptr);
 
+        /**
+         * @brief Destructor
+         *
+         * Removes the drawable from a @ref BoundingVolumeHierarchy, if it's
+         * part of any.
+         */
+        ~Drawable();
+
         #ifndef DOXYGEN_GENERATING_OUTPUT
         /* This is here to avoid ambiguity with deleted copy constructor when
            passing `*this` from class subclassing both Drawable and AbstractObject */
@@ -176,6 +256,155 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * @ref SceneGraph::Camera::projectionMatrix() "Camera::projectionMatrix()".
          */
         virtual void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) = 0;
+
+        /**
+         * @brief Draw the object as a part of a chunk
+         * @param transformationMatrix  Object transformation relative to camera
+         * @param camera                Camera
+         * @param chunk                 Chunk index
+         *
+         * Called instead of @ref draw() from
+         * @ref Camera::draw(DrawableGroup<dimensions, T>&, DrawableTransformations<dimensions, T>&, UnsignedInt, UnsignedInt),
+         * possibly from multiple threads at once. Default implementation
+         * calls @ref draw(). See @ref SceneGraph-Drawable-multithreading for
+         * more information.
+         */
+        virtual void drawChunk(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera, UnsignedInt chunk) {
+            static_cast<void>(chunk);
+            draw(transformationMatrix, camera);
+        }
+
+        /**
+         * @brief Draw depth of the object using given camera
+         * @param transformationMatrix  Object transformation relative to camera
+         * @param camera                Camera
+         *
+         * Called instead of @ref draw() from @ref Camera::drawDepth(). The
+         * implementation is expected to draw the same geometry as
+         * @ref draw() but with a depth-only shader, such as
+         * @ref Shaders::Phong::Flag::DepthOnly. Default implementation
+         * calls @ref draw(), so the depth is correct for the shading pass
+         * even for drawables that don't implement a depth-only variant, only
+         * without any savings. See @ref SceneGraph-Camera-depth-prepass for
+         * more information.
+         */
+        virtual void drawDepth(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) {
+            draw(transformationMatrix, camera);
+        }
+
+        /**
+         * @brief Draw the object using given camera and a rigid transformation
+         * @param transformation    Object transformation relative to camera
+         * @param camera            Camera
+         *
+         * Called instead of @ref draw() from @ref Camera::drawRigid(). The
+         * @p transformation is a @ref Magnum::Math::DualQuaternion "Math::DualQuaternion"
+         * in 3D and a @ref Magnum::Math::DualComplex "Math::DualComplex" in
+         * 2D, so it can be passed further without expanding it to a matrix.
+         * Default implementation converts it to a matrix and calls
+         * @ref draw(). See @ref SceneGraph-Camera-rigid for more information.
+         */
+        virtual void drawRigid(const typename Implementation::RigidTransformationTypeFor<dimensions, T>::Type& transformation, Camera<dimensions, T>& camera) {
+            draw(transformation.toMatrix(), camera);
+        }
+
+        /**
+         * @brief Bounding volume type
+         *
+         * Default is @ref DrawableBoundingVolume::None.
+         * @see @ref SceneGraph-Drawable-culling
+         */
+        DrawableBoundingVolume boundingVolume() const { return _boundingVolume; }
+
+        /**
+         * @brief Bounding box
+         *
+         * In space local to the object. If @ref boundingVolume() is
+         * @ref DrawableBoundingVolume::Sphere, returns a box enclosing the
+         * sphere, if @ref DrawableBoundingVolume::None, returns a
+         * zero-size range.
+         */
+        RangeTypeFor<dimensions, T> boundingBox() const { return _boundingBox; }
+
+        /**
+         * @brief Bounding sphere center
+         *
+         * In space local to the object. Equivalent to
+         * @cpp boundingBox().center() @ce.
+         */
+        VectorTypeFor<dimensions, T> boundingSphereCenter() const {
+            return _boundingBox.center();
+        }
+
+        /**
+         * @brief Bounding sphere radius
+         *
+         * Valid only if @ref boundingVolume() is
+         * @ref DrawableBoundingVolume::Sphere, otherwise returns
+         * @cpp 0 @ce.
+         */
+        T boundingSphereRadius() const { return _boundingSphereRadius; }
+
+        /**
+         * @brief Set bounding sphere
+         * @return Reference to self (for method chaining)
+         *
+         * The @p center is in space local to the object.
+         * @see @ref setBoundingBox(), @ref resetBoundingVolume()
+         */
+        Drawable<dimensions, T>& setBoundingSphere(const VectorTypeFor<dimensions, T>& center, T radius);
+
+        /**
+         * @brief Set bounding box
+         * @return Reference to self (for method chaining)
+         *
+         * The @p box is in space local to the object.
+         * @see @ref setBoundingSphere(), @ref resetBoundingVolume()
+         */
+        Drawable<dimensions, T>& setBoundingBox(const RangeTypeFor<dimensions, T>& box);
+
+        /**
+         * @brief Reset bounding volume
+         * @return Reference to self (for method chaining)
+         *
+         * Sets @ref boundingVolume() to @ref DrawableBoundingVolume::None, so
+         * the drawable is never culled.
+         */
+        Drawable<dimensions, T>& resetBoundingVolume();
+
+        /**
+         * @brief State key
+         *
+         * Default is @cpp 0 @ce.
+         * @see @ref setStateKey()
+         */
+        UnsignedInt stateKey() const { return _stateKey; }
+
+        /**
+         * @brief Set state key
+         * @return Reference to self (for method chaining)
+         *
+         * Key identifying GPU state needed to draw the drawable, such as the
+         * shader, material and mesh. Used by @ref DrawList to draw drawables
+         * with the same state consecutively. Use @ref drawStateKey() to
+         * compose the key from separate IDs.
+         */
+        Drawable<dimensions, T>& setStateKey(UnsignedInt key) {
+            _stateKey = key;
+            return *this;
+        }
+
+    private:
+        #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        friend BoundingVolumeHierarchy<dimensions, T>;
+        #endif
+
+        RangeTypeFor<dimensions, T> _boundingBox;
+        T _boundingSphereRadius;
+        UnsignedInt _stateKey;
+        DrawableBoundingVolume _boundingVolume;
+        UnsignedInt _hierarchyItem;
+        BoundingVolumeHierarchy<dimensions, T>* _hierarchy;
 };
 
 /**
@@ -29,11 +29,40 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Drawable.h
  */
 
+#include "Magnum/SceneGraph/BoundingVolumeHierarchy.h"
 #include "Magnum/SceneGraph/Drawable.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables) {}
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables), _boundingSphereRadius{}, _stateKey{}, _boundingVolume{DrawableBoundingVolume::None}, _hierarchyItem{}, _hierarchy{} {}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::~Drawable() {
+    if(_hierarchy) _hierarchy->_items[_hierarchyItem].drawable = nullptr;
+}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::setBoundingSphere(const VectorTypeFor<dimensions, T>& center, const T radius) {
+    _boundingBox = RangeTypeFor<dimensions, T>::fromCenter(center, VectorTypeFor<dimensions, T>{radius});
+    _boundingSphereRadius = radius;
+    _boundingVolume = DrawableBoundingVolume::Sphere;
+    if(_hierarchy) _hierarchy->markDirty(_hierarchyItem);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::setBoundingBox(const RangeTypeFor<dimensions, T>& box) {
+    _boundingBox = box;
+    _boundingSphereRadius = T(0);
+    _boundingVolume = DrawableBoundingVolume::Box;
+    if(_hierarchy) _hierarchy->markDirty(_hierarchyItem);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::resetBoundingVolume() {
+    _boundingBox = {};
+    _boundingSphereRadius = T(0);
+    _boundingVolume = DrawableBoundingVolume::None;
+    if(_hierarchy) _hierarchy->markDirty(_hierarchyItem);
+    return *this;
+}
 
 }}
 
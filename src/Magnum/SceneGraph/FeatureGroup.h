@@ -44,6 +44,7 @@ See @ref FeatureGroup.
 */
 template<UnsignedInt dimensions, class T> class AbstractFeatureGroup {
     template<UnsignedInt, class, class> friend class FeatureGroup;
+    template<UnsignedInt, class> friend class BoundingVolumeHierarchy;
 
     explicit AbstractFeatureGroup();
     virtual ~AbstractFeatureGroup();
@@ -52,6 +53,10 @@ template<UnsignedInt dimensions, class T> class AbstractFeatureGroup {
     void remove(AbstractFeature<dimensions, T>& feature);
 
     std::vector<std::reference_wrapper<AbstractFeature<dimensions, T>>> _features;
+
+    /* Incremented on every add() and remove(), used by
+       BoundingVolumeHierarchy to detect that it needs to be rebuilt */
+    std::size_t _modificationCount;
 };
 
 /**
@@ -35,16 +35,18 @@
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> AbstractFeatureGroup<dimensions, T>::AbstractFeatureGroup() = default;
+template<UnsignedInt dimensions, class T> AbstractFeatureGroup<dimensions, T>::AbstractFeatureGroup(): _modificationCount{} {}
 template<UnsignedInt dimensions, class T> AbstractFeatureGroup<dimensions, T>::~AbstractFeatureGroup() = default;
 
 template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::add(AbstractFeature<dimensions, T>& feature) {
     _features.push_back(feature);
+    ++_modificationCount;
 }
 
 template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::remove(AbstractFeature<dimensions, T>& feature) {
     _features.erase(std::find_if(_features.begin(), _features.end(),
         [&feature](AbstractFeature<dimensions, T>& f) { return &f == &feature; }));
+    ++_modificationCount;
 }
 
 }}
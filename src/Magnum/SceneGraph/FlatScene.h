@@ -0,0 +1,389 @@
+#ifndef Magnum_SceneGraph_FlatScene_h
+#define Magnum_SceneGraph_FlatScene_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatScene, alias @ref Magnum::SceneGraph::BasicFlatScene2D, @ref Magnum::SceneGraph::BasicFlatScene3D, typedef @ref Magnum::SceneGraph::FlatScene2D, @ref Magnum::SceneGraph::FlatScene3D
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Flat scene hierarchy
+
+Data-oriented alternative to the @ref Object / @ref Scene hierarchy, meant for
+scenes with a very large number of objects where the per-object overhead of
+linked lists, virtual calls and feature bookkeeping becomes significant.
+Objects are referenced by plain integer IDs and the scene stores parent
+indices, local and absolute transformations in contiguous arrays. There's no
+limit on object count apart from available memory.
+
+@code{.cpp}
+SceneGraph::FlatScene3D scene;
+UnsignedInt root = scene.addObject(-1, Matrix4::translation(Vector3::zAxis(-5.0f)));
+UnsignedInt child = scene.addObject(root, Matrix4::rotationY(15.0_degf));
+
+// ...
+
+scene.setTransformation(root, Matrix4::translation(Vector3::zAxis(-7.5f)));
+scene.update();
+Matrix4 absolute = scene.absoluteTransformation(child);
+@endcode
+
+@section SceneGraph-FlatScene-update Transformation update
+
+Internally, object IDs are kept in an order sorted by hierarchy depth, so
+parents are always processed before their children and all absolute
+transformations can be computed in a single linear pass in @ref update().
+Objects at the same depth retain their relative insertion order, which means
+that for the common case of objects added in a breadth-first order the memory
+is accessed in a sequential manner.
+
+The order is recalculated on demand only if the hierarchy changed since last
+@ref update(), that is after @ref addObject() or @ref setParent(). Changing
+just the transformations with @ref setTransformation() marks given object and
+the whole subtree under it as dirty and only the dirty transformations are
+recomputed on next @ref update().
+
+@section SceneGraph-FlatScene-multithreading Multithreaded update
+
+For large scenes, the update can be distributed over multiple threads using
+@ref setThreadCount(). In that case the hierarchy is cut at the first depth
+level that has enough objects and the subtrees under it are split into
+independent tasks. Objects above the cut are processed first on the calling
+thread, the tasks are then picked up by worker threads of
+@ref globalJobExecutor() in a first-come, first-serve manner, so threads
+finishing early continue with remaining work instead of waiting. No threads
+are spawned by the update itself. Each task is again depth-sorted internally,
+so the work inside a task is still a single linear pass.
+
+@code{.cpp}
+scene.setThreadCount(std::thread::hardware_concurrency());
+
+// ...
+
+scene.update();
+@endcode
+
+If the hierarchy is too shallow or too narrow to be split into enough tasks,
+the update is done on the calling thread only. Similarly, if the scene has
+less than @ref ParallelUpdateThreshold objects, the executor is not used at
+all, as the overhead would outweigh the gains. Multithreaded update
+is not available on @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where
+@ref setThreadCount() is ignored.
+
+@section SceneGraph-FlatScene-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref FlatScene.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatScene2D
+-   @ref FlatScene3D
+
+@see @ref scenegraph, @ref BasicFlatScene2D, @ref BasicFlatScene3D,
+    @ref FlatScene2D, @ref FlatScene3D
+*/
+template<UnsignedInt dimensions, class T> class FlatScene {
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        enum: std::size_t {
+            /**
+             * Minimal object count for which multithreaded update is done.
+             * See @ref SceneGraph-FlatScene-multithreading for more
+             * information.
+             */
+            ParallelUpdateThreshold = 4096,
+
+            /**
+             * Task count per thread. The tasks are assigned to threads
+             * dynamically, having more tasks than threads makes the work
+             * distribution more even for unbalanced hierarchies.
+             */
+            ParallelTasksPerThread = 4
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * Creates an empty scene.
+         */
+        explicit FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene(const FlatScene<dimensions, T>&) = delete;
+
+        /** @brief Move constructor */
+        FlatScene(FlatScene<dimensions, T>&&) noexcept;
+
+        ~FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene<dimensions, T>& operator=(const FlatScene<dimensions, T>&) = delete;
+
+        /** @brief Move assignment */
+        FlatScene<dimensions, T>& operator=(FlatScene<dimensions, T>&&) noexcept;
+
+        /** @brief Object count */
+        std::size_t size() const { return _parents.size(); }
+
+        /** @brief Whether the scene is empty */
+        bool isEmpty() const { return _parents.empty(); }
+
+        /**
+         * @brief Reserve memory for given object count
+         * @return Reference to self (for method chaining)
+         *
+         * Useful for avoiding reallocations when the final object count is
+         * known upfront.
+         */
+        FlatScene<dimensions, T>& reserve(std::size_t size);
+
+        /**
+         * @brief Remove all objects
+         * @return Reference to self (for method chaining)
+         */
+        FlatScene<dimensions, T>& clear();
+
+        /**
+         * @brief Add an object
+         * @param parent            Parent object ID or @cpp -1 @ce for a
+         *      root object
+         * @param transformation    Transformation relative to parent
+         * @return ID of the newly added object
+         *
+         * The IDs are assigned sequentially, starting from @cpp 0 @ce. Expects
+         * that @p parent is either @cpp -1 @ce or a valid object ID.
+         */
+        UnsignedInt addObject(Int parent, const MatrixType& transformation = MatrixType{});
+
+        /**
+         * @brief Add objects in bulk
+         * @param parents           Parent indices relative to the added
+         *      objects or @cpp -1 @ce for root objects
+         * @param transformations   Transformations relative to parent
+         * @return ID of the first added object
+         *
+         * Adds @p parents size objects, with IDs assigned sequentially. Unlike
+         * with @ref addObject(), a parent can be after its children, which
+         * allows to add data imported using @ref Trade::AbstractImporter::flatScene3D()
+         * directly. Expects that both views have the same size, that
+         * @p parents are either @cpp -1 @ce or indices into the views and
+         * that they don't form a cycle.
+         */
+        UnsignedInt addObjects(Containers::ArrayView<const Int> parents, Containers::ArrayView<const MatrixType> transformations);
+
+        /**
+         * @brief Parent object ID
+         *
+         * Returns @cpp -1 @ce for root objects. Expects that @p id is a valid
+         * object ID.
+         */
+        Int parent(UnsignedInt id) const;
+
+        /**
+         * @brief Set parent object
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that both @p id and @p parent (if not @cpp -1 @ce) are valid
+         * object IDs and that @p parent is not @p id itself or any of its
+         * children. Marks the object and all its children as dirty.
+         */
+        FlatScene<dimensions, T>& setParent(UnsignedInt id, Int parent);
+
+        /**
+         * @brief Depth in the hierarchy
+         *
+         * Root objects have depth @cpp 0 @ce. Expects that @p id is a valid
+         * object ID.
+         */
+        UnsignedInt depth(UnsignedInt id) const;
+
+        /**
+         * @brief Object transformation relative to its parent
+         *
+         * Expects that @p id is a valid object ID.
+         */
+        MatrixType transformation(UnsignedInt id) const;
+
+        /**
+         * @brief Set object transformation relative to its parent
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p id is a valid object ID. Marks the object and all its
+         * children as dirty.
+         */
+        FlatScene<dimensions, T>& setTransformation(UnsignedInt id, const MatrixType& transformation);
+
+        /**
+         * @brief Whether object absolute transformation is dirty
+         *
+         * Returns @cpp true @ce if the object or any of its parents was
+         * changed since last @ref update(). Expects that @p id is a valid
+         * object ID.
+         */
+        bool isDirty(UnsignedInt id) const;
+
+        /**
+         * @brief Thread count used for update
+         *
+         * Default is @cpp 1 @ce, meaning the update is done only on the
+         * calling thread.
+         */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count used for update
+         * @return Reference to self (for method chaining)
+         *
+         * No threads are spawned, the value caps how many workers of
+         * @ref globalJobExecutor() are used by @ref update(). For a value
+         * larger than @cpp 1 @ce the hierarchy is split into up to
+         * @p count times @ref ParallelTasksPerThread tasks, the split is
+         * redone on next @ref update() if the value changes. Values of
+         * @cpp 0 @ce and @cpp 1 @ce both mean the update is done only on the
+         * calling thread. See @ref SceneGraph-FlatScene-multithreading for
+         * more information.
+         */
+        FlatScene<dimensions, T>& setThreadCount(UnsignedInt count);
+
+        /**
+         * @brief Update absolute transformations
+         * @return Reference to self (for method chaining)
+         *
+         * Recomputes absolute transformations of all dirty objects. See
+         * @ref SceneGraph-FlatScene-update and
+         * @ref SceneGraph-FlatScene-multithreading for more information.
+         */
+        FlatScene<dimensions, T>& update();
+
+        /**
+         * @brief Absolute transformation
+         *
+         * Expects that @p id is a valid object ID and that the object is not
+         * dirty.
+         * @see @ref update(), @ref isDirty()
+         */
+        MatrixType absoluteTransformation(UnsignedInt id) const;
+
+        /**
+         * @brief Absolute transformations of all objects
+         *
+         * Indexed by object ID. The contents are valid only for objects
+         * which are not dirty.
+         * @see @ref update(), @ref isDirty()
+         */
+        Containers::ArrayView<const MatrixType> absoluteTransformations() const {
+            return {_absoluteTransformations.data(), _absoluteTransformations.size()};
+        }
+
+        /**
+         * @brief Object IDs sorted by hierarchy depth
+         *
+         * Parents are always before their children. Valid only after
+         * @ref update(). If multithreaded update is enabled, the order is
+         * depth-sorted only within each independent task, see
+         * @ref SceneGraph-FlatScene-multithreading.
+         */
+        Containers::ArrayView<const UnsignedInt> order() const {
+            return {_order.data(), _order.size()};
+        }
+
+    private:
+        void MAGNUM_SCENEGRAPH_LOCAL updateOrder();
+        void MAGNUM_SCENEGRAPH_LOCAL partitionOrder();
+        void MAGNUM_SCENEGRAPH_LOCAL updateRange(std::size_t begin, std::size_t end);
+
+        std::vector<Int> _parents;
+        std::vector<UnsignedInt> _depths;
+        std::vector<MatrixType> _transformations;
+        std::vector<MatrixType> _absoluteTransformations;
+        std::vector<UnsignedByte> _dirty;
+        std::vector<UnsignedInt> _order;
+        /* Offsets into _order, first range is the serial prefix, the rest
+           are independent tasks. Empty if not partitioned. */
+        std::vector<std::size_t> _taskOffsets;
+        UnsignedInt _threadCount;
+        bool _orderDirty;
+        bool _anyDirty;
+};
+
+/**
+@brief Flat scene for two-dimensional scenes
+
+Convenience alternative to @cpp FlatScene<2, T> @ce. See @ref FlatScene for
+more information.
+@see @ref FlatScene2D, @ref BasicFlatScene3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatScene2D = FlatScene<2, T>;
+#endif
+
+/**
+@brief Flat scene for two-dimensional float scenes
+
+@see @ref FlatScene3D
+*/
+typedef BasicFlatScene2D<Float> FlatScene2D;
+
+/**
+@brief Flat scene for three-dimensional scenes
+
+Convenience alternative to @cpp FlatScene<3, T> @ce. See @ref FlatScene for
+more information.
+@see @ref FlatScene3D, @ref BasicFlatScene2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatScene3D = FlatScene<3, T>;
+#endif
+
+/**
+@brief Flat scene for three-dimensional float scenes
+
+@see @ref FlatScene2D
+*/
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<3, Float>;
+#endif
+
+}}
+
+#endif
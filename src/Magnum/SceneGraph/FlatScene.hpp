@@ -0,0 +1,337 @@
+#ifndef Magnum_SceneGraph_FlatScene_hpp
+#define Magnum_SceneGraph_FlatScene_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatScene.h
+ */
+
+#include <algorithm>
+#include <Corrade/configure.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::FlatScene(): _threadCount{1}, _orderDirty{false}, _anyDirty{false} {}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::FlatScene(FlatScene<dimensions, T>&&) noexcept = default;
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::~FlatScene() = default;
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>& FlatScene<dimensions, T>::operator=(FlatScene<dimensions, T>&&) noexcept = default;
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>& FlatScene<dimensions, T>::reserve(const std::size_t size) {
+    _parents.reserve(size);
+    _depths.reserve(size);
+    _transformations.reserve(size);
+    _absoluteTransformations.reserve(size);
+    _dirty.reserve(size);
+    _order.reserve(size);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>& FlatScene<dimensions, T>::clear() {
+    _parents.clear();
+    _depths.clear();
+    _transformations.clear();
+    _absoluteTransformations.clear();
+    _dirty.clear();
+    _order.clear();
+    _taskOffsets.clear();
+    _orderDirty = _anyDirty = false;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt FlatScene<dimensions, T>::addObject(const Int parent, const MatrixType& transformation) {
+    CORRADE_ASSERT(parent >= -1 && parent < Int(_parents.size()),
+        "SceneGraph::FlatScene::addObject(): invalid parent" << parent, {});
+
+    const UnsignedInt id = _parents.size();
+    _parents.push_back(parent);
+    _transformations.push_back(transformation);
+    _absoluteTransformations.emplace_back();
+    _dirty.push_back(1);
+    _orderDirty = _anyDirty = true;
+    return id;
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt FlatScene<dimensions, T>::addObjects(const Containers::ArrayView<const Int> parents, const Containers::ArrayView<const MatrixType> transformations) {
+    CORRADE_ASSERT(parents.size() == transformations.size(),
+        "SceneGraph::FlatScene::addObjects(): expected the same count of parents and transformations, got" << parents.size() << "and" << transformations.size(), {});
+
+    const std::size_t count = parents.size();
+    for(std::size_t i = 0; i != count; ++i)
+        CORRADE_ASSERT(parents[i] >= -1 && parents[i] < Int(count),
+            "SceneGraph::FlatScene::addObjects(): invalid parent" << parents[i] << "for object" << i, {});
+
+    /* Each object is marked with the index of the walk that reached it
+       first, reaching an object marked by the same walk again means a
+       cycle */
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    {
+        std::vector<UnsignedInt> walks(count, 0);
+        for(std::size_t i = 0; i != count; ++i) {
+            Int o = Int(i);
+            while(o != -1 && !walks[o]) {
+                walks[o] = UnsignedInt(i + 1);
+                o = parents[o];
+            }
+            CORRADE_ASSERT(o == -1 || walks[o] != i + 1,
+                "SceneGraph::FlatScene::addObjects(): parents form a cycle at object" << o, {});
+        }
+    }
+    #endif
+
+    const UnsignedInt first = _parents.size();
+    reserve(first + count);
+    for(std::size_t i = 0; i != count; ++i) {
+        _parents.push_back(parents[i] == -1 ? -1 : Int(first) + parents[i]);
+        _transformations.push_back(transformations[i]);
+    }
+    _absoluteTransformations.resize(first + count);
+    _dirty.resize(first + count, 1);
+    if(count) _orderDirty = _anyDirty = true;
+    return first;
+}
+
+template<UnsignedInt dimensions, class T> Int FlatScene<dimensions, T>::parent(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _parents.size(),
+        "SceneGraph::FlatScene::parent(): index" << id << "out of range for" << _parents.size() << "objects", -1);
+    return _parents[id];
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>& FlatScene<dimensions, T>::setParent(const UnsignedInt id, const Int parent) {
+    CORRADE_ASSERT(id < _parents.size(),
+        "SceneGraph::FlatScene::setParent(): index" << id << "out of range for" << _parents.size() << "objects", *this);
+    CORRADE_ASSERT(parent >= -1 && parent < Int(_parents.size()),
+        "SceneGraph::FlatScene::setParent(): invalid parent" << parent, *this);
+
+    /* Nothing to do */
+    if(_parents[id] == parent) return *this;
+
+    /* Object cannot be parented to itself or its child */
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(Int p = parent; p != -1; p = _parents[p])
+        CORRADE_ASSERT(p != Int(id),
+            "SceneGraph::FlatScene::setParent(): can't parent object" << id << "to itself or its child", *this);
+    #endif
+
+    _parents[id] = parent;
+    _dirty[id] = 1;
+    _orderDirty = _anyDirty = true;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt FlatScene<dimensions, T>::depth(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _parents.size(),
+        "SceneGraph::FlatScene::depth(): index" << id << "out of range for" << _parents.size() << "objects", {});
+
+    UnsignedInt depth = 0;
+    for(Int p = _parents[id]; p != -1; p = _parents[p]) ++depth;
+    return depth;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatScene<dimensions, T>::transformation(const UnsignedInt id) const -> MatrixType {
+    CORRADE_ASSERT(id < _parents.size(),
+        "SceneGraph::FlatScene::transformation(): index" << id << "out of range for" << _parents.size() << "objects", {});
+    return _transformations[id];
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>& FlatScene<dimensions, T>::setTransformation(const UnsignedInt id, const MatrixType& transformation) {
+    CORRADE_ASSERT(id < _parents.size(),
+        "SceneGraph::FlatScene::setTransformation(): index" << id << "out of range for" << _parents.size() << "objects", *this);
+    _transformations[id] = transformation;
+    _dirty[id] = 1;
+    _anyDirty = true;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> bool FlatScene<dimensions, T>::isDirty(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _parents.size(),
+        "SceneGraph::FlatScene::isDirty(): index" << id << "out of range for" << _parents.size() << "objects", {});
+
+    /* The dirty flag is propagated to children only in update(), so we need
+       to check the parents as well */
+    for(Int o = Int(id); o != -1; o = _parents[o])
+        if(_dirty[o]) return true;
+    return false;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::updateOrder() {
+    /* Calculate depths of all objects. Each object is assigned exactly once,
+       walking up only until the first object with already known depth. */
+    constexpr UnsignedInt Unknown = ~UnsignedInt{};
+    const std::size_t count = _parents.size();
+    _depths.assign(count, Unknown);
+    UnsignedInt maxDepth = 0;
+    for(std::size_t i = 0; i != count; ++i) {
+        if(_depths[i] != Unknown) continue;
+
+        /* Find nearest ancestor with known depth */
+        UnsignedInt steps = 0;
+        Int known = Int(i);
+        while(known != -1 && _depths[known] == Unknown) {
+            ++steps;
+            known = _parents[known];
+        }
+
+        /* Assign the depths on the way up to it */
+        UnsignedInt depth = known == -1 ? steps - 1 : _depths[known] + steps;
+        maxDepth = Math::max(maxDepth, depth);
+        for(Int o = Int(i); o != known; o = _parents[o])
+            _depths[o] = depth--;
+    }
+
+    /* Counting sort by depth. It's stable, so objects on the same level
+       retain their insertion order. */
+    std::vector<UnsignedInt> offsets(maxDepth + 2);
+    for(std::size_t i = 0; i != count; ++i)
+        ++offsets[_depths[i] + 1];
+    for(std::size_t i = 1; i < offsets.size(); ++i)
+        offsets[i] += offsets[i - 1];
+    _order.resize(count);
+    for(std::size_t i = 0; i != count; ++i)
+        _order[offsets[_depths[i]]++] = UnsignedInt(i);
+
+    /* Split into independent tasks for multithreaded update, if enabled */
+    _taskOffsets.clear();
+    if(_threadCount > 1 && count >= ParallelUpdateThreshold) partitionOrder();
+
+    _orderDirty = false;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::partitionOrder() {
+    const std::size_t count = _order.size();
+    const std::size_t taskCount = std::size_t(_threadCount)*ParallelTasksPerThread;
+
+    /* Find first level with enough objects to be split into the tasks. The
+       order is sorted by depth, so each level is a contiguous range. */
+    std::size_t cutBegin = 0, cutEnd = 0;
+    for(std::size_t i = 0; i != count; ) {
+        const UnsignedInt depth = _depths[_order[i]];
+        std::size_t end = i + 1;
+        while(end != count && _depths[_order[end]] == depth) ++end;
+        if(end - i >= taskCount) {
+            cutBegin = i;
+            cutEnd = end;
+            break;
+        }
+        i = end;
+    }
+
+    /* The hierarchy can't be split, stay serial */
+    if(cutBegin == cutEnd) return;
+
+    /* Objects above the cut go to the serial prefix (key 0), objects on the
+       cut level are distributed evenly among the tasks and objects below
+       inherit the task of their parent, which is always before them */
+    std::vector<UnsignedInt> tasks(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt id = _order[i];
+        if(i < cutBegin) tasks[id] = 0;
+        else if(i < cutEnd) tasks[id] = 1 + UnsignedInt((i - cutBegin)*taskCount/(cutEnd - cutBegin));
+        else tasks[id] = tasks[_parents[id]];
+    }
+
+    /* Stable counting sort by task, keeping the depth order inside each */
+    _taskOffsets.assign(taskCount + 2, 0);
+    for(std::size_t i = 0; i != count; ++i)
+        ++_taskOffsets[tasks[i] + 1];
+    for(std::size_t i = 1; i != _taskOffsets.size(); ++i)
+        _taskOffsets[i] += _taskOffsets[i - 1];
+    std::vector<std::size_t> positions{_taskOffsets};
+    std::vector<UnsignedInt> order(count);
+    for(const UnsignedInt id: _order)
+        order[positions[tasks[id]]++] = id;
+    _order = std::move(order);
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>& FlatScene<dimensions, T>::setThreadCount(const UnsignedInt count) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    const UnsignedInt threadCount = Math::max(count, 1u);
+    if(threadCount != _threadCount) {
+        _threadCount = threadCount;
+        _orderDirty = true;
+    }
+    #else
+    static_cast<void>(count);
+    #endif
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::updateRange(const std::size_t begin, const std::size_t end) {
+    /* Parents are always before children in the order (or processed already
+       in a previous range), so their absolute transformation is already
+       calculated and their dirty flag propagated */
+    for(std::size_t i = begin; i != end; ++i) {
+        const UnsignedInt id = _order[i];
+        const Int parent = _parents[id];
+        if(parent == -1) {
+            if(_dirty[id]) _absoluteTransformations[id] = _transformations[id];
+        } else if(_dirty[id] || _dirty[parent]) {
+            _absoluteTransformations[id] = _absoluteTransformations[parent]*_transformations[id];
+            _dirty[id] = 1;
+        }
+    }
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>& FlatScene<dimensions, T>::update() {
+    if(_orderDirty) updateOrder();
+    if(!_anyDirty) return *this;
+
+    /* Multithreaded update. First process the serial prefix, then let the
+       workers of the global job executor pick up tasks until there's nothing
+       left. Each task touches only its own objects and reads parents either
+       from the same task or from the serial prefix, so no further
+       synchronization is needed. */
+    if(!_taskOffsets.empty()) {
+        updateRange(0, _taskOffsets[1]);
+        Magnum::Implementation::parallelFor(_threadCount, _taskOffsets.size() - 2, [this](const std::size_t task) {
+            updateRange(_taskOffsets[task + 1], _taskOffsets[task + 2]);
+        });
+    } else updateRange(0, _order.size());
+
+    std::fill(_dirty.begin(), _dirty.end(), 0);
+    _anyDirty = false;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatScene<dimensions, T>::absoluteTransformation(const UnsignedInt id) const -> MatrixType {
+    CORRADE_ASSERT(id < _parents.size(),
+        "SceneGraph::FlatScene::absoluteTransformation(): index" << id << "out of range for" << _parents.size() << "objects", {});
+    CORRADE_ASSERT(!isDirty(id),
+        "SceneGraph::FlatScene::absoluteTransformation(): object" << id << "is dirty, call update() first", {});
+    return _absoluteTransformations[id];
+}
+
+}}
+
+#endif
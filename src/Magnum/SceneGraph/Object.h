@@ -39,14 +39,24 @@ namespace Magnum { namespace SceneGraph {
 
 namespace Implementation {
     enum class ObjectFlag: UnsignedByte {
-        Dirty = 1 << 0,
+        /* Features of the object and of all children with features were
+           notified using markDirty() since last clean */
+        Notified = 1 << 0,
         Visited = 1 << 1,
-        Joint = 1 << 2
+        Joint = 1 << 2,
+        Destructing = 1 << 3,
+        /* Cached result of isDirty(), valid until the object is cleaned */
+        Dirty = 1 << 4
     };
 
     typedef Containers::EnumSet<ObjectFlag> ObjectFlags;
 
     CORRADE_ENUMSET_OPERATORS(ObjectFlags)
+
+    /* Returns a new value of a global monotonic counter, used for lazy dirty
+       tracking of object transformations. The counter is atomic, so
+       independent scenes can be updated from different threads. */
+    MAGNUM_SCENEGRAPH_EXPORT std::uint64_t nextObjectGeneration();
 }
 
 /**
@@ -271,6 +281,27 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
             #endif
             ) const;
 
+        /**
+         * @brief Transformations of given group of objects relative to this object into existing storage
+         *
+         * Same as @ref transformations(std::vector<std::reference_wrapper<Object<Transformation>>>, const typename Transformation::DataType&) const,
+         * but puts the result into @p transformations, which is expected to
+         * have the same size as @p objects. The temporary data are kept in
+         * the scene, so once they're large enough, repeated calls don't
+         * allocate. Together with a rigid transformation implementation such
+         * as @ref DualQuaternionTransformation this makes it possible to
+         * calculate absolute transformations without any matrix conversion,
+         * see @ref SceneGraph-Camera-rigid for an example.
+         * @see @ref transformationMatrices()
+         */
+        void transformations(Containers::ArrayView<const std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>> objects, Containers::ArrayView<typename Transformation::DataType> transformations, const typename Transformation::DataType& initialTransformation =
+            #ifndef CORRADE_MSVC2015_COMPATIBILITY /* I hate this inconsistency */
+            typename Transformation::DataType()
+            #else
+            Transformation::DataType()
+            #endif
+            ) const;
+
         /*@}*/
 
         /**
@@ -289,7 +320,7 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         static void setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects);
 
         /** @copydoc AbstractObject::isDirty() */
-        bool isDirty() const { return !!(flags & Flag::Dirty); }
+        bool isDirty() const;
 
         /** @copydoc AbstractObject::setDirty() */
         void setDirty();
@@ -338,6 +369,10 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         }
 
         std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const override final;
+        void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const override final;
+        void doTransformationMatrices(Containers::ArrayView<const std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>> objects, Containers::ArrayView<MatrixType> transformationMatrices, const MatrixType& initialTransformationMatrix) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL transformationsInternal(std::vector<std::reference_wrapper<Object<Transformation>>>& objects, std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const typename Transformation::DataType& initialTransformation) const;
 
         typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const;
 
@@ -346,12 +381,19 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
         void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) override final;
 
+        void doAddFeatures(Int count) override final;
+
         void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(const typename Transformation::DataType& absoluteTransformation);
+        void MAGNUM_SCENEGRAPH_LOCAL notifyDirty();
+        std::uint64_t MAGNUM_SCENEGRAPH_LOCAL resolveDirty() const;
 
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
+        std::uint64_t generation, cleanGeneration;
+        UnsignedInt featureCount;
         UnsignedShort counter;
-        Flags flags;
+        /* Mutable because isDirty() caches the resolved state */
+        mutable Flags flags;
 };
 
 }}
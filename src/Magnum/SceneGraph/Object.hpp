@@ -30,8 +30,10 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <stack>
 
+#include "Magnum/Instrumentation.h"
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
@@ -43,11 +45,25 @@ template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~Abstra
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): generation(Implementation::nextObjectGeneration()), cleanGeneration(0), featureCount(0), counter(0xFFFFu), flags(Flag::Notified|Flag::Dirty) {
     setParent(parent);
 }
 
-template<class Transformation> Object<Transformation>::~Object() = default;
+template<class Transformation> Object<Transformation>::~Object() {
+    /* Remove features of this subtree from parent counts, unless the parent
+       is going away as well */
+    Object<Transformation>* p = parent();
+    if(featureCount && p && !(p->flags & Flag::Destructing))
+        p->doAddFeatures(-Int(featureCount));
+    flags |= Flag::Destructing;
+
+    /* Destroy the children and features while this object is still alive so
+       they can check the flags above. Features would otherwise be destroyed
+       in the AbstractObject destructor, where they can't call back into this
+       object anymore. */
+    Containers::LinkedList<Object<Transformation>>::clear();
+    this->features().clear();
+}
 
 template<class Transformation> Scene<Transformation>* Object<Transformation>::scene() {
     Object<Transformation>* p(this);
@@ -91,10 +107,16 @@ template<class Transformation> Object<Transformation>& Object<Transformation>::s
     }
 
     /* Remove the object from old parent children list */
-    if(this->parent()) this->parent()->Containers::template LinkedList<Object<Transformation>>::cut(this);
+    if(this->parent()) {
+        if(featureCount) this->parent()->doAddFeatures(-Int(featureCount));
+        this->parent()->Containers::template LinkedList<Object<Transformation>>::cut(this);
+    }
 
     /* Add the object to list of new parent */
-    if(parent) parent->Containers::LinkedList<Object<Transformation>>::insert(this);
+    if(parent) {
+        parent->Containers::LinkedList<Object<Transformation>>::insert(this);
+        if(featureCount) parent->doAddFeatures(featureCount);
+    }
 
     setDirty();
     return *this;
@@ -116,26 +138,74 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
     return Implementation::Transformation<Transformation>::compose(parent()->absoluteTransformation(), Transformation::transformation());
 }
 
+template<class Transformation> bool Object<Transformation>::isDirty() const {
+    /* Once dirty, the object stays dirty until it's cleaned, so the resolved
+       state can be cached */
+    if(flags & Flag::Dirty) return true;
+
+    resolveDirty();
+    return !!(flags & Flag::Dirty);
+}
+
+template<class Transformation> std::uint64_t Object<Transformation>::resolveDirty() const {
+    /* The object is dirty if it or any parent was changed after it was
+       cleaned last time. Resolve the whole chain in a single pass so the
+       parents have their state cached as well and setClean() going up
+       through them doesn't have to walk the chain again for each. */
+    std::uint64_t newestGeneration = generation;
+    if(const Object<Transformation>* p = parent()) {
+        const std::uint64_t parentGeneration = p->resolveDirty();
+        if(parentGeneration > newestGeneration)
+            newestGeneration = parentGeneration;
+    }
+
+    if(newestGeneration > cleanGeneration) flags |= Flag::Dirty;
+    return newestGeneration;
+}
+
 template<class Transformation> void Object<Transformation>::setDirty() {
-    /* The transformation of this object (and all children) is already dirty,
-       nothing to do */
-    if(flags & Flag::Dirty) return;
+    /* Children compare their clean generation against this one, so they
+       don't need to be visited */
+    generation = Implementation::nextObjectGeneration();
+    flags |= Flag::Dirty;
+
+    notifyDirty();
+}
+
+template<class Transformation> void Object<Transformation>::notifyDirty() {
+    /* Features of this object and all its children were already notified
+       since last clean, nothing to do */
+    if(flags & Flag::Notified) return;
 
     /* Make all features dirty */
     for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>& feature: this->features())
         feature.markDirty();
 
-    /* Make all children dirty */
+    /* Notify only children that have some features in their subtree, the
+       rest has nothing to notify and is resolved lazily in isDirty() */
     for(Object<Transformation>& child: children())
-        child.setDirty();
+        if(child.featureCount) child.notifyDirty();
 
-    /* Mark object as dirty */
-    flags |= Flag::Dirty;
+    flags |= Flag::Notified;
+}
+
+template<class Transformation> void Object<Transformation>::doAddFeatures(const Int count) {
+    /* Features destroyed together with the object, the counts of parents
+       were already updated in the destructor */
+    if(flags & Flag::Destructing) return;
+
+    /* No need to touch the notification flags. Notified objects are always
+       dirty and a dirty object doesn't need to be notified again until it's
+       cleaned, which cleans and resets all its notified parents as well. */
+    for(Object<Transformation>* o = this; o; o = o->parent())
+        o->featureCount += count;
 }
 
 template<class Transformation> void Object<Transformation>::setClean() {
     /* The object (and all its parents) are already clean, nothing to do */
-    if(!(flags & Flag::Dirty)) return;
+    if(!isDirty()) return;
+
+    MAGNUM_INSTRUMENTATION_SCOPE("SceneGraph::Object::setClean()");
 
     /* Collect all parents, compute base transformation */
     std::stack<Object<Transformation>*> objects;
@@ -170,6 +240,19 @@ template<class Transformation> void Object<Transformation>::setClean() {
     }
 }
 
+namespace Implementation {
+    /* Marks the scene scratch memory as used for the lifetime of the guard.
+       The flag is atomically exchanged, so also calls overlapping from
+       different threads reliably see that the memory was already taken. */
+    struct SceneScratchGuard {
+        explicit SceneScratchGuard(std::atomic<bool>& used): used(used), acquired{!used.exchange(true)} {}
+        ~SceneScratchGuard() { if(acquired) used = false; }
+
+        std::atomic<bool>& used;
+        const bool acquired;
+    };
+}
+
 template<class Transformation> auto Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
     std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
     castObjects.reserve(objects.size());
@@ -203,10 +286,89 @@ computed and recursively concatenated together. Resulting transformations for
 joints which were originally in `object` list is then returned.
 */
 template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& initialTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
+    /* Remember object count for later */
+    const std::size_t objectCount = objects.size();
+
+    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects;
+    std::vector<typename Transformation::DataType> jointTransformations;
+    if(!transformationsInternal(objects, jointObjects, jointTransformations, initialTransformation))
+        return {};
+
+    /* Shrink the array to contain only transformations of requested objects and return */
+    jointTransformations.resize(objectCount);
+    return jointTransformations;
+}
+
+template<class Transformation> void Object<Transformation>::transformations(const Containers::ArrayView<const std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>> objects, const Containers::ArrayView<typename Transformation::DataType> transformations, const typename Transformation::DataType& initialTransformation) const {
+    CORRADE_ASSERT(objects.size() == transformations.size(),
+        "SceneGraph::Object::transformations(): expected" << objects.size() << "transformations but got" << transformations.size(), );
+
+    /* Nearest common ancestor not yet implemented - assert this is done on scene */
+    const Scene<Transformation>* scene = this->scene();
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformations(): currently implemented only for Scene", );
+
+    /* Same as in doTransformationMatrices(), using the scratch memory stored
+       in the scene, but without converting the result to matrices */
+    Implementation::SceneScratchGuard guard{scene->_scratchUsed};
+    CORRADE_ASSERT(guard.acquired, "SceneGraph::Object::transformations(): can't be called concurrently or recursively on the same scene", );
+    scene->_objectScratch.clear();
+    for(auto o: objects) scene->_objectScratch.push_back(static_cast<Object<Transformation>&>(o.get()));
+
+    if(!transformationsInternal(scene->_objectScratch, scene->_jointObjectScratch, scene->_jointTransformationScratch, initialTransformation))
+        return;
+
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        transformations[i] = scene->_jointTransformationScratch[i];
+}
+
+template<class Transformation> void Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const {
+    transformationMatrices.clear();
+
+    /* Nearest common ancestor not yet implemented - assert this is done on scene */
+    const Scene<Transformation>* scene = this->scene();
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", );
+
+    /* Use the scratch memory stored in the scene, so repeated calls don't
+       allocate anything once the buffers are large enough */
+    Implementation::SceneScratchGuard guard{scene->_scratchUsed};
+    CORRADE_ASSERT(guard.acquired, "SceneGraph::Object::transformationMatrices(): can't be called concurrently or recursively on the same scene", );
+    scene->_objectScratch.clear();
+    /** @todo Ensure this doesn't crash, somehow */
+    for(auto o: objects) scene->_objectScratch.push_back(static_cast<Object<Transformation>&>(o.get()));
+
+    if(!transformationsInternal(scene->_objectScratch, scene->_jointObjectScratch, scene->_jointTransformationScratch, Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix)))
+        return;
+
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        transformationMatrices.push_back(Implementation::Transformation<Transformation>::toMatrix(scene->_jointTransformationScratch[i]));
+}
+
+template<class Transformation> void Object<Transformation>::doTransformationMatrices(const Containers::ArrayView<const std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>> objects, const Containers::ArrayView<MatrixType> transformationMatrices, const MatrixType& initialTransformationMatrix) const {
+    CORRADE_ASSERT(objects.size() == transformationMatrices.size(),
+        "SceneGraph::Object::transformationMatrices(): expected" << objects.size() << "matrices but got" << transformationMatrices.size(), );
+
+    /* Nearest common ancestor not yet implemented - assert this is done on scene */
+    const Scene<Transformation>* scene = this->scene();
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", );
+
+    /* Same as above, using the scratch memory stored in the scene */
+    Implementation::SceneScratchGuard guard{scene->_scratchUsed};
+    CORRADE_ASSERT(guard.acquired, "SceneGraph::Object::transformationMatrices(): can't be called concurrently or recursively on the same scene", );
+    scene->_objectScratch.clear();
+    for(auto o: objects) scene->_objectScratch.push_back(static_cast<Object<Transformation>&>(o.get()));
+
+    if(!transformationsInternal(scene->_objectScratch, scene->_jointObjectScratch, scene->_jointTransformationScratch, Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix)))
+        return;
+
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(scene->_jointTransformationScratch[i]);
+}
+
+template<class Transformation> bool Object<Transformation>::transformationsInternal(std::vector<std::reference_wrapper<Object<Transformation>>>& objects, std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const typename Transformation::DataType& initialTransformation) const {
+    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", false);
 
     /* Remember object count for later */
-    std::size_t objectCount = objects.size();
+    const std::size_t objectCount = objects.size();
 
     /* Mark all original objects as joints and create initial list of joints
        from them */
@@ -218,7 +380,7 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
         objects[i].get().counter = UnsignedShort(i);
         objects[i].get().flags |= Flag::Joint;
     }
-    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
+    jointObjects.assign(objects.begin(), objects.end());
 
     #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
     /* Scene object */
@@ -226,7 +388,7 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     #endif
 
     /* Nearest common ancestor not yet implemented - assert this is done on scene */
-    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", false);
 
     /* Mark all objects up the hierarchy as visited */
     auto it = objects.begin();
@@ -244,7 +406,7 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
 
         /* If this is root object, remove from list */
         if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
+            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", false);
             it = objects.erase(it);
 
         /* Parent is an joint or already visited - remove current from list */
@@ -255,7 +417,7 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
                list of joint objects */
             if(!(parent->flags & Flag::Joint)) {
                 CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
+                               "SceneGraph::Object::transformations(): too large scene", false);
                 CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
                 parent->counter = UnsignedShort(jointObjects.size());
                 parent->flags |= Flag::Joint;
@@ -270,7 +432,7 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     }
 
     /* Array of absolute transformations in joints */
-    std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
+    jointTransformations.assign(jointObjects.size(), typename Transformation::DataType{});
 
     /* Compute transformations for all joints */
     for(std::size_t i = 0; i != jointTransformations.size(); ++i)
@@ -292,9 +454,9 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
         i.get().counter = 0xFFFFu;
     }
 
-    /* Shrink the array to contain only transformations of requested objects and return */
-    jointTransformations.resize(objectCount);
-    return jointTransformations;
+    /* The first objectCount items now contain transformations of requested
+       objects */
+    return true;
 }
 
 template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const {
@@ -414,7 +576,8 @@ template<class Transformation> void Object<Transformation>::setCleanInternal(con
     }
 
     /* Mark object as clean */
-    flags &= ~Flag::Dirty;
+    cleanGeneration = Implementation::nextObjectGeneration();
+    flags &= ~(Flag::Notified|Flag::Dirty);
 }
 
 }}
@@ -0,0 +1,352 @@
+#ifndef Magnum_SceneGraph_OcclusionCulling_h
+#define Magnum_SceneGraph_OcclusionCulling_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicOcclusionCulling3D, typedef @ref Magnum::SceneGraph::OcclusionCulling3D
+ */
+
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Base for occlusion culling of three-dimensional scenes
+
+Skips drawing of drawables that were hidden behind other geometry in previous
+frames, based on results of occlusion queries. Most useful for indoor and
+urban scenes where large parts of the scene are occluded most of the time.
+
+@section SceneGraph-OcclusionCulling-usage Usage
+
+The scene graph doesn't touch any GPU state, so the queries are issued
+through virtual functions. Subclass and implement @ref doBeginQuery(),
+@ref doEndQuery() and @ref doQueryResult() on top of numbered queries and
+@ref doDrawProxy() for drawing an occlusion proxy --- an unit cube
+@f$ [-1; 1]^3 @f$ transformed with given matrix into the drawable bounding
+box. With OpenGL that's @ref GL::SampleQuery using
+@ref GL::SampleQuery::Target::AnySamplesPassedConservative and a
+@ref Primitives::cubeSolid() mesh drawn with a @ref Shaders::Flat3D with
+@ref Shaders::Flat3D::Flag::DepthOnly:
+
+@code{.cpp}
+class OcclusionCulling: public SceneGraph::OcclusionCulling3D {
+    void doBeginQuery(UnsignedInt id) override {
+        while(_queries.size() <= id) _queries.emplace_back(
+            GL::SampleQuery::Target::AnySamplesPassedConservative);
+        _queries[id].begin();
+    }
+    void doEndQuery(UnsignedInt id) override { _queries[id].end(); }
+    bool doQueryResult(UnsignedInt id, bool& visible) override {
+        if(!_queries[id].resultAvailable()) return false;
+        visible = _queries[id].result<bool>();
+        return true;
+    }
+
+    void doBeginProxies() override {
+        GL::Renderer::setColorMask(false, false, false, false);
+        GL::Renderer::setDepthMask(false);
+        GL::Renderer::disable(GL::Renderer::Feature::FaceCulling);
+    }
+    void doDrawProxy(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) override {
+        _proxyShader.setTransformationProjectionMatrix(
+            camera.projectionMatrix()*transformationMatrix);
+        _cube.draw(_proxyShader);
+    }
+    void doEndProxies() override {
+        GL::Renderer::setColorMask(true, true, true, true);
+        GL::Renderer::setDepthMask(true);
+        GL::Renderer::enable(GL::Renderer::Feature::FaceCulling);
+    }
+
+    std::vector<GL::SampleQuery> _queries;
+    GL::Mesh _cube = MeshTools::compile(Primitives::cubeSolid());
+    Shaders::Flat3D _proxyShader{Shaders::Flat3D::Flag::DepthOnly};
+};
+
+OcclusionCulling culling;
+
+// every frame
+culling.draw(camera, drawables);
+@endcode
+
+Only drawables that have a bounding volume set are culled (see
+@ref SceneGraph-Drawable-culling), the others are always drawn. Frustum
+culling is applied first if enabled on the camera.
+
+@section SceneGraph-OcclusionCulling-coherence Temporal coherence
+
+To avoid stalling on query results, @ref draw() never waits for them and
+uses the last known visibility instead. Drawables that were visible are drawn
+right away and every @ref visibleTestInterval() frames their actual geometry
+is drawn inside a query, which costs nothing extra. The tests are spread over
+the frames to avoid spikes. Once a query says the drawable is hidden, it gets
+skipped and instead its proxy is drawn inside a query every frame ---
+after all visible drawables, so their depth is already in the depth buffer,
+wrapped in @ref doBeginProxies() and @ref doEndProxies() so the state
+changes are done just once. The proxies are expected to be drawn with depth
+test enabled, but without writing depth or color.
+
+Because the results arrive with a delay, a drawable that becomes visible again
+is drawn only a frame or two later. With @ref setConditionalRendering()
+enabled, hidden drawables are additionally drawn right after the proxies
+with @ref doBeginConditionalDraw() and @ref doEndConditionalDraw() around,
+using the latest proxy query,
+which is meant to be implemented using @ref GL::SampleQuery::beginConditionalRender()
+with @ref GL::SampleQuery::ConditionalRenderMode::NoWait --- the GPU then
+skips the draw if the proxy turned out to be hidden, without the CPU having
+to wait. Drawables the camera is inside of are always drawn, as their proxy
+would get clipped by the near plane.
+
+Drawables that are not in the group anymore are forgotten the next time
+@ref draw() is called with it, so one instance should be used with just a
+single group. Call @ref reset() after camera cuts, when the previous
+visibility doesn't say anything about the current frame.
+
+@section SceneGraph-OcclusionCulling-explicit-specializations Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref OcclusionCulling.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref OcclusionCulling3D
+
+@see @ref scenegraph, @ref OcclusionCulling3D
+*/
+template<class T> class BasicOcclusionCulling3D {
+    public:
+        /** @brief Constructor */
+        explicit BasicOcclusionCulling3D();
+
+        /** @brief Copying is not allowed */
+        BasicOcclusionCulling3D(const BasicOcclusionCulling3D<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        BasicOcclusionCulling3D(BasicOcclusionCulling3D<T>&&) = delete;
+
+        virtual ~BasicOcclusionCulling3D();
+
+        /** @brief Copying is not allowed */
+        BasicOcclusionCulling3D<T>& operator=(const BasicOcclusionCulling3D<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        BasicOcclusionCulling3D<T>& operator=(BasicOcclusionCulling3D<T>&&) = delete;
+
+        /**
+         * @brief Test interval for visible drawables
+         *
+         * @see @ref setVisibleTestInterval()
+         */
+        UnsignedInt visibleTestInterval() const { return _visibleTestInterval; }
+
+        /**
+         * @brief Set test interval for visible drawables
+         * @return Reference to self (for method chaining)
+         *
+         * Count of frames after which a visible drawable is tested again.
+         * Lower values detect occlusion sooner at the cost of more queries.
+         * Expects a non-zero value, default is @cpp 4 @ce. Hidden drawables
+         * are tested every frame.
+         */
+        BasicOcclusionCulling3D<T>& setVisibleTestInterval(UnsignedInt interval);
+
+        /**
+         * @brief Whether conditional rendering is enabled
+         *
+         * @see @ref setConditionalRendering()
+         */
+        bool isConditionalRenderingEnabled() const { return _conditionalRendering; }
+
+        /**
+         * @brief Enable or disable conditional rendering
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, hidden drawables are drawn right after their proxies
+         * inside @ref doBeginConditionalDraw() and
+         * @ref doEndConditionalDraw(). Disabled by default. See
+         * @ref SceneGraph-OcclusionCulling-coherence for more information.
+         */
+        BasicOcclusionCulling3D<T>& setConditionalRendering(bool enabled) {
+            _conditionalRendering = enabled;
+            return *this;
+        }
+
+        /**
+         * @brief Count of drawables drawn in last frame
+         *
+         * Including drawables drawn conditionally, for which it's not known
+         * whether the GPU actually drew them.
+         */
+        std::size_t drawnCount() const { return _drawnCount; }
+
+        /**
+         * @brief Count of drawables skipped due to occlusion in last frame
+         *
+         * Doesn't include drawables culled by the camera frustum.
+         */
+        std::size_t occludedCount() const { return _occludedCount; }
+
+        /** @brief Count of queries issued in last frame */
+        std::size_t queryCount() const { return _queryCount; }
+
+        /**
+         * @brief Forget all visibility information
+         *
+         * All drawables are treated as visible in the next frame. Results of
+         * queries that are still pending are ignored.
+         */
+        void reset();
+
+        /**
+         * @brief Draw a drawable group
+         *
+         * Calculates transformations of all drawables in @p group relative
+         * to @p camera, draws the ones that are not known to be occluded and
+         * issues the queries. See @ref SceneGraph-OcclusionCulling-coherence
+         * for more information.
+         */
+        void draw(Camera<3, T>& camera, DrawableGroup<3, T>& group);
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    private:
+    #else
+    protected:
+    #endif
+        /**
+         * @brief Begin a query
+         *
+         * The @p id is the same for a particular drawable as long as it's in
+         * the group and the ids are allocated contiguously from zero, so the
+         * implementation can keep the queries in an array. Fragments drawn
+         * until @ref doEndQuery() are counted into the query.
+         */
+        virtual void doBeginQuery(UnsignedInt id) = 0;
+
+        /** @brief End a query */
+        virtual void doEndQuery(UnsignedInt id) = 0;
+
+        /**
+         * @brief Query result
+         *
+         * If result of query @p id is available, save whether any fragments
+         * passed the depth test into @p visible and return @cpp true @ce.
+         * Otherwise return @cpp false @ce. Expected to not wait for the
+         * result. Called only for queries that were ended before.
+         */
+        virtual bool doQueryResult(UnsignedInt id, bool& visible) = 0;
+
+        /**
+         * @brief Begin drawing proxies
+         *
+         * Called before the first @ref doDrawProxy() in a frame, meant for
+         * disabling depth and color writes. Default implementation does
+         * nothing.
+         */
+        virtual void doBeginProxies();
+
+        /**
+         * @brief Draw a proxy
+         * @param transformationMatrix  Transformation of an unit cube
+         *      @f$ [-1; 1]^3 @f$ into the drawable bounding box, relative to
+         *      camera
+         * @param camera                Camera
+         */
+        virtual void doDrawProxy(const Math::Matrix4<T>& transformationMatrix, Camera<3, T>& camera) = 0;
+
+        /**
+         * @brief End drawing proxies
+         *
+         * Called after the last @ref doDrawProxy() in a frame, meant for
+         * restoring the state changed in @ref doBeginProxies(). Default
+         * implementation does nothing.
+         */
+        virtual void doEndProxies();
+
+        /**
+         * @brief Begin a conditional draw
+         *
+         * Called with @ref setConditionalRendering() enabled before drawing
+         * a hidden drawable whose proxy was drawn inside query @p id in this
+         * or one of the previous frames.
+         * Default implementation does nothing, which means the drawable gets
+         * always drawn.
+         */
+        virtual void doBeginConditionalDraw(UnsignedInt id);
+
+        /**
+         * @brief End a conditional draw
+         *
+         * Default implementation does nothing.
+         */
+        virtual void doEndConditionalDraw();
+
+    private:
+        struct Item {
+            UnsignedInt query;
+            UnsignedInt lastTested;
+            UnsignedInt lastSeen;
+            bool visible;
+            bool pending;
+        };
+
+        struct Occluded {
+            Drawable<3, T>* drawable;
+            Item* item;
+            std::size_t transformation;
+        };
+
+        Item& item(Drawable<3, T>& drawable);
+
+        UnsignedInt _visibleTestInterval, _frame, _queryIdCount;
+        bool _conditionalRendering;
+        std::size_t _drawnCount, _occludedCount, _queryCount;
+        DrawableTransformations<3, T> _transformations;
+        std::unordered_map<Drawable<3, T>*, Item> _items;
+        std::vector<UnsignedInt> _freeQueryIds;
+        std::vector<Occluded> _occluded;
+};
+
+/**
+@brief Base for occlusion culling of three-dimensional float scenes
+
+@see @ref BasicOcclusionCulling3D
+*/
+typedef BasicOcclusionCulling3D<Float> OcclusionCulling3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicOcclusionCulling3D<Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef Magnum_SceneGraph_OcclusionCulling_hpp
+#define Magnum_SceneGraph_OcclusionCulling_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref OcclusionCulling.h
+ */
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/SceneGraph/Camera.hpp"
+#include "Magnum/SceneGraph/OcclusionCulling.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class T> BasicOcclusionCulling3D<T>::BasicOcclusionCulling3D(): _visibleTestInterval{4}, _frame{}, _queryIdCount{}, _conditionalRendering{}, _drawnCount{}, _occludedCount{}, _queryCount{} {}
+
+template<class T> BasicOcclusionCulling3D<T>::~BasicOcclusionCulling3D() = default;
+
+template<class T> BasicOcclusionCulling3D<T>& BasicOcclusionCulling3D<T>::setVisibleTestInterval(const UnsignedInt interval) {
+    CORRADE_ASSERT(interval,
+        "SceneGraph::OcclusionCulling::setVisibleTestInterval(): expected a non-zero interval", *this);
+    _visibleTestInterval = interval;
+    return *this;
+}
+
+template<class T> void BasicOcclusionCulling3D<T>::reset() {
+    for(auto& item: _items) {
+        item.second.visible = true;
+        item.second.pending = false;
+    }
+}
+
+template<class T> auto BasicOcclusionCulling3D<T>::item(Drawable<3, T>& drawable) -> Item& {
+    auto found = _items.find(&drawable);
+    if(found != _items.end()) return found->second;
+
+    UnsignedInt query;
+    if(_freeQueryIds.empty()) query = _queryIdCount++;
+    else {
+        query = _freeQueryIds.back();
+        _freeQueryIds.pop_back();
+    }
+
+    /* New drawables are assumed to be visible. Offset the first test based
+       on the id so the tests of drawables added at the same time are spread
+       over multiple frames. */
+    return _items.emplace(&drawable, Item{query,
+        _frame + query%_visibleTestInterval - _visibleTestInterval,
+        _frame, true, false}).first->second;
+}
+
+template<class T> void BasicOcclusionCulling3D<T>::draw(Camera<3, T>& camera, DrawableGroup<3, T>& group) {
+    ++_frame;
+    _drawnCount = _occludedCount = _queryCount = 0;
+    _occluded.clear();
+
+    camera.drawableTransformations(group, _transformations);
+    const Containers::ArrayView<const Math::Matrix4<T>> transformations = _transformations.transformations();
+
+    /* Draw everything that's known to be visible first, so the proxies are
+       tested against a depth buffer that's as complete as possible */
+    std::size_t seenCount = 0;
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        Drawable<3, T>& drawable = group[i];
+        const Math::Matrix4<T>& transformation = transformations[i];
+        if(camera.frustumCulling() && !camera.isVisible(drawable, transformation))
+            continue;
+
+        /* Drawables without bounding volume are never culled */
+        if(drawable.boundingVolume() == DrawableBoundingVolume::None) {
+            drawable.draw(transformation, camera);
+            ++_drawnCount;
+            continue;
+        }
+
+        Item& item = this->item(drawable);
+        item.lastSeen = _frame;
+        ++seenCount;
+
+        /* Update the visibility if the result arrived already, don't wait
+           for it otherwise */
+        bool visible;
+        if(item.pending && doQueryResult(item.query, visible)) {
+            item.visible = visible;
+            item.pending = false;
+        }
+
+        /* If the camera is inside the bounding box, the proxy would get
+           clipped by the near plane and reported as hidden */
+        if(Implementation::transformedBoundingBox<3, T>(transformation, drawable.boundingBox()).contains(Math::Vector3<T>{})) {
+            item.visible = true;
+            drawable.draw(transformation, camera);
+            ++_drawnCount;
+            continue;
+        }
+
+        if(!item.visible) {
+            _occluded.push_back({&drawable, &item, i});
+            continue;
+        }
+
+        /* Test the visible drawables by drawing the actual geometry inside
+           the query once in a while */
+        const bool test = !item.pending && _frame - item.lastTested >= _visibleTestInterval;
+        if(test) doBeginQuery(item.query);
+        drawable.draw(transformation, camera);
+        if(test) {
+            doEndQuery(item.query);
+            item.pending = true;
+            item.lastTested = _frame;
+            ++_queryCount;
+        }
+        ++_drawnCount;
+    }
+
+    /* Test the hidden drawables using their proxies */
+    if(!_occluded.empty()) {
+        bool proxiesBegun = false;
+        for(const Occluded& occluded: _occluded) {
+            /* The proxy query from earlier frames is still in flight, which
+               is fine to use for the conditional draw below as well */
+            if(occluded.item->pending) continue;
+
+            if(!proxiesBegun) {
+                doBeginProxies();
+                proxiesBegun = true;
+            }
+
+            const Math::Range3D<T> box = occluded.drawable->boundingBox();
+            doBeginQuery(occluded.item->query);
+            doDrawProxy(transformations[occluded.transformation]*
+                Math::Matrix4<T>::translation(box.center())*
+                Math::Matrix4<T>::scaling(box.size()*T(0.5)), camera);
+            doEndQuery(occluded.item->query);
+            occluded.item->pending = true;
+            occluded.item->lastTested = _frame;
+            ++_queryCount;
+        }
+        if(proxiesBegun) doEndProxies();
+
+        if(!_conditionalRendering) _occludedCount = _occluded.size();
+        else for(const Occluded& occluded: _occluded) {
+            doBeginConditionalDraw(occluded.item->query);
+            occluded.drawable->draw(transformations[occluded.transformation], camera);
+            doEndConditionalDraw();
+            ++_drawnCount;
+        }
+    }
+
+    /* Forget drawables that are not in the group anymore and reuse their
+       query ids. Only the pointer is used as a key, so this is safe even if
+       the drawable got destroyed. */
+    if(seenCount != _items.size()) for(auto it = _items.begin(); it != _items.end(); ) {
+        if(it->second.lastSeen != _frame) {
+            _freeQueryIds.push_back(it->second.query);
+            it = _items.erase(it);
+        } else ++it;
+    }
+}
+
+template<class T> void BasicOcclusionCulling3D<T>::doBeginProxies() {}
+
+template<class T> void BasicOcclusionCulling3D<T>::doEndProxies() {}
+
+template<class T> void BasicOcclusionCulling3D<T>::doBeginConditionalDraw(UnsignedInt) {}
+
+template<class T> void BasicOcclusionCulling3D<T>::doEndConditionalDraw() {}
+
+}}
+
+#endif
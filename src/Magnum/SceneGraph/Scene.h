@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::Scene
  */
 
+#include <atomic>
+
 #include "Magnum/SceneGraph/Object.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -46,13 +48,35 @@ e.g.:
 @snippet MagnumSceneGraph.cpp Object-typedef
 
 See @ref scenegraph for an introduction.
+
+@section SceneGraph-Scene-concurrency Concurrent access
+
+Computing transformations of many objects at once through
+@ref Object::transformations() or @ref Object::transformationMatrices()
+temporarily marks the objects and uses scratch memory stored in the scene, so
+these functions must not be called concurrently or recursively on the same
+scene even though they're @cpp const @ce. Independent scenes can be processed
+from different threads. Calls that overlap on the same scene, either
+recursively or from different threads, are caught by an assertion.
 */
 template<class Transformation> class Scene: public Object<Transformation> {
     public:
         explicit Scene() = default;
 
     private:
+        #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        friend Object<Transformation>;
+        #endif
+
         bool isScene() const override final { return true; }
+
+        /* Scratch memory used by Object::transformationMatrices() with
+           external storage, kept here so it's reused between calls. It's
+           shared by all calls on the scene, _scratchUsed is atomically set
+           while a call is using it to catch concurrent or nested calls. */
+        mutable std::vector<std::reference_wrapper<Object<Transformation>>> _objectScratch, _jointObjectScratch;
+        mutable std::vector<typename Transformation::DataType> _jointTransformationScratch;
+        mutable std::atomic<bool> _scratchUsed{false};
 };
 
 }}
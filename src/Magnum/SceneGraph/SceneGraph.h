@@ -30,6 +30,7 @@
  */
 
 #include "Magnum/Types.h"
+#include "Magnum/Math/Math.h"
 
 namespace Magnum { namespace SceneGraph {
 
@@ -94,12 +95,32 @@ template<class T> using BasicAnimableGroup3D = AnimableGroup<3, T>;
 typedef BasicAnimableGroup2D<Float> AnimableGroup2D;
 typedef BasicAnimableGroup3D<Float> AnimableGroup3D;
 
+template<UnsignedInt, class> class BoundingVolumeHierarchy;
+template<class T> using BasicBoundingVolumeHierarchy2D = BoundingVolumeHierarchy<2, T>;
+template<class T> using BasicBoundingVolumeHierarchy3D = BoundingVolumeHierarchy<3, T>;
+typedef BasicBoundingVolumeHierarchy2D<Float> BoundingVolumeHierarchy2D;
+typedef BasicBoundingVolumeHierarchy3D<Float> BoundingVolumeHierarchy3D;
+
 template<UnsignedInt, class> class Camera;
 template<class T> using BasicCamera2D = Camera<2, T>;
 template<class T> using BasicCamera3D = Camera<3, T>;
 typedef BasicCamera2D<Float> Camera2D;
 typedef BasicCamera3D<Float> Camera3D;
 
+template<class> class BasicDamageTracker2D;
+typedef BasicDamageTracker2D<Float> DamageTracker2D;
+
+template<UnsignedInt, class> class DrawableTransformations;
+typedef DrawableTransformations<2, Float> DrawableTransformations2D;
+typedef DrawableTransformations<3, Float> DrawableTransformations3D;
+
+template<UnsignedInt, class> class DrawList;
+typedef DrawList<2, Float> DrawList2D;
+typedef DrawList<3, Float> DrawList3D;
+
+enum class DrawOrder: UnsignedByte;
+
+enum class DrawableBoundingVolume: UnsignedByte;
 template<UnsignedInt, class> class Drawable;
 template<class T> using BasicDrawable2D = Drawable<2, T>;
 template<class T> using BasicDrawable3D = Drawable<3, T>;
@@ -117,6 +138,12 @@ template<class Feature, class T> using BasicFeatureGroup3D = FeatureGroup<3, Fea
 template<class Feature> using FeatureGroup2D = BasicFeatureGroup2D<Feature, Float>;
 template<class Feature> using FeatureGroup3D = BasicFeatureGroup3D<Feature, Float>;
 
+template<UnsignedInt, class> class FlatScene;
+template<class T> using BasicFlatScene2D = FlatScene<2, T>;
+template<class T> using BasicFlatScene3D = FlatScene<3, T>;
+typedef BasicFlatScene2D<Float> FlatScene2D;
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
 template<UnsignedInt dimensions, class T> using DrawableGroup = FeatureGroup<dimensions, Drawable<dimensions, T>, T>;
 template<class T> using BasicDrawableGroup2D = DrawableGroup<2, T>;
 template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
@@ -130,6 +157,13 @@ typedef BasicMatrixTransformation3D<Float> MatrixTransformation3D;
 
 template<class Transformation> class Object;
 
+template<class> class BasicOcclusionCulling3D;
+typedef BasicOcclusionCulling3D<Float> OcclusionCulling3D;
+
+template<UnsignedInt, class> class RigidDrawableTransformations;
+typedef RigidDrawableTransformations<2, Float> RigidDrawableTransformations2D;
+typedef RigidDrawableTransformations<3, Float> RigidDrawableTransformations3D;
+
 template<class> class BasicRigidMatrixTransformation2D;
 template<class> class BasicRigidMatrixTransformation3D;
 typedef BasicRigidMatrixTransformation2D<Float> RigidMatrixTransformation2D;
@@ -150,6 +184,15 @@ typedef BasicTranslationRotationScalingTransformation3D<Float> TranslationRotati
 
 namespace Implementation {
     template<class> struct Transformation;
+
+    /* Transformation type passed to Drawable::drawRigid() */
+    template<UnsignedInt, class> struct RigidTransformationTypeFor;
+    template<class T> struct RigidTransformationTypeFor<2, T> {
+        typedef Math::DualComplex<T> Type;
+    };
+    template<class T> struct RigidTransformationTypeFor<3, T> {
+        typedef Math::DualQuaternion<T> Type;
+    };
 }
 #endif
 
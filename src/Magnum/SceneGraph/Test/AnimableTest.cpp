@@ -22,8 +22,9 @@
     FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
     DEALINGS IN THE SOFTWARE.
 */
-
+#include <memory>
 #include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/SceneGraph/Animable.h"
@@ -37,12 +38,17 @@ struct AnimableTest: TestSuite::Tester {
 
     void state();
     void step();
+    void stepMultithreaded();
+    void stepMultithreadedMixed();
+    void stepSleeping();
     void duration();
     void repeat();
     void stop();
     void pause();
 
     void deleteWhileRunning();
+    void deleteAwake();
+    void deleteDuringStep();
 
     void debug();
 };
@@ -52,12 +58,17 @@ typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
 AnimableTest::AnimableTest() {
     addTests({&AnimableTest::state,
               &AnimableTest::step,
+              &AnimableTest::stepMultithreaded,
+              &AnimableTest::stepMultithreadedMixed,
+              &AnimableTest::stepSleeping,
               &AnimableTest::duration,
               &AnimableTest::repeat,
               &AnimableTest::stop,
               &AnimableTest::pause,
 
               &AnimableTest::deleteWhileRunning,
+              &AnimableTest::deleteAwake,
+              &AnimableTest::deleteDuringStep,
 
               &AnimableTest::debug});
 }
@@ -218,6 +229,139 @@ void AnimableTest::step() {
     CORRADE_COMPARE(animable.delta, 0.75f);
 }
 
+void AnimableTest::stepMultithreaded() {
+    class InifiniteAnimable: public SceneGraph::Animable3D {
+        public:
+            InifiniteAnimable(AbstractObject3D& object, AnimableGroup3D* group = nullptr): SceneGraph::Animable3D(object, group), time(-1.0f), delta(0.0f) {}
+
+            Float time, delta;
+
+        protected:
+            void animationStep(Float t, Float d) override {
+                time = t;
+                delta = d;
+            }
+    };
+
+    Object3D object;
+    AnimableGroup3D group;
+    group.setThreadCount(0);
+    CORRADE_COMPARE(group.threadCount(), 1);
+    group.setThreadCount(3);
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_COMPARE(group.threadCount(), 3);
+    #else
+    CORRADE_COMPARE(group.threadCount(), 1);
+    #endif
+
+    /* Not a multiple of thread and task count to test uneven distribution */
+    std::vector<std::unique_ptr<InifiniteAnimable>> animables;
+    for(std::size_t i = 0; i != AnimableGroup3D::ParallelStepThreshold*3 + 7; ++i) {
+        animables.emplace_back(new InifiniteAnimable{object, &group});
+        animables.back()->setConcurrent(true);
+    }
+
+    /* Start every other animation a frame later */
+    for(std::size_t i = 0; i < animables.size(); i += 2)
+        animables[i]->setState(AnimationState::Running);
+    group.step(5.0f, 0.5f);
+    for(std::size_t i = 1; i < animables.size(); i += 2)
+        animables[i]->setState(AnimationState::Running);
+    group.step(8.0f, 0.75f);
+    CORRADE_COMPARE(group.runningCount(), animables.size());
+
+    for(std::size_t i = 0; i != animables.size(); ++i) {
+        CORRADE_COMPARE(animables[i]->time, i%2 ? 0.0f : 3.0f);
+        CORRADE_COMPARE(animables[i]->delta, 0.75f);
+    }
+}
+
+void AnimableTest::stepMultithreadedMixed() {
+    class InifiniteAnimable: public SceneGraph::Animable3D {
+        public:
+            InifiniteAnimable(AbstractObject3D& object, AnimableGroup3D* group = nullptr): SceneGraph::Animable3D(object, group), time(-1.0f), delta(0.0f) {}
+
+            Float time, delta;
+
+        protected:
+            void animationStep(Float t, Float d) override {
+                time = t;
+                delta = d;
+            }
+    };
+
+    Object3D object;
+    AnimableGroup3D group;
+    group.setThreadCount(3);
+
+    /* Only every third animable is allowed to run on a worker thread, the
+       rest has to be stepped on the calling thread */
+    std::vector<std::unique_ptr<InifiniteAnimable>> animables;
+    for(std::size_t i = 0; i != AnimableGroup3D::ParallelStepThreshold*3 + 7; ++i) {
+        animables.emplace_back(new InifiniteAnimable{object, &group});
+        animables.back()->setConcurrent(i%3 == 0);
+    }
+    CORRADE_VERIFY(animables[0]->isConcurrent());
+    CORRADE_VERIFY(!animables[1]->isConcurrent());
+
+    for(auto& animable: animables)
+        animable->setState(AnimationState::Running);
+    group.step(5.0f, 0.5f);
+    group.step(8.0f, 0.75f);
+    CORRADE_COMPARE(group.runningCount(), animables.size());
+
+    for(std::size_t i = 0; i != animables.size(); ++i) {
+        CORRADE_COMPARE(animables[i]->time, 3.0f);
+        CORRADE_COMPARE(animables[i]->delta, 0.75f);
+    }
+}
+
+void AnimableTest::stepSleeping() {
+    class CountingAnimable: public SceneGraph::Animable3D {
+        public:
+            CountingAnimable(AbstractObject3D& object, AnimableGroup3D* group = nullptr): SceneGraph::Animable3D(object, group), steps(0) {}
+
+            Int steps;
+
+        protected:
+            void animationStep(Float, Float) override { ++steps; }
+    };
+
+    Object3D object;
+    AnimableGroup3D group;
+    CountingAnimable a(object, &group);
+    CountingAnimable b(object, &group);
+
+    /* Stopped animables are not touched at all */
+    a.setState(AnimationState::Running);
+    group.step(1.0f, 0.5f);
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 1);
+    CORRADE_COMPARE(a.steps, 2);
+    CORRADE_COMPARE(b.steps, 0);
+
+    /* Putting it to sleep and waking it up again */
+    a.setState(AnimationState::Paused);
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 0);
+    CORRADE_COMPARE(a.steps, 2);
+
+    a.setState(AnimationState::Running);
+    b.setState(AnimationState::Running);
+    group.step(2.5f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 2);
+    CORRADE_COMPARE(a.steps, 3);
+    CORRADE_COMPARE(b.steps, 1);
+
+    /* Setting the state repeatedly doesn't step the animable more than once */
+    b.setState(AnimationState::Paused);
+    b.setState(AnimationState::Running);
+    group.step(3.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 2);
+    CORRADE_COMPARE(a.steps, 4);
+    CORRADE_COMPARE(b.steps, 2);
+}
+
 void AnimableTest::duration() {
     Object3D object;
     AnimableGroup3D group;
@@ -377,6 +521,88 @@ void AnimableTest::deleteWhileRunning() {
     CORRADE_COMPARE(group.runningCount(), 0);
 }
 
+namespace {
+    class CountingAnimable: public SceneGraph::Animable3D {
+        public:
+            CountingAnimable(AbstractObject3D& object, AnimableGroup3D* group = nullptr): SceneGraph::Animable3D(object, group), steps(0) {}
+
+            Int steps;
+            std::unique_ptr<CountingAnimable> deleteOnStep;
+
+        protected:
+            void animationStep(Float, Float) override {
+                ++steps;
+                deleteOnStep = nullptr;
+            }
+    };
+}
+
+void AnimableTest::deleteAwake() {
+    Object3D object;
+    AnimableGroup3D group;
+    CountingAnimable a(object, &group);
+    CountingAnimable c(object, &group);
+    std::unique_ptr<CountingAnimable> b{new CountingAnimable{object, &group}};
+    CountingAnimable d(object, &group);
+
+    a.setState(AnimationState::Running);
+    b->setState(AnimationState::Running);
+    c.setState(AnimationState::Running);
+    d.setState(AnimationState::Running);
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 4);
+
+    /* Deleting an awake animable from the middle of the list moves the last
+       one in its place, which then still gets stepped */
+    b = nullptr;
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 3);
+    CORRADE_COMPARE(a.steps, 2);
+    CORRADE_COMPARE(c.steps, 2);
+    CORRADE_COMPARE(d.steps, 2);
+
+    /* Putting an animable to sleep and deleting another before the next step
+       works too */
+    std::unique_ptr<CountingAnimable> e{new CountingAnimable{object, &group}};
+    e->setState(AnimationState::Running);
+    a.setState(AnimationState::Paused);
+    e = nullptr;
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 2);
+    CORRADE_COMPARE(a.steps, 2);
+    CORRADE_COMPARE(c.steps, 3);
+    CORRADE_COMPARE(d.steps, 3);
+}
+
+void AnimableTest::deleteDuringStep() {
+    Object3D object;
+    AnimableGroup3D group;
+    CountingAnimable a(object, &group);
+    CountingAnimable c(object, &group);
+    a.deleteOnStep.reset(new CountingAnimable{object, &group});
+    c.deleteOnStep.reset(new CountingAnimable{object, &group});
+    CountingAnimable& b = *a.deleteOnStep;
+
+    /* The first animable deletes one that would be started after it, the
+       second one deletes one that was already started and stepped */
+    a.setState(AnimationState::Running);
+    b.setState(AnimationState::Running);
+    c.deleteOnStep->setState(AnimationState::Running);
+    c.setState(AnimationState::Running);
+    group.step(1.0f, 0.5f);
+    CORRADE_VERIFY(!a.deleteOnStep);
+    CORRADE_VERIFY(!c.deleteOnStep);
+    CORRADE_COMPARE(group.runningCount(), 2);
+    CORRADE_COMPARE(a.steps, 1);
+    CORRADE_COMPARE(c.steps, 1);
+
+    /* The holes left in the list are gone */
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 2);
+    CORRADE_COMPARE(a.steps, 2);
+    CORRADE_COMPARE(c.steps, 2);
+}
+
 void AnimableTest::debug() {
     std::ostringstream o;
     Debug(&o) << AnimationState::Running << AnimationState(0xbe);
@@ -0,0 +1,555 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/BoundingVolumeHierarchy.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct BoundingVolumeHierarchyTest: TestSuite::Tester {
+    explicit BoundingVolumeHierarchyTest();
+
+    void construct();
+    void build();
+    void buildEmpty();
+    void draw();
+    void draw2D();
+    void refit();
+    void refitParent();
+    void refitBoundingVolume();
+    void refitDrawableOverridesMarkDirty();
+    void noBoundingVolume();
+    void changeBoundingVolumeNone();
+    void addDrawable();
+    void removeDrawable();
+    void destroyDrawable();
+    void destroyHierarchy();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+BoundingVolumeHierarchyTest::BoundingVolumeHierarchyTest() {
+    addTests({&BoundingVolumeHierarchyTest::construct,
+              &BoundingVolumeHierarchyTest::build,
+              &BoundingVolumeHierarchyTest::buildEmpty,
+              &BoundingVolumeHierarchyTest::draw,
+              &BoundingVolumeHierarchyTest::draw2D,
+              &BoundingVolumeHierarchyTest::refit,
+              &BoundingVolumeHierarchyTest::refitParent,
+              &BoundingVolumeHierarchyTest::refitBoundingVolume,
+              &BoundingVolumeHierarchyTest::refitDrawableOverridesMarkDirty,
+              &BoundingVolumeHierarchyTest::noBoundingVolume,
+              &BoundingVolumeHierarchyTest::changeBoundingVolumeNone,
+              &BoundingVolumeHierarchyTest::addDrawable,
+              &BoundingVolumeHierarchyTest::removeDrawable,
+              &BoundingVolumeHierarchyTest::destroyDrawable,
+              &BoundingVolumeHierarchyTest::destroyHierarchy});
+}
+
+template<UnsignedInt dimensions> class CountingDrawable: public SceneGraph::Drawable<dimensions, Float> {
+    public:
+        CountingDrawable(AbstractObject<dimensions, Float>& object, DrawableGroup<dimensions, Float>* group, std::vector<CountingDrawable<dimensions>*>& drawn): SceneGraph::Drawable<dimensions, Float>(object, group), drawn(drawn) {}
+
+    protected:
+        void draw(const MatrixTypeFor<dimensions, Float>&, Camera<dimensions, Float>&) override {
+            drawn.push_back(this);
+        }
+
+    private:
+        std::vector<CountingDrawable<dimensions>*>& drawn;
+};
+
+typedef CountingDrawable<3> Drawable;
+
+namespace {
+
+/* A 20x20 grid of unit cubes on the XZ plane in front of the camera */
+void populate(Scene3D& scene, DrawableGroup3D& group, std::vector<Drawable*>& drawn) {
+    for(Int i = 0; i != 20; ++i) for(Int j = 0; j != 20; ++j) {
+        Object3D* object = new Object3D{&scene};
+        object->translate({i*5.0f - 50.0f, 0.0f, -j*5.0f - 5.0f});
+        (new Drawable{*object, &group, drawn})->setBoundingBox(Range3D::fromCenter({}, Vector3{1.0f}));
+    }
+}
+
+std::vector<Drawable*> sorted(std::vector<Drawable*> drawn) {
+    std::sort(drawn.begin(), drawn.end());
+    return drawn;
+}
+
+}
+
+void BoundingVolumeHierarchyTest::construct() {
+    DrawableGroup3D group;
+    BoundingVolumeHierarchy3D hierarchy{group};
+
+    CORRADE_COMPARE(&hierarchy.drawables(), &group);
+    CORRADE_COMPARE(hierarchy.size(), 0);
+    CORRADE_COMPARE(hierarchy.nodeCount(), 0);
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 0);
+    CORRADE_COMPARE(hierarchy.bounds(), Range3D{});
+}
+
+void BoundingVolumeHierarchyTest::build() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+    populate(scene, group, drawn);
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+
+    CORRADE_COMPARE(hierarchy.size(), 400);
+    CORRADE_VERIFY(hierarchy.nodeCount() >= 2*400/BoundingVolumeHierarchy3D::LeafSize - 1);
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 0);
+    CORRADE_COMPARE(hierarchy.bounds(), (Range3D{{-51.0f, -1.0f, -101.0f}, {46.0f, 1.0f, -4.0f}}));
+
+    /* Building again gives the same result */
+    const std::size_t nodeCount = hierarchy.nodeCount();
+    hierarchy.build();
+    CORRADE_COMPARE(hierarchy.size(), 400);
+    CORRADE_COMPARE(hierarchy.nodeCount(), nodeCount);
+}
+
+void BoundingVolumeHierarchyTest::buildEmpty() {
+    DrawableGroup3D group;
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+
+    CORRADE_COMPARE(hierarchy.size(), 0);
+    CORRADE_COMPARE(hierarchy.nodeCount(), 0);
+
+    Scene3D scene;
+    Camera3D camera{scene};
+    camera.draw(hierarchy);
+}
+
+void BoundingVolumeHierarchyTest::draw() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+    populate(scene, group, drawn);
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f))
+        .setFrustumCulling(true);
+
+    /* Linear culling as a reference */
+    camera.draw(group);
+    const std::vector<Drawable*> expected = sorted(drawn);
+    CORRADE_VERIFY(!expected.empty());
+    CORRADE_VERIFY(expected.size() < 400);
+
+    drawn.clear();
+    camera.draw(hierarchy);
+    CORRADE_COMPARE(sorted(drawn), expected);
+
+    /* Turn the camera around so nothing is visible */
+    drawn.clear();
+    cameraObject.rotateY(Deg(180.0f));
+    camera.draw(hierarchy);
+    CORRADE_VERIFY(drawn.empty());
+
+    /* Transformations are relative to the camera */
+    cameraObject.resetTransformation()
+        .translate(Vector3::yAxis(2.0f));
+    std::vector<std::pair<std::reference_wrapper<SceneGraph::Drawable3D>, Matrix4>> transformations;
+    hierarchy.drawableTransformations(camera, transformations);
+    CORRADE_COMPARE(transformations.size(), expected.size());
+    for(auto& t: transformations)
+        CORRADE_COMPARE(t.second.translation().y(), -2.0f);
+}
+
+void BoundingVolumeHierarchyTest::draw2D() {
+    std::vector<CountingDrawable<2>*> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+
+    std::vector<CountingDrawable<2>*> expected;
+    for(Int i = 0; i != 50; ++i) {
+        Object2D* object = new Object2D{&scene};
+        object->translate(Vector2::xAxis(i*1.0f));
+        auto drawable = new CountingDrawable<2>{*object, &group, drawn};
+        drawable->setBoundingBox(Range2D::fromCenter({}, Vector2{0.25f}));
+        if(i <= 10) expected.push_back(drawable);
+    }
+
+    BoundingVolumeHierarchy2D hierarchy{group};
+    hierarchy.build();
+    CORRADE_COMPARE(hierarchy.bounds(), (Range2D{{-0.25f, -0.25f}, {49.25f, 0.25f}}));
+
+    Camera2D camera{scene};
+    camera.setProjectionMatrix(Matrix3::projection({20.0f, 20.0f}));
+    camera.draw(hierarchy);
+    std::sort(drawn.begin(), drawn.end());
+    std::sort(expected.begin(), expected.end());
+    CORRADE_COMPARE(drawn, expected);
+}
+
+void BoundingVolumeHierarchyTest::refit() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    auto da = new Drawable{a, &group, drawn};
+    da->setBoundingSphere({}, 1.0f);
+
+    Object3D b{&scene};
+    b.translate({-100.0f, 0.0f, -5.0f});
+    auto db = new Drawable{b, &group, drawn};
+    db->setBoundingSphere({}, 1.0f);
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+    CORRADE_COMPARE(hierarchy.bounds(), (Range3D{{-101.0f, -1.0f, -6.0f}, {1.0f, 1.0f, -4.0f}}));
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    camera.draw(hierarchy);
+    CORRADE_COMPARE(drawn, std::vector<Drawable*>{da});
+
+    /* Moving an object marks only its drawable dirty */
+    b.translate(Vector3::xAxis(100.0f));
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 1);
+
+    /* Moving it again doesn't add it twice */
+    b.translate(Vector3::zAxis(-1.0f));
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 1);
+
+    hierarchy.refit();
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 0);
+    CORRADE_COMPARE(hierarchy.bounds(), (Range3D{{-1.0f, -1.0f, -7.0f}, {1.0f, 1.0f, -4.0f}}));
+
+    /* Moving the first out of view, drawing refits implicitly */
+    drawn.clear();
+    a.translate(Vector3::zAxis(10.0f));
+    camera.draw(hierarchy);
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 0);
+    CORRADE_COMPARE(drawn, std::vector<Drawable*>{db});
+}
+
+void BoundingVolumeHierarchyTest::refitParent() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D parent{&scene};
+    for(Int i = 0; i != 10; ++i) {
+        Object3D* object = new Object3D{&parent};
+        object->translate(Vector3::xAxis(i*3.0f));
+        (new Drawable{*object, &group, drawn})->setBoundingSphere({}, 1.0f);
+    }
+
+    Object3D other{&scene};
+    (new Drawable{other, &group, drawn})->setBoundingSphere({}, 1.0f);
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+    CORRADE_COMPARE(hierarchy.bounds(), (Range3D{{-1.0f, -1.0f, -1.0f}, {28.0f, 1.0f, 1.0f}}));
+
+    /* All children get marked dirty, but not the other object */
+    parent.translate(Vector3::yAxis(10.0f));
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 10);
+
+    hierarchy.refit();
+    CORRADE_COMPARE(hierarchy.bounds(), (Range3D{{-1.0f, -1.0f, -1.0f}, {28.0f, 11.0f, 1.0f}}));
+}
+
+void BoundingVolumeHierarchyTest::refitBoundingVolume() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    auto da = new Drawable{a, &group, drawn};
+    da->setBoundingSphere({}, 1.0f);
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+    CORRADE_COMPARE(hierarchy.bounds(), (Range3D{{-1.0f, -1.0f, -6.0f}, {1.0f, 1.0f, -4.0f}}));
+
+    da->setBoundingBox({{0.0f, 0.0f, 0.0f}, {2.0f, 3.0f, 4.0f}});
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 1);
+
+    hierarchy.refit();
+    CORRADE_COMPARE(hierarchy.bounds(), (Range3D{{0.0f, 0.0f, -5.0f}, {2.0f, 3.0f, -1.0f}}));
+}
+
+void BoundingVolumeHierarchyTest::refitDrawableOverridesMarkDirty() {
+    struct CachingDrawable: CountingDrawable<3> {
+        explicit CachingDrawable(Object3D& object, DrawableGroup3D& group, std::vector<CountingDrawable<3>*>& drawn): CountingDrawable<3>{object, &group, drawn} {}
+
+        /* Not calling the base implementation */
+        void markDirty() override { ++dirtyCount; }
+        void clean(const Matrix4&) override { ++cleanCount; }
+
+        Int dirtyCount = 0, cleanCount = 0;
+    };
+
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    auto da = new CachingDrawable{a, group, drawn};
+    da->setCachedTransformations(CachedTransformation::Absolute);
+    da->setBoundingSphere({}, 1.0f);
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+    CORRADE_COMPARE(hierarchy.bounds(), (Range3D{{-1.0f, -1.0f, -6.0f}, {1.0f, 1.0f, -4.0f}}));
+
+    /* The hierarchy gets updated even though the drawable doesn't call the
+       base implementation */
+    a.translate(Vector3::xAxis(10.0f));
+    CORRADE_COMPARE(da->dirtyCount, 1);
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 1);
+    hierarchy.refit();
+    CORRADE_COMPARE(da->cleanCount, 2);
+    CORRADE_COMPARE(hierarchy.bounds(), (Range3D{{9.0f, -1.0f, -6.0f}, {11.0f, 1.0f, -4.0f}}));
+}
+
+void BoundingVolumeHierarchyTest::noBoundingVolume() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* Behind the camera */
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(5.0f));
+    auto da = new Drawable{a, &group, drawn};
+    Object3D b{&scene};
+    b.translate(Vector3::zAxis(5.0f));
+    (new Drawable{b, &group, drawn})->setBoundingSphere({}, 1.0f);
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+    CORRADE_COMPARE(hierarchy.size(), 2);
+    CORRADE_COMPARE(hierarchy.nodeCount(), 1);
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    camera.draw(hierarchy);
+    CORRADE_COMPARE(drawn, std::vector<Drawable*>{da});
+
+    /* The transformation gets updated as well */
+    a.translate(Vector3::xAxis(1.0f));
+    std::vector<std::pair<std::reference_wrapper<SceneGraph::Drawable3D>, Matrix4>> transformations;
+    hierarchy.drawableTransformations(camera, transformations);
+    CORRADE_COMPARE(transformations.size(), 1);
+    CORRADE_COMPARE(transformations[0].second, Matrix4::translation({1.0f, 0.0f, 5.0f}));
+}
+
+void BoundingVolumeHierarchyTest::changeBoundingVolumeNone() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* In front of the camera and behind it */
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    auto da = new Drawable{a, &group, drawn};
+    da->setBoundingSphere({}, 1.0f);
+    Object3D b{&scene};
+    b.translate(Vector3::zAxis(5.0f));
+    auto db = new Drawable{b, &group, drawn};
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+    CORRADE_COMPARE(hierarchy.nodeCount(), 1);
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    camera.draw(hierarchy);
+    CORRADE_COMPARE(sorted(drawn), sorted({da, db}));
+
+    /* Swapping the bounding volumes moves the drawables into and out of
+       the tree, now the one behind the camera gets culled */
+    da->resetBoundingVolume();
+    db->setBoundingSphere({}, 1.0f);
+    drawn.clear();
+    camera.draw(hierarchy);
+    CORRADE_COMPARE(drawn, std::vector<Drawable*>{da});
+    CORRADE_COMPARE(hierarchy.bounds(), (Range3D{{-1.0f, -1.0f, 4.0f}, {1.0f, 1.0f, 6.0f}}));
+}
+
+void BoundingVolumeHierarchyTest::addDrawable() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    auto da = new Drawable{a, &group, drawn};
+    da->setBoundingSphere({}, 1.0f);
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+    CORRADE_COMPARE(hierarchy.size(), 1);
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    /* A drawable added after the build gets drawn as well */
+    Object3D b{&scene};
+    b.translate(Vector3::zAxis(-6.0f));
+    auto db = new Drawable{b, &group, drawn};
+    db->setBoundingSphere({}, 1.0f);
+    camera.draw(hierarchy);
+    CORRADE_COMPARE(hierarchy.size(), 2);
+    CORRADE_COMPARE(sorted(drawn), sorted({da, db}));
+
+    /* Also if it's added to the group later, with the count staying the
+       same */
+    Object3D c{&scene};
+    c.translate(Vector3::zAxis(-7.0f));
+    auto dc = new Drawable{c, nullptr, drawn};
+    dc->setBoundingSphere({}, 1.0f);
+    group.remove(*db);
+    group.add(*dc);
+    drawn.clear();
+    camera.draw(hierarchy);
+    CORRADE_COMPARE(hierarchy.size(), 2);
+    CORRADE_COMPARE(sorted(drawn), sorted({da, dc}));
+}
+
+void BoundingVolumeHierarchyTest::removeDrawable() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    auto da = new Drawable{a, &group, drawn};
+    da->setBoundingSphere({}, 1.0f);
+    Object3D b{&scene};
+    b.translate(Vector3::zAxis(-6.0f));
+    auto db = new Drawable{b, &group, drawn};
+    db->setBoundingSphere({}, 1.0f);
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    /* A drawable removed from the group isn't drawn anymore */
+    group.remove(*db);
+    camera.draw(hierarchy);
+    CORRADE_COMPARE(hierarchy.size(), 1);
+    CORRADE_COMPARE(drawn, std::vector<Drawable*>{da});
+
+    /* The drawable no longer references the hierarchy */
+    b.translate(Vector3::xAxis(1.0f));
+    db->setBoundingSphere({}, 2.0f);
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 0);
+}
+
+void BoundingVolumeHierarchyTest::destroyDrawable() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    auto da = new Drawable{a, &group, drawn};
+    da->setBoundingSphere({}, 1.0f);
+
+    Object3D* b = new Object3D{&scene};
+    b->translate(Vector3::zAxis(-6.0f));
+    (new Drawable{*b, &group, drawn})->setBoundingSphere({}, 1.0f);
+
+    BoundingVolumeHierarchy3D hierarchy{group};
+    hierarchy.build();
+
+    /* Make it dirty first to verify the refit doesn't access it */
+    b->translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(hierarchy.dirtyCount(), 1);
+    delete b;
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    camera.draw(hierarchy);
+    CORRADE_COMPARE(drawn, std::vector<Drawable*>{da});
+}
+
+void BoundingVolumeHierarchyTest::destroyHierarchy() {
+    std::vector<Drawable*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D a{&scene};
+    auto da = new Drawable{a, &group, drawn};
+    da->setBoundingSphere({}, 1.0f);
+    CORRADE_VERIFY(a.features().first() == a.features().last());
+
+    {
+        BoundingVolumeHierarchy3D hierarchy{group};
+        hierarchy.build();
+
+        /* The hierarchy attaches its own feature, the drawable caching is
+           left untouched */
+        CORRADE_VERIFY(a.features().first() != a.features().last());
+        CORRADE_VERIFY(!(da->cachedTransformations() & CachedTransformation::Absolute));
+    }
+
+    /* The feature is removed again and the drawable no longer references
+       the hierarchy */
+    CORRADE_VERIFY(a.features().first() == a.features().last());
+    a.translate(Vector3::xAxis(1.0f));
+    da->setBoundingSphere({}, 2.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::BoundingVolumeHierarchyTest)
@@ -24,12 +24,17 @@
 */
 
 #include <algorithm>
+#include <memory>
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 
+#include "Magnum/ScratchArena.h"
 #include "Magnum/SceneGraph/Camera.hpp" /* only for aspectRatioFix(), so it doesn't have to be exported */
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/DualComplexTransformation.h"
+#include "Magnum/SceneGraph/DualQuaternionTransformation.h"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Scene.h"
@@ -50,10 +55,27 @@ struct CameraTest: TestSuite::Tester {
 
     void draw();
     void drawOrdered();
+    void drawStorage();
+    void drawScratchArena();
+    void drawCulled2D();
+    void drawCulled3D();
+    void isVisibleProjectionChanged();
+    void drawChunks();
+    void drawChunksDefault();
+    void drawChunksZero();
+    void drawRigid2D();
+    void drawRigid3D();
+    void drawRigidCulled3D();
+    void drawMultiView2D();
+    void drawMultiView3D();
+
+    void projectedSize();
+    void lodFor();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
 typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
 
 CameraTest::CameraTest() {
@@ -67,7 +89,23 @@ CameraTest::CameraTest() {
               &CameraTest::projectionSizeViewport,
 
               &CameraTest::draw,
-              &CameraTest::drawOrdered});
+              &CameraTest::drawOrdered,
+              &CameraTest::drawStorage,
+              &CameraTest::drawScratchArena,
+              &CameraTest::drawCulled2D,
+              &CameraTest::drawCulled3D,
+              &CameraTest::isVisibleProjectionChanged,
+              &CameraTest::drawChunks,
+              &CameraTest::drawChunksDefault,
+              &CameraTest::drawChunksZero,
+              &CameraTest::drawRigid2D,
+              &CameraTest::drawRigid3D,
+              &CameraTest::drawRigidCulled3D,
+              &CameraTest::drawMultiView2D,
+              &CameraTest::drawMultiView3D,
+
+              &CameraTest::projectedSize,
+              &CameraTest::lodFor});
 }
 
 void CameraTest::fixAspectRatio() {
@@ -216,6 +254,46 @@ void CameraTest::draw() {
     CORRADE_COMPARE(thirdTransformation, Matrix4());
 }
 
+void CameraTest::drawScratchArena() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, Matrix4& result): SceneGraph::Drawable3D(object, group), result(result) {}
+
+        protected:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                result = transformationMatrix;
+            }
+
+        private:
+            Matrix4& result;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D first(&scene);
+    Matrix4 firstTransformation;
+    first.scale(Vector3(5.0f));
+    new Drawable(first, &group, firstTransformation);
+
+    Object3D second(&scene);
+    Matrix4 secondTransformation;
+    second.translate(Vector3::yAxis(3.0f));
+    new Drawable(second, &group, secondTransformation);
+
+    Camera3D camera(second);
+
+    /* The temporaries are taken from the current arena */
+    ScratchArena arena;
+    ScratchArena::setCurrent(&arena);
+    camera.draw(group);
+    ScratchArena::setCurrent(nullptr);
+    CORRADE_COMPARE(arena.usedSize(), 2*sizeof(std::reference_wrapper<AbstractObject3D>) + 2*sizeof(Matrix4));
+
+    CORRADE_COMPARE(firstTransformation, Matrix4::translation(Vector3::yAxis(-3.0f))*Matrix4::scaling(Vector3(5.0f)));
+    CORRADE_COMPARE(secondTransformation, Matrix4());
+}
+
 void CameraTest::drawOrdered() {
     class Drawable: public SceneGraph::Drawable3D {
         public:
@@ -267,6 +345,615 @@ void CameraTest::drawOrdered() {
     }), TestSuite::Compare::Container);
 }
 
+void CameraTest::drawStorage() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, Matrix4& result): SceneGraph::Drawable3D(object, group), result(result) {}
+
+        protected:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                result = transformationMatrix;
+            }
+
+        private:
+            Matrix4& result;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D first(&scene);
+    Matrix4 firstTransformation;
+    first.scale(Vector3(5.0f));
+    new Drawable(first, &group, firstTransformation);
+
+    Object3D second(&scene);
+    Matrix4 secondTransformation;
+    second.translate(Vector3::yAxis(3.0f));
+    new Drawable(second, &group, secondTransformation);
+
+    Object3D third(&second);
+    Matrix4 thirdTransformation;
+    third.translate(Vector3::zAxis(-1.5f));
+    new Drawable(third, &group, thirdTransformation);
+
+    Camera3D camera(third);
+    DrawableTransformations3D storage;
+    camera.draw(group, storage);
+
+    CORRADE_COMPARE(firstTransformation, Matrix4::translation({0.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3(5.0f)));
+    CORRADE_COMPARE(secondTransformation, Matrix4::translation(Vector3::zAxis(1.5f)));
+    CORRADE_COMPARE(thirdTransformation, Matrix4());
+    CORRADE_COMPARE(storage.size(), 3);
+    CORRADE_COMPARE(storage.transformations()[1], Matrix4::translation(Vector3::zAxis(1.5f)));
+
+    /* Second draw should reuse the memory */
+    const Matrix4* data = storage.transformations().data();
+    second.translate(Vector3::xAxis(1.0f));
+    camera.draw(group, storage);
+    CORRADE_COMPARE(storage.transformations().data(), data);
+    CORRADE_COMPARE(firstTransformation, Matrix4::translation({-1.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3(5.0f)));
+    CORRADE_COMPARE(thirdTransformation, Matrix4());
+
+    /* Calculation without drawing */
+    camera.drawableTransformations(group, storage);
+    CORRADE_COMPARE(storage.size(), 3);
+    CORRADE_COMPARE(storage.transformations()[0], Matrix4::translation({-1.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3(5.0f)));
+}
+
+template<UnsignedInt dimensions> class CountingDrawable: public SceneGraph::Drawable<dimensions, Float> {
+    public:
+        CountingDrawable(AbstractObject<dimensions, Float>& object, DrawableGroup<dimensions, Float>* group, std::vector<CountingDrawable<dimensions>*>& drawn): SceneGraph::Drawable<dimensions, Float>(object, group), drawn(drawn) {}
+
+    protected:
+        void draw(const MatrixTypeFor<dimensions, Float>&, Camera<dimensions, Float>&) override {
+            drawn.push_back(this);
+        }
+
+    private:
+        std::vector<CountingDrawable<dimensions>*>& drawn;
+};
+
+void CameraTest::drawCulled2D() {
+    typedef CountingDrawable<2> Drawable;
+    std::vector<Drawable*> drawn;
+
+    DrawableGroup2D group;
+    Scene2D scene;
+
+    /* Inside */
+    Object2D a(&scene);
+    a.translate(Vector2::xAxis(1.0f));
+    auto da = new Drawable(a, &group, drawn);
+    da->setBoundingBox(Range2D::fromCenter({}, Vector2{0.5f}));
+
+    /* Outside */
+    Object2D b(&scene);
+    b.translate(Vector2::xAxis(3.0f));
+    auto db = new Drawable(b, &group, drawn);
+    db->setBoundingSphere({}, 0.5f);
+
+    /* Outside, but rotated so the corners reach inside */
+    Object2D c(&scene);
+    c.rotate(Deg(45.0f))
+     .translate(Vector2::xAxis(2.6f));
+    auto dc = new Drawable(c, &group, drawn);
+    dc->setBoundingBox(Range2D::fromCenter({}, Vector2{0.5f}));
+
+    /* Outside, but without a bounding volume */
+    Object2D d(&scene);
+    d.translate(Vector2::xAxis(-10.0f));
+    auto dd = new Drawable(d, &group, drawn);
+    CORRADE_VERIFY(dd->boundingVolume() == DrawableBoundingVolume::None);
+
+    Camera2D camera(scene);
+    camera.setProjectionMatrix(Matrix3::projection({4.0f, 4.0f}));
+    CORRADE_VERIFY(!camera.frustumCulling());
+
+    /* Culling disabled by default */
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da, db, dc, dd}));
+
+    drawn.clear();
+    camera.setFrustumCulling(true)
+        .draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da, dc, dd}));
+
+    /* Same result with storage */
+    drawn.clear();
+    DrawableTransformations2D storage;
+    camera.draw(group, storage);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da, dc, dd}));
+
+    /* Resetting the bounding volume makes the drawable always visible */
+    drawn.clear();
+    db->resetBoundingVolume();
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da, db, dc, dd}));
+}
+
+void CameraTest::drawCulled3D() {
+    typedef CountingDrawable<3> Drawable;
+    std::vector<Drawable*> drawn;
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* In front of the camera */
+    Object3D a(&scene);
+    a.translate(Vector3::zAxis(-5.0f));
+    auto da = new Drawable(a, &group, drawn);
+    da->setBoundingSphere({}, 1.0f);
+    CORRADE_VERIFY(da->boundingVolume() == DrawableBoundingVolume::Sphere);
+    CORRADE_COMPARE(da->boundingSphereRadius(), 1.0f);
+    CORRADE_COMPARE(da->boundingBox(), Range3D::fromCenter({}, Vector3{1.0f}));
+
+    /* Behind the camera */
+    Object3D b(&scene);
+    b.translate(Vector3::zAxis(5.0f));
+    auto db = new Drawable(b, &group, drawn);
+    db->setBoundingSphere({}, 1.0f);
+
+    /* Outside of the side planes */
+    Object3D c(&scene);
+    c.translate({10.0f, 0.0f, -5.0f});
+    auto dc = new Drawable(c, &group, drawn);
+    dc->setBoundingBox(Range3D::fromCenter({}, Vector3{1.0f}));
+    CORRADE_VERIFY(dc->boundingVolume() == DrawableBoundingVolume::Box);
+
+    /* Center outside of the side planes, but the object is scaled so the
+       radius reaches inside */
+    Object3D d(&scene);
+    d.scale(Vector3{2.0f})
+     .translate({7.0f, 0.0f, -5.0f});
+    auto dd = new Drawable(d, &group, drawn);
+    dd->setBoundingSphere({}, 1.0f);
+
+    /* Behind, but without a bounding volume */
+    Object3D e(&scene);
+    e.translate(Vector3::zAxis(5.0f));
+    auto de = new Drawable(e, &group, drawn);
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f))
+        .setFrustumCulling(true);
+
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da, dd, de}));
+
+    CORRADE_VERIFY(camera.isVisible(*da, Matrix4::translation(Vector3::zAxis(-5.0f))));
+    CORRADE_VERIFY(!camera.isVisible(*da, Matrix4::translation(Vector3::zAxis(-105.0f))));
+
+    /* The list contains only visible drawables */
+    auto transformations = camera.drawableTransformations(group);
+    CORRADE_COMPARE(transformations.size(), 3);
+    CORRADE_COMPARE(&transformations[1].first.get(), dd);
+
+    /* The storage contains everything */
+    DrawableTransformations3D storage;
+    camera.drawableTransformations(group, storage);
+    CORRADE_COMPARE(storage.size(), 5);
+
+    /* Moving the camera changes the result */
+    drawn.clear();
+    cameraObject.rotateY(Deg(180.0f));
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{db, de}));
+}
+
+void CameraTest::isVisibleProjectionChanged() {
+    std::vector<CountingDrawable<3>*> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D object(&scene);
+    CountingDrawable<3> drawable{object, &group, drawn};
+    drawable.setBoundingSphere({}, 1.0f);
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    const Matrix4 transformation = Matrix4::translation({3.0f, 0.0f, -5.0f});
+    CORRADE_VERIFY(camera.isVisible(drawable, transformation));
+
+    /* The cached frustum gets updated with a narrower projection */
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(30.0f), 1.0f, 0.1f, 100.0f));
+    CORRADE_VERIFY(!camera.isVisible(drawable, transformation));
+
+    /* And also with the aspect ratio correction making the view wider */
+    camera.setAspectRatioPolicy(AspectRatioPolicy::Extend);
+    camera.setViewport({400, 100});
+    CORRADE_VERIFY(camera.isVisible(drawable, transformation));
+}
+
+void CameraTest::drawChunks() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, Int& chunk): SceneGraph::Drawable3D(object, group), _chunk(chunk) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override {
+                CORRADE_VERIFY(!"this shouldn't be called");
+            }
+
+            /* Each drawable writes to a different location, so it's fine to
+               do that from multiple threads */
+            void drawChunk(const Matrix4&, Camera3D&, UnsignedInt chunk) override {
+                _chunk = chunk;
+            }
+
+        private:
+            Int& _chunk;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    std::vector<Int> chunks(11, -1);
+    std::vector<std::unique_ptr<Object3D>> objects;
+    for(std::size_t i = 0; i != chunks.size(); ++i) {
+        objects.emplace_back(new Object3D{&scene});
+        objects.back()->translate(Vector3::zAxis(i == 4 ? 5.0f : -5.0f));
+        (new Drawable{*objects.back(), &group, chunks[i]})->setBoundingSphere({}, 1.0f);
+    }
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f))
+        .setFrustumCulling(true);
+
+    /* Ten visible drawables split into four chunks, the fifth is culled */
+    DrawableTransformations3D storage;
+    camera.draw(group, storage, 4, 3);
+    CORRADE_COMPARE(storage.size(), 11);
+    CORRADE_COMPARE(chunks, (std::vector<Int>{0, 0, 1, 1, -1, 1, 2, 2, 3, 3, 3}));
+
+    /* Same result on a single thread */
+    std::fill(chunks.begin(), chunks.end(), -1);
+    camera.draw(group, storage, 4, 1);
+    CORRADE_COMPARE(chunks, (std::vector<Int>{0, 0, 1, 1, -1, 1, 2, 2, 3, 3, 3}));
+
+    /* More threads and chunks than drawables */
+    std::fill(chunks.begin(), chunks.end(), -1);
+    camera.draw(group, storage, 20, 32);
+    CORRADE_COMPARE(chunks, (std::vector<Int>{1, 3, 5, 7, -1, 9, 11, 13, 15, 17, 19}));
+}
+
+void CameraTest::drawChunksDefault() {
+    typedef CountingDrawable<2> Drawable;
+    std::vector<Drawable*> drawn;
+
+    DrawableGroup2D group;
+    Scene2D scene;
+
+    Object2D a(&scene);
+    Object2D b(&scene);
+    Object2D c(&scene);
+    auto da = new Drawable(a, &group, drawn);
+    auto db = new Drawable(b, &group, drawn);
+    auto dc = new Drawable(c, &group, drawn);
+
+    /* Default drawChunk() implementation calls draw() */
+    Camera2D camera(scene);
+    DrawableTransformations2D storage;
+    camera.draw(group, storage, 2, 1);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da, db, dc}));
+}
+
+void CameraTest::drawChunksZero() {
+    DrawableGroup2D group;
+    Scene2D scene;
+    Camera2D camera(scene);
+    DrawableTransformations2D storage;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    camera.draw(group, storage, 0, 4);
+    CORRADE_COMPARE(out.str(), "Camera::draw(): expected non-zero chunk count\n");
+}
+
+void CameraTest::drawRigid2D() {
+    typedef SceneGraph::Object<SceneGraph::DualComplexTransformation> Object2D;
+    typedef SceneGraph::Scene<SceneGraph::DualComplexTransformation> Scene2D;
+
+    /* Doesn't override drawRigid(), so the default implementation should
+       convert the transformation to a matrix */
+    class Drawable: public SceneGraph::Drawable2D {
+        public:
+            Drawable(AbstractObject2D& object, DrawableGroup2D* group, Matrix3& result): SceneGraph::Drawable2D(object, group), result(result) {}
+
+        protected:
+            void draw(const Matrix3& transformationMatrix, Camera2D&) override {
+                result = transformationMatrix;
+            }
+
+        private:
+            Matrix3& result;
+    };
+
+    DrawableGroup2D group;
+    Scene2D scene;
+
+    Object2D first(&scene);
+    Matrix3 firstTransformation;
+    first.rotate(Deg(30.0f));
+    new Drawable(first, &group, firstTransformation);
+
+    Object2D cameraObject(&scene);
+    cameraObject.translate(Vector2::xAxis(2.0f));
+    Camera2D camera(cameraObject);
+
+    RigidDrawableTransformations2D storage;
+    camera.drawRigid<SceneGraph::DualComplexTransformation>(group, storage);
+    CORRADE_COMPARE(firstTransformation, Matrix3::translation(Vector2::xAxis(-2.0f))*Matrix3::rotation(Deg(30.0f)));
+    CORRADE_COMPARE(storage.size(), 1);
+    CORRADE_COMPARE(storage.transformations()[0], DualComplex::translation(Vector2::xAxis(-2.0f))*DualComplex::rotation(Deg(30.0f)));
+}
+
+void CameraTest::drawRigid3D() {
+    typedef SceneGraph::Object<SceneGraph::DualQuaternionTransformation> Object3D;
+    typedef SceneGraph::Scene<SceneGraph::DualQuaternionTransformation> Scene3D;
+
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, DualQuaternion& result): SceneGraph::Drawable3D(object, group), result(result) {}
+
+        protected:
+            /* Shouldn't be called, zero the result to make it noticeable */
+            void draw(const Matrix4&, Camera3D&) override {
+                result = DualQuaternion{Math::ZeroInit};
+            }
+
+            void drawRigid(const DualQuaternion& transformation, Camera3D&) override {
+                result = transformation;
+            }
+
+        private:
+            DualQuaternion& result;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D first(&scene);
+    DualQuaternion firstTransformation;
+    first.rotateY(Deg(90.0f));
+    new Drawable(first, &group, firstTransformation);
+
+    Object3D second(&first);
+    DualQuaternion secondTransformation;
+    second.translate(Vector3::zAxis(-3.0f));
+    new Drawable(second, &group, secondTransformation);
+
+    Object3D cameraObject(&scene);
+    cameraObject.translate(Vector3::zAxis(5.0f));
+    Camera3D camera(cameraObject);
+
+    RigidDrawableTransformations3D storage;
+    camera.drawRigid<SceneGraph::DualQuaternionTransformation>(group, storage);
+    CORRADE_COMPARE(firstTransformation,
+        DualQuaternion::translation(Vector3::zAxis(-5.0f))*
+        DualQuaternion::rotation(Deg(90.0f), Vector3::yAxis()));
+    CORRADE_COMPARE(secondTransformation,
+        DualQuaternion::translation(Vector3::zAxis(-5.0f))*
+        DualQuaternion::rotation(Deg(90.0f), Vector3::yAxis())*
+        DualQuaternion::translation(Vector3::zAxis(-3.0f)));
+    CORRADE_COMPARE(storage.size(), 2);
+    CORRADE_COMPARE(storage.transformations()[1], secondTransformation);
+
+    /* Same result as going through matrices */
+    DrawableTransformations3D matrixStorage;
+    camera.drawableTransformations(group, matrixStorage);
+    CORRADE_COMPARE(matrixStorage.transformations()[1], secondTransformation.toMatrix());
+
+    /* Second draw should reuse the memory */
+    const DualQuaternion* data = storage.transformations().data();
+    camera.drawRigid<SceneGraph::DualQuaternionTransformation>(group, storage);
+    CORRADE_COMPARE(storage.transformations().data(), data);
+}
+
+void CameraTest::drawRigidCulled3D() {
+    typedef SceneGraph::Object<SceneGraph::DualQuaternionTransformation> Object3D;
+    typedef SceneGraph::Scene<SceneGraph::DualQuaternionTransformation> Scene3D;
+    typedef CountingDrawable<3> Drawable;
+    std::vector<Drawable*> drawn;
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* In front of the camera */
+    Object3D a(&scene);
+    a.translate(Vector3::zAxis(-5.0f));
+    auto da = new Drawable(a, &group, drawn);
+    da->setBoundingSphere({}, 1.0f);
+
+    /* Behind the camera */
+    Object3D b(&scene);
+    b.translate(Vector3::zAxis(5.0f));
+    auto db = new Drawable(b, &group, drawn);
+    db->setBoundingSphere({}, 1.0f);
+
+    /* Outside of the side planes */
+    Object3D c(&scene);
+    c.translate({10.0f, 0.0f, -5.0f});
+    auto dc = new Drawable(c, &group, drawn);
+    dc->setBoundingBox(Range3D::fromCenter({}, Vector3{1.0f}));
+
+    /* Behind, but without a bounding volume */
+    Object3D d(&scene);
+    d.translate(Vector3::zAxis(5.0f));
+    auto dd = new Drawable(d, &group, drawn);
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f))
+        .setFrustumCulling(true);
+
+    RigidDrawableTransformations3D storage;
+    camera.drawRigid<SceneGraph::DualQuaternionTransformation>(group, storage);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da, dd}));
+
+    /* The storage contains everything */
+    CORRADE_COMPARE(storage.size(), 4);
+
+    /* Moving the camera changes the result */
+    drawn.clear();
+    cameraObject.rotateY(Deg(180.0f));
+    camera.drawRigid<SceneGraph::DualQuaternionTransformation>(group, storage);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{db, dd}));
+}
+
+void CameraTest::drawMultiView2D() {
+    typedef CountingDrawable<2> Drawable;
+    std::vector<Drawable*> drawn;
+
+    DrawableGroup2D group;
+    Scene2D scene;
+
+    /* In the first view */
+    Object2D a(&scene);
+    a.translate(Vector2::xAxis(1.0f));
+    auto da = new Drawable(a, &group, drawn);
+    da->setBoundingBox(Range2D::fromCenter({}, Vector2{0.5f}));
+
+    /* In the second view */
+    Object2D b(&scene);
+    b.translate(Vector2::xAxis(4.0f));
+    auto db = new Drawable(b, &group, drawn);
+    db->setBoundingBox(Range2D::fromCenter({}, Vector2{0.5f}));
+
+    /* In neither */
+    Object2D c(&scene);
+    c.translate(Vector2::xAxis(10.0f));
+    auto dc = new Drawable(c, &group, drawn);
+    dc->setBoundingBox(Range2D::fromCenter({}, Vector2{0.5f}));
+
+    Camera2D camera(scene);
+    camera.setProjectionMatrix(Matrix3::projection({4.0f, 4.0f}))
+        .setFrustumCulling(true);
+    CORRADE_VERIFY(camera.viewProjectionMatrices().empty());
+
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da}));
+
+    /* Each drawable is drawn just once even if visible in both views */
+    drawn.clear();
+    camera.setViewProjectionMatrices({
+        Matrix3::projection({4.0f, 4.0f}),
+        Matrix3::projection({4.0f, 4.0f})*Matrix3::translation(Vector2::xAxis(-4.0f))});
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da, db}));
+    CORRADE_VERIFY(camera.isVisible(*db, Matrix3::translation(Vector2::xAxis(4.0f))));
+    CORRADE_VERIFY(!camera.isVisible(*db, Matrix3::translation(Vector2::xAxis(10.0f))));
+}
+
+void CameraTest::drawMultiView3D() {
+    typedef CountingDrawable<3> Drawable;
+    std::vector<Drawable*> drawn;
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* In front of the camera */
+    Object3D a(&scene);
+    a.translate(Vector3::zAxis(-5.0f));
+    auto da = new Drawable(a, &group, drawn);
+    da->setBoundingSphere({}, 1.0f);
+
+    /* Behind the camera */
+    Object3D b(&scene);
+    b.translate(Vector3::zAxis(5.0f));
+    auto db = new Drawable(b, &group, drawn);
+    db->setBoundingBox(Range3D::fromCenter({}, Vector3{1.0f}));
+
+    /* Outside of the side planes of both views */
+    Object3D c(&scene);
+    c.translate({10.0f, 0.0f, -5.0f});
+    auto dc = new Drawable(c, &group, drawn);
+    dc->setBoundingSphere({}, 1.0f);
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f))
+        .setFrustumCulling(true);
+
+    /* Looking forward and backward */
+    const Matrix4 viewProjectionMatrices[]{
+        Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f),
+        Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f)*Matrix4::rotationY(Deg(180.0f))
+    };
+    camera.setViewProjectionMatrices(viewProjectionMatrices);
+    CORRADE_COMPARE(camera.viewProjectionMatrices().size(), 2);
+    CORRADE_COMPARE(camera.viewProjectionMatrices()[1], viewProjectionMatrices[1]);
+
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da, db}));
+
+    CORRADE_VERIFY(camera.isVisible(*da, Matrix4::translation(Vector3::zAxis(5.0f))));
+    CORRADE_VERIFY(!camera.isVisible(*da, Matrix4::translation({10.0f, 0.0f, 5.0f})));
+
+    /* The storage uses the same culling */
+    drawn.clear();
+    DrawableTransformations3D storage;
+    camera.draw(group, storage);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da, db}));
+
+    /* Resetting the views goes back to the projection matrix */
+    drawn.clear();
+    camera.setViewProjectionMatrices(nullptr);
+    CORRADE_VERIFY(camera.viewProjectionMatrices().empty());
+    camera.draw(group);
+    CORRADE_COMPARE(drawn, (std::vector<Drawable*>{da}));
+}
+
+void CameraTest::projectedSize() {
+    Object3D o;
+    Camera3D camera(o);
+    camera.setViewport({100, 100});
+
+    /* Orthographic projection doesn't depend on distance */
+    camera.setProjectionMatrix(Matrix4::orthographicProjection({2.0f, 2.0f}, 1.0f, 9.0f));
+    CORRADE_COMPARE(camera.projectedSize(Vector3::zAxis(-2.0f), 1.0f), 50.0f);
+    CORRADE_COMPARE(camera.projectedSize(Vector3::zAxis(-8.0f), 1.0f), 50.0f);
+
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+    CORRADE_COMPARE(camera.projectedSize(Vector3::zAxis(-5.0f), 1.0f), 10.0f);
+    CORRADE_COMPARE(camera.projectedSize({3.0f, 1.0f, -10.0f}, 2.0f), 10.0f);
+    CORRADE_VERIFY(camera.projectedSize(Vector3::zAxis(5.0f), 1.0f) == Constants::inf());
+}
+
+void CameraTest::lodFor() {
+    typedef CountingDrawable<3> Drawable;
+    std::vector<Drawable*> drawn;
+
+    Object3D o;
+    Drawable d{o, nullptr, drawn};
+    d.setBoundingSphere({0.0f, 0.0f, -1.0f}, 1.0f);
+
+    Object3D cameraObject;
+    Camera3D camera(cameraObject);
+    camera.setViewport({100, 100});
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    const Float errors[]{0.0f, 0.1f, 0.5f, 2.0f};
+
+    /* 10 pixels per unit at the sphere center */
+    CORRADE_COMPARE(camera.lodFor(d, Matrix4::translation(Vector3::zAxis(-4.0f)), errors, 5.0f), 2);
+
+    /* Further away and with a looser threshold */
+    CORRADE_COMPARE(camera.lodFor(d, Matrix4::translation(Vector3::zAxis(-49.0f)), errors, 5.0f), 3);
+    CORRADE_COMPARE(camera.lodFor(d, Matrix4::translation(Vector3::zAxis(-4.0f)), errors, 20.0f), 3);
+
+    /* Scaling makes the error larger */
+    CORRADE_COMPARE(camera.lodFor(d, Matrix4::translation(Vector3::zAxis(-3.0f))*Matrix4::scaling({1.0f, 2.0f, 1.0f}), errors, 5.0f), 1);
+
+    /* Behind the camera or with no levels */
+    CORRADE_COMPARE(camera.lodFor(d, Matrix4::translation(Vector3::zAxis(5.0f)), errors, 5.0f), 0);
+    CORRADE_COMPARE(camera.lodFor(d, Matrix4::translation(Vector3::zAxis(-4.0f)), nullptr, 5.0f), 0);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
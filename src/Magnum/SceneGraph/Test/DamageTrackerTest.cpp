@@ -0,0 +1,367 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/DamageTracker.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct DamageTrackerTest: TestSuite::Tester {
+    explicit DamageTrackerTest();
+
+    void initial();
+    void unchanged();
+    void moved();
+    void boundingVolumeChanged();
+    void noBoundingVolume();
+    void addedRemoved();
+    void addDamage();
+    void addDamageDrawable();
+    void viewportChanged();
+    void clampedToViewport();
+
+    void drawNotUpdated();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+
+DamageTrackerTest::DamageTrackerTest() {
+    addTests({&DamageTrackerTest::initial,
+              &DamageTrackerTest::unchanged,
+              &DamageTrackerTest::moved,
+              &DamageTrackerTest::boundingVolumeChanged,
+              &DamageTrackerTest::noBoundingVolume,
+              &DamageTrackerTest::addedRemoved,
+              &DamageTrackerTest::addDamage,
+              &DamageTrackerTest::addDamageDrawable,
+              &DamageTrackerTest::viewportChanged,
+              &DamageTrackerTest::clampedToViewport,
+
+              &DamageTrackerTest::drawNotUpdated});
+}
+
+class IdDrawable: public SceneGraph::Drawable2D {
+    public:
+        IdDrawable(AbstractObject2D& object, DrawableGroup2D* group, Int id, std::vector<Int>& drawn): SceneGraph::Drawable2D(object, group), id(id), drawn(drawn) {
+            /* 8x8 pixels with the projection below */
+            setBoundingBox({{-4.0f, -4.0f}, {4.0f, 4.0f}});
+        }
+
+    protected:
+        void draw(const Matrix3&, Camera2D&) override {
+            drawn.push_back(id);
+        }
+
+    private:
+        Int id;
+        std::vector<Int>& drawn;
+};
+
+/* Maps one unit to one pixel with origin in the viewport center. Power-of-two
+   sizes so the calculations are exact. */
+void setupCamera(Camera2D& camera) {
+    camera.setProjectionMatrix(Matrix3::projection({128.0f, 128.0f}));
+    camera.setViewport({128, 128});
+}
+
+void DamageTrackerTest::initial() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    new IdDrawable{a, &group, 0, drawn};
+    Object2D b{&scene};
+    b.translate({20.0f, 0.0f});
+    new IdDrawable{b, &group, 1, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    /* Everything is damaged the first time */
+    DamageTracker2D tracker;
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{}, {128, 128}}));
+    CORRADE_COMPARE(tracker.damage(), (Range2Di{{}, {128, 128}}));
+
+    tracker.draw(camera, group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{0, 1}));
+    CORRADE_COMPARE(tracker.drawnCount(), 2);
+}
+
+void DamageTrackerTest::unchanged() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    new IdDrawable{a, &group, 0, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    DamageTracker2D tracker;
+    tracker.update(camera, group);
+
+    /* Nothing changed, nothing drawn */
+    CORRADE_COMPARE(tracker.update(camera, group), Range2Di{});
+    tracker.draw(camera, group);
+    CORRADE_VERIFY(drawn.empty());
+    CORRADE_COMPARE(tracker.drawnCount(), 0);
+}
+
+void DamageTrackerTest::moved() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    new IdDrawable{a, &group, 0, drawn};
+    Object2D b{&scene};
+    b.translate({20.0f, 0.0f});
+    new IdDrawable{b, &group, 1, drawn};
+    Object2D c{&scene};
+    c.translate({-30.0f, 0.0f});
+    new IdDrawable{c, &group, 2, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    DamageTracker2D tracker;
+    tracker.update(camera, group);
+
+    /* Old and new rectangle are damaged */
+    a.translate({0.0f, 10.0f});
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{60, 60}, {68, 78}}));
+
+    /* The moved drawable is drawn; the one at the right doesn't intersect
+       the damage */
+    tracker.draw(camera, group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{0}));
+
+    /* Moving a drawable over another draws both */
+    drawn.clear();
+    b.translate({-15.0f, 10.0f});
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{65, 60}, {88, 78}}));
+    tracker.draw(camera, group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{0, 1}));
+}
+
+void DamageTrackerTest::boundingVolumeChanged() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    IdDrawable& da = *new IdDrawable{a, &group, 0, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    DamageTracker2D tracker;
+    tracker.update(camera, group);
+
+    da.setBoundingBox({{-4.0f, -4.0f}, {12.0f, 4.0f}});
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{60, 60}, {76, 68}}));
+}
+
+void DamageTrackerTest::noBoundingVolume() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    (new IdDrawable{a, &group, 0, drawn})->resetBoundingVolume();
+    Object2D b{&scene};
+    b.translate({20.0f, 0.0f});
+    new IdDrawable{b, &group, 1, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    DamageTracker2D tracker;
+    tracker.update(camera, group);
+
+    /* A drawable without a bounding volume is drawn for any damage */
+    b.translate({0.0f, 10.0f});
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{80, 60}, {88, 78}}));
+    tracker.draw(camera, group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{0, 1}));
+
+    /* And its movement damages everything */
+    a.translate({1.0f, 0.0f});
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{}, {128, 128}}));
+}
+
+void DamageTrackerTest::addedRemoved() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    new IdDrawable{a, &group, 0, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    DamageTracker2D tracker;
+    tracker.update(camera, group);
+
+    /* Added drawable damages its rectangle */
+    Object2D b{&scene};
+    b.translate({20.0f, 0.0f});
+    IdDrawable* db = new IdDrawable{b, &group, 1, drawn};
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{80, 60}, {88, 68}}));
+    tracker.draw(camera, group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{1}));
+
+    /* Removed drawable damages its previous rectangle */
+    drawn.clear();
+    delete db;
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{80, 60}, {88, 68}}));
+    tracker.draw(camera, group);
+    CORRADE_VERIFY(drawn.empty());
+}
+
+void DamageTrackerTest::addDamage() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    new IdDrawable{a, &group, 0, drawn};
+    Object2D b{&scene};
+    b.translate({20.0f, 0.0f});
+    new IdDrawable{b, &group, 1, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    DamageTracker2D tracker;
+    tracker.update(camera, group);
+
+    /* Zero-size damage is ignored */
+    tracker.addDamage({{0, 0}, {10, 0}})
+           .addDamage({{80, 64}, {88, 66}})
+           .addDamage({{86, 56}, {87, 57}});
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{80, 56}, {88, 66}}));
+    tracker.draw(camera, group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{1}));
+
+    /* The damage is reset after */
+    CORRADE_COMPARE(tracker.update(camera, group), Range2Di{});
+
+    tracker.damageAll();
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{}, {128, 128}}));
+}
+
+void DamageTrackerTest::addDamageDrawable() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    new IdDrawable{a, &group, 0, drawn};
+    Object2D b{&scene};
+    b.translate({20.0f, 0.0f});
+    IdDrawable& db = *new IdDrawable{b, &group, 1, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    DamageTracker2D tracker;
+    tracker.update(camera, group);
+
+    tracker.addDamage(db);
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{80, 60}, {88, 68}}));
+    tracker.draw(camera, group);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{1}));
+}
+
+void DamageTrackerTest::viewportChanged() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    new IdDrawable{a, &group, 0, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    DamageTracker2D tracker;
+    tracker.update(camera, group);
+
+    camera.setViewport({256, 128});
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{}, {256, 128}}));
+
+    camera.setProjectionMatrix(Matrix3::projection({256.0f, 128.0f}));
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{}, {256, 128}}));
+
+    CORRADE_COMPARE(tracker.update(camera, group), Range2Di{});
+}
+
+void DamageTrackerTest::clampedToViewport() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    new IdDrawable{a, &group, 0, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    DamageTracker2D tracker;
+    tracker.update(camera, group);
+
+    /* Partially outside */
+    a.translate({-62.0f, 0.0f});
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{0, 60}, {68, 68}}));
+
+    /* Completely outside, only the old rectangle is damaged and the drawable
+       is not drawn */
+    a.translate({-100.0f, 0.0f});
+    CORRADE_COMPARE(tracker.update(camera, group), (Range2Di{{0, 60}, {6, 68}}));
+    tracker.draw(camera, group);
+    CORRADE_VERIFY(drawn.empty());
+}
+
+void DamageTrackerTest::drawNotUpdated() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+    Object2D a{&scene};
+    new IdDrawable{a, &group, 0, drawn};
+
+    Camera2D camera{scene};
+    setupCamera(camera);
+
+    DamageTracker2D tracker;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    tracker.draw(camera, group);
+    CORRADE_COMPARE(out.str(), "SceneGraph::DamageTracker::draw(): the damage was calculated for 0 drawables but the group has 1\n");
+    CORRADE_VERIFY(drawn.empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::DamageTrackerTest)
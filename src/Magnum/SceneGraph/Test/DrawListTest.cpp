@@ -0,0 +1,365 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/DrawList.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct DrawListTest: TestSuite::Tester {
+    explicit DrawListTest();
+
+    void stateKey();
+    void sortableDepth();
+    void radixSort();
+    void radixSortEmpty();
+    void coherentSort();
+    void coherentSortFallback();
+
+    void drawUnsorted();
+    void drawState();
+    void drawBackToFront();
+    void draw2D();
+    void drawCulled();
+    void drawDepthPrepared();
+
+    void debugDrawOrder();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+DrawListTest::DrawListTest() {
+    addTests({&DrawListTest::stateKey,
+              &DrawListTest::sortableDepth,
+              &DrawListTest::radixSort,
+              &DrawListTest::radixSortEmpty,
+              &DrawListTest::coherentSort,
+              &DrawListTest::coherentSortFallback,
+
+              &DrawListTest::drawUnsorted,
+              &DrawListTest::drawState,
+              &DrawListTest::drawBackToFront,
+              &DrawListTest::draw2D,
+              &DrawListTest::drawCulled,
+              &DrawListTest::drawDepthPrepared,
+
+              &DrawListTest::debugDrawOrder});
+}
+
+template<UnsignedInt dimensions> class IdDrawable: public SceneGraph::Drawable<dimensions, Float> {
+    public:
+        IdDrawable(AbstractObject<dimensions, Float>& object, DrawableGroup<dimensions, Float>* group, Int id, std::vector<Int>& drawn): SceneGraph::Drawable<dimensions, Float>(object, group), id(id), drawn(drawn) {}
+
+    protected:
+        void draw(const MatrixTypeFor<dimensions, Float>&, Camera<dimensions, Float>&) override {
+            drawn.push_back(id);
+        }
+
+    private:
+        Int id;
+        std::vector<Int>& drawn;
+};
+
+class DepthDrawable: public SceneGraph::Drawable3D {
+    public:
+        DepthDrawable(AbstractObject3D& object, DrawableGroup3D* group, Int id, std::vector<Int>& drawn): SceneGraph::Drawable3D(object, group), id(id), drawn(drawn) {}
+
+    protected:
+        void draw(const Matrix4&, Camera3D&) override {
+            drawn.push_back(id);
+        }
+
+        /* Depth draws are recorded with negative IDs */
+        void drawDepth(const Matrix4&, Camera3D&) override {
+            drawn.push_back(-id);
+        }
+
+    private:
+        Int id;
+        std::vector<Int>& drawn;
+};
+
+void DrawListTest::stateKey() {
+    constexpr UnsignedInt key = drawStateKey(0x1a, 0xbcd, 0x123);
+    CORRADE_COMPARE(key, 0x1abcd123);
+
+    /* Overflowing bits are cut */
+    CORRADE_COMPARE(drawStateKey(0x21a, 0x1bcd, 0xf123), 0x1abcd123);
+
+    /* Shader has the highest priority */
+    CORRADE_VERIFY(drawStateKey(1, 0, 0) > drawStateKey(0, 0xfff, 0xfff));
+    CORRADE_VERIFY(drawStateKey(0, 1, 0) > drawStateKey(0, 0, 0xfff));
+}
+
+void DrawListTest::sortableDepth() {
+    const Float values[]{-Constants::inf(), -1000.0f, -1.5f, -0.0f, 0.0f, 1.0e-20f, 1.5f, 1000.0f, Constants::inf()};
+    for(std::size_t i = 1; i != Containers::arraySize(values); ++i)
+        CORRADE_VERIFY(Implementation::sortableDepth(values[i - 1]) < Implementation::sortableDepth(values[i]));
+}
+
+void DrawListTest::radixSort() {
+    std::vector<Implementation::DrawListItem> items{
+        {0xffff000000000000ull, 0},
+        {0x0000000000000003ull, 1},
+        {0x00000000ff000000ull, 2},
+        {0x0000000000000003ull, 3},
+        {0x0000ff0000000000ull, 4},
+        {0x0000000000000001ull, 5}};
+    std::vector<Implementation::DrawListItem> scratch;
+    Implementation::radixSort(items, scratch);
+
+    std::vector<UnsignedInt> indices;
+    for(const Implementation::DrawListItem& item: items)
+        indices.push_back(item.index);
+
+    /* Items with equal keys keep their order */
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{5, 1, 3, 2, 4, 0}));
+}
+
+void DrawListTest::radixSortEmpty() {
+    std::vector<Implementation::DrawListItem> items;
+    std::vector<Implementation::DrawListItem> scratch;
+    Implementation::radixSort(items, scratch);
+    CORRADE_VERIFY(items.empty());
+}
+
+void DrawListTest::coherentSort() {
+    std::vector<Implementation::DrawListItem> items{
+        {3, 0}, {2, 1}, {4, 2}, {1, 3}};
+    std::vector<Implementation::DrawListItem> scratch;
+    std::vector<UnsignedInt> ranks;
+
+    /* No previous order, the last drawable is culled */
+    CORRADE_VERIFY(!Implementation::coherentSort(items, ranks, 5, scratch));
+    std::vector<UnsignedInt> indices;
+    for(const Implementation::DrawListItem& item: items)
+        indices.push_back(item.index);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{3, 1, 0, 2}));
+    CORRADE_COMPARE(ranks, (std::vector<UnsignedInt>{2, 1, 3, 0, ~UnsignedInt{}}));
+
+    /* Third drawable moved to the front, the last one got visible, equal
+       keys keep the previous order instead of the order in the group */
+    items = {{3, 0}, {1, 1}, {0, 2}, {1, 3}, {5, 4}};
+    CORRADE_VERIFY(Implementation::coherentSort(items, ranks, 5, scratch));
+    indices.clear();
+    for(const Implementation::DrawListItem& item: items)
+        indices.push_back(item.index);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{2, 3, 1, 0, 4}));
+    CORRADE_COMPARE(ranks, (std::vector<UnsignedInt>{3, 2, 0, 1, 4}));
+}
+
+void DrawListTest::coherentSortFallback() {
+    std::vector<Implementation::DrawListItem> items;
+    std::vector<Implementation::DrawListItem> scratch;
+    std::vector<UnsignedInt> ranks;
+    for(UnsignedInt i = 0; i != 64; ++i)
+        items.push_back({i, i});
+    CORRADE_VERIFY(!Implementation::coherentSort(items, ranks, 64, scratch));
+
+    /* Reversing the order is too much work for the insertion sort */
+    for(auto& item: items) item.key = 64 - item.index;
+    CORRADE_VERIFY(!Implementation::coherentSort(items, ranks, 64, scratch));
+    for(std::size_t i = 0; i != 64; ++i) {
+        CORRADE_COMPARE(items[i].index, 63 - i);
+        CORRADE_COMPARE(ranks[i], 63 - i);
+    }
+}
+
+void DrawListTest::drawUnsorted() {
+    std::vector<Int> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    (new IdDrawable<3>{a, &group, 0, drawn})->setStateKey(3);
+    Object3D b{&scene};
+    b.translate(Vector3::zAxis(-2.0f));
+    (new IdDrawable<3>{b, &group, 1, drawn})->setStateKey(1);
+
+    Camera3D camera{scene};
+    DrawList3D list{DrawOrder::Unsorted};
+    CORRADE_COMPARE(list.order(), DrawOrder::Unsorted);
+    camera.draw(group, list);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{0, 1}));
+    CORRADE_COMPARE(list.size(), 2);
+    CORRADE_COMPARE(list.drawableIndex(1), 1);
+    CORRADE_COMPARE(list.transformations().size(), 2);
+    CORRADE_COMPARE(list.transformations()[1], Matrix4::translation(Vector3::zAxis(-2.0f)));
+}
+
+void DrawListTest::drawState() {
+    std::vector<Int> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* Two shaders, drawables of the same shader are drawn front to back */
+    const Float depths[]{3.0f, 1.0f, 2.0f, 0.5f, 4.0f, 1.5f};
+    const UnsignedInt shaders[]{1, 0, 1, 0, 0, 1};
+    for(Int i = 0; i != 6; ++i) {
+        Object3D* object = new Object3D{&scene};
+        object->translate(Vector3::zAxis(-depths[i]));
+        (new IdDrawable<3>{*object, &group, i, drawn})->setStateKey(drawStateKey(shaders[i], 0, 0));
+    }
+
+    Camera3D camera{scene};
+    DrawList3D list;
+    CORRADE_COMPARE(list.order(), DrawOrder::State);
+    camera.draw(group, list);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{3, 1, 4, 5, 2, 0}));
+
+    /* Drawing again reuses the memory */
+    drawn.clear();
+    const Matrix4* data = list.transformations().data();
+    camera.draw(group, list);
+    CORRADE_COMPARE(list.transformations().data(), data);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{3, 1, 4, 5, 2, 0}));
+}
+
+void DrawListTest::drawBackToFront() {
+    std::vector<Int> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* Depth is taken from the bounding volume center, if set */
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    (new IdDrawable<3>{a, &group, 0, drawn})->setStateKey(1);
+    Object3D b{&scene};
+    b.translate(Vector3::zAxis(-2.0f));
+    (new IdDrawable<3>{b, &group, 1, drawn})->setBoundingSphere(Vector3::zAxis(-10.0f), 1.0f);
+    Object3D c{&scene};
+    c.translate(Vector3::zAxis(-7.0f));
+    (new IdDrawable<3>{c, &group, 2, drawn})->setStateKey(2);
+
+    Camera3D camera{scene};
+    DrawList3D list{DrawOrder::BackToFront};
+    camera.draw(group, list);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{1, 2, 0}));
+
+    /* Switching the order */
+    drawn.clear();
+    list.setOrder(DrawOrder::State);
+    camera.draw(group, list);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{1, 0, 2}));
+}
+
+void DrawListTest::draw2D() {
+    std::vector<Int> drawn;
+    DrawableGroup2D group;
+    Scene2D scene;
+
+    /* No depth in 2D, same state keeps the original order */
+    const UnsignedInt keys[]{2, 1, 2, 1, 0};
+    for(Int i = 0; i != 5; ++i) {
+        Object2D* object = new Object2D{&scene};
+        (new IdDrawable<2>{*object, &group, i, drawn})->setStateKey(keys[i]);
+    }
+
+    Camera2D camera{scene};
+    DrawList2D list;
+    camera.draw(group, list);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{4, 1, 3, 0, 2}));
+}
+
+void DrawListTest::drawCulled() {
+    std::vector<Int> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    IdDrawable<3>& da = *new IdDrawable<3>{a, &group, 0, drawn};
+    da.setBoundingSphere({}, 1.0f)
+      .setStateKey(1);
+    Object3D b{&scene};
+    b.translate(Vector3::zAxis(5.0f));
+    (new IdDrawable<3>{b, &group, 1, drawn})->setBoundingSphere({}, 1.0f);
+    Object3D c{&scene};
+    c.translate(Vector3::zAxis(-3.0f));
+    (new IdDrawable<3>{c, &group, 2, drawn})->setBoundingSphere({}, 1.0f);
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f))
+        .setFrustumCulling(true);
+
+    DrawList3D list;
+    camera.draw(group, list);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{2, 0}));
+    CORRADE_COMPARE(list.size(), 2);
+
+    /* Transformations are calculated for all */
+    CORRADE_COMPARE(list.transformations().size(), 3);
+}
+
+void DrawListTest::drawDepthPrepared() {
+    std::vector<Int> drawn;
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-5.0f));
+    new DepthDrawable{a, &group, 1, drawn};
+    Object3D b{&scene};
+    b.translate(Vector3::zAxis(-2.0f));
+    new DepthDrawable{b, &group, 2, drawn};
+    /* Drawables without a depth-only variant fall back to draw() */
+    Object3D c{&scene};
+    c.translate(Vector3::zAxis(-3.0f));
+    new IdDrawable<3>{c, &group, 3, drawn};
+
+    Camera3D camera{scene};
+    DrawList3D list;
+    camera.drawDepth(group, list);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{-2, 3, -1}));
+    CORRADE_COMPARE(list.size(), 3);
+
+    /* The shading pass reuses the order, moving the objects has no effect
+       until the list is prepared again */
+    drawn.clear();
+    b.translate(Vector3::zAxis(-10.0f));
+    camera.drawPrepared(group, list);
+    CORRADE_COMPARE(drawn, (std::vector<Int>{2, 3, 1}));
+    CORRADE_COMPARE(list.transformations()[1], Matrix4::translation(Vector3::zAxis(-2.0f)));
+}
+
+void DrawListTest::debugDrawOrder() {
+    std::ostringstream out;
+    Debug{&out} << DrawOrder::BackToFront << DrawOrder(0xde);
+    CORRADE_COMPARE(out.str(), "SceneGraph::DrawOrder::BackToFront SceneGraph::DrawOrder(0xde)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::DrawListTest)
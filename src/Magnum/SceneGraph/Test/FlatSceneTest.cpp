@@ -0,0 +1,401 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/FlatScene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FlatSceneTest: TestSuite::Tester {
+    explicit FlatSceneTest();
+
+    void construct();
+    void addObject();
+    void addObjectInvalidParent();
+    void addObjects();
+    void addObjectsInvalid();
+    void setParent();
+    void setParentCycle();
+    void depth();
+    void update();
+    void updatePartial();
+    void updateReparent();
+    void order();
+    void absoluteTransformationDirty();
+    void clear();
+    void large();
+
+    void threadCount();
+    void updateMultithreaded();
+    void updateMultithreadedNotSplittable();
+};
+
+FlatSceneTest::FlatSceneTest() {
+    addTests({&FlatSceneTest::construct,
+              &FlatSceneTest::addObject,
+              &FlatSceneTest::addObjectInvalidParent,
+              &FlatSceneTest::addObjects,
+              &FlatSceneTest::addObjectsInvalid,
+              &FlatSceneTest::setParent,
+              &FlatSceneTest::setParentCycle,
+              &FlatSceneTest::depth,
+              &FlatSceneTest::update,
+              &FlatSceneTest::updatePartial,
+              &FlatSceneTest::updateReparent,
+              &FlatSceneTest::order,
+              &FlatSceneTest::absoluteTransformationDirty,
+              &FlatSceneTest::clear,
+              &FlatSceneTest::large,
+
+              &FlatSceneTest::threadCount,
+              &FlatSceneTest::updateMultithreaded,
+              &FlatSceneTest::updateMultithreadedNotSplittable});
+}
+
+void FlatSceneTest::construct() {
+    FlatScene3D scene;
+    CORRADE_VERIFY(scene.isEmpty());
+    CORRADE_COMPARE(scene.size(), 0);
+    CORRADE_VERIFY(scene.absoluteTransformations().empty());
+
+    /* Updating an empty scene is a no-op */
+    scene.update();
+    CORRADE_VERIFY(scene.order().empty());
+}
+
+void FlatSceneTest::addObject() {
+    FlatScene2D scene;
+    CORRADE_COMPARE(scene.addObject(-1, Matrix3::translation(Vector2::xAxis(1.0f))), 0);
+    CORRADE_COMPARE(scene.addObject(0), 1);
+    CORRADE_COMPARE(scene.addObject(-1), 2);
+
+    CORRADE_VERIFY(!scene.isEmpty());
+    CORRADE_COMPARE(scene.size(), 3);
+    CORRADE_COMPARE(scene.parent(0), -1);
+    CORRADE_COMPARE(scene.parent(1), 0);
+    CORRADE_COMPARE(scene.parent(2), -1);
+    CORRADE_COMPARE(scene.transformation(0), Matrix3::translation(Vector2::xAxis(1.0f)));
+    CORRADE_COMPARE(scene.transformation(1), Matrix3{});
+
+    /* Newly added objects are dirty */
+    CORRADE_VERIFY(scene.isDirty(0));
+    CORRADE_VERIFY(scene.isDirty(1));
+    CORRADE_VERIFY(scene.isDirty(2));
+}
+
+void FlatSceneTest::addObjectInvalidParent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    FlatScene3D scene;
+    scene.addObject(-1);
+    scene.addObject(1);
+    scene.addObject(-2);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatScene::addObject(): invalid parent 1\n"
+        "SceneGraph::FlatScene::addObject(): invalid parent -2\n");
+}
+
+void FlatSceneTest::addObjects() {
+    FlatScene3D scene;
+    scene.addObject(-1);
+
+    /* Parent is after its child, indices are relative to the batch */
+    const Int parents[]{1, -1, 1};
+    const Matrix4 transformations[]{
+        Matrix4::scaling(Vector3{0.5f}),
+        Matrix4::translation(Vector3::xAxis(5.0f)),
+        Matrix4{}};
+    CORRADE_COMPARE(scene.addObjects(parents, transformations), 1);
+
+    CORRADE_COMPARE(scene.size(), 4);
+    CORRADE_COMPARE(scene.parent(1), 2);
+    CORRADE_COMPARE(scene.parent(2), -1);
+    CORRADE_COMPARE(scene.parent(3), 2);
+    CORRADE_VERIFY(scene.isDirty(1));
+    CORRADE_VERIFY(scene.isDirty(3));
+
+    scene.update();
+    CORRADE_COMPARE(scene.absoluteTransformation(1),
+        Matrix4::translation(Vector3::xAxis(5.0f))*Matrix4::scaling(Vector3{0.5f}));
+    CORRADE_COMPARE(scene.absoluteTransformation(3),
+        Matrix4::translation(Vector3::xAxis(5.0f)));
+    CORRADE_COMPARE(scene.depth(1), 1);
+}
+
+void FlatSceneTest::addObjectsInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    FlatScene3D scene;
+    const Int parents[]{-1, 2, 0};
+    const Int cycle[]{-1, 2, 1};
+    const Matrix4 transformations[3]{};
+    scene.addObjects(parents, Containers::arrayView(transformations).prefix(2));
+    scene.addObjects(Containers::arrayView(parents).prefix(2), Containers::arrayView(transformations).prefix(2));
+    scene.addObjects(cycle, transformations);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatScene::addObjects(): expected the same count of parents and transformations, got 3 and 2\n"
+        "SceneGraph::FlatScene::addObjects(): invalid parent 2 for object 1\n"
+        "SceneGraph::FlatScene::addObjects(): parents form a cycle at object 1\n");
+
+    /* Nothing was added */
+    CORRADE_VERIFY(scene.isEmpty());
+}
+
+void FlatSceneTest::setParent() {
+    FlatScene3D scene;
+    scene.addObject(-1);
+    scene.addObject(-1);
+    scene.addObject(0);
+    scene.update();
+
+    scene.setParent(2, 1);
+    CORRADE_COMPARE(scene.parent(2), 1);
+    CORRADE_VERIFY(scene.isDirty(2));
+    CORRADE_VERIFY(!scene.isDirty(1));
+
+    /* Making it a root object again */
+    scene.setParent(2, -1);
+    CORRADE_COMPARE(scene.parent(2), -1);
+}
+
+void FlatSceneTest::setParentCycle() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    FlatScene3D scene;
+    scene.addObject(-1);
+    scene.addObject(0);
+    scene.addObject(1);
+
+    scene.setParent(1, 1);
+    scene.setParent(0, 2);
+    scene.setParent(3, 0);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatScene::setParent(): can't parent object 1 to itself or its child\n"
+        "SceneGraph::FlatScene::setParent(): can't parent object 0 to itself or its child\n"
+        "SceneGraph::FlatScene::setParent(): index 3 out of range for 3 objects\n");
+
+    /* The hierarchy is unchanged */
+    CORRADE_COMPARE(scene.parent(0), -1);
+    CORRADE_COMPARE(scene.parent(1), 0);
+}
+
+void FlatSceneTest::depth() {
+    FlatScene3D scene;
+    scene.addObject(-1);
+    scene.addObject(0);
+    scene.addObject(1);
+    scene.addObject(-1);
+
+    CORRADE_COMPARE(scene.depth(0), 0);
+    CORRADE_COMPARE(scene.depth(1), 1);
+    CORRADE_COMPARE(scene.depth(2), 2);
+    CORRADE_COMPARE(scene.depth(3), 0);
+}
+
+void FlatSceneTest::update() {
+    FlatScene3D scene;
+    UnsignedInt root = scene.addObject(-1, Matrix4::rotationX(Deg(90.0f)));
+    UnsignedInt first = scene.addObject(root, Matrix4::rotationZ(Deg(30.0f)));
+    UnsignedInt second = scene.addObject(first, Matrix4::scaling(Vector3{0.5f}));
+    UnsignedInt third = scene.addObject(first, Matrix4::translation(Vector3::xAxis(5.0f)));
+
+    scene.update();
+    CORRADE_VERIFY(!scene.isDirty(root));
+    CORRADE_VERIFY(!scene.isDirty(second));
+    CORRADE_COMPARE(scene.absoluteTransformation(root),
+        Matrix4::rotationX(Deg(90.0f)));
+    CORRADE_COMPARE(scene.absoluteTransformation(first),
+        Matrix4::rotationX(Deg(90.0f))*Matrix4::rotationZ(Deg(30.0f)));
+    CORRADE_COMPARE(scene.absoluteTransformation(second),
+        Matrix4::rotationX(Deg(90.0f))*Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3{0.5f}));
+    CORRADE_COMPARE(scene.absoluteTransformation(third),
+        Matrix4::rotationX(Deg(90.0f))*Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::xAxis(5.0f)));
+
+    /* The view is indexed by ID */
+    CORRADE_COMPARE(scene.absoluteTransformations().size(), 4);
+    CORRADE_COMPARE(scene.absoluteTransformations()[third], scene.absoluteTransformation(third));
+}
+
+void FlatSceneTest::updatePartial() {
+    FlatScene3D scene;
+    scene.addObject(-1, Matrix4::translation(Vector3::xAxis(1.0f)));
+    scene.addObject(0, Matrix4::translation(Vector3::yAxis(2.0f)));
+    scene.addObject(-1, Matrix4::translation(Vector3::zAxis(3.0f)));
+    scene.update();
+
+    /* Changing a parent makes the whole subtree dirty, but not the others */
+    scene.setTransformation(0, Matrix4::translation(Vector3::xAxis(-1.0f)));
+    CORRADE_VERIFY(scene.isDirty(0));
+    CORRADE_VERIFY(scene.isDirty(1));
+    CORRADE_VERIFY(!scene.isDirty(2));
+    CORRADE_COMPARE(scene.absoluteTransformation(2), Matrix4::translation(Vector3::zAxis(3.0f)));
+
+    scene.update();
+    CORRADE_VERIFY(!scene.isDirty(1));
+    CORRADE_COMPARE(scene.absoluteTransformation(1), Matrix4::translation({-1.0f, 2.0f, 0.0f}));
+}
+
+void FlatSceneTest::updateReparent() {
+    FlatScene3D scene;
+    scene.addObject(-1, Matrix4::translation(Vector3::xAxis(1.0f)));
+    scene.addObject(-1, Matrix4::translation(Vector3::yAxis(2.0f)));
+    /* Object with ID lower than its future parent */
+    scene.addObject(-1, Matrix4::translation(Vector3::zAxis(3.0f)));
+    scene.update();
+
+    scene.setParent(0, 2)
+         .setParent(2, 1);
+    scene.update();
+    CORRADE_COMPARE(scene.absoluteTransformation(2), Matrix4::translation({0.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(scene.absoluteTransformation(0), Matrix4::translation({1.0f, 2.0f, 3.0f}));
+}
+
+void FlatSceneTest::order() {
+    FlatScene3D scene;
+    scene.addObject(-1);
+    scene.addObject(-1);
+    scene.addObject(0);
+    scene.addObject(2);
+    scene.addObject(1);
+    scene.setParent(0, 4);
+    scene.update();
+
+    /* Sorted by depth, insertion order kept on the same level */
+    CORRADE_COMPARE(std::vector<UnsignedInt>(scene.order().begin(), scene.order().end()),
+        (std::vector<UnsignedInt>{1, 4, 0, 2, 3}));
+}
+
+void FlatSceneTest::absoluteTransformationDirty() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    FlatScene3D scene;
+    scene.addObject(-1);
+    scene.absoluteTransformation(0);
+    scene.absoluteTransformation(1);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatScene::absoluteTransformation(): object 0 is dirty, call update() first\n"
+        "SceneGraph::FlatScene::absoluteTransformation(): index 1 out of range for 1 objects\n");
+}
+
+void FlatSceneTest::clear() {
+    FlatScene3D scene;
+    scene.addObject(-1);
+    scene.addObject(0);
+    scene.update();
+
+    scene.clear();
+    CORRADE_VERIFY(scene.isEmpty());
+    CORRADE_VERIFY(scene.order().empty());
+    CORRADE_COMPARE(scene.addObject(-1), 0);
+}
+
+void FlatSceneTest::large() {
+    /* The original Object implementation is limited to 65k objects, ensure
+       there's no such limit here. Building a deep chain to verify also that
+       the depth calculation doesn't recurse. */
+    FlatScene2D scene;
+    scene.reserve(100000);
+    scene.addObject(-1);
+    for(Int i = 1; i != 100000; ++i)
+        scene.addObject(i - 1, Matrix3::translation(Vector2::xAxis(1.0f)));
+
+    scene.update();
+    CORRADE_COMPARE(scene.absoluteTransformation(99999), Matrix3::translation(Vector2::xAxis(99999.0f)));
+}
+
+void FlatSceneTest::threadCount() {
+    FlatScene3D scene;
+    CORRADE_COMPARE(scene.threadCount(), 1);
+
+    scene.setThreadCount(0);
+    CORRADE_COMPARE(scene.threadCount(), 1);
+
+    scene.setThreadCount(4);
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_COMPARE(scene.threadCount(), 4);
+    #else
+    CORRADE_COMPARE(scene.threadCount(), 1);
+    #endif
+}
+
+namespace {
+    /* Many subtrees of varying depth and shape */
+    void populate(FlatScene3D& scene) {
+        const UnsignedInt root = scene.addObject(-1, Matrix4::translation(Vector3{0.5f}));
+        for(Int i = 0; i != 200; ++i) {
+            const Int subtreeRoot = scene.addObject(root, Matrix4::scaling(Vector3{1.0f + i*0.001f}));
+            Int parent = subtreeRoot;
+            for(Int j = 0; j != 5 + i%37; ++j)
+                parent = scene.addObject(j % 3 ? parent : subtreeRoot, Matrix4::translation(Vector3{Float(j)}));
+        }
+    }
+}
+
+void FlatSceneTest::updateMultithreaded() {
+    FlatScene3D serial, parallel;
+    populate(serial);
+    populate(parallel);
+    CORRADE_VERIFY(parallel.size() > FlatScene3D::ParallelUpdateThreshold);
+
+    parallel.setThreadCount(4);
+    serial.update();
+    parallel.update();
+    for(UnsignedInt i = 0; i != serial.size(); ++i) {
+        CORRADE_VERIFY(!parallel.isDirty(i));
+        CORRADE_COMPARE(parallel.absoluteTransformation(i), serial.absoluteTransformation(i));
+    }
+
+    /* Partial update of a subtree, the rest should stay the same */
+    serial.setTransformation(1, Matrix4::rotationZ(Deg(35.0f)));
+    parallel.setTransformation(1, Matrix4::rotationZ(Deg(35.0f)));
+    serial.update();
+    parallel.update();
+    for(UnsignedInt i = 0; i != serial.size(); ++i) {
+        CORRADE_COMPARE(parallel.absoluteTransformation(i), serial.absoluteTransformation(i));
+    }
+}
+
+void FlatSceneTest::updateMultithreadedNotSplittable() {
+    /* A long chain can't be split into independent tasks, the update should
+       still work correctly on one thread */
+    FlatScene2D scene;
+    scene.setThreadCount(4);
+    scene.addObject(-1);
+    for(Int i = 1; i != 10000; ++i)
+        scene.addObject(i - 1, Matrix3::translation(Vector2::yAxis(1.0f)));
+
+    scene.update();
+    CORRADE_COMPARE(scene.absoluteTransformation(9999), Matrix3::translation(Vector2::yAxis(9999.0f)));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneTest)
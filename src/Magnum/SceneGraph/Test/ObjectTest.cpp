@@ -45,9 +45,17 @@ struct ObjectTest: TestSuite::Tester {
     void transformationsRelative();
     void transformationsOrphan();
     void transformationsDuplicate();
+    void transformationsView();
+    void transformationsViewInvalidSize();
+    void transformationMatricesView();
+    void transformationMatricesViewInvalidSize();
     void setClean();
     void setCleanListHierarchy();
     void setCleanListBulk();
+    void setDirtyLazy();
+    void setDirtyCleanParent();
+    void setDirtyNotifyFeatures();
+    void setDirtyNotifyDestroyed();
 
     void rangeBasedForChildren();
     void rangeBasedForFeatures();
@@ -82,9 +90,17 @@ ObjectTest::ObjectTest() {
               &ObjectTest::transformationsRelative,
               &ObjectTest::transformationsOrphan,
               &ObjectTest::transformationsDuplicate,
+              &ObjectTest::transformationsView,
+              &ObjectTest::transformationsViewInvalidSize,
+              &ObjectTest::transformationMatricesView,
+              &ObjectTest::transformationMatricesViewInvalidSize,
               &ObjectTest::setClean,
               &ObjectTest::setCleanListHierarchy,
               &ObjectTest::setCleanListBulk,
+              &ObjectTest::setDirtyLazy,
+              &ObjectTest::setDirtyCleanParent,
+              &ObjectTest::setDirtyNotifyFeatures,
+              &ObjectTest::setDirtyNotifyDestroyed,
 
               &ObjectTest::rangeBasedForChildren,
               &ObjectTest::rangeBasedForFeatures});
@@ -304,6 +320,63 @@ void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+void ObjectTest::transformationsView() {
+    Scene3D s;
+    Object3D first(&s);
+    first.rotateZ(Deg(30.0f));
+    Object3D second(&first);
+    second.scale(Vector3(0.5f));
+
+    Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    const std::reference_wrapper<AbstractObject3D> objects[]{second, first};
+    Matrix4 transformations[2];
+    s.transformations(objects, transformations, initial);
+    CORRADE_COMPARE(transformations[0], initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)));
+    CORRADE_COMPARE(transformations[1], initial*Matrix4::rotationZ(Deg(30.0f)));
+}
+
+void ObjectTest::transformationsViewInvalidSize() {
+    Scene3D s;
+    Object3D first(&s);
+
+    const std::reference_wrapper<AbstractObject3D> objects[]{first, first};
+    Matrix4 transformations[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    s.transformations(objects, transformations);
+    CORRADE_COMPARE(out.str(), "SceneGraph::Object::transformations(): expected 2 transformations but got 3\n");
+}
+
+void ObjectTest::transformationMatricesView() {
+    Scene3D s;
+    Object3D first(&s);
+    first.rotateZ(Deg(30.0f));
+    Object3D second(&first);
+    second.scale(Vector3(0.5f));
+
+    Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    const std::reference_wrapper<AbstractObject3D> objects[]{second, first, second};
+    Matrix4 transformations[3];
+    s.transformationMatrices(objects, transformations, initial);
+    CORRADE_COMPARE(transformations[0], initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)));
+    CORRADE_COMPARE(transformations[1], initial*Matrix4::rotationZ(Deg(30.0f)));
+    CORRADE_COMPARE(transformations[2], initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)));
+}
+
+void ObjectTest::transformationMatricesViewInvalidSize() {
+    Scene3D s;
+    Object3D first(&s);
+
+    const std::reference_wrapper<AbstractObject3D> objects[]{first, first};
+    Matrix4 transformations[1];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    s.transformationMatrices(objects, transformations);
+    CORRADE_COMPARE(out.str(), "SceneGraph::Object::transformationMatrices(): expected 2 matrices but got 1\n");
+}
+
 void ObjectTest::setClean() {
     Scene3D scene;
 
@@ -484,6 +557,171 @@ void ObjectTest::setCleanListBulk() {
     CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::zAxis(3.0f))*Matrix4::scaling(Vector3(-2.0f)));
 }
 
+namespace {
+    class NotifiedFeature: public AbstractFeature3D {
+        public:
+            explicit NotifiedFeature(AbstractObject3D& object, bool caching): AbstractFeature3D{object} {
+                if(caching) setCachedTransformations(CachedTransformation::Absolute);
+            }
+
+            using AbstractFeature3D::setCachedTransformations;
+
+            Int notifiedCount = 0;
+
+        protected:
+            void markDirty() override { ++notifiedCount; }
+    };
+}
+
+void ObjectTest::setDirtyLazy() {
+    Scene3D scene;
+    Object3D* root = new Object3D{&scene};
+
+    /* Deep chain of objects */
+    Object3D* leaf = root;
+    for(std::size_t i = 0; i != 100; ++i)
+        leaf = new Object3D{leaf};
+    Object3D* sibling = new Object3D{root};
+
+    leaf->setClean();
+    sibling->setClean();
+    CORRADE_VERIFY(!root->isDirty());
+    CORRADE_VERIFY(!leaf->isDirty());
+
+    /* Moving the root makes everything below dirty */
+    root->translate(Vector3::xAxis(1.0f));
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(root->isDirty());
+    CORRADE_VERIFY(leaf->isDirty());
+    CORRADE_VERIFY(sibling->isDirty());
+
+    /* Cleaning the leaf cleans the whole chain but not the sibling */
+    leaf->setClean();
+    CORRADE_VERIFY(!root->isDirty());
+    CORRADE_VERIFY(!leaf->isDirty());
+    CORRADE_VERIFY(sibling->isDirty());
+    CORRADE_COMPARE(leaf->absoluteTransformationMatrix(), Matrix4::translation(Vector3::xAxis(1.0f)));
+
+    /* Moving the leaf itself doesn't affect parents */
+    leaf->translate(Vector3::yAxis(1.0f));
+    CORRADE_VERIFY(!root->isDirty());
+    CORRADE_VERIFY(leaf->isDirty());
+}
+
+void ObjectTest::setDirtyCleanParent() {
+    Scene3D scene;
+    Object3D* a = new Object3D{&scene};
+    Object3D* b = new Object3D{a};
+    Object3D* c = new Object3D{b};
+    c->setClean();
+
+    /* Cleaning an object in the middle doesn't clean its children */
+    a->translate(Vector3::xAxis(1.0f));
+    b->setClean();
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_VERIFY(c->isDirty());
+
+    /* The cached dirty state doesn't get stale when cleaning a child before
+       its parent */
+    a->translate(Vector3::xAxis(1.0f));
+    CORRADE_VERIFY(c->isDirty());
+    CORRADE_VERIFY(b->isDirty());
+    Object3D::setClean({*c, *b});
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_VERIFY(!c->isDirty());
+    CORRADE_COMPARE(c->absoluteTransformationMatrix(), Matrix4::translation(Vector3::xAxis(2.0f)));
+}
+
+void ObjectTest::setDirtyNotifyFeatures() {
+    Scene3D scene;
+    Object3D* root = new Object3D{&scene};
+    Object3D* a = new Object3D{root};
+    Object3D* b = new Object3D{root};
+    Object3D* c = new Object3D{a};
+    Object3D* d = new Object3D{root};
+    Object3D* e = new Object3D{d};
+    NotifiedFeature* rootFeature = new NotifiedFeature{*root, false};
+    NotifiedFeature* bFeature = new NotifiedFeature{*b, false};
+    NotifiedFeature* cFeature = new NotifiedFeature{*c, true};
+    Object3D::setClean({*root, *a, *b, *c, *e});
+
+    /* All features are notified, regardless of whether they cache the
+       transformation. Subtrees without features are not visited, but are
+       still dirty. */
+    root->translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(rootFeature->notifiedCount, 1);
+    CORRADE_COMPARE(bFeature->notifiedCount, 1);
+    CORRADE_COMPARE(cFeature->notifiedCount, 1);
+    CORRADE_VERIFY(d->isDirty());
+    CORRADE_VERIFY(e->isDirty());
+
+    /* Already notified, not notified again until cleaned */
+    root->translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(rootFeature->notifiedCount, 1);
+    CORRADE_COMPARE(bFeature->notifiedCount, 1);
+    CORRADE_COMPARE(cFeature->notifiedCount, 1);
+
+    /* Cleaning c cleans also root, b is still dirty */
+    c->setClean();
+    root->translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(rootFeature->notifiedCount, 2);
+    CORRADE_COMPARE(bFeature->notifiedCount, 1);
+    CORRADE_COMPARE(cFeature->notifiedCount, 2);
+
+    Object3D::setClean({*b, *c});
+    root->translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(rootFeature->notifiedCount, 3);
+    CORRADE_COMPARE(bFeature->notifiedCount, 2);
+    CORRADE_COMPARE(cFeature->notifiedCount, 3);
+
+    /* A feature added deep into a featureless subtree gets notified */
+    Object3D::setClean({*b, *c, *e});
+    NotifiedFeature* eFeature = new NotifiedFeature{*e, false};
+    root->translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(eFeature->notifiedCount, 1);
+
+    /* Moving a subtree with features elsewhere updates the parents */
+    Object3D::setClean({*b, *c, *e});
+    c->setParent(b);
+    CORRADE_COMPARE(cFeature->notifiedCount, 5);
+    Object3D::setClean({*b, *c});
+    a->translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(cFeature->notifiedCount, 5);
+    b->translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(bFeature->notifiedCount, 4);
+    CORRADE_COMPARE(cFeature->notifiedCount, 6);
+}
+
+void ObjectTest::setDirtyNotifyDestroyed() {
+    Scene3D scene;
+    Object3D* root = new Object3D{&scene};
+    Object3D* a = new Object3D{root};
+    NotifiedFeature* rootFeature = new NotifiedFeature{*root, true};
+    new NotifiedFeature{*a, true};
+    Object3D* b = new Object3D{a};
+    new NotifiedFeature{*b, false};
+
+    /* Destroying a subtree with features and destroying a feature itself
+       updates the counts, the remaining features are still notified */
+    delete a;
+    delete rootFeature;
+    Object3D* c = new Object3D{root};
+    NotifiedFeature* cFeature = new NotifiedFeature{*c, false};
+    Object3D::setClean({*root, *c});
+    root->translate(Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(cFeature->notifiedCount, 1);
+    CORRADE_VERIFY(c->isDirty());
+
+    /* A subtree with features going away together with its parent doesn't
+       touch the already destroyed parents */
+    Object3D* d = new Object3D{c};
+    new NotifiedFeature{*d, true};
+    delete root;
+    CORRADE_VERIFY(scene.children().isEmpty());
+}
+
 void ObjectTest::rangeBasedForChildren() {
     Scene3D scene;
     Object3D a(&scene);
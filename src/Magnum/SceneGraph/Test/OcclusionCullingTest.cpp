@@ -0,0 +1,400 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/OcclusionCulling.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct OcclusionCullingTest: TestSuite::Tester {
+    explicit OcclusionCullingTest();
+
+    void construct();
+    void visibleTestSpread();
+    void occluded();
+    void resultNotAvailable();
+    void conditionalRendering();
+    void noBoundingVolume();
+    void cameraInside();
+    void proxyTransformation();
+    void removed();
+    void reset();
+
+    void setVisibleTestIntervalZero();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+OcclusionCullingTest::OcclusionCullingTest() {
+    addTests({&OcclusionCullingTest::construct,
+              &OcclusionCullingTest::visibleTestSpread,
+              &OcclusionCullingTest::occluded,
+              &OcclusionCullingTest::resultNotAvailable,
+              &OcclusionCullingTest::conditionalRendering,
+              &OcclusionCullingTest::noBoundingVolume,
+              &OcclusionCullingTest::cameraInside,
+              &OcclusionCullingTest::proxyTransformation,
+              &OcclusionCullingTest::removed,
+              &OcclusionCullingTest::reset,
+
+              &OcclusionCullingTest::setVisibleTestIntervalZero});
+}
+
+class IdDrawable: public SceneGraph::Drawable3D {
+    public:
+        IdDrawable(AbstractObject3D& object, DrawableGroup3D* group, Int id, std::vector<std::string>& events): SceneGraph::Drawable3D(object, group), id(id), events(events) {
+            setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+        }
+
+    protected:
+        void draw(const Matrix4&, Camera3D&) override {
+            events.push_back(Utility::formatString("draw {}", id));
+        }
+
+    private:
+        Int id;
+        std::vector<std::string>& events;
+};
+
+/* Records all calls, query results are taken from the results array with -1
+   meaning not available, 0 hidden and 1 visible */
+class Culling: public OcclusionCulling3D {
+    public:
+        explicit Culling(std::vector<std::string>& events): events(events), results{-1, -1, -1, -1} {}
+
+        std::vector<std::string>& events;
+        Int results[4];
+        Matrix4 proxyTransformation;
+
+    private:
+        void doBeginQuery(UnsignedInt id) override {
+            events.push_back(Utility::formatString("begin {}", id));
+        }
+        void doEndQuery(UnsignedInt id) override {
+            events.push_back(Utility::formatString("end {}", id));
+        }
+        bool doQueryResult(UnsignedInt id, bool& visible) override {
+            if(results[id] == -1) return false;
+            visible = results[id];
+            return true;
+        }
+        void doBeginProxies() override {
+            events.push_back("begin proxies");
+        }
+        void doDrawProxy(const Matrix4& transformationMatrix, Camera3D&) override {
+            events.push_back("proxy");
+            proxyTransformation = transformationMatrix;
+        }
+        void doEndProxies() override {
+            events.push_back("end proxies");
+        }
+        void doBeginConditionalDraw(UnsignedInt id) override {
+            events.push_back(Utility::formatString("begin conditional {}", id));
+        }
+        void doEndConditionalDraw() override {
+            events.push_back("end conditional");
+        }
+};
+
+void OcclusionCullingTest::construct() {
+    std::vector<std::string> events;
+    Culling culling{events};
+    CORRADE_COMPARE(culling.visibleTestInterval(), 4);
+    CORRADE_VERIFY(!culling.isConditionalRenderingEnabled());
+    CORRADE_COMPARE(culling.drawnCount(), 0);
+    CORRADE_COMPARE(culling.occludedCount(), 0);
+    CORRADE_COMPARE(culling.queryCount(), 0);
+}
+
+void OcclusionCullingTest::visibleTestSpread() {
+    std::vector<std::string> events;
+    DrawableGroup3D group;
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-10.0f));
+    new IdDrawable{a, &group, 0, events};
+    new IdDrawable{a, &group, 1, events};
+    Camera3D camera{scene};
+
+    Culling culling{events};
+
+    /* The first drawable gets tested right away, the second one frame
+       later */
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{
+        "begin 0", "draw 0", "end 0", "draw 1"}));
+    CORRADE_COMPARE(culling.drawnCount(), 2);
+    CORRADE_COMPARE(culling.queryCount(), 1);
+
+    events.clear();
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{
+        "draw 0", "begin 1", "draw 1", "end 1"}));
+
+    /* Both results say visible, next test of the first one is four frames
+       after the first */
+    culling.results[0] = culling.results[1] = 1;
+    events.clear();
+    culling.draw(camera, group);
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{
+        "draw 0", "draw 1", "draw 0", "draw 1"}));
+
+    events.clear();
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{
+        "begin 0", "draw 0", "end 0", "draw 1"}));
+}
+
+void OcclusionCullingTest::occluded() {
+    std::vector<std::string> events;
+    DrawableGroup3D group;
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-10.0f));
+    new IdDrawable{a, &group, 0, events};
+    new IdDrawable{a, &group, 1, events};
+    Camera3D camera{scene};
+
+    Culling culling{events};
+    culling.setVisibleTestInterval(1);
+    culling.draw(camera, group);
+    CORRADE_COMPARE(culling.queryCount(), 2);
+
+    /* The first is hidden now, gets tested using its proxy after everything
+       else is drawn */
+    culling.results[0] = 0;
+    culling.results[1] = 1;
+    events.clear();
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{
+        "begin 1", "draw 1", "end 1",
+        "begin proxies", "begin 0", "proxy", "end 0", "end proxies"}));
+    CORRADE_COMPARE(culling.drawnCount(), 1);
+    CORRADE_COMPARE(culling.occludedCount(), 1);
+    CORRADE_COMPARE(culling.queryCount(), 2);
+
+    /* The proxy passed, it gets drawn again */
+    culling.results[0] = 1;
+    events.clear();
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{
+        "begin 0", "draw 0", "end 0", "begin 1", "draw 1", "end 1"}));
+    CORRADE_COMPARE(culling.drawnCount(), 2);
+    CORRADE_COMPARE(culling.occludedCount(), 0);
+}
+
+void OcclusionCullingTest::resultNotAvailable() {
+    std::vector<std::string> events;
+    DrawableGroup3D group;
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-10.0f));
+    new IdDrawable{a, &group, 0, events};
+    Camera3D camera{scene};
+
+    Culling culling{events};
+    culling.setVisibleTestInterval(1);
+    culling.draw(camera, group);
+
+    /* Without a result the drawable stays visible and no new query is
+       issued */
+    events.clear();
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{"draw 0"}));
+    CORRADE_COMPARE(culling.queryCount(), 0);
+
+    culling.results[0] = 0;
+    culling.draw(camera, group);
+
+    /* Hidden, and the proxy result is not available yet, so nothing is
+       done */
+    culling.results[0] = -1;
+    events.clear();
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, std::vector<std::string>{});
+    CORRADE_COMPARE(culling.drawnCount(), 0);
+    CORRADE_COMPARE(culling.occludedCount(), 1);
+    CORRADE_COMPARE(culling.queryCount(), 0);
+}
+
+void OcclusionCullingTest::conditionalRendering() {
+    std::vector<std::string> events;
+    DrawableGroup3D group;
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-10.0f));
+    new IdDrawable{a, &group, 0, events};
+    Camera3D camera{scene};
+
+    Culling culling{events};
+    culling.setConditionalRendering(true);
+    CORRADE_VERIFY(culling.isConditionalRenderingEnabled());
+    culling.draw(camera, group);
+
+    culling.results[0] = 0;
+    events.clear();
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{
+        "begin proxies", "begin 0", "proxy", "end 0", "end proxies",
+        "begin conditional 0", "draw 0", "end conditional"}));
+    CORRADE_COMPARE(culling.drawnCount(), 1);
+    CORRADE_COMPARE(culling.occludedCount(), 0);
+
+    /* Proxy query still in flight, the conditional draw uses it */
+    culling.results[0] = -1;
+    events.clear();
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{
+        "begin conditional 0", "draw 0", "end conditional"}));
+}
+
+void OcclusionCullingTest::noBoundingVolume() {
+    std::vector<std::string> events;
+    DrawableGroup3D group;
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-10.0f));
+    (new IdDrawable{a, &group, 0, events})->resetBoundingVolume();
+    Camera3D camera{scene};
+
+    Culling culling{events};
+    culling.setVisibleTestInterval(1);
+    culling.draw(camera, group);
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{"draw 0", "draw 0"}));
+    CORRADE_COMPARE(culling.drawnCount(), 1);
+    CORRADE_COMPARE(culling.queryCount(), 0);
+}
+
+void OcclusionCullingTest::cameraInside() {
+    std::vector<std::string> events;
+    DrawableGroup3D group;
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-0.5f));
+    new IdDrawable{a, &group, 0, events};
+    Camera3D camera{scene};
+
+    Culling culling{events};
+    culling.setVisibleTestInterval(1);
+    culling.results[0] = 0;
+    culling.draw(camera, group);
+    culling.draw(camera, group);
+
+    /* Never tested, always drawn */
+    CORRADE_COMPARE(events, (std::vector<std::string>{"draw 0", "draw 0"}));
+    CORRADE_COMPARE(culling.occludedCount(), 0);
+}
+
+void OcclusionCullingTest::proxyTransformation() {
+    std::vector<std::string> events;
+    DrawableGroup3D group;
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-10.0f));
+    (new IdDrawable{a, &group, 0, events})->setBoundingBox({{1.0f, 2.0f, 3.0f}, {3.0f, 6.0f, 9.0f}});
+    Camera3D camera{scene};
+
+    Culling culling{events};
+    culling.draw(camera, group);
+    culling.results[0] = 0;
+    culling.draw(camera, group);
+    CORRADE_COMPARE(culling.proxyTransformation,
+        Matrix4::translation({2.0f, 4.0f, -4.0f})*Matrix4::scaling({1.0f, 2.0f, 3.0f}));
+}
+
+void OcclusionCullingTest::removed() {
+    std::vector<std::string> events;
+    DrawableGroup3D group;
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-10.0f));
+    auto first = new IdDrawable{a, &group, 0, events};
+    new IdDrawable{a, &group, 1, events};
+    Camera3D camera{scene};
+
+    Culling culling{events};
+    culling.setVisibleTestInterval(1);
+    culling.draw(camera, group);
+    delete first;
+    culling.results[1] = 1;
+    culling.draw(camera, group);
+
+    /* The new drawable reuses the query id of the removed one */
+    new IdDrawable{a, &group, 2, events};
+    culling.results[0] = -1;
+    events.clear();
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{
+        "begin 1", "draw 1", "end 1", "begin 0", "draw 2", "end 0"}));
+}
+
+void OcclusionCullingTest::reset() {
+    std::vector<std::string> events;
+    DrawableGroup3D group;
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-10.0f));
+    new IdDrawable{a, &group, 0, events};
+    Camera3D camera{scene};
+
+    Culling culling{events};
+    culling.setVisibleTestInterval(1);
+    culling.draw(camera, group);
+    culling.results[0] = 0;
+    culling.draw(camera, group);
+    CORRADE_COMPARE(culling.occludedCount(), 1);
+
+    /* The drawable is visible after a reset, pending result ignored */
+    culling.reset();
+    culling.results[0] = -1;
+    events.clear();
+    culling.draw(camera, group);
+    CORRADE_COMPARE(events, (std::vector<std::string>{
+        "begin 0", "draw 0", "end 0"}));
+    CORRADE_COMPARE(culling.occludedCount(), 0);
+}
+
+void OcclusionCullingTest::setVisibleTestIntervalZero() {
+    std::vector<std::string> events;
+    Culling culling{events};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    culling.setVisibleTestInterval(0);
+    CORRADE_COMPARE(out.str(), "SceneGraph::OcclusionCulling::setVisibleTestInterval(): expected a non-zero interval\n");
+    CORRADE_COMPARE(culling.visibleTestInterval(), 4);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::OcclusionCullingTest)
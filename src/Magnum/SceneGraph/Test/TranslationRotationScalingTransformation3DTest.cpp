@@ -39,6 +39,7 @@ struct TranslationRotationScalingTransformation3DTest: TestSuite::Tester {
     void fromMatrix();
     void toMatrix();
     void compose();
+    void composeAffine();
     void inverted();
 
     void defaults();
@@ -48,12 +49,15 @@ struct TranslationRotationScalingTransformation3DTest: TestSuite::Tester {
     void translate();
     void rotate();
     void scale();
+
+    void cachedTransformation();
 };
 
 TranslationRotationScalingTransformation3DTest::TranslationRotationScalingTransformation3DTest() {
     addTests({&TranslationRotationScalingTransformation3DTest::fromMatrix,
               &TranslationRotationScalingTransformation3DTest::toMatrix,
               &TranslationRotationScalingTransformation3DTest::compose,
+              &TranslationRotationScalingTransformation3DTest::composeAffine,
               &TranslationRotationScalingTransformation3DTest::inverted,
 
               &TranslationRotationScalingTransformation3DTest::defaults,
@@ -62,7 +66,9 @@ TranslationRotationScalingTransformation3DTest::TranslationRotationScalingTransf
 
               &TranslationRotationScalingTransformation3DTest::translate,
               &TranslationRotationScalingTransformation3DTest::rotate,
-              &TranslationRotationScalingTransformation3DTest::scale});
+              &TranslationRotationScalingTransformation3DTest::scale,
+
+              &TranslationRotationScalingTransformation3DTest::cachedTransformation});
 }
 
 using namespace Math::Literals;
@@ -83,6 +89,12 @@ void TranslationRotationScalingTransformation3DTest::compose() {
     CORRADE_COMPARE(Implementation::Transformation<TranslationRotationScalingTransformation3D>::compose(parent, child), parent*child);
 }
 
+void TranslationRotationScalingTransformation3DTest::composeAffine() {
+    Matrix4 parent = Matrix4::translation({7.0f, -1.0f, 2.2f})*Matrix4::rotationY(-32.0_degf)*Matrix4::scaling({1.5f, 0.5f, 3.0f});
+    Matrix4 child = Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::rotationX(17.0_degf)*Matrix4::scaling({2.0f, 1.4f, -2.1f});
+    CORRADE_COMPARE(Implementation::Transformation<TranslationRotationScalingTransformation3D>::compose(parent, child), parent*child);
+}
+
 void TranslationRotationScalingTransformation3DTest::inverted() {
     Matrix4 m = Matrix4::rotationX(17.0_degf)*Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::scaling({2.0f, 1.4f, -2.1f});
     CORRADE_COMPARE(Implementation::Transformation<TranslationRotationScalingTransformation3D>::inverted(m)*m, Matrix4());
@@ -234,6 +246,32 @@ void TranslationRotationScalingTransformation3DTest::scale() {
     }
 }
 
+void TranslationRotationScalingTransformation3DTest::cachedTransformation() {
+    Object3D o;
+    o.setTranslation({7.0f, -1.0f, 2.2f});
+    CORRADE_COMPARE(o.transformationMatrix(),
+        Matrix4::translation({7.0f, -1.0f, 2.2f}));
+
+    /* Querying again gives the same result */
+    CORRADE_COMPARE(o.transformationMatrix(),
+        Matrix4::translation({7.0f, -1.0f, 2.2f}));
+
+    /* Each setter invalidates the cached matrix */
+    o.setRotation(Quaternion::rotation(17.0_degf, Vector3::xAxis()));
+    CORRADE_COMPARE(o.transformationMatrix(),
+        Matrix4::translation({7.0f, -1.0f, 2.2f})*
+        Matrix4::rotationX(17.0_degf));
+
+    o.setScaling({1.5f, 0.5f, 3.0f});
+    CORRADE_COMPARE(o.transformationMatrix(),
+        Matrix4::translation({7.0f, -1.0f, 2.2f})*
+        Matrix4::rotationX(17.0_degf)*
+        Matrix4::scaling({1.5f, 0.5f, 3.0f}));
+
+    o.resetTransformation();
+    CORRADE_COMPARE(o.transformationMatrix(), Matrix4{});
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TranslationRotationScalingTransformation3DTest)
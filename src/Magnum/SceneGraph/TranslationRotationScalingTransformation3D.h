@@ -47,6 +47,13 @@ scaling is always applied first, rotation second and translation last. In
 particular, unlike with matrix-based transformation implementation, it's not
 possible to rotate a translated object, for example --- one has to apply the
 rotation first and then translate using a rotated vector.
+
+The transformation matrix is built from the translation, rotation and scaling
+only when queried through @ref transformation() and is cached until one of
+them changes, so objects that don't move don't rebuild it on every
+transformation update. Composing the transformations with parent objects uses
+the fact that all of them are affine and skips the calculation of the bottom
+matrix row.
 @see @ref scenegraph, @ref TranslationRotationScalingTransformation3D,
     @ref BasicTranslationRotationScalingTransformation2D
 */
@@ -317,6 +324,10 @@ template<class T> class BasicTranslationRotationScalingTransformation3D: public
         /* Can't {} on GCC 4.7, _scaling(T(1)) fails on the most vexing parse
            (what the ... eh???) */
         Math::Vector3<T> _scaling = Math::Vector3<T>(T(1));
+
+        /* Cached matrix built from the above */
+        mutable Math::Matrix4<T> _transformation;
+        mutable bool _transformationDirty = false;
 };
 
 /**
@@ -327,8 +338,18 @@ template<class T> class BasicTranslationRotationScalingTransformation3D: public
 typedef BasicTranslationRotationScalingTransformation3D<Float> TranslationRotationScalingTransformation3D;
 
 template<class T> Math::Matrix4<T> BasicTranslationRotationScalingTransformation3D<T>::transformation() const {
-    return Math::Matrix4<T>::from(_rotation.toMatrix(), _translation)*
-        Math::Matrix4<T>::scaling(_scaling);
+    if(_transformationDirty) {
+        /* Scaling the rotation columns directly is equivalent to multiplying
+           with a scaling matrix */
+        const Math::Matrix3x3<T> rotation = _rotation.toMatrix();
+        _transformation = Math::Matrix4<T>::from(
+            Math::Matrix3x3<T>{rotation[0]*_scaling.x(),
+                               rotation[1]*_scaling.y(),
+                               rotation[2]*_scaling.z()}, _translation);
+        _transformationDirty = false;
+    }
+
+    return _transformation;
 }
 
 template<class T> Object<BasicTranslationRotationScalingTransformation3D<T>>& BasicTranslationRotationScalingTransformation3D<T>::setTransformation(const Math::Matrix4<T>& transformation) {
@@ -339,6 +360,7 @@ template<class T> Object<BasicTranslationRotationScalingTransformation3D<T>>& Ba
         _translation = transformation.translation();
         _rotation = Math::Quaternion<T>::fromMatrix(transformation.rotationShear());
         _scaling = transformation.scaling();
+        _transformationDirty = true;
         static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>*>(this)->setDirty();
     }
 
@@ -351,6 +373,7 @@ template<class T> Object<BasicTranslationRotationScalingTransformation3D<T>>& Ba
     /** @todo Do this in some common code so we don't need to include Object? */
     if(!static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>*>(this)->isScene()) {
         _translation = translation;
+        _transformationDirty = true;
         static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>*>(this)->setDirty();
     }
 
@@ -363,6 +386,7 @@ template<class T> Object<BasicTranslationRotationScalingTransformation3D<T>>& Ba
     /** @todo Do this in some common code so we don't need to include Object? */
     if(!static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>*>(this)->isScene()) {
         _rotation = rotation;
+        _transformationDirty = true;
         static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>*>(this)->setDirty();
     }
 
@@ -375,6 +399,7 @@ template<class T> Object<BasicTranslationRotationScalingTransformation3D<T>>& Ba
     /** @todo Do this in some common code so we don't need to include Object? */
     if(!static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>*>(this)->isScene()) {
         _scaling = scaling;
+        _transformationDirty = true;
         static_cast<Object<BasicTranslationRotationScalingTransformation3D<T>>*>(this)->setDirty();
     }
 
@@ -393,7 +418,15 @@ template<class T> struct Transformation<BasicTranslationRotationScalingTransform
     }
 
     static Math::Matrix4<T> compose(const Math::Matrix4<T>& parent, const Math::Matrix4<T>& child) {
-        return parent*child;
+        /* Both matrices are affine, so the bottom row is always (0, 0, 0, 1)
+           and there's no need to calculate it */
+        const Math::Vector3<T> a = parent[0].xyz();
+        const Math::Vector3<T> b = parent[1].xyz();
+        const Math::Vector3<T> c = parent[2].xyz();
+        return {{a*child[0][0] + b*child[0][1] + c*child[0][2], T(0)},
+                {a*child[1][0] + b*child[1][1] + c*child[1][2], T(0)},
+                {a*child[2][0] + b*child[2][1] + c*child[2][2], T(0)},
+                {a*child[3][0] + b*child[3][1] + c*child[3][2] + parent[3].xyz(), T(1)}};
     }
 
     static Math::Matrix4<T> inverted(const Math::Matrix4<T>& transformation) {
@@ -25,14 +25,18 @@
 
 #include "Magnum/SceneGraph/AbstractFeature.hpp"
 #include "Magnum/SceneGraph/Animable.hpp"
+#include "Magnum/SceneGraph/BoundingVolumeHierarchy.hpp"
 #include "Magnum/SceneGraph/Camera.hpp"
+#include "Magnum/SceneGraph/DamageTracker.hpp"
 #include "Magnum/SceneGraph/Drawable.hpp"
 #include "Magnum/SceneGraph/DualComplexTransformation.h"
 #include "Magnum/SceneGraph/DualQuaternionTransformation.h"
 #include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/FlatScene.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Object.hpp"
+#include "Magnum/SceneGraph/OcclusionCulling.hpp"
 #include "Magnum/SceneGraph/RigidMatrixTransformation2D.h"
 #include "Magnum/SceneGraph/RigidMatrixTransformation3D.h"
 #include "Magnum/SceneGraph/TranslationTransformation.h"
@@ -65,12 +69,26 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP Animable<3, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP AnimableGroup<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP AnimableGroup<3, Float>;
 
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BoundingVolumeHierarchy<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BoundingVolumeHierarchy<3, Float>;
+
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Camera<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Camera<3, Float>;
+/* Member templates are not covered by the extern template declarations, so
+   these are exported always */
+template MAGNUM_SCENEGRAPH_EXPORT void Camera<2, Float>::drawRigid<BasicDualComplexTransformation<Float>>(DrawableGroup<2, Float>&, RigidDrawableTransformations<2, Float>&);
+template MAGNUM_SCENEGRAPH_EXPORT void Camera<3, Float>::drawRigid<BasicDualQuaternionTransformation<Float>>(DrawableGroup<3, Float>&, RigidDrawableTransformations<3, Float>&);
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BasicDamageTracker2D<Float>;
 
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<3, Float>;
 
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatScene<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatScene<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BasicOcclusionCulling3D<Float>;
+
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicDualComplexTransformation<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicDualQuaternionTransformation<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicMatrixTransformation2D<Float>>;
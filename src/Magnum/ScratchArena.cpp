@@ -0,0 +1,99 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ScratchArena.h"
+
+#include <cstdint>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum {
+
+namespace {
+
+#if !defined(CORRADE_GCC47_COMPATIBILITY) && !defined(CORRADE_TARGET_APPLE)
+thread_local
+#else
+__thread
+#endif
+ScratchArena* currentArena = nullptr;
+
+}
+
+ScratchArena::ScratchArena(const std::size_t blockSize): _blockSize{blockSize}, _usedSize{}, _currentBlock{}, _currentOffset{} {}
+
+ScratchArena::ScratchArena(ScratchArena&&) noexcept = default;
+
+ScratchArena::~ScratchArena() = default;
+
+ScratchArena& ScratchArena::operator=(ScratchArena&&) noexcept = default;
+
+std::size_t ScratchArena::capacity() const {
+    std::size_t size = 0;
+    for(const Containers::Array<char>& block: _blocks) size += block.size();
+    return size;
+}
+
+void* ScratchArena::allocate(const std::size_t size, const std::size_t alignment) {
+    CORRADE_ASSERT(alignment && !(alignment & (alignment - 1)),
+        "ScratchArena::allocate(): expected alignment to be a power of two but got" << alignment, nullptr);
+
+    if(!size) return nullptr;
+
+    /* Find the first block, starting from the current one, that has enough
+       space for the aligned allocation */
+    for(; _currentBlock < _blocks.size(); ++_currentBlock, _currentOffset = 0) {
+        Containers::Array<char>& block = _blocks[_currentBlock];
+        const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(block.data());
+        const std::size_t offset = ((begin + _currentOffset + alignment - 1) & ~(alignment - 1)) - begin;
+        if(offset + size > block.size()) continue;
+
+        _currentOffset = offset + size;
+        _usedSize += size;
+        return block.data() + offset;
+    }
+
+    /* None found, add a new one. Oversized allocations get a dedicated block
+       with enough space for the alignment padding. */
+    _blocks.emplace_back(Containers::NoInit, size + alignment - 1 > _blockSize ? size + alignment - 1 : _blockSize);
+    Containers::Array<char>& block = _blocks.back();
+    const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(block.data());
+    const std::size_t offset = ((begin + alignment - 1) & ~(alignment - 1)) - begin;
+    _currentOffset = offset + size;
+    _usedSize += size;
+    return block.data() + offset;
+}
+
+void ScratchArena::reset() {
+    _usedSize = _currentBlock = _currentOffset = 0;
+}
+
+ScratchArena* ScratchArena::current() { return currentArena; }
+
+void ScratchArena::setCurrent(ScratchArena* const arena) {
+    currentArena = arena;
+}
+
+}
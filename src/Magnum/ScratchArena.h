@@ -0,0 +1,172 @@
+#ifndef Magnum_ScratchArena_h
+#define Magnum_ScratchArena_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::ScratchArena
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Scratch memory arena
+
+Linear allocator for short-lived temporary memory, such as intermediate
+buffers of a mesh processing step or per-frame transformation lists.
+Allocation just bumps a pointer inside a block, @ref reset() makes all memory
+available again while keeping the blocks allocated, so once the arena grows
+to the size needed by the largest workload, no further heap allocations are
+made. The arena is not thread-safe.
+
+@section ScratchArena-jobs Job scratch memory
+
+The @ref JobSystem has one arena for each worker and passes it to the job
+functions. The arena is reset after each job, so the memory is valid only
+until the job function returns.
+
+@section ScratchArena-frame Frame arena
+
+An arena set with @ref Timeline::setFrameArena() is made current for the
+thread calling @ref Timeline::start() and is reset in every
+@ref Timeline::nextFrame(). Library code that needs per-call temporaries,
+such as @ref SceneGraph::Camera::draw() or @ref Text::AbstractRenderer::render(),
+then takes them from @ref current() instead of going to the heap allocator
+every frame:
+
+@snippet Magnum.cpp ScratchArena-frame
+
+Memory allocated from the frame arena is valid until the end of the frame.
+If there's no current arena, the library code falls back to the heap.
+*/
+class MAGNUM_EXPORT ScratchArena {
+    public:
+        /**
+         * @brief Constructor
+         * @param blockSize     Size of a block in bytes
+         *
+         * No memory is allocated until the first call to @ref allocate().
+         * Allocations larger than @p blockSize get a dedicated block.
+         */
+        explicit ScratchArena(std::size_t blockSize = 65536);
+
+        /** @brief Copying is not allowed */
+        ScratchArena(const ScratchArena&) = delete;
+
+        /** @brief Move constructor */
+        ScratchArena(ScratchArena&&) noexcept;
+
+        ~ScratchArena();
+
+        /** @brief Copying is not allowed */
+        ScratchArena& operator=(const ScratchArena&) = delete;
+
+        /** @brief Move assignment */
+        ScratchArena& operator=(ScratchArena&&) noexcept;
+
+        /** @brief Block size */
+        std::size_t blockSize() const { return _blockSize; }
+
+        /**
+         * @brief Total size of allocated blocks
+         *
+         * Memory owned by the arena, either in use or ready for reuse after
+         * @ref reset().
+         */
+        std::size_t capacity() const;
+
+        /**
+         * @brief Size of memory in use
+         *
+         * Sum of sizes passed to @ref allocate() since construction or last
+         * @ref reset(), not including alignment padding.
+         */
+        std::size_t usedSize() const { return _usedSize; }
+
+        /**
+         * @brief Allocate memory
+         * @param size          Size in bytes
+         * @param alignment     Alignment in bytes, expected to be a power of
+         *      two
+         *
+         * The memory is not initialized and is valid until @ref reset() or
+         * destruction of the arena. If @p size is zero, returns
+         * @cpp nullptr @ce.
+         */
+        void* allocate(std::size_t size, std::size_t alignment = 16);
+
+        /**
+         * @brief Allocate an array
+         *
+         * Allocates memory for @p size items of type @p T using
+         * @ref allocate(). The items are not initialized and no destructors
+         * are called, so @p T should be a trivial type.
+         */
+        template<class T> Containers::ArrayView<T> allocate(std::size_t size) {
+            return {static_cast<T*>(allocate(size*sizeof(T), alignof(T))), size};
+        }
+
+        /**
+         * @brief Reset the arena
+         *
+         * Makes all memory available for reuse. No memory is freed.
+         */
+        void reset();
+
+        /**
+         * @brief Current arena
+         *
+         * Arena used by library code for temporary allocations on the
+         * calling thread, @cpp nullptr @ce if there's none. Each thread has
+         * its own.
+         * @see @ref setCurrent(), @ref Timeline::setFrameArena()
+         */
+        static ScratchArena* current();
+
+        /**
+         * @brief Set current arena
+         *
+         * Affects only the calling thread. Pass @cpp nullptr @ce to make
+         * library code use the heap again. The arena is expected to stay
+         * alive until it's replaced with another or unset.
+         */
+        static void setCurrent(ScratchArena* arena);
+
+    private:
+        std::size_t _blockSize, _usedSize;
+        std::vector<Containers::Array<char>> _blocks;
+        std::size_t _currentBlock, _currentOffset;
+};
+
+}
+
+#endif
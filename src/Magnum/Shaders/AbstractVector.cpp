@@ -25,7 +25,12 @@
 
 #include "AbstractVector.h"
 
+#include <Corrade/Containers/EnumSet.hpp>
+
 #include "Magnum/GL/Texture.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/GL/TextureArray.h"
+#endif
 #include "Magnum/Shaders/visibility.h"
 
 namespace Magnum { namespace Shaders {
@@ -35,9 +40,48 @@ template<UnsignedInt dimensions> AbstractVector<dimensions>& AbstractVector<dime
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+template<UnsignedInt dimensions> AbstractVector<dimensions>& AbstractVector<dimensions>::bindVectorTexture(GL::Texture2DArray& texture) {
+    CORRADE_ASSERT(_flags & Flag::TextureArrays,
+        "Shaders::AbstractVector::bindVectorTexture(): the shader was not created with texture arrays enabled", *this);
+    texture.bind(VectorTextureLayer);
+    return *this;
+}
+#endif
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHADERS_EXPORT AbstractVector<2>;
 template class MAGNUM_SHADERS_EXPORT AbstractVector<3>;
 #endif
 
+namespace Implementation {
+
+Debug& operator<<(Debug& debug, const VectorFlag value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case VectorFlag::v: return debug << "Shaders::AbstractVector::Flag::" #v;
+        _c(VertexColor)
+        _c(MultiChannel)
+        #ifndef MAGNUM_TARGET_GLES2
+        _c(TextureArrays)
+        #endif
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Shaders::AbstractVector::Flag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const VectorFlags value) {
+    return Containers::enumSetDebugOutput(debug, value, "Shaders::AbstractVector::Flags{}", {
+        VectorFlag::VertexColor,
+        VectorFlag::MultiChannel,
+        #ifndef MAGNUM_TARGET_GLES2
+        VectorFlag::TextureArrays
+        #endif
+        });
+}
+
+}
+
 }}
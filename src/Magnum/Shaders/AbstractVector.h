@@ -29,11 +29,25 @@
  * @brief Class @ref Magnum::Shaders::AbstractVector, typedef @ref Magnum::Shaders::AbstractVector2D, @ref Magnum::Shaders::AbstractVector3D
  */
 
+#include <Corrade/Containers/EnumSet.h>
+
 #include "Magnum/GL/AbstractShaderProgram.h"
 #include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/visibility.h"
 
 namespace Magnum { namespace Shaders {
 
+namespace Implementation {
+    enum class VectorFlag: UnsignedByte {
+        VertexColor = 1 << 0,
+        MultiChannel = 1 << 1,
+        #ifndef MAGNUM_TARGET_GLES2
+        TextureArrays = 1 << 2
+        #endif
+    };
+    typedef Containers::EnumSet<VectorFlag> VectorFlags;
+}
+
 /**
 @brief Base for vector shaders
 
@@ -59,6 +73,92 @@ template<UnsignedInt dimensions> class AbstractVector: public GL::AbstractShader
          */
         typedef typename Generic<dimensions>::TextureCoordinates TextureCoordinates;
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief 2D array texture coordinates
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @ref Magnum::Vector3 "Vector3", with the third component being the
+         * texture layer. Shares the location with @ref TextureCoordinates,
+         * use this one instead if @ref Flag::TextureArrays is set.
+         * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        typedef GL::Attribute<Generic<dimensions>::TextureCoordinates::Location, Vector3> TextureArrayCoordinates;
+        #endif
+
+        /**
+         * @brief Three-component vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color3. Use
+         * either this or the @ref Color4 attribute. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef typename Generic<dimensions>::Color3 Color3;
+
+        /**
+         * @brief Four-component vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color4. Use
+         * either this or the @ref Color3 attribute. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef typename Generic<dimensions>::Color4 Color4;
+
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Multiply the fill color with a @ref Color3 / @ref Color4
+             * attribute. Useful for rendering many differently colored texts
+             * in a single draw call, see @ref Text::BatchRenderer for an
+             * example.
+             */
+            VertexColor = 1 << 0,
+
+            /**
+             * Treat the texture as a multi-channel signed distance field and
+             * use median of its red, green and blue channel as the distance.
+             * Multi-channel distance fields preserve sharp corners even at
+             * low texture resolutions. Used only by
+             * @ref DistanceFieldVector, ignored by @ref Vector. See also
+             * @ref Text::DistanceFieldGlyphCache::Flag::MultiChannel.
+             */
+            MultiChannel = 1 << 1,
+
+            /**
+             * Sample the vector texture from a 2D array texture bound with
+             * @ref bindVectorTexture(GL::Texture2DArray&), with the layer
+             * taken from the third component of the
+             * @ref TextureArrayCoordinates attribute. Useful for rendering
+             * texts in many fonts in a single draw call, see
+             * @ref Text::GlyphCacheArray for an example.
+             * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+             * @requires_gles30 Texture arrays are not available in OpenGL ES
+             *      2.0.
+             * @requires_webgl20 Texture arrays are not available in WebGL
+             *      1.0.
+             */
+            TextureArrays = 1 << 2
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+        #else
+        typedef Implementation::VectorFlag Flag;
+        typedef Implementation::VectorFlags Flags;
+        #endif
+
         /** @brief Copying is not allowed */
         AbstractVector(const AbstractVector<dimensions>&) = delete;
 
@@ -71,12 +171,30 @@ template<UnsignedInt dimensions> class AbstractVector: public GL::AbstractShader
         /** @brief Move assignment */
         AbstractVector<dimensions>& operator=(AbstractVector<dimensions>&&) noexcept = default;
 
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
         /**
          * @brief Bind vector texture
          * @return Reference to self (for method chaining)
          */
         AbstractVector<dimensions>& bindVectorTexture(GL::Texture2D& texture);
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Bind vector array texture
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::TextureArrays
+         * enabled.
+         * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        AbstractVector<dimensions>& bindVectorTexture(GL::Texture2DArray& texture);
+        #endif
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /** @brief @copybrief bindVectorTexture()
          * @deprecated Use @ref bindVectorTexture() instead.
@@ -94,8 +212,11 @@ template<UnsignedInt dimensions> class AbstractVector: public GL::AbstractShader
         enum: Int { VectorTextureLayer = 15 };
 
         explicit AbstractVector(NoCreateT) noexcept: GL::AbstractShaderProgram{NoCreate} {}
-        explicit AbstractVector() = default;
+        explicit AbstractVector(Flags flags = {}): _flags{flags} {}
         ~AbstractVector() = default;
+
+    private:
+        Flags _flags;
 };
 
 /** @brief Base for two-dimensional text shaders */
@@ -104,6 +225,20 @@ typedef AbstractVector<2> AbstractVector2D;
 /** @brief Base for three-dimensional text shader */
 typedef AbstractVector<3> AbstractVector3D;
 
+#ifdef DOXYGEN_GENERATING_OUTPUT
+/** @debugoperatorclassenum{AbstractVector,AbstractVector::Flag} */
+template<UnsignedInt dimensions> Debug& operator<<(Debug& debug, AbstractVector<dimensions>::Flag value);
+
+/** @debugoperatorclassenum{AbstractVector,AbstractVector::Flags} */
+template<UnsignedInt dimensions> Debug& operator<<(Debug& debug, AbstractVector<dimensions>::Flags value);
+#else
+namespace Implementation {
+    MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, VectorFlag value);
+    MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, VectorFlags value);
+    CORRADE_ENUMSET_OPERATORS(VectorFlags)
+}
+#endif
+
 }}
 
 #endif
@@ -45,11 +45,32 @@ in highp vec4 position;
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = TEXTURECOORDINATES_ATTRIBUTE_LOCATION)
 #endif
+#ifndef TEXTURE_ARRAYS
 in mediump vec2 textureCoordinates;
 
 out mediump vec2 fragmentTextureCoordinates;
+#else
+/* Third component is the layer */
+in mediump vec3 textureCoordinates;
+
+out mediump vec3 fragmentTextureCoordinates;
+#endif
+
+#ifdef VERTEX_COLOR
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION)
+#endif
+in lowp vec4 vertexColor;
+
+out lowp vec4 interpolatedVertexColor;
+#endif
 
 void main() {
     gl_Position = transformationProjectionMatrix*position;
     fragmentTextureCoordinates = textureCoordinates;
+
+    #ifdef VERTEX_COLOR
+    /* Vertex colors, if enabled */
+    interpolatedVertexColor = vertexColor;
+    #endif
 }
@@ -0,0 +1,187 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DeferredLight.h"
+
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    enum: Int {
+        AlbedoTextureLayer = 0,
+        NormalTextureLayer = 1,
+        DepthTextureLayer = 2
+    };
+}
+
+DeferredLight::DeferredLight(const Flags flags): _flags{flags} {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumShaders"))
+        importShaderResources();
+    #endif
+    Utility::Resource rs("MagnumShaders");
+
+    /* gl_VertexID and texelFetch() need GLSL 1.30 */
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    const GL::Version version = GL::Context::current().supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300});
+    #else
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GLES300);
+    const GL::Version version = GL::Version::GLES300;
+    #endif
+
+    GL::Shader vert = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Vertex);
+    GL::Shader frag = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Fragment);
+
+    vert.addSource(flags & Flag::Directional ? "#define DIRECTIONAL\n" : "")
+        .addSource(rs.get("generic.glsl"))
+        .addSource(flags & Flag::Directional ? rs.get("FullScreenTriangle.glsl") : "")
+        .addSource(rs.get("DeferredLight.vert"));
+    frag.addSource(flags & Flag::Directional ? "#define DIRECTIONAL\n" : "")
+        .addSource(rs.get("DeferredLight.frag"));
+
+    /* Load the program from the binary cache, if there's one, otherwise
+       compile and link it from the sources */
+    if(!loadCachedBinary({vert, frag})) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+
+        attachShaders({vert, frag});
+
+        /* ES3 has explicit attribute locations always */
+        #ifndef MAGNUM_TARGET_GLES
+        if(!(flags & Flag::Directional) && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
+            bindAttributeLocation(Position::Location, "position");
+        #endif
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        saveCachedBinary({vert, frag});
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
+    #endif
+    {
+        _projectionMatrixUniform = uniformLocation("projectionMatrix");
+        _inverseProjectionMatrixUniform = uniformLocation("inverseProjectionMatrix");
+        _lightPositionUniform = uniformLocation("lightPosition");
+        _lightRangeUniform = uniformLocation("lightRange");
+        _lightColorUniform = uniformLocation("lightColor");
+        _ambientColorUniform = uniformLocation("ambientColor");
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
+    #endif
+    {
+        setUniform(uniformLocation("albedoTexture"), AlbedoTextureLayer);
+        setUniform(uniformLocation("normalTexture"), NormalTextureLayer);
+        setUniform(uniformLocation("depthTexture"), DepthTextureLayer);
+    }
+
+    /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
+    #ifdef MAGNUM_TARGET_GLES
+    setProjectionMatrix({});
+    if(!(flags & Flag::Directional)) setLightRange(1.0f);
+    setLightColor(Color3{1.0f});
+    /* Light position and ambient color is zero by default */
+    #endif
+}
+
+DeferredLight& DeferredLight::setProjectionMatrix(const Matrix4& matrix) {
+    setUniform(_projectionMatrixUniform, matrix);
+    setUniform(_inverseProjectionMatrixUniform, matrix.inverted());
+    return *this;
+}
+
+DeferredLight& DeferredLight::setLightPosition(const Vector3& position) {
+    setUniform(_lightPositionUniform, position);
+    return *this;
+}
+
+DeferredLight& DeferredLight::setLightRange(const Float range) {
+    CORRADE_ASSERT(!(_flags & Flag::Directional),
+        "Shaders::DeferredLight::setLightRange(): the shader was created with a directional light", *this);
+    setUniform(_lightRangeUniform, range);
+    return *this;
+}
+
+DeferredLight& DeferredLight::setLightColor(const Color3& color) {
+    setUniform(_lightColorUniform, color);
+    return *this;
+}
+
+DeferredLight& DeferredLight::setAmbientColor(const Color3& color) {
+    CORRADE_ASSERT(_flags & Flag::Directional,
+        "Shaders::DeferredLight::setAmbientColor(): the shader was not created with a directional light", *this);
+    setUniform(_ambientColorUniform, color);
+    return *this;
+}
+
+DeferredLight& DeferredLight::bindAlbedoTexture(GL::Texture2D& texture) {
+    texture.bind(AlbedoTextureLayer);
+    return *this;
+}
+
+DeferredLight& DeferredLight::bindNormalTexture(GL::Texture2D& texture) {
+    texture.bind(NormalTextureLayer);
+    return *this;
+}
+
+DeferredLight& DeferredLight::bindDepthTexture(GL::Texture2D& texture) {
+    texture.bind(DepthTextureLayer);
+    return *this;
+}
+
+Debug& operator<<(Debug& debug, const DeferredLight::Flag value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case DeferredLight::Flag::v: return debug << "Shaders::DeferredLight::Flag::" #v;
+        _c(Directional)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Shaders::DeferredLight::Flag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const DeferredLight::Flags value) {
+    return Containers::enumSetDebugOutput(debug, value, "Shaders::DeferredLight::Flags{}", {
+        DeferredLight::Flag::Directional});
+}
+
+}}
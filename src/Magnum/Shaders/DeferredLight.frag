@@ -0,0 +1,138 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 0)
+#endif
+uniform lowp sampler2D albedoTexture;
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 1)
+#endif
+uniform mediump sampler2D normalTexture;
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 2)
+#endif
+uniform highp sampler2D depthTexture;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 1)
+#endif
+uniform highp mat4 inverseProjectionMatrix
+    #ifndef GL_ES
+    = mat4(1.0)
+    #endif
+    ;
+
+/* Light direction with DIRECTIONAL */
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 2)
+#endif
+uniform highp vec3 lightPosition; /* defaults to zero */
+
+#ifndef DIRECTIONAL
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 3)
+#endif
+uniform highp float lightRange
+    #ifndef GL_ES
+    = 1.0
+    #endif
+    ;
+#endif
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 4)
+#endif
+uniform lowp vec3 lightColor
+    #ifndef GL_ES
+    = vec3(1.0)
+    #endif
+    ;
+
+#ifdef DIRECTIONAL
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 5)
+#endif
+uniform lowp vec3 ambientColor; /* defaults to zero */
+#endif
+
+out lowp vec4 color;
+
+/* Inverse of the octahedral encoding in Phong.frag */
+mediump vec3 octahedralDecode(mediump vec2 encoded) {
+    mediump vec3 normal = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+    if(normal.z < 0.0)
+        normal.xy = (vec2(1.0) - abs(normal.yx))*vec2(
+            normal.x >= 0.0 ? 1.0 : -1.0,
+            normal.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(normal);
+}
+
+void main() {
+    highp ivec2 coordinates = ivec2(gl_FragCoord.xy);
+    highp float depth = texelFetch(depthTexture, coordinates, 0).r;
+
+    /* Nothing was drawn here */
+    if(depth == 1.0) discard;
+
+    /* Reconstruct the view-space position from depth */
+    highp vec2 ndc = gl_FragCoord.xy/vec2(textureSize(depthTexture, 0))*2.0 - vec2(1.0);
+    highp vec4 viewPosition4 = inverseProjectionMatrix*vec4(ndc, depth*2.0 - 1.0, 1.0);
+    highp vec3 viewPosition = viewPosition4.xyz/viewPosition4.w;
+
+    lowp vec4 albedo = texelFetch(albedoTexture, coordinates, 0);
+    mediump vec4 normalShininess = texelFetch(normalTexture, coordinates, 0);
+    mediump vec3 normal = octahedralDecode(normalShininess.xy*2.0 - vec2(1.0));
+    mediump float shininess = exp2(normalShininess.z*10.0);
+
+    #ifdef DIRECTIONAL
+    highp vec3 normalizedLightDirection = normalize(lightPosition);
+    lowp float attenuation = 1.0;
+    #else
+    /* Smooth falloff to zero at the light range, same as with clustered
+       lights in Phong.frag */
+    highp vec3 lightDirection = lightPosition - viewPosition;
+    highp float distanceRatio = length(lightDirection)/lightRange;
+    lowp float attenuation = clamp(1.0 - distanceRatio*distanceRatio, 0.0, 1.0);
+    attenuation *= attenuation;
+    highp vec3 normalizedLightDirection = normalize(lightDirection);
+    #endif
+
+    lowp float intensity = max(0.0, dot(normal, normalizedLightDirection))*attenuation;
+    color = vec4(albedo.rgb*lightColor*intensity, 1.0);
+
+    /* Add specular color, if needed. Specular intensity is in albedo alpha. */
+    if(intensity > 0.001) {
+        highp vec3 reflection = reflect(-normalizedLightDirection, normal);
+        mediump float specularity = pow(max(0.0, dot(normalize(-viewPosition), reflection)), shininess);
+        color.rgb += lightColor*albedo.a*specularity*attenuation;
+    }
+
+    #ifdef DIRECTIONAL
+    color.rgb += albedo.rgb*ambientColor;
+    #endif
+}
@@ -0,0 +1,284 @@
+#ifndef Magnum_Shaders_DeferredLight_h
+#define Magnum_Shaders_DeferredLight_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::DeferredLight
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Deferred light accumulation shader
+
+Applies a single light to a G-buffer rendered with @ref Phong::Flag::GBuffer,
+reading the material from textures bound with @ref bindAlbedoTexture() and
+@ref bindNormalTexture() and reconstructing view-space position of each pixel
+from the depth texture bound with @ref bindDepthTexture() and the inverse of
+the matrix set with @ref setProjectionMatrix(). The lighting model and the
+point light falloff are the same as in @ref Phong with
+@ref Phong::Flag::ClusteredLights. The result of all lights is meant to be
+summed with additive blending.
+
+@section Shaders-DeferredLight-usage Usage
+
+A point light is drawn as a light volume --- a mesh enclosing an unit sphere,
+such as @ref Primitives::icosphereSolid(), with the @ref Position attribute.
+The shader scales it by the light range and places it at the light position
+so only pixels the light can affect are shaded. Back faces of the volume are
+drawn with a @ref GL::Renderer::DepthFunction::GreaterOrEqual depth test
+against the G-buffer depth and depth writes disabled, which rejects pixels
+behind the light range and works also when the camera is inside the volume.
+
+With @ref Flag::Directional the shader instead draws a full-screen triangle
+created with @ref MeshTools::fullScreenTriangle() for a light without any
+falloff, additionally applying the color set with @ref setAmbientColor(). Use
+it with depth test disabled, pixels not covered by any geometry are
+discarded.
+
+@code{.cpp}
+GL::Mesh sphere = MeshTools::compile(Primitives::icosphereSolid(1));
+GL::Mesh triangle = MeshTools::fullScreenTriangle().second;
+
+Shaders::DeferredLight pointShader;
+Shaders::DeferredLight directionalShader{Shaders::DeferredLight::Flag::Directional};
+
+// each frame, after filling the G-buffer
+GL::defaultFramebuffer.clear(GL::FramebufferClear::Color).bind();
+GL::Renderer::enable(GL::Renderer::Feature::Blending);
+GL::Renderer::setBlendFunction(GL::Renderer::BlendFunction::One,
+    GL::Renderer::BlendFunction::One);
+GL::Renderer::setDepthMask(false);
+
+GL::Renderer::disable(GL::Renderer::Feature::DepthTest);
+directionalShader
+    .setProjectionMatrix(projection)
+    .setLightPosition(sunDirection)
+    .setLightColor(sunColor)
+    .setAmbientColor(0x111111_rgbf)
+    .bindAlbedoTexture(albedo)
+    .bindNormalTexture(normal)
+    .bindDepthTexture(depth);
+triangle.draw(directionalShader);
+
+GL::Renderer::enable(GL::Renderer::Feature::DepthTest);
+GL::Renderer::setDepthFunction(GL::Renderer::DepthFunction::GreaterOrEqual);
+GL::Renderer::enable(GL::Renderer::Feature::FaceCulling);
+GL::Renderer::setFaceCullingMode(GL::Renderer::PolygonFacing::Front);
+pointShader
+    .setProjectionMatrix(projection)
+    .bindAlbedoTexture(albedo)
+    .bindNormalTexture(normal)
+    .bindDepthTexture(depth);
+for(const Light& light: lights) {
+    pointShader
+        .setLightPosition(light.viewPosition)
+        .setLightRange(light.range)
+        .setLightColor(light.color);
+    sphere.draw(pointShader);
+}
+@endcode
+
+The G-buffer depth texture is sampled while being attached to the framebuffer
+used for the depth test, which is allowed only as long as depth writes are
+disabled. The pass doesn't use any tiling or compute shaders --- for scenes
+with many overlapping lights consider forward rendering with
+@ref Phong::Flag::ClusteredLights and @ref LightCulling instead. See
+@ref Shaders-Phong-usage-deferred for the G-buffer setup.
+
+@requires_gl30 Extension @gl_extension{EXT,gpu_shader4} for
+    @glsl gl_VertexID @ce and @glsl texelFetch() @ce
+@requires_gles30 Not available in OpenGL ES 2.0.
+@requires_webgl20 Not available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT DeferredLight: public GL::AbstractShaderProgram {
+    public:
+        /**
+         * @brief Vertex position
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @ref Magnum::Vector3 "Vector3". Not used with
+         * @ref Flag::Directional.
+         */
+        typedef Generic3D::Position Position;
+
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Directional light drawn with a full-screen triangle instead of
+             * a point light volume
+             */
+            Directional = 1 << 0
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit DeferredLight(Flags flags = {});
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit DeferredLight(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        DeferredLight(const DeferredLight&) = delete;
+
+        /** @brief Move constructor */
+        DeferredLight(DeferredLight&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        DeferredLight& operator=(const DeferredLight&) = delete;
+
+        /** @brief Move assignment */
+        DeferredLight& operator=(DeferredLight&&) noexcept = default;
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Set projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Expected to be the same matrix the G-buffer was rendered with. Its
+         * inverse is used for reconstructing the view-space position from
+         * depth. Initial value is an identity matrix.
+         */
+        DeferredLight& setProjectionMatrix(const Matrix4& matrix);
+
+        /**
+         * @brief Set light position
+         * @return Reference to self (for method chaining)
+         *
+         * View-space light position or, with @ref Flag::Directional, a
+         * view-space direction towards the light. Initial value is
+         * @cpp {0.0f, 0.0f, 0.0f} @ce.
+         */
+        DeferredLight& setLightPosition(const Vector3& position);
+
+        /**
+         * @brief Set light range
+         * @return Reference to self (for method chaining)
+         *
+         * Distance at which the light contribution falls off to zero. Expects
+         * that @ref Flag::Directional is not set. Initial value is
+         * @cpp 1.0f @ce.
+         */
+        DeferredLight& setLightRange(Float range);
+
+        /**
+         * @brief Set light color
+         * @return Reference to self (for method chaining)
+         *
+         * Tints both the diffuse and the specular contribution. Initial value
+         * is @cpp 0xffffff_rgbf @ce.
+         */
+        DeferredLight& setLightColor(const Color3& color);
+
+        /**
+         * @brief Set ambient color
+         * @return Reference to self (for method chaining)
+         *
+         * Multiplied with the G-buffer diffuse color and added to the light
+         * contribution. Expects that @ref Flag::Directional is set. Initial
+         * value is @cpp 0x000000_rgbf @ce.
+         */
+        DeferredLight& setAmbientColor(const Color3& color);
+
+        /**
+         * @brief Bind albedo texture
+         * @return Reference to self (for method chaining)
+         *
+         * Expects a @ref GL::TextureFormat::RGBA8 texture rendered to from
+         * @ref Phong::AlbedoOutput.
+         */
+        DeferredLight& bindAlbedoTexture(GL::Texture2D& texture);
+
+        /**
+         * @brief Bind normal texture
+         * @return Reference to self (for method chaining)
+         *
+         * Expects a @ref GL::TextureFormat::RGB10A2 texture rendered to from
+         * @ref Phong::NormalOutput.
+         */
+        DeferredLight& bindNormalTexture(GL::Texture2D& texture);
+
+        /**
+         * @brief Bind depth texture
+         * @return Reference to self (for method chaining)
+         *
+         * Expects the depth texture the G-buffer was rendered with.
+         */
+        DeferredLight& bindDepthTexture(GL::Texture2D& texture);
+
+    private:
+        Flags _flags;
+        Int _projectionMatrixUniform{0},
+            _inverseProjectionMatrixUniform{1},
+            _lightPositionUniform{2},
+            _lightRangeUniform{3},
+            _lightColorUniform{4},
+            _ambientColorUniform{5};
+};
+
+/** @debugoperatorclassenum{DeferredLight,DeferredLight::Flag} */
+MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, DeferredLight::Flag value);
+
+/** @debugoperatorclassenum{DeferredLight,DeferredLight::Flags} */
+MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, DeferredLight::Flags value);
+
+CORRADE_ENUMSET_OPERATORS(DeferredLight::Flags)
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -64,19 +64,39 @@ uniform lowp float smoothness
 #ifdef EXPLICIT_TEXTURE_LAYER
 layout(binding = 15)
 #endif
+#ifndef TEXTURE_ARRAYS
 uniform lowp sampler2D vectorTexture;
 
 in mediump vec2 fragmentTextureCoordinates;
+#else
+uniform lowp sampler2DArray vectorTexture;
+
+in mediump vec3 fragmentTextureCoordinates;
+#endif
+
+#ifdef VERTEX_COLOR
+in lowp vec4 interpolatedVertexColor;
+#endif
 
 #ifdef NEW_GLSL
 out lowp vec4 fragmentColor;
 #endif
 
 void main() {
+    #ifndef MULTI_CHANNEL
     lowp float intensity = texture(vectorTexture, fragmentTextureCoordinates).r;
+    #else
+    /* Median of the three channels */
+    lowp vec3 channels = texture(vectorTexture, fragmentTextureCoordinates).rgb;
+    lowp float intensity = max(min(channels.r, channels.g), min(max(channels.r, channels.g), channels.b));
+    #endif
 
     /* Fill color */
-    fragmentColor = smoothstep(outlineRange.x-smoothness, outlineRange.x+smoothness, intensity)*color;
+    fragmentColor = smoothstep(outlineRange.x-smoothness, outlineRange.x+smoothness, intensity)*
+        #ifdef VERTEX_COLOR
+        interpolatedVertexColor*
+        #endif
+        color;
 
     /* Outline */
     if(outlineRange.x > outlineRange.y) {
@@ -63,6 +63,15 @@ Common rendering setup:
 
 @snippet MagnumShaders.cpp DistanceFieldVector-usage2
 
+@section Shaders-DistanceFieldVector-multi-channel Multi-channel distance fields
+
+If @ref Flag::MultiChannel is set, the texture is expected to contain a
+multi-channel signed distance field in its red, green and blue channels and
+the shader uses their median as the distance. That keeps corners sharp even
+if the distance field texture is much smaller than what would be needed for
+a single-channel distance field. See
+@ref Text::DistanceFieldGlyphCache::Flag::MultiChannel for using it with text.
+
 @see @ref shaders, @ref DistanceFieldVector2D, @ref DistanceFieldVector3D
 @todo Use fragment shader derivations to have proper smoothness in perspective/
     large zoom levels, make it optional as it might have negative performance
@@ -70,7 +79,15 @@ Common rendering setup:
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT DistanceFieldVector: public AbstractVector<dimensions> {
     public:
-        explicit DistanceFieldVector();
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        typedef typename AbstractVector<dimensions>::Flags Flags;
+        #endif
+
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit DistanceFieldVector(Flags flags = {});
 
         /**
          * @brief Construct without creating the underlying OpenGL object
@@ -117,6 +134,8 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT DistanceFieldVector
          * @return Reference to self (for method chaining)
          *
          * Initial value is @cpp 0xffffffff_rgbaf @ce.
+         * If @ref Flag::VertexColor is set, the color is multiplied with
+         * the @ref Color3 / @ref Color4 attribute as well.
          * @see @ref setOutlineColor()
          */
         DistanceFieldVector& setColor(const Color4& color) {
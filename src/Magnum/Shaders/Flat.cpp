@@ -46,6 +46,9 @@ namespace {
 }
 
 template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): _flags(flags) {
+    CORRADE_ASSERT(!(flags & Flag::DepthOnly) || !(flags & ~(Flag::DepthOnly|Flag::InstancedTransformation)),
+        "Shaders::Flat: depth-only rendering can be combined only with instanced transformation", );
+
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
     if(!Utility::Resource::hasGroup("MagnumShaders"))
@@ -63,28 +66,39 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): _fla
     GL::Shader frag = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Fragment);
 
     vert.addSource(flags & Flag::Textured ? "#define TEXTURED\n" : "")
+        .addSource(flags & Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        .addSource(flags & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n" : "")
         .addSource(rs.get("generic.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
     frag.addSource(flags & Flag::Textured ? "#define TEXTURED\n" : "")
         .addSource(flags & Flag::AlphaMask ? "#define ALPHA_MASK\n" : "")
-        .addSource(rs.get("Flat.frag"));
-
-    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
-
-    attachShaders({vert, frag});
-
-    #ifndef MAGNUM_TARGET_GLES
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
-    #else
-    if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
-    #endif
-    {
-        bindAttributeLocation(Position::Location, "position");
-        if(flags & Flag::Textured) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        .addSource(flags & Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        .addSource(rs.get(flags & Flag::DepthOnly ? "DepthOnly.frag" : "Flat.frag"));
+
+    /* Load the program from the binary cache, if there's one, otherwise
+       compile and link it from the sources */
+    if(!loadCachedBinary({vert, frag})) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+
+        attachShaders({vert, frag});
+
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
+        #else
+        if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
+        #endif
+        {
+            bindAttributeLocation(Position::Location, "position");
+            if(flags & Flag::Textured) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+            if(flags & Flag::VertexColor) bindAttributeLocation(Color3::Location, "vertexColor"); /* Color4 is the same */
+            if(flags & Flag::InstancedTransformation) bindAttributeLocation(TransformationMatrix::Location, "instancedTransformationMatrix");
+        }
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        saveCachedBinary({vert, frag});
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
-
     #ifndef MAGNUM_TARGET_GLES
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
     #endif
@@ -104,7 +118,7 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): _fla
     /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
     #ifdef MAGNUM_TARGET_GLES
     setTransformationProjectionMatrix({});
-    setColor(Color4{1.0f});
+    setColor(Magnum::Color4{1.0f});
     if(flags & Flag::AlphaMask) setAlphaMask(0.5f);
     #endif
 }
@@ -134,6 +148,9 @@ Debug& operator<<(Debug& debug, const FlatFlag value) {
         #define _c(v) case FlatFlag::v: return debug << "Shaders::Flat::Flag::" #v;
         _c(Textured)
         _c(AlphaMask)
+        _c(VertexColor)
+        _c(InstancedTransformation)
+        _c(DepthOnly)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -144,7 +161,10 @@ Debug& operator<<(Debug& debug, const FlatFlag value) {
 Debug& operator<<(Debug& debug, const FlatFlags value) {
     return Containers::enumSetDebugOutput(debug, value, "Shaders::Flat::Flags{}", {
         FlatFlag::Textured,
-        FlatFlag::AlphaMask});
+        FlatFlag::AlphaMask,
+        FlatFlag::VertexColor,
+        FlatFlag::InstancedTransformation,
+        FlatFlag::DepthOnly});
 }
 
 }
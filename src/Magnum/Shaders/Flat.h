@@ -42,7 +42,10 @@ namespace Magnum { namespace Shaders {
 namespace Implementation {
     enum class FlatFlag: UnsignedByte {
         Textured = 1 << 0,
-        AlphaMask = 1 << 1
+        AlphaMask = 1 << 1,
+        VertexColor = 1 << 2,
+        InstancedTransformation = 1 << 3,
+        DepthOnly = 1 << 4
     };
     typedef Containers::EnumSet<FlatFlag> FlatFlags;
 }
@@ -96,6 +99,40 @@ operation which is known to have considerable performance impact on some
 platforms. With proper depth sorting and blending you'll usually get much
 better performance and output quality.
 
+@subsection Shaders-Flat-usage-instancing Instanced rendering
+
+Enabling @ref Flag::InstancedTransformation will make the shader additionally
+multiply the transformation with a per-instance @ref TransformationMatrix
+attribute, while @ref Flag::VertexColor multiplies the color with a
+@ref Color3 / @ref Color4 attribute. If the color buffer is added using
+@ref GL::Mesh::addVertexBufferInstanced(), the color is per-instance as well.
+A single draw then renders all instances set with
+@ref GL::Mesh::setInstanceCount():
+
+@snippet MagnumShaders.cpp Flat-usage-instancing
+
+@subsection Shaders-Flat-usage-depth-only Depth pre-pass
+
+With @ref Flag::DepthOnly the shader needs just the @ref Position attribute
+(and @ref TransformationMatrix with @ref Flag::InstancedTransformation) and
+doesn't do any fragment work, which makes it suitable for filling the depth
+buffer before the actual shading pass. The position is declared invariant,
+so the depth values written are exactly the same as when drawing with
+@ref Flag::DepthOnly disabled and the shading pass can use
+@ref GL::Renderer::DepthFunction::Equal with depth writes disabled. The same
+is not guaranteed for a different shader; use @ref Phong::Flag::DepthOnly for
+a pre-pass of meshes shaded with @ref Phong.
+
+@code{.cpp}
+Shaders::Flat3D depthShader{Shaders::Flat3D::Flag::DepthOnly};
+depthShader.setTransformationProjectionMatrix(transformationProjection);
+mesh.draw(depthShader);
+
+GL::Renderer::setDepthFunction(GL::Renderer::DepthFunction::Equal);
+GL::Renderer::setDepthMask(false);
+mesh.draw(shader);
+@endcode
+
 @see @ref shaders, @ref Flat2D, @ref Flat3D
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::AbstractShaderProgram {
@@ -118,6 +155,33 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::Ab
          */
         typedef typename Generic<dimensions>::TextureCoordinates TextureCoordinates;
 
+        /**
+         * @brief Three-component vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color3. Use
+         * either this or the @ref Color4 attribute. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef typename Generic<dimensions>::Color3 Color3;
+
+        /**
+         * @brief Four-component vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color4. Use
+         * either this or the @ref Color3 attribute. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef typename Generic<dimensions>::Color4 Color4;
+
+        /**
+         * @brief Instanced transformation matrix
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @ref Magnum::Matrix3 "Matrix3" in 2D, @ref Magnum::Matrix4 "Matrix4"
+         * in 3D. Used only if @ref Flag::InstancedTransformation is set.
+         */
+        typedef typename Generic<dimensions>::TransformationMatrix TransformationMatrix;
+
         #ifdef DOXYGEN_GENERATING_OUTPUT
         /**
          * @brief Flag
@@ -142,7 +206,36 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::Ab
              * with proper depth sorting and blending you'll usually get much
              * better performance and output quality.
              */
-            AlphaMask = 1 << 1
+            AlphaMask = 1 << 1,
+
+            /**
+             * Multiply color with a @ref Color3 / @ref Color4 attribute.
+             * Added with @ref GL::Mesh::addVertexBufferInstanced(), the color
+             * is taken per-instance instead of per-vertex.
+             * @see @ref setColor()
+             */
+            VertexColor = 1 << 2,
+
+            /**
+             * Multiply the transformation with a per-instance
+             * @ref TransformationMatrix attribute, which is expected to be
+             * added with @ref GL::Mesh::addVertexBufferInstanced().
+             * @requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+             * @requires_gles30 Extension @gl_extension{ANGLE,instanced_arrays},
+             *      @gl_extension{EXT,instanced_arrays} or
+             *      @gl_extension{NV,instanced_arrays} in OpenGL ES 2.0.
+             * @requires_webgl20 Extension @webgl_extension{ANGLE,instanced_arrays}
+             *      in WebGL 1.0.
+             */
+            InstancedTransformation = 1 << 3,
+
+            /**
+             * Only transform the position and write depth, with no fragment
+             * shading. Can be combined only with
+             * @ref Flag::InstancedTransformation. See
+             * @ref Shaders-Flat-usage-depth-only for more information.
+             */
+            DepthOnly = 1 << 4
         };
 
         /**
@@ -195,7 +288,9 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::Ab
          * @brief Set transformation and projection matrix
          * @return Reference to self (for method chaining)
          *
-         * Initial value is an identity matrix.
+         * Initial value is an identity matrix. If
+         * @ref Flag::InstancedTransformation is set, the per-instance
+         * @ref TransformationMatrix is applied before this one.
          */
         Flat<dimensions>& setTransformationProjectionMatrix(const MatrixTypeFor<dimensions, Float>& matrix) {
             setUniform(_transformationProjectionMatrixUniform, matrix);
@@ -208,10 +303,11 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public GL::Ab
          *
          * If @ref Flag::Textured is set, initial value is
          * @cpp 0xffffffff_rgbaf @ce and the color will be multiplied with
-         * texture.
+         * texture. If @ref Flag::VertexColor is set, the color is
+         * multiplied with the @ref Color3 / @ref Color4 attribute as well.
          * @see @ref bindTexture()
          */
-        Flat<dimensions>& setColor(const Color4& color){
+        Flat<dimensions>& setColor(const Magnum::Color4& color){
             setUniform(_colorUniform, color);
             return *this;
         }
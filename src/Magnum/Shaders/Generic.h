@@ -81,6 +81,45 @@ template<UnsignedInt dimensions> struct Generic {
      */
     typedef GL::Attribute<3, Magnum::Color4> Color4;
 
+    /**
+     * @brief Instanced transformation matrix
+     *
+     * @ref Magnum::Matrix3 "Matrix3" in 2D and @ref Magnum::Matrix4 "Matrix4"
+     * in 3D. Occupies locations @cpp 4 @ce to @cpp 6 @ce in 2D and
+     * @cpp 4 @ce to @cpp 7 @ce in 3D. Meant to be added with
+     * @ref GL::Mesh::addVertexBufferInstanced().
+     */
+    typedef GL::Attribute<4, T> TransformationMatrix;
+
+    /**
+     * @brief Instanced normal matrix
+     *
+     * @ref Magnum::Matrix3x3 "Matrix3x3", defined only in 3D. Occupies
+     * locations @cpp 8 @ce to @cpp 10 @ce. Meant to be added with
+     * @ref GL::Mesh::addVertexBufferInstanced().
+     */
+    typedef GL::Attribute<8, Matrix3x3> NormalMatrix;
+
+    /**
+     * @brief Joint IDs
+     *
+     * @ref Magnum::Vector4ui "Vector4ui", defined only in 3D. Indices of up
+     * to four joints affecting given vertex.
+     * @requires_gl30 Extension @gl_extension{EXT,gpu_shader4}
+     * @requires_gles30 Integer attributes are not available in OpenGL ES
+     *      2.0.
+     * @requires_webgl20 Integer attributes are not available in WebGL 1.0.
+     */
+    typedef GL::Attribute<11, Vector4ui> JointIds;
+
+    /**
+     * @brief Joint weights
+     *
+     * @ref Magnum::Vector4 "Vector4", defined only in 3D. Weights of the
+     * joints referenced by @ref JointIds.
+     */
+    typedef GL::Attribute<12, Vector4> Weights;
+
     #ifdef MAGNUM_BUILD_DEPRECATED
     /**
      * @brief Vertex color
@@ -129,11 +168,18 @@ struct BaseGeneric {
 
 template<> struct Generic<2>: BaseGeneric {
     typedef GL::Attribute<0, Vector2> Position;
+    typedef GL::Attribute<4, Matrix3> TransformationMatrix;
 };
 
 template<> struct Generic<3>: BaseGeneric {
     typedef GL::Attribute<0, Vector3> Position;
     typedef GL::Attribute<2, Vector3> Normal;
+    typedef GL::Attribute<4, Matrix4> TransformationMatrix;
+    typedef GL::Attribute<8, Matrix3x3> NormalMatrix;
+    #ifndef MAGNUM_TARGET_GLES2
+    typedef GL::Attribute<11, Vector4ui> JointIds;
+    #endif
+    typedef GL::Attribute<12, Vector4> Weights;
 };
 #endif
 
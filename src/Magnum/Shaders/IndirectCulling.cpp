@@ -0,0 +1,153 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "IndirectCulling.h"
+
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Functions.h"
+
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    enum: Int { DepthPyramidTextureLayer = 0 };
+
+    enum: UnsignedInt {
+        BoundsBufferBinding = 0,
+        CommandBufferBinding = 1,
+        OutputCommandBufferBinding = 2
+    };
+
+    constexpr UnsignedInt WorkgroupSize = 64;
+}
+
+IndirectCulling::IndirectCulling(const Flags flags): _flags{flags} {
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL430);
+
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumShaders"))
+        importShaderResources();
+    #endif
+    Utility::Resource rs("MagnumShaders");
+
+    GL::Shader comp = Implementation::createCompatibilityShader(rs, GL::Version::GL430, GL::Shader::Type::Compute);
+    comp.addSource(flags & Flag::OcclusionCulling ? "#define OCCLUSION_CULLING\n" : "")
+        .addSource(rs.get("IndirectCulling.comp"));
+
+    /* Load the program from the binary cache, if there's one, otherwise
+       compile and link it from the sources */
+    if(!loadCachedBinary({comp})) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({comp}));
+
+        attachShader(comp);
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        saveCachedBinary({comp});
+    }
+
+    /* GLSL 4.30 has explicit uniform locations and bindings, so only the
+       defaults need to be set */
+    setViewProjectionMatrix(Matrix4{});
+}
+
+IndirectCulling& IndirectCulling::setViewProjectionMatrix(const Matrix4& matrix) {
+    /* Normalize the planes so the shader can use the dot product directly
+       as a distance */
+    const Frustum frustum = Frustum::fromMatrix(matrix);
+    Vector4 planes[6];
+    for(std::size_t i = 0; i != 6; ++i)
+        planes[i] = frustum[i]/frustum[i].xyz().length();
+
+    setUniform(_viewProjectionMatrixUniform, matrix);
+    setUniform(_frustumPlanesUniform, Containers::arrayView(planes));
+    return *this;
+}
+
+IndirectCulling& IndirectCulling::bindDepthPyramid(GL::Texture2D& pyramid, const Vector2i& size) {
+    CORRADE_ASSERT(_flags & Flag::OcclusionCulling,
+        "Shaders::IndirectCulling::bindDepthPyramid(): the shader was not created with occlusion culling enabled", *this);
+    CORRADE_ASSERT(size.product(),
+        "Shaders::IndirectCulling::bindDepthPyramid(): expected a non-empty size but got" << size, *this);
+    pyramid.bind(DepthPyramidTextureLayer);
+    setUniform(_depthPyramidSizeUniform, Vector2{size});
+    /* Same as TextureTools::depthPyramidLevelCount(), which isn't used to
+       avoid a dependency on the TextureTools library */
+    setUniform(_depthPyramidLevelCountUniform, Int(Math::log2(UnsignedInt(size.max())) + 1));
+    return *this;
+}
+
+IndirectCulling& IndirectCulling::bindBoundsBuffer(GL::Buffer& buffer) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, BoundsBufferBinding);
+    return *this;
+}
+
+IndirectCulling& IndirectCulling::bindCommandBuffer(GL::Buffer& buffer) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, CommandBufferBinding);
+    return *this;
+}
+
+IndirectCulling& IndirectCulling::bindOutputCommandBuffer(GL::Buffer& buffer) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, OutputCommandBufferBinding);
+    return *this;
+}
+
+IndirectCulling& IndirectCulling::cull(const UnsignedInt objectCount) {
+    if(!objectCount) return *this;
+
+    setUniform(_objectCountUniform, objectCount);
+    dispatchCompute({(objectCount + WorkgroupSize - 1)/WorkgroupSize, 1, 1});
+
+    /* Make the output visible to the indirect draw */
+    GL::Renderer::setMemoryBarrier(GL::Renderer::MemoryBarrier::Command);
+    return *this;
+}
+
+Debug& operator<<(Debug& debug, const IndirectCulling::Flag value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case IndirectCulling::Flag::v: return debug << "Shaders::IndirectCulling::Flag::" #v;
+        _c(OcclusionCulling)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Shaders::IndirectCulling::Flag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const IndirectCulling::Flags value) {
+    return Containers::enumSetDebugOutput(debug, value, "Shaders::IndirectCulling::Flags{}", {
+        IndirectCulling::Flag::OcclusionCulling});
+}
+
+}}
@@ -0,0 +1,241 @@
+#ifndef Magnum_Shaders_IndirectCulling_h
+#define Magnum_Shaders_IndirectCulling_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::IndirectCulling
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES
+namespace Magnum { namespace Shaders {
+
+/**
+@brief GPU culling shader
+
+Compute shader that culls objects against a frustum and optionally against a
+hierarchical depth buffer, producing draw commands for
+@ref GL::Mesh::drawIndirect() directly on the GPU without any CPU readback.
+
+For every object there's a bounding sphere in a buffer bound with
+@ref bindBoundsBuffer(), with the center in the first three and the radius in
+the last component of a @ref Magnum::Vector4 "Vector4", and a
+@ref GL::DrawElementsIndirectCommand in a buffer bound with
+@ref bindCommandBuffer(). The @ref cull() function then copies the commands
+to a buffer bound with @ref bindOutputCommandBuffer(), setting
+@ref GL::DrawElementsIndirectCommand::instanceCount to zero for objects that
+are culled. The output keeps the order of the input, so it can be drawn with
+a single multi-draw call.
+
+@section Shaders-IndirectCulling-usage Example usage
+
+@code{.cpp}
+GL::Buffer bounds, commands, outputCommands;
+bounds.setData(objectBounds);
+commands.setData(objectCommands);
+outputCommands.setData({nullptr, objectCount*sizeof(GL::DrawElementsIndirectCommand)});
+
+Shaders::IndirectCulling shader;
+shader.setViewProjectionMatrix(projection*camera)
+    .bindBoundsBuffer(bounds)
+    .bindCommandBuffer(commands)
+    .bindOutputCommandBuffer(outputCommands)
+    .cull(objectCount);
+
+mesh.drawIndirect(phong, outputCommands, 0, objectCount);
+@endcode
+
+@section Shaders-IndirectCulling-occlusion Occlusion culling
+
+With @ref Flag::OcclusionCulling the objects that survived the frustum test
+are additionally tested against a min/max depth pyramid built with
+@ref TextureTools::depthPyramid(), usually from the depth buffer of the
+previous frame. The sphere is projected to a screen-space rectangle and its
+nearest depth is compared with the farthest depth stored in the pyramid level
+where the rectangle covers at most 2x2 texels. Objects that intersect the
+near plane are always treated as visible.
+
+@code{.cpp}
+Shaders::IndirectCulling shader{Shaders::IndirectCulling::Flag::OcclusionCulling};
+shader.setViewProjectionMatrix(projection*camera)
+    .bindDepthPyramid(pyramid, size)
+    …
+@endcode
+
+@requires_gl43 Extension @gl_extension{ARB,compute_shader} and
+    @gl_extension{ARB,shader_storage_buffer_object}
+@requires_gl Compute-based culling is not available in OpenGL ES or WebGL.
+*/
+class MAGNUM_SHADERS_EXPORT IndirectCulling: public GL::AbstractShaderProgram {
+    public:
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Test objects against a depth pyramid bound with
+             * @ref bindDepthPyramid() in addition to the frustum.
+             */
+            OcclusionCulling = 1 << 0
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit IndirectCulling(Flags flags = {});
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit IndirectCulling(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        IndirectCulling(const IndirectCulling&) = delete;
+
+        /** @brief Move constructor */
+        IndirectCulling(IndirectCulling&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        IndirectCulling& operator=(const IndirectCulling&) = delete;
+
+        /** @brief Move assignment */
+        IndirectCulling& operator=(IndirectCulling&&) noexcept = default;
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Set view projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * The frustum planes are extracted from @p matrix. Initial value is
+         * an identity matrix.
+         * @see @ref Math::Frustum::fromMatrix()
+         */
+        IndirectCulling& setViewProjectionMatrix(const Matrix4& matrix);
+
+        /**
+         * @brief Bind a depth pyramid
+         * @param pyramid   Depth pyramid texture
+         * @param size      Size of the first level of @p pyramid
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with
+         * @ref Flag::OcclusionCulling enabled and that @p size is non-zero.
+         * The pyramid is expected to be built with
+         * @ref TextureTools::depthPyramid() and use nearest filtering, only
+         * the farthest depth in its green channel is used.
+         */
+        IndirectCulling& bindDepthPyramid(GL::Texture2D& pyramid, const Vector2i& size);
+
+        /**
+         * @brief Bind a bounds buffer
+         * @return Reference to self (for method chaining)
+         *
+         * The buffer is expected to contain one @ref Magnum::Vector4 "Vector4"
+         * per object, a bounding sphere center in world space and its radius.
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         */
+        IndirectCulling& bindBoundsBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Bind an input command buffer
+         * @return Reference to self (for method chaining)
+         *
+         * The buffer is expected to contain one
+         * @ref GL::DrawElementsIndirectCommand per object.
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         */
+        IndirectCulling& bindCommandBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Bind an output command buffer
+         * @return Reference to self (for method chaining)
+         *
+         * The buffer is expected to have space for one
+         * @ref GL::DrawElementsIndirectCommand per object. Can't be the same
+         * as the buffer bound with @ref bindCommandBuffer().
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         */
+        IndirectCulling& bindOutputCommandBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Cull objects
+         * @return Reference to self (for method chaining)
+         *
+         * Dispatches the compute shader for @p objectCount objects and
+         * issues a @ref GL::Renderer::MemoryBarrier::Command barrier, so the
+         * output command buffer can be directly passed to
+         * @ref GL::Mesh::drawIndirect(). If @p objectCount is zero, the
+         * function is a no-op.
+         */
+        IndirectCulling& cull(UnsignedInt objectCount);
+
+    private:
+        Flags _flags;
+        Int _viewProjectionMatrixUniform{0},
+            _frustumPlanesUniform{1},
+            _objectCountUniform{7},
+            _depthPyramidSizeUniform{8},
+            _depthPyramidLevelCountUniform{9};
+};
+
+/** @debugoperatorclassenum{IndirectCulling,IndirectCulling::Flag} */
+MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, IndirectCulling::Flag value);
+
+/** @debugoperatorclassenum{IndirectCulling,IndirectCulling::Flags} */
+MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, IndirectCulling::Flags value);
+
+CORRADE_ENUMSET_OPERATORS(IndirectCulling::Flags)
+
+}}
+#else
+#error this header is not available in OpenGL ES build
+#endif
+
+#endif
@@ -0,0 +1,114 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LightCulling.h"
+
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/Math/Functions.h"
+
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    enum: UnsignedInt {
+        LightBufferBinding = 0,
+        ClusterBufferBinding = 1
+    };
+
+    constexpr UnsignedInt WorkgroupSize = 64;
+}
+
+LightCulling::LightCulling() {
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL430);
+
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumShaders"))
+        importShaderResources();
+    #endif
+    Utility::Resource rs("MagnumShaders");
+
+    GL::Shader comp = Implementation::createCompatibilityShader(rs, GL::Version::GL430, GL::Shader::Type::Compute);
+    comp.addSource(Utility::formatString(
+            "#define CLUSTER_COUNT uvec3({}, {}, {})\n"
+            "#define MAX_LIGHTS_PER_CLUSTER {}u\n",
+            clusterCount().x(), clusterCount().y(), clusterCount().z(),
+            maxLightsPerCluster()))
+        .addSource(rs.get("LightCulling.comp"));
+
+    /* Load the program from the binary cache, if there's one, otherwise
+       compile and link it from the sources */
+    if(!loadCachedBinary({comp})) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({comp}));
+
+        attachShader(comp);
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        saveCachedBinary({comp});
+    }
+
+    /* GLSL 4.30 has explicit uniform locations and bindings, so only the
+       defaults need to be set */
+    setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+}
+
+LightCulling& LightCulling::setProjectionMatrix(const Matrix4& matrix) {
+    /* Near and far plane distance of a perspective projection */
+    const Float near = matrix[3][2]/(matrix[2][2] - 1.0f);
+    const Float far = matrix[3][2]/(matrix[2][2] + 1.0f);
+
+    setUniform(_inverseProjectionMatrixUniform, matrix.inverted());
+    setUniform(_clusterDepthUniform, Vector2{near, Math::log(far/near)});
+    return *this;
+}
+
+LightCulling& LightCulling::bindLightBuffer(GL::Buffer& buffer) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, LightBufferBinding);
+    return *this;
+}
+
+LightCulling& LightCulling::bindClusterBuffer(GL::Buffer& buffer) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, ClusterBufferBinding);
+    return *this;
+}
+
+LightCulling& LightCulling::cull(const UnsignedInt lightCount) {
+    const UnsignedInt count = clusterCount().x()*clusterCount().y()*clusterCount().z();
+
+    setUniform(_lightCountUniform, lightCount);
+    dispatchCompute({(count + WorkgroupSize - 1)/WorkgroupSize, 1, 1});
+
+    /* Make the output visible to the fragment shader */
+    GL::Renderer::setMemoryBarrier(GL::Renderer::MemoryBarrier::ShaderStorage);
+    return *this;
+}
+
+}}
@@ -0,0 +1,231 @@
+#ifndef Magnum_Shaders_LightCulling_h
+#define Magnum_Shaders_LightCulling_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::LightCulling
+ */
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Clustered light culling shader
+
+Compute shader that bins lights into a grid of clusters dividing the view
+frustum, for use with @ref Phong::Flag::ClusteredLights. The frustum is
+split into @ref clusterCount() clusters --- a regular grid in screen space and
+exponentially distributed slices in depth --- and for every cluster the
+shader writes a list of lights whose range intersects it. The shaded
+fragments then iterate only the lights in their cluster instead of all of
+them, making scenes with hundreds of lights feasible.
+
+The lights are stored in a buffer bound with @ref bindLightBuffer(), one
+@ref Light structure per light, with positions in view space. The cluster
+buffer bound with @ref bindClusterBuffer() needs to be at least
+@ref clusterBufferSize() bytes large. As the bindings are the same as the
+ones used by @ref Phong::bindClusteredLightBuffer() and
+@ref Phong::bindLightClusterBuffer(), the buffers don't need to be bound
+again for drawing.
+
+@section Shaders-LightCulling-usage Example usage
+
+@code{.cpp}
+Containers::Array<Shaders::LightCulling::Light> lightData{lightCount};
+for(std::size_t i = 0; i != lightCount; ++i)
+    lightData[i] = {{camera.transformPoint(positions[i]), ranges[i]}, colors[i]};
+
+GL::Buffer lights, clusters;
+lights.setData(lightData);
+clusters.setData({nullptr, Shaders::LightCulling::clusterBufferSize()});
+
+Shaders::LightCulling culling;
+culling.setProjectionMatrix(projection)
+    .bindLightBuffer(lights)
+    .bindClusterBuffer(clusters)
+    .cull(lightCount);
+
+Shaders::Phong shader{Shaders::Phong::Flag::ClusteredLights};
+shader.setProjectionMatrix(projection)
+    .setTransformationMatrix(camera*transformation)
+    …
+mesh.draw(shader);
+@endcode
+
+The projection is expected to be a perspective projection with a finite far
+plane, as the depth slices are calculated from the near and far plane
+distances. The cluster grid depends only on the projection, lights can be
+added, removed or moved freely between calls to @ref cull(). If more than
+@ref maxLightsPerCluster() lights affect a single cluster, the remaining ones
+are ignored for it.
+
+@requires_gl43 Extension @gl_extension{ARB,compute_shader} and
+    @gl_extension{ARB,shader_storage_buffer_object}
+@requires_gl Compute-based light culling is not available in OpenGL ES or
+    WebGL.
+*/
+class MAGNUM_SHADERS_EXPORT LightCulling: public GL::AbstractShaderProgram {
+    public:
+        /**
+         * @brief Light
+         *
+         * Matches the `std430` layout of the buffer bound via
+         * @ref bindLightBuffer() and @ref Phong::bindClusteredLightBuffer().
+         */
+        struct Light {
+            /**
+             * @brief Position and range
+             *
+             * View-space position in the first three components, distance at
+             * which the light contribution falls off to zero in the last.
+             */
+            Vector4 position;
+
+            /** @brief Color */
+            Color4 color;
+        };
+
+        /**
+         * @brief Cluster count
+         *
+         * Tiles in screen X and Y direction and slices in depth.
+         */
+        constexpr static Vector3i clusterCount() {
+            return {ClusterCountX, ClusterCountY, ClusterCountZ};
+        }
+
+        /**
+         * @brief Max lights affecting a single cluster
+         *
+         * Lights above this number are ignored for given cluster.
+         */
+        constexpr static UnsignedInt maxLightsPerCluster() { return 127; }
+
+        /**
+         * @brief Cluster buffer size
+         *
+         * Size of the buffer bound with @ref bindClusterBuffer() in bytes.
+         * Every cluster is stored as a light count followed by
+         * @ref maxLightsPerCluster() light indices, all of them
+         * @ref Magnum::UnsignedInt "UnsignedInt".
+         */
+        constexpr static std::size_t clusterBufferSize() {
+            return std::size_t(ClusterCountX*ClusterCountY*ClusterCountZ)*(maxLightsPerCluster() + 1)*sizeof(UnsignedInt);
+        }
+
+        /** @brief Constructor */
+        explicit LightCulling();
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit LightCulling(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        LightCulling(const LightCulling&) = delete;
+
+        /** @brief Move constructor */
+        LightCulling(LightCulling&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        LightCulling& operator=(const LightCulling&) = delete;
+
+        /** @brief Move assignment */
+        LightCulling& operator=(LightCulling&&) noexcept = default;
+
+        /**
+         * @brief Set projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Expected to be the same perspective projection as is used for
+         * drawing with @ref Phong. The near and far plane distances are
+         * extracted from it. Initial value is a perspective projection with
+         * a 90° field of view, near plane at @cpp 1.0f @ce and far plane at
+         * @cpp 100.0f @ce.
+         */
+        LightCulling& setProjectionMatrix(const Matrix4& matrix);
+
+        /**
+         * @brief Bind a light buffer
+         * @return Reference to self (for method chaining)
+         *
+         * The buffer is expected to contain one @ref Light per light.
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         */
+        LightCulling& bindLightBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Bind a cluster buffer
+         * @return Reference to self (for method chaining)
+         *
+         * The buffer is expected to be at least @ref clusterBufferSize()
+         * bytes large.
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         */
+        LightCulling& bindClusterBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Cull lights
+         * @return Reference to self (for method chaining)
+         *
+         * Dispatches the compute shader for all clusters, testing
+         * @p lightCount lights from the light buffer, and issues a
+         * @ref GL::Renderer::MemoryBarrier::ShaderStorage barrier, so the
+         * cluster buffer can be directly used for drawing. If
+         * @p lightCount is zero, all clusters are emptied.
+         */
+        LightCulling& cull(UnsignedInt lightCount);
+
+    private:
+        enum: Int {
+            ClusterCountX = 16,
+            ClusterCountY = 9,
+            ClusterCountZ = 24
+        };
+
+        Int _inverseProjectionMatrixUniform{0},
+            _clusterDepthUniform{1},
+            _lightCountUniform{2};
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES build
+#endif
+
+#endif
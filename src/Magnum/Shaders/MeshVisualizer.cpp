@@ -38,6 +38,9 @@
 namespace Magnum { namespace Shaders {
 
 MeshVisualizer::MeshVisualizer(const Flags flags): _flags{flags} {
+    CORRADE_ASSERT(!(flags & Flag::BarycentricAttribute) || (flags & Flag::Wireframe && flags & Flag::NoGeometryShader),
+        "Shaders::MeshVisualizer: barycentric attribute can be used only for wireframe rendering without a geometry shader", );
+
     #ifndef MAGNUM_TARGET_GLES2
     if(flags & Flag::Wireframe && !(flags & Flag::NoGeometryShader)) {
         #ifndef MAGNUM_TARGET_GLES
@@ -74,6 +77,7 @@ MeshVisualizer::MeshVisualizer(const Flags flags): _flags{flags} {
 
     vert.addSource(flags & Flag::Wireframe ? "#define WIREFRAME_RENDERING\n" : "")
         .addSource(flags & Flag::NoGeometryShader ? "#define NO_GEOMETRY_SHADER\n" : "")
+        .addSource(flags & Flag::BarycentricAttribute ? "#define BARYCENTRIC_ATTRIBUTE\n" : "")
         #ifdef MAGNUM_TARGET_WEBGL
         .addSource("#define SUBSCRIPTING_WORKAROUND\n")
         #elif defined(MAGNUM_TARGET_GLES2)
@@ -94,37 +98,55 @@ MeshVisualizer::MeshVisualizer(const Flags flags): _flags{flags} {
     }
     #endif
 
+    /* Load the program from the binary cache, if there's one, otherwise
+       compile and link it from the sources */
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
-    if(geom) CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, *geom, frag}));
-    else
-    #endif
-        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
-
-    attachShaders({vert, frag});
-    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
-    if(geom) attachShader(*geom);
-    #endif
-
-    #ifndef MAGNUM_TARGET_GLES
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
+    const bool cached = geom ? loadCachedBinary({vert, *geom, frag}) : loadCachedBinary({vert, frag});
     #else
-    if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
+    const bool cached = loadCachedBinary({vert, frag});
     #endif
-    {
-        bindAttributeLocation(Position::Location, "position");
+    if(!cached) {
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(geom) CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, *geom, frag}));
+        else
+        #endif
+            CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+
+        attachShaders({vert, frag});
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(geom) attachShader(*geom);
+        #endif
 
-        #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES2)
         #ifndef MAGNUM_TARGET_GLES
-        if(!GL::Context::current().isVersionSupported(GL::Version::GL310))
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
+        #else
+        if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
         #endif
         {
-            bindAttributeLocation(VertexIndex::Location, "vertexIndex");
+            bindAttributeLocation(Position::Location, "position");
+
+            if(flags & Flag::BarycentricAttribute)
+                bindAttributeLocation(Barycentric::Location, "vertexBarycentric");
+            #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES2)
+            else
+            #ifndef MAGNUM_TARGET_GLES
+            if(!GL::Context::current().isVersionSupported(GL::Version::GL310))
+            #endif
+            {
+                bindAttributeLocation(VertexIndex::Location, "vertexIndex");
+            }
+            #endif
         }
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(geom) saveCachedBinary({vert, *geom, frag});
+        else
         #endif
+            saveCachedBinary({vert, frag});
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
-
     #ifndef MAGNUM_TARGET_GLES
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
     #endif
@@ -159,6 +181,7 @@ Debug& operator<<(Debug& debug, const MeshVisualizer::Flag value) {
         #define _c(v) case MeshVisualizer::Flag::v: return debug << "Shaders::MeshVisualizer::Flag::" #v;
         _c(NoGeometryShader)
         _c(Wireframe)
+        _c(BarycentricAttribute)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -170,7 +193,8 @@ Debug& operator<<(Debug& debug, const MeshVisualizer::Flags value) {
     return Containers::enumSetDebugOutput(debug, value, "Shaders::MeshVisualizer::Flags{}", {
         MeshVisualizer::Flag::Wireframe,
         /* Wireframe contains this on ES2 so it's not reported there */
-        MeshVisualizer::Flag::NoGeometryShader
+        MeshVisualizer::Flag::NoGeometryShader,
+        MeshVisualizer::Flag::BarycentricAttribute
     });
 }
 
@@ -65,6 +65,13 @@ meshes (see @ref MeshTools::duplicate() for a possible solution). Additionaly,
 if you have OpenGL < 3.1 or OpenGL ES 2.0, you need to provide also the
 @ref VertexIndex attribute.
 
+Alternatively, with @ref Flag::BarycentricAttribute enabled together with
+@ref Flag::NoGeometryShader, the barycentric coordinates are taken from the
+@ref Barycentric attribute instead. Then the mesh can stay indexed, which is
+the preferred way to render wireframe of large meshes on OpenGL ES and WebGL.
+Use @ref MeshTools::generateBarycentrics() to create the attribute, it needs to
+duplicate only the few vertices that can't be shared among neighboring faces.
+
 @requires_gles30 Extension @gl_extension{OES,standard_derivatives} for
     wireframe rendering without geometry shaders.
 
@@ -102,6 +109,18 @@ The vertices must be converted to non-indexed array. Mesh setup:
 
 Rendering setup the same as above.
 
+@subsection Shaders-MeshVisualizer-usage-wireframe-barycentric Wireframe visualization of indexed meshes using a barycentric attribute
+
+The barycentric coordinates are stored in three normalized bytes per vertex
+and the vertex data have to be remapped only for the vertices that
+@ref MeshTools::generateBarycentrics() had to duplicate. Mesh setup:
+
+@snippet MagnumShaders.cpp MeshVisualizer-usage-barycentric
+
+Rendering setup:
+
+@snippet MagnumShaders.cpp MeshVisualizer-usage-barycentric2
+
 @see @ref shaders
 @todo Understand and add support wireframe width/smoothness without GS
 */
@@ -127,6 +146,19 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizer: public GL::AbstractShaderProgram {
          */
         typedef GL::Attribute<3, Float> VertexIndex;
 
+        /**
+         * @brief Barycentric coordinates
+         *
+         * @ref Magnum::Vector3 "Vector3", used only if
+         * @ref Flag::BarycentricAttribute is enabled. Each triangle is
+         * expected to have @cpp {1.0f, 0.0f, 0.0f} @ce,
+         * @cpp {0.0f, 1.0f, 0.0f} @ce and @cpp {0.0f, 0.0f, 1.0f} @ce in its
+         * three corners, usually supplied as normalized
+         * @ref Magnum::UnsignedByte "UnsignedByte" values generated by
+         * @ref MeshTools::generateBarycentrics().
+         */
+        typedef GL::Attribute<4, Vector3> Barycentric;
+
         /**
          * @brief Flag
          *
@@ -149,7 +181,16 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizer: public GL::AbstractShaderProgram {
              * attribute in the mesh. In OpenGL ES enabled alongside
              * @ref Flag::Wireframe.
              */
-            NoGeometryShader = 1 << 1
+            NoGeometryShader = 1 << 1,
+
+            /**
+             * Take barycentric coordinates for wireframe visualization
+             * from the @ref Barycentric attribute instead of deriving them
+             * from vertex index, which allows rendering also indexed meshes.
+             * Expects that both @ref Flag::Wireframe and
+             * @ref Flag::NoGeometryShader are enabled.
+             */
+            BarycentricAttribute = 1 << 2
         };
 
         /** @brief Flags */
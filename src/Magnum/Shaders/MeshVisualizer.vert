@@ -43,7 +43,12 @@ layout(location = POSITION_ATTRIBUTE_LOCATION)
 in highp vec4 position;
 
 #if defined(WIREFRAME_RENDERING) && defined(NO_GEOMETRY_SHADER)
-#if (!defined(GL_ES) && __VERSION__ < 140) || (defined(GL_ES) && __VERSION__ < 300)
+#ifdef BARYCENTRIC_ATTRIBUTE
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 4)
+#endif
+in lowp vec3 vertexBarycentric;
+#elif (!defined(GL_ES) && __VERSION__ < 140) || (defined(GL_ES) && __VERSION__ < 300)
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = 3)
 #endif
@@ -58,6 +63,9 @@ void main() {
     gl_Position = transformationProjectionMatrix*position;
 
     #if defined(WIREFRAME_RENDERING) && defined(NO_GEOMETRY_SHADER)
+    #ifdef BARYCENTRIC_ATTRIBUTE
+    barycentric = vertexBarycentric;
+    #else
     barycentric = vec3(0.0);
 
     #ifdef SUBSCRIPTING_WORKAROUND
@@ -70,6 +78,7 @@ void main() {
     #else
     barycentric[gl_VertexID % 3] = 1.0;
     #endif
+    #endif
 
     #endif
 }
@@ -0,0 +1,131 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ParticleSimulation.h"
+
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Shader.h"
+
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+ParticleSimulation::ParticleSimulation() {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumShaders"))
+        importShaderResources();
+    #endif
+    Utility::Resource rs("MagnumShaders");
+
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    const GL::Version version = GL::Context::current().supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300});
+    #else
+    const GL::Version version = GL::Version::GLES300;
+    #endif
+
+    GL::Shader vert = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Vertex);
+    vert.addSource(rs.get("generic.glsl"))
+        .addSource(rs.get("ParticleSimulation.vert"));
+
+    #ifdef MAGNUM_TARGET_GLES
+    /* ES needs a fragment shader even if nothing gets rasterized */
+    GL::Shader frag = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Fragment);
+    frag.addSource("void main() {}\n");
+    #endif
+
+    /* Load the program from the binary cache, if there's one, otherwise
+       compile and link it from the sources */
+    #ifndef MAGNUM_TARGET_GLES
+    if(!loadCachedBinary({vert})) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert}));
+
+        attachShader(vert);
+    #else
+    if(!loadCachedBinary({vert, frag})) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+
+        attachShaders({vert, frag});
+    #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
+        #endif
+        {
+            bindAttributeLocation(Position::Location, "position");
+            bindAttributeLocation(Velocity::Location, "velocity");
+        }
+
+        /* Same layout as the input so the buffers can be ping-ponged */
+        setTransformFeedbackOutputs({"transformedPosition", "transformedVelocity"}, TransformFeedbackBufferMode::InterleavedAttributes);
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        #ifndef MAGNUM_TARGET_GLES
+        saveCachedBinary({vert});
+        #else
+        saveCachedBinary({vert, frag});
+        #endif
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
+    #endif
+    {
+        _timeDeltaUniform = uniformLocation("timeDelta");
+        _accelerationUniform = uniformLocation("acceleration");
+        _dampingUniform = uniformLocation("damping");
+        _emitterPositionUniform = uniformLocation("emitterPosition");
+        _emitterVelocityUniform = uniformLocation("emitterVelocity");
+        _emitterSpreadUniform = uniformLocation("emitterSpread");
+        _lifetimeUniform = uniformLocation("lifetime");
+        _seedUniform = uniformLocation("seed");
+    }
+
+    /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
+    #ifdef MAGNUM_TARGET_GLES
+    setTimeDelta(0.0f);
+    setAcceleration({});
+    setDamping(0.0f);
+    setEmitterPosition({});
+    setEmitterVelocity({0.0f, 1.0f, 0.0f});
+    setEmitterSpread(0.0f);
+    setLifetime(1.0f);
+    setSeed(0);
+    #endif
+}
+
+ParticleSimulation& ParticleSimulation::setLifetime(const Float lifetime) {
+    CORRADE_ASSERT(lifetime > 0.0f,
+        "Shaders::ParticleSimulation::setLifetime(): expected a positive value, got" << lifetime, *this);
+    setUniform(_lifetimeUniform, lifetime);
+    return *this;
+}
+
+}}
@@ -0,0 +1,225 @@
+#ifndef Magnum_Shaders_ParticleSimulation_h
+#define Magnum_Shaders_ParticleSimulation_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::ParticleSimulation
+ */
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Particle simulation shader
+
+Transform feedback shader advancing a particle system by one time step
+entirely on the GPU. Every particle is stored as a pair of
+@ref Magnum::Vector4 "Vector4" values --- the @ref Position attribute with
+position in the first three components and age in seconds in the last
+component, and the @ref Velocity attribute with velocity in the first three
+components and lifetime in seconds in the last component. The shader reads
+one set of particles and writes the updated state to the
+@cpp "transformedPosition" @ce and @cpp "transformedVelocity" @ce outputs,
+interleaved in a single buffer with the same layout as the input.
+
+Live particles are accelerated with @ref setAcceleration(), slowed down with
+@ref setDamping() and moved along their velocity. Particles with negative age
+are not emitted yet. Once the age crosses zero or exceeds the lifetime, the
+particle is (re)emitted at @ref setEmitterPosition() with
+@ref setEmitterVelocity() plus a random vector of length at most
+@ref setEmitterSpread(), and gets a lifetime set with @ref setLifetime().
+
+The shader is meant to be used through @ref ParticleSystem, which manages the
+ping-ponged buffers and transform feedback objects. The same shader instance
+can be used to update any number of particle systems. Rendering is done with
+@ref Particles.
+
+@requires_gl30 Extension @gl_extension{EXT,transform_feedback}
+@requires_gles30 Transform feedback is not available in OpenGL ES 2.0.
+@requires_webgl20 Transform feedback is not available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT ParticleSimulation: public GL::AbstractShaderProgram {
+    public:
+        /**
+         * @brief Particle position and age
+         *
+         * @ref Magnum::Vector4 "Vector4", position in the first three
+         * components, age in seconds in the last.
+         */
+        typedef GL::Attribute<0, Vector4> Position;
+
+        /**
+         * @brief Particle velocity and lifetime
+         *
+         * @ref Magnum::Vector4 "Vector4", velocity in the first three
+         * components, lifetime in seconds in the last.
+         */
+        typedef GL::Attribute<1, Vector4> Velocity;
+
+        /** @brief Constructor */
+        explicit ParticleSimulation();
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit ParticleSimulation(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        ParticleSimulation(const ParticleSimulation&) = delete;
+
+        /** @brief Move constructor */
+        ParticleSimulation(ParticleSimulation&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        ParticleSimulation& operator=(const ParticleSimulation&) = delete;
+
+        /** @brief Move assignment */
+        ParticleSimulation& operator=(ParticleSimulation&&) noexcept = default;
+
+        /**
+         * @brief Set time delta
+         * @return Reference to self (for method chaining)
+         *
+         * Length of the simulated time step in seconds. Initial value is
+         * @cpp 0.0f @ce. Set implicitly by @ref ParticleSystem::update().
+         */
+        ParticleSimulation& setTimeDelta(Float delta) {
+            setUniform(_timeDeltaUniform, delta);
+            return *this;
+        }
+
+        /**
+         * @brief Set acceleration
+         * @return Reference to self (for method chaining)
+         *
+         * Acceleration applied to all live particles, such as gravity.
+         * Initial value is a zero vector.
+         */
+        ParticleSimulation& setAcceleration(const Vector3& acceleration) {
+            setUniform(_accelerationUniform, acceleration);
+            return *this;
+        }
+
+        /**
+         * @brief Set damping
+         * @return Reference to self (for method chaining)
+         *
+         * Velocity is multiplied by @f$ e^{-d \Delta t} @f$ every step.
+         * Initial value is @cpp 0.0f @ce, i.e. no damping.
+         */
+        ParticleSimulation& setDamping(Float damping) {
+            setUniform(_dampingUniform, damping);
+            return *this;
+        }
+
+        /**
+         * @brief Set emitter position
+         * @return Reference to self (for method chaining)
+         *
+         * Initial value is a zero vector.
+         */
+        ParticleSimulation& setEmitterPosition(const Vector3& position) {
+            setUniform(_emitterPositionUniform, position);
+            return *this;
+        }
+
+        /**
+         * @brief Set emitter velocity
+         * @return Reference to self (for method chaining)
+         *
+         * Base velocity of newly emitted particles. Initial value is
+         * @cpp {0.0f, 1.0f, 0.0f} @ce.
+         * @see @ref setEmitterSpread()
+         */
+        ParticleSimulation& setEmitterVelocity(const Vector3& velocity) {
+            setUniform(_emitterVelocityUniform, velocity);
+            return *this;
+        }
+
+        /**
+         * @brief Set emitter spread
+         * @return Reference to self (for method chaining)
+         *
+         * Maximal length of a random vector in a uniformly distributed
+         * direction that's added to @ref setEmitterVelocity() for each newly
+         * emitted particle. Initial value is @cpp 0.0f @ce.
+         */
+        ParticleSimulation& setEmitterSpread(Float spread) {
+            setUniform(_emitterSpreadUniform, spread);
+            return *this;
+        }
+
+        /**
+         * @brief Set lifetime
+         * @return Reference to self (for method chaining)
+         *
+         * Lifetime of newly emitted particles in seconds. Expects that the
+         * value is positive. Initial value is @cpp 1.0f @ce.
+         */
+        ParticleSimulation& setLifetime(Float lifetime);
+
+        /**
+         * @brief Set random seed
+         * @return Reference to self (for method chaining)
+         *
+         * Combined with particle index to randomize the emitted velocity.
+         * Initial value is @cpp 0 @ce. Changed implicitly on every
+         * @ref ParticleSystem::update() so particles emitted in different
+         * steps differ.
+         */
+        ParticleSimulation& setSeed(UnsignedInt seed) {
+            setUniform(_seedUniform, seed);
+            return *this;
+        }
+
+    private:
+        Int _timeDeltaUniform{0},
+            _accelerationUniform{1},
+            _dampingUniform{2},
+            _emitterPositionUniform{3},
+            _emitterVelocityUniform{4},
+            _emitterSpreadUniform{5},
+            _lifetimeUniform{6},
+            _seedUniform{7};
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
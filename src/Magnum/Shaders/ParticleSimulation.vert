@@ -0,0 +1,168 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#define VELOCITY_ATTRIBUTE_LOCATION 1
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 0)
+#endif
+uniform highp float timeDelta
+    #ifndef GL_ES
+    = 0.0
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 1)
+#endif
+uniform highp vec3 acceleration
+    #ifndef GL_ES
+    = vec3(0.0)
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 2)
+#endif
+uniform highp float damping
+    #ifndef GL_ES
+    = 0.0
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 3)
+#endif
+uniform highp vec3 emitterPosition
+    #ifndef GL_ES
+    = vec3(0.0)
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 4)
+#endif
+uniform highp vec3 emitterVelocity
+    #ifndef GL_ES
+    = vec3(0.0, 1.0, 0.0)
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 5)
+#endif
+uniform highp float emitterSpread
+    #ifndef GL_ES
+    = 0.0
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 6)
+#endif
+uniform highp float lifetime
+    #ifndef GL_ES
+    = 1.0
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 7)
+#endif
+uniform highp uint seed
+    #ifndef GL_ES
+    = 0u
+    #endif
+    ;
+
+/* Position in XYZ, age in W */
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = POSITION_ATTRIBUTE_LOCATION)
+#endif
+in highp vec4 position;
+
+/* Velocity in XYZ, lifetime in W */
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = VELOCITY_ATTRIBUTE_LOCATION)
+#endif
+in highp vec4 velocity;
+
+out highp vec4 transformedPosition;
+out highp vec4 transformedVelocity;
+
+/* Integer hash from https://nullprogram.com/blog/2018/07/31/ */
+highp uint hash(highp uint x) {
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+/* Uniformly distributed value in [0, 1) */
+highp float random(inout highp uint state) {
+    state = hash(state);
+    return float(state >> 8)/16777216.0;
+}
+
+void main() {
+    highp vec3 particlePosition = position.xyz;
+    highp vec3 particleVelocity = velocity.xyz;
+    highp float particleLifetime = velocity.w;
+    highp float age = position.w + timeDelta;
+
+    /* Particles with negative age are not emitted yet, once the age crosses
+       zero or the lifetime is over, the particle is (re)emitted. The
+       remaining age is kept so the emission rate stays constant independently
+       of the time step. */
+    bool emitted = position.w < 0.0 && age >= 0.0;
+    bool died = age >= particleLifetime;
+    if(emitted || died) {
+        if(died) age = mod(age - particleLifetime, lifetime);
+
+        highp uint state = uint(gl_VertexID) ^ hash(seed);
+        highp float z = random(state)*2.0 - 1.0;
+        highp float phi = random(state)*6.28318530718;
+        highp float r = sqrt(1.0 - z*z);
+        highp vec3 direction = vec3(r*cos(phi), r*sin(phi), z);
+
+        particleVelocity = emitterVelocity + direction*emitterSpread*random(state);
+        particlePosition = emitterPosition + particleVelocity*age;
+        particleLifetime = lifetime;
+
+    /* Semi-implicit Euler integration of live particles */
+    } else if(age >= 0.0) {
+        particleVelocity = particleVelocity*exp(-damping*timeDelta) + acceleration*timeDelta;
+        particlePosition += particleVelocity*timeDelta;
+    }
+
+    transformedPosition = vec4(particlePosition, age);
+    transformedVelocity = vec4(particleVelocity, particleLifetime);
+
+    /* Mesa drivers complain that vertex shader doesn't write to gl_Position
+       otherwise */
+    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+}
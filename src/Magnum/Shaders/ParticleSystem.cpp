@@ -0,0 +1,118 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ParticleSystem.h"
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Shaders/ParticleSimulation.h"
+#include "Magnum/Shaders/Particles.h"
+
+namespace Magnum { namespace Shaders {
+
+ParticleSystem::ParticleSystem(NoCreateT) noexcept:
+    _buffers{GL::Buffer{NoCreate}, GL::Buffer{NoCreate}},
+    _feedbacks{GL::TransformFeedback{NoCreate}, GL::TransformFeedback{NoCreate}},
+    _simulationMeshes{GL::Mesh{NoCreate}, GL::Mesh{NoCreate}},
+    _renderMeshes{GL::Mesh{NoCreate}, GL::Mesh{NoCreate}} {}
+
+ParticleSystem::ParticleSystem(const UnsignedInt count, const Float lifetime): ParticleSystem{NoCreate} {
+    CORRADE_ASSERT(count,
+        "Shaders::ParticleSystem: particle count can't be zero", );
+    CORRADE_ASSERT(lifetime > 0.0f,
+        "Shaders::ParticleSystem: expected a positive lifetime, got" << lifetime, );
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::transform_feedback2);
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::instanced_arrays);
+    #endif
+
+    _count = count;
+
+    /* All particles start not emitted, with ages evenly distributed over
+       the lifetime so the emission rate is constant from the start */
+    Containers::Array<Vector4> data{Containers::ValueInit, 2*std::size_t(count)};
+    for(std::size_t i = 0; i != count; ++i) {
+        data[2*i] = {{}, -lifetime*Float(i + 1)/Float(count)};
+        data[2*i + 1] = {{}, lifetime};
+    }
+
+    for(std::size_t i = 0; i != 2; ++i) {
+        _buffers[i] = GL::Buffer{GL::Buffer::TargetHint::Array};
+        _buffers[i].setData(data, GL::BufferUsage::DynamicCopy);
+    }
+
+    for(std::size_t i = 0; i != 2; ++i) {
+        /* Feedback i captures the particles read from buffer i into the
+           other one */
+        _feedbacks[i] = GL::TransformFeedback{};
+        _feedbacks[i].attachBuffer(0, _buffers[i ^ 1]);
+
+        _simulationMeshes[i] = GL::Mesh{GL::MeshPrimitive::Points};
+        _simulationMeshes[i].setCount(count)
+            .addVertexBuffer(_buffers[i], 0,
+                ParticleSimulation::Position{},
+                ParticleSimulation::Velocity{});
+
+        /* Corners are generated from the vertex ID, so the only attributes
+           are per-instance */
+        _renderMeshes[i] = GL::Mesh{GL::MeshPrimitive::TriangleStrip};
+        _renderMeshes[i].setCount(4)
+            .setInstanceCount(count)
+            .addVertexBufferInstanced(_buffers[i], 1, 0,
+                Particles::Position{},
+                Particles::Velocity{});
+    }
+}
+
+ParticleSystem& ParticleSystem::update(ParticleSimulation& shader, const Float timeDelta) {
+    CORRADE_ASSERT(_count,
+        "Shaders::ParticleSystem::update(): the particle system is moved-out or not created", *this);
+
+    shader.setTimeDelta(timeDelta)
+        .setSeed(_step++);
+
+    GL::Renderer::enable(GL::Renderer::Feature::RasterizerDiscard);
+    _feedbacks[_current].begin(shader, GL::TransformFeedback::PrimitiveMode::Points);
+    _simulationMeshes[_current].draw(shader);
+    _feedbacks[_current].end();
+    GL::Renderer::disable(GL::Renderer::Feature::RasterizerDiscard);
+
+    _current ^= 1;
+    return *this;
+}
+
+ParticleSystem& ParticleSystem::draw(Particles& shader) {
+    CORRADE_ASSERT(_count,
+        "Shaders::ParticleSystem::draw(): the particle system is moved-out or not created", *this);
+
+    _renderMeshes[_current].draw(shader);
+    return *this;
+}
+
+}}
@@ -0,0 +1,172 @@
+#ifndef Magnum_Shaders_ParticleSystem_h
+#define Magnum_Shaders_ParticleSystem_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::ParticleSystem
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/TransformFeedback.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief GPU particle system
+
+Keeps particle state in two @ref GL::Buffer instances and advances it with
+@ref ParticleSimulation through @ref GL::TransformFeedback, swapping the
+buffers after every step, so the particle data never leave the GPU. Rendering
+with @ref Particles draws the most recently written buffer as instanced
+sprites.
+
+@section Shaders-ParticleSystem-usage Example usage
+
+@code{.cpp}
+Shaders::ParticleSimulation simulation;
+Shaders::Particles shader;
+Shaders::ParticleSystem particles{100000, 2.0f};
+
+// each frame
+simulation.setAcceleration({0.0f, -9.81f, 0.0f})
+    .setEmitterPosition(emitter)
+    .setEmitterVelocity({0.0f, 5.0f, 0.0f})
+    .setEmitterSpread(1.0f)
+    .setLifetime(2.0f);
+particles.update(simulation, timeline.previousFrameDuration());
+
+shader.setTransformationMatrix(camera)
+    .setProjectionMatrix(projection);
+particles.draw(shader);
+@endcode
+
+All particles start unemitted with ages evenly distributed over the lifetime
+passed to the constructor, so a constant stream of particles is emitted from
+the first update on. Setting @ref ParticleSimulation::setLifetime() to the
+same value keeps the emission rate constant afterwards.
+
+@section Shaders-ParticleSystem-performance Performance optimizations
+
+Every @ref update() is a single point draw with
+@ref GL::Renderer::Feature::RasterizerDiscard enabled and every @ref draw() a
+single instanced draw, without any CPU-side work or synchronization
+proportional to the particle count. The buffers, meshes and transform
+feedback objects are created once in the constructor, so it's advised to
+create the particle system with the maximal particle count upfront.
+
+@requires_gl40 Extension @gl_extension{ARB,transform_feedback2}
+@requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+@requires_gles30 Transform feedback is not available in OpenGL ES 2.0.
+@requires_webgl20 Transform feedback is not available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT ParticleSystem {
+    public:
+        /**
+         * @brief Constructor
+         * @param count     Particle count
+         * @param lifetime  Particle lifetime in seconds used to distribute
+         *      the initial particle ages
+         *
+         * Expects that @p count is not zero and @p lifetime is positive.
+         */
+        explicit ParticleSystem(UnsignedInt count, Float lifetime);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL objects
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit ParticleSystem(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        ParticleSystem(const ParticleSystem&) = delete;
+
+        /** @brief Move constructor */
+        ParticleSystem(ParticleSystem&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+        /** @brief Move assignment */
+        ParticleSystem& operator=(ParticleSystem&&) noexcept = default;
+
+        /** @brief Particle count */
+        UnsignedInt count() const { return _count; }
+
+        /**
+         * @brief Buffer with current particle state
+         *
+         * Contains @ref count() pairs of @ref ParticleSimulation::Position
+         * and @ref ParticleSimulation::Velocity, interleaved. Changes after
+         * every @ref update().
+         */
+        GL::Buffer& buffer() { return _buffers[_current]; }
+
+        /**
+         * @brief Advance the simulation
+         * @return Reference to self (for method chaining)
+         *
+         * Sets @ref ParticleSimulation::setTimeDelta() and
+         * @ref ParticleSimulation::setSeed() on @p shader, captures the
+         * updated particles into the other buffer and swaps the buffers.
+         * Other simulation parameters are taken from @p shader as-is.
+         * Expects that the instance is not moved-out or created with
+         * @ref NoCreate.
+         */
+        ParticleSystem& update(ParticleSimulation& shader, Float timeDelta);
+
+        /**
+         * @brief Draw the particles
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the instance is not moved-out or created with
+         * @ref NoCreate.
+         */
+        ParticleSystem& draw(Particles& shader);
+
+    private:
+        UnsignedInt _count{}, _current{}, _step{};
+        GL::Buffer _buffers[2];
+        GL::TransformFeedback _feedbacks[2];
+        GL::Mesh _simulationMeshes[2], _renderMeshes[2];
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef Magnum_Shaders_Particles_h
+#define Magnum_Shaders_Particles_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::Particles
+ */
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/ParticleSimulation.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Particle rendering shader
+
+Renders particles simulated with @ref ParticleSimulation as camera-facing
+round sprites. Each particle is one instance of a four-vertex triangle strip
+with corners generated from the vertex ID, so no vertex data besides the
+per-instance @ref Position and @ref Velocity attributes are needed. The color
+is interpolated from @ref setColor() to @ref setFadeColor() over the particle
+lifetime and particles that are not emitted yet or already dead are not
+rendered. The shader is meant to be used through @ref ParticleSystem::draw().
+
+The shader doesn't write depth-dependent output and the particles are not
+sorted, so it's meant to be used with blending enabled and depth writes
+disabled, for example with additive blending:
+
+@code{.cpp}
+GL::Renderer::enable(GL::Renderer::Feature::Blending);
+GL::Renderer::setBlendFunction(GL::Renderer::BlendFunction::SourceAlpha,
+                               GL::Renderer::BlendFunction::One);
+GL::Renderer::setDepthMask(false);
+
+shader.setTransformationMatrix(camera)
+    .setProjectionMatrix(projection)
+    .setParticleSize(0.05f)
+    .setColor(0xffcc66ff_rgbaf)
+    .setFadeColor(0xff330000_rgbaf);
+particles.draw(shader);
+@endcode
+
+@requires_gl30 Extension @gl_extension{EXT,gpu_shader4} for `gl_VertexID`
+@requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+@requires_gles30 Instanced arrays and `gl_VertexID` are not available in
+    OpenGL ES 2.0.
+@requires_webgl20 Instanced arrays and `gl_VertexID` are not available in
+    WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT Particles: public GL::AbstractShaderProgram {
+    public:
+        /**
+         * @brief Particle position and age
+         *
+         * Same as @ref ParticleSimulation::Position.
+         */
+        typedef ParticleSimulation::Position Position;
+
+        /**
+         * @brief Particle velocity and lifetime
+         *
+         * Same as @ref ParticleSimulation::Velocity.
+         */
+        typedef ParticleSimulation::Velocity Velocity;
+
+        /** @brief Constructor */
+        explicit Particles();
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit Particles(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        Particles(const Particles&) = delete;
+
+        /** @brief Move constructor */
+        Particles(Particles&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        Particles& operator=(const Particles&) = delete;
+
+        /** @brief Move assignment */
+        Particles& operator=(Particles&&) noexcept = default;
+
+        /**
+         * @brief Set transformation matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Transforms the particles to view space, where the sprites are
+         * expanded. Initial value is an identity matrix.
+         */
+        Particles& setTransformationMatrix(const Matrix4& matrix) {
+            setUniform(_transformationMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Set projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Initial value is an identity matrix.
+         */
+        Particles& setProjectionMatrix(const Matrix4& matrix) {
+            setUniform(_projectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Set particle size
+         * @return Reference to self (for method chaining)
+         *
+         * Radius of the sprite in view space units. Initial value is
+         * @cpp 1.0f @ce.
+         */
+        Particles& setParticleSize(Float size) {
+            setUniform(_particleSizeUniform, size);
+            return *this;
+        }
+
+        /**
+         * @brief Set color
+         * @return Reference to self (for method chaining)
+         *
+         * Color of newly emitted particles. Initial value is
+         * @cpp 0xffffffff_rgbaf @ce.
+         * @see @ref setFadeColor()
+         */
+        Particles& setColor(const Color4& color) {
+            setUniform(_colorUniform, color);
+            return *this;
+        }
+
+        /**
+         * @brief Set fade color
+         * @return Reference to self (for method chaining)
+         *
+         * Color of particles at the end of their lifetime, the color is
+         * linearly interpolated from @ref setColor() over the lifetime.
+         * Initial value is @cpp 0xffffff00_rgbaf @ce.
+         */
+        Particles& setFadeColor(const Color4& color) {
+            setUniform(_fadeColorUniform, color);
+            return *this;
+        }
+
+    private:
+        Int _transformationMatrixUniform{0},
+            _projectionMatrixUniform{1},
+            _particleSizeUniform{2},
+            _colorUniform{3},
+            _fadeColorUniform{4};
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -0,0 +1,84 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#define VELOCITY_ATTRIBUTE_LOCATION 1
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 0)
+#endif
+uniform highp mat4 transformationMatrix
+    #ifndef GL_ES
+    = mat4(1.0)
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 1)
+#endif
+uniform highp mat4 projectionMatrix
+    #ifndef GL_ES
+    = mat4(1.0)
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 2)
+#endif
+uniform highp float particleSize
+    #ifndef GL_ES
+    = 1.0
+    #endif
+    ;
+
+/* Position in XYZ, age in W */
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = POSITION_ATTRIBUTE_LOCATION)
+#endif
+in highp vec4 position;
+
+/* Velocity in XYZ, lifetime in W */
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = VELOCITY_ATTRIBUTE_LOCATION)
+#endif
+in highp vec4 velocity;
+
+out mediump vec2 cornerCoordinates;
+out lowp float normalizedAge;
+
+void main() {
+    /* Quad corners for a four-vertex triangle strip, generated from the
+       vertex ID so no vertex buffer is needed */
+    highp vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1))*2.0 - vec2(1.0);
+    cornerCoordinates = corner;
+
+    highp float age = position.w/velocity.w;
+    normalizedAge = clamp(age, 0.0, 1.0);
+
+    /* Billboard in view space, particles that are not emitted yet or already
+       dead collapse into a degenerate quad */
+    highp vec4 viewPosition = transformationMatrix*vec4(position.xyz, 1.0);
+    viewPosition.xy += corner*(age >= 0.0 && age < 1.0 ? particleSize : 0.0);
+    gl_Position = projectionMatrix*viewPosition;
+}
@@ -32,10 +32,23 @@
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Resource.h>
 
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/GL/Buffer.h"
+#endif
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Shader.h"
 #include "Magnum/GL/Texture.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/GL/CubeMapTexture.h"
+#include "Magnum/GL/TextureArray.h"
+#endif
+#ifndef MAGNUM_TARGET_GLES
+#include "Magnum/Shaders/LightCulling.h"
+#endif
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Shaders/ShadowCascades.h"
+#endif
 
 #include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
 
@@ -45,11 +58,81 @@ namespace {
     enum: Int {
         AmbientTextureLayer = 0,
         DiffuseTextureLayer = 1,
-        SpecularTextureLayer = 2
+        SpecularTextureLayer = 2,
+        ShadowTextureLayer = 3,
+        IrradianceTextureLayer = 4,
+        SpecularEnvironmentTextureLayer = 5,
+        BrdfLookupTextureLayer = 6
+    };
+
+    #ifndef MAGNUM_TARGET_GLES2
+    enum: UnsignedInt {
+        ProjectionBufferBinding = 0,
+        TransformationBufferBinding = 1,
+        MaterialBufferBinding = 2,
+        LightBufferBinding = 3,
+        JointBufferBinding = 4
     };
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* Same as in LightCulling */
+    enum: UnsignedInt {
+        ClusteredLightBufferBinding = 0,
+        LightClusterBufferBinding = 1
+    };
+    #endif
 }
 
-Phong::Phong(const Flags flags, const UnsignedInt lightCount): _flags{flags}, _lightCount{lightCount}, _lightColorsUniform{9 + Int(lightCount)} {
+Phong::Phong(const Flags flags, const UnsignedInt lightCount, const UnsignedInt jointCount): _flags{flags}, _lightCount{lightCount},
+    #ifndef MAGNUM_TARGET_GLES2
+    _jointCount{flags & Flag::Skinning ? jointCount : 0},
+    #else
+    _jointCount{},
+    #endif
+    _lightColorsUniform{9 + Int(lightCount)}
+    #ifndef MAGNUM_TARGET_GLES2
+    , _shadowMatricesUniform{9 + 2*Int(lightCount)},
+    _shadowSplitDistancesUniform{13 + 2*Int(lightCount)},
+    _environmentRotationUniform{14 + 2*Int(lightCount)},
+    _specularEnvironmentLevelCountUniform{15 + 2*Int(lightCount)}
+    #endif
+{
+    CORRADE_ASSERT(!(flags & Flag::DepthOnly) || !(flags & ~(Flag::DepthOnly|Flag::InstancedTransformation
+        #ifndef MAGNUM_TARGET_GLES2
+        |Flag::UniformBuffers|Flag::Skinning
+        #endif
+        )),
+        "Shaders::Phong: depth-only rendering can be combined only with instanced transformation, uniform buffers and skinning", );
+
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_ASSERT(!(flags & Flag::Skinning) || jointCount,
+        "Shaders::Phong: expected non-zero joint count with skinning enabled", );
+    CORRADE_ASSERT(!(flags & Flag::Shadows) || lightCount,
+        "Shaders::Phong: expected non-zero light count with shadows enabled", );
+    #else
+    static_cast<void>(jointCount);
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_ASSERT(!(flags & Flag::GBuffer) || !(flags & (Flag::DepthOnly|Flag::Shadows|Flag::WeightedBlendedTransparency
+        #ifndef MAGNUM_TARGET_GLES
+        |Flag::ClusteredLights
+        #endif
+        )),
+        "Shaders::Phong: G-buffer output can't be combined with depth-only rendering, shadows, clustered lights or weighted blended transparency", );
+    CORRADE_ASSERT(!(flags & Flag::GBuffer) || !(flags & Flag::ImageBasedLighting),
+        "Shaders::Phong: G-buffer output can't be combined with image-based lighting", );
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(flags & Flag::Shadows) || !(flags & Flag::ClusteredLights),
+        "Shaders::Phong: shadows can't be used together with clustered lights", );
+
+    /* Lights come from a buffer of arbitrary size in this case */
+    if(flags & Flag::ClusteredLights) _lightCount = 0;
+    #endif
+
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
     if(!Utility::Resource::hasGroup("MagnumShaders"))
@@ -58,7 +141,27 @@ Phong::Phong(const Flags flags, const UnsignedInt lightCount): _flags{flags}, _l
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
-    const GL::Version version = GL::Context::current().supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
+    if(flags & (Flag::UniformBuffers|Flag::Skinning))
+        MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::uniform_buffer_object);
+    /* Integer attributes, array shadow samplers and explicit LOD cube map
+       sampling need GLSL 1.30 */
+    if(flags & (Flag::Skinning|Flag::Shadows|Flag::WeightedBlendedTransparency|Flag::GBuffer|Flag::ImageBasedLighting))
+        MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    #elif !defined(MAGNUM_TARGET_GLES2)
+    if(flags & (Flag::UniformBuffers|Flag::Skinning|Flag::Shadows|Flag::WeightedBlendedTransparency|Flag::GBuffer|Flag::ImageBasedLighting))
+        MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GLES300);
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::BindlessTextures)
+        MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::bindless_texture);
+    if(flags & Flag::ClusteredLights)
+        MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL430);
+    /* Shader storage buffers require GLSL 4.30, bindless textures GLSL
+       4.00 */
+    const GL::Version version = flags & Flag::ClusteredLights ? GL::Version::GL430 :
+        flags & Flag::BindlessTextures ? GL::Version::GL400 :
+        GL::Context::current().supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
     #else
     const GL::Version version = GL::Context::current().supportedVersion({GL::Version::GLES300, GL::Version::GLES200});
     #endif
@@ -86,14 +189,55 @@ Phong::Phong(const Flags flags, const UnsignedInt lightCount): _flags{flags}, _l
     lightInitializer.resize(lightInitializer.size() - 1);
     #endif
 
-    vert.addSource(flags ? "#define TEXTURED\n" : "")
+    vert.addSource(flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture) ? "#define TEXTURED\n" : "")
+        .addSource(flags & Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        .addSource(flags & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n" : "")
+        #ifndef MAGNUM_TARGET_GLES2
+        .addSource(flags & Flag::UniformBuffers ? "#define UNIFORM_BUFFERS\n" : "")
+        .addSource(flags & Flag::Skinning ? Utility::formatString(
+            "#define SKINNING\n"
+            "#define JOINT_COUNT {}\n", jointCount) : "")
+        .addSource((flags & Flag::DualQuaternionSkinning) == Flag::DualQuaternionSkinning ? "#define DUAL_QUATERNION_SKINNING\n" : "")
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        .addSource(flags & Flag::ClusteredLights ? "#define CLUSTERED_LIGHTS\n" : "")
+        #endif
+        .addSource(flags & Flag::DepthOnly ? "#define DEPTH_ONLY\n" : "")
         .addSource(Utility::formatString("#define LIGHT_COUNT {}\n", lightCount))
         .addSource(rs.get("generic.glsl"))
         .addSource(rs.get("Phong.vert"));
-    frag.addSource(flags & Flag::AmbientTexture ? "#define AMBIENT_TEXTURE\n" : "")
+    if(flags & Flag::DepthOnly) frag.addSource(rs.get("DepthOnly.frag"));
+    else frag.addSource(flags & Flag::AmbientTexture ? "#define AMBIENT_TEXTURE\n" : "")
         .addSource(flags & Flag::DiffuseTexture ? "#define DIFFUSE_TEXTURE\n" : "")
         .addSource(flags & Flag::SpecularTexture ? "#define SPECULAR_TEXTURE\n" : "")
         .addSource(flags & Flag::AlphaMask ? "#define ALPHA_MASK\n" : "")
+        .addSource(flags & Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        #ifndef MAGNUM_TARGET_GLES2
+        .addSource(flags & Flag::UniformBuffers ? "#define UNIFORM_BUFFERS\n" : "")
+        .addSource(flags & Flag::Shadows ? Utility::formatString(
+            "#define SHADOWS\n"
+            "#define SHADOW_MATRICES_LOCATION {}\n"
+            "#define SHADOW_SPLIT_DISTANCES_LOCATION {}\n",
+            _shadowMatricesUniform, _shadowSplitDistancesUniform) : "")
+        .addSource(flags & Flag::WeightedBlendedTransparency ? "#define WEIGHTED_BLENDED_TRANSPARENCY\n" : "")
+        .addSource(flags & Flag::GBuffer ? "#define G_BUFFER\n" : "")
+        .addSource(flags & Flag::ImageBasedLighting ? Utility::formatString(
+            "#define IMAGE_BASED_LIGHTING\n"
+            "#define ENVIRONMENT_ROTATION_LOCATION {}\n"
+            "#define SPECULAR_ENVIRONMENT_LEVEL_COUNT_LOCATION {}\n",
+            _environmentRotationUniform, _specularEnvironmentLevelCountUniform) : "")
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        .addSource(flags & Flag::BindlessTextures ? "#define BINDLESS_TEXTURES\n" : "")
+        .addSource(flags & Flag::ClusteredLights ? Utility::formatString(
+            "#define CLUSTERED_LIGHTS\n"
+            "#define CLUSTER_COUNT uvec3({}, {}, {})\n"
+            "#define MAX_LIGHTS_PER_CLUSTER {}u\n",
+            LightCulling::clusterCount().x(),
+            LightCulling::clusterCount().y(),
+            LightCulling::clusterCount().z(),
+            LightCulling::maxLightsPerCluster()) : "")
+        #endif
         .addSource(Utility::formatString(
             "#define LIGHT_COUNT {}\n"
             "#define LIGHT_COLORS_LOCATION {}\n", lightCount, 9 + lightCount))
@@ -102,24 +246,79 @@ Phong::Phong(const Flags flags, const UnsignedInt lightCount): _flags{flags}, _l
         #endif
         .addSource(rs.get("Phong.frag"));
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+    /* Load the program from the binary cache, if there's one, otherwise
+       compile and link it from the sources */
+    if(!loadCachedBinary({vert, frag})) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
 
-    attachShaders({vert, frag});
+        attachShaders({vert, frag});
 
-    #ifndef MAGNUM_TARGET_GLES
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
-    #else
-    if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
-    #endif
-    {
-        bindAttributeLocation(Position::Location, "position");
-        bindAttributeLocation(Normal::Location, "normal");
-        if(flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture))
-            bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
+        #else
+        if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
+        #endif
+        {
+            bindAttributeLocation(Position::Location, "position");
+            if(!(flags & Flag::DepthOnly))
+                bindAttributeLocation(Normal::Location, "normal");
+            if(flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture))
+                bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+            if(flags & Flag::VertexColor)
+                bindAttributeLocation(Color3::Location, "vertexColor"); /* Color4 is the same */
+            if(flags & Flag::InstancedTransformation) {
+                bindAttributeLocation(TransformationMatrix::Location, "instancedTransformationMatrix");
+                if(!(flags & Flag::DepthOnly))
+                    bindAttributeLocation(NormalMatrix::Location, "instancedNormalMatrix");
+            }
+            #ifndef MAGNUM_TARGET_GLES2
+            if(flags & Flag::Skinning) {
+                bindAttributeLocation(JointIds::Location, "jointIds");
+                bindAttributeLocation(Weights::Location, "weights");
+            }
+            #endif
+            #ifndef MAGNUM_TARGET_GLES
+            if(flags & Flag::WeightedBlendedTransparency) {
+                bindFragmentDataLocation(AccumulationOutput, "accumulation");
+                bindFragmentDataLocation(WeightOutput, "weight");
+            }
+            if(flags & Flag::GBuffer) {
+                bindFragmentDataLocation(AlbedoOutput, "albedo");
+                bindFragmentDataLocation(NormalOutput, "normalShininess");
+            }
+            #endif
+        }
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        saveCachedBinary({vert, frag});
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    #ifndef MAGNUM_TARGET_GLES2
+    /* There are no individual uniforms with uniform buffers, make the setters
+       no-op */
+    if(flags & Flag::UniformBuffers) {
+        _transformationMatrixUniform = _projectionMatrixUniform =
+            _normalMatrixUniform = _ambientColorUniform =
+            _diffuseColorUniform = _specularColorUniform = _shininessUniform =
+            _alphaMaskUniform = _lightPositionsUniform =
+            _lightColorsUniform = -1;
 
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
+        #endif
+        {
+            setUniformBlockBinding(uniformBlockIndex("Projection"), ProjectionBufferBinding);
+            setUniformBlockBinding(uniformBlockIndex("Transformation"), TransformationBufferBinding);
+            /* The material and lights are not used for depth-only
+               rendering */
+            if(!(flags & Flag::DepthOnly)) {
+                setUniformBlockBinding(uniformBlockIndex("Material"), MaterialBufferBinding);
+                setUniformBlockBinding(uniformBlockIndex("Lights"), LightBufferBinding);
+            }
+        }
+    } else
+    #endif
     #ifndef MAGNUM_TARGET_GLES
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
     #endif
@@ -137,7 +336,75 @@ Phong::Phong(const Flags flags, const UnsignedInt lightCount): _flags{flags}, _l
     }
 
     #ifndef MAGNUM_TARGET_GLES
-    if(flags && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
+    /* There are no light uniforms with clustered lights */
+    if(flags & Flag::ClusteredLights)
+        _lightPositionsUniform = _lightColorsUniform = -1;
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    /* The shadow uniforms are not in an uniform buffer even if uniform
+       buffers are enabled */
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::Shadows && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
+    #else
+    if(flags & Flag::Shadows)
+    #endif
+    {
+        _shadowMatricesUniform = uniformLocation("shadowMatrices");
+        _shadowSplitDistancesUniform = uniformLocation("shadowSplitDistances");
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::Shadows && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
+    #else
+    if(flags & Flag::Shadows)
+    #endif
+    {
+        setUniform(uniformLocation("shadowTexture"), ShadowTextureLayer);
+    }
+
+    /* Same for the image-based lighting uniforms */
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::ImageBasedLighting && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
+    #else
+    if(flags & Flag::ImageBasedLighting)
+    #endif
+    {
+        _environmentRotationUniform = uniformLocation("environmentRotation");
+        _specularEnvironmentLevelCountUniform = uniformLocation("specularEnvironmentLevelCount");
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::ImageBasedLighting && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
+    #else
+    if(flags & Flag::ImageBasedLighting)
+    #endif
+    {
+        setUniform(uniformLocation("irradianceTexture"), IrradianceTextureLayer);
+        setUniform(uniformLocation("specularEnvironmentTexture"), SpecularEnvironmentTextureLayer);
+        setUniform(uniformLocation("brdfLookupTexture"), BrdfLookupTextureLayer);
+    }
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::Skinning && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
+    #else
+    if(flags & Flag::Skinning)
+    #endif
+    {
+        setUniformBlockBinding(uniformBlockIndex("Joints"), JointBufferBinding);
+    }
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* Bindless samplers don't have any location or texture layer assigned,
+       the handles are set directly */
+    if(flags & Flag::BindlessTextures) {
+        if(flags & Flag::AmbientTexture) _ambientTextureUniform = uniformLocation("ambientTexture");
+        if(flags & Flag::DiffuseTexture) _diffuseTextureUniform = uniformLocation("diffuseTexture");
+        if(flags & Flag::SpecularTexture) _specularTextureUniform = uniformLocation("specularTexture");
+    } else if(flags && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
     #endif
     {
         if(flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"), AmbientTextureLayer);
@@ -148,17 +415,23 @@ Phong::Phong(const Flags flags, const UnsignedInt lightCount): _flags{flags}, _l
     /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
     #ifdef MAGNUM_TARGET_GLES
     /* Default to fully opaque white so we can see the textures */
-    if(flags & Flag::AmbientTexture) setAmbientColor(Color4{1.0f});
-    else setAmbientColor(Color4{0.0f});
-    setDiffuseColor(Color4{1.0f});
-    setSpecularColor(Color4{1.0f});
+    if(flags & Flag::AmbientTexture) setAmbientColor(Magnum::Color4{1.0f});
+    else setAmbientColor(Magnum::Color4{0.0f});
+    setDiffuseColor(Magnum::Color4{1.0f});
+    setSpecularColor(Magnum::Color4{1.0f});
     setShininess(80.0f);
     if(flags & Flag::AlphaMask) setAlphaMask(0.5f);
-    setLightColors(Containers::Array<Color4>{Containers::DirectInit, lightCount, Color4{1.0f}});
+    setLightColors(Containers::Array<Magnum::Color4>{Containers::DirectInit, lightCount, Magnum::Color4{1.0f}});
 
     setTransformationMatrix({});
     setProjectionMatrix({});
     setNormalMatrix({});
+    #ifndef MAGNUM_TARGET_GLES2
+    if(flags & Flag::ImageBasedLighting) {
+        setEnvironmentRotation({});
+        setSpecularEnvironmentLevelCount(1);
+    }
+    #endif
     /* Light position is zero by default */
     #endif
 }
@@ -191,6 +464,46 @@ Phong& Phong::bindTextures(GL::Texture2D* ambient, GL::Texture2D* diffuse, GL::T
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES
+Phong& Phong::setAmbientTextureHandle(const UnsignedLong handle) {
+    CORRADE_ASSERT(_flags & Flag::BindlessTextures,
+        "Shaders::Phong::setAmbientTextureHandle(): the shader was not created with bindless textures enabled", *this);
+    CORRADE_ASSERT(_flags & Flag::AmbientTexture,
+        "Shaders::Phong::setAmbientTextureHandle(): the shader was not created with ambient texture enabled", *this);
+    setUniformHandle(_ambientTextureUniform, handle);
+    return *this;
+}
+
+Phong& Phong::setDiffuseTextureHandle(const UnsignedLong handle) {
+    CORRADE_ASSERT(_flags & Flag::BindlessTextures,
+        "Shaders::Phong::setDiffuseTextureHandle(): the shader was not created with bindless textures enabled", *this);
+    CORRADE_ASSERT(_flags & Flag::DiffuseTexture,
+        "Shaders::Phong::setDiffuseTextureHandle(): the shader was not created with diffuse texture enabled", *this);
+    setUniformHandle(_diffuseTextureUniform, handle);
+    return *this;
+}
+
+Phong& Phong::setSpecularTextureHandle(const UnsignedLong handle) {
+    CORRADE_ASSERT(_flags & Flag::BindlessTextures,
+        "Shaders::Phong::setSpecularTextureHandle(): the shader was not created with bindless textures enabled", *this);
+    CORRADE_ASSERT(_flags & Flag::SpecularTexture,
+        "Shaders::Phong::setSpecularTextureHandle(): the shader was not created with specular texture enabled", *this);
+    setUniformHandle(_specularTextureUniform, handle);
+    return *this;
+}
+
+Phong& Phong::setTextureHandles(const UnsignedLong ambient, const UnsignedLong diffuse, const UnsignedLong specular) {
+    CORRADE_ASSERT(_flags & Flag::BindlessTextures,
+        "Shaders::Phong::setTextureHandles(): the shader was not created with bindless textures enabled", *this);
+    CORRADE_ASSERT(_flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture),
+        "Shaders::Phong::setTextureHandles(): the shader was not created with any textures enabled", *this);
+    if(_flags & Flag::AmbientTexture) setUniformHandle(_ambientTextureUniform, ambient);
+    if(_flags & Flag::DiffuseTexture) setUniformHandle(_diffuseTextureUniform, diffuse);
+    if(_flags & Flag::SpecularTexture) setUniformHandle(_specularTextureUniform, specular);
+    return *this;
+}
+#endif
+
 Phong& Phong::setAlphaMask(Float mask) {
     CORRADE_ASSERT(_flags & Flag::AlphaMask,
         "Shaders::Phong::setAlphaMask(): the shader was not created with alpha mask enabled", *this);
@@ -201,6 +514,9 @@ Phong& Phong::setAlphaMask(Float mask) {
 Phong& Phong::setLightPositions(const Containers::ArrayView<const Vector3> positions) {
     CORRADE_ASSERT(_lightCount == positions.size(),
         "Shaders::Phong::setLightPositions(): expected" << _lightCount << "items but got" << positions.size(), *this);
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_flags & Flag::UniformBuffers) return *this;
+    #endif
     setUniform(_lightPositionsUniform, positions);
     return *this;
 }
@@ -208,24 +524,178 @@ Phong& Phong::setLightPositions(const Containers::ArrayView<const Vector3> posit
 Phong& Phong::setLightPosition(UnsignedInt id, const Vector3& position) {
     CORRADE_ASSERT(id < _lightCount,
         "Shaders::Phong::setLightPosition(): light ID" << id << "is out of bounds for" << _lightCount << "lights", *this);
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_flags & Flag::UniformBuffers) return *this;
+    #endif
     setUniform(_lightPositionsUniform + id, position);
     return *this;
 }
 
-Phong& Phong::setLightColors(const Containers::ArrayView<const Color4> colors) {
+Phong& Phong::setLightColors(const Containers::ArrayView<const Magnum::Color4> colors) {
     CORRADE_ASSERT(_lightCount == colors.size(),
         "Shaders::Phong::setLightColors(): expected" << _lightCount << "items but got" << colors.size(), *this);
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_flags & Flag::UniformBuffers) return *this;
+    #endif
     setUniform(_lightColorsUniform, colors);
     return *this;
 }
 
-Phong& Phong::setLightColor(UnsignedInt id, const Color4& color) {
+Phong& Phong::setLightColor(UnsignedInt id, const Magnum::Color4& color) {
     CORRADE_ASSERT(id < _lightCount,
         "Shaders::Phong::setLightColor(): light ID" << id << "is out of bounds for" << _lightCount << "lights", *this);
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_flags & Flag::UniformBuffers) return *this;
+    #endif
     setUniform(_lightColorsUniform + id, color);
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+Phong& Phong::bindProjectionBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Phong::bindProjectionBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(GL::Buffer::Target::Uniform, ProjectionBufferBinding);
+    return *this;
+}
+
+Phong& Phong::bindProjectionBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Phong::bindProjectionBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(GL::Buffer::Target::Uniform, ProjectionBufferBinding, offset, size);
+    return *this;
+}
+
+Phong& Phong::bindTransformationBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Phong::bindTransformationBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(GL::Buffer::Target::Uniform, TransformationBufferBinding);
+    return *this;
+}
+
+Phong& Phong::bindTransformationBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Phong::bindTransformationBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(GL::Buffer::Target::Uniform, TransformationBufferBinding, offset, size);
+    return *this;
+}
+
+Phong& Phong::bindMaterialBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Phong::bindMaterialBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(GL::Buffer::Target::Uniform, MaterialBufferBinding);
+    return *this;
+}
+
+Phong& Phong::bindMaterialBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Phong::bindMaterialBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(GL::Buffer::Target::Uniform, MaterialBufferBinding, offset, size);
+    return *this;
+}
+
+Phong& Phong::bindLightBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Phong::bindLightBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(GL::Buffer::Target::Uniform, LightBufferBinding);
+    return *this;
+}
+
+Phong& Phong::bindLightBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Phong::bindLightBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(GL::Buffer::Target::Uniform, LightBufferBinding, offset, size);
+    return *this;
+}
+
+Phong& Phong::bindJointBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags & Flag::Skinning,
+        "Shaders::Phong::bindJointBuffer(): the shader was not created with skinning enabled", *this);
+    buffer.bind(GL::Buffer::Target::Uniform, JointBufferBinding);
+    return *this;
+}
+
+Phong& Phong::bindJointBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags & Flag::Skinning,
+        "Shaders::Phong::bindJointBuffer(): the shader was not created with skinning enabled", *this);
+    buffer.bind(GL::Buffer::Target::Uniform, JointBufferBinding, offset, size);
+    return *this;
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+Phong& Phong::bindShadowTexture(GL::Texture2DArray& texture) {
+    CORRADE_ASSERT(_flags & Flag::Shadows,
+        "Shaders::Phong::bindShadowTexture(): the shader was not created with shadows enabled", *this);
+    texture.bind(ShadowTextureLayer);
+    return *this;
+}
+
+Phong& Phong::setShadowMatrices(const Containers::ArrayView<const Matrix4> matrices) {
+    CORRADE_ASSERT(_flags & Flag::Shadows,
+        "Shaders::Phong::setShadowMatrices(): the shader was not created with shadows enabled", *this);
+    CORRADE_ASSERT(matrices.size() <= ShadowCascades::maxCascadeCount(),
+        "Shaders::Phong::setShadowMatrices(): expected at most" << ShadowCascades::maxCascadeCount() << "items but got" << matrices.size(), *this);
+    setUniform(_shadowMatricesUniform, matrices);
+    return *this;
+}
+
+Phong& Phong::setShadowSplitDistances(const Containers::ArrayView<const Float> distances) {
+    CORRADE_ASSERT(_flags & Flag::Shadows,
+        "Shaders::Phong::setShadowSplitDistances(): the shader was not created with shadows enabled", *this);
+    CORRADE_ASSERT(distances.size() <= ShadowCascades::maxCascadeCount(),
+        "Shaders::Phong::setShadowSplitDistances(): expected at most" << ShadowCascades::maxCascadeCount() << "items but got" << distances.size(), *this);
+    /* Unused cascades have a zero distance, so they're never picked */
+    Vector4 packed;
+    for(std::size_t i = 0; i != distances.size(); ++i)
+        packed[i] = distances[i];
+    setUniform(_shadowSplitDistancesUniform, packed);
+    return *this;
+}
+
+Phong& Phong::setShadowCascades(const ShadowCascades& cascades) {
+    return setShadowMatrices(cascades.textureMatrices())
+        .setShadowSplitDistances(cascades.splitDistances().suffix(1));
+}
+
+Phong& Phong::bindImageBasedLightingTextures(GL::CubeMapTexture& irradiance, GL::CubeMapTexture& specularEnvironment, GL::Texture2D& brdfLookup) {
+    CORRADE_ASSERT(_flags & Flag::ImageBasedLighting,
+        "Shaders::Phong::bindImageBasedLightingTextures(): the shader was not created with image-based lighting enabled", *this);
+    GL::AbstractTexture::bind(IrradianceTextureLayer, {&irradiance, &specularEnvironment, &brdfLookup});
+    return *this;
+}
+
+Phong& Phong::setEnvironmentRotation(const Matrix3x3& rotation) {
+    CORRADE_ASSERT(_flags & Flag::ImageBasedLighting,
+        "Shaders::Phong::setEnvironmentRotation(): the shader was not created with image-based lighting enabled", *this);
+    setUniform(_environmentRotationUniform, rotation);
+    return *this;
+}
+
+Phong& Phong::setSpecularEnvironmentLevelCount(const UnsignedInt count) {
+    CORRADE_ASSERT(_flags & Flag::ImageBasedLighting,
+        "Shaders::Phong::setSpecularEnvironmentLevelCount(): the shader was not created with image-based lighting enabled", *this);
+    setUniform(_specularEnvironmentLevelCountUniform, Float(count));
+    return *this;
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+Phong& Phong::bindClusteredLightBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags & Flag::ClusteredLights,
+        "Shaders::Phong::bindClusteredLightBuffer(): the shader was not created with clustered lights enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, ClusteredLightBufferBinding);
+    return *this;
+}
+
+Phong& Phong::bindLightClusterBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags & Flag::ClusteredLights,
+        "Shaders::Phong::bindLightClusterBuffer(): the shader was not created with clustered lights enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, LightClusterBufferBinding);
+    return *this;
+}
+#endif
+
 Debug& operator<<(Debug& debug, const Phong::Flag value) {
     switch(value) {
         /* LCOV_EXCL_START */
@@ -234,11 +704,33 @@ Debug& operator<<(Debug& debug, const Phong::Flag value) {
         _c(DiffuseTexture)
         _c(SpecularTexture)
         _c(AlphaMask)
+        #ifndef MAGNUM_TARGET_GLES
+        _c(BindlessTextures)
+        #endif
+        _c(VertexColor)
+        _c(InstancedTransformation)
+        #ifndef MAGNUM_TARGET_GLES2
+        _c(UniformBuffers)
+        _c(Skinning)
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        _c(ClusteredLights)
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        _c(Shadows)
+        #endif
+        _c(DepthOnly)
+        #ifndef MAGNUM_TARGET_GLES2
+        _c(WeightedBlendedTransparency)
+        _c(GBuffer)
+        _c(ImageBasedLighting)
+        _c(DualQuaternionSkinning)
+        #endif
         #undef _c
         /* LCOV_EXCL_STOP */
     }
 
-    return debug << "Shaders::Phong::Flag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+    return debug << "Shaders::Phong::Flag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedShort(value)) << Debug::nospace << ")";
 }
 
 Debug& operator<<(Debug& debug, const Phong::Flags value) {
@@ -246,7 +738,31 @@ Debug& operator<<(Debug& debug, const Phong::Flags value) {
         Phong::Flag::AmbientTexture,
         Phong::Flag::DiffuseTexture,
         Phong::Flag::SpecularTexture,
-        Phong::Flag::AlphaMask});
+        Phong::Flag::AlphaMask,
+        #ifndef MAGNUM_TARGET_GLES
+        Phong::Flag::BindlessTextures,
+        #endif
+        Phong::Flag::VertexColor,
+        Phong::Flag::InstancedTransformation,
+        #ifndef MAGNUM_TARGET_GLES2
+        Phong::Flag::UniformBuffers,
+        /* Superset of Skinning, has to be before */
+        Phong::Flag::DualQuaternionSkinning,
+        Phong::Flag::Skinning,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        Phong::Flag::ClusteredLights,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        Phong::Flag::Shadows,
+        #endif
+        Phong::Flag::DepthOnly,
+        #ifndef MAGNUM_TARGET_GLES2
+        Phong::Flag::WeightedBlendedTransparency,
+        Phong::Flag::GBuffer,
+        Phong::Flag::ImageBasedLighting
+        #endif
+        });
 }
 
 }}
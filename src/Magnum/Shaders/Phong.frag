@@ -23,6 +23,14 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#ifdef BINDLESS_TEXTURES
+#extension GL_ARB_bindless_texture: require
+#endif
+
+#if defined(UNIFORM_BUFFERS) && !defined(GL_ES) && __VERSION__ < 140
+#extension GL_ARB_uniform_buffer_object: require
+#endif
+
 #ifndef NEW_GLSL
 #define in varying
 #define color gl_FragColor
@@ -34,12 +42,33 @@
 #endif
 
 #ifdef AMBIENT_TEXTURE
-#ifdef EXPLICIT_TEXTURE_LAYER
+#ifdef BINDLESS_TEXTURES
+layout(bindless_sampler)
+#elif defined(EXPLICIT_TEXTURE_LAYER)
 layout(binding = 0)
 #endif
 uniform lowp sampler2D ambientTexture;
 #endif
 
+#ifdef DIFFUSE_TEXTURE
+#ifdef BINDLESS_TEXTURES
+layout(bindless_sampler)
+#elif defined(EXPLICIT_TEXTURE_LAYER)
+layout(binding = 1)
+#endif
+uniform lowp sampler2D diffuseTexture;
+#endif
+
+#ifdef SPECULAR_TEXTURE
+#ifdef BINDLESS_TEXTURES
+layout(bindless_sampler)
+#elif defined(EXPLICIT_TEXTURE_LAYER)
+layout(binding = 2)
+#endif
+uniform lowp sampler2D specularTexture;
+#endif
+
+#ifndef UNIFORM_BUFFERS
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 4)
 #endif
@@ -53,13 +82,6 @@ uniform lowp vec4 ambientColor
     #endif
     ;
 
-#ifdef DIFFUSE_TEXTURE
-#ifdef EXPLICIT_TEXTURE_LAYER
-layout(binding = 1)
-#endif
-uniform lowp sampler2D diffuseTexture;
-#endif
-
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 5)
 #endif
@@ -69,13 +91,6 @@ uniform lowp vec4 diffuseColor
     #endif
     ;
 
-#ifdef SPECULAR_TEXTURE
-#ifdef EXPLICIT_TEXTURE_LAYER
-layout(binding = 2)
-#endif
-uniform lowp sampler2D specularTexture;
-#endif
-
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 6)
 #endif
@@ -105,6 +120,7 @@ uniform lowp float alphaMask
     ;
 #endif
 
+#ifndef CLUSTERED_LIGHTS
 /* Needs to be last because it uses locations 9 + LIGHT_COUNT to
    9 + 2*LIGHT_COUNT - 1. Location 9 is lightPositions. Also it can't be
    specified as 9 + LIGHT_COUNT because that requires ARB_enhanced_layouts. */
@@ -116,29 +132,181 @@ uniform lowp vec4 lightColors[LIGHT_COUNT]
     = vec4[](LIGHT_COLOR_INITIALIZER)
     #endif
     ;
+#endif
+#else
+#ifdef EXPLICIT_BINDING
+layout(std140, binding = 2)
+#else
+layout(std140)
+#endif
+uniform Material {
+    lowp vec4 ambientColor;
+    lowp vec4 diffuseColor;
+    lowp vec4 specularColor;
+    mediump float shininess;
+    lowp float alphaMask;
+};
+
+#ifndef CLUSTERED_LIGHTS
+/* Has to match the declaration in the vertex shader */
+#ifdef EXPLICIT_BINDING
+layout(std140, binding = 3)
+#else
+layout(std140)
+#endif
+uniform Lights {
+    highp vec4 lightPositions[LIGHT_COUNT];
+    lowp vec4 lightColors[LIGHT_COUNT];
+};
+#endif
+#endif
+
+#ifdef SHADOWS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 3)
+#endif
+uniform highp sampler2DArrayShadow shadowTexture;
+
+/* Placed after the light colors, using four locations. Not a part of the
+   uniform buffers. */
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = SHADOW_MATRICES_LOCATION)
+#endif
+uniform highp mat4 shadowMatrices[4]; /* defaults to zero */
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = SHADOW_SPLIT_DISTANCES_LOCATION)
+#endif
+uniform highp vec4 shadowSplitDistances; /* defaults to zero, no shadows */
+#endif
+
+#ifdef IMAGE_BASED_LIGHTING
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 4)
+#endif
+uniform mediump samplerCube irradianceTexture;
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 5)
+#endif
+uniform mediump samplerCube specularEnvironmentTexture;
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 6)
+#endif
+uniform mediump sampler2D brdfLookupTexture;
+
+/* Placed after the shadow uniforms, not a part of the uniform buffers
+   either */
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = ENVIRONMENT_ROTATION_LOCATION)
+#endif
+uniform mediump mat3 environmentRotation
+    #ifndef GL_ES
+    = mat3(1.0)
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = SPECULAR_ENVIRONMENT_LEVEL_COUNT_LOCATION)
+#endif
+uniform mediump float specularEnvironmentLevelCount
+    #ifndef GL_ES
+    = 1.0
+    #endif
+    ;
+#endif
+
+#ifdef CLUSTERED_LIGHTS
+/* Matches the LightCulling::Light structure */
+struct Light {
+    highp vec4 position; /* view-space position in xyz, range in w */
+    lowp vec4 color;
+};
+
+/* Same bindings as in LightCulling.comp */
+layout(std430, binding = 0) readonly buffer ClusteredLights {
+    Light lights[];
+};
+
+/* For every cluster a light count followed by MAX_LIGHTS_PER_CLUSTER light
+   indices */
+layout(std430, binding = 1) readonly buffer LightClusters {
+    uint clusters[];
+};
+#endif
 
 in mediump vec3 transformedNormal;
+#ifndef CLUSTERED_LIGHTS
 in highp vec3 lightDirections[LIGHT_COUNT];
+#else
+in highp vec3 viewPosition;
+in highp vec4 clipPosition;
+flat in highp vec2 clusterDepth;
+#endif
 in highp vec3 cameraDirection;
 
 #if defined(AMBIENT_TEXTURE) || defined(DIFFUSE_TEXTURE) || defined(SPECULAR_TEXTURE)
 in mediump vec2 interpolatedTextureCoords;
 #endif
 
-#ifdef NEW_GLSL
+#ifdef VERTEX_COLOR
+in lowp vec4 interpolatedVertexColor;
+#endif
+
+#ifdef G_BUFFER
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 0)
+#endif
+out lowp vec4 albedo;
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 1)
+#endif
+out mediump vec4 normalShininess;
+
+/* Octahedral encoding of an unit vector into [-1, 1]^2, has to match the
+   decoding in DeferredLight.frag */
+mediump vec2 octahedralEncode(mediump vec3 normal) {
+    normal /= abs(normal.x) + abs(normal.y) + abs(normal.z);
+    if(normal.z < 0.0)
+        normal.xy = (vec2(1.0) - abs(normal.yx))*vec2(
+            normal.x >= 0.0 ? 1.0 : -1.0,
+            normal.y >= 0.0 ? 1.0 : -1.0);
+    return normal.xy;
+}
+#elif defined(WEIGHTED_BLENDED_TRANSPARENCY)
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 0)
+#endif
+out highp vec4 accumulation;
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 1)
+#endif
+out highp float weight;
+#elif defined(NEW_GLSL)
 out lowp vec4 color;
 #endif
 
 void main() {
+    #if defined(G_BUFFER) || defined(WEIGHTED_BLENDED_TRANSPARENCY)
+    lowp vec4 color;
+    #endif
+
     lowp const vec4 finalAmbientColor =
         #ifdef AMBIENT_TEXTURE
         texture(ambientTexture, interpolatedTextureCoords)*
         #endif
+        #ifdef VERTEX_COLOR
+        interpolatedVertexColor*
+        #endif
         ambientColor;
     lowp const vec4 finalDiffuseColor =
         #ifdef DIFFUSE_TEXTURE
         texture(diffuseTexture, interpolatedTextureCoords)*
         #endif
+        #ifdef VERTEX_COLOR
+        interpolatedVertexColor*
+        #endif
         diffuseColor;
     lowp const vec4 finalSpecularColor =
         #ifdef SPECULAR_TEXTURE
@@ -151,10 +319,73 @@ void main() {
 
     mediump vec3 normalizedTransformedNormal = normalize(transformedNormal);
 
+    #ifdef G_BUFFER
+    /* The lighting is done later by DeferredLight, write just the material
+       properties. Specular color gets reduced to a single intensity stored
+       in albedo alpha, shininess is stored logarithmically to have enough
+       precision in the 10-bit channel for the usual [1, 1024] range. */
+    #ifdef ALPHA_MASK
+    if(finalDiffuseColor.a < alphaMask) discard;
+    #endif
+    albedo = vec4(finalDiffuseColor.rgb, dot(finalSpecularColor.rgb, vec3(1.0/3.0)));
+    normalShininess = vec4(
+        octahedralEncode(normalizedTransformedNormal)*0.5 + vec2(0.5),
+        clamp(log2(max(shininess, 1.0))/10.0, 0.0, 1.0), 1.0);
+    #else
+    #ifdef SHADOWS
+    /* Pick the first cascade containing the fragment and look up the shadow
+       map. Fragments beyond the last cascade are lit. */
+    lowp float shadow = 1.0;
+    for(int i = 0; i < 4; ++i) {
+        if(cameraDirection.z < shadowSplitDistances[i]) {
+            highp vec4 shadowCoordinates = shadowMatrices[i]*vec4(-cameraDirection, 1.0);
+            shadow = texture(shadowTexture, vec4(shadowCoordinates.xy, float(i), shadowCoordinates.z));
+            break;
+        }
+    }
+    #endif
+
+    #ifdef CLUSTERED_LIGHTS
+    /* Find the cluster of this fragment, clamping to the grid bounds. The
+       depth slices are distributed exponentially between near and far
+       plane, matching LightCulling.comp. */
+    const uvec3 clusterCount = CLUSTER_COUNT;
+    highp vec2 tile = clamp((clipPosition.xy/clipPosition.w*0.5 + vec2(0.5))*vec2(clusterCount.xy), vec2(0.0), vec2(clusterCount.xy - uvec2(1)));
+    highp float slice = clamp(log(-viewPosition.z/clusterDepth.x)/clusterDepth.y*float(clusterCount.z), 0.0, float(clusterCount.z - 1u));
+    uint cluster = (uint(slice)*clusterCount.y + uint(tile.y))*clusterCount.x + uint(tile.x);
+    uint offset = cluster*(MAX_LIGHTS_PER_CLUSTER + 1u);
+
+    /* Add diffuse color for each light affecting the cluster */
+    uint count = clusters[offset];
+    for(uint i = 0u; i < count; ++i) {
+        Light light = lights[clusters[offset + 1u + i]];
+        highp vec3 lightDirection = light.position.xyz - viewPosition;
+        highp float distanceRatio = length(lightDirection)/light.position.w;
+
+        /* Smooth falloff to zero at the light range */
+        lowp float attenuation = clamp(1.0 - distanceRatio*distanceRatio, 0.0, 1.0);
+        attenuation *= attenuation;
+
+        highp vec3 normalizedLightDirection = normalize(lightDirection);
+        lowp float intensity = max(0.0, dot(normalizedTransformedNormal, normalizedLightDirection))*attenuation;
+        color += vec4(finalDiffuseColor.rgb*light.color.rgb*intensity, light.color.a*finalDiffuseColor.a);
+
+        /* Add specular color, if needed */
+        if(intensity > 0.001) {
+            highp vec3 reflection = reflect(-normalizedLightDirection, normalizedTransformedNormal);
+            mediump float specularity = pow(max(0.0, dot(normalize(cameraDirection), reflection)), shininess);
+            color += vec4(finalSpecularColor.rgb*specularity*attenuation, finalSpecularColor.a);
+        }
+    }
+    #else
     /* Add diffuse color for each light */
     for(int i = 0; i < LIGHT_COUNT; ++i) {
         highp vec3 normalizedLightDirection = normalize(lightDirections[i]);
         lowp float intensity = max(0.0, dot(normalizedTransformedNormal, normalizedLightDirection));
+        #ifdef SHADOWS
+        /* Only the first light casts shadows */
+        if(i == 0) intensity *= shadow;
+        #endif
         color += vec4(finalDiffuseColor.rgb*lightColors[i].rgb*intensity, lightColors[i].a*finalDiffuseColor.a);
 
         /* Add specular color, if needed */
@@ -164,8 +395,38 @@ void main() {
             color += vec4(finalSpecularColor.rgb*specularity, finalSpecularColor.a);
         }
     }
+    #endif
+
+    #ifdef IMAGE_BASED_LIGHTING
+    /* Split-sum approximation, matching the parametrization used by
+       TextureTools::prefilterSpecularEnvironment() and brdfLookupTable().
+       The perceptual roughness is derived from the Blinn-Phong exponent
+       with the usual alpha = sqrt(2/(shininess + 2)) mapping, alpha being
+       roughness squared. */
+    highp vec3 normalizedCameraDirection = normalize(cameraDirection);
+    mediump float roughness = sqrt(sqrt(2.0/(max(shininess, 0.0) + 2.0)));
+    mediump float normalDotView = max(dot(normalizedTransformedNormal, normalizedCameraDirection), 0.0);
+    mediump vec2 brdf = texture(brdfLookupTexture, vec2(normalDotView, roughness)).rg;
+    mediump vec3 environmentNormal = environmentRotation*normalizedTransformedNormal;
+    mediump vec3 environmentReflection = environmentRotation*reflect(-normalizedCameraDirection, normalizedTransformedNormal);
+    color.rgb += finalDiffuseColor.rgb*texture(irradianceTexture, environmentNormal).rgb;
+    color.rgb += textureLod(specularEnvironmentTexture, environmentReflection, roughness*(specularEnvironmentLevelCount - 1.0)).rgb*(finalSpecularColor.rgb*brdf.x + vec3(brdf.y));
+    #endif
 
     #ifdef ALPHA_MASK
     if(color.a < alphaMask) discard;
     #endif
+    #endif
+
+    #ifdef WEIGHTED_BLENDED_TRANSPARENCY
+    /* Depth weight from McGuire and Bavoil, Weighted Blended Order-Independent
+       Transparency, equation 10. Alpha of the accumulation output gets
+       multiplied by the blending into the revealage, the weighted alpha is
+       summed to normalize the color in the composite pass. */
+    lowp float alpha = clamp(color.a, 0.0, 1.0);
+    highp float depth = cameraDirection.z;
+    highp float depthWeight = alpha*clamp(10.0/(1.0e-5 + pow(depth/5.0, 2.0) + pow(depth/200.0, 6.0)), 1.0e-2, 3.0e3);
+    accumulation = vec4(color.rgb*alpha*depthWeight, alpha);
+    weight = alpha*depthWeight;
+    #endif
 }
@@ -33,6 +33,7 @@
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/Shaders.h"
 #include "Magnum/Shaders/visibility.h"
 
 namespace Magnum { namespace Shaders {
@@ -95,6 +96,256 @@ diffuse part and then separate the alpha like this:
 
 @snippet MagnumShaders.cpp Phong-usage-alpha
 
+@subsection Shaders-Phong-usage-bindless Bindless textures
+
+On desktop GL with @gl_extension{ARB,bindless_texture} you can enable
+@ref Flag::BindlessTextures together with the texture flags. The textures are
+then not bound to texture units, but referenced by handles returned from
+@ref GL::AbstractTexture::handle(), which are made resident once and then only
+set as uniforms. Switching materials then doesn't involve any texture
+binding:
+
+@snippet MagnumShaders.cpp Phong-usage-bindless
+
+@subsection Shaders-Phong-usage-instancing Instanced rendering
+
+Enabling @ref Flag::InstancedTransformation will make the shader additionally
+multiply the transformation and normal matrix with per-instance
+@ref TransformationMatrix and @ref NormalMatrix attributes, while
+@ref Flag::VertexColor multiplies the ambient and diffuse color with a
+@ref Color3 / @ref Color4 attribute. If the color buffer is added using
+@ref GL::Mesh::addVertexBufferInstanced(), the color is per-instance as well.
+A single draw then renders all instances set with
+@ref GL::Mesh::setInstanceCount():
+
+@snippet MagnumShaders.cpp Phong-usage-instancing
+
+@subsection Shaders-Phong-usage-uniform-buffers Uniform buffers
+
+With @ref Flag::UniformBuffers the shader takes its parameters from uniform
+buffers instead of individual uniforms. The projection, transformation,
+material and light parameters are split into separate blocks, bound with
+@ref bindProjectionBuffer(), @ref bindTransformationBuffer(),
+@ref bindMaterialBuffer() and @ref bindLightBuffer(). Layout of the first
+three is described by the @ref ProjectionUniform, @ref TransformationUniform
+and @ref MaterialUniform structures, the light buffer contains
+@ref lightCount() @ref Magnum::Vector4 "Vector4" positions followed by
+@ref lightCount() @ref Magnum::Color4 "Color4" colors. All parameters for a
+whole frame can be then uploaded at once and each draw only binds a different
+range of the buffer. Offsets of the ranges have to be aligned to
+@ref GL::Buffer::uniformOffsetAlignment():
+
+@snippet MagnumShaders.cpp Phong-usage-uniform-buffers
+
+The individual uniform setters such as @ref setTransformationMatrix() or
+@ref setDiffuseColor() have no effect in this case.
+
+@subsection Shaders-Phong-usage-skinning Skinned meshes
+
+Enabling @ref Flag::Skinning makes the shader blend up to four joint matrices
+per vertex, referenced by the @ref JointIds attribute and weighted by the
+@ref Weights attribute, which can be filled from
+@ref Trade::MeshData3D::jointIds() and @ref Trade::MeshData3D::weights().
+The joint count is passed to the constructor and the joint matrices, for
+example calculated from the current @ref Animation::Player state, are
+uploaded to a uniform buffer bound with @ref bindJointBuffer():
+
+@snippet MagnumShaders.cpp Phong-usage-skinning
+
+For rigidly animated joints, @ref Flag::DualQuaternionSkinning takes the joint
+transformations as @ref Magnum::DualQuaternion "DualQuaternion" instances
+instead, which is 8 floats per joint instead of 16. These can be calculated
+directly from a @ref SceneGraph::DualQuaternionTransformation hierarchy using
+@ref SceneGraph::Object::transformations() without going through matrices:
+
+@snippet MagnumSceneGraph-gl.cpp Phong-usage-skinning-dual-quaternion
+
+@subsection Shaders-Phong-usage-clustered-lights Clustered lights
+
+With the default setup every fragment is shaded with all @ref lightCount()
+lights, which limits the practical light count to a few dozens at most. With
+@ref Flag::ClusteredLights the lights are taken from a shader storage buffer
+bound with @ref bindClusteredLightBuffer() instead, each having a limited
+range, and @ref LightCulling bins them into a grid of view frustum clusters
+stored in a buffer bound with @ref bindLightClusterBuffer(). Each fragment
+then iterates only the lights affecting its cluster. The light contribution
+falls off smoothly to zero at the light range. See the @ref LightCulling
+documentation for an example.
+
+The light positions are in view space, the same space as is used for the
+non-clustered lights. As @ref lightCount() is zero in this case, the
+individual light setters such as @ref setLightPositions() can't be used.
+
+@subsection Shaders-Phong-usage-shadows Shadows
+
+With @ref Flag::Shadows the contribution of the first light is attenuated by
+a lookup into a cascaded shadow map bound with @ref bindShadowTexture(). The
+shadow map is a depth @ref GL::Texture2DArray with comparison enabled, one
+layer per cascade, rendered with @ref ShadowDepth. The cascade of each
+fragment is picked based on its view-space depth from distances set with
+@ref setShadowSplitDistances() and the shadow map coordinates are calculated
+with matrices set with @ref setShadowMatrices(). Both are usually taken from
+@ref ShadowCascades using @ref setShadowCascades(). As the cascades are
+calculated for a directional light, the first light should be placed far
+away against the light direction, transformed to view space like all other
+light positions.
+
+@code{.cpp}
+Shaders::Phong shader{Shaders::Phong::Flag::Shadows};
+shader.setLightPosition(camera.cameraMatrix().transformVector(-cascades.lightDirection())*1000.0f)
+    .bindShadowTexture(shadowMap)
+    .setShadowCascades(cascades);
+@endcode
+
+See the @ref ShadowDepth documentation for the shadow map setup.
+
+@subsection Shaders-Phong-usage-image-based-lighting Image-based lighting
+
+With @ref Flag::ImageBasedLighting the ambient and specular lighting comes
+additionally from an environment cube map, using the split-sum approximation.
+The diffuse color is multiplied with an irradiance cube map sampled in the
+normal direction and the specular color is scaled and biased by a BRDF lookup
+table and multiplied with a prefiltered environment sampled in the reflection
+direction. The specular environment mip level is picked based on a roughness
+derived from @ref setShininess(). All three textures are bound with
+@ref bindImageBasedLightingTextures() and are meant to be calculated once at
+startup using @ref TextureTools::irradianceEnvironment(),
+@ref TextureTools::prefilterSpecularEnvironment() and
+@ref TextureTools::brdfLookupTable(). As the lighting is calculated in view
+space, the camera rotation has to be passed to
+@ref setEnvironmentRotation() each frame.
+
+@code{.cpp}
+GL::CubeMapTexture irradiance, specular;
+GL::Texture2D brdf;
+// set up the storage, see below
+TextureTools::irradianceEnvironment(environment, irradiance, 32);
+TextureTools::prefilterSpecularEnvironment(environment, specular, 256, 6);
+TextureTools::brdfLookupTable(brdf, {128, 128});
+
+Shaders::Phong shader{Shaders::Phong::Flag::ImageBasedLighting};
+shader.bindImageBasedLightingTextures(irradiance, specular, brdf)
+    .setSpecularEnvironmentLevelCount(6);
+
+// each frame
+shader.setEnvironmentRotation(camera.cameraMatrix().rotationScaling().transposed());
+@endcode
+
+See the @ref TextureTools::prefilterSpecularEnvironment() documentation for
+details about the texture setup.
+
+@subsection Shaders-Phong-usage-depth-only Depth pre-pass
+
+With @ref Flag::DepthOnly the shader needs just the @ref Position attribute
+(and @ref TransformationMatrix with @ref Flag::InstancedTransformation) and
+doesn't do any lighting or other fragment work, which makes it suitable for
+filling the depth buffer before the actual shading pass. Only the
+transformation and projection matrix needs to be set, or the projection and
+transformation uniform buffer bound with @ref Flag::UniformBuffers. The
+position is declared invariant, so the depth values written are exactly the
+same as when drawing with @ref Flag::DepthOnly disabled and the shading pass
+can then use @ref GL::Renderer::DepthFunction::Equal with depth writes
+disabled, shading each visible pixel exactly once:
+
+@code{.cpp}
+Shaders::Phong depthShader{Shaders::Phong::Flag::DepthOnly};
+depthShader.setTransformationMatrix(transformation)
+    .setProjectionMatrix(projection);
+mesh.draw(depthShader);
+
+GL::Renderer::setDepthFunction(GL::Renderer::DepthFunction::Equal);
+GL::Renderer::setDepthMask(false);
+mesh.draw(shader);
+@endcode
+
+The depth-only shader has to be created with the same
+@ref Flag::InstancedTransformation and @ref Flag::Skinning flags as the
+shader used for the shading pass, otherwise the positions may differ. See
+@ref SceneGraph-Camera-depth-prepass for drawing a whole scene this way.
+
+@subsection Shaders-Phong-usage-transparency Order-independent transparency
+
+Transparent geometry drawn with classic alpha blending needs to be sorted back
+to front, for example with @ref SceneGraph::DrawOrder::BackToFront. With
+@ref Flag::WeightedBlendedTransparency the shader instead implements
+weighted blended order-independent transparency, where the fragments can be
+drawn in any order and intersecting geometry blends plausibly, at the cost of
+the result being only an approximation. The fragments are written into two
+float attachments with additive blending and a depth-dependent weight, the
+accumulation attachment cleared to @cpp 0x00000000_rgbaf @ce except for alpha
+which is cleared to @cpp 1.0f @ce. The opaque geometry is expected to be
+already drawn into the depth buffer, which is used for depth testing with
+depth writes disabled:
+
+@code{.cpp}
+GL::Texture2D accumulation, weight;
+accumulation.setStorage(1, GL::TextureFormat::RGBA16F, size);
+weight.setStorage(1, GL::TextureFormat::R16F, size);
+GL::Framebuffer transparencyFramebuffer{{{}, size}};
+transparencyFramebuffer
+    .attachTexture(GL::Framebuffer::ColorAttachment{0}, accumulation, 0)
+    .attachTexture(GL::Framebuffer::ColorAttachment{1}, weight, 0)
+    .attachRenderbuffer(GL::Framebuffer::BufferAttachment::Depth, depth)
+    .mapForDraw({
+        {Shaders::Phong::AccumulationOutput, GL::Framebuffer::ColorAttachment{0}},
+        {Shaders::Phong::WeightOutput, GL::Framebuffer::ColorAttachment{1}}});
+
+// each frame, after drawing the opaque geometry
+transparencyFramebuffer
+    .clearColor(0, Color4{0.0f, 0.0f, 0.0f, 1.0f})
+    .clearColor(1, Color4{0.0f})
+    .bind();
+GL::Renderer::enable(GL::Renderer::Feature::Blending);
+GL::Renderer::setDepthMask(false);
+GL::Renderer::setBlendFunction(
+    GL::Renderer::BlendFunction::One, GL::Renderer::BlendFunction::One,
+    GL::Renderer::BlendFunction::Zero, GL::Renderer::BlendFunction::OneMinusSourceAlpha);
+mesh.draw(transparentShader);
+@endcode
+
+The accumulated result is then composited over the opaque geometry with
+@ref TransparencyComposite, see its documentation for details. Only
+@ref GL::Renderer::setBlendFunction(BlendFunction, BlendFunction, BlendFunction, BlendFunction)
+is used, so the technique doesn't need a separate blend function for each
+attachment.
+
+@subsection Shaders-Phong-usage-deferred Deferred shading
+
+With @ref Flag::GBuffer the shader doesn't calculate any lighting and instead
+writes the material into a compact G-buffer --- diffuse color with the
+specular intensity in alpha into @ref AlbedoOutput and an octahedral-encoded
+view-space normal together with logarithmically stored shininess into
+@ref NormalOutput. The lights are then accumulated from the G-buffer and the
+depth buffer with @ref DeferredLight, so the cost of lighting depends only on
+the covered screen area and not on the scene complexity. Ambient color, light
+setup and alpha of the diffuse color (except for @ref Flag::AlphaMask) are
+ignored in this case.
+
+@code{.cpp}
+GL::Texture2D albedo, normal, depth;
+albedo.setStorage(1, GL::TextureFormat::RGBA8, size);
+normal.setStorage(1, GL::TextureFormat::RGB10A2, size);
+depth.setStorage(1, GL::TextureFormat::DepthComponent24, size);
+GL::Framebuffer gBuffer{{{}, size}};
+gBuffer
+    .attachTexture(GL::Framebuffer::ColorAttachment{0}, albedo, 0)
+    .attachTexture(GL::Framebuffer::ColorAttachment{1}, normal, 0)
+    .attachTexture(GL::Framebuffer::BufferAttachment::Depth, depth, 0)
+    .mapForDraw({
+        {Shaders::Phong::AlbedoOutput, GL::Framebuffer::ColorAttachment{0}},
+        {Shaders::Phong::NormalOutput, GL::Framebuffer::ColorAttachment{1}}});
+
+Shaders::Phong gBufferShader{Shaders::Phong::Flag::GBuffer};
+
+// each frame
+gBuffer
+    .clear(GL::FramebufferClear::Color|GL::FramebufferClear::Depth)
+    .bind();
+mesh.draw(gBufferShader);
+@endcode
+
+See @ref DeferredLight for how the lights are then applied.
+
 @see @ref shaders
 */
 class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
@@ -125,12 +376,105 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
          */
         typedef Generic3D::TextureCoordinates TextureCoordinates;
 
+        /**
+         * @brief Three-component vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color3. Use
+         * either this or the @ref Color4 attribute. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef Generic3D::Color3 Color3;
+
+        /**
+         * @brief Four-component vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color4. Use
+         * either this or the @ref Color3 attribute. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef Generic3D::Color4 Color4;
+
+        /**
+         * @brief Instanced transformation matrix
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @ref Magnum::Matrix4 "Matrix4". Used only if
+         * @ref Flag::InstancedTransformation is set.
+         */
+        typedef Generic3D::TransformationMatrix TransformationMatrix;
+
+        /**
+         * @brief Instanced normal matrix
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @ref Magnum::Matrix3x3 "Matrix3x3". Used only if
+         * @ref Flag::InstancedTransformation is set.
+         */
+        typedef Generic3D::NormalMatrix NormalMatrix;
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Joint IDs
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @ref Magnum::Vector4ui "Vector4ui". Used only if
+         * @ref Flag::Skinning is set.
+         * @requires_gl30 Extension @gl_extension{EXT,gpu_shader4}
+         * @requires_gles30 Integer attributes are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Integer attributes are not available in WebGL
+         *      1.0.
+         */
+        typedef Generic3D::JointIds JointIds;
+        #endif
+
+        /**
+         * @brief Joint weights
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @ref Magnum::Vector4 "Vector4". Used only if @ref Flag::Skinning is
+         * set.
+         */
+        typedef Generic3D::Weights Weights;
+
+        #ifndef MAGNUM_TARGET_GLES2
+        enum: UnsignedInt {
+            /**
+             * Weighted premultiplied color and revealage output with
+             * @ref Flag::WeightedBlendedTransparency, expected to be mapped to
+             * a @ref GL::TextureFormat::RGBA16F attachment
+             */
+            AccumulationOutput = 0,
+
+            /**
+             * Accumulated weight output with
+             * @ref Flag::WeightedBlendedTransparency, expected to be mapped to
+             * a @ref GL::TextureFormat::R16F attachment
+             */
+            WeightOutput = 1,
+
+            /**
+             * Diffuse color and specular intensity output with
+             * @ref Flag::GBuffer, expected to be mapped to a
+             * @ref GL::TextureFormat::RGBA8 attachment
+             */
+            AlbedoOutput = 0,
+
+            /**
+             * Octahedral-encoded view-space normal and shininess output with
+             * @ref Flag::GBuffer, expected to be mapped to a
+             * @ref GL::TextureFormat::RGB10A2 attachment
+             */
+            NormalOutput = 1
+        };
+        #endif
+
         /**
          * @brief Flag
          *
          * @see @ref Flags, @ref flags()
          */
-        enum class Flag: UnsignedByte {
+        enum class Flag: UnsignedShort {
             /**
              * Multiply ambient color with a texture.
              * @see @ref setAmbientColor(), @ref setAmbientTexture()
@@ -160,7 +504,186 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
              * with proper depth sorting and blending you'll usually get much
              * better performance and output quality.
              */
-            AlphaMask = 1 << 3
+            AlphaMask = 1 << 3,
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Use bindless textures. The textures are referenced by handles
+             * set with @ref setAmbientTextureHandle(),
+             * @ref setDiffuseTextureHandle(), @ref setSpecularTextureHandle()
+             * or @ref setTextureHandles() instead of being bound to texture
+             * units. Has an effect only together with @ref Flag::AmbientTexture,
+             * @ref Flag::DiffuseTexture or @ref Flag::SpecularTexture.
+             * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+             * @requires_gl Bindless textures are not available in OpenGL ES
+             *      or WebGL.
+             */
+            BindlessTextures = 1 << 4,
+            #endif
+
+            /**
+             * Multiply ambient and diffuse color with a @ref Color3 /
+             * @ref Color4 attribute. Added with
+             * @ref GL::Mesh::addVertexBufferInstanced(), the color is taken
+             * per-instance instead of per-vertex.
+             * @see @ref setAmbientColor(), @ref setDiffuseColor()
+             */
+            VertexColor = 1 << 5,
+
+            /**
+             * Multiply the transformation and normal matrix with per-instance
+             * @ref TransformationMatrix and @ref NormalMatrix attributes,
+             * which are expected to be added with
+             * @ref GL::Mesh::addVertexBufferInstanced().
+             * @requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+             * @requires_gles30 Extension @gl_extension{ANGLE,instanced_arrays},
+             *      @gl_extension{EXT,instanced_arrays} or
+             *      @gl_extension{NV,instanced_arrays} in OpenGL ES 2.0.
+             * @requires_webgl20 Extension @webgl_extension{ANGLE,instanced_arrays}
+             *      in WebGL 1.0.
+             */
+            InstancedTransformation = 1 << 6,
+
+            #ifndef MAGNUM_TARGET_GLES2
+            /**
+             * Take the parameters from uniform buffers bound with
+             * @ref bindProjectionBuffer(), @ref bindTransformationBuffer(),
+             * @ref bindMaterialBuffer() and @ref bindLightBuffer() instead of
+             * individual uniforms. See @ref Shaders-Phong-usage-uniform-buffers
+             * for more information.
+             * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+             * @requires_gles30 Uniform buffers are not available in OpenGL ES
+             *      2.0.
+             * @requires_webgl20 Uniform buffers are not available in WebGL
+             *      1.0.
+             */
+            UniformBuffers = 1 << 7,
+
+            /**
+             * Transform the vertices with up to four joint matrices
+             * referenced by the @ref JointIds attribute and weighted by the
+             * @ref Weights attribute. The joint matrices are taken from a
+             * uniform buffer bound with @ref bindJointBuffer(). See
+             * @ref Shaders-Phong-usage-skinning for more information.
+             * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+             *      and @gl_extension{EXT,gpu_shader4}
+             * @requires_gles30 Uniform buffers and integer attributes are not
+             *      available in OpenGL ES 2.0.
+             * @requires_webgl20 Uniform buffers and integer attributes are
+             *      not available in WebGL 1.0.
+             */
+            Skinning = 1 << 8,
+            #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Take lights from a shader storage buffer bound with
+             * @ref bindClusteredLightBuffer() and shade each fragment only
+             * with lights listed for its cluster in a buffer produced by
+             * @ref LightCulling and bound with @ref bindLightClusterBuffer().
+             * The light count passed to the constructor is ignored in this
+             * case. See @ref Shaders-Phong-usage-clustered-lights for more
+             * information.
+             * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+             * @requires_gl Shader storage buffers are not available in
+             *      WebGL and this feature is not implemented for OpenGL ES
+             *      3.1.
+             */
+            ClusteredLights = 1 << 9,
+            #endif
+
+            #ifndef MAGNUM_TARGET_GLES2
+            /**
+             * Attenuate the first light with a cascaded shadow map bound
+             * with @ref bindShadowTexture(). Can't be used together with
+             * @ref Flag::ClusteredLights and expects a non-zero light count.
+             * See @ref Shaders-Phong-usage-shadows for more information.
+             * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+             * @requires_gles30 Texture arrays are not available in OpenGL ES
+             *      2.0.
+             * @requires_webgl20 Texture arrays are not available in WebGL
+             *      1.0.
+             */
+            Shadows = 1 << 10,
+            #endif
+
+            /**
+             * Only transform the position and write depth, with no lighting
+             * or any other fragment work. Can be combined only with
+             * @ref Flag::InstancedTransformation, @ref Flag::UniformBuffers
+             * and @ref Flag::Skinning. See @ref Shaders-Phong-usage-depth-only
+             * for more information.
+             */
+            DepthOnly = 1 << 11,
+
+            #ifndef MAGNUM_TARGET_GLES2
+            /**
+             * Write the color into @ref AccumulationOutput and
+             * @ref WeightOutput for weighted blended order-independent
+             * transparency, composited with @ref TransparencyComposite. See
+             * @ref Shaders-Phong-usage-transparency for more information.
+             * @requires_gl30 Extension @gl_extension{ARB,texture_float}
+             * @requires_gles30 Float render targets are not available in
+             *      OpenGL ES 2.0, @gl_extension{EXT,color_buffer_float} is
+             *      needed in OpenGL ES 3.0+.
+             * @requires_webgl20 Float render targets are not available in
+             *      WebGL 1.0, @webgl_extension{EXT,color_buffer_float} is
+             *      needed in WebGL 2.0.
+             */
+            WeightedBlendedTransparency = 1 << 12,
+
+            /**
+             * Write material properties into @ref AlbedoOutput and
+             * @ref NormalOutput instead of doing any lighting, for deferred
+             * shading with @ref DeferredLight. Can't be combined with
+             * @ref Flag::DepthOnly, @ref Flag::Shadows,
+             * @ref Flag::ClusteredLights or
+             * @ref Flag::WeightedBlendedTransparency. See
+             * @ref Shaders-Phong-usage-deferred for more information.
+             * @requires_gl30 Extension @gl_extension{EXT,gpu_shader4}
+             * @requires_gles30 Multiple render targets with user-defined
+             *      outputs are not available in OpenGL ES 2.0.
+             * @requires_webgl20 Multiple render targets with user-defined
+             *      outputs are not available in WebGL 1.0.
+             */
+            GBuffer = 1 << 13,
+
+            /**
+             * Add ambient and specular lighting from a prefiltered
+             * environment bound with @ref bindImageBasedLightingTextures(),
+             * usually produced by @ref TextureTools::irradianceEnvironment(),
+             * @ref TextureTools::prefilterSpecularEnvironment() and
+             * @ref TextureTools::brdfLookupTable(). Can't be combined with
+             * @ref Flag::DepthOnly or @ref Flag::GBuffer. See
+             * @ref Shaders-Phong-usage-image-based-lighting for more
+             * information.
+             * @requires_gl30 Extension @gl_extension{EXT,gpu_shader4} for
+             *      @glsl textureLod() @ce on cube maps
+             * @requires_gles30 Explicit LOD cube map sampling is not
+             *      available in OpenGL ES 2.0.
+             * @requires_webgl20 Explicit LOD cube map sampling is not
+             *      available in WebGL 1.0.
+             */
+            ImageBasedLighting = 1 << 14,
+
+            /**
+             * Same as @ref Flag::Skinning, but the joint buffer bound with
+             * @ref bindJointBuffer() contains dual quaternions instead of
+             * matrices, which are blended using dual quaternion linear
+             * blending. Compared to matrices that halves the joint buffer
+             * size and avoids volume loss around twisting joints, but the
+             * joint transformations can't contain any scaling. Implies
+             * @ref Flag::Skinning. See @ref Shaders-Phong-usage-skinning for
+             * more information.
+             * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+             *      and @gl_extension{EXT,gpu_shader4}
+             * @requires_gles30 Uniform buffers and integer attributes are not
+             *      available in OpenGL ES 2.0.
+             * @requires_webgl20 Uniform buffers and integer attributes are
+             *      not available in WebGL 1.0.
+             */
+            DualQuaternionSkinning = Skinning|(1 << 15)
+            #endif
         };
 
         /**
@@ -170,12 +693,107 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
          */
         typedef Containers::EnumSet<Flag> Flags;
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Projection uniform buffer layout
+         *
+         * Matches the `std140` layout of the block bound via
+         * @ref bindProjectionBuffer(). Used only if @ref Flag::UniformBuffers
+         * is set.
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        struct ProjectionUniform {
+            /** @brief Projection matrix */
+            Matrix4 projectionMatrix;
+        };
+
+        /**
+         * @brief Transformation uniform buffer layout
+         *
+         * Matches the `std140` layout of the block bound via
+         * @ref bindTransformationBuffer(). Used only if
+         * @ref Flag::UniformBuffers is set.
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        struct TransformationUniform {
+            /**
+             * @brief Set normal matrix
+             *
+             * Pads the columns of @p matrix to four components, as required
+             * by the `std140` layout.
+             */
+            TransformationUniform& setNormalMatrix(const Matrix3x3& matrix) {
+                normalMatrix = Matrix3x4{Vector4{matrix[0], 0.0f},
+                                         Vector4{matrix[1], 0.0f},
+                                         Vector4{matrix[2], 0.0f}};
+                return *this;
+            }
+
+            /** @brief Transformation matrix */
+            Matrix4 transformationMatrix;
+
+            /**
+             * @brief Normal matrix
+             *
+             * A @ref Magnum::Matrix3x3 "Matrix3x3" with each column padded to
+             * four components. Use @ref setNormalMatrix() to fill it.
+             */
+            Matrix3x4 normalMatrix{Vector4{1.0f, 0.0f, 0.0f, 0.0f},
+                                   Vector4{0.0f, 1.0f, 0.0f, 0.0f},
+                                   Vector4{0.0f, 0.0f, 1.0f, 0.0f}};
+        };
+
+        /**
+         * @brief Material uniform buffer layout
+         *
+         * Matches the `std140` layout of the block bound via
+         * @ref bindMaterialBuffer(). Used only if @ref Flag::UniformBuffers is
+         * set. The @ref alphaMask value is used only if @ref Flag::AlphaMask
+         * is set.
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        struct MaterialUniform {
+            /** @brief Ambient color */
+            Magnum::Color4 ambientColor{0.0f};
+
+            /** @brief Diffuse color */
+            Magnum::Color4 diffuseColor{1.0f};
+
+            /** @brief Specular color */
+            Magnum::Color4 specularColor{1.0f};
+
+            /** @brief Shininess */
+            Float shininess{80.0f};
+
+            /** @brief Alpha mask value */
+            Float alphaMask{0.5f};
+
+            #ifndef DOXYGEN_GENERATING_OUTPUT
+            Int:32;
+            Int:32;
+            #endif
+        };
+        #endif
+
         /**
          * @brief Constructor
          * @param flags         Flags
-         * @param lightCount    Count of light sources
+         * @param lightCount    Count of light sources. Ignored if
+         *      @ref Flag::ClusteredLights is set.
+         * @param jointCount    Count of joint matrices. Used only if
+         *      @ref Flag::Skinning is set, in which case it's expected to be
+         *      non-zero.
          */
-        explicit Phong(Flags flags = {}, UnsignedInt lightCount = 1);
+        explicit Phong(Flags flags = {}, UnsignedInt lightCount = 1, UnsignedInt jointCount = 0);
 
         /**
          * @brief Construct without creating the underlying OpenGL object
@@ -204,9 +822,20 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
         /** @brief Flags */
         Flags flags() const { return _flags; }
 
-        /** @brief Light count */
+        /**
+         * @brief Light count
+         *
+         * Always @cpp 0 @ce if @ref Flag::ClusteredLights is set.
+         */
         UnsignedInt lightCount() const { return _lightCount; }
 
+        /**
+         * @brief Joint count
+         *
+         * Always @cpp 0 @ce if @ref Flag::Skinning is not set.
+         */
+        UnsignedInt jointCount() const { return _jointCount; }
+
         /**
          * @brief Set ambient color
          * @return Reference to self (for method chaining)
@@ -216,7 +845,7 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
          * ambient texture, otherwise default value is @cpp 0x00000000_rgbaf @ce.
          * @see @ref bindAmbientTexture()
          */
-        Phong& setAmbientColor(const Color4& color) {
+        Phong& setAmbientColor(const Magnum::Color4& color) {
             setUniform(_ambientColorUniform, color);
             return *this;
         }
@@ -247,7 +876,7 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
          * Initial value is @cpp 0xffffffff_rgbaf @ce.
          * @see @ref bindDiffuseTexture()
          */
-        Phong& setDiffuseColor(const Color4& color) {
+        Phong& setDiffuseColor(const Magnum::Color4& color) {
             setUniform(_diffuseColorUniform, color);
             return *this;
         }
@@ -281,7 +910,7 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
          * @cpp 0x000000ff_rgbaf @ce.
          * @see @ref bindSpecularTexture()
          */
-        Phong& setSpecularColor(const Color4& color) {
+        Phong& setSpecularColor(const Magnum::Color4& color) {
             setUniform(_specularColorUniform, color);
             return *this;
         }
@@ -320,6 +949,72 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
          */
         Phong& bindTextures(GL::Texture2D* ambient, GL::Texture2D* diffuse, GL::Texture2D* specular);
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set ambient texture handle
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with both
+         * @ref Flag::AmbientTexture and @ref Flag::BindlessTextures enabled.
+         * The handle is expected to be resident.
+         * @see @ref GL::AbstractTexture::handle(),
+         *      @ref GL::AbstractTexture::makeHandleResident()
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        Phong& setAmbientTextureHandle(UnsignedLong handle);
+
+        /**
+         * @brief Set diffuse texture handle
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with both
+         * @ref Flag::DiffuseTexture and @ref Flag::BindlessTextures enabled.
+         * The handle is expected to be resident.
+         * @see @ref GL::AbstractTexture::handle(),
+         *      @ref GL::AbstractTexture::makeHandleResident()
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        Phong& setDiffuseTextureHandle(UnsignedLong handle);
+
+        /**
+         * @brief Set specular texture handle
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with both
+         * @ref Flag::SpecularTexture and @ref Flag::BindlessTextures enabled.
+         * The handle is expected to be resident.
+         * @see @ref GL::AbstractTexture::handle(),
+         *      @ref GL::AbstractTexture::makeHandleResident()
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        Phong& setSpecularTextureHandle(UnsignedLong handle);
+
+        /**
+         * @brief Set texture handles
+         * @return Reference to self (for method chaining)
+         *
+         * A particular handle has effect only if particular texture flag from
+         * @ref Phong::Flag "Flag" is set, you can use @cpp 0 @ce for the
+         * rest. Expects that the shader was created with
+         * @ref Flag::BindlessTextures and at least one of
+         * @ref Flag::AmbientTexture, @ref Flag::DiffuseTexture or
+         * @ref Flag::SpecularTexture enabled.
+         * @see @ref setAmbientTextureHandle(),
+         *      @ref setDiffuseTextureHandle(),
+         *      @ref setSpecularTextureHandle()
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        Phong& setTextureHandles(UnsignedLong ambient, UnsignedLong diffuse, UnsignedLong specular);
+        #endif
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /** @brief @copybrief bindTextures()
          * @deprecated Use @ref bindTextures() instead.
@@ -438,10 +1133,10 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
          * Initial values are @cpp 0xffffffff_rgbaf @ce. Expects that the size
          * of the @p colors array is the same as @ref lightCount().
          */
-        Phong& setLightColors(Containers::ArrayView<const Color4> colors);
+        Phong& setLightColors(Containers::ArrayView<const Magnum::Color4> colors);
 
         /** @overload */
-        Phong& setLightColors(std::initializer_list<Color4> colors) {
+        Phong& setLightColors(std::initializer_list<Magnum::Color4> colors) {
             return setLightColors({colors.begin(), colors.size()});
         }
 
@@ -451,9 +1146,9 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
          *
          * Unlike @ref setLightColors() updates just a single light color.
          * Expects that @p id is less than @ref lightCount().
-         * @see @ref setLightColor(const Color4&)
+         * @see @ref setLightColor(const Magnum::Color4&)
          */
-        Phong& setLightColor(UnsignedInt id, const Color4& color);
+        Phong& setLightColor(UnsignedInt id, const Magnum::Color4& color);
 
         /**
          * @brief Set light color
@@ -461,15 +1156,346 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
          *
          * Convenience alternative to @ref setLightColors() when there is just
          * one light.
-         * @see @ref setLightColor(UnsignedInt, const Color4&)
+         * @see @ref setLightColor(UnsignedInt, const Magnum::Color4&)
          */
-        Phong& setLightColor(const Color4& color) {
+        Phong& setLightColor(const Magnum::Color4& color) {
             return setLightColors({&color, 1});
         }
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Bind a projection uniform buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::UniformBuffers
+         * enabled. The buffer is expected to contain a
+         * @ref ProjectionUniform.
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& bindProjectionBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Bind a projection uniform buffer range
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::UniformBuffers
+         * enabled. The @p offset has to be aligned to
+         * @ref GL::Buffer::uniformOffsetAlignment().
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& bindProjectionBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Bind a transformation uniform buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::UniformBuffers
+         * enabled. The buffer is expected to contain a
+         * @ref TransformationUniform.
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& bindTransformationBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Bind a transformation uniform buffer range
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::UniformBuffers
+         * enabled. The @p offset has to be aligned to
+         * @ref GL::Buffer::uniformOffsetAlignment().
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& bindTransformationBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Bind a material uniform buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::UniformBuffers
+         * enabled. The buffer is expected to contain a @ref MaterialUniform.
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& bindMaterialBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Bind a material uniform buffer range
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::UniformBuffers
+         * enabled. The @p offset has to be aligned to
+         * @ref GL::Buffer::uniformOffsetAlignment().
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& bindMaterialBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Bind a light uniform buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::UniformBuffers
+         * enabled. The buffer is expected to contain @ref lightCount()
+         * @ref Magnum::Vector4 "Vector4" light positions followed by
+         * @ref lightCount() @ref Magnum::Color4 "Color4" light colors, the
+         * fourth component of the positions is ignored.
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& bindLightBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Bind a light uniform buffer range
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::UniformBuffers
+         * enabled. The @p offset has to be aligned to
+         * @ref GL::Buffer::uniformOffsetAlignment().
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& bindLightBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Bind a joint matrix uniform buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::Skinning
+         * enabled. The buffer is expected to contain @ref jointCount()
+         * @ref Magnum::Matrix4 "Matrix4" joint matrices, each transforming
+         * from the bind pose to the current pose in model space. If
+         * @ref Flag::DualQuaternionSkinning is enabled, the buffer is
+         * expected to contain @ref jointCount() normalized
+         * @ref Magnum::DualQuaternion "DualQuaternion" instances instead.
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& bindJointBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Bind a joint matrix uniform buffer range
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::Skinning
+         * enabled. The @p offset has to be aligned to
+         * @ref GL::Buffer::uniformOffsetAlignment(), which makes it possible
+         * to have joint matrices of multiple characters in a single buffer.
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& bindJointBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Bind a clustered light buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with
+         * @ref Flag::ClusteredLights enabled. The buffer is expected to
+         * contain one @ref LightCulling::Light per light, the same buffer as
+         * is passed to @ref LightCulling::bindLightBuffer().
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+         * @requires_gl Shader storage buffers are not available in WebGL
+         *      and this feature is not implemented for OpenGL ES 3.1.
+         */
+        Phong& bindClusteredLightBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Bind a light cluster buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with
+         * @ref Flag::ClusteredLights enabled. The buffer is expected to be
+         * filled by @ref LightCulling::cull(), the same buffer as is passed
+         * to @ref LightCulling::bindClusterBuffer().
+         * @see @ref GL::Buffer::bind(GL::Buffer::Target, UnsignedInt)
+         * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+         * @requires_gl Shader storage buffers are not available in WebGL
+         *      and this feature is not implemented for OpenGL ES 3.1.
+         */
+        Phong& bindLightClusterBuffer(GL::Buffer& buffer);
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Bind a shadow map texture
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with @ref Flag::Shadows
+         * enabled. The texture is expected to be a depth texture with
+         * @ref GL::SamplerCompareMode::CompareRefToTexture set and a layer
+         * for each cascade.
+         * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        Phong& bindShadowTexture(GL::Texture2DArray& texture);
+
+        /**
+         * @brief Set shadow matrices
+         * @return Reference to self (for method chaining)
+         *
+         * View space to shadow map texture space transformation of each
+         * cascade, usually @ref ShadowCascades::textureMatrices(). Expects
+         * that the shader was created with @ref Flag::Shadows enabled and
+         * there's at most @ref ShadowCascades::maxCascadeCount() matrices.
+         * Initial value is a zero matrix for all cascades.
+         * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        Phong& setShadowMatrices(Containers::ArrayView<const Matrix4> matrices);
+
+        /**
+         * @overload
+         * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        Phong& setShadowMatrices(std::initializer_list<Matrix4> matrices) {
+            return setShadowMatrices({matrices.begin(), matrices.size()});
+        }
+
+        /**
+         * @brief Set shadow split distances
+         * @return Reference to self (for method chaining)
+         *
+         * View-space distance of the far end of each cascade. Fragments
+         * farther than the last distance are not shadowed. Expects that the
+         * shader was created with @ref Flag::Shadows enabled and there's at
+         * most @ref ShadowCascades::maxCascadeCount() distances. Initial
+         * value is zero for all cascades, i.e. no shadows.
+         * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        Phong& setShadowSplitDistances(Containers::ArrayView<const Float> distances);
+
+        /**
+         * @overload
+         * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        Phong& setShadowSplitDistances(std::initializer_list<Float> distances) {
+            return setShadowSplitDistances({distances.begin(), distances.size()});
+        }
+
+        /**
+         * @brief Set shadow cascades
+         * @return Reference to self (for method chaining)
+         *
+         * Calls @ref setShadowMatrices() with
+         * @ref ShadowCascades::textureMatrices() and
+         * @ref setShadowSplitDistances() with all
+         * @ref ShadowCascades::splitDistances() except the first.
+         * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        Phong& setShadowCascades(const ShadowCascades& cascades);
+
+        /**
+         * @brief Bind image-based lighting textures
+         * @param irradiance            Irradiance cube map
+         * @param specularEnvironment   Prefiltered specular environment cube
+         *      map with roughness increasing with each mip level
+         * @param brdfLookup            Two-channel BRDF lookup table
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with
+         * @ref Flag::ImageBasedLighting enabled. See
+         * @ref Shaders-Phong-usage-image-based-lighting for more
+         * information.
+         * @requires_gl30 Extension @gl_extension{EXT,gpu_shader4}
+         * @requires_gles30 Explicit LOD cube map sampling is not available
+         *      in OpenGL ES 2.0.
+         * @requires_webgl20 Explicit LOD cube map sampling is not available
+         *      in WebGL 1.0.
+         */
+        Phong& bindImageBasedLightingTextures(GL::CubeMapTexture& irradiance, GL::CubeMapTexture& specularEnvironment, GL::Texture2D& brdfLookup);
+
+        /**
+         * @brief Set environment rotation
+         * @return Reference to self (for method chaining)
+         *
+         * Rotation from view space, in which the lighting is calculated, to
+         * the space of the environment maps. Usually the rotation part of
+         * the inverted camera matrix. Expects that the shader was created
+         * with @ref Flag::ImageBasedLighting enabled. Initial value is an
+         * identity matrix.
+         * @requires_gl30 Extension @gl_extension{EXT,gpu_shader4}
+         * @requires_gles30 Explicit LOD cube map sampling is not available
+         *      in OpenGL ES 2.0.
+         * @requires_webgl20 Explicit LOD cube map sampling is not available
+         *      in WebGL 1.0.
+         */
+        Phong& setEnvironmentRotation(const Matrix3x3& rotation);
+
+        /**
+         * @brief Set specular environment level count
+         * @return Reference to self (for method chaining)
+         *
+         * Count of mip levels of the specular environment bound with
+         * @ref bindImageBasedLightingTextures(), the last of them being the
+         * roughest. Expects that the shader was created with
+         * @ref Flag::ImageBasedLighting enabled. Initial value is
+         * @cpp 1 @ce, i.e. the environment is reflected only in its
+         * sharpest form.
+         * @requires_gl30 Extension @gl_extension{EXT,gpu_shader4}
+         * @requires_gles30 Explicit LOD cube map sampling is not available
+         *      in OpenGL ES 2.0.
+         * @requires_webgl20 Explicit LOD cube map sampling is not available
+         *      in WebGL 1.0.
+         */
+        Phong& setSpecularEnvironmentLevelCount(UnsignedInt count);
+        #endif
+
     private:
         Flags _flags;
-        UnsignedInt _lightCount;
+        UnsignedInt _lightCount, _jointCount;
         Int _transformationMatrixUniform{0},
             _projectionMatrixUniform{1},
             _normalMatrixUniform{2},
@@ -480,6 +1506,18 @@ class MAGNUM_SHADERS_EXPORT Phong: public GL::AbstractShaderProgram {
             _alphaMaskUniform{8},
             _lightPositionsUniform{9},
             _lightColorsUniform; /* 9 + lightCount, set in the constructor */
+        #ifndef MAGNUM_TARGET_GLES2
+        /* 9 + 2*lightCount, 13 + 2*lightCount, 14 + 2*lightCount and
+           15 + 2*lightCount, set in the constructor */
+        Int _shadowMatricesUniform, _shadowSplitDistancesUniform,
+            _environmentRotationUniform, _specularEnvironmentLevelCountUniform;
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        /* Queried in the constructor if bindless textures are enabled */
+        Int _ambientTextureUniform{-1},
+            _diffuseTextureUniform{-1},
+            _specularTextureUniform{-1};
+        #endif
 };
 
 /** @debugoperatorclassenum{Phong,Phong::Flag} */
@@ -23,11 +23,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#if (defined(UNIFORM_BUFFERS) || defined(SKINNING)) && !defined(GL_ES) && __VERSION__ < 140
+#extension GL_ARB_uniform_buffer_object: require
+#endif
+
 #ifndef NEW_GLSL
 #define in attribute
 #define out varying
 #endif
 
+#ifndef UNIFORM_BUFFERS
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 0)
 #endif
@@ -55,21 +60,58 @@ uniform mediump mat3 normalMatrix
     #endif
     ;
 
+#if !defined(CLUSTERED_LIGHTS) && !defined(DEPTH_ONLY)
 /* Needs to be last because it uses locations 9 to 9 + LIGHT_COUNT - 1 */
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 9)
 #endif
 uniform highp vec3 lightPositions[LIGHT_COUNT]; /* defaults to zero */
+#endif
+#else
+#ifdef EXPLICIT_BINDING
+layout(std140, binding = 0)
+#else
+layout(std140)
+#endif
+uniform Projection {
+    highp mat4 projectionMatrix;
+};
+
+#ifdef EXPLICIT_BINDING
+layout(std140, binding = 1)
+#else
+layout(std140)
+#endif
+uniform Transformation {
+    highp mat4 transformationMatrix;
+    mediump mat3 normalMatrix;
+};
+
+#if !defined(CLUSTERED_LIGHTS) && !defined(DEPTH_ONLY)
+/* Has to match the declaration in the fragment shader */
+#ifdef EXPLICIT_BINDING
+layout(std140, binding = 3)
+#else
+layout(std140)
+#endif
+uniform Lights {
+    highp vec4 lightPositions[LIGHT_COUNT];
+    lowp vec4 lightColors[LIGHT_COUNT];
+};
+#endif
+#endif
 
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION)
 #endif
 in highp vec4 position;
 
+#ifndef DEPTH_ONLY
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = NORMAL_ATTRIBUTE_LOCATION)
 #endif
 in mediump vec3 normal;
+#endif
 
 #ifdef TEXTURED
 #ifdef EXPLICIT_ATTRIB_LOCATION
@@ -80,30 +122,169 @@ in mediump vec2 textureCoords;
 out mediump vec2 interpolatedTextureCoords;
 #endif
 
+#ifdef VERTEX_COLOR
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION)
+#endif
+in lowp vec4 vertexColor;
+
+out lowp vec4 interpolatedVertexColor;
+#endif
+
+#ifdef INSTANCED_TRANSFORMATION
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION)
+#endif
+in highp mat4 instancedTransformationMatrix;
+
+#ifndef DEPTH_ONLY
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = NORMAL_MATRIX_ATTRIBUTE_LOCATION)
+#endif
+in mediump mat3 instancedNormalMatrix;
+#endif
+#endif
+
+#ifdef SKINNING
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = JOINTIDS_ATTRIBUTE_LOCATION)
+#endif
+in mediump uvec4 jointIds;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = WEIGHTS_ATTRIBUTE_LOCATION)
+#endif
+in mediump vec4 weights;
+
+#ifdef EXPLICIT_BINDING
+layout(std140, binding = 4)
+#else
+layout(std140)
+#endif
+uniform Joints {
+    #ifndef DUAL_QUATERNION_SKINNING
+    highp mat4 jointMatrices[JOINT_COUNT];
+    #else
+    /* Real part in even items, dual part in odd items */
+    highp vec4 jointDualQuaternions[JOINT_COUNT*2];
+    #endif
+};
+#endif
+
+#ifndef DEPTH_ONLY
 out mediump vec3 transformedNormal;
+#ifndef CLUSTERED_LIGHTS
 out highp vec3 lightDirections[LIGHT_COUNT];
+#else
+out highp vec3 viewPosition;
+out highp vec4 clipPosition;
+/* Near plane distance in x, log(far/near) in y */
+flat out highp vec2 clusterDepth;
+#endif
 out highp vec3 cameraDirection;
+#endif
+
+/* Make sure a depth pre-pass produces exactly the same depth as the shading
+   pass so the latter can use an equal depth test */
+invariant gl_Position;
 
 void main() {
+    #ifdef SKINNING
+    #ifndef DUAL_QUATERNION_SKINNING
+    /* Blend the joint matrices */
+    highp mat4 skinMatrix =
+        weights.x*jointMatrices[jointIds.x] +
+        weights.y*jointMatrices[jointIds.y] +
+        weights.z*jointMatrices[jointIds.z] +
+        weights.w*jointMatrices[jointIds.w];
+    #else
+    /* Blend the joint dual quaternions, negating the ones that are in the
+       opposite hemisphere than the first to take the shortest path */
+    highp vec4 firstReal = jointDualQuaternions[jointIds.x*2u];
+    highp vec4 real = weights.x*firstReal;
+    highp vec4 dual = weights.x*jointDualQuaternions[jointIds.x*2u + 1u];
+    for(int i = 1; i < 4; ++i) {
+        highp vec4 jointReal = jointDualQuaternions[jointIds[i]*2u];
+        highp float weight = dot(firstReal, jointReal) < 0.0 ? -weights[i] : weights[i];
+        real += weight*jointReal;
+        dual += weight*jointDualQuaternions[jointIds[i]*2u + 1u];
+    }
+    highp float norm = length(real);
+    real /= norm;
+    dual /= norm;
+
+    /* Convert to a matrix so the rest stays the same as with matrix
+       skinning. Translation is 2*(dual*conjugated(real)).xyz. */
+    highp mat4 skinMatrix = mat4(
+        vec4(1.0 - 2.0*(real.y*real.y + real.z*real.z),
+             2.0*(real.x*real.y + real.w*real.z),
+             2.0*(real.x*real.z - real.w*real.y), 0.0),
+        vec4(2.0*(real.x*real.y - real.w*real.z),
+             1.0 - 2.0*(real.x*real.x + real.z*real.z),
+             2.0*(real.y*real.z + real.w*real.x), 0.0),
+        vec4(2.0*(real.x*real.z + real.w*real.y),
+             2.0*(real.y*real.z - real.w*real.x),
+             1.0 - 2.0*(real.x*real.x + real.y*real.y), 0.0),
+        vec4(2.0*(real.w*dual.xyz - dual.w*real.xyz + cross(real.xyz, dual.xyz)), 1.0));
+    #endif
+    #endif
+
     /* Transformed vertex position */
-    highp vec4 transformedPosition4 = transformationMatrix*position;
+    highp vec4 transformedPosition4 = transformationMatrix*
+        #ifdef INSTANCED_TRANSFORMATION
+        instancedTransformationMatrix*
+        #endif
+        #ifdef SKINNING
+        skinMatrix*
+        #endif
+        position;
+
+    /* Transform the position */
+    gl_Position = projectionMatrix*transformedPosition4;
+
+    /* Only the position is needed for a depth pre-pass */
+    #ifndef DEPTH_ONLY
     highp vec3 transformedPosition = transformedPosition4.xyz/transformedPosition4.w;
 
     /* Transformed normal vector */
-    transformedNormal = normalMatrix*normal;
+    transformedNormal = normalMatrix*
+        #ifdef INSTANCED_TRANSFORMATION
+        instancedNormalMatrix*
+        #endif
+        #ifdef SKINNING
+        /* Assumes the joints don't contain non-uniform scaling */
+        mat3(skinMatrix)*
+        #endif
+        normal;
 
+    #ifndef CLUSTERED_LIGHTS
     /* Direction to the light */
     for(int i = 0; i < LIGHT_COUNT; ++i)
-        lightDirections[i] = normalize(lightPositions[i] - transformedPosition);
+        lightDirections[i] = normalize(vec3(lightPositions[i]) - transformedPosition);
+    #endif
 
     /* Direction to the camera */
     cameraDirection = -transformedPosition;
 
-    /* Transform the position */
-    gl_Position = projectionMatrix*transformedPosition4;
+    #ifdef CLUSTERED_LIGHTS
+    /* Lights are evaluated per fragment, the cluster is found from the
+       clip-space position and view-space depth. Near and far plane distance
+       of a perspective projection is extracted from the matrix. */
+    viewPosition = transformedPosition;
+    clipPosition = gl_Position;
+    highp float near = projectionMatrix[3][2]/(projectionMatrix[2][2] - 1.0);
+    highp float far = projectionMatrix[3][2]/(projectionMatrix[2][2] + 1.0);
+    clusterDepth = vec2(near, log(far/near));
+    #endif
 
     #ifdef TEXTURED
     /* Texture coordinates, if needed */
     interpolatedTextureCoords = textureCoords;
     #endif
+
+    #ifdef VERTEX_COLOR
+    /* Vertex colors, if enabled */
+    interpolatedVertexColor = vertexColor;
+    #endif
+    #endif
 }
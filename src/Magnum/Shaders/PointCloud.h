@@ -0,0 +1,162 @@
+#ifndef Magnum_Shaders_PointCloud_h
+#define Magnum_Shaders_PointCloud_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::PointCloud
+ */
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Point cloud shader
+
+Draws chunks of a @ref PointCloudOctree as points with per-vertex colors. The
+vertex positions are expected to be normalized integers relative to the
+chunk bounds, set for each chunk with @ref setChunk(). See
+@ref Shaders-PointCloudOctree-selection for an example of setting up the mesh
+and drawing the selected chunks.
+
+On desktop OpenGL, @ref GL::Renderer::Feature::ProgramPointSize has to be
+enabled for @ref setPointSize() to have any effect. For large point clouds,
+@ref PointSplatting is usually considerably faster.
+
+@requires_gles30 Not available in OpenGL ES 2.0.
+@requires_webgl20 Not available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT PointCloud: public GL::AbstractShaderProgram {
+    public:
+        /**
+         * @brief Vertex position
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Vector3 "Vector3".
+         * Expected to be three normalized @ref Magnum::UnsignedShort "UnsignedShort"
+         * components, see @ref PointCloudVertex::position.
+         */
+        typedef Generic3D::Position Position;
+
+        /**
+         * @brief Vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color4 "Color4".
+         * Expected to be four normalized @ref Magnum::UnsignedByte "UnsignedByte"
+         * components, see @ref PointCloudVertex::color.
+         */
+        typedef Generic3D::Color4 Color;
+
+        /** @brief Constructor */
+        explicit PointCloud();
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit PointCloud(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        PointCloud(const PointCloud&) = delete;
+
+        /** @brief Move constructor */
+        PointCloud(PointCloud&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        PointCloud& operator=(const PointCloud&) = delete;
+
+        /** @brief Move assignment */
+        PointCloud& operator=(PointCloud&&) noexcept = default;
+
+        /**
+         * @brief Set transformation and projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * World to clip space transformation. Initial value is an identity
+         * matrix.
+         */
+        PointCloud& setTransformationProjectionMatrix(const Matrix4& matrix) {
+            setUniform(_transformationProjectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Set chunk bounds
+         * @return Reference to self (for method chaining)
+         *
+         * Normalized vertex positions are scaled by @p size and offset by
+         * @p offset. Initial value is a zero offset and unit size.
+         * @see @ref setChunk()
+         */
+        PointCloud& setChunkBounds(const Vector3& offset, const Vector3& size) {
+            setUniform(_chunkOffsetUniform, offset);
+            setUniform(_chunkSizeUniform, size);
+            return *this;
+        }
+
+        /**
+         * @brief Set chunk
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref setChunkBounds() with the
+         * @ref PointCloudChunk::bounds.
+         */
+        PointCloud& setChunk(const PointCloudChunk& chunk);
+
+        /**
+         * @brief Set point size
+         * @return Reference to self (for method chaining)
+         *
+         * Point size in pixels. Initial value is @cpp 1.0f @ce.
+         */
+        PointCloud& setPointSize(Float size) {
+            setUniform(_pointSizeUniform, size);
+            return *this;
+        }
+
+    private:
+        Int _transformationProjectionMatrixUniform{0},
+            _chunkOffsetUniform{1},
+            _chunkSizeUniform{2},
+            _pointSizeUniform{3};
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
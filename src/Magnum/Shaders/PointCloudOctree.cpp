@@ -0,0 +1,202 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PointCloudOctree.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <queue>
+#include <utility>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Algorithms/MortonTree.h"
+
+namespace Magnum { namespace Shaders {
+
+static_assert(sizeof(PointCloudVertex) == 12, "improper size of PointCloudVertex");
+
+PointCloudOctree::PointCloudOctree(const Containers::StridedArrayView<const Vector3>& positions, const Containers::StridedArrayView<const Color4ub>& colors, const UnsignedInt chunkSize, const UnsignedInt threadCount): _chunkSize{chunkSize} {
+    CORRADE_ASSERT(colors.empty() || colors.size() == positions.size(),
+        "Shaders::PointCloudOctree: expected either no colors or" << positions.size() << "but got" << colors.size(), );
+    CORRADE_ASSERT(chunkSize,
+        "Shaders::PointCloudOctree: chunk size can't be zero", );
+
+    const Math::Algorithms::MortonOctree<Float> tree{positions, threadCount};
+    _bounds = tree.bounds();
+    if(!tree.size()) return;
+
+    /* Same cell size as used by the Morton tree for quantization */
+    constexpr UnsignedInt Bits = Math::Algorithms::MortonOctree<Float>::Bits;
+    const Vector3 cellSize = _bounds.size()/Float((1u << Bits) - 1);
+
+    std::vector<std::uint64_t> codes(tree.codes().begin(), tree.codes().end());
+    _indices.assign(tree.indices().begin(), tree.indices().end());
+
+    /* Build the chunks in breadth-first order, so children of each chunk are
+       consecutive. Each node moves a subsample of its points to the front of
+       its range and the children then partition the rest, which stays in the
+       Morton order. */
+    struct Node {
+        UnsignedInt level;
+        Vector3ui cell;
+        std::uint64_t code;
+        std::size_t begin, end;
+    };
+    std::vector<Node> nodes{Node{0, {}, 0, 0, codes.size()}};
+    std::vector<std::uint64_t> codeScratch;
+    std::vector<UnsignedInt> indexScratch;
+    for(std::size_t i = 0; i != nodes.size(); ++i) {
+        const Node node = nodes[i];
+        const std::size_t count = node.end - node.begin;
+
+        PointCloudChunk chunk;
+        const UnsignedInt side = 1u << (Bits - node.level);
+        chunk.bounds = {_bounds.min() + Vector3{node.cell}*cellSize,
+                        _bounds.min() + Vector3{node.cell + Vector3ui{side}}*cellSize};
+        chunk.vertexOffset = node.begin;
+        chunk.level = node.level;
+        chunk.childOffset = nodes.size();
+        chunk.childCount = 0;
+
+        if(count <= _chunkSize || node.level == Bits) {
+            chunk.vertexCount = count;
+            _chunks.push_back(chunk);
+            continue;
+        }
+
+        /* Take every (count/chunkSize)-th point. The write position is never
+           after the read position, so it can be done in place. */
+        codeScratch.clear();
+        indexScratch.clear();
+        std::size_t selected = 0;
+        for(std::size_t j = 0; j != count; ++j) {
+            const std::size_t from = node.begin + j;
+            if(selected < _chunkSize && j == selected*count/_chunkSize) {
+                codes[node.begin + selected] = codes[from];
+                _indices[node.begin + selected] = _indices[from];
+                ++selected;
+            } else {
+                codeScratch.push_back(codes[from]);
+                indexScratch.push_back(_indices[from]);
+            }
+        }
+        std::copy(codeScratch.begin(), codeScratch.end(), codes.begin() + node.begin + _chunkSize);
+        std::copy(indexScratch.begin(), indexScratch.end(), _indices.begin() + node.begin + _chunkSize);
+        chunk.vertexCount = _chunkSize;
+
+        /* Partition the rest into children by the next digit of the code */
+        const UnsignedInt level = node.level + 1;
+        const UnsignedInt shift = 3*(Bits - level);
+        const UnsignedInt half = 1u << (Bits - level);
+        std::size_t begin = node.begin + _chunkSize;
+        for(UnsignedInt c = 0; c != 8; ++c) {
+            const std::uint64_t code = node.code + (std::uint64_t(c) << shift);
+            const std::size_t end = c == 7 ? node.end :
+                std::lower_bound(codes.begin() + begin, codes.begin() + node.end, code + (std::uint64_t(1) << shift)) - codes.begin();
+            if(begin == end) continue;
+
+            Vector3ui cell = node.cell;
+            for(std::size_t j = 0; j != 3; ++j)
+                if(c & (1 << j)) cell[j] += half;
+            nodes.push_back(Node{level, cell, code, begin, end});
+            ++chunk.childCount;
+            begin = end;
+        }
+
+        _chunks.push_back(chunk);
+    }
+
+    /* Quantize the positions relative to the chunk bounds */
+    _vertices.resize(_indices.size());
+    Magnum::Implementation::parallelFor(threadCount, _chunks.size(), [this, &positions, &colors](const std::size_t i) {
+        const PointCloudChunk& chunk = _chunks[i];
+        const Vector3 size = chunk.bounds.size();
+        Vector3 scale;
+        for(std::size_t j = 0; j != 3; ++j)
+            scale[j] = size[j] > 0.0f ? 65535.0f/size[j] : 0.0f;
+
+        for(std::size_t j = chunk.vertexOffset, end = chunk.vertexOffset + chunk.vertexCount; j != end; ++j) {
+            const UnsignedInt index = _indices[j];
+            PointCloudVertex& vertex = _vertices[j];
+            vertex.position = Math::Vector3<UnsignedShort>{Math::round(Math::clamp((positions[index] - chunk.bounds.min())*scale, 0.0f, 65535.0f))};
+            vertex.padding = 0;
+            vertex.color = colors.empty() ? Color4ub{255} : colors[index];
+        }
+    });
+}
+
+PointCloudOctree& PointCloudOctree::setPointBudget(const std::size_t budget) {
+    _pointBudget = budget;
+    return *this;
+}
+
+PointCloudOctree& PointCloudOctree::setDetailThreshold(const Float threshold) {
+    CORRADE_ASSERT(threshold > 0.0f,
+        "Shaders::PointCloudOctree::setDetailThreshold(): expected positive threshold, got" << threshold, *this);
+    _detailThreshold = threshold;
+    return *this;
+}
+
+PointCloudOctree& PointCloudOctree::select(const Vector3& cameraPosition, const Frustum& frustum) {
+    _selectedChunks.clear();
+    _selectedPointCount = 0;
+    if(_chunks.empty()) return *this;
+
+    auto projectedSize = [&cameraPosition](const PointCloudChunk& chunk) {
+        const Float distance = (cameraPosition - Math::clamp(cameraPosition, chunk.bounds.min(), chunk.bounds.max())).length();
+        return distance > 0.0f ? chunk.bounds.size().max()/distance : Constants::inf();
+    };
+
+    /* Chunks with the largest projected size first */
+    std::priority_queue<std::pair<Float, UnsignedInt>> queue;
+    if(Math::Intersection::rangeFrustum(_chunks[0].bounds, frustum))
+        queue.push({projectedSize(_chunks[0]), 0});
+
+    while(!queue.empty()) {
+        const UnsignedInt id = queue.top().second;
+        queue.pop();
+
+        const PointCloudChunk& chunk = _chunks[id];
+        if(!_selectedChunks.empty() && _selectedPointCount + chunk.vertexCount > _pointBudget)
+            break;
+
+        _selectedChunks.push_back(id);
+        _selectedPointCount += chunk.vertexCount;
+
+        for(UnsignedInt i = chunk.childOffset, end = chunk.childOffset + chunk.childCount; i != end; ++i) {
+            const PointCloudChunk& child = _chunks[i];
+            if(!Math::Intersection::rangeFrustum(child.bounds, frustum)) continue;
+
+            const Float size = projectedSize(child);
+            if(size >= _detailThreshold) queue.push({size, i});
+        }
+    }
+
+    return *this;
+}
+
+}}
@@ -0,0 +1,292 @@
+#ifndef Magnum_Shaders_PointCloudOctree_h
+#define Magnum_Shaders_PointCloudOctree_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::PointCloudOctree, struct @ref Magnum::Shaders::PointCloudVertex, @ref Magnum::Shaders::PointCloudChunk
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Point cloud vertex
+
+Quantized vertex of a @ref PointCloudOctree chunk, laid out to be directly
+uploaded to a buffer and used with the @ref PointCloud shader attributes or
+read by @ref PointSplatting. The whole vertex is 12 bytes, compared to 16
+bytes of a @ref Magnum::Vector3 "Vector3" position and a
+@ref Magnum::Color4ub "Color4ub" color.
+*/
+struct PointCloudVertex {
+    /**
+     * @brief Position
+     *
+     * Normalized to the @ref PointCloudChunk::bounds of the chunk the vertex
+     * belongs to. Corresponds to @ref PointCloud::Position.
+     */
+    Math::Vector3<UnsignedShort> position;
+
+    /** @brief Padding, unused */
+    UnsignedShort padding;
+
+    /**
+     * @brief Color
+     *
+     * Corresponds to @ref PointCloud::Color.
+     */
+    Color4ub color;
+};
+
+/**
+@brief Point cloud chunk
+
+One node of a @ref PointCloudOctree.
+*/
+struct PointCloudChunk {
+    /**
+     * @brief Bounds
+     *
+     * Bounds of the octree cell. Vertex positions of the chunk are
+     * quantized to this range.
+     */
+    Range3D bounds;
+
+    /** @brief Offset of the first chunk vertex in @ref PointCloudOctree::vertices() */
+    UnsignedInt vertexOffset;
+
+    /** @brief Chunk vertex count */
+    UnsignedInt vertexCount;
+
+    /** @brief Octree level, @cpp 0 @ce being the root */
+    UnsignedInt level;
+
+    /** @brief Index of the first child chunk in @ref PointCloudOctree::chunks() */
+    UnsignedInt childOffset;
+
+    /**
+     * @brief Child chunk count
+     *
+     * The children are consecutive in @ref PointCloudOctree::chunks(). If
+     * zero, the chunk is a leaf.
+     */
+    UnsignedInt childCount;
+};
+
+/**
+@brief Point cloud level of detail octree
+
+Splits a point cloud into chunks with quantized positions for drawing with
+the @ref PointCloud shader or rasterization with @ref PointSplatting, and
+selects chunks to draw each frame based on the distance to the camera. The
+points are sorted along a Morton curve using @ref Math::Algorithms::MortonOctree
+and each octree node takes a subsample of at most @ref chunkSize() points of
+its cell, evenly spread along the curve, leaving the rest for its children.
+Every chunk is thus a coarser representation of its whole cell and its
+children progressively add detail, similarly to the layered point clouds
+used in Potree. Each chunk is a contiguous range in @ref vertices(), so it can
+be drawn with a single draw call, and with positions quantized to 16 bits
+relative to the chunk bounds a vertex takes only 12 bytes.
+
+@section Shaders-PointCloudOctree-selection Chunk selection
+
+The @ref select() function traverses the octree from the root, prioritizing
+chunks with the largest projected size, approximated as the largest bounds
+dimension divided by the distance from the camera. Chunks outside of the view
+frustum are culled and children are added only if they have projected size of
+at least @ref detailThreshold(). The selection stops once the next chunk
+would make the total point count exceed @ref pointBudget(), so the draw cost
+is bounded regardless of the cloud size.
+
+@code{.cpp}
+Shaders::PointCloudOctree octree{positions, colors, 16384, std::thread::hardware_concurrency()};
+GL::Buffer vertices;
+vertices.setData(octree.vertices());
+
+GL::Mesh mesh{MeshPrimitive::Points};
+mesh.addVertexBuffer(vertices, 0,
+    Shaders::PointCloud::Position{
+        Shaders::PointCloud::Position::DataType::UnsignedShort,
+        Shaders::PointCloud::Position::DataOption::Normalized}, 2,
+    Shaders::PointCloud::Color{
+        Shaders::PointCloud::Color::DataType::UnsignedByte,
+        Shaders::PointCloud::Color::DataOption::Normalized});
+
+// each frame
+octree.select(cameraPosition, Frustum::fromMatrix(viewProjection));
+shader.setTransformationProjectionMatrix(viewProjection);
+for(UnsignedInt id: octree.selectedChunks()) {
+    const Shaders::PointCloudChunk& chunk = octree.chunks()[id];
+    mesh.setBaseVertex(chunk.vertexOffset)
+        .setCount(chunk.vertexCount);
+    shader.setChunk(chunk);
+    mesh.draw(shader);
+}
+@endcode
+
+For large clouds, @ref PointSplatting is usually considerably faster than
+drawing the chunks as points.
+*/
+class MAGNUM_SHADERS_EXPORT PointCloudOctree {
+    public:
+        /**
+         * @brief Constructor
+         * @param positions     Point positions
+         * @param colors        Point colors
+         * @param chunkSize     Max point count in a chunk
+         * @param threadCount   Count of threads to distribute the build to,
+         *      including the calling one. Values @cpp 0 @ce and @cpp 1 @ce
+         *      mean the build is done on the calling thread only.
+         *
+         * Expects that @p colors is either empty or has the same size as
+         * @p positions and that @p chunkSize is not zero. If @p colors is
+         * empty, all points are white. Chunks in the finest octree level
+         * can contain more than @p chunkSize points if there's more
+         * coincident points than that.
+         */
+        explicit PointCloudOctree(const Containers::StridedArrayView<const Vector3>& positions, const Containers::StridedArrayView<const Color4ub>& colors, UnsignedInt chunkSize = 16384, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Bounds of all points
+         *
+         * Both minimum and maximum are inclusive.
+         */
+        Range3D bounds() const { return _bounds; }
+
+        /** @brief Max point count in a chunk */
+        UnsignedInt chunkSize() const { return _chunkSize; }
+
+        /**
+         * @brief Chunks
+         *
+         * In breadth-first order, the first chunk is the root. Empty if the
+         * cloud has no points.
+         */
+        Containers::ArrayView<const PointCloudChunk> chunks() const {
+            return {_chunks.data(), _chunks.size()};
+        }
+
+        /**
+         * @brief Vertices
+         *
+         * Vertices of all chunks, to be uploaded to a buffer.
+         * @see @ref PointCloudChunk::vertexOffset,
+         *      @ref PointCloudChunk::vertexCount
+         */
+        Containers::ArrayView<const PointCloudVertex> vertices() const {
+            return {_vertices.data(), _vertices.size()};
+        }
+
+        /**
+         * @brief Original point indices
+         *
+         * Index of the original point for each item of @ref vertices().
+         */
+        Containers::ArrayView<const UnsignedInt> indices() const {
+            return {_indices.data(), _indices.size()};
+        }
+
+        /** @brief Point budget */
+        std::size_t pointBudget() const { return _pointBudget; }
+
+        /**
+         * @brief Set point budget
+         * @return Reference to self (for method chaining)
+         *
+         * Max total point count of chunks selected by @ref select(). The root
+         * chunk is selected always if visible. Default is
+         * @cpp 10000000 @ce.
+         */
+        PointCloudOctree& setPointBudget(std::size_t budget);
+
+        /** @brief Detail threshold */
+        Float detailThreshold() const { return _detailThreshold; }
+
+        /**
+         * @brief Set detail threshold
+         * @return Reference to self (for method chaining)
+         *
+         * Min projected size of a chunk for it to be selected, see
+         * @ref Shaders-PointCloudOctree-selection for details. The lower the
+         * value, the more detail is selected. A good starting point is the
+         * angular size of a pixel times the square root of
+         * @ref chunkSize(). Default is @cpp 0.1f @ce. Expects that the value
+         * is positive.
+         */
+        PointCloudOctree& setDetailThreshold(Float threshold);
+
+        /**
+         * @brief Select chunks to draw
+         * @param cameraPosition    Camera position in world space
+         * @param frustum           View frustum in world space
+         * @return Reference to self (for method chaining)
+         *
+         * Fills @ref selectedChunks().
+         */
+        PointCloudOctree& select(const Vector3& cameraPosition, const Frustum& frustum);
+
+        /**
+         * @brief Selected chunks
+         *
+         * Indices into @ref chunks() selected in last @ref select() call, in
+         * the order they were selected. A parent chunk is always before its
+         * children.
+         */
+        Containers::ArrayView<const UnsignedInt> selectedChunks() const {
+            return {_selectedChunks.data(), _selectedChunks.size()};
+        }
+
+        /**
+         * @brief Selected point count
+         *
+         * Total point count of chunks selected in last @ref select() call.
+         */
+        std::size_t selectedPointCount() const { return _selectedPointCount; }
+
+    private:
+        Range3D _bounds;
+        UnsignedInt _chunkSize;
+        std::size_t _pointBudget{10000000};
+        Float _detailThreshold{0.1f};
+        std::vector<PointCloudChunk> _chunks;
+        std::vector<PointCloudVertex> _vertices;
+        std::vector<UnsignedInt> _indices;
+        std::vector<UnsignedInt> _selectedChunks;
+        std::size_t _selectedPointCount{};
+};
+
+}}
+
+#endif
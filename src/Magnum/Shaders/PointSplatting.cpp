@@ -0,0 +1,229 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PointSplatting.h"
+
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/PointCloudOctree.h"
+
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    enum: UnsignedInt {
+        VertexBufferBinding = 0,
+        DepthBufferBinding = 1,
+        AccumulationBufferBinding = 2
+    };
+
+    enum: Int {
+        ClearPass = 0,
+        DepthPass = 1,
+        ColorPass = 2
+    };
+
+    constexpr UnsignedInt WorkgroupSize = 128;
+
+    Utility::Resource shaderResources() {
+        #ifdef MAGNUM_BUILD_STATIC
+        /* Import resources on static build, if not already */
+        if(!Utility::Resource::hasGroup("MagnumShaders"))
+            importShaderResources();
+        #endif
+        return Utility::Resource{"MagnumShaders"};
+    }
+
+    class SplattingShader: public GL::AbstractShaderProgram {
+        public:
+            explicit SplattingShader() {
+                Utility::Resource rs = shaderResources();
+
+                GL::Shader comp = Implementation::createCompatibilityShader(rs, GL::Version::GL430, GL::Shader::Type::Compute);
+                comp.addSource(rs.get("PointSplatting.comp"));
+
+                /* Load the program from the binary cache, if there's one,
+                   otherwise compile and link it from the sources */
+                if(!loadCachedBinary({comp})) {
+                    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({comp}));
+                    attachShader(comp);
+                    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+                    saveCachedBinary({comp});
+                }
+            }
+
+            void setTransformationProjectionMatrix(const Matrix4& matrix) {
+                setUniform(0, matrix);
+            }
+
+            void setChunk(const PointCloudChunk& chunk) {
+                setUniform(1, chunk.bounds.min());
+                setUniform(2, chunk.bounds.size());
+                setUniform(3, chunk.vertexOffset);
+                setUniform(4, chunk.vertexCount);
+            }
+
+            void setSize(const Vector2i& size) {
+                setUniform(5, size);
+            }
+
+            void setDepthTolerance(Float tolerance) {
+                setUniform(6, tolerance);
+            }
+
+            void setPass(Int pass) {
+                setUniform(7, pass);
+            }
+
+            void dispatch(UnsignedInt count) {
+                dispatchCompute({(count + WorkgroupSize - 1)/WorkgroupSize, 1, 1});
+            }
+    };
+
+    class ResolveShader: public GL::AbstractShaderProgram {
+        public:
+            explicit ResolveShader() {
+                Utility::Resource rs = shaderResources();
+
+                GL::Shader vert = Implementation::createCompatibilityShader(rs, GL::Version::GL430, GL::Shader::Type::Vertex);
+                GL::Shader frag = Implementation::createCompatibilityShader(rs, GL::Version::GL430, GL::Shader::Type::Fragment);
+                vert.addSource(rs.get("FullScreenTriangle.glsl"))
+                    .addSource(rs.get("PointSplattingResolve.vert"));
+                frag.addSource(rs.get("PointSplattingResolve.frag"));
+
+                /* Load the program from the binary cache, if there's one,
+                   otherwise compile and link it from the sources */
+                if(!loadCachedBinary({vert, frag})) {
+                    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+                    attachShaders({vert, frag});
+                    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+                    saveCachedBinary({vert, frag});
+                }
+            }
+
+            void setSize(const Vector2i& size) {
+                setUniform(0, size);
+            }
+    };
+}
+
+struct PointSplatting::State {
+    explicit State(): depth{GL::Buffer::TargetHint::ShaderStorage}, accumulation{GL::Buffer::TargetHint::ShaderStorage} {
+        triangle.setCount(3);
+    }
+
+    SplattingShader splatting;
+    ResolveShader resolve;
+    GL::Buffer depth, accumulation;
+    GL::Mesh triangle;
+    Vector2i size;
+    Float depthTolerance{0.01f};
+};
+
+PointSplatting::PointSplatting(const Vector2i& size) {
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL430);
+
+    _state.reset(new State);
+    setSize(size);
+    setDepthTolerance(_state->depthTolerance);
+    setTransformationProjectionMatrix({});
+}
+
+PointSplatting::PointSplatting(NoCreateT) noexcept {}
+
+PointSplatting::PointSplatting(PointSplatting&&) noexcept = default;
+
+PointSplatting::~PointSplatting() = default;
+
+PointSplatting& PointSplatting::operator=(PointSplatting&&) noexcept = default;
+
+Vector2i PointSplatting::size() const { return _state->size; }
+
+PointSplatting& PointSplatting::setSize(const Vector2i& size) {
+    CORRADE_ASSERT((size > Vector2i{}).all(),
+        "Shaders::PointSplatting::setSize(): expected positive size, got" << size, *this);
+
+    State& state = *_state;
+    state.size = size;
+
+    /* One depth value and four color accumulators per pixel. The contents
+       get cleared at the start of each draw. */
+    const std::size_t pixelCount = std::size_t(size.product());
+    state.depth.setData({nullptr, pixelCount*sizeof(UnsignedInt)}, GL::BufferUsage::DynamicCopy);
+    state.accumulation.setData({nullptr, pixelCount*4*sizeof(UnsignedInt)}, GL::BufferUsage::DynamicCopy);
+    state.splatting.setSize(size);
+    state.resolve.setSize(size);
+    return *this;
+}
+
+Float PointSplatting::depthTolerance() const { return _state->depthTolerance; }
+
+PointSplatting& PointSplatting::setDepthTolerance(const Float tolerance) {
+    _state->depthTolerance = tolerance;
+    _state->splatting.setDepthTolerance(tolerance);
+    return *this;
+}
+
+PointSplatting& PointSplatting::setTransformationProjectionMatrix(const Matrix4& matrix) {
+    _state->splatting.setTransformationProjectionMatrix(matrix);
+    return *this;
+}
+
+PointSplatting& PointSplatting::draw(GL::Buffer& vertices, const PointCloudOctree& octree) {
+    State& state = *_state;
+    vertices.bind(GL::Buffer::Target::ShaderStorage, VertexBufferBinding);
+    state.depth.bind(GL::Buffer::Target::ShaderStorage, DepthBufferBinding);
+    state.accumulation.bind(GL::Buffer::Target::ShaderStorage, AccumulationBufferBinding);
+
+    /* Clear the depth to the far plane and the accumulators to zero */
+    state.splatting.setPass(ClearPass);
+    state.splatting.dispatch(state.size.product());
+    GL::Renderer::setMemoryBarrier(GL::Renderer::MemoryBarrier::ShaderStorage);
+
+    /* Nearest depth of all chunks has to be known before accumulating any
+       color */
+    for(const Int pass: {DepthPass, ColorPass}) {
+        state.splatting.setPass(pass);
+        for(const UnsignedInt id: octree.selectedChunks()) {
+            const PointCloudChunk& chunk = octree.chunks()[id];
+            if(!chunk.vertexCount) continue;
+            state.splatting.setChunk(chunk);
+            state.splatting.dispatch(chunk.vertexCount);
+        }
+        GL::Renderer::setMemoryBarrier(GL::Renderer::MemoryBarrier::ShaderStorage);
+    }
+
+    state.triangle.draw(state.resolve);
+    return *this;
+}
+
+}}
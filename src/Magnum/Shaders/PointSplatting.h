@@ -0,0 +1,181 @@
+#ifndef Magnum_Shaders_PointSplatting_h
+#define Magnum_Shaders_PointSplatting_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::PointSplatting
+ */
+
+#include <memory>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/GL/GL.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Compute-based point cloud rasterizer
+
+Rasterizes chunks of a @ref PointCloudOctree with compute shaders instead of
+the fixed-function point pipeline, which is limited by vertex throughput and
+the cost of tiny primitives. Each point is projected to a pixel by a single
+compute shader invocation and written to shader storage buffers using
+atomic operations, skipping the primitive assembly and rasterization
+entirely.
+
+The rasterization is done in two passes over the points. In the first pass,
+the nearest depth is found for each pixel using @glsl atomicMin() @ce. In the
+second pass, colors of all points that are within @ref depthTolerance() of
+the nearest depth are accumulated with @glsl atomicAdd() @ce, which averages
+overlapping points of the nearest surface instead of picking an arbitrary
+one, considerably reducing aliasing. The result is then resolved into the
+currently bound framebuffer using a full-screen triangle, writing both the
+averaged color and the depth, so the cloud can be combined with other
+geometry drawn with depth test enabled. Pixels with no points are discarded.
+
+@section Shaders-PointSplatting-usage Example usage
+
+@code{.cpp}
+Shaders::PointCloudOctree octree{positions, colors, 16384, std::thread::hardware_concurrency()};
+GL::Buffer vertices;
+vertices.setData(octree.vertices());
+
+Shaders::PointSplatting splatting{GL::defaultFramebuffer.viewport().size()};
+
+// each frame
+octree.select(cameraPosition, Frustum::fromMatrix(viewProjection));
+GL::Renderer::enable(GL::Renderer::Feature::DepthTest);
+splatting.setTransformationProjectionMatrix(viewProjection)
+    .draw(vertices, octree);
+@endcode
+
+The storage buffers have the size given by @ref size(), which is expected to
+match the viewport of the framebuffer the result is resolved to. Call
+@ref setSize() when the viewport gets resized.
+
+@requires_gl43 Extension @gl_extension{ARB,compute_shader} and
+    @gl_extension{ARB,shader_storage_buffer_object}
+@requires_gl Compute-based rasterization is not available in OpenGL ES or
+    WebGL.
+*/
+class MAGNUM_SHADERS_EXPORT PointSplatting {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Size of the rasterized image
+         */
+        explicit PointSplatting(const Vector2i& size);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL objects
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit PointSplatting(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        PointSplatting(const PointSplatting&) = delete;
+
+        /** @brief Move constructor */
+        PointSplatting(PointSplatting&&) noexcept;
+
+        ~PointSplatting();
+
+        /** @brief Copying is not allowed */
+        PointSplatting& operator=(const PointSplatting&) = delete;
+
+        /** @brief Move assignment */
+        PointSplatting& operator=(PointSplatting&&) noexcept;
+
+        /** @brief Size of the rasterized image */
+        Vector2i size() const;
+
+        /**
+         * @brief Set size of the rasterized image
+         * @return Reference to self (for method chaining)
+         *
+         * Reallocates the storage buffers. Expects that the size is positive.
+         */
+        PointSplatting& setSize(const Vector2i& size);
+
+        /** @brief Depth tolerance */
+        Float depthTolerance() const;
+
+        /**
+         * @brief Set depth tolerance
+         * @return Reference to self (for method chaining)
+         *
+         * Points are blended into a pixel if their window-space depth
+         * @f$ z @f$ satisfies @f$ z \le z_n + t (1 - z_n) @f$, where
+         * @f$ z_n @f$ is the nearest depth in the pixel. For a perspective
+         * projection with far plane much farther than near plane this
+         * corresponds to a distance tolerance of @f$ t @f$ relative to the
+         * distance of the nearest point. Zero means only the nearest points
+         * are used. Default is @cpp 0.01f @ce.
+         */
+        PointSplatting& setDepthTolerance(Float tolerance);
+
+        /**
+         * @brief Set transformation and projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * World to clip space transformation. Initial value is an identity
+         * matrix.
+         */
+        PointSplatting& setTransformationProjectionMatrix(const Matrix4& matrix);
+
+        /**
+         * @brief Draw selected chunks
+         * @param vertices  Buffer with @ref PointCloudOctree::vertices()
+         * @param octree    Octree with chunks selected using
+         *      @ref PointCloudOctree::select()
+         * @return Reference to self (for method chaining)
+         *
+         * Clears the storage buffers, rasterizes all
+         * @ref PointCloudOctree::selectedChunks() and resolves the result
+         * into the currently bound framebuffer.
+         */
+        PointSplatting& draw(GL::Buffer& vertices, const PointCloudOctree& octree);
+
+    private:
+        struct State;
+        std::unique_ptr<State> _state;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES build
+#endif
+
+#endif
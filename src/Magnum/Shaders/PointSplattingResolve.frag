@@ -0,0 +1,49 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+layout(location = 0) uniform ivec2 size;
+
+layout(std430, binding = 1) readonly buffer Depth {
+    uint depth[];
+};
+
+layout(std430, binding = 2) readonly buffer Accumulation {
+    uint accumulation[];
+};
+
+out vec4 fragmentColor;
+
+void main() {
+    const ivec2 pixel = min(ivec2(gl_FragCoord.xy), size - ivec2(1));
+    const uint id = uint(pixel.y*size.x + pixel.x);
+
+    const uint count = accumulation[id*4u + 3u];
+    if(count == 0u) discard;
+
+    fragmentColor = vec4(vec3(accumulation[id*4u + 0u],
+                              accumulation[id*4u + 1u],
+                              accumulation[id*4u + 2u])/(255.0*float(count)), 1.0);
+    gl_FragDepth = uintBitsToFloat(depth[id]);
+}
@@ -0,0 +1,109 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShaderCache.h"
+
+#include <map>
+#include <tuple>
+#include <Corrade/Containers/EnumSet.h>
+
+namespace Magnum { namespace Shaders {
+
+struct ShaderCache::State {
+    std::map<UnsignedByte, std::unique_ptr<Flat2D>> flat2D;
+    std::map<UnsignedByte, std::unique_ptr<Flat3D>> flat3D;
+    std::map<std::tuple<UnsignedShort, UnsignedInt, UnsignedInt>, std::unique_ptr<Phong>> phong;
+    std::map<UnsignedByte, std::unique_ptr<MeshVisualizer>> meshVisualizer;
+    std::unique_ptr<VertexColor2D> vertexColor2D;
+    std::unique_ptr<VertexColor3D> vertexColor3D;
+};
+
+ShaderCache::ShaderCache(): _state{new State} {}
+
+ShaderCache::ShaderCache(ShaderCache&&) noexcept = default;
+
+ShaderCache::~ShaderCache() = default;
+
+ShaderCache& ShaderCache::operator=(ShaderCache&&) noexcept = default;
+
+std::size_t ShaderCache::count() const {
+    return _state->flat2D.size() + _state->flat3D.size() +
+        _state->phong.size() + _state->meshVisualizer.size() +
+        (_state->vertexColor2D ? 1 : 0) + (_state->vertexColor3D ? 1 : 0);
+}
+
+Flat2D& ShaderCache::flat2D(const Flat2D::Flags flags) {
+    std::unique_ptr<Flat2D>& shader = _state->flat2D[UnsignedByte(flags)];
+    if(!shader) shader.reset(new Flat2D{flags});
+    return *shader;
+}
+
+Flat3D& ShaderCache::flat3D(const Flat3D::Flags flags) {
+    std::unique_ptr<Flat3D>& shader = _state->flat3D[UnsignedByte(flags)];
+    if(!shader) shader.reset(new Flat3D{flags});
+    return *shader;
+}
+
+Phong& ShaderCache::phong(const Phong::Flags flags, const UnsignedInt lightCount, UnsignedInt jointCount) {
+    /* Joint count doesn't affect anything if skinning is disabled, don't
+       create redundant permutations because of it */
+    #ifndef MAGNUM_TARGET_GLES2
+    if(!(flags & Phong::Flag::Skinning))
+    #endif
+    {
+        jointCount = 0;
+    }
+
+    std::unique_ptr<Phong>& shader = _state->phong[std::make_tuple(UnsignedShort(flags), lightCount, jointCount)];
+    if(!shader) shader.reset(new Phong{flags, lightCount, jointCount});
+    return *shader;
+}
+
+MeshVisualizer& ShaderCache::meshVisualizer(const MeshVisualizer::Flags flags) {
+    std::unique_ptr<MeshVisualizer>& shader = _state->meshVisualizer[UnsignedByte(flags)];
+    if(!shader) shader.reset(new MeshVisualizer{flags});
+    return *shader;
+}
+
+VertexColor2D& ShaderCache::vertexColor2D() {
+    if(!_state->vertexColor2D) _state->vertexColor2D.reset(new VertexColor2D);
+    return *_state->vertexColor2D;
+}
+
+VertexColor3D& ShaderCache::vertexColor3D() {
+    if(!_state->vertexColor3D) _state->vertexColor3D.reset(new VertexColor3D);
+    return *_state->vertexColor3D;
+}
+
+void ShaderCache::clear() {
+    _state->flat2D.clear();
+    _state->flat3D.clear();
+    _state->phong.clear();
+    _state->meshVisualizer.clear();
+    _state->vertexColor2D = nullptr;
+    _state->vertexColor3D = nullptr;
+}
+
+}}
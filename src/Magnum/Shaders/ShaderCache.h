@@ -0,0 +1,149 @@
+#ifndef Magnum_Shaders_ShaderCache_h
+#define Magnum_Shaders_ShaderCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::ShaderCache
+ */
+
+#include <memory>
+
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Shaders/MeshVisualizer.h"
+#include "Magnum/Shaders/Phong.h"
+#include "Magnum/Shaders/VertexColor.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Shader permutation cache
+
+Lazily compiles each requested combination of flags and other construction
+parameters of the builtin shaders just once and then hands out references to
+it. The references stay valid until @ref clear() is called or the cache is
+destroyed.
+
+@snippet MagnumShaders.cpp ShaderCache-usage
+
+Compilation of all permutations that will be needed can be done up-front, for
+example during a loading screen, by simply calling the getters without using
+the result. Together with @ref GL::AbstractShaderProgram::setBinaryCacheDirectory()
+the compiled programs are also reused across application runs.
+
+@section Shaders-ShaderCache-context Relation to the OpenGL context
+
+The cached shaders are OpenGL objects, so there should be one cache for each
+@ref GL::Context and it has to be destroyed while the context is still
+alive. The cache doesn't make any OpenGL calls on its own, so it can be
+constructed before any context exists.
+*/
+class MAGNUM_SHADERS_EXPORT ShaderCache {
+    public:
+        /** @brief Constructor */
+        explicit ShaderCache();
+
+        /** @brief Copying is not allowed */
+        ShaderCache(const ShaderCache&) = delete;
+
+        /** @brief Move constructor */
+        ShaderCache(ShaderCache&&) noexcept;
+
+        ~ShaderCache();
+
+        /** @brief Copying is not allowed */
+        ShaderCache& operator=(const ShaderCache&) = delete;
+
+        /** @brief Move assignment */
+        ShaderCache& operator=(ShaderCache&&) noexcept;
+
+        /** @brief Count of cached shaders */
+        std::size_t count() const;
+
+        /**
+         * @brief 2D flat shader
+         *
+         * Compiles the shader on first use with given @p flags.
+         * @see @ref Flat::Flat(Flags)
+         */
+        Flat2D& flat2D(Flat2D::Flags flags = {});
+
+        /**
+         * @brief 3D flat shader
+         *
+         * Compiles the shader on first use with given @p flags.
+         * @see @ref Flat::Flat(Flags)
+         */
+        Flat3D& flat3D(Flat3D::Flags flags = {});
+
+        /**
+         * @brief Phong shader
+         *
+         * Compiles the shader on first use with given combination of
+         * @p flags, @p lightCount and @p jointCount. The @p jointCount is
+         * ignored if @ref Phong::Flag::Skinning is not set.
+         * @see @ref Phong::Phong(Phong::Flags, UnsignedInt, UnsignedInt)
+         */
+        Phong& phong(Phong::Flags flags = {}, UnsignedInt lightCount = 1, UnsignedInt jointCount = 0);
+
+        /**
+         * @brief Mesh visualizer shader
+         *
+         * Compiles the shader on first use with given @p flags.
+         * @see @ref MeshVisualizer::MeshVisualizer(Flags)
+         */
+        MeshVisualizer& meshVisualizer(MeshVisualizer::Flags flags = {});
+
+        /**
+         * @brief 2D vertex color shader
+         *
+         * Compiles the shader on first use.
+         */
+        VertexColor2D& vertexColor2D();
+
+        /**
+         * @brief 3D vertex color shader
+         *
+         * Compiles the shader on first use.
+         */
+        VertexColor3D& vertexColor3D();
+
+        /**
+         * @brief Clear the cache
+         *
+         * Destroys all cached shaders, invalidating all references returned
+         * from this instance.
+         */
+        void clear();
+
+    private:
+        struct State;
+        std::unique_ptr<State> _state;
+};
+
+}}
+
+#endif
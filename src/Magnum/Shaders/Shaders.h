@@ -42,15 +42,61 @@ template<UnsignedInt> class AbstractVector;
 typedef AbstractVector<2> AbstractVector2D;
 typedef AbstractVector<3> AbstractVector3D;
 
+#ifndef MAGNUM_TARGET_GLES2
+class DeferredLight;
+#endif
+
 template<UnsignedInt> class Flat;
 typedef Flat<2> Flat2D;
 typedef Flat<3> Flat3D;
 
 /* Generic is used only statically */
 
+#ifndef MAGNUM_TARGET_GLES
+class IndirectCulling;
+class LightCulling;
+#endif
+
 class MeshVisualizer;
+
+#ifndef MAGNUM_TARGET_GLES2
+class Particles;
+class ParticleSimulation;
+class ParticleSystem;
+#endif
+
 class Phong;
 
+#ifndef MAGNUM_TARGET_GLES2
+class PointCloud;
+#endif
+struct PointCloudChunk;
+class PointCloudOctree;
+struct PointCloudVertex;
+#ifndef MAGNUM_TARGET_GLES
+class PointSplatting;
+#endif
+
+class ShaderCache;
+class ShadowCascades;
+class ShadowDepth;
+
+#ifndef MAGNUM_TARGET_GLES2
+class SpriteBatch;
+class Sprites;
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+class Terrain;
+#endif
+struct TerrainPatch;
+class TerrainQuadtree;
+struct TerrainTile;
+
+#ifndef MAGNUM_TARGET_GLES2
+class TransparencyComposite;
+#endif
+
 template<UnsignedInt> class Vector;
 typedef Vector<2> Vector2D;
 typedef Vector<3> Vector3D;
@@ -0,0 +1,146 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShadowCascades.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Intersection.h"
+
+namespace Magnum { namespace Shaders {
+
+ShadowCascades::ShadowCascades(const UnsignedInt cascadeCount) {
+    CORRADE_ASSERT(cascadeCount && cascadeCount <= maxCascadeCount(),
+        "Shaders::ShadowCascades: expected 1 to" << maxCascadeCount() << "cascades but got" << cascadeCount, );
+
+    /* Value-initialized matrices and frustums are identity */
+    _splitDistances = Containers::Array<Float>{Containers::ValueInit, cascadeCount + 1};
+    _shadowMatrices = Containers::Array<Matrix4>{Containers::ValueInit, cascadeCount};
+    _textureMatrices = Containers::Array<Matrix4>{Containers::ValueInit, cascadeCount};
+    _frustums = Containers::Array<Frustum>{Containers::ValueInit, cascadeCount};
+}
+
+ShadowCascades& ShadowCascades::setSplitLambda(const Float lambda) {
+    CORRADE_ASSERT(lambda >= 0.0f && lambda <= 1.0f,
+        "Shaders::ShadowCascades::setSplitLambda(): expected a value in range [0, 1] but got" << lambda, *this);
+    _splitLambda = lambda;
+    return *this;
+}
+
+ShadowCascades& ShadowCascades::setLightDirection(const Vector3& direction) {
+    _lightDirection = direction.normalized();
+    return *this;
+}
+
+ShadowCascades& ShadowCascades::setShadowMapSize(const Int size) {
+    _shadowMapSize = size;
+    return *this;
+}
+
+ShadowCascades& ShadowCascades::setCasterDistance(const Float distance) {
+    _casterDistance = distance;
+    return *this;
+}
+
+void ShadowCascades::splitDistances(const Float near, const Float far, const Float lambda, const Containers::ArrayView<Float> distances) {
+    CORRADE_ASSERT(distances.size() >= 2,
+        "Shaders::ShadowCascades::splitDistances(): expected at least two distances but got" << distances.size(), );
+
+    const std::size_t count = distances.size() - 1;
+    for(std::size_t i = 0; i <= count; ++i) {
+        const Float t = Float(i)/Float(count);
+        distances[i] = Math::lerp(near + (far - near)*t, near*std::pow(far/near, t), lambda);
+    }
+
+    /* Avoid accumulated float errors at the ends */
+    distances[0] = near;
+    distances[count] = far;
+}
+
+ShadowCascades& ShadowCascades::update(const Matrix4& cameraMatrix, const Matrix4& projectionMatrix) {
+    /* Near and far plane distance of a perspective projection */
+    const Float near = projectionMatrix[3][2]/(projectionMatrix[2][2] - 1.0f);
+    const Float far = projectionMatrix[3][2]/(projectionMatrix[2][2] + 1.0f);
+    splitDistances(near, far, _splitLambda, _splitDistances);
+
+    /* Rays through the frustum corners, scaled to unit depth */
+    const Matrix4 inverseProjection = projectionMatrix.inverted();
+    Vector3 rays[4];
+    for(std::size_t i = 0; i != 4; ++i) {
+        const Vector3 corner = inverseProjection.transformPoint({i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, -1.0f});
+        rays[i] = corner/-corner.z();
+    }
+
+    const Matrix4 inverseCamera = cameraMatrix.inverted();
+    const Vector3 up = Math::abs(_lightDirection.y()) > 0.99f ? Vector3::zAxis() : Vector3::yAxis();
+    /* Maps the [-1, 1] clip space to [0, 1] texture space */
+    const Matrix4 bias = Matrix4::translation(Vector3{0.5f})*Matrix4::scaling(Vector3{0.5f});
+
+    for(std::size_t i = 0; i != _shadowMatrices.size(); ++i) {
+        /* World-space corners of the frustum slice */
+        Vector3 corners[8];
+        Vector3 center;
+        for(std::size_t j = 0; j != 8; ++j) {
+            corners[j] = inverseCamera.transformPoint(rays[j & 3]*_splitDistances[i + (j >> 2)]);
+            center += corners[j];
+        }
+        center /= 8.0f;
+
+        /* Bounding sphere radius, rounded up so it doesn't fluctuate due to
+           float precision when the camera rotates */
+        Float radius = 0.0f;
+        for(const Vector3& corner: corners)
+            radius = Math::max(radius, (corner - center).length());
+        radius = Math::ceil(radius*16.0f)/16.0f;
+
+        /* Light view centered on the sphere, looking in the light direction */
+        const Matrix4 lightView = Matrix4::lookAt(center, center + _lightDirection, up).invertedRigid();
+        Matrix4 shadowMatrix = Matrix4::orthographicProjection(Vector2{radius*2.0f}, -radius - _casterDistance, radius)*lightView;
+
+        /* Move the projection only in whole texels */
+        if(_shadowMapSize) {
+            const Vector2 origin = shadowMatrix.transformPoint({}).xy()*Float(_shadowMapSize)*0.5f;
+            const Vector2 offset = (Math::round(origin) - origin)*2.0f/Float(_shadowMapSize);
+            shadowMatrix = Matrix4::translation(Vector3{offset, 0.0f})*shadowMatrix;
+        }
+
+        _shadowMatrices[i] = shadowMatrix;
+        _textureMatrices[i] = bias*shadowMatrix*inverseCamera;
+        _frustums[i] = Frustum::fromMatrix(shadowMatrix);
+    }
+
+    return *this;
+}
+
+UnsignedInt ShadowCascades::cascadeMask(const Vector3& center, const Float radius) const {
+    UnsignedInt mask = 0;
+    for(std::size_t i = 0; i != _frustums.size(); ++i)
+        if(Math::Intersection::sphereFrustum(center, radius, _frustums[i]))
+            mask |= 1 << i;
+    return mask;
+}
+
+}}
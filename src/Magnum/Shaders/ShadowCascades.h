@@ -0,0 +1,229 @@
+#ifndef Magnum_Shaders_ShadowCascades_h
+#define Magnum_Shaders_ShadowCascades_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::ShadowCascades
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Cascaded shadow map splits
+
+Splits the view frustum of a camera into up to @ref maxCascadeCount()
+cascades along its depth and calculates a directional light projection for
+each of them. The matrices are then used for rendering the shadow map with
+@ref ShadowDepth and for the shadow lookup in @ref Phong with
+@ref Phong::Flag::Shadows.
+
+The split distances are a blend between a uniform and a logarithmic
+distribution, controlled with @ref setSplitLambda(). Each cascade is fitted
+to a bounding sphere of its part of the view frustum, so the projection
+doesn't change size when the camera rotates, and if @ref setShadowMapSize()
+is set, it's moved only in whole shadow map texels to avoid shimmering
+edges when the camera moves.
+
+@section Shaders-ShadowCascades-usage Example usage
+
+The @ref update() function takes the camera and projection matrix, for
+example from @ref SceneGraph::Camera::cameraMatrix() and
+@ref SceneGraph::Camera::projectionMatrix(). The projection is expected to
+be perspective.
+
+@code{.cpp}
+Shaders::ShadowCascades cascades{4};
+cascades.setLightDirection({-1.0f, -2.0f, -0.5f})
+    .setShadowMapSize(2048)
+    .update(camera.cameraMatrix(), camera.projectionMatrix());
+
+for(UnsignedInt i = 0; i != cascades.cascadeCount(); ++i) {
+    framebuffer.attachTextureLayer(GL::Framebuffer::BufferAttachment::Depth, shadowMap, 0, i)
+        .clear(GL::FramebufferClear::Depth);
+
+    shadowDepth.setShadowMatrix(cascades.shadowMatrices()[i]);
+    for(Object& object: objects) {
+        if(!(cascades.cascadeMask(object.center(), object.radius()) & (1 << i)))
+            continue;
+        shadowDepth.setTransformationMatrix(object.absoluteTransformationMatrix());
+        object.mesh().draw(shadowDepth);
+    }
+}
+
+phong.bindShadowTexture(shadowMap)
+    .setShadowCascades(cascades);
+@endcode
+
+@see @ref Shaders-Phong-usage-shadows
+*/
+class MAGNUM_SHADERS_EXPORT ShadowCascades {
+    public:
+        /** @brief Max cascade count */
+        constexpr static UnsignedInt maxCascadeCount() { return 4; }
+
+        /**
+         * @brief Constructor
+         * @param cascadeCount  Cascade count
+         *
+         * Expects that @p cascadeCount is between @cpp 1 @ce and
+         * @ref maxCascadeCount(). All matrices are identity until
+         * @ref update() is called.
+         */
+        explicit ShadowCascades(UnsignedInt cascadeCount);
+
+        /** @brief Cascade count */
+        UnsignedInt cascadeCount() const { return _shadowMatrices.size(); }
+
+        /** @brief Split lambda */
+        Float splitLambda() const { return _splitLambda; }
+
+        /**
+         * @brief Set split lambda
+         * @return Reference to self (for method chaining)
+         *
+         * Value of @cpp 0.0f @ce distributes the cascades uniformly between
+         * near and far plane, @cpp 1.0f @ce logarithmically. Default is
+         * @cpp 0.75f @ce. Expects that the value is in range
+         * @f$ [0, 1] @f$.
+         */
+        ShadowCascades& setSplitLambda(Float lambda);
+
+        /** @brief Light direction */
+        Vector3 lightDirection() const { return _lightDirection; }
+
+        /**
+         * @brief Set light direction
+         * @return Reference to self (for method chaining)
+         *
+         * Direction in which the light travels, in world space. Doesn't need
+         * to be normalized. Default is @cpp {0.0f, -1.0f, 0.0f} @ce.
+         */
+        ShadowCascades& setLightDirection(const Vector3& direction);
+
+        /** @brief Shadow map size */
+        Int shadowMapSize() const { return _shadowMapSize; }
+
+        /**
+         * @brief Set shadow map size
+         * @return Reference to self (for method chaining)
+         *
+         * If non-zero, the cascade projections are snapped to shadow map
+         * texels. Default is @cpp 0 @ce, i.e. no snapping.
+         */
+        ShadowCascades& setShadowMapSize(Int size);
+
+        /** @brief Shadow caster distance */
+        Float casterDistance() const { return _casterDistance; }
+
+        /**
+         * @brief Set shadow caster distance
+         * @return Reference to self (for method chaining)
+         *
+         * How far towards the light from the bounding sphere of each cascade
+         * objects still cast shadows into it. Default is @cpp 0.0f @ce.
+         */
+        ShadowCascades& setCasterDistance(Float distance);
+
+        /**
+         * @brief Update the cascades
+         * @param cameraMatrix      Camera matrix, i.e. world to view
+         *      transformation
+         * @param projectionMatrix  Perspective projection matrix of the
+         *      camera
+         * @return Reference to self (for method chaining)
+         */
+        ShadowCascades& update(const Matrix4& cameraMatrix, const Matrix4& projectionMatrix);
+
+        /**
+         * @brief Split distances
+         *
+         * View-space distances of the cascade boundaries, starting with the
+         * near plane and ending with the far plane. Size is
+         * @ref cascadeCount() plus one.
+         */
+        Containers::ArrayView<const Float> splitDistances() const { return _splitDistances; }
+
+        /**
+         * @brief Shadow matrices
+         *
+         * World to light clip space transformation for each cascade, to be
+         * used with @ref ShadowDepth.
+         */
+        Containers::ArrayView<const Matrix4> shadowMatrices() const { return _shadowMatrices; }
+
+        /**
+         * @brief Shadow texture matrices
+         *
+         * View space to shadow map texture space transformation for each
+         * cascade, to be used with @ref Phong::setShadowMatrices().
+         */
+        Containers::ArrayView<const Matrix4> textureMatrices() const { return _textureMatrices; }
+
+        /**
+         * @brief Cascade frustums
+         *
+         * World-space frustum of each cascade, including the shadow caster
+         * distance.
+         */
+        Containers::ArrayView<const Frustum> frustums() const { return _frustums; }
+
+        /**
+         * @brief Cascades affected by a shadow caster
+         *
+         * Bit @cpp i @ce of the result is set if a sphere with given
+         * world-space @p center and @p radius intersects the
+         * @p i-th cascade, which means it has to be drawn into it.
+         */
+        UnsignedInt cascadeMask(const Vector3& center, Float radius) const;
+
+        /**
+         * @brief Calculate split distances
+         *
+         * Fills @p distances with boundaries of @cpp distances.size() - 1 @ce
+         * cascades between @p near and @p far. Used internally by
+         * @ref update().
+         */
+        static void splitDistances(Float near, Float far, Float lambda, Containers::ArrayView<Float> distances);
+
+    private:
+        Float _splitLambda{0.75f}, _casterDistance{};
+        Int _shadowMapSize{};
+        Vector3 _lightDirection{0.0f, -1.0f, 0.0f};
+        Containers::Array<Float> _splitDistances;
+        Containers::Array<Matrix4> _shadowMatrices, _textureMatrices;
+        Containers::Array<Frustum> _frustums;
+};
+
+}}
+
+#endif
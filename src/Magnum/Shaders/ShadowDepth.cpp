@@ -0,0 +1,195 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShadowDepth.h"
+
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/Shaders/ShadowCascades.h"
+
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+ShadowDepth::ShadowDepth(const Flags flags, const UnsignedInt cascadeCount): _flags{flags}, _cascadeCount{1} {
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::LayeredCascades) {
+        CORRADE_ASSERT(cascadeCount && cascadeCount <= ShadowCascades::maxCascadeCount(),
+            "Shaders::ShadowDepth: expected 1 to" << ShadowCascades::maxCascadeCount() << "cascades but got" << cascadeCount, );
+        _cascadeCount = cascadeCount;
+        MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL400);
+    }
+    #else
+    static_cast<void>(cascadeCount);
+    #endif
+
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumShaders"))
+        importShaderResources();
+    #endif
+    Utility::Resource rs("MagnumShaders");
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* Geometry shader instancing needs GLSL 4.00 */
+    const GL::Version version = flags & Flag::LayeredCascades ? GL::Version::GL400 :
+        GL::Context::current().supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
+    #else
+    const GL::Version version = GL::Context::current().supportedVersion({GL::Version::GLES300, GL::Version::GLES200});
+    #endif
+
+    GL::Shader vert = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Vertex);
+    GL::Shader frag = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Fragment);
+
+    vert.addSource(flags & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n" : "")
+        #ifndef MAGNUM_TARGET_GLES
+        .addSource(flags & Flag::LayeredCascades ? "#define LAYERED_CASCADES\n" : "")
+        #endif
+        .addSource(rs.get("generic.glsl"))
+        .addSource(rs.get("ShadowDepth.vert"));
+    frag.addSource(rs.get("DepthOnly.frag"));
+
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Optional<GL::Shader> geom;
+    if(flags & Flag::LayeredCascades) {
+        /* Initializer for the matrix array -- a list of mat4(1.0) joined by
+           commas */
+        std::string initializer;
+        for(UnsignedInt i = 0; i != _cascadeCount; ++i) {
+            if(i) initializer += ", ";
+            initializer += "mat4(1.0)";
+        }
+
+        geom = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Geometry);
+        geom->addSource(Utility::formatString(
+            "#define CASCADE_COUNT {}\n"
+            "#define SHADOW_MATRIX_INITIALIZER {}\n", _cascadeCount, initializer))
+            .addSource(rs.get("ShadowDepth.geom"));
+    }
+    #endif
+
+    /* Load the program from the binary cache, if there's one, otherwise
+       compile and link it from the sources */
+    #ifndef MAGNUM_TARGET_GLES
+    const bool cached = geom ? loadCachedBinary({vert, *geom, frag}) : loadCachedBinary({vert, frag});
+    #else
+    const bool cached = loadCachedBinary({vert, frag});
+    #endif
+    if(!cached) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(geom) CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, *geom, frag}));
+        else
+        #endif
+            CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+
+        attachShaders({vert, frag});
+        #ifndef MAGNUM_TARGET_GLES
+        if(geom) attachShader(*geom);
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
+        #else
+        if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
+        #endif
+        {
+            bindAttributeLocation(Position::Location, "position");
+            if(flags & Flag::InstancedTransformation) bindAttributeLocation(TransformationMatrix::Location, "instancedTransformationMatrix");
+        }
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        #ifndef MAGNUM_TARGET_GLES
+        if(geom) saveCachedBinary({vert, *geom, frag});
+        else
+        #endif
+            saveCachedBinary({vert, frag});
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
+    #endif
+    {
+        _transformationMatrixUniform = uniformLocation("transformationMatrix");
+        #ifndef MAGNUM_TARGET_GLES
+        if(flags & Flag::LayeredCascades)
+            _shadowMatricesUniform = uniformLocation("shadowMatrices");
+        else
+        #endif
+            _shadowMatricesUniform = uniformLocation("shadowMatrix");
+    }
+
+    /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
+    #ifdef MAGNUM_TARGET_GLES
+    setTransformationMatrix({});
+    setShadowMatrix({});
+    #endif
+}
+
+ShadowDepth& ShadowDepth::setShadowMatrices(const Containers::ArrayView<const Matrix4> matrices) {
+    CORRADE_ASSERT(_cascadeCount == matrices.size(),
+        "Shaders::ShadowDepth::setShadowMatrices(): expected" << _cascadeCount << "items but got" << matrices.size(), *this);
+    setUniform(_shadowMatricesUniform, matrices);
+    return *this;
+}
+
+ShadowDepth& ShadowDepth::setShadowMatrix(const UnsignedInt id, const Matrix4& matrix) {
+    CORRADE_ASSERT(id < _cascadeCount,
+        "Shaders::ShadowDepth::setShadowMatrix(): cascade ID" << id << "is out of bounds for" << _cascadeCount << "cascades", *this);
+    setUniform(_shadowMatricesUniform + id, matrix);
+    return *this;
+}
+
+Debug& operator<<(Debug& debug, const ShadowDepth::Flag value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case ShadowDepth::Flag::v: return debug << "Shaders::ShadowDepth::Flag::" #v;
+        _c(InstancedTransformation)
+        #ifndef MAGNUM_TARGET_GLES
+        _c(LayeredCascades)
+        #endif
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Shaders::ShadowDepth::Flag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const ShadowDepth::Flags value) {
+    return Containers::enumSetDebugOutput(debug, value, "Shaders::ShadowDepth::Flags{}", {
+        ShadowDepth::Flag::InstancedTransformation,
+        #ifndef MAGNUM_TARGET_GLES
+        ShadowDepth::Flag::LayeredCascades
+        #endif
+        });
+}
+
+}}
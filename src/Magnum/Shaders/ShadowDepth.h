@@ -0,0 +1,257 @@
+#ifndef Magnum_Shaders_ShadowDepth_h
+#define Magnum_Shaders_ShadowDepth_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::ShadowDepth
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Shadow map depth shader
+
+Depth-only shader for rendering shadow casters into a shadow map, usually
+a layer of a @ref GL::Texture2DArray for each cascade calculated with
+@ref ShadowCascades. The mesh needs to have the @ref Position attribute,
+everything else is ignored. Set the object transformation with
+@ref setTransformationMatrix() and the cascade projection with
+@ref setShadowMatrix().
+
+@section Shaders-ShadowDepth-usage Example usage
+
+The shadow map needs a depth texture with comparison enabled for the lookup
+in @ref Phong. Rendering is done to one cascade at a time, which also makes
+it possible to skip objects that don't affect given cascade --- see
+@ref ShadowCascades::cascadeMask(). A polygon offset is useful for avoiding
+self-shadowing artifacts.
+
+@code{.cpp}
+GL::Texture2DArray shadowMap;
+shadowMap.setStorage(1, GL::TextureFormat::DepthComponent24, {2048, 2048, 4})
+    .setMinificationFilter(GL::SamplerFilter::Linear)
+    .setMagnificationFilter(GL::SamplerFilter::Linear)
+    .setWrapping(GL::SamplerWrapping::ClampToEdge)
+    .setCompareMode(GL::SamplerCompareMode::CompareRefToTexture)
+    .setCompareFunction(GL::SamplerCompareFunction::LessOrEqual);
+
+GL::Renderer::enable(GL::Renderer::Feature::PolygonOffsetFill);
+GL::Renderer::setPolygonOffset(2.0f, 4.0f);
+
+Shaders::ShadowDepth shader;
+shader.setShadowMatrix(cascades.shadowMatrices()[i])
+    .setTransformationMatrix(transformation);
+mesh.draw(shader);
+@endcode
+
+@section Shaders-ShadowDepth-layered Single-pass rendering of all cascades
+
+With @ref Flag::LayeredCascades, a geometry shader replicates each triangle
+into all cascades using geometry shader instancing, so the casters are drawn
+only once into a framebuffer with the whole texture array attached using
+@ref GL::Framebuffer::attachLayeredTexture(). The matrices for all cascades
+are then set at once with @ref setShadowMatrices().
+
+@code{.cpp}
+Shaders::ShadowDepth shader{Shaders::ShadowDepth::Flag::LayeredCascades, 4};
+shader.setShadowMatrices(cascades.shadowMatrices());
+@endcode
+
+@see @ref Shaders-Phong-usage-shadows
+*/
+class MAGNUM_SHADERS_EXPORT ShadowDepth: public GL::AbstractShaderProgram {
+    public:
+        /**
+         * @brief Vertex position
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @ref Magnum::Vector3 "Vector3".
+         */
+        typedef Generic3D::Position Position;
+
+        /**
+         * @brief Instanced transformation matrix
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @ref Magnum::Matrix4 "Matrix4". Used only if
+         * @ref Flag::InstancedTransformation is set.
+         */
+        typedef Generic3D::TransformationMatrix TransformationMatrix;
+
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Instanced transformation. Retrieves a per-instance
+             * transformation matrix from the @ref TransformationMatrix
+             * attribute and uses it together with the matrix coming from
+             * @ref setTransformationMatrix() (first the per-instance, then
+             * the uniform matrix).
+             */
+            InstancedTransformation = 1 << 0,
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Render into all cascades in a single pass using an instanced
+             * geometry shader.
+             * @requires_gl40 Extension @gl_extension{ARB,gpu_shader5}
+             * @requires_gl Geometry shader instancing is not available in
+             *      OpenGL ES or WebGL.
+             */
+            LayeredCascades = 1 << 1
+            #endif
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /**
+         * @brief Constructor
+         * @param flags         Flags
+         * @param cascadeCount  Count of cascades rendered in a single pass
+         *
+         * The @p cascadeCount is used only if @ref Flag::LayeredCascades is
+         * set, in which case it's expected to be between @cpp 1 @ce and
+         * @ref ShadowCascades::maxCascadeCount(). Otherwise the shader
+         * renders to a single cascade.
+         */
+        explicit ShadowDepth(Flags flags = {}, UnsignedInt cascadeCount = 1);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit ShadowDepth(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        ShadowDepth(const ShadowDepth&) = delete;
+
+        /** @brief Move constructor */
+        ShadowDepth(ShadowDepth&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        ShadowDepth& operator=(const ShadowDepth&) = delete;
+
+        /** @brief Move assignment */
+        ShadowDepth& operator=(ShadowDepth&&) noexcept = default;
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Cascade count
+         *
+         * Count of cascades rendered in a single pass. Always @cpp 1 @ce if
+         * @ref Flag::LayeredCascades is not set.
+         */
+        UnsignedInt cascadeCount() const { return _cascadeCount; }
+
+        /**
+         * @brief Set transformation matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Object to world transformation. Initial value is an identity
+         * matrix.
+         */
+        ShadowDepth& setTransformationMatrix(const Matrix4& matrix) {
+            setUniform(_transformationMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Set shadow matrices
+         * @return Reference to self (for method chaining)
+         *
+         * World to light clip space transformation of each cascade, usually
+         * @ref ShadowCascades::shadowMatrices(). Expects that the size of the
+         * @p matrices array is the same as @ref cascadeCount(). Initial value
+         * is an identity matrix.
+         */
+        ShadowDepth& setShadowMatrices(Containers::ArrayView<const Matrix4> matrices);
+
+        /** @overload */
+        ShadowDepth& setShadowMatrices(std::initializer_list<Matrix4> matrices) {
+            return setShadowMatrices({matrices.begin(), matrices.size()});
+        }
+
+        /**
+         * @brief Set shadow matrix for given cascade
+         * @return Reference to self (for method chaining)
+         *
+         * Unlike @ref setShadowMatrices() updates just a single cascade.
+         * Expects that @p id is less than @ref cascadeCount().
+         */
+        ShadowDepth& setShadowMatrix(UnsignedInt id, const Matrix4& matrix);
+
+        /**
+         * @brief Set shadow matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref setShadowMatrix(UnsignedInt, const Matrix4&)
+         * with @p id set to @cpp 0 @ce.
+         */
+        ShadowDepth& setShadowMatrix(const Matrix4& matrix) {
+            return setShadowMatrix(0, matrix);
+        }
+
+    private:
+        Flags _flags;
+        UnsignedInt _cascadeCount;
+        Int _transformationMatrixUniform{0},
+            _shadowMatricesUniform{1};
+};
+
+/** @debugoperatorclassenum{ShadowDepth,ShadowDepth::Flag} */
+MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, ShadowDepth::Flag value);
+
+/** @debugoperatorclassenum{ShadowDepth,ShadowDepth::Flags} */
+MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, ShadowDepth::Flags value);
+
+CORRADE_ENUMSET_OPERATORS(ShadowDepth::Flags)
+
+}}
+
+#endif
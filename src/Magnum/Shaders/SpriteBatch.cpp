@@ -0,0 +1,124 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SpriteBatch.h"
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/Shaders/Sprites.h"
+
+namespace Magnum { namespace Shaders {
+
+SpriteBatch::SpriteBatch(NoCreateT) noexcept: _usage{}, _buffer{NoCreate}, _mesh{NoCreate} {}
+
+SpriteBatch::SpriteBatch(const Vector2i& textureSize, const GL::BufferUsage usage): SpriteBatch{NoCreate} {
+    CORRADE_ASSERT(textureSize.product(),
+        "Shaders::SpriteBatch: expected a non-zero texture size, got" << textureSize, );
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::instanced_arrays);
+    #endif
+
+    _textureSize = textureSize;
+    _usage = usage;
+    _buffer = GL::Buffer{GL::Buffer::TargetHint::Array};
+
+    /* Corners are generated from the vertex ID, so the only attributes are
+       per-instance */
+    static_assert(sizeof(Instance) == sizeof(Matrix3) + sizeof(Vector4) + sizeof(Float) + sizeof(Color4),
+        "unexpected padding in the instance data");
+    _mesh = GL::Mesh{GL::MeshPrimitive::TriangleStrip};
+    _mesh.setCount(4)
+        .setInstanceCount(0)
+        .addVertexBufferInstanced(_buffer, 1, 0,
+            Sprites::TransformationMatrix{},
+            Sprites::TextureRectangle{},
+            Sprites::TextureLayer{},
+            Sprites::Color{});
+}
+
+SpriteBatch& SpriteBatch::reserve(const std::size_t count) {
+    CORRADE_ASSERT(_buffer.id(),
+        "Shaders::SpriteBatch::reserve(): the batch is moved-out or not created", *this);
+
+    _instances.reserve(count);
+    if(count <= _capacity) return *this;
+
+    /* The previous contents are not needed as update() replaces them
+       anyway */
+    _buffer.setData({nullptr, count*sizeof(Instance)}, _usage);
+    _capacity = count;
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::add(const Matrix3& transformationMatrix, const Range2D& textureCoordinates, const Int layer, const Color4& color) {
+    _instances.push_back(Instance{transformationMatrix,
+        {textureCoordinates.min(), textureCoordinates.size()},
+        Float(layer), color});
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::add(const Matrix3& transformationMatrix, const Range3Di& range, const Color4& color) {
+    const Vector2 textureSize{_textureSize};
+    return add(transformationMatrix,
+        Range2D::fromSize(Vector2{range.min().xy()}/textureSize,
+                          Vector2{range.size().xy()}/textureSize),
+        range.min().z(), color);
+}
+
+SpriteBatch& SpriteBatch::clear() {
+    _instances.clear();
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::update() {
+    CORRADE_ASSERT(_buffer.id(),
+        "Shaders::SpriteBatch::update(): the batch is moved-out or not created", *this);
+
+    /* Enlarge the buffer if needed, otherwise just replace the contents */
+    if(_instances.size() > _capacity) {
+        _buffer.setData({_instances.data(), _instances.size()*sizeof(Instance)}, _usage);
+        _capacity = _instances.size();
+    } else if(!_instances.empty())
+        _buffer.setSubData(0, {_instances.data(), _instances.size()*sizeof(Instance)});
+
+    _drawCount = _instances.size();
+    _mesh.setInstanceCount(Int(_drawCount));
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::draw(Sprites& shader) {
+    CORRADE_ASSERT(_buffer.id(),
+        "Shaders::SpriteBatch::draw(): the batch is moved-out or not created", *this);
+
+    if(!_drawCount) return *this;
+
+    _mesh.draw(shader);
+    return *this;
+}
+
+}}
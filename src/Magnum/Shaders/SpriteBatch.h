@@ -0,0 +1,294 @@
+#ifndef Magnum_Shaders_SpriteBatch_h
+#define Magnum_Shaders_SpriteBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::SpriteBatch
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Batched sprite renderer
+
+Collects sprites into a single instance buffer and draws all of them with
+one instanced draw call using the @ref Sprites shader. The sprite images are
+expected to be packed into layers of a single @ref GL::Texture2DArray, for
+example using @ref TextureTools::AtlasArrayPacker, so sprites from all layers
+can be drawn together.
+
+@section Shaders-SpriteBatch-usage Usage
+
+Pack the sprite images into a texture array, remember the ranges and then
+each frame add the sprites to the batch, upload them with @ref update() and
+draw:
+
+@code{.cpp}
+TextureTools::AtlasArrayPacker packer{{1024, 1024}, 4};
+Range3Di playerSprite = *packer.add(playerImage.size());
+texture.setSubImage(0, playerSprite.min(), ImageView3D{playerImage.format(),
+    playerImage.type(), {playerImage.size(), 1}, playerImage.data()});
+// ...
+
+Shaders::Sprites shader;
+Shaders::SpriteBatch batch{{1024, 1024}};
+
+// each frame
+batch.clear()
+    .add(Matrix3::translation(playerPosition)*Matrix3::scaling(Vector2{0.5f}), playerSprite)
+    .add(...)
+    .update();
+
+shader.setProjectionMatrix(projection)
+    .bindTexture(texture);
+batch.draw(shader);
+@endcode
+
+@section Shaders-SpriteBatch-scenegraph Usage with SceneGraph
+
+The batch can be filled from @ref SceneGraph::Drawable2D "SceneGraph::Drawable2D"
+instances. Instead of drawing, the drawables just add themselves to the batch
+in @ref SceneGraph::Drawable::draw() "draw()", using the transformation
+relative to the camera. The whole group is then drawn with a single draw call.
+Frustum culling of the camera works as usual, culled sprites don't get added
+to the batch at all:
+
+@code{.cpp}
+class SpriteDrawable: public SceneGraph::Drawable2D {
+    public:
+        explicit SpriteDrawable(Object2D& object, Shaders::SpriteBatch& batch, const Range3Di& sprite, SceneGraph::DrawableGroup2D& group): SceneGraph::Drawable2D{object, &group}, _batch(batch), _sprite{sprite} {
+            setBoundingBox({Vector2{-1.0f}, Vector2{1.0f}});
+        }
+
+    private:
+        void draw(const Matrix3& transformationMatrix, SceneGraph::Camera2D&) override {
+            _batch.add(transformationMatrix, _sprite);
+        }
+
+        Shaders::SpriteBatch& _batch;
+        Range3Di _sprite;
+};
+
+// each frame
+batch.clear();
+camera.draw(sprites);
+batch.update();
+
+shader.setProjectionMatrix(camera.projectionMatrix())
+    .bindTexture(texture);
+batch.draw(shader);
+@endcode
+
+@section Shaders-SpriteBatch-performance Performance optimizations
+
+The sprites are kept in a CPU-side buffer that's reused between frames, so
+once it's large enough, adding the sprites doesn't allocate. The GPU buffer is
+reallocated in @ref update() only if it needs to grow, otherwise its contents
+are just replaced, which means one buffer upload and one draw call per frame
+regardless of the sprite count. Use @ref reserve() to avoid the reallocations
+if the max sprite count is known upfront.
+
+@requires_gl30 Extension @gl_extension{EXT,texture_array} and
+    @gl_extension{EXT,gpu_shader4} for `gl_VertexID`
+@requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+@requires_gles30 Texture arrays, instanced arrays and `gl_VertexID` are not
+    available in OpenGL ES 2.0.
+@requires_webgl20 Texture arrays, instanced arrays and `gl_VertexID` are not
+    available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT SpriteBatch {
+    public:
+        /**
+         * @brief Constructor
+         * @param textureSize   Size of each texture layer the sprites are in
+         * @param usage         Instance buffer usage
+         *
+         * The @p textureSize is used to convert the sprite ranges passed to
+         * @ref add(const Matrix3&, const Range3Di&, const Color4&) to
+         * normalized texture coordinates. Expects that it's non-zero.
+         */
+        explicit SpriteBatch(const Vector2i& textureSize, GL::BufferUsage usage = GL::BufferUsage::DynamicDraw);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL objects
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit SpriteBatch(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        SpriteBatch(const SpriteBatch&) = delete;
+
+        /** @brief Move constructor */
+        SpriteBatch(SpriteBatch&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+        /** @brief Move assignment */
+        SpriteBatch& operator=(SpriteBatch&&) noexcept = default;
+
+        /** @brief Size of each texture layer */
+        Vector2i textureSize() const { return _textureSize; }
+
+        /**
+         * @brief Count of added sprites
+         *
+         * Count of sprites added since construction or last @ref clear().
+         * Not necessarily the same as the count of sprites drawn by
+         * @ref draw(), which reflects the state after the last
+         * @ref update() call.
+         */
+        std::size_t size() const { return _instances.size(); }
+
+        /**
+         * @brief Capacity of the instance buffer
+         *
+         * Count of sprites that fit into the GPU buffer without
+         * reallocating it.
+         * @see @ref reserve()
+         */
+        std::size_t capacity() const { return _capacity; }
+
+        /** @brief Instance buffer */
+        GL::Buffer& buffer() { return _buffer; }
+
+        /**
+         * @brief Mesh
+         *
+         * Contains the per-instance attributes of @ref Sprites and reflects
+         * the state after the last @ref update() call.
+         */
+        GL::Mesh& mesh() { return _mesh; }
+
+        /**
+         * @brief Reserve capacity for given count of sprites
+         * @return Reference to self (for method chaining)
+         *
+         * Reserves the CPU-side storage and reallocates the GPU buffer if
+         * the @ref capacity() is smaller than @p count. Expects that the
+         * instance is not moved-out or created with @ref NoCreate.
+         */
+        SpriteBatch& reserve(std::size_t count);
+
+        /**
+         * @brief Add a sprite
+         * @param transformationMatrix  Sprite transformation
+         * @param textureCoordinates    Normalized sprite texture coordinates
+         * @param layer                 Sprite texture layer
+         * @param color                 Sprite color
+         * @return Reference to self (for method chaining)
+         *
+         * The @p transformationMatrix is applied to the @f$ [-1; 1] @f$
+         * sprite quad, i.e. the scaling is half of the sprite size. The
+         * sprite is added into CPU-side storage, call @ref update() to
+         * upload it.
+         */
+        SpriteBatch& add(const Matrix3& transformationMatrix, const Range2D& textureCoordinates, Int layer, const Color4& color = Color4{1.0f});
+
+        /**
+         * @brief Add a sprite from a texture array atlas range
+         * @return Reference to self (for method chaining)
+         *
+         * Converts pixel coordinates in @p range to normalized texture
+         * coordinates using @ref textureSize(), the Z coordinate is taken as
+         * the layer. Such ranges are produced for example by
+         * @ref TextureTools::AtlasArrayPacker::add(). Note that rotated
+         * ranges produced with @ref TextureTools::AtlasPacker::Flag::AllowRotation
+         * are not supported.
+         */
+        SpriteBatch& add(const Matrix3& transformationMatrix, const Range3Di& range, const Color4& color = Color4{1.0f});
+
+        /**
+         * @brief Remove all sprites
+         * @return Reference to self (for method chaining)
+         *
+         * The CPU-side storage and the GPU buffer are kept allocated. The
+         * @ref mesh() still draws the previously uploaded sprites until the
+         * next @ref update().
+         */
+        SpriteBatch& clear();
+
+        /**
+         * @brief Upload the sprites
+         * @return Reference to self (for method chaining)
+         *
+         * Uploads all sprites added since last @ref clear() to the instance
+         * buffer, enlarging it if needed. Expects that the instance is not
+         * moved-out or created with @ref NoCreate.
+         */
+        SpriteBatch& update();
+
+        /**
+         * @brief Draw the sprites
+         * @return Reference to self (for method chaining)
+         *
+         * Draws all sprites uploaded in the last @ref update() with a single
+         * instanced draw call. If there are no sprites, the function is a
+         * no-op. Expects that the instance is not moved-out or created with
+         * @ref NoCreate.
+         */
+        SpriteBatch& draw(Sprites& shader);
+
+    private:
+        struct Instance {
+            Matrix3 transformationMatrix;
+            Vector4 textureRectangle;
+            Float textureLayer;
+            Color4 color;
+        };
+
+        Vector2i _textureSize;
+        GL::BufferUsage _usage;
+        std::size_t _capacity{}, _drawCount{};
+        std::vector<Instance> _instances;
+        GL::Buffer _buffer;
+        GL::Mesh _mesh;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
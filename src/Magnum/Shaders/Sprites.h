@@ -0,0 +1,156 @@
+#ifndef Magnum_Shaders_Sprites_h
+#define Magnum_Shaders_Sprites_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::Sprites
+ */
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Sprite rendering shader
+
+Renders textured 2D sprites from layers of a @ref GL::Texture2DArray. Each
+sprite is one instance of a four-vertex triangle strip with corners generated
+from the vertex ID, so no vertex data besides the per-instance
+@ref TransformationMatrix, @ref TextureRectangle, @ref TextureLayer and
+@ref Color attributes are needed. The sprite quad spans the
+@f$ [-1; 1] @f$ square before the transformation. The texture is multiplied
+with the per-instance color. The shader is meant to be used through
+@ref SpriteBatch, which manages the instance buffer, see its documentation
+for an usage example.
+
+The sprites are not sorted, so semi-transparent sprites are meant to be
+rendered with blending enabled and depth test disabled, in the order they
+were added to the batch.
+
+@requires_gl30 Extension @gl_extension{EXT,texture_array} and
+    @gl_extension{EXT,gpu_shader4} for `gl_VertexID`
+@requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+@requires_gles30 Texture arrays, instanced arrays and `gl_VertexID` are not
+    available in OpenGL ES 2.0.
+@requires_webgl20 Texture arrays, instanced arrays and `gl_VertexID` are not
+    available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT Sprites: public GL::AbstractShaderProgram {
+    public:
+        /**
+         * @brief Sprite transformation
+         *
+         * @ref Magnum::Matrix3 "Matrix3", per-instance. Transforms the
+         * @f$ [-1; 1] @f$ sprite quad, i.e. the scaling is half of the
+         * sprite size.
+         */
+        typedef GL::Attribute<0, Matrix3> TransformationMatrix;
+
+        /**
+         * @brief Sprite texture rectangle
+         *
+         * @ref Magnum::Vector4 "Vector4", per-instance. Offset of the sprite
+         * image in the texture layer in XY and its size in ZW, both in
+         * normalized texture coordinates.
+         */
+        typedef GL::Attribute<3, Vector4> TextureRectangle;
+
+        /**
+         * @brief Sprite texture layer
+         *
+         * @ref Magnum::Float "Float", per-instance.
+         */
+        typedef GL::Attribute<4, Float> TextureLayer;
+
+        /**
+         * @brief Sprite color
+         *
+         * @ref Magnum::Color4 "Color4", per-instance. Multiplied with the
+         * texture.
+         */
+        typedef GL::Attribute<5, Magnum::Color4> Color;
+
+        /** @brief Constructor */
+        explicit Sprites();
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit Sprites(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        Sprites(const Sprites&) = delete;
+
+        /** @brief Move constructor */
+        Sprites(Sprites&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        Sprites& operator=(const Sprites&) = delete;
+
+        /** @brief Move assignment */
+        Sprites& operator=(Sprites&&) noexcept = default;
+
+        /**
+         * @brief Set projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Applied after the per-instance @ref TransformationMatrix. Initial
+         * value is an identity matrix.
+         */
+        Sprites& setProjectionMatrix(const Matrix3& matrix) {
+            setUniform(_projectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Bind sprite texture
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref TextureTools::AtlasArrayPacker
+         */
+        Sprites& bindTexture(GL::Texture2DArray& texture);
+
+    private:
+        Int _projectionMatrixUniform{0};
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
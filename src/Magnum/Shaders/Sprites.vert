@@ -0,0 +1,72 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#define TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION 0
+#define TEXTURE_RECTANGLE_ATTRIBUTE_LOCATION 3
+#define TEXTURE_LAYER_ATTRIBUTE_LOCATION 4
+#define COLOR_ATTRIBUTE_LOCATION 5
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 0)
+#endif
+uniform highp mat3 projectionMatrix
+    #ifndef GL_ES
+    = mat3(1.0)
+    #endif
+    ;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION)
+#endif
+in highp mat3 transformationMatrix;
+
+/* Offset in XY, size in ZW */
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TEXTURE_RECTANGLE_ATTRIBUTE_LOCATION)
+#endif
+in mediump vec4 textureRectangle;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TEXTURE_LAYER_ATTRIBUTE_LOCATION)
+#endif
+in mediump float textureLayer;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION)
+#endif
+in lowp vec4 color;
+
+out mediump vec3 interpolatedTextureCoordinates;
+out lowp vec4 interpolatedColor;
+
+void main() {
+    /* Quad corners for a four-vertex triangle strip, generated from the
+       vertex ID so no vertex buffer is needed */
+    mediump vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+
+    gl_Position.xywz = vec4(projectionMatrix*transformationMatrix*vec3(corner*2.0 - vec2(1.0), 1.0), 0.0);
+    interpolatedTextureCoordinates = vec3(textureRectangle.xy + corner*textureRectangle.zw, textureLayer);
+    interpolatedColor = color;
+}
@@ -0,0 +1,132 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Terrain.h"
+
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/TextureArray.h"
+
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    enum: Int { HeightmapTextureLayer = 0 };
+}
+
+Terrain::Terrain() {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumShaders"))
+        importShaderResources();
+    #endif
+    Utility::Resource rs("MagnumShaders");
+
+    /* Texture arrays and textureLod() in the vertex shader need GLSL 1.30 */
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    const GL::Version version = GL::Context::current().supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300});
+    #else
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GLES300);
+    const GL::Version version = GL::Version::GLES300;
+    #endif
+
+    GL::Shader vert = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Vertex);
+    GL::Shader frag = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Fragment);
+
+    vert.addSource(rs.get("generic.glsl"))
+        .addSource(rs.get("Terrain.vert"));
+    frag.addSource(rs.get("Terrain.frag"));
+
+    /* Load the program from the binary cache, if there's one, otherwise
+       compile and link it from the sources */
+    if(!loadCachedBinary({vert, frag})) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+
+        attachShaders({vert, frag});
+
+        /* ES3 has explicit attribute locations always */
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version)) {
+            bindAttributeLocation(Position::Location, "position");
+            bindAttributeLocation(PatchOffsetSize::Location, "patchOffsetSize");
+            bindAttributeLocation(MorphRange::Location, "morphRange");
+            bindAttributeLocation(TileTextureTransformation::Location, "tileTextureTransformation");
+        }
+        #endif
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+        saveCachedBinary({vert, frag});
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
+    #endif
+    {
+        _transformationProjectionMatrixUniform = uniformLocation("transformationProjectionMatrix");
+        _cameraPositionUniform = uniformLocation("cameraPosition");
+        _gridSizeUniform = uniformLocation("gridSize");
+        _heightRangeUniform = uniformLocation("heightRange");
+        _lightDirectionUniform = uniformLocation("lightDirection");
+        _colorUniform = uniformLocation("color");
+        _ambientColorUniform = uniformLocation("ambientColor");
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>(version))
+    #endif
+    {
+        setUniform(uniformLocation("heightmapTexture"), HeightmapTextureLayer);
+    }
+
+    /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
+    #ifdef MAGNUM_TARGET_GLES
+    setTransformationProjectionMatrix({});
+    setGridSize(32);
+    setHeightRange({0.0f, 1.0f});
+    setLightDirection({0.0f, -1.0f, 0.0f});
+    setColor(Color4{1.0f});
+    /* Camera position and ambient color is zero by default */
+    #endif
+}
+
+Terrain& Terrain::setGridSize(const Int size) {
+    CORRADE_ASSERT(size > 0 && size % 2 == 0,
+        "Shaders::Terrain::setGridSize(): expected a positive even size, got" << size, *this);
+    setUniform(_gridSizeUniform, Float(size));
+    return *this;
+}
+
+Terrain& Terrain::bindHeightmapTexture(GL::Texture2DArray& texture) {
+    texture.bind(HeightmapTextureLayer);
+    return *this;
+}
+
+}}
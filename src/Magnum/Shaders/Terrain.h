@@ -0,0 +1,256 @@
+#ifndef Magnum_Shaders_Terrain_h
+#define Magnum_Shaders_Terrain_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::Terrain
+ */
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Heightmap terrain shader
+
+Draws terrain patches selected by @ref TerrainQuadtree as instances of a
+single flat grid mesh, displaced by a heightmap sampled in the vertex shader.
+The terrain lies in the XZ plane with heights along the Y axis, all in world
+space. Patch vertices are gradually morphed to the resolution of the next
+coarser level based on their distance from @ref setCameraPosition(), which
+hides level transitions and cracks. Normals are calculated from the
+heightmap and the terrain is shaded with a single directional light.
+
+The grid mesh is expected to have an even count of cells in each direction,
+the same as set with @ref setGridSize(), and position in the XY plane in
+range @f$ [-1, 1] @f$, which is what @ref Primitives::grid3DSolid()
+produces. The heightmap tiles are expected to be single-channel, in a
+@ref GL::Texture2DArray bound with @ref bindHeightmapTexture(). The value is
+expected to be normalized, and is mapped to @ref setHeightRange().
+
+@code{.cpp}
+Trade::MeshData3D grid = Primitives::grid3DSolid({31, 31}, {});
+
+GL::Buffer vertices, indices, instances;
+vertices.setData(grid.positions(0), GL::BufferUsage::StaticDraw);
+indices.setData(grid.indices(), GL::BufferUsage::StaticDraw);
+
+GL::Mesh patchMesh;
+patchMesh.setCount(grid.indices().size())
+    .addVertexBuffer(vertices, 0, Shaders::Terrain::Position{})
+    .addVertexBufferInstanced(instances, 1, 0,
+        Shaders::Terrain::PatchOffsetSize{},
+        Shaders::Terrain::MorphRange{},
+        Shaders::Terrain::TileTextureTransformation{})
+    .setIndexBuffer(indices, 0, GL::MeshIndexType::UnsignedInt);
+
+Shaders::Terrain shader;
+shader.setGridSize(32)
+    .setHeightRange({-50.0f, 800.0f});
+@endcode
+
+See @ref TerrainQuadtree for an example of selecting and drawing the patches
+each frame.
+
+@requires_gl30 Extension @gl_extension{EXT,texture_array}
+@requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+@requires_gles30 Texture arrays and instanced arrays are not available in
+    OpenGL ES 2.0.
+@requires_webgl20 Texture arrays and instanced arrays are not available in
+    WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT Terrain: public GL::AbstractShaderProgram {
+    public:
+        /**
+         * @brief Vertex position
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector3. Only the
+         * XY components are used.
+         */
+        typedef Generic3D::Position Position;
+
+        /**
+         * @brief Patch offset and size
+         *
+         * Instanced @ref Vector3, see @ref TerrainPatch::offsetSize.
+         */
+        typedef GL::Attribute<4, Vector3> PatchOffsetSize;
+
+        /**
+         * @brief Morph range
+         *
+         * Instanced @ref Vector2, see @ref TerrainPatch::morphRange.
+         */
+        typedef GL::Attribute<5, Vector2> MorphRange;
+
+        /**
+         * @brief Tile texture transformation
+         *
+         * Instanced @ref Vector4, see
+         * @ref TerrainPatch::tileTextureTransformation.
+         */
+        typedef GL::Attribute<6, Vector4> TileTextureTransformation;
+
+        /** @brief Constructor */
+        explicit Terrain();
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit Terrain(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        Terrain(const Terrain&) = delete;
+
+        /** @brief Move constructor */
+        Terrain(Terrain&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        Terrain& operator=(const Terrain&) = delete;
+
+        /** @brief Move assignment */
+        Terrain& operator=(Terrain&&) noexcept = default;
+
+        /**
+         * @brief Set transformation and projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * World to clip space transformation. Initial value is an identity
+         * matrix.
+         */
+        Terrain& setTransformationProjectionMatrix(const Matrix4& matrix) {
+            setUniform(_transformationProjectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Set camera position
+         * @return Reference to self (for method chaining)
+         *
+         * World-space position for calculating the morph factor, should be
+         * the same as passed to @ref TerrainQuadtree::select(). Initial value
+         * is a zero vector.
+         */
+        Terrain& setCameraPosition(const Vector3& position) {
+            setUniform(_cameraPositionUniform, position);
+            return *this;
+        }
+
+        /**
+         * @brief Set grid size
+         * @return Reference to self (for method chaining)
+         *
+         * Count of cells of the patch mesh in each direction. Expected to be
+         * even. Initial value is @cpp 32 @ce.
+         */
+        Terrain& setGridSize(Int size);
+
+        /**
+         * @brief Set height range
+         * @return Reference to self (for method chaining)
+         *
+         * Heights to which normalized heightmap values of @cpp 0.0f @ce and
+         * @cpp 1.0f @ce are mapped. Should be the same as
+         * @ref TerrainQuadtree::setHeightRange(). Initial value is
+         * @cpp {0.0f, 1.0f} @ce.
+         */
+        Terrain& setHeightRange(const Vector2& range) {
+            setUniform(_heightRangeUniform, range);
+            return *this;
+        }
+
+        /**
+         * @brief Set light direction
+         * @return Reference to self (for method chaining)
+         *
+         * Normalized direction in which the light travels, in world space.
+         * Initial value is @cpp {0.0f, -1.0f, 0.0f} @ce.
+         */
+        Terrain& setLightDirection(const Vector3& direction) {
+            setUniform(_lightDirectionUniform, direction);
+            return *this;
+        }
+
+        /**
+         * @brief Set color
+         * @return Reference to self (for method chaining)
+         *
+         * Initial value is @cpp 0xffffffff_rgbaf @ce.
+         */
+        Terrain& setColor(const Color4& color) {
+            setUniform(_colorUniform, color);
+            return *this;
+        }
+
+        /**
+         * @brief Set ambient color
+         * @return Reference to self (for method chaining)
+         *
+         * Initial value is @cpp 0x00000000_rgbaf @ce.
+         */
+        Terrain& setAmbientColor(const Color4& color) {
+            setUniform(_ambientColorUniform, color);
+            return *this;
+        }
+
+        /**
+         * @brief Bind heightmap texture
+         * @return Reference to self (for method chaining)
+         *
+         * Texture array with a heightmap tile in each layer, the layers
+         * being referenced from @ref TileTextureTransformation.
+         */
+        Terrain& bindHeightmapTexture(GL::Texture2DArray& texture);
+
+    private:
+        Int _transformationProjectionMatrixUniform{0},
+            _cameraPositionUniform{1},
+            _gridSizeUniform{2},
+            _heightRangeUniform{3},
+            _lightDirectionUniform{4},
+            _colorUniform{5},
+            _ambientColorUniform{6};
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
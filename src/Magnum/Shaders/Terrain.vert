@@ -0,0 +1,122 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#define PATCH_OFFSET_SIZE_ATTRIBUTE_LOCATION 4
+#define MORPH_RANGE_ATTRIBUTE_LOCATION 5
+#define TILE_TEXTURE_TRANSFORMATION_ATTRIBUTE_LOCATION 6
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 0)
+#endif
+uniform highp mat4 transformationProjectionMatrix
+    #ifndef GL_ES
+    = mat4(1.0)
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 1)
+#endif
+uniform highp vec3 cameraPosition; /* defaults to zero */
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 2)
+#endif
+uniform highp float gridSize
+    #ifndef GL_ES
+    = 32.0
+    #endif
+    ;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 3)
+#endif
+uniform highp vec2 heightRange
+    #ifndef GL_ES
+    = vec2(0.0, 1.0)
+    #endif
+    ;
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 0)
+#endif
+uniform highp sampler2DArray heightmapTexture;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = POSITION_ATTRIBUTE_LOCATION)
+#endif
+in highp vec4 position;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = PATCH_OFFSET_SIZE_ATTRIBUTE_LOCATION)
+#endif
+in highp vec3 patchOffsetSize;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = MORPH_RANGE_ATTRIBUTE_LOCATION)
+#endif
+in highp vec2 morphRange;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TILE_TEXTURE_TRANSFORMATION_ATTRIBUTE_LOCATION)
+#endif
+in highp vec4 tileTextureTransformation;
+
+out mediump vec3 normal;
+
+highp float height(highp vec2 patchCoordinates) {
+    highp vec2 textureCoordinates = tileTextureTransformation.xy + patchCoordinates*tileTextureTransformation.z;
+    return mix(heightRange.x, heightRange.y, textureLod(heightmapTexture, vec3(textureCoordinates, tileTextureTransformation.w), 0.0).r);
+}
+
+void main() {
+    /* Integer grid coordinates, rounded to avoid precision issues in the
+       mesh positions */
+    highp vec2 gridCoordinates = floor((position.xy*0.5 + vec2(0.5))*gridSize + vec2(0.5));
+
+    /* Morph factor based on distance of the undisplaced vertex */
+    highp vec2 patchCoordinates = gridCoordinates/gridSize;
+    highp vec2 worldPosition = patchOffsetSize.xy + patchCoordinates*patchOffsetSize.z;
+    highp float distance = length(cameraPosition - vec3(worldPosition.x, height(patchCoordinates), worldPosition.y));
+    highp float morph = clamp((distance - morphRange.x)/(morphRange.y - morphRange.x), 0.0, 1.0);
+
+    /* Move odd vertices onto the even ones, turning the patch into the grid
+       of the next coarser level for morph of 1 */
+    patchCoordinates = (gridCoordinates - mod(gridCoordinates, 2.0)*morph)/gridSize;
+    worldPosition = patchOffsetSize.xy + patchCoordinates*patchOffsetSize.z;
+
+    /* Normal from central differences of neighboring texels */
+    highp vec2 texelSize = 1.0/vec2(textureSize(heightmapTexture, 0).xy);
+    highp vec2 patchTexelSize = texelSize/tileTextureTransformation.z;
+    highp vec2 worldTexelSize = patchTexelSize*patchOffsetSize.z;
+    highp float left = height(patchCoordinates - vec2(patchTexelSize.x, 0.0));
+    highp float right = height(patchCoordinates + vec2(patchTexelSize.x, 0.0));
+    highp float back = height(patchCoordinates - vec2(0.0, patchTexelSize.y));
+    highp float front = height(patchCoordinates + vec2(0.0, patchTexelSize.y));
+    normal = normalize(vec3((left - right)/(2.0*worldTexelSize.x), 1.0,
+                            (back - front)/(2.0*worldTexelSize.y)));
+
+    gl_Position = transformationProjectionMatrix*vec4(worldPosition.x, height(patchCoordinates), worldPosition.y, 1.0);
+}
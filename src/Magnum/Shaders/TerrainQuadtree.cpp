@@ -0,0 +1,173 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TerrainQuadtree.h"
+
+#include <algorithm>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+
+UnsignedLong tileKey(const UnsignedInt level, const Vector2ui& coordinates) {
+    return UnsignedLong(level) << 48 | UnsignedLong(coordinates.x()) << 24 | coordinates.y();
+}
+
+}
+
+TerrainQuadtree::TerrainQuadtree(const Vector2& origin, const Float size, const UnsignedInt levelCount): _origin{origin}, _size{size}, _levelCount{levelCount} {
+    CORRADE_ASSERT(levelCount >= 1 && levelCount <= 16,
+        "Shaders::TerrainQuadtree: expected 1 to 16 levels, got" << levelCount, );
+    CORRADE_ASSERT(size > 0.0f,
+        "Shaders::TerrainQuadtree: expected positive size, got" << size, );
+    _detailDistance = patchSize(0)*2.0f;
+}
+
+Float TerrainQuadtree::patchSize(const UnsignedInt level) const {
+    CORRADE_ASSERT(level < _levelCount,
+        "Shaders::TerrainQuadtree::patchSize(): level" << level << "out of range for" << _levelCount << "levels", {});
+    return _size/Float(1u << (_levelCount - level - 1));
+}
+
+TerrainQuadtree& TerrainQuadtree::setHeightRange(const Vector2& range) {
+    _heightRange = range;
+    return *this;
+}
+
+TerrainQuadtree& TerrainQuadtree::setDetailDistance(const Float distance) {
+    CORRADE_ASSERT(distance > 0.0f,
+        "Shaders::TerrainQuadtree::setDetailDistance(): expected positive distance, got" << distance, *this);
+    _detailDistance = distance;
+    return *this;
+}
+
+TerrainQuadtree& TerrainQuadtree::setMorphStart(const Float ratio) {
+    CORRADE_ASSERT(ratio >= 0.0f && ratio < 1.0f,
+        "Shaders::TerrainQuadtree::setMorphStart(): expected a value in range [0, 1), got" << ratio, *this);
+    _morphStart = ratio;
+    return *this;
+}
+
+TerrainQuadtree& TerrainQuadtree::setTileResolution(const Int resolution) {
+    _tileResolution = resolution;
+    return *this;
+}
+
+Int TerrainQuadtree::tileLayer(const UnsignedInt level, const Vector2ui& coordinates) const {
+    const auto found = _tiles.find(tileKey(level, coordinates));
+    return found == _tiles.end() ? -1 : found->second;
+}
+
+TerrainQuadtree& TerrainQuadtree::setTile(const UnsignedInt level, const Vector2ui& coordinates, const Int layer) {
+    CORRADE_ASSERT(level < _levelCount,
+        "Shaders::TerrainQuadtree::setTile(): level" << level << "out of range for" << _levelCount << "levels", *this);
+    CORRADE_ASSERT((coordinates < Vector2ui{1u << (_levelCount - level - 1)}).all(),
+        "Shaders::TerrainQuadtree::setTile(): tile" << coordinates << "out of range for level" << level, *this);
+    CORRADE_ASSERT(layer >= 0,
+        "Shaders::TerrainQuadtree::setTile(): expected non-negative layer, got" << layer, *this);
+    _tiles[tileKey(level, coordinates)] = layer;
+    return *this;
+}
+
+TerrainQuadtree& TerrainQuadtree::removeTile(const UnsignedInt level, const Vector2ui& coordinates) {
+    _tiles.erase(tileKey(level, coordinates));
+    return *this;
+}
+
+TerrainQuadtree& TerrainQuadtree::select(const Vector3& cameraPosition, const Frustum& frustum) {
+    _patches.clear();
+    _missingTiles.clear();
+
+    const UnsignedInt root = _levelCount - 1;
+    if(tileLayer(root, {}) == -1)
+        _missingTiles.push_back({root, {}});
+    else
+        selectNode(root, {}, cameraPosition, frustum);
+
+    /* Request the coarsest tiles first, as those are needed for refining
+       the finer ones */
+    std::stable_sort(_missingTiles.begin(), _missingTiles.end(), [](const TerrainTile& a, const TerrainTile& b) {
+        return a.level > b.level;
+    });
+
+    return *this;
+}
+
+void TerrainQuadtree::selectNode(const UnsignedInt level, const Vector2ui& coordinates, const Vector3& cameraPosition, const Frustum& frustum) {
+    const Float size = patchSize(level);
+    const Vector2 min = _origin + Vector2{coordinates}*size;
+    const Range3D box{{min.x(), _heightRange.x(), min.y()},
+                      {min.x() + size, _heightRange.y(), min.y() + size}};
+    if(!Math::Intersection::rangeFrustum(box, frustum)) return;
+
+    /* If the node is entirely outside of the range of the finer level, it's
+       drawn at this level. Vertices closer than the range are morphed to
+       the coarser level, so the children are not needed either. */
+    const Int layer = tileLayer(level, coordinates);
+    if(level == 0 || (Math::clamp(cameraPosition, box.min(), box.max()) - cameraPosition).dot() >= Math::pow<2>(_detailDistance*Float(1u << (level - 1)))) {
+        addPatch(level, coordinates, layer);
+        return;
+    }
+
+    /* Refine only if all children can be drawn, otherwise request the
+       missing tiles and draw this node at its level */
+    const Vector2ui children[]{
+        coordinates*2u,
+        coordinates*2u + Vector2ui{1, 0},
+        coordinates*2u + Vector2ui{0, 1},
+        coordinates*2u + Vector2ui{1, 1}};
+    bool allResident = true;
+    for(const Vector2ui& child: children) if(tileLayer(level - 1, child) == -1) {
+        _missingTiles.push_back({level - 1, child});
+        allResident = false;
+    }
+    if(!allResident) {
+        addPatch(level, coordinates, layer);
+        return;
+    }
+
+    for(const Vector2ui& child: children)
+        selectNode(level - 1, child, cameraPosition, frustum);
+}
+
+void TerrainQuadtree::addPatch(const UnsignedInt level, const Vector2ui& coordinates, const Int layer) {
+    const Float size = patchSize(level);
+    const Float range = _detailDistance*Float(1u << level);
+
+    TerrainPatch patch;
+    patch.offsetSize = {_origin + Vector2{coordinates}*size, size};
+    patch.morphRange = {range*_morphStart, range};
+    if(_tileResolution) {
+        const Float texel = 1.0f/Float(_tileResolution);
+        patch.tileTextureTransformation = {texel*0.5f, texel*0.5f, 1.0f - texel, Float(layer)};
+    } else patch.tileTextureTransformation = {0.0f, 0.0f, 1.0f, Float(layer)};
+    _patches.push_back(patch);
+}
+
+}}
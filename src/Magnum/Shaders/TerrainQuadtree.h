@@ -0,0 +1,296 @@
+#ifndef Magnum_Shaders_TerrainQuadtree_h
+#define Magnum_Shaders_TerrainQuadtree_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::TerrainQuadtree, struct @ref Magnum::Shaders::TerrainPatch
+ */
+
+#include <unordered_map>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Terrain patch
+
+Per-instance data of one patch selected by @ref TerrainQuadtree, laid out to
+be directly uploaded to a buffer and used with the instanced attributes of
+the @ref Terrain shader.
+*/
+struct TerrainPatch {
+    /**
+     * @brief Patch offset and size
+     *
+     * Offset of the patch minimal corner in the world XZ plane in the first
+     * two components, patch size in the third. Corresponds to
+     * @ref Terrain::PatchOffsetSize.
+     */
+    Vector3 offsetSize;
+
+    /**
+     * @brief Morph range
+     *
+     * Camera distance at which the patch starts to morph to the resolution
+     * of the next coarser level and distance at which the morph is complete.
+     * Corresponds to @ref Terrain::MorphRange.
+     */
+    Vector2 morphRange;
+
+    /**
+     * @brief Tile texture transformation
+     *
+     * Offset of the patch in the heightmap tile in the first two
+     * components, scale in the third and texture array layer of the tile in
+     * the fourth. Corresponds to @ref Terrain::TileTextureTransformation.
+     */
+    Vector4 tileTextureTransformation;
+};
+
+/**
+@brief Terrain tile
+
+Identifies a heightmap tile requested by @ref TerrainQuadtree::missingTiles().
+*/
+struct TerrainTile {
+    /** @brief Quadtree level, @cpp 0 @ce being the finest */
+    UnsignedInt level;
+
+    /** @brief Tile coordinates in given level */
+    Vector2ui coordinates;
+};
+
+/**
+@brief Continuous distance-dependent level of detail terrain quadtree
+
+Selects terrain patches to draw with the @ref Terrain shader each frame,
+implementing the CDLOD algorithm. The terrain is a square in the XZ plane,
+split into a quadtree with @ref levelCount() levels, the finest level
+@cpp 0 @ce having @f$ 2^{l - 1} \times 2^{l - 1} @f$ patches and the
+coarsest level being a single patch covering the whole terrain. All patches
+are drawn with the same grid mesh, so each coarser level has half the
+resolution of the previous one.
+
+Level @f$ i @f$ is used up to @f$ d 2^i @f$ from the camera, where @f$ d @f$
+is @ref detailDistance(), and vertices of each patch are gradually morphed to
+the resolution of the next coarser level before reaching that distance, so
+there are no popping artifacts or cracks between patches of different
+levels. Patches outside of the view frustum are culled, using
+@ref heightRange() for their vertical extent.
+
+@section Shaders-TerrainQuadtree-tiles Heightmap tile streaming
+
+Each quadtree node has its own heightmap tile, stored in a layer of a
+@ref GL::Texture2DArray bound with @ref Terrain::bindHeightmapTexture(). The
+quadtree only refines a node if all its children have a tile resident,
+otherwise the node is drawn at its level and the missing tiles are listed in
+@ref missingTiles(), coarsest first. The application is then expected to
+load the tiles for example on a background thread, upload them through
+@ref GL::TextureUploader and mark them as resident using @ref setTile(). Once
+a tile is evicted from the texture array, it should be marked as such using
+@ref removeTile(). The root tile is required for drawing anything. Thanks to
+this the draw cost is given only by the view distance and
+@ref detailDistance() and doesn't depend on the terrain size. Note that while
+a node is drawn at a coarser level because of missing tiles, small cracks may
+appear on its edges.
+
+@code{.cpp}
+Shaders::TerrainQuadtree quadtree{{-4096.0f, -4096.0f}, 8192.0f, 8};
+quadtree.setHeightRange({-50.0f, 800.0f})
+    .setDetailDistance(64.0f)
+    .setTileResolution(129);
+
+// each frame
+quadtree.select(cameraPosition, Frustum::fromMatrix(viewProjection));
+for(const Shaders::TerrainTile& tile: quadtree.missingTiles())
+    requestTile(tile); // calls quadtree.setTile() once it's uploaded
+
+instanceBuffer.setData(quadtree.patches(), GL::BufferUsage::StreamDraw);
+patchMesh.setInstanceCount(quadtree.patches().size());
+shader.setTransformationProjectionMatrix(viewProjection)
+    .setCameraPosition(cameraPosition)
+    .bindHeightmapTexture(tiles);
+patchMesh.draw(shader);
+@endcode
+*/
+class MAGNUM_SHADERS_EXPORT TerrainQuadtree {
+    public:
+        /**
+         * @brief Constructor
+         * @param origin        Minimal corner of the terrain in the XZ plane
+         * @param size          Terrain size
+         * @param levelCount    Quadtree level count
+         *
+         * Expects that @p levelCount is between @cpp 1 @ce and
+         * @cpp 16 @ce and @p size is positive.
+         */
+        explicit TerrainQuadtree(const Vector2& origin, Float size, UnsignedInt levelCount);
+
+        /** @brief Minimal corner of the terrain in the XZ plane */
+        Vector2 origin() const { return _origin; }
+
+        /** @brief Terrain size */
+        Float size() const { return _size; }
+
+        /** @brief Quadtree level count */
+        UnsignedInt levelCount() const { return _levelCount; }
+
+        /** @brief Size of a patch in given level */
+        Float patchSize(UnsignedInt level) const;
+
+        /** @brief Height range */
+        Vector2 heightRange() const { return _heightRange; }
+
+        /**
+         * @brief Set height range
+         * @return Reference to self (for method chaining)
+         *
+         * Minimal and maximal terrain height, used for frustum culling. Should
+         * be the same as @ref Terrain::setHeightRange(). Default is
+         * @cpp {0.0f, 1.0f} @ce.
+         */
+        TerrainQuadtree& setHeightRange(const Vector2& range);
+
+        /** @brief Detail distance */
+        Float detailDistance() const { return _detailDistance; }
+
+        /**
+         * @brief Set detail distance
+         * @return Reference to self (for method chaining)
+         *
+         * Distance up to which the finest level is used, each next level is
+         * used up to twice the distance of the previous one. In order to
+         * avoid cracks, it should be larger than about 1.5 times the
+         * diagonal of the finest patch. Default is two times the finest
+         * @ref patchSize(). Expects that the value is positive.
+         */
+        TerrainQuadtree& setDetailDistance(Float distance);
+
+        /** @brief Morph start ratio */
+        Float morphStart() const { return _morphStart; }
+
+        /**
+         * @brief Set morph start ratio
+         * @return Reference to self (for method chaining)
+         *
+         * Fraction of the level range at which the patch vertices start to
+         * morph to the next coarser level. Default is @cpp 0.7f @ce. Expects
+         * that the value is in range @f$ [0, 1) @f$.
+         */
+        TerrainQuadtree& setMorphStart(Float ratio);
+
+        /** @brief Tile resolution */
+        Int tileResolution() const { return _tileResolution; }
+
+        /**
+         * @brief Set tile resolution
+         * @return Reference to self (for method chaining)
+         *
+         * If non-zero, @ref TerrainPatch::tileTextureTransformation is
+         * adjusted so patch edges map to centers of the edge texels of a
+         * tile with given size, meaning neighboring tiles are expected to
+         * share the edge texels. Default is @cpp 0 @ce, i.e. the patch
+         * edges map to the tile edges.
+         */
+        TerrainQuadtree& setTileResolution(Int resolution);
+
+        /**
+         * @brief Layer of a heightmap tile
+         *
+         * Returns @cpp -1 @ce if the tile is not resident.
+         * @see @ref setTile(), @ref removeTile()
+         */
+        Int tileLayer(UnsignedInt level, const Vector2ui& coordinates) const;
+
+        /**
+         * @brief Mark a heightmap tile as resident
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p level is less than @ref levelCount() and the
+         * coordinates are in range for given level.
+         */
+        TerrainQuadtree& setTile(UnsignedInt level, const Vector2ui& coordinates, Int layer);
+
+        /**
+         * @brief Mark a heightmap tile as not resident
+         * @return Reference to self (for method chaining)
+         */
+        TerrainQuadtree& removeTile(UnsignedInt level, const Vector2ui& coordinates);
+
+        /**
+         * @brief Select patches to draw
+         * @param cameraPosition    Camera position in world space
+         * @param frustum           View frustum in world space
+         * @return Reference to self (for method chaining)
+         *
+         * Fills @ref patches() and @ref missingTiles().
+         */
+        TerrainQuadtree& select(const Vector3& cameraPosition, const Frustum& frustum);
+
+        /**
+         * @brief Selected patches
+         *
+         * Patches selected in last @ref select() call.
+         */
+        Containers::ArrayView<const TerrainPatch> patches() const {
+            return {_patches.data(), _patches.size()};
+        }
+
+        /**
+         * @brief Missing tiles
+         *
+         * Tiles that were needed for refining the quadtree in last
+         * @ref select() call but are not resident, coarsest first.
+         */
+        Containers::ArrayView<const TerrainTile> missingTiles() const {
+            return {_missingTiles.data(), _missingTiles.size()};
+        }
+
+    private:
+        void selectNode(UnsignedInt level, const Vector2ui& coordinates, const Vector3& cameraPosition, const Frustum& frustum);
+        void addPatch(UnsignedInt level, const Vector2ui& coordinates, Int layer);
+
+        Vector2 _origin;
+        Float _size;
+        UnsignedInt _levelCount;
+        Vector2 _heightRange{0.0f, 1.0f};
+        Float _detailDistance, _morphStart{0.7f};
+        Int _tileResolution{};
+        std::unordered_map<UnsignedLong, Int> _tiles;
+        std::vector<TerrainPatch> _patches;
+        std::vector<TerrainTile> _missingTiles;
+};
+
+}}
+
+#endif
@@ -0,0 +1,158 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/DeferredLight.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+using namespace Math::Literals;
+
+struct DeferredLightGLTest: GL::OpenGLTester {
+    explicit DeferredLightGLTest();
+
+    void construct();
+    void constructMove();
+
+    void setUniforms();
+    void bindTextures();
+
+    void setLightRangeDirectional();
+    void setAmbientColorPoint();
+};
+
+constexpr struct {
+    const char* name;
+    DeferredLight::Flags flags;
+} ConstructData[]{
+    {"point", {}},
+    {"directional", DeferredLight::Flag::Directional}
+};
+
+DeferredLightGLTest::DeferredLightGLTest() {
+    addInstancedTests({&DeferredLightGLTest::construct,
+                       &DeferredLightGLTest::setUniforms},
+        Containers::arraySize(ConstructData));
+
+    addTests({&DeferredLightGLTest::constructMove,
+
+              &DeferredLightGLTest::bindTextures,
+
+              &DeferredLightGLTest::setLightRangeDirectional,
+              &DeferredLightGLTest::setAmbientColorPoint});
+}
+
+void DeferredLightGLTest::construct() {
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    DeferredLight shader{data.flags};
+    CORRADE_COMPARE(shader.flags(), data.flags);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void DeferredLightGLTest::constructMove() {
+    DeferredLight a{DeferredLight::Flag::Directional};
+    const GLuint id = a.id();
+    CORRADE_VERIFY(id);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    DeferredLight b{std::move(a)};
+    CORRADE_COMPARE(b.id(), id);
+    CORRADE_COMPARE(b.flags(), DeferredLight::Flag::Directional);
+    CORRADE_VERIFY(!a.id());
+
+    DeferredLight c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(c.id(), id);
+    CORRADE_COMPARE(c.flags(), DeferredLight::Flag::Directional);
+    CORRADE_VERIFY(!b.id());
+}
+
+void DeferredLightGLTest::setUniforms() {
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    DeferredLight shader{data.flags};
+    shader.setProjectionMatrix(Matrix4::perspectiveProjection(35.0_degf, 1.0f, 0.1f, 100.0f))
+        .setLightPosition({1.0f, 2.0f, -3.0f})
+        .setLightColor(Color3{0.5f});
+    if(data.flags & DeferredLight::Flag::Directional)
+        shader.setAmbientColor(Color3{0.1f});
+    else
+        shader.setLightRange(10.0f);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void DeferredLightGLTest::bindTextures() {
+    GL::Texture2D albedo, normal, depth;
+    albedo.setStorage(1, GL::TextureFormat::RGBA8, {4, 4});
+    normal.setStorage(1, GL::TextureFormat::RGB10A2, {4, 4});
+    depth.setStorage(1, GL::TextureFormat::DepthComponent24, {4, 4});
+
+    DeferredLight shader;
+    shader.bindAlbedoTexture(albedo)
+        .bindNormalTexture(normal)
+        .bindDepthTexture(depth);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void DeferredLightGLTest::setLightRangeDirectional() {
+    DeferredLight shader{DeferredLight::Flag::Directional};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.setLightRange(1.0f);
+    CORRADE_COMPARE(out.str(), "Shaders::DeferredLight::setLightRange(): the shader was created with a directional light\n");
+}
+
+void DeferredLightGLTest::setAmbientColorPoint() {
+    DeferredLight shader;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.setAmbientColor(Color3{0.1f});
+    CORRADE_COMPARE(out.str(), "Shaders::DeferredLight::setAmbientColor(): the shader was not created with a directional light\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::DeferredLightGLTest)
@@ -23,7 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Magnum/GL/Context.h"
 #include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Version.h"
 #include "Magnum/Shaders/DistanceFieldVector.h"
 
 namespace Magnum { namespace Shaders { namespace Test {
@@ -33,6 +35,14 @@ struct DistanceFieldVectorGLTest: GL::OpenGLTester {
 
     void construct2D();
     void construct3D();
+    void constructVertexColor2D();
+    void constructVertexColor3D();
+    void constructMultiChannel2D();
+    void constructMultiChannel3D();
+    #ifndef MAGNUM_TARGET_GLES2
+    void constructTextureArrays2D();
+    void constructTextureArrays3D();
+    #endif
 
     void constructMove2D();
     void constructMove3D();
@@ -41,6 +51,14 @@ struct DistanceFieldVectorGLTest: GL::OpenGLTester {
 DistanceFieldVectorGLTest::DistanceFieldVectorGLTest() {
     addTests({&DistanceFieldVectorGLTest::construct2D,
               &DistanceFieldVectorGLTest::construct3D,
+              &DistanceFieldVectorGLTest::constructVertexColor2D,
+              &DistanceFieldVectorGLTest::constructVertexColor3D,
+              &DistanceFieldVectorGLTest::constructMultiChannel2D,
+              &DistanceFieldVectorGLTest::constructMultiChannel3D,
+              #ifndef MAGNUM_TARGET_GLES2
+              &DistanceFieldVectorGLTest::constructTextureArrays2D,
+              &DistanceFieldVectorGLTest::constructTextureArrays3D,
+              #endif
 
               &DistanceFieldVectorGLTest::constructMove2D,
               &DistanceFieldVectorGLTest::constructMove3D});
@@ -68,6 +86,90 @@ void DistanceFieldVectorGLTest::construct3D() {
     }
 }
 
+void DistanceFieldVectorGLTest::constructVertexColor2D() {
+    DistanceFieldVector2D shader{DistanceFieldVector2D::Flag::VertexColor};
+    CORRADE_COMPARE(shader.flags(), DistanceFieldVector2D::Flag::VertexColor);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void DistanceFieldVectorGLTest::constructVertexColor3D() {
+    DistanceFieldVector3D shader{DistanceFieldVector3D::Flag::VertexColor};
+    CORRADE_COMPARE(shader.flags(), DistanceFieldVector3D::Flag::VertexColor);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void DistanceFieldVectorGLTest::constructMultiChannel2D() {
+    DistanceFieldVector2D shader{DistanceFieldVector2D::Flag::MultiChannel};
+    CORRADE_COMPARE(shader.flags(), DistanceFieldVector2D::Flag::MultiChannel);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void DistanceFieldVectorGLTest::constructMultiChannel3D() {
+    DistanceFieldVector3D shader{DistanceFieldVector3D::Flag::MultiChannel|DistanceFieldVector3D::Flag::VertexColor};
+    CORRADE_COMPARE(shader.flags(), DistanceFieldVector3D::Flag::MultiChannel|DistanceFieldVector3D::Flag::VertexColor);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void DistanceFieldVectorGLTest::constructTextureArrays2D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isVersionSupported(GL::Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+    #endif
+
+    DistanceFieldVector2D shader{DistanceFieldVector2D::Flag::TextureArrays};
+    CORRADE_COMPARE(shader.flags(), DistanceFieldVector2D::Flag::TextureArrays);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void DistanceFieldVectorGLTest::constructTextureArrays3D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isVersionSupported(GL::Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+    #endif
+
+    DistanceFieldVector3D shader{DistanceFieldVector3D::Flag::TextureArrays|DistanceFieldVector3D::Flag::MultiChannel};
+    CORRADE_COMPARE(shader.flags(), DistanceFieldVector3D::Flag::TextureArrays|DistanceFieldVector3D::Flag::MultiChannel);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+#endif
+
 void DistanceFieldVectorGLTest::constructMove2D() {
     DistanceFieldVector2D a;
     const GLuint id = a.id();
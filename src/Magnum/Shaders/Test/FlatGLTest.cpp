@@ -39,6 +39,7 @@ struct FlatGLTest: GL::OpenGLTester {
     explicit FlatGLTest();
 
     template<UnsignedInt dimensions> void construct();
+    template<UnsignedInt dimensions> void constructDepthOnlyInvalid();
 
     template<UnsignedInt dimensions> void constructMove();
 
@@ -56,7 +57,12 @@ constexpr struct {
     Flat2D::Flags flags;
 } ConstructData[]{
     {"", {}},
-    {"textured", Flat2D::Flag::Textured}
+    {"textured", Flat2D::Flag::Textured},
+    {"vertex color", Flat2D::Flag::VertexColor},
+    {"instanced transformation", Flat2D::Flag::InstancedTransformation},
+    {"instanced transformation + vertex color + textured", Flat2D::Flag::InstancedTransformation|Flat2D::Flag::VertexColor|Flat2D::Flag::Textured},
+    {"depth only", Flat2D::Flag::DepthOnly},
+    {"depth only + instanced transformation", Flat2D::Flag::DepthOnly|Flat2D::Flag::InstancedTransformation}
 };
 
 }
@@ -68,6 +74,9 @@ FlatGLTest::FlatGLTest() {
         Containers::arraySize(ConstructData));
 
     addTests<FlatGLTest>({
+        &FlatGLTest::constructDepthOnlyInvalid<2>,
+        &FlatGLTest::constructDepthOnlyInvalid<3>,
+
         &FlatGLTest::constructMove<2>,
         &FlatGLTest::constructMove<3>,
 
@@ -99,6 +108,16 @@ template<UnsignedInt dimensions> void FlatGLTest::construct() {
     }
 }
 
+template<UnsignedInt dimensions> void FlatGLTest::constructDepthOnlyInvalid() {
+    setTestCaseName(Utility::formatString("constructDepthOnlyInvalid<{}>", dimensions));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Flat<dimensions>{Flat<dimensions>::Flag::DepthOnly|Flat<dimensions>::Flag::Textured};
+    CORRADE_COMPARE(out.str(), "Shaders::Flat: depth-only rendering can be combined only with instanced transformation\n");
+}
+
 template<UnsignedInt dimensions> void FlatGLTest::constructMove() {
     setTestCaseName(Utility::formatString("constructMove<{}>", dimensions));
 
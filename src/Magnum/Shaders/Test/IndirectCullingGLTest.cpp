@@ -0,0 +1,276 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/IndirectCulling.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct IndirectCullingGLTest: GL::OpenGLTester {
+    explicit IndirectCullingGLTest();
+
+    void construct();
+    void constructOcclusionCulling();
+    void constructMove();
+
+    void cullFrustum();
+    void cullOcclusion();
+    void cullEmpty();
+
+    void bindDepthPyramidNotEnabled();
+};
+
+IndirectCullingGLTest::IndirectCullingGLTest() {
+    addTests({&IndirectCullingGLTest::construct,
+              &IndirectCullingGLTest::constructOcclusionCulling,
+              &IndirectCullingGLTest::constructMove,
+
+              &IndirectCullingGLTest::cullFrustum,
+              &IndirectCullingGLTest::cullOcclusion,
+              &IndirectCullingGLTest::cullEmpty,
+
+              &IndirectCullingGLTest::bindDepthPyramidNotEnabled});
+}
+
+namespace {
+    bool isSupported() {
+        return GL::Context::current().isVersionSupported(GL::Version::GL430);
+    }
+
+    const Matrix4 Projection = Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f);
+
+    Containers::Array<UnsignedInt> instanceCounts(GL::Buffer& buffer) {
+        Containers::Array<char> data = buffer.data();
+        const auto commands = Containers::arrayCast<const GL::DrawElementsIndirectCommand>(data);
+        Containers::Array<UnsignedInt> out{commands.size()};
+        for(std::size_t i = 0; i != commands.size(); ++i)
+            out[i] = commands[i].instanceCount;
+        return out;
+    }
+
+    /* A min/max pyramid in the layout produced by
+       TextureTools::depthPyramid(), with the nearest depth in the red and the
+       farthest depth in the green channel of each level. Uploaded directly
+       to avoid depending on the TextureTools library. */
+    GL::Texture2D pyramidTexture(const Vector2i& size, std::initializer_list<Containers::ArrayView<const Vector2>> levels) {
+        GL::Texture2D pyramid;
+        pyramid.setMinificationFilter(GL::SamplerFilter::Nearest, GL::SamplerMipmap::Nearest)
+            .setMagnificationFilter(GL::SamplerFilter::Nearest)
+            .setWrapping(GL::SamplerWrapping::ClampToEdge)
+            .setStorage(Int(levels.size()), GL::TextureFormat::RG32F, size);
+        Int level = 0;
+        for(Containers::ArrayView<const Vector2> data: levels) {
+            pyramid.setSubImage(level, {}, ImageView2D{GL::PixelFormat::RG, GL::PixelType::Float, Math::max(size >> level, Vector2i{1}), data});
+            ++level;
+        }
+        return pyramid;
+    }
+}
+
+void IndirectCullingGLTest::construct() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    IndirectCulling shader;
+    CORRADE_COMPARE(shader.flags(), IndirectCulling::Flags{});
+    CORRADE_VERIFY(shader.id());
+    CORRADE_VERIFY(shader.validate().first);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void IndirectCullingGLTest::constructOcclusionCulling() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    IndirectCulling shader{IndirectCulling::Flag::OcclusionCulling};
+    CORRADE_COMPARE(shader.flags(), IndirectCulling::Flag::OcclusionCulling);
+    CORRADE_VERIFY(shader.id());
+    CORRADE_VERIFY(shader.validate().first);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void IndirectCullingGLTest::constructMove() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    IndirectCulling a{IndirectCulling::Flag::OcclusionCulling};
+    const GLuint id = a.id();
+    CORRADE_VERIFY(id);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    IndirectCulling b{std::move(a)};
+    CORRADE_COMPARE(b.id(), id);
+    CORRADE_COMPARE(b.flags(), IndirectCulling::Flag::OcclusionCulling);
+    CORRADE_VERIFY(!a.id());
+
+    IndirectCulling c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(c.id(), id);
+    CORRADE_COMPARE(c.flags(), IndirectCulling::Flag::OcclusionCulling);
+    CORRADE_VERIFY(!b.id());
+}
+
+void IndirectCullingGLTest::cullFrustum() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    const Vector4 bounds[]{
+        {0.0f, 0.0f, -5.0f, 1.0f},  /* in front of the camera */
+        {0.0f, 0.0f, 5.0f, 1.0f},   /* behind the camera */
+        {20.0f, 0.0f, -5.0f, 1.0f}, /* far to the right */
+        {5.5f, 0.0f, -5.0f, 1.0f}   /* intersecting the right plane */
+    };
+    const GL::DrawElementsIndirectCommand commands[]{
+        {36, 1, 0, 0, 0},
+        {36, 2, 36, 8, 1},
+        {36, 3, 72, 16, 3},
+        {36, 4, 108, 24, 6}
+    };
+
+    GL::Buffer boundsBuffer, commandBuffer, outputBuffer;
+    boundsBuffer.setData(bounds);
+    commandBuffer.setData(commands);
+    outputBuffer.setData({nullptr, sizeof(commands)});
+
+    IndirectCulling shader;
+    shader.setViewProjectionMatrix(Projection)
+        .bindBoundsBuffer(boundsBuffer)
+        .bindCommandBuffer(commandBuffer)
+        .bindOutputCommandBuffer(outputBuffer)
+        .cull(4);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE_AS(instanceCounts(outputBuffer),
+        (Containers::Array<UnsignedInt>{Containers::InPlaceInit, {1, 0, 0, 4}}),
+        TestSuite::Compare::Container);
+
+    /* The rest of the command is copied unchanged */
+    Containers::Array<char> data = outputBuffer.data();
+    const auto output = Containers::arrayCast<const GL::DrawElementsIndirectCommand>(data);
+    CORRADE_COMPARE(output[2].count, 36);
+    CORRADE_COMPARE(output[2].firstIndex, 72);
+    CORRADE_COMPARE(output[2].baseVertex, 16);
+    CORRADE_COMPARE(output[2].baseInstance, 3);
+}
+
+void IndirectCullingGLTest::cullOcclusion() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    /* Left half of the screen is covered by an occluder at depth 0.5, right
+       half is empty */
+    const Vector2 level0[]{
+        {0.5f, 0.5f}, {0.5f, 0.5f}, {1.0f, 1.0f}, {1.0f, 1.0f},
+        {0.5f, 0.5f}, {0.5f, 0.5f}, {1.0f, 1.0f}, {1.0f, 1.0f},
+        {0.5f, 0.5f}, {0.5f, 0.5f}, {1.0f, 1.0f}, {1.0f, 1.0f},
+        {0.5f, 0.5f}, {0.5f, 0.5f}, {1.0f, 1.0f}, {1.0f, 1.0f}
+    };
+    const Vector2 level1[]{
+        {0.5f, 0.5f}, {1.0f, 1.0f},
+        {0.5f, 0.5f}, {1.0f, 1.0f}
+    };
+    const Vector2 level2[]{{0.5f, 1.0f}};
+
+    const Vector4 bounds[]{
+        {0.0f, 0.0f, -2.0f, 0.5f},      /* in front of the occluder */
+        {-20.0f, 0.0f, -50.0f, 1.0f},   /* behind the occluder */
+        {20.0f, 0.0f, -50.0f, 1.0f},    /* far, but not occluded */
+        {0.0f, 0.0f, -0.5f, 1.0f}       /* intersecting the near plane */
+    };
+    const GL::DrawElementsIndirectCommand commands[]{
+        {36, 1, 0, 0, 0},
+        {36, 1, 0, 0, 1},
+        {36, 1, 0, 0, 2},
+        {36, 1, 0, 0, 3}
+    };
+
+    GL::Texture2D pyramid = pyramidTexture({4, 4}, {level0, level1, level2});
+
+    GL::Buffer boundsBuffer, commandBuffer, outputBuffer;
+    boundsBuffer.setData(bounds);
+    commandBuffer.setData(commands);
+    outputBuffer.setData({nullptr, sizeof(commands)});
+
+    IndirectCulling shader{IndirectCulling::Flag::OcclusionCulling};
+    shader.setViewProjectionMatrix(Projection)
+        .bindDepthPyramid(pyramid, {4, 4})
+        .bindBoundsBuffer(boundsBuffer)
+        .bindCommandBuffer(commandBuffer)
+        .bindOutputCommandBuffer(outputBuffer)
+        .cull(4);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE_AS(instanceCounts(outputBuffer),
+        (Containers::Array<UnsignedInt>{Containers::InPlaceInit, {1, 0, 1, 1}}),
+        TestSuite::Compare::Container);
+}
+
+void IndirectCullingGLTest::cullEmpty() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    IndirectCulling shader;
+    shader.cull(0);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void IndirectCullingGLTest::bindDepthPyramidNotEnabled() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    GL::Texture2D pyramid;
+    IndirectCulling shader;
+    shader.bindDepthPyramid(pyramid, {4, 4});
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::IndirectCulling::bindDepthPyramid(): the shader was not created with occlusion culling enabled\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::IndirectCullingGLTest)
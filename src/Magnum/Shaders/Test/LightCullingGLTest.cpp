@@ -0,0 +1,176 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/LightCulling.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct LightCullingGLTest: GL::OpenGLTester {
+    explicit LightCullingGLTest();
+
+    void construct();
+    void constructMove();
+
+    void cull();
+    void cullEmpty();
+};
+
+LightCullingGLTest::LightCullingGLTest() {
+    addTests({&LightCullingGLTest::construct,
+              &LightCullingGLTest::constructMove,
+
+              &LightCullingGLTest::cull,
+              &LightCullingGLTest::cullEmpty});
+}
+
+namespace {
+    bool isSupported() {
+        return GL::Context::current().isVersionSupported(GL::Version::GL430);
+    }
+
+    UnsignedInt clusterId(const Vector3i& cluster) {
+        const Vector3i count = LightCulling::clusterCount();
+        return (cluster.z()*count.y() + cluster.y())*count.x() + cluster.x();
+    }
+
+    /* Light count and the light indices for given cluster */
+    Containers::Array<UnsignedInt> clusterLights(GL::Buffer& buffer, const Vector3i& cluster) {
+        Containers::Array<char> data = buffer.data();
+        const auto clusters = Containers::arrayCast<const UnsignedInt>(data);
+        const std::size_t offset = clusterId(cluster)*(LightCulling::maxLightsPerCluster() + 1);
+        Containers::Array<UnsignedInt> out{clusters[offset]};
+        for(std::size_t i = 0; i != out.size(); ++i)
+            out[i] = clusters[offset + 1 + i];
+        return out;
+    }
+
+    const Matrix4 Projection = Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f);
+}
+
+void LightCullingGLTest::construct() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    LightCulling shader;
+    CORRADE_VERIFY(shader.id());
+    CORRADE_VERIFY(shader.validate().first);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void LightCullingGLTest::constructMove() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    LightCulling a;
+    const GLuint id = a.id();
+    CORRADE_VERIFY(id);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    LightCulling b{std::move(a)};
+    CORRADE_COMPARE(b.id(), id);
+    CORRADE_VERIFY(!a.id());
+
+    LightCulling c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(c.id(), id);
+    CORRADE_VERIFY(!b.id());
+}
+
+void LightCullingGLTest::cull() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    /* The first light is in the screen center at depth 5, which is slice
+       log(5)/log(100)*24 = 8.4, the second is small and in the top right
+       corner close to the far plane, the third is behind the camera */
+    const LightCulling::Light lightData[]{
+        {{0.0f, 0.0f, -5.0f, 0.5f}, Color4{1.0f}},
+        {{85.0f, 85.0f, -90.0f, 1.0f}, Color4{1.0f}},
+        {{0.0f, 0.0f, 5.0f, 1.0f}, Color4{1.0f}}
+    };
+
+    GL::Buffer lights, clusters;
+    lights.setData(lightData);
+    clusters.setData({nullptr, LightCulling::clusterBufferSize()});
+
+    LightCulling shader;
+    shader.setProjectionMatrix(Projection)
+        .bindLightBuffer(lights)
+        .bindClusterBuffer(clusters)
+        .cull(Containers::arraySize(lightData));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    {
+        Containers::Array<UnsignedInt> lights = clusterLights(clusters, {8, 4, 8});
+        CORRADE_COMPARE(lights.size(), 1);
+        CORRADE_COMPARE(lights[0], 0);
+    } {
+        Containers::Array<UnsignedInt> lights = clusterLights(clusters, {15, 8, 23});
+        CORRADE_COMPARE(lights.size(), 1);
+        CORRADE_COMPARE(lights[0], 1);
+    } {
+        Containers::Array<UnsignedInt> lights = clusterLights(clusters, {0, 0, 0});
+        CORRADE_COMPARE(lights.size(), 0);
+    } {
+        /* Same tile as the first light, but much further */
+        Containers::Array<UnsignedInt> lights = clusterLights(clusters, {8, 4, 20});
+        CORRADE_COMPARE(lights.size(), 0);
+    }
+}
+
+void LightCullingGLTest::cullEmpty() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    /* Fill the buffer with garbage to verify the counts get reset */
+    Containers::Array<UnsignedInt> garbage{Containers::DirectInit, LightCulling::clusterBufferSize()/4, 0xdeadbeefu};
+    GL::Buffer lights, clusters;
+    lights.setData({nullptr, sizeof(LightCulling::Light)});
+    clusters.setData(garbage);
+
+    LightCulling shader;
+    shader.bindLightBuffer(lights)
+        .bindClusterBuffer(clusters)
+        .cull(0);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(clusterLights(clusters, {0, 0, 0}).size(), 0);
+    CORRADE_COMPARE(clusterLights(clusters, {8, 4, 8}).size(), 0);
+    CORRADE_COMPARE(clusterLights(clusters, {15, 8, 23}).size(), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::LightCullingGLTest)
@@ -0,0 +1,81 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Shaders/LightCulling.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct LightCullingTest: TestSuite::Tester {
+    explicit LightCullingTest();
+
+    void constructNoCreate();
+    void constructCopy();
+
+    void lightLayout();
+    void clusterBufferSize();
+};
+
+LightCullingTest::LightCullingTest() {
+    addTests({&LightCullingTest::constructNoCreate,
+              &LightCullingTest::constructCopy,
+
+              &LightCullingTest::lightLayout,
+              &LightCullingTest::clusterBufferSize});
+}
+
+void LightCullingTest::constructNoCreate() {
+    {
+        LightCulling shader{NoCreate};
+        CORRADE_COMPARE(shader.id(), 0);
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void LightCullingTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<LightCulling, const LightCulling&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<LightCulling, const LightCulling&>{}));
+}
+
+void LightCullingTest::lightLayout() {
+    /* Has to match the std430 layout in the shaders */
+    CORRADE_COMPARE(sizeof(LightCulling::Light), 32);
+
+    constexpr LightCulling::Light light{{1.0f, 2.0f, 3.0f, 4.0f}, {0.5f, 0.25f, 0.125f}};
+    CORRADE_COMPARE(light.position, (Vector4{1.0f, 2.0f, 3.0f, 4.0f}));
+    CORRADE_COMPARE(light.color, (Color4{0.5f, 0.25f, 0.125f}));
+}
+
+void LightCullingTest::clusterBufferSize() {
+    constexpr std::size_t size = LightCulling::clusterBufferSize();
+    CORRADE_COMPARE(size, 16*9*24*128*4);
+    CORRADE_COMPARE(LightCulling::clusterCount(), (Vector3i{16, 9, 24}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::LightCullingTest)
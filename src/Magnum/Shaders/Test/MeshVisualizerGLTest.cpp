@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/OpenGLTester.h"
@@ -38,6 +40,8 @@ struct MeshVisualizerGLTest: GL::OpenGLTester {
     void constructWireframeGeometryShader();
     #endif
     void constructWireframeNoGeometryShader();
+    void constructWireframeBarycentric();
+    void constructBarycentricNoWireframe();
 
     void constructMove();
 };
@@ -48,6 +52,8 @@ MeshVisualizerGLTest::MeshVisualizerGLTest() {
               &MeshVisualizerGLTest::constructWireframeGeometryShader,
               #endif
               &MeshVisualizerGLTest::constructWireframeNoGeometryShader,
+              &MeshVisualizerGLTest::constructWireframeBarycentric,
+              &MeshVisualizerGLTest::constructBarycentricNoWireframe,
 
               &MeshVisualizerGLTest::constructMove});
 }
@@ -103,6 +109,34 @@ void MeshVisualizerGLTest::constructWireframeNoGeometryShader() {
     }
 }
 
+void MeshVisualizerGLTest::constructWireframeBarycentric() {
+    MeshVisualizer shader{MeshVisualizer::Flag::Wireframe|MeshVisualizer::Flag::NoGeometryShader|MeshVisualizer::Flag::BarycentricAttribute};
+    CORRADE_COMPARE(shader.flags(), MeshVisualizer::Flag::Wireframe|MeshVisualizer::Flag::NoGeometryShader|MeshVisualizer::Flag::BarycentricAttribute);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void MeshVisualizerGLTest::constructBarycentricNoWireframe() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshVisualizer a{MeshVisualizer::Flag::BarycentricAttribute};
+    #ifndef MAGNUM_TARGET_GLES2
+    MeshVisualizer b{MeshVisualizer::Flag::Wireframe|MeshVisualizer::Flag::BarycentricAttribute};
+    #endif
+    CORRADE_COMPARE(out.str(),
+        "Shaders::MeshVisualizer: barycentric attribute can be used only for wireframe rendering without a geometry shader\n"
+        #ifndef MAGNUM_TARGET_GLES2
+        "Shaders::MeshVisualizer: barycentric attribute can be used only for wireframe rendering without a geometry shader\n"
+        #endif
+        );
+}
+
 void MeshVisualizerGLTest::constructMove() {
     MeshVisualizer a{MeshVisualizer::Flag::Wireframe|MeshVisualizer::Flag::NoGeometryShader};
     const GLuint id = a.id();
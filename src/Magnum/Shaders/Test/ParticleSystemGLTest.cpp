@@ -0,0 +1,250 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shaders/ParticleSimulation.h"
+#include "Magnum/Shaders/Particles.h"
+#include "Magnum/Shaders/ParticleSystem.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+using namespace Math::Literals;
+
+struct ParticleSystemGLTest: GL::OpenGLTester {
+    explicit ParticleSystemGLTest();
+
+    void construct();
+    void constructMove();
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    void update();
+    #endif
+    void draw();
+
+    void setLifetimeInvalid();
+    void updateNoCreate();
+};
+
+ParticleSystemGLTest::ParticleSystemGLTest() {
+    addTests({&ParticleSystemGLTest::construct,
+              &ParticleSystemGLTest::constructMove,
+
+              #ifndef MAGNUM_TARGET_WEBGL
+              &ParticleSystemGLTest::update,
+              #endif
+              &ParticleSystemGLTest::draw,
+
+              &ParticleSystemGLTest::setLifetimeInvalid,
+              &ParticleSystemGLTest::updateNoCreate});
+}
+
+namespace {
+    bool isSupported() {
+        #ifndef MAGNUM_TARGET_GLES
+        return GL::Context::current().isExtensionSupported<GL::Extensions::ARB::transform_feedback2>() &&
+            GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>();
+        #else
+        return true;
+        #endif
+    }
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    Containers::Array<Vector4> particleData(GL::Buffer& buffer, UnsignedInt count) {
+        const auto mapped = Containers::arrayCast<const Vector4>(buffer.mapRead(0, 2*count*sizeof(Vector4)));
+        Containers::Array<Vector4> out{mapped.size()};
+        for(std::size_t i = 0; i != mapped.size(); ++i)
+            out[i] = mapped[i];
+        buffer.unmap();
+        return out;
+    }
+    #endif
+}
+
+void ParticleSystemGLTest::construct() {
+    if(!isSupported())
+        CORRADE_SKIP("Transform feedback or instanced arrays are not supported.");
+
+    ParticleSimulation simulation;
+    CORRADE_VERIFY(simulation.id());
+
+    Particles shader;
+    CORRADE_VERIFY(shader.id());
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(simulation.validate().first);
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    ParticleSystem particles{100, 2.0f};
+    CORRADE_COMPARE(particles.count(), 100);
+    CORRADE_VERIFY(particles.buffer().id());
+    CORRADE_COMPARE(particles.buffer().size(), Int(100*2*sizeof(Vector4)));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ParticleSystemGLTest::constructMove() {
+    if(!isSupported())
+        CORRADE_SKIP("Transform feedback or instanced arrays are not supported.");
+
+    ParticleSystem a{10, 1.0f};
+    const GLuint id = a.buffer().id();
+    CORRADE_VERIFY(id);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    ParticleSystem b{std::move(a)};
+    CORRADE_COMPARE(b.count(), 10);
+    CORRADE_COMPARE(b.buffer().id(), id);
+    CORRADE_COMPARE(a.count(), 0);
+    CORRADE_VERIFY(!a.buffer().id());
+
+    ParticleSystem c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(c.count(), 10);
+    CORRADE_COMPARE(c.buffer().id(), id);
+    CORRADE_COMPARE(b.count(), 0);
+    CORRADE_VERIFY(!b.buffer().id());
+}
+
+#ifndef MAGNUM_TARGET_WEBGL
+void ParticleSystemGLTest::update() {
+    if(!isSupported())
+        CORRADE_SKIP("Transform feedback or instanced arrays are not supported.");
+
+    /* Bind some FB to avoid errors on contexts w/o default FB */
+    GL::Renderbuffer color;
+    color.setStorage(GL::RenderbufferFormat::RGBA8, Vector2i{32});
+    GL::Framebuffer fb{{{}, Vector2i{32}}};
+    fb.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color)
+      .bind();
+
+    ParticleSimulation simulation;
+    simulation.setEmitterPosition({1.0f, 2.0f, 3.0f})
+        .setEmitterVelocity({0.0f, 1.0f, 0.0f})
+        .setEmitterSpread(0.0f)
+        .setLifetime(1.0f);
+
+    /* A single particle starts with age -1, so it gets emitted halfway
+       through the first step */
+    ParticleSystem particles{1, 1.0f};
+    particles.update(simulation, 1.5f);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    {
+        Containers::Array<Vector4> data = particleData(particles.buffer(), 1);
+        CORRADE_COMPARE(data[0], (Vector4{1.0f, 2.5f, 3.0f, 0.5f}));
+        CORRADE_COMPARE(data[1], (Vector4{0.0f, 1.0f, 0.0f, 1.0f}));
+    }
+
+    /* Live particle moves along its velocity */
+    particles.update(simulation, 0.25f);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    {
+        Containers::Array<Vector4> data = particleData(particles.buffer(), 1);
+        CORRADE_COMPARE(data[0], (Vector4{1.0f, 2.75f, 3.0f, 0.75f}));
+        CORRADE_COMPARE(data[1], (Vector4{0.0f, 1.0f, 0.0f, 1.0f}));
+    }
+
+    /* Dead particle gets re-emitted, keeping the remaining age */
+    particles.update(simulation, 0.5f);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    {
+        Containers::Array<Vector4> data = particleData(particles.buffer(), 1);
+        CORRADE_COMPARE(data[0], (Vector4{1.0f, 2.25f, 3.0f, 0.25f}));
+        CORRADE_COMPARE(data[1], (Vector4{0.0f, 1.0f, 0.0f, 1.0f}));
+    }
+}
+#endif
+
+void ParticleSystemGLTest::draw() {
+    if(!isSupported())
+        CORRADE_SKIP("Transform feedback or instanced arrays are not supported.");
+
+    GL::Renderbuffer color;
+    color.setStorage(GL::RenderbufferFormat::RGBA8, Vector2i{32});
+    GL::Framebuffer fb{{{}, Vector2i{32}}};
+    fb.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color)
+      .clear(GL::FramebufferClear::Color)
+      .bind();
+
+    ParticleSimulation simulation;
+    ParticleSystem particles{1000, 1.0f};
+    particles.update(simulation, 0.5f);
+
+    Particles shader;
+    shader.setParticleSize(0.1f)
+        .setColor(0xff0000ff_rgbaf);
+    particles.draw(shader);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ParticleSystemGLTest::setLifetimeInvalid() {
+    if(!isSupported())
+        CORRADE_SKIP("Transform feedback or instanced arrays are not supported.");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ParticleSimulation simulation;
+    simulation.setLifetime(0.0f);
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::ParticleSimulation::setLifetime(): expected a positive value, got 0\n");
+}
+
+void ParticleSystemGLTest::updateNoCreate() {
+    if(!isSupported())
+        CORRADE_SKIP("Transform feedback or instanced arrays are not supported.");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ParticleSimulation simulation;
+    Particles shader;
+    ParticleSystem particles{NoCreate};
+    particles.update(simulation, 1.0f)
+        .draw(shader);
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::ParticleSystem::update(): the particle system is moved-out or not created\n"
+        "Shaders::ParticleSystem::draw(): the particle system is moved-out or not created\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::ParticleSystemGLTest)
@@ -0,0 +1,70 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Shaders/ParticleSimulation.h"
+#include "Magnum/Shaders/Particles.h"
+#include "Magnum/Shaders/ParticleSystem.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ParticleSystemTest: TestSuite::Tester {
+    explicit ParticleSystemTest();
+
+    void constructNoCreate();
+    void constructCopy();
+};
+
+ParticleSystemTest::ParticleSystemTest() {
+    addTests({&ParticleSystemTest::constructNoCreate,
+              &ParticleSystemTest::constructCopy});
+}
+
+void ParticleSystemTest::constructNoCreate() {
+    {
+        ParticleSimulation simulation{NoCreate};
+        Particles shader{NoCreate};
+        ParticleSystem particles{NoCreate};
+        CORRADE_COMPARE(simulation.id(), 0);
+        CORRADE_COMPARE(shader.id(), 0);
+        CORRADE_COMPARE(particles.count(), 0);
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void ParticleSystemTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<ParticleSimulation, const ParticleSimulation&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<ParticleSimulation, const ParticleSimulation&>{}));
+    CORRADE_VERIFY(!(std::is_constructible<Particles, const Particles&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<Particles, const Particles&>{}));
+    CORRADE_VERIFY(!(std::is_constructible<ParticleSystem, const ParticleSystem&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<ParticleSystem, const ParticleSystem&>{}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::ParticleSystemTest)
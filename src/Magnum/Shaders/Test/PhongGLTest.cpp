@@ -27,10 +27,23 @@
 
 #include "Magnum/PixelFormat.h"
 #include "Magnum/ImageView.h"
+#include "Magnum/Math/DualQuaternion.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/GL/Buffer.h"
+#endif
+#include "Magnum/GL/CubeMapTexture.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/OpenGLTester.h"
 #include "Magnum/GL/Texture.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/GL/TextureArray.h"
+#endif
 #include "Magnum/GL/TextureFormat.h"
 #include "Magnum/Shaders/Phong.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Shaders/ShadowCascades.h"
+#endif
 
 namespace Magnum { namespace Shaders { namespace Test {
 
@@ -44,9 +57,44 @@ struct PhongGLTest: GL::OpenGLTester {
     void bindTextures();
     void bindTexturesNotEnabled();
 
+    #ifndef MAGNUM_TARGET_GLES
+    void setTextureHandles();
+    void setTextureHandlesNotEnabled();
+    #endif
+
     void setAlphaMask();
     void setAlphaMaskNotEnabled();
 
+    #ifndef MAGNUM_TARGET_GLES2
+    void bindBuffers();
+    void bindBuffersNotEnabled();
+
+    void skinning();
+    void skinningDualQuaternion();
+    void skinningNoJoints();
+    void bindJointBufferNotEnabled();
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    void clusteredLights();
+    void bindLightClusterBuffersNotEnabled();
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    void shadows();
+    void shadowsNoLights();
+    void shadowsNotEnabled();
+    void setShadowCascadesTooMany();
+
+    void imageBasedLighting();
+    void imageBasedLightingNotEnabled();
+    #endif
+
+    void constructDepthOnlyInvalid();
+    #ifndef MAGNUM_TARGET_GLES2
+    void constructGBufferInvalid();
+    #endif
+
     void setWrongLightCount();
     void setWrongLightId();
 };
@@ -66,7 +114,18 @@ constexpr struct {
     {"ambient + diffuse + specular texture", Phong::Flag::AmbientTexture|Phong::Flag::DiffuseTexture|Phong::Flag::SpecularTexture, 1},
     {"alpha mask", Phong::Flag::AlphaMask, 1},
     {"alpha mask + diffuse texture", Phong::Flag::AlphaMask|Phong::Flag::DiffuseTexture, 1},
-    {"five lights", {}, 5}
+    {"vertex color", Phong::Flag::VertexColor, 1},
+    {"instanced transformation", Phong::Flag::InstancedTransformation, 1},
+    {"instanced transformation + vertex color + diffuse texture", Phong::Flag::InstancedTransformation|Phong::Flag::VertexColor|Phong::Flag::DiffuseTexture, 3},
+    {"five lights", {}, 5},
+    {"depth only", Phong::Flag::DepthOnly, 1},
+    {"depth only + instanced transformation", Phong::Flag::DepthOnly|Phong::Flag::InstancedTransformation, 3},
+    #ifndef MAGNUM_TARGET_GLES2
+    {"weighted blended transparency", Phong::Flag::WeightedBlendedTransparency, 1},
+    {"weighted blended transparency + alpha mask + diffuse texture", Phong::Flag::WeightedBlendedTransparency|Phong::Flag::AlphaMask|Phong::Flag::DiffuseTexture, 2},
+    {"G-buffer", Phong::Flag::GBuffer, 1},
+    {"G-buffer + alpha mask + diffuse + specular texture", Phong::Flag::GBuffer|Phong::Flag::AlphaMask|Phong::Flag::DiffuseTexture|Phong::Flag::SpecularTexture, 1}
+    #endif
 };
 
 PhongGLTest::PhongGLTest() {
@@ -77,9 +136,44 @@ PhongGLTest::PhongGLTest() {
               &PhongGLTest::bindTextures,
               &PhongGLTest::bindTexturesNotEnabled,
 
+              #ifndef MAGNUM_TARGET_GLES
+              &PhongGLTest::setTextureHandles,
+              &PhongGLTest::setTextureHandlesNotEnabled,
+              #endif
+
               &PhongGLTest::setAlphaMask,
               &PhongGLTest::setAlphaMaskNotEnabled,
 
+              #ifndef MAGNUM_TARGET_GLES2
+              &PhongGLTest::bindBuffers,
+              &PhongGLTest::bindBuffersNotEnabled,
+
+              &PhongGLTest::skinning,
+              &PhongGLTest::skinningDualQuaternion,
+              &PhongGLTest::skinningNoJoints,
+              &PhongGLTest::bindJointBufferNotEnabled,
+              #endif
+
+              #ifndef MAGNUM_TARGET_GLES
+              &PhongGLTest::clusteredLights,
+              &PhongGLTest::bindLightClusterBuffersNotEnabled,
+              #endif
+
+              #ifndef MAGNUM_TARGET_GLES2
+              &PhongGLTest::shadows,
+              &PhongGLTest::shadowsNoLights,
+              &PhongGLTest::shadowsNotEnabled,
+              &PhongGLTest::setShadowCascadesTooMany,
+
+              &PhongGLTest::imageBasedLighting,
+              &PhongGLTest::imageBasedLightingNotEnabled,
+              #endif
+
+              &PhongGLTest::constructDepthOnlyInvalid,
+              #ifndef MAGNUM_TARGET_GLES2
+              &PhongGLTest::constructGBufferInvalid,
+              #endif
+
               &PhongGLTest::setWrongLightCount,
               &PhongGLTest::setWrongLightId});
 }
@@ -161,6 +255,49 @@ void PhongGLTest::bindTexturesNotEnabled() {
         "Shaders::Phong::bindTextures(): the shader was not created with any textures enabled\n");
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void PhongGLTest::setTextureHandles() {
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() + std::string(" is not supported."));
+
+    GL::Texture2D texture;
+    texture
+        .setMinificationFilter(SamplerFilter::Linear, SamplerMipmap::Linear)
+        .setMagnificationFilter(SamplerFilter::Linear)
+        .setWrapping(SamplerWrapping::ClampToEdge)
+        .setStorage(1, GL::TextureFormat::RGBA8, {1, 1});
+
+    const UnsignedLong handle = texture.handle();
+    GL::AbstractTexture::makeHandleResident(handle);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Test just that no assertion is fired */
+    Phong shader{Phong::Flag::AmbientTexture|Phong::Flag::DiffuseTexture|Phong::Flag::SpecularTexture|Phong::Flag::BindlessTextures};
+    shader.setAmbientTextureHandle(handle)
+          .setDiffuseTextureHandle(handle)
+          .setSpecularTextureHandle(handle)
+          .setTextureHandles(handle, handle, handle);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    GL::AbstractTexture::makeHandleNonResident(handle);
+}
+
+void PhongGLTest::setTextureHandlesNotEnabled() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Phong shader{Phong::Flag::DiffuseTexture};
+    shader.setAmbientTextureHandle(0)
+          .setTextureHandles(0, 0, 0);
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Phong::setAmbientTextureHandle(): the shader was not created with bindless textures enabled\n"
+        "Shaders::Phong::setTextureHandles(): the shader was not created with bindless textures enabled\n");
+}
+#endif
+
 void PhongGLTest::setAlphaMask() {
     /* Test just that no assertion is fired */
     Phong shader{Phong::Flag::AlphaMask};
@@ -180,6 +317,338 @@ void PhongGLTest::setAlphaMaskNotEnabled() {
         "Shaders::Phong::setAlphaMask(): the shader was not created with alpha mask enabled\n");
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void PhongGLTest::bindBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Phong::ProjectionUniform projection;
+    Phong::TransformationUniform transformation;
+    Phong::MaterialUniform material;
+    const Vector4 lights[]{{}, {}, Color4{1.0f}, Color4{1.0f}};
+
+    GL::Buffer projectionBuffer, transformationBuffer, materialBuffer, lightBuffer;
+    projectionBuffer.setData(Containers::arrayView(&projection, 1));
+    transformationBuffer.setData(Containers::arrayView(&transformation, 1));
+    materialBuffer.setData(Containers::arrayView(&material, 1));
+    lightBuffer.setData(lights);
+
+    /* Test just that no assertion is fired */
+    Phong shader{Phong::Flag::UniformBuffers|Phong::Flag::AlphaMask, 2};
+    shader.bindProjectionBuffer(projectionBuffer)
+        .bindTransformationBuffer(transformationBuffer, 0, sizeof(Phong::TransformationUniform))
+        .bindMaterialBuffer(materialBuffer)
+        .bindLightBuffer(lightBuffer)
+        /* These are no-op */
+        .setTransformationMatrix({})
+        .setDiffuseColor(Color4{1.0f})
+        .setAlphaMask(0.25f)
+        .setLightPosition(1, {});
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::bindBuffersNotEnabled() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    GL::Buffer buffer;
+    Phong shader;
+    shader.bindProjectionBuffer(buffer)
+        .bindTransformationBuffer(buffer, 0, 16)
+        .bindMaterialBuffer(buffer)
+        .bindLightBuffer(buffer, 0, 16);
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Phong::bindProjectionBuffer(): the shader was not created with uniform buffers enabled\n"
+        "Shaders::Phong::bindTransformationBuffer(): the shader was not created with uniform buffers enabled\n"
+        "Shaders::Phong::bindMaterialBuffer(): the shader was not created with uniform buffers enabled\n"
+        "Shaders::Phong::bindLightBuffer(): the shader was not created with uniform buffers enabled\n");
+}
+
+void PhongGLTest::skinning() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    if(!GL::Context::current().isVersionSupported(GL::Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+    #endif
+
+    const Matrix4 joints[]{
+        Matrix4::translation(Vector3::xAxis()),
+        Matrix4::rotationY(Deg(35.0f)),
+        Matrix4::scaling(Vector3{2.0f}),
+        {}
+    };
+    GL::Buffer jointBuffer;
+    jointBuffer.setData(joints);
+
+    Phong shader{Phong::Flag::Skinning|Phong::Flag::DiffuseTexture, 1, 4};
+    CORRADE_COMPARE(shader.flags(), Phong::Flag::Skinning|Phong::Flag::DiffuseTexture);
+    CORRADE_COMPARE(shader.jointCount(), 4);
+
+    /* Test just that no assertion is fired */
+    shader.bindJointBuffer(jointBuffer)
+        .bindJointBuffer(jointBuffer, 0, sizeof(joints));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::skinningDualQuaternion() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    if(!GL::Context::current().isVersionSupported(GL::Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+    #endif
+
+    const DualQuaternion joints[]{
+        DualQuaternion::translation(Vector3::xAxis()),
+        DualQuaternion::rotation(Deg(35.0f), Vector3::yAxis()),
+        {}
+    };
+    GL::Buffer jointBuffer;
+    jointBuffer.setData(joints);
+
+    Phong shader{Phong::Flag::DualQuaternionSkinning, 1, 3};
+    CORRADE_VERIFY(shader.flags() & Phong::Flag::Skinning);
+    CORRADE_COMPARE(shader.jointCount(), 3);
+
+    /* Test just that no assertion is fired */
+    shader.bindJointBuffer(jointBuffer);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::skinningNoJoints() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Phong shader{Phong::Flag::Skinning};
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Phong: expected non-zero joint count with skinning enabled\n");
+}
+
+void PhongGLTest::bindJointBufferNotEnabled() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    GL::Buffer buffer;
+    Phong shader{{}, 1, 16};
+    CORRADE_COMPARE(shader.jointCount(), 0);
+    shader.bindJointBuffer(buffer)
+        .bindJointBuffer(buffer, 0, 64);
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Phong::bindJointBuffer(): the shader was not created with skinning enabled\n"
+        "Shaders::Phong::bindJointBuffer(): the shader was not created with skinning enabled\n");
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+void PhongGLTest::clusteredLights() {
+    if(!GL::Context::current().isVersionSupported(GL::Version::GL430))
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    Phong shader{Phong::Flag::ClusteredLights|Phong::Flag::DiffuseTexture, 3};
+    CORRADE_COMPARE(shader.flags(), Phong::Flag::ClusteredLights|Phong::Flag::DiffuseTexture);
+    CORRADE_COMPARE(shader.lightCount(), 0);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    /* Test just that no assertion is fired */
+    GL::Buffer lights, clusters;
+    shader.bindClusteredLightBuffer(lights)
+        .bindLightClusterBuffer(clusters);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void PhongGLTest::bindLightClusterBuffersNotEnabled() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    GL::Buffer buffer;
+    Phong shader;
+    shader.bindClusteredLightBuffer(buffer)
+        .bindLightClusterBuffer(buffer);
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Phong::bindClusteredLightBuffer(): the shader was not created with clustered lights enabled\n"
+        "Shaders::Phong::bindLightClusterBuffer(): the shader was not created with clustered lights enabled\n");
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+void PhongGLTest::shadows() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
+        CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() + std::string(" is not supported."));
+    #endif
+
+    Phong shader{Phong::Flag::Shadows|Phong::Flag::DiffuseTexture, 2};
+    CORRADE_COMPARE(shader.flags(), Phong::Flag::Shadows|Phong::Flag::DiffuseTexture);
+    CORRADE_COMPARE(shader.lightCount(), 2);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    GL::Texture2DArray shadowMap;
+    shadowMap.setStorage(1, GL::TextureFormat::DepthComponent24, {64, 64, 3})
+        .setCompareMode(GL::SamplerCompareMode::CompareRefToTexture)
+        .setCompareFunction(GL::SamplerCompareFunction::LessOrEqual);
+
+    ShadowCascades cascades{3};
+    cascades.update(Matrix4::translation({0.0f, 0.0f, -5.0f}),
+        Matrix4::perspectiveProjection(Deg(60.0f), 1.0f, 0.1f, 100.0f));
+
+    /* Test just that no assertion is fired */
+    shader.bindShadowTexture(shadowMap)
+        .setShadowCascades(cascades);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void PhongGLTest::shadowsNoLights() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Phong shader{Phong::Flag::Shadows, 0};
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Phong: expected non-zero light count with shadows enabled\n");
+}
+
+void PhongGLTest::shadowsNotEnabled() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    GL::Texture2DArray texture;
+    Phong shader;
+    shader.bindShadowTexture(texture)
+        .setShadowMatrices({})
+        .setShadowSplitDistances({});
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Phong::bindShadowTexture(): the shader was not created with shadows enabled\n"
+        "Shaders::Phong::setShadowMatrices(): the shader was not created with shadows enabled\n"
+        "Shaders::Phong::setShadowSplitDistances(): the shader was not created with shadows enabled\n");
+}
+
+void PhongGLTest::setShadowCascadesTooMany() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
+        CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() + std::string(" is not supported."));
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Phong shader{Phong::Flag::Shadows};
+    shader.setShadowMatrices({{}, {}, {}, {}, {}})
+        .setShadowSplitDistances({1.0f, 2.0f, 3.0f, 4.0f, 5.0f});
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Phong::setShadowMatrices(): expected at most 4 items but got 5\n"
+        "Shaders::Phong::setShadowSplitDistances(): expected at most 4 items but got 5\n");
+}
+
+void PhongGLTest::imageBasedLighting() {
+    Phong shader{Phong::Flag::ImageBasedLighting|Phong::Flag::SpecularTexture, 2};
+    CORRADE_COMPARE(shader.flags(), Phong::Flag::ImageBasedLighting|Phong::Flag::SpecularTexture);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    GL::CubeMapTexture irradiance, specular;
+    irradiance.setStorage(1, GL::TextureFormat::RGBA8, Vector2i{8});
+    specular.setStorage(3, GL::TextureFormat::RGBA8, Vector2i{16});
+    GL::Texture2D brdf;
+    brdf.setStorage(1, GL::TextureFormat::RG8, Vector2i{16});
+
+    /* Test just that no assertion is fired */
+    shader.bindImageBasedLightingTextures(irradiance, specular, brdf)
+        .setEnvironmentRotation(Matrix4::rotationY(Deg(35.0f)).rotationScaling())
+        .setSpecularEnvironmentLevelCount(3);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void PhongGLTest::imageBasedLightingNotEnabled() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    GL::CubeMapTexture irradiance, specular;
+    GL::Texture2D brdf;
+    Phong shader;
+    shader.bindImageBasedLightingTextures(irradiance, specular, brdf)
+        .setEnvironmentRotation({})
+        .setSpecularEnvironmentLevelCount(1);
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Phong::bindImageBasedLightingTextures(): the shader was not created with image-based lighting enabled\n"
+        "Shaders::Phong::setEnvironmentRotation(): the shader was not created with image-based lighting enabled\n"
+        "Shaders::Phong::setSpecularEnvironmentLevelCount(): the shader was not created with image-based lighting enabled\n");
+}
+#endif
+
+void PhongGLTest::constructDepthOnlyInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Phong{Phong::Flag::DepthOnly|Phong::Flag::VertexColor};
+    CORRADE_COMPARE(out.str(), "Shaders::Phong: depth-only rendering can be combined only with instanced transformation, uniform buffers and skinning\n");
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void PhongGLTest::constructGBufferInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Phong{Phong::Flag::GBuffer|Phong::Flag::WeightedBlendedTransparency};
+    Phong{Phong::Flag::GBuffer|Phong::Flag::Shadows};
+    Phong{Phong::Flag::GBuffer|Phong::Flag::ImageBasedLighting};
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Phong: G-buffer output can't be combined with depth-only rendering, shadows, clustered lights or weighted blended transparency\n"
+        "Shaders::Phong: G-buffer output can't be combined with depth-only rendering, shadows, clustered lights or weighted blended transparency\n"
+        "Shaders::Phong: G-buffer output can't be combined with image-based lighting\n");
+}
+#endif
+
 void PhongGLTest::setWrongLightCount() {
     std::ostringstream out;
     Error redirectError{&out};
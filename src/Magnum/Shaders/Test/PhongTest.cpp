@@ -36,16 +36,31 @@ struct PhongTest: TestSuite::Tester {
     void constructNoCreate();
     void constructCopy();
 
+    #ifndef MAGNUM_TARGET_GLES2
+    void uniformLayout();
+    #endif
+
     void debugFlag();
     void debugFlags();
+    #ifndef MAGNUM_TARGET_GLES2
+    void debugFlagsSupersets();
+    #endif
 };
 
 PhongTest::PhongTest() {
     addTests({&PhongTest::constructNoCreate,
               &PhongTest::constructCopy,
 
+              #ifndef MAGNUM_TARGET_GLES2
+              &PhongTest::uniformLayout,
+              #endif
+
               &PhongTest::debugFlag,
-              &PhongTest::debugFlags});
+              &PhongTest::debugFlags,
+              #ifndef MAGNUM_TARGET_GLES2
+              &PhongTest::debugFlagsSupersets
+              #endif
+              });
 }
 
 void PhongTest::constructNoCreate() {
@@ -62,6 +77,24 @@ void PhongTest::constructCopy() {
     CORRADE_VERIFY(!(std::is_assignable<Phong, const Phong&>{}));
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void PhongTest::uniformLayout() {
+    /* Has to match the std140 layout of the blocks in the shader */
+    CORRADE_COMPARE(sizeof(Phong::ProjectionUniform), 64);
+    CORRADE_COMPARE(sizeof(Phong::TransformationUniform), 112);
+    CORRADE_COMPARE(sizeof(Phong::MaterialUniform), 64);
+
+    Phong::TransformationUniform transformation;
+    transformation.setNormalMatrix(Matrix3x3{Vector3{1.0f, 2.0f, 3.0f},
+                                             Vector3{4.0f, 5.0f, 6.0f},
+                                             Vector3{7.0f, 8.0f, 9.0f}});
+    CORRADE_COMPARE(transformation.normalMatrix, (Matrix3x4{
+        Vector4{1.0f, 2.0f, 3.0f, 0.0f},
+        Vector4{4.0f, 5.0f, 6.0f, 0.0f},
+        Vector4{7.0f, 8.0f, 9.0f, 0.0f}}));
+}
+#endif
+
 void PhongTest::debugFlag() {
     std::ostringstream out;
 
@@ -76,6 +109,16 @@ void PhongTest::debugFlags() {
     CORRADE_COMPARE(out.str(), "Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::SpecularTexture Shaders::Phong::Flags{}\n");
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void PhongTest::debugFlagsSupersets() {
+    /* DualQuaternionSkinning is a superset of Skinning, so only one should
+       be printed */
+    std::ostringstream out;
+    Debug{&out} << (Phong::Flag::Skinning|Phong::Flag::DualQuaternionSkinning);
+    CORRADE_COMPARE(out.str(), "Shaders::Phong::Flag::DualQuaternionSkinning\n");
+}
+#endif
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::PhongTest)
@@ -0,0 +1,287 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/PointCloudOctree.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct PointCloudOctreeTest: TestSuite::Tester {
+    explicit PointCloudOctreeTest();
+
+    void construct();
+    void constructEmpty();
+    void constructSubdivided();
+    void constructMultithreaded();
+    void constructInvalid();
+    void setInvalid();
+
+    void select();
+    void selectBudget();
+    void selectDetailThreshold();
+    void selectCulled();
+};
+
+PointCloudOctreeTest::PointCloudOctreeTest() {
+    addTests({&PointCloudOctreeTest::construct,
+              &PointCloudOctreeTest::constructEmpty,
+              &PointCloudOctreeTest::constructSubdivided,
+              &PointCloudOctreeTest::constructMultithreaded,
+              &PointCloudOctreeTest::constructInvalid,
+              &PointCloudOctreeTest::setInvalid,
+
+              &PointCloudOctreeTest::select,
+              &PointCloudOctreeTest::selectBudget,
+              &PointCloudOctreeTest::selectDetailThreshold,
+              &PointCloudOctreeTest::selectCulled});
+}
+
+namespace {
+
+/* Frustum containing the whole cloud */
+const Frustum Everything = Frustum::fromMatrix(Matrix4::orthographicProjection({100.0f, 100.0f}, -100.0f, 100.0f));
+
+/* Deterministic pseudo-random points in the [-1, 1] cube */
+std::vector<Vector3> points(const std::size_t count) {
+    std::vector<Vector3> out;
+    UnsignedInt state = 1234567;
+    auto random = [&state]() {
+        state = state*1664525u + 1013904223u;
+        return Float(state >> 8)/Float(1 << 24)*2.0f - 1.0f;
+    };
+    for(std::size_t i = 0; i != count; ++i)
+        out.push_back({random(), random(), random()});
+    return out;
+}
+
+Containers::StridedArrayView<const Vector3> view(const std::vector<Vector3>& points) {
+    return {points.data(), points.size(), sizeof(Vector3)};
+}
+
+Vector3 dequantize(const PointCloudChunk& chunk, const PointCloudVertex& vertex) {
+    return chunk.bounds.min() + Vector3{vertex.position}/65535.0f*chunk.bounds.size();
+}
+
+}
+
+void PointCloudOctreeTest::construct() {
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f},
+        {-1.0f, 0.5f, 2.0f},
+        {0.0f, -2.0f, 1.0f}
+    };
+    const Color4ub colors[]{
+        {0xff, 0x00, 0x00, 0xff},
+        {0x00, 0xff, 0x00, 0xff},
+        {0x00, 0x00, 0xff, 0x80}
+    };
+    PointCloudOctree octree{{positions, 3, sizeof(Vector3)}, {colors, 3, sizeof(Color4ub)}};
+    CORRADE_COMPARE(octree.chunkSize(), 16384);
+    CORRADE_COMPARE(octree.bounds(), (Range3D{{-1.0f, -2.0f, 1.0f}, {1.0f, 2.0f, 3.0f}}));
+    CORRADE_COMPARE(octree.pointBudget(), 10000000);
+    CORRADE_COMPARE(octree.detailThreshold(), 0.1f);
+
+    /* Everything fits into the root chunk */
+    CORRADE_COMPARE(octree.chunks().size(), 1);
+    const PointCloudChunk& root = octree.chunks()[0];
+    CORRADE_COMPARE(root.vertexOffset, 0);
+    CORRADE_COMPARE(root.vertexCount, 3);
+    CORRADE_COMPARE(root.level, 0);
+    CORRADE_COMPARE(root.childCount, 0);
+    CORRADE_COMPARE(root.bounds.min(), octree.bounds().min());
+    CORRADE_VERIFY((root.bounds.max() >= octree.bounds().max()).all());
+
+    /* The vertices are in Morton order, with quantized positions */
+    CORRADE_COMPARE(octree.vertices().size(), 3);
+    CORRADE_COMPARE(octree.indices().size(), 3);
+    for(std::size_t i = 0; i != 3; ++i) {
+        const UnsignedInt index = octree.indices()[i];
+        CORRADE_VERIFY((Math::abs(dequantize(root, octree.vertices()[i]) - positions[index]) < Vector3{0.0001f}).all());
+        CORRADE_COMPARE(octree.vertices()[i].color, colors[index]);
+        CORRADE_COMPARE(octree.vertices()[i].padding, 0);
+    }
+}
+
+void PointCloudOctreeTest::constructEmpty() {
+    PointCloudOctree octree{{}, {}};
+    CORRADE_VERIFY(octree.chunks().empty());
+    CORRADE_VERIFY(octree.vertices().empty());
+
+    octree.select({}, Everything);
+    CORRADE_VERIFY(octree.selectedChunks().empty());
+    CORRADE_COMPARE(octree.selectedPointCount(), 0);
+}
+
+void PointCloudOctreeTest::constructSubdivided() {
+    const std::vector<Vector3> data = points(5000);
+    PointCloudOctree octree{view(data), {}, 64};
+    CORRADE_VERIFY(octree.chunks().size() > 8);
+    CORRADE_COMPARE(octree.vertices().size(), 5000);
+
+    /* The root is a subsample of the whole cloud */
+    CORRADE_COMPARE(octree.chunks()[0].vertexCount, 64);
+    CORRADE_COMPARE(octree.chunks()[0].childOffset, 1);
+    CORRADE_VERIFY(octree.chunks()[0].childCount > 1);
+
+    std::vector<bool> covered(5000);
+    for(std::size_t i = 0; i != octree.chunks().size(); ++i) {
+        const PointCloudChunk& chunk = octree.chunks()[i];
+        CORRADE_VERIFY(chunk.vertexCount);
+        CORRADE_VERIFY(chunk.vertexCount <= 64);
+
+        /* Every vertex is in exactly one chunk and inside its bounds */
+        for(std::size_t j = chunk.vertexOffset; j != chunk.vertexOffset + chunk.vertexCount; ++j) {
+            CORRADE_VERIFY(!covered[j]);
+            covered[j] = true;
+
+            const Vector3 position = data[octree.indices()[j]];
+            CORRADE_VERIFY((position >= chunk.bounds.min() - Vector3{0.0001f}).all());
+            CORRADE_VERIFY((position <= chunk.bounds.max() + Vector3{0.0001f}).all());
+            CORRADE_VERIFY((Math::abs(dequantize(chunk, octree.vertices()[j]) - position) <= chunk.bounds.size()/65535.0f).all());
+            CORRADE_COMPARE(octree.vertices()[j].color, Color4ub{255});
+        }
+
+        /* Children are one level deeper and inside the parent */
+        for(std::size_t j = chunk.childOffset; j != chunk.childOffset + chunk.childCount; ++j) {
+            const PointCloudChunk& child = octree.chunks()[j];
+            CORRADE_COMPARE(child.level, chunk.level + 1);
+            CORRADE_VERIFY((child.bounds.min() >= chunk.bounds.min()).all());
+            CORRADE_VERIFY((child.bounds.max() <= chunk.bounds.max()).all());
+        }
+    }
+    CORRADE_VERIFY(std::all_of(covered.begin(), covered.end(), [](bool a) { return a; }));
+
+    /* The indices are a permutation */
+    std::vector<UnsignedInt> indices(octree.indices().begin(), octree.indices().end());
+    std::sort(indices.begin(), indices.end());
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_COMPARE(indices[i], i);
+}
+
+void PointCloudOctreeTest::constructMultithreaded() {
+    const std::vector<Vector3> data = points(5000);
+    PointCloudOctree single{view(data), {}, 64};
+    PointCloudOctree multi{view(data), {}, 64, 4};
+
+    CORRADE_COMPARE(multi.chunks().size(), single.chunks().size());
+    CORRADE_VERIFY(std::equal(multi.indices().begin(), multi.indices().end(), single.indices().begin()));
+    for(std::size_t i = 0; i != single.vertices().size(); ++i) {
+        CORRADE_COMPARE(multi.vertices()[i].position, single.vertices()[i].position);
+    }
+}
+
+void PointCloudOctreeTest::constructInvalid() {
+    const Vector3 positions[2]{};
+    const Color4ub colors[1]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    PointCloudOctree{{positions, 2, sizeof(Vector3)}, {colors, 1, sizeof(Color4ub)}};
+    PointCloudOctree{{positions, 2, sizeof(Vector3)}, {}, 0};
+    CORRADE_COMPARE(out.str(),
+        "Shaders::PointCloudOctree: expected either no colors or 2 but got 1\n"
+        "Shaders::PointCloudOctree: chunk size can't be zero\n");
+}
+
+void PointCloudOctreeTest::setInvalid() {
+    PointCloudOctree octree{{}, {}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    octree.setDetailThreshold(0.0f);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::PointCloudOctree::setDetailThreshold(): expected positive threshold, got 0\n");
+}
+
+void PointCloudOctreeTest::select() {
+    const std::vector<Vector3> data = points(5000);
+    PointCloudOctree octree{view(data), {}, 64};
+
+    /* With the camera inside the cloud and small threshold everything is
+       selected, parents before their children */
+    octree.setDetailThreshold(0.0001f)
+        .select({}, Everything);
+    CORRADE_COMPARE(octree.selectedChunks().size(), octree.chunks().size());
+    CORRADE_COMPARE(octree.selectedPointCount(), 5000);
+    CORRADE_COMPARE(octree.selectedChunks()[0], 0);
+
+    std::vector<bool> selected(octree.chunks().size());
+    for(UnsignedInt id: octree.selectedChunks()) {
+        selected[id] = true;
+        const PointCloudChunk& chunk = octree.chunks()[id];
+        for(std::size_t j = chunk.childOffset; j != chunk.childOffset + chunk.childCount; ++j)
+            CORRADE_VERIFY(!selected[j]);
+    }
+}
+
+void PointCloudOctreeTest::selectBudget() {
+    const std::vector<Vector3> data = points(5000);
+    PointCloudOctree octree{view(data), {}, 64};
+    octree.setDetailThreshold(0.0001f);
+
+    /* The root is selected always, even if it's over the budget */
+    octree.setPointBudget(10)
+        .select({}, Everything);
+    CORRADE_COMPARE(octree.selectedChunks().size(), 1);
+    CORRADE_COMPARE(octree.selectedPointCount(), 64);
+
+    octree.setPointBudget(1000)
+        .select({}, Everything);
+    CORRADE_VERIFY(octree.selectedChunks().size() > 1);
+    CORRADE_VERIFY(octree.selectedPointCount() <= 1000);
+}
+
+void PointCloudOctreeTest::selectDetailThreshold() {
+    const std::vector<Vector3> data = points(5000);
+    PointCloudOctree octree{view(data), {}, 64};
+
+    /* Far away only the root is selected */
+    octree.select({0.0f, 0.0f, 90.0f}, Everything);
+    CORRADE_COMPARE(octree.selectedChunks().size(), 1);
+
+    /* Closer there's more detail */
+    octree.select({0.0f, 0.0f, 3.0f}, Everything);
+    const std::size_t count = octree.selectedChunks().size();
+    CORRADE_VERIFY(count > 1);
+    CORRADE_VERIFY(count < octree.chunks().size());
+}
+
+void PointCloudOctreeTest::selectCulled() {
+    const std::vector<Vector3> data = points(5000);
+    PointCloudOctree octree{view(data), {}, 64};
+
+    octree.select({}, Frustum::fromMatrix(Matrix4::orthographicProjection({1.0f, 1.0f}, -1.0f, 1.0f)*Matrix4::translation({10.0f, 0.0f, 0.0f})));
+    CORRADE_VERIFY(octree.selectedChunks().empty());
+    CORRADE_COMPARE(octree.selectedPointCount(), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::PointCloudOctreeTest)
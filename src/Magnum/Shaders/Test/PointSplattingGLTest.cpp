@@ -0,0 +1,141 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/PointCloudOctree.h"
+#include "Magnum/Shaders/PointSplatting.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct PointSplattingGLTest: GL::OpenGLTester {
+    explicit PointSplattingGLTest();
+
+    void construct();
+    void constructMove();
+
+    void draw();
+};
+
+PointSplattingGLTest::PointSplattingGLTest() {
+    addTests({&PointSplattingGLTest::construct,
+              &PointSplattingGLTest::constructMove,
+
+              &PointSplattingGLTest::draw});
+}
+
+namespace {
+    bool isSupported() {
+        return GL::Context::current().isVersionSupported(GL::Version::GL430);
+    }
+}
+
+void PointSplattingGLTest::construct() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    PointSplatting splatting{{32, 16}};
+    CORRADE_COMPARE(splatting.size(), (Vector2i{32, 16}));
+    CORRADE_COMPARE(splatting.depthTolerance(), 0.01f);
+
+    splatting.setSize({8, 8});
+    CORRADE_COMPARE(splatting.size(), Vector2i{8});
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void PointSplattingGLTest::constructMove() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    PointSplatting a{{32, 16}};
+    PointSplatting b{std::move(a)};
+    CORRADE_COMPARE(b.size(), (Vector2i{32, 16}));
+
+    PointSplatting c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), (Vector2i{32, 16}));
+}
+
+void PointSplattingGLTest::draw() {
+    if(!isSupported())
+        CORRADE_SKIP("OpenGL 4.3 is not supported.");
+
+    /* Pixel centers in NDC are at -0.75, -0.25, 0.25 and 0.75 */
+    const Vector3 positions[]{
+        /* Near red point in front of a far blue one */
+        {-0.25f, -0.25f, -0.5f},
+        {-0.25f, -0.25f, 0.5f},
+        /* Two points at nearly the same depth get averaged */
+        {0.25f, 0.25f, 0.0f},
+        {0.25f, 0.25f, 0.0001f}
+    };
+    const Color4ub colors[]{
+        {0xff, 0x00, 0x00, 0xff},
+        {0x00, 0x00, 0xff, 0xff},
+        {0x80, 0x40, 0x00, 0xff},
+        {0x00, 0x40, 0x80, 0xff}
+    };
+    PointCloudOctree octree{{positions, 4, sizeof(Vector3)}, {colors, 4, sizeof(Color4ub)}};
+    octree.select({}, Frustum::fromMatrix(Matrix4{}));
+    CORRADE_COMPARE(octree.selectedChunks().size(), 1);
+
+    GL::Buffer vertices;
+    vertices.setData(octree.vertices(), GL::BufferUsage::StaticDraw);
+
+    GL::Renderbuffer color;
+    color.setStorage(GL::RenderbufferFormat::RGBA8, Vector2i{4});
+    GL::Framebuffer fb{{{}, Vector2i{4}}};
+    fb.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color)
+      .clearColor(0, Color4{})
+      .bind();
+
+    PointSplatting{Vector2i{4}}.draw(vertices, octree);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Image2D image = fb.read({{}, Vector2i{4}}, {GL::PixelFormat::RGBA, GL::PixelType::UnsignedByte});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const auto pixels = Containers::arrayCast<const Color4ub>(image.data());
+    CORRADE_COMPARE(pixels[1*4 + 1], (Color4ub{0xff, 0x00, 0x00, 0xff}));
+    CORRADE_COMPARE(pixels[2*4 + 2], (Color4ub{0x40, 0x40, 0x40, 0xff}));
+
+    /* Pixels without any point are left untouched */
+    CORRADE_COMPARE(pixels[0], Color4ub{});
+    CORRADE_COMPARE(pixels[3*4 + 3], Color4ub{});
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::PointSplattingGLTest)
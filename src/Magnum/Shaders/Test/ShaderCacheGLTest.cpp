@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Shaders/ShaderCache.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ShaderCacheGLTest: GL::OpenGLTester {
+    explicit ShaderCacheGLTest();
+
+    void construct();
+    void constructMove();
+
+    void flat();
+    void phong();
+    void vertexColor();
+
+    void clear();
+};
+
+ShaderCacheGLTest::ShaderCacheGLTest() {
+    addTests({&ShaderCacheGLTest::construct,
+              &ShaderCacheGLTest::constructMove,
+
+              &ShaderCacheGLTest::flat,
+              &ShaderCacheGLTest::phong,
+              &ShaderCacheGLTest::vertexColor,
+
+              &ShaderCacheGLTest::clear});
+}
+
+void ShaderCacheGLTest::construct() {
+    ShaderCache cache;
+    CORRADE_COMPARE(cache.count(), 0);
+}
+
+void ShaderCacheGLTest::constructMove() {
+    ShaderCache a;
+    Phong& shader = a.phong();
+    CORRADE_COMPARE(a.count(), 1);
+
+    /* The shader reference stays valid */
+    ShaderCache b{std::move(a)};
+    CORRADE_COMPARE(b.count(), 1);
+    CORRADE_COMPARE(&b.phong(), &shader);
+
+    ShaderCache c;
+    c.flat2D();
+    c = std::move(b);
+    CORRADE_COMPARE(c.count(), 1);
+    CORRADE_COMPARE(&c.phong(), &shader);
+}
+
+void ShaderCacheGLTest::flat() {
+    ShaderCache cache;
+
+    Flat2D& a = cache.flat2D();
+    Flat2D& b = cache.flat2D(Flat2D::Flag::Textured);
+    Flat3D& c = cache.flat3D(Flat3D::Flag::Textured);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(a.flags(), Flat2D::Flags{});
+    CORRADE_COMPARE(b.flags(), Flat2D::Flag::Textured);
+    CORRADE_COMPARE(c.flags(), Flat3D::Flag::Textured);
+    CORRADE_VERIFY(&a != &b);
+    CORRADE_COMPARE(cache.count(), 3);
+
+    /* Asking for the same permutation again doesn't create a new shader */
+    CORRADE_COMPARE(&cache.flat2D(), &a);
+    CORRADE_COMPARE(&cache.flat2D(Flat2D::Flag::Textured), &b);
+    CORRADE_COMPARE(&cache.flat3D(Flat3D::Flag::Textured), &c);
+    CORRADE_COMPARE(cache.count(), 3);
+}
+
+void ShaderCacheGLTest::phong() {
+    ShaderCache cache;
+
+    Phong& a = cache.phong();
+    Phong& b = cache.phong(Phong::Flag::DiffuseTexture);
+    Phong& c = cache.phong(Phong::Flag::DiffuseTexture, 3);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(a.flags(), Phong::Flags{});
+    CORRADE_COMPARE(a.lightCount(), 1);
+    CORRADE_COMPARE(b.flags(), Phong::Flag::DiffuseTexture);
+    CORRADE_COMPARE(b.lightCount(), 1);
+    CORRADE_COMPARE(c.flags(), Phong::Flag::DiffuseTexture);
+    CORRADE_COMPARE(c.lightCount(), 3);
+    CORRADE_COMPARE(cache.count(), 3);
+
+    CORRADE_COMPARE(&cache.phong(), &a);
+    CORRADE_COMPARE(&cache.phong(Phong::Flag::DiffuseTexture, 1), &b);
+    CORRADE_COMPARE(&cache.phong(Phong::Flag::DiffuseTexture, 3), &c);
+
+    /* Joint count is ignored without skinning */
+    CORRADE_COMPARE(&cache.phong({}, 1, 16), &a);
+    CORRADE_COMPARE(cache.count(), 3);
+}
+
+void ShaderCacheGLTest::vertexColor() {
+    ShaderCache cache;
+
+    VertexColor2D& a = cache.vertexColor2D();
+    VertexColor3D& b = cache.vertexColor3D();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(cache.count(), 2);
+
+    CORRADE_COMPARE(&cache.vertexColor2D(), &a);
+    CORRADE_COMPARE(&cache.vertexColor3D(), &b);
+    CORRADE_COMPARE(cache.count(), 2);
+}
+
+void ShaderCacheGLTest::clear() {
+    ShaderCache cache;
+    cache.flat3D();
+    cache.phong();
+    cache.vertexColor3D();
+    CORRADE_COMPARE(cache.count(), 3);
+
+    cache.clear();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(cache.count(), 0);
+
+    /* The shaders get recreated on next use */
+    Phong& phong = cache.phong();
+    CORRADE_VERIFY(phong.id());
+    CORRADE_COMPARE(cache.count(), 1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::ShaderCacheGLTest)
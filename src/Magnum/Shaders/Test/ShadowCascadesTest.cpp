@@ -0,0 +1,163 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Shaders/ShadowCascades.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ShadowCascadesTest: TestSuite::Tester {
+    explicit ShadowCascadesTest();
+
+    void construct();
+    void constructInvalid();
+
+    void splitDistancesUniform();
+    void splitDistancesLogarithmic();
+    void setSplitLambdaInvalid();
+
+    void update();
+    void updateSnapToTexels();
+    void cascadeMask();
+};
+
+ShadowCascadesTest::ShadowCascadesTest() {
+    addTests({&ShadowCascadesTest::construct,
+              &ShadowCascadesTest::constructInvalid,
+
+              &ShadowCascadesTest::splitDistancesUniform,
+              &ShadowCascadesTest::splitDistancesLogarithmic,
+              &ShadowCascadesTest::setSplitLambdaInvalid,
+
+              &ShadowCascadesTest::update,
+              &ShadowCascadesTest::updateSnapToTexels,
+              &ShadowCascadesTest::cascadeMask});
+}
+
+void ShadowCascadesTest::construct() {
+    ShadowCascades cascades{3};
+    CORRADE_COMPARE(cascades.cascadeCount(), 3);
+    CORRADE_COMPARE(cascades.splitLambda(), 0.75f);
+    CORRADE_COMPARE(cascades.lightDirection(), (Vector3{0.0f, -1.0f, 0.0f}));
+    CORRADE_COMPARE(cascades.shadowMapSize(), 0);
+    CORRADE_COMPARE(cascades.casterDistance(), 0.0f);
+    CORRADE_COMPARE(cascades.splitDistances().size(), 4);
+    CORRADE_COMPARE(cascades.shadowMatrices().size(), 3);
+    CORRADE_COMPARE(cascades.textureMatrices().size(), 3);
+    CORRADE_COMPARE(cascades.frustums().size(), 3);
+    CORRADE_COMPARE(cascades.shadowMatrices()[2], Matrix4{});
+    CORRADE_COMPARE(cascades.frustums()[2], Frustum{});
+}
+
+void ShadowCascadesTest::constructInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ShadowCascades{0};
+    ShadowCascades{5};
+    CORRADE_COMPARE(out.str(),
+        "Shaders::ShadowCascades: expected 1 to 4 cascades but got 0\n"
+        "Shaders::ShadowCascades: expected 1 to 4 cascades but got 5\n");
+}
+
+void ShadowCascadesTest::splitDistancesUniform() {
+    Float distances[4];
+    ShadowCascades::splitDistances(1.0f, 100.0f, 0.0f, distances);
+    CORRADE_COMPARE(distances[0], 1.0f);
+    CORRADE_COMPARE(distances[1], 34.0f);
+    CORRADE_COMPARE(distances[2], 67.0f);
+    CORRADE_COMPARE(distances[3], 100.0f);
+}
+
+void ShadowCascadesTest::splitDistancesLogarithmic() {
+    Float distances[4];
+    ShadowCascades::splitDistances(1.0f, 1000.0f, 1.0f, distances);
+    CORRADE_COMPARE(distances[0], 1.0f);
+    CORRADE_COMPARE(distances[1], 10.0f);
+    CORRADE_COMPARE(distances[2], 100.0f);
+    CORRADE_COMPARE(distances[3], 1000.0f);
+}
+
+void ShadowCascadesTest::setSplitLambdaInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ShadowCascades cascades{2};
+    cascades.setSplitLambda(1.5f);
+    CORRADE_COMPARE(cascades.splitLambda(), 0.75f);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::ShadowCascades::setSplitLambda(): expected a value in range [0, 1] but got 1.5\n");
+}
+
+void ShadowCascadesTest::update() {
+    ShadowCascades cascades{2};
+    cascades.setSplitLambda(0.0f)
+        .update(Matrix4{}, Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+
+    CORRADE_COMPARE(cascades.splitDistances()[0], 1.0f);
+    CORRADE_COMPARE(cascades.splitDistances()[1], 50.5f);
+    CORRADE_COMPARE(cascades.splitDistances()[2], 100.0f);
+
+    /* Center of the first cascade is in the center of the shadow map */
+    CORRADE_COMPARE(cascades.textureMatrices()[0].transformPoint({0.0f, 0.0f, -25.75f}), Vector3{0.5f});
+
+    /* The camera is at origin, so the texture matrices are the shadow
+       matrices in the [0, 1] range */
+    const Vector3 point{10.0f, -5.0f, -70.0f};
+    CORRADE_COMPARE(cascades.textureMatrices()[1].transformPoint(point),
+        cascades.shadowMatrices()[1].transformPoint(point)*0.5f + Vector3{0.5f});
+}
+
+void ShadowCascadesTest::updateSnapToTexels() {
+    ShadowCascades cascades{1};
+    cascades.setShadowMapSize(1024)
+        .setLightDirection({1.0f, -1.0f, 0.3f})
+        .update(Matrix4::rotationY(Deg(35.0f))*Matrix4::translation({-3.3f, -2.0f, 7.1f}),
+            Matrix4::perspectiveProjection(Deg(60.0f), 1.5f, 0.5f, 50.0f));
+
+    /* The world origin should be projected to a texel corner */
+    const Vector2 origin = cascades.shadowMatrices()[0].transformPoint({}).xy()*512.0f;
+    CORRADE_COMPARE(origin, Vector2{Math::round(origin)});
+}
+
+void ShadowCascadesTest::cascadeMask() {
+    ShadowCascades cascades{2};
+    cascades.setSplitLambda(0.0f)
+        .update(Matrix4{}, Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+
+    /* Close to the camera, covered by both cascades */
+    CORRADE_COMPARE(cascades.cascadeMask({0.0f, 0.0f, -5.0f}, 1.0f), 3);
+    /* Far away, only in the second */
+    CORRADE_COMPARE(cascades.cascadeMask({0.0f, 0.0f, -200.0f}, 1.0f), 2);
+    /* Behind the camera, outside of both */
+    CORRADE_COMPARE(cascades.cascadeMask({0.0f, 0.0f, 500.0f}, 1.0f), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::ShadowCascadesTest)
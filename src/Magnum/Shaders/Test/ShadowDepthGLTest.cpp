@@ -0,0 +1,178 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Shaders/ShadowDepth.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ShadowDepthGLTest: GL::OpenGLTester {
+    explicit ShadowDepthGLTest();
+
+    void construct();
+    #ifndef MAGNUM_TARGET_GLES
+    void constructLayered();
+    void constructLayeredInvalidCount();
+    #endif
+
+    void constructMove();
+
+    void setShadowMatrices();
+    void setShadowMatricesWrongCount();
+    void setShadowMatrixOutOfBounds();
+};
+
+namespace {
+
+constexpr struct {
+    const char* name;
+    ShadowDepth::Flags flags;
+} ConstructData[]{
+    {"", {}},
+    {"instanced transformation", ShadowDepth::Flag::InstancedTransformation}
+};
+
+}
+
+ShadowDepthGLTest::ShadowDepthGLTest() {
+    addInstancedTests({&ShadowDepthGLTest::construct}, Containers::arraySize(ConstructData));
+
+    addTests({
+        #ifndef MAGNUM_TARGET_GLES
+        &ShadowDepthGLTest::constructLayered,
+        &ShadowDepthGLTest::constructLayeredInvalidCount,
+        #endif
+
+        &ShadowDepthGLTest::constructMove,
+
+        &ShadowDepthGLTest::setShadowMatrices,
+        &ShadowDepthGLTest::setShadowMatricesWrongCount,
+        &ShadowDepthGLTest::setShadowMatrixOutOfBounds});
+}
+
+void ShadowDepthGLTest::construct() {
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ShadowDepth shader{data.flags};
+    CORRADE_COMPARE(shader.flags(), data.flags);
+    CORRADE_COMPARE(shader.cascadeCount(), 1);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void ShadowDepthGLTest::constructLayered() {
+    if(!GL::Context::current().isVersionSupported(GL::Version::GL400))
+        CORRADE_SKIP("OpenGL 4.0 is not supported.");
+
+    ShadowDepth shader{ShadowDepth::Flag::LayeredCascades|ShadowDepth::Flag::InstancedTransformation, 3};
+    CORRADE_COMPARE(shader.flags(), ShadowDepth::Flag::LayeredCascades|ShadowDepth::Flag::InstancedTransformation);
+    CORRADE_COMPARE(shader.cascadeCount(), 3);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    shader.setShadowMatrices({{}, Matrix4::scaling(Vector3{0.5f}), {}});
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ShadowDepthGLTest::constructLayeredInvalidCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ShadowDepth{ShadowDepth::Flag::LayeredCascades, 0};
+    ShadowDepth{ShadowDepth::Flag::LayeredCascades, 5};
+    CORRADE_COMPARE(out.str(),
+        "Shaders::ShadowDepth: expected 1 to 4 cascades but got 0\n"
+        "Shaders::ShadowDepth: expected 1 to 4 cascades but got 5\n");
+}
+#endif
+
+void ShadowDepthGLTest::constructMove() {
+    ShadowDepth a{ShadowDepth::Flag::InstancedTransformation};
+    const GLuint id = a.id();
+    CORRADE_VERIFY(id);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    ShadowDepth b{std::move(a)};
+    CORRADE_COMPARE(b.id(), id);
+    CORRADE_COMPARE(b.flags(), ShadowDepth::Flag::InstancedTransformation);
+    CORRADE_VERIFY(!a.id());
+
+    ShadowDepth c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(c.id(), id);
+    CORRADE_COMPARE(c.flags(), ShadowDepth::Flag::InstancedTransformation);
+    CORRADE_VERIFY(!b.id());
+}
+
+void ShadowDepthGLTest::setShadowMatrices() {
+    ShadowDepth shader;
+    shader.setTransformationMatrix(Matrix4::translation({1.0f, 2.0f, 3.0f}))
+        .setShadowMatrices({Matrix4::orthographicProjection({2.0f, 2.0f}, -1.0f, 1.0f)})
+        .setShadowMatrix(Matrix4::scaling(Vector3{0.5f}));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ShadowDepthGLTest::setShadowMatricesWrongCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ShadowDepth shader;
+    shader.setShadowMatrices({{}, {}});
+    CORRADE_COMPARE(out.str(),
+        "Shaders::ShadowDepth::setShadowMatrices(): expected 1 items but got 2\n");
+}
+
+void ShadowDepthGLTest::setShadowMatrixOutOfBounds() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ShadowDepth shader;
+    shader.setShadowMatrix(1, {});
+    CORRADE_COMPARE(out.str(),
+        "Shaders::ShadowDepth::setShadowMatrix(): cascade ID 1 is out of bounds for 1 cascades\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::ShadowDepthGLTest)
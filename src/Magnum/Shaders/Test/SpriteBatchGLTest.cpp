@@ -0,0 +1,264 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/GL/TextureArray.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Shaders/Sprites.h"
+#include "Magnum/Shaders/SpriteBatch.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+using namespace Math::Literals;
+
+struct SpriteBatchGLTest: GL::OpenGLTester {
+    explicit SpriteBatchGLTest();
+
+    void construct();
+    void constructMove();
+
+    void addUpdate();
+    void draw();
+    void drawEmpty();
+
+    void constructInvalid();
+    void updateNoCreate();
+};
+
+SpriteBatchGLTest::SpriteBatchGLTest() {
+    addTests({&SpriteBatchGLTest::construct,
+              &SpriteBatchGLTest::constructMove,
+
+              &SpriteBatchGLTest::addUpdate,
+              &SpriteBatchGLTest::draw,
+              &SpriteBatchGLTest::drawEmpty,
+
+              &SpriteBatchGLTest::constructInvalid,
+              &SpriteBatchGLTest::updateNoCreate});
+}
+
+namespace {
+    bool isSupported() {
+        #ifndef MAGNUM_TARGET_GLES
+        return GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>();
+        #else
+        return true;
+        #endif
+    }
+}
+
+void SpriteBatchGLTest::construct() {
+    if(!isSupported())
+        CORRADE_SKIP("Instanced arrays are not supported.");
+
+    Sprites shader;
+    CORRADE_VERIFY(shader.id());
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+
+    SpriteBatch batch{{256, 128}};
+    CORRADE_COMPARE(batch.textureSize(), (Vector2i{256, 128}));
+    CORRADE_COMPARE(batch.size(), 0);
+    CORRADE_COMPARE(batch.capacity(), 0);
+    CORRADE_VERIFY(batch.buffer().id());
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void SpriteBatchGLTest::constructMove() {
+    if(!isSupported())
+        CORRADE_SKIP("Instanced arrays are not supported.");
+
+    SpriteBatch a{{64, 64}};
+    const GLuint id = a.buffer().id();
+    CORRADE_VERIFY(id);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    SpriteBatch b{std::move(a)};
+    CORRADE_COMPARE(b.textureSize(), Vector2i{64});
+    CORRADE_COMPARE(b.buffer().id(), id);
+    CORRADE_VERIFY(!a.buffer().id());
+
+    SpriteBatch c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(c.textureSize(), Vector2i{64});
+    CORRADE_COMPARE(c.buffer().id(), id);
+    CORRADE_VERIFY(!b.buffer().id());
+}
+
+void SpriteBatchGLTest::addUpdate() {
+    if(!isSupported())
+        CORRADE_SKIP("Instanced arrays are not supported.");
+
+    SpriteBatch batch{{64, 32}};
+    batch.reserve(2);
+    CORRADE_COMPARE(batch.capacity(), 2);
+    CORRADE_COMPARE(batch.buffer().size(), Int(2*72));
+
+    batch.add({}, Range3Di{{16, 8, 1}, {32, 32, 2}})
+        .add({}, Range2D{{0.25f, 0.5f}, {0.5f, 1.0f}}, 3);
+    CORRADE_COMPARE(batch.size(), 2);
+
+    /* Fits into the reserved capacity */
+    batch.update();
+    CORRADE_COMPARE(batch.capacity(), 2);
+    CORRADE_COMPARE(batch.mesh().instanceCount(), 2);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Doesn't fit anymore, the buffer gets enlarged */
+    batch.add({}, Range3Di{{}, {64, 32, 1}})
+        .update();
+    CORRADE_COMPARE(batch.capacity(), 3);
+    CORRADE_COMPARE(batch.buffer().size(), Int(3*72));
+    CORRADE_COMPARE(batch.mesh().instanceCount(), 3);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Clearing keeps the capacity, the mesh is updated only after update() */
+    batch.clear();
+    CORRADE_COMPARE(batch.size(), 0);
+    CORRADE_COMPARE(batch.mesh().instanceCount(), 3);
+    batch.update();
+    CORRADE_COMPARE(batch.capacity(), 3);
+    CORRADE_COMPARE(batch.mesh().instanceCount(), 0);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void SpriteBatchGLTest::draw() {
+    if(!isSupported())
+        CORRADE_SKIP("Instanced arrays are not supported.");
+
+    /* Two layers, the second one with a red top right quarter */
+    Color4ub data[2*4*4]{};
+    for(std::size_t y = 2; y != 4; ++y)
+        for(std::size_t x = 2; x != 4; ++x)
+            data[16 + y*4 + x] = 0xff0000ff_rgba;
+    GL::Texture2DArray texture;
+    texture.setMinificationFilter(GL::SamplerFilter::Nearest)
+        .setMagnificationFilter(GL::SamplerFilter::Nearest)
+        .setStorage(1, GL::TextureFormat::RGBA8, {4, 4, 2})
+        .setSubImage(0, {}, ImageView3D{PixelFormat::RGBA8Unorm, {4, 4, 2}, data});
+
+    GL::Renderbuffer color;
+    color.setStorage(GL::RenderbufferFormat::RGBA8, Vector2i{4});
+    GL::Framebuffer fb{{{}, Vector2i{4}}};
+    fb.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color)
+      .clearColor(0, Color4{})
+      .bind();
+
+    /* A sprite from the red quarter covering the left half of the viewport,
+       tinted to half-transparent */
+    SpriteBatch batch{{4, 4}};
+    batch.add(Matrix3::translation(Vector2::xAxis(-0.5f))*Matrix3::scaling({0.5f, 1.0f}),
+        Range3Di{{2, 2, 1}, {4, 4, 2}}, 0xffffff80_rgbaf)
+        .update();
+
+    Sprites shader;
+    shader.bindTexture(texture);
+    batch.draw(shader);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Image2D image = fb.read({{}, Vector2i{4}}, {GL::PixelFormat::RGBA, GL::PixelType::UnsignedByte});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const auto pixels = Containers::arrayCast<const Color4ub>(image.data());
+    CORRADE_COMPARE(pixels[0], (Color4ub{0xff, 0x00, 0x00, 0x80}));
+    CORRADE_COMPARE(pixels[3*4 + 1], (Color4ub{0xff, 0x00, 0x00, 0x80}));
+
+    /* The right half is left untouched */
+    CORRADE_COMPARE(pixels[2], Color4ub{});
+    CORRADE_COMPARE(pixels[3*4 + 3], Color4ub{});
+}
+
+void SpriteBatchGLTest::drawEmpty() {
+    if(!isSupported())
+        CORRADE_SKIP("Instanced arrays are not supported.");
+
+    GL::Renderbuffer color;
+    color.setStorage(GL::RenderbufferFormat::RGBA8, Vector2i{4});
+    GL::Framebuffer fb{{{}, Vector2i{4}}};
+    fb.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color)
+      .bind();
+
+    /* Nothing uploaded yet, shouldn't draw anything */
+    Sprites shader;
+    SpriteBatch batch{{4, 4}};
+    batch.update()
+        .draw(shader);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void SpriteBatchGLTest::constructInvalid() {
+    if(!isSupported())
+        CORRADE_SKIP("Instanced arrays are not supported.");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    SpriteBatch batch{{0, 16}};
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::SpriteBatch: expected a non-zero texture size, got Vector(0, 16)\n");
+}
+
+void SpriteBatchGLTest::updateNoCreate() {
+    if(!isSupported())
+        CORRADE_SKIP("Instanced arrays are not supported.");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Sprites shader;
+    SpriteBatch batch{NoCreate};
+    batch.reserve(16)
+        .update()
+        .draw(shader);
+
+    CORRADE_COMPARE(out.str(),
+        "Shaders::SpriteBatch::reserve(): the batch is moved-out or not created\n"
+        "Shaders::SpriteBatch::update(): the batch is moved-out or not created\n"
+        "Shaders::SpriteBatch::draw(): the batch is moved-out or not created\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::SpriteBatchGLTest)
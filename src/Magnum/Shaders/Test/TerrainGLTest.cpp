@@ -0,0 +1,126 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/TextureArray.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Terrain.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+using namespace Math::Literals;
+
+struct TerrainGLTest: GL::OpenGLTester {
+    explicit TerrainGLTest();
+
+    void construct();
+    void constructMove();
+
+    void setUniforms();
+    void bindTextures();
+
+    void setGridSizeInvalid();
+};
+
+TerrainGLTest::TerrainGLTest() {
+    addTests({&TerrainGLTest::construct,
+              &TerrainGLTest::constructMove,
+
+              &TerrainGLTest::setUniforms,
+              &TerrainGLTest::bindTextures,
+
+              &TerrainGLTest::setGridSizeInvalid});
+}
+
+void TerrainGLTest::construct() {
+    Terrain shader;
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void TerrainGLTest::constructMove() {
+    Terrain a;
+    const GLuint id = a.id();
+    CORRADE_VERIFY(id);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Terrain b{std::move(a)};
+    CORRADE_COMPARE(b.id(), id);
+    CORRADE_VERIFY(!a.id());
+
+    Terrain c{NoCreate};
+    c = std::move(b);
+    CORRADE_COMPARE(c.id(), id);
+    CORRADE_VERIFY(!b.id());
+}
+
+void TerrainGLTest::setUniforms() {
+    Terrain shader;
+    shader.setTransformationProjectionMatrix(Matrix4::perspectiveProjection(35.0_degf, 1.0f, 0.1f, 100.0f))
+        .setCameraPosition({1.0f, 20.0f, -3.0f})
+        .setGridSize(16)
+        .setHeightRange({-5.0f, 100.0f})
+        .setLightDirection(Vector3{-1.0f, -1.0f, 0.0f}.normalized())
+        .setColor(0x339966_rgbf)
+        .setAmbientColor(0x111111_rgbf);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void TerrainGLTest::bindTextures() {
+    GL::Texture2DArray heightmap;
+    heightmap.setStorage(1, GL::TextureFormat::R16F, {65, 65, 4});
+
+    Terrain shader;
+    shader.bindHeightmapTexture(heightmap);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void TerrainGLTest::setGridSizeInvalid() {
+    Terrain shader;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.setGridSize(15);
+    shader.setGridSize(0);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::Terrain::setGridSize(): expected a positive even size, got 15\n"
+        "Shaders::Terrain::setGridSize(): expected a positive even size, got 0\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::TerrainGLTest)
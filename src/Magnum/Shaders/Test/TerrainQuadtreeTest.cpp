@@ -0,0 +1,267 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/TerrainQuadtree.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct TerrainQuadtreeTest: TestSuite::Tester {
+    explicit TerrainQuadtreeTest();
+
+    void construct();
+    void constructInvalid();
+    void setInvalid();
+
+    void tiles();
+    void tilesInvalid();
+
+    void selectNoRootTile();
+    void selectMissingChildren();
+    void selectMissingGrandchild();
+    void select();
+    void selectCulled();
+    void selectTileResolution();
+};
+
+TerrainQuadtreeTest::TerrainQuadtreeTest() {
+    addTests({&TerrainQuadtreeTest::construct,
+              &TerrainQuadtreeTest::constructInvalid,
+              &TerrainQuadtreeTest::setInvalid,
+
+              &TerrainQuadtreeTest::tiles,
+              &TerrainQuadtreeTest::tilesInvalid,
+
+              &TerrainQuadtreeTest::selectNoRootTile,
+              &TerrainQuadtreeTest::selectMissingChildren,
+              &TerrainQuadtreeTest::selectMissingGrandchild,
+              &TerrainQuadtreeTest::select,
+              &TerrainQuadtreeTest::selectCulled,
+              &TerrainQuadtreeTest::selectTileResolution});
+}
+
+namespace {
+
+/* Frustum containing the whole terrain */
+const Frustum Everything = Frustum::fromMatrix(Matrix4::orthographicProjection({1000.0f, 1000.0f}, -1000.0f, 1000.0f));
+
+void setAllTiles(TerrainQuadtree& quadtree) {
+    Int layer = 0;
+    for(UnsignedInt level = 0; level != quadtree.levelCount(); ++level) {
+        const UnsignedInt count = 1u << (quadtree.levelCount() - level - 1);
+        for(UnsignedInt y = 0; y != count; ++y)
+            for(UnsignedInt x = 0; x != count; ++x)
+                quadtree.setTile(level, {x, y}, layer++);
+    }
+}
+
+std::size_t countPatches(const TerrainQuadtree& quadtree, Float size) {
+    std::size_t count = 0;
+    for(const TerrainPatch& patch: quadtree.patches())
+        if(patch.offsetSize.z() == size) ++count;
+    return count;
+}
+
+}
+
+void TerrainQuadtreeTest::construct() {
+    TerrainQuadtree quadtree{{-4.0f, 2.0f}, 8.0f, 3};
+    CORRADE_COMPARE(quadtree.origin(), (Vector2{-4.0f, 2.0f}));
+    CORRADE_COMPARE(quadtree.size(), 8.0f);
+    CORRADE_COMPARE(quadtree.levelCount(), 3);
+    CORRADE_COMPARE(quadtree.patchSize(0), 2.0f);
+    CORRADE_COMPARE(quadtree.patchSize(1), 4.0f);
+    CORRADE_COMPARE(quadtree.patchSize(2), 8.0f);
+    CORRADE_COMPARE(quadtree.heightRange(), (Vector2{0.0f, 1.0f}));
+    CORRADE_COMPARE(quadtree.detailDistance(), 4.0f);
+    CORRADE_COMPARE(quadtree.morphStart(), 0.7f);
+    CORRADE_COMPARE(quadtree.tileResolution(), 0);
+    CORRADE_VERIFY(quadtree.patches().empty());
+    CORRADE_VERIFY(quadtree.missingTiles().empty());
+}
+
+void TerrainQuadtreeTest::constructInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    TerrainQuadtree{{}, 8.0f, 0};
+    TerrainQuadtree{{}, 8.0f, 17};
+    TerrainQuadtree{{}, 0.0f, 3};
+    CORRADE_COMPARE(out.str(),
+        "Shaders::TerrainQuadtree: expected 1 to 16 levels, got 0\n"
+        "Shaders::TerrainQuadtree: expected 1 to 16 levels, got 17\n"
+        "Shaders::TerrainQuadtree: expected positive size, got 0\n");
+}
+
+void TerrainQuadtreeTest::setInvalid() {
+    TerrainQuadtree quadtree{{}, 8.0f, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    quadtree.patchSize(3);
+    quadtree.setDetailDistance(0.0f);
+    quadtree.setMorphStart(1.0f);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::TerrainQuadtree::patchSize(): level 3 out of range for 3 levels\n"
+        "Shaders::TerrainQuadtree::setDetailDistance(): expected positive distance, got 0\n"
+        "Shaders::TerrainQuadtree::setMorphStart(): expected a value in range [0, 1), got 1\n");
+}
+
+void TerrainQuadtreeTest::tiles() {
+    TerrainQuadtree quadtree{{}, 8.0f, 3};
+    CORRADE_COMPARE(quadtree.tileLayer(1, {1, 0}), -1);
+
+    quadtree.setTile(1, {1, 0}, 5)
+        .setTile(0, {1, 0}, 7);
+    CORRADE_COMPARE(quadtree.tileLayer(1, {1, 0}), 5);
+    CORRADE_COMPARE(quadtree.tileLayer(0, {1, 0}), 7);
+    CORRADE_COMPARE(quadtree.tileLayer(1, {0, 1}), -1);
+
+    quadtree.removeTile(1, {1, 0});
+    CORRADE_COMPARE(quadtree.tileLayer(1, {1, 0}), -1);
+    CORRADE_COMPARE(quadtree.tileLayer(0, {1, 0}), 7);
+}
+
+void TerrainQuadtreeTest::tilesInvalid() {
+    TerrainQuadtree quadtree{{}, 8.0f, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    quadtree.setTile(3, {}, 0);
+    quadtree.setTile(1, {0, 2}, 0);
+    quadtree.setTile(1, {1, 1}, -1);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::TerrainQuadtree::setTile(): level 3 out of range for 3 levels\n"
+        "Shaders::TerrainQuadtree::setTile(): tile Vector(0, 2) out of range for level 1\n"
+        "Shaders::TerrainQuadtree::setTile(): expected non-negative layer, got -1\n");
+}
+
+void TerrainQuadtreeTest::selectNoRootTile() {
+    TerrainQuadtree quadtree{{}, 8.0f, 3};
+    quadtree.select({1.0f, 0.5f, 1.0f}, Everything);
+
+    CORRADE_VERIFY(quadtree.patches().empty());
+    CORRADE_COMPARE(quadtree.missingTiles().size(), 1);
+    CORRADE_COMPARE(quadtree.missingTiles()[0].level, 2);
+    CORRADE_COMPARE(quadtree.missingTiles()[0].coordinates, Vector2ui{});
+}
+
+void TerrainQuadtreeTest::selectMissingChildren() {
+    TerrainQuadtree quadtree{{}, 8.0f, 3};
+    quadtree.setTile(2, {}, 3)
+        .setTile(1, {1, 1}, 4);
+    quadtree.select({1.0f, 0.5f, 1.0f}, Everything);
+
+    /* The root can't be refined, so it's drawn alone at its level, morphing
+       from 70% of its range */
+    CORRADE_COMPARE(quadtree.patches().size(), 1);
+    CORRADE_COMPARE(quadtree.patches()[0].offsetSize, (Vector3{0.0f, 0.0f, 8.0f}));
+    CORRADE_COMPARE(quadtree.patches()[0].morphRange, (Vector2{11.2f, 16.0f}));
+    CORRADE_COMPARE(quadtree.patches()[0].tileTextureTransformation, (Vector4{0.0f, 0.0f, 1.0f, 3.0f}));
+
+    /* The resident child is not listed */
+    CORRADE_COMPARE(quadtree.missingTiles().size(), 3);
+    CORRADE_COMPARE(quadtree.missingTiles()[0].level, 1);
+    CORRADE_COMPARE(quadtree.missingTiles()[0].coordinates, (Vector2ui{0, 0}));
+    CORRADE_COMPARE(quadtree.missingTiles()[1].level, 1);
+    CORRADE_COMPARE(quadtree.missingTiles()[1].coordinates, (Vector2ui{1, 0}));
+    CORRADE_COMPARE(quadtree.missingTiles()[2].level, 1);
+    CORRADE_COMPARE(quadtree.missingTiles()[2].coordinates, (Vector2ui{0, 1}));
+}
+
+void TerrainQuadtreeTest::selectMissingGrandchild() {
+    TerrainQuadtree quadtree{{}, 8.0f, 3};
+    setAllTiles(quadtree);
+    quadtree.removeTile(0, {0, 0});
+    quadtree.select({1.0f, 0.5f, 1.0f}, Everything);
+
+    /* The first level 1 node can't be refined, the two next to it can and
+       the diagonal one is outside of the finest range */
+    CORRADE_COMPARE(quadtree.patches().size(), 10);
+    CORRADE_COMPARE(countPatches(quadtree, 4.0f), 2);
+    CORRADE_COMPARE(countPatches(quadtree, 2.0f), 8);
+
+    CORRADE_COMPARE(quadtree.missingTiles().size(), 1);
+    CORRADE_COMPARE(quadtree.missingTiles()[0].level, 0);
+    CORRADE_COMPARE(quadtree.missingTiles()[0].coordinates, (Vector2ui{0, 0}));
+}
+
+void TerrainQuadtreeTest::select() {
+    /* Eight units large terrain with 2-unit patches at the finest level,
+       which are used up to 4 units from the camera by default */
+    TerrainQuadtree quadtree{{}, 8.0f, 3};
+    setAllTiles(quadtree);
+    quadtree.select({1.0f, 0.5f, 1.0f}, Everything);
+
+    /* The diagonal level 1 node is about 4.24 units away, which is outside
+       of the finest range of 4 units, the rest is refined */
+    CORRADE_COMPARE(quadtree.patches().size(), 13);
+    CORRADE_COMPARE(countPatches(quadtree, 4.0f), 1);
+    CORRADE_COMPARE(countPatches(quadtree, 2.0f), 12);
+    CORRADE_VERIFY(quadtree.missingTiles().empty());
+
+    /* Level 0 is first, in order of the children */
+    CORRADE_COMPARE(quadtree.patches()[0].offsetSize, (Vector3{0.0f, 0.0f, 2.0f}));
+    CORRADE_COMPARE(quadtree.patches()[0].morphRange, (Vector2{2.8f, 4.0f}));
+    CORRADE_COMPARE(quadtree.patches()[0].tileTextureTransformation, (Vector4{0.0f, 0.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(quadtree.patches()[1].offsetSize, (Vector3{2.0f, 0.0f, 2.0f}));
+    CORRADE_COMPARE(quadtree.patches()[1].tileTextureTransformation, (Vector4{0.0f, 0.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(quadtree.patches()[12].offsetSize, (Vector3{4.0f, 4.0f, 4.0f}));
+    CORRADE_COMPARE(quadtree.patches()[12].morphRange, (Vector2{5.6f, 8.0f}));
+    CORRADE_COMPARE(quadtree.patches()[12].tileTextureTransformation, (Vector4{0.0f, 0.0f, 1.0f, 19.0f}));
+
+    /* With the camera far away the root is drawn alone */
+    quadtree.select({100.0f, 0.5f, 100.0f}, Everything);
+    CORRADE_COMPARE(quadtree.patches().size(), 1);
+    CORRADE_COMPARE(quadtree.patches()[0].offsetSize, (Vector3{0.0f, 0.0f, 8.0f}));
+}
+
+void TerrainQuadtreeTest::selectCulled() {
+    TerrainQuadtree quadtree{{}, 8.0f, 3};
+    setAllTiles(quadtree);
+
+    /* Covers world X from -2.5 to 2.5 */
+    quadtree.select({1.0f, 0.5f, 1.0f}, Frustum::fromMatrix(Matrix4::orthographicProjection({5.0f, 1000.0f}, -1000.0f, 1000.0f)));
+    CORRADE_COMPARE(quadtree.patches().size(), 8);
+    CORRADE_COMPARE(countPatches(quadtree, 2.0f), 8);
+    for(const TerrainPatch& patch: quadtree.patches())
+        CORRADE_VERIFY(patch.offsetSize.x() < 4.0f);
+}
+
+void TerrainQuadtreeTest::selectTileResolution() {
+    TerrainQuadtree quadtree{{}, 8.0f, 3};
+    quadtree.setTile(2, {}, 3)
+        .setTileResolution(5)
+        .select({100.0f, 0.5f, 100.0f}, Everything);
+
+    CORRADE_COMPARE(quadtree.patches().size(), 1);
+    CORRADE_COMPARE(quadtree.patches()[0].tileTextureTransformation, (Vector4{0.1f, 0.1f, 0.8f, 3.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::TerrainQuadtreeTest)
@@ -23,7 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Magnum/GL/Context.h"
 #include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Version.h"
 #include "Magnum/Shaders/Vector.h"
 
 namespace Magnum { namespace Shaders { namespace Test {
@@ -33,6 +35,12 @@ struct VectorGLTest: GL::OpenGLTester {
 
     void construct2D();
     void construct3D();
+    void constructVertexColor2D();
+    void constructVertexColor3D();
+    #ifndef MAGNUM_TARGET_GLES2
+    void constructTextureArrays2D();
+    void constructTextureArrays3D();
+    #endif
 
     void constructMove2D();
     void constructMove3D();
@@ -41,6 +49,12 @@ struct VectorGLTest: GL::OpenGLTester {
 VectorGLTest::VectorGLTest() {
     addTests({&VectorGLTest::construct2D,
               &VectorGLTest::construct3D,
+              &VectorGLTest::constructVertexColor2D,
+              &VectorGLTest::constructVertexColor3D,
+              #ifndef MAGNUM_TARGET_GLES2
+              &VectorGLTest::constructTextureArrays2D,
+              &VectorGLTest::constructTextureArrays3D,
+              #endif
 
               &VectorGLTest::constructMove2D,
               &VectorGLTest::constructMove3D});
@@ -68,6 +82,66 @@ void VectorGLTest::construct3D() {
     }
 }
 
+void VectorGLTest::constructVertexColor2D() {
+    Vector2D shader{Vector2D::Flag::VertexColor};
+    CORRADE_COMPARE(shader.flags(), Vector2D::Flag::VertexColor);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void VectorGLTest::constructVertexColor3D() {
+    Vector3D shader{Vector3D::Flag::VertexColor};
+    CORRADE_COMPARE(shader.flags(), Vector3D::Flag::VertexColor);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void VectorGLTest::constructTextureArrays2D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isVersionSupported(GL::Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+    #endif
+
+    Vector2D shader{Vector2D::Flag::TextureArrays};
+    CORRADE_COMPARE(shader.flags(), Vector2D::Flag::TextureArrays);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void VectorGLTest::constructTextureArrays3D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isVersionSupported(GL::Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+    #endif
+
+    Vector3D shader{Vector3D::Flag::TextureArrays|Vector3D::Flag::VertexColor};
+    CORRADE_COMPARE(shader.flags(), Vector3D::Flag::TextureArrays|Vector3D::Flag::VertexColor);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("macOS drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.id());
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+#endif
+
 void VectorGLTest::constructMove2D() {
     Vector2D a;
     const GLuint id = a.id();
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Shaders/Vector.h"
@@ -37,6 +38,9 @@ struct VectorTest: TestSuite::Tester {
 
     void constructCopy2D();
     void constructCopy3D();
+
+    void debugFlag();
+    void debugFlags();
 };
 
 VectorTest::VectorTest() {
@@ -44,7 +48,10 @@ VectorTest::VectorTest() {
               &VectorTest::constructNoCreate3D,
 
               &VectorTest::constructCopy2D,
-              &VectorTest::constructCopy3D});
+              &VectorTest::constructCopy3D,
+
+              &VectorTest::debugFlag,
+              &VectorTest::debugFlags});
 }
 
 void VectorTest::constructNoCreate2D() {
@@ -75,6 +82,20 @@ void VectorTest::constructCopy3D() {
     CORRADE_VERIFY(!(std::is_assignable<Vector3D, const Vector3D&>{}));
 }
 
+void VectorTest::debugFlag() {
+    std::ostringstream out;
+
+    Debug{&out} << Vector2D::Flag::VertexColor << Vector2D::Flag(0xf0);
+    CORRADE_COMPARE(out.str(), "Shaders::AbstractVector::Flag::VertexColor Shaders::AbstractVector::Flag(0xf0)\n");
+}
+
+void VectorTest::debugFlags() {
+    std::ostringstream out;
+
+    Debug{&out} << (Vector3D::Flag::VertexColor|Vector3D::Flag::MultiChannel) << Vector3D::Flags{};
+    CORRADE_COMPARE(out.str(), "Shaders::AbstractVector::Flag::VertexColor|Shaders::AbstractVector::Flag::MultiChannel Shaders::AbstractVector::Flags{}\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::VectorTest)
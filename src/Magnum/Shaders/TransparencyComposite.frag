@@ -0,0 +1,51 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 0)
+#endif
+uniform highp sampler2D accumulationTexture;
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 1)
+#endif
+uniform highp sampler2D weightTexture;
+
+out lowp vec4 color;
+
+void main() {
+    highp ivec2 coordinates = ivec2(gl_FragCoord.xy);
+    highp vec4 accumulation = texelFetch(accumulationTexture, coordinates, 0);
+
+    /* Alpha of the accumulation is the revealage, product of (1 - alpha) of
+       all fragments. Nothing transparent was drawn here, keep the opaque
+       color as-is. */
+    if(accumulation.a == 1.0) discard;
+
+    /* Normalize the color by the weights, the revealage is used for blending
+       over the opaque geometry */
+    highp float weight = texelFetch(weightTexture, coordinates, 0).r;
+    color = vec4(accumulation.rgb/max(weight, 1.0e-5), accumulation.a);
+}
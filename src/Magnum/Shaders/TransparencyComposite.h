@@ -0,0 +1,128 @@
+#ifndef Magnum_Shaders_TransparencyComposite_h
+#define Magnum_Shaders_TransparencyComposite_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::TransparencyComposite
+ */
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Weighted blended transparency composite shader
+
+Composites the output of @ref Phong::Flag::WeightedBlendedTransparency over
+the opaque geometry. Draws a full-screen triangle created with
+@ref MeshTools::fullScreenTriangle(), normalizing the accumulated color by the
+accumulated weight from textures bound with @ref bindAccumulationTexture()
+and @ref bindWeightTexture(). The output alpha is the revealage, so the
+result is meant to be blended over the opaque geometry with
+@ref GL::Renderer::BlendFunction::OneMinusSourceAlpha as the source and
+@ref GL::Renderer::BlendFunction::SourceAlpha as the destination factor.
+Pixels not covered by any transparent geometry are discarded.
+
+@code{.cpp}
+GL::Mesh triangle = MeshTools::fullScreenTriangle().second;
+
+Shaders::TransparencyComposite compositeShader;
+
+// each frame, after the transparency pass
+GL::defaultFramebuffer.bind();
+GL::Renderer::disable(GL::Renderer::Feature::DepthTest);
+GL::Renderer::setBlendFunction(
+    GL::Renderer::BlendFunction::OneMinusSourceAlpha,
+    GL::Renderer::BlendFunction::SourceAlpha);
+compositeShader
+    .bindAccumulationTexture(accumulation)
+    .bindWeightTexture(weight);
+triangle.draw(compositeShader);
+@endcode
+
+See @ref Shaders-Phong-usage-transparency for the transparency pass setup.
+
+@requires_gl30 Extension @gl_extension{EXT,gpu_shader4} for
+    @glsl gl_VertexID @ce and @glsl texelFetch() @ce
+@requires_gles30 Not available in OpenGL ES 2.0.
+@requires_webgl20 Not available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT TransparencyComposite: public GL::AbstractShaderProgram {
+    public:
+        /** @brief Constructor */
+        explicit TransparencyComposite();
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         */
+        explicit TransparencyComposite(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        TransparencyComposite(const TransparencyComposite&) = delete;
+
+        /** @brief Move constructor */
+        TransparencyComposite(TransparencyComposite&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        TransparencyComposite& operator=(const TransparencyComposite&) = delete;
+
+        /** @brief Move assignment */
+        TransparencyComposite& operator=(TransparencyComposite&&) noexcept = default;
+
+        /**
+         * @brief Bind accumulation texture
+         * @return Reference to self (for method chaining)
+         *
+         * Expects a @ref GL::TextureFormat::RGBA16F texture rendered to from
+         * @ref Phong::AccumulationOutput.
+         */
+        TransparencyComposite& bindAccumulationTexture(GL::Texture2D& texture);
+
+        /**
+         * @brief Bind weight texture
+         * @return Reference to self (for method chaining)
+         *
+         * Expects a @ref GL::TextureFormat::R16F texture rendered to from
+         * @ref Phong::WeightOutput.
+         */
+        TransparencyComposite& bindWeightTexture(GL::Texture2D& texture);
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -41,7 +41,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "AbstractVector3D.vert"; }
 }
 
-template<UnsignedInt dimensions> Vector<dimensions>::Vector() {
+template<UnsignedInt dimensions> Vector<dimensions>::Vector(const Flags flags): AbstractVector<dimensions>{flags} {
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
     if(!Utility::Resource::hasGroup("MagnumShaders"))
@@ -49,6 +49,15 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector() {
     #endif
     Utility::Resource rs("MagnumShaders");
 
+    /* Array samplers need GLSL 1.30 */
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & AbstractVector<dimensions>::Flag::TextureArrays)
+        MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    #elif !defined(MAGNUM_TARGET_GLES2)
+    if(flags & AbstractVector<dimensions>::Flag::TextureArrays)
+        MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GLES300);
+    #endif
+
     #ifndef MAGNUM_TARGET_GLES
     const GL::Version version = GL::Context::current().supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
     #else
@@ -58,26 +67,42 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector() {
     GL::Shader vert = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Vertex);
     GL::Shader frag = Implementation::createCompatibilityShader(rs, version, GL::Shader::Type::Fragment);
 
-    vert.addSource(rs.get("generic.glsl"))
+    vert.addSource(flags & AbstractVector<dimensions>::Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        #ifndef MAGNUM_TARGET_GLES2
+        .addSource(flags & AbstractVector<dimensions>::Flag::TextureArrays ? "#define TEXTURE_ARRAYS\n" : "")
+        #endif
+        .addSource(rs.get("generic.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
-    frag.addSource(rs.get("Vector.frag"));
-
-    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
-
-    GL::AbstractShaderProgram::attachShaders({vert,  frag});
-
-    #ifndef MAGNUM_TARGET_GLES
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
-    #else
-    if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
-    #endif
-    {
-        GL::AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Position::Location, "position");
-        GL::AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::TextureCoordinates::Location, "textureCoordinates");
+    frag.addSource(flags & AbstractVector<dimensions>::Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        #ifndef MAGNUM_TARGET_GLES2
+        .addSource(flags & AbstractVector<dimensions>::Flag::TextureArrays ? "#define TEXTURE_ARRAYS\n" : "")
+        #endif
+        .addSource(rs.get("Vector.frag"));
+
+    /* Load the program from the binary cache, if there's one, otherwise
+       compile and link it from the sources */
+    if(!GL::AbstractShaderProgram::loadCachedBinary({vert, frag})) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+
+        GL::AbstractShaderProgram::attachShaders({vert,  frag});
+
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version))
+        #else
+        if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
+        #endif
+        {
+            GL::AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Position::Location, "position");
+            GL::AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::TextureCoordinates::Location, "textureCoordinates");
+            if(flags & AbstractVector<dimensions>::Flag::VertexColor)
+                GL::AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Color3::Location, "vertexColor"); /* Color4 is the same */
+        }
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(GL::AbstractShaderProgram::link());
+
+        GL::AbstractShaderProgram::saveCachedBinary({vert, frag});
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::AbstractShaderProgram::link());
-
     #ifndef MAGNUM_TARGET_GLES
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(version))
     #endif
@@ -46,9 +46,19 @@ uniform lowp vec4 color
 #ifdef EXPLICIT_TEXTURE_LAYER
 layout(binding = 15)
 #endif
+#ifndef TEXTURE_ARRAYS
 uniform lowp sampler2D vectorTexture;
 
 in mediump vec2 fragmentTextureCoordinates;
+#else
+uniform lowp sampler2DArray vectorTexture;
+
+in mediump vec3 fragmentTextureCoordinates;
+#endif
+
+#ifdef VERTEX_COLOR
+in lowp vec4 interpolatedVertexColor;
+#endif
 
 #ifdef NEW_GLSL
 out lowp vec4 fragmentColor;
@@ -56,5 +66,9 @@ out lowp vec4 fragmentColor;
 
 void main() {
     lowp float intensity = texture(vectorTexture, fragmentTextureCoordinates).r;
-    fragmentColor = mix(backgroundColor, color, intensity);
+    fragmentColor = mix(backgroundColor,
+        #ifdef VERTEX_COLOR
+        interpolatedVertexColor*
+        #endif
+        color, intensity);
 }
@@ -67,7 +67,15 @@ Common rendering setup:
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Vector: public AbstractVector<dimensions> {
     public:
-        explicit Vector();
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        typedef typename AbstractVector<dimensions>::Flags Flags;
+        #endif
+
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit Vector(Flags flags = {});
 
         /**
          * @brief Construct without creating the underlying OpenGL object
@@ -126,6 +134,8 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Vector: public Abst
          * @return Reference to self (for method chaining)
          *
          * Default is @cpp 0xffffffff_rgbaf @ce.
+         * If @ref Flag::VertexColor is set, the color is multiplied with
+         * the @ref Color3 / @ref Color4 attribute as well.
          * @see @ref setBackgroundColor()
          */
         Vector<dimensions>& setColor(const Color4& color) {
@@ -26,3 +26,8 @@
 #define POSITION_ATTRIBUTE_LOCATION 0
 #define TEXTURECOORDINATES_ATTRIBUTE_LOCATION 1
 #define NORMAL_ATTRIBUTE_LOCATION 2
+#define COLOR_ATTRIBUTE_LOCATION 3
+#define TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION 4
+#define NORMAL_MATRIX_ATTRIBUTE_LOCATION 8
+#define JOINTIDS_ATTRIBUTE_LOCATION 11
+#define WEIGHTS_ATTRIBUTE_LOCATION 12
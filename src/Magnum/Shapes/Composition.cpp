@@ -63,14 +63,36 @@ Because these values are relative to parent, they don't need to be modified
 when concatenating.
 */
 
-template<UnsignedInt dimensions> Composition<dimensions>::Composition(const Composition<dimensions>& other): _shapes(other._shapes.size()), _nodes(other._nodes.size()) {
+/*
+Evaluation notes:
+
+Every shape is a leaf of the tree exactly once and the shapes are in the same
+order as the leafs, so the tree is compiled into a program with one
+instruction for each shape. The instruction says where to continue if the
+shape collides and where if it doesn't, which is either one of the following
+shapes or one of the two final results. NOT swaps the targets, AND continues
+to the right operand only if the left one collides and OR only if it doesn't,
+which gives the same short-circuit evaluation as walking the tree, only
+without the recursion. Because the targets always point forward, the program
+is executed in a single loop.
+
+The evaluation starts at the entry point of the root node, which isn't
+necessarily the first shape -- if the left operand of the root is empty, it
+never collides, so the evaluation either starts directly at the right
+operand or the result is known without testing any shape at all.
+*/
+
+template<UnsignedInt dimensions> Composition<dimensions>::Composition(const Composition<dimensions>& other): _shapes(other._shapes.size()), _nodes(other._nodes.size()), _program(other._program.size()), _entry(other._entry) {
     copyShapes(0, other);
     copyNodes(0, other);
+    std::copy(other._program.begin(), other._program.end(), _program.begin());
 }
 
-template<UnsignedInt dimensions> Composition<dimensions>::Composition(Composition<dimensions>&& other): _shapes(std::move(other._shapes)), _nodes(std::move(other._nodes)) {
+template<UnsignedInt dimensions> Composition<dimensions>::Composition(Composition<dimensions>&& other): _shapes(std::move(other._shapes)), _nodes(std::move(other._nodes)), _program(std::move(other._program)), _entry(other._entry) {
     other._shapes = nullptr;
     other._nodes = nullptr;
+    other._program = nullptr;
+    other._entry = False;
 }
 
 template<UnsignedInt dimensions> Composition<dimensions>::~Composition() {
@@ -88,8 +110,13 @@ template<UnsignedInt dimensions> Composition<dimensions>& Composition<dimensions
     if(_nodes.size() != other._nodes.size())
         _nodes = Containers::Array<Node>(other._nodes.size());
 
+    if(_program.size() != other._program.size())
+        _program = Containers::Array<Instruction>(other._program.size());
+
     copyShapes(0, other);
     copyNodes(0, other);
+    std::copy(other._program.begin(), other._program.end(), _program.begin());
+    _entry = other._entry;
     return *this;
 }
 
@@ -97,6 +124,8 @@ template<UnsignedInt dimensions> Composition<dimensions>& Composition<dimensions
     using std::swap;
     swap(other._shapes, _shapes);
     swap(other._nodes, _nodes);
+    swap(other._program, _program);
+    swap(other._entry, _entry);
     return *this;
 }
 
@@ -124,31 +153,56 @@ template<UnsignedInt dimensions> Composition<dimensions> Composition<dimensions>
     return out;
 }
 
-template<UnsignedInt dimensions> bool Composition<dimensions>::collides(const Implementation::AbstractShape<dimensions>& a, const std::size_t node, const std::size_t shapeBegin, const std::size_t shapeEnd) const {
-    /* Empty group */
-    if(shapeBegin == shapeEnd) return false;
+template<UnsignedInt dimensions> void Composition<dimensions>::compile() {
+    _program = Containers::Array<Instruction>(_shapes.size());
+    _entry = _nodes.size() ? compile(0, 0, _shapes.size(), True, False) : False;
+}
+
+template<UnsignedInt dimensions> std::size_t Composition<dimensions>::compile(const std::size_t node, const std::size_t shapeBegin, const std::size_t shapeEnd, const std::size_t ifTrue, const std::size_t ifFalse) {
+    /* Empty group never collides */
+    if(shapeBegin == shapeEnd) return ifFalse;
 
     CORRADE_INTERNAL_ASSERT(node < _nodes.size() && shapeBegin < shapeEnd);
 
-    /* Collision on the left child. If the node is leaf one (no left child
-       exists), do it directly, recurse instead. */
-    const bool collidesLeft = (_nodes[node].rightNode == 0 || _nodes[node].rightNode == 2) ?
-        Implementation::collides(a, *_shapes[shapeBegin]) :
-        collides(a, node+1, shapeBegin, shapeBegin+_nodes[node].rightShape);
+    /* Entry point of the left child. If the node is leaf one (no left child
+       exists), the entry point is the shape itself, recurse instead. A leaf
+       without any shape is an empty composition, which never collides. */
+    const auto left = [&](const std::size_t ifTrue, const std::size_t ifFalse) {
+        if(_nodes[node].rightNode == 0 || _nodes[node].rightNode == 2) {
+            if(_nodes[node].rightShape == 0) return ifFalse;
+            _program[shapeBegin] = {ifTrue, ifFalse};
+            return shapeBegin;
+        }
+        return compile(node+1, shapeBegin, shapeBegin+_nodes[node].rightShape, ifTrue, ifFalse);
+    };
 
     /* NOT operation */
     if(_nodes[node].operation == CompositionOperation::Not)
-        return !collidesLeft;
+        return left(ifFalse, ifTrue);
+
+    /* Entry point of the right child. Similar to the left child. */
+    std::size_t right;
+    if(_nodes[node].rightNode < 2) {
+        right = shapeBegin+_nodes[node].rightShape;
+        if(right == shapeEnd) right = ifFalse;
+        else _program[right] = {ifTrue, ifFalse};
+    } else right = compile(node+_nodes[node].rightNode-1, shapeBegin+_nodes[node].rightShape, shapeEnd, ifTrue, ifFalse);
 
     /* Short-circuit evaluation for AND/OR */
-    if((_nodes[node].operation == CompositionOperation::Or) == collidesLeft)
-        return collidesLeft;
-
-    /* Now the collision result depends only on the right child. Similar to
-       collision on the left child. */
-    return (_nodes[node].rightNode < 2) ?
-        Implementation::collides(a, *_shapes[shapeBegin+_nodes[node].rightShape]) :
-        collides(a, node+_nodes[node].rightNode-1, shapeBegin+_nodes[node].rightShape, shapeEnd);
+    return _nodes[node].operation == CompositionOperation::Or ?
+        left(ifTrue, right) : left(right, ifFalse);
+}
+
+template<UnsignedInt dimensions> bool Composition<dimensions>::collides(const Implementation::AbstractShape<dimensions>& a) const {
+    /* The result is known without testing any shape */
+    if(_entry == True) return true;
+    if(_entry == False) return false;
+
+    std::size_t i = _entry;
+    while(i < _program.size())
+        i = Implementation::collides(a, *_shapes[i]) ? _program[i].ifTrue : _program[i].ifFalse;
+
+    return i == True;
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -184,11 +184,21 @@ template<UnsignedInt dimensions> class CORRADE_DEPRECATED("scheduled for removal
             CompositionOperation operation;
         };
 
-        bool collides(const Implementation::AbstractShape<dimensions>& a) const {
-            return collides(a, 0, 0, _shapes.size());
-        }
+        /* Where to continue after testing the shape of the same index */
+        struct Instruction {
+            std::size_t ifTrue, ifFalse;
+        };
+
+        /* Final results of the program */
+        enum: std::size_t {
+            True = ~std::size_t{},
+            False = ~std::size_t{} - 1
+        };
+
+        bool collides(const Implementation::AbstractShape<dimensions>& a) const;
 
-        bool collides(const Implementation::AbstractShape<dimensions>& a, std::size_t node, std::size_t shapeBegin, std::size_t shapeEnd) const;
+        void compile();
+        std::size_t compile(std::size_t node, std::size_t shapeBegin, std::size_t shapeEnd, std::size_t ifTrue, std::size_t ifFalse);
 
         template<class T> constexpr static std::size_t shapeCount(const T&) {
             return 1;
@@ -214,6 +224,9 @@ template<UnsignedInt dimensions> class CORRADE_DEPRECATED("scheduled for removal
 
         Containers::Array<Implementation::AbstractShape<dimensions>*> _shapes;
         Containers::Array<Node> _nodes;
+        Containers::Array<Instruction> _program;
+        /* Instruction where the evaluation starts, or directly the result */
+        std::size_t _entry{False};
 };
 
 /**
@@ -361,6 +374,7 @@ template<UnsignedInt dimensions> template<class T> Composition<dimensions>::Comp
     _nodes[0].rightShape = shapeCount(a);
     copyNodes(1, a);
     copyShapes(0, std::forward<T>(a));
+    compile();
 }
 
 template<UnsignedInt dimensions> template<class T, class U> Composition<dimensions>::Composition(CompositionOperation operation, T&& a, U&& b): _shapes(shapeCount(a) + shapeCount(b)), _nodes(nodeCount(a) + nodeCount(b) + 1) {
@@ -380,6 +394,7 @@ template<UnsignedInt dimensions> template<class T, class U> Composition<dimensio
     copyNodes(nodeCount(a) + 1, b);
     copyShapes(shapeCount(a), std::forward<U>(b));
     copyShapes(0, std::forward<T>(a));
+    compile();
 }
 
 template<UnsignedInt dimensions> template<class T> inline const T& Composition<dimensions>::get(std::size_t i) const {
@@ -27,10 +27,23 @@
 
 #include "ShapeGroup.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "Magnum/Shapes/AbstractShape.h"
 
 namespace Magnum { namespace Shapes {
 
+namespace {
+
+/* Unlike Math::intersects() this treats the maximum as inclusive, so
+   zero-size bounds of points can overlap too */
+template<UnsignedInt dimensions> inline bool overlaps(const Math::Range<dimensions, Float>& a, const Math::Range<dimensions, Float>& b) {
+    return (a.min() <= b.max()).all() && (b.min() <= a.max()).all();
+}
+
+}
+
 CORRADE_IGNORE_DEPRECATED_PUSH
 template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
     /* Clean all objects */
@@ -43,18 +56,66 @@ template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
         SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
     }
 
+    /* Update the bounds. Shapes could have been added or removed since the
+       last time, in that case the order has to be recreated from scratch. */
+    _bounds.resize(this->size());
+    for(std::size_t i = 0; i != this->size(); ++i)
+        _bounds[i] = Implementation::getAbstractShape((*this)[i]).bounds();
+    if(_sorted.size() != this->size()) {
+        _sorted.resize(this->size());
+        std::iota(_sorted.begin(), _sorted.end(), 0);
+    }
+
+    /* Insertion sort, which is close to linear if the shapes moved only a
+       little since the last time */
+    for(std::size_t i = 1; i < _sorted.size(); ++i) {
+        const UnsignedInt index = _sorted[i];
+        const Float min = _bounds[index].min().x();
+        std::size_t j = i;
+        for(; j && _bounds[_sorted[j - 1]].min().x() > min; --j)
+            _sorted[j] = _sorted[j - 1];
+        _sorted[j] = index;
+    }
+
     dirty = false;
 }
 
 template<UnsignedInt dimensions> AbstractShape<dimensions>* ShapeGroup<dimensions>::firstCollision(const AbstractShape<dimensions>& shape) {
     setClean();
+    const Math::Range<dimensions, Float> bounds = Implementation::getAbstractShape(shape).bounds();
     for(std::size_t i = 0; i != this->size(); ++i)
-        if(&(*this)[i] != &shape && (*this)[i].collides(shape))
+        if(&(*this)[i] != &shape && overlaps(_bounds[i], bounds) && (*this)[i].collides(shape))
             return &(*this)[i];
 
     return nullptr;
 }
 
+template<UnsignedInt dimensions> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> ShapeGroup<dimensions>::collisions() {
+    setClean();
+
+    /* Sweep along X, for each shape test only the following ones that start
+       before it ends */
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> pairs;
+    for(std::size_t i = 0; i != _sorted.size(); ++i) {
+        const UnsignedInt a = _sorted[i];
+        const Float max = _bounds[a].max().x();
+        for(std::size_t j = i + 1; j != _sorted.size() && _bounds[_sorted[j]].min().x() <= max; ++j) {
+            const UnsignedInt b = _sorted[j];
+            if(overlaps(_bounds[a], _bounds[b]) && (*this)[a].collides((*this)[b]))
+                pairs.emplace_back(std::min(a, b), std::max(a, b));
+        }
+    }
+
+    /* Make the output independent of the sweep order */
+    std::sort(pairs.begin(), pairs.end());
+
+    std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> out;
+    out.reserve(pairs.size());
+    for(const std::pair<UnsignedInt, UnsignedInt>& pair: pairs)
+        out.emplace_back(&(*this)[pair.first], &(*this)[pair.second]);
+    return out;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT ShapeGroup<2>;
 template class MAGNUM_SHAPES_EXPORT ShapeGroup<3>;
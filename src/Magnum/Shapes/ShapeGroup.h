@@ -37,8 +37,10 @@
     has a @ref examples-box2d "Magnum example" as well.
 */
 
+#include <utility>
 #include <vector>
 
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/FeatureGroup.h"
 #include "Magnum/Shapes/AbstractShape.h"
 #include "Magnum/Shapes/visibility.h"
@@ -60,6 +62,19 @@ CORRADE_IGNORE_DEPRECATED_PUSH
     as well.
 
 See @ref Shape for more information. See @ref shapes for brief introduction.
+
+@section Shapes-ShapeGroup-broadphase Broadphase
+
+On every @ref setClean() the group calculates axis-aligned bounds of all
+transformed shapes and keeps the shapes sorted by the bounds along the X axis.
+The exact collision test is then done only for shapes with overlapping
+bounds --- in @ref firstCollision() the bounds are checked before testing each
+shape and @ref collisions() uses sweep-and-prune on the sorted list to avoid
+testing all pairs. Because the order from previous call is reused, the sorting
+is close to linear if the shapes move only a little between the calls.
+
+Lines, cylinders, inverted spheres, planes and compositions are considered
+unbounded, so they are always tested exactly.
 @see @ref scenegraph, @ref ShapeGroup2D, @ref ShapeGroup3D
 */
 template<UnsignedInt dimensions> class CORRADE_DEPRECATED("scheduled for removal, see the docs for alternatives") MAGNUM_SHAPES_EXPORT ShapeGroup: public SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float> {
@@ -93,7 +108,8 @@ template<UnsignedInt dimensions> class CORRADE_DEPRECATED("scheduled for removal
          * @brief Set the group and all bodies as clean
          *
          * This function is called before computing any collisions to ensure
-         * all objects are cleaned.
+         * all objects are cleaned. Also updates the broadphase data, see
+         * @ref Shapes-ShapeGroup-broadphase for more information.
          */
         void setClean();
 
@@ -106,8 +122,22 @@ template<UnsignedInt dimensions> class CORRADE_DEPRECATED("scheduled for removal
          */
         AbstractShape<dimensions>* firstCollision(const AbstractShape<dimensions>& shape);
 
+        /**
+         * @brief All collisions in the group
+         *
+         * Returns all pairs of colliding shapes, each pair only once, ordered
+         * by position of the shapes in the group. Calls @ref setClean() before
+         * the operation. See @ref Shapes-ShapeGroup-broadphase for more
+         * information.
+         */
+        std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> collisions();
+
     private:
         bool dirty;
+        /* Transformed shape bounds indexed by shape position in the group and
+           shape indices sorted by minimal X coordinate of the bounds */
+        std::vector<Math::Range<dimensions, Float>> _bounds;
+        std::vector<UnsignedInt> _sorted;
 };
 
 /**
@@ -44,7 +44,10 @@ struct CompositionTest: TestSuite::Tester {
     void ored();
     void multipleUnary();
     void hierarchy();
+    void hierarchyNested();
     void empty();
+    void emptyOperand();
+    void emptyNestedOperand();
 
     void copy();
     void move();
@@ -57,7 +60,10 @@ CompositionTest::CompositionTest() {
               &CompositionTest::ored,
               &CompositionTest::multipleUnary,
               &CompositionTest::hierarchy,
+              &CompositionTest::hierarchyNested,
               &CompositionTest::empty,
+              &CompositionTest::emptyOperand,
+              &CompositionTest::emptyNestedOperand,
 
               &CompositionTest::copy,
               &CompositionTest::move,
@@ -127,6 +133,27 @@ void CompositionTest::hierarchy() {
     VERIFY_NOT_COLLIDES(a, Shapes::Point3D(Vector3(0.25f)));
 }
 
+void CompositionTest::hierarchyNested() {
+    const Shapes::Sphere2D a{{}, 1.0f};
+    const Shapes::Sphere2D b{Vector2::xAxis(1.0f), 1.0f};
+    const Shapes::Sphere2D c{Vector2::yAxis(1.0f), 0.5f};
+    const Shapes::Sphere2D d{{0.5f, 0.5f}, 0.75f};
+    const Shapes::Composition2D composition =
+        !(Shapes::Sphere2D{a} && !Shapes::Sphere2D{b}) ||
+        (!!Shapes::Sphere2D{c} && (Shapes::Sphere2D{d} || !(Shapes::Sphere2D{a} || Shapes::Sphere2D{c})));
+
+    CORRADE_COMPARE(composition.size(), 6);
+
+    /* Verify against the same expression evaluated directly */
+    for(Float y = -2.0f; y < 2.0f; y += 0.25f) {
+        for(Float x = -2.0f; x < 2.0f; x += 0.25f) {
+            const Shapes::Point2D p{{x, y}};
+            const bool expected = !(a % p && !(b % p)) || (c % p && (d % p || !(a % p || c % p)));
+            CORRADE_COMPARE(composition % p, expected);
+        }
+    }
+}
+
 void CompositionTest::empty() {
     const Shapes::Composition2D a;
 
@@ -135,6 +162,65 @@ void CompositionTest::empty() {
     VERIFY_NOT_COLLIDES(a, Shapes::Sphere2D({}, 1.0f));
 }
 
+void CompositionTest::emptyOperand() {
+    const Shapes::Sphere2D a{{}, 1.0f};
+    const Shapes::Composition2D empty;
+
+    /* Empty composition never collides, so the evaluation either starts
+       directly at the other operand or the result is known upfront */
+    const Shapes::Composition2D emptyAnd = empty && Shapes::Sphere2D{a};
+    const Shapes::Composition2D andEmpty = Shapes::Sphere2D{a} && empty;
+    const Shapes::Composition2D emptyOr = empty || Shapes::Sphere2D{a};
+    const Shapes::Composition2D orEmpty = Shapes::Sphere2D{a} || empty;
+    const Shapes::Composition2D notEmptyAnd = !(empty && Shapes::Sphere2D{a});
+    const Shapes::Composition2D notEmptyOr = !(empty || Shapes::Sphere2D{a});
+    CORRADE_COMPARE(emptyAnd.size(), 1);
+    CORRADE_COMPARE(andEmpty.size(), 1);
+
+    for(Float x = -2.0f; x < 2.0f; x += 0.25f) {
+        const Shapes::Point2D p{{x, 0.0f}};
+        CORRADE_COMPARE(emptyAnd % p, false);
+        CORRADE_COMPARE(andEmpty % p, false);
+        CORRADE_COMPARE(emptyOr % p, a % p);
+        CORRADE_COMPARE(orEmpty % p, a % p);
+        CORRADE_COMPARE(notEmptyAnd % p, true);
+        CORRADE_COMPARE(notEmptyOr % p, !(a % p));
+    }
+}
+
+void CompositionTest::emptyNestedOperand() {
+    const Shapes::Sphere2D a{{}, 1.0f};
+    const Shapes::Sphere2D b{Vector2::xAxis(1.0f), 1.0f};
+
+    /* An operation on an empty composition has no shapes, but unlike an
+       empty composition it has a node in the hierarchy. Such operand never
+       collides, even if negated. The expected values are the same as given
+       by the recursive evaluation of the tree. */
+    const Shapes::Composition2D empty = !Shapes::Composition2D{};
+    const Shapes::Composition2D emptyAnd = empty && Shapes::Sphere2D{a};
+    const Shapes::Composition2D andEmpty = Shapes::Sphere2D{a} && empty;
+    const Shapes::Composition2D emptyOr = empty || Shapes::Sphere2D{a};
+    const Shapes::Composition2D orEmpty = Shapes::Sphere2D{a} || empty;
+    const Shapes::Composition2D notEmptyAnd = !empty && Shapes::Sphere2D{a};
+    const Shapes::Composition2D notEmptyOr = !empty || Shapes::Sphere2D{a};
+    const Shapes::Composition2D nested = Shapes::Sphere2D{b} || (empty && Shapes::Sphere2D{a});
+    CORRADE_COMPARE(empty.size(), 0);
+    CORRADE_COMPARE(emptyAnd.size(), 1);
+    CORRADE_COMPARE(nested.size(), 2);
+
+    VERIFY_NOT_COLLIDES(empty, Shapes::Point2D{});
+    for(Float x = -2.0f; x < 3.0f; x += 0.25f) {
+        const Shapes::Point2D p{{x, 0.0f}};
+        CORRADE_COMPARE(emptyAnd % p, false);
+        CORRADE_COMPARE(andEmpty % p, false);
+        CORRADE_COMPARE(emptyOr % p, a % p);
+        CORRADE_COMPARE(orEmpty % p, a % p);
+        CORRADE_COMPARE(notEmptyAnd % p, false);
+        CORRADE_COMPARE(notEmptyOr % p, a % p);
+        CORRADE_COMPARE(nested % p, b % p);
+    }
+}
+
 void CompositionTest::copy() {
     const Shapes::Composition3D a = Shapes::Sphere3D({}, 1.0f) &&
         (Shapes::Point3D(Vector3::xAxis(1.5f)) || !Shapes::AxisAlignedBox3D({}, Vector3(0.5f)));
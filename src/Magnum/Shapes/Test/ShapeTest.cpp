@@ -28,6 +28,7 @@
 #define _MAGNUM_DO_NOT_WARN_DEPRECATED_SHAPES
 
 #include "Magnum/Shapes/Composition.h"
+#include "Magnum/Shapes/Cylinder.h"
 #include "Magnum/Shapes/Point.h"
 #include "Magnum/Shapes/Shape.h"
 #include "Magnum/Shapes/ShapeGroup.h"
@@ -45,6 +46,8 @@ struct ShapeTest: TestSuite::Tester {
     void collides();
     void collision();
     void firstCollision();
+    void collisions();
+    void collisionsMoved();
     void shapeGroup();
 };
 
@@ -58,6 +61,8 @@ ShapeTest::ShapeTest() {
               &ShapeTest::collides,
               &ShapeTest::collision,
               &ShapeTest::firstCollision,
+              &ShapeTest::collisions,
+              &ShapeTest::collisionsMoved,
               &ShapeTest::shapeGroup});
 }
 
@@ -209,6 +214,82 @@ void ShapeTest::firstCollision() {
     CORRADE_VERIFY(!shapes.isDirty());
 }
 
+void ShapeTest::collisions() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    /* Added in reverse X order to verify the output is ordered by position in
+       the group and not by the sweep */
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{4.0f, 0.0f, 0.0f}, 1.5f}, &shapes);
+
+    Object3D b(&scene);
+    Shape<Shapes::Point3D> bShape(b, {{3.0f, 0.5f, 0.0f}}, &shapes);
+
+    /* Overlaps with A on X, but not on Y */
+    Object3D c(&scene);
+    Shape<Shapes::Point3D> cShape(c, {{4.0f, 5.0f, 0.0f}}, &shapes);
+
+    Object3D d(&scene);
+    Shape<Shapes::Sphere3D> dShape(d, {{-1.0f, 0.0f, 0.0f}, 1.0f}, &shapes);
+
+    Object3D e(&scene);
+    Shape<Shapes::Point3D> eShape(e, {{-1.5f, 0.0f, 0.0f}}, &shapes);
+
+    /* Unbounded shape is tested against everything */
+    Object3D f(&scene);
+    Shape<Shapes::Cylinder3D> fShape(f, {{4.0f, 5.0f, 0.0f}, {4.0f, 5.0f, 1.0f}, 0.5f}, &shapes);
+
+    std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>> collisions = shapes.collisions();
+    CORRADE_VERIFY(!shapes.isDirty());
+    CORRADE_COMPARE(collisions.size(), 3);
+    CORRADE_VERIFY(collisions[0].first == &aShape);
+    CORRADE_VERIFY(collisions[0].second == &bShape);
+    CORRADE_VERIFY(collisions[1].first == &cShape);
+    CORRADE_VERIFY(collisions[1].second == &fShape);
+    CORRADE_VERIFY(collisions[2].first == &dShape);
+    CORRADE_VERIFY(collisions[2].second == &eShape);
+
+    /* The bounds don't prevent finding the collision with the cylinder */
+    CORRADE_VERIFY(shapes.firstCollision(cShape) == &fShape);
+}
+
+void ShapeTest::collisionsMoved() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    Shape<Shapes::Point2D> bShape(b, {{3.0f, 0.0f}}, &shapes);
+
+    CORRADE_VERIFY(shapes.collisions().empty());
+
+    /* Move the point past the sphere so the sorted order changes */
+    b.translate(Vector2::xAxis(-3.5f));
+    CORRADE_VERIFY(shapes.isDirty());
+    std::vector<std::pair<AbstractShape2D*, AbstractShape2D*>> collisions = shapes.collisions();
+    CORRADE_COMPARE(collisions.size(), 1);
+    CORRADE_VERIFY(collisions[0].first == &aShape);
+    CORRADE_VERIFY(collisions[0].second == &bShape);
+
+    /* Adding a shape recreates the order */
+    Object2D c(&scene);
+    Shape<Shapes::Point2D> cShape(c, {{0.25f, 0.5f}}, &shapes);
+    collisions = shapes.collisions();
+    CORRADE_COMPARE(collisions.size(), 2);
+    CORRADE_VERIFY(collisions[0].first == &aShape);
+    CORRADE_VERIFY(collisions[0].second == &bShape);
+    CORRADE_VERIFY(collisions[1].first == &aShape);
+    CORRADE_VERIFY(collisions[1].second == &cShape);
+
+    /* Moving far away removes the collisions */
+    a.translate(Vector2::yAxis(10.0f));
+    CORRADE_VERIFY(shapes.collisions().empty());
+    CORRADE_VERIFY(!shapes.firstCollision(bShape));
+}
+
 void ShapeTest::shapeGroup() {
     Scene2D scene;
     ShapeGroup2D shapes;
@@ -27,8 +27,22 @@
 
 #include "shapeImplementation.h"
 
+#include <limits>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Composition.h"
+#include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/LineSegment.h"
+#include "Magnum/Shapes/Plane.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+
 namespace Magnum { namespace Shapes { namespace Implementation {
 
 CORRADE_IGNORE_DEPRECATED_PUSH
@@ -75,6 +89,94 @@ Debug& operator<<(Debug& debug, ShapeDimensionTraits<3>::Type value) {
     return debug << "Shapes::Shape3D::Type(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
 }
 
+namespace {
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> infiniteBounds() {
+    return {VectorTypeFor<dimensions, Float>{-std::numeric_limits<Float>::infinity()},
+            VectorTypeFor<dimensions, Float>{std::numeric_limits<Float>::infinity()}};
+}
+
+}
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> bounds(const Shapes::Point<dimensions>& shape) {
+    return {shape.position(), shape.position()};
+}
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> bounds(const Shapes::Line<dimensions>&) {
+    return infiniteBounds<dimensions>();
+}
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> bounds(const Shapes::LineSegment<dimensions>& shape) {
+    return {Math::min(shape.a(), shape.b()), Math::max(shape.a(), shape.b())};
+}
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> bounds(const Shapes::Sphere<dimensions>& shape) {
+    return {shape.position() - VectorTypeFor<dimensions, Float>{shape.radius()},
+            shape.position() + VectorTypeFor<dimensions, Float>{shape.radius()}};
+}
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> bounds(const Shapes::InvertedSphere<dimensions>&) {
+    return infiniteBounds<dimensions>();
+}
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> bounds(const Shapes::Cylinder<dimensions>&) {
+    /* The cylinder is infinite */
+    return infiniteBounds<dimensions>();
+}
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> bounds(const Shapes::Capsule<dimensions>& shape) {
+    const VectorTypeFor<dimensions, Float> radius{shape.radius()};
+    return {Math::min(shape.a(), shape.b()) - radius,
+            Math::max(shape.a(), shape.b()) + radius};
+}
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> bounds(const Shapes::AxisAlignedBox<dimensions>& shape) {
+    /* Negative scaling could have swapped the corners */
+    return {Math::min(shape.min(), shape.max()), Math::max(shape.min(), shape.max())};
+}
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> bounds(const Shapes::Box<dimensions>& shape) {
+    /* The box is a transformed [-1, 1] cube, its half-extent in each
+       dimension is a sum of absolute values of the axes in that dimension */
+    const auto rotationScaling = shape.transformation().rotationScaling();
+    VectorTypeFor<dimensions, Float> halfExtent;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        halfExtent += Math::abs(rotationScaling[i]);
+
+    const VectorTypeFor<dimensions, Float> center = shape.transformation().translation();
+    return {center - halfExtent, center + halfExtent};
+}
+
+template<UnsignedInt dimensions> Math::Range<dimensions, Float> bounds(const Shapes::Composition<dimensions>&) {
+    /* Negations make the composition unbounded, not worth analyzing */
+    return infiniteBounds<dimensions>();
+}
+
+Range3D bounds(const Shapes::Plane&) {
+    return infiniteBounds<3>();
+}
+
+template Math::Range<2, Float> bounds<2>(const Shapes::Point<2>&);
+template Math::Range<3, Float> bounds<3>(const Shapes::Point<3>&);
+template Math::Range<2, Float> bounds<2>(const Shapes::Line<2>&);
+template Math::Range<3, Float> bounds<3>(const Shapes::Line<3>&);
+template Math::Range<2, Float> bounds<2>(const Shapes::LineSegment<2>&);
+template Math::Range<3, Float> bounds<3>(const Shapes::LineSegment<3>&);
+template Math::Range<2, Float> bounds<2>(const Shapes::Sphere<2>&);
+template Math::Range<3, Float> bounds<3>(const Shapes::Sphere<3>&);
+template Math::Range<2, Float> bounds<2>(const Shapes::InvertedSphere<2>&);
+template Math::Range<3, Float> bounds<3>(const Shapes::InvertedSphere<3>&);
+template Math::Range<2, Float> bounds<2>(const Shapes::Cylinder<2>&);
+template Math::Range<3, Float> bounds<3>(const Shapes::Cylinder<3>&);
+template Math::Range<2, Float> bounds<2>(const Shapes::Capsule<2>&);
+template Math::Range<3, Float> bounds<3>(const Shapes::Capsule<3>&);
+template Math::Range<2, Float> bounds<2>(const Shapes::AxisAlignedBox<2>&);
+template Math::Range<3, Float> bounds<3>(const Shapes::AxisAlignedBox<3>&);
+template Math::Range<2, Float> bounds<2>(const Shapes::Box<2>&);
+template Math::Range<3, Float> bounds<3>(const Shapes::Box<3>&);
+template Math::Range<2, Float> bounds<2>(const Shapes::Composition<2>&);
+template Math::Range<3, Float> bounds<3>(const Shapes::Composition<3>&);
+
 template<UnsignedInt dimensions> AbstractShape<dimensions>::~AbstractShape() = default;
 template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape() = default;
 
@@ -30,6 +30,7 @@
 
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Shapes/Shapes.h"
 #include "Magnum/Shapes/visibility.h"
 
@@ -151,6 +152,21 @@ template<UnsignedInt dimensions> struct TypeOf<Shapes::Composition<dimensions>>
     }
 };
 
+/* Axis-aligned bounds of a shape, used for broadphase collision detection in
+   ShapeGroup. Shapes that are unbounded or too complex for a tight estimate
+   return an infinite range, so they are always tested exactly. */
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Math::Range<dimensions, Float> bounds(const Shapes::Point<dimensions>& shape);
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Math::Range<dimensions, Float> bounds(const Shapes::Line<dimensions>& shape);
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Math::Range<dimensions, Float> bounds(const Shapes::LineSegment<dimensions>& shape);
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Math::Range<dimensions, Float> bounds(const Shapes::Sphere<dimensions>& shape);
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Math::Range<dimensions, Float> bounds(const Shapes::InvertedSphere<dimensions>& shape);
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Math::Range<dimensions, Float> bounds(const Shapes::Cylinder<dimensions>& shape);
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Math::Range<dimensions, Float> bounds(const Shapes::Capsule<dimensions>& shape);
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Math::Range<dimensions, Float> bounds(const Shapes::AxisAlignedBox<dimensions>& shape);
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Math::Range<dimensions, Float> bounds(const Shapes::Box<dimensions>& shape);
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Math::Range<dimensions, Float> bounds(const Shapes::Composition<dimensions>& shape);
+MAGNUM_SHAPES_EXPORT Range3D bounds(const Shapes::Plane& shape);
+
 /* Polymorphic shape wrappers */
 
 template<UnsignedInt dimensions> struct MAGNUM_SHAPES_EXPORT AbstractShape {
@@ -160,6 +176,8 @@ template<UnsignedInt dimensions> struct MAGNUM_SHAPES_EXPORT AbstractShape {
     virtual typename ShapeDimensionTraits<dimensions>::Type MAGNUM_SHAPES_LOCAL type() const = 0;
     virtual AbstractShape<dimensions> MAGNUM_SHAPES_LOCAL * clone() const = 0;
     virtual void MAGNUM_SHAPES_LOCAL transform(const MatrixTypeFor<dimensions, Float>& matrix, AbstractShape<dimensions>* result) const = 0;
+
+    virtual Math::Range<dimensions, Float> MAGNUM_SHAPES_LOCAL bounds() const = 0;
 };
 
 template<class T> struct Shape: AbstractShape<T::Dimensions> {
@@ -181,6 +199,10 @@ template<class T> struct Shape: AbstractShape<T::Dimensions> {
         CORRADE_INTERNAL_ASSERT(result->type() == type());
         static_cast<Shape<T>*>(result)->shape = shape.transformed(matrix);
     }
+
+    Math::Range<T::Dimensions, Float> bounds() const override {
+        return Implementation::bounds(shape);
+    }
 };
 CORRADE_IGNORE_DEPRECATED_POP
 
@@ -0,0 +1,274 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <atomic>
+#include <thread>
+#endif
+
+#include "Magnum/AbstractStreamingResourceLoader.h"
+#include "Magnum/ResourceManager.h"
+
+namespace Magnum { namespace Test {
+
+struct AbstractStreamingResourceLoaderTest: TestSuite::Tester {
+    explicit AbstractStreamingResourceLoaderTest();
+
+    void levels();
+    void notFound();
+    void priority();
+    void byteBudget();
+    void unloadedWhileStreaming();
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void threads();
+    #endif
+};
+
+typedef Magnum::ResourceManager<Int> ResourceManager;
+
+/* Resources with keys "0" to "9" exist and have as many levels as their
+   number plus one, loaded data is level index times hundred, each level is
+   one byte larger than the previous one */
+class IntStreamingResourceLoader: public AbstractStreamingResourceLoader<Int, Int> {
+    public:
+        explicit IntStreamingResourceLoader(ResourcePolicy policy = ResourcePolicy::Budgeted): AbstractStreamingResourceLoader<Int, Int>{policy} {}
+
+        /* Resource number times ten plus level index */
+        std::vector<UnsignedInt> uploaded;
+
+    private:
+        UnsignedInt doLevelCount(ResourceKey key) override {
+            for(UnsignedInt i = 0; i != 10; ++i)
+                if(key == ResourceKey{std::to_string(i)}) return i + 1;
+            return 0;
+        }
+
+        Int doLoadLevel(ResourceKey, UnsignedInt level) override {
+            return level*100;
+        }
+
+        std::size_t doDataSize(const Int& data) override {
+            return data/100 + 1;
+        }
+
+        Int* doUpload(ResourceKey key, UnsignedInt level, Int& data) override {
+            for(UnsignedInt i = 0; i != 10; ++i)
+                if(key == ResourceKey{std::to_string(i)})
+                    uploaded.push_back(i*10 + level);
+            return new Int{data};
+        }
+};
+
+AbstractStreamingResourceLoaderTest::AbstractStreamingResourceLoaderTest() {
+    addTests({&AbstractStreamingResourceLoaderTest::levels,
+              &AbstractStreamingResourceLoaderTest::notFound,
+              &AbstractStreamingResourceLoaderTest::priority,
+              &AbstractStreamingResourceLoaderTest::byteBudget,
+              &AbstractStreamingResourceLoaderTest::unloadedWhileStreaming,
+              #ifndef CORRADE_TARGET_EMSCRIPTEN
+              &AbstractStreamingResourceLoaderTest::threads
+              #endif
+              });
+}
+
+void AbstractStreamingResourceLoaderTest::levels() {
+    ResourceManager rm;
+    auto loader = new IntStreamingResourceLoader;
+    rm.setLoader(loader);
+
+    Resource<Int> resource = rm.get<Int>("2");
+    CORRADE_COMPARE(resource.state(), ResourceState::Loading);
+    CORRADE_COMPARE(loader->streamingCount(), 1);
+
+    /* Nothing to upload yet */
+    CORRADE_COMPARE(loader->upload(100), 0);
+    CORRADE_COMPARE(resource.state(), ResourceState::Loading);
+
+    /* The next level isn't loaded until the previous one is uploaded */
+    CORRADE_VERIFY(loader->loadNext());
+    CORRADE_VERIFY(!loader->loadNext());
+    CORRADE_COMPARE(loader->upload(100), 1);
+    CORRADE_COMPARE(resource.state(), ResourceState::Mutable);
+    CORRADE_COMPARE(*resource, 0);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 1);
+
+    CORRADE_VERIFY(loader->loadNext());
+    CORRADE_COMPARE(loader->upload(100), 2);
+    CORRADE_COMPARE(resource.state(), ResourceState::Mutable);
+    CORRADE_COMPARE(*resource, 100);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 2);
+
+    /* Last level is final */
+    CORRADE_VERIFY(loader->loadNext());
+    CORRADE_COMPARE(loader->upload(100), 3);
+    CORRADE_COMPARE(resource.state(), ResourceState::Final);
+    CORRADE_COMPARE(*resource, 200);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 3);
+    CORRADE_COMPARE(loader->streamingCount(), 0);
+    CORRADE_VERIFY(!loader->loadNext());
+    CORRADE_COMPARE(loader->loadedCount(), 3);
+}
+
+void AbstractStreamingResourceLoaderTest::notFound() {
+    ResourceManager rm;
+    auto loader = new IntStreamingResourceLoader;
+    rm.setLoader(loader);
+
+    Resource<Int> resource = rm.get<Int>("nonexistent");
+    CORRADE_COMPARE(resource.state(), ResourceState::NotFound);
+    CORRADE_COMPARE(loader->streamingCount(), 0);
+    CORRADE_COMPARE(loader->notFoundCount(), 1);
+    CORRADE_VERIFY(!loader->loadNext());
+}
+
+void AbstractStreamingResourceLoaderTest::priority() {
+    ResourceManager rm;
+    auto loader = new IntStreamingResourceLoader;
+    rm.setLoader(loader);
+
+    Resource<Int> a = rm.get<Int>("1");
+    Resource<Int> b = rm.get<Int>("2");
+    Resource<Int> c = rm.get<Int>("3");
+
+    /* Priority for resources that aren't streaming is ignored */
+    loader->setPriority("5", 5.0f);
+    loader->setPriority("2", 2.0f);
+    loader->setPriority("3", 3.0f);
+    CORRADE_COMPARE(loader->priority("5"), 0.0f);
+    CORRADE_COMPARE(loader->priority("1"), 0.0f);
+    CORRADE_COMPARE(loader->priority("3"), 3.0f);
+
+    /* Loads "3" first, then "2" */
+    CORRADE_VERIFY(loader->loadNext());
+    CORRADE_VERIFY(loader->loadNext());
+    CORRADE_COMPARE(c.state(), ResourceState::Loading);
+    CORRADE_COMPARE(loader->upload(1), 1);
+    CORRADE_COMPARE(c.state(), ResourceState::Mutable);
+    CORRADE_COMPARE(b.state(), ResourceState::Loading);
+
+    /* Change the priority, "1" is loaded and uploaded before "3" now */
+    loader->setPriority("1", 4.0f);
+    CORRADE_VERIFY(loader->loadNext());
+    CORRADE_VERIFY(loader->loadNext());
+    CORRADE_VERIFY(!loader->loadNext());
+    CORRADE_COMPARE(loader->upload(100), 4);
+
+    CORRADE_COMPARE(loader->uploaded, (std::vector<UnsignedInt>{30, 10, 31, 20}));
+}
+
+void AbstractStreamingResourceLoaderTest::byteBudget() {
+    ResourceManager rm;
+    auto loader = new IntStreamingResourceLoader;
+    rm.setLoader(loader);
+
+    Resource<Int> a = rm.get<Int>("4");
+    Resource<Int> b = rm.get<Int>("5");
+    loader->setPriority("4", 1.0f);
+    for(UnsignedInt i = 0; i != 2; ++i) {
+        CORRADE_VERIFY(loader->loadNext());
+        CORRADE_VERIFY(loader->loadNext());
+        CORRADE_COMPARE(loader->upload(100), 2*(i + 1));
+    }
+
+    /* Third level of both is three bytes, only one fits */
+    CORRADE_VERIFY(loader->loadNext());
+    CORRADE_VERIFY(loader->loadNext());
+    CORRADE_COMPARE(loader->upload(5), 3);
+    CORRADE_COMPARE(*a, 200);
+    CORRADE_COMPARE(*b, 100);
+    CORRADE_COMPARE(loader->upload(5), 3);
+    CORRADE_COMPARE(*b, 200);
+
+    /* A level larger than the budget is uploaded anyway */
+    CORRADE_VERIFY(loader->loadNext());
+    CORRADE_COMPARE(loader->upload(1), 4);
+    CORRADE_COMPARE(*a, 300);
+}
+
+void AbstractStreamingResourceLoaderTest::unloadedWhileStreaming() {
+    ResourceManager rm;
+    auto loader = new IntStreamingResourceLoader;
+    rm.setLoader(loader);
+    rm.setBudget<Int>(0);
+
+    {
+        Resource<Int> resource = rm.get<Int>("2");
+        CORRADE_VERIFY(loader->loadNext());
+        CORRADE_COMPARE(loader->upload(100), 1);
+        CORRADE_COMPARE(*resource, 0);
+    }
+
+    /* Unloaded after the reference went away, the loader still has the
+       level loaded */
+    CORRADE_COMPARE(rm.state<Int>("2"), ResourceState::NotLoaded);
+    CORRADE_VERIFY(loader->loadNext());
+
+    /* Requesting it again continues where it ended */
+    Resource<Int> resource = rm.get<Int>("2");
+    CORRADE_COMPARE(resource.state(), ResourceState::Loading);
+    CORRADE_COMPARE(loader->streamingCount(), 1);
+    CORRADE_COMPARE(loader->upload(100), 2);
+    CORRADE_COMPARE(resource.state(), ResourceState::Mutable);
+    CORRADE_COMPARE(*resource, 100);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void AbstractStreamingResourceLoaderTest::threads() {
+    ResourceManager rm;
+    auto loader = new IntStreamingResourceLoader{ResourcePolicy::Resident};
+    rm.setLoader(loader);
+
+    std::vector<Resource<Int>> resources;
+    for(Int i = 0; i != 10; ++i) {
+        resources.push_back(rm.get<Int>(std::to_string(i)));
+        loader->setPriority(std::to_string(i), Float(i));
+    }
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i != 4; ++i) threads.emplace_back([&]() {
+        while(!done) if(!loader->loadNext()) std::this_thread::yield();
+    });
+
+    while(loader->streamingCount()) loader->upload(8);
+    done = true;
+    for(std::thread& thread: threads) thread.join();
+
+    for(Int i = 0; i != 10; ++i) {
+        CORRADE_COMPARE(resources[i].state(), ResourceState::Final);
+        CORRADE_COMPARE(*resources[i], i*100);
+    }
+    CORRADE_COMPARE(loader->loadedCount(), 55);
+    CORRADE_COMPARE(loader->uploaded.size(), 55);
+}
+#endif
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::AbstractStreamingResourceLoaderTest)
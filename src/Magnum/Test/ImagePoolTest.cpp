@@ -0,0 +1,218 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ImagePool.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Test {
+
+struct ImagePoolTest: TestSuite::Tester {
+    explicit ImagePoolTest();
+
+    void allocate();
+    void allocateZero();
+    void reuse();
+    void reuseDifferentBucket();
+    void maxCachedSize();
+    void clear();
+    void image();
+    void imageStorage();
+    void destroyPoolFirst();
+};
+
+ImagePoolTest::ImagePoolTest() {
+    addTests({&ImagePoolTest::allocate,
+              &ImagePoolTest::allocateZero,
+              &ImagePoolTest::reuse,
+              &ImagePoolTest::reuseDifferentBucket,
+              &ImagePoolTest::maxCachedSize,
+              &ImagePoolTest::clear,
+              &ImagePoolTest::image,
+              &ImagePoolTest::imageStorage,
+              &ImagePoolTest::destroyPoolFirst});
+}
+
+void ImagePoolTest::allocate() {
+    ImagePool pool;
+    CORRADE_COMPARE(pool.usedCount(), 0);
+    CORRADE_COMPARE(pool.cachedCount(), 0);
+
+    {
+        Containers::Array<char> data = pool.allocate(1000);
+        CORRADE_COMPARE(data.size(), 1000);
+        CORRADE_VERIFY(data.deleter());
+        CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(data.data()) % alignof(std::max_align_t), 0);
+        CORRADE_COMPARE(pool.usedCount(), 1);
+        CORRADE_COMPARE(pool.cachedCount(), 0);
+
+        /* The memory is usable */
+        for(std::size_t i = 0; i != data.size(); ++i) data[i] = char(i);
+        CORRADE_COMPARE(data[999], char(999));
+    }
+
+    /* Rounded up to the minimal bucket size */
+    CORRADE_COMPARE(pool.usedCount(), 0);
+    CORRADE_COMPARE(pool.cachedCount(), 1);
+    CORRADE_COMPARE(pool.cachedSize(), 4096);
+}
+
+void ImagePoolTest::allocateZero() {
+    ImagePool pool;
+    Containers::Array<char> data = pool.allocate(0);
+    CORRADE_VERIFY(!data);
+    CORRADE_COMPARE(pool.usedCount(), 0);
+}
+
+void ImagePoolTest::reuse() {
+    ImagePool pool;
+
+    const char* first;
+    {
+        Containers::Array<char> data = pool.allocate(5000);
+        first = data.data();
+    } {
+        /* Falls into the same 8 kB bucket */
+        Containers::Array<char> data = pool.allocate(8192);
+        CORRADE_COMPARE(data.size(), 8192);
+        CORRADE_COMPARE(data.data(), first);
+        CORRADE_COMPARE(pool.cachedCount(), 0);
+        CORRADE_COMPARE(pool.usedCount(), 1);
+    }
+
+    CORRADE_COMPARE(pool.cachedCount(), 1);
+    CORRADE_COMPARE(pool.cachedSize(), 8192);
+}
+
+void ImagePoolTest::reuseDifferentBucket() {
+    ImagePool pool;
+
+    pool.allocate(5000);
+    CORRADE_COMPARE(pool.cachedCount(), 1);
+
+    /* The cached allocation is too small, a new one is made */
+    Containers::Array<char> data = pool.allocate(9000);
+    CORRADE_COMPARE(pool.cachedCount(), 1);
+    CORRADE_COMPARE(pool.cachedSize(), 8192);
+    CORRADE_COMPARE(pool.usedCount(), 1);
+
+    data = nullptr;
+    CORRADE_COMPARE(pool.cachedCount(), 2);
+    CORRADE_COMPARE(pool.cachedSize(), 8192 + 16384);
+}
+
+void ImagePoolTest::maxCachedSize() {
+    ImagePool pool{10000};
+    CORRADE_COMPARE(pool.maxCachedSize(), 10000);
+
+    {
+        Containers::Array<char> a = pool.allocate(4096);
+        Containers::Array<char> b = pool.allocate(4096);
+        Containers::Array<char> c = pool.allocate(4096);
+    }
+
+    /* Only two fit into the limit, the third was freed */
+    CORRADE_COMPARE(pool.cachedCount(), 2);
+    CORRADE_COMPARE(pool.cachedSize(), 8192);
+
+    /* Lowering the limit frees what's over */
+    pool.setMaxCachedSize(5000);
+    CORRADE_COMPARE(pool.maxCachedSize(), 5000);
+    CORRADE_COMPARE(pool.cachedCount(), 1);
+    CORRADE_COMPARE(pool.cachedSize(), 4096);
+}
+
+void ImagePoolTest::clear() {
+    ImagePool pool;
+
+    Containers::Array<char> used = pool.allocate(100);
+    pool.allocate(100);
+    pool.allocate(100000);
+    CORRADE_COMPARE(pool.cachedCount(), 2);
+
+    pool.clear();
+    CORRADE_COMPARE(pool.cachedCount(), 0);
+    CORRADE_COMPARE(pool.cachedSize(), 0);
+    CORRADE_COMPARE(pool.usedCount(), 1);
+
+    /* Allocations in use are not affected */
+    used = nullptr;
+    CORRADE_COMPARE(pool.cachedCount(), 1);
+    CORRADE_COMPARE(pool.usedCount(), 0);
+}
+
+void ImagePoolTest::image() {
+    ImagePool pool;
+
+    const char* data;
+    {
+        Image2D image = pool.image<2>(PixelFormat::RGB8Unorm, {3, 2});
+        CORRADE_COMPARE(image.format(), PixelFormat::RGB8Unorm);
+        CORRADE_COMPARE(image.size(), (Vector2i{3, 2}));
+        /* Default alignment is four bytes, so each row is padded to 12 */
+        CORRADE_COMPARE(image.data().size(), 24);
+        CORRADE_COMPARE(pool.usedCount(), 1);
+        data = image.data();
+    }
+
+    CORRADE_COMPARE(pool.usedCount(), 0);
+    CORRADE_COMPARE(pool.cachedCount(), 1);
+
+    Image3D image = pool.image<3>(PixelFormat::R8Unorm, {16, 16, 4});
+    CORRADE_COMPARE(image.data().size(), 1024);
+    CORRADE_COMPARE(image.data().data(), data);
+}
+
+void ImagePoolTest::imageStorage() {
+    ImagePool pool;
+
+    Image2D image = pool.image<2>(PixelStorage{}.setAlignment(1).setSkip({0, 1, 0}),
+        PixelFormat::RGB8Unorm, {3, 2});
+    CORRADE_COMPARE(image.storage().alignment(), 1);
+    CORRADE_COMPARE(image.data().size(), 27);
+}
+
+void ImagePoolTest::destroyPoolFirst() {
+    Containers::Array<char> data;
+    {
+        ImagePool pool;
+        data = pool.allocate(100);
+        pool.allocate(200);
+    }
+
+    /* The allocation outlives the pool and is freed properly. Can't verify
+       much here, but memory checkers should be happy. */
+    data[99] = 'a';
+    data = nullptr;
+    CORRADE_VERIFY(!data);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ImagePoolTest)
@@ -0,0 +1,175 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2015 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Instrumentation.h"
+
+namespace Magnum { namespace Test {
+
+struct InstrumentationTest: TestSuite::Tester {
+    explicit InstrumentationTest();
+
+    void disabled();
+    void record();
+    void macro();
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void threads();
+    #endif
+    void overflow();
+};
+
+InstrumentationTest::InstrumentationTest() {
+    addTests({&InstrumentationTest::disabled,
+              &InstrumentationTest::record,
+              &InstrumentationTest::macro,
+              #ifndef CORRADE_TARGET_EMSCRIPTEN
+              &InstrumentationTest::threads,
+              #endif
+              &InstrumentationTest::overflow});
+}
+
+namespace {
+    struct Recorded {
+        std::string name;
+        UnsignedInt thread;
+        UnsignedLong begin, end;
+    };
+
+    void collect(const Instrumentation::Event& event, UnsignedInt thread, void* userData) {
+        static_cast<std::vector<Recorded>*>(userData)->push_back({event.name, thread, event.begin, event.end});
+    }
+
+    /* The state is global, so make sure previous test cases don't affect the
+       next ones */
+    void reset(bool enabled) {
+        Instrumentation::setEnabled(false);
+        Instrumentation::consume([](const Instrumentation::Event&, UnsignedInt, void*) {});
+        Instrumentation::setEnabled(enabled);
+    }
+}
+
+void InstrumentationTest::disabled() {
+    reset(false);
+    CORRADE_VERIFY(!Instrumentation::isEnabled());
+
+    {
+        Instrumentation::Scope scope{"disabled"};
+    }
+
+    std::vector<Recorded> events;
+    CORRADE_COMPARE(Instrumentation::consume(collect, &events), 0);
+    CORRADE_VERIFY(events.empty());
+}
+
+void InstrumentationTest::record() {
+    reset(true);
+    CORRADE_VERIFY(Instrumentation::isEnabled());
+
+    {
+        Instrumentation::Scope outer{"outer"};
+        {
+            Instrumentation::Scope inner{"inner"};
+        }
+    }
+
+    /* Events are ordered by their end */
+    std::vector<Recorded> events;
+    CORRADE_COMPARE(Instrumentation::consume(collect, &events), 2);
+    CORRADE_COMPARE(events.size(), 2);
+    CORRADE_COMPARE(events[0].name, "inner");
+    CORRADE_COMPARE(events[1].name, "outer");
+    CORRADE_COMPARE(events[0].thread, events[1].thread);
+    CORRADE_VERIFY(events[1].begin <= events[0].begin);
+    CORRADE_VERIFY(events[0].begin <= events[0].end);
+    CORRADE_VERIFY(events[0].end <= events[1].end);
+
+    /* Consumed events are not returned again */
+    CORRADE_COMPARE(Instrumentation::consume(collect, &events), 0);
+}
+
+void InstrumentationTest::macro() {
+    reset(true);
+
+    {
+        MAGNUM_INSTRUMENTATION_SCOPE("macro");
+    }
+
+    std::vector<Recorded> events;
+    #ifdef MAGNUM_BUILD_INSTRUMENTATION
+    CORRADE_COMPARE(Instrumentation::consume(collect, &events), 1);
+    CORRADE_COMPARE(events[0].name, "macro");
+    #else
+    CORRADE_COMPARE(Instrumentation::consume(collect, &events), 0);
+    #endif
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void InstrumentationTest::threads() {
+    reset(true);
+
+    {
+        Instrumentation::Scope scope{"main"};
+    }
+    std::thread{[]() {
+        Instrumentation::Scope scope{"worker"};
+    }}.join();
+
+    std::vector<Recorded> events;
+    CORRADE_COMPARE(Instrumentation::consume(collect, &events), 2);
+    CORRADE_COMPARE(events.size(), 2);
+    CORRADE_VERIFY(events[0].thread != events[1].thread);
+}
+#endif
+
+void InstrumentationTest::overflow() {
+    reset(true);
+    const UnsignedLong dropped = Instrumentation::droppedCount();
+
+    for(std::size_t i = 0; i != Instrumentation::RingSize + 5; ++i) {
+        Instrumentation::Scope scope{"overflow"};
+    }
+
+    CORRADE_COMPARE(Instrumentation::droppedCount(), dropped + 5);
+    std::vector<Recorded> events;
+    CORRADE_COMPARE(Instrumentation::consume(collect, &events), Instrumentation::RingSize);
+
+    /* There's space again after consuming */
+    {
+        Instrumentation::Scope scope{"overflow"};
+    }
+    CORRADE_COMPARE(Instrumentation::consume(collect, &events), 1);
+    CORRADE_COMPARE(Instrumentation::droppedCount(), dropped + 5);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::InstrumentationTest)
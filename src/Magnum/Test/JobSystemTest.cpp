@@ -0,0 +1,552 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+#include "Magnum/JobSystem.h"
+
+namespace Magnum { namespace Test {
+
+struct JobSystemTest: TestSuite::Tester {
+    explicit JobSystemTest();
+
+    void executorWorkerCount();
+    void executorExecute();
+    void executorExecuteNested();
+    void executorExecuteConcurrent();
+    void executorExecuteInvalidCount();
+
+    void parallelFor();
+    void parallelForEmpty();
+    void parallelForScratch();
+    void parallelForNested();
+    void parallelForConcurrent();
+    void parallelForDeterministic();
+    void parallelForZeroChunkSize();
+
+    void taskGraph();
+    void taskGraphInvalidDependency();
+    void runDependencies();
+    void runEmpty();
+    void runSerialOrder();
+    void runTwice();
+    void runConcurrent();
+
+    void customExecutor();
+    void scratchInvalidWorker();
+    void globalExecutor();
+};
+
+namespace {
+
+/* Zero threads for the deterministic serial path, the rest for the actual
+   work stealing. On Emscripten all of them are serial. */
+constexpr struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadData[]{
+    {"no threads", 0},
+    {"one thread", 1},
+    {"three threads", 3},
+    {"seven threads", 7}
+};
+
+}
+
+JobSystemTest::JobSystemTest() {
+    addTests({&JobSystemTest::executorWorkerCount,
+              &JobSystemTest::executorExecute,
+              &JobSystemTest::executorExecuteNested,
+              &JobSystemTest::executorExecuteConcurrent,
+              &JobSystemTest::executorExecuteInvalidCount});
+
+    addInstancedTests({&JobSystemTest::parallelFor,
+                       &JobSystemTest::parallelForEmpty,
+                       &JobSystemTest::parallelForScratch,
+                       &JobSystemTest::parallelForNested},
+        Containers::arraySize(ThreadData));
+
+    addTests({&JobSystemTest::parallelForConcurrent,
+              &JobSystemTest::parallelForDeterministic,
+              &JobSystemTest::parallelForZeroChunkSize,
+
+              &JobSystemTest::taskGraph,
+              &JobSystemTest::taskGraphInvalidDependency});
+
+    addInstancedTests({&JobSystemTest::runDependencies,
+                       &JobSystemTest::runEmpty},
+        Containers::arraySize(ThreadData));
+
+    addTests({&JobSystemTest::runSerialOrder,
+              &JobSystemTest::runTwice,
+              &JobSystemTest::runConcurrent,
+
+              &JobSystemTest::customExecutor,
+              &JobSystemTest::scratchInvalidWorker,
+              &JobSystemTest::globalExecutor});
+}
+
+void JobSystemTest::executorWorkerCount() {
+    ThreadPoolJobExecutor executor{3};
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_COMPARE(executor.workerCount(), 4);
+    #else
+    CORRADE_COMPARE(executor.workerCount(), 1);
+    #endif
+
+    ThreadPoolJobExecutor serial{0};
+    CORRADE_COMPARE(serial.workerCount(), 1);
+}
+
+void JobSystemTest::executorExecute() {
+    ThreadPoolJobExecutor executor{3};
+
+    /* Run a few times to verify the threads go back to sleep and wake up
+       again properly */
+    for(std::size_t repeat = 0; repeat != 100; ++repeat) {
+        std::atomic<UnsignedInt> called[4]{};
+        const UnsignedInt count = repeat % executor.workerCount() + 1;
+        executor.execute(count, [](void* state, UnsignedInt worker) {
+            ++static_cast<std::atomic<UnsignedInt>*>(state)[worker];
+        }, called);
+
+        for(UnsignedInt i = 0; i != 4; ++i)
+            CORRADE_COMPARE(called[i].load(), i < count ? 1 : 0);
+    }
+}
+
+void JobSystemTest::executorExecuteNested() {
+    ThreadPoolJobExecutor executor{3};
+
+    struct State {
+        ThreadPoolJobExecutor& executor;
+        std::atomic<UnsignedInt> called;
+    } state{executor, {}};
+    executor.execute(executor.workerCount(), [](void* data, UnsignedInt) {
+        /* All threads are busy with the outer call, the calling thread runs
+           the workers nobody picked up instead of waiting for them */
+        State& state = *static_cast<State*>(data);
+        state.executor.execute(state.executor.workerCount(), [](void* data, UnsignedInt) {
+            ++static_cast<State*>(data)->called;
+        }, &state);
+    }, &state);
+
+    CORRADE_COMPARE(state.called.load(), executor.workerCount()*executor.workerCount());
+}
+
+void JobSystemTest::executorExecuteConcurrent() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads are not available on Emscripten.");
+    #else
+    ThreadPoolJobExecutor executor{3};
+
+    /* Calls from multiple threads at once get all workers run, none of them
+       is lost or run twice */
+    std::atomic<UnsignedInt> called{};
+    auto call = [&]() {
+        for(std::size_t repeat = 0; repeat != 100; ++repeat)
+            executor.execute(executor.workerCount(), [](void* state, UnsignedInt) {
+                ++*static_cast<std::atomic<UnsignedInt>*>(state);
+            }, &called);
+    };
+    std::thread a{call}, b{call}, c{call};
+    call();
+    a.join();
+    b.join();
+    c.join();
+
+    CORRADE_COMPARE(called.load(), 4*100*executor.workerCount());
+    #endif
+}
+
+void JobSystemTest::executorExecuteInvalidCount() {
+    ThreadPoolJobExecutor executor{1};
+    const UnsignedInt count = executor.workerCount();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    executor.execute(0, [](void*, UnsignedInt) {}, nullptr);
+    executor.execute(count + 1, [](void*, UnsignedInt) {}, nullptr);
+    std::ostringstream expected;
+    Debug{&expected} << "AbstractJobExecutor::execute(): expected 1 to" << count << "workers but got 0";
+    Debug{&expected} << "AbstractJobExecutor::execute(): expected 1 to" << count << "workers but got" << count + 1;
+    CORRADE_COMPARE(out.str(), expected.str());
+}
+
+void JobSystemTest::parallelFor() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    JobSystem jobs{data.threadCount};
+
+    /* Chunk size not dividing the range, the last chunk is smaller */
+    std::vector<std::atomic<UnsignedInt>> called(10007);
+    std::atomic<std::size_t> chunkCount{};
+    std::atomic<bool> wrongChunk{};
+    jobs.parallelFor(5, 10007, 13, [&](std::size_t begin, std::size_t end, ScratchArena&) {
+        if((begin - 5) % 13 || (end - begin != 13 && end != 10007))
+            wrongChunk = true;
+        for(std::size_t i = begin; i != end; ++i) ++called[i];
+        ++chunkCount;
+    });
+
+    CORRADE_VERIFY(!wrongChunk);
+    CORRADE_COMPARE(chunkCount.load(), 770);
+    std::size_t calledOnce = 0, notCalled = 0;
+    for(std::size_t i = 0; i != called.size(); ++i) {
+        if(called[i] == 1) ++calledOnce;
+        else if(called[i] == 0 && i < 5) ++notCalled;
+    }
+    CORRADE_COMPARE(calledOnce, 10002);
+    CORRADE_COMPARE(notCalled, 5);
+}
+
+void JobSystemTest::parallelForEmpty() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    JobSystem jobs{data.threadCount};
+
+    std::atomic<UnsignedInt> called{};
+    jobs.parallelFor(7, 7, 16, [&](std::size_t, std::size_t, ScratchArena&) {
+        ++called;
+    });
+    jobs.parallelFor(7, 3, 16, [&](std::size_t, std::size_t, ScratchArena&) {
+        ++called;
+    });
+    CORRADE_COMPARE(called.load(), 0);
+
+    /* Less chunks than workers */
+    jobs.parallelFor(3, 7, 16, [&](std::size_t begin, std::size_t end, ScratchArena&) {
+        if(begin == 3 && end == 7) ++called;
+    });
+    CORRADE_COMPARE(called.load(), 1);
+}
+
+void JobSystemTest::parallelForScratch() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    JobSystem jobs{data.threadCount};
+
+    /* Each chunk gets an arena that's reset, so it never grows beyond the
+       size needed by a single chunk */
+    std::atomic<bool> notReset{};
+    jobs.parallelFor(0, 1000, 10, [&](std::size_t begin, std::size_t end, ScratchArena& scratch) {
+        if(scratch.usedSize()) notReset = true;
+        Containers::ArrayView<std::size_t> values = scratch.allocate<std::size_t>(end - begin);
+        for(std::size_t i = begin; i != end; ++i) values[i - begin] = i;
+    });
+
+    CORRADE_VERIFY(!notReset);
+    for(UnsignedInt i = 0; i != jobs.workerCount(); ++i) {
+        CORRADE_COMPARE(jobs.scratch(i).usedSize(), 0);
+        CORRADE_COMPARE_AS(jobs.scratch(i).capacity(), jobs.scratch(i).blockSize(),
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void JobSystemTest::parallelForNested() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    JobSystem jobs{data.threadCount};
+
+    std::atomic<UnsignedInt> called{};
+    jobs.parallelFor(0, 16, 1, [&](std::size_t, std::size_t, ScratchArena&) {
+        jobs.parallelFor(0, 16, 4, [&](std::size_t begin, std::size_t end, ScratchArena&) {
+            called += end - begin;
+        });
+    });
+    CORRADE_COMPARE(called.load(), 256);
+}
+
+void JobSystemTest::parallelForConcurrent() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads are not available on Emscripten.");
+    #else
+    JobSystem jobs{3};
+
+    /* Each call has its own queues, so concurrent calls don't interfere with
+       each other */
+    std::vector<std::atomic<UnsignedInt>> called(4*1000);
+    auto call = [&](std::size_t offset) {
+        for(std::size_t repeat = 0; repeat != 10; ++repeat)
+            jobs.parallelFor(offset, offset + 1000, 7, [&](std::size_t begin, std::size_t end, ScratchArena&) {
+                for(std::size_t i = begin; i != end; ++i) ++called[i];
+            });
+    };
+    std::thread a{call, 1000}, b{call, 2000}, c{call, 3000};
+    call(0);
+    a.join();
+    b.join();
+    c.join();
+
+    std::size_t calledTenTimes = 0;
+    for(std::atomic<UnsignedInt>& i: called) if(i == 10) ++calledTenTimes;
+    CORRADE_COMPARE(calledTenTimes, 4000);
+    #endif
+}
+
+void JobSystemTest::parallelForDeterministic() {
+    /* With no threads the chunks go in order */
+    JobSystem jobs;
+    CORRADE_COMPARE(jobs.workerCount(), 1);
+
+    std::vector<std::size_t> order;
+    jobs.parallelFor(0, 10, 3, [&](std::size_t begin, std::size_t end, ScratchArena&) {
+        order.push_back(begin);
+        order.push_back(end);
+    });
+    CORRADE_COMPARE(order, (std::vector<std::size_t>{0, 3, 3, 6, 6, 9, 9, 10}));
+
+    /* Per-chunk results combined in chunk order give the same result for any
+       worker count */
+    auto sum = [](JobSystem& jobs) {
+        Float partial[100]{};
+        jobs.parallelFor(0, 10000, 100, [&](std::size_t begin, std::size_t end, ScratchArena&) {
+            for(std::size_t i = begin; i != end; ++i)
+                partial[begin/100] += 1.0f/Float(i + 1);
+        });
+        Float sum = 0.0f;
+        for(Float i: partial) sum += i;
+        return sum;
+    };
+    JobSystem threaded{3};
+    const Float expected = sum(jobs);
+    CORRADE_COMPARE(sum(threaded), expected);
+    CORRADE_COMPARE(sum(threaded), expected);
+}
+
+void JobSystemTest::parallelForZeroChunkSize() {
+    JobSystem jobs;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    jobs.parallelFor(0, 10, 0, [](std::size_t, std::size_t, ScratchArena&) {});
+    CORRADE_COMPARE(out.str(), "JobSystem::parallelFor(): expected non-zero chunk size\n");
+}
+
+void JobSystemTest::taskGraph() {
+    TaskGraph graph;
+    CORRADE_COMPARE(graph.size(), 0);
+
+    CORRADE_COMPARE(graph.add([](ScratchArena&) {}), 0);
+    CORRADE_COMPARE(graph.add([](ScratchArena&) {}, {0}), 1);
+    const UnsignedInt dependencies[]{0, 1};
+    CORRADE_COMPARE(graph.add([](ScratchArena&) {}, dependencies), 2);
+    CORRADE_COMPARE(graph.size(), 3);
+
+    graph.clear();
+    CORRADE_COMPARE(graph.size(), 0);
+    CORRADE_COMPARE(graph.add([](ScratchArena&) {}), 0);
+}
+
+void JobSystemTest::taskGraphInvalidDependency() {
+    TaskGraph graph;
+    graph.add([](ScratchArena&) {});
+    graph.add([](ScratchArena&) {}, {0});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    graph.add([](ScratchArena&) {}, {0, 2});
+    CORRADE_COMPARE(out.str(), "TaskGraph::add(): dependency 2 out of range for 2 tasks\n");
+}
+
+void JobSystemTest::runDependencies() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    JobSystem jobs{data.threadCount};
+
+    /* Each task depends on its half and on three tasks before, with the
+       first three being roots */
+    std::vector<std::atomic<UnsignedInt>> done(500);
+    std::atomic<bool> wrongOrder{};
+    TaskGraph graph;
+    for(UnsignedInt i = 0; i != done.size(); ++i) {
+        graph.add([&done, &wrongOrder, i](ScratchArena& scratch) {
+            if(i >= 3 && (!done[i/2] || !done[i - 3])) wrongOrder = true;
+            scratch.allocate(64);
+            ++done[i];
+        }, i >= 3 ? std::initializer_list<UnsignedInt>{i/2, i - 3} : std::initializer_list<UnsignedInt>{});
+    }
+
+    jobs.run(graph);
+    CORRADE_VERIFY(!wrongOrder);
+    std::size_t doneOnce = 0;
+    for(std::atomic<UnsignedInt>& i: done) if(i == 1) ++doneOnce;
+    CORRADE_COMPARE(doneOnce, 500);
+}
+
+void JobSystemTest::runEmpty() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    JobSystem jobs{data.threadCount};
+    TaskGraph graph;
+    jobs.run(graph);
+    CORRADE_VERIFY(true);
+}
+
+void JobSystemTest::runSerialOrder() {
+    JobSystem jobs;
+
+    std::vector<UnsignedInt> order;
+    TaskGraph graph;
+    graph.add([&](ScratchArena&) { order.push_back(0); });
+    graph.add([&](ScratchArena&) { order.push_back(1); });
+    graph.add([&](ScratchArena&) { order.push_back(2); }, {0});
+    graph.add([&](ScratchArena&) { order.push_back(3); }, {2, 1});
+    graph.add([&](ScratchArena&) { order.push_back(4); });
+
+    jobs.run(graph);
+    CORRADE_COMPARE(order, (std::vector<UnsignedInt>{0, 1, 2, 3, 4}));
+}
+
+void JobSystemTest::runTwice() {
+    JobSystem jobs{3};
+
+    std::atomic<UnsignedInt> called{};
+    TaskGraph graph;
+    UnsignedInt first = graph.add([&](ScratchArena&) { ++called; });
+    for(UnsignedInt i = 0; i != 10; ++i)
+        graph.add([&](ScratchArena&) { ++called; }, {first});
+
+    /* The dependency counters are reset for each run */
+    jobs.run(graph);
+    CORRADE_COMPARE(called.load(), 11);
+    jobs.run(graph);
+    CORRADE_COMPARE(called.load(), 22);
+}
+
+void JobSystemTest::runConcurrent() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads are not available on Emscripten.");
+    #else
+    JobSystem jobs{3};
+
+    /* A chain with a wide fan-out in the middle, so workers run out of tasks
+       and have to sleep until new ones are ready */
+    std::atomic<UnsignedInt> called{};
+    TaskGraph graph;
+    const UnsignedInt first = graph.add([&](ScratchArena&) { ++called; });
+    std::vector<UnsignedInt> middle;
+    for(UnsignedInt i = 0; i != 50; ++i)
+        middle.push_back(graph.add([&](ScratchArena&) { ++called; }, {first}));
+    graph.add([&](ScratchArena&) { ++called; }, {middle.data(), middle.size()});
+
+    /* Each call also runs a nested graph from inside a task */
+    TaskGraph outer;
+    outer.add([&](ScratchArena&) { jobs.run(graph); });
+    outer.add([&](ScratchArena&) { jobs.run(graph); });
+
+    auto call = [&]() {
+        for(std::size_t repeat = 0; repeat != 10; ++repeat)
+            jobs.run(outer);
+    };
+    std::thread a{call}, b{call};
+    call();
+    a.join();
+    b.join();
+
+    CORRADE_COMPARE(called.load(), 3*10*2*52);
+    #endif
+}
+
+void JobSystemTest::customExecutor() {
+    struct Executor: AbstractJobExecutor {
+        UnsignedInt doWorkerCount() const override { return 3; }
+
+        /* Runs the workers in reverse order on the calling thread. The work
+           stealing takes care of the chunks of workers that didn't start
+           yet. */
+        void doExecute(UnsignedInt count, WorkerFunction function, void* state) override {
+            ++executeCount;
+            for(UnsignedInt i = count; i != 0; --i) function(state, i - 1);
+        }
+
+        UnsignedInt executeCount = 0;
+    } executor;
+
+    JobSystem jobs{executor};
+    CORRADE_COMPARE(&jobs.executor(), &executor);
+    CORRADE_COMPARE(jobs.workerCount(), 3);
+
+    std::vector<UnsignedInt> called(100);
+    jobs.parallelFor(0, 100, 7, [&](std::size_t begin, std::size_t end, ScratchArena&) {
+        for(std::size_t i = begin; i != end; ++i) ++called[i];
+    });
+    CORRADE_COMPARE(executor.executeCount, 1);
+    CORRADE_COMPARE(called, std::vector<UnsignedInt>(100, 1));
+
+    std::vector<UnsignedInt> order;
+    TaskGraph graph;
+    graph.add([&](ScratchArena&) { order.push_back(0); });
+    graph.add([&](ScratchArena&) { order.push_back(1); }, {0});
+    graph.add([&](ScratchArena&) { order.push_back(2); }, {1});
+    jobs.run(graph);
+    CORRADE_COMPARE(executor.executeCount, 2);
+    CORRADE_COMPARE(order, (std::vector<UnsignedInt>{0, 1, 2}));
+}
+
+void JobSystemTest::scratchInvalidWorker() {
+    JobSystem jobs;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    jobs.scratch(1);
+    CORRADE_COMPARE(out.str(), "JobSystem::scratch(): worker 1 out of range for 1 workers\n");
+}
+
+void JobSystemTest::globalExecutor() {
+    AbstractJobExecutor& defaultExecutor = globalJobExecutor();
+    CORRADE_COMPARE(&globalJobExecutor(), &defaultExecutor);
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_COMPARE(defaultExecutor.workerCount(), std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1);
+    #else
+    CORRADE_COMPARE(defaultExecutor.workerCount(), 1);
+    #endif
+
+    ThreadPoolJobExecutor executor{2};
+    setGlobalJobExecutor(&executor);
+    CORRADE_COMPARE(&globalJobExecutor(), &executor);
+
+    /* Null goes back to the default one */
+    setGlobalJobExecutor(nullptr);
+    CORRADE_COMPARE(&globalJobExecutor(), &defaultExecutor);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::JobSystemTest)
@@ -0,0 +1,578 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelConversion.h"
+#include "Magnum/PixelFormat.h"
+
+namespace Magnum { namespace Test {
+
+struct PixelConversionTest: TestSuite::Tester {
+    explicit PixelConversionTest();
+
+    void swapRedBlueRgb();
+    void swapRedBlueRgba();
+    void swapRedBlueImage();
+    void swapRedBlueImageInvalidFormat();
+
+    void rgbToRgba();
+    void rgbaToRgb();
+    void rgbToRgbaInvalidSize();
+
+    void srgbToLinear();
+    void srgbAlphaToLinear();
+    void linearToSrgb();
+    void linearToSrgbAlpha();
+    void srgbToLinearExact();
+    void linearToSrgbExact();
+    void srgbLinearStrided();
+    void srgbImageToLinear();
+    void linearImageToSrgb();
+    void srgbImageInvalidFormat();
+    void srgbImageInvalidSize();
+
+    void premultiplyAlpha();
+    void premultiplyAlphaImage();
+    void premultiplyAlphaImageInvalidFormat();
+
+    void copyImage();
+    void copySubImage();
+    void copyImageFlipY();
+    void copyImageRgbToRgba();
+    void copyImageRgbaToRgb();
+    void copyImageUnpack();
+    void copyImagePack();
+    void copyImageInvalidConversion();
+    void copyImageOutOfBounds();
+
+    void debugImageCopyFlag();
+    void debugImageCopyFlags();
+};
+
+PixelConversionTest::PixelConversionTest() {
+    addTests({&PixelConversionTest::swapRedBlueRgb,
+              &PixelConversionTest::swapRedBlueRgba,
+              &PixelConversionTest::swapRedBlueImage,
+              &PixelConversionTest::swapRedBlueImageInvalidFormat,
+
+              &PixelConversionTest::rgbToRgba,
+              &PixelConversionTest::rgbaToRgb,
+              &PixelConversionTest::rgbToRgbaInvalidSize,
+
+              &PixelConversionTest::srgbToLinear,
+              &PixelConversionTest::srgbAlphaToLinear,
+              &PixelConversionTest::linearToSrgb,
+              &PixelConversionTest::linearToSrgbAlpha,
+              &PixelConversionTest::srgbToLinearExact,
+              &PixelConversionTest::linearToSrgbExact,
+              &PixelConversionTest::srgbLinearStrided,
+              &PixelConversionTest::srgbImageToLinear,
+              &PixelConversionTest::linearImageToSrgb,
+              &PixelConversionTest::srgbImageInvalidFormat,
+              &PixelConversionTest::srgbImageInvalidSize,
+
+              &PixelConversionTest::premultiplyAlpha,
+              &PixelConversionTest::premultiplyAlphaImage,
+              &PixelConversionTest::premultiplyAlphaImageInvalidFormat,
+
+              &PixelConversionTest::copyImage,
+              &PixelConversionTest::copySubImage,
+              &PixelConversionTest::copyImageFlipY,
+              &PixelConversionTest::copyImageRgbToRgba,
+              &PixelConversionTest::copyImageRgbaToRgb,
+              &PixelConversionTest::copyImageUnpack,
+              &PixelConversionTest::copyImagePack,
+              &PixelConversionTest::copyImageInvalidConversion,
+              &PixelConversionTest::copyImageOutOfBounds,
+
+              &PixelConversionTest::debugImageCopyFlag,
+              &PixelConversionTest::debugImageCopyFlags});
+}
+
+void PixelConversionTest::swapRedBlueRgb() {
+    /* Enough pixels to go through both the vectorized and the scalar code
+       path */
+    Color3ub pixels[13];
+    Color3ub expected[13];
+    for(UnsignedByte i = 0; i != 13; ++i) {
+        pixels[i] = {UnsignedByte(i*3), UnsignedByte(i*3 + 1), UnsignedByte(i*3 + 2)};
+        expected[i] = {UnsignedByte(i*3 + 2), UnsignedByte(i*3 + 1), UnsignedByte(i*3)};
+    }
+
+    swapRedBlue(pixels);
+    CORRADE_COMPARE_AS(Containers::arrayView(pixels),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::swapRedBlueRgba() {
+    Color4ub pixels[11];
+    Color4ub expected[11];
+    for(UnsignedByte i = 0; i != 11; ++i) {
+        pixels[i] = {UnsignedByte(i*4), UnsignedByte(i*4 + 1), UnsignedByte(i*4 + 2), UnsignedByte(i*4 + 3)};
+        expected[i] = {UnsignedByte(i*4 + 2), UnsignedByte(i*4 + 1), UnsignedByte(i*4), UnsignedByte(i*4 + 3)};
+    }
+
+    swapRedBlue(pixels);
+    CORRADE_COMPARE_AS(Containers::arrayView(pixels),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::swapRedBlueImage() {
+    /* Rows are padded to four bytes, the padding should stay untouched */
+    Image2D image{PixelFormat::RGB8Unorm, {3, 2}, Containers::Array<char>{Containers::InPlaceInit, {
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 'x', 'x', 'x',
+        10, 11, 12, 13, 14, 15, 16, 17, 18, 'y', 'y', 'y'
+    }}};
+    const char expected[] {
+        3, 2, 1, 6, 5, 4, 9, 8, 7, 'x', 'x', 'x',
+        12, 11, 10, 15, 14, 13, 18, 17, 16, 'y', 'y', 'y'
+    };
+
+    swapImageRedBlue(image);
+    CORRADE_COMPARE_AS(image.data(),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::swapRedBlueImageInvalidFormat() {
+    Image2D image{PixelFormat::RG8Unorm, {2, 2}, Containers::Array<char>{8}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    swapImageRedBlue(image);
+    CORRADE_COMPARE(out.str(), "swapImageRedBlue(): expected a three- or four-byte pixel format but got 2 bytes\n");
+}
+
+void PixelConversionTest::rgbToRgba() {
+    Color3ub src[7];
+    Color4ub expected[7];
+    for(UnsignedByte i = 0; i != 7; ++i) {
+        src[i] = {UnsignedByte(i*3), UnsignedByte(i*3 + 1), UnsignedByte(i*3 + 2)};
+        expected[i] = {src[i], 127};
+    }
+
+    Color4ub dst[7];
+    Magnum::rgbToRgba(src, dst, 127);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::rgbaToRgb() {
+    const Color4ub src[] {{1, 2, 3, 4}, {5, 6, 7, 8}};
+    const Color3ub expected[] {{1, 2, 3}, {5, 6, 7}};
+
+    Color3ub dst[2];
+    Magnum::rgbaToRgb(src, dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::rgbToRgbaInvalidSize() {
+    const Color3ub src[3]{};
+    Color4ub dst[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Magnum::rgbToRgba(src, dst);
+    CORRADE_COMPARE(out.str(), "rgbToRgba(): expected 3 destination pixels but got 2\n");
+}
+
+void PixelConversionTest::srgbToLinear() {
+    const Color3ub src[] {{0, 10, 128}, {200, 255, 1}};
+    Color3 dst[2];
+    Magnum::srgbToLinear(src, dst);
+
+    for(std::size_t i = 0; i != 2; ++i)
+        CORRADE_COMPARE(dst[i], Color3::fromSrgb(src[i]));
+}
+
+void PixelConversionTest::srgbAlphaToLinear() {
+    const Color4ub src[] {{0, 10, 128, 255}, {200, 255, 1, 51}};
+    Color4 dst[2];
+    Magnum::srgbAlphaToLinear(src, dst);
+
+    for(std::size_t i = 0; i != 2; ++i)
+        CORRADE_COMPARE(dst[i], Color4::fromSrgbAlpha(src[i]));
+}
+
+void PixelConversionTest::linearToSrgb() {
+    /* Round-trip of all 8-bit values should be exact */
+    Color3ub src[256];
+    for(std::size_t i = 0; i != 256; ++i)
+        src[i] = Color3ub{UnsignedByte(i)};
+    Color3 linear[256];
+    Color3ub dst[256];
+    Magnum::srgbToLinear(src, linear);
+    Magnum::linearToSrgb(linear, dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(src),
+        TestSuite::Compare::Container);
+
+    /* Out-of-range values are clamped */
+    const Color3 outOfRange[] {{-1.0f, 2.0f, 0.5f}};
+    Color3ub clamped[1];
+    Magnum::linearToSrgb(outOfRange, clamped);
+    CORRADE_COMPARE(clamped[0], (Color3ub{0, 255, 188}));
+}
+
+void PixelConversionTest::linearToSrgbAlpha() {
+    const Color4 src[] {{0.0f, 0.5f, 1.0f, 0.2f}};
+    Color4ub dst[1];
+    Magnum::linearToSrgbAlpha(src, dst);
+    CORRADE_COMPARE(dst[0], (Color4ub{0, 188, 255, 51}));
+}
+
+void PixelConversionTest::srgbToLinearExact() {
+    Color4ub src[256];
+    for(std::size_t i = 0; i != 256; ++i)
+        src[i] = {UnsignedByte(i), UnsignedByte(255 - i), UnsignedByte(i), UnsignedByte(i)};
+    Color4 dst[256];
+    Magnum::srgbAlphaToLinear(src, dst);
+
+    /* The table is calculated from the scalar path, so the results are
+       exactly the same */
+    for(std::size_t i = 0; i != 256; ++i)
+        CORRADE_VERIFY(dst[i] == Color4::fromSrgbAlpha(src[i]));
+}
+
+namespace {
+    UnsignedByte linearToSrgbRounded(Float value) {
+        return UnsignedByte(Color3{Math::clamp(value, 0.0f, 1.0f)}.toSrgb().r()*255.0f + 0.5f);
+    }
+}
+
+void PixelConversionTest::linearToSrgbExact() {
+    /* Values in the close neighborhood of every rounding boundary, where the
+       lookup table alone would be off by one */
+    std::size_t count = 0;
+    std::size_t failed = 0;
+    for(std::size_t i = 0; i != 256; ++i) {
+        const Float boundary = Color3::fromSrgb(Vector3{(i + 0.5f)/255.0f}).r();
+        Color3 src[33];
+        for(std::size_t j = 0; j != 33; ++j)
+            src[j] = Color3{boundary*(1.0f + (Int(j) - 16)*1.0e-7f)};
+        Color3ub dst[33];
+        Magnum::linearToSrgb(src, dst);
+
+        for(std::size_t j = 0; j != 33; ++j, ++count)
+            if(dst[j].r() != linearToSrgbRounded(src[j].r())) ++failed;
+    }
+
+    /* Evenly distributed values including out-of-range ones */
+    Color3 src[2048];
+    for(std::size_t i = 0; i != 2048; ++i)
+        src[i] = Color3{-0.1f + i*(1.2f/2047)};
+    Color3ub dst[2048];
+    Magnum::linearToSrgb(src, dst);
+    for(std::size_t i = 0; i != 2048; ++i, ++count)
+        if(dst[i].r() != linearToSrgbRounded(src[i].r())) ++failed;
+
+    CORRADE_COMPARE(count, 256*33 + 2048);
+    CORRADE_COMPARE(failed, 0);
+}
+
+void PixelConversionTest::srgbLinearStrided() {
+    /* Converting a color attribute of interleaved vertex data */
+    struct Vertex {
+        Vector2 position;
+        Color4ub color;
+    } vertices[]{
+        {{}, {0, 10, 128, 255}},
+        {{}, {200, 255, 1, 51}},
+        {{}, {64, 32, 16, 0}}
+    };
+    struct Linear {
+        UnsignedInt index;
+        Color4 color;
+    } linear[3];
+
+    Magnum::srgbAlphaToLinear({&vertices[0].color, 3, sizeof(Vertex)},
+        {&linear[0].color, 3, sizeof(Linear)});
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(linear[i].color, Color4::fromSrgbAlpha(vertices[i].color));
+
+    Color4ub back[3];
+    Magnum::linearToSrgbAlpha({&linear[0].color, 3, sizeof(Linear)}, back);
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(back[i], vertices[i].color);
+}
+
+void PixelConversionTest::srgbImageToLinear() {
+    /* Rows of the source are padded to four bytes, the destination has a
+       skip */
+    const char data[] {
+        0, 10, char(128), 'x', char(200), char(255), 1, 'x'
+    };
+    ImageView2D src{PixelFormat::RGB8Unorm, {1, 2}, data};
+    Image2D dst{PixelStorage{}.setSkip({1, 0, 0}).setRowLength(2), PixelFormat::RGB32F, {1, 2}, Containers::Array<char>{Containers::ValueInit, 4*sizeof(Color3)}};
+
+    Magnum::srgbImageToLinear(src, dst);
+    const Color3* out = reinterpret_cast<const Color3*>(dst.data().data());
+    CORRADE_COMPARE(out[0], Color3{});
+    CORRADE_COMPARE(out[1], Color3::fromSrgb(Color3ub{0, 10, 128}));
+    CORRADE_COMPARE(out[2], Color3{});
+    CORRADE_COMPARE(out[3], Color3::fromSrgb(Color3ub{200, 255, 1}));
+}
+
+void PixelConversionTest::linearImageToSrgb() {
+    const Color4 data[] {
+        {0.0f, 0.5f, 1.0f, 0.2f},
+        {0.25f, 0.75f, 2.0f, 1.0f}
+    };
+    ImageView2D src{PixelFormat::RGBA32F, {2, 1}, data};
+    Image2D dst{PixelFormat::RGBA8Unorm, {2, 1}, Containers::Array<char>{2*sizeof(Color4ub)}};
+
+    Magnum::linearImageToSrgb(src, dst);
+    const Color4ub* out = reinterpret_cast<const Color4ub*>(dst.data().data());
+    CORRADE_COMPARE(out[0], (Color4ub{0, 188, 255, 51}));
+    CORRADE_COMPARE(out[1], (Color4ub{137, 225, 255, 255}));
+}
+
+void PixelConversionTest::srgbImageInvalidFormat() {
+    Image2D rgb8{PixelFormat::RGB8Unorm, {1, 1}, Containers::Array<char>{4}};
+    Image2D rgba32f{PixelFormat::RGBA32F, {1, 1}, Containers::Array<char>{16}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Magnum::srgbImageToLinear(rgb8, rgba32f);
+    Magnum::linearImageToSrgb(rgba32f, rgb8);
+    CORRADE_COMPARE(out.str(),
+        "srgbImageToLinear(): expected three or four one-byte source channels and three or four float destination channels, respectively, but got 3 and 16 byte pixels\n"
+        "linearImageToSrgb(): expected three or four float source channels and three or four one-byte destination channels, respectively, but got 16 and 3 byte pixels\n");
+}
+
+void PixelConversionTest::srgbImageInvalidSize() {
+    Image2D rgba8{PixelFormat::RGBA8Unorm, {2, 1}, Containers::Array<char>{8}};
+    Image2D rgba32f{PixelFormat::RGBA32F, {1, 2}, Containers::Array<char>{32}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Magnum::srgbImageToLinear(rgba8, rgba32f);
+    Magnum::linearImageToSrgb(rgba32f, rgba8);
+    CORRADE_COMPARE(out.str(),
+        "srgbImageToLinear(): expected destination image size Vector(2, 1, 1) but got Vector(1, 2, 1)\n"
+        "linearImageToSrgb(): expected destination image size Vector(1, 2, 1) but got Vector(2, 1, 1)\n");
+}
+
+void PixelConversionTest::premultiplyAlpha() {
+    Color4ub pixels[] {{255, 128, 0, 255}, {255, 128, 10, 128}, {255, 128, 10, 0}};
+    const Color4ub expected[] {{255, 128, 0, 255}, {128, 64, 5, 128}, {0, 0, 0, 0}};
+
+    Magnum::premultiplyAlpha(pixels);
+    CORRADE_COMPARE_AS(Containers::arrayView(pixels),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::premultiplyAlphaImage() {
+    Image2D image{PixelStorage{}.setRowLength(2).setSkip({1, 0, 0}), PixelFormat::RGBA8Unorm, {1, 2}, Containers::Array<char>{Containers::InPlaceInit, {
+        'x', 'x', 'x', 'x', char(200), 100, 50, char(128),
+        'y', 'y', 'y', 'y', 10, 20, 30, 0
+    }}};
+    const char expected[] {
+        'x', 'x', 'x', 'x', 100, 50, 25, char(128),
+        'y', 'y', 'y', 'y', 0, 0, 0, 0
+    };
+
+    premultiplyImageAlpha(image);
+    CORRADE_COMPARE_AS(image.data(),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::premultiplyAlphaImageInvalidFormat() {
+    Image2D image{PixelFormat::RGB8Unorm, {1, 1}, Containers::Array<char>{4}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    premultiplyImageAlpha(image);
+    CORRADE_COMPARE(out.str(), "premultiplyImageAlpha(): expected a four-byte pixel format but got 3 bytes\n");
+}
+
+void PixelConversionTest::copyImage() {
+    /* Tightly packed to four-byte aligned */
+    const char src[] {
+        1, 2, 3, 4, 5, 6,
+        7, 8, 9, 10, 11, 12
+    };
+    ImageView2D srcImage{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 2}, src};
+    Image2D dstImage{PixelFormat::RGB8Unorm, {2, 2}, Containers::Array<char>{Containers::ValueInit, 16}};
+    const char expected[] {
+        1, 2, 3, 4, 5, 6, 0, 0,
+        7, 8, 9, 10, 11, 12, 0, 0
+    };
+
+    Magnum::copyImage(srcImage, dstImage);
+    CORRADE_COMPARE_AS(dstImage.data(),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::copySubImage() {
+    /* A 2x1 area from the second row of the source into an atlas with a
+       skip */
+    const char src[] {
+        1, 2, 3, 4,
+        5, 6, 7, 8
+    };
+    ImageView2D srcImage{PixelFormat::R8Unorm, {3, 2}, src};
+    Image2D dstImage{PixelStorage{}.setSkip({0, 1, 0}), PixelFormat::R8Unorm, {4, 2}, Containers::Array<char>{Containers::ValueInit, 12}};
+    const char expected[] {
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 6, 7
+    };
+
+    Magnum::copySubImage(srcImage, Vector2i{1, 1}, dstImage, Vector2i{2, 1}, Vector2i{2, 1});
+    CORRADE_COMPARE_AS(dstImage.data(),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::copyImageFlipY() {
+    const char src[] {
+        1, 2, 3, 4,
+        5, 6, 7, 8,
+        9, 10, 11, 12
+    };
+    ImageView2D srcImage{PixelFormat::RG8Unorm, {2, 3}, src};
+    Image2D dstImage{PixelFormat::RG8Unorm, {2, 3}, Containers::Array<char>{Containers::ValueInit, 12}};
+    const char expected[] {
+        9, 10, 11, 12,
+        5, 6, 7, 8,
+        1, 2, 3, 4
+    };
+
+    Magnum::copyImage(srcImage, dstImage, ImageCopyFlag::FlipY);
+    CORRADE_COMPARE_AS(dstImage.data(),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::copyImageRgbToRgba() {
+    /* Enough pixels in a row to go through both the vectorized and the scalar
+       code path */
+    Color3ub src[7];
+    Color4ub expected[7];
+    for(std::size_t i = 0; i != 7; ++i) {
+        src[i] = {UnsignedByte(i), UnsignedByte(i*2), UnsignedByte(i*3)};
+        expected[i] = {src[i], 255};
+    }
+    ImageView2D srcImage{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {7, 1}, src};
+    Image2D dstImage{PixelFormat::RGBA8Unorm, {7, 1}, Containers::Array<char>{7*4}};
+
+    Magnum::copyImage(srcImage, dstImage);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(dstImage.data()),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::copyImageRgbaToRgb() {
+    const Color4ub src[] {{1, 2, 3, 4}, {5, 6, 7, 8}};
+    ImageView2D srcImage{PixelFormat::RGBA8UI, {2, 1}, src};
+    Image2D dstImage{PixelStorage{}.setAlignment(1), PixelFormat::RGB8UI, {2, 1}, Containers::Array<char>{6}};
+    const Color3ub expected[] {{1, 2, 3}, {5, 6, 7}};
+
+    Magnum::copyImage(srcImage, dstImage);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color3ub>(dstImage.data()),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::copyImageUnpack() {
+    const Color3ub src[] {{0, 51, 255}, {102, 153, 204}};
+    ImageView2D srcImage{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 1}, src};
+    Image2D dstImage{PixelFormat::RGBA32F, {2, 1}, Containers::Array<char>{2*sizeof(Color4)}};
+    const Color4 expected[] {{0.0f, 0.2f, 1.0f, 1.0f}, {0.4f, 0.6f, 0.8f, 1.0f}};
+
+    Magnum::copyImage(srcImage, dstImage);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4>(dstImage.data()),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::copyImagePack() {
+    /* Values outside of the range get clamped */
+    const Color4 src[] {{0.0f, 1.0f, -0.5f, 0.5f}, {2.0f, 0.2f, 1.0f, 0.0f}};
+    ImageView2D srcImage{PixelFormat::RGBA32F, {2, 1}, src};
+    Image2D dstImage{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 1}, Containers::Array<char>{6}};
+    const Color3ub expected[] {{0, 255, 0}, {255, 51, 255}};
+
+    Magnum::copyImage(srcImage, dstImage);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color3ub>(dstImage.data()),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::copyImageInvalidConversion() {
+    const char src[4]{};
+    ImageView2D srcImage{PixelFormat::RG16Unorm, {1, 1}, src};
+    Image2D dstImage{PixelFormat::RGBA8Unorm, {1, 1}, Containers::Array<char>{4}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Magnum::copyImage(srcImage, dstImage);
+    CORRADE_COMPARE(out.str(), "copyImage(): can't convert PixelFormat::RG16Unorm to PixelFormat::RGBA8Unorm\n");
+}
+
+void PixelConversionTest::copyImageOutOfBounds() {
+    const char src[16]{};
+    ImageView2D srcImage{PixelFormat::R8Unorm, {4, 4}, src};
+    Image2D dstImage{PixelFormat::R8Unorm, {2, 2}, Containers::Array<char>{8}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Magnum::copySubImage(srcImage, Vector2i{3, 0}, dstImage, Vector2i{}, Vector2i{2, 2});
+    Magnum::copySubImage(srcImage, Vector2i{}, dstImage, Vector2i{0, 1}, Vector2i{2, 2});
+    CORRADE_COMPARE(out.str(),
+        "copyImage(): source area Vector(3, 0, 0) with size Vector(2, 2, 1) out of bounds for an image of size Vector(4, 4, 1)\n"
+        "copyImage(): destination area Vector(0, 1, 0) with size Vector(2, 2, 1) out of bounds for an image of size Vector(2, 2, 1)\n");
+}
+
+void PixelConversionTest::debugImageCopyFlag() {
+    std::ostringstream out;
+    Debug{&out} << ImageCopyFlag::FlipY << ImageCopyFlag(0xf0);
+    CORRADE_COMPARE(out.str(), "ImageCopyFlag::FlipY ImageCopyFlag(0xf0)\n");
+}
+
+void PixelConversionTest::debugImageCopyFlags() {
+    std::ostringstream out;
+    Debug{&out} << ImageCopyFlags{} << (ImageCopyFlag::FlipY|ImageCopyFlag(0xf0));
+    CORRADE_COMPARE(out.str(), "ImageCopyFlags{} ImageCopyFlag::FlipY|ImageCopyFlag(0xf0)\n");
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::PixelConversionTest)
@@ -24,8 +24,14 @@
 */
 
 #include <sstream>
+#include <string>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
 #include "Magnum/AbstractResourceLoader.h"
 #include "Magnum/ResourceManager.h"
 
@@ -41,10 +47,17 @@ struct ResourceManagerTest: TestSuite::Tester {
     void residentPolicy();
     void referenceCountedPolicy();
     void manualPolicy();
+    void budgetedPolicy();
+    void budgetedPolicyLoader();
     void defaults();
     void clear();
     void clearWhileReferenced();
+    void manyResources();
     void loader();
+    void loaderPublishedUpdates();
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void loaderThreads();
+    #endif
 
     void debugResourceState();
 };
@@ -68,10 +81,17 @@ ResourceManagerTest::ResourceManagerTest() {
               &ResourceManagerTest::residentPolicy,
               &ResourceManagerTest::referenceCountedPolicy,
               &ResourceManagerTest::manualPolicy,
+              &ResourceManagerTest::budgetedPolicy,
+              &ResourceManagerTest::budgetedPolicyLoader,
               &ResourceManagerTest::defaults,
               &ResourceManagerTest::clear,
               &ResourceManagerTest::clearWhileReferenced,
+              &ResourceManagerTest::manyResources,
               &ResourceManagerTest::loader,
+              &ResourceManagerTest::loaderPublishedUpdates,
+              #ifndef CORRADE_TARGET_EMSCRIPTEN
+              &ResourceManagerTest::loaderThreads,
+              #endif
 
               &ResourceManagerTest::debugResourceState});
 }
@@ -239,6 +259,88 @@ void ResourceManagerTest::manualPolicy() {
     CORRADE_COMPARE(Data::count, 1);
 }
 
+void ResourceManagerTest::budgetedPolicy() {
+    ResourceManager rm;
+    CORRADE_COMPARE(rm.budget<Data>(), ~std::size_t{});
+
+    rm.set("a", new Data, ResourceDataState::Final, ResourcePolicy::Budgeted, 40);
+    rm.set("b", new Data, ResourceDataState::Final, ResourcePolicy::Budgeted, 30);
+    rm.set("c", new Data, ResourceDataState::Final, ResourcePolicy::Budgeted, 20);
+    rm.set("resident", new Data, ResourceDataState::Final, ResourcePolicy::Resident, 50);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 140);
+    CORRADE_COMPARE(Data::count, 4);
+
+    /* Using "a" makes "c" the least recently used one */
+    {
+        Resource<Data> a = rm.get<Data>("a");
+    }
+
+    /* Referenced resources are not unloaded, "c" and "a" need to go */
+    {
+        Resource<Data> b = rm.get<Data>("b");
+        rm.setBudget<Data>(100);
+        CORRADE_COMPARE(rm.budget<Data>(), 100);
+        CORRADE_COMPARE(rm.memoryUsage<Data>(), 80);
+        CORRADE_COMPARE(rm.count<Data>(), 2);
+        CORRADE_COMPARE(rm.state<Data>("a"), ResourceState::NotLoaded);
+        CORRADE_COMPARE(rm.state<Data>("b"), ResourceState::Final);
+        CORRADE_COMPARE(rm.state<Data>("c"), ResourceState::NotLoaded);
+        CORRADE_COMPARE(Data::count, 2);
+
+        /* Over budget, but nothing to unload */
+        Resource<Data> d = rm.get<Data>("d");
+        rm.set("d", new Data, ResourceDataState::Final, ResourcePolicy::Budgeted, 30);
+        rm.set("e", new Data, ResourceDataState::Final, ResourcePolicy::Manual, 10);
+        CORRADE_COMPARE(rm.memoryUsage<Data>(), 120);
+        CORRADE_COMPARE(rm.count<Data>(), 4);
+        CORRADE_COMPARE(Data::count, 4);
+    }
+
+    /* Releasing the last reference to "d" puts it over the budget, so it gets
+       unloaded, after that "b" fits */
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 90);
+    CORRADE_COMPARE(rm.state<Data>("b"), ResourceState::Final);
+    CORRADE_COMPARE(rm.state<Data>("d"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(Data::count, 3);
+
+    rm.clear();
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 0);
+    CORRADE_COMPARE(Data::count, 0);
+}
+
+void ResourceManagerTest::budgetedPolicyLoader() {
+    class DataResourceLoader: public AbstractResourceLoader<Data> {
+        private:
+            void doLoad(ResourceKey key) override {
+                set(key, new Data, ResourceDataState::Final, ResourcePolicy::Budgeted, 10);
+            }
+    };
+
+    {
+        ResourceManager rm;
+        auto loader = new DataResourceLoader;
+        rm.setLoader(loader);
+        rm.setBudget<Data>(20);
+
+        for(const std::string key: {"a", "b", "c"}) {
+            Resource<Data> data = rm.get<Data>(key);
+            CORRADE_COMPARE(data.state(), ResourceState::Final);
+        }
+        CORRADE_COMPARE(rm.memoryUsage<Data>(), 20);
+        CORRADE_COMPARE(rm.state<Data>("a"), ResourceState::NotLoaded);
+        CORRADE_COMPARE(loader->requestedCount(), 3);
+
+        /* Unloaded resource is requested from the loader again */
+        Resource<Data> a = rm.get<Data>("a");
+        CORRADE_COMPARE(a.state(), ResourceState::Final);
+        CORRADE_COMPARE(loader->requestedCount(), 4);
+        CORRADE_COMPARE(rm.state<Data>("b"), ResourceState::NotLoaded);
+        CORRADE_COMPARE(rm.memoryUsage<Data>(), 20);
+    }
+
+    CORRADE_COMPARE(Data::count, 0);
+}
+
 void ResourceManagerTest::defaults() {
     ResourceManager rm;
     rm.set("data", new Data);
@@ -275,6 +377,37 @@ void ResourceManagerTest::clearWhileReferenced() {
     CORRADE_COMPARE(out.str(), "ResourceManager: cleared/destroyed while data are still referenced\n");
 }
 
+void ResourceManagerTest::manyResources() {
+    ResourceManager rm;
+
+    /* Enough keys to grow the storage a few times, keys created from
+       sequential integers are the worst case for the hashing */
+    for(std::size_t i = 0; i != 1000; ++i)
+        rm.set(ResourceKey{i}, new Data, ResourceDataState::Final, ResourcePolicy::ReferenceCounted);
+    CORRADE_COMPARE(rm.count<Data>(), 1000);
+    CORRADE_COMPARE(Data::count, 1000);
+
+    /* Free every other. The remaining ones are still reachable. */
+    for(std::size_t i = 0; i != 1000; i += 2)
+        rm.get<Data>(ResourceKey{i});
+    CORRADE_COMPARE(rm.count<Data>(), 500);
+    CORRADE_COMPARE(Data::count, 500);
+    for(std::size_t i = 0; i != 1000; ++i)
+        CORRADE_COMPARE(rm.state<Data>(ResourceKey{i}), i % 2 ? ResourceState::Final : ResourceState::NotLoaded);
+
+    /* Add them back and a few more, replacing the erased entries */
+    for(std::size_t i = 0; i != 1500; i += 2)
+        rm.set(ResourceKey{i}, new Data, ResourceDataState::Final, ResourcePolicy::ReferenceCounted);
+    CORRADE_COMPARE(rm.count<Data>(), 1250);
+    CORRADE_COMPARE(Data::count, 1250);
+    for(std::size_t i = 0; i != 1500; ++i)
+        CORRADE_COMPARE(rm.state<Data>(ResourceKey{i}), i < 1000 || i % 2 == 0 ? ResourceState::Final : ResourceState::NotLoaded);
+
+    rm.clear();
+    CORRADE_COMPARE(rm.count<Data>(), 0);
+    CORRADE_COMPARE(Data::count, 0);
+}
+
 void ResourceManagerTest::loader() {
     class IntResourceLoader: public AbstractResourceLoader<Int> {
         public:
@@ -333,6 +466,104 @@ void ResourceManagerTest::loader() {
     CORRADE_COMPARE(Data::count, 0);
 }
 
+void ResourceManagerTest::loaderPublishedUpdates() {
+    class IntResourceLoader: public AbstractResourceLoader<Int> {
+        public:
+            void load() {
+                set("hello", 773, ResourceDataState::Mutable, ResourcePolicy::Resident);
+                set("hello", 1337, ResourceDataState::Final, ResourcePolicy::Resident);
+                set("unused", 42, ResourceDataState::Final, ResourcePolicy::Resident);
+            }
+
+        private:
+            void doLoad(ResourceKey) override {}
+    };
+
+    {
+        ResourceManager rm;
+        auto loader = new IntResourceLoader;
+        rm.setLoader(loader);
+
+        Resource<Int> hello = rm.get<Int>("hello");
+        CORRADE_COMPARE(hello.state(), ResourceState::Loading);
+
+        /* The updates are applied in order on first access */
+        loader->load();
+        CORRADE_COMPARE(hello.state(), ResourceState::Final);
+        CORRADE_COMPARE(*hello, 1337);
+        CORRADE_COMPARE(rm.count<Int>(), 2);
+        CORRADE_COMPARE(loader->loadedCount(), 3);
+    }
+
+    class DataResourceLoader: public AbstractResourceLoader<Data> {
+        public:
+            void load() {
+                set("data", new Data, ResourceDataState::Final, ResourcePolicy::Resident);
+            }
+
+        private:
+            void doLoad(ResourceKey) override {}
+    };
+
+    /* Published but not yet applied updates are deleted with the manager */
+    {
+        ResourceManager rm;
+        auto loader = new DataResourceLoader;
+        rm.setLoader(loader);
+        loader->load();
+        CORRADE_COMPARE(Data::count, 1);
+    }
+
+    CORRADE_COMPARE(Data::count, 0);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void ResourceManagerTest::loaderThreads() {
+    class DataResourceLoader: public AbstractResourceLoader<Data> {
+        public:
+            ~DataResourceLoader() { wait(); }
+
+            void wait() {
+                for(std::thread& thread: _threads) thread.join();
+                _threads.clear();
+            }
+
+        private:
+            void doLoad(ResourceKey key) override {
+                _threads.emplace_back([this, key]() {
+                    if(key == ResourceKey("missing")) setNotFound(key);
+                    else set(key, new Data, ResourceDataState::Final, ResourcePolicy::Resident);
+                });
+            }
+
+            std::vector<std::thread> _threads;
+    };
+
+    {
+        ResourceManager rm;
+        auto loader = new DataResourceLoader;
+        rm.setLoader(loader);
+
+        std::vector<Resource<Data>> resources;
+        for(Int i = 0; i != 64; ++i)
+            resources.push_back(rm.get<Data>(std::to_string(i)));
+        Resource<Data> missing = rm.get<Data>("missing");
+        CORRADE_COMPARE(loader->requestedCount(), 65);
+
+        loader->wait();
+        CORRADE_COMPARE(loader->loadedCount(), 64);
+        CORRADE_COMPARE(loader->notFoundCount(), 1);
+        for(Resource<Data>& resource: resources)
+            CORRADE_COMPARE(resource.state(), ResourceState::Final);
+        CORRADE_COMPARE(missing.state(), ResourceState::NotFound);
+        CORRADE_COMPARE(rm.count<Data>(), 65);
+        CORRADE_COMPARE(Data::count, 64);
+    }
+
+    CORRADE_COMPARE(Data::count, 0);
+}
+#endif
+
 void ResourceManagerTest::debugResourceState() {
     std::ostringstream out;
     Debug{&out} << ResourceState::Loading << ResourceState(0xbe);
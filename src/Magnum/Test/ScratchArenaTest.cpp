@@ -0,0 +1,175 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <cstdint>
+#include <sstream>
+#include <thread>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/ScratchArena.h"
+
+namespace Magnum { namespace Test {
+
+struct ScratchArenaTest: TestSuite::Tester {
+    explicit ScratchArenaTest();
+
+    void allocate();
+    void allocateAlignment();
+    void allocateOversized();
+    void reset();
+    void invalidAlignment();
+
+    void current();
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void currentThreadLocal();
+    #endif
+};
+
+ScratchArenaTest::ScratchArenaTest() {
+    addTests({&ScratchArenaTest::allocate,
+              &ScratchArenaTest::allocateAlignment,
+              &ScratchArenaTest::allocateOversized,
+              &ScratchArenaTest::reset,
+              &ScratchArenaTest::invalidAlignment,
+
+              &ScratchArenaTest::current,
+              #ifndef CORRADE_TARGET_EMSCRIPTEN
+              &ScratchArenaTest::currentThreadLocal
+              #endif
+              });
+}
+
+void ScratchArenaTest::allocate() {
+    ScratchArena arena{1024};
+    CORRADE_COMPARE(arena.blockSize(), 1024);
+    CORRADE_COMPARE(arena.capacity(), 0);
+    CORRADE_COMPARE(arena.usedSize(), 0);
+    CORRADE_VERIFY(!arena.allocate(0));
+
+    char* a = static_cast<char*>(arena.allocate(100, 1));
+    char* b = static_cast<char*>(arena.allocate(100, 1));
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(b, a + 100);
+    CORRADE_COMPARE(arena.usedSize(), 200);
+    CORRADE_COMPARE(arena.capacity(), 1024);
+
+    Containers::ArrayView<UnsignedInt> c = arena.allocate<UnsignedInt>(10);
+    CORRADE_COMPARE(c.size(), 10);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(c.data()) % alignof(UnsignedInt), 0);
+    CORRADE_COMPARE(arena.usedSize(), 240);
+
+    /* Doesn't fit into the first block anymore */
+    CORRADE_VERIFY(arena.allocate(1000, 1));
+    CORRADE_COMPARE(arena.usedSize(), 1240);
+    CORRADE_COMPARE(arena.capacity(), 2048);
+}
+
+void ScratchArenaTest::allocateAlignment() {
+    ScratchArena arena;
+
+    arena.allocate(1, 1);
+    void* a = arena.allocate(16, 64);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(a) % 64, 0);
+
+    arena.allocate(3, 1);
+    void* b = arena.allocate(8, 8);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(b) % 8, 0);
+
+    /* Padding is not counted */
+    CORRADE_COMPARE(arena.usedSize(), 28);
+}
+
+void ScratchArenaTest::allocateOversized() {
+    ScratchArena arena{64};
+
+    void* a = arena.allocate(1000, 32);
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(a) % 32, 0);
+    CORRADE_COMPARE(arena.capacity(), 1031);
+
+    /* Usable all the way */
+    for(std::size_t i = 0; i != 1000; ++i) static_cast<char*>(a)[i] = char(i);
+    CORRADE_COMPARE(static_cast<char*>(a)[999], char(999));
+}
+
+void ScratchArenaTest::reset() {
+    ScratchArena arena{256};
+    void* a = arena.allocate(200);
+    arena.allocate(200);
+    CORRADE_COMPARE(arena.capacity(), 512);
+
+    arena.reset();
+    CORRADE_COMPARE(arena.usedSize(), 0);
+    CORRADE_COMPARE(arena.capacity(), 512);
+
+    /* The same memory is reused, no new blocks */
+    CORRADE_COMPARE(arena.allocate(200), a);
+    arena.allocate(200);
+    CORRADE_COMPARE(arena.capacity(), 512);
+}
+
+void ScratchArenaTest::invalidAlignment() {
+    ScratchArena arena;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    arena.allocate(16, 0);
+    arena.allocate(16, 12);
+    CORRADE_COMPARE(out.str(),
+        "ScratchArena::allocate(): expected alignment to be a power of two but got 0\n"
+        "ScratchArena::allocate(): expected alignment to be a power of two but got 12\n");
+}
+
+void ScratchArenaTest::current() {
+    CORRADE_VERIFY(!ScratchArena::current());
+
+    ScratchArena arena;
+    ScratchArena::setCurrent(&arena);
+    CORRADE_COMPARE(ScratchArena::current(), &arena);
+
+    ScratchArena::setCurrent(nullptr);
+    CORRADE_VERIFY(!ScratchArena::current());
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void ScratchArenaTest::currentThreadLocal() {
+    ScratchArena arena;
+    ScratchArena::setCurrent(&arena);
+
+    /* Other threads don't see the arena */
+    ScratchArena* other = &arena;
+    std::thread{[&other]{ other = ScratchArena::current(); }}.join();
+    CORRADE_VERIFY(!other);
+    CORRADE_COMPARE(ScratchArena::current(), &arena);
+
+    ScratchArena::setCurrent(nullptr);
+}
+#endif
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ScratchArenaTest)
@@ -0,0 +1,242 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/ScratchArena.h"
+#include "Magnum/Timeline.h"
+
+namespace Magnum { namespace Test {
+
+struct TimelineTest: TestSuite::Tester {
+    explicit TimelineTest();
+
+    void construct();
+    void statisticsDisabled();
+    void statisticsEmpty();
+    void percentile();
+    void percentileRingBuffer();
+    void hitches();
+    void resetStatistics();
+    void nextFrame();
+    void frameArena();
+    void frameArenaSetWhileRunning();
+
+    void debugFrameStatistics();
+};
+
+TimelineTest::TimelineTest() {
+    addTests({&TimelineTest::construct,
+              &TimelineTest::statisticsDisabled,
+              &TimelineTest::statisticsEmpty,
+              &TimelineTest::percentile,
+              &TimelineTest::percentileRingBuffer,
+              &TimelineTest::hitches,
+              &TimelineTest::resetStatistics,
+              &TimelineTest::nextFrame,
+              &TimelineTest::frameArena,
+              &TimelineTest::frameArenaSetWhileRunning,
+
+              &TimelineTest::debugFrameStatistics});
+}
+
+void TimelineTest::construct() {
+    Timeline timeline;
+    CORRADE_COMPARE(timeline.previousFrameDuration(), 0.0f);
+    CORRADE_COMPARE(timeline.frameStatisticsSize(), 0);
+    CORRADE_COMPARE(timeline.recordedFrameCount(), 0);
+    CORRADE_COMPARE(timeline.hitchThreshold(), Constants::inf());
+    CORRADE_COMPARE(timeline.hitchCount(), 0);
+    CORRADE_VERIFY(!timeline.frameArena());
+}
+
+void TimelineTest::statisticsDisabled() {
+    Timeline timeline;
+    timeline.setHitchThreshold(0.01f);
+    timeline.recordFrameDuration(0.5f);
+    CORRADE_COMPARE(timeline.recordedFrameCount(), 0);
+    CORRADE_COMPARE(timeline.hitchCount(), 0);
+    CORRADE_COMPARE(timeline.frameDurationPercentile(0.5f), 0.0f);
+}
+
+void TimelineTest::statisticsEmpty() {
+    Timeline timeline;
+    timeline.setFrameStatisticsSize(10);
+
+    const Timeline::FrameStatistics statistics = timeline.frameStatistics();
+    CORRADE_COMPARE(statistics.frameCount, 0);
+    CORRADE_COMPARE(statistics.min, 0.0f);
+    CORRADE_COMPARE(statistics.p99, 0.0f);
+    CORRADE_COMPARE(statistics.max, 0.0f);
+}
+
+void TimelineTest::percentile() {
+    Timeline timeline;
+    timeline.setFrameStatisticsSize(100);
+
+    /* 1 to 100 milliseconds, in reverse */
+    for(Int i = 100; i != 0; --i) timeline.recordFrameDuration(i/1000.0f);
+    CORRADE_COMPARE(timeline.recordedFrameCount(), 100);
+
+    CORRADE_COMPARE(timeline.frameDurationPercentile(0.0f), 0.001f);
+    CORRADE_COMPARE(timeline.frameDurationPercentile(0.5f), 0.050f);
+    CORRADE_COMPARE(timeline.frameDurationPercentile(0.95f), 0.095f);
+    CORRADE_COMPARE(timeline.frameDurationPercentile(1.0f), 0.100f);
+
+    const Timeline::FrameStatistics statistics = timeline.frameStatistics();
+    CORRADE_COMPARE(statistics.frameCount, 100);
+    CORRADE_COMPARE(statistics.min, 0.001f);
+    CORRADE_COMPARE(statistics.max, 0.100f);
+    CORRADE_COMPARE(statistics.mean, 0.0505f);
+    CORRADE_COMPARE(statistics.p50, 0.050f);
+    CORRADE_COMPARE(statistics.p95, 0.095f);
+    CORRADE_COMPARE(statistics.p99, 0.099f);
+}
+
+void TimelineTest::percentileRingBuffer() {
+    Timeline timeline;
+    timeline.setFrameStatisticsSize(4);
+
+    /* The first two frames get overwritten */
+    for(Float duration: {1.0f, 1.0f, 0.1f, 0.2f, 0.3f, 0.4f})
+        timeline.recordFrameDuration(duration);
+    CORRADE_COMPARE(timeline.recordedFrameCount(), 4);
+
+    const Timeline::FrameStatistics statistics = timeline.frameStatistics();
+    CORRADE_COMPARE(statistics.frameCount, 4);
+    CORRADE_COMPARE(statistics.min, 0.1f);
+    CORRADE_COMPARE(statistics.max, 0.4f);
+    CORRADE_COMPARE(statistics.p50, 0.2f);
+    CORRADE_COMPARE(statistics.p99, 0.4f);
+}
+
+void TimelineTest::hitches() {
+    Timeline timeline;
+    timeline.setFrameStatisticsSize(2)
+        .setHitchThreshold(0.05f);
+
+    /* Hitches are counted also for frames that are not in the ring buffer
+       anymore */
+    for(Float duration: {0.1f, 0.01f, 0.06f, 0.05f, 0.02f})
+        timeline.recordFrameDuration(duration);
+    CORRADE_COMPARE(timeline.hitchCount(), 2);
+    CORRADE_COMPARE(timeline.frameStatistics().hitchCount, 2);
+}
+
+void TimelineTest::resetStatistics() {
+    Timeline timeline;
+    timeline.setFrameStatisticsSize(3)
+        .setHitchThreshold(0.05f);
+    timeline.recordFrameDuration(0.1f);
+    timeline.recordFrameDuration(0.2f);
+
+    timeline.resetFrameStatistics();
+    CORRADE_COMPARE(timeline.frameStatisticsSize(), 3);
+    CORRADE_COMPARE(timeline.hitchThreshold(), 0.05f);
+    CORRADE_COMPARE(timeline.recordedFrameCount(), 0);
+    CORRADE_COMPARE(timeline.hitchCount(), 0);
+
+    timeline.recordFrameDuration(0.01f);
+    CORRADE_COMPARE(timeline.frameDurationPercentile(0.99f), 0.01f);
+
+    /* Changing the size resets as well */
+    timeline.setFrameStatisticsSize(5);
+    CORRADE_COMPARE(timeline.recordedFrameCount(), 0);
+}
+
+void TimelineTest::nextFrame() {
+    Timeline timeline;
+    timeline.setFrameStatisticsSize(3);
+
+    /* Stopped timeline doesn't record anything */
+    timeline.nextFrame();
+    CORRADE_COMPARE(timeline.recordedFrameCount(), 0);
+
+    timeline.start();
+    timeline.nextFrame();
+    timeline.nextFrame();
+    CORRADE_COMPARE(timeline.recordedFrameCount(), 2);
+    CORRADE_VERIFY(timeline.frameStatistics().max >= timeline.previousFrameDuration());
+}
+
+void TimelineTest::frameArena() {
+    ScratchArena arena;
+    Timeline timeline;
+    timeline.setFrameArena(&arena);
+    CORRADE_COMPARE(timeline.frameArena(), &arena);
+
+    /* Not current until started */
+    CORRADE_VERIFY(!ScratchArena::current());
+
+    arena.allocate(100);
+    timeline.start();
+    CORRADE_COMPARE(ScratchArena::current(), &arena);
+    CORRADE_COMPARE(arena.usedSize(), 0);
+
+    /* Reset every frame, keeping the memory */
+    void* data = arena.allocate(100);
+    timeline.nextFrame();
+    CORRADE_COMPARE(arena.usedSize(), 0);
+    CORRADE_COMPARE(arena.allocate(100), data);
+    CORRADE_COMPARE(arena.capacity(), arena.blockSize());
+
+    timeline.stop();
+    CORRADE_VERIFY(!ScratchArena::current());
+    CORRADE_COMPARE(arena.usedSize(), 0);
+}
+
+void TimelineTest::frameArenaSetWhileRunning() {
+    ScratchArena a, b;
+    Timeline timeline;
+    timeline.start();
+    CORRADE_VERIFY(!ScratchArena::current());
+
+    timeline.setFrameArena(&a);
+    CORRADE_COMPARE(ScratchArena::current(), &a);
+
+    timeline.setFrameArena(&b);
+    CORRADE_COMPARE(ScratchArena::current(), &b);
+
+    timeline.setFrameArena(nullptr);
+    CORRADE_VERIFY(!ScratchArena::current());
+}
+
+void TimelineTest::debugFrameStatistics() {
+    Timeline timeline;
+    timeline.setFrameStatisticsSize(2)
+        .setHitchThreshold(0.02f);
+    timeline.recordFrameDuration(0.010f);
+    timeline.recordFrameDuration(0.030f);
+
+    std::ostringstream out;
+    Debug{&out} << timeline.frameStatistics();
+    CORRADE_COMPARE(out.str(), "2 frames, min 10ms, mean 20ms, p50 10ms, p95 30ms, p99 30ms, max 30ms, 1 hitches\n");
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::TimelineTest)
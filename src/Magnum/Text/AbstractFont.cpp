@@ -39,7 +39,7 @@
 namespace Magnum { namespace Text {
 
 std::string AbstractFont::pluginInterface() {
-    return "cz.mosra.magnum.Text.AbstractFont/0.2.4";
+    return "cz.mosra.magnum.Text.AbstractFont/0.2.5";
 }
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
@@ -185,6 +185,31 @@ std::unique_ptr<AbstractLayouter> AbstractFont::layout(const GlyphCache& cache,
     return doLayout(cache, size, text);
 }
 
+UnsignedInt AbstractFont::layoutInto(const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::StridedArrayView<Range2D> quadPositions, const Containers::StridedArrayView<Range2D> textureCoordinates, const Containers::StridedArrayView<Vector2> advances) {
+    CORRADE_ASSERT(isOpened(), "Text::AbstractFont::layoutInto(): no font opened", {});
+    CORRADE_ASSERT(quadPositions.size() == textureCoordinates.size() && quadPositions.size() == advances.size(),
+        "Text::AbstractFont::layoutInto(): expected views of the same size but got" << quadPositions.size() << Debug::nospace << "," << textureCoordinates.size() << "and" << advances.size(), {});
+    CORRADE_ASSERT(quadPositions.size() >= text.size(),
+        "Text::AbstractFont::layoutInto(): expected at least" << text.size() << "glyphs of storage but got" << quadPositions.size(), {});
+
+    return doLayoutInto(cache, size, text, quadPositions, textureCoordinates, advances);
+}
+
+UnsignedInt AbstractFont::doLayoutInto(const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::StridedArrayView<Range2D> quadPositions, const Containers::StridedArrayView<Range2D> textureCoordinates, const Containers::StridedArrayView<Vector2> advances) {
+    const std::unique_ptr<AbstractLayouter> layouter = doLayout(cache, size, std::string{text, text.size()});
+
+    /* The only problem might arise when the layouter decides to compose one
+       character from more than one glyph (i.e. accents). Will remove the
+       assert when this issue arises. */
+    const UnsignedInt glyphCount = layouter->glyphCount();
+    CORRADE_INTERNAL_ASSERT(glyphCount <= quadPositions.size());
+
+    for(UnsignedInt i = 0; i != glyphCount; ++i)
+        std::tie(quadPositions[i], textureCoordinates[i], advances[i]) = layouter->doRenderGlyph(i);
+
+    return glyphCount;
+}
+
 AbstractLayouter::AbstractLayouter(UnsignedInt glyphCount): _glyphCount(glyphCount) {}
 
 AbstractLayouter::~AbstractLayouter() = default;
@@ -33,6 +33,7 @@
 #include <string>
 #include <vector>
 #include <tuple>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/PluginManager/AbstractPlugin.h>
 
 #include "Magnum/Magnum.h"
@@ -105,7 +106,7 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          * @brief Plugin interface
          *
          * @code{.cpp}
-         * "cz.mosra.magnum.Text.AbstractFont/0.2.4"
+         * "cz.mosra.magnum.Text.AbstractFont/0.2.5"
          * @endcode
          */
         static std::string pluginInterface();
@@ -265,6 +266,32 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          */
         std::unique_ptr<AbstractLayouter> layout(const GlyphCache& cache, Float size, const std::string& text);
 
+        /**
+         * @brief Layout the text into existing storage
+         * @param cache                 Glyph cache
+         * @param size                  Font size
+         * @param text                  Text to layout
+         * @param quadPositions         Where to put quad position of each
+         *      glyph, relative to the cursor
+         * @param textureCoordinates    Where to put texture coordinates of
+         *      each glyph
+         * @param advances              Where to put cursor advance after each
+         *      glyph
+         * @return Count of laid out glyphs
+         *
+         * Alternative to @ref layout() that doesn't need the text to be copied
+         * into a @ref std::string and doesn't allocate the layouter, useful
+         * for relayouting many texts every frame. Expects that all three
+         * views have the same size and that the size is at least the size of
+         * @p text, as each UTF-8 character produces at most one glyph. Only
+         * the first returned count of items is filled.
+         *
+         * If the font doesn't provide a specialized implementation, the
+         * default one goes through @ref layout(), allocating the same as
+         * before.
+         */
+        UnsignedInt layoutInto(const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, Containers::StridedArrayView<Range2D> quadPositions, Containers::StridedArrayView<Range2D> textureCoordinates, Containers::StridedArrayView<Vector2> advances);
+
     protected:
         /**
          * @brief Font metrics
@@ -358,6 +385,15 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
         /** @brief Implementation for @ref layout() */
         virtual std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache& cache, Float size, const std::string& text) = 0;
 
+        /**
+         * @brief Implementation for @ref layoutInto()
+         *
+         * The views are guaranteed to have the same size, which is at least
+         * the size of @p text. Default implementation calls @ref doLayout()
+         * and copies the glyph data out of the returned layouter.
+         */
+        virtual UnsignedInt doLayoutInto(const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, Containers::StridedArrayView<Range2D> quadPositions, Containers::StridedArrayView<Range2D> textureCoordinates, Containers::StridedArrayView<Vector2> advances);
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #endif
@@ -378,6 +414,8 @@ implements @ref doRenderGlyph(). Bounds checking on @p i is done automatically
 in the wrapping @ref renderGlyph() function.
 */
 class MAGNUM_TEXT_EXPORT AbstractLayouter {
+    friend AbstractFont;
+
     public:
         /** @brief Copying is not allowed */
         AbstractLayouter(const AbstractLayouter&) = delete;
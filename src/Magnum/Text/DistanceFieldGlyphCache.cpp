@@ -36,30 +36,51 @@
 
 namespace Magnum { namespace Text {
 
-DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, const UnsignedInt radius):
+namespace {
+
+GL::TextureFormat internalFormat(const DistanceFieldGlyphCache::Flags flags) {
+    if(flags & DistanceFieldGlyphCache::Flag::MultiChannel)
+        #if !(defined(MAGNUM_TARGET_GLES) && defined(MAGNUM_TARGET_GLES2))
+        return GL::TextureFormat::RGB8;
+        #else
+        return GL::TextureFormat::RGB;
+        #endif
+
     #if !(defined(MAGNUM_TARGET_GLES) && defined(MAGNUM_TARGET_GLES2))
-    GlyphCache(GL::TextureFormat::R8, originalSize, size, Vector2i(radius)),
+    return GL::TextureFormat::R8;
     #elif !defined(MAGNUM_TARGET_WEBGL)
     /* Luminance is not renderable in most cases */
-    GlyphCache(GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>() ?
-        GL::TextureFormat::Red : GL::TextureFormat::RGB, originalSize, size, Vector2i(radius)),
+    return GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>() ?
+        GL::TextureFormat::Red : GL::TextureFormat::RGB;
     #else
-    GlyphCache(GL::TextureFormat::RGB, originalSize, size, Vector2i(radius)),
+    return GL::TextureFormat::RGB;
     #endif
-    scale(Vector2(size)/Vector2(originalSize)), radius(radius)
+}
+
+}
+
+DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, const UnsignedInt radius): DistanceFieldGlyphCache{originalSize, size, radius, {}} {}
+
+DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, const UnsignedInt radius, const Flags flags):
+    GlyphCache(internalFormat(flags), originalSize, size, Vector2i(radius)),
+    scale(Vector2(size)/Vector2(originalSize)), radius(radius), _flags{flags}
 {
     #ifndef MAGNUM_TARGET_GLES
-    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::texture_rg);
+    if(!(flags & Flag::MultiChannel))
+        MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::texture_rg);
     #endif
 
     #if defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
     /* Luminance is not renderable in most cases */
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>())
+    if(!(flags & Flag::MultiChannel) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>())
         Warning() << "Text::DistanceFieldGlyphCache:" << GL::Extensions::EXT::texture_rg::string() << "not supported, using inefficient RGB format for glyph cache texture";
     #endif
 }
 
 void DistanceFieldGlyphCache::setImage(const Vector2i& offset, const ImageView2D& image) {
+    CORRADE_ASSERT(!(_flags & Flag::MultiChannel),
+        "Text::DistanceFieldGlyphCache::setImage(): multi-channel distance field can't be computed from a binary image, use setDistanceFieldImage() instead", );
+
     GL::Texture2D input;
     input.setWrapping(GL::SamplerWrapping::ClampToEdge)
         .setMinificationFilter(GL::SamplerFilter::Linear)
@@ -94,22 +115,27 @@ void DistanceFieldGlyphCache::setImage(const Vector2i& offset, const ImageView2D
 
 void DistanceFieldGlyphCache::setDistanceFieldImage(const Vector2i& offset, const ImageView2D& image) {
     const GL::PixelFormat format = GL::pixelFormat(image.format());
-    #if !(defined(MAGNUM_TARGET_GLES) && defined(MAGNUM_TARGET_GLES2))
-    CORRADE_ASSERT(format == GL::PixelFormat::Red,
-        "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected" << GL::PixelFormat::Red << "but got" << format, );
-    #else
-    #ifndef MAGNUM_TARGET_WEBGL
-    if(GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>())
-        CORRADE_ASSERT(format == GL::PixelFormat::Red,
-            "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected" << GL::PixelFormat::Red << "but got" << format, );
-    else
-    #endif
-    {
-        /* Luminance is not renderable in most cases */
+    if(_flags & Flag::MultiChannel) {
         CORRADE_ASSERT(format == GL::PixelFormat::RGB,
             "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected" << GL::PixelFormat::RGB << "but got" << format, );
+    } else {
+        #if !(defined(MAGNUM_TARGET_GLES) && defined(MAGNUM_TARGET_GLES2))
+        CORRADE_ASSERT(format == GL::PixelFormat::Red,
+            "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected" << GL::PixelFormat::Red << "but got" << format, );
+        #else
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>())
+            CORRADE_ASSERT(format == GL::PixelFormat::Red,
+                "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected" << GL::PixelFormat::Red << "but got" << format, );
+        else
+        #endif
+        {
+            /* Luminance is not renderable in most cases */
+            CORRADE_ASSERT(format == GL::PixelFormat::RGB,
+                "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected" << GL::PixelFormat::RGB << "but got" << format, );
+        }
+        #endif
     }
-    #endif
 
     texture().setSubImage(0, offset, image);
 }
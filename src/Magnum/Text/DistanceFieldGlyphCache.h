@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Text::DistanceFieldGlyphCache
  */
 
+#include <Corrade/Containers/EnumSet.h>
+
 #include "Magnum/Text/GlyphCache.h"
 
 namespace Magnum { namespace Text {
@@ -47,10 +49,40 @@ resulting distance field texture.
 
 @snippet MagnumText.cpp DistanceFieldGlyphCache-usage
 
+@section Text-DistanceFieldGlyphCache-multi-channel Multi-channel distance fields
+
+With @ref Flag::MultiChannel the cache stores a multi-channel signed distance
+field in an RGB texture, which keeps glyph corners sharp even with a much
+smaller cache texture. Such distance fields can't be computed from binary
+glyph images, so they need to be generated from glyph outlines by an
+external tool and uploaded with @ref setDistanceFieldImage(). Render the text
+with @ref Shaders::DistanceFieldVector::Flag::MultiChannel set.
+
 @see @ref TextureTools::distanceField()
 */
 class MAGNUM_TEXT_EXPORT DistanceFieldGlyphCache: public GlyphCache {
     public:
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Store a multi-channel distance field in an RGB texture. See
+             * @ref Text-DistanceFieldGlyphCache-multi-channel for more
+             * information.
+             */
+            MultiChannel = 1 << 0
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
         /**
          * @brief Constructor
          * @param originalSize      Unscaled glyph cache texture size
@@ -68,11 +100,26 @@ class MAGNUM_TEXT_EXPORT DistanceFieldGlyphCache: public GlyphCache {
          */
         explicit DistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, UnsignedInt radius);
 
+        /**
+         * @brief Construct with flags
+         *
+         * If @ref Flag::MultiChannel is set, sets internal texture format to
+         * @ref GL::TextureFormat::RGB8 (@ref GL::TextureFormat::RGB on
+         * OpenGL ES 2.0 and WebGL 1.0), otherwise it's the same as
+         * @ref DistanceFieldGlyphCache(const Vector2i&, const Vector2i&, UnsignedInt).
+         */
+        explicit DistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, UnsignedInt radius, Flags flags);
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
         /**
          * @brief Set cache image
          *
          * Uploads image for one or more glyphs to given offset in original
          * cache texture. The texture is then converted to distance field.
+         * Expects that @ref Flag::MultiChannel is not set, use
+         * @ref setDistanceFieldImage() in that case.
          */
         void setImage(const Vector2i& offset, const ImageView2D& image) override;
 
@@ -80,15 +127,19 @@ class MAGNUM_TEXT_EXPORT DistanceFieldGlyphCache: public GlyphCache {
          * @brief Set distance field cache image
          *
          * Uploads already computed distance field image to given offset in
-         * distance field texture.
+         * distance field texture. If @ref Flag::MultiChannel is set, the
+         * image is expected to have three channels.
          */
         void setDistanceFieldImage(const Vector2i& offset, const ImageView2D& image);
 
     private:
         const Vector2 scale;
         const UnsignedInt radius;
+        const Flags _flags;
 };
 
+CORRADE_ENUMSET_OPERATORS(DistanceFieldGlyphCache::Flags)
+
 }}
 
 #endif
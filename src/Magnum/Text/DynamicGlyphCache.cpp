@@ -0,0 +1,159 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DynamicGlyphCache.h"
+
+#include <tuple>
+#include <unordered_set>
+#include <Corrade/Utility/Unicode.h>
+
+#include "Magnum/Text/AbstractFont.h"
+
+namespace Magnum { namespace Text {
+
+DynamicGlyphCache::DynamicGlyphCache(const GL::TextureFormat internalFormat, const Vector2i& size, const UnsignedInt pageCount, const Vector2i& padding): GlyphCache{internalFormat, size, padding} {
+    createPages(pageCount);
+}
+
+DynamicGlyphCache::DynamicGlyphCache(const Vector2i& size, const UnsignedInt pageCount, const Vector2i& padding): GlyphCache{size, padding} {
+    createPages(pageCount);
+}
+
+DynamicGlyphCache::~DynamicGlyphCache() = default;
+
+void DynamicGlyphCache::createPages(const UnsignedInt pageCount) {
+    _pageHeight = 0;
+    _currentUse = 0;
+    _evictionCount = 0;
+
+    CORRADE_ASSERT(pageCount && pageCount <= UnsignedInt(textureSize().y()),
+        "Text::DynamicGlyphCache: expected page count between 1 and" << textureSize().y() << "but got" << pageCount, );
+
+    _pageHeight = textureSize().y()/pageCount;
+    _pages.reserve(pageCount);
+    for(UnsignedInt i = 0; i != pageCount; ++i)
+        _pages.emplace_back(Vector2i{textureSize().x(), _pageHeight}, padding());
+}
+
+UnsignedInt DynamicGlyphCache::pageFor(const UnsignedInt glyph) const {
+    /* The rectangle includes padding, which is inside the page as well */
+    return (*this)[glyph].second.bottom()/_pageHeight;
+}
+
+void DynamicGlyphCache::evict(const UnsignedInt page) {
+    /* Collect all glyphs on the page first, as erasing them would invalidate
+       the iterators */
+    std::vector<UnsignedInt> glyphs;
+    for(const auto& glyph: *this) {
+        const Range2Di& rectangle = glyph.second.second;
+        if(!rectangle.size().isZero() && UnsignedInt(rectangle.bottom()/_pageHeight) == page)
+            glyphs.push_back(glyph.first);
+    }
+
+    for(const UnsignedInt glyph: glyphs) erase(glyph);
+
+    _pages[page].packer.clear();
+    ++_evictionCount;
+}
+
+UnsignedInt DynamicGlyphCache::prepare(AbstractFont& font, const std::string& text) {
+    ++_currentUse;
+
+    /* Mark pages of glyphs that are already in the cache as used, collect
+       the characters that aren't */
+    std::string missing;
+    std::unordered_set<UnsignedInt> missingGlyphs;
+    for(std::size_t i = 0; i < text.size(); ) {
+        const std::size_t prev = i;
+        char32_t character;
+        std::tie(character, i) = Utility::Unicode::nextChar(text, i);
+
+        /* Skip newlines, the renderer doesn't lay them out */
+        if(character == U'\n') continue;
+
+        const UnsignedInt glyph = font.glyphId(character);
+        if(contains(glyph)) {
+            _pages[pageFor(glyph)].lastUsed = _currentUse;
+            continue;
+        }
+
+        if(missingGlyphs.insert(glyph).second)
+            missing.append(text, prev, i - prev);
+    }
+
+    /* Rasterize the missing ones, doReserve() takes care of the eviction */
+    if(!missing.empty()) font.fillGlyphCache(*this, missing);
+
+    return missingGlyphs.size();
+}
+
+std::vector<Range2Di> DynamicGlyphCache::doReserve(const std::vector<Vector2i>& sizes) {
+    /* Back up the page state so space taken by glyphs that will not get
+       inserted is freed again if not all of them fit. Evicted glyphs stay
+       evicted, though -- the space after them is just wasted until the next
+       eviction of given page. */
+    const std::vector<Page> pages = _pages;
+
+    std::vector<Range2Di> out;
+    out.reserve(sizes.size());
+    for(const Vector2i& size: sizes) {
+        /* Try to fit the glyph into any page first */
+        Containers::Optional<Range2Di> range;
+        UnsignedInt page = 0;
+        for(; page != _pages.size(); ++page)
+            if((range = _pages[page].packer.add(size))) break;
+
+        /* If it doesn't fit anywhere, evict the least recently used page that
+           isn't needed by the text being currently prepared */
+        if(!range) {
+            page = _pages.size();
+            for(UnsignedInt i = 0; i != _pages.size(); ++i) {
+                if(_pages[i].lastUsed == _currentUse) continue;
+                if(page == _pages.size() || _pages[i].lastUsed < _pages[page].lastUsed)
+                    page = i;
+            }
+
+            if(page == _pages.size()) {
+                Error() << "Text::DynamicGlyphCache::reserve(): all" << _pages.size() << "pages are used by the current text, can't fit" << sizes.size() << "more glyphs";
+                _pages = pages;
+                return {};
+            }
+
+            evict(page);
+            if(!(range = _pages[page].packer.add(size))) {
+                Error() << "Text::DynamicGlyphCache::reserve(): glyph of size" << size << "doesn't fit into a page of size" << pageSize();
+                _pages = pages;
+                return {};
+            }
+        }
+
+        _pages[page].lastUsed = _currentUse;
+        out.push_back(range->translated(Vector2i::yAxis(page*_pageHeight)));
+    }
+
+    return out;
+}
+
+}}
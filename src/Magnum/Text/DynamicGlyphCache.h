@@ -0,0 +1,149 @@
+#ifndef Magnum_Text_DynamicGlyphCache_h
+#define Magnum_Text_DynamicGlyphCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::DynamicGlyphCache
+ */
+
+#include <string>
+
+#include "Magnum/Text/GlyphCache.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Dynamic glyph cache
+
+Unlike @ref GlyphCache, which is meant to be filled with a known set of
+characters up front, this cache is filled on demand with glyphs of texts that
+are about to be rendered and evicts least recently used glyphs when full. That
+makes it suitable for large character sets such as CJK or user-generated text,
+where prerendering all possibly needed glyphs would need an enormous texture.
+
+@section Text-DynamicGlyphCache-usage Usage
+
+Before laying out or rendering a text, pass it to @ref prepare(). Glyphs that
+are not in the cache yet are rasterized using @ref AbstractFont::fillGlyphCache()
+and packed into the free space using @ref TextureTools::AtlasPacker, uploading
+only the regions of the new glyphs to the texture.
+
+@code{.cpp}
+Text::DynamicGlyphCache cache{Vector2i{1024}, 4};
+
+cache.prepare(*font, message);
+renderer.render(message);
+@endcode
+
+@section Text-DynamicGlyphCache-eviction Eviction
+
+The cache texture is divided horizontally into @ref pageCount() pages, each
+packed separately. When a new glyph doesn't fit into any page, the page that
+was least recently used by @ref prepare() is evicted --- all glyphs in it are
+removed from the cache and the page is packed again from scratch. Glyphs on
+other pages stay where they were, so only texts that used the evicted glyphs
+need to be rendered again. Each eviction increases @ref evictionCount(),
+compare it with the value from the time a text was rendered to know whether
+the text needs to be rendered again. Pages used by the current @ref prepare()
+call are never evicted, so the cache needs to be large enough to fit at
+least all glyphs of a single text.
+
+The font has to support @ref AbstractFont::fillGlyphCache(), fonts with
+@ref AbstractFont::Feature::PreparedGlyphCache can't be used with this cache.
+*/
+class MAGNUM_TEXT_EXPORT DynamicGlyphCache: public GlyphCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param internalFormat    Internal texture format
+         * @param size              Glyph cache texture size
+         * @param pageCount         Count of pages the texture is divided
+         *      into for eviction
+         * @param padding           Padding around every glyph
+         *
+         * Expects that @p pageCount is at least @cpp 1 @ce and not larger
+         * than height of @p size.
+         */
+        explicit DynamicGlyphCache(GL::TextureFormat internalFormat, const Vector2i& size, UnsignedInt pageCount, const Vector2i& padding = {});
+
+        /**
+         * @brief Constructor
+         *
+         * Sets internal texture format to red channel only, see
+         * @ref GlyphCache::GlyphCache(const Vector2i&, const Vector2i&) for
+         * more information.
+         */
+        explicit DynamicGlyphCache(const Vector2i& size, UnsignedInt pageCount, const Vector2i& padding = {});
+
+        ~DynamicGlyphCache();
+
+        /** @brief Count of pages */
+        UnsignedInt pageCount() const { return _pages.size(); }
+
+        /** @brief Size of a single page */
+        Vector2i pageSize() const { return {textureSize().x(), _pageHeight}; }
+
+        /**
+         * @brief Count of page evictions
+         *
+         * @see @ref Text-DynamicGlyphCache-eviction
+         */
+        UnsignedInt evictionCount() const { return _evictionCount; }
+
+        /**
+         * @brief Prepare glyphs for given text
+         * @param font      Font
+         * @param text      UTF-8 text
+         * @return Count of glyphs that were newly added to the cache
+         *
+         * Marks all glyphs of @p text as used and rasterizes those that are
+         * not in the cache yet using @ref AbstractFont::fillGlyphCache(),
+         * evicting least recently used pages if there's not enough space.
+         */
+        UnsignedInt prepare(AbstractFont& font, const std::string& text);
+
+    private:
+        struct Page {
+            explicit Page(const Vector2i& size, const Vector2i& padding): packer{size, padding}, lastUsed{0} {}
+
+            TextureTools::AtlasPacker packer;
+            UnsignedInt lastUsed;
+        };
+
+        std::vector<Range2Di> doReserve(const std::vector<Vector2i>& sizes) override;
+
+        void MAGNUM_TEXT_LOCAL createPages(UnsignedInt pageCount);
+        UnsignedInt MAGNUM_TEXT_LOCAL pageFor(UnsignedInt glyph) const;
+        void MAGNUM_TEXT_LOCAL evict(UnsignedInt page);
+
+        Int _pageHeight;
+        UnsignedInt _currentUse, _evictionCount;
+        std::vector<Page> _pages;
+};
+
+}}
+
+#endif
@@ -29,19 +29,23 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/TextureFormat.h"
-#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
+namespace {
+    /* Glyph IDs below this value are looked up in a dense array */
+    constexpr UnsignedInt DenseLookupLimit = 65536;
+}
+
 GlyphCache::GlyphCache(const GL::TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): GlyphCache{internalFormat, size, size, padding} {}
 
-GlyphCache::GlyphCache(const GL::TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const GL::TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _packer{originalSize, padding} {
     initialize(internalFormat, size);
 }
 
 GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): GlyphCache{size, size, padding} {}
 
-GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _packer{originalSize, padding} {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::texture_rg);
     #endif
@@ -55,6 +59,11 @@ GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const
     initialize(internalFormat, size);
 }
 
+GlyphCache::GlyphCache(NoCreateT, const Vector2i& size, const Vector2i& padding): _size(size), _padding(padding), _texture{NoCreate}, _packer{size, padding} {
+    /* Default "Not Found" glyph */
+    _lookup.push_back(&glyphs.insert({0, {}}).first->second);
+}
+
 GlyphCache::~GlyphCache() = default;
 
 void GlyphCache::initialize(const GL::TextureFormat internalFormat, const Vector2i& size) {
@@ -65,14 +74,16 @@ void GlyphCache::initialize(const GL::TextureFormat internalFormat, const Vector
         .setStorage(1, internalFormat, size);
 
     /* Default "Not Found" glyph */
-    glyphs.insert({0, {}});
+    _lookup.push_back(&glyphs.insert({0, {}}).first->second);
 }
 
-std::vector<Range2Di> GlyphCache::reserve(const std::vector<Vector2i>& sizes) {
-    CORRADE_ASSERT((glyphs.size() == 1 && glyphs.at(0) == std::pair<Vector2i, Range2Di>()),
-        "Text::GlyphCache::reserve(): reserving space in non-empty cache is not yet implemented", {});
+std::vector<Range2Di> GlyphCache::doReserve(const std::vector<Vector2i>& sizes) {
     glyphs.reserve(glyphs.size() + sizes.size());
-    return TextureTools::atlas(_size, sizes, _padding);
+    std::vector<Range2Di> out = _packer.add(sizes);
+    if(out.empty() && !sizes.empty())
+        Error() << "Text::GlyphCache::reserve(): cache of size" << _size
+                << "is too small to fit" << sizes.size() << "more glyphs";
+    return out;
 }
 
 void GlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle) {
@@ -82,7 +93,24 @@ void GlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const
     if(glyph == 0) glyphs[0] = glyphData;
 
     /* Inserting new glyph */
-    else CORRADE_INTERNAL_ASSERT_OUTPUT(glyphs.insert({glyph, glyphData}).second);
+    else {
+        const auto inserted = glyphs.insert({glyph, glyphData});
+        CORRADE_INTERNAL_ASSERT(inserted.second);
+
+        /* Make it available in the dense lookup, filling the gap before it
+           with the "Not Found" glyph */
+        if(glyph < DenseLookupLimit) {
+            if(glyph >= _lookup.size()) _lookup.resize(glyph + 1, _lookup[0]);
+            _lookup[glyph] = &inserted.first->second;
+        }
+    }
+}
+
+void GlyphCache::erase(const UnsignedInt glyph) {
+    /* The "Not Found" glyph is reset to the default instead */
+    if(glyph == 0) glyphs[0] = {};
+    else if(glyphs.erase(glyph) && glyph < _lookup.size())
+        _lookup[glyph] = _lookup[0];
 }
 
 void GlyphCache::setImage(const Vector2i& offset, const ImageView2D& image) {
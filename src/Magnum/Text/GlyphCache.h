@@ -35,6 +35,7 @@
 #include "Magnum/Math/Range.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/Text/visibility.h"
+#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
@@ -50,7 +51,8 @@ Create GlyphCache object with sufficient size and then call
 
 @snippet MagnumText.cpp GlyphCache-usage
 
-See @ref Renderer for information about text rendering.
+See @ref Renderer for information about text rendering. For caches that are
+filled on demand and evict unused glyphs when full see @ref DynamicGlyphCache.
 @todo Some way for Font to negotiate or check internal texture format
 @todo Default glyph 0 with rect 0 0 0 0 will result in negative dimensions when
     nonzero padding is removed
@@ -128,9 +130,14 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          * If no glyph is found, glyph @cpp 0 @ce is returned, which is by
          * default on zero position and has zero region in texture atlas. You
          * can reset it to some meaningful value in @ref insert().
+         *
+         * Glyphs with IDs smaller than @cpp 65536 @ce (which covers all glyph
+         * IDs in TrueType and OpenType fonts) are looked up directly in a
+         * dense array, other IDs go through a hash map.
          * @see @ref padding()
          */
         std::pair<Vector2i, Range2Di> operator[](UnsignedInt glyph) const {
+            if(glyph < _lookup.size()) return *_lookup[glyph];
             auto it = glyphs.find(glyph);
             return it == glyphs.end() ? glyphs.at(0) : it->second;
         }
@@ -149,17 +156,20 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          * @brief Layout glyphs with given sizes to the cache
          *
          * Returns non-overlapping regions in cache texture to store glyphs.
-         * The reserved space is reused on next call to @ref reserve() if no
-         * glyph was stored there, use @ref insert() to store actual glyph on
-         * given position and @ref setImage() to upload glyph image.
-         *
-         * Glyph @p sizes are expected to be without padding.
+         * The regions are packed using @ref TextureTools::AtlasPacker into
+         * the space not used by previous calls, so it's possible to add more
+         * glyphs to an already filled cache. Use @ref insert() to store
+         * actual glyph on given position and @ref setImage() to upload glyph
+         * image.
          *
-         * @attention Cache size must be large enough to contain all rendered
-         *      glyphs.
+         * Glyph @p sizes are expected to be without padding. If the glyphs
+         * don't fit into the remaining space, a message is printed to error
+         * output and an empty vector is returned.
          * @see @ref padding()
          */
-        std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes);
+        std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes) {
+            return doReserve(sizes);
+        }
 
         /**
          * @brief Insert glyph to cache
@@ -186,13 +196,37 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          */
         virtual void setImage(const Vector2i& offset, const ImageView2D& image);
 
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    protected:
+    #else
     private:
+    #endif
+        /* Used by GlyphCacheArray layers, doesn't create the texture */
+        explicit GlyphCache(NoCreateT, const Vector2i& size, const Vector2i& padding);
+
+        /* Used by DynamicGlyphCache */
+        bool contains(UnsignedInt glyph) const {
+            return glyphs.find(glyph) != glyphs.end();
+        }
+        void erase(UnsignedInt glyph);
+
+    private:
+        /** @brief Implementation for @ref reserve() */
+        virtual std::vector<Range2Di> doReserve(const std::vector<Vector2i>& sizes);
+
         void MAGNUM_LOCAL initialize(GL::TextureFormat internalFormat, const Vector2i& size);
 
         Vector2i _size, _padding;
         GL::Texture2D _texture;
+        TextureTools::AtlasPacker _packer;
 
         std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>> glyphs;
+
+        /* Pointers to values in the above map for small glyph IDs, pointing
+           to the "Not Found" glyph for IDs that are not in the cache. Values
+           in an unordered map are never moved, so the pointers stay valid
+           until the glyph is erased. */
+        std::vector<const std::pair<Vector2i, Range2Di>*> _lookup;
 };
 
 }}
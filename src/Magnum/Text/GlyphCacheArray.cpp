@@ -0,0 +1,90 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GlyphCacheArray.h"
+
+#include "Magnum/ImageView.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/TextureFormat.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+
+/* A layer doesn't have its own texture, images are uploaded into given layer
+   of the shared array texture instead */
+class GlyphCacheLayer: public GlyphCache {
+    public:
+        explicit GlyphCacheLayer(GL::Texture2DArray& texture, Int layer, const Vector2i& size, const Vector2i& padding): GlyphCache{NoCreate, size, padding}, _texture(texture), _layer{layer} {}
+
+        void setImage(const Vector2i& offset, const ImageView2D& image) override {
+            _texture.setSubImage(0, {offset, _layer}, ImageView3D{image.storage(), image.format(), image.formatExtra(), image.pixelSize(), {image.size(), 1}, image.data()});
+        }
+
+    private:
+        GL::Texture2DArray& _texture;
+        Int _layer;
+};
+
+GL::TextureFormat singleChannelFormat() {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::texture_rg);
+    #endif
+    return GL::TextureFormat::R8;
+}
+
+}
+
+GlyphCacheArray::GlyphCacheArray(const GL::TextureFormat internalFormat, const Vector2i& size, const Int layerCount, const Vector2i& padding): _size{size}, _padding{padding} {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::EXT::texture_array);
+    #endif
+
+    _texture.setWrapping(GL::SamplerWrapping::ClampToEdge)
+        .setMinificationFilter(GL::SamplerFilter::Linear)
+        .setMagnificationFilter(GL::SamplerFilter::Linear)
+        .setStorage(1, internalFormat, {size, layerCount});
+
+    _layers.reserve(layerCount);
+    for(Int i = 0; i != layerCount; ++i)
+        _layers.emplace_back(new GlyphCacheLayer{_texture, i, size, padding});
+}
+
+GlyphCacheArray::GlyphCacheArray(const Vector2i& size, const Int layerCount, const Vector2i& padding): GlyphCacheArray{singleChannelFormat(), size, layerCount, padding} {}
+
+GlyphCacheArray::~GlyphCacheArray() = default;
+
+GlyphCache& GlyphCacheArray::layer(const Int id) {
+    return const_cast<GlyphCache&>(const_cast<const GlyphCacheArray&>(*this).layer(id));
+}
+
+const GlyphCache& GlyphCacheArray::layer(const Int id) const {
+    CORRADE_ASSERT(std::size_t(id) < _layers.size(),
+        "Text::GlyphCacheArray::layer(): index" << id << "out of range for" << _layers.size() << "layers", *_layers[0]);
+    return *_layers[id];
+}
+
+}}
@@ -0,0 +1,148 @@
+#ifndef Magnum_Text_GlyphCacheArray_h
+#define Magnum_Text_GlyphCacheArray_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::GlyphCacheArray
+ */
+
+#include "Magnum/configure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <memory>
+#include <vector>
+
+#include "Magnum/GL/TextureArray.h"
+#include "Magnum/Text/GlyphCache.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Glyph cache array
+
+Contains glyphs of many fonts or font sizes prerendered into layers of a
+single @ref GL::Texture2DArray. Each layer is a separate @ref GlyphCache with
+its own atlas packing, so each can be filled by a different font using
+@ref AbstractFont::fillGlyphCache() or used to host overflow glyphs of a font
+that doesn't fit into a single layer. As all layers share the same texture,
+texts in all fonts can then be rendered with a single draw call.
+
+@section Text-GlyphCacheArray-usage Usage
+
+Fill each layer with glyphs of given font, then add texts to a
+@ref BatchRenderer constructed from the array, specifying the layer for each
+text. The renderer puts the layer index into the third texture coordinate
+component, render its mesh using a @ref Shaders::Vector or
+@ref Shaders::DistanceFieldVector shader with
+@ref Shaders::AbstractVector::Flag::TextureArrays enabled:
+
+@code{.cpp}
+Text::GlyphCacheArray cache{Vector2i{512}, 2};
+sansFont->fillGlyphCache(cache.layer(0), "abcdefghijklmnopqrstuvwxyz");
+monoFont->fillGlyphCache(cache.layer(1), "0123456789");
+
+Text::BatchRenderer2D renderer{cache};
+renderer.add(*sansFont, 0, 0.1f, "Score:", Matrix3::translation({-0.5f, 0.0f}));
+renderer.add(*monoFont, 1, 0.1f, "1337", Matrix3::translation({0.5f, 0.0f}));
+renderer.update();
+
+Shaders::Vector2D shader{Shaders::Vector2D::Flag::TextureArrays};
+shader.bindVectorTexture(cache.texture());
+renderer.mesh().draw(shader);
+@endcode
+
+The @ref GlyphCache::texture() of each layer is not created, use
+@ref texture() instead. Fonts with @ref AbstractFont::Feature::PreparedGlyphCache
+can be used as well, as they upload the image through
+@ref GlyphCache::setImage().
+@requires_gl30 Extension @gl_extension{EXT,texture_array}
+@requires_gles30 Texture arrays are not available in OpenGL ES 2.0.
+@requires_webgl20 Texture arrays are not available in WebGL 1.0.
+*/
+class MAGNUM_TEXT_EXPORT GlyphCacheArray {
+    public:
+        /**
+         * @brief Constructor
+         * @param internalFormat    Internal texture format
+         * @param size              Size of each layer
+         * @param layerCount        Layer count
+         * @param padding           Padding around every glyph
+         */
+        explicit GlyphCacheArray(GL::TextureFormat internalFormat, const Vector2i& size, Int layerCount, const Vector2i& padding = {});
+
+        /**
+         * @brief Constructor
+         *
+         * Sets internal texture format to @ref GL::TextureFormat::R8. On
+         * desktop OpenGL requires @gl_extension{ARB,texture_rg} (also part of
+         * OpenGL ES 3.0 and WebGL 2).
+         */
+        explicit GlyphCacheArray(const Vector2i& size, Int layerCount, const Vector2i& padding = {});
+
+        /** @brief Copying is not allowed */
+        GlyphCacheArray(const GlyphCacheArray&) = delete;
+
+        ~GlyphCacheArray();
+
+        /** @brief Copying is not allowed */
+        GlyphCacheArray& operator=(const GlyphCacheArray&) = delete;
+
+        /** @brief Size of each layer */
+        Vector2i textureSize() const { return _size; }
+
+        /** @brief Layer count */
+        Int layerCount() const { return _layers.size(); }
+
+        /** @brief Glyph padding */
+        Vector2i padding() const { return _padding; }
+
+        /** @brief Cache texture */
+        GL::Texture2DArray& texture() { return _texture; }
+
+        /**
+         * @brief Glyph cache layer
+         *
+         * Expects that @p id is less than @ref layerCount(). The returned
+         * cache can be filled and used for layouting the same way as
+         * a standalone @ref GlyphCache, with images passed to
+         * @ref GlyphCache::setImage() uploaded into given layer of
+         * @ref texture().
+         */
+        GlyphCache& layer(Int id);
+        const GlyphCache& layer(Int id) const; /**< @overload */
+
+    private:
+        Vector2i _size, _padding;
+        GL::Texture2DArray _texture;
+        std::vector<std::unique_ptr<GlyphCache>> _layers;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -25,15 +25,25 @@
 
 #include "Renderer.h"
 
+#include <algorithm>
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 
+#include "Magnum/Instrumentation.h"
 #include "Magnum/Mesh.h"
+#include "Magnum/ScratchArena.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Mesh.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shaders/AbstractVector.h"
 #include "Magnum/Text/AbstractFont.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Text/GlyphCacheArray.h"
+#endif
+#include "Magnum/Text/ShapingCache.h"
 
 namespace Magnum { namespace Text {
 
@@ -63,113 +73,35 @@ struct Vertex {
     Vector2 position, textureCoordinates;
 };
 
+/* Temporary storage for glyph positions and texture coordinates. Taken from
+   the current scratch arena if there's one, otherwise the passed storage is
+   reused and enlarged only if the text doesn't fit. */
+std::pair<Containers::ArrayView<Vector2>, Containers::ArrayView<Vector2>> glyphScratch(const std::size_t size, Containers::Array<Vector2>& positions, Containers::Array<Vector2>& textureCoordinates) {
+    if(ScratchArena* const arena = ScratchArena::current())
+        return {arena->allocate<Vector2>(size), arena->allocate<Vector2>(size)};
+
+    if(positions.size() < size) {
+        positions = Containers::Array<Vector2>{Containers::NoInit, size};
+        textureCoordinates = Containers::Array<Vector2>{Containers::NoInit, size};
+    }
+    return {positions.prefix(size), textureCoordinates.prefix(size)};
+}
+
 std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
     /* Output data, reserve memory as when the text would be ASCII-only. In
        reality the actual vertex count will be smaller, but allocating more at
        once is better than reallocating many times later. */
-    std::vector<Vertex> vertices;
-    vertices.reserve(text.size()*4);
-
-    /* Total rendered bounds, intial line position, line increment, last+1
-       vertex on previous line */
+    Containers::Array<Vector2> positionStorage, textureCoordinateStorage;
+    Containers::ArrayView<Vector2> positions, textureCoordinates;
+    std::tie(positions, textureCoordinates) = glyphScratch(text.size()*4, positionStorage, textureCoordinateStorage);
+    UnsignedInt glyphCount;
     Range2D rectangle;
-    Vector2 linePosition;
-    const Vector2 lineAdvance = Vector2::yAxis(font.lineHeight()*size/font.size());
-    std::size_t lastLineLastVertex = 0;
-
-    /* Temp buffer so we don't allocate for each new line */
-    /**
-     * @todo C++1z: use std::string_view to avoid the one allocation and all
-     *      the copying altogether
-     */
-    std::string line;
-    line.reserve(text.size());
-
-    /* Render each line separately and align it horizontally */
-    std::size_t pos, prevPos = 0;
-    do {
-        /* Empty line, nothing to do (the rest is done below in while expression) */
-        if((pos = text.find('\n', prevPos)) == prevPos) continue;
-
-        /* Copy the line into the temp buffer */
-        line.assign(text, prevPos, pos-prevPos);
-
-        /* Layout the line */
-        const auto layouter = font.layout(cache, size, line);
-
-        /* Verify that we don't reallocate anything. The only problem might
-           arise when the layouter decides to compose one character from more
-           than one glyph (i.e. accents). Will remove the assert when this
-           issue arises. */
-        CORRADE_INTERNAL_ASSERT(vertices.size() + layouter->glyphCount()*4 <= vertices.capacity());
-
-        /* Bounds of rendered line */
-        Range2D lineRectangle;
-
-        /* Render all glyphs */
-        Vector2 cursorPosition(linePosition);
-        for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
-            Range2D quadPosition, textureCoordinates;
-            std::tie(quadPosition, textureCoordinates) = layouter->renderGlyph(i, cursorPosition, lineRectangle);
-
-            /* 0---2
-               |   |
-               |   |
-               |   |
-               1---3 */
-
-            vertices.insert(vertices.end(), {
-                {quadPosition.topLeft(), textureCoordinates.topLeft()},
-                {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()},
-                {quadPosition.topRight(), textureCoordinates.topRight()},
-                {quadPosition.bottomRight(), textureCoordinates.bottomRight()}
-            });
-        }
-
-        /** @todo What about top-down text? */
-
-        /* Horizontally align the rendered line */
-        Float alignmentOffsetX = 0.0f;
-        if((UnsignedByte(alignment) & Implementation::AlignmentHorizontal) == Implementation::AlignmentCenter)
-            alignmentOffsetX = -lineRectangle.centerX();
-        else if((UnsignedByte(alignment) & Implementation::AlignmentHorizontal) == Implementation::AlignmentRight)
-            alignmentOffsetX = -lineRectangle.right();
-
-        /* Integer alignment */
-        if(UnsignedByte(alignment) & Implementation::AlignmentIntegral)
-            alignmentOffsetX = Math::round(alignmentOffsetX);
-
-        /* Align positions and bounds on current line */
-        lineRectangle = lineRectangle.translated(Vector2::xAxis(alignmentOffsetX));
-        for(auto it = vertices.begin()+lastLineLastVertex; it != vertices.end(); ++it)
-            it->position.x() += alignmentOffsetX;
-
-        /* Add final line bounds to total bounds, similarly to AbstractFont::renderGlyph() */
-        if(!rectangle.size().isZero()) {
-            rectangle.bottomLeft() = Math::min(rectangle.bottomLeft(), lineRectangle.bottomLeft());
-            rectangle.topRight() = Math::max(rectangle.topRight(), lineRectangle.topRight());
-        } else rectangle = lineRectangle;
-
-    /* Move to next line */
-    } while(prevPos = pos+1,
-            linePosition -= lineAdvance,
-            lastLineLastVertex = vertices.size(),
-            pos != std::string::npos);
-
-    /* Vertically align the rendered text */
-    Float alignmentOffsetY = 0.0f;
-    if((UnsignedByte(alignment) & Implementation::AlignmentVertical) == Implementation::AlignmentMiddle)
-        alignmentOffsetY = -rectangle.centerY();
-    else if((UnsignedByte(alignment) & Implementation::AlignmentVertical) == Implementation::AlignmentTop)
-        alignmentOffsetY = -rectangle.top();
-
-    /* Integer alignment */
-    if(UnsignedByte(alignment) & Implementation::AlignmentIntegral)
-        alignmentOffsetY = Math::round(alignmentOffsetY);
+    std::tie(glyphCount, rectangle) = AbstractRenderer::renderInto(font, cache, size, {text.data(), text.size()}, positions, textureCoordinates, nullptr, alignment);
 
-    /* Align positions and bounds */
-    rectangle = rectangle.translated(Vector2::yAxis(alignmentOffsetY));
-    for(auto& v: vertices) v.position.y() += alignmentOffsetY;
+    /* Interleave the vertices */
+    std::vector<Vertex> vertices(glyphCount*4);
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        vertices[i] = {positions[i], textureCoordinates[i]};
 
     return std::make_tuple(std::move(vertices), rectangle);
 }
@@ -223,29 +155,148 @@ std::tuple<GL::Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCach
     return std::make_tuple(std::move(mesh), rectangle);
 }
 
+inline Vector2 transformPosition(const Matrix3& transformation, const Vector2& position) {
+    return transformation.transformPoint(position);
+}
+
+inline Vector3 transformPosition(const Matrix4& transformation, const Vector2& position) {
+    return transformation.transformPoint({position, 0.0f});
+}
+
 }
 
 std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment) {
-    /* Render vertices */
-    std::vector<Vertex> vertices;
+    /* Reserve memory as when the text would be ASCII-only and shrink it to
+       actual size afterwards */
+    std::vector<Vector2> positions(text.size()*4), textureCoordinates(text.size()*4);
+    std::vector<UnsignedInt> indices(text.size()*6);
+    UnsignedInt glyphCount;
     Range2D rectangle;
-    std::tie(vertices, rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
+    std::tie(glyphCount, rectangle) = renderInto(font, cache, size, {text.data(), text.size()}, {positions.data(), positions.size()}, {textureCoordinates.data(), textureCoordinates.size()}, {indices.data(), indices.size()}, alignment);
+    positions.resize(glyphCount*4);
+    textureCoordinates.resize(glyphCount*4);
+    indices.resize(glyphCount*6);
+
+    return std::make_tuple(std::move(positions), std::move(textureCoordinates), std::move(indices), rectangle);
+}
 
-    /* Deinterleave the vertices */
-    std::vector<Vector2> positions, textureCoordinates;
-    positions.reserve(vertices.size());
-    positions.reserve(textureCoordinates.size());
-    for(const auto& v: vertices) {
-        positions.push_back(v.position);
-        textureCoordinates.push_back(v.textureCoordinates);
+std::pair<UnsignedInt, Range2D> AbstractRenderer::renderInto(AbstractFont& font, const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::ArrayView<Vector2> positions, const Containers::ArrayView<Vector2> textureCoordinates, const Containers::ArrayView<UnsignedInt> indices, const Alignment alignment, ShapingCache* const shapingCache) {
+    CORRADE_ASSERT(positions.size() == textureCoordinates.size(),
+        "Text::AbstractRenderer::renderInto(): expected positions and texture coordinates of the same size but got" << positions.size() << "and" << textureCoordinates.size(), {});
+    CORRADE_ASSERT(positions.size() >= text.size()*4,
+        "Text::AbstractRenderer::renderInto(): expected at least" << text.size()*4 << "vertices but got" << positions.size(), {});
+    CORRADE_ASSERT(indices.empty() || indices.size() >= text.size()*6,
+        "Text::AbstractRenderer::renderInto(): expected at least" << text.size()*6 << "indices but got" << indices.size(), {});
+
+    /* Total rendered bounds, intial line position, line increment */
+    Range2D rectangle;
+    Vector2 linePosition;
+    const Vector2 lineAdvance = Vector2::yAxis(font.lineHeight()*size/font.size());
+    const std::size_t glyphCapacity = positions.size()/4;
+    UnsignedInt glyphCount = 0;
+
+    /* Render each line separately and align it horizontally */
+    for(std::size_t pos, prevPos = 0; ; prevPos = pos + 1, linePosition -= lineAdvance) {
+        /* Find end of the line, empty lines have nothing to render */
+        for(pos = prevPos; pos != text.size() && text[pos] != '\n'; ++pos);
+        if(pos != prevPos) {
+            /* Layout the line directly into the output to avoid a temporary
+               allocation. There's room for four vertices for each glyph, the
+               quad position goes into the first two positions, advance into
+               the third position and texture coordinates into the first two
+               texture coordinates. */
+            const Containers::StridedArrayView<Range2D> lineQuadPositions{reinterpret_cast<Range2D*>(positions.data() + glyphCount*4), glyphCapacity - glyphCount, 4*sizeof(Vector2)};
+            const Containers::StridedArrayView<Range2D> lineTextureCoordinates{reinterpret_cast<Range2D*>(textureCoordinates.data() + glyphCount*4), glyphCapacity - glyphCount, 4*sizeof(Vector2)};
+            const Containers::StridedArrayView<Vector2> lineAdvances{positions.data() + glyphCount*4 + 2, glyphCapacity - glyphCount, 4*sizeof(Vector2)};
+            const UnsignedInt lineGlyphCount = shapingCache ?
+                shapingCache->layoutInto(font, cache, size, text.slice(prevPos, pos), lineQuadPositions, lineTextureCoordinates, lineAdvances) :
+                font.layoutInto(cache, size, text.slice(prevPos, pos), lineQuadPositions, lineTextureCoordinates, lineAdvances);
+            const std::size_t lineFirstVertex = glyphCount*4;
+            const std::size_t lineLastVertex = (glyphCount + lineGlyphCount)*4;
+
+            /* Bounds of rendered line */
+            Range2D lineRectangle;
+
+            /* Render all glyphs, similarly to AbstractLayouter::renderGlyph() */
+            Vector2 cursorPosition(linePosition);
+            for(std::size_t i = lineFirstVertex; i != lineLastVertex; i += 4) {
+                const Range2D quadPosition = reinterpret_cast<const Range2D&>(positions[i]).translated(cursorPosition);
+                const Range2D textureCoordinate = reinterpret_cast<const Range2D&>(textureCoordinates[i]);
+                cursorPosition += positions[i + 2];
+
+                /* Extend line bounds with current quad bounds. If zero size,
+                   replace it. */
+                if(!lineRectangle.size().isZero()) {
+                    lineRectangle.bottomLeft() = Math::min(lineRectangle.bottomLeft(), quadPosition.bottomLeft());
+                    lineRectangle.topRight() = Math::max(lineRectangle.topRight(), quadPosition.topRight());
+                } else lineRectangle = quadPosition;
+
+                /* 0---2
+                   |   |
+                   |   |
+                   |   |
+                   1---3 */
+
+                positions[i] = quadPosition.topLeft();
+                positions[i + 1] = quadPosition.bottomLeft();
+                positions[i + 2] = quadPosition.topRight();
+                positions[i + 3] = quadPosition.bottomRight();
+                textureCoordinates[i] = textureCoordinate.topLeft();
+                textureCoordinates[i + 1] = textureCoordinate.bottomLeft();
+                textureCoordinates[i + 2] = textureCoordinate.topRight();
+                textureCoordinates[i + 3] = textureCoordinate.bottomRight();
+            }
+
+            /** @todo What about top-down text? */
+
+            /* Horizontally align the rendered line */
+            Float alignmentOffsetX = 0.0f;
+            if((UnsignedByte(alignment) & Implementation::AlignmentHorizontal) == Implementation::AlignmentCenter)
+                alignmentOffsetX = -lineRectangle.centerX();
+            else if((UnsignedByte(alignment) & Implementation::AlignmentHorizontal) == Implementation::AlignmentRight)
+                alignmentOffsetX = -lineRectangle.right();
+
+            /* Integer alignment */
+            if(UnsignedByte(alignment) & Implementation::AlignmentIntegral)
+                alignmentOffsetX = Math::round(alignmentOffsetX);
+
+            /* Align positions and bounds on current line */
+            lineRectangle = lineRectangle.translated(Vector2::xAxis(alignmentOffsetX));
+            for(std::size_t i = lineFirstVertex; i != lineLastVertex; ++i)
+                positions[i].x() += alignmentOffsetX;
+
+            /* Add final line bounds to total bounds, similarly to AbstractLayouter::renderGlyph() */
+            if(!rectangle.size().isZero()) {
+                rectangle.bottomLeft() = Math::min(rectangle.bottomLeft(), lineRectangle.bottomLeft());
+                rectangle.topRight() = Math::max(rectangle.topRight(), lineRectangle.topRight());
+            } else rectangle = lineRectangle;
+
+            glyphCount += lineGlyphCount;
+        }
+
+        if(pos == text.size()) break;
     }
 
-    /* Render indices */
-    const UnsignedInt glyphCount = vertices.size()/4;
-    std::vector<UnsignedInt> indices(glyphCount*6);
-    createIndices<UnsignedInt>(indices.data(), glyphCount);
+    /* Vertically align the rendered text */
+    Float alignmentOffsetY = 0.0f;
+    if((UnsignedByte(alignment) & Implementation::AlignmentVertical) == Implementation::AlignmentMiddle)
+        alignmentOffsetY = -rectangle.centerY();
+    else if((UnsignedByte(alignment) & Implementation::AlignmentVertical) == Implementation::AlignmentTop)
+        alignmentOffsetY = -rectangle.top();
 
-    return std::make_tuple(std::move(positions), std::move(textureCoordinates), std::move(indices), rectangle);
+    /* Integer alignment */
+    if(UnsignedByte(alignment) & Implementation::AlignmentIntegral)
+        alignmentOffsetY = Math::round(alignmentOffsetY);
+
+    /* Align positions and bounds */
+    rectangle = rectangle.translated(Vector2::yAxis(alignmentOffsetY));
+    for(std::size_t i = 0, end = glyphCount*4; i != end; ++i)
+        positions[i].y() += alignmentOffsetY;
+
+    /* Render indices, if requested */
+    if(!indices.empty()) createIndices<UnsignedInt>(indices.data(), glyphCount);
+
+    return {glyphCount, rectangle};
 }
 
 template<UnsignedInt dimensions> std::tuple<GL::Mesh, Range2D> Renderer<dimensions>::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, GL::Buffer& vertexBuffer, GL::Buffer& indexBuffer, GL::BufferUsage usage, Alignment alignment) {
@@ -263,39 +314,44 @@ template<UnsignedInt dimensions> std::tuple<GL::Mesh, Range2D> Renderer<dimensio
 AbstractRenderer::BufferMapImplementation AbstractRenderer::bufferMapImplementation = &AbstractRenderer::bufferMapImplementationFull;
 AbstractRenderer::BufferUnmapImplementation AbstractRenderer::bufferUnmapImplementation = &AbstractRenderer::bufferUnmapImplementationDefault;
 
-void* AbstractRenderer::bufferMapImplementationFull(GL::Buffer& buffer, GLsizeiptr) {
-    return buffer.map(GL::Buffer::MapAccess::WriteOnly);
+void* AbstractRenderer::bufferMapImplementationFull(GL::Buffer& buffer, const GLintptr offset, GLsizeiptr) {
+    /* The whole buffer is mapped without invalidation, so the data outside
+       of the range are preserved */
+    char* const data = static_cast<char*>(buffer.map(GL::Buffer::MapAccess::WriteOnly));
+    return data ? data + offset : nullptr;
 }
 #endif
 
 #if !defined(MAGNUM_TARGET_GLES2) || defined(CORRADE_TARGET_EMSCRIPTEN)
-inline void* AbstractRenderer::bufferMapImplementation(GL::Buffer& buffer, GLsizeiptr length)
+inline void* AbstractRenderer::bufferMapImplementation(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr length)
 #else
-void* AbstractRenderer::bufferMapImplementationRange(GL::Buffer& buffer, GLsizeiptr length)
+void* AbstractRenderer::bufferMapImplementationRange(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr length)
 #endif
 {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
-    return buffer.map(0, length, GL::Buffer::MapFlag::InvalidateBuffer|GL::Buffer::MapFlag::Write);
+    return buffer.map(offset, length, GL::Buffer::MapFlag::InvalidateRange|GL::Buffer::MapFlag::Write);
     #else
     static_cast<void>(length);
-    return &buffer == &_indexBuffer ? _indexBufferData : _vertexBufferData;
+    return (&buffer == &_indexBuffer ? _indexBufferData : _vertexBufferData) + offset;
     #endif
 }
 
 #if !defined(MAGNUM_TARGET_GLES2) || defined(CORRADE_TARGET_EMSCRIPTEN)
-inline void AbstractRenderer::bufferUnmapImplementation(GL::Buffer& buffer)
+inline void AbstractRenderer::bufferUnmapImplementation(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr length)
 #else
-void AbstractRenderer::bufferUnmapImplementationDefault(GL::Buffer& buffer)
+void AbstractRenderer::bufferUnmapImplementationDefault(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr length)
 #endif
 {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
+    static_cast<void>(offset);
+    static_cast<void>(length);
     buffer.unmap();
     #else
-    buffer.setSubData(0, &buffer == &_indexBuffer ? _indexBufferData : _vertexBufferData);
+    buffer.setSubData(offset, (&buffer == &_indexBuffer ? _indexBufferData : _vertexBufferData).slice(offset, offset + length));
     #endif
 }
 
-AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{GL::Buffer::TargetHint::Array}, _indexBuffer{GL::Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _capacity(0) {
+AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{GL::Buffer::TargetHint::Array}, _indexBuffer{GL::Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _shapingCache(nullptr), _capacity(0), _uploadedGlyphCount(0) {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::map_buffer_range);
     #elif defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
@@ -334,6 +390,12 @@ void AbstractRenderer::reserve(const uint32_t glyphCount, const GL::BufferUsage
     #endif
     _mesh.setCount(0);
 
+    /* The buffer contents are now undefined, everything needs to be uploaded
+       again on next render() */
+    _uploadedPositions = Containers::Array<Vector2>{Containers::NoInit, vertexCount};
+    _uploadedTextureCoordinates = Containers::Array<Vector2>{Containers::NoInit, vertexCount};
+    _uploadedGlyphCount = 0;
+
     /* Render indices */
     Containers::Array<char> indexData;
     MeshIndexType indexType;
@@ -348,40 +410,190 @@ void AbstractRenderer::reserve(const uint32_t glyphCount, const GL::BufferUsage
         .setIndexBuffer(_indexBuffer, 0, indexType, 0, vertexCount);
 
     /* Prefill index buffer */
-    char* const indices = static_cast<char*>(bufferMapImplementation(_indexBuffer, indexData.size()));
+    char* const indices = static_cast<char*>(bufferMapImplementation(_indexBuffer, 0, indexData.size()));
     CORRADE_INTERNAL_ASSERT(indices);
     /** @todo Emscripten: it can be done without this copying altogether */
     std::copy(indexData.begin(), indexData.end(), indices);
-    bufferUnmapImplementation(_indexBuffer);
+    bufferUnmapImplementation(_indexBuffer, 0, indexData.size());
 }
 
 void AbstractRenderer::render(const std::string& text) {
+    MAGNUM_INSTRUMENTATION_SCOPE("Text::Renderer::render()");
+
+    /* Take the scratch storage from the current arena or reuse it from
+       previous calls */
+    Containers::ArrayView<Vector2> positions, textureCoordinates;
+    std::tie(positions, textureCoordinates) = glyphScratch(text.size()*4, _positionScratch, _textureCoordinateScratch);
+
     /* Render vertex data */
-    std::vector<Vertex> vertexData;
-    _rectangle = {};
-    std::tie(vertexData, _rectangle) = renderVerticesInternal(font, cache, size, text, _alignment);
+    UnsignedInt glyphCount;
+    std::tie(glyphCount, _rectangle) = renderInto(font, cache, size, {text.data(), text.size()}, positions, textureCoordinates, nullptr, _alignment, _shapingCache);
 
-    const UnsignedInt glyphCount = vertexData.size()/4;
-    const UnsignedInt vertexCount = glyphCount*4;
     const UnsignedInt indexCount = glyphCount*6;
 
     CORRADE_ASSERT(glyphCount <= _capacity,
         "Text::Renderer::render(): capacity" << _capacity << "too small to render" << glyphCount << "glyphs", );
 
-    /* Interleave the data into mapped buffer*/
-    Containers::ArrayView<Vertex> vertices(static_cast<Vertex*>(bufferMapImplementation(_vertexBuffer,
-        vertexCount*sizeof(Vertex))), vertexCount);
-    CORRADE_INTERNAL_ASSERT_OUTPUT(vertices);
-    std::copy(vertexData.begin(), vertexData.end(), vertices.begin());
-    bufferUnmapImplementation(_vertexBuffer);
+    /* Find the range of glyphs that differ from what's already in the
+       buffer. Glyphs past the previously uploaded count are always dirty. */
+    UnsignedInt dirtyBegin = glyphCount, dirtyEnd = 0;
+    for(UnsignedInt i = 0; i != glyphCount; ++i) {
+        const std::size_t first = i*4;
+        if(i < _uploadedGlyphCount &&
+           std::memcmp(_uploadedPositions.data() + first, positions.data() + first, 4*sizeof(Vector2)) == 0 &&
+           std::memcmp(_uploadedTextureCoordinates.data() + first, textureCoordinates.data() + first, 4*sizeof(Vector2)) == 0)
+            continue;
+
+        std::copy_n(positions.data() + first, 4, _uploadedPositions.data() + first);
+        std::copy_n(textureCoordinates.data() + first, 4, _uploadedTextureCoordinates.data() + first);
+        dirtyBegin = Math::min(dirtyBegin, i);
+        dirtyEnd = i + 1;
+    }
+
+    /* Interleave the changed range into mapped buffer */
+    if(dirtyBegin < dirtyEnd) {
+        const std::size_t vertexBegin = dirtyBegin*4;
+        const std::size_t dirtyVertexCount = (dirtyEnd - dirtyBegin)*4;
+        Containers::ArrayView<Vertex> vertices(static_cast<Vertex*>(bufferMapImplementation(_vertexBuffer,
+            vertexBegin*sizeof(Vertex), dirtyVertexCount*sizeof(Vertex))), dirtyVertexCount);
+        CORRADE_INTERNAL_ASSERT_OUTPUT(vertices);
+        for(std::size_t i = 0; i != dirtyVertexCount; ++i)
+            vertices[i] = {_uploadedPositions[vertexBegin + i], _uploadedTextureCoordinates[vertexBegin + i]};
+        bufferUnmapImplementation(_vertexBuffer, vertexBegin*sizeof(Vertex), dirtyVertexCount*sizeof(Vertex));
+    }
+
+    /* The buffer now matches the copy for all previously uploaded glyphs as
+       well as the newly rendered ones */
+    _uploadedGlyphCount = Math::max(_uploadedGlyphCount, glyphCount);
 
     /* Update index count */
     _mesh.setCount(indexCount);
 }
 
+template<UnsignedInt dimensions> BatchRenderer<dimensions>::BatchRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{GL::Buffer::TargetHint::Array}, _indexBuffer{GL::Buffer::TargetHint::ElementArray}, _font{&font}, _cache{&cache},
+    #ifndef MAGNUM_TARGET_GLES2
+    _cacheArray{},
+    #endif
+    _size{size}, _alignment{alignment}, _shapingCache{nullptr}, _capacity{0}, _vertexBufferUsage{GL::BufferUsage::DynamicDraw}, _indexBufferUsage{GL::BufferUsage::StaticDraw}
+{
+    _mesh.setPrimitive(MeshPrimitive::Triangles)
+        .addVertexBuffer(_vertexBuffer, 0,
+            typename Shaders::AbstractVector<dimensions>::Position{},
+            typename Shaders::AbstractVector<dimensions>::TextureCoordinates{},
+            #ifndef MAGNUM_TARGET_GLES2
+            sizeof(Float),
+            #endif
+            typename Shaders::AbstractVector<dimensions>::Color4{});
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+template<UnsignedInt dimensions> BatchRenderer<dimensions>::BatchRenderer(const GlyphCacheArray& cache, const Alignment alignment): _vertexBuffer{GL::Buffer::TargetHint::Array}, _indexBuffer{GL::Buffer::TargetHint::ElementArray}, _font{}, _cache{}, _cacheArray{&cache}, _size{}, _alignment{alignment}, _shapingCache{nullptr}, _capacity{0}, _vertexBufferUsage{GL::BufferUsage::DynamicDraw}, _indexBufferUsage{GL::BufferUsage::StaticDraw} {
+    /* Texture coordinates and the layer together form the array texture
+       coordinates */
+    _mesh.setPrimitive(MeshPrimitive::Triangles)
+        .addVertexBuffer(_vertexBuffer, 0,
+            typename Shaders::AbstractVector<dimensions>::Position{},
+            typename Shaders::AbstractVector<dimensions>::TextureArrayCoordinates{},
+            typename Shaders::AbstractVector<dimensions>::Color4{});
+}
+#endif
+
+template<UnsignedInt dimensions> BatchRenderer<dimensions>::~BatchRenderer() = default;
+
+template<UnsignedInt dimensions> Range2D BatchRenderer<dimensions>::rectangle(const std::size_t id) const {
+    CORRADE_ASSERT(id < _rectangles.size(),
+        "Text::BatchRenderer::rectangle(): index" << id << "out of range for" << _rectangles.size() << "texts", {});
+    return _rectangles[id];
+}
+
+template<UnsignedInt dimensions> void BatchRenderer<dimensions>::reserve(const UnsignedInt glyphCount, const GL::BufferUsage vertexBufferUsage, const GL::BufferUsage indexBufferUsage) {
+    _capacity = glyphCount;
+    _vertexBufferUsage = vertexBufferUsage;
+    _indexBufferUsage = indexBufferUsage;
+
+    const UnsignedInt vertexCount = glyphCount*4;
+
+    /* Allocate vertex buffer, the data get uploaded in update() */
+    _vertexBuffer.setData({nullptr, vertexCount*sizeof(Vertex)}, vertexBufferUsage);
+
+    /* Render indices and upload them, reconfigure buffer binding */
+    Containers::Array<char> indexData;
+    MeshIndexType indexType;
+    std::tie(indexData, indexType) = renderIndicesInternal(glyphCount);
+    _indexBuffer.setData(indexData, indexBufferUsage);
+    _mesh.setCount(0)
+        .setIndexBuffer(_indexBuffer, 0, indexType, 0, vertexCount);
+}
+
+template<UnsignedInt dimensions> std::size_t BatchRenderer<dimensions>::add(const std::string& text, const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color) {
+    CORRADE_ASSERT(_font,
+        "Text::BatchRenderer::add(): the renderer was constructed from a glyph cache array, specify font, layer and size", {});
+    return addInternal(*_font, *_cache, _size, 0.0f, text, transformation, color);
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+template<UnsignedInt dimensions> std::size_t BatchRenderer<dimensions>::add(AbstractFont& font, const Int layer, const Float size, const std::string& text, const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color) {
+    CORRADE_ASSERT(_cacheArray,
+        "Text::BatchRenderer::add(): the renderer was not constructed from a glyph cache array", {});
+    CORRADE_ASSERT(std::size_t(layer) < std::size_t(_cacheArray->layerCount()),
+        "Text::BatchRenderer::add(): layer" << layer << "out of range for" << _cacheArray->layerCount() << "layers", {});
+    return addInternal(font, _cacheArray->layer(layer), size, Float(layer), text, transformation, color);
+}
+#endif
+
+template<UnsignedInt dimensions> std::size_t BatchRenderer<dimensions>::addInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const Float layer, const std::string& text, const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color) {
+    /* Take the scratch storage from the current arena or reuse it from
+       previous calls */
+    Containers::ArrayView<Vector2> positions, textureCoordinates;
+    std::tie(positions, textureCoordinates) = glyphScratch(text.size()*4, _positionScratch, _textureCoordinateScratch);
+
+    /* Lay out the text */
+    UnsignedInt glyphCount;
+    Range2D rectangle;
+    std::tie(glyphCount, rectangle) = AbstractRenderer::renderInto(font, cache, size, {text.data(), text.size()}, positions, textureCoordinates, nullptr, _alignment, _shapingCache);
+
+    /* Transform the positions and interleave them with the rest at the end of
+       the vertex storage */
+    const std::size_t offset = _vertices.size();
+    _vertices.resize(offset + glyphCount*4);
+    for(std::size_t i = 0; i != glyphCount*4; ++i)
+        _vertices[offset + i] = {transformPosition(transformation, positions[i]), textureCoordinates[i],
+            #ifndef MAGNUM_TARGET_GLES2
+            layer,
+            #endif
+            color};
+    #ifdef MAGNUM_TARGET_GLES2
+    static_cast<void>(layer);
+    #endif
+
+    _rectangles.push_back(rectangle);
+    return _rectangles.size() - 1;
+}
+
+template<UnsignedInt dimensions> void BatchRenderer<dimensions>::clear() {
+    _vertices.clear();
+    _rectangles.clear();
+}
+
+template<UnsignedInt dimensions> void BatchRenderer<dimensions>::update() {
+    MAGNUM_INSTRUMENTATION_SCOPE("Text::BatchRenderer::update()");
+
+    /* Enlarge the buffers if the glyphs don't fit, grow geometrically to
+       avoid reallocating on every added text */
+    const UnsignedInt glyphCount = _vertices.size()/4;
+    if(glyphCount > _capacity)
+        reserve(Math::max(glyphCount, _capacity*2), _vertexBufferUsage, _indexBufferUsage);
+
+    /* Upload the vertices and update index count */
+    if(!_vertices.empty()) _vertexBuffer.setSubData(0, _vertices);
+    _mesh.setCount(glyphCount*6);
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_TEXT_EXPORT Renderer<2>;
 template class MAGNUM_TEXT_EXPORT Renderer<3>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<2>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<3>;
 #endif
 
 }}
@@ -26,14 +26,17 @@
 */
 
 /** @file Text/Renderer.h
- * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D
+ * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, @ref Magnum::Text::BatchRenderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D, @ref Magnum::Text::BatchRenderer2D, @ref Magnum::Text::BatchRenderer3D
  */
 
 #include <string>
 #include <tuple>
 #include <vector>
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Mesh.h"
@@ -41,10 +44,6 @@
 #include "Magnum/Text/Alignment.h"
 #include "Magnum/Text/visibility.h"
 
-#ifdef CORRADE_TARGET_EMSCRIPTEN
-#include <Corrade/Containers/Array.h>
-#endif
-
 namespace Magnum { namespace Text {
 
 /**
@@ -68,6 +67,42 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          */
         static std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment = Alignment::LineLeft);
 
+        /**
+         * @brief Render text into existing storage
+         * @param font                  Font
+         * @param cache                 Glyph cache
+         * @param size                  Font size
+         * @param text                  Text to render
+         * @param positions             Where to put vertex positions
+         * @param textureCoordinates    Where to put vertex texture
+         *      coordinates
+         * @param indices               Where to put indices. Can be empty, in
+         *      which case no indices are generated.
+         * @param alignment             Text alignment
+         * @param shapingCache          Shaping cache to lay out the lines
+         *      through or @cpp nullptr @ce
+         *
+         * Returns count of rendered glyphs and rectangle spanning the
+         * rendered text. Each glyph is four vertices and six indices, only
+         * first four times the glyph count positions and texture coordinates
+         * and six times the glyph count indices are filled. Unlike
+         * @ref render(AbstractFont&, const GlyphCache&, Float, const std::string&, Alignment)
+         * the text doesn't need to be in a @ref std::string and this function
+         * doesn't allocate, as long as the font implements
+         * @ref AbstractFont::layoutInto() without allocations. The glyphs are
+         * laid out directly into @p positions and @p textureCoordinates, thus
+         * these are expected to have the same size and contain at least four
+         * items for each byte of @p text, even though in the end less of them
+         * may be filled. If non-empty, @p indices are expected to contain at
+         * least six items for each byte of @p text.
+         *
+         * If @p shapingCache is not @cpp nullptr @ce, each line is laid out
+         * through @ref ShapingCache::layoutInto() instead of
+         * @ref AbstractFont::layoutInto(), so lines that were laid out
+         * recently are copied from the cache.
+         */
+        static std::pair<UnsignedInt, Range2D> renderInto(AbstractFont& font, const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, Containers::ArrayView<Vector2> positions, Containers::ArrayView<Vector2> textureCoordinates, Containers::ArrayView<UnsignedInt> indices, Alignment alignment = Alignment::LineLeft, ShapingCache* shapingCache = nullptr);
+
         /**
          * @brief Capacity for rendered glyphs
          *
@@ -78,6 +113,24 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         /** @brief Rectangle spanning the rendered text */
         Range2D rectangle() const { return _rectangle; }
 
+        /**
+         * @brief Shaping cache
+         *
+         * @see @ref setShapingCache()
+         */
+        ShapingCache* shapingCache() const { return _shapingCache; }
+
+        /**
+         * @brief Set shaping cache
+         *
+         * If not @cpp nullptr @ce, @ref render() lays the text out through
+         * given cache, see @ref ShapingCache for more information. The cache
+         * is expected to outlive the renderer or be reset back to
+         * @cpp nullptr @ce before being destroyed. Initially no shaping cache
+         * is set.
+         */
+        void setShapingCache(ShapingCache* cache) { _shapingCache = cache; }
+
         /** @brief Vertex buffer */
         GL::Buffer& vertexBuffer() { return _vertexBuffer; }
 
@@ -108,7 +161,15 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          * filled with @ref reserve(). Rectangle spanning the rendered text is
          * available through @ref rectangle().
          *
-         * Initially no text is rendered.
+         * Initially no text is rendered. The text is laid out into scratch
+         * storage taken from @ref ScratchArena::current() or, if there's no
+         * current arena, into storage that's kept between calls and enlarged
+         * only if the text doesn't fit into it, see @ref renderInto() for
+         * details. The result
+         * is compared to what was uploaded in previous calls and only the
+         * range of glyphs that actually changed is mapped and written to
+         * the vertex buffer, so e.g. updating a single digit of a counter
+         * doesn't upload the whole text again.
          * @attention The capacity must be large enough to contain all glyphs,
          *      see @ref reserve() for more information.
          */
@@ -134,13 +195,18 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         const GlyphCache& cache;
         Float size;
         Alignment _alignment;
-        UnsignedInt _capacity;
+        ShapingCache* _shapingCache;
+        UnsignedInt _capacity, _uploadedGlyphCount;
         Range2D _rectangle;
+        Containers::Array<Vector2> _positionScratch, _textureCoordinateScratch;
+        /* Copy of what's in the vertex buffer, for the first
+           _uploadedGlyphCount glyphs */
+        Containers::Array<Vector2> _uploadedPositions, _uploadedTextureCoordinates;
 
         #if defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
-        typedef void*(*BufferMapImplementation)(GL::Buffer&, GLsizeiptr);
-        static MAGNUM_TEXT_LOCAL void* bufferMapImplementationFull(GL::Buffer& buffer, GLsizeiptr length);
-        static MAGNUM_TEXT_LOCAL void* bufferMapImplementationRange(GL::Buffer& buffer, GLsizeiptr length);
+        typedef void*(*BufferMapImplementation)(GL::Buffer&, GLintptr, GLsizeiptr);
+        static MAGNUM_TEXT_LOCAL void* bufferMapImplementationFull(GL::Buffer& buffer, GLintptr offset, GLsizeiptr length);
+        static MAGNUM_TEXT_LOCAL void* bufferMapImplementationRange(GL::Buffer& buffer, GLintptr offset, GLsizeiptr length);
         static BufferMapImplementation bufferMapImplementation;
         #else
         #ifndef CORRADE_TARGET_EMSCRIPTEN
@@ -148,12 +214,12 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         #else
         MAGNUM_TEXT_LOCAL
         #endif
-        void* bufferMapImplementation(GL::Buffer& buffer, GLsizeiptr length);
+        void* bufferMapImplementation(GL::Buffer& buffer, GLintptr offset, GLsizeiptr length);
         #endif
 
         #if defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
-        typedef void(*BufferUnmapImplementation)(GL::Buffer&);
-        static MAGNUM_TEXT_LOCAL void bufferUnmapImplementationDefault(GL::Buffer& buffer);
+        typedef void(*BufferUnmapImplementation)(GL::Buffer&, GLintptr, GLsizeiptr);
+        static MAGNUM_TEXT_LOCAL void bufferUnmapImplementationDefault(GL::Buffer& buffer, GLintptr offset, GLsizeiptr length);
         static MAGNUM_TEXT_LOCAL BufferUnmapImplementation bufferUnmapImplementation;
         #else
         #ifndef CORRADE_TARGET_EMSCRIPTEN
@@ -161,7 +227,7 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         #else
         MAGNUM_TEXT_LOCAL
         #endif
-        void bufferUnmapImplementation(GL::Buffer& buffer);
+        void bufferUnmapImplementation(GL::Buffer& buffer, GLintptr offset, GLsizeiptr length);
         #endif
 };
 
@@ -240,6 +306,236 @@ typedef Renderer<2> Renderer2D;
 /** @brief Three-dimensional text renderer */
 typedef Renderer<3> Renderer3D;
 
+/**
+@brief Batched text renderer
+
+Lays out many texts with the same font, glyph cache and size into a single
+shared vertex and index buffer, so all of them can be drawn with a single draw
+call. Each text has its own transformation, which is applied to the vertex
+positions on the CPU, and its own color, which is stored as a per-vertex
+attribute. Compared to having a separate @ref Renderer for each label, this
+avoids the overhead of having a buffer pair, a mesh and a draw call for each
+of them.
+
+@section Text-BatchRenderer-usage Usage
+
+Add all texts using @ref add(), upload them with @ref update() and draw the
+@ref mesh() with a @ref Shaders::Vector or @ref Shaders::DistanceFieldVector
+shader created with @ref Shaders::AbstractVector::Flag::VertexColor. The color
+set on the shader is multiplied with the per-text color:
+
+@snippet MagnumText.cpp BatchRenderer-usage
+
+When the texts change, call @ref clear(), add them again and call
+@ref update(). The CPU-side vertex storage is kept between the calls, the GPU
+buffers are reallocated only when the glyph count exceeds current
+@ref capacity(). As all texts share the same glyph cache texture, use one
+batch renderer per glyph cache. To render texts in many fonts or sizes with a
+single draw call, put their glyphs into layers of a @ref GlyphCacheArray and
+construct the renderer from it.
+
+@see @ref BatchRenderer2D, @ref BatchRenderer3D, @ref AbstractFont,
+    @ref Shaders::AbstractVector
+*/
+template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT BatchRenderer {
+    public:
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         * @param alignment     Text alignment
+         */
+        explicit BatchRenderer(AbstractFont& font, const GlyphCache& cache, Float size, Alignment alignment = Alignment::LineLeft);
+        BatchRenderer(AbstractFont&, GlyphCache&&, Float, Alignment alignment = Alignment::LineLeft) = delete; /**< @overload */
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Construct a renderer for multiple fonts
+         * @param cache         Glyph cache array
+         * @param alignment     Text alignment
+         *
+         * Texts are added using @ref add(AbstractFont&, Int, Float, const std::string&, const MatrixTypeFor<dimensions, Float>&, const Color4&),
+         * specifying font, layer of @p cache and size for each text. The
+         * @ref mesh() then contains @ref Shaders::AbstractVector::TextureArrayCoordinates
+         * instead of @ref Shaders::AbstractVector::TextureCoordinates, with
+         * the layer in the third component, and is meant to be drawn with a
+         * shader created with @ref Shaders::AbstractVector::Flag::TextureArrays.
+         * See @ref GlyphCacheArray for an example.
+         * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        explicit BatchRenderer(const GlyphCacheArray& cache, Alignment alignment = Alignment::LineLeft);
+        BatchRenderer(GlyphCacheArray&&, Alignment alignment = Alignment::LineLeft) = delete; /**< @overload */
+        #endif
+
+        /** @brief Copying is not allowed */
+        BatchRenderer(const BatchRenderer<dimensions>&) = delete;
+
+        /** @brief Copying is not allowed */
+        BatchRenderer<dimensions>& operator=(const BatchRenderer<dimensions>&) = delete;
+
+        ~BatchRenderer();
+
+        /** @brief Count of added texts */
+        std::size_t textCount() const { return _rectangles.size(); }
+
+        /** @brief Count of glyphs in all added texts */
+        UnsignedInt glyphCount() const { return _vertices.size()/4; }
+
+        /**
+         * @brief Capacity for rendered glyphs
+         *
+         * @see @ref reserve()
+         */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /**
+         * @brief Rectangle spanning given text
+         *
+         * The rectangle is in the text-local coordinates, i.e. with the
+         * alignment applied but without the transformation passed to
+         * @ref add(). Expects that @p id is less than @ref textCount().
+         */
+        Range2D rectangle(std::size_t id) const;
+
+        /**
+         * @brief Shaping cache
+         *
+         * @see @ref setShapingCache()
+         */
+        ShapingCache* shapingCache() const { return _shapingCache; }
+
+        /**
+         * @brief Set shaping cache
+         *
+         * If not @cpp nullptr @ce, @ref add() lays the text out through
+         * given cache, see @ref ShapingCache for more information. The cache
+         * is expected to outlive the renderer or be reset back to
+         * @cpp nullptr @ce before being destroyed. Initially no shaping cache
+         * is set.
+         */
+        void setShapingCache(ShapingCache* cache) { _shapingCache = cache; }
+
+        /** @brief Vertex buffer */
+        GL::Buffer& vertexBuffer() { return _vertexBuffer; }
+
+        /** @brief Index buffer */
+        GL::Buffer& indexBuffer() { return _indexBuffer; }
+
+        /**
+         * @brief Mesh
+         *
+         * Contains position, texture coordinate and @ref Shaders::AbstractVector::Color4
+         * attributes. Reflects the state after the last @ref update() call.
+         */
+        GL::Mesh& mesh() { return _mesh; }
+
+        /**
+         * @brief Reserve capacity for rendered glyphs
+         *
+         * Reallocates the vertex and index buffers and prefills the index
+         * buffer. The usages are remembered and used also when
+         * @ref update() needs to enlarge the buffers. Calling this function
+         * is not strictly needed, but avoids reallocations if the total
+         * glyph count is known in advance. Initial usages are
+         * @ref GL::BufferUsage::DynamicDraw for vertices and
+         * @ref GL::BufferUsage::StaticDraw for indices.
+         */
+        void reserve(UnsignedInt glyphCount, GL::BufferUsage vertexBufferUsage, GL::BufferUsage indexBufferUsage);
+
+        /**
+         * @brief Add a text
+         * @param text              Text to add
+         * @param transformation    Text transformation
+         * @param color             Text color
+         * @return ID of the text, usable in @ref rectangle()
+         *
+         * The text is laid out into CPU-side storage, call @ref update() to
+         * upload it to the GPU. Expects that the renderer was not constructed
+         * from a @ref GlyphCacheArray.
+         */
+        std::size_t add(const std::string& text, const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color = Color4{1.0f});
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Add a text in given font
+         * @param font              Font
+         * @param layer             Layer of the glyph cache array the
+         *      @p font glyphs are in
+         * @param size              Font size
+         * @param text              Text to add
+         * @param transformation    Text transformation
+         * @param color             Text color
+         * @return ID of the text, usable in @ref rectangle()
+         *
+         * Expects that the renderer was constructed from a
+         * @ref GlyphCacheArray and @p layer is less than its
+         * @ref GlyphCacheArray::layerCount().
+         * @requires_gl30 Extension @gl_extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        std::size_t add(AbstractFont& font, Int layer, Float size, const std::string& text, const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color = Color4{1.0f});
+        #endif
+
+        /**
+         * @brief Clear all texts
+         *
+         * Keeps the CPU-side storage as well as current @ref capacity(), call
+         * @ref update() to reflect the change in the @ref mesh().
+         */
+        void clear();
+
+        /**
+         * @brief Upload added texts to the GPU
+         *
+         * If the glyph count exceeds current @ref capacity(), the buffers
+         * are enlarged to at least twice the previous capacity. Then the
+         * vertex data are uploaded and index count of the @ref mesh()
+         * updated.
+         */
+        void update();
+
+    private:
+        struct Vertex {
+            VectorTypeFor<dimensions, Float> position;
+            Vector2 textureCoordinates;
+            #ifndef MAGNUM_TARGET_GLES2
+            /* Used only with GlyphCacheArray, skipped in the mesh otherwise */
+            Float layer;
+            #endif
+            Color4 color;
+        };
+
+        std::size_t MAGNUM_TEXT_LOCAL addInternal(AbstractFont& font, const GlyphCache& cache, Float size, Float layer, const std::string& text, const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color);
+
+        GL::Buffer _vertexBuffer, _indexBuffer;
+        GL::Mesh _mesh;
+        AbstractFont* _font;
+        const GlyphCache* _cache;
+        #ifndef MAGNUM_TARGET_GLES2
+        const GlyphCacheArray* _cacheArray;
+        #endif
+        Float _size;
+        Alignment _alignment;
+        ShapingCache* _shapingCache;
+        UnsignedInt _capacity;
+        GL::BufferUsage _vertexBufferUsage, _indexBufferUsage;
+        std::vector<Vertex> _vertices;
+        std::vector<Range2D> _rectangles;
+        Containers::Array<Vector2> _positionScratch, _textureCoordinateScratch;
+};
+
+/** @brief Two-dimensional batched text renderer */
+typedef BatchRenderer<2> BatchRenderer2D;
+
+/** @brief Three-dimensional batched text renderer */
+typedef BatchRenderer<3> BatchRenderer3D;
+
 }}
 
 #endif
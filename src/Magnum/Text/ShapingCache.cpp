@@ -0,0 +1,152 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShapingCache.h"
+
+#include <cstring>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+
+struct Glyph {
+    Range2D quadPosition;
+    Range2D textureCoordinates;
+    Vector2 advance;
+};
+
+struct Run {
+    /* Points to the key in the map, needed for erasing on eviction.
+       std::unordered_map never moves its nodes, so this stays valid. */
+    const std::string* key;
+    Containers::Array<Glyph> glyphs;
+};
+
+}
+
+struct ShapingCache::State {
+    explicit State(std::size_t capacity): capacity{capacity}, hitCount{}, missCount{} {}
+
+    std::size_t capacity, hitCount, missCount;
+
+    /* Most recently used run is at the front */
+    std::list<Run> runs;
+    std::unordered_map<std::string, std::list<Run>::iterator> lookup;
+
+    /* Reused for building the lookup key so a cache hit doesn't allocate */
+    std::string key;
+};
+
+ShapingCache::ShapingCache(const std::size_t capacity): _state{new State{capacity}} {}
+
+ShapingCache::ShapingCache(ShapingCache&&) noexcept = default;
+
+ShapingCache::~ShapingCache() = default;
+
+ShapingCache& ShapingCache::operator=(ShapingCache&&) noexcept = default;
+
+std::size_t ShapingCache::capacity() const { return _state->capacity; }
+
+std::size_t ShapingCache::size() const { return _state->runs.size(); }
+
+std::size_t ShapingCache::hitCount() const { return _state->hitCount; }
+
+std::size_t ShapingCache::missCount() const { return _state->missCount; }
+
+void ShapingCache::clear() {
+    _state->lookup.clear();
+    _state->runs.clear();
+    _state->hitCount = _state->missCount = 0;
+}
+
+UnsignedInt ShapingCache::layoutInto(AbstractFont& font, const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::StridedArrayView<Range2D> quadPositions, const Containers::StridedArrayView<Range2D> textureCoordinates, const Containers::StridedArrayView<Vector2> advances) {
+    CORRADE_ASSERT(quadPositions.size() == textureCoordinates.size() && quadPositions.size() == advances.size(),
+        "Text::ShapingCache::layoutInto(): expected views of the same size but got" << quadPositions.size() << Debug::nospace << "," << textureCoordinates.size() << "and" << advances.size(), {});
+    CORRADE_ASSERT(quadPositions.size() >= text.size(),
+        "Text::ShapingCache::layoutInto(): expected at least" << text.size() << "glyphs of storage but got" << quadPositions.size(), {});
+
+    State& state = *_state;
+
+    /* Caching disabled, pass through */
+    if(!state.capacity) {
+        ++state.missCount;
+        return font.layoutInto(cache, size, text, quadPositions, textureCoordinates, advances);
+    }
+
+    /* Key is the font and cache address, size and the text bytes */
+    const AbstractFont* const fontPointer = &font;
+    const GlyphCache* const cachePointer = &cache;
+    constexpr std::size_t headerSize = sizeof(fontPointer) + sizeof(cachePointer) + sizeof(size);
+    state.key.resize(headerSize + text.size());
+    std::memcpy(&state.key[0], &fontPointer, sizeof(fontPointer));
+    std::memcpy(&state.key[sizeof(fontPointer)], &cachePointer, sizeof(cachePointer));
+    std::memcpy(&state.key[sizeof(fontPointer) + sizeof(cachePointer)], &size, sizeof(size));
+    if(!text.empty()) std::memcpy(&state.key[headerSize], text.data(), text.size());
+
+    /* Cache hit, copy the glyphs out and mark the run as most recently used */
+    auto found = state.lookup.find(state.key);
+    if(found != state.lookup.end()) {
+        ++state.hitCount;
+        state.runs.splice(state.runs.begin(), state.runs, found->second);
+
+        const Containers::ArrayView<const Glyph> glyphs = found->second->glyphs;
+        for(std::size_t i = 0; i != glyphs.size(); ++i) {
+            quadPositions[i] = glyphs[i].quadPosition;
+            textureCoordinates[i] = glyphs[i].textureCoordinates;
+            advances[i] = glyphs[i].advance;
+        }
+
+        return glyphs.size();
+    }
+
+    /* Cache miss, lay the text out and remember it */
+    ++state.missCount;
+    const UnsignedInt glyphCount = font.layoutInto(cache, size, text, quadPositions, textureCoordinates, advances);
+
+    Containers::Array<Glyph> glyphs{Containers::NoInit, glyphCount};
+    for(std::size_t i = 0; i != glyphCount; ++i)
+        glyphs[i] = Glyph{quadPositions[i], textureCoordinates[i], advances[i]};
+
+    /* Evict the least recently used run if full */
+    if(state.runs.size() == state.capacity) {
+        state.lookup.erase(*state.runs.back().key);
+        state.runs.pop_back();
+    }
+
+    state.runs.push_front(Run{nullptr, std::move(glyphs)});
+    auto inserted = state.lookup.emplace(state.key, state.runs.begin());
+    state.runs.front().key = &inserted.first->first;
+
+    return glyphCount;
+}
+
+}}
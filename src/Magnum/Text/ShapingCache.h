@@ -0,0 +1,151 @@
+#ifndef Magnum_Text_ShapingCache_h
+#define Magnum_Text_ShapingCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::ShapingCache
+ */
+
+#include <memory>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Text/Text.h"
+#include "Magnum/Text/visibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Shaping cache
+
+Remembers results of @ref AbstractFont::layoutInto() for recently laid out
+text runs, so texts that are laid out again with the same font, glyph cache
+and size --- such as UI labels that are relaid out every frame --- are copied
+from the cache instead of going through the font glyph lookup again.
+
+@section Text-ShapingCache-usage Usage
+
+Call @ref layoutInto() instead of @ref AbstractFont::layoutInto(), it has the
+same signature except for the additional font parameter. Alternatively pass
+the cache to @ref AbstractRenderer::renderInto(), @ref AbstractRenderer::setShapingCache()
+or @ref BatchRenderer::setShapingCache() and it'll get used for each rendered
+line.
+
+@code{.cpp}
+Text::ShapingCache shapingCache;
+renderer.setShapingCache(&shapingCache);
+
+// each frame
+renderer.render(label);
+@endcode
+
+@section Text-ShapingCache-eviction Eviction and invalidation
+
+The cache holds at most @ref capacity() runs. When a new run doesn't fit, the
+least recently used one is evicted. The runs are identified by the font and
+glyph cache addresses, font size and the text bytes. The cache has no way to
+know when the font gets closed or reopened or when the glyph cache contents
+get changed, so call @ref clear() in that case --- in particular when
+@ref DynamicGlyphCache::evictionCount() changes, as the cached texture
+coordinates are no longer valid after that.
+*/
+class MAGNUM_TEXT_EXPORT ShapingCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity  Max count of cached text runs
+         *
+         * With zero @p capacity nothing is cached and all calls are passed
+         * through to the font.
+         */
+        explicit ShapingCache(std::size_t capacity = 1024);
+
+        /** @brief Copying is not allowed */
+        ShapingCache(const ShapingCache&) = delete;
+
+        /** @brief Move constructor */
+        ShapingCache(ShapingCache&&) noexcept;
+
+        ~ShapingCache();
+
+        /** @brief Copying is not allowed */
+        ShapingCache& operator=(const ShapingCache&) = delete;
+
+        /** @brief Move assignment */
+        ShapingCache& operator=(ShapingCache&&) noexcept;
+
+        /** @brief Max count of cached text runs */
+        std::size_t capacity() const;
+
+        /** @brief Count of currently cached text runs */
+        std::size_t size() const;
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Count of @ref layoutInto() calls that were satisfied from the
+         * cache since construction or last @ref clear().
+         */
+        std::size_t hitCount() const;
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Count of @ref layoutInto() calls that had to go through
+         * @ref AbstractFont::layoutInto() since construction or last
+         * @ref clear().
+         */
+        std::size_t missCount() const;
+
+        /**
+         * @brief Clear the cache
+         *
+         * Removes all cached runs and resets @ref hitCount() and
+         * @ref missCount() to zero.
+         */
+        void clear();
+
+        /**
+         * @brief Layout the text into existing storage
+         *
+         * If a run with the same @p font, @p cache, @p size and @p text is
+         * in the cache, its glyphs are copied into the output views and the
+         * run is marked as most recently used. Otherwise the text is laid out
+         * using @ref AbstractFont::layoutInto() and the result is remembered,
+         * possibly evicting the least recently used run. Expectations on the
+         * output views and the return value are the same as in
+         * @ref AbstractFont::layoutInto().
+         */
+        UnsignedInt layoutInto(AbstractFont& font, const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, Containers::StridedArrayView<Range2D> quadPositions, Containers::StridedArrayView<Range2D> textureCoordinates, Containers::StridedArrayView<Vector2> advances);
+
+    private:
+        struct State;
+        std::unique_ptr<State> _state;
+};
+
+}}
+
+#endif
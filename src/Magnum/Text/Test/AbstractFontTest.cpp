@@ -23,11 +23,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include <Corrade/Containers/ArrayView.h>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
 
-#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Text/AbstractFont.h"
 
 #include "configure.h"
@@ -39,11 +40,17 @@ struct AbstractFontTest: TestSuite::Tester {
 
     void openSingleData();
     void openFile();
+
+    void layoutInto();
+    void layoutIntoCustom();
 };
 
 AbstractFontTest::AbstractFontTest() {
     addTests({&AbstractFontTest::openSingleData,
-              &AbstractFontTest::openFile});
+              &AbstractFontTest::openFile,
+
+              &AbstractFontTest::layoutInto,
+              &AbstractFontTest::layoutIntoCustom});
 }
 
 namespace {
@@ -91,6 +98,85 @@ void AbstractFontTest::openFile() {
     CORRADE_VERIFY(font.isOpened());
 }
 
+namespace {
+
+class LayoutFont: public Text::AbstractFont {
+    public:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t) override { return 0; }
+
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float size, const std::string& text) override {
+            class Layouter: public AbstractLayouter {
+                public:
+                    explicit Layouter(Float size, UnsignedInt glyphCount): AbstractLayouter{glyphCount}, _size{size} {}
+
+                private:
+                    std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override {
+                        return std::make_tuple(
+                            Range2D{{}, Vector2{Float(i + 1)*_size}},
+                            Range2D::fromSize({i*0.25f, 0.0f}, {0.25f, 1.0f}),
+                            Vector2::xAxis(Float(i + 1)*_size));
+                    }
+
+                    Float _size;
+            };
+
+            return std::unique_ptr<AbstractLayouter>{new Layouter{size, UnsignedInt(text.size())}};
+        }
+};
+
+/* *static_cast<GlyphCache*>(nullptr) makes Clang Analyzer grumpy */
+char glyphCacheData;
+GlyphCache& nullGlyphCache = *reinterpret_cast<GlyphCache*>(&glyphCacheData);
+
+}
+
+void AbstractFontTest::layoutInto() {
+    /* Default implementation goes through doLayout() */
+    LayoutFont font;
+
+    Range2D quadPositions[5];
+    Range2D textureCoordinates[5];
+    Vector2 advances[5];
+    CORRADE_COMPARE(font.layoutInto(nullGlyphCache, 2.0f, {"abc", 3},
+        {quadPositions, 5, sizeof(Range2D)},
+        {textureCoordinates, 5, sizeof(Range2D)},
+        {advances, 5, sizeof(Vector2)}), 3);
+
+    CORRADE_COMPARE(quadPositions[0], (Range2D{{}, Vector2{2.0f}}));
+    CORRADE_COMPARE(quadPositions[2], (Range2D{{}, Vector2{6.0f}}));
+    CORRADE_COMPARE(textureCoordinates[1], (Range2D{{0.25f, 0.0f}, {0.5f, 1.0f}}));
+    CORRADE_COMPARE(advances[0], (Vector2{2.0f, 0.0f}));
+    CORRADE_COMPARE(advances[2], (Vector2{6.0f, 0.0f}));
+}
+
+void AbstractFontTest::layoutIntoCustom() {
+    class CustomLayoutFont: public LayoutFont {
+        UnsignedInt doLayoutInto(const GlyphCache&, Float, Containers::ArrayView<const char> text, Containers::StridedArrayView<Range2D> quadPositions, Containers::StridedArrayView<Range2D>, Containers::StridedArrayView<Vector2> advances) override {
+            /* Two bytes per glyph here */
+            for(std::size_t i = 0; i != text.size()/2; ++i) {
+                quadPositions[i] = Range2D{{}, Vector2{1.0f}};
+                advances[i] = Vector2::xAxis(Float(i));
+            }
+            return text.size()/2;
+        }
+    } font;
+
+    /* Interleaved output */
+    Containers::Array<std::tuple<Range2D, Range2D, Vector2>> glyphs{4};
+    CORRADE_COMPARE(font.layoutInto(nullGlyphCache, 2.0f, {"abcd", 4},
+        {&std::get<0>(glyphs[0]), glyphs.size(), sizeof(std::tuple<Range2D, Range2D, Vector2>)},
+        {&std::get<1>(glyphs[0]), glyphs.size(), sizeof(std::tuple<Range2D, Range2D, Vector2>)},
+        {&std::get<2>(glyphs[0]), glyphs.size(), sizeof(std::tuple<Range2D, Range2D, Vector2>)}), 2);
+    CORRADE_COMPARE(std::get<0>(glyphs[1]), (Range2D{{}, Vector2{1.0f}}));
+    CORRADE_COMPARE(std::get<2>(glyphs[1]), (Vector2{1.0f, 0.0f}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::AbstractFontTest)
@@ -0,0 +1,101 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Text/DistanceFieldGlyphCache.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct DistanceFieldGlyphCacheGLTest: GL::OpenGLTester {
+    explicit DistanceFieldGlyphCacheGLTest();
+
+    void construct();
+    void constructMultiChannel();
+
+    void setDistanceFieldImageMultiChannel();
+    void setImageMultiChannel();
+};
+
+DistanceFieldGlyphCacheGLTest::DistanceFieldGlyphCacheGLTest() {
+    addTests({&DistanceFieldGlyphCacheGLTest::construct,
+              &DistanceFieldGlyphCacheGLTest::constructMultiChannel,
+
+              &DistanceFieldGlyphCacheGLTest::setDistanceFieldImageMultiChannel,
+              &DistanceFieldGlyphCacheGLTest::setImageMultiChannel});
+}
+
+void DistanceFieldGlyphCacheGLTest::construct() {
+    DistanceFieldGlyphCache cache{{1024, 2048}, {128, 256}, 16};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(cache.flags(), DistanceFieldGlyphCache::Flags{});
+    CORRADE_COMPARE(cache.textureSize(), (Vector2i{1024, 2048}));
+    CORRADE_COMPARE(cache.padding(), Vector2i{16});
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(cache.texture().imageSize(0), (Vector2i{128, 256}));
+    #endif
+}
+
+void DistanceFieldGlyphCacheGLTest::constructMultiChannel() {
+    DistanceFieldGlyphCache cache{{1024, 2048}, {128, 256}, 16, DistanceFieldGlyphCache::Flag::MultiChannel};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(cache.flags(), DistanceFieldGlyphCache::Flag::MultiChannel);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(cache.texture().imageSize(0), (Vector2i{128, 256}));
+    #endif
+}
+
+void DistanceFieldGlyphCacheGLTest::setDistanceFieldImageMultiChannel() {
+    DistanceFieldGlyphCache cache{{64, 64}, {16, 16}, 4, DistanceFieldGlyphCache::Flag::MultiChannel};
+
+    const char data[4*3*4]{};
+    cache.setDistanceFieldImage({4, 8}, ImageView2D{PixelFormat::RGB8Unorm, {4, 3}, data});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Single-channel images are not accepted */
+    std::ostringstream out;
+    Error redirectError{&out};
+    cache.setDistanceFieldImage({}, ImageView2D{PixelFormat::R8Unorm, {4, 3}, data});
+    CORRADE_COMPARE(out.str(), "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected GL::PixelFormat::RGB but got GL::PixelFormat::Red\n");
+}
+
+void DistanceFieldGlyphCacheGLTest::setImageMultiChannel() {
+    DistanceFieldGlyphCache cache{{64, 64}, {16, 16}, 4, DistanceFieldGlyphCache::Flag::MultiChannel};
+
+    const char data[16]{};
+    std::ostringstream out;
+    Error redirectError{&out};
+    cache.setImage({}, ImageView2D{PixelFormat::R8Unorm, {4, 4}, data});
+    CORRADE_COMPARE(out.str(), "Text::DistanceFieldGlyphCache::setImage(): multi-channel distance field can't be computed from a binary image, use setDistanceFieldImage() instead\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::DistanceFieldGlyphCacheGLTest)
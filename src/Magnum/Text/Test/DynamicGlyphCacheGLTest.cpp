@@ -0,0 +1,189 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/DynamicGlyphCache.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct DynamicGlyphCacheGLTest: GL::OpenGLTester {
+    explicit DynamicGlyphCacheGLTest();
+
+    void construct();
+    void constructInvalidPageCount();
+
+    void prepare();
+    void prepareReuse();
+    void prepareEvict();
+    void prepareTooLarge();
+};
+
+DynamicGlyphCacheGLTest::DynamicGlyphCacheGLTest() {
+    addTests({&DynamicGlyphCacheGLTest::construct,
+              &DynamicGlyphCacheGLTest::constructInvalidPageCount,
+
+              &DynamicGlyphCacheGLTest::prepare,
+              &DynamicGlyphCacheGLTest::prepareReuse,
+              &DynamicGlyphCacheGLTest::prepareEvict,
+              &DynamicGlyphCacheGLTest::prepareTooLarge});
+}
+
+namespace {
+
+/* Each glyph is 8x8 pixels and has ID equal to its character code */
+class Font: public Text::AbstractFont {
+    public:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t character) override { return character; }
+
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        void doFillGlyphCache(GlyphCache& cache, const std::u32string& characters) override {
+            const std::vector<Range2Di> ranges = cache.reserve(std::vector<Vector2i>(characters.size(), Vector2i{8}));
+            if(ranges.empty()) return;
+
+            for(std::size_t i = 0; i != characters.size(); ++i)
+                cache.insert(characters[i], {}, ranges[i]);
+            filled += characters.size();
+        }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) override {
+            return nullptr;
+        }
+
+        std::size_t filled = 0;
+};
+
+}
+
+void DynamicGlyphCacheGLTest::construct() {
+    DynamicGlyphCache cache{{64, 128}, 4, {1, 2}};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(cache.textureSize(), (Vector2i{64, 128}));
+    CORRADE_COMPARE(cache.padding(), (Vector2i{1, 2}));
+    CORRADE_COMPARE(cache.pageCount(), 4);
+    CORRADE_COMPARE(cache.pageSize(), (Vector2i{64, 32}));
+    CORRADE_COMPARE(cache.evictionCount(), 0);
+    CORRADE_COMPARE(cache.glyphCount(), 1);
+}
+
+void DynamicGlyphCacheGLTest::constructInvalidPageCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    DynamicGlyphCache{{64, 16}, 0};
+    DynamicGlyphCache{{64, 16}, 17};
+    CORRADE_COMPARE(out.str(),
+        "Text::DynamicGlyphCache: expected page count between 1 and 16 but got 0\n"
+        "Text::DynamicGlyphCache: expected page count between 1 and 16 but got 17\n");
+}
+
+void DynamicGlyphCacheGLTest::prepare() {
+    Font font;
+    DynamicGlyphCache cache{{16, 32}, 2};
+
+    /* Duplicate characters are filled just once */
+    CORRADE_COMPARE(cache.prepare(font, "abba"), 2);
+    CORRADE_COMPARE(font.filled, 2);
+    CORRADE_COMPARE(cache.glyphCount(), 3);
+
+    /* The glyphs are on the first page */
+    CORRADE_COMPARE(cache['a'].second, Range2Di::fromSize({}, Vector2i{8}));
+    CORRADE_COMPARE(cache['b'].second, Range2Di::fromSize({8, 0}, Vector2i{8}));
+}
+
+void DynamicGlyphCacheGLTest::prepareReuse() {
+    Font font;
+    DynamicGlyphCache cache{{16, 32}, 2};
+
+    CORRADE_COMPARE(cache.prepare(font, "abcd"), 4);
+    CORRADE_COMPARE(font.filled, 4);
+
+    /* Nothing new to fill */
+    CORRADE_COMPARE(cache.prepare(font, "dcba"), 0);
+    CORRADE_COMPARE(font.filled, 4);
+
+    /* Only the new glyph gets filled, going to the second page */
+    CORRADE_COMPARE(cache.prepare(font, "abe"), 1);
+    CORRADE_COMPARE(font.filled, 5);
+    CORRADE_COMPARE(cache['e'].second, Range2Di::fromSize({0, 16}, Vector2i{8}));
+    CORRADE_COMPARE(cache.evictionCount(), 0);
+}
+
+void DynamicGlyphCacheGLTest::prepareEvict() {
+    Font font;
+    DynamicGlyphCache cache{{16, 32}, 2};
+
+    /* Fill both pages, then use the first page again */
+    CORRADE_COMPARE(cache.prepare(font, "abcd"), 4);
+    CORRADE_COMPARE(cache.prepare(font, "efgh"), 4);
+    CORRADE_COMPARE(cache.prepare(font, "ab"), 0);
+    CORRADE_COMPARE(cache.glyphCount(), 9);
+    CORRADE_COMPARE(cache.evictionCount(), 0);
+
+    /* The second page is least recently used, so it gets evicted */
+    CORRADE_COMPARE(cache.prepare(font, "ai"), 1);
+    CORRADE_COMPARE(cache.evictionCount(), 1);
+    CORRADE_COMPARE(cache.glyphCount(), 6);
+    CORRADE_COMPARE(cache['i'].second, Range2Di::fromSize({0, 16}, Vector2i{8}));
+    CORRADE_COMPARE(cache['d'].second, Range2Di::fromSize({8, 8}, Vector2i{8}));
+
+    /* Evicted glyphs fall back to the "Not Found" glyph and get filled
+       again on next use */
+    CORRADE_COMPARE(cache['e'].second, Range2Di{});
+    CORRADE_COMPARE(cache.prepare(font, "e"), 1);
+    CORRADE_COMPARE(cache['e'].second, Range2Di::fromSize({8, 16}, Vector2i{8}));
+    CORRADE_COMPARE(cache.evictionCount(), 1);
+}
+
+void DynamicGlyphCacheGLTest::prepareTooLarge() {
+    Font font;
+    DynamicGlyphCache cache{{16, 32}, 2};
+
+    /* Nine glyphs don't fit even into the whole cache, pages used by the
+       text itself can't be evicted */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_COMPARE(cache.prepare(font, "abcdefghi"), 9);
+    CORRADE_COMPARE(font.filled, 0);
+    CORRADE_COMPARE(cache.evictionCount(), 0);
+    CORRADE_COMPARE(out.str(), "Text::DynamicGlyphCache::reserve(): all 2 pages are used by the current text, can't fit 9 more glyphs\n");
+
+    /* The failed reservation didn't leave anything behind */
+    CORRADE_COMPARE(cache.prepare(font, "abcdefgh"), 8);
+    CORRADE_COMPARE(font.filled, 8);
+    CORRADE_COMPARE(cache['h'].second, Range2Di::fromSize({8, 24}, Vector2i{8}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::DynamicGlyphCacheGLTest)
@@ -0,0 +1,143 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Text/GlyphCacheArray.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct GlyphCacheArrayGLTest: GL::OpenGLTester {
+    explicit GlyphCacheArrayGLTest();
+
+    void initialize();
+    void layers();
+    void setImage();
+    void layerOutOfRange();
+};
+
+GlyphCacheArrayGLTest::GlyphCacheArrayGLTest() {
+    addTests({&GlyphCacheArrayGLTest::initialize,
+              &GlyphCacheArrayGLTest::layers,
+              &GlyphCacheArrayGLTest::setImage,
+              &GlyphCacheArrayGLTest::layerOutOfRange});
+}
+
+void GlyphCacheArrayGLTest::initialize() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
+        CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() + std::string(" is not supported."));
+    #endif
+
+    GlyphCacheArray cache{{256, 512}, 3, Vector2i{2}};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(cache.textureSize(), (Vector2i{256, 512}));
+    CORRADE_COMPARE(cache.layerCount(), 3);
+    CORRADE_COMPARE(cache.padding(), Vector2i{2});
+    CORRADE_COMPARE(cache.layer(2).textureSize(), (Vector2i{256, 512}));
+    CORRADE_COMPARE(cache.layer(2).padding(), Vector2i{2});
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(cache.texture().imageSize(0), (Vector3i{256, 512, 3}));
+    #endif
+}
+
+void GlyphCacheArrayGLTest::layers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
+        CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() + std::string(" is not supported."));
+    #endif
+
+    GlyphCacheArray cache{Vector2i{16}, 2};
+
+    /* Each layer is packed separately */
+    const std::vector<Range2Di> first = cache.layer(0).reserve({{16, 16}});
+    const std::vector<Range2Di> second = cache.layer(1).reserve({{16, 16}});
+    CORRADE_COMPARE(first.size(), 1);
+    CORRADE_COMPARE(second.size(), 1);
+    CORRADE_COMPARE(first[0], Range2Di::fromSize({}, Vector2i{16}));
+    CORRADE_COMPARE(second[0], Range2Di::fromSize({}, Vector2i{16}));
+
+    /* And has its own glyphs */
+    cache.layer(1).insert(3, {1, 2}, second[0]);
+    CORRADE_COMPARE(cache.layer(0).glyphCount(), 1);
+    CORRADE_COMPARE(cache.layer(1).glyphCount(), 2);
+    CORRADE_COMPARE(cache.layer(1)[3].first, (Vector2i{1, 2}));
+    CORRADE_COMPARE(cache.layer(0)[3].first, (Vector2i{}));
+}
+
+void GlyphCacheArrayGLTest::setImage() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
+        CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() + std::string(" is not supported."));
+    #endif
+
+    GlyphCacheArray cache{Vector2i{4}, 2};
+
+    const UnsignedByte data[]{
+        0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08
+    };
+    cache.layer(1).setImage({0, 2}, ImageView2D{PixelFormat::R8Unorm, {4, 2}, data});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Image3D image = cache.texture().image(0, {PixelFormat::R8Unorm});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(image.size(), (Vector3i{4, 4, 2}));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(image.data()).suffix(24),
+        (Containers::Array<UnsignedByte>{Containers::InPlaceInit, {
+            0x01, 0x02, 0x03, 0x04,
+            0x05, 0x06, 0x07, 0x08
+        }}), TestSuite::Compare::Container);
+    #endif
+}
+
+void GlyphCacheArrayGLTest::layerOutOfRange() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
+        CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() + std::string(" is not supported."));
+    #endif
+
+    GlyphCacheArray cache{Vector2i{16}, 2};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    cache.layer(2);
+    CORRADE_COMPARE(out.str(), "Text::GlyphCacheArray::layer(): index 2 out of range for 2 layers\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::GlyphCacheArrayGLTest)
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <tuple>
 
 #include "Magnum/GL/OpenGLTester.h"
@@ -35,13 +36,17 @@ struct GlyphCacheGLTest: GL::OpenGLTester {
 
     void initialize();
     void access();
+    void accessLargeIds();
     void reserve();
+    void reserveIncremental();
 };
 
 GlyphCacheGLTest::GlyphCacheGLTest() {
     addTests({&GlyphCacheGLTest::initialize,
               &GlyphCacheGLTest::access,
-              &GlyphCacheGLTest::reserve});
+              &GlyphCacheGLTest::accessLargeIds,
+              &GlyphCacheGLTest::reserve,
+              &GlyphCacheGLTest::reserveIncremental});
 }
 
 void GlyphCacheGLTest::initialize() {
@@ -84,6 +89,29 @@ void GlyphCacheGLTest::access() {
     CORRADE_COMPARE(rectangle, Range2Di({10, 10}, {23, 45}));
 }
 
+void GlyphCacheGLTest::accessLargeIds() {
+    Text::GlyphCache cache(Vector2i(236));
+
+    /* One glyph in the dense range, leaving a gap before it, one outside */
+    cache.insert(70, {1, 2}, {{10, 10}, {20, 20}});
+    cache.insert(100000, {3, 4}, {{30, 30}, {40, 40}});
+    CORRADE_COMPARE(cache.glyphCount(), 3);
+    CORRADE_COMPARE(cache[70].first, (Vector2i{1, 2}));
+    CORRADE_COMPARE(cache[70].second, (Range2Di{{10, 10}, {20, 20}}));
+    CORRADE_COMPARE(cache[100000].first, (Vector2i{3, 4}));
+    CORRADE_COMPARE(cache[100000].second, (Range2Di{{30, 30}, {40, 40}}));
+
+    /* Overwriting the "Not Found" glyph is reflected for glyphs inside the
+       gap, after the dense range and outside of it */
+    cache.insert(0, {5, 6}, {{50, 50}, {60, 60}});
+    CORRADE_COMPARE(cache[35].first, (Vector2i{5, 6}));
+    CORRADE_COMPARE(cache[35].second, (Range2Di{{50, 50}, {60, 60}}));
+    CORRADE_COMPARE(cache[71].first, (Vector2i{5, 6}));
+    CORRADE_COMPARE(cache[71].second, (Range2Di{{50, 50}, {60, 60}}));
+    CORRADE_COMPARE(cache[99999].first, (Vector2i{5, 6}));
+    CORRADE_COMPARE(cache[99999].second, (Range2Di{{50, 50}, {60, 60}}));
+}
+
 void GlyphCacheGLTest::reserve() {
     Text::GlyphCache cache(Vector2i(236));
 
@@ -91,6 +119,27 @@ void GlyphCacheGLTest::reserve() {
     CORRADE_VERIFY(!cache.reserve({{5, 3}}).empty());
 }
 
+void GlyphCacheGLTest::reserveIncremental() {
+    Text::GlyphCache cache(Vector2i(16));
+
+    const std::vector<Range2Di> first = cache.reserve({{8, 8}});
+    CORRADE_COMPARE(first.size(), 1);
+    cache.insert(1, {}, first[0]);
+
+    /* Reserving on a non-empty cache doesn't overlap with existing glyphs */
+    const std::vector<Range2Di> second = cache.reserve({{8, 8}, {8, 8}});
+    CORRADE_COMPARE(second.size(), 2);
+    CORRADE_COMPARE(first[0], Range2Di::fromSize({}, Vector2i{8}));
+    CORRADE_COMPARE(second[0], Range2Di::fromSize({8, 0}, Vector2i{8}));
+    CORRADE_COMPARE(second[1], Range2Di::fromSize({0, 8}, Vector2i{8}));
+
+    /* Not enough space left */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(cache.reserve({{8, 8}, {8, 8}}).empty());
+    CORRADE_COMPARE(out.str(), "Text::GlyphCache::reserve(): cache of size Vector(16, 16) is too small to fit 2 more glyphs\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::GlyphCacheGLTest)
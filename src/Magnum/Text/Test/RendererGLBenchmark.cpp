@@ -0,0 +1,147 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/Renderer.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct RendererGLBenchmark: GL::OpenGLTester {
+    explicit RendererGLBenchmark();
+
+    void renderData();
+    void renderMesh();
+    void mutableText();
+
+    private:
+        std::string _text;
+};
+
+namespace {
+
+/* Same as in RendererGLTest, just with the glyphs not growing in size */
+class TestLayouter: public Text::AbstractLayouter {
+    public:
+        explicit TestLayouter(Float size, std::size_t glyphCount): AbstractLayouter(glyphCount), _size(size) {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override {
+            return std::make_tuple(
+                Range2D({}, Vector2(3.0f, 2.0f)*_size),
+                Range2D::fromSize({(i % 16)*6.0f, 0.0f}, {6.0f, 10.0f}),
+                Vector2::xAxis(3.0f*_size)
+            );
+        }
+
+        Float _size;
+};
+
+class TestFont: public Text::AbstractFont {
+    Features doFeatures() const override { return Feature::OpenData; }
+
+    bool doIsOpened() const override { return true; }
+    void doClose() override {}
+
+    UnsignedInt doGlyphId(char32_t) override { return 0; }
+    Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+    std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, const Float size, const std::string& text) override {
+        return std::unique_ptr<AbstractLayouter>(new TestLayouter(size, text.size()));
+    }
+};
+
+/* *static_cast<GlyphCache*>(nullptr) makes Clang Analyzer grumpy */
+char glyphCacheData;
+GlyphCache& nullGlyphCache = *reinterpret_cast<GlyphCache*>(&glyphCacheData);
+
+enum: std::size_t { GlyphCount = 1024 };
+
+}
+
+RendererGLBenchmark::RendererGLBenchmark(): _text(GlyphCount, 'a') {
+    /* Rendering the data is a CPU-only operation, GPU time is measured only
+       for the variants that upload */
+    addBenchmarks({&RendererGLBenchmark::renderData,
+                   &RendererGLBenchmark::renderMesh,
+                   &RendererGLBenchmark::mutableText}, 10);
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    addBenchmarks({&RendererGLBenchmark::renderMesh,
+                   &RendererGLBenchmark::mutableText}, 10, BenchmarkType::GpuTime);
+    #endif
+}
+
+void RendererGLBenchmark::renderData() {
+    TestFont font;
+
+    std::size_t vertexCount = 0;
+    CORRADE_BENCHMARK(10)
+        vertexCount += std::get<0>(AbstractRenderer::render(font, nullGlyphCache, 0.25f, _text)).size();
+
+    CORRADE_COMPARE(vertexCount, 10*GlyphCount*4);
+}
+
+void RendererGLBenchmark::renderMesh() {
+    TestFont font;
+    GL::Buffer vertexBuffer, indexBuffer;
+
+    CORRADE_BENCHMARK(10)
+        Renderer2D::render(font, nullGlyphCache, 0.25f, _text, vertexBuffer, indexBuffer, GL::BufferUsage::StreamDraw);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void RendererGLBenchmark::mutableText() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::map_buffer_range>())
+        CORRADE_SKIP(GL::Extensions::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::map_buffer_range>() &&
+       !GL::Context::current().isExtensionSupported<GL::Extensions::OES::mapbuffer>())
+        CORRADE_SKIP("No required extension is supported");
+    #endif
+
+    TestFont font;
+    Renderer2D renderer(font, nullGlyphCache, 0.25f);
+    renderer.reserve(GlyphCount, GL::BufferUsage::DynamicDraw, GL::BufferUsage::StaticDraw);
+
+    /* Only the vertex buffer is updated, the index buffer stays */
+    CORRADE_BENCHMARK(10)
+        renderer.render(_text);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::RendererGLBenchmark)
@@ -23,33 +23,52 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Math/Matrix3.h"
 #include "Magnum/Text/AbstractFont.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Text/GlyphCacheArray.h"
+#endif
 #include "Magnum/Text/Renderer.h"
 
 namespace Magnum { namespace Text { namespace Test {
 
+using namespace Math::Literals;
+
 struct RendererGLTest: GL::OpenGLTester {
     explicit RendererGLTest();
 
     void renderData();
+    void renderInto();
     void renderMesh();
     void renderMeshIndexType();
     void mutableText();
+    void mutableTextIncremental();
+    void batch();
+    #ifndef MAGNUM_TARGET_GLES2
+    void batchArray();
+    #endif
 
     void multiline();
 };
 
 RendererGLTest::RendererGLTest() {
     addTests({&RendererGLTest::renderData,
+              &RendererGLTest::renderInto,
               &RendererGLTest::renderMesh,
               &RendererGLTest::renderMeshIndexType,
               &RendererGLTest::mutableText,
+              &RendererGLTest::mutableTextIncremental,
+              &RendererGLTest::batch,
+              #ifndef MAGNUM_TARGET_GLES2
+              &RendererGLTest::batchArray,
+              #endif
 
               &RendererGLTest::multiline});
 }
@@ -175,6 +194,68 @@ void RendererGLTest::renderData() {
     }));
 }
 
+void RendererGLTest::renderInto() {
+    TestFont font;
+
+    /* More space than needed, only the prefix should get filled */
+    Vector2 positions[16];
+    Vector2 textureCoordinates[16];
+    UnsignedInt indices[24];
+    UnsignedInt glyphCount;
+    Range2D bounds;
+    std::tie(glyphCount, bounds) = Text::AbstractRenderer::renderInto(font, nullGlyphCache, 0.25f, {"abc", 3}, positions, textureCoordinates, indices, Alignment::MiddleRightIntegral);
+    CORRADE_COMPARE(glyphCount, 3);
+
+    /* Same as in renderData() */
+    const Vector2 offset{-5.0f, 0.0f};
+    CORRADE_COMPARE(bounds, Range2D({0.0f, -0.5f}, {5.0f, 1.0f}).translated(offset));
+    CORRADE_COMPARE_AS(Containers::arrayView(positions).prefix(12),
+        Containers::arrayView<Vector2>({
+            Vector2{0.0f,  0.5f} + offset,
+            Vector2{0.0f,  0.0f} + offset,
+            Vector2{0.75f, 0.5f} + offset,
+            Vector2{0.75f, 0.0f} + offset,
+
+            Vector2{1.0f,  0.75f} + offset,
+            Vector2{1.0f, -0.25f} + offset,
+            Vector2{2.5f,  0.75f} + offset,
+            Vector2{2.5f, -0.25f} + offset,
+
+            Vector2{2.75f,  1.0f} + offset,
+            Vector2{2.75f, -0.5f} + offset,
+            Vector2{5.0f,   1.0f} + offset,
+            Vector2{5.0f,  -0.5f} + offset
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(textureCoordinates).prefix(12),
+        Containers::arrayView<Vector2>({
+            {0.0f, 10.0f},
+            {0.0f,  0.0f},
+            {6.0f, 10.0f},
+            {6.0f,  0.0f},
+
+            { 6.0f, 10.0f},
+            { 6.0f,  0.0f},
+            {12.0f, 10.0f},
+            {12.0f,  0.0f},
+
+            {12.0f, 10.0f},
+            {12.0f,  0.0f},
+            {18.0f, 10.0f},
+            {18.0f,  0.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices).prefix(18),
+        Containers::arrayView<UnsignedInt>({
+            0,  1,  2,  1,  3,  2,
+            4,  5,  6,  5,  7,  6,
+            8,  9, 10,  9, 11, 10
+        }), TestSuite::Compare::Container);
+
+    /* Without indices */
+    std::tie(glyphCount, bounds) = Text::AbstractRenderer::renderInto(font, nullGlyphCache, 0.25f, {"ab", 2}, positions, textureCoordinates, nullptr);
+    CORRADE_COMPARE(glyphCount, 2);
+    CORRADE_COMPARE(bounds, Range2D({0.0f, -0.25f}, {2.5f, 0.75f}));
+}
+
 void RendererGLTest::renderMesh() {
     TestFont font;
     GL::Mesh mesh{NoCreate};
@@ -328,6 +409,215 @@ void RendererGLTest::mutableText() {
     #endif
 }
 
+void RendererGLTest::mutableTextIncremental() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::map_buffer_range>())
+        CORRADE_SKIP(GL::Extensions::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::map_buffer_range>() &&
+       !GL::Context::current().isExtensionSupported<GL::Extensions::OES::mapbuffer>())
+        CORRADE_SKIP("No required extension is supported");
+    #endif
+
+    TestFont font;
+    Text::Renderer2D renderer(font, nullGlyphCache, 0.25f);
+    renderer.reserve(4, GL::BufferUsage::DynamicDraw, GL::BufferUsage::DynamicDraw);
+
+    /* Render a text and then a longer one, only the last glyph should get
+       uploaded, but the result should be the same */
+    renderer.render("abc");
+    renderer.render("abcd");
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 24);
+    CORRADE_COMPARE(renderer.rectangle(), Range2D({0.0f, -0.75f}, {8.25f, 1.25f}));
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<char> vertices = renderer.vertexBuffer().data();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(vertices),
+        (Containers::Array<Float>{Containers::InPlaceInit, {
+            0.0f,  0.5f, 0.0f, 10.0f,
+            0.0f,  0.0f, 0.0f,  0.0f,
+            0.75f, 0.5f, 6.0f, 10.0f,
+            0.75f, 0.0f, 6.0f,  0.0f,
+
+            1.0f,  0.75f,  6.0f, 10.0f,
+            1.0f, -0.25f,  6.0f,  0.0f,
+            2.5f,  0.75f, 12.0f, 10.0f,
+            2.5f, -0.25f, 12.0f,  0.0f,
+
+            2.75f,  1.0f, 12.0f, 10.0f,
+            2.75f, -0.5f, 12.0f,  0.0f,
+            5.0f,   1.0f, 18.0f, 10.0f,
+            5.0f,  -0.5f, 18.0f,  0.0f,
+
+            5.25f,  1.25f, 18.0f, 10.0f,
+            5.25f, -0.75f, 18.0f,  0.0f,
+            8.25f,  1.25f, 24.0f, 10.0f,
+            8.25f, -0.75f, 24.0f,  0.0f
+        }}), TestSuite::Compare::Container);
+    #endif
+
+    /* Shorter text only updates the index count */
+    renderer.render("ab");
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 12);
+
+    /* Reserving again makes the buffer contents undefined, so everything
+       needs to be uploaded again */
+    renderer.reserve(4, GL::BufferUsage::DynamicDraw, GL::BufferUsage::DynamicDraw);
+    renderer.render("ab");
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 12);
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    vertices = renderer.vertexBuffer().data();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(vertices).prefix(32),
+        (Containers::Array<Float>{Containers::InPlaceInit, {
+            0.0f,  0.5f, 0.0f, 10.0f,
+            0.0f,  0.0f, 0.0f,  0.0f,
+            0.75f, 0.5f, 6.0f, 10.0f,
+            0.75f, 0.0f, 6.0f,  0.0f,
+
+            1.0f,  0.75f,  6.0f, 10.0f,
+            1.0f, -0.25f,  6.0f,  0.0f,
+            2.5f,  0.75f, 12.0f, 10.0f,
+            2.5f, -0.25f, 12.0f,  0.0f
+        }}), TestSuite::Compare::Container);
+    #endif
+}
+
+void RendererGLTest::batch() {
+    TestFont font;
+    Text::BatchRenderer2D renderer{font, nullGlyphCache, 0.25f};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.textCount(), 0);
+    CORRADE_COMPARE(renderer.glyphCount(), 0);
+    CORRADE_COMPARE(renderer.capacity(), 0);
+
+    /* Add two texts */
+    CORRADE_COMPARE(renderer.add("a", Matrix3::translation({10.0f, 0.0f}), 0xff0000_rgbf), 0);
+    CORRADE_COMPARE(renderer.add("ab", Matrix3::translation({0.0f, 5.0f}), 0x0000ff_rgbf), 1);
+    CORRADE_COMPARE(renderer.textCount(), 2);
+    CORRADE_COMPARE(renderer.glyphCount(), 3);
+
+    /* The rectangles are without the transformation */
+    CORRADE_COMPARE(renderer.rectangle(0), Range2D({0.0f, 0.0f}, {0.75f, 0.5f}));
+    CORRADE_COMPARE(renderer.rectangle(1), Range2D({0.0f, -0.25f}, {2.5f, 0.75f}));
+
+    /* Nothing uploaded yet */
+    CORRADE_COMPARE(renderer.capacity(), 0);
+    CORRADE_COMPARE(renderer.mesh().count(), 0);
+
+    renderer.update();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.capacity(), 3);
+    CORRADE_COMPARE(renderer.mesh().count(), 18);
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* Position, texture coordinates, layer (unused here) and color */
+    Containers::Array<char> vertices = renderer.vertexBuffer().data();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(vertices),
+        (Containers::Array<Float>{Containers::InPlaceInit, {
+            10.0f,  0.5f, 0.0f, 10.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+            10.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+            10.75f, 0.5f, 6.0f, 10.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+            10.75f, 0.0f, 6.0f,  0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+
+            0.0f,  5.5f, 0.0f, 10.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+            0.0f,  5.0f, 0.0f,  0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+            0.75f, 5.5f, 6.0f, 10.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+            0.75f, 5.0f, 6.0f,  0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+
+            1.0f, 5.75f,  6.0f, 10.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+            1.0f, 4.75f,  6.0f,  0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+            2.5f, 5.75f, 12.0f, 10.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+            2.5f, 4.75f, 12.0f,  0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f
+        }}), TestSuite::Compare::Container);
+
+    Containers::Array<char> indices = renderer.indexBuffer().data();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(indices),
+        (Containers::Array<UnsignedByte>{Containers::InPlaceInit, {
+            0,  1,  2,  1,  3,  2,
+            4,  5,  6,  5,  7,  6,
+            8,  9, 10,  9, 11, 10
+        }}), TestSuite::Compare::Container);
+    #endif
+
+    /* Clearing keeps the capacity */
+    renderer.clear();
+    renderer.update();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.textCount(), 0);
+    CORRADE_COMPARE(renderer.glyphCount(), 0);
+    CORRADE_COMPARE(renderer.capacity(), 3);
+    CORRADE_COMPARE(renderer.mesh().count(), 0);
+
+    /* Exceeding the capacity grows it at least twice */
+    renderer.add("abc", {});
+    renderer.add("a", {});
+    renderer.update();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.glyphCount(), 4);
+    CORRADE_COMPARE(renderer.capacity(), 6);
+    CORRADE_COMPARE(renderer.mesh().count(), 24);
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void RendererGLTest::batchArray() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
+        CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() + std::string(" is not supported."));
+    #endif
+
+    TestFont font1, font2;
+    GlyphCacheArray cache{Vector2i{16}, 2};
+    Text::BatchRenderer2D renderer{cache};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Each text with a different font, layer and size */
+    CORRADE_COMPARE(renderer.add(font1, 1, 0.25f, "a", Matrix3::translation({10.0f, 0.0f}), 0xff0000_rgbf), 0);
+    CORRADE_COMPARE(renderer.add(font2, 0, 0.5f, "a", {}, 0x0000ff_rgbf), 1);
+    CORRADE_COMPARE(renderer.textCount(), 2);
+    CORRADE_COMPARE(renderer.glyphCount(), 2);
+    CORRADE_COMPARE(renderer.rectangle(0), Range2D({0.0f, 0.0f}, {0.75f, 0.5f}));
+    CORRADE_COMPARE(renderer.rectangle(1), Range2D({0.0f, 0.0f}, {1.5f, 1.0f}));
+
+    renderer.update();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 12);
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* Position, texture coordinates with the layer and color */
+    Containers::Array<char> vertices = renderer.vertexBuffer().data();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(vertices),
+        (Containers::Array<Float>{Containers::InPlaceInit, {
+            10.0f,  0.5f, 0.0f, 10.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+            10.0f,  0.0f, 0.0f,  0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+            10.75f, 0.5f, 6.0f, 10.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+            10.75f, 0.0f, 6.0f,  0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+
+            0.0f, 1.0f, 0.0f, 10.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+            0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+            1.5f, 1.0f, 6.0f, 10.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+            1.5f, 0.0f, 6.0f,  0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f
+        }}), TestSuite::Compare::Container);
+    #endif
+
+    /* Adding without a font is not allowed */
+    std::ostringstream out;
+    Error redirectError{&out};
+    renderer.add("a", {});
+    renderer.add(font1, 2, 0.25f, "a", {});
+    CORRADE_COMPARE(out.str(),
+        "Text::BatchRenderer::add(): the renderer was constructed from a glyph cache array, specify font, layer and size\n"
+        "Text::BatchRenderer::add(): layer 2 out of range for 2 layers\n");
+}
+#endif
+
 void RendererGLTest::multiline() {
     class Layouter: public Text::AbstractLayouter {
         public:
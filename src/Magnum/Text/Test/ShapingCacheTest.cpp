@@ -0,0 +1,267 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/ShapingCache.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct ShapingCacheTest: TestSuite::Tester {
+    explicit ShapingCacheTest();
+
+    void construct();
+
+    void hit();
+    void differentSize();
+    void differentFont();
+    void evict();
+    void zeroCapacity();
+    void clear();
+
+    void invalidViews();
+};
+
+ShapingCacheTest::ShapingCacheTest() {
+    addTests({&ShapingCacheTest::construct,
+
+              &ShapingCacheTest::hit,
+              &ShapingCacheTest::differentSize,
+              &ShapingCacheTest::differentFont,
+              &ShapingCacheTest::evict,
+              &ShapingCacheTest::zeroCapacity,
+              &ShapingCacheTest::clear,
+
+              &ShapingCacheTest::invalidViews});
+}
+
+namespace {
+
+class CountingFont: public Text::AbstractFont {
+    public:
+        explicit CountingFont(): layoutCount{} {}
+
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t) override { return 0; }
+
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) override {
+            return nullptr;
+        }
+
+        UnsignedInt doLayoutInto(const GlyphCache&, Float size, Containers::ArrayView<const char> text, Containers::StridedArrayView<Range2D> quadPositions, Containers::StridedArrayView<Range2D> textureCoordinates, Containers::StridedArrayView<Vector2> advances) override {
+            ++layoutCount;
+            for(std::size_t i = 0; i != text.size(); ++i) {
+                quadPositions[i] = Range2D{{}, Vector2{Float(text[i] - 'a' + 1)*size}};
+                textureCoordinates[i] = Range2D::fromSize({(text[i] - 'a')*0.25f, 0.0f}, {0.25f, 1.0f});
+                advances[i] = Vector2::xAxis(Float(text[i] - 'a' + 1)*size);
+            }
+            return text.size();
+        }
+
+        UnsignedInt layoutCount;
+};
+
+/* *static_cast<GlyphCache*>(nullptr) makes Clang Analyzer grumpy */
+char glyphCacheData;
+GlyphCache& nullGlyphCache = *reinterpret_cast<GlyphCache*>(&glyphCacheData);
+
+UnsignedInt layout(ShapingCache& cache, AbstractFont& font, Float size, const char* text, UnsignedInt textSize, Range2D* quadPositions, Range2D* textureCoordinates, Vector2* advances) {
+    return cache.layoutInto(font, nullGlyphCache, size, {text, textSize},
+        {quadPositions, 4, sizeof(Range2D)},
+        {textureCoordinates, 4, sizeof(Range2D)},
+        {advances, 4, sizeof(Vector2)});
+}
+
+}
+
+void ShapingCacheTest::construct() {
+    ShapingCache cache{16};
+    CORRADE_COMPARE(cache.capacity(), 16);
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 0);
+}
+
+void ShapingCacheTest::hit() {
+    CountingFont font;
+    ShapingCache cache;
+
+    Range2D quadPositions[4];
+    Range2D textureCoordinates[4];
+    Vector2 advances[4];
+    CORRADE_COMPARE(layout(cache, font, 2.0f, "abc", 3, quadPositions, textureCoordinates, advances), 3);
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_COMPARE(cache.missCount(), 1);
+
+    /* The second time it should be copied from the cache */
+    Range2D quadPositions2[4];
+    Range2D textureCoordinates2[4];
+    Vector2 advances2[4];
+    CORRADE_COMPARE(layout(cache, font, 2.0f, "abc", 3, quadPositions2, textureCoordinates2, advances2), 3);
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_COMPARE(cache.hitCount(), 1);
+    CORRADE_COMPARE(cache.missCount(), 1);
+
+    CORRADE_COMPARE(quadPositions2[0], (Range2D{{}, Vector2{2.0f}}));
+    CORRADE_COMPARE(quadPositions2[2], (Range2D{{}, Vector2{6.0f}}));
+    CORRADE_COMPARE(textureCoordinates2[1], (Range2D{{0.25f, 0.0f}, {0.5f, 1.0f}}));
+    CORRADE_COMPARE(advances2[0], (Vector2{2.0f, 0.0f}));
+    CORRADE_COMPARE(advances2[2], (Vector2{6.0f, 0.0f}));
+
+    /* A prefix is a different run */
+    CORRADE_COMPARE(layout(cache, font, 2.0f, "ab", 2, quadPositions, textureCoordinates, advances), 2);
+    CORRADE_COMPARE(font.layoutCount, 2);
+    CORRADE_COMPARE(cache.size(), 2);
+}
+
+void ShapingCacheTest::differentSize() {
+    CountingFont font;
+    ShapingCache cache;
+
+    Range2D quadPositions[4];
+    Range2D textureCoordinates[4];
+    Vector2 advances[4];
+    layout(cache, font, 2.0f, "abc", 3, quadPositions, textureCoordinates, advances);
+    layout(cache, font, 3.0f, "abc", 3, quadPositions, textureCoordinates, advances);
+    CORRADE_COMPARE(font.layoutCount, 2);
+    CORRADE_COMPARE(cache.size(), 2);
+    CORRADE_COMPARE(advances[2], (Vector2{9.0f, 0.0f}));
+}
+
+void ShapingCacheTest::differentFont() {
+    CountingFont font1, font2;
+    ShapingCache cache;
+
+    Range2D quadPositions[4];
+    Range2D textureCoordinates[4];
+    Vector2 advances[4];
+    layout(cache, font1, 2.0f, "abc", 3, quadPositions, textureCoordinates, advances);
+    layout(cache, font2, 2.0f, "abc", 3, quadPositions, textureCoordinates, advances);
+    CORRADE_COMPARE(font1.layoutCount, 1);
+    CORRADE_COMPARE(font2.layoutCount, 1);
+    CORRADE_COMPARE(cache.size(), 2);
+}
+
+void ShapingCacheTest::evict() {
+    CountingFont font;
+    ShapingCache cache{2};
+
+    Range2D quadPositions[4];
+    Range2D textureCoordinates[4];
+    Vector2 advances[4];
+    layout(cache, font, 2.0f, "a", 1, quadPositions, textureCoordinates, advances);
+    layout(cache, font, 2.0f, "b", 1, quadPositions, textureCoordinates, advances);
+
+    /* Mark "a" as most recently used, so "b" gets evicted */
+    layout(cache, font, 2.0f, "a", 1, quadPositions, textureCoordinates, advances);
+    layout(cache, font, 2.0f, "c", 1, quadPositions, textureCoordinates, advances);
+    CORRADE_COMPARE(font.layoutCount, 3);
+    CORRADE_COMPARE(cache.size(), 2);
+
+    /* "a" is still there */
+    layout(cache, font, 2.0f, "a", 1, quadPositions, textureCoordinates, advances);
+    CORRADE_COMPARE(font.layoutCount, 3);
+
+    /* "b" is not */
+    layout(cache, font, 2.0f, "b", 1, quadPositions, textureCoordinates, advances);
+    CORRADE_COMPARE(font.layoutCount, 4);
+    CORRADE_COMPARE(cache.size(), 2);
+    CORRADE_COMPARE(cache.hitCount(), 2);
+    CORRADE_COMPARE(cache.missCount(), 4);
+}
+
+void ShapingCacheTest::zeroCapacity() {
+    CountingFont font;
+    ShapingCache cache{0};
+
+    Range2D quadPositions[4];
+    Range2D textureCoordinates[4];
+    Vector2 advances[4];
+    layout(cache, font, 2.0f, "abc", 3, quadPositions, textureCoordinates, advances);
+    CORRADE_COMPARE(layout(cache, font, 2.0f, "abc", 3, quadPositions, textureCoordinates, advances), 3);
+    CORRADE_COMPARE(font.layoutCount, 2);
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 2);
+    CORRADE_COMPARE(advances[2], (Vector2{6.0f, 0.0f}));
+}
+
+void ShapingCacheTest::clear() {
+    CountingFont font;
+    ShapingCache cache;
+
+    Range2D quadPositions[4];
+    Range2D textureCoordinates[4];
+    Vector2 advances[4];
+    layout(cache, font, 2.0f, "abc", 3, quadPositions, textureCoordinates, advances);
+    layout(cache, font, 2.0f, "abc", 3, quadPositions, textureCoordinates, advances);
+    CORRADE_COMPARE(cache.hitCount(), 1);
+
+    cache.clear();
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 0);
+
+    layout(cache, font, 2.0f, "abc", 3, quadPositions, textureCoordinates, advances);
+    CORRADE_COMPARE(font.layoutCount, 2);
+}
+
+void ShapingCacheTest::invalidViews() {
+    CountingFont font;
+    ShapingCache cache;
+
+    Range2D quadPositions[4];
+    Range2D textureCoordinates[4];
+    Vector2 advances[4];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    cache.layoutInto(font, nullGlyphCache, 2.0f, {"abc", 3},
+        {quadPositions, 4, sizeof(Range2D)},
+        {textureCoordinates, 3, sizeof(Range2D)},
+        {advances, 4, sizeof(Vector2)});
+    cache.layoutInto(font, nullGlyphCache, 2.0f, {"abcde", 5},
+        {quadPositions, 4, sizeof(Range2D)},
+        {textureCoordinates, 4, sizeof(Range2D)},
+        {advances, 4, sizeof(Vector2)});
+    CORRADE_COMPARE(out.str(),
+        "Text::ShapingCache::layoutInto(): expected views of the same size but got 4, 3 and 4\n"
+        "Text::ShapingCache::layoutInto(): expected at least 5 glyphs of storage but got 4\n");
+    CORRADE_COMPARE(font.layoutCount, 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::ShapingCacheTest)
@@ -39,7 +39,12 @@ class AbstractFont;
 class AbstractFontConverter;
 class AbstractLayouter;
 class DistanceFieldGlyphCache;
+class DynamicGlyphCache;
 class GlyphCache;
+#ifndef MAGNUM_TARGET_GLES2
+class GlyphCacheArray;
+#endif
+class ShapingCache;
 
 enum class Alignment: UnsignedByte;
 
@@ -47,6 +52,9 @@ class AbstractRenderer;
 template<UnsignedInt> class Renderer;
 typedef Renderer<2> Renderer2D;
 typedef Renderer<3> Renderer3D;
+template<UnsignedInt> class BatchRenderer;
+typedef BatchRenderer<2> BatchRenderer2D;
+typedef BatchRenderer<3> BatchRenderer3D;
 #endif
 
 }}
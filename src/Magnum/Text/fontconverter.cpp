@@ -23,13 +23,21 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/String.h>
 
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/AbstractFontConverter.h"
 #include "Magnum/Text/DistanceFieldGlyphCache.h"
+#include "Magnum/TextureTools/DistanceField.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 
 #ifdef MAGNUM_TARGET_HEADLESS
@@ -81,8 +89,8 @@ See @ref building, @ref cmake and the @ref Text namespace for more information.
 @code{.sh}
 magnum-fontconverter [--magnum-...] [-h|--help] --font FONT
     --converter CONVERTER [--plugin-dir DIR] [--characters CHARACTERS]
-    [--font-size N] [--atlas-size "X Y"] [--output-size "X Y"] [--radius N]
-    [--] input output
+    [--font-size "N..."] [--atlas-size "X Y"] [--output-size "X Y"]
+    [--radius N] [--cpu] [--threads N] [--batch] [--] input output
 @endcode
 
 Arguments:
@@ -95,11 +103,22 @@ Arguments:
 -   `--plugin-dir DIR` --- override base plugin dir
 -   `--characters CHARACTERS` --- characters to include in the output (default:
     `abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789?!:;,.&nbsp;`)
--   `--font-size N` --- input font size (default: `128`)
+-   `--font-size "N..."` --- input font size. If more than one size is
+    specified, the font is converted for each of them and the size is
+    appended to the output filename prefix, separated with a dash.
+    (default: `128`)
 -   `--atlas-size "X Y"` --- glyph atlas size (default: `"2048 2048"`)
 -   `--output-size "X Y"` --- output atlas size. If set to zero size, distance
     field computation will not be used. (default: `"256 256"`)
 -   `--radius N` --- distance field computation radius (default: `24`)
+-   `--cpu` --- compute the distance field on the CPU using
+    @ref TextureTools::distanceField(const ImageView2D&, const Vector2i&, Int, UnsignedInt)
+    instead of the GPU
+-   `--threads N` --- thread count used for the CPU distance field
+    computation (default: `1`)
+-   `--batch` --- treat `input` as a text file with one font filename per
+    line and use `output` as a prefix for the output filenames, which are
+    then formed from the font filenames without extension
 -   `--magnum-...` --- engine-specific options (see
     @ref GL-Context-command-line for details)
 
@@ -120,10 +139,45 @@ According to @ref Text::MagnumFontConverter "MagnumFontConverter" plugin
 documentation, this will generate files `myfont.conf` and `myfont.tga` in
 current directory. You can then load and use them via the
 @ref Text::MagnumFont "MagnumFont" plugin.
+
+Converting a list of fonts listed in `fonts.txt` in three sizes in one go,
+with the distance field computed on eight CPU threads:
+
+@code{.sh}
+magnum-fontconverter --font FreeTypeFont --converter MagnumFontConverter \
+    --font-size "32 64 128" --cpu --threads 8 --batch fonts.txt fonts/
+@endcode
+
+For a line `DejaVuSans.ttf` in `fonts.txt` this will generate the
+`fonts/DejaVuSans-32.conf`, `fonts/DejaVuSans-64.conf` and
+`fonts/DejaVuSans-128.conf` files together with their images. The
+@ref Text::AbstractFont "font plugin" and the converter are loaded just once
+for the whole batch. Glyph rasterization itself is done by the font plugin
+and stays on a single thread.
 */
 
 namespace Text {
 
+namespace {
+
+/* Like DistanceFieldGlyphCache, but computing the distance field on the CPU,
+   which is considerably faster on machines without a GPU */
+class CpuDistanceFieldGlyphCache: public GlyphCache {
+    public:
+        explicit CpuDistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, const UnsignedInt radius, const UnsignedInt threadCount): GlyphCache{GL::TextureFormat::R8, originalSize, size, Vector2i(radius)}, _scale{Vector2(size)/Vector2(originalSize)}, _radius{radius}, _threadCount{threadCount} {}
+
+        void setImage(const Vector2i& offset, const ImageView2D& image) override {
+            const Image2D result = TextureTools::distanceField(image, Vector2i{Vector2{image.size()}*_scale}, _radius, _threadCount);
+            texture().setSubImage(0, Vector2i{Vector2{offset}*_scale}, result);
+        }
+
+    private:
+        Vector2 _scale;
+        UnsignedInt _radius, _threadCount;
+};
+
+}
+
 class FontConverter: public Platform::WindowlessApplication {
     public:
         explicit FontConverter(const Arguments& arguments);
@@ -143,10 +197,13 @@ FontConverter::FontConverter(const Arguments& arguments): Platform::WindowlessAp
         .addOption("characters", "abcdefghijklmnopqrstuvwxyz"
                                  "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
                                  "0123456789?!:;,. ").setHelp("characters", "characters to include in the output")
-        .addOption("font-size", "128").setHelp("font-size", "input font size", "N")
+        .addOption("font-size", "128").setHelp("font-size", "input font size, can be more than one", "\"N...\"")
         .addOption("atlas-size", "2048 2048").setHelp("atlas-size", "glyph atlas size", "\"X Y\"")
         .addOption("output-size", "256 256").setHelp("output-size", "output atlas size. If set to zero size, distance field computation will not be used.", "\"X Y\"")
         .addOption("radius", "24").setHelp("radius", "distance field computation radius", "N")
+        .addBooleanOption("cpu").setHelp("cpu", "compute the distance field on the CPU")
+        .addOption("threads", "1").setHelp("threads", "thread count used for the CPU distance field computation", "N")
+        .addBooleanOption("batch").setHelp("batch", "treat input as a file with a list of fonts and output as a prefix")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setHelp("Converts font to raster one of given atlas size.")
         .parse(arguments.argc, arguments.argv);
@@ -174,38 +231,85 @@ int FontConverter::exec() {
     std::unique_ptr<Text::AbstractFontConverter> converter = converterManager.loadAndInstantiate(args.value("converter"));
     if(!converter) return 2;
 
-    /* Open font */
-    if(!font->openFile(args.value("input"), args.value<Float>("font-size"))) {
-        Error() << "Cannot open font" << args.value("input");
-        return 3;
-    }
-
-    /* Create distance field glyph cache if radius is specified */
-    std::unique_ptr<Text::GlyphCache> cache;
-    if(!args.value<Vector2i>("output-size").isZero()) {
-        Debug() << "Populating distance field glyph cache...";
-
-        cache.reset(new Text::DistanceFieldGlyphCache(
-            args.value<Vector2i>("atlas-size"),
-            args.value<Vector2i>("output-size"),
-            args.value<Int>("radius")));
-
-    /* Otherwise use normal cache */
-    } else {
-        Debug() << "Zero-size distance field output specified, populating normal glyph cache...";
-
-        cache.reset(new Text::GlyphCache(args.value<Vector2i>("atlas-size")));
+    /* Gather the fonts to convert */
+    std::vector<std::pair<std::string, std::string>> fonts;
+    if(args.isSet("batch")) {
+        if(!Utility::Directory::fileExists(args.value("input"))) {
+            Error() << "Cannot open font list" << args.value("input");
+            return 3;
+        }
+
+        for(const std::string& line: Utility::String::splitWithoutEmptyParts(Utility::Directory::readString(args.value("input")), '\n')) {
+            const std::string filename = Utility::String::trim(line);
+            if(filename.empty()) continue;
+
+            std::string name = Utility::Directory::filename(filename);
+            const std::size_t dot = name.rfind('.');
+            if(dot != std::string::npos && dot != 0) name.resize(dot);
+            fonts.emplace_back(filename, args.value("output") + name);
+        }
+    } else fonts.emplace_back(args.value("input"), args.value("output"));
+
+    /* Gather the sizes */
+    std::vector<Float> sizes;
+    {
+        std::istringstream in{args.value("font-size")};
+        for(Float size; in >> size; ) sizes.push_back(size);
+        if(sizes.empty()) {
+            Error() << "Invalid font size" << args.value("font-size");
+            return 3;
+        }
     }
 
-    /* Fill the cache */
-    font->fillGlyphCache(*cache, args.value("characters"));
-
-    Debug() << "Converting font...";
-
-    /* Convert the font */
-    if(!converter->exportFontToFile(*font, *cache, args.value("output"), args.value("characters"))) {
-        Error() << "Cannot export font to" << args.value("output");
-        std::exit(1);
+    for(const std::pair<std::string, std::string>& input: fonts) for(const Float size: sizes) {
+        std::string output = input.second;
+        if(sizes.size() > 1) {
+            std::ostringstream out;
+            out << output << '-' << size;
+            output = out.str();
+        }
+
+        /* Open font */
+        Debug() << "Converting" << input.first << "of size" << size << "to" << output;
+        if(!font->openFile(input.first, size)) {
+            Error() << "Cannot open font" << input.first;
+            return 3;
+        }
+
+        /* Create distance field glyph cache if radius is specified */
+        std::unique_ptr<Text::GlyphCache> cache;
+        if(!args.value<Vector2i>("output-size").isZero()) {
+            Debug() << "Populating distance field glyph cache...";
+
+            if(args.isSet("cpu")) cache.reset(new CpuDistanceFieldGlyphCache(
+                args.value<Vector2i>("atlas-size"),
+                args.value<Vector2i>("output-size"),
+                args.value<Int>("radius"),
+                args.value<UnsignedInt>("threads")));
+            else cache.reset(new Text::DistanceFieldGlyphCache(
+                args.value<Vector2i>("atlas-size"),
+                args.value<Vector2i>("output-size"),
+                args.value<Int>("radius")));
+
+        /* Otherwise use normal cache */
+        } else {
+            Debug() << "Zero-size distance field output specified, populating normal glyph cache...";
+
+            cache.reset(new Text::GlyphCache(args.value<Vector2i>("atlas-size")));
+        }
+
+        /* Fill the cache */
+        font->fillGlyphCache(*cache, args.value("characters"));
+
+        Debug() << "Converting font...";
+
+        /* Convert the font */
+        if(!converter->exportFontToFile(*font, *cache, output, args.value("characters"))) {
+            Error() << "Cannot export font to" << output;
+            std::exit(1);
+        }
+
+        font->close();
     }
 
     Debug() << "Done.";
@@ -25,36 +25,240 @@
 
 #include "Atlas.h"
 
+#include <algorithm>
+#include <numeric>
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
 #include "Magnum/Math/Functions.h"
-#include "Magnum/Math/Range.h"
 
 namespace Magnum { namespace TextureTools {
 
-std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
-    if(sizes.empty()) return {};
+AtlasPacker::AtlasPacker(const Vector2i& size, const Vector2i& padding, const Flags flags): _size{size}, _padding{padding}, _flags{flags} {
+    clear();
+}
 
-    /* Size of largest texture */
-    Vector2i maxSize;
-    for(const Vector2i& size: sizes)
-        maxSize = Math::max(maxSize, size);
+Float AtlasPacker::occupancy() const {
+    const std::size_t area = std::size_t(_size.x())*std::size_t(_size.y());
+    return area ? Float(Double(_usedArea)/Double(area)) : 0.0f;
+}
+
+void AtlasPacker::clear() {
+    _count = 0;
+    _usedArea = 0;
+    _filledSize = {};
+    _skyline.assign(1, Node{0, 0, _size.x()});
+}
 
-    std::vector<Range2Di> atlas;
+Int AtlasPacker::fit(const std::size_t node, const Vector2i& size) const {
+    /* Doesn't fit horizontally */
+    const Int x = _skyline[node].x;
+    if(x + size.x() > _size.x()) return -1;
 
-    /* Columns and rows */
-    const Vector2i paddedSize = maxSize+2*padding;
-    const Vector2i gridSize = atlasSize/paddedSize;
-    if(std::size_t(gridSize.product()) < sizes.size()) {
-        Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
-                << "is too small to fit" << sizes.size() << paddedSize
-                << "textures. Generated atlas will be empty.";
-        return atlas;
+    /* Find the highest skyline segment under the rectangle, that's where it
+       has to be placed */
+    Int y = 0;
+    for(std::size_t i = node; i != _skyline.size() && _skyline[i].x < x + size.x(); ++i)
+        y = Math::max(y, _skyline[i].y);
+
+    /* Doesn't fit vertically */
+    if(y + size.y() > _size.y()) return -1;
+
+    return y;
+}
+
+void AtlasPacker::insert(const std::size_t node, const Vector2i& position, const Vector2i& size) {
+    /* Put a new segment on top of the rectangle */
+    _skyline.insert(_skyline.begin() + node, Node{position.x(), position.y() + size.y(), size.x()});
+
+    /* Shrink or remove the segments that are now under it */
+    const Int end = position.x() + size.x();
+    for(std::size_t i = node + 1; i != _skyline.size(); ) {
+        Node& n = _skyline[i];
+        if(n.x >= end) break;
+
+        if(n.x + n.width <= end) {
+            _skyline.erase(_skyline.begin() + i);
+            continue;
+        }
+
+        n.width -= end - n.x;
+        n.x = end;
+        break;
+    }
+
+    /* Merge neighboring segments of the same height */
+    for(std::size_t i = 0; i + 1 < _skyline.size(); ) {
+        if(_skyline[i].y == _skyline[i + 1].y) {
+            _skyline[i].width += _skyline[i + 1].width;
+            _skyline.erase(_skyline.begin() + i + 1);
+        } else ++i;
+    }
+}
+
+Containers::Optional<Range2Di> AtlasPacker::add(const Vector2i& size) {
+    /* Find the placement that has the lowest top edge, in case of a tie pick
+       the narrower segment to leave wide segments for wide rectangles. The
+       padding is in atlas space, so it's added after the rotation. */
+    std::size_t bestNode = ~std::size_t{};
+    Int bestTop = 0, bestWidth = 0;
+    Vector2i bestPosition, bestSize;
+    bool bestRotated = false;
+    for(const bool rotated: {false, true}) {
+        const Vector2i candidate = (rotated ? Vector2i{size.y(), size.x()} : size) + 2*_padding;
+        for(std::size_t i = 0; i != _skyline.size(); ++i) {
+            const Int y = fit(i, candidate);
+            if(y < 0) continue;
+
+            const Int top = y + candidate.y();
+            if(bestNode == ~std::size_t{} || top < bestTop || (top == bestTop && _skyline[i].width < bestWidth)) {
+                bestNode = i;
+                bestTop = top;
+                bestWidth = _skyline[i].width;
+                bestPosition = {_skyline[i].x, y};
+                bestSize = candidate;
+                bestRotated = rotated;
+            }
+        }
+
+        /* Try the rotated variant only if allowed and it makes a difference */
+        if(!(_flags & Flag::AllowRotation) || size.x() == size.y())
+            break;
+    }
+
+    if(bestNode == ~std::size_t{}) return Containers::NullOpt;
+
+    insert(bestNode, bestPosition, bestSize);
+    ++_count;
+    _usedArea += std::size_t(size.x())*std::size_t(size.y());
+    _filledSize = Math::max(_filledSize, bestPosition + bestSize);
+
+    return Range2Di::fromSize(bestPosition + _padding, bestRotated ? Vector2i{size.y(), size.x()} : size);
+}
+
+std::vector<Range2Di> AtlasPacker::add(const std::vector<Vector2i>& sizes) {
+    /* Place the tallest rectangles first, keep the original order for ties
+       so the result is deterministic */
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+        return sizes[a].y() > sizes[b].y();
+    });
+
+    /* Save the state so it can be restored if the rectangles don't fit */
+    const std::vector<Node> skyline = _skyline;
+    const std::size_t count = _count;
+    const std::size_t usedArea = _usedArea;
+    const Vector2i filledSize = _filledSize;
+
+    std::vector<Range2Di> out(sizes.size());
+    for(const std::size_t i: order) {
+        Containers::Optional<Range2Di> range = add(sizes[i]);
+        if(!range) {
+            _skyline = skyline;
+            _count = count;
+            _usedArea = usedArea;
+            _filledSize = filledSize;
+            return {};
+        }
+
+        out[i] = *range;
     }
 
-    /** @todo actual magic implementation, not this joke */
+    return out;
+}
 
-    atlas.reserve(sizes.size());
-    for(std::size_t i = 0; i != sizes.size(); ++i)
-        atlas.push_back(Range2Di::fromSize(Vector2i(i%gridSize.x(), i/gridSize.x())*paddedSize+padding, sizes[i]));
+Debug& operator<<(Debug& debug, const AtlasPacker::Flag value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case AtlasPacker::Flag::v: return debug << "TextureTools::AtlasPacker::Flag::" #v;
+        _c(AllowRotation)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "TextureTools::AtlasPacker::Flag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const AtlasPacker::Flags value) {
+    return Containers::enumSetDebugOutput(debug, value, "TextureTools::AtlasPacker::Flags{}", {
+        AtlasPacker::Flag::AllowRotation});
+}
+
+AtlasArrayPacker::AtlasArrayPacker(const Vector2i& size, const Int maxLayerCount, const Vector2i& padding, const AtlasPacker::Flags flags): _size{size}, _padding{padding}, _flags{flags}, _maxLayerCount{maxLayerCount} {}
+
+const AtlasPacker& AtlasArrayPacker::layer(const Int id) const {
+    CORRADE_ASSERT(std::size_t(id) < _layers.size(),
+        "TextureTools::AtlasArrayPacker::layer(): index" << id << "out of range for" << _layers.size() << "layers", _layers[0]);
+    return _layers[id];
+}
+
+std::size_t AtlasArrayPacker::count() const {
+    std::size_t count = 0;
+    for(const AtlasPacker& layer: _layers) count += layer.count();
+    return count;
+}
+
+Containers::Optional<Range3Di> AtlasArrayPacker::add(const Vector2i& size) {
+    /* First fit into the already opened layers */
+    for(std::size_t i = 0; i != _layers.size(); ++i) {
+        Containers::Optional<Range2Di> range = _layers[i].add(size);
+        if(range) return Range3Di{{range->min(), Int(i)}, {range->max(), Int(i) + 1}};
+    }
+
+    /* Open a new layer, if possible. If it doesn't fit even into an empty
+       layer, close it again. */
+    if(Int(_layers.size()) >= _maxLayerCount) return Containers::NullOpt;
+    _layers.emplace_back(_size, _padding, _flags);
+    Containers::Optional<Range2Di> range = _layers.back().add(size);
+    if(!range) {
+        _layers.pop_back();
+        return Containers::NullOpt;
+    }
+
+    const Int layer = _layers.size() - 1;
+    return Range3Di{{range->min(), layer}, {range->max(), layer + 1}};
+}
+
+std::vector<Range3Di> AtlasArrayPacker::add(const std::vector<Vector2i>& sizes) {
+    /* Same as in AtlasPacker, tallest first and original order for ties */
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+        return sizes[a].y() > sizes[b].y();
+    });
+
+    /* Save the state so it can be restored if the rectangles don't fit */
+    const std::vector<AtlasPacker> layers = _layers;
+
+    std::vector<Range3Di> out(sizes.size());
+    for(const std::size_t i: order) {
+        Containers::Optional<Range3Di> range = add(sizes[i]);
+        if(!range) {
+            _layers = layers;
+            return {};
+        }
+
+        out[i] = *range;
+    }
+
+    return out;
+}
+
+void AtlasArrayPacker::clear() {
+    _layers.clear();
+}
+
+std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
+    if(sizes.empty()) return {};
+
+    std::vector<Range2Di> atlas = AtlasPacker{atlasSize, padding}.add(sizes);
+    if(atlas.empty()) {
+        Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
+                << "is too small to fit" << sizes.size() << "textures with padding"
+                << padding << Debug::nospace << ". Generated atlas will be empty.";
+    }
 
     return atlas;
 }
@@ -26,17 +26,277 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::TextureTools::atlas()
+ * @brief Class @ref Magnum::TextureTools::AtlasPacker, @ref Magnum::TextureTools::AtlasArrayPacker, function @ref Magnum::TextureTools::atlas()
  */
 
 #include <vector>
+#include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Optional.h>
 
 #include "Magnum/Magnum.h"
-#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/TextureTools/visibility.h"
 
 namespace Magnum { namespace TextureTools {
 
+/**
+@brief Incremental texture atlas packer
+
+Packs rectangles into a texture of given size using the skyline bottom-left
+algorithm. The packer keeps track of the top edge of already placed rectangles
+(the "skyline") and puts each new rectangle at the position where its top edge
+ends up lowest, which keeps the wasted space low even for rectangles of very
+different sizes. Rectangles can be added one by one with @ref add(const Vector2i&)
+as they come, for example when new glyphs are requested from a glyph cache, or
+in a batch with @ref add(const std::vector<Vector2i>&), which sorts them by
+height first for a tighter packing.
+
+@code{.cpp}
+TextureTools::AtlasPacker packer{{512, 512}, {1, 1},
+    TextureTools::AtlasPacker::Flag::AllowRotation};
+
+Containers::Optional<Range2Di> range = packer.add({24, 36});
+if(!range) {
+    // the atlas is full
+}
+
+Debug{} << "Atlas is" << packer.occupancy()*100.0f << "% full";
+@endcode
+
+With @ref Flag::AllowRotation the packer can rotate the rectangles by 90°
+if that results in a better placement. The returned ranges then have the X
+and Y size swapped compared to the requested size. The padding is always
+applied in the atlas space, i.e. after the rotation. The CPU-side atlas can
+be assembled from the individual images using
+@ref TiledImage2D::setSubImage(), which rotates the image accordingly.
+
+@see @ref AtlasArrayPacker, @ref atlas()
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasPacker {
+    public:
+        /**
+         * @brief Packing flag
+         *
+         * @see @ref Flags, @ref AtlasPacker()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Allow rotating the rectangles by 90° if it leads to a better
+             * placement.
+             */
+            AllowRotation = 1 << 0
+        };
+
+        /**
+         * @brief Packing flags
+         *
+         * @see @ref AtlasPacker()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /**
+         * @brief Constructor
+         * @param size      Atlas size
+         * @param padding   Padding around each rectangle
+         * @param flags     Packing flags
+         *
+         * Padding is added twice to each size and the rectangles are placed
+         * so the padding doesn't overlap. Returned ranges are without the
+         * padding.
+         */
+        explicit AtlasPacker(const Vector2i& size, const Vector2i& padding = {}, Flags flags = {});
+
+        /** @brief Atlas size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Padding around each rectangle */
+        Vector2i padding() const { return _padding; }
+
+        /** @brief Packing flags */
+        Flags flags() const { return _flags; }
+
+        /** @brief Count of packed rectangles */
+        std::size_t count() const { return _count; }
+
+        /**
+         * @brief Size of the filled area
+         *
+         * Bounding size of all rectangles packed so far, including the
+         * padding. Can be used to crop the atlas texture if it ended up
+         * being larger than necessary.
+         */
+        Vector2i filledSize() const { return _filledSize; }
+
+        /**
+         * @brief Atlas occupancy
+         *
+         * Ratio of the area covered by the packed rectangles (without the
+         * padding) to the total atlas area, in range @f$ [0, 1] @f$.
+         */
+        Float occupancy() const;
+
+        /**
+         * @brief Add a rectangle
+         *
+         * Returns the range where the rectangle was placed or
+         * @ref Containers::NullOpt if it doesn't fit, in which case the
+         * packer state isn't modified.
+         */
+        Containers::Optional<Range2Di> add(const Vector2i& size);
+
+        /**
+         * @brief Add a batch of rectangles
+         *
+         * The rectangles are placed in order of decreasing height, which
+         * usually results in tighter packing than adding them one by one.
+         * Returns ranges in the same order as @p sizes or an empty vector if
+         * they don't fit all, in which case the packer state isn't modified.
+         */
+        std::vector<Range2Di> add(const std::vector<Vector2i>& sizes);
+
+        /**
+         * @brief Clear the atlas
+         *
+         * Removes all packed rectangles, keeping the size, padding and flags.
+         */
+        void clear();
+
+    private:
+        struct Node {
+            Int x, y, width;
+        };
+
+        Int fit(std::size_t node, const Vector2i& size) const;
+        void insert(std::size_t node, const Vector2i& position, const Vector2i& size);
+
+        Vector2i _size, _padding;
+        Flags _flags;
+        std::size_t _count;
+        std::size_t _usedArea;
+        Vector2i _filledSize;
+        std::vector<Node> _skyline;
+};
+
+CORRADE_ENUMSET_OPERATORS(AtlasPacker::Flags)
+
+/** @debugoperatorclassenum{AtlasPacker,AtlasPacker::Flag} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, AtlasPacker::Flag value);
+
+/** @debugoperatorclassenum{AtlasPacker,AtlasPacker::Flags} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, AtlasPacker::Flags value);
+
+/**
+@brief Incremental texture array atlas packer
+
+Packs rectangles into layers of a texture array, each layer packed with a
+separate @ref AtlasPacker. A rectangle is put into the first layer it fits
+into, a new layer is opened only if it doesn't fit into any of the existing
+ones. Useful for packing many small images, such as sprites, into a single
+@ref GL::Texture2DArray, which can then be drawn with a single draw call. The
+returned ranges have the layer in the Z coordinate, so the min can be
+directly used as an offset in @ref GL::Texture2DArray::setSubImage():
+
+@code{.cpp}
+TextureTools::AtlasArrayPacker packer{{1024, 1024}, 16, {1, 1}};
+
+GL::Texture2DArray texture;
+texture.setStorage(1, GL::TextureFormat::RGBA8, {1024, 1024, 16});
+
+for(const Trade::ImageData2D& image: images) {
+    Containers::Optional<Range3Di> range = packer.add(image.size());
+    if(!range) {
+        // all layers are full
+    }
+
+    texture.setSubImage(0, range->min(), ImageView3D{image.format(),
+        image.type(), {image.size(), 1}, image.data()});
+}
+@endcode
+
+@see @ref Shaders::SpriteBatch
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasArrayPacker {
+    public:
+        /**
+         * @brief Constructor
+         * @param size          Size of each layer
+         * @param maxLayerCount Max count of layers
+         * @param padding       Padding around each rectangle
+         * @param flags         Packing flags
+         *
+         * No layers are opened initially. See @ref AtlasPacker::AtlasPacker()
+         * for more information about the @p padding and @p flags.
+         */
+        explicit AtlasArrayPacker(const Vector2i& size, Int maxLayerCount, const Vector2i& padding = {}, AtlasPacker::Flags flags = {});
+
+        /** @brief Size of each layer */
+        Vector2i size() const { return _size; }
+
+        /** @brief Max count of layers */
+        Int maxLayerCount() const { return _maxLayerCount; }
+
+        /** @brief Padding around each rectangle */
+        Vector2i padding() const { return _padding; }
+
+        /** @brief Packing flags */
+        AtlasPacker::Flags flags() const { return _flags; }
+
+        /**
+         * @brief Count of opened layers
+         *
+         * Layers are opened on demand, so this is the count of layers that
+         * contain at least one rectangle. Always at most
+         * @ref maxLayerCount().
+         */
+        Int layerCount() const { return _layers.size(); }
+
+        /**
+         * @brief Layer packer
+         *
+         * Expects that @p id is less than @ref layerCount(). Can be used to
+         * query occupancy and filled size of particular layers.
+         */
+        const AtlasPacker& layer(Int id) const;
+
+        /** @brief Count of packed rectangles in all layers */
+        std::size_t count() const;
+
+        /**
+         * @brief Add a rectangle
+         *
+         * Returns the range where the rectangle was placed, with the layer
+         * in the Z coordinate and Z size being @cpp 1 @ce, or
+         * @ref Containers::NullOpt if it doesn't fit into any existing layer
+         * and no more layers can be opened, in which case the packer state
+         * isn't modified.
+         */
+        Containers::Optional<Range3Di> add(const Vector2i& size);
+
+        /**
+         * @brief Add a batch of rectangles
+         *
+         * The rectangles are placed in order of decreasing height, which
+         * usually results in tighter packing than adding them one by one.
+         * Returns ranges in the same order as @p sizes or an empty vector if
+         * they don't fit all, in which case the packer state isn't modified.
+         */
+        std::vector<Range3Di> add(const std::vector<Vector2i>& sizes);
+
+        /**
+         * @brief Clear the atlas
+         *
+         * Removes all packed rectangles and closes all layers, keeping the
+         * size, max layer count, padding and flags.
+         */
+        void clear();
+
+    private:
+        Vector2i _size, _padding;
+        AtlasPacker::Flags _flags;
+        Int _maxLayerCount;
+        std::vector<AtlasPacker> _layers;
+};
+
 /**
 @brief Pack textures into texture atlas
 @param atlasSize    Size of resulting atlas
@@ -49,6 +309,10 @@ into required size, empty vector is returned.
 Padding is added twice to each size and the atlas is laid out so the padding
 don't overlap. Returned sizes are the same as original sizes, i.e. without the
 padding.
+
+This is a convenience wrapper around @ref AtlasPacker::add(const std::vector<Vector2i>&),
+use @ref AtlasPacker directly if you need to add textures incrementally,
+allow rotation or query the resulting occupancy.
 */
 std::vector<Range2Di> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i());
 
@@ -0,0 +1,278 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DepthPyramid.h"
+
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector4.h"
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+static void importTextureToolResources() {
+    CORRADE_RESOURCE_INITIALIZE(MagnumTextureTools_RCS)
+}
+#endif
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Range of source pixels covered by given destination pixel, the same as
+   in the shader */
+inline std::pair<Vector2i, Vector2i> coveredPixels(const Vector2i& coordinates, const Vector2i& sourceSize, const Vector2i& destinationSize) {
+    return {coordinates*sourceSize/destinationSize,
+        ((coordinates + Vector2i{1})*sourceSize + destinationSize - Vector2i{1})/destinationSize};
+}
+
+}
+
+UnsignedInt depthPyramidLevelCount(const Vector2i& size) {
+    CORRADE_ASSERT(size.product(),
+        "TextureTools::depthPyramidLevelCount(): expected non-empty size but got" << size, 0);
+    return Math::log2(UnsignedInt(size.max())) + 1;
+}
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+namespace {
+
+class DepthPyramidShader: public GL::AbstractShaderProgram {
+    public:
+        explicit DepthPyramidShader(bool depthInput);
+
+        DepthPyramidShader& setDestinationSize(const Vector2i& size) {
+            setUniform(destinationSizeUniform, size);
+            return *this;
+        }
+
+        DepthPyramidShader& bindTexture(GL::Texture2D& texture) {
+            texture.bind(TextureUnit);
+            return *this;
+        }
+
+    private:
+        /* Same as in the distance field shader */
+        enum: Int { TextureUnit = 7 };
+
+        Int destinationSizeUniform{0};
+};
+
+DepthPyramidShader::DepthPyramidShader(const bool depthInput) {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumTextureTools"))
+        importTextureToolResources();
+    #endif
+    Utility::Resource rs("MagnumTextureTools");
+
+    #ifndef MAGNUM_TARGET_GLES
+    const GL::Version v = GL::Context::current().supportedVersion({GL::Version::GL320, GL::Version::GL300});
+    #else
+    const GL::Version v = GL::Version::GLES300;
+    #endif
+
+    GL::Shader vert = Shaders::Implementation::createCompatibilityShader(rs, v, GL::Shader::Type::Vertex);
+    GL::Shader frag = Shaders::Implementation::createCompatibilityShader(rs, v, GL::Shader::Type::Fragment);
+
+    /* The vertex shader does nothing except calling fullScreenTriangle(), so
+       it's shared with the distance field shader */
+    vert.addSource(rs.get("FullScreenTriangle.glsl"))
+        .addSource(rs.get("DistanceFieldShader.vert"));
+    frag.addSource(depthInput ? "#define DEPTH_INPUT\n" : "")
+        .addSource(rs.get("DepthPyramidShader.frag"));
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+
+    attachShaders({vert, frag});
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>())
+    #endif
+    {
+        destinationSizeUniform = uniformLocation("destinationSize");
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>())
+    #endif
+    {
+        setUniform(uniformLocation("sourceTexture"), TextureUnit);
+    }
+}
+
+}
+
+std::vector<Image2D> depthPyramid(GL::Texture2D& depth, GL::Texture2D& output, const Vector2i& size, const UnsignedInt readbackLevelCount) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::framebuffer_object);
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    #endif
+
+    const UnsignedInt levelCount = depthPyramidLevelCount(size);
+    CORRADE_ASSERT(readbackLevelCount <= levelCount,
+        "TextureTools::depthPyramid(): can't read back" << readbackLevelCount << "levels from a pyramid of" << levelCount, {});
+
+    /** @todo Disable blending and then enable it back (if was previously) */
+
+    DepthPyramidShader copyShader{true};
+    DepthPyramidShader reduceShader{false};
+
+    /* The positions are generated from gl_VertexID, so there's no buffer */
+    GL::Mesh mesh;
+    mesh.setPrimitive(GL::MeshPrimitive::Triangles)
+        .setCount(3);
+
+    std::vector<Image2D> levels;
+    levels.reserve(readbackLevelCount);
+    for(UnsignedInt level = 0; level != levelCount; ++level) {
+        const Vector2i levelSize = Math::max(size >> Int(level), Vector2i{1});
+
+        GL::Framebuffer framebuffer{{{}, levelSize}};
+        framebuffer.attachTexture(GL::Framebuffer::ColorAttachment(0), output, level);
+        framebuffer.bind();
+
+        const GL::Framebuffer::Status status = framebuffer.checkStatus(GL::FramebufferTarget::Draw);
+        if(status != GL::Framebuffer::Status::Complete) {
+            Error() << "TextureTools::depthPyramid(): cannot render to given output texture, unexpected framebuffer status"
+                    << status;
+            output.setBaseLevel(0)
+                .setMaxLevel(levelCount - 1);
+            return {};
+        }
+
+        if(level == 0) {
+            copyShader.setDestinationSize(levelSize)
+                .bindTexture(depth);
+            mesh.draw(copyShader);
+        } else {
+            /* Restrict sampling to the previous level so it doesn't form a
+               feedback loop with the level being rendered to */
+            output.setBaseLevel(level - 1)
+                .setMaxLevel(level - 1);
+            reduceShader.setDestinationSize(levelSize)
+                .bindTexture(output);
+            mesh.draw(reduceShader);
+        }
+
+        if(level < levelCount - readbackLevelCount) continue;
+
+        /* RG float readback is not guaranteed in ES, only RGBA, so read four
+           components and pick the first two */
+        #ifndef MAGNUM_TARGET_GLES
+        levels.push_back(framebuffer.read({{}, levelSize}, {PixelFormat::RG32F}));
+        #else
+        Image2D rgba = framebuffer.read({{}, levelSize}, {PixelFormat::RGBA32F});
+        const Vector4* const in = rgba.data<Vector4>();
+        Containers::Array<char> data{Containers::NoInit, std::size_t(levelSize.product())*sizeof(Vector2)};
+        Vector2* const out = reinterpret_cast<Vector2*>(data.data());
+        for(std::size_t i = 0, iMax = levelSize.product(); i != iMax; ++i)
+            out[i] = in[i].xy();
+        levels.emplace_back(PixelFormat::RG32F, levelSize, std::move(data));
+        #endif
+    }
+
+    output.setBaseLevel(0)
+        .setMaxLevel(levelCount - 1);
+
+    return levels;
+}
+#endif
+
+std::vector<Image2D> depthPyramid(const ImageView2D& depth) {
+    CORRADE_ASSERT(depth.format() == PixelFormat::R32F,
+        "TextureTools::depthPyramid(): expected" << PixelFormat::R32F << "but got" << depth.format(), {});
+    CORRADE_ASSERT(depth.size().product(),
+        "TextureTools::depthPyramid(): expected non-empty image", {});
+
+    const Vector2i size = depth.size();
+    const UnsignedInt levelCount = depthPyramidLevelCount(size);
+    std::vector<Image2D> levels;
+    levels.reserve(levelCount);
+
+    /* First level is the depth in both channels. Eight-byte pixels are always
+       aligned to four bytes, so the output rows are tightly packed. */
+    {
+        const char* const inputData = depth.data() + std::get<0>(depth.dataProperties()).sum();
+        const std::size_t inputRowStride = std::get<1>(depth.dataProperties()).x();
+        Containers::Array<char> data{Containers::NoInit, std::size_t(size.product())*sizeof(Vector2)};
+        Vector2* const out = reinterpret_cast<Vector2*>(data.data());
+        for(Int y = 0; y != size.y(); ++y) {
+            const Float* const row = reinterpret_cast<const Float*>(inputData + y*inputRowStride);
+            for(Int x = 0; x != size.x(); ++x)
+                out[y*size.x() + x] = Vector2{row[x]};
+        }
+
+        levels.emplace_back(PixelFormat::RG32F, size, std::move(data));
+    }
+
+    /* Each following level is the min/max of the covered pixels */
+    for(UnsignedInt level = 1; level != levelCount; ++level) {
+        const Vector2i sourceSize = levels.back().size();
+        const Vector2i levelSize = Math::max(size >> Int(level), Vector2i{1});
+        const Vector2* const in = levels.back().data<Vector2>();
+        Containers::Array<char> data{Containers::NoInit, std::size_t(levelSize.product())*sizeof(Vector2)};
+        Vector2* const out = reinterpret_cast<Vector2*>(data.data());
+        for(Int y = 0; y != levelSize.y(); ++y) {
+            for(Int x = 0; x != levelSize.x(); ++x) {
+                const std::pair<Vector2i, Vector2i> range = coveredPixels({x, y}, sourceSize, levelSize);
+                Vector2 value = in[range.first.y()*sourceSize.x() + range.first.x()];
+                for(Int sy = range.first.y(); sy != range.second.y(); ++sy) {
+                    for(Int sx = range.first.x(); sx != range.second.x(); ++sx) {
+                        const Vector2& texel = in[sy*sourceSize.x() + sx];
+                        value = {Math::min(value.x(), texel.x()),
+                                 Math::max(value.y(), texel.y())};
+                    }
+                }
+                out[y*levelSize.x() + x] = value;
+            }
+        }
+
+        levels.emplace_back(PixelFormat::RG32F, levelSize, std::move(data));
+    }
+
+    return levels;
+}
+
+}}
@@ -0,0 +1,144 @@
+#ifndef Magnum_TextureTools_DepthPyramid_h
+#define Magnum_TextureTools_DepthPyramid_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::depthPyramid(), @ref Magnum::TextureTools::depthPyramidLevelCount()
+ */
+
+#include <vector>
+
+#include "Magnum/configure.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/TextureTools/visibility.h"
+
+#ifdef MAGNUM_TARGET_GL
+#include "Magnum/GL/GL.h"
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Depth pyramid level count
+
+Count of levels needed for a full depth pyramid of given @p size, i.e. down
+to a single pixel. Expects that @p size is non-zero.
+@see @ref depthPyramid()
+*/
+UnsignedInt MAGNUM_TEXTURETOOLS_EXPORT depthPyramidLevelCount(const Vector2i& size);
+
+#if (defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)) || defined(DOXYGEN_GENERATING_OUTPUT)
+/**
+@brief Build a hierarchical depth pyramid
+@param depth        Input depth texture
+@param output       Output texture
+@param size         Size of @p depth and of the first level of @p output
+@param readbackLevelCount  How many of the smallest levels to read back
+@return The last @p readbackLevelCount levels of @p output in
+    @ref PixelFormat::RG32F, ordered from the largest to the smallest
+
+Renders a min/max depth pyramid of @p depth into all levels of @p output. The
+first level contains the depth values in both the red and the green channel,
+each following level has both dimensions halved and rounded down, but not
+smaller than one pixel. Its red channel contains the nearest and the green
+channel the farthest depth of the pixels it covers in the previous level.
+For odd sizes the last row and column is folded into the neighboring pixels,
+so the pyramid stays conservative. The farthest depth is what's needed for
+occlusion culling, for example with @ref Shaders::IndirectCulling, the
+nearest depth is useful for depth-aware downsampling or for the reversed
+depth test.
+
+The @p output texture is expected to have @ref GL::TextureFormat::RG32F
+format and @ref depthPyramidLevelCount() levels. To sample the result with
+@glsl texelFetch() @ce or with nearest filtering, it needs to be set up like
+this:
+
+@code{.cpp}
+GL::Texture2D pyramid;
+pyramid.setStorage(TextureTools::depthPyramidLevelCount(size),
+        GL::TextureFormat::RG32F, size)
+    .setMinificationFilter(GL::SamplerFilter::Nearest, GL::SamplerMipmap::Nearest)
+    .setMagnificationFilter(GL::SamplerFilter::Nearest)
+    .setWrapping(GL::SamplerWrapping::ClampToEdge);
+
+std::vector<Image2D> lowres = TextureTools::depthPyramid(depth, pyramid, size, 4);
+@endcode
+
+The @p depth texture can be the depth attachment of a framebuffer, it's
+expected to have @ref GL::SamplerCompareMode::None compare mode, which is the
+default. Depth renderbuffers can't be sampled, blit them into a texture
+first. The levels are rendered using a single full-screen triangle, the same
+way as in @ref MeshTools::fullScreenTriangle(), one pass per level.
+
+The read back levels are useful for occlusion tests on the CPU, e.g. for the
+coarse early-out before submitting draws, while the full @p output stays on
+the GPU. If @p readbackLevelCount is @cpp 0 @ce, nothing is read back and the
+function doesn't stall the pipeline.
+
+@attention This is GPU implementation, so it expects active context. See
+    @ref depthPyramid(const ImageView2D&) for a CPU implementation that can be
+    used without a GPU.
+
+@note If the @p output texture is not renderable, this function prints a
+    message to error output and returns an empty vector. In OpenGL ES 3.0
+    rendering to @ref GL::TextureFormat::RG32F requires
+    @gl_extension{EXT,color_buffer_float}.
+
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+
+@requires_gl30 Extension @gl_extension{ARB,framebuffer_object} and
+    @gl_extension{EXT,gpu_shader4} for @glsl texelFetch() @ce
+@requires_gles30 Integer texel fetch is not available in OpenGL ES 2.0.
+@requires_webgl20 Integer texel fetch is not available in WebGL 1.0.
+*/
+std::vector<Image2D> MAGNUM_TEXTURETOOLS_EXPORT depthPyramid(GL::Texture2D& depth, GL::Texture2D& output, const Vector2i& size, UnsignedInt readbackLevelCount = 0);
+#endif
+
+/**
+@brief Build a hierarchical depth pyramid on the CPU
+@param depth        Input depth image
+
+CPU variant of @ref depthPyramid(GL::Texture2D&, GL::Texture2D&, const Vector2i&, UnsignedInt)
+that doesn't need any GPU context, useful for software occlusion culling on
+a low-resolution depth buffer. Expects that @p depth is
+@ref PixelFormat::R32F and non-empty. Returns all
+@ref depthPyramidLevelCount() levels in @ref PixelFormat::RG32F with default
+@ref PixelStorage parameters, with the nearest depth in the red and the
+farthest depth in the green channel, computed the same way as by the GPU
+implementation.
+
+@code{.cpp}
+std::vector<Image2D> pyramid = TextureTools::depthPyramid(depth);
+@endcode
+*/
+std::vector<Image2D> MAGNUM_TEXTURETOOLS_EXPORT depthPyramid(const ImageView2D& depth);
+
+}}
+
+#endif
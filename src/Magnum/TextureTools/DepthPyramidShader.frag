@@ -0,0 +1,74 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef RUNTIME_CONST
+#define const
+#endif
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 0) uniform ivec2 destinationSize;
+#else
+uniform highp ivec2 destinationSize;
+#endif
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 7) uniform highp sampler2D sourceTexture;
+#else
+uniform highp sampler2D sourceTexture;
+#endif
+
+out highp vec2 minMax;
+
+/* Depth input has just one channel, that's both the min and the max */
+highp vec2 minMaxAt(const highp ivec2 position) {
+    #ifdef DEPTH_INPUT
+    return texelFetch(sourceTexture, position, 0).rr;
+    #else
+    return texelFetch(sourceTexture, position, 0).rg;
+    #endif
+}
+
+void main() {
+    const highp ivec2 coordinates = ivec2(gl_FragCoord.xy);
+
+    /* Source pixels covered by the destination pixel. Usually a 2x2 block,
+       but for odd source sizes the last row / column gets folded into the
+       neighboring block so the result stays conservative. When copying the
+       depth buffer to the first level, it's just a single pixel. The
+       sampled level is the base level, set by the caller. */
+    const highp ivec2 sourceSize = textureSize(sourceTexture, 0);
+    const highp ivec2 begin = coordinates*sourceSize/destinationSize;
+    const highp ivec2 end = ((coordinates + ivec2(1))*sourceSize + destinationSize - ivec2(1))/destinationSize;
+
+    highp vec2 value = minMaxAt(begin);
+    for(highp int y = begin.y; y < end.y; ++y) {
+        for(highp int x = begin.x; x < end.x; ++x) {
+            const highp vec2 texel = minMaxAt(ivec2(x, y));
+            value = vec2(min(value.x, texel.x), max(value.y, texel.y));
+        }
+    }
+
+    minMax = value;
+}
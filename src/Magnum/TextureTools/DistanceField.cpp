@@ -25,9 +25,22 @@
 
 #include "DistanceField.h"
 
+#include <cmath>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/TextureTools/TiledImage.h"
+
+#ifdef MAGNUM_TARGET_GL
 #include <Corrade/Utility/Resource.h>
 
-#include "Magnum/Math/Range.h"
 #include "Magnum/GL/AbstractShaderProgram.h"
 #include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Context.h"
@@ -43,9 +56,11 @@ static void importTextureToolResources() {
     CORRADE_RESOURCE_INITIALIZE(MagnumTextureTools_RCS)
 }
 #endif
+#endif
 
 namespace Magnum { namespace TextureTools {
 
+#ifdef MAGNUM_TARGET_GL
 namespace {
 
 class DistanceFieldShader: public GL::AbstractShaderProgram {
@@ -214,4 +229,169 @@ void distanceField(GL::Texture2D& input, GL::Texture2D& output, const Range2Di&
     mesh.draw(shader);
 }
 
+#endif
+
+namespace {
+
+/* One-dimensional squared distance transform of n samples of f, writes the
+   lower envelope of parabolas rooted at the samples to d. The v and z arrays
+   are scratch memory for n and n + 1 items. */
+void distanceTransform(const Float* const f, const Int n, Float* const d, Int* const v, Double* const z) {
+    /* Intersection of parabolas rooted at q and p */
+    const auto intersection = [f](const Int q, const Int p) {
+        return ((Double(f[q]) + Double(q)*q) - (Double(f[p]) + Double(p)*p))/(2.0*(q - p));
+    };
+
+    Int k = 0;
+    v[0] = 0;
+    z[0] = -Math::Constants<Double>::inf();
+    z[1] = +Math::Constants<Double>::inf();
+    for(Int q = 1; q < n; ++q) {
+        Double s = intersection(q, v[k]);
+        while(s <= z[k]) s = intersection(q, v[--k]);
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = +Math::Constants<Double>::inf();
+    }
+
+    k = 0;
+    for(Int q = 0; q < n; ++q) {
+        while(z[k + 1] < q) ++k;
+        d[q] = Float((q - v[k])*(q - v[k])) + f[v[k]];
+    }
+}
+
+/* Columns and rows processed by a single task */
+constexpr std::size_t TaskSize = 32;
+
+template<class IsInside> Image2D distanceFieldImplementation(const Vector2i& inputSize, const IsInside& isInside, const Vector2i& size, const Int radius, UnsignedInt threadCount) {
+    if(!threadCount) threadCount = 1;
+
+    /* Input pixels sampled by the output, the same as in the shader */
+    const Vector2 scaling = Vector2{inputSize}/Vector2{size};
+    Containers::Array<Int> columns{std::size_t(size.x())};
+    Containers::Array<Int> rows{std::size_t(size.y())};
+    for(Int x = 0; x != size.x(); ++x) columns[x] = Int(x*scaling.x());
+    for(Int y = 0; y != size.y(); ++y) rows[y] = Int(y*scaling.y());
+
+    /* Distances larger than the radius are clamped in the output, so there's
+       no need to have anything larger. This keeps the values small enough to
+       be exact in a float. */
+    const Float maxDistanceSquared = Float((radius + 1)*(radius + 1));
+
+    /* Squared distances to nearest inside and outside pixel in the same
+       column, only for rows that are sampled by the output */
+    Containers::Array<Float> insideColumns{Containers::NoInit, std::size_t(size.y()*inputSize.x())};
+    Containers::Array<Float> outsideColumns{Containers::NoInit, std::size_t(size.y()*inputSize.x())};
+    Magnum::Implementation::parallelFor(threadCount, (inputSize.x() + TaskSize - 1)/TaskSize, [&](const std::size_t task) {
+        const Int n = inputSize.y();
+        const Int begin = Int(task*TaskSize);
+        const Int end = Math::min(Int((task + 1)*TaskSize), inputSize.x());
+        const std::size_t width = end - begin;
+        Containers::Array<Float> inside{Containers::NoInit, width*n};
+        Containers::Array<Float> outside{Containers::NoInit, width*n};
+        Containers::Array<Float> insideSampled{Containers::NoInit, width*size.y()};
+        Containers::Array<Float> outsideSampled{Containers::NoInit, width*size.y()};
+        Containers::Array<Float> d{Containers::NoInit, std::size_t(n)};
+        Containers::Array<Int> v{Containers::NoInit, std::size_t(n)};
+        Containers::Array<Double> z{Containers::NoInit, std::size_t(n + 1)};
+
+        /* Gather the whole strip of columns row by row, so the input is read
+           in short contiguous runs (or tile by tile) instead of striding
+           through the whole image for each column */
+        for(Int y = 0; y != n; ++y) {
+            for(Int x = begin; x < end; ++x) {
+                const bool in = isInside(x, y);
+                inside[(x - begin)*n + y] = in ? 0.0f : maxDistanceSquared;
+                outside[(x - begin)*n + y] = in ? maxDistanceSquared : 0.0f;
+            }
+        }
+
+        for(std::size_t i = 0; i != width; ++i) {
+            distanceTransform(inside + i*n, n, d, v, z);
+            for(Int y = 0; y != size.y(); ++y)
+                insideSampled[i*size.y() + y] = Math::min(d[rows[y]], maxDistanceSquared);
+            distanceTransform(outside + i*n, n, d, v, z);
+            for(Int y = 0; y != size.y(); ++y)
+                outsideSampled[i*size.y() + y] = Math::min(d[rows[y]], maxDistanceSquared);
+        }
+
+        /* Scatter the results back row by row as well */
+        for(Int y = 0; y != size.y(); ++y) {
+            for(std::size_t i = 0; i != width; ++i) {
+                insideColumns[y*inputSize.x() + begin + i] = insideSampled[i*size.y() + y];
+                outsideColumns[y*inputSize.x() + begin + i] = outsideSampled[i*size.y() + y];
+            }
+        }
+    });
+
+    /* Output with default pixel storage */
+    const std::size_t outputRowStride = (size.x() + 3)/4*4;
+    Containers::Array<char> data{Containers::ValueInit, outputRowStride*size.y()};
+
+    /* Transform the sampled rows and output the distance to nearest pixel of
+       opposite color, normalized from [-radius-1, radius+1] to [0, 1] */
+    const Float normalization = 1.0f/Float(radius*2 + 2);
+    Magnum::Implementation::parallelFor(threadCount, (size.y() + TaskSize - 1)/TaskSize, [&](const std::size_t task) {
+        const Int n = inputSize.x();
+        Containers::Array<Float> inside{Containers::NoInit, std::size_t(n)};
+        Containers::Array<Float> outside{Containers::NoInit, std::size_t(n)};
+        Containers::Array<Int> v{Containers::NoInit, std::size_t(n)};
+        Containers::Array<Double> z{Containers::NoInit, std::size_t(n + 1)};
+
+        const Int end = Math::min(Int((task + 1)*TaskSize), size.y());
+        for(Int y = Int(task*TaskSize); y < end; ++y) {
+            distanceTransform(insideColumns.data() + y*n, n, inside, v, z);
+            distanceTransform(outsideColumns.data() + y*n, n, outside, v, z);
+
+            char* const row = data.data() + y*outputRowStride;
+            for(Int x = 0; x != size.x(); ++x) {
+                const Int column = columns[x];
+                const bool in = isInside(column, rows[y]);
+                const Float distance = std::sqrt(Math::min(in ? outside[column] : inside[column], maxDistanceSquared));
+                const Float value = (in ? distance : -distance)*normalization + 0.5f;
+                row[x] = char(UnsignedByte(value*255.0f + 0.5f));
+            }
+        }
+    });
+
+    return Image2D{PixelFormat::R8Unorm, size, std::move(data)};
+}
+
+bool isSupportedFormat(const PixelFormat format) {
+    return format == PixelFormat::R8Unorm ||
+           format == PixelFormat::RG8Unorm ||
+           format == PixelFormat::RGB8Unorm ||
+           format == PixelFormat::RGBA8Unorm;
+}
+
+}
+
+Image2D distanceField(const ImageView2D& input, const Vector2i& size, const Int radius, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(input.size().product() && size.product(),
+        "TextureTools::distanceField(): expected non-empty input and output size but got" << input.size() << "and" << size, Image2D{PixelFormat::R8Unorm});
+    CORRADE_ASSERT(isSupportedFormat(input.format()),
+        "TextureTools::distanceField(): unsupported pixel format" << input.format(), Image2D{PixelFormat::R8Unorm});
+
+    const char* const inputData = input.data() + std::get<0>(input.dataProperties()).sum();
+    const std::size_t inputRowStride = std::get<1>(input.dataProperties()).x();
+    const std::size_t pixelSize = input.pixelSize();
+    return distanceFieldImplementation(input.size(), [&](const Int x, const Int y) {
+        return UnsignedByte(inputData[y*inputRowStride + x*pixelSize]) > 127;
+    }, size, radius, threadCount);
+}
+
+Image2D distanceField(const TiledImage2D& input, const Vector2i& size, const Int radius, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(input.size().product() && size.product(),
+        "TextureTools::distanceField(): expected non-empty input and output size but got" << input.size() << "and" << size, Image2D{PixelFormat::R8Unorm});
+    CORRADE_ASSERT(isSupportedFormat(input.format()),
+        "TextureTools::distanceField(): unsupported pixel format" << input.format(), Image2D{PixelFormat::R8Unorm});
+
+    const char* const inputData = input.data();
+    return distanceFieldImplementation(input.size(), [&](const Int x, const Int y) {
+        return UnsignedByte(inputData[input.pixelOffset({x, y})]) > 127;
+    }, size, radius, threadCount);
+}
+
 }}
@@ -30,17 +30,20 @@
  */
 
 #include "Magnum/configure.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/TextureTools/visibility.h"
 
 #ifdef MAGNUM_TARGET_GL
-#include "Magnum/Magnum.h"
 #include "Magnum/GL/GL.h"
-#ifndef MAGNUM_TARGET_GLES
-#include "Magnum/Math/Vector2.h"
 #endif
-#include "Magnum/TextureTools/visibility.h"
 
 namespace Magnum { namespace TextureTools {
 
+class TiledImage2D;
+
+#if defined(MAGNUM_TARGET_GL) || defined(DOXYGEN_GENERATING_OUTPUT)
+
 /**
 @brief Create signed distance field
 @param input        Input texture
@@ -84,7 +87,9 @@ Based on: *Chris Green - Improved Alpha-Tested Magnification for Vector Textures
 and Special Effects, SIGGRAPH 2007,
 http://www.valvesoftware.com/publications/2007/SIGGRAPH2007_AlphaTestedMagnification.pdf*
 
-@attention This is GPU-only implementation, so it expects active context.
+@attention This is GPU implementation, so it expects active context. See
+    @ref distanceField(const ImageView2D&, const Vector2i&, Int, UnsignedInt)
+    for a CPU implementation that can be used without a GPU.
 
 @note If internal format of @p output texture is not renderable, this function
     prints message to error output and does nothing. In desktop OpenGL and
@@ -107,10 +112,56 @@ void MAGNUM_TEXTURETOOLS_EXPORT distanceField(GL::Texture2D& input, GL::Texture2
 #else
 void MAGNUM_TEXTURETOOLS_EXPORT distanceField(GL::Texture2D& input, GL::Texture2D& output, const Range2Di& rectangle, Int radius, const Vector2i& imageSize);
 #endif
+#endif
+
+/**
+@brief Create signed distance field on the CPU
+@param input        Input image
+@param size         Output image size
+@param radius       Max lookup radius in input image
+@param threadCount  Thread count used for the computation, including the
+    calling thread. Value of @cpp 0 @ce is treated the same as @cpp 1 @ce.
+
+CPU variant of @ref distanceField(GL::Texture2D&, GL::Texture2D&, const Range2Di&, Int, const Vector2i&)
+that doesn't need any GPU context, useful for offline processing on headless
+machines. Converts binary image stored in the first channel of @p input to a
+@ref PixelFormat::R8Unorm signed distance field of given @p size, with the
+same value mapping as the GPU implementation, so the output can be used
+interchangeably. Supported input formats are @ref PixelFormat::R8Unorm,
+@ref PixelFormat::RG8Unorm, @ref PixelFormat::RGB8Unorm and
+@ref PixelFormat::RGBA8Unorm, pixels with value larger than @cpp 127 @ce are
+treated as inside. Pixels outside of the input image are ignored.
+
+Instead of looking at the whole @p radius area around each pixel, exact
+Euclidean distance transform of the whole input is computed in linear time
+using the algorithm by Felzenszwalb and Huttenlocher, first for all columns
+and then for all rows that are sampled by the output, with the columns and rows
+distributed among threads. Multithreaded computation is not available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where @p threadCount is ignored.
+
+@code{.cpp}
+Image2D output = TextureTools::distanceField(image, {256, 256}, 24,
+    std::thread::hardware_concurrency());
+@endcode
+
+Based on: *Pedro F. Felzenszwalb, Daniel P. Huttenlocher - Distance
+Transforms of Sampled Functions, Theory of Computing 8, 2012,
+http://dx.doi.org/10.4086/toc.2012.v008a019*
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT distanceField(const ImageView2D& input, const Vector2i& size, Int radius, UnsignedInt threadCount = 1);
+
+/**
+@brief Create signed distance field on the CPU from a tiled image
+
+Same as @ref distanceField(const ImageView2D&, const Vector2i&, Int, UnsignedInt),
+but reading the input from a @ref TiledImage2D. The column pass reads strips
+of 32 columns row by row, which for a linear image means short contiguous
+runs in each row, but for a tiled image with the same or larger tile size the
+whole strip stays inside one tile column. Prefer this variant for very large
+inputs, where the linear rows don't fit into the cache.
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT distanceField(const TiledImage2D& input, const Vector2i& size, Int radius, UnsignedInt threadCount = 1);
 
 }}
-#else
-#error this header is available only in the OpenGL build
-#endif
 
 #endif
@@ -0,0 +1,335 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "EnvironmentMap.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/CubeMapTexture.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+static void importTextureToolResources() {
+    CORRADE_RESOURCE_INITIALIZE(MagnumTextureTools_RCS)
+}
+#endif
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+namespace {
+
+class EnvironmentMapShader: public GL::AbstractShaderProgram {
+    public:
+        enum class Mode { Specular, Irradiance, BrdfLookup };
+
+        explicit EnvironmentMapShader(Mode mode);
+
+        EnvironmentMapShader& setDestinationSize(const Vector2i& size) {
+            setUniform(destinationSizeUniform, size);
+            return *this;
+        }
+
+        EnvironmentMapShader& setSampleCount(UnsignedInt count) {
+            setUniform(sampleCountUniform, Int(count));
+            return *this;
+        }
+
+        EnvironmentMapShader& setFace(Int face) {
+            setUniform(faceUniform, face);
+            return *this;
+        }
+
+        EnvironmentMapShader& setRoughness(Float roughness) {
+            setUniform(roughnessUniform, roughness);
+            return *this;
+        }
+
+        EnvironmentMapShader& bindTexture(GL::CubeMapTexture& texture) {
+            texture.bind(TextureUnit);
+            return *this;
+        }
+
+    private:
+        /* Same as in the distance field shader */
+        enum: Int { TextureUnit = 7 };
+
+        Int destinationSizeUniform{0},
+            sampleCountUniform{1},
+            faceUniform{2},
+            roughnessUniform{3};
+};
+
+EnvironmentMapShader::EnvironmentMapShader(const Mode mode) {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumTextureTools"))
+        importTextureToolResources();
+    #endif
+    Utility::Resource rs("MagnumTextureTools");
+
+    #ifndef MAGNUM_TARGET_GLES
+    const GL::Version v = GL::Context::current().supportedVersion({GL::Version::GL320, GL::Version::GL300});
+    #else
+    const GL::Version v = GL::Version::GLES300;
+    #endif
+
+    GL::Shader vert = Shaders::Implementation::createCompatibilityShader(rs, v, GL::Shader::Type::Vertex);
+    GL::Shader frag = Shaders::Implementation::createCompatibilityShader(rs, v, GL::Shader::Type::Fragment);
+
+    /* The vertex shader does nothing except calling fullScreenTriangle(), so
+       it's shared with the distance field shader */
+    vert.addSource(rs.get("FullScreenTriangle.glsl"))
+        .addSource(rs.get("DistanceFieldShader.vert"));
+    frag.addSource(mode == Mode::Specular ? "#define SPECULAR\n" :
+                   mode == Mode::Irradiance ? "#define IRRADIANCE\n" :
+                                              "#define BRDF_LOOKUP\n")
+        .addSource(rs.get("EnvironmentMapShader.frag"));
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(GL::Shader::compile({vert, frag}));
+
+    attachShaders({vert, frag});
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>())
+    #endif
+    {
+        destinationSizeUniform = uniformLocation("destinationSize");
+        sampleCountUniform = uniformLocation("sampleCount");
+        if(mode != Mode::BrdfLookup) {
+            faceUniform = uniformLocation("face");
+            roughnessUniform = uniformLocation("roughness");
+        }
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(mode != Mode::BrdfLookup && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>())
+    #else
+    if(mode != Mode::BrdfLookup)
+    #endif
+    {
+        setUniform(uniformLocation("environmentTexture"), TextureUnit);
+    }
+}
+
+constexpr GL::CubeMapCoordinate CubeMapFaces[]{
+    GL::CubeMapCoordinate::PositiveX,
+    GL::CubeMapCoordinate::NegativeX,
+    GL::CubeMapCoordinate::PositiveY,
+    GL::CubeMapCoordinate::NegativeY,
+    GL::CubeMapCoordinate::PositiveZ,
+    GL::CubeMapCoordinate::NegativeZ
+};
+
+/* Renders all faces of given cube map level, the face index is passed to the
+   shader so it can calculate the direction for each pixel */
+bool renderCubeMapLevel(const char* const function, EnvironmentMapShader& shader, GL::Mesh& mesh, GL::CubeMapTexture& output, const Int size, const Int level) {
+    for(Int face = 0; face != 6; ++face) {
+        GL::Framebuffer framebuffer{{{}, Vector2i{size}}};
+        framebuffer.attachCubeMapTexture(GL::Framebuffer::ColorAttachment(0), output, CubeMapFaces[face], level);
+        framebuffer.bind();
+
+        const GL::Framebuffer::Status status = framebuffer.checkStatus(GL::FramebufferTarget::Draw);
+        if(status != GL::Framebuffer::Status::Complete) {
+            Error() << "TextureTools::" << Debug::nospace << function << Debug::nospace << "(): cannot render to given output texture, unexpected framebuffer status"
+                    << status;
+            return false;
+        }
+
+        shader.setFace(face);
+        mesh.draw(shader);
+    }
+
+    return true;
+}
+
+}
+
+void prefilterSpecularEnvironment(GL::CubeMapTexture& environment, GL::CubeMapTexture& output, const Int size, const Int levelCount, const UnsignedInt sampleCount) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::framebuffer_object);
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    #endif
+
+    CORRADE_ASSERT(size > 0 && levelCount > 0 && sampleCount,
+        "TextureTools::prefilterSpecularEnvironment(): expected non-zero size, level count and sample count", );
+
+    /** @todo Disable blending and then enable it back (if was previously) */
+
+    EnvironmentMapShader shader{EnvironmentMapShader::Mode::Specular};
+    shader.setSampleCount(sampleCount)
+        .bindTexture(environment);
+
+    /* The positions are generated from gl_VertexID, so there's no buffer */
+    GL::Mesh mesh;
+    mesh.setPrimitive(GL::MeshPrimitive::Triangles)
+        .setCount(3);
+
+    for(Int level = 0; level != levelCount; ++level) {
+        const Int levelSize = Math::max(size >> level, 1);
+        shader.setDestinationSize(Vector2i{levelSize})
+            .setRoughness(levelCount == 1 ? 0.0f : Float(level)/(levelCount - 1));
+        if(!renderCubeMapLevel("prefilterSpecularEnvironment", shader, mesh, output, levelSize, level))
+            return;
+    }
+}
+
+void irradianceEnvironment(GL::CubeMapTexture& environment, GL::CubeMapTexture& output, const Int size, const UnsignedInt sampleCount) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::framebuffer_object);
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    #endif
+
+    CORRADE_ASSERT(size > 0 && sampleCount,
+        "TextureTools::irradianceEnvironment(): expected non-zero size and sample count", );
+
+    EnvironmentMapShader shader{EnvironmentMapShader::Mode::Irradiance};
+    shader.setSampleCount(sampleCount)
+        .setDestinationSize(Vector2i{size})
+        .bindTexture(environment);
+
+    GL::Mesh mesh;
+    mesh.setPrimitive(GL::MeshPrimitive::Triangles)
+        .setCount(3);
+
+    renderCubeMapLevel("irradianceEnvironment", shader, mesh, output, size, 0);
+}
+
+void brdfLookupTable(GL::Texture2D& output, const Vector2i& size, const UnsignedInt sampleCount) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::framebuffer_object);
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL300);
+    #endif
+
+    CORRADE_ASSERT(size.product() && sampleCount,
+        "TextureTools::brdfLookupTable(): expected non-zero size and sample count", );
+
+    EnvironmentMapShader shader{EnvironmentMapShader::Mode::BrdfLookup};
+    shader.setSampleCount(sampleCount)
+        .setDestinationSize(size);
+
+    GL::Mesh mesh;
+    mesh.setPrimitive(GL::MeshPrimitive::Triangles)
+        .setCount(3);
+
+    GL::Framebuffer framebuffer{{{}, size}};
+    framebuffer.attachTexture(GL::Framebuffer::ColorAttachment(0), output, 0);
+    framebuffer.bind();
+
+    const GL::Framebuffer::Status status = framebuffer.checkStatus(GL::FramebufferTarget::Draw);
+    if(status != GL::Framebuffer::Status::Complete) {
+        Error() << "TextureTools::brdfLookupTable(): cannot render to given output texture, unexpected framebuffer status"
+                << status;
+        return;
+    }
+
+    mesh.draw(shader);
+}
+#endif
+
+namespace {
+
+/* Same as in the shader */
+Vector2 hammersley(const UnsignedInt i, const UnsignedInt sampleCount) {
+    UnsignedInt bits = i;
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xaaaaaaaau) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xccccccccu) >> 2u);
+    bits = ((bits & 0x0f0f0f0fu) << 4u) | ((bits & 0xf0f0f0f0u) >> 4u);
+    bits = ((bits & 0x00ff00ffu) << 8u) | ((bits & 0xff00ff00u) >> 8u);
+    return {Float(i)/Float(sampleCount), Float(bits)*2.3283064365386963e-10f};
+}
+
+Vector3 importanceSampleGgx(const Vector2& xi, const Float alpha) {
+    const Float phi = 2.0f*Constants::pi()*xi.x();
+    const Float cosTheta = std::sqrt((1.0f - xi.y())/(1.0f + (alpha*alpha - 1.0f)*xi.y()));
+    const Float sinTheta = std::sqrt(1.0f - cosTheta*cosTheta);
+    return {sinTheta*std::cos(phi), sinTheta*std::sin(phi), cosTheta};
+}
+
+inline Float geometry(const Float normalDotDirection, const Float k) {
+    return normalDotDirection/(normalDotDirection*(1.0f - k) + k);
+}
+
+}
+
+Image2D brdfLookupTable(const Vector2i& size, const UnsignedInt sampleCount) {
+    CORRADE_ASSERT(size.product() && sampleCount,
+        "TextureTools::brdfLookupTable(): expected non-zero size and sample count", (Image2D{PixelFormat::RG32F}));
+
+    /* Eight-byte pixels are always aligned to four bytes, so the rows are
+       tightly packed */
+    Containers::Array<char> data{Containers::NoInit, std::size_t(size.product())*sizeof(Vector2)};
+    Vector2* const out = reinterpret_cast<Vector2*>(data.data());
+    for(Int y = 0; y != size.y(); ++y) {
+        /* Sampled at pixel centers, the same as gl_FragCoord in the shader */
+        const Float roughness = (y + 0.5f)/size.y();
+        const Float alpha = roughness*roughness;
+        const Float k = alpha*0.5f;
+
+        for(Int x = 0; x != size.x(); ++x) {
+            /* Integrating in a tangent space with the normal being +Z */
+            const Float normalDotView = (x + 0.5f)/size.x();
+            const Vector3 view{std::sqrt(1.0f - normalDotView*normalDotView), 0.0f, normalDotView};
+
+            Vector2 scaleBias;
+            for(UnsignedInt i = 0; i != sampleCount; ++i) {
+                const Vector3 halfVector = importanceSampleGgx(hammersley(i, sampleCount), alpha);
+                const Float viewDotHalf = Math::dot(view, halfVector);
+                const Vector3 light = 2.0f*viewDotHalf*halfVector - view;
+                if(light.z() <= 0.0f) continue;
+
+                const Float visibility = geometry(normalDotView, k)*geometry(light.z(), k)*Math::max(viewDotHalf, 0.0f)/(halfVector.z()*normalDotView);
+                const Float fresnel = Math::pow<5>(1.0f - Math::max(viewDotHalf, 0.0f));
+                scaleBias += Vector2{(1.0f - fresnel)*visibility, fresnel*visibility};
+            }
+
+            out[y*size.x() + x] = scaleBias/Float(sampleCount);
+        }
+    }
+
+    return Image2D{PixelFormat::RG32F, size, std::move(data)};
+}
+
+}}
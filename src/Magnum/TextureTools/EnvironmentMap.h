@@ -0,0 +1,178 @@
+#ifndef Magnum_TextureTools_EnvironmentMap_h
+#define Magnum_TextureTools_EnvironmentMap_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::prefilterSpecularEnvironment(), @ref Magnum::TextureTools::irradianceEnvironment(), @ref Magnum::TextureTools::brdfLookupTable()
+ */
+
+#include "Magnum/configure.h"
+#include "Magnum/Image.h"
+#include "Magnum/TextureTools/visibility.h"
+
+#ifdef MAGNUM_TARGET_GL
+#include "Magnum/GL/GL.h"
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+#if (defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)) || defined(DOXYGEN_GENERATING_OUTPUT)
+/**
+@brief Prefilter a specular environment cube map
+@param environment  Input environment cube map
+@param output       Output cube map
+@param size         Size of the first level of @p output
+@param levelCount   Count of @p output levels to fill
+@param sampleCount  Count of samples taken for each output pixel
+
+Fills each level of @p output with @p environment convolved with the GGX
+distribution for the split-sum approximation of image-based lighting. The
+first level is a plain copy of @p environment, the roughness then increases
+linearly with each level up to @cpp 1.0f @ce in the last one, each level
+having both dimensions halved, but not smaller than one pixel. The
+convolution uses importance sampling with a Hammersley sequence and the
+samples are taken from a mip level of @p environment matching the sample
+footprint, so a low @p sampleCount doesn't result in visible noise.
+
+The @p environment is expected to have a complete mip chain, for example
+generated with @ref GL::CubeMapTexture::generateMipmap(), and trilinear
+filtering. The @p output texture is expected to be renderable, for example
+in @ref GL::TextureFormat::RGBA16F for HDR environments, and to have at least
+@p levelCount levels:
+
+@code{.cpp}
+GL::CubeMapTexture specular;
+specular.setStorage(6, GL::TextureFormat::RGBA16F, Vector2i{256})
+    .setMinificationFilter(GL::SamplerFilter::Linear, GL::SamplerMipmap::Linear)
+    .setMagnificationFilter(GL::SamplerFilter::Linear)
+    .setWrapping(GL::SamplerWrapping::ClampToEdge);
+TextureTools::prefilterSpecularEnvironment(environment, specular, 256, 6);
+@endcode
+
+The result is meant to be calculated once, for example at startup, and then
+used together with @ref irradianceEnvironment() and @ref brdfLookupTable() by
+@ref Shaders::Phong::Flag::ImageBasedLighting, which maps the specular
+environment levels to roughness the same way. The faces are rendered using a
+single full-screen triangle each, the same way as in
+@ref MeshTools::fullScreenTriangle().
+
+@attention This is GPU implementation, so it expects active context.
+
+@note If the @p output texture is not renderable, this function prints a
+    message to error output and returns. In OpenGL ES 3.0 rendering to float
+    formats requires @gl_extension{EXT,color_buffer_float} or
+    @gl_extension{EXT,color_buffer_half_float}.
+
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+
+@requires_gl30 Extension @gl_extension{ARB,framebuffer_object} and
+    @gl_extension{EXT,gpu_shader4} for the integer operations and
+    @glsl textureLod() @ce
+@requires_gles30 Integer operations are not available in OpenGL ES 2.0.
+@requires_webgl20 Integer operations are not available in WebGL 1.0.
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT prefilterSpecularEnvironment(GL::CubeMapTexture& environment, GL::CubeMapTexture& output, Int size, Int levelCount, UnsignedInt sampleCount = 64);
+
+/**
+@brief Calculate an irradiance cube map
+@param environment  Input environment cube map
+@param output       Output cube map
+@param size         Size of the first level of @p output
+@param sampleCount  Count of samples taken for each output pixel
+
+Fills the first level of @p output with a cosine-weighted convolution of
+@p environment, divided by @f$ \pi @f$, so it can be directly multiplied by
+the diffuse color. The irradiance varies very slowly, so a small @p size such
+as @cpp 32 @ce is usually enough. Expectations on @p environment and
+@p output are the same as in @ref prefilterSpecularEnvironment(), except
+that only one @p output level is needed.
+
+@attention This is GPU implementation, so it expects active context.
+
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+
+@requires_gl30 Extension @gl_extension{ARB,framebuffer_object} and
+    @gl_extension{EXT,gpu_shader4} for the integer operations and
+    @glsl textureLod() @ce
+@requires_gles30 Integer operations are not available in OpenGL ES 2.0.
+@requires_webgl20 Integer operations are not available in WebGL 1.0.
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT irradianceEnvironment(GL::CubeMapTexture& environment, GL::CubeMapTexture& output, Int size, UnsignedInt sampleCount = 512);
+
+/**
+@brief Calculate a BRDF lookup table
+@param output       Output texture
+@param size         Size of the first level of @p output
+@param sampleCount  Count of samples taken for each output pixel
+
+Fills the first level of @p output with the scale in the red and the bias in
+the green channel that's applied to the specular color in the split-sum
+approximation of image-based lighting. The X axis is the cosine of the angle
+between the normal and the view direction, the Y axis is the perceptual
+roughness, both sampled at pixel centers. The table doesn't depend on the
+environment, so it can be also calculated on the CPU using
+@ref brdfLookupTable(const Vector2i&, UnsignedInt) and stored with the
+application. The @p output texture is expected to have a renderable format
+with at least two channels, such as @ref GL::TextureFormat::RG16F, and
+linear filtering with @ref GL::SamplerWrapping::ClampToEdge wrapping.
+
+@attention This is GPU implementation, so it expects active context.
+
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+
+@requires_gl30 Extension @gl_extension{ARB,framebuffer_object} and
+    @gl_extension{EXT,gpu_shader4} for the integer operations
+@requires_gles30 Integer operations are not available in OpenGL ES 2.0.
+@requires_webgl20 Integer operations are not available in WebGL 1.0.
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT brdfLookupTable(GL::Texture2D& output, const Vector2i& size, UnsignedInt sampleCount = 512);
+#endif
+
+/**
+@brief Calculate a BRDF lookup table on the CPU
+@param size         Size of the table
+@param sampleCount  Count of samples taken for each pixel
+
+CPU variant of @ref brdfLookupTable(GL::Texture2D&, const Vector2i&, UnsignedInt)
+that doesn't need any GPU context, calculating the same values. Expects that
+@p size and @p sampleCount are non-zero. Returns an image in
+@ref PixelFormat::RG32F with default @ref PixelStorage parameters.
+
+@code{.cpp}
+Image2D lut = TextureTools::brdfLookupTable({128, 128});
+@endcode
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT brdfLookupTable(const Vector2i& size, UnsignedInt sampleCount = 512);
+
+}}
+
+#endif
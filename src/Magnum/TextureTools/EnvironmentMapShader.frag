@@ -0,0 +1,188 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef RUNTIME_CONST
+#define const
+#endif
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 0) uniform ivec2 destinationSize;
+layout(location = 1) uniform int sampleCount;
+#else
+uniform highp ivec2 destinationSize;
+uniform highp int sampleCount;
+#endif
+
+#ifndef BRDF_LOOKUP
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 2) uniform int face;
+layout(location = 3) uniform float roughness;
+#else
+uniform highp int face;
+uniform highp float roughness;
+#endif
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 7) uniform highp samplerCube environmentTexture;
+#else
+uniform highp samplerCube environmentTexture;
+#endif
+
+out highp vec4 result;
+#else
+out highp vec2 result;
+#endif
+
+#define PI 3.14159265358979323846
+
+/* Hammersley point set, the radical inverse is reversing the bits */
+highp vec2 hammersley(const highp int i) {
+    highp uint bits = uint(i);
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xaaaaaaaau) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xccccccccu) >> 2u);
+    bits = ((bits & 0x0f0f0f0fu) << 4u) | ((bits & 0xf0f0f0f0u) >> 4u);
+    bits = ((bits & 0x00ff00ffu) << 8u) | ((bits & 0xff00ff00u) >> 8u);
+    return vec2(float(i)/float(sampleCount), float(bits)*2.3283064365386963e-10);
+}
+
+/* Transforms a direction from a tangent space around given normal */
+highp vec3 fromTangentSpace(const highp vec3 direction, const highp vec3 normal) {
+    const highp vec3 up = abs(normal.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0);
+    const highp vec3 tangent = normalize(cross(up, normal));
+    const highp vec3 bitangent = cross(normal, tangent);
+    return tangent*direction.x + bitangent*direction.y + normal*direction.z;
+}
+
+/* Half vector distributed according to GGX, returned in the tangent space */
+highp vec3 importanceSampleGgx(const highp vec2 xi, const highp float alpha) {
+    const highp float phi = 2.0*PI*xi.x;
+    const highp float cosTheta = sqrt((1.0 - xi.y)/(1.0 + (alpha*alpha - 1.0)*xi.y));
+    const highp float sinTheta = sqrt(1.0 - cosTheta*cosTheta);
+    return vec3(sinTheta*cos(phi), sinTheta*sin(phi), cosTheta);
+}
+
+#ifndef BRDF_LOOKUP
+/* Direction corresponding to given face pixel, following the OpenGL cube
+   map face orientation */
+highp vec3 cubeMapDirection(const highp vec2 position) {
+    const highp vec2 p = position*2.0 - vec2(1.0);
+    highp vec3 direction;
+    if(face == 0)      direction = vec3( 1.0, -p.y, -p.x);
+    else if(face == 1) direction = vec3(-1.0, -p.y,  p.x);
+    else if(face == 2) direction = vec3( p.x,  1.0,  p.y);
+    else if(face == 3) direction = vec3( p.x, -1.0, -p.y);
+    else if(face == 4) direction = vec3( p.x, -p.y,  1.0);
+    else               direction = vec3(-p.x, -p.y, -1.0);
+    return normalize(direction);
+}
+
+/* Mip level of the environment having roughly the same solid angle per
+   pixel as is the solid angle of a sample with given probability, to avoid
+   aliasing with low sample counts */
+highp float sampleLevel(const highp float pdf) {
+    const highp float environmentSize = float(textureSize(environmentTexture, 0).x);
+    const highp float texelSolidAngle = 4.0*PI/(6.0*environmentSize*environmentSize);
+    const highp float sampleSolidAngle = 1.0/(float(sampleCount)*pdf + 0.0001);
+    return max(0.5*log2(sampleSolidAngle/texelSolidAngle) + 1.0, 0.0);
+}
+#endif
+
+#ifdef BRDF_LOOKUP
+/* Smith-Schlick geometry term with k = alpha/2, as used for the split-sum
+   approximation */
+highp float geometry(const highp float normalDotDirection, const highp float k) {
+    return normalDotDirection/(normalDotDirection*(1.0 - k) + k);
+}
+#endif
+
+void main() {
+    const highp vec2 position = gl_FragCoord.xy/vec2(destinationSize);
+
+    #ifdef SPECULAR
+    /* The normal, view and reflection directions are considered to be the
+       same. First level is just a copy. */
+    const highp vec3 normal = cubeMapDirection(position);
+    if(roughness == 0.0) {
+        result = textureLod(environmentTexture, normal, 0.0);
+        return;
+    }
+
+    const highp float alpha = roughness*roughness;
+    highp vec3 color = vec3(0.0);
+    highp float weight = 0.0;
+    for(highp int i = 0; i < sampleCount; ++i) {
+        const highp vec3 halfVector = importanceSampleGgx(hammersley(i), alpha);
+        const highp vec3 light = fromTangentSpace(2.0*halfVector.z*halfVector - vec3(0.0, 0.0, 1.0), normal);
+        const highp float normalDotLight = dot(normal, light);
+        if(normalDotLight <= 0.0) continue;
+
+        /* With the view direction equal to the normal the pdf is D/4 */
+        const highp float d = (halfVector.z*halfVector.z*(alpha*alpha - 1.0) + 1.0);
+        const highp float distribution = alpha*alpha/(PI*d*d);
+        color += textureLod(environmentTexture, light, sampleLevel(distribution*0.25)).rgb*normalDotLight;
+        weight += normalDotLight;
+    }
+
+    result = vec4(color/max(weight, 0.0001), 1.0);
+
+    #elif defined(IRRADIANCE)
+    /* Cosine-weighted samples, the cosine term and the 1/pi cancel out with
+       the pdf */
+    const highp vec3 normal = cubeMapDirection(position);
+    highp vec3 color = vec3(0.0);
+    for(highp int i = 0; i < sampleCount; ++i) {
+        const highp vec2 xi = hammersley(i);
+        const highp float phi = 2.0*PI*xi.x;
+        const highp float cosTheta = sqrt(1.0 - xi.y);
+        const highp float sinTheta = sqrt(xi.y);
+        const highp vec3 light = fromTangentSpace(vec3(sinTheta*cos(phi), sinTheta*sin(phi), cosTheta), normal);
+        color += textureLod(environmentTexture, light, sampleLevel(cosTheta/PI)).rgb;
+    }
+
+    result = vec4(color/float(sampleCount), 1.0);
+
+    #elif defined(BRDF_LOOKUP)
+    /* Integrating in a tangent space with the normal being +Z */
+    const highp float normalDotView = position.x;
+    const highp float alpha = position.y*position.y;
+    const highp vec3 view = vec3(sqrt(1.0 - normalDotView*normalDotView), 0.0, normalDotView);
+    const highp float k = alpha*0.5;
+
+    highp vec2 scaleBias = vec2(0.0);
+    for(highp int i = 0; i < sampleCount; ++i) {
+        const highp vec3 halfVector = importanceSampleGgx(hammersley(i), alpha);
+        const highp float viewDotHalf = dot(view, halfVector);
+        const highp vec3 light = 2.0*viewDotHalf*halfVector - view;
+        if(light.z <= 0.0) continue;
+
+        const highp float visibility = geometry(normalDotView, k)*geometry(light.z, k)*max(viewDotHalf, 0.0)/(halfVector.z*normalDotView);
+        const highp float fresnel = pow(1.0 - max(viewDotHalf, 0.0), 5.0);
+        scaleBias += vec2((1.0 - fresnel)*visibility, fresnel*visibility);
+    }
+
+    result = scaleBias/float(sampleCount);
+    #endif
+}
@@ -0,0 +1,324 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Mipmap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/TiledImage.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* 256-entry table for unpacking sRGB to linear */
+const Float* srgbToLinearTable() {
+    static const struct Table {
+        Table() {
+            for(std::size_t i = 0; i != 256; ++i) {
+                const Float srgb = i/255.0f;
+                data[i] = srgb <= 0.04045f ? srgb/12.92f : std::pow((srgb + 0.055f)/1.055f, 2.4f);
+            }
+        }
+
+        Float data[256];
+    } table;
+    return table.data;
+}
+
+UnsignedByte linearToSrgb(const Float linear) {
+    const Float srgb = linear <= 0.0031308f ? linear*12.92f : 1.055f*std::pow(linear, 1.0f/2.4f) - 0.055f;
+    return UnsignedByte(srgb*255.0f + 0.5f);
+}
+
+/* Weights of the Kaiser-windowed sinc for downsampling by two. Source pixel
+   2x + i - 2 contributes to destination pixel x with weight i, the six taps
+   are at distance of 0.5, 1.5 and 2.5 source pixels on both sides. */
+enum: std::size_t { KaiserTapCount = 6 };
+const Float* kaiserWeights() {
+    static const struct Weights {
+        Weights() {
+            /* Zeroth-order modified Bessel function of the first kind */
+            const auto bessel = [](const Double x) {
+                Double sum = 1.0, term = 1.0;
+                for(Int k = 1; k != 16; ++k) {
+                    term *= x*x/(4.0*k*k);
+                    sum += term;
+                }
+                return sum;
+            };
+
+            constexpr Double Alpha = 4.0;
+            constexpr Double HalfWidth = 3.0;
+            Double sum = 0.0;
+            Double weights[KaiserTapCount];
+            for(std::size_t i = 0; i != KaiserTapCount; ++i) {
+                const Double t = i - 2.5;
+                const Double sinc = std::sin(Math::Constants<Double>::pi()*t*0.5)/(Math::Constants<Double>::pi()*t*0.5);
+                const Double ratio = t/HalfWidth;
+                weights[i] = sinc*bessel(Alpha*std::sqrt(1.0 - ratio*ratio))/bessel(Alpha);
+                sum += weights[i];
+            }
+
+            for(std::size_t i = 0; i != KaiserTapCount; ++i)
+                data[i] = Float(weights[i]/sum);
+        }
+
+        Float data[KaiserTapCount];
+    } weights;
+    return weights.data;
+}
+
+const Float BoxWeights[]{0.5f, 0.5f};
+
+/* Source pixels and their weights contributing to destination pixel x when
+   downsampling by two, returns the tap count. Source indices are clamped to
+   the edge. */
+std::size_t taps(const MipmapFilter filter, const std::size_t x, const std::size_t inSize, std::size_t* const sources, const Float*& weights) {
+    if(filter == MipmapFilter::Box) {
+        /* For odd sizes the last source pixel is not used, 2x + 1 is always
+           in bounds */
+        sources[0] = 2*x;
+        sources[1] = 2*x + 1;
+        weights = BoxWeights;
+        return 2;
+    }
+
+    CORRADE_INTERNAL_ASSERT(filter == MipmapFilter::Kaiser);
+    for(std::size_t i = 0; i != KaiserTapCount; ++i)
+        sources[i] = std::size_t(Math::clamp(Int(2*x + i) - 2, 0, Int(inSize) - 1));
+    weights = kaiserWeights();
+    return KaiserTapCount;
+}
+
+/* Whether the format is supported, if it is, fills whether it's 8-bit and
+   the channel count */
+bool pixelFormatProperties(const PixelFormat format, const UnsignedInt pixelSize, bool& integral, std::size_t& channelCount) {
+    switch(format) {
+        case PixelFormat::R8Unorm:
+        case PixelFormat::RG8Unorm:
+        case PixelFormat::RGB8Unorm:
+        case PixelFormat::RGBA8Unorm:
+            integral = true;
+            channelCount = pixelSize;
+            return true;
+        case PixelFormat::R32F:
+        case PixelFormat::RG32F:
+        case PixelFormat::RGB32F:
+        case PixelFormat::RGBA32F:
+            integral = false;
+            channelCount = pixelSize/4;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* The base level pixels are fetched through copyRow(y, out), which copies
+   one row of the base level to out */
+template<class CopyRow> std::vector<Image2D> mipmapsImplementation(const PixelFormat format, const UnsignedInt formatExtra, const UnsignedInt pixelSize, const Vector2i& baseSize, const CopyRow& copyRow, const MipmapFilter filter, const MipmapFlags flags, UnsignedInt threadCount) {
+    bool integral{};
+    std::size_t channelCount{};
+    CORRADE_INTERNAL_ASSERT_OUTPUT(pixelFormatProperties(format, pixelSize, integral, channelCount));
+
+    if(!threadCount) threadCount = 1;
+    const bool srgb = integral && (flags & MipmapFlag::Srgb);
+    const Float* const srgbTable = srgb ? srgbToLinearTable() : nullptr;
+
+    /* Copy the base level to an image with default storage and unpack it to
+       a tightly packed float buffer */
+    Vector2i size = baseSize;
+    Containers::Array<Float> pixels{channelCount*size.product()};
+    std::vector<Image2D> levels;
+    {
+        const std::size_t outRowStride = (pixelSize*size.x() + 3)/4*4;
+        const std::size_t rowLength = channelCount*size.x();
+        Containers::Array<char> data{Containers::ValueInit, outRowStride*size.y()};
+        Magnum::Implementation::parallelFor(threadCount, size.y(), [&](const std::size_t y) {
+            char* const row = data + y*outRowStride;
+            copyRow(y, row);
+
+            Float* const out = pixels + y*rowLength;
+            if(integral) {
+                const UnsignedByte* const in = reinterpret_cast<const UnsignedByte*>(row);
+                for(std::size_t i = 0; i != rowLength; ++i)
+                    out[i] = srgb && i % channelCount != 3 ? srgbTable[in[i]] : in[i]/255.0f;
+            } else std::copy_n(reinterpret_cast<const Float*>(row), rowLength, out);
+        });
+        levels.emplace_back(PixelStorage{}, format, formatExtra, pixelSize, size, std::move(data));
+    }
+
+    while(size != Vector2i{1}) {
+        /* Filter horizontally, then vertically. Dimensions that are already
+           one pixel are left untouched. */
+        const Vector2i nextSize = Math::max(size/2, Vector2i{1});
+        if(nextSize.x() != size.x()) {
+            Containers::Array<Float> filtered{channelCount*nextSize.x()*size.y()};
+            Magnum::Implementation::parallelFor(threadCount, size.y(), [&](const std::size_t y) {
+                const Float* const in = pixels + y*channelCount*size.x();
+                Float* const out = filtered + y*channelCount*nextSize.x();
+                std::size_t sources[KaiserTapCount];
+                const Float* weights;
+                for(std::size_t x = 0; x != std::size_t(nextSize.x()); ++x) {
+                    const std::size_t tapCount = taps(filter, x, size.x(), sources, weights);
+                    Float* const o = out + x*channelCount;
+                    for(std::size_t c = 0; c != channelCount; ++c) o[c] = 0.0f;
+                    for(std::size_t i = 0; i != tapCount; ++i) {
+                        const Float* const a = in + sources[i]*channelCount;
+                        for(std::size_t c = 0; c != channelCount; ++c)
+                            o[c] += a[c]*weights[i];
+                    }
+                }
+            });
+            pixels = std::move(filtered);
+        }
+        if(nextSize.y() != size.y()) {
+            /* Each destination row is a weighted sum of whole source rows,
+               which keeps the memory access sequential */
+            const std::size_t rowLength = channelCount*nextSize.x();
+            Containers::Array<Float> filtered{Containers::ValueInit, rowLength*nextSize.y()};
+            Magnum::Implementation::parallelFor(threadCount, nextSize.y(), [&](const std::size_t y) {
+                Float* const out = filtered + y*rowLength;
+                std::size_t sources[KaiserTapCount];
+                const Float* weights;
+                const std::size_t tapCount = taps(filter, y, size.y(), sources, weights);
+                for(std::size_t i = 0; i != tapCount; ++i) {
+                    const Float* const in = pixels + sources[i]*rowLength;
+                    const Float weight = weights[i];
+                    for(std::size_t j = 0; j != rowLength; ++j)
+                        out[j] += in[j]*weight;
+                }
+            });
+            pixels = std::move(filtered);
+        }
+
+        size = nextSize;
+
+        /* Pack the level into an image with default storage */
+        const std::size_t rowLength = channelCount*size.x();
+        const std::size_t rowStride = (pixelSize*size.x() + 3)/4*4;
+        Containers::Array<char> data{Containers::ValueInit, rowStride*size.y()};
+        Magnum::Implementation::parallelFor(threadCount, size.y(), [&](const std::size_t y) {
+            const Float* const in = pixels + y*rowLength;
+            if(integral) {
+                UnsignedByte* const out = reinterpret_cast<UnsignedByte*>(data + y*rowStride);
+                for(std::size_t i = 0; i != rowLength; ++i) {
+                    const Float value = Math::clamp(in[i], 0.0f, 1.0f);
+                    out[i] = srgb && i % channelCount != 3 ? linearToSrgb(value) : UnsignedByte(value*255.0f + 0.5f);
+                }
+            } else std::copy_n(in, rowLength, reinterpret_cast<Float*>(data + y*rowStride));
+        });
+        levels.emplace_back(PixelStorage{}, format, formatExtra, pixelSize, size, std::move(data));
+    }
+
+    return levels;
+}
+
+}
+
+std::vector<Image2D> mipmaps(const ImageView2D& image, const MipmapFilter filter, const MipmapFlags flags, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(image.size().product(),
+        "TextureTools::mipmaps(): expected a non-empty image", {});
+    #ifndef CORRADE_NO_ASSERT
+    bool integral;
+    std::size_t channelCount;
+    #endif
+    CORRADE_ASSERT(pixelFormatProperties(image.format(), image.pixelSize(), integral, channelCount),
+        "TextureTools::mipmaps(): unsupported pixel format" << image.format(), {});
+
+    const char* const imageData = image.data() + std::get<0>(image.dataProperties()).sum();
+    const std::size_t rowStride = std::get<1>(image.dataProperties()).x();
+    const std::size_t rowSize = image.pixelSize()*image.size().x();
+    return mipmapsImplementation(image.format(), image.formatExtra(), image.pixelSize(), image.size(), [&](const std::size_t y, char* const out) {
+        std::copy_n(imageData + y*rowStride, rowSize, out);
+    }, filter, flags, threadCount);
+}
+
+std::vector<Image2D> mipmaps(const TiledImage2D& image, const MipmapFilter filter, const MipmapFlags flags, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(image.size().product(),
+        "TextureTools::mipmaps(): expected a non-empty image", {});
+    #ifndef CORRADE_NO_ASSERT
+    bool integral;
+    std::size_t channelCount;
+    #endif
+    CORRADE_ASSERT(pixelFormatProperties(image.format(), image.pixelSize(), integral, channelCount),
+        "TextureTools::mipmaps(): unsupported pixel format" << image.format(), {});
+
+    /* With row-major tiles each tile row is contiguous, with Morton order
+       only single pixels */
+    const std::size_t pixelSize = image.pixelSize();
+    const Int tileSize = image.tileSize();
+    const Int width = image.size().x();
+    return mipmapsImplementation(image.format(), image.formatExtra(), image.pixelSize(), image.size(), [&](const std::size_t y, char* const out) {
+        for(Int x = 0; x != width; ) {
+            const Int count = image.order() == TileOrder::RowMajor ?
+                Math::min(width - x, tileSize - (x & (tileSize - 1))) : 1;
+            std::copy_n(image.data() + image.pixelOffset({x, Int(y)}), count*pixelSize, out + x*pixelSize);
+            x += count;
+        }
+    }, filter, flags, threadCount);
+}
+
+Debug& operator<<(Debug& debug, const MipmapFilter value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case MipmapFilter::value: return debug << "TextureTools::MipmapFilter::" #value;
+        _c(Box)
+        _c(Kaiser)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "TextureTools::MipmapFilter(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const MipmapFlag value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case MipmapFlag::value: return debug << "TextureTools::MipmapFlag::" #value;
+        _c(Srgb)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "TextureTools::MipmapFlag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const MipmapFlags value) {
+    return Containers::enumSetDebugOutput(debug, value, "TextureTools::MipmapFlags{}", {
+        MipmapFlag::Srgb});
+}
+
+}}
@@ -0,0 +1,147 @@
+#ifndef Magnum_TextureTools_Mipmap_h
+#define Magnum_TextureTools_Mipmap_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::mipmaps(), enum @ref Magnum::TextureTools::MipmapFilter, @ref Magnum::TextureTools::MipmapFlag, enum set @ref Magnum::TextureTools::MipmapFlags
+ */
+
+#include <vector>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+class TiledImage2D;
+
+/**
+@brief Mipmap downsampling filter
+
+@see @ref mipmaps()
+*/
+enum class MipmapFilter: UnsignedByte {
+    /**
+     * Average of each 2x2 pixel block. Fast, but produces slightly blurry and
+     * aliased results.
+     */
+    Box,
+
+    /**
+     * Separable six-tap sinc filter windowed with a Kaiser window. Keeps
+     * the smaller levels sharper and with less aliasing than
+     * @ref MipmapFilter::Box at roughly three times the cost.
+     */
+    Kaiser
+};
+
+/** @debugoperatorenum{MipmapFilter} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, MipmapFilter value);
+
+/**
+@brief Mipmap generation flag
+
+@see @ref MipmapFlags, @ref mipmaps()
+*/
+enum class MipmapFlag: UnsignedByte {
+    /**
+     * Treat the 8-bit color channels as sRGB-encoded. The pixels are
+     * converted to linear space before filtering and back after, which
+     * avoids darkening of the smaller levels. All channels except the fourth
+     * are treated as color channels. Ignored for floating-point formats.
+     */
+    Srgb = 1 << 0
+};
+
+/** @debugoperatorenum{MipmapFlag} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, MipmapFlag value);
+
+/**
+@brief Mipmap generation flags
+
+@see @ref mipmaps()
+*/
+typedef Containers::EnumSet<MipmapFlag> MipmapFlags;
+
+CORRADE_ENUMSET_OPERATORS(MipmapFlags)
+
+/** @debugoperatorenum{MipmapFlags} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, MipmapFlags value);
+
+/**
+@brief Generate a mip chain
+@param image        Base level
+@param filter       Downsampling filter
+@param flags        Flags
+@param threadCount  Thread count used for filtering, including the calling
+    thread. Value of @cpp 0 @ce is treated the same as @cpp 1 @ce.
+
+Returns the full mip chain down to a 1x1 image, with item at index @cpp i @ce
+being the mip level @cpp i @ce. The first item is a copy of @p image, each
+following level has both dimensions halved and rounded down, but not smaller
+than one pixel. Each level is filtered from the previous one, the images have
+the same format as @p image and default @ref PixelStorage parameters, so they
+can be directly uploaded using @ref GL::Texture::setSubImage() "setSubImage()"
+and used also with texture formats for which
+@ref GL::Texture::generateMipmap() "generateMipmap()" is not available:
+
+@code{.cpp}
+std::vector<Image2D> levels = TextureTools::mipmaps(image,
+    TextureTools::MipmapFilter::Kaiser, TextureTools::MipmapFlag::Srgb,
+    std::thread::hardware_concurrency());
+
+GL::Texture2D texture;
+texture.setStorage(levels.size(), GL::TextureFormat::SRGB8Alpha8,
+    levels.front().size());
+for(std::size_t i = 0; i != levels.size(); ++i)
+    texture.setSubImage(i, {}, levels[i]);
+@endcode
+
+Supported formats are @ref PixelFormat::R8Unorm, @ref PixelFormat::RG8Unorm,
+@ref PixelFormat::RGB8Unorm, @ref PixelFormat::RGBA8Unorm,
+@ref PixelFormat::R32F, @ref PixelFormat::RG32F, @ref PixelFormat::RGB32F and
+@ref PixelFormat::RGBA32F. The filtering is done in floating point on
+interleaved rows, which the compiler can vectorize, and with the rows
+distributed among threads. Multithreaded filtering is not available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where @p threadCount is ignored.
+*/
+std::vector<Image2D> MAGNUM_TEXTURETOOLS_EXPORT mipmaps(const ImageView2D& image, MipmapFilter filter = MipmapFilter::Box, MipmapFlags flags = {}, UnsignedInt threadCount = 1);
+
+/**
+@brief Generate a mip chain from a tiled image
+
+Same as @ref mipmaps(const ImageView2D&, MipmapFilter, MipmapFlags, UnsignedInt),
+but reading the base level directly from a @ref TiledImage2D, without
+converting it to a linear image first. The returned levels are linear images
+with default @ref PixelStorage parameters, ready for upload.
+*/
+std::vector<Image2D> MAGNUM_TEXTURETOOLS_EXPORT mipmaps(const TiledImage2D& image, MipmapFilter filter = MipmapFilter::Box, MipmapFlags flags = {}, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
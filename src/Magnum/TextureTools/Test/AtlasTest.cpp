@@ -38,13 +38,39 @@ struct AtlasTest: TestSuite::Tester {
     void createPadding();
     void createEmpty();
     void createTooSmall();
+
+    void packerIncremental();
+    void packerRotation();
+    void packerRotationPadding();
+    void packerBatchDoesNotFit();
+
+    void arrayPackerIncremental();
+    void arrayPackerTooLarge();
+    void arrayPackerBatch();
+    void arrayPackerBatchDoesNotFit();
+
+    void debugFlag();
+    void debugFlags();
 };
 
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::create,
               &AtlasTest::createPadding,
               &AtlasTest::createEmpty,
-              &AtlasTest::createTooSmall});
+              &AtlasTest::createTooSmall,
+
+              &AtlasTest::packerIncremental,
+              &AtlasTest::packerRotation,
+              &AtlasTest::packerRotationPadding,
+              &AtlasTest::packerBatchDoesNotFit,
+
+              &AtlasTest::arrayPackerIncremental,
+              &AtlasTest::arrayPackerTooLarge,
+              &AtlasTest::arrayPackerBatch,
+              &AtlasTest::arrayPackerBatchDoesNotFit,
+
+              &AtlasTest::debugFlag,
+              &AtlasTest::debugFlags});
 }
 
 void AtlasTest::create() {
@@ -54,11 +80,12 @@ void AtlasTest::create() {
         {23, 25}
     });
 
+    /* The tallest one is placed first, the others next to it */
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({0, 0}, {12, 18}),
-        Range2Di::fromSize({32, 0}, {32, 15}),
-        Range2Di::fromSize({0, 25}, {23, 25})}));
+        Range2Di::fromSize({23, 0}, {12, 18}),
+        Range2Di::fromSize({23, 18}, {32, 15}),
+        Range2Di::fromSize({0, 0}, {23, 25})}));
 }
 
 void AtlasTest::createPadding() {
@@ -68,11 +95,12 @@ void AtlasTest::createPadding() {
         {19, 23}
     }, {2, 1});
 
+    /* Same as above, with padding */
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({2, 1}, {8, 16}),
-        Range2Di::fromSize({34, 1}, {28, 13}),
-        Range2Di::fromSize({2, 26}, {19, 23})}));
+        Range2Di::fromSize({25, 1}, {8, 16}),
+        Range2Di::fromSize({25, 19}, {28, 13}),
+        Range2Di::fromSize({2, 1}, {19, 23})}));
 }
 
 void AtlasTest::createEmpty() {
@@ -84,13 +112,184 @@ void AtlasTest::createTooSmall() {
     std::ostringstream o;
     Error redirectError{&o};
 
-    std::vector<Range2Di> atlas = TextureTools::atlas({64, 32}, {
+    std::vector<Range2Di> atlas = TextureTools::atlas({32, 32}, {
         {8, 16},
         {21, 13},
         {19, 29}
     }, {2, 1});
     CORRADE_VERIFY(atlas.empty());
-    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(25, 31) textures. Generated atlas will be empty.\n");
+    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(32, 32) is too small to fit 3 textures with padding Vector(2, 1). Generated atlas will be empty.\n");
+}
+
+void AtlasTest::packerIncremental() {
+    AtlasPacker packer{{64, 64}};
+    CORRADE_COMPARE(packer.size(), (Vector2i{64, 64}));
+    CORRADE_COMPARE(packer.padding(), Vector2i{});
+    CORRADE_COMPARE(packer.flags(), AtlasPacker::Flags{});
+    CORRADE_COMPARE(packer.count(), 0);
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+
+    /* The second one goes next to the first, the third on top of both */
+    Containers::Optional<Range2Di> a = packer.add({32, 16});
+    Containers::Optional<Range2Di> b = packer.add({32, 32});
+    Containers::Optional<Range2Di> c = packer.add({64, 8});
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(b);
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(*a, Range2Di::fromSize({0, 0}, {32, 16}));
+    CORRADE_COMPARE(*b, Range2Di::fromSize({32, 0}, {32, 32}));
+    CORRADE_COMPARE(*c, Range2Di::fromSize({0, 32}, {64, 8}));
+    CORRADE_COMPARE(packer.count(), 3);
+    CORRADE_COMPARE(packer.filledSize(), (Vector2i{64, 40}));
+    CORRADE_COMPARE(packer.occupancy(), 0.5f);
+
+    /* This one doesn't fit anymore, state is not changed */
+    CORRADE_VERIFY(!packer.add({64, 32}));
+    CORRADE_COMPARE(packer.count(), 3);
+    CORRADE_COMPARE(packer.filledSize(), (Vector2i{64, 40}));
+
+    /* After clearing there's space for everything again */
+    packer.clear();
+    CORRADE_COMPARE(packer.count(), 0);
+    CORRADE_COMPARE(packer.filledSize(), Vector2i{});
+    Containers::Optional<Range2Di> d = packer.add({64, 64});
+    CORRADE_VERIFY(d);
+    CORRADE_COMPARE(*d, Range2Di::fromSize({}, {64, 64}));
+    CORRADE_COMPARE(packer.occupancy(), 1.0f);
+}
+
+void AtlasTest::packerRotation() {
+    /* Doesn't fit without rotation */
+    CORRADE_VERIFY(!AtlasPacker{{16, 8}}.add({4, 12}));
+
+    /* With rotation it does, the range has the size flipped. The padding is
+       in atlas space, so the rotated rectangle is padded horizontally. */
+    AtlasPacker packer{{16, 8}, {1, 0}, AtlasPacker::Flag::AllowRotation};
+    Containers::Optional<Range2Di> range = packer.add({4, 12});
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(*range, Range2Di::fromSize({1, 0}, {12, 4}));
+    CORRADE_COMPARE(packer.filledSize(), (Vector2i{14, 4}));
+    CORRADE_VERIFY(Range2Di{{}, packer.filledSize()}.contains(*range));
+}
+
+void AtlasTest::packerRotationPadding() {
+    /* With the padding added the rectangle is too wide for the atlas, but
+       rotated it fits, as then the padding is added to the narrow side */
+    CORRADE_VERIFY(!AtlasPacker{{10, 20}, {3, 0}}.add({6, 2}));
+
+    AtlasPacker packer{{10, 20}, {3, 0}, AtlasPacker::Flag::AllowRotation};
+    Containers::Optional<Range2Di> range = packer.add({6, 2});
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(*range, Range2Di::fromSize({3, 0}, {2, 6}));
+    CORRADE_COMPARE(packer.filledSize(), (Vector2i{8, 6}));
+
+    /* The next rectangle doesn't overlap the padding of the rotated one */
+    Containers::Optional<Range2Di> next = packer.add({2, 6});
+    CORRADE_VERIFY(next);
+    CORRADE_COMPARE(*next, Range2Di::fromSize({3, 6}, {2, 6}));
+    CORRADE_COMPARE(packer.filledSize(), (Vector2i{8, 12}));
+}
+
+void AtlasTest::packerBatchDoesNotFit() {
+    AtlasPacker packer{{32, 32}};
+    CORRADE_VERIFY(packer.add({{32, 16}, {32, 32}}).empty());
+
+    /* The state is restored, so the bigger one alone fits */
+    CORRADE_COMPARE(packer.count(), 0);
+    CORRADE_COMPARE(packer.filledSize(), Vector2i{});
+    Containers::Optional<Range2Di> range = packer.add({32, 32});
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(*range, Range2Di::fromSize({}, {32, 32}));
+}
+
+void AtlasTest::arrayPackerIncremental() {
+    AtlasArrayPacker packer{{32, 32}, 2, {}, AtlasPacker::Flag::AllowRotation};
+    CORRADE_COMPARE(packer.size(), (Vector2i{32, 32}));
+    CORRADE_COMPARE(packer.maxLayerCount(), 2);
+    CORRADE_COMPARE(packer.padding(), Vector2i{});
+    CORRADE_COMPARE(packer.flags(), AtlasPacker::Flags{AtlasPacker::Flag::AllowRotation});
+    CORRADE_COMPARE(packer.layerCount(), 0);
+    CORRADE_COMPARE(packer.count(), 0);
+
+    /* The first fills the whole first layer, so the second opens a new one
+       and the third goes next to it */
+    Containers::Optional<Range3Di> a = packer.add({32, 32});
+    Containers::Optional<Range3Di> b = packer.add({16, 32});
+    Containers::Optional<Range3Di> c = packer.add({16, 16});
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(b);
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(*a, (Range3Di{{0, 0, 0}, {32, 32, 1}}));
+    CORRADE_COMPARE(*b, (Range3Di{{0, 0, 1}, {16, 32, 2}}));
+    CORRADE_COMPARE(*c, (Range3Di{{16, 0, 1}, {32, 16, 2}}));
+    CORRADE_COMPARE(packer.layerCount(), 2);
+    CORRADE_COMPARE(packer.count(), 3);
+    CORRADE_COMPARE(packer.layer(0).occupancy(), 1.0f);
+    CORRADE_COMPARE(packer.layer(1).occupancy(), 0.75f);
+    CORRADE_COMPARE(packer.layer(1).flags(), AtlasPacker::Flags{AtlasPacker::Flag::AllowRotation});
+
+    /* No more layers can be opened */
+    CORRADE_VERIFY(!packer.add({32, 32}));
+    CORRADE_COMPARE(packer.layerCount(), 2);
+    CORRADE_COMPARE(packer.count(), 3);
+
+    /* After clearing there are no layers again */
+    packer.clear();
+    CORRADE_COMPARE(packer.layerCount(), 0);
+    CORRADE_COMPARE(packer.count(), 0);
+    CORRADE_COMPARE(packer.maxLayerCount(), 2);
+}
+
+void AtlasTest::arrayPackerTooLarge() {
+    /* A rectangle that doesn't fit even into an empty layer doesn't leave an
+       empty layer behind */
+    AtlasArrayPacker packer{{32, 32}, 4, {1, 1}};
+    CORRADE_VERIFY(!packer.add({32, 32}));
+    CORRADE_COMPARE(packer.layerCount(), 0);
+
+    Containers::Optional<Range3Di> range = packer.add({30, 30});
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(*range, (Range3Di{{1, 1, 0}, {31, 31, 1}}));
+}
+
+void AtlasTest::arrayPackerBatch() {
+    AtlasArrayPacker packer{{32, 32}, 2};
+
+    /* The tallest is placed first, the two smaller ones then stack next to
+       it in the same layer */
+    std::vector<Range3Di> ranges = packer.add({{16, 16}, {16, 32}, {16, 16}});
+    CORRADE_COMPARE(ranges.size(), 3);
+    CORRADE_COMPARE(ranges[1], (Range3Di{{0, 0, 0}, {16, 32, 1}}));
+    CORRADE_COMPARE(ranges[0], (Range3Di{{16, 0, 0}, {32, 16, 1}}));
+    CORRADE_COMPARE(ranges[2], (Range3Di{{16, 16, 0}, {32, 32, 1}}));
+    CORRADE_COMPARE(packer.layerCount(), 1);
+}
+
+void AtlasTest::arrayPackerBatchDoesNotFit() {
+    AtlasArrayPacker packer{{32, 32}, 2};
+    CORRADE_VERIFY(packer.add({16, 16}));
+    CORRADE_VERIFY(packer.add({{32, 32}, {32, 32}}).empty());
+
+    /* The state is restored, including the opened layers */
+    CORRADE_COMPARE(packer.layerCount(), 1);
+    CORRADE_COMPARE(packer.count(), 1);
+    Containers::Optional<Range3Di> range = packer.add({32, 32});
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(*range, (Range3Di{{0, 0, 1}, {32, 32, 2}}));
+}
+
+void AtlasTest::debugFlag() {
+    std::ostringstream out;
+
+    Debug{&out} << AtlasPacker::Flag::AllowRotation << AtlasPacker::Flag(0xf0);
+    CORRADE_COMPARE(out.str(), "TextureTools::AtlasPacker::Flag::AllowRotation TextureTools::AtlasPacker::Flag(0xf0)\n");
+}
+
+void AtlasTest::debugFlags() {
+    std::ostringstream out;
+
+    Debug{&out} << AtlasPacker::Flags{AtlasPacker::Flag::AllowRotation} << AtlasPacker::Flags{};
+    CORRADE_COMPARE(out.str(), "TextureTools::AtlasPacker::Flag::AllowRotation TextureTools::AtlasPacker::Flags{}\n");
 }
 
 }}}
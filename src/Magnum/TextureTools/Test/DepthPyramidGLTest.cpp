@@ -0,0 +1,143 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/TextureTools/DepthPyramid.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct DepthPyramidGLTest: GL::OpenGLTester {
+    explicit DepthPyramidGLTest();
+
+    void minMax();
+    void nonPowerOfTwo();
+};
+
+DepthPyramidGLTest::DepthPyramidGLTest() {
+    addTests({&DepthPyramidGLTest::minMax,
+              &DepthPyramidGLTest::nonPowerOfTwo});
+}
+
+namespace {
+    GL::Texture2D depthTexture(const Vector2i& size, Containers::ArrayView<const Float> data) {
+        GL::Texture2D depth;
+        depth.setMinificationFilter(GL::SamplerFilter::Nearest)
+            .setMagnificationFilter(GL::SamplerFilter::Nearest)
+            .setStorage(1, GL::TextureFormat::DepthComponent32F, size)
+            .setSubImage(0, {}, ImageView2D{GL::PixelFormat::DepthComponent, GL::PixelType::Float, size, data});
+        return depth;
+    }
+
+    GL::Texture2D pyramidTexture(const Vector2i& size) {
+        GL::Texture2D pyramid;
+        pyramid.setMinificationFilter(GL::SamplerFilter::Nearest, GL::SamplerMipmap::Nearest)
+            .setMagnificationFilter(GL::SamplerFilter::Nearest)
+            .setWrapping(GL::SamplerWrapping::ClampToEdge)
+            .setStorage(depthPyramidLevelCount(size), GL::TextureFormat::RG32F, size);
+        return pyramid;
+    }
+}
+
+void DepthPyramidGLTest::minMax() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::framebuffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::framebuffer_object::string() + std::string(" is not supported."));
+    #else
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::color_buffer_float>())
+        CORRADE_SKIP(GL::Extensions::EXT::color_buffer_float::string() + std::string(" is not supported."));
+    #endif
+
+    const Float data[]{
+        0.00f, 0.25f, 0.10f, 0.20f,
+        0.50f, 0.40f, 0.30f, 0.15f,
+        0.75f, 0.05f, 0.60f, 0.60f,
+        0.10f, 0.20f, 0.60f, 0.90f
+    };
+
+    GL::Texture2D depth = depthTexture({4, 4}, data);
+    GL::Texture2D pyramid = pyramidTexture({4, 4});
+
+    std::vector<Image2D> levels = depthPyramid(depth, pyramid, {4, 4}, 3);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* The GPU and CPU implementations give the same results */
+    std::vector<Image2D> expected = depthPyramid(ImageView2D{PixelFormat::R32F, {4, 4}, data});
+    CORRADE_COMPARE(levels.size(), expected.size());
+    for(std::size_t i = 0; i != levels.size(); ++i) {
+        CORRADE_COMPARE(levels[i].format(), PixelFormat::RG32F);
+        CORRADE_COMPARE(levels[i].size(), expected[i].size());
+        CORRADE_COMPARE_AS(Containers::arrayCast<const Vector2>(levels[i].data()),
+            Containers::arrayCast<const Vector2>(expected[i].data()),
+            TestSuite::Compare::Container);
+    }
+}
+
+void DepthPyramidGLTest::nonPowerOfTwo() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::framebuffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::framebuffer_object::string() + std::string(" is not supported."));
+    #else
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::color_buffer_float>())
+        CORRADE_SKIP(GL::Extensions::EXT::color_buffer_float::string() + std::string(" is not supported."));
+    #endif
+
+    /* The last column and row gets folded into the single pixel of the
+       second level, so neither the minimum nor the maximum is lost */
+    const Float data[]{
+        0.10f, 0.10f, 0.10f,
+        0.10f, 0.10f, 0.10f,
+        0.10f, 0.05f, 0.80f
+    };
+
+    GL::Texture2D depth = depthTexture({3, 3}, data);
+    GL::Texture2D pyramid = pyramidTexture({3, 3});
+
+    std::vector<Image2D> levels = depthPyramid(depth, pyramid, {3, 3}, 1);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(levels.size(), 1);
+    CORRADE_COMPARE(levels[0].size(), Vector2i(1, 1));
+    const Vector2 expected[]{{0.05f, 0.80f}};
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector2>(levels[0].data()),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DepthPyramidGLTest)
@@ -0,0 +1,132 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/TextureTools/DepthPyramid.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct DepthPyramidTest: TestSuite::Tester {
+    explicit DepthPyramidTest();
+
+    void levelCount();
+    void sizes();
+    void minMax();
+    void nonPowerOfTwo();
+};
+
+DepthPyramidTest::DepthPyramidTest() {
+    addTests({&DepthPyramidTest::levelCount,
+              &DepthPyramidTest::sizes,
+              &DepthPyramidTest::minMax,
+              &DepthPyramidTest::nonPowerOfTwo});
+}
+
+void DepthPyramidTest::levelCount() {
+    CORRADE_COMPARE(depthPyramidLevelCount({1, 1}), 1);
+    CORRADE_COMPARE(depthPyramidLevelCount({4, 4}), 3);
+    CORRADE_COMPARE(depthPyramidLevelCount({5, 2}), 3);
+    CORRADE_COMPARE(depthPyramidLevelCount({1920, 1080}), 11);
+}
+
+void DepthPyramidTest::sizes() {
+    /* The input has a skip and row length, the output doesn't */
+    const Float data[]{
+        0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.5f, 0.25f, 0.75f
+    };
+    const ImageView2D image{PixelStorage{}.setRowLength(4).setSkip({1, 1, 0}), PixelFormat::R32F, {3, 1}, data};
+
+    std::vector<Image2D> levels = depthPyramid(image);
+    CORRADE_COMPARE(levels.size(), 2);
+    CORRADE_COMPARE(levels[0].size(), Vector2i(3, 1));
+    CORRADE_COMPARE(levels[1].size(), Vector2i(1, 1));
+    for(const Image2D& level: levels) {
+        CORRADE_COMPARE(level.format(), PixelFormat::RG32F);
+        CORRADE_COMPARE(level.storage().alignment(), 4);
+    }
+
+    /* The first level has the depth in both channels */
+    const Vector2 expected0[]{Vector2{0.5f}, Vector2{0.25f}, Vector2{0.75f}};
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector2>(levels[0].data()),
+        Containers::arrayView(expected0),
+        TestSuite::Compare::Container);
+}
+
+void DepthPyramidTest::minMax() {
+    const Float data[]{
+        0.00f, 0.25f, 0.10f, 0.20f,
+        0.50f, 0.40f, 0.30f, 0.15f,
+        0.75f, 0.05f, 0.60f, 0.60f,
+        0.10f, 0.20f, 0.60f, 0.90f
+    };
+
+    std::vector<Image2D> levels = depthPyramid(ImageView2D{PixelFormat::R32F, {4, 4}, data});
+    CORRADE_COMPARE(levels.size(), 3);
+
+    const Vector2 expected1[]{
+        {0.00f, 0.50f}, {0.10f, 0.30f},
+        {0.05f, 0.75f}, {0.60f, 0.90f}
+    };
+    const Vector2 expected2[]{{0.00f, 0.90f}};
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector2>(levels[1].data()),
+        Containers::arrayView(expected1),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector2>(levels[2].data()),
+        Containers::arrayView(expected2),
+        TestSuite::Compare::Container);
+}
+
+void DepthPyramidTest::nonPowerOfTwo() {
+    /* The last column gets folded into the second pixel of the next level,
+       so neither the minimum nor the maximum is lost */
+    const Float data[]{
+        0.5f, 0.5f, 0.5f, 0.5f, 0.9f,
+        0.5f, 0.5f, 0.5f, 0.5f, 0.1f
+    };
+
+    std::vector<Image2D> levels = depthPyramid(ImageView2D{PixelFormat::R32F, {5, 2}, data});
+    CORRADE_COMPARE(levels.size(), 3);
+    CORRADE_COMPARE(levels[1].size(), Vector2i(2, 1));
+    CORRADE_COMPARE(levels[2].size(), Vector2i(1, 1));
+
+    const Vector2 expected1[]{{0.5f, 0.5f}, {0.1f, 0.9f}};
+    const Vector2 expected2[]{{0.1f, 0.9f}};
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector2>(levels[1].data()),
+        Containers::arrayView(expected1),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector2>(levels[2].data()),
+        Containers::arrayView(expected2),
+        TestSuite::Compare::Container);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DepthPyramidTest)
@@ -0,0 +1,186 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/DistanceField.h"
+#include "Magnum/TextureTools/TiledImage.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct DistanceFieldTest: TestSuite::Tester {
+    explicit DistanceFieldTest();
+
+    void edge();
+    void downscale();
+    void multithreaded();
+    void tiled();
+
+    void emptySize();
+    void unsupportedFormat();
+};
+
+DistanceFieldTest::DistanceFieldTest() {
+    addTests({&DistanceFieldTest::edge,
+              &DistanceFieldTest::downscale,
+              &DistanceFieldTest::multithreaded,
+              &DistanceFieldTest::tiled,
+
+              &DistanceFieldTest::emptySize,
+              &DistanceFieldTest::unsupportedFormat});
+}
+
+namespace {
+
+/* A filled circle with a square hole, 64x64 pixels */
+Containers::Array<char> circle(const std::size_t pixelSize) {
+    Containers::Array<char> data{Containers::ValueInit, 64*64*pixelSize};
+    for(Int y = 0; y != 64; ++y) for(Int x = 0; x != 64; ++x) {
+        const bool inside = (Vector2{x - 31.5f, y - 31.5f}).dot() < 24.0f*24.0f &&
+            !(x >= 24 && x < 36 && y >= 28 && y < 40);
+        data[(y*64 + x)*pixelSize] = inside ? char(255) : 0;
+    }
+    return data;
+}
+
+/* Brute-force search of the whole radius area, same as in the shader */
+Containers::Array<char> reference(const ImageView2D& input, const Vector2i& size, const Int radius) {
+    const auto isInside = [&](const Int x, const Int y) {
+        return UnsignedByte(input.data()[y*input.size().x() + x]) > 127;
+    };
+
+    const Vector2 scaling = Vector2{input.size()}/Vector2{size};
+    Containers::Array<char> out{Containers::ValueInit, std::size_t((size.x() + 3)/4*4*size.y())};
+    for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x) {
+        const Vector2i position{Int(x*scaling.x()), Int(y*scaling.y())};
+        const bool inside = isInside(position.x(), position.y());
+
+        Int minDistanceSquared = (radius + 1)*(radius + 1);
+        for(Int j = -radius; j <= radius; ++j) for(Int i = -radius; i <= radius; ++i) {
+            const Vector2i p = position + Vector2i{i, j};
+            if(p.x() < 0 || p.y() < 0 || p.x() >= input.size().x() || p.y() >= input.size().y() || isInside(p.x(), p.y()) == inside) continue;
+            minDistanceSquared = Math::min(minDistanceSquared, i*i + j*j);
+        }
+
+        const Float distance = std::sqrt(Float(minDistanceSquared));
+        const Float value = (inside ? distance : -distance)/Float(radius*2 + 2) + 0.5f;
+        out[y*((size.x() + 3)/4*4) + x] = char(UnsignedByte(value*255.0f + 0.5f));
+    }
+
+    return out;
+}
+
+}
+
+void DistanceFieldTest::edge() {
+    /* Left half inside, right half outside */
+    const UnsignedByte data[]{
+        255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0,
+        255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0
+    };
+    const ImageView2D image{PixelFormat::R8Unorm, {10, 2}, data};
+
+    /* With radius 3 the distances are normalized to multiples of 1/8 */
+    const Image2D result = distanceField(image, {10, 2}, 3);
+    CORRADE_COMPARE(result.format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(result.size(), (Vector2i{10, 2}));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(result.data()), (Containers::Array<UnsignedByte>{Containers::InPlaceInit, {
+        255, 255, 223, 191, 159, 96, 64, 32, 0, 0, 0, 0,
+        255, 255, 223, 191, 159, 96, 64, 32, 0, 0, 0, 0}}),
+        TestSuite::Compare::Container);
+}
+
+void DistanceFieldTest::downscale() {
+    const Containers::Array<char> data = circle(1);
+    const ImageView2D image{PixelFormat::R8Unorm, {64, 64}, data};
+
+    /* The exact transform gives the same result as the brute-force search */
+    const Image2D result = distanceField(image, {14, 16}, 6);
+    CORRADE_COMPARE(result.size(), (Vector2i{14, 16}));
+    CORRADE_COMPARE_AS(result.data(), reference(image, {14, 16}, 6),
+        TestSuite::Compare::Container);
+}
+
+void DistanceFieldTest::multithreaded() {
+    const Containers::Array<char> data = circle(1);
+    const ImageView2D image{PixelFormat::R8Unorm, {64, 64}, data};
+
+    /* Only the first channel is used, the rest is ignored */
+    Containers::Array<char> dataRgba = circle(4);
+    for(std::size_t i = 1; i < dataRgba.size(); i += 4) dataRgba[i] = char(255);
+    const ImageView2D imageRgba{PixelFormat::RGBA8Unorm, {64, 64}, dataRgba};
+
+    const Image2D expected = distanceField(image, {32, 32}, 4);
+    const Image2D result = distanceField(imageRgba, {32, 32}, 4, 4);
+    CORRADE_COMPARE_AS(result.data(), expected.data(),
+        TestSuite::Compare::Container);
+}
+
+void DistanceFieldTest::tiled() {
+    const Containers::Array<char> data = circle(1);
+    const ImageView2D image{PixelFormat::R8Unorm, {64, 64}, data};
+    const Image2D expected = distanceField(image, {14, 16}, 6);
+
+    /* Tile sizes smaller and larger than the strip of columns processed by
+       a single task */
+    for(const TileOrder order: {TileOrder::RowMajor, TileOrder::Morton}) {
+        for(const Int tileSize: {8, 64}) {
+            const Image2D result = distanceField(TiledImage2D{image, order, tileSize}, {14, 16}, 6, 3);
+            CORRADE_COMPARE(result.size(), (Vector2i{14, 16}));
+            CORRADE_COMPARE_AS(result.data(), expected.data(),
+                TestSuite::Compare::Container);
+        }
+    }
+}
+
+void DistanceFieldTest::emptySize() {
+    const char data[4]{};
+    const ImageView2D image{PixelFormat::R8Unorm, {4, 1}, data};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    distanceField(image, {0, 4}, 4);
+    CORRADE_COMPARE(out.str(), "TextureTools::distanceField(): expected non-empty input and output size but got Vector(4, 1) and Vector(0, 4)\n");
+}
+
+void DistanceFieldTest::unsupportedFormat() {
+    const Float data[4]{};
+    const ImageView2D image{PixelFormat::R32F, {4, 1}, data};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    distanceField(image, {4, 1}, 4);
+    CORRADE_COMPARE(out.str(), "TextureTools::distanceField(): unsupported pixel format PixelFormat::R32F\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DistanceFieldTest)
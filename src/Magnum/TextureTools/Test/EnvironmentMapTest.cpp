@@ -0,0 +1,88 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/TextureTools/EnvironmentMap.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct EnvironmentMapTest: TestSuite::Tester {
+    explicit EnvironmentMapTest();
+
+    void brdfLookupTable();
+    void brdfLookupTableInvalid();
+};
+
+EnvironmentMapTest::EnvironmentMapTest() {
+    addTests({&EnvironmentMapTest::brdfLookupTable,
+              &EnvironmentMapTest::brdfLookupTableInvalid});
+}
+
+void EnvironmentMapTest::brdfLookupTable() {
+    Image2D lut = TextureTools::brdfLookupTable({4, 3}, 64);
+    CORRADE_COMPARE(lut.format(), PixelFormat::RG32F);
+    CORRADE_COMPARE(lut.size(), Vector2i(4, 3));
+    CORRADE_COMPARE(lut.data().size(), 4*3*sizeof(Vector2));
+
+    /* The scale and bias together never amplify the specular color */
+    const Vector2* const data = lut.data<Vector2>();
+    for(std::size_t i = 0; i != 4*3; ++i) {
+        CORRADE_VERIFY(data[i].x() >= 0.0f);
+        CORRADE_VERIFY(data[i].y() >= 0.0f);
+        CORRADE_VERIFY(data[i].sum() <= 1.0f);
+    }
+
+    /* Smooth surface viewed head-on is a perfect mirror with no Fresnel
+       term, at grazing angles it's mostly the bias */
+    Image2D smooth = TextureTools::brdfLookupTable({16, 16}, 64);
+    const Vector2* const smoothData = smooth.data<Vector2>();
+    CORRADE_COMPARE_WITH(smoothData[15].x(), 1.0f, TestSuite::Compare::around(0.001f));
+    CORRADE_COMPARE_WITH(smoothData[15].y(), 0.0f, TestSuite::Compare::around(0.001f));
+    CORRADE_COMPARE_WITH(smoothData[0].x(), 0.14303f, TestSuite::Compare::around(0.01f));
+    CORRADE_COMPARE_WITH(smoothData[0].y(), 0.82841f, TestSuite::Compare::around(0.01f));
+
+    /* Rough surface viewed head-on reflects considerably less */
+    CORRADE_COMPARE_WITH(smoothData[16*15 + 15].x(), 0.34774f, TestSuite::Compare::around(0.01f));
+}
+
+void EnvironmentMapTest::brdfLookupTableInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    TextureTools::brdfLookupTable({4, 0});
+    TextureTools::brdfLookupTable({4, 4}, 0);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::brdfLookupTable(): expected non-zero size and sample count\n"
+        "TextureTools::brdfLookupTable(): expected non-zero size and sample count\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::EnvironmentMapTest)
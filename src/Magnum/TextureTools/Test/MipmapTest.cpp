@@ -0,0 +1,236 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/TextureTools/Mipmap.h"
+#include "Magnum/TextureTools/TiledImage.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct MipmapTest: TestSuite::Tester {
+    explicit MipmapTest();
+
+    void sizes();
+    void box();
+    void boxFloat();
+    void kaiser();
+    void srgb();
+    void multithreaded();
+    void tiled();
+
+    void debugFilter();
+    void debugFlag();
+    void debugFlags();
+};
+
+MipmapTest::MipmapTest() {
+    addTests({&MipmapTest::sizes,
+              &MipmapTest::box,
+              &MipmapTest::boxFloat,
+              &MipmapTest::kaiser,
+              &MipmapTest::srgb,
+              &MipmapTest::multithreaded,
+              &MipmapTest::tiled,
+
+              &MipmapTest::debugFilter,
+              &MipmapTest::debugFlag,
+              &MipmapTest::debugFlags});
+}
+
+void MipmapTest::sizes() {
+    /* The base level has a skip and row length, the copy doesn't */
+    const char data[6*4*3]{
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+    };
+    const ImageView2D image{PixelStorage{}.setAlignment(1).setRowLength(6).setSkip({1, 1, 0}), PixelFormat::RGB8Unorm, {5, 3}, data};
+
+    std::vector<Image2D> levels = mipmaps(image);
+    CORRADE_COMPARE(levels.size(), 3);
+    CORRADE_COMPARE(levels[0].size(), Vector2i(5, 3));
+    CORRADE_COMPARE(levels[1].size(), Vector2i(2, 1));
+    CORRADE_COMPARE(levels[2].size(), Vector2i(1, 1));
+    for(const Image2D& level: levels) {
+        CORRADE_COMPARE(level.format(), PixelFormat::RGB8Unorm);
+        CORRADE_COMPARE(level.storage().alignment(), 4);
+    }
+
+    /* Rows of the first level are padded to four bytes */
+    CORRADE_COMPARE(levels[0].data().size(), 3*16);
+    CORRADE_COMPARE_AS(levels[0].data().prefix(15), (Containers::Array<char>{Containers::InPlaceInit, {
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}}),
+        TestSuite::Compare::Container);
+}
+
+void MipmapTest::box() {
+    const UnsignedByte data[]{
+        10, 20, 30, 40,     20, 30, 40, 50,     0, 0, 0, 0,    0, 0, 0, 0,
+        30, 40, 50, 60,     41, 50, 60, 70,     0, 0, 0, 0,    0, 0, 0, 0
+    };
+    std::vector<Image2D> levels = mipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {4, 2}, data});
+    CORRADE_COMPARE(levels.size(), 3);
+    CORRADE_COMPARE(levels[1].size(), Vector2i(2, 1));
+
+    /* The average is rounded to nearest */
+    const char expected[]{25, 35, 45, 55, 0, 0, 0, 0};
+    CORRADE_COMPARE_AS(levels[1].data(), Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void MipmapTest::boxFloat() {
+    const Float data[]{1.0f, 3.0f, -2.0f, 8.0f};
+    std::vector<Image2D> levels = mipmaps(ImageView2D{PixelFormat::R32F, {4, 1}, data});
+    CORRADE_COMPARE(levels.size(), 3);
+
+    /* Floats are not clamped */
+    const Float expected1[]{2.0f, 3.0f};
+    const Float expected2[]{2.5f};
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(levels[1].data()),
+        Containers::arrayView(expected1),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(levels[2].data()),
+        Containers::arrayView(expected2),
+        TestSuite::Compare::Container);
+}
+
+void MipmapTest::kaiser() {
+    /* Single bright column, the filter spreads it symmetrically. Weights
+       sum up to one, so a constant image stays constant. */
+    Float data[16*2];
+    for(std::size_t i = 0; i != 16*2; ++i) data[i] = i % 16 == 7 || i % 16 == 8 ? 1.0f : 0.0f;
+
+    std::vector<Image2D> levels = mipmaps(ImageView2D{PixelFormat::R32F, {16, 2}, data}, MipmapFilter::Kaiser);
+    CORRADE_COMPARE(levels.size(), 5);
+    CORRADE_COMPARE(levels[1].size(), Vector2i(8, 1));
+
+    const Containers::ArrayView<const Float> level = Containers::arrayCast<const Float>(levels[1].data());
+    CORRADE_COMPARE(level[3], level[4]);
+    CORRADE_COMPARE(level[2], level[5]);
+    CORRADE_VERIFY(level[3] > 0.5f);
+    /* Negative lobe of the sinc, pixels further away are not affected */
+    CORRADE_VERIFY(level[2] < 0.0f);
+    CORRADE_COMPARE(level[1], 0.0f);
+    CORRADE_COMPARE(level[6], 0.0f);
+
+    Float sum = 0.0f;
+    for(Float i: level) sum += i;
+    CORRADE_COMPARE(sum, 1.0f);
+
+    /* Constant 8-bit image stays exactly the same */
+    UnsignedByte constant[8*8];
+    for(UnsignedByte& i: constant) i = 77;
+    std::vector<Image2D> constantLevels = mipmaps(ImageView2D{PixelFormat::R8Unorm, {8, 8}, constant}, MipmapFilter::Kaiser);
+    CORRADE_COMPARE(constantLevels.size(), 4);
+    for(const Image2D& constantLevel: constantLevels)
+        for(std::size_t i = 0; i != std::size_t(constantLevel.size().x()); ++i)
+            CORRADE_COMPARE(Int(UnsignedByte(constantLevel.data()[i])), 77);
+}
+
+void MipmapTest::srgb() {
+    const UnsignedByte data[]{
+        0, 0, 0, 255, 255, 255, 255, 0
+    };
+    const ImageView2D image{PixelFormat::RGBA8Unorm, {2, 1}, data};
+
+    /* Linear average of black and white encoded back to sRGB is 188, while
+       the naive average is 128. Alpha is always linear. */
+    std::vector<Image2D> linear = mipmaps(image);
+    std::vector<Image2D> srgb = mipmaps(image, MipmapFilter::Box, MipmapFlag::Srgb);
+    CORRADE_COMPARE(linear.size(), 2);
+    CORRADE_COMPARE(srgb.size(), 2);
+    CORRADE_COMPARE_AS(linear[1].data(), (Containers::Array<char>{Containers::InPlaceInit, {
+        char(128), char(128), char(128), char(128)}}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(srgb[1].data(), (Containers::Array<char>{Containers::InPlaceInit, {
+        char(188), char(188), char(188), char(128)}}),
+        TestSuite::Compare::Container);
+
+    /* The base level is copied verbatim */
+    CORRADE_COMPARE_AS(srgb[0].data(), Containers::arrayCast<const char>(Containers::arrayView(data)),
+        TestSuite::Compare::Container);
+}
+
+void MipmapTest::multithreaded() {
+    UnsignedByte data[67*33*3];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i] = UnsignedByte(i*37 + i/7);
+    const ImageView2D image{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {67, 33}, data};
+
+    std::vector<Image2D> single = mipmaps(image, MipmapFilter::Kaiser, MipmapFlag::Srgb);
+    std::vector<Image2D> multi = mipmaps(image, MipmapFilter::Kaiser, MipmapFlag::Srgb, 4);
+    CORRADE_COMPARE(single.size(), 7);
+    CORRADE_COMPARE(multi.size(), 7);
+    for(std::size_t i = 0; i != single.size(); ++i) {
+        CORRADE_COMPARE(multi[i].size(), single[i].size());
+        CORRADE_COMPARE_AS(multi[i].data(), single[i].data(),
+            TestSuite::Compare::Container);
+    }
+}
+
+void MipmapTest::tiled() {
+    UnsignedByte data[67*33*3];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i] = UnsignedByte(i*37 + i/7);
+    const ImageView2D image{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {67, 33}, data};
+
+    std::vector<Image2D> expected = mipmaps(image, MipmapFilter::Kaiser);
+    for(const TileOrder order: {TileOrder::RowMajor, TileOrder::Morton}) {
+        std::vector<Image2D> result = mipmaps(TiledImage2D{image, order, 16}, MipmapFilter::Kaiser, {}, 2);
+        CORRADE_COMPARE(result.size(), expected.size());
+        for(std::size_t i = 0; i != expected.size(); ++i) {
+            CORRADE_COMPARE(result[i].format(), PixelFormat::RGB8Unorm);
+            CORRADE_COMPARE(result[i].size(), expected[i].size());
+            CORRADE_COMPARE_AS(result[i].data(), expected[i].data(),
+                TestSuite::Compare::Container);
+        }
+    }
+}
+
+void MipmapTest::debugFilter() {
+    std::ostringstream out;
+    Debug{&out} << MipmapFilter::Kaiser << MipmapFilter(0xde);
+    CORRADE_COMPARE(out.str(), "TextureTools::MipmapFilter::Kaiser TextureTools::MipmapFilter(0xde)\n");
+}
+
+void MipmapTest::debugFlag() {
+    std::ostringstream out;
+    Debug{&out} << MipmapFlag::Srgb << MipmapFlag(0xde);
+    CORRADE_COMPARE(out.str(), "TextureTools::MipmapFlag::Srgb TextureTools::MipmapFlag(0xde)\n");
+}
+
+void MipmapTest::debugFlags() {
+    std::ostringstream out;
+    Debug{&out} << MipmapFlags{} << (MipmapFlag::Srgb|MipmapFlag(0xf0));
+    CORRADE_COMPARE(out.str(), "TextureTools::MipmapFlags{} TextureTools::MipmapFlag::Srgb|TextureTools::MipmapFlag(0xf0)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::MipmapTest)
@@ -0,0 +1,255 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/TextureTools/TiledImage.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct TiledImageTest: TestSuite::Tester {
+    explicit TiledImageTest();
+
+    void construct();
+    void constructImageRowMajor();
+    void constructImageMorton();
+    void constructMove();
+
+    void tile();
+    void roundtrip();
+    void multithreaded();
+
+    void setSubImage();
+    void setSubImageRotated();
+
+    void debugTileOrder();
+};
+
+TiledImageTest::TiledImageTest() {
+    addTests({&TiledImageTest::construct,
+              &TiledImageTest::constructImageRowMajor,
+              &TiledImageTest::constructImageMorton,
+              &TiledImageTest::constructMove,
+
+              &TiledImageTest::tile,
+              &TiledImageTest::roundtrip,
+              &TiledImageTest::multithreaded,
+
+              &TiledImageTest::setSubImage,
+              &TiledImageTest::setSubImageRotated,
+
+              &TiledImageTest::debugTileOrder});
+}
+
+namespace {
+
+/* 5x3 image with pixel values 10*y + x */
+const UnsignedByte Data[]{
+     0,  1,  2,  3,  4, 0, 0, 0,
+    10, 11, 12, 13, 14, 0, 0, 0,
+    20, 21, 22, 23, 24, 0, 0, 0
+};
+
+}
+
+void TiledImageTest::construct() {
+    TiledImage2D image{PixelFormat::RG8Unorm, {5, 3}, TileOrder::RowMajor, 4};
+    CORRADE_COMPARE(image.format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(image.formatExtra(), 0);
+    CORRADE_COMPARE(image.pixelSize(), 2);
+    CORRADE_COMPARE(image.size(), (Vector2i{5, 3}));
+    CORRADE_COMPARE(image.order(), TileOrder::RowMajor);
+    CORRADE_COMPARE(image.tileSize(), 4);
+    CORRADE_COMPARE(image.tileCount(), (Vector2i{2, 1}));
+
+    /* Padded to whole tiles and zero-filled */
+    CORRADE_COMPARE(image.data().size(), 2*4*4*2);
+    for(char i: image.data()) CORRADE_COMPARE(i, 0);
+}
+
+void TiledImageTest::constructImageRowMajor() {
+    TiledImage2D image{ImageView2D{PixelFormat::R8Unorm, {5, 3}, Data}, TileOrder::RowMajor, 4};
+    CORRADE_COMPARE(image.format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(image.size(), (Vector2i{5, 3}));
+    CORRADE_COMPARE(image.tileCount(), (Vector2i{2, 1}));
+
+    CORRADE_COMPARE(image.pixelOffset({0, 0}), 0);
+    CORRADE_COMPARE(image.pixelOffset({3, 0}), 3);
+    CORRADE_COMPARE(image.pixelOffset({1, 2}), 9);
+    CORRADE_COMPARE(image.pixelOffset({4, 1}), 20);
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(image.data()), (Containers::Array<UnsignedByte>{Containers::InPlaceInit, {
+         0,  1,  2,  3,
+        10, 11, 12, 13,
+        20, 21, 22, 23,
+         0,  0,  0,  0,
+
+         4,  0,  0,  0,
+        14,  0,  0,  0,
+        24,  0,  0,  0,
+         0,  0,  0,  0}}), TestSuite::Compare::Container);
+}
+
+void TiledImageTest::constructImageMorton() {
+    TiledImage2D image{ImageView2D{PixelFormat::R8Unorm, {5, 3}, Data}, TileOrder::Morton, 4};
+    CORRADE_COMPARE(image.order(), TileOrder::Morton);
+
+    CORRADE_COMPARE(image.pixelOffset({0, 0}), 0);
+    CORRADE_COMPARE(image.pixelOffset({1, 0}), 1);
+    CORRADE_COMPARE(image.pixelOffset({0, 1}), 2);
+    CORRADE_COMPARE(image.pixelOffset({2, 0}), 4);
+    CORRADE_COMPARE(image.pixelOffset({3, 3}), 15);
+    CORRADE_COMPARE(image.pixelOffset({4, 1}), 18);
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(image.data()), (Containers::Array<UnsignedByte>{Containers::InPlaceInit, {
+         0,  1, 10, 11,
+         2,  3, 12, 13,
+        20, 21,  0,  0,
+        22, 23,  0,  0,
+
+         4,  0, 14,  0,
+         0,  0,  0,  0,
+        24,  0,  0,  0,
+         0,  0,  0,  0}}), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(image.pixel<UnsignedByte>({3, 2}), 23);
+    image.pixel<UnsignedByte>({3, 2}) = 99;
+    CORRADE_COMPARE(image.data()[13], char(99));
+}
+
+void TiledImageTest::constructMove() {
+    TiledImage2D a{PixelFormat::RGBA8Unorm, {5, 3}, TileOrder::Morton, 4};
+    const char* data = a.data().data();
+
+    TiledImage2D b{std::move(a)};
+    CORRADE_COMPARE(b.size(), (Vector2i{5, 3}));
+    CORRADE_COMPARE(b.data().data(), data);
+    CORRADE_VERIFY(!a.data().data());
+
+    TiledImage2D c{PixelFormat::R8Unorm, {1, 1}};
+    c = std::move(b);
+    CORRADE_COMPARE(c.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(c.data().data(), data);
+}
+
+void TiledImageTest::tile() {
+    TiledImage2D image{ImageView2D{PixelFormat::R8Unorm, {5, 3}, Data}, TileOrder::RowMajor, 4};
+    const TiledImage2D& cimage = image;
+
+    CORRADE_COMPARE(image.tile({1, 0}).size(), 16);
+    CORRADE_COMPARE(image.tile({1, 0}).data(), image.data().data() + 16);
+    CORRADE_COMPARE(cimage.tile({1, 0})[4], 14);
+}
+
+void TiledImageTest::roundtrip() {
+    /* Non-default alignment and a skip to verify the pixel storage is
+       respected */
+    UnsignedByte data[2 + 67*33*3];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i] = UnsignedByte(i*37 + i/7);
+    const ImageView2D input{PixelStorage{}.setAlignment(1).setSkip({2, 0, 0}), PixelFormat::R8Unorm, {67, 99}, data};
+
+    for(const TileOrder order: {TileOrder::RowMajor, TileOrder::Morton}) {
+        for(const Int tileSize: {1, 8, 128}) {
+            const TiledImage2D tiled{input, order, tileSize};
+            const Image2D output = tiled.image();
+            CORRADE_COMPARE(output.format(), PixelFormat::R8Unorm);
+            CORRADE_COMPARE(output.size(), (Vector2i{67, 99}));
+            CORRADE_COMPARE(output.storage().alignment(), 4);
+
+            for(Int y = 0; y != 99; ++y) {
+                CORRADE_COMPARE_AS(output.data().slice(y*68, y*68 + 67),
+                    Containers::arrayView(data).slice(2 + y*67, 2 + (y + 1)*67),
+                    TestSuite::Compare::Container);
+            }
+        }
+    }
+}
+
+void TiledImageTest::multithreaded() {
+    UnsignedByte data[67*33*4];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i] = UnsignedByte(i*37 + i/7);
+    const ImageView2D input{PixelFormat::RGBA8Unorm, {67, 33}, data};
+
+    const TiledImage2D single{input, TileOrder::Morton, 16};
+    const TiledImage2D multi{input, TileOrder::Morton, 16, 4};
+    CORRADE_COMPARE_AS(multi.data(), single.data(),
+        TestSuite::Compare::Container);
+    const Image2D image = multi.image(4);
+    CORRADE_COMPARE_AS(image.data(), Containers::arrayView(reinterpret_cast<const char*>(data), sizeof(data)),
+        TestSuite::Compare::Container);
+}
+
+void TiledImageTest::setSubImage() {
+    const UnsignedByte data[]{
+        1, 2, 3, 0,
+        4, 5, 6, 0
+    };
+
+    TiledImage2D image{PixelFormat::R8Unorm, {5, 5}, TileOrder::RowMajor, 4};
+    image.setSubImage({{2, 1}, {5, 3}}, ImageView2D{PixelFormat::R8Unorm, {3, 2}, data});
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(image.image().data()), (Containers::Array<UnsignedByte>{Containers::InPlaceInit, {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 2, 3, 0, 0, 0,
+        0, 0, 4, 5, 6, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0}}), TestSuite::Compare::Container);
+}
+
+void TiledImageTest::setSubImageRotated() {
+    const UnsignedByte data[]{
+        1, 2, 3, 0,
+        4, 5, 6, 0
+    };
+
+    /* Rotated counterclockwise, so the first row ends up in the rightmost
+       column */
+    TiledImage2D image{PixelFormat::R8Unorm, {5, 5}, TileOrder::Morton, 4};
+    image.setSubImage({{1, 1}, {3, 4}}, ImageView2D{PixelFormat::R8Unorm, {3, 2}, data});
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(image.image().data()), (Containers::Array<UnsignedByte>{Containers::InPlaceInit, {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4, 1, 0, 0, 0, 0, 0,
+        0, 5, 2, 0, 0, 0, 0, 0,
+        0, 6, 3, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0}}), TestSuite::Compare::Container);
+}
+
+void TiledImageTest::debugTileOrder() {
+    std::ostringstream out;
+    Debug{&out} << TileOrder::Morton << TileOrder(0xde);
+    CORRADE_COMPARE(out.str(), "TextureTools::TileOrder::Morton TextureTools::TileOrder(0xde)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::TiledImageTest)
@@ -0,0 +1,146 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TiledImage.h"
+
+#include <cstring>
+#include <tuple>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace TextureTools {
+
+TiledImage2D::TiledImage2D(const PixelFormat format, const UnsignedInt formatExtra, const UnsignedInt pixelSize, const Vector2i& size, const TileOrder order, const Int tileSize): _format{format}, _formatExtra{formatExtra}, _pixelSize{pixelSize}, _size{size}, _order{order}, _tileSize{tileSize}, _tileShift{}, _tileCount{} {
+    CORRADE_ASSERT(tileSize > 0 && tileSize <= 65536 && !(tileSize & (tileSize - 1)),
+        "TextureTools::TiledImage2D: expected tile size to be a power of two not larger than 65536, got" << tileSize, );
+    CORRADE_ASSERT((size >= Vector2i{}).all(),
+        "TextureTools::TiledImage2D: expected non-negative size, got" << size, );
+
+    _tileShift = Math::log2(UnsignedInt(tileSize));
+    _tileCount = (size + Vector2i{tileSize - 1}) >> _tileShift;
+    _data = Containers::Array<char>{Containers::ValueInit, std::size_t(_tileCount.product())*tileSize*tileSize*pixelSize};
+}
+
+TiledImage2D::TiledImage2D(const PixelFormat format, const Vector2i& size, const TileOrder order, const Int tileSize): TiledImage2D{format, 0, Magnum::pixelSize(format), size, order, tileSize} {}
+
+TiledImage2D::TiledImage2D(const ImageView2D& image, const TileOrder order, const Int tileSize, const UnsignedInt threadCount): TiledImage2D{image.format(), image.formatExtra(), image.pixelSize(), image.size(), order, tileSize} {
+    /* Invalid tile size, nothing to copy into */
+    if(!_tileShift && _tileSize != 1) return;
+
+    setSubImage({{}, image.size()}, image, threadCount);
+}
+
+Containers::ArrayView<char> TiledImage2D::tile(const Vector2i& tile) {
+    CORRADE_ASSERT((tile >= Vector2i{}).all() && (tile < _tileCount).all(),
+        "TextureTools::TiledImage2D::tile(): tile" << tile << "out of range for" << _tileCount << "tiles", {});
+    const std::size_t tileDataSize = std::size_t(_tileSize)*_tileSize*_pixelSize;
+    return {_data + (std::size_t(tile.y())*_tileCount.x() + tile.x())*tileDataSize, tileDataSize};
+}
+
+Containers::ArrayView<const char> TiledImage2D::tile(const Vector2i& tile) const {
+    return const_cast<TiledImage2D&>(*this).tile(tile);
+}
+
+TiledImage2D& TiledImage2D::setSubImage(const Range2Di& rectangle, const ImageView2D& image, UnsignedInt threadCount) {
+    const Vector2i imageSize = image.size();
+    CORRADE_ASSERT(image.pixelSize() == _pixelSize,
+        "TextureTools::TiledImage2D::setSubImage(): expected pixel size" << _pixelSize << "but got" << image.pixelSize(), *this);
+    CORRADE_ASSERT(rectangle.size() == imageSize || rectangle.size() == Vector2i{imageSize.y(), imageSize.x()},
+        "TextureTools::TiledImage2D::setSubImage(): expected rectangle of size" << imageSize << "or" << Vector2i{imageSize.y(), imageSize.x()} << "but got" << rectangle.size(), *this);
+    CORRADE_ASSERT((rectangle.min() >= Vector2i{}).all() && (rectangle.max() <= _size).all(),
+        "TextureTools::TiledImage2D::setSubImage(): rectangle" << rectangle << "out of range for an image of size" << _size, *this);
+
+    if(!threadCount) threadCount = 1;
+
+    const char* const imageData = image.data() + std::get<0>(image.dataProperties()).sum();
+    const std::size_t imageRowStride = std::get<1>(image.dataProperties()).x();
+    const Vector2i min = rectangle.min();
+
+    /* A rotated square has the same size, so it's treated as not rotated.
+       Each source row goes to a different row or column of the target, so
+       the rows can be copied in parallel. */
+    const bool rotated = rectangle.size() != imageSize;
+    Magnum::Implementation::parallelFor(threadCount, imageSize.y(), [&](const std::size_t y) {
+        const char* const row = imageData + y*imageRowStride;
+        if(rotated) {
+            for(Int x = 0; x != imageSize.x(); ++x)
+                std::memcpy(_data + pixelOffset(min + Vector2i{imageSize.y() - 1 - Int(y), x}), row + x*_pixelSize, _pixelSize);
+            return;
+        }
+
+        /* With row-major order the pixels are contiguous until the end of
+           the tile row, with Morton order only pixel by pixel */
+        for(Int x = 0; x != imageSize.x(); ) {
+            const Vector2i position = min + Vector2i{x, Int(y)};
+            const Int count = _order == TileOrder::RowMajor ?
+                Math::min(imageSize.x() - x, _tileSize - (position.x() & (_tileSize - 1))) : 1;
+            std::memcpy(_data + pixelOffset(position), row + x*_pixelSize, count*_pixelSize);
+            x += count;
+        }
+    });
+
+    return *this;
+}
+
+Image2D TiledImage2D::image(UnsignedInt threadCount) const {
+    if(!threadCount) threadCount = 1;
+
+    /* Output with default pixel storage */
+    const std::size_t rowStride = (_pixelSize*_size.x() + 3)/4*4;
+    Containers::Array<char> data{Containers::ValueInit, rowStride*_size.y()};
+    Magnum::Implementation::parallelFor(threadCount, _size.y(), [&](const std::size_t y) {
+        char* const row = data + y*rowStride;
+        for(Int x = 0; x != _size.x(); ) {
+            const Vector2i position{x, Int(y)};
+            const Int count = _order == TileOrder::RowMajor ?
+                Math::min(_size.x() - x, _tileSize - (x & (_tileSize - 1))) : 1;
+            std::memcpy(row + x*_pixelSize, _data + pixelOffset(position), count*_pixelSize);
+            x += count;
+        }
+    });
+
+    return Image2D{PixelStorage{}, _format, _formatExtra, _pixelSize, _size, std::move(data)};
+}
+
+Debug& operator<<(Debug& debug, const TileOrder value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case TileOrder::value: return debug << "TextureTools::TileOrder::" #value;
+        _c(RowMajor)
+        _c(Morton)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "TextureTools::TileOrder(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+}}
@@ -0,0 +1,277 @@
+#ifndef Magnum_TextureTools_TiledImage_h
+#define Magnum_TextureTools_TiledImage_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::TextureTools::TiledImage2D, enum @ref Magnum::TextureTools::TileOrder
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Order of pixels inside a tile
+
+@see @ref TiledImage2D
+*/
+enum class TileOrder: UnsignedByte {
+    /** Pixels of each tile are stored row after row */
+    RowMajor,
+
+    /**
+     * Pixels of each tile are stored in Morton (Z-order), interleaving bits
+     * of the X and Y coordinate. Neighbors in both directions are then close
+     * in memory, which makes kernels that look at a 2D neighborhood of a
+     * pixel cache-friendly even for the largest tile sizes.
+     */
+    Morton
+};
+
+/** @debugoperatorenum{TileOrder} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, TileOrder value);
+
+/**
+@brief Two-dimensional image stored in tiles
+
+Stores pixels in square tiles of @ref tileSize() pixels, with the tiles
+following each other row after row and pixels inside each tile either also
+row after row or in Morton order, depending on @ref order(). Operations that
+walk a 2D neighborhood of each pixel or go column-wise through the image ---
+such as @ref distanceField(const TiledImage2D&, const Vector2i&, Int, UnsignedInt) ---
+touch only a few tiles at a time instead of striding through the whole row
+of a linear image, which on large images means far less cache misses.
+
+@section TextureTools-TiledImage2D-conversion Conversion from and to linear images
+
+A tiled image is created from a linear @ref ImageView2D in the constructor
+and converted back using @ref image(). Both conversions go tile by tile and
+can be distributed among multiple threads:
+
+@code{.cpp}
+TextureTools::TiledImage2D tiled{image, TextureTools::TileOrder::Morton, 32,
+    std::thread::hardware_concurrency()};
+
+Image2D distanceField = TextureTools::distanceField(tiled, {256, 256}, 24);
+@endcode
+
+Edge tiles are padded with zeros if the size is not a multiple of the tile
+size. The padding is not visible through any API except @ref data().
+
+@section TextureTools-TiledImage2D-atlas Atlas blitting
+
+@ref setSubImage() copies a linear image into a rectangle of the tiled image,
+optionally rotated by 90°. Together with @ref AtlasPacker this can be used to
+assemble large atlases on the CPU:
+
+@code{.cpp}
+TextureTools::AtlasPacker packer{{4096, 4096}, {1, 1},
+    TextureTools::AtlasPacker::Flag::AllowRotation};
+TextureTools::TiledImage2D atlas{PixelFormat::R8Unorm, packer.size()};
+for(const ImageView2D& glyph: glyphs)
+    atlas.setSubImage(*packer.add(glyph.size()), glyph);
+@endcode
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT TiledImage2D {
+    public:
+        /**
+         * @brief Construct a zero-filled image
+         * @param format    Pixel format
+         * @param size      Image size
+         * @param order     Order of pixels inside a tile
+         * @param tileSize  Size of one tile side in pixels. Expected to be a
+         *      power of two.
+         */
+        explicit TiledImage2D(PixelFormat format, const Vector2i& size, TileOrder order = TileOrder::Morton, Int tileSize = 32);
+
+        /**
+         * @brief Construct from a linear image
+         * @param image         Linear image
+         * @param order         Order of pixels inside a tile
+         * @param tileSize      Size of one tile side in pixels. Expected to
+         *      be a power of two.
+         * @param threadCount   Thread count used for the conversion,
+         *      including the calling thread. Value of @cpp 0 @ce is treated
+         *      the same as @cpp 1 @ce.
+         *
+         * Takes the format, size and pixels of @p image. Multithreaded
+         * conversion is not available on
+         * @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where @p threadCount
+         * is ignored.
+         */
+        explicit TiledImage2D(const ImageView2D& image, TileOrder order = TileOrder::Morton, Int tileSize = 32, UnsignedInt threadCount = 1);
+
+        /** @brief Copying is not allowed */
+        TiledImage2D(const TiledImage2D&) = delete;
+
+        /** @brief Move constructor */
+        TiledImage2D(TiledImage2D&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        TiledImage2D& operator=(const TiledImage2D&) = delete;
+
+        /** @brief Move assignment */
+        TiledImage2D& operator=(TiledImage2D&&) noexcept = default;
+
+        /** @brief Format of pixel data */
+        PixelFormat format() const { return _format; }
+
+        /**
+         * @brief Additional pixel format specifier
+         *
+         * Taken from the source @ref ImageView2D, zero if the image was
+         * constructed from a @ref PixelFormat.
+         */
+        UnsignedInt formatExtra() const { return _formatExtra; }
+
+        /** @brief Pixel size in bytes */
+        UnsignedInt pixelSize() const { return _pixelSize; }
+
+        /** @brief Image size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Order of pixels inside a tile */
+        TileOrder order() const { return _order; }
+
+        /** @brief Size of one tile side in pixels */
+        Int tileSize() const { return _tileSize; }
+
+        /**
+         * @brief Tile count
+         *
+         * Image size divided by @ref tileSize() and rounded up.
+         */
+        Vector2i tileCount() const { return _tileCount; }
+
+        /**
+         * @brief Raw tile data
+         *
+         * Contains @cpp tileCount().product() @ce tiles, each of
+         * @cpp tileSize()*tileSize()*pixelSize() @ce bytes.
+         */
+        Containers::ArrayView<char> data() { return _data; }
+        Containers::ArrayView<const char> data() const { return _data; } /**< @overload */
+
+        /**
+         * @brief Data of one tile
+         *
+         * Expects that @p tile is less than @ref tileCount().
+         */
+        Containers::ArrayView<char> tile(const Vector2i& tile);
+        Containers::ArrayView<const char> tile(const Vector2i& tile) const; /**< @overload */
+
+        /**
+         * @brief Offset of a pixel in @ref data()
+         *
+         * Offset in bytes of pixel at @p position, which is expected to be
+         * less than @ref size() (not checked). Cheap enough to be called for
+         * each pixel, but iterating over @ref tile() is faster.
+         */
+        std::size_t pixelOffset(const Vector2i& position) const {
+            const Vector2i tile = position >> _tileShift;
+            const Vector2i inTile = position & Vector2i{_tileSize - 1};
+            const std::size_t inTileOffset = _order == TileOrder::Morton ?
+                interleave(UnsignedInt(inTile.x()))|(interleave(UnsignedInt(inTile.y())) << 1) :
+                std::size_t(inTile.y() << _tileShift) + inTile.x();
+            return (((std::size_t(tile.y())*_tileCount.x() + tile.x()) << 2*_tileShift) + inTileOffset)*_pixelSize;
+        }
+
+        /**
+         * @brief Pixel at given position
+         *
+         * Expects that @p position is less than @ref size() (not checked)
+         * and that @p T has the size of @ref pixelSize(). See
+         * @ref pixelOffset() for more information.
+         */
+        template<class T> T& pixel(const Vector2i& position) {
+            return *reinterpret_cast<T*>(_data + pixelOffset(position));
+        }
+        template<class T> const T& pixel(const Vector2i& position) const {
+            return *reinterpret_cast<const T*>(_data + pixelOffset(position));
+        } /**< @overload */
+
+        /**
+         * @brief Copy a linear image into a rectangle
+         * @param rectangle     Target rectangle
+         * @param image         Linear image
+         * @param threadCount   Thread count used for the copy, including the
+         *      calling thread. Value of @cpp 0 @ce is treated the same as
+         *      @cpp 1 @ce.
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p image has the same pixel size, that
+         * @p rectangle is inside @ref size() and that its size is either the
+         * same as @p image size or the same with X and Y swapped. In the
+         * latter case the image is rotated by 90° counterclockwise, which is
+         * how ranges returned from @ref AtlasPacker with
+         * @ref AtlasPacker::Flag::AllowRotation are meant --- pixel
+         * @f$ (x, y) @f$ of @p image ends up at
+         * @f$ (h - 1 - y, x) @f$ relative to the rectangle origin, with
+         * @f$ h @f$ being the image height. Square images are never
+         * rotated.
+         */
+        TiledImage2D& setSubImage(const Range2Di& rectangle, const ImageView2D& image, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Convert to a linear image
+         * @param threadCount   Thread count used for the conversion,
+         *      including the calling thread. Value of @cpp 0 @ce is treated
+         *      the same as @cpp 1 @ce.
+         *
+         * The returned image has the same format and size and default
+         * @ref PixelStorage parameters.
+         */
+        Image2D image(UnsignedInt threadCount = 1) const;
+
+    private:
+        /* Spreads lower 16 bits of the value to even bits */
+        static std::size_t interleave(UnsignedInt value) {
+            value = (value | (value << 8)) & 0x00ff00ff;
+            value = (value | (value << 4)) & 0x0f0f0f0f;
+            value = (value | (value << 2)) & 0x33333333;
+            value = (value | (value << 1)) & 0x55555555;
+            return value;
+        }
+
+        explicit TiledImage2D(PixelFormat format, UnsignedInt formatExtra, UnsignedInt pixelSize, const Vector2i& size, TileOrder order, Int tileSize);
+
+        PixelFormat _format;
+        UnsignedInt _formatExtra, _pixelSize;
+        Vector2i _size;
+        TileOrder _order;
+        Int _tileSize, _tileShift;
+        Vector2i _tileCount;
+        Containers::Array<char> _data;
+};
+
+}}
+
+#endif
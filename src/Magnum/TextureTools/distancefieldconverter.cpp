@@ -87,8 +87,8 @@ information.
 
 @code{.sh}
 magnum-distancefieldconverter [--magnum-...] [-h|--help] [--importer IMPORTER]
-    [--converter CONVERTER] [--plugin-dir DIR] --output-size "X Y" --radius N
-    [--] input output
+    [--converter CONVERTER] [--plugin-dir DIR] [--cpu] [--threads N]
+    --output-size "X Y" --radius N [--] input output
 @endcode
 
 Arguments:
@@ -101,6 +101,10 @@ Arguments:
 -   `--converter CONVERTER` --- image converter plugin (default:
     @ref Trade::AnyImageConverter "AnyImageConverter")
 -   `--plugin-dir DIR` --- override base plugin dir
+-   `--cpu` --- compute the distance field on the CPU instead of the GPU,
+    without creating any GL context
+-   `--threads N` --- thread count used for the CPU computation (default:
+    @cpp 1 @ce)
 -   `--output-size "X Y"` --- size of output image
 -   `--radius N` --- distance field computation radius
 -   `--magnum-...` --- engine-specific options (see
@@ -123,6 +127,13 @@ This will open monochrome `logo-src.png` image using any plugin that can open
 PNG files and converts it to 256x256 distance field `logo.png` using any plugin
 that can write PNG files.
 
+@code{.sh}
+magnum-distancefieldconverter --cpu --threads 8 --output-size "256 256" --radius 24 logo-src.png logo.png
+@endcode
+
+The same, but computed on eight CPU threads, which works also on machines
+without a GPU.
+
 */
 
 namespace TextureTools {
@@ -143,13 +154,16 @@ DistanceFieldConverter::DistanceFieldConverter(const Arguments& arguments): Plat
         .addOption("importer", "AnyImageImporter").setHelp("importer", "image importer plugin")
         .addOption("converter", "AnyImageConverter").setHelp("converter", "image converter plugin")
         .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
+        .addBooleanOption("cpu").setHelp("cpu", "compute the distance field on the CPU")
+        .addOption("threads", "1").setHelp("threads", "thread count used for the CPU computation", "N")
         .addNamedArgument("output-size").setHelp("output-size", "size of output image", "\"X Y\"")
         .addNamedArgument("radius").setHelp("radius", "distance field computation radius", "N")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setHelp("Converts red channel of an image to distance field representation.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext();
+    /* The CPU implementation doesn't need any GL context */
+    if(!args.isSet("cpu")) createContext();
 }
 
 int DistanceFieldConverter::exec() {
@@ -174,6 +188,25 @@ int DistanceFieldConverter::exec() {
         return 3;
     }
 
+    /* Compute on the CPU, if requested */
+    if(args.isSet("cpu")) {
+        if(image->format() != PixelFormat::R8Unorm &&
+           image->format() != PixelFormat::RGB8Unorm &&
+           image->format() != PixelFormat::RGBA8Unorm) {
+            Error() << "Unsupported image format" << image->format();
+            return 4;
+        }
+
+        Debug() << "Converting image of size" << image->size() << "to distance field on the CPU...";
+        const Image2D result = TextureTools::distanceField(*image, args.value<Vector2i>("output-size"), args.value<Int>("radius"), args.value<UnsignedInt>("threads"));
+        if(!converter->exportToFile(result, args.value("output"))) {
+            Error() << "Cannot save file" << args.value("output");
+            return 5;
+        }
+
+        return 0;
+    }
+
     /* Decide about internal format */
     GL::TextureFormat internalFormat;
     if(image->format() == PixelFormat::R8Unorm)
@@ -25,10 +25,14 @@
 
 #include "Timeline.h"
 
+#include <algorithm>
+#include <cmath>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/System.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/ScratchArena.h"
+#include "Magnum/Math/Functions.h"
 
 using namespace std::chrono;
 
@@ -39,6 +43,11 @@ void Timeline::start() {
     _startTime = high_resolution_clock::now();
     _previousFrameTime = _startTime;
     _previousFrameDuration = 0;
+
+    if(_frameArena) {
+        _frameArena->reset();
+        ScratchArena::setCurrent(_frameArena);
+    }
 }
 
 void Timeline::stop() {
@@ -46,6 +55,12 @@ void Timeline::stop() {
     _startTime = high_resolution_clock::time_point();
     _previousFrameTime = _startTime;
     _previousFrameDuration = 0;
+
+    if(_frameArena) {
+        if(ScratchArena::current() == _frameArena)
+            ScratchArena::setCurrent(nullptr);
+        _frameArena->reset();
+    }
 }
 
 void Timeline::nextFrame() {
@@ -55,10 +70,95 @@ void Timeline::nextFrame() {
     auto duration = UnsignedInt(duration_cast<microseconds>(now-_previousFrameTime).count());
     _previousFrameDuration = duration/1e6f;
     _previousFrameTime = now;
+    recordFrameDuration(_previousFrameDuration);
+
+    /* Everything allocated during the frame is no longer needed */
+    if(_frameArena) _frameArena->reset();
+}
+
+Timeline& Timeline::setFrameArena(ScratchArena* const arena) {
+    /* Unset the previous one if it's current */
+    if(_frameArena && ScratchArena::current() == _frameArena)
+        ScratchArena::setCurrent(nullptr);
+
+    _frameArena = arena;
+    if(running && arena) ScratchArena::setCurrent(arena);
+    return *this;
 }
 
 Float Timeline::previousFrameTime() const {
     return duration_cast<microseconds>(_previousFrameTime-_startTime).count()/1e6f;
 }
 
+Timeline& Timeline::setFrameStatisticsSize(const std::size_t size) {
+    _frameDurations.assign(size, 0.0f);
+    _scratch.reserve(size);
+    resetFrameStatistics();
+    return *this;
+}
+
+void Timeline::resetFrameStatistics() {
+    _frameDurationsNext = _frameDurationsCount = 0;
+    _hitchCount = 0;
+}
+
+void Timeline::recordFrameDuration(const Float duration) {
+    if(_frameDurations.empty()) return;
+
+    _frameDurations[_frameDurationsNext] = duration;
+    _frameDurationsNext = (_frameDurationsNext + 1) % _frameDurations.size();
+    if(_frameDurationsCount < _frameDurations.size()) ++_frameDurationsCount;
+    if(duration > _hitchThreshold) ++_hitchCount;
+}
+
+namespace {
+
+/* Nearest-rank index, clamped so percentile 0 gives the minimum */
+std::size_t percentileIndex(const std::size_t count, const Float percentile) {
+    const std::size_t rank = std::size_t(std::ceil(Math::clamp(percentile, 0.0f, 1.0f)*count));
+    return rank ? rank - 1 : 0;
+}
+
+}
+
+Float Timeline::frameDurationPercentile(const Float percentile) const {
+    if(!_frameDurationsCount) return 0.0f;
+
+    /* The ring buffer is either full or filled from the start, so the
+       recorded durations are always the first _frameDurationsCount items */
+    _scratch.assign(_frameDurations.begin(), _frameDurations.begin() + _frameDurationsCount);
+    const auto nth = _scratch.begin() + percentileIndex(_scratch.size(), percentile);
+    std::nth_element(_scratch.begin(), nth, _scratch.end());
+    return *nth;
+}
+
+Timeline::FrameStatistics Timeline::frameStatistics() const {
+    FrameStatistics out{UnsignedInt(_frameDurationsCount), 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, _hitchCount};
+    if(!_frameDurationsCount) return out;
+
+    _scratch.assign(_frameDurations.begin(), _frameDurations.begin() + _frameDurationsCount);
+    std::sort(_scratch.begin(), _scratch.end());
+
+    Double sum = 0.0;
+    for(const Float duration: _scratch) sum += duration;
+
+    out.min = _scratch.front();
+    out.max = _scratch.back();
+    out.mean = Float(sum/_scratch.size());
+    out.p50 = _scratch[percentileIndex(_scratch.size(), 0.50f)];
+    out.p95 = _scratch[percentileIndex(_scratch.size(), 0.95f)];
+    out.p99 = _scratch[percentileIndex(_scratch.size(), 0.99f)];
+    return out;
+}
+
+Debug& operator<<(Debug& debug, const Timeline::FrameStatistics& value) {
+    return debug << value.frameCount << "frames, min" << value.min*1000.0f
+        << Debug::nospace << "ms, mean" << value.mean*1000.0f
+        << Debug::nospace << "ms, p50" << value.p50*1000.0f
+        << Debug::nospace << "ms, p95" << value.p95*1000.0f
+        << Debug::nospace << "ms, p99" << value.p99*1000.0f
+        << Debug::nospace << "ms, max" << value.max*1000.0f
+        << Debug::nospace << "ms," << value.hitchCount << "hitches";
+}
+
 }
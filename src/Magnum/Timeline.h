@@ -30,9 +30,11 @@
  */
 
 #include <chrono>
+#include <vector>
 
-#include "Magnum/Types.h"
+#include "Magnum/Magnum.h"
 #include "Magnum/visibility.h"
+#include "Magnum/Math/Constants.h"
 
 namespace Magnum {
 
@@ -85,21 +87,75 @@ void MyApplication::drawEvent() {
     timeline.nextFrame();
 }
 @endcode
+
+@section Timeline-statistics Frame time statistics
+
+Averages hide occasional long frames, which are the ones noticeable by the
+user. Call @ref setFrameStatisticsSize() to keep durations of the last few
+frames in a ring buffer, from which @ref frameDurationPercentile() and
+@ref frameStatistics() calculate the median and tail latency. Frames longer
+than @ref hitchThreshold() are additionally counted in @ref hitchCount()
+for the whole time the statistics are enabled, not just for the frames that
+are currently in the ring buffer.
+
+@code{.cpp}
+timeline.setFrameStatisticsSize(600)
+    .setHitchThreshold(1.0f/30.0f);
+
+// ...
+
+if(timeline.recordedFrameCount() == timeline.frameStatisticsSize())
+    Debug{} << timeline.frameStatistics();
+@endcode
+
+The statistics are updated in @ref nextFrame() without any allocation.
+Calculating the percentiles copies the recorded durations to an internal
+scratch buffer and partially sorts them, so it's linear in the ring buffer
+size and should be done only when the values are reported, not every frame.
+Durations measured elsewhere, such as GPU times from
+@ref DebugTools::Profiler, can be recorded using @ref recordFrameDuration().
+
+@section Timeline-frame-arena Frame arena
+
+Set a @ref ScratchArena with @ref setFrameArena() to make library code take
+its per-frame temporaries from it instead of the heap. The timeline makes the
+arena current for the thread calling @ref start() and resets it in each
+@ref nextFrame(), so once the arena grows to the size needed by a frame, the
+steady-state frames don't allocate anything. See @ref ScratchArena-frame for
+more information.
 */
 class MAGNUM_EXPORT Timeline {
     public:
+        /**
+         * @brief Frame statistics
+         *
+         * @see @ref frameStatistics()
+         */
+        struct FrameStatistics {
+            UnsignedInt frameCount;     /**< @brief Recorded frame count */
+            Float min;                  /**< @brief Minimal frame duration */
+            Float max;                  /**< @brief Maximal frame duration */
+            Float mean;                 /**< @brief Mean frame duration */
+            Float p50;                  /**< @brief Median frame duration */
+            Float p95;                  /**< @brief 95th percentile of frame durations */
+            Float p99;                  /**< @brief 99th percentile of frame durations */
+            UnsignedLong hitchCount;    /**< @brief Hitch count */
+        };
+
         /**
          * @brief Constructor
          *
-         * Creates stopped timeline.
-         * @see @ref start()
+         * Creates stopped timeline with frame statistics disabled.
+         * @see @ref start(), @ref setFrameStatisticsSize()
          */
-        explicit Timeline(): _previousFrameDuration(0), running(false) {}
+        explicit Timeline(): _previousFrameDuration(0), running(false), _hitchThreshold{Constants::inf()}, _frameDurationsNext{}, _frameDurationsCount{}, _hitchCount{}, _frameArena{} {}
 
         /**
          * @brief Start timeline
          *
-         * Sets previous frame time and duration to @cpp 0 @ce.
+         * Sets previous frame time and duration to @cpp 0 @ce. If a
+         * @ref frameArena() is set, resets it and makes it current for the
+         * calling thread.
          * @see @ref stop(), @ref previousFrameDuration()
          */
         void start();
@@ -107,6 +163,8 @@ class MAGNUM_EXPORT Timeline {
         /**
          * @brief Stop timeline
          *
+         * If a @ref frameArena() is set, resets it and, if it's current for
+         * the calling thread, unsets it.
          * @see @ref start(), @ref nextFrame()
          */
         void stop();
@@ -114,6 +172,7 @@ class MAGNUM_EXPORT Timeline {
         /**
          * @brief Advance to next frame
          *
+         * Resets @ref frameArena(), if set.
          * @note This function does nothing if the timeline is stopped.
          * @see @ref stop()
          */
@@ -134,14 +193,130 @@ class MAGNUM_EXPORT Timeline {
          */
         Float previousFrameDuration() const { return _previousFrameDuration; }
 
+        /**
+         * @brief Frame arena
+         *
+         * @cpp nullptr @ce if not set.
+         * @see @ref Timeline-frame-arena
+         */
+        ScratchArena* frameArena() const { return _frameArena; }
+
+        /**
+         * @brief Set frame arena
+         * @return Reference to self (for method chaining)
+         *
+         * The arena is reset in each @ref nextFrame() and is expected to stay
+         * alive until it's replaced or the timeline is stopped. If the
+         * timeline is running, the arena is made current for the calling
+         * thread immediately, otherwise in @ref start(). Pass
+         * @cpp nullptr @ce to unset it. See @ref Timeline-frame-arena for
+         * more information.
+         */
+        Timeline& setFrameArena(ScratchArena* arena);
+
+        /**
+         * @brief Frame statistics ring buffer size
+         *
+         * @see @ref recordedFrameCount()
+         */
+        std::size_t frameStatisticsSize() const { return _frameDurations.size(); }
+
+        /**
+         * @brief Set frame statistics ring buffer size
+         * @return Reference to self (for method chaining)
+         *
+         * Keeps durations of last @p size frames. Default is @cpp 0 @ce,
+         * which disables the statistics. Calls @ref resetFrameStatistics().
+         * See @ref Timeline-statistics for more information.
+         */
+        Timeline& setFrameStatisticsSize(std::size_t size);
+
+        /** @brief Hitch threshold (in seconds) */
+        Float hitchThreshold() const { return _hitchThreshold; }
+
+        /**
+         * @brief Set hitch threshold (in seconds)
+         * @return Reference to self (for method chaining)
+         *
+         * Frames longer than @p threshold are counted in @ref hitchCount().
+         * Default is infinity, i.e. no frame is considered a hitch.
+         */
+        Timeline& setHitchThreshold(Float threshold) {
+            _hitchThreshold = threshold;
+            return *this;
+        }
+
+        /**
+         * @brief Reset frame statistics
+         *
+         * Clears the recorded frame durations and the hitch count. The ring
+         * buffer size and the hitch threshold are kept.
+         */
+        void resetFrameStatistics();
+
+        /**
+         * @brief Record a frame duration (in seconds)
+         *
+         * Called from @ref nextFrame() with @ref previousFrameDuration(), but
+         * can be used also directly for durations measured elsewhere. Does
+         * nothing if the statistics are disabled.
+         */
+        void recordFrameDuration(Float duration);
+
+        /**
+         * @brief Recorded frame count
+         *
+         * At most @ref frameStatisticsSize().
+         */
+        std::size_t recordedFrameCount() const { return _frameDurationsCount; }
+
+        /**
+         * @brief Hitch count
+         *
+         * Count of frames longer than @ref hitchThreshold() since the
+         * statistics were last reset.
+         */
+        UnsignedLong hitchCount() const { return _hitchCount; }
+
+        /**
+         * @brief Frame duration percentile (in seconds)
+         * @param percentile    Percentile in range @f$ [0, 1] @f$
+         *
+         * Uses the nearest-rank method on durations currently in the ring
+         * buffer, so for example @cpp 0.99f @ce returns the shortest
+         * duration that's longer than or equal to 99% of the recorded
+         * frames. Returns @cpp 0.0f @ce if no frames were recorded.
+         * @see @ref frameStatistics()
+         */
+        Float frameDurationPercentile(Float percentile) const;
+
+        /**
+         * @brief Frame statistics
+         *
+         * Calculates all statistics at once, which is faster than calling
+         * @ref frameDurationPercentile() for each percentile separately. If
+         * no frames were recorded, all durations are @cpp 0.0f @ce.
+         */
+        FrameStatistics frameStatistics() const;
+
     private:
         std::chrono::high_resolution_clock::time_point _startTime;
         std::chrono::high_resolution_clock::time_point _previousFrameTime;
         Float _previousFrameDuration;
 
         bool running;
+
+        Float _hitchThreshold;
+        std::size_t _frameDurationsNext, _frameDurationsCount;
+        UnsignedLong _hitchCount;
+        std::vector<Float> _frameDurations;
+        mutable std::vector<Float> _scratch;
+        ScratchArena* _frameArena;
 };
 
+/** @debugoperatorclassenum{Timeline,Timeline::FrameStatistics} */
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, const Timeline::FrameStatistics& value);
+
 }
 
 #endif
@@ -25,6 +25,7 @@
 
 #include "AbstractImageConverter.h"
 
+#include <fstream>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Utility/Assert.h>
@@ -111,6 +112,24 @@ Containers::Array<char> AbstractImageConverter::exportToData(const ImageData2D&
     return image.isCompressed() ? exportToData(CompressedImageView2D(image)) : exportToData(ImageView2D(image));
 }
 
+bool AbstractImageConverter::exportToSink(const ImageView2D& image, bool(*sink)(Containers::ArrayView<const char>, void*), void* userData) {
+    CORRADE_ASSERT(features() >= Feature::ConvertStream || features() >= Feature::ConvertData,
+        "Trade::AbstractImageConverter::exportToSink(): feature not supported", {});
+    CORRADE_ASSERT(sink,
+        "Trade::AbstractImageConverter::exportToSink(): sink can't be null", {});
+
+    return doExportToSink(image, sink, userData);
+}
+
+bool AbstractImageConverter::doExportToSink(const ImageView2D& image, bool(*sink)(Containers::ArrayView<const char>, void*), void* userData) {
+    CORRADE_ASSERT(features() >= Feature::ConvertData, "Trade::AbstractImageConverter::exportToSink(): feature advertised but not implemented", false);
+
+    const auto data = doExportToData(image);
+    if(!data) return false;
+
+    return sink(data, userData);
+}
+
 bool AbstractImageConverter::exportToFile(const ImageView2D& image, const std::string& filename) {
     CORRADE_ASSERT(features() & Feature::ConvertFile,
         "Trade::AbstractImageConverter::exportToFile(): feature not supported", {});
@@ -119,6 +138,29 @@ bool AbstractImageConverter::exportToFile(const ImageView2D& image, const std::s
 }
 
 bool AbstractImageConverter::doExportToFile(const ImageView2D& image, const std::string& filename) {
+    /* Write the chunks directly to the file, if possible */
+    if(features() >= Feature::ConvertStream) {
+        std::ofstream out{filename, std::ofstream::binary};
+        if(!out) {
+            Error() << "Trade::AbstractImageConverter::exportToFile(): cannot write to file" << filename;
+            return false;
+        }
+
+        bool failed = false;
+        std::pair<std::ofstream&, bool&> state{out, failed};
+        if(!doExportToSink(image, [](Containers::ArrayView<const char> data, void* userData) {
+            auto& state = *static_cast<std::pair<std::ofstream&, bool&>*>(userData);
+            if(state.first.write(data.data(), data.size())) return true;
+            state.second = true;
+            return false;
+        }, &state)) {
+            if(failed) Error() << "Trade::AbstractImageConverter::exportToFile(): cannot write to file" << filename;
+            return false;
+        }
+
+        return true;
+    }
+
     CORRADE_ASSERT(features() >= Feature::ConvertData, "Trade::AbstractImageConverter::exportToFile(): feature advertised but not implemented", false);
 
     const auto data = doExportToData(image);
@@ -169,6 +211,7 @@ Debug& operator<<(Debug& debug, const AbstractImageConverter::Feature value) {
         _c(ConvertCompressedFile)
         _c(ConvertData)
         _c(ConvertCompressedData)
+        _c(ConvertStream)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -182,6 +225,7 @@ Debug& operator<<(Debug& debug, const AbstractImageConverter::Features value) {
         AbstractImageConverter::Feature::ConvertCompressedImage,
         AbstractImageConverter::Feature::ConvertData,
         AbstractImageConverter::Feature::ConvertCompressedData,
+        AbstractImageConverter::Feature::ConvertStream,
         /* These are implied by Convert[Compressed]Data, so have to be last */
         AbstractImageConverter::Feature::ConvertFile,
         AbstractImageConverter::Feature::ConvertCompressedFile});
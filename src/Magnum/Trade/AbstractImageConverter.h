@@ -52,8 +52,9 @@ classes in @ref Trade namespace for available image converter plugins.
 @section Trade-AbstractImageConverter-subclassing Subclassing
 
 The plugin needs to implement the@ref doFeatures() function and one or more of
-@ref doExportToImage(), @ref doExportToCompressedImage(), @ref doExportToData()
-or @ref doExportToFile() functions based on what features are supported.
+@ref doExportToImage(), @ref doExportToCompressedImage(), @ref doExportToData(),
+@ref doExportToSink() or @ref doExportToFile() functions based on what
+features are supported.
 
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
@@ -67,6 +68,13 @@ checked by the implementation:
     @ref Feature::ConvertData is supported.
 -   The function @ref doExportToData(const CompressedImageView2D&) is called
     only if @ref Feature::ConvertCompressedData is supported.
+-   The function @ref doExportToSink() is called only if
+    @ref Feature::ConvertStream or @ref Feature::ConvertData is supported.
+
+If the plugin is able to produce the output incrementally, it's advised to
+implement @ref doExportToSink() and advertise @ref Feature::ConvertStream.
+The default @ref doExportToFile() implementation then writes the file in
+chunks without having the whole output in memory.
 
 @attention @ref Corrade::Containers::Array instances returned from the plugin
     should *not* use anything else than the default deleter, otherwise this can
@@ -104,7 +112,13 @@ class MAGNUM_TRADE_EXPORT AbstractImageConverter: public PluginManager::Abstract
              * @ref exportToData(const CompressedImageView2D&). Implies
              * @ref Feature::ConvertCompressedFile.
              */
-            ConvertCompressedData = ConvertCompressedFile|(1 << 4)
+            ConvertCompressedData = ConvertCompressedFile|(1 << 4),
+
+            /**
+             * Exporting to a sink in chunks with @ref exportToSink(). Implies
+             * @ref Feature::ConvertFile.
+             */
+            ConvertStream = ConvertFile|(1 << 5)
         };
 
         /**
@@ -201,14 +215,36 @@ class MAGNUM_TRADE_EXPORT AbstractImageConverter: public PluginManager::Abstract
          */
         Containers::Array<char> exportToData(const ImageData2D& image);
 
+        /**
+         * @brief Export image to a sink
+         * @param image     Image to export
+         * @param sink      Function consuming the output data
+         * @param userData  User data passed to @p sink
+         *
+         * Available only if @ref Feature::ConvertStream or
+         * @ref Feature::ConvertData is supported. The converter calls
+         * @p sink with consecutive chunks of the output; the views are valid
+         * only for the duration of the call. Returning @cpp false @ce from
+         * @p sink aborts the export. If @ref Feature::ConvertStream is not
+         * supported, the data are exported with @ref exportToData() first and
+         * passed to @p sink in a single call. Returns @cpp true @ce on
+         * success, @cpp false @ce if the export failed or was aborted.
+         *
+         * @snippet MagnumTrade.cpp AbstractImageConverter-exportToSink
+         *
+         * @see @ref features(),
+         *      @ref exportToFile(const ImageView2D&, const std::string&)
+         */
+        bool exportToSink(const ImageView2D& image, bool(*sink)(Containers::ArrayView<const char>, void*), void* userData = nullptr);
+
         /**
          * @brief Export image to file
          *
-         * Available only if @ref Feature::ConvertFile or
-         * @ref Feature::ConvertData is supported. Returns `true` on success,
-         * `false` otherwise.
+         * Available only if @ref Feature::ConvertFile,
+         * @ref Feature::ConvertData or @ref Feature::ConvertStream is
+         * supported. Returns `true` on success, `false` otherwise.
          * @see @ref features(), @ref exportToImage(),
-         *      @ref exportToData(const ImageView2D&)
+         *      @ref exportToData(const ImageView2D&), @ref exportToSink()
          */
         bool exportToFile(const ImageView2D& image, const std::string& filename);
 
@@ -253,12 +289,23 @@ class MAGNUM_TRADE_EXPORT AbstractImageConverter: public PluginManager::Abstract
         /** @brief Implementation of @ref exportToData(const CompressedImageView2D&) */
         virtual Containers::Array<char> doExportToData(const CompressedImageView2D& image);
 
+        /**
+         * @brief Implementation of @ref exportToSink()
+         *
+         * Default implementation calls @ref doExportToData(const ImageView2D&)
+         * and passes the result to @p sink in a single call.
+         */
+        virtual bool doExportToSink(const ImageView2D& image, bool(*sink)(Containers::ArrayView<const char>, void*), void* userData);
+
         /**
          * @brief Implementation of @ref exportToFile(const ImageView2D&, const std::string&)
          *
-         * If @ref Feature::ConvertData is supported, default implementation
-         * calls @ref doExportToData(const ImageView2D&) and saves the result
-         * to given file.
+         * If @ref Feature::ConvertStream is supported, default implementation
+         * opens given file and writes the chunks produced by
+         * @ref doExportToSink() there as they come. Otherwise, if
+         * @ref Feature::ConvertData is supported, calls
+         * @ref doExportToData(const ImageView2D&) and saves the result to
+         * given file.
          */
         virtual bool doExportToFile(const ImageView2D& image, const std::string& filename);
 
@@ -25,19 +25,26 @@
 
 #include "AbstractImporter.h"
 
+#include <algorithm>
+#include <vector>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Instrumentation.h"
 #include "Magnum/Trade/AbstractMaterialData.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/CameraData.h"
+#include "Magnum/Trade/FlatSceneData3D.h"
 #include "Magnum/Trade/ImageData.h"
 #include "Magnum/Trade/LightData.h"
+#include "Magnum/Trade/MapFile.h"
+#include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/MeshObjectData3D.h"
 #include "Magnum/Trade/ObjectData2D.h"
 #include "Magnum/Trade/ObjectData3D.h"
 #include "Magnum/Trade/SceneData.h"
@@ -49,6 +56,16 @@
 
 namespace Magnum { namespace Trade {
 
+namespace {
+
+template<class T> Containers::Array<T> toArray(const std::vector<T>& values) {
+    Containers::Array<T> out{Containers::NoInit, values.size()};
+    std::copy(values.begin(), values.end(), out.begin());
+    return out;
+}
+
+}
+
 std::string AbstractImporter::pluginInterface() {
     return "cz.mosra.magnum.Trade.AbstractImporter/0.3";
 }
@@ -160,14 +177,16 @@ void AbstractImporter::doOpenFile(const std::string& filename) {
         doOpenData(*data);
         _fileCallback(filename, ImporterFileCallbackPolicy::Close, _fileCallbackUserData);
 
-    /* Otherwise open the file directly */
+    /* Otherwise map the file directly, which avoids an extra copy for
+       importers that copy the data in doOpenData() anyway */
     } else {
-        if(!Utility::Directory::fileExists(filename)) {
+        const Containers::Optional<Containers::Array<char>> data = mapFile(filename);
+        if(!data) {
             Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
             return;
         }
 
-        doOpenData(Utility::Directory::read(filename));
+        doOpenData(*data);
     }
 }
 
@@ -217,6 +236,42 @@ Containers::Optional<SceneData> AbstractImporter::doScene(UnsignedInt) {
     CORRADE_ASSERT(false, "Trade::AbstractImporter::scene(): not implemented", {});
 }
 
+Containers::Optional<FlatSceneData3D> AbstractImporter::flatScene3D(const UnsignedInt id) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::flatScene3D(): no file opened", {});
+    CORRADE_ASSERT(id < doSceneCount(), "Trade::AbstractImporter::flatScene3D(): index out of range", {});
+    return doFlatScene3D(id);
+}
+
+Containers::Optional<FlatSceneData3D> AbstractImporter::doFlatScene3D(const UnsignedInt id) {
+    Containers::Optional<SceneData> scene = doScene(id);
+    if(!scene) return Containers::NullOpt;
+
+    /* Walk the hierarchy breadth-first, the queue is directly the list of
+       imported objects */
+    std::vector<UnsignedInt> objects{scene->children3D()};
+    std::vector<Int> parents(objects.size(), -1);
+    std::vector<Matrix4> transformations;
+    std::vector<ObjectInstanceType3D> instanceTypes;
+    std::vector<Int> instances;
+    std::vector<Int> materials;
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        std::unique_ptr<ObjectData3D> object = doObject3D(objects[i]);
+        if(!object) return Containers::NullOpt;
+
+        transformations.push_back(object->transformation());
+        instanceTypes.push_back(object->instanceType());
+        instances.push_back(object->instance());
+        materials.push_back(object->instanceType() == ObjectInstanceType3D::Mesh ?
+            static_cast<MeshObjectData3D&>(*object).material() : -1);
+        for(const UnsignedInt child: object->children()) {
+            objects.push_back(child);
+            parents.push_back(Int(i));
+        }
+    }
+
+    return FlatSceneData3D{toArray(objects), toArray(parents), toArray(transformations), toArray(instanceTypes), toArray(instances), toArray(materials), scene->importerState()};
+}
+
 UnsignedInt AbstractImporter::animationCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::animationCount(): no file opened", {});
     return doAnimationCount();
@@ -434,6 +489,7 @@ std::string AbstractImporter::doMesh3DName(UnsignedInt) { return {}; }
 Containers::Optional<MeshData3D> AbstractImporter::mesh3D(const UnsignedInt id) {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::mesh3D(): no file opened", {});
     CORRADE_ASSERT(id < doMesh3DCount(), "Trade::AbstractImporter::mesh3D(): index out of range", {});
+    MAGNUM_INSTRUMENTATION_SCOPE("Trade::AbstractImporter::mesh3D()");
     return doMesh3D(id);
 }
 
@@ -441,6 +497,41 @@ Containers::Optional<MeshData3D> AbstractImporter::doMesh3D(UnsignedInt) {
     CORRADE_ASSERT(false, "Trade::AbstractImporter::mesh3D(): not implemented", {});
 }
 
+UnsignedInt AbstractImporter::meshCount() const {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::meshCount(): no file opened", {});
+    return doMeshCount();
+}
+
+UnsignedInt AbstractImporter::doMeshCount() const { return doMesh3DCount(); }
+
+Int AbstractImporter::meshForName(const std::string& name) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::meshForName(): no file opened", {});
+    return doMeshForName(name);
+}
+
+Int AbstractImporter::doMeshForName(const std::string& name) { return doMesh3DForName(name); }
+
+std::string AbstractImporter::meshName(const UnsignedInt id) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::meshName(): no file opened", {});
+    CORRADE_ASSERT(id < doMeshCount(), "Trade::AbstractImporter::meshName(): index out of range", {});
+    return doMeshName(id);
+}
+
+std::string AbstractImporter::doMeshName(const UnsignedInt id) { return doMesh3DName(id); }
+
+Containers::Optional<MeshData> AbstractImporter::mesh(const UnsignedInt id) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::mesh(): no file opened", {});
+    CORRADE_ASSERT(id < doMeshCount(), "Trade::AbstractImporter::mesh(): index out of range", {});
+    MAGNUM_INSTRUMENTATION_SCOPE("Trade::AbstractImporter::mesh()");
+    return doMesh(id);
+}
+
+Containers::Optional<MeshData> AbstractImporter::doMesh(const UnsignedInt id) {
+    Containers::Optional<MeshData3D> data = doMesh3D(id);
+    if(!data) return Containers::NullOpt;
+    return MeshData{*data};
+}
+
 UnsignedInt AbstractImporter::materialCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::materialCount(): no file opened", {});
     return doMaterialCount();
@@ -569,6 +660,31 @@ Containers::Optional<ImageData2D> AbstractImporter::doImage2D(UnsignedInt) {
     CORRADE_ASSERT(false, "Trade::AbstractImporter::image2D(): not implemented", {});
 }
 
+Containers::Optional<ImageData2D> AbstractImporter::image2DInto(const UnsignedInt id, Containers::ArrayView<char>(*const allocator)(std::size_t, void*), void* const userData) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2DInto(): no file opened", {});
+    CORRADE_ASSERT(id < doImage2DCount(), "Trade::AbstractImporter::image2DInto(): index out of range", {});
+    CORRADE_ASSERT(allocator, "Trade::AbstractImporter::image2DInto(): no allocator set", {});
+    return doImage2DInto(id, allocator, userData);
+}
+
+Containers::Optional<ImageData2D> AbstractImporter::doImage2DInto(const UnsignedInt id, Containers::ArrayView<char>(*const allocator)(std::size_t, void*), void* const userData) {
+    Containers::Optional<ImageData2D> image = doImage2D(id);
+    if(!image) return Containers::NullOpt;
+
+    const Containers::ArrayView<char> data = allocator(image->data().size(), userData);
+    if(data.size() < image->data().size()) {
+        Error() << "Trade::AbstractImporter::image2DInto(): expected at least" << image->data().size() << "bytes from the allocator but got" << data.size();
+        return Containers::NullOpt;
+    }
+    std::copy_n(image->data().begin(), image->data().size(), data.begin());
+
+    /* The memory is owned by the caller, so the deleter does nothing */
+    Containers::Array<char> view{data.data(), image->data().size(), [](char*, std::size_t) {}};
+    if(image->isCompressed())
+        return ImageData2D{image->compressedStorage(), image->compressedFormat(), image->size(), std::move(view), image->importerState()};
+    return ImageData2D{image->storage(), image->format(), image->formatExtra(), image->pixelSize(), image->size(), std::move(view), image->importerState()};
+}
+
 UnsignedInt AbstractImporter::image3DCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image3DCount(): no file opened", {});
     return doImage3DCount();
@@ -615,6 +731,7 @@ Debug& operator<<(Debug& debug, const AbstractImporter::Feature value) {
         _c(OpenData)
         _c(OpenState)
         _c(FileCallback)
+        _c(ThreadSafeDataAccess)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -626,7 +743,8 @@ Debug& operator<<(Debug& debug, const AbstractImporter::Features value) {
     return Containers::enumSetDebugOutput(debug, value, "Trade::AbstractImporter::Features{}", {
         AbstractImporter::Feature::OpenData,
         AbstractImporter::Feature::OpenState,
-        AbstractImporter::Feature::FileCallback});
+        AbstractImporter::Feature::FileCallback,
+        AbstractImporter::Feature::ThreadSafeDataAccess});
 }
 
 Debug& operator<<(Debug& debug, const ImporterFileCallbackPolicy value) {
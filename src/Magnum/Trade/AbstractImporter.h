@@ -171,6 +171,63 @@ Besides exposing internal state, importers that support the
 using @ref openState(). See documentation of a particular importer for details
 about concrete types returned and accepted by these functions.
 
+@subsection Trade-AbstractImporter-usage-async Asynchronous import
+
+Besides the blocking data accessors, meshes, textures and images can be
+imported in the background using @ref Trade::mesh2DAsync(),
+@ref Trade::mesh3DAsync(), @ref Trade::meshAsync(), @ref Trade::textureAsync(),
+@ref Trade::image1DAsync(), @ref Trade::image2DAsync() and
+@ref Trade::image3DAsync() from the @ref Magnum/Trade/AsyncImport.h header.
+Each of these functions checks the arguments on the calling thread, schedules
+the import on a worker thread and returns a @ref std::future that can be
+polled from the main loop, so for example the GL thread can keep rendering
+while several meshes and images from one opened file get decoded:
+
+@code{.cpp}
+std::vector<std::future<Containers::Optional<Trade::MeshData3D>>> meshes;
+for(UnsignedInt i = 0; i != importer->mesh3DCount(); ++i)
+    meshes.push_back(Trade::mesh3DAsync(*importer, i));
+
+// in the draw event, upload every mesh that's done
+for(auto& mesh: meshes) {
+    if(!mesh.valid() || mesh.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+        continue;
+    Containers::Optional<Trade::MeshData3D> data = mesh.get();
+    // ...
+}
+@endcode
+
+The jobs are executed on a fixed-size pool of worker threads shared by all
+importers, which is started on the first use. No thread is created for
+particular jobs. If the importer advertises
+@ref Feature::ThreadSafeDataAccess, its jobs run concurrently. Otherwise the
+jobs of given importer are queued and picked up one after another, so the
+importer implementation is never entered from more than one job at a time and
+the importer occupies at most one worker, but the calling thread is still not
+blocked. In both cases it's not allowed to call
+@ref close(), any of the `open*()` functions, @ref setFileCallback() or
+destroy the importer while there are any jobs in flight --- wait for all
+returned futures first. For importers without
+@ref Feature::ThreadSafeDataAccess it's also not allowed to call the blocking
+data accessors while there are jobs in flight. On
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the jobs are deferred and executed
+on the calling thread once the result is requested.
+
+@subsection Trade-AbstractImporter-usage-into Importing images into external memory
+
+By default, @ref image2D() decodes the image into a newly allocated array,
+which then usually gets copied once more to GPU memory. With
+@ref image2DInto() the importer first figures out how large the decoded data
+will be and then asks a caller-provided allocator for the memory, making it
+possible to decode for example straight into a mapped pixel buffer:
+
+@snippet MagnumTrade.cpp AbstractImporter-image2DInto
+
+The returned @ref ImageData2D doesn't own the memory, it's valid only as long
+as the memory returned by the allocator is. Importers that don't implement
+@ref doImage2DInto() decode the image into a temporary array first and copy it
+to the allocated memory afterwards, so the call works with all plugins.
+
 @subsection Trade-AbstractImporter-usage-casting Polymorphic imported data types
 
 Some data access functions return @ref std::unique_ptr instead of
@@ -221,12 +278,30 @@ checked by the implementation:
     there is any file opened.
 -   All `do*()` implementations taking data ID as parameter are called only if
     the ID is from valid range.
+-   If @ref Feature::ThreadSafeDataAccess is not supported, @ref doMesh2D(),
+    @ref doMesh3D(), @ref doTexture(), @ref doImage1D(), @ref doImage2D() and
+    @ref doImage3D() called from asynchronous jobs are never called
+    concurrently.
+
+In order to support @ref Feature::ThreadSafeDataAccess, the @ref doMesh2D(),
+@ref doMesh3D(), @ref doTexture(), @ref doImage1D(), @ref doImage2D() and
+@ref doImage3D() implementations have to be safe to call concurrently from
+multiple threads with the same or different IDs, and also concurrently with
+@ref doFeatures(), @ref doIsOpened() and the `do*Count()` functions. That
+usually means they can only read the state populated when opening the file and
+all per-call state is local. File callbacks are called from these functions
+only if the user-supplied callback is documented to be thread-safe. The
+`do*ForName()` and `do*Name()` functions, the functions for remaining data
+types and functions operating on the file as a whole are not covered by this
+contract.
 
 @attention
     @ref Corrade::Containers::Array instances returned from the plugin
-    should *not* use anything else than the default deleter, otherwise this can
-    cause dangling function pointer call on array destruction if the plugin
-    gets unloaded before the array is destroyed.
+    should *not* use anything else than the default deleter or deleters
+    defined outside of the plugin binary such as the one used by
+    @ref mapFile(), otherwise this can cause dangling function pointer call on
+    array destruction if the plugin gets unloaded before the array is
+    destroyed.
 @attention
     Similarly for interpolator functions passed through
     @ref Animation::TrackView instances to @ref AnimationData --- to avoid
@@ -259,7 +334,20 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
              * See @ref Trade-AbstractImporter-usage-callbacks and particular
              * importer documentation for more information.
              */
-            FileCallback = 1 << 2
+            FileCallback = 1 << 2,
+
+            /**
+             * Importing meshes, textures and images concurrently using
+             * @ref Trade::mesh2DAsync(), @ref Trade::mesh3DAsync(),
+             * @ref Trade::meshAsync(), @ref Trade::textureAsync(),
+             * @ref Trade::image1DAsync(), @ref Trade::image2DAsync() and
+             * @ref Trade::image3DAsync(). If the importer doesn't expose this
+             * feature, the asynchronous jobs are executed one after another.
+             *
+             * See @ref Trade-AbstractImporter-usage-async and
+             * @ref Trade-AbstractImporter-subclassing for more information.
+             */
+            ThreadSafeDataAccess = 1 << 3
         };
 
         /**
@@ -479,6 +567,17 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<SceneData> scene(UnsignedInt id);
 
+        /**
+         * @brief Flat three-dimensional scene
+         * @param id        Scene ID, from range [0, @ref sceneCount()).
+         *
+         * Returns all three-dimensional objects of given scene in a single
+         * @ref FlatSceneData3D instance or @ref Containers::NullOpt if import
+         * failed. Compared to @ref scene() and @ref object3D() it avoids
+         * allocating each object separately if the importer supports it.
+         */
+        Containers::Optional<FlatSceneData3D> flatScene3D(UnsignedInt id);
+
         /** @brief Animation count */
         UnsignedInt animationCount() const;
 
@@ -669,6 +768,43 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<MeshData3D> mesh3D(UnsignedInt id);
 
+        /**
+         * @brief Mesh count
+         *
+         * Unless the importer implements @ref doMeshCount(), this is the same
+         * as @ref mesh3DCount().
+         */
+        UnsignedInt meshCount() const;
+
+        /**
+         * @brief Mesh ID for given name
+         *
+         * If no mesh for given name exists, returns @cpp -1 @ce.
+         * @see @ref meshName()
+         */
+        Int meshForName(const std::string& name);
+
+        /**
+         * @brief Mesh name
+         * @param id        Mesh ID, from range [0, @ref meshCount()).
+         *
+         * @see @ref meshForName()
+         */
+        std::string meshName(UnsignedInt id);
+
+        /**
+         * @brief Mesh
+         * @param id        Mesh ID, from range [0, @ref meshCount()).
+         *
+         * Returns given mesh or @ref Containers::NullOpt if importing failed.
+         * Unlike @ref mesh3D(), the data can be in any format the importer
+         * chose, usually packed and ready for GPU upload the same way as they
+         * were stored in the file. Importers that implement only
+         * @ref doMesh3D() get the data converted using
+         * @ref MeshData::MeshData(const MeshData3D&).
+         */
+        Containers::Optional<MeshData> mesh(UnsignedInt id);
+
         /** @brief Material count */
         UnsignedInt materialCount() const;
 
@@ -777,6 +913,21 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<ImageData2D> image2D(UnsignedInt id);
 
+        /**
+         * @brief Two-dimensional image imported into external memory
+         * @param id        Image ID, from range [0, @ref image2DCount()).
+         * @param allocator Function returning memory for the image data
+         * @param userData  User data passed to @p allocator
+         *
+         * Like @ref image2D(), but the importer calls @p allocator with the
+         * decoded image data size and then writes the data directly to the
+         * returned memory. The returned image references that memory instead
+         * of owning it. If importing fails or the allocator returns less
+         * memory than requested, returns @ref Containers::NullOpt. See
+         * @ref Trade-AbstractImporter-usage-into for more information.
+         */
+        Containers::Optional<ImageData2D> image2DInto(UnsignedInt id, Containers::ArrayView<char>(*allocator)(std::size_t, void*), void* userData = nullptr);
+
         /** @brief Three-dimensional image count */
         UnsignedInt image3DCount() const;
 
@@ -902,6 +1053,16 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref scene() */
         virtual Containers::Optional<SceneData> doScene(UnsignedInt id);
 
+        /**
+         * @brief Implementation for @ref flatScene3D()
+         *
+         * Default implementation assembles the data from @ref doScene() and
+         * @ref doObject3D() of all objects in the scene, ordered
+         * breadth-first. Importers are encouraged to implement it directly
+         * without going through the per-object data.
+         */
+        virtual Containers::Optional<FlatSceneData3D> doFlatScene3D(UnsignedInt id);
+
         /**
          * @brief Implementation for @ref animationCount()
          *
@@ -1070,6 +1231,35 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref mesh3D() */
         virtual Containers::Optional<MeshData3D> doMesh3D(UnsignedInt id);
 
+        /**
+         * @brief Implementation for @ref meshCount()
+         *
+         * Default implementation returns @ref doMesh3DCount().
+         */
+        virtual UnsignedInt doMeshCount() const;
+
+        /**
+         * @brief Implementation for @ref meshForName()
+         *
+         * Default implementation returns @ref doMesh3DForName().
+         */
+        virtual Int doMeshForName(const std::string& name);
+
+        /**
+         * @brief Implementation for @ref meshName()
+         *
+         * Default implementation returns @ref doMesh3DName().
+         */
+        virtual std::string doMeshName(UnsignedInt id);
+
+        /**
+         * @brief Implementation for @ref mesh()
+         *
+         * Default implementation converts the output of @ref doMesh3D()
+         * using @ref MeshData::MeshData(const MeshData3D&).
+         */
+        virtual Containers::Optional<MeshData> doMesh(UnsignedInt id);
+
         /**
          * @brief Implementation for @ref materialCount()
          *
@@ -1166,6 +1356,15 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref image2D() */
         virtual Containers::Optional<ImageData2D> doImage2D(UnsignedInt id);
 
+        /**
+         * @brief Implementation for @ref image2DInto()
+         *
+         * Default implementation calls @ref doImage2D() and copies the result
+         * to memory returned by @p allocator. Override to decode the data
+         * directly to the allocated memory.
+         */
+        virtual Containers::Optional<ImageData2D> doImage2DInto(UnsignedInt id, Containers::ArrayView<char>(*allocator)(std::size_t, void*), void* userData);
+
         /**
          * @brief Implementation for @ref image3DCount()
          *
@@ -0,0 +1,218 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AsyncImport.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#endif
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/TextureData.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+/* Worker threads shared by all importers. The threads are spawned lazily up
+   to a fixed count and then reused, so a burst of requests only grows the
+   queue. Jobs of importers that don't support Feature::ThreadSafeDataAccess
+   are put into a per-importer queue that is drained by a single job, so the
+   importer is never entered concurrently and occupies at most one worker. */
+struct AsyncImportPool {
+    ~AsyncImportPool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            quit = true;
+        }
+        wake.notify_all();
+        for(std::thread& thread: threads) thread.join();
+    }
+
+    void submit(AbstractImporter& importer, std::function<void()> job) {
+        const bool threadSafe(importer.features() & AbstractImporter::Feature::ThreadSafeDataAccess);
+
+        std::lock_guard<std::mutex> lock{mutex};
+        if(threadSafe) {
+            submitLocked(std::move(job));
+            return;
+        }
+
+        /* If the importer already has a queue, there's a job draining it */
+        auto found = serialized.find(&importer);
+        if(found != serialized.end()) {
+            found->second.push_back(std::move(job));
+            return;
+        }
+
+        AbstractImporter* const key = &importer;
+        serialized[key].push_back(std::move(job));
+        submitLocked([this, key]() { drain(key); });
+    }
+
+    private:
+        void submitLocked(std::function<void()> job) {
+            jobs.push_back(std::move(job));
+
+            /* Spawn a new thread only if the queued jobs can't be picked up
+               by the idle ones */
+            if(jobs.size() > idleThreadCount && threads.size() < maxThreadCount)
+                threads.emplace_back([this]() { work(); });
+            else wake.notify_one();
+        }
+
+        void work() {
+            std::unique_lock<std::mutex> lock{mutex};
+            for(;;) {
+                /* Finish all queued jobs before quitting, as there might be
+                   futures still waiting for them */
+                if(!jobs.empty()) {
+                    std::function<void()> job = std::move(jobs.front());
+                    jobs.pop_front();
+                    lock.unlock();
+                    job();
+                    lock.lock();
+                    continue;
+                }
+
+                if(quit) return;
+
+                ++idleThreadCount;
+                wake.wait(lock);
+                --idleThreadCount;
+            }
+        }
+
+        void drain(AbstractImporter* const importer) {
+            std::unique_lock<std::mutex> lock{mutex};
+
+            /* References to unordered_map values are not invalidated by
+               inserting other importers */
+            std::deque<std::function<void()>>& queue = serialized.at(importer);
+            while(!queue.empty()) {
+                std::function<void()> job = std::move(queue.front());
+                queue.pop_front();
+                lock.unlock();
+                job();
+                lock.lock();
+            }
+
+            serialized.erase(importer);
+        }
+
+        const std::size_t maxThreadCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::deque<std::function<void()>> jobs;
+        std::unordered_map<AbstractImporter*, std::deque<std::function<void()>>> serialized;
+        std::vector<std::thread> threads;
+        std::size_t idleThreadCount{};
+        bool quit{};
+};
+
+AsyncImportPool& asyncImportPool() {
+    static AsyncImportPool pool;
+    return pool;
+}
+#endif
+
+template<class T> std::future<Containers::Optional<T>> async(AbstractImporter& importer, Containers::Optional<T>(AbstractImporter::*const function)(UnsignedInt), const UnsignedInt id) {
+    /* Without threads the job is executed on the calling thread once the
+       result is requested */
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* std::function needs a copyable callable, so the task is shared */
+    auto task = std::make_shared<std::packaged_task<Containers::Optional<T>()>>([&importer, function, id]() {
+        return (importer.*function)(id);
+    });
+    std::future<Containers::Optional<T>> result = task->get_future();
+    asyncImportPool().submit(importer, [task]() { (*task)(); });
+    return result;
+    #else
+    return std::async(std::launch::deferred, [&importer, function, id]() {
+        return (importer.*function)(id);
+    });
+    #endif
+}
+
+}
+
+std::future<Containers::Optional<MeshData2D>> mesh2DAsync(AbstractImporter& importer, const UnsignedInt id) {
+    CORRADE_ASSERT(importer.isOpened(), "Trade::mesh2DAsync(): no file opened", {});
+    CORRADE_ASSERT(id < importer.mesh2DCount(), "Trade::mesh2DAsync(): index out of range", {});
+    return async<MeshData2D>(importer, &AbstractImporter::mesh2D, id);
+}
+
+std::future<Containers::Optional<MeshData3D>> mesh3DAsync(AbstractImporter& importer, const UnsignedInt id) {
+    CORRADE_ASSERT(importer.isOpened(), "Trade::mesh3DAsync(): no file opened", {});
+    CORRADE_ASSERT(id < importer.mesh3DCount(), "Trade::mesh3DAsync(): index out of range", {});
+    return async<MeshData3D>(importer, &AbstractImporter::mesh3D, id);
+}
+
+std::future<Containers::Optional<MeshData>> meshAsync(AbstractImporter& importer, const UnsignedInt id) {
+    CORRADE_ASSERT(importer.isOpened(), "Trade::meshAsync(): no file opened", {});
+    CORRADE_ASSERT(id < importer.meshCount(), "Trade::meshAsync(): index out of range", {});
+    return async<MeshData>(importer, &AbstractImporter::mesh, id);
+}
+
+std::future<Containers::Optional<TextureData>> textureAsync(AbstractImporter& importer, const UnsignedInt id) {
+    CORRADE_ASSERT(importer.isOpened(), "Trade::textureAsync(): no file opened", {});
+    CORRADE_ASSERT(id < importer.textureCount(), "Trade::textureAsync(): index out of range", {});
+    return async<TextureData>(importer, &AbstractImporter::texture, id);
+}
+
+std::future<Containers::Optional<ImageData1D>> image1DAsync(AbstractImporter& importer, const UnsignedInt id) {
+    CORRADE_ASSERT(importer.isOpened(), "Trade::image1DAsync(): no file opened", {});
+    CORRADE_ASSERT(id < importer.image1DCount(), "Trade::image1DAsync(): index out of range", {});
+    return async<ImageData1D>(importer, &AbstractImporter::image1D, id);
+}
+
+std::future<Containers::Optional<ImageData2D>> image2DAsync(AbstractImporter& importer, const UnsignedInt id) {
+    CORRADE_ASSERT(importer.isOpened(), "Trade::image2DAsync(): no file opened", {});
+    CORRADE_ASSERT(id < importer.image2DCount(), "Trade::image2DAsync(): index out of range", {});
+    return async<ImageData2D>(importer, &AbstractImporter::image2D, id);
+}
+
+std::future<Containers::Optional<ImageData3D>> image3DAsync(AbstractImporter& importer, const UnsignedInt id) {
+    CORRADE_ASSERT(importer.isOpened(), "Trade::image3DAsync(): no file opened", {});
+    CORRADE_ASSERT(id < importer.image3DCount(), "Trade::image3DAsync(): index out of range", {});
+    return async<ImageData3D>(importer, &AbstractImporter::image3D, id);
+}
+
+}}
@@ -0,0 +1,122 @@
+#ifndef Magnum_Trade_AsyncImport_h
+#define Magnum_Trade_AsyncImport_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Trade::mesh2DAsync(), @ref Magnum::Trade::mesh3DAsync(), @ref Magnum::Trade::meshAsync(), @ref Magnum::Trade::textureAsync(), @ref Magnum::Trade::image1DAsync(), @ref Magnum::Trade::image2DAsync(), @ref Magnum::Trade::image3DAsync()
+ */
+
+#include <future>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Import a 2D mesh asynchronously
+@param importer     Importer with an opened file
+@param id           Mesh ID, from range [0, @ref AbstractImporter::mesh2DCount()).
+
+Expects that @p importer has a file opened and @p id is in range, checked on
+the calling thread. The @ref AbstractImporter::mesh2D() call is then scheduled
+on a worker thread and its result is available through the returned future.
+The worker threads are shared by all importers, their count is fixed and they
+are started on the first use. Jobs of importers without
+@ref AbstractImporter::Feature::ThreadSafeDataAccess are executed one after
+another. See @ref Trade-AbstractImporter-usage-async for more information and
+restrictions.
+
+On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the job is deferred and executed
+on the calling thread once the result is requested.
+*/
+MAGNUM_TRADE_EXPORT std::future<Containers::Optional<MeshData2D>> mesh2DAsync(AbstractImporter& importer, UnsignedInt id);
+
+/**
+@brief Import a 3D mesh asynchronously
+@param importer     Importer with an opened file
+@param id           Mesh ID, from range [0, @ref AbstractImporter::mesh3DCount()).
+
+Asynchronous variant of @ref AbstractImporter::mesh3D(), see
+@ref mesh2DAsync() for details.
+*/
+MAGNUM_TRADE_EXPORT std::future<Containers::Optional<MeshData3D>> mesh3DAsync(AbstractImporter& importer, UnsignedInt id);
+
+/**
+@brief Import a mesh asynchronously
+@param importer     Importer with an opened file
+@param id           Mesh ID, from range [0, @ref AbstractImporter::meshCount()).
+
+Asynchronous variant of @ref AbstractImporter::mesh(), see
+@ref mesh2DAsync() for details.
+*/
+MAGNUM_TRADE_EXPORT std::future<Containers::Optional<MeshData>> meshAsync(AbstractImporter& importer, UnsignedInt id);
+
+/**
+@brief Import a texture asynchronously
+@param importer     Importer with an opened file
+@param id           Texture ID, from range [0, @ref AbstractImporter::textureCount()).
+
+Asynchronous variant of @ref AbstractImporter::texture(), see
+@ref mesh2DAsync() for details.
+*/
+MAGNUM_TRADE_EXPORT std::future<Containers::Optional<TextureData>> textureAsync(AbstractImporter& importer, UnsignedInt id);
+
+/**
+@brief Import a 1D image asynchronously
+@param importer     Importer with an opened file
+@param id           Image ID, from range [0, @ref AbstractImporter::image1DCount()).
+
+Asynchronous variant of @ref AbstractImporter::image1D(), see
+@ref mesh2DAsync() for details.
+*/
+MAGNUM_TRADE_EXPORT std::future<Containers::Optional<ImageData1D>> image1DAsync(AbstractImporter& importer, UnsignedInt id);
+
+/**
+@brief Import a 2D image asynchronously
+@param importer     Importer with an opened file
+@param id           Image ID, from range [0, @ref AbstractImporter::image2DCount()).
+
+Asynchronous variant of @ref AbstractImporter::image2D(), see
+@ref mesh2DAsync() for details.
+*/
+MAGNUM_TRADE_EXPORT std::future<Containers::Optional<ImageData2D>> image2DAsync(AbstractImporter& importer, UnsignedInt id);
+
+/**
+@brief Import a 3D image asynchronously
+@param importer     Importer with an opened file
+@param id           Image ID, from range [0, @ref AbstractImporter::image3DCount()).
+
+Asynchronous variant of @ref AbstractImporter::image3D(), see
+@ref mesh2DAsync() for details.
+*/
+MAGNUM_TRADE_EXPORT std::future<Containers::Optional<ImageData3D>> image3DAsync(AbstractImporter& importer, UnsignedInt id);
+
+}}
+
+#endif
@@ -0,0 +1,69 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FlatSceneData3D.h"
+
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace Trade {
+
+FlatSceneData3D::FlatSceneData3D(Containers::Array<UnsignedInt> objects, Containers::Array<Int> parents, Containers::Array<Matrix4> transformations, Containers::Array<ObjectInstanceType3D> instanceTypes, Containers::Array<Int> instances, Containers::Array<Int> materials, const void* const importerState): _objects{std::move(objects)}, _parents{std::move(parents)}, _transformations{std::move(transformations)}, _instanceTypes{std::move(instanceTypes)}, _instances{std::move(instances)}, _materials{std::move(materials)}, _importerState{importerState} {
+    const std::size_t count = _parents.size();
+    CORRADE_ASSERT(_objects.size() == count && _transformations.size() == count && _instanceTypes.size() == count && _instances.size() == count && _materials.size() == count,
+        "Trade::FlatSceneData3D: expected" << count << "items in all arrays but got" << _objects.size() << Debug::nospace << "," << _transformations.size() << Debug::nospace << "," << _instanceTypes.size() << Debug::nospace << "," << _instances.size() << "and" << _materials.size(), );
+
+    /* Counting sort of objects by parent, root objects go first. It's stable,
+       so the children stay in the order they are in the scene. */
+    _childOffsets = Containers::Array<UnsignedInt>{Containers::ValueInit, count + 2};
+    for(std::size_t i = 0; i != count; ++i) {
+        CORRADE_ASSERT(_parents[i] >= -1 && _parents[i] < Int(count) && _parents[i] != Int(i),
+            "Trade::FlatSceneData3D: invalid parent" << _parents[i] << "for object" << i, );
+        ++_childOffsets[_parents[i] + 2];
+    }
+    for(std::size_t i = 1; i != _childOffsets.size(); ++i)
+        _childOffsets[i] += _childOffsets[i - 1];
+    _children = Containers::Array<UnsignedInt>{Containers::NoInit, count};
+    for(std::size_t i = 0; i != count; ++i)
+        _children[_childOffsets[_parents[i] + 1]++] = UnsignedInt(i);
+}
+
+FlatSceneData3D::FlatSceneData3D(FlatSceneData3D&&) noexcept = default;
+
+FlatSceneData3D::~FlatSceneData3D() = default;
+
+FlatSceneData3D& FlatSceneData3D::operator=(FlatSceneData3D&&) noexcept = default;
+
+Containers::ArrayView<const UnsignedInt> FlatSceneData3D::roots() const {
+    if(_childOffsets.empty()) return nullptr;
+    return _children.slice(0, _childOffsets[0]);
+}
+
+Containers::ArrayView<const UnsignedInt> FlatSceneData3D::children(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _parents.size(),
+        "Trade::FlatSceneData3D::children(): index" << id << "out of range for" << _parents.size() << "objects", nullptr);
+    return _children.slice(_childOffsets[id], _childOffsets[id + 1]);
+}
+
+}}
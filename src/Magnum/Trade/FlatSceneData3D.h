@@ -0,0 +1,181 @@
+#ifndef Magnum_Trade_FlatSceneData3D_h
+#define Magnum_Trade_FlatSceneData3D_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::FlatSceneData3D
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Trade/ObjectData3D.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Flat three-dimensional scene data
+
+Bulk alternative to @ref SceneData and @ref ObjectData3D for scenes with a
+large number of objects. Instead of a separate allocation for each object and
+its children, all object properties are stored in contiguous per-field
+arrays indexed by object position in the scene, with the hierarchy
+described by parent indices. Child lists of all objects are calculated on
+construction into a single array.
+
+@code{.cpp}
+Containers::Optional<Trade::FlatSceneData3D> data = importer.flatScene3D(0);
+if(!data) Fatal{} << "Can't import the scene";
+
+SceneGraph::FlatScene3D scene;
+scene.addObjects(data->parents(), data->transformations());
+@endcode
+
+The objects can be in any order, the only requirement is that the hierarchy
+doesn't contain cycles.
+@see @ref AbstractImporter::flatScene3D(),
+    @ref SceneGraph::FlatScene::addObjects()
+*/
+class MAGNUM_TRADE_EXPORT FlatSceneData3D {
+    public:
+        /**
+         * @brief Constructor
+         * @param objects           Importer object IDs, see
+         *      @ref AbstractImporter::object3D()
+         * @param parents           Parent indices, @cpp -1 @ce for root
+         *      objects
+         * @param transformations   Transformations relative to parent
+         * @param instanceTypes     Instance types
+         * @param instances         Instance IDs, @cpp -1 @ce for
+         *      @ref ObjectInstanceType3D::Empty
+         * @param materials         Material IDs or @cpp -1 @ce, used only
+         *      for @ref ObjectInstanceType3D::Mesh
+         * @param importerState     Importer-specific state
+         *
+         * All arrays are expected to have the same size and @p parents are
+         * expected to be either @cpp -1 @ce or indices into the arrays.
+         */
+        explicit FlatSceneData3D(Containers::Array<UnsignedInt> objects, Containers::Array<Int> parents, Containers::Array<Matrix4> transformations, Containers::Array<ObjectInstanceType3D> instanceTypes, Containers::Array<Int> instances, Containers::Array<Int> materials, const void* importerState = nullptr);
+
+        /** @brief Copying is not allowed */
+        FlatSceneData3D(const FlatSceneData3D&) = delete;
+
+        /** @brief Move constructor */
+        FlatSceneData3D(FlatSceneData3D&&) noexcept;
+
+        ~FlatSceneData3D();
+
+        /** @brief Copying is not allowed */
+        FlatSceneData3D& operator=(const FlatSceneData3D&) = delete;
+
+        /** @brief Move assignment */
+        FlatSceneData3D& operator=(FlatSceneData3D&&) noexcept;
+
+        /** @brief Object count */
+        UnsignedInt objectCount() const { return _parents.size(); }
+
+        /**
+         * @brief Importer object IDs
+         *
+         * Can be used to query additional information about the objects
+         * using @ref AbstractImporter::object3DName() or
+         * @ref AbstractImporter::object3D().
+         */
+        Containers::ArrayView<const UnsignedInt> objects() const { return _objects; }
+
+        /**
+         * @brief Parent indices
+         *
+         * Contains @cpp -1 @ce for root objects.
+         * @see @ref roots(), @ref children()
+         */
+        Containers::ArrayView<const Int> parents() const { return _parents; }
+
+        /** @brief Transformations relative to parent */
+        Containers::ArrayView<const Matrix4> transformations() const { return _transformations; }
+
+        /** @brief Instance types */
+        Containers::ArrayView<const ObjectInstanceType3D> instanceTypes() const { return _instanceTypes; }
+
+        /**
+         * @brief Instance IDs
+         *
+         * Contains @cpp -1 @ce for objects of @ref ObjectInstanceType3D::Empty.
+         */
+        Containers::ArrayView<const Int> instances() const { return _instances; }
+
+        /**
+         * @brief Material IDs
+         *
+         * Contains @cpp -1 @ce for objects that have no material assigned or
+         * are not @ref ObjectInstanceType3D::Mesh.
+         */
+        Containers::ArrayView<const Int> materials() const { return _materials; }
+
+        /**
+         * @brief Root objects
+         *
+         * Indices of all objects that have no parent, in the order they are
+         * in the scene.
+         */
+        Containers::ArrayView<const UnsignedInt> roots() const;
+
+        /**
+         * @brief Children of given object
+         *
+         * Indices of all objects that have @p id as their parent, in the
+         * order they are in the scene. Expects that @p id is less than
+         * @ref objectCount().
+         */
+        Containers::ArrayView<const UnsignedInt> children(UnsignedInt id) const;
+
+        /**
+         * @brief Importer-specific state
+         *
+         * See @ref AbstractImporter::importerState() for more information.
+         */
+        const void* importerState() const { return _importerState; }
+
+    private:
+        Containers::Array<UnsignedInt> _objects;
+        Containers::Array<Int> _parents;
+        Containers::Array<Matrix4> _transformations;
+        Containers::Array<ObjectInstanceType3D> _instanceTypes;
+        Containers::Array<Int> _instances;
+        Containers::Array<Int> _materials;
+
+        /* Offsets into _children for root objects (at index 0) and then
+           children of each object */
+        Containers::Array<UnsignedInt> _childOffsets,
+            _children;
+        const void* _importerState;
+};
+
+}}
+
+#endif
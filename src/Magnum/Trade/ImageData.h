@@ -65,6 +65,11 @@ As with @ref Image / @ref ImageView, this class supports extra storage
 parameters and implementation-specific format specification, if the importer
 has a need for that. See the @ref ImageView documentation for more information.
 
+The data array can have a custom deleter, for example when referencing a
+memory-mapped file returned by @ref mapFile(). Note that when returning such
+images from importer plugins, the deleter has to be defined outside of the
+plugin binary, see @ref Trade-AbstractImporter-subclassing for details.
+
 When using the image, its compression status can be distinguished using
 @ref isCompressed(). Uncompressed image properties are available through
 @ref storage(), @ref format(), @ref formatExtra() and @ref pixelSize();
@@ -0,0 +1,104 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MapFile.h"
+
+#ifdef CORRADE_TARGET_UNIX
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+namespace Magnum { namespace Trade {
+
+#ifdef CORRADE_TARGET_UNIX
+namespace {
+
+/* The returned array doesn't need to start at a page boundary, so the
+   deleter has to find the beginning of the mapping itself */
+void unmap(char* const data, const std::size_t size) {
+    const std::size_t pageOffset = reinterpret_cast<std::uintptr_t>(data) % sysconf(_SC_PAGESIZE);
+    munmap(data - pageOffset, size + pageOffset);
+}
+
+}
+#endif
+
+Containers::Optional<Containers::Array<char>> mapFile(const std::string& filename, const std::size_t offset, std::size_t size) {
+    #ifdef CORRADE_TARGET_UNIX
+    const int fd = open(filename.data(), O_RDONLY);
+    if(fd == -1) return Containers::NullOpt;
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || std::size_t(st.st_size) < offset) {
+        close(fd);
+        return Containers::NullOpt;
+    }
+
+    if(size == ~std::size_t{}) size = st.st_size - offset;
+    else if(size > std::size_t(st.st_size) - offset) {
+        close(fd);
+        return Containers::NullOpt;
+    }
+
+    /* Zero-sized mappings are not allowed, return an empty array in that
+       case */
+    if(!size) {
+        close(fd);
+        return Containers::Array<char>{};
+    }
+
+    /* The mapping offset has to be page-aligned */
+    const std::size_t pageOffset = offset % sysconf(_SC_PAGESIZE);
+    void* const mapped = mmap(nullptr, size + pageOffset, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, offset - pageOffset);
+
+    /* The mapping stays valid after closing the descriptor */
+    close(fd);
+    if(mapped == MAP_FAILED) return Containers::NullOpt;
+
+    return Containers::Array<char>{static_cast<char*>(mapped) + pageOffset, size, unmap};
+
+    #else
+    std::ifstream in{filename, std::ios::binary|std::ios::ate};
+    if(!in.good()) return Containers::NullOpt;
+
+    const std::size_t fileSize = in.tellg();
+    if(fileSize < offset) return Containers::NullOpt;
+
+    if(size == ~std::size_t{}) size = fileSize - offset;
+    else if(size > fileSize - offset) return Containers::NullOpt;
+
+    Containers::Array<char> data{size};
+    in.seekg(offset, std::ios::beg);
+    in.read(data, data.size());
+    return std::move(data);
+    #endif
+}
+
+}}
@@ -0,0 +1,72 @@
+#ifndef Magnum_Trade_MapFile_h
+#define Magnum_Trade_MapFile_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Trade::mapFile()
+ */
+
+#include <string>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Map a file into memory
+@param filename     File to map
+@param offset       Offset in the file where the returned data start
+@param size         Size of the returned data. If set to
+    @cpp ~std::size_t{} @ce, the data span until the end of the file.
+
+On Unix systems the file is mapped using a private copy-on-write mapping, so
+no data are read until they're accessed and the OS pages them in on demand.
+Writing to the returned array is allowed, but it creates private copies of the
+touched pages and the changes are never written back to the file. Elsewhere the
+file contents starting at @p offset are read into a newly allocated array.
+
+Returns @ref Containers::NullOpt if the file can't be opened or mapped or if
+@p offset is larger than the file size or @p offset and @p size together
+exceed the file size. If @p offset is equal to the file size or @p size is
+zero, returns an empty array. Mapping just a part of the file is useful for
+returning a single image from a file that contains many of them without a
+copy, as the returned array has exactly the image size.
+
+Unlike arrays with custom deleters created by plugins, the deleter of the
+returned array is defined in the @ref Trade library itself, so the array can be
+safely passed for example to @ref ImageData and returned from an importer
+plugin --- it doesn't dangle when the plugin gets unloaded before the array is
+destroyed.
+@see @ref AbstractImporter::openFile()
+*/
+MAGNUM_TRADE_EXPORT Containers::Optional<Containers::Array<char>> mapFile(const std::string& filename, std::size_t offset = 0, std::size_t size = ~std::size_t{});
+
+}}
+
+#endif
@@ -0,0 +1,249 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshBlob.h"
+
+#include <cstdint>
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+struct Header {
+    char magic[4];
+    UnsignedShort byteOrderMark;
+    UnsignedShort version;
+    UnsignedInt primitive;
+    UnsignedInt indexType;      /* ~0 for non-indexed meshes */
+    UnsignedInt vertexCount;
+    UnsignedInt stride;
+    UnsignedInt indexCount;
+    UnsignedInt indexStart;
+    UnsignedInt indexEnd;
+    UnsignedInt attributeCount;
+    std::uint64_t vertexDataOffset;
+    std::uint64_t vertexDataSize;
+    std::uint64_t indexDataOffset;
+    std::uint64_t indexDataSize;
+};
+
+static_assert(sizeof(Header) == 72, "improper size of the header");
+static_assert(sizeof(MeshBlobAttribute) == 12, "improper size of the attribute");
+
+constexpr char Magic[]{'M', 'G', 'M', 'B'};
+constexpr UnsignedShort ByteOrderMark = 0xfeff;
+constexpr UnsignedShort Version = 1;
+constexpr UnsignedInt NotIndexed = ~UnsignedInt{};
+
+std::size_t alignUp(const std::size_t value) {
+    return (value + MeshBlob::Alignment - 1)/MeshBlob::Alignment*MeshBlob::Alignment;
+}
+
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+Debug& operator<<(Debug& debug, const MeshBlobAttributeType value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case MeshBlobAttributeType::value: return debug << "Trade::MeshBlobAttributeType::" #value;
+        _c(UnsignedByte)
+        _c(Byte)
+        _c(UnsignedShort)
+        _c(Short)
+        _c(UnsignedInt)
+        _c(Int)
+        _c(HalfFloat)
+        _c(Float)
+        _c(Int2101010Rev)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Trade::MeshBlobAttributeType(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+#endif
+
+UnsignedInt meshBlobAttributeTypeSize(const MeshBlobAttributeType type) {
+    switch(type) {
+        case MeshBlobAttributeType::UnsignedByte:
+        case MeshBlobAttributeType::Byte:
+            return 1;
+        case MeshBlobAttributeType::UnsignedShort:
+        case MeshBlobAttributeType::Short:
+        case MeshBlobAttributeType::HalfFloat:
+            return 2;
+        case MeshBlobAttributeType::UnsignedInt:
+        case MeshBlobAttributeType::Int:
+        case MeshBlobAttributeType::Float:
+        case MeshBlobAttributeType::Int2101010Rev:
+            return 4;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+MeshBlob::MeshBlob(const MeshPrimitive primitive, const UnsignedInt vertexCount, const UnsignedInt stride, const Containers::ArrayView<const MeshBlobAttribute> attributes, const Containers::ArrayView<const char> vertexData) noexcept: _primitive{primitive}, _indexType{}, _indexed{false}, _vertexCount{vertexCount}, _stride{stride}, _indexCount{}, _indexStart{}, _indexEnd{}, _attributes{attributes}, _vertexData{vertexData} {
+    CORRADE_ASSERT(vertexData.size() == std::size_t(vertexCount)*stride,
+        "Trade::MeshBlob: expected" << std::size_t(vertexCount)*stride << "bytes of vertex data but got" << vertexData.size(), );
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        CORRADE_ASSERT(attributes[i].components >= 1 && attributes[i].components <= 4 && (attributes[i].type != MeshBlobAttributeType::Int2101010Rev || attributes[i].components == 4),
+            "Trade::MeshBlob: invalid component count" << UnsignedInt(attributes[i].components) << "for attribute" << i, );
+        CORRADE_ASSERT(attributes[i].offset + attributes[i].size() <= stride,
+            "Trade::MeshBlob: attribute" << i << "doesn't fit into stride of" << stride << "bytes", );
+    }
+    #endif
+}
+
+MeshBlob::MeshBlob(const MeshPrimitive primitive, const UnsignedInt vertexCount, const UnsignedInt stride, const Containers::ArrayView<const MeshBlobAttribute> attributes, const Containers::ArrayView<const char> vertexData, const MeshIndexType indexType, const UnsignedInt indexCount, const UnsignedInt indexStart, const UnsignedInt indexEnd, const Containers::ArrayView<const char> indexData) noexcept: MeshBlob{primitive, vertexCount, stride, attributes, vertexData} {
+    CORRADE_ASSERT(indexData.size() == std::size_t(indexCount)*meshIndexTypeSize(indexType),
+        "Trade::MeshBlob: expected" << std::size_t(indexCount)*meshIndexTypeSize(indexType) << "bytes of index data but got" << indexData.size(), );
+    _indexType = indexType;
+    _indexed = true;
+    _indexCount = indexCount;
+    _indexStart = indexStart;
+    _indexEnd = indexEnd;
+    _indexData = indexData;
+}
+
+MeshIndexType MeshBlob::indexType() const {
+    CORRADE_ASSERT(_indexed, "Trade::MeshBlob::indexType(): the mesh is not indexed", {});
+    return _indexType;
+}
+
+Containers::Array<char> MeshBlob::serialize() const {
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.byteOrderMark = ByteOrderMark;
+    header.version = Version;
+    header.primitive = UnsignedInt(_primitive);
+    header.indexType = _indexed ? UnsignedInt(_indexType) : NotIndexed;
+    header.vertexCount = _vertexCount;
+    header.stride = _stride;
+    header.indexCount = _indexCount;
+    header.indexStart = _indexStart;
+    header.indexEnd = _indexEnd;
+    header.attributeCount = _attributes.size();
+    header.vertexDataOffset = alignUp(sizeof(Header) + _attributes.size()*sizeof(MeshBlobAttribute));
+    header.vertexDataSize = _vertexData.size();
+    header.indexDataOffset = _indexed ? alignUp(header.vertexDataOffset + header.vertexDataSize) : header.vertexDataOffset + header.vertexDataSize;
+    header.indexDataSize = _indexData.size();
+
+    /* Zero-initialize so the padding is deterministic */
+    Containers::Array<char> out{Containers::ValueInit, std::size_t(header.indexDataOffset + header.indexDataSize)};
+    std::memcpy(out.data(), &header, sizeof(Header));
+    if(!_attributes.empty())
+        std::memcpy(out.data() + sizeof(Header), _attributes.data(), _attributes.size()*sizeof(MeshBlobAttribute));
+    if(!_vertexData.empty())
+        std::memcpy(out.data() + header.vertexDataOffset, _vertexData.data(), _vertexData.size());
+    if(!_indexData.empty())
+        std::memcpy(out.data() + header.indexDataOffset, _indexData.data(), _indexData.size());
+
+    return out;
+}
+
+Containers::Optional<MeshBlob> MeshBlob::deserialize(const Containers::ArrayView<const char> data) {
+    if(data.size() < sizeof(Header)) {
+        Error() << "Trade::MeshBlob::deserialize(): expected at least" << sizeof(Header) << "bytes but got" << data.size();
+        return Containers::NullOpt;
+    }
+
+    if(reinterpret_cast<std::uintptr_t>(data.data()) % alignof(MeshBlobAttribute)) {
+        Error() << "Trade::MeshBlob::deserialize(): data not aligned to" << alignof(MeshBlobAttribute) << "bytes";
+        return Containers::NullOpt;
+    }
+
+    Header header;
+    std::memcpy(&header, data.data(), sizeof(Header));
+
+    if(std::memcmp(header.magic, Magic, sizeof(Magic)) != 0) {
+        Error() << "Trade::MeshBlob::deserialize(): invalid signature";
+        return Containers::NullOpt;
+    }
+
+    if(header.byteOrderMark != ByteOrderMark) {
+        Error() << "Trade::MeshBlob::deserialize(): unsupported byte order";
+        return Containers::NullOpt;
+    }
+
+    if(header.version != Version) {
+        Error() << "Trade::MeshBlob::deserialize(): unsupported version" << header.version;
+        return Containers::NullOpt;
+    }
+
+    if(header.primitive > UnsignedInt(MeshPrimitive::TriangleFan)) {
+        Error() << "Trade::MeshBlob::deserialize(): invalid primitive" << header.primitive;
+        return Containers::NullOpt;
+    }
+
+    const bool indexed = header.indexType != NotIndexed;
+    if(indexed && header.indexType > UnsignedInt(MeshIndexType::UnsignedInt)) {
+        Error() << "Trade::MeshBlob::deserialize(): invalid index type" << header.indexType;
+        return Containers::NullOpt;
+    }
+
+    /* Check that everything is in bounds, taking care to not overflow */
+    const std::uint64_t size = data.size();
+    if(header.attributeCount > (size - sizeof(Header))/sizeof(MeshBlobAttribute) ||
+       header.vertexDataOffset > size || header.vertexDataSize > size - header.vertexDataOffset ||
+       header.indexDataOffset > size || header.indexDataSize > size - header.indexDataOffset) {
+        Error() << "Trade::MeshBlob::deserialize(): data out of bounds for a blob of" << data.size() << "bytes";
+        return Containers::NullOpt;
+    }
+
+    if(header.vertexDataSize != std::uint64_t(header.vertexCount)*header.stride) {
+        Error() << "Trade::MeshBlob::deserialize(): expected" << std::uint64_t(header.vertexCount)*header.stride << "bytes of vertex data but got" << header.vertexDataSize;
+        return Containers::NullOpt;
+    }
+
+    const std::uint64_t expectedIndexDataSize = indexed ? std::uint64_t(header.indexCount)*meshIndexTypeSize(MeshIndexType(header.indexType)) : 0;
+    if(header.indexDataSize != expectedIndexDataSize) {
+        Error() << "Trade::MeshBlob::deserialize(): expected" << expectedIndexDataSize << "bytes of index data but got" << header.indexDataSize;
+        return Containers::NullOpt;
+    }
+
+    const Containers::ArrayView<const MeshBlobAttribute> attributes{reinterpret_cast<const MeshBlobAttribute*>(data.data() + sizeof(Header)), header.attributeCount};
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        const MeshBlobAttribute& attribute = attributes[i];
+        if(UnsignedByte(attribute.type) > UnsignedByte(MeshBlobAttributeType::Int2101010Rev) ||
+           attribute.components < 1 || attribute.components > 4 ||
+           (attribute.type == MeshBlobAttributeType::Int2101010Rev && attribute.components != 4) ||
+           std::uint64_t(attribute.offset) + attribute.size() > header.stride) {
+            Error() << "Trade::MeshBlob::deserialize(): invalid attribute" << i;
+            return Containers::NullOpt;
+        }
+    }
+
+    const Containers::ArrayView<const char> vertexData = data.slice(std::size_t(header.vertexDataOffset), std::size_t(header.vertexDataOffset + header.vertexDataSize));
+    if(!indexed)
+        return MeshBlob{MeshPrimitive(header.primitive), header.vertexCount, header.stride, attributes, vertexData};
+
+    return MeshBlob{MeshPrimitive(header.primitive), header.vertexCount, header.stride, attributes, vertexData, MeshIndexType(header.indexType), header.indexCount, header.indexStart, header.indexEnd, data.slice(std::size_t(header.indexDataOffset), std::size_t(header.indexDataOffset + header.indexDataSize))};
+}
+
+}}
@@ -0,0 +1,283 @@
+#ifndef Magnum_Trade_MeshBlob_h
+#define Magnum_Trade_MeshBlob_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshBlob, struct @ref Magnum::Trade::MeshBlobAttribute, enum @ref Magnum::Trade::MeshBlobAttributeType
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh blob attribute component type
+
+@see @ref MeshBlobAttribute
+*/
+enum class MeshBlobAttributeType: UnsignedByte {
+    UnsignedByte,   /**< Unsigned byte */
+    Byte,           /**< Byte */
+    UnsignedShort,  /**< Unsigned short */
+    Short,          /**< Short */
+    UnsignedInt,    /**< Unsigned int */
+    Int,            /**< Int */
+    HalfFloat,      /**< Half float */
+    Float,          /**< Float */
+
+    /**
+     * Signed 2.10.10.10 packed integer. The attribute has to have four
+     * components.
+     */
+    Int2101010Rev
+};
+
+/** @debugoperatorenum{MeshBlobAttributeType} */
+MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, MeshBlobAttributeType value);
+
+/**
+@brief Size of a mesh blob attribute component type
+
+For @ref MeshBlobAttributeType::Int2101010Rev returns size of the whole packed
+four-component value.
+*/
+MAGNUM_TRADE_EXPORT UnsignedInt meshBlobAttributeTypeSize(MeshBlobAttributeType type);
+
+/**
+@brief Mesh blob attribute
+
+Describes one attribute in interleaved vertex data of a @ref MeshBlob. The
+structure is stored in the serialized blob as-is.
+*/
+struct MeshBlobAttribute {
+    /** @brief Default constructor */
+    constexpr explicit MeshBlobAttribute() noexcept: location{}, offset{}, type{}, components{}, normalized{}, _padding{} {}
+
+    /**
+     * @brief Constructor
+     * @param location      Shader attribute location, for example
+     *      @ref Shaders::Generic3D::Position
+     * @param offset        Offset of the attribute in a vertex
+     * @param type          Component type
+     * @param components    Component count, from @cpp 1 @ce to @cpp 4 @ce
+     * @param normalized    Whether integer components are normalized to the
+     *      @f$ [0, 1] @f$ or @f$ [-1, 1] @f$ range
+     */
+    constexpr explicit MeshBlobAttribute(UnsignedInt location, UnsignedInt offset, MeshBlobAttributeType type, UnsignedByte components, bool normalized = false) noexcept: location{location}, offset{offset}, type{type}, components{components}, normalized{normalized}, _padding{} {}
+
+    /** @brief Attribute size in bytes */
+    UnsignedInt size() const {
+        return type == MeshBlobAttributeType::Int2101010Rev ?
+            meshBlobAttributeTypeSize(type) : meshBlobAttributeTypeSize(type)*components;
+    }
+
+    UnsignedInt location;           /**< @brief Shader attribute location */
+    UnsignedInt offset;             /**< @brief Offset in a vertex */
+    MeshBlobAttributeType type;     /**< @brief Component type */
+    UnsignedByte components;        /**< @brief Component count */
+    bool normalized;                /**< @brief Whether the data are normalized */
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    UnsignedByte _padding;
+    #endif
+};
+
+/**
+@brief Mesh blob
+
+A non-owning view on interleaved, GPU-ready vertex data and optional index
+data together with their attribute layout. The blob can be serialized into a
+binary format using @ref serialize() and deserialized back using
+@ref deserialize(). The deserialization only checks the header for
+consistency, the vertex and index data are never copied or parsed, so they can
+be directly uploaded from a memory-mapped file. Use @ref MeshTools::compile(const Trade::MeshBlob&)
+to create a GPU mesh out of it.
+
+Typical usage is converting the data once after processing the mesh with
+@ref MeshTools::removeDuplicates(), @ref MeshTools::interleave() and
+@ref MeshTools::compressIndices():
+
+@code{.cpp}
+Containers::Array<char> vertexData = MeshTools::interleave(positions, normals);
+Containers::Array<char> indexData;
+MeshIndexType indexType;
+UnsignedInt indexStart, indexEnd;
+std::tie(indexData, indexType, indexStart, indexEnd) = MeshTools::compressIndices(indices);
+
+const Trade::MeshBlobAttribute attributes[]{
+    Trade::MeshBlobAttribute{Shaders::Generic3D::Position::Location, 0,
+        Trade::MeshBlobAttributeType::Float, 3},
+    Trade::MeshBlobAttribute{Shaders::Generic3D::Normal::Location, 12,
+        Trade::MeshBlobAttributeType::Float, 3}};
+Containers::Array<char> blob = Trade::MeshBlob{MeshPrimitive::Triangles,
+    UnsignedInt(positions.size()), 24, attributes, vertexData,
+    indexType, UnsignedInt(indices.size()), indexStart, indexEnd, indexData}
+    .serialize();
+@endcode
+
+Then, on every startup:
+
+@code{.cpp}
+Containers::ArrayView<const char> data = ...; // for example a mmapped file
+Containers::Optional<Trade::MeshBlob> blob = Trade::MeshBlob::deserialize(data);
+if(!blob) Fatal{} << "Can't load the mesh";
+
+GL::Mesh mesh = MeshTools::compile(*blob);
+@endcode
+
+@section Trade-MeshBlob-format Binary format
+
+The blob consists of a 72-byte header, followed by an array of
+@ref MeshBlobAttribute structures and the vertex and index data, each aligned
+to @ref Alignment bytes, so the data are suitably aligned for direct access if
+the blob starts at an aligned address. All values are stored in the native
+byte order, the header contains a byte order mark and blobs with different
+byte order are rejected.
+*/
+class MAGNUM_TRADE_EXPORT MeshBlob {
+    public:
+        enum: std::size_t {
+            /** Alignment of vertex and index data in serialized blob */
+            Alignment = 64
+        };
+
+        /**
+         * @brief Deserialize a blob
+         *
+         * Checks the header for consistency and returns a view on the data.
+         * The @p data are expected to be aligned to at least four bytes and
+         * to stay in scope for the whole lifetime of the returned instance.
+         * On failure prints a message to @ref Error and returns
+         * @ref Containers::NullOpt.
+         */
+        static Containers::Optional<MeshBlob> deserialize(Containers::ArrayView<const char> data);
+
+        /**
+         * @brief Construct a non-indexed mesh blob
+         * @param primitive     Primitive
+         * @param vertexCount   Vertex count
+         * @param stride        Vertex stride
+         * @param attributes    Attributes
+         * @param vertexData    Interleaved vertex data
+         *
+         * Expects that size of @p vertexData is @p vertexCount multiplied by
+         * @p stride and that all attributes fit into the stride. The views
+         * are only referenced, not copied.
+         */
+        explicit MeshBlob(MeshPrimitive primitive, UnsignedInt vertexCount, UnsignedInt stride, Containers::ArrayView<const MeshBlobAttribute> attributes, Containers::ArrayView<const char> vertexData) noexcept;
+
+        /**
+         * @brief Construct an indexed mesh blob
+         * @param primitive     Primitive
+         * @param vertexCount   Vertex count
+         * @param stride        Vertex stride
+         * @param attributes    Attributes
+         * @param vertexData    Interleaved vertex data
+         * @param indexType     Index type
+         * @param indexCount    Index count
+         * @param indexStart    Minimal index value
+         * @param indexEnd      Maximal index value
+         * @param indexData     Index data
+         *
+         * Additionally to @ref MeshBlob(MeshPrimitive, UnsignedInt, UnsignedInt, Containers::ArrayView<const MeshBlobAttribute>, Containers::ArrayView<const char>)
+         * expects that size of @p indexData is @p indexCount multiplied by
+         * size of @p indexType. The index range is as returned by
+         * @ref MeshTools::compressIndices().
+         */
+        explicit MeshBlob(MeshPrimitive primitive, UnsignedInt vertexCount, UnsignedInt stride, Containers::ArrayView<const MeshBlobAttribute> attributes, Containers::ArrayView<const char> vertexData, MeshIndexType indexType, UnsignedInt indexCount, UnsignedInt indexStart, UnsignedInt indexEnd, Containers::ArrayView<const char> indexData) noexcept;
+
+        /** @brief Primitive */
+        MeshPrimitive primitive() const { return _primitive; }
+
+        /** @brief Vertex count */
+        UnsignedInt vertexCount() const { return _vertexCount; }
+
+        /** @brief Vertex stride */
+        UnsignedInt stride() const { return _stride; }
+
+        /** @brief Attributes */
+        Containers::ArrayView<const MeshBlobAttribute> attributes() const { return _attributes; }
+
+        /** @brief Interleaved vertex data */
+        Containers::ArrayView<const char> vertexData() const { return _vertexData; }
+
+        /** @brief Whether the mesh is indexed */
+        bool isIndexed() const { return _indexed; }
+
+        /**
+         * @brief Index type
+         *
+         * Expects that the mesh is indexed.
+         * @see @ref isIndexed()
+         */
+        MeshIndexType indexType() const;
+
+        /**
+         * @brief Index count
+         *
+         * Returns @cpp 0 @ce if the mesh is not indexed.
+         */
+        UnsignedInt indexCount() const { return _indexCount; }
+
+        /** @brief Minimal index value */
+        UnsignedInt indexStart() const { return _indexStart; }
+
+        /** @brief Maximal index value */
+        UnsignedInt indexEnd() const { return _indexEnd; }
+
+        /**
+         * @brief Index data
+         *
+         * Empty if the mesh is not indexed.
+         */
+        Containers::ArrayView<const char> indexData() const { return _indexData; }
+
+        /**
+         * @brief Serialize the blob
+         *
+         * Copies the header, attribute layout, vertex and index data into a
+         * newly allocated array in the format described in
+         * @ref Trade-MeshBlob-format.
+         */
+        Containers::Array<char> serialize() const;
+
+    private:
+        MeshPrimitive _primitive;
+        MeshIndexType _indexType;
+        bool _indexed;
+        UnsignedInt _vertexCount, _stride, _indexCount, _indexStart, _indexEnd;
+        Containers::ArrayView<const MeshBlobAttribute> _attributes;
+        Containers::ArrayView<const char> _vertexData, _indexData;
+};
+
+}}
+
+#endif
@@ -0,0 +1,287 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshData.h"
+
+#include <algorithm>
+#include <cstring>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade {
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+Debug& operator<<(Debug& debug, const MeshAttribute value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case MeshAttribute::value: return debug << "Trade::MeshAttribute::" #value;
+        _c(Position)
+        _c(Normal)
+        _c(TextureCoordinates)
+        _c(Color)
+        _c(JointIds)
+        _c(Weights)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Trade::MeshAttribute(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+#endif
+
+MeshData::MeshData(const MeshPrimitive primitive, const MeshIndexType indexType, Containers::Array<char>&& indexData, Containers::Array<char>&& vertexData, Containers::Array<MeshAttributeData>&& attributes, const UnsignedInt vertexCount, const void* const importerState) noexcept: MeshData{primitive, std::move(vertexData), std::move(attributes), vertexCount, importerState} {
+    CORRADE_ASSERT(!(indexData.size()%meshIndexTypeSize(indexType)),
+        "Trade::MeshData: index data size" << indexData.size() << "is not divisible by size of" << indexType, );
+    _indexType = indexType;
+    _indexed = true;
+    _indexData = std::move(indexData);
+}
+
+MeshData::MeshData(const MeshPrimitive primitive, Containers::Array<char>&& vertexData, Containers::Array<MeshAttributeData>&& attributes, const UnsignedInt vertexCount, const void* const importerState) noexcept: _primitive{primitive}, _indexType{}, _indexed{false}, _vertexCount{vertexCount}, _vertexData{std::move(vertexData)}, _attributes{std::move(attributes)}, _importerState{importerState} {
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(std::size_t i = 0; i != _attributes.size(); ++i) {
+        const MeshAttributeData& attribute = _attributes[i];
+        CORRADE_ASSERT(attribute.components >= 1 && attribute.components <= 4 && (attribute.type != MeshBlobAttributeType::Int2101010Rev || attribute.components == 4),
+            "Trade::MeshData: invalid component count" << UnsignedInt(attribute.components) << "for attribute" << i, );
+        CORRADE_ASSERT(!vertexCount || attribute.offset + std::size_t(vertexCount - 1)*attribute.stride + attribute.size() <= _vertexData.size(),
+            "Trade::MeshData: attribute" << i << "doesn't fit into" << _vertexData.size() << "bytes of vertex data", );
+    }
+    #endif
+}
+
+namespace {
+
+template<class T> void appendAttributes(char* const vertexData, const std::size_t stride, std::size_t& offset, std::vector<MeshAttributeData>& attributes, const MeshAttribute name, const MeshBlobAttributeType type, const UnsignedByte components, const std::vector<T>& data) {
+    for(std::size_t i = 0; i != data.size(); ++i)
+        std::memcpy(vertexData + offset + i*stride, &data[i], sizeof(T));
+    attributes.emplace_back(name, type, components, offset, UnsignedInt(stride));
+    offset += sizeof(T);
+}
+
+}
+
+MeshData::MeshData(const MeshData3D& data): _primitive{data.primitive()}, _indexType{}, _indexed{data.isIndexed()}, _vertexCount{UnsignedInt(data.positions(0).size())}, _importerState{data.importerState()} {
+    /* Calculate the stride, all arrays have the same size as the first
+       position array */
+    const std::size_t stride =
+        sizeof(Vector3)*(data.positionArrayCount() + data.normalArrayCount()) +
+        sizeof(Vector2)*data.textureCoords2DArrayCount() +
+        sizeof(Color4)*data.colorArrayCount() +
+        (sizeof(Vector4ui) + sizeof(Vector4))*data.jointArrayCount();
+
+    /* Interleave all attributes */
+    _vertexData = Containers::Array<char>{Containers::ValueInit, stride*_vertexCount};
+    std::vector<MeshAttributeData> attributes;
+    std::size_t offset = 0;
+    for(UnsignedInt i = 0; i != data.positionArrayCount(); ++i)
+        appendAttributes(_vertexData, stride, offset, attributes, MeshAttribute::Position, MeshBlobAttributeType::Float, 3, data.positions(i));
+    for(UnsignedInt i = 0; i != data.normalArrayCount(); ++i)
+        appendAttributes(_vertexData, stride, offset, attributes, MeshAttribute::Normal, MeshBlobAttributeType::Float, 3, data.normals(i));
+    for(UnsignedInt i = 0; i != data.textureCoords2DArrayCount(); ++i)
+        appendAttributes(_vertexData, stride, offset, attributes, MeshAttribute::TextureCoordinates, MeshBlobAttributeType::Float, 2, data.textureCoords2D(i));
+    for(UnsignedInt i = 0; i != data.colorArrayCount(); ++i)
+        appendAttributes(_vertexData, stride, offset, attributes, MeshAttribute::Color, MeshBlobAttributeType::Float, 4, data.colors(i));
+    for(UnsignedInt i = 0; i != data.jointArrayCount(); ++i) {
+        appendAttributes(_vertexData, stride, offset, attributes, MeshAttribute::JointIds, MeshBlobAttributeType::UnsignedInt, 4, data.jointIds(i));
+        appendAttributes(_vertexData, stride, offset, attributes, MeshAttribute::Weights, MeshBlobAttributeType::Float, 4, data.weights(i));
+    }
+    _attributes = Containers::Array<MeshAttributeData>{attributes.size()};
+    std::copy(attributes.begin(), attributes.end(), _attributes.begin());
+
+    /* Pick the smallest index type that fits */
+    if(!_indexed) return;
+    const std::vector<UnsignedInt>& indices = data.indices();
+    UnsignedInt max = 0;
+    for(const UnsignedInt index: indices) max = Math::max(max, index);
+    if(max <= 0xff) _indexType = MeshIndexType::UnsignedByte;
+    else if(max <= 0xffff) _indexType = MeshIndexType::UnsignedShort;
+    else _indexType = MeshIndexType::UnsignedInt;
+    _indexData = Containers::Array<char>{Containers::NoInit, indices.size()*meshIndexTypeSize(_indexType)};
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        if(_indexType == MeshIndexType::UnsignedByte)
+            reinterpret_cast<UnsignedByte*>(_indexData.data())[i] = indices[i];
+        else if(_indexType == MeshIndexType::UnsignedShort)
+            reinterpret_cast<UnsignedShort*>(_indexData.data())[i] = indices[i];
+        else
+            reinterpret_cast<UnsignedInt*>(_indexData.data())[i] = indices[i];
+    }
+}
+
+MeshData::MeshData(MeshData&&) noexcept = default;
+
+MeshData::~MeshData() = default;
+
+MeshData& MeshData::operator=(MeshData&&) noexcept = default;
+
+MeshIndexType MeshData::indexType() const {
+    CORRADE_ASSERT(_indexed, "Trade::MeshData::indexType(): the mesh is not indexed", {});
+    return _indexType;
+}
+
+UnsignedInt MeshData::indexCount() const {
+    return _indexed ? _indexData.size()/meshIndexTypeSize(_indexType) : 0;
+}
+
+std::vector<UnsignedInt> MeshData::indicesAsArray() const {
+    CORRADE_ASSERT(_indexed, "Trade::MeshData::indicesAsArray(): the mesh is not indexed", {});
+    std::vector<UnsignedInt> out(indexCount());
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        if(_indexType == MeshIndexType::UnsignedByte)
+            out[i] = reinterpret_cast<const UnsignedByte*>(_indexData.data())[i];
+        else if(_indexType == MeshIndexType::UnsignedShort)
+            out[i] = reinterpret_cast<const UnsignedShort*>(_indexData.data())[i];
+        else
+            out[i] = reinterpret_cast<const UnsignedInt*>(_indexData.data())[i];
+    }
+    return out;
+}
+
+UnsignedInt MeshData::attributeCount(const MeshAttribute name) const {
+    UnsignedInt count = 0;
+    for(const MeshAttributeData& attribute: _attributes)
+        if(attribute.name == name) ++count;
+    return count;
+}
+
+UnsignedInt MeshData::attributeId(const MeshAttribute name, const UnsignedInt id) const {
+    UnsignedInt found = 0;
+    for(std::size_t i = 0; i != _attributes.size(); ++i)
+        if(_attributes[i].name == name && found++ == id) return i;
+    CORRADE_ASSERT(false, "Trade::MeshData::attributeId(): index" << id << "out of range for" << attributeCount(name) << name << "attributes", {});
+    return {}; /* LCOV_EXCL_LINE */
+}
+
+namespace {
+
+template<class T> Float componentAsFloat(const char* const data, const bool normalized) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return normalized ? Math::unpack<Float>(value) : Float(value);
+}
+
+}
+
+void MeshData::attributeIntoFloats(const UnsignedInt id, Float* const out, const UnsignedInt outComponents, const Float lastComponent) const {
+    const MeshAttributeData& attribute = _attributes[id];
+    const UnsignedInt componentSize = meshBlobAttributeTypeSize(attribute.type);
+
+    for(std::size_t i = 0; i != _vertexCount; ++i) {
+        const char* const element = _vertexData.data() + attribute.offset + i*attribute.stride;
+        Float* const outElement = out + i*outComponents;
+
+        /* Components that are not in the data are zero, except for the
+           last one, which is 1 for e.g. color alpha */
+        for(UnsignedInt j = 0; j != outComponents; ++j)
+            outElement[j] = j + 1 == outComponents ? lastComponent : 0.0f;
+
+        /* The 2.10.10.10 format is packed into a single 32-bit value */
+        if(attribute.type == MeshBlobAttributeType::Int2101010Rev) {
+            UnsignedInt packed;
+            std::memcpy(&packed, element, sizeof(UnsignedInt));
+            const Int values[]{
+                Int(packed << 22) >> 22,
+                Int(packed << 12) >> 22,
+                Int(packed << 2) >> 22,
+                Int(packed) >> 30
+            };
+            for(UnsignedInt j = 0; j != outComponents; ++j)
+                outElement[j] = attribute.normalized ?
+                    Math::max(Float(values[j])/(j == 3 ? 1.0f : 511.0f), -1.0f) : Float(values[j]);
+            continue;
+        }
+
+        for(UnsignedInt j = 0; j != Math::min(outComponents, UnsignedInt(attribute.components)); ++j) {
+            const char* const component = element + j*componentSize;
+            switch(attribute.type) {
+                case MeshBlobAttributeType::UnsignedByte:
+                    outElement[j] = componentAsFloat<UnsignedByte>(component, attribute.normalized);
+                    break;
+                case MeshBlobAttributeType::Byte:
+                    outElement[j] = componentAsFloat<Byte>(component, attribute.normalized);
+                    break;
+                case MeshBlobAttributeType::UnsignedShort:
+                    outElement[j] = componentAsFloat<UnsignedShort>(component, attribute.normalized);
+                    break;
+                case MeshBlobAttributeType::Short:
+                    outElement[j] = componentAsFloat<Short>(component, attribute.normalized);
+                    break;
+                case MeshBlobAttributeType::UnsignedInt:
+                    outElement[j] = componentAsFloat<UnsignedInt>(component, attribute.normalized);
+                    break;
+                case MeshBlobAttributeType::Int:
+                    outElement[j] = componentAsFloat<Int>(component, attribute.normalized);
+                    break;
+                case MeshBlobAttributeType::HalfFloat: {
+                    UnsignedShort value;
+                    std::memcpy(&value, component, sizeof(UnsignedShort));
+                    outElement[j] = Math::unpackHalf(value);
+                } break;
+                case MeshBlobAttributeType::Float:
+                    std::memcpy(outElement + j, component, sizeof(Float));
+                    break;
+                case MeshBlobAttributeType::Int2101010Rev:
+                    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+            }
+        }
+    }
+}
+
+std::vector<Vector3> MeshData::positions3DAsArray(const UnsignedInt id) const {
+    std::vector<Vector3> out(_vertexCount);
+    attributeIntoFloats(attributeId(MeshAttribute::Position, id), out.data()->data(), 3, 0.0f);
+    return out;
+}
+
+std::vector<Vector3> MeshData::normalsAsArray(const UnsignedInt id) const {
+    std::vector<Vector3> out(_vertexCount);
+    attributeIntoFloats(attributeId(MeshAttribute::Normal, id), out.data()->data(), 3, 0.0f);
+    return out;
+}
+
+std::vector<Vector2> MeshData::textureCoordinates2DAsArray(const UnsignedInt id) const {
+    std::vector<Vector2> out(_vertexCount);
+    attributeIntoFloats(attributeId(MeshAttribute::TextureCoordinates, id), out.data()->data(), 2, 0.0f);
+    return out;
+}
+
+std::vector<Color4> MeshData::colorsAsArray(const UnsignedInt id) const {
+    std::vector<Color4> out(_vertexCount);
+    attributeIntoFloats(attributeId(MeshAttribute::Color, id), out.data()->data(), 4, 1.0f);
+    return out;
+}
+
+Containers::Array<char> MeshData::releaseIndexData() {
+    return std::move(_indexData);
+}
+
+Containers::Array<char> MeshData::releaseVertexData() {
+    _vertexCount = 0;
+    return std::move(_vertexData);
+}
+
+}}
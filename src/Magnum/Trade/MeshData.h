@@ -0,0 +1,350 @@
+#ifndef Magnum_Trade_MeshData_h
+#define Magnum_Trade_MeshData_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshData, struct @ref Magnum::Trade::MeshAttributeData, enum @ref Magnum::Trade::MeshAttribute
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Trade/MeshBlob.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh attribute name
+
+@see @ref MeshAttributeData, @ref MeshData
+*/
+enum class MeshAttribute: UnsignedByte {
+    Position,           /**< Position */
+    Normal,             /**< Normal */
+    TextureCoordinates, /**< Texture coordinates */
+    Color,              /**< Vertex color */
+    JointIds,           /**< Skinning joint IDs */
+    Weights             /**< Skinning weights */
+};
+
+/** @debugoperatorenum{MeshAttribute} */
+MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, MeshAttribute value);
+
+/**
+@brief Mesh attribute data
+
+Describes layout of one attribute in the vertex data of a @ref MeshData.
+Unlike @ref MeshBlobAttribute each attribute has its own stride, so the
+attributes can be interleaved, stored in separate consecutive blocks or any
+combination of the two.
+*/
+struct MeshAttributeData {
+    /** @brief Default constructor */
+    constexpr explicit MeshAttributeData() noexcept: name{}, type{}, components{}, normalized{}, stride{}, offset{} {}
+
+    /**
+     * @brief Constructor
+     * @param name          Attribute name
+     * @param type          Component type
+     * @param components    Component count, from @cpp 1 @ce to @cpp 4 @ce
+     * @param offset        Offset of the first element in the vertex data
+     * @param stride        Distance between two consecutive elements
+     * @param normalized    Whether integer components are normalized to the
+     *      @f$ [0, 1] @f$ or @f$ [-1, 1] @f$ range
+     */
+    constexpr explicit MeshAttributeData(MeshAttribute name, MeshBlobAttributeType type, UnsignedByte components, std::size_t offset, UnsignedInt stride, bool normalized = false) noexcept: name{name}, type{type}, components{components}, normalized{normalized}, stride{stride}, offset{offset} {}
+
+    /** @brief Size of one element in bytes */
+    UnsignedInt size() const {
+        return type == MeshBlobAttributeType::Int2101010Rev ?
+            meshBlobAttributeTypeSize(type) : meshBlobAttributeTypeSize(type)*components;
+    }
+
+    MeshAttribute name;             /**< @brief Attribute name */
+    MeshBlobAttributeType type;     /**< @brief Component type */
+    UnsignedByte components;        /**< @brief Component count */
+    bool normalized;                /**< @brief Whether the data are normalized */
+    UnsignedInt stride;             /**< @brief Stride */
+    std::size_t offset;             /**< @brief Offset in the vertex data */
+};
+
+/**
+@brief Mesh data
+
+Owns a single vertex data allocation described by a list of
+@ref MeshAttributeData and an optional single index data allocation of any
+@ref MeshIndexType. Compared to @ref MeshData3D, where each attribute is a
+separate @ref std::vector of 32-bit floats, an importer can hand out the data
+in a packed, GPU-ready format as they are stored in the file, and the whole
+mesh is just three allocations regardless of attribute count.
+
+Typed access to the attributes is provided through @ref attribute(), which
+returns a strided view directly on the vertex data. The
+@ref positions3DAsArray(), @ref normalsAsArray(),
+@ref textureCoordinates2DAsArray() and @ref colorsAsArray() convenience
+functions convert any supported attribute type to floats, which is useful
+for processing the data without caring about the actual storage format:
+
+@snippet MagnumTrade.cpp MeshData-usage
+
+Meshes from importers that implement only @ref AbstractImporter::mesh3D()
+are converted using @ref MeshData(const MeshData3D&) in
+@ref AbstractImporter::mesh().
+*/
+class MAGNUM_TRADE_EXPORT MeshData {
+    public:
+        /**
+         * @brief Construct an indexed mesh data
+         * @param primitive     Primitive
+         * @param indexType     Index type
+         * @param indexData     Index data
+         * @param vertexData    Vertex data
+         * @param attributes    Description of all vertex attributes
+         * @param vertexCount   Vertex count
+         * @param importerState Importer-specific state
+         *
+         * Expects that size of @p indexData is divisible by size of
+         * @p indexType and that all @p attributes fit into @p vertexData.
+         */
+        explicit MeshData(MeshPrimitive primitive, MeshIndexType indexType, Containers::Array<char>&& indexData, Containers::Array<char>&& vertexData, Containers::Array<MeshAttributeData>&& attributes, UnsignedInt vertexCount, const void* importerState = nullptr) noexcept;
+
+        /**
+         * @brief Construct a non-indexed mesh data
+         * @param primitive     Primitive
+         * @param vertexData    Vertex data
+         * @param attributes    Description of all vertex attributes
+         * @param vertexCount   Vertex count
+         * @param importerState Importer-specific state
+         *
+         * Expects that all @p attributes fit into @p vertexData.
+         */
+        explicit MeshData(MeshPrimitive primitive, Containers::Array<char>&& vertexData, Containers::Array<MeshAttributeData>&& attributes, UnsignedInt vertexCount, const void* importerState = nullptr) noexcept;
+
+        /**
+         * @brief Construct from a @ref MeshData3D
+         *
+         * Interleaves all attributes of @p data into a single vertex data
+         * allocation, keeping them as 32-bit floats (or 32-bit integers for
+         * joint IDs). Indices are stored using the smallest
+         * @ref MeshIndexType that can represent all of them. The importer
+         * state is passed through.
+         */
+        explicit MeshData(const MeshData3D& data);
+
+        /** @brief Copying is not allowed */
+        MeshData(const MeshData&) = delete;
+
+        /** @brief Move constructor */
+        MeshData(MeshData&&) noexcept;
+
+        ~MeshData();
+
+        /** @brief Copying is not allowed */
+        MeshData& operator=(const MeshData&) = delete;
+
+        /** @brief Move assignment */
+        MeshData& operator=(MeshData&&) noexcept;
+
+        /** @brief Primitive */
+        MeshPrimitive primitive() const { return _primitive; }
+
+        /** @brief Whether the mesh is indexed */
+        bool isIndexed() const { return _indexed; }
+
+        /**
+         * @brief Index type
+         *
+         * Expects that the mesh is indexed.
+         * @see @ref isIndexed()
+         */
+        MeshIndexType indexType() const;
+
+        /**
+         * @brief Index count
+         *
+         * Returns @cpp 0 @ce if the mesh is not indexed.
+         */
+        UnsignedInt indexCount() const;
+
+        /**
+         * @brief Raw index data
+         *
+         * Empty if the mesh is not indexed.
+         */
+        Containers::ArrayView<const char> indexData() const { return _indexData; }
+
+        /**
+         * @brief Typed indices
+         *
+         * Expects that the mesh is indexed and @p T corresponds to
+         * @ref indexType().
+         */
+        template<class T> Containers::ArrayView<const T> indices() const;
+
+        /**
+         * @brief Indices converted to 32-bit integers
+         *
+         * Expects that the mesh is indexed.
+         */
+        std::vector<UnsignedInt> indicesAsArray() const;
+
+        /** @brief Vertex count */
+        UnsignedInt vertexCount() const { return _vertexCount; }
+
+        /** @brief Raw vertex data */
+        Containers::ArrayView<const char> vertexData() const { return _vertexData; }
+
+        /** @brief Description of all attributes */
+        Containers::ArrayView<const MeshAttributeData> attributes() const { return _attributes; }
+
+        /** @brief Count of all attributes */
+        UnsignedInt attributeCount() const { return _attributes.size(); }
+
+        /** @brief Count of attributes of given name */
+        UnsignedInt attributeCount(MeshAttribute name) const;
+
+        /**
+         * @brief Absolute ID of a named attribute
+         *
+         * Expects that @p id is less than @ref attributeCount(MeshAttribute) const
+         * for given @p name.
+         */
+        UnsignedInt attributeId(MeshAttribute name, UnsignedInt id = 0) const;
+
+        /**
+         * @brief Typed attribute data
+         *
+         * Expects that @p id is less than @ref attributeCount() const and
+         * size of @p T is the same as the attribute size. No other type
+         * checking is done.
+         */
+        template<class T> Containers::StridedArrayView<const T> attribute(UnsignedInt id) const;
+
+        /**
+         * @brief Typed named attribute data
+         *
+         * Equivalent to calling @ref attribute(UnsignedInt) const with
+         * @ref attributeId().
+         */
+        template<class T> Containers::StridedArrayView<const T> attribute(MeshAttribute name, UnsignedInt id = 0) const {
+            return attribute<T>(attributeId(name, id));
+        }
+
+        /**
+         * @brief Positions converted to floats
+         *
+         * Converts @ref MeshAttribute::Position attribute @p id from any
+         * supported type, unpacking normalized integers. Two-component
+         * positions get zero Z coordinate.
+         */
+        std::vector<Vector3> positions3DAsArray(UnsignedInt id = 0) const;
+
+        /**
+         * @brief Normals converted to floats
+         *
+         * Converts @ref MeshAttribute::Normal attribute @p id from any
+         * supported type, unpacking normalized integers.
+         */
+        std::vector<Vector3> normalsAsArray(UnsignedInt id = 0) const;
+
+        /**
+         * @brief Texture coordinates converted to floats
+         *
+         * Converts @ref MeshAttribute::TextureCoordinates attribute @p id
+         * from any supported type, unpacking normalized integers.
+         */
+        std::vector<Vector2> textureCoordinates2DAsArray(UnsignedInt id = 0) const;
+
+        /**
+         * @brief Colors converted to floats
+         *
+         * Converts @ref MeshAttribute::Color attribute @p id from any
+         * supported type, unpacking normalized integers. Three-component
+         * colors get alpha set to @cpp 1.0f @ce.
+         */
+        std::vector<Color4> colorsAsArray(UnsignedInt id = 0) const;
+
+        /**
+         * @brief Release index data storage
+         *
+         * Releases the ownership of the index data and resets the index
+         * count to zero. The mesh stays marked as indexed.
+         */
+        Containers::Array<char> releaseIndexData();
+
+        /**
+         * @brief Release vertex data storage
+         *
+         * Releases the ownership of the vertex data and resets the vertex
+         * count to zero. The attribute descriptions are kept, but further
+         * attribute access is not possible.
+         */
+        Containers::Array<char> releaseVertexData();
+
+        /**
+         * @brief Importer-specific state
+         *
+         * See @ref AbstractImporter::importerState() for more information.
+         */
+        const void* importerState() const { return _importerState; }
+
+    private:
+        void attributeIntoFloats(UnsignedInt id, Float* out, UnsignedInt outComponents, Float lastComponent) const;
+
+        MeshPrimitive _primitive;
+        MeshIndexType _indexType;
+        bool _indexed;
+        UnsignedInt _vertexCount;
+        Containers::Array<char> _indexData, _vertexData;
+        Containers::Array<MeshAttributeData> _attributes;
+        const void* _importerState;
+};
+
+template<class T> Containers::ArrayView<const T> MeshData::indices() const {
+    CORRADE_ASSERT(_indexed, "Trade::MeshData::indices(): the mesh is not indexed", {});
+    CORRADE_ASSERT(sizeof(T) == meshIndexTypeSize(_indexType),
+        "Trade::MeshData::indices(): improper type requested for" << _indexType, {});
+    return {reinterpret_cast<const T*>(_indexData.data()), _indexData.size()/sizeof(T)};
+}
+
+template<class T> Containers::StridedArrayView<const T> MeshData::attribute(UnsignedInt id) const {
+    CORRADE_ASSERT(id < _attributes.size(),
+        "Trade::MeshData::attribute(): index" << id << "out of range for" << _attributes.size() << "attributes", {});
+    const MeshAttributeData& attribute = _attributes[id];
+    CORRADE_ASSERT(sizeof(T) == attribute.size(),
+        "Trade::MeshData::attribute(): improper type requested for" << attribute.name << "of" << attribute.size() << "bytes", {});
+    return {reinterpret_cast<const T*>(_vertexData.data() + attribute.offset), _vertexCount, std::ptrdiff_t(attribute.stride)};
+}
+
+}}
+
+#endif
@@ -26,11 +26,16 @@
 #include "MeshData3D.h"
 
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Vector4.h"
 
 namespace Magnum { namespace Trade {
 
-MeshData3D::MeshData3D(const MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<std::vector<Color4>> colors, const void* const importerState): _primitive{primitive}, _indices{std::move(indices)}, _positions{std::move(positions)}, _normals{std::move(normals)}, _textureCoords2D{std::move(textureCoords2D)}, _colors{std::move(colors)}, _importerState{importerState} {
+MeshData3D::MeshData3D(const MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<std::vector<Color4>> colors, const void* const importerState): MeshData3D{primitive, std::move(indices), std::move(positions), std::move(normals), std::move(textureCoords2D), std::move(colors), {}, {}, importerState} {}
+
+MeshData3D::MeshData3D(const MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<std::vector<Color4>> colors, std::vector<std::vector<Vector4ui>> jointIds, std::vector<std::vector<Vector4>> weights, const void* const importerState): _primitive{primitive}, _indices{std::move(indices)}, _positions{std::move(positions)}, _normals{std::move(normals)}, _textureCoords2D{std::move(textureCoords2D)}, _colors{std::move(colors)}, _jointIds{std::move(jointIds)}, _weights{std::move(weights)}, _importerState{importerState} {
     CORRADE_ASSERT(!_positions.empty(), "Trade::MeshData3D: no position array specified", );
+    CORRADE_ASSERT(_jointIds.size() == _weights.size(),
+        "Trade::MeshData3D: expected the same count of joint ID and weight arrays but got" << _jointIds.size() << "and" << _weights.size(), );
 }
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -101,4 +106,24 @@ const std::vector<Color4>& MeshData3D::colors(const UnsignedInt id) const {
     return _colors[id];
 }
 
+std::vector<Vector4ui>& MeshData3D::jointIds(const UnsignedInt id) {
+    CORRADE_ASSERT(id < jointArrayCount(), "Trade::MeshData3D::jointIds(): index out of range", _jointIds[id]);
+    return _jointIds[id];
+}
+
+const std::vector<Vector4ui>& MeshData3D::jointIds(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < jointArrayCount(), "Trade::MeshData3D::jointIds(): index out of range", _jointIds[id]);
+    return _jointIds[id];
+}
+
+std::vector<Vector4>& MeshData3D::weights(const UnsignedInt id) {
+    CORRADE_ASSERT(id < jointArrayCount(), "Trade::MeshData3D::weights(): index out of range", _weights[id]);
+    return _weights[id];
+}
+
+const std::vector<Vector4>& MeshData3D::weights(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < jointArrayCount(), "Trade::MeshData3D::weights(): index out of range", _weights[id]);
+    return _weights[id];
+}
+
 }}
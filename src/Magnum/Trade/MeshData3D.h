@@ -69,6 +69,25 @@ class MAGNUM_TRADE_EXPORT MeshData3D {
          */
         explicit MeshData3D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<std::vector<Color4>> colors, const void* importerState = nullptr);
 
+        /**
+         * @brief Construct a skinned mesh
+         * @param primitive         Primitive
+         * @param indices           Index array or empty array, if the mesh is
+         *      not indexed
+         * @param positions         Position arrays. At least one position
+         *      array should be present.
+         * @param normals           Normal arrays, if present
+         * @param textureCoords2D   Two-dimensional texture coordinate arrays,
+         *      if present
+         * @param colors            Vertex color arrays, if present
+         * @param jointIds          Joint ID arrays, if present. Each vertex
+         *      references up to four joints.
+         * @param weights           Joint weight arrays. Expected to have the
+         *      same count as @p jointIds.
+         * @param importerState     Importer-specific state
+         */
+        explicit MeshData3D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<std::vector<Color4>> colors, std::vector<std::vector<Vector4ui>> jointIds, std::vector<std::vector<Vector4>> weights, const void* importerState = nullptr);
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /** @brief @copybrief MeshData3D(MeshPrimitive, std::vector<UnsignedInt>, std::vector<std::vector<Vector3>>, std::vector<std::vector<Vector3>>, std::vector<std::vector<Vector2>>, std::vector<std::vector<Color4>>, const void*)
          * @deprecated Use @ref MeshData3D(MeshPrimitive, std::vector<UnsignedInt>, std::vector<std::vector<Vector3>>, std::vector<std::vector<Vector3>>, std::vector<std::vector<Vector2>>, std::vector<std::vector<Color4>>, const void*) instead.
@@ -179,6 +198,41 @@ class MAGNUM_TRADE_EXPORT MeshData3D {
         std::vector<Color4>& colors(UnsignedInt id);
         const std::vector<Color4>& colors(UnsignedInt id) const; /**< @overload */
 
+        /**
+         * @brief Whether the data contain any joint IDs and weights
+         *
+         * @see @ref Shaders::Phong::Flag::Skinning
+         */
+        bool hasJoints() const { return !_jointIds.empty(); }
+
+        /**
+         * @brief Count of joint ID and weight arrays
+         *
+         * The joint ID and weight arrays always come in pairs.
+         */
+        UnsignedInt jointArrayCount() const { return _jointIds.size(); }
+
+        /**
+         * @brief Joint IDs
+         * @param id    Joint array ID
+         *
+         * Each vertex references up to four joints.
+         * @see @ref jointArrayCount(), @ref weights()
+         */
+        std::vector<Vector4ui>& jointIds(UnsignedInt id);
+        const std::vector<Vector4ui>& jointIds(UnsignedInt id) const; /**< @overload */
+
+        /**
+         * @brief Joint weights
+         * @param id    Joint array ID
+         *
+         * Weights of joints referenced by @ref jointIds() with the same
+         * @p id.
+         * @see @ref jointArrayCount()
+         */
+        std::vector<Vector4>& weights(UnsignedInt id);
+        const std::vector<Vector4>& weights(UnsignedInt id) const; /**< @overload */
+
         /**
          * @brief Importer-specific state
          *
@@ -193,6 +247,8 @@ class MAGNUM_TRADE_EXPORT MeshData3D {
         std::vector<std::vector<Vector3>> _normals;
         std::vector<std::vector<Vector2>> _textureCoords2D;
         std::vector<std::vector<Color4>> _colors;
+        std::vector<std::vector<Vector4ui>> _jointIds;
+        std::vector<std::vector<Vector4>> _weights;
         const void* _importerState;
 };
 
@@ -0,0 +1,96 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshInstanceBatch3D.h"
+
+#include <algorithm>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Trade/FlatSceneData3D.h"
+
+namespace Magnum { namespace Trade {
+
+std::pair<Containers::Array<MeshInstanceBatch3D>, Containers::Array<MeshInstanceData3D>> meshInstanceBatches3D(const FlatSceneData3D& scene, const Containers::ArrayView<const Matrix4> absoluteTransformations) {
+    CORRADE_ASSERT(absoluteTransformations.size() == scene.objectCount(),
+        "Trade::meshInstanceBatches3D(): expected" << scene.objectCount() << "transformations but got" << absoluteTransformations.size(), {});
+
+    /* Gather all mesh objects and sort them by mesh and material. The sort is
+       stable, so the instances stay in the order they are in the scene. */
+    std::vector<UnsignedInt> objects;
+    for(UnsignedInt i = 0; i != scene.objectCount(); ++i)
+        if(scene.instanceTypes()[i] == ObjectInstanceType3D::Mesh && scene.instances()[i] >= 0)
+            objects.push_back(i);
+    const Containers::ArrayView<const Int> meshes = scene.instances();
+    const Containers::ArrayView<const Int> materials = scene.materials();
+    std::stable_sort(objects.begin(), objects.end(), [meshes, materials](UnsignedInt a, UnsignedInt b) {
+        return meshes[a] < meshes[b] || (meshes[a] == meshes[b] && materials[a] < materials[b]);
+    });
+
+    std::size_t batchCount = 0;
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        if(!i || meshes[objects[i]] != meshes[objects[i - 1]] || materials[objects[i]] != materials[objects[i - 1]])
+            ++batchCount;
+
+    Containers::Array<MeshInstanceBatch3D> batches{Containers::NoInit, batchCount};
+    Containers::Array<MeshInstanceData3D> instances{Containers::NoInit, objects.size()};
+    std::size_t batch = 0;
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        const UnsignedInt object = objects[i];
+        if(!i || meshes[object] != meshes[objects[i - 1]] || materials[object] != materials[objects[i - 1]]) {
+            if(i) ++batch;
+            batches[batch] = MeshInstanceBatch3D{UnsignedInt(meshes[object]), materials[object], UnsignedInt(i), 0};
+        }
+        ++batches[batch].count;
+
+        const Matrix4& transformation = absoluteTransformations[object];
+        instances[i] = MeshInstanceData3D{transformation, transformation.rotationScaling().inverted().transposed()};
+    }
+
+    return {std::move(batches), std::move(instances)};
+}
+
+std::pair<Containers::Array<MeshInstanceBatch3D>, Containers::Array<MeshInstanceData3D>> meshInstanceBatches3D(const FlatSceneData3D& scene) {
+    /* Walk the hierarchy breadth-first so each parent is processed before its
+       children */
+    const Containers::ArrayView<const Matrix4> transformations = scene.transformations();
+    Containers::Array<Matrix4> absoluteTransformations{scene.objectCount()};
+    std::vector<UnsignedInt> queue;
+    queue.reserve(scene.objectCount());
+    for(const UnsignedInt root: scene.roots()) {
+        absoluteTransformations[root] = transformations[root];
+        queue.push_back(root);
+    }
+    for(std::size_t i = 0; i != queue.size(); ++i) {
+        for(const UnsignedInt child: scene.children(queue[i])) {
+            absoluteTransformations[child] = absoluteTransformations[queue[i]]*transformations[child];
+            queue.push_back(child);
+        }
+    }
+
+    return meshInstanceBatches3D(scene, absoluteTransformations);
+}
+
+}}
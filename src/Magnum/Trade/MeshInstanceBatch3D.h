@@ -0,0 +1,125 @@
+#ifndef Magnum_Trade_MeshInstanceBatch3D_h
+#define Magnum_Trade_MeshInstanceBatch3D_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Trade::MeshInstanceBatch3D, @ref Magnum::Trade::MeshInstanceData3D, function @ref Magnum::Trade::meshInstanceBatches3D()
+ */
+
+#include <utility>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Per-instance mesh data
+
+Layout matches the @ref Shaders::Phong::TransformationMatrix and
+@ref Shaders::Phong::NormalMatrix attributes, so an array of these can be
+uploaded directly to a buffer used with
+@ref Shaders::Phong::Flag::InstancedTransformation.
+@see @ref meshInstanceBatches3D()
+*/
+struct MeshInstanceData3D {
+    /** @brief Absolute transformation */
+    Matrix4 transformation;
+
+    /** @brief Normal matrix */
+    Matrix3x3 normalMatrix;
+};
+
+/**
+@brief Batch of mesh instances
+
+Range of instances sharing the same mesh and material.
+@see @ref meshInstanceBatches3D()
+*/
+struct MeshInstanceBatch3D {
+    /** @brief Mesh ID */
+    UnsignedInt mesh;
+
+    /** @brief Material ID or @cpp -1 @ce */
+    Int material;
+
+    /** @brief Offset of the first instance */
+    UnsignedInt offset;
+
+    /** @brief Instance count */
+    UnsignedInt count;
+};
+
+/**
+@brief Collapse repeated mesh references into instance batches
+@param scene                    Scene
+@param absoluteTransformations  Absolute transformations of all objects in
+    the scene
+@return Batches of instances and a data array they index into
+
+Groups all objects of @ref ObjectInstanceType3D::Mesh type that reference
+the same mesh with the same material. Each group is then drawn with a single
+instanced draw instead of one draw per object:
+
+@code{.cpp}
+std::pair<Containers::Array<Trade::MeshInstanceBatch3D>, Containers::Array<Trade::MeshInstanceData3D>> batches = Trade::meshInstanceBatches3D(*scene);
+
+GL::Buffer instances;
+instances.setData(batches.second, GL::BufferUsage::StaticDraw);
+for(const Trade::MeshInstanceBatch3D& batch: batches.first) {
+    GL::Mesh& mesh = meshes[batch.mesh];
+    mesh.addVertexBufferInstanced(instances, 1,
+            batch.offset*sizeof(Trade::MeshInstanceData3D),
+            Shaders::Phong::TransformationMatrix{},
+            Shaders::Phong::NormalMatrix{})
+        .setInstanceCount(batch.count);
+    mesh.draw(shaders[batch.material]);
+}
+@endcode
+
+The batches are sorted by mesh and then by material ID, instances in each
+batch are in the order they are in the scene. Objects with a negative mesh ID
+are ignored. Expects that @p absoluteTransformations has the same size as
+@ref FlatSceneData3D::objectCount().
+@see @ref SceneGraph::FlatScene::absoluteTransformations()
+*/
+MAGNUM_TRADE_EXPORT std::pair<Containers::Array<MeshInstanceBatch3D>, Containers::Array<MeshInstanceData3D>> meshInstanceBatches3D(const FlatSceneData3D& scene, Containers::ArrayView<const Matrix4> absoluteTransformations);
+
+/**
+@brief Collapse repeated mesh references into instance batches
+@param scene                    Scene
+
+Calculates absolute transformations directly from the scene hierarchy and
+then calls @ref meshInstanceBatches3D(const FlatSceneData3D&, Containers::ArrayView<const Matrix4>).
+*/
+MAGNUM_TRADE_EXPORT std::pair<Containers::Array<MeshInstanceBatch3D>, Containers::Array<MeshInstanceData3D>> meshInstanceBatches3D(const FlatSceneData3D& scene);
+
+}}
+
+#endif
@@ -64,9 +64,16 @@ class AbstractImageConverterTest: public TestSuite::Tester {
 
         void exportImageDataToData();
 
+        void exportToSink();
+        void exportToSinkThroughData();
+        void exportToSinkNotSupported();
+        void exportToSinkNotImplemented();
+
         void exportToFile();
         void exportToFileThroughData();
         void exportToFileThroughDataNotWritable();
+        void exportToFileThroughSink();
+        void exportToFileThroughSinkNotWritable();
         void exportToFileNotSupported();
         void exportToFileNotImplemented();
 
@@ -104,9 +111,16 @@ AbstractImageConverterTest::AbstractImageConverterTest() {
 
               &AbstractImageConverterTest::exportImageDataToData,
 
+              &AbstractImageConverterTest::exportToSink,
+              &AbstractImageConverterTest::exportToSinkThroughData,
+              &AbstractImageConverterTest::exportToSinkNotSupported,
+              &AbstractImageConverterTest::exportToSinkNotImplemented,
+
               &AbstractImageConverterTest::exportToFile,
               &AbstractImageConverterTest::exportToFileThroughData,
               &AbstractImageConverterTest::exportToFileThroughDataNotWritable,
+              &AbstractImageConverterTest::exportToFileThroughSink,
+              &AbstractImageConverterTest::exportToFileThroughSinkNotWritable,
               &AbstractImageConverterTest::exportToFileNotSupported,
               &AbstractImageConverterTest::exportToFileNotImplemented,
 
@@ -343,6 +357,87 @@ void AbstractImageConverterTest::exportImageDataToData() {
     }
 }
 
+namespace {
+
+class SinkExporter: public Trade::AbstractImageConverter {
+    private:
+        Features doFeatures() const override { return Feature::ConvertStream; }
+
+        /* Each row as a separate chunk */
+        bool doExportToSink(const ImageView2D& image, bool(*sink)(Containers::ArrayView<const char>, void*), void* userData) override {
+            for(Int y = 0; y != image.size().y(); ++y) {
+                const char row[]{char(image.size().x()), char(y)};
+                if(!sink(row, userData)) return false;
+            }
+            return true;
+        }
+};
+
+bool appendToString(Containers::ArrayView<const char> data, void* userData) {
+    static_cast<std::string*>(userData)->append(data.data(), data.size());
+    return true;
+}
+
+}
+
+void AbstractImageConverterTest::exportToSink() {
+    SinkExporter exporter;
+    std::string out;
+    CORRADE_VERIFY(exporter.exportToSink(ImageView2D{PixelFormat::RGBA8Unorm, {0x0a, 3}, {nullptr, 0x0a*3*4}}, appendToString, &out));
+    CORRADE_COMPARE(out, (std::string{"\x0a\x00\x0a\x01\x0a\x02", 6}));
+
+    /* Aborting in the middle */
+    std::size_t chunkCount = 0;
+    CORRADE_VERIFY(!exporter.exportToSink(ImageView2D{PixelFormat::RGBA8Unorm, {0x0a, 3}, {nullptr, 0x0a*3*4}}, [](Containers::ArrayView<const char>, void* userData) {
+        return ++*static_cast<std::size_t*>(userData) != 2;
+    }, &chunkCount));
+    CORRADE_COMPARE(chunkCount, 2);
+}
+
+void AbstractImageConverterTest::exportToSinkThroughData() {
+    class DataExporter: public AbstractImageConverter {
+        Features doFeatures() const override { return Feature::ConvertData; }
+
+        Containers::Array<char> doExportToData(const ImageView2D& image) override {
+            return Containers::Array<char>{Containers::InPlaceInit,
+                {char(image.size().x()), char(image.size().y())}};
+        };
+    };
+
+    /* doExportToSink() should call doExportToData() and pass the result in
+       a single chunk */
+    DataExporter exporter;
+    std::string out;
+    CORRADE_VERIFY(exporter.exportToSink(ImageView2D{PixelFormat::RGBA8Unorm, {0xfe, 0xed}, {nullptr, 0xfe*0xed*4}}, appendToString, &out));
+    CORRADE_COMPARE(out, "\xfe\xed");
+}
+
+void AbstractImageConverterTest::exportToSinkNotSupported() {
+    class Converter: public AbstractImageConverter {
+        Features doFeatures() const override { return Feature::ConvertFile; }
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Converter converter;
+    converter.exportToSink(ImageView2D{PixelFormat::RGBA8Unorm, {4, 6}, {nullptr, 96}}, appendToString);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImageConverter::exportToSink(): feature not supported\n");
+}
+
+void AbstractImageConverterTest::exportToSinkNotImplemented() {
+    class Converter: public AbstractImageConverter {
+        Features doFeatures() const override { return Feature::ConvertStream; }
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Converter converter;
+    converter.exportToSink(ImageView2D{PixelFormat::RGBA8Unorm, {4, 6}, {nullptr, 96}}, appendToString);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImageConverter::exportToSink(): feature advertised but not implemented\n");
+}
+
 void AbstractImageConverterTest::exportToFile() {
     class Converter: public AbstractImageConverter {
         Features doFeatures() const override { return Feature::ConvertData; }
@@ -402,6 +497,27 @@ void AbstractImageConverterTest::exportToFileThroughDataNotWritable() {
         "Trade::AbstractImageConverter::exportToFile(): cannot write to file /some/path/that/does/not/exist\n");
 }
 
+void AbstractImageConverterTest::exportToFileThroughSink() {
+    /* Remove previous file */
+    Utility::Directory::rm(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "image.out"));
+
+    /* doExportToFile() should write the chunks from doExportToSink() */
+    SinkExporter exporter;
+    CORRADE_VERIFY(exporter.exportToFile(ImageView2D{PixelFormat::RGBA8Unorm, {0x0a, 3}, {nullptr, 0x0a*3*4}}, Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "image.out")));
+    CORRADE_COMPARE_AS(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "image.out"),
+        (std::string{"\x0a\x00\x0a\x01\x0a\x02", 6}), TestSuite::Compare::FileToString);
+}
+
+void AbstractImageConverterTest::exportToFileThroughSinkNotWritable() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    SinkExporter exporter;
+    CORRADE_VERIFY(!exporter.exportToFile(ImageView2D{PixelFormat::RGBA8Unorm, {0x0a, 3}, {nullptr, 0x0a*3*4}}, "/some/path/that/does/not/exist"));
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractImageConverter::exportToFile(): cannot write to file /some/path/that/does/not/exist\n");
+}
+
 void AbstractImageConverterTest::exportToFileNotSupported() {
     class Converter: public AbstractImageConverter {
         Features doFeatures() const override { return {}; }
@@ -31,8 +31,10 @@
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/CameraData.h"
+#include "Magnum/Trade/FlatSceneData3D.h"
 #include "Magnum/Trade/ImageData.h"
 #include "Magnum/Trade/LightData.h"
+#include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
 #include "Magnum/Trade/MeshObjectData2D.h"
@@ -89,6 +91,10 @@ class AbstractImporterTest: public TestSuite::Tester {
         void sceneNoFile();
         void sceneOutOfRange();
 
+        void flatScene3D();
+        void flatScene3DNoFile();
+        void flatScene3DOutOfRange();
+
         void animation();
         void animationCountNotImplemented();
         void animationCountNoFile();
@@ -173,6 +179,10 @@ class AbstractImporterTest: public TestSuite::Tester {
         void mesh3DNoFile();
         void mesh3DOutOfRange();
 
+        void mesh();
+        void meshFromMesh3D();
+        void meshNoFile();
+
         void material();
         void materialCountNotImplemented();
         void materialCountNoFile();
@@ -220,6 +230,9 @@ class AbstractImporterTest: public TestSuite::Tester {
         void image2DNotImplemented();
         void image2DNoFile();
         void image2DOutOfRange();
+        void image2DInto();
+        void image2DIntoAllocatorTooSmall();
+        void image2DIntoNoFile();
 
         void image3D();
         void image3DCountNotImplemented();
@@ -283,6 +296,10 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::sceneNoFile,
               &AbstractImporterTest::sceneOutOfRange,
 
+              &AbstractImporterTest::flatScene3D,
+              &AbstractImporterTest::flatScene3DNoFile,
+              &AbstractImporterTest::flatScene3DOutOfRange,
+
               &AbstractImporterTest::animation,
               &AbstractImporterTest::animationCountNotImplemented,
               &AbstractImporterTest::animationCountNoFile,
@@ -367,6 +384,10 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::mesh3DNoFile,
               &AbstractImporterTest::mesh3DOutOfRange,
 
+              &AbstractImporterTest::mesh,
+              &AbstractImporterTest::meshFromMesh3D,
+              &AbstractImporterTest::meshNoFile,
+
               &AbstractImporterTest::material,
               &AbstractImporterTest::materialCountNotImplemented,
               &AbstractImporterTest::materialCountNoFile,
@@ -414,6 +435,9 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::image2DNotImplemented,
               &AbstractImporterTest::image2DNoFile,
               &AbstractImporterTest::image2DOutOfRange,
+              &AbstractImporterTest::image2DInto,
+              &AbstractImporterTest::image2DIntoAllocatorTooSmall,
+              &AbstractImporterTest::image2DIntoNoFile,
 
               &AbstractImporterTest::image3D,
               &AbstractImporterTest::image3DCountNotImplemented,
@@ -1107,6 +1131,81 @@ void AbstractImporterTest::sceneOutOfRange() {
     CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::scene(): index out of range\n");
 }
 
+void AbstractImporterTest::flatScene3D() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 1; }
+        Containers::Optional<SceneData> doScene(UnsignedInt) override {
+            return SceneData{{}, {3, 1}, &state};
+        }
+
+        UnsignedInt doObject3DCount() const override { return 4; }
+        std::unique_ptr<ObjectData3D> doObject3D(UnsignedInt id) override {
+            if(id == 3) return std::unique_ptr<ObjectData3D>{new MeshObjectData3D{{0}, Matrix4::translation(Vector3::xAxis(2.0f)), 5, 7}};
+            if(id == 0) return std::unique_ptr<ObjectData3D>{new ObjectData3D{{2}, Matrix4::scaling(Vector3{3.0f}), ObjectInstanceType3D::Camera, 1}};
+            return std::unique_ptr<ObjectData3D>{new ObjectData3D{{}, Matrix4{}}};
+        }
+    };
+
+    /* The default implementation flattens the hierarchy breadth-first */
+    Importer importer;
+    auto data = importer.flatScene3D(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->objectCount(), 4);
+    CORRADE_COMPARE(data->objects()[0], 3);
+    CORRADE_COMPARE(data->objects()[1], 1);
+    CORRADE_COMPARE(data->objects()[2], 0);
+    CORRADE_COMPARE(data->objects()[3], 2);
+    CORRADE_COMPARE(data->parents()[0], -1);
+    CORRADE_COMPARE(data->parents()[1], -1);
+    CORRADE_COMPARE(data->parents()[2], 0);
+    CORRADE_COMPARE(data->parents()[3], 2);
+    CORRADE_COMPARE(data->transformations()[0], Matrix4::translation(Vector3::xAxis(2.0f)));
+    CORRADE_COMPARE(data->transformations()[2], Matrix4::scaling(Vector3{3.0f}));
+    CORRADE_COMPARE(data->instanceTypes()[0], ObjectInstanceType3D::Mesh);
+    CORRADE_COMPARE(data->instanceTypes()[1], ObjectInstanceType3D::Empty);
+    CORRADE_COMPARE(data->instanceTypes()[2], ObjectInstanceType3D::Camera);
+    CORRADE_COMPARE(data->instances()[0], 5);
+    CORRADE_COMPARE(data->instances()[1], -1);
+    CORRADE_COMPARE(data->instances()[2], 1);
+    CORRADE_COMPARE(data->materials()[0], 7);
+    CORRADE_COMPARE(data->materials()[2], -1);
+    CORRADE_COMPARE(data->importerState(), &state);
+}
+
+void AbstractImporterTest::flatScene3DNoFile() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Importer importer;
+    importer.flatScene3D(42);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::flatScene3D(): no file opened\n");
+}
+
+void AbstractImporterTest::flatScene3DOutOfRange() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Importer importer;
+    importer.flatScene3D(0);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::flatScene3D(): index out of range\n");
+}
+
 void AbstractImporterTest::animation() {
     class Importer: public Trade::AbstractImporter {
         Features doFeatures() const override { return {}; }
@@ -2339,6 +2438,93 @@ void AbstractImporterTest::mesh3DOutOfRange() {
     CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::mesh3D(): index out of range\n");
 }
 
+void AbstractImporterTest::mesh() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 8; }
+        Int doMeshForName(const std::string& name) override {
+            if(name == "eighth") return 7;
+            else return -1;
+        }
+        std::string doMeshName(UnsignedInt id) override {
+            if(id == 7) return "eighth";
+            else return {};
+        }
+        Containers::Optional<MeshData> doMesh(UnsignedInt id) override {
+            if(id == 7) return MeshData{MeshPrimitive::Points, nullptr, nullptr, 0, &state};
+            else return {};
+        }
+    };
+
+    Importer importer;
+    CORRADE_COMPARE(importer.meshCount(), 8);
+    CORRADE_COMPARE(importer.meshForName("eighth"), 7);
+    CORRADE_COMPARE(importer.meshName(7), "eighth");
+
+    auto data = importer.mesh(7);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->importerState(), &state);
+}
+
+void AbstractImporterTest::meshFromMesh3D() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMesh3DCount() const override { return 8; }
+        Int doMesh3DForName(const std::string& name) override {
+            if(name == "eighth") return 7;
+            else return -1;
+        }
+        std::string doMesh3DName(UnsignedInt id) override {
+            if(id == 7) return "eighth";
+            else return {};
+        }
+        Containers::Optional<MeshData3D> doMesh3D(UnsignedInt id) override {
+            if(id == 7) return MeshData3D{MeshPrimitive::Lines, {1, 0}, {std::vector<Vector3>{{}, Vector3::xAxis()}}, {}, {}, {}, &state};
+            else return {};
+        }
+    };
+
+    Importer importer;
+    CORRADE_COMPARE(importer.meshCount(), 8);
+    CORRADE_COMPARE(importer.meshForName("eighth"), 7);
+    CORRADE_COMPARE(importer.meshName(7), "eighth");
+
+    auto data = importer.mesh(7);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(data->indicesAsArray(), (std::vector<UnsignedInt>{1, 0}));
+    CORRADE_COMPARE(data->positions3DAsArray(), (std::vector<Vector3>{{}, Vector3::xAxis()}));
+    CORRADE_COMPARE(data->importerState(), &state);
+}
+
+void AbstractImporterTest::meshNoFile() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Importer importer;
+    importer.meshCount();
+    importer.meshForName("");
+    importer.meshName(42);
+    importer.mesh(42);
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractImporter::meshCount(): no file opened\n"
+        "Trade::AbstractImporter::meshForName(): no file opened\n"
+        "Trade::AbstractImporter::meshName(): no file opened\n"
+        "Trade::AbstractImporter::mesh(): no file opened\n");
+}
+
 void AbstractImporterTest::material() {
     class Importer: public Trade::AbstractImporter {
         Features doFeatures() const override { return {}; }
@@ -3043,6 +3229,75 @@ void AbstractImporterTest::image2DOutOfRange() {
     CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2D(): index out of range\n");
 }
 
+void AbstractImporterTest::image2DInto() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt) override {
+            Containers::Array<char> data{Containers::InPlaceInit, {'a', 'b', 'c', 'd'}};
+            return ImageData2D{PixelFormat::R8Unorm, {2, 2}, std::move(data), &state};
+        }
+    };
+
+    Importer importer;
+    char storage[6]{};
+    auto data = importer.image2DInto(0, [](std::size_t, void* userData) {
+        return Containers::ArrayView<char>{static_cast<char*>(userData), 6};
+    }, storage);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(data->size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE(data->importerState(), &state);
+
+    /* The data are copied to the external memory and referenced from there */
+    CORRADE_COMPARE(static_cast<const void*>(data->data().data()), static_cast<const void*>(storage));
+    CORRADE_COMPARE(data->data().size(), 4);
+    CORRADE_COMPARE(std::string(storage, 4), "abcd");
+}
+
+void AbstractImporterTest::image2DIntoAllocatorTooSmall() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt) override {
+            return ImageData2D{PixelFormat::R8Unorm, {2, 2}, Containers::Array<char>{4}};
+        }
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Importer importer;
+    char storage[3];
+    CORRADE_VERIFY(!importer.image2DInto(0, [](std::size_t, void* userData) {
+        return Containers::ArrayView<char>{static_cast<char*>(userData), 3};
+    }, storage));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DInto(): expected at least 4 bytes from the allocator but got 3\n");
+}
+
+void AbstractImporterTest::image2DIntoNoFile() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Importer importer;
+    importer.image2DInto(0, [](std::size_t, void*) {
+        return Containers::ArrayView<char>{};
+    });
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DInto(): no file opened\n");
+}
+
 void AbstractImporterTest::image3D() {
     class Importer: public Trade::AbstractImporter {
         Features doFeatures() const override { return {}; }
@@ -3268,8 +3523,8 @@ void AbstractImporterTest::debugFeature() {
 void AbstractImporterTest::debugFeatures() {
     std::ostringstream out;
 
-    Debug{&out} << (AbstractImporter::Feature::OpenData|AbstractImporter::Feature::OpenState) << AbstractImporter::Features{};
-    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::Feature::OpenData|Trade::AbstractImporter::Feature::OpenState Trade::AbstractImporter::Features{}\n");
+    Debug{&out} << (AbstractImporter::Feature::OpenData|AbstractImporter::Feature::OpenState) << AbstractImporter::Features{} << AbstractImporter::Feature::ThreadSafeDataAccess;
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::Feature::OpenData|Trade::AbstractImporter::Feature::OpenState Trade::AbstractImporter::Features{} Trade::AbstractImporter::Feature::ThreadSafeDataAccess\n");
 }
 
 void AbstractImporterTest::debugFileCallbackPolicy() {
@@ -0,0 +1,193 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AsyncImport.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class AsyncImportTest: public TestSuite::Tester {
+    public:
+        explicit AsyncImportTest();
+
+        void mesh3D();
+        void mesh3DNoFile();
+        void mesh3DOutOfRange();
+
+        void image2D();
+        void image2DSerialized();
+        void image2DManyImporters();
+};
+
+AsyncImportTest::AsyncImportTest() {
+    addTests({&AsyncImportTest::mesh3D,
+              &AsyncImportTest::mesh3DNoFile,
+              &AsyncImportTest::mesh3DOutOfRange,
+
+              &AsyncImportTest::image2D,
+              &AsyncImportTest::image2DSerialized,
+              &AsyncImportTest::image2DManyImporters});
+}
+
+namespace {
+    int state;
+
+    class SerializedImporter: public Trade::AbstractImporter {
+        public:
+            std::atomic<Int> active{0}, maxActive{0};
+
+        private:
+            Features doFeatures() const override { return {}; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            UnsignedInt doImage2DCount() const override { return 8; }
+            Containers::Optional<ImageData2D> doImage2D(UnsignedInt) override {
+                const Int current = ++active;
+                Int expected = maxActive;
+                while(current > expected && !maxActive.compare_exchange_weak(expected, current));
+                std::this_thread::sleep_for(std::chrono::milliseconds{2});
+                --active;
+                return ImageData2D{PixelStorage{}, {}, {}, {}, &state};
+            }
+    };
+}
+
+void AsyncImportTest::mesh3D() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return Feature::ThreadSafeDataAccess; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMesh3DCount() const override { return 8; }
+        Containers::Optional<MeshData3D> doMesh3D(UnsignedInt id) override {
+            if(id == 7) return MeshData3D{{}, {}, {{}}, {}, {}, {}, &state};
+            else return {};
+        }
+    };
+
+    Importer importer;
+    auto a = Trade::mesh3DAsync(importer, 7);
+    auto b = Trade::mesh3DAsync(importer, 3);
+    CORRADE_VERIFY(a.valid());
+    CORRADE_VERIFY(b.valid());
+
+    auto dataA = a.get();
+    CORRADE_VERIFY(dataA);
+    CORRADE_COMPARE(dataA->importerState(), &state);
+    CORRADE_VERIFY(!b.get());
+}
+
+void AsyncImportTest::mesh3DNoFile() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Importer importer;
+    CORRADE_VERIFY(!Trade::mesh3DAsync(importer, 7).valid());
+    CORRADE_COMPARE(out.str(), "Trade::mesh3DAsync(): no file opened\n");
+}
+
+void AsyncImportTest::mesh3DOutOfRange() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Importer importer;
+    CORRADE_VERIFY(!Trade::mesh3DAsync(importer, 0).valid());
+    CORRADE_COMPARE(out.str(), "Trade::mesh3DAsync(): index out of range\n");
+}
+
+void AsyncImportTest::image2D() {
+    class Importer: public Trade::AbstractImporter {
+        Features doFeatures() const override { return Feature::ThreadSafeDataAccess; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt id) override {
+            if(id == 7) return ImageData2D{PixelStorage{}, {}, {}, {}, &state};
+            else return {};
+        }
+    };
+
+    Importer importer;
+    auto data = Trade::image2DAsync(importer, 7).get();
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->importerState(), &state);
+}
+
+void AsyncImportTest::image2DSerialized() {
+    SerializedImporter importer;
+    std::vector<std::future<Containers::Optional<ImageData2D>>> futures;
+    for(UnsignedInt i = 0; i != 8; ++i)
+        futures.push_back(Trade::image2DAsync(importer, i));
+    for(auto& future: futures) CORRADE_VERIFY(future.get());
+
+    /* The importer doesn't advertise thread safety, so the jobs should never
+       overlap */
+    CORRADE_COMPARE(importer.maxActive.load(), 1);
+}
+
+void AsyncImportTest::image2DManyImporters() {
+    /* Way more jobs than there are worker threads. The jobs of each importer
+       should still be serialized and all of them should finish, also when
+       jobs for the same importer get submitted again after its queue got
+       drained. */
+    SerializedImporter importers[16];
+    for(Int round = 0; round != 2; ++round) {
+        std::vector<std::future<Containers::Optional<ImageData2D>>> futures;
+        for(SerializedImporter& importer: importers)
+            for(UnsignedInt i = 0; i != 8; ++i)
+                futures.push_back(Trade::image2DAsync(importer, i));
+        for(auto& future: futures) CORRADE_VERIFY(future.get());
+    }
+
+    for(SerializedImporter& importer: importers)
+        CORRADE_COMPARE(importer.maxActive.load(), 1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AsyncImportTest)
@@ -0,0 +1,201 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Trade/FlatSceneData3D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class FlatSceneData3DTest: public TestSuite::Tester {
+    public:
+        explicit FlatSceneData3DTest();
+
+        void construct();
+        void constructEmpty();
+        void constructCopy();
+        void constructMove();
+        void constructInvalidSize();
+        void constructInvalidParent();
+
+        void childrenInvalid();
+};
+
+FlatSceneData3DTest::FlatSceneData3DTest() {
+    addTests({&FlatSceneData3DTest::construct,
+              &FlatSceneData3DTest::constructEmpty,
+              &FlatSceneData3DTest::constructCopy,
+              &FlatSceneData3DTest::constructMove,
+              &FlatSceneData3DTest::constructInvalidSize,
+              &FlatSceneData3DTest::constructInvalidParent,
+
+              &FlatSceneData3DTest::childrenInvalid});
+}
+
+namespace {
+
+/* Object 3 is root, 1 and 0 its children, 2 is a child of 1 and 4 is
+   another root. The parent is after its children on purpose. */
+FlatSceneData3D data(const void* importerState = nullptr) {
+    Containers::Array<UnsignedInt> objects{Containers::NoInit, 5};
+    Containers::Array<Int> parents{Containers::NoInit, 5};
+    Containers::Array<Matrix4> transformations{5};
+    Containers::Array<ObjectInstanceType3D> instanceTypes{Containers::NoInit, 5};
+    Containers::Array<Int> instances{Containers::NoInit, 5};
+    Containers::Array<Int> materials{Containers::NoInit, 5};
+    const UnsignedInt objectData[]{7, 3, 12, 0, 1};
+    const Int parentData[]{3, 3, 1, -1, -1};
+    const ObjectInstanceType3D instanceTypeData[]{
+        ObjectInstanceType3D::Mesh,
+        ObjectInstanceType3D::Empty,
+        ObjectInstanceType3D::Camera,
+        ObjectInstanceType3D::Mesh,
+        ObjectInstanceType3D::Light};
+    const Int instanceData[]{2, -1, 0, 5, 1};
+    const Int materialData[]{4, -1, -1, -1, -1};
+    for(std::size_t i = 0; i != 5; ++i) {
+        objects[i] = objectData[i];
+        parents[i] = parentData[i];
+        instanceTypes[i] = instanceTypeData[i];
+        instances[i] = instanceData[i];
+        materials[i] = materialData[i];
+    }
+    transformations[1] = Matrix4::translation(Vector3::xAxis(3.0f));
+
+    return FlatSceneData3D{std::move(objects), std::move(parents), std::move(transformations), std::move(instanceTypes), std::move(instances), std::move(materials), importerState};
+}
+
+}
+
+void FlatSceneData3DTest::construct() {
+    const int a{};
+    const FlatSceneData3D scene = data(&a);
+
+    CORRADE_COMPARE(scene.objectCount(), 5);
+    CORRADE_COMPARE(scene.objects().size(), 5);
+    CORRADE_COMPARE(scene.objects()[2], 12);
+    CORRADE_COMPARE(scene.parents().size(), 5);
+    CORRADE_COMPARE(scene.parents()[1], 3);
+    CORRADE_COMPARE(scene.parents()[3], -1);
+    CORRADE_COMPARE(scene.transformations().size(), 5);
+    CORRADE_COMPARE(scene.transformations()[1], Matrix4::translation(Vector3::xAxis(3.0f)));
+    CORRADE_COMPARE(scene.instanceTypes().size(), 5);
+    CORRADE_COMPARE(scene.instanceTypes()[2], ObjectInstanceType3D::Camera);
+    CORRADE_COMPARE(scene.instances().size(), 5);
+    CORRADE_COMPARE(scene.instances()[1], -1);
+    CORRADE_COMPARE(scene.instances()[3], 5);
+    CORRADE_COMPARE(scene.materials().size(), 5);
+    CORRADE_COMPARE(scene.materials()[0], 4);
+    CORRADE_COMPARE(scene.importerState(), &a);
+
+    /* Children are in the order they are in the scene */
+    CORRADE_COMPARE(scene.roots().size(), 2);
+    CORRADE_COMPARE(scene.roots()[0], 3);
+    CORRADE_COMPARE(scene.roots()[1], 4);
+    CORRADE_COMPARE(scene.children(3).size(), 2);
+    CORRADE_COMPARE(scene.children(3)[0], 0);
+    CORRADE_COMPARE(scene.children(3)[1], 1);
+    CORRADE_COMPARE(scene.children(1).size(), 1);
+    CORRADE_COMPARE(scene.children(1)[0], 2);
+    CORRADE_VERIFY(scene.children(0).empty());
+    CORRADE_VERIFY(scene.children(2).empty());
+    CORRADE_VERIFY(scene.children(4).empty());
+}
+
+void FlatSceneData3DTest::constructEmpty() {
+    const FlatSceneData3D scene{nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+
+    CORRADE_COMPARE(scene.objectCount(), 0);
+    CORRADE_VERIFY(scene.parents().empty());
+    CORRADE_VERIFY(scene.roots().empty());
+    CORRADE_COMPARE(scene.importerState(), nullptr);
+}
+
+void FlatSceneData3DTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<FlatSceneData3D, const FlatSceneData3D&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<FlatSceneData3D, const FlatSceneData3D&>{}));
+}
+
+void FlatSceneData3DTest::constructMove() {
+    const int a{};
+    FlatSceneData3D scene = data(&a);
+
+    FlatSceneData3D b{std::move(scene)};
+    CORRADE_COMPARE(b.objectCount(), 5);
+    CORRADE_COMPARE(b.objects()[2], 12);
+    CORRADE_COMPARE(b.roots().size(), 2);
+    CORRADE_COMPARE(b.children(3).size(), 2);
+    CORRADE_COMPARE(b.importerState(), &a);
+
+    const int c{};
+    FlatSceneData3D d{nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, &c};
+    d = std::move(b);
+    CORRADE_COMPARE(d.objectCount(), 5);
+    CORRADE_COMPARE(d.objects()[2], 12);
+    CORRADE_COMPARE(d.roots().size(), 2);
+    CORRADE_COMPARE(d.children(1).size(), 1);
+    CORRADE_COMPARE(d.importerState(), &a);
+}
+
+void FlatSceneData3DTest::constructInvalidSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    FlatSceneData3D{Containers::Array<UnsignedInt>{3}, Containers::Array<Int>{Containers::ValueInit, 3}, Containers::Array<Matrix4>{2}, Containers::Array<ObjectInstanceType3D>{3}, Containers::Array<Int>{3}, Containers::Array<Int>{3}};
+    CORRADE_COMPARE(out.str(), "Trade::FlatSceneData3D: expected 3 items in all arrays but got 3, 2, 3, 3 and 3\n");
+}
+
+void FlatSceneData3DTest::constructInvalidParent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Containers::Array<Int> parents{Containers::NoInit, 3};
+    parents[0] = -1;
+    parents[1] = 1;
+    parents[2] = 0;
+    FlatSceneData3D{Containers::Array<UnsignedInt>{3}, std::move(parents), Containers::Array<Matrix4>{3}, Containers::Array<ObjectInstanceType3D>{3}, Containers::Array<Int>{3}, Containers::Array<Int>{3}};
+
+    Containers::Array<Int> parents2{Containers::NoInit, 2};
+    parents2[0] = -1;
+    parents2[1] = 2;
+    FlatSceneData3D{Containers::Array<UnsignedInt>{2}, std::move(parents2), Containers::Array<Matrix4>{2}, Containers::Array<ObjectInstanceType3D>{2}, Containers::Array<Int>{2}, Containers::Array<Int>{2}};
+    CORRADE_COMPARE(out.str(),
+        "Trade::FlatSceneData3D: invalid parent 1 for object 1\n"
+        "Trade::FlatSceneData3D: invalid parent 2 for object 1\n");
+}
+
+void FlatSceneData3DTest::childrenInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const FlatSceneData3D scene = data();
+    scene.children(5);
+    CORRADE_COMPARE(out.str(), "Trade::FlatSceneData3D::children(): index 5 out of range for 5 objects\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::FlatSceneData3DTest)
@@ -0,0 +1,146 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Trade/MapFile.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct MapFileTest: TestSuite::Tester {
+    explicit MapFileTest();
+
+    void map();
+    void mapOffset();
+    void mapOffsetEnd();
+    void mapOffsetOutOfRange();
+    void mapSize();
+    void mapSizeOutOfRange();
+    void mapModify();
+    void mapNotFound();
+
+    private:
+        std::string _filename;
+        Containers::Array<char> _data;
+};
+
+MapFileTest::MapFileTest() {
+    addTests({&MapFileTest::map,
+              &MapFileTest::mapOffset,
+              &MapFileTest::mapOffsetEnd,
+              &MapFileTest::mapOffsetOutOfRange,
+              &MapFileTest::mapSize,
+              &MapFileTest::mapSizeOutOfRange,
+              &MapFileTest::mapModify,
+              &MapFileTest::mapNotFound});
+
+    /* Make the file larger than a page so offsets crossing a page boundary
+       get tested as well */
+    _data = Containers::Array<char>{10000};
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        _data[i] = char(i*37 % 251);
+
+    Utility::Directory::mkpath(TRADE_TEST_OUTPUT_DIR);
+    _filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mapfile.bin");
+    CORRADE_INTERNAL_ASSERT(Utility::Directory::write(_filename, _data));
+}
+
+void MapFileTest::map() {
+    Containers::Optional<Containers::Array<char>> data = mapFile(_filename);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{*data},
+        Containers::ArrayView<const char>{_data},
+        TestSuite::Compare::Container);
+}
+
+void MapFileTest::mapOffset() {
+    for(std::size_t offset: {std::size_t{1}, std::size_t{18}, std::size_t{4096}, std::size_t{5000}}) {
+        Containers::Optional<Containers::Array<char>> data = mapFile(_filename, offset);
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE_AS(Containers::ArrayView<const char>{*data},
+            Containers::ArrayView<const char>{_data}.suffix(offset),
+            TestSuite::Compare::Container);
+    }
+}
+
+void MapFileTest::mapOffsetEnd() {
+    Containers::Optional<Containers::Array<char>> data = mapFile(_filename, _data.size());
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(data->empty());
+}
+
+void MapFileTest::mapOffsetOutOfRange() {
+    CORRADE_VERIFY(!mapFile(_filename, _data.size() + 1));
+}
+
+void MapFileTest::mapSize() {
+    for(std::size_t offset: {std::size_t{0}, std::size_t{18}, std::size_t{4096}, std::size_t{5000}}) {
+        Containers::Optional<Containers::Array<char>> data = mapFile(_filename, offset, 4000);
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE_AS(Containers::ArrayView<const char>{*data},
+            Containers::ArrayView<const char>{_data}.slice(offset, offset + 4000),
+            TestSuite::Compare::Container);
+    }
+
+    /* Until the end and an empty range */
+    Containers::Optional<Containers::Array<char>> data = mapFile(_filename, 5000, 5000);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->size(), 5000);
+    data = mapFile(_filename, 18, 0);
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(data->empty());
+}
+
+void MapFileTest::mapSizeOutOfRange() {
+    CORRADE_VERIFY(!mapFile(_filename, 5000, 5001));
+    CORRADE_VERIFY(!mapFile(_filename, 0, _data.size() + 1));
+}
+
+void MapFileTest::mapModify() {
+    {
+        Containers::Optional<Containers::Array<char>> data = mapFile(_filename, 18);
+        CORRADE_VERIFY(data);
+        (*data)[0] = ~_data[18];
+        CORRADE_COMPARE((*data)[0], char(~_data[18]));
+    }
+
+    /* The modification should not be written back to the file */
+    Containers::Optional<Containers::Array<char>> data = mapFile(_filename);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE((*data)[18], _data[18]);
+}
+
+void MapFileTest::mapNotFound() {
+    CORRADE_VERIFY(!mapFile("nonexistent.bin"));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MapFileTest)
@@ -0,0 +1,312 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshBlob.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct MeshBlobTest: TestSuite::Tester {
+    explicit MeshBlobTest();
+
+    void attributeTypeSize();
+    void attributeSize();
+
+    void construct();
+    void constructIndexed();
+    void constructWrongVertexDataSize();
+    void constructWrongIndexDataSize();
+    void constructAttributeOutOfStride();
+    void indexTypeNotIndexed();
+
+    void serialize();
+    void serializeIndexed();
+
+    void deserializeTooShort();
+    void deserializeInvalidSignature();
+    void deserializeUnsupportedVersion();
+    void deserializeOutOfBounds();
+    void deserializeWrongVertexDataSize();
+    void deserializeInvalidAttribute();
+
+    void debugAttributeType();
+};
+
+MeshBlobTest::MeshBlobTest() {
+    addTests({&MeshBlobTest::attributeTypeSize,
+              &MeshBlobTest::attributeSize,
+
+              &MeshBlobTest::construct,
+              &MeshBlobTest::constructIndexed,
+              &MeshBlobTest::constructWrongVertexDataSize,
+              &MeshBlobTest::constructWrongIndexDataSize,
+              &MeshBlobTest::constructAttributeOutOfStride,
+              &MeshBlobTest::indexTypeNotIndexed,
+
+              &MeshBlobTest::serialize,
+              &MeshBlobTest::serializeIndexed,
+
+              &MeshBlobTest::deserializeTooShort,
+              &MeshBlobTest::deserializeInvalidSignature,
+              &MeshBlobTest::deserializeUnsupportedVersion,
+              &MeshBlobTest::deserializeOutOfBounds,
+              &MeshBlobTest::deserializeWrongVertexDataSize,
+              &MeshBlobTest::deserializeInvalidAttribute,
+
+              &MeshBlobTest::debugAttributeType});
+}
+
+namespace {
+
+struct Vertex {
+    Vector3 position;
+    Math::Vector3<Short> normal;
+    UnsignedShort padding;
+};
+
+const Vertex Vertices[]{
+    {{1.0f, 2.0f, 3.0f}, {0, 32767, 0}, 0},
+    {{4.0f, 5.0f, 6.0f}, {32767, 0, 0}, 0},
+    {{7.0f, 8.0f, 9.0f}, {0, 0, -32767}, 0}
+};
+
+const UnsignedShort Indices[]{2, 1, 0, 0, 1, 2};
+
+const MeshBlobAttribute Attributes[]{
+    MeshBlobAttribute{0, 0, MeshBlobAttributeType::Float, 3},
+    MeshBlobAttribute{5, 12, MeshBlobAttributeType::Short, 3, true}
+};
+
+Containers::ArrayView<const char> vertexData() {
+    return {reinterpret_cast<const char*>(Vertices), sizeof(Vertices)};
+}
+
+Containers::ArrayView<const char> indexData() {
+    return {reinterpret_cast<const char*>(Indices), sizeof(Indices)};
+}
+
+}
+
+void MeshBlobTest::attributeTypeSize() {
+    CORRADE_COMPARE(meshBlobAttributeTypeSize(MeshBlobAttributeType::Byte), 1);
+    CORRADE_COMPARE(meshBlobAttributeTypeSize(MeshBlobAttributeType::HalfFloat), 2);
+    CORRADE_COMPARE(meshBlobAttributeTypeSize(MeshBlobAttributeType::Float), 4);
+    CORRADE_COMPARE(meshBlobAttributeTypeSize(MeshBlobAttributeType::Int2101010Rev), 4);
+}
+
+void MeshBlobTest::attributeSize() {
+    CORRADE_COMPARE((MeshBlobAttribute{0, 0, MeshBlobAttributeType::Float, 3}.size()), 12);
+    CORRADE_COMPARE((MeshBlobAttribute{0, 0, MeshBlobAttributeType::UnsignedShort, 2, true}.size()), 4);
+    CORRADE_COMPARE((MeshBlobAttribute{0, 0, MeshBlobAttributeType::Int2101010Rev, 4, true}.size()), 4);
+}
+
+void MeshBlobTest::construct() {
+    MeshBlob blob{MeshPrimitive::Triangles, 3, sizeof(Vertex), Attributes, vertexData()};
+
+    CORRADE_COMPARE(blob.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(blob.vertexCount(), 3);
+    CORRADE_COMPARE(blob.stride(), 20);
+    CORRADE_COMPARE(blob.attributes().size(), 2);
+    CORRADE_COMPARE(blob.attributes()[1].offset, 12);
+    CORRADE_COMPARE(static_cast<const void*>(blob.vertexData().data()), static_cast<const void*>(Vertices));
+    CORRADE_VERIFY(!blob.isIndexed());
+    CORRADE_COMPARE(blob.indexCount(), 0);
+    CORRADE_VERIFY(blob.indexData().empty());
+}
+
+void MeshBlobTest::constructIndexed() {
+    MeshBlob blob{MeshPrimitive::Triangles, 3, sizeof(Vertex), Attributes, vertexData(), MeshIndexType::UnsignedShort, 6, 0, 2, indexData()};
+
+    CORRADE_COMPARE(blob.vertexCount(), 3);
+    CORRADE_VERIFY(blob.isIndexed());
+    CORRADE_COMPARE(blob.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(blob.indexCount(), 6);
+    CORRADE_COMPARE(blob.indexStart(), 0);
+    CORRADE_COMPARE(blob.indexEnd(), 2);
+    CORRADE_COMPARE(static_cast<const void*>(blob.indexData().data()), static_cast<const void*>(Indices));
+}
+
+void MeshBlobTest::constructWrongVertexDataSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshBlob{MeshPrimitive::Triangles, 4, sizeof(Vertex), Attributes, vertexData()};
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlob: expected 80 bytes of vertex data but got 60\n");
+}
+
+void MeshBlobTest::constructWrongIndexDataSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshBlob{MeshPrimitive::Triangles, 3, sizeof(Vertex), Attributes, vertexData(), MeshIndexType::UnsignedInt, 6, 0, 2, indexData()};
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlob: expected 24 bytes of index data but got 12\n");
+}
+
+void MeshBlobTest::constructAttributeOutOfStride() {
+    const MeshBlobAttribute attributes[]{
+        MeshBlobAttribute{0, 0, MeshBlobAttributeType::Float, 3},
+        MeshBlobAttribute{5, 12, MeshBlobAttributeType::Float, 3}
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshBlob{MeshPrimitive::Triangles, 3, sizeof(Vertex), attributes, vertexData()};
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlob: attribute 1 doesn't fit into stride of 20 bytes\n");
+}
+
+void MeshBlobTest::indexTypeNotIndexed() {
+    MeshBlob blob{MeshPrimitive::Triangles, 3, sizeof(Vertex), Attributes, vertexData()};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    blob.indexType();
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlob::indexType(): the mesh is not indexed\n");
+}
+
+void MeshBlobTest::serialize() {
+    const Containers::Array<char> data = MeshBlob{MeshPrimitive::Points, 3, sizeof(Vertex), Attributes, vertexData()}.serialize();
+    /* 72-byte header and two 12-byte attributes, aligned to 64 bytes */
+    CORRADE_COMPARE(data.size(), 128 + sizeof(Vertices));
+
+    Containers::Optional<MeshBlob> blob = MeshBlob::deserialize(data);
+    CORRADE_VERIFY(blob);
+    CORRADE_COMPARE(blob->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(blob->vertexCount(), 3);
+    CORRADE_COMPARE(blob->stride(), 20);
+    CORRADE_VERIFY(!blob->isIndexed());
+
+    CORRADE_COMPARE(blob->attributes().size(), 2);
+    CORRADE_COMPARE(blob->attributes()[0].location, 0);
+    CORRADE_COMPARE(blob->attributes()[0].offset, 0);
+    CORRADE_COMPARE(blob->attributes()[0].type, MeshBlobAttributeType::Float);
+    CORRADE_COMPARE(blob->attributes()[0].components, 3);
+    CORRADE_VERIFY(!blob->attributes()[0].normalized);
+    CORRADE_COMPARE(blob->attributes()[1].location, 5);
+    CORRADE_COMPARE(blob->attributes()[1].offset, 12);
+    CORRADE_COMPARE(blob->attributes()[1].type, MeshBlobAttributeType::Short);
+    CORRADE_COMPARE(blob->attributes()[1].components, 3);
+    CORRADE_VERIFY(blob->attributes()[1].normalized);
+
+    /* The data should point directly into the blob, aligned */
+    CORRADE_COMPARE(static_cast<const void*>(blob->vertexData().data()), static_cast<const void*>(data.data() + 128));
+    CORRADE_COMPARE(blob->vertexData().size(), sizeof(Vertices));
+    CORRADE_VERIFY(std::memcmp(blob->vertexData().data(), Vertices, sizeof(Vertices)) == 0);
+}
+
+void MeshBlobTest::serializeIndexed() {
+    const Containers::Array<char> data = MeshBlob{MeshPrimitive::Triangles, 3, sizeof(Vertex), Attributes, vertexData(), MeshIndexType::UnsignedShort, 6, 0, 2, indexData()}.serialize();
+    /* Index data after the vertex data, aligned to 64 bytes */
+    CORRADE_COMPARE(data.size(), 192 + sizeof(Indices));
+
+    Containers::Optional<MeshBlob> blob = MeshBlob::deserialize(data);
+    CORRADE_VERIFY(blob);
+    CORRADE_COMPARE(blob->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(blob->vertexCount(), 3);
+    CORRADE_COMPARE(blob->attributes().size(), 2);
+    CORRADE_VERIFY(std::memcmp(blob->vertexData().data(), Vertices, sizeof(Vertices)) == 0);
+
+    CORRADE_VERIFY(blob->isIndexed());
+    CORRADE_COMPARE(blob->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(blob->indexCount(), 6);
+    CORRADE_COMPARE(blob->indexStart(), 0);
+    CORRADE_COMPARE(blob->indexEnd(), 2);
+    CORRADE_COMPARE(static_cast<const void*>(blob->indexData().data()), static_cast<const void*>(data.data() + 192));
+    CORRADE_VERIFY(std::memcmp(blob->indexData().data(), Indices, sizeof(Indices)) == 0);
+}
+
+void MeshBlobTest::deserializeTooShort() {
+    const Containers::Array<char> data = MeshBlob{MeshPrimitive::Points, 3, sizeof(Vertex), Attributes, vertexData()}.serialize();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshBlob::deserialize({data.data(), 71}));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlob::deserialize(): expected at least 72 bytes but got 71\n");
+}
+
+void MeshBlobTest::deserializeInvalidSignature() {
+    Containers::Array<char> data = MeshBlob{MeshPrimitive::Points, 3, sizeof(Vertex), Attributes, vertexData()}.serialize();
+    data[2] = 'X';
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshBlob::deserialize(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlob::deserialize(): invalid signature\n");
+}
+
+void MeshBlobTest::deserializeUnsupportedVersion() {
+    Containers::Array<char> data = MeshBlob{MeshPrimitive::Points, 3, sizeof(Vertex), Attributes, vertexData()}.serialize();
+    const UnsignedShort version = 57;
+    std::memcpy(data.data() + 6, &version, 2);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshBlob::deserialize(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlob::deserialize(): unsupported version 57\n");
+}
+
+void MeshBlobTest::deserializeOutOfBounds() {
+    const Containers::Array<char> data = MeshBlob{MeshPrimitive::Triangles, 3, sizeof(Vertex), Attributes, vertexData(), MeshIndexType::UnsignedShort, 6, 0, 2, indexData()}.serialize();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshBlob::deserialize({data.data(), data.size() - 1}));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlob::deserialize(): data out of bounds for a blob of 203 bytes\n");
+}
+
+void MeshBlobTest::deserializeWrongVertexDataSize() {
+    Containers::Array<char> data = MeshBlob{MeshPrimitive::Points, 3, sizeof(Vertex), Attributes, vertexData()}.serialize();
+    /* Vertex count is at offset 16 */
+    const UnsignedInt vertexCount = 2;
+    std::memcpy(data.data() + 16, &vertexCount, 4);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshBlob::deserialize(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlob::deserialize(): expected 40 bytes of vertex data but got 60\n");
+}
+
+void MeshBlobTest::deserializeInvalidAttribute() {
+    Containers::Array<char> data = MeshBlob{MeshPrimitive::Points, 3, sizeof(Vertex), Attributes, vertexData()}.serialize();
+    /* Component count of the second attribute, after the 72-byte header and
+       the first 12-byte attribute */
+    data[72 + 12 + 9] = 5;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshBlob::deserialize(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlob::deserialize(): invalid attribute 1\n");
+}
+
+void MeshBlobTest::debugAttributeType() {
+    std::ostringstream out;
+    Debug{&out} << MeshBlobAttributeType::HalfFloat << MeshBlobAttributeType(0xde);
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobAttributeType::HalfFloat Trade::MeshBlobAttributeType(0xde)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshBlobTest)
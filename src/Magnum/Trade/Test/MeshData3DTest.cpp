@@ -23,10 +23,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Vector4.h"
 #include "Magnum/Trade/MeshData3D.h"
 
 namespace Magnum { namespace Trade { namespace Test {
@@ -39,6 +41,8 @@ struct MeshData3DTest: TestSuite::Tester {
     void constructNoNormals();
     void constructNoTexCoords();
     void constructNoColors();
+    void constructSkinned();
+    void constructSkinnedMismatchedCount();
     void constructCopy();
     void constructMove();
 };
@@ -49,6 +53,8 @@ MeshData3DTest::MeshData3DTest() {
               &MeshData3DTest::constructNoNormals,
               &MeshData3DTest::constructNoTexCoords,
               &MeshData3DTest::constructNoColors,
+              &MeshData3DTest::constructSkinned,
+              &MeshData3DTest::constructSkinnedMismatchedCount,
               &MeshData3DTest::constructCopy,
               &MeshData3DTest::constructMove});
 }
@@ -142,6 +148,41 @@ void MeshData3DTest::constructNoColors() {
 
     CORRADE_VERIFY(!data.hasColors());
     CORRADE_COMPARE(data.colorArrayCount(), 0);
+    CORRADE_VERIFY(!data.hasJoints());
+    CORRADE_COMPARE(data.jointArrayCount(), 0);
+}
+
+void MeshData3DTest::constructSkinned() {
+    const int a{};
+    const MeshData3D data{MeshPrimitive::Lines, {12, 1, 0},
+        {{{0.5f, 1.0f, 0.1f}, {-1.0f, 0.3f, -1.0f}}},
+        {{{0.0f, 1.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}}},
+        {},
+        {},
+        {{{0, 1, 0, 0}, {2, 3, 1, 0}}},
+        {{{0.75f, 0.25f, 0.0f, 0.0f}, {0.5f, 0.25f, 0.25f, 0.0f}}},
+        &a};
+
+    CORRADE_VERIFY(data.hasJoints());
+    CORRADE_COMPARE(data.jointArrayCount(), 1);
+    CORRADE_COMPARE(data.jointIds(0), (std::vector<Vector4ui>{{0, 1, 0, 0}, {2, 3, 1, 0}}));
+    CORRADE_COMPARE(data.weights(0), (std::vector<Vector4>{{0.75f, 0.25f, 0.0f, 0.0f}, {0.5f, 0.25f, 0.25f, 0.0f}}));
+    CORRADE_COMPARE(data.importerState(), &a);
+}
+
+void MeshData3DTest::constructSkinnedMismatchedCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshData3D data{MeshPrimitive::Lines, {},
+        {{{0.5f, 1.0f, 0.1f}}},
+        {},
+        {},
+        {},
+        {{{0, 1, 0, 0}}},
+        {}};
+
+    CORRADE_COMPARE(out.str(), "Trade::MeshData3D: expected the same count of joint ID and weight arrays but got 1 and 0\n");
 }
 
 void MeshData3DTest::constructCopy() {
@@ -0,0 +1,396 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+using namespace Math::Literals;
+
+struct MeshDataTest: TestSuite::Tester {
+    explicit MeshDataTest();
+
+    void construct();
+    void constructIndexed();
+    void constructMeshData3D();
+    void constructMeshData3DLargeIndices();
+    void constructMove();
+    void constructWrongIndexDataSize();
+    void constructAttributeOutOfBounds();
+    void constructInvalidComponentCount();
+
+    void attributeWrongType();
+    void attributeIdOutOfRange();
+    void notIndexed();
+    void indicesWrongType();
+
+    void convertPacked();
+    void convertHalf();
+
+    void release();
+
+    void debugAttribute();
+};
+
+MeshDataTest::MeshDataTest() {
+    addTests({&MeshDataTest::construct,
+              &MeshDataTest::constructIndexed,
+              &MeshDataTest::constructMeshData3D,
+              &MeshDataTest::constructMeshData3DLargeIndices,
+              &MeshDataTest::constructMove,
+              &MeshDataTest::constructWrongIndexDataSize,
+              &MeshDataTest::constructAttributeOutOfBounds,
+              &MeshDataTest::constructInvalidComponentCount,
+
+              &MeshDataTest::attributeWrongType,
+              &MeshDataTest::attributeIdOutOfRange,
+              &MeshDataTest::notIndexed,
+              &MeshDataTest::indicesWrongType,
+
+              &MeshDataTest::convertPacked,
+              &MeshDataTest::convertHalf,
+
+              &MeshDataTest::release,
+
+              &MeshDataTest::debugAttribute});
+}
+
+namespace {
+
+/* Positions in one block, followed by a second block with interleaved
+   normals and texture coordinates */
+Containers::Array<char> vertexData() {
+    const Vector3 positions[]{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+    const struct {
+        Vector3 normal;
+        Vector2 textureCoordinates;
+    } interleaved[]{
+        {Vector3::zAxis(), {0.25f, 0.5f}},
+        {Vector3::xAxis(), {0.75f, 1.0f}}
+    };
+
+    Containers::Array<char> data{Containers::NoInit, sizeof(positions) + sizeof(interleaved)};
+    std::memcpy(data.data(), positions, sizeof(positions));
+    std::memcpy(data.data() + sizeof(positions), interleaved, sizeof(interleaved));
+    return data;
+}
+
+Containers::Array<MeshAttributeData> attributes() {
+    Containers::Array<MeshAttributeData> attributes{3};
+    attributes[0] = MeshAttributeData{MeshAttribute::Position, MeshBlobAttributeType::Float, 3, 0, 12};
+    attributes[1] = MeshAttributeData{MeshAttribute::Normal, MeshBlobAttributeType::Float, 3, 24, 20};
+    attributes[2] = MeshAttributeData{MeshAttribute::TextureCoordinates, MeshBlobAttributeType::Float, 2, 36, 20};
+    return attributes;
+}
+
+int state;
+
+}
+
+void MeshDataTest::construct() {
+    const MeshData data{MeshPrimitive::Triangles, vertexData(), attributes(), 2, &state};
+
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_COMPARE(data.indexCount(), 0);
+    CORRADE_COMPARE(data.vertexCount(), 2);
+    CORRADE_COMPARE(data.vertexData().size(), 64);
+    CORRADE_COMPARE(data.importerState(), &state);
+
+    CORRADE_COMPARE(data.attributeCount(), 3);
+    CORRADE_COMPARE(data.attributeCount(MeshAttribute::Normal), 1);
+    CORRADE_COMPARE(data.attributeCount(MeshAttribute::Color), 0);
+    CORRADE_COMPARE(data.attributeId(MeshAttribute::TextureCoordinates), 2);
+    CORRADE_COMPARE(data.attributes()[1].stride, 20);
+
+    Containers::StridedArrayView<const Vector3> positions = data.attribute<Vector3>(0);
+    CORRADE_COMPARE(positions.size(), 2);
+    CORRADE_COMPARE(positions[1], (Vector3{4.0f, 5.0f, 6.0f}));
+
+    Containers::StridedArrayView<const Vector2> textureCoordinates = data.attribute<Vector2>(MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(textureCoordinates.size(), 2);
+    CORRADE_COMPARE(textureCoordinates[0], (Vector2{0.25f, 0.5f}));
+    CORRADE_COMPARE(textureCoordinates[1], (Vector2{0.75f, 1.0f}));
+
+    CORRADE_COMPARE(data.normalsAsArray(), (std::vector<Vector3>{Vector3::zAxis(), Vector3::xAxis()}));
+}
+
+void MeshDataTest::constructIndexed() {
+    Containers::Array<char> indexData{Containers::InPlaceInit, {1, 0, 1}};
+    const MeshData data{MeshPrimitive::Lines, MeshIndexType::UnsignedByte, std::move(indexData), vertexData(), attributes(), 2};
+
+    CORRADE_VERIFY(data.isIndexed());
+    CORRADE_COMPARE(data.indexType(), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE(data.indexCount(), 3);
+    CORRADE_COMPARE(data.indices<UnsignedByte>().size(), 3);
+    CORRADE_COMPARE(data.indices<UnsignedByte>()[2], 1);
+    CORRADE_COMPARE(data.indicesAsArray(), (std::vector<UnsignedInt>{1, 0, 1}));
+}
+
+void MeshDataTest::constructMeshData3D() {
+    const MeshData3D data3D{MeshPrimitive::Triangles, {0, 1, 2, 2, 1, 0}, {
+        {{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}}
+    }, {
+        {Vector3::xAxis(), Vector3::yAxis(), Vector3::zAxis()}
+    }, {
+        {{0.0f, 0.5f}, {1.0f, 0.5f}, {0.5f, 1.0f}}
+    }, {
+        {0xff3366_rgbf, 0x33ff66_rgbf, 0x3366ff_rgbf},
+        {0x000000_rgbf, 0x111111_rgbf, 0x222222_rgbf}
+    }, &state};
+
+    const MeshData data{data3D};
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(data.importerState(), &state);
+    CORRADE_COMPARE(data.vertexCount(), 3);
+
+    /* Everything in a single allocation */
+    CORRADE_COMPARE(data.vertexData().size(), 3*(12 + 12 + 8 + 16 + 16));
+    CORRADE_COMPARE(data.attributeCount(), 5);
+    CORRADE_COMPARE(data.attributeCount(MeshAttribute::Color), 2);
+    CORRADE_COMPARE(data.attributeId(MeshAttribute::Color, 1), 4);
+    CORRADE_COMPARE(data.attributes()[4].offset, 48);
+    CORRADE_COMPARE(data.attributes()[4].stride, 64);
+
+    /* Smallest possible index type */
+    CORRADE_VERIFY(data.isIndexed());
+    CORRADE_COMPARE(data.indexType(), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE(data.indexData().size(), 6);
+    CORRADE_COMPARE(data.indicesAsArray(), data3D.indices());
+
+    CORRADE_COMPARE(data.positions3DAsArray(), data3D.positions(0));
+    CORRADE_COMPARE(data.normalsAsArray(), data3D.normals(0));
+    CORRADE_COMPARE(data.textureCoordinates2DAsArray(), data3D.textureCoords2D(0));
+    CORRADE_COMPARE(data.colorsAsArray(1), data3D.colors(1));
+}
+
+void MeshDataTest::constructMeshData3DLargeIndices() {
+    std::vector<Vector3> positions(70000);
+    const MeshData3D data3D{MeshPrimitive::Points, {0, 69999, 256}, {positions}, {}, {}, {}, nullptr};
+
+    const MeshData data{data3D};
+    CORRADE_COMPARE(data.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE(data.indicesAsArray(), (std::vector<UnsignedInt>{0, 69999, 256}));
+}
+
+void MeshDataTest::constructMove() {
+    MeshData a{MeshPrimitive::Triangles, vertexData(), attributes(), 2, &state};
+    const char* vertexPointer = a.vertexData().data();
+
+    MeshData b{std::move(a)};
+    CORRADE_COMPARE(b.vertexCount(), 2);
+    CORRADE_COMPARE(b.vertexData().data(), vertexPointer);
+    CORRADE_COMPARE(b.attributeCount(), 3);
+    CORRADE_COMPARE(b.importerState(), &state);
+
+    MeshData c{MeshPrimitive::Points, nullptr, nullptr, 0};
+    c = std::move(b);
+    CORRADE_COMPARE(c.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(c.vertexData().data(), vertexPointer);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<MeshData>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<MeshData>::value);
+}
+
+void MeshDataTest::constructWrongIndexDataSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Containers::Array<char> indexData{3};
+    MeshData{MeshPrimitive::Triangles, MeshIndexType::UnsignedShort, std::move(indexData), vertexData(), attributes(), 2};
+    CORRADE_COMPARE(out.str(), "Trade::MeshData: index data size 3 is not divisible by size of MeshIndexType::UnsignedShort\n");
+}
+
+void MeshDataTest::constructAttributeOutOfBounds() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshData{MeshPrimitive::Triangles, vertexData(), attributes(), 3};
+    CORRADE_COMPARE(out.str(), "Trade::MeshData: attribute 1 doesn't fit into 64 bytes of vertex data\n");
+}
+
+void MeshDataTest::constructInvalidComponentCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Containers::Array<MeshAttributeData> attributes{1};
+    attributes[0] = MeshAttributeData{MeshAttribute::Normal, MeshBlobAttributeType::Int2101010Rev, 3, 0, 4};
+    MeshData{MeshPrimitive::Triangles, vertexData(), std::move(attributes), 2};
+    CORRADE_COMPARE(out.str(), "Trade::MeshData: invalid component count 3 for attribute 0\n");
+}
+
+void MeshDataTest::attributeWrongType() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const MeshData data{MeshPrimitive::Triangles, vertexData(), attributes(), 2};
+    data.attribute<Vector2>(MeshAttribute::Normal);
+    CORRADE_COMPARE(out.str(), "Trade::MeshData::attribute(): improper type requested for Trade::MeshAttribute::Normal of 12 bytes\n");
+}
+
+void MeshDataTest::attributeIdOutOfRange() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const MeshData data{MeshPrimitive::Triangles, vertexData(), attributes(), 2};
+    data.attribute<Vector3>(3);
+    data.attributeId(MeshAttribute::Normal, 1);
+    CORRADE_COMPARE(out.str(),
+        "Trade::MeshData::attribute(): index 3 out of range for 3 attributes\n"
+        "Trade::MeshData::attributeId(): index 1 out of range for 1 Trade::MeshAttribute::Normal attributes\n");
+}
+
+void MeshDataTest::notIndexed() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const MeshData data{MeshPrimitive::Triangles, vertexData(), attributes(), 2};
+    data.indexType();
+    data.indices<UnsignedShort>();
+    data.indicesAsArray();
+    CORRADE_COMPARE(out.str(),
+        "Trade::MeshData::indexType(): the mesh is not indexed\n"
+        "Trade::MeshData::indices(): the mesh is not indexed\n"
+        "Trade::MeshData::indicesAsArray(): the mesh is not indexed\n");
+}
+
+void MeshDataTest::indicesWrongType() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Containers::Array<char> indexData{4};
+    const MeshData data{MeshPrimitive::Triangles, MeshIndexType::UnsignedShort, std::move(indexData), vertexData(), attributes(), 2};
+    data.indices<UnsignedInt>();
+    CORRADE_COMPARE(out.str(), "Trade::MeshData::indices(): improper type requested for MeshIndexType::UnsignedShort\n");
+}
+
+void MeshDataTest::convertPacked() {
+    /* Normalized short positions (with padding), half-float texture
+       coordinates, 2.10.10.10 normals and three-component byte colors */
+    struct Vertex {
+        Short position[4];
+        UnsignedShort textureCoordinates[2];
+        UnsignedInt normal;
+        UnsignedByte color[3];
+        UnsignedByte padding;
+    };
+    const Vertex vertices[]{
+        {{32767, -32767, 0, 0}, {Math::packHalf(0.5f), Math::packHalf(2.0f)},
+            511u | (UnsignedInt(-511) & 0x3ff) << 10 | 0u << 20 | 1u << 30,
+            {255, 0, 51}, 0}
+    };
+    Containers::Array<char> vertexData{Containers::NoInit, sizeof(vertices)};
+    std::memcpy(vertexData.data(), vertices, sizeof(vertices));
+    Containers::Array<MeshAttributeData> attributes{4};
+    attributes[0] = MeshAttributeData{MeshAttribute::Position, MeshBlobAttributeType::Short, 3, 0, sizeof(Vertex), true};
+    attributes[1] = MeshAttributeData{MeshAttribute::TextureCoordinates, MeshBlobAttributeType::HalfFloat, 2, 8, sizeof(Vertex)};
+    attributes[2] = MeshAttributeData{MeshAttribute::Normal, MeshBlobAttributeType::Int2101010Rev, 4, 12, sizeof(Vertex), true};
+    attributes[3] = MeshAttributeData{MeshAttribute::Color, MeshBlobAttributeType::UnsignedByte, 3, 16, sizeof(Vertex), true};
+
+    const MeshData data{MeshPrimitive::Points, std::move(vertexData), std::move(attributes), 1};
+    CORRADE_COMPARE(data.positions3DAsArray(), (std::vector<Vector3>{{1.0f, -1.0f, 0.0f}}));
+    CORRADE_COMPARE(data.textureCoordinates2DAsArray(), (std::vector<Vector2>{{0.5f, 2.0f}}));
+    CORRADE_COMPARE(data.normalsAsArray(), (std::vector<Vector3>{{1.0f, -1.0f, 0.0f}}));
+    CORRADE_COMPARE(data.colorsAsArray(), (std::vector<Color4>{{1.0f, 0.0f, 0.2f, 1.0f}}));
+}
+
+void MeshDataTest::convertHalf() {
+    /* Float positions, everything else packed into half-floats */
+    struct Vertex {
+        Vector3 position;
+        Vector3h normal;
+        Vector2h textureCoordinates;
+        Vector4h color;
+    } vertices[2];
+    const Vector3 positions[]{{1.0f, 2.0f, 3.0f}, {-1.0f, 0.0f, 0.5f}};
+    const Vector3 normals[]{{0.0f, 1.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}};
+    const Vector2 textureCoordinates[]{{0.25f, 0.5f}, {1.0f, 0.75f}};
+    const Color4 colors[]{{1.0f, 0.5f, 0.0f, 1.0f}, {0.25f, 0.125f, 1.0f, 0.5f}};
+    for(std::size_t i = 0; i != 2; ++i) vertices[i].position = positions[i];
+    Math::packHalfInto(Containers::StridedArrayView<const Vector3>{normals, 2, sizeof(Vector3)},
+        Containers::StridedArrayView<Vector3h>{&vertices[0].normal, 2, sizeof(Vertex)});
+    Math::packHalfInto(Containers::StridedArrayView<const Vector2>{textureCoordinates, 2, sizeof(Vector2)},
+        Containers::StridedArrayView<Vector2h>{&vertices[0].textureCoordinates, 2, sizeof(Vertex)});
+    Math::packHalfInto(Containers::StridedArrayView<const Color4>{colors, 2, sizeof(Color4)},
+        Containers::StridedArrayView<Vector4h>{&vertices[0].color, 2, sizeof(Vertex)});
+
+    Containers::Array<char> vertexData{Containers::NoInit, sizeof(vertices)};
+    std::memcpy(vertexData.data(), vertices, sizeof(vertices));
+    Containers::Array<MeshAttributeData> attributes{4};
+    attributes[0] = MeshAttributeData{MeshAttribute::Position, MeshBlobAttributeType::Float, 3, offsetof(Vertex, position), sizeof(Vertex)};
+    attributes[1] = MeshAttributeData{MeshAttribute::Normal, MeshBlobAttributeType::HalfFloat, 3, offsetof(Vertex, normal), sizeof(Vertex)};
+    attributes[2] = MeshAttributeData{MeshAttribute::TextureCoordinates, MeshBlobAttributeType::HalfFloat, 2, offsetof(Vertex, textureCoordinates), sizeof(Vertex)};
+    attributes[3] = MeshAttributeData{MeshAttribute::Color, MeshBlobAttributeType::HalfFloat, 4, offsetof(Vertex, color), sizeof(Vertex)};
+
+    const MeshData data{MeshPrimitive::Points, std::move(vertexData), std::move(attributes), 2};
+
+    /* Typed access to the half-float storage */
+    CORRADE_COMPARE(data.attributes()[2].size(), sizeof(Vector2h));
+    Containers::StridedArrayView<const Vector2h> packedTextureCoordinates = data.attribute<Vector2h>(MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(packedTextureCoordinates.size(), 2);
+    CORRADE_COMPARE(Vector2{packedTextureCoordinates[1]}, (Vector2{1.0f, 0.75f}));
+
+    /* Conversion back to floats */
+    CORRADE_COMPARE(data.positions3DAsArray(), (std::vector<Vector3>{positions, positions + 2}));
+    CORRADE_COMPARE(data.normalsAsArray(), (std::vector<Vector3>{normals, normals + 2}));
+    CORRADE_COMPARE(data.textureCoordinates2DAsArray(), (std::vector<Vector2>{textureCoordinates, textureCoordinates + 2}));
+    CORRADE_COMPARE(data.colorsAsArray(), (std::vector<Color4>{colors, colors + 2}));
+}
+
+void MeshDataTest::release() {
+    Containers::Array<char> indexData{Containers::InPlaceInit, {1, 0, 1}};
+    MeshData data{MeshPrimitive::Lines, MeshIndexType::UnsignedByte, std::move(indexData), vertexData(), attributes(), 2};
+    const char* indexPointer = data.indexData().data();
+    const char* vertexPointer = data.vertexData().data();
+
+    Containers::Array<char> releasedIndices = data.releaseIndexData();
+    CORRADE_COMPARE(releasedIndices.data(), indexPointer);
+    CORRADE_COMPARE(data.indexCount(), 0);
+    CORRADE_VERIFY(data.isIndexed());
+
+    Containers::Array<char> releasedVertices = data.releaseVertexData();
+    CORRADE_COMPARE(releasedVertices.data(), vertexPointer);
+    CORRADE_COMPARE(data.vertexCount(), 0);
+    CORRADE_COMPARE(data.attributeCount(), 3);
+}
+
+void MeshDataTest::debugAttribute() {
+    std::ostringstream out;
+    Debug{&out} << MeshAttribute::TextureCoordinates << MeshAttribute(0xdd);
+    CORRADE_COMPARE(out.str(), "Trade::MeshAttribute::TextureCoordinates Trade::MeshAttribute(0xdd)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshDataTest)
@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Trade/FlatSceneData3D.h"
+#include "Magnum/Trade/MeshInstanceBatch3D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MeshInstanceBatch3DTest: public TestSuite::Tester {
+    public:
+        explicit MeshInstanceBatch3DTest();
+
+        void batches();
+        void batchesHierarchy();
+        void batchesEmpty();
+        void batchesInvalidTransformationCount();
+};
+
+MeshInstanceBatch3DTest::MeshInstanceBatch3DTest() {
+    addTests({&MeshInstanceBatch3DTest::batches,
+              &MeshInstanceBatch3DTest::batchesHierarchy,
+              &MeshInstanceBatch3DTest::batchesEmpty,
+              &MeshInstanceBatch3DTest::batchesInvalidTransformationCount});
+}
+
+namespace {
+
+/* Objects 0, 3 and 5 share mesh 2 with material 1, object 4 has mesh 2 with
+   a different material, object 1 is a camera and object 6 an empty. Object 2
+   is root, everything else is its direct child. */
+FlatSceneData3D scene() {
+    Containers::Array<UnsignedInt> objects{Containers::ValueInit, 7};
+    Containers::Array<Int> parents{Containers::NoInit, 7};
+    Containers::Array<Matrix4> transformations{7};
+    Containers::Array<ObjectInstanceType3D> instanceTypes{Containers::NoInit, 7};
+    Containers::Array<Int> instances{Containers::NoInit, 7};
+    Containers::Array<Int> materials{Containers::NoInit, 7};
+    const Int parentData[]{2, 2, -1, 2, 2, 2, 2};
+    const ObjectInstanceType3D instanceTypeData[]{
+        ObjectInstanceType3D::Mesh,
+        ObjectInstanceType3D::Camera,
+        ObjectInstanceType3D::Mesh,
+        ObjectInstanceType3D::Mesh,
+        ObjectInstanceType3D::Mesh,
+        ObjectInstanceType3D::Mesh,
+        ObjectInstanceType3D::Empty};
+    const Int instanceData[]{2, 2, 0, 2, 2, 2, -1};
+    const Int materialData[]{1, -1, -1, 1, 0, 1, -1};
+    for(std::size_t i = 0; i != 7; ++i) {
+        parents[i] = parentData[i];
+        instanceTypes[i] = instanceTypeData[i];
+        instances[i] = instanceData[i];
+        materials[i] = materialData[i];
+        transformations[i] = Matrix4::translation(Vector3::xAxis(Float(i)));
+    }
+    transformations[2] = Matrix4::scaling({2.0f, 1.0f, 1.0f});
+
+    return FlatSceneData3D{std::move(objects), std::move(parents), std::move(transformations), std::move(instanceTypes), std::move(instances), std::move(materials)};
+}
+
+}
+
+void MeshInstanceBatch3DTest::batches() {
+    const FlatSceneData3D data = scene();
+    Matrix4 absolute[7];
+    for(std::size_t i = 0; i != 7; ++i)
+        absolute[i] = Matrix4::translation(Vector3::yAxis(Float(i)));
+
+    std::pair<Containers::Array<MeshInstanceBatch3D>, Containers::Array<MeshInstanceData3D>> batches = meshInstanceBatches3D(data, absolute);
+
+    /* Sorted by mesh, then by material */
+    CORRADE_COMPARE(batches.first.size(), 3);
+    CORRADE_COMPARE(batches.first[0].mesh, 0);
+    CORRADE_COMPARE(batches.first[0].material, -1);
+    CORRADE_COMPARE(batches.first[0].offset, 0);
+    CORRADE_COMPARE(batches.first[0].count, 1);
+    CORRADE_COMPARE(batches.first[1].mesh, 2);
+    CORRADE_COMPARE(batches.first[1].material, 0);
+    CORRADE_COMPARE(batches.first[1].offset, 1);
+    CORRADE_COMPARE(batches.first[1].count, 1);
+    CORRADE_COMPARE(batches.first[2].mesh, 2);
+    CORRADE_COMPARE(batches.first[2].material, 1);
+    CORRADE_COMPARE(batches.first[2].offset, 2);
+    CORRADE_COMPARE(batches.first[2].count, 3);
+
+    /* Instances in a batch are in scene order */
+    CORRADE_COMPARE(batches.second.size(), 5);
+    CORRADE_COMPARE(batches.second[0].transformation, Matrix4::translation(Vector3::yAxis(2.0f)));
+    CORRADE_COMPARE(batches.second[1].transformation, Matrix4::translation(Vector3::yAxis(4.0f)));
+    CORRADE_COMPARE(batches.second[2].transformation, Matrix4::translation(Vector3::yAxis(0.0f)));
+    CORRADE_COMPARE(batches.second[3].transformation, Matrix4::translation(Vector3::yAxis(3.0f)));
+    CORRADE_COMPARE(batches.second[4].transformation, Matrix4::translation(Vector3::yAxis(5.0f)));
+    CORRADE_COMPARE(batches.second[4].normalMatrix, Matrix3x3{});
+}
+
+void MeshInstanceBatch3DTest::batchesHierarchy() {
+    const FlatSceneData3D data = scene();
+    std::pair<Containers::Array<MeshInstanceBatch3D>, Containers::Array<MeshInstanceData3D>> batches = meshInstanceBatches3D(data);
+
+    /* Absolute transformations are calculated from the hierarchy */
+    CORRADE_COMPARE(batches.second.size(), 5);
+    CORRADE_COMPARE(batches.second[0].transformation, Matrix4::scaling({2.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(batches.second[3].transformation,
+        Matrix4::scaling({2.0f, 1.0f, 1.0f})*Matrix4::translation(Vector3::xAxis(3.0f)));
+
+    /* Normal matrix is inverse transpose of the non-uniform scaling */
+    CORRADE_COMPARE(batches.second[3].normalMatrix,
+        Matrix4::scaling({0.5f, 1.0f, 1.0f}).rotationScaling());
+}
+
+void MeshInstanceBatch3DTest::batchesEmpty() {
+    const FlatSceneData3D data{nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+    std::pair<Containers::Array<MeshInstanceBatch3D>, Containers::Array<MeshInstanceData3D>> batches = meshInstanceBatches3D(data);
+    CORRADE_VERIFY(batches.first.empty());
+    CORRADE_VERIFY(batches.second.empty());
+}
+
+void MeshInstanceBatch3DTest::batchesInvalidTransformationCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const FlatSceneData3D data = scene();
+    Matrix4 absolute[6];
+    meshInstanceBatches3D(data, absolute);
+    CORRADE_COMPARE(out.str(), "Trade::meshInstanceBatches3D(): expected 7 transformations but got 6\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshInstanceBatch3DTest)
@@ -0,0 +1,280 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/VolumeBlob.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct VolumeBlobTest: TestSuite::Tester {
+    explicit VolumeBlobTest();
+
+    void serialize();
+    void serializeSink();
+    void serializeSinkAbort();
+    void serializeEmpty();
+    void serializeInvalidBrickSize();
+
+    void brickCoordinates();
+    void brickOutOfRange();
+    void brickCoordinatesOutOfRange();
+
+    void deserializeTooShort();
+    void deserializeInvalidSignature();
+    void deserializeUnsupportedVersion();
+    void deserializeOutOfBounds();
+};
+
+VolumeBlobTest::VolumeBlobTest() {
+    addTests({&VolumeBlobTest::serialize,
+              &VolumeBlobTest::serializeSink,
+              &VolumeBlobTest::serializeSinkAbort,
+              &VolumeBlobTest::serializeEmpty,
+              &VolumeBlobTest::serializeInvalidBrickSize,
+
+              &VolumeBlobTest::brickCoordinates,
+              &VolumeBlobTest::brickOutOfRange,
+              &VolumeBlobTest::brickCoordinatesOutOfRange,
+
+              &VolumeBlobTest::deserializeTooShort,
+              &VolumeBlobTest::deserializeInvalidSignature,
+              &VolumeBlobTest::deserializeUnsupportedVersion,
+              &VolumeBlobTest::deserializeOutOfBounds});
+}
+
+namespace {
+
+/* 3x2x1 volume with rows padded to four bytes */
+const char VolumeData[]{
+    0, 1, 2, 0,
+    3, 4, 5, 0
+};
+
+const ImageView3D Volume{PixelFormat::R8Unorm, {3, 2, 1}, VolumeData};
+
+/* 2x2x1 bricks with a one-voxel border are 4x4x3, 48 bytes aligned to 64 */
+const char Brick0[]{
+    0, 0, 1, 2,
+    0, 0, 1, 2,
+    3, 3, 4, 5,
+    3, 3, 4, 5,
+
+    0, 0, 1, 2,
+    0, 0, 1, 2,
+    3, 3, 4, 5,
+    3, 3, 4, 5,
+
+    0, 0, 1, 2,
+    0, 0, 1, 2,
+    3, 3, 4, 5,
+    3, 3, 4, 5
+};
+
+const char Brick1[]{
+    1, 2, 2, 2,
+    1, 2, 2, 2,
+    4, 5, 5, 5,
+    4, 5, 5, 5,
+
+    1, 2, 2, 2,
+    1, 2, 2, 2,
+    4, 5, 5, 5,
+    4, 5, 5, 5,
+
+    1, 2, 2, 2,
+    1, 2, 2, 2,
+    4, 5, 5, 5,
+    4, 5, 5, 5
+};
+
+}
+
+void VolumeBlobTest::serialize() {
+    const Containers::Array<char> data = VolumeBlob::serialize(Volume, {2, 2, 1}, 1);
+    /* 64-byte header and two bricks aligned to 64 bytes */
+    CORRADE_COMPARE(data.size(), 64 + 2*64);
+
+    Containers::Optional<VolumeBlob> blob = VolumeBlob::deserialize(data);
+    CORRADE_VERIFY(blob);
+    CORRADE_COMPARE(blob->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(blob->formatExtra(), 0);
+    CORRADE_COMPARE(blob->pixelSize(), 1);
+    CORRADE_COMPARE(blob->size(), (Vector3i{3, 2, 1}));
+    CORRADE_COMPARE(blob->brickSize(), (Vector3i{2, 2, 1}));
+    CORRADE_COMPARE(blob->border(), 1);
+    CORRADE_COMPARE(blob->storedBrickSize(), (Vector3i{4, 4, 3}));
+    CORRADE_COMPARE(blob->brickCount(), (Vector3i{2, 1, 1}));
+
+    /* The bricks should point directly into the blob, aligned */
+    ImageView3D brick0 = blob->brick(0);
+    CORRADE_COMPARE(brick0.storage().alignment(), 1);
+    CORRADE_COMPARE(brick0.format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(brick0.size(), (Vector3i{4, 4, 3}));
+    CORRADE_COMPARE(static_cast<const void*>(brick0.data().data()), static_cast<const void*>(data.data() + 64));
+    CORRADE_COMPARE_AS(brick0.data(),
+        Containers::arrayView(Brick0),
+        TestSuite::Compare::Container);
+
+    ImageView3D brick1 = blob->brick(1);
+    CORRADE_COMPARE(static_cast<const void*>(brick1.data().data()), static_cast<const void*>(data.data() + 128));
+    CORRADE_COMPARE_AS(brick1.data(),
+        Containers::arrayView(Brick1),
+        TestSuite::Compare::Container);
+}
+
+void VolumeBlobTest::serializeSink() {
+    struct State {
+        Containers::Array<char> data{Containers::ValueInit, 64 + 2*64};
+        std::size_t offset{};
+        UnsignedInt calls{};
+    } state;
+
+    CORRADE_VERIFY(VolumeBlob::serialize(Volume, {2, 2, 1}, 1, [](Containers::ArrayView<const char> data, void* userData) {
+        State& state = *static_cast<State*>(userData);
+        CORRADE_INTERNAL_ASSERT(state.offset + data.size() <= state.data.size());
+        std::memcpy(state.data.data() + state.offset, data.data(), data.size());
+        state.offset += data.size();
+        ++state.calls;
+        return true;
+    }, &state));
+
+    /* Header first, then each brick separately */
+    CORRADE_COMPARE(state.calls, 3);
+    CORRADE_COMPARE(state.offset, 64 + 2*64);
+    CORRADE_COMPARE_AS(state.data, VolumeBlob::serialize(Volume, {2, 2, 1}, 1),
+        TestSuite::Compare::Container);
+}
+
+void VolumeBlobTest::serializeSinkAbort() {
+    UnsignedInt calls = 0;
+    CORRADE_VERIFY(!VolumeBlob::serialize(Volume, {2, 2, 1}, 1, [](Containers::ArrayView<const char>, void* userData) {
+        return ++*static_cast<UnsignedInt*>(userData) != 2;
+    }, &calls));
+    CORRADE_COMPARE(calls, 2);
+}
+
+void VolumeBlobTest::serializeEmpty() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    VolumeBlob::serialize(ImageView3D{PixelFormat::R8Unorm, {3, 0, 1}, nullptr}, {2, 2, 2}, 1);
+    CORRADE_COMPARE(out.str(), "Trade::VolumeBlob::serialize(): expected a non-empty volume\n");
+}
+
+void VolumeBlobTest::serializeInvalidBrickSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    VolumeBlob::serialize(Volume, {2, 0, 1}, 1);
+    VolumeBlob::serialize(Volume, {2, 2, 1}, -1);
+    CORRADE_COMPARE(out.str(),
+        "Trade::VolumeBlob::serialize(): invalid brick size Vector(2, 0, 1) and border 1\n"
+        "Trade::VolumeBlob::serialize(): invalid brick size Vector(2, 2, 1) and border -1\n");
+}
+
+void VolumeBlobTest::brickCoordinates() {
+    const char data[4*3*5]{};
+    const Containers::Array<char> blobData = VolumeBlob::serialize(ImageView3D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, {4, 3, 5}, data}, {2, 2, 2}, 0);
+    Containers::Optional<VolumeBlob> blob = VolumeBlob::deserialize(blobData);
+    CORRADE_VERIFY(blob);
+
+    /* Partial bricks at the end of each dimension */
+    CORRADE_COMPARE(blob->brickCount(), (Vector3i{2, 2, 3}));
+    CORRADE_COMPARE(blob->brickId({0, 0, 0}), 0);
+    CORRADE_COMPARE(blob->brickId({1, 1, 2}), 11);
+    CORRADE_COMPARE(static_cast<const void*>(blob->brick({1, 1, 2}).data().data()), static_cast<const void*>(blob->brick(11).data().data()));
+}
+
+void VolumeBlobTest::brickOutOfRange() {
+    const Containers::Array<char> data = VolumeBlob::serialize(Volume, {2, 2, 1}, 1);
+    Containers::Optional<VolumeBlob> blob = VolumeBlob::deserialize(data);
+    CORRADE_VERIFY(blob);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    blob->brick(2);
+    CORRADE_COMPARE(out.str(), "Trade::VolumeBlob::brick(): index 2 out of range for 2 bricks\n");
+}
+
+void VolumeBlobTest::brickCoordinatesOutOfRange() {
+    const Containers::Array<char> data = VolumeBlob::serialize(Volume, {2, 2, 1}, 1);
+    Containers::Optional<VolumeBlob> blob = VolumeBlob::deserialize(data);
+    CORRADE_VERIFY(blob);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    blob->brick({0, 1, 0});
+    blob->brick({-1, 0, 0});
+    CORRADE_COMPARE(out.str(),
+        "Trade::VolumeBlob::brick(): coordinates Vector(0, 1, 0) out of range for Vector(2, 1, 1) bricks\n"
+        "Trade::VolumeBlob::brick(): coordinates Vector(-1, 0, 0) out of range for Vector(2, 1, 1) bricks\n");
+}
+
+void VolumeBlobTest::deserializeTooShort() {
+    const Containers::Array<char> data = VolumeBlob::serialize(Volume, {2, 2, 1}, 1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!VolumeBlob::deserialize({data.data(), 63}));
+    CORRADE_COMPARE(out.str(), "Trade::VolumeBlob::deserialize(): expected at least 64 bytes but got 63\n");
+}
+
+void VolumeBlobTest::deserializeInvalidSignature() {
+    Containers::Array<char> data = VolumeBlob::serialize(Volume, {2, 2, 1}, 1);
+    data[2] = 'X';
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!VolumeBlob::deserialize(data));
+    CORRADE_COMPARE(out.str(), "Trade::VolumeBlob::deserialize(): invalid signature\n");
+}
+
+void VolumeBlobTest::deserializeUnsupportedVersion() {
+    Containers::Array<char> data = VolumeBlob::serialize(Volume, {2, 2, 1}, 1);
+    const UnsignedShort version = 57;
+    std::memcpy(data.data() + 6, &version, 2);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!VolumeBlob::deserialize(data));
+    CORRADE_COMPARE(out.str(), "Trade::VolumeBlob::deserialize(): unsupported version 57\n");
+}
+
+void VolumeBlobTest::deserializeOutOfBounds() {
+    const Containers::Array<char> data = VolumeBlob::serialize(Volume, {2, 2, 1}, 1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!VolumeBlob::deserialize({data.data(), data.size() - 1}));
+    CORRADE_COMPARE(out.str(), "Trade::VolumeBlob::deserialize(): data out of bounds for a blob of 191 bytes\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::VolumeBlobTest)
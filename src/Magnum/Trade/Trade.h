@@ -56,9 +56,20 @@ typedef ImageData<1> ImageData1D;
 typedef ImageData<2> ImageData2D;
 typedef ImageData<3> ImageData3D;
 
+class FlatSceneData3D;
 class LightData;
+
+enum class MeshBlobAttributeType: UnsignedByte;
+struct MeshBlobAttribute;
+class MeshBlob;
+
+enum class MeshAttribute: UnsignedByte;
+struct MeshAttributeData;
+class MeshData;
 class MeshData2D;
 class MeshData3D;
+struct MeshInstanceBatch3D;
+struct MeshInstanceData3D;
 class MeshObjectData2D;
 class MeshObjectData3D;
 class ObjectData2D;
@@ -66,6 +77,7 @@ class ObjectData3D;
 class PhongMaterialData;
 class TextureData;
 class SceneData;
+class VolumeBlob;
 #endif
 
 }}
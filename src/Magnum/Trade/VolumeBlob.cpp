@@ -0,0 +1,234 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "VolumeBlob.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+struct Header {
+    char magic[4];
+    UnsignedShort byteOrderMark;
+    UnsignedShort version;
+    UnsignedInt format;
+    UnsignedInt formatExtra;
+    UnsignedInt pixelSize;
+    Int size[3];
+    Int brickSize[3];
+    Int border;
+    std::uint64_t brickStride;
+    std::uint64_t dataOffset;
+};
+
+static_assert(sizeof(Header) == 64, "improper size of the header");
+
+constexpr char Magic[]{'M', 'G', 'V', 'B'};
+constexpr UnsignedShort ByteOrderMark = 0xfeff;
+constexpr UnsignedShort Version = 1;
+
+std::size_t alignUp(const std::size_t value) {
+    return (value + VolumeBlob::Alignment - 1)/VolumeBlob::Alignment*VolumeBlob::Alignment;
+}
+
+}
+
+bool VolumeBlob::serialize(const ImageView3D& volume, const Vector3i& brickSize, const Int border, bool(*const sink)(Containers::ArrayView<const char>, void*), void* const userData) {
+    CORRADE_ASSERT(volume.size().min() > 0,
+        "Trade::VolumeBlob::serialize(): expected a non-empty volume", false);
+    CORRADE_ASSERT(brickSize.min() > 0 && border >= 0,
+        "Trade::VolumeBlob::serialize(): invalid brick size" << brickSize << "and border" << border, false);
+
+    const std::size_t pixelSize = volume.pixelSize();
+    const Vector3i storedBrickSize = brickSize + Vector3i{2*border};
+    const std::size_t brickDataSize = std::size_t(storedBrickSize.product())*pixelSize;
+
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.byteOrderMark = ByteOrderMark;
+    header.version = Version;
+    header.format = UnsignedInt(volume.format());
+    header.formatExtra = volume.formatExtra();
+    header.pixelSize = UnsignedInt(pixelSize);
+    for(std::size_t i = 0; i != 3; ++i) {
+        header.size[i] = volume.size()[i];
+        header.brickSize[i] = brickSize[i];
+    }
+    header.border = border;
+    header.brickStride = alignUp(brickDataSize);
+    header.dataOffset = alignUp(sizeof(Header));
+
+    /* Zero-initialize so the padding is deterministic, the header is padded
+       to the alignment as well */
+    Containers::Array<char> brick{Containers::ValueInit, std::size_t(header.brickStride)};
+    std::memcpy(brick.data(), &header, sizeof(Header));
+    if(!sink(brick.prefix(std::size_t(header.dataOffset)), userData)) return false;
+
+    /* Source data pointer including skip and strides */
+    const char* const data = volume.data().data() + std::get<0>(volume.dataProperties()).sum();
+    const Math::Vector3<std::size_t> dataSize = std::get<1>(volume.dataProperties());
+    const std::size_t rowStride = dataSize.x();
+    const std::size_t sliceStride = dataSize.xy().product();
+
+    /* Copy the voxels of each brick including the border, clamping the
+       coordinates to repeat the edge voxels */
+    const Vector3i brickCount = (volume.size() + brickSize - Vector3i{1})/brickSize;
+    const Vector3i max = volume.size() - Vector3i{1};
+    for(Int bz = 0; bz != brickCount.z(); ++bz)
+    for(Int by = 0; by != brickCount.y(); ++by)
+    for(Int bx = 0; bx != brickCount.x(); ++bx) {
+        const Vector3i origin = Vector3i{bx, by, bz}*brickSize - Vector3i{border};
+        char* out = brick.data();
+        for(Int z = 0; z != storedBrickSize.z(); ++z) {
+            const std::size_t sz = Math::clamp(origin.z() + z, 0, max.z());
+            for(Int y = 0; y != storedBrickSize.y(); ++y) {
+                const char* const row = data + sz*sliceStride + Math::clamp(origin.y() + y, 0, max.y())*rowStride;
+
+                /* Repeat the first voxel, copy the interior in one go and
+                   repeat the last voxel */
+                Int x = 0;
+                for(; origin.x() + x < 0; ++x, out += pixelSize)
+                    std::memcpy(out, row, pixelSize);
+                const Int end = Math::min(storedBrickSize.x(), volume.size().x() - origin.x());
+                if(end > x) {
+                    const std::size_t size = std::size_t(end - x)*pixelSize;
+                    std::memcpy(out, row + (origin.x() + x)*pixelSize, size);
+                    out += size;
+                    x = end;
+                }
+                for(; x != storedBrickSize.x(); ++x, out += pixelSize)
+                    std::memcpy(out, row + max.x()*pixelSize, pixelSize);
+            }
+        }
+
+        if(!sink(brick, userData)) return false;
+    }
+
+    return true;
+}
+
+Containers::Array<char> VolumeBlob::serialize(const ImageView3D& volume, const Vector3i& brickSize, const Int border) {
+    CORRADE_ASSERT(volume.size().min() > 0,
+        "Trade::VolumeBlob::serialize(): expected a non-empty volume", nullptr);
+    CORRADE_ASSERT(brickSize.min() > 0 && border >= 0,
+        "Trade::VolumeBlob::serialize(): invalid brick size" << brickSize << "and border" << border, nullptr);
+
+    /* The blob size is known upfront, write directly into it */
+    const Vector3i brickCount = (volume.size() + brickSize - Vector3i{1})/brickSize;
+    const std::size_t brickStride = alignUp(std::size_t((brickSize + Vector3i{2*border}).product())*volume.pixelSize());
+    Containers::Array<char> out{alignUp(sizeof(Header)) + std::size_t(brickCount.product())*brickStride};
+    std::pair<Containers::Array<char>&, std::size_t> state{out, 0};
+    serialize(volume, brickSize, border, [](Containers::ArrayView<const char> data, void* userData) {
+        auto& state = *static_cast<std::pair<Containers::Array<char>&, std::size_t>*>(userData);
+        std::memcpy(state.first.data() + state.second, data.data(), data.size());
+        state.second += data.size();
+        return true;
+    }, &state);
+    CORRADE_INTERNAL_ASSERT(state.second == out.size());
+
+    return out;
+}
+
+Containers::Optional<VolumeBlob> VolumeBlob::deserialize(const Containers::ArrayView<const char> data) {
+    if(data.size() < sizeof(Header)) {
+        Error() << "Trade::VolumeBlob::deserialize(): expected at least" << sizeof(Header) << "bytes but got" << data.size();
+        return Containers::NullOpt;
+    }
+
+    Header header;
+    std::memcpy(&header, data.data(), sizeof(Header));
+
+    if(std::memcmp(header.magic, Magic, sizeof(Magic)) != 0) {
+        Error() << "Trade::VolumeBlob::deserialize(): invalid signature";
+        return Containers::NullOpt;
+    }
+
+    if(header.byteOrderMark != ByteOrderMark) {
+        Error() << "Trade::VolumeBlob::deserialize(): unsupported byte order";
+        return Containers::NullOpt;
+    }
+
+    if(header.version != Version) {
+        Error() << "Trade::VolumeBlob::deserialize(): unsupported version" << header.version;
+        return Containers::NullOpt;
+    }
+
+    const Vector3i size{header.size[0], header.size[1], header.size[2]};
+    const Vector3i brickSize{header.brickSize[0], header.brickSize[1], header.brickSize[2]};
+    if(size.min() <= 0 || brickSize.min() <= 0 || header.border < 0 || !header.pixelSize) {
+        Error() << "Trade::VolumeBlob::deserialize(): invalid volume size" << size << Debug::nospace << ", brick size" << brickSize << Debug::nospace << ", border" << header.border << "or pixel size" << header.pixelSize;
+        return Containers::NullOpt;
+    }
+
+    /* Check that everything is in bounds, taking care to not overflow */
+    const std::uint64_t brickCount = std::uint64_t(((size + brickSize - Vector3i{1})/brickSize).product());
+    const std::uint64_t brickDataSize = std::uint64_t((brickSize + Vector3i{2*header.border}).product())*header.pixelSize;
+    const std::uint64_t dataSize = data.size();
+    if(header.brickStride < brickDataSize || header.dataOffset < sizeof(Header) || header.dataOffset > dataSize ||
+       brickCount > (dataSize - header.dataOffset)/header.brickStride) {
+        Error() << "Trade::VolumeBlob::deserialize(): data out of bounds for a blob of" << data.size() << "bytes";
+        return Containers::NullOpt;
+    }
+
+    VolumeBlob out;
+    out._format = PixelFormat(header.format);
+    out._formatExtra = header.formatExtra;
+    out._pixelSize = header.pixelSize;
+    out._size = size;
+    out._brickSize = brickSize;
+    out._border = header.border;
+    out._brickStride = std::size_t(header.brickStride);
+    out._data = data.slice(std::size_t(header.dataOffset), std::size_t(header.dataOffset + brickCount*header.brickStride));
+    return out;
+}
+
+ImageView3D VolumeBlob::brick(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < UnsignedInt(brickCount().product()),
+        "Trade::VolumeBlob::brick(): index" << id << "out of range for" << brickCount().product() << "bricks",
+        (ImageView3D{_format, {}, nullptr}));
+
+    const Vector3i size = storedBrickSize();
+    return ImageView3D{PixelStorage{}.setAlignment(1), _format, _formatExtra, _pixelSize, size,
+        _data.slice(id*_brickStride, id*_brickStride + std::size_t(size.product())*_pixelSize)};
+}
+
+ImageView3D VolumeBlob::brick(const Vector3i& coordinates) const {
+    CORRADE_ASSERT(coordinates.min() >= 0 && (coordinates < brickCount()).all(),
+        "Trade::VolumeBlob::brick(): coordinates" << coordinates << "out of range for" << brickCount() << "bricks",
+        (ImageView3D{_format, {}, nullptr}));
+
+    return brick(brickId(coordinates));
+}
+
+}}
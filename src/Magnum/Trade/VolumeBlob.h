@@ -0,0 +1,202 @@
+#ifndef Magnum_Trade_VolumeBlob_h
+#define Magnum_Trade_VolumeBlob_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::VolumeBlob
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Bricked volume blob
+
+A non-owning view on a 3D volume split into bricks of equal size, with each
+brick stored contiguously. Unlike an @ref ImageData3D, where the whole volume
+has to be loaded to access any part of it, a single brick can be accessed
+without touching the rest of the data, so volumes larger than available memory
+can be streamed from a memory-mapped file brick by brick, for example using
+@ref GL::VolumeBrickCache.
+
+The blob is created from an uncompressed @ref ImageView3D using
+@ref serialize(). Each brick includes a border of repeated voxels from its
+neighbors (or the edge voxels, at the volume boundary), so the bricks can be
+placed at arbitrary positions in a texture atlas and still be sampled with
+linear filtering without seams. The deserialization using @ref deserialize()
+only checks the header for consistency, the voxel data are never copied or
+parsed:
+
+@snippet MagnumTrade.cpp VolumeBlob-usage
+
+Because @ref serialize() writes the output through a sink brick by brick and
+reads only the voxels it needs, the conversion of large volumes can be done
+from a memory-mapped raw file directly to another file without having the
+whole blob in memory.
+
+@section Trade-VolumeBlob-format Binary format
+
+The blob consists of a 64-byte header followed by voxel data of all bricks,
+ordered with X being the fastest-changing coordinate. Each brick starts at an
+offset aligned to @ref Alignment bytes, its voxels are tightly packed with no
+row padding. All values are stored in the native byte order, the header
+contains a byte order mark and blobs with different byte order are rejected.
+*/
+class MAGNUM_TRADE_EXPORT VolumeBlob {
+    public:
+        enum: std::size_t {
+            /** Alignment of brick data in serialized blob */
+            Alignment = 64
+        };
+
+        /**
+         * @brief Serialize a volume into a bricked blob
+         * @param volume        Volume to serialize
+         * @param brickSize     Size of a brick, excluding the border
+         * @param border        Border size
+         * @param sink          Function consuming the output data
+         * @param userData      User data passed to @p sink
+         *
+         * Expects that @p volume has a non-zero size,
+         * that all @p brickSize components are positive and that @p border
+         * is not negative. Bricks at the end of each dimension are filled
+         * with repeated edge voxels if the volume size is not a multiple of
+         * @p brickSize. The output is passed to @p sink one brick at a time
+         * in the format described in @ref Trade-VolumeBlob-format. Returns
+         * @cpp false @ce if @p sink returned @cpp false @ce, which aborts
+         * the serialization, @cpp true @ce otherwise.
+         */
+        static bool serialize(const ImageView3D& volume, const Vector3i& brickSize, Int border, bool(*sink)(Containers::ArrayView<const char>, void*), void* userData = nullptr);
+
+        /**
+         * @brief Serialize a volume into a newly allocated array
+         *
+         * Same as @ref serialize(const ImageView3D&, const Vector3i&, Int, bool(*)(Containers::ArrayView<const char>, void*), void*),
+         * but returns the whole blob at once.
+         */
+        static Containers::Array<char> serialize(const ImageView3D& volume, const Vector3i& brickSize, Int border = 1);
+
+        /**
+         * @brief Deserialize a blob
+         *
+         * Checks the header for consistency and returns a view on the data.
+         * The @p data are expected to stay in scope for the whole lifetime
+         * of the returned instance. On failure prints a message to
+         * @ref Error and returns @ref Containers::NullOpt.
+         */
+        static Containers::Optional<VolumeBlob> deserialize(Containers::ArrayView<const char> data);
+
+        /** @brief Pixel format of the volume */
+        PixelFormat format() const { return _format; }
+
+        /**
+         * @brief Additional pixel format specifier
+         *
+         * See @ref ImageView::formatExtra() for more information.
+         */
+        UnsignedInt formatExtra() const { return _formatExtra; }
+
+        /** @brief Pixel size in bytes */
+        UnsignedInt pixelSize() const { return _pixelSize; }
+
+        /** @brief Volume size */
+        Vector3i size() const { return _size; }
+
+        /**
+         * @brief Brick size
+         *
+         * Excluding the border. The volume region covered by a brick at
+         * coordinates @f$ \boldsymbol{b} @f$ starts at
+         * @f$ \boldsymbol{b} \boldsymbol{s} @f$, where @f$ \boldsymbol{s} @f$
+         * is the brick size.
+         */
+        Vector3i brickSize() const { return _brickSize; }
+
+        /** @brief Border size */
+        Int border() const { return _border; }
+
+        /**
+         * @brief Stored brick size
+         *
+         * Brick size including the border on both sides, which is the size
+         * of images returned from @ref brick().
+         */
+        Vector3i storedBrickSize() const { return _brickSize + Vector3i{2*_border}; }
+
+        /** @brief Count of bricks in each dimension */
+        Vector3i brickCount() const {
+            return (_size + _brickSize - Vector3i{1})/_brickSize;
+        }
+
+        /**
+         * @brief Brick ID
+         *
+         * Linear brick index for given brick coordinates, with X being the
+         * fastest-changing coordinate.
+         */
+        UnsignedInt brickId(const Vector3i& coordinates) const {
+            const Vector3i count = brickCount();
+            return UnsignedInt((coordinates.z()*count.y() + coordinates.y())*count.x() + coordinates.x());
+        }
+
+        /**
+         * @brief Brick data
+         * @param id    Brick ID, from range [0, @ref brickCount()
+         *      @cpp .product() @ce)
+         *
+         * The image has a size of @ref storedBrickSize(), tightly packed with
+         * alignment set to @cpp 1 @ce.
+         * @see @ref brickId()
+         */
+        ImageView3D brick(UnsignedInt id) const;
+
+        /**
+         * @overload
+         *
+         * Expects that @p coordinates are in range of @ref brickCount().
+         */
+        ImageView3D brick(const Vector3i& coordinates) const;
+
+    private:
+        explicit VolumeBlob() noexcept = default;
+
+        PixelFormat _format;
+        UnsignedInt _formatExtra, _pixelSize;
+        Vector3i _size, _brickSize;
+        Int _border;
+        std::size_t _brickStride;
+        Containers::ArrayView<const char> _data;
+};
+
+}}
+
+#endif
@@ -23,9 +23,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/String.h>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
 
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Trade/AbstractImporter.h"
@@ -58,19 +65,23 @@ information.
 
 @code{.sh}
 magnum-imageconverter [-h|--help] [--importer IMPORTER] [--converter CONVERTER]
-    [--plugin-dir DIR] [--] input output
+    [--plugin-dir DIR] [--batch] [--threads N] [--] input output
 @endcode
 
 Arguments:
 
--   `input` --- input image
--   `output` --- output image
+-   `input` --- input image or a list of input/output pairs in batch mode
+-   `output` --- output image or an output directory in batch mode
 -   `-h`, `--help` --- display this help message and exit
 -   `--importer IMPORTER` --- image importer plugin (default:
     @ref Trade::AnyImageImporter "AnyImageImporter")
 -   `--converter CONVERTER` --- image converter plugin (default:
     @ref Trade::AnyImageConverter "AnyImageConverter")
 -   `--plugin-dir DIR` --- override base plugin dir
+-   `--batch` --- treat `input` as a list of files to convert, see
+    @ref magnum-imageconverter-batch below
+-   `--threads N` --- worker thread count in batch mode (default: `0`, which
+    means the hardware thread count)
 
 @section magnum-imageconverter-example Example usage
 
@@ -80,19 +91,74 @@ Converting a JPEG file to a PNG:
 magnum-imageconverter image.jpg image.png
 @endcode
 
+@section magnum-imageconverter-batch Batch mode
+
+Converting a large number of files one invocation at a time pays the process
+startup and plugin loading cost for every file. With `--batch`, the `input`
+argument is a text file containing one whitespace-separated input and output
+filename pair per line, empty lines and lines starting with `#` are ignored.
+Relative output filenames are taken relative to the `output` directory, which
+is created if it doesn't exist.
+
+The plugins are loaded just once and the files are distributed among a pool of
+worker threads, each having its own importer and converter instance. The
+utility converts all files even if some of them fail and returns a non-zero
+exit code if any conversion failed. On Emscripten the files are converted
+sequentially on the main thread.
+
+@code{.sh}
+find textures -name '*.jpg' | sed 's/\(.*\)\.jpg$/& \1.png/' > list.txt
+magnum-imageconverter --batch --threads 8 list.txt build/
+@endcode
+
 */
 
 }
 
 using namespace Magnum;
 
+namespace {
+
+/* Returns 0 on success, 3 if the input can't be opened and 4 if the output
+   can't be saved */
+int convert(Trade::AbstractImporter& importer, Trade::AbstractImageConverter& converter, const std::string& input, const std::string& output, std::mutex* debugMutex) {
+    /* Open input file */
+    Containers::Optional<Trade::ImageData2D> image;
+    if(!importer.openFile(input) || !(image = importer.image2D(0))) {
+        std::unique_lock<std::mutex> lock;
+        if(debugMutex) lock = std::unique_lock<std::mutex>{*debugMutex};
+        Error() << "Cannot open file" << input;
+        return 3;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock;
+        if(debugMutex) lock = std::unique_lock<std::mutex>{*debugMutex};
+        Debug() << "Converting image of size" << image->size() << "and format" << image->format() << "to" << output;
+    }
+
+    /* Save output file */
+    if(!converter.exportToFile(*image, output)) {
+        std::unique_lock<std::mutex> lock;
+        if(debugMutex) lock = std::unique_lock<std::mutex>{*debugMutex};
+        Error() << "Cannot save file" << output;
+        return 4;
+    }
+
+    return 0;
+}
+
+}
+
 int main(int argc, char** argv) {
     Utility::Arguments args;
-    args.addArgument("input").setHelp("input", "input image")
-        .addArgument("output").setHelp("output", "output image")
+    args.addArgument("input").setHelp("input", "input image or a list of input/output pairs in batch mode")
+        .addArgument("output").setHelp("output", "output image or an output directory in batch mode")
         .addOption("importer", "AnyImageImporter").setHelp("importer", "image importer plugin")
         .addOption("converter", "AnyImageConverter").setHelp("converter", "image converter plugin")
         .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
+        .addBooleanOption("batch").setHelp("batch", "treat input as a list of files to convert")
+        .addOption("threads", "0").setHelp("threads", "worker thread count in batch mode, 0 for hardware thread count", "N")
         .setHelp("Converts images of different formats.")
         .parse(argc, argv);
 
@@ -110,18 +176,78 @@ int main(int argc, char** argv) {
     std::unique_ptr<Trade::AbstractImageConverter> converter = converterManager.loadAndInstantiate(args.value("converter"));
     if(!converter) return 2;
 
-    /* Open input file */
-    Containers::Optional<Trade::ImageData2D> image;
-    if(!importer->openFile(args.value("input")) || !(image = importer->image2D(0))) {
-        Error() << "Cannot open file" << args.value("input");
-        return 3;
+    /* Single file */
+    if(!args.isSet("batch"))
+        return convert(*importer, *converter, args.value("input"), args.value("output"), nullptr);
+
+    /* Parse the file list */
+    if(!Utility::Directory::fileExists(args.value("input"))) {
+        Error() << "Cannot open file list" << args.value("input");
+        return 5;
+    }
+    std::vector<std::pair<std::string, std::string>> files;
+    {
+        const std::vector<std::string> lines = Utility::String::splitWithoutEmptyParts(Utility::Directory::readString(args.value("input")), '\n');
+        for(std::size_t i = 0; i != lines.size(); ++i) {
+            const std::vector<std::string> pair = Utility::String::splitWithoutEmptyParts(lines[i]);
+            if(pair.empty() || pair[0][0] == '#') continue;
+            if(pair.size() != 2) {
+                Error() << "Expected an input and output filename on line" << i + 1 << "of" << args.value("input") << "but got" << pair.size() << "items";
+                return 5;
+            }
+            files.emplace_back(pair[0], Utility::Directory::join(args.value("output"), pair[1]));
+        }
     }
 
-    Debug() << "Converting image of size" << image->size() << "and format" << image->format() << "to" << args.value("output");
+    if(!Utility::Directory::mkpath(args.value("output"))) {
+        Error() << "Cannot create output directory" << args.value("output");
+        return 5;
+    }
 
-    /* Save output file */
-    if(!converter->exportToFile(*image, args.value("output"))) {
-        Error() << "Cannot save file" << args.value("output");
-        return 4;
+    /* Worker count. The first importer/converter pair is already there. */
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::size_t threadCount = args.value<UnsignedInt>("threads");
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    threadCount = std::min(threadCount, std::max(files.size(), std::size_t{1}));
+    #else
+    const std::size_t threadCount = 1;
+    #endif
+
+    /* Each worker has its own plugin instances, as plugins are not meant to
+       be used from multiple threads at once. Instantiating them upfront on
+       the main thread also means the managers are never touched
+       concurrently. */
+    std::vector<std::unique_ptr<Trade::AbstractImporter>> importers;
+    std::vector<std::unique_ptr<Trade::AbstractImageConverter>> converters;
+    importers.push_back(std::move(importer));
+    converters.push_back(std::move(converter));
+    for(std::size_t i = 1; i < threadCount; ++i) {
+        importers.push_back(importerManager.instantiate(args.value("importer")));
+        converters.push_back(converterManager.instantiate(args.value("converter")));
     }
+
+    /* Hand out the files through a shared counter so slow files don't stall
+       a statically assigned range */
+    std::mutex debugMutex;
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> failed{0};
+    auto worker = [&](std::size_t id) {
+        for(std::size_t i; (i = next++) < files.size(); )
+            if(convert(*importers[id], *converters[id], files[i].first, files[i].second, &debugMutex))
+                ++failed;
+    };
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::vector<std::thread> threads;
+    for(std::size_t i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker, i);
+    worker(0);
+    for(std::thread& thread: threads) thread.join();
+    #else
+    worker(0);
+    #endif
+
+    Debug() << "Converted" << files.size() - failed.load() << "out of" << files.size() << "images using" << threadCount << "threads";
+
+    return failed ? 4 : 0;
 }
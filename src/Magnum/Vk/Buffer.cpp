@@ -0,0 +1,161 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Buffer.h"
+
+#include <cstring>
+#include <utility>
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/MemoryAllocator.h"
+#include "Magnum/Vk/Implementation/Assert.h"
+
+namespace Magnum { namespace Vk {
+
+BufferCreateInfo::BufferCreateInfo(const BufferUsages usages, const UnsignedLong size): _info{} {
+    _info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    _info.size = size;
+    _info.usage = VkBufferUsageFlags(usages);
+    _info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+}
+
+Buffer Buffer::wrap(Device& device, const VkBuffer handle, const HandleFlags flags) {
+    return Buffer{device, handle, flags};
+}
+
+Buffer::Buffer(Device& device, const BufferCreateInfo& info): _device{&device}, _flags{HandleFlag::DestroyOnDestruction}, _allocator{}, _memory{} {
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(device->CreateBuffer(device.handle(), &*info, nullptr, &_handle));
+}
+
+Buffer::Buffer(Device& device, const BufferCreateInfo& info, MemoryAllocator& allocator, const MemoryFlags memoryFlags): Buffer{device, info} {
+    _memory = allocator.allocate(memoryRequirements(), memoryFlags);
+    if(!_memory) return;
+
+    _allocator = &allocator;
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(device->BindBufferMemory(device.handle(), _handle, _memory.memory, _memory.offset));
+}
+
+Buffer::Buffer(NoCreateT) noexcept: _device{}, _handle{}, _flags{HandleFlag::DestroyOnDestruction}, _allocator{}, _memory{} {}
+
+Buffer::Buffer(Device& device, const VkBuffer handle, const HandleFlags flags) noexcept: _device{&device}, _handle{handle}, _flags{flags}, _allocator{}, _memory{} {}
+
+Buffer::Buffer(Buffer&& other) noexcept: _device{other._device}, _handle{other._handle}, _flags{other._flags}, _allocator{other._allocator}, _memory(other._memory) {
+    other._handle = {};
+    other._allocator = nullptr;
+    other._memory = {};
+}
+
+Buffer::~Buffer() {
+    if(_handle && (_flags & HandleFlag::DestroyOnDestruction))
+        (*_device)->DestroyBuffer(_device->handle(), _handle, nullptr);
+    if(_allocator) _allocator->free(_memory);
+}
+
+Buffer& Buffer::operator=(Buffer&& other) noexcept {
+    using std::swap;
+    swap(other._device, _device);
+    swap(other._handle, _handle);
+    swap(other._flags, _flags);
+    swap(other._allocator, _allocator);
+    swap(other._memory, _memory);
+    return *this;
+}
+
+VkMemoryRequirements Buffer::memoryRequirements() const {
+    VkMemoryRequirements requirements;
+    (*_device)->GetBufferMemoryRequirements(_device->handle(), _handle, &requirements);
+    return requirements;
+}
+
+void Buffer::bindMemory(const VkDeviceMemory memory, const UnsignedLong offset) {
+    CORRADE_ASSERT(!_memory,
+        "Vk::Buffer::bindMemory(): the buffer already has memory bound", );
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT((*_device)->BindBufferMemory(_device->handle(), _handle, memory, offset));
+}
+
+Containers::ArrayView<char> Buffer::data() {
+    CORRADE_ASSERT(_memory.data,
+        "Vk::Buffer::data(): the buffer doesn't own any host-visible memory", nullptr);
+    return {_memory.data, std::size_t(_memory.size)};
+}
+
+Buffer& Buffer::setData(const Containers::ArrayView<const void> data, const UnsignedLong offset) {
+    CORRADE_ASSERT(_memory.data,
+        "Vk::Buffer::setData(): the buffer doesn't own any host-visible memory", *this);
+    CORRADE_ASSERT(offset + data.size() <= _memory.size,
+        "Vk::Buffer::setData(): data of" << data.size() << "bytes at offset" << offset << "don't fit into" << _memory.size << "bytes", *this);
+    std::memcpy(_memory.data + offset, data.data(), data.size());
+    _allocator->flush(_memory, offset, data.size());
+    return *this;
+}
+
+void Buffer::flush() {
+    CORRADE_ASSERT(_allocator,
+        "Vk::Buffer::flush(): the buffer doesn't own any memory", );
+    _allocator->flush(_memory);
+}
+
+VkBuffer Buffer::release() {
+    const VkBuffer handle = _handle;
+    _handle = {};
+    return handle;
+}
+
+Debug& operator<<(Debug& debug, const BufferUsage value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case BufferUsage::value: return debug << "Vk::BufferUsage::" #value;
+        _c(TransferSource)
+        _c(TransferDestination)
+        _c(UniformTexelBuffer)
+        _c(StorageTexelBuffer)
+        _c(UniformBuffer)
+        _c(StorageBuffer)
+        _c(IndexBuffer)
+        _c(VertexBuffer)
+        _c(IndirectBuffer)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Vk::BufferUsage(" << Debug::nospace << reinterpret_cast<void*>(UnsignedInt(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const BufferUsages value) {
+    return Containers::enumSetDebugOutput(debug, value, "Vk::BufferUsages{}", {
+        BufferUsage::TransferSource,
+        BufferUsage::TransferDestination,
+        BufferUsage::UniformTexelBuffer,
+        BufferUsage::StorageTexelBuffer,
+        BufferUsage::UniformBuffer,
+        BufferUsage::StorageBuffer,
+        BufferUsage::IndexBuffer,
+        BufferUsage::VertexBuffer,
+        BufferUsage::IndirectBuffer});
+}
+
+}}
@@ -0,0 +1,293 @@
+#ifndef Magnum_Vk_Buffer_h
+#define Magnum_Vk_Buffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::BufferCreateInfo, @ref Magnum::Vk::Buffer, enum @ref Magnum::Vk::BufferUsage, enum set @ref Magnum::Vk::BufferUsages
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Handle.h"
+#include "Magnum/Vk/Memory.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Buffer usage
+
+Wraps @type_vk{BufferUsageFlagBits}.
+@see @ref BufferUsages, @ref BufferCreateInfo
+*/
+enum class BufferUsage: UnsignedInt {
+    /** Source of a transfer command */
+    TransferSource = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+
+    /** Destination of a transfer command */
+    TransferDestination = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+
+    /** Uniform texel buffer */
+    UniformTexelBuffer = VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT,
+
+    /** Storage texel buffer */
+    StorageTexelBuffer = VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT,
+
+    /** Uniform buffer */
+    UniformBuffer = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+
+    /** Storage buffer */
+    StorageBuffer = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+
+    /** Index buffer */
+    IndexBuffer = VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+
+    /** Vertex buffer */
+    VertexBuffer = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+
+    /** Source of indirect draw or dispatch parameters */
+    IndirectBuffer = VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT
+};
+
+/**
+@brief Buffer usages
+
+@see @ref BufferCreateInfo
+*/
+typedef Containers::EnumSet<BufferUsage> BufferUsages;
+
+CORRADE_ENUMSET_OPERATORS(BufferUsages)
+
+/** @debugoperatorenum{BufferUsage} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, BufferUsage value);
+
+/** @debugoperatorenum{BufferUsages} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, BufferUsages value);
+
+/**
+@brief Buffer creation info
+
+Wraps a @type_vk{BufferCreateInfo}. The buffer is created with exclusive
+sharing mode.
+@see @ref Buffer
+*/
+class MAGNUM_VK_EXPORT BufferCreateInfo {
+    public:
+        /**
+         * @brief Constructor
+         * @param usages    Buffer usages
+         * @param size      Buffer size in bytes
+         */
+        explicit BufferCreateInfo(BufferUsages usages, UnsignedLong size);
+
+        /** @brief Buffer usages */
+        BufferUsages usages() const { return BufferUsage(_info.usage); }
+
+        /** @brief Buffer size */
+        UnsignedLong size() const { return _info.size; }
+
+        /** @brief Underlying @type_vk{BufferCreateInfo} structure */
+        VkBufferCreateInfo& operator*() { return _info; }
+
+        /** @overload */
+        const VkBufferCreateInfo& operator*() const { return _info; }
+
+    private:
+        VkBufferCreateInfo _info;
+};
+
+/**
+@brief Buffer
+
+Wraps a @type_vk{Buffer}. A buffer created with just a @ref BufferCreateInfo
+has no memory bound and it's the user responsibility to bind some using
+@ref bindMemory(). Alternatively, the buffer can allocate its memory from a
+@ref MemoryAllocator, in which case it owns the allocation and frees it on
+destruction:
+
+@code{.cpp}
+Vk::Buffer vertices{device, Vk::BufferCreateInfo{Vk::BufferUsage::VertexBuffer,
+    data.size()}, allocator, Vk::MemoryFlag::HostVisible};
+vertices.setData(data);
+@endcode
+*/
+class MAGNUM_VK_EXPORT Buffer {
+    public:
+        /**
+         * @brief Wrap existing Vulkan buffer
+         * @param device    Device the buffer was created on
+         * @param handle    The @type_vk{Buffer} handle
+         * @param flags     Handle flags
+         *
+         * Unlike a buffer created using a constructor, the Vulkan buffer is
+         * by default not deleted on destruction, use @p flags for different
+         * behavior.
+         * @see @ref release()
+         */
+        static Buffer wrap(Device& device, VkBuffer handle, HandleFlags flags = {});
+
+        /**
+         * @brief Constructor
+         *
+         * Creates a buffer without any memory bound.
+         * @see @ref bindMemory(), @fn_vk{CreateBuffer}
+         */
+        explicit Buffer(Device& device, const BufferCreateInfo& info);
+
+        /**
+         * @brief Construct with allocating memory
+         * @param device        Device to create the buffer on
+         * @param info          Buffer creation info
+         * @param allocator     Allocator to allocate the memory from
+         * @param memoryFlags   Required memory flags
+         *
+         * Allocates memory with @ref MemoryAllocator::allocate() and binds
+         * it to the buffer. If the allocation fails, the buffer has no
+         * memory bound. The allocator is expected to stay alive for the
+         * whole buffer lifetime.
+         * @see @ref memory(), @fn_vk{CreateBuffer},
+         *      @fn_vk{BindBufferMemory}
+         */
+        explicit Buffer(Device& device, const BufferCreateInfo& info, MemoryAllocator& allocator, MemoryFlags memoryFlags);
+
+        /**
+         * @brief Construct without creating the buffer
+         *
+         * The constructed instance is equivalent to moved-from state. Move
+         * another object over it to make it useful.
+         */
+        explicit Buffer(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        Buffer(const Buffer&) = delete;
+
+        /** @brief Move constructor */
+        Buffer(Buffer&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys associated @type_vk{Buffer} object if it was created
+         * using a constructor or wrapped with
+         * @ref HandleFlag::DestroyOnDestruction and frees the memory
+         * allocation, if the buffer owns any.
+         * @see @fn_vk{DestroyBuffer}, @ref release()
+         */
+        ~Buffer();
+
+        /** @brief Copying is not allowed */
+        Buffer& operator=(const Buffer&) = delete;
+
+        /** @brief Move assignment */
+        Buffer& operator=(Buffer&& other) noexcept;
+
+        /** @brief Underlying @type_vk{Buffer} handle */
+        VkBuffer handle() { return _handle; }
+
+        /** @brief Handle flags */
+        HandleFlags handleFlags() const { return _flags; }
+
+        /**
+         * @brief Memory requirements
+         *
+         * @see @fn_vk{GetBufferMemoryRequirements}
+         */
+        VkMemoryRequirements memoryRequirements() const;
+
+        /**
+         * @brief Bind memory
+         *
+         * The memory isn't owned by the buffer and has to be kept alive for
+         * the whole buffer lifetime. Expects that no memory was bound yet.
+         * @see @fn_vk{BindBufferMemory}
+         */
+        void bindMemory(VkDeviceMemory memory, UnsignedLong offset);
+
+        /**
+         * @brief Memory allocation owned by the buffer
+         *
+         * Empty if the buffer was not constructed with a
+         * @ref MemoryAllocator or if the allocation failed.
+         */
+        const MemoryAllocation& memory() const { return _memory; }
+
+        /**
+         * @brief Mapped buffer data
+         *
+         * Expects that the buffer owns a @ref MemoryFlag::HostVisible
+         * allocation. Call @ref flush() after writing to memory that is not
+         * @ref MemoryFlag::HostCoherent.
+         */
+        Containers::ArrayView<char> data();
+
+        /**
+         * @brief Set buffer data
+         * @param data      Data to copy
+         * @param offset    Offset in the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Copies @p data to mapped memory and flushes the range if needed.
+         * Expects that the buffer owns a @ref MemoryFlag::HostVisible
+         * allocation and the range fits into it.
+         */
+        Buffer& setData(Containers::ArrayView<const void> data, UnsignedLong offset = 0);
+
+        /**
+         * @brief Flush host writes to owned memory
+         *
+         * Expects that the buffer owns a memory allocation.
+         * @see @ref MemoryAllocator::flush()
+         */
+        void flush();
+
+        /**
+         * @brief Release the underlying Vulkan buffer
+         *
+         * Releases ownership of the Vulkan buffer and returns its handle so
+         * @fn_vk{DestroyBuffer} is not called on destruction. An owned memory
+         * allocation is still freed on destruction. The internal state is
+         * then equivalent to moved-from state.
+         * @see @ref wrap()
+         */
+        VkBuffer release();
+
+    private:
+        explicit Buffer(Device& device, VkBuffer handle, HandleFlags flags) noexcept;
+
+        Device* _device;
+        VkBuffer _handle;
+        HandleFlags _flags;
+        MemoryAllocator* _allocator;
+        MemoryAllocation _memory;
+};
+
+}}
+
+#endif
@@ -0,0 +1,262 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CommandBuffer.h"
+
+#include <utility>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/Vk/Buffer.h"
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/Mesh.h"
+#include "Magnum/Vk/ParallelCommandBuffers.h"
+#include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/Implementation/Assert.h"
+
+namespace Magnum { namespace Vk {
+
+CommandBuffer::CommandBuffer(Device& device, const VkCommandPool pool, const VkCommandBuffer handle, const CommandBufferLevel level) noexcept: _functionPointers{&*device}, _device{device.handle()}, _pool{pool}, _handle{handle}, _level{level} {}
+
+CommandBuffer::CommandBuffer(NoCreateT) noexcept: _functionPointers{}, _device{}, _pool{}, _handle{}, _level{CommandBufferLevel::Primary} {}
+
+CommandBuffer::CommandBuffer(CommandBuffer&& other) noexcept: _functionPointers{other._functionPointers}, _device{other._device}, _pool{other._pool}, _handle{other._handle}, _level{other._level} {
+    other._handle = {};
+}
+
+CommandBuffer::~CommandBuffer() {
+    if(_handle) _functionPointers->FreeCommandBuffers(_device, _pool, 1, &_handle);
+}
+
+CommandBuffer& CommandBuffer::operator=(CommandBuffer&& other) noexcept {
+    using std::swap;
+    swap(other._functionPointers, _functionPointers);
+    swap(other._device, _device);
+    swap(other._pool, _pool);
+    swap(other._handle, _handle);
+    swap(other._level, _level);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::begin() {
+    CORRADE_ASSERT(_level == CommandBufferLevel::Primary,
+        "Vk::CommandBuffer::begin(): secondary command buffers need a render pass", *this);
+
+    VkCommandBufferBeginInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(_functionPointers->BeginCommandBuffer(_handle, &info));
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::begin(const VkRenderPass renderPass, const UnsignedInt subpass, const VkFramebuffer framebuffer) {
+    CORRADE_ASSERT(_level == CommandBufferLevel::Secondary,
+        "Vk::CommandBuffer::begin(): primary command buffers can't inherit a render pass", *this);
+
+    VkCommandBufferInheritanceInfo inheritanceInfo{};
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass = renderPass;
+    inheritanceInfo.subpass = subpass;
+    inheritanceInfo.framebuffer = framebuffer;
+
+    VkCommandBufferBeginInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    info.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    info.pInheritanceInfo = &inheritanceInfo;
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(_functionPointers->BeginCommandBuffer(_handle, &info));
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::end() {
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(_functionPointers->EndCommandBuffer(_handle));
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::reset() {
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(_functionPointers->ResetCommandBuffer(_handle, 0));
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::beginRenderPass(const VkRenderPass renderPass, const VkFramebuffer framebuffer, const Range2Di& area, const Containers::ArrayView<const VkClearValue> clearValues, const SubpassContents contents) {
+    VkRenderPassBeginInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    info.renderPass = renderPass;
+    info.framebuffer = framebuffer;
+    info.renderArea.offset = {area.left(), area.bottom()};
+    info.renderArea.extent = {UnsignedInt(area.sizeX()), UnsignedInt(area.sizeY())};
+    info.clearValueCount = clearValues.size();
+    info.pClearValues = clearValues.data();
+    _functionPointers->CmdBeginRenderPass(_handle, &info, VkSubpassContents(contents));
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::beginRenderPass(const VkRenderPass renderPass, const VkFramebuffer framebuffer, const Range2Di& area, std::initializer_list<VkClearValue> clearValues, const SubpassContents contents) {
+    return beginRenderPass(renderPass, framebuffer, area, Containers::arrayView(clearValues.begin(), clearValues.size()), contents);
+}
+
+CommandBuffer& CommandBuffer::endRenderPass() {
+    _functionPointers->CmdEndRenderPass(_handle);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setViewport(const Range2D& rectangle, const Float minDepth, const Float maxDepth) {
+    VkViewport viewport{};
+    viewport.x = rectangle.left();
+    viewport.y = rectangle.bottom();
+    viewport.width = rectangle.sizeX();
+    viewport.height = rectangle.sizeY();
+    viewport.minDepth = minDepth;
+    viewport.maxDepth = maxDepth;
+    _functionPointers->CmdSetViewport(_handle, 0, 1, &viewport);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setScissor(const Range2Di& rectangle) {
+    VkRect2D scissor{};
+    scissor.offset = {rectangle.left(), rectangle.bottom()};
+    scissor.extent = {UnsignedInt(rectangle.sizeX()), UnsignedInt(rectangle.sizeY())};
+    _functionPointers->CmdSetScissor(_handle, 0, 1, &scissor);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::bindPipeline(Pipeline& pipeline) {
+    _functionPointers->CmdBindPipeline(_handle, VkPipelineBindPoint(pipeline.bindPoint()), pipeline.handle());
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::pushConstants(PipelineLayout& layout, const ShaderStages stages, const UnsignedInt offset, const Containers::ArrayView<const void> data) {
+    _functionPointers->CmdPushConstants(_handle, layout.handle(), VkShaderStageFlags(stages), offset, data.size(), data.data());
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::bindVertexBuffer(const UnsignedInt binding, Buffer& buffer, const UnsignedLong offset) {
+    const VkBuffer handle = buffer.handle();
+    const VkDeviceSize deviceOffset = offset;
+    _functionPointers->CmdBindVertexBuffers(_handle, binding, 1, &handle, &deviceOffset);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::bindIndexBuffer(Buffer& buffer, const UnsignedLong offset, const MeshIndexType type) {
+    _functionPointers->CmdBindIndexBuffer(_handle, buffer.handle(), offset, vkIndexType(type));
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::draw(const UnsignedInt vertexCount, const UnsignedInt instanceCount, const UnsignedInt firstVertex, const UnsignedInt firstInstance) {
+    _functionPointers->CmdDraw(_handle, vertexCount, instanceCount, firstVertex, firstInstance);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::drawIndexed(const UnsignedInt indexCount, const UnsignedInt instanceCount, const UnsignedInt firstIndex, const Int vertexOffset, const UnsignedInt firstInstance) {
+    _functionPointers->CmdDrawIndexed(_handle, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::draw(Mesh& mesh) {
+    if(!mesh.count() || !mesh.instanceCount()) return *this;
+
+    for(std::size_t i = 0; i != mesh.vertexBufferCount(); ++i) {
+        const VkBuffer handle = mesh.vertexBuffer(i);
+        const VkDeviceSize offset = mesh.vertexBufferOffset(i);
+        _functionPointers->CmdBindVertexBuffers(_handle, mesh.vertexBufferBinding(i), 1, &handle, &offset);
+    }
+
+    if(mesh.isIndexed()) {
+        _functionPointers->CmdBindIndexBuffer(_handle, mesh.indexBuffer(), mesh.indexBufferOffset(), vkIndexType(mesh.indexType()));
+        _functionPointers->CmdDrawIndexed(_handle, mesh.count(), mesh.instanceCount(), 0, 0, 0);
+    } else _functionPointers->CmdDraw(_handle, mesh.count(), mesh.instanceCount(), 0, 0);
+
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::dispatch(const Vector3ui& count) {
+    _functionPointers->CmdDispatch(_handle, count.x(), count.y(), count.z());
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::copyBuffer(Buffer& source, Buffer& destination, const Containers::ArrayView<const VkBufferCopy> regions) {
+    _functionPointers->CmdCopyBuffer(_handle, source.handle(), destination.handle(), regions.size(), regions.data());
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::copyBuffer(Buffer& source, Buffer& destination, std::initializer_list<VkBufferCopy> regions) {
+    return copyBuffer(source, destination, Containers::arrayView(regions.begin(), regions.size()));
+}
+
+CommandBuffer& CommandBuffer::executeCommands(std::initializer_list<std::reference_wrapper<CommandBuffer>> commandBuffers) {
+    CORRADE_ASSERT(_level == CommandBufferLevel::Primary,
+        "Vk::CommandBuffer::executeCommands(): expected a primary command buffer", *this);
+
+    std::vector<VkCommandBuffer> handles;
+    handles.reserve(commandBuffers.size());
+    for(CommandBuffer& commandBuffer: commandBuffers) {
+        CORRADE_ASSERT(commandBuffer._level == CommandBufferLevel::Secondary,
+            "Vk::CommandBuffer::executeCommands(): expected only secondary command buffers", *this);
+        handles.push_back(commandBuffer._handle);
+    }
+
+    _functionPointers->CmdExecuteCommands(_handle, handles.size(), handles.data());
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::executeCommands(ParallelCommandBuffers& commandBuffers) {
+    CORRADE_ASSERT(_level == CommandBufferLevel::Primary,
+        "Vk::CommandBuffer::executeCommands(): expected a primary command buffer", *this);
+
+    std::vector<VkCommandBuffer> handles;
+    handles.reserve(commandBuffers.count());
+    for(UnsignedInt i = 0; i != commandBuffers.count(); ++i)
+        handles.push_back(commandBuffers[i]._handle);
+
+    _functionPointers->CmdExecuteCommands(_handle, handles.size(), handles.data());
+    return *this;
+}
+
+Debug& operator<<(Debug& debug, const CommandBufferLevel value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case CommandBufferLevel::value: return debug << "Vk::CommandBufferLevel::" #value;
+        _c(Primary)
+        _c(Secondary)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Vk::CommandBufferLevel(" << Debug::nospace << reinterpret_cast<void*>(Int(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const SubpassContents value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case SubpassContents::value: return debug << "Vk::SubpassContents::" #value;
+        _c(Inline)
+        _c(SecondaryCommandBuffers)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Vk::SubpassContents(" << Debug::nospace << reinterpret_cast<void*>(Int(value)) << Debug::nospace << ")";
+}
+
+}}
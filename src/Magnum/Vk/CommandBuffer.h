@@ -0,0 +1,341 @@
+#ifndef Magnum_Vk_CommandBuffer_h
+#define Magnum_Vk_CommandBuffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::CommandBuffer, enum @ref Magnum::Vk::CommandBufferLevel, @ref Magnum::Vk::SubpassContents
+ */
+
+#include <functional>
+#include <initializer_list>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/ShaderModule.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Command buffer level
+
+Wraps @type_vk{CommandBufferLevel}.
+@see @ref CommandPool::allocate()
+*/
+enum class CommandBufferLevel: Int {
+    /** Primary command buffer, can be submitted to a queue */
+    Primary = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+
+    /**
+     * Secondary command buffer, can be executed from a primary command
+     * buffer
+     */
+    Secondary = VK_COMMAND_BUFFER_LEVEL_SECONDARY
+};
+
+/** @debugoperatorenum{CommandBufferLevel} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, CommandBufferLevel value);
+
+/**
+@brief Subpass contents
+
+Wraps @type_vk{SubpassContents}.
+@see @ref CommandBuffer::beginRenderPass()
+*/
+enum class SubpassContents: Int {
+    /** Commands are recorded inline in the primary command buffer */
+    Inline = VK_SUBPASS_CONTENTS_INLINE,
+
+    /** Commands are executed from secondary command buffers */
+    SecondaryCommandBuffers = VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+};
+
+/** @debugoperatorenum{SubpassContents} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, SubpassContents value);
+
+/**
+@brief Command buffer
+
+Wraps a @type_vk{CommandBuffer}. Allocated using @ref CommandPool::allocate()
+and freed back to the pool on destruction. A command buffer is expected to be
+used only from a single thread at a time together with the pool it was
+allocated from, see @ref Vk-CommandPool-multithreading for more information.
+
+@code{.cpp}
+Vk::CommandBuffer commands = pool.allocate();
+commands.begin()
+    .beginRenderPass(renderPass, framebuffer, {{}, size}, {clearColor})
+    .bindPipeline(pipeline)
+    .setViewport({{}, Vector2{size}})
+    .setScissor({{}, size})
+    .draw(mesh)
+    .endRenderPass()
+    .end();
+queue.submit(commands);
+@endcode
+*/
+class MAGNUM_VK_EXPORT CommandBuffer {
+    friend CommandPool;
+
+    public:
+        /**
+         * @brief Construct without allocating the command buffer
+         *
+         * The constructed instance is equivalent to moved-from state. Move
+         * another object over it to make it useful.
+         */
+        explicit CommandBuffer(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        CommandBuffer(const CommandBuffer&) = delete;
+
+        /** @brief Move constructor */
+        CommandBuffer(CommandBuffer&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees the command buffer back to the pool it was allocated from.
+         * @see @fn_vk{FreeCommandBuffers}
+         */
+        ~CommandBuffer();
+
+        /** @brief Copying is not allowed */
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        /** @brief Move assignment */
+        CommandBuffer& operator=(CommandBuffer&& other) noexcept;
+
+        /** @brief Underlying @type_vk{CommandBuffer} handle */
+        VkCommandBuffer handle() { return _handle; }
+
+        /** @brief Command buffer level */
+        CommandBufferLevel level() const { return _level; }
+
+        /**
+         * @brief Begin recording a primary command buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the command buffer is primary.
+         * @see @fn_vk{BeginCommandBuffer}
+         */
+        CommandBuffer& begin();
+
+        /**
+         * @brief Begin recording a secondary command buffer
+         * @param renderPass    Render pass the commands will be executed in
+         * @param subpass       Subpass index
+         * @param framebuffer   Framebuffer the commands will be rendering to
+         *      or @cpp VK_NULL_HANDLE @ce if not known
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the command buffer is secondary. The commands are
+         * expected to be executed entirely inside @p renderPass.
+         * @see @fn_vk{BeginCommandBuffer}
+         */
+        CommandBuffer& begin(VkRenderPass renderPass, UnsignedInt subpass, VkFramebuffer framebuffer = VK_NULL_HANDLE);
+
+        /**
+         * @brief End recording
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{EndCommandBuffer}
+         */
+        CommandBuffer& end();
+
+        /**
+         * @brief Reset the command buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the pool was created with
+         * @ref CommandPoolFlag::ResetCommandBuffer.
+         * @see @fn_vk{ResetCommandBuffer}
+         */
+        CommandBuffer& reset();
+
+        /**
+         * @brief Begin a render pass
+         * @param renderPass        Render pass
+         * @param framebuffer       Framebuffer
+         * @param area              Render area
+         * @param clearValues       Clear values for attachments that are
+         *      cleared on load
+         * @param contents          How are commands in the first subpass
+         *      provided
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{CmdBeginRenderPass}
+         */
+        CommandBuffer& beginRenderPass(VkRenderPass renderPass, VkFramebuffer framebuffer, const Range2Di& area, Containers::ArrayView<const VkClearValue> clearValues = nullptr, SubpassContents contents = SubpassContents::Inline);
+
+        /** @overload */
+        CommandBuffer& beginRenderPass(VkRenderPass renderPass, VkFramebuffer framebuffer, const Range2Di& area, std::initializer_list<VkClearValue> clearValues, SubpassContents contents = SubpassContents::Inline);
+
+        /**
+         * @brief End a render pass
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{CmdEndRenderPass}
+         */
+        CommandBuffer& endRenderPass();
+
+        /**
+         * @brief Set viewport
+         * @return Reference to self (for method chaining)
+         *
+         * Pipelines created from @ref GraphicsPipelineCreateInfo have the
+         * viewport dynamic, so this needs to be called before drawing.
+         * @see @fn_vk{CmdSetViewport}
+         */
+        CommandBuffer& setViewport(const Range2D& rectangle, Float minDepth = 0.0f, Float maxDepth = 1.0f);
+
+        /**
+         * @brief Set scissor rectangle
+         * @return Reference to self (for method chaining)
+         *
+         * Pipelines created from @ref GraphicsPipelineCreateInfo have the
+         * scissor dynamic, so this needs to be called before drawing.
+         * @see @fn_vk{CmdSetScissor}
+         */
+        CommandBuffer& setScissor(const Range2Di& rectangle);
+
+        /**
+         * @brief Bind a pipeline
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{CmdBindPipeline}
+         */
+        CommandBuffer& bindPipeline(Pipeline& pipeline);
+
+        /**
+         * @brief Push constants
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{CmdPushConstants}
+         */
+        CommandBuffer& pushConstants(PipelineLayout& layout, ShaderStages stages, UnsignedInt offset, Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Bind a vertex buffer
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{CmdBindVertexBuffers}
+         */
+        CommandBuffer& bindVertexBuffer(UnsignedInt binding, Buffer& buffer, UnsignedLong offset = 0);
+
+        /**
+         * @brief Bind an index buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p type is not @ref MeshIndexType::UnsignedByte, as
+         * that's not supported by Vulkan.
+         * @see @fn_vk{CmdBindIndexBuffer}
+         */
+        CommandBuffer& bindIndexBuffer(Buffer& buffer, UnsignedLong offset, MeshIndexType type);
+
+        /**
+         * @brief Draw non-indexed primitives
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{CmdDraw}
+         */
+        CommandBuffer& draw(UnsignedInt vertexCount, UnsignedInt instanceCount = 1, UnsignedInt firstVertex = 0, UnsignedInt firstInstance = 0);
+
+        /**
+         * @brief Draw indexed primitives
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{CmdDrawIndexed}
+         */
+        CommandBuffer& drawIndexed(UnsignedInt indexCount, UnsignedInt instanceCount = 1, UnsignedInt firstIndex = 0, Int vertexOffset = 0, UnsignedInt firstInstance = 0);
+
+        /**
+         * @brief Draw a mesh
+         * @return Reference to self (for method chaining)
+         *
+         * Binds all vertex buffers and the index buffer of @p mesh, if any,
+         * and issues either @ref draw() or @ref drawIndexed() with
+         * @ref Mesh::count() and @ref Mesh::instanceCount(). Does nothing if
+         * the count is zero. A pipeline created with a compatible
+         * @ref MeshLayout is expected to be bound.
+         */
+        CommandBuffer& draw(Mesh& mesh);
+
+        /**
+         * @brief Dispatch compute work
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{CmdDispatch}
+         */
+        CommandBuffer& dispatch(const Vector3ui& count);
+
+        /**
+         * @brief Copy buffer data
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{CmdCopyBuffer}
+         */
+        CommandBuffer& copyBuffer(Buffer& source, Buffer& destination, Containers::ArrayView<const VkBufferCopy> regions);
+
+        /** @overload */
+        CommandBuffer& copyBuffer(Buffer& source, Buffer& destination, std::initializer_list<VkBufferCopy> regions);
+
+        /**
+         * @brief Execute secondary command buffers
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that this is a primary command buffer and all
+         * @p commandBuffers are secondary.
+         * @see @fn_vk{CmdExecuteCommands}
+         */
+        CommandBuffer& executeCommands(std::initializer_list<std::reference_wrapper<CommandBuffer>> commandBuffers);
+
+        /**
+         * @brief Execute secondary command buffers recorded in parallel
+         * @return Reference to self (for method chaining)
+         *
+         * Executes all command buffers in @p commandBuffers in order.
+         * Expects that this is a primary command buffer.
+         * @see @fn_vk{CmdExecuteCommands}
+         */
+        CommandBuffer& executeCommands(ParallelCommandBuffers& commandBuffers);
+
+    private:
+        explicit CommandBuffer(Device& device, VkCommandPool pool, VkCommandBuffer handle, CommandBufferLevel level) noexcept;
+
+        const FlextVkDevice* _functionPointers;
+        VkDevice _device;
+        VkCommandPool _pool;
+        VkCommandBuffer _handle;
+        CommandBufferLevel _level;
+};
+
+}}
+
+#endif
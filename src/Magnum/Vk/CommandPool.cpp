@@ -0,0 +1,98 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CommandPool.h"
+
+#include <utility>
+#include <Corrade/Containers/EnumSet.hpp>
+
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/Implementation/Assert.h"
+
+namespace Magnum { namespace Vk {
+
+CommandPool::CommandPool(Device& device, const UnsignedInt queueFamily, const CommandPoolFlags flags): _device{&device}, _flags{HandleFlag::DestroyOnDestruction} {
+    VkCommandPoolCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    info.flags = VkCommandPoolCreateFlags(flags);
+    info.queueFamilyIndex = queueFamily;
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(device->CreateCommandPool(device.handle(), &info, nullptr, &_handle));
+}
+
+CommandPool::CommandPool(NoCreateT) noexcept: _device{}, _handle{}, _flags{HandleFlag::DestroyOnDestruction} {}
+
+CommandPool::CommandPool(CommandPool&& other) noexcept: _device{other._device}, _handle{other._handle}, _flags{other._flags} {
+    other._handle = {};
+}
+
+CommandPool::~CommandPool() {
+    if(_handle && (_flags & HandleFlag::DestroyOnDestruction))
+        (*_device)->DestroyCommandPool(_device->handle(), _handle, nullptr);
+}
+
+CommandPool& CommandPool::operator=(CommandPool&& other) noexcept {
+    using std::swap;
+    swap(other._device, _device);
+    swap(other._handle, _handle);
+    swap(other._flags, _flags);
+    return *this;
+}
+
+CommandBuffer CommandPool::allocate(const CommandBufferLevel level) {
+    VkCommandBufferAllocateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    info.commandPool = _handle;
+    info.level = VkCommandBufferLevel(level);
+    info.commandBufferCount = 1;
+
+    VkCommandBuffer handle;
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT((*_device)->AllocateCommandBuffers(_device->handle(), &info, &handle));
+    return CommandBuffer{*_device, _handle, handle, level};
+}
+
+void CommandPool::reset() {
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT((*_device)->ResetCommandPool(_device->handle(), _handle, 0));
+}
+
+Debug& operator<<(Debug& debug, const CommandPoolFlag value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case CommandPoolFlag::value: return debug << "Vk::CommandPoolFlag::" #value;
+        _c(Transient)
+        _c(ResetCommandBuffer)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Vk::CommandPoolFlag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedInt(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const CommandPoolFlags value) {
+    return Containers::enumSetDebugOutput(debug, value, "Vk::CommandPoolFlags{}", {
+        CommandPoolFlag::Transient,
+        CommandPoolFlag::ResetCommandBuffer});
+}
+
+}}
@@ -0,0 +1,175 @@
+#ifndef Magnum_Vk_CommandPool_h
+#define Magnum_Vk_CommandPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::CommandPool, enum @ref Magnum::Vk::CommandPoolFlag, enum set @ref Magnum::Vk::CommandPoolFlags
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/Handle.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Command pool creation flag
+
+Wraps @type_vk{CommandPoolCreateFlagBits}.
+@see @ref CommandPoolFlags, @ref CommandPool
+*/
+enum class CommandPoolFlag: UnsignedInt {
+    /** Command buffers allocated from the pool are short-lived */
+    Transient = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+
+    /**
+     * Command buffers allocated from the pool can be individually reset
+     * using @ref CommandBuffer::reset()
+     */
+    ResetCommandBuffer = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT
+};
+
+/**
+@brief Command pool creation flags
+
+@see @ref CommandPool
+*/
+typedef Containers::EnumSet<CommandPoolFlag> CommandPoolFlags;
+
+CORRADE_ENUMSET_OPERATORS(CommandPoolFlags)
+
+/** @debugoperatorenum{CommandPoolFlag} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, CommandPoolFlag value);
+
+/** @debugoperatorenum{CommandPoolFlags} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, CommandPoolFlags value);
+
+/**
+@brief Command pool
+
+Wraps a @type_vk{CommandPool}, from which @ref CommandBuffer instances are
+allocated.
+
+@section Vk-CommandPool-multithreading Recording from multiple threads
+
+A command pool and all command buffers allocated from it have to be
+externally synchronized, so to record commands in parallel, create one pool
+per thread. Commands recorded in each thread can be then either submitted
+directly to a @ref Queue, which is internally synchronized, or recorded into
+secondary command buffers and executed from a primary one using
+@ref CommandBuffer::executeCommands():
+
+@code{.cpp}
+std::vector<Vk::CommandPool> pools;
+for(std::size_t i = 0; i != threadCount; ++i)
+    pools.emplace_back(device, graphicsFamily, Vk::CommandPoolFlag::Transient);
+
+// in each thread
+Vk::CommandBuffer commands = pools[thread].allocate(Vk::CommandBufferLevel::Secondary);
+commands.begin(renderPass, 0, framebuffer);
+commands.draw(meshes[thread]);
+commands.end();
+@endcode
+
+See also @ref Vk-Device-multithreading.
+*/
+class MAGNUM_VK_EXPORT CommandPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param device        Device to create the pool on
+         * @param queueFamily   Family of queues the command buffers will be
+         *      submitted to
+         * @param flags         Creation flags
+         *
+         * @see @fn_vk{CreateCommandPool}
+         */
+        explicit CommandPool(Device& device, UnsignedInt queueFamily, CommandPoolFlags flags = {});
+
+        /**
+         * @brief Construct without creating the pool
+         *
+         * The constructed instance is equivalent to moved-from state. Move
+         * another object over it to make it useful.
+         */
+        explicit CommandPool(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        CommandPool(const CommandPool&) = delete;
+
+        /** @brief Move constructor */
+        CommandPool(CommandPool&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys associated @type_vk{CommandPool} object, which implicitly
+         * frees all command buffers allocated from it. The command buffers
+         * are expected to be destroyed before.
+         * @see @fn_vk{DestroyCommandPool}
+         */
+        ~CommandPool();
+
+        /** @brief Copying is not allowed */
+        CommandPool& operator=(const CommandPool&) = delete;
+
+        /** @brief Move assignment */
+        CommandPool& operator=(CommandPool&& other) noexcept;
+
+        /** @brief Underlying @type_vk{CommandPool} handle */
+        VkCommandPool handle() { return _handle; }
+
+        /** @brief Handle flags */
+        HandleFlags handleFlags() const { return _flags; }
+
+        /**
+         * @brief Allocate a command buffer
+         *
+         * @see @fn_vk{AllocateCommandBuffers}
+         */
+        CommandBuffer allocate(CommandBufferLevel level = CommandBufferLevel::Primary);
+
+        /**
+         * @brief Reset the pool
+         *
+         * Resets all command buffers allocated from the pool to the initial
+         * state.
+         * @see @fn_vk{ResetCommandPool}
+         */
+        void reset();
+
+    private:
+        Device* _device;
+        VkCommandPool _handle;
+        HandleFlags _flags;
+};
+
+}}
+
+#endif
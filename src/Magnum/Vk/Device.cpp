@@ -0,0 +1,148 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Device.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Vk/Instance.h"
+#include "Magnum/Vk/Queue.h"
+#include "Magnum/Vk/Implementation/Assert.h"
+
+namespace Magnum { namespace Vk {
+
+DeviceCreateInfo::DeviceCreateInfo(const DeviceProperties& properties): _properties{properties} {}
+
+DeviceCreateInfo& DeviceCreateInfo::addQueues(const UnsignedInt family, std::initializer_list<Float> priorities) {
+    CORRADE_ASSERT(family < _properties.queueFamilyCount(),
+        "Vk::DeviceCreateInfo::addQueues(): family" << family << "out of range for" << _properties.queueFamilyCount() << "families", *this);
+    CORRADE_ASSERT(priorities.size(),
+        "Vk::DeviceCreateInfo::addQueues(): at least one queue priority has to be specified", *this);
+    CORRADE_ASSERT(priorities.size() <= _properties.queueFamilySize(family),
+        "Vk::DeviceCreateInfo::addQueues(): family" << family << "has only" << _properties.queueFamilySize(family) << "queues, got" << priorities.size() << "priorities", *this);
+    #ifndef CORRADE_NO_ASSERT
+    for(const auto& queue: _queues)
+        CORRADE_ASSERT(queue.first != family,
+            "Vk::DeviceCreateInfo::addQueues(): family" << family << "already added", *this);
+    #endif
+
+    _queues.emplace_back(family, std::vector<Float>{priorities});
+    return *this;
+}
+
+DeviceCreateInfo& DeviceCreateInfo::addEnabledExtensions(std::initializer_list<std::string> extensions) {
+    _extensions.insert(_extensions.end(), extensions);
+    return *this;
+}
+
+Device::Device(Instance& instance, const DeviceCreateInfo& info): _flags{HandleFlag::DestroyOnDestruction}, _properties{info.properties()}, _functionPointers{new FlextVkDevice{}} {
+    CORRADE_ASSERT(!info.queues().empty(),
+        "Vk::Device: at least one queue has to be added", );
+
+    std::vector<VkDeviceQueueCreateInfo> queueInfos;
+    queueInfos.reserve(info.queues().size());
+    for(const auto& queue: info.queues()) {
+        VkDeviceQueueCreateInfo queueInfo{};
+        queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueInfo.queueFamilyIndex = queue.first;
+        queueInfo.queueCount = queue.second.size();
+        queueInfo.pQueuePriorities = queue.second.data();
+        queueInfos.push_back(queueInfo);
+    }
+
+    std::vector<const char*> extensions;
+    extensions.reserve(info.enabledExtensions().size());
+    for(const std::string& extension: info.enabledExtensions())
+        extensions.push_back(extension.data());
+
+    VkDeviceCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    createInfo.queueCreateInfoCount = queueInfos.size();
+    createInfo.pQueueCreateInfos = queueInfos.data();
+    createInfo.enabledExtensionCount = extensions.size();
+    createInfo.ppEnabledExtensionNames = extensions.data();
+
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(instance->CreateDevice(_properties.handle(), &createInfo, nullptr, &_handle));
+    flextVkInitDevice(_handle, _functionPointers.get(), instance->GetDeviceProcAddr);
+
+    /* Retrieve all queues upfront so queue() is just a lookup that's safe to
+       call from multiple threads */
+    _queues.reserve(info.queues().size());
+    for(const auto& queue: info.queues()) {
+        _queues.emplace_back();
+        _queues.back().first = queue.first;
+        for(UnsignedInt i = 0; i != queue.second.size(); ++i) {
+            VkQueue handle;
+            _functionPointers->GetDeviceQueue(_handle, queue.first, i, &handle);
+            _queues.back().second.emplace_back(new Queue{*_functionPointers, handle, queue.first});
+        }
+    }
+}
+
+Device::Device(NoCreateT): _handle{}, _flags{HandleFlag::DestroyOnDestruction}, _properties{NoCreate} {}
+
+Device::Device(Device&& other) noexcept: _handle{other._handle}, _flags{other._flags}, _properties{std::move(other._properties)}, _functionPointers{std::move(other._functionPointers)}, _queues{std::move(other._queues)} {
+    other._handle = {};
+}
+
+Device::~Device() {
+    if(_handle && (_flags & HandleFlag::DestroyOnDestruction))
+        _functionPointers->DestroyDevice(_handle, nullptr);
+}
+
+Device& Device::operator=(Device&& other) noexcept {
+    using std::swap;
+    swap(other._handle, _handle);
+    swap(other._flags, _flags);
+    swap(other._properties, _properties);
+    swap(other._functionPointers, _functionPointers);
+    swap(other._queues, _queues);
+    return *this;
+}
+
+Queue& Device::queue(const UnsignedInt family, const UnsignedInt index) {
+    for(auto& queues: _queues) {
+        if(queues.first != family) continue;
+        CORRADE_ASSERT(index < queues.second.size(),
+            "Vk::Device::queue(): index" << index << "out of range for" << queues.second.size() << "queues in family" << family, *queues.second.front());
+        return *queues.second[index];
+    }
+
+    CORRADE_ASSERT(false,
+        "Vk::Device::queue(): family" << family << "was not added on device creation", *_queues.front().second.front());
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void Device::waitIdle() {
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(_functionPointers->DeviceWaitIdle(_handle));
+}
+
+VkDevice Device::release() {
+    const VkDevice handle = _handle;
+    _handle = {};
+    return handle;
+}
+
+}}
@@ -0,0 +1,223 @@
+#ifndef Magnum_Vk_Device_h
+#define Magnum_Vk_Device_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::DeviceCreateInfo, @ref Magnum::Vk::Device
+ */
+
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Handle.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Device creation info
+
+@see @ref Device
+*/
+class MAGNUM_VK_EXPORT DeviceCreateInfo {
+    public:
+        /**
+         * @brief Constructor
+         * @param properties    Physical device to create the device on
+         *
+         * No queues or extensions are enabled by default. At least one queue
+         * has to be added with @ref addQueues() in order to create a device.
+         */
+        explicit DeviceCreateInfo(const DeviceProperties& properties);
+
+        /** @brief Physical device properties */
+        const DeviceProperties& properties() const { return _properties; }
+
+        /**
+         * @brief Add queues
+         * @param family        Queue family index
+         * @param priorities    Queue priorities in range @f$ [0, 1] @f$.
+         *      Size of the list is the count of queues created in given
+         *      family.
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p family is less than
+         * @ref DeviceProperties::queueFamilyCount(), that @p priorities is
+         * not empty and the family has at least that many queues. Each
+         * family can be added just once. The queues can be then retrieved
+         * using @ref Device::queue().
+         */
+        DeviceCreateInfo& addQueues(UnsignedInt family, std::initializer_list<Float> priorities);
+
+        /** @brief Added queue families and their priorities */
+        const std::vector<std::pair<UnsignedInt, std::vector<Float>>>& queues() const { return _queues; }
+
+        /**
+         * @brief Add enabled extensions
+         * @return Reference to self (for method chaining)
+         */
+        DeviceCreateInfo& addEnabledExtensions(std::initializer_list<std::string> extensions);
+
+        /** @brief Enabled extensions */
+        const std::vector<std::string>& enabledExtensions() const { return _extensions; }
+
+    private:
+        DeviceProperties _properties;
+        std::vector<std::pair<UnsignedInt, std::vector<Float>>> _queues;
+        std::vector<std::string> _extensions;
+};
+
+/**
+@brief Device
+
+Wraps a @type_vk{Device}. Similarly to @ref Instance, each device keeps its
+own table of device-level function pointers accessible through
+@ref operator->(), so calls made through it bypass the loader dispatch and
+there's no global state. The table is allocated on heap so its address stays
+stable when the device is moved, which allows @ref Queue, @ref Buffer,
+@ref CommandBuffer and other objects to refer to it.
+
+@code{.cpp}
+Vk::Instance instance;
+Vk::DeviceProperties properties = *Vk::pickDevice(instance);
+UnsignedInt graphics = *properties.pickQueueFamily(Vk::QueueFlag::Graphics);
+
+Vk::Device device{instance, Vk::DeviceCreateInfo{properties}
+    .addQueues(graphics, {0.0f})};
+Vk::Queue& queue = device.queue(graphics, 0);
+@endcode
+
+@section Vk-Device-multithreading Multithreading
+
+Unlike the GL library, where all commands are submitted through a single
+context bound to a single thread, a Vulkan device can be used from any number
+of threads at the same time and the application is responsible only for
+synchronizing access to objects that are not internally synchronized. In this
+library, a @ref Queue is internally synchronized and the
+@ref MemoryAllocator is thread-safe, while a @ref CommandPool and command
+buffers allocated from it are expected to be used by a single thread at a
+time. The recommended workflow is thus to have one command pool per thread,
+record command buffers in parallel and then submit them from any thread.
+*/
+class MAGNUM_VK_EXPORT Device {
+    public:
+        /**
+         * @brief Constructor
+         * @param instance  Vulkan instance
+         * @param info      Device creation info
+         *
+         * Expects that at least one queue was added to @p info.
+         * @see @fn_vk{CreateDevice}, @fn_vk{GetDeviceQueue}
+         */
+        explicit Device(Instance& instance, const DeviceCreateInfo& info);
+
+        /**
+         * @brief Construct without creating the device
+         *
+         * The constructed instance is equivalent to moved-from state. Move
+         * another object over it to make it useful.
+         */
+        explicit Device(NoCreateT);
+
+        /** @brief Copying is not allowed */
+        Device(const Device&) = delete;
+
+        /** @brief Move constructor */
+        Device(Device&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys associated @type_vk{Device} object. All objects created
+         * from the device are expected to be destroyed at this point.
+         * @see @fn_vk{DestroyDevice}, @ref release()
+         */
+        ~Device();
+
+        /** @brief Copying is not allowed */
+        Device& operator=(const Device&) = delete;
+
+        /** @brief Move assignment */
+        Device& operator=(Device&& other) noexcept;
+
+        /** @brief Underlying @type_vk{Device} handle */
+        VkDevice handle() { return _handle; }
+
+        /** @brief Handle flags */
+        HandleFlags handleFlags() const { return _flags; }
+
+        /** @brief Properties of the physical device */
+        const DeviceProperties& properties() const { return _properties; }
+
+        /** @brief Device-specific Vulkan function pointers */
+        const FlextVkDevice& operator*() const { return *_functionPointers; }
+
+        /** @overload */
+        const FlextVkDevice* operator->() const { return _functionPointers.get(); }
+
+        /**
+         * @brief Queue
+         * @param family    Queue family index
+         * @param index     Queue index in given family
+         *
+         * Expects that the queue was added with
+         * @ref DeviceCreateInfo::addQueues() when creating the device.
+         */
+        Queue& queue(UnsignedInt family, UnsignedInt index);
+
+        /**
+         * @brief Wait for the device to become idle
+         *
+         * @see @fn_vk{DeviceWaitIdle}
+         */
+        void waitIdle();
+
+        /**
+         * @brief Release the underlying Vulkan device
+         *
+         * Releases ownership of the Vulkan device and returns its handle so
+         * @fn_vk{DestroyDevice} is not called on destruction. The internal
+         * state is then equivalent to moved-from state.
+         */
+        VkDevice release();
+
+    private:
+        VkDevice _handle;
+        HandleFlags _flags;
+        DeviceProperties _properties;
+        std::unique_ptr<FlextVkDevice> _functionPointers;
+        std::vector<std::pair<UnsignedInt, std::vector<std::unique_ptr<Queue>>>> _queues;
+};
+
+}}
+
+#endif
@@ -0,0 +1,162 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DeviceProperties.h"
+
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Vk/Instance.h"
+#include "Magnum/Vk/Implementation/Assert.h"
+
+namespace Magnum { namespace Vk {
+
+DeviceProperties DeviceProperties::wrap(Instance& instance, const VkPhysicalDevice handle) {
+    return DeviceProperties{instance, handle};
+}
+
+DeviceProperties::DeviceProperties(NoCreateT) noexcept: _handle{}, _properties{}, _memoryProperties{} {}
+
+DeviceProperties::DeviceProperties(Instance& instance, const VkPhysicalDevice handle): _handle{handle} {
+    instance->GetPhysicalDeviceProperties(handle, &_properties);
+    instance->GetPhysicalDeviceMemoryProperties(handle, &_memoryProperties);
+
+    UnsignedInt count;
+    instance->GetPhysicalDeviceQueueFamilyProperties(handle, &count, nullptr);
+    _queueFamilyProperties.resize(count);
+    instance->GetPhysicalDeviceQueueFamilyProperties(handle, &count, _queueFamilyProperties.data());
+}
+
+std::string DeviceProperties::name() const {
+    return _properties.deviceName;
+}
+
+UnsignedInt DeviceProperties::queueFamilySize(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _queueFamilyProperties.size(),
+        "Vk::DeviceProperties::queueFamilySize(): index" << id << "out of range for" << _queueFamilyProperties.size() << "entries", {});
+    return _queueFamilyProperties[id].queueCount;
+}
+
+QueueFlags DeviceProperties::queueFamilyFlags(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _queueFamilyProperties.size(),
+        "Vk::DeviceProperties::queueFamilyFlags(): index" << id << "out of range for" << _queueFamilyProperties.size() << "entries", {});
+    return QueueFlag(_queueFamilyProperties[id].queueFlags);
+}
+
+Containers::Optional<UnsignedInt> DeviceProperties::pickQueueFamily(const QueueFlags flags) const {
+    for(std::size_t i = 0; i != _queueFamilyProperties.size(); ++i)
+        if((QueueFlags(QueueFlag(_queueFamilyProperties[i].queueFlags)) & flags) == flags)
+            return UnsignedInt(i);
+    return Containers::NullOpt;
+}
+
+MemoryFlags DeviceProperties::memoryFlags(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _memoryProperties.memoryTypeCount,
+        "Vk::DeviceProperties::memoryFlags(): index" << id << "out of range for" << _memoryProperties.memoryTypeCount << "memory types", {});
+    return MemoryFlag(_memoryProperties.memoryTypes[id].propertyFlags);
+}
+
+UnsignedLong DeviceProperties::memoryHeapSize(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _memoryProperties.memoryTypeCount,
+        "Vk::DeviceProperties::memoryHeapSize(): index" << id << "out of range for" << _memoryProperties.memoryTypeCount << "memory types", {});
+    return _memoryProperties.memoryHeaps[_memoryProperties.memoryTypes[id].heapIndex].size;
+}
+
+Containers::Optional<UnsignedInt> DeviceProperties::pickMemory(const MemoryFlags flags, const UnsignedInt memories) const {
+    for(UnsignedInt i = 0; i != _memoryProperties.memoryTypeCount; ++i) {
+        if(!(memories & (1u << i))) continue;
+        if((MemoryFlags(MemoryFlag(_memoryProperties.memoryTypes[i].propertyFlags)) & flags) == flags)
+            return i;
+    }
+    return Containers::NullOpt;
+}
+
+std::vector<DeviceProperties> enumerateDevices(Instance& instance) {
+    UnsignedInt count;
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(instance->EnumeratePhysicalDevices(instance.handle(), &count, nullptr));
+    std::vector<VkPhysicalDevice> handles(count);
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(instance->EnumeratePhysicalDevices(instance.handle(), &count, handles.data()));
+
+    std::vector<DeviceProperties> out;
+    out.reserve(count);
+    for(const VkPhysicalDevice handle: handles)
+        out.push_back(DeviceProperties::wrap(instance, handle));
+    return out;
+}
+
+Containers::Optional<DeviceProperties> pickDevice(Instance& instance) {
+    std::vector<DeviceProperties> devices = enumerateDevices(instance);
+    if(devices.empty()) {
+        Error{} << "Vk::pickDevice(): no Vulkan devices found";
+        return Containers::NullOpt;
+    }
+
+    for(DeviceType type: {DeviceType::DiscreteGpu, DeviceType::IntegratedGpu})
+        for(DeviceProperties& device: devices)
+            if(device.type() == type) return std::move(device);
+
+    return std::move(devices.front());
+}
+
+Debug& operator<<(Debug& debug, const DeviceType value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case DeviceType::value: return debug << "Vk::DeviceType::" #value;
+        _c(Other)
+        _c(IntegratedGpu)
+        _c(DiscreteGpu)
+        _c(VirtualGpu)
+        _c(Cpu)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Vk::DeviceType(" << Debug::nospace << reinterpret_cast<void*>(Int(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const QueueFlag value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case QueueFlag::value: return debug << "Vk::QueueFlag::" #value;
+        _c(Graphics)
+        _c(Compute)
+        _c(Transfer)
+        _c(SparseBinding)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Vk::QueueFlag(" << Debug::nospace << reinterpret_cast<void*>(UnsignedInt(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const QueueFlags value) {
+    return Containers::enumSetDebugOutput(debug, value, "Vk::QueueFlags{}", {
+        QueueFlag::Graphics,
+        QueueFlag::Compute,
+        QueueFlag::Transfer,
+        QueueFlag::SparseBinding});
+}
+
+}}
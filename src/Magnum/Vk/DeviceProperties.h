@@ -0,0 +1,231 @@
+#ifndef Magnum_Vk_DeviceProperties_h
+#define Magnum_Vk_DeviceProperties_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::DeviceProperties, enum @ref Magnum::Vk::DeviceType, @ref Magnum::Vk::QueueFlag, enum set @ref Magnum::Vk::QueueFlags, function @ref Magnum::Vk::enumerateDevices(), @ref Magnum::Vk::pickDevice()
+ */
+
+#include <string>
+#include <vector>
+#include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Memory.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Physical device type
+
+Wraps @type_vk{PhysicalDeviceType}.
+@see @ref DeviceProperties::type()
+*/
+enum class DeviceType: Int {
+    /** Device that doesn't match any other type */
+    Other = VK_PHYSICAL_DEVICE_TYPE_OTHER,
+
+    /** Typically a device embedded in or tightly coupled with the host */
+    IntegratedGpu = VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU,
+
+    /** Typically a separate processor connected to the host via an interlink */
+    DiscreteGpu = VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU,
+
+    /** Typically a virtual node in a virtualization environment */
+    VirtualGpu = VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU,
+
+    /** Typically running on the same processors as the host */
+    Cpu = VK_PHYSICAL_DEVICE_TYPE_CPU
+};
+
+/** @debugoperatorenum{DeviceType} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, DeviceType value);
+
+/**
+@brief Queue flag
+
+Wraps @type_vk{QueueFlagBits}.
+@see @ref QueueFlags, @ref DeviceProperties::queueFamilyFlags()
+*/
+enum class QueueFlag: UnsignedInt {
+    /** Supports graphics operations */
+    Graphics = VK_QUEUE_GRAPHICS_BIT,
+
+    /** Supports compute operations */
+    Compute = VK_QUEUE_COMPUTE_BIT,
+
+    /** Supports transfer operations */
+    Transfer = VK_QUEUE_TRANSFER_BIT,
+
+    /** Supports sparse memory management operations */
+    SparseBinding = VK_QUEUE_SPARSE_BINDING_BIT
+};
+
+/**
+@brief Queue flags
+
+@see @ref DeviceProperties::queueFamilyFlags()
+*/
+typedef Containers::EnumSet<QueueFlag> QueueFlags;
+
+CORRADE_ENUMSET_OPERATORS(QueueFlags)
+
+/** @debugoperatorenum{QueueFlag} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, QueueFlag value);
+
+/** @debugoperatorenum{QueueFlags} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, QueueFlags value);
+
+/**
+@brief Physical device properties
+
+Wraps a @type_vk{PhysicalDevice} together with its properties, memory
+properties and queue family properties, which are all queried once on
+construction. Instances are obtained through @ref enumerateDevices() or
+@ref pickDevice() and then passed to @ref DeviceCreateInfo to create a logical
+@ref Device.
+*/
+class MAGNUM_VK_EXPORT DeviceProperties {
+    public:
+        /**
+         * @brief Wrap a physical device
+         * @param instance  Vulkan instance the device belongs to
+         * @param handle    The @type_vk{PhysicalDevice} handle
+         *
+         * @see @fn_vk{GetPhysicalDeviceProperties},
+         *      @fn_vk{GetPhysicalDeviceMemoryProperties},
+         *      @fn_vk{GetPhysicalDeviceQueueFamilyProperties}
+         */
+        static DeviceProperties wrap(Instance& instance, VkPhysicalDevice handle);
+
+        /**
+         * @brief Construct without wrapping a device
+         *
+         * The instance is empty and shouldn't be queried. Copy or move
+         * another instance over it to make it useful.
+         */
+        explicit DeviceProperties(NoCreateT) noexcept;
+
+        /** @brief Underlying @type_vk{PhysicalDevice} handle */
+        VkPhysicalDevice handle() const { return _handle; }
+
+        /** @brief Raw @type_vk{PhysicalDeviceProperties} structure */
+        const VkPhysicalDeviceProperties& properties() const { return _properties; }
+
+        /** @brief Device name */
+        std::string name() const;
+
+        /** @brief Device type */
+        DeviceType type() const { return DeviceType(_properties.deviceType); }
+
+        /** @brief Queue family count */
+        UnsignedInt queueFamilyCount() const { return _queueFamilyProperties.size(); }
+
+        /**
+         * @brief Count of queues in given family
+         *
+         * Expects that @p id is less than @ref queueFamilyCount().
+         */
+        UnsignedInt queueFamilySize(UnsignedInt id) const;
+
+        /**
+         * @brief Queue family flags
+         *
+         * Expects that @p id is less than @ref queueFamilyCount().
+         */
+        QueueFlags queueFamilyFlags(UnsignedInt id) const;
+
+        /**
+         * @brief Pick a queue family
+         *
+         * Returns the first queue family that supports all of @p flags or
+         * @ref Containers::NullOpt if there's no such family.
+         */
+        Containers::Optional<UnsignedInt> pickQueueFamily(QueueFlags flags) const;
+
+        /** @brief Memory type count */
+        UnsignedInt memoryCount() const { return _memoryProperties.memoryTypeCount; }
+
+        /**
+         * @brief Memory type flags
+         *
+         * Expects that @p id is less than @ref memoryCount().
+         */
+        MemoryFlags memoryFlags(UnsignedInt id) const;
+
+        /**
+         * @brief Size of the heap a memory type is allocated from
+         *
+         * Expects that @p id is less than @ref memoryCount().
+         */
+        UnsignedLong memoryHeapSize(UnsignedInt id) const;
+
+        /**
+         * @brief Pick a memory type
+         * @param flags     Required memory flags
+         * @param memories  Bit mask of allowed memory types, usually
+         *      @cpp VkMemoryRequirements::memoryTypeBits @ce
+         *
+         * Returns the first memory type that's allowed by @p memories and
+         * has all of @p flags or @ref Containers::NullOpt if there's no such
+         * type. As the driver reports memory types ordered by performance,
+         * the first matching type is the best one.
+         */
+        Containers::Optional<UnsignedInt> pickMemory(MemoryFlags flags, UnsignedInt memories = ~UnsignedInt{}) const;
+
+    private:
+        explicit DeviceProperties(Instance& instance, VkPhysicalDevice handle);
+
+        VkPhysicalDevice _handle;
+        VkPhysicalDeviceProperties _properties;
+        VkPhysicalDeviceMemoryProperties _memoryProperties;
+        std::vector<VkQueueFamilyProperties> _queueFamilyProperties;
+};
+
+/**
+@brief Enumerate physical devices
+
+@see @fn_vk{EnumeratePhysicalDevices}
+*/
+MAGNUM_VK_EXPORT std::vector<DeviceProperties> enumerateDevices(Instance& instance);
+
+/**
+@brief Pick a physical device
+
+Picks the first discrete GPU, if there's none then the first integrated GPU
+and if there's none of these either then the first device reported. Returns
+@ref Containers::NullOpt and prints a message to @ref Error if there are no
+devices at all.
+*/
+MAGNUM_VK_EXPORT Containers::Optional<DeviceProperties> pickDevice(Instance& instance);
+
+}}
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef Magnum_Vk_Handle_h
+#define Magnum_Vk_Handle_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Enum @ref Magnum::Vk::HandleFlag, enum set @ref Magnum::Vk::HandleFlags
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Handle wrapping flag
+
+@see @ref HandleFlags, @ref Instance::wrap(), @ref Buffer::wrap()
+*/
+enum class HandleFlag: UnsignedByte {
+    /** Destroy the handle on destruction. */
+    DestroyOnDestruction = 1 << 0
+};
+
+/**
+@brief Handle wrapping flags
+
+@see @ref Instance::wrap(), @ref Buffer::wrap()
+*/
+typedef Containers::EnumSet<HandleFlag> HandleFlags;
+
+CORRADE_ENUMSET_OPERATORS(HandleFlags)
+
+}}
+
+#endif
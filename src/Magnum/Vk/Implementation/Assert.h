@@ -0,0 +1,47 @@
+#ifndef Magnum_Vk_Implementation_Assert_h
+#define Magnum_Vk_Implementation_Assert_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdlib>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Vk/Result.h"
+
+/* Vulkan calls that fail only due to implementation or driver bugs (or when
+   running out of memory) abort with a message printing the result instead of
+   bubbling the error code through every API. Unlike CORRADE_INTERNAL_ASSERT
+   this is not compiled out in release builds, as the check is cheap compared
+   to the call itself. */
+#define MAGNUM_VK_INTERNAL_ASSERT_RESULT(call)                              \
+    do {                                                                    \
+        const Magnum::Vk::Result _magnumVkResult = Magnum::Vk::Result(call); \
+        if(_magnumVkResult != Magnum::Vk::Result::Success) {                \
+            Corrade::Utility::Error{} << "Call " #call " failed with" << _magnumVkResult << "at" << __FILE__ << Corrade::Utility::Debug::nospace << ":" << Corrade::Utility::Debug::nospace << __LINE__; \
+            std::abort();                                                   \
+        }                                                                   \
+    } while(false)
+
+#endif
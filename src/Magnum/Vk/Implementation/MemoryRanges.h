@@ -0,0 +1,107 @@
+#ifndef Magnum_Vk_Implementation_MemoryRanges_h
+#define Magnum_Vk_Implementation_MemoryRanges_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <iterator>
+#include <map>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace Vk { namespace Implementation {
+
+/* First-fit sub-allocator for a single memory block. Free ranges are kept
+   ordered by offset, neighboring ranges get coalesced on free so the
+   fragmentation stays low for the usual case of similarly-sized allocations
+   with similar lifetime. Not thread-safe, the MemoryAllocator guards it. */
+class MemoryRanges {
+    public:
+        enum: UnsignedLong { NotFound = ~UnsignedLong{} };
+
+        explicit MemoryRanges(UnsignedLong size): _size{size}, _used{} {
+            if(size) _free.emplace(0, size);
+        }
+
+        UnsignedLong size() const { return _size; }
+        UnsignedLong used() const { return _used; }
+        bool empty() const { return !_used; }
+        std::size_t freeRangeCount() const { return _free.size(); }
+
+        /* Returns offset of the allocation or NotFound. Alignment is expected
+           to be non-zero, Vulkan guarantees it's a power of two. */
+        UnsignedLong allocate(UnsignedLong size, UnsignedLong alignment) {
+            for(auto it = _free.begin(); it != _free.end(); ++it) {
+                const UnsignedLong offset = (it->first + alignment - 1)/alignment*alignment;
+                const UnsignedLong padding = offset - it->first;
+                if(it->second < padding + size) continue;
+
+                /* Split the range, keeping the alignment padding and the
+                   remainder as free ranges */
+                const UnsignedLong rangeOffset = it->first;
+                const UnsignedLong rangeSize = it->second;
+                it = _free.erase(it);
+                if(padding) _free.emplace_hint(it, rangeOffset, padding);
+                if(rangeSize != padding + size)
+                    _free.emplace_hint(it, offset + size, rangeSize - padding - size);
+
+                _used += size;
+                return offset;
+            }
+
+            return NotFound;
+        }
+
+        void free(UnsignedLong offset, UnsignedLong size) {
+            _used -= size;
+
+            auto next = _free.lower_bound(offset);
+
+            /* Coalesce with the previous free range */
+            if(next != _free.begin()) {
+                auto previous = std::prev(next);
+                if(previous->first + previous->second == offset) {
+                    offset = previous->first;
+                    size += previous->second;
+                    _free.erase(previous);
+                }
+            }
+
+            /* Coalesce with the next free range */
+            if(next != _free.end() && offset + size == next->first) {
+                size += next->second;
+                next = _free.erase(next);
+            }
+
+            _free.emplace_hint(next, offset, size);
+        }
+
+    private:
+        UnsignedLong _size, _used;
+        std::map<UnsignedLong, UnsignedLong> _free;
+};
+
+}}}
+
+#endif
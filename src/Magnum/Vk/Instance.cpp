@@ -0,0 +1,120 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Instance.h"
+
+#include <utility>
+
+#include "Magnum/Vk/Implementation/Assert.h"
+
+namespace Magnum { namespace Vk {
+
+InstanceCreateInfo::InstanceCreateInfo(): _applicationVersion{} {}
+
+InstanceCreateInfo& InstanceCreateInfo::setApplicationInfo(const std::string& name, const UnsignedInt version) {
+    _applicationName = name;
+    _applicationVersion = version;
+    return *this;
+}
+
+InstanceCreateInfo& InstanceCreateInfo::addEnabledLayers(std::initializer_list<std::string> layers) {
+    _layers.insert(_layers.end(), layers);
+    return *this;
+}
+
+InstanceCreateInfo& InstanceCreateInfo::addEnabledExtensions(std::initializer_list<std::string> extensions) {
+    _extensions.insert(_extensions.end(), extensions);
+    return *this;
+}
+
+Instance Instance::wrap(const VkInstance handle, const HandleFlags flags) {
+    return Instance{handle, flags};
+}
+
+Instance::Instance(const InstanceCreateInfo& info): _flags{HandleFlag::DestroyOnDestruction} {
+    /* Load global function pointers that are not available statically */
+    flextVkInit();
+
+    VkApplicationInfo applicationInfo{};
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.pApplicationName = info.applicationName().empty() ?
+        nullptr : info.applicationName().data();
+    applicationInfo.applicationVersion = info.applicationVersion();
+    applicationInfo.pEngineName = "Magnum";
+    applicationInfo.apiVersion = VK_MAKE_VERSION(1, 0, 0);
+
+    std::vector<const char*> layers;
+    layers.reserve(info.enabledLayers().size());
+    for(const std::string& layer: info.enabledLayers())
+        layers.push_back(layer.data());
+
+    std::vector<const char*> extensions;
+    extensions.reserve(info.enabledExtensions().size());
+    for(const std::string& extension: info.enabledExtensions())
+        extensions.push_back(extension.data());
+
+    VkInstanceCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    createInfo.pApplicationInfo = &applicationInfo;
+    createInfo.enabledLayerCount = layers.size();
+    createInfo.ppEnabledLayerNames = layers.data();
+    createInfo.enabledExtensionCount = extensions.size();
+    createInfo.ppEnabledExtensionNames = extensions.data();
+
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(vkCreateInstance(&createInfo, nullptr, &_handle));
+    flextVkInitInstance(_handle, &_functionPointers);
+}
+
+Instance::Instance(NoCreateT) noexcept: _handle{}, _flags{HandleFlag::DestroyOnDestruction}, _functionPointers{} {}
+
+Instance::Instance(const VkInstance handle, const HandleFlags flags) noexcept: _handle{handle}, _flags{flags}, _functionPointers{} {
+    flextVkInitInstance(_handle, &_functionPointers);
+}
+
+Instance::Instance(Instance&& other) noexcept: _handle{other._handle}, _flags{other._flags}, _functionPointers(other._functionPointers) {
+    other._handle = {};
+    other._functionPointers = {};
+}
+
+Instance::~Instance() {
+    if(_handle && (_flags & HandleFlag::DestroyOnDestruction))
+        _functionPointers.DestroyInstance(_handle, nullptr);
+}
+
+Instance& Instance::operator=(Instance&& other) noexcept {
+    using std::swap;
+    swap(other._handle, _handle);
+    swap(other._flags, _flags);
+    swap(other._functionPointers, _functionPointers);
+    return *this;
+}
+
+VkInstance Instance::release() {
+    const VkInstance handle = _handle;
+    _handle = {};
+    return handle;
+}
+
+}}
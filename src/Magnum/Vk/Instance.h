@@ -0,0 +1,203 @@
+#ifndef Magnum_Vk_Instance_h
+#define Magnum_Vk_Instance_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::InstanceCreateInfo, @ref Magnum::Vk::Instance
+ */
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Handle.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Instance creation info
+
+@see @ref Instance
+*/
+class MAGNUM_VK_EXPORT InstanceCreateInfo {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Application name is empty, application version is @cpp 0 @ce and
+         * no layers or extensions are enabled.
+         */
+        explicit InstanceCreateInfo();
+
+        /**
+         * @brief Set application name and version
+         * @return Reference to self (for method chaining)
+         *
+         * Passed to the driver in @type_vk{ApplicationInfo}. Some drivers
+         * use it to select application-specific workarounds.
+         */
+        InstanceCreateInfo& setApplicationInfo(const std::string& name, UnsignedInt version);
+
+        /** @brief Application name */
+        const std::string& applicationName() const { return _applicationName; }
+
+        /** @brief Application version */
+        UnsignedInt applicationVersion() const { return _applicationVersion; }
+
+        /**
+         * @brief Add enabled layers
+         * @return Reference to self (for method chaining)
+         *
+         * For example @cpp "VK_LAYER_LUNARG_standard_validation" @ce.
+         */
+        InstanceCreateInfo& addEnabledLayers(std::initializer_list<std::string> layers);
+
+        /** @brief Enabled layers */
+        const std::vector<std::string>& enabledLayers() const { return _layers; }
+
+        /**
+         * @brief Add enabled extensions
+         * @return Reference to self (for method chaining)
+         */
+        InstanceCreateInfo& addEnabledExtensions(std::initializer_list<std::string> extensions);
+
+        /** @brief Enabled extensions */
+        const std::vector<std::string>& enabledExtensions() const { return _extensions; }
+
+    private:
+        std::string _applicationName;
+        UnsignedInt _applicationVersion;
+        std::vector<std::string> _layers, _extensions;
+};
+
+/**
+@brief Instance
+
+Wraps a @type_vk{Instance}. Unlike the GL library, which loads function
+pointers into a global state tied to the current context, each instance keeps
+its own table of instance-level function pointers, accessible through
+@ref operator->(). This means there's no global state and multiple instances
+can coexist in a single application:
+
+@code{.cpp}
+Vk::Instance instance{Vk::InstanceCreateInfo{}
+    .setApplicationInfo("My Application", 1)};
+
+UnsignedInt count;
+instance->EnumeratePhysicalDevices(instance.handle(), &count, nullptr);
+@endcode
+
+Physical devices are enumerated using @ref enumerateDevices(), logical devices
+are then created with the @ref Device class.
+*/
+class MAGNUM_VK_EXPORT Instance {
+    public:
+        /**
+         * @brief Wrap existing Vulkan instance
+         * @param handle    The @type_vk{Instance} handle
+         * @param flags     Handle flags
+         *
+         * The @p handle is expected to be of an existing Vulkan instance.
+         * Function pointers are loaded for it. Unlike an instance created
+         * using a constructor, the Vulkan instance is by default not deleted
+         * on destruction, use @p flags for different behavior.
+         * @see @ref release()
+         */
+        static Instance wrap(VkInstance handle, HandleFlags flags = {});
+
+        /**
+         * @brief Constructor
+         *
+         * @see @fn_vk{CreateInstance}
+         */
+        explicit Instance(const InstanceCreateInfo& info = InstanceCreateInfo{});
+
+        /**
+         * @brief Construct without creating the instance
+         *
+         * The constructed instance is equivalent to moved-from state. Move
+         * another object over it to make it useful.
+         */
+        explicit Instance(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        Instance(const Instance&) = delete;
+
+        /** @brief Move constructor */
+        Instance(Instance&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys associated @type_vk{Instance} object if it was created
+         * using a constructor or wrapped with
+         * @ref HandleFlag::DestroyOnDestruction.
+         * @see @fn_vk{DestroyInstance}, @ref release()
+         */
+        ~Instance();
+
+        /** @brief Copying is not allowed */
+        Instance& operator=(const Instance&) = delete;
+
+        /** @brief Move assignment */
+        Instance& operator=(Instance&& other) noexcept;
+
+        /** @brief Underlying @type_vk{Instance} handle */
+        VkInstance handle() { return _handle; }
+
+        /** @brief Handle flags */
+        HandleFlags handleFlags() const { return _flags; }
+
+        /** @brief Instance-specific Vulkan function pointers */
+        const FlextVkInstance& operator*() const { return _functionPointers; }
+
+        /** @overload */
+        const FlextVkInstance* operator->() const { return &_functionPointers; }
+
+        /**
+         * @brief Release the underlying Vulkan instance
+         *
+         * Releases ownership of the Vulkan instance and returns its handle so
+         * @fn_vk{DestroyInstance} is not called on destruction. The internal
+         * state is then equivalent to moved-from state.
+         * @see @ref wrap()
+         */
+        VkInstance release();
+
+    private:
+        explicit Instance(VkInstance handle, HandleFlags flags) noexcept;
+
+        VkInstance _handle;
+        HandleFlags _flags;
+        FlextVkInstance _functionPointers;
+};
+
+}}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef Magnum_Vk_Memory_h
+#define Magnum_Vk_Memory_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Enum @ref Magnum::Vk::MemoryFlag, enum set @ref Magnum::Vk::MemoryFlags, struct @ref Magnum::Vk::MemoryAllocation
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Memory type flag
+
+Wraps @type_vk{MemoryPropertyFlagBits}.
+@see @ref MemoryFlags, @ref DeviceProperties::memoryFlags(),
+    @ref MemoryAllocator::allocate()
+*/
+enum class MemoryFlag: UnsignedInt {
+    /** Memory is most efficient for device access */
+    DeviceLocal = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+
+    /** Memory can be mapped for host access */
+    HostVisible = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+
+    /**
+     * Host writes to the memory are visible to the device without an
+     * explicit flush
+     */
+    HostCoherent = VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+
+    /** Memory is cached on the host */
+    HostCached = VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+
+    /** Memory is allocated lazily by the device */
+    LazilyAllocated = VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT
+};
+
+/**
+@brief Memory type flags
+
+@see @ref DeviceProperties::memoryFlags(), @ref MemoryAllocator::allocate()
+*/
+typedef Containers::EnumSet<MemoryFlag> MemoryFlags;
+
+CORRADE_ENUMSET_OPERATORS(MemoryFlags)
+
+/** @debugoperatorenum{MemoryFlag} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, MemoryFlag value);
+
+/** @debugoperatorenum{MemoryFlags} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, MemoryFlags value);
+
+/**
+@brief Memory allocation
+
+A range of a @type_vk{DeviceMemory} object returned from
+@ref MemoryAllocator::allocate(). An allocation with zero @ref size denotes a
+failed or empty allocation.
+*/
+struct MemoryAllocation {
+    /** @brief Memory object the allocation is part of */
+    VkDeviceMemory memory;
+
+    /** @brief Offset of the allocation inside @ref memory */
+    UnsignedLong offset;
+
+    /** @brief Allocation size */
+    UnsignedLong size;
+
+    /**
+     * @brief Mapped allocation data
+     *
+     * Points to the beginning of the allocation if the memory is
+     * @ref MemoryFlag::HostVisible, @cpp nullptr @ce otherwise.
+     */
+    char* data;
+
+    /** @brief Flags of the memory type the allocation is made from */
+    MemoryFlags flags;
+
+    /**
+     * @brief Allocator-internal block ID
+     *
+     * Used by @ref MemoryAllocator::free() and
+     * @ref MemoryAllocator::flush().
+     */
+    UnsignedInt block;
+
+    /** @brief Whether the allocation is non-empty */
+    explicit operator bool() const { return size; }
+};
+
+}}
+
+#endif
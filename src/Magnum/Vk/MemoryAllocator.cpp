@@ -0,0 +1,168 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MemoryAllocator.h"
+
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/Implementation/Assert.h"
+#include "Magnum/Vk/Implementation/MemoryRanges.h"
+
+namespace Magnum { namespace Vk {
+
+struct MemoryAllocator::Block {
+    explicit Block(VkDeviceMemory memory, UnsignedInt memoryType, MemoryFlags flags, UnsignedLong size, char* data, bool dedicated): memory{memory}, memoryType{memoryType}, flags{flags}, data{data}, dedicated{dedicated}, ranges{size} {}
+
+    VkDeviceMemory memory;
+    UnsignedInt memoryType;
+    MemoryFlags flags;
+    char* data;
+    bool dedicated;
+    Implementation::MemoryRanges ranges;
+};
+
+MemoryAllocator::MemoryAllocator(Device& device, const UnsignedLong blockSize): _device(device), _blockSize{blockSize} {}
+
+MemoryAllocator::~MemoryAllocator() {
+    for(const std::unique_ptr<Block>& block: _blocks) {
+        if(!block) continue;
+        CORRADE_ASSERT(block->ranges.empty(),
+            "Vk::MemoryAllocator: destroying with" << block->ranges.used() << "bytes still allocated in a block", );
+        _device->FreeMemory(_device.handle(), block->memory, nullptr);
+    }
+}
+
+std::size_t MemoryAllocator::blockCount() {
+    std::lock_guard<std::mutex> lock{_mutex};
+    std::size_t count = 0;
+    for(const std::unique_ptr<Block>& block: _blocks)
+        if(block) ++count;
+    return count;
+}
+
+MemoryAllocation MemoryAllocator::allocate(const VkMemoryRequirements& requirements, const MemoryFlags flags) {
+    const Containers::Optional<UnsignedInt> memoryType = _device.properties().pickMemory(flags, requirements.memoryTypeBits);
+    if(!memoryType) {
+        Error{} << "Vk::MemoryAllocator::allocate(): no memory type with" << flags << "available in" << reinterpret_cast<void*>(std::size_t(requirements.memoryTypeBits));
+        return {};
+    }
+
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    /* Sub-allocate from an existing block. Dedicated blocks are always full,
+       so they are skipped implicitly. */
+    const bool dedicated = requirements.size > _blockSize/2;
+    if(!dedicated) for(std::size_t i = 0; i != _blocks.size(); ++i) {
+        Block* const block = _blocks[i].get();
+        if(!block || block->dedicated || block->memoryType != *memoryType) continue;
+
+        const UnsignedLong offset = block->ranges.allocate(requirements.size, requirements.alignment);
+        if(offset == Implementation::MemoryRanges::NotFound) continue;
+
+        return MemoryAllocation{block->memory, offset, requirements.size,
+            block->data ? block->data + offset : nullptr, block->flags,
+            UnsignedInt(i)};
+    }
+
+    /* Allocate a new block */
+    VkMemoryAllocateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    info.allocationSize = dedicated ? requirements.size : _blockSize;
+    info.memoryTypeIndex = *memoryType;
+    VkDeviceMemory memory;
+    const Result result = Result(_device->AllocateMemory(_device.handle(), &info, nullptr, &memory));
+    if(result != Result::Success) {
+        Error{} << "Vk::MemoryAllocator::allocate(): can't allocate" << info.allocationSize << "bytes:" << result;
+        return {};
+    }
+
+    const MemoryFlags memoryFlags = _device.properties().memoryFlags(*memoryType);
+    void* data = nullptr;
+    if(memoryFlags & MemoryFlag::HostVisible)
+        MAGNUM_VK_INTERNAL_ASSERT_RESULT(_device->MapMemory(_device.handle(), memory, 0, VK_WHOLE_SIZE, 0, &data));
+
+    std::unique_ptr<Block> block{new Block{memory, *memoryType, memoryFlags,
+        info.allocationSize, static_cast<char*>(data), dedicated}};
+    const UnsignedLong offset = block->ranges.allocate(requirements.size, requirements.alignment);
+    CORRADE_INTERNAL_ASSERT(offset == 0);
+
+    /* Reuse a slot of a previously freed dedicated block, if any */
+    std::size_t id = 0;
+    for(; id != _blocks.size(); ++id) if(!_blocks[id]) break;
+    if(id == _blocks.size()) _blocks.emplace_back();
+    _blocks[id] = std::move(block);
+
+    return MemoryAllocation{memory, offset, requirements.size,
+        static_cast<char*>(data), memoryFlags, UnsignedInt(id)};
+}
+
+void MemoryAllocator::free(MemoryAllocation& allocation) {
+    if(!allocation) return;
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    CORRADE_ASSERT(allocation.block < _blocks.size() && _blocks[allocation.block] && _blocks[allocation.block]->memory == allocation.memory,
+        "Vk::MemoryAllocator::free(): allocation not made by this allocator", );
+
+    std::unique_ptr<Block>& block = _blocks[allocation.block];
+    block->ranges.free(allocation.offset, allocation.size);
+    if(block->dedicated) {
+        _device->FreeMemory(_device.handle(), block->memory, nullptr);
+        block = nullptr;
+    }
+
+    allocation = {};
+}
+
+void MemoryAllocator::flush(const MemoryAllocation& allocation, const UnsignedLong offset, const UnsignedLong size) {
+    CORRADE_ASSERT(offset + size <= allocation.size,
+        "Vk::MemoryAllocator::flush(): range" << offset << "+" << size << "out of bounds for an allocation of" << allocation.size << "bytes", );
+    if(allocation.flags & MemoryFlag::HostCoherent || !size) return;
+
+    UnsignedLong blockSize;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        CORRADE_ASSERT(allocation.block < _blocks.size() && _blocks[allocation.block] && _blocks[allocation.block]->memory == allocation.memory,
+            "Vk::MemoryAllocator::flush(): allocation not made by this allocator", );
+        blockSize = _blocks[allocation.block]->ranges.size();
+    }
+
+    /* Expand the range to a multiple of nonCoherentAtomSize. If that would
+       go past the end of the memory object, flush everything until the end
+       instead, as the spec requires. */
+    const UnsignedLong atomSize = _device.properties().properties().limits.nonCoherentAtomSize;
+    const UnsignedLong begin = (allocation.offset + offset)/atomSize*atomSize;
+    const UnsignedLong end = (allocation.offset + offset + size + atomSize - 1)/atomSize*atomSize;
+
+    VkMappedMemoryRange range{};
+    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.memory = allocation.memory;
+    range.offset = begin;
+    range.size = end < blockSize ? end - begin : VK_WHOLE_SIZE;
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(_device->FlushMappedMemoryRanges(_device.handle(), 1, &range));
+}
+
+}}
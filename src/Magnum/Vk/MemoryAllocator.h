@@ -0,0 +1,177 @@
+#ifndef Magnum_Vk_MemoryAllocator_h
+#define Magnum_Vk_MemoryAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::MemoryAllocator
+ */
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Magnum/Vk/Memory.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Device memory sub-allocator
+
+Vulkan implementations limit the count of @type_vk{DeviceMemory} allocations
+to a few thousand and each allocation is expensive, so allocating memory for
+each buffer separately doesn't scale. This class allocates memory in large
+blocks and sub-allocates ranges from them using a first-fit free list with
+coalescing. Blocks of host-visible memory are persistently mapped for their
+whole lifetime, so @ref MemoryAllocation::data can be used directly without
+any map / unmap calls.
+
+@code{.cpp}
+Vk::MemoryAllocator allocator{device};
+
+Vk::Buffer buffer{device, Vk::BufferCreateInfo{Vk::BufferUsage::VertexBuffer, 1024},
+    allocator, Vk::MemoryFlag::HostVisible};
+@endcode
+
+Allocations larger than half of @ref blockSize() get a dedicated
+@type_vk{DeviceMemory} object, which is freed together with the allocation.
+Other blocks are kept until the allocator is destroyed and reused for
+subsequent allocations.
+
+The allocator is thread-safe, allocations and frees are guarded by a mutex.
+All allocations are expected to be freed before the allocator is destroyed.
+
+@attention
+    The allocator doesn't take @cpp VkPhysicalDeviceLimits::bufferImageGranularity @ce
+    into account, which means it's not safe to use it for linear buffers and
+    optimal-tiling images sharing the same memory type at the moment.
+*/
+class MAGNUM_VK_EXPORT MemoryAllocator {
+    public:
+        /**
+         * @brief Constructor
+         * @param device        Device to allocate memory on
+         * @param blockSize     Size of each allocated memory block
+         */
+        explicit MemoryAllocator(Device& device, UnsignedLong blockSize = 64*1024*1024);
+
+        /** @brief Copying is not allowed */
+        MemoryAllocator(const MemoryAllocator&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * Buffers owning a memory allocation reference the allocator they
+         * were allocated from.
+         */
+        MemoryAllocator(MemoryAllocator&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all allocated blocks. Expects that all allocations were
+         * freed.
+         * @see @fn_vk{FreeMemory}
+         */
+        ~MemoryAllocator();
+
+        /** @brief Copying is not allowed */
+        MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+
+        /** @brief Moving is not allowed */
+        MemoryAllocator& operator=(MemoryAllocator&&) = delete;
+
+        /** @brief Device the memory is allocated on */
+        Device& device() { return _device; }
+
+        /** @brief Block size */
+        UnsignedLong blockSize() const { return _blockSize; }
+
+        /**
+         * @brief Count of currently allocated memory blocks
+         *
+         * Thread-safe.
+         */
+        std::size_t blockCount();
+
+        /**
+         * @brief Allocate memory
+         * @param requirements  Memory requirements, usually returned from
+         *      @ref Buffer::memoryRequirements()
+         * @param flags         Requires memory type flags
+         *
+         * Picks the first memory type allowed by @p requirements that has
+         * all @p flags, then sub-allocates from an existing block of that
+         * type or allocates a new one. If no memory type matches or the
+         * device runs out of memory, prints a message to @ref Error and
+         * returns an empty allocation. Thread-safe.
+         * @see @ref DeviceProperties::pickMemory(), @fn_vk{AllocateMemory},
+         *      @fn_vk{MapMemory}
+         */
+        MemoryAllocation allocate(const VkMemoryRequirements& requirements, MemoryFlags flags);
+
+        /**
+         * @brief Free memory
+         *
+         * Returns the range to the block it was allocated from and resets
+         * @p allocation to an empty state. Dedicated blocks are freed
+         * immediately. Expects that the allocation was made by this
+         * allocator. Empty allocations are ignored. Thread-safe.
+         */
+        void free(MemoryAllocation& allocation);
+
+        /**
+         * @brief Flush host writes
+         * @param allocation    Allocation to flush
+         * @param offset        Offset of the range inside @p allocation
+         * @param size          Size of the range
+         *
+         * Makes host writes to given range visible to the device. Does
+         * nothing if the memory is @ref MemoryFlag::HostCoherent, otherwise
+         * the range is expanded to satisfy
+         * @cpp VkPhysicalDeviceLimits::nonCoherentAtomSize @ce. Thread-safe.
+         * @see @fn_vk{FlushMappedMemoryRanges}
+         */
+        void flush(const MemoryAllocation& allocation, UnsignedLong offset, UnsignedLong size);
+
+        /** @overload */
+        void flush(const MemoryAllocation& allocation) {
+            flush(allocation, 0, allocation.size);
+        }
+
+    private:
+        struct Block;
+
+        Device& _device;
+        UnsignedLong _blockSize;
+        std::mutex _mutex;
+        std::vector<std::unique_ptr<Block>> _blocks;
+};
+
+}}
+
+#endif
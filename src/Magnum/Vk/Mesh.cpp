@@ -0,0 +1,180 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Mesh.h"
+
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace Vk {
+
+namespace {
+
+constexpr VkPrimitiveTopology PrimitiveMapping[]{
+    VK_PRIMITIVE_TOPOLOGY_POINT_LIST,
+    VK_PRIMITIVE_TOPOLOGY_LINE_LIST,
+    VkPrimitiveTopology{}, /* LineLoop has no Vulkan equivalent */
+    VK_PRIMITIVE_TOPOLOGY_LINE_STRIP,
+    VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+    VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP,
+    VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN
+};
+
+constexpr VkIndexType IndexTypeMapping[]{
+    VkIndexType{}, /* 8-bit indices need VK_EXT_index_type_uint8 */
+    VK_INDEX_TYPE_UINT16,
+    VK_INDEX_TYPE_UINT32
+};
+
+}
+
+bool hasVkPrimitiveTopology(const Magnum::MeshPrimitive primitive) {
+    CORRADE_ASSERT(UnsignedInt(primitive) < Containers::arraySize(PrimitiveMapping),
+        "Vk::hasVkPrimitiveTopology(): invalid primitive" << primitive, {});
+    return primitive != Magnum::MeshPrimitive::LineLoop;
+}
+
+VkPrimitiveTopology vkPrimitiveTopology(const Magnum::MeshPrimitive primitive) {
+    CORRADE_ASSERT(UnsignedInt(primitive) < Containers::arraySize(PrimitiveMapping),
+        "Vk::vkPrimitiveTopology(): invalid primitive" << primitive, {});
+    CORRADE_ASSERT(primitive != Magnum::MeshPrimitive::LineLoop,
+        "Vk::vkPrimitiveTopology(): unsupported primitive" << primitive, {});
+    return PrimitiveMapping[UnsignedInt(primitive)];
+}
+
+bool hasVkIndexType(const Magnum::MeshIndexType type) {
+    CORRADE_ASSERT(UnsignedInt(type) < Containers::arraySize(IndexTypeMapping),
+        "Vk::hasVkIndexType(): invalid type" << type, {});
+    return type != Magnum::MeshIndexType::UnsignedByte;
+}
+
+VkIndexType vkIndexType(const Magnum::MeshIndexType type) {
+    CORRADE_ASSERT(UnsignedInt(type) < Containers::arraySize(IndexTypeMapping),
+        "Vk::vkIndexType(): invalid type" << type, {});
+    CORRADE_ASSERT(type != Magnum::MeshIndexType::UnsignedByte,
+        "Vk::vkIndexType(): unsupported type" << type, {});
+    return IndexTypeMapping[UnsignedInt(type)];
+}
+
+MeshLayout::MeshLayout(const MeshPrimitive primitive): _primitive{primitive} {
+    CORRADE_ASSERT(hasVkPrimitiveTopology(primitive),
+        "Vk::MeshLayout: unsupported primitive" << primitive, );
+}
+
+bool MeshLayout::hasBinding(const UnsignedInt binding) const {
+    for(const VkVertexInputBindingDescription& description: _bindings)
+        if(description.binding == binding) return true;
+    return false;
+}
+
+MeshLayout& MeshLayout::addBindingInternal(const UnsignedInt binding, const UnsignedInt stride, const VkVertexInputRate rate) {
+    CORRADE_ASSERT(!hasBinding(binding),
+        "Vk::MeshLayout::addBinding(): binding" << binding << "already added", *this);
+
+    VkVertexInputBindingDescription description{};
+    description.binding = binding;
+    description.stride = stride;
+    description.inputRate = rate;
+    _bindings.push_back(description);
+    return *this;
+}
+
+MeshLayout& MeshLayout::addBinding(const UnsignedInt binding, const UnsignedInt stride) {
+    return addBindingInternal(binding, stride, VK_VERTEX_INPUT_RATE_VERTEX);
+}
+
+MeshLayout& MeshLayout::addInstancedBinding(const UnsignedInt binding, const UnsignedInt stride) {
+    return addBindingInternal(binding, stride, VK_VERTEX_INPUT_RATE_INSTANCE);
+}
+
+MeshLayout& MeshLayout::addAttribute(const UnsignedInt location, const UnsignedInt binding, const VkFormat format, const UnsignedInt offset) {
+    CORRADE_ASSERT(hasBinding(binding),
+        "Vk::MeshLayout::addAttribute(): binding" << binding << "not added", *this);
+
+    VkVertexInputAttributeDescription description{};
+    description.location = location;
+    description.binding = binding;
+    description.format = format;
+    description.offset = offset;
+    _attributes.push_back(description);
+    return *this;
+}
+
+Mesh::Mesh(const MeshLayout& layout): _layout{layout}, _count{}, _instanceCount{1}, _indexBuffer{}, _indexBufferOffset{}, _indexType{} {}
+
+Mesh& Mesh::addVertexBuffer(const UnsignedInt binding, Buffer& buffer, const UnsignedLong offset) {
+    CORRADE_ASSERT(_layout.hasBinding(binding),
+        "Vk::Mesh::addVertexBuffer(): binding" << binding << "not present in the layout", *this);
+    _vertexBuffers.push_back({binding, buffer.handle(), offset});
+    return *this;
+}
+
+Mesh& Mesh::addVertexBuffer(const UnsignedInt binding, Buffer&& buffer, const UnsignedLong offset) {
+    addVertexBuffer(binding, buffer, offset);
+    _ownedBuffers.push_back(std::move(buffer));
+    return *this;
+}
+
+UnsignedInt Mesh::vertexBufferBinding(const std::size_t id) const {
+    CORRADE_ASSERT(id < _vertexBuffers.size(),
+        "Vk::Mesh::vertexBufferBinding(): index" << id << "out of range for" << _vertexBuffers.size() << "buffers", {});
+    return _vertexBuffers[id].binding;
+}
+
+VkBuffer Mesh::vertexBuffer(const std::size_t id) const {
+    CORRADE_ASSERT(id < _vertexBuffers.size(),
+        "Vk::Mesh::vertexBuffer(): index" << id << "out of range for" << _vertexBuffers.size() << "buffers", {});
+    return _vertexBuffers[id].buffer;
+}
+
+UnsignedLong Mesh::vertexBufferOffset(const std::size_t id) const {
+    CORRADE_ASSERT(id < _vertexBuffers.size(),
+        "Vk::Mesh::vertexBufferOffset(): index" << id << "out of range for" << _vertexBuffers.size() << "buffers", {});
+    return _vertexBuffers[id].offset;
+}
+
+Mesh& Mesh::setIndexBuffer(Buffer& buffer, const UnsignedLong offset, const MeshIndexType type) {
+    CORRADE_ASSERT(hasVkIndexType(type),
+        "Vk::Mesh::setIndexBuffer(): unsupported type" << type, *this);
+    _indexBuffer = buffer.handle();
+    _indexBufferOffset = offset;
+    _indexType = type;
+    return *this;
+}
+
+Mesh& Mesh::setIndexBuffer(Buffer&& buffer, const UnsignedLong offset, const MeshIndexType type) {
+    setIndexBuffer(buffer, offset, type);
+    _ownedBuffers.push_back(std::move(buffer));
+    return *this;
+}
+
+MeshIndexType Mesh::indexType() const {
+    CORRADE_ASSERT(isIndexed(),
+        "Vk::Mesh::indexType(): the mesh is not indexed", {});
+    return _indexType;
+}
+
+}}
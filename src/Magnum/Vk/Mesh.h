@@ -0,0 +1,291 @@
+#ifndef Magnum_Vk_Mesh_h
+#define Magnum_Vk_Mesh_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::MeshLayout, @ref Magnum::Vk::Mesh, function @ref Magnum::Vk::hasVkPrimitiveTopology(), @ref Magnum::Vk::vkPrimitiveTopology(), @ref Magnum::Vk::hasVkIndexType(), @ref Magnum::Vk::vkIndexType()
+ */
+
+#include <vector>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Vk/Buffer.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Check availability of a generic mesh primitive
+
+Returns @cpp false @ce for @ref MeshPrimitive::LineLoop, which has no Vulkan
+equivalent, @cpp true @ce otherwise.
+@see @ref vkPrimitiveTopology()
+*/
+MAGNUM_VK_EXPORT bool hasVkPrimitiveTopology(Magnum::MeshPrimitive primitive);
+
+/**
+@brief Convert generic mesh primitive to Vulkan primitive topology
+
+Expects that the primitive is supported, see @ref hasVkPrimitiveTopology().
+@see @ref vkIndexType()
+*/
+MAGNUM_VK_EXPORT VkPrimitiveTopology vkPrimitiveTopology(Magnum::MeshPrimitive primitive);
+
+/**
+@brief Check availability of a generic index type
+
+Returns @cpp false @ce for @ref MeshIndexType::UnsignedByte, which is not
+supported by core Vulkan, @cpp true @ce otherwise.
+@see @ref vkIndexType()
+*/
+MAGNUM_VK_EXPORT bool hasVkIndexType(Magnum::MeshIndexType type);
+
+/**
+@brief Convert generic mesh index type to Vulkan index type
+
+Expects that the type is supported, see @ref hasVkIndexType().
+@see @ref vkPrimitiveTopology()
+*/
+MAGNUM_VK_EXPORT VkIndexType vkIndexType(Magnum::MeshIndexType type);
+
+/**
+@brief Mesh layout
+
+Describes vertex buffer bindings, vertex attributes and the primitive
+topology, which in Vulkan are baked into a pipeline. Passed to
+@ref GraphicsPipelineCreateInfo::setMeshLayout() and to the @ref Mesh
+constructor. Attribute locations are expected to match the shader, for
+meshes created with @ref MeshTools::compile() the locations are the same as
+in @ref Shaders::Generic.
+
+@code{.cpp}
+Vk::MeshLayout layout{MeshPrimitive::Triangles};
+layout.addBinding(0, sizeof(Vector3) + sizeof(Vector3))
+    .addAttribute(0, 0, VK_FORMAT_R32G32B32_SFLOAT, 0)
+    .addAttribute(2, 0, VK_FORMAT_R32G32B32_SFLOAT, sizeof(Vector3));
+@endcode
+*/
+class MAGNUM_VK_EXPORT MeshLayout {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Expects that @p primitive is supported, see
+         * @ref hasVkPrimitiveTopology().
+         */
+        explicit MeshLayout(MeshPrimitive primitive);
+
+        /** @brief Primitive */
+        MeshPrimitive primitive() const { return _primitive; }
+
+        /**
+         * @brief Add a per-vertex buffer binding
+         * @param binding   Binding index
+         * @param stride    Distance between consecutive vertices in bytes
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the binding wasn't added yet.
+         */
+        MeshLayout& addBinding(UnsignedInt binding, UnsignedInt stride);
+
+        /**
+         * @brief Add a per-instance buffer binding
+         * @param binding   Binding index
+         * @param stride    Distance between consecutive instances in bytes
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the binding wasn't added yet.
+         */
+        MeshLayout& addInstancedBinding(UnsignedInt binding, UnsignedInt stride);
+
+        /**
+         * @brief Add an attribute
+         * @param location  Shader location
+         * @param binding   Binding the attribute is sourced from
+         * @param format    Attribute format
+         * @param offset    Offset of the attribute relative to the start
+         *      of a vertex
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p binding was added already.
+         */
+        MeshLayout& addAttribute(UnsignedInt location, UnsignedInt binding, VkFormat format, UnsignedInt offset);
+
+        /** @brief Bindings */
+        const std::vector<VkVertexInputBindingDescription>& bindings() const { return _bindings; }
+
+        /** @brief Attributes */
+        const std::vector<VkVertexInputAttributeDescription>& attributes() const { return _attributes; }
+
+        /** @brief Whether the layout has given binding */
+        bool hasBinding(UnsignedInt binding) const;
+
+    private:
+        MeshLayout& addBindingInternal(UnsignedInt binding, UnsignedInt stride, VkVertexInputRate rate);
+
+        MeshPrimitive _primitive;
+        std::vector<VkVertexInputBindingDescription> _bindings;
+        std::vector<VkVertexInputAttributeDescription> _attributes;
+};
+
+/**
+@brief Mesh
+
+Vertex and index buffers together with a @ref MeshLayout and vertex / index
+count, drawn with @ref CommandBuffer::draw(Mesh&). Unlike @ref GL::Mesh, which
+wraps a stateful vertex array object, this is just a plain collection of
+buffer handles and the layout itself has to be baked into a pipeline using
+@ref GraphicsPipelineCreateInfo::setMeshLayout().
+
+The buffers can be either passed by reference, in which case the user is
+responsible for keeping them alive for the whole mesh lifetime, or moved in,
+in which case the mesh takes their ownership.
+*/
+class MAGNUM_VK_EXPORT Mesh {
+    public:
+        /** @brief Constructor */
+        explicit Mesh(const MeshLayout& layout);
+
+        /** @brief Layout */
+        const MeshLayout& layout() const { return _layout; }
+
+        /** @brief Vertex / index count */
+        UnsignedInt count() const { return _count; }
+
+        /**
+         * @brief Set vertex / index count
+         * @return Reference to self (for method chaining)
+         *
+         * If the mesh is indexed, the value is treated as index count,
+         * otherwise as vertex count. Default is @cpp 0 @ce.
+         */
+        Mesh& setCount(UnsignedInt count) {
+            _count = count;
+            return *this;
+        }
+
+        /** @brief Instance count */
+        UnsignedInt instanceCount() const { return _instanceCount; }
+
+        /**
+         * @brief Set instance count
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @cpp 1 @ce.
+         */
+        Mesh& setInstanceCount(UnsignedInt count) {
+            _instanceCount = count;
+            return *this;
+        }
+
+        /**
+         * @brief Add a vertex buffer
+         * @param binding   Binding index
+         * @param buffer    Buffer
+         * @param offset    Offset in the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p binding is in @ref layout().
+         */
+        Mesh& addVertexBuffer(UnsignedInt binding, Buffer& buffer, UnsignedLong offset = 0);
+
+        /**
+         * @brief Add a vertex buffer and take its ownership
+         * @return Reference to self (for method chaining)
+         *
+         * Like @ref addVertexBuffer(UnsignedInt, Buffer&, UnsignedLong), but
+         * the buffer is destroyed together with the mesh.
+         */
+        Mesh& addVertexBuffer(UnsignedInt binding, Buffer&& buffer, UnsignedLong offset = 0);
+
+        /** @brief Count of vertex buffers */
+        std::size_t vertexBufferCount() const { return _vertexBuffers.size(); }
+
+        /** @brief Binding of given vertex buffer */
+        UnsignedInt vertexBufferBinding(std::size_t id) const;
+
+        /** @brief Vertex buffer handle */
+        VkBuffer vertexBuffer(std::size_t id) const;
+
+        /** @brief Vertex buffer offset */
+        UnsignedLong vertexBufferOffset(std::size_t id) const;
+
+        /**
+         * @brief Set an index buffer
+         * @param buffer    Buffer
+         * @param offset    Offset in the buffer
+         * @param type      Index type
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p type is supported, see @ref hasVkIndexType().
+         */
+        Mesh& setIndexBuffer(Buffer& buffer, UnsignedLong offset, MeshIndexType type);
+
+        /**
+         * @brief Set an index buffer and take its ownership
+         * @return Reference to self (for method chaining)
+         *
+         * Like @ref setIndexBuffer(Buffer&, UnsignedLong, MeshIndexType), but
+         * the buffer is destroyed together with the mesh.
+         */
+        Mesh& setIndexBuffer(Buffer&& buffer, UnsignedLong offset, MeshIndexType type);
+
+        /** @brief Whether the mesh is indexed */
+        bool isIndexed() const { return _indexBuffer != VK_NULL_HANDLE; }
+
+        /** @brief Index buffer handle */
+        VkBuffer indexBuffer() const { return _indexBuffer; }
+
+        /** @brief Index buffer offset */
+        UnsignedLong indexBufferOffset() const { return _indexBufferOffset; }
+
+        /**
+         * @brief Index type
+         *
+         * Expects that the mesh is indexed.
+         */
+        MeshIndexType indexType() const;
+
+    private:
+        struct VertexBuffer {
+            UnsignedInt binding;
+            VkBuffer buffer;
+            UnsignedLong offset;
+        };
+
+        MeshLayout _layout;
+        UnsignedInt _count, _instanceCount;
+        std::vector<VertexBuffer> _vertexBuffers;
+        VkBuffer _indexBuffer;
+        UnsignedLong _indexBufferOffset;
+        MeshIndexType _indexType;
+        std::vector<Buffer> _ownedBuffers;
+};
+
+}}
+
+#endif
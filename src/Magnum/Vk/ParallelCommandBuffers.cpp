@@ -0,0 +1,79 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ParallelCommandBuffers.h"
+
+#include <utility>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace Vk {
+
+ParallelCommandBuffers::ParallelCommandBuffers(Device& device, const UnsignedInt queueFamily, const UnsignedInt count) {
+    CORRADE_ASSERT(count,
+        "Vk::ParallelCommandBuffers: expected a non-zero command buffer count", );
+    _pools.reserve(count);
+    _commandBuffers.reserve(count);
+    for(UnsignedInt i = 0; i != count; ++i) {
+        _pools.emplace_back(device, queueFamily, CommandPoolFlag::Transient);
+        _commandBuffers.push_back(_pools.back().allocate(CommandBufferLevel::Secondary));
+    }
+}
+
+ParallelCommandBuffers::ParallelCommandBuffers(ParallelCommandBuffers&& other) noexcept: _pools{std::move(other._pools)}, _commandBuffers{std::move(other._commandBuffers)} {}
+
+ParallelCommandBuffers& ParallelCommandBuffers::operator=(ParallelCommandBuffers&& other) noexcept {
+    /* Swapping instead of assigning, so the buffers are never left pointing
+       to an already destroyed pool */
+    using std::swap;
+    swap(other._pools, _pools);
+    swap(other._commandBuffers, _commandBuffers);
+    return *this;
+}
+
+CommandBuffer& ParallelCommandBuffers::operator[](const UnsignedInt i) {
+    /* Returned on a graceful assert, as there may be no command buffer at
+       all for a NoCreate'd instance */
+    #ifndef CORRADE_NO_ASSERT
+    static CommandBuffer invalid{NoCreate};
+    #endif
+    CORRADE_ASSERT(i < _commandBuffers.size(),
+        "Vk::ParallelCommandBuffers::operator[](): index" << i << "out of range for" << _commandBuffers.size() << "command buffers", invalid);
+    return _commandBuffers[i];
+}
+
+ParallelCommandBuffers& ParallelCommandBuffers::begin(const VkRenderPass renderPass, const UnsignedInt subpass, const VkFramebuffer framebuffer) {
+    for(CommandPool& pool: _pools) pool.reset();
+    for(CommandBuffer& commandBuffer: _commandBuffers)
+        commandBuffer.begin(renderPass, subpass, framebuffer);
+    return *this;
+}
+
+ParallelCommandBuffers& ParallelCommandBuffers::end() {
+    for(CommandBuffer& commandBuffer: _commandBuffers)
+        commandBuffer.end();
+    return *this;
+}
+
+}}
@@ -0,0 +1,165 @@
+#ifndef Magnum_Vk_ParallelCommandBuffers_h
+#define Magnum_Vk_ParallelCommandBuffers_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::ParallelCommandBuffers
+ */
+
+#include <vector>
+
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/CommandPool.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Secondary command buffers for parallel recording
+
+A set of secondary command buffers, each allocated from its own
+@ref CommandPool, so each of them can be recorded on a different thread
+without any synchronization. Designed to be used together with
+@ref SceneGraph::Camera::draw(SceneGraph::DrawableGroup<dimensions, T>&, SceneGraph::DrawableTransformations<dimensions, T>&, UnsignedInt, UnsignedInt),
+which splits the visible drawables into chunks and draws them on multiple
+threads, passing the chunk index to @ref SceneGraph::Drawable::drawChunk():
+
+@code{.cpp}
+class VkDrawable: public SceneGraph::Drawable3D {
+    // ...
+
+    void drawChunk(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera, UnsignedInt chunk) override {
+        (*_commands)[chunk]
+            .pushConstants(layout, Vk::ShaderStage::Vertex, 0, ...)
+            .draw(_mesh);
+    }
+};
+
+Vk::ParallelCommandBuffers commands{device, graphicsFamily, 16};
+
+// every frame
+commands.begin(renderPass, 0, framebuffer);
+camera.draw(drawables, transformations, commands.count(), std::thread::hardware_concurrency());
+commands.end();
+
+primary.begin()
+    .beginRenderPass(renderPass, framebuffer, {{}, size}, {clearColor},
+        Vk::SubpassContents::SecondaryCommandBuffers)
+    .executeCommands(commands)
+    .endRenderPass()
+    .end();
+queue.submit(primary);
+@endcode
+
+The @ref begin() function resets all pools, so before calling it again, the
+previously recorded commands have to finish executing. With multiple frames
+in flight, keep one instance per frame. Good chunk count is a small multiple
+of the thread count, so threads that finish early can pick up remaining
+chunks. Specifying more chunks than threads doesn't have any other overhead
+than the extra command pools.
+*/
+class MAGNUM_VK_EXPORT ParallelCommandBuffers {
+    public:
+        /**
+         * @brief Constructor
+         * @param device        Device to create the command pools on
+         * @param queueFamily   Family of queues the primary command buffer
+         *      will be submitted to
+         * @param count         Command buffer count
+         *
+         * Creates @p count transient command pools and allocates a
+         * secondary command buffer from each. Expects that @p count is
+         * non-zero.
+         */
+        explicit ParallelCommandBuffers(Device& device, UnsignedInt queueFamily, UnsignedInt count);
+
+        /**
+         * @brief Construct without creating any command buffers
+         *
+         * The constructed instance is equivalent to moved-from state. Move
+         * another object over it to make it useful.
+         */
+        explicit ParallelCommandBuffers(NoCreateT) noexcept {}
+
+        /** @brief Copying is not allowed */
+        ParallelCommandBuffers(const ParallelCommandBuffers&) = delete;
+
+        /** @brief Move constructor */
+        ParallelCommandBuffers(ParallelCommandBuffers&& other) noexcept;
+
+        /** @brief Copying is not allowed */
+        ParallelCommandBuffers& operator=(const ParallelCommandBuffers&) = delete;
+
+        /** @brief Move assignment */
+        ParallelCommandBuffers& operator=(ParallelCommandBuffers&& other) noexcept;
+
+        /** @brief Command buffer count */
+        UnsignedInt count() const { return _commandBuffers.size(); }
+
+        /**
+         * @brief Command buffer at given index
+         *
+         * Each command buffer can be recorded from a different thread. A
+         * single command buffer can't be recorded from multiple threads at
+         * once.
+         */
+        CommandBuffer& operator[](UnsignedInt i);
+
+        /**
+         * @brief Begin recording all command buffers
+         * @param renderPass    Render pass the commands will be executed in
+         * @param subpass       Subpass index
+         * @param framebuffer   Framebuffer the commands will be rendering to
+         *      or @cpp VK_NULL_HANDLE @ce if not known
+         * @return Reference to self (for method chaining)
+         *
+         * Resets all command pools and calls
+         * @ref CommandBuffer::begin(VkRenderPass, UnsignedInt, VkFramebuffer)
+         * on all command buffers.
+         */
+        ParallelCommandBuffers& begin(VkRenderPass renderPass, UnsignedInt subpass, VkFramebuffer framebuffer = VK_NULL_HANDLE);
+
+        /**
+         * @brief End recording of all command buffers
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that no thread is recording into any of the command
+         * buffers anymore.
+         * @see @ref CommandBuffer::end()
+         */
+        ParallelCommandBuffers& end();
+
+    private:
+        /* The buffers need to be freed before their pools are destroyed,
+           so they're declared after */
+        std::vector<CommandPool> _pools;
+        std::vector<CommandBuffer> _commandBuffers;
+};
+
+}}
+
+#endif
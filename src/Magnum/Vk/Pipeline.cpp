@@ -0,0 +1,231 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Pipeline.h"
+
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/PipelineCache.h"
+#include "Magnum/Vk/Implementation/Assert.h"
+
+namespace Magnum { namespace Vk {
+
+PipelineLayout::PipelineLayout(Device& device, const Containers::ArrayView<const VkDescriptorSetLayout> setLayouts, const Containers::ArrayView<const VkPushConstantRange> pushConstantRanges): _device{&device} {
+    VkPipelineLayoutCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    info.setLayoutCount = setLayouts.size();
+    info.pSetLayouts = setLayouts.data();
+    info.pushConstantRangeCount = pushConstantRanges.size();
+    info.pPushConstantRanges = pushConstantRanges.data();
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(device->CreatePipelineLayout(device.handle(), &info, nullptr, &_handle));
+}
+
+PipelineLayout::PipelineLayout(NoCreateT) noexcept: _device{}, _handle{} {}
+
+PipelineLayout::PipelineLayout(PipelineLayout&& other) noexcept: _device{other._device}, _handle{other._handle} {
+    other._handle = {};
+}
+
+PipelineLayout::~PipelineLayout() {
+    if(_handle) (*_device)->DestroyPipelineLayout(_device->handle(), _handle, nullptr);
+}
+
+PipelineLayout& PipelineLayout::operator=(PipelineLayout&& other) noexcept {
+    using std::swap;
+    swap(other._device, _device);
+    swap(other._handle, _handle);
+    return *this;
+}
+
+GraphicsPipelineCreateInfo::GraphicsPipelineCreateInfo(const PipelineLayout& layout, const VkRenderPass renderPass, const UnsignedInt subpass): _layout{layout.handle()}, _renderPass{renderPass}, _subpass{subpass}, _meshLayout{MeshPrimitive::Triangles}, _depthTest{}, _depthWrite{}, _faceCulling{}, _colorAttachmentCount{1} {}
+
+GraphicsPipelineCreateInfo& GraphicsPipelineCreateInfo::addShader(const ShaderStage stage, const ShaderModule& module, const std::string& entryPoint) {
+    CORRADE_ASSERT(stage != ShaderStage::Compute,
+        "Vk::GraphicsPipelineCreateInfo::addShader(): compute shaders need a ComputePipelineCreateInfo", *this);
+    _stages.push_back({stage, module.handle(), entryPoint});
+    return *this;
+}
+
+GraphicsPipelineCreateInfo& GraphicsPipelineCreateInfo::setMeshLayout(const MeshLayout& layout) {
+    _meshLayout = layout;
+    return *this;
+}
+
+GraphicsPipelineCreateInfo& GraphicsPipelineCreateInfo::setDepthTest(const bool enabled, const bool write) {
+    _depthTest = enabled;
+    _depthWrite = write;
+    return *this;
+}
+
+GraphicsPipelineCreateInfo& GraphicsPipelineCreateInfo::setFaceCulling(const bool enabled) {
+    _faceCulling = enabled;
+    return *this;
+}
+
+GraphicsPipelineCreateInfo& GraphicsPipelineCreateInfo::setColorAttachmentCount(const UnsignedInt count) {
+    _colorAttachmentCount = count;
+    return *this;
+}
+
+ComputePipelineCreateInfo::ComputePipelineCreateInfo(const PipelineLayout& layout, const ShaderModule& module, const std::string& entryPoint): _layout{layout.handle()}, _module{module.handle()}, _entryPoint{entryPoint} {}
+
+Pipeline::Pipeline(Device& device, const GraphicsPipelineCreateInfo& info): Pipeline{device, info, VkPipelineCache{}} {}
+
+Pipeline::Pipeline(Device& device, const GraphicsPipelineCreateInfo& info, PipelineCache& cache): Pipeline{device, info, cache.handle()} {}
+
+Pipeline::Pipeline(Device& device, const GraphicsPipelineCreateInfo& info, const VkPipelineCache cache): _device{&device}, _bindPoint{PipelineBindPoint::Graphics} {
+    std::vector<VkPipelineShaderStageCreateInfo> stages;
+    stages.reserve(info._stages.size());
+    for(const GraphicsPipelineCreateInfo::Stage& stage: info._stages) {
+        VkPipelineShaderStageCreateInfo stageInfo{};
+        stageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stageInfo.stage = VkShaderStageFlagBits(stage.stage);
+        stageInfo.module = stage.module;
+        stageInfo.pName = stage.entryPoint.data();
+        stages.push_back(stageInfo);
+    }
+
+    VkPipelineVertexInputStateCreateInfo vertexInput{};
+    vertexInput.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInput.vertexBindingDescriptionCount = info._meshLayout.bindings().size();
+    vertexInput.pVertexBindingDescriptions = info._meshLayout.bindings().data();
+    vertexInput.vertexAttributeDescriptionCount = info._meshLayout.attributes().size();
+    vertexInput.pVertexAttributeDescriptions = info._meshLayout.attributes().data();
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = vkPrimitiveTopology(info._meshLayout.primitive());
+
+    /* Viewport and scissor are dynamic, only the count matters */
+    VkPipelineViewportStateCreateInfo viewport{};
+    viewport.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport.viewportCount = 1;
+    viewport.scissorCount = 1;
+
+    VkPipelineRasterizationStateCreateInfo rasterization{};
+    rasterization.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterization.cullMode = info._faceCulling ? VK_CULL_MODE_BACK_BIT : VK_CULL_MODE_NONE;
+    rasterization.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterization.lineWidth = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo multisample{};
+    multisample.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    VkPipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable = info._depthTest;
+    depthStencil.depthWriteEnable = info._depthTest && info._depthWrite;
+    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+
+    VkPipelineColorBlendAttachmentState blendAttachment{};
+    blendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT|VK_COLOR_COMPONENT_G_BIT|VK_COLOR_COMPONENT_B_BIT|VK_COLOR_COMPONENT_A_BIT;
+    std::vector<VkPipelineColorBlendAttachmentState> blendAttachments(info._colorAttachmentCount, blendAttachment);
+
+    VkPipelineColorBlendStateCreateInfo blend{};
+    blend.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    blend.attachmentCount = blendAttachments.size();
+    blend.pAttachments = blendAttachments.data();
+
+    const VkDynamicState dynamicStates[]{
+        VK_DYNAMIC_STATE_VIEWPORT,
+        VK_DYNAMIC_STATE_SCISSOR
+    };
+    VkPipelineDynamicStateCreateInfo dynamic{};
+    dynamic.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamic.dynamicStateCount = Containers::arraySize(dynamicStates);
+    dynamic.pDynamicStates = dynamicStates;
+
+    VkGraphicsPipelineCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    createInfo.stageCount = stages.size();
+    createInfo.pStages = stages.data();
+    createInfo.pVertexInputState = &vertexInput;
+    createInfo.pInputAssemblyState = &inputAssembly;
+    createInfo.pViewportState = &viewport;
+    createInfo.pRasterizationState = &rasterization;
+    createInfo.pMultisampleState = &multisample;
+    createInfo.pDepthStencilState = &depthStencil;
+    createInfo.pColorBlendState = &blend;
+    createInfo.pDynamicState = &dynamic;
+    createInfo.layout = info._layout;
+    createInfo.renderPass = info._renderPass;
+    createInfo.subpass = info._subpass;
+
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(device->CreateGraphicsPipelines(device.handle(), cache, 1, &createInfo, nullptr, &_handle));
+}
+
+Pipeline::Pipeline(Device& device, const ComputePipelineCreateInfo& info): Pipeline{device, info, VkPipelineCache{}} {}
+
+Pipeline::Pipeline(Device& device, const ComputePipelineCreateInfo& info, PipelineCache& cache): Pipeline{device, info, cache.handle()} {}
+
+Pipeline::Pipeline(Device& device, const ComputePipelineCreateInfo& info, const VkPipelineCache cache): _device{&device}, _bindPoint{PipelineBindPoint::Compute} {
+    VkComputePipelineCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    createInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    createInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    createInfo.stage.module = info._module;
+    createInfo.stage.pName = info._entryPoint.data();
+    createInfo.layout = info._layout;
+
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(device->CreateComputePipelines(device.handle(), cache, 1, &createInfo, nullptr, &_handle));
+}
+
+Pipeline::Pipeline(NoCreateT) noexcept: _device{}, _handle{}, _bindPoint{PipelineBindPoint::Graphics} {}
+
+Pipeline::Pipeline(Pipeline&& other) noexcept: _device{other._device}, _handle{other._handle}, _bindPoint{other._bindPoint} {
+    other._handle = {};
+}
+
+Pipeline::~Pipeline() {
+    if(_handle) (*_device)->DestroyPipeline(_device->handle(), _handle, nullptr);
+}
+
+Pipeline& Pipeline::operator=(Pipeline&& other) noexcept {
+    using std::swap;
+    swap(other._device, _device);
+    swap(other._handle, _handle);
+    swap(other._bindPoint, _bindPoint);
+    return *this;
+}
+
+Debug& operator<<(Debug& debug, const PipelineBindPoint value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case PipelineBindPoint::value: return debug << "Vk::PipelineBindPoint::" #value;
+        _c(Graphics)
+        _c(Compute)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Vk::PipelineBindPoint(" << Debug::nospace << reinterpret_cast<void*>(Int(value)) << Debug::nospace << ")";
+}
+
+}}
@@ -0,0 +1,320 @@
+#ifndef Magnum_Vk_Pipeline_h
+#define Magnum_Vk_Pipeline_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::PipelineLayout, @ref Magnum::Vk::GraphicsPipelineCreateInfo, @ref Magnum::Vk::ComputePipelineCreateInfo, @ref Magnum::Vk::Pipeline, enum @ref Magnum::Vk::PipelineBindPoint
+ */
+
+#include <string>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Handle.h"
+#include "Magnum/Vk/Mesh.h"
+#include "Magnum/Vk/ShaderModule.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Pipeline layout
+
+Wraps a @type_vk{PipelineLayout}, describing descriptor set layouts and push
+constant ranges used by a pipeline.
+*/
+class MAGNUM_VK_EXPORT PipelineLayout {
+    public:
+        /**
+         * @brief Constructor
+         * @param device                Device to create the layout on
+         * @param setLayouts            Descriptor set layouts
+         * @param pushConstantRanges    Push constant ranges
+         *
+         * @see @fn_vk{CreatePipelineLayout}
+         */
+        explicit PipelineLayout(Device& device, Containers::ArrayView<const VkDescriptorSetLayout> setLayouts = nullptr, Containers::ArrayView<const VkPushConstantRange> pushConstantRanges = nullptr);
+
+        /**
+         * @brief Construct without creating the layout
+         *
+         * The constructed instance is equivalent to moved-from state. Move
+         * another object over it to make it useful.
+         */
+        explicit PipelineLayout(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        PipelineLayout(const PipelineLayout&) = delete;
+
+        /** @brief Move constructor */
+        PipelineLayout(PipelineLayout&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * @see @fn_vk{DestroyPipelineLayout}
+         */
+        ~PipelineLayout();
+
+        /** @brief Copying is not allowed */
+        PipelineLayout& operator=(const PipelineLayout&) = delete;
+
+        /** @brief Move assignment */
+        PipelineLayout& operator=(PipelineLayout&& other) noexcept;
+
+        /** @brief Underlying @type_vk{PipelineLayout} handle */
+        VkPipelineLayout handle() const { return _handle; }
+
+    private:
+        Device* _device;
+        VkPipelineLayout _handle;
+};
+
+/**
+@brief Graphics pipeline creation info
+
+Collects the state baked into a graphics pipeline. Viewport and scissor are
+always dynamic and have to be set using @ref CommandBuffer::setViewport() and
+@ref CommandBuffer::setScissor() before drawing, so a single pipeline can be
+used for any framebuffer size. Blending is disabled, depth test and face
+culling are disabled as well unless enabled using @ref setDepthTest() and
+@ref setFaceCulling().
+
+@code{.cpp}
+Vk::Pipeline pipeline{device, Vk::GraphicsPipelineCreateInfo{layout, renderPass}
+    .addShader(Vk::ShaderStage::Vertex, shaders, "vert")
+    .addShader(Vk::ShaderStage::Fragment, shaders, "frag")
+    .setMeshLayout(mesh.layout())
+    .setDepthTest(true)};
+@endcode
+*/
+class MAGNUM_VK_EXPORT GraphicsPipelineCreateInfo {
+    friend Pipeline;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param layout        Pipeline layout
+         * @param renderPass    Render pass the pipeline will be used in
+         * @param subpass       Subpass index
+         *
+         * The primitive defaults to @ref MeshPrimitive::Triangles with no
+         * vertex bindings, use @ref setMeshLayout() to specify the vertex
+         * input. Color attachment count defaults to @cpp 1 @ce.
+         */
+        explicit GraphicsPipelineCreateInfo(const PipelineLayout& layout, VkRenderPass renderPass, UnsignedInt subpass = 0);
+
+        /**
+         * @brief Add a shader stage
+         * @param stage         Shader stage
+         * @param module        Shader module
+         * @param entryPoint    Entry point name
+         * @return Reference to self (for method chaining)
+         *
+         * The module is expected to be alive until the pipeline is created.
+         * Expects that @p stage is not @ref ShaderStage::Compute.
+         */
+        GraphicsPipelineCreateInfo& addShader(ShaderStage stage, const ShaderModule& module, const std::string& entryPoint = "main");
+
+        /**
+         * @brief Set mesh layout
+         * @return Reference to self (for method chaining)
+         *
+         * The layout is copied.
+         */
+        GraphicsPipelineCreateInfo& setMeshLayout(const MeshLayout& layout);
+
+        /** @brief Mesh layout */
+        const MeshLayout& meshLayout() const { return _meshLayout; }
+
+        /**
+         * @brief Set depth test
+         * @param enabled       Whether depth test is enabled
+         * @param write         Whether depth write is enabled
+         * @return Reference to self (for method chaining)
+         *
+         * The depth comparison is @cpp VK_COMPARE_OP_LESS @ce.
+         */
+        GraphicsPipelineCreateInfo& setDepthTest(bool enabled, bool write = true);
+
+        /**
+         * @brief Set back face culling
+         * @return Reference to self (for method chaining)
+         *
+         * Counterclockwise faces are front-facing, same as in OpenGL.
+         */
+        GraphicsPipelineCreateInfo& setFaceCulling(bool enabled);
+
+        /**
+         * @brief Set color attachment count
+         * @return Reference to self (for method chaining)
+         *
+         * Has to match the count of color attachments in the subpass.
+         */
+        GraphicsPipelineCreateInfo& setColorAttachmentCount(UnsignedInt count);
+
+    private:
+        struct Stage {
+            ShaderStage stage;
+            VkShaderModule module;
+            std::string entryPoint;
+        };
+
+        VkPipelineLayout _layout;
+        VkRenderPass _renderPass;
+        UnsignedInt _subpass;
+        std::vector<Stage> _stages;
+        MeshLayout _meshLayout;
+        bool _depthTest, _depthWrite, _faceCulling;
+        UnsignedInt _colorAttachmentCount;
+};
+
+/**
+@brief Compute pipeline creation info
+
+@see @ref Pipeline
+*/
+class MAGNUM_VK_EXPORT ComputePipelineCreateInfo {
+    friend Pipeline;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param layout        Pipeline layout
+         * @param module        Shader module
+         * @param entryPoint    Entry point name
+         *
+         * The module is expected to be alive until the pipeline is created.
+         */
+        explicit ComputePipelineCreateInfo(const PipelineLayout& layout, const ShaderModule& module, const std::string& entryPoint = "main");
+
+    private:
+        VkPipelineLayout _layout;
+        VkShaderModule _module;
+        std::string _entryPoint;
+};
+
+/**
+@brief Pipeline bind point
+
+Wraps @type_vk{PipelineBindPoint}.
+@see @ref Pipeline::bindPoint()
+*/
+enum class PipelineBindPoint: Int {
+    Graphics = VK_PIPELINE_BIND_POINT_GRAPHICS,     /**< Graphics pipeline */
+    Compute = VK_PIPELINE_BIND_POINT_COMPUTE        /**< Compute pipeline */
+};
+
+/** @debugoperatorenum{PipelineBindPoint} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, PipelineBindPoint value);
+
+/**
+@brief Pipeline
+
+Wraps a @type_vk{Pipeline}. Created either from a
+@ref GraphicsPipelineCreateInfo or a @ref ComputePipelineCreateInfo and bound
+using @ref CommandBuffer::bindPipeline(). Pipelines are immutable and can be
+bound in command buffers recorded from any number of threads at the same
+time.
+*/
+class MAGNUM_VK_EXPORT Pipeline {
+    public:
+        /**
+         * @brief Construct a graphics pipeline
+         *
+         * @see @fn_vk{CreateGraphicsPipelines}
+         */
+        explicit Pipeline(Device& device, const GraphicsPipelineCreateInfo& info);
+
+        /**
+         * @brief Construct a graphics pipeline using a pipeline cache
+         *
+         * See @ref PipelineCache for more information.
+         * @see @fn_vk{CreateGraphicsPipelines}
+         */
+        explicit Pipeline(Device& device, const GraphicsPipelineCreateInfo& info, PipelineCache& cache);
+
+        /**
+         * @brief Construct a compute pipeline
+         *
+         * @see @fn_vk{CreateComputePipelines}
+         */
+        explicit Pipeline(Device& device, const ComputePipelineCreateInfo& info);
+
+        /**
+         * @brief Construct a compute pipeline using a pipeline cache
+         *
+         * See @ref PipelineCache for more information.
+         * @see @fn_vk{CreateComputePipelines}
+         */
+        explicit Pipeline(Device& device, const ComputePipelineCreateInfo& info, PipelineCache& cache);
+
+        /**
+         * @brief Construct without creating the pipeline
+         *
+         * The constructed instance is equivalent to moved-from state. Move
+         * another object over it to make it useful.
+         */
+        explicit Pipeline(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        Pipeline(const Pipeline&) = delete;
+
+        /** @brief Move constructor */
+        Pipeline(Pipeline&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * @see @fn_vk{DestroyPipeline}
+         */
+        ~Pipeline();
+
+        /** @brief Copying is not allowed */
+        Pipeline& operator=(const Pipeline&) = delete;
+
+        /** @brief Move assignment */
+        Pipeline& operator=(Pipeline&& other) noexcept;
+
+        /** @brief Underlying @type_vk{Pipeline} handle */
+        VkPipeline handle() const { return _handle; }
+
+        /** @brief Pipeline bind point */
+        PipelineBindPoint bindPoint() const { return _bindPoint; }
+
+    private:
+        explicit Pipeline(Device& device, const GraphicsPipelineCreateInfo& info, VkPipelineCache cache);
+        explicit Pipeline(Device& device, const ComputePipelineCreateInfo& info, VkPipelineCache cache);
+
+        Device* _device;
+        VkPipeline _handle;
+        PipelineBindPoint _bindPoint;
+};
+
+}}
+
+#endif
@@ -0,0 +1,194 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PipelineCache.h"
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/Implementation/Assert.h"
+
+namespace Magnum { namespace Vk {
+
+namespace {
+
+/* Layout of VK_PIPELINE_CACHE_HEADER_VERSION_ONE, all values little-endian
+   on every platform Vulkan runs on */
+struct CacheHeader {
+    UnsignedInt headerSize;
+    UnsignedInt headerVersion;
+    UnsignedInt vendorID;
+    UnsignedInt deviceID;
+    UnsignedByte pipelineCacheUUID[VK_UUID_SIZE];
+};
+
+static_assert(sizeof(CacheHeader) == 16 + VK_UUID_SIZE, "improper size of the cache header");
+
+template<class Info> std::vector<Pipeline> warmupImplementation(Device& device, PipelineCache& cache, const Containers::ArrayView<const Info> infos, const UnsignedInt threadCount) {
+    std::vector<Pipeline> pipelines;
+    pipelines.reserve(infos.size());
+    for(std::size_t i = 0; i != infos.size(); ++i)
+        pipelines.emplace_back(NoCreate);
+
+    /* Each pipeline is a separate task, as their compilation times differ
+       wildly, and writes to a different slot in the output */
+    std::atomic<std::size_t> next{0};
+    auto worker = [&device, &cache, &pipelines, &next, infos]() {
+        for(std::size_t i; (i = next++) < infos.size(); )
+            pipelines[i] = Pipeline{device, infos[i], cache};
+    };
+
+    std::vector<std::thread> threads;
+    const std::size_t workerCount = Math::min(std::size_t(threadCount), infos.size());
+    for(std::size_t i = 1; i < workerCount; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for(std::thread& thread: threads) thread.join();
+
+    return pipelines;
+}
+
+}
+
+std::string PipelineCache::key(const VkPhysicalDeviceProperties& properties) {
+    constexpr const char hex[] = "0123456789abcdef";
+
+    std::string out;
+    out.reserve(VK_UUID_SIZE*2 + 9);
+    for(std::size_t i = 0; i != VK_UUID_SIZE; ++i) {
+        out += hex[properties.pipelineCacheUUID[i] >> 4];
+        out += hex[properties.pipelineCacheUUID[i] & 0xf];
+    }
+    out += '-';
+    for(Int i = 28; i >= 0; i -= 4)
+        out += hex[(properties.driverVersion >> i) & 0xf];
+
+    return out;
+}
+
+std::string PipelineCache::key(const DeviceProperties& properties) {
+    return key(properties.properties());
+}
+
+bool PipelineCache::isCompatible(const VkPhysicalDeviceProperties& properties, const Containers::ArrayView<const void> data) {
+    CacheHeader header;
+    if(data.size() < sizeof(header)) return false;
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    return header.headerSize >= sizeof(header) &&
+        header.headerSize <= data.size() &&
+        header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+        header.vendorID == properties.vendorID &&
+        header.deviceID == properties.deviceID &&
+        std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+bool PipelineCache::isCompatible(const DeviceProperties& properties, const Containers::ArrayView<const void> data) {
+    return isCompatible(properties.properties(), data);
+}
+
+PipelineCache PipelineCache::load(Device& device, const std::string& directory) {
+    const std::string filename = Utility::Directory::join(directory, key(device.properties()) + ".bin");
+    if(!Utility::Directory::fileExists(filename)) return PipelineCache{device};
+
+    const Containers::Array<char> data = Utility::Directory::read(filename);
+    return PipelineCache{device, data};
+}
+
+PipelineCache::PipelineCache(Device& device, Containers::ArrayView<const void> data): _device{&device}, _handle{}, _flags{HandleFlag::DestroyOnDestruction} {
+    if(!data.empty() && !isCompatible(device.properties(), data)) {
+        Warning{} << "Vk::PipelineCache: ignoring data incompatible with" << device.properties().name();
+        data = nullptr;
+    }
+
+    VkPipelineCacheCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    info.initialDataSize = data.size();
+    info.pInitialData = data.data();
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(device->CreatePipelineCache(device.handle(), &info, nullptr, &_handle));
+}
+
+PipelineCache::PipelineCache(NoCreateT) noexcept: _device{}, _handle{}, _flags{HandleFlag::DestroyOnDestruction} {}
+
+PipelineCache::PipelineCache(PipelineCache&& other) noexcept: _device{other._device}, _handle{other._handle}, _flags{other._flags} {
+    other._handle = {};
+}
+
+PipelineCache::~PipelineCache() {
+    if(_handle && (_flags & HandleFlag::DestroyOnDestruction))
+        (*_device)->DestroyPipelineCache(_device->handle(), _handle, nullptr);
+}
+
+PipelineCache& PipelineCache::operator=(PipelineCache&& other) noexcept {
+    using std::swap;
+    swap(other._device, _device);
+    swap(other._handle, _handle);
+    swap(other._flags, _flags);
+    return *this;
+}
+
+Containers::Array<char> PipelineCache::data() const {
+    std::size_t size;
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT((*_device)->GetPipelineCacheData(_device->handle(), _handle, &size, nullptr));
+
+    Containers::Array<char> out{size};
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT((*_device)->GetPipelineCacheData(_device->handle(), _handle, &size, out.data()));
+    return out;
+}
+
+bool PipelineCache::save(const std::string& directory) const {
+    const Containers::Array<char> data = this->data();
+    if(data.empty()) return false;
+
+    if(!Utility::Directory::mkpath(directory)) return false;
+    return Utility::Directory::write(Utility::Directory::join(directory, key(_device->properties()) + ".bin"), data);
+}
+
+PipelineCache& PipelineCache::merge(std::initializer_list<std::reference_wrapper<const PipelineCache>> caches) {
+    std::vector<VkPipelineCache> handles;
+    handles.reserve(caches.size());
+    for(const PipelineCache& cache: caches) handles.push_back(cache._handle);
+
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT((*_device)->MergePipelineCaches(_device->handle(), _handle, handles.size(), handles.data()));
+    return *this;
+}
+
+std::vector<Pipeline> PipelineCache::warmup(const Containers::ArrayView<const GraphicsPipelineCreateInfo> infos, const UnsignedInt threadCount) {
+    return warmupImplementation(*_device, *this, infos, threadCount);
+}
+
+std::vector<Pipeline> PipelineCache::warmup(const Containers::ArrayView<const ComputePipelineCreateInfo> infos, const UnsignedInt threadCount) {
+    return warmupImplementation(*_device, *this, infos, threadCount);
+}
+
+}}
@@ -0,0 +1,234 @@
+#ifndef Magnum_Vk_PipelineCache_h
+#define Magnum_Vk_PipelineCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::PipelineCache
+ */
+
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Handle.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Pipeline cache
+
+Wraps a @type_vk{PipelineCache}. Creating a pipeline compiles its shaders to
+the device-specific code, which can take a significant amount of time,
+especially on mobile drivers. Pipelines created with a cache store the
+compiled code in it and when the same pipeline is created again, the driver
+can reuse it instead of compiling again. Serializing the cache to disk then
+makes the compilation happen only on the first run.
+
+@section Vk-PipelineCache-usage Usage
+
+Load the cache from a writable directory on startup, pass it to all
+@ref Pipeline constructors and save it back on shutdown:
+
+@code{.cpp}
+const std::string directory = Utility::Directory::join(
+    Utility::Directory::configurationDir("MyApp"), "pipelines");
+Vk::PipelineCache cache = Vk::PipelineCache::load(device, directory);
+
+Vk::Pipeline pipeline{device, pipelineInfo, cache};
+
+// ...
+
+cache.save(directory);
+@endcode
+
+The file is named after @ref key(), which combines the
+@cb{.cpp} VkPhysicalDeviceProperties::pipelineCacheUUID @ce with the driver
+version, so a driver update or a different GPU simply starts with an empty
+cache. Besides that, the header of the data is checked against the device
+using @ref isCompatible() before it's passed to the driver, as some drivers
+are known to crash on data created by a different driver version.
+
+@section Vk-PipelineCache-warmup Warming up the cache
+
+To avoid hitches when a material first appears on screen, the pipelines
+known to be needed can be created upfront using @ref warmup(), which
+distributes the work over multiple threads. The pipeline cache is
+internally synchronized, so concurrent pipeline creation with the same
+cache is safe:
+
+@code{.cpp}
+std::vector<Vk::GraphicsPipelineCreateInfo> permutations;
+// fill with all shader and vertex layout combinations ...
+
+std::vector<Vk::Pipeline> pipelines = cache.warmup(
+    {permutations.data(), permutations.size()},
+    std::thread::hardware_concurrency());
+@endcode
+
+The returned pipelines can be either used directly or discarded, in which
+case a subsequent creation of the same pipeline is satisfied from the cache.
+*/
+class MAGNUM_VK_EXPORT PipelineCache {
+    public:
+        /**
+         * @brief Cache key for given device
+         *
+         * Returns a hexadecimal representation of
+         * @cb{.cpp} VkPhysicalDeviceProperties::pipelineCacheUUID @ce
+         * followed by a dash and a hexadecimal representation of
+         * @cb{.cpp} VkPhysicalDeviceProperties::driverVersion @ce.
+         */
+        static std::string key(const VkPhysicalDeviceProperties& properties);
+
+        /** @overload */
+        static std::string key(const DeviceProperties& properties);
+
+        /**
+         * @brief Whether pipeline cache data are compatible with given device
+         *
+         * Returns @cpp true @ce if @p data start with a valid
+         * @type_vk{PipelineCacheHeaderVersion} @cpp VK_PIPELINE_CACHE_HEADER_VERSION_ONE @ce
+         * header whose vendor ID, device ID and pipeline cache UUID match
+         * @p properties, @cpp false @ce otherwise.
+         */
+        static bool isCompatible(const VkPhysicalDeviceProperties& properties, Containers::ArrayView<const void> data);
+
+        /** @overload */
+        static bool isCompatible(const DeviceProperties& properties, Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Load the cache from a directory
+         * @param device    Device to create the cache on
+         * @param directory Directory to load the cache from
+         *
+         * Loads a file named @ref key() with a @cpp .bin @ce extension from
+         * @p directory. If the file doesn't exist, creates an empty cache.
+         * @see @ref save()
+         */
+        static PipelineCache load(Device& device, const std::string& directory);
+
+        /**
+         * @brief Constructor
+         * @param device    Device to create the cache on
+         * @param data      Initial cache data
+         *
+         * If @p data are not empty and not @ref isCompatible() "compatible"
+         * with @p device, a warning is printed and an empty cache is created
+         * instead. The data are copied by the driver and don't need to be
+         * kept alive afterwards.
+         * @see @fn_vk{CreatePipelineCache}
+         */
+        explicit PipelineCache(Device& device, Containers::ArrayView<const void> data = nullptr);
+
+        /**
+         * @brief Construct without creating the cache
+         *
+         * The constructed instance is equivalent to moved-from state. Move
+         * another object over it to make it useful.
+         */
+        explicit PipelineCache(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        PipelineCache(const PipelineCache&) = delete;
+
+        /** @brief Move constructor */
+        PipelineCache(PipelineCache&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * @see @fn_vk{DestroyPipelineCache}
+         */
+        ~PipelineCache();
+
+        /** @brief Copying is not allowed */
+        PipelineCache& operator=(const PipelineCache&) = delete;
+
+        /** @brief Move assignment */
+        PipelineCache& operator=(PipelineCache&& other) noexcept;
+
+        /** @brief Underlying @type_vk{PipelineCache} handle */
+        VkPipelineCache handle() const { return _handle; }
+
+        /** @brief Handle flags */
+        HandleFlags handleFlags() const { return _flags; }
+
+        /**
+         * @brief Cache data
+         *
+         * @see @fn_vk{GetPipelineCacheData}
+         */
+        Containers::Array<char> data() const;
+
+        /**
+         * @brief Save the cache to a directory
+         *
+         * Writes @ref data() to a file named @ref key() with a @cpp .bin @ce
+         * extension in @p directory, creating the directory if it doesn't
+         * exist. Returns @cpp false @ce if the driver doesn't provide any
+         * data or if the file can't be written, @cpp true @ce otherwise.
+         * @see @ref load()
+         */
+        bool save(const std::string& directory) const;
+
+        /**
+         * @brief Merge other caches into this one
+         * @return Reference to self (for method chaining)
+         *
+         * @see @fn_vk{MergePipelineCaches}
+         */
+        PipelineCache& merge(std::initializer_list<std::reference_wrapper<const PipelineCache>> caches);
+
+        /**
+         * @brief Create graphics pipelines using this cache
+         * @param infos         Pipelines to create
+         * @param threadCount   Count of threads to create the pipelines on,
+         *      including the calling thread
+         *
+         * Returns the pipelines in the same order as @p infos. Value of
+         * @cpp 0 @ce for @p threadCount is treated the same as @cpp 1 @ce.
+         * See @ref Vk-PipelineCache-warmup for more information.
+         */
+        std::vector<Pipeline> warmup(Containers::ArrayView<const GraphicsPipelineCreateInfo> infos, UnsignedInt threadCount = 1);
+
+        /** @overload */
+        std::vector<Pipeline> warmup(Containers::ArrayView<const ComputePipelineCreateInfo> infos, UnsignedInt threadCount = 1);
+
+    private:
+        Device* _device;
+        VkPipelineCache _handle;
+        HandleFlags _flags;
+};
+
+}}
+
+#endif
@@ -0,0 +1,59 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Queue.h"
+
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/Implementation/Assert.h"
+
+namespace Magnum { namespace Vk {
+
+Queue::Queue(const FlextVkDevice& functionPointers, const VkQueue handle, const UnsignedInt family) noexcept: _functionPointers(functionPointers), _handle{handle}, _family{family} {}
+
+void Queue::submit(const Containers::ArrayView<const VkCommandBuffer> commandBuffers, const VkFence fence) {
+    VkSubmitInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    info.commandBufferCount = commandBuffers.size();
+    info.pCommandBuffers = commandBuffers.data();
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(_functionPointers.QueueSubmit(_handle, 1, &info, fence));
+}
+
+void Queue::submit(std::initializer_list<VkCommandBuffer> commandBuffers, const VkFence fence) {
+    submit(Containers::arrayView(commandBuffers.begin(), commandBuffers.size()), fence);
+}
+
+void Queue::submit(CommandBuffer& commandBuffer, const VkFence fence) {
+    const VkCommandBuffer handle = commandBuffer.handle();
+    submit(Containers::arrayView(&handle, 1), fence);
+}
+
+void Queue::waitIdle() {
+    std::lock_guard<std::mutex> lock{_mutex};
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(_functionPointers.QueueWaitIdle(_handle));
+}
+
+}}
@@ -0,0 +1,115 @@
+#ifndef Magnum_Vk_Queue_h
+#define Magnum_Vk_Queue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::Queue
+ */
+
+#include <initializer_list>
+#include <mutex>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Queue
+
+Wraps a @type_vk{Queue}. Queues are owned by the @ref Device and retrieved
+using @ref Device::queue(), so the class is neither copyable nor movable.
+
+Vulkan requires access to a queue to be externally synchronized. This class
+guards @ref submit() and @ref waitIdle() with a mutex, so a single queue can
+be submitted to from multiple threads, each recording its own command
+buffers. See @ref Vk-Device-multithreading for more information.
+*/
+class MAGNUM_VK_EXPORT Queue {
+    friend Device;
+
+    public:
+        /** @brief Copying is not allowed */
+        Queue(const Queue&) = delete;
+
+        /** @brief Moving is not allowed */
+        Queue(Queue&&) = delete;
+
+        /** @brief Copying is not allowed */
+        Queue& operator=(const Queue&) = delete;
+
+        /** @brief Moving is not allowed */
+        Queue& operator=(Queue&&) = delete;
+
+        /** @brief Underlying @type_vk{Queue} handle */
+        VkQueue handle() { return _handle; }
+
+        /** @brief Family index of the queue */
+        UnsignedInt family() const { return _family; }
+
+        /**
+         * @brief Submit command buffers
+         * @param commandBuffers    Command buffers to submit. The buffers are
+         *      expected to be in an executable state, i.e. with
+         *      @ref CommandBuffer::end() called.
+         * @param fence             Fence to signal once all command buffers
+         *      complete execution or @cpp VK_NULL_HANDLE @ce
+         *
+         * Thread-safe. The buffers are submitted in a single batch with no
+         * semaphores.
+         * @see @fn_vk{QueueSubmit}
+         */
+        void submit(Containers::ArrayView<const VkCommandBuffer> commandBuffers, VkFence fence = VK_NULL_HANDLE);
+
+        /** @overload */
+        void submit(std::initializer_list<VkCommandBuffer> commandBuffers, VkFence fence = VK_NULL_HANDLE);
+
+        /** @overload */
+        void submit(CommandBuffer& commandBuffer, VkFence fence = VK_NULL_HANDLE);
+
+        /**
+         * @brief Wait for the queue to become idle
+         *
+         * Thread-safe.
+         * @see @fn_vk{QueueWaitIdle}
+         */
+        void waitIdle();
+
+    private:
+        explicit Queue(const FlextVkDevice& functionPointers, VkQueue handle, UnsignedInt family) noexcept;
+
+        const FlextVkDevice& _functionPointers;
+        VkQueue _handle;
+        UnsignedInt _family;
+        std::mutex _mutex;
+};
+
+}}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef Magnum_Vk_Result_h
+#define Magnum_Vk_Result_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Enum @ref Magnum::Vk::Result
+ */
+
+#include <Corrade/Utility/Utility.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Vulkan call result
+
+Wraps a @type_vk{Result}. Positive values are non-error status codes,
+negative values are errors.
+*/
+enum class Result: Int {
+    Success = VK_SUCCESS,           /**< Command successfully completed */
+    NotReady = VK_NOT_READY,        /**< A fence or query has not yet completed */
+    Timeout = VK_TIMEOUT,           /**< A wait operation has not completed in the specified time */
+    EventSet = VK_EVENT_SET,        /**< An event is signaled */
+    EventReset = VK_EVENT_RESET,    /**< An event is unsignaled */
+    Incomplete = VK_INCOMPLETE,     /**< A return array was too small for the result */
+
+    /** A host memory allocation has failed */
+    ErrorOutOfHostMemory = VK_ERROR_OUT_OF_HOST_MEMORY,
+
+    /** A device memory allocation has failed */
+    ErrorOutOfDeviceMemory = VK_ERROR_OUT_OF_DEVICE_MEMORY,
+
+    /** Initialization of an object could not be completed */
+    ErrorInitializationFailed = VK_ERROR_INITIALIZATION_FAILED,
+
+    /** The logical or physical device has been lost */
+    ErrorDeviceLost = VK_ERROR_DEVICE_LOST,
+
+    /** Mapping of a memory object has failed */
+    ErrorMemoryMapFailed = VK_ERROR_MEMORY_MAP_FAILED,
+
+    /** A requested layer is not present or could not be loaded */
+    ErrorLayerNotPresent = VK_ERROR_LAYER_NOT_PRESENT,
+
+    /** A requested extension is not supported */
+    ErrorExtensionNotPresent = VK_ERROR_EXTENSION_NOT_PRESENT,
+
+    /** A requested feature is not supported */
+    ErrorFeatureNotPresent = VK_ERROR_FEATURE_NOT_PRESENT,
+
+    /** The requested version of Vulkan is not supported by the driver */
+    ErrorIncompatibleDriver = VK_ERROR_INCOMPATIBLE_DRIVER,
+
+    /** Too many objects of the type have already been created */
+    ErrorTooManyObjects = VK_ERROR_TOO_MANY_OBJECTS,
+
+    /** A requested format is not supported on this device */
+    ErrorFormatNotSupported = VK_ERROR_FORMAT_NOT_SUPPORTED,
+
+    /** A pool allocation has failed due to fragmentation */
+    ErrorFragmentedPool = VK_ERROR_FRAGMENTED_POOL,
+
+    /** A pool memory allocation has failed */
+    ErrorOutOfPoolMemory = VK_ERROR_OUT_OF_POOL_MEMORY
+};
+
+/** @debugoperatorenum{Result} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, Result value);
+
+}}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShaderModule.h"
+
+#include <utility>
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/Implementation/Assert.h"
+
+namespace Magnum { namespace Vk {
+
+ShaderModule::ShaderModule(Device& device, const Containers::ArrayView<const void> code): _device{&device}, _handle{}, _flags{HandleFlag::DestroyOnDestruction} {
+    CORRADE_ASSERT(code.size() % 4 == 0,
+        "Vk::ShaderModule: SPIR-V code size expected to be a multiple of four bytes, got" << code.size(), );
+
+    VkShaderModuleCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    info.codeSize = code.size();
+    info.pCode = static_cast<const UnsignedInt*>(code.data());
+    MAGNUM_VK_INTERNAL_ASSERT_RESULT(device->CreateShaderModule(device.handle(), &info, nullptr, &_handle));
+}
+
+ShaderModule::ShaderModule(NoCreateT) noexcept: _device{}, _handle{}, _flags{HandleFlag::DestroyOnDestruction} {}
+
+ShaderModule::ShaderModule(ShaderModule&& other) noexcept: _device{other._device}, _handle{other._handle}, _flags{other._flags} {
+    other._handle = {};
+}
+
+ShaderModule::~ShaderModule() {
+    if(_handle && (_flags & HandleFlag::DestroyOnDestruction))
+        (*_device)->DestroyShaderModule(_device->handle(), _handle, nullptr);
+}
+
+ShaderModule& ShaderModule::operator=(ShaderModule&& other) noexcept {
+    using std::swap;
+    swap(other._device, _device);
+    swap(other._handle, _handle);
+    swap(other._flags, _flags);
+    return *this;
+}
+
+Debug& operator<<(Debug& debug, const ShaderStage value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case ShaderStage::value: return debug << "Vk::ShaderStage::" #value;
+        _c(Vertex)
+        _c(TessellationControl)
+        _c(TessellationEvaluation)
+        _c(Geometry)
+        _c(Fragment)
+        _c(Compute)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Vk::ShaderStage(" << Debug::nospace << reinterpret_cast<void*>(UnsignedInt(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const ShaderStages value) {
+    return Containers::enumSetDebugOutput(debug, value, "Vk::ShaderStages{}", {
+        ShaderStage::Vertex,
+        ShaderStage::TessellationControl,
+        ShaderStage::TessellationEvaluation,
+        ShaderStage::Geometry,
+        ShaderStage::Fragment,
+        ShaderStage::Compute});
+}
+
+}}
@@ -0,0 +1,147 @@
+#ifndef Magnum_Vk_ShaderModule_h
+#define Magnum_Vk_ShaderModule_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::ShaderModule, enum @ref Magnum::Vk::ShaderStage, enum set @ref Magnum::Vk::ShaderStages
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Handle.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/visibility.h"
+#include "MagnumExternal/Vulkan/flextVk.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Shader stage
+
+Wraps @type_vk{ShaderStageFlagBits}.
+@see @ref ShaderStages, @ref GraphicsPipelineCreateInfo::addShader(),
+    @ref ComputePipelineCreateInfo
+*/
+enum class ShaderStage: UnsignedInt {
+    /** Vertex stage */
+    Vertex = VK_SHADER_STAGE_VERTEX_BIT,
+
+    /** Tessellation control stage */
+    TessellationControl = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT,
+
+    /** Tessellation evaluation stage */
+    TessellationEvaluation = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT,
+
+    /** Geometry stage */
+    Geometry = VK_SHADER_STAGE_GEOMETRY_BIT,
+
+    /** Fragment stage */
+    Fragment = VK_SHADER_STAGE_FRAGMENT_BIT,
+
+    /** Compute stage */
+    Compute = VK_SHADER_STAGE_COMPUTE_BIT
+};
+
+/**
+@brief Shader stages
+
+@see @ref CommandBuffer::pushConstants()
+*/
+typedef Containers::EnumSet<ShaderStage> ShaderStages;
+
+CORRADE_ENUMSET_OPERATORS(ShaderStages)
+
+/** @debugoperatorenum{ShaderStage} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, ShaderStage value);
+
+/** @debugoperatorenum{ShaderStages} */
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, ShaderStages value);
+
+/**
+@brief Shader module
+
+Wraps a @type_vk{ShaderModule} created from SPIR-V binary code. The same
+module can contain more than one entry point and can be used for multiple
+stages, see @ref GraphicsPipelineCreateInfo::addShader().
+*/
+class MAGNUM_VK_EXPORT ShaderModule {
+    public:
+        /**
+         * @brief Constructor
+         * @param device    Device to create the module on
+         * @param code      SPIR-V binary code
+         *
+         * Expects that the code size is a multiple of four bytes. The data
+         * are copied by the driver and don't need to be kept alive
+         * afterwards.
+         * @see @fn_vk{CreateShaderModule}
+         */
+        explicit ShaderModule(Device& device, Containers::ArrayView<const void> code);
+
+        /**
+         * @brief Construct without creating the module
+         *
+         * The constructed instance is equivalent to moved-from state. Move
+         * another object over it to make it useful.
+         */
+        explicit ShaderModule(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        ShaderModule(const ShaderModule&) = delete;
+
+        /** @brief Move constructor */
+        ShaderModule(ShaderModule&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * @see @fn_vk{DestroyShaderModule}
+         */
+        ~ShaderModule();
+
+        /** @brief Copying is not allowed */
+        ShaderModule& operator=(const ShaderModule&) = delete;
+
+        /** @brief Move assignment */
+        ShaderModule& operator=(ShaderModule&& other) noexcept;
+
+        /** @brief Underlying @type_vk{ShaderModule} handle */
+        VkShaderModule handle() const { return _handle; }
+
+        /** @brief Handle flags */
+        HandleFlags handleFlags() const { return _flags; }
+
+    private:
+        Device* _device;
+        VkShaderModule _handle;
+        HandleFlags _flags;
+};
+
+}}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Vk/Buffer.h"
+
+namespace Magnum { namespace Vk { namespace Test {
+
+struct BufferTest: TestSuite::Tester {
+    explicit BufferTest();
+
+    void createInfoConstruct();
+
+    void constructNoCreate();
+    void constructCopy();
+
+    void debugUsage();
+    void debugUsages();
+};
+
+BufferTest::BufferTest() {
+    addTests({&BufferTest::createInfoConstruct,
+
+              &BufferTest::constructNoCreate,
+              &BufferTest::constructCopy,
+
+              &BufferTest::debugUsage,
+              &BufferTest::debugUsages});
+}
+
+void BufferTest::createInfoConstruct() {
+    BufferCreateInfo info{BufferUsage::VertexBuffer|BufferUsage::TransferDestination, 1024};
+    CORRADE_COMPARE(info.usages(), BufferUsage::VertexBuffer|BufferUsage::TransferDestination);
+    CORRADE_COMPARE(info.size(), 1024);
+    CORRADE_COMPARE((*info).sType, VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO);
+    CORRADE_COMPARE((*info).usage, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT|VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    CORRADE_COMPARE((*info).sharingMode, VK_SHARING_MODE_EXCLUSIVE);
+}
+
+void BufferTest::constructNoCreate() {
+    {
+        Buffer buffer{NoCreate};
+        CORRADE_VERIFY(!buffer.handle());
+        CORRADE_VERIFY(buffer.handleFlags() == HandleFlag::DestroyOnDestruction);
+        CORRADE_VERIFY(!buffer.memory());
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void BufferTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<Buffer, const Buffer&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<Buffer, const Buffer&>{}));
+}
+
+void BufferTest::debugUsage() {
+    std::ostringstream out;
+    Debug{&out} << BufferUsage::IndexBuffer << BufferUsage(0xdead);
+    CORRADE_COMPARE(out.str(), "Vk::BufferUsage::IndexBuffer Vk::BufferUsage(0xdead)\n");
+}
+
+void BufferTest::debugUsages() {
+    std::ostringstream out;
+    Debug{&out} << (BufferUsage::UniformBuffer|BufferUsage::TransferSource) << BufferUsages{};
+    CORRADE_COMPARE(out.str(), "Vk::BufferUsage::TransferSource|Vk::BufferUsage::UniformBuffer Vk::BufferUsages{}\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::BufferTest)
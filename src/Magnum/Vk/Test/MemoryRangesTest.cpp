@@ -0,0 +1,159 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Vk/Implementation/MemoryRanges.h"
+
+namespace Magnum { namespace Vk { namespace Test {
+
+struct MemoryRangesTest: TestSuite::Tester {
+    explicit MemoryRangesTest();
+
+    void construct();
+    void constructEmpty();
+    void allocate();
+    void allocateAligned();
+    void allocateFull();
+    void allocateTooLarge();
+    void freeCoalesce();
+    void freeCoalesceAligned();
+    void reuse();
+};
+
+MemoryRangesTest::MemoryRangesTest() {
+    addTests({&MemoryRangesTest::construct,
+              &MemoryRangesTest::constructEmpty,
+              &MemoryRangesTest::allocate,
+              &MemoryRangesTest::allocateAligned,
+              &MemoryRangesTest::allocateFull,
+              &MemoryRangesTest::allocateTooLarge,
+              &MemoryRangesTest::freeCoalesce,
+              &MemoryRangesTest::freeCoalesceAligned,
+              &MemoryRangesTest::reuse});
+}
+
+using Implementation::MemoryRanges;
+
+void MemoryRangesTest::construct() {
+    MemoryRanges ranges{1024};
+    CORRADE_COMPARE(ranges.size(), 1024);
+    CORRADE_COMPARE(ranges.used(), 0);
+    CORRADE_VERIFY(ranges.empty());
+    CORRADE_COMPARE(ranges.freeRangeCount(), 1);
+}
+
+void MemoryRangesTest::constructEmpty() {
+    MemoryRanges ranges{0};
+    CORRADE_COMPARE(ranges.freeRangeCount(), 0);
+    CORRADE_COMPARE(ranges.allocate(1, 1), MemoryRanges::NotFound);
+}
+
+void MemoryRangesTest::allocate() {
+    MemoryRanges ranges{1024};
+    CORRADE_COMPARE(ranges.allocate(100, 1), 0);
+    CORRADE_COMPARE(ranges.allocate(200, 1), 100);
+    CORRADE_COMPARE(ranges.used(), 300);
+    CORRADE_VERIFY(!ranges.empty());
+    CORRADE_COMPARE(ranges.freeRangeCount(), 1);
+}
+
+void MemoryRangesTest::allocateAligned() {
+    MemoryRanges ranges{1024};
+    CORRADE_COMPARE(ranges.allocate(100, 1), 0);
+
+    /* The padding between 100 and 256 stays free */
+    CORRADE_COMPARE(ranges.allocate(64, 256), 256);
+    CORRADE_COMPARE(ranges.freeRangeCount(), 2);
+
+    /* And is used by a subsequent allocation that fits */
+    CORRADE_COMPARE(ranges.allocate(100, 4), 100);
+    CORRADE_COMPARE(ranges.used(), 264);
+}
+
+void MemoryRangesTest::allocateFull() {
+    MemoryRanges ranges{1024};
+    CORRADE_COMPARE(ranges.allocate(1024, 256), 0);
+    CORRADE_COMPARE(ranges.freeRangeCount(), 0);
+    CORRADE_COMPARE(ranges.allocate(1, 1), MemoryRanges::NotFound);
+}
+
+void MemoryRangesTest::allocateTooLarge() {
+    MemoryRanges ranges{1024};
+    CORRADE_COMPARE(ranges.allocate(1025, 1), MemoryRanges::NotFound);
+
+    /* Fits in size, but not after alignment */
+    CORRADE_COMPARE(ranges.allocate(10, 1), 0);
+    CORRADE_COMPARE(ranges.allocate(1000, 512), MemoryRanges::NotFound);
+    CORRADE_COMPARE(ranges.used(), 10);
+}
+
+void MemoryRangesTest::freeCoalesce() {
+    MemoryRanges ranges{300};
+    const UnsignedLong a = ranges.allocate(100, 1);
+    const UnsignedLong b = ranges.allocate(100, 1);
+    const UnsignedLong c = ranges.allocate(100, 1);
+    CORRADE_COMPARE(ranges.freeRangeCount(), 0);
+
+    ranges.free(a, 100);
+    ranges.free(c, 100);
+    CORRADE_COMPARE(ranges.freeRangeCount(), 2);
+
+    /* Freeing the middle merges with both neighbors */
+    ranges.free(b, 100);
+    CORRADE_COMPARE(ranges.freeRangeCount(), 1);
+    CORRADE_VERIFY(ranges.empty());
+    CORRADE_COMPARE(ranges.allocate(300, 1), 0);
+}
+
+void MemoryRangesTest::freeCoalesceAligned() {
+    MemoryRanges ranges{1024};
+    const UnsignedLong a = ranges.allocate(100, 1);
+    const UnsignedLong b = ranges.allocate(64, 256);
+    CORRADE_COMPARE(b, 256);
+
+    ranges.free(b, 64);
+    CORRADE_COMPARE(ranges.freeRangeCount(), 1);
+    ranges.free(a, 100);
+    CORRADE_COMPARE(ranges.freeRangeCount(), 1);
+    CORRADE_VERIFY(ranges.empty());
+}
+
+void MemoryRangesTest::reuse() {
+    MemoryRanges ranges{1000};
+    const UnsignedLong a = ranges.allocate(400, 1);
+    ranges.allocate(400, 1);
+    ranges.free(a, 400);
+
+    /* First fit picks the freed range at the beginning */
+    CORRADE_COMPARE(ranges.allocate(300, 1), 0);
+    CORRADE_COMPARE(ranges.allocate(150, 1), 800);
+    CORRADE_COMPARE(ranges.allocate(100, 1), 300);
+    CORRADE_COMPARE(ranges.used(), 950);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::MemoryRangesTest)
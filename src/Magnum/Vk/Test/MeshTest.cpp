@@ -0,0 +1,203 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Vk/Mesh.h"
+
+namespace Magnum { namespace Vk { namespace Test {
+
+struct MeshTest: TestSuite::Tester {
+    explicit MeshTest();
+
+    void mapPrimitive();
+    void mapPrimitiveUnsupported();
+    void mapPrimitiveInvalid();
+    void mapIndexType();
+    void mapIndexTypeUnsupported();
+    void mapIndexTypeInvalid();
+
+    void layoutConstruct();
+    void layoutAddBinding();
+    void layoutAddBindingDuplicate();
+    void layoutAddAttributeNoBinding();
+
+    void construct();
+    void indexTypeNotIndexed();
+};
+
+MeshTest::MeshTest() {
+    addTests({&MeshTest::mapPrimitive,
+              &MeshTest::mapPrimitiveUnsupported,
+              &MeshTest::mapPrimitiveInvalid,
+              &MeshTest::mapIndexType,
+              &MeshTest::mapIndexTypeUnsupported,
+              &MeshTest::mapIndexTypeInvalid,
+
+              &MeshTest::layoutConstruct,
+              &MeshTest::layoutAddBinding,
+              &MeshTest::layoutAddBindingDuplicate,
+              &MeshTest::layoutAddAttributeNoBinding,
+
+              &MeshTest::construct,
+              &MeshTest::indexTypeNotIndexed});
+}
+
+void MeshTest::mapPrimitive() {
+    CORRADE_VERIFY(hasVkPrimitiveTopology(MeshPrimitive::Points));
+    CORRADE_COMPARE(vkPrimitiveTopology(MeshPrimitive::Points), VK_PRIMITIVE_TOPOLOGY_POINT_LIST);
+    CORRADE_COMPARE(vkPrimitiveTopology(MeshPrimitive::Lines), VK_PRIMITIVE_TOPOLOGY_LINE_LIST);
+    CORRADE_COMPARE(vkPrimitiveTopology(MeshPrimitive::LineStrip), VK_PRIMITIVE_TOPOLOGY_LINE_STRIP);
+    CORRADE_COMPARE(vkPrimitiveTopology(MeshPrimitive::Triangles), VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+    CORRADE_COMPARE(vkPrimitiveTopology(MeshPrimitive::TriangleStrip), VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP);
+    CORRADE_COMPARE(vkPrimitiveTopology(MeshPrimitive::TriangleFan), VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN);
+}
+
+void MeshTest::mapPrimitiveUnsupported() {
+    CORRADE_VERIFY(!hasVkPrimitiveTopology(MeshPrimitive::LineLoop));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    vkPrimitiveTopology(MeshPrimitive::LineLoop);
+    CORRADE_COMPARE(out.str(), "Vk::vkPrimitiveTopology(): unsupported primitive MeshPrimitive::LineLoop\n");
+}
+
+void MeshTest::mapPrimitiveInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    hasVkPrimitiveTopology(MeshPrimitive(0x123));
+    vkPrimitiveTopology(MeshPrimitive(0x123));
+    CORRADE_COMPARE(out.str(),
+        "Vk::hasVkPrimitiveTopology(): invalid primitive MeshPrimitive(0x123)\n"
+        "Vk::vkPrimitiveTopology(): invalid primitive MeshPrimitive(0x123)\n");
+}
+
+void MeshTest::mapIndexType() {
+    CORRADE_VERIFY(hasVkIndexType(MeshIndexType::UnsignedShort));
+    CORRADE_COMPARE(vkIndexType(MeshIndexType::UnsignedShort), VK_INDEX_TYPE_UINT16);
+    CORRADE_COMPARE(vkIndexType(MeshIndexType::UnsignedInt), VK_INDEX_TYPE_UINT32);
+}
+
+void MeshTest::mapIndexTypeUnsupported() {
+    CORRADE_VERIFY(!hasVkIndexType(MeshIndexType::UnsignedByte));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    vkIndexType(MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE(out.str(), "Vk::vkIndexType(): unsupported type MeshIndexType::UnsignedByte\n");
+}
+
+void MeshTest::mapIndexTypeInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    hasVkIndexType(MeshIndexType(0x123));
+    vkIndexType(MeshIndexType(0x123));
+    CORRADE_COMPARE(out.str(),
+        "Vk::hasVkIndexType(): invalid type MeshIndexType(0x123)\n"
+        "Vk::vkIndexType(): invalid type MeshIndexType(0x123)\n");
+}
+
+void MeshTest::layoutConstruct() {
+    MeshLayout layout{MeshPrimitive::TriangleStrip};
+    CORRADE_COMPARE(layout.primitive(), MeshPrimitive::TriangleStrip);
+    CORRADE_VERIFY(layout.bindings().empty());
+    CORRADE_VERIFY(layout.attributes().empty());
+}
+
+void MeshTest::layoutAddBinding() {
+    MeshLayout layout{MeshPrimitive::Triangles};
+    layout.addBinding(0, 24)
+        .addInstancedBinding(3, 64)
+        .addAttribute(0, 0, VK_FORMAT_R32G32B32_SFLOAT, 0)
+        .addAttribute(2, 0, VK_FORMAT_R32G32B32_SFLOAT, 12)
+        .addAttribute(4, 3, VK_FORMAT_R32G32B32A32_SFLOAT, 0);
+
+    CORRADE_VERIFY(layout.hasBinding(0));
+    CORRADE_VERIFY(!layout.hasBinding(1));
+    CORRADE_VERIFY(layout.hasBinding(3));
+
+    CORRADE_COMPARE(layout.bindings().size(), 2);
+    CORRADE_COMPARE(layout.bindings()[0].binding, 0);
+    CORRADE_COMPARE(layout.bindings()[0].stride, 24);
+    CORRADE_COMPARE(layout.bindings()[0].inputRate, VK_VERTEX_INPUT_RATE_VERTEX);
+    CORRADE_COMPARE(layout.bindings()[1].binding, 3);
+    CORRADE_COMPARE(layout.bindings()[1].stride, 64);
+    CORRADE_COMPARE(layout.bindings()[1].inputRate, VK_VERTEX_INPUT_RATE_INSTANCE);
+
+    CORRADE_COMPARE(layout.attributes().size(), 3);
+    CORRADE_COMPARE(layout.attributes()[1].location, 2);
+    CORRADE_COMPARE(layout.attributes()[1].binding, 0);
+    CORRADE_COMPARE(layout.attributes()[1].format, VK_FORMAT_R32G32B32_SFLOAT);
+    CORRADE_COMPARE(layout.attributes()[1].offset, 12);
+    CORRADE_COMPARE(layout.attributes()[2].location, 4);
+    CORRADE_COMPARE(layout.attributes()[2].binding, 3);
+}
+
+void MeshTest::layoutAddBindingDuplicate() {
+    MeshLayout layout{MeshPrimitive::Triangles};
+    layout.addBinding(1, 16);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    layout.addInstancedBinding(1, 16);
+    CORRADE_COMPARE(out.str(), "Vk::MeshLayout::addBinding(): binding 1 already added\n");
+}
+
+void MeshTest::layoutAddAttributeNoBinding() {
+    MeshLayout layout{MeshPrimitive::Triangles};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    layout.addAttribute(0, 2, VK_FORMAT_R32G32_SFLOAT, 0);
+    CORRADE_COMPARE(out.str(), "Vk::MeshLayout::addAttribute(): binding 2 not added\n");
+}
+
+void MeshTest::construct() {
+    Mesh mesh{MeshLayout{MeshPrimitive::Lines}};
+    CORRADE_COMPARE(mesh.layout().primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(mesh.count(), 0);
+    CORRADE_COMPARE(mesh.instanceCount(), 1);
+    CORRADE_COMPARE(mesh.vertexBufferCount(), 0);
+    CORRADE_VERIFY(!mesh.isIndexed());
+
+    mesh.setCount(15)
+        .setInstanceCount(3);
+    CORRADE_COMPARE(mesh.count(), 15);
+    CORRADE_COMPARE(mesh.instanceCount(), 3);
+}
+
+void MeshTest::indexTypeNotIndexed() {
+    Mesh mesh{MeshLayout{MeshPrimitive::Lines}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    mesh.indexType();
+    CORRADE_COMPARE(out.str(), "Vk::Mesh::indexType(): the mesh is not indexed\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::MeshTest)
@@ -0,0 +1,179 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Vk/PipelineCache.h"
+
+namespace Magnum { namespace Vk { namespace Test {
+
+struct PipelineCacheTest: TestSuite::Tester {
+    explicit PipelineCacheTest();
+
+    void key();
+
+    void compatible();
+    void compatibleTooShort();
+    void compatibleInvalidHeaderSize();
+    void compatibleInvalidHeaderVersion();
+    void compatibleDifferentDevice();
+    void compatibleDifferentUuid();
+
+    void constructNoCreate();
+    void constructCopy();
+};
+
+PipelineCacheTest::PipelineCacheTest() {
+    addTests({&PipelineCacheTest::key,
+
+              &PipelineCacheTest::compatible,
+              &PipelineCacheTest::compatibleTooShort,
+              &PipelineCacheTest::compatibleInvalidHeaderSize,
+              &PipelineCacheTest::compatibleInvalidHeaderVersion,
+              &PipelineCacheTest::compatibleDifferentDevice,
+              &PipelineCacheTest::compatibleDifferentUuid,
+
+              &PipelineCacheTest::constructNoCreate,
+              &PipelineCacheTest::constructCopy});
+}
+
+namespace {
+
+VkPhysicalDeviceProperties deviceProperties() {
+    VkPhysicalDeviceProperties properties{};
+    properties.vendorID = 0x10de;
+    properties.deviceID = 0x1c82;
+    properties.driverVersion = 0x6a1c4000;
+    for(std::size_t i = 0; i != VK_UUID_SIZE; ++i)
+        properties.pipelineCacheUUID[i] = i*17;
+    return properties;
+}
+
+/* Header followed by eight bytes of payload */
+void cacheData(char* out, const VkPhysicalDeviceProperties& properties) {
+    const UnsignedInt header[]{16 + VK_UUID_SIZE, VK_PIPELINE_CACHE_HEADER_VERSION_ONE, properties.vendorID, properties.deviceID};
+    std::memcpy(out, header, sizeof(header));
+    std::memcpy(out + sizeof(header), properties.pipelineCacheUUID, VK_UUID_SIZE);
+    std::memset(out + sizeof(header) + VK_UUID_SIZE, 0xcd, 8);
+}
+
+}
+
+void PipelineCacheTest::key() {
+    CORRADE_COMPARE(PipelineCache::key(deviceProperties()),
+        "00112233445566778899aabbccddeeff-6a1c4000");
+}
+
+void PipelineCacheTest::compatible() {
+    const VkPhysicalDeviceProperties properties = deviceProperties();
+    char data[16 + VK_UUID_SIZE + 8];
+    cacheData(data, properties);
+    CORRADE_VERIFY(PipelineCache::isCompatible(properties, data));
+
+    /* Just the header is fine too */
+    CORRADE_VERIFY(PipelineCache::isCompatible(properties, {data, 16 + VK_UUID_SIZE}));
+}
+
+void PipelineCacheTest::compatibleTooShort() {
+    const VkPhysicalDeviceProperties properties = deviceProperties();
+    char data[16 + VK_UUID_SIZE + 8];
+    cacheData(data, properties);
+    CORRADE_VERIFY(!PipelineCache::isCompatible(properties, nullptr));
+    CORRADE_VERIFY(!PipelineCache::isCompatible(properties, {data, 16 + VK_UUID_SIZE - 1}));
+}
+
+void PipelineCacheTest::compatibleInvalidHeaderSize() {
+    const VkPhysicalDeviceProperties properties = deviceProperties();
+    char data[16 + VK_UUID_SIZE + 8];
+    cacheData(data, properties);
+
+    /* Header size smaller than the version one header */
+    UnsignedInt size = 16;
+    std::memcpy(data, &size, 4);
+    CORRADE_VERIFY(!PipelineCache::isCompatible(properties, data));
+
+    /* Header size larger than the data */
+    size = sizeof(data) + 1;
+    std::memcpy(data, &size, 4);
+    CORRADE_VERIFY(!PipelineCache::isCompatible(properties, data));
+}
+
+void PipelineCacheTest::compatibleInvalidHeaderVersion() {
+    const VkPhysicalDeviceProperties properties = deviceProperties();
+    char data[16 + VK_UUID_SIZE + 8];
+    cacheData(data, properties);
+
+    const UnsignedInt version = 2;
+    std::memcpy(data + 4, &version, 4);
+    CORRADE_VERIFY(!PipelineCache::isCompatible(properties, data));
+}
+
+void PipelineCacheTest::compatibleDifferentDevice() {
+    VkPhysicalDeviceProperties properties = deviceProperties();
+    char data[16 + VK_UUID_SIZE + 8];
+    cacheData(data, properties);
+
+    properties.deviceID = 0x1c83;
+    CORRADE_VERIFY(!PipelineCache::isCompatible(properties, data));
+
+    properties = deviceProperties();
+    properties.vendorID = 0x1002;
+    CORRADE_VERIFY(!PipelineCache::isCompatible(properties, data));
+
+    /* Driver version is not part of the header, only of the key */
+    properties = deviceProperties();
+    properties.driverVersion = 0x6a1c4001;
+    CORRADE_VERIFY(PipelineCache::isCompatible(properties, data));
+    CORRADE_VERIFY(PipelineCache::key(properties) != PipelineCache::key(deviceProperties()));
+}
+
+void PipelineCacheTest::compatibleDifferentUuid() {
+    VkPhysicalDeviceProperties properties = deviceProperties();
+    char data[16 + VK_UUID_SIZE + 8];
+    cacheData(data, properties);
+
+    properties.pipelineCacheUUID[VK_UUID_SIZE - 1] ^= 0x01;
+    CORRADE_VERIFY(!PipelineCache::isCompatible(properties, data));
+}
+
+void PipelineCacheTest::constructNoCreate() {
+    {
+        PipelineCache cache{NoCreate};
+        CORRADE_VERIFY(!cache.handle());
+        CORRADE_VERIFY(cache.handleFlags() == HandleFlag::DestroyOnDestruction);
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void PipelineCacheTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<PipelineCache, const PipelineCache&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<PipelineCache, const PipelineCache&>{}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::PipelineCacheTest)
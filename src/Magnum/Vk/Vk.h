@@ -29,9 +29,44 @@
  * @brief Forward declarations for the @ref Magnum::Vk namespace
  */
 
-namespace Magnum { namespace Vk {
+#include "Magnum/Types.h"
 
+namespace Magnum { namespace Vk {
 
+#ifndef DOXYGEN_GENERATING_OUTPUT
+class Buffer;
+class BufferCreateInfo;
+enum class BufferUsage: UnsignedInt;
+class CommandBuffer;
+enum class CommandBufferLevel: Int;
+class CommandPool;
+enum class CommandPoolFlag: UnsignedInt;
+class ComputePipelineCreateInfo;
+class Device;
+class DeviceCreateInfo;
+class DeviceProperties;
+enum class DeviceType: Int;
+class GraphicsPipelineCreateInfo;
+enum class HandleFlag: UnsignedByte;
+class Instance;
+class InstanceCreateInfo;
+struct MemoryAllocation;
+class MemoryAllocator;
+enum class MemoryFlag: UnsignedInt;
+class Mesh;
+class MeshLayout;
+class ParallelCommandBuffers;
+class Pipeline;
+enum class PipelineBindPoint: Int;
+class PipelineCache;
+class PipelineLayout;
+class Queue;
+enum class QueueFlag: UnsignedInt;
+enum class Result: Int;
+class ShaderModule;
+enum class ShaderStage: UnsignedInt;
+enum class SubpassContents: Int;
+#endif
 
 }}
 
@@ -28,6 +28,8 @@
 #cmakedefine MAGNUM_BUILD_DEPRECATED
 #cmakedefine MAGNUM_BUILD_STATIC
 #cmakedefine MAGNUM_BUILD_MULTITHREADED
+#cmakedefine MAGNUM_BUILD_INSTRUMENTATION
+#cmakedefine MAGNUM_BUILD_MATH_SIMD
 #cmakedefine MAGNUM_TARGET_GL
 #cmakedefine MAGNUM_TARGET_GLES
 #cmakedefine MAGNUM_TARGET_GLES2
@@ -343,6 +343,9 @@ FLEXTGL_EXPORT void(APIENTRY *flextglStringMarkerGREMEDY)(GLsizei, const void *)
 /* GL_KHR_blend_equation_advanced */
 FLEXTGL_EXPORT void(APIENTRY *flextglBlendBarrierKHR)(void) = nullptr;
 
+/* GL_KHR_parallel_shader_compile */
+FLEXTGL_EXPORT void(APIENTRY *flextglMaxShaderCompilerThreadsKHR)(GLuint) = nullptr;
+
 /* GL_VERSION_1_2 */
 FLEXTGL_EXPORT void(APIENTRY *flextglCopyTexSubImage3D)(GLenum, GLint, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei) = nullptr;
 FLEXTGL_EXPORT void(APIENTRY *flextglDrawRangeElements)(GLenum, GLuint, GLuint, GLsizei, GLenum, const void *) = nullptr;
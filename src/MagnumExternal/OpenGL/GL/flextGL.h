@@ -1792,6 +1792,11 @@ typedef void (APIENTRY *GLDEBUGPROC)(GLenum source,GLenum type,GLuint id,GLenum
 
 #define GL_BLEND_ADVANCED_COHERENT_KHR 0x9285
 
+/* GL_KHR_parallel_shader_compile */
+
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+
 /* Function prototypes */
 
 /* GL_ARB_ES3_2_compatibility */
@@ -2411,6 +2416,11 @@ GLAPI FLEXTGL_EXPORT void(APIENTRY *flextglStringMarkerGREMEDY)(GLsizei, const v
 GLAPI FLEXTGL_EXPORT void(APIENTRY *flextglBlendBarrierKHR)(void);
 #define glBlendBarrierKHR flextglBlendBarrierKHR
 
+/* GL_KHR_parallel_shader_compile */
+
+GLAPI FLEXTGL_EXPORT void(APIENTRY *flextglMaxShaderCompilerThreadsKHR)(GLuint);
+#define glMaxShaderCompilerThreadsKHR flextglMaxShaderCompilerThreadsKHR
+
 /* GL_VERSION_1_0 */
 
 GLAPI FLEXTGL_EXPORT void APIENTRY glBlendFunc(GLenum, GLenum);
@@ -156,6 +156,9 @@ FLEXTGL_EXPORT void(APIENTRY *flextglTexStorage3DEXT)(GLenum, GLsizei, GLenum, G
 /* GL_KHR_blend_equation_advanced */
 FLEXTGL_EXPORT void(APIENTRY *flextglBlendBarrierKHR)(void) = nullptr;
 
+/* GL_KHR_parallel_shader_compile */
+FLEXTGL_EXPORT void(APIENTRY *flextglMaxShaderCompilerThreadsKHR)(GLuint) = nullptr;
+
 /* GL_KHR_debug */
 FLEXTGL_EXPORT void(APIENTRY *flextglDebugMessageCallbackKHR)(GLDEBUGPROCKHR, const void *) = nullptr;
 FLEXTGL_EXPORT void(APIENTRY *flextglDebugMessageControlKHR)(GLenum, GLenum, GLenum, GLsizei, const GLuint *, GLboolean) = nullptr;
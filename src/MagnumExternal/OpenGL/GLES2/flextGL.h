@@ -1032,6 +1032,11 @@ typedef khronos_ssize_t GLsizeiptr;
 
 #define GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR 0x00000008
 
+/* GL_KHR_parallel_shader_compile */
+
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+
 /* GL_NV_texture_border_clamp */
 
 #define GL_TEXTURE_BORDER_COLOR_NV 0x1004
@@ -1446,6 +1451,11 @@ GLAPI FLEXTGL_EXPORT void(APIENTRY *flextglTexStorage3DEXT)(GLenum, GLsizei, GLe
 GLAPI FLEXTGL_EXPORT void(APIENTRY *flextglBlendBarrierKHR)(void);
 #define glBlendBarrierKHR flextglBlendBarrierKHR
 
+/* GL_KHR_parallel_shader_compile */
+
+GLAPI FLEXTGL_EXPORT void(APIENTRY *flextglMaxShaderCompilerThreadsKHR)(GLuint);
+#define glMaxShaderCompilerThreadsKHR flextglMaxShaderCompilerThreadsKHR
+
 /* GL_KHR_debug */
 
 GLAPI FLEXTGL_EXPORT void(APIENTRY *flextglDebugMessageCallbackKHR)(GLDEBUGPROCKHR, const void *);
@@ -228,6 +228,7 @@
 #undef glTexBufferEXT
 #undef glTexBufferRangeEXT
 #undef glBlendBarrierKHR
+#undef glMaxShaderCompilerThreadsKHR
 #undef glDebugMessageCallbackKHR
 #undef glDebugMessageControlKHR
 #undef glDebugMessageInsertKHR
@@ -526,6 +527,11 @@ void flextGLInit() {
     flextglBlendBarrierKHR = reinterpret_cast<void(APIENTRY*)(void)>(glBlendBarrierKHR);
     #endif
 
+    /* GL_KHR_parallel_shader_compile */
+    #if GL_KHR_parallel_shader_compile
+    flextglMaxShaderCompilerThreadsKHR = reinterpret_cast<void(APIENTRY*)(GLuint)>(glMaxShaderCompilerThreadsKHR);
+    #endif
+
     /* GL_KHR_debug */
     #if GL_KHR_debug
     flextglDebugMessageCallbackKHR = reinterpret_cast<void(APIENTRY*)(GLDEBUGPROCKHR, const void *)>(glDebugMessageCallbackKHR);
@@ -25,6 +25,7 @@
 
 #include "AnyImporter.h"
 
+#include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Assert.h>
@@ -32,47 +33,110 @@
 
 namespace Magnum { namespace Audio {
 
+namespace {
+
+std::string extension(const std::string& filename) {
+    const std::size_t dot = filename.rfind('.');
+    if(dot == std::string::npos || filename.find('/', dot) != std::string::npos)
+        return {};
+    return filename.substr(dot + 1);
+}
+
+}
+
 AnyImporter::AnyImporter(PluginManager::Manager<AbstractImporter>& manager): AbstractImporter{manager} {}
 
 AnyImporter::AnyImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
 
 AnyImporter::~AnyImporter() = default;
 
-auto AnyImporter::doFeatures() const -> Features { return {}; }
+auto AnyImporter::doFeatures() const -> Features { return Feature::OpenData; }
 
 bool AnyImporter::doIsOpened() const { return !!_in; }
 
-void AnyImporter::doClose() { _in = nullptr; }
+void AnyImporter::doClose() {
+    /* Just close the delegated importer, the instance is kept for reuse */
+    _in->close();
+    _in = nullptr;
+}
 
 void AnyImporter::doOpenFile(const std::string& filename) {
     CORRADE_INTERNAL_ASSERT(manager());
 
     /* Detect type from extension */
+    static const std::unordered_map<std::string, std::string> plugins{
+        {"ogg", "VorbisAudioImporter"},
+        {"wav", "WavAudioImporter"},
+        {"flac", "FlacAudioImporter"}
+    };
+    const auto found = plugins.find(extension(filename));
+    if(found == plugins.end()) {
+        Error() << "Audio::AnyImporter::openFile(): cannot determine type of file" << filename;
+        return;
+    }
+
+    /* Try to get an instance of the plugin */
+    AbstractImporter* const importer = instance(found->second, "Audio::AnyImporter::openFile():");
+    if(!importer) return;
+
+    /* Try to open the file (error output should be printed by the plugin
+       itself) */
+    if(!importer->openFile(filename)) return;
+
+    /* Success, save the instance */
+    _in = importer;
+}
+
+void AnyImporter::doOpenData(Containers::ArrayView<const char> data) {
+    CORRADE_INTERNAL_ASSERT(manager());
+
     std::string plugin;
-    if(Utility::String::endsWith(filename, ".ogg"))
+    /* https://xiph.org/ogg/doc/framing.html */
+    if(Utility::String::viewBeginsWith(data, "OggS"))
         plugin = "VorbisAudioImporter";
-    else if(Utility::String::endsWith(filename, ".wav"))
+    /* http://soundfile.sapp.org/doc/WaveFormat/ */
+    else if(Utility::String::viewBeginsWith(data, "RIFF") && data.size() >= 12 &&
+            Utility::String::viewBeginsWith(data.suffix(8), "WAVE"))
         plugin = "WavAudioImporter";
-    else if(Utility::String::endsWith(filename, ".flac"))
+    /* https://xiph.org/flac/format.html#stream */
+    else if(Utility::String::viewBeginsWith(data, "fLaC"))
         plugin = "FlacAudioImporter";
-    else {
-        Error() << "Audio::AnyImporter::openFile(): cannot determine type of file" << filename;
+    else if(!data.size()) {
+        Error{} << "Audio::AnyImporter::openData(): file is empty";
         return;
-    }
-
-    /* Try to load the plugin */
-    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
-        Error() << "Audio::AnyImporter::openFile(): cannot load" << plugin << "plugin";
+    } else {
+        std::uint32_t signature = data[0] << 24;
+        if(data.size() > 1) signature |= data[1] << 16;
+        if(data.size() > 2) signature |= data[2] << 8;
+        if(data.size() > 3) signature |= data[3];
+        Error() << "Audio::AnyImporter::openData(): cannot determine type from signature" << reinterpret_cast<void*>(signature);
         return;
     }
 
+    /* Try to get an instance of the plugin */
+    AbstractImporter* const importer = instance(plugin, "Audio::AnyImporter::openData():");
+    if(!importer) return;
+
     /* Try to open the file (error output should be printed by the plugin
        itself) */
-    std::unique_ptr<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
-    if(!importer->openFile(filename)) return;
+    if(!importer->openData(data)) return;
 
     /* Success, save the instance */
-    _in = std::move(importer);
+    _in = importer;
+}
+
+AbstractImporter* AnyImporter::instance(const std::string& plugin, const char* const prefix) {
+    /* Reuse an instance that was created for a previous file, if any */
+    const auto found = _instances.find(plugin);
+    if(found != _instances.end()) return found->second.get();
+
+    /* Try to load the plugin */
+    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
+        Error() << prefix << "cannot load" << plugin << "plugin";
+        return nullptr;
+    }
+
+    return _instances.emplace(plugin, static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin)).first->second.get();
 }
 
 BufferFormat AnyImporter::doFormat() const { return _in->format(); }
@@ -81,7 +145,9 @@ UnsignedInt AnyImporter::doFrequency() const { return _in->frequency(); }
 
 Containers::Array<char> AnyImporter::doData() { return _in->data(); }
 
+std::size_t AnyImporter::doReadData(const std::size_t offset, const Containers::ArrayView<char> destination) { return _in->readData(offset, destination); }
+
 }}
 
 CORRADE_PLUGIN_REGISTER(AnyAudioImporter, Magnum::Audio::AnyImporter,
-    "cz.mosra.magnum.Audio.AbstractImporter/0.1")
+    "cz.mosra.magnum.Audio.AbstractImporter/0.2")
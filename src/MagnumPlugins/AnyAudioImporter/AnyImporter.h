@@ -30,6 +30,7 @@
  */
 
 #include <memory>
+#include <unordered_map>
 #include <Magnum/Audio/AbstractImporter.h>
 
 #include "MagnumPlugins/AnyAudioImporter/configure.h"
@@ -68,13 +69,18 @@ of the `Magnum` package and link to the `Magnum::AnyAudioImporter` target. See
 
 Supported formats:
 
--   OGG Vorbis (`*.ogg`), loaded with any plugin that provides
-    `VorbisAudioImporter`
--   WAV (`*.wav`), loaded with @ref WavImporter "WavAudioImporter" or any other
-    plugin that provides it
--   FLAC (`*.flac`), loaded with any plugin that provides `FlacAudioImporter`
-
-Only loading from files is supported.
+-   OGG Vorbis (`*.ogg` or data with corresponding signature), loaded with
+    any plugin that provides `VorbisAudioImporter`
+-   WAV (`*.wav` or data with corresponding signature), loaded with
+    @ref WavImporter "WavAudioImporter" or any other plugin that provides it
+-   FLAC (`*.flac` or data with corresponding signature), loaded with any
+    plugin that provides `FlacAudioImporter`
+
+The first time a file of given type is opened, the corresponding plugin is
+loaded and instantiated. The instance is then kept around and reused for all
+subsequent files of the same type until the @ref AnyImporter instance is
+destroyed, which means the delegated plugins can't be unloaded from the plugin
+manager until then.
 */
 class MAGNUM_ANYAUDIOIMPORTER_EXPORT AnyImporter: public AbstractImporter {
     public:
@@ -91,12 +97,17 @@ class MAGNUM_ANYAUDIOIMPORTER_EXPORT AnyImporter: public AbstractImporter {
         MAGNUM_ANYAUDIOIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_ANYAUDIOIMPORTER_LOCAL void doClose() override;
         MAGNUM_ANYAUDIOIMPORTER_LOCAL void doOpenFile(const std::string& filename) override;
+        MAGNUM_ANYAUDIOIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
 
         MAGNUM_ANYAUDIOIMPORTER_LOCAL BufferFormat doFormat() const override;
         MAGNUM_ANYAUDIOIMPORTER_LOCAL UnsignedInt doFrequency() const override;
         MAGNUM_ANYAUDIOIMPORTER_LOCAL Containers::Array<char> doData() override;
+        MAGNUM_ANYAUDIOIMPORTER_LOCAL std::size_t doReadData(std::size_t offset, Containers::ArrayView<char> destination) override;
+
+        MAGNUM_ANYAUDIOIMPORTER_LOCAL AbstractImporter* instance(const std::string& plugin, const char* prefix);
 
-        std::unique_ptr<AbstractImporter> _in;
+        std::unordered_map<std::string, std::unique_ptr<AbstractImporter>> _instances;
+        AbstractImporter* _in{};
 };
 
 }}
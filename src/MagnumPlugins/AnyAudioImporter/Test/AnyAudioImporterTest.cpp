@@ -26,6 +26,7 @@
 #include <sstream>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
 
@@ -37,8 +38,11 @@ struct AnyImporterTest: TestSuite::Tester {
     explicit AnyImporterTest();
 
     void wav();
+    void wavData();
+    void reopen();
 
     void unknown();
+    void unknownSignature();
 
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
@@ -46,8 +50,11 @@ struct AnyImporterTest: TestSuite::Tester {
 
 AnyImporterTest::AnyImporterTest() {
     addTests({&AnyImporterTest::wav,
+              &AnyImporterTest::wavData,
+              &AnyImporterTest::reopen,
 
-              &AnyImporterTest::unknown});
+              &AnyImporterTest::unknown,
+              &AnyImporterTest::unknownSignature});
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
@@ -72,6 +79,33 @@ void AnyImporterTest::wav() {
     CORRADE_COMPARE(importer->frequency(), 96000);
 }
 
+void AnyImporterTest::wavData() {
+    if(!(_manager.loadState("WavAudioImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("WavAudioImporter plugin not enabled, cannot test");
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("AnyAudioImporter");
+    CORRADE_VERIFY(importer->openData(Utility::Directory::read(WAV_FILE)));
+
+    CORRADE_COMPARE(importer->format(), BufferFormat::Stereo8);
+    CORRADE_COMPARE(importer->frequency(), 96000);
+}
+
+void AnyImporterTest::reopen() {
+    if(!(_manager.loadState("WavAudioImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("WavAudioImporter plugin not enabled, cannot test");
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("AnyAudioImporter");
+    CORRADE_VERIFY(importer->openFile(WAV_FILE));
+    importer->close();
+    CORRADE_VERIFY(!importer->isOpened());
+
+    /* The second time the pooled instance is reused */
+    CORRADE_VERIFY(importer->openFile(WAV_FILE));
+    CORRADE_COMPARE(importer->format(), BufferFormat::Stereo8);
+    CORRADE_VERIFY(importer->openData(Utility::Directory::read(WAV_FILE)));
+    CORRADE_COMPARE(importer->frequency(), 96000);
+}
+
 void AnyImporterTest::unknown() {
     std::ostringstream output;
     Error redirectError{&output};
@@ -82,6 +116,18 @@ void AnyImporterTest::unknown() {
     CORRADE_COMPARE(output.str(), "Audio::AnyImporter::openFile(): cannot determine type of file sound.mid\n");
 }
 
+void AnyImporterTest::unknownSignature() {
+    std::ostringstream output;
+    Error redirectError{&output};
+
+    constexpr const char data[]{ 0x4d, 0x54, 0x68, 0x64 };
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("AnyAudioImporter");
+    CORRADE_VERIFY(!importer->openData(data));
+
+    CORRADE_COMPARE(output.str(), "Audio::AnyImporter::openData(): cannot determine type from signature 0x4d546864\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::AnyImporterTest)
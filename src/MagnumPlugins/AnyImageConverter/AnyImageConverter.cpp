@@ -49,6 +49,8 @@ bool AnyImageConverter::doExportToFile(const ImageView2D& image, const std::stri
     std::string plugin;
     if(Utility::String::endsWith(filename, ".bmp"))
         plugin = "BmpImageConverter";
+    else if(Utility::String::endsWith(filename, ".dds"))
+        plugin = "DdsImageConverter";
     else if(Utility::String::endsWith(filename, ".exr"))
         plugin = "OpenExrImageConverter";
     else if(Utility::String::endsWith(filename, ".hdr"))
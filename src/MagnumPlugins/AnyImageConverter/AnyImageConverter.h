@@ -67,6 +67,8 @@ target. See @ref building, @ref cmake and @ref plugins for more information.
 
 Supported formats for uncompressed data:
 
+-   DirectDraw Surface (`*.dds`), compressed to one of the S3TC formats with
+    @ref DdsImageConverter or any other plugin that provides it
 -   OpenEXR (`*.exr`), converted with any plugin that provides
     `OpenExrImageConverter`
 -   Windows Bitmap (`*.bmp`), converted with any plugin that provides
@@ -39,6 +39,7 @@ namespace Magnum { namespace Trade { namespace Test {
 struct AnyImageConverterTest: TestSuite::Tester {
     explicit AnyImageConverterTest();
 
+    void dds();
     void tga();
 
     void unknown();
@@ -48,7 +49,8 @@ struct AnyImageConverterTest: TestSuite::Tester {
 };
 
 AnyImageConverterTest::AnyImageConverterTest() {
-    addTests({&AnyImageConverterTest::tga,
+    addTests({&AnyImageConverterTest::dds,
+              &AnyImageConverterTest::tga,
 
               &AnyImageConverterTest::unknown});
 
@@ -58,6 +60,9 @@ AnyImageConverterTest::AnyImageConverterTest() {
     CORRADE_INTERNAL_ASSERT(_manager.load(ANYIMAGECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
     #endif
     /* Optional plugins that don't have to be here */
+    #ifdef DDSIMAGECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(DDSIMAGECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
     #ifdef TGAIMAGECONVERTER_PLUGIN_FILENAME
     CORRADE_INTERNAL_ASSERT(_manager.load(TGAIMAGECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
     #endif
@@ -76,6 +81,21 @@ namespace {
     const ImageView2D Image{PixelFormat::RGB8Unorm, {2, 3}, Data};
 }
 
+void AnyImageConverterTest::dds() {
+    if(!(_manager.loadState("DdsImageConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("DdsImageConverter plugin not enabled, cannot test");
+
+    const std::string filename = Utility::Directory::join(ANYIMAGECONVERTER_TEST_DIR, "output.dds");
+
+    if(Utility::Directory::fileExists(filename))
+        CORRADE_VERIFY(Utility::Directory::rm(filename));
+
+    /* Just test that the exported file exists */
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("AnyImageConverter");
+    CORRADE_VERIFY(converter->exportToFile(Image, filename));
+    CORRADE_VERIFY(Utility::Directory::fileExists(filename));
+}
+
 void AnyImageConverterTest::tga() {
     if(!(_manager.loadState("TgaImageConverter") & PluginManager::LoadState::Loaded))
         CORRADE_SKIP("TgaImageConverter plugin not enabled, cannot test");
@@ -24,5 +24,6 @@
 */
 
 #cmakedefine ANYIMAGECONVERTER_PLUGIN_FILENAME "${ANYIMAGECONVERTER_PLUGIN_FILENAME}"
+#cmakedefine DDSIMAGECONVERTER_PLUGIN_FILENAME "${DDSIMAGECONVERTER_PLUGIN_FILENAME}"
 #cmakedefine TGAIMAGECONVERTER_PLUGIN_FILENAME "${TGAIMAGECONVERTER_PLUGIN_FILENAME}"
 #define ANYIMAGECONVERTER_TEST_DIR "${ANYIMAGECONVERTER_TEST_DIR}"
@@ -25,6 +25,7 @@
 
 #include "AnyImageImporter.h"
 
+#include <unordered_map>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/String.h>
@@ -32,6 +33,17 @@
 
 namespace Magnum { namespace Trade {
 
+namespace {
+
+std::string extension(const std::string& filename) {
+    const std::size_t dot = filename.rfind('.');
+    if(dot == std::string::npos || filename.find('/', dot) != std::string::npos)
+        return {};
+    return filename.substr(dot + 1);
+}
+
+}
+
 AnyImageImporter::AnyImageImporter(PluginManager::Manager<AbstractImporter>& manager): AbstractImporter{manager} {}
 
 AnyImageImporter::AnyImageImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
@@ -43,79 +55,63 @@ auto AnyImageImporter::doFeatures() const -> Features { return Feature::OpenData
 bool AnyImageImporter::doIsOpened() const { return !!_in; }
 
 void AnyImageImporter::doClose() {
+    /* Just close the delegated importer, the instance is kept for reuse */
+    _in->close();
     _in = nullptr;
 }
 
 void AnyImageImporter::doOpenFile(const std::string& filename) {
     CORRADE_INTERNAL_ASSERT(manager());
 
-    /* Detect type from extension */
-    std::string plugin;
-    if(Utility::String::endsWith(filename, ".bmp"))
-        plugin = "BmpImporter";
-    else if(Utility::String::endsWith(filename, ".dds"))
-        plugin = "DdsImporter";
-    else if(Utility::String::endsWith(filename, ".exr"))
-        plugin = "OpenExrImporter";
-    else if(Utility::String::endsWith(filename, ".gif"))
-        plugin = "GifImporter";
-    else if(Utility::String::endsWith(filename, ".hdr"))
-        plugin = "HdrImporter";
-    else if(Utility::String::endsWith(filename, ".jpg") ||
-            Utility::String::endsWith(filename, ".jpeg") ||
-            Utility::String::endsWith(filename, ".jpe") )
-        plugin = "JpegImporter";
-    else if(Utility::String::endsWith(filename, ".jp2"))
-        plugin = "Jpeg2000Importer";
-    else if(Utility::String::endsWith(filename, ".mng"))
-        plugin = "MngImporter";
-    else if(Utility::String::endsWith(filename, ".pbm"))
-        plugin = "PbmImporter";
-    else if(Utility::String::endsWith(filename, ".pcx"))
-        plugin = "PcxImporter";
-    else if(Utility::String::endsWith(filename, ".pgm"))
-        plugin = "PgmImporter";
-    else if(Utility::String::endsWith(filename, ".pic"))
-        plugin = "PicImporter";
-    else if(Utility::String::endsWith(filename, ".pnm"))
-        plugin = "PnmImporter";
-    else if(Utility::String::endsWith(filename, ".png"))
-        plugin = "PngImporter";
-    else if(Utility::String::endsWith(filename, ".ppm"))
-        plugin = "PpmImporter";
-    else if(Utility::String::endsWith(filename, ".psd"))
-        plugin = "PsdImporter";
-    else if(Utility::String::endsWith(filename, ".sgi") ||
-            Utility::String::endsWith(filename, ".bw") ||
-            Utility::String::endsWith(filename, ".rgb") ||
-            Utility::String::endsWith(filename, ".rgba"))
-        plugin = "SgiImporter";
-    else if(Utility::String::endsWith(filename, ".tif") ||
-            Utility::String::endsWith(filename, ".tiff"))
-        plugin = "TiffImporter";
-    else if(Utility::String::endsWith(filename, ".tga") ||
-            Utility::String::endsWith(filename, ".vda") ||
-            Utility::String::endsWith(filename, ".icb") ||
-            Utility::String::endsWith(filename, ".vst"))
-        plugin = "TgaImporter";
-    else {
+    /* Detect type from extension. Looking up the extension in a map instead
+       of testing the suffixes one after another makes the cost independent
+       of where the format is in the list. */
+    static const std::unordered_map<std::string, std::string> plugins{
+        {"bmp", "BmpImporter"},
+        {"dds", "DdsImporter"},
+        {"exr", "OpenExrImporter"},
+        {"gif", "GifImporter"},
+        {"hdr", "HdrImporter"},
+        {"jpg", "JpegImporter"},
+        {"jpeg", "JpegImporter"},
+        {"jpe", "JpegImporter"},
+        {"jp2", "Jpeg2000Importer"},
+        {"mng", "MngImporter"},
+        {"pbm", "PbmImporter"},
+        {"pcx", "PcxImporter"},
+        {"pgm", "PgmImporter"},
+        {"pic", "PicImporter"},
+        {"pnm", "PnmImporter"},
+        {"png", "PngImporter"},
+        {"ppm", "PpmImporter"},
+        {"psd", "PsdImporter"},
+        {"sgi", "SgiImporter"},
+        {"bw", "SgiImporter"},
+        {"rgb", "SgiImporter"},
+        {"rgba", "SgiImporter"},
+        {"tif", "TiffImporter"},
+        {"tiff", "TiffImporter"},
+        {"tga", "TgaImporter"},
+        {"vda", "TgaImporter"},
+        {"icb", "TgaImporter"},
+        {"vst", "TgaImporter"}
+    };
+    const auto found = plugins.find(extension(filename));
+    if(found == plugins.end()) {
         Error() << "Trade::AnyImageImporter::openFile(): cannot determine type of file" << filename;
         return;
     }
 
-    /* Try to load the plugin */
-    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
-        Error() << "Trade::AnyImageImporter::openFile(): cannot load" << plugin << "plugin";
-        return;
-    }
+    /* Try to get an instance of the plugin */
+    AbstractImporter* const importer = instance(found->second, "Trade::AnyImageImporter::openFile():");
+    if(!importer) return;
 
     /* Try to open the file (error output should be printed by the plugin
        itself) */
-    std::unique_ptr<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
     if(!importer->openFile(filename)) return;
 
     /* Success, save the instance */
-    _in = std::move(importer);
+    _in = importer;
 }
 
 void AnyImageImporter::doOpenData(Containers::ArrayView<const char> data) {
@@ -171,25 +167,38 @@ void AnyImageImporter::doOpenData(Containers::ArrayView<const char> data) {
         return;
     }
 
-    /* Try to load the plugin */
-    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
-        Error() << "Trade::AnyImageImporter::openData(): cannot load" << plugin << "plugin";
-        return;
-    }
+    /* Try to get an instance of the plugin */
+    AbstractImporter* const importer = instance(plugin, "Trade::AnyImageImporter::openData():");
+    if(!importer) return;
 
     /* Try to open the file (error output should be printed by the plugin
        itself) */
-    std::unique_ptr<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
     if(!importer->openData(data)) return;
 
     /* Success, save the instance */
-    _in = std::move(importer);
+    _in = importer;
+}
+
+AbstractImporter* AnyImageImporter::instance(const std::string& plugin, const char* const prefix) {
+    /* Reuse an instance that was created for a previous file, if any */
+    const auto found = _instances.find(plugin);
+    if(found != _instances.end()) return found->second.get();
+
+    /* Try to load the plugin */
+    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
+        Error() << prefix << "cannot load" << plugin << "plugin";
+        return nullptr;
+    }
+
+    return _instances.emplace(plugin, static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin)).first->second.get();
 }
 
 UnsignedInt AnyImageImporter::doImage2DCount() const { return _in->image2DCount(); }
 
 Containers::Optional<ImageData2D> AnyImageImporter::doImage2D(const UnsignedInt id) { return _in->image2D(id); }
 
+Containers::Optional<ImageData2D> AnyImageImporter::doImage2DInto(const UnsignedInt id, Containers::ArrayView<char>(*const allocator)(std::size_t, void*), void* const userData) { return _in->image2DInto(id, allocator, userData); }
+
 }}
 
 CORRADE_PLUGIN_REGISTER(AnyImageImporter, Magnum::Trade::AnyImageImporter,
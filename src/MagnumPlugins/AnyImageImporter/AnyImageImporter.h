@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::Trade::AnyImageImporter
  */
 
+#include <unordered_map>
 #include <Magnum/Trade/AbstractImporter.h>
 
 #include "MagnumPlugins/AnyImageImporter/configure.h"
@@ -103,6 +104,16 @@ Supported formats:
 
 Detecting file type through @ref openData() is supported only for a subset of
 formats that are marked as such in the list above.
+
+@section Trade-AnyImageImporter-instances Reusing plugin instances
+
+The first time a file of given type is opened, the corresponding plugin is
+loaded and instantiated. The instance is then kept around and reused for all
+subsequent files of the same type, so opening a large number of files doesn't
+repeatedly pay for plugin instantiation. Closing the file only closes the
+delegated importer, the instances are destroyed together with the
+@ref AnyImageImporter instance. As a consequence, the delegated plugins can't
+be unloaded from the plugin manager until then.
 */
 class MAGNUM_ANYIMAGEIMPORTER_EXPORT AnyImageImporter: public AbstractImporter {
     public:
@@ -123,8 +134,12 @@ class MAGNUM_ANYIMAGEIMPORTER_EXPORT AnyImageImporter: public AbstractImporter {
 
         MAGNUM_ANYIMAGEIMPORTER_LOCAL UnsignedInt doImage2DCount() const override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL Containers::Optional<ImageData2D> doImage2D(UnsignedInt id) override;
+        MAGNUM_ANYIMAGEIMPORTER_LOCAL Containers::Optional<ImageData2D> doImage2DInto(UnsignedInt id, Containers::ArrayView<char>(*allocator)(std::size_t, void*), void* userData) override;
+
+        MAGNUM_ANYIMAGEIMPORTER_LOCAL AbstractImporter* instance(const std::string& plugin, const char* prefix);
 
-        std::unique_ptr<AbstractImporter> _in;
+        std::unordered_map<std::string, std::unique_ptr<AbstractImporter>> _instances;
+        AbstractImporter* _in{};
 };
 
 }}
@@ -0,0 +1,143 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+/* Measures the overhead of dispatching through AnyImageImporter compared to
+   using the concrete importer directly. The file is tiny so the time is
+   dominated by the per-file cost; divide the batch size by the reported time
+   to get files per second. */
+struct AnyImageImporterBenchmark: TestSuite::Tester {
+    explicit AnyImageImporterBenchmark();
+
+    void openFileDirect();
+    void openFileAny();
+    void openDataDirect();
+    void openDataAny();
+
+    private:
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+        Containers::Array<char> _data;
+};
+
+namespace {
+    enum: std::size_t { FileCount = 100 };
+}
+
+AnyImageImporterBenchmark::AnyImageImporterBenchmark() {
+    addBenchmarks({&AnyImageImporterBenchmark::openFileDirect,
+                   &AnyImageImporterBenchmark::openFileAny,
+                   &AnyImageImporterBenchmark::openDataDirect,
+                   &AnyImageImporterBenchmark::openDataAny}, 10);
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(ANYIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    /* Optional plugins that don't have to be here */
+    #ifdef TGAIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(TGAIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    _data = Utility::Directory::read(TGA_FILE);
+}
+
+void AnyImageImporterBenchmark::openFileDirect() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot benchmark");
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != FileCount; ++i) {
+        importer->openFile(TGA_FILE);
+        count += importer->image2D(0) ? 1 : 0;
+    }
+
+    CORRADE_COMPARE(count, FileCount);
+}
+
+void AnyImageImporterBenchmark::openFileAny() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot benchmark");
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+
+    /* Each open instantiates the concrete importer anew */
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != FileCount; ++i) {
+        importer->openFile(TGA_FILE);
+        count += importer->image2D(0) ? 1 : 0;
+    }
+
+    CORRADE_COMPARE(count, FileCount);
+}
+
+void AnyImageImporterBenchmark::openDataDirect() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot benchmark");
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != FileCount; ++i) {
+        importer->openData(_data);
+        count += importer->image2D(0) ? 1 : 0;
+    }
+
+    CORRADE_COMPARE(count, FileCount);
+}
+
+void AnyImageImporterBenchmark::openDataAny() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot benchmark");
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+
+    /* The format is detected from the file signature */
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != FileCount; ++i) {
+        importer->openData(_data);
+        count += importer->image2D(0) ? 1 : 0;
+    }
+
+    CORRADE_COMPARE(count, FileCount);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AnyImageImporterBenchmark)
@@ -40,6 +40,7 @@ struct AnyImageImporterTest: TestSuite::Tester {
     explicit AnyImageImporterTest();
 
     void load();
+    void reopen();
 
     void detect();
 
@@ -100,6 +101,8 @@ AnyImageImporterTest::AnyImageImporterTest() {
     addInstancedTests({&AnyImageImporterTest::detect},
         Containers::arraySize(DetectData));
 
+    addTests({&AnyImageImporterTest::reopen});
+
     addTests({&AnyImageImporterTest::unknownExtension,
               &AnyImageImporterTest::unknownSignature,
               &AnyImageImporterTest::emptyData});
@@ -138,6 +141,24 @@ void AnyImageImporterTest::load() {
     CORRADE_VERIFY(!importer->isOpened());
 }
 
+void AnyImageImporterTest::reopen() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+    CORRADE_VERIFY(importer->openFile(TGA_FILE));
+    importer->close();
+    CORRADE_VERIFY(!importer->isOpened());
+
+    /* The second time the pooled instance is reused, both for files and
+       data */
+    CORRADE_VERIFY(importer->openFile(TGA_FILE));
+    CORRADE_VERIFY(importer->openData(Utility::Directory::read(TGA_FILE)));
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+}
+
 void AnyImageImporterTest::detect() {
     auto&& data = DetectData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
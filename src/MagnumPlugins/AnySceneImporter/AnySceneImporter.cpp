@@ -25,6 +25,7 @@
 
 #include "AnySceneImporter.h"
 
+#include <unordered_map>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/String.h>
@@ -41,99 +42,146 @@
 
 namespace Magnum { namespace Trade {
 
+namespace {
+
+std::string extension(const std::string& filename) {
+    const std::size_t dot = filename.rfind('.');
+    if(dot == std::string::npos || filename.find('/', dot) != std::string::npos)
+        return {};
+    return filename.substr(dot + 1);
+}
+
+}
+
 AnySceneImporter::AnySceneImporter(PluginManager::Manager<AbstractImporter>& manager): AbstractImporter{manager} {}
 
 AnySceneImporter::AnySceneImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
 
 AnySceneImporter::~AnySceneImporter() = default;
 
-auto AnySceneImporter::doFeatures() const -> Features { return {}; }
+auto AnySceneImporter::doFeatures() const -> Features { return Feature::OpenData; }
 
 bool AnySceneImporter::doIsOpened() const { return !!_in; }
 
 void AnySceneImporter::doClose() {
+    /* Just close the delegated importer, the instance is kept for reuse */
+    _in->close();
     _in = nullptr;
 }
 
 void AnySceneImporter::doOpenFile(const std::string& filename) {
     CORRADE_INTERNAL_ASSERT(manager());
 
-    /* Detect type from extension */
+    /* Detect type from extension. Looking up the extension in a map instead
+       of testing the suffixes one after another makes the cost independent
+       of where the format is in the list. */
+    static const std::unordered_map<std::string, std::string> plugins{
+        {"3ds", "3dsImporter"},
+        {"ase", "3dsImporter"},
+        {"ac", "Ac3dImporter"},
+        {"blend", "BlenderImporter"},
+        {"bvh", "BvhImporter"},
+        {"csm", "CsmImporter"},
+        {"dae", "ColladaImporter"},
+        {"x", "DirectXImporter"},
+        {"dxf", "DxfImporter"},
+        {"fbx", "FbxImporter"},
+        {"gltf", "GltfImporter"},
+        {"glb", "GlbImporter"},
+        {"ifc", "IfcImporter"},
+        {"irrmesh", "IrrlichtImporter"},
+        {"irr", "IrrlichtImporter"},
+        {"lwo", "LightWaveImporter"},
+        {"lws", "LightWaveImporter"},
+        {"lxo", "ModoImporter"},
+        {"ms3d", "MilkshapeImporter"},
+        {"obj", "ObjImporter"},
+        {"xml", "OgreImporter"},
+        {"ogex", "OpenGexImporter"},
+        {"ply", "StanfordImporter"},
+        {"stl", "StlImporter"},
+        {"cob", "TrueSpaceImporter"},
+        {"scn", "TrueSpaceImporter"},
+        {"3d", "UnrealImporter"},
+        {"smd", "ValveImporter"},
+        {"vta", "ValveImporter"},
+        {"xgl", "XglImporter"},
+        {"zgl", "XglImporter"}
+    };
+    const auto found = plugins.find(extension(filename));
+    if(found == plugins.end()) {
+        Error() << "Trade::AnySceneImporter::openFile(): cannot determine type of file" << filename;
+        return;
+    }
+
+    /* Try to get an instance of the plugin */
+    AbstractImporter* const importer = instance(found->second, "Trade::AnySceneImporter::openFile():");
+    if(!importer) return;
+
+    /* Try to open the file (error output should be printed by the plugin
+       itself) */
+    if(!importer->openFile(filename)) return;
+
+    /* Success, save the instance */
+    _in = importer;
+}
+
+void AnySceneImporter::doOpenData(Containers::ArrayView<const char> data) {
+    CORRADE_INTERNAL_ASSERT(manager());
+
     std::string plugin;
-    if(Utility::String::endsWith(filename, ".3ds") ||
-       Utility::String::endsWith(filename, ".ase"))
-        plugin = "3dsImporter";
-    else if(Utility::String::endsWith(filename, ".ac"))
-        plugin = "Ac3dImporter";
-    else if(Utility::String::endsWith(filename, ".blend"))
+    /* https://github.com/KhronosGroup/glTF/tree/master/specification/2.0#binary-header */
+    if(Utility::String::viewBeginsWith(data, "glTF"))
+        plugin = "GlbImporter";
+    /* http://paulbourke.net/dataformats/ply/ */
+    else if(Utility::String::viewBeginsWith(data, "ply\n") ||
+            Utility::String::viewBeginsWith(data, "ply\r\n"))
+        plugin = "StanfordImporter";
+    /* https://code.blender.org/2017/03/blend-file-format/ */
+    else if(Utility::String::viewBeginsWith(data, "BLENDER"))
         plugin = "BlenderImporter";
-    else if(Utility::String::endsWith(filename, ".bvh"))
-        plugin = "BvhImporter";
-    else if(Utility::String::endsWith(filename, ".csm"))
-        plugin = "CsmImporter";
-    else if(Utility::String::endsWith(filename, ".dae"))
-        plugin = "ColladaImporter";
-    else if(Utility::String::endsWith(filename, ".x"))
-        plugin = "DirectXImporter";
-    else if(Utility::String::endsWith(filename, ".dxf"))
-        plugin = "DxfImporter";
-    else if(Utility::String::endsWith(filename, ".fbx"))
+    /* https://code.blender.org/2013/08/fbx-binary-file-format-specification/ */
+    else if(Utility::String::viewBeginsWith(data, "Kaydara FBX Binary"))
         plugin = "FbxImporter";
-    else if(Utility::String::endsWith(filename, ".gltf"))
-        plugin = "GltfImporter";
-    else if(Utility::String::endsWith(filename, ".glb"))
-        plugin = "GlbImporter";
-    else if(Utility::String::endsWith(filename, ".ifc"))
-        plugin = "IfcImporter";
-    else if(Utility::String::endsWith(filename, ".irrmesh") ||
-            Utility::String::endsWith(filename, ".irr"))
-        plugin = "IrrlichtImporter";
-    else if(Utility::String::endsWith(filename, ".lwo") ||
-            Utility::String::endsWith(filename, ".lws"))
-        plugin = "LightWaveImporter";
-    else if(Utility::String::endsWith(filename, ".lxo"))
-        plugin = "ModoImporter";
-    else if(Utility::String::endsWith(filename, ".ms3d"))
+    /* http://paulbourke.net/dataformats/ms3d/ms3dspec.h */
+    else if(Utility::String::viewBeginsWith(data, "MS3D000000"))
         plugin = "MilkshapeImporter";
-    else if(Utility::String::endsWith(filename, ".obj"))
-        plugin = "ObjImporter";
-    else if(Utility::String::endsWith(filename, ".xml"))
-        plugin = "OgreImporter";
-    else if(Utility::String::endsWith(filename, ".ogex"))
-        plugin = "OpenGexImporter";
-    else if(Utility::String::endsWith(filename, ".ply"))
-        plugin = "StanfordImporter";
-    else if(Utility::String::endsWith(filename, ".stl"))
-        plugin = "StlImporter";
-    else if(Utility::String::endsWith(filename, ".cob") ||
-            Utility::String::endsWith(filename, ".scn"))
-        plugin = "TrueSpaceImporter";
-    else if(Utility::String::endsWith(filename, ".3d"))
-        plugin = "UnrealImporter";
-    else if(Utility::String::endsWith(filename, ".smd") ||
-            Utility::String::endsWith(filename, ".vta"))
-        plugin = "ValveImporter";
-    else if(Utility::String::endsWith(filename, ".xgl") ||
-            Utility::String::endsWith(filename, ".zgl"))
-        plugin = "XglImporter";
-    else {
-        Error() << "Trade::AnySceneImporter::openFile(): cannot determine type of file" << filename;
+    else if(!data.size()) {
+        Error{} << "Trade::AnySceneImporter::openData(): file is empty";
         return;
-    }
-
-    /* Try to load the plugin */
-    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
-        Error() << "Trade::AnySceneImporter::openFile(): cannot load" << plugin << "plugin";
+    } else {
+        std::uint32_t signature = data[0] << 24;
+        if(data.size() > 1) signature |= data[1] << 16;
+        if(data.size() > 2) signature |= data[2] << 8;
+        if(data.size() > 3) signature |= data[3];
+        Error() << "Trade::AnySceneImporter::openData(): cannot determine type from signature" << reinterpret_cast<void*>(signature);
         return;
     }
 
+    /* Try to get an instance of the plugin */
+    AbstractImporter* const importer = instance(plugin, "Trade::AnySceneImporter::openData():");
+    if(!importer) return;
+
     /* Try to open the file (error output should be printed by the plugin
        itself) */
-    std::unique_ptr<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
-    if(!importer->openFile(filename)) return;
+    if(!importer->openData(data)) return;
 
     /* Success, save the instance */
-    _in = std::move(importer);
+    _in = importer;
+}
+
+AbstractImporter* AnySceneImporter::instance(const std::string& plugin, const char* const prefix) {
+    /* Reuse an instance that was created for a previous file, if any */
+    const auto found = _instances.find(plugin);
+    if(found != _instances.end()) return found->second.get();
+
+    /* Try to load the plugin */
+    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
+        Error() << prefix << "cannot load" << plugin << "plugin";
+        return nullptr;
+    }
+
+    return _instances.emplace(plugin, static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin)).first->second.get();
 }
 
 Int AnySceneImporter::doDefaultScene() { return _in->defaultScene(); }
@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::Trade::AnySceneImporter
  */
 
+#include <unordered_map>
 #include <Magnum/Trade/AbstractImporter.h>
 
 #include "MagnumPlugins/AnySceneImporter/configure.h"
@@ -70,8 +71,8 @@ Supported formats:
 -   3ds Max 3DS and ASE (`*.3ds`, `*.ase`), loaded with any plugin that
     provides `3dsImporter`
 -   AC3D (`*.ac`), loaded with any plugin that provides `Ac3dImporter`
--   Blender 3D (`*.blend`), loaded with any plugin that provides
-    `BlenderImporter`
+-   Blender 3D (`*.blend` or data with corresponding signature), loaded with
+    any plugin that provides `BlenderImporter`
 -   Biovision BVH (`*.bvh`), loaded with any plugin that provides `BvhImporter`
 -   CharacterStudio Motion (`*.csm`), loaded with any plugin that provides
     `CsmImporter`
@@ -79,9 +80,11 @@ Supported formats:
     that provides it
 -   DirectX X (`*.x`), loaded with any plugin that provides `DirectXImporter`
 -   AutoCAD DXF (`*.dxf`), loaded with any plugin that provides `DxfImporter`
--   Autodesk FBX (`*.fbx`), loaded with any plugin that provides `FbxImporter`
+-   Autodesk FBX (`*.fbx` or binary data with corresponding signature),
+    loaded with any plugin that provides `FbxImporter`
 -   glTF (`*.gltf`), loaded with any plugin that provides `GltfImporter`
--   Binary glTF (`*.glb`), loaded with any plugin that provides `GlbImporter`
+-   Binary glTF (`*.glb` or data with corresponding signature), loaded with
+    any plugin that provides `GlbImporter`
 -   Industry Foundation Classes (IFC/Step) (`*.ifc`), loaded with any plugin
     that provides `IfcImporter`
 -   Irrlicht Mesh and Scene (`*.irrmesh`, `*.irr`), loaded with any plugin that
@@ -89,15 +92,15 @@ Supported formats:
 -   LightWave, LightWave Scene (`*.lwo`, `*.lws`), loaded with any plugin that
     provides `LightWaveImporter`
 -   Modo (`*.lxo`), loaded with any plugin that provides `ModoImporter`
--   Milkshape 3D (`*.ms3d`), loaded with any plugin that provides
-    `MilkshapeImporter`
+-   Milkshape 3D (`*.ms3d` or data with corresponding signature), loaded with
+    any plugin that provides `MilkshapeImporter`
 -   Wavefront OBJ (`*.obj`), loaded with @ref ObjImporter or any other plugin
     that provides it
 -   Ogre XML (`*.xml`), loaded with any plugin that provides `OgreImporter`
 -   OpenGEX (`*.ogex`), loaded with @ref OpenGexImporter or any other plugin
     that provides it
--   Stanford (`*.ply`), loaded with @ref StanfordImporter or any other plugin
-    that provides it
+-   Stanford (`*.ply` or data with corresponding signature), loaded with
+    @ref StanfordImporter or any other plugin that provides it
 -   Stereolitography (`*.stl`), loaded with any plugin that provides
     `StlImporter`
 -   TrueSpace (`*.cob`, `*.scn`), loaded with any plugin that provides
@@ -107,7 +110,18 @@ Supported formats:
     `ValveImporter`
 -   XGL (`*.xgl`, `*.zgl`), loaded with any plugin that provides `XglImporter`
 
-Only loading from files is supported.
+Detecting file type through @ref openData() is supported only for a subset of
+formats that are marked as such in the list above.
+
+@section Trade-AnySceneImporter-instances Reusing plugin instances
+
+The first time a file of given type is opened, the corresponding plugin is
+loaded and instantiated. The instance is then kept around and reused for all
+subsequent files of the same type, so opening a large number of files doesn't
+repeatedly pay for plugin instantiation. Closing the file only closes the
+delegated importer, the instances are destroyed together with the
+@ref AnySceneImporter instance. As a consequence, the delegated plugins can't
+be unloaded from the plugin manager until then.
 */
 class MAGNUM_ANYSCENEIMPORTER_EXPORT AnySceneImporter: public AbstractImporter {
     public:
@@ -124,6 +138,7 @@ class MAGNUM_ANYSCENEIMPORTER_EXPORT AnySceneImporter: public AbstractImporter {
         MAGNUM_ANYSCENEIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL void doClose() override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL void doOpenFile(const std::string& filename) override;
+        MAGNUM_ANYSCENEIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
 
         MAGNUM_ANYSCENEIMPORTER_LOCAL Int doDefaultScene() override;
 
@@ -187,7 +202,10 @@ class MAGNUM_ANYSCENEIMPORTER_EXPORT AnySceneImporter: public AbstractImporter {
         MAGNUM_ANYSCENEIMPORTER_LOCAL std::string doImage3DName(UnsignedInt id) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::Optional<ImageData3D> doImage3D(UnsignedInt id) override;
 
-        std::unique_ptr<AbstractImporter> _in;
+        MAGNUM_ANYSCENEIMPORTER_LOCAL AbstractImporter* instance(const std::string& plugin, const char* prefix);
+
+        std::unordered_map<std::string, std::unique_ptr<AbstractImporter>> _instances;
+        AbstractImporter* _in{};
 };
 
 }}
@@ -39,8 +39,11 @@ struct AnySceneImporterTest: TestSuite::Tester {
     explicit AnySceneImporterTest();
 
     void obj();
+    void reopen();
 
     void unknown();
+    void unknownSignature();
+    void emptyData();
 
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
@@ -48,8 +51,11 @@ struct AnySceneImporterTest: TestSuite::Tester {
 
 AnySceneImporterTest::AnySceneImporterTest() {
     addTests({&AnySceneImporterTest::obj,
+              &AnySceneImporterTest::reopen,
 
-              &AnySceneImporterTest::unknown});
+              &AnySceneImporterTest::unknown,
+              &AnySceneImporterTest::unknownSignature,
+              &AnySceneImporterTest::emptyData});
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
@@ -75,6 +81,22 @@ void AnySceneImporterTest::obj() {
     CORRADE_COMPARE(mesh->positions(0).size(), 3);
 }
 
+void AnySceneImporterTest::reopen() {
+    if(!(_manager.loadState("ObjImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("ObjImporter plugin not enabled, cannot test");
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
+    CORRADE_VERIFY(importer->openFile(OBJ_FILE));
+    importer->close();
+    CORRADE_VERIFY(!importer->isOpened());
+
+    /* The second time the pooled instance is reused */
+    CORRADE_VERIFY(importer->openFile(OBJ_FILE));
+    Containers::Optional<MeshData3D> mesh = importer->mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->positions(0).size(), 3);
+}
+
 void AnySceneImporterTest::unknown() {
     std::ostringstream output;
     Error redirectError{&output};
@@ -85,6 +107,28 @@ void AnySceneImporterTest::unknown() {
     CORRADE_COMPARE(output.str(), "Trade::AnySceneImporter::openFile(): cannot determine type of file mesh.wtf\n");
 }
 
+void AnySceneImporterTest::unknownSignature() {
+    std::ostringstream output;
+    Error redirectError{&output};
+
+    constexpr const char data[]{ 0x25, 0x3a };
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
+    CORRADE_VERIFY(!importer->openData(data));
+
+    CORRADE_COMPARE(output.str(), "Trade::AnySceneImporter::openData(): cannot determine type from signature 0x253a0000\n");
+}
+
+void AnySceneImporterTest::emptyData() {
+    std::ostringstream output;
+    Error redirectError{&output};
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
+    CORRADE_VERIFY(!importer->openData(nullptr));
+
+    CORRADE_COMPARE(output.str(), "Trade::AnySceneImporter::openData(): file is empty\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AnySceneImporterTest)
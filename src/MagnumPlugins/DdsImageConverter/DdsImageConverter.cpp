@@ -0,0 +1,431 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DdsImageConverter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/PixelConversion.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+#include "MagnumPlugins/DdsImporter/DdsHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+/* Block of 4x4 RGBA pixels, row-major */
+typedef UnsignedByte Block[16][4];
+
+UnsignedShort packRgb565(const Float* const color) {
+    const auto channel = [](Float value, UnsignedInt max) {
+        return UnsignedInt(Math::clamp(value, 0.0f, 255.0f)*max/255.0f + 0.5f);
+    };
+    return UnsignedShort(channel(color[0], 31) << 11|channel(color[1], 63) << 5|channel(color[2], 31));
+}
+
+void unpackRgb565(const UnsignedShort packed, Int* const color) {
+    const Int r = packed >> 11, g = (packed >> 5) & 0x3f, b = packed & 0x1f;
+    color[0] = r << 3|r >> 2;
+    color[1] = g << 2|g >> 4;
+    color[2] = b << 3|b >> 2;
+}
+
+void writeLittleEndian(char* const out, const UnsignedLong value, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = char((value >> (i*8)) & 0xff);
+}
+
+/* Encodes the color part of a BC1, BC2 or BC3 block. Endpoints are the
+   extremes of the pixels projected onto the principal axis of their
+   distribution. If transparency is allowed (BC1 with alpha), pixels with
+   alpha below one half use the punch-through index and don't contribute to
+   the endpoints. */
+void encodeColorBlock(const Block& block, const bool allowTransparency, char* const out) {
+    bool transparent[16]{};
+    bool anyTransparent = false;
+    Float mean[3]{};
+    Int opaqueCount = 0;
+    for(std::size_t i = 0; i != 16; ++i) {
+        if(allowTransparency && block[i][3] < 128) {
+            transparent[i] = anyTransparent = true;
+            continue;
+        }
+        for(std::size_t c = 0; c != 3; ++c) mean[c] += block[i][c];
+        ++opaqueCount;
+    }
+
+    /* Everything transparent, color endpoints don't matter */
+    if(!opaqueCount) {
+        writeLittleEndian(out, 0xffffffff00000000ull, 8);
+        return;
+    }
+
+    for(Float& c: mean) c /= opaqueCount;
+
+    /* Covariance matrix of the opaque pixels */
+    Float covariance[6]{};
+    for(std::size_t i = 0; i != 16; ++i) {
+        if(transparent[i]) continue;
+        const Float r = block[i][0] - mean[0],
+            g = block[i][1] - mean[1],
+            b = block[i][2] - mean[2];
+        covariance[0] += r*r;
+        covariance[1] += r*g;
+        covariance[2] += r*b;
+        covariance[3] += g*g;
+        covariance[4] += g*b;
+        covariance[5] += b*b;
+    }
+
+    /* Principal axis using a few power iterations */
+    Float axis[3]{1.0f, 1.0f, 1.0f};
+    for(std::size_t iteration = 0; iteration != 4; ++iteration) {
+        const Float x = covariance[0]*axis[0] + covariance[1]*axis[1] + covariance[2]*axis[2];
+        const Float y = covariance[1]*axis[0] + covariance[3]*axis[1] + covariance[4]*axis[2];
+        const Float z = covariance[2]*axis[0] + covariance[4]*axis[1] + covariance[5]*axis[2];
+        const Float length = std::max(std::max(std::abs(x), std::abs(y)), std::abs(z));
+        if(length < 1.0e-6f) break;
+        axis[0] = x/length;
+        axis[1] = y/length;
+        axis[2] = z/length;
+    }
+
+    /* Extremes along the axis */
+    Float min = std::numeric_limits<Float>::max(), max = -min;
+    std::size_t minIndex = 0, maxIndex = 0;
+    for(std::size_t i = 0; i != 16; ++i) {
+        if(transparent[i]) continue;
+        const Float projected = block[i][0]*axis[0] + block[i][1]*axis[1] + block[i][2]*axis[2];
+        if(projected < min) {
+            min = projected;
+            minIndex = i;
+        }
+        if(projected > max) {
+            max = projected;
+            maxIndex = i;
+        }
+    }
+
+    const Float first[]{Float(block[maxIndex][0]), Float(block[maxIndex][1]), Float(block[maxIndex][2])};
+    const Float second[]{Float(block[minIndex][0]), Float(block[minIndex][1]), Float(block[minIndex][2])};
+    UnsignedShort color0 = packRgb565(first);
+    UnsignedShort color1 = packRgb565(second);
+
+    /* The four-color mode is selected with color0 > color1, the three-color
+       mode with punch-through alpha with color0 <= color1 */
+    if(anyTransparent ? color0 > color1 : color0 < color1)
+        std::swap(color0, color1);
+
+    /* Build the palette */
+    Int palette[4][3];
+    unpackRgb565(color0, palette[0]);
+    unpackRgb565(color1, palette[1]);
+    std::size_t paletteSize;
+    if(anyTransparent) {
+        for(std::size_t c = 0; c != 3; ++c)
+            palette[2][c] = (palette[0][c] + palette[1][c])/2;
+        paletteSize = 3;
+    } else {
+        for(std::size_t c = 0; c != 3; ++c) {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        }
+        /* Both endpoints quantized to the same value, in which case the
+           decoder would pick the three-color mode. Use just the first
+           index. */
+        paletteSize = color0 == color1 ? 1 : 4;
+    }
+
+    /* Pick the nearest palette entry for each pixel */
+    UnsignedInt indices = 0;
+    for(std::size_t i = 0; i != 16; ++i) {
+        UnsignedInt index = 3;
+        if(!transparent[i]) {
+            Int bestDistance = std::numeric_limits<Int>::max();
+            for(std::size_t j = 0; j != paletteSize; ++j) {
+                Int distance = 0;
+                for(std::size_t c = 0; c != 3; ++c) {
+                    const Int d = block[i][c] - palette[j][c];
+                    distance += d*d;
+                }
+                if(distance < bestDistance) {
+                    bestDistance = distance;
+                    index = UnsignedInt(j);
+                }
+            }
+        }
+        indices |= index << (i*2);
+    }
+
+    writeLittleEndian(out, color0, 2);
+    writeLittleEndian(out + 2, color1, 2);
+    writeLittleEndian(out + 4, indices, 4);
+}
+
+/* Explicit 4-bit alpha of a BC2 block */
+void encodeExplicitAlphaBlock(const Block& block, char* const out) {
+    UnsignedLong alpha = 0;
+    for(std::size_t i = 0; i != 16; ++i)
+        alpha |= UnsignedLong((block[i][3]*15 + 127)/255) << (i*4);
+    writeLittleEndian(out, alpha, 8);
+}
+
+/* Interpolated alpha of a BC3 block, always using the eight-value mode with
+   the block minimum and maximum as endpoints */
+void encodeInterpolatedAlphaBlock(const Block& block, char* const out) {
+    Int alpha0 = 0, alpha1 = 255;
+    for(std::size_t i = 0; i != 16; ++i) {
+        alpha0 = std::max(alpha0, Int(block[i][3]));
+        alpha1 = std::min(alpha1, Int(block[i][3]));
+    }
+
+    UnsignedLong indices = 0;
+    if(alpha0 != alpha1) {
+        Int palette[8]{alpha0, alpha1};
+        for(Int j = 1; j != 7; ++j)
+            palette[j + 1] = ((7 - j)*alpha0 + j*alpha1)/7;
+
+        for(std::size_t i = 0; i != 16; ++i) {
+            UnsignedLong index = 0;
+            Int bestDistance = 256;
+            for(std::size_t j = 0; j != 8; ++j) {
+                const Int distance = std::abs(block[i][3] - palette[j]);
+                if(distance < bestDistance) {
+                    bestDistance = distance;
+                    index = j;
+                }
+            }
+            indices |= index << (i*3);
+        }
+    }
+
+    out[0] = char(alpha0);
+    out[1] = char(alpha1);
+    writeLittleEndian(out + 2, indices, 6);
+}
+
+/* Size of one 4x4 block in bytes, 0 if the format is not supported */
+std::size_t blockDataSize(const CompressedPixelFormat format) {
+    switch(format) {
+        case CompressedPixelFormat::Bc1RGBUnorm:
+        case CompressedPixelFormat::Bc1RGBAUnorm:
+            return 8;
+        case CompressedPixelFormat::Bc2RGBAUnorm:
+        case CompressedPixelFormat::Bc3RGBAUnorm:
+            return 16;
+        default: return 0;
+    }
+}
+
+std::size_t compressedDataSize(const CompressedPixelFormat format, const Vector2i& size) {
+    return blockDataSize(format)*((size + Vector2i{3})/4).product();
+}
+
+bool checkFormats(const char* const prefix, const PixelFormat format, const CompressedPixelFormat compressedFormat) {
+    if(format != PixelFormat::RGB8Unorm && format != PixelFormat::RGBA8Unorm) {
+        Error() << prefix << "unsupported pixel format" << format;
+        return false;
+    }
+
+    if(!blockDataSize(compressedFormat)) {
+        Error() << prefix << "unsupported compressed format" << compressedFormat;
+        return false;
+    }
+
+    return true;
+}
+
+/* Tightly packed RGBA copy of the image, with alpha set to 255 for RGB
+   images */
+Containers::Array<Color4ub> toRgba(const ImageView2D& image) {
+    Containers::Array<Color4ub> out{std::size_t(image.size().product())};
+
+    const char* const imageData = image.data() + std::get<0>(image.dataProperties()).sum();
+    const std::size_t rowStride = std::get<1>(image.dataProperties()).x();
+    const std::size_t width = image.size().x();
+    for(std::size_t y = 0; y != std::size_t(image.size().y()); ++y) {
+        const char* const row = imageData + y*rowStride;
+        if(image.format() == PixelFormat::RGB8Unorm)
+            rgbToRgba(Containers::ArrayView<const Color3ub>{reinterpret_cast<const Color3ub*>(row), width}, out.slice(y*width, (y + 1)*width));
+        else std::copy_n(reinterpret_cast<const Color4ub*>(row), width, out.begin() + y*width);
+    }
+
+    return out;
+}
+
+/* Next mip level using a 2x2 box filter. For odd sizes the last row or
+   column is dropped, for sizes of 1 the same row or column is used twice. */
+Containers::Array<Color4ub> downsample(const Containers::ArrayView<const Color4ub> pixels, const Vector2i& size, const Vector2i& nextSize) {
+    Containers::Array<Color4ub> out{std::size_t(nextSize.product())};
+    for(Int y = 0; y != nextSize.y(); ++y) {
+        const Color4ub* const row0 = pixels.data() + std::min(2*y, size.y() - 1)*size.x();
+        const Color4ub* const row1 = pixels.data() + std::min(2*y + 1, size.y() - 1)*size.x();
+        for(Int x = 0; x != nextSize.x(); ++x) {
+            const Int x0 = std::min(2*x, size.x() - 1);
+            const Int x1 = std::min(2*x + 1, size.x() - 1);
+            Color4ub& to = out[y*nextSize.x() + x];
+            for(std::size_t c = 0; c != 4; ++c)
+                to[c] = UnsignedByte((row0[x0][c] + row0[x1][c] + row1[x0][c] + row1[x1][c] + 2)/4);
+        }
+    }
+
+    return out;
+}
+
+/* Compresses tightly packed RGBA pixels into the output, which is expected
+   to have compressedDataSize() bytes. Each row of blocks is a separate task,
+   partial blocks at the edges repeat the last row and column. */
+void compress(const Containers::ArrayView<const Color4ub> pixels, const Vector2i& size, const CompressedPixelFormat format, const UnsignedInt threadCount, char* const out) {
+    const Vector2i blockCount = (size + Vector2i{3})/4;
+    const std::size_t blockSize = blockDataSize(format);
+
+    Magnum::Implementation::parallelFor(threadCount, blockCount.y(), [&](const std::size_t blockY) {
+        char* blockOut = out + blockY*blockCount.x()*blockSize;
+        for(Int blockX = 0; blockX != blockCount.x(); ++blockX) {
+            Block block;
+            for(Int i = 0; i != 16; ++i) {
+                const Int x = std::min(blockX*4 + i%4, size.x() - 1);
+                const Int y = std::min(Int(blockY)*4 + i/4, size.y() - 1);
+                const Color4ub& pixel = pixels[y*size.x() + x];
+                for(std::size_t c = 0; c != 4; ++c) block[i][c] = pixel[c];
+            }
+
+            switch(format) {
+                case CompressedPixelFormat::Bc1RGBUnorm:
+                    encodeColorBlock(block, false, blockOut);
+                    break;
+                case CompressedPixelFormat::Bc1RGBAUnorm:
+                    encodeColorBlock(block, true, blockOut);
+                    break;
+                case CompressedPixelFormat::Bc2RGBAUnorm:
+                    encodeExplicitAlphaBlock(block, blockOut);
+                    encodeColorBlock(block, false, blockOut + 8);
+                    break;
+                case CompressedPixelFormat::Bc3RGBAUnorm:
+                    encodeInterpolatedAlphaBlock(block, blockOut);
+                    encodeColorBlock(block, false, blockOut + 8);
+                    break;
+                default: CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+            }
+
+            blockOut += blockSize;
+        }
+    });
+}
+
+}
+
+DdsImageConverter::DdsImageConverter() = default;
+
+DdsImageConverter::DdsImageConverter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImageConverter{manager, plugin} {}
+
+auto DdsImageConverter::doFeatures() const -> Features {
+    return Feature::ConvertCompressedImage|Feature::ConvertData;
+}
+
+Containers::Optional<CompressedImage2D> DdsImageConverter::doExportToCompressedImage(const ImageView2D& image) {
+    if(!checkFormats("Trade::DdsImageConverter::exportToCompressedImage():", image.format(), _format))
+        return Containers::NullOpt;
+
+    const Containers::Array<Color4ub> pixels = toRgba(image);
+    Containers::Array<char> data{compressedDataSize(_format, image.size())};
+    compress(pixels, image.size(), _format, _threadCount, data.begin());
+    return CompressedImage2D{_format, image.size(), std::move(data)};
+}
+
+Containers::Array<char> DdsImageConverter::doExportToData(const ImageView2D& image) {
+    if(!checkFormats("Trade::DdsImageConverter::exportToData():", image.format(), _format))
+        return nullptr;
+
+    /* Size of the full mip chain, clamp the level count to it */
+    UnsignedInt levelCount = 1;
+    std::size_t dataSize = compressedDataSize(_format, image.size());
+    for(Vector2i size = image.size(); size != Vector2i{1} && levelCount != _levelCount; ++levelCount) {
+        size = Math::max(size/2, Vector2i{1});
+        dataSize += compressedDataSize(_format, size);
+    }
+
+    Containers::Array<char> data{Containers::ValueInit, sizeof(Implementation::DdsHeader) + dataSize};
+
+    /* Fill header */
+    auto header = reinterpret_cast<Implementation::DdsHeader*>(data.begin());
+    std::copy_n("DDS ", 4, header->magic);
+    header->size = Utility::Endianness::littleEndian(UnsignedInt(sizeof(Implementation::DdsHeader) - 4));
+    header->flags = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsFlagCaps|Implementation::DdsFlagHeight|Implementation::DdsFlagWidth|Implementation::DdsFlagPixelFormat|Implementation::DdsFlagLinearSize|(levelCount > 1 ? Implementation::DdsFlagMipMapCount : 0)));
+    header->height = Utility::Endianness::littleEndian(UnsignedInt(image.size().y()));
+    header->width = Utility::Endianness::littleEndian(UnsignedInt(image.size().x()));
+    header->pitchOrLinearSize = Utility::Endianness::littleEndian(UnsignedInt(compressedDataSize(_format, image.size())));
+    header->mipMapCount = Utility::Endianness::littleEndian(levelCount);
+    header->pixelFormat.size = Utility::Endianness::littleEndian(UnsignedInt(sizeof(header->pixelFormat)));
+    header->pixelFormat.flags = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsPixelFormatFlagFourCC|(_format == CompressedPixelFormat::Bc1RGBAUnorm ? Implementation::DdsPixelFormatFlagAlphaPixels : 0)));
+    switch(_format) {
+        case CompressedPixelFormat::Bc1RGBUnorm:
+        case CompressedPixelFormat::Bc1RGBAUnorm:
+            std::copy_n("DXT1", 4, header->pixelFormat.fourCC);
+            break;
+        case CompressedPixelFormat::Bc2RGBAUnorm:
+            std::copy_n("DXT3", 4, header->pixelFormat.fourCC);
+            break;
+        case CompressedPixelFormat::Bc3RGBAUnorm:
+            std::copy_n("DXT5", 4, header->pixelFormat.fourCC);
+            break;
+        default: CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+    header->caps = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsCapsTexture|(levelCount > 1 ? Implementation::DdsCapsComplex|Implementation::DdsCapsMipMap : 0)));
+
+    /* Compress all levels, each downsampled from the previous one */
+    Containers::Array<Color4ub> pixels = toRgba(image);
+    Vector2i size = image.size();
+    char* out = data.begin() + sizeof(Implementation::DdsHeader);
+    for(UnsignedInt level = 0; level != levelCount; ++level) {
+        if(level) {
+            const Vector2i nextSize = Math::max(size/2, Vector2i{1});
+            pixels = downsample(pixels, size, nextSize);
+            size = nextSize;
+        }
+
+        compress(pixels, size, _format, _threadCount, out);
+        out += compressedDataSize(_format, size);
+    }
+
+    CORRADE_INTERNAL_ASSERT(out == data.end());
+    return data;
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(DdsImageConverter, Magnum::Trade::DdsImageConverter,
+    "cz.mosra.magnum.Trade.AbstractImageConverter/0.2.1")
@@ -0,0 +1,198 @@
+#ifndef Magnum_Trade_DdsImageConverter_h
+#define Magnum_Trade_DdsImageConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::DdsImageConverter
+ */
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
+
+#include "MagnumPlugins/DdsImageConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_DDSIMAGECONVERTER_BUILD_STATIC
+    #if defined(DdsImageConverter_EXPORTS) || defined(DdsImageConverterObjects_EXPORTS)
+        #define MAGNUM_DDSIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_DDSIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_DDSIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_DDSIMAGECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_DDSIMAGECONVERTER_EXPORT
+#define MAGNUM_DDSIMAGECONVERTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief DDS image converter plugin
+
+Compresses images with format @ref PixelFormat::RGB8Unorm or
+@ref PixelFormat::RGBA8Unorm to one of the S3TC formats and either returns
+them as a @ref CompressedImage2D using @ref exportToCompressedImage() or
+writes them to a DirectDraw Surface (`*.dds`) file including a mip chain using
+@ref exportToData() / @ref exportToFile().
+
+This plugin depends on the @ref Trade library and is built if
+`WITH_DDSIMAGECONVERTER` is enabled when building Magnum. To use as a dynamic
+plugin, you need to load the @cpp "DdsImageConverter" @ce plugin from
+`MAGNUM_PLUGINS_IMAGECONVERTER_DIR`. To use as a static plugin or as a
+dependency of another plugin with CMake, you need to request the
+`DdsImageConverter` component of the `Magnum` package and link to the
+`Magnum::DdsImageConverter` target. See @ref building, @ref cmake and
+@ref plugins for more information.
+
+@section Trade-DdsImageConverter-formats Compressed formats
+
+The target format is set using @ref setFormat(), supported are
+@ref CompressedPixelFormat::Bc1RGBUnorm (the default),
+@ref CompressedPixelFormat::Bc1RGBAUnorm with one-bit alpha,
+@ref CompressedPixelFormat::Bc2RGBAUnorm with explicit four-bit alpha and
+@ref CompressedPixelFormat::Bc3RGBAUnorm with interpolated alpha. The BC1
+formats take eight times less memory than a @ref PixelFormat::RGBA8Unorm
+image, the BC2 and BC3 formats four times less. Color endpoints of each block
+are picked along the principal axis of the block colors, which is fast and
+gives reasonable quality, but isn't as good as exhaustive search done by
+dedicated offline compressors. For RGB input the alpha channel is assumed to
+be fully opaque.
+
+Image sizes that are not a multiple of the four-pixel block size are padded
+by repeating the last row and column. The image data are compressed in the
+same bottom-up row order as they are stored in the input image, so the
+compressed image can be uploaded directly to a GPU texture.
+
+@section Trade-DdsImageConverter-mipmaps Mip chains
+
+When exporting to a DDS file, @ref setLevelCount() specifies the count of mip
+levels to generate. Each level is downsampled from the previous one using a
+2x2 box filter and compressed separately. Level count of @cpp 0 @ce generates
+the full chain down to a 1x1 image:
+
+@code{.cpp}
+static_cast<Trade::DdsImageConverter&>(*converter)
+    .setFormat(CompressedPixelFormat::Bc3RGBAUnorm)
+    .setLevelCount(0);
+converter->exportToFile(image, "texture.dds");
+@endcode
+
+@section Trade-DdsImageConverter-multithreading Multithreaded compression
+
+The blocks are independent of each other and can be compressed on multiple
+threads of @ref globalJobExecutor() using @ref setThreadCount(), which is
+especially useful for large textures. The output is the same regardless of the
+thread count.
+Multithreaded compression is not available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where @ref setThreadCount() is
+ignored.
+*/
+class MAGNUM_DDSIMAGECONVERTER_EXPORT DdsImageConverter: public AbstractImageConverter {
+    public:
+        /** @brief Default constructor */
+        explicit DdsImageConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit DdsImageConverter(PluginManager::AbstractManager& manager, const std::string& plugin);
+
+        /**
+         * @brief Target compressed format
+         *
+         * Default is @ref CompressedPixelFormat::Bc1RGBUnorm.
+         */
+        CompressedPixelFormat format() const { return _format; }
+
+        /**
+         * @brief Set target compressed format
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Trade-DdsImageConverter-formats for a list of supported
+         * formats. Unsupported formats are reported at conversion time.
+         */
+        DdsImageConverter& setFormat(CompressedPixelFormat format) {
+            _format = format;
+            return *this;
+        }
+
+        /**
+         * @brief Mip level count
+         *
+         * Default is @cpp 1 @ce, meaning only the base level is written.
+         */
+        UnsignedInt levelCount() const { return _levelCount; }
+
+        /**
+         * @brief Set mip level count
+         * @return Reference to self (for method chaining)
+         *
+         * Value of @cpp 0 @ce generates the full mip chain, values larger
+         * than the full chain length are clamped. Affects only
+         * @ref exportToData() and @ref exportToFile(),
+         * @ref exportToCompressedImage() always produces just the base level.
+         * See @ref Trade-DdsImageConverter-mipmaps for more information.
+         */
+        DdsImageConverter& setLevelCount(UnsignedInt count) {
+            _levelCount = count;
+            return *this;
+        }
+
+        /**
+         * @brief Thread count used for compression
+         *
+         * Default is @cpp 1 @ce, meaning the compression is done only on the
+         * calling thread.
+         */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count used for compression
+         * @return Reference to self (for method chaining)
+         *
+         * The calling thread is counted as well. Value of @cpp 0 @ce is
+         * treated the same as @cpp 1 @ce. See
+         * @ref Trade-DdsImageConverter-multithreading for more information.
+         */
+        DdsImageConverter& setThreadCount(UnsignedInt count) {
+            _threadCount = count ? count : 1;
+            return *this;
+        }
+
+    private:
+        Features MAGNUM_DDSIMAGECONVERTER_LOCAL doFeatures() const override;
+        Containers::Optional<CompressedImage2D> MAGNUM_DDSIMAGECONVERTER_LOCAL doExportToCompressedImage(const ImageView2D& image) override;
+        Containers::Array<char> MAGNUM_DDSIMAGECONVERTER_LOCAL doExportToData(const ImageView2D& image) override;
+
+        CompressedPixelFormat _format{CompressedPixelFormat::Bc1RGBUnorm};
+        UnsignedInt _levelCount{1};
+        UnsignedInt _threadCount{1};
+};
+
+}}
+
+#endif
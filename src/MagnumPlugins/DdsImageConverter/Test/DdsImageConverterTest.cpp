@@ -0,0 +1,312 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <string>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
+#include "MagnumPlugins/DdsImageConverter/DdsImageConverter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct DdsImageConverterTest: TestSuite::Tester {
+    explicit DdsImageConverterTest();
+
+    void wrongFormat();
+    void wrongCompressedFormat();
+
+    void bc1();
+    void bc1TwoColors();
+    void bc1Alpha();
+    void bc2();
+    void bc3();
+    void padded();
+    void multithreaded();
+
+    void dds();
+    void ddsLevelCountClamped();
+    void ddsWrongFormat();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImageConverter> _manager{"nonexistent"};
+};
+
+DdsImageConverterTest::DdsImageConverterTest() {
+    addTests({&DdsImageConverterTest::wrongFormat,
+              &DdsImageConverterTest::wrongCompressedFormat,
+
+              &DdsImageConverterTest::bc1,
+              &DdsImageConverterTest::bc1TwoColors,
+              &DdsImageConverterTest::bc1Alpha,
+              &DdsImageConverterTest::bc2,
+              &DdsImageConverterTest::bc3,
+              &DdsImageConverterTest::padded,
+              &DdsImageConverterTest::multithreaded,
+
+              &DdsImageConverterTest::dds,
+              &DdsImageConverterTest::ddsLevelCountClamped,
+              &DdsImageConverterTest::ddsWrongFormat});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef DDSIMAGECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(DDSIMAGECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+namespace {
+    /* Top half transparent, bottom half opaque. The rows are in memory
+       order, i.e. the bottom one first. */
+    const Color4ub HalfTransparentData[] = {
+        {0xff, 0xff, 0xff, 0x00}, {0xff, 0xff, 0xff, 0x00},
+        {0xff, 0xff, 0xff, 0x00}, {0xff, 0xff, 0xff, 0x00},
+        {0xff, 0xff, 0xff, 0x00}, {0xff, 0xff, 0xff, 0x00},
+        {0xff, 0xff, 0xff, 0x00}, {0xff, 0xff, 0xff, 0x00},
+        {0xff, 0xff, 0xff, 0xff}, {0xff, 0xff, 0xff, 0xff},
+        {0xff, 0xff, 0xff, 0xff}, {0xff, 0xff, 0xff, 0xff},
+        {0xff, 0xff, 0xff, 0xff}, {0xff, 0xff, 0xff, 0xff},
+        {0xff, 0xff, 0xff, 0xff}, {0xff, 0xff, 0xff, 0xff}
+    };
+    const ImageView2D HalfTransparent{PixelFormat::RGBA8Unorm, {4, 4}, HalfTransparentData};
+}
+
+void DdsImageConverterTest::wrongFormat() {
+    ImageView2D image{PixelFormat::R8Unorm, {}, nullptr};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    CORRADE_VERIFY(!converter->exportToCompressedImage(image));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImageConverter::exportToCompressedImage(): unsupported pixel format PixelFormat::R8Unorm\n");
+}
+
+void DdsImageConverterTest::wrongCompressedFormat() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    static_cast<DdsImageConverter&>(*converter).setFormat(compressedPixelFormatWrap(0xdead));
+    CORRADE_VERIFY(!converter->exportToCompressedImage(HalfTransparent));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImageConverter::exportToCompressedImage(): unsupported compressed format CompressedPixelFormat::ImplementationSpecific(0xdead)\n");
+}
+
+void DdsImageConverterTest::bc1() {
+    const Color3ub data[16]{
+        {0xff, 0, 0}, {0xff, 0, 0}, {0xff, 0, 0}, {0xff, 0, 0},
+        {0xff, 0, 0}, {0xff, 0, 0}, {0xff, 0, 0}, {0xff, 0, 0},
+        {0xff, 0, 0}, {0xff, 0, 0}, {0xff, 0, 0}, {0xff, 0, 0},
+        {0xff, 0, 0}, {0xff, 0, 0}, {0xff, 0, 0}, {0xff, 0, 0}
+    };
+
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    CORRADE_COMPARE(static_cast<DdsImageConverter&>(*converter).format(), CompressedPixelFormat::Bc1RGBUnorm);
+    Containers::Optional<CompressedImage2D> image = converter->exportToCompressedImage(ImageView2D{PixelFormat::RGB8Unorm, {4, 4}, data});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE(image->size(), Vector2i(4, 4));
+
+    /* Both endpoints are the same, all indices zero */
+    const char expected[]{
+        0x00, char(0xf8), 0x00, char(0xf8), 0x00, 0x00, 0x00, 0x00
+    };
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void DdsImageConverterTest::bc1TwoColors() {
+    const Color4ub black{0x00, 0xff}, white{0xff, 0xff};
+    const Color4ub data[16]{
+        black, black, white, white,
+        black, black, white, white,
+        black, black, white, white,
+        black, black, white, white
+    };
+
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    Containers::Optional<CompressedImage2D> image = converter->exportToCompressedImage(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data});
+    CORRADE_VERIFY(image);
+
+    /* White endpoint first to select the four-color mode */
+    const char expected[]{
+        char(0xff), char(0xff), 0x00, 0x00, 0x05, 0x05, 0x05, 0x05
+    };
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void DdsImageConverterTest::bc1Alpha() {
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    static_cast<DdsImageConverter&>(*converter).setFormat(CompressedPixelFormat::Bc1RGBAUnorm);
+    Containers::Optional<CompressedImage2D> image = converter->exportToCompressedImage(HalfTransparent);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), CompressedPixelFormat::Bc1RGBAUnorm);
+
+    /* Three-color mode, the transparent pixels use the last index */
+    const char expected[]{
+        char(0xff), char(0xff), char(0xff), char(0xff),
+        char(0xff), char(0xff), 0x00, 0x00
+    };
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void DdsImageConverterTest::bc2() {
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    static_cast<DdsImageConverter&>(*converter).setFormat(CompressedPixelFormat::Bc2RGBAUnorm);
+    Containers::Optional<CompressedImage2D> image = converter->exportToCompressedImage(HalfTransparent);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), CompressedPixelFormat::Bc2RGBAUnorm);
+
+    const char expected[]{
+        /* Four bits of alpha for each pixel */
+        0x00, 0x00, 0x00, 0x00, char(0xff), char(0xff), char(0xff), char(0xff),
+        /* Color block with white endpoints */
+        char(0xff), char(0xff), char(0xff), char(0xff), 0x00, 0x00, 0x00, 0x00
+    };
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void DdsImageConverterTest::bc3() {
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    static_cast<DdsImageConverter&>(*converter).setFormat(CompressedPixelFormat::Bc3RGBAUnorm);
+    Containers::Optional<CompressedImage2D> image = converter->exportToCompressedImage(HalfTransparent);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), CompressedPixelFormat::Bc3RGBAUnorm);
+
+    const char expected[]{
+        /* Alpha endpoints 255 and 0, first eight pixels use index 1 */
+        char(0xff), 0x00, 0x49, char(0x92), 0x24, 0x00, 0x00, 0x00,
+        /* Color block with white endpoints */
+        char(0xff), char(0xff), char(0xff), char(0xff), 0x00, 0x00, 0x00, 0x00
+    };
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void DdsImageConverterTest::padded() {
+    /* 5x3 image is two blocks, the edges are repeated */
+    Color3ub data[5*3];
+    for(Color3ub& i: data) i = {0x00, 0xff, 0x00};
+
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    Containers::Optional<CompressedImage2D> image = converter->exportToCompressedImage(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {5, 3}, data});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(5, 3));
+
+    const char expected[]{
+        char(0xe0), 0x07, char(0xe0), 0x07, 0x00, 0x00, 0x00, 0x00,
+        char(0xe0), 0x07, char(0xe0), 0x07, 0x00, 0x00, 0x00, 0x00
+    };
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void DdsImageConverterTest::multithreaded() {
+    Color4ub data[64*64];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i] = Color4ub(i*7, i*13, i*31, i*3);
+    const ImageView2D image{PixelFormat::RGBA8Unorm, {64, 64}, data};
+
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    static_cast<DdsImageConverter&>(*converter).setFormat(CompressedPixelFormat::Bc3RGBAUnorm);
+    Containers::Optional<CompressedImage2D> single = converter->exportToCompressedImage(image);
+    CORRADE_VERIFY(single);
+
+    static_cast<DdsImageConverter&>(*converter).setThreadCount(4);
+    CORRADE_COMPARE(static_cast<DdsImageConverter&>(*converter).threadCount(), 4);
+    Containers::Optional<CompressedImage2D> multi = converter->exportToCompressedImage(image);
+    CORRADE_VERIFY(multi);
+    CORRADE_COMPARE_AS(multi->data(), single->data(),
+        TestSuite::Compare::Container);
+}
+
+void DdsImageConverterTest::dds() {
+    Color4ub data[8*4];
+    for(Color4ub& i: data) i = {0x00, 0xff, 0x00, 0xff};
+
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    static_cast<DdsImageConverter&>(*converter).setLevelCount(0);
+    const auto out = converter->exportToData(ImageView2D{PixelFormat::RGBA8Unorm, {8, 4}, data});
+    CORRADE_VERIFY(out);
+
+    /* 8x4, 4x2, 2x1 and 1x1 levels after the header, the first having two
+       blocks */
+    CORRADE_COMPARE(out.size(), 128 + 5*8);
+    CORRADE_COMPARE(std::string(out.data(), 4), "DDS ");
+    CORRADE_COMPARE(Int(out[12]), 4);
+    CORRADE_COMPARE(Int(out[16]), 8);
+    CORRADE_COMPARE(Int(out[28]), 4);
+    CORRADE_COMPARE(std::string(out.data() + 84, 4), "DXT1");
+
+    const char block[]{
+        char(0xe0), 0x07, char(0xe0), 0x07, 0x00, 0x00, 0x00, 0x00
+    };
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_COMPARE_AS(out.slice(128 + i*8, 128 + (i + 1)*8),
+            Containers::arrayView(block),
+            TestSuite::Compare::Container);
+    }
+}
+
+void DdsImageConverterTest::ddsLevelCountClamped() {
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    static_cast<DdsImageConverter&>(*converter)
+        .setFormat(CompressedPixelFormat::Bc3RGBAUnorm)
+        .setLevelCount(10);
+    const auto out = converter->exportToData(ImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, HalfTransparentData});
+    CORRADE_VERIFY(out);
+
+    /* 2x2 and 1x1 */
+    CORRADE_COMPARE(out.size(), 128 + 2*16);
+    CORRADE_COMPARE(Int(out[28]), 2);
+    CORRADE_COMPARE(std::string(out.data() + 84, 4), "DXT5");
+}
+
+void DdsImageConverterTest::ddsWrongFormat() {
+    ImageView2D image{PixelFormat::RG8Unorm, {}, nullptr};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::unique_ptr<AbstractImageConverter> converter = _manager.instantiate("DdsImageConverter");
+    CORRADE_VERIFY(!converter->exportToData(image));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImageConverter::exportToData(): unsupported pixel format PixelFormat::RG8Unorm\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::DdsImageConverterTest)
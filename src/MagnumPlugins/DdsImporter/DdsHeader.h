@@ -0,0 +1,103 @@
+#ifndef Magnum_Trade_DdsHeader_h
+#define Magnum_Trade_DdsHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+/* DDS file header including the magic, all values are little-endian. See
+   https://docs.microsoft.com/en-us/windows/desktop/direct3ddds/dds-header */
+struct DdsHeader {
+    char magic[4];
+    UnsignedInt size;
+    UnsignedInt flags;
+    UnsignedInt height;
+    UnsignedInt width;
+    UnsignedInt pitchOrLinearSize;
+    UnsignedInt depth;
+    UnsignedInt mipMapCount;
+    UnsignedInt reserved1[11];
+    struct {
+        UnsignedInt size;
+        UnsignedInt flags;
+        char fourCC[4];
+        UnsignedInt rgbBitCount;
+        UnsignedInt rBitMask;
+        UnsignedInt gBitMask;
+        UnsignedInt bBitMask;
+        UnsignedInt aBitMask;
+    } pixelFormat;
+    UnsignedInt caps;
+    UnsignedInt caps2;
+    UnsignedInt caps3;
+    UnsignedInt caps4;
+    UnsignedInt reserved2;
+};
+
+static_assert(sizeof(DdsHeader) == 128, "Improper size of DDS header struct");
+
+/* Extended header following the main one if the FourCC is DX10. See
+   https://docs.microsoft.com/en-us/windows/desktop/direct3ddds/dds-header-dxt10 */
+struct DdsHeaderDxt10 {
+    UnsignedInt dxgiFormat;
+    UnsignedInt resourceDimension;
+    UnsignedInt miscFlag;
+    UnsignedInt arraySize;
+    UnsignedInt miscFlags2;
+};
+
+static_assert(sizeof(DdsHeaderDxt10) == 20, "Improper size of DDS DX10 header struct");
+
+enum: UnsignedInt {
+    DdsFlagCaps = 0x1,
+    DdsFlagHeight = 0x2,
+    DdsFlagWidth = 0x4,
+    DdsFlagPixelFormat = 0x1000,
+    DdsFlagMipMapCount = 0x20000,
+    DdsFlagLinearSize = 0x80000,
+
+    DdsPixelFormatFlagAlphaPixels = 0x1,
+    DdsPixelFormatFlagFourCC = 0x4,
+    DdsPixelFormatFlagRgb = 0x40,
+    DdsPixelFormatFlagLuminance = 0x20000,
+
+    DdsCapsComplex = 0x8,
+    DdsCapsTexture = 0x1000,
+    DdsCapsMipMap = 0x400000,
+
+    DdsCaps2CubeMap = 0x200,
+    DdsCaps2CubeMapAllFaces = 0xfc00,
+    DdsCaps2Volume = 0x200000,
+
+    DdsDxt10ResourceDimensionTexture2D = 3,
+    DdsDxt10MiscFlagTextureCube = 0x4
+};
+
+}}}
+
+#endif
@@ -0,0 +1,369 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "DdsImporter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/PixelConversion.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MapFile.h"
+#include "MagnumPlugins/DdsImporter/DdsHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+/* Only the DXGI formats that have a generic pixel format equivalent. See
+   https://docs.microsoft.com/en-us/windows/desktop/api/dxgiformat/ne-dxgiformat-dxgi_format */
+enum: UnsignedInt {
+    DxgiFormatR32G32B32A32Float = 2,
+    DxgiFormatR16G16B16A16Float = 10,
+    DxgiFormatR8G8B8A8Unorm = 28,
+    DxgiFormatR8G8Unorm = 49,
+    DxgiFormatR8Unorm = 61,
+    DxgiFormatBc1Unorm = 71,
+    DxgiFormatBc2Unorm = 74,
+    DxgiFormatBc3Unorm = 77
+};
+
+struct Image {
+    Vector2i size;
+    std::size_t offset, dataSize;
+};
+
+/* Multiplies two sizes, returns false on overflow */
+bool multiplySize(const std::size_t a, const std::size_t b, std::size_t& out) {
+    if(a && b > std::numeric_limits<std::size_t>::max()/a) return false;
+    out = a*b;
+    return true;
+}
+
+/* Data size of one image, returns false on overflow. The size comes straight
+   from the file, so it's calculated in std::size_t instead of Int. Compressed
+   formats have the pixel size equal to size of a 4x4 block. */
+bool imageDataSize(const Vector2i& size, const bool compressed, const std::size_t pixelSize, std::size_t& out) {
+    std::size_t width = size.x(), height = size.y();
+    if(compressed) {
+        width = (width + 3)/4;
+        height = (height + 3)/4;
+    }
+    std::size_t pixelCount;
+    return multiplySize(width, height, pixelCount) && multiplySize(pixelCount, pixelSize, out);
+}
+
+}
+
+struct DdsImporter::File {
+    Containers::Array<char> data;
+    /* Non-empty if opened from a file, used to map the images directly */
+    std::string filename;
+
+    bool compressed;
+    PixelFormat format;
+    CompressedPixelFormat compressedFormat;
+    /* Pixel size for uncompressed formats, block size for compressed */
+    UnsignedInt pixelSize;
+    bool swizzle;
+
+    Containers::Array<Image> images;
+};
+
+DdsImporter::DdsImporter() = default;
+
+DdsImporter::DdsImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
+
+DdsImporter::~DdsImporter() = default;
+
+auto DdsImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::ThreadSafeDataAccess; }
+
+bool DdsImporter::doIsOpened() const { return !!_file; }
+
+void DdsImporter::doClose() {
+    _file = nullptr;
+    _levelCount = _faceCount = _layerCount = 0;
+}
+
+void DdsImporter::doOpenData(const Containers::ArrayView<const char> data) {
+    Containers::Array<char> copy{data.size()};
+    std::copy(data.begin(), data.end(), copy.begin());
+    parse(std::move(copy), {}, "openData");
+}
+
+void DdsImporter::doOpenFile(const std::string& filename) {
+    Containers::Optional<Containers::Array<char>> data = mapFile(filename);
+    if(!data) {
+        Error() << "Trade::DdsImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    parse(std::move(*data), filename, "openFile");
+}
+
+void DdsImporter::parse(Containers::Array<char>&& data, const std::string& filename, const char* const function) {
+    if(data.size() < sizeof(Implementation::DdsHeader)) {
+        Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): the file is too short:" << data.size() << "bytes";
+        return;
+    }
+
+    const Implementation::DdsHeader& header = *reinterpret_cast<const Implementation::DdsHeader*>(data.data());
+    if(std::memcmp(header.magic, "DDS ", 4) != 0) {
+        Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): invalid file signature";
+        return;
+    }
+
+    std::unique_ptr<File> file{new File};
+    file->compressed = false;
+    file->format = {};
+    file->compressedFormat = {};
+    file->pixelSize = 0;
+    file->swizzle = false;
+    UnsignedInt faceCount = 1, layerCount = 1;
+
+    const UnsignedInt flags = Utility::Endianness::littleEndian(header.flags);
+    const UnsignedInt caps2 = Utility::Endianness::littleEndian(header.caps2);
+    const Vector2i size{Int(Utility::Endianness::littleEndian(header.width)),
+                        Int(Utility::Endianness::littleEndian(header.height))};
+    if(size.x() <= 0 || size.y() <= 0) {
+        Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): invalid image size" << size;
+        return;
+    }
+
+    if(caps2 & Implementation::DdsCaps2Volume) {
+        Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): volume textures are not supported";
+        return;
+    }
+
+    if(caps2 & Implementation::DdsCaps2CubeMap) {
+        if((caps2 & Implementation::DdsCaps2CubeMapAllFaces) != Implementation::DdsCaps2CubeMapAllFaces) {
+            Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): partial cube maps are not supported";
+            return;
+        }
+        faceCount = 6;
+    }
+
+    /* The mip count is zero or garbage if the flag is not set. A chain
+       longer than down to 1x1 is invalid. */
+    const UnsignedInt levelCount = flags & Implementation::DdsFlagMipMapCount ? Math::max(Utility::Endianness::littleEndian(header.mipMapCount), 1u) : 1;
+    const UnsignedInt maxLevelCount = Math::log2(UnsignedInt(size.max())) + 1;
+    if(levelCount > maxLevelCount) {
+        Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): expected at most" << maxLevelCount << "mip levels for a" << size << "image but got" << levelCount;
+        return;
+    }
+
+    /* Pixel format */
+    std::size_t offset = sizeof(Implementation::DdsHeader);
+    const UnsignedInt pixelFormatFlags = Utility::Endianness::littleEndian(header.pixelFormat.flags);
+    if(pixelFormatFlags & Implementation::DdsPixelFormatFlagFourCC) {
+        const char* const fourCC = header.pixelFormat.fourCC;
+        file->compressed = true;
+        if(std::memcmp(fourCC, "DXT1", 4) == 0) {
+            file->compressedFormat = pixelFormatFlags & Implementation::DdsPixelFormatFlagAlphaPixels ? CompressedPixelFormat::Bc1RGBAUnorm : CompressedPixelFormat::Bc1RGBUnorm;
+            file->pixelSize = 8;
+        } else if(std::memcmp(fourCC, "DXT2", 4) == 0 || std::memcmp(fourCC, "DXT3", 4) == 0) {
+            file->compressedFormat = CompressedPixelFormat::Bc2RGBAUnorm;
+            file->pixelSize = 16;
+        } else if(std::memcmp(fourCC, "DXT4", 4) == 0 || std::memcmp(fourCC, "DXT5", 4) == 0) {
+            file->compressedFormat = CompressedPixelFormat::Bc3RGBAUnorm;
+            file->pixelSize = 16;
+
+        /* Extended header */
+        } else if(std::memcmp(fourCC, "DX10", 4) == 0) {
+            if(data.size() < sizeof(Implementation::DdsHeader) + sizeof(Implementation::DdsHeaderDxt10)) {
+                Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): the file is too short for the DX10 header:" << data.size() << "bytes";
+                return;
+            }
+
+            const Implementation::DdsHeaderDxt10& dxt10 = *reinterpret_cast<const Implementation::DdsHeaderDxt10*>(data.data() + sizeof(Implementation::DdsHeader));
+            offset += sizeof(Implementation::DdsHeaderDxt10);
+
+            const UnsignedInt resourceDimension = Utility::Endianness::littleEndian(dxt10.resourceDimension);
+            if(resourceDimension != Implementation::DdsDxt10ResourceDimensionTexture2D) {
+                Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): unsupported resource dimension" << resourceDimension;
+                return;
+            }
+
+            if(Utility::Endianness::littleEndian(dxt10.miscFlag) & Implementation::DdsDxt10MiscFlagTextureCube)
+                faceCount = 6;
+            layerCount = Math::max(Utility::Endianness::littleEndian(dxt10.arraySize), 1u);
+
+            const UnsignedInt dxgiFormat = Utility::Endianness::littleEndian(dxt10.dxgiFormat);
+            switch(dxgiFormat) {
+                case DxgiFormatBc1Unorm:
+                    file->compressedFormat = CompressedPixelFormat::Bc1RGBAUnorm;
+                    file->pixelSize = 8;
+                    break;
+                case DxgiFormatBc2Unorm:
+                    file->compressedFormat = CompressedPixelFormat::Bc2RGBAUnorm;
+                    file->pixelSize = 16;
+                    break;
+                case DxgiFormatBc3Unorm:
+                    file->compressedFormat = CompressedPixelFormat::Bc3RGBAUnorm;
+                    file->pixelSize = 16;
+                    break;
+                case DxgiFormatR8Unorm:
+                    file->compressed = false;
+                    file->format = PixelFormat::R8Unorm;
+                    file->pixelSize = 1;
+                    break;
+                case DxgiFormatR8G8Unorm:
+                    file->compressed = false;
+                    file->format = PixelFormat::RG8Unorm;
+                    file->pixelSize = 2;
+                    break;
+                case DxgiFormatR8G8B8A8Unorm:
+                    file->compressed = false;
+                    file->format = PixelFormat::RGBA8Unorm;
+                    file->pixelSize = 4;
+                    break;
+                case DxgiFormatR16G16B16A16Float:
+                    file->compressed = false;
+                    file->format = PixelFormat::RGBA16F;
+                    file->pixelSize = 8;
+                    break;
+                case DxgiFormatR32G32B32A32Float:
+                    file->compressed = false;
+                    file->format = PixelFormat::RGBA32F;
+                    file->pixelSize = 16;
+                    break;
+                default:
+                    Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): unsupported DXGI format" << dxgiFormat;
+                    return;
+            }
+
+        } else {
+            Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): unsupported FourCC" << std::string{fourCC, 4};
+            return;
+        }
+
+    /* Uncompressed formats, identified by the channel masks */
+    } else {
+        const UnsignedInt bitCount = Utility::Endianness::littleEndian(header.pixelFormat.rgbBitCount);
+        const UnsignedInt r = Utility::Endianness::littleEndian(header.pixelFormat.rBitMask);
+        const UnsignedInt g = Utility::Endianness::littleEndian(header.pixelFormat.gBitMask);
+        const UnsignedInt b = Utility::Endianness::littleEndian(header.pixelFormat.bBitMask);
+        const UnsignedInt a = Utility::Endianness::littleEndian(header.pixelFormat.aBitMask);
+        if((pixelFormatFlags & Implementation::DdsPixelFormatFlagRgb) && bitCount == 32 && g == 0x0000ff00 && a == 0xff000000 && ((r == 0x000000ff && b == 0x00ff0000) || (r == 0x00ff0000 && b == 0x000000ff))) {
+            file->format = PixelFormat::RGBA8Unorm;
+            file->pixelSize = 4;
+            file->swizzle = r == 0x00ff0000;
+        } else if((pixelFormatFlags & Implementation::DdsPixelFormatFlagLuminance) && bitCount == 8 && r == 0xff) {
+            file->format = PixelFormat::R8Unorm;
+            file->pixelSize = 1;
+        } else {
+            Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): unsupported uncompressed format with" << bitCount << "bits per pixel";
+            return;
+        }
+    }
+
+    /* Size of all levels of one face, checked for overflow. The layer and
+       face count is then checked against the actual data size before
+       allocating anything, so a garbage header can't make the importer
+       allocate or index past the file. */
+    std::size_t levelDataSizes[32];
+    std::size_t faceDataSize = 0;
+    bool overflow = false;
+    for(UnsignedInt level = 0; level != levelCount && !overflow; ++level) {
+        const Vector2i levelSize = Math::max(size >> Int(level), Vector2i{1});
+        overflow = !imageDataSize(levelSize, file->compressed, file->pixelSize, levelDataSizes[level]) || levelDataSizes[level] > std::numeric_limits<std::size_t>::max() - faceDataSize;
+        if(!overflow) faceDataSize += levelDataSizes[level];
+    }
+
+    std::size_t imageCount{}, dataSize{};
+    if(overflow || !multiplySize(layerCount, faceCount, imageCount) || !multiplySize(imageCount, faceDataSize, dataSize) || dataSize > std::numeric_limits<std::size_t>::max() - offset) {
+        Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): data size of" << layerCount << "layers and" << faceCount << "faces of a" << size << "image is too large";
+        return;
+    }
+
+    if(data.size() < offset + dataSize) {
+        Error() << "Trade::DdsImporter::" << Debug::nospace << function << Debug::nospace << "(): the file is too short, expected" << offset + dataSize << "bytes but got" << data.size();
+        return;
+    }
+
+    /* Calculate image locations, all levels of a face are next to each
+       other */
+    file->images = Containers::Array<Image>{imageCount*levelCount};
+    for(std::size_t i = 0; i != file->images.size(); ++i) {
+        const UnsignedInt level = i % levelCount;
+        file->images[i] = Image{Math::max(size >> Int(level), Vector2i{1}), offset, levelDataSizes[level]};
+        offset += levelDataSizes[level];
+    }
+
+    file->data = std::move(data);
+    file->filename = filename;
+    _levelCount = levelCount;
+    _faceCount = faceCount;
+    _layerCount = layerCount;
+    _file = std::move(file);
+}
+
+UnsignedInt DdsImporter::doImage2DCount() const { return _file->images.size(); }
+
+Containers::Optional<ImageData2D> DdsImporter::doImage2D(const UnsignedInt id) {
+    const Image& image = _file->images[id];
+
+    /* If opened from a file, map exactly the image data so they can be
+       uploaded without a copy. Otherwise copy them. */
+    Containers::Array<char> data;
+    if(!_file->filename.empty()) {
+        Containers::Optional<Containers::Array<char>> mapped = mapFile(_file->filename, image.offset, image.dataSize);
+        if(mapped) data = std::move(*mapped);
+    }
+    if(!data) {
+        data = Containers::Array<char>{image.dataSize};
+        std::copy_n(_file->data + image.offset, image.dataSize, data.begin());
+    }
+
+    if(_file->compressed)
+        return ImageData2D{_file->compressedFormat, image.size, std::move(data)};
+
+    /* BGRA to RGBA, the mapping is copy-on-write so it doesn't affect the
+       file or other imported images */
+    if(_file->swizzle)
+        swapRedBlue(Containers::ArrayView<Color4ub>{reinterpret_cast<Color4ub*>(data.data()), std::size_t(image.size.product())});
+
+    /* Adjust pixel storage if row size is not four byte aligned */
+    PixelStorage storage;
+    if((image.size.x()*_file->pixelSize)%4 != 0)
+        storage.setAlignment(1);
+
+    return ImageData2D{storage, _file->format, image.size, std::move(data)};
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(DdsImporter, Magnum::Trade::DdsImporter,
+    "cz.mosra.magnum.Trade.AbstractImporter/0.3")
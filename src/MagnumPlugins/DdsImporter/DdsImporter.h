@@ -0,0 +1,205 @@
+#ifndef Magnum_Trade_DdsImporter_h
+#define Magnum_Trade_DdsImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::Trade::DdsImporter
+ */
+
+#include <memory>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/VisibilityMacros.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/DdsImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_DDSIMPORTER_BUILD_STATIC
+    #ifdef DdsImporter_EXPORTS
+        #define MAGNUM_DDSIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_DDSIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_DDSIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_DDSIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_DDSIMPORTER_EXPORT
+#define MAGNUM_DDSIMPORTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief DDS importer plugin
+
+Imports DirectDraw Surface (`*.dds`) files including all mip levels, cube map
+faces and array layers, such as files produced by
+@ref DdsImageConverter "DdsImageConverter".
+
+This plugin depends on the @ref Trade library and is built if
+`WITH_DDSIMPORTER` is enabled when building Magnum. To use as a dynamic
+plugin, you need to load the @cpp "DdsImporter" @ce plugin from
+`MAGNUM_PLUGINS_IMPORTER_DIR`. To use as a static plugin or as a dependency of
+another plugin with CMake, you need to request the `DdsImporter` component of
+the `Magnum` package and link to the `Magnum::DdsImporter` target. See
+@ref building, @ref cmake and @ref plugins for more information.
+
+@section Trade-DdsImporter-formats Supported formats
+
+-   `DXT1` files are imported as @ref CompressedPixelFormat::Bc1RGBUnorm, or
+    @ref CompressedPixelFormat::Bc1RGBAUnorm if the pixel format has the
+    alpha flag set
+-   `DXT2` and `DXT3` files are imported as
+    @ref CompressedPixelFormat::Bc2RGBAUnorm
+-   `DXT4` and `DXT5` files are imported as
+    @ref CompressedPixelFormat::Bc3RGBAUnorm
+-   Uncompressed 32-bit RGBA and BGRA files are imported as
+    @ref PixelFormat::RGBA8Unorm, with BGRA swizzled to RGBA
+-   Uncompressed 8-bit luminance files are imported as
+    @ref PixelFormat::R8Unorm
+-   Files with the `DX10` extended header are supported for the
+    `DXGI_FORMAT_BC1_UNORM`, `DXGI_FORMAT_BC2_UNORM`, `DXGI_FORMAT_BC3_UNORM`,
+    `DXGI_FORMAT_R8G8B8A8_UNORM`, `DXGI_FORMAT_R8G8_UNORM`,
+    `DXGI_FORMAT_R8_UNORM`, `DXGI_FORMAT_R16G16B16A16_FLOAT` and
+    `DXGI_FORMAT_R32G32B32A32_FLOAT` formats, imported as the corresponding
+    @ref CompressedPixelFormat or @ref PixelFormat
+
+Volume textures, partial cube maps and other compressed formats are not
+supported. The data are imported as-is, without flipping the rows, so the
+first row in the file is the first row in the image. This is the same
+convention as used by @ref DdsImageConverter "DdsImageConverter".
+
+@section Trade-DdsImporter-images Image layout
+
+Each mip level of each cube map face and array layer is a separate 2D image
+in the same order as in the file --- all levels of the first face of the
+first layer, then all levels of the second face and so on. The counts are
+available through @ref levelCount(), @ref faceCount() and @ref layerCount(),
+@ref image2DId() gives the image ID for a particular combination. Faces are
+in the order +X, -X, +Y, -Y, +Z, -Z, which is the same order as
+@ref GL::CubeMapCoordinate uses. Since the compressed images are exactly the
+block data from the file, they can be uploaded to a GPU texture without any
+decoding:
+
+@code{.cpp}
+auto& dds = static_cast<Trade::DdsImporter&>(*importer);
+dds.openFile("sky.dds");
+
+Containers::Optional<Trade::ImageData2D> base = importer->image2D(0);
+GL::CubeMapTexture texture;
+texture.setStorage(dds.levelCount(),
+    GL::TextureFormat::CompressedRGBAS3tcDxt5, base->size());
+for(UnsignedInt face = 0; face != dds.faceCount(); ++face) {
+    for(UnsignedInt level = 0; level != dds.levelCount(); ++level) {
+        Containers::Optional<Trade::ImageData2D> image =
+            importer->image2D(dds.image2DId(0, face, level));
+        texture.setCompressedSubImage(GL::CubeMapCoordinate(
+            UnsignedInt(GL::CubeMapCoordinate::PositiveX) + face),
+            level, {}, *image);
+    }
+}
+@endcode
+
+Files opened with @ref openFile() are memory-mapped using @ref mapFile() and
+on Unix systems each image returned from @ref image2D() is a copy-on-write
+mapping of exactly its part of the file instead of a copy. The pages are
+read from disk only once the data are accessed, for example by the GPU
+upload. BGRA images are swizzled in-place on the mapped memory, which
+doesn't affect the file. Data passed to @ref openData() are always copied.
+Importing the images doesn't modify any importer state, so they can be
+imported concurrently using @ref Trade::image2DAsync().
+*/
+class MAGNUM_DDSIMPORTER_EXPORT DdsImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit DdsImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit DdsImporter(PluginManager::AbstractManager& manager, const std::string& plugin);
+
+        ~DdsImporter();
+
+        /**
+         * @brief Mip level count
+         *
+         * Returns @cpp 0 @ce if no file is opened.
+         */
+        UnsignedInt levelCount() const { return _levelCount; }
+
+        /**
+         * @brief Cube map face count
+         *
+         * @cpp 6 @ce for cube maps, @cpp 1 @ce otherwise. Returns @cpp 0 @ce
+         * if no file is opened.
+         */
+        UnsignedInt faceCount() const { return _faceCount; }
+
+        /**
+         * @brief Array layer count
+         *
+         * @cpp 1 @ce for files that are not arrays. Returns @cpp 0 @ce if no
+         * file is opened.
+         */
+        UnsignedInt layerCount() const { return _layerCount; }
+
+        /**
+         * @brief 2D image ID for given layer, face and mip level
+         *
+         * Expects that the parameters are less than @ref layerCount(),
+         * @ref faceCount() and @ref levelCount(). See
+         * @ref Trade-DdsImporter-images for more information.
+         */
+        UnsignedInt image2DId(UnsignedInt layer, UnsignedInt face, UnsignedInt level) const {
+            CORRADE_ASSERT(layer < _layerCount && face < _faceCount && level < _levelCount,
+                "Trade::DdsImporter::image2DId(): layer" << layer << Debug::nospace << ", face" << face << "and level" << level << "out of bounds for" << _layerCount << "layers," << _faceCount << "faces and" << _levelCount << "levels", {});
+            return (layer*_faceCount + face)*_levelCount + level;
+        }
+
+    private:
+        struct MAGNUM_DDSIMPORTER_LOCAL File;
+
+        Features MAGNUM_DDSIMPORTER_LOCAL doFeatures() const override;
+        bool MAGNUM_DDSIMPORTER_LOCAL doIsOpened() const override;
+        void MAGNUM_DDSIMPORTER_LOCAL doOpenData(Containers::ArrayView<const char> data) override;
+        void MAGNUM_DDSIMPORTER_LOCAL doOpenFile(const std::string& filename) override;
+        void MAGNUM_DDSIMPORTER_LOCAL doClose() override;
+        UnsignedInt MAGNUM_DDSIMPORTER_LOCAL doImage2DCount() const override;
+        Containers::Optional<ImageData2D> MAGNUM_DDSIMPORTER_LOCAL doImage2D(UnsignedInt id) override;
+
+        void MAGNUM_DDSIMPORTER_LOCAL parse(Containers::Array<char>&& data, const std::string& filename, const char* function);
+
+        std::unique_ptr<File> _file;
+        UnsignedInt _levelCount{}, _faceCount{}, _layerCount{};
+};
+
+}}
+
+#endif
@@ -0,0 +1,579 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/DdsImporter/DdsHeader.h"
+#include "MagnumPlugins/DdsImporter/DdsImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct DdsImporterTest: TestSuite::Tester {
+    explicit DdsImporterTest();
+
+    void openShort();
+    void invalidSignature();
+    void invalidSize();
+    void volume();
+    void partialCubeMap();
+    void tooManyLevels();
+    void unsupportedFourCC();
+    void unsupportedUncompressed();
+    void unsupportedDxgiFormat();
+    void unsupportedResourceDimension();
+    void dataTooShort();
+    void dataTooShortHugeArraySize();
+    void dataSizeTooLarge();
+
+    void dxt1();
+    void dxt1Alpha();
+    void dxt3();
+    void dxt5();
+    void rgba();
+    void bgra();
+    void luminance();
+    void cubeMap();
+    void dx10Array();
+    void dx10CubeMap();
+
+    void image2DIdOutOfBounds();
+
+    void openFile();
+    void openFileBgra();
+    void openFileNotFound();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+DdsImporterTest::DdsImporterTest() {
+    addTests({&DdsImporterTest::openShort,
+              &DdsImporterTest::invalidSignature,
+              &DdsImporterTest::invalidSize,
+              &DdsImporterTest::volume,
+              &DdsImporterTest::partialCubeMap,
+              &DdsImporterTest::tooManyLevels,
+              &DdsImporterTest::unsupportedFourCC,
+              &DdsImporterTest::unsupportedUncompressed,
+              &DdsImporterTest::unsupportedDxgiFormat,
+              &DdsImporterTest::unsupportedResourceDimension,
+              &DdsImporterTest::dataTooShort,
+              &DdsImporterTest::dataTooShortHugeArraySize,
+              &DdsImporterTest::dataSizeTooLarge,
+
+              &DdsImporterTest::dxt1,
+              &DdsImporterTest::dxt1Alpha,
+              &DdsImporterTest::dxt3,
+              &DdsImporterTest::dxt5,
+              &DdsImporterTest::rgba,
+              &DdsImporterTest::bgra,
+              &DdsImporterTest::luminance,
+              &DdsImporterTest::cubeMap,
+              &DdsImporterTest::dx10Array,
+              &DdsImporterTest::dx10CubeMap,
+
+              &DdsImporterTest::image2DIdOutOfBounds,
+
+              &DdsImporterTest::openFile,
+              &DdsImporterTest::openFileBgra,
+              &DdsImporterTest::openFileNotFound});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef DDSIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(DDSIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    Utility::Directory::mkpath(DDSIMPORTER_WRITE_DIR);
+}
+
+namespace {
+
+Implementation::DdsHeader header(const Vector2i& size, const UnsignedInt levelCount) {
+    Implementation::DdsHeader out{};
+    std::memcpy(out.magic, "DDS ", 4);
+    out.size = Utility::Endianness::littleEndian(UnsignedInt(sizeof(Implementation::DdsHeader) - 4));
+    out.flags = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsFlagCaps|Implementation::DdsFlagHeight|Implementation::DdsFlagWidth|Implementation::DdsFlagPixelFormat|(levelCount > 1 ? Implementation::DdsFlagMipMapCount : 0)));
+    out.height = Utility::Endianness::littleEndian(UnsignedInt(size.y()));
+    out.width = Utility::Endianness::littleEndian(UnsignedInt(size.x()));
+    out.mipMapCount = Utility::Endianness::littleEndian(levelCount);
+    out.pixelFormat.size = Utility::Endianness::littleEndian(UnsignedInt(sizeof(out.pixelFormat)));
+    out.caps = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsCapsTexture));
+    return out;
+}
+
+Implementation::DdsHeader compressedHeader(const Vector2i& size, const UnsignedInt levelCount, const char* fourCC) {
+    Implementation::DdsHeader out = header(size, levelCount);
+    out.pixelFormat.flags = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsPixelFormatFlagFourCC));
+    std::memcpy(out.pixelFormat.fourCC, fourCC, 4);
+    return out;
+}
+
+Implementation::DdsHeader uncompressedHeader(const Vector2i& size, const UnsignedInt flags, const UnsignedInt bitCount, const UnsignedInt r, const UnsignedInt g, const UnsignedInt b, const UnsignedInt a) {
+    Implementation::DdsHeader out = header(size, 1);
+    out.pixelFormat.flags = Utility::Endianness::littleEndian(flags);
+    out.pixelFormat.rgbBitCount = Utility::Endianness::littleEndian(bitCount);
+    out.pixelFormat.rBitMask = Utility::Endianness::littleEndian(r);
+    out.pixelFormat.gBitMask = Utility::Endianness::littleEndian(g);
+    out.pixelFormat.bBitMask = Utility::Endianness::littleEndian(b);
+    out.pixelFormat.aBitMask = Utility::Endianness::littleEndian(a);
+    return out;
+}
+
+Implementation::DdsHeaderDxt10 dxt10Header(const UnsignedInt dxgiFormat, const UnsignedInt miscFlag, const UnsignedInt arraySize) {
+    Implementation::DdsHeaderDxt10 out{};
+    out.dxgiFormat = Utility::Endianness::littleEndian(dxgiFormat);
+    out.resourceDimension = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsDxt10ResourceDimensionTexture2D));
+    out.miscFlag = Utility::Endianness::littleEndian(miscFlag);
+    out.arraySize = Utility::Endianness::littleEndian(arraySize);
+    return out;
+}
+
+/* Header followed by the optional DX10 header and dataSize bytes of a
+   recognizable pattern */
+Containers::Array<char> file(const Implementation::DdsHeader& header, const std::size_t dataSize, const Implementation::DdsHeaderDxt10* dxt10 = nullptr) {
+    const std::size_t headerSize = sizeof(Implementation::DdsHeader) + (dxt10 ? sizeof(Implementation::DdsHeaderDxt10) : 0);
+    Containers::Array<char> out{headerSize + dataSize};
+    std::memcpy(out.data(), &header, sizeof(Implementation::DdsHeader));
+    if(dxt10) std::memcpy(out.data() + sizeof(Implementation::DdsHeader), dxt10, sizeof(Implementation::DdsHeaderDxt10));
+    for(std::size_t i = 0; i != dataSize; ++i)
+        out[headerSize + i] = char(i*37 % 251);
+    return out;
+}
+
+}
+
+void DdsImporterTest::openShort() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData({"DDS ", 4}));
+    CORRADE_VERIFY(!importer->isOpened());
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): the file is too short: 4 bytes\n");
+}
+
+void DdsImporterTest::invalidSignature() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Implementation::DdsHeader h = compressedHeader({4, 4}, 1, "DXT1");
+    std::memcpy(h.magic, "DDZ ", 4);
+    Containers::Array<char> data = file(h, 8);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): invalid file signature\n");
+}
+
+void DdsImporterTest::invalidSize() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(compressedHeader({0, 4}, 1, "DXT1"), 8);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): invalid image size Vector(0, 4)\n");
+}
+
+void DdsImporterTest::volume() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Implementation::DdsHeader h = compressedHeader({4, 4}, 1, "DXT1");
+    h.caps2 = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsCaps2Volume));
+    Containers::Array<char> data = file(h, 8);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): volume textures are not supported\n");
+}
+
+void DdsImporterTest::partialCubeMap() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Implementation::DdsHeader h = compressedHeader({4, 4}, 1, "DXT1");
+    /* Only +X */
+    h.caps2 = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsCaps2CubeMap|0x400));
+    Containers::Array<char> data = file(h, 8);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): partial cube maps are not supported\n");
+}
+
+void DdsImporterTest::tooManyLevels() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(compressedHeader({4, 2}, 4, "DXT1"), 32);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): expected at most 3 mip levels for a Vector(4, 2) image but got 4\n");
+}
+
+void DdsImporterTest::unsupportedFourCC() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(compressedHeader({4, 4}, 1, "ATI1"), 8);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): unsupported FourCC ATI1\n");
+}
+
+void DdsImporterTest::unsupportedUncompressed() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(uncompressedHeader({1, 1}, Implementation::DdsPixelFormatFlagRgb, 24, 0xff0000, 0xff00, 0xff, 0), 3);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): unsupported uncompressed format with 24 bits per pixel\n");
+}
+
+void DdsImporterTest::unsupportedDxgiFormat() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    /* DXGI_FORMAT_BC7_UNORM */
+    const Implementation::DdsHeaderDxt10 dxt10 = dxt10Header(98, 0, 1);
+    Containers::Array<char> data = file(compressedHeader({4, 4}, 1, "DX10"), 16, &dxt10);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): unsupported DXGI format 98\n");
+}
+
+void DdsImporterTest::unsupportedResourceDimension() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Implementation::DdsHeaderDxt10 dxt10 = dxt10Header(28, 0, 1);
+    /* 3D texture */
+    dxt10.resourceDimension = Utility::Endianness::littleEndian(4u);
+    Containers::Array<char> data = file(compressedHeader({1, 1}, 1, "DX10"), 4, &dxt10);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): unsupported resource dimension 4\n");
+}
+
+void DdsImporterTest::dataTooShort() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    /* 8x4, 4x2 and 2x1 take 16 + 8 + 8 bytes */
+    Containers::Array<char> data = file(compressedHeader({8, 4}, 3, "DXT1"), 31);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): the file is too short, expected 160 bytes but got 159\n");
+}
+
+void DdsImporterTest::dataTooShortHugeArraySize() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    /* DXGI_FORMAT_R8_UNORM, the array size is checked against the actual
+       data before anything gets allocated for the images */
+    const Implementation::DdsHeaderDxt10 dxt10 = dxt10Header(61, 0, 0x7fffffff);
+    Containers::Array<char> data = file(compressedHeader({1, 1}, 1, "DX10"), 1, &dxt10);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): the file is too short, expected 2147483795 bytes but got 149\n");
+}
+
+void DdsImporterTest::dataSizeTooLarge() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    /* DXGI_FORMAT_R32G32B32A32_FLOAT, the size of a single image doesn't fit
+       into 64 bits */
+    const Implementation::DdsHeaderDxt10 dxt10 = dxt10Header(2, 0, 1);
+    Containers::Array<char> data = file(compressedHeader({0x7fffffff, 0x7fffffff}, 1, "DX10"), 16, &dxt10);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): data size of 1 layers and 1 faces of a Vector(2147483647, 2147483647) image is too large\n");
+}
+
+void DdsImporterTest::dxt1() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(compressedHeader({8, 4}, 3, "DXT1"), 32);
+    CORRADE_VERIFY(importer->openData(data));
+
+    auto& dds = static_cast<DdsImporter&>(*importer);
+    CORRADE_COMPARE(dds.levelCount(), 3);
+    CORRADE_COMPARE(dds.faceCount(), 1);
+    CORRADE_COMPARE(dds.layerCount(), 1);
+    CORRADE_COMPARE(importer->image2DCount(), 3);
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_VERIFY(image->isCompressed());
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{8, 4}));
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{image->data()},
+        Containers::ArrayView<const char>{data}.slice(128, 144),
+        TestSuite::Compare::Container);
+
+    image = importer->image2D(2);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{image->data()},
+        Containers::ArrayView<const char>{data}.slice(152, 160),
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::dxt1Alpha() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Implementation::DdsHeader h = compressedHeader({4, 4}, 1, "DXT1");
+    h.pixelFormat.flags = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsPixelFormatFlagFourCC|Implementation::DdsPixelFormatFlagAlphaPixels));
+    Containers::Array<char> data = file(h, 8);
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::Bc1RGBAUnorm);
+}
+
+void DdsImporterTest::dxt3() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(compressedHeader({5, 4}, 1, "DXT3"), 32);
+    CORRADE_VERIFY(importer->openData(data));
+
+    /* Sizes not divisible by four take the whole block */
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::Bc2RGBAUnorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{5, 4}));
+    CORRADE_COMPARE(image->data().size(), 32);
+}
+
+void DdsImporterTest::dxt5() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(compressedHeader({4, 4}, 3, "DXT5"), 48);
+    CORRADE_VERIFY(importer->openData(data));
+    CORRADE_COMPARE(importer->image2DCount(), 3);
+
+    Containers::Optional<ImageData2D> image = importer->image2D(1);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::Bc3RGBAUnorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{image->data()},
+        Containers::ArrayView<const char>{data}.slice(144, 160),
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::rgba() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(uncompressedHeader({2, 1}, Implementation::DdsPixelFormatFlagRgb|Implementation::DdsPixelFormatFlagAlphaPixels, 32, 0xff, 0xff00, 0xff0000, 0xff000000), 8);
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_VERIFY(!image->isCompressed());
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{image->data()},
+        Containers::ArrayView<const char>{data}.suffix(128),
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::bgra() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(uncompressedHeader({2, 1}, Implementation::DdsPixelFormatFlagRgb|Implementation::DdsPixelFormatFlagAlphaPixels, 32, 0xff0000, 0xff00, 0xff, 0xff000000), 8);
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+
+    const Color4ub* pixels = reinterpret_cast<const Color4ub*>(image->data().data());
+    const Color4ub* input = reinterpret_cast<const Color4ub*>(data.data() + 128);
+    CORRADE_COMPARE(pixels[0], (Color4ub{input[0].b(), input[0].g(), input[0].r(), input[0].a()}));
+    CORRADE_COMPARE(pixels[1], (Color4ub{input[1].b(), input[1].g(), input[1].r(), input[1].a()}));
+}
+
+void DdsImporterTest::luminance() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(uncompressedHeader({3, 2}, Implementation::DdsPixelFormatFlagLuminance, 8, 0xff, 0, 0, 0), 6);
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    CORRADE_COMPARE(image->size(), (Vector2i{3, 2}));
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{image->data()},
+        Containers::ArrayView<const char>{data}.suffix(128),
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::cubeMap() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Implementation::DdsHeader h = compressedHeader({4, 4}, 3, "DXT5");
+    h.caps2 = Utility::Endianness::littleEndian(UnsignedInt(Implementation::DdsCaps2CubeMap|Implementation::DdsCaps2CubeMapAllFaces));
+    /* 6 faces, 3 levels each taking a single 16-byte block */
+    Containers::Array<char> data = file(h, 6*3*16);
+    CORRADE_VERIFY(importer->openData(data));
+
+    auto& dds = static_cast<DdsImporter&>(*importer);
+    CORRADE_COMPARE(dds.levelCount(), 3);
+    CORRADE_COMPARE(dds.faceCount(), 6);
+    CORRADE_COMPARE(dds.layerCount(), 1);
+    CORRADE_COMPARE(importer->image2DCount(), 18);
+    CORRADE_COMPARE(dds.image2DId(0, 5, 2), 17);
+    CORRADE_COMPARE(dds.image2DId(0, 2, 1), 7);
+
+    /* -Y face, second level */
+    Containers::Optional<ImageData2D> image = importer->image2D(dds.image2DId(0, 3, 1));
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{image->data()},
+        Containers::ArrayView<const char>{data}.slice(128 + 10*16, 128 + 11*16),
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::dx10Array() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    /* DXGI_FORMAT_R16G16B16A16_FLOAT */
+    const Implementation::DdsHeaderDxt10 dxt10 = dxt10Header(10, 0, 3);
+    /* 3 layers, 2x1 and 1x1 levels */
+    Containers::Array<char> data = file(compressedHeader({2, 1}, 2, "DX10"), 3*(2 + 1)*8, &dxt10);
+    CORRADE_VERIFY(importer->openData(data));
+
+    auto& dds = static_cast<DdsImporter&>(*importer);
+    CORRADE_COMPARE(dds.levelCount(), 2);
+    CORRADE_COMPARE(dds.faceCount(), 1);
+    CORRADE_COMPARE(dds.layerCount(), 3);
+    CORRADE_COMPARE(importer->image2DCount(), 6);
+
+    /* Last layer, base level. Data start after both headers. */
+    Containers::Optional<ImageData2D> image = importer->image2D(dds.image2DId(2, 0, 0));
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA16F);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{image->data()},
+        Containers::ArrayView<const char>{data}.slice(148 + 2*24, 148 + 2*24 + 16),
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::dx10CubeMap() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    /* DXGI_FORMAT_BC3_UNORM */
+    const Implementation::DdsHeaderDxt10 dxt10 = dxt10Header(77, Implementation::DdsDxt10MiscFlagTextureCube, 2);
+    Containers::Array<char> data = file(compressedHeader({4, 4}, 1, "DX10"), 2*6*16, &dxt10);
+    CORRADE_VERIFY(importer->openData(data));
+
+    auto& dds = static_cast<DdsImporter&>(*importer);
+    CORRADE_COMPARE(dds.levelCount(), 1);
+    CORRADE_COMPARE(dds.faceCount(), 6);
+    CORRADE_COMPARE(dds.layerCount(), 2);
+    CORRADE_COMPARE(importer->image2DCount(), 12);
+    CORRADE_COMPARE(dds.image2DId(1, 4, 0), 10);
+
+    Containers::Optional<ImageData2D> image = importer->image2D(10);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::Bc3RGBAUnorm);
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{image->data()},
+        Containers::ArrayView<const char>{data}.slice(148 + 10*16, 148 + 11*16),
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::image2DIdOutOfBounds() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    Containers::Array<char> data = file(compressedHeader({8, 4}, 3, "DXT1"), 32);
+    CORRADE_VERIFY(importer->openData(data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    static_cast<DdsImporter&>(*importer).image2DId(0, 1, 0);
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::image2DId(): layer 0, face 1 and level 0 out of bounds for 1 layers, 1 faces and 3 levels\n");
+}
+
+void DdsImporterTest::openFile() {
+    const Containers::Array<char> data = file(compressedHeader({8, 4}, 3, "DXT1"), 32);
+    const std::string filename = Utility::Directory::join(DDSIMPORTER_WRITE_DIR, "dxt1.dds");
+    CORRADE_VERIFY(Utility::Directory::write(filename, data));
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    CORRADE_VERIFY(importer->openFile(filename));
+    CORRADE_COMPARE(importer->image2DCount(), 3);
+
+    /* The data should have exactly the image size even though they're
+       mapped from the middle of the file */
+    Containers::Optional<ImageData2D> image = importer->image2D(1);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), (Vector2i{4, 2}));
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{image->data()},
+        Containers::ArrayView<const char>{data}.slice(144, 152),
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::openFileBgra() {
+    const Containers::Array<char> data = file(uncompressedHeader({2, 1}, Implementation::DdsPixelFormatFlagRgb|Implementation::DdsPixelFormatFlagAlphaPixels, 32, 0xff0000, 0xff00, 0xff, 0xff000000), 8);
+    const std::string filename = Utility::Directory::join(DDSIMPORTER_WRITE_DIR, "bgra.dds");
+    CORRADE_VERIFY(Utility::Directory::write(filename, data));
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    CORRADE_VERIFY(importer->openFile(filename));
+
+    const Color4ub* input = reinterpret_cast<const Color4ub*>(data.data() + 128);
+    const Color4ub expected{input[1].b(), input[1].g(), input[1].r(), input[1].a()};
+
+    /* Importing twice gives the same result, as the swizzle is done on a
+       private copy of the mapped pages */
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    Containers::Optional<ImageData2D> image2 = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_VERIFY(image2);
+    CORRADE_COMPARE(reinterpret_cast<const Color4ub*>(image->data().data())[1], expected);
+    CORRADE_COMPARE(reinterpret_cast<const Color4ub*>(image2->data().data())[1], expected);
+
+    /* The file is not modified */
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{Utility::Directory::read(filename)},
+        Containers::ArrayView<const char>{data},
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::openFileNotFound() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openFile("nonexistent.dds"));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openFile(): cannot open file nonexistent.dds\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::DdsImporterTest)
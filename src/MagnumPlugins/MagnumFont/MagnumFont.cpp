@@ -25,38 +25,103 @@
 
 #include "MagnumFont.h"
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
-#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Configuration.h>
 #include <Corrade/Utility/Directory.h>
 #include <Corrade/Utility/Unicode.h>
 
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
 #include "Magnum/Text/GlyphCache.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MapFile.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontBinary.h"
 #include "MagnumPlugins/TgaImporter/TgaImporter.h"
 
 namespace Magnum { namespace Text {
 
+using Implementation::MagnumFontBinaryChar;
+using Implementation::MagnumFontBinaryGlyph;
+using Implementation::MagnumFontBinaryHeader;
+
 struct MagnumFont::Data {
+    UnsignedInt glyphIdFor(char32_t character) const;
+
+    /* Text format */
     Utility::Configuration conf;
-    Trade::ImageData2D image;
+    Containers::Optional<Trade::ImageData2D> image;
+    /* Characters from the Basic Multilingual Plane are looked up directly,
+       the rest goes through a hash map */
+    std::vector<UnsignedInt> glyphIdDense;
     std::unordered_map<char32_t, UnsignedInt> glyphId;
-    std::vector<Vector2> glyphAdvance;
+    std::vector<Vector2> glyphAdvanceStorage;
+
+    /* Binary format, all views point into the file, which is either mapped
+       or copied */
+    Containers::Array<char> file;
+    const MagnumFontBinaryHeader* header{};
+    Containers::ArrayView<const MagnumFontBinaryGlyph> glyphs;
+    Containers::ArrayView<const MagnumFontBinaryChar> chars;
+    Containers::ArrayView<const char> imageData;
+
+    /* Points to either glyphAdvanceStorage or glyphs */
+    Containers::StridedArrayView<const Vector2> glyphAdvance;
 };
 
+UnsignedInt MagnumFont::Data::glyphIdFor(const char32_t character) const {
+    /* Characters of the binary format are sorted, so a binary search is
+       enough and there's no need to build any lookup table on opening */
+    if(header) {
+        const MagnumFontBinaryChar* const found = std::lower_bound(chars.begin(), chars.end(), character, [](const MagnumFontBinaryChar& a, const char32_t b) {
+            return a.codepoint < b;
+        });
+        return found != chars.end() && found->codepoint == character ? found->glyph : 0;
+    }
+
+    if(character < glyphIdDense.size()) return glyphIdDense[character];
+    auto it = glyphId.find(character);
+    return it != glyphId.end() ? it->second : 0;
+}
+
 namespace {
     class MagnumFontLayouter: public AbstractLayouter {
         public:
-            explicit MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, Float fontSize, Float textSize, std::vector<UnsignedInt>&& glyphs);
+            explicit MagnumFontLayouter(Containers::StridedArrayView<const Vector2> glyphAdvance, const GlyphCache& cache, Float fontSize, Float textSize, std::vector<UnsignedInt>&& glyphs);
 
         private:
             std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override;
 
-            const std::vector<Vector2>& glyphAdvance;
+            Containers::StridedArrayView<const Vector2> glyphAdvance;
             const GlyphCache& cache;
             const Float fontSize, textSize;
             const std::vector<UnsignedInt> glyphs;
     };
+
+    std::tuple<Range2D, Range2D, Vector2> renderGlyph(Containers::StridedArrayView<const Vector2> glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, const UnsignedInt glyph) {
+        /* Position of the texture in the resulting glyph, texture coordinates */
+        Vector2i position;
+        Range2Di rectangle;
+        std::tie(position, rectangle) = cache[glyph];
+
+        /* Normalized texture coordinates */
+        const auto textureCoordinates = Range2D(rectangle).scaled(1.0f/Vector2(cache.textureSize()));
+
+        /* Quad rectangle, computed from texture rectangle, denormalized to
+           requested text size */
+        const auto quadRectangle = Range2D(Range2Di::fromSize(position, rectangle.size())).scaled(Vector2(textSize/fontSize));
+
+        /* Advance for given glyph, denormalized to requested text size */
+        const Vector2 advance = glyphAdvance[glyph]*(textSize/fontSize);
+
+        return std::make_tuple(quadRectangle, textureCoordinates, advance);
+    }
 }
 
 MagnumFont::MagnumFont(): _opened(nullptr) {}
@@ -69,10 +134,26 @@ auto MagnumFont::doFeatures() const -> Features { return Feature::OpenData|Featu
 
 bool MagnumFont::doIsOpened() const { return _opened; }
 
+namespace {
+
+bool isBinary(const Containers::ArrayView<const char> data) {
+    return data.size() >= sizeof(MagnumFontBinaryHeader) && std::memcmp(data, Implementation::MagnumFontBinaryMagic, sizeof(MagnumFontBinaryHeader::magic)) == 0;
+}
+
+}
+
 auto MagnumFont::doOpenData(const std::vector<std::pair<std::string, Containers::ArrayView<const char>>>& data, const Float) -> Metrics {
-    /* We need just the configuration file and image file */
+    /* The binary format is a single file, copy it so the views can point
+       inside */
+    if(data.size() == 1 && isBinary(data[0].second)) {
+        Containers::Array<char> file{Containers::NoInit, data[0].second.size()};
+        std::copy(data[0].second.begin(), data[0].second.end(), file.begin());
+        return openBinaryInternal(std::move(file));
+    }
+
+    /* Otherwise we need just the configuration file and image file */
     if(data.size() != 2) {
-        Error() << "Text::MagnumFont::openData(): wanted two files, got" << data.size();
+        Error() << "Text::MagnumFont::openData(): wanted two files or one binary file, got" << data.size();
         return {};
     }
 
@@ -115,6 +196,12 @@ auto MagnumFont::doOpenData(const std::vector<std::pair<std::string, Containers:
 }
 
 auto MagnumFont::doOpenFile(const std::string& filename, Float) -> Metrics {
+    /* The binary format is used directly from the mapped file */
+    {
+        Containers::Optional<Containers::Array<char>> file = Trade::mapFile(filename);
+        if(file && isBinary(*file)) return openBinaryInternal(std::move(*file));
+    }
+
     /* Open the configuration file */
     Utility::Configuration conf(filename, Utility::Configuration::Flag::ReadOnly|Utility::Configuration::Flag::SkipComments);
     if(!conf.isValid() || conf.isEmpty()) {
@@ -147,20 +234,28 @@ auto MagnumFont::doOpenFile(const std::string& filename, Float) -> Metrics {
 
 auto MagnumFont::openInternal(Utility::Configuration&& conf, Trade::ImageData2D&& image) -> Metrics {
     /* Everything okay, save the data internally */
-    _opened = new Data{std::move(conf), std::move(image), std::unordered_map<char32_t, UnsignedInt>{}, {}};
+    _opened = new Data;
+    _opened->conf = std::move(conf);
+    _opened->image = Containers::Optional<Trade::ImageData2D>{std::move(image)};
 
     /* Glyph advances */
     const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
-    _opened->glyphAdvance.reserve(glyphs.size());
+    _opened->glyphAdvanceStorage.reserve(glyphs.size());
     for(const Utility::ConfigurationGroup* const g: glyphs)
-        _opened->glyphAdvance.push_back(g->value<Vector2>("advance"));
+        _opened->glyphAdvanceStorage.push_back(g->value<Vector2>("advance"));
+    _opened->glyphAdvance = {_opened->glyphAdvanceStorage.data(), _opened->glyphAdvanceStorage.size(), sizeof(Vector2)};
 
     /* Fill character->glyph map */
     const std::vector<Utility::ConfigurationGroup*> chars = _opened->conf.groups("char");
     for(const Utility::ConfigurationGroup* const c: chars) {
         const UnsignedInt glyphId = c->value<UnsignedInt>("glyph");
         CORRADE_INTERNAL_ASSERT(glyphId < _opened->glyphAdvance.size());
-        _opened->glyphId.emplace(c->value<char32_t>("unicode"), glyphId);
+        const char32_t character = c->value<char32_t>("unicode");
+        if(character < 0x10000) {
+            if(character >= _opened->glyphIdDense.size())
+                _opened->glyphIdDense.resize(character + 1, 0);
+            _opened->glyphIdDense[character] = glyphId;
+        } else _opened->glyphId.emplace(character, glyphId);
     }
 
     return {_opened->conf.value<Float>("fontSize"),
@@ -169,14 +264,56 @@ auto MagnumFont::openInternal(Utility::Configuration&& conf, Trade::ImageData2D&
             _opened->conf.value<Float>("lineHeight")};
 }
 
+auto MagnumFont::openBinaryInternal(Containers::Array<char>&& file) -> Metrics {
+    /** @todo handle big-endian platforms */
+    const MagnumFontBinaryHeader& header = *reinterpret_cast<const MagnumFontBinaryHeader*>(file.data());
+    if(header.version != Implementation::MagnumFontBinaryVersion) {
+        Error() << "Text::MagnumFont::openData(): unsupported binary file version, expected"
+                << Implementation::MagnumFontBinaryVersion << "but got" << header.version;
+        return {};
+    }
+
+    const std::size_t glyphOffset = sizeof(MagnumFontBinaryHeader);
+    const std::size_t charOffset = glyphOffset + std::size_t(header.glyphCount)*sizeof(MagnumFontBinaryGlyph);
+    const std::size_t imageOffset = charOffset + std::size_t(header.charCount)*sizeof(MagnumFontBinaryChar);
+    if(!header.glyphCount) {
+        Error() << "Text::MagnumFont::openData(): binary file has no glyphs";
+        return {};
+    }
+    if(imageOffset + header.imageDataSize != file.size()) {
+        Error() << "Text::MagnumFont::openData(): binary file has improper size, expected"
+                << imageOffset + header.imageDataSize << "but got" << file.size();
+        return {};
+    }
+
+    /* Just verify the character table, nothing needs to be built */
+    const Containers::ArrayView<const MagnumFontBinaryChar> chars{reinterpret_cast<const MagnumFontBinaryChar*>(file.data() + charOffset), header.charCount};
+    for(std::size_t i = 0; i != chars.size(); ++i) {
+        if(chars[i].glyph >= header.glyphCount || (i && chars[i - 1].codepoint >= chars[i].codepoint)) {
+            Error() << "Text::MagnumFont::openData(): binary file has corrupted character table";
+            return {};
+        }
+    }
+
+    _opened = new Data;
+    _opened->header = &header;
+    _opened->glyphs = {reinterpret_cast<const MagnumFontBinaryGlyph*>(file.data() + glyphOffset), header.glyphCount};
+    _opened->chars = chars;
+    _opened->imageData = {file.data() + imageOffset, header.imageDataSize};
+    _opened->glyphAdvance = {&_opened->glyphs[0].advance, _opened->glyphs.size(), sizeof(MagnumFontBinaryGlyph)};
+    /* Moving the array doesn't change the data pointer */
+    _opened->file = std::move(file);
+
+    return {header.fontSize, header.ascent, header.descent, header.lineHeight};
+}
+
 void MagnumFont::doClose() {
     delete _opened;
     _opened = nullptr;
 }
 
 UnsignedInt MagnumFont::doGlyphId(const char32_t character) {
-    auto it = _opened->glyphId.find(character);
-    return it != _opened->glyphId.end() ? it->second : 0;
+    return _opened->glyphIdFor(character);
 }
 
 Vector2 MagnumFont::doGlyphAdvance(const UnsignedInt glyph) {
@@ -184,12 +321,36 @@ Vector2 MagnumFont::doGlyphAdvance(const UnsignedInt glyph) {
 }
 
 std::unique_ptr<GlyphCache> MagnumFont::doCreateGlyphCache() {
+    /* Binary format has everything prepared in the file */
+    if(_opened->header) {
+        const MagnumFontBinaryHeader& header = *_opened->header;
+        std::unique_ptr<GlyphCache> cache;
+
+        /* The compressed image is uploaded as-is, the cache texture has to
+           have the same format */
+        if(header.flags & Implementation::MagnumFontBinaryFlagCompressed) {
+            const GL::CompressedPixelFormat format = GL::compressedPixelFormat(CompressedPixelFormat(header.imageFormat));
+            cache.reset(new Text::GlyphCache(GL::TextureFormat(GLenum(format)),
+                header.originalImageSize, header.imageSize, header.padding));
+            cache->texture().setCompressedSubImage(0, {}, CompressedImageView2D{CompressedPixelFormat(header.imageFormat), header.imageSize, _opened->imageData});
+        } else {
+            cache.reset(new Text::GlyphCache(header.originalImageSize,
+                header.imageSize, header.padding));
+            cache->setImage({}, ImageView2D{PixelFormat(header.imageFormat), header.imageSize, _opened->imageData});
+        }
+
+        for(std::size_t i = 0; i != _opened->glyphs.size(); ++i)
+            cache->insert(i, _opened->glyphs[i].position, _opened->glyphs[i].rectangle);
+
+        return cache;
+    }
+
     /* Set cache image */
     std::unique_ptr<GlyphCache> cache(new Text::GlyphCache(
         _opened->conf.value<Vector2i>("originalImageSize"),
-        _opened->image.size(),
+        _opened->image->size(),
         _opened->conf.value<Vector2i>("padding")));
-    cache->setImage({}, _opened->image);
+    cache->setImage({}, *_opened->image);
 
     /* Fill glyph map */
     const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
@@ -206,34 +367,31 @@ std::unique_ptr<AbstractLayouter> MagnumFont::doLayout(const GlyphCache& cache,
     for(std::size_t i = 0; i != text.size(); ) {
         UnsignedInt codepoint;
         std::tie(codepoint, i) = Utility::Unicode::nextChar(text, i);
-        const auto it = _opened->glyphId.find(codepoint);
-        glyphs.push_back(it == _opened->glyphId.end() ? 0 : it->second);
+        glyphs.push_back(_opened->glyphIdFor(codepoint));
     }
 
     return std::unique_ptr<MagnumFontLayouter>(new MagnumFontLayouter(_opened->glyphAdvance, cache, this->size(), size, std::move(glyphs)));
 }
 
-namespace {
-
-MagnumFontLayouter::MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, std::vector<UnsignedInt>&& glyphs): AbstractLayouter(glyphs.size()), glyphAdvance(glyphAdvance), cache(cache), fontSize(fontSize), textSize(textSize), glyphs(std::move(glyphs)) {}
-
-std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const UnsignedInt i) {
-    /* Position of the texture in the resulting glyph, texture coordinates */
-    Vector2i position;
-    Range2Di rectangle;
-    std::tie(position, rectangle) = cache[glyphs[i]];
+UnsignedInt MagnumFont::doLayoutInto(const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::StridedArrayView<Range2D> quadPositions, const Containers::StridedArrayView<Range2D> textureCoordinates, const Containers::StridedArrayView<Vector2> advances) {
+    /* Same as doLayout(), but rendering the glyphs directly to the output
+       instead of going through a temporary glyph list */
+    UnsignedInt glyphCount = 0;
+    for(std::size_t i = 0; i != text.size(); ++glyphCount) {
+        UnsignedInt codepoint;
+        std::tie(codepoint, i) = Utility::Unicode::nextChar(text, i);
+        std::tie(quadPositions[glyphCount], textureCoordinates[glyphCount], advances[glyphCount]) = renderGlyph(_opened->glyphAdvance, cache, this->size(), size, _opened->glyphIdFor(codepoint));
+    }
 
-    /* Normalized texture coordinates */
-    const auto textureCoordinates = Range2D(rectangle).scaled(1.0f/Vector2(cache.textureSize()));
+    return glyphCount;
+}
 
-    /* Quad rectangle, computed from texture rectangle, denormalized to
-       requested text size */
-    const auto quadRectangle = Range2D(Range2Di::fromSize(position, rectangle.size())).scaled(Vector2(textSize/fontSize));
+namespace {
 
-    /* Advance for given glyph, denormalized to requested text size */
-    const Vector2 advance = glyphAdvance[glyphs[i]]*(textSize/fontSize);
+MagnumFontLayouter::MagnumFontLayouter(Containers::StridedArrayView<const Vector2> glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, std::vector<UnsignedInt>&& glyphs): AbstractLayouter(glyphs.size()), glyphAdvance(glyphAdvance), cache(cache), fontSize(fontSize), textSize(textSize), glyphs(std::move(glyphs)) {}
 
-    return std::make_tuple(quadRectangle, textureCoordinates, advance);
+std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const UnsignedInt i) {
+    return renderGlyph(glyphAdvance, cache, fontSize, textSize, glyphs[i]);
 }
 
 }
@@ -241,4 +399,4 @@ std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const Un
 }}
 
 CORRADE_PLUGIN_REGISTER(MagnumFont, Magnum::Text::MagnumFont,
-    "cz.mosra.magnum.Text.AbstractFont/0.2.4")
+    "cz.mosra.magnum.Text.AbstractFont/0.2.5")
@@ -121,6 +121,19 @@ rectangle=45 0 44 25
 
 # ...
 @endcode
+
+@section Text-MagnumFont-binary Binary format
+
+Alternatively the font can be stored in a single binary file, created by
+@ref MagnumFontConverter when the output filename has a `.magnumfont`
+extension. It contains the same information, with the glyph properties
+stored in glyph ID order, characters sorted by codepoint and the glyph cache
+image, either uncompressed or in a GPU-compressed format, embedded directly.
+The file is detected by its contents. When opened using @ref openFile(), it's
+memory-mapped on Unix systems and used directly without any parsing or
+copying. Glyph IDs are then looked up using a binary search in the character
+table. The image is uploaded as-is in @ref createGlyphCache(), so a
+compressed image needs the same compressed format to be supported by the GPU.
 */
 class MAGNUM_MAGNUMFONT_EXPORT MagnumFont: public AbstractFont {
     public:
@@ -145,8 +158,10 @@ class MAGNUM_MAGNUMFONT_EXPORT MagnumFont: public AbstractFont {
         MAGNUM_MAGNUMFONT_LOCAL Vector2 doGlyphAdvance(UnsignedInt glyph) override;
         MAGNUM_MAGNUMFONT_LOCAL std::unique_ptr<GlyphCache> doCreateGlyphCache() override;
         MAGNUM_MAGNUMFONT_LOCAL std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache& cache, Float size, const std::string& text) override;
+        MAGNUM_MAGNUMFONT_LOCAL UnsignedInt doLayoutInto(const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, Containers::StridedArrayView<Range2D> quadPositions, Containers::StridedArrayView<Range2D> textureCoordinates, Containers::StridedArrayView<Vector2> advances) override;
 
         MAGNUM_MAGNUMFONT_LOCAL Metrics openInternal(Utility::Configuration&& conf, Trade::ImageData2D&& image);
+        MAGNUM_MAGNUMFONT_LOCAL Metrics openBinaryInternal(Containers::Array<char>&& file);
 
         Data* _opened;
 };
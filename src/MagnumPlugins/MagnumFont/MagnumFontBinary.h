@@ -0,0 +1,83 @@
+#ifndef Magnum_Text_MagnumFontBinary_h
+#define Magnum_Text_MagnumFontBinary_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Text { namespace Implementation {
+
+/* Binary MagnumFont file, written by MagnumFontConverter. Laid out so it can
+   be used directly from a memory-mapped file: header followed by glyph
+   properties in glyph ID order, characters sorted by codepoint and finally
+   the glyph cache image. All values are little-endian and four-byte
+   aligned. */
+
+/* File header */
+struct MagnumFontBinaryHeader {
+    char magic[8];                  /* MagnumFontBinaryMagic */
+    UnsignedInt version;            /* MagnumFontBinaryVersion */
+    UnsignedInt flags;              /* MagnumFontBinaryFlag */
+    Float fontSize, ascent, descent, lineHeight;
+    Vector2i originalImageSize;
+    Vector2i padding;
+    Vector2i imageSize;
+    UnsignedInt imageFormat;        /* PixelFormat or CompressedPixelFormat */
+    UnsignedInt glyphCount;
+    UnsignedInt charCount;
+    UnsignedInt imageDataSize;      /* with rows aligned to four bytes */
+};
+
+static_assert(sizeof(MagnumFontBinaryHeader) == 72, "Improper size of binary MagnumFont header");
+
+constexpr char MagnumFontBinaryMagic[] = "MGNMFONT";
+constexpr UnsignedInt MagnumFontBinaryVersion = 2;
+
+enum: UnsignedInt {
+    /* Image format is CompressedPixelFormat instead of PixelFormat */
+    MagnumFontBinaryFlagCompressed = 1 << 0
+};
+
+/* Glyph properties, padding already removed */
+struct MagnumFontBinaryGlyph {
+    Vector2 advance;
+    Vector2i position;
+    Range2Di rectangle;
+};
+
+static_assert(sizeof(MagnumFontBinaryGlyph) == 32, "Improper size of binary MagnumFont glyph");
+
+/* Character to glyph mapping */
+struct MagnumFontBinaryChar {
+    UnsignedInt codepoint;
+    UnsignedInt glyph;
+};
+
+static_assert(sizeof(MagnumFontBinaryChar) == 8, "Improper size of binary MagnumFont character");
+
+}}}
+
+#endif
@@ -0,0 +1,106 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct MagnumFontGLBenchmark: GL::OpenGLTester {
+    explicit MagnumFontGLBenchmark();
+
+    void openFile();
+    void layout();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<Trade::AbstractImporter> _importerManager{"nonexistent"};
+    PluginManager::Manager<AbstractFont> _fontManager{"nonexistent"};
+};
+
+namespace {
+    enum: std::size_t { OpenCount = 100, GlyphCount = 4096 };
+}
+
+MagnumFontGLBenchmark::MagnumFontGLBenchmark() {
+    addBenchmarks({&MagnumFontGLBenchmark::openFile,
+                   &MagnumFontGLBenchmark::layout}, 10);
+
+    /* Load the plugins directly from the build tree. Otherwise they're static
+       and already loaded. */
+    #if defined(TGAIMPORTER_PLUGIN_FILENAME) && defined(MAGNUMFONT_PLUGIN_FILENAME)
+    CORRADE_INTERNAL_ASSERT(_importerManager.load(TGAIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    CORRADE_INTERNAL_ASSERT(_fontManager.load(MAGNUMFONT_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void MagnumFontGLBenchmark::openFile() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+    const std::string filename = Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf");
+
+    /* Parses the configuration and imports the glyph image through
+       TgaImporter. Divide OpenCount by the reported time to get fonts per
+       second. */
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != OpenCount; ++i)
+        count += font->openFile(filename, 0.0f) ? 1 : 0;
+
+    CORRADE_COMPARE(count, OpenCount);
+}
+
+void MagnumFontGLBenchmark::layout() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+    CORRADE_VERIFY(font->openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf"), 0.0f));
+
+    GlyphCache cache(Vector2i(256));
+    cache.insert(font->glyphId(U'W'), {25, 34}, {{0, 8}, {16, 128}});
+    cache.insert(font->glyphId(U'e'), {25, 12}, {{16, 4}, {64, 32}});
+
+    const std::string text(GlyphCount, 'W');
+
+    /* Divide GlyphCount by the reported time to get glyphs per second */
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        auto layouter = font->layout(cache, 0.5f, text);
+        Range2D rectangle;
+        for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
+            Vector2 cursorPosition;
+            layouter->renderGlyph(i, cursorPosition, rectangle);
+        }
+        count += layouter->glyphCount();
+    }
+
+    CORRADE_COMPARE(count, GlyphCount);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::MagnumFontGLBenchmark)
@@ -24,6 +24,7 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/GL/OpenGLTester.h"
@@ -43,6 +44,12 @@ struct MagnumFontGLTest: GL::OpenGLTester {
     void layout();
     void createGlyphCache();
 
+    void binaryProperties();
+    void binaryOpenData();
+    void binaryInvalidSize();
+    void binaryLayout();
+    void binaryCreateGlyphCache();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<Trade::AbstractImporter> _importerManager{"nonexistent"};
     PluginManager::Manager<AbstractFont> _fontManager{"nonexistent"};
@@ -52,7 +59,13 @@ MagnumFontGLTest::MagnumFontGLTest() {
     addTests({&MagnumFontGLTest::nonexistent,
               &MagnumFontGLTest::properties,
               &MagnumFontGLTest::layout,
-              &MagnumFontGLTest::createGlyphCache});
+              &MagnumFontGLTest::createGlyphCache,
+
+              &MagnumFontGLTest::binaryProperties,
+              &MagnumFontGLTest::binaryOpenData,
+              &MagnumFontGLTest::binaryInvalidSize,
+              &MagnumFontGLTest::binaryLayout,
+              &MagnumFontGLTest::binaryCreateGlyphCache});
 
     /* Load the plugins directly from the build tree. Otherwise they're static
        and already loaded. */
@@ -141,6 +154,100 @@ void MagnumFontGLTest::createGlyphCache() {
     /** @todo properly test contents */
 }
 
+void MagnumFontGLTest::binaryProperties() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    /* Same contents as font.conf + font.tga */
+    CORRADE_VERIFY(font->openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.magnumfont"), 0.0f));
+    CORRADE_COMPARE(font->size(), 16.0f);
+    CORRADE_COMPARE(font->ascent(), 25.0f);
+    CORRADE_COMPARE(font->descent(), -10.0f);
+    CORRADE_COMPARE(font->lineHeight(), 39.7333f);
+    CORRADE_COMPARE(font->glyphId(U'W'), 2);
+    CORRADE_COMPARE(font->glyphId(U'e'), 1);
+    CORRADE_COMPARE(font->glyphId(U'a'), 0);
+    CORRADE_COMPARE(font->glyphId(U'\U0001F600'), 0);
+    CORRADE_COMPARE(font->glyphAdvance(font->glyphId(U'W')), Vector2(23.0f, 0.0f));
+    CORRADE_COMPARE(font->glyphAdvance(3), Vector2());
+}
+
+void MagnumFontGLTest::binaryOpenData() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    const Containers::Array<char> data = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.magnumfont"));
+    CORRADE_VERIFY(font->openData({{"font.magnumfont", data}}, 0.0f));
+    CORRADE_COMPARE(font->size(), 16.0f);
+    CORRADE_COMPARE(font->glyphId(U'e'), 1);
+    CORRADE_COMPARE(font->glyphAdvance(1), Vector2(12.0f, 0.0f));
+}
+
+void MagnumFontGLTest::binaryInvalidSize() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    const Containers::Array<char> data = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.magnumfont"));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!font->openData({{"font.magnumfont", data.prefix(data.size() - 1)}}, 0.0f));
+    CORRADE_COMPARE(out.str(), "Text::MagnumFont::openData(): binary file has improper size, expected 212 but got 211\n");
+}
+
+void MagnumFontGLTest::binaryLayout() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    CORRADE_VERIFY(font->openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.magnumfont"), 0.0f));
+
+    /* Same as layout(), just checking that the glyph lookup and advances work
+       the same */
+    GlyphCache cache(Vector2i(256));
+    cache.insert(font->glyphId(U'W'), {25, 34}, {{0, 8}, {16, 128}});
+    cache.insert(font->glyphId(U'e'), {25, 12}, {{16, 4}, {64, 32}});
+
+    auto layouter = font->layout(cache, 0.5f, "Wave");
+    CORRADE_VERIFY(layouter);
+    CORRADE_COMPARE(layouter->glyphCount(), 4);
+
+    Range2D rectangle;
+    Range2D position;
+    Range2D textureCoordinates;
+
+    /* 'W' */
+    Vector2 cursorPosition;
+    std::tie(position, textureCoordinates) = layouter->renderGlyph(0, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(position, Range2D({0.78125f, 1.0625f}, {1.28125f, 4.8125f}));
+    CORRADE_COMPARE(textureCoordinates, Range2D({0, 0.03125f}, {0.0625f, 0.5f}));
+    CORRADE_COMPARE(cursorPosition, Vector2(0.71875f, 0.0f));
+
+    /* 'a' (not found) */
+    std::tie(position, textureCoordinates) = layouter->renderGlyph(1, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(position, Range2D());
+    CORRADE_COMPARE(textureCoordinates, Range2D());
+    CORRADE_COMPARE(cursorPosition, Vector2(0.25f, 0.0f));
+
+    /* 'e' */
+    std::tie(position, textureCoordinates) = layouter->renderGlyph(3, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(position, Range2D({0.78125f, 0.375f}, {2.28125f, 1.25f}));
+    CORRADE_COMPARE(textureCoordinates, Range2D({0.0625f, 0.015625f}, {0.25f, 0.125f}));
+    CORRADE_COMPARE(cursorPosition, Vector2(0.375f, 0.0f));
+}
+
+void MagnumFontGLTest::binaryCreateGlyphCache() {
+    std::unique_ptr<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    CORRADE_VERIFY(font->openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.magnumfont"), 0.0f));
+
+    std::unique_ptr<GlyphCache> cache = font->createGlyphCache();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(cache);
+    CORRADE_COMPARE(cache->glyphCount(), 3);
+    CORRADE_COMPARE(cache->textureSize(), Vector2i(1536));
+    CORRADE_COMPARE(cache->padding(), Vector2i(24));
+    /* The padding is added back on insertion */
+    CORRADE_COMPARE((*cache)[2].first, Vector2i(1, 10));
+    CORRADE_COMPARE((*cache)[2].second, Range2Di({-24, -16}, {40, 152}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::MagnumFontGLTest)
@@ -25,15 +25,19 @@
 
 #include "MagnumFontConverter.h"
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Configuration.h>
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/String.h>
 
 #include "Magnum/Image.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Text/GlyphCache.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontBinary.h"
 #include "MagnumPlugins/TgaImageConverter/TgaImageConverter.h"
 
 namespace Magnum { namespace Text {
@@ -47,6 +51,9 @@ auto MagnumFontConverter::doFeatures() const -> Features {
 }
 
 std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter::doExportFontToData(AbstractFont& font, GlyphCache& cache, const std::string& filename, const std::u32string& characters) const {
+    if(Utility::String::endsWith(filename, ".magnumfont"))
+        return exportBinaryFontToData(font, cache, filename, characters);
+
     Utility::Configuration configuration;
 
     configuration.setValue("version", 1);
@@ -112,6 +119,86 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
     return out;
 }
 
+std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter::exportBinaryFontToData(AbstractFont& font, GlyphCache& cache, const std::string& filename, const std::u32string& characters) const {
+    using namespace Implementation;
+
+    /* Same glyph ID compression as for the text format */
+    std::unordered_map<UnsignedInt, UnsignedInt> glyphIdMap;
+    glyphIdMap.reserve(cache.glyphCount());
+    glyphIdMap.emplace(0, 0);
+    for(const std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>>& glyph: cache)
+        glyphIdMap.emplace(glyph.first, glyphIdMap.size());
+
+    std::vector<UnsignedInt> inverseGlyphIdMap(glyphIdMap.size());
+    for(const std::pair<UnsignedInt, UnsignedInt>& map: glyphIdMap)
+        inverseGlyphIdMap[map.second] = map.first;
+
+    /* Characters sorted by codepoint so they can be binary-searched, with
+       duplicates removed */
+    std::vector<MagnumFontBinaryChar> chars;
+    chars.reserve(characters.size());
+    for(const char32_t c: characters) {
+        auto found = glyphIdMap.find(font.glyphId(c));
+        chars.push_back({UnsignedInt(c), found == glyphIdMap.end() ? 0 : found->second});
+    }
+    std::sort(chars.begin(), chars.end(), [](const MagnumFontBinaryChar& a, const MagnumFontBinaryChar& b) {
+        return a.codepoint < b.codepoint;
+    });
+    chars.erase(std::unique(chars.begin(), chars.end(), [](const MagnumFontBinaryChar& a, const MagnumFontBinaryChar& b) {
+        return a.codepoint == b.codepoint;
+    }), chars.end());
+
+    /* Cache image, with the default four-byte row alignment */
+    Image2D image{PixelFormat::R8Unorm};
+    cache.texture().image(0, image);
+
+    MagnumFontBinaryHeader header{};
+    std::memcpy(header.magic, MagnumFontBinaryMagic, sizeof(header.magic));
+    header.version = MagnumFontBinaryVersion;
+    header.fontSize = font.size();
+    header.ascent = font.ascent();
+    header.descent = font.descent();
+    header.lineHeight = font.lineHeight();
+    header.originalImageSize = cache.textureSize();
+    header.padding = cache.padding();
+    header.imageSize = image.size();
+    header.imageFormat = UnsignedInt(PixelFormat::R8Unorm);
+    header.glyphCount = inverseGlyphIdMap.size();
+    header.charCount = chars.size();
+    header.imageDataSize = image.data().size();
+
+    Containers::Array<char> data{Containers::ValueInit,
+        sizeof(MagnumFontBinaryHeader) +
+        inverseGlyphIdMap.size()*sizeof(MagnumFontBinaryGlyph) +
+        chars.size()*sizeof(MagnumFontBinaryChar) +
+        image.data().size()};
+    char* out = data;
+    std::memcpy(out, &header, sizeof(MagnumFontBinaryHeader));
+    out += sizeof(MagnumFontBinaryHeader);
+
+    /* Glyph properties in the new ID order, padding removed the same way as
+       for the text format */
+    for(UnsignedInt oldGlyphId: inverseGlyphIdMap) {
+        std::pair<Vector2i, Range2Di> glyph = cache[oldGlyphId];
+        const MagnumFontBinaryGlyph binaryGlyph{font.glyphAdvance(oldGlyphId),
+            glyph.first + cache.padding(),
+            glyph.second.padded(-cache.padding())};
+        std::memcpy(out, &binaryGlyph, sizeof(MagnumFontBinaryGlyph));
+        out += sizeof(MagnumFontBinaryGlyph);
+    }
+
+    if(!chars.empty()) {
+        std::memcpy(out, chars.data(), chars.size()*sizeof(MagnumFontBinaryChar));
+        out += chars.size()*sizeof(MagnumFontBinaryChar);
+    }
+
+    std::copy(image.data().begin(), image.data().end(), out);
+
+    std::vector<std::pair<std::string, Containers::Array<char>>> files;
+    files.emplace_back(filename, std::move(data));
+    return files;
+}
+
 }}
 
 CORRADE_PLUGIN_REGISTER(MagnumFontConverter, Magnum::Text::MagnumFontConverter,
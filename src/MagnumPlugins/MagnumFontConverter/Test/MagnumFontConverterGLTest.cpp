@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Directory.h>
 #include <Corrade/TestSuite/Compare/File.h>
 
@@ -37,15 +39,54 @@
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontBinary.h"
 
 #include "configure.h"
 
 namespace Magnum { namespace Text { namespace Test {
 
+/* Fake font with fake cache */
+class FakeFont: public Text::AbstractFont {
+    public:
+        explicit FakeFont(): _opened(false) {}
+
+    private:
+        void doClose() { _opened = false; }
+        bool doIsOpened() const { return _opened; }
+        Metrics doOpenFile(const std::string&, Float) {
+            _opened = true;
+            return {16.0f, 25.0f, -10.0f, 39.7333f};
+        }
+        Features doFeatures() const { return {}; }
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) { return nullptr; }
+
+        UnsignedInt doGlyphId(const char32_t character) {
+            switch(character) {
+                case 'W': return 2;
+                case 'e': return 1;
+            }
+
+            return 0;
+        }
+
+        Vector2 doGlyphAdvance(const UnsignedInt glyph) {
+            switch(glyph) {
+                case 0: return {8, 0};
+                case 1: return {12, 0};
+                case 2: return {23, 0};
+            }
+
+            CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+
+        bool _opened;
+};
+
 struct MagnumFontConverterGLTest: GL::OpenGLTester {
     explicit MagnumFontConverterGLTest();
 
     void exportFont();
+    void exportFontBinary();
 
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<Trade::AbstractImageConverter> _imageConverterManager{"nonexistent"};
@@ -54,7 +95,8 @@ struct MagnumFontConverterGLTest: GL::OpenGLTester {
 };
 
 MagnumFontConverterGLTest::MagnumFontConverterGLTest() {
-    addTests({&MagnumFontConverterGLTest::exportFont});
+    addTests({&MagnumFontConverterGLTest::exportFont,
+              &MagnumFontConverterGLTest::exportFontBinary});
 
     /* Load the plugins directly from the build tree. Otherwise they are static
        and already loaded. */
@@ -73,42 +115,7 @@ void MagnumFontConverterGLTest::exportFont() {
     Utility::Directory::rm(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.conf"));
     Utility::Directory::rm(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.tga"));
 
-    /* Fake font with fake cache */
-    class FakeFont: public Text::AbstractFont {
-        public:
-            explicit FakeFont(): _opened(false) {}
-
-        private:
-            void doClose() { _opened = false; }
-            bool doIsOpened() const { return _opened; }
-            Metrics doOpenFile(const std::string&, Float) {
-                _opened = true;
-                return {16.0f, 25.0f, -10.0f, 39.7333f};
-            }
-            Features doFeatures() const { return {}; }
-            std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) { return nullptr; }
-
-            UnsignedInt doGlyphId(const char32_t character) {
-                switch(character) {
-                    case 'W': return 2;
-                    case 'e': return 1;
-                }
-
-                return 0;
-            }
-
-            Vector2 doGlyphAdvance(const UnsignedInt glyph) {
-                switch(glyph) {
-                    case 0: return {8, 0};
-                    case 1: return {12, 0};
-                    case 2: return {23, 0};
-                }
-
-                CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
-            }
-
-            bool _opened;
-    } font;
+    FakeFont font;
     font.openFile({}, {});
 
     /* Create fake cache */
@@ -139,6 +146,53 @@ void MagnumFontConverterGLTest::exportFont() {
     CORRADE_COMPARE(image->format(), PixelFormat::R8Unorm);
 }
 
+void MagnumFontConverterGLTest::exportFontBinary() {
+    const std::string filename = Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.magnumfont");
+    Utility::Directory::rm(filename);
+
+    FakeFont font;
+    font.openFile({}, {});
+
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::texture_rg);
+    GlyphCache cache(GL::TextureFormat::R8, Vector2i(1536), Vector2i(256), Vector2i(24));
+    cache.insert(font.glyphId(U'W'), {25, 34}, {{0, 8}, {16, 128}});
+    cache.insert(font.glyphId(U'e'), {25, 12}, {{16, 4}, {64, 32}});
+
+    /* Characters out of order and with a duplicate */
+    std::unique_ptr<AbstractFontConverter> converter = _fontConverterManager.instantiate("MagnumFontConverter");
+    CORRADE_VERIFY(converter->exportFontToFile(font, cache, filename, "eWavee"));
+
+    const Containers::Array<char> data = Utility::Directory::read(filename);
+    CORRADE_VERIFY(data.size() >= sizeof(Implementation::MagnumFontBinaryHeader));
+
+    Implementation::MagnumFontBinaryHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    CORRADE_COMPARE(std::string(header.magic, 8), "MGNMFONT");
+    CORRADE_COMPARE(header.version, 2);
+    CORRADE_COMPARE(header.flags, 0);
+    CORRADE_COMPARE(header.fontSize, 16.0f);
+    CORRADE_COMPARE(header.lineHeight, 39.7333f);
+    CORRADE_COMPARE(header.originalImageSize, Vector2i(1536));
+    CORRADE_COMPARE(header.padding, Vector2i(24));
+    CORRADE_COMPARE(header.imageSize, Vector2i(256));
+    CORRADE_COMPARE(header.imageFormat, UnsignedInt(PixelFormat::R8Unorm));
+    CORRADE_COMPARE(header.glyphCount, 3);
+    CORRADE_COMPARE(header.charCount, 4);
+    CORRADE_COMPARE(header.imageDataSize, 256*256);
+    CORRADE_COMPARE(data.size(), sizeof(header) + 3*sizeof(Implementation::MagnumFontBinaryGlyph) + 4*sizeof(Implementation::MagnumFontBinaryChar) + 256*256);
+
+    /* Characters are sorted and unique */
+    Implementation::MagnumFontBinaryChar chars[4];
+    std::memcpy(chars, data + sizeof(header) + 3*sizeof(Implementation::MagnumFontBinaryGlyph), sizeof(chars));
+    CORRADE_COMPARE(chars[0].codepoint, U'W');
+    CORRADE_COMPARE(chars[1].codepoint, U'a');
+    CORRADE_COMPARE(chars[2].codepoint, U'e');
+    CORRADE_COMPARE(chars[3].codepoint, U'v');
+    CORRADE_COMPARE(chars[1].glyph, 0);
+    CORRADE_COMPARE(chars[3].glyph, 0);
+    CORRADE_VERIFY(chars[0].glyph != 0 && chars[2].glyph != 0);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::MagnumFontConverterGLTest)
@@ -25,65 +25,495 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
-#include <limits>
-#include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <unordered_map>
-#include <Corrade/Containers/ArrayView.h>
-#include <Corrade/Utility/String.h>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Mesh.h"
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/MeshTools/CombineIndexedArrays.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Trade/MapFile.h"
 #include "Magnum/Trade/MeshData3D.h"
 
 namespace Magnum { namespace Trade {
 
+namespace {
+
+struct Mesh {
+    /* Byte range of the mesh in the file */
+    std::size_t begin, end;
+
+    /* Global OBJ index of the first position, texture coordinate and normal
+       of this mesh */
+    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
+
+    /* Element counts gathered when opening the file, used to reserve memory
+       up front when parsing the mesh */
+    std::size_t positionCount, textureCoordinateCount, normalCount, indexCount;
+};
+
+}
+
 struct ObjImporter::File {
     std::unordered_map<std::string, UnsignedInt> meshesForName;
     std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    std::unique_ptr<std::istream> in;
+    std::vector<Mesh> meshes;
+
+    /* Either a memory-mapped file or a copy of the data passed to
+       openData() */
+    Containers::Array<char> data;
 };
 
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+/* All the parsing below works on [begin, end) character ranges directly in
+   the file data, without any intermediate string allocations */
+
+inline bool isWhitespace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+inline const char* skipWhitespace(const char* begin, const char* const end) {
+    while(begin != end && isWhitespace(*begin)) ++begin;
+    return begin;
+}
+
+inline const char* findWhitespace(const char* begin, const char* const end) {
+    while(begin != end && !isWhitespace(*begin)) ++begin;
+    return begin;
+}
+
+inline const char* trimWhitespaceBack(const char* const begin, const char* end) {
+    while(end != begin && isWhitespace(*(end - 1))) --end;
+    return end;
+}
+
+/* Returns end of the current line (pointing to the '\n' or to the end of the
+   data, if this is the last line) */
+inline const char* findLineEnd(const char* const begin, const char* const end) {
+    const void* const found = std::memchr(begin, '\n', end - begin);
+    return found ? static_cast<const char*>(found) : end;
+}
+
+template<std::size_t size> inline bool equals(const char* const begin, const char* const end, const char(&string)[size]) {
+    return std::size_t(end - begin) == size - 1 && std::memcmp(begin, string, size - 1) == 0;
+}
+
+bool parseUnsignedInt(const char* begin, const char* const end, UnsignedInt& out) {
+    if(begin == end) return false;
+
+    std::uint64_t value = 0;
+    for(; begin != end; ++begin) {
+        const UnsignedInt digit = UnsignedInt(*begin - '0');
+        if(digit > 9) return false;
+        value = value*10 + digit;
+        if(value > 0xffffffffu) return false;
+    }
+
+    out = UnsignedInt(value);
+    return true;
 }
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(const std::string& str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
-        throw 0;
+/* Parses a decimal floating-point number in the usual `[+-]123.456e[+-]78`
+   form. Up to 19 significant digits are accumulated into an integer mantissa
+   and then scaled by an exactly representable power of ten where possible,
+   which is more than enough for the float precision. */
+bool parseFloat(const char* begin, const char* const end, Float& out) {
+    bool negative = false;
+    if(begin != end && (*begin == '-' || *begin == '+')) {
+        negative = *begin == '-';
+        ++begin;
+    }
+
+    std::uint64_t mantissa = 0;
+    Int exponent = 0;
+    Int significantDigits = 0;
+    bool anyDigits = false;
+
+    /* Integral part */
+    for(; begin != end && UnsignedInt(*begin - '0') <= 9; ++begin) {
+        anyDigits = true;
+        if(significantDigits < 19) {
+            mantissa = mantissa*10 + UnsignedInt(*begin - '0');
+            if(mantissa) ++significantDigits;
+        } else ++exponent;
+    }
+
+    /* Fractional part */
+    if(begin != end && *begin == '.') {
+        ++begin;
+        for(; begin != end && UnsignedInt(*begin - '0') <= 9; ++begin) {
+            anyDigits = true;
+            if(significantDigits < 19) {
+                mantissa = mantissa*10 + UnsignedInt(*begin - '0');
+                if(mantissa) ++significantDigits;
+                --exponent;
+            }
+        }
+    }
+
+    if(!anyDigits) return false;
+
+    /* Exponent */
+    if(begin != end && (*begin == 'e' || *begin == 'E')) {
+        ++begin;
+        bool negativeExponent = false;
+        if(begin != end && (*begin == '-' || *begin == '+')) {
+            negativeExponent = *begin == '-';
+            ++begin;
+        }
+
+        if(begin == end) return false;
+        Int value = 0;
+        for(; begin != end && UnsignedInt(*begin - '0') <= 9; ++begin)
+            if(value < 10000) value = value*10 + Int(*begin - '0');
+        exponent += negativeExponent ? -value : value;
+    }
+
+    /* Garbage at the end */
+    if(begin != end) return false;
+
+    static const Double powersOf10[]{
+        1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8,
+        1.0e9, 1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16,
+        1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22};
+
+    Double value = Double(mantissa);
+    if(mantissa) {
+        if(exponent < -22 || exponent > 22)
+            value *= std::pow(10.0, exponent);
+        else if(exponent < 0)
+            value /= powersOf10[-exponent];
+        else
+            value *= powersOf10[exponent];
+    }
+
+    out = Float(negative ? -value : value);
+    return true;
+}
+
+enum class ParseError: UnsignedByte {
+    None,
+    InvalidFloatArraySize,
+    NumericConversion,
+    HomogeneousCoordinates,
+    TextureCoordinates3D,
+    MixedPrimitive,
+    WrongPointIndexCount,
+    WrongLineIndexCount,
+    WrongTriangleIndexCount,
+    Polygons,
+    InvalidIndexData,
+    UnknownKeyword
+};
+
+template<std::size_t size> ParseError extractFloatData(const char* begin, const char* const end, Math::Vector<size, Float>& output, Float* extra = nullptr) {
+    /* Split into at most size + 1 tokens, the last one is optional */
+    const char* tokens[size + 1][2];
+    std::size_t count = 0;
+    for(begin = skipWhitespace(begin, end); begin != end; begin = skipWhitespace(begin, end)) {
+        const char* const tokenEnd = findWhitespace(begin, end);
+        if(count == size + (extra ? 1 : 0)) {
+            count = ~std::size_t{};
+            break;
+        }
+        tokens[count][0] = begin;
+        tokens[count][1] = tokenEnd;
+        ++count;
+        begin = tokenEnd;
     }
 
-    Math::Vector<size, Float> output;
+    if(count < size || count > size + (extra ? 1 : 0))
+        return ParseError::InvalidFloatArraySize;
 
     for(std::size_t i = 0; i != size; ++i)
-        output[i] = std::stof(data[i]);
+        if(!parseFloat(tokens[i][0], tokens[i][1], output[i]))
+            return ParseError::NumericConversion;
 
-    if(data.size() == size+1) {
+    if(count == size + 1) {
         /* This should be obvious from the first if, but add this just to make
            Clang Analyzer happy */
         CORRADE_INTERNAL_ASSERT(extra);
 
-        *extra = std::stof(data.back());
+        if(!parseFloat(tokens[size][0], tokens[size][1], *extra))
+            return ParseError::NumericConversion;
+    }
+
+    return ParseError::None;
+}
+
+std::size_t countTokens(const char* begin, const char* const end) {
+    std::size_t count = 0;
+    for(begin = skipWhitespace(begin, end); begin != end; begin = skipWhitespace(begin, end)) {
+        begin = findWhitespace(begin, end);
+        ++count;
+    }
+    return count;
+}
+
+/* Below this byte count the mesh is always parsed on the calling thread, as
+   the overhead of splitting and merging would outweigh the gains */
+constexpr std::size_t ParallelThreshold = 1024*1024;
+
+/* Chunk count per thread. The chunks are assigned to threads dynamically,
+   having more chunks than threads makes the work better balanced. */
+constexpr std::size_t ParallelChunksPerThread = 4;
+
+/* Data parsed from a newline-aligned part of a mesh. As the indices are
+   relative to the mesh and not to the chunk, the chunks can be parsed
+   independently and then just concatenated. */
+struct Chunk {
+    std::vector<Vector3> positions;
+    std::vector<Vector2> textureCoordinates;
+    std::vector<Vector3> normals;
+    std::vector<UnsignedInt> positionIndices;
+    std::vector<UnsignedInt> textureCoordinateIndices;
+    std::vector<UnsignedInt> normalIndices;
+
+    /* Primitive of the first index line in the chunk and position of that
+       line, used for checking that primitives aren't mixed across chunks */
+    Containers::Optional<MeshPrimitive> primitive;
+    const char* primitivePosition{};
+
+    /* First error in the chunk, parsing of the chunk stops there. Because the
+       threads can't print to the shared output, the error is only recorded
+       and printed later in file order. */
+    ParseError error{ParseError::None};
+    const char* errorPosition{};
+    MeshPrimitive errorPrimitive{};
+    const char* errorKeywordBegin{};
+    const char* errorKeywordEnd{};
+};
+
+void parseChunk(const char* lineBegin, const char* const chunkEnd, const Mesh& mesh, const std::size_t meshSize, Chunk& chunk) {
+    /* Reserve the arrays based on counts gathered when opening the file,
+       scaled to the chunk size */
+    const std::size_t chunkSize = chunkEnd - lineBegin;
+    auto estimate = [chunkSize, meshSize](std::size_t count) -> std::size_t {
+        return chunkSize == meshSize ? count : std::size_t(Double(count)*chunkSize/meshSize) + 1;
+    };
+    chunk.positions.reserve(estimate(mesh.positionCount));
+    chunk.positionIndices.reserve(estimate(mesh.indexCount));
+    if(mesh.textureCoordinateCount) {
+        chunk.textureCoordinates.reserve(estimate(mesh.textureCoordinateCount));
+        chunk.textureCoordinateIndices.reserve(estimate(mesh.indexCount));
+    }
+    if(mesh.normalCount) {
+        chunk.normals.reserve(estimate(mesh.normalCount));
+        chunk.normalIndices.reserve(estimate(mesh.indexCount));
+    }
+
+    while(lineBegin != chunkEnd) {
+        const char* const lineEnd = findLineEnd(lineBegin, chunkEnd);
+        const char* const linePosition = lineBegin;
+
+        /* Trim the line */
+        const char* const keywordBegin = skipWhitespace(lineBegin, lineEnd);
+        const char* const contentsEnd = trimWhitespaceBack(keywordBegin, lineEnd);
+        lineBegin = lineEnd == chunkEnd ? chunkEnd : lineEnd + 1;
+
+        /* Ignore empty lines and comments */
+        if(keywordBegin == contentsEnd || *keywordBegin == '#') continue;
+
+        /* Split the line into keyword and contents */
+        const char* const keywordEnd = findWhitespace(keywordBegin, contentsEnd);
+        const char* const contentsBegin = skipWhitespace(keywordEnd, contentsEnd);
+
+        ParseError error = ParseError::None;
+
+        /* Vertex position */
+        if(equals(keywordBegin, keywordEnd, "v")) {
+            Float extra{1.0f};
+            Vector3 position;
+            error = extractFloatData(contentsBegin, contentsEnd, position, &extra);
+            if(error == ParseError::None && !Math::TypeTraits<Float>::equals(extra, 1.0f))
+                error = ParseError::HomogeneousCoordinates;
+            if(error == ParseError::None)
+                chunk.positions.push_back(position);
+
+        /* Texture coordinate */
+        } else if(equals(keywordBegin, keywordEnd, "vt")) {
+            Float extra{0.0f};
+            Vector2 textureCoordinate;
+            error = extractFloatData(contentsBegin, contentsEnd, textureCoordinate, &extra);
+            if(error == ParseError::None && !Math::TypeTraits<Float>::equals(extra, 0.0f))
+                error = ParseError::TextureCoordinates3D;
+            if(error == ParseError::None)
+                chunk.textureCoordinates.push_back(textureCoordinate);
+
+        /* Normal */
+        } else if(equals(keywordBegin, keywordEnd, "vn")) {
+            Vector3 normal;
+            error = extractFloatData(contentsBegin, contentsEnd, normal);
+            if(error == ParseError::None)
+                chunk.normals.push_back(normal);
+
+        /* Indices */
+        } else if(equals(keywordBegin, keywordEnd, "p") ||
+                  equals(keywordBegin, keywordEnd, "l") ||
+                  equals(keywordBegin, keywordEnd, "f")) {
+            const std::size_t indexTupleCount = countTokens(contentsBegin, contentsEnd);
+
+            MeshPrimitive primitive;
+            if(*keywordBegin == 'p') {
+                primitive = MeshPrimitive::Points;
+                if(indexTupleCount != 1)
+                    error = ParseError::WrongPointIndexCount;
+            } else if(*keywordBegin == 'l') {
+                primitive = MeshPrimitive::Lines;
+                if(indexTupleCount != 2)
+                    error = ParseError::WrongLineIndexCount;
+            } else if(*keywordBegin == 'f') {
+                primitive = MeshPrimitive::Triangles;
+                if(indexTupleCount < 3)
+                    error = ParseError::WrongTriangleIndexCount;
+                else if(indexTupleCount != 3)
+                    error = ParseError::Polygons;
+            } else CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+            /* Check that we don't mix the primitives in one mesh. This is
+               checked before the vertex count per primitive. */
+            if(!chunk.primitive) {
+                chunk.primitive = primitive;
+                chunk.primitivePosition = linePosition;
+            } else if(*chunk.primitive != primitive) {
+                error = ParseError::MixedPrimitive;
+                chunk.errorPrimitive = primitive;
+            }
+
+            if(error == ParseError::None) for(const char* tupleBegin = contentsBegin; tupleBegin != contentsEnd; tupleBegin = skipWhitespace(tupleBegin, contentsEnd)) {
+                const char* const tupleEnd = findWhitespace(tupleBegin, contentsEnd);
+
+                /* Split the tuple on slashes, keeping empty parts */
+                const char* parts[3][2];
+                std::size_t partCount = 0;
+                for(const char* partBegin = tupleBegin; ; ++partBegin) {
+                    const char* partEnd = partBegin;
+                    while(partEnd != tupleEnd && *partEnd != '/') ++partEnd;
+
+                    if(partCount == 3) {
+                        error = ParseError::InvalidIndexData;
+                        break;
+                    }
+
+                    parts[partCount][0] = partBegin;
+                    parts[partCount][1] = partEnd;
+                    ++partCount;
+
+                    if(partEnd == tupleEnd) break;
+                    partBegin = partEnd;
+                }
+                if(error != ParseError::None) break;
+
+                UnsignedInt index;
+
+                /* Position indices */
+                if(!parseUnsignedInt(parts[0][0], parts[0][1], index)) {
+                    error = ParseError::NumericConversion;
+                    break;
+                }
+                chunk.positionIndices.push_back(index - mesh.positionIndexOffset);
+
+                /* Texture coordinates */
+                if(partCount == 2 || (partCount == 3 && parts[1][0] != parts[1][1])) {
+                    if(!parseUnsignedInt(parts[1][0], parts[1][1], index)) {
+                        error = ParseError::NumericConversion;
+                        break;
+                    }
+                    chunk.textureCoordinateIndices.push_back(index - mesh.textureCoordinateIndexOffset);
+                }
+
+                /* Normal indices */
+                if(partCount == 3) {
+                    if(!parseUnsignedInt(parts[2][0], parts[2][1], index)) {
+                        error = ParseError::NumericConversion;
+                        break;
+                    }
+                    chunk.normalIndices.push_back(index - mesh.normalIndexOffset);
+                }
+
+                tupleBegin = tupleEnd;
+            }
+
+        /* Ignore unsupported keywords, error out on unknown keywords */
+        } else if(!equals(keywordBegin, keywordEnd, "mtllib") &&
+                  !equals(keywordBegin, keywordEnd, "usemtl") &&
+                  !equals(keywordBegin, keywordEnd, "g") &&
+                  !equals(keywordBegin, keywordEnd, "s")) {
+            error = ParseError::UnknownKeyword;
+            chunk.errorKeywordBegin = keywordBegin;
+            chunk.errorKeywordEnd = keywordEnd;
+        }
+
+        if(error != ParseError::None) {
+            chunk.error = error;
+            chunk.errorPosition = linePosition;
+            return;
+        }
+    }
+}
+
+void printError(const Chunk& chunk) {
+    Error e;
+    e << "Trade::ObjImporter::mesh3D():";
+    switch(chunk.error) {
+        case ParseError::InvalidFloatArraySize:
+            e << "invalid float array size";
+            return;
+        case ParseError::NumericConversion:
+            e << "error while converting numeric data";
+            return;
+        case ParseError::HomogeneousCoordinates:
+            e << "homogeneous coordinates are not supported";
+            return;
+        case ParseError::TextureCoordinates3D:
+            e << "3D texture coordinates are not supported";
+            return;
+        case ParseError::MixedPrimitive:
+            e << "mixed primitive" << *chunk.primitive << "and" << chunk.errorPrimitive;
+            return;
+        case ParseError::WrongPointIndexCount:
+            e << "wrong index count for point";
+            return;
+        case ParseError::WrongLineIndexCount:
+            e << "wrong index count for line";
+            return;
+        case ParseError::WrongTriangleIndexCount:
+            e << "wrong index count for triangle";
+            return;
+        case ParseError::Polygons:
+            e << "polygons are not supported";
+            return;
+        case ParseError::InvalidIndexData:
+            e << "invalid index data";
+            return;
+        case ParseError::UnknownKeyword:
+            e << "unknown keyword" << std::string{chunk.errorKeywordBegin, chunk.errorKeywordEnd};
+            return;
+        case ParseError::None: break;
     }
 
-    return output;
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 }
 
-template<class T> void reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
+template<class T> void append(std::vector<T>& to, std::vector<T>& from) {
+    if(to.empty()) to = std::move(from);
+    else to.insert(to.end(), from.begin(), from.end());
+}
+
+template<class T> bool reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
     /* Check that indices are in range */
     for(UnsignedInt i: indices) if(i >= data.size()) {
         Error() << "Trade::ObjImporter::mesh3D(): index out of range";
-        throw 0;
+        return false;
     }
 
     data = MeshTools::duplicate(indices, data);
+    return true;
 }
 
 }
@@ -101,56 +531,63 @@ void ObjImporter::doClose() { _file.reset(); }
 bool ObjImporter::doIsOpened() const { return !!_file; }
 
 void ObjImporter::doOpenFile(const std::string& filename) {
-    std::unique_ptr<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
+    /* Map the file into memory where possible, so the (potentially huge) file
+       doesn't need to be copied and the OS can page it in on demand */
+    Containers::Optional<Containers::Array<char>> data = mapFile(filename);
+    if(!data) {
         Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
         return;
     }
 
     _file.reset(new File);
-    _file->in = std::move(in);
+    _file->data = std::move(*data);
     parseMeshNames();
 }
 
 void ObjImporter::doOpenData(Containers::ArrayView<const char> data) {
     _file.reset(new File);
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
+    _file->data = Containers::Array<char>{data.size()};
+    std::copy(data.begin(), data.end(), _file->data.begin());
 
     parseMeshNames();
 }
 
 void ObjImporter::parseMeshNames() {
+    const char* const data = _file->data.begin();
+    const char* const dataEnd = _file->data.end();
+
     /* First mesh starts at the beginning, its indices start from 1. The end
        offset will be updated to proper value later. */
     UnsignedInt positionIndexOffset = 1;
     UnsignedInt normalIndexOffset = 1;
     UnsignedInt textureCoordinateIndexOffset = 1;
-    _file->meshes.emplace_back(0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset);
+    _file->meshes.push_back({0, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0, 0});
 
     /* The first mesh doesn't have name by default but we might find it later,
        so we need to track whether there are any data before first name */
     bool thisIsFirstMeshAndItHasNoData = true;
     _file->meshNames.emplace_back();
 
-    while(_file->in->good()) {
+    for(const char* lineBegin = data; lineBegin != dataEnd; ) {
+        const char* const lineEnd = findLineEnd(lineBegin, dataEnd);
+        const char* const nextLine = lineEnd == dataEnd ? dataEnd : lineEnd + 1;
+
         /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
+        const std::size_t end = lineBegin - data;
 
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
+        /* Skip empty lines and comments */
+        const char* const keywordBegin = skipWhitespace(lineBegin, lineEnd);
+        lineBegin = nextLine;
+        if(keywordBegin == lineEnd || *keywordBegin == '#') continue;
 
         /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
+        const char* const keywordEnd = findWhitespace(keywordBegin, lineEnd);
+        Mesh& mesh = _file->meshes.back();
 
         /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
+        if(equals(keywordBegin, keywordEnd, "o")) {
+            const char* const nameBegin = skipWhitespace(keywordEnd, lineEnd);
+            std::string name{nameBegin, trimWhitespaceBack(nameBegin, lineEnd)};
 
             /* This is the name of first mesh */
             if(thisIsFirstMeshAndItHasNoData) {
@@ -162,54 +599,54 @@ void ObjImporter::parseMeshNames() {
                 _file->meshNames.back() = std::move(name);
 
                 /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+                mesh.begin = nextLine - data;
 
             /* Otherwise this is a name of new mesh */
             } else {
                 /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
+                mesh.end = end;
 
                 /* Save name and offset of the new one. The end offset will be
                    updated later. */
                 if(!name.empty())
                     _file->meshesForName.emplace(name, _file->meshes.size());
                 _file->meshNames.emplace_back(std::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+                _file->meshes.push_back({std::size_t(nextLine - data), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0, 0});
             }
 
-            continue;
-
         /* If there are any data/indices before the first name, it means that
            the first object is unnamed. We need to check for them. */
 
         /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
+        } else if(equals(keywordBegin, keywordEnd, "v")) {
             ++positionIndexOffset;
+            ++mesh.positionCount;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
+        } else if(equals(keywordBegin, keywordEnd, "vt")) {
             ++textureCoordinateIndexOffset;
+            ++mesh.textureCoordinateCount;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
+        } else if(equals(keywordBegin, keywordEnd, "vn")) {
             ++normalIndexOffset;
+            ++mesh.normalCount;
             thisIsFirstMeshAndItHasNoData = false;
 
-        /* Index data, just mark that we found something for first unnamed
-           object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string& data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
-            }
+        /* Index data, mark that we found something for first unnamed object
+           and estimate the index count */
+        } else if(equals(keywordBegin, keywordEnd, "p")) {
+            mesh.indexCount += 1;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(equals(keywordBegin, keywordEnd, "l")) {
+            mesh.indexCount += 2;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(equals(keywordBegin, keywordEnd, "f")) {
+            mesh.indexCount += 3;
+            thisIsFirstMeshAndItHasNoData = false;
         }
-
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
     }
 
     /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
+    _file->meshes.back().end = _file->data.size();
 }
 
 UnsignedInt ObjImporter::doMesh3DCount() const { return _file->meshes.size(); }
@@ -224,12 +661,38 @@ std::string ObjImporter::doMesh3DName(UnsignedInt id) {
 }
 
 Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
-    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
-    std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
+    /* Find the mesh in the data */
+    const Mesh& mesh = _file->meshes[id];
+    const char* const meshBegin = _file->data.begin() + mesh.begin;
+    const char* const meshEnd = _file->data.begin() + mesh.end;
+    const std::size_t meshSize = mesh.end - mesh.begin;
+
+    /* Split the mesh into newline-aligned chunks, if it's large enough. Some
+       chunks may end up empty for meshes with very long lines, that's not a
+       problem. */
+    std::size_t chunkCount = 1;
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(_threadCount > 1 && meshSize >= ParallelThreshold)
+        chunkCount = _threadCount*ParallelChunksPerThread;
+    #endif
+    std::vector<const char*> chunkBoundaries;
+    chunkBoundaries.reserve(chunkCount + 1);
+    chunkBoundaries.push_back(meshBegin);
+    for(std::size_t i = 1; i < chunkCount; ++i) {
+        const char* boundary = std::max(meshBegin + meshSize*i/chunkCount, chunkBoundaries.back());
+        boundary = findLineEnd(boundary, meshEnd);
+        if(boundary != meshEnd) ++boundary;
+        chunkBoundaries.push_back(boundary);
+    }
+    chunkBoundaries.push_back(meshEnd);
+
+    /* Parse the chunks */
+    std::vector<Chunk> chunks(chunkCount);
+    Magnum::Implementation::parallelFor(_threadCount, chunkCount, [&](std::size_t i) {
+        parseChunk(chunkBoundaries[i], chunkBoundaries[i + 1], mesh, meshSize, chunks[i]);
+    });
 
+    /* Merge the chunks in file order, printing the first error, if any */
     Containers::Optional<MeshPrimitive> primitive;
     std::vector<Vector3> positions;
     std::vector<std::vector<Vector2>> textureCoordinates;
@@ -237,150 +700,35 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
     std::vector<UnsignedInt> positionIndices;
     std::vector<UnsignedInt> textureCoordinateIndices;
     std::vector<UnsignedInt> normalIndices;
-
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
+    std::vector<Vector2> textureCoordinateArray;
+    std::vector<Vector3> normalArray;
+    for(Chunk& chunk: chunks) {
+        /* Check that we don't mix the primitives in one mesh, unless the
+           chunk has an error before its first index data */
+        if(primitive && chunk.primitive && *primitive != *chunk.primitive &&
+           (chunk.error == ParseError::None || chunk.primitivePosition <= chunk.errorPosition)) {
+            Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << *chunk.primitive;
+            return Containers::NullOpt;
         }
 
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
-
-        /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
-
-        /* Vertex position */
-        if(keyword == "v") {
-            Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
-            if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
-                Error() << "Trade::ObjImporter::mesh3D(): homogeneous coordinates are not supported";
-                return Containers::NullOpt;
-            }
-
-            positions.push_back(data);
-
-        /* Texture coordinate */
-        } else if(keyword == "vt") {
-            Float extra{0.0f};
-            const auto data = extractFloatData<2>(contents, &extra);
-            if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
-                Error() << "Trade::ObjImporter::mesh3D(): 3D texture coordinates are not supported";
-                return Containers::NullOpt;
-            }
-
-            if(textureCoordinates.empty()) textureCoordinates.emplace_back();
-            textureCoordinates.front().emplace_back(data);
-
-        /* Normal */
-        } else if(keyword == "vn") {
-            if(normals.empty()) normals.emplace_back();
-            normals.front().emplace_back(extractFloatData<3>(contents));
-
-        /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
-
-            /* Points */
-            if(keyword == "p") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Points) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return Containers::NullOpt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for point";
-                    return Containers::NullOpt;
-                }
-
-                primitive = MeshPrimitive::Points;
-
-            /* Lines */
-            } else if(keyword == "l") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Lines) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return Containers::NullOpt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for line";
-                    return Containers::NullOpt;
-                }
-
-                primitive = MeshPrimitive::Lines;
-
-            /* Faces */
-            } else if(keyword == "f") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Triangles) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return Containers::NullOpt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for triangle";
-                    return Containers::NullOpt;
-                } else if(indexTuples.size() != 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): polygons are not supported";
-                    return Containers::NullOpt;
-                }
-
-                primitive = MeshPrimitive::Triangles;
-
-            } else CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
-
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indices = Utility::String::split(indexTuple, '/');
-                if(indices.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): invalid index data";
-                    return Containers::NullOpt;
-                }
-
-                /* Position indices */
-                positionIndices.push_back(std::stoul(indices[0]) - positionIndexOffset);
-
-                /* Texture coordinates */
-                if(indices.size() == 2 || (indices.size() == 3 && !indices[1].empty()))
-                    textureCoordinateIndices.push_back(std::stoul(indices[1]) - textureCoordinateIndexOffset);
-
-                /* Normal indices */
-                if(indices.size() == 3)
-                    normalIndices.push_back(std::stoul(indices[2]) - normalIndexOffset);
-            }
-
-        /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
-            return false;
-        }()) {
-            Error() << "Trade::ObjImporter::mesh3D(): unknown keyword" << keyword;
+        if(chunk.error != ParseError::None) {
+            printError(chunk);
             return Containers::NullOpt;
         }
 
-    }} catch(const std::exception&) {
-        Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
-        return Containers::NullOpt;
-    } catch(...) {
-        /* Error message already printed */
-        return Containers::NullOpt;
+        if(!primitive) primitive = chunk.primitive;
+
+        append(positions, chunk.positions);
+        append(textureCoordinateArray, chunk.textureCoordinates);
+        append(normalArray, chunk.normals);
+        append(positionIndices, chunk.positionIndices);
+        append(textureCoordinateIndices, chunk.textureCoordinateIndices);
+        append(normalIndices, chunk.normalIndices);
     }
+    if(!textureCoordinateArray.empty())
+        textureCoordinates.push_back(std::move(textureCoordinateArray));
+    if(!normalArray.empty())
+        normals.push_back(std::move(normalArray));
 
     /* There should be at least indexed position data */
     if(positions.empty() || positionIndices.empty()) {
@@ -421,14 +769,10 @@ Containers::Optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
         indices = MeshTools::combineIndexArrays(arrays);
 
         /* Reindex data arrays */
-        try {
-            reindex(positionIndices, positions);
-            if(!normalIndices.empty()) reindex(normalIndices, normals.front());
-            if(!textureCoordinateIndices.empty()) reindex(textureCoordinateIndices, textureCoordinates.front());
-        } catch(...) {
-            /* Error message already printed */
+        if(!reindex(positionIndices, positions) ||
+           (!normalIndices.empty() && !reindex(normalIndices, normals.front())) ||
+           (!textureCoordinateIndices.empty() && !reindex(textureCoordinateIndices, textureCoordinates.front())))
             return Containers::NullOpt;
-        }
 
     /* Otherwise just use the original position index array. Don't forget to
        check range */
@@ -72,6 +72,28 @@ for more information.
 
 Polygons (quads etc.), automatic normal generation and material properties are
 currently not supported.
+
+Files opened with @ref openFile() are memory-mapped using @ref mapFile() and
+parsed directly from the mapped memory. Data passed to @ref openData() are
+copied.
+
+@section Trade-ObjImporter-multithreading Multithreaded parsing
+
+Large meshes can be parsed on multiple threads using @ref setThreadCount(). In
+that case the mesh is split into newline-aligned chunks that are parsed
+independently on workers of @ref globalJobExecutor() and then concatenated in
+file order. As the OBJ indices are global for the whole file, the per-mesh
+index offsets gathered when opening the file apply to all chunks equally.
+Errors are reported the same as with single-threaded parsing.
+
+@code{.cpp}
+importer.setThreadCount(std::thread::hardware_concurrency());
+@endcode
+
+If the mesh is smaller than one megabyte, it's always parsed on the calling
+thread only, as the overhead would outweigh the gains. Multithreaded parsing is
+not available on @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where
+@ref setThreadCount() is ignored.
 */
 class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
     public:
@@ -83,6 +105,27 @@ class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
 
         ~ObjImporter();
 
+        /**
+         * @brief Thread count used for parsing
+         *
+         * Default is @cpp 1 @ce, meaning the parsing is done only on the
+         * calling thread.
+         */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count used for parsing
+         * @return Reference to self (for method chaining)
+         *
+         * The calling thread is counted as well. Value of @cpp 0 @ce is
+         * treated the same as @cpp 1 @ce. See
+         * @ref Trade-ObjImporter-multithreading for more information.
+         */
+        ObjImporter& setThreadCount(UnsignedInt count) {
+            _threadCount = count ? count : 1;
+            return *this;
+        }
+
     private:
         struct File;
 
@@ -101,6 +144,7 @@ class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
         MAGNUM_OBJIMPORTER_LOCAL void parseMeshNames();
 
         std::unique_ptr<File> _file;
+        UnsignedInt _threadCount{1};
 };
 
 }}
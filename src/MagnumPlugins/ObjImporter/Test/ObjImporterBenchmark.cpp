@@ -0,0 +1,171 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+/* The generated files are a few MB in size, their sizes are printed on
+   startup so the throughput can be calculated from the reported times */
+struct ObjImporterBenchmark: TestSuite::Tester {
+    explicit ObjImporterBenchmark();
+
+    void openDataPositions();
+    void openDataAllAttributes();
+    void openFileAllAttributes();
+    void openDataManyObjects();
+
+    private:
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+        std::string _positions, _allAttributes, _manyObjects;
+        std::string _allAttributesFilename;
+};
+
+namespace {
+    /* Grid of Size*Size vertices, (Size - 1)^2*2 triangles */
+    enum: std::size_t { Size = 256, ObjectCount = 1024 };
+
+    std::string grid(bool allAttributes) {
+        std::ostringstream out;
+        for(std::size_t y = 0; y != Size; ++y) for(std::size_t x = 0; x != Size; ++x)
+            out << "v " << x*0.125f << " " << y*0.125f << " " << (x ^ y)*0.0625f << "\n";
+        if(allAttributes) {
+            for(std::size_t y = 0; y != Size; ++y) for(std::size_t x = 0; x != Size; ++x)
+                out << "vt " << x/Float(Size - 1) << " " << y/Float(Size - 1) << "\n";
+            for(std::size_t i = 0; i != Size*Size; ++i)
+                out << "vn 0 0 1\n";
+        }
+
+        for(std::size_t y = 0; y != Size - 1; ++y) for(std::size_t x = 0; x != Size - 1; ++x) {
+            /* OBJ indices are one-based */
+            const std::size_t a = y*Size + x + 1;
+            const std::size_t b = a + 1;
+            const std::size_t c = a + Size;
+            const std::size_t d = c + 1;
+            if(allAttributes) {
+                out << "f " << a << "/" << a << "/" << a << " " << b << "/" << b << "/" << b << " " << d << "/" << d << "/" << d << "\n";
+                out << "f " << a << "/" << a << "/" << a << " " << d << "/" << d << "/" << d << " " << c << "/" << c << "/" << c << "\n";
+            } else {
+                out << "f " << a << " " << b << " " << d << "\n";
+                out << "f " << a << " " << d << " " << c << "\n";
+            }
+        }
+        return out.str();
+    }
+
+    std::string manyObjects() {
+        std::ostringstream out;
+        for(std::size_t i = 0; i != ObjectCount; ++i) {
+            out << "o object" << i << "\n";
+            out << "v " << i << " 0 0\nv " << i << " 1 0\nv " << i << " 0 1\n";
+            out << "f " << i*3 + 1 << " " << i*3 + 2 << " " << i*3 + 3 << "\n";
+        }
+        return out.str();
+    }
+}
+
+ObjImporterBenchmark::ObjImporterBenchmark() {
+    addBenchmarks({&ObjImporterBenchmark::openDataPositions,
+                   &ObjImporterBenchmark::openDataAllAttributes,
+                   &ObjImporterBenchmark::openFileAllAttributes,
+                   &ObjImporterBenchmark::openDataManyObjects}, 5);
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef OBJIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    _positions = grid(false);
+    _allAttributes = grid(true);
+    _manyObjects = manyObjects();
+    Debug{} << "Grid with positions:" << _positions.size()/1024 << "kB, with all attributes:" << _allAttributes.size()/1024 << "kB," << ObjectCount << "objects:" << _manyObjects.size()/1024 << "kB";
+
+    _allAttributesFilename = Utility::Directory::join(OBJIMPORTER_WRITE_DIR, "benchmark.obj");
+    Utility::Directory::mkpath(OBJIMPORTER_WRITE_DIR);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Directory::write(_allAttributesFilename, Containers::ArrayView<const void>{_allAttributes.data(), _allAttributes.size()}));
+}
+
+void ObjImporterBenchmark::openDataPositions() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openData({_positions.data(), _positions.size()});
+        count += importer->mesh3D(0)->indices().size();
+    }
+
+    CORRADE_COMPARE(count, (Size - 1)*(Size - 1)*6);
+}
+
+void ObjImporterBenchmark::openDataAllAttributes() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openData({_allAttributes.data(), _allAttributes.size()});
+        count += importer->mesh3D(0)->indices().size();
+    }
+
+    CORRADE_COMPARE(count, (Size - 1)*(Size - 1)*6);
+}
+
+void ObjImporterBenchmark::openFileAllAttributes() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openFile(_allAttributesFilename);
+        count += importer->mesh3D(0)->indices().size();
+    }
+
+    CORRADE_COMPARE(count, (Size - 1)*(Size - 1)*6);
+}
+
+void ObjImporterBenchmark::openDataManyObjects() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openData({_manyObjects.data(), _manyObjects.size()});
+        for(UnsignedInt i = 0; i != importer->mesh3DCount(); ++i)
+            count += importer->mesh3D(i)->positions(0).size();
+    }
+
+    CORRADE_COMPARE(count, ObjectCount*3);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterBenchmark)
@@ -31,6 +31,7 @@
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/ObjImporter/ObjImporter.h"
 
 #include "configure.h"
 
@@ -89,6 +90,9 @@ struct ObjImporterTest: TestSuite::Tester {
     void unsupportedKeyword();
     void unknownKeyword();
 
+    void multithreaded();
+    void multithreadedError();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -141,7 +145,10 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::wrongNormalIndexCount,
 
               &ObjImporterTest::unsupportedKeyword,
-              &ObjImporterTest::unknownKeyword});
+              &ObjImporterTest::unknownKeyword,
+
+              &ObjImporterTest::multithreaded,
+              &ObjImporterTest::multithreadedError});
 
     #ifdef OBJIMPORTER_PLUGIN_FILENAME
     CORRADE_INTERNAL_ASSERT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
@@ -738,6 +745,66 @@ void ObjImporterTest::unknownKeyword() {
     CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): unknown keyword bleh\n");
 }
 
+
+namespace {
+
+/* Generates a mesh that's large enough to be parsed in parallel */
+std::string largeMesh(const std::string& insertAtHalf = {}, const std::string& insertAtEnd = {}) {
+    std::ostringstream out;
+    out << "o LargeMesh\n";
+    for(Int i = 0; i != 20000; ++i) {
+        out << "v " << Float(i)*0.25f << " " << Float(i % 7) << " " << -Float(i)*0.125f << "\n";
+        out << "vn 0 " << Float(i % 2) << " 1\n";
+    }
+    for(Int i = 0; i != 20000; ++i) {
+        if(i == 10000) out << insertAtHalf;
+        out << "f " << i + 1 << "//" << (i*3 % 20000) + 1 << " "
+            << (i*7 % 20000) + 1 << "//" << (i % 20000) + 1 << " "
+            << (i*13 % 20000) + 1 << "//" << (i*5 % 20000) + 1 << "\n";
+    }
+    out << insertAtEnd;
+    return out.str();
+}
+
+}
+
+void ObjImporterTest::multithreaded() {
+    const std::string data = largeMesh();
+    CORRADE_VERIFY(data.size() > 1024*1024);
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData({data.data(), data.size()}));
+    const Containers::Optional<MeshData3D> expected = importer->mesh3D(0);
+    CORRADE_VERIFY(expected);
+
+    CORRADE_COMPARE(static_cast<ObjImporter&>(*importer).threadCount(), 1);
+    static_cast<ObjImporter&>(*importer).setThreadCount(4);
+    CORRADE_COMPARE(static_cast<ObjImporter&>(*importer).threadCount(), 4);
+
+    const Containers::Optional<MeshData3D> actual = importer->mesh3D(0);
+    CORRADE_VERIFY(actual);
+    CORRADE_COMPARE(actual->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(actual->indices().size(), 60000);
+    CORRADE_COMPARE(actual->indices(), expected->indices());
+    CORRADE_COMPARE(actual->positions(0), expected->positions(0));
+    CORRADE_COMPARE(actual->normals(0), expected->normals(0));
+}
+
+void ObjImporterTest::multithreadedError() {
+    /* The first error in file order should be reported, independently of
+       which chunk finished parsing first */
+    const std::string data = largeMesh("l 1 2\n", "bleh\n");
+
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData({data.data(), data.size()}));
+    static_cast<ObjImporter&>(*importer).setThreadCount(4);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh3D(0));
+    CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): mixed primitive MeshPrimitive::Triangles and MeshPrimitive::Lines\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterTest)
@@ -25,3 +25,4 @@
 
 #cmakedefine OBJIMPORTER_PLUGIN_FILENAME "${OBJIMPORTER_PLUGIN_FILENAME}"
 #define OBJIMPORTER_TEST_DIR "${OBJIMPORTER_TEST_DIR}"
+#define OBJIMPORTER_WRITE_DIR "${OBJIMPORTER_WRITE_DIR}"
@@ -24,6 +24,7 @@
 */
 
 #include <sstream>
+#include <string>
 #include <tuple>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -35,6 +36,7 @@
 #include "Magnum/Trade/ImageData.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "MagnumPlugins/TgaImageConverter/TgaImageConverter.h"
 
 #include "configure.h"
 
@@ -47,6 +49,13 @@ struct TgaImageConverterTest: TestSuite::Tester {
 
     void rgb();
     void rgba();
+    void rgbRle();
+    void grayscaleRle();
+
+    void sinkWrongFormat();
+    void sink();
+    void sinkAbort();
+    void multithreaded();
 
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImageConverter> _converterManager{"nonexistent"};
@@ -78,13 +87,51 @@ namespace {
         5, 6, 7, 8, 6, 7, 8, 9
     };
     const ImageView2D OriginalRGBA{PixelFormat::RGBA8Unorm, {2, 3}, OriginalDataRGBA};
+
+    struct Chunks {
+        std::string data;
+        std::size_t count;
+    };
+
+    bool appendChunk(const Containers::ArrayView<const char> data, void* const userData) {
+        auto& chunks = *static_cast<Chunks*>(userData);
+        chunks.data.append(data.data(), data.size());
+        ++chunks.count;
+        return true;
+    }
+
+    constexpr struct {
+        const char* name;
+        bool rle;
+    } MultithreadedData[]{
+        {"uncompressed", false},
+        {"RLE", true}
+    };
+
+    /* A RGBA image of over 2 MB, exported in three chunks of 256 rows, with
+       both repeated and random-ish pixels */
+    Containers::Array<char> largeImageData() {
+        Containers::Array<char> data{1024*600*4};
+        for(std::size_t i = 0; i != data.size(); ++i)
+            data[i] = i % 4096 < 2048 ? char(i/4096) : char(i*7919 >> 3);
+        return data;
+    }
 }
 
 TgaImageConverterTest::TgaImageConverterTest() {
     addTests({&TgaImageConverterTest::wrongFormat,
 
               &TgaImageConverterTest::rgb,
-              &TgaImageConverterTest::rgba});
+              &TgaImageConverterTest::rgba,
+              &TgaImageConverterTest::rgbRle,
+              &TgaImageConverterTest::grayscaleRle,
+
+              &TgaImageConverterTest::sinkWrongFormat,
+              &TgaImageConverterTest::sink,
+              &TgaImageConverterTest::sinkAbort});
+
+    addInstancedTests({&TgaImageConverterTest::multithreaded},
+        Containers::arraySize(MultithreadedData));
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
@@ -149,6 +196,153 @@ void TgaImageConverterTest::rgba() {
         TestSuite::Compare::Container);
 }
 
+void TgaImageConverterTest::rgbRle() {
+    const char original[] = {
+        1, 2, 3, 1, 2, 3, 1, 2, 3,
+        4, 5, 6, 7, 8, 9, 7, 8, 9
+    };
+    const ImageView2D image{PixelStorage{}.setAlignment(1),
+        PixelFormat::RGB8Unorm, {3, 2}, original};
+
+    std::unique_ptr<AbstractImageConverter> converter = _converterManager.instantiate("TgaImageConverter");
+    CORRADE_VERIFY(!static_cast<TgaImageConverter&>(*converter).rleCompression());
+    static_cast<TgaImageConverter&>(*converter).setRleCompression(true);
+    const auto data = converter->exportToData(image);
+    CORRADE_VERIFY(data);
+
+    /* One run packet for the first row, a raw and a run packet for the
+       second, never crossing the rows */
+    const char expected[] = {
+        char(0x82), 3, 2, 1,
+        0x00, 6, 5, 4,
+        char(0x81), 9, 8, 7
+    };
+    CORRADE_COMPARE(data.size(), 18 + sizeof(expected));
+    CORRADE_COMPARE(Int(data[2]), 10);
+    CORRADE_COMPARE_AS(data.suffix(18), Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+
+    if(!(_importerManager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, can't test the result");
+
+    std::unique_ptr<AbstractImporter> importer = _importerManager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openData(data));
+    Containers::Optional<Trade::ImageData2D> converted = importer->image2D(0);
+    CORRADE_VERIFY(converted);
+
+    CORRADE_COMPARE(converted->size(), Vector2i(3, 2));
+    CORRADE_COMPARE(converted->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE_AS(converted->data(), Containers::arrayView(original),
+        TestSuite::Compare::Container);
+}
+
+void TgaImageConverterTest::grayscaleRle() {
+    /* Longer than the maximal packet length */
+    char original[300];
+    for(std::size_t i = 0; i != 300; ++i) original[i] = i < 200 ? 7 : char(i);
+    const ImageView2D image{PixelStorage{}.setAlignment(1),
+        PixelFormat::R8Unorm, {300, 1}, original};
+
+    std::unique_ptr<AbstractImageConverter> converter = _converterManager.instantiate("TgaImageConverter");
+    static_cast<TgaImageConverter&>(*converter).setRleCompression(true);
+    const auto data = converter->exportToData(image);
+    CORRADE_VERIFY(data);
+
+    /* Two run packets (128 + 72 pixels) and one raw packet (100 pixels) */
+    CORRADE_COMPARE(data.size(), 18 + 2 + 2 + 1 + 100);
+    CORRADE_COMPARE(Int(data[2]), 11);
+
+    if(!(_importerManager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, can't test the result");
+
+    std::unique_ptr<AbstractImporter> importer = _importerManager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openData(data));
+    Containers::Optional<Trade::ImageData2D> converted = importer->image2D(0);
+    CORRADE_VERIFY(converted);
+
+    CORRADE_COMPARE(converted->size(), Vector2i(300, 1));
+    CORRADE_COMPARE(converted->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE_AS(converted->data(), Containers::arrayView(original),
+        TestSuite::Compare::Container);
+}
+
+void TgaImageConverterTest::sinkWrongFormat() {
+    ImageView2D image{PixelFormat::RG8Unorm, {}, nullptr};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::unique_ptr<AbstractImageConverter> converter = _converterManager.instantiate("TgaImageConverter");
+    Chunks chunks{};
+    CORRADE_VERIFY(!converter->exportToSink(image, appendChunk, &chunks));
+    CORRADE_COMPARE(chunks.count, 0);
+    CORRADE_COMPARE(out.str(), "Trade::TgaImageConverter::exportToSink(): unsupported pixel format PixelFormat::RG8Unorm\n");
+}
+
+void TgaImageConverterTest::sink() {
+    std::unique_ptr<AbstractImageConverter> converter = _converterManager.instantiate("TgaImageConverter");
+    CORRADE_VERIFY(converter->features() & AbstractImageConverter::Feature::ConvertStream);
+
+    const auto data = converter->exportToData(OriginalRGB);
+    CORRADE_VERIFY(data);
+
+    /* Header and a single chunk with all rows, same as exported to data */
+    Chunks chunks{};
+    CORRADE_VERIFY(converter->exportToSink(OriginalRGB, appendChunk, &chunks));
+    CORRADE_COMPARE(chunks.count, 2);
+    CORRADE_COMPARE(chunks.data, (std::string{data.data(), data.size()}));
+}
+
+void TgaImageConverterTest::sinkAbort() {
+    std::unique_ptr<AbstractImageConverter> converter = _converterManager.instantiate("TgaImageConverter");
+
+    /* Aborting after the header, the data are not written anymore */
+    std::size_t count = 0;
+    CORRADE_VERIFY(!converter->exportToSink(OriginalRGB, [](Containers::ArrayView<const char>, void* userData) {
+        ++*static_cast<std::size_t*>(userData);
+        return false;
+    }, &count));
+    CORRADE_COMPARE(count, 1);
+}
+
+void TgaImageConverterTest::multithreaded() {
+    auto&& data = MultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> original = largeImageData();
+    const ImageView2D image{PixelFormat::RGBA8Unorm, {1024, 600}, Containers::arrayView(original)};
+
+    std::unique_ptr<AbstractImageConverter> converter = _converterManager.instantiate("TgaImageConverter");
+    static_cast<TgaImageConverter&>(*converter).setRleCompression(data.rle);
+    CORRADE_COMPARE(static_cast<TgaImageConverter&>(*converter).threadCount(), 1);
+    Chunks single{};
+    CORRADE_VERIFY(converter->exportToSink(image, appendChunk, &single));
+    CORRADE_COMPARE(single.count, 4);
+
+    /* The output should be the same regardless of the thread count and
+       the way it's exported */
+    static_cast<TgaImageConverter&>(*converter).setThreadCount(4);
+    Chunks multi{};
+    CORRADE_VERIFY(converter->exportToSink(image, appendChunk, &multi));
+    CORRADE_COMPARE(multi.count, 4);
+    CORRADE_VERIFY(multi.data == single.data);
+
+    const auto exported = converter->exportToData(image);
+    CORRADE_VERIFY(std::string(exported.data(), exported.size()) == single.data);
+
+    if(!(_importerManager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, can't test the result");
+
+    std::unique_ptr<AbstractImporter> importer = _importerManager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openData(exported));
+    Containers::Optional<Trade::ImageData2D> converted = importer->image2D(0);
+    CORRADE_VERIFY(converted);
+
+    CORRADE_COMPARE(converted->size(), Vector2i(1024, 600));
+    CORRADE_COMPARE_AS(converted->data(), original,
+        TestSuite::Compare::Container);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImageConverterTest)
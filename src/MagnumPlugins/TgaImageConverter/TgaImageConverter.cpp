@@ -26,70 +26,177 @@
 #include "TgaImageConverter.h"
 
 #include <algorithm>
-#include <fstream>
+#include <cstring>
 #include <tuple>
+#include <vector>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Endianness.h>
 
 #include "Magnum/Image.h"
+#include "Magnum/PixelConversion.h"
 #include "Magnum/PixelFormat.h"
-#include "Magnum/Math/Swizzle.h"
-#include "Magnum/Math/Vector4.h"
+#include "Magnum/Implementation/parallelFor.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
 namespace Magnum { namespace Trade {
 
+namespace {
+
+/* TGA image type for given format, 0 if not supported */
+UnsignedByte imageType(const PixelFormat format) {
+    switch(format) {
+        case PixelFormat::RGB8Unorm:
+        case PixelFormat::RGBA8Unorm:
+            return 2;
+        case PixelFormat::R8Unorm:
+            return 3;
+        default: return 0;
+    }
+}
+
+/* Output is passed to the sink in chunks of whole rows of roughly this size */
+constexpr std::size_t ChunkSize = 1 << 20;
+
+/* Compresses a single row of pixels, returns pointer after the last written
+   byte. Each packet covers at least one pixel, so the output is never larger
+   than one byte per pixel plus the pixel data. */
+char* encodeRleRow(const char* const in, const std::size_t width, const std::size_t pixelSize, char* out) {
+    const auto same = [in, pixelSize](std::size_t a, std::size_t b) {
+        return std::memcmp(in + a*pixelSize, in + b*pixelSize, pixelSize) == 0;
+    };
+
+    std::size_t i = 0;
+    while(i != width) {
+        /* Run packet, if at least two consecutive pixels are the same */
+        std::size_t run = 1;
+        while(i + run != width && run != 128 && same(i, i + run)) ++run;
+        if(run > 1) {
+            *out++ = char(0x80|(run - 1));
+            std::memcpy(out, in + i*pixelSize, pixelSize);
+            out += pixelSize;
+            i += run;
+            continue;
+        }
+
+        /* Raw packet until the next run starts */
+        const std::size_t begin = i++;
+        while(i != width && i - begin != 128 && !(i + 1 != width && same(i, i + 1))) ++i;
+        const std::size_t count = i - begin;
+        *out++ = char(count - 1);
+        std::memcpy(out, in + begin*pixelSize, count*pixelSize);
+        out += count*pixelSize;
+    }
+
+    return out;
+}
+
+}
+
 TgaImageConverter::TgaImageConverter() = default;
 
 TgaImageConverter::TgaImageConverter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImageConverter{manager, plugin} {}
 
-auto TgaImageConverter::doFeatures() const -> Features { return Feature::ConvertData; }
+auto TgaImageConverter::doFeatures() const -> Features { return Feature::ConvertData|Feature::ConvertStream; }
 
 Containers::Array<char> TgaImageConverter::doExportToData(const ImageView2D& image) {
-    /* Initialize data buffer */
-    const auto pixelSize = UnsignedByte(image.pixelSize());
-    Containers::Array<char> data{Containers::ValueInit, sizeof(Implementation::TgaHeader) + pixelSize*image.size().product()};
+    if(!imageType(image.format())) {
+        Error() << "Trade::TgaImageConverter::exportToData(): unsupported pixel format" << image.format();
+        return nullptr;
+    }
 
-    /* Fill header */
-    auto header = reinterpret_cast<Implementation::TgaHeader*>(data.begin());
-    switch(image.format()) {
-        case PixelFormat::RGB8Unorm:
-        case PixelFormat::RGBA8Unorm:
-            header->imageType = 2;
-            break;
-        case PixelFormat::R8Unorm:
-            header->imageType = 3;
-            break;
-        default:
-            Error() << "Trade::TgaImageConverter::exportToData(): unsupported pixel format" << image.format();
-            return nullptr;
+    /* Stream into a worst-case-sized buffer, which is the exact size for
+       uncompressed output */
+    const std::size_t pixelSize = image.pixelSize();
+    const std::size_t rowSize = image.size().x()*pixelSize;
+    Containers::Array<char> data{sizeof(Implementation::TgaHeader) + image.size().y()*(rowSize + (_rleCompression ? image.size().x() : 0))};
+    std::pair<Containers::Array<char>&, std::size_t> state{data, 0};
+    exportInternal(image, [](const Containers::ArrayView<const char> chunk, void* const userData) {
+        auto& state = *static_cast<std::pair<Containers::Array<char>&, std::size_t>*>(userData);
+        std::copy_n(chunk.begin(), chunk.size(), state.first.begin() + state.second);
+        state.second += chunk.size();
+        return true;
+    }, &state);
+
+    if(state.second == data.size()) return data;
+
+    /* Copy to an array of the final size */
+    Containers::Array<char> result{state.second};
+    std::copy_n(data.begin(), result.size(), result.begin());
+    return result;
+}
+
+bool TgaImageConverter::doExportToSink(const ImageView2D& image, bool(*const sink)(Containers::ArrayView<const char>, void*), void* const userData) {
+    if(!imageType(image.format())) {
+        Error() << "Trade::TgaImageConverter::exportToSink(): unsupported pixel format" << image.format();
+        return false;
     }
-    header->bpp = pixelSize*8;
-    header->width = UnsignedShort(Utility::Endianness::littleEndian(image.size().x()));
-    header->height = UnsignedShort(Utility::Endianness::littleEndian(image.size().y()));
+
+    return exportInternal(image, sink, userData);
+}
+
+bool TgaImageConverter::exportInternal(const ImageView2D& image, bool(*const sink)(Containers::ArrayView<const char>, void*), void* const userData) {
+    /* Fill header, the RLE variants of the image types differ only in the
+       fourth bit */
+    const auto pixelSize = UnsignedByte(image.pixelSize());
+    Implementation::TgaHeader header{};
+    header.imageType = UnsignedByte(imageType(image.format())|(_rleCompression ? 8 : 0));
+    header.bpp = pixelSize*8;
+    header.width = UnsignedShort(Utility::Endianness::littleEndian(image.size().x()));
+    header.height = UnsignedShort(Utility::Endianness::littleEndian(image.size().y()));
+    if(!sink({reinterpret_cast<const char*>(&header), sizeof(header)}, userData))
+        return false;
 
     /* Image data pointer including skip */
     const char* imageData = image.data() + std::get<0>(image.dataProperties()).sum();
-
-    /* Fill data or copy them row by row if we need to drop the padding */
     const std::size_t rowSize = image.size().x()*pixelSize;
     const std::size_t rowStride = std::get<1>(image.dataProperties()).x();
-    if(rowStride != rowSize) {
-        for(std::int_fast32_t y = 0; y != image.size().y(); ++y)
-            std::copy_n(imageData + y*rowStride, rowSize, data.begin() + sizeof(Implementation::TgaHeader) + y*rowSize);
-    } else std::copy_n(imageData, pixelSize*image.size().product(), data.begin() + sizeof(Implementation::TgaHeader));
-
-    if(image.format() == PixelFormat::RGB8Unorm) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data.begin()+sizeof(Implementation::TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(image.format() == PixelFormat::RGBA8Unorm) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data.begin()+sizeof(Implementation::TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
+    if(!rowSize) return true;
+
+    /* Worst-case size of a RLE-compressed row, each packet covers at least one
+       pixel */
+    const std::size_t compressedRowSize = rowSize + image.size().x();
+
+    /* Process the image in chunks of whole rows to avoid having the whole
+       output in memory, rows in a chunk are converted in parallel */
+    const std::size_t chunkRowCount = std::max(std::size_t{1}, ChunkSize/rowSize);
+    const std::size_t height = image.size().y();
+    Containers::Array<char> rows{std::min(chunkRowCount, height)*rowSize};
+    Containers::Array<char> compressed{_rleCompression ? std::min(chunkRowCount, height)*compressedRowSize : 0};
+    Containers::Array<std::size_t> compressedRowEnds{_rleCompression ? std::min(chunkRowCount, height) : 0};
+    for(std::size_t chunkBegin = 0; chunkBegin < height; chunkBegin += chunkRowCount) {
+        const std::size_t rowCount = std::min(chunkRowCount, height - chunkBegin);
+
+        Magnum::Implementation::parallelFor(_threadCount, rowCount, [&](const std::size_t i) {
+            /* Copy the row to drop the padding, then RGB(A) to BGR(A) */
+            char* const row = rows.begin() + i*rowSize;
+            std::copy_n(imageData + (chunkBegin + i)*rowStride, rowSize, row);
+            if(image.format() == PixelFormat::RGB8Unorm)
+                swapRedBlue(Containers::ArrayView<Color3ub>{reinterpret_cast<Color3ub*>(row), std::size_t(image.size().x())});
+            else if(image.format() == PixelFormat::RGBA8Unorm)
+                swapRedBlue(Containers::ArrayView<Color4ub>{reinterpret_cast<Color4ub*>(row), std::size_t(image.size().x())});
+
+            if(_rleCompression) {
+                char* const out = compressed.begin() + i*compressedRowSize;
+                compressedRowEnds[i] = encodeRleRow(row, image.size().x(), pixelSize, out) - compressed.begin();
+            }
+        });
+
+        if(!_rleCompression) {
+            if(!sink(rows.prefix(rowCount*rowSize), userData)) return false;
+            continue;
+        }
+
+        /* Compact the compressed rows, the first row is already in place */
+        std::size_t end = compressedRowEnds[0];
+        for(std::size_t i = 1; i < rowCount; ++i) {
+            const std::size_t begin = i*compressedRowSize;
+            std::memmove(compressed.begin() + end, compressed.begin() + begin, compressedRowEnds[i] - begin);
+            end += compressedRowEnds[i] - begin;
+        }
+        if(!sink(compressed.prefix(end), userData)) return false;
     }
 
-    return data;
+    return true;
 }
 
 }}
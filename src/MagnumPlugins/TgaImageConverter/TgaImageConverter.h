@@ -66,6 +66,28 @@ dependency of another plugin with CMake, you need to request the
 `TgaImageConverter` component of the `Magnum` package and link to the
 `Magnum::TgaImageConverter` target. See @ref building, @ref cmake and
 @ref plugins for more information.
+
+The image data are written uncompressed by default. Use
+@ref setRleCompression() to write RLE-compressed files instead, which is
+usually significantly smaller for images with large areas of the same color:
+
+@code{.cpp}
+static_cast<Trade::TgaImageConverter&>(*converter).setRleCompression(true);
+@endcode
+
+@section Trade-TgaImageConverter-streaming Streaming and multithreaded export
+
+Besides @ref exportToData(), the plugin supports
+@ref AbstractImageConverter::Feature::ConvertStream. The output of
+@ref exportToSink() and @ref exportToFile() is produced in chunks of whole
+rows of roughly 1 MB, so exporting large images doesn't need memory for
+another copy of the whole image. The rows in each chunk are independent of
+each other and can be converted on multiple threads of
+@ref globalJobExecutor() using @ref setThreadCount(). The output is the same
+regardless of the thread count.
+Multithreaded export is not available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where @ref setThreadCount() is
+ignored.
 */
 class MAGNUM_TGAIMAGECONVERTER_EXPORT TgaImageConverter: public AbstractImageConverter {
     public:
@@ -75,9 +97,55 @@ class MAGNUM_TGAIMAGECONVERTER_EXPORT TgaImageConverter: public AbstractImageCon
         /** @brief Plugin manager constructor */
         explicit TgaImageConverter(PluginManager::AbstractManager& manager, const std::string& plugin);
 
+        /**
+         * @brief Whether RLE compression is enabled
+         *
+         * Default is @cpp false @ce.
+         */
+        bool rleCompression() const { return _rleCompression; }
+
+        /**
+         * @brief Enable or disable RLE compression
+         * @return Reference to self (for method chaining)
+         *
+         * The run-length packets never cross scanline boundaries, as
+         * recommended by the TGA specification.
+         */
+        TgaImageConverter& setRleCompression(bool enabled) {
+            _rleCompression = enabled;
+            return *this;
+        }
+
+        /**
+         * @brief Thread count used for export
+         *
+         * Default is @cpp 1 @ce, meaning the export is done only on the
+         * calling thread.
+         */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count used for export
+         * @return Reference to self (for method chaining)
+         *
+         * The calling thread is counted as well. Value of @cpp 0 @ce is
+         * treated the same as @cpp 1 @ce. See
+         * @ref Trade-TgaImageConverter-streaming for more information.
+         */
+        TgaImageConverter& setThreadCount(UnsignedInt count) {
+            _threadCount = count ? count : 1;
+            return *this;
+        }
+
     private:
         Features MAGNUM_TGAIMAGECONVERTER_LOCAL doFeatures() const override;
         Containers::Array<char> MAGNUM_TGAIMAGECONVERTER_LOCAL doExportToData(const ImageView2D& image) override;
+        bool MAGNUM_TGAIMAGECONVERTER_LOCAL doExportToSink(const ImageView2D& image, bool(*sink)(Containers::ArrayView<const char>, void*), void* userData) override;
+
+        bool MAGNUM_TGAIMAGECONVERTER_LOCAL exportInternal(const ImageView2D& image, bool(*sink)(Containers::ArrayView<const char>, void*), void* userData);
+
+        bool _rleCompression{};
+        UnsignedInt _threadCount{1};
 };
 
 }}
@@ -0,0 +1,169 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/TgaImporter/TgaHeader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+/* Every benchmark imports a 2048x2048 RGB image, i.e. 12 MB of pixel data,
+   so the throughput is 12 MB divided by the reported time */
+struct TgaImporterBenchmark: TestSuite::Tester {
+    explicit TgaImporterBenchmark();
+
+    void openData();
+    void openDataRle();
+    void openFile();
+    void openFileInto();
+
+    private:
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+        Containers::Array<char> _data, _dataRle;
+        std::string _filename;
+};
+
+namespace {
+    enum: UnsignedShort { Size = 2048 };
+    enum: std::size_t { PixelDataSize = std::size_t{Size}*Size*3 };
+
+    Implementation::TgaHeader header(UnsignedByte imageType) {
+        Implementation::TgaHeader header{};
+        header.imageType = imageType;
+        header.width = Utility::Endianness::littleEndian(UnsignedShort(Size));
+        header.height = Utility::Endianness::littleEndian(UnsignedShort(Size));
+        header.bpp = 24;
+        return header;
+    }
+
+    Containers::ArrayView<char> allocator(std::size_t size, void* userData) {
+        auto& memory = *static_cast<Containers::Array<char>*>(userData);
+        return memory.prefix(size < memory.size() ? size : memory.size());
+    }
+}
+
+TgaImporterBenchmark::TgaImporterBenchmark() {
+    addBenchmarks({&TgaImporterBenchmark::openData,
+                   &TgaImporterBenchmark::openDataRle,
+                   &TgaImporterBenchmark::openFile,
+                   &TgaImporterBenchmark::openFileInto}, 5);
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef TGAIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(TGAIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* Uncompressed image with a gradient */
+    _data = Containers::Array<char>{Containers::ValueInit, sizeof(Implementation::TgaHeader) + PixelDataSize};
+    const Implementation::TgaHeader uncompressed = header(2);
+    std::memcpy(_data.data(), &uncompressed, sizeof(uncompressed));
+    for(std::size_t i = 0; i != PixelDataSize; ++i)
+        _data[sizeof(Implementation::TgaHeader) + i] = char(i*7);
+
+    /* RLE image made of maximum-length repeat packets, each followed by a
+       single pixel */
+    constexpr std::size_t PacketCount = std::size_t{Size}*Size/128;
+    _dataRle = Containers::Array<char>{Containers::ValueInit, sizeof(Implementation::TgaHeader) + PacketCount*4};
+    const Implementation::TgaHeader rle = header(10);
+    std::memcpy(_dataRle.data(), &rle, sizeof(rle));
+    for(std::size_t i = 0; i != PacketCount; ++i) {
+        char* packet = _dataRle.data() + sizeof(Implementation::TgaHeader) + i*4;
+        packet[0] = char(0x80|127);
+        packet[1] = char(i);
+        packet[2] = char(i*3);
+        packet[3] = char(i*5);
+    }
+
+    _filename = Utility::Directory::join(TGAIMPORTER_WRITE_DIR, "benchmark.tga");
+    Utility::Directory::mkpath(TGAIMPORTER_WRITE_DIR);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Directory::write(_filename, Containers::ArrayView<const void>{_data.data(), _data.size()}));
+}
+
+void TgaImporterBenchmark::openData() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openData(_data);
+        size += importer->image2D(0)->data().size();
+    }
+
+    CORRADE_COMPARE(size, PixelDataSize);
+}
+
+void TgaImporterBenchmark::openDataRle() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openData(_dataRle);
+        size += importer->image2D(0)->data().size();
+    }
+
+    CORRADE_COMPARE(size, PixelDataSize);
+}
+
+void TgaImporterBenchmark::openFile() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    /* The file is mapped instead of read into memory */
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openFile(_filename);
+        size += importer->image2D(0)->data().size();
+    }
+
+    CORRADE_COMPARE(size, PixelDataSize);
+}
+
+void TgaImporterBenchmark::openFileInto() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    /* Reusing the same memory for all imports, so the only cost is the
+       conversion */
+    Containers::Array<char> memory{PixelDataSize};
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openFile(_filename);
+        size += importer->image2DInto(0, allocator, &memory)->data().size();
+    }
+
+    CORRADE_COMPARE(size, PixelDataSize);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImporterBenchmark)
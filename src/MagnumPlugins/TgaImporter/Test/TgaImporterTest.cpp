@@ -51,7 +51,19 @@ struct TgaImporterTest: TestSuite::Tester {
     void grayscaleBits8();
     void grayscaleBits16();
 
+    void rleColorBits24();
+    void rleColorBits32();
+    void rleGrayscaleBits8();
+    void rleTooShort();
+    void rleTooLong();
+
+    void into();
+    void intoRle();
+    void intoAllocatorTooSmall();
+
     void useTwice();
+    void openFileColor();
+    void openFileNotFound();
 
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
@@ -69,7 +81,19 @@ TgaImporterTest::TgaImporterTest() {
               &TgaImporterTest::grayscaleBits8,
               &TgaImporterTest::grayscaleBits16,
 
-              &TgaImporterTest::useTwice});
+              &TgaImporterTest::rleColorBits24,
+              &TgaImporterTest::rleColorBits32,
+              &TgaImporterTest::rleGrayscaleBits8,
+              &TgaImporterTest::rleTooShort,
+              &TgaImporterTest::rleTooLong,
+
+              &TgaImporterTest::into,
+              &TgaImporterTest::intoRle,
+              &TgaImporterTest::intoAllocatorTooSmall,
+
+              &TgaImporterTest::useTwice,
+              &TgaImporterTest::openFileColor,
+              &TgaImporterTest::openFileNotFound});
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
@@ -200,6 +224,182 @@ void TgaImporterTest::grayscaleBits16() {
     CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported grayscale bits-per-pixel: 16\n");
 }
 
+void TgaImporterTest::rleColorBits24() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        /* Run of three pixels, raw packet of two, run of one */
+        char(0x82), 1, 2, 3,
+        0x01, 4, 5, 6, 7, 8, 9,
+        char(0x80), 10, 11, 12
+    };
+    const char pixels[] = {
+        3, 2, 1, 3, 2, 1,
+        3, 2, 1, 6, 5, 4,
+        9, 8, 7, 12, 11, 10
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::rleColorBits32() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 32, 0,
+        char(0x85), 1, 2, 3, 4
+    };
+    const char pixels[] = {
+        3, 2, 1, 4, 3, 2, 1, 4,
+        3, 2, 1, 4, 3, 2, 1, 4,
+        3, 2, 1, 4, 3, 2, 1, 4
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::rleGrayscaleBits8() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        0x02, 1, 2, 3,
+        char(0x82), 4
+    };
+    const char pixels[] = {
+        1, 2,
+        3, 4,
+        4, 4
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::rleTooShort() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        0x02, 1, 2, 3
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    std::ostringstream debug;
+    Error redirectError{&debug};
+    CORRADE_VERIFY(!importer->image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): the RLE data are too short\n");
+}
+
+void TgaImporterTest::rleTooLong() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        char(0x86), 1
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    std::ostringstream debug;
+    Error redirectError{&debug};
+    CORRADE_VERIFY(!importer->image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): RLE packet exceeds the image size\n");
+}
+
+namespace {
+
+Containers::ArrayView<char> allocator(std::size_t, void* userData) {
+    return *static_cast<Containers::ArrayView<char>*>(userData);
+}
+
+}
+
+void TgaImporterTest::into() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        1, 2, 3, 2, 3, 4,
+        3, 4, 5, 4, 5, 6,
+        5, 6, 7, 6, 7, 8
+    };
+    const char pixels[] = {
+        3, 2, 1, 4, 3, 2,
+        5, 4, 3, 6, 5, 4,
+        7, 6, 5, 8, 7, 6
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    char storage[18];
+    Containers::ArrayView<char> destination{storage};
+    Containers::Optional<Trade::ImageData2D> image = importer->image2DInto(0, allocator, &destination);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+
+    /* The image references the external memory */
+    CORRADE_COMPARE(static_cast<const void*>(image->data().data()), static_cast<const void*>(storage));
+    CORRADE_COMPARE_AS(Containers::arrayView(storage), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::intoRle() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        /* Run of three pixels, raw packet of two, run of one */
+        char(0x82), 1, 2, 3,
+        0x01, 4, 5, 6, 7, 8, 9,
+        char(0x80), 10, 11, 12
+    };
+    const char pixels[] = {
+        3, 2, 1, 3, 2, 1,
+        3, 2, 1, 6, 5, 4,
+        9, 8, 7, 12, 11, 10
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    char storage[18];
+    Containers::ArrayView<char> destination{storage};
+    Containers::Optional<Trade::ImageData2D> image = importer->image2DInto(0, allocator, &destination);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(static_cast<const void*>(image->data().data()), static_cast<const void*>(storage));
+    CORRADE_COMPARE_AS(Containers::arrayView(storage), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::intoAllocatorTooSmall() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char data[] = {
+        0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        1, 2, 3, 2, 3, 4,
+        3, 4, 5, 4, 5, 6,
+        5, 6, 7, 6, 7, 8
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char storage[17];
+    Containers::ArrayView<char> destination{storage};
+    CORRADE_VERIFY(!importer->image2DInto(0, allocator, &destination));
+    CORRADE_COMPARE(out.str(), "Trade::TgaImporter::image2DInto(): expected at least 18 bytes from the allocator but got 17\n");
+}
+
 void TgaImporterTest::useTwice() {
     std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Directory::join(TGAIMPORTER_TEST_DIR, "file.tga")));
@@ -216,6 +416,44 @@ void TgaImporterTest::useTwice() {
     }
 }
 
+void TgaImporterTest::openFileColor() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(TGAIMPORTER_TEST_DIR, "color24.tga")));
+
+    const char pixels[] = {
+        3, 2, 1, 4, 3, 2,
+        5, 4, 3, 6, 5, 4,
+        7, 6, 5, 8, 7, 6
+    };
+
+    /* The swizzle is done on a copy-on-write mapping, so importing the second
+       time should give the same result and not a double-swizzled one */
+    for(std::size_t i = 0; i != 2; ++i) {
+        Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+        CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+        CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+            TestSuite::Compare::Container);
+    }
+
+    /* The image data should survive closing the importer */
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    importer->close();
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::openFileNotFound() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    std::ostringstream debug;
+    Error redirectError{&debug};
+    CORRADE_VERIFY(!importer->openFile("nonexistent.tga"));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::openFile(): cannot open file nonexistent.tga\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImporterTest)
@@ -25,3 +25,4 @@
 
 #cmakedefine TGAIMPORTER_PLUGIN_FILENAME "${TGAIMPORTER_PLUGIN_FILENAME}"
 #define TGAIMPORTER_TEST_DIR "${TGAIMPORTER_TEST_DIR}"
+#define TGAIMPORTER_WRITE_DIR "${TGAIMPORTER_WRITE_DIR}"
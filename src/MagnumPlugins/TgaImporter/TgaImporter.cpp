@@ -26,19 +26,80 @@
 #include "TgaImporter.h"
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <Corrade/Utility/Endianness.h>
 #include <Corrade/Containers/ArrayView.h>
 
+#include "Magnum/PixelConversion.h"
 #include "Magnum/PixelFormat.h"
-#include "Magnum/Math/Swizzle.h"
-#include "Magnum/Math/Vector4.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MapFile.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
 namespace Magnum { namespace Trade {
 
+namespace {
+
+/* Expands RLE packets from the input into the output, which is expected to
+   have the exact size of the decoded image */
+bool decodeRle(const Containers::ArrayView<const char> in, const Containers::ArrayView<char> out, const std::size_t pixelSize) {
+    const char* src = in.begin();
+    char* dst = out.begin();
+    while(dst != out.end()) {
+        if(src == in.end()) {
+            Error() << "Trade::TgaImporter::image2D(): the RLE data are too short";
+            return false;
+        }
+
+        /* The lower seven bits are pixel count minus one */
+        const UnsignedByte packet = *src++;
+        const std::size_t size = ((packet & 0x7f) + 1)*pixelSize;
+        if(size > std::size_t(out.end() - dst)) {
+            Error() << "Trade::TgaImporter::image2D(): RLE packet exceeds the image size";
+            return false;
+        }
+
+        /* Run packet, containing a single pixel to repeat */
+        if(packet & 0x80) {
+            if(std::size_t(in.end() - src) < pixelSize) {
+                Error() << "Trade::TgaImporter::image2D(): the RLE data are too short";
+                return false;
+            }
+
+            /* Copy the pixel once and then keep doubling the filled range */
+            if(pixelSize == 1) std::memset(dst, *src, size);
+            else {
+                std::memcpy(dst, src, pixelSize);
+                for(std::size_t filled = pixelSize; filled < size; ) {
+                    const std::size_t count = std::min(filled, size - filled);
+                    std::memcpy(dst + filled, dst, count);
+                    filled += count;
+                }
+            }
+
+            src += pixelSize;
+
+        /* Raw packet */
+        } else {
+            if(std::size_t(in.end() - src) < size) {
+                Error() << "Trade::TgaImporter::image2D(): the RLE data are too short";
+                return false;
+            }
+
+            std::memcpy(dst, src, size);
+            src += size;
+        }
+
+        dst += size;
+    }
+
+    return true;
+}
+
+}
+
 TgaImporter::TgaImporter() = default;
 
 TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
@@ -49,16 +110,38 @@ auto TgaImporter::doFeatures() const -> Features { return Feature::OpenData; }
 
 bool TgaImporter::doIsOpened() const { return _in; }
 
-void TgaImporter::doClose() { _in = nullptr; }
+void TgaImporter::doClose() {
+    _in = nullptr;
+    _filename = {};
+}
 
 void TgaImporter::doOpenData(const Containers::ArrayView<const char> data) {
     _in = Containers::Array<char>{data.size()};
     std::copy(data.begin(), data.end(), _in.begin());
 }
 
+void TgaImporter::doOpenFile(const std::string& filename) {
+    Containers::Optional<Containers::Array<char>> data = mapFile(filename);
+    if(!data) {
+        Error() << "Trade::TgaImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    _in = std::move(*data);
+    _filename = filename;
+}
+
 UnsignedInt TgaImporter::doImage2DCount() const { return 1; }
 
 Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
+    return image(nullptr, nullptr);
+}
+
+Containers::Optional<ImageData2D> TgaImporter::doImage2DInto(UnsignedInt, Containers::ArrayView<char>(*const allocator)(std::size_t, void*), void* const userData) {
+    return image(allocator, userData);
+}
+
+Containers::Optional<ImageData2D> TgaImporter::image(Containers::ArrayView<char>(*const allocator)(std::size_t, void*), void* const userData) {
     /* Check if the file is long enough */
     if(_in.size() < std::streamoff(sizeof(Implementation::TgaHeader))) {
         Error() << "Trade::TgaImporter::image2D(): the file is too short:" << _in.size() << "bytes";
@@ -78,8 +161,12 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
         return Containers::NullOpt;
     }
 
+    /* The RLE variants differ only in the fourth bit */
+    const bool rle = header.imageType & 8;
+    const UnsignedByte imageType = header.imageType & ~8;
+
     /* Color */
-    if(header.imageType == 2) {
+    if(imageType == 2) {
         switch(header.bpp) {
             case 24:
                 format = PixelFormat::RGB8Unorm;
@@ -93,36 +180,68 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
         }
 
     /* Grayscale */
-    } else if(header.imageType == 3) {
+    } else if(imageType == 3) {
         format = PixelFormat::R8Unorm;
         if(header.bpp != 8) {
             Error() << "Trade::TgaImporter::image2D(): unsupported grayscale bits-per-pixel:" << header.bpp;
             return Containers::NullOpt;
         }
 
-    /* Compressed files */
+    /* Paletted compressed files and other unknown types */
     } else {
         Error() << "Trade::TgaImporter::image2D(): unsupported (compressed?) image type:" << header.imageType;
         return Containers::NullOpt;
     }
 
-    Containers::Array<char> data{std::size_t(size.product())*header.bpp/8};
-    std::copy_n(_in + sizeof(Implementation::TgaHeader), data.size(), data.begin());
+    const std::size_t dataSize = std::size_t(size.product())*header.bpp/8;
+    Containers::Array<char> data;
+
+    /* Decode or copy directly into caller-provided memory. The memory is
+       owned by the caller, so the deleter does nothing. */
+    if(allocator) {
+        const Containers::ArrayView<char> destination = allocator(dataSize, userData);
+        if(destination.size() < dataSize) {
+            Error() << "Trade::TgaImporter::image2DInto(): expected at least" << dataSize << "bytes from the allocator but got" << destination.size();
+            return Containers::NullOpt;
+        }
+
+        data = Containers::Array<char>{destination.data(), dataSize, [](char*, std::size_t) {}};
+        if(rle) {
+            if(!decodeRle(_in.suffix(sizeof(Implementation::TgaHeader)), data, header.bpp/8))
+                return Containers::NullOpt;
+        } else std::copy_n(_in + sizeof(Implementation::TgaHeader), data.size(), data.begin());
+
+    /* Decode RLE data */
+    } else if(rle) {
+        data = Containers::Array<char>{dataSize};
+        if(!decodeRle(_in.suffix(sizeof(Implementation::TgaHeader)), data, header.bpp/8))
+            return Containers::NullOpt;
+
+    /* If opened from a file, map the pixel data again so they can be
+       returned without a copy. The mapping is copy-on-write, so the swizzle
+       below doesn't affect the file, the other mapping or other imported
+       images. */
+    } else if(!_filename.empty()) {
+        Containers::Optional<Containers::Array<char>> mapped = mapFile(_filename, sizeof(Implementation::TgaHeader));
+        if(mapped && mapped->size() >= dataSize) data = std::move(*mapped);
+    }
+
+    /* Otherwise copy the data */
+    if(!data) {
+        data = Containers::Array<char>{dataSize};
+        std::copy_n(_in + sizeof(Implementation::TgaHeader), data.size(), data.begin());
+    }
 
     /* Adjust pixel storage if row size is not four byte aligned */
     PixelStorage storage;
     if((size.x()*header.bpp/8)%4 != 0)
         storage.setAlignment(1);
 
-    if(format == PixelFormat::RGB8Unorm) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data.data());
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(format == PixelFormat::RGBA8Unorm) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data.data());
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
-    }
+    /* BGR(A) to RGB(A) */
+    if(format == PixelFormat::RGB8Unorm)
+        swapRedBlue(Containers::ArrayView<Color3ub>{reinterpret_cast<Color3ub*>(data.data()), std::size_t(size.product())});
+    else if(format == PixelFormat::RGBA8Unorm)
+        swapRedBlue(Containers::ArrayView<Color4ub>{reinterpret_cast<Color4ub*>(data.data()), std::size_t(size.product())});
 
     return ImageData2D{storage, format, size, std::move(data)};
 }
@@ -57,8 +57,8 @@ namespace Magnum { namespace Trade {
 /**
 @brief TGA importer plugin
 
-Supports Truevision TGA (`*.tga`, `*.vda`, `*.icb`, `*.vst`) uncompressed BGR,
-BGRA or grayscale images with 8 bits per channel.
+Supports Truevision TGA (`*.tga`, `*.vda`, `*.icb`, `*.vst`) uncompressed
+and RLE-compressed BGR, BGRA or grayscale images with 8 bits per channel.
 
 This plugin depends on the @ref Trade library and is built if `WITH_TGAIMPORTER`
 is enabled when building Magnum. To use as a dynamic plugin, you need to load
@@ -72,6 +72,15 @@ The images are imported with @ref PixelFormat::RGB8Unorm,
 @ref PixelFormat::RGBA8Unorm or @ref PixelFormat::R8Unorm, respectively. Images
 are imported with default @ref PixelStorage parameters except for alignment,
 which may be changed to `1` if the data require it.
+
+Files opened with @ref openFile() are memory-mapped using @ref mapFile() and,
+on Unix systems, the uncompressed image data returned from @ref image2D() are
+referencing a copy-on-write mapping of the file instead of being copied.
+Uncompressed grayscale images are thus imported without touching the pixel
+data at all and for color images the channel swizzle is done in-place on the
+mapped memory. Because of that, the imported data array may be larger than
+the actual image if the file contains additional data after the pixels.
+RLE-compressed images and data passed to @ref openData() are always copied.
 */
 class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
     public:
@@ -87,11 +96,16 @@ class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
         Features MAGNUM_TGAIMPORTER_LOCAL doFeatures() const override;
         bool MAGNUM_TGAIMPORTER_LOCAL doIsOpened() const override;
         void MAGNUM_TGAIMPORTER_LOCAL doOpenData(Containers::ArrayView<const char> data) override;
+        void MAGNUM_TGAIMPORTER_LOCAL doOpenFile(const std::string& filename) override;
         void MAGNUM_TGAIMPORTER_LOCAL doClose() override;
         UnsignedInt MAGNUM_TGAIMPORTER_LOCAL doImage2DCount() const override;
         Containers::Optional<ImageData2D> MAGNUM_TGAIMPORTER_LOCAL doImage2D(UnsignedInt id) override;
+        Containers::Optional<ImageData2D> MAGNUM_TGAIMPORTER_LOCAL doImage2DInto(UnsignedInt id, Containers::ArrayView<char>(*allocator)(std::size_t, void*), void* userData) override;
+
+        Containers::Optional<ImageData2D> MAGNUM_TGAIMPORTER_LOCAL image(Containers::ArrayView<char>(*allocator)(std::size_t, void*), void* userData);
 
         Containers::Array<char> _in;
+        std::string _filename;
 };
 
 }}
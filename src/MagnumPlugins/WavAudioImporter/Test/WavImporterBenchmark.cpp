@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2016 Alice Margatroid <loveoverwhelming@gmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Audio { namespace Test {
+
+/* Every benchmark imports 16 MB of 16-bit stereo PCM data, so the throughput
+   is 16 MB divided by the reported time */
+struct WavImporterBenchmark: TestSuite::Tester {
+    explicit WavImporterBenchmark();
+
+    void openDataData();
+    void openDataReadData();
+    void openFileData();
+
+    private:
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+        Containers::Array<char> _data;
+        std::string _filename;
+};
+
+namespace {
+    enum: std::size_t { DataSize = 16*1024*1024 };
+
+    void writeLittleEndian(char* out, UnsignedInt value, std::size_t size) {
+        for(std::size_t i = 0; i != size; ++i)
+            out[i] = char((value >> (i*8)) & 0xff);
+    }
+}
+
+WavImporterBenchmark::WavImporterBenchmark() {
+    addBenchmarks({&WavImporterBenchmark::openDataData,
+                   &WavImporterBenchmark::openDataReadData,
+                   &WavImporterBenchmark::openFileData}, 5);
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef WAVAUDIOIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT(_manager.load(WAVAUDIOIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* RIFF header, PCM format chunk and the data chunk */
+    _data = Containers::Array<char>{Containers::ValueInit, 44 + DataSize};
+    char* out = _data.data();
+    std::memcpy(out, "RIFF", 4);
+    writeLittleEndian(out + 4, 36 + DataSize, 4);
+    std::memcpy(out + 8, "WAVEfmt ", 8);
+    writeLittleEndian(out + 16, 16, 4);     /* format chunk size */
+    writeLittleEndian(out + 20, 1, 2);      /* PCM */
+    writeLittleEndian(out + 22, 2, 2);      /* channels */
+    writeLittleEndian(out + 24, 44100, 4);  /* sample rate */
+    writeLittleEndian(out + 28, 44100*4, 4); /* byte rate */
+    writeLittleEndian(out + 32, 4, 2);      /* block align */
+    writeLittleEndian(out + 34, 16, 2);     /* bits per sample */
+    std::memcpy(out + 36, "data", 4);
+    writeLittleEndian(out + 40, DataSize, 4);
+    for(std::size_t i = 0; i != DataSize; ++i)
+        out[44 + i] = char(i*13);
+
+    _filename = Utility::Directory::join(WAVAUDIOIMPORTER_WRITE_DIR, "benchmark.wav");
+    Utility::Directory::mkpath(WAVAUDIOIMPORTER_WRITE_DIR);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Directory::write(_filename, Containers::ArrayView<const void>{_data.data(), _data.size()}));
+}
+
+void WavImporterBenchmark::openDataData() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openData(_data);
+        size += importer->data().size();
+    }
+
+    CORRADE_COMPARE(size, DataSize);
+}
+
+void WavImporterBenchmark::openDataReadData() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+
+    /* Streaming in 64 kB chunks into the same memory instead of making a copy
+       of the whole data */
+    Containers::Array<char> chunk{64*1024};
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openData(_data);
+        std::size_t offset = 0, read;
+        while((read = importer->readData(offset, chunk)))
+            offset += read;
+        size += offset;
+    }
+
+    CORRADE_COMPARE(size, DataSize);
+}
+
+void WavImporterBenchmark::openFileData() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        importer->openFile(_filename);
+        size += importer->data().size();
+    }
+
+    CORRADE_COMPARE(size, DataSize);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::WavImporterBenchmark)
@@ -72,6 +72,10 @@ struct WavImporterTest: TestSuite::Tester {
     void surround51Channel16();
     void surround71Channel24();
 
+    void readData();
+    void dataView();
+    void dataViewOpenData();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -108,7 +112,11 @@ WavImporterTest::WavImporterTest() {
               &WavImporterTest::stereo64f,
 
               &WavImporterTest::surround51Channel16,
-              &WavImporterTest::surround71Channel24});
+              &WavImporterTest::surround71Channel24,
+
+              &WavImporterTest::readData,
+              &WavImporterTest::dataView,
+              &WavImporterTest::dataViewOpenData});
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
@@ -421,6 +429,58 @@ void WavImporterTest::surround71Channel24() {
     CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::Extensible\n");
 }
 
+void WavImporterTest::readData() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo8ALaw.wav")));
+
+    const Containers::Array<char> data = importer->data();
+    CORRADE_VERIFY(data.size() > 64);
+
+    /* Chunk in the middle */
+    char chunk[64];
+    CORRADE_COMPARE(importer->readData(16, chunk), 64);
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{chunk},
+        data.slice(16, 80),
+        TestSuite::Compare::Container<Containers::ArrayView<const char>>);
+
+    /* Chunk at the end is cut */
+    CORRADE_COMPARE(importer->readData(data.size() - 10, chunk), 10);
+    CORRADE_COMPARE_AS(Containers::ArrayView<const char>{chunk}.prefix(10),
+        data.suffix(data.size() - 10),
+        TestSuite::Compare::Container<Containers::ArrayView<const char>>);
+
+    /* Nothing after the end */
+    CORRADE_COMPARE(importer->readData(data.size(), chunk), 0);
+    CORRADE_COMPARE(importer->readData(data.size() + 100, chunk), 0);
+}
+
+void WavImporterTest::dataView() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    CORRADE_VERIFY(importer->features() & AbstractImporter::Feature::DataView);
+    CORRADE_VERIFY(importer->openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo8ALaw.wav")));
+
+    const Containers::Array<char> data = importer->data();
+    const Containers::ArrayView<const char> view = importer->dataView();
+    CORRADE_COMPARE_AS(view, Containers::ArrayView<const char>{data},
+        TestSuite::Compare::Container<Containers::ArrayView<const char>>);
+
+    /* The view should stay the same on repeated calls, no copy is made */
+    CORRADE_VERIFY(importer->dataView().data() == view.data());
+}
+
+void WavImporterTest::dataViewOpenData() {
+    std::unique_ptr<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    const Containers::Array<char> file = Utility::Directory::read(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo8ALaw.wav"));
+    CORRADE_VERIFY(importer->openData(file));
+
+    /* The samples are copied out of the passed data */
+    const Containers::Array<char> data = importer->data();
+    const Containers::ArrayView<const char> view = importer->dataView();
+    CORRADE_VERIFY(view.data() < file.begin() || view.data() >= file.end());
+    CORRADE_COMPARE_AS(view, Containers::ArrayView<const char>{data},
+        TestSuite::Compare::Container<Containers::ArrayView<const char>>);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::WavImporterTest)
@@ -26,12 +26,22 @@
 
 #include "WavImporter.h"
 
+#include <algorithm>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/Endianness.h>
 
 #include "MagnumPlugins/WavAudioImporter/WavHeader.h"
 
+#ifdef CORRADE_TARGET_UNIX
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace Magnum { namespace Audio {
 
 using Implementation::RiffChunk;
@@ -39,19 +49,78 @@ using Implementation::WavAudioFormat;
 using Implementation::WavFormatChunk;
 using Implementation::WavHeaderChunk;
 
+#ifdef CORRADE_TARGET_UNIX
+namespace {
+
+/* The whole file is mapped, so unlike with Trade::mapFile() the array
+   always starts at the mapping beginning */
+void unmap(char* const data, const std::size_t size) {
+    munmap(data, size);
+}
+
+}
+#endif
+
 WavImporter::WavImporter() = default;
 
 WavImporter::WavImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
 
-auto WavImporter::doFeatures() const -> Features { return Feature::OpenData; }
+auto WavImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::DataView; }
 
-bool WavImporter::doIsOpened() const { return _data; }
+bool WavImporter::doIsOpened() const { return _file; }
 
 void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
+    const Containers::Optional<Containers::ArrayView<const char>> samples = parse(data);
+    if(!samples) return;
+
+    /* Copy just the sample data, not the whole file */
+    _file = Containers::Array<char>{samples->size()};
+    std::copy(samples->begin(), samples->end(), _file.begin());
+    _data = _file;
+}
+
+void WavImporter::doOpenFile(const std::string& filename) {
+    #ifdef CORRADE_TARGET_UNIX
+    /* Map the file so the samples are paged in only when they're actually
+       accessed and no copy is made */
+    const int fd = open(filename.data(), O_RDONLY);
+    if(fd == -1) {
+        Error() << "Audio::WavImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || !st.st_size) {
+        ::close(fd);
+        Error() << "Audio::WavImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    /* The endianness of the format chunk is fixed in place, so the mapping
+       has to be writable. It's private, so nothing is written back. */
+    void* const mapped = mmap(nullptr, st.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(mapped == MAP_FAILED) {
+        Error() << "Audio::WavImporter::openFile(): cannot map file" << filename;
+        return;
+    }
+
+    Containers::Array<char> file{static_cast<char*>(mapped), std::size_t(st.st_size), unmap};
+    const Containers::Optional<Containers::ArrayView<const char>> samples = parse(file);
+    if(!samples) return;
+
+    _file = std::move(file);
+    _data = *samples;
+    #else
+    AbstractImporter::doOpenFile(filename);
+    #endif
+}
+
+Containers::Optional<Containers::ArrayView<const char>> WavImporter::parse(const Containers::ArrayView<const char> data) {
     /* Check file size */
     if(data.size() < sizeof(WavHeaderChunk) + sizeof(WavFormatChunk) + sizeof(RiffChunk)) {
         Error() << "Audio::WavImporter::openData(): the file is too short:" << data.size() << "bytes";
-        return;
+        return Containers::NullOpt;
     }
 
     /* Get the RIFF/WAV header */
@@ -61,7 +130,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if(std::strncmp(header.chunk.chunkId, "RIFF", 4) != 0 ||
        std::strncmp(header.format, "WAVE", 4) != 0) {
         Error() << "Audio::WavImporter::openData(): the file signature is invalid";
-        return;
+        return Containers::NullOpt;
     }
 
     Utility::Endianness::littleEndianInPlace(header.chunk.chunkSize);
@@ -70,7 +139,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if(header.chunk.chunkSize < 36 || header.chunk.chunkSize + 8 != data.size()) {
         Error() << "Audio::WavImporter::openData(): the file has improper size, expected"
                 << header.chunk.chunkSize + 8 << "but got" << data.size();
-        return;
+        return Containers::NullOpt;
     }
 
     const RiffChunk* dataChunk = nullptr;
@@ -81,14 +150,14 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     UnsignedInt offset = 0;
 
     /* Skip any chunks that aren't the format or data chunk */
-    while(headerSize + offset <= header.chunk.chunkSize) {
+    while(headerSize + offset <= header.chunk.chunkSize && headerSize + offset + sizeof(RiffChunk) <= data.size()) {
         const RiffChunk* currChunk = reinterpret_cast<const RiffChunk*>(data.begin() + headerSize + offset);
         offset += Utility::Endianness::littleEndian(currChunk->chunkSize) + sizeof(RiffChunk);
 
         if(std::strncmp(currChunk->chunkId, "fmt ", 4) == 0) {
             if(formatChunk != nullptr) {
                 Error() << "Audio::WavImporter::openData(): the file contains too many format chunks";
-                return;
+                return Containers::NullOpt;
             }
 
             formatChunk = reinterpret_cast<const WavFormatChunk*>(currChunk);
@@ -96,7 +165,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         } else if(std::strncmp(currChunk->chunkId, "data", 4) == 0) {
             if(dataChunk != nullptr) {
                 Error() << "Audio::WavImporter::openData(): the file contains too many data chunks";
-                return;
+                return Containers::NullOpt;
             }
 
             dataChunk = currChunk;
@@ -109,13 +178,13 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     /* Make sure we actually got a format chunk */
     if(formatChunk == nullptr) {
         Error() << "Audio::WavImporter::openData(): the file contains no format chunk";
-        return;
+        return Containers::NullOpt;
     }
 
     /* Make sure we actually got a data chunk */
     if(dataChunk == nullptr) {
         Error() << "Audio::WavImporter::openData(): the file contains no data chunk";
-        return;
+        return Containers::NullOpt;
     }
 
     /* Fix endianness on Format chunk */
@@ -139,7 +208,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): PCM with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return Containers::NullOpt;
         }
 
     /* Check IEEE Float format */
@@ -156,7 +225,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): IEEE with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return Containers::NullOpt;
         }
 
     /* Check A-Law format */
@@ -169,7 +238,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): ALaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return Containers::NullOpt;
         }
 
     /* Check μ-Law format */
@@ -182,26 +251,26 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): MuLaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return Containers::NullOpt;
         }
 
     /* Unknown/unimplemented format */
     } else {
         Error() << "Audio::WavImporter::openData(): unsupported format" << formatChunk->audioFormat;
-        return;
+        return Containers::NullOpt;
     }
 
     /* Size sanity checks */
     if(headerSize + offset > data.size()) {
         Error() << "Audio::WavImporter::openData(): file size doesn't match computed size";
-        return;
+        return Containers::NullOpt;
     }
 
     /* Format sanity checks */
     if(formatChunk->blockAlign != formatChunk->numChannels * formatChunk->bitsPerSample / 8 ||
        formatChunk->byteRate != formatChunk->sampleRate * formatChunk->blockAlign) {
         Error() << "Audio::WavImporter::openData(): the file is corrupted";
-        return;
+        return Containers::NullOpt;
     }
 
     /* Save frequency */
@@ -210,14 +279,13 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     /** @todo Convert the data from little endian too */
     CORRADE_INTERNAL_ASSERT(!Utility::Endianness::isBigEndian());
 
-    /* Copy the data */
-    const char* dataChunkPtr = reinterpret_cast<const char*>(dataChunk + 1);
-    _data = Containers::Array<char>(dataChunkSize);
-    std::copy(dataChunkPtr, dataChunkPtr+dataChunkSize, _data.begin());
-    return;
+    return Containers::ArrayView<const char>{reinterpret_cast<const char*>(dataChunk + 1), dataChunkSize};
 }
 
-void WavImporter::doClose() { _data = nullptr; }
+void WavImporter::doClose() {
+    _data = nullptr;
+    _file = nullptr;
+}
 
 BufferFormat WavImporter::doFormat() const { return _format; }
 
@@ -229,7 +297,17 @@ Containers::Array<char> WavImporter::doData() {
     return copy;
 }
 
+Containers::ArrayView<const char> WavImporter::doDataView() { return _data; }
+
+std::size_t WavImporter::doReadData(const std::size_t offset, const Containers::ArrayView<char> destination) {
+    if(offset >= _data.size()) return 0;
+
+    const std::size_t size = std::min(destination.size(), _data.size() - offset);
+    std::copy_n(_data + offset, size, destination.begin());
+    return size;
+}
+
 }}
 
 CORRADE_PLUGIN_REGISTER(WavAudioImporter, Magnum::Audio::WavImporter,
-    "cz.mosra.magnum.Audio.AbstractImporter/0.1")
+    "cz.mosra.magnum.Audio.AbstractImporter/0.2")
@@ -31,6 +31,7 @@
  */
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
 
@@ -81,6 +82,15 @@ a dependency of another plugin with CMake, you need to request the
 @section Audio-WavImporter-limitations Behavior and limitations
 
 Multi-channel formats are not supported.
+
+When opening a file using @ref openFile(), the file is memory-mapped on Unix
+systems and the samples are accessed directly from the mapping, so they're
+paged in only when needed. Elsewhere and when opening data using
+@ref openData(), just the sample data are copied on opening. While @ref data()
+returns a new copy on every call, @ref dataView() returns a view on the
+samples without any copy and @ref readData() copies just the requested part,
+so streaming the file using @ref StreamingSource doesn't need any extra
+memory.
 */
 class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
     public:
@@ -94,13 +104,22 @@ class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Features doFeatures() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenFile(const std::string& filename) override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doClose() override;
 
         MAGNUM_WAVAUDIOIMPORTER_LOCAL BufferFormat doFormat() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL UnsignedInt doFrequency() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Array<char> doData() override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::ArrayView<const char> doDataView() override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL std::size_t doReadData(std::size_t offset, Containers::ArrayView<char> destination) override;
+
+        /* Parses the headers, fills format and frequency and returns a view
+           on the sample data inside the file */
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Optional<Containers::ArrayView<const char>> parse(Containers::ArrayView<const char> data);
 
-        Containers::Array<char> _data;
+        /* Either a copy of the samples or the whole mapped file */
+        Containers::Array<char> _file;
+        Containers::ArrayView<const char> _data;
         BufferFormat _format;
         UnsignedInt _frequency;
 };